@@ -0,0 +1,173 @@
+import argparse
+import json
+import os
+import re
+import sys
+import threading
+import time
+from subprocess import Popen, PIPE, call
+
+# Boots xk under QEMU, runs the benchmark programs from its shell and
+# compares what they report against a baseline, like
+# crash_safety_test.py does for crash safety.  "make bench" runs it.
+#
+#   python3 bench.py             compare against bench_baseline.json
+#   python3 bench.py --update    record this run as the new baseline
+#
+# Timings in cycles (benchreport() medians, append cycles) must not
+# go up, and rates (fsbench's ops/s and KB/s) must not go down, by
+# more than the threshold.  The console output goes to bench_output.txt.
+
+benchmarks = ["fsbench", "forkbench", "pipebench", "membench"]
+baseline_file = "bench_baseline.json"
+output_file = "bench_output.txt"
+prompt = "$ "
+boot_timeout = 60
+run_timeout = 600
+
+report_re = re.compile(r"^(.+): (\d+) runs, cycles min (\d+) median (\d+) max (\d+)")
+fs_re = re.compile(r"^(\S+(?: \d+)?): (\d+) ops (\d+) ticks(?: (\d+) ops/s)?(?: (\d+) KB/s)?")
+append_re = re.compile(r"^\s+cycles per append: mean (\d+) max (\d+)")
+
+class Console:
+    """Collects QEMU's console output on a thread, so we can wait for
+    text to show up in it with a timeout."""
+
+    def __init__(self, process, log):
+        self.process = process
+        self.log = log
+        self.buf = ""
+        self.lock = threading.Lock()
+        threading.Thread(target=self.reader, daemon=True).start()
+
+    def reader(self):
+        while True:
+            data = self.process.stdout.read1(4096)
+            if not data:
+                return
+            text = data.decode(errors="replace")
+            self.log.write(text)
+            with self.lock:
+                self.buf += text
+
+    # Wait for s to appear after offset start; returns the text up to
+    # it, or None on a timeout.
+    def wait(self, s, start, timeout):
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            with self.lock:
+                i = self.buf.find(s, start)
+                if i >= 0:
+                    return self.buf[start:i], i + len(s)
+            if self.process.poll() is not None:
+                break
+            time.sleep(0.1)
+        return None, start
+
+    def send(self, line):
+        self.process.stdin.write((line + "\n").encode())
+        self.process.stdin.flush()
+
+# Turn a benchmark's output into {metric: (value, higher is better)}.
+def parse(prog, text):
+    metrics = {}
+    last = None
+    for line in text.splitlines():
+        line = line.rstrip("\r")
+        m = report_re.match(line)
+        if m:
+            metrics["%s/%s" % (prog, m.group(1))] = (int(m.group(4)), False)
+            continue
+        m = fs_re.match(line)
+        if m:
+            last = "%s/%s" % (prog, m.group(1))
+            if m.group(4):
+                metrics[last + " ops/s"] = (int(m.group(4)), True)
+            if m.group(5):
+                metrics[last + " KB/s"] = (int(m.group(5)), True)
+            continue
+        m = append_re.match(line)
+        if m and last:
+            metrics[last + " cycles"] = (int(m.group(1)), False)
+    return metrics
+
+def run():
+    garbage = open("garbage.txt", "w")
+    call(["make"], stdout=garbage, stderr=garbage)
+    garbage.close()
+    os.remove("garbage.txt")
+    print("make finished.")
+
+    log = open(output_file, "w")
+    process = Popen(["make", "qemu"], stdin=PIPE, stdout=PIPE)
+    console = Console(process, log)
+    metrics = {}
+    try:
+        _, pos = console.wait(prompt, 0, boot_timeout)
+        if pos == 0:
+            print("xk did not boot; see " + output_file)
+            return None
+        for prog in benchmarks:
+            print("running " + prog)
+            console.send(prog)
+            text, pos = console.wait(prompt, pos, run_timeout)
+            if text is None:
+                print(prog + " did not finish; see " + output_file)
+                return None
+            metrics.update(parse(prog, text))
+    finally:
+        process.terminate()
+        call(["pkill", "qemu"])
+        log.close()
+    return metrics
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--update", action="store_true",
+                        help="save this run as the baseline")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="fraction a metric may get worse by")
+    args = parser.parse_args()
+
+    metrics = run()
+    if metrics is None:
+        sys.exit(1)
+    if not metrics:
+        print("no benchmark output found; see " + output_file)
+        sys.exit(1)
+
+    if args.update or not os.path.exists(baseline_file):
+        with open(baseline_file, "w") as f:
+            json.dump({k: v[0] for k, v in metrics.items()}, f, indent=2,
+                      sort_keys=True)
+        print("saved %d metrics to %s" % (len(metrics), baseline_file))
+        return
+
+    with open(baseline_file) as f:
+        baseline = json.load(f)
+    regressions = 0
+    for name in sorted(metrics):
+        value, higher = metrics[name]
+        if name not in baseline:
+            print("%-45s %12d  (new)" % (name, value))
+            continue
+        base = baseline[name]
+        change = (value - base) / base if base else 0.0
+        worse = -change if higher else change
+        flag = ""
+        if worse > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print("%-45s %12d %12d %+7.1f%%%s" % (name, base, value, 100 * change,
+                                             flag))
+    for name in sorted(set(baseline) - set(metrics)):
+        print("%-45s  missing from this run" % name)
+
+    if regressions:
+        print("%d regressions beyond %d%%" % (regressions,
+                                               100 * args.threshold))
+        sys.exit(1)
+    print("no regressions beyond %d%%" % (100 * args.threshold))
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,7 @@
 import os
+import re
+import sys
+import threading
 from subprocess import call
 from multiprocessing import Process
 import time
@@ -52,5 +55,75 @@ def main():
 
     r.close()
 
+# --recovery: for each log fill level, boot xk, have logfill commit that
+# many blocks and crash at the next disk write, and time the boot
+# that follows, from the kernel's banner to the shell prompt, along
+# with the kernel's own "log: recovered" line.  QEMU reboots in place, so the disk image and
+# its log survive the crash.
+fill_levels = [0, 100, 400, 800]
+recovery_file = "recovery_output.txt"
+recovered_re = re.compile(r"log: recovered (\d+) blocks in (\d+) us")
+
+def wait_for(state, text, start, timeout):
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        with state["lock"]:
+            i = state["buf"].find(text, start)
+            if i >= 0:
+                return i + len(text)
+        time.sleep(0.01)
+    return -1
+
+def measure_recovery():
+    garbage = open("garbage.txt", 'w')
+    call(["make"], stdout = garbage, stderr = garbage)
+    garbage.close()
+    os.remove("garbage.txt")
+    print("make finished.")
+
+    w = open(recovery_file, 'w')
+    print("%8s %10s %12s %12s" % ("fill", "recovered", "replay us", "boot ms"))
+    for n in fill_levels:
+        process = Popen([r'make', 'qemu'], stdin=PIPE, stdout=PIPE)
+        state = {"buf": "", "lock": threading.Lock()}
+
+        def reader():
+            while True:
+                data = process.stdout.read1(4096)
+                if not data:
+                    return
+                text = data.decode(errors="replace")
+                w.write(text)
+                with state["lock"]:
+                    state["buf"] += text
+
+        threading.Thread(target=reader, daemon=True).start()
+        pos = wait_for(state, "$ ", 0, 60)
+        if pos < 0:
+            print("xk did not boot; see " + recovery_file)
+            break
+        process.stdin.write(("logfill %d\n" % n).encode())
+        process.stdin.flush()
+        pos = wait_for(state, "crashing", pos, 120)
+        # The crash comes at the next disk write; the reboot starts over
+        # with the boot banner
+        booted = wait_for(state, "starting xk", pos, 60)
+        booted_at = time.time()
+        ready = wait_for(state, "$ ", max(booted, 0), 60)
+        elapsed = (time.time() - booted_at) * 1000
+        process.terminate()
+        call(["pkill", "qemu"])
+        if pos < 0 or booted < 0 or ready < 0:
+            print("logfill %d did not crash and recover; see %s" % (n, recovery_file))
+            continue
+        with state["lock"]:
+            m = recovered_re.search(state["buf"], booted)
+        blocks, us = (m.group(1), m.group(2)) if m else ("0", "0")
+        print("%8d %10s %12s %12d" % (n, blocks, us, elapsed))
+    w.close()
+
 if __name__ == "__main__":
-    main()
+    if "--recovery" in sys.argv:
+        measure_recovery()
+    else:
+        main()
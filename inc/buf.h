@@ -7,8 +7,14 @@ struct buf {
   uint refcnt;
   struct buf *prev; // LRU cache list
   struct buf *next;
+  struct buf *hnext; // hash bucket chain
+  int hashed;        // is the buf on a hash chain?
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uchar *data;       // the block: mem, or the disk's own copy of it
+                     // if the driver maps its blocks (idemap())
+  uchar mem[BSIZE];
 };
 #define B_VALID 0x2 // buffer has been read from disk
 #define B_DIRTY 0x4 // buffer needs to be written to disk
+#define B_ASYNC 0x8 // nobody waits for the I/O; release buffer on completion
+#define B_QUEUED 0x10 // request is queued at the disk
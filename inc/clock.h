@@ -0,0 +1,26 @@
+#pragma once
+
+// Clocks of clock_gettime()
+#define CLOCK_MONOTONIC 1 // since the TSC was calibrated, at boot
+
+// Every process maps this read-only page, so the library's
+// clock_gettime() can read the TSC and convert it itself.
+#define CLOCKPAGE 0x8000000000 // 512 GB, the second PML4 entry, above 4 GB of user space
+
+#define CLOCKSHIFT 32 // ns = (tsc - tsc0) * mult >> CLOCKSHIFT
+
+struct clockpage {
+  uint64_t tsc0;  // rdtsc() when the clock started
+  uint64_t mult;  // 0 until the TSC has been calibrated
+  uint64_t tschz; // TSC counts a second
+};
+
+struct timespec {
+  int64_t tv_sec;
+  int64_t tv_nsec;
+};
+
+// Nanoseconds since the clock started, at TSC reading tsc
+static inline uint64_t clockns(struct clockpage *c, uint64_t tsc) {
+  return ((unsigned __int128)(tsc - c->tsc0) * c->mult) >> CLOCKSHIFT;
+}
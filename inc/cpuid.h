@@ -82,6 +82,15 @@ enum {
   CPUID_FEATURE_HYPERVISOR = CPUID_BIT(CPUID_1_ECX, 31),
 };
 
+// CPUID(7, 0): EBX
+enum {
+  CPUID_FEATURE_FSGSBASE = CPUID_BIT(CPUID_7_EBX, 0),
+  CPUID_FEATURE_SMEP = CPUID_BIT(CPUID_7_EBX, 7),
+  CPUID_FEATURE_ERMS = CPUID_BIT(CPUID_7_EBX, 9),
+  CPUID_FEATURE_INVPCID = CPUID_BIT(CPUID_7_EBX, 10),
+  CPUID_FEATURE_SMAP = CPUID_BIT(CPUID_7_EBX, 20),
+};
+
 // CPUID(0x80000001): EDX
 enum {
   // duplicated (fpu)		= CPUID_BIT(CPUID_80000001_EDX, 0),
@@ -148,3 +157,6 @@ enum {
 };
 
 void cpuid_print(void);
+
+extern int erms; // in string.c
+extern int havepge, havepcid; // in vspace.c
@@ -2,15 +2,30 @@
 #include <cdefs.h>
 
 struct buf;
+struct clockpage;
 struct context;
 struct extent;
 struct inode;
+struct iovec;
+struct kmem_cache;
+struct lockclass;
+struct lockstat;
+struct pollent;
+struct pollset;
 struct proc;
+struct profsample;
 struct rtcdate;
+struct scproc;
+struct shmseg;
 struct spinlock;
 struct sleeplock;
+struct rwsleeplock;
 struct stat;
 struct superblock;
+struct timer;
+struct tracerec;
+struct uring;
+struct trap_frame;
 struct vpage_info;
 struct vpi_page;
 struct vregion;
@@ -21,7 +36,29 @@ extern int pages_in_use;
 extern int pages_in_swap;
 extern int free_pages;
 extern int num_page_faults;
-extern int num_disk_reads;
+extern int cow_reuses;
+extern int cow_copies;
+extern int swap_outs;
+extern int swap_ins;
+extern int clock_scans;
+extern int clock_referenced;
+extern uint64_t disk_reads;
+extern uint64_t disk_writes;
+extern uint64_t disk_requests;
+extern uint64_t log_commits;
+extern uint64_t log_blocks;
+extern uint64_t log_checkpoints;
+extern int bcache_nbuf;
+extern int bcache_hits;
+extern int bcache_misses;
+extern int icache_ninode;
+extern int icache_hits;
+extern int icache_misses;
+extern int dcache_hits;
+extern int dcache_misses;
+extern int pcache_npage;
+extern int pcache_hits;
+extern int pcache_misses;
 
 extern int crashn_enable;
 extern int crashn;
@@ -45,18 +82,33 @@ extern int crashn;
 // bio.c
 void binit(void);
 struct buf *bread(uint, uint);
+struct buf *bread_async(uint, uint);
+struct buf *bclaim(uint, uint);
+void bwait(struct buf *);
+void bprefetch(uint, uint);
 void brelse(struct buf *);
+void brelse_cold(struct buf *);
+int bshrink(void);
 void bwrite(struct buf *);
+void bwrite_async(struct buf *);
 void print_data_at_block(uint);
 
+// clock.c
+extern struct clockpage *clockpage;
+void clockinit(void);
+uint64_t nsecs(void);
+
 // console.c
 void consoleinit(void);
 void cprintf(char *, ...);
 void consoleintr(int (*)(void));
+void consolestart(void);
+int consolemode(int);
 noreturn void panic(char *);
 
 // exec.c
 int exec(char *, char **);
+int execload(struct vspace *, char *, char **, struct trap_frame *);
 
 // fs.c
 void readsb(int dev, struct superblock *sb);
@@ -66,23 +118,55 @@ struct inode *idup(struct inode *);
 void iinit(int dev);
 void irelease(struct inode *);
 void locki(struct inode *);
+void locki_shared(struct inode *);
 void unlocki(struct inode *);
 int namecmp(const char *, const char *);
 struct inode *namei(char *);
+struct inode *nameiat(struct inode *, char *);
 struct inode *nameiparent(char *, char *);
 int concurrent_readi(struct inode *, char *, uint, uint);
 int readi(struct inode *, char *, uint, uint);
+int readiraw(struct inode *, char *, uint, uint);
+int readiv(struct inode *, struct iovec *, int, uint);
+int readiblock(struct inode *, uint, uint, int (*)(char *, int, void *), void *);
+void readahead(struct inode *, uint, uint);
+void concurrent_readahead(struct inode *, uint, uint);
 void concurrent_stati(struct inode *, struct stat *);
 void stati(struct inode *, struct stat *);
 int concurrent_writei(struct inode *, char *, uint, uint);
 int writei(struct inode *, char *, uint, uint);
+int writeiv(struct inode *, struct iovec *, int, uint);
+int clonei(struct inode *, struct inode *);
+int ipunch(struct inode *, uint, uint);
+int defragi(struct inode *);
+void log_flush(void);
+void fsynci(struct inode *);
 struct inode* create_inode(char* name); // Added
 void delete_inode(struct inode* ip); // Added
 
+// futex.c
+void futexinit(void);
+int futexwait(uint64_t, int);
+int futexwake(uint64_t, int);
+
 // ide.c
 void ideinit(void);
 void ideintr(void);
 void iderw(struct buf *);
+void idesubmit(struct buf *);
+void ideiowait(struct buf *);
+void ideplug(void);
+void ideunplug(void);
+uchar *idemap(uint, uint);
+
+// virtio.c
+extern int virtioirq;
+int virtioinit(void);
+void virtiosubmit(struct buf *);
+void virtiowait(struct buf *);
+void virtioplug(void);
+void virtiounplug(void);
+void virtiointr(void);
 
 // ioapic.c
 void ioapicenable(int irq, int cpu);
@@ -94,13 +178,16 @@ struct core_map_entry *pa2page(uint64_t pa);
 void detect_memory(void);
 char *kalloc(void);
 void kfree(char *);
+char *kalloc_order(int);
+char *kalloc_order_try(int);
+char *kalloc_zeroed(void);
+int kzeroidle(void);
+void kfree_order(char *, int);
+void kallocstats(int *);
 void mem_init(void *);
 void mark_user_mem(uint64_t, uint64_t);
 void mark_kernel_mem(uint64_t);
-struct core_map_entry *get_random_user_page();
 void increment_ref(struct core_map_entry* entry);
-void lock_memory(void);
-void unlock_memory(void);
 
 // kbd.c
 void kbdintr(void);
@@ -112,21 +199,47 @@ extern volatile uint *lapic;
 void lapiceoi(void);
 void lapicinit(void);
 void lapicstartap(uchar, uint);
+void lapicwake(uchar);
+void lapictlb(uchar);
+void lapiconeshot(uint);
+uint lapicperiodic(uint);
+void lapicrate(uint);
 void microdelay(int);
 
+// lockstat.c
+struct lockclass *lockclass(char *, int);
+void lockstat_acquire(struct lockclass *, int, uint64_t);
+void lockstat_release(struct lockclass *, uint64_t);
+int lockstats(struct lockstat *, int, int);
+
 // mp.c
 extern int ismp;
 void mpinit(void);
 
 // vspace.c
+extern char *zeropage;
 void                vspacebootinit(void);
 int                 vspaceinit(struct vspace *);
 void                vspaceinitcode(struct vspace *, char *, uint64_t);
 int                 vspaceloadcode(struct vspace *, char *, uint64_t *);
 void                vspaceinvalidate(struct vspace *);
+int                 vspaceupdate(struct vspace *, uint64_t, uint64_t);
 void                vspacemarknotpresent(struct vspace *, uint64_t);
+void                vspacemove(struct vspace *, struct vspace *);
+void                vspacepin(struct vspace *, char *, int, int);
+void                vspaceunpin(struct vspace *);
+int                 vspacemmap(struct vspace *, struct inode *, uint64_t, uint64_t, int);
+int                 vspacemunmap(struct vspace *, uint64_t, uint64_t);
+int                 vspaceshmat(struct vspace *, struct shmseg *);
+int                 vspaceshmdt(struct vspace *, uint64_t);
+int                 vspacefilemap(struct vspace *, uint64_t, int);
 void                vspaceinstall(struct proc *);
 void                vspaceinstallkern(void);
+void                vspacecpuinit(void);
+void                vspaceflush(struct vspace *, uint64_t);
+void                vspaceflushall(struct vspace *);
+void                vspacetlbintr(void);
+void                vspacetlbpoll(void);
 void                vspacefree(struct vspace *);
 struct vregion*     va2vregion(struct vspace *, uint64_t);
 struct vpage_info*  va2vpage_info(struct vregion *, uint64_t);
@@ -136,34 +249,73 @@ int                 vspaceinitstack(struct vspace *, uint64_t);
 int                 vspacewritetova(struct vspace *, uint64_t, char *, int);
 void                vspacedumpstack(struct vspace *);
 void                vspacedumpcode(struct vspace *);
-int                 vregionaddmap(struct vregion *, uint64_t, uint64_t, short, short);
+int                 vregionaddmap(struct vspace *, struct vregion *, uint64_t, uint64_t, short, short);
+int                 vregionaddhuge(struct vspace *, struct vregion *, uint64_t);
+int                 vregionaddzero(struct vspace *, struct vregion *, uint64_t);
 int                 vregiondelmap(struct vregion *, uint64_t, uint64_t);
 
+// pagecache.c
+void pcacheinit(void);
+char *pcacheget(struct inode *, uint, int);
+int pcacheread(struct inode *, char *, uint, uint);
+int pcacheapply(struct inode *, uint, uint, int (*)(char *, int, void *),
+                void *);
+int pcached(struct inode *, uint);
+void pcacheupdate(struct inode *, uint, uint);
+void pcacheforget(struct inode *);
+int pcacheshrink(void);
+
 // picirq.c
 void picenable(int);
 void picinit(void);
 
+// poll.c
+void pollinit(void);
+void pollqueue(struct pollent **, struct spinlock *, struct pollent *, struct pollset *);
+void polldequeue(struct pollent *);
+void pollwake(struct pollent *);
+void pollstart(struct pollset *);
+int pollsleep(struct pollset *, int);
+
 // proc.c
 void exit(void);
 int fork(void);
+int clone(uint64_t, uint64_t, uint64_t);
+int join(void);
+int spawn(char *, char **, int *);
+int kthread_create(void (*)(void *), void *, char *, int);
+int kthread_clone(void (*)(void *), void *, char *);
 int growproc(int);
 int kill(int);
 void pinit(void);
 void procdump(void);
+int procsyscalls(struct scproc *, int);
 noreturn void scheduler(void);
 void sched(void);
 void sleep(void *, struct spinlock *);
 void userinit(void);
 int wait(void);
 void wakeup(void *);
+void wakeupone(void *);
+int wakeupn(void *, int);
+int schedtick(void);
+int nice(int);
 void yield(void);
 void reboot(void);
 
+// prof.c
+extern int profrate;
+void profinit(void);
+void profsample(struct trap_frame *);
+int profread(struct profsample *, int);
+uint64_t profdropped(void);
+
 // swtch.S
 void swtch(struct context **, struct context *);
 
 // spinlock.c
 void acquire(struct spinlock *);
+int tryacquire(struct spinlock *);
 void getcallerpcs(void *, uint64_t *);
 int holding(struct spinlock *);
 void initlock(struct spinlock *, char *);
@@ -171,11 +323,43 @@ void release(struct spinlock *);
 void pushcli(void);
 void popcli(void);
 
+// swap.c
+void swapinit(int, struct superblock *);
+void swapdup(int);
+void swapfree(int);
+int swapavail(void);
+int swapout(void);
+int swapin(struct vspace *, uint64_t);
+void rmapinit(void);
+void rmapacquire(void);
+void rmaprelease(void);
+int rmapadd(struct vspace *, struct vpage_info *, uint64_t);
+int rmapdrop(struct vpage_info *);
+void rmapmove(struct vpage_info *, struct vspace *);
+
+// shm.c
+void shminit(void);
+int shmget(int, int);
+struct shmseg *shmattach(int);
+void shmdup(struct shmseg *);
+void shmput(struct shmseg *);
+
+// slab.c
+void slabinit(void);
+struct kmem_cache *kmem_cache_create(char *, uint, void (*)(void *));
+void *kmem_cache_alloc(struct kmem_cache *);
+void kmem_cache_free(struct kmem_cache *, void *);
+
 // sleeplock.c
 void acquiresleep(struct sleeplock *);
 void releasesleep(struct sleeplock *);
 int holdingsleep(struct sleeplock *);
 void initsleeplock(struct sleeplock *, char *);
+void acquiresleep_read(struct rwsleeplock *);
+void acquiresleep_write(struct rwsleeplock *);
+void releaserwsleep(struct rwsleeplock *);
+int holdingrwsleep(struct rwsleeplock *);
+void initrwsleeplock(struct rwsleeplock *, char *);
 
 // string.c
 int memcmp(const void *, const void *, uint);
@@ -186,16 +370,43 @@ int strlen(const char *);
 int strncmp(const char *, const char *, uint);
 char *strncpy(char *, const char *, int);
 
+// uring.c
+void uringinit(void);
+int ringsetup(void);
+int ringenter(int);
+void ringfree(struct uring *);
+
+// usercopy.S
+int copyuser(void *, const void *, uint64_t);
+int64_t copyuserstr(char *, const char *, uint64_t);
+int touchuser(int *);
+
 // syscall.c
 int argint(int, int *);
 int argint64(int, int64_t *);
 int argptr(int, char **, int);
 int argstr(int, char **);
+int checkptr(uint64_t, int);
+int copyin(void *, uint64_t, uint64_t);
+int copyout(uint64_t, void *, uint64_t);
+int copyinstr(char *, uint64_t, uint64_t);
 int fetchint(uint64_t, int *);
 int fetchint64_t(uint64_t, int64_t *);
 int fetchstr(uint64_t, char **);
 void syscall(void);
 
+// timer.c
+void timeradd(struct timer *, uint, void (*)(void *), void *);
+int timerdel(struct timer *);
+uint timernext(uint);
+void timertick(void);
+
+// trace.c
+extern int tracing;
+void traceinit(void);
+void traceevent(int, uint64_t, uint64_t);
+int traceread(struct tracerec *, int);
+
 // trap.c
 void idtinit(void);
 extern uint ticks;
@@ -206,5 +417,12 @@ extern struct spinlock tickslock;
 void uartinit(void);
 void uartintr(void);
 void uartputc(int);
+int uartwrite(char *, int);
+void uarttxintr(int);
+
+// x86_64vm.c
+char *kstackalloc(void);
+void kstackfree(char *);
+
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x) / sizeof((x)[0]))
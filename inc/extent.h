@@ -2,6 +2,6 @@
 
 // represents a contiguous block on disk of data
 struct extent {
-  uint startblkno; // start block number
+  uint startblkno; // start block number, or 0 for a hole of zeros
   uint nblocks;    // n blocks following the start block
 };
@@ -4,3 +4,7 @@
 #define O_WRONLY 0x001
 #define O_RDWR 0x002
 #define O_CREATE 0x200
+#define O_SYNC 0x400   // writes are durable when they return
+
+// fstatat()'s dirfd for a path looked up as open() looks it up
+#define AT_FDCWD -100
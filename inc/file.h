@@ -3,13 +3,14 @@
 #include <extent.h>
 #include <sleeplock.h>
 #include <param.h>
+#include <poll.h>
 
 #define DESC_AVAIL 0
 #define FILE_AVAIL 0
 #define DESC_NOT_AVAIL 1
 #define FILE_NOT_AVAIL 1
 
-#define MAX_PIPE_SIZE 4000
+#define MAX_PIPE_SIZE (PIPEPAGES * PGSIZE)
 
 // in-memory copy of an inode
 struct inode {
@@ -17,7 +18,7 @@ struct inode {
   uint inum; // Inode number
   int ref;   // Reference count
   int valid; // Flag for if node is valid
-  struct sleeplock lock;
+  struct rwsleeplock lock;
 
   short type; // copy of disk inode
   short devid;
@@ -25,13 +26,21 @@ struct inode {
   short used; // Stores a flag whether the inode is in use or not
   short num_extents; // Stores the number of extents currently in use 
   struct extent extent_array[30]; // Added an array of extents to track data
-  char padding[4];
+  uint indirect; // root of the extent tree, 0 if none
+  uint extent_end[30]; // file block just past each extent, for bmap()
+  uint nblocks; // blocks allocated, extent tree included
+  uint logseq;  // log transaction that last logged its blocks
+  struct inode *hnext; // icache hash chain
+  int hashed;          // is the inode on a hash chain?
+  struct inode *lprev; // icache LRU list, while ref == 0
+  struct inode *lnext;
 };
 
 // table mapping device ID (devid) to device functions
 struct devsw {
   int (*read)(struct inode *, char *, int);
   int (*write)(struct inode *, char *, int);
+  int (*poll)(struct inode *, int, struct pollent *, struct pollset *);
 };
 
 extern struct devsw devsw[];
@@ -49,6 +58,7 @@ enum {
 
 // Data structure representing open file
 struct file {
+  struct sleeplock lock; // serializes I/O through the shared offset
   struct inode* inodep;
   int32_t offset;
   int32_t ref_count;
@@ -56,6 +66,11 @@ struct file {
   int32_t access_mode;
   struct pipe* pipeptr;
   short file_type; // Will hold FILE, PIPE
+  short sync;      // opened O_SYNC: each write commits before returning
+  // Sequential read-ahead state (FILE only)
+  uint ra_off; // offset just past the previous read
+  uint ra_win; // current read-ahead window, in blocks (0 = off)
+  uint ra_end; // file block number just past the last prefetched block
 };
 
 // Data structure representing a file descriptor for a process
@@ -64,19 +79,31 @@ struct desc {
   int32_t available; // Stores whether this current position is available for use
 };
 
-// Data structure storing all file structs and a lock
+// Data structure storing all file structs and a lock.  The lock
+// covers allocating file structs and their ref counts; reads and
+// writes only take the lock of the file they use.
 struct files {
   struct file files[NFILE];
   struct sleeplock lock;
 };
 
+// Readers wait on &read_off for data, writers on &write_off for room.
 struct pipe {
   int read_off;
   int write_off;
   struct spinlock lock;
   int data_count;
-  char buffer[MAX_PIPE_SIZE];
+  int readers; // open references to the read end
+  int writers; // open references to the write end
+  char *buffer[PIPEPAGES]; // ring buffer, one page at a time
+  struct pollent *pollers; // polls waiting on either end
 };
 
 void fileinit(void); // The function that initializes the files array's sleeplock
+void filedup(struct file *f);
+void fileclose(struct file *f);
+struct pipe *pipealloc(void);
+int pipecopyout(struct pipe *pipe, char *dst, int n);
+int pipecopyin(struct pipe *pipe, char *src, int n);
+int pipepoll(struct pipe *pipe, int reading, int events, struct pollent *e, struct pollset *ps);
 extern struct files global_files;
@@ -1,23 +1,39 @@
 #pragma once
 
 #include "extent.h"
+#include "param.h"
 
 // On-disk file system format.
 // Both the kernel and user programs use this header file.
 
 #define INODEFILEINO 0 // inode file inum
 #define ROOTINO 1      // root i-number
-#define BSIZE 512      // block size
+
+#if BSIZE != 512 && BSIZE != 1024 && BSIZE != 2048 && BSIZE != 4096
+#error "BSIZE must be 512, 1024, 2048 or 4096"
+#endif
+
+#define FSMAGIC 0x786b6673 // "xkfs"
+#define FSVERSION 6        // 1 had no magic, version or block size, 2 a
+                           // flagged log header instead of commit records,
+                           // 3 no share counts, 4 no inline data, 5 no holes
+#define LOGMAGIC 0x786b6c67 // "xklg", in the log's super and commit records
 
 #define DINODE_USED 1 // dinode is being used
 #define DINODE_AVAIL 0 // dinode is not used
+#define DINODE_SHARED 2 // with DINODE_USED: some blocks may be shared
+#define DINODE_INLINE 4 // with DINODE_USED: the data is in extent_array
+#define DINODE_HOLES 8  // with DINODE_USED: some extents may be holes
 
-#define TX_VALID 1 // Transaction is valid
-#define TX_INVALID 0 // Transaction is invalid
+#define NDIRECT 30 // extents held in the dinode itself
+
+// A file of at most INLINESIZE bytes keeps its data in the dinode, in
+// place of its extents, until it grows past that.
+#define INLINESIZE (NDIRECT * sizeof(struct extent))
 
 // Disk layout:
-// [ boot block | super block | free bit map |
-//                                          inode file | data blocks]
+// [ boot block | super block | free bit map | share counts | log |
+//                              swap area | inode file | data blocks]
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -27,14 +43,50 @@ struct superblock {
   uint bmapstart;  // Block number of first free map block
   uint inodestart; // Block number of the start of inode file
   uint logstart;   // Block number of the start of the log
+  uint nlog;       // Number of log blocks, the log super included
+  uint swapstart;  // Block number of the start of the swap area
+  uint nswap;      // Number of swap blocks
+  uint magic;      // FSMAGIC
+  uint version;    // FSVERSION
+  uint bsize;      // Block size, which must be the kernel's BSIZE
+  uint refstart;   // Block number of the first share count block
+  uint nref;       // Number of share count blocks
+};
+
+// Disk blocks holding one swapped-out page
+#define SWAPBLOCKS (4096 / BSIZE)
+
+// The log is a log super block followed by a ring of slots:
+// [ log super | slot 0 | slot 1 | ... | slot nlog-2 ]
+// Each committed transaction takes the next run of slots, wrapping
+// around: its commit records, which list the real disk location of
+// each of its blocks, then the copies of those blocks.  The log super
+// says where the first transaction not yet installed starts.  From
+// there, recovery replays transactions for as long as each carries the
+// next sequence number and its checksum matches; the first that does
+// not ends the log, so a transaction is committed by a single batch of
+// writes, and nothing is rewritten to retire it.
+
+// Disk locations held by one commit record
+#define LOGHDRENTS ((BSIZE - 4 * sizeof(uint)) / sizeof(int))
+
+// Log slots a transaction of n blocks takes, its records included
+#define LOGSLOTS(n) ((n) + ((n) + LOGHDRENTS - 1) / LOGHDRENTS)
+
+// On-disk log super block
+struct logsuper {
+  uint magic; // LOGMAGIC
+  uint seq;   // Sequence number of the first transaction to replay
+  uint start; // Slot its first commit record is in
 };
 
-// On-disk header block for the log
+// On-disk commit record
 struct logheader {
-  int valid_flag; // Flag to tell whether transaction is valid or not
-  int disk_loc[29]; // Array storing real disk locations of blocks
-  int size; // Size of the transaction, in blocks
-  char padding[388]; // Padding to make logheader exactly one block.
+  uint magic;    // LOGMAGIC
+  uint seq;      // Sequence number of the transaction
+  uint size;     // Size of the transaction, in blocks
+  uint checksum; // logsum() of its block copies, then of its disk_locs
+  int disk_loc[LOGHDRENTS]; // Real disk locations of blocks
 };
 
 // On-disk inode structure
@@ -44,9 +96,34 @@ struct dinode {
   uint size;          // Size of file (bytes)
   short used; // Stores a flag whether the inode is in use or not
   short num_extents; // Stores the number of extents currently in use 
-  struct extent extent_array[30]; // Added an array of extents to track data
+  struct extent extent_array[NDIRECT]; // Added an array of extents to track data
                                   // Rhis is different from data to maintain backwards compatibility
-  char padding[4];
+  uint indirect;      // Root of the extent tree (index block), 0 if none
+};
+
+// Extents after the first NDIRECT live in a two-level tree:
+// dinode.indirect names an index block, whose children are leaf
+// blocks of extents.  Entries at both levels record the file block
+// they start at.
+#define NEXTIDX ((BSIZE - 2 * sizeof(uint)) / (2 * sizeof(uint)))
+#define NEXTLEAF ((BSIZE - 2 * sizeof(uint)) / (3 * sizeof(uint)))
+
+struct extidx {
+  uint nchild;   // Number of leaves in use
+  uint nblocks;  // Blocks covered by all the leaves
+  struct {
+    uint fblk;   // First file block of the leaf
+    uint blkno;  // Disk block of the leaf
+  } child[NEXTIDX];
+};
+
+struct extleaf {
+  uint nextent;  // Number of extents in use
+  uint pad;
+  struct {
+    uint fblk;   // First file block of the extent
+    struct extent ext;
+  } e[NEXTLEAF];
 };
 
 // offset of inode in inodefile
@@ -58,6 +135,14 @@ struct dinode {
 // Block of free map containing bit for block b
 #define BBLOCK(b, sb) ((b) / BPB + (sb).bmapstart)
 
+// Each block has a byte of share count: the number of files it
+// belongs to besides the first, which clone_file() adds to.  A block
+// is freed by the last file to let go of it.
+#define BREFMAX 255
+
+// Block of share counts containing the count of block b
+#define RBLOCK(b, sb) ((b) / BSIZE + (sb).refstart)
+
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
 
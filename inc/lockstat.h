@@ -0,0 +1,36 @@
+#pragma once
+
+#include <param.h>
+
+// Kinds of lock
+#define LS_SPIN 0
+#define LS_SLEEP 1
+#define LS_RWSLEEP 2
+
+#define NLOCKCLASS 64 // lock names lockstat() tells apart
+
+// Counters for all the locks initialized with one name, as lockstat()
+// reports them.  Times are in rdtsc() cycles.
+struct lockstat {
+  char name[16];
+  int kind;
+  uint64_t acquires;  // times taken
+  uint64_t contended; // of those, times it had to wait
+  uint64_t wait;      // cycles spent waiting
+  uint64_t hold;      // cycles held (shared holds of rw locks aren't timed)
+  uint64_t maxhold;   // longest single hold
+};
+
+// A lock class in the kernel.  Each CPU counts in its own slot, with
+// interrupts off, so counting needs no atomics.
+struct lockclass {
+  char *name;
+  int kind;
+  struct lockcpu {
+    uint64_t acquires;
+    uint64_t contended;
+    uint64_t wait;
+    uint64_t hold;
+    uint64_t maxhold;
+  } cpu[NCPU];
+};
@@ -19,13 +19,16 @@
 #define GDT_TSS (GDT_ENTRY_TSS << 3)
 
 #define AP_ENTRY 0x7000
-#define AP_OFFSET_CPUNUM 4 /* [0x7000-4, 0x7000) */
-#define AP_OFFSET_STACK 8  /* [0x7000-8, 0x7000-4) */
+#define AP_OFFSET_STACK 8  /* [0x7000-8, 0x7000) */
+#define AP_OFFSET_ENTRY 16 /* [0x7000-16, 0x7000-8) */
+#define AP_OFFSET_PGTBL 24 /* [0x7000-24, 0x7000-16) */
+#define AP_OFFSET_PGTMP 32 /* [0x7000-32, 0x7000-24) */
 
 #define EXTMEM 0x100000             // Start of extended memory
 #define DEVSPACE 0xFFFFFFFFFE000000 // Other devices are at high addresses
 #define KERNBASE 0xFFFFFFFF80000000
 #define DEVBASE 0xFFFFFFFF40000000
+#define KSTACKBASE 0xFFFFFF0000000000 // Guarded kernel stacks, one PML4 entry
 #define KERNLINK (KERNBASE + EXTMEM) // Address where kernel is linked
 
 #define V2P(a) (((uint64_t)(a)) - KERNBASE)
@@ -0,0 +1,5 @@
+#pragma once
+
+// mmap() protections
+#define PROT_READ 0x1
+#define PROT_WRITE 0x2 // writes go to a private copy, not to the file
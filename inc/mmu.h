@@ -23,6 +23,9 @@
 #define CR4_OSXMMEXCPT BIT32(10)
 #define CR4_VMXE BIT32(13)
 #define CR4_FSGSBASE BIT32(16)
+#define CR4_PCIDE BIT32(17)
+
+#define CR3_NOFLUSH BIT64(63) /* keep the TLB entries of the new PCID */
 
 #define FLAGS_CF BIT64(0)    /* carry flag */
 #define FLAGS_FIXED BIT64(1) /* always 1 */
@@ -114,8 +117,8 @@
 #define SEG_KCODE 1 // kernel code
 #define SEG_KDATA 2 // kernel data+stack
 #define SEG_KCPU 3  // kernel per-cpu data
-#define SEG_UCODE 4 // user code
-#define SEG_UDATA 5 // user data+stack
+#define SEG_UDATA 4 // user data+stack, just before user code for sysret
+#define SEG_UCODE 5 // user code
 #define SEG_TSS 6   // this process's task state
 
 // cpu->gdt[NSEGS] holds the above segments.
@@ -156,6 +159,10 @@ struct core_map_entry {
   short user;   // 0 if kernel allocated memory, otherwise is user
   uint64_t va;  // if it is used by kernel only, this field is 0
   int ref_count; // ref_count of processes to this physical add.
+  struct core_map_entry *next_free; // kmem free lists, while available
+  struct core_map_entry *prev_free;
+  short order; // order of the free buddy block this page heads, else -1
+  struct rmap *rmap; // user mappings of the page, see swap.c
 };
 
 #endif
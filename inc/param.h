@@ -1,18 +1,44 @@
 #pragma once
 
 #define KSTACKSIZE PGSIZE
-#define NPROC 64       // maximum number of processes
+#define NPROC 4096     // maximum number of processes
 #define NCPU 8         // maximum number of CPUs
+#define NPCID 8        // address spaces each CPU keeps TLB entries for
 #define NOFILE 16      // open files per process
 #define NFILE 100      // open files per system
-#define NINODE 50      // maximum number of active i-nodes
+#define NINODE 50      // minimum number of cached i-nodes
+#define ICACHE_DIV 128 // give the inode cache 1/ICACHE_DIV of free pages
 #define NDEV 10        // maximum major device number
 #define ROOTDEV 1      // device number of file system root disk
 #define MAXARG 32      // max exec arguments
 #define MAXOPBLOCKS 10 // max # of blocks any FS op writes
 
-#define LOGSIZE (MAXOPBLOCKS * 3) // max data blocks in on-disk log
-#define NBUF (MAXOPBLOCKS * 3)    // size of disk block cache
-#define FSSIZE 100000             // size of file system in blocks
+// File system block size, 512 (the default), 1024, 2048 or 4096
+// bytes.  "make BSIZE=4096" builds the kernel, mkfs and fs.img for 4K
+// blocks; "make clean" first, as the objects do not depend on it.
+// Sizes below in blocks scale with it, to keep the same bytes.
+#ifndef BSIZE
+#define BSIZE 512
+#endif
+
+#define LOGSIZE (1024 * 512 / BSIZE) // size of on-disk log in blocks, log super included
+#define MAXWRITEBLOCKS (256 * 512 / BSIZE) // max data blocks one write() transaction logs
+#define NBUF (MAXOPBLOCKS * 3)    // minimum size of disk block cache
+#define LOGCOMMITTICKS 100        // max ticks a transaction stays open
+#define FLUSHTICKS 100            // the log flusher looks at least this often
+#define FLUSHAGE 500              // max ticks committed blocks wait to go home
+#define BCACHE_DIV 16             // boot-time cache gets 1/16 of free pages
+#define BCACHE_MAXDIV 4           // cache may grow to 1/4 of free pages
+#define FSSIZE (100000 * 512 / BSIZE) // size of file system in blocks
+#define SWAPPAGES 2048            // size of the swap area in pages
+#define RAMAXBLOCKS 32            // max sequential read-ahead window (blocks)
+#define PIPEPAGES 4               // pages of buffer in each pipe
+#define MAXORDER 9                // largest kalloc_order() block is 2^9 pages
 #define MAXCODEPAGES 256
 #define MAXPATHLEN 20
+#define NPRIO 4                   // scheduler priority levels
+#define SCHEDSLICE 1              // time slice of the top level, in ticks
+#define SCHEDBOOST 100            // ticks between raising everyone to the top
+#define IDLEMAXTICKS 256          // longest an idle CPU goes without a tick
+#define NICE_MAX 19               // largest nice() value
+#define PID_MAX 32767             // pids wrap around after this
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <param.h>
+
+// Events of a struct pollfd
+#define POLLIN 0x01   // a read would not block
+#define POLLOUT 0x04  // a write would not block
+#define POLLHUP 0x10  // a pipe's other end is closed (revents only)
+#define POLLNVAL 0x20 // fd is not open (revents only)
+
+// One file descriptor of a poll()
+struct pollfd {
+  int fd;
+  short events;  // what to wait for
+  short revents; // what is ready, filled in by poll()
+};
+
+struct pollset;
+struct spinlock;
+
+// What a poll() leaves on the queue of one file it waits on, such as
+// a pipe's, for that file's state changes to wake.
+struct pollent {
+  struct pollset *ps;
+  struct spinlock *lock; // the file's lock, which guards its queue
+  struct pollent *next;
+  struct pollent **pprev; // link pointing at it, or 0 if not queued
+};
+
+// A poll() waiting, on its kernel stack
+struct pollset {
+  int ready;  // woken since it last looked?
+  struct pollent ent[NOFILE];
+};
@@ -2,6 +2,7 @@
 #include <defs.h>
 #include <param.h>
 #include <segment.h>
+#include <syscall.h>
 #include <vspace.h>
 #include <file.h>
 
@@ -14,9 +15,29 @@ struct cpu {
   volatile uint started;     // Has the CPU started?
   int ncli;                  // Depth of pushcli nesting.
   int intena;                // Were interrupts enabled before pushcli?
+  volatile uint idle;        // Halted in the scheduler, waiting for work?
+  volatile uint tickless;    // Timer stopped or one-shot while idle?
+  uint tickdiv;              // Timer interrupts a tick, more to profile
+  uint subtick;              // Of those, since the last tick
 
   struct cpu *cpu;
   struct proc *proc;
+  uint64_t syscallstack;     // Top of the kernel stack syscalls run on
+  uint64_t userrsp;          // User %rsp while entering a syscall
+
+  // TLB state, for vspaceinstall()
+  pml4e_t *volatile pgtbl;   // page table in %cr3
+  uint64_t tlbid[NPCID];     // vspace whose entries PCID i+1 tags
+  uint64_t tlbgen[NPCID];    // its tlbgen when they were last flushed
+  uint pcidhand;             // next PCID to take for a new vspace
+  uint tlbcur;               // slot of the vspace in %cr3, if not kpml4
+  volatile uint64_t tlbreq;  // flushes other CPUs have asked of this one
+  volatile uint64_t tlbdone; // tlbreq as of this CPU's last flush
+
+  // Counters for sysinfo()
+  uint64_t nswitch;          // switches to a process
+  uint64_t idlecycles;       // rdtsc() cycles spent halted
+  uint64_t nsyscall[NSYSCALL]; // system calls, by number
 };
 
 extern struct cpu cpus[NCPU];
@@ -24,34 +45,25 @@ extern int ncpu;
 
 // Per-CPU variables, holding pointers to the
 // current cpu and to the current process.
-// The asm suffix tells gcc to use "%gs:0" to refer to cpu
-// and "%gs:4" to refer to proc.  seginit sets up the
-// %gs segment register so that %gs refers to the memory
-// holding those two variables in the local cpu's struct cpu.
-// This is similar to how thread-local variables are implemented
-// in thread libraries such as Linux pthreads.
-
-// static inline struct cpu *
-static struct cpu *mycpu(void) {
-  // uint64_t val;
-  // __asm volatile("movq %%gs:0, %0" : "=r" (val));
-  // if (val != 0xffffffff8019a780) {
-  //   while (1) {}
-  // }
-  // return (struct cpu *)val;
+// seginit sets the %gs base to &c->cpu in the local
+// cpu's struct cpu, so "%gs:0" refers to cpu and
+// "%gs:8" to proc.  The user has a %gs base of its own,
+// which every entry from user space swaps out with swapgs.  syscallentry in trapasm.S uses
+// "%gs:16" and "%gs:24" too.  This is similar to how thread-local
+// variables are implemented in thread libraries such
+// as Linux pthreads.
+static inline struct cpu *mycpu(void) {
+  struct cpu *c;
 
-  // struct cpu* c = &cpus[cpunum()];
-  // return c;
-
-  // single-core for now
-  return &cpus[0];
+  asm volatile("movq %%gs:0, %0" : "=r"(c));
+  return c;
 }
 
 static inline struct proc *myproc(void) {
-  // uint64_t val;
-  // __asm volatile("movq %%gs:8, %0" : "=r" (val));
-  // return (struct proc *)val;
-  return mycpu()->proc;
+  struct proc *p;
+
+  asm volatile("movq %%gs:8, %0" : "=r"(p));
+  return p;
 }
 
 // Saved registers for kernel context switches.
@@ -80,18 +92,42 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 // Per-process state
 struct proc {
   struct vspace vspace;        // Virtual address space descriptor
+  struct proc *group;          // Thread group leader, whose vspace and files
+                               // we use: the proc itself, or for a thread
+                               // made by clone(), the process it is part of
+  int nthreads;                // In a leader: procs in its group, itself too
+  struct uring *ring;          // In a leader: its ring_setup() ring, or 0
   char* kstack;                // Kernel stack
+  struct spinlock lock;        // Protects state, chan and the queue links
   enum procstate state;        // Process state
+  struct proc *rqnext;         // Next on its run queue
+  int rq;                      // Run queue (CPU) it last ran on
+  int prio;                    // Scheduler level, 0 is the highest
+  int nice;                    // Levels pushed down by, on a 0..NICE_MAX scale
+  int sliceused;               // Ticks run since its slice started
+  uint epoch;                  // Priority boost it was last raised by
+  uint cputicks;               // Timer ticks it has run for
+  uint64_t nsyscall;           // System calls made
+  uint64_t syscycles;          // rdtsc() cycles in those timed
+  struct proc *sqnext;         // Next on its sleep queue
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // First of its children
+  struct proc *sibling;        // Next child of its parent
+  struct proc *pidnext;        // Next in its pid hash chain
   struct trap_frame *tf;       // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
   char name[16];               // Process name (debugging)
+  void (*kfn)(void *);         // A kernel thread's function, 0 for a user process
+  void *karg;                  // and its argument
   struct desc file_array[NOFILE]; // File array storing file descriptors 
 };
 
+// p is a thread made by clone() or kthread_clone()
+#define ISTHREAD(p) ((p)->group != (p))
+
 // Process memory is laid out contiguously, low addresses first:
 //   text
 //   original data and bss
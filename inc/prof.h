@@ -0,0 +1,18 @@
+#pragma once
+
+// profile() commands
+#define PROF_ON 0   // n: timer interrupts, so samples, per tick
+#define PROF_OFF 1
+#define PROF_READ 2 // drain up to n samples into buf
+
+#define PROFMAXRATE 100 // most samples per tick
+#define PROFDEPTH 4     // return addresses kept in a kernel sample
+
+struct profsample {
+  uint64_t rip;              // where the timer interrupted
+  uint64_t pcs[PROFDEPTH];   // callers, by frame pointer, if in the kernel
+  ushort cpu;
+  ushort user;               // interrupted in user mode?
+  int pid;                   // process running, 0 if none
+  char name[16];             // its name
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <syscall.h>
+
+// syscallstat() commands
+#define SCS_GET 0   // fill a struct scstat
+#define SCS_PROCS 1 // fill up to n struct scprocs, one per process
+#define SCS_RESET 2 // zero the histograms
+#define SCS_ON 3    // time system calls (the default)
+#define SCS_OFF 4   // stop timing them
+
+#define NLATBUCKET 32 // bucket i counts calls taking [2^i, 2^(i+1)) cycles
+
+// System call latencies, in rdtsc() cycles, from entering the handler
+// to its return, time spent blocked included
+struct scstat {
+  int on;                          // being timed?
+  uint64_t calls[NSYSCALL];        // calls timed, by number
+  uint64_t cycles[NSYSCALL];       // their total time
+  uint64_t max[NSYSCALL];          // the slowest
+  uint hist[NSYSCALL][NLATBUCKET]; // log2 histogram of their times
+};
+
+// A process's system calls
+struct scproc {
+  int pid;
+  char name[16];
+  uint64_t calls;  // system calls made
+  uint64_t cycles; // time in the ones that were timed
+};
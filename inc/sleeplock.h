@@ -9,4 +9,26 @@ struct sleeplock {
   // For debugging:
   char *name; // Name of lock.
   int pid;    // Process holding lock
+#if LOCKSTAT
+  struct lockclass *stat;
+  uint64_t tsc;
+#endif
+};
+
+// Long-term reader-writer locks.  Any number of readers may hold
+// the lock at once; a writer holds it alone.  Waiting writers keep
+// new readers out so that a steady stream of readers can't starve them.
+struct rwsleeplock {
+  uint writer;        // Is the lock held exclusively?
+  int readers;        // Number of shared holders
+  int wwait;          // Number of writers waiting
+  struct spinlock lk; // spinlock protecting this lock
+
+  // For debugging:
+  char *name; // Name of lock.
+  int pid;    // Process holding lock exclusively
+#if LOCKSTAT
+  struct lockclass *stat;
+  uint64_t tsc; // when the writer acquired it
+#endif
 };
@@ -1,12 +1,21 @@
 #pragma once
 
-// Mutual exclusion lock.
+// Mutual exclusion lock.  A ticket lock: each acquire() takes the
+// next ticket and spins until owner reaches it, so CPUs get the lock
+// in the order they asked for it.
 struct spinlock {
-  uint locked; // Is the lock held?
+  uint next;  // next ticket to hand out
+  uint owner; // ticket now holding the lock
 
   // For debugging:
   char *name;       // Name of lock.
   struct cpu *cpu;  // The cpu holding the lock.
+#if LOCKSTAT
+  struct lockclass *stat; // contention counters, shared by name
+  uint64_t tsc;           // rdtsc() when it was acquired
+#endif
+#if LOCK_DEBUG
   uint64_t pcs[10]; // The call stack (an array of program counters)
                     // that locked the lock.
+#endif
 };
@@ -1,4 +1,5 @@
-// System call numbers
+// System call numbers, all below NSYSCALL
+#define NSYSCALL 64
 #define SYS_fork 1
 #define SYS_exit 2
 #define SYS_wait 3
@@ -22,3 +23,37 @@
 #define SYS_close 21
 #define SYS_sysinfo 22
 #define SYS_crashn 23
+#define SYS_mmap 24
+#define SYS_munmap 25
+#define SYS_nice 26
+#define SYS_spawn 27
+#define SYS_pread 28
+#define SYS_pwrite 29
+#define SYS_readv 30
+#define SYS_writev 31
+#define SYS_sendfile 32
+#define SYS_splice 33
+#define SYS_poll 34
+#define SYS_fsync 35
+#define SYS_fdatasync 36
+#define SYS_lockstat 37
+#define SYS_syscallstat 38
+#define SYS_trace 39
+#define SYS_profile 40
+#define SYS_cycles 41
+#define SYS_clock_gettime 42
+#define SYS_consmode 43
+#define SYS_clone 44
+#define SYS_join 45
+#define SYS_futex_wait 46
+#define SYS_futex_wake 47
+#define SYS_shmget 48
+#define SYS_shmat 49
+#define SYS_shmdt 50
+#define SYS_ring_setup 51
+#define SYS_ring_enter 52
+#define SYS_getdents 53
+#define SYS_fstatat 54
+#define SYS_clone_file 55
+#define SYS_fpunch 56
+#define SYS_defrag 57
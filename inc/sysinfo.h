@@ -1,9 +1,50 @@
 #pragma once
 
+#include <param.h>
+#include <syscall.h>
+
+// Fields are only ever added at the end, and version goes up when
+// they are, so a program can tell which of them the kernel filled in.
+#define SYSINFO_VERSION 2
+
 struct sys_info {
+  int version;       // SYSINFO_VERSION of the kernel
+  int size;          // sizeof(struct sys_info) of the kernel
   int pages_in_use;
   int pages_in_swap;
   int free_pages;
   int num_page_faults;
-  int num_disk_reads;
+  int cow_reuses;    // COW faults that made a sole owner's page writable
+  int cow_copies;    // COW faults that copied a shared page
+  int swap_outs;     // pages written to swap
+  int swap_ins;      // pages read back from swap
+  int clock_scans;   // pages the replacement CLOCK looked at
+  int clock_referenced; // of those, spared for being recently used
+  int num_disk_reads; // blocks read from the disk
+  int bcache_size;   // buffers currently in the buffer cache
+  int bcache_hits;   // bget() lookups found in the cache
+  int bcache_misses; // bget() lookups that recycled a buffer
+  int icache_size;   // inodes in the inode cache
+  int icache_hits;   // iget() lookups found in the cache
+  int icache_misses; // iget() lookups that recycled an inode
+  int dcache_hits;   // directory lookups answered by the name cache
+  int dcache_misses; // directory lookups that scanned the directory
+  int pcache_size;   // file pages in the page cache
+  int pcache_hits;   // file pages found in the page cache
+  int pcache_misses; // file pages read from the file
+  int free_blocks[MAXORDER + 1]; // free 2^i-page buddy blocks, by order i
+
+  // Version 2
+  uint64_t disk_reads;      // blocks read from the disk
+  uint64_t disk_writes;     // blocks written to the disk
+  uint64_t disk_requests;   // disk commands, each for a run of blocks
+  uint64_t log_commits;     // log transactions committed
+  uint64_t log_blocks;      // blocks those commits wrote to the log
+  uint64_t log_checkpoints; // times the log was installed and emptied
+  uint64_t ctxswitches;     // switches to a process, all CPUs
+  uint64_t ticks;           // timer ticks since boot
+  uint64_t tsc;             // rdtsc() on the CPU that answered
+  int ncpu;
+  uint64_t cpu_idle[NCPU];  // rdtsc() cycles each CPU spent halted
+  uint64_t syscalls[NSYSCALL]; // system calls made, by number
 };
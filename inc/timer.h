@@ -0,0 +1,11 @@
+#pragma once
+
+// A kernel timer: calls fn(arg) from the timer interrupt once ticks
+// reaches expires.  See timer.c.
+struct timer {
+  uint expires;          // value of ticks at which it fires
+  void (*fn)(void *);
+  void *arg;
+  struct timer *next;    // others in its wheel slot
+  struct timer **pprev;  // link pointing at it, or 0 if not pending
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+// trace() commands
+#define TRACE_ON 0
+#define TRACE_OFF 1
+#define TRACE_READ 2 // drain up to n records into buf
+
+// Events, and what a and b hold
+enum {
+  TR_SWITCH = 1, // switched to the process
+  TR_SLEEP,      // a: channel
+  TR_WAKEUP,     // a: channel, b: pid woken
+  TR_DISKSUBMIT, // a: block, b: 1 for a write
+  TR_DISKDONE,   // a: block, b: 1 for a write
+  TR_COMMIT,     // log commit; a: blocks, b: cycles taken
+  TR_BMISS,      // buffer cache miss; a: block
+  TR_PGFAULT,    // a: address, b: error code
+  TR_LOST,       // a: records overwritten before they were read
+};
+
+struct tracerec {
+  uint64_t tsc;  // rdtsc() when it happened
+  ushort type;
+  ushort cpu;
+  int pid;       // process running, 0 if none
+  uint64_t a;
+  uint64_t b;
+};
+
+// A tracepoint: records an event while tracing is on, and otherwise
+// costs a load and a branch.
+#define TRACE(type, a, b)                                                      \
+  do {                                                                         \
+    if (tracing)                                                               \
+      traceevent((type), (uint64_t)(a), (uint64_t)(b));                        \
+  } while (0)
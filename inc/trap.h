@@ -34,6 +34,8 @@
 #define IRQ_COM1 4
 #define IRQ_IDE 14
 #define IRQ_ERROR 19
+#define IRQ_WAKE 20 // IPI waking an idle CPU
+#define IRQ_TLB 21  // IPI asking a CPU to flush its TLB
 #define IRQ_SPURIOUS 31
 
 #ifndef __ASSEMBLER__
@@ -0,0 +1,9 @@
+#pragma once
+
+#define IOV_MAX 16 // most buffers one readv() or writev() takes
+
+// One buffer of a readv() or writev()
+struct iovec {
+  void *iov_base;
+  uint64_t iov_len;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+// A ring of system calls for the kernel to do without a trap each.
+// ring_setup() maps one into the process; its ring thread does the
+// calls queued on sq, in order, and posts their results on cq.  One
+// ring_enter() hands over a whole batch.  Each side owns the indices
+// it advances, which only count up; an index's slot is the index
+// modulo RINGN.
+
+#define RINGN 32 // entries in each queue
+
+// The system calls a ring does
+#define RINGOK(op)                                                        \
+  ((op) == SYS_read || (op) == SYS_write || (op) == SYS_pread ||         \
+   (op) == SYS_pwrite || (op) == SYS_open || (op) == SYS_close ||        \
+   (op) == SYS_fsync || (op) == SYS_pipe)
+
+// A queued call: op(args[0], args[1], ...)
+struct ringsqe {
+  int op;          // SYS_ number
+  int pad;
+  uint64_t args[4];
+  uint64_t data;   // copied to the completion as is
+};
+
+// A finished call
+struct ringcqe {
+  uint64_t data;   // data of its ringsqe
+  int res;         // what the call returned
+  int pad;
+};
+
+struct ring {
+  uint sqhead; // next entry the kernel takes, advanced by the kernel
+  uint sqtail; // next entry to fill, advanced by the process
+  uint cqhead; // next completion to take, advanced by the process
+  uint cqtail; // next completion to post, advanced by the kernel
+  struct ringsqe sq[RINGN];
+  struct ringcqe cq[RINGN];
+};
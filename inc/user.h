@@ -1,8 +1,28 @@
 #pragma once
 
 struct stat;
+struct dirent;
 struct rtcdate;
 struct sys_info;
+struct iovec;
+struct pollfd;
+struct lockstat;
+struct tracerec;
+struct profsample;
+struct timespec;
+struct ring;
+struct ringcqe;
+
+// Locks for threads, or processes sharing memory, that cost no
+// system call unless contended.  Zero is unlocked.
+struct mutex {
+  int state; // 0 free, 1 held, 2 held and maybe waited for
+};
+
+struct cond {
+  int seq;     // bumped by each signal
+  int waiters; // in cond_wait(), so signals with none are free
+};
 
 // system calls
 int fork(void);
@@ -28,6 +48,39 @@ int sleep(int);
 int uptime(void);
 int sysinfo(struct sys_info *);
 int crashn(int);
+void *mmap(int, int, int, int);
+int munmap(void *, int);
+int nice(int);
+int spawn(char *, char **, int *);
+int pread(int, void *, int, int);
+int pwrite(int, void *, int, int);
+int readv(int, struct iovec *, int);
+int writev(int, struct iovec *, int);
+int sendfile(int, int, int, int);
+int splice(int, int, int);
+int poll(struct pollfd *, int, int);
+int fsync(int);
+int fdatasync(int);
+int lockstat(struct lockstat *, int, int);
+int syscallstat(int, void *, int);
+int trace(int, struct tracerec *, int);
+int profile(int, struct profsample *, int);
+int cycles(uint64_t *);
+int consmode(int);
+int clone(void (*)(void *), void *, void *);
+int join(void);
+int futex_wait(int *, int);
+int futex_wake(int *, int);
+int shmget(int, int);
+void *shmat(int);
+int shmdt(void *);
+struct ring *ring_setup(void);
+int ring_enter(int);
+int getdents(int, struct dirent *, int);
+int fstatat(int, char *, struct stat *);
+int clone_file(int, int);
+int fpunch(int, int, int);
+int defrag(int);
 
 // ulib.c
 int stat(char *, struct stat *);
@@ -41,4 +94,24 @@ uint strlen(char *);
 void *memset(void *, int, uint);
 void *malloc(uint);
 void free(void *);
+void mallocstats(int);
 int atoi(const char *);
+int clock_gettime(int, struct timespec *);
+void mutex_lock(struct mutex *);
+void mutex_unlock(struct mutex *);
+void cond_wait(struct cond *, struct mutex *);
+void cond_signal(struct cond *);
+void cond_broadcast(struct cond *);
+int ring_push(struct ring *, int, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+int ring_pop(struct ring *, struct ringcqe *);
+
+// bench.c
+uint64_t now(void);
+void benchreport(char *, uint64_t *, int);
+
+// stdio.c
+void bputc(int, char);
+int bwrite(int, char *, int);
+int bflush(int);
+void bflushtty(int);
+void bflushall(void);
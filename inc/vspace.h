@@ -2,15 +2,30 @@
 
 #include <defs.h>
 #include <mmu.h>
+#include <sleeplock.h>
 
-#define NREGIONS 3
+#define NMMAP 4 // mmap() regions per vspace
+#define NSHM 2  // shared memory regions per vspace
+#define NREGIONS (3 + NMMAP + NSHM)
 
 enum {
   VR_CODE   = 0,
   VR_HEAP   = 1,
   VR_USTACK = 2,
+  VR_MMAP   = 3,            // through VR_MMAP + NMMAP - 1
+  VR_SHM    = 3 + NMMAP,    // through VR_SHM + NSHM - 1
 };
 
+// mmap() and shared memory regions go above here; the heap stays below
+#define MMAPBASE SZ_1G
+
+// User addresses are below here
+#define USERTOP SZ_4G
+
+// A 2 MB page: HUGEPAGES 4 KB pages, a kalloc_order(HUGEORDER) block
+#define HUGEORDER (PD_SHIFT - PT_SHIFT)
+#define HUGEPAGES (1 << HUGEORDER)
+
 #define VPI_PRESENT  ((short) 1)
 #define VPI_WRITABLE ((short) 1)
 #define VPI_COW ((short) 1)
@@ -25,7 +40,8 @@ struct vpage_info {
   short original_perm;
 };
 
-#define VPIPPAGE ((PGSIZE/sizeof(struct vpage_info)) - 1)
+#define VPIPPAGE (PGSIZE/sizeof(struct vpage_info))
+#define VPIDIRN (PGSIZE/sizeof(void *))
 #define VRTOP(r) \
   ((r)->dir == VRDIR_UP ? (r)->va_base + (r)->size : (r)->va_base)
 #define VRBOT(r) \
@@ -33,7 +49,13 @@ struct vpage_info {
 
 struct vpi_page {
   struct vpage_info infos[VPIPPAGE];  // info struct for the given page
-  struct vpi_page *next;              // the next page
+};
+
+// A region's vpi_pages hang off a two-level radix tree: the region's
+// directory points to directories of vpi_pages, indexed by the page's
+// position in the region.
+struct vpi_dir {
+  void *slot[VPIDIRN];
 };
 
 enum vr_direction {
@@ -45,11 +67,59 @@ struct vregion {
   enum vr_direction dir;  // direction of growth
   uint64_t va_base;       // base of the region
   uint64_t size;          // size of region in bytes
-  struct vpi_page *pages;  // pointer to array of page_infos
+  struct vpi_dir *pages;  // radix tree of page_infos
+  uint64_t nlazy;         // pages reserved by sbrk() but not yet allocated
+  struct inode *ip;       // file an mmap() region maps, 0 if none
+  uint64_t off;           // offset in the file of va_base
+  int prot;               // PROT_ bits of an mmap() region
+  struct shmseg *shm;     // segment a shared memory region maps, 0 if none
+};
+
+#define SHMMAXPAGES (PGSIZE / sizeof(char *))
+
+// A shared memory segment from shmget().  Its pages are allocated
+// up front and mapped writable into every vspace attached to it,
+// never copy-on-write.  The segment holds a reference on each page,
+// which keeps the swapper from taking them.  It is freed when the
+// last vspace attached to it lets go.
+struct shmseg {
+  int key;          // shmget() key, 0 if private
+  int nattach;      // vspaces it is mapped into
+  uint64_t npages;  // 0 if the entry is free
+  char **pages;     // a page of their kernel addresses
+};
+
+#define NVSEG 4 // program segments a vspace loads on demand
+
+// A loadable segment of the program a vspace runs.  Its pages are
+// read from the program's file, regions[VR_CODE].ip, as they are
+// first touched.
+struct vseg {
+  uint64_t va;     // first address, page aligned
+  uint64_t memsz;  // bytes of memory it takes
+  uint64_t filesz; // of those, bytes that come from the file
+  uint64_t off;    // offset in the file of va
+  short writable;
 };
 
 struct vspace {
   struct vregion regions[NREGIONS]; // the regions for a process' virtual space
   pml4e_t* pgtbl;                   // process' page table
+  int pinned;                       // keep the swapper out while nonzero
+  struct vseg segs[NVSEG];          // what the code region is loaded from
+  int nseg;
+  uint64_t tlbid;                   // unique, names vs in CPUs' TLB state
+  uint64_t tlbgen;                  // bumped by each mapping taken away
+  struct sleeplock lock;            // held by a thread changing the regions
+};
+
+// One mapping of a user page by a vspace.  Each page in use by user
+// space lists its mappings on its core_map_entry, so the swapper can
+// find every vspace sharing a page.
+struct rmap {
+  struct vspace *vs;
+  struct vpage_info *vpi;
+  uint64_t va;
+  struct rmap *next;
 };
 
@@ -11,6 +11,20 @@ static inline uchar inb(ushort port) {
   return data;
 }
 
+static inline ushort inw(ushort port) {
+  ushort data;
+
+  asm volatile("in %1,%0" : "=a"(data) : "d"(port));
+  return data;
+}
+
+static inline uint inl(ushort port) {
+  uint data;
+
+  asm volatile("in %1,%0" : "=a"(data) : "d"(port));
+  return data;
+}
+
 static inline void insl(int port, void *addr, int cnt) {
   asm volatile("cld; rep insl"
                : "=D"(addr), "=c"(cnt)
@@ -26,6 +40,10 @@ static inline void outw(ushort port, ushort data) {
   asm volatile("out %0,%1" : : "a"(data), "d"(port));
 }
 
+static inline void outl(ushort port, uint data) {
+  asm volatile("out %0,%1" : : "a"(data), "d"(port));
+}
+
 static inline void outsl(int port, const void *addr, int cnt) {
   asm volatile("cld; rep outsl"
                : "=S"(addr), "=c"(cnt)
@@ -47,6 +65,27 @@ static inline void stosl(void *addr, int data, int cnt) {
                : "memory", "cc");
 }
 
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+  asm volatile("cld; rep stosq"
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+  asm volatile("cld; rep movsb"
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+  asm volatile("cld; rep movsq"
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+
 struct segdesc;
 
 static inline void lgdt(struct segdesc *p, int size) {
@@ -102,6 +141,34 @@ static inline uint xchg(volatile uint *addr, uint newval) {
   return result;
 }
 
+// Add v to *addr, returning what *addr held before.
+static inline uint xadd(volatile uint *addr, uint v) {
+  asm volatile("lock; xaddl %0, %1" : "+r"(v), "+m"(*addr) : : "memory", "cc");
+  return v;
+}
+
+// Set *addr to newval if it holds old.  Returns whether it did.
+static inline int cmpxchg(volatile uint *addr, uint old, uint newval) {
+  uchar ok;
+
+  asm volatile("lock; cmpxchgl %3, %1; sete %0"
+               : "=q"(ok), "+m"(*addr), "+a"(old)
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+// Spin-wait hint: lets a sibling hyperthread run and avoids the
+// memory-order flush on leaving the loop.
+static inline void pause(void) { asm volatile("pause"); }
+
 static inline uint64_t rcr2(void) {
   uint64_t val;
   asm volatile("mov %%cr2,%0" : "=r"(val));
@@ -112,6 +179,20 @@ static inline void lcr3(uint64_t val) {
   asm volatile("mov %0,%%cr3" : : "r"(val));
 }
 
+static inline uint64_t rcr4(void) {
+  uint64_t val;
+  asm volatile("mov %%cr4,%0" : "=r"(val));
+  return val;
+}
+
+static inline void lcr4(uint64_t val) {
+  asm volatile("mov %0,%%cr4" : : "r"(val));
+}
+
+static inline void invlpg(void *addr) {
+  asm volatile("invlpg (%0)" : : "r"(addr) : "memory");
+}
+
 static inline uint64_t rdmsr(uint32_t msr) {
   uint32_t lo, hi;
 
@@ -1,7 +1,8 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
-// cached copies of disk block contents.  Caching disk blocks
+// The buffer cache is a hash table of buf structures holding
+// cached copies of disk block contents, keyed on (dev, blockno),
+// plus an LRU list used to pick buffers to recycle.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
@@ -21,41 +22,194 @@
 #include <cdefs.h>
 #include <defs.h>
 #include <fs.h>
+#include <mmu.h>
 #include <param.h>
 #include <sleeplock.h>
 #include <spinlock.h>
+#include <trace.h>
 
 #include <buf.h>
 
 int crashn_enable = 0;
 int crashn = 0;
 
-int num_disk_reads = 0;
+int bcache_nbuf = 0;
+int bcache_hits = 0;
+int bcache_misses = 0;
+
+// Hash chains are keyed on (dev, blockno).  The chain heads are
+// sized for the largest cache we allow, while the locks are sharded
+// over a smaller set; bucket h is protected by lock h % NBUCKETLOCK.
+#define NBUCKET 1021
+#define NBUCKETLOCK 31
+
+// Buffers are carved out of whole kalloc_order(BUFORDER) blocks, the
+// "pages" below.  They are 8 real pages once file system blocks are
+// big enough that one page would hold one buffer or none.
+#define BUFORDER (BSIZE <= 1024 ? 0 : 3)
+#define BUFPAGE (PGSIZE << BUFORDER)
+#define BUFPERPAGE (BUFPAGE / sizeof(struct buf))
 
 struct {
+  // Protects the LRU list and serializes buffer recycling, growth
+  // and shrinking.
+  // Lock order: bcache.lock before any bucket lock.
   struct spinlock lock;
-  struct buf buf[NBUF];
+  int maxbuf; // never grow beyond this many buffers
 
   // Linked list of all buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
+
+  // Hash table of cached blocks, chained through hnext.
+  // Each bucket lock protects the chains hashing to it and the
+  // refcnt of every buffer on them.
+  struct spinlock bucketlock[NBUCKETLOCK];
+  struct buf *bucket[NBUCKET];
 } bcache;
 
-void binit(void) {
+static uint bhash(uint dev, uint blockno) {
+  return (dev * 1000003 + blockno) % NBUCKET;
+}
+
+static struct spinlock *bucketlock(uint h) {
+  return &bcache.bucketlock[h % NBUCKETLOCK];
+}
+
+// Look for (dev, blockno) on bucket h and take a reference.
+// Caller must hold bucketlock(h).
+static struct buf *bucketfind(uint h, uint dev, uint blockno) {
   struct buf *b;
 
+  for (b = bcache.bucket[h]; b; b = b->hnext) {
+    if (b->dev == dev && b->blockno == blockno) {
+      b->refcnt++;
+      return b;
+    }
+  }
+  return 0;
+}
+
+// Unlink b from bucket h.  Caller must hold bucketlock(h).
+static void bucketremove(uint h, struct buf *b) {
+  struct buf **pp;
+
+  for (pp = &bcache.bucket[h]; *pp; pp = &(*pp)->hnext) {
+    if (*pp == b) {
+      *pp = b->hnext;
+      b->hnext = 0;
+      b->hashed = 0;
+      return;
+    }
+  }
+  panic("bucketremove");
+}
+
+// Take b off its hash chain if nobody is using it and it holds no
+// uncommitted data.  Returns 1 if b is now free for reuse.
+// Caller must hold bcache.lock.
+static int bunhash(struct buf *b) {
+  uint h;
+
+  if (!b->hashed)
+    return b->refcnt == 0;
+
+  h = bhash(b->dev, b->blockno);
+  acquire(bucketlock(h));
+  if (b->refcnt != 0 || (b->flags & B_DIRTY) != 0) {
+    release(bucketlock(h));
+    return 0;
+  }
+  bucketremove(h, b);
+  release(bucketlock(h));
+  return 1;
+}
+
+// Add a page worth of fresh buffers at the LRU end of the list.
+// Caller must hold bcache.lock.
+static void baddpage(char *page) {
+  struct buf *b;
+  int i;
+
+  for (i = 0; i < BUFPERPAGE; i++) {
+    b = (struct buf *)page + i;
+    memset(b, 0, sizeof(*b));
+    b->data = b->mem;
+    initsleeplock(&b->lock, "buffer");
+    b->prev = bcache.head.prev;
+    b->next = &bcache.head;
+    bcache.head.prev->next = b;
+    bcache.head.prev = b;
+  }
+  bcache_nbuf += BUFPERPAGE;
+}
+
+// Size the cache as a fraction of free memory: at least NBUF buffers,
+// and allowed to grow on demand up to a larger fraction.
+void binit(void) {
+  char *page;
+  int i, npage;
+
   initlock(&bcache.lock, "bcache");
+  for (i = 0; i < NBUCKETLOCK; i++)
+    initlock(&bcache.bucketlock[i], "bcache.bucket");
+  for (i = 0; i < NBUCKET; i++)
+    bcache.bucket[i] = 0;
 
-  // Create linked list of buffers
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for (b = bcache.buf; b < bcache.buf + NBUF; b++) {
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+
+  npage = max((free_pages >> BUFORDER) / BCACHE_DIV, (int)((NBUF + BUFPERPAGE - 1) / BUFPERPAGE));
+  bcache.maxbuf = max((free_pages >> BUFORDER) / BCACHE_MAXDIV * (int)BUFPERPAGE, NBUF);
+
+  for (i = 0; i < npage; i++) {
+    if ((page = kalloc_order(BUFORDER)) == 0)
+      break;
+    acquire(&bcache.lock);
+    baddpage(page);
+    release(&bcache.lock);
+  }
+
+  if (bcache_nbuf < NBUF)
+    panic("binit: no memory for buffers");
+  cprintf("bcache: %d buffers (max %d)\n", bcache_nbuf, bcache.maxbuf);
+}
+
+// Give back one page of buffers to the page allocator, choosing
+// the least recently used page whose buffers are all idle and clean.
+// Called by kalloc() when it runs out of memory.
+// Returns the number of pages freed.
+int bshrink(void) {
+  struct buf *b, *pb;
+  char *page;
+  int i;
+
+  acquire(&bcache.lock);
+  if (bcache_nbuf - (int)BUFPERPAGE < NBUF) {
+    release(&bcache.lock);
+    return 0;
+  }
+  for (b = bcache.head.prev; b != &bcache.head; b = b->prev) {
+    page = (char *)((uint64_t)b & ~(uint64_t)(BUFPAGE - 1));
+    for (i = 0; i < BUFPERPAGE; i++) {
+      if (!bunhash((struct buf *)page + i))
+        break;
+    }
+    if (i < BUFPERPAGE)
+      continue; // buffers we did unhash just stay on the list, empty
+
+    for (i = 0; i < BUFPERPAGE; i++) {
+      pb = (struct buf *)page + i;
+      pb->next->prev = pb->prev;
+      pb->prev->next = pb->next;
+    }
+    bcache_nbuf -= BUFPERPAGE;
+    release(&bcache.lock);
+    kfree_order(page, BUFORDER);
+    return 1 << BUFORDER;
   }
+  release(&bcache.lock);
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
@@ -63,31 +217,78 @@ void binit(void) {
 // In either case, return locked buffer.
 static struct buf *bget(uint dev, uint blockno) {
   struct buf *b;
+  char *page;
+  uint h;
 
-  acquire(&bcache.lock);
+  h = bhash(dev, blockno);
 
-  // Is the block already cached?
-  for (b = bcache.head.next; b != &bcache.head; b = b->next) {
-    if (b->dev == dev && b->blockno == blockno) {
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  // Is the block already cached?  Only this bucket is locked, so
+  // lookups of blocks in other buckets proceed in parallel.
+  acquire(bucketlock(h));
+  if ((b = bucketfind(h, dev, blockno)) != 0) {
+    bcache_hits++;
+    release(bucketlock(h));
+    acquiresleep(&b->lock);
+    return b;
   }
+  release(bucketlock(h));
 
-  // Not cached; recycle some unused buffer and clean buffer
+retry:
+  // Not cached.  bcache.lock serializes recycling, so once we hold
+  // it nobody else can insert this block; check again in case
+  // someone did between the two critical sections.
+  acquire(&bcache.lock);
+  acquire(bucketlock(h));
+  if ((b = bucketfind(h, dev, blockno)) != 0) {
+    bcache_hits++;
+    release(bucketlock(h));
+    release(&bcache.lock);
+    acquiresleep(&b->lock);
+    return b;
+  }
+  release(bucketlock(h));
+
+  // Recycle the least recently used unused buffer and clean buffer
   // "clean" because B_DIRTY and not locked means log.c
   // hasn't yet committed the changes to the buffer.
   for (b = bcache.head.prev; b != &bcache.head; b = b->prev) {
-    if (b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
+    if (!bunhash(b))
+      continue;
+
+    b->dev = dev;
+    b->blockno = blockno;
+    b->refcnt = 1;
+    // A block the disk keeps in memory is used in place.
+    if ((b->data = idemap(dev, blockno)) != 0) {
+      b->flags = B_VALID;
+    } else {
+      b->data = b->mem;
       b->flags = 0;
-      b->refcnt = 1;
+    }
+    b->hashed = 1;
+
+    acquire(bucketlock(h));
+    b->hnext = bcache.bucket[h];
+    bcache.bucket[h] = b;
+    release(bucketlock(h));
+
+    bcache_misses++;
+    release(&bcache.lock);
+    TRACE(TR_BMISS, blockno, 0);
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Every buffer is pinned or dirty: grow the cache by a page
+  // and try again.  kalloc() may itself call bshrink(), so
+  // bcache.lock must not be held across it.
+  if (bcache_nbuf + BUFPERPAGE <= bcache.maxbuf) {
+    release(&bcache.lock);
+    if ((page = kalloc_order(BUFORDER)) != 0) {
+      acquire(&bcache.lock);
+      baddpage(page);
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      goto retry;
     }
   }
   panic("bget: no buffers");
@@ -95,18 +296,71 @@ static struct buf *bget(uint dev, uint blockno) {
 
 // Return a locked buf with the contents of the indicated block.
 struct buf *bread(uint dev, uint blockno) {
-  num_disk_reads += 1;
+  struct buf *b;
+
+  b = bread_async(dev, blockno);
+  bwait(b);
+  return b;
+}
+
+// Return a locked buf for the indicated block, with its read already
+// queued but possibly not finished.  Call bwait() before touching the
+// data.  Lets a caller start many reads before waiting on any of them.
+struct buf *bread_async(uint dev, uint blockno) {
   struct buf *b;
 
   b = bget(dev, blockno);
   if (!(b->flags & B_VALID)) {
-    iderw(b);
+    idesubmit(b);
   }
   return b;
 }
 
+// Wait for the I/O queued on locked buf b by bread_async() or
+// bwrite_async() to finish.
+void bwait(struct buf *b) {
+  if (!holdingsleep(&b->lock))
+    panic("bwait");
+  if (b->flags & B_QUEUED)
+    ideiowait(b);
+}
+
+// Return a locked buf for the indicated block without reading it, for
+// a caller that overwrites all of it and then writes it out.
+struct buf *bclaim(uint dev, uint blockno) {
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  b->flags |= B_VALID;
+  return b;
+}
+
+// Start reading the indicated block into the cache without waiting
+// for it.  The buffer stays locked until the disk interrupt fills it
+// in and releases it, so a later bread() of the block simply sleeps
+// until the data is there.
+void bprefetch(uint dev, uint blockno) {
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if (b->flags & B_VALID) {
+    brelse(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
 // Write b's contents to disk.  Must be locked.
 void bwrite(struct buf *b) {
+  bwrite_async(b);
+  bwait(b);
+}
+
+// Queue a write of b's contents to disk without waiting for it.
+// b must be locked, and stays locked; call bwait() before releasing
+// or reusing it.
+void bwrite_async(struct buf *b) {
   if (crashn_enable) {
     crashn--;
     if (crashn < 0)
@@ -115,42 +369,61 @@ void bwrite(struct buf *b) {
   if (!holdingsleep(&b->lock))
     panic("bwrite");
   b->flags |= B_DIRTY;
-  iderw(b);
+  idesubmit(b);
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
-void brelse(struct buf *b) {
+// Move to the head of the MRU list, or if cold to the end, to be
+// recycled first.
+static void brelease(struct buf *b, int cold) {
+  uint h;
+  int unused;
+
   if (!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  h = bhash(b->dev, b->blockno);
+  acquire(bucketlock(h));
   b->refcnt--;
-  if (b->refcnt == 0) {
+  unused = (b->refcnt == 0);
+  release(bucketlock(h));
+
+  if (unused) {
     // no one is waiting for it.
+    acquire(&bcache.lock);
     b->next->prev = b->prev;
     b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    if (cold) {
+      b->next = &bcache.head;
+      b->prev = bcache.head.prev;
+      bcache.head.prev->next = b;
+      bcache.head.prev = b;
+    } else {
+      b->next = bcache.head.next;
+      b->prev = &bcache.head;
+      bcache.head.next->prev = b;
+      bcache.head.next = b;
+    }
+    release(&bcache.lock);
   }
-
-  release(&bcache.lock);
 }
 
+void brelse(struct buf *b) { brelease(b, 0); }
+
+// Release b cold: for blocks of file data, which the page cache keeps.
+void brelse_cold(struct buf *b) { brelease(b, 1); }
+
 // Print the data at the given block.
 // Format: block_no, byte index, data
 // Note: Data stored in blocks on disk are in little endian.
 void print_data_at_block(uint block) {
   cprintf("Printing data at block=%d\n", block);
-  uint64_t data[BSIZE / 8];
   struct buf* b = bread(ROOTDEV, block);
-  memmove(data, b->data, BSIZE);
-  brelse(b);
+  uint64_t *data = (uint64_t *)b->data;
   for (int i = 0; i < BSIZE/8; ++i) {
     cprintf("block=0x%x index=%d: %lx\n", block, i, data[i]);
   }
+  brelse(b);
 }
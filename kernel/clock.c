@@ -0,0 +1,47 @@
+// The high-resolution clock.
+//
+// clockinit() times the TSC against PIT channel 2, which counts at a
+// known PIT_HZ, and fills in the clock page that every page table
+// maps read-only at CLOCKPAGE.  clock_gettime() in the kernel and in
+// the user library both turn a TSC reading into nanoseconds with it.
+// The TSC is assumed to be invariant and in step across CPUs, as it
+// is under QEMU and on CPUs made in the last decade.
+
+#include <cdefs.h>
+#include <clock.h>
+#include <defs.h>
+#include <x86_64.h>
+
+#define PIT_HZ 1193182
+#define PIT_CH2 0x42
+#define PIT_MODE 0x43
+#define PIT_GATE 0x61     // channel 2 gate (bit 0) and output (bit 5)
+#define CALIBRATE_MS 10
+
+struct clockpage *clockpage; // mapped at CLOCKPAGE; setupkvm() allocates it
+
+void clockinit(void) {
+  uint latch;
+  uint64_t t0, t1;
+
+  // Count down once, in mode 0, with the speaker off; the output goes
+  // high when the count reaches 0
+  latch = PIT_HZ * CALIBRATE_MS / 1000;
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  outb(PIT_MODE, 0xB0); // channel 2, low then high byte, mode 0
+  outb(PIT_CH2, latch & 0xFF);
+  outb(PIT_CH2, latch >> 8);
+  t0 = rdtsc();
+  while (!(inb(PIT_GATE) & 0x20))
+    ;
+  t1 = rdtsc();
+
+  clockpage->tschz = (t1 - t0) * 1000 / CALIBRATE_MS;
+  clockpage->tsc0 = t1;
+  clockpage->mult = (1000000000UL << CLOCKSHIFT) / clockpage->tschz;
+  cprintf("tsc: %d MHz\n", (int)(clockpage->tschz / 1000000));
+}
+
+uint64_t nsecs(void) {
+  return clockns(clockpage, rdtsc());
+}
@@ -9,6 +9,7 @@
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
+#include <poll.h>
 #include <proc.h>
 #include <sleeplock.h>
 #include <spinlock.h>
@@ -17,6 +18,7 @@
 #include <x86_64.h>
 
 static void consputc(int);
+static void consflush(void);
 
 static int panicked = 0;
 
@@ -25,6 +27,26 @@ static struct {
   int locking;
 } cons;
 
+// Output to the serial port waits in a ring that the UART drains from
+// its transmit interrupt, so writers return once their bytes are
+// copied in instead of waiting on the line, about a millisecond a byte
+// at 9600 baud.  consolewrite() sleeps while the ring is full.
+// cprintf() can be called from anywhere, so it only polls the UART for
+// room so many times before it drops what does not fit, and reports
+// that later; a panic waits for all of it to go out.  Guarded by
+// cons.lock.
+#define TXBUF 4096
+#define CPRINTFPOLLS 10000 // most polls for room per cprintf()
+
+static struct {
+  char buf[TXBUF];
+  uint r;       // next byte to send
+  uint w;       // next byte to fill in
+  int polls;    // left to this cprintf()
+  int waiting;  // a consolewrite() is sleeping for room
+  uint dropped; // bytes dropped since the last report
+} tx;
+
 static void printint64(int64_t xx, int base, int sign) {
   static char digits[] = "0123456789abcdef";
   char buf[32];
@@ -85,6 +107,7 @@ void cprintf(char *fmt, ...) {
 
   if (fmt == 0)
     panic("null fmt");
+  tx.polls = CPRINTFPOLLS;
 
   for (i = 0; (c = fmt[i] & 0xff) != 0; i++) {
     if (c != '%') {
@@ -133,6 +156,7 @@ void cprintf(char *fmt, ...) {
     }
   }
 
+  consflush();
   if (locking)
     release(&cons.lock);
 
@@ -151,6 +175,8 @@ void panic(char *s) {
   getcallerpcs(&s, pcs);
   for (i = 0; i < 10; i++)
     cprintf(" %p", pcs[i]);
+  while (tx.r != tx.w)
+    consflush();
   panicked = 1; // freeze other CPU
   for (;;)
     ;
@@ -159,15 +185,20 @@ void panic(char *s) {
 #define BACKSPACE 0x100
 #define CRTPORT 0x3d4
 static ushort *crt = (ushort *)P2V(0xb8000); // CGA memory
+static int cgapos = -1; // cursor position, col + 80*row, once read
 
 static void cgaputc(int c) {
   int pos;
 
-  // Cursor position: col + 80*row.
-  outb(CRTPORT, 14);
-  pos = inb(CRTPORT + 1) << 8;
-  outb(CRTPORT, 15);
-  pos |= inb(CRTPORT + 1);
+  // The cursor starts where the boot loader left it; after that
+  // cgacursor() moves it, once a write rather than once a character
+  if (cgapos < 0) {
+    outb(CRTPORT, 14);
+    cgapos = inb(CRTPORT + 1) << 8;
+    outb(CRTPORT, 15);
+    cgapos |= inb(CRTPORT + 1);
+  }
+  pos = cgapos;
 
   if (c == '\n')
     pos += 80 - pos % 80;
@@ -186,11 +217,82 @@ static void cgaputc(int c) {
     memset(crt + pos, 0, sizeof(crt[0]) * (24 * 80 - pos));
   }
 
+  cgapos = pos;
+  crt[pos] = ' ' | 0x0700;
+}
+
+static void cgacursor(void) {
+  if (cgapos < 0)
+    return;
   outb(CRTPORT, 14);
-  outb(CRTPORT + 1, pos >> 8);
+  outb(CRTPORT + 1, cgapos >> 8);
   outb(CRTPORT, 15);
-  outb(CRTPORT + 1, pos);
-  crt[pos] = ' ' | 0x0700;
+  outb(CRTPORT + 1, cgapos);
+}
+
+// Hand the UART what it has room for, and have it interrupt when it
+// has room for more.
+static void txstart(void) {
+  uint n, r0;
+
+  r0 = tx.r;
+  while (tx.r != tx.w) {
+    n = min(tx.w - tx.r, TXBUF - tx.r % TXBUF);
+    if ((n = uartwrite(&tx.buf[tx.r % TXBUF], n)) == 0)
+      break;
+    tx.r += n;
+  }
+  uarttxintr(tx.r != tx.w);
+  if (tx.waiting && tx.r != r0) {
+    tx.waiting = 0;
+    wakeup(&tx);
+  }
+}
+
+// Queue c for the serial port.
+static void txputc(int c) {
+  while (tx.w - tx.r == TXBUF) {
+    txstart();
+    if (tx.w - tx.r < TXBUF)
+      break;
+    // Drop rather than stall, unless panicking
+    if (cons.locking && tx.polls-- <= 0) {
+      tx.dropped++;
+      return;
+    }
+  }
+  tx.buf[tx.w++ % TXBUF] = c;
+}
+
+// Say how much output was dropped, once the ring has room again.
+static void txreport(void) {
+  uint n;
+  char *s;
+
+  if ((n = tx.dropped) == 0 || tx.w - tx.r > TXBUF / 2)
+    return;
+  tx.dropped = 0;
+  for (s = "\n[console: dropped "; *s; s++)
+    consputc(*s);
+  printint(n, 10, 0);
+  for (s = " bytes]\n"; *s; s++)
+    consputc(*s);
+}
+
+// Catch the screen's cursor and the serial port up with what was
+// written.
+static void consflush(void) {
+  cgacursor();
+  txstart();
+}
+
+// The UART has room to send more.
+void consolestart(void) {
+  acquire(&cons.lock);
+  txstart();
+  txreport();
+  consflush();
+  release(&cons.lock);
 }
 
 void consputc(int c) {
@@ -201,29 +303,45 @@ void consputc(int c) {
   }
 
   if (c == BACKSPACE) {
-    uartputc('\b');
-    uartputc(' ');
-    uartputc('\b');
+    txputc('\b');
+    txputc(' ');
+    txputc('\b');
   } else
-    uartputc(c);
+    txputc(c);
   cgaputc(c);
 }
 
-#define INPUT_BUF 128
+// Typed or piped-in input.  In the usual cooked mode it is echoed and
+// can be edited until a newline makes the line readable; in raw mode
+// each byte is readable as it comes, unechoed and unchanged.
+// consoleintr() takes all the bytes its device has before waking
+// readers, and consoleread() copies out all it can, so input that
+// arrives in bursts is not handled a byte at a time.
+#define INPUT_BUF 1024
 struct {
   char buf[INPUT_BUF];
   uint r; // Read index
   uint w; // Write index
   uint e; // Edit index
+  int raw; // in raw mode
+  struct pollent *pollers; // polls waiting for a line
 } input;
 
 #define C(x) ((x) - '@') // Control-x
 
 void consoleintr(int (*getc)(void)) {
   int c, doprocdump = 0;
+  uint w;
 
   acquire(&cons.lock);
+  w = input.w;
   while ((c = getc()) >= 0) {
+    if (input.raw) {
+      if (input.e - input.r < INPUT_BUF)
+        input.buf[input.e++ % INPUT_BUF] = c;
+      input.w = input.e;
+      continue;
+    }
     switch (c) {
     case C('P'): // Process listing.
       // procdump() locks cons.lock indirectly; invoke later
@@ -248,59 +366,128 @@ void consoleintr(int (*getc)(void)) {
         c = (c == '\r') ? '\n' : c;
         input.buf[input.e++ % INPUT_BUF] = c;
         consputc(c);
-        if (c == '\n' || c == C('D') || input.e == input.r + INPUT_BUF) {
+        if (c == '\n' || c == C('D') || input.e == input.r + INPUT_BUF)
           input.w = input.e;
-          wakeup(&input.r);
-        }
       }
       break;
     }
   }
+  if (input.w != w) {
+    wakeup(&input.r);
+    pollwake(input.pollers);
+  }
+  consflush();
   release(&cons.lock);
   if (doprocdump) {
     procdump(); // now call procdump() wo. cons.lock held
   }
 }
 
+// Read what is readable, up to n bytes: in cooked mode up to the end
+// of a line, in raw mode all of it.
 int consoleread(struct inode *ip, char *dst, int n) {
-  uint target;
-  int c;
+  uint target, m, i;
+  char *s;
 
   target = n;
   acquire(&cons.lock);
-  while (n > 0) {
-    while (input.r == input.w) {
-      if (myproc()->killed) {
-        release(&cons.lock);
-        return -1;
-      }
-      sleep(&input.r, &cons.lock);
+  while (input.r == input.w) {
+    if (myproc()->killed) {
+      release(&cons.lock);
+      return -1;
     }
-    c = input.buf[input.r++ % INPUT_BUF];
-    if (c == C('D')) { // EOF
-      if (n < target) {
-        // Save ^D for next time, to make sure
-        // caller gets a 0-byte result.
-        input.r--;
-      }
-      break;
+    sleep(&input.r, &cons.lock);
+  }
+  while (n > 0 && input.r != input.w) {
+    // as much as lies contiguous in the ring
+    s = &input.buf[input.r % INPUT_BUF];
+    m = min(min(input.w - input.r, INPUT_BUF - input.r % INPUT_BUF), (uint)n);
+    if (input.raw) {
+      memmove(dst, s, m);
+      input.r += m;
+      dst += m;
+      n -= m;
+      continue;
     }
-    *dst++ = c;
-    --n;
-    if (c == '\n')
+    for (i = 0; i < m && s[i] != '\n' && s[i] != C('D'); i++)
+      ;
+    memmove(dst, s, i);
+    input.r += i;
+    dst += i;
+    n -= i;
+    if (i == m)
+      continue;
+    if (s[i] == C('D')) {
+      // EOF.  Leave a ^D after what was read for next time, so the
+      // caller gets a 0-byte result.
+      if (n == target)
+        input.r++;
       break;
+    }
+    *dst++ = '\n';
+    input.r++;
+    n--;
+    break;
   }
   release(&cons.lock);
 
   return target - n;
 }
 
+// Set raw mode if raw, else cooked mode; returns the mode before.
+int consolemode(int raw) {
+  int old;
+
+  acquire(&cons.lock);
+  old = input.raw;
+  input.raw = raw != 0;
+  if (input.raw && input.w != input.e) {
+    // what was being typed is readable now
+    input.w = input.e;
+    wakeup(&input.r);
+    pollwake(input.pollers);
+  }
+  release(&cons.lock);
+  return old;
+}
+
+// What of POLLIN and POLLOUT won't block; output never does.  If
+// none of events is ready, put e on the queue for the next line.
+int consolepoll(struct inode *ip, int events, struct pollent *e,
+                struct pollset *ps) {
+  int ready;
+
+  acquire(&cons.lock);
+  ready = POLLOUT;
+  if (input.r != input.w)
+    ready |= POLLIN;
+  if (!(ready & events) && e)
+    pollqueue(&input.pollers, &cons.lock, e, ps);
+  release(&cons.lock);
+  return ready;
+}
+
 int consolewrite(struct inode *ip, char *buf, int n) {
   int i;
 
   acquire(&cons.lock);
-  for (i = 0; i < n; i++)
+  for (i = 0; i < n; i++) {
+    // Wait for room rather than drop anything
+    while (tx.w - tx.r == TXBUF) {
+      txstart();
+      if (tx.w - tx.r < TXBUF)
+        break;
+      if (myproc()->killed) {
+        consflush();
+        release(&cons.lock);
+        return i;
+      }
+      tx.waiting = 1;
+      sleep(&tx, &cons.lock);
+    }
     consputc(buf[i] & 0xff);
+  }
+  consflush();
   release(&cons.lock);
 
   return n;
@@ -311,6 +498,7 @@ void consoleinit(void) {
 
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
+  devsw[CONSOLE].poll = consolepoll;
 
   cons.locking = 1;
 
@@ -67,6 +67,12 @@ static const char *names[CPUID_BIT(CPUID_NR_FLAGS, 0)] = {
     [CPUID_FEATURE_F16C] = "f16c",
     [CPUID_FEATURE_RDRAND] = "rdrand",
     [CPUID_FEATURE_HYPERVISOR] = "hypervisor",
+    // CPUID(7, 0): EBX
+    [CPUID_FEATURE_FSGSBASE] = "fsgsbase",
+    [CPUID_FEATURE_SMEP] = "smep",
+    [CPUID_FEATURE_ERMS] = "erms",
+    [CPUID_FEATURE_INVPCID] = "invpcid",
+    [CPUID_FEATURE_SMAP] = "smap",
 
     // CPUID(0x80000001): EDX
     [CPUID_FEATURE_SYSCALL] = "syscall",
@@ -139,10 +145,20 @@ void cpuid_print(void) {
   cprintf("CPU: %s\n", brand);
 
   cpuid(1, NULL, NULL, &feature[CPUID_1_ECX], &feature[CPUID_1_EDX]);
+  cpuid(0, &eax, NULL, NULL, NULL);
+  if (eax >= 7) // leaf 7 takes a subleaf in %ecx, so not cpuid()
+    asm volatile("cpuid"
+                 : "=b"(feature[CPUID_7_EBX]), "=a"(eax)
+                 : "a"(7), "c"(0)
+                 : "edx");
   cpuid(0x80000001, NULL, NULL, &feature[CPUID_80000001_ECX],
         &feature[CPUID_80000001_EDX]);
   print_feature(feature);
   // Check feature bits.
   assert(cpuid_has(feature, CPUID_FEATURE_PSE));
   assert(cpuid_has(feature, CPUID_FEATURE_APIC));
+
+  erms = cpuid_has(feature, CPUID_FEATURE_ERMS);
+  havepge = cpuid_has(feature, CPUID_FEATURE_PGE);
+  havepcid = cpuid_has(feature, CPUID_FEATURE_PCID);
 }
@@ -8,7 +8,102 @@
 #include <trap.h>
 #include <x86_64.h>
 
+// Build in vs the image of the program at path, run with the
+// null-terminated argument strings argv, which the caller has
+// checked, and set tf's registers to start it.  Only the program's
+// headers are read here; its pages are read in by trap() as they are
+// touched.  Returns 0 on success, or -1 on error with vs freed and tf
+// untouched.
+int execload(struct vspace *vs, char *path, char **argv,
+             struct trap_frame *tf) {
+  int argc = 0;
+  while (argv[argc] != NULL)
+    argc++;
+
+  // Create new vspace
+  uint64_t stack = SZ_2G;
+  if (vspaceinit(vs) < 0)
+  {
+    cprintf("exec error: vspaceinit failed.\n");
+    return -1;
+  }
+  // The new image is written through the kernel's mapping of its
+  // pages; keep the swapper off them until it is installed
+  vs->pinned = 1;
+  uint64_t rip;
+  if (vspaceloadcode(vs, path, &rip) <= 0)
+  {
+    cprintf("exec error: vspaceloadcode failed.\n");
+    vspacefree(vs);
+    return -1;
+  }
+
+  if (vspaceinitstack(vs, stack) < 0)
+  {
+    cprintf("exec error: vspaceinitstack failed.\n");
+    vspacefree(vs);
+    return -1;
+  }
+
+  uint64_t pointers_array[argc]; // Stores the pointers to the strings
+
+  for (int i = argc - 1; i >= 0; i--)
+  {
+    vspacewritetova(vs, stack - 8 * (strlen(argv[i]) / 8 + 1), argv[i], strlen(argv[i]));
+    pointers_array[i] = stack - 8 * (strlen(argv[i]) / 8 + 1);
+    stack -= 8 * (strlen(argv[i]) / 8 + 1);
+  }
+
+  char nullptr = '\0';
+  vspacewritetova(vs, stack - 8, &nullptr, 1);
+  stack -= 8;
+
+  int64_t uargv = 0;
+
+  // Write pointers to strings
+  for (int i = argc - 1; i >= 0; i--)
+  {
+    vspacewritetova(vs, stack - 8, (char *)&pointers_array[i], 4);
+    stack -= 8;
+    // Save the pointer to the first argument
+    if (i == 0)
+    {
+      uargv = stack;
+    }
+  }
+
+  stack -= 8;
+
+  tf->rip = rip;
+  tf->rsp = stack;
+  tf->rdi = argc;
+  tf->rsi = uargv;
+  vs->pinned = 0;
+  return 0;
+}
+
+// Replace the current process' image with the program at path, run
+// with the null-terminated argument strings argv, which the caller
+// has checked.
+// Returns 0 on success, with the trap frame set to start the program,
+// or -1 on error, with the old image left running.  A process with
+// threads other than the caller can't exec.
 int exec(char *path, char **argv) {
-  // your code here
-  return -1;
+  struct proc *p = myproc();
+  struct vspace vs, old;
+
+  if (ISTHREAD(p) || p->nthreads > 1)
+    return -1;
+  if (execload(&vs, path, argv, p->tf) < 0)
+    return -1;
+
+  // Install new vspace and return to run new process.  The swapper
+  // finds pages through their vspace, so the vspaces are moved with
+  // vspacemove(), and p->vspace stays usable in between.
+  vspacemove(&old, &p->vspace);
+  vspacemove(&p->vspace, &vs);
+
+  vspaceinstall(p);
+  vspacefree(&old);
+  return 0;
 }
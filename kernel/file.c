@@ -4,9 +4,12 @@
 
 #include <cdefs.h>
 #include <defs.h>
+#include <fcntl.h>
 #include <file.h>
 #include <fs.h>
+#include <mmu.h>
 #include <param.h>
+#include <poll.h>
 #include <sleeplock.h>
 #include <spinlock.h>
 
@@ -15,7 +18,146 @@ struct files global_files;
 
 struct devsw devsw[NDEV];
 
+static struct kmem_cache *pipecache;
+
+static void pipector(void *v) {
+  initlock(&((struct pipe *)v)->lock, "pipe lock");
+}
+
 
 void fileinit(void) {
   initsleeplock(&global_files.lock, "files lock");
-}
\ No newline at end of file
+  pollinit();
+  pipecache = kmem_cache_create("pipe", sizeof(struct pipe), pipector);
+  for (int i = 0; i < NFILE; i++)
+    initsleeplock(&global_files.files[i].lock, "file");
+}
+
+// Allocate an empty pipe with no open ends.
+struct pipe *pipealloc(void) {
+  struct pipe *pipe;
+  int i;
+
+  if ((pipe = kmem_cache_alloc(pipecache)) == 0)
+    return 0;
+  pipe->read_off = pipe->write_off = 0;
+  pipe->data_count = 0;
+  pipe->readers = pipe->writers = 0;
+  pipe->pollers = 0;
+  for (i = 0; i < PIPEPAGES; i++) {
+    if ((pipe->buffer[i] = kalloc()) == 0) {
+      while (--i >= 0)
+        kfree(pipe->buffer[i]);
+      kmem_cache_free(pipecache, pipe);
+      return 0;
+    }
+  }
+  return pipe;
+}
+
+static void pipefree(struct pipe *pipe) {
+  for (int i = 0; i < PIPEPAGES; i++)
+    kfree(pipe->buffer[i]);
+  kmem_cache_free(pipecache, pipe);
+}
+
+// Copy up to n buffered bytes out of the pipe, a page-contiguous
+// span at a time.  Returns the number of bytes copied.
+// Caller must hold pipe->lock.
+int pipecopyout(struct pipe *pipe, char *dst, int n) {
+  int done, m;
+
+  n = min(n, pipe->data_count);
+  for (done = 0; done < n; done += m) {
+    m = min(n - done, PGSIZE - pipe->read_off % PGSIZE);
+    memmove(dst + done, pipe->buffer[pipe->read_off / PGSIZE] + pipe->read_off % PGSIZE, m);
+    pipe->read_off = (pipe->read_off + m) % MAX_PIPE_SIZE;
+  }
+  pipe->data_count -= n;
+  return n;
+}
+
+// Copy up to n bytes into the pipe's free space, a page-contiguous
+// span at a time.  Returns the number of bytes copied.
+// Caller must hold pipe->lock.
+int pipecopyin(struct pipe *pipe, char *src, int n) {
+  int done, m;
+
+  n = min(n, MAX_PIPE_SIZE - pipe->data_count);
+  for (done = 0; done < n; done += m) {
+    m = min(n - done, PGSIZE - pipe->write_off % PGSIZE);
+    memmove(pipe->buffer[pipe->write_off / PGSIZE] + pipe->write_off % PGSIZE, src + done, m);
+    pipe->write_off = (pipe->write_off + m) % MAX_PIPE_SIZE;
+  }
+  pipe->data_count += n;
+  return n;
+}
+
+// What of POLLIN, POLLOUT and POLLHUP the read end, if reading is
+// set, or the write end of the pipe has.  If none of events is
+// ready and the pipe is not hung up, put e on its queue.
+int pipepoll(struct pipe *pipe, int reading, int events, struct pollent *e,
+             struct pollset *ps) {
+  int ready;
+
+  acquire(&pipe->lock);
+  if (reading) {
+    ready = pipe->data_count > 0 || pipe->writers == 0 ? POLLIN : 0;
+    if (pipe->writers == 0)
+      ready |= POLLHUP;
+  } else {
+    ready = pipe->data_count < MAX_PIPE_SIZE || pipe->readers == 0 ? POLLOUT : 0;
+    if (pipe->readers == 0)
+      ready |= POLLHUP;
+  }
+  if (!(ready & (events | POLLHUP)) && e)
+    pollqueue(&pipe->pollers, &pipe->lock, e, ps);
+  release(&pipe->lock);
+  return ready;
+}
+
+// Count another descriptor referring to f.
+// Caller must hold global_files.lock.
+void filedup(struct file *f) {
+  f->ref_count++;
+  if (f->file_type == PIPE) {
+    struct pipe *pipe = f->pipeptr;
+    acquire(&pipe->lock);
+    if (f->access_mode == O_RDONLY)
+      pipe->readers++;
+    else
+      pipe->writers++;
+    release(&pipe->lock);
+  }
+}
+
+// Drop a descriptor's reference to f, freeing the file struct and
+// the pipe or inode behind it with the last one.
+// Caller must hold global_files.lock.
+void fileclose(struct file *f) {
+  f->ref_count--;
+  if (f->file_type == PIPE) {
+    struct pipe *pipe = f->pipeptr;
+    int n;
+    acquire(&pipe->lock);
+    if (f->access_mode == O_RDONLY)
+      n = --pipe->readers;
+    else
+      n = --pipe->writers;
+    // Let the other end see EOF or a broken pipe
+    if (n == 0) {
+      wakeup(&pipe->read_off);
+      wakeup(&pipe->write_off);
+      pollwake(pipe->pollers);
+    }
+    n = pipe->readers + pipe->writers;
+    release(&pipe->lock);
+    if (n == 0)
+      pipefree(pipe);
+  }
+  if (f->ref_count == 0) {
+    if (f->file_type == FILE)
+      irelease(f->inodep);
+    f->available = FILE_AVAIL;
+  }
+}
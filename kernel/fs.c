@@ -18,16 +18,29 @@
 #include <sleeplock.h>
 #include <spinlock.h>
 #include <stat.h>
+#include <timer.h>
+#include <trace.h>
+#include <x86_64.h>
+#include <uio.h>
 
 #include <buf.h>
 
 
 // Logging API
-static void log_begin_tx();
+static void log_begin_tx(int nblocks);
 static void log_write(struct buf* buff);
-static void log_commit();
+static void log_end_tx(int nblocks);
+static void log_commit(int);
+static uint log_txseq();
 static void log_recover(); 
+static int log_install();
+static void log_flusher(void *);
+static void imapinit(void);
+static void dcacheinit(void);
 static int raw_writei(struct inode *ip, char *src, uint off, uint n);
+static void iupdate(struct inode *ip);
+static void iuninline(struct inode *ip);
+static int igap(struct inode *ip, uint off);
 static int concurrent_raw_writei(struct inode *ip, char *src, uint off, uint n);
 
 
@@ -44,8 +57,92 @@ void readsb(int dev, struct superblock *sb) {
   brelse(bp);
 }
 
-// mark [start, end] bit in bp->data to 1 if used is true, else 0
-static void bmark(struct buf *bp, uint start, uint end, bool used)
+// Free-space index.
+//
+// For every bitmap block the kernel remembers how many of its blocks
+// are free and the length of its longest free run.  balloc() only
+// reads bitmap blocks that can satisfy the request, and bmark()
+// refreshes the entry of the block it changes.  The index is built by
+// bmapinit() at mount time.
+#define NBITMAP ((FSSIZE + BPB - 1) / BPB)
+
+static struct {
+  uint nfree;  // free blocks covered by this bitmap block
+  uint maxrun; // longest run of free blocks in it
+} bmapsum[NBITMAP];
+
+// Account for a free run of len blocks starting at bit start that
+// bmapscan() has just passed.
+static void bmaprun(uint start, uint len, uint n, uint *maxrun, int *found, uint *best)
+{
+  if (len > *maxrun)
+    *maxrun = len;
+  if (n > 0 && len >= n && (*found < 0 || len < *best)) {
+    *found = start;
+    *best = len;
+  }
+}
+
+// Scan the bitmap block holding bits for blocks [b, b + BPB), 64 bits
+// at a time where possible.  Records its summary in bmapsum and, if
+// n > 0, returns in *bestp the start bit of the smallest free run of
+// at least n blocks (best fit), or -1 if there is none.
+static void bmapscan(struct buf *bp, uint b, uint n, int *bestp)
+{
+  uint64_t *words = (uint64_t *)bp->data;
+  uint nbits = min(sb.size - b, (uint)BPB);
+  uint bi, run, nfree, maxrun, best;
+  int found;
+
+  run = nfree = maxrun = best = 0;
+  found = -1;
+  for (bi = 0; bi < nbits; ) {
+    if (bi % 64 == 0 && bi + 64 <= nbits && words[bi / 64] == 0) {
+      // 64 free blocks.
+      run += 64;
+      nfree += 64;
+      bi += 64;
+    } else if (bi % 64 == 0 && bi + 64 <= nbits && words[bi / 64] == ~(uint64_t)0) {
+      // 64 used blocks.
+      bmaprun(bi - run, run, n, &maxrun, &found, &best);
+      run = 0;
+      bi += 64;
+    } else if ((bp->data[bi / 8] & (1 << (bi % 8))) == 0) {
+      run++;
+      nfree++;
+      bi++;
+    } else {
+      bmaprun(bi - run, run, n, &maxrun, &found, &best);
+      run = 0;
+      bi++;
+    }
+  }
+  bmaprun(bi - run, run, n, &maxrun, &found, &best);
+
+  bmapsum[b / BPB].nfree = nfree;
+  bmapsum[b / BPB].maxrun = maxrun;
+  if (bestp)
+    *bestp = found;
+}
+
+// Build the free-space index from the on-disk bitmap.
+static void bmapinit(uint dev)
+{
+  struct buf *bp;
+  uint b;
+
+  if ((sb.size + BPB - 1) / BPB > NBITMAP)
+    panic("bmapinit: file system larger than FSSIZE");
+  for (b = 0; b < sb.size; b += BPB) {
+    bp = bread(dev, BBLOCK(b, sb));
+    bmapscan(bp, b, 0, 0);
+    brelse(bp);
+  }
+}
+
+// Set bits [start, end] of bitmap block bp if used is true, else
+// clear them, without logging bp.
+static void bmarkbits(struct buf *bp, uint start, uint end, bool used)
 {
   int m, bi;
   for (bi = start; bi <= end; bi++) {
@@ -58,58 +155,803 @@ static void bmark(struct buf *bp, uint start, uint end, bool used)
       bp->data[bi/8] &= ~m; // Mark block as free.
     }
   }
+}
+
+// mark [start, end] bit in bp->data to 1 if used is true, else 0
+static void bmark(struct buf *bp, uint start, uint end, bool used)
+{
+  bmarkbits(bp, start, end, used);
   bp->flags |= B_DIRTY; // mark our update
   //New: write out the changes to disk as well
   log_write(bp);
+
+  // Keep the free-space index in sync.
+  bmapscan(bp, (bp->blockno - sb.bmapstart) * BPB, 0, 0);
 }
 
 // Blocks.
 
+// Allocate n disk blocks, no promise on content of allocated disk blocks
+// Returns the beginning block number of a consecutive chunk of n blocks,
+// or 0 if there is no free run that long.
+static uint balloc_try(uint dev, uint n)
+{
+  int b, bi;
+  struct buf *bp;
+
+  for (b = 0; b < sb.size; b += BPB) {
+    if (bmapsum[b / BPB].maxrun < n)
+      continue; // no room in this bitmap sector
+
+    bp = bread(dev, BBLOCK(b, sb));
+    bmapscan(bp, b, n, &bi);
+    if (bi >= 0) {
+      bmark(bp, bi, bi + n - 1, true); // mark data block as used
+      brelse(bp);
+      return b+bi;
+    }
+    brelse(bp);
+  }
+  return 0;
+}
+
+// Find a free run of n disk blocks without allocating it.  Returns
+// its first block, or 0 if there is no free run that long.
+static uint bfind(uint dev, uint n)
+{
+  int b, bi;
+  struct buf *bp;
+
+  for (b = 0; b < sb.size; b += BPB) {
+    if (bmapsum[b / BPB].maxrun < n)
+      continue;
+    bp = bread(dev, BBLOCK(b, sb));
+    bmapscan(bp, b, n, &bi);
+    brelse(bp);
+    if (bi >= 0)
+      return b + bi;
+  }
+  return 0;
+}
+
 // Allocate n disk blocks, no promise on content of allocated disk blocks
 // Returns the beginning block number of a consecutive chunk of n blocks
 static uint balloc(uint dev, uint n)
 {
-  int b, bi, m;
+  uint b;
+
+  if ((b = balloc_try(dev, n)) == 0)
+    panic("balloc: can't allocate contiguous blocks");
+  return b;
+}
+
+// Allocate the n disk blocks starting at b, if they are all free and
+// covered by one bitmap block.  Returns 1 on success, 0 otherwise.
+static int balloc_at(uint dev, uint b, uint n)
+{
   struct buf *bp;
+  uint bi;
 
-  bp = 0;
-  for (b = 0; b < sb.size; b += BPB) {
-    bp = bread(dev, BBLOCK(b, sb)); // look through each bitmap sector
-
-    uint sz = 0;
-    uint i = 0;
-    for (bi = 0; bi < BPB && b + bi < sb.size; bi++) {
-      m = 1 << (bi % 8);
-      if ((bp->data[bi/8] & m) == 0) {  // Is block free?
-        sz++;
-        if (sz == 1) // reset starting blk
-          i = bi;
-        if (sz == n) { // found n blks
-          bmark(bp, i, bi, true); // mark data block as used
-          brelse(bp);
-          return b+i;
-        }
-      } else { // reset search
-        sz = 0;
-        i =0;
+  if (b + n > sb.size || BBLOCK(b, sb) != BBLOCK(b + n - 1, sb) ||
+      bmapsum[b / BPB].maxrun < n)
+    return 0;
+
+  bp = bread(dev, BBLOCK(b, sb));
+  for (bi = b % BPB; bi < b % BPB + n; bi++) {
+    if (bp->data[bi / 8] & (1 << (bi % 8))) {
+      brelse(bp);
+      return 0;
+    }
+  }
+  bmark(bp, b % BPB, b % BPB + n - 1, true);
+  brelse(bp);
+  return 1;
+}
+
+// Bitmap blocks changed by a run of bfree() calls.  Each is read
+// once and kept until bfreedone(), which logs it and refreshes its
+// free-space index entry once, however many extents it freed.  Only
+// delete_inode() keeps several bitmap blocks locked like this, and
+// sys_unlink() runs one at a time.
+struct bfreeset {
+  int dev;
+  struct buf *bp[NBITMAP];
+};
+
+// Free n disk blocks starting from b into fs.  Merged extents may
+// cross bitmap blocks, so free them one bitmap block at a time.
+static void bfree(struct bfreeset *fs, uint b, uint n)
+{
+  struct buf **bpp;
+  uint m;
+
+  assertm(n >= 1, "freeing less than 1 block");
+
+  while (n > 0) {
+    m = min(n, BPB - b % BPB);
+    bpp = &fs->bp[b / BPB];
+    if (*bpp == 0)
+      *bpp = bread(fs->dev, BBLOCK(b, sb));
+    bmarkbits(*bpp, b % BPB, (b+m-1) % BPB, false);
+    b += m;
+    n -= m;
+  }
+}
+
+// Log and release the bitmap blocks fs changed.
+static void bfreedone(struct bfreeset *fs)
+{
+  struct buf *bp;
+
+  for (int i = 0; i < NBITMAP; i++) {
+    if ((bp = fs->bp[i]) == 0)
+      continue;
+    log_write(bp);
+    bmapscan(bp, i * BPB, 0, 0);
+    brelse(bp);
+  }
+}
+
+// Share counts.
+//
+// A file's blocks may belong to other files too, once clone_file()
+// has shared them (see fs.h).  Only files with DINODE_SHARED set can
+// have such blocks, so the counts are never read for the others.
+
+// Share count of block b.
+static uint brefget(uint dev, uint b)
+{
+  struct buf *bp = bread(dev, RBLOCK(b, sb));
+  uint r = bp->data[b % BSIZE];
+  brelse(bp);
+  return r;
+}
+
+// The number of blocks from b, at most n, that are all shared if
+// shared is set, or all not.
+static uint brefrun(uint dev, uint b, uint n, int shared)
+{
+  struct buf *bp;
+  uint k, i, m;
+
+  for (k = 0; k < n; k += m) {
+    m = min(n - k, BSIZE - (b + k) % BSIZE);
+    bp = bread(dev, RBLOCK(b + k, sb));
+    for (i = 0; i < m; i++) {
+      if ((bp->data[(b + k + i) % BSIZE] != 0) != shared) {
+        brelse(bp);
+        return k + i;
       }
     }
     brelse(bp);
   }
-  panic("balloc: can't allocate contiguous blocks");
+  return n;
 }
 
-// Free n disk blocks starting from b
-static void bfree(int dev, uint b, uint n)
+// Add delta to the share counts of blocks [b, b + n).
+static void brefadd(uint dev, uint b, uint n, int delta)
 {
   struct buf *bp;
+  uint i, m;
+
+  for (; n > 0; b += m, n -= m) {
+    m = min(n, BSIZE - b % BSIZE);
+    bp = bread(dev, RBLOCK(b, sb));
+    for (i = b % BSIZE; i < b % BSIZE + m; i++)
+      bp->data[i] += delta;
+    log_write(bp);
+    brelse(bp);
+  }
+}
 
-  assertm(n >= 1, "freeing less than 1 block");
-  assertm(BBLOCK(b, sb) == BBLOCK(b+n-1, sb), "returned blocks live in different bitmap sectors");
+// Let go of ip's data blocks [b, b + n) into fs: a shared block loses
+// a share, and the rest are freed.
+static void bfreedata(struct bfreeset *fs, struct inode *ip, uint b, uint n)
+{
+  uint m;
 
-  bp = bread(dev, BBLOCK(b, sb));
-  bmark(bp, b % BPB, (b+n-1) % BPB, false);
+  if (!(ip->used & DINODE_SHARED)) {
+    bfree(fs, b, n);
+    return;
+  }
+  for (; n > 0; b += m, n -= m) {
+    if ((m = brefrun(fs->dev, b, n, 0)) > 0) {
+      bfree(fs, b, m);
+    } else {
+      m = brefrun(fs->dev, b, n, 1);
+      brefadd(fs->dev, b, m, -1);
+    }
+  }
+}
+
+// Extent trees.
+//
+// The first NDIRECT extents of a file live in the dinode.  Further
+// extents go in a two-level tree rooted at dinode.indirect: an index
+// block lists leaf blocks, and each leaf lists extents, each tagged
+// with the file block it starts at.  Both levels are sorted by file
+// block, so lookups binary-search them.  Files only grow at the end,
+// so new extents are appended to the last leaf; only breaking the
+// sharing of blocks in the middle of a file splits extents, and with
+// them leaves.
+//
+// An extent that starts at disk block 0, which holds no data, is a
+// hole: its blocks read as zeros and have no disk blocks until they
+// are written.
+
+// Rebuild ip->extent_end, the running total of blocks that maps file
+// block numbers to direct extents, and ip->nblocks.  Must be called
+// whenever ip->extent_array or the tree changes.
+static void iindex(struct inode *ip)
+{
+  uint total = 0;
+
+  for (int i = 0; i < ip->num_extents; i++) {
+    total += ip->extent_array[i].nblocks;
+    ip->extent_end[i] = total;
+  }
+
+  if (ip->indirect) {
+    struct buf *bp = bread(ip->dev, ip->indirect);
+    total += ((struct extidx *)bp->data)->nblocks;
+    brelse(bp);
+  }
+  ip->nblocks = total;
+}
+
+// Number of blocks ip's extents cover, holes included.
+static uint ifileblocks(struct inode *ip)
+{
+  return ip->nblocks;
+}
+
+// Where the extent holding a file block is: in the dinode, or in a
+// leaf of the tree, which iextget() leaves held for iextput().
+struct extref {
+  struct extent *e; // the extent
+  uint first;       // file block it starts at
+  int i;            // its index in ip->extent_array or in the leaf
+  int c;            // index of the leaf in the tree, or -1
+  struct buf *bp;   // the leaf, or 0
+};
+
+// Find the extent holding block fblk of ip's data, by binary search
+// over ip->extent_end and then the extent tree.  Returns 0 if fblk is
+// past the end of the allocated blocks.
+static int iextget(struct inode *ip, uint fblk, struct extref *r)
+{
+  int lo = 0, hi = ip->num_extents;
+
+  if (fblk >= ip->nblocks)
+    return 0;
+
+  // Find the first direct extent ending after fblk.
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (ip->extent_end[mid] <= fblk)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo < ip->num_extents) {
+    r->e = &ip->extent_array[lo];
+    r->first = ip->extent_end[lo] - r->e->nblocks;
+    r->i = lo;
+    r->c = -1;
+    r->bp = 0;
+    return 1;
+  }
+
+  // Find the last leaf, then the last extent, starting at or before fblk.
+  struct buf *bp = bread(ip->dev, ip->indirect);
+  struct extidx *idx = (struct extidx *)bp->data;
+  for (lo = 0, hi = idx->nchild; hi - lo > 1; ) {
+    int mid = (lo + hi) / 2;
+    if (idx->child[mid].fblk <= fblk)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  uint leafno = idx->child[lo].blkno;
+  r->c = lo;
+  brelse(bp);
+
+  r->bp = bread(ip->dev, leafno);
+  struct extleaf *leaf = (struct extleaf *)r->bp->data;
+  for (lo = 0, hi = leaf->nextent; hi - lo > 1; ) {
+    int mid = (lo + hi) / 2;
+    if (leaf->e[mid].fblk <= fblk)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  r->e = &leaf->e[lo].ext;
+  r->first = leaf->e[lo].fblk;
+  r->i = lo;
+  return 1;
+}
+
+static void iextput(struct extref *r)
+{
+  if (r->bp)
+    brelse(r->bp);
+}
+
+// Map block fblk of ip's data to its disk block.  Sets *run to the
+// number of blocks from there to the end of the extent, which are
+// contiguous on disk.  Returns 0 in a hole, and 0 with *run 0 if fblk
+// is past the end of the extents.
+static uint bmap(struct inode *ip, uint fblk, uint *run)
+{
+  struct extref r;
+  uint blk;
+
+  if (!iextget(ip, fblk, &r)) {
+    *run = 0;
+    return 0;
+  }
+  blk = r.e->startblkno ? r.e->startblkno + (fblk - r.first) : 0;
+  *run = r.e->nblocks - (fblk - r.first);
+  iextput(&r);
+  return blk;
+}
+
+// Allocate a zeroed block for the extent tree.
+static uint balloc_tree(uint dev)
+{
+  uint b = balloc(dev, 1);
+  struct buf *bp = bread(dev, b);
+  memset(bp->data, 0, BSIZE);
+  log_write(bp);
+  brelse(bp);
+  return b;
+}
+
+// Disk block just past ip's last extent, or 0 if ip has no blocks or
+// ends in a hole.
+static uint ilastend(struct inode *ip)
+{
+  struct extent *e;
+  uint end;
+
+  if (ip->indirect) {
+    struct buf *bp = bread(ip->dev, ip->indirect);
+    struct extidx *idx = (struct extidx *)bp->data;
+    uint leafno = idx->child[idx->nchild - 1].blkno;
+    brelse(bp);
+
+    bp = bread(ip->dev, leafno);
+    struct extleaf *leaf = (struct extleaf *)bp->data;
+    e = &leaf->e[leaf->nextent - 1].ext;
+    end = e->startblkno ? e->startblkno + e->nblocks : 0;
+    brelse(bp);
+    return end;
+  }
+  if (ip->num_extents == 0)
+    return 0;
+  e = &ip->extent_array[ip->num_extents - 1];
+  return e->startblkno ? e->startblkno + e->nblocks : 0;
+}
+
+// Grow ip's last extent by n blocks.
+static void iextendlast(struct inode *ip, uint n)
+{
+  if (ip->indirect) {
+    struct buf *bp = bread(ip->dev, ip->indirect);
+    struct extidx *idx = (struct extidx *)bp->data;
+    uint leafno = idx->child[idx->nchild - 1].blkno;
+    idx->nblocks += n;
+    log_write(bp);
+    brelse(bp);
+
+    bp = bread(ip->dev, leafno);
+    struct extleaf *leaf = (struct extleaf *)bp->data;
+    leaf->e[leaf->nextent - 1].ext.nblocks += n;
+    log_write(bp);
+    brelse(bp);
+  } else {
+    ip->extent_array[ip->num_extents - 1].nblocks += n;
+  }
+  iindex(ip);
+}
+
+// Add the extent [b, b + n) at the end of ip.
+static void iappendext(struct inode *ip, uint b, uint n)
+{
+  struct buf *bp, *lbp;
+  struct extidx *idx;
+  struct extleaf *leaf;
+
+  if (!ip->indirect && ip->num_extents < NDIRECT) {
+    // Update inode fields
+    ip->num_extents++;
+    ip->extent_array[ip->num_extents - 1].startblkno = b;
+    ip->extent_array[ip->num_extents - 1].nblocks = n;
+    iindex(ip);
+    return;
+  }
+
+  if (!ip->indirect)
+    ip->indirect = balloc_tree(ip->dev);
+
+  bp = bread(ip->dev, ip->indirect);
+  idx = (struct extidx *)bp->data;
+  lbp = 0;
+  if (idx->nchild > 0) {
+    lbp = bread(ip->dev, idx->child[idx->nchild - 1].blkno);
+    if (((struct extleaf *)lbp->data)->nextent == NEXTLEAF) {
+      brelse(lbp);
+      lbp = 0;
+    }
+  }
+  if (lbp == 0) {
+    // Start a new leaf.
+    if (idx->nchild == NEXTIDX)
+      panic("our file used up all its extents");
+    idx->child[idx->nchild].fblk = ip->nblocks;
+    idx->child[idx->nchild].blkno = balloc_tree(ip->dev);
+    lbp = bread(ip->dev, idx->child[idx->nchild].blkno);
+    idx->nchild++;
+  }
+
+  leaf = (struct extleaf *)lbp->data;
+  leaf->e[leaf->nextent].fblk = ip->nblocks;
+  leaf->e[leaf->nextent].ext.startblkno = b;
+  leaf->e[leaf->nextent].ext.nblocks = n;
+  leaf->nextent++;
+  log_write(lbp);
+  brelse(lbp);
+
+  idx->nblocks += n;
+  log_write(bp);
   brelse(bp);
+  iindex(ip);
+}
+
+// Insert extent e, starting at file block fblk, as entry j of leaf c
+// of ip's tree, splitting the leaf in two if it is full.  An empty
+// tree gets its first leaf.  Returns 0, or -1 if the leaf is full and
+// the tree has no room for another.
+static int ileafinsert(struct inode *ip, int c, int j, uint fblk, struct extent *e)
+{
+  struct buf *bp, *lbp, *nbp;
+  struct extidx *idx;
+  struct extleaf *leaf, *nleaf;
+  int h;
+
+  bp = bread(ip->dev, ip->indirect);
+  idx = (struct extidx *)bp->data;
+  if (idx->nchild == 0) {
+    idx->child[0].fblk = fblk;
+    idx->child[0].blkno = balloc_tree(ip->dev);
+    idx->nchild = 1;
+  }
+  lbp = bread(ip->dev, idx->child[c].blkno);
+  leaf = (struct extleaf *)lbp->data;
+  if (leaf->nextent == NEXTLEAF) {
+    if (idx->nchild == NEXTIDX) {
+      brelse(lbp);
+      brelse(bp);
+      return -1;
+    }
+    // Move the upper half to a new leaf after this one.
+    h = NEXTLEAF / 2;
+    nbp = bread(ip->dev, balloc_tree(ip->dev));
+    nleaf = (struct extleaf *)nbp->data;
+    memmove(nleaf->e, &leaf->e[h], (NEXTLEAF - h) * sizeof(leaf->e[0]));
+    nleaf->nextent = NEXTLEAF - h;
+    leaf->nextent = h;
+    memmove(&idx->child[c + 2], &idx->child[c + 1],
+            (idx->nchild - c - 1) * sizeof(idx->child[0]));
+    idx->child[c + 1].fblk = nleaf->e[0].fblk;
+    idx->child[c + 1].blkno = nbp->blockno;
+    idx->nchild++;
+    log_write(lbp);
+    if (j > h) {
+      brelse(lbp);
+      lbp = nbp;
+      leaf = nleaf;
+      j -= h;
+      c++;
+    } else {
+      log_write(nbp);
+      brelse(nbp);
+    }
+  }
+
+  memmove(&leaf->e[j + 1], &leaf->e[j], (leaf->nextent - j) * sizeof(leaf->e[0]));
+  leaf->e[j].fblk = fblk;
+  leaf->e[j].ext = *e;
+  leaf->nextent++;
+  if (j == 0)
+    idx->child[c].fblk = fblk;
+  log_write(lbp);
+  brelse(lbp);
+  log_write(bp);
+  brelse(bp);
+  return 0;
+}
+
+// Move ip's last direct extent to the front of the tree, to make room
+// in the dinode.  Returns 0, or -1 if the tree is full.
+static int ispill(struct inode *ip)
+{
+  struct extent e = ip->extent_array[ip->num_extents - 1];
+  uint first = ip->extent_end[ip->num_extents - 1] - e.nblocks;
+  struct buf *bp;
+
+  if (!ip->indirect)
+    ip->indirect = balloc_tree(ip->dev);
+  if (ileafinsert(ip, 0, 0, first, &e) < 0)
+    return -1;
+  bp = bread(ip->dev, ip->indirect);
+  ((struct extidx *)bp->data)->nblocks += e.nblocks;
+  log_write(bp);
+  brelse(bp);
+  ip->num_extents--;
+  iindex(ip);
+  return 0;
+}
+
+// Make an extent of ip start at file block fblk, splitting the one
+// holding it in two.  Returns 0, or -1 if there is no room for
+// another extent.
+static int isplit(struct inode *ip, uint fblk)
+{
+  struct extref r;
+  struct extent e;
+  uint d;
+  int i;
+
+  if (!iextget(ip, fblk, &r))
+    return 0;
+  if ((d = fblk - r.first) == 0) {
+    iextput(&r);
+    return 0;
+  }
+  e.startblkno = r.e->startblkno ? r.e->startblkno + d : 0;
+  e.nblocks = r.e->nblocks - d;
+
+  if (r.c >= 0) {
+    // Add the second half after the first, which may move to a new
+    // leaf, then cut the first short.
+    iextput(&r);
+    if (ileafinsert(ip, r.c, r.i + 1, fblk, &e) < 0)
+      return -1;
+    iextget(ip, fblk - 1, &r);
+    r.e->nblocks = d;
+    log_write(r.bp);
+    iextput(&r);
+    return 0;
+  }
+
+  if (ip->num_extents == NDIRECT) {
+    if (ispill(ip) < 0)
+      return -1;
+    return isplit(ip, fblk);
+  }
+  i = r.i;
+  memmove(&ip->extent_array[i + 2], &ip->extent_array[i + 1],
+          (ip->num_extents - i - 1) * sizeof(struct extent));
+  ip->extent_array[i].nblocks = d;
+  ip->extent_array[i + 1] = e;
+  ip->num_extents++;
+  iindex(ip);
+  return 0;
+}
+
+// Give ip blocks of its own for its n shared blocks, or blocks of a
+// hole, from file block fblk, which lie in one extent, ahead of a
+// write of [off, off + len).  The new blocks get the data of the old
+// ones the write does not cover in full, or zeros in a hole, and the
+// old ones lose ip's share.  May give fewer than n blocks if the disk
+// has no run that long.  Returns how many it gave, or -1 if there is
+// no room to split the extent.
+static int iremap(struct inode *ip, uint fblk, uint n, uint off, uint len)
+{
+  struct bfreeset fs;
+  struct buf *from, *to;
+  struct extref r;
+  uint b, old, i, start;
+
+  if ((b = balloc_try(ip->dev, n)) == 0)
+    b = balloc(ip->dev, (n = 1));
+  if (isplit(ip, fblk) < 0 || isplit(ip, fblk + n) < 0) {
+    memset(&fs, 0, sizeof(fs));
+    fs.dev = ip->dev;
+    bfree(&fs, b, n);
+    bfreedone(&fs);
+    return -1;
+  }
+
+  iextget(ip, fblk, &r);
+  old = r.e->startblkno;
+  r.e->startblkno = b;
+  if (r.bp)
+    log_write(r.bp);
+  iextput(&r);
+
+  for (i = 0; i < n; i++) {
+    start = (fblk + i) * BSIZE;
+    if (start >= off && start + BSIZE <= off + len)
+      continue;
+    to = bread(ip->dev, b + i);
+    if (old) {
+      from = bread(ip->dev, old + i);
+      memmove(to->data, from->data, BSIZE);
+      brelse(from);
+    } else {
+      memset(to->data, 0, BSIZE);
+    }
+    log_write(to);
+    brelse(to);
+  }
+  if (old)
+    brefadd(ip->dev, old, n, -1);
+  return n;
+}
+
+// Copy ip's extent tree to new blocks, for a file that shares ip's
+// data.  Returns the root of the copy.
+static uint itreecopy(struct inode *ip)
+{
+  struct buf *bp, *nbp, *lbp, *nlbp;
+  struct extidx *idx;
+  uint root;
+
+  root = balloc_tree(ip->dev);
+  bp = bread(ip->dev, ip->indirect);
+  nbp = bread(ip->dev, root);
+  memmove(nbp->data, bp->data, BSIZE);
+  brelse(bp);
+  idx = (struct extidx *)nbp->data;
+  for (int c = 0; c < idx->nchild; c++) {
+    lbp = bread(ip->dev, idx->child[c].blkno);
+    idx->child[c].blkno = balloc_tree(ip->dev);
+    nlbp = bread(ip->dev, idx->child[c].blkno);
+    memmove(nlbp->data, lbp->data, BSIZE);
+    log_write(nlbp);
+    brelse(nlbp);
+    brelse(lbp);
+  }
+  log_write(nbp);
+  brelse(nbp);
+  return root;
+}
+
+// Call fn(dev, b, n) on each data extent [b, b + n) of ip, holes left
+// out, stopping at the first call that returns nonzero.  Returns what that call
+// returned, or 0.
+static int iforeach(struct inode *ip, int (*fn)(uint, uint, uint))
+{
+  struct buf *bp, *lbp;
+  struct extidx *idx;
+  struct extleaf *leaf;
+  int r = 0;
+
+  for (int i = 0; i < ip->num_extents && r == 0; i++)
+    if (ip->extent_array[i].startblkno)
+      r = fn(ip->dev, ip->extent_array[i].startblkno, ip->extent_array[i].nblocks);
+  if (!ip->indirect || r)
+    return r;
+  bp = bread(ip->dev, ip->indirect);
+  idx = (struct extidx *)bp->data;
+  for (int c = 0; c < idx->nchild && r == 0; c++) {
+    lbp = bread(ip->dev, idx->child[c].blkno);
+    leaf = (struct extleaf *)lbp->data;
+    for (int i = 0; i < leaf->nextent && r == 0; i++)
+      if (leaf->e[i].ext.startblkno)
+        r = fn(ip->dev, leaf->e[i].ext.startblkno, leaf->e[i].ext.nblocks);
+    brelse(lbp);
+  }
+  brelse(bp);
+  return r;
+}
+
+// Is a share count of [b, b + n) at BREFMAX?
+static int breffull(uint dev, uint b, uint n)
+{
+  struct buf *bp;
+  uint i, m;
+
+  for (; n > 0; b += m, n -= m) {
+    m = min(n, BSIZE - b % BSIZE);
+    bp = bread(dev, RBLOCK(b, sb));
+    for (i = b % BSIZE; i < b % BSIZE + m; i++) {
+      if (bp->data[i] == BREFMAX) {
+        brelse(bp);
+        return 1;
+      }
+    }
+    brelse(bp);
+  }
+  return 0;
+}
+
+static int brefshare(uint dev, uint b, uint n)
+{
+  brefadd(dev, b, n, 1);
+  return 0;
+}
+
+// Free every block of ip, extent tree included, logging each bitmap
+// block once.
+static void ifreeblocks(struct inode *ip)
+{
+  struct bfreeset fs;
+
+  memset(&fs, 0, sizeof(fs));
+  fs.dev = ip->dev;
+  for (int i = 0 ; i < ip->num_extents; i++) {
+    if (ip->extent_array[i].startblkno)
+      bfreedata(&fs, ip, ip->extent_array[i].startblkno, ip->extent_array[i].nblocks);
+  }
+
+  if (ip->indirect) {
+    struct buf *bp = bread(ip->dev, ip->indirect);
+    struct extidx *idx = (struct extidx *)bp->data;
+    for (int c = 0; c < idx->nchild; c++) {
+      struct buf *lbp = bread(ip->dev, idx->child[c].blkno);
+      struct extleaf *leaf = (struct extleaf *)lbp->data;
+      for (int i = 0; i < leaf->nextent; i++)
+        if (leaf->e[i].ext.startblkno)
+          bfreedata(&fs, ip, leaf->e[i].ext.startblkno, leaf->e[i].ext.nblocks);
+      brelse(lbp);
+      bfree(&fs, idx->child[c].blkno, 1);
+    }
+    brelse(bp);
+    bfree(&fs, ip->indirect, 1);
+  }
+  bfreedone(&fs);
+}
+
+// Appending files get speculatively preallocated space that doubles
+// with the file, up to MAXPREALLOC blocks at a time.  A file that ends
+// in a hole gets none, as its size says nothing about how it grows.
+#define MAXPREALLOC 256
+
+// Grow ip by at least n blocks for an append.  Tries to extend the last
+// extent in place, with a geometrically growing preallocation, before
+// starting a new extent; a new extent that lands right after the last
+// one is merged into it.  Returns the first new block and sets *nalloc
+// to the number allocated.
+// Caller must hold ip->lock and be in a transaction.
+static uint extend_alloc(struct inode *ip, uint n, uint *nalloc)
+{
+  uint want, b, end;
+
+  end = ilastend(ip);
+  want = end ? max(n, min(ifileblocks(ip), (uint)MAXPREALLOC)) : n;
+  want = min(want, (uint)BPB);
+
+  if (end) {
+    if (balloc_at(ip->dev, end, want) || (want > n && balloc_at(ip->dev, end, (want = n)))) {
+      iextendlast(ip, want);
+      *nalloc = want;
+      return end;
+    }
+  }
+
+  if (want == n || (b = balloc_try(ip->dev, want)) == 0)
+    b = balloc(ip->dev, (want = n));
+  *nalloc = want;
+
+  if (end && end == b)
+    iextendlast(ip, want);
+  else
+    iappendext(ip, b, want);
+  return b;
+}
+
+// Add a hole of n blocks at the end of ip, for a write past the end.
+// Caller must hold ip->lock and be in a transaction.
+static void iappendhole(struct inode *ip, uint n)
+{
+  if (ip->nblocks > 0 && ilastend(ip) == 0)
+    iextendlast(ip, n);
+  else
+    iappendext(ip, 0, n);
+  ip->used |= DINODE_HOLES;
 }
 
 // Inodes.
@@ -143,12 +985,44 @@ static void bfree(int dev, uint b, uint n)
 
 
 
+// The cache is a hash table on (dev, inum) plus an LRU list of the
+// inodes nobody holds a reference to.  Such inodes stay valid, so a
+// later iget() of the same file needs no disk read; iget() recycles
+// the least recently released one when it needs a slot.  The number
+// of cached inodes is set from free memory at boot.
+#define NIHASH 127
+#define IPERPAGE (PGSIZE / sizeof(struct inode))
+
+int icache_ninode;
+int icache_hits;
+int icache_misses;
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *hash[NIHASH];
+  struct inode lru; // lru.lnext is the most recently released
   struct inode inodefile;
 } icache;
 
+static uint ihash(uint dev, uint inum) {
+  return (dev * 1000003 + inum) % NIHASH;
+}
+
+// Take ip off the LRU list.  Caller must hold icache.lock.
+static void ilruremove(struct inode *ip) {
+  ip->lnext->lprev = ip->lprev;
+  ip->lprev->lnext = ip->lnext;
+}
+
+// Put ip at the most recently used end of the LRU list.
+// Caller must hold icache.lock.
+static void ilruinsert(struct inode *ip) {
+  ip->lnext = icache.lru.lnext;
+  ip->lprev = &icache.lru;
+  icache.lru.lnext->lprev = ip;
+  icache.lru.lnext = ip;
+}
+
 // Find the inode file on the disk and load it into memory
 // should only be called once, but is idempotent.
 static void init_inodefile(int dev) {
@@ -166,11 +1040,13 @@ static void init_inodefile(int dev) {
 
   icache.inodefile.devid = di.devid;
   icache.inodefile.size = di.size;
-  icache.inodefile.extent_array[0] = di.extent_array[0];
-
-
   // New: we also need to update the num_extents and used fields
-  icache.inodefile.num_extents = 1;
+  // The inode file may have grown extents of its own.
+  icache.inodefile.num_extents = di.num_extents > 0 ? di.num_extents : 1;
+  memmove(icache.inodefile.extent_array, di.extent_array,
+          sizeof(struct extent) * icache.inodefile.num_extents);
+  icache.inodefile.indirect = di.indirect;
+  iindex(&icache.inodefile);
   icache.inodefile.used = DINODE_USED;
 
   brelse(b);
@@ -179,27 +1055,57 @@ static void init_inodefile(int dev) {
 void iinit(int dev) {
   int i;
 
+  struct inode *ip;
+  char *page;
+  int npage, j;
+
   initlock(&icache.lock, "icache");
-  for (i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
+  icache.lru.lprev = icache.lru.lnext = &icache.lru;
+  npage = max(free_pages / ICACHE_DIV, (int)((NINODE + IPERPAGE - 1) / IPERPAGE));
+  for (i = 0; i < npage; i++) {
+    if ((page = kalloc()) == 0)
+      break;
+    memset(page, 0, PGSIZE);
+    for (j = 0; j < IPERPAGE; j++) {
+      ip = (struct inode *)page + j;
+      initrwsleeplock(&ip->lock, "inode");
+      ilruinsert(ip);
+      icache_ninode++;
+    }
   }
-  initsleeplock(&icache.inodefile.lock, "inodefile");
+  if (icache_ninode < NINODE)
+    panic("iinit: no memory for inodes");
+  initrwsleeplock(&icache.inodefile.lock, "inodefile");
 
   readsb(dev, &sb);
-  cprintf("sb: size %d nblocks %d bmap start %d inodestart %d\n", sb.size,
-          sb.nblocks, sb.bmapstart, sb.inodestart);
+  if (sb.magic != FSMAGIC || sb.version != FSVERSION)
+    panic("iinit: not a file system of this version; rebuild fs.img");
+  if (sb.bsize != BSIZE) {
+    cprintf("iinit: file system has %d byte blocks, kernel %d\n", sb.bsize,
+            BSIZE);
+    panic("iinit: block size");
+  }
+  cprintf("sb: size %d nblocks %d bmap start %d inodestart %d bsize %d\n",
+          sb.size, sb.nblocks, sb.bmapstart, sb.inodestart, sb.bsize);
 
   // New: can recover log() here
   log_recover();
+  bmapinit(dev);
 
   init_inodefile(dev);
+  imapinit();
+  dcacheinit();
+  swapinit(dev, &sb);
+
+  if (kthread_create(log_flusher, 0, "flush", 0) < 0)
+    panic("iinit: no flusher");
 }
 
 
 // Reads the dinode with the passed inum from the inode file.
 // Threadsafe, will acquire sleeplock on inodefile inode if not held.
 static void read_dinode(uint inum, struct dinode *dip) {
-  int holding_inodefile_lock = holdingsleep(&icache.inodefile.lock);
+  int holding_inodefile_lock = holdingrwsleep(&icache.inodefile.lock);
   if (!holding_inodefile_lock)
     locki(&icache.inodefile);
 
@@ -211,35 +1117,134 @@ static void read_dinode(uint inum, struct dinode *dip) {
 }
 
 
+// Free-inode bitmap.
+//
+// A set bit means the dinode is in use.  It is built from the inodefile
+// by imapinit() and kept up to date by create_inode() and
+// delete_inode(), so finding a free dinode needs no disk reads.
+// imap_hint is at or below the lowest free inum.  Inums past NIMAP are
+// not tracked and are found by reading the inodefile.
+#define NIMAP 32768
+
+static uchar imap[NIMAP / 8];
+static uint imap_hint;
+
+static void imap_set(uint inum, int used) {
+  if (inum >= NIMAP)
+    return;
+  if (used)
+    imap[inum / 8] |= 1 << (inum % 8);
+  else
+    imap[inum / 8] &= ~(1 << (inum % 8));
+}
+
+// Most bytes of dinodes or dirents scans copy onto the stack at a
+// time: a whole block, unless blocks are too big for a kernel stack.
+// BSIZE is a multiple of it, so a piece never spans two blocks.
+#define SCANSIZE 512
+
+// Fill in the bitmap from the inodefile, SCANSIZE bytes of dinodes at
+// a time.
+static void imapinit(void) {
+  struct dinode dins[SCANSIZE / sizeof(struct dinode)];
+  uint ninodes, inum, i, n;
+
+  locki(&icache.inodefile);
+  ninodes = icache.inodefile.size / sizeof(struct dinode);
+  for (inum = 0; inum < ninodes; inum += n) {
+    n = min(ninodes - inum, (uint)NELEM(dins));
+    readi(&icache.inodefile, (char *)dins, INODEOFF(inum), n * sizeof(struct dinode));
+    for (i = 0; i < n; i++)
+      imap_set(inum + i, dins[i].used != DINODE_AVAIL);
+  }
+  unlocki(&icache.inodefile);
+}
+
+// Claim the lowest free dinode among the ninodes in the inodefile.
+// Returns ninodes if they are all in use; the caller then appends a
+// dinode to the inodefile.
+static uint ialloc_inum(uint ninodes) {
+  struct dinode din;
+  uint inum, end;
+
+  acquire(&icache.lock);
+  end = min(ninodes, (uint)NIMAP);
+  for (inum = min(imap_hint, end); inum < end; inum++) {
+    if (inum % 8 == 0 && inum + 8 <= end && imap[inum / 8] == 0xff) {
+      inum += 7; // whole byte in use
+      continue;
+    }
+    if ((imap[inum / 8] & (1 << (inum % 8))) == 0)
+      break;
+  }
+  if (inum == end && end < NIMAP)
+    inum = ninodes;
+  imap_set(inum, 1);
+  imap_hint = inum + 1;
+  release(&icache.lock);
+
+  // Untracked inums: look at the dinodes themselves.
+  if (inum >= NIMAP) {
+    for (inum = NIMAP; inum < ninodes; inum++) {
+      read_dinode(inum, &din);
+      if (din.used == DINODE_AVAIL)
+        break;
+    }
+  }
+  return inum;
+}
+
+// Return a dinode to the free-inode bitmap.
+static void ifree_inum(uint inum) {
+  acquire(&icache.lock);
+  imap_set(inum, 0);
+  if (inum < imap_hint)
+    imap_hint = inum;
+  release(&icache.lock);
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not read
 // the inode from from disk.
 static struct inode *iget(uint dev, uint inum) {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  uint h;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
-    if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
+  h = ihash(dev, inum);
+  for (ip = icache.hash[h]; ip; ip = ip->hnext) {
+    if (ip->dev == dev && ip->inum == inum) {
+      if (ip->ref == 0)
+        ilruremove(ip);
       ip->ref++;
+      icache_hits++;
       release(&icache.lock);
       return ip;
     }
-    if (empty == 0 && ip->ref == 0) // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if (empty == 0)
+  // Recycle the least recently used inode cache entry.
+  ip = icache.lru.lprev;
+  if (ip == &icache.lru)
     panic("iget: no inodes");
+  ilruremove(ip);
+  if (ip->hashed) {
+    for (pp = &icache.hash[ihash(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+      ;
+    *pp = ip->hnext;
+  }
 
-  ip = empty;
   ip->ref = 1;
   ip->valid = 0;
+  ip->logseq = 0;
   ip->dev = dev;
   ip->inum = inum;
+  ip->hnext = icache.hash[h];
+  ip->hashed = 1;
+  icache.hash[h] = ip;
+  icache_misses++;
 
   release(&icache.lock);
 
@@ -260,14 +1265,14 @@ struct inode *idup(struct inode *ip) {
 // be recycled.
 void irelease(struct inode *ip) {
   acquire(&icache.lock);
-  // inode has no other references release
+  // inode has no other references; keep it cached for reuse
   if (ip->ref == 1)
-    ip->type = 0;
+    ilruinsert(ip);
   ip->ref--;
   release(&icache.lock);
 }
 
-// Lock the given inode.
+// Lock the given inode exclusively.
 // Reads the inode from disk if necessary.
 void locki(struct inode *ip) {
   struct dinode dip;
@@ -275,7 +1280,7 @@ void locki(struct inode *ip) {
   if(ip == 0 || ip->ref < 1)
     panic("locki");
 
-  acquiresleep(&ip->lock);
+  acquiresleep_write(&ip->lock);
 
   if (ip->valid == 0) {
 
@@ -297,6 +1302,8 @@ void locki(struct inode *ip) {
     // New: update the num_extents and used fields
     ip->num_extents = dip.num_extents;
     ip->used = dip.used;
+    ip->indirect = dip.indirect;
+    iindex(ip);
 
     ip->valid = 1;
 
@@ -306,18 +1313,33 @@ void locki(struct inode *ip) {
   
 }
 
-// Unlock the given inode.
+// Lock the given inode shared, for callers that only read it.
+// Loading the inode from disk takes the lock exclusively first.
+void locki_shared(struct inode *ip) {
+  if(ip == 0 || ip->ref < 1)
+    panic("locki_shared");
+
+  acquiresleep_read(&ip->lock);
+  while (ip->valid == 0) {
+    releaserwsleep(&ip->lock);
+    locki(ip);
+    releaserwsleep(&ip->lock);
+    acquiresleep_read(&ip->lock);
+  }
+}
+
+// Unlock the given inode, held either way.
 void unlocki(struct inode *ip) {
-  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+  if(ip == 0 || !holdingrwsleep(&ip->lock) || ip->ref < 1)
     panic("unlocki");
 
-  releasesleep(&ip->lock);
+  releaserwsleep(&ip->lock);
 
 }
 
 // threadsafe stati.
 void concurrent_stati(struct inode *ip, struct stat *st) {
-  locki(ip);
+  locki_shared(ip);
   stati(ip, st);
   unlocki(ip);
 }
@@ -325,7 +1347,7 @@ void concurrent_stati(struct inode *ip, struct stat *st) {
 // Copy stat information from inode.
 // Caller must hold ip->lock.
 void stati(struct inode *ip, struct stat *st) {
-  if (!holdingsleep(&ip->lock))
+  if (!holdingrwsleep(&ip->lock))
     panic("not holding lock");
 
   st->dev = ip->dev;
@@ -338,26 +1360,43 @@ void stati(struct inode *ip, struct stat *st) {
 int concurrent_readi(struct inode *ip, char *dst, uint off, uint n) {
   int retval;
 
-  locki(ip);
+  locki_shared(ip);
   retval = readi(ip, dst, off, n);
   unlocki(ip);
 
   return retval;
 }
 
-// Read data from inode.
-// Returns number of bytes read.
-// Caller must hold ip->lock.
-int readi(struct inode *ip, char *dst, uint off, uint n) {
-  if (!holdingsleep(&ip->lock))
-    panic("not holding lock");
+// Read or write device ip.  Drivers may copy to or from user memory
+// while holding a spinlock, so the caller's pages are faulted in for
+// the access first and stay in memory across the call.
+static int devrw(struct inode *ip, char *buf, uint n, int write) {
+  struct proc *p = myproc();
+  int r;
+
+  if (p)
+    vspacepin(&p->group->vspace, buf, n, !write);
+  if (write)
+    r = devsw[ip->devid].write(ip, buf, n);
+  else
+    r = devsw[ip->devid].read(ip, buf, n);
+  if (p)
+    vspaceunpin(&p->group->vspace);
+  return r;
+}
 
-  if (ip->type == T_DEV) {
-    if (ip->devid < 0 || ip->devid >= NDEV || !devsw[ip->devid].read)
-      return -1;
-    return devsw[ip->devid].read(ip, dst, n);
-  }
+// Is ip's data file data, read through the page cache, rather than
+// metadata kept in the buffer cache?
+static int filedata(struct inode *ip) {
+  return ip->type == T_FILE && ip != &icache.inodefile;
+}
+
+// What a block of a hole reads as
+static char zeroblock[BSIZE];
 
+// Read up to n bytes of ip at off from its blocks, releasing them to
+// the cold end of the buffer cache if cold is set.
+static int readblocks(struct inode *ip, char *dst, uint off, uint n, int cold) {
   // Check parameters
   if (off > ip->size || off + n < off)
     return -1;
@@ -366,40 +1405,158 @@ int readi(struct inode *ip, char *dst, uint off, uint n) {
   if (off + n > ip->size)
     n = ip->size - off;
 
+  if (ip->used & DINODE_INLINE) {
+    memmove(dst, (char *)ip->extent_array + off, n);
+    return n;
+  }
+
   uint bytes_read = 0;
-  // Iterate through extents and read as much
-  // bytes as possible from the offset
-  uint off_blk = off / BSIZE;
-  uint file_blk_no = 0;
-  for (int ext = 0; ext < ip->num_extents; ext++) {
-    for (int blk = ip->extent_array[ext].startblkno; blk < ip->extent_array[ext].startblkno + ip->extent_array[ext].nblocks; blk++) {
-      // Continue until you find the right offset block
-      if (file_blk_no != off_blk) {
-        file_blk_no++;
-        continue;
-      }
+  // Read block runs, extent by extent, starting at the offset
+  while (n > 0) {
+    uint run;
+    uint blk = bmap(ip, off / BSIZE, &run);
+    if (run == 0)
+      break;
+
+    for (; run > 0 && n > 0; run--) {
       uint bytes_to_read = min(BSIZE - (off % BSIZE), n);
-      struct buf* blk_buff = bread(ip->dev, blk); // Read the blk block into buffer
-      memmove(dst, (char*) &blk_buff->data + (off % BSIZE), bytes_to_read);
-      brelse(blk_buff); // Release block
+      if (blk == 0) {
+        // A hole reads as zeros
+        memset(dst, 0, bytes_to_read);
+      } else {
+        struct buf* blk_buff = bread(ip->dev, blk++); // Read the blk block into buffer
+        memmove(dst, (char*) blk_buff->data + (off % BSIZE), bytes_to_read);
+        if (cold)
+          brelse_cold(blk_buff);
+        else
+          brelse(blk_buff); // Release block
+      }
 
       // Update off and n
       n -= bytes_to_read;
       bytes_read += bytes_to_read;
       off += bytes_to_read;
       dst += bytes_to_read;
-      // Break early if necessary
-      if (n == 0) {
-        break;
-      }
-
-      off_blk++;
-      file_blk_no++;
     }
   }
   return bytes_read;
 }
 
+// Read ip's data from its blocks, bypassing the page cache, which
+// uses this to fill its pages.  Caller must hold ip->lock.
+int readiraw(struct inode *ip, char *dst, uint off, uint n) {
+  return readblocks(ip, dst, off, n, 1);
+}
+
+// Read data from inode.
+// Returns number of bytes read.
+// Caller must hold ip->lock.
+int readi(struct inode *ip, char *dst, uint off, uint n) {
+  if (!holdingrwsleep(&ip->lock))
+    panic("not holding lock");
+
+  if (ip->type == T_DEV) {
+    if (ip->devid < 0 || ip->devid >= NDEV || !devsw[ip->devid].read)
+      return -1;
+    return devrw(ip, dst, n, 0);
+  }
+
+  // An inline file is in the inode already
+  if (!filedata(ip) || (ip->used & DINODE_INLINE))
+    return readblocks(ip, dst, off, n, 0);
+  if (off > ip->size || off + n < off)
+    return -1;
+  return pcacheread(ip, dst, off, min(n, ip->size - off));
+}
+
+// Hand fn the n bytes of ip's data at off, or as many of them as lie
+// in the file and in off's page, straight out of the page cache, or
+// its block, out of the buffer cache, if there is no memory for the
+// page.  Returns what fn returns, or 0 at the end of the file.
+// Caller must hold ip->lock.
+int readiblock(struct inode *ip, uint off, uint n,
+               int (*fn)(char *, int, void *), void *arg) {
+  struct buf *b;
+  uint blk, run;
+  int r;
+
+  if (!holdingrwsleep(&ip->lock))
+    panic("not holding lock");
+  if (ip->type == T_DEV || off >= ip->size)
+    return 0;
+
+  n = min(n, ip->size - off);
+  if (ip->used & DINODE_INLINE)
+    return fn((char *)ip->extent_array + off, n, arg);
+  if (filedata(ip) && (r = pcacheapply(ip, off, n, fn, arg)) != -1)
+    return r;
+  n = min(n, BSIZE - off % BSIZE);
+  blk = bmap(ip, off / BSIZE, &run);
+  if (run == 0)
+    return 0;
+  if (blk == 0)
+    return fn(zeroblock + off % BSIZE, n, arg);
+  b = bread(ip->dev, blk);
+  r = fn((char *)b->data + off % BSIZE, n, arg);
+  brelse(b);
+  return r;
+}
+
+// Read into the cnt buffers of iov, one after the other, from off.
+// Stops at the first buffer that can't be filled, which for a device
+// is the first that gets less than it asked for.
+// Returns number of bytes read, or -1 if nothing could be.
+// Caller must hold ip->lock.
+int readiv(struct inode *ip, struct iovec *iov, int cnt, uint off) {
+  int i, r, n;
+
+  n = 0;
+  for (i = 0; i < cnt; i++) {
+    if ((r = readi(ip, iov[i].iov_base, off + n, iov[i].iov_len)) < 0)
+      return n ? n : -1;
+    n += r;
+    if (r != iov[i].iov_len)
+      break;
+  }
+  return n;
+}
+
+// Start asynchronous reads of file blocks [blk, blk + nblk) that are
+// not yet in the page or buffer cache, following the extents in order
+// and stopping at the end of the file.
+// Caller must hold ip->lock.
+void readahead(struct inode *ip, uint blk, uint nblk) {
+  uint fileblks, end, run, b;
+
+  if (!holdingrwsleep(&ip->lock))
+    panic("not holding lock");
+  if (ip->type == T_DEV)
+    return;
+
+  fileblks = (ip->size + BSIZE - 1) / BSIZE;
+  end = min(blk + nblk, fileblks);
+
+  while (blk < end) {
+    b = bmap(ip, blk, &run);
+    if (run == 0)
+      break;
+    if (b == 0) {
+      blk += run; // nothing to read in a hole
+      continue;
+    }
+    for (; run > 0 && blk < end; run--, blk++, b++)
+      if (!filedata(ip) || !pcached(ip, (uint64_t)blk * BSIZE / PGSIZE))
+        bprefetch(ip->dev, b);
+  }
+}
+
+// threadsafe readahead.
+void concurrent_readahead(struct inode *ip, uint blk, uint nblk) {
+  locki_shared(ip);
+  readahead(ip, blk, nblk);
+  unlocki(ip);
+}
+
 // threadsafe writei.
 int concurrent_writei(struct inode *ip, char *src, uint off, uint n) {
   int retval;
@@ -415,11 +1572,106 @@ int concurrent_writei(struct inode *ip, char *src, uint off, uint n) {
 // Returns number of bytes written.
 // Caller must hold ip->lock.
 int writei(struct inode *ip, char *src, uint off, uint n) {
-  // writei is just a raw_writei wrapped around a transaction
-  log_begin_tx();
-  int bytes_written = raw_writei(ip, src, off, n);
-  log_commit();
+  struct iovec iov = {src, n};
+
+  return writeiv(ip, &iov, 1, off);
+}
+
+// Filling a hole or breaking the sharing of a run of blocks logs up
+// to REMAPBLOCKS blocks besides the data: share counts, bitmap blocks,
+// and the tree blocks that splitting the extent at both ends touches.
+// One transaction of a write remaps at most MAXREMAPS runs.
+#define REMAPBLOCKS 20
+#define MAXREMAPS 2
+
+// Whether writes to ip may have to remap blocks.
+static int iremaps(struct inode *ip) {
+  return (ip->used & (DINODE_SHARED | DINODE_HOLES)) != 0;
+}
 
+// How many of the max bytes at off one transaction of a write to ip
+// may take, so that it remaps at most MAXREMAPS runs of blocks.
+static uint remaplimit(struct inode *ip, uint off, uint max) {
+  uint fblk = off / BSIZE, blk, run, shared;
+  int nruns = 0;
+
+  for (;;) {
+    blk = bmap(ip, fblk, &run);
+    if (run == 0)
+      return max;
+    if (blk == 0) {
+      if (++nruns > MAXREMAPS)
+        return fblk * BSIZE - off;
+      fblk += run;
+    } else if (ip->used & DINODE_SHARED) {
+      shared = brefget(ip->dev, blk) > 0;
+      if (shared && ++nruns > MAXREMAPS)
+        return fblk * BSIZE - off;
+      fblk += brefrun(ip->dev, blk, run, shared);
+    } else {
+      fblk += run;
+    }
+    if ((uint64_t)fblk * BSIZE >= (uint64_t)off + max)
+      return max;
+  }
+}
+
+// Write the cnt buffers of iov to ip, one after the other from off.
+// Returns number of bytes written, or -1 if nothing could be.
+// Caller must hold ip->lock.
+int writeiv(struct inode *ip, struct iovec *iov, int cnt, uint off) {
+  // This is raw_writei wrapped in transactions, one for every chunk
+  // bytes however many buffers they come from.  Each chunk touches at
+  // most MAXWRITEBLOCKS data blocks; it may also log a bitmap block,
+  // the two blocks the dinode can straddle, an extent tree leaf and
+  // index block along with the bitmap blocks that allocate them, and
+  // the first block of a file moving out of its dinode, and the two
+  // blocks a hole before the data may add to the tree.  A chunk of a
+  // file that shares blocks or has holes may also remap some.
+  uint chunk = (MAXWRITEBLOCKS - 1) * BSIZE, txmax;
+  int nblocks;
+  uint bytes_written = 0, intx, n1;
+  uint64_t done = 0; // of iov[i]
+  int i = 0, r = 0;
+
+  if (off > ip->size && igap(ip, off) < 0)
+    return -1;
+
+  while (i < cnt && r >= 0) {
+    nblocks = MAXWRITEBLOCKS + 10;
+    if (iremaps(ip))
+      nblocks += MAXREMAPS * REMAPBLOCKS;
+    log_begin_tx(nblocks);
+    ip->logseq = log_txseq();
+    txmax = chunk;
+    if (iremaps(ip))
+      txmax = remaplimit(ip, off + bytes_written, chunk);
+    for (intx = 0; i < cnt && intx < txmax;) {
+      n1 = min(iov[i].iov_len - done, (uint64_t)(txmax - intx));
+      if (n1 > 0) {
+        r = raw_writei(ip, (char *)iov[i].iov_base + done, off + bytes_written, n1);
+        if (r < 0)
+          break;
+        bytes_written += r;
+        intx += r;
+        done += r;
+        if (r != n1) {
+          r = -1; // short write; stop here
+          break;
+        }
+      }
+      if (done == iov[i].iov_len) {
+        i++;
+        done = 0;
+      }
+    }
+    log_end_tx(nblocks);
+  }
+  if (bytes_written == 0 && r < 0)
+    return -1;
+
+  // Mapped pages of the file see the new data
+  pcacheupdate(ip, off, bytes_written);
   return bytes_written;
 }
 
@@ -427,34 +1679,167 @@ int writei(struct inode *ip, char *src, uint off, uint n) {
 
 int namecmp(const char *s, const char *t) { return strncmp(s, t, DIRSIZ); }
 
-struct inode *rootlookup(char *name) {
-  return dirlookup(namei("/"), name, 0);
+struct inode *rootlookup(char *name) {
+  return dirlookup(namei("/"), name, 0);
+}
+
+// The name cache remembers the result of recent directory lookups,
+// keyed on (dev, parent inum, name), so a path walk can skip the
+// directory scan.  A negative entry (inum 0) records that a name is
+// missing.  The table is set associative: a name hashes to a set of
+// DCWAYS entries and replaces the least recently used one.
+// create_inode() and delete_inode() keep it in step with the disk.
+#define NDCSET 64
+#define DCWAYS 4
+
+int dcache_hits;
+int dcache_misses;
+
+struct dcentry {
+  uint dev;
+  uint parent;   // inum of the directory holding the entry
+  uint inum;     // 0 if the name is known not to exist
+  uint used;     // dcache.clock at the last lookup
+  char name[DIRSIZ];
+};
+
+struct {
+  struct spinlock lock;
+  uint clock;
+  struct dcentry set[NDCSET][DCWAYS];
+} dcache;
+
+static void dcacheinit(void) { initlock(&dcache.lock, "dcache"); }
+
+static struct dcentry *dchash(uint dev, uint parent, char *name) {
+  uint h;
+  int i;
+
+  h = dev * 31 + parent;
+  for (i = 0; i < DIRSIZ && name[i]; i++)
+    h = h * 31 + (uchar)name[i];
+  return dcache.set[h % NDCSET];
+}
+
+// Find name in parent's cached entries.  Caller must hold dcache.lock.
+static struct dcentry *dcfind(uint dev, uint parent, char *name) {
+  struct dcentry *set, *e;
+
+  set = dchash(dev, parent, name);
+  for (e = set; e < set + DCWAYS; e++)
+    if (e->used && e->dev == dev && e->parent == parent && namecmp(e->name, name) == 0)
+      return e;
+  return 0;
+}
+
+// Look up name in directory parent.  Returns 1 and sets *inum
+// (0 for a negative entry) on a hit, 0 on a miss.
+static int dcache_lookup(uint dev, uint parent, char *name, uint *inum) {
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  if ((e = dcfind(dev, parent, name)) != 0) {
+    e->used = ++dcache.clock;
+    *inum = e->inum;
+    dcache_hits++;
+    release(&dcache.lock);
+    return 1;
+  }
+  dcache_misses++;
+  release(&dcache.lock);
+  return 0;
+}
+
+// Remember that name in parent refers to inum (0 if missing).
+static void dcache_enter(uint dev, uint parent, char *name, uint inum) {
+  struct dcentry *set, *e, *victim;
+
+  acquire(&dcache.lock);
+  if ((victim = dcfind(dev, parent, name)) == 0) {
+    set = victim = dchash(dev, parent, name);
+    for (e = set; e < set + DCWAYS; e++)
+      if (e->used < victim->used)
+        victim = e;
+  }
+  victim->dev = dev;
+  victim->parent = parent;
+  victim->inum = inum;
+  victim->used = ++dcache.clock;
+  strncpy(victim->name, name, DIRSIZ);
+  release(&dcache.lock);
+}
+
+// Drop the entry for name in parent, if cached.
+static void dcache_forget(uint dev, uint parent, char *name) {
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  if ((e = dcfind(dev, parent, name)) != 0)
+    e->used = 0;
+  release(&dcache.lock);
+}
+
+// Drop every entry that names inode inum.
+static void dcache_forget_inum(uint dev, uint inum) {
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  for (e = &dcache.set[0][0]; e < &dcache.set[NDCSET][0]; e++)
+    if (e->used && e->dev == dev && e->inum == inum)
+      e->used = 0;
+  release(&dcache.lock);
+}
+
+// Scan directory dp from byte offset off, SCANSIZE bytes of entries
+// per readi(), for the first entry named name, or if name is 0, the first
+// entry with the given inum (inum 0 finds a free slot).
+// Returns the entry's inum and sets *poff to its offset, or returns -1.
+// Caller must hold dp->lock.
+static int dirscan(struct inode *dp, char *name, uint inum, uint off, uint *poff) {
+  struct dirent des[SCANSIZE / sizeof(struct dirent)];
+  uint n, i;
+
+  for (; off < dp->size; off += n * sizeof(struct dirent)) {
+    // Read up to the end of the block holding off
+    n = min(dp->size - off, SCANSIZE - off % SCANSIZE) / sizeof(struct dirent);
+    if (n == 0)
+      break;
+    if (readi(dp, (char *)des, off, n * sizeof(struct dirent)) != n * sizeof(struct dirent))
+      panic("dirlink read");
+    for (i = 0; i < n; i++) {
+      if (name ? (des[i].inum != 0 && namecmp(name, des[i].name) == 0)
+               : des[i].inum == inum) {
+        *poff = off + i * sizeof(struct dirent);
+        return des[i].inum;
+      }
+    }
+  }
+  return -1;
 }
 
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode *dirlookup(struct inode *dp, char *name, uint *poff) {
-  uint off, inum;
-  struct dirent de;
+  uint off;
+  int inum;
 
   if (dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for (off = 0; off < dp->size; off += sizeof(de)) {
-    if (readi(dp, (char *)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if (de.inum == 0)
-      continue;
-    if (namecmp(name, de.name) == 0) {
-      // entry matches path element
-      if (poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
-    }
-  }
+  // Callers that need the offset must scan
+  if (poff == 0 && dcache_lookup(dp->dev, dp->inum, name, (uint *)&inum))
+    return inum ? iget(dp->dev, inum) : 0;
 
-  return 0;
+  inum = dirscan(dp, name, 0, 0, &off);
+  if (poff == 0)
+    dcache_enter(dp->dev, dp->inum, name, inum < 0 ? 0 : inum);
+  if (inum < 0)
+    return 0;
+
+  // entry matches path element
+  if (poff)
+    *poff = off;
+  return iget(dp->dev, inum);
 }
 
 // Paths
@@ -494,20 +1879,33 @@ static char *skipelem(char *path, char *name) {
   return path;
 }
 
-// Look up and return the inode for a path name.
+// Look up and return the inode for a path name, which starts from
+// directory dp if it is relative and dp is not 0, or else the root.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
 // Must be called inside a transaction since it calls iput().
-static struct inode *namex(char *path, int nameiparent, char *name) {
+static struct inode *namex(struct inode *dp, char *path, int nameiparent, char *name) {
   struct inode *ip, *next;
+  uint inum;
 
-  if (*path == '/')
+  if (*path == '/' || !dp)
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(namei("/"));
+    ip = idup(dp);
 
   while ((path = skipelem(path, name)) != 0) {
-    locki(ip);
+    // Only directories have cached entries, so a hit needs no lock
+    if (!(nameiparent && *path == '\0') &&
+        dcache_lookup(ip->dev, ip->inum, name, &inum)) {
+      if (inum == 0)
+        goto notfound;
+      next = iget(ip->dev, inum);
+      irelease(ip);
+      ip = next;
+      continue;
+    }
+
+    locki_shared(ip);
     if (ip->type != T_DIR) {
       unlocki(ip);
       goto notfound;
@@ -540,62 +1938,44 @@ notfound:
 
 struct inode *namei(char *path) {
   char name[DIRSIZ];
-  return namex(path, 0, name);
+  return namex(0, path, 0, name);
+}
+
+// The inode for path, relative to directory dp.
+struct inode *nameiat(struct inode *dp, char *path) {
+  char name[DIRSIZ];
+  return namex(dp, path, 0, name);
 }
 
 struct inode *nameiparent(char *path, char *name) {
-  return namex(path, 1, name);
+  return namex(0, path, 1, name);
 }
 
 // Create new inode, modify the root directory, and return a new 
 // inode ptr to it.
 struct inode* create_inode(char* name) {
-  log_begin_tx();
+  log_begin_tx(MAXOPBLOCKS);
 
-  struct inode* inodefile_inode = &icache.inodefile;
-  struct dinode din;
   struct inode* new_inode = NULL;
 
-  // Need to find an empty inode in the inodefile
-  for (int i = 0; i < inodefile_inode->size / sizeof(struct dinode); i++) {
-    read_dinode(i, &din);
-    if (din.used == DINODE_AVAIL) {
-      // We found an empty inode, so we need to populate it with real values now
-      struct dinode new_dinode;
-      new_dinode.devid = icache.inodefile.devid;
-      new_dinode.type = icache.inodefile.type;
-      new_dinode.num_extents = 0;
-      new_dinode.size = 0;
-      new_dinode.used = DINODE_USED;
-      concurrent_raw_writei(&icache.inodefile, (char*) &new_dinode, INODEOFF(i), sizeof(struct dinode));
-      new_inode = iget(ROOTDEV, i);
-      locki(new_inode);
-
-
-      break;
-    }
-  }
-
-  // In the case where the inodefile is full, we must append it 
-  // to make more inodes
-  if (new_inode == NULL) {
-    // We need to append a dinode to the inodefile
-    struct dinode new_dinode;
-    new_dinode.devid = icache.inodefile.devid;
-    new_dinode.type = icache.inodefile.type;
-    new_dinode.num_extents = 0;
-    new_dinode.size = 0;
-    new_dinode.used = DINODE_USED;
-
-    int num_inodes = icache.inodefile.size / sizeof(struct dinode);
-
-    // We need to append the new dinode to the inodefile
-    concurrent_raw_writei(&icache.inodefile, (char*) &new_dinode, icache.inodefile.size, sizeof(struct dinode));
+  // Take the lowest free dinode, or append one to the inodefile
+  int inum = ialloc_inum(icache.inodefile.size / sizeof(struct dinode));
 
-    // Get the new inode
-    new_inode = iget(ROOTDEV, num_inodes);
-    locki(new_inode);
-  }
+  // Populate it with real values now
+  struct dinode new_dinode;
+  memset(&new_dinode, 0, sizeof(new_dinode));
+  new_dinode.devid = icache.inodefile.devid;
+  new_dinode.type = icache.inodefile.type;
+  new_dinode.num_extents = 0;
+  new_dinode.size = 0;
+  new_dinode.used = DINODE_USED | DINODE_INLINE;
+  new_dinode.indirect = 0;
+  concurrent_raw_writei(&icache.inodefile, (char*) &new_dinode, INODEOFF(inum), sizeof(struct dinode));
+
+  // Get the new inode
+  new_inode = iget(ROOTDEV, inum);
+  locki(new_inode);
+  new_inode->logseq = log_txseq();
 
   // Get the root inode
   struct inode* root_inode = iget(ROOTDEV, 1);
@@ -605,59 +1985,48 @@ struct inode* create_inode(char* name) {
   new_entry.inum = new_inode->inum;
   memmove(&new_entry.name, name, strlen(name) + 1);
 
-  // Need to find an empty entry in the root directory
-  bool found_entry = false;
-  struct dirent de;
-  for (int i = 0; i < root_inode->size / sizeof(struct dirent); i++) {
-    if (concurrent_readi(root_inode, (char*)&de, i * sizeof(struct dirent), sizeof(struct dirent)) != sizeof(struct dirent)) {
-      panic("could not read root directory");
-    }
-
-    // If we find an empty entry, then we can simply update the root directory in-place
-    if (de.inum == 0) {
-      concurrent_raw_writei(root_inode, (char*) &new_entry, i * sizeof(struct dirent), sizeof(struct dirent));
-      found_entry = true;
-      break;
-    }
-  }
-
-  // If we didn't find an entry, then append new entry to root inode
-  if (!found_entry) {
-    concurrent_raw_writei(root_inode, (char*) &new_entry, root_inode->size, sizeof(struct dirent));
-  }
+  // Need to find an empty entry in the root directory. If we find
+  // one, then we can simply update the root directory in-place;
+  // otherwise append new entry to root inode
+  uint off;
+  locki(root_inode);
+  if (dirscan(root_inode, 0, 0, 0, &off) < 0)
+    off = root_inode->size;
+  raw_writei(root_inode, (char*) &new_entry, off, sizeof(struct dirent));
+  dcache_forget(root_inode->dev, root_inode->inum, name);
+  unlocki(root_inode);
  
   // Unlock and release
   unlocki(new_inode);
   irelease(root_inode);
 
-  log_commit();
+  log_end_tx(MAXOPBLOCKS);
 
   return new_inode;
 }
 
-// Function for deleting an inode
+// Remove ip and its root directory entry, freeing its dinode and
+// blocks, in a single transaction: the entry's block, the two blocks
+// the dinode can straddle and each bitmap and share count block at
+// most once.
 void delete_inode(struct inode* ip) {
+  log_begin_tx(NBITMAP + sb.nref + 3);
+
   // First, we should lock the root directory and the file to prevent access to the file
   struct inode* root_inode = iget(ROOTDEV, 1);
   locki(root_inode);
   locki(ip);
 
-  // Need to find entry to delete in root directory
+  // Erase its entry; the root directory holds one per file.
   uint off;
-  struct dirent de;
-  for (off = 0; off < root_inode->size; off += sizeof(de)) {
-    if (readi(root_inode, (char *)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if (de.inum == 0)
-      continue;
-    if (de.inum == ip->inum) {
-      // We need to erase this entry from the root directory, and push these changes to 
-      // disk
-      struct dirent erase_entry;
-      erase_entry.inum = 0;
-      writei(root_inode, (char*) &erase_entry, off, sizeof(struct dirent));
-    }
+  if (dirscan(root_inode, 0, ip->inum, 0, &off) >= 0) {
+    struct dirent erase_entry;
+    memset(&erase_entry, 0, sizeof(erase_entry));
+    raw_writei(root_inode, (char*) &erase_entry, off, sizeof(struct dirent));
+    root_inode->logseq = log_txseq();
   }
+  dcache_forget_inum(ip->dev, ip->inum);
+  pcacheforget(ip);
 
   // Update the inodefile to have an invalid dinode
   struct dinode new_dinode;
@@ -666,147 +2035,601 @@ void delete_inode(struct inode* ip) {
   new_dinode.num_extents = 1234;
   new_dinode.size = 1234;
   new_dinode.used = DINODE_AVAIL;
+  new_dinode.indirect = 0;
 
-  concurrent_writei(&icache.inodefile, (char*) &new_dinode, INODEOFF(ip->inum), sizeof(struct dinode));
+  concurrent_raw_writei(&icache.inodefile, (char*) &new_dinode, INODEOFF(ip->inum), sizeof(struct dinode));
+  ifree_inum(ip->inum);
 
   // We should also free the data blocks pointed to by the inode. We 
   // can just iterate through all extents and free each one.
-  for (int i = 0 ; i < ip->num_extents; i++) {
-    bfree(ROOTDEV, ip->extent_array[i].startblkno, ip->extent_array[i].nblocks);
-  }  
+  ifreeblocks(ip);
+
+  // The cached copy is stale now; a new file reusing the inum must
+  // read its dinode from disk.
+  ip->valid = 0;
 
   // Unlock and release
   unlocki(ip);
   unlocki(root_inode);
   irelease(ip);
   irelease(root_inode);
+
+  log_end_tx(NBITMAP + sb.nref + 3);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // API Functions for crash-safe transactions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// Begin a transaction on the log
-static void log_begin_tx() {
-  // Read the header block
-  struct buf* log_header_buff = bread(ROOTDEV, sb.logstart);
+// The log collects the blocks written by file system operations and
+// commits them to disk as one transaction.  Concurrent operations join
+// the open transaction, and a block written several times while it is
+// open takes a single log slot.  Logged blocks live in the buffer
+// cache, where B_DIRTY keeps them from being recycled.  The transaction
+// is committed once it is too full to admit another operation, or once
+// it has been open for LOGCOMMITTICKS ticks and the last operation in
+// it ends.
+//
+// Writes are therefore durable only once their transaction commits,
+// up to LOGCOMMITTICKS later.  Each inode remembers the transaction
+// that last logged its blocks, so fsynci() can commit that one early,
+// or return at once if it has committed already.
+//
+// A commit appends the transaction to the ring of log slots (see
+// fs.h), writing its block copies and then its commit records without
+// waiting in between: the records' checksum, not the order the writes
+// land in, tells recovery whether all of it made it.  Committed blocks
+// stay dirty in the cache until they are installed at their real
+// locations (checkpointed), so a block committed several times goes
+// home once.  A checkpoint installs every committed transaction and
+// then moves the log super's start past them; until then
+// log_recover() replays them all.
+//
+// Checkpoints are the flusher kernel thread's job.  It wakes every
+// FLUSHTICKS ticks, or when a commit leaves FLUSHLOW slots committed,
+// and checkpoints once no operation is open if there are that many or
+// the oldest has waited FLUSHAGE ticks; it also commits a transaction
+// that expired with nobody left to end it.  Past FLUSHHIGH committed
+// slots, new operations wait for it.  A commit that leaves the log
+// too full for another transaction still checkpoints itself.
+struct {
+  struct spinlock lock;
+  int outstanding;      // number of operations in the transaction
+  int reserved;         // log blocks reserved by those operations
+  int committing;       // in log_commit(), please wait
+  int forcing;          // fsynci() waits for the transaction to commit
+  uint seq;             // transactions committed so far
+  uint start;           // ticks when the first block was logged
+  int committed;        // disk_loc[0..committed) are committed
+  int size;             // blocks logged so far
+  int disk_loc[LOGSIZE];// real disk locations of the logged blocks
+  int nslot;            // slots in the ring
+  int head;             // slot the next transaction starts at
+  int used;             // slots the committed transactions take
+  uint headseq;         // sequence number the next one is written with
+  uint dirtied;         // ticks when disk_loc[0] was committed
+  int flusher;          // pid of the flusher, once it runs
+} log;
+
+uint64_t log_commits;     // transactions committed, for sysinfo()
+uint64_t log_blocks;      // blocks those commits wrote to the log
+uint64_t log_checkpoints; // times the log was installed and emptied
+
+// Log blocks moved between the disk and the cache at a time.
+#define LOGBATCH 32
+#define RECOVERBATCH 256 // at boot the cache has room for many more
+#define CKBATCH 256      // a checkpoint's blocks are in the cache already
+
+// Committed slots at which the flusher checkpoints, and past which
+// new operations wait for it to.
+#define FLUSHLOW (log.nslot / 4)
+#define FLUSHHIGH (log.nslot * 3 / 4)
+
+#define LOGSUMINIT 2166136261u
+
+// Block number of log slot i, which wraps around the ring.
+#define LOGBLOCK(i) (sb.logstart + 1 + (i) % log.nslot)
+
+static int log_expired() {
+  return log.size > log.committed && ticks - log.start >= LOGCOMMITTICKS;
+}
+
+// Would the ring still hold the open transaction if it grew by n
+// blocks?
+static int log_room(int n) {
+  return log.used + LOGSLOTS(log.size - log.committed + n) <= log.nslot;
+}
 
-  // Reset the header to initial state
-  struct logheader log_header;
-  log_header.size = 0;
-  log_header.valid_flag = TX_INVALID;
-  memmove(&log_header_buff->data, &log_header, sizeof(struct logheader));
+// Is the log too full to admit an operation of MAXOPBLOCKS blocks?
+static int log_full() {
+  return !log_room(MAXOPBLOCKS);
+}
 
-  // Write the header block to disk
-  bwrite(log_header_buff);
-  brelse(log_header_buff);
+// Should the flusher checkpoint the committed blocks?
+static int log_flushable() {
+  return log.used > 0 &&
+         (log.used >= FLUSHLOW || ticks - log.dirtied >= FLUSHAGE);
 }
 
-// Write a data block to the log
-static void log_write(struct buf* buff) {
-  // Read the header block
-  struct buf* log_header_buff = bread(ROOTDEV, sb.logstart);
+// FNV-1a over the words of n bytes at p, continuing from sum.
+static uint logsum(uint sum, void *p, int n) {
+  uint *w = p;
+
+  for (int i = 0; i < n / (int)sizeof(uint); i++)
+    sum = (sum ^ w[i]) * 16777619;
+  return sum;
+}
 
-  struct logheader log_header;
-  memmove(&log_header, &log_header_buff->data, sizeof(struct logheader));
+// Commit the open transaction, with log.committing set by the caller,
+// leaving room for an operation of need blocks.
+static void log_commit_locked(int need) {
+  release(&log.lock);
+  log_commit(need);
+  acquire(&log.lock);
+  log.seq++;
+  log.committing = 0;
+  log.forcing = 0;
+  wakeup(&log);
+  if (log_flushable())
+    wakeup(&log.flusher);
+}
+
+// Begin a file system operation that logs at most nblocks blocks,
+// joining the open transaction.
+// Waits while a commit is in progress, while the log might not have
+// room for nblocks more blocks, or while the flusher is behind.
+static void log_begin_tx(int nblocks) {
+  if (LOGSLOTS(nblocks) > log.nslot)
+    panic("log_begin_tx: operation too big");
+
+  acquire(&log.lock);
+  for (;;) {
+    if (log.committing || log.forcing) {
+      sleep(&log, &log.lock);
+    } else if (log.flusher && log.used > FLUSHHIGH) {
+      // Too much waiting to go home; let the flusher catch up.
+      wakeup(&log.flusher);
+      sleep(&log, &log.lock);
+    } else if (log.outstanding == 0 && (log_expired() || !log_room(nblocks))) {
+      // Nobody else is in the transaction; close it out first.
+      log.committing = 1;
+      log_commit_locked(nblocks);
+    } else if (!log_room(log.reserved + nblocks)) {
+      // This op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding++;
+      log.reserved += nblocks;
+      break;
+    }
+  }
+  release(&log.lock);
+}
 
-  assert(log_header.valid_flag == TX_INVALID);  
-  assert(log_header.size <= 28);
+// End a file system operation that reserved nblocks blocks.  The last
+// operation out commits the transaction if it is full or has been open
+// long enough.
+static void log_end_tx(int nblocks) {
+  acquire(&log.lock);
+  log.outstanding--;
+  log.reserved -= nblocks;
+  if (log.outstanding == 0 && (log_expired() || log_full() || log.forcing)) {
+    log.committing = 1;
+    log_commit_locked(MAXOPBLOCKS);
+  } else {
+    // log_begin_tx() may be waiting for log space, and decrementing
+    // log.reserved has decreased the amount of reserved space.
+    wakeup(&log);
+    if (log.outstanding == 0 && log_flushable())
+      wakeup(&log.flusher);
+  }
+  release(&log.lock);
+}
 
-  // Write data block to log
-  struct buf* data_blk = bread(ROOTDEV, sb.logstart + log_header.size + 1);
-  memmove(&data_blk->data, &buff->data, BSIZE);
-  bwrite(data_blk);
+// Commit the open transaction now, if there is one.
+void log_flush() {
+  acquire(&log.lock);
+  while (log.committing || log.outstanding > 0)
+    sleep(&log, &log.lock);
+  if (log.size > log.committed) {
+    log.committing = 1;
+    log_commit_locked(MAXOPBLOCKS);
+  }
+  release(&log.lock);
+}
 
-  // Update header and write it to disk
-  log_header.disk_loc[log_header.size] = buff->blockno; // The disk location should be in buff
-  log_header.size++;
-  memmove(&log_header_buff->data, &log_header, sizeof(struct logheader));
-  bwrite(log_header_buff);
+// Sequence number the open transaction will commit as.  Only
+// meaningful inside an operation, which keeps it from committing.
+static uint log_txseq() {
+  return log.seq + 1;
+}
 
-  brelse(data_blk);
-  brelse(log_header_buff);
+// Make ip's writes durable: commit the transaction that last logged
+// its blocks if that hasn't happened yet.  Operations still in it are
+// let finish, and new ones wait for the commit.
+void fsynci(struct inode *ip) {
+  acquire(&log.lock);
+  while (ip->logseq > log.seq) {
+    if (log.committing) {
+      sleep(&log, &log.lock);
+    } else if (log.outstanding == 0) {
+      log.committing = 1;
+      log_commit_locked(MAXOPBLOCKS);
+    } else {
+      log.forcing = 1; // the last log_end_tx() commits
+      sleep(&log, &log.lock);
+    }
+  }
+  release(&log.lock);
 }
 
-// Completes the transaction and flushes it to disk
-static void log_commit() {
-  // Read the header block
-  struct buf* log_header_buff = bread(ROOTDEV, sb.logstart);
-  struct logheader log_header;
+// Record that the modified buffer belongs to the open transaction.
+// The block is written to the log at commit time; b stays in the
+// cache until then.
+static void log_write(struct buf* buff) {
+  int i;
 
-  memmove(&log_header, &log_header_buff->data, sizeof(struct logheader));
+  acquire(&log.lock);
+  if (log.outstanding < 1)
+    panic("log_write outside of trans");
 
-  assert(log_header.valid_flag == TX_INVALID);  
-  assert(log_header.size <= 29);
+  // Committed copies in the log must stay as they are, so only
+  // absorb into the open transaction.
+  for (i = log.committed; i < log.size; i++) {
+    if (log.disk_loc[i] == buff->blockno) // log absorption
+      break;
+  }
+  if (i == log.size) {
+    if (!log_room(1))
+      panic("too big a transaction");
+    if (log.size == log.committed)
+      log.start = ticks;
+    log.disk_loc[log.size] = buff->blockno; // The disk location should be in buff
+    log.size++;
+  }
+  buff->flags |= B_DIRTY; // keep it in the cache until installed
+  release(&log.lock);
+}
 
-  // Update flag to VALID and write header to disk
-  log_header.valid_flag = TX_VALID;
-  memmove(&log_header_buff->data, &log_header, sizeof(struct logheader));
-  bwrite(log_header_buff);
-  brelse(log_header_buff);
-  
-  // Reread header, then transfer blocks to right location on disk.
-  log_header_buff = bread(ROOTDEV, sb.logstart);
-  memmove(&log_header, &log_header_buff->data, sizeof(struct logheader));
+// Is log.disk_loc[i] overwritten by a later copy of the same block?
+static int log_superseded(int i) {
+  for (int j = i + 1; j < log.size; j++)
+    if (log.disk_loc[j] == log.disk_loc[i])
+      return 1;
+  return 0;
+}
 
-  assert(log_header.valid_flag == TX_VALID);  
-  assert(log_header.size <= 29);
+// Point the log super at log.head, where the next transaction will
+// be written as log.headseq: everything before it is installed.
+static void log_write_super() {
+  struct logsuper *ls;
+  struct buf *bp;
 
-  // Transfer blocks
-  for (int i = 0; i < log_header.size; i++) {
-    struct buf* data_buff = bread(ROOTDEV, log_header.disk_loc[i]); // The actual disk block
-    struct buf* log_buff = bread(ROOTDEV, sb.logstart + i + 1); // The corresponding block in the log
+  bp = bclaim(ROOTDEV, sb.logstart);
+  memset(bp->data, 0, BSIZE);
+  ls = (struct logsuper *)bp->data;
+  ls->magic = LOGMAGIC;
+  ls->seq = log.headseq;
+  ls->start = log.head;
+  bwrite(bp);
+  brelse(bp);
+}
 
-    // Write to correct disk location
-    memmove(&data_buff->data, &log_buff->data, BSIZE);
-    bwrite(data_buff);
+// Wait for the n writes in bufs and release them.
+static void log_wait(struct buf **bufs, int n) {
+  for (int k = 0; k < n; k++) {
+    bwait(bufs[k]);
+    brelse(bufs[k]);
+  }
+}
 
-    brelse(data_buff);
-    brelse(log_buff);
+// Checksum the n block copies starting at the given slot, as recovery
+// reads them, RECOVERBATCH at a time.
+static uint log_sumcopies(int slot, int n) {
+  static struct buf *bufs[RECOVERBATCH];
+  uint sum;
+  int i, k, m;
+
+  sum = LOGSUMINIT;
+  for (i = 0; i < n; i += m) {
+    m = min(n - i, RECOVERBATCH);
+    ideplug();
+    for (k = 0; k < m; k++)
+      bufs[k] = bread_async(ROOTDEV, LOGBLOCK(slot + i + k));
+    ideunplug();
+    for (k = 0; k < m; k++) {
+      bwait(bufs[k]);
+      sum = logsum(sum, bufs[k]->data, BSIZE);
+      brelse(bufs[k]);
+    }
   }
+  return sum;
+}
 
-  // Complete transaction by setting header flag to INVALID
-  log_header.valid_flag = TX_INVALID;
-  log_header.size = 0;
+// Log slot holding the copy of log.disk_loc[i], for log_install();
+// filled in by log_scan().
+static int copyslot[LOGSIZE];
+
+// Read the transactions to replay into log.disk_loc: from the one the
+// log super names, as long as each has the next sequence number and a
+// checksum that matches its records and copies.  Leaves log.head and
+// log.headseq just past the last of them, and returns how many there
+// were.
+static int log_scan() {
+  struct logsuper *ls;
+  struct logheader *lh;
+  struct buf *bp;
+  uint seq, sum, want;
+  int slot, used, n, nrec, ntx, i, j, e, ok;
+
+  bp = bread(ROOTDEV, sb.logstart);
+  ls = (struct logsuper *)bp->data;
+  if (ls->magic == LOGMAGIC && ls->start < log.nslot) {
+    seq = ls->seq;
+    slot = ls->start;
+  } else {
+    seq = 1; // a fresh file system's log is all zeroes
+    slot = 0;
+  }
+  brelse(bp);
 
-  memmove(&log_header_buff->data, &log_header, sizeof(struct logheader));
-  bwrite(log_header_buff);
+  log.size = 0;
+  used = 0;
+  for (ntx = 0;; ntx++) {
+    bp = bread(ROOTDEV, LOGBLOCK(slot));
+    lh = (struct logheader *)bp->data;
+    n = lh->size;
+    ok = lh->magic == LOGMAGIC && lh->seq == seq && n > 0 &&
+         used + LOGSLOTS(n) <= log.nslot;
+    want = lh->checksum;
+    nrec = ok ? LOGSLOTS(n) - n : 0;
+    for (j = 0; ok && j < nrec; j++) {
+      if (j > 0) {
+        bp = bread(ROOTDEV, LOGBLOCK(slot + j));
+        lh = (struct logheader *)bp->data;
+        ok = lh->magic == LOGMAGIC && lh->seq == seq && lh->size == n;
+      }
+      for (e = 0; ok && e < LOGHDRENTS && j * LOGHDRENTS + e < n; e++) {
+        i = j * LOGHDRENTS + e;
+        log.disk_loc[log.size + i] = lh->disk_loc[e];
+        copyslot[log.size + i] = slot + nrec + i;
+      }
+      brelse(bp);
+      bp = 0;
+    }
+    if (bp)
+      brelse(bp);
+    if (!ok)
+      break;
+    sum = log_sumcopies(slot + nrec, n);
+    sum = logsum(sum, &log.disk_loc[log.size], n * sizeof(log.disk_loc[0]));
+    if (sum != want)
+      break;
+    log.size += n;
+    used += nrec + n;
+    slot = (slot + nrec + n) % log.nslot;
+    seq++;
+  }
+  log.head = slot;
+  log.headseq = seq;
+  return ntx;
+}
 
-  brelse(log_header_buff);
+// Copy the blocks log_scan() found to their real disk locations, for
+// log_recover(), RECOVERBATCH blocks at a time.  A block logged more
+// than once is installed from its last copy only.  The log copies are
+// queued at once with the disk plugged, so they come off it as a few
+// long runs.  Their home blocks are overwritten whole, so they are
+// claimed without being read, and their writes are queued at once the
+// same way, which the disk sorts and merges into runs of adjacent
+// blocks.  Returns the number of blocks installed.
+static int log_install() {
+  static struct buf *log_bufs[RECOVERBATCH], *data_bufs[RECOVERBATCH];
+  static int slot[RECOVERBATCH];
+  int i, k, n, total;
+
+  total = 0;
+  for (i = 0; i < log.size; ) {
+    ideplug();
+    for (n = 0; n < RECOVERBATCH && i < log.size; i++) {
+      if (log_superseded(i))
+        continue;
+      slot[n] = i;
+      log_bufs[n++] = bread_async(ROOTDEV, LOGBLOCK(copyslot[i]));
+    }
+    ideunplug();
+    for (k = 0; k < n; k++)
+      bwait(log_bufs[k]);
+
+    ideplug();
+    for (k = 0; k < n; k++) {
+      data_bufs[k] = bclaim(ROOTDEV, log.disk_loc[slot[k]]);
+      memmove(data_bufs[k]->data, log_bufs[k]->data, BSIZE);
+      bwrite_async(data_bufs[k]);
+      brelse(log_bufs[k]);
+    }
+    ideunplug();
+    log_wait(data_bufs, n);
+    total += n;
+  }
+  return total;
 }
 
-// Read from the log and recover any transactions, if applicable
-static void log_recover() {
-  // Read the header block
-  struct buf* log_header_buff = bread(ROOTDEV, sb.logstart);
-  struct logheader log_header;
+// Sort n block numbers.
+static void sortblocks(int *a, int n) {
+  int gap, i, j, v;
 
-  memmove(&log_header, &log_header_buff->data, sizeof(struct logheader));
+  for (gap = n / 2; gap > 0; gap /= 2)
+    for (i = gap; i < n; i++) {
+      v = a[i];
+      for (j = i; j >= gap && a[j - gap] > v; j -= gap)
+        a[j] = a[j - gap];
+      a[j] = v;
+    }
+}
 
-  // If flag is valid, then need to make the transaction.
-  if (log_header.valid_flag == TX_VALID) {
-    // Transfer blocks
-    for (int i = 0; i < log_header.size; i++) {
-      struct buf* data_buff = bread(ROOTDEV, log_header.disk_loc[i]); // The actual disk block
-      struct buf* log_buff = bread(ROOTDEV, sb.logstart + i + 1); // The corresponding block in the log
+// Install every committed block at its real location, straight from
+// the cache, then empty the log.  Each block goes once, no matter how
+// many times it was committed, and they go in block order, CKBATCH at
+// a time with the disk plugged, so that runs of adjacent blocks are
+// written by single commands.  Caller must have set log.committing.
+static void log_checkpoint() {
+  static int blocks[LOGSIZE];
+  static struct buf *data_bufs[CKBATCH];
+  int i, k, n, nblocks;
+
+  memmove(blocks, log.disk_loc, log.size * sizeof(blocks[0]));
+  sortblocks(blocks, log.size);
+  nblocks = 0;
+  for (i = 0; i < log.size; i++)
+    if (nblocks == 0 || blocks[i] != blocks[nblocks - 1])
+      blocks[nblocks++] = blocks[i];
+
+  for (i = 0; i < nblocks; i += n) {
+    n = min(nblocks - i, CKBATCH);
+    for (k = 0; k < n; k++)
+      data_bufs[k] = bread(ROOTDEV, blocks[i + k]); // Cached copy of the real block
+    ideplug();
+    for (k = 0; k < n; k++)
+      bwrite_async(data_bufs[k]);
+    ideunplug();
+    log_wait(data_bufs, n);
+  }
 
-      // Write to correct disk location
-      memmove(&data_buff->data, &log_buff->data, BSIZE);
-      bwrite(data_buff);
+  // Replay now starts past everything installed.
+  log.size = 0;
+  log.committed = 0;
+  log.used = 0;
+  log_write_super();
+  log_checkpoints++;
+}
 
-      brelse(data_buff);
-      brelse(log_buff);
+// Appends the open transaction to the log and makes it durable, and
+// checkpoints the log if it has no room left for an operation of need
+// blocks.  The copies go first and the commit records last, which need
+// the copies' checksum, but only a full batch is waited for before the
+// next is queued, so a small transaction takes one round trip to the
+// disk.  Caller must have set log.committing.
+static void log_commit(int need) {
+  struct buf *log_bufs[LOGBATCH], *data_buff;
+  struct logheader *lh;
+  int i, j, k, e, n, nrec, *loc;
+  uint sum;
+  uint64_t t0;
+
+  if (log.size > log.committed) {
+    t0 = rdtsc();
+    n = log.size - log.committed;
+    nrec = LOGSLOTS(n) - n;
+    loc = &log.disk_loc[log.committed];
+    sum = LOGSUMINIT;
+    k = 0;
+    for (i = 0; i < n + nrec; i++) {
+      if (k == LOGBATCH) {
+        log_wait(log_bufs, k);
+        k = 0;
+      }
+      if (i < n) {
+        // Copy the cached block into its slot.
+        log_bufs[k] = bclaim(ROOTDEV, LOGBLOCK(log.head + nrec + i));
+        data_buff = bread(ROOTDEV, loc[i]); // Cached copy of the real block
+        memmove(log_bufs[k]->data, data_buff->data, BSIZE);
+        brelse(data_buff);
+        sum = logsum(sum, log_bufs[k]->data, BSIZE);
+      } else {
+        // Commit record j lists its share of the blocks.
+        j = i - n;
+        if (j == 0)
+          sum = logsum(sum, loc, n * sizeof(loc[0]));
+        log_bufs[k] = bclaim(ROOTDEV, LOGBLOCK(log.head + j));
+        memset(log_bufs[k]->data, 0, BSIZE);
+        lh = (struct logheader *)log_bufs[k]->data;
+        lh->magic = LOGMAGIC;
+        lh->seq = log.headseq;
+        lh->size = n;
+        lh->checksum = sum;
+        for (e = 0; e < LOGHDRENTS && j * LOGHDRENTS + e < n; e++)
+          lh->disk_loc[e] = loc[j * LOGHDRENTS + e];
+      }
+      bwrite_async(log_bufs[k++]);
+    }
+    log_wait(log_bufs, k);
+
+    if (log.used == 0)
+      log.dirtied = ticks;
+    log.head = (log.head + nrec + n) % log.nslot;
+    log.headseq++;
+    log.used += nrec + n;
+    log_commits++;
+    log_blocks += n;
+    TRACE(TR_COMMIT, n, rdtsc() - t0);
+    log.committed = log.size;
   }
-    
+
+  if (!log_room(need))
+    log_checkpoint();
+}
+
+// Read from the log and recover any transactions, if applicable
+static void log_recover() {
+  uint64_t t0;
+  int n;
+
+  initlock(&log.lock, "log");
+
+  // The log is nlog blocks long: the log super, then the ring.
+  log.nslot = sb.nlog - 1;
+  if (log.nslot < LOGSLOTS(MAXOPBLOCKS))
+    panic("log_recover: log too small");
+  if (log.nslot > LOGSIZE)
+    panic("log_recover: log too big");
+
+  t0 = nsecs();
+  if (log_scan() > 0) {
+    n = log_install();
+    cprintf("log: recovered %d blocks in %d us\n", n,
+            (int)((nsecs() - t0) / 1000));
   }
 
-  // Complete transaction by setting header flag to INVALID
-  log_header.valid_flag = TX_INVALID;
-  log_header.size = 0;
+  // Replay starts past them from now on.
+  log.size = 0;
+  log_write_super();
+}
 
-  memmove(&log_header_buff->data, &log_header, sizeof(struct logheader));
-  bwrite(log_header_buff);
-  brelse(log_header_buff);
+// The flusher kernel thread: commits transactions that expired with
+// no operation left to end them, and checkpoints committed blocks
+// while the file system is quiet rather than letting them pile up
+// until a commit has to.
+static void log_flusher(void *arg) {
+  struct timer t;
+
+  t.pprev = 0;
+  acquire(&log.lock);
+  log.flusher = myproc()->pid;
+  for (;;) {
+    if (!log.committing && !log.forcing && log.outstanding == 0) {
+      if (log_expired() || (log_flushable() && log.size > log.committed)) {
+        // A checkpoint empties the whole log, so commit first.
+        log.committing = 1;
+        log_commit_locked(MAXOPBLOCKS);
+        continue;
+      }
+      if (log_flushable()) {
+        log.committing = 1;
+        release(&log.lock);
+        log_checkpoint();
+        acquire(&log.lock);
+        log.committing = 0;
+        wakeup(&log);
+        continue;
+      }
+    }
+    acquire(&tickslock);
+    if (!t.pprev)
+      timeradd(&t, FLUSHTICKS, wakeup, &log.flusher);
+    release(&tickslock);
+    sleep(&log.flusher, &log.lock);
+  }
 }
 
 
@@ -823,12 +2646,12 @@ static int concurrent_raw_writei(struct inode *ip, char *src, uint off, uint n)
 // Precondition: You must have called log_start_tx() beforehand, and you should
 // call log_commit() afterwards to actually commit the changes. 
 static int raw_writei(struct inode *ip, char *src, uint off, uint n) {
-  if (!holdingsleep(&ip->lock))
+  if (!holdingrwsleep(&ip->lock))
     panic("not holding lock");
   if (ip->type == T_DEV) {
     if (ip->devid < 0 || ip->devid >= NDEV || !devsw[ip->devid].write)
       return -1;
-    return devsw[ip->devid].write(ip, src, n);
+    return devrw(ip, src, n, 1);
   }
 
   // Check that the parameters are valid
@@ -837,76 +2660,72 @@ static int raw_writei(struct inode *ip, char *src, uint off, uint n) {
   }
 
 
+  // A write that still fits in the dinode goes there
+  if (ip->used & DINODE_INLINE) {
+    if (off + n <= INLINESIZE) {
+      memmove((char *)ip->extent_array + off, src, n);
+      ip->size = max(ip->size, off + n);
+      iupdate(ip);
+      return n;
+    }
+    iuninline(ip);
+  }
+
   uint bytes_written = 0;
   uint orig_off = off;
   uint old_size = ip->size;
-
-  // Case 1: Offset is within extent array. Then we need to write as much
-  // as possible until either reaching end of allocated array or we wrote everything
-  uint off_blk = off / BSIZE;
-  uint file_blk_no = 0;
-  for (int ext = 0; ext < ip->num_extents; ext++) {
-    for (int blk = ip->extent_array[ext].startblkno; blk < ip->extent_array[ext].startblkno + ip->extent_array[ext].nblocks; blk++) {
-      // Continue until you find the right offset block
-      if (file_blk_no != off_blk) {
-        file_blk_no++;
+  int remapped = 0;
+
+  // Write block runs as long as the offset is within the extent array.
+  // Past the end we must allocate more blocks and fill them up with as
+  // many data blocks as needed.
+  while (n > 0) {
+    uint run;
+    uint blk = bmap(ip, off / BSIZE, &run);
+    uint want = (off % BSIZE + n + BSIZE - 1) / BSIZE;
+    if (blk == 0 && run == 0) {
+      // Past the end, skip to off with a hole, then allocate the
+      // blocks to write
+      uint blk_padd = off / BSIZE - ifileblocks(ip);
+      uint nalloc;
+      if (blk_padd > 0) {
+        iappendhole(ip, blk_padd);
         continue;
       }
-      uint space_avail = BSIZE - (off % BSIZE);
-      uint num_to_write = min(space_avail, n);
-      struct buf* blk_buff = bread(ip->dev, blk); // Read the blk block into buffer
-
-      memmove( (char*) &blk_buff->data + (off % BSIZE), src + bytes_written, num_to_write); // Write the data into buffer
-      log_write(blk_buff); // Flush buffer to disk
-      brelse(blk_buff); // Release block
-
-      // Update off and n
-      off += num_to_write;
-      n -= num_to_write;
-      bytes_written += num_to_write;
-
-      // Break early if necessary
-      if (n == 0) {
-        break;
-      }
-
-      off_blk++;
-      file_blk_no++;
+      extend_alloc(ip, want, &nalloc);
+      continue;
     }
-  }
-  
-
-  // Case 2: There is more data to write. We must allocate a new data extent
-  // and fill it up with as many data blocks as needed.
-  if (n > 0) {
-    //cprintf("allocating new extent!\n");
-    // First find padding/data blocks needed
-    int blk_padd = off_blk - file_blk_no;
-    int blk_data = n / BSIZE + 1;
 
-    // Allocate necessary space
-    uint blk_num = balloc(ip->dev, blk_padd + blk_data);
-
-    // Update inode fields
-    ip->num_extents++;
-    if (ip->num_extents == 31) {
-      panic("our file used up all its extents");
+    // Write only to blocks of ip's own, first filling holes and
+    // breaking the sharing of blocks in the way
+    want = min(run, want);
+    if (blk == 0) {
+      remapped = 1; // even if it fails, extents may have been split
+      if (iremap(ip, off / BSIZE, want, off, n) < 0)
+        break;
+      continue;
     }
-    ip->extent_array[ip->num_extents - 1].startblkno = blk_num;
-    ip->extent_array[ip->num_extents - 1].nblocks = blk_padd + blk_data;
-    
-    // Write rest of data to newly allocated extent.
-    for (int blk = blk_num; blk < blk_num + blk_padd + blk_data; blk++) {
-      // Continue until you find the right offset block
-      if (file_blk_no != off_blk) {
-        file_blk_no++;
+    if (ip->used & DINODE_SHARED) {
+      if (brefget(ip->dev, blk) > 0) {
+        remapped = 1;
+        if (iremap(ip, off / BSIZE, brefrun(ip->dev, blk, want, 1), off, n) < 0)
+          break;
         continue;
       }
+      run = brefrun(ip->dev, blk, want, 0);
+    }
 
+    for (; run > 0 && n > 0; run--, blk++) {
       uint space_avail = BSIZE - (off % BSIZE);
       uint num_to_write = min(space_avail, n);
       struct buf* blk_buff = bread(ip->dev, blk); // Read the blk block into buffer
-      memmove( (char*) &blk_buff->data + (off % BSIZE), src + bytes_written, num_to_write); // Write the data into buffer
+
+      // A block wholly past the old end was never written: it is new,
+      // or preallocated by extend_alloc(), and holds whatever it last
+      // held.  Zero what the write leaves of it.
+      if (off / BSIZE >= (old_size + BSIZE - 1) / BSIZE && num_to_write < BSIZE)
+        memset(blk_buff->data, 0, BSIZE);
+      memmove( (char*) blk_buff->data + (off % BSIZE), src + bytes_written, num_to_write); // Write the data into buffer
       log_write(blk_buff); // Flush buffer to disk
       brelse(blk_buff); // Release block
 
@@ -914,33 +2733,51 @@ static int raw_writei(struct inode *ip, char *src, uint off, uint n) {
       off += num_to_write;
       n -= num_to_write;
       bytes_written += num_to_write;
-
-
-      // Break early if necessary
-      if (n == 0) {
-        break;
-      }
-
-      off_blk++;
-      file_blk_no++;
     }
   }
+
   // Verify that n is now 0
   if (n != 0) {
     cprintf("writei: could not write all n bytes");
+    if (remapped)
+      iupdate(ip);
     return -1;
   }
   // Update the size of the inode, if necessary
   ip->size = max(ip->size, orig_off + bytes_written);
 
-  // Stop recursion, if the size is exactly the same
-  if (ip->size == old_size) {
+  // Stop recursion, if the size and blocks are the same
+  if (ip->size == old_size && !remapped) {
 
     return bytes_written;
   }
 
-  // Otherwise, we need to update the inode itself. We can do this recursively.
-  int holding_inodefile_lock = holdingsleep(&icache.inodefile.lock);
+  iupdate(ip);
+  return bytes_written;
+}
+
+// Move the data of ip, an inline file, to a block of its own, ahead
+// of a write that does not fit in the dinode.  Caller must hold
+// ip->lock and be in a transaction.
+static void iuninline(struct inode *ip) {
+  char data[INLINESIZE];
+  uint n = ip->size;
+
+  memmove(data, ip->extent_array, n);
+  memset(ip->extent_array, 0, sizeof(ip->extent_array));
+  ip->used &= ~DINODE_INLINE;
+  ip->size = 0;
+  iindex(ip);
+  if (n > 0)
+    raw_writei(ip, data, 0, n);
+}
+
+// Write ip's size and extents, or inline data, to its dinode.  Caller must hold
+// ip->lock and be in a transaction.
+static void iupdate(struct inode *ip) {
+  // We update the inode through the inodefile, which raw_writei()
+  // does recursively.
+  int holding_inodefile_lock = holdingrwsleep(&icache.inodefile.lock);
   if (!holding_inodefile_lock)
     locki(&icache.inodefile);
 
@@ -951,6 +2788,7 @@ static int raw_writei(struct inode *ip, char *src, uint off, uint n) {
   din.used = ip->used;
   din.num_extents = ip->num_extents;
   memmove(&din.extent_array, &ip->extent_array, sizeof(struct extent) * 30);
+  din.indirect = ip->indirect;
 
   int num_bytes = raw_writei(&icache.inodefile, (char*) &din, INODEOFF(ip->inum), sizeof(struct dinode));
 
@@ -962,7 +2800,336 @@ static int raw_writei(struct inode *ip, char *src, uint off, uint n) {
   
   if (!holding_inodefile_lock)
     unlocki(&icache.inodefile);
-  
+}
 
-  return bytes_written;
-}
\ No newline at end of file
+// Make dst, an empty file, a copy of src that shares its data blocks
+// instead of copying them: dst gets src's size, its extents and a copy
+// of its extent tree, and each block one more share.  A later write to
+// either file gives it blocks of its own for those it writes (see
+// iremap()), so the clone costs a transaction of share counts and
+// tree blocks, however big the file.  Returns 0, or -1 if either is
+// not a regular file, dst is not empty, a block has all the shares it
+// can, or the tree is too big for one transaction.
+int clonei(struct inode *src, struct inode *dst) {
+  int nblocks, nleaf, r;
+
+  if (src == dst)
+    return -1;
+  if (src->inum < dst->inum) {
+    locki(src);
+    locki(dst);
+  } else {
+    locki(dst);
+    locki(src);
+  }
+
+  r = -1;
+  if (src->type != T_FILE || dst->type != T_FILE || dst->size != 0 ||
+      dst->nblocks != 0)
+    goto out;
+  nleaf = 0;
+  if (src->indirect) {
+    struct buf *bp = bread(src->dev, src->indirect);
+    nleaf = ((struct extidx *)bp->data)->nchild;
+    brelse(bp);
+  }
+  // The share counts, the tree's copy, the bitmap blocks that allocate
+  // it, and the blocks the two dinodes can straddle
+  nblocks = sb.nref + 1 + nleaf + NBITMAP + 4;
+  if (LOGSLOTS(nblocks) > log.nslot || iforeach(src, breffull))
+    goto out;
+
+  log_begin_tx(nblocks);
+  iforeach(src, brefshare);
+  // An inline file's data comes along with its extent array
+  memmove(dst->extent_array, src->extent_array, sizeof(src->extent_array));
+  dst->num_extents = src->num_extents;
+  dst->used = (dst->used & ~(DINODE_INLINE | DINODE_HOLES)) |
+              (src->used & (DINODE_INLINE | DINODE_HOLES));
+  if (src->indirect)
+    dst->indirect = itreecopy(src);
+  dst->size = src->size;
+  iindex(dst);
+  src->used |= DINODE_SHARED;
+  dst->used |= DINODE_SHARED;
+  iupdate(src);
+  iupdate(dst);
+  src->logseq = dst->logseq = log_txseq();
+  log_end_tx(nblocks);
+  r = 0;
+
+out:
+  unlocki(src);
+  unlocki(dst);
+  return r;
+}
+
+// How many blocks ihole() may log: the bitmap, the share counts, the
+// tree, the two leaves and dinode blocks splitting at both ends may
+// add, and the bitmap block for those.
+static int iholeblocks(struct inode *ip) {
+  int nleaf = 0;
+
+  if (ip->indirect) {
+    struct buf *bp = bread(ip->dev, ip->indirect);
+    nleaf = ((struct extidx *)bp->data)->nchild;
+    brelse(bp);
+  }
+  return NBITMAP + sb.nref + nleaf + 1 + 5;
+}
+
+// Make file blocks [first, end) of ip a hole: cut the extents at both
+// ends, then free the blocks between or drop ip's share of them.
+// Returns 0, or -1 if there is no room to split the extents.  Caller
+// must hold ip->lock and be in a transaction of iholeblocks(ip).
+static int ihole(struct inode *ip, uint first, uint end) {
+  struct bfreeset fs;
+  struct extref r;
+  uint fblk;
+
+  if (first >= end)
+    return 0;
+  if (isplit(ip, first) < 0 || isplit(ip, end) < 0)
+    return -1;
+  memset(&fs, 0, sizeof(fs));
+  fs.dev = ip->dev;
+  for (fblk = first; fblk < end; fblk = r.first + r.e->nblocks, iextput(&r)) {
+    iextget(ip, fblk, &r);
+    if (r.e->startblkno == 0)
+      continue;
+    bfreedata(&fs, ip, r.e->startblkno, r.e->nblocks);
+    r.e->startblkno = 0;
+    if (r.bp)
+      log_write(r.bp);
+  }
+  bfreedone(&fs);
+  ip->used |= DINODE_HOLES;
+  return 0;
+}
+
+// Ready ip for a write at off, past its end, that leaves a gap which
+// must read as zeros.  Blocks preallocated there (see extend_alloc())
+// were never written and hold whatever they last held; those wholly
+// in the gap become a hole, in a transaction of their own, and
+// raw_writei() zeroes the rest of the gap as it reaches the block off
+// is in.  Returns 0, or -1 if the hole can't be made.  Caller must
+// hold ip->lock.
+static int igap(struct inode *ip, uint off) {
+  uint first, end;
+  int nblocks, r;
+
+  if (ip->used & DINODE_INLINE)
+    return 0;
+  first = (ip->size + BSIZE - 1) / BSIZE;
+  end = min(off / BSIZE, ifileblocks(ip));
+  if (first >= end)
+    return 0;
+  nblocks = iholeblocks(ip);
+  if (LOGSLOTS(nblocks) > log.nslot)
+    return -1;
+
+  log_begin_tx(nblocks);
+  ip->logseq = log_txseq();
+  r = ihole(ip, first, end);
+  iupdate(ip);
+  log_end_tx(nblocks);
+  return r;
+}
+
+// Zero n bytes of ip at off, which lie in one block, unless the block
+// is in a hole.
+static void izero(struct inode *ip, uint off, uint n) {
+  uint run;
+
+  if (bmap(ip, off / BSIZE, &run) != 0)
+    raw_writei(ip, zeroblock, off, n);
+}
+
+// Punch a hole in ip over [off, off + len), up to its size: the range
+// reads as zeros, and the blocks it covers in full become a hole and
+// are freed, or lose ip's share.  The blocks at either edge are zeroed
+// instead.  The file's size does not change.  Returns 0, or -1 if ip
+// is not a regular file or the range has too many extents to let go
+// of in one transaction.
+int ipunch(struct inode *ip, uint off, uint len) {
+  uint first, end;
+  int nblocks;
+
+  locki(ip);
+  if (ip->type != T_FILE) {
+    unlocki(ip);
+    return -1;
+  }
+  if (off >= ip->size || len == 0) {
+    unlocki(ip);
+    return 0;
+  }
+  len = min(len, ip->size - off);
+
+  if (ip->used & DINODE_INLINE) {
+    log_begin_tx(4);
+    memset((char *)ip->extent_array + off, 0, len);
+    iupdate(ip);
+    ip->logseq = log_txseq();
+    log_end_tx(4);
+    pcacheupdate(ip, off, len);
+    unlocki(ip);
+    return 0;
+  }
+
+  // The blocks to let go of: those the range covers in full, and the
+  // last one however much of it is in the file if the range gets there
+  first = (off + BSIZE - 1) / BSIZE;
+  end = off + len == ip->size ? (ip->size + BSIZE - 1) / BSIZE : (off + len) / BSIZE;
+
+  // What making the hole logs, and the two edge blocks and what
+  // zeroing them may remap
+  nblocks = iholeblocks(ip) + MAXREMAPS * (REMAPBLOCKS + 1) + 2;
+  if (LOGSLOTS(nblocks) > log.nslot) {
+    unlocki(ip);
+    return -1;
+  }
+
+  log_begin_tx(nblocks);
+  ip->logseq = log_txseq();
+
+  // Zero the edges that stay, unless they are in a hole already
+  if (off % BSIZE)
+    izero(ip, off, min(off + len, first * BSIZE) - off);
+  if (end >= first && end * BSIZE < off + len)
+    izero(ip, max(end * BSIZE, off), off + len - max(end * BSIZE, off));
+
+  if (ihole(ip, first, end) < 0) {
+    iupdate(ip);
+    log_end_tx(nblocks);
+    pcacheupdate(ip, off, len);
+    unlocki(ip);
+    return -1;
+  }
+  iupdate(ip);
+  log_end_tx(nblocks);
+
+  pcacheupdate(ip, off, len);
+  unlocki(ip);
+  return 0;
+}
+
+// Extents that defragi() moves in one transaction hold at most
+// DEFRAGBLOCKS blocks, which it logs along with the bitmap and dinode.
+#define DEFRAGBLOCKS MAXWRITEBLOCKS
+
+// Copy the n blocks from disk block from to disk block to, through the
+// log.  The reads are queued at once, so they come off the disk in a
+// few long runs instead of a seek per block; the copies overwrite
+// whole blocks, which are claimed without being read.
+static void bcopyrun(uint dev, uint from, uint to, uint n) {
+  struct buf *src, *dst;
+  uint i;
+
+  ideplug();
+  for (i = 0; i < n; i++)
+    bprefetch(dev, from + i);
+  ideunplug();
+  for (i = 0; i < n; i++) {
+    src = bread(dev, from + i);
+    dst = bclaim(dev, to + i);
+    memmove(dst->data, src->data, BSIZE);
+    log_write(dst);
+    brelse(dst);
+    brelse(src);
+  }
+}
+
+// Move ip's data into fewer, longer extents, so that reading it
+// sequentially seeks less and finding an offset walks fewer extents.
+// Runs of adjacent extents are copied to one new run of free blocks,
+// at most DEFRAGBLOCKS at a time, preferably right after the extent
+// before them so the two merge, and at first into a free run that
+// holds the whole file, found in the free-space index.  Each run moves
+// in a transaction of its own, which swaps in its new extent and frees
+// the old blocks, so a crash leaves the file as it was before or after
+// the run.  Holes stay where they are.  Returns the number of extents
+// ip has left, or -1 if it is not a regular file, has an extent tree,
+// or shares blocks with a clone.
+int defragi(struct inode *ip) {
+  struct bfreeset fs;
+  struct extent *e;
+  uint total, tgt, prevend, k, b;
+  int i, j, m, nblocks, r;
+
+  locki(ip);
+  if (ip->type != T_FILE || ip->indirect || (ip->used & DINODE_SHARED)) {
+    unlocki(ip);
+    return -1;
+  }
+  if (ip->used & DINODE_INLINE) {
+    unlocki(ip);
+    return 0;
+  }
+
+  e = ip->extent_array;
+  total = 0;
+  for (i = 0; i < ip->num_extents; i++)
+    if (e[i].startblkno)
+      total += e[i].nblocks;
+  tgt = ip->num_extents > 1 ? bfind(ip->dev, total) : 0;
+
+  // The new blocks, the bitmap blocks they and the old ones are in,
+  // and the blocks the dinode can straddle
+  nblocks = DEFRAGBLOCKS + NBITMAP + 2;
+  for (i = 0; i < ip->num_extents;) {
+    // The run of extents to move: those from i that fit together
+    if (e[i].startblkno == 0 || e[i].nblocks >= DEFRAGBLOCKS) {
+      i++;
+      continue;
+    }
+    k = 0;
+    for (j = i; j < ip->num_extents && e[j].startblkno &&
+                k + e[j].nblocks <= DEFRAGBLOCKS; j++)
+      k += e[j].nblocks;
+    prevend = i > 0 && e[i - 1].startblkno ? e[i - 1].startblkno + e[i - 1].nblocks : 0;
+
+    log_begin_tx(nblocks);
+    b = 0;
+    if (prevend && balloc_at(ip->dev, prevend, k))
+      b = prevend;
+    else if (!prevend && tgt && balloc_at(ip->dev, tgt, k))
+      b = tgt;
+    else if (j - i > 1)
+      b = balloc_try(ip->dev, k);
+    tgt = 0;
+    if (b == 0) {
+      // Nowhere better for them
+      log_end_tx(nblocks);
+      i = j;
+      continue;
+    }
+
+    memset(&fs, 0, sizeof(fs));
+    fs.dev = ip->dev;
+    for (m = i, k = 0; m < j; k += e[m].nblocks, m++) {
+      bcopyrun(ip->dev, e[m].startblkno, b + k, e[m].nblocks);
+      bfree(&fs, e[m].startblkno, e[m].nblocks);
+    }
+    bfreedone(&fs);
+
+    e[i].startblkno = b;
+    e[i].nblocks = k;
+    memmove(&e[i + 1], &e[j], (ip->num_extents - j) * sizeof(*e));
+    ip->num_extents -= j - i - 1;
+    if (b == prevend) {
+      e[i - 1].nblocks += k;
+      memmove(&e[i], &e[i + 1], (ip->num_extents - i - 1) * sizeof(*e));
+      ip->num_extents--;
+    } else {
+      i++;
+    }
+    iindex(ip);
+    iupdate(ip);
+    ip->logseq = log_txseq();
+    log_end_tx(nblocks);
+  }
+  r = ip->num_extents;
+  unlocki(ip);
+  return r;
+}
@@ -0,0 +1,110 @@
+// Waiting on a word of user memory, for futex_wait() and
+// futex_wake().
+//
+// A futex is named by the physical address of its word, so threads
+// of a process and processes sharing a page all find the same one.
+// A waiter sleeps on the word's kernel address; while it is at it,
+// it holds a reference on the page, which keeps the page from being
+// freed or swapped out and the name from changing under it.
+//
+// The futex lock hashed from the word is held from checking the
+// word until the waiter is asleep, and by the waker, so a wake
+// between the two is not lost.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <spinlock.h>
+#include <vspace.h>
+
+#define NFUTEXLOCK 16
+
+static struct spinlock futexlocks[NFUTEXLOCK];
+
+void futexinit(void) {
+  int i;
+
+  for (i = 0; i < NFUTEXLOCK; i++)
+    initlock(&futexlocks[i], "futex");
+}
+
+static struct spinlock *futexlock(int *key) {
+  return &futexlocks[((uint64_t)key / sizeof(int)) % NFUTEXLOCK];
+}
+
+// Returns the kernel address of the int at user address uaddr in vs,
+// with a reference taken on its page, or 0 if it isn't mapped.  A
+// copy-on-write page is written first, so the word has a page of its
+// own that a store by another thread won't move.
+static int *futexget(struct vspace *vs, uint64_t uaddr) {
+  struct vregion *vr;
+  struct vpage_info *vpi;
+  uint64_t pa;
+
+  if (uaddr % sizeof(int))
+    return 0;
+  for (;;) {
+    acquiresleep(&vs->lock);
+    vr = va2vregion(vs, uaddr);
+    vpi = vr ? va2vpage_info(vr, uaddr) : 0;
+    rmapacquire();
+    if (vpi && vpi->used && vpi->present && vpi->is_cow != VPI_COW) {
+      pa = vpi->ppn << PT_SHIFT;
+      increment_ref(pa2page(pa));
+      rmaprelease();
+      releasesleep(&vs->lock);
+      return (int *)(P2V(pa) + uaddr % PGSIZE);
+    }
+    rmaprelease();
+    releasesleep(&vs->lock);
+    if (!vpi || touchuser((int *)uaddr) < 0)
+      return 0;
+  }
+}
+
+static void futexput(int *key) {
+  kfree((char *)PGROUNDDOWN((uint64_t)key));
+}
+
+// Sleep until futexwake() on uaddr, if the int there is val.
+// Returns 0 once woken, or -1 if the int was not val or uaddr is
+// not mapped.  Like any sleep, the wait may end early; callers
+// check the word again.
+int futexwait(uint64_t uaddr, int val) {
+  struct proc *p = myproc();
+  struct spinlock *lk;
+  int *key, r;
+
+  if (!(key = futexget(&p->group->vspace, uaddr)))
+    return -1;
+  lk = futexlock(key);
+  r = -1;
+  acquire(lk);
+  if (__atomic_load_n(key, __ATOMIC_SEQ_CST) == val && !p->killed) {
+    sleep(key, lk);
+    r = 0;
+  }
+  release(lk);
+  futexput(key);
+  return r;
+}
+
+// Wake up to n of the processes waiting on uaddr, those that have
+// waited longest first.  Returns how many were woken, or -1 if uaddr
+// is not mapped.
+int futexwake(uint64_t uaddr, int n) {
+  struct spinlock *lk;
+  int *key, r;
+
+  if (!(key = futexget(&myproc()->group->vspace, uaddr)))
+    return -1;
+  lk = futexlock(key);
+  acquire(lk);
+  r = wakeupn(key, n);
+  release(lk);
+  futexput(key);
+  return r;
+}
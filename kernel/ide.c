@@ -1,4 +1,7 @@
 // Simple PIO-based (non-DMA) IDE driver code.
+//
+// If there is a virtio-blk device, disk 1 is that instead, and each
+// entry point below hands its work to virtio.c.
 
 #include <cdefs.h>
 #include <defs.h>
@@ -9,6 +12,7 @@
 #include <proc.h>
 #include <sleeplock.h>
 #include <spinlock.h>
+#include <trace.h>
 #include <trap.h>
 #include <x86_64.h>
 
@@ -25,14 +29,32 @@
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
 
+#define IDE_CMD_SETMUL 0xc6
+
+#define IDE_MAXSECT 256 // most sectors one command can transfer
+#define IDE_MULT 16     // sectors per interrupt in multiple mode
+
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The first idenbuf bufs on the queue hold consecutive blocks and are
+// transferred together by a single command.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
 
+static int idenbuf;          // bufs in the active request, 0 if idle
+static int ideplugged;       // ideplug() calls not yet undone
+
+uint64_t disk_reads;    // blocks read, for sysinfo()
+uint64_t disk_writes;   // blocks written
+uint64_t disk_requests; // commands issued, each for a run of blocks
+static int idedone;          // sectors of the active request transferred
+static struct buf *idexfer;  // buf holding sector idedone
+static int idemult;          // sectors per data block, 1 if no multiple mode
+
 static int havedisk1;
+static int idevirtio; // disk 1 is virtio-blk
 static void idestart(struct buf *);
 
 // Wait for IDE disk to become ready.
@@ -50,6 +72,7 @@ void ideinit(void) {
   int i;
 
   initlock(&idelock, "ide");
+  idevirtio = virtioinit();
   picenable(IRQ_IDE);
   ioapicenable(IRQ_IDE, ncpu - 1);
   idewait(0);
@@ -65,95 +88,286 @@ void ideinit(void) {
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0 << 4));
+
+  // Ask for IDE_MULT sectors per interrupt, with the interrupt masked
+  // so the command does not look like a completed request.
+  outb(0x3f6, 2);
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  idemult = (idewait(1) >= 0) ? IDE_MULT : 1;
+  outb(0x3f6, 0);
+}
+
+// Move queued bufs that continue the block run starting at b up
+// behind it, so one command can carry all of them.
+// Returns the number of bufs in the run.  Caller must hold idelock.
+static int idemerge(struct buf *b) {
+  struct buf **pp, *tail, *nb;
+  int n, sector_per_block;
+
+  sector_per_block = BSIZE / SECTOR_SIZE;
+  tail = b;
+  for (n = 1; (n + 1) * sector_per_block <= IDE_MAXSECT; n++) {
+    for (pp = &tail->qnext; (nb = *pp) != 0; pp = &nb->qnext)
+      if (nb->dev == b->dev && nb->blockno == tail->blockno + 1 &&
+          (nb->flags & B_DIRTY) == (b->flags & B_DIRTY))
+        break;
+    if (nb == 0)
+      break;
+    *pp = nb->qnext;
+    nb->qnext = tail->qnext;
+    tail->qnext = nb;
+    tail = nb;
+  }
+  return n;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Move the next data block of the active request between the disk
+// and the bufs, one sector at a time.  Caller must hold idelock.
+static void idexferblock(int write) {
+  int sector_per_block = BSIZE / SECTOR_SIZE;
+  int nsect = idenbuf * sector_per_block;
+  int i, off;
+
+  for (i = 0; i < idemult && idedone < nsect; i++, idedone++) {
+    off = (idedone % sector_per_block) * SECTOR_SIZE;
+    if (write)
+      outsl(0x1f0, idexfer->data + off, SECTOR_SIZE / 4);
+    else
+      insl(0x1f0, idexfer->data + off, SECTOR_SIZE / 4);
+    if ((idedone + 1) % sector_per_block == 0)
+      idexfer = idexfer->qnext;
+  }
+}
+
+// Start the request for b and any queued bufs that continue it.
+// Caller must hold idelock.
 static void idestart(struct buf *b) {
+  struct buf *nb;
+  int i;
+
   if (b == 0)
     panic("idestart");
-  if (b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block = BSIZE / SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
-
-  if (sector_per_block > 7)
+  if (sector_per_block > IDE_MAXSECT)
     panic("idestart");
 
+  idenbuf = idemerge(b);
+  idedone = 0;
+  idexfer = b;
+  for (i = 0, nb = b; i < idenbuf; i++, nb = nb->qnext)
+    if (nb->blockno >= FSSIZE)
+      panic("incorrect blockno");
+
+  int sector = b->blockno * sector_per_block;
+  int nsect = idenbuf * sector_per_block;
+  int read_cmd = (idemult > 1) ? IDE_CMD_RDMUL : IDE_CMD_READ;
+  int write_cmd = (idemult > 1) ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+
   idewait(0);
   outb(0x3f6, 0);                // generate interrupt
-  outb(0x1f2, sector_per_block); // number of sectors
+  outb(0x1f2, nsect & 0xff);     // number of sectors (0 means 256)
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev & 1) << 4) | ((sector >> 24) & 0x0f));
+  disk_requests++;
   if (b->flags & B_DIRTY) {
+    disk_writes += idenbuf;
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE / 4);
+    idexferblock(1);
   } else {
+    disk_reads += idenbuf;
     outb(0x1f7, read_cmd);
   }
 }
 
 // Interrupt handler.
 void ideintr(void) {
-  struct buf *b;
+  struct buf *b, *async, **tail;
+  int i, nsect;
 
   // First queued buffer is the active request.
   acquire(&idelock);
-  if ((b = idequeue) == 0) {
+  if ((b = idequeue) == 0 || idenbuf == 0) {
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if (!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE / 4);
+  // The disk interrupts once per data block; move the next one and
+  // wait for the rest of the request.
+  nsect = idenbuf * (BSIZE / SECTOR_SIZE);
+  if (!(b->flags & B_DIRTY)) {
+    if (idewait(1) >= 0)
+      idexferblock(0);
+    else
+      idedone = nsect;
+  }
+  if (idedone < nsect) {
+    if (b->flags & B_DIRTY)
+      idexferblock(1);
+    release(&idelock);
+    return;
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for these bufs.  Asynchronous bufs have
+  // nobody waiting, so collect them to release below.
+  async = 0;
+  tail = &async;
+  for (i = 0; i < idenbuf; i++) {
+    b = idequeue;
+    idequeue = b->qnext;
+    TRACE(TR_DISKDONE, b->blockno, (b->flags & B_DIRTY) != 0);
+    b->flags |= B_VALID;
+    b->flags &= ~(B_DIRTY | B_QUEUED);
+    if (b->flags & B_ASYNC) {
+      b->flags &= ~B_ASYNC;
+      *tail = b;
+      tail = &b->qnext;
+    } else {
+      wakeup(b);
+    }
+  }
+  *tail = 0;
+  idenbuf = 0;
 
   // Start disk on next buf in queue.
-  if (idequeue != 0)
+  if (idequeue != 0 && !ideplugged)
     idestart(idequeue);
 
   release(&idelock);
+
+  // Drop the submitter's reference on behalf of asynchronous requests.
+  while ((b = async) != 0) {
+    async = b->qnext;
+    brelse(b);
+  }
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void iderw(struct buf *b) {
-  struct buf **pp;
+// Queue b behind the active request in C-LOOK order: first the
+// blocks at or above the disk's current position in ascending order,
+// then the sweep starting over from the lowest block.
+// Caller must hold idelock.
+static void idequeueinsert(struct buf *b) {
+  struct buf **pp, *last;
+  int i;
+
+  if (idequeue == 0) {
+    b->qnext = 0;
+    idequeue = b;
+    return;
+  }
+
+  // Skip over the active request.
+  pp = &idequeue;
+  last = 0;
+  for (i = 0; i < idenbuf && *pp; i++) {
+    last = *pp;
+    pp = &last->qnext;
+  }
 
+  if (last == 0) {
+    // Idle but plugged: keep the queue in block order.
+    while (*pp && (*pp)->blockno <= b->blockno)
+      pp = &(*pp)->qnext;
+  } else if (b->blockno >= last->blockno) {
+    // Join the current sweep.
+    while (*pp && (*pp)->blockno >= last->blockno &&
+           (*pp)->blockno <= b->blockno)
+      pp = &(*pp)->qnext;
+  } else {
+    // Wait for the next sweep.
+    while (*pp && (*pp)->blockno >= last->blockno)
+      pp = &(*pp)->qnext;
+    while (*pp && (*pp)->blockno <= b->blockno)
+      pp = &(*pp)->qnext;
+  }
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Queue b to be synced with disk and return without waiting.
+// If B_ASYNC is set, ideintr() releases the buffer when it completes;
+// otherwise the caller waits for it with ideiowait().
+void idesubmit(struct buf *b) {
   if (!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if ((b->flags & (B_VALID | B_DIRTY)) == B_VALID)
     panic("iderw: nothing to do");
+  if (idevirtio) {
+    virtiosubmit(b);
+    return;
+  }
   if (b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
   acquire(&idelock); // DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for (pp = &idequeue; *pp; pp = &(*pp)->qnext) // DOC:insert-queue
-    ;
-  *pp = b;
+  TRACE(TR_DISKSUBMIT, b->blockno, (b->flags & B_DIRTY) != 0);
+  b->flags |= B_QUEUED;
+  idequeueinsert(b);
 
   // Start disk if necessary.
-  if (idequeue == b)
-    idestart(b);
+  if (idenbuf == 0 && !ideplugged)
+    idestart(idequeue);
 
-  // Wait for request to finish.
-  while ((b->flags & (B_VALID | B_DIRTY)) != B_VALID) {
-    sleep(b, &idelock);
+  release(&idelock);
+}
+
+// Hold back the disk: until the matching ideunplug(), idesubmit()
+// queues requests without starting them, so a batch submitted
+// together is sorted and merged into as few commands as it can be.
+// The caller must not wait for its own requests while plugged.
+void ideplug(void) {
+  if (idevirtio) {
+    virtioplug();
+    return;
+  }
+  acquire(&idelock);
+  ideplugged++;
+  release(&idelock);
+}
+
+void ideunplug(void) {
+  if (idevirtio) {
+    virtiounplug();
+    return;
   }
+  acquire(&idelock);
+  if (--ideplugged == 0 && idenbuf == 0 && idequeue != 0)
+    idestart(idequeue);
+  release(&idelock);
+}
 
+// Blocks on a real disk are read into the cache; none is mapped.
+uchar *idemap(uint dev, uint blockno) {
+  return 0;
+}
+
+// Wait for a request queued by idesubmit() to finish.
+void ideiowait(struct buf *b) {
+  if (idevirtio) {
+    virtiowait(b);
+    return;
+  }
+  acquire(&idelock);
+  while (b->flags & B_QUEUED) {
+    sleep(b, &idelock);
+  }
   release(&idelock);
 }
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return as soon as the request is queued;
+// ideintr() releases the buffer when it completes.
+void iderw(struct buf *b) {
+  // An asynchronous buf may be released as soon as it is queued.
+  int async = b->flags & B_ASYNC;
+
+  idesubmit(b);
+  if (!async)
+    ideiowait(b);
+}
@@ -8,6 +8,7 @@
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
+#include <proc.h>
 #include <spinlock.h>
 
 int npages = 0;
@@ -54,13 +55,121 @@ void detect_memory(void) {
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
 
+// Free pages are kept by a binary buddy allocator: a free block of
+// order k is 2^k pages aligned to its size, and kmem.free[k] lists
+// them by their first page.  Freeing a block merges it with its
+// buddy whenever that is free too.
 struct {
   struct spinlock lock;
-  struct spinlock lock2;
   int use_lock;
+  struct core_map_entry *free[MAXORDER + 1];
+  int nfree[MAXORDER + 1]; // blocks on each free list
+  struct core_map_entry *zeroed; // free pages already cleared by kzeroidle()
+  int nzeroed;
 } kmem;
 
-static void setrand(unsigned int);
+#define ZPOOL_MAX 64 // most pages kept in kmem.zeroed
+
+// Each CPU keeps a small stack of free pages so most kalloc() and
+// kfree() calls don't touch kmem.lock.  It is refilled from and
+// drained to the buddy lists PCP_BATCH pages at a time, and only used
+// with interrupts off.  Pages in it still count as free_pages.
+#define PCP_BATCH 16
+#define PCP_HIGH (4 * PCP_BATCH)
+
+struct {
+  struct core_map_entry *head;
+  int n;
+} pcp[NCPU];
+
+// Buddy free lists.  Caller must hold kmem.lock.
+static void buddypush(struct core_map_entry *r, int order) {
+  r->order = order;
+  r->prev_free = 0;
+  r->next_free = kmem.free[order];
+  if (r->next_free)
+    r->next_free->prev_free = r;
+  kmem.free[order] = r;
+  kmem.nfree[order]++;
+}
+
+static void buddyremove(struct core_map_entry *r) {
+  if (r->prev_free)
+    r->prev_free->next_free = r->next_free;
+  else
+    kmem.free[r->order] = r->next_free;
+  if (r->next_free)
+    r->next_free->prev_free = r->prev_free;
+  kmem.nfree[r->order]--;
+  r->order = -1;
+  r->next_free = r->prev_free = 0;
+}
+
+// Return the free block of 2^order pages at r, merging it with its
+// free buddies.
+static void buddyfree(struct core_map_entry *r, int order) {
+  uint64_t pfn = r - core_map;
+
+  for (; order < MAXORDER; order++) {
+    uint64_t buddy = pfn ^ (1 << order);
+    if (buddy >= npages || core_map[buddy].order != order)
+      break;
+    buddyremove(&core_map[buddy]);
+    pfn &= ~(uint64_t)(1 << order);
+  }
+  buddypush(&core_map[pfn], order);
+}
+
+// Take a free block of 2^order pages, splitting a larger one if
+// needed.  Returns 0 if there is none.
+static struct core_map_entry *buddyalloc(int order) {
+  struct core_map_entry *r;
+  int k;
+
+  for (k = order; k <= MAXORDER && kmem.free[k] == 0; k++)
+    ;
+  if (k > MAXORDER)
+    return 0;
+  r = kmem.free[k];
+  buddyremove(r);
+  while (k > order) {
+    k--;
+    buddypush(r + (1 << k), k);
+  }
+  return r;
+}
+
+// Give this CPU's cached pages and the zeroed pages back to the buddy
+// lists so they can merge.  Interrupts must be off.
+static void kmemdrain(int c) {
+  struct core_map_entry *r;
+
+  acquire(&kmem.lock);
+  while ((r = pcp[c].head) != 0) {
+    pcp[c].head = r->next_free;
+    buddyfree(r, 0);
+  }
+  pcp[c].n = 0;
+  while ((r = kmem.zeroed) != 0) {
+    kmem.zeroed = r->next_free;
+    buddyfree(r, 0);
+  }
+  kmem.nzeroed = 0;
+  release(&kmem.lock);
+}
+
+// Take a page off the zeroed pool, or return 0.
+static struct core_map_entry *zpoolget(void) {
+  struct core_map_entry *r;
+
+  acquire(&kmem.lock);
+  if ((r = kmem.zeroed) != 0) {
+    kmem.zeroed = r->next_free;
+    kmem.nzeroed--;
+  }
+  release(&kmem.lock);
+  return r;
+}
 
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
@@ -73,9 +182,10 @@ void mem_init(void *vstart) {
   core_map = vstart;
   memset(vstart, 0, PGROUNDUP(npages * sizeof(struct core_map_entry)));
   vstart += PGROUNDUP(npages * sizeof(struct core_map_entry));
+  for (int i = 0; i < npages; i++)
+    core_map[i].order = -1;
 
   initlock(&kmem.lock, "kmem");
-  initlock(&kmem.lock2, "kmem2"); // second lock
   kmem.use_lock = 0;
 
   vend = (void *)P2V((uint64_t)(npages * PGSIZE));
@@ -84,14 +194,29 @@ void mem_init(void *vstart) {
   pages_in_use = 0;
   pages_in_swap = 0;
   kmem.use_lock = 1;
-  setrand(1);
 }
 
+// Put the pages from vstart to vend on the buddy lists, as the
+// largest aligned blocks that fit, without going through kfree() for
+// each one.  core_map is already zeroed, so only available needs
+// setting.  The pages themselves are not touched: nothing can hold a
+// stale pointer into them yet, and kalloc_zeroed() or kzeroidle()
+// clears them when that is wanted.
 void freerange(void *vstart, void *vend) {
-  char *p;
-  p = (char *)PGROUNDUP((uint64_t)vstart);
-  for (; p + PGSIZE <= (char *)vend; p += PGSIZE)
-    kfree(p);
+  uint64_t pfn, end;
+  int order;
+
+  pfn = PGNUM(V2P(PGROUNDUP((uint64_t)vstart)));
+  end = PGNUM(V2P(vend));
+  for (uint64_t i = pfn; i < end; i++)
+    core_map[i].available = 1;
+  while (pfn < end) {
+    for (order = MAXORDER; order > 0; order--)
+      if (pfn % (1 << order) == 0 && pfn + (1 << order) <= end)
+        break;
+    buddypush(&core_map[pfn], order);
+    pfn += 1 << order;
+  }
 }
 
 // Free the page of physical memory pointed at by v,
@@ -104,27 +229,81 @@ void kfree(char *v) {
   if ((uint64_t)v % PGSIZE || v < _end || V2P(v) >= (uint64_t)(npages * PGSIZE))
     panic("kfree");
 
-  if (kmem.use_lock)
-    acquire(&kmem.lock);
-
   r = (struct core_map_entry *)pa2page(V2P(v));
 
-  r->ref_count -= 1;
-  if (r->ref_count <= 0) {
-      pages_in_use--;
-      free_pages++;
+  // Only the last reference frees the page
+  int ref = __sync_sub_and_fetch(&r->ref_count, 1);
+  if (ref > 0)
+    return;
+  if (ref < 0 || r->available) {
+    r->ref_count = 0; // already free
+    return;
+  }
 
-      // Fill with junk to catch dangling refs.
-      memset(v, 2, PGSIZE);
+  __sync_fetch_and_sub(&pages_in_use, 1);
+  __sync_fetch_and_add(&free_pages, 1);
 
-      r->available = 1;
-      r->user = 0;
-      r->va = 0;
-      r->ref_count = 0;
+#if KALLOC_DEBUG
+  // Fill with junk to catch dangling refs.
+  memset(v, 2, PGSIZE);
+#endif
+
+  r->available = 1;
+  r->user = 0;
+  r->va = 0;
+
+  if (!kmem.use_lock) {
+    buddyfree(r, 0);
+    return;
   }
 
-  if (kmem.use_lock)
+  pushcli();
+  int c = mycpu() - cpus;
+  r->next_free = pcp[c].head;
+  pcp[c].head = r;
+  if (++pcp[c].n > PCP_HIGH) {
+    acquire(&kmem.lock);
+    for (int i = 0; i < PCP_BATCH; i++) {
+      r = pcp[c].head;
+      pcp[c].head = r->next_free;
+      buddyfree(r, 0);
+    }
+    pcp[c].n -= PCP_BATCH;
     release(&kmem.lock);
+  }
+  popcli();
+}
+
+// Free a block returned by kalloc_order().
+void kfree_order(char *v, int order) {
+  struct core_map_entry *r;
+  int i;
+
+  if (order == 0) {
+    kfree(v);
+    return;
+  }
+  if ((uint64_t)v % (PGSIZE << order) || v < _end || V2P(v) + (PGSIZE << order) > (uint64_t)(npages * PGSIZE))
+    panic("kfree_order");
+
+#if KALLOC_DEBUG
+  // Fill with junk to catch dangling refs.
+  memset(v, 2, PGSIZE << order);
+#endif
+
+  r = pa2page(V2P(v));
+  for (i = 0; i < (1 << order); i++) {
+    r[i].available = 1;
+    r[i].user = 0;
+    r[i].va = 0;
+    r[i].ref_count = 0;
+  }
+  __sync_fetch_and_sub(&pages_in_use, 1 << order);
+  __sync_fetch_and_add(&free_pages, 1 << order);
+
+  acquire(&kmem.lock);
+  buddyfree(r, order);
+  release(&kmem.lock);
 }
 
 void
@@ -147,78 +326,166 @@ mark_kernel_mem(uint64_t pa)
   r->va = 0;
 }
 
+// Allocate one 4096-byte page of physical memory.
+// When memory runs out, ask the buffer cache to give pages back,
+// then swap user pages out, before failing.
 char *kalloc(void) {
 
-  int i;
+  struct core_map_entry *r;
 
-  if (kmem.use_lock)
-    acquire(&kmem.lock);
+  if (!kmem.use_lock) {
+    if ((r = buddyalloc(0)) == 0)
+      return 0;
+    goto found;
+  }
 
-  for (i = 0; i < npages; i++) {
-    if (core_map[i].available == 1) {
-      core_map[i].available = 0;
-      core_map[i].ref_count = 1;
-      pages_in_use++;
-      free_pages--;
-      if (kmem.use_lock)
-        release(&kmem.lock);
-      return P2V(page2pa(&core_map[i]));
+  for (;;) {
+    pushcli();
+    int c = mycpu() - cpus;
+    if (pcp[c].n == 0) {
+      acquire(&kmem.lock);
+      while (pcp[c].n < PCP_BATCH && (r = buddyalloc(0)) != 0) {
+        r->next_free = pcp[c].head;
+        pcp[c].head = r;
+        pcp[c].n++;
+      }
+      release(&kmem.lock);
     }
-  }
+    if ((r = pcp[c].head) != 0) {
+      pcp[c].head = r->next_free;
+      pcp[c].n--;
+      popcli();
+      goto found;
+    }
+    popcli();
 
-  if (kmem.use_lock)
-    release(&kmem.lock);
+    if ((r = zpoolget()) != 0)
+      goto found;
+
+    // File pages go before the metadata in the buffer cache
+    if (pcacheshrink() == 0 && bshrink() == 0 && swapout() == 0)
+      return 0;
+  }
 
-  return 0;
+found:
+  r->next_free = 0;
+  r->available = 0;
+  r->ref_count = 1;
+  __sync_fetch_and_add(&pages_in_use, 1);
+  __sync_fetch_and_sub(&free_pages, 1);
+  return P2V(page2pa(r));
 }
 
+// Allocate one page filled with zeros, from the pool cleared by
+// kzeroidle() when it has one.
+char *kalloc_zeroed(void) {
+  struct core_map_entry *r;
+  char *v;
+
+  if (kmem.use_lock && (r = zpoolget()) != 0) {
+    r->next_free = 0;
+    r->available = 0;
+    r->ref_count = 1;
+    __sync_fetch_and_add(&pages_in_use, 1);
+    __sync_fetch_and_sub(&free_pages, 1);
+    return P2V(page2pa(r));
+  }
+  if ((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
 
-static unsigned long int next = 1;
+// Clear one free page for kalloc_zeroed(), unless the pool is full.
+// Called by the scheduler when it finds nothing to run.  Returns 1 if
+// it cleared a page.
+int kzeroidle(void) {
+  struct core_map_entry *r;
 
-// returns random integer from [0, limit)
-static int rand(int limit) {
-  next = next * 1103515245 + 12345;
-  return (unsigned int)(next/65536) % limit;
+  if (kmem.nzeroed >= ZPOOL_MAX)
+    return 0;
+  acquire(&kmem.lock);
+  r = buddyalloc(0);
+  release(&kmem.lock);
+  if (r == 0)
+    return 0;
+
+  memset(P2V(page2pa(r)), 0, PGSIZE);
+
+  acquire(&kmem.lock);
+  r->next_free = kmem.zeroed;
+  kmem.zeroed = r;
+  kmem.nzeroed++;
+  release(&kmem.lock);
+  return 1;
 }
 
-// Sets the seed for random.
-// Intended to be used before calling rand.
-static void setrand(unsigned int seed) {
-  next = seed;
-}
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  If no block is free and shrink is set, caches are shrunk
+// until one can be formed.  Each page gets its own reference, so the
+// block may later be freed a page at a time.  Returns 0 if no block
+// that large can be had.
+static char *blockalloc(int order, int shrink) {
+  struct core_map_entry *r;
+  int i;
 
-struct core_map_entry * get_random_user_page() {
-  int x = 100;
-  while(x--) {
-    int rand_index = rand(npages);
-    if (core_map[rand_index].va != 0) {
-      return &core_map[rand_index];
-    }
-  }
-  panic("Tried 100 random indices for random user page, all failed");
-}
+  for (;;) {
+    acquire(&kmem.lock);
+    r = buddyalloc(order);
+    release(&kmem.lock);
+    if (r)
+      break;
 
-// Function for incrementing the reference count to the given core_map entry
-void increment_ref(struct core_map_entry* entry) {
-  if (kmem.use_lock) {
+    // Cached single pages may be what keeps a block from merging
+    pushcli();
+    kmemdrain(mycpu() - cpus);
+    popcli();
     acquire(&kmem.lock);
+    r = buddyalloc(order);
+    release(&kmem.lock);
+    if (r)
+      break;
+
+    if (!shrink || (pcacheshrink() == 0 && bshrink() == 0))
+      return 0;
   }
-  entry->ref_count++;
 
-  if (kmem.use_lock){
-    release(&kmem.lock);
+  for (i = 0; i < (1 << order); i++) {
+    r[i].available = 0;
+    r[i].ref_count = 1;
   }
+  __sync_fetch_and_add(&pages_in_use, 1 << order);
+  __sync_fetch_and_sub(&free_pages, 1 << order);
+  return P2V(page2pa(r));
+}
 
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  Returns 0 if no block that large is free.
+char *kalloc_order(int order) {
+  if (order == 0)
+    return kalloc();
+  if (order < 0 || order > MAXORDER)
+    return 0;
+  return blockalloc(order, 1);
 }
 
-void lock_memory() {
-  if (kmem.use_lock) {
-    acquire(&kmem.lock2);
-  }
+// Like kalloc_order(), but only takes memory that is free already,
+// for callers that can do without the block.
+char *kalloc_order_try(int order) {
+  if (order < 0 || order > MAXORDER)
+    return 0;
+  return blockalloc(order, 0);
 }
 
-void unlock_memory() {
-  if (kmem.use_lock){
-    release(&kmem.lock2);
-  }
+// Copy the number of free buddy blocks of each order into nblocks.
+void kallocstats(int *nblocks) {
+  acquire(&kmem.lock);
+  for (int i = 0; i <= MAXORDER; i++)
+    nblocks[i] = kmem.nfree[i];
+  release(&kmem.lock);
+}
+
+
+// Function for incrementing the reference count to the given core_map entry
+void increment_ref(struct core_map_entry* entry) {
+  __sync_fetch_and_add(&entry->ref_count, 1);
 }
\ No newline at end of file
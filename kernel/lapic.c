@@ -32,6 +32,7 @@
 #define ICRHI (0x0310 / 4)  // Interrupt Command [63:32]
 #define TIMER (0x0320 / 4)  // Local Vector Table 0 (TIMER)
 #define X1 0x0000000B       // divide counts by 1
+#define ONESHOT 0x00000000  // One-shot
 #define PERIODIC 0x00020000 // Periodic
 #define PCINT (0x0340 / 4)  // Performance Counter LVT
 #define LINT0 (0x0350 / 4)  // Local Vector Table 1 (LINT0)
@@ -42,6 +43,9 @@
 #define TCCR (0x0390 / 4)   // Timer Current Count
 #define TDCR (0x03E0 / 4)   // Timer Divide Configuration
 
+// Timer counts per tick
+#define TICKCOUNT 10000000
+
 volatile uint *lapic; // Initialized in mp.c
 
 static void lapicw(int index, int value) {
@@ -61,8 +65,9 @@ void lapicinit(void) {
   // If xk cared more about precise timekeeping,
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
+  mycpu()->tickdiv = 1;
   lapicw(TIMER, PERIODIC | (TRAP_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICKCOUNT);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -129,6 +134,66 @@ void lapiceoi(void) {
 // On real hardware would want to tune this dynamically.
 void microdelay(int us) {}
 
+// Send IRQ irq to the CPU with the given APIC ID.
+// Interrupts must be off.
+static void lapicipi(uchar apicid, int irq) {
+  lapicw(ICRHI, apicid << 24);
+  lapicw(ICRLO, FIXED | (TRAP_IRQ0 + irq));
+  while (lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Interrupt the CPU with the given APIC ID, to wake it from hlt.
+// Interrupts must be off.
+void lapicwake(uchar apicid) { lapicipi(apicid, IRQ_WAKE); }
+
+// Have the CPU with the given APIC ID flush its TLB (see
+// vspacetlbpoll()).  Interrupts must be off.
+void lapictlb(uchar apicid) { lapicipi(apicid, IRQ_TLB); }
+
+// Stop this CPU's periodic tick while it idles: interrupt just once,
+// n ticks from now, or not at all if n is 0.  n is cut down to what
+// the counter can hold.
+void lapiconeshot(uint n) {
+  if (!lapic)
+    return;
+  if (n == 0) {
+    lapicw(TIMER, MASKED | (TRAP_IRQ0 + IRQ_TIMER));
+    return;
+  }
+  n = min(n, 0xFFFFFFFF / TICKCOUNT);
+  lapicw(TIMER, ONESHOT | (TRAP_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, n * TICKCOUNT);
+}
+
+// Restart the periodic tick after lapiconeshot(n).  Returns how many
+// whole ticks went by in between, or 0 if the timer was off.
+uint lapicperiodic(uint n) {
+  uint passed;
+
+  if (!lapic)
+    return 0;
+  passed = 0;
+  if (n > 0) {
+    n = min(n, 0xFFFFFFFF / TICKCOUNT);
+    passed = (n * TICKCOUNT - lapic[TCCR]) / TICKCOUNT;
+  }
+  lapicw(TIMER, PERIODIC | (TRAP_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT / mycpu()->tickdiv);
+  return passed;
+}
+
+// Make this CPU's periodic timer interrupt div times a tick, for the
+// profiler; trap() counts a tick every div interrupts.
+void lapicrate(uint div) {
+  struct cpu *c = mycpu();
+
+  c->tickdiv = div;
+  c->subtick = 0;
+  if (lapic && !c->tickless)
+    lapicw(TICR, TICKCOUNT / div);
+}
+
 #define CMOS_PORT 0x70
 #define CMOS_RETURN 0x71
 
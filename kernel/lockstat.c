@@ -0,0 +1,96 @@
+// Lock contention statistics.
+//
+// Locks initialized with the same name share a lockclass, so the
+// counters of every buffer's sleeplock, say, add up in one place.
+// acquire() and friends report to the class for the CPU they run on
+// while interrupts are off; lockstat() sums the CPUs.  Building with
+// LOCKSTAT=0 compiles all of it out of the locks.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <lockstat.h>
+#include <param.h>
+#include <proc.h>
+#include <spinlock.h>
+
+// Statically initialized, and so not counted: initlock() takes it
+static struct spinlock classlock = {.name = "lockstat"};
+static struct lockclass classes[NLOCKCLASS];
+static int nclass;
+
+// The class for locks called name of the given kind, or 0 if the
+// table is full.
+struct lockclass *lockclass(char *name, int kind) {
+  struct lockclass *c;
+
+  acquire(&classlock);
+  for (c = classes; c < classes + nclass; c++)
+    if (c->kind == kind && strncmp(c->name, name, 16) == 0)
+      goto found;
+  c = 0;
+  if (nclass < NLOCKCLASS) {
+    c = &classes[nclass++];
+    c->name = name;
+    c->kind = kind;
+  }
+found:
+  release(&classlock);
+  return c;
+}
+
+// Count a lock of class c being taken, after waiting wait cycles if
+// it was contended.  Caller has interrupts off.
+void lockstat_acquire(struct lockclass *c, int contended, uint64_t wait) {
+  struct lockcpu *lc;
+
+  if (c == 0)
+    return;
+  lc = &c->cpu[mycpu() - cpus];
+  lc->acquires++;
+  if (contended) {
+    lc->contended++;
+    lc->wait += wait;
+  }
+}
+
+// Count a hold of hold cycles ending.  Caller has interrupts off.
+void lockstat_release(struct lockclass *c, uint64_t hold) {
+  struct lockcpu *lc;
+
+  if (c == 0)
+    return;
+  lc = &c->cpu[mycpu() - cpus];
+  lc->hold += hold;
+  if (hold > lc->maxhold)
+    lc->maxhold = hold;
+}
+
+// Copy the totals of up to n classes into st, and then, if reset is
+// set, zero them.  Returns the number of classes copied.  The counts
+// of CPUs holding locks meanwhile may be slightly off.
+int lockstats(struct lockstat *st, int n, int reset) {
+  struct lockclass *c;
+  struct lockcpu *lc;
+  int i;
+
+  acquire(&classlock);
+  n = min(n, nclass);
+  for (i = 0; i < n; i++) {
+    c = &classes[i];
+    memset(&st[i], 0, sizeof(st[i]));
+    safestrcpy(st[i].name, c->name, sizeof(st[i].name));
+    st[i].kind = c->kind;
+    for (lc = c->cpu; lc < c->cpu + ncpu; lc++) {
+      st[i].acquires += lc->acquires;
+      st[i].contended += lc->contended;
+      st[i].wait += lc->wait;
+      st[i].hold += lc->hold;
+      st[i].maxhold = max(st[i].maxhold, lc->maxhold);
+    }
+  }
+  if (reset)
+    for (i = 0; i < nclass; i++)
+      memset(classes[i].cpu, 0, sizeof(classes[i].cpu));
+  release(&classlock);
+  return n;
+}
@@ -5,14 +5,29 @@
 #include <memlayout.h>
 #include <trap.h>
 #include <file.h>
+#include <msr.h>
+#include <proc.h>
+#include <x86_64.h>
+#include <x86_64vm.h>
 
+static void startothers(void);
 noreturn static void mpmain(void);
 extern char _end[]; // first address after kernel loaded from ELF file
+extern pml4e_t kpml4_tmp[]; // boot page table, in entry.S
+extern pml4e_t *kpml4;
 
 int main(uint64_t addr) {
+  // mycpu() reads %gs, which seginit() sets up; until then every
+  // lock and per-CPU list needs it to find the boot CPU
+  cpus[0].cpu = &cpus[0];
+  wrmsr(MSR_IA32_GS_BASE, (uint64_t)&cpus[0].cpu);
+
   e820_init(addr);
   detect_memory();
   mem_init(_end); // phys page allocator
+  slabinit();     // small-object caches
+  rmapinit();     // reverse maps of user pages
+  pcacheinit();   // file pages for mmap()
   vspacebootinit();
   mpinit();
   lapicinit();
@@ -20,24 +35,74 @@ int main(uint64_t addr) {
   ioapicinit();
   consoleinit();
   uartinit(); // serial port
+  clockinit(); // calibrate the TSC
   cpuid_print();
+  vspacecpuinit(); // global pages, PCIDs
   e820_print();
   cprintf("\ncpu%d: starting xk\n\n", cpunum());
   cprintf("free pages: %d\n", free_pages);
   pinit();
+  futexinit();  // user-space wait queues
+  shminit();    // shared memory segments
+  uringinit();  // system call rings
   tvinit();   // trap vectors
+  traceinit(); // event tracing
+  profinit();  // sampling profiler
   binit();    // buffer cache
   ideinit();  // disk
   fileinit();
+  startothers(); // start other processors
   userinit(); // first user process
   mpmain();
   return 0;
 }
 
+// Other CPUs jump here from entryother.S, on the kernel's page table
+// and the stack startothers() gave them.
+static void mpenter(void) {
+  seginit();
+  vspacecpuinit();
+  lapicinit();
+  mpmain();
+}
+
 // Common CPU setup code.
 static void mpmain(void) {
   cprintf("cpu%d: starting\n", cpunum());
   idtinit(); // load idt register
-  // xchg(&cpu->started, 1); // tell startothers() we're up
+  xchg(&mycpu()->started, 1); // tell startothers() we're up
   scheduler(); // start running processes
 }
+
+// Start the non-boot (AP) processors, one at a time.
+static void startothers(void) {
+  extern char _binary_out_entryother_start[], _binary_out_entryother_size[];
+  struct cpu *c;
+  char *code, *stack;
+
+  // Write entry code to unused memory at AP_ENTRY.  The linker has
+  // placed the image of entryother.S in _binary_out_entryother_start.
+  code = P2V(AP_ENTRY);
+  memmove(code, _binary_out_entryother_start,
+          (uint64_t)_binary_out_entryother_size);
+
+  for (c = cpus; c < cpus + ncpu; c++) {
+    if (c == mycpu()) // we've started already
+      continue;
+
+    // Tell entryother.S what page tables to use, what stack to use
+    // and where to enter the kernel
+    if ((stack = kalloc()) == 0)
+      panic("startothers: no stack");
+    *(uint64_t *)(code - AP_OFFSET_PGTMP) = V2P(kpml4_tmp);
+    *(uint64_t *)(code - AP_OFFSET_PGTBL) = V2P(kpml4);
+    *(uint64_t *)(code - AP_OFFSET_STACK) = (uint64_t)stack + KSTACKSIZE;
+    *(uint64_t *)(code - AP_OFFSET_ENTRY) = (uint64_t)mpenter;
+
+    lapicstartap(c->apicid, AP_ENTRY);
+
+    // wait for the CPU to finish mpmain()
+    while (c->started == 0)
+      ;
+  }
+}
@@ -0,0 +1,361 @@
+// Page cache: whole pages of file data.
+//
+// read() of a regular file, sendfile() and splice() get file data
+// from here, and so do faults on mmap() regions and program text.
+// That leaves the buffer cache to metadata: directories, the
+// inodefile, the free map and extent trees.  Pages are filled from
+// their blocks through the buffer cache, which stays the one
+// up-to-date image of the disk for the log, but those blocks are
+// released to the cold end of its LRU list.  Streaming a big file
+// through will not push out the blocks that every open() needs.
+//
+// A cached page is mapped as it is, so every process mapping the same
+// part of a file read-only shares one physical page; a writable
+// mapping gets its own copy through the copy-on-write path when it is
+// first written.
+//
+// The cache holds one reference to each of its pages and the
+// mappings and readers hold the rest.  writei() writes new data
+// through to cached pages, so mappings see what read() would.  Text
+// pages are the exception: writing one drops it from the cache
+// instead, so running programs keep the code they started with and
+// the next exec() reads the new file.
+//
+// Replacement is 2Q.  A page read in goes on the probation list in
+// FIFO order, and using it again there counts as part of the same
+// burst: a read() a byte at a time touches one page over and over.
+// An evicted probation page is remembered on the ghost list, and a
+// page read back in while it is remembered goes on the hot list,
+// which is kept in LRU order.  When memory runs short, pages only the
+// cache refers to are given up PCSHRINK at a time, from probation
+// while it holds more than a quarter of the pages.  A file read once,
+// however big, then passes through without displacing the hot pages.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <file.h>
+#include <fs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <spinlock.h>
+
+#define NPCHASH 1021
+#define NGHOST 1024  // evicted probation pages remembered
+#define PCSHRINK 32  // most pages pcacheshrink() frees at a time
+
+struct cpage {
+  uint dev;
+  uint inum;
+  uint pgno;          // page of the file it holds
+  int text;           // is it mapped as program text?
+  int hot;            // on the hot list rather than probation
+  char *data;
+  struct cpage *next; // hash chain
+  struct cpage *lprev; // its list, oldest first
+  struct cpage *lnext;
+};
+
+struct pclist {
+  struct cpage head; // of a circular list; head.lnext is the oldest
+  int n;
+};
+
+static struct {
+  struct spinlock lock;
+  struct kmem_cache *cache;
+  struct cpage *hash[NPCHASH];
+  struct pclist probation;
+  struct pclist hot;
+  struct {
+    uint dev; // 0 if the slot is empty
+    uint inum;
+    uint pgno;
+  } ghost[NGHOST];
+  uint ghostnext; // slot to remember the next eviction in
+} pcache;
+
+int pcache_npage;   // pages cached
+int pcache_hits;    // lookups found in the cache
+int pcache_misses;  // lookups that read the file
+
+void pcacheinit(void) {
+  initlock(&pcache.lock, "pcache");
+  pcache.cache = kmem_cache_create("cpage", sizeof(struct cpage), 0);
+  pcache.probation.head.lprev = pcache.probation.head.lnext =
+      &pcache.probation.head;
+  pcache.hot.head.lprev = pcache.hot.head.lnext = &pcache.hot.head;
+}
+
+static struct cpage **pchash(uint dev, uint inum, uint pgno) {
+  return &pcache.hash[(dev * 31 + inum * 17 + pgno) % NPCHASH];
+}
+
+// The cached page pgno of ip, or 0.  Caller must hold pcache.lock.
+static struct cpage *pcfind(struct inode *ip, uint pgno) {
+  struct cpage *c;
+
+  for (c = *pchash(ip->dev, ip->inum, pgno); c; c = c->next)
+    if (c->dev == ip->dev && c->inum == ip->inum && c->pgno == pgno)
+      return c;
+  return 0;
+}
+
+// Put c at the young end of the hot list if hot, else of probation.
+// Caller must hold pcache.lock.
+static void pclink(struct cpage *c, int hot) {
+  struct pclist *l = hot ? &pcache.hot : &pcache.probation;
+
+  c->hot = hot;
+  c->lprev = l->head.lprev;
+  c->lnext = &l->head;
+  l->head.lprev->lnext = c;
+  l->head.lprev = c;
+  l->n++;
+}
+
+static void pcunlink(struct cpage *c) {
+  c->lprev->lnext = c->lnext;
+  c->lnext->lprev = c->lprev;
+  (c->hot ? &pcache.hot : &pcache.probation)->n--;
+}
+
+// Was page pgno of ip evicted from probation lately?  Forgets it.
+// Caller must hold pcache.lock.
+static int ghosttake(struct inode *ip, uint pgno) {
+  int i;
+
+  for (i = 0; i < NGHOST; i++) {
+    if (pcache.ghost[i].dev == ip->dev && pcache.ghost[i].inum == ip->inum &&
+        pcache.ghost[i].pgno == pgno) {
+      pcache.ghost[i].dev = 0;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Take c out of the cache and drop the cache's reference to its page,
+// remembering it if evict is set and it was on probation.
+// Caller must hold pcache.lock.
+static void pcfree(struct cpage *c, int evict) {
+  struct cpage **pp;
+  uint g;
+
+  for (pp = pchash(c->dev, c->inum, c->pgno); *pp != c; pp = &(*pp)->next)
+    ;
+  *pp = c->next;
+  pcunlink(c);
+  if (evict && !c->hot) {
+    g = pcache.ghostnext++ % NGHOST;
+    pcache.ghost[g].dev = c->dev;
+    pcache.ghost[g].inum = c->inum;
+    pcache.ghost[g].pgno = c->pgno;
+  }
+  pcache_npage--;
+  kfree(c->data);
+  kmem_cache_free(pcache.cache, c);
+}
+
+// Returns page pgno of ip, reading it in if it is not cached, with a
+// reference for the caller, who maps it as program text if text is
+// set.  The part past the end of the file reads as zeros.  Returns 0
+// if there is no memory.  Caller must hold ip->lock and know the page
+// is not wholly past the end of the file.
+static char *pcpage(struct inode *ip, uint pgno, int text) {
+  struct cpage *c;
+  char *data;
+
+  for (;;) {
+    acquire(&pcache.lock);
+    if ((c = pcfind(ip, pgno)) != 0) {
+      data = c->data;
+      c->text |= text;
+      if (c->hot) {
+        pcunlink(c);
+        pclink(c, 1);
+      }
+      increment_ref(pa2page(V2P(data)));
+      release(&pcache.lock);
+      __sync_fetch_and_add(&pcache_hits, 1);
+      return data;
+    }
+    release(&pcache.lock);
+
+    if ((data = kalloc_zeroed()) == 0 ||
+        (c = kmem_cache_alloc(pcache.cache)) == 0) {
+      if (data)
+        kfree(data);
+      return 0;
+    }
+    readiraw(ip, data, pgno * PGSIZE, PGSIZE);
+    __sync_fetch_and_add(&pcache_misses, 1);
+
+    // Another reader sharing the inode lock may have raced us here
+    acquire(&pcache.lock);
+    if (pcfind(ip, pgno) == 0) {
+      c->dev = ip->dev;
+      c->inum = ip->inum;
+      c->pgno = pgno;
+      c->text = text;
+      c->data = data;
+      c->next = *pchash(ip->dev, ip->inum, pgno);
+      *pchash(ip->dev, ip->inum, pgno) = c;
+      pclink(c, ghosttake(ip, pgno));
+      pcache_npage++;
+      increment_ref(pa2page(V2P(data)));
+      release(&pcache.lock);
+      return data;
+    }
+    release(&pcache.lock);
+    kmem_cache_free(pcache.cache, c);
+    kfree(data);
+  }
+}
+
+// Returns page pgno of ip with a reference for the caller, as
+// pcpage() does, or 0 if the page lies wholly past the end of the
+// file or there is no memory.
+char *pcacheget(struct inode *ip, uint pgno, int text) {
+  char *data;
+
+  locki_shared(ip);
+  if ((uint64_t)pgno * PGSIZE >= ip->size) {
+    unlocki(ip);
+    return 0;
+  }
+  data = pcpage(ip, pgno, text);
+  unlocki(ip);
+  return data;
+}
+
+// Copy the n bytes of ip at off, all within the file, to dst through
+// the cache.  Returns the number of bytes copied.
+// Caller must hold ip->lock.
+int pcacheread(struct inode *ip, char *dst, uint off, uint n) {
+  uint done, m;
+  char *data;
+  int r;
+
+  for (done = 0; done < n; done += m) {
+    m = min(n - done, PGSIZE - (off + done) % PGSIZE);
+    if ((data = pcpage(ip, (off + done) / PGSIZE, 0)) == 0) {
+      // No memory for the page; read around the cache
+      if ((r = readiraw(ip, dst + done, off + done, m)) != m)
+        return done + max(r, 0);
+      continue;
+    }
+    memmove(dst + done, data + (off + done) % PGSIZE, m);
+    kfree(data);
+  }
+  return done;
+}
+
+// Hand fn the n bytes of ip at off, or as many of them as lie in off's
+// page, straight out of the cache.  Returns what fn returns, or -1 if
+// there is no memory for the page.  Caller must hold ip->lock and know
+// off is within the file.
+int pcacheapply(struct inode *ip, uint off, uint n,
+                int (*fn)(char *, int, void *), void *arg) {
+  char *data;
+  int r;
+
+  if ((data = pcpage(ip, off / PGSIZE, 0)) == 0)
+    return -1;
+  r = fn(data + off % PGSIZE, min(n, PGSIZE - off % PGSIZE), arg);
+  kfree(data);
+  return r;
+}
+
+// Is page pgno of ip cached?
+int pcached(struct inode *ip, uint pgno) {
+  int r;
+
+  acquire(&pcache.lock);
+  r = pcfind(ip, pgno) != 0;
+  release(&pcache.lock);
+  return r;
+}
+
+// Bring the cached pages of ip over [off, off + n) up to date with
+// what was just written there, or drop them if they are text.
+// Caller must hold ip->lock exclusively.
+void pcacheupdate(struct inode *ip, uint off, uint n) {
+  struct cpage *c;
+  char *data;
+  uint pg, start, end;
+
+  if (pcache_npage == 0 || n == 0)
+    return;
+
+  for (pg = off / PGSIZE; pg <= (off + n - 1) / PGSIZE; pg++) {
+    acquire(&pcache.lock);
+    if ((c = pcfind(ip, pg)) == 0) {
+      release(&pcache.lock);
+      continue;
+    }
+    if (c->text) {
+      pcfree(c, 0);
+      release(&pcache.lock);
+      continue;
+    }
+    data = c->data;
+    increment_ref(pa2page(V2P(data)));
+    release(&pcache.lock);
+
+    start = max(off, pg * PGSIZE);
+    end = min(off + n, (pg + 1) * PGSIZE);
+    readiraw(ip, data + start % PGSIZE, start, end - start);
+    kfree(data);
+  }
+}
+
+// Drop the cache's pages of ip, whose file is being deleted.  Pages
+// still mapped live on until they are unmapped.
+void pcacheforget(struct inode *ip) {
+  struct pclist *lists[] = {&pcache.probation, &pcache.hot};
+  struct cpage *c, *next;
+  int i;
+
+  acquire(&pcache.lock);
+  for (i = 0; i < NELEM(lists); i++) {
+    for (c = lists[i]->head.lnext; c != &lists[i]->head; c = next) {
+      next = c->lnext;
+      if (c->dev == ip->dev && c->inum == ip->inum)
+        pcfree(c, 0);
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Free up to PCSHRINK cached pages no process maps, oldest first, from
+// probation before the hot list unless probation is down to a quarter
+// of the pages.  Called by kalloc() when it runs out of memory.
+// Returns the number of pages freed.
+int pcacheshrink(void) {
+  struct pclist *lists[2];
+  struct cpage *c, *next;
+  int i, n;
+
+  n = 0;
+  acquire(&pcache.lock);
+  if (pcache.probation.n * 4 > pcache_npage) {
+    lists[0] = &pcache.probation;
+    lists[1] = &pcache.hot;
+  } else {
+    lists[0] = &pcache.hot;
+    lists[1] = &pcache.probation;
+  }
+  for (i = 0; i < 2 && n < PCSHRINK; i++) {
+    for (c = lists[i]->head.lnext; c != &lists[i]->head && n < PCSHRINK;
+         c = next) {
+      next = c->lnext;
+      if (pa2page(V2P(c->data))->ref_count == 1) {
+        pcfree(c, 1);
+        n++;
+      }
+    }
+  }
+  release(&pcache.lock);
+  return n;
+}
@@ -0,0 +1,99 @@
+// Waiting on several files at once, for poll().
+//
+// A poll() that finds nothing ready puts a pollent on the queue of
+// each file it waits on, then sleeps on its pollset.  Whatever makes
+// one of those files readable or writable, or hangs it up, calls
+// pollwake() on its queue, which marks the pollsets there ready and
+// wakes them.  Only the files' own pollers are woken.
+//
+// polllock guards the ready flags, so a wakeup between a poll()
+// looking at its files and going to sleep is not lost.  It nests
+// inside the files' locks and tickslock.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <poll.h>
+#include <proc.h>
+#include <spinlock.h>
+#include <timer.h>
+
+static struct spinlock polllock;
+
+void pollinit(void) {
+  initlock(&polllock, "poll");
+}
+
+// Put e, for ps, on the queue q of a file guarded by lock, which the
+// caller holds.
+void pollqueue(struct pollent **q, struct spinlock *lock,
+               struct pollent *e, struct pollset *ps) {
+  e->ps = ps;
+  e->lock = lock;
+  if ((e->next = *q) != 0)
+    e->next->pprev = &e->next;
+  e->pprev = q;
+  *q = e;
+}
+
+// Take e off the queue it is on, if any.
+void polldequeue(struct pollent *e) {
+  if (!e->pprev)
+    return;
+  acquire(e->lock);
+  if (e->next)
+    e->next->pprev = e->pprev;
+  *e->pprev = e->next;
+  e->pprev = 0;
+  release(e->lock);
+}
+
+// Wake the polls waiting on queue q.  Caller holds q's lock.
+void pollwake(struct pollent *q) {
+  if (q == 0)
+    return;
+  acquire(&polllock);
+  for (; q; q = q->next) {
+    q->ps->ready = 1;
+    wakeup(q->ps);
+  }
+  release(&polllock);
+}
+
+static void pollexpire(void *ps) {
+  acquire(&polllock);
+  ((struct pollset *)ps)->ready = 1;
+  wakeup(ps);
+  release(&polllock);
+}
+
+// Clear ps, before poll() looks at its files.
+void pollstart(struct pollset *ps) {
+  acquire(&polllock);
+  ps->ready = 0;
+  release(&polllock);
+}
+
+// Sleep until a file ps waits on changes, or for at most timeout
+// ticks unless timeout is negative.  Returns -1 if the process was
+// killed.
+int pollsleep(struct pollset *ps, int timeout) {
+  struct timer t;
+
+  t.pprev = 0;
+  if (timeout >= 0) {
+    acquire(&tickslock);
+    timeradd(&t, timeout, pollexpire, ps);
+    release(&tickslock);
+  }
+  acquire(&polllock);
+  while (!ps->ready && !myproc()->killed)
+    sleep(ps, &polllock);
+  release(&polllock);
+  if (timeout >= 0) {
+    acquire(&tickslock);
+    timerdel(&t);
+    release(&tickslock);
+  }
+  return myproc()->killed ? -1 : 0;
+}
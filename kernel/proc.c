@@ -6,7 +6,9 @@
 #include <mmu.h>
 #include <param.h>
 #include <proc.h>
+#include <scstat.h>
 #include <spinlock.h>
+#include <trace.h>
 #include <trap.h>
 #include <x86_64.h>
 #include <fs.h>
@@ -15,20 +17,58 @@
 
 
 
-// process table
+// process table; the lock guards allocating entries, the pid hash
+// and the parent and child links between them.  Procs come from a
+// slab cache, so the table only costs memory for the processes there
+// are, up to NPROC of them.
+#define NPIDHASH 64
+
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct kmem_cache *cache;
+  int nproc;                      // procs allocated
+  struct proc *pidhash[NPIDHASH]; // live processes by pid
 } ptable;
 
+// Each CPU runs the RUNNABLE processes on its own queue and takes one
+// from the longest other queue when its own is empty.  A process goes
+// back on the queue of the CPU it last ran on.
+//
+// Queues are multi-level feedback queues: a CPU runs the first
+// process of the highest non-empty level.  A process starts at the
+// top; using up a slice, which doubles in length at each level down,
+// moves it down one, and waking from sleep moves it up one, so
+// processes that mostly wait for I/O stay above those that compute.
+// nice() pushes a process further down.  Every SCHEDBOOST ticks
+// everyone goes back to the top, so nothing starves.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  int n;
+  uint epoch;   // last priority boost applied to the queue
+} runqs[NCPU];
+
+// SLEEPING processes, hashed by the channel they sleep on, so
+// wakeup() only looks at the processes it may wake.  Each queue is
+// first in first out.
+#define NSLEEPQ 64
+
+struct sleepq {
+  struct spinlock lock;
+  struct proc *head;
+} sleepqs[NSLEEPQ];
+
+// Lock order: ptable.lock, a sleep queue's lock, p->lock, then a run
+// queue's lock.
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
+static void kthreadmain(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 // to test crash safety in lab5,
 // we trigger restarts in the middle of file operations
 void reboot(void) {
@@ -41,35 +81,301 @@ loop:
   goto loop;
 }
 
-void pinit(void) { initlock(&ptable.lock, "ptable"); }
+// A proc's lock outlives it, so a proc handed out again comes with
+// its lock initialized.
+static void procctor(void *v) {
+  struct proc *p = v;
 
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
-// state required to run in the kernel.
-// Otherwise return 0.
-static struct proc *allocproc(void) {
+  memset(p, 0, sizeof *p);
+  initlock(&p->lock, "proc");
+}
+
+void pinit(void) {
+  int i;
+
+  initlock(&ptable.lock, "ptable");
+  ptable.cache = kmem_cache_create("proc", sizeof(struct proc), procctor);
+  for (i = 0; i < NCPU; i++)
+    initlock(&runqs[i].lock, "runq");
+  for (i = 0; i < NSLEEPQ; i++)
+    initlock(&sleepqs[i].lock, "sleepq");
+}
+
+// Channels are addresses, often page aligned, so mix the high bits in.
+static struct sleepq *chanq(void *chan) {
+  return &sleepqs[((uint64_t)chan * 0x9e3779b97f4a7c15ULL) >> 58];
+}
+
+// After n processes are queued for cpus[id], wake it if it is halted
+// in schedidle(), or wake another halted CPU to steal one if cpus[id]
+// now has more than it can run.  Interrupts must be off.
+static void runqkick(int id, int n) {
+  struct cpu *c;
+
+  // Our queue write must come before we read idle; schedidle() does
+  // the reverse, so one of us sees the other
+  __sync_synchronize();
+  c = &cpus[id];
+  if (!c->idle) {
+    if (n < 2)
+      return;
+    for (c = cpus; c < cpus + ncpu && !c->idle; c++)
+      ;
+    if (c == cpus + ncpu)
+      return;
+  }
+  // A CPU idling under us will look at the queues when we return
+  if (c != mycpu())
+    lapicwake(c->apicid);
+}
+
+// Nothing to run: halt until an interrupt.  CPUs other than the boot
+// CPU turn their timers off until runqkick() or a device wakes them.
+// The boot CPU counts ticks, so it only stops its periodic tick when
+// every other CPU is idle too; it then sets the timer to go off at the
+// next timer deadline and catches ticks up when it wakes.  A CPU that
+// wakes while the boot CPU is tickless wakes it too, to keep ticks.
+static void schedidle(void) {
+  struct cpu *c, *o;
+  struct runq *rq;
+  uint n, passed;
+  uint64_t t0;
+
+  cli();
+  c = mycpu();
+  xchg(&c->idle, 1);
+  for (rq = runqs; rq < &runqs[ncpu]; rq++) {
+    if (rq->n > 0) {
+      c->idle = 0;
+      sti();
+      return;
+    }
+  }
+
+  n = 0;
+  xchg(&c->tickless, 1);
+  if (c == &cpus[0]) {
+    for (o = cpus; o < cpus + ncpu && (o == c || o->idle); o++)
+      ;
+    if (o < cpus + ncpu) {
+      c->tickless = 0;
+    } else {
+      acquire(&tickslock);
+      n = timernext(IDLEMAXTICKS);
+      release(&tickslock);
+    }
+  }
+  if (c->tickless)
+    lapiconeshot(n);
+  t0 = rdtsc();
+  asm volatile("sti; hlt");
+  cli();
+  c->idlecycles += rdtsc() - t0;
+  passed = c->tickless ? lapicperiodic(n) : 0;
+  c->tickless = 0;
+  xchg(&c->idle, 0);
+  if (c != &cpus[0] && cpus[0].tickless)
+    lapicwake(cpus[0].apicid);
+
+  if (passed > 0) {
+    acquire(&tickslock);
+    while (passed-- > 0) {
+      ticks++;
+      timertick();
+    }
+    release(&tickslock);
+  }
+  sti();
+}
+
+// The level p runs at: its own, pushed down by its nice value.
+static int schedlevel(struct proc *p) {
+  return min(p->prio + p->nice * NPRIO / (NICE_MAX + 1), NPRIO - 1);
+}
+
+// Queue p, which was just made RUNNABLE, on its run queue.
+// Caller must hold p->lock.
+static void runqput(struct proc *p) {
+  struct runq *rq = &runqs[p->rq];
+  int lvl, n;
+
+  if (p->epoch != ticks / SCHEDBOOST) {
+    p->epoch = ticks / SCHEDBOOST;
+    p->prio = 0;
+  }
+  lvl = schedlevel(p);
+
+  acquire(&rq->lock);
+  p->rqnext = 0;
+  if (rq->tail[lvl])
+    rq->tail[lvl]->rqnext = p;
+  else
+    rq->head[lvl] = p;
+  rq->tail[lvl] = p;
+  n = ++rq->n;
+  release(&rq->lock);
+  runqkick(p->rq, n);
+}
+
+// Move everything on rq up to the top level, oldest first, if a
+// priority boost has happened since it last was.  Caller must hold
+// rq->lock.
+static void runqboost(struct runq *rq) {
+  int lvl;
+
+  if (rq->epoch == ticks / SCHEDBOOST)
+    return;
+  rq->epoch = ticks / SCHEDBOOST;
+  for (lvl = 1; lvl < NPRIO; lvl++) {
+    if (rq->head[lvl] == 0)
+      continue;
+    if (rq->tail[0])
+      rq->tail[0]->rqnext = rq->head[lvl];
+    else
+      rq->head[0] = rq->head[lvl];
+    rq->tail[0] = rq->tail[lvl];
+    rq->head[lvl] = rq->tail[lvl] = 0;
+  }
+}
+
+// Take the first process off rq.  A thief, steal set, gives up
+// rather than wait behind the queue's own CPU.
+static struct proc *runqpop(struct runq *rq, int steal) {
   struct proc *p;
-  char *sp;
+  int lvl;
 
-  acquire(&ptable.lock);
+  p = 0;
+  if (steal) {
+    if (!tryacquire(&rq->lock))
+      return 0;
+  } else {
+    acquire(&rq->lock);
+  }
+  runqboost(rq);
+  for (lvl = 0; lvl < NPRIO; lvl++) {
+    if ((p = rq->head[lvl]) != 0) {
+      if ((rq->head[lvl] = p->rqnext) == 0)
+        rq->tail[lvl] = 0;
+      rq->n--;
+      break;
+    }
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// The next process for this CPU to run, from its own queue or else
+// stolen from the busiest other one, or 0 if nothing is runnable.
+// The process is still RUNNABLE but off every queue, so no other CPU
+// will pick it.
+static struct proc *runqget(void) {
+  struct runq *rq, *busiest;
+  struct proc *p;
 
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if (p->state == UNUSED)
-      goto found;
+  if ((p = runqpop(&runqs[mycpu() - cpus], 0)) != 0)
+    return p;
 
-  release(&ptable.lock);
+  // The counts are only a hint; runqpop() rechecks under the lock
+  busiest = 0;
+  for (rq = runqs; rq < &runqs[ncpu]; rq++)
+    if (rq->n > 0 && (busiest == 0 || rq->n > busiest->n))
+      busiest = rq;
+  return busiest ? runqpop(busiest, 1) : 0;
+}
+
+static struct proc **pidchain(int pid) {
+  return &ptable.pidhash[(uint)pid % NPIDHASH];
+}
+
+// The process with the given pid, or 0.  Caller must hold ptable.lock.
+static struct proc *pidlookup(int pid) {
+  struct proc *p;
+
+  for (p = *pidchain(pid); p; p = p->pidnext)
+    if (p->pid == pid)
+      return p;
   return 0;
+}
+
+// Take p out of the pid hash, and off its parent's list of children
+// if it has a parent, before its entry is freed.  Caller must hold
+// ptable.lock.
+static void procunlink(struct proc *p) {
+  struct proc **pp;
+
+  for (pp = pidchain(p->pid); *pp != p; pp = &(*pp)->pidnext)
+    ;
+  *pp = p->pidnext;
+  if (p->parent) {
+    for (pp = &p->parent->children; *pp != p; pp = &(*pp)->sibling)
+      ;
+    *pp = p->sibling;
+  }
+}
+
+// The next pid no live process has.  Pids count up to PID_MAX and
+// then start over, skipping those still in use, so a pid is not
+// reused until the counter comes round again.  Caller must hold
+// ptable.lock.
+static int pidalloc(void) {
+  int pid;
+
+  do {
+    pid = nextpid;
+    nextpid = nextpid == PID_MAX ? 1 : nextpid + 1;
+  } while (pidlookup(pid));
+  return pid;
+}
+
+// Give back a proc allocproc() made.  Caller must hold ptable.lock.
+static void procfree(struct proc *p) {
+  p->state = UNUSED;
+  ptable.nproc--;
+  kmem_cache_free(ptable.cache, p);
+}
+
+// Allocate a proc, in state EMBRYO, with a pid and the state
+// required to run in the kernel.  Returns 0 if there are already
+// NPROC processes or no memory.
+static struct proc *allocproc(void) {
+  struct proc *p;
+  char *sp;
+
+  acquire(&ptable.lock);
+  if (ptable.nproc == NPROC ||
+      (p = kmem_cache_alloc(ptable.cache)) == 0) {
+    release(&ptable.lock);
+    return 0;
+  }
+  ptable.nproc++;
 
-found:
   p->state = EMBRYO;
-  p->pid = nextpid++;
+  p->pid = pidalloc();
   p->killed = 0;
+  p->rq = mycpu() - cpus;
+  p->prio = 0;
+  p->nice = 0;
+  p->sliceused = 0;
+  p->epoch = ticks / SCHEDBOOST;
+  p->cputicks = 0;
+  p->nsyscall = p->syscycles = 0;
+  p->parent = 0;
+  p->children = 0;
+  p->group = p;
+  p->nthreads = 1;
+  p->ring = 0;
+  p->kfn = 0;
+  p->pidnext = *pidchain(p->pid);
+  *pidchain(p->pid) = p;
 
   release(&ptable.lock);
 
   // Allocate kernel stack.
-  if ((p->kstack = kalloc()) == 0) {
-    p->state = UNUSED;
+  if ((p->kstack = kstackalloc()) == 0) {
+    acquire(&ptable.lock);
+    procunlink(p);
+    procfree(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -113,9 +419,10 @@ void userinit(void) {
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
   p->state = RUNNABLE;
-  release(&ptable.lock);
+  runqput(p);
+  release(&p->lock);
 }
 
 // Create a new process copying p as the parent.
@@ -125,99 +432,368 @@ int fork(void) {
 
   // Create new process
   struct proc* new_proc = allocproc();
-
-  acquire(&ptable.lock);
   struct proc* curr_proc = myproc();
 
-  // Initialize virtual space
+  // Copy over the file descriptors from parent process, before the
+  // child can run, and count the new references.  This takes the
+  // pipe locks, so it can't be done under ptable.lock.  The copy is
+  // made under global_files.lock too, so that a sibling thread's
+  // close() can't leave the child a descriptor it never counted.
+  acquiresleep(&global_files.lock);
+  memmove(&new_proc->file_array, &curr_proc->group->file_array, sizeof(new_proc->file_array));
+  for (int i = 0; i < NOFILE; i++) {
+    if (new_proc->file_array[i].available == DESC_NOT_AVAIL) {
+      filedup(new_proc->file_array[i].fileptr);
+    }
+  }
+  releasesleep(&global_files.lock);
+
+  // Initialize virtual space.  Done before taking ptable.lock so that
+  // running short of memory can swap; the child is still an embryo,
+  // which the swapper leaves alone.
   vspaceinit(&new_proc->vspace);
-  vspacecopy(&new_proc->vspace, &curr_proc->vspace);
+  acquiresleep(&curr_proc->group->vspace.lock);
+  vspacecopy(&new_proc->vspace, &curr_proc->group->vspace);
+  releasesleep(&curr_proc->group->vspace.lock);
+
+  // Copy trap frame
+  memmove(new_proc->tf, curr_proc->tf, sizeof(struct trap_frame));
+
+  // Copy 0 into rax for child
+  new_proc->tf->rax = 0;
+
+  new_proc->nice = curr_proc->nice;
 
   // set the curr_proc as the parent proce of new process
+  acquire(&ptable.lock);
   new_proc->parent = curr_proc;
+  new_proc->sibling = curr_proc->children;
+  curr_proc->children = new_proc;
+  release(&ptable.lock);
 
   // set new proc state to RUNNABLE
+  acquire(&new_proc->lock);
   new_proc->state = RUNNABLE;
-  
-  // Copy trap frame
-  memmove(new_proc->tf, curr_proc->tf, sizeof(struct trap_frame));
+  runqput(new_proc);
+  release(&new_proc->lock);
+  vspaceinstall(myproc());
+  return new_proc->pid;
+}
 
-  // Copy 0 into rax for child
-  new_proc->tf->rax = 0;
+// Start a thread of the current process, a child of the caller,
+// running fn(arg) in user space on the stack whose top is stack.  It
+// shares the process's vspace and open files.  fn must end the thread
+// with exit(); returning from it jumps to address 0.  Returns the
+// thread's pid, or -1.
+int clone(uint64_t fn, uint64_t stack, uint64_t arg) {
+  struct proc *p, *curproc = myproc(), *g = curproc->group;
+  uint64_t sp, ret = 0;
+
+  // Enter fn as if it had been called, with the stack aligned
+  sp = (stack & ~0xf) - sizeof(ret);
+  if (copyout(sp, &ret, sizeof(ret)) < 0 || (p = allocproc()) == 0)
+    return -1;
+
+  memmove(p->tf, curproc->tf, sizeof(*p->tf));
+  p->tf->rip = fn;
+  p->tf->rsp = sp;
+  p->tf->rdi = arg;
+  p->nice = curproc->nice;
+  safestrcpy(p->name, curproc->name, sizeof(p->name));
 
-  // Copy over the file descriptors from parent process
-  memmove(&new_proc->file_array, &curr_proc->file_array, sizeof(struct desc) * 16);
-  
-  // increment all global file reference counts to match the additional file descriptors. 
-  for (int i = 0; i < NOFILE; i++) {
-    if (curr_proc->file_array[i].available == DESC_NOT_AVAIL) {
-      curr_proc->file_array[i].fileptr->ref_count++;
+  acquire(&ptable.lock);
+  // A process that is exiting is waiting for its threads to go
+  if (g->killed) {
+    procunlink(p);
+    kstackfree(p->kstack);
+    procfree(p);
+    release(&ptable.lock);
+    return -1;
+  }
+  p->group = g;
+  g->nthreads++;
+  p->parent = curproc;
+  p->sibling = curproc->children;
+  curproc->children = p;
+  release(&ptable.lock);
+
+  acquire(&p->lock);
+  p->state = RUNNABLE;
+  runqput(p);
+  release(&p->lock);
+  return p->pid;
+}
+
+// Start the program at path, run with the null-terminated argument
+// strings argv, in a new child process, without copying the current
+// process' image the way fork() then exec() would.  The child's
+// standard input, output and error are duplicates of the descriptors
+// fds[0], fds[1] and fds[2], where -1 leaves one closed, and it has no
+// other descriptors; if fds is 0 it gets all of ours instead.  The
+// caller has checked the arguments.  Returns the child's pid, or -1.
+int spawn(char *path, char **argv, int *fds) {
+  struct proc *p, *curproc = myproc();
+  struct desc *d;
+  int i, fd;
+
+  if ((p = allocproc()) == 0)
+    return -1;
+
+  memset(p->tf, 0, sizeof(*p->tf));
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  p->tf->ss = (SEG_UDATA << 3) | DPL_USER;
+  p->tf->rflags = FLAGS_IF;
+  if (execload(&p->vspace, path, argv, p->tf) < 0) {
+    kstackfree(p->kstack);
+    p->kstack = 0;
+    acquire(&ptable.lock);
+    procunlink(p);
+    procfree(p);
+    release(&ptable.lock);
+    return -1;
+  }
+
+  acquiresleep(&global_files.lock);
+  for (i = 0; i < NOFILE; i++) {
+    fd = fds ? (i < 3 ? fds[i] : -1) : i;
+    if (fd < 0 || fd >= NOFILE ||
+        curproc->group->file_array[fd].available != DESC_NOT_AVAIL) {
+      p->file_array[i].available = DESC_AVAIL;
+      continue;
     }
+    d = &curproc->group->file_array[fd];
+    p->file_array[i] = *d;
+    filedup(d->fileptr);
   }
+  releasesleep(&global_files.lock);
+
+  p->nice = curproc->nice;
+
+  acquire(&ptable.lock);
+  p->parent = curproc;
+  p->sibling = curproc->children;
+  curproc->children = p;
   release(&ptable.lock);
-  vspaceinstall(myproc());
-  return new_proc->pid;
+
+  acquire(&p->lock);
+  p->state = RUNNABLE;
+  runqput(p);
+  release(&p->lock);
+  return p->pid;
+}
+
+// Start a kernel thread, named name, calling fn(arg) at the given
+// nice value.  A kernel thread is scheduled like any process but runs
+// only in the kernel, on the kernel's page table, with no user
+// address space or open files, for work such as flushing the caches
+// that no process should have to wait for.  If it returns, init
+// reaps it.  One that uses the file system must not do so before
+// the first process has run iinit().  Returns its pid, or -1.
+int kthread_create(void (*fn)(void *), void *arg, char *name, int nice) {
+  struct proc *p;
+
+  if ((p = allocproc()) == 0)
+    return -1;
+  memset(&p->vspace, 0, sizeof(p->vspace));
+  memset(p->file_array, 0, sizeof(p->file_array));
+  p->kfn = fn;
+  p->karg = arg;
+  p->nice = max(0, min(nice, NICE_MAX));
+  p->context->rip = (uint64_t)kthreadmain;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&p->lock);
+  p->state = RUNNABLE;
+  runqput(p);
+  release(&p->lock);
+  return p->pid;
+}
+
+// Start a kernel thread calling fn(arg), like kthread_create()'s, but
+// as a thread of the calling process: it runs on the process's page
+// table, with its files, so it can make system calls on its behalf.
+// It is killed when the process exits, and fn must then call exit().
+// Returns its pid, or -1.
+int kthread_clone(void (*fn)(void *), void *arg, char *name) {
+  struct proc *p, *g = myproc()->group;
+
+  if ((p = allocproc()) == 0)
+    return -1;
+  p->kfn = fn;
+  p->karg = arg;
+  p->nice = g->nice;
+  p->context->rip = (uint64_t)kthreadmain;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  if (g->killed) {
+    procunlink(p);
+    kstackfree(p->kstack);
+    procfree(p);
+    release(&ptable.lock);
+    return -1;
+  }
+  p->group = g;
+  g->nthreads++;
+  p->parent = g;
+  p->sibling = g->children;
+  g->children = p;
+  release(&ptable.lock);
+
+  acquire(&p->lock);
+  p->state = RUNNABLE;
+  runqput(p);
+  release(&p->lock);
+  return p->pid;
+}
+
+// A kernel thread's first scheduling swtch()es here.
+static void kthreadmain(void) {
+  struct proc *p = myproc();
+
+  // Still holding p->lock from scheduler.
+  release(&p->lock);
+  p->kfn(p->karg);
+
+  // Done: become init's zombie child
+  acquire(&ptable.lock);
+  if (initproc == 0)
+    panic("kthread exited before init");
+  p->parent = initproc;
+  p->sibling = initproc->children;
+  initproc->children = p;
+  wakeup(initproc);
+  acquire(&p->lock);
+  p->state = ZOMBIE;
+  release(&ptable.lock);
+  sched();
+  panic("zombie kthread ran");
+}
+
+// Mark every thread of process g killed, waking those asleep, so
+// they exit.  Caller must hold ptable.lock.
+static void killthreads(struct proc *g) {
+  struct proc *p;
+  void *chan;
+  int h;
+
+  for (h = 0; h < NPIDHASH; h++) {
+    for (p = ptable.pidhash[h]; p; p = p->pidnext) {
+      if (p == g || p->group != g)
+        continue;
+      acquire(&p->lock);
+      p->killed = 1;
+      chan = p->state == SLEEPING ? p->chan : 0;
+      release(&p->lock);
+      if (chan)
+        wakeup(chan);
+    }
+  }
 }
 
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
 void exit(void) {
-  acquire(&ptable.lock);
+  struct proc *curproc = myproc();
 
-  myproc()->state = ZOMBIE;
-  
-  // Decrement ref counts to global_files
-  for (int i = 0; i < NOFILE; i++) {
-    // If we are using a file descriptor, then decrement ref count of the file it points to
-    struct desc curr_file = myproc()->file_array[i];
-    if (curr_file.available == DESC_NOT_AVAIL) {
-      curr_file.fileptr->ref_count--;
-      if (curr_file.fileptr->ref_count <= 0) {
-        // Deallocate resource depending on if its a file or a pipe
-        if (curr_file.fileptr->file_type == FILE) {
-          irelease(curr_file.fileptr->inodep);
-        } else if (curr_file.fileptr->file_type == PIPE) {
-          struct pipe* pipe = curr_file.fileptr->pipeptr;
-          int ref_count = 0;
-          for (int i = 0; i < NFILE; i++) {
-            struct file i_file = global_files.files[i];
-            if (i_file.available == FILE_NOT_AVAIL && i_file.file_type == PIPE && i_file.pipeptr == pipe) {
-              ref_count += i_file.ref_count;
-            }
-          }
-          // Signal all threads waiting on the pipe
-          wakeup1(pipe);
-
-          // Free pipe if no references to it anymore
-          if (ref_count == 0) {
-            kfree((char*) pipe);
-          }
-        }
-        curr_file.fileptr->available = FILE_AVAIL;
+  // A thread leaves the files and vspace to the process; a process
+  // first has its threads exit, as they use them.
+  if (!ISTHREAD(curproc)) {
+    acquire(&ptable.lock);
+    if (curproc->nthreads > 1) {
+      curproc->killed = 1; // and clone() makes no more
+      killthreads(curproc);
+      while (curproc->nthreads > 1)
+        sleep(curproc, &ptable.lock);
+    }
+    release(&ptable.lock);
+
+    if (curproc->ring) {
+      ringfree(curproc->ring);
+      curproc->ring = 0;
+    }
+
+    // Close all open files first; closing a pipe end takes its lock,
+    // so it can't be done under ptable.lock.
+    acquiresleep(&global_files.lock);
+    for (int i = 0; i < NOFILE; i++) {
+      if (curproc->file_array[i].available == DESC_NOT_AVAIL) {
+        fileclose(curproc->file_array[i].fileptr);
+        curproc->file_array[i].available = DESC_AVAIL;
       }
     }
+    releasesleep(&global_files.lock);
 
-    //vspacefree(&myproc()->vspace);
+    // Free the address space now rather than in wait(), so a zombie
+    // holds no memory and the pages it shared copy-on-write are
+    // others' alone again.  It is moved off the process first, with
+    // the kernel's page table loaded, so the scheduler never loads
+    // the page table being freed.
+    if (!curproc->kfn) {
+      struct vspace vs;
+
+      pushcli();
+      vspaceinstallkern();
+      vspacemove(&vs, &curproc->vspace);
+      curproc->vspace.pgtbl = 0;
+      popcli();
+      vspacefree(&vs);
+    }
   }
 
-  // Hand over children to init process
-  for (struct proc *p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-      // All children are now owned by init
-      if (p->parent == myproc()) {
-        p->parent = initproc;
-      }
+  acquire(&ptable.lock);
+
+  // Hand over children to init process, waking it if some of them
+  // have exited already
+  struct proc *p, *next;
+  int zombies = 0;
+  for (p = myproc()->children; p; p = next) {
+    next = p->sibling;
+    p->parent = initproc;
+    p->sibling = initproc->children;
+    initproc->children = p;
+    zombies |= p->state == ZOMBIE;
+  }
+  myproc()->children = 0;
+  if (zombies)
+    wakeup(initproc);
+
+  if (ISTHREAD(curproc)) {
+    curproc->group->nthreads--;
+    wakeup(curproc->group);
   }
   
   // Wakeup parent in case it was waiting for this child
-  wakeup1(myproc()->parent);
+  wakeup(myproc()->parent);
+
+  // Become a zombie while still holding ptable.lock, so a parent
+  // scanning in wait() either sees it or is asleep already
+  acquire(&myproc()->lock);
+  myproc()->state = ZOMBIE;
+  release(&ptable.lock);
   
   // Schedule into the next process
   sched();
 }
 
+// Free zombie child p, which the caller has locked, and return its
+// pid.  Caller must hold ptable.lock.
+static int reap(struct proc *p) {
+  int pid = p->pid;
+
+  // Deallocate data structures
+  procunlink(p);
+  release(&p->lock);
+  kstackfree(p->kstack);
+  p->kstack = 0;
+  procfree(p);
+  return pid;
+}
+
 // Wait for a child process to exit and return its pid.
-// Return -1 if this process has no children.
+// Return -1 if this process has no children.  Threads are reaped
+// by join(), but a thread whose parent is gone is init's to free.
 int wait(void) {
   acquire(&ptable.lock);
 
@@ -225,21 +801,28 @@ int wait(void) {
   while (1) {
     bool hasChildren = false;
 
-    for (struct proc *p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+    for (struct proc *p = myproc()->children, *next; p; p = next) {
+      next = p->sibling;
+      // The child holds its lock until it has switched away for the
+      // last time, so taking it makes freeing its stack safe
+      acquire(&p->lock);
+      if (ISTHREAD(p)) {
+        if (p->state == ZOMBIE && myproc() == initproc)
+          reap(p);
+        else
+          release(&p->lock);
+        continue;
+      }
       // If we find a valid zombie child, deallocate process and return id to user
-      if (p->parent == myproc() && p->state == ZOMBIE) {
-        int child_pid = p->pid;
-
-        // Deallocate data structures
-        p->state = UNUSED;
-        kfree(p->kstack);
-        vspacefree(&p->vspace);
+      if (p->state == ZOMBIE) {
+        int child_pid = reap(p);
         release(&ptable.lock);
         return child_pid;
       }
-      else if (p->parent == myproc() && (p->state == RUNNABLE || p->state == SLEEPING || p->state == RUNNING)) {
+      else if (p->state == RUNNABLE || p->state == SLEEPING || p->state == RUNNING) {
         hasChildren = true;
       }
+      release(&p->lock);
     }
 
     // If we do not have children, then exit loop
@@ -257,6 +840,38 @@ int wait(void) {
   return -1;
 }
 
+// Wait for a thread the caller started with clone() to exit and
+// return its pid.  Returns -1 if the caller has no threads left to
+// wait for, or has been killed.
+int join(void) {
+  struct proc *p;
+  bool hasThreads;
+  int pid;
+
+  acquire(&ptable.lock);
+  for (;;) {
+    hasThreads = false;
+    for (p = myproc()->children; p; p = p->sibling) {
+      // A kernel thread of ours lasts as long as we do
+      if (!ISTHREAD(p) || p->kfn)
+        continue;
+      acquire(&p->lock);
+      if (p->state == ZOMBIE) {
+        pid = reap(p);
+        release(&ptable.lock);
+        return pid;
+      }
+      release(&p->lock);
+      hasThreads = true;
+    }
+    if (!hasThreads || myproc()->killed)
+      break;
+    sleep(myproc(), &ptable.lock);
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
@@ -271,30 +886,48 @@ void scheduler(void) {
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-      if (p->state != RUNNABLE)
-        continue;
+    // Use idle time to clear pages for kalloc_zeroed(), then halt,
+    // off the page table of whatever ran last so it can be freed
+    if ((p = runqget()) == 0) {
+      vspaceinstallkern();
+      if (!kzeroidle())
+        schedidle();
+      continue;
+    }
 
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      mycpu()->proc = p;
+    // p may still be switching away on the CPU that queued it;
+    // its lock is held until that finishes.
+    acquire(&p->lock);
+    if (p->state != RUNNABLE)
+      panic("scheduler: queued proc not runnable");
+
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    mycpu()->proc = p;
+    p->rq = mycpu() - cpus;
+    // A kernel thread runs on the kernel's page table, unless it
+    // is a thread of a process.  The last process's page table is
+    // left loaded until then, so switching between user processes
+    // loads %cr3 once, and not at all when the same one runs again.
+    // exit() frees a process's page table before its last switch.
+    if ((!p->kfn || ISTHREAD(p)) && p->group->vspace.pgtbl)
       vspaceinstall(p);
-      p->state = RUNNING;
-      swtch(&mycpu()->scheduler, p->context);
+    else
       vspaceinstallkern();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      mycpu()->proc = 0;
-    }
-    release(&ptable.lock);
+    p->state = RUNNING;
+    mycpu()->nswitch++;
+    TRACE(TR_SWITCH, 0, 0);
+    swtch(&mycpu()->scheduler, p->context);
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    mycpu()->proc = 0;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -304,8 +937,8 @@ void scheduler(void) {
 void sched(void) {
   int intena;
 
-  if (!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if (!holding(&myproc()->lock))
+    panic("sched p->lock");
   if (mycpu()->ncli != 1) {
     cprintf("pid : %d\n", myproc()->pid);
     cprintf("ncli : %d\n", mycpu()->ncli);
@@ -323,20 +956,57 @@ void sched(void) {
   mycpu()->intena = intena;
 }
 
+// Charge the running process for a timer tick on this CPU.  Returns
+// 1 if it should give up the CPU: either its slice is used up, which
+// also moves it down a level, or a higher level has a process waiting.
+int schedtick(void) {
+  struct proc *p = myproc();
+  struct runq *rq;
+  int lvl, i;
+
+  // Only p itself changes these while it is RUNNING
+  p->cputicks++;
+  lvl = schedlevel(p);
+  if (++p->sliceused >= SCHEDSLICE << lvl) {
+    p->sliceused = 0;
+    if (p->prio < NPRIO - 1)
+      p->prio++;
+    return 1;
+  }
+
+  rq = &runqs[mycpu() - cpus];
+  for (i = 0; i < lvl; i++)
+    if (rq->head[i])
+      return 1;
+  return 0;
+}
+
+// Change the current process's nice value by incr, within
+// 0..NICE_MAX.  Returns the new value.
+int nice(int incr) {
+  struct proc *p = myproc();
+
+  acquire(&p->lock);
+  p->nice = max(0, min(p->nice + incr, NICE_MAX));
+  release(&p->lock);
+  return p->nice;
+}
+
 // Give up the CPU for one scheduling round.
 void yield(void) {
-  acquire(&ptable.lock); // DOC: yieldlock
+  acquire(&myproc()->lock); // DOC: yieldlock
   myproc()->state = RUNNABLE;
+  runqput(myproc());
   sched();
-  release(&ptable.lock);
+  release(&myproc()->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
 // will swtch here.  "Return" to user space.
 void forkret(void) {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -352,74 +1022,131 @@ void forkret(void) {
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void sleep(void *chan, struct spinlock *lk) {
-  if (myproc() == 0)
+  struct proc *p = myproc();
+  struct proc **pp;
+  struct sleepq *sq;
+
+  if (p == 0)
     panic("sleep");
 
   if (lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if (lk != &ptable.lock) { // DOC: sleeplock0
-    acquire(&ptable.lock);  // DOC: sleeplock1
-    release(lk);
-  }
+  // Once we are on chan's sleep queue, a
+  // waker holding lk will find us, and it
+  // takes p->lock before waking us, so it's
+  // okay to release lk.
+  TRACE(TR_SLEEP, chan, 0);
+  sq = chanq(chan);
+  acquire(&sq->lock);
+  acquire(&p->lock); // DOC: sleeplock1
+  p->chan = chan;
+  p->state = SLEEPING;
+  p->sqnext = 0;
+  for (pp = &sq->head; *pp; pp = &(*pp)->sqnext)
+    ;
+  *pp = p;
+  release(&sq->lock);
+  release(lk);
 
   // Go to sleep.
-  myproc()->chan = chan;
-  myproc()->state = SLEEPING;
   sched();
 
   // Tidy up.
-  myproc()->chan = 0;
+  p->chan = 0;
 
   // Reacquire original lock.
-  if (lk != &ptable.lock) { // DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock); // DOC: sleeplock2
+  acquire(lk);
 }
 
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void wakeup1(void *chan) {
-  struct proc *p;
+// Wake up to n of the processes sleeping on chan, those that have
+// waited longest first, or all of them if n is -1.  Returns how many
+// it woke.
+int wakeupn(void *chan, int n) {
+  struct sleepq *sq = chanq(chan);
+  struct proc **pp, *p;
+  int woken = 0;
+
+  // Safe without the lock: a sleeper joins the queue before releasing
+  // the lock the waker holds
+  if (sq->head == 0)
+    return 0;
 
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if (p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  acquire(&sq->lock);
+  for (pp = &sq->head; (p = *pp) != 0 && woken != n;) {
+    if (p->chan != chan) {
+      pp = &p->sqnext;
+      continue;
+    }
+    *pp = p->sqnext;
+    acquire(&p->lock);
+    // A sleeper is waiting on I/O or another process; favor it
+    if (p->prio > 0)
+      p->prio--;
+    p->sliceused = 0;
+    p->state = RUNNABLE;
+    runqput(p);
+    release(&p->lock);
+    TRACE(TR_WAKEUP, chan, p->pid);
+    woken++;
+  }
+  release(&sq->lock);
+  return woken;
 }
 
 // Wake up all processes sleeping on chan.
-void wakeup(void *chan) {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
-}
+void wakeup(void *chan) { wakeupn(chan, -1); }
+
+// Wake up one process sleeping on chan, for waiters of which only one
+// can go ahead.
+void wakeupone(void *chan) { wakeupn(chan, 1); }
 
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
 int kill(int pid) {
   struct proc *p;
+  void *chan;
 
   acquire(&ptable.lock);
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if (p->pid == pid) {
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if (p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
+  if ((p = pidlookup(pid)) == 0) {
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&p->lock);
+  p->killed = 1;
+  chan = p->state == SLEEPING ? p->chan : 0;
+  release(&p->lock);
+  // Wake process from sleep if necessary.  This may wake others
+  // on the same channel too, which just go back to sleep.
+  if (chan)
+    wakeup(chan);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Fill in up to n of st with the system call counts of live
+// processes.  Returns how many it filled.
+int procsyscalls(struct scproc *st, int n) {
+  struct proc *p;
+  int h, i;
+
+  i = 0;
+  acquire(&ptable.lock);
+  for (h = 0; h < NPIDHASH && i < n; h++) {
+    for (p = ptable.pidhash[h]; p && i < n; p = p->pidnext) {
+      st[i].pid = p->pid;
+      safestrcpy(st[i].name, p->name, sizeof(st[i].name));
+      st[i].calls = p->nsyscall;
+      st[i].cycles = p->syscycles;
+      i++;
     }
   }
   release(&ptable.lock);
-  return -1;
+  return i;
 }
 
 // Print a process listing to console.  For debugging.
@@ -429,33 +1156,35 @@ void procdump(void) {
   static char *states[] = {[UNUSED] = "unused",   [EMBRYO] = "embryo",
                            [SLEEPING] = "sleep ", [RUNNABLE] = "runble",
                            [RUNNING] = "run   ",  [ZOMBIE] = "zombie"};
-  int i;
+  int i, h;
   struct proc *p;
   char *state;
   uint64_t pc[10];
 
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if (p->state == UNUSED)
-      continue;
-    if (p->state != 0 && p->state < NELEM(states) && states[p->state])
-      state = states[p->state];
-    else
-      state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
-    if (p->state == SLEEPING) {
-      getcallerpcs((uint64_t *)p->context->rbp, pc);
-      for (i = 0; i < 10 && pc[i] != 0; i++)
-        cprintf(" %p", pc[i]);
+  for (h = 0; h < NPIDHASH; h++) {
+    for (p = ptable.pidhash[h]; p; p = p->pidnext) {
+      if (p->state != 0 && p->state < NELEM(states) && states[p->state])
+        state = states[p->state];
+      else
+        state = "???";
+      cprintf(p->kfn ? "%d %s [%s] lvl %d nice %d cpu %d"
+                     : "%d %s %s lvl %d nice %d cpu %d",
+              p->pid, state, p->name, p->prio, p->nice, p->cputicks);
+      if (p->state == SLEEPING) {
+        getcallerpcs((uint64_t *)p->context->rbp, pc);
+        for (i = 0; i < 10 && pc[i] != 0; i++)
+          cprintf(" %p", pc[i]);
+      }
+      cprintf("\n");
     }
-    cprintf("\n");
   }
 }
 
 struct proc *findproc(int pid) {
   struct proc *p;
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if (p->pid == pid)
-      return p;
-  }
-  return 0;
+
+  acquire(&ptable.lock);
+  p = pidlookup(pid);
+  release(&ptable.lock);
+  return p;
 }
\ No newline at end of file
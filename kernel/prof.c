@@ -0,0 +1,101 @@
+// Sampling profiler.
+//
+// While profiling is on each CPU's LAPIC timer interrupts profrate
+// times a tick, and every interrupt records where it landed and, for
+// the kernel, the first PROFDEPTH return addresses on the interrupted
+// frame-pointer chain, into that CPU's buffer of PROFSIZE samples.  A
+// full buffer drops samples, counting them, until profile() drains it.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <param.h>
+#include <prof.h>
+#include <proc.h>
+#include <spinlock.h>
+#include <trap.h>
+
+#define PROFSIZE 1024 // samples per CPU
+
+static struct profbuf {
+  uint64_t head;    // samples ever written
+  uint64_t tail;    // samples ever read
+  uint64_t dropped; // samples not taken because the buffer was full
+  struct profsample s[PROFSIZE];
+} bufs[NCPU];
+
+static struct spinlock proflock;
+
+int profrate; // samples per tick, 0 when off
+
+void profinit(void) {
+  initlock(&proflock, "prof");
+}
+
+// Timer interrupt tf landed on this CPU: take a sample.  Interrupts
+// are off.
+void profsample(struct trap_frame *tf) {
+  struct profbuf *b;
+  struct profsample *s;
+  uint64_t *rbp;
+  int i;
+
+  b = &bufs[mycpu() - cpus];
+  if (b->head - b->tail >= PROFSIZE) {
+    b->dropped++;
+    return;
+  }
+  s = &b->s[b->head % PROFSIZE];
+  s->rip = tf->rip;
+  s->cpu = mycpu() - cpus;
+  s->user = (tf->cs & 3) == DPL_USER;
+  s->pid = myproc() ? myproc()->pid : 0;
+  if (myproc())
+    safestrcpy(s->name, myproc()->name, sizeof(s->name));
+  else
+    safestrcpy(s->name, "idle", sizeof(s->name));
+  // The same walk as getcallerpcs(), from the interrupted frame; a
+  // user stack might not be mapped, so it is not followed
+  rbp = s->user ? 0 : (uint64_t *)tf->rbp;
+  for (i = 0; i < PROFDEPTH; i++) {
+    if (rbp == 0 || rbp < (uint64_t *)KERNBASE ||
+        rbp == (uint64_t *)0xffffffffffffffff)
+      break;
+    s->pcs[i] = rbp[1];
+    rbp = (uint64_t *)rbp[0];
+  }
+  for (; i < PROFDEPTH; i++)
+    s->pcs[i] = 0;
+  // The sample must be complete before a reader sees head move
+  __sync_synchronize();
+  b->head++;
+}
+
+// Move up to n samples out of the buffers into dst.  Returns the
+// number moved.
+int profread(struct profsample *dst, int n) {
+  struct profbuf *b;
+  uint64_t head;
+  int got;
+
+  got = 0;
+  acquire(&proflock);
+  for (b = bufs; b < bufs + ncpu && got < n; b++) {
+    head = *(volatile uint64_t *)&b->head;
+    for (; b->tail < head && got < n; b->tail++)
+      dst[got++] = b->s[b->tail % PROFSIZE];
+  }
+  release(&proflock);
+  return got;
+}
+
+// How many samples were dropped since the last call.
+uint64_t profdropped(void) {
+  struct profbuf *b;
+  uint64_t n;
+
+  n = 0;
+  for (b = bufs; b < bufs + ncpu; b++)
+    n += __sync_lock_test_and_set(&b->dropped, 0);
+  return n;
+}
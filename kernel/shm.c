@@ -0,0 +1,138 @@
+// Shared memory segments, for shmget() and shmat().
+//
+// A segment is a set of pages that any vspace attached to it maps
+// at one region, so processes pass data through it with no copies.
+// shmlock guards the table and the attach counts.  It is a spinlock
+// because it is only held to look through the table or change a
+// count, never across anything that sleeps: pages are allocated and
+// freed with it dropped.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <spinlock.h>
+#include <vspace.h>
+
+#define NSHMSEG 16
+
+static struct spinlock shmlock;
+static struct shmseg shmsegs[NSHMSEG];
+
+void shminit(void) {
+  initlock(&shmlock, "shm");
+}
+
+// Free the first n pages of pages, and pages itself.
+static void shmfreepages(char **pages, uint64_t n) {
+  uint64_t i;
+
+  for (i = 0; i < n; i++)
+    kfree(pages[i]);
+  kfree((char *)pages);
+}
+
+// Returns the id of the segment named key, creating it with size
+// bytes of zeroed pages if there is none.  Key 0 always makes a new
+// segment, which no other shmget() finds.  Returns -1 if there is no
+// free segment or no memory, or the segment named key is smaller than
+// size.
+int shmget(int key, int size) {
+  struct shmseg *s, *free;
+  char **pages;
+  uint64_t n, i, have;
+
+  n = PGROUNDUP((uint64_t)size) / PGSIZE;
+  if (size <= 0 || n > SHMMAXPAGES)
+    return -1;
+
+  pages = 0;
+  for (;;) {
+    acquire(&shmlock);
+    free = 0;
+    for (s = shmsegs; s < &shmsegs[NSHMSEG]; s++) {
+      if (key != 0 && s->npages && s->key == key)
+        break;
+      if (!s->npages && !free)
+        free = s;
+    }
+    if (s < &shmsegs[NSHMSEG]) {
+      have = s->npages;
+      release(&shmlock);
+      if (pages)
+        shmfreepages(pages, n);
+      return have >= n ? s - shmsegs : -1;
+    }
+    if (!free) {
+      release(&shmlock);
+      if (pages)
+        shmfreepages(pages, n);
+      return -1;
+    }
+    if (pages) {
+      free->key = key;
+      free->nattach = 0;
+      free->npages = n;
+      free->pages = pages;
+      release(&shmlock);
+      return free - shmsegs;
+    }
+    release(&shmlock);
+
+    // Allocate without the lock, since making room may swap, then
+    // look again in case someone made the segment meanwhile
+    if (!(pages = (char **)kalloc_zeroed()))
+      return -1;
+    for (i = 0; i < n; i++) {
+      if (!(pages[i] = kalloc_zeroed())) {
+        shmfreepages(pages, i);
+        return -1;
+      }
+    }
+  }
+}
+
+// Returns segment id, counting an attachment to it, or 0 if there
+// is no such segment.
+struct shmseg *shmattach(int id) {
+  struct shmseg *s;
+
+  if (id < 0 || id >= NSHMSEG)
+    return 0;
+  s = &shmsegs[id];
+  acquire(&shmlock);
+  if (!s->npages) {
+    release(&shmlock);
+    return 0;
+  }
+  s->nattach++;
+  release(&shmlock);
+  return s;
+}
+
+// Count another attachment to s, for a forked vspace.
+void shmdup(struct shmseg *s) {
+  acquire(&shmlock);
+  s->nattach++;
+  release(&shmlock);
+}
+
+// Drop an attachment to s, freeing it with the last one.
+void shmput(struct shmseg *s) {
+  char **pages;
+  uint64_t n;
+
+  acquire(&shmlock);
+  if (--s->nattach > 0) {
+    release(&shmlock);
+    return;
+  }
+  pages = s->pages;
+  n = s->npages;
+  s->key = 0;
+  s->pages = 0;
+  s->npages = 0;
+  release(&shmlock);
+  shmfreepages(pages, n);
+}
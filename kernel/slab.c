@@ -0,0 +1,221 @@
+// Slab allocator for small, fixed-size kernel objects.
+//
+// Each cache hands out objects of one size carved from kalloc()
+// pages ("slabs").  A slab starts with a struct slab header followed
+// by its objects; each object slot ends with a link word used while
+// the object is free, so an object keeps the state its constructor
+// gave it across free and reuse.  Freed objects go to a small per-CPU
+// list first and move back to their slabs in batches.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <spinlock.h>
+
+#define NKMEMCACHE 16
+#define SLAB_BATCH 8
+#define SLAB_CPUHIGH (4 * SLAB_BATCH)
+
+struct slab {
+  struct kmem_cache *cache;
+  struct slab *next;  // cache's list of slabs with free objects
+  struct slab *prev;
+  char *free;         // free objects in this slab
+  int inuse;          // objects handed out, per-CPU lists included
+  int onlist;         // is the slab on cache->partial?
+};
+
+struct kmem_cache {
+  char *name;
+  uint size;               // bytes the caller asked for
+  uint slot;               // bytes per object, link word included
+  int perslab;             // objects per slab
+  void (*ctor)(void *);
+  struct spinlock lock;
+  struct slab *partial;    // slabs with at least one free object
+  int nslabs;
+  struct {
+    char *head;
+    int n;
+  } cpu[NCPU];
+};
+
+static struct {
+  struct spinlock lock;
+  struct kmem_cache caches[NKMEMCACHE];
+  int ncache;
+} slabs;
+
+// The free-list link of the object at obj.
+static char **objlink(struct kmem_cache *c, char *obj) {
+  return (char **)(obj + c->slot - sizeof(char *));
+}
+
+static struct slab *objslab(char *obj) {
+  return (struct slab *)PGROUNDDOWN((uint64_t)obj);
+}
+
+// Create a cache of size-byte objects.  ctor, if not 0, is run on each
+// object once, when its slab is allocated.
+struct kmem_cache *kmem_cache_create(char *name, uint size, void (*ctor)(void *)) {
+  struct kmem_cache *c;
+
+  acquire(&slabs.lock);
+  if (slabs.ncache == NKMEMCACHE)
+    panic("kmem_cache_create: too many caches");
+  c = &slabs.caches[slabs.ncache++];
+  release(&slabs.lock);
+
+  memset(c, 0, sizeof(*c));
+  c->name = name;
+  c->size = size;
+  c->slot = ((size + 7) & ~7) + sizeof(char *);
+  c->perslab = (PGSIZE - sizeof(struct slab)) / c->slot;
+  if (c->perslab < 1)
+    panic("kmem_cache_create: object too big");
+  c->ctor = ctor;
+  initlock(&c->lock, name);
+  return c;
+}
+
+// Put slab s on the partial list.  Caller must hold c->lock.
+static void slabinsert(struct kmem_cache *c, struct slab *s) {
+  s->prev = 0;
+  s->next = c->partial;
+  if (c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+  s->onlist = 1;
+}
+
+static void slabremove(struct kmem_cache *c, struct slab *s) {
+  if (s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if (s->next)
+    s->next->prev = s->prev;
+  s->onlist = 0;
+}
+
+// Allocate and construct a new slab.  Returns 0 if out of memory.
+static struct slab *slabgrow(struct kmem_cache *c) {
+  struct slab *s;
+  char *obj;
+  int i;
+
+  if ((s = (struct slab *)kalloc()) == 0)
+    return 0;
+  memset(s, 0, sizeof(*s));
+  s->cache = c;
+  obj = (char *)(s + 1);
+  for (i = 0; i < c->perslab; i++, obj += c->slot) {
+    if (c->ctor)
+      c->ctor(obj);
+    *objlink(c, obj) = s->free;
+    s->free = obj;
+  }
+  return s;
+}
+
+// Take an object off the cache's slabs.  Caller must hold c->lock.
+static char *slabget(struct kmem_cache *c) {
+  struct slab *s;
+  char *obj;
+
+  if ((s = c->partial) == 0)
+    return 0;
+  obj = s->free;
+  s->free = *objlink(c, obj);
+  s->inuse++;
+  if (s->free == 0)
+    slabremove(c, s);
+  return obj;
+}
+
+// Return an object to its slab, freeing the slab once it is empty
+// if the cache has others with room.  Caller must hold c->lock.
+static void slabput(struct kmem_cache *c, char *obj) {
+  struct slab *s = objslab(obj);
+
+  *objlink(c, obj) = s->free;
+  s->free = obj;
+  s->inuse--;
+  if (s->inuse == 0 && c->nslabs > 1) {
+    if (s->onlist)
+      slabremove(c, s);
+    c->nslabs--;
+    kfree((char *)s);
+  } else if (!s->onlist) {
+    slabinsert(c, s);
+  }
+}
+
+// Allocate an object.  Returns 0 if out of memory.
+void *kmem_cache_alloc(struct kmem_cache *c) {
+  struct slab *s;
+  char *obj;
+  int id;
+
+  pushcli();
+  id = mycpu() - cpus;
+  if (c->cpu[id].n == 0) {
+    acquire(&c->lock);
+    while (c->cpu[id].n < SLAB_BATCH && (obj = slabget(c)) != 0) {
+      *objlink(c, obj) = c->cpu[id].head;
+      c->cpu[id].head = obj;
+      c->cpu[id].n++;
+    }
+    release(&c->lock);
+  }
+  if ((obj = c->cpu[id].head) != 0) {
+    c->cpu[id].head = *objlink(c, obj);
+    c->cpu[id].n--;
+    popcli();
+    return obj;
+  }
+  popcli();
+
+  // No free objects anywhere; grow with interrupts back on, since
+  // the constructor may want them
+  if ((s = slabgrow(c)) == 0)
+    return 0;
+  acquire(&c->lock);
+  c->nslabs++;
+  slabinsert(c, s);
+  obj = slabget(c);
+  release(&c->lock);
+  return obj;
+}
+
+// Free an object allocated from c.
+void kmem_cache_free(struct kmem_cache *c, void *v) {
+  char *obj = v;
+  int id, i;
+
+  if (objslab(obj)->cache != c)
+    panic("kmem_cache_free");
+
+  pushcli();
+  id = mycpu() - cpus;
+  *objlink(c, obj) = c->cpu[id].head;
+  c->cpu[id].head = obj;
+  if (++c->cpu[id].n > SLAB_CPUHIGH) {
+    acquire(&c->lock);
+    for (i = 0; i < SLAB_BATCH; i++) {
+      obj = c->cpu[id].head;
+      c->cpu[id].head = *objlink(c, obj);
+      slabput(c, obj);
+    }
+    c->cpu[id].n -= SLAB_BATCH;
+    release(&c->lock);
+  }
+  popcli();
+}
+
+void slabinit(void) {
+  initlock(&slabs.lock, "slabs");
+}
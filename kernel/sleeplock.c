@@ -2,6 +2,7 @@
 
 #include <cdefs.h>
 #include <defs.h>
+#include <lockstat.h>
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
@@ -15,26 +16,44 @@ void initsleeplock(struct sleeplock *lk, char *name) {
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
+#if LOCKSTAT
+  lk->stat = lockclass(name, LS_SLEEP);
+#endif
 }
 
 // a sleeping lock relinquishes the processor if the lock is busy
 // note mesa semantics: process can wakeup and find the lock still busy
 void acquiresleep(struct sleeplock *lk) {
+  int waited = 0;
+
   acquire(&lk->lk);
+#if LOCKSTAT
+  uint64_t t0 = rdtsc();
+#endif
   while (lk->locked) {
+    waited = 1;
     sleep(lk, &lk->lk);
   }
   lk->locked = 1;
   lk->pid = myproc()->pid;
+#if LOCKSTAT
+  lk->tsc = rdtsc();
+  lockstat_acquire(lk->stat, waited, lk->tsc - t0);
+#endif
+  (void)waited;
   release(&lk->lk);
 }
 
-// a sleeping lock wakes up a waiting process, if any, on lock release
+// a sleeping lock wakes up a waiting process, if any, on lock release;
+// only one of them can take it, so the rest sleep on
 void releasesleep(struct sleeplock *lk) {
   acquire(&lk->lk);
+#if LOCKSTAT
+  lockstat_release(lk->stat, rdtsc() - lk->tsc);
+#endif
   lk->locked = 0;
   lk->pid = 0;
-  wakeup(lk);
+  wakeupone(lk);
   release(&lk->lk);
 }
 
@@ -47,3 +66,87 @@ int holdingsleep(struct sleeplock *lk) {
   release(&lk->lk);
   return r;
 }
+
+void initrwsleeplock(struct rwsleeplock *lk, char *name) {
+  initlock(&lk->lk, "rw sleep lock");
+  lk->name = name;
+  lk->writer = 0;
+  lk->readers = 0;
+  lk->wwait = 0;
+  lk->pid = 0;
+#if LOCKSTAT
+  lk->stat = lockclass(name, LS_RWSLEEP);
+#endif
+}
+
+// take the lock shared, waiting behind any writer that holds or
+// wants it
+void acquiresleep_read(struct rwsleeplock *lk) {
+  int waited = 0;
+
+  acquire(&lk->lk);
+#if LOCKSTAT
+  uint64_t t0 = rdtsc();
+#endif
+  while (lk->writer || lk->wwait > 0) {
+    waited = 1;
+    sleep(lk, &lk->lk);
+  }
+  lk->readers++;
+#if LOCKSTAT
+  lockstat_acquire(lk->stat, waited, rdtsc() - t0);
+#endif
+  (void)waited;
+  release(&lk->lk);
+}
+
+// take the lock exclusive
+void acquiresleep_write(struct rwsleeplock *lk) {
+  int waited = 0;
+
+  acquire(&lk->lk);
+#if LOCKSTAT
+  uint64_t t0 = rdtsc();
+#endif
+  lk->wwait++;
+  while (lk->writer || lk->readers > 0) {
+    waited = 1;
+    sleep(lk, &lk->lk);
+  }
+  lk->wwait--;
+  lk->writer = 1;
+  lk->pid = myproc()->pid;
+#if LOCKSTAT
+  lk->tsc = rdtsc();
+  lockstat_acquire(lk->stat, waited, lk->tsc - t0);
+#endif
+  (void)waited;
+  release(&lk->lk);
+}
+
+// drop the lock, in whichever mode it is held
+void releaserwsleep(struct rwsleeplock *lk) {
+  acquire(&lk->lk);
+  if (lk->writer) {
+#if LOCKSTAT
+    lockstat_release(lk->stat, rdtsc() - lk->tsc);
+#endif
+    lk->writer = 0;
+    lk->pid = 0;
+  } else {
+    lk->readers--;
+  }
+  if (lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
+// is the lock held in either mode?
+int holdingrwsleep(struct rwsleeplock *lk) {
+  int r;
+
+  acquire(&lk->lk);
+  r = lk->writer || lk->readers > 0;
+  release(&lk->lk);
+  return r;
+}
@@ -2,6 +2,7 @@
 
 #include <cdefs.h>
 #include <defs.h>
+#include <lockstat.h>
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
@@ -11,8 +12,11 @@
 
 void initlock(struct spinlock *lk, char *name) {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = lk->owner = 0;
   lk->cpu = 0;
+#if LOCKSTAT
+  lk->stat = lockclass(name, LS_SPIN);
+#endif
 }
 
 // Acquire the lock.
@@ -20,13 +24,26 @@ void initlock(struct spinlock *lk, char *name) {
 // Holding a lock for a long time may cause
 // other CPUs to waste time spinning to acquire it.
 void acquire(struct spinlock *lk) {
+  uint ticket;
+  int spun = 0;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if (holding(lk))
     panic("acquire");
-
-  // The xchg is atomic.
-  while (xchg(&lk->locked, 1) != 0)
-    ;
+#if LOCKSTAT
+  uint64_t t0 = rdtsc();
+#endif
+
+  // The xadd is atomic.  Waiting CPUs only read owner, so the line
+  // stays shared until the holder's release() writes it.  The holder
+  // may be waiting for this CPU to flush its TLB, which it cannot be
+  // interrupted to do now.
+  ticket = xadd(&lk->next, 1);
+  while (*(volatile uint *)&lk->owner != ticket) {
+    spun = 1;
+    vspacetlbpoll();
+    pause();
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -35,15 +52,55 @@ void acquire(struct spinlock *lk) {
 
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
+#if LOCKSTAT
+  lk->tsc = rdtsc();
+  lockstat_acquire(lk->stat, spun, lk->tsc - t0);
+#endif
+#if LOCK_DEBUG
+  getcallerpcs(&lk, lk->pcs);
+#endif
+  (void)spun;
+}
+
+// Acquire the lock if it is free, without waiting.  Returns 1 if it
+// was acquired, 0 if it is held or others are waiting for it.
+int tryacquire(struct spinlock *lk) {
+  uint ticket;
+
+  pushcli();
+  if (holding(lk))
+    panic("tryacquire");
+
+  ticket = *(volatile uint *)&lk->owner;
+  if (*(volatile uint *)&lk->next != ticket ||
+      !cmpxchg(&lk->next, ticket, ticket + 1)) {
+    popcli();
+    return 0;
+  }
+  __sync_synchronize();
+
+  lk->cpu = mycpu();
+#if LOCKSTAT
+  lk->tsc = rdtsc();
+  lockstat_acquire(lk->stat, 0, 0);
+#endif
+#if LOCK_DEBUG
   getcallerpcs(&lk, lk->pcs);
+#endif
+  return 1;
 }
 
 // Release the lock.
 void release(struct spinlock *lk) {
   if (!holding(lk))
     panic("release");
+#if LOCKSTAT
+  lockstat_release(lk->stat, rdtsc() - lk->tsc);
+#endif
 
+#if LOCK_DEBUG
   lk->pcs[0] = 0;
+#endif
   lk->cpu = 0;
 
   // Tell the C compiler and the processor to not move loads or stores
@@ -53,10 +110,9 @@ void release(struct spinlock *lk) {
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m"(lk->locked) :);
+  // Let the next ticket in.  Only the holder writes owner, so a
+  // plain aligned store is enough.
+  *(volatile uint *)&lk->owner = lk->owner + 1;
 
   popcli();
 }
@@ -81,7 +137,7 @@ void getcallerpcs(void *v, uint64_t pcs[]) {
 
 // Check whether this cpu is holding the lock.
 int holding(struct spinlock *lock) {
-  return lock->locked && lock->cpu == mycpu();
+  return lock->next != lock->owner && lock->cpu == mycpu();
 }
 
 // Pushcli/popcli are like cli/sti except that they are matched:
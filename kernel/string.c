@@ -1,12 +1,17 @@
 #include <cdefs.h>
 #include <x86_64.h>
 
+// Set by cpuid_print() if the CPU has enhanced "rep movsb/stosb"
+// (ERMS), which then does at least as well as moving a word at a time.
+int erms;
+
 void *memset(void *dst, int c, uint n) {
-  if ((int64_t)dst % 4 == 0 && n % 4 == 0) {
-    c &= 0xFF;
-    stosl(dst, (c << 24) | (c << 16) | (c << 8) | c, n / 4);
-  } else
+  if (erms || n < 8) {
     stosb(dst, c, n);
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    stosb((char *)dst + (n & ~7), c, n % 8);
+  }
   return dst;
 }
 
@@ -31,13 +36,25 @@ void *memmove(void *dst, const void *src, uint n) {
   s = src;
   d = dst;
   if (s < d && s + n > d) {
+    // Overlapping, so copy from the end down, by words if the ends
+    // are aligned; each word is read before the one above is written
     s += n;
     d += n;
+    if (((uint64_t)s | (uint64_t)d) % 8 == 0) {
+      for (; n >= 8; n -= 8) {
+        s -= 8;
+        d -= 8;
+        *(uint64_t *)d = *(const uint64_t *)s;
+      }
+    }
     while (n-- > 0)
       *--d = *--s;
-  } else
-    while (n-- > 0)
-      *d++ = *s++;
+  } else if (erms || n < 8) {
+    movsb(d, s, n);
+  } else {
+    movsq(d, s, n / 8);
+    movsb(d + (n & ~7), s + (n & ~7), n % 8);
+  }
 
   return dst;
 }
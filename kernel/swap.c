@@ -0,0 +1,388 @@
+// Swap: user pages written out to the swap area mkfs reserves after
+// the log, SWAPBLOCKS disk blocks per page slot.
+//
+// When memory runs out kalloc() calls swapout().  A CLOCK hand sweeps
+// the core map for pages user space maps.  A page whose mappings
+// have an accessed bit set gets the bits cleared and is passed over
+// once.  Otherwise its mappings are found through the page's reverse
+// map (struct rmap) and all unmapped.  A batch of such pages is
+// written to free slots with one run of disk requests, and then they
+// are freed.  The vpage_info of a swapped-out page keeps used set,
+// clears present and holds the slot number in ppn.  trap() reads the
+// page back in with swapin() when it is touched.  Each slot counts
+// the vpage_infos naming it, as a page counts its references.
+//
+// Swap I/O goes through bufs of its own rather than the buffer cache,
+// so swapping neither needs memory from the cache nor pushes file
+// blocks out of it.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <fs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <sleeplock.h>
+#include <spinlock.h>
+#include <vspace.h>
+#include <x86_64.h>
+#include <x86_64vm.h>
+
+#include <buf.h>
+
+#define SWAP_BATCH 8 // pages written by one swapout()
+
+extern struct core_map_entry *core_map;
+
+int swap_outs;         // pages written to swap
+int swap_ins;          // pages read back from swap
+int clock_scans;       // mapped pages the CLOCK hand looked at
+int clock_referenced;  // of those, passed over for being recently used
+
+// The reverse maps, and the vpage_infos and page table entries of
+// user pages the swapper may take, are only changed under rmap.lock.
+static struct {
+  struct spinlock lock;
+  struct kmem_cache *cache;
+  int hand;            // CLOCK hand, an index into core_map
+} rmap;
+
+static int swapslot(void);
+
+// A page swapout() has unmapped, on its way out
+struct swapvictim {
+  char *page; // kernel address of the page's contents
+  int nref;   // mappings it had, each holding a reference
+  int slot;   // swap slot it goes to
+};
+
+static struct {
+  struct spinlock lock;
+  uint dev;
+  uint start;               // first block of the swap area
+  int nslot;                // page slots in the swap area
+  int hand;                 // where swapslot() looks next
+  ushort count[SWAPPAGES];  // vpage_infos naming each slot
+  char busy[SWAPPAGES];     // is the slot's write still in flight?
+
+  struct sleeplock outlock; // one swapout() batch at a time
+  struct buf outbuf[SWAP_BATCH * SWAPBLOCKS];
+  struct sleeplock inlock;  // one swapin() read at a time
+  struct buf inbuf[SWAPBLOCKS];
+} swap;
+
+void swapinit(int dev, struct superblock *sb) {
+  int i;
+
+  initlock(&swap.lock, "swap");
+  initsleeplock(&swap.outlock, "swapout");
+  initsleeplock(&swap.inlock, "swapin");
+  for (i = 0; i < SWAP_BATCH * SWAPBLOCKS; i++) {
+    initsleeplock(&swap.outbuf[i].lock, "swapbuf");
+    swap.outbuf[i].data = swap.outbuf[i].mem;
+  }
+  for (i = 0; i < SWAPBLOCKS; i++) {
+    initsleeplock(&swap.inbuf[i].lock, "swapbuf");
+    swap.inbuf[i].data = swap.inbuf[i].mem;
+  }
+
+  swap.dev = dev;
+  swap.start = sb->swapstart;
+  swap.nslot = min((int)(sb->nswap / SWAPBLOCKS), SWAPPAGES);
+  cprintf("swap: %d pages at block %d\n", swap.nslot, swap.start);
+}
+
+void rmapinit(void) {
+  initlock(&rmap.lock, "rmap");
+  rmap.cache = kmem_cache_create("rmap", sizeof(struct rmap), 0);
+}
+
+void rmapacquire(void) {
+  acquire(&rmap.lock);
+}
+
+void rmaprelease(void) {
+  release(&rmap.lock);
+}
+
+// Record that vs maps the page of vpi at va.  Without the record the
+// page can't be swapped out, so failing to allocate it is harmless.
+// The zero page, which is never swapped, gets no records.
+// Returns 0 on success, -1 if out of memory.  Caller must hold
+// rmap.lock.
+int rmapadd(struct vspace *vs, struct vpage_info *vpi, uint64_t va) {
+  struct core_map_entry *r;
+  struct rmap *m;
+
+  if (P2V(vpi->ppn << PT_SHIFT) == zeropage)
+    return 0;
+
+  if ((m = kmem_cache_alloc(rmap.cache)) == 0)
+    return -1;
+  r = pa2page(vpi->ppn << PT_SHIFT);
+  m->vs = vs;
+  m->vpi = vpi;
+  m->va = va;
+  m->next = r->rmap;
+  r->rmap = m;
+  return 0;
+}
+
+// Forget the mapping of vpi, whose vspace is letting go of it.
+// Returns 1 if the page is in memory, so the caller drops its
+// reference to the page, or 0 if swapped out, so the caller drops
+// its reference to the slot.  Caller must hold rmap.lock.
+int rmapdrop(struct vpage_info *vpi) {
+  struct rmap **pp, *m;
+
+  if (!vpi->present)
+    return 0;
+  for (pp = &pa2page(vpi->ppn << PT_SHIFT)->rmap; (m = *pp) != 0; pp = &m->next) {
+    if (m->vpi == vpi) {
+      *pp = m->next;
+      kmem_cache_free(rmap.cache, m);
+      break;
+    }
+  }
+  return 1;
+}
+
+// Point the mapping of vpi at vspace vs, which vpi's vspace has been
+// moved to.  Caller must hold rmap.lock.
+void rmapmove(struct vpage_info *vpi, struct vspace *vs) {
+  struct rmap *m;
+
+  for (m = pa2page(vpi->ppn << PT_SHIFT)->rmap; m; m = m->next)
+    if (m->vpi == vpi)
+      m->vs = vs;
+}
+
+// The page table entry of mapping m, 0 if it has none.
+static pte_t *rmappte(struct rmap *m) {
+  return walkpml4(m->vs->pgtbl, (char *)m->va, 0);
+}
+
+// Drop the TLB entries for mapping m.
+static void rmapflush(struct rmap *m) { vspaceflush(m->vs, m->va); }
+
+// Advance the CLOCK hand until it has chosen n pages to swap out or
+// gone around twice, and unmap what it chose.  Returns the number of
+// pages chosen.
+static int clockscan(struct swapvictim *v, int n) {
+  struct core_map_entry *r;
+  struct rmap *m;
+  pte_t *pte;
+  int i, got, nref, referenced, pinned, slot;
+
+  got = 0;
+  acquire(&rmap.lock);
+  for (i = 0; i < 2 * npages && got < n; i++) {
+    r = &core_map[rmap.hand];
+    rmap.hand = (rmap.hand + 1) % npages;
+    if (r->rmap == 0)
+      continue;
+    clock_scans++;
+
+    nref = referenced = pinned = 0;
+    for (m = r->rmap; m; m = m->next) {
+      nref++;
+      if (m->vs->pinned)
+        pinned = 1;
+      if ((pte = rmappte(m)) != 0 && (*pte & PTE_A)) {
+        *pte &= ~PTE_A;
+        rmapflush(m);
+        referenced = 1;
+      }
+    }
+    if (referenced) {
+      clock_referenced++;
+      continue;
+    }
+    // Every reference must come from a mapping we can undo
+    if (pinned || nref != r->ref_count)
+      continue;
+    if ((slot = swapslot()) < 0)
+      break;
+
+    while ((m = r->rmap) != 0) {
+      r->rmap = m->next;
+      m->vpi->present = 0;
+      m->vpi->ppn = slot;
+      if ((pte = rmappte(m)) != 0)
+        *pte = 0;
+      rmapflush(m);
+      kmem_cache_free(rmap.cache, m);
+    }
+    if (nref > 1) {
+      acquire(&swap.lock);
+      swap.count[slot] += nref - 1;
+      release(&swap.lock);
+    }
+    v[got].page = P2V((uint64_t)(r - core_map) << PT_SHIFT);
+    v[got].nref = nref;
+    v[got].slot = slot;
+    got++;
+  }
+  release(&rmap.lock);
+  return got;
+}
+
+// Can the caller sleep?  Not while it holds a spinlock.
+static int cansleep(void) {
+  int ncli;
+
+  pushcli();
+  ncli = mycpu()->ncli;
+  popcli();
+  return myproc() != 0 && ncli == 1;
+}
+
+// Allocate a slot for a page about to be written out; it stays busy
+// until swapout() finishes the write.  Returns -1 if swap is full.
+static int swapslot(void) {
+  int i, s;
+
+  acquire(&swap.lock);
+  for (i = 0; i < swap.nslot; i++) {
+    s = (swap.hand + i) % swap.nslot;
+    if (swap.count[s] == 0 && !swap.busy[s]) {
+      swap.hand = s + 1;
+      swap.count[s] = 1;
+      swap.busy[s] = 1;
+      pages_in_swap++;
+      release(&swap.lock);
+      return s;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Count another vpage_info naming slot s.
+void swapdup(int s) {
+  acquire(&swap.lock);
+  swap.count[s]++;
+  release(&swap.lock);
+}
+
+// Drop a vpage_info's reference to slot s.
+void swapfree(int s) {
+  acquire(&swap.lock);
+  if (swap.count[s] == 0)
+    panic("swapfree");
+  if (--swap.count[s] == 0)
+    pages_in_swap--;
+  release(&swap.lock);
+}
+
+// Number of pages swap could still take.
+int swapavail(void) {
+  return swap.nslot - pages_in_swap;
+}
+
+// Write out a batch of user pages and free them.
+// Called by kalloc() when it runs out of memory.
+// Returns the number of pages freed.
+int swapout(void) {
+  struct swapvictim v[SWAP_BATCH];
+  struct buf *b;
+  int i, j, n;
+
+  if (swap.nslot == 0 || !cansleep())
+    return 0;
+
+  acquiresleep(&swap.outlock);
+  n = clockscan(v, SWAP_BATCH);
+
+  // The slots are mostly consecutive, so the disk driver merges the
+  // requests into a few long transfers.
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < SWAPBLOCKS; j++) {
+      b = &swap.outbuf[i * SWAPBLOCKS + j];
+      acquiresleep(&b->lock);
+      b->dev = swap.dev;
+      b->blockno = swap.start + v[i].slot * SWAPBLOCKS + j;
+      b->flags = B_VALID | B_DIRTY;
+      memmove(b->data, v[i].page + j * BSIZE, BSIZE);
+      idesubmit(b);
+    }
+  }
+  for (i = 0; i < n * SWAPBLOCKS; i++) {
+    b = &swap.outbuf[i];
+    ideiowait(b);
+    releasesleep(&b->lock);
+  }
+
+  acquire(&swap.lock);
+  for (i = 0; i < n; i++)
+    swap.busy[v[i].slot] = 0;
+  wakeup(swap.busy);
+  release(&swap.lock);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < v[i].nref; j++)
+      kfree(v[i].page);
+  swap_outs += n;
+  releasesleep(&swap.outlock);
+  return n;
+}
+
+// Read the swapped-out page at va back into memory and map it.
+// Returns 0 on success, -1 if va is not swapped out or no memory.
+int swapin(struct vspace *vs, uint64_t va) {
+  struct vregion *vr;
+  struct vpage_info *vpi;
+  struct buf *b;
+  char *mem;
+  int s, j;
+
+  if (!(vr = va2vregion(vs, va)) || !(vpi = va2vpage_info(vr, va)))
+    return -1;
+  if (!vpi->used || vpi->present)
+    return -1;
+  if (!cansleep())
+    panic("swapin: holding locks");
+
+  if ((mem = kalloc()) == 0)
+    return -1;
+
+  acquiresleep(&swap.inlock);
+  s = vpi->ppn;
+
+  // Wait for the page to finish going out
+  acquire(&swap.lock);
+  while (swap.busy[s])
+    sleep(swap.busy, &swap.lock);
+  release(&swap.lock);
+
+  for (j = 0; j < SWAPBLOCKS; j++) {
+    b = &swap.inbuf[j];
+    acquiresleep(&b->lock);
+    b->dev = swap.dev;
+    b->blockno = swap.start + s * SWAPBLOCKS + j;
+    b->flags = 0;
+    idesubmit(b);
+  }
+  for (j = 0; j < SWAPBLOCKS; j++) {
+    b = &swap.inbuf[j];
+    ideiowait(b);
+    memmove(mem + j * BSIZE, b->data, BSIZE);
+    releasesleep(&b->lock);
+  }
+  releasesleep(&swap.inlock);
+
+  // The page read back is this vspace's own copy
+  acquire(&rmap.lock);
+  vpi->ppn = PGNUM(V2P(mem));
+  vpi->present = VPI_PRESENT;
+  if (vpi->is_cow == VPI_COW) {
+    vpi->writable = vpi->original_perm;
+    vpi->is_cow = 0;
+  }
+  rmapadd(vs, vpi, va);
+  release(&rmap.lock);
+  swapfree(s);
+  swap_ins++;
+  return vspaceupdate(vs, va, 1);
+}
@@ -1,11 +1,15 @@
 #include <cdefs.h>
 #include <defs.h>
+#include <lockstat.h>
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
 #include <proc.h>
+#include <prof.h>
+#include <scstat.h>
 #include <syscall.h>
 #include <sysinfo.h>
+#include <trace.h>
 #include <trap.h>
 #include <x86_64.h>
 #include <vspace.h>
@@ -16,20 +20,42 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
+// Whether the n bytes at addr are all user addresses
+static int useraddr(uint64_t addr, uint64_t n) {
+  return addr + n >= addr && addr + n <= USERTOP;
+}
+
+// Copy n bytes from user address src to dst.  Pages not yet in
+// memory are faulted in as the copy touches them, so the caller must
+// not hold a spinlock.  Returns 0, or -1 if any of the bytes is not
+// mapped.
+int copyin(void *dst, uint64_t src, uint64_t n) {
+  if (!useraddr(src, n))
+    return -1;
+  return copyuser(dst, (void *)src, n);
+}
+
+// Copy n bytes from src to user address dst, like copyin().
+int copyout(uint64_t dst, void *src, uint64_t n) {
+  if (!useraddr(dst, n))
+    return -1;
+  return copyuser((void *)dst, src, n);
+}
+
+// Copy the string at user address src, nul included, into dst, which
+// has room for max bytes, like copyin().  Returns its length, or -1
+// if it is not mapped or does not fit.
+int copyinstr(char *dst, uint64_t src, uint64_t max) {
+  if (!useraddr(src, 0))
+    return -1;
+  return copyuserstr(dst, (char *)src, min(max, USERTOP - src));
+}
+
 #define syscall_gen_fetcher(type) \
   int \
   fetch ## type(uint64_t addr, type *ip) \
   { \
-    struct vregion *r; \
-    struct vspace *v; \
-    v = &myproc()->vspace; \
-    for (r = v->regions; r < &v->regions[NREGIONS]; r++) { \
-      if (vregioncontains(r, addr, sizeof(type))) { \
-        *ip = *(type *)(addr); \
-        return 0; \
-      } \
-    } \
-    return -1; \
+    return copyin(ip, addr, sizeof(type)); \
   } \
 
 // these create the functions:
@@ -47,22 +73,14 @@ syscall_gen_fetcher(int64_t)
 int
 fetchstr(uint64_t addr, char **pp)
 {
-  struct vregion *r;
-  struct vspace *v;
-  char *s, *ep;
-
-  v = &myproc()->vspace;
-  for (r = v->regions; r < &v->regions[NREGIONS]; r++) {
-    if (vregioncontains(r, addr, 0)) {
-      *pp = (char*)addr;
-      ep = (char *)VRTOP(r);
-      for(s = *pp; s < ep; s++) {
-        if(*s == 0)
-          return s - *pp;
-      }
-    }
-  }
-  return -1;
+  int n;
+
+  // Measured in place, faulting in its pages
+  if (!useraddr(addr, 0) ||
+      (n = copyuserstr(0, (char *)addr, USERTOP - addr)) < 0)
+    return -1;
+  *pp = (char*)addr;
+  return n;
 }
 
 static uint64_t fetcharg(int n) {
@@ -74,7 +92,8 @@ static uint64_t fetcharg(int n) {
   case 2:
     return myproc()->tf->rdx;
   case 3:
-    return myproc()->tf->rcx;
+    // SYSCALL overwrites %rcx, so usys.S passes this one in %r10
+    return myproc()->tf->r10;
   case 4:
     return myproc()->tf->r8;
   case 5:
@@ -95,27 +114,34 @@ int argint64(int n, int64_t *ip) {
   return 0;
 }
 
+// Check that the size bytes at addr lie within the process address
+// space.  Returns 0 if they do, -1 if not.
+int checkptr(uint64_t addr, int size) {
+  struct vregion *r;
+  struct vspace *v;
+
+  if (size < 0)
+    return -1;
+
+  v = &myproc()->group->vspace;
+  for (r = v->regions; r < &v->regions[NREGIONS]; r++)
+    if (vregioncontains(r, addr, size))
+      return 0;
+  return -1;
+}
+
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
 // lies within the process address space.
 int argptr(int n, char **pp, int size) {
   int64_t i;
-  struct vregion *r;
-  struct vspace *v;
 
   if (argint64(n, &i) < 0)
     return -1;
-  if (size < 0)
+  if (checkptr(i, size) < 0)
     return -1;
-
-  v = &myproc()->vspace;
-  for (r = v->regions; r < &v->regions[NREGIONS]; r++) {
-    if (vregioncontains(r, i, size)) {
-      *pp = (char*)i;
-      return 0;
-    }
-  }
-  return -1;
+  *pp = (char*)i;
+  return 0;
 }
 
 // Fetch the nth word-sized system call argument as a string pointer.
@@ -148,6 +174,40 @@ extern int sys_uptime(void);
 extern int sys_sysinfo(void);
 extern int sys_crashn(void);
 extern int sys_unlink(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_nice(void);
+extern int sys_spawn(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_sendfile(void);
+extern int sys_splice(void);
+extern int sys_poll(void);
+extern int sys_fsync(void);
+extern int sys_fdatasync(void);
+extern int sys_lockstat(void);
+extern int sys_syscallstat(void);
+extern int sys_trace(void);
+extern int sys_profile(void);
+extern int sys_cycles(void);
+extern int sys_clock_gettime(void);
+extern int sys_consmode(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_ring_setup(void);
+extern int sys_ring_enter(void);
+extern int sys_getdents(void);
+extern int sys_fstatat(void);
+extern int sys_clone_file(void);
+extern int sys_fpunch(void);
+extern int sys_defrag(void);
 
 static int (*syscalls[])(void) = {
     [SYS_fork] = sys_fork,       [SYS_exit] = sys_exit,
@@ -159,15 +219,76 @@ static int (*syscalls[])(void) = {
     [SYS_uptime] = sys_uptime,   [SYS_open] = sys_open,
     [SYS_write] = sys_write,     [SYS_close] = sys_close,
     [SYS_sysinfo] = sys_sysinfo, [SYS_crashn] = sys_crashn,
-    [SYS_unlink] = sys_unlink,
+    [SYS_unlink] = sys_unlink,   [SYS_mmap] = sys_mmap,
+    [SYS_munmap] = sys_munmap,   [SYS_nice] = sys_nice,
+    [SYS_spawn] = sys_spawn,     [SYS_pread] = sys_pread,
+    [SYS_pwrite] = sys_pwrite,   [SYS_readv] = sys_readv,
+    [SYS_writev] = sys_writev,
+    [SYS_sendfile] = sys_sendfile,
+    [SYS_splice] = sys_splice,
+    [SYS_poll] = sys_poll,
+    [SYS_fsync] = sys_fsync,
+    [SYS_fdatasync] = sys_fdatasync,
+    [SYS_lockstat] = sys_lockstat,
+    [SYS_syscallstat] = sys_syscallstat,
+    [SYS_trace] = sys_trace,
+    [SYS_profile] = sys_profile,
+    [SYS_cycles] = sys_cycles,
+    [SYS_clock_gettime] = sys_clock_gettime,
+    [SYS_consmode] = sys_consmode,
+    [SYS_clone] = sys_clone,
+    [SYS_join] = sys_join,
+    [SYS_futex_wait] = sys_futex_wait,
+    [SYS_futex_wake] = sys_futex_wake,
+    [SYS_shmget] = sys_shmget,
+    [SYS_shmat] = sys_shmat,
+    [SYS_shmdt] = sys_shmdt,
+    [SYS_ring_setup] = sys_ring_setup,
+    [SYS_ring_enter] = sys_ring_enter,
+    [SYS_getdents] = sys_getdents,
+    [SYS_fstatat] = sys_fstatat,
+    [SYS_clone_file] = sys_clone_file,
+    [SYS_fpunch] = sys_fpunch,
+    [SYS_defrag] = sys_defrag,
 };
 
+// Latency histograms, one set per CPU so that recording needs only
+// interrupts off.  Each is charged to the CPU the call returns on.
+static struct {
+  uint64_t cycles[NSYSCALL];
+  uint64_t max[NSYSCALL];
+  uint hist[NSYSCALL][NLATBUCKET];
+} sclat[NCPU];
+
+static int sctiming = 1; // time system calls?
+
+// Record that system call num took t cycles.
+static void sctime(int num, uint64_t t) {
+  int b;
+
+  b = min(63 - __builtin_clzll(t | 1), NLATBUCKET - 1);
+  pushcli();
+  sclat[mycpu() - cpus].cycles[num] += t;
+  sclat[mycpu() - cpus].max[num] = max(sclat[mycpu() - cpus].max[num], t);
+  sclat[mycpu() - cpus].hist[num][b]++;
+  popcli();
+  myproc()->syscycles += t;
+}
+
 void syscall(void) {
+  uint64_t t0;
   int num;
 
   num = myproc()->tf->rax;
   if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    pushcli();
+    mycpu()->nsyscall[num]++;
+    popcli();
+    myproc()->nsyscall++;
+    t0 = sctiming ? rdtsc() : 0;
     myproc()->tf->rax = syscalls[num]();
+    if (t0)
+      sctime(num, rdtsc() - t0);
   } else {
     cprintf("%d %s: unknown sys call %d\n", myproc()->pid, myproc()->name, num);
     myproc()->tf->rax = -1;
@@ -177,14 +298,162 @@ void syscall(void) {
 int sys_sysinfo(void) {
   struct sys_info *info;
 
-  if (argptr(0, (void *)&info, sizeof(info)) < 0)
+  if (argptr(0, (void *)&info, sizeof(*info)) < 0)
     return -1;
 
+  memset(info, 0, sizeof(*info));
+  info->version = SYSINFO_VERSION;
+  info->size = sizeof(*info);
+
   info->pages_in_use = pages_in_use;
   info->pages_in_swap = pages_in_swap;
   info->free_pages = free_pages;
   info->num_page_faults = num_page_faults;
-  info->num_disk_reads = num_disk_reads;
+  info->cow_reuses = cow_reuses;
+  info->cow_copies = cow_copies;
+  info->swap_outs = swap_outs;
+  info->swap_ins = swap_ins;
+  info->clock_scans = clock_scans;
+  info->clock_referenced = clock_referenced;
+  info->num_disk_reads = disk_reads;
+  info->bcache_size = bcache_nbuf;
+  info->bcache_hits = bcache_hits;
+  info->bcache_misses = bcache_misses;
+  info->icache_size = icache_ninode;
+  info->icache_hits = icache_hits;
+  info->icache_misses = icache_misses;
+  info->dcache_hits = dcache_hits;
+  info->dcache_misses = dcache_misses;
+  info->pcache_size = pcache_npage;
+  info->pcache_hits = pcache_hits;
+  info->pcache_misses = pcache_misses;
+  kallocstats(info->free_blocks);
+  info->disk_reads = disk_reads;
+  info->disk_writes = disk_writes;
+  info->disk_requests = disk_requests;
+  info->log_commits = log_commits;
+  info->log_blocks = log_blocks;
+  info->log_checkpoints = log_checkpoints;
+  info->ticks = ticks;
+  info->tsc = rdtsc();
+  info->ncpu = ncpu;
+  for (int i = 0; i < ncpu; i++) {
+    info->ctxswitches += cpus[i].nswitch;
+    info->cpu_idle[i] = cpus[i].idlecycles;
+    for (int j = 0; j < NSYSCALL; j++)
+      info->syscalls[j] += cpus[i].nsyscall[j];
+  }
 
   return 0;
 }
+
+// lockstat(struct lockstat *st, int n, int reset): copy the counters
+// of up to n lock classes into st, zeroing them after if reset is
+// set.  Returns the number copied.
+int sys_lockstat(void) {
+  struct lockstat *st;
+  int n, reset;
+
+  if (argint(1, &n) < 0 || argint(2, &reset) < 0 || n < 0 || n > NLOCKCLASS ||
+      argptr(0, (void *)&st, n * sizeof(*st)) < 0)
+    return -1;
+  return lockstats(st, n, reset);
+}
+
+// syscallstat(int cmd, void *buf, int n): see scstat.h for the
+// commands.  Returns the number of scprocs filled for SCS_PROCS, or 0.
+int sys_syscallstat(void) {
+  struct scstat *st;
+  struct scproc *sp;
+  int cmd, n, i, j, b;
+
+  if (argint(0, &cmd) < 0 || argint(2, &n) < 0)
+    return -1;
+  switch (cmd) {
+  case SCS_GET:
+    if (argptr(1, (void *)&st, sizeof(*st)) < 0)
+      return -1;
+    memset(st, 0, sizeof(*st));
+    st->on = sctiming;
+    for (i = 0; i < ncpu; i++) {
+      for (j = 0; j < NSYSCALL; j++) {
+        st->cycles[j] += sclat[i].cycles[j];
+        st->max[j] = max(st->max[j], sclat[i].max[j]);
+        for (b = 0; b < NLATBUCKET; b++) {
+          st->hist[j][b] += sclat[i].hist[j][b];
+          st->calls[j] += sclat[i].hist[j][b];
+        }
+      }
+    }
+    return 0;
+  case SCS_PROCS:
+    if (n < 0 || n > NPROC || argptr(1, (void *)&sp, n * sizeof(*sp)) < 0)
+      return -1;
+    return procsyscalls(sp, n);
+  case SCS_RESET:
+    memset(sclat, 0, sizeof(sclat));
+    return 0;
+  case SCS_ON:
+  case SCS_OFF:
+    sctiming = cmd == SCS_ON;
+    return 0;
+  }
+  return -1;
+}
+
+// trace(int cmd, struct tracerec *buf, int n): turn tracing on or off,
+// or drain up to n records into buf.  Returns the number drained, or 0.
+int sys_trace(void) {
+  struct tracerec *buf;
+  int cmd, n;
+
+  if (argint(0, &cmd) < 0 || argint(2, &n) < 0)
+    return -1;
+  switch (cmd) {
+  case TRACE_ON:
+  case TRACE_OFF:
+    tracing = cmd == TRACE_ON;
+    return 0;
+  case TRACE_READ:
+    if (n < 0 || argptr(1, (void *)&buf, n * sizeof(*buf)) < 0)
+      return -1;
+    // The copies happen under tracelock
+    vspacepin(&myproc()->group->vspace, (char *)buf, n * sizeof(*buf), 1);
+    n = traceread(buf, n);
+    vspaceunpin(&myproc()->group->vspace);
+    return n;
+  }
+  return -1;
+}
+
+// profile(int cmd, struct profsample *buf, int n): start sampling n
+// times a tick, stop, or drain up to n samples into buf.  Stopping
+// returns how many samples were dropped because a buffer was full;
+// draining returns the number drained.
+int sys_profile(void) {
+  struct profsample *buf;
+  int cmd, n;
+
+  if (argint(0, &cmd) < 0 || argint(2, &n) < 0)
+    return -1;
+  switch (cmd) {
+  case PROF_ON:
+    if (n < 1 || n > PROFMAXRATE)
+      return -1;
+    profdropped();
+    profrate = n;
+    return 0;
+  case PROF_OFF:
+    profrate = 0;
+    return profdropped();
+  case PROF_READ:
+    if (n < 0 || argptr(1, (void *)&buf, n * sizeof(*buf)) < 0)
+      return -1;
+    // The copies happen under proflock
+    vspacepin(&myproc()->group->vspace, (char *)buf, n * sizeof(*buf), 1);
+    n = profread(buf, n);
+    vspaceunpin(&myproc()->group->vspace);
+    return n;
+  }
+  return -1;
+}
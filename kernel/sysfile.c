@@ -9,13 +9,16 @@
 #include <fcntl.h>
 #include <file.h>
 #include <fs.h>
+#include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
+#include <poll.h>
 #include <proc.h>
 #include <sleeplock.h>
 #include <spinlock.h>
 #include <stat.h>
 #include <trap.h>
+#include <uio.h>
 
 /*
  * arg0: int [file descriptor]
@@ -55,7 +58,7 @@ int sys_dup(void)
     cprintf("sys_dup error: fd is out of bounds\n");
   }
 
-  struct desc desc = myproc()->file_array[fd];
+  struct desc desc = myproc()->group->file_array[fd];
   struct file *file = desc.fileptr;
 
   // Check that fd is a valid open file descriptor
@@ -80,10 +83,10 @@ int sys_dup(void)
   for (int i = 0; i < NOFILE; i++)
   {
     // If file descriptor is available, then allocate to current process
-    if (myproc()->file_array[i].available == DESC_AVAIL)
+    if (myproc()->group->file_array[i].available == DESC_AVAIL)
     {
       dup_fd = i;
-      myproc()->file_array[i].available = DESC_NOT_AVAIL;
+      myproc()->group->file_array[i].available = DESC_NOT_AVAIL;
       break;
     }
   }
@@ -96,12 +99,181 @@ int sys_dup(void)
     return -1;
   }
 
-  myproc()->file_array[dup_fd].fileptr = file;
-  myproc()->file_array[dup_fd].fileptr->ref_count++;
+  myproc()->group->file_array[dup_fd].fileptr = file;
+  filedup(file);
   releasesleep(&global_files.lock);
   return dup_fd;
 }
 
+// Read up to size bytes from pipe into buffer, waiting until there
+// are size bytes or no writers.  Returns the number of bytes read, or
+// -1 if none could be copied out.
+//
+// A fault on user memory may sleep, so a user buffer is not touched
+// under the pipe's spinlock: the data comes out a page at a time to a
+// page of ours, and is copied on with the lock dropped.
+static int piperead(struct pipe *pipe, char *buffer, int size)
+{
+  int user = (uint64_t)buffer < KERNBASE;
+  char *bounce = 0;
+  int data_read = 0, n, r;
+
+  if (user && (bounce = kalloc()) == 0)
+    return -1;
+  acquire(&pipe->lock);
+
+  while (data_read != size)
+  {
+    // Wait while the pipe is empty by sleeping on the pipe address;
+    // with no writers left there is nothing more to read
+    while (pipe->data_count == 0 && pipe->writers > 0)
+      sleep(&pipe->read_off, &pipe->lock);
+    if (pipe->data_count == 0)
+      break;
+
+    // Read as many bytes as you can
+    int was_full = pipe->data_count == MAX_PIPE_SIZE;
+    if (user)
+      n = pipecopyout(pipe, bounce, min(size - data_read, PGSIZE));
+    else
+      n = pipecopyout(pipe, buffer + data_read, size - data_read);
+
+    // Only a full pipe can have writers waiting on it
+    if (was_full) {
+      wakeupone(&pipe->write_off);
+      pollwake(pipe->pollers);
+    }
+
+    if (user) {
+      release(&pipe->lock);
+      r = copyout((uint64_t)buffer + data_read, bounce, n);
+      acquire(&pipe->lock);
+      if (r < 0) {
+        data_read = data_read ? data_read : -1;
+        break;
+      }
+    }
+    data_read += n;
+  }
+  // Pass on to the next reader whatever we left
+  if (pipe->data_count > 0)
+    wakeupone(&pipe->read_off);
+  release(&pipe->lock);
+  if (bounce)
+    kfree(bounce);
+  return data_read;
+}
+
+// Write size bytes from buffer to pipe, waiting for room as needed.
+// Returns size, or -1 if the pipe has no readers.
+//
+// As in piperead(), a user buffer is copied in a page at a time to a
+// page of ours before the pipe's spinlock is taken.  A write of up to
+// a page still goes into the pipe whole.
+static int pipewrite(struct pipe *pipe, char *buffer, int size)
+{
+  int user = (uint64_t)buffer < KERNBASE;
+  char *bounce = 0, *src;
+  int data_written = 0, n, done;
+
+  if (user && (bounce = kalloc()) == 0)
+    return -1;
+
+  while (data_written != size)
+  {
+    src = buffer + data_written;
+    n = size - data_written;
+    if (user) {
+      n = min(n, PGSIZE);
+      if (copyin(bounce, (uint64_t)src, n) < 0) {
+        data_written = -1;
+        break;
+      }
+      src = bounce;
+    }
+
+    acquire(&pipe->lock);
+    for (done = 0; done < n; )
+    {
+      // Wait while the pipe is full by sleeping on the pipe address
+      while (pipe->data_count == MAX_PIPE_SIZE && pipe->readers > 0)
+        sleep(&pipe->write_off, &pipe->lock);
+
+      // Special case: If there are no read fds to pipe, then return an error
+      if (pipe->readers == 0)
+        break;
+
+      // Write as many bytes as you can
+      int was_empty = pipe->data_count == 0;
+      done += pipecopyin(pipe, src + done, n - done);
+
+      // Only an empty pipe can have readers waiting on it
+      if (was_empty) {
+        wakeupone(&pipe->read_off);
+        pollwake(pipe->pollers);
+      }
+    }
+    // Pass on to the next writer whatever room we left
+    if (pipe->data_count < MAX_PIPE_SIZE)
+      wakeupone(&pipe->write_off);
+    release(&pipe->lock);
+
+    if (done < n) {
+      data_written = -1;
+      break;
+    }
+    data_written += n;
+  }
+  if (bounce)
+    kfree(bounce);
+  return data_written;
+}
+
+// The file fd names, or 0 if fd is not open.  Threads share the
+// descriptor table, so a reference is taken under global_files.lock
+// to keep a sibling's close() from freeing the file, or the pipe
+// behind it, while the caller uses it; fdput() drops it.
+static struct file *fdget(int fd)
+{
+  struct file *file = 0;
+
+  if (fd < 0 || fd >= NOFILE)
+    return 0;
+  acquiresleep(&global_files.lock);
+  if (myproc()->group->file_array[fd].available != DESC_AVAIL) {
+    file = myproc()->group->file_array[fd].fileptr;
+    filedup(file);
+  }
+  releasesleep(&global_files.lock);
+  return file;
+}
+
+// Drop the reference fdget() took, closing the file if the
+// descriptor was closed meanwhile.
+static void fdput(struct file *file)
+{
+  acquiresleep(&global_files.lock);
+  fileclose(file);
+  releasesleep(&global_files.lock);
+}
+
+// The file fd names if it is open for reading, or for writing if
+// writing is set, or 0.  Like fdget(), it takes a reference.
+static struct file *fdfile(int fd, int writing)
+{
+  struct file *file;
+  int mode;
+
+  if ((file = fdget(fd)) == 0)
+    return 0;
+  mode = file->access_mode;
+  if (writing ? mode != O_WRONLY && mode != O_RDWR : mode != O_RDONLY && mode != O_RDWR) {
+    fdput(file);
+    return 0;
+  }
+  return file;
+}
+
 /*
  * arg0: int [file descriptor]
  * arg1: char * [buffer to write read bytes to]
@@ -125,8 +297,6 @@ int sys_dup(void)
  */
 int sys_read(void)
 {
-  acquiresleep(&global_files.lock);
-
   int fd;
   char *buffer;
   int size;
@@ -135,7 +305,6 @@ int sys_read(void)
   if (argint(0, &fd) < 0 || argint(2, &size) < 0 || argptr(1, &buffer, size) < 0)
   {
     cprintf("sys_read error: arguments were invalid.\n");
-    releasesleep(&global_files.lock);
     return -1;
   }
 
@@ -143,18 +312,14 @@ int sys_read(void)
   if (size < 0)
   {
     cprintf("sys_read error: size was negative.\n");
-    releasesleep(&global_files.lock);
     return -1;
   }
 
-  struct desc desc = myproc()->file_array[fd];
-  struct file *file = desc.fileptr;
-
   // Check that fd is a valid open file descriptor
-  if (fd < 0 || fd >= NOFILE || desc.available == DESC_AVAIL)
+  struct file *file = fdget(fd);
+  if (file == 0)
   {
     cprintf("sys_read error: file descriptor %d is not available.\n", fd);
-    releasesleep(&global_files.lock);
     return -1;
   }
 
@@ -163,70 +328,48 @@ int sys_read(void)
   if (access_mode != O_RDONLY && access_mode != O_RDWR)
   {
     cprintf("sys_read error: attempted to read in write access mode.\n");
-    releasesleep(&global_files.lock);
+    fdput(file);
     return -1;
   }
 
   // Case: if the file struct points to a pipe, then we need to read from a pipe
-  struct pipe *pipe = file->pipeptr;
-  if (file->file_type == PIPE)
-  {
-    releasesleep(&global_files.lock);
-    acquire(&pipe->lock);
-
-    // Wait while the pipe is full
-    int data_read = 0;
-    while (data_read != size)
-    {
-      // Wait while the pipe is empty by sleeping on the pipe address
-      while (pipe->data_count == 0)
-      {
-        // Special case: if there are no fds left and and no data left, then simply return zero
-        int write_ref = 0;
-        for (int i = 0; i < NFILE; i++)
-        {
-          struct file curr_file = global_files.files[i];
-          if (curr_file.available == FILE_NOT_AVAIL && curr_file.access_mode == O_WRONLY && curr_file.file_type == PIPE && curr_file.pipeptr == pipe)
-          {
-            write_ref += curr_file.ref_count;
-          }
-        }
-        if (write_ref == 0 && pipe->data_count == 0)
-        {
-          release(&pipe->lock);
-          return data_read;
-        }
-
-        // Sleep, but who will wake us up again?
-        sleep(pipe, &pipe->lock);
-      }
+  int bytes_read;
+  if (file->file_type == PIPE) {
+    bytes_read = piperead(file->pipeptr, buffer, size);
+    fdput(file);
+    return bytes_read;
+  }
 
-      // Read as many bytes as you can
-      while (1)
-      {
-        buffer[data_read] = pipe->buffer[pipe->read_off];
-        data_read++;
-        pipe->read_off = (pipe->read_off + 1) % MAX_PIPE_SIZE;
-        pipe->data_count--;
-        if (data_read == size || pipe->data_count == 0)
-        {
-          break;
-        }
-      }
+  // The offset is per open file, so only sharers of this file wait
+  acquiresleep(&file->lock);
 
-      // Signal that some bytes were read
-      wakeup(pipe);
-    }
-    release(&pipe->lock);
-    return data_read;
-  }
+  // Grow the read-ahead window while the file is read sequentially,
+  // and turn it off on the first seek.
+  if (file->offset == file->ra_off)
+    file->ra_win = file->ra_win ? min(file->ra_win * 2, (uint)RAMAXBLOCKS) : 4;
+  else
+    file->ra_win = file->ra_end = 0;
 
   // Read bytes into buffer
-  int bytes_read = concurrent_readi(file->inodep, buffer, file->offset, size);
+  bytes_read = concurrent_readi(file->inodep, buffer, file->offset, size);
 
   // Update offset
   file->offset += bytes_read;
-  releasesleep(&global_files.lock);
+  file->ra_off = file->offset;
+
+  // Keep the window ahead of the reader, topping it up once less
+  // than half of it is left.
+  if (file->ra_win && bytes_read > 0) {
+    uint blk = file->offset / BSIZE;
+    if (file->ra_end < blk + file->ra_win / 2) {
+      uint from = max(blk, file->ra_end);
+      concurrent_readahead(file->inodep, from, blk + file->ra_win - from);
+      file->ra_end = blk + file->ra_win;
+    }
+  }
+  releasesleep(&file->lock);
+  fdput(file);
+
   return bytes_read;
 }
 
@@ -258,8 +401,6 @@ int sys_read(void)
  */
 int sys_write(void)
 {
-  acquiresleep(&global_files.lock);
-
   int fd;
   char *buffer;
   int size;
@@ -268,7 +409,6 @@ int sys_write(void)
   if (argint(0, &fd) < 0 || argint(2, &size) < 0 || argptr(1, &buffer, size) < 0)
   {
     cprintf("sys_write error: invalid arguments.\n");
-    releasesleep(&global_files.lock);
     return -1;
   }
 
@@ -276,110 +416,698 @@ int sys_write(void)
   if (size < 0)
   {
     cprintf("sys_write error: size was negative.\n");
-    releasesleep(&global_files.lock);
     return -1;
   }
 
   // Check that fd is open
-  if (fd < 0 || fd >= NOFILE || myproc()->file_array[fd].available == DESC_AVAIL)
+  struct file *file = fdget(fd);
+  if (file == 0)
   {
     cprintf("sys_write error: fd %d was not valid.\n", fd);
-    releasesleep(&global_files.lock);
     return -1;
   }
 
-  struct file *file = myproc()->file_array[fd].fileptr;
-
   // Check that access mode is allowing writing
   int access_mode = file->access_mode;
   if (access_mode != O_WRONLY && access_mode != O_RDWR)
   {
     cprintf("sys_write error: no write access mode.\n");
-    releasesleep(&global_files.lock);
+    fdput(file);
     return -1;
   }
 
   // Case: if the file struct points to a pipe, then we need to write to a pip
-  struct pipe *pipe = file->pipeptr;
-  if (file->file_type == PIPE)
+  int bytes_written;
+  if (file->file_type == PIPE) {
+    bytes_written = pipewrite(file->pipeptr, buffer, size);
+    fdput(file);
+    return bytes_written;
+  }
+
+  // Write to file.  A buffer mmap()ed from this same file must be
+  // filled before writei() locks the file, so it is pinned.
+  acquiresleep(&file->lock);
+  vspacepin(&myproc()->group->vspace, buffer, size, 0);
+  bytes_written = concurrent_writei(file->inodep, buffer, file->offset, size);
+  vspaceunpin(&myproc()->group->vspace);
+  if (bytes_written < 0)
   {
-    releasesleep(&global_files.lock);
-    acquire(&pipe->lock);
+    cprintf("Error: could not write bytes to file.\n");
+    releasesleep(&file->lock);
+    fdput(file);
+    return -1;
+  }
 
-    // Special case: If there are no read fds to pipe, then return an error
-    int read_ref = 0;
-    for (int i = 0; i < NFILE; i++)
-    {
-      struct file curr_file = global_files.files[i];
-      if (curr_file.available == FILE_NOT_AVAIL && curr_file.access_mode == O_RDONLY && curr_file.file_type == PIPE && curr_file.pipeptr == pipe)
-      {
-        read_ref += curr_file.ref_count;
+  file->offset += bytes_written;
+  if (file->sync)
+    fsynci(file->inodep);
+  releasesleep(&file->lock);
+  fdput(file);
+  return bytes_written;
+}
+
+// Copy in the array of cnt iovecs argument n points to, checking
+// that each buffer lies in user memory and that the total fits in an
+// int.  Returns 0, or -1 if anything is invalid.
+static int argiov(int n, int cnt, struct iovec *iov)
+{
+  int64_t uiov;
+  uint64_t total;
+
+  if (cnt < 0 || cnt > IOV_MAX || argint64(n, &uiov) < 0 ||
+      copyin(iov, uiov, cnt * sizeof(struct iovec)) < 0)
+    return -1;
+  total = 0;
+  for (int i = 0; i < cnt; i++) {
+    total += iov[i].iov_len;
+    if (iov[i].iov_len > 0x7fffffff || total > 0x7fffffff ||
+        checkptr((uint64_t)iov[i].iov_base, iov[i].iov_len) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: char * [buffer to read into]
+ * arg2: int [number of bytes to read]
+ * arg3: int [offset in the file to read from]
+ *
+ * Like read(), but from offset arg3, leaving the file's current
+ * position as it is.  Readers sharing the file don't wait for each
+ * other.
+ *
+ * Error conditions:
+ * any of read()'s
+ * arg0 is a pipe
+ * arg3 is negative
+ */
+int sys_pread(void)
+{
+  int fd, size, off, n;
+  char *buffer;
+  struct file *file;
+
+  if (argint(0, &fd) < 0 || argint(2, &size) < 0 || argint(3, &off) < 0 ||
+      size < 0 || off < 0 || argptr(1, &buffer, size) < 0)
+    return -1;
+  if ((file = fdfile(fd, 0)) == 0)
+    return -1;
+  n = -1;
+  if (file->file_type != PIPE)
+    n = concurrent_readi(file->inodep, buffer, off, size);
+  fdput(file);
+  return n;
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: char * [buffer of bytes to write]
+ * arg2: int [number of bytes to write]
+ * arg3: int [offset in the file to write at]
+ *
+ * Like write(), but at offset arg3, leaving the file's current
+ * position as it is.
+ *
+ * Error conditions:
+ * any of write()'s
+ * arg0 is a pipe
+ * arg3 is negative
+ */
+int sys_pwrite(void)
+{
+  int fd, size, off, n;
+  char *buffer;
+  struct file *file;
+
+  if (argint(0, &fd) < 0 || argint(2, &size) < 0 || argint(3, &off) < 0 ||
+      size < 0 || off < 0 || argptr(1, &buffer, size) < 0)
+    return -1;
+  if ((file = fdfile(fd, 1)) == 0)
+    return -1;
+  if (file->file_type == PIPE) {
+    fdput(file);
+    return -1;
+  }
+
+  // As in sys_write(), the buffer may be mmap()ed from this file
+  vspacepin(&myproc()->group->vspace, buffer, size, 0);
+  n = concurrent_writei(file->inodep, buffer, off, size);
+  vspaceunpin(&myproc()->group->vspace);
+  if (n > 0 && file->sync)
+    fsynci(file->inodep);
+  fdput(file);
+  return n;
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: struct iovec * [buffers to read into]
+ * arg2: int [number of buffers, at most IOV_MAX]
+ *
+ * Like read() into each of the arg2 buffers of arg1 in turn, as one
+ * read: a file is locked once, and reading stops at the first buffer
+ * that isn't filled.
+ *
+ * Return the number of bytes read, or -1 if there was an error.
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for read
+ * some address in arg1, or in a buffer it describes, is invalid
+ * arg2 is negative or more than IOV_MAX
+ */
+int sys_readv(void)
+{
+  struct iovec iov[IOV_MAX];
+  struct file *file;
+  int fd, cnt, n, r;
+
+  if (argint(0, &fd) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, iov) < 0)
+    return -1;
+  if ((file = fdfile(fd, 0)) == 0)
+    return -1;
+
+  if (file->file_type == PIPE) {
+    n = 0;
+    for (int i = 0; i < cnt; i++) {
+      if ((r = piperead(file->pipeptr, iov[i].iov_base, iov[i].iov_len)) < 0) {
+        n = n ? n : -1;
+        break;
       }
+      n += r;
+      if (r != iov[i].iov_len)
+        break;
     }
-    if (read_ref == 0)
-    {
+    fdput(file);
+    return n;
+  }
+
+  acquiresleep(&file->lock);
+  locki_shared(file->inodep);
+  n = readiv(file->inodep, iov, cnt, file->offset);
+  unlocki(file->inodep);
+  if (n > 0)
+    file->offset += n;
+  releasesleep(&file->lock);
+  fdput(file);
+  return n;
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: struct iovec * [buffers to write]
+ * arg2: int [number of buffers, at most IOV_MAX]
+ *
+ * Like write() of each of the arg2 buffers of arg1 in turn, as one
+ * write: a file is locked once, and the data goes into the log in as
+ * few transactions as one write() of the total would take.
+ *
+ * Return the number of bytes written, or -1 if there was an error.
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for write
+ * some address in arg1, or in a buffer it describes, is invalid
+ * arg2 is negative or more than IOV_MAX
+ * arg0 is a pipe with no readers
+ */
+int sys_writev(void)
+{
+  struct iovec iov[IOV_MAX];
+  struct file *file;
+  int fd, cnt, n, r;
+
+  if (argint(0, &fd) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, iov) < 0)
+    return -1;
+  if ((file = fdfile(fd, 1)) == 0)
+    return -1;
+
+  if (file->file_type == PIPE) {
+    n = 0;
+    for (int i = 0; i < cnt; i++) {
+      if ((r = pipewrite(file->pipeptr, iov[i].iov_base, iov[i].iov_len)) < 0) {
+        n = n ? n : -1;
+        break;
+      }
+      n += r;
+    }
+    fdput(file);
+    return n;
+  }
+
+  // As in sys_write(), the buffers may be mmap()ed from this file
+  acquiresleep(&file->lock);
+  for (int i = 0; i < cnt; i++)
+    vspacepin(&myproc()->group->vspace, iov[i].iov_base, iov[i].iov_len, 0);
+  locki(file->inodep);
+  n = writeiv(file->inodep, iov, cnt, file->offset);
+  unlocki(file->inodep);
+  for (int i = 0; i < cnt; i++)
+    vspaceunpin(&myproc()->group->vspace);
+  if (n > 0)
+    file->offset += n;
+  if (n > 0 && file->sync)
+    fsynci(file->inodep);
+  releasesleep(&file->lock);
+  fdput(file);
+  return n;
+}
+
+// Copy n bytes of file data into the pipe arg, which has room for
+// them.  readiblock() calls this with the data still in its buffer.
+static int pipefill(char *data, int n, void *arg)
+{
+  struct pipe *pipe = arg;
+  int was_empty;
+
+  acquire(&pipe->lock);
+  was_empty = pipe->data_count == 0;
+  n = pipecopyin(pipe, data, n);
+  if (was_empty && n > 0) {
+    wakeupone(&pipe->read_off);
+    pollwake(pipe->pollers);
+  }
+  release(&pipe->lock);
+  return n;
+}
+
+// Send up to len bytes of ip from off into pipe, a block at a time
+// straight from the buffer cache.  Returns the number of bytes sent,
+// or -1 if the pipe has no readers before any are.
+static int sendpipe(struct inode *ip, uint off, int len, struct pipe *pipe)
+{
+  int done, room, n;
+  uint blk;
+
+  for (done = 0; done < len; done += n) {
+    acquire(&pipe->lock);
+    while (pipe->data_count == MAX_PIPE_SIZE && pipe->readers > 0)
+      sleep(&pipe->write_off, &pipe->lock);
+    if (pipe->readers == 0) {
       release(&pipe->lock);
-      return -1;
+      return done ? done : -1;
     }
+    room = MAX_PIPE_SIZE - pipe->data_count;
+    release(&pipe->lock);
 
-    // Wait while the pipe is full
-    int data_written = 0;
-    while (data_written != size)
-    {
-      // Wait while the pipe is full by sleeping on the pipe address
-      while (pipe->data_count == MAX_PIPE_SIZE)
-      {
-        // Special case: If there are no read fds to pipe, then return an error
-        int read_ref = 0;
-        for (int i = 0; i < NFILE; i++)
-        {
-          struct file curr_file = global_files.files[i];
-          if (curr_file.available == FILE_NOT_AVAIL && curr_file.access_mode == O_RDONLY && curr_file.file_type == PIPE && curr_file.pipeptr == pipe)
-          {
-            read_ref += curr_file.ref_count;
-          }
-        }
-        if (read_ref == 0)
-        {
-          release(&pipe->lock);
-          return -1;
-        }
-
-        sleep(pipe, &pipe->lock);
-      }
+    // Only this writer fills the room, so it is still there, and the
+    // next blocks are read ahead at each half window
+    locki_shared(ip);
+    blk = (off + done) / BSIZE;
+    if ((off + done) % BSIZE == 0 && blk % (RAMAXBLOCKS / 2) == 0)
+      readahead(ip, blk, RAMAXBLOCKS);
+    n = readiblock(ip, off + done, min(room, len - done), pipefill, pipe);
+    unlocki(ip);
+    if (n <= 0)
+      break;
+  }
 
-      // Write as many bytes as you can
-      while (1)
-      {
-        pipe->buffer[pipe->write_off] = buffer[data_written];
-        data_written++;
-        pipe->write_off = (pipe->write_off + 1) % MAX_PIPE_SIZE;
-        pipe->data_count++;
-        if (data_written == size || pipe->data_count == MAX_PIPE_SIZE)
-        {
-          break;
-        }
+  // Pass on to the next writer whatever room we left
+  acquire(&pipe->lock);
+  if (pipe->data_count < MAX_PIPE_SIZE)
+    wakeupone(&pipe->write_off);
+  release(&pipe->lock);
+  return done;
+}
+
+// Write n bytes from the kernel buffer buf to out, at its offset if
+// it is a file, whose lock the caller holds.  Returns the number of
+// bytes written, or -1.
+static int kwrite(struct file *out, char *buf, int n)
+{
+  if (out->file_type == PIPE)
+    return pipewrite(out->pipeptr, buf, n);
+  if ((n = concurrent_writei(out->inodep, buf, out->offset, n)) > 0)
+    out->offset += n;
+  return n;
+}
+
+/*
+ * arg0: int [file descriptor to write to]
+ * arg1: int [file descriptor of a file to read from]
+ * arg2: int [offset in arg1 to read from, or -1]
+ * arg3: int [number of bytes to send]
+ *
+ * Copy up to arg3 bytes of the file arg1 to arg0 inside the kernel,
+ * without passing them through user memory.  If arg0 is a pipe the
+ * data goes from the buffer cache straight into the pipe; otherwise
+ * it is staged through one kernel page.  Reads from offset arg2,
+ * leaving arg1's position as it is, or from and advancing its
+ * position if arg2 is -1.
+ *
+ * Return the number of bytes sent, which is short only at the end of
+ * arg1 or on an error after some were, or -1 if there was an error.
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for write
+ * arg1 is not a file descriptor open for read, or is a pipe or device
+ * arg2 is less than -1 or arg3 is negative
+ * arg0 is a pipe with no readers
+ */
+int sys_sendfile(void)
+{
+  struct file *out, *in;
+  int outfd, infd, off, len, done, n, w;
+  char *page;
+
+  if (argint(0, &outfd) < 0 || argint(1, &infd) < 0 || argint(2, &off) < 0 ||
+      argint(3, &len) < 0 || off < -1 || len < 0)
+    return -1;
+  if ((out = fdfile(outfd, 1)) == 0)
+    return -1;
+  if ((in = fdfile(infd, 0)) == 0 || in->file_type == PIPE ||
+      in->inodep->type == T_DEV) {
+    if (in)
+      fdput(in);
+    fdput(out);
+    return -1;
+  }
+
+  if (off < 0)
+    acquiresleep(&in->lock);
+  done = 0;
+  if (out->file_type == PIPE) {
+    done = sendpipe(in->inodep, off < 0 ? in->offset : off, len, out->pipeptr);
+  } else if ((page = kalloc()) == 0) {
+    done = -1;
+  } else {
+    if (out->file_type != PIPE && out != in)
+      acquiresleep(&out->lock);
+    while (done < len) {
+      n = concurrent_readi(in->inodep, page, (off < 0 ? in->offset : off) + done,
+                           min(len - done, PGSIZE));
+      if (n <= 0)
+        break;
+      if ((w = kwrite(out, page, n)) > 0)
+        done += w;
+      if (w != n) {
+        if (done == 0)
+          done = -1;
+        break;
       }
+    }
+    if (out->file_type != PIPE && out->sync && done > 0)
+      fsynci(out->inodep);
+    if (out->file_type != PIPE && out != in)
+      releasesleep(&out->lock);
+    kfree(page);
+  }
+  if (off < 0) {
+    if (done > 0)
+      in->offset += done;
+    releasesleep(&in->lock);
+  }
+  fdput(in);
+  fdput(out);
+  return done;
+}
 
-      // Signal that some bytes were written
-      wakeup(pipe);
+/*
+ * arg0: int [file descriptor of a pipe to read from]
+ * arg1: int [file descriptor to write to]
+ * arg2: int [number of bytes to move]
+ *
+ * Move up to arg2 bytes out of the pipe arg0 and write them to arg1
+ * inside the kernel, a page at a time, as read() and write() would
+ * through a user buffer.  Waits for data as read() does, but stops
+ * only at arg2 bytes or once the pipe has no writers.
+ *
+ * Return the number of bytes moved, or -1 if there was an error.
+ * Bytes taken from the pipe that could not be written are lost.
+ *
+ * Error conditions:
+ * arg0 is not a pipe open for read
+ * arg1 is not a file descriptor open for write, or is arg0's pipe
+ * arg2 is negative
+ */
+int sys_splice(void)
+{
+  struct file *in, *out;
+  int infd, outfd, len, done, n, w;
+  char *page;
+
+  if (argint(0, &infd) < 0 || argint(1, &outfd) < 0 || argint(2, &len) < 0 ||
+      len < 0)
+    return -1;
+  if ((in = fdfile(infd, 0)) == 0)
+    return -1;
+  out = 0;
+  if (in->file_type != PIPE || (out = fdfile(outfd, 1)) == 0 ||
+      out->pipeptr == in->pipeptr || (page = kalloc()) == 0) {
+    if (out)
+      fdput(out);
+    fdput(in);
+    return -1;
+  }
+
+  if (out->file_type != PIPE)
+    acquiresleep(&out->lock);
+  done = 0;
+  while (done < len) {
+    if ((n = piperead(in->pipeptr, page, min(len - done, PGSIZE))) <= 0)
+      break;
+    if ((w = kwrite(out, page, n)) > 0)
+      done += w;
+    if (w != n) {
+      if (done == 0)
+        done = -1;
+      break;
     }
-    release(&pipe->lock);
-    return data_written;
   }
+  if (out->file_type != PIPE && out->sync && done > 0)
+    fsynci(out->inodep);
+  if (out->file_type != PIPE)
+    releasesleep(&out->lock);
+  kfree(page);
+  fdput(out);
+  fdput(in);
+  return done;
+}
 
-  // Write to file
-  int bytes_written = concurrent_writei(file->inodep, buffer, file->offset, size);
-  if (bytes_written < 0)
-  {
-    cprintf("Error: could not write bytes to file.\n");
-    releasesleep(&global_files.lock);
+/*
+ * arg0: int [file descriptor of a file to read from]
+ * arg1: int [file descriptor of an empty file to write to]
+ *
+ * Make arg1's file a copy of arg0's that shares its data blocks until
+ * either is written, so no data is read or written, however big the
+ * file.  Neither file's position changes.
+ *
+ * Return 0 on success, -1 otherwise
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for read on a regular file
+ * arg1 is not a file descriptor open for write on an empty regular file
+ * arg0 and arg1 are the same file
+ * a block of arg0 is shared by too many files already
+ */
+int sys_clone_file(void)
+{
+  struct file *src, *dst;
+  int srcfd, dstfd, r;
+
+  if (argint(0, &srcfd) < 0 || argint(1, &dstfd) < 0)
+    return -1;
+  if ((src = fdfile(srcfd, 0)) == 0)
+    return -1;
+  if ((dst = fdfile(dstfd, 1)) == 0) {
+    fdput(src);
     return -1;
   }
+  r = -1;
+  if (src->file_type == FILE && dst->file_type == FILE)
+    r = clonei(src->inodep, dst->inodep);
+  fdput(dst);
+  fdput(src);
+  return r;
+}
 
-  file->offset += bytes_written;
-  releasesleep(&global_files.lock);
-  return bytes_written;
+/*
+ * arg0: int [file descriptor]
+ * arg1: int [offset]
+ * arg2: int [number of bytes]
+ *
+ * Make the arg2 bytes of the file at arg1 read as zeros, giving back
+ * the blocks they cover in full.  Bytes past the end of the file are
+ * left alone, and its size and position do not change.
+ *
+ * Return 0 on success, -1 otherwise
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for write on a regular file
+ * arg1 or arg2 is negative
+ * the range has too many extents to punch at once
+ */
+int sys_fpunch(void)
+{
+  struct file *f;
+  int fd, off, len, r;
+
+  if (argint(0, &fd) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0 ||
+      off < 0 || len < 0)
+    return -1;
+  if ((f = fdfile(fd, 1)) == 0)
+    return -1;
+  r = -1;
+  if (f->file_type == FILE)
+    r = ipunch(f->inodep, off, len);
+  fdput(f);
+  return r;
+}
+
+/*
+ * arg0: int [file descriptor]
+ *
+ * Move the file's data into as few extents as the free space allows,
+ * a run of them at a time.  Its contents do not change.
+ *
+ * Return the number of extents the file has left, -1 otherwise
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for write on a regular file
+ * the file has more extents than its inode holds
+ * the file shares blocks with a clone
+ */
+int sys_defrag(void)
+{
+  struct file *f;
+  int fd, r;
+
+  if (argint(0, &fd) < 0)
+    return -1;
+  if ((f = fdfile(fd, 1)) == 0)
+    return -1;
+  r = -1;
+  if (f->file_type == FILE)
+    r = defragi(f->inodep);
+  fdput(f);
+  return r;
+}
+
+// What of events, POLLHUP and POLLNVAL are ready on file, which is 0
+// if its descriptor is not open; if none of events is and e is set,
+// e is left queued for a change.
+static int fdpoll(struct file *file, int events, struct pollent *e, struct pollset *ps)
+{
+  struct inode *ip;
+  int ready;
+
+  if (file == 0)
+    return POLLNVAL;
+  if (file->file_type == PIPE)
+    ready = pipepoll(file->pipeptr, file->access_mode == O_RDONLY, events, e, ps);
+  else if ((ip = file->inodep)->type == T_DEV && ip->devid >= 0 &&
+           ip->devid < NDEV && devsw[ip->devid].poll)
+    ready = devsw[ip->devid].poll(ip, events, e, ps);
+  else
+    ready = POLLIN | POLLOUT; // a file never blocks
+  return ready & (events | POLLHUP);
+}
+
+/*
+ * arg0: struct pollfd * [file descriptors and the events to wait for]
+ * arg1: int [number of entries in arg0, at most NOFILE]
+ * arg2: int [ticks to wait at most, or -1 to wait for ever]
+ *
+ * Wait until a read or write on one of the file descriptors of arg0
+ * would not block, for the events asked for in each entry, or until
+ * arg2 ticks pass.  Entries with a negative fd are skipped.  Pipes
+ * and the console wake the caller when they change; files are
+ * always ready.
+ *
+ * Sets the revents of each entry to what is ready, and returns the
+ * number of entries with any, 0 if the time ran out, or -1 if there
+ * was an error.
+ *
+ * Error conditions:
+ * some address in arg0 is invalid
+ * arg1 is negative or more than NOFILE
+ * the process was killed while waiting
+ */
+int sys_poll(void)
+{
+  struct pollfd fds[NOFILE];
+  struct file *files[NOFILE];
+  struct pollset ps;
+  int64_t ufds;
+  int n, timeout, nready, expired, r, i;
+  uint ticks0;
+
+  if (argint(1, &n) < 0 || argint(2, &timeout) < 0 || n < 0 || n > NOFILE ||
+      argint64(0, &ufds) < 0 || copyin(fds, ufds, n * sizeof(struct pollfd)) < 0)
+    return -1;
+  // Referenced until the end, so that no file or pipe is freed
+  // while an entry is queued on it
+  for (i = 0; i < n; i++) {
+    ps.ent[i].pprev = 0;
+    files[i] = fds[i].fd >= 0 ? fdget(fds[i].fd) : 0;
+  }
+
+  ticks0 = ticks;
+  expired = timeout == 0;
+  r = 0;
+  for (;;) {
+    // Queue on each file that isn't ready, so that none can change
+    // unnoticed between looking at it and sleeping
+    pollstart(&ps);
+    nready = 0;
+    for (i = 0; i < n; i++) {
+      fds[i].revents = 0;
+      if (fds[i].fd >= 0)
+        fds[i].revents = fdpoll(files[i], fds[i].events,
+                                expired ? 0 : &ps.ent[i], &ps);
+      if (fds[i].revents)
+        nready++;
+    }
+    if (nready || expired)
+      break;
+
+    r = pollsleep(&ps, timeout < 0 ? -1 : timeout - (int)(ticks - ticks0));
+    for (i = 0; i < n; i++)
+      polldequeue(&ps.ent[i]);
+    if (r < 0)
+      break;
+    if (timeout > 0 && ticks - ticks0 >= timeout)
+      expired = 1;
+  }
+  for (i = 0; i < n; i++) {
+    polldequeue(&ps.ent[i]);
+    if (files[i])
+      fdput(files[i]);
+  }
+
+  if (r < 0 || copyout(ufds, fds, n * sizeof(struct pollfd)) < 0)
+    return -1;
+  return nready;
+}
+
+/*
+ * arg0: int [file descriptor]
+ *
+ * Make what has been written to the file arg0 durable.  Writes reach
+ * the log's open transaction, which commits by itself within
+ * LOGCOMMITTICKS ticks; fsync() commits it now if it holds any of
+ * the file's writes, and costs nothing otherwise.  The file's size
+ * and blocks go in the same transaction as its data, so
+ * fdatasync() is the same call.
+ *
+ * Return 0, or -1 if arg0 is not an open file descriptor.
+ * Pipes and devices have nothing to sync and return 0.
+ */
+int sys_fsync(void)
+{
+  struct file *file;
+  int fd;
+
+  if (argint(0, &fd) < 0 || (file = fdget(fd)) == 0)
+    return -1;
+  if (file->file_type == FILE)
+    fsynci(file->inodep);
+  fdput(file);
+  return 0;
+}
+
+int sys_fdatasync(void)
+{
+  return sys_fsync();
 }
 
 /*
@@ -405,45 +1133,19 @@ int sys_close(void)
   }
 
   // Check that fd is currently open file descriptor
-  if (fd < 0 || fd >= NOFILE || myproc()->file_array[fd].available == DESC_AVAIL)
+  if (fd < 0 || fd >= NOFILE || myproc()->group->file_array[fd].available == DESC_AVAIL)
   {
     cprintf("sys_close error: fd %d is not currently open. \n", fd);
     releasesleep(&global_files.lock);
     return -1;
   }
 
-  struct file *file = myproc()->file_array[fd].fileptr;
-
-  // Decrement reference count of global file struct, if ref count is zero,
-  // then we can deallocate it.
-  file->ref_count--;
-  if (file->ref_count == 0 && file->file_type == FILE)
-  {
-    irelease(file->inodep);
-    file->available = FILE_AVAIL;
-  }
+  // Drop the reference to the global file struct, freeing it and
+  // any pipe behind it with the last one
+  fileclose(myproc()->group->file_array[fd].fileptr);
 
   // Deallocate file descriptor in fd array
-  myproc()->file_array[fd].available = DESC_AVAIL;
-
-  // One additional step if the file struct was a PIPE, need to potentially deallocate kernel buffer
-  if (file->file_type == PIPE)
-  {
-    struct pipe *pipe = file->pipeptr;
-    int ref_count = 0;
-    for (int i = 0; i < NFILE; i++)
-    {
-      struct file curr_file = global_files.files[i];
-      if (curr_file.available == FILE_NOT_AVAIL && curr_file.file_type == PIPE && curr_file.pipeptr == pipe)
-      {
-        ref_count += curr_file.ref_count;
-      }
-    }
-    if (ref_count == 0)
-    {
-      kfree((char *)pipe);
-    }
-  }
+  myproc()->group->file_array[fd].available = DESC_AVAIL;
 
   releasesleep(&global_files.lock);
   return 0;
@@ -463,31 +1165,152 @@ int sys_close(void)
  */
 int sys_fstat(void)
 {
-  acquiresleep(&global_files.lock);
-
   int fd;
-  struct stat *statp;
+  int64_t statp;
+  struct stat st;
 
-  if (argint(0, &fd) < 0 || argptr(1, (char **)&statp, sizeof(struct stat)) < 0)
+  if (argint(0, &fd) < 0 || argint64(1, &statp) < 0)
   {
     cprintf("sys_fstat error: arguments not valid");
-    releasesleep(&global_files.lock);
     return -1;
   }
 
   // Check that fd is valid
-  if (fd < 0 || fd >= NOFILE || myproc()->file_array[fd].available == DESC_AVAIL)
+  struct file *file = fdget(fd);
+  if (file == 0)
   {
     cprintf("sys_fstat error: fd %d is not currently open. \n", fd);
-    releasesleep(&global_files.lock);
     return -1;
   }
 
-  concurrent_stati(myproc()->file_array[fd].fileptr->inodep, statp);
-  releasesleep(&global_files.lock);
+  concurrent_stati(file->inodep, &st);
+  fdput(file);
+  if (copyout(statp, &st, sizeof(st)) < 0)
+  {
+    cprintf("sys_fstat error: arguments not valid");
+    return -1;
+  }
   return 0;
 }
 
+/*
+ * arg0: int [directory file descriptor, or AT_FDCWD]
+ * arg1: char * [path of the file]
+ * arg2: struct stat *
+ *
+ * Populate the struct stat for the file at arg1, which is looked up
+ * in the directory open as arg0 if it is relative and arg0 is not
+ * AT_FDCWD, or else as open() would.  No file is opened.
+ *
+ * Return 0 on success, -1 otherwise
+ *
+ * Error conditions:
+ * arg0 is neither AT_FDCWD nor an open file descriptor
+ * the file does not exist
+ * any address within the range [arg2, arg2+sizeof(struct stat)] is invalid
+ */
+int sys_fstatat(void)
+{
+  int fd;
+  char *path;
+  int64_t statp;
+  struct inode *dp, *ip;
+  struct file *file;
+  struct stat st;
+
+  if (argint(0, &fd) < 0 || argstr(1, &path) < 0 || argint64(2, &statp) < 0)
+    return -1;
+
+  dp = 0;
+  file = 0;
+  if (fd != AT_FDCWD) {
+    if ((file = fdget(fd)) == 0)
+      return -1;
+    if (file->file_type != FILE) {
+      fdput(file);
+      return -1;
+    }
+    dp = file->inodep;
+  }
+
+  ip = nameiat(dp, path);
+  if (file)
+    fdput(file);
+  if (ip == 0)
+    return -1;
+  concurrent_stati(ip, &st);
+  irelease(ip);
+  return copyout(statp, &st, sizeof(st));
+}
+
+/*
+ * arg0: int [file descriptor of a directory]
+ * arg1: struct dirent * [buffer]
+ * arg2: int [size of the buffer in bytes]
+ *
+ * Read as many of the directory's entries as fit in arg1, from the
+ * file's current position on, leaving out free ones, and advance the
+ * position past them.
+ *
+ * Return the number of bytes filled in, 0 at the end of the
+ * directory, or -1 on error.
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for read on a directory
+ * some address between [arg1, arg1+arg2) is invalid
+ */
+int sys_getdents(void)
+{
+  struct dirent des[BSIZE / sizeof(struct dirent)];
+  struct file *file;
+  struct inode *ip;
+  int64_t buf;
+  int fd, n, done, got, i, j;
+
+  if (argint(0, &fd) < 0 || argint64(1, &buf) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  if ((file = fdfile(fd, 0)) == 0)
+    return -1;
+  if (file->file_type != FILE) {
+    fdput(file);
+    return -1;
+  }
+  ip = file->inodep;
+
+  acquiresleep(&file->lock);
+  done = 0;
+  while (done + (int)sizeof(struct dirent) <= n) {
+    // Read no more entries than would fit if none were free
+    got = min((int)NELEM(des), (n - done) / (int)sizeof(struct dirent));
+    locki_shared(ip);
+    if (ip->type != T_DIR) {
+      unlocki(ip);
+      releasesleep(&file->lock);
+      fdput(file);
+      return -1;
+    }
+    got = readi(ip, (char *)des, file->offset, got * sizeof(struct dirent));
+    unlocki(ip);
+    if (got <= 0)
+      break;
+    got /= sizeof(struct dirent);
+
+    for (i = j = 0; i < got; i++)
+      if (des[i].inum != 0)
+        des[j++] = des[i];
+    if (j > 0 && copyout(buf + done, des, j * sizeof(struct dirent)) < 0) {
+      releasesleep(&file->lock);
+      fdput(file);
+      return -1;
+    }
+    done += j * sizeof(struct dirent);
+    file->offset += got * sizeof(struct dirent);
+  }
+  releasesleep(&file->lock);
+  fdput(file);
+  return done;
+}
+
 /*
  * arg0: char * [path to the file]
  * arg1: int [mode for opening the file (see inc/fcntl.h)]
@@ -538,10 +1361,10 @@ int sys_open(void)
   for (int i = 0; i < NOFILE; i++)
   {
     // If file descriptor is available, then allocate to current process
-    if (myproc()->file_array[i].available == DESC_AVAIL)
+    if (myproc()->group->file_array[i].available == DESC_AVAIL)
     {
       fd = i;
-      myproc()->file_array[i].available = DESC_NOT_AVAIL;
+      myproc()->group->file_array[i].available = DESC_NOT_AVAIL;
       break;
     }
   }
@@ -561,7 +1384,7 @@ int sys_open(void)
     if (global_files.files[i].available == FILE_AVAIL)
     {
       global_files.files[i].available = FILE_NOT_AVAIL;
-      myproc()->file_array[fd].fileptr = &global_files.files[i];
+      myproc()->group->file_array[fd].fileptr = &global_files.files[i];
       found_open_file = true;
       break;
     }
@@ -591,11 +1414,15 @@ int sys_open(void)
     }
   }
 
-  myproc()->file_array[fd].fileptr->access_mode = (O_RDONLY & mode) + (O_WRONLY & mode) + (O_RDWR & mode); // Set access mode
-  myproc()->file_array[fd].fileptr->inodep = ip;        // Set inode pointer and increase reference count
-  myproc()->file_array[fd].fileptr->ref_count = 1;      // Set reference count to 1
-  myproc()->file_array[fd].fileptr->offset = 0;         // Set offset at 0 to start
-  myproc()->file_array[fd].fileptr->file_type = FILE;   // Set offset at 0 to start
+  myproc()->group->file_array[fd].fileptr->access_mode = (O_RDONLY & mode) + (O_WRONLY & mode) + (O_RDWR & mode); // Set access mode
+  myproc()->group->file_array[fd].fileptr->inodep = ip;        // Set inode pointer and increase reference count
+  myproc()->group->file_array[fd].fileptr->ref_count = 1;      // Set reference count to 1
+  myproc()->group->file_array[fd].fileptr->offset = 0;         // Set offset at 0 to start
+  myproc()->group->file_array[fd].fileptr->ra_off = 0;         // Reset read-ahead state
+  myproc()->group->file_array[fd].fileptr->ra_win = 0;
+  myproc()->group->file_array[fd].fileptr->ra_end = 0;
+  myproc()->group->file_array[fd].fileptr->file_type = FILE;   // Set offset at 0 to start
+  myproc()->group->file_array[fd].fileptr->sync = (mode & O_SYNC) != 0;
 
   releasesleep(&global_files.lock);
   return fd;
@@ -641,7 +1468,6 @@ int sys_exec(void)
     return -1;
   }
 
-  int argc = 0;
   for (int i = 0; arguments[i] != NULL; i++)
   {
     char *dummyptr;
@@ -650,73 +1476,65 @@ int sys_exec(void)
       cprintf("sys_exec error: string of arg1 point to an invalid or unmapped adress.\n");
       return -1;
     }
-    argc++;
   }
 
-  // Create new vspace
-  struct vspace vs;
-  uint64_t stack = SZ_2G;
-  if (vspaceinit(&vs) < 0)
-  {
-    cprintf("sys_exec error: vspaceinit failed.\n");
-    return -1;
-  }
-  uint64_t rip;
-  if (vspaceloadcode(&vs, filePath, &rip) <= 0)
-  {
-    cprintf("sys_exec error: vspaceloadcode failed.\n");
-    return -1;
-  }
+  return exec(filePath, arguments);
+}
 
-  if (vspaceinitstack(&vs, stack) < 0)
-  {
-    cprintf("sys_exec error: vspaceinitstack failed.\n");
+/*
+ * arg0: char * [path to the executable file]
+ * arg1: char * [] [array of strings for arguments]
+ * arg2: int * [descriptors for the child's fds 0, 1 and 2, or 0]
+ *
+ * Like fork() then exec(arg0, arg1) in the child, without copying this
+ * process.  The child's fd i is a duplicate of our fd arg2[i], or is
+ * closed if arg2[i] is -1, and it has no other open files.  If arg2 is
+ * 0, the child has all of our open files instead.
+ *
+ * Returns the child's pid, or -1 on error.
+ *
+ * Errors:
+ * any of sys_exec's errors
+ * arg2 is not 0 and points to an invalid or unmapped address
+ * some arg2[i] is neither -1 nor an open file descriptor
+ */
+int sys_spawn(void)
+{
+  char *path;
+  char **argv;
+  int64_t addr;
+  int kfds[3], *fds = 0;
+
+  if (argstr(0, &path) < 0 || argstr(1, (char **)&argv) < 0) {
+    cprintf("sys_spawn error: invalid path or argument array.\n");
     return -1;
   }
-
-  uint64_t pointers_array[argc]; // Stores the pointers to the strings
-
-  for (int i = argc - 1; i >= 0; i--)
-  {
-    vspacewritetova(&vs, stack - 8 * (strlen(arguments[i]) / 8 + 1), arguments[i], strlen(arguments[i]));
-    pointers_array[i] = stack - 8 * (strlen(arguments[i]) / 8 + 1);
-    stack -= 8 * (strlen(arguments[i]) / 8 + 1);
+  for (int i = 0; argv[i] != NULL; i++) {
+    char *dummyptr;
+    if (fetchstr((uint64_t)argv[i], &dummyptr) < 0) {
+      cprintf("sys_spawn error: string of arg1 point to an invalid or unmapped adress.\n");
+      return -1;
+    }
   }
 
-  char nullptr = '\0';
-  vspacewritetova(&vs, stack - 8, &nullptr, 1);
-  stack -= 8;
-
-  int64_t argv;
-
-  // Write pointers to strings
-  for (int i = argc - 1; i >= 0; i--)
-  {
-    vspacewritetova(&vs, stack - 8, (char *)&pointers_array[i], 4);
-    stack -= 8;
-    // Save the pointer to the first argument
-    if (i == 0)
-    {
-      argv = stack;
+  if (argint64(2, &addr) < 0)
+    return -1;
+  if (addr != 0) {
+    if (copyin(kfds, addr, sizeof(kfds)) < 0) {
+      cprintf("sys_spawn error: arg2 points to an invalid or unmapped address.\n");
+      return -1;
+    }
+    fds = kfds;
+    for (int i = 0; i < 3; i++) {
+      if (fds[i] < -1 || fds[i] >= NOFILE ||
+          (fds[i] >= 0 && myproc()->group->file_array[fds[i]].available == DESC_AVAIL)) {
+        cprintf("sys_spawn error: file descriptor %d is not open.\n", fds[i]);
+        return -1;
+      }
     }
   }
 
-  stack -= 8;
-
-  struct proc *p = myproc();
-  p->tf->rip = rip;
-  p->tf->rsp = stack;
-  p->tf->rdi = argc;
-  p->tf->rsi = argv;
-
-  // Install new vspace and return to run new process
-  struct vspace temp = myproc()->vspace;
-  myproc()->vspace = vs;
-
-  
-  vspaceinstall(myproc());
-  vspacefree(&temp);
-  return 0;
+  return spawn(path, argv, fds);
 }
 
 int sys_pipe(void) {
@@ -736,17 +1554,17 @@ int sys_pipe(void) {
   int fd_write = -1;
   for (int i = 0; i < NOFILE; i++)
   {
-    if (myproc()->file_array[i].available == DESC_AVAIL)
+    if (myproc()->group->file_array[i].available == DESC_AVAIL)
     {
       if (fd_read == -1)
       {
         fd_read = i;
-        myproc()->file_array[i].available = DESC_NOT_AVAIL;
+        myproc()->group->file_array[i].available = DESC_NOT_AVAIL;
       }
       else
       {
         fd_write = i;
-        myproc()->file_array[i].available = DESC_NOT_AVAIL;
+        myproc()->group->file_array[i].available = DESC_NOT_AVAIL;
         break;
       }
     }
@@ -755,12 +1573,12 @@ int sys_pipe(void) {
   // If there were not two file descriptors, return an error
   if (fd_read != -1 && fd_write == -1)
   {
-    myproc()->file_array[fd_read].available = DESC_AVAIL;
+    myproc()->group->file_array[fd_read].available = DESC_AVAIL;
     releasesleep(&global_files.lock);
     return -1;
   }
 
-  struct pipe *pipe = (struct pipe *)kalloc();
+  struct pipe *pipe = pipealloc();
   // Allocate space for kernel buffer
   if (pipe == 0)
   {
@@ -777,7 +1595,7 @@ int sys_pipe(void) {
     if (global_files.files[i].available == FILE_AVAIL && !found_read_file)
     {
       global_files.files[i].available = FILE_NOT_AVAIL;
-      myproc()->file_array[fd_read].fileptr = &global_files.files[i];
+      myproc()->group->file_array[fd_read].fileptr = &global_files.files[i];
 
       // Set file struct parameters
       global_files.files[i].file_type = PIPE;
@@ -790,7 +1608,7 @@ int sys_pipe(void) {
     else if (global_files.files[i].available == FILE_AVAIL)
     {
       global_files.files[i].available = FILE_NOT_AVAIL;
-      myproc()->file_array[fd_write].fileptr = &global_files.files[i];
+      myproc()->group->file_array[fd_write].fileptr = &global_files.files[i];
 
       // Set file struct parameters
       global_files.files[i].file_type = PIPE;
@@ -803,16 +1621,14 @@ int sys_pipe(void) {
   }
 
   // Set pipe parameters
-  pipe->data_count = 0;
-  pipe->read_off = 0;
-  pipe->write_off = 0;
-  initlock(&pipe->lock, "pipe lock");
+  pipe->readers = 1;
+  pipe->writers = 1;
 
   // Error if not enough file structs available
   if (found_read_file && !found_write_file)
   {
     cprintf("sys_open error: too many open files\n");
-    myproc()->file_array[fd_read].fileptr->available = FILE_NOT_AVAIL;
+    myproc()->group->file_array[fd_read].fileptr->available = FILE_NOT_AVAIL;
     releasesleep(&global_files.lock);
     return -1;
   }
@@ -884,3 +1700,106 @@ int sys_unlink(void)
   releasesleep(&global_files.lock);
   return 0;
 }
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: int [offset in the file, a multiple of PGSIZE]
+ * arg2: int [number of bytes to map]
+ * arg3: int [PROT_ bits (see inc/mman.h)]
+ *
+ * Maps arg2 bytes of the file open as arg0, from offset arg1, into the
+ * address space.  Pages are read in from the page cache as they are
+ * first touched; a read-only mapping shares the cached pages with
+ * every other process mapping them.  With PROT_WRITE, writes go to a
+ * private copy of the page and never reach the file.  Touching a page
+ * past the end of the file kills the process.
+ *
+ * Returns the address of the mapping, or -1 on error.
+ *
+ * Error conditions:
+ * arg0 is not a file descriptor open for read on a regular file
+ * arg1 is negative or not page aligned
+ * arg2 is not positive
+ * the process has no free mapping regions or no room for the mapping
+ */
+int sys_mmap(void)
+{
+  int fd, off, len, prot;
+
+  if (argint(0, &fd) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0 || argint(3, &prot) < 0)
+  {
+    cprintf("sys_mmap error: arguments were invalid.\n");
+    return -1;
+  }
+
+  struct file *file = fdget(fd);
+  if (file == 0)
+  {
+    cprintf("sys_mmap error: file descriptor %d is not available.\n", fd);
+    return -1;
+  }
+
+  if (file->file_type != FILE || file->inodep->type != T_FILE ||
+      (file->access_mode != O_RDONLY && file->access_mode != O_RDWR))
+  {
+    cprintf("sys_mmap error: fd %d is not a regular file open for read.\n", fd);
+    fdput(file);
+    return -1;
+  }
+
+  if (off < 0 || len <= 0) {
+    fdput(file);
+    return -1;
+  }
+
+  struct vspace *vs = &myproc()->group->vspace;
+  int r;
+
+  acquiresleep(&vs->lock);
+  r = vspacemmap(vs, file->inodep, off, len, prot);
+  releasesleep(&vs->lock);
+  fdput(file);
+  return r;
+}
+
+/*
+ * arg0: char * [address of a mapping returned by mmap]
+ * arg1: int [its length]
+ *
+ * Removes the whole mapping at arg0.
+ *
+ * Returns 0 on success, -1 if arg0 and arg1 do not name a mapping.
+ */
+int sys_munmap(void)
+{
+  struct vspace *vs = &myproc()->group->vspace;
+  int64_t va;
+  int len, r;
+
+  if (argint64(0, &va) < 0 || argint(1, &len) < 0)
+    return -1;
+
+  acquiresleep(&vs->lock);
+  r = vspacemunmap(vs, va, len);
+  releasesleep(&vs->lock);
+  return r;
+}
+
+/*
+ * arg0: int [1 for raw mode, 0 for cooked]
+ *
+ * Puts the console in raw mode, where reads get each byte as it is
+ * typed, unechoed and unedited, or back in cooked mode, where they
+ * get a line at a time.
+ *
+ * Returns the mode the console was in.
+ */
+int sys_consmode(void)
+{
+  int raw;
+
+  if (argint(0, &raw) < 0)
+    return -1;
+
+  return consolemode(raw);
+}
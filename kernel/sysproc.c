@@ -1,10 +1,12 @@
 #include <cdefs.h>
+#include <clock.h>
 #include <date.h>
 #include <defs.h>
 #include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
 #include <proc.h>
+#include <timer.h>
 #include <x86_64.h>
 
 int sys_crashn(void) {
@@ -31,6 +33,45 @@ void sys_exit(void) {
 
 int sys_wait(void) { return wait(); }
 
+// clone(void (*fn)(void *), void *stack, void *arg): start a thread
+// running fn(arg) on the stack whose top is stack, sharing this
+// process's memory and open files.  fn must call exit().  Returns
+// the thread's pid, or -1.
+int sys_clone(void) {
+  int64_t fn, stack, arg;
+
+  if (argint64(0, &fn) < 0 || argint64(1, &stack) < 0 ||
+      argint64(2, &arg) < 0)
+    return -1;
+  return clone(fn, stack, arg);
+}
+
+// join(): wait for a thread this thread started to exit.  Returns
+// its pid, or -1 if there is none.
+int sys_join(void) { return join(); }
+
+// futex_wait(int *addr, int val): sleep until futex_wake(addr) if
+// *addr is val.  Returns 0 once woken, or -1 if *addr was not val.
+int sys_futex_wait(void) {
+  int64_t addr;
+  int val;
+
+  if (argint64(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+// futex_wake(int *addr, int n): wake up to n futex_wait()ers on
+// addr.  Returns how many were woken.
+int sys_futex_wake(void) {
+  int64_t addr;
+  int n;
+
+  if (argint64(0, &addr) < 0 || argint(1, &n) < 0 || n < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
 int sys_kill(void) {
   int pid;
 
@@ -66,42 +107,132 @@ int sys_sbrk(void) {
     size = 0;
   }
 
-  struct vspace* vs = &myproc()->vspace;
+  struct vspace* vs = &myproc()->group->vspace;
   struct vregion* heapRegion = &vs->regions[VR_HEAP];
+  acquiresleep(&vs->lock);
   uint64_t oldLimit = heapRegion->va_base + heapRegion->size;
 
-  // Add new segment of memory to heap
-  if (vregionaddmap(heapRegion, oldLimit, size, VPI_PRESENT, VPI_WRITABLE) < 0) {
+  // The heap may not grow into the 10 pages the stack can use, or
+  // into the mmap() regions
+  if (oldLimit + size > vs->regions[VR_USTACK].va_base - 10 * PGSIZE ||
+      oldLimit + size > MMAPBASE) {
+    releasesleep(&vs->lock);
     return -1;
   }
 
-  //Increase the heap vregion's size
+  // Only grow the region; trap() allocates each new page the first
+  // time it is touched.  Refuse to promise more pages than are free
+  // in memory and swap together.
+  uint64_t npages = (PGROUNDUP(oldLimit + size) - PGROUNDUP(oldLimit)) / PGSIZE;
+  if (heapRegion->nlazy + npages > free_pages + swapavail()) {
+    releasesleep(&vs->lock);
+    return -1;
+  }
+  heapRegion->nlazy += npages;
   heapRegion->size += size;
-
-  vspaceinvalidate(vs);
-  vspaceinstall(myproc());
+  releasesleep(&vs->lock);
   return oldLimit; 
 }
 
+// shmget(int key, int size): the id of the shared memory segment
+// named key, which is made with size bytes of zeros if there is
+// none.  Key 0 makes a new, private segment, to share with children
+// forked after shmat().  Returns -1 if the segment can't be made.
+int sys_shmget(void) {
+  int key, size;
+
+  if (argint(0, &key) < 0 || argint(1, &size) < 0)
+    return -1;
+  return shmget(key, size);
+}
+
+// shmat(int id): map segment id into this process.  Its pages are
+// shared, not copied, with every process that maps it, forked
+// children included.  Returns the address, or -1.
+int sys_shmat(void) {
+  struct vspace *vs = &myproc()->group->vspace;
+  struct shmseg *seg;
+  int id, va;
+
+  if (argint(0, &id) < 0 || !(seg = shmattach(id)))
+    return -1;
+  acquiresleep(&vs->lock);
+  va = vspaceshmat(vs, seg);
+  releasesleep(&vs->lock);
+  if (va < 0)
+    shmput(seg);
+  return va;
+}
+
+// shmdt(void *addr): unmap the segment shmat() mapped at addr.  The
+// segment goes away once no process has it mapped.
+int sys_shmdt(void) {
+  struct vspace *vs = &myproc()->group->vspace;
+  int64_t va;
+  int r;
+
+  if (argint64(0, &va) < 0)
+    return -1;
+  acquiresleep(&vs->lock);
+  r = vspaceshmdt(vs, va);
+  releasesleep(&vs->lock);
+  return r;
+}
+
+// ring_setup(): map a ring for batching system calls into this
+// process (see inc/uring.h), and start the kernel thread that makes
+// them.  Returns the ring, or -1 if there is one already or no
+// memory.
+int sys_ring_setup(void) { return ringsetup(); }
+
+// ring_enter(int want): hand the calls queued on the ring to the
+// kernel, and wait until want of them have completed.  Returns the
+// number of completions waiting, or -1 if there is no ring.
+int sys_ring_enter(void) {
+  int want;
+
+  if (argint(0, &want) < 0)
+    return -1;
+  return ringenter(want);
+}
+
+// Sleeps on a timer of its own, so each tick wakes only the
+// sleepers whose time is up.
 int sys_sleep(void) {
   int n;
   uint ticks0;
+  struct timer t;
 
   if (argint(0, &n) < 0)
     return -1;
   acquire(&tickslock);
   ticks0 = ticks;
+  t.pprev = 0;
   while (ticks - ticks0 < n) {
     if (myproc()->killed) {
+      timerdel(&t);
       release(&tickslock);
       return -1;
     }
-    sleep(&ticks, &tickslock);
+    if (!t.pprev)
+      timeradd(&t, n - (ticks - ticks0), wakeup, &t);
+    sleep(&t, &tickslock);
   }
+  timerdel(&t);
   release(&tickslock);
   return 0;
 }
 
+// Lower (or, with a negative argument, raise back) the scheduling
+// priority of the calling process; returns its new nice value.
+int sys_nice(void) {
+  int incr;
+
+  if (argint(0, &incr) < 0)
+    return -1;
+  return nice(incr);
+}
+
 // return how many clock tick interrupts have occurred
 // since start.
 int sys_uptime(void) {
@@ -112,3 +243,35 @@ int sys_uptime(void) {
   release(&tickslock);
   return xticks;
 }
+
+// cycles(uint64_t *t): store the time stamp counter in *t, for timing
+// finer than a tick.  The TSC of each CPU counts at the same rate
+// from about the same time, so readings can be compared across CPUs.
+int sys_cycles(void) {
+  int64_t t;
+  uint64_t tsc;
+
+  if (argint64(0, &t) < 0)
+    return -1;
+  tsc = rdtsc();
+  return copyout(t, &tsc, sizeof(tsc));
+}
+
+// clock_gettime(int clk, struct timespec *ts): the time on clock clk,
+// to the nanosecond.  The user library reads the clock page instead,
+// and calls this only if the TSC was not calibrated.
+int sys_clock_gettime(void) {
+  struct timespec ts;
+  int64_t uts;
+  uint64_t ns;
+  int clk;
+
+  if (argint(0, &clk) < 0 || argint64(1, &uts) < 0)
+    return -1;
+  if (clk != CLOCK_MONOTONIC || clockpage->mult == 0)
+    return -1;
+  ns = nsecs();
+  ts.tv_sec = ns / 1000000000;
+  ts.tv_nsec = ns % 1000000000;
+  return copyout(uts, &ts, sizeof(ts));
+}
@@ -0,0 +1,84 @@
+// Kernel timers.
+//
+// Pending timers hang off a wheel of NTWHEEL slots, by expiry modulo
+// NTWHEEL, so starting or stopping one takes constant time and each
+// tick looks only at the timers in that tick's slot.  A timer more
+// than NTWHEEL ticks out stays in its slot through whole turns of the
+// wheel.
+//
+// The wheel is protected by tickslock, which callers of timeradd() and
+// timerdel() must hold.  Callbacks run in the timer interrupt with
+// tickslock held, so they should do little more than wakeup().
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <spinlock.h>
+#include <timer.h>
+
+#define NTWHEEL 256
+
+static struct timer *wheel[NTWHEEL];
+
+// Start t, to call fn(arg) n ticks from now (at least the next tick).
+void timeradd(struct timer *t, uint n, void (*fn)(void *), void *arg) {
+  struct timer **slot;
+
+  if (!holding(&tickslock))
+    panic("timeradd: tickslock");
+  if (t->pprev)
+    panic("timeradd: pending");
+
+  t->expires = ticks + (n > 0 ? n : 1);
+  t->fn = fn;
+  t->arg = arg;
+  slot = &wheel[t->expires % NTWHEEL];
+  if ((t->next = *slot) != 0)
+    t->next->pprev = &t->next;
+  t->pprev = slot;
+  *slot = t;
+}
+
+static void timerunlink(struct timer *t) {
+  if (t->next)
+    t->next->pprev = t->pprev;
+  *t->pprev = t->next;
+  t->pprev = 0;
+}
+
+// Stop t if it has not fired yet.  Returns 1 if it was pending.
+int timerdel(struct timer *t) {
+  if (!holding(&tickslock))
+    panic("timerdel: tickslock");
+  if (!t->pprev)
+    return 0;
+  timerunlink(t);
+  return 1;
+}
+
+// Ticks until the first pending timer fires, or max if that is
+// later.  Caller must hold tickslock.
+uint timernext(uint max) {
+  struct timer *t;
+  uint n;
+
+  for (n = 1; n < max && n <= NTWHEEL; n++)
+    for (t = wheel[(ticks + n) % NTWHEEL]; t; t = t->next)
+      if (t->expires == ticks + n)
+        return n;
+  return max;
+}
+
+// Fire the timers that expire at this tick.  Called by the timer
+// interrupt with tickslock held, just after it advances ticks.
+void timertick(void) {
+  struct timer *t, *next;
+
+  for (t = wheel[ticks % NTWHEEL]; t; t = next) {
+    next = t->next;
+    if (t->expires == ticks) {
+      timerunlink(t);
+      t->fn(t->arg);
+    }
+  }
+}
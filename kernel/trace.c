@@ -0,0 +1,89 @@
+// Kernel event tracing.
+//
+// Each CPU appends events to its own ring of TRACESIZE records, with
+// interrupts off, so recording takes no lock and no atomic operation;
+// once a ring is full the oldest records are overwritten.  trace()
+// drains the rings under tracelock, checking after each copy that
+// the writer has not lapped it, and reports how many records were
+// lost as a TR_LOST record.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <proc.h>
+#include <spinlock.h>
+#include <trace.h>
+#include <x86_64.h>
+
+#define TRACESIZE 512 // records per CPU
+
+static struct tracering {
+  uint64_t head; // records ever written
+  uint64_t tail; // records ever read
+  uint64_t lost; // records overwritten unread, not yet reported
+  struct tracerec rec[TRACESIZE];
+} rings[NCPU];
+
+static struct spinlock tracelock;
+
+int tracing; // is TRACE() recording?
+
+void traceinit(void) {
+  initlock(&tracelock, "trace");
+}
+
+void traceevent(int type, uint64_t a, uint64_t b) {
+  struct tracering *r;
+  struct tracerec *t;
+
+  pushcli();
+  r = &rings[mycpu() - cpus];
+  t = &r->rec[r->head % TRACESIZE];
+  t->tsc = rdtsc();
+  t->type = type;
+  t->cpu = mycpu() - cpus;
+  t->pid = myproc() ? myproc()->pid : 0;
+  t->a = a;
+  t->b = b;
+  // The record must be complete before a reader sees head move
+  __sync_synchronize();
+  r->head++;
+  popcli();
+}
+
+// Move up to n records out of the rings into dst, one CPU after the
+// other.  Returns the number moved.
+int traceread(struct tracerec *dst, int n) {
+  struct tracering *r;
+  uint64_t head;
+  int got;
+
+  got = 0;
+  acquire(&tracelock);
+  for (r = rings; r < rings + ncpu && got < n; r++) {
+    head = *(volatile uint64_t *)&r->head;
+    if (head - r->tail > TRACESIZE) {
+      r->lost += head - TRACESIZE - r->tail;
+      r->tail = head - TRACESIZE;
+    }
+    for (; r->tail < head && got < n; r->tail++) {
+      dst[got] = r->rec[r->tail % TRACESIZE];
+      // Keep it only if the writer did not start over it meanwhile
+      __sync_synchronize();
+      if (*(volatile uint64_t *)&r->head - r->tail >= TRACESIZE)
+        r->lost++;
+      else
+        got++;
+    }
+    if (r->lost > 0 && got < n) {
+      memset(&dst[got], 0, sizeof(dst[got]));
+      dst[got].type = TR_LOST;
+      dst[got].cpu = r - rings;
+      dst[got].a = r->lost;
+      r->lost = 0;
+      got++;
+    }
+  }
+  release(&tracelock);
+  return got;
+}
@@ -5,6 +5,7 @@
 #include <param.h>
 #include <proc.h>
 #include <spinlock.h>
+#include <trace.h>
 #include <trap.h>
 #include <x86_64.h>
 
@@ -15,13 +16,39 @@ struct spinlock tickslock;
 uint ticks;
 
 int num_page_faults = 0;
+int cow_reuses = 0;
+int cow_copies = 0;
+
+// Kernel instructions that may fault on a user address, in
+// usercopy.S, and where each resumes if the fault can't be handled
+struct extable {
+  uint64_t start, end, fixup;
+};
+extern struct extable extable[], extable_end[];
+
+// If tf is a fault in one of those, make it resume at its fixup.
+// Returns 1 if it did.
+static int usercopyfixup(struct trap_frame *tf) {
+  struct extable *e;
+
+  for (e = extable; e < extable_end; e++) {
+    if (tf->rip >= e->start && tf->rip < e->end) {
+      tf->rip = e->fixup;
+      return 1;
+    }
+  }
+  return 0;
+}
 
 void tvinit(void) {
   int i;
 
   for (i = 0; i < 256; i++)
     set_gate_desc(&idt[i], 0, SEG_KCODE << 3, vectors[i], KERNEL_PL);
-  set_gate_desc(&idt[TRAP_SYSCALL], 1, SEG_KCODE << 3, vectors[TRAP_SYSCALL],
+  // An interrupt gate, like the rest, so that nothing nests before
+  // alltraps has swapped in the kernel's %gs base; trap() turns
+  // interrupts back on
+  set_gate_desc(&idt[TRAP_SYSCALL], 0, SEG_KCODE << 3, vectors[TRAP_SYSCALL],
                 USER_PL);
 
   initlock(&tickslock, "time");
@@ -29,10 +56,151 @@ void tvinit(void) {
 
 void idtinit(void) { lidt((void *)idt, sizeof(idt)); }
 
+// Resolves a page fault at addr in the current process' vspace,
+// whose lock the caller holds.  Returns 1 if the access can be retried.
+static int pagefault(struct trap_frame *tf, struct vspace *vs, uint64_t addr) {
+  // Case: Map a page the vspace already has but the page table
+  // does not yet; a forked child builds its page table this way.
+  // A page that was swapped out is read back in first, and the
+  // first touch of a program or mmap() page reads it from its file.
+  if ((tf->err & 1) == 0) {
+    struct vregion* region = va2vregion(vs, addr);
+    struct vpage_info* info = region ? va2vpage_info(region, addr) : 0;
+
+    if (info && info->used && info->present) {
+      vspaceupdate(vs, addr, 1);
+      return 1;
+    }
+    if (info && info->used && swapin(vs, PGROUNDDOWN(addr)) == 0)
+      return 1;
+    if (info && !info->used && region->ip &&
+        vspacefilemap(vs, PGROUNDDOWN(addr), tf->err & 2) == 0)
+      return 1;
+  }
+
+  // Case: Handle possible stack page fault from user
+  // Check whether the address is within the stack base and 10 page frames
+  if (addr < SZ_2G && addr >= SZ_2G - 10 * PGSIZE) {
+
+    // Check whether the valid bit is set to 0, which it should be);
+    if ((tf->err & 1) == 0) {
+
+      struct vregion* stackRegion = &vs->regions[VR_USTACK];
+
+      // Next check that the stack region is not yet exceeding 10 frames.
+      // If so, then panic.
+      uint64_t stackSize = stackRegion->size;
+      if (stackSize / PGSIZE >= 10) {
+        panic("stack size exceeds 10 frames");
+      }
+
+      // Allocate new page of stack for the user
+      if (vregionaddmap(vs, stackRegion, stackRegion->va_base - stackSize - PGSIZE, PGSIZE, VPI_PRESENT, VPI_WRITABLE) < 0) {
+        panic("cannot allocate page for stack");
+       }
+
+      //Increase the stack vregion's size
+      stackRegion->size += PGSIZE;
+      vspaceupdate(vs, stackRegion->va_base - stackRegion->size, 1);
+      return 1;
+    }
+  }
+
+  // Case: Handle the first touch of a heap page that sbrk() reserved
+  if ((tf->err & 1) == 0) {
+    struct vregion* heapRegion = &vs->regions[VR_HEAP];
+
+    if (addr >= heapRegion->va_base && addr < heapRegion->va_base + heapRegion->size) {
+      struct vpage_info* info = va2vpage_info(heapRegion, addr);
+      // A read of a page never written maps the zero page
+      if (info && !info->used && (tf->err & 2) == 0 &&
+          vregionaddzero(vs, heapRegion, PGROUNDDOWN(addr)) == 0) {
+        if (heapRegion->nlazy > 0)
+          heapRegion->nlazy--;
+        return 1;
+      }
+      // A 2 MB page covers a whole untouched, aligned run at once
+      int n;
+      if (info && !info->used && (n = vregionaddhuge(vs, heapRegion, addr)) > 0) {
+        heapRegion->nlazy -= min(heapRegion->nlazy, (uint64_t)n);
+        return 1;
+      }
+      if (info && !info->used &&
+          vregionaddmap(vs, heapRegion, PGROUNDDOWN(addr), PGSIZE, VPI_PRESENT, VPI_WRITABLE) >= 0) {
+        if (heapRegion->nlazy > 0)
+          heapRegion->nlazy--;
+        vspaceupdate(vs, addr, 1);
+        return 1;
+      }
+    }
+  }
+
+  // Case: Handle COW Fork page faults
+  // Check that the last three error bits are all 1
+  if ((tf->err & 0x3) == 0x3) {
+   //cprintf("went to cow\n");
+    // Get the vspace, vregion, and vpage info for the current address
+    struct vregion* region = va2vregion(vs, addr);
+    struct vpage_info* info = region ? va2vpage_info(region, addr) : 0;
+    
+    // if (myproc()->pid == 3) {
+    //   cprintf("pause here");
+    // }
+    // Check if the error is due to COW
+    if (info && info->is_cow == VPI_COW && info->original_perm == VPI_WRITABLE) {
+      struct core_map_entry* cm_entry = pa2page(info->ppn << PT_SHIFT);
+      // Only this vspace can add references to a page it holds,
+      // so a count of 1 can't change under us: reuse the page.
+      if (__atomic_load_n(&cm_entry->ref_count, __ATOMIC_ACQUIRE) > 1) {
+        // If ref_count is greater than 1, then we need to make a copy.
+        // Dropping our reference with kfree() frees the page if the
+        // other sharers let go of it meanwhile.  A copy of the zero
+        // page is just a cleared page.
+        int zero = P2V(info->ppn << PT_SHIFT) == zeropage;
+        char* page_ptr = zero ? kalloc_zeroed() : kalloc();
+        if (!page_ptr) {
+          cprintf("pid %d %s: out of memory for COW copy\n",
+                  myproc()->pid, myproc()->name);
+          myproc()->killed = 1;
+          return 1;
+        }
+        // Making room may have swapped the page out; if so, let
+        // the access fault again to read it back in
+        rmapacquire();
+        if (!info->present) {
+          rmaprelease();
+          kfree(page_ptr);
+          return 1;
+        }
+        if (!zero)
+          memmove(page_ptr, P2V(info->ppn << PT_SHIFT), PGSIZE);
+        rmapdrop(info);
+        kfree(P2V(info->ppn << PT_SHIFT));
+        info->ppn = PGNUM(V2P(page_ptr));
+        rmapadd(vs, info, PGROUNDDOWN(addr));
+        rmaprelease();
+        __sync_fetch_and_add(&cow_copies, 1);
+      } else {
+        __sync_fetch_and_add(&cow_reuses, 1);
+      }
+      // Reset the page table info to proper setting; only this
+      // page's PTE and TLB entry change
+      info->writable = VPI_WRITABLE;
+      info->is_cow = 0;
+      vspaceupdate(vs, addr, 1);
+      return 1;
+    }
+  }
+  return 0;
+}
+
 void trap(struct trap_frame *tf) {
+  struct cpu *c;
   uint64_t addr;
+  int tick;
 
   if (tf->trapno == TRAP_SYSCALL) {
+    sti();
     if (myproc()->killed)
       exit();
     myproc()->tf = tf;
@@ -42,12 +210,24 @@ void trap(struct trap_frame *tf) {
     return;
   }
 
+  tick = 0;
   switch (tf->trapno) {
   case TRAP_IRQ0 + IRQ_TIMER:
-    if (cpunum() == 0) {
+    // While profiling the timer goes off profrate times a tick
+    c = mycpu();
+    if (profrate > 0)
+      profsample(tf);
+    if (c->tickdiv != max(profrate, 1))
+      lapicrate(max(profrate, 1));
+    if (++c->subtick >= c->tickdiv) {
+      c->subtick = 0;
+      tick = 1;
+    }
+    // An idle boot CPU counts the ticks it slept through itself
+    if (tick && cpunum() == 0 && !c->tickless) {
       acquire(&tickslock);
       ticks++;
-      wakeup(&ticks);
+      timertick();
       release(&tickslock);
     }
     lapiceoi();
@@ -56,6 +236,14 @@ void trap(struct trap_frame *tf) {
     ideintr();
     lapiceoi();
     break;
+  case TRAP_IRQ0 + IRQ_WAKE:
+    // Work was queued for us; scheduler() will find it
+    lapiceoi();
+    break;
+  case TRAP_IRQ0 + IRQ_TLB:
+    vspacetlbintr();
+    lapiceoi();
+    break;
   case TRAP_IRQ0 + IRQ_IDE + 1:
     // Bochs generates spurious IDE1 interrupts.
     break;
@@ -74,74 +262,35 @@ void trap(struct trap_frame *tf) {
     break;
 
   default:
+    if (virtioirq && tf->trapno == TRAP_IRQ0 + virtioirq) {
+      virtiointr();
+      lapiceoi();
+      break;
+    }
     addr = rcr2();
     
     if (tf->trapno == TRAP_PF) {
       num_page_faults += 1;
+      TRACE(TR_PGFAULT, addr, tf->err);
 
-      // Case: Handle possible stack page fault from user
-      // Check whether the address is within the stack base and 10 page frames
-      if (addr < SZ_2G && addr >= SZ_2G - 10 * PGSIZE) {
-
-        // Check whether the valid bit is set to 0, which it should be);
-        if ((tf->err & 1) == 0) {
-
-          struct vspace* vs = &myproc()->vspace;
-          struct vregion* stackRegion = &vs->regions[VR_USTACK];
-
-          // Next check that the stack region is not yet exceeding 10 frames.
-          // If so, then panic.
-          uint64_t stackSize = stackRegion->size;
-          if (stackSize / PGSIZE >= 10) {
-            panic("stack size exceeds 10 frames");
-          }
-
-          // Allocate new page of stack for the user
-          if (vregionaddmap(stackRegion, stackRegion->va_base - stackSize - PGSIZE, PGSIZE, VPI_PRESENT, VPI_WRITABLE) < 0) {
-            panic("cannot allocate page for stack");
-           }
+      // Threads sharing the vspace fault on it one at a time
+      if (myproc()) {
+        struct vspace *vs = &myproc()->group->vspace;
+        int handled;
 
-          //Increase the stack vregion's size
-          stackRegion->size += PGSIZE;
-          vspaceinvalidate(vs);
-          vspaceinstall(myproc());
+        acquiresleep(&vs->lock);
+        handled = pagefault(tf, vs, addr);
+        releasesleep(&vs->lock);
+        if (handled)
           break;
-        }
-      }
-
-      // Case: Handle COW Fork page faults
-      // Check that the last three error bits are all 1
-      if ((tf->err & 0x3) == 0x3) {
-       //cprintf("went to cow\n");
-        // Get the vspace, vregion, and vpage info for the current address
-        struct vspace* vs = &myproc()->vspace;
-        struct vregion* region = va2vregion(vs, addr);
-        struct vpage_info* info = va2vpage_info(region, addr);   
-        
-        // if (myproc()->pid == 3) {
-        //   cprintf("pause here");
-        // }
-        // Check if the error is due to COW
-        if (info->is_cow == VPI_COW && info->original_perm == VPI_WRITABLE) {
-          struct core_map_entry* cm_entry = pa2page(info->ppn << PT_SHIFT);
-          lock_memory();
-          if (cm_entry->ref_count > 1) {
-            // If ref_count is greater than 1, then we need to make a copy
-            char* page_ptr = kalloc();
-            memmove(page_ptr, P2V(info->ppn << PT_SHIFT), PGSIZE);
-            info->ppn = PGNUM(V2P(page_ptr));
-            cm_entry->ref_count--;
-          }
-          unlock_memory();
-          // Reset the page table info to proper setting
-          info->writable = VPI_WRITABLE;
-          vspaceinvalidate(vs);
-          vspaceinstall(myproc());
-          break;
-        }
       }
     }
 
+    // A copy to or from user memory touched an address with nothing
+    // there: the copy fails instead
+    if ((tf->cs & 3) == 0 && tf->trapno == TRAP_PF && usercopyfixup(tf))
+      break;
+
     // Check for kernel misbehavior
     if (myproc() == 0 || (tf->cs & 3) == 0) {
         // In kernel, it must be our mistake.
@@ -164,10 +313,9 @@ void trap(struct trap_frame *tf) {
   if (myproc() && myproc()->killed && (tf->cs & 3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick once its slice is up.
   // If interrupts were on while locks held, would need to check nlock.
-  if (myproc() && myproc()->state == RUNNING &&
-      tf->trapno == TRAP_IRQ0 + IRQ_TIMER)
+  if (myproc() && myproc()->state == RUNNING && tick && schedtick())
     yield();
 
   // Check if the process has been killed since we yielded
@@ -14,13 +14,15 @@
 
 #define COM1 0x3f8
 
-static int uart; // is there a uart?
+static int uart;     // is there a uart?
+static int uartfifo; // bytes the transmitter takes at a time
 
 void uartinit(void) {
   char *p;
 
-  // Turn off the FIFO
-  outb(COM1 + 2, 0);
+  // Turn on and clear the FIFOs, interrupting once 8 bytes have been
+  // received, or when fewer have waited a few byte times
+  outb(COM1 + 2, 0x87);
 
   // 9600 baud, 8 data bits, 1 stop bit, parity off.
   outb(COM1 + 3, 0x80); // Unlock divisor
@@ -36,8 +38,8 @@ void uartinit(void) {
   uart = 1;
 
   // Acknowledge pre-existing interrupt conditions;
-  // enable interrupts.
-  inb(COM1 + 2);
+  // enable interrupts.  An 8250 has no FIFO, a 16550A one of 16.
+  uartfifo = (inb(COM1 + 2) & 0xC0) == 0xC0 ? 16 : 1;
   inb(COM1 + 0);
   picenable(IRQ_COM1);
   ioapicenable(IRQ_COM1, 0);
@@ -57,6 +59,27 @@ void uartputc(int c) {
   outb(COM1 + 0, c);
 }
 
+// Send as much of the n bytes at s as the transmitter has room for,
+// without waiting.  Returns the number sent.
+int uartwrite(char *s, int n) {
+  int i;
+
+  if (!uart)
+    return n;
+  if (!(inb(COM1 + 5) & 0x20))
+    return 0;
+  n = min(n, uartfifo);
+  for (i = 0; i < n; i++)
+    outb(COM1 + 0, s[i]);
+  return n;
+}
+
+// Ask for an interrupt when the transmitter has room, or stop asking.
+void uarttxintr(int on) {
+  if (uart)
+    outb(COM1 + 1, on ? 0x03 : 0x01);
+}
+
 static int uartgetc(void) {
   if (!uart)
     return -1;
@@ -65,4 +88,7 @@ static int uartgetc(void) {
   return inb(COM1 + 0);
 }
 
-void uartintr(void) { consoleintr(uartgetc); }
+void uartintr(void) {
+  consoleintr(uartgetc);
+  consolestart();
+}
@@ -0,0 +1,165 @@
+// Rings of system calls, for ring_setup() and ring_enter().
+//
+// The ring is a private shared memory segment, mapped into the
+// process and read by the kernel through its own mapping of the
+// page.  Each ring has a ring thread, a kernel thread of the process
+// (see kthread_clone()), that takes the calls queued on it and makes
+// them as the process would, through syscall() with its own trap
+// frame filled from the entry.  So the process can compute, or queue
+// more, while its I/O is done, and a batch of calls costs it one
+// trap.
+//
+// r->lock guards kicked, so a ring_enter() while the thread is busy
+// is not lost, and the wait for completions.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <spinlock.h>
+#include <syscall.h>
+#include <trap.h>
+#include <uring.h>
+#include <vspace.h>
+
+struct uring {
+  struct spinlock lock;
+  struct ring *ring;     // the kernel's mapping of it
+  struct shmseg *seg;    // its segment, which we hold an attachment to
+  int kicked;            // ring_enter() since the thread last looked
+};
+
+static struct kmem_cache *uringcache;
+
+void uringinit(void) {
+  uringcache = kmem_cache_create("uring", sizeof(struct uring), 0);
+}
+
+// Make the call e, as the process would, and return its result.
+static int ringcall(struct ringsqe *e) {
+  struct trap_frame *tf = myproc()->tf;
+
+  if (!RINGOK(e->op))
+    return -1;
+  tf->rax = e->op;
+  tf->rdi = e->args[0];
+  tf->rsi = e->args[1];
+  tf->rdx = e->args[2];
+  tf->r10 = e->args[3];
+  syscall();
+  return tf->rax;
+}
+
+// The ring thread: make the calls queued on r until the process
+// exits.  The completion queue must have room first; if it is full,
+// the rest waits for the next ring_enter().
+static void ringthread(void *arg) {
+  struct uring *r = arg;
+  struct ring *ring = r->ring;
+  struct proc *p = myproc();
+  struct ringsqe e;
+  struct ringcqe *c;
+  uint head;
+
+  for (;;) {
+    acquire(&r->lock);
+    while (!r->kicked && !p->killed)
+      sleep(r, &r->lock);
+    r->kicked = 0;
+    release(&r->lock);
+
+    while (!p->killed) {
+      head = ring->sqhead;
+      if (head == __atomic_load_n(&ring->sqtail, __ATOMIC_ACQUIRE) ||
+          ring->cqtail - __atomic_load_n(&ring->cqhead, __ATOMIC_ACQUIRE) >= RINGN)
+        break;
+      // Free the entry before the call, which may take a while
+      e = ring->sq[head % RINGN];
+      __atomic_store_n(&ring->sqhead, head + 1, __ATOMIC_RELEASE);
+
+      c = &ring->cq[ring->cqtail % RINGN];
+      c->data = e.data;
+      c->res = ringcall(&e);
+      __atomic_store_n(&ring->cqtail, ring->cqtail + 1, __ATOMIC_RELEASE);
+
+      acquire(&r->lock);
+      wakeup(&r->ring);
+      release(&r->lock);
+    }
+    if (p->killed)
+      exit();
+  }
+}
+
+// Map a new ring into the calling process and start its thread.
+// A process has one ring.  Returns the ring's address, or -1.
+int ringsetup(void) {
+  struct proc *g = myproc()->group;
+  struct vspace *vs = &g->vspace;
+  struct shmseg *seg;
+  struct uring *r;
+  int va;
+
+  if ((seg = shmattach(shmget(0, sizeof(struct ring)))) == 0)
+    return -1;
+  // The vspace lock keeps other threads from setting up one too
+  acquiresleep(&vs->lock);
+  if (g->ring || (va = vspaceshmat(vs, seg)) < 0) {
+    releasesleep(&vs->lock);
+    shmput(seg);
+    return -1;
+  }
+  if ((r = kmem_cache_alloc(uringcache)) == 0) {
+    vspaceshmdt(vs, va);
+    releasesleep(&vs->lock);
+    return -1;
+  }
+  initlock(&r->lock, "uring");
+  r->ring = (struct ring *)seg->pages[0];
+  r->seg = seg;
+  r->kicked = 0;
+  shmdup(seg);
+  if (kthread_clone(ringthread, r, "ring") < 0) {
+    ringfree(r);
+    vspaceshmdt(vs, va);
+    releasesleep(&vs->lock);
+    return -1;
+  }
+  g->ring = r;
+  releasesleep(&vs->lock);
+  return va;
+}
+
+// Hand the calls queued on the process's ring to its thread, and
+// wait until at least want of them have completed, or for none if
+// want is 0.  Returns the number of completions there are to take, or
+// -1 if the process has no ring.
+int ringenter(int want) {
+  struct proc *p = myproc();
+  struct uring *r = p->group->ring;
+  struct ring *ring;
+  int n;
+
+  if (!r)
+    return -1;
+  ring = r->ring;
+  want = max(0, min(want, RINGN));
+  acquire(&r->lock);
+  r->kicked = 1;
+  wakeup(r);
+  while ((n = __atomic_load_n(&ring->cqtail, __ATOMIC_ACQUIRE) -
+              __atomic_load_n(&ring->cqhead, __ATOMIC_ACQUIRE)) < want &&
+         !p->killed)
+    sleep(&r->ring, &r->lock);
+  release(&r->lock);
+  return n;
+}
+
+// Free ring r, once its thread is gone.  Its mapping goes with the
+// process's vspace.
+void ringfree(struct uring *r) {
+  shmput(r->seg);
+  kmem_cache_free(uringcache, r);
+}
@@ -0,0 +1,373 @@
+// virtio-blk disk driver, for the legacy PCI interface QEMU offers.
+//
+// Requests go to the device through a virtqueue, a ring of
+// descriptors naming physical memory that the device reads or fills
+// by DMA, so the CPU moves none of the data.  A request carries a run
+// of adjacent blocks, one descriptor per buf (scatter-gather), between
+// a header and a status byte.  As many requests are in flight as the
+// queue has descriptors for; the rest wait on a list in block order.
+// With VIRTIO_RING_F_EVENT_IDX the device is asked to interrupt only
+// once everything in flight has completed, not once per request.
+//
+// ide.c hands disk 1's requests here when virtioinit() finds a
+// device, with the same buf flags and B_QUEUED/B_ASYNC protocol.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <fs.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <param.h>
+#include <proc.h>
+#include <sleeplock.h>
+#include <spinlock.h>
+#include <trace.h>
+#include <trap.h>
+#include <x86_64.h>
+
+#include <buf.h>
+
+#define PCI_CONFADDR 0xcf8
+#define PCI_CONFDATA 0xcfc
+#define PCI_ID 0x00
+#define PCI_COMMAND 0x04
+#define PCI_BAR0 0x10
+#define PCI_INTLINE 0x3c
+#define PCI_CMD_IO 0x1
+#define PCI_CMD_MASTER 0x4
+
+#define VIRTIO_VENDOR 0x1af4
+#define VIRTIO_BLK_LEGACY 0x1001
+
+// Legacy registers in BAR 0's I/O space, without MSI-X
+#define VIRTIO_HOSTFEAT 0x00
+#define VIRTIO_GUESTFEAT 0x04
+#define VIRTIO_QPFN 0x08
+#define VIRTIO_QSIZE 0x0c
+#define VIRTIO_QSEL 0x0e
+#define VIRTIO_QNOTIFY 0x10
+#define VIRTIO_STATUS 0x12
+#define VIRTIO_ISR 0x13
+#define VIRTIO_BLK_CAPACITY 0x14 // 64 bits, in sectors
+
+#define VIRTIO_ACK 1
+#define VIRTIO_DRIVER 2
+#define VIRTIO_DRIVER_OK 4
+
+#define VIRTIO_F_EVENT_IDX (1 << 29)
+
+#define VDESC_NEXT 1
+#define VDESC_WRITE 2 // the device writes this buffer
+
+#define VIRTIO_BLK_T_IN 0
+#define VIRTIO_BLK_T_OUT 1
+
+#define SECTOR_SIZE 512
+#define VQMAX 1024  // largest queue handled
+#define VMAXSEG 64  // most bufs in one request
+#define VALIGN 4096 // the legacy used ring starts on this boundary
+
+struct vdesc {
+  uint64_t addr;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+
+struct vavail {
+  ushort flags;
+  ushort idx;
+  ushort ring[]; // then used_event
+};
+
+struct vused {
+  ushort flags;
+  ushort idx;
+  struct {
+    uint id;
+    uint len;
+  } ring[]; // then avail_event
+};
+
+// A request, found by its first descriptor.  The device reads the
+// header and writes the status.
+struct vreq {
+  uint type;
+  uint reserved;
+  uint64_t sector;
+  uchar status;
+  struct buf *b; // first buf; the others follow on qnext
+  int n;         // bufs in the request
+};
+
+static struct {
+  struct spinlock lock;
+  int iobase;
+  int qsize;
+  int eventidx;           // VIRTIO_F_EVENT_IDX was negotiated
+  struct vdesc *desc;
+  struct vavail *avail;
+  volatile struct vused *used;
+  int freedesc;           // free descriptors, chained through next
+  int nfree;
+  ushort lastused;        // used->idx last seen
+  int inflight;           // requests the device has
+  int plugged;            // virtioplug() calls not yet undone
+  struct buf *pending;    // bufs waiting for descriptors, by blockno
+  uint64_t nsector;
+} vq;
+
+static struct vreq vreqs[VQMAX];
+
+int virtioirq; // for trap(); 0 if there is no device
+
+static uint pciread(int dev, int off) {
+  outl(PCI_CONFADDR, 0x80000000 | (dev << 11) | (off & 0xfc));
+  return inl(PCI_CONFDATA);
+}
+
+static void pciwrite(int dev, int off, uint v) {
+  outl(PCI_CONFADDR, 0x80000000 | (dev << 11) | (off & 0xfc));
+  outl(PCI_CONFDATA, v);
+}
+
+// Look for a virtio-blk device on PCI bus 0 and set it up.
+// Returns 1 if there is one.
+int virtioinit(void) {
+  int dev, i, order, size;
+  uint feat;
+  char *ring;
+
+  for (dev = 0; dev < 32; dev++)
+    if (pciread(dev, PCI_ID) == (VIRTIO_BLK_LEGACY << 16 | VIRTIO_VENDOR))
+      break;
+  if (dev == 32)
+    return 0;
+
+  pciwrite(dev, PCI_COMMAND,
+           pciread(dev, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  vq.iobase = pciread(dev, PCI_BAR0) & ~3;
+  virtioirq = pciread(dev, PCI_INTLINE) & 0xff;
+
+  outb(vq.iobase + VIRTIO_STATUS, 0); // reset
+  outb(vq.iobase + VIRTIO_STATUS, VIRTIO_ACK | VIRTIO_DRIVER);
+  feat = inl(vq.iobase + VIRTIO_HOSTFEAT) & VIRTIO_F_EVENT_IDX;
+  outl(vq.iobase + VIRTIO_GUESTFEAT, feat);
+  vq.eventidx = feat != 0;
+
+  // Queue 0, at the size the device has it
+  outw(vq.iobase + VIRTIO_QSEL, 0);
+  vq.qsize = inw(vq.iobase + VIRTIO_QSIZE);
+  if (vq.qsize == 0 || vq.qsize > VQMAX) {
+    cprintf("virtio-blk: cannot use a queue of %d\n", vq.qsize);
+    outb(vq.iobase + VIRTIO_STATUS, 0);
+    return 0;
+  }
+  size = PGROUNDUP(sizeof(struct vdesc) * vq.qsize +
+                   sizeof(ushort) * (3 + vq.qsize)) +
+         PGROUNDUP(sizeof(ushort) * 3 + 8 * vq.qsize);
+  for (order = 0; (PGSIZE << order) < size; order++)
+    ;
+  if ((ring = kalloc_order(order)) == 0)
+    panic("virtioinit: no memory for the queue");
+  memset(ring, 0, PGSIZE << order);
+  vq.desc = (struct vdesc *)ring;
+  vq.avail = (struct vavail *)(ring + sizeof(struct vdesc) * vq.qsize);
+  vq.used = (struct vused *)(ring + PGROUNDUP(sizeof(struct vdesc) * vq.qsize +
+                                              sizeof(ushort) * (3 + vq.qsize)));
+  for (i = 0; i < vq.qsize; i++)
+    vq.desc[i].next = i + 1;
+  vq.freedesc = 0;
+  vq.nfree = vq.qsize;
+  outl(vq.iobase + VIRTIO_QPFN, V2P(ring) / VALIGN);
+
+  vq.nsector = inl(vq.iobase + VIRTIO_BLK_CAPACITY) |
+               (uint64_t)inl(vq.iobase + VIRTIO_BLK_CAPACITY + 4) << 32;
+  initlock(&vq.lock, "virtio");
+  picenable(virtioirq);
+  ioapicenable(virtioirq, ncpu - 1);
+  outb(vq.iobase + VIRTIO_STATUS, VIRTIO_ACK | VIRTIO_DRIVER | VIRTIO_DRIVER_OK);
+  cprintf("virtio-blk: %d blocks, queue %d, irq %d%s\n",
+          (int)(vq.nsector / (BSIZE / SECTOR_SIZE)), vq.qsize, virtioirq,
+          vq.eventidx ? ", event index" : "");
+  return 1;
+}
+
+// Where the device's used ring interrupt threshold lives
+static volatile ushort *usedevent(void) {
+  return &vq.avail->ring[vq.qsize];
+}
+
+// Ask for an interrupt only when the last request in flight is done.
+// Caller must hold vq.lock.
+static void vqevent(void) {
+  if (vq.eventidx && vq.inflight > 0)
+    *usedevent() = vq.lastused + vq.inflight - 1;
+}
+
+static int vqalloc(void) {
+  int d = vq.freedesc;
+
+  vq.freedesc = vq.desc[d].next;
+  vq.nfree--;
+  return d;
+}
+
+// Hand the device requests for the pending bufs, a run of adjacent
+// blocks going the same way at a time, for as long as there are
+// descriptors.  Caller must hold vq.lock.
+static void vqstart(void) {
+  struct buf *b, *nb;
+  struct vreq *r;
+  int head, d, n, added;
+
+  added = 0;
+  while ((b = vq.pending) != 0 && vq.nfree >= 3) {
+    for (n = 1, nb = b; n < VMAXSEG && n + 2 < vq.nfree; n++, nb = nb->qnext)
+      if (nb->qnext == 0 || nb->qnext->blockno != nb->blockno + 1 ||
+          (nb->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+        break;
+    vq.pending = nb->qnext;
+    nb->qnext = 0;
+
+    head = vqalloc();
+    r = &vreqs[head];
+    r->type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+    r->reserved = 0;
+    r->sector = (uint64_t)b->blockno * (BSIZE / SECTOR_SIZE);
+    r->status = 0xff;
+    r->b = b;
+    r->n = n;
+    vq.desc[head].addr = V2P(r);
+    vq.desc[head].len = 16;
+    vq.desc[head].flags = VDESC_NEXT;
+    d = head;
+    for (nb = b; nb; nb = nb->qnext) {
+      if (nb->blockno >= FSSIZE)
+        panic("incorrect blockno");
+      vq.desc[d].next = vqalloc();
+      d = vq.desc[d].next;
+      vq.desc[d].addr = V2P(nb->data);
+      vq.desc[d].len = BSIZE;
+      vq.desc[d].flags = VDESC_NEXT | ((b->flags & B_DIRTY) ? 0 : VDESC_WRITE);
+    }
+    vq.desc[d].next = vqalloc();
+    d = vq.desc[d].next;
+    vq.desc[d].addr = V2P(&r->status);
+    vq.desc[d].len = 1;
+    vq.desc[d].flags = VDESC_WRITE;
+
+    vq.avail->ring[(vq.avail->idx + added) % vq.qsize] = head;
+    added++;
+    vq.inflight++;
+    disk_requests++;
+    if (b->flags & B_DIRTY)
+      disk_writes += n;
+    else
+      disk_reads += n;
+  }
+  if (added == 0)
+    return;
+
+  vqevent();
+  __sync_synchronize(); // descriptors before the index
+  vq.avail->idx += added;
+  __sync_synchronize(); // index before the notify
+  outw(vq.iobase + VIRTIO_QNOTIFY, 0);
+}
+
+// Queue b in block order among the bufs not yet started.
+// Caller must hold vq.lock.
+static void vqinsert(struct buf *b) {
+  struct buf **pp;
+
+  for (pp = &vq.pending; *pp && (*pp)->blockno <= b->blockno; pp = &(*pp)->qnext)
+    ;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Queue b, which idesubmit() has checked, and return without waiting.
+void virtiosubmit(struct buf *b) {
+  acquire(&vq.lock);
+  TRACE(TR_DISKSUBMIT, b->blockno, (b->flags & B_DIRTY) != 0);
+  b->flags |= B_QUEUED;
+  vqinsert(b);
+  if (!vq.plugged)
+    vqstart();
+  release(&vq.lock);
+}
+
+// Wait for a request queued by virtiosubmit() to finish.
+void virtiowait(struct buf *b) {
+  acquire(&vq.lock);
+  while (b->flags & B_QUEUED)
+    sleep(b, &vq.lock);
+  release(&vq.lock);
+}
+
+void virtioplug(void) {
+  acquire(&vq.lock);
+  vq.plugged++;
+  release(&vq.lock);
+}
+
+void virtiounplug(void) {
+  acquire(&vq.lock);
+  if (--vq.plugged == 0)
+    vqstart();
+  release(&vq.lock);
+}
+
+// Interrupt handler: finish every request the device has completed.
+void virtiointr(void) {
+  struct buf *b, *next, *async, **tail;
+  struct vreq *r;
+  int d, head;
+
+  inb(vq.iobase + VIRTIO_ISR); // acknowledge, before looking at the ring
+  acquire(&vq.lock);
+  async = 0;
+  tail = &async;
+  while (vq.lastused != vq.used->idx) {
+    __sync_synchronize();
+    head = vq.used->ring[vq.lastused % vq.qsize].id;
+    vq.lastused++;
+    vq.inflight--;
+    r = &vreqs[head];
+    if (r->status != 0)
+      panic("virtio-blk: I/O error");
+
+    for (b = r->b; b; b = next) {
+      next = b->qnext;
+      TRACE(TR_DISKDONE, b->blockno, (b->flags & B_DIRTY) != 0);
+      b->flags |= B_VALID;
+      b->flags &= ~(B_DIRTY | B_QUEUED);
+      if (b->flags & B_ASYNC) {
+        b->flags &= ~B_ASYNC;
+        *tail = b;
+        tail = &b->qnext;
+      } else {
+        wakeup(b);
+      }
+    }
+
+    // Give back the request's descriptors.
+    for (d = head; vq.desc[d].flags & VDESC_NEXT; d = vq.desc[d].next)
+      vq.nfree++;
+    vq.desc[d].next = vq.freedesc;
+    vq.freedesc = head;
+    vq.nfree++;
+  }
+  *tail = 0;
+  if (!vq.plugged)
+    vqstart();
+  vqevent();
+  release(&vq.lock);
+
+  // Drop the submitter's reference on behalf of asynchronous requests.
+  while ((b = async) != 0) {
+    async = b->qnext;
+    brelse(b);
+  }
+}
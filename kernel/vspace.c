@@ -1,7 +1,10 @@
 #include <cdefs.h>
+#include <cpuid.h>
 #include <defs.h>
 #include <elf.h>
+#include <fs.h>
 #include <memlayout.h>
+#include <mman.h>
 #include <vspace.h>
 #include <proc.h>
 #include <x86_64.h>
@@ -36,6 +39,16 @@ x86perms(struct vpage_info *vpi)
 
 extern pml4e_t *kpml4;  // kernel page table
 
+// One page of zeros, mapped read-only and copy-on-write wherever a
+// page a process owns is read before it is ever written.  It holds a
+// reference of its own, so it is never freed.
+char *zeropage;
+
+int havepge, havepcid; // set by cpuid_print()
+static int npcid;      // PCIDs in use, 0 if the CPU has none
+
+static uint64_t nexttlbid;
+
 // allocates space for the kernel page table and populates
 // it with the kernel's virtual address mapping after the
 // virtual address space has been initialized by the kernel
@@ -45,6 +58,8 @@ vspacebootinit(void)
   kpml4 = setupkvm(); // sets up the kernel's page table
   vspaceinstallkern();  // installs the kernel mapping in the table
   seginit();   // segment table
+  if (!(zeropage = kalloc_zeroed()))
+    panic("vspacebootinit: no zero page");
 }
 
 // initializes a given vspace struct, by creating the page table
@@ -58,6 +73,11 @@ vspaceinit(struct vspace *vs)
   // or maybe just do that on demand
   if (!(vs->pgtbl = setupkvm()))
     return -1;
+  vs->pinned = 0;
+  initsleeplock(&vs->lock, "vspace");
+  vs->tlbid = __sync_add_and_fetch(&nexttlbid, 1);
+  vs->tlbgen = 0;
+  vs->nseg = 0;
 
   for (vr = vs->regions; vr < &vs->regions[NREGIONS]; vr++) {
     memset(vr, 0, sizeof(struct vregion));
@@ -74,7 +94,7 @@ vspaceinit(struct vspace *vs)
 // permissions. If size spans more than one page, multiple physical pages are mapped into the
 // page table
 int
-vregionaddmap(struct vregion *vr, uint64_t from_va, uint64_t sz, short present, short writable)
+vregionaddmap(struct vspace *vs, struct vregion *vr, uint64_t from_va, uint64_t sz, short present, short writable)
 {
   char *mem;
   uint64_t a;
@@ -89,22 +109,33 @@ vregionaddmap(struct vregion *vr, uint64_t from_va, uint64_t sz, short present,
     if (!(vpi = va2vpage_info(vr, a)))
       goto addmap_failure;
 
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if (!mem)
       goto addmap_failure;
-    memset(mem, 0, PGSIZE);
 
     vpi->used = 1;
     vpi->present = present;
     vpi->writable = writable;
+    vpi->is_cow = 0;
+    vpi->original_perm = writable;
     vpi->ppn = PGNUM(V2P(mem));
+
+    // Without a reverse mapping the page just can't be swapped out
+    rmapacquire();
+    rmapadd(vs, vpi, a);
+    rmaprelease();
   }
   return sz;
 
 addmap_failure:
   for (a -= PGSIZE; a >= PGROUNDUP(from_va); a -= PGSIZE) {
     assertm(vpi = va2vpage_info(vr, a), "vpi info missing");
-    kfree(P2V(vpi->ppn << PT_SHIFT));
+    rmapacquire();
+    if (rmapdrop(vpi))
+      kfree(P2V(vpi->ppn << PT_SHIFT));
+    else
+      swapfree(vpi->ppn);
+    rmaprelease();
 
     vpi->used = 0;
     vpi->present = 0;
@@ -115,16 +146,87 @@ addmap_failure:
 }
 
 
+// Maps the unused page at va of region vr to the zero page, for a
+// read of memory that has never been written.  The first write
+// copies it through the copy-on-write path in trap().  Returns 0 on
+// success, -1 if va has no page info.
+int
+vregionaddzero(struct vspace *vs, struct vregion *vr, uint64_t va)
+{
+  struct vpage_info *vpi;
+
+  if (!(vpi = va2vpage_info(vr, va)) || vpi->used)
+    return -1;
+  increment_ref(pa2page(V2P(zeropage)));
+  vpi->used = 1;
+  vpi->present = VPI_PRESENT;
+  vpi->writable = 0;
+  vpi->is_cow = VPI_COW;
+  vpi->original_perm = VPI_WRITABLE;
+  vpi->ppn = PGNUM(V2P(zeropage));
+  return vspaceupdate(vs, va, 1);
+}
+
+// Maps the 2 MB-aligned run of HUGEPAGES pages of region vr that
+// holds va with one 2 MB page, if the whole run is in the region and
+// none of it is in use yet, and a free block is at hand.  Each 4 KB
+// page keeps its own vpage_info, so the page table entry is split
+// back into 4 KB ones (see walkpml4()) as soon as one page needs to
+// differ, say for copy-on-write or to be swapped out.  Returns the
+// number of pages mapped, or -1 if a huge page can't be used.
+int
+vregionaddhuge(struct vspace *vs, struct vregion *vr, uint64_t va)
+{
+  struct vpage_info *vpi;
+  uint64_t base, a;
+  pde_t *pde;
+  char *mem;
+  int i;
+
+  base = va & ~(PD_SIZE - 1);
+  if (vr->dir != VRDIR_UP || base < vr->va_base || base + PD_SIZE > vr->va_base + vr->size)
+    return -1;
+  for (a = base; a < base + PD_SIZE; a += PGSIZE)
+    if (!(vpi = va2vpage_info(vr, a)) || vpi->used)
+      return -1;
+  if (!(pde = walkpgdir(vs->pgtbl, (void *)base, 1)))
+    return -1;
+  if (!(mem = kalloc_order_try(HUGEORDER)))
+    return -1;
+  memset(mem, 0, PD_SIZE);
+
+  rmapacquire();
+  for (i = 0; i < HUGEPAGES; i++) {
+    vpi = va2vpage_info(vr, base + i * PGSIZE);
+    vpi->used = 1;
+    vpi->present = VPI_PRESENT;
+    vpi->writable = VPI_WRITABLE;
+    vpi->is_cow = 0;
+    vpi->original_perm = VPI_WRITABLE;
+    vpi->ppn = PGNUM(V2P(mem)) + i;
+    rmapadd(vs, vpi, base + i * PGSIZE);
+    mark_user_mem(V2P(mem) + i * PGSIZE, base + i * PGSIZE);
+  }
+  rmaprelease();
+
+  // The run had no pages, so a page table for it maps nothing
+  if (*pde & PTE_P)
+    kfree(P2V(PTE_ADDR(*pde)));
+  *pde = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+  vspaceflush(vs, base);
+  return HUGEPAGES;
+}
+
 // Adds a mapping into the vregion at va of size sz with the given permissions and then
 // copies the data present in data to these addresses
 static int
-vradddata(struct vregion *r, uint64_t va, char *data, int sz, short present, short writable)
+vradddata(struct vspace *vs, struct vregion *r, uint64_t va, char *data, int sz, short present, short writable)
 {
   int ret;
   uint64_t i, n;
   struct vpage_info *vpi;
 
-  if ((ret = vregionaddmap(r, va, sz, present, writable)) < 0)
+  if ((ret = vregionaddmap(vs, r, va, sz, present, writable)) < 0)
     return ret;
 
   for (i = 0; i < sz; i += PGSIZE) {
@@ -136,25 +238,6 @@ vradddata(struct vregion *r, uint64_t va, char *data, int sz, short present, sho
   return 0;
 }
 
-// va must be page aligned
-static int
-vrloaddata(struct vregion *r, uint64_t va, struct inode *ip, uint offset, uint sz)
-{
-  uint i, n;
-  struct vpage_info *vpi;
-  assertm(va % PGSIZE == 0, "va must be page aligned");
-
-  for (i = 0; i < sz; i += PGSIZE) {
-    vpi = va2vpage_info(r, va + i);
-    assertm(vpi->used, "page must be allocated");
-    n = min(sz - i, (uint) PGSIZE);
-    if (readi(ip, P2V(vpi->ppn << PT_SHIFT), offset + i, n) != n)
-      return -1;
-  }
-
-  return 0;
-}
-
 // Initializes the code region in the given vspace and copies the
 // code in init to the region. Also allocates space for the stack
 // region of 1 page.
@@ -168,7 +251,7 @@ vspaceinitcode(struct vspace *vs, char *init, uint64_t size)
   vs->regions[VR_CODE].va_base = 0;
   vs->regions[VR_CODE].size = PGROUNDUP(size);
   assertm(
-    vradddata(&vs->regions[VR_CODE], 0, init, size, VPI_PRESENT, VPI_WRITABLE) == 0,
+    vradddata(vs, &vs->regions[VR_CODE], 0, init, size, VPI_PRESENT, VPI_WRITABLE) == 0,
     "failed to allocate init code data"
   );
 
@@ -179,7 +262,7 @@ vspaceinitcode(struct vspace *vs, char *init, uint64_t size)
   vs->regions[VR_USTACK].va_base = stack;
   vs->regions[VR_USTACK].size = PGSIZE;
   assert(
-    vregionaddmap(&vs->regions[VR_USTACK], stack - PGSIZE, PGSIZE, VPI_PRESENT, VPI_WRITABLE) >= 0
+    vregionaddmap(vs, &vs->regions[VR_USTACK], stack - PGSIZE, PGSIZE, VPI_PRESENT, VPI_WRITABLE) >= 0
   );
 
   vspaceinvalidate(vs);
@@ -188,22 +271,25 @@ vspaceinitcode(struct vspace *vs, char *init, uint64_t size)
 // loads the code for the given program at 'path' into the
 // vspace for a process. The program must be ELF compliant. The
 // first instruction for the program is returned in the output
-// parameter rip
+// parameter rip.  Only the headers are read here; the segments are
+// recorded in vs->segs and their pages read in as the program
+// touches them (see vspacefilemap()), so a short-lived program only
+// pays for what it uses.
 int
 vspaceloadcode(struct vspace *vs, char *path, uint64_t *rip)
 {
   struct inode *ip;
   struct proghdr ph;
-  int off, sz;
-  uint64_t va;
+  struct vseg *seg;
+  int off, i;
+  uint64_t end;
   struct elfhdr elf;
-  int i;
 
   if((ip = namei(path)) == 0){
     return 0;
   }
 
-  locki(ip);
+  locki_shared(ip);
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -211,11 +297,9 @@ vspaceloadcode(struct vspace *vs, char *path, uint64_t *rip)
   if(elf.magic != ELF_MAGIC)
     goto elf_failure;
 
-  // Set start bound
-  vs->regions[VR_CODE].va_base = 0;
-
-  // Load program into memory.
-  va = 0;
+  // Record the segments to load
+  end = 0;
+  vs->nseg = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto elf_failure;
@@ -225,28 +309,37 @@ vspaceloadcode(struct vspace *vs, char *path, uint64_t *rip)
       goto elf_failure;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto elf_failure;
-
-    if((sz = vregionaddmap(&vs->regions[VR_CODE], (uint64_t)va, ph.vaddr + ph.memsz, VPI_PRESENT, VPI_WRITABLE)) < 0)
-     goto elf_failure;
     if(ph.vaddr % PGSIZE != 0)
       goto elf_failure;
+    if(ph.vaddr + ph.memsz > MMAPBASE || ph.off + ph.filesz > ip->size)
+      goto elf_failure;
+    if(vs->nseg == NVSEG)
+      goto elf_failure;
 
-    va += sz;
-
-    if(vrloaddata(&vs->regions[VR_CODE], ph.vaddr, ip, ph.off, ph.filesz) < 0)
-     goto elf_failure;
+    seg = &vs->segs[vs->nseg++];
+    seg->va = ph.vaddr;
+    seg->memsz = ph.memsz;
+    seg->filesz = ph.filesz;
+    seg->off = ph.off;
+    // Read-only segments stay read-only, so fork() can share
+    // them without marking them copy-on-write
+    seg->writable = (ph.flags & ELF_PROG_FLAG_WRITE) ? VPI_WRITABLE : 0;
+    end = max(end, ph.vaddr + ph.memsz);
   }
+  if(end == 0)
+    goto elf_failure;
 
-  // Set end bound;
-  vs->regions[VR_CODE].size = PGROUNDUP(sz);
+  // The code region keeps the file's reference from namei()
+  vs->regions[VR_CODE].va_base = 0;
+  vs->regions[VR_CODE].size = PGROUNDUP(end);
+  vs->regions[VR_CODE].ip = ip;
   // The heap will be right after the code
-  vs->regions[VR_HEAP].va_base = PGROUNDUP(sz);
+  vs->regions[VR_HEAP].va_base = PGROUNDUP(end);
   vs->regions[VR_HEAP].size = 0;
 
   unlocki(ip);
-  irelease(ip);
   *rip = elf.entry;
-  return sz;
+  return end;
 elf_failure:
   if(ip) {
     unlocki(ip);
@@ -256,17 +349,13 @@ elf_failure:
   return 0;
 }
 
-// invalidates the given vspace method in essense remaps the user's virtual
-// address space but does not install the rebuilt vspace on the cpu
-void
-vspaceinvalidate(struct vspace *vs)
+// frees the page-table pages of the user part of vs, but not the
+// pages they map; the vpage_infos still own those
+static void
+freeuserpgtbl(struct vspace *vs)
 {
   uint i;
-  struct vregion *vr;
-  struct vpage_info *vpi;
-  uint64_t start, end;
 
-  // First free the user entries (not the pages they point to)
   for (i = 0; i <= PML4_INDEX(SZ_4G); i++) {
     if(vs->pgtbl[i] & PTE_P){
       pdpte_t *pdpt = P2V(PDPT_ADDR(vs->pgtbl[i]));
@@ -274,6 +363,54 @@ vspaceinvalidate(struct vspace *vs)
       vs->pgtbl[i] = 0;
     }
   }
+}
+
+// clears the write bit of every user page table entry of vs in place;
+// the TLB is flushed when vs is next installed
+static void
+wrprotectuser(struct vspace *vs)
+{
+  pdpte_t *pdpt;
+  pde_t *pgdir;
+  pte_t *pt;
+  uint i, j, k, l;
+
+  for (i = 0; i <= PML4_INDEX(SZ_4G); i++) {
+    if (!(vs->pgtbl[i] & PTE_P))
+      continue;
+    pdpt = P2V(PDPT_ADDR(vs->pgtbl[i]));
+    for (j = 0; j < PTRS_PER_PDPT; j++) {
+      if (!(pdpt[j] & PTE_P))
+        continue;
+      pgdir = P2V(PDE_ADDR(pdpt[j]));
+      for (k = 0; k < PTRS_PER_PD; k++) {
+        if (!(pgdir[k] & PTE_P))
+          continue;
+        if (pgdir[k] & PTE_PS) {
+          pgdir[k] &= ~PTE_W;
+          continue;
+        }
+        pt = P2V(PTE_ADDR(pgdir[k]));
+        for (l = 0; l < PTRS_PER_PT; l++)
+          pt[l] &= ~PTE_W;
+      }
+    }
+  }
+  vspaceflushall(vs);
+}
+
+// invalidates the given vspace method in essense remaps the user's virtual
+// address space but does not install the rebuilt vspace on the cpu
+void
+vspaceinvalidate(struct vspace *vs)
+{
+  struct vregion *vr;
+  struct vpage_info *vpi;
+  uint64_t start, end;
+
+  // First free the user entries (not the pages they point to)
+  freeuserpgtbl(vs);
+  vspaceflushall(vs);
 
   // Then rebuild the user virtual address space
   for (vr = vs->regions; vr < &vs->regions[NREGIONS]; vr++) {
@@ -289,6 +426,37 @@ vspaceinvalidate(struct vspace *vs)
   }
 }
 
+// Rewrites the page table entries for the npages pages starting at va
+// from their vpage_infos, and flushes them from this CPU's TLB.  For
+// faults and other changes to a few pages of the installed vspace,
+// instead of vspaceinvalidate() and a full reload.
+int
+vspaceupdate(struct vspace *vs, uint64_t va, uint64_t npages)
+{
+  struct vregion *vr;
+  struct vpage_info *vpi;
+  pte_t *pte, old;
+  uint64_t a;
+
+  for (a = PGROUNDDOWN(va); npages > 0; a += PGSIZE, npages--) {
+    if (!(pte = walkpml4(vs->pgtbl, (char *)a, 1)))
+      return -1;
+    old = *pte;
+    vr = va2vregion(vs, a);
+    vpi = vr ? va2vpage_info(vr, a) : 0;
+    if (vpi && vpi->used && vpi->present) {
+      *pte = PTE(vpi->ppn << PT_SHIFT, x86perms(vpi));
+      mark_user_mem(vpi->ppn << PT_SHIFT, a);
+    } else {
+      *pte = 0;
+    }
+    // No TLB holds a page that was not present
+    if (old & PTE_P)
+      vspaceflush(vs, a);
+  }
+  return 0;
+}
+
 // Marks the current user address as not present in the page directory
 // for the passed vspace.
 // user_va must be rounded down to the nearest page.
@@ -316,6 +484,128 @@ void vspacemarknotpresent(struct vspace *vspace, uint64_t user_va) {
   }
 }
 
+// moves the vspace at src to dst, which takes over its page table
+// and pages; src is left to be discarded without vspacefree()
+void
+vspacemove(struct vspace *dst, struct vspace *src)
+{
+  struct vregion *vr;
+  struct vpi_dir *dir;
+  struct vpi_page *leaf;
+  int i, j, k;
+
+  rmapacquire();
+  *dst = *src;
+  for (vr = dst->regions; vr < &dst->regions[NREGIONS]; vr++) {
+    if (!vr->pages)
+      continue;
+    for (i = 0; i < VPIDIRN; i++) {
+      if (!(dir = vr->pages->slot[i]))
+        continue;
+      for (j = 0; j < VPIDIRN; j++) {
+        if (!(leaf = dir->slot[j]))
+          continue;
+        for (k = 0; k < VPIPPAGE; k++)
+          if (leaf->infos[k].used && leaf->infos[k].present)
+            rmapmove(&leaf->infos[k], dst);
+      }
+    }
+  }
+  rmaprelease();
+}
+
+// Makes the pages of [va, va+n) present, and writable if write is
+// set, by touching each one through the fault path, and keeps the
+// swapper away from vs until vspaceunpin().  A copy to or from them
+// under a spinlock, where a fault can't sleep, then won't fault,
+// unless another thread of the group changes the mappings meanwhile
+// with fork(), munmap() or the like.
+void
+vspacepin(struct vspace *vs, char *va, int n, int write)
+{
+  uint64_t a, p;
+  char c;
+
+  __sync_fetch_and_add(&vs->pinned, 1);
+  for (a = PGROUNDDOWN((uint64_t)va); a < (uint64_t)va + n && a < USERTOP;
+       a += PGSIZE) {
+    p = max(a, (uint64_t)va) & ~3;
+    if (write)
+      touchuser((int *)p);
+    else
+      copyin(&c, p, 1);
+  }
+}
+
+void
+vspaceunpin(struct vspace *vs)
+{
+  if (__sync_sub_and_fetch(&vs->pinned, 1) < 0)
+    panic("vspaceunpin");
+}
+
+// Turns on global pages and PCIDs, where the CPU has them, on this
+// CPU, which must be on the kernel's page table.  Run once on each CPU.
+void
+vspacecpuinit(void)
+{
+  struct cpu *c = mycpu();
+
+  if (havepge)
+    lcr4(rcr4() | CR4_PGE);
+  if (havepcid) {
+    lcr4(rcr4() | CR4_PCIDE);
+    npcid = NPCID;
+  }
+  c->pgtbl = kpml4;
+}
+
+// The slot in this CPU's TLB state for vs, or -1 if it has none.
+// Slot i is PCID i+1; without PCIDs there is one slot, for whatever
+// vspace was last loaded.
+static int
+tlbslot(struct cpu *c, struct vspace *vs)
+{
+  int i;
+
+  for (i = 0; i < (npcid ? npcid : 1); i++)
+    if (c->tlbid[i] == vs->tlbid)
+      return i;
+  return -1;
+}
+
+// Loads vs's page table on this CPU, with interrupts off.  The TLB
+// entries a PCID kept for vs are reused if no mapping has been taken
+// away since they were flushed; if vs is loaded and up to date,
+// nothing is done.
+static void
+vspaceload(struct cpu *c, struct vspace *vs)
+{
+  uint64_t gen = vs->tlbgen;
+  uint64_t cr3 = V2P(vs->pgtbl);
+  int i;
+
+  i = tlbslot(c, vs);
+  if (i >= 0 && c->tlbgen[i] == gen) {
+    if (c->pgtbl == vs->pgtbl)
+      return;
+    if (npcid)
+      cr3 |= CR3_NOFLUSH;
+  } else {
+    if (i < 0) {
+      i = c->pcidhand;
+      if (npcid)
+        c->pcidhand = (i + 1) % npcid;
+      c->tlbid[i] = vs->tlbid;
+    }
+    c->tlbgen[i] = gen;
+  }
+  if (npcid)
+    cr3 |= i + 1;
+  lcr3(cr3);
+  c->pgtbl = vs->pgtbl;
+  c->tlbcur = i;
+}
 
 // installs the process' page table/vspace on the given
 // cpu
@@ -325,52 +615,192 @@ void vspacemarknotpresent(struct vspace *vspace, uint64_t user_va) {
 void
 vspaceinstall(struct proc *p)
 {
+  struct cpu *c;
+
   if (!p)
     panic("mrinstall: null proc");
   if (!p->kstack)
     panic("mrinstall: null kstack");
-  if (!p->vspace.pgtbl)
+  if (!p->group->vspace.pgtbl)
     panic("mrinstall: page table not initialized");
 
   pushcli();  // turn off interrupts
-  mycpu()->ts.rsp0 = (uint64_t)p->kstack + KSTACKSIZE;
-  lcr3(V2P(p->vspace.pgtbl));
+  c = mycpu();
+  c->ts.rsp0 = (uint64_t)p->kstack + KSTACKSIZE;
+  c->syscallstack = c->ts.rsp0;
+  vspaceload(c, &p->group->vspace);
   popcli();  // turns on interrupts
 }
 
-// installs the kernel's page table on the cpu
+// installs the kernel's page table on the cpu.  It maps nothing
+// but the kernel's global pages, so with PCIDs (it has PCID 0) no
+// TLB entries are dropped.
 void
 vspaceinstallkern(void)
 {
-  lcr3(V2P(kpml4));
+  struct cpu *c;
+
+  pushcli();
+  c = mycpu();
+  if (c->pgtbl != kpml4) {
+    lcr3(V2P(kpml4) | (npcid ? CR3_NOFLUSH : 0));
+    c->pgtbl = kpml4;
+  }
+  popcli();
+}
+
+// Interrupts the other CPUs that have vs loaded, which threads
+// sharing it may be running on, to flush their TLBs, and waits until
+// each has done so or loaded another page table, so that the caller
+// may free the pages it unmapped.  A CPU asked to flush while its
+// interrupts are off, spinning for a lock the caller may hold or in
+// a shootdown of its own, does it from vspacetlbpoll().  Interrupts
+// must be off.
+static void
+tlbshootdown(struct vspace *vs)
+{
+  uint64_t want[NCPU];
+  struct cpu *c;
+
+  for (c = cpus; c < cpus + ncpu; c++) {
+    want[c - cpus] = 0;
+    if (c != mycpu() && c->pgtbl == vs->pgtbl) {
+      want[c - cpus] = __sync_add_and_fetch(&c->tlbreq, 1);
+      lapictlb(c->apicid);
+    }
+  }
+  for (c = cpus; c < cpus + ncpu; c++)
+    while (want[c - cpus] && c->tlbdone < want[c - cpus] &&
+           c->pgtbl == vs->pgtbl) {
+      vspacetlbpoll();
+      pause();
+    }
+}
+
+// Does the flushes other CPUs have asked of this one since its last:
+// drops the TLB entries of the vspace loaded here.  Its slot's
+// generation is left as it was, so the next vspaceinstall() of it
+// flushes again rather than trusting entries the flush may have
+// raced with.  Interrupts must be off.
+void
+vspacetlbpoll(void)
+{
+  struct cpu *c = mycpu();
+  uint64_t req = c->tlbreq;
+
+  if (c->tlbdone == req)
+    return;
+  if (c->pgtbl != kpml4)
+    lcr3(V2P(c->pgtbl) | (npcid ? c->tlbcur + 1 : 0));
+  c->tlbdone = req;
+}
+
+// IRQ_TLB handler
+void
+vspacetlbintr(void)
+{
+  vspacetlbpoll();
+}
+
+// Drops the TLB entries for user page va of vs, after its PTE has
+// been cleared or had permissions taken away: now on this CPU, if vs
+// is loaded here, on others running it by interrupting them and
+// waiting until they have, and on any other when it next loads vs.
+// The caller may then free the page.
+void
+vspaceflush(struct vspace *vs, uint64_t va)
+{
+  struct cpu *c;
+  uint64_t gen;
+  int i;
+
+  pushcli();
+  c = mycpu();
+  gen = __sync_fetch_and_add(&vs->tlbgen, 1);
+  if (c->pgtbl == vs->pgtbl) {
+    invlpg((void *)va);
+    // If this CPU was up to date, it still is
+    if ((i = tlbslot(c, vs)) >= 0 && c->tlbgen[i] == gen)
+      c->tlbgen[i] = gen + 1;
+  }
+  tlbshootdown(vs);
+  popcli();
 }
 
-// recrusively frees the page descriptor linked list
-// calling kfree on each page
+// Like vspaceflush() for every page of vs, for changes to many of
+// them.  Takes effect on this CPU when vs is loaded next, by
+// vspaceinstall().
+void
+vspaceflushall(struct vspace *vs)
+{
+  pushcli();
+  __sync_fetch_and_add(&vs->tlbgen, 1);
+  tlbshootdown(vs);
+  popcli();
+}
+
+// frees the radix tree of page descriptors, dropping the
+// reference each descriptor holds on its page, and calling
+// kfree on each page of the tree itself
 static void
-free_page_desc_list(struct vpi_page *page)
+free_page_desc_tree(struct vpi_dir *root)
 {
-  assert((uint64_t) page % PGSIZE == 0);
+  struct vpi_dir *dir;
+  struct vpi_page *leaf;
+  int i, j, k;
 
-  if (!page)
+  if (!root)
     return;
 
-  free_page_desc_list(page->next);
-  kfree((char *)page);
+  for (i = 0; i < VPIDIRN; i++) {
+    if (!(dir = root->slot[i]))
+      continue;
+    for (j = 0; j < VPIDIRN; j++) {
+      if (!(leaf = dir->slot[j]))
+        continue;
+      rmapacquire();
+      for (k = 0; k < VPIPPAGE; k++) {
+        if (!leaf->infos[k].used)
+          continue;
+        if (rmapdrop(&leaf->infos[k]))
+          kfree(P2V(leaf->infos[k].ppn << PT_SHIFT));
+        else
+          swapfree(leaf->infos[k].ppn);
+      }
+      rmaprelease();
+      kfree((char *)leaf);
+    }
+    kfree((char *)dir);
+  }
+  kfree((char *)root);
 }
 
 // frees the given vpsace by freeing each page that
 // the vspace is using and then frees the underlying page
-// table
+// table.  The pages are found through the vpage_infos, since
+// a forked vspace maps them into its page table only as they
+// are touched.
 void
 vspacefree(struct vspace *vs)
 {
   struct vregion *vr;
+  struct cpu *c;
 
   for (vr = &vs->regions[0]; vr < &vs->regions[NREGIONS]; vr++) {
-    free_page_desc_list(vr->pages);
+    free_page_desc_tree(vr->pages);
+    if (vr->ip)
+      irelease(vr->ip);
+    if (vr->shm)
+      shmput(vr->shm);
     memset(vr, 0, sizeof(struct vregion));
   }
+  freeuserpgtbl(vs);
+
+  // A CPU's scheduler leaves the last process's page table loaded
+  // until it installs another; wait for any still on this one.
+  for (c = cpus; c < cpus + ncpu; c++)
+    while (c->pgtbl == vs->pgtbl)
+      pause();
   freevm(vs->pgtbl);
 }
 
@@ -399,30 +829,26 @@ va2vregion(struct vspace *vs, uint64_t va)
 struct vpage_info*
 va2vpage_info(struct vregion *vr, uint64_t va)
 {
-  int idx;
+  uint64_t idx, leaf;
+  struct vpi_dir *dir;
   struct vpi_page *info;
 
-  if (!vr->pages) {
-    vr->pages = (struct vpi_page *)kalloc();
-    memset(vr->pages, 0, PGSIZE);
-  }
-
   idx = va2vpi_idx(vr, va);
-  info = vr->pages;
-
-  while (idx >= VPIPPAGE) {
-    assertm(info, "idx was out of bounds");
-    if (!info->next) {
-      info->next = (struct vpi_page *)kalloc();
-      if (!info->next)
-        return 0;
-      memset(info->next, 0, PGSIZE);
-    }
-    info = info->next;
-    idx -= VPIPPAGE;
-  }
+  leaf = idx / VPIPPAGE;
+  if (leaf >= VPIDIRN * VPIDIRN)
+    return 0;
+
+  // allocate the path down to the vpi_page on demand
+  if (!vr->pages && !(vr->pages = (struct vpi_dir *)kalloc_zeroed()))
+    return 0;
+  dir = vr->pages->slot[leaf / VPIDIRN];
+  if (!dir && !(dir = vr->pages->slot[leaf / VPIDIRN] = kalloc_zeroed()))
+    return 0;
+  info = dir->slot[leaf % VPIDIRN];
+  if (!info && !(info = dir->slot[leaf % VPIDIRN] = kalloc_zeroed()))
+    return 0;
 
-  return &info->infos[idx];
+  return &info->infos[idx % VPIPPAGE];
 }
 
 // Tests if a vregion has [va, va + size) mapped in it's virtual address space.
@@ -448,76 +874,399 @@ vspacecontains(struct vspace *vs, uint64_t va, int size)
 }
 
 
-// recursively copies the vpi_page struct from src to dst
+// copies the vpi_page struct src, which holds the pages of region
+// vr from index idx on, to *dst in vspace vs
 //
 // return 0 on success, -1 if failed
 static int
-copy_vpi_page(struct vpi_page **dst, struct vpi_page *src)
+copy_vpi_page(struct vspace *vs, struct vregion *vr, uint64_t idx,
+              struct vpi_page **dst, struct vpi_page *src)
 {
   int i;
-  // char *data;
+  uint64_t va;
   struct vpage_info *srcvpi, *dstvpi;
 
-  if (!src) {
-    *dst = 0;
-    return 0;
-  }
-
-  if (!(*dst = (struct vpi_page *)kalloc()))
+  if (!(*dst = (struct vpi_page *)kalloc_zeroed()))
     return -1;
 
-  memset(*dst, 0, sizeof(struct vpi_page));
-
+  // The swapper may be taking pages from src as we go
+  rmapacquire();
   for (i = 0; i < VPIPPAGE; i++) {
     srcvpi = &src->infos[i];
     dstvpi = &(*dst)->infos[i];
     if (srcvpi->used) {
-      dstvpi->used = srcvpi->used;
-      dstvpi->present = srcvpi->present;
-      dstvpi->writable = 0; 
-      dstvpi->is_cow = VPI_COW;
-      dstvpi->ppn = srcvpi->ppn; 
+      // Writable pages become copy-on-write in both spaces; pages
+      // that were never writable (read-only code) and shared memory
+      // are just shared
+      if (!vr->shm && (srcvpi->writable || srcvpi->is_cow == VPI_COW)) {
+        srcvpi->original_perm = VPI_WRITABLE;
+        srcvpi->writable = 0;
+        srcvpi->is_cow = VPI_COW;
+      }
+      *dstvpi = *srcvpi;
+
+      // increase the ref_count in core_map, or of the swap slot
+      // holding the page
+      if (srcvpi->present) {
+        increment_ref(pa2page(srcvpi->ppn << PT_SHIFT));
+        if (vr->dir == VRDIR_UP)
+          va = vr->va_base + (idx + i) * PGSIZE;
+        else
+          va = vr->va_base - (idx + i + 1) * PGSIZE;
+        rmapadd(vs, dstvpi, va);
+      } else {
+        swapdup(srcvpi->ppn);
+      }
+    }
+  }
+  rmaprelease();
 
-      // New: make everything writable
-      dstvpi->original_perm = VPI_WRITABLE;
+  return 0;
+}
 
-      srcvpi->original_perm = VPI_WRITABLE;
-      srcvpi->writable = 0; 
-      srcvpi->is_cow = VPI_COW; 
+// copies the radix tree of vpi_pages of region vr at src into *dst,
+// level by level, for vspace vs
+//
+// return 0 on success, -1 if failed; *dst then holds what was copied
+static int
+copy_vpi_tree(struct vspace *vs, struct vregion *vr, struct vpi_dir **dst,
+              struct vpi_dir *src)
+{
+  struct vpi_dir *sdir, *ddir;
+  int i, j;
 
+  *dst = 0;
+  if (!src)
+    return 0;
+  if (!(*dst = (struct vpi_dir *)kalloc_zeroed()))
+    return -1;
 
-      // increase the ref_count in core_map
-      lock_memory();
-      struct core_map_entry* cm_entry = pa2page(srcvpi->ppn << PT_SHIFT);
-      cm_entry->ref_count++;
-      unlock_memory();
-    }
+  for (i = 0; i < VPIDIRN; i++) {
+    if (!(sdir = src->slot[i]))
+      continue;
+    if (!(ddir = (*dst)->slot[i] = kalloc_zeroed()))
+      return -1;
+    for (j = 0; j < VPIDIRN; j++)
+      if (sdir->slot[j] &&
+          copy_vpi_page(vs, vr, ((uint64_t)i * VPIDIRN + j) * VPIPPAGE,
+                        (struct vpi_page **)&ddir->slot[j], sdir->slot[j]) < 0)
+        return -1;
+  }
+  return 0;
+}
+
+// copies the regions and pages of the src vspace to dst
+int
+vspacecopy(struct vspace *dst, struct vspace *src)
+{
+  struct vregion *vr;
+
+  memmove(dst->regions, src->regions, sizeof(struct vregion) * NREGIONS);
+  memmove(dst->segs, src->segs, sizeof(struct vseg) * src->nseg);
+  dst->nseg = src->nseg;
+
+  for (vr = dst->regions; vr < &dst->regions[NREGIONS]; vr++) {
+    if (vr->ip)
+      idup(vr->ip);
+    if (vr->shm)
+      shmdup(vr->shm);
+    if (copy_vpi_tree(dst, vr, &vr->pages, vr->pages) < 0)
+      return -1;
   }
 
-  return copy_vpi_page(&(*dst)->next, src->next);
+  // The child's page table is filled in from its vpage_infos as it
+  // faults (see trap()), so a fork that execs soon after never
+  // builds one.  The parent keeps its page table with writes
+  // turned off, but for shared memory, which stays writable; it
+  // must reload cr3 before returning to user space.
+  wrprotectuser(src);
+  for (vr = &src->regions[VR_SHM]; vr < &src->regions[VR_SHM + NSHM]; vr++)
+    if (vr->shm && vspaceupdate(src, vr->va_base, vr->size / PGSIZE) < 0)
+      return -1;
+  return 0;
+}
+
+
+
+
+// The lowest address above all of vs's mmap() and shared memory
+// regions, where the next one goes
+static uint64_t
+vsmaptop(struct vspace *vs)
+{
+  struct vregion *vr;
+  uint64_t va;
+
+  va = MMAPBASE;
+  for (vr = &vs->regions[VR_MMAP]; vr < &vs->regions[NREGIONS]; vr++)
+    if (vr->ip || vr->shm)
+      va = max(va, VRTOP(vr));
+  return va;
+}
+
+// Takes every page of region vr of vs out of its page table and
+// drops them.
+static void
+vregionunmap(struct vspace *vs, struct vregion *vr)
+{
+  pte_t *pte;
+  uint64_t a;
+
+  for (a = vr->va_base; a < VRTOP(vr); a += PGSIZE) {
+    if ((pte = walkpml4(vs->pgtbl, (char *)a, 0)) != 0 && *pte) {
+      *pte = 0;
+      vspaceflush(vs, a);
+    }
+  }
+  free_page_desc_tree(vr->pages);
+  vr->pages = 0;
 }
 
+// Maps len bytes of file ip from offset off, which must be page
+// aligned, into a free mmap() region of vs with protections prot.
+// Pages are filled from the page cache as they are touched (see
+// vspacefilemap()).  Returns the address of the mapping, or -1 if
+// there is no free region or no room for it.
+int
+vspacemmap(struct vspace *vs, struct inode *ip, uint64_t off, uint64_t len, int prot)
+{
+  struct vregion *vr, *free;
+  uint64_t va;
+
+  if (off % PGSIZE != 0 || len == 0)
+    return -1;
 
+  free = 0;
+  for (vr = &vs->regions[VR_MMAP]; vr < &vs->regions[VR_MMAP + NMMAP]; vr++) {
+    if (!vr->ip) {
+      free = vr;
+      break;
+    }
+  }
+  va = vsmaptop(vs);
+  // Stay clear of the 10 pages the stack can grow to
+  if (!free || va + PGROUNDUP(len) > vs->regions[VR_USTACK].va_base - 10 * PGSIZE)
+    return -1;
 
-// copies the regions and pagesof the src vspace to dst
+  free->dir = VRDIR_UP;
+  free->va_base = va;
+  free->size = PGROUNDUP(len);
+  free->pages = 0;
+  free->nlazy = 0;
+  free->ip = idup(ip);
+  free->off = off;
+  free->prot = prot;
+  return va;
+}
+
+// Removes the mmap() region of vs at va, which must be len bytes
+// long, and drops its pages.  Returns 0 on success, -1 if there is no
+// such region.
 int
-vspacecopy(struct vspace *dst, struct vspace *src)
+vspacemunmap(struct vspace *vs, uint64_t va, uint64_t len)
 {
   struct vregion *vr;
 
-  memmove(dst->regions, src->regions, sizeof(struct vregion) * NREGIONS);
+  for (vr = &vs->regions[VR_MMAP]; vr < &vs->regions[VR_MMAP + NMMAP]; vr++) {
+    if (vr->ip && vr->va_base == va && vr->size == PGROUNDUP(len))
+      break;
+  }
+  if (vr == &vs->regions[VR_MMAP + NMMAP])
+    return -1;
+
+  vregionunmap(vs, vr);
+  irelease(vr->ip);
+  memset(vr, 0, sizeof(struct vregion));
+  return 0;
+}
+
+// Maps shared memory segment seg, which the caller has counted an
+// attachment to, into a free shared memory region of vs.  Every page
+// is mapped writable right away.  Returns the address of the region,
+// or -1 if there is no free region, no room or no memory.
+int
+vspaceshmat(struct vspace *vs, struct shmseg *seg)
+{
+  struct vregion *vr;
+  struct vpage_info *vpi;
+  uint64_t va, i;
+
+  for (vr = &vs->regions[VR_SHM]; vr < &vs->regions[VR_SHM + NSHM]; vr++)
+    if (!vr->shm)
+      break;
+  va = vsmaptop(vs);
+  if (vr == &vs->regions[VR_SHM + NSHM] ||
+      va + seg->npages * PGSIZE > vs->regions[VR_USTACK].va_base - 10 * PGSIZE)
+    return -1;
 
-  for (vr = dst->regions; vr < &dst->regions[NREGIONS]; vr++)
-    if (copy_vpi_page(&vr->pages, vr->pages) < 0)
+  memset(vr, 0, sizeof(struct vregion));
+  vr->dir = VRDIR_UP;
+  vr->va_base = va;
+  vr->size = seg->npages * PGSIZE;
+  for (i = 0; i < seg->npages; i++) {
+    // Look up first: growing the tree may allocate, and so swap
+    if (!(vpi = va2vpage_info(vr, va + i * PGSIZE))) {
+      vregionunmap(vs, vr);
+      memset(vr, 0, sizeof(struct vregion));
       return -1;
+    }
+    rmapacquire();
+    increment_ref(pa2page(V2P(seg->pages[i])));
+    vpi->used = 1;
+    vpi->present = VPI_PRESENT;
+    vpi->writable = VPI_WRITABLE;
+    vpi->is_cow = 0;
+    vpi->original_perm = VPI_WRITABLE;
+    vpi->ppn = PGNUM(V2P(seg->pages[i]));
+    rmapadd(vs, vpi, va + i * PGSIZE);
+    rmaprelease();
+  }
+  vr->shm = seg;
+  if (vspaceupdate(vs, va, seg->npages) < 0) {
+    vregionunmap(vs, vr);
+    memset(vr, 0, sizeof(struct vregion));
+    return -1;
+  }
+  return va;
+}
+
+// Removes the shared memory region of vs at va and drops its
+// attachment.  Returns 0 on success, -1 if there is no such region.
+int
+vspaceshmdt(struct vspace *vs, uint64_t va)
+{
+  struct vregion *vr;
+
+  for (vr = &vs->regions[VR_SHM]; vr < &vs->regions[VR_SHM + NSHM]; vr++)
+    if (vr->shm && vr->va_base == va)
+      break;
+  if (vr == &vs->regions[VR_SHM + NSHM])
+    return -1;
+
+  vregionunmap(vs, vr);
+  shmput(vr->shm);
+  memset(vr, 0, sizeof(struct vregion));
+  return 0;
+}
+
+// The segment of vs that va falls in, or 0 if none does.
+static struct vseg *
+va2vseg(struct vspace *vs, uint64_t va)
+{
+  int i;
 
-  vspaceinvalidate(dst);
-  vspaceinvalidate(src);
+  for (i = 0; i < vs->nseg; i++)
+    if (va >= vs->segs[i].va && va < vs->segs[i].va + vs->segs[i].memsz)
+      return &vs->segs[i];
   return 0;
 }
 
+// Can the page at va of segment seg be the file's cached page itself?
+// Only if the segment is read-only, lies page aligned in the file,
+// and has no zero fill in that page.
+static int
+vsegshared(struct vseg *seg, uint64_t va)
+{
+  return !seg->writable && seg->off % PGSIZE == 0 &&
+         (va - seg->va + PGSIZE <= seg->filesz || seg->memsz == seg->filesz);
+}
+
+// Reads the page at va of the program's code region in from the
+// segment it falls in, for a write if write is set; what is not in
+// the file reads as zeros.  Read-only text pages come from the page
+// cache and are shared by every process running the program.  Other
+// pages get a page of their own, except for zero-fill pages that are
+// only read.  Returns 0 on success, -1 if the read fails or there is
+// no memory.
+static int
+vrloadpage(struct vspace *vs, struct vregion *vr, struct vpage_info *vpi, uint64_t va, int write)
+{
+  struct vseg *seg;
+  char *mem;
+  short writable;
+  uint64_t n, pos;
+
+  seg = va2vseg(vs, va);
+  // A page of writable bss or between segments that is only read
+  // so far needs no memory of its own
+  if (!write && (seg ? seg->writable && va - seg->va >= seg->filesz : 1))
+    return vregionaddzero(vs, vr, va);
+  if (seg && vsegshared(seg, va)) {
+    if (!(mem = pcacheget(vr->ip, (seg->off + va - seg->va) / PGSIZE, 1)))
+      return -1;
+  } else if (!(mem = kalloc_zeroed())) {
+    return -1;
+  } else if (seg && va - seg->va < seg->filesz) {
+    n = min(seg->filesz - (va - seg->va), (uint64_t)PGSIZE);
+    pos = seg->off + va - seg->va;
+    locki_shared(vr->ip);
+    // Queue the next page's blocks too; programs run mostly forward
+    readahead(vr->ip, pos / BSIZE, (pos % BSIZE + n + PGSIZE + BSIZE - 1) / BSIZE);
+    if (readi(vr->ip, mem, pos, n) != n) {
+      unlocki(vr->ip);
+      kfree(mem);
+      return -1;
+    }
+    unlocki(vr->ip);
+  }
+
+  // Pages between segments are zero and writable, as they always were
+  writable = seg ? seg->writable : VPI_WRITABLE;
+  vpi->used = 1;
+  vpi->present = VPI_PRESENT;
+  vpi->writable = writable;
+  vpi->is_cow = 0;
+  vpi->original_perm = writable;
+  vpi->ppn = PGNUM(V2P(mem));
+
+  rmapacquire();
+  rmapadd(vs, vpi, va);
+  rmaprelease();
+  return vspaceupdate(vs, va, 1);
+}
+
+// Fills the page at va of a region backed by a file and maps it, for
+// a write if write is set.  The code region is read from the program's segments.  An mmap()
+// region is filled from the page cache: a read-only mapping shares
+// the cached page itself; a writable one maps it copy-on-write, so
+// the first write makes a private copy.  Returns 0 on success, -1 if
+// va is not an unfilled page of such a region, lies past the end of
+// the file, or there is no memory.
+int
+vspacefilemap(struct vspace *vs, uint64_t va, int write)
+{
+  struct vregion *vr;
+  struct vpage_info *vpi;
+  char *data;
+
+  if (!(vr = va2vregion(vs, va)) || !vr->ip || !(vpi = va2vpage_info(vr, va)))
+    return -1;
+  if (vpi->used)
+    return -1;
+  if (vr == &vs->regions[VR_CODE])
+    return vrloadpage(vs, vr, vpi, va, write);
+  if ((data = pcacheget(vr->ip, (vr->off + va - vr->va_base) / PGSIZE, 0)) == 0)
+    return -1;
 
+  vpi->used = 1;
+  vpi->present = VPI_PRESENT;
+  vpi->writable = 0;
+  vpi->ppn = PGNUM(V2P(data));
+  if (vr->prot & PROT_WRITE) {
+    vpi->is_cow = VPI_COW;
+    vpi->original_perm = VPI_WRITABLE;
+  } else {
+    vpi->is_cow = 0;
+    vpi->original_perm = 0;
+  }
 
+  // The page cache's own reference keeps the swapper from taking
+  // the page while it is cached
+  rmapacquire();
+  rmapadd(vs, vpi, va);
+  rmaprelease();
+  return vspaceupdate(vs, va, 1);
+}
 
 // initializes the stack region in the user's address space for the
 // given vspace beginning at start and growing down from that address.
@@ -530,7 +1279,7 @@ vspaceinitstack(struct vspace *vs, uint64_t start)
   vr->size = PGSIZE;
 
   // stack page
-  if (vregionaddmap(vr, start - PGSIZE, PGSIZE, VPI_PRESENT, VPI_WRITABLE) < 0)
+  if (vregionaddmap(vs, vr, start - PGSIZE, PGSIZE, VPI_PRESENT, VPI_WRITABLE) < 0)
     return -1;
 
   vspaceinvalidate(vs);
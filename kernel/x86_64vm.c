@@ -1,5 +1,6 @@
 #include <param.h>
 #include <cdefs.h>
+#include <clock.h>
 #include <defs.h>
 #include <x86_64.h>
 #include <memlayout.h>
@@ -12,8 +13,27 @@
 #include <file.h>
 
 extern char data[];  // defined by kernel.ld
+extern void syscallentry(void); // in trapasm.S
 pml4e_t *kpml4;  // for use in scheduler()
 
+// Kernel stacks live apart from the rest of the kernel's memory, at
+// KSTACKBASE, each above an unmapped guard page, so running off the
+// end of one faults instead of overwriting whatever lies below.
+// Every page table shares the one page directory pointer table that
+// maps them.  A freed stack stays mapped and is the next one handed
+// out, so its mapping never changes and no CPU can have a stale TLB
+// entry for it.
+#define KSTACKSLOT (PGSIZE + KSTACKSIZE)
+
+static struct {
+  struct spinlock lock;
+  pdpte_t *pdpt;  // shared by every page table
+  char *free;     // freed stacks, linked through their first word
+  int nslot;      // slots mapped so far
+} kstacks;
+
+static pdpte_t *clockpdpt; // maps CLOCKPAGE in every page table
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
@@ -44,7 +64,18 @@ seginit(void)
 
   loadgs(SEG_KCPU << 3);
   wrmsr(MSR_IA32_GS_BASE, (uint64_t)&c->cpu);
-  wrmsr(MSR_IA32_KERNEL_GS_BASE, (uint64_t)&c->cpu);
+  // The user's %gs base, which swapgs trades for the kernel's on
+  // every entry from user space
+  wrmsr(MSR_IA32_KERNEL_GS_BASE, 0);
+
+  // The SYSCALL instruction enters the kernel at syscallentry with
+  // interrupts off; SYSRET returns to the user segments, which it
+  // finds at fixed offsets from SEG_KCPU.
+  wrmsr(MSR_STAR, ((uint64_t)((SEG_KCPU << 3) | DPL_USER) << 48) |
+                  ((uint64_t)(SEG_KCODE << 3) << 32));
+  wrmsr(MSR_LSTAR, (uint64_t)syscallentry);
+  wrmsr(MSR_SFMASK, FLAGS_IF | FLAGS_DF | FLAGS_TF);
+  wrmsr(MSR_EFER, rdmsr(MSR_EFER) | EFER_SCE);
 
   // Initialize cpu-local storage.
   c->cpu = c;
@@ -52,25 +83,23 @@ seginit(void)
 };
 
 
-// Return the address of the PTE in page table pgdir
-// that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
-pte_t *
-walkpml4(pml4e_t *pml4, const void *va, int alloc)
+// Return the address of the PDE in page table pml4 that
+// corresponds to virtual address va.  If alloc!=0, create
+// any required page directory pages.
+pde_t *
+walkpgdir(pml4e_t *pml4, const void *va, int alloc)
 {
   pml4e_t *pml4e;
   pdpte_t *pdpt, *pdpte;
-  pde_t *pgdir, *pde;
-  pte_t *pgtab;
+  pde_t *pgdir;
 
   pml4e = &pml4[PML4_INDEX(va)];
 
   if (*pml4e & PTE_P) {
     pdpt = (pdpte_t*)P2V(PDPT_ADDR(*pml4e));
   } else {
-    if(!alloc || (pdpt = (pdpte_t*)kalloc()) == 0)
+    if(!alloc || (pdpt = (pdpte_t*)kalloc_zeroed()) == 0)
       return 0;
-    memset(pdpt, 0, PGSIZE);
     *pml4e = V2P(pdpt) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -79,20 +108,61 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pdpte & PTE_P) {
     pgdir = (pde_t*)P2V(PDE_ADDR(*pdpte));
   } else {
-    if(!alloc || (pgdir = (pde_t*)kalloc()) == 0)
+    if(!alloc || (pgdir = (pde_t*)kalloc_zeroed()) == 0)
       return 0;
-    memset(pgdir, 0, PGSIZE);
     *pdpte = V2P(pgdir) | PTE_P | PTE_W | PTE_U;
   }
 
-  pde = &pgdir[PD_INDEX(va)];
+  return &pgdir[PD_INDEX(va)];
+}
 
-  if (*pde & PTE_P) {
+// Replace the 2 MB mapping of pde by a page table mapping the same
+// pages with the same permissions.  Returns the page table, or 0 if
+// out of memory.
+static pte_t *
+splitpde(pde_t *pde)
+{
+  pte_t *pgtab;
+  uint64_t pa, perm;
+  int i;
+
+  if((pgtab = (pte_t*)kalloc()) == 0)
+    return 0;
+  pa = PDE_ADDR(*pde) & ~(PD_SIZE - 1);
+  perm = PTE_FLAGS(*pde) & ~PTE_PS;
+  for(i = 0; i < PTRS_PER_PT; i++)
+    pgtab[i] = PTE(pa + i * PGSIZE, perm);
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  return pgtab;
+}
+
+// Return the address of the PTE in page table pgdir
+// that corresponds to virtual address va.  If alloc!=0,
+// create any required page table pages, splitting a 2 MB
+// mapping of va into 4 KB ones if need be.  If alloc==0,
+// a 2 MB mapping's PDE is returned instead: clearing its
+// bits changes all 512 pages, which callers may do only
+// when the pages can fault back in one at a time.
+pte_t *
+walkpml4(pml4e_t *pml4, const void *va, int alloc)
+{
+  pde_t *pde;
+  pte_t *pgtab;
+
+  if ((pde = walkpgdir(pml4, va, alloc)) == 0)
+    return 0;
+
+  if ((*pde & PTE_P) && (*pde & PTE_PS)) {
+    if (!alloc)
+      return (pte_t*)pde;
+    if ((pgtab = splitpde(pde)) == 0)
+      return 0;
+    invlpg((void*)va);
+  } else if (*pde & PTE_P) {
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
       return 0;
-    memset(pgtab, 0, PGSIZE);
     *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -129,16 +199,49 @@ mappages(pml4e_t *pml4, uint64_t virt_pn, int num_page, uint64_t phy_pn, int per
 }
 
 
-// Set up kernel part of a page table.
+// Map the size bytes of physical memory at pa to va for the kernel.
+// Runs that are 2 MB aligned get 2 MB pages, which leaves a few
+// page directory entries instead of thousands of PTEs in every page
+// table and in the TLB.
+static int
+mapkernel(pml4e_t *pml4, uint64_t va, uint64_t pa, uint64_t size, int perm)
+{
+  pde_t *pde;
+  uint64_t n;
+
+  while (size > 0) {
+    if (va % PD_SIZE == 0 && pa % PD_SIZE == 0 && size >= PD_SIZE) {
+      if ((pde = walkpgdir(pml4, (void*)va, 1)) == 0)
+        return -1;
+      if (*pde & PTE_P)
+        panic("remap");
+      *pde = pa | perm | PTE_PS;
+      n = PD_SIZE;
+    } else {
+      // 4 KB pages up to the next 2 MB boundary
+      n = min(size, PD_SIZE - va % PD_SIZE);
+      if (mappages(pml4, va >> PT_SHIFT, n >> PT_SHIFT, pa >> PT_SHIFT, perm, 1) < 0)
+        return -1;
+    }
+    va += n;
+    pa += n;
+    size -= n;
+  }
+  return 0;
+}
+
+// Set up kernel part of a page table.  Every page table maps the
+// kernel the same way, so its mappings are global (PTE_G) and stay in
+// the TLB across %cr3 loads.
 pml4e_t*
 setupkvm(void)
 {
   pml4e_t *pml4;
   struct kmap *k;
+  pte_t *pte;
 
-  if((pml4 = (pml4e_t*)kalloc()) == 0)
+  if((pml4 = (pml4e_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pml4, 0, PGSIZE);
 
   struct kmap {
     void *virt;
@@ -153,12 +256,84 @@ setupkvm(void)
   };
 
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++) {
-    if(mappages(pml4, (uint64_t)(k->virt) >> PT_SHIFT, (k->phys_end - k->phys_start) >> PT_SHIFT, k->phys_start >> PT_SHIFT, k->perm | PTE_P, 1) < 0)
+    if(mapkernel(pml4, (uint64_t)k->virt, k->phys_start, k->phys_end - k->phys_start, k->perm | PTE_P | PTE_G) < 0)
       return 0;
   }
+
+  if (!kstacks.pdpt) {
+    // the first call, for kpml4
+    initlock(&kstacks.lock, "kstacks");
+    if ((kstacks.pdpt = (pdpte_t*)kalloc_zeroed()) == 0)
+      return 0;
+  }
+  pml4[PML4_INDEX(KSTACKBASE)] = V2P(kstacks.pdpt) | PTE_P | PTE_W;
+
+  // The clock page, like the stacks, is mapped by one page directory
+  // pointer table that every page table shares; user code may read it
+  if (!clockpdpt) {
+    if ((clockpage = (struct clockpage*)kalloc_zeroed()) == 0 ||
+        (pte = walkpml4(pml4, (void*)CLOCKPAGE, 1)) == 0)
+      return 0;
+    *pte = PTE(V2P(clockpage), PTE_P | PTE_U | PTE_G);
+    clockpdpt = P2V(PDPT_ADDR(pml4[PML4_INDEX(CLOCKPAGE)]));
+  }
+  pml4[PML4_INDEX(CLOCKPAGE)] = V2P(clockpdpt) | PTE_P | PTE_U;
   return pml4;
 }
 
+// Allocate a guarded kernel stack of KSTACKSIZE bytes.
+// Returns its lowest address, or 0 if out of memory.
+char*
+kstackalloc(void)
+{
+  char *va, *mem;
+  pte_t *pte;
+  int i;
+
+  acquire(&kstacks.lock);
+  if ((va = kstacks.free) != 0) {
+    kstacks.free = *(char**)va;
+    release(&kstacks.lock);
+    return va;
+  }
+  if (kstacks.nslot == NPROC) {
+    release(&kstacks.lock);
+    return 0;
+  }
+
+  va = (char*)KSTACKBASE + kstacks.nslot * KSTACKSLOT + PGSIZE;
+  for (i = 0; i < KSTACKSIZE; i += PGSIZE) {
+    if ((mem = kalloc()) == 0 ||
+        (pte = walkpml4(kpml4, va + i, 1)) == 0) {
+      if (mem)
+        kfree(mem);
+      // unmap what we did map; nothing has used it
+      while ((i -= PGSIZE) >= 0) {
+        pte = walkpml4(kpml4, va + i, 0);
+        kfree(P2V(PTE_ADDR(*pte)));
+        *pte = 0;
+        invlpg(va + i);
+      }
+      release(&kstacks.lock);
+      return 0;
+    }
+    *pte = PTE(V2P(mem), PTE_P | PTE_W | PTE_G);
+  }
+  kstacks.nslot++;
+  release(&kstacks.lock);
+  return va;
+}
+
+// Free a stack kstackalloc() returned, keeping it mapped for reuse.
+void
+kstackfree(char *va)
+{
+  acquire(&kstacks.lock);
+  *(char**)va = kstacks.free;
+  kstacks.free = va;
+  release(&kstacks.lock);
+}
+
 uint64_t
 find_next_possible_page(pml4e_t *pml4, uint64_t va)
 {
@@ -226,7 +401,8 @@ freevm_pgdir(pde_t *pgdir)
 {
   uint i;
   for (i = 0; i < PTRS_PER_PD; i++) {
-    if (pgdir[i] & PTE_P) {
+    // A 2 MB mapping has no page table to free
+    if ((pgdir[i] & PTE_P) && !(pgdir[i] & PTE_PS)) {
       char *v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
     }
@@ -257,6 +433,8 @@ freevm(pml4e_t *pml4)
   assertm(pml4, "freevm: no pml4");
   deallocuvm(pml4, 0, SZ_4G, 0);
   for(i = 0; i < PTRS_PER_PML4; i++){
+    if(i == PML4_INDEX(KSTACKBASE) || i == PML4_INDEX(CLOCKPAGE))
+      continue; // shared by all page tables
     if(pml4[i] & PTE_P){
       pdpte_t *pdpt = P2V(PDPT_ADDR(pml4[i]));
       freevm_pdpt(pdpt);
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/stat.h>
 
 typedef unsigned long  ulong;
 typedef unsigned int   uint;
@@ -14,6 +15,7 @@ typedef unsigned char  uchar;
 #include <inc/fs.h>
 #include <inc/stat.h>
 #include <inc/param.h>
+#undef stat
 
 #ifndef static_assert
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
@@ -23,27 +25,60 @@ typedef unsigned char  uchar;
 #define CONSOLE 1
 
 // Disk layout:
-// [ boot block | sb block | free bit map | inode file start | data blocks ]
+// [ boot block | sb block | free bit map | share counts | log | swap |
+//                                       inode file start | data blocks ]
+//
+// The inode file, the root directory and the free map are built in
+// memory and written once each at the end, and each file is written
+// in one go, so the image takes a handful of large writes.  The rest
+// of the image is left as a hole by ftruncate(), which reads as
+// zeroes.
+//
+// Every file is one extent, or inline in its dinode if it has at most
+// INLINESIZE bytes.  Free blocks can be left after the inode
+// file, the root directory and each file, so that the kernel, which
+// grows a file's last extent in place when the blocks after it are
+// free, keeps them contiguous as they grow.
+//
+//   mkfs [-m manifest] fs.img files...
+//
+// A manifest sizes these, one "name value" per line, # comments:
+//   inodes N     dinodes the inode file has room for (at least enough
+//                for the files given)
+//   log N        log blocks, the log super included (at most LOGSIZE)
+//   swap N       swap pages (at most SWAPPAGES)
+//   inodegap N   free blocks left after the inode file
+//   dirgap N     free blocks left after the root directory
+//   filegap N    free blocks left after each file
+
+int ninodes;                   // dinodes in the inode file
+int nlog = LOGSIZE;
+int nswap = SWAPPAGES;
+int inodegap = 64;
+int dirgap = 16;
+int filegap = 0;
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
+int nref = FSSIZE/BSIZE + 1;  // share count blocks, all zero: nothing is shared
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
 int fsfd;
 struct superblock sb;
-char zeroes[BSIZE];
 uint freeinode;
 uint freeblock;
 
+struct dinode *dinodes;        // the inode file
+char *rootdir;                 // the root directory's blocks
+uint rootdir_size;
+uchar *bitmap;                 // the free map
 
-void balloc(int);
+void manifest(char *path);
+void used(uint b, uint n);
 void wsect(uint, void*);
-void winode(uint, struct dinode*);
-void rinode(uint inum, struct dinode *ip);
-void rsect(uint sec, void *buf);
+void wblocks(uint, void*, uint);
 uint ialloc(ushort type);
-void iallocblocks(uint inum, int start, int numblks);
-void iappend(uint inum, void *p, int n);
+void dirent(uint inum, char *name);
 
 // convert to intel byte order
 ushort
@@ -71,21 +106,25 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
-  uint inodefileino, inodefileblkn;
-  uint rootino, rootdir_size, rootdir_blocks;
-  uint inum, off;
+  int i, fd;
+  uint inodefileblkn, rootdir_blocks;
+  uint rootino, inum, n, size;
   uint inum_count;
-  struct dirent de;
   char buf[BSIZE];
-  struct dinode din;
-  struct dinode *root;
+  char *data;
+  struct stat st;
+  struct dinode *din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
+  if(argc >= 3 && strcmp(argv[1], "-m") == 0){
+    manifest(argv[2]);
+    argv += 2;
+    argc -= 2;
+  }
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-m manifest] fs.img files...\n");
     exit(1);
   }
 
@@ -97,96 +136,74 @@ main(int argc, char *argv[])
     perror(argv[1]);
     exit(1);
   }
+  // All zeroes, without writing them
+  if(ftruncate(fsfd, (off_t)FSSIZE * BSIZE) < 0){
+    perror("ftruncate");
+    exit(1);
+  }
 
-  // // 1 fs block = 1 disk sector
-  // nmeta = 2 + nbitmap;
-  // nblocks = FSSIZE - nmeta;
-
-  // New
-  nmeta = 2 + nbitmap + LOGSIZE;
+  nmeta = 2 + nbitmap + nref + nlog + nswap * SWAPBLOCKS;
   nblocks = FSSIZE - nmeta;
 
-  // sb.size = xint(FSSIZE);
-  // sb.nblocks = xint(nblocks);
-  // sb.bmapstart = xint(2);
-  // sb.inodestart = xint(2+nbitmap);
-
-  // New
   sb.size = xint(FSSIZE);
   sb.nblocks = xint(nblocks);
   sb.bmapstart = xint(2);
-  sb.logstart = xint(2 + nbitmap);
-  sb.inodestart = xint(2 + nbitmap + LOGSIZE);
+  sb.refstart = xint(2 + nbitmap);
+  sb.nref = xint(nref);
+  sb.logstart = xint(2 + nbitmap + nref);
+  sb.nlog = xint(nlog);
+  sb.swapstart = xint(2 + nbitmap + nref + nlog);
+  sb.nswap = xint(nswap * SWAPBLOCKS);
+  sb.inodestart = xint(nmeta);
+  sb.magic = xint(FSMAGIC);
+  sb.version = xint(FSVERSION);
+  sb.bsize = xint(BSIZE);
 
   printf("nmeta %d (boot, super, bitmap blocks %u) blocks %d total %d\n",
        nmeta, nbitmap, nblocks, FSSIZE);
+  bitmap = calloc(nbitmap, BSIZE);
+  used(0, nmeta);
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
-    wsect(i, zeroes);
-
   memset(buf, 0, sizeof(buf));
   memmove(buf, &sb, sizeof(sb));
   wsect(1, buf);
 
   inum_count = argc + 1; // argc - 2 files + 1 inode file + 1 root dir + console
   printf("inum_count %d\n", inum_count);
-
-  inodefileino = ialloc(T_FILE);
-  assert(inodefileino == INODEFILEINO);
+  if(ninodes < inum_count)
+    ninodes = inum_count;
 
   // setup inode file data area
-  rinode(inodefileino, &din);
-  din.extent_array[0].startblkno = sb.inodestart;
-  inodefileblkn = inum_count/IPB;
-  if (inodefileblkn == 0 || (inum_count * sizeof(struct dinode) % BSIZE))
-    inodefileblkn++;
-  din.extent_array[0].nblocks = xint(inodefileblkn);
-  din.size = xint(inum_count * sizeof(struct dinode));
-
-  // New: set up inode file num_extents
-  din.num_extents = 1;
-  din.used = DINODE_USED;
-
-  winode(inodefileino, &din);
-
-  // these blocks are no longer free
-  freeblock += inodefileblkn;
+  inodefileblkn = (ninodes * sizeof(struct dinode) + BSIZE - 1) / BSIZE;
+  dinodes = calloc(inodefileblkn * IPB, sizeof(struct dinode));
+  assert(ialloc(T_FILE) == INODEFILEINO);
+  din = &dinodes[INODEFILEINO];
+  din->extent_array[0].startblkno = xint(freeblock);
+  din->extent_array[0].nblocks = xint(inodefileblkn);
+  din->size = xint(ninodes * sizeof(struct dinode));
+  used(freeblock, inodefileblkn);
+  freeblock += inodefileblkn + inodegap;
 
   // now add the root directory
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
   // argc - 2 directory entries + 2 for '.' and '..' + 1 for console
-  rootdir_size = ((argc + 1) * sizeof(struct dirent));
-  rootdir_blocks = rootdir_size / BSIZE;
-	if (rootdir_size % BSIZE)
-		rootdir_blocks += 1;
-  iallocblocks(rootino, freeblock, rootdir_blocks);
-  freeblock += rootdir_blocks;
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
+  rootdir_blocks = ((argc + 1) * sizeof(struct dirent) + BSIZE - 1) / BSIZE;
+  rootdir = calloc(rootdir_blocks, BSIZE);
+  din = &dinodes[rootino];
+  din->extent_array[0].startblkno = xint(freeblock);
+  din->extent_array[0].nblocks = xint(rootdir_blocks);
+  used(freeblock, rootdir_blocks);
+  freeblock += rootdir_blocks + dirgap;
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  dirent(rootino, ".");
+  dirent(rootino, "..");
 
   inum = ialloc(T_DEV);
-  rinode(inum, &din);
-  din.devid = xshort(CONSOLE);
-  // New: update new dinode fields
-  din.num_extents = 1;
-  din.used = DINODE_USED;
-  winode(inum, &din);
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(inum);
-  strncpy(de.name, "console", DIRSIZ);
-  iappend(rootino, &de, sizeof(de));
+  dinodes[inum].devid = xshort(CONSOLE);
+  dirent(inum, "console");
 
   for(i = 2; i < argc; i++){
     char *name = argv[i];
@@ -196,7 +213,7 @@ main(int argc, char *argv[])
 
     assert(index(name, '/') == 0);
 
-    if((fd = open(argv[i], 0)) < 0){
+    if((fd = open(argv[i], 0)) < 0 || fstat(fd, &st) < 0){
       perror(argv[i]);
       exit(1);
     }
@@ -209,105 +226,117 @@ main(int argc, char *argv[])
       ++name;
 
     inum = ialloc(T_FILE);
+    dirent(inum, name);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, name, DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
-
-    rinode(inum, &din);
-    din.extent_array[0].startblkno = xint(freeblock);
-    // New: update new dinode fields
-    din.num_extents = 1;
-    din.used = DINODE_USED;
-		winode(inum, &din);
-
-    while((cc = read(fd, buf, sizeof(buf))) > 0)
-      iappend(inum, buf, cc);
-
-    rinode(inum, &din);
-    din.extent_array[0].nblocks = xint(xint(din.size) / BSIZE + (xint(din.size) % BSIZE == 0 ? 0 : 1));
-    freeblock += xint(din.extent_array[0].nblocks);
+    size = st.st_size;
+    n = (size + BSIZE - 1) / BSIZE;
+    if(freeblock + n > FSSIZE){
+      fprintf(stderr, "mkfs: files do not fit in %d blocks\n", FSSIZE);
+      exit(1);
+    }
+    if((data = calloc(n + 1, BSIZE)) == 0 || read(fd, data, size) != size){
+      perror(argv[i]);
+      exit(1);
+    }
+    din = &dinodes[inum];
+    if(size <= INLINESIZE){
+      memmove(din->extent_array, data, size);
+      din->num_extents = 0;
+      din->used = DINODE_USED | DINODE_INLINE;
+      din->size = xint(size);
+      free(data);
+      close(fd);
+      printf("inum: %d name: %s size %d inline\n", inum, name, size);
+      continue;
+    }
+    wblocks(freeblock, data, n);
+    free(data);
+    close(fd);
 
-    // New: update new dinode fields
-    din.num_extents = 1;
-    din.used = DINODE_USED;
-    winode(inum, &din);
+    din->extent_array[0].startblkno = xint(freeblock);
+    din->extent_array[0].nblocks = xint(n);
+    din->size = xint(size);
+    used(freeblock, n);
+    freeblock += n + filegap;
 
 		printf("inum: %d name: %s size %d start: %d nblocks: %d\n",
-        inum, name, xint(din.size), xint(din.extent_array[0].startblkno), xint(din.extent_array[0].nblocks));
-    close(fd);
+        inum, name, size, xint(din->extent_array[0].startblkno), n);
   }
 
-
-
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  din.size = xint(rootdir_size);
-
-  // New: added the new fields for dinode
-  din.num_extents = 1;
-  din.used = DINODE_USED;
-  winode(rootino, &din);
-
-  rinode(inum, &din);
-  printf("inum: %d size %d start: %d nblocks: %d\n",
-      inum,xint(din.size), xint(din.extent_array[0].startblkno), xint(din.extent_array[0].nblocks));
-
-  balloc(freeblock);
+  dinodes[rootino].size = xint(rootdir_size);
+  wblocks(xint(dinodes[rootino].extent_array[0].startblkno), rootdir,
+          rootdir_blocks);
+  wblocks(xint(sb.inodestart), dinodes, inodefileblkn);
+  wblocks(xint(sb.bmapstart), bitmap, nbitmap);
 
   exit(0);
 }
 
+// Read the sizes in a manifest.
 void
-wsect(uint sec, void *buf)
+manifest(char *path)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
-    perror("lseek");
+  FILE *f;
+  char line[128], name[32];
+  int n, val;
+
+  if((f = fopen(path, "r")) == 0){
+    perror(path);
     exit(1);
   }
-  if(write(fsfd, buf, BSIZE) != BSIZE){
-    perror("write");
+  while(fgets(line, sizeof(line), f)){
+    n = sscanf(line, "%31s %d", name, &val);
+    if(n < 1 || name[0] == '#')
+      continue;
+    if(n != 2 || val < 0){
+      fprintf(stderr, "%s: bad line: %s", path, line);
+      exit(1);
+    }
+    if(strcmp(name, "inodes") == 0)
+      ninodes = val;
+    else if(strcmp(name, "log") == 0)
+      nlog = val;
+    else if(strcmp(name, "swap") == 0)
+      nswap = val;
+    else if(strcmp(name, "inodegap") == 0)
+      inodegap = val;
+    else if(strcmp(name, "dirgap") == 0)
+      dirgap = val;
+    else if(strcmp(name, "filegap") == 0)
+      filegap = val;
+    else {
+      fprintf(stderr, "%s: unknown size %s\n", path, name);
+      exit(1);
+    }
+  }
+  fclose(f);
+  if(nlog < 2 || nlog > LOGSIZE || nswap > SWAPPAGES){
+    fprintf(stderr, "%s: log must be 2 to %d blocks, swap at most %d pages\n",
+            path, LOGSIZE, SWAPPAGES);
     exit(1);
   }
 }
 
+// Mark blocks [b, b + n) in use.
 void
-winode(uint inum, struct dinode *ip)
+used(uint b, uint n)
 {
-  char buf[BSIZE];
-  uint bn;
-  struct dinode *dip;
-
-  bn = xint(sb.inodestart) + (INODEOFF(inum) / BSIZE);
-  rsect(bn, buf);
-  dip = ((struct dinode*)buf) + (inum % IPB);
-  *dip = *ip;
-  wsect(bn, buf);
+  for(; n > 0; b++, n--)
+    bitmap[b/8] |= 0x1 << (b%8);
 }
 
 void
-rinode(uint inum, struct dinode *ip)
+wsect(uint sec, void *buf)
 {
-  char buf[BSIZE];
-  uint off, bn;
-  struct dinode *dip;
-
-  bn = xint(sb.inodestart) + (INODEOFF(inum) / BSIZE);
-  rsect(bn, buf);
-  dip = ((struct dinode*)buf) + (inum % IPB);
-  *ip = *dip;
+  wblocks(sec, buf, 1);
 }
 
+// Write n blocks from buf starting at block b.
 void
-rsect(uint sec, void *buf)
+wblocks(uint b, void *buf, uint n)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
-    perror("lseek");
-    exit(1);
-  }
-  if(read(fsfd, buf, BSIZE) != BSIZE){
-    perror("read");
+  if(pwrite(fsfd, buf, (size_t)n * BSIZE, (off_t)b * BSIZE) != (ssize_t)n * BSIZE){
+    perror("write");
     exit(1);
   }
 }
@@ -316,69 +345,26 @@ uint
 ialloc(ushort type)
 {
   uint inum = freeinode++;
-  struct dinode din;
-
-  bzero(&din, sizeof(din));
-  din.type = xshort(type);
-  din.size = xint(0);
-  winode(inum, &din);
+  struct dinode *din;
+
+  assert(inum < ninodes);
+  din = &dinodes[inum];
+  din->type = xshort(type);
+  din->size = xint(0);
+  din->num_extents = 1;
+  din->used = DINODE_USED;
   return inum;
 }
 
-#define min(a, b) ((a) < (b) ? (a) : (b))
-
+// Add an entry for inum to the root directory.
 void
-balloc(int used)
+dirent(uint inum, char *name)
 {
-  uchar buf[BSIZE];
-  int nbuf = 0;
-  int i;
-  int remaining = used;
-
-  printf("balloc: first %d blocks have been allocated\n", used);
-
-  while (remaining > 0) {
-    bzero(buf, BSIZE);
-    for(i = 0; i < min(remaining, BSIZE*8); i++){
-      buf[i/8] = buf[i/8] | (0x1 << (i%8));
-    }
-    printf("balloc: write bitmap block at sector %d\n", sb.bmapstart + nbuf);
-    wsect(sb.bmapstart + nbuf, buf);
-    nbuf ++;
-    remaining -= BSIZE * 8;
-  }
-}
-
-void
-iallocblocks(uint inum, int start, int numblks) {
-  struct dinode din;
-  rinode(inum, &din);
-  din.extent_array[0].startblkno = xint(start);
-  din.extent_array[0].nblocks = xint(numblks);
-  winode(inum, &din);
-}
-
-void
-iappend(uint inum, void *xp, int n)
-{
-  char *p = (char*)xp;
-  uint fbn, off, n1;
-  struct dinode din;
-  char buf[BSIZE];
+  struct dirent de;
 
-  rinode(inum, &din);
-  off = xint(din.size);
-  printf("append inum %d at off %d sz %d\n", inum, off, n);
-  while(n > 0){
-    fbn = off / BSIZE;
-    n1 = min(n, (fbn + 1) * BSIZE - off);
-    rsect(xint(din.extent_array[0].startblkno) + fbn, buf);
-    bcopy(p, buf + off - (fbn * BSIZE), n1);
-    wsect(xint(din.extent_array[0].startblkno) + fbn, buf);
-    n -= n1;
-    off += n1;
-    p += n1;
-  }
-  din.size = xint(off);
-  winode(inum, &din);
+  bzero(&de, sizeof(de));
+  de.inum = xshort(inum);
+  strncpy(de.name, name, DIRSIZ);
+  memmove(rootdir + rootdir_size, &de, sizeof(de));
+  rootdir_size += sizeof(de);
 }
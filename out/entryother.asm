@@ -0,0 +1,80 @@
+
+out/entryother.o:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <start>:
+   0:	fa                   	cli
+   1:	fc                   	cld
+   2:	31 c0                	xor    %eax,%eax
+   4:	8e d8                	mov    %eax,%ds
+   6:	8e c0                	mov    %eax,%es
+   8:	8e d0                	mov    %eax,%ss
+   a:	0f 01 16             	lgdt   (%rsi)
+   d:	00 00                	add    %al,(%rax)
+   f:	0f 20 c0             	mov    %cr0,%rax
+  12:	66 83 c8 01          	or     $0x1,%ax
+  16:	0f 22 c0             	mov    %rax,%cr0
+  19:	66 ea                	data16 (bad)
+  1b:	00 00                	add    %al,(%rax)
+  1d:	00 00                	add    %al,(%rax)
+  1f:	18 00                	sbb    %al,(%rax)
+
+0000000000000021 <start32>:
+  21:	66 b8 10 00          	mov    $0x10,%ax
+  25:	8e d8                	mov    %eax,%ds
+  27:	8e c0                	mov    %eax,%es
+  29:	8e d0                	mov    %eax,%ss
+  2b:	0f 20 e0             	mov    %cr4,%rax
+  2e:	83 c8 20             	or     $0x20,%eax
+  31:	0f 22 e0             	mov    %rax,%cr4
+  34:	a1 e0 6f 00 00 0f 22 	movabs 0xb9d8220f00006fe0,%eax
+  3b:	d8 b9 
+  3d:	80 00 00             	addb   $0x0,(%rax)
+  40:	c0 0f 32             	rorb   $0x32,(%rdi)
+  43:	0d 00 01 00 00       	or     $0x100,%eax
+  48:	0f 30                	wrmsr
+  4a:	0f 20 c0             	mov    %cr0,%rax
+  4d:	0d 00 00 01 80       	or     $0x80010000,%eax
+  52:	0f 22 c0             	mov    %rax,%cr0
+  55:	ea                   	(bad)
+  56:	00 00                	add    %al,(%rax)
+  58:	00 00                	add    %al,(%rax)
+  5a:	08 00                	or     %al,(%rax)
+
+000000000000005c <start64>:
+  5c:	48 c7 c0 00 00 00 00 	mov    $0x0,%rax
+  63:	ff e0                	jmp    *%rax
+
+0000000000000065 <high>:
+  65:	48 8b 04 25 e8 6f 00 	mov    0xffffffff80006fe8,%rax
+  6c:	80 
+  6d:	0f 22 d8             	mov    %rax,%cr3
+  70:	48 8b 24 25 f8 6f 00 	mov    0xffffffff80006ff8,%rsp
+  77:	80 
+  78:	48 8b 04 25 f0 6f 00 	mov    0xffffffff80006ff0,%rax
+  7f:	80 
+  80:	ff d0                	call   *%rax
+
+0000000000000082 <spin>:
+  82:	f4                   	hlt
+  83:	eb fd                	jmp    82 <spin>
+  85:	0f 1f 00             	nopl   (%rax)
+
+0000000000000088 <gdt>:
+	...
+  94:	00 9b a0 00 ff ff    	add    %bl,-0xff60(%rbx)
+  9a:	00 00                	add    %al,(%rax)
+  9c:	00 92 cf 00 ff ff    	add    %dl,-0xff31(%rdx)
+  a2:	00 00                	add    %al,(%rax)
+  a4:	00                   	.byte 0x0
+  a5:	9a                   	(bad)
+  a6:	cf                   	iret
+	...
+
+00000000000000a8 <gdtdesc>:
+  a8:	1f                   	(bad)
+  a9:	00 00                	add    %al,(%rax)
+  ab:	00 00                	add    %al,(%rax)
+	...
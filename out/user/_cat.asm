@@ -0,0 +1,3496 @@
+
+out/user/_cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <cat>:
+#include <stat.h>
+#include <user.h>
+
+char buf[512];
+
+void cat(int fd) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 30          	sub    $0x30,%rsp
+       8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct stat st;
+  int n;
+
+  // A file goes to the output inside the kernel, after anything
+  // already buffered for it; a pipe or device goes through buf
+  if (fstat(fd, &st) == 0 && st.type == T_FILE) {
+       b:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+       f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      12:	48 89 d6             	mov    %rdx,%rsi
+      15:	89 c7                	mov    %eax,%edi
+      17:	e8 96 14 00 00       	call   14b2 <fstat>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	0f 85 9f 00 00 00    	jne    c3 <cat+0xc3>
+      24:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+      28:	66 83 f8 02          	cmp    $0x2,%ax
+      2c:	0f 85 91 00 00 00    	jne    c3 <cat+0xc3>
+    bflush(1);
+      32:	bf 01 00 00 00       	mov    $0x1,%edi
+      37:	e8 d5 06 00 00       	call   711 <bflush>
+    while ((n = sendfile(1, fd, -1, 1 << 30)) > 0)
+      3c:	90                   	nop
+      3d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      40:	b9 00 00 00 40       	mov    $0x40000000,%ecx
+      45:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+      4a:	89 c6                	mov    %eax,%esi
+      4c:	bf 01 00 00 00       	mov    $0x1,%edi
+      51:	e8 2d 15 00 00       	call   1583 <sendfile>
+      56:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      59:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      5d:	7f de                	jg     3d <cat+0x3d>
+      ;
+    if (n < 0) {
+      5f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      63:	0f 89 a0 00 00 00    	jns    109 <cat+0x109>
+      printf(1, "cat: write error\n");
+      69:	48 8d 05 28 1f 00 00 	lea    0x1f28(%rip),%rax        # 1f98 <benchreport+0x146>
+      70:	48 89 c6             	mov    %rax,%rsi
+      73:	bf 01 00 00 00       	mov    $0x1,%edi
+      78:	b8 00 00 00 00       	mov    $0x0,%eax
+      7d:	e8 03 03 00 00       	call   385 <printf>
+      exit();
+      82:	e8 2e 09 00 00       	call   9b5 <exit>
+    }
+    return;
+  }
+
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+    if (bwrite(1, buf, n) != n) {
+      87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8a:	89 c2                	mov    %eax,%edx
+      8c:	48 8d 05 ad 2f 00 00 	lea    0x2fad(%rip),%rax        # 3040 <buf>
+      93:	48 89 c6             	mov    %rax,%rsi
+      96:	bf 01 00 00 00       	mov    $0x1,%edi
+      9b:	e8 23 07 00 00       	call   7c3 <bwrite>
+      a0:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+      a3:	74 1e                	je     c3 <cat+0xc3>
+      printf(1, "cat: write error\n");
+      a5:	48 8d 05 ec 1e 00 00 	lea    0x1eec(%rip),%rax        # 1f98 <benchreport+0x146>
+      ac:	48 89 c6             	mov    %rax,%rsi
+      af:	bf 01 00 00 00       	mov    $0x1,%edi
+      b4:	b8 00 00 00 00       	mov    $0x0,%eax
+      b9:	e8 c7 02 00 00       	call   385 <printf>
+      exit();
+      be:	e8 f2 08 00 00       	call   9b5 <exit>
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+      c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      c6:	ba 00 02 00 00       	mov    $0x200,%edx
+      cb:	48 8d 0d 6e 2f 00 00 	lea    0x2f6e(%rip),%rcx        # 3040 <buf>
+      d2:	48 89 ce             	mov    %rcx,%rsi
+      d5:	89 c7                	mov    %eax,%edi
+      d7:	e8 7e 13 00 00       	call   145a <read>
+      dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      e3:	7f a2                	jg     87 <cat+0x87>
+    }
+  }
+  if (n < 0) {
+      e5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      e9:	79 1f                	jns    10a <cat+0x10a>
+    printf(1, "cat: read error\n");
+      eb:	48 8d 05 b8 1e 00 00 	lea    0x1eb8(%rip),%rax        # 1faa <benchreport+0x158>
+      f2:	48 89 c6             	mov    %rax,%rsi
+      f5:	bf 01 00 00 00       	mov    $0x1,%edi
+      fa:	b8 00 00 00 00       	mov    $0x0,%eax
+      ff:	e8 81 02 00 00       	call   385 <printf>
+    exit();
+     104:	e8 ac 08 00 00       	call   9b5 <exit>
+    return;
+     109:	90                   	nop
+  }
+}
+     10a:	c9                   	leave
+     10b:	c3                   	ret
+
+000000000000010c <main>:
+
+int main(int argc, char *argv[]) {
+     10c:	55                   	push   %rbp
+     10d:	48 89 e5             	mov    %rsp,%rbp
+     110:	48 83 ec 20          	sub    $0x20,%rsp
+     114:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     117:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if (argc <= 1) {
+     11b:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     11f:	7f 0f                	jg     130 <main+0x24>
+    cat(0);
+     121:	bf 00 00 00 00       	mov    $0x0,%edi
+     126:	e8 d5 fe ff ff       	call   0 <cat>
+    exit();
+     12b:	e8 85 08 00 00       	call   9b5 <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+     130:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     137:	eb 7d                	jmp    1b6 <main+0xaa>
+    if ((fd = open(argv[i], 0)) < 0) {
+     139:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     13c:	48 98                	cltq
+     13e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     145:	00 
+     146:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     14a:	48 01 d0             	add    %rdx,%rax
+     14d:	48 8b 00             	mov    (%rax),%rax
+     150:	be 00 00 00 00       	mov    $0x0,%esi
+     155:	48 89 c7             	mov    %rax,%rdi
+     158:	e8 34 13 00 00       	call   1491 <open>
+     15d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     160:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     164:	79 38                	jns    19e <main+0x92>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+     166:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     169:	48 98                	cltq
+     16b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     172:	00 
+     173:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     177:	48 01 d0             	add    %rdx,%rax
+     17a:	48 8b 00             	mov    (%rax),%rax
+     17d:	48 89 c2             	mov    %rax,%rdx
+     180:	48 8d 05 34 1e 00 00 	lea    0x1e34(%rip),%rax        # 1fbb <benchreport+0x169>
+     187:	48 89 c6             	mov    %rax,%rsi
+     18a:	bf 01 00 00 00       	mov    $0x1,%edi
+     18f:	b8 00 00 00 00       	mov    $0x0,%eax
+     194:	e8 ec 01 00 00       	call   385 <printf>
+      exit();
+     199:	e8 17 08 00 00       	call   9b5 <exit>
+    }
+    cat(fd);
+     19e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1a1:	89 c7                	mov    %eax,%edi
+     1a3:	e8 58 fe ff ff       	call   0 <cat>
+    close(fd);
+     1a8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1ab:	89 c7                	mov    %eax,%edi
+     1ad:	e8 6d 08 00 00       	call   a1f <close>
+  for (i = 1; i < argc; i++) {
+     1b2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1b9:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     1bc:	0f 8c 77 ff ff ff    	jl     139 <main+0x2d>
+  }
+  exit();
+     1c2:	e8 ee 07 00 00       	call   9b5 <exit>
+
+00000000000001c7 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     1c7:	55                   	push   %rbp
+     1c8:	48 89 e5             	mov    %rsp,%rbp
+     1cb:	48 83 ec 10          	sub    $0x10,%rsp
+     1cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     1d2:	89 f0                	mov    %esi,%eax
+     1d4:	88 45 f8             	mov    %al,-0x8(%rbp)
+     1d7:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     1db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1de:	89 d6                	mov    %edx,%esi
+     1e0:	89 c7                	mov    %eax,%edi
+     1e2:	e8 eb 06 00 00       	call   8d2 <bputc>
+     1e7:	90                   	nop
+     1e8:	c9                   	leave
+     1e9:	c3                   	ret
+
+00000000000001ea <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     1ea:	55                   	push   %rbp
+     1eb:	48 89 e5             	mov    %rsp,%rbp
+     1ee:	48 83 ec 50          	sub    $0x50,%rsp
+     1f2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     1f5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     1f9:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     1fc:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     1ff:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     203:	74 21                	je     226 <printint64+0x3c>
+     205:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     209:	48 c1 e8 3f          	shr    $0x3f,%rax
+     20d:	0f b6 c0             	movzbl %al,%eax
+     210:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     213:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     217:	74 0d                	je     226 <printint64+0x3c>
+    x = -xx;
+     219:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     21d:	48 f7 d8             	neg    %rax
+     220:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     224:	eb 08                	jmp    22e <printint64+0x44>
+  else
+    x = xx;
+     226:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     22a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     22e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     235:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     238:	48 63 c8             	movslq %eax,%rcx
+     23b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     23f:	ba 00 00 00 00       	mov    $0x0,%edx
+     244:	48 f7 f1             	div    %rcx
+     247:	48 89 d1             	mov    %rdx,%rcx
+     24a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     24d:	8d 50 01             	lea    0x1(%rax),%edx
+     250:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     253:	48 8d 15 a6 2d 00 00 	lea    0x2da6(%rip),%rdx        # 3000 <digits.1>
+     25a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     25e:	48 98                	cltq
+     260:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     264:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     267:	48 63 f0             	movslq %eax,%rsi
+     26a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     26e:	ba 00 00 00 00       	mov    $0x0,%edx
+     273:	48 f7 f6             	div    %rsi
+     276:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     27a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     27f:	75 b4                	jne    235 <printint64+0x4b>
+
+  if (sgn)
+     281:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     285:	74 2b                	je     2b2 <printint64+0xc8>
+    buf[i++] = '-';
+     287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     28a:	8d 50 01             	lea    0x1(%rax),%edx
+     28d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     290:	48 98                	cltq
+     292:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     297:	eb 19                	jmp    2b2 <printint64+0xc8>
+    putc(fd, buf[i]);
+     299:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     29c:	48 98                	cltq
+     29e:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     2a3:	0f be d0             	movsbl %al,%edx
+     2a6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     2a9:	89 d6                	mov    %edx,%esi
+     2ab:	89 c7                	mov    %eax,%edi
+     2ad:	e8 15 ff ff ff       	call   1c7 <putc>
+  while (--i >= 0)
+     2b2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     2b6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2ba:	79 dd                	jns    299 <printint64+0xaf>
+}
+     2bc:	90                   	nop
+     2bd:	90                   	nop
+     2be:	c9                   	leave
+     2bf:	c3                   	ret
+
+00000000000002c0 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     2c0:	55                   	push   %rbp
+     2c1:	48 89 e5             	mov    %rsp,%rbp
+     2c4:	48 83 ec 30          	sub    $0x30,%rsp
+     2c8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     2cb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     2ce:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     2d1:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     2d4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     2db:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     2df:	74 17                	je     2f8 <printint+0x38>
+     2e1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     2e5:	79 11                	jns    2f8 <printint+0x38>
+    neg = 1;
+     2e7:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     2ee:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2f1:	f7 d8                	neg    %eax
+     2f3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     2f6:	eb 06                	jmp    2fe <printint+0x3e>
+  } else {
+    x = xx;
+     2f8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2fb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     2fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     305:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     308:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     30b:	ba 00 00 00 00       	mov    $0x0,%edx
+     310:	f7 f1                	div    %ecx
+     312:	89 d1                	mov    %edx,%ecx
+     314:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     317:	8d 50 01             	lea    0x1(%rax),%edx
+     31a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     31d:	89 c9                	mov    %ecx,%ecx
+     31f:	48 8d 15 fa 2c 00 00 	lea    0x2cfa(%rip),%rdx        # 3020 <digits.0>
+     326:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     32a:	48 98                	cltq
+     32c:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     330:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     333:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     336:	ba 00 00 00 00       	mov    $0x0,%edx
+     33b:	f7 f6                	div    %esi
+     33d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     340:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     344:	75 bf                	jne    305 <printint+0x45>
+  if (neg)
+     346:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     34a:	74 2b                	je     377 <printint+0xb7>
+    buf[i++] = '-';
+     34c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     34f:	8d 50 01             	lea    0x1(%rax),%edx
+     352:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     355:	48 98                	cltq
+     357:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     35c:	eb 19                	jmp    377 <printint+0xb7>
+    putc(fd, buf[i]);
+     35e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     361:	48 98                	cltq
+     363:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     368:	0f be d0             	movsbl %al,%edx
+     36b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     36e:	89 d6                	mov    %edx,%esi
+     370:	89 c7                	mov    %eax,%edi
+     372:	e8 50 fe ff ff       	call   1c7 <putc>
+  while (--i >= 0)
+     377:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     37b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     37f:	79 dd                	jns    35e <printint+0x9e>
+}
+     381:	90                   	nop
+     382:	90                   	nop
+     383:	c9                   	leave
+     384:	c3                   	ret
+
+0000000000000385 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     385:	55                   	push   %rbp
+     386:	48 89 e5             	mov    %rsp,%rbp
+     389:	48 83 ec 70          	sub    $0x70,%rsp
+     38d:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     390:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     394:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     398:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     39c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     3a0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     3a4:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     3ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     3af:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     3b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     3b7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     3bb:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     3c2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     3c9:	e9 67 02 00 00       	jmp    635 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     3ce:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     3d1:	48 63 d0             	movslq %eax,%rdx
+     3d4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     3d8:	48 01 d0             	add    %rdx,%rax
+     3db:	0f b6 00             	movzbl (%rax),%eax
+     3de:	0f be c0             	movsbl %al,%eax
+     3e1:	25 ff 00 00 00       	and    $0xff,%eax
+     3e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     3e9:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     3ed:	75 30                	jne    41f <printf+0x9a>
+      if (c == '%') {
+     3ef:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     3f3:	75 13                	jne    408 <printf+0x83>
+        state = '%';
+     3f5:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     3fc:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     403:	e9 29 02 00 00       	jmp    631 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     408:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     40b:	0f be d0             	movsbl %al,%edx
+     40e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     411:	89 d6                	mov    %edx,%esi
+     413:	89 c7                	mov    %eax,%edi
+     415:	e8 ad fd ff ff       	call   1c7 <putc>
+     41a:	e9 12 02 00 00       	jmp    631 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     41f:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     423:	0f 85 08 02 00 00    	jne    631 <printf+0x2ac>
+      if (c == 'l') {
+     429:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     42d:	75 0c                	jne    43b <printf+0xb6>
+        lflag = 1;
+     42f:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     436:	e9 f6 01 00 00       	jmp    631 <printf+0x2ac>
+      } else if (c == 'd') {
+     43b:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     43f:	0f 85 93 00 00 00    	jne    4d8 <printf+0x153>
+        if (lflag == 1)
+     445:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     449:	75 47                	jne    492 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     44b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     44e:	83 f8 2f             	cmp    $0x2f,%eax
+     451:	77 17                	ja     46a <printf+0xe5>
+     453:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     457:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     45a:	89 d2                	mov    %edx,%edx
+     45c:	48 01 d0             	add    %rdx,%rax
+     45f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     462:	83 c2 08             	add    $0x8,%edx
+     465:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     468:	eb 0c                	jmp    476 <printf+0xf1>
+     46a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     46e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     472:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     476:	48 8b 30             	mov    (%rax),%rsi
+     479:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     47c:	b9 01 00 00 00       	mov    $0x1,%ecx
+     481:	ba 0a 00 00 00       	mov    $0xa,%edx
+     486:	89 c7                	mov    %eax,%edi
+     488:	e8 5d fd ff ff       	call   1ea <printint64>
+     48d:	e9 98 01 00 00       	jmp    62a <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     492:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     495:	83 f8 2f             	cmp    $0x2f,%eax
+     498:	77 17                	ja     4b1 <printf+0x12c>
+     49a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     49e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4a1:	89 d2                	mov    %edx,%edx
+     4a3:	48 01 d0             	add    %rdx,%rax
+     4a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4a9:	83 c2 08             	add    $0x8,%edx
+     4ac:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4af:	eb 0c                	jmp    4bd <printf+0x138>
+     4b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4b5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4b9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4bd:	8b 30                	mov    (%rax),%esi
+     4bf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4c7:	ba 0a 00 00 00       	mov    $0xa,%edx
+     4cc:	89 c7                	mov    %eax,%edi
+     4ce:	e8 ed fd ff ff       	call   2c0 <printint>
+     4d3:	e9 52 01 00 00       	jmp    62a <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     4d8:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     4dc:	74 0a                	je     4e8 <printf+0x163>
+     4de:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     4e2:	0f 85 93 00 00 00    	jne    57b <printf+0x1f6>
+        if (lflag == 1)
+     4e8:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     4ec:	75 47                	jne    535 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     4ee:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4f1:	83 f8 2f             	cmp    $0x2f,%eax
+     4f4:	77 17                	ja     50d <printf+0x188>
+     4f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4fd:	89 d2                	mov    %edx,%edx
+     4ff:	48 01 d0             	add    %rdx,%rax
+     502:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     505:	83 c2 08             	add    $0x8,%edx
+     508:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     50b:	eb 0c                	jmp    519 <printf+0x194>
+     50d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     511:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     515:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     519:	48 8b 30             	mov    (%rax),%rsi
+     51c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     51f:	b9 00 00 00 00       	mov    $0x0,%ecx
+     524:	ba 10 00 00 00       	mov    $0x10,%edx
+     529:	89 c7                	mov    %eax,%edi
+     52b:	e8 ba fc ff ff       	call   1ea <printint64>
+        if (lflag == 1)
+     530:	e9 f5 00 00 00       	jmp    62a <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     535:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     538:	83 f8 2f             	cmp    $0x2f,%eax
+     53b:	77 17                	ja     554 <printf+0x1cf>
+     53d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     541:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     544:	89 d2                	mov    %edx,%edx
+     546:	48 01 d0             	add    %rdx,%rax
+     549:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     54c:	83 c2 08             	add    $0x8,%edx
+     54f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     552:	eb 0c                	jmp    560 <printf+0x1db>
+     554:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     558:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     55c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     560:	8b 30                	mov    (%rax),%esi
+     562:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     565:	b9 00 00 00 00       	mov    $0x0,%ecx
+     56a:	ba 10 00 00 00       	mov    $0x10,%edx
+     56f:	89 c7                	mov    %eax,%edi
+     571:	e8 4a fd ff ff       	call   2c0 <printint>
+        if (lflag == 1)
+     576:	e9 af 00 00 00       	jmp    62a <printf+0x2a5>
+      } else if (c == 's') {
+     57b:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     57f:	75 6e                	jne    5ef <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     581:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     584:	83 f8 2f             	cmp    $0x2f,%eax
+     587:	77 17                	ja     5a0 <printf+0x21b>
+     589:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     58d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     590:	89 d2                	mov    %edx,%edx
+     592:	48 01 d0             	add    %rdx,%rax
+     595:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     598:	83 c2 08             	add    $0x8,%edx
+     59b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     59e:	eb 0c                	jmp    5ac <printf+0x227>
+     5a0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     5a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     5a8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     5ac:	48 8b 00             	mov    (%rax),%rax
+     5af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     5b3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     5b8:	75 28                	jne    5e2 <printf+0x25d>
+          s = "(null)";
+     5ba:	48 8d 05 0f 1a 00 00 	lea    0x1a0f(%rip),%rax        # 1fd0 <benchreport+0x17e>
+     5c1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     5c5:	eb 1b                	jmp    5e2 <printf+0x25d>
+          putc(fd, *s);
+     5c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     5cb:	0f b6 00             	movzbl (%rax),%eax
+     5ce:	0f be d0             	movsbl %al,%edx
+     5d1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5d4:	89 d6                	mov    %edx,%esi
+     5d6:	89 c7                	mov    %eax,%edi
+     5d8:	e8 ea fb ff ff       	call   1c7 <putc>
+        for (; *s; s++)
+     5dd:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     5e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     5e6:	0f b6 00             	movzbl (%rax),%eax
+     5e9:	84 c0                	test   %al,%al
+     5eb:	75 da                	jne    5c7 <printf+0x242>
+     5ed:	eb 3b                	jmp    62a <printf+0x2a5>
+      } else if (c == '%') {
+     5ef:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     5f3:	75 14                	jne    609 <printf+0x284>
+        putc(fd, c);
+     5f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     5f8:	0f be d0             	movsbl %al,%edx
+     5fb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5fe:	89 d6                	mov    %edx,%esi
+     600:	89 c7                	mov    %eax,%edi
+     602:	e8 c0 fb ff ff       	call   1c7 <putc>
+     607:	eb 21                	jmp    62a <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     609:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     60c:	be 25 00 00 00       	mov    $0x25,%esi
+     611:	89 c7                	mov    %eax,%edi
+     613:	e8 af fb ff ff       	call   1c7 <putc>
+        putc(fd, c);
+     618:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     61b:	0f be d0             	movsbl %al,%edx
+     61e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     621:	89 d6                	mov    %edx,%esi
+     623:	89 c7                	mov    %eax,%edi
+     625:	e8 9d fb ff ff       	call   1c7 <putc>
+      }
+      state = 0;
+     62a:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     631:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     635:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     638:	48 63 d0             	movslq %eax,%rdx
+     63b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     63f:	48 01 d0             	add    %rdx,%rax
+     642:	0f b6 00             	movzbl (%rax),%eax
+     645:	84 c0                	test   %al,%al
+     647:	0f 85 81 fd ff ff    	jne    3ce <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     64d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     650:	89 c7                	mov    %eax,%edi
+     652:	e8 ee 02 00 00       	call   945 <bflushtty>
+}
+     657:	90                   	nop
+     658:	c9                   	leave
+     659:	c3                   	ret
+
+000000000000065a <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     65a:	55                   	push   %rbp
+     65b:	48 89 e5             	mov    %rsp,%rbp
+     65e:	48 83 ec 30          	sub    $0x30,%rsp
+     662:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     665:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     669:	78 06                	js     671 <getbuf+0x17>
+     66b:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     66f:	7e 0a                	jle    67b <getbuf+0x21>
+    return 0;
+     671:	b8 00 00 00 00       	mov    $0x0,%eax
+     676:	e9 94 00 00 00       	jmp    70f <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     67b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     67e:	48 98                	cltq
+     680:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     687:	00 
+     688:	48 8d 05 b1 2b 00 00 	lea    0x2bb1(%rip),%rax        # 3240 <obufs>
+     68f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     693:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     697:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     69c:	75 6d                	jne    70b <getbuf+0xb1>
+     69e:	bf 08 02 00 00       	mov    $0x208,%edi
+     6a3:	e8 bd 13 00 00       	call   1a65 <malloc>
+     6a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6ac:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6b1:	74 58                	je     70b <getbuf+0xb1>
+    b->n = 0;
+     6b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6b7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     6bd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     6c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6c4:	48 89 d6             	mov    %rdx,%rsi
+     6c7:	89 c7                	mov    %eax,%edi
+     6c9:	e8 e4 0d 00 00       	call   14b2 <fstat>
+     6ce:	85 c0                	test   %eax,%eax
+     6d0:	75 11                	jne    6e3 <getbuf+0x89>
+     6d2:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     6d6:	66 83 f8 03          	cmp    $0x3,%ax
+     6da:	75 07                	jne    6e3 <getbuf+0x89>
+     6dc:	ba 01 00 00 00       	mov    $0x1,%edx
+     6e1:	eb 05                	jmp    6e8 <getbuf+0x8e>
+     6e3:	ba 00 00 00 00       	mov    $0x0,%edx
+     6e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6ec:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     6ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6f2:	48 98                	cltq
+     6f4:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     6fb:	00 
+     6fc:	48 8d 15 3d 2b 00 00 	lea    0x2b3d(%rip),%rdx        # 3240 <obufs>
+     703:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     707:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     70b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     70f:	c9                   	leave
+     710:	c3                   	ret
+
+0000000000000711 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     711:	55                   	push   %rbp
+     712:	48 89 e5             	mov    %rsp,%rbp
+     715:	48 83 ec 20          	sub    $0x20,%rsp
+     719:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     71c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     720:	78 33                	js     755 <bflush+0x44>
+     722:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     726:	7f 2d                	jg     755 <bflush+0x44>
+     728:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     72b:	48 98                	cltq
+     72d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     734:	00 
+     735:	48 8d 05 04 2b 00 00 	lea    0x2b04(%rip),%rax        # 3240 <obufs>
+     73c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     740:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     744:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     749:	74 0a                	je     755 <bflush+0x44>
+     74b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     74f:	8b 00                	mov    (%rax),%eax
+     751:	85 c0                	test   %eax,%eax
+     753:	75 07                	jne    75c <bflush+0x4b>
+    return 0;
+     755:	b8 00 00 00 00       	mov    $0x0,%eax
+     75a:	eb 3c                	jmp    798 <bflush+0x87>
+  n = b->n;
+     75c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     760:	8b 00                	mov    (%rax),%eax
+     762:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     765:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     769:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     76f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     773:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     777:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     77a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     77d:	48 89 ce             	mov    %rcx,%rsi
+     780:	89 c7                	mov    %eax,%edi
+     782:	e8 de 0c 00 00       	call   1465 <write>
+     787:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     78a:	75 07                	jne    793 <bflush+0x82>
+     78c:	b8 00 00 00 00       	mov    $0x0,%eax
+     791:	eb 05                	jmp    798 <bflush+0x87>
+     793:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     798:	c9                   	leave
+     799:	c3                   	ret
+
+000000000000079a <bflushall>:
+
+void bflushall(void) {
+     79a:	55                   	push   %rbp
+     79b:	48 89 e5             	mov    %rsp,%rbp
+     79e:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     7a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7a9:	eb 0e                	jmp    7b9 <bflushall+0x1f>
+    bflush(fd);
+     7ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7ae:	89 c7                	mov    %eax,%edi
+     7b0:	e8 5c ff ff ff       	call   711 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     7b5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     7b9:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     7bd:	7e ec                	jle    7ab <bflushall+0x11>
+}
+     7bf:	90                   	nop
+     7c0:	90                   	nop
+     7c1:	c9                   	leave
+     7c2:	c3                   	ret
+
+00000000000007c3 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     7c3:	55                   	push   %rbp
+     7c4:	48 89 e5             	mov    %rsp,%rbp
+     7c7:	48 83 ec 30          	sub    $0x30,%rsp
+     7cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     7ce:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     7d2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     7d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7d8:	89 c7                	mov    %eax,%edi
+     7da:	e8 7b fe ff ff       	call   65a <getbuf>
+     7df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     7e3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     7e8:	75 19                	jne    803 <bwrite+0x40>
+    return write(fd, s, n);
+     7ea:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     7ed:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     7f1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7f4:	48 89 ce             	mov    %rcx,%rsi
+     7f7:	89 c7                	mov    %eax,%edi
+     7f9:	e8 67 0c 00 00       	call   1465 <write>
+     7fe:	e9 cd 00 00 00       	jmp    8d0 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     803:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     80a:	e9 92 00 00 00       	jmp    8a1 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     80f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     813:	8b 00                	mov    (%rax),%eax
+     815:	3d 00 02 00 00       	cmp    $0x200,%eax
+     81a:	75 18                	jne    834 <bwrite+0x71>
+     81c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     81f:	89 c7                	mov    %eax,%edi
+     821:	e8 eb fe ff ff       	call   711 <bflush>
+     826:	85 c0                	test   %eax,%eax
+     828:	79 0a                	jns    834 <bwrite+0x71>
+      return -1;
+     82a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     82f:	e9 9c 00 00 00       	jmp    8d0 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     834:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     837:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     83a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     83d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     841:	8b 00                	mov    (%rax),%eax
+     843:	ba 00 02 00 00       	mov    $0x200,%edx
+     848:	29 c2                	sub    %eax,%edx
+     84a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     84d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     850:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     853:	39 c2                	cmp    %eax,%edx
+     855:	0f 4e c2             	cmovle %edx,%eax
+     858:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     85b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     85e:	48 63 d0             	movslq %eax,%rdx
+     861:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     865:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     869:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     86d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     871:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     875:	8b 00                	mov    (%rax),%eax
+     877:	48 98                	cltq
+     879:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     87d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     880:	89 c2                	mov    %eax,%edx
+     882:	48 89 cf             	mov    %rcx,%rdi
+     885:	e8 e9 06 00 00       	call   f73 <memmove>
+    b->n += m;
+     88a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     88e:	8b 10                	mov    (%rax),%edx
+     890:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     893:	01 c2                	add    %eax,%edx
+     895:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     899:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     89b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     89e:	01 45 fc             	add    %eax,-0x4(%rbp)
+     8a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8a4:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     8a7:	0f 8c 62 ff ff ff    	jl     80f <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     8ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8b1:	8b 40 04             	mov    0x4(%rax),%eax
+     8b4:	85 c0                	test   %eax,%eax
+     8b6:	74 15                	je     8cd <bwrite+0x10a>
+     8b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8bb:	89 c7                	mov    %eax,%edi
+     8bd:	e8 4f fe ff ff       	call   711 <bflush>
+     8c2:	85 c0                	test   %eax,%eax
+     8c4:	79 07                	jns    8cd <bwrite+0x10a>
+    return -1;
+     8c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     8cb:	eb 03                	jmp    8d0 <bwrite+0x10d>
+  return n;
+     8cd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     8d0:	c9                   	leave
+     8d1:	c3                   	ret
+
+00000000000008d2 <bputc>:
+
+void bputc(int fd, char c) {
+     8d2:	55                   	push   %rbp
+     8d3:	48 89 e5             	mov    %rsp,%rbp
+     8d6:	48 83 ec 20          	sub    $0x20,%rsp
+     8da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     8dd:	89 f0                	mov    %esi,%eax
+     8df:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     8e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8e5:	89 c7                	mov    %eax,%edi
+     8e7:	e8 6e fd ff ff       	call   65a <getbuf>
+     8ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8f0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8f5:	75 18                	jne    90f <bputc+0x3d>
+    write(fd, &c, 1);
+     8f7:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     8fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8fe:	ba 01 00 00 00       	mov    $0x1,%edx
+     903:	48 89 ce             	mov    %rcx,%rsi
+     906:	89 c7                	mov    %eax,%edi
+     908:	e8 58 0b 00 00       	call   1465 <write>
+    return;
+     90d:	eb 34                	jmp    943 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     90f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     913:	8b 00                	mov    (%rax),%eax
+     915:	3d 00 02 00 00       	cmp    $0x200,%eax
+     91a:	75 0a                	jne    926 <bputc+0x54>
+    bflush(fd);
+     91c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     91f:	89 c7                	mov    %eax,%edi
+     921:	e8 eb fd ff ff       	call   711 <bflush>
+  b->data[b->n++] = c;
+     926:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     92a:	8b 00                	mov    (%rax),%eax
+     92c:	8d 48 01             	lea    0x1(%rax),%ecx
+     92f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     933:	89 0a                	mov    %ecx,(%rdx)
+     935:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     939:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     93d:	48 98                	cltq
+     93f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     943:	c9                   	leave
+     944:	c3                   	ret
+
+0000000000000945 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     945:	55                   	push   %rbp
+     946:	48 89 e5             	mov    %rsp,%rbp
+     949:	48 83 ec 10          	sub    $0x10,%rsp
+     94d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     950:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     954:	78 4c                	js     9a2 <bflushtty+0x5d>
+     956:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     95a:	7f 46                	jg     9a2 <bflushtty+0x5d>
+     95c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     95f:	48 98                	cltq
+     961:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     968:	00 
+     969:	48 8d 05 d0 28 00 00 	lea    0x28d0(%rip),%rax        # 3240 <obufs>
+     970:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     974:	48 85 c0             	test   %rax,%rax
+     977:	74 29                	je     9a2 <bflushtty+0x5d>
+     979:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     97c:	48 98                	cltq
+     97e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     985:	00 
+     986:	48 8d 05 b3 28 00 00 	lea    0x28b3(%rip),%rax        # 3240 <obufs>
+     98d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     991:	8b 40 04             	mov    0x4(%rax),%eax
+     994:	85 c0                	test   %eax,%eax
+     996:	74 0a                	je     9a2 <bflushtty+0x5d>
+    bflush(fd);
+     998:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     99b:	89 c7                	mov    %eax,%edi
+     99d:	e8 6f fd ff ff       	call   711 <bflush>
+}
+     9a2:	90                   	nop
+     9a3:	c9                   	leave
+     9a4:	c3                   	ret
+
+00000000000009a5 <fork>:
+
+int fork(void) {
+     9a5:	55                   	push   %rbp
+     9a6:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     9a9:	e8 ec fd ff ff       	call   79a <bflushall>
+  return _fork();
+     9ae:	e8 7b 0a 00 00       	call   142e <_fork>
+}
+     9b3:	5d                   	pop    %rbp
+     9b4:	c3                   	ret
+
+00000000000009b5 <exit>:
+
+noreturn void exit(void) {
+     9b5:	55                   	push   %rbp
+     9b6:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     9b9:	e8 dc fd ff ff       	call   79a <bflushall>
+  _exit();
+     9be:	e8 76 0a 00 00       	call   1439 <_exit>
+
+00000000000009c3 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     9c3:	55                   	push   %rbp
+     9c4:	48 89 e5             	mov    %rsp,%rbp
+     9c7:	48 83 ec 10          	sub    $0x10,%rsp
+     9cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     9d3:	e8 c2 fd ff ff       	call   79a <bflushall>
+  return _exec(path, argv);
+     9d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     9dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9e0:	48 89 d6             	mov    %rdx,%rsi
+     9e3:	48 89 c7             	mov    %rax,%rdi
+     9e6:	e8 9b 0a 00 00       	call   1486 <_exec>
+}
+     9eb:	c9                   	leave
+     9ec:	c3                   	ret
+
+00000000000009ed <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     9ed:	55                   	push   %rbp
+     9ee:	48 89 e5             	mov    %rsp,%rbp
+     9f1:	48 83 ec 20          	sub    $0x20,%rsp
+     9f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     9fd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     a01:	e8 94 fd ff ff       	call   79a <bflushall>
+  return _spawn(path, argv, fds);
+     a06:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a0a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a12:	48 89 ce             	mov    %rcx,%rsi
+     a15:	48 89 c7             	mov    %rax,%rdi
+     a18:	e8 2f 0b 00 00       	call   154c <_spawn>
+}
+     a1d:	c9                   	leave
+     a1e:	c3                   	ret
+
+0000000000000a1f <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     a1f:	55                   	push   %rbp
+     a20:	48 89 e5             	mov    %rsp,%rbp
+     a23:	48 83 ec 10          	sub    $0x10,%rsp
+     a27:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     a2a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     a2e:	78 69                	js     a99 <close+0x7a>
+     a30:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     a34:	7f 63                	jg     a99 <close+0x7a>
+     a36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a39:	48 98                	cltq
+     a3b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a42:	00 
+     a43:	48 8d 05 f6 27 00 00 	lea    0x27f6(%rip),%rax        # 3240 <obufs>
+     a4a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a4e:	48 85 c0             	test   %rax,%rax
+     a51:	74 46                	je     a99 <close+0x7a>
+    bflush(fd);
+     a53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a56:	89 c7                	mov    %eax,%edi
+     a58:	e8 b4 fc ff ff       	call   711 <bflush>
+    free(obufs[fd]);
+     a5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a60:	48 98                	cltq
+     a62:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a69:	00 
+     a6a:	48 8d 05 cf 27 00 00 	lea    0x27cf(%rip),%rax        # 3240 <obufs>
+     a71:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a75:	48 89 c7             	mov    %rax,%rdi
+     a78:	e8 90 11 00 00       	call   1c0d <free>
+    obufs[fd] = 0;
+     a7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a80:	48 98                	cltq
+     a82:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a89:	00 
+     a8a:	48 8d 05 af 27 00 00 	lea    0x27af(%rip),%rax        # 3240 <obufs>
+     a91:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     a98:	00 
+  }
+  return _close(fd);
+     a99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a9c:	89 c7                	mov    %eax,%edi
+     a9e:	e8 cd 09 00 00       	call   1470 <_close>
+}
+     aa3:	c9                   	leave
+     aa4:	c3                   	ret
+
+0000000000000aa5 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     aa5:	55                   	push   %rbp
+     aa6:	48 89 e5             	mov    %rsp,%rbp
+     aa9:	53                   	push   %rbx
+     aaa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     aae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     ab2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     ab6:	48 8b 36             	mov    (%rsi),%rsi
+     ab9:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     abd:	48 29 f7             	sub    %rsi,%rdi
+     ac0:	48 89 f9             	mov    %rdi,%rcx
+     ac3:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ac8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     acc:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     ad0:	48 89 f0             	mov    %rsi,%rax
+     ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+     ad8:	48 89 df             	mov    %rbx,%rdi
+     adb:	48 0f af f8          	imul   %rax,%rdi
+     adf:	48 89 d6             	mov    %rdx,%rsi
+     ae2:	48 0f af f1          	imul   %rcx,%rsi
+     ae6:	48 01 fe             	add    %rdi,%rsi
+     ae9:	48 f7 e1             	mul    %rcx
+     aec:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     af0:	48 89 ca             	mov    %rcx,%rdx
+     af3:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     af8:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     afc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b00:	c9                   	leave
+     b01:	c3                   	ret
+
+0000000000000b02 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     b02:	55                   	push   %rbp
+     b03:	48 89 e5             	mov    %rsp,%rbp
+     b06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b0a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     b0d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     b10:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b14:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b1a:	48 89 ce             	mov    %rcx,%rsi
+     b1d:	48 89 f7             	mov    %rsi,%rdi
+     b20:	89 d1                	mov    %edx,%ecx
+     b22:	fc                   	cld
+     b23:	f3 aa                	rep stos %al,%es:(%rdi)
+     b25:	89 ca                	mov    %ecx,%edx
+     b27:	48 89 fe             	mov    %rdi,%rsi
+     b2a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b2e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b31:	90                   	nop
+     b32:	5d                   	pop    %rbp
+     b33:	c3                   	ret
+
+0000000000000b34 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     b34:	55                   	push   %rbp
+     b35:	48 89 e5             	mov    %rsp,%rbp
+     b38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b3c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b40:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     b44:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b50:	48 89 ce             	mov    %rcx,%rsi
+     b53:	48 89 f7             	mov    %rsi,%rdi
+     b56:	48 89 d1             	mov    %rdx,%rcx
+     b59:	fc                   	cld
+     b5a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     b5d:	48 89 ca             	mov    %rcx,%rdx
+     b60:	48 89 fe             	mov    %rdi,%rsi
+     b63:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b67:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b6b:	90                   	nop
+     b6c:	5d                   	pop    %rbp
+     b6d:	c3                   	ret
+
+0000000000000b6e <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     b6e:	55                   	push   %rbp
+     b6f:	48 89 e5             	mov    %rsp,%rbp
+     b72:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b7a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     b7e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b82:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b8a:	48 89 cf             	mov    %rcx,%rdi
+     b8d:	48 89 d6             	mov    %rdx,%rsi
+     b90:	48 89 c1             	mov    %rax,%rcx
+     b93:	fc                   	cld
+     b94:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     b96:	48 89 c8             	mov    %rcx,%rax
+     b99:	48 89 f2             	mov    %rsi,%rdx
+     b9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ba0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     ba4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     ba8:	90                   	nop
+     ba9:	5d                   	pop    %rbp
+     baa:	c3                   	ret
+
+0000000000000bab <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     bab:	55                   	push   %rbp
+     bac:	48 89 e5             	mov    %rsp,%rbp
+     baf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bb3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     bb7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     bbb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     bbf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bc7:	48 89 cf             	mov    %rcx,%rdi
+     bca:	48 89 d6             	mov    %rdx,%rsi
+     bcd:	48 89 c1             	mov    %rax,%rcx
+     bd0:	fc                   	cld
+     bd1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     bd4:	48 89 c8             	mov    %rcx,%rax
+     bd7:	48 89 f2             	mov    %rsi,%rdx
+     bda:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bde:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     be2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     be6:	90                   	nop
+     be7:	5d                   	pop    %rbp
+     be8:	c3                   	ret
+
+0000000000000be9 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     be9:	55                   	push   %rbp
+     bea:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     bed:	0f 31                	rdtsc
+     bef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     bf2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     bf5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     bf8:	48 c1 e0 20          	shl    $0x20,%rax
+     bfc:	48 89 c2             	mov    %rax,%rdx
+     bff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c02:	48 09 d0             	or     %rdx,%rax
+}
+     c05:	5d                   	pop    %rbp
+     c06:	c3                   	ret
+
+0000000000000c07 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     c07:	55                   	push   %rbp
+     c08:	48 89 e5             	mov    %rsp,%rbp
+     c0b:	53                   	push   %rbx
+     c0c:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     c0f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     c13:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     c17:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     c1b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     c1f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c22:	0f a2                	cpuid
+     c24:	89 de                	mov    %ebx,%esi
+     c26:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     c29:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     c2c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     c2f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     c32:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     c37:	74 09                	je     c42 <cpuid+0x3b>
+    *eaxp = eax;
+     c39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     c3d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     c40:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     c42:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     c47:	74 09                	je     c52 <cpuid+0x4b>
+    *ebxp = ebx;
+     c49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c4d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c50:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     c52:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     c57:	74 09                	je     c62 <cpuid+0x5b>
+    *ecxp = ecx;
+     c59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c5d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c60:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     c62:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     c67:	74 09                	je     c72 <cpuid+0x6b>
+    *edxp = edx;
+     c69:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     c6d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     c70:	89 10                	mov    %edx,(%rax)
+}
+     c72:	90                   	nop
+     c73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c77:	c9                   	leave
+     c78:	c3                   	ret
+
+0000000000000c79 <strcpy>:
+char *strcpy(char *s, char *t) {
+     c79:	55                   	push   %rbp
+     c7a:	48 89 e5             	mov    %rsp,%rbp
+     c7d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c81:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     c85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c89:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     c8d:	90                   	nop
+     c8e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c92:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     c96:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     c9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c9e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     ca2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     ca6:	0f b6 12             	movzbl (%rdx),%edx
+     ca9:	88 10                	mov    %dl,(%rax)
+     cab:	0f b6 00             	movzbl (%rax),%eax
+     cae:	84 c0                	test   %al,%al
+     cb0:	75 dc                	jne    c8e <strcpy+0x15>
+  return os;
+     cb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     cb6:	5d                   	pop    %rbp
+     cb7:	c3                   	ret
+
+0000000000000cb8 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     cb8:	55                   	push   %rbp
+     cb9:	48 89 e5             	mov    %rsp,%rbp
+     cbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cc0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     cc4:	eb 0a                	jmp    cd0 <strcmp+0x18>
+    p++, q++;
+     cc6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     ccb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     cd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd4:	0f b6 00             	movzbl (%rax),%eax
+     cd7:	84 c0                	test   %al,%al
+     cd9:	74 12                	je     ced <strcmp+0x35>
+     cdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cdf:	0f b6 10             	movzbl (%rax),%edx
+     ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ce6:	0f b6 00             	movzbl (%rax),%eax
+     ce9:	38 c2                	cmp    %al,%dl
+     ceb:	74 d9                	je     cc6 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     ced:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cf1:	0f b6 00             	movzbl (%rax),%eax
+     cf4:	0f b6 d0             	movzbl %al,%edx
+     cf7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cfb:	0f b6 00             	movzbl (%rax),%eax
+     cfe:	0f b6 c0             	movzbl %al,%eax
+     d01:	29 c2                	sub    %eax,%edx
+     d03:	89 d0                	mov    %edx,%eax
+}
+     d05:	5d                   	pop    %rbp
+     d06:	c3                   	ret
+
+0000000000000d07 <strlen>:
+uint strlen(char *s) {
+     d07:	55                   	push   %rbp
+     d08:	48 89 e5             	mov    %rsp,%rbp
+     d0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     d0f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d16:	eb 04                	jmp    d1c <strlen+0x15>
+     d18:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d1f:	48 63 d0             	movslq %eax,%rdx
+     d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d26:	48 01 d0             	add    %rdx,%rax
+     d29:	0f b6 00             	movzbl (%rax),%eax
+     d2c:	84 c0                	test   %al,%al
+     d2e:	75 e8                	jne    d18 <strlen+0x11>
+    ;
+  return n;
+     d30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     d33:	5d                   	pop    %rbp
+     d34:	c3                   	ret
+
+0000000000000d35 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     d35:	55                   	push   %rbp
+     d36:	48 89 e5             	mov    %rsp,%rbp
+     d39:	53                   	push   %rbx
+     d3a:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     d3e:	8b 05 f0 22 00 00    	mov    0x22f0(%rip),%eax        # 3034 <erms>
+     d44:	85 c0                	test   %eax,%eax
+     d46:	79 53                	jns    d9b <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     d48:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     d4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d57:	ba 00 00 00 00       	mov    $0x0,%edx
+     d5c:	48 89 c6             	mov    %rax,%rsi
+     d5f:	bf 00 00 00 00       	mov    $0x0,%edi
+     d64:	e8 9e fe ff ff       	call   c07 <cpuid>
+    ebx = 0;
+     d69:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     d70:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d73:	83 f8 06             	cmp    $0x6,%eax
+     d76:	76 14                	jbe    d8c <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     d78:	b8 07 00 00 00       	mov    $0x7,%eax
+     d7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d82:	0f a2                	cpuid
+     d84:	89 d9                	mov    %ebx,%ecx
+     d86:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     d89:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     d8c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d8f:	c1 e8 09             	shr    $0x9,%eax
+     d92:	83 e0 01             	and    $0x1,%eax
+     d95:	89 05 99 22 00 00    	mov    %eax,0x2299(%rip)        # 3034 <erms>
+  }
+  return erms;
+     d9b:	8b 05 93 22 00 00    	mov    0x2293(%rip),%eax        # 3034 <erms>
+}
+     da1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     da5:	c9                   	leave
+     da6:	c3                   	ret
+
+0000000000000da7 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     da7:	55                   	push   %rbp
+     da8:	48 89 e5             	mov    %rsp,%rbp
+     dab:	48 83 ec 10          	sub    $0x10,%rsp
+     daf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     db3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     db6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     db9:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     dbd:	76 09                	jbe    dc8 <memset+0x21>
+     dbf:	e8 71 ff ff ff       	call   d35 <haserms>
+     dc4:	85 c0                	test   %eax,%eax
+     dc6:	74 16                	je     dde <memset+0x37>
+    stosb(dst, c, n);
+     dc8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     dcb:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     dce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dd2:	89 ce                	mov    %ecx,%esi
+     dd4:	48 89 c7             	mov    %rax,%rdi
+     dd7:	e8 26 fd ff ff       	call   b02 <stosb>
+     ddc:	eb 58                	jmp    e36 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     dde:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     de1:	c1 e8 03             	shr    $0x3,%eax
+     de4:	89 c6                	mov    %eax,%esi
+     de6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     de9:	48 98                	cltq
+     deb:	0f b6 c0             	movzbl %al,%eax
+     dee:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     df5:	01 01 01 
+     df8:	48 0f af c2          	imul   %rdx,%rax
+     dfc:	48 89 c1             	mov    %rax,%rcx
+     dff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e03:	48 89 f2             	mov    %rsi,%rdx
+     e06:	48 89 ce             	mov    %rcx,%rsi
+     e09:	48 89 c7             	mov    %rax,%rdi
+     e0c:	e8 23 fd ff ff       	call   b34 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     e11:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e14:	83 e0 07             	and    $0x7,%eax
+     e17:	89 c2                	mov    %eax,%edx
+     e19:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e1c:	83 e0 f8             	and    $0xfffffff8,%eax
+     e1f:	48 89 c1             	mov    %rax,%rcx
+     e22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e26:	48 01 c1             	add    %rax,%rcx
+     e29:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e2c:	89 c6                	mov    %eax,%esi
+     e2e:	48 89 cf             	mov    %rcx,%rdi
+     e31:	e8 cc fc ff ff       	call   b02 <stosb>
+  }
+  return dst;
+     e36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e3a:	c9                   	leave
+     e3b:	c3                   	ret
+
+0000000000000e3c <strchr>:
+
+char *strchr(const char *s, char c) {
+     e3c:	55                   	push   %rbp
+     e3d:	48 89 e5             	mov    %rsp,%rbp
+     e40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e44:	89 f0                	mov    %esi,%eax
+     e46:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     e49:	eb 17                	jmp    e62 <strchr+0x26>
+    if (*s == c)
+     e4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e4f:	0f b6 00             	movzbl (%rax),%eax
+     e52:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     e55:	75 06                	jne    e5d <strchr+0x21>
+      return (char *)s;
+     e57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e5b:	eb 15                	jmp    e72 <strchr+0x36>
+  for (; *s; s++)
+     e5d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e66:	0f b6 00             	movzbl (%rax),%eax
+     e69:	84 c0                	test   %al,%al
+     e6b:	75 de                	jne    e4b <strchr+0xf>
+  return 0;
+     e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e72:	5d                   	pop    %rbp
+     e73:	c3                   	ret
+
+0000000000000e74 <gets>:
+
+char *gets(char *buf, int max) {
+     e74:	55                   	push   %rbp
+     e75:	48 89 e5             	mov    %rsp,%rbp
+     e78:	48 83 ec 20          	sub    $0x20,%rsp
+     e7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e80:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     e83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e8a:	eb 48                	jmp    ed4 <gets+0x60>
+    cc = read(0, &c, 1);
+     e8c:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     e90:	ba 01 00 00 00       	mov    $0x1,%edx
+     e95:	48 89 c6             	mov    %rax,%rsi
+     e98:	bf 00 00 00 00       	mov    $0x0,%edi
+     e9d:	e8 b8 05 00 00       	call   145a <read>
+     ea2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     ea5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ea9:	7e 36                	jle    ee1 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     eab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eae:	8d 50 01             	lea    0x1(%rax),%edx
+     eb1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     eb4:	48 63 d0             	movslq %eax,%rdx
+     eb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ebb:	48 01 c2             	add    %rax,%rdx
+     ebe:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ec2:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     ec4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ec8:	3c 0a                	cmp    $0xa,%al
+     eca:	74 16                	je     ee2 <gets+0x6e>
+     ecc:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ed0:	3c 0d                	cmp    $0xd,%al
+     ed2:	74 0e                	je     ee2 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ed7:	83 c0 01             	add    $0x1,%eax
+     eda:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     edd:	7f ad                	jg     e8c <gets+0x18>
+     edf:	eb 01                	jmp    ee2 <gets+0x6e>
+      break;
+     ee1:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     ee2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ee5:	48 63 d0             	movslq %eax,%rdx
+     ee8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eec:	48 01 d0             	add    %rdx,%rax
+     eef:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     ef2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     ef6:	c9                   	leave
+     ef7:	c3                   	ret
+
+0000000000000ef8 <stat>:
+
+int stat(char *n, struct stat *st) {
+     ef8:	55                   	push   %rbp
+     ef9:	48 89 e5             	mov    %rsp,%rbp
+     efc:	48 83 ec 10          	sub    $0x10,%rsp
+     f00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f04:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     f08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f10:	48 89 c6             	mov    %rax,%rsi
+     f13:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     f18:	e8 58 07 00 00       	call   1675 <fstatat>
+}
+     f1d:	c9                   	leave
+     f1e:	c3                   	ret
+
+0000000000000f1f <atoi>:
+
+int atoi(const char *s) {
+     f1f:	55                   	push   %rbp
+     f20:	48 89 e5             	mov    %rsp,%rbp
+     f23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     f27:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f2e:	eb 28                	jmp    f58 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     f30:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f33:	89 d0                	mov    %edx,%eax
+     f35:	c1 e0 02             	shl    $0x2,%eax
+     f38:	01 d0                	add    %edx,%eax
+     f3a:	01 c0                	add    %eax,%eax
+     f3c:	89 c1                	mov    %eax,%ecx
+     f3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f42:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     f46:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     f4a:	0f b6 00             	movzbl (%rax),%eax
+     f4d:	0f be c0             	movsbl %al,%eax
+     f50:	01 c8                	add    %ecx,%eax
+     f52:	83 e8 30             	sub    $0x30,%eax
+     f55:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f5c:	0f b6 00             	movzbl (%rax),%eax
+     f5f:	3c 2f                	cmp    $0x2f,%al
+     f61:	7e 0b                	jle    f6e <atoi+0x4f>
+     f63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f67:	0f b6 00             	movzbl (%rax),%eax
+     f6a:	3c 39                	cmp    $0x39,%al
+     f6c:	7e c2                	jle    f30 <atoi+0x11>
+  return n;
+     f6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     f71:	5d                   	pop    %rbp
+     f72:	c3                   	ret
+
+0000000000000f73 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     f73:	55                   	push   %rbp
+     f74:	48 89 e5             	mov    %rsp,%rbp
+     f77:	48 83 ec 28          	sub    $0x28,%rsp
+     f7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     f7f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     f83:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     f86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     f8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f92:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     f96:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     f9a:	7f 09                	jg     fa5 <memmove+0x32>
+    return vdst;
+     f9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fa0:	e9 29 01 00 00       	jmp    10ce <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     fa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fa9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     fad:	0f 83 87 00 00 00    	jae    103a <memmove+0xc7>
+     fb3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fb6:	48 63 d0             	movslq %eax,%rdx
+     fb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fbd:	48 01 d0             	add    %rdx,%rax
+     fc0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     fc4:	73 74                	jae    103a <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     fc6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fc9:	48 98                	cltq
+     fcb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     fcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fd2:	48 98                	cltq
+     fd4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     fd8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     fdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fe0:	48 09 d0             	or     %rdx,%rax
+     fe3:	83 e0 07             	and    $0x7,%eax
+     fe6:	48 85 c0             	test   %rax,%rax
+     fe9:	75 3d                	jne    1028 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     feb:	eb 1c                	jmp    1009 <memmove+0x96>
+        src -= 8;
+     fed:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     ff2:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     ff7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ffb:	48 8b 10             	mov    (%rax),%rdx
+     ffe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1002:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1005:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1009:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    100d:	7f de                	jg     fed <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    100f:	eb 17                	jmp    1028 <memmove+0xb5>
+      *--dst = *--src;
+    1011:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1016:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    101b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    101f:	0f b6 10             	movzbl (%rax),%edx
+    1022:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1026:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1028:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    102b:	8d 50 ff             	lea    -0x1(%rax),%edx
+    102e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1031:	85 c0                	test   %eax,%eax
+    1033:	7f dc                	jg     1011 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1035:	e9 90 00 00 00       	jmp    10ca <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    103a:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    103e:	7e 09                	jle    1049 <memmove+0xd6>
+    1040:	e8 f0 fc ff ff       	call   d35 <haserms>
+    1045:	85 c0                	test   %eax,%eax
+    1047:	74 1b                	je     1064 <memmove+0xf1>
+    movsb(dst, src, n);
+    1049:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    104c:	48 63 d0             	movslq %eax,%rdx
+    104f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1053:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1057:	48 89 ce             	mov    %rcx,%rsi
+    105a:	48 89 c7             	mov    %rax,%rdi
+    105d:	e8 0c fb ff ff       	call   b6e <movsb>
+    1062:	eb 66                	jmp    10ca <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1064:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1067:	8d 50 07             	lea    0x7(%rax),%edx
+    106a:	85 c0                	test   %eax,%eax
+    106c:	0f 48 c2             	cmovs  %edx,%eax
+    106f:	c1 f8 03             	sar    $0x3,%eax
+    1072:	48 63 d0             	movslq %eax,%rdx
+    1075:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1079:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    107d:	48 89 ce             	mov    %rcx,%rsi
+    1080:	48 89 c7             	mov    %rax,%rdi
+    1083:	e8 23 fb ff ff       	call   bab <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1088:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    108b:	89 d0                	mov    %edx,%eax
+    108d:	c1 f8 1f             	sar    $0x1f,%eax
+    1090:	c1 e8 1d             	shr    $0x1d,%eax
+    1093:	01 c2                	add    %eax,%edx
+    1095:	83 e2 07             	and    $0x7,%edx
+    1098:	29 c2                	sub    %eax,%edx
+    109a:	89 d0                	mov    %edx,%eax
+    109c:	48 98                	cltq
+    109e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10a1:	83 e2 f8             	and    $0xfffffff8,%edx
+    10a4:	48 63 ca             	movslq %edx,%rcx
+    10a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    10ab:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    10af:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10b2:	83 e2 f8             	and    $0xfffffff8,%edx
+    10b5:	48 63 ca             	movslq %edx,%rcx
+    10b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    10bc:	48 01 d1             	add    %rdx,%rcx
+    10bf:	48 89 c2             	mov    %rax,%rdx
+    10c2:	48 89 cf             	mov    %rcx,%rdi
+    10c5:	e8 a4 fa ff ff       	call   b6e <movsb>
+  }
+  return vdst;
+    10ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    10ce:	c9                   	leave
+    10cf:	c3                   	ret
+
+00000000000010d0 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    10d0:	55                   	push   %rbp
+    10d1:	48 89 e5             	mov    %rsp,%rbp
+    10d4:	48 83 ec 20          	sub    $0x20,%rsp
+    10d8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    10db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    10df:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    10e6:	00 00 00 
+    10e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    10ed:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    10f1:	75 0d                	jne    1100 <clock_gettime+0x30>
+    10f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    10fb:	48 85 c0             	test   %rax,%rax
+    10fe:	75 13                	jne    1113 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1100:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1104:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1107:	48 89 d6             	mov    %rdx,%rsi
+    110a:	89 c7                	mov    %eax,%edi
+    110c:	e8 e0 04 00 00       	call   15f1 <_clock_gettime>
+    1111:	eb 7d                	jmp    1190 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1113:	e8 d1 fa ff ff       	call   be9 <rdtsc>
+    1118:	48 89 c2             	mov    %rax,%rdx
+    111b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    111f:	48 89 d6             	mov    %rdx,%rsi
+    1122:	48 89 c7             	mov    %rax,%rdi
+    1125:	e8 7b f9 ff ff       	call   aa5 <clockns>
+    112a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    112e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1132:	48 c1 e8 09          	shr    $0x9,%rax
+    1136:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    113d:	b8 44 00 
+    1140:	48 f7 e2             	mul    %rdx
+    1143:	48 89 d0             	mov    %rdx,%rax
+    1146:	48 c1 e8 0b          	shr    $0xb,%rax
+    114a:	48 89 c2             	mov    %rax,%rdx
+    114d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1151:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1154:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1158:	48 89 c8             	mov    %rcx,%rax
+    115b:	48 c1 e8 09          	shr    $0x9,%rax
+    115f:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1166:	b8 44 00 
+    1169:	48 f7 e2             	mul    %rdx
+    116c:	48 89 d0             	mov    %rdx,%rax
+    116f:	48 c1 e8 0b          	shr    $0xb,%rax
+    1173:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    117a:	48 89 c8             	mov    %rcx,%rax
+    117d:	48 29 d0             	sub    %rdx,%rax
+    1180:	48 89 c2             	mov    %rax,%rdx
+    1183:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1187:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    118b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1190:	c9                   	leave
+    1191:	c3                   	ret
+
+0000000000001192 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1192:	55                   	push   %rbp
+    1193:	48 89 e5             	mov    %rsp,%rbp
+    1196:	48 83 ec 10          	sub    $0x10,%rsp
+    119a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    119e:	eb 11                	jmp    11b1 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    11a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a4:	be 02 00 00 00       	mov    $0x2,%esi
+    11a9:	48 89 c7             	mov    %rax,%rdi
+    11ac:	e8 6c 04 00 00       	call   161d <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    11b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    11b5:	b8 02 00 00 00       	mov    $0x2,%eax
+    11ba:	87 02                	xchg   %eax,(%rdx)
+    11bc:	85 c0                	test   %eax,%eax
+    11be:	75 e0                	jne    11a0 <mutex_wait+0xe>
+}
+    11c0:	90                   	nop
+    11c1:	90                   	nop
+    11c2:	c9                   	leave
+    11c3:	c3                   	ret
+
+00000000000011c4 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    11c4:	55                   	push   %rbp
+    11c5:	48 89 e5             	mov    %rsp,%rbp
+    11c8:	48 83 ec 20          	sub    $0x20,%rsp
+    11cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    11d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    11d7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    11db:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    11df:	8b 02                	mov    (%rdx),%eax
+    11e1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11e6:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    11ea:	89 c1                	mov    %eax,%ecx
+    11ec:	0f 94 c0             	sete   %al
+    11ef:	84 c0                	test   %al,%al
+    11f1:	75 02                	jne    11f5 <mutex_lock+0x31>
+    11f3:	89 0a                	mov    %ecx,(%rdx)
+    11f5:	83 f0 01             	xor    $0x1,%eax
+    11f8:	84 c0                	test   %al,%al
+    11fa:	74 0c                	je     1208 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    11fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1200:	48 89 c7             	mov    %rax,%rdi
+    1203:	e8 8a ff ff ff       	call   1192 <mutex_wait>
+}
+    1208:	90                   	nop
+    1209:	c9                   	leave
+    120a:	c3                   	ret
+
+000000000000120b <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    120b:	55                   	push   %rbp
+    120c:	48 89 e5             	mov    %rsp,%rbp
+    120f:	48 83 ec 10          	sub    $0x10,%rsp
+    1213:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    121b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1220:	87 10                	xchg   %edx,(%rax)
+    1222:	83 fa 02             	cmp    $0x2,%edx
+    1225:	75 11                	jne    1238 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1227:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    122b:	be 01 00 00 00       	mov    $0x1,%esi
+    1230:	48 89 c7             	mov    %rax,%rdi
+    1233:	e8 f0 03 00 00       	call   1628 <futex_wake>
+}
+    1238:	90                   	nop
+    1239:	c9                   	leave
+    123a:	c3                   	ret
+
+000000000000123b <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    123b:	55                   	push   %rbp
+    123c:	48 89 e5             	mov    %rsp,%rbp
+    123f:	48 83 ec 20          	sub    $0x20,%rsp
+    1243:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1247:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    124b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    124f:	48 83 c0 04          	add    $0x4,%rax
+    1253:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    125b:	8b 00                	mov    (%rax),%eax
+    125d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1260:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1264:	48 89 c7             	mov    %rax,%rdi
+    1267:	e8 9f ff ff ff       	call   120b <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    126c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1270:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1273:	89 d6                	mov    %edx,%esi
+    1275:	48 89 c7             	mov    %rax,%rdi
+    1278:	e8 a0 03 00 00       	call   161d <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    127d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1281:	48 83 c0 04          	add    $0x4,%rax
+    1285:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1289:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    128d:	48 89 c7             	mov    %rax,%rdi
+    1290:	e8 fd fe ff ff       	call   1192 <mutex_wait>
+}
+    1295:	90                   	nop
+    1296:	c9                   	leave
+    1297:	c3                   	ret
+
+0000000000001298 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1298:	55                   	push   %rbp
+    1299:	48 89 e5             	mov    %rsp,%rbp
+    129c:	48 83 ec 10          	sub    $0x10,%rsp
+    12a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    12a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12a8:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    12ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b0:	48 83 c0 04          	add    $0x4,%rax
+    12b4:	8b 00                	mov    (%rax),%eax
+    12b6:	85 c0                	test   %eax,%eax
+    12b8:	7e 11                	jle    12cb <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    12ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12be:	be 01 00 00 00       	mov    $0x1,%esi
+    12c3:	48 89 c7             	mov    %rax,%rdi
+    12c6:	e8 5d 03 00 00       	call   1628 <futex_wake>
+}
+    12cb:	90                   	nop
+    12cc:	c9                   	leave
+    12cd:	c3                   	ret
+
+00000000000012ce <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    12ce:	55                   	push   %rbp
+    12cf:	48 89 e5             	mov    %rsp,%rbp
+    12d2:	48 83 ec 10          	sub    $0x10,%rsp
+    12d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    12da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12de:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    12e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12e6:	48 83 c0 04          	add    $0x4,%rax
+    12ea:	8b 00                	mov    (%rax),%eax
+    12ec:	85 c0                	test   %eax,%eax
+    12ee:	7e 11                	jle    1301 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    12f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12f4:	be 00 00 00 40       	mov    $0x40000000,%esi
+    12f9:	48 89 c7             	mov    %rax,%rdi
+    12fc:	e8 27 03 00 00       	call   1628 <futex_wake>
+}
+    1301:	90                   	nop
+    1302:	c9                   	leave
+    1303:	c3                   	ret
+
+0000000000001304 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1304:	55                   	push   %rbp
+    1305:	48 89 e5             	mov    %rsp,%rbp
+    1308:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    130c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    130f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1313:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1317:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    131b:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    131f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1323:	8b 40 04             	mov    0x4(%rax),%eax
+    1326:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1329:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    132d:	8b 00                	mov    (%rax),%eax
+    132f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1332:	29 c2                	sub    %eax,%edx
+    1334:	83 fa 1f             	cmp    $0x1f,%edx
+    1337:	76 07                	jbe    1340 <ring_push+0x3c>
+    return -1;
+    1339:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    133e:	eb 7e                	jmp    13be <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1340:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1343:	83 e0 1f             	and    $0x1f,%eax
+    1346:	89 c2                	mov    %eax,%edx
+    1348:	48 89 d0             	mov    %rdx,%rax
+    134b:	48 01 c0             	add    %rax,%rax
+    134e:	48 01 d0             	add    %rdx,%rax
+    1351:	48 c1 e0 04          	shl    $0x4,%rax
+    1355:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    135d:	48 01 d0             	add    %rdx,%rax
+    1360:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1364:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1368:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    136b:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    136d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1371:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1375:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1379:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    137d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1381:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1385:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1389:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    138d:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1395:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1399:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    139d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13a1:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    13a5:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    13a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13ac:	8d 50 01             	lea    0x1(%rax),%edx
+    13af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13b3:	48 83 c0 04          	add    $0x4,%rax
+    13b7:	89 10                	mov    %edx,(%rax)
+  return 0;
+    13b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13be:	5d                   	pop    %rbp
+    13bf:	c3                   	ret
+
+00000000000013c0 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    13c0:	55                   	push   %rbp
+    13c1:	48 89 e5             	mov    %rsp,%rbp
+    13c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    13cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13d0:	8b 40 08             	mov    0x8(%rax),%eax
+    13d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    13d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13da:	48 83 c0 0c          	add    $0xc,%rax
+    13de:	8b 00                	mov    (%rax),%eax
+    13e0:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    13e3:	75 07                	jne    13ec <ring_pop+0x2c>
+    return -1;
+    13e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13ea:	eb 40                	jmp    142c <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    13ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13ef:	83 e0 1f             	and    $0x1f,%eax
+    13f2:	89 c2                	mov    %eax,%edx
+    13f4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    13f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13fc:	89 d2                	mov    %edx,%edx
+    13fe:	48 83 c2 61          	add    $0x61,%rdx
+    1402:	48 c1 e2 04          	shl    $0x4,%rdx
+    1406:	48 01 d0             	add    %rdx,%rax
+    1409:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    140d:	48 8b 00             	mov    (%rax),%rax
+    1410:	48 89 01             	mov    %rax,(%rcx)
+    1413:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1417:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    141a:	8d 50 01             	lea    0x1(%rax),%edx
+    141d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1421:	48 83 c0 08          	add    $0x8,%rax
+    1425:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1427:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    142c:	5d                   	pop    %rbp
+    142d:	c3                   	ret
+
+000000000000142e <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    142e:	b8 01 00 00 00       	mov    $0x1,%eax
+    1433:	49 89 ca             	mov    %rcx,%r10
+    1436:	0f 05                	syscall
+    1438:	c3                   	ret
+
+0000000000001439 <_exit>:
+SYSCALL_(exit)
+    1439:	b8 02 00 00 00       	mov    $0x2,%eax
+    143e:	49 89 ca             	mov    %rcx,%r10
+    1441:	0f 05                	syscall
+    1443:	c3                   	ret
+
+0000000000001444 <wait>:
+SYSCALL(wait)
+    1444:	b8 03 00 00 00       	mov    $0x3,%eax
+    1449:	49 89 ca             	mov    %rcx,%r10
+    144c:	0f 05                	syscall
+    144e:	c3                   	ret
+
+000000000000144f <pipe>:
+SYSCALL(pipe)
+    144f:	b8 04 00 00 00       	mov    $0x4,%eax
+    1454:	49 89 ca             	mov    %rcx,%r10
+    1457:	0f 05                	syscall
+    1459:	c3                   	ret
+
+000000000000145a <read>:
+SYSCALL(read)
+    145a:	b8 05 00 00 00       	mov    $0x5,%eax
+    145f:	49 89 ca             	mov    %rcx,%r10
+    1462:	0f 05                	syscall
+    1464:	c3                   	ret
+
+0000000000001465 <write>:
+SYSCALL(write)
+    1465:	b8 10 00 00 00       	mov    $0x10,%eax
+    146a:	49 89 ca             	mov    %rcx,%r10
+    146d:	0f 05                	syscall
+    146f:	c3                   	ret
+
+0000000000001470 <_close>:
+SYSCALL_(close)
+    1470:	b8 15 00 00 00       	mov    $0x15,%eax
+    1475:	49 89 ca             	mov    %rcx,%r10
+    1478:	0f 05                	syscall
+    147a:	c3                   	ret
+
+000000000000147b <kill>:
+SYSCALL(kill)
+    147b:	b8 06 00 00 00       	mov    $0x6,%eax
+    1480:	49 89 ca             	mov    %rcx,%r10
+    1483:	0f 05                	syscall
+    1485:	c3                   	ret
+
+0000000000001486 <_exec>:
+SYSCALL_(exec)
+    1486:	b8 07 00 00 00       	mov    $0x7,%eax
+    148b:	49 89 ca             	mov    %rcx,%r10
+    148e:	0f 05                	syscall
+    1490:	c3                   	ret
+
+0000000000001491 <open>:
+SYSCALL(open)
+    1491:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1496:	49 89 ca             	mov    %rcx,%r10
+    1499:	0f 05                	syscall
+    149b:	c3                   	ret
+
+000000000000149c <mknod>:
+SYSCALL(mknod)
+    149c:	b8 11 00 00 00       	mov    $0x11,%eax
+    14a1:	49 89 ca             	mov    %rcx,%r10
+    14a4:	0f 05                	syscall
+    14a6:	c3                   	ret
+
+00000000000014a7 <unlink>:
+SYSCALL(unlink)
+    14a7:	b8 12 00 00 00       	mov    $0x12,%eax
+    14ac:	49 89 ca             	mov    %rcx,%r10
+    14af:	0f 05                	syscall
+    14b1:	c3                   	ret
+
+00000000000014b2 <fstat>:
+SYSCALL(fstat)
+    14b2:	b8 08 00 00 00       	mov    $0x8,%eax
+    14b7:	49 89 ca             	mov    %rcx,%r10
+    14ba:	0f 05                	syscall
+    14bc:	c3                   	ret
+
+00000000000014bd <link>:
+SYSCALL(link)
+    14bd:	b8 13 00 00 00       	mov    $0x13,%eax
+    14c2:	49 89 ca             	mov    %rcx,%r10
+    14c5:	0f 05                	syscall
+    14c7:	c3                   	ret
+
+00000000000014c8 <mkdir>:
+SYSCALL(mkdir)
+    14c8:	b8 14 00 00 00       	mov    $0x14,%eax
+    14cd:	49 89 ca             	mov    %rcx,%r10
+    14d0:	0f 05                	syscall
+    14d2:	c3                   	ret
+
+00000000000014d3 <chdir>:
+SYSCALL(chdir)
+    14d3:	b8 09 00 00 00       	mov    $0x9,%eax
+    14d8:	49 89 ca             	mov    %rcx,%r10
+    14db:	0f 05                	syscall
+    14dd:	c3                   	ret
+
+00000000000014de <dup>:
+SYSCALL(dup)
+    14de:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14e3:	49 89 ca             	mov    %rcx,%r10
+    14e6:	0f 05                	syscall
+    14e8:	c3                   	ret
+
+00000000000014e9 <getpid>:
+SYSCALL(getpid)
+    14e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14ee:	49 89 ca             	mov    %rcx,%r10
+    14f1:	0f 05                	syscall
+    14f3:	c3                   	ret
+
+00000000000014f4 <sbrk>:
+SYSCALL(sbrk)
+    14f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14f9:	49 89 ca             	mov    %rcx,%r10
+    14fc:	0f 05                	syscall
+    14fe:	c3                   	ret
+
+00000000000014ff <sleep>:
+SYSCALL(sleep)
+    14ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1504:	49 89 ca             	mov    %rcx,%r10
+    1507:	0f 05                	syscall
+    1509:	c3                   	ret
+
+000000000000150a <uptime>:
+SYSCALL(uptime)
+    150a:	b8 0e 00 00 00       	mov    $0xe,%eax
+    150f:	49 89 ca             	mov    %rcx,%r10
+    1512:	0f 05                	syscall
+    1514:	c3                   	ret
+
+0000000000001515 <sysinfo>:
+SYSCALL(sysinfo)
+    1515:	b8 16 00 00 00       	mov    $0x16,%eax
+    151a:	49 89 ca             	mov    %rcx,%r10
+    151d:	0f 05                	syscall
+    151f:	c3                   	ret
+
+0000000000001520 <crashn>:
+SYSCALL(crashn)
+    1520:	b8 17 00 00 00       	mov    $0x17,%eax
+    1525:	49 89 ca             	mov    %rcx,%r10
+    1528:	0f 05                	syscall
+    152a:	c3                   	ret
+
+000000000000152b <mmap>:
+SYSCALL(mmap)
+    152b:	b8 18 00 00 00       	mov    $0x18,%eax
+    1530:	49 89 ca             	mov    %rcx,%r10
+    1533:	0f 05                	syscall
+    1535:	c3                   	ret
+
+0000000000001536 <munmap>:
+SYSCALL(munmap)
+    1536:	b8 19 00 00 00       	mov    $0x19,%eax
+    153b:	49 89 ca             	mov    %rcx,%r10
+    153e:	0f 05                	syscall
+    1540:	c3                   	ret
+
+0000000000001541 <nice>:
+SYSCALL(nice)
+    1541:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1546:	49 89 ca             	mov    %rcx,%r10
+    1549:	0f 05                	syscall
+    154b:	c3                   	ret
+
+000000000000154c <_spawn>:
+SYSCALL_(spawn)
+    154c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1551:	49 89 ca             	mov    %rcx,%r10
+    1554:	0f 05                	syscall
+    1556:	c3                   	ret
+
+0000000000001557 <pread>:
+SYSCALL(pread)
+    1557:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    155c:	49 89 ca             	mov    %rcx,%r10
+    155f:	0f 05                	syscall
+    1561:	c3                   	ret
+
+0000000000001562 <pwrite>:
+SYSCALL(pwrite)
+    1562:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1567:	49 89 ca             	mov    %rcx,%r10
+    156a:	0f 05                	syscall
+    156c:	c3                   	ret
+
+000000000000156d <readv>:
+SYSCALL(readv)
+    156d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1572:	49 89 ca             	mov    %rcx,%r10
+    1575:	0f 05                	syscall
+    1577:	c3                   	ret
+
+0000000000001578 <writev>:
+SYSCALL(writev)
+    1578:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    157d:	49 89 ca             	mov    %rcx,%r10
+    1580:	0f 05                	syscall
+    1582:	c3                   	ret
+
+0000000000001583 <sendfile>:
+SYSCALL(sendfile)
+    1583:	b8 20 00 00 00       	mov    $0x20,%eax
+    1588:	49 89 ca             	mov    %rcx,%r10
+    158b:	0f 05                	syscall
+    158d:	c3                   	ret
+
+000000000000158e <splice>:
+SYSCALL(splice)
+    158e:	b8 21 00 00 00       	mov    $0x21,%eax
+    1593:	49 89 ca             	mov    %rcx,%r10
+    1596:	0f 05                	syscall
+    1598:	c3                   	ret
+
+0000000000001599 <poll>:
+SYSCALL(poll)
+    1599:	b8 22 00 00 00       	mov    $0x22,%eax
+    159e:	49 89 ca             	mov    %rcx,%r10
+    15a1:	0f 05                	syscall
+    15a3:	c3                   	ret
+
+00000000000015a4 <fsync>:
+SYSCALL(fsync)
+    15a4:	b8 23 00 00 00       	mov    $0x23,%eax
+    15a9:	49 89 ca             	mov    %rcx,%r10
+    15ac:	0f 05                	syscall
+    15ae:	c3                   	ret
+
+00000000000015af <fdatasync>:
+SYSCALL(fdatasync)
+    15af:	b8 24 00 00 00       	mov    $0x24,%eax
+    15b4:	49 89 ca             	mov    %rcx,%r10
+    15b7:	0f 05                	syscall
+    15b9:	c3                   	ret
+
+00000000000015ba <lockstat>:
+SYSCALL(lockstat)
+    15ba:	b8 25 00 00 00       	mov    $0x25,%eax
+    15bf:	49 89 ca             	mov    %rcx,%r10
+    15c2:	0f 05                	syscall
+    15c4:	c3                   	ret
+
+00000000000015c5 <syscallstat>:
+SYSCALL(syscallstat)
+    15c5:	b8 26 00 00 00       	mov    $0x26,%eax
+    15ca:	49 89 ca             	mov    %rcx,%r10
+    15cd:	0f 05                	syscall
+    15cf:	c3                   	ret
+
+00000000000015d0 <trace>:
+SYSCALL(trace)
+    15d0:	b8 27 00 00 00       	mov    $0x27,%eax
+    15d5:	49 89 ca             	mov    %rcx,%r10
+    15d8:	0f 05                	syscall
+    15da:	c3                   	ret
+
+00000000000015db <profile>:
+SYSCALL(profile)
+    15db:	b8 28 00 00 00       	mov    $0x28,%eax
+    15e0:	49 89 ca             	mov    %rcx,%r10
+    15e3:	0f 05                	syscall
+    15e5:	c3                   	ret
+
+00000000000015e6 <cycles>:
+SYSCALL(cycles)
+    15e6:	b8 29 00 00 00       	mov    $0x29,%eax
+    15eb:	49 89 ca             	mov    %rcx,%r10
+    15ee:	0f 05                	syscall
+    15f0:	c3                   	ret
+
+00000000000015f1 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    15f1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    15f6:	49 89 ca             	mov    %rcx,%r10
+    15f9:	0f 05                	syscall
+    15fb:	c3                   	ret
+
+00000000000015fc <consmode>:
+SYSCALL(consmode)
+    15fc:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1601:	49 89 ca             	mov    %rcx,%r10
+    1604:	0f 05                	syscall
+    1606:	c3                   	ret
+
+0000000000001607 <clone>:
+SYSCALL(clone)
+    1607:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    160c:	49 89 ca             	mov    %rcx,%r10
+    160f:	0f 05                	syscall
+    1611:	c3                   	ret
+
+0000000000001612 <join>:
+SYSCALL(join)
+    1612:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1617:	49 89 ca             	mov    %rcx,%r10
+    161a:	0f 05                	syscall
+    161c:	c3                   	ret
+
+000000000000161d <futex_wait>:
+SYSCALL(futex_wait)
+    161d:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1622:	49 89 ca             	mov    %rcx,%r10
+    1625:	0f 05                	syscall
+    1627:	c3                   	ret
+
+0000000000001628 <futex_wake>:
+SYSCALL(futex_wake)
+    1628:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    162d:	49 89 ca             	mov    %rcx,%r10
+    1630:	0f 05                	syscall
+    1632:	c3                   	ret
+
+0000000000001633 <shmget>:
+SYSCALL(shmget)
+    1633:	b8 30 00 00 00       	mov    $0x30,%eax
+    1638:	49 89 ca             	mov    %rcx,%r10
+    163b:	0f 05                	syscall
+    163d:	c3                   	ret
+
+000000000000163e <shmat>:
+SYSCALL(shmat)
+    163e:	b8 31 00 00 00       	mov    $0x31,%eax
+    1643:	49 89 ca             	mov    %rcx,%r10
+    1646:	0f 05                	syscall
+    1648:	c3                   	ret
+
+0000000000001649 <shmdt>:
+SYSCALL(shmdt)
+    1649:	b8 32 00 00 00       	mov    $0x32,%eax
+    164e:	49 89 ca             	mov    %rcx,%r10
+    1651:	0f 05                	syscall
+    1653:	c3                   	ret
+
+0000000000001654 <ring_setup>:
+SYSCALL(ring_setup)
+    1654:	b8 33 00 00 00       	mov    $0x33,%eax
+    1659:	49 89 ca             	mov    %rcx,%r10
+    165c:	0f 05                	syscall
+    165e:	c3                   	ret
+
+000000000000165f <ring_enter>:
+SYSCALL(ring_enter)
+    165f:	b8 34 00 00 00       	mov    $0x34,%eax
+    1664:	49 89 ca             	mov    %rcx,%r10
+    1667:	0f 05                	syscall
+    1669:	c3                   	ret
+
+000000000000166a <getdents>:
+SYSCALL(getdents)
+    166a:	b8 35 00 00 00       	mov    $0x35,%eax
+    166f:	49 89 ca             	mov    %rcx,%r10
+    1672:	0f 05                	syscall
+    1674:	c3                   	ret
+
+0000000000001675 <fstatat>:
+SYSCALL(fstatat)
+    1675:	b8 36 00 00 00       	mov    $0x36,%eax
+    167a:	49 89 ca             	mov    %rcx,%r10
+    167d:	0f 05                	syscall
+    167f:	c3                   	ret
+
+0000000000001680 <clone_file>:
+SYSCALL(clone_file)
+    1680:	b8 37 00 00 00       	mov    $0x37,%eax
+    1685:	49 89 ca             	mov    %rcx,%r10
+    1688:	0f 05                	syscall
+    168a:	c3                   	ret
+
+000000000000168b <fpunch>:
+SYSCALL(fpunch)
+    168b:	b8 38 00 00 00       	mov    $0x38,%eax
+    1690:	49 89 ca             	mov    %rcx,%r10
+    1693:	0f 05                	syscall
+    1695:	c3                   	ret
+
+0000000000001696 <defrag>:
+SYSCALL(defrag)
+    1696:	b8 39 00 00 00       	mov    $0x39,%eax
+    169b:	49 89 ca             	mov    %rcx,%r10
+    169e:	0f 05                	syscall
+    16a0:	c3                   	ret
+
+00000000000016a1 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    16a1:	55                   	push   %rbp
+    16a2:	48 89 e5             	mov    %rsp,%rbp
+    16a5:	48 83 ec 20          	sub    $0x20,%rsp
+    16a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    16ad:	bf 00 00 00 00       	mov    $0x0,%edi
+    16b2:	e8 3d fe ff ff       	call   14f4 <sbrk>
+    16b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    16bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16bf:	48 f7 d8             	neg    %rax
+    16c2:	25 ff 0f 00 00       	and    $0xfff,%eax
+    16c7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    16cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d3:	48 01 c2             	add    %rax,%rdx
+    16d6:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    16db:	48 39 c2             	cmp    %rax,%rdx
+    16de:	73 1e                	jae    16fe <morecore+0x5d>
+    16e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16e4:	89 c2                	mov    %eax,%edx
+    16e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ea:	01 d0                	add    %edx,%eax
+    16ec:	89 c7                	mov    %eax,%edi
+    16ee:	e8 01 fe ff ff       	call   14f4 <sbrk>
+    16f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16f7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    16fc:	75 07                	jne    1705 <morecore+0x64>
+    return 0;
+    16fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1703:	eb 27                	jmp    172c <morecore+0x8b>
+  stats.heap += n + pad;
+    1705:	48 8b 05 64 1c 00 00 	mov    0x1c64(%rip),%rax        # 3370 <stats+0x50>
+    170c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1710:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1714:	48 01 ca             	add    %rcx,%rdx
+    1717:	48 01 d0             	add    %rdx,%rax
+    171a:	48 89 05 4f 1c 00 00 	mov    %rax,0x1c4f(%rip)        # 3370 <stats+0x50>
+  return p + pad;
+    1721:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1725:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1729:	48 01 d0             	add    %rdx,%rax
+}
+    172c:	c9                   	leave
+    172d:	c3                   	ret
+
+000000000000172e <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    172e:	55                   	push   %rbp
+    172f:	48 89 e5             	mov    %rsp,%rbp
+    1732:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1736:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    173a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1741:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1742:	48 8d 05 b7 1b 00 00 	lea    0x1bb7(%rip),%rax        # 3300 <runs>
+    1749:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    174d:	eb 1a                	jmp    1769 <pagefree+0x3b>
+    prev = *rp;
+    174f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1753:	48 8b 00             	mov    (%rax),%rax
+    1756:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    175a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    175e:	48 8b 00             	mov    (%rax),%rax
+    1761:	48 83 c0 08          	add    $0x8,%rax
+    1765:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1769:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    176d:	48 8b 00             	mov    (%rax),%rax
+    1770:	48 85 c0             	test   %rax,%rax
+    1773:	74 0d                	je     1782 <pagefree+0x54>
+    1775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1779:	48 8b 00             	mov    (%rax),%rax
+    177c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1780:	72 cd                	jb     174f <pagefree+0x21>
+  r = (struct run *)p;
+    1782:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1786:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    178a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    178e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1792:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1795:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1799:	48 8b 10             	mov    (%rax),%rdx
+    179c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17a0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    17a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17ac:	48 85 c0             	test   %rax,%rax
+    17af:	74 48                	je     17f9 <pagefree+0xcb>
+    17b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    17b5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17b9:	48 01 c2             	add    %rax,%rdx
+    17bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17c4:	48 39 c2             	cmp    %rax,%rdx
+    17c7:	75 30                	jne    17f9 <pagefree+0xcb>
+    r->size += r->next->size;
+    17c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17cd:	48 8b 10             	mov    (%rax),%rdx
+    17d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17d8:	48 8b 00             	mov    (%rax),%rax
+    17db:	48 01 c2             	add    %rax,%rdx
+    17de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17e2:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    17e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17ed:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    17f9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17fe:	74 46                	je     1846 <pagefree+0x118>
+    1800:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1804:	48 8b 10             	mov    (%rax),%rdx
+    1807:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    180b:	48 01 d0             	add    %rdx,%rax
+    180e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1812:	75 32                	jne    1846 <pagefree+0x118>
+    prev->size += r->size;
+    1814:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1818:	48 8b 10             	mov    (%rax),%rdx
+    181b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    181f:	48 8b 00             	mov    (%rax),%rax
+    1822:	48 01 c2             	add    %rax,%rdx
+    1825:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1829:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    182c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1830:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1834:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1838:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    183c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1840:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1844:	eb 0c                	jmp    1852 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1846:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    184a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    184e:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1851:	90                   	nop
+    1852:	90                   	nop
+    1853:	5d                   	pop    %rbp
+    1854:	c3                   	ret
+
+0000000000001855 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1855:	55                   	push   %rbp
+    1856:	48 89 e5             	mov    %rsp,%rbp
+    1859:	48 83 ec 40          	sub    $0x40,%rsp
+    185d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1861:	48 8d 05 98 1a 00 00 	lea    0x1a98(%rip),%rax        # 3300 <runs>
+    1868:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    186c:	eb 66                	jmp    18d4 <pagealloc+0x7f>
+    if (r->size == n) {
+    186e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1872:	48 8b 00             	mov    (%rax),%rax
+    1875:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1879:	75 18                	jne    1893 <pagealloc+0x3e>
+      *rp = r->next;
+    187b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    187f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1887:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    188a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    188e:	e9 ca 00 00 00       	jmp    195d <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1893:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1897:	48 8b 00             	mov    (%rax),%rax
+    189a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    189e:	73 28                	jae    18c8 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    18a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a4:	48 8b 00             	mov    (%rax),%rax
+    18a7:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18ab:	48 89 c2             	mov    %rax,%rdx
+    18ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18b2:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    18b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18b9:	48 8b 10             	mov    (%rax),%rdx
+    18bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18c0:	48 01 d0             	add    %rdx,%rax
+    18c3:	e9 95 00 00 00       	jmp    195d <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    18c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18cc:	48 83 c0 08          	add    $0x8,%rax
+    18d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18d8:	48 8b 00             	mov    (%rax),%rax
+    18db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18df:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    18e4:	75 88                	jne    186e <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    18e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    18ea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    18ee:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    18f5:	00 
+    18f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    18fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18fe:	48 39 c2             	cmp    %rax,%rdx
+    1901:	48 0f 43 c2          	cmovae %rdx,%rax
+    1905:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1909:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    190d:	48 89 c7             	mov    %rax,%rdi
+    1910:	e8 8c fd ff ff       	call   16a1 <morecore>
+    1915:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1919:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    191e:	75 07                	jne    1927 <pagealloc+0xd2>
+    return 0;
+    1920:	b8 00 00 00 00       	mov    $0x0,%eax
+    1925:	eb 36                	jmp    195d <pagealloc+0x108>
+  if (m > n)
+    1927:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    192b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    192f:	73 1a                	jae    194b <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1931:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1935:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1939:	48 89 c2             	mov    %rax,%rdx
+    193c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1940:	48 89 d6             	mov    %rdx,%rsi
+    1943:	48 89 c7             	mov    %rax,%rdi
+    1946:	e8 e3 fd ff ff       	call   172e <pagefree>
+  return p + m - n;
+    194b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    194f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1953:	48 89 c2             	mov    %rax,%rdx
+    1956:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    195a:	48 01 d0             	add    %rdx,%rax
+}
+    195d:	c9                   	leave
+    195e:	c3                   	ret
+
+000000000000195f <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    195f:	55                   	push   %rbp
+    1960:	48 89 e5             	mov    %rsp,%rbp
+    1963:	48 83 ec 30          	sub    $0x30,%rsp
+    1967:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    196a:	bf 00 10 00 00       	mov    $0x1000,%edi
+    196f:	e8 e1 fe ff ff       	call   1855 <pagealloc>
+    1974:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1978:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    197d:	75 0a                	jne    1989 <refill+0x2a>
+    return -1;
+    197f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1984:	e9 da 00 00 00       	jmp    1a63 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1989:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1990:	00 
+    1991:	e9 ba 00 00 00       	jmp    1a50 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1996:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    199a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    199e:	48 01 d0             	add    %rdx,%rax
+    19a1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    19a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19a8:	ba 20 00 00 00       	mov    $0x20,%edx
+    19ad:	89 c1                	mov    %eax,%ecx
+    19af:	48 d3 e2             	shl    %cl,%rdx
+    19b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19b6:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    19b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19bc:	48 63 d0             	movslq %eax,%rdx
+    19bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19c3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    19c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19ca:	48 98                	cltq
+    19cc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    19d3:	00 
+    19d4:	48 8d 05 e5 18 00 00 	lea    0x18e5(%rip),%rax        # 32c0 <freelist>
+    19db:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    19df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19e3:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    19e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19ea:	48 98                	cltq
+    19ec:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    19f3:	00 
+    19f4:	48 8d 15 c5 18 00 00 	lea    0x18c5(%rip),%rdx        # 32c0 <freelist>
+    19fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19ff:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1a03:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a06:	48 98                	cltq
+    1a08:	48 83 c0 08          	add    $0x8,%rax
+    1a0c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a13:	00 
+    1a14:	48 8d 05 09 19 00 00 	lea    0x1909(%rip),%rax        # 3324 <stats+0x4>
+    1a1b:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a1e:	8d 48 01             	lea    0x1(%rax),%ecx
+    1a21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a24:	48 98                	cltq
+    1a26:	48 83 c0 08          	add    $0x8,%rax
+    1a2a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a31:	00 
+    1a32:	48 8d 05 eb 18 00 00 	lea    0x18eb(%rip),%rax        # 3324 <stats+0x4>
+    1a39:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1a3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a3f:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a44:	89 c1                	mov    %eax,%ecx
+    1a46:	48 d3 e2             	shl    %cl,%rdx
+    1a49:	48 89 d0             	mov    %rdx,%rax
+    1a4c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1a50:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1a57:	00 
+    1a58:	0f 86 38 ff ff ff    	jbe    1996 <refill+0x37>
+  }
+  return 0;
+    1a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a63:	c9                   	leave
+    1a64:	c3                   	ret
+
+0000000000001a65 <malloc>:
+
+void *malloc(uint nbytes) {
+    1a65:	55                   	push   %rbp
+    1a66:	48 89 e5             	mov    %rsp,%rbp
+    1a69:	48 83 ec 30          	sub    $0x30,%rsp
+    1a6d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1a70:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a73:	48 83 c0 10          	add    $0x10,%rax
+    1a77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1a7b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1a82:	eb 04                	jmp    1a88 <malloc+0x23>
+    1a84:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1a88:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1a8c:	7f 16                	jg     1aa4 <malloc+0x3f>
+    1a8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a91:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a96:	89 c1                	mov    %eax,%ecx
+    1a98:	48 d3 e2             	shl    %cl,%rdx
+    1a9b:	48 89 d0             	mov    %rdx,%rax
+    1a9e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1aa2:	72 e0                	jb     1a84 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1aa4:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1aa8:	75 7d                	jne    1b27 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1aaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aae:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1ab4:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1aba:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1abe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ac2:	48 89 c7             	mov    %rax,%rdi
+    1ac5:	e8 8b fd ff ff       	call   1855 <pagealloc>
+    1aca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1ace:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1ad3:	75 0a                	jne    1adf <malloc+0x7a>
+      return 0;
+    1ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ada:	e9 2c 01 00 00       	jmp    1c0b <malloc+0x1a6>
+    h->size = n;
+    1adf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ae3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ae7:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1aea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1aee:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1af5:	00 
+    stats.inuse[LARGE]++;
+    1af6:	8b 05 44 18 00 00    	mov    0x1844(%rip),%eax        # 3340 <stats+0x20>
+    1afc:	83 c0 01             	add    $0x1,%eax
+    1aff:	89 05 3b 18 00 00    	mov    %eax,0x183b(%rip)        # 3340 <stats+0x20>
+    stats.large += n;
+    1b05:	48 8b 15 5c 18 00 00 	mov    0x185c(%rip),%rdx        # 3368 <stats+0x48>
+    1b0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b10:	48 01 d0             	add    %rdx,%rax
+    1b13:	48 89 05 4e 18 00 00 	mov    %rax,0x184e(%rip)        # 3368 <stats+0x48>
+    return h + 1;
+    1b1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b1e:	48 83 c0 10          	add    $0x10,%rax
+    1b22:	e9 e4 00 00 00       	jmp    1c0b <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1b27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b2a:	48 98                	cltq
+    1b2c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b33:	00 
+    1b34:	48 8d 05 85 17 00 00 	lea    0x1785(%rip),%rax        # 32c0 <freelist>
+    1b3b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b3f:	48 85 c0             	test   %rax,%rax
+    1b42:	75 18                	jne    1b5c <malloc+0xf7>
+    1b44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b47:	89 c7                	mov    %eax,%edi
+    1b49:	e8 11 fe ff ff       	call   195f <refill>
+    1b4e:	85 c0                	test   %eax,%eax
+    1b50:	79 0a                	jns    1b5c <malloc+0xf7>
+    return 0;
+    1b52:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b57:	e9 af 00 00 00       	jmp    1c0b <malloc+0x1a6>
+  b = freelist[c];
+    1b5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b5f:	48 98                	cltq
+    1b61:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b68:	00 
+    1b69:	48 8d 05 50 17 00 00 	lea    0x1750(%rip),%rax        # 32c0 <freelist>
+    1b70:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b74:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1b78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b7c:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1b80:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1b83:	48 63 d2             	movslq %edx,%rdx
+    1b86:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1b8d:	00 
+    1b8e:	48 8d 15 2b 17 00 00 	lea    0x172b(%rip),%rdx        # 32c0 <freelist>
+    1b95:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1b99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b9c:	48 98                	cltq
+    1b9e:	48 83 c0 08          	add    $0x8,%rax
+    1ba2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ba9:	00 
+    1baa:	48 8d 05 73 17 00 00 	lea    0x1773(%rip),%rax        # 3324 <stats+0x4>
+    1bb1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bb4:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1bb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bba:	48 98                	cltq
+    1bbc:	48 83 c0 08          	add    $0x8,%rax
+    1bc0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bc7:	00 
+    1bc8:	48 8d 05 55 17 00 00 	lea    0x1755(%rip),%rax        # 3324 <stats+0x4>
+    1bcf:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1bd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bd5:	48 98                	cltq
+    1bd7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bde:	00 
+    1bdf:	48 8d 05 3a 17 00 00 	lea    0x173a(%rip),%rax        # 3320 <stats>
+    1be6:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1be9:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bef:	48 98                	cltq
+    1bf1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bf8:	00 
+    1bf9:	48 8d 05 20 17 00 00 	lea    0x1720(%rip),%rax        # 3320 <stats>
+    1c00:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1c03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c07:	48 83 c0 10          	add    $0x10,%rax
+}
+    1c0b:	c9                   	leave
+    1c0c:	c3                   	ret
+
+0000000000001c0d <free>:
+
+void free(void *ap) {
+    1c0d:	55                   	push   %rbp
+    1c0e:	48 89 e5             	mov    %rsp,%rbp
+    1c11:	48 83 ec 18          	sub    $0x18,%rsp
+    1c15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1c19:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1c1e:	0f 84 03 01 00 00    	je     1d27 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1c24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c28:	48 83 e8 10          	sub    $0x10,%rax
+    1c2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1c30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c34:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1c38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1c3c:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1c41:	75 42                	jne    1c85 <free+0x78>
+    stats.inuse[LARGE]--;
+    1c43:	8b 05 f7 16 00 00    	mov    0x16f7(%rip),%eax        # 3340 <stats+0x20>
+    1c49:	83 e8 01             	sub    $0x1,%eax
+    1c4c:	89 05 ee 16 00 00    	mov    %eax,0x16ee(%rip)        # 3340 <stats+0x20>
+    stats.large -= b->h.size;
+    1c52:	48 8b 15 0f 17 00 00 	mov    0x170f(%rip),%rdx        # 3368 <stats+0x48>
+    1c59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c5d:	48 8b 00             	mov    (%rax),%rax
+    1c60:	48 29 c2             	sub    %rax,%rdx
+    1c63:	48 89 15 fe 16 00 00 	mov    %rdx,0x16fe(%rip)        # 3368 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1c6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c6e:	48 8b 10             	mov    (%rax),%rdx
+    1c71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c75:	48 89 d6             	mov    %rdx,%rsi
+    1c78:	48 89 c7             	mov    %rax,%rdi
+    1c7b:	e8 ae fa ff ff       	call   172e <pagefree>
+    return;
+    1c80:	e9 a3 00 00 00       	jmp    1d28 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1c85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c89:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c90:	00 
+    1c91:	48 8d 05 28 16 00 00 	lea    0x1628(%rip),%rax        # 32c0 <freelist>
+    1c98:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1c9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1ca4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca8:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1caf:	00 
+    1cb0:	48 8d 15 09 16 00 00 	lea    0x1609(%rip),%rdx        # 32c0 <freelist>
+    1cb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cbb:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1cbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cc3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cca:	00 
+    1ccb:	48 8d 05 4e 16 00 00 	lea    0x164e(%rip),%rax        # 3320 <stats>
+    1cd2:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1cd5:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1cd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cdc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ce3:	00 
+    1ce4:	48 8d 05 35 16 00 00 	lea    0x1635(%rip),%rax        # 3320 <stats>
+    1ceb:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1cee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cf2:	48 83 c0 08          	add    $0x8,%rax
+    1cf6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cfd:	00 
+    1cfe:	48 8d 05 1f 16 00 00 	lea    0x161f(%rip),%rax        # 3324 <stats+0x4>
+    1d05:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d08:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d0f:	48 83 c0 08          	add    $0x8,%rax
+    1d13:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d1a:	00 
+    1d1b:	48 8d 05 02 16 00 00 	lea    0x1602(%rip),%rax        # 3324 <stats+0x4>
+    1d22:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1d25:	eb 01                	jmp    1d28 <free+0x11b>
+    return;
+    1d27:	90                   	nop
+}
+    1d28:	c9                   	leave
+    1d29:	c3                   	ret
+
+0000000000001d2a <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1d2a:	55                   	push   %rbp
+    1d2b:	48 89 e5             	mov    %rsp,%rbp
+    1d2e:	48 83 ec 30          	sub    $0x30,%rsp
+    1d32:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1d35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d38:	48 8d 15 99 02 00 00 	lea    0x299(%rip),%rdx        # 1fd8 <benchreport+0x186>
+    1d3f:	48 89 d6             	mov    %rdx,%rsi
+    1d42:	89 c7                	mov    %eax,%edi
+    1d44:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d49:	e8 37 e6 ff ff       	call   385 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d4e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1d55:	eb 67                	jmp    1dbe <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1d57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d5a:	48 98                	cltq
+    1d5c:	48 83 c0 08          	add    $0x8,%rax
+    1d60:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d67:	00 
+    1d68:	48 8d 05 b5 15 00 00 	lea    0x15b5(%rip),%rax        # 3324 <stats+0x4>
+    1d6f:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1d72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d75:	48 98                	cltq
+    1d77:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d7e:	00 
+    1d7f:	48 8d 05 9a 15 00 00 	lea    0x159a(%rip),%rax        # 3320 <stats>
+    1d86:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1d89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d8c:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d91:	89 c1                	mov    %eax,%ecx
+    1d93:	48 d3 e2             	shl    %cl,%rdx
+    1d96:	48 89 d0             	mov    %rdx,%rax
+    1d99:	89 c1                	mov    %eax,%ecx
+    1d9b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1d9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1da1:	41 89 f9             	mov    %edi,%r9d
+    1da4:	41 89 f0             	mov    %esi,%r8d
+    1da7:	48 8d 35 41 02 00 00 	lea    0x241(%rip),%rsi        # 1fef <benchreport+0x19d>
+    1dae:	89 c7                	mov    %eax,%edi
+    1db0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1db5:	e8 cb e5 ff ff       	call   385 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1dba:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1dbe:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1dc2:	7e 93                	jle    1d57 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1dc4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1dcb:	00 
+  for (r = runs; r; r = r->next)
+    1dcc:	48 8b 05 2d 15 00 00 	mov    0x152d(%rip),%rax        # 3300 <runs>
+    1dd3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1dd7:	eb 17                	jmp    1df0 <mallocstats+0xc6>
+    nfree += r->size;
+    1dd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ddd:	48 8b 00             	mov    (%rax),%rax
+    1de0:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de8:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1dec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1df0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1df5:	75 e2                	jne    1dd9 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1df7:	48 8b 05 72 15 00 00 	mov    0x1572(%rip),%rax        # 3370 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1dfe:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1e00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e04:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e08:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1e0a:	48 8b 05 57 15 00 00 	mov    0x1557(%rip),%rax        # 3368 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e11:	89 c1                	mov    %eax,%ecx
+    1e13:	8b 15 27 15 00 00    	mov    0x1527(%rip),%edx        # 3340 <stats+0x20>
+    1e19:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e1c:	41 89 f9             	mov    %edi,%r9d
+    1e1f:	41 89 f0             	mov    %esi,%r8d
+    1e22:	48 8d 35 d7 01 00 00 	lea    0x1d7(%rip),%rsi        # 2000 <benchreport+0x1ae>
+    1e29:	89 c7                	mov    %eax,%edi
+    1e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e30:	e8 50 e5 ff ff       	call   385 <printf>
+}
+    1e35:	90                   	nop
+    1e36:	c9                   	leave
+    1e37:	c3                   	ret
+
+0000000000001e38 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1e38:	55                   	push   %rbp
+    1e39:	48 89 e5             	mov    %rsp,%rbp
+    1e3c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1e40:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1e44:	48 89 c7             	mov    %rax,%rdi
+    1e47:	e8 9a f7 ff ff       	call   15e6 <cycles>
+  return t;
+    1e4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1e50:	c9                   	leave
+    1e51:	c3                   	ret
+
+0000000000001e52 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1e52:	55                   	push   %rbp
+    1e53:	48 89 e5             	mov    %rsp,%rbp
+    1e56:	48 83 ec 30          	sub    $0x30,%rsp
+    1e5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e62:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1e65:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1e69:	0f 8e 24 01 00 00    	jle    1f93 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1e6f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1e76:	e9 98 00 00 00       	jmp    1f13 <benchreport+0xc1>
+    x = t[i];
+    1e7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e7e:	48 98                	cltq
+    1e80:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e87:	00 
+    1e88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e8c:	48 01 d0             	add    %rdx,%rax
+    1e8f:	48 8b 00             	mov    (%rax),%rax
+    1e92:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e99:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1e9c:	eb 33                	jmp    1ed1 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1e9e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ea1:	48 98                	cltq
+    1ea3:	48 c1 e0 03          	shl    $0x3,%rax
+    1ea7:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1eab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1eaf:	48 01 d0             	add    %rdx,%rax
+    1eb2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1eb5:	48 63 d2             	movslq %edx,%rdx
+    1eb8:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1ebf:	00 
+    1ec0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1ec4:	48 01 ca             	add    %rcx,%rdx
+    1ec7:	48 8b 00             	mov    (%rax),%rax
+    1eca:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1ecd:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1ed1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1ed5:	7e 1d                	jle    1ef4 <benchreport+0xa2>
+    1ed7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1eda:	48 98                	cltq
+    1edc:	48 c1 e0 03          	shl    $0x3,%rax
+    1ee0:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ee4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ee8:	48 01 d0             	add    %rdx,%rax
+    1eeb:	48 8b 00             	mov    (%rax),%rax
+    1eee:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1ef2:	72 aa                	jb     1e9e <benchreport+0x4c>
+    t[j] = x;
+    1ef4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ef7:	48 98                	cltq
+    1ef9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f00:	00 
+    1f01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f05:	48 01 c2             	add    %rax,%rdx
+    1f08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f0c:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1f0f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1f13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f16:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1f19:	0f 8c 5c ff ff ff    	jl     1e7b <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1f1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f22:	48 98                	cltq
+    1f24:	48 c1 e0 03          	shl    $0x3,%rax
+    1f28:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1f2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f30:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f33:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1f36:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f39:	89 c2                	mov    %eax,%edx
+    1f3b:	c1 ea 1f             	shr    $0x1f,%edx
+    1f3e:	01 d0                	add    %edx,%eax
+    1f40:	d1 f8                	sar    %eax
+    1f42:	48 98                	cltq
+    1f44:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f4b:	00 
+    1f4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f50:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f53:	48 8b 38             	mov    (%rax),%rdi
+    1f56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f5a:	48 8b 30             	mov    (%rax),%rsi
+    1f5d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f64:	48 83 ec 08          	sub    $0x8,%rsp
+    1f68:	51                   	push   %rcx
+    1f69:	49 89 f9             	mov    %rdi,%r9
+    1f6c:	49 89 f0             	mov    %rsi,%r8
+    1f6f:	89 d1                	mov    %edx,%ecx
+    1f71:	48 89 c2             	mov    %rax,%rdx
+    1f74:	48 8d 05 c5 00 00 00 	lea    0xc5(%rip),%rax        # 2040 <benchreport+0x1ee>
+    1f7b:	48 89 c6             	mov    %rax,%rsi
+    1f7e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f83:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f88:	e8 f8 e3 ff ff       	call   385 <printf>
+    1f8d:	48 83 c4 10          	add    $0x10,%rsp
+    1f91:	eb 01                	jmp    1f94 <benchreport+0x142>
+    return;
+    1f93:	90                   	nop
+}
+    1f94:	c9                   	leave
+    1f95:	c3                   	ret
@@ -0,0 +1,3434 @@
+
+out/user/_defrag:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <fcntl.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+       b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, fd, n;
+
+  if (argc < 2) {
+       f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+      13:	7f 1e                	jg     33 <main+0x33>
+    printf(2, "Usage: defrag files...\n");
+      15:	48 8d 05 fc 1e 00 00 	lea    0x1efc(%rip),%rax        # 1f18 <benchreport+0x14a>
+      1c:	48 89 c6             	mov    %rax,%rsi
+      1f:	bf 02 00 00 00       	mov    $0x2,%edi
+      24:	b8 00 00 00 00       	mov    $0x0,%eax
+      29:	e8 d3 02 00 00       	call   301 <printf>
+    exit();
+      2e:	e8 fe 08 00 00       	call   931 <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+      33:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      3a:	e9 f3 00 00 00       	jmp    132 <main+0x132>
+    if ((fd = open(argv[i], O_RDWR)) < 0) {
+      3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      42:	48 98                	cltq
+      44:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      4b:	00 
+      4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      50:	48 01 d0             	add    %rdx,%rax
+      53:	48 8b 00             	mov    (%rax),%rax
+      56:	be 02 00 00 00       	mov    $0x2,%esi
+      5b:	48 89 c7             	mov    %rax,%rdi
+      5e:	e8 aa 13 00 00       	call   140d <open>
+      63:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      66:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      6a:	79 38                	jns    a4 <main+0xa4>
+      printf(2, "defrag: cannot open %s\n", argv[i]);
+      6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      6f:	48 98                	cltq
+      71:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      78:	00 
+      79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      7d:	48 01 d0             	add    %rdx,%rax
+      80:	48 8b 00             	mov    (%rax),%rax
+      83:	48 89 c2             	mov    %rax,%rdx
+      86:	48 8d 05 a3 1e 00 00 	lea    0x1ea3(%rip),%rax        # 1f30 <benchreport+0x162>
+      8d:	48 89 c6             	mov    %rax,%rsi
+      90:	bf 02 00 00 00       	mov    $0x2,%edi
+      95:	b8 00 00 00 00       	mov    $0x0,%eax
+      9a:	e8 62 02 00 00       	call   301 <printf>
+      continue;
+      9f:	e9 8a 00 00 00       	jmp    12e <main+0x12e>
+    }
+    if ((n = defrag(fd)) < 0)
+      a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      a7:	89 c7                	mov    %eax,%edi
+      a9:	e8 64 15 00 00       	call   1612 <defrag>
+      ae:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      b1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+      b5:	79 35                	jns    ec <main+0xec>
+      printf(2, "defrag: %s failed\n", argv[i]);
+      b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      ba:	48 98                	cltq
+      bc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      c3:	00 
+      c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      c8:	48 01 d0             	add    %rdx,%rax
+      cb:	48 8b 00             	mov    (%rax),%rax
+      ce:	48 89 c2             	mov    %rax,%rdx
+      d1:	48 8d 05 70 1e 00 00 	lea    0x1e70(%rip),%rax        # 1f48 <benchreport+0x17a>
+      d8:	48 89 c6             	mov    %rax,%rsi
+      db:	bf 02 00 00 00       	mov    $0x2,%edi
+      e0:	b8 00 00 00 00       	mov    $0x0,%eax
+      e5:	e8 17 02 00 00       	call   301 <printf>
+      ea:	eb 38                	jmp    124 <main+0x124>
+    else
+      printf(1, "%s: %d extents\n", argv[i], n);
+      ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      ef:	48 98                	cltq
+      f1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      f8:	00 
+      f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      fd:	48 01 d0             	add    %rdx,%rax
+     100:	48 8b 00             	mov    (%rax),%rax
+     103:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     106:	89 d1                	mov    %edx,%ecx
+     108:	48 89 c2             	mov    %rax,%rdx
+     10b:	48 8d 05 49 1e 00 00 	lea    0x1e49(%rip),%rax        # 1f5b <benchreport+0x18d>
+     112:	48 89 c6             	mov    %rax,%rsi
+     115:	bf 01 00 00 00       	mov    $0x1,%edi
+     11a:	b8 00 00 00 00       	mov    $0x0,%eax
+     11f:	e8 dd 01 00 00       	call   301 <printf>
+    close(fd);
+     124:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     127:	89 c7                	mov    %eax,%edi
+     129:	e8 6d 08 00 00       	call   99b <close>
+  for (i = 1; i < argc; i++) {
+     12e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     132:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     135:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     138:	0f 8c 01 ff ff ff    	jl     3f <main+0x3f>
+  }
+
+  exit();
+     13e:	e8 ee 07 00 00       	call   931 <exit>
+
+0000000000000143 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     143:	55                   	push   %rbp
+     144:	48 89 e5             	mov    %rsp,%rbp
+     147:	48 83 ec 10          	sub    $0x10,%rsp
+     14b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     14e:	89 f0                	mov    %esi,%eax
+     150:	88 45 f8             	mov    %al,-0x8(%rbp)
+     153:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     157:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     15a:	89 d6                	mov    %edx,%esi
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	e8 eb 06 00 00       	call   84e <bputc>
+     163:	90                   	nop
+     164:	c9                   	leave
+     165:	c3                   	ret
+
+0000000000000166 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     166:	55                   	push   %rbp
+     167:	48 89 e5             	mov    %rsp,%rbp
+     16a:	48 83 ec 50          	sub    $0x50,%rsp
+     16e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     171:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     175:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     178:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     17b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     17f:	74 21                	je     1a2 <printint64+0x3c>
+     181:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     185:	48 c1 e8 3f          	shr    $0x3f,%rax
+     189:	0f b6 c0             	movzbl %al,%eax
+     18c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     18f:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     193:	74 0d                	je     1a2 <printint64+0x3c>
+    x = -xx;
+     195:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     199:	48 f7 d8             	neg    %rax
+     19c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     1a0:	eb 08                	jmp    1aa <printint64+0x44>
+  else
+    x = xx;
+     1a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     1aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1b1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     1b4:	48 63 c8             	movslq %eax,%rcx
+     1b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1bb:	ba 00 00 00 00       	mov    $0x0,%edx
+     1c0:	48 f7 f1             	div    %rcx
+     1c3:	48 89 d1             	mov    %rdx,%rcx
+     1c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1c9:	8d 50 01             	lea    0x1(%rax),%edx
+     1cc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1cf:	48 8d 15 2a 2e 00 00 	lea    0x2e2a(%rip),%rdx        # 3000 <digits.1>
+     1d6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     1da:	48 98                	cltq
+     1dc:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     1e0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     1e3:	48 63 f0             	movslq %eax,%rsi
+     1e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1ea:	ba 00 00 00 00       	mov    $0x0,%edx
+     1ef:	48 f7 f6             	div    %rsi
+     1f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     1f6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     1fb:	75 b4                	jne    1b1 <printint64+0x4b>
+
+  if (sgn)
+     1fd:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     201:	74 2b                	je     22e <printint64+0xc8>
+    buf[i++] = '-';
+     203:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     206:	8d 50 01             	lea    0x1(%rax),%edx
+     209:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     20c:	48 98                	cltq
+     20e:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     213:	eb 19                	jmp    22e <printint64+0xc8>
+    putc(fd, buf[i]);
+     215:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     218:	48 98                	cltq
+     21a:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     21f:	0f be d0             	movsbl %al,%edx
+     222:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     225:	89 d6                	mov    %edx,%esi
+     227:	89 c7                	mov    %eax,%edi
+     229:	e8 15 ff ff ff       	call   143 <putc>
+  while (--i >= 0)
+     22e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     232:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     236:	79 dd                	jns    215 <printint64+0xaf>
+}
+     238:	90                   	nop
+     239:	90                   	nop
+     23a:	c9                   	leave
+     23b:	c3                   	ret
+
+000000000000023c <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     23c:	55                   	push   %rbp
+     23d:	48 89 e5             	mov    %rsp,%rbp
+     240:	48 83 ec 30          	sub    $0x30,%rsp
+     244:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     247:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     24a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     24d:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     250:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     257:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     25b:	74 17                	je     274 <printint+0x38>
+     25d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     261:	79 11                	jns    274 <printint+0x38>
+    neg = 1;
+     263:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     26a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     26d:	f7 d8                	neg    %eax
+     26f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     272:	eb 06                	jmp    27a <printint+0x3e>
+  } else {
+    x = xx;
+     274:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     277:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     27a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     281:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     284:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     287:	ba 00 00 00 00       	mov    $0x0,%edx
+     28c:	f7 f1                	div    %ecx
+     28e:	89 d1                	mov    %edx,%ecx
+     290:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     293:	8d 50 01             	lea    0x1(%rax),%edx
+     296:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     299:	89 c9                	mov    %ecx,%ecx
+     29b:	48 8d 15 7e 2d 00 00 	lea    0x2d7e(%rip),%rdx        # 3020 <digits.0>
+     2a2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     2a6:	48 98                	cltq
+     2a8:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     2ac:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     2af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2b2:	ba 00 00 00 00       	mov    $0x0,%edx
+     2b7:	f7 f6                	div    %esi
+     2b9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     2bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     2c0:	75 bf                	jne    281 <printint+0x45>
+  if (neg)
+     2c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     2c6:	74 2b                	je     2f3 <printint+0xb7>
+    buf[i++] = '-';
+     2c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2cb:	8d 50 01             	lea    0x1(%rax),%edx
+     2ce:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2d1:	48 98                	cltq
+     2d3:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     2d8:	eb 19                	jmp    2f3 <printint+0xb7>
+    putc(fd, buf[i]);
+     2da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2dd:	48 98                	cltq
+     2df:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     2e4:	0f be d0             	movsbl %al,%edx
+     2e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     2ea:	89 d6                	mov    %edx,%esi
+     2ec:	89 c7                	mov    %eax,%edi
+     2ee:	e8 50 fe ff ff       	call   143 <putc>
+  while (--i >= 0)
+     2f3:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     2f7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2fb:	79 dd                	jns    2da <printint+0x9e>
+}
+     2fd:	90                   	nop
+     2fe:	90                   	nop
+     2ff:	c9                   	leave
+     300:	c3                   	ret
+
+0000000000000301 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     301:	55                   	push   %rbp
+     302:	48 89 e5             	mov    %rsp,%rbp
+     305:	48 83 ec 70          	sub    $0x70,%rsp
+     309:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     30c:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     310:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     314:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     318:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     31c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     320:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     327:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     32b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     32f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     333:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     337:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     33e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     345:	e9 67 02 00 00       	jmp    5b1 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     34a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     34d:	48 63 d0             	movslq %eax,%rdx
+     350:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     354:	48 01 d0             	add    %rdx,%rax
+     357:	0f b6 00             	movzbl (%rax),%eax
+     35a:	0f be c0             	movsbl %al,%eax
+     35d:	25 ff 00 00 00       	and    $0xff,%eax
+     362:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     365:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     369:	75 30                	jne    39b <printf+0x9a>
+      if (c == '%') {
+     36b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     36f:	75 13                	jne    384 <printf+0x83>
+        state = '%';
+     371:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     378:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     37f:	e9 29 02 00 00       	jmp    5ad <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     384:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     387:	0f be d0             	movsbl %al,%edx
+     38a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     38d:	89 d6                	mov    %edx,%esi
+     38f:	89 c7                	mov    %eax,%edi
+     391:	e8 ad fd ff ff       	call   143 <putc>
+     396:	e9 12 02 00 00       	jmp    5ad <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     39b:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     39f:	0f 85 08 02 00 00    	jne    5ad <printf+0x2ac>
+      if (c == 'l') {
+     3a5:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     3a9:	75 0c                	jne    3b7 <printf+0xb6>
+        lflag = 1;
+     3ab:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     3b2:	e9 f6 01 00 00       	jmp    5ad <printf+0x2ac>
+      } else if (c == 'd') {
+     3b7:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     3bb:	0f 85 93 00 00 00    	jne    454 <printf+0x153>
+        if (lflag == 1)
+     3c1:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     3c5:	75 47                	jne    40e <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     3c7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3ca:	83 f8 2f             	cmp    $0x2f,%eax
+     3cd:	77 17                	ja     3e6 <printf+0xe5>
+     3cf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3d3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3d6:	89 d2                	mov    %edx,%edx
+     3d8:	48 01 d0             	add    %rdx,%rax
+     3db:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3de:	83 c2 08             	add    $0x8,%edx
+     3e1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3e4:	eb 0c                	jmp    3f2 <printf+0xf1>
+     3e6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3ea:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3ee:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3f2:	48 8b 30             	mov    (%rax),%rsi
+     3f5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     3fd:	ba 0a 00 00 00       	mov    $0xa,%edx
+     402:	89 c7                	mov    %eax,%edi
+     404:	e8 5d fd ff ff       	call   166 <printint64>
+     409:	e9 98 01 00 00       	jmp    5a6 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     40e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     411:	83 f8 2f             	cmp    $0x2f,%eax
+     414:	77 17                	ja     42d <printf+0x12c>
+     416:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     41a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     41d:	89 d2                	mov    %edx,%edx
+     41f:	48 01 d0             	add    %rdx,%rax
+     422:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     425:	83 c2 08             	add    $0x8,%edx
+     428:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     42b:	eb 0c                	jmp    439 <printf+0x138>
+     42d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     431:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     435:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     439:	8b 30                	mov    (%rax),%esi
+     43b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     43e:	b9 01 00 00 00       	mov    $0x1,%ecx
+     443:	ba 0a 00 00 00       	mov    $0xa,%edx
+     448:	89 c7                	mov    %eax,%edi
+     44a:	e8 ed fd ff ff       	call   23c <printint>
+     44f:	e9 52 01 00 00       	jmp    5a6 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     454:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     458:	74 0a                	je     464 <printf+0x163>
+     45a:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     45e:	0f 85 93 00 00 00    	jne    4f7 <printf+0x1f6>
+        if (lflag == 1)
+     464:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     468:	75 47                	jne    4b1 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     46a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     46d:	83 f8 2f             	cmp    $0x2f,%eax
+     470:	77 17                	ja     489 <printf+0x188>
+     472:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     476:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     479:	89 d2                	mov    %edx,%edx
+     47b:	48 01 d0             	add    %rdx,%rax
+     47e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     481:	83 c2 08             	add    $0x8,%edx
+     484:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     487:	eb 0c                	jmp    495 <printf+0x194>
+     489:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     48d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     491:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     495:	48 8b 30             	mov    (%rax),%rsi
+     498:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     49b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4a0:	ba 10 00 00 00       	mov    $0x10,%edx
+     4a5:	89 c7                	mov    %eax,%edi
+     4a7:	e8 ba fc ff ff       	call   166 <printint64>
+        if (lflag == 1)
+     4ac:	e9 f5 00 00 00       	jmp    5a6 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     4b1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4b4:	83 f8 2f             	cmp    $0x2f,%eax
+     4b7:	77 17                	ja     4d0 <printf+0x1cf>
+     4b9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4bd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4c0:	89 d2                	mov    %edx,%edx
+     4c2:	48 01 d0             	add    %rdx,%rax
+     4c5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4c8:	83 c2 08             	add    $0x8,%edx
+     4cb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4ce:	eb 0c                	jmp    4dc <printf+0x1db>
+     4d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4d4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4d8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4dc:	8b 30                	mov    (%rax),%esi
+     4de:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4e6:	ba 10 00 00 00       	mov    $0x10,%edx
+     4eb:	89 c7                	mov    %eax,%edi
+     4ed:	e8 4a fd ff ff       	call   23c <printint>
+        if (lflag == 1)
+     4f2:	e9 af 00 00 00       	jmp    5a6 <printf+0x2a5>
+      } else if (c == 's') {
+     4f7:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     4fb:	75 6e                	jne    56b <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     4fd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     500:	83 f8 2f             	cmp    $0x2f,%eax
+     503:	77 17                	ja     51c <printf+0x21b>
+     505:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     509:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     50c:	89 d2                	mov    %edx,%edx
+     50e:	48 01 d0             	add    %rdx,%rax
+     511:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     514:	83 c2 08             	add    $0x8,%edx
+     517:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     51a:	eb 0c                	jmp    528 <printf+0x227>
+     51c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     520:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     524:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     528:	48 8b 00             	mov    (%rax),%rax
+     52b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     52f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     534:	75 28                	jne    55e <printf+0x25d>
+          s = "(null)";
+     536:	48 8d 05 2e 1a 00 00 	lea    0x1a2e(%rip),%rax        # 1f6b <benchreport+0x19d>
+     53d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     541:	eb 1b                	jmp    55e <printf+0x25d>
+          putc(fd, *s);
+     543:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     547:	0f b6 00             	movzbl (%rax),%eax
+     54a:	0f be d0             	movsbl %al,%edx
+     54d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     550:	89 d6                	mov    %edx,%esi
+     552:	89 c7                	mov    %eax,%edi
+     554:	e8 ea fb ff ff       	call   143 <putc>
+        for (; *s; s++)
+     559:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     55e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     562:	0f b6 00             	movzbl (%rax),%eax
+     565:	84 c0                	test   %al,%al
+     567:	75 da                	jne    543 <printf+0x242>
+     569:	eb 3b                	jmp    5a6 <printf+0x2a5>
+      } else if (c == '%') {
+     56b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     56f:	75 14                	jne    585 <printf+0x284>
+        putc(fd, c);
+     571:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     574:	0f be d0             	movsbl %al,%edx
+     577:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     57a:	89 d6                	mov    %edx,%esi
+     57c:	89 c7                	mov    %eax,%edi
+     57e:	e8 c0 fb ff ff       	call   143 <putc>
+     583:	eb 21                	jmp    5a6 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     585:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     588:	be 25 00 00 00       	mov    $0x25,%esi
+     58d:	89 c7                	mov    %eax,%edi
+     58f:	e8 af fb ff ff       	call   143 <putc>
+        putc(fd, c);
+     594:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     597:	0f be d0             	movsbl %al,%edx
+     59a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     59d:	89 d6                	mov    %edx,%esi
+     59f:	89 c7                	mov    %eax,%edi
+     5a1:	e8 9d fb ff ff       	call   143 <putc>
+      }
+      state = 0;
+     5a6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     5ad:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     5b1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     5b4:	48 63 d0             	movslq %eax,%rdx
+     5b7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     5bb:	48 01 d0             	add    %rdx,%rax
+     5be:	0f b6 00             	movzbl (%rax),%eax
+     5c1:	84 c0                	test   %al,%al
+     5c3:	0f 85 81 fd ff ff    	jne    34a <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     5c9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5cc:	89 c7                	mov    %eax,%edi
+     5ce:	e8 ee 02 00 00       	call   8c1 <bflushtty>
+}
+     5d3:	90                   	nop
+     5d4:	c9                   	leave
+     5d5:	c3                   	ret
+
+00000000000005d6 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     5d6:	55                   	push   %rbp
+     5d7:	48 89 e5             	mov    %rsp,%rbp
+     5da:	48 83 ec 30          	sub    $0x30,%rsp
+     5de:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     5e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     5e5:	78 06                	js     5ed <getbuf+0x17>
+     5e7:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     5eb:	7e 0a                	jle    5f7 <getbuf+0x21>
+    return 0;
+     5ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f2:	e9 94 00 00 00       	jmp    68b <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     5f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5fa:	48 98                	cltq
+     5fc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     603:	00 
+     604:	48 8d 05 35 2a 00 00 	lea    0x2a35(%rip),%rax        # 3040 <obufs>
+     60b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     60f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     613:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     618:	75 6d                	jne    687 <getbuf+0xb1>
+     61a:	bf 08 02 00 00       	mov    $0x208,%edi
+     61f:	e8 bd 13 00 00       	call   19e1 <malloc>
+     624:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     628:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     62d:	74 58                	je     687 <getbuf+0xb1>
+    b->n = 0;
+     62f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     633:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     639:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     63d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     640:	48 89 d6             	mov    %rdx,%rsi
+     643:	89 c7                	mov    %eax,%edi
+     645:	e8 e4 0d 00 00       	call   142e <fstat>
+     64a:	85 c0                	test   %eax,%eax
+     64c:	75 11                	jne    65f <getbuf+0x89>
+     64e:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     652:	66 83 f8 03          	cmp    $0x3,%ax
+     656:	75 07                	jne    65f <getbuf+0x89>
+     658:	ba 01 00 00 00       	mov    $0x1,%edx
+     65d:	eb 05                	jmp    664 <getbuf+0x8e>
+     65f:	ba 00 00 00 00       	mov    $0x0,%edx
+     664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     668:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     66b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     66e:	48 98                	cltq
+     670:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     677:	00 
+     678:	48 8d 15 c1 29 00 00 	lea    0x29c1(%rip),%rdx        # 3040 <obufs>
+     67f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     683:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     687:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     68b:	c9                   	leave
+     68c:	c3                   	ret
+
+000000000000068d <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     68d:	55                   	push   %rbp
+     68e:	48 89 e5             	mov    %rsp,%rbp
+     691:	48 83 ec 20          	sub    $0x20,%rsp
+     695:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     698:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     69c:	78 33                	js     6d1 <bflush+0x44>
+     69e:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     6a2:	7f 2d                	jg     6d1 <bflush+0x44>
+     6a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6a7:	48 98                	cltq
+     6a9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     6b0:	00 
+     6b1:	48 8d 05 88 29 00 00 	lea    0x2988(%rip),%rax        # 3040 <obufs>
+     6b8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     6bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6c0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6c5:	74 0a                	je     6d1 <bflush+0x44>
+     6c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6cb:	8b 00                	mov    (%rax),%eax
+     6cd:	85 c0                	test   %eax,%eax
+     6cf:	75 07                	jne    6d8 <bflush+0x4b>
+    return 0;
+     6d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d6:	eb 3c                	jmp    714 <bflush+0x87>
+  n = b->n;
+     6d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6dc:	8b 00                	mov    (%rax),%eax
+     6de:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     6e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6e5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     6eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6ef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     6f3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     6f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6f9:	48 89 ce             	mov    %rcx,%rsi
+     6fc:	89 c7                	mov    %eax,%edi
+     6fe:	e8 de 0c 00 00       	call   13e1 <write>
+     703:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     706:	75 07                	jne    70f <bflush+0x82>
+     708:	b8 00 00 00 00       	mov    $0x0,%eax
+     70d:	eb 05                	jmp    714 <bflush+0x87>
+     70f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     714:	c9                   	leave
+     715:	c3                   	ret
+
+0000000000000716 <bflushall>:
+
+void bflushall(void) {
+     716:	55                   	push   %rbp
+     717:	48 89 e5             	mov    %rsp,%rbp
+     71a:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     71e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     725:	eb 0e                	jmp    735 <bflushall+0x1f>
+    bflush(fd);
+     727:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     72a:	89 c7                	mov    %eax,%edi
+     72c:	e8 5c ff ff ff       	call   68d <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     731:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     735:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     739:	7e ec                	jle    727 <bflushall+0x11>
+}
+     73b:	90                   	nop
+     73c:	90                   	nop
+     73d:	c9                   	leave
+     73e:	c3                   	ret
+
+000000000000073f <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     73f:	55                   	push   %rbp
+     740:	48 89 e5             	mov    %rsp,%rbp
+     743:	48 83 ec 30          	sub    $0x30,%rsp
+     747:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     74a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     74e:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     751:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     754:	89 c7                	mov    %eax,%edi
+     756:	e8 7b fe ff ff       	call   5d6 <getbuf>
+     75b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     75f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     764:	75 19                	jne    77f <bwrite+0x40>
+    return write(fd, s, n);
+     766:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     769:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     76d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     770:	48 89 ce             	mov    %rcx,%rsi
+     773:	89 c7                	mov    %eax,%edi
+     775:	e8 67 0c 00 00       	call   13e1 <write>
+     77a:	e9 cd 00 00 00       	jmp    84c <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     77f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     786:	e9 92 00 00 00       	jmp    81d <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     78b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     78f:	8b 00                	mov    (%rax),%eax
+     791:	3d 00 02 00 00       	cmp    $0x200,%eax
+     796:	75 18                	jne    7b0 <bwrite+0x71>
+     798:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     79b:	89 c7                	mov    %eax,%edi
+     79d:	e8 eb fe ff ff       	call   68d <bflush>
+     7a2:	85 c0                	test   %eax,%eax
+     7a4:	79 0a                	jns    7b0 <bwrite+0x71>
+      return -1;
+     7a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7ab:	e9 9c 00 00 00       	jmp    84c <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     7b0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7b3:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     7b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     7b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7bd:	8b 00                	mov    (%rax),%eax
+     7bf:	ba 00 02 00 00       	mov    $0x200,%edx
+     7c4:	29 c2                	sub    %eax,%edx
+     7c6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     7c9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     7cc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     7cf:	39 c2                	cmp    %eax,%edx
+     7d1:	0f 4e c2             	cmovle %edx,%eax
+     7d4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     7d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7da:	48 63 d0             	movslq %eax,%rdx
+     7dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     7e1:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     7e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7e9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     7ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7f1:	8b 00                	mov    (%rax),%eax
+     7f3:	48 98                	cltq
+     7f5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     7f9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     7fc:	89 c2                	mov    %eax,%edx
+     7fe:	48 89 cf             	mov    %rcx,%rdi
+     801:	e8 e9 06 00 00       	call   eef <memmove>
+    b->n += m;
+     806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     80a:	8b 10                	mov    (%rax),%edx
+     80c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     80f:	01 c2                	add    %eax,%edx
+     811:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     815:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     817:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     81a:	01 45 fc             	add    %eax,-0x4(%rbp)
+     81d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     820:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     823:	0f 8c 62 ff ff ff    	jl     78b <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     829:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     82d:	8b 40 04             	mov    0x4(%rax),%eax
+     830:	85 c0                	test   %eax,%eax
+     832:	74 15                	je     849 <bwrite+0x10a>
+     834:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     837:	89 c7                	mov    %eax,%edi
+     839:	e8 4f fe ff ff       	call   68d <bflush>
+     83e:	85 c0                	test   %eax,%eax
+     840:	79 07                	jns    849 <bwrite+0x10a>
+    return -1;
+     842:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     847:	eb 03                	jmp    84c <bwrite+0x10d>
+  return n;
+     849:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     84c:	c9                   	leave
+     84d:	c3                   	ret
+
+000000000000084e <bputc>:
+
+void bputc(int fd, char c) {
+     84e:	55                   	push   %rbp
+     84f:	48 89 e5             	mov    %rsp,%rbp
+     852:	48 83 ec 20          	sub    $0x20,%rsp
+     856:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     859:	89 f0                	mov    %esi,%eax
+     85b:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     85e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     861:	89 c7                	mov    %eax,%edi
+     863:	e8 6e fd ff ff       	call   5d6 <getbuf>
+     868:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     86c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     871:	75 18                	jne    88b <bputc+0x3d>
+    write(fd, &c, 1);
+     873:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     877:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     87a:	ba 01 00 00 00       	mov    $0x1,%edx
+     87f:	48 89 ce             	mov    %rcx,%rsi
+     882:	89 c7                	mov    %eax,%edi
+     884:	e8 58 0b 00 00       	call   13e1 <write>
+    return;
+     889:	eb 34                	jmp    8bf <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     88b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     88f:	8b 00                	mov    (%rax),%eax
+     891:	3d 00 02 00 00       	cmp    $0x200,%eax
+     896:	75 0a                	jne    8a2 <bputc+0x54>
+    bflush(fd);
+     898:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     89b:	89 c7                	mov    %eax,%edi
+     89d:	e8 eb fd ff ff       	call   68d <bflush>
+  b->data[b->n++] = c;
+     8a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8a6:	8b 00                	mov    (%rax),%eax
+     8a8:	8d 48 01             	lea    0x1(%rax),%ecx
+     8ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8af:	89 0a                	mov    %ecx,(%rdx)
+     8b1:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     8b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8b9:	48 98                	cltq
+     8bb:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     8bf:	c9                   	leave
+     8c0:	c3                   	ret
+
+00000000000008c1 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     8c1:	55                   	push   %rbp
+     8c2:	48 89 e5             	mov    %rsp,%rbp
+     8c5:	48 83 ec 10          	sub    $0x10,%rsp
+     8c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     8cc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8d0:	78 4c                	js     91e <bflushtty+0x5d>
+     8d2:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     8d6:	7f 46                	jg     91e <bflushtty+0x5d>
+     8d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8db:	48 98                	cltq
+     8dd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8e4:	00 
+     8e5:	48 8d 05 54 27 00 00 	lea    0x2754(%rip),%rax        # 3040 <obufs>
+     8ec:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8f0:	48 85 c0             	test   %rax,%rax
+     8f3:	74 29                	je     91e <bflushtty+0x5d>
+     8f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8f8:	48 98                	cltq
+     8fa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     901:	00 
+     902:	48 8d 05 37 27 00 00 	lea    0x2737(%rip),%rax        # 3040 <obufs>
+     909:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     90d:	8b 40 04             	mov    0x4(%rax),%eax
+     910:	85 c0                	test   %eax,%eax
+     912:	74 0a                	je     91e <bflushtty+0x5d>
+    bflush(fd);
+     914:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     917:	89 c7                	mov    %eax,%edi
+     919:	e8 6f fd ff ff       	call   68d <bflush>
+}
+     91e:	90                   	nop
+     91f:	c9                   	leave
+     920:	c3                   	ret
+
+0000000000000921 <fork>:
+
+int fork(void) {
+     921:	55                   	push   %rbp
+     922:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     925:	e8 ec fd ff ff       	call   716 <bflushall>
+  return _fork();
+     92a:	e8 7b 0a 00 00       	call   13aa <_fork>
+}
+     92f:	5d                   	pop    %rbp
+     930:	c3                   	ret
+
+0000000000000931 <exit>:
+
+noreturn void exit(void) {
+     931:	55                   	push   %rbp
+     932:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     935:	e8 dc fd ff ff       	call   716 <bflushall>
+  _exit();
+     93a:	e8 76 0a 00 00       	call   13b5 <_exit>
+
+000000000000093f <exec>:
+}
+
+int exec(char *path, char **argv) {
+     93f:	55                   	push   %rbp
+     940:	48 89 e5             	mov    %rsp,%rbp
+     943:	48 83 ec 10          	sub    $0x10,%rsp
+     947:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     94b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     94f:	e8 c2 fd ff ff       	call   716 <bflushall>
+  return _exec(path, argv);
+     954:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     958:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     95c:	48 89 d6             	mov    %rdx,%rsi
+     95f:	48 89 c7             	mov    %rax,%rdi
+     962:	e8 9b 0a 00 00       	call   1402 <_exec>
+}
+     967:	c9                   	leave
+     968:	c3                   	ret
+
+0000000000000969 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     969:	55                   	push   %rbp
+     96a:	48 89 e5             	mov    %rsp,%rbp
+     96d:	48 83 ec 20          	sub    $0x20,%rsp
+     971:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     975:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     979:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     97d:	e8 94 fd ff ff       	call   716 <bflushall>
+  return _spawn(path, argv, fds);
+     982:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     986:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     98a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     98e:	48 89 ce             	mov    %rcx,%rsi
+     991:	48 89 c7             	mov    %rax,%rdi
+     994:	e8 2f 0b 00 00       	call   14c8 <_spawn>
+}
+     999:	c9                   	leave
+     99a:	c3                   	ret
+
+000000000000099b <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     99b:	55                   	push   %rbp
+     99c:	48 89 e5             	mov    %rsp,%rbp
+     99f:	48 83 ec 10          	sub    $0x10,%rsp
+     9a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     9a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     9aa:	78 69                	js     a15 <close+0x7a>
+     9ac:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     9b0:	7f 63                	jg     a15 <close+0x7a>
+     9b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9b5:	48 98                	cltq
+     9b7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     9be:	00 
+     9bf:	48 8d 05 7a 26 00 00 	lea    0x267a(%rip),%rax        # 3040 <obufs>
+     9c6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9ca:	48 85 c0             	test   %rax,%rax
+     9cd:	74 46                	je     a15 <close+0x7a>
+    bflush(fd);
+     9cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d2:	89 c7                	mov    %eax,%edi
+     9d4:	e8 b4 fc ff ff       	call   68d <bflush>
+    free(obufs[fd]);
+     9d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9dc:	48 98                	cltq
+     9de:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     9e5:	00 
+     9e6:	48 8d 05 53 26 00 00 	lea    0x2653(%rip),%rax        # 3040 <obufs>
+     9ed:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9f1:	48 89 c7             	mov    %rax,%rdi
+     9f4:	e8 90 11 00 00       	call   1b89 <free>
+    obufs[fd] = 0;
+     9f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9fc:	48 98                	cltq
+     9fe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a05:	00 
+     a06:	48 8d 05 33 26 00 00 	lea    0x2633(%rip),%rax        # 3040 <obufs>
+     a0d:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     a14:	00 
+  }
+  return _close(fd);
+     a15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a18:	89 c7                	mov    %eax,%edi
+     a1a:	e8 cd 09 00 00       	call   13ec <_close>
+}
+     a1f:	c9                   	leave
+     a20:	c3                   	ret
+
+0000000000000a21 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     a21:	55                   	push   %rbp
+     a22:	48 89 e5             	mov    %rsp,%rbp
+     a25:	53                   	push   %rbx
+     a26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     a2a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     a2e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     a32:	48 8b 36             	mov    (%rsi),%rsi
+     a35:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     a39:	48 29 f7             	sub    %rsi,%rdi
+     a3c:	48 89 f9             	mov    %rdi,%rcx
+     a3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     a44:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     a48:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     a4c:	48 89 f0             	mov    %rsi,%rax
+     a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+     a54:	48 89 df             	mov    %rbx,%rdi
+     a57:	48 0f af f8          	imul   %rax,%rdi
+     a5b:	48 89 d6             	mov    %rdx,%rsi
+     a5e:	48 0f af f1          	imul   %rcx,%rsi
+     a62:	48 01 fe             	add    %rdi,%rsi
+     a65:	48 f7 e1             	mul    %rcx
+     a68:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     a6c:	48 89 ca             	mov    %rcx,%rdx
+     a6f:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     a74:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     a78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     a7c:	c9                   	leave
+     a7d:	c3                   	ret
+
+0000000000000a7e <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     a7e:	55                   	push   %rbp
+     a7f:	48 89 e5             	mov    %rsp,%rbp
+     a82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a86:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     a89:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     a8c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a90:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     a93:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a96:	48 89 ce             	mov    %rcx,%rsi
+     a99:	48 89 f7             	mov    %rsi,%rdi
+     a9c:	89 d1                	mov    %edx,%ecx
+     a9e:	fc                   	cld
+     a9f:	f3 aa                	rep stos %al,%es:(%rdi)
+     aa1:	89 ca                	mov    %ecx,%edx
+     aa3:	48 89 fe             	mov    %rdi,%rsi
+     aa6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     aaa:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     aad:	90                   	nop
+     aae:	5d                   	pop    %rbp
+     aaf:	c3                   	ret
+
+0000000000000ab0 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     ab0:	55                   	push   %rbp
+     ab1:	48 89 e5             	mov    %rsp,%rbp
+     ab4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ab8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     abc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     ac0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ac4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     ac8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     acc:	48 89 ce             	mov    %rcx,%rsi
+     acf:	48 89 f7             	mov    %rsi,%rdi
+     ad2:	48 89 d1             	mov    %rdx,%rcx
+     ad5:	fc                   	cld
+     ad6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     ad9:	48 89 ca             	mov    %rcx,%rdx
+     adc:	48 89 fe             	mov    %rdi,%rsi
+     adf:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     ae3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     ae7:	90                   	nop
+     ae8:	5d                   	pop    %rbp
+     ae9:	c3                   	ret
+
+0000000000000aea <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     aea:	55                   	push   %rbp
+     aeb:	48 89 e5             	mov    %rsp,%rbp
+     aee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     af2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     af6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     afa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     afe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b06:	48 89 cf             	mov    %rcx,%rdi
+     b09:	48 89 d6             	mov    %rdx,%rsi
+     b0c:	48 89 c1             	mov    %rax,%rcx
+     b0f:	fc                   	cld
+     b10:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     b12:	48 89 c8             	mov    %rcx,%rax
+     b15:	48 89 f2             	mov    %rsi,%rdx
+     b18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b1c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     b20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     b24:	90                   	nop
+     b25:	5d                   	pop    %rbp
+     b26:	c3                   	ret
+
+0000000000000b27 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     b27:	55                   	push   %rbp
+     b28:	48 89 e5             	mov    %rsp,%rbp
+     b2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b33:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     b37:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b3b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b43:	48 89 cf             	mov    %rcx,%rdi
+     b46:	48 89 d6             	mov    %rdx,%rsi
+     b49:	48 89 c1             	mov    %rax,%rcx
+     b4c:	fc                   	cld
+     b4d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     b50:	48 89 c8             	mov    %rcx,%rax
+     b53:	48 89 f2             	mov    %rsi,%rdx
+     b56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b5a:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     b5e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     b62:	90                   	nop
+     b63:	5d                   	pop    %rbp
+     b64:	c3                   	ret
+
+0000000000000b65 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     b65:	55                   	push   %rbp
+     b66:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     b69:	0f 31                	rdtsc
+     b6b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     b6e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     b71:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b74:	48 c1 e0 20          	shl    $0x20,%rax
+     b78:	48 89 c2             	mov    %rax,%rdx
+     b7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b7e:	48 09 d0             	or     %rdx,%rax
+}
+     b81:	5d                   	pop    %rbp
+     b82:	c3                   	ret
+
+0000000000000b83 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     b83:	55                   	push   %rbp
+     b84:	48 89 e5             	mov    %rsp,%rbp
+     b87:	53                   	push   %rbx
+     b88:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     b8b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     b8f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     b93:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     b97:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     b9b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b9e:	0f a2                	cpuid
+     ba0:	89 de                	mov    %ebx,%esi
+     ba2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ba5:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     ba8:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     bab:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     bae:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     bb3:	74 09                	je     bbe <cpuid+0x3b>
+    *eaxp = eax;
+     bb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     bb9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     bbc:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     bbe:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     bc3:	74 09                	je     bce <cpuid+0x4b>
+    *ebxp = ebx;
+     bc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     bc9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     bcc:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     bce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     bd3:	74 09                	je     bde <cpuid+0x5b>
+    *ecxp = ecx;
+     bd5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     bd9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     bdc:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     bde:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     be3:	74 09                	je     bee <cpuid+0x6b>
+    *edxp = edx;
+     be5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     be9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     bec:	89 10                	mov    %edx,(%rax)
+}
+     bee:	90                   	nop
+     bef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     bf3:	c9                   	leave
+     bf4:	c3                   	ret
+
+0000000000000bf5 <strcpy>:
+char *strcpy(char *s, char *t) {
+     bf5:	55                   	push   %rbp
+     bf6:	48 89 e5             	mov    %rsp,%rbp
+     bf9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     bfd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     c01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     c09:	90                   	nop
+     c0a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c0e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     c12:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c1a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     c1e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     c22:	0f b6 12             	movzbl (%rdx),%edx
+     c25:	88 10                	mov    %dl,(%rax)
+     c27:	0f b6 00             	movzbl (%rax),%eax
+     c2a:	84 c0                	test   %al,%al
+     c2c:	75 dc                	jne    c0a <strcpy+0x15>
+  return os;
+     c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c32:	5d                   	pop    %rbp
+     c33:	c3                   	ret
+
+0000000000000c34 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     c34:	55                   	push   %rbp
+     c35:	48 89 e5             	mov    %rsp,%rbp
+     c38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c3c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     c40:	eb 0a                	jmp    c4c <strcmp+0x18>
+    p++, q++;
+     c42:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     c47:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c50:	0f b6 00             	movzbl (%rax),%eax
+     c53:	84 c0                	test   %al,%al
+     c55:	74 12                	je     c69 <strcmp+0x35>
+     c57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c5b:	0f b6 10             	movzbl (%rax),%edx
+     c5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c62:	0f b6 00             	movzbl (%rax),%eax
+     c65:	38 c2                	cmp    %al,%dl
+     c67:	74 d9                	je     c42 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     c69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c6d:	0f b6 00             	movzbl (%rax),%eax
+     c70:	0f b6 d0             	movzbl %al,%edx
+     c73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c77:	0f b6 00             	movzbl (%rax),%eax
+     c7a:	0f b6 c0             	movzbl %al,%eax
+     c7d:	29 c2                	sub    %eax,%edx
+     c7f:	89 d0                	mov    %edx,%eax
+}
+     c81:	5d                   	pop    %rbp
+     c82:	c3                   	ret
+
+0000000000000c83 <strlen>:
+uint strlen(char *s) {
+     c83:	55                   	push   %rbp
+     c84:	48 89 e5             	mov    %rsp,%rbp
+     c87:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     c8b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c92:	eb 04                	jmp    c98 <strlen+0x15>
+     c94:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c9b:	48 63 d0             	movslq %eax,%rdx
+     c9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ca2:	48 01 d0             	add    %rdx,%rax
+     ca5:	0f b6 00             	movzbl (%rax),%eax
+     ca8:	84 c0                	test   %al,%al
+     caa:	75 e8                	jne    c94 <strlen+0x11>
+    ;
+  return n;
+     cac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     caf:	5d                   	pop    %rbp
+     cb0:	c3                   	ret
+
+0000000000000cb1 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     cb1:	55                   	push   %rbp
+     cb2:	48 89 e5             	mov    %rsp,%rbp
+     cb5:	53                   	push   %rbx
+     cb6:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     cba:	8b 05 74 23 00 00    	mov    0x2374(%rip),%eax        # 3034 <erms>
+     cc0:	85 c0                	test   %eax,%eax
+     cc2:	79 53                	jns    d17 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     cc4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     cc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     cce:	b9 00 00 00 00       	mov    $0x0,%ecx
+     cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+     cd8:	48 89 c6             	mov    %rax,%rsi
+     cdb:	bf 00 00 00 00       	mov    $0x0,%edi
+     ce0:	e8 9e fe ff ff       	call   b83 <cpuid>
+    ebx = 0;
+     ce5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     cec:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cef:	83 f8 06             	cmp    $0x6,%eax
+     cf2:	76 14                	jbe    d08 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     cf4:	b8 07 00 00 00       	mov    $0x7,%eax
+     cf9:	b9 00 00 00 00       	mov    $0x0,%ecx
+     cfe:	0f a2                	cpuid
+     d00:	89 d9                	mov    %ebx,%ecx
+     d02:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     d05:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     d08:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d0b:	c1 e8 09             	shr    $0x9,%eax
+     d0e:	83 e0 01             	and    $0x1,%eax
+     d11:	89 05 1d 23 00 00    	mov    %eax,0x231d(%rip)        # 3034 <erms>
+  }
+  return erms;
+     d17:	8b 05 17 23 00 00    	mov    0x2317(%rip),%eax        # 3034 <erms>
+}
+     d1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     d21:	c9                   	leave
+     d22:	c3                   	ret
+
+0000000000000d23 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     d23:	55                   	push   %rbp
+     d24:	48 89 e5             	mov    %rsp,%rbp
+     d27:	48 83 ec 10          	sub    $0x10,%rsp
+     d2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d2f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     d32:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     d35:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     d39:	76 09                	jbe    d44 <memset+0x21>
+     d3b:	e8 71 ff ff ff       	call   cb1 <haserms>
+     d40:	85 c0                	test   %eax,%eax
+     d42:	74 16                	je     d5a <memset+0x37>
+    stosb(dst, c, n);
+     d44:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     d47:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     d4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d4e:	89 ce                	mov    %ecx,%esi
+     d50:	48 89 c7             	mov    %rax,%rdi
+     d53:	e8 26 fd ff ff       	call   a7e <stosb>
+     d58:	eb 58                	jmp    db2 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     d5a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d5d:	c1 e8 03             	shr    $0x3,%eax
+     d60:	89 c6                	mov    %eax,%esi
+     d62:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d65:	48 98                	cltq
+     d67:	0f b6 c0             	movzbl %al,%eax
+     d6a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     d71:	01 01 01 
+     d74:	48 0f af c2          	imul   %rdx,%rax
+     d78:	48 89 c1             	mov    %rax,%rcx
+     d7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d7f:	48 89 f2             	mov    %rsi,%rdx
+     d82:	48 89 ce             	mov    %rcx,%rsi
+     d85:	48 89 c7             	mov    %rax,%rdi
+     d88:	e8 23 fd ff ff       	call   ab0 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     d8d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d90:	83 e0 07             	and    $0x7,%eax
+     d93:	89 c2                	mov    %eax,%edx
+     d95:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d98:	83 e0 f8             	and    $0xfffffff8,%eax
+     d9b:	48 89 c1             	mov    %rax,%rcx
+     d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     da2:	48 01 c1             	add    %rax,%rcx
+     da5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     da8:	89 c6                	mov    %eax,%esi
+     daa:	48 89 cf             	mov    %rcx,%rdi
+     dad:	e8 cc fc ff ff       	call   a7e <stosb>
+  }
+  return dst;
+     db2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     db6:	c9                   	leave
+     db7:	c3                   	ret
+
+0000000000000db8 <strchr>:
+
+char *strchr(const char *s, char c) {
+     db8:	55                   	push   %rbp
+     db9:	48 89 e5             	mov    %rsp,%rbp
+     dbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dc0:	89 f0                	mov    %esi,%eax
+     dc2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     dc5:	eb 17                	jmp    dde <strchr+0x26>
+    if (*s == c)
+     dc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dcb:	0f b6 00             	movzbl (%rax),%eax
+     dce:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     dd1:	75 06                	jne    dd9 <strchr+0x21>
+      return (char *)s;
+     dd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dd7:	eb 15                	jmp    dee <strchr+0x36>
+  for (; *s; s++)
+     dd9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     dde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de2:	0f b6 00             	movzbl (%rax),%eax
+     de5:	84 c0                	test   %al,%al
+     de7:	75 de                	jne    dc7 <strchr+0xf>
+  return 0;
+     de9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     dee:	5d                   	pop    %rbp
+     def:	c3                   	ret
+
+0000000000000df0 <gets>:
+
+char *gets(char *buf, int max) {
+     df0:	55                   	push   %rbp
+     df1:	48 89 e5             	mov    %rsp,%rbp
+     df4:	48 83 ec 20          	sub    $0x20,%rsp
+     df8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     dfc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     dff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e06:	eb 48                	jmp    e50 <gets+0x60>
+    cc = read(0, &c, 1);
+     e08:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     e0c:	ba 01 00 00 00       	mov    $0x1,%edx
+     e11:	48 89 c6             	mov    %rax,%rsi
+     e14:	bf 00 00 00 00       	mov    $0x0,%edi
+     e19:	e8 b8 05 00 00       	call   13d6 <read>
+     e1e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     e21:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e25:	7e 36                	jle    e5d <gets+0x6d>
+      break;
+    buf[i++] = c;
+     e27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e2a:	8d 50 01             	lea    0x1(%rax),%edx
+     e2d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e30:	48 63 d0             	movslq %eax,%rdx
+     e33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e37:	48 01 c2             	add    %rax,%rdx
+     e3a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e3e:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     e40:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e44:	3c 0a                	cmp    $0xa,%al
+     e46:	74 16                	je     e5e <gets+0x6e>
+     e48:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e4c:	3c 0d                	cmp    $0xd,%al
+     e4e:	74 0e                	je     e5e <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     e50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e53:	83 c0 01             	add    $0x1,%eax
+     e56:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     e59:	7f ad                	jg     e08 <gets+0x18>
+     e5b:	eb 01                	jmp    e5e <gets+0x6e>
+      break;
+     e5d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     e5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e61:	48 63 d0             	movslq %eax,%rdx
+     e64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e68:	48 01 d0             	add    %rdx,%rax
+     e6b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     e72:	c9                   	leave
+     e73:	c3                   	ret
+
+0000000000000e74 <stat>:
+
+int stat(char *n, struct stat *st) {
+     e74:	55                   	push   %rbp
+     e75:	48 89 e5             	mov    %rsp,%rbp
+     e78:	48 83 ec 10          	sub    $0x10,%rsp
+     e7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e80:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     e84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e8c:	48 89 c6             	mov    %rax,%rsi
+     e8f:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     e94:	e8 58 07 00 00       	call   15f1 <fstatat>
+}
+     e99:	c9                   	leave
+     e9a:	c3                   	ret
+
+0000000000000e9b <atoi>:
+
+int atoi(const char *s) {
+     e9b:	55                   	push   %rbp
+     e9c:	48 89 e5             	mov    %rsp,%rbp
+     e9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     ea3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     eaa:	eb 28                	jmp    ed4 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     eac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     eaf:	89 d0                	mov    %edx,%eax
+     eb1:	c1 e0 02             	shl    $0x2,%eax
+     eb4:	01 d0                	add    %edx,%eax
+     eb6:	01 c0                	add    %eax,%eax
+     eb8:	89 c1                	mov    %eax,%ecx
+     eba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ebe:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     ec2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     ec6:	0f b6 00             	movzbl (%rax),%eax
+     ec9:	0f be c0             	movsbl %al,%eax
+     ecc:	01 c8                	add    %ecx,%eax
+     ece:	83 e8 30             	sub    $0x30,%eax
+     ed1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     ed4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ed8:	0f b6 00             	movzbl (%rax),%eax
+     edb:	3c 2f                	cmp    $0x2f,%al
+     edd:	7e 0b                	jle    eea <atoi+0x4f>
+     edf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ee3:	0f b6 00             	movzbl (%rax),%eax
+     ee6:	3c 39                	cmp    $0x39,%al
+     ee8:	7e c2                	jle    eac <atoi+0x11>
+  return n;
+     eea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     eed:	5d                   	pop    %rbp
+     eee:	c3                   	ret
+
+0000000000000eef <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     eef:	55                   	push   %rbp
+     ef0:	48 89 e5             	mov    %rsp,%rbp
+     ef3:	48 83 ec 28          	sub    $0x28,%rsp
+     ef7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     efb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     eff:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     f02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f06:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     f0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     f12:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     f16:	7f 09                	jg     f21 <memmove+0x32>
+    return vdst;
+     f18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f1c:	e9 29 01 00 00       	jmp    104a <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     f21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f25:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     f29:	0f 83 87 00 00 00    	jae    fb6 <memmove+0xc7>
+     f2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f32:	48 63 d0             	movslq %eax,%rdx
+     f35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f39:	48 01 d0             	add    %rdx,%rax
+     f3c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     f40:	73 74                	jae    fb6 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     f42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f45:	48 98                	cltq
+     f47:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     f4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f4e:	48 98                	cltq
+     f50:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     f54:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f5c:	48 09 d0             	or     %rdx,%rax
+     f5f:	83 e0 07             	and    $0x7,%eax
+     f62:	48 85 c0             	test   %rax,%rax
+     f65:	75 3d                	jne    fa4 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     f67:	eb 1c                	jmp    f85 <memmove+0x96>
+        src -= 8;
+     f69:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     f6e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f77:	48 8b 10             	mov    (%rax),%rdx
+     f7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f7e:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     f81:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     f85:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     f89:	7f de                	jg     f69 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     f8b:	eb 17                	jmp    fa4 <memmove+0xb5>
+      *--dst = *--src;
+     f8d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     f92:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     f97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f9b:	0f b6 10             	movzbl (%rax),%edx
+     f9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fa2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     fa4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fa7:	8d 50 ff             	lea    -0x1(%rax),%edx
+     faa:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     fad:	85 c0                	test   %eax,%eax
+     faf:	7f dc                	jg     f8d <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     fb1:	e9 90 00 00 00       	jmp    1046 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     fb6:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     fba:	7e 09                	jle    fc5 <memmove+0xd6>
+     fbc:	e8 f0 fc ff ff       	call   cb1 <haserms>
+     fc1:	85 c0                	test   %eax,%eax
+     fc3:	74 1b                	je     fe0 <memmove+0xf1>
+    movsb(dst, src, n);
+     fc5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fc8:	48 63 d0             	movslq %eax,%rdx
+     fcb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     fcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd3:	48 89 ce             	mov    %rcx,%rsi
+     fd6:	48 89 c7             	mov    %rax,%rdi
+     fd9:	e8 0c fb ff ff       	call   aea <movsb>
+     fde:	eb 66                	jmp    1046 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     fe0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fe3:	8d 50 07             	lea    0x7(%rax),%edx
+     fe6:	85 c0                	test   %eax,%eax
+     fe8:	0f 48 c2             	cmovs  %edx,%eax
+     feb:	c1 f8 03             	sar    $0x3,%eax
+     fee:	48 63 d0             	movslq %eax,%rdx
+     ff1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff9:	48 89 ce             	mov    %rcx,%rsi
+     ffc:	48 89 c7             	mov    %rax,%rdi
+     fff:	e8 23 fb ff ff       	call   b27 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1004:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1007:	89 d0                	mov    %edx,%eax
+    1009:	c1 f8 1f             	sar    $0x1f,%eax
+    100c:	c1 e8 1d             	shr    $0x1d,%eax
+    100f:	01 c2                	add    %eax,%edx
+    1011:	83 e2 07             	and    $0x7,%edx
+    1014:	29 c2                	sub    %eax,%edx
+    1016:	89 d0                	mov    %edx,%eax
+    1018:	48 98                	cltq
+    101a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    101d:	83 e2 f8             	and    $0xfffffff8,%edx
+    1020:	48 63 ca             	movslq %edx,%rcx
+    1023:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1027:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    102b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    102e:	83 e2 f8             	and    $0xfffffff8,%edx
+    1031:	48 63 ca             	movslq %edx,%rcx
+    1034:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1038:	48 01 d1             	add    %rdx,%rcx
+    103b:	48 89 c2             	mov    %rax,%rdx
+    103e:	48 89 cf             	mov    %rcx,%rdi
+    1041:	e8 a4 fa ff ff       	call   aea <movsb>
+  }
+  return vdst;
+    1046:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    104a:	c9                   	leave
+    104b:	c3                   	ret
+
+000000000000104c <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    104c:	55                   	push   %rbp
+    104d:	48 89 e5             	mov    %rsp,%rbp
+    1050:	48 83 ec 20          	sub    $0x20,%rsp
+    1054:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1057:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    105b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1062:	00 00 00 
+    1065:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1069:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    106d:	75 0d                	jne    107c <clock_gettime+0x30>
+    106f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1073:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1077:	48 85 c0             	test   %rax,%rax
+    107a:	75 13                	jne    108f <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    107c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1080:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1083:	48 89 d6             	mov    %rdx,%rsi
+    1086:	89 c7                	mov    %eax,%edi
+    1088:	e8 e0 04 00 00       	call   156d <_clock_gettime>
+    108d:	eb 7d                	jmp    110c <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    108f:	e8 d1 fa ff ff       	call   b65 <rdtsc>
+    1094:	48 89 c2             	mov    %rax,%rdx
+    1097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    109b:	48 89 d6             	mov    %rdx,%rsi
+    109e:	48 89 c7             	mov    %rax,%rdi
+    10a1:	e8 7b f9 ff ff       	call   a21 <clockns>
+    10a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    10aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10ae:	48 c1 e8 09          	shr    $0x9,%rax
+    10b2:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    10b9:	b8 44 00 
+    10bc:	48 f7 e2             	mul    %rdx
+    10bf:	48 89 d0             	mov    %rdx,%rax
+    10c2:	48 c1 e8 0b          	shr    $0xb,%rax
+    10c6:	48 89 c2             	mov    %rax,%rdx
+    10c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10cd:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    10d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    10d4:	48 89 c8             	mov    %rcx,%rax
+    10d7:	48 c1 e8 09          	shr    $0x9,%rax
+    10db:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    10e2:	b8 44 00 
+    10e5:	48 f7 e2             	mul    %rdx
+    10e8:	48 89 d0             	mov    %rdx,%rax
+    10eb:	48 c1 e8 0b          	shr    $0xb,%rax
+    10ef:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    10f6:	48 89 c8             	mov    %rcx,%rax
+    10f9:	48 29 d0             	sub    %rdx,%rax
+    10fc:	48 89 c2             	mov    %rax,%rdx
+    10ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1103:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1107:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    110c:	c9                   	leave
+    110d:	c3                   	ret
+
+000000000000110e <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    110e:	55                   	push   %rbp
+    110f:	48 89 e5             	mov    %rsp,%rbp
+    1112:	48 83 ec 10          	sub    $0x10,%rsp
+    1116:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    111a:	eb 11                	jmp    112d <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    111c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1120:	be 02 00 00 00       	mov    $0x2,%esi
+    1125:	48 89 c7             	mov    %rax,%rdi
+    1128:	e8 6c 04 00 00       	call   1599 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    112d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1131:	b8 02 00 00 00       	mov    $0x2,%eax
+    1136:	87 02                	xchg   %eax,(%rdx)
+    1138:	85 c0                	test   %eax,%eax
+    113a:	75 e0                	jne    111c <mutex_wait+0xe>
+}
+    113c:	90                   	nop
+    113d:	90                   	nop
+    113e:	c9                   	leave
+    113f:	c3                   	ret
+
+0000000000001140 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1140:	55                   	push   %rbp
+    1141:	48 89 e5             	mov    %rsp,%rbp
+    1144:	48 83 ec 20          	sub    $0x20,%rsp
+    1148:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    114c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1153:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1157:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    115b:	8b 02                	mov    (%rdx),%eax
+    115d:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1162:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1166:	89 c1                	mov    %eax,%ecx
+    1168:	0f 94 c0             	sete   %al
+    116b:	84 c0                	test   %al,%al
+    116d:	75 02                	jne    1171 <mutex_lock+0x31>
+    116f:	89 0a                	mov    %ecx,(%rdx)
+    1171:	83 f0 01             	xor    $0x1,%eax
+    1174:	84 c0                	test   %al,%al
+    1176:	74 0c                	je     1184 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1178:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    117c:	48 89 c7             	mov    %rax,%rdi
+    117f:	e8 8a ff ff ff       	call   110e <mutex_wait>
+}
+    1184:	90                   	nop
+    1185:	c9                   	leave
+    1186:	c3                   	ret
+
+0000000000001187 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1187:	55                   	push   %rbp
+    1188:	48 89 e5             	mov    %rsp,%rbp
+    118b:	48 83 ec 10          	sub    $0x10,%rsp
+    118f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1193:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1197:	ba 00 00 00 00       	mov    $0x0,%edx
+    119c:	87 10                	xchg   %edx,(%rax)
+    119e:	83 fa 02             	cmp    $0x2,%edx
+    11a1:	75 11                	jne    11b4 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    11a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a7:	be 01 00 00 00       	mov    $0x1,%esi
+    11ac:	48 89 c7             	mov    %rax,%rdi
+    11af:	e8 f0 03 00 00       	call   15a4 <futex_wake>
+}
+    11b4:	90                   	nop
+    11b5:	c9                   	leave
+    11b6:	c3                   	ret
+
+00000000000011b7 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    11b7:	55                   	push   %rbp
+    11b8:	48 89 e5             	mov    %rsp,%rbp
+    11bb:	48 83 ec 20          	sub    $0x20,%rsp
+    11bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    11c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11cb:	48 83 c0 04          	add    $0x4,%rax
+    11cf:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    11d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11d7:	8b 00                	mov    (%rax),%eax
+    11d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    11dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    11e0:	48 89 c7             	mov    %rax,%rdi
+    11e3:	e8 9f ff ff ff       	call   1187 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    11e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11ec:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    11ef:	89 d6                	mov    %edx,%esi
+    11f1:	48 89 c7             	mov    %rax,%rdi
+    11f4:	e8 a0 03 00 00       	call   1599 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    11f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11fd:	48 83 c0 04          	add    $0x4,%rax
+    1201:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1205:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1209:	48 89 c7             	mov    %rax,%rdi
+    120c:	e8 fd fe ff ff       	call   110e <mutex_wait>
+}
+    1211:	90                   	nop
+    1212:	c9                   	leave
+    1213:	c3                   	ret
+
+0000000000001214 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1214:	55                   	push   %rbp
+    1215:	48 89 e5             	mov    %rsp,%rbp
+    1218:	48 83 ec 10          	sub    $0x10,%rsp
+    121c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1224:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    122c:	48 83 c0 04          	add    $0x4,%rax
+    1230:	8b 00                	mov    (%rax),%eax
+    1232:	85 c0                	test   %eax,%eax
+    1234:	7e 11                	jle    1247 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1236:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    123a:	be 01 00 00 00       	mov    $0x1,%esi
+    123f:	48 89 c7             	mov    %rax,%rdi
+    1242:	e8 5d 03 00 00       	call   15a4 <futex_wake>
+}
+    1247:	90                   	nop
+    1248:	c9                   	leave
+    1249:	c3                   	ret
+
+000000000000124a <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    124a:	55                   	push   %rbp
+    124b:	48 89 e5             	mov    %rsp,%rbp
+    124e:	48 83 ec 10          	sub    $0x10,%rsp
+    1252:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1256:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    125a:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    125e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1262:	48 83 c0 04          	add    $0x4,%rax
+    1266:	8b 00                	mov    (%rax),%eax
+    1268:	85 c0                	test   %eax,%eax
+    126a:	7e 11                	jle    127d <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    126c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1270:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1275:	48 89 c7             	mov    %rax,%rdi
+    1278:	e8 27 03 00 00       	call   15a4 <futex_wake>
+}
+    127d:	90                   	nop
+    127e:	c9                   	leave
+    127f:	c3                   	ret
+
+0000000000001280 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1280:	55                   	push   %rbp
+    1281:	48 89 e5             	mov    %rsp,%rbp
+    1284:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1288:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    128b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    128f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1293:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1297:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    129b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    129f:	8b 40 04             	mov    0x4(%rax),%eax
+    12a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    12a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12a9:	8b 00                	mov    (%rax),%eax
+    12ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    12ae:	29 c2                	sub    %eax,%edx
+    12b0:	83 fa 1f             	cmp    $0x1f,%edx
+    12b3:	76 07                	jbe    12bc <ring_push+0x3c>
+    return -1;
+    12b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12ba:	eb 7e                	jmp    133a <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    12bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12bf:	83 e0 1f             	and    $0x1f,%eax
+    12c2:	89 c2                	mov    %eax,%edx
+    12c4:	48 89 d0             	mov    %rdx,%rax
+    12c7:	48 01 c0             	add    %rax,%rax
+    12ca:	48 01 d0             	add    %rdx,%rax
+    12cd:	48 c1 e0 04          	shl    $0x4,%rax
+    12d1:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    12d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12d9:	48 01 d0             	add    %rdx,%rax
+    12dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    12e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12e4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    12e7:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    12e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12ed:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    12f1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    12f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    12fd:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1301:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1305:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1309:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    130d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1311:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1315:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1319:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    131d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1321:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1325:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1328:	8d 50 01             	lea    0x1(%rax),%edx
+    132b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    132f:	48 83 c0 04          	add    $0x4,%rax
+    1333:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    133a:	5d                   	pop    %rbp
+    133b:	c3                   	ret
+
+000000000000133c <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    133c:	55                   	push   %rbp
+    133d:	48 89 e5             	mov    %rsp,%rbp
+    1340:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1344:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1348:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    134c:	8b 40 08             	mov    0x8(%rax),%eax
+    134f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1352:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1356:	48 83 c0 0c          	add    $0xc,%rax
+    135a:	8b 00                	mov    (%rax),%eax
+    135c:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    135f:	75 07                	jne    1368 <ring_pop+0x2c>
+    return -1;
+    1361:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1366:	eb 40                	jmp    13a8 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1368:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    136b:	83 e0 1f             	and    $0x1f,%eax
+    136e:	89 c2                	mov    %eax,%edx
+    1370:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1374:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1378:	89 d2                	mov    %edx,%edx
+    137a:	48 83 c2 61          	add    $0x61,%rdx
+    137e:	48 c1 e2 04          	shl    $0x4,%rdx
+    1382:	48 01 d0             	add    %rdx,%rax
+    1385:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1389:	48 8b 00             	mov    (%rax),%rax
+    138c:	48 89 01             	mov    %rax,(%rcx)
+    138f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1393:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1396:	8d 50 01             	lea    0x1(%rax),%edx
+    1399:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    139d:	48 83 c0 08          	add    $0x8,%rax
+    13a1:	89 10                	mov    %edx,(%rax)
+  return 0;
+    13a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13a8:	5d                   	pop    %rbp
+    13a9:	c3                   	ret
+
+00000000000013aa <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    13aa:	b8 01 00 00 00       	mov    $0x1,%eax
+    13af:	49 89 ca             	mov    %rcx,%r10
+    13b2:	0f 05                	syscall
+    13b4:	c3                   	ret
+
+00000000000013b5 <_exit>:
+SYSCALL_(exit)
+    13b5:	b8 02 00 00 00       	mov    $0x2,%eax
+    13ba:	49 89 ca             	mov    %rcx,%r10
+    13bd:	0f 05                	syscall
+    13bf:	c3                   	ret
+
+00000000000013c0 <wait>:
+SYSCALL(wait)
+    13c0:	b8 03 00 00 00       	mov    $0x3,%eax
+    13c5:	49 89 ca             	mov    %rcx,%r10
+    13c8:	0f 05                	syscall
+    13ca:	c3                   	ret
+
+00000000000013cb <pipe>:
+SYSCALL(pipe)
+    13cb:	b8 04 00 00 00       	mov    $0x4,%eax
+    13d0:	49 89 ca             	mov    %rcx,%r10
+    13d3:	0f 05                	syscall
+    13d5:	c3                   	ret
+
+00000000000013d6 <read>:
+SYSCALL(read)
+    13d6:	b8 05 00 00 00       	mov    $0x5,%eax
+    13db:	49 89 ca             	mov    %rcx,%r10
+    13de:	0f 05                	syscall
+    13e0:	c3                   	ret
+
+00000000000013e1 <write>:
+SYSCALL(write)
+    13e1:	b8 10 00 00 00       	mov    $0x10,%eax
+    13e6:	49 89 ca             	mov    %rcx,%r10
+    13e9:	0f 05                	syscall
+    13eb:	c3                   	ret
+
+00000000000013ec <_close>:
+SYSCALL_(close)
+    13ec:	b8 15 00 00 00       	mov    $0x15,%eax
+    13f1:	49 89 ca             	mov    %rcx,%r10
+    13f4:	0f 05                	syscall
+    13f6:	c3                   	ret
+
+00000000000013f7 <kill>:
+SYSCALL(kill)
+    13f7:	b8 06 00 00 00       	mov    $0x6,%eax
+    13fc:	49 89 ca             	mov    %rcx,%r10
+    13ff:	0f 05                	syscall
+    1401:	c3                   	ret
+
+0000000000001402 <_exec>:
+SYSCALL_(exec)
+    1402:	b8 07 00 00 00       	mov    $0x7,%eax
+    1407:	49 89 ca             	mov    %rcx,%r10
+    140a:	0f 05                	syscall
+    140c:	c3                   	ret
+
+000000000000140d <open>:
+SYSCALL(open)
+    140d:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1412:	49 89 ca             	mov    %rcx,%r10
+    1415:	0f 05                	syscall
+    1417:	c3                   	ret
+
+0000000000001418 <mknod>:
+SYSCALL(mknod)
+    1418:	b8 11 00 00 00       	mov    $0x11,%eax
+    141d:	49 89 ca             	mov    %rcx,%r10
+    1420:	0f 05                	syscall
+    1422:	c3                   	ret
+
+0000000000001423 <unlink>:
+SYSCALL(unlink)
+    1423:	b8 12 00 00 00       	mov    $0x12,%eax
+    1428:	49 89 ca             	mov    %rcx,%r10
+    142b:	0f 05                	syscall
+    142d:	c3                   	ret
+
+000000000000142e <fstat>:
+SYSCALL(fstat)
+    142e:	b8 08 00 00 00       	mov    $0x8,%eax
+    1433:	49 89 ca             	mov    %rcx,%r10
+    1436:	0f 05                	syscall
+    1438:	c3                   	ret
+
+0000000000001439 <link>:
+SYSCALL(link)
+    1439:	b8 13 00 00 00       	mov    $0x13,%eax
+    143e:	49 89 ca             	mov    %rcx,%r10
+    1441:	0f 05                	syscall
+    1443:	c3                   	ret
+
+0000000000001444 <mkdir>:
+SYSCALL(mkdir)
+    1444:	b8 14 00 00 00       	mov    $0x14,%eax
+    1449:	49 89 ca             	mov    %rcx,%r10
+    144c:	0f 05                	syscall
+    144e:	c3                   	ret
+
+000000000000144f <chdir>:
+SYSCALL(chdir)
+    144f:	b8 09 00 00 00       	mov    $0x9,%eax
+    1454:	49 89 ca             	mov    %rcx,%r10
+    1457:	0f 05                	syscall
+    1459:	c3                   	ret
+
+000000000000145a <dup>:
+SYSCALL(dup)
+    145a:	b8 0a 00 00 00       	mov    $0xa,%eax
+    145f:	49 89 ca             	mov    %rcx,%r10
+    1462:	0f 05                	syscall
+    1464:	c3                   	ret
+
+0000000000001465 <getpid>:
+SYSCALL(getpid)
+    1465:	b8 0b 00 00 00       	mov    $0xb,%eax
+    146a:	49 89 ca             	mov    %rcx,%r10
+    146d:	0f 05                	syscall
+    146f:	c3                   	ret
+
+0000000000001470 <sbrk>:
+SYSCALL(sbrk)
+    1470:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1475:	49 89 ca             	mov    %rcx,%r10
+    1478:	0f 05                	syscall
+    147a:	c3                   	ret
+
+000000000000147b <sleep>:
+SYSCALL(sleep)
+    147b:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1480:	49 89 ca             	mov    %rcx,%r10
+    1483:	0f 05                	syscall
+    1485:	c3                   	ret
+
+0000000000001486 <uptime>:
+SYSCALL(uptime)
+    1486:	b8 0e 00 00 00       	mov    $0xe,%eax
+    148b:	49 89 ca             	mov    %rcx,%r10
+    148e:	0f 05                	syscall
+    1490:	c3                   	ret
+
+0000000000001491 <sysinfo>:
+SYSCALL(sysinfo)
+    1491:	b8 16 00 00 00       	mov    $0x16,%eax
+    1496:	49 89 ca             	mov    %rcx,%r10
+    1499:	0f 05                	syscall
+    149b:	c3                   	ret
+
+000000000000149c <crashn>:
+SYSCALL(crashn)
+    149c:	b8 17 00 00 00       	mov    $0x17,%eax
+    14a1:	49 89 ca             	mov    %rcx,%r10
+    14a4:	0f 05                	syscall
+    14a6:	c3                   	ret
+
+00000000000014a7 <mmap>:
+SYSCALL(mmap)
+    14a7:	b8 18 00 00 00       	mov    $0x18,%eax
+    14ac:	49 89 ca             	mov    %rcx,%r10
+    14af:	0f 05                	syscall
+    14b1:	c3                   	ret
+
+00000000000014b2 <munmap>:
+SYSCALL(munmap)
+    14b2:	b8 19 00 00 00       	mov    $0x19,%eax
+    14b7:	49 89 ca             	mov    %rcx,%r10
+    14ba:	0f 05                	syscall
+    14bc:	c3                   	ret
+
+00000000000014bd <nice>:
+SYSCALL(nice)
+    14bd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14c2:	49 89 ca             	mov    %rcx,%r10
+    14c5:	0f 05                	syscall
+    14c7:	c3                   	ret
+
+00000000000014c8 <_spawn>:
+SYSCALL_(spawn)
+    14c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14cd:	49 89 ca             	mov    %rcx,%r10
+    14d0:	0f 05                	syscall
+    14d2:	c3                   	ret
+
+00000000000014d3 <pread>:
+SYSCALL(pread)
+    14d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14d8:	49 89 ca             	mov    %rcx,%r10
+    14db:	0f 05                	syscall
+    14dd:	c3                   	ret
+
+00000000000014de <pwrite>:
+SYSCALL(pwrite)
+    14de:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    14e3:	49 89 ca             	mov    %rcx,%r10
+    14e6:	0f 05                	syscall
+    14e8:	c3                   	ret
+
+00000000000014e9 <readv>:
+SYSCALL(readv)
+    14e9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    14ee:	49 89 ca             	mov    %rcx,%r10
+    14f1:	0f 05                	syscall
+    14f3:	c3                   	ret
+
+00000000000014f4 <writev>:
+SYSCALL(writev)
+    14f4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    14f9:	49 89 ca             	mov    %rcx,%r10
+    14fc:	0f 05                	syscall
+    14fe:	c3                   	ret
+
+00000000000014ff <sendfile>:
+SYSCALL(sendfile)
+    14ff:	b8 20 00 00 00       	mov    $0x20,%eax
+    1504:	49 89 ca             	mov    %rcx,%r10
+    1507:	0f 05                	syscall
+    1509:	c3                   	ret
+
+000000000000150a <splice>:
+SYSCALL(splice)
+    150a:	b8 21 00 00 00       	mov    $0x21,%eax
+    150f:	49 89 ca             	mov    %rcx,%r10
+    1512:	0f 05                	syscall
+    1514:	c3                   	ret
+
+0000000000001515 <poll>:
+SYSCALL(poll)
+    1515:	b8 22 00 00 00       	mov    $0x22,%eax
+    151a:	49 89 ca             	mov    %rcx,%r10
+    151d:	0f 05                	syscall
+    151f:	c3                   	ret
+
+0000000000001520 <fsync>:
+SYSCALL(fsync)
+    1520:	b8 23 00 00 00       	mov    $0x23,%eax
+    1525:	49 89 ca             	mov    %rcx,%r10
+    1528:	0f 05                	syscall
+    152a:	c3                   	ret
+
+000000000000152b <fdatasync>:
+SYSCALL(fdatasync)
+    152b:	b8 24 00 00 00       	mov    $0x24,%eax
+    1530:	49 89 ca             	mov    %rcx,%r10
+    1533:	0f 05                	syscall
+    1535:	c3                   	ret
+
+0000000000001536 <lockstat>:
+SYSCALL(lockstat)
+    1536:	b8 25 00 00 00       	mov    $0x25,%eax
+    153b:	49 89 ca             	mov    %rcx,%r10
+    153e:	0f 05                	syscall
+    1540:	c3                   	ret
+
+0000000000001541 <syscallstat>:
+SYSCALL(syscallstat)
+    1541:	b8 26 00 00 00       	mov    $0x26,%eax
+    1546:	49 89 ca             	mov    %rcx,%r10
+    1549:	0f 05                	syscall
+    154b:	c3                   	ret
+
+000000000000154c <trace>:
+SYSCALL(trace)
+    154c:	b8 27 00 00 00       	mov    $0x27,%eax
+    1551:	49 89 ca             	mov    %rcx,%r10
+    1554:	0f 05                	syscall
+    1556:	c3                   	ret
+
+0000000000001557 <profile>:
+SYSCALL(profile)
+    1557:	b8 28 00 00 00       	mov    $0x28,%eax
+    155c:	49 89 ca             	mov    %rcx,%r10
+    155f:	0f 05                	syscall
+    1561:	c3                   	ret
+
+0000000000001562 <cycles>:
+SYSCALL(cycles)
+    1562:	b8 29 00 00 00       	mov    $0x29,%eax
+    1567:	49 89 ca             	mov    %rcx,%r10
+    156a:	0f 05                	syscall
+    156c:	c3                   	ret
+
+000000000000156d <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    156d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1572:	49 89 ca             	mov    %rcx,%r10
+    1575:	0f 05                	syscall
+    1577:	c3                   	ret
+
+0000000000001578 <consmode>:
+SYSCALL(consmode)
+    1578:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    157d:	49 89 ca             	mov    %rcx,%r10
+    1580:	0f 05                	syscall
+    1582:	c3                   	ret
+
+0000000000001583 <clone>:
+SYSCALL(clone)
+    1583:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1588:	49 89 ca             	mov    %rcx,%r10
+    158b:	0f 05                	syscall
+    158d:	c3                   	ret
+
+000000000000158e <join>:
+SYSCALL(join)
+    158e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1593:	49 89 ca             	mov    %rcx,%r10
+    1596:	0f 05                	syscall
+    1598:	c3                   	ret
+
+0000000000001599 <futex_wait>:
+SYSCALL(futex_wait)
+    1599:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    159e:	49 89 ca             	mov    %rcx,%r10
+    15a1:	0f 05                	syscall
+    15a3:	c3                   	ret
+
+00000000000015a4 <futex_wake>:
+SYSCALL(futex_wake)
+    15a4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    15a9:	49 89 ca             	mov    %rcx,%r10
+    15ac:	0f 05                	syscall
+    15ae:	c3                   	ret
+
+00000000000015af <shmget>:
+SYSCALL(shmget)
+    15af:	b8 30 00 00 00       	mov    $0x30,%eax
+    15b4:	49 89 ca             	mov    %rcx,%r10
+    15b7:	0f 05                	syscall
+    15b9:	c3                   	ret
+
+00000000000015ba <shmat>:
+SYSCALL(shmat)
+    15ba:	b8 31 00 00 00       	mov    $0x31,%eax
+    15bf:	49 89 ca             	mov    %rcx,%r10
+    15c2:	0f 05                	syscall
+    15c4:	c3                   	ret
+
+00000000000015c5 <shmdt>:
+SYSCALL(shmdt)
+    15c5:	b8 32 00 00 00       	mov    $0x32,%eax
+    15ca:	49 89 ca             	mov    %rcx,%r10
+    15cd:	0f 05                	syscall
+    15cf:	c3                   	ret
+
+00000000000015d0 <ring_setup>:
+SYSCALL(ring_setup)
+    15d0:	b8 33 00 00 00       	mov    $0x33,%eax
+    15d5:	49 89 ca             	mov    %rcx,%r10
+    15d8:	0f 05                	syscall
+    15da:	c3                   	ret
+
+00000000000015db <ring_enter>:
+SYSCALL(ring_enter)
+    15db:	b8 34 00 00 00       	mov    $0x34,%eax
+    15e0:	49 89 ca             	mov    %rcx,%r10
+    15e3:	0f 05                	syscall
+    15e5:	c3                   	ret
+
+00000000000015e6 <getdents>:
+SYSCALL(getdents)
+    15e6:	b8 35 00 00 00       	mov    $0x35,%eax
+    15eb:	49 89 ca             	mov    %rcx,%r10
+    15ee:	0f 05                	syscall
+    15f0:	c3                   	ret
+
+00000000000015f1 <fstatat>:
+SYSCALL(fstatat)
+    15f1:	b8 36 00 00 00       	mov    $0x36,%eax
+    15f6:	49 89 ca             	mov    %rcx,%r10
+    15f9:	0f 05                	syscall
+    15fb:	c3                   	ret
+
+00000000000015fc <clone_file>:
+SYSCALL(clone_file)
+    15fc:	b8 37 00 00 00       	mov    $0x37,%eax
+    1601:	49 89 ca             	mov    %rcx,%r10
+    1604:	0f 05                	syscall
+    1606:	c3                   	ret
+
+0000000000001607 <fpunch>:
+SYSCALL(fpunch)
+    1607:	b8 38 00 00 00       	mov    $0x38,%eax
+    160c:	49 89 ca             	mov    %rcx,%r10
+    160f:	0f 05                	syscall
+    1611:	c3                   	ret
+
+0000000000001612 <defrag>:
+SYSCALL(defrag)
+    1612:	b8 39 00 00 00       	mov    $0x39,%eax
+    1617:	49 89 ca             	mov    %rcx,%r10
+    161a:	0f 05                	syscall
+    161c:	c3                   	ret
+
+000000000000161d <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    161d:	55                   	push   %rbp
+    161e:	48 89 e5             	mov    %rsp,%rbp
+    1621:	48 83 ec 20          	sub    $0x20,%rsp
+    1625:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1629:	bf 00 00 00 00       	mov    $0x0,%edi
+    162e:	e8 3d fe ff ff       	call   1470 <sbrk>
+    1633:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    163b:	48 f7 d8             	neg    %rax
+    163e:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1643:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1647:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    164b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    164f:	48 01 c2             	add    %rax,%rdx
+    1652:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1657:	48 39 c2             	cmp    %rax,%rdx
+    165a:	73 1e                	jae    167a <morecore+0x5d>
+    165c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1660:	89 c2                	mov    %eax,%edx
+    1662:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1666:	01 d0                	add    %edx,%eax
+    1668:	89 c7                	mov    %eax,%edi
+    166a:	e8 01 fe ff ff       	call   1470 <sbrk>
+    166f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1673:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1678:	75 07                	jne    1681 <morecore+0x64>
+    return 0;
+    167a:	b8 00 00 00 00       	mov    $0x0,%eax
+    167f:	eb 27                	jmp    16a8 <morecore+0x8b>
+  stats.heap += n + pad;
+    1681:	48 8b 05 e8 1a 00 00 	mov    0x1ae8(%rip),%rax        # 3170 <stats+0x50>
+    1688:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    168c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1690:	48 01 ca             	add    %rcx,%rdx
+    1693:	48 01 d0             	add    %rdx,%rax
+    1696:	48 89 05 d3 1a 00 00 	mov    %rax,0x1ad3(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    169d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    16a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16a5:	48 01 d0             	add    %rdx,%rax
+}
+    16a8:	c9                   	leave
+    16a9:	c3                   	ret
+
+00000000000016aa <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    16aa:	55                   	push   %rbp
+    16ab:	48 89 e5             	mov    %rsp,%rbp
+    16ae:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    16b2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    16b6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    16bd:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    16be:	48 8d 05 3b 1a 00 00 	lea    0x1a3b(%rip),%rax        # 3100 <runs>
+    16c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16c9:	eb 1a                	jmp    16e5 <pagefree+0x3b>
+    prev = *rp;
+    16cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16cf:	48 8b 00             	mov    (%rax),%rax
+    16d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    16d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16da:	48 8b 00             	mov    (%rax),%rax
+    16dd:	48 83 c0 08          	add    $0x8,%rax
+    16e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e9:	48 8b 00             	mov    (%rax),%rax
+    16ec:	48 85 c0             	test   %rax,%rax
+    16ef:	74 0d                	je     16fe <pagefree+0x54>
+    16f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f5:	48 8b 00             	mov    (%rax),%rax
+    16f8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    16fc:	72 cd                	jb     16cb <pagefree+0x21>
+  r = (struct run *)p;
+    16fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1702:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    170a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    170e:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1711:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1715:	48 8b 10             	mov    (%rax),%rdx
+    1718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    171c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1724:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1728:	48 85 c0             	test   %rax,%rax
+    172b:	74 48                	je     1775 <pagefree+0xcb>
+    172d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1731:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1735:	48 01 c2             	add    %rax,%rdx
+    1738:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    173c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1740:	48 39 c2             	cmp    %rax,%rdx
+    1743:	75 30                	jne    1775 <pagefree+0xcb>
+    r->size += r->next->size;
+    1745:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1749:	48 8b 10             	mov    (%rax),%rdx
+    174c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1750:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1754:	48 8b 00             	mov    (%rax),%rax
+    1757:	48 01 c2             	add    %rax,%rdx
+    175a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    175e:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1765:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1769:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    176d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1771:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1775:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    177a:	74 46                	je     17c2 <pagefree+0x118>
+    177c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1780:	48 8b 10             	mov    (%rax),%rdx
+    1783:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1787:	48 01 d0             	add    %rdx,%rax
+    178a:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    178e:	75 32                	jne    17c2 <pagefree+0x118>
+    prev->size += r->size;
+    1790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1794:	48 8b 10             	mov    (%rax),%rdx
+    1797:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    179b:	48 8b 00             	mov    (%rax),%rax
+    179e:	48 01 c2             	add    %rax,%rdx
+    17a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a5:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    17a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17ac:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    17b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    17c0:	eb 0c                	jmp    17ce <pagefree+0x124>
+  } else {
+    *rp = r;
+    17c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17ca:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    17cd:	90                   	nop
+    17ce:	90                   	nop
+    17cf:	5d                   	pop    %rbp
+    17d0:	c3                   	ret
+
+00000000000017d1 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    17d1:	55                   	push   %rbp
+    17d2:	48 89 e5             	mov    %rsp,%rbp
+    17d5:	48 83 ec 40          	sub    $0x40,%rsp
+    17d9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    17dd:	48 8d 05 1c 19 00 00 	lea    0x191c(%rip),%rax        # 3100 <runs>
+    17e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17e8:	eb 66                	jmp    1850 <pagealloc+0x7f>
+    if (r->size == n) {
+    17ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17ee:	48 8b 00             	mov    (%rax),%rax
+    17f1:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    17f5:	75 18                	jne    180f <pagealloc+0x3e>
+      *rp = r->next;
+    17f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17fb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1803:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    180a:	e9 ca 00 00 00       	jmp    18d9 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    180f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1813:	48 8b 00             	mov    (%rax),%rax
+    1816:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    181a:	73 28                	jae    1844 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    181c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1820:	48 8b 00             	mov    (%rax),%rax
+    1823:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1827:	48 89 c2             	mov    %rax,%rdx
+    182a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    182e:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1831:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1835:	48 8b 10             	mov    (%rax),%rdx
+    1838:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    183c:	48 01 d0             	add    %rdx,%rax
+    183f:	e9 95 00 00 00       	jmp    18d9 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1844:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1848:	48 83 c0 08          	add    $0x8,%rax
+    184c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1854:	48 8b 00             	mov    (%rax),%rax
+    1857:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    185b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1860:	75 88                	jne    17ea <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1862:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1866:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    186a:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1871:	00 
+    1872:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1876:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    187a:	48 39 c2             	cmp    %rax,%rdx
+    187d:	48 0f 43 c2          	cmovae %rdx,%rax
+    1881:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1885:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1889:	48 89 c7             	mov    %rax,%rdi
+    188c:	e8 8c fd ff ff       	call   161d <morecore>
+    1891:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1895:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    189a:	75 07                	jne    18a3 <pagealloc+0xd2>
+    return 0;
+    189c:	b8 00 00 00 00       	mov    $0x0,%eax
+    18a1:	eb 36                	jmp    18d9 <pagealloc+0x108>
+  if (m > n)
+    18a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18a7:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    18ab:	73 1a                	jae    18c7 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    18ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18b1:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18b5:	48 89 c2             	mov    %rax,%rdx
+    18b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    18bc:	48 89 d6             	mov    %rdx,%rsi
+    18bf:	48 89 c7             	mov    %rax,%rdi
+    18c2:	e8 e3 fd ff ff       	call   16aa <pagefree>
+  return p + m - n;
+    18c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18cb:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18cf:	48 89 c2             	mov    %rax,%rdx
+    18d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    18d6:	48 01 d0             	add    %rdx,%rax
+}
+    18d9:	c9                   	leave
+    18da:	c3                   	ret
+
+00000000000018db <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    18db:	55                   	push   %rbp
+    18dc:	48 89 e5             	mov    %rsp,%rbp
+    18df:	48 83 ec 30          	sub    $0x30,%rsp
+    18e3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    18e6:	bf 00 10 00 00       	mov    $0x1000,%edi
+    18eb:	e8 e1 fe ff ff       	call   17d1 <pagealloc>
+    18f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18f4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    18f9:	75 0a                	jne    1905 <refill+0x2a>
+    return -1;
+    18fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1900:	e9 da 00 00 00       	jmp    19df <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1905:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    190c:	00 
+    190d:	e9 ba 00 00 00       	jmp    19cc <refill+0xf1>
+    b = (struct block *)(p + off);
+    1912:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1916:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    191a:	48 01 d0             	add    %rdx,%rax
+    191d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1921:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1924:	ba 20 00 00 00       	mov    $0x20,%edx
+    1929:	89 c1                	mov    %eax,%ecx
+    192b:	48 d3 e2             	shl    %cl,%rdx
+    192e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1932:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1935:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1938:	48 63 d0             	movslq %eax,%rdx
+    193b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1943:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1946:	48 98                	cltq
+    1948:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    194f:	00 
+    1950:	48 8d 05 69 17 00 00 	lea    0x1769(%rip),%rax        # 30c0 <freelist>
+    1957:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    195b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    195f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1963:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1966:	48 98                	cltq
+    1968:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    196f:	00 
+    1970:	48 8d 15 49 17 00 00 	lea    0x1749(%rip),%rdx        # 30c0 <freelist>
+    1977:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    197f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1982:	48 98                	cltq
+    1984:	48 83 c0 08          	add    $0x8,%rax
+    1988:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    198f:	00 
+    1990:	48 8d 05 8d 17 00 00 	lea    0x178d(%rip),%rax        # 3124 <stats+0x4>
+    1997:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    199a:	8d 48 01             	lea    0x1(%rax),%ecx
+    199d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19a0:	48 98                	cltq
+    19a2:	48 83 c0 08          	add    $0x8,%rax
+    19a6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    19ad:	00 
+    19ae:	48 8d 05 6f 17 00 00 	lea    0x176f(%rip),%rax        # 3124 <stats+0x4>
+    19b5:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    19b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19bb:	ba 20 00 00 00       	mov    $0x20,%edx
+    19c0:	89 c1                	mov    %eax,%ecx
+    19c2:	48 d3 e2             	shl    %cl,%rdx
+    19c5:	48 89 d0             	mov    %rdx,%rax
+    19c8:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    19cc:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    19d3:	00 
+    19d4:	0f 86 38 ff ff ff    	jbe    1912 <refill+0x37>
+  }
+  return 0;
+    19da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    19df:	c9                   	leave
+    19e0:	c3                   	ret
+
+00000000000019e1 <malloc>:
+
+void *malloc(uint nbytes) {
+    19e1:	55                   	push   %rbp
+    19e2:	48 89 e5             	mov    %rsp,%rbp
+    19e5:	48 83 ec 30          	sub    $0x30,%rsp
+    19e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    19ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19ef:	48 83 c0 10          	add    $0x10,%rax
+    19f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    19f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    19fe:	eb 04                	jmp    1a04 <malloc+0x23>
+    1a00:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1a04:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1a08:	7f 16                	jg     1a20 <malloc+0x3f>
+    1a0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a0d:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a12:	89 c1                	mov    %eax,%ecx
+    1a14:	48 d3 e2             	shl    %cl,%rdx
+    1a17:	48 89 d0             	mov    %rdx,%rax
+    1a1a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1a1e:	72 e0                	jb     1a00 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1a20:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1a24:	75 7d                	jne    1aa3 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1a26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a2a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1a30:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1a36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1a3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a3e:	48 89 c7             	mov    %rax,%rdi
+    1a41:	e8 8b fd ff ff       	call   17d1 <pagealloc>
+    1a46:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1a4a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1a4f:	75 0a                	jne    1a5b <malloc+0x7a>
+      return 0;
+    1a51:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a56:	e9 2c 01 00 00       	jmp    1b87 <malloc+0x1a6>
+    h->size = n;
+    1a5b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a5f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a63:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1a66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a6a:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1a71:	00 
+    stats.inuse[LARGE]++;
+    1a72:	8b 05 c8 16 00 00    	mov    0x16c8(%rip),%eax        # 3140 <stats+0x20>
+    1a78:	83 c0 01             	add    $0x1,%eax
+    1a7b:	89 05 bf 16 00 00    	mov    %eax,0x16bf(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    1a81:	48 8b 15 e0 16 00 00 	mov    0x16e0(%rip),%rdx        # 3168 <stats+0x48>
+    1a88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a8c:	48 01 d0             	add    %rdx,%rax
+    1a8f:	48 89 05 d2 16 00 00 	mov    %rax,0x16d2(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    1a96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a9a:	48 83 c0 10          	add    $0x10,%rax
+    1a9e:	e9 e4 00 00 00       	jmp    1b87 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1aa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aa6:	48 98                	cltq
+    1aa8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1aaf:	00 
+    1ab0:	48 8d 05 09 16 00 00 	lea    0x1609(%rip),%rax        # 30c0 <freelist>
+    1ab7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1abb:	48 85 c0             	test   %rax,%rax
+    1abe:	75 18                	jne    1ad8 <malloc+0xf7>
+    1ac0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ac3:	89 c7                	mov    %eax,%edi
+    1ac5:	e8 11 fe ff ff       	call   18db <refill>
+    1aca:	85 c0                	test   %eax,%eax
+    1acc:	79 0a                	jns    1ad8 <malloc+0xf7>
+    return 0;
+    1ace:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ad3:	e9 af 00 00 00       	jmp    1b87 <malloc+0x1a6>
+  b = freelist[c];
+    1ad8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1adb:	48 98                	cltq
+    1add:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ae4:	00 
+    1ae5:	48 8d 05 d4 15 00 00 	lea    0x15d4(%rip),%rax        # 30c0 <freelist>
+    1aec:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1af0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1af4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1af8:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1afc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1aff:	48 63 d2             	movslq %edx,%rdx
+    1b02:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1b09:	00 
+    1b0a:	48 8d 15 af 15 00 00 	lea    0x15af(%rip),%rdx        # 30c0 <freelist>
+    1b11:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1b15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b18:	48 98                	cltq
+    1b1a:	48 83 c0 08          	add    $0x8,%rax
+    1b1e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b25:	00 
+    1b26:	48 8d 05 f7 15 00 00 	lea    0x15f7(%rip),%rax        # 3124 <stats+0x4>
+    1b2d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b30:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1b33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b36:	48 98                	cltq
+    1b38:	48 83 c0 08          	add    $0x8,%rax
+    1b3c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b43:	00 
+    1b44:	48 8d 05 d9 15 00 00 	lea    0x15d9(%rip),%rax        # 3124 <stats+0x4>
+    1b4b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1b4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b51:	48 98                	cltq
+    1b53:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b5a:	00 
+    1b5b:	48 8d 05 be 15 00 00 	lea    0x15be(%rip),%rax        # 3120 <stats>
+    1b62:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b65:	8d 48 01             	lea    0x1(%rax),%ecx
+    1b68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b6b:	48 98                	cltq
+    1b6d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b74:	00 
+    1b75:	48 8d 05 a4 15 00 00 	lea    0x15a4(%rip),%rax        # 3120 <stats>
+    1b7c:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1b7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b83:	48 83 c0 10          	add    $0x10,%rax
+}
+    1b87:	c9                   	leave
+    1b88:	c3                   	ret
+
+0000000000001b89 <free>:
+
+void free(void *ap) {
+    1b89:	55                   	push   %rbp
+    1b8a:	48 89 e5             	mov    %rsp,%rbp
+    1b8d:	48 83 ec 18          	sub    $0x18,%rsp
+    1b91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1b95:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1b9a:	0f 84 03 01 00 00    	je     1ca3 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1ba0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ba4:	48 83 e8 10          	sub    $0x10,%rax
+    1ba8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1bac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bb0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1bb8:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1bbd:	75 42                	jne    1c01 <free+0x78>
+    stats.inuse[LARGE]--;
+    1bbf:	8b 05 7b 15 00 00    	mov    0x157b(%rip),%eax        # 3140 <stats+0x20>
+    1bc5:	83 e8 01             	sub    $0x1,%eax
+    1bc8:	89 05 72 15 00 00    	mov    %eax,0x1572(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1bce:	48 8b 15 93 15 00 00 	mov    0x1593(%rip),%rdx        # 3168 <stats+0x48>
+    1bd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd9:	48 8b 00             	mov    (%rax),%rax
+    1bdc:	48 29 c2             	sub    %rax,%rdx
+    1bdf:	48 89 15 82 15 00 00 	mov    %rdx,0x1582(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1be6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bea:	48 8b 10             	mov    (%rax),%rdx
+    1bed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf1:	48 89 d6             	mov    %rdx,%rsi
+    1bf4:	48 89 c7             	mov    %rax,%rdi
+    1bf7:	e8 ae fa ff ff       	call   16aa <pagefree>
+    return;
+    1bfc:	e9 a3 00 00 00       	jmp    1ca4 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1c01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c05:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c0c:	00 
+    1c0d:	48 8d 05 ac 14 00 00 	lea    0x14ac(%rip),%rax        # 30c0 <freelist>
+    1c14:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1c18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c1c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1c20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c24:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1c2b:	00 
+    1c2c:	48 8d 15 8d 14 00 00 	lea    0x148d(%rip),%rdx        # 30c0 <freelist>
+    1c33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c37:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1c3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c3f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c46:	00 
+    1c47:	48 8d 05 d2 14 00 00 	lea    0x14d2(%rip),%rax        # 3120 <stats>
+    1c4e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c51:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1c54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c58:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c5f:	00 
+    1c60:	48 8d 05 b9 14 00 00 	lea    0x14b9(%rip),%rax        # 3120 <stats>
+    1c67:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1c6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c6e:	48 83 c0 08          	add    $0x8,%rax
+    1c72:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c79:	00 
+    1c7a:	48 8d 05 a3 14 00 00 	lea    0x14a3(%rip),%rax        # 3124 <stats+0x4>
+    1c81:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c84:	8d 48 01             	lea    0x1(%rax),%ecx
+    1c87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c8b:	48 83 c0 08          	add    $0x8,%rax
+    1c8f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c96:	00 
+    1c97:	48 8d 05 86 14 00 00 	lea    0x1486(%rip),%rax        # 3124 <stats+0x4>
+    1c9e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1ca1:	eb 01                	jmp    1ca4 <free+0x11b>
+    return;
+    1ca3:	90                   	nop
+}
+    1ca4:	c9                   	leave
+    1ca5:	c3                   	ret
+
+0000000000001ca6 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1ca6:	55                   	push   %rbp
+    1ca7:	48 89 e5             	mov    %rsp,%rbp
+    1caa:	48 83 ec 30          	sub    $0x30,%rsp
+    1cae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1cb1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cb4:	48 8d 15 bd 02 00 00 	lea    0x2bd(%rip),%rdx        # 1f78 <benchreport+0x1aa>
+    1cbb:	48 89 d6             	mov    %rdx,%rsi
+    1cbe:	89 c7                	mov    %eax,%edi
+    1cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cc5:	e8 37 e6 ff ff       	call   301 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1cca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1cd1:	eb 67                	jmp    1d3a <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1cd3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1cd6:	48 98                	cltq
+    1cd8:	48 83 c0 08          	add    $0x8,%rax
+    1cdc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ce3:	00 
+    1ce4:	48 8d 05 39 14 00 00 	lea    0x1439(%rip),%rax        # 3124 <stats+0x4>
+    1ceb:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1cee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1cf1:	48 98                	cltq
+    1cf3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cfa:	00 
+    1cfb:	48 8d 05 1e 14 00 00 	lea    0x141e(%rip),%rax        # 3120 <stats>
+    1d02:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1d05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d08:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d0d:	89 c1                	mov    %eax,%ecx
+    1d0f:	48 d3 e2             	shl    %cl,%rdx
+    1d12:	48 89 d0             	mov    %rdx,%rax
+    1d15:	89 c1                	mov    %eax,%ecx
+    1d17:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1d1a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d1d:	41 89 f9             	mov    %edi,%r9d
+    1d20:	41 89 f0             	mov    %esi,%r8d
+    1d23:	48 8d 35 65 02 00 00 	lea    0x265(%rip),%rsi        # 1f8f <benchreport+0x1c1>
+    1d2a:	89 c7                	mov    %eax,%edi
+    1d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d31:	e8 cb e5 ff ff       	call   301 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d36:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1d3a:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1d3e:	7e 93                	jle    1cd3 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1d40:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1d47:	00 
+  for (r = runs; r; r = r->next)
+    1d48:	48 8b 05 b1 13 00 00 	mov    0x13b1(%rip),%rax        # 3100 <runs>
+    1d4f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d53:	eb 17                	jmp    1d6c <mallocstats+0xc6>
+    nfree += r->size;
+    1d55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d59:	48 8b 00             	mov    (%rax),%rax
+    1d5c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1d60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d64:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1d68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d6c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1d71:	75 e2                	jne    1d55 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1d73:	48 8b 05 f6 13 00 00 	mov    0x13f6(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d7a:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1d7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d80:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d84:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1d86:	48 8b 05 db 13 00 00 	mov    0x13db(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d8d:	89 c1                	mov    %eax,%ecx
+    1d8f:	8b 15 ab 13 00 00    	mov    0x13ab(%rip),%edx        # 3140 <stats+0x20>
+    1d95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d98:	41 89 f9             	mov    %edi,%r9d
+    1d9b:	41 89 f0             	mov    %esi,%r8d
+    1d9e:	48 8d 35 fb 01 00 00 	lea    0x1fb(%rip),%rsi        # 1fa0 <benchreport+0x1d2>
+    1da5:	89 c7                	mov    %eax,%edi
+    1da7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dac:	e8 50 e5 ff ff       	call   301 <printf>
+}
+    1db1:	90                   	nop
+    1db2:	c9                   	leave
+    1db3:	c3                   	ret
+
+0000000000001db4 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1db4:	55                   	push   %rbp
+    1db5:	48 89 e5             	mov    %rsp,%rbp
+    1db8:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1dbc:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1dc0:	48 89 c7             	mov    %rax,%rdi
+    1dc3:	e8 9a f7 ff ff       	call   1562 <cycles>
+  return t;
+    1dc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1dcc:	c9                   	leave
+    1dcd:	c3                   	ret
+
+0000000000001dce <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1dce:	55                   	push   %rbp
+    1dcf:	48 89 e5             	mov    %rsp,%rbp
+    1dd2:	48 83 ec 30          	sub    $0x30,%rsp
+    1dd6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1dda:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1dde:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1de1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1de5:	0f 8e 24 01 00 00    	jle    1f0f <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1deb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1df2:	e9 98 00 00 00       	jmp    1e8f <benchreport+0xc1>
+    x = t[i];
+    1df7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dfa:	48 98                	cltq
+    1dfc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e03:	00 
+    1e04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e08:	48 01 d0             	add    %rdx,%rax
+    1e0b:	48 8b 00             	mov    (%rax),%rax
+    1e0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e15:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1e18:	eb 33                	jmp    1e4d <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1e1a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e1d:	48 98                	cltq
+    1e1f:	48 c1 e0 03          	shl    $0x3,%rax
+    1e23:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e2b:	48 01 d0             	add    %rdx,%rax
+    1e2e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1e31:	48 63 d2             	movslq %edx,%rdx
+    1e34:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1e3b:	00 
+    1e3c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1e40:	48 01 ca             	add    %rcx,%rdx
+    1e43:	48 8b 00             	mov    (%rax),%rax
+    1e46:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e49:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1e4d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1e51:	7e 1d                	jle    1e70 <benchreport+0xa2>
+    1e53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e56:	48 98                	cltq
+    1e58:	48 c1 e0 03          	shl    $0x3,%rax
+    1e5c:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e64:	48 01 d0             	add    %rdx,%rax
+    1e67:	48 8b 00             	mov    (%rax),%rax
+    1e6a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1e6e:	72 aa                	jb     1e1a <benchreport+0x4c>
+    t[j] = x;
+    1e70:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e73:	48 98                	cltq
+    1e75:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e7c:	00 
+    1e7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e81:	48 01 c2             	add    %rax,%rdx
+    1e84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e88:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1e8b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1e8f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e92:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1e95:	0f 8c 5c ff ff ff    	jl     1df7 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1e9b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e9e:	48 98                	cltq
+    1ea0:	48 c1 e0 03          	shl    $0x3,%rax
+    1ea4:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ea8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1eac:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1eaf:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1eb2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1eb5:	89 c2                	mov    %eax,%edx
+    1eb7:	c1 ea 1f             	shr    $0x1f,%edx
+    1eba:	01 d0                	add    %edx,%eax
+    1ebc:	d1 f8                	sar    %eax
+    1ebe:	48 98                	cltq
+    1ec0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ec7:	00 
+    1ec8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ecc:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1ecf:	48 8b 38             	mov    (%rax),%rdi
+    1ed2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ed6:	48 8b 30             	mov    (%rax),%rsi
+    1ed9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1edc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ee0:	48 83 ec 08          	sub    $0x8,%rsp
+    1ee4:	51                   	push   %rcx
+    1ee5:	49 89 f9             	mov    %rdi,%r9
+    1ee8:	49 89 f0             	mov    %rsi,%r8
+    1eeb:	89 d1                	mov    %edx,%ecx
+    1eed:	48 89 c2             	mov    %rax,%rdx
+    1ef0:	48 8d 05 e9 00 00 00 	lea    0xe9(%rip),%rax        # 1fe0 <benchreport+0x212>
+    1ef7:	48 89 c6             	mov    %rax,%rsi
+    1efa:	bf 01 00 00 00       	mov    $0x1,%edi
+    1eff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f04:	e8 f8 e3 ff ff       	call   301 <printf>
+    1f09:	48 83 c4 10          	add    $0x10,%rsp
+    1f0d:	eb 01                	jmp    1f10 <benchreport+0x142>
+    return;
+    1f0f:	90                   	nop
+}
+    1f10:	c9                   	leave
+    1f11:	c3                   	ret
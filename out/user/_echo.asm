@@ -0,0 +1,3365 @@
+
+out/user/_echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+       b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  for (i = 1; i < argc; i++)
+       f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      16:	eb 53                	jmp    6b <main+0x6b>
+    printf(1, "%s%s", argv[i], i + 1 < argc ? " " : "\n");
+      18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      1b:	83 c0 01             	add    $0x1,%eax
+      1e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+      21:	7e 09                	jle    2c <main+0x2c>
+      23:	48 8d 05 1e 1e 00 00 	lea    0x1e1e(%rip),%rax        # 1e48 <benchreport+0x145>
+      2a:	eb 07                	jmp    33 <main+0x33>
+      2c:	48 8d 05 17 1e 00 00 	lea    0x1e17(%rip),%rax        # 1e4a <benchreport+0x147>
+      33:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      36:	48 63 d2             	movslq %edx,%rdx
+      39:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+      40:	00 
+      41:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+      45:	48 01 ca             	add    %rcx,%rdx
+      48:	48 8b 12             	mov    (%rdx),%rdx
+      4b:	48 89 c1             	mov    %rax,%rcx
+      4e:	48 8d 05 f7 1d 00 00 	lea    0x1df7(%rip),%rax        # 1e4c <benchreport+0x149>
+      55:	48 89 c6             	mov    %rax,%rsi
+      58:	bf 01 00 00 00       	mov    $0x1,%edi
+      5d:	b8 00 00 00 00       	mov    $0x0,%eax
+      62:	e8 cf 01 00 00       	call   236 <printf>
+  for (i = 1; i < argc; i++)
+      67:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      6e:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+      71:	7c a5                	jl     18 <main+0x18>
+  exit();
+      73:	e8 ee 07 00 00       	call   866 <exit>
+
+0000000000000078 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      78:	55                   	push   %rbp
+      79:	48 89 e5             	mov    %rsp,%rbp
+      7c:	48 83 ec 10          	sub    $0x10,%rsp
+      80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+      83:	89 f0                	mov    %esi,%eax
+      85:	88 45 f8             	mov    %al,-0x8(%rbp)
+      88:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+      8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8f:	89 d6                	mov    %edx,%esi
+      91:	89 c7                	mov    %eax,%edi
+      93:	e8 eb 06 00 00       	call   783 <bputc>
+      98:	90                   	nop
+      99:	c9                   	leave
+      9a:	c3                   	ret
+
+000000000000009b <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+      9b:	55                   	push   %rbp
+      9c:	48 89 e5             	mov    %rsp,%rbp
+      9f:	48 83 ec 50          	sub    $0x50,%rsp
+      a3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+      a6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+      aa:	89 55 c8             	mov    %edx,-0x38(%rbp)
+      ad:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+      b0:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      b4:	74 21                	je     d7 <printint64+0x3c>
+      b6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      ba:	48 c1 e8 3f          	shr    $0x3f,%rax
+      be:	0f b6 c0             	movzbl %al,%eax
+      c1:	89 45 bc             	mov    %eax,-0x44(%rbp)
+      c4:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      c8:	74 0d                	je     d7 <printint64+0x3c>
+    x = -xx;
+      ca:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      ce:	48 f7 d8             	neg    %rax
+      d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      d5:	eb 08                	jmp    df <printint64+0x44>
+  else
+    x = xx;
+      d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+      df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+      e6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+      e9:	48 63 c8             	movslq %eax,%rcx
+      ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      f0:	ba 00 00 00 00       	mov    $0x0,%edx
+      f5:	48 f7 f1             	div    %rcx
+      f8:	48 89 d1             	mov    %rdx,%rcx
+      fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      fe:	8d 50 01             	lea    0x1(%rax),%edx
+     101:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     104:	48 8d 15 f5 2e 00 00 	lea    0x2ef5(%rip),%rdx        # 3000 <digits.1>
+     10b:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     10f:	48 98                	cltq
+     111:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     115:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     118:	48 63 f0             	movslq %eax,%rsi
+     11b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     11f:	ba 00 00 00 00       	mov    $0x0,%edx
+     124:	48 f7 f6             	div    %rsi
+     127:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     12b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     130:	75 b4                	jne    e6 <printint64+0x4b>
+
+  if (sgn)
+     132:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     136:	74 2b                	je     163 <printint64+0xc8>
+    buf[i++] = '-';
+     138:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     13b:	8d 50 01             	lea    0x1(%rax),%edx
+     13e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     141:	48 98                	cltq
+     143:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     148:	eb 19                	jmp    163 <printint64+0xc8>
+    putc(fd, buf[i]);
+     14a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     14d:	48 98                	cltq
+     14f:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     154:	0f be d0             	movsbl %al,%edx
+     157:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     15a:	89 d6                	mov    %edx,%esi
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	e8 15 ff ff ff       	call   78 <putc>
+  while (--i >= 0)
+     163:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     167:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     16b:	79 dd                	jns    14a <printint64+0xaf>
+}
+     16d:	90                   	nop
+     16e:	90                   	nop
+     16f:	c9                   	leave
+     170:	c3                   	ret
+
+0000000000000171 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     171:	55                   	push   %rbp
+     172:	48 89 e5             	mov    %rsp,%rbp
+     175:	48 83 ec 30          	sub    $0x30,%rsp
+     179:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     17c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     17f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     182:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     185:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     18c:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     190:	74 17                	je     1a9 <printint+0x38>
+     192:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     196:	79 11                	jns    1a9 <printint+0x38>
+    neg = 1;
+     198:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     19f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1a2:	f7 d8                	neg    %eax
+     1a4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1a7:	eb 06                	jmp    1af <printint+0x3e>
+  } else {
+    x = xx;
+     1a9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     1af:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1b6:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     1b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1bc:	ba 00 00 00 00       	mov    $0x0,%edx
+     1c1:	f7 f1                	div    %ecx
+     1c3:	89 d1                	mov    %edx,%ecx
+     1c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1c8:	8d 50 01             	lea    0x1(%rax),%edx
+     1cb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1ce:	89 c9                	mov    %ecx,%ecx
+     1d0:	48 8d 15 49 2e 00 00 	lea    0x2e49(%rip),%rdx        # 3020 <digits.0>
+     1d7:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     1db:	48 98                	cltq
+     1dd:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     1e1:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     1e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1e7:	ba 00 00 00 00       	mov    $0x0,%edx
+     1ec:	f7 f6                	div    %esi
+     1ee:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1f1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     1f5:	75 bf                	jne    1b6 <printint+0x45>
+  if (neg)
+     1f7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     1fb:	74 2b                	je     228 <printint+0xb7>
+    buf[i++] = '-';
+     1fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     200:	8d 50 01             	lea    0x1(%rax),%edx
+     203:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     206:	48 98                	cltq
+     208:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     20d:	eb 19                	jmp    228 <printint+0xb7>
+    putc(fd, buf[i]);
+     20f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     212:	48 98                	cltq
+     214:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     219:	0f be d0             	movsbl %al,%edx
+     21c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     21f:	89 d6                	mov    %edx,%esi
+     221:	89 c7                	mov    %eax,%edi
+     223:	e8 50 fe ff ff       	call   78 <putc>
+  while (--i >= 0)
+     228:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     22c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     230:	79 dd                	jns    20f <printint+0x9e>
+}
+     232:	90                   	nop
+     233:	90                   	nop
+     234:	c9                   	leave
+     235:	c3                   	ret
+
+0000000000000236 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     236:	55                   	push   %rbp
+     237:	48 89 e5             	mov    %rsp,%rbp
+     23a:	48 83 ec 70          	sub    $0x70,%rsp
+     23e:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     241:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     245:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     249:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     24d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     251:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     255:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     25c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     260:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     264:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     268:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     26c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     273:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     27a:	e9 67 02 00 00       	jmp    4e6 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     27f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     282:	48 63 d0             	movslq %eax,%rdx
+     285:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     289:	48 01 d0             	add    %rdx,%rax
+     28c:	0f b6 00             	movzbl (%rax),%eax
+     28f:	0f be c0             	movsbl %al,%eax
+     292:	25 ff 00 00 00       	and    $0xff,%eax
+     297:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     29a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     29e:	75 30                	jne    2d0 <printf+0x9a>
+      if (c == '%') {
+     2a0:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     2a4:	75 13                	jne    2b9 <printf+0x83>
+        state = '%';
+     2a6:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     2ad:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     2b4:	e9 29 02 00 00       	jmp    4e2 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     2b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     2bc:	0f be d0             	movsbl %al,%edx
+     2bf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     2c2:	89 d6                	mov    %edx,%esi
+     2c4:	89 c7                	mov    %eax,%edi
+     2c6:	e8 ad fd ff ff       	call   78 <putc>
+     2cb:	e9 12 02 00 00       	jmp    4e2 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     2d0:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     2d4:	0f 85 08 02 00 00    	jne    4e2 <printf+0x2ac>
+      if (c == 'l') {
+     2da:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     2de:	75 0c                	jne    2ec <printf+0xb6>
+        lflag = 1;
+     2e0:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     2e7:	e9 f6 01 00 00       	jmp    4e2 <printf+0x2ac>
+      } else if (c == 'd') {
+     2ec:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     2f0:	0f 85 93 00 00 00    	jne    389 <printf+0x153>
+        if (lflag == 1)
+     2f6:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     2fa:	75 47                	jne    343 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     2fc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     2ff:	83 f8 2f             	cmp    $0x2f,%eax
+     302:	77 17                	ja     31b <printf+0xe5>
+     304:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     308:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     30b:	89 d2                	mov    %edx,%edx
+     30d:	48 01 d0             	add    %rdx,%rax
+     310:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     313:	83 c2 08             	add    $0x8,%edx
+     316:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     319:	eb 0c                	jmp    327 <printf+0xf1>
+     31b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     31f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     323:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     327:	48 8b 30             	mov    (%rax),%rsi
+     32a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     32d:	b9 01 00 00 00       	mov    $0x1,%ecx
+     332:	ba 0a 00 00 00       	mov    $0xa,%edx
+     337:	89 c7                	mov    %eax,%edi
+     339:	e8 5d fd ff ff       	call   9b <printint64>
+     33e:	e9 98 01 00 00       	jmp    4db <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     343:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     346:	83 f8 2f             	cmp    $0x2f,%eax
+     349:	77 17                	ja     362 <printf+0x12c>
+     34b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     34f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     352:	89 d2                	mov    %edx,%edx
+     354:	48 01 d0             	add    %rdx,%rax
+     357:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     35a:	83 c2 08             	add    $0x8,%edx
+     35d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     360:	eb 0c                	jmp    36e <printf+0x138>
+     362:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     366:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     36a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     36e:	8b 30                	mov    (%rax),%esi
+     370:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     373:	b9 01 00 00 00       	mov    $0x1,%ecx
+     378:	ba 0a 00 00 00       	mov    $0xa,%edx
+     37d:	89 c7                	mov    %eax,%edi
+     37f:	e8 ed fd ff ff       	call   171 <printint>
+     384:	e9 52 01 00 00       	jmp    4db <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     389:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     38d:	74 0a                	je     399 <printf+0x163>
+     38f:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     393:	0f 85 93 00 00 00    	jne    42c <printf+0x1f6>
+        if (lflag == 1)
+     399:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     39d:	75 47                	jne    3e6 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     39f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3a2:	83 f8 2f             	cmp    $0x2f,%eax
+     3a5:	77 17                	ja     3be <printf+0x188>
+     3a7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3ab:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3ae:	89 d2                	mov    %edx,%edx
+     3b0:	48 01 d0             	add    %rdx,%rax
+     3b3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3b6:	83 c2 08             	add    $0x8,%edx
+     3b9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3bc:	eb 0c                	jmp    3ca <printf+0x194>
+     3be:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3c2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3c6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3ca:	48 8b 30             	mov    (%rax),%rsi
+     3cd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     3d5:	ba 10 00 00 00       	mov    $0x10,%edx
+     3da:	89 c7                	mov    %eax,%edi
+     3dc:	e8 ba fc ff ff       	call   9b <printint64>
+        if (lflag == 1)
+     3e1:	e9 f5 00 00 00       	jmp    4db <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     3e6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3e9:	83 f8 2f             	cmp    $0x2f,%eax
+     3ec:	77 17                	ja     405 <printf+0x1cf>
+     3ee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3f2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3f5:	89 d2                	mov    %edx,%edx
+     3f7:	48 01 d0             	add    %rdx,%rax
+     3fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3fd:	83 c2 08             	add    $0x8,%edx
+     400:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     403:	eb 0c                	jmp    411 <printf+0x1db>
+     405:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     409:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     40d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     411:	8b 30                	mov    (%rax),%esi
+     413:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     416:	b9 00 00 00 00       	mov    $0x0,%ecx
+     41b:	ba 10 00 00 00       	mov    $0x10,%edx
+     420:	89 c7                	mov    %eax,%edi
+     422:	e8 4a fd ff ff       	call   171 <printint>
+        if (lflag == 1)
+     427:	e9 af 00 00 00       	jmp    4db <printf+0x2a5>
+      } else if (c == 's') {
+     42c:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     430:	75 6e                	jne    4a0 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     432:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     435:	83 f8 2f             	cmp    $0x2f,%eax
+     438:	77 17                	ja     451 <printf+0x21b>
+     43a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     43e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     441:	89 d2                	mov    %edx,%edx
+     443:	48 01 d0             	add    %rdx,%rax
+     446:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     449:	83 c2 08             	add    $0x8,%edx
+     44c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     44f:	eb 0c                	jmp    45d <printf+0x227>
+     451:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     455:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     459:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     45d:	48 8b 00             	mov    (%rax),%rax
+     460:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     464:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     469:	75 28                	jne    493 <printf+0x25d>
+          s = "(null)";
+     46b:	48 8d 05 df 19 00 00 	lea    0x19df(%rip),%rax        # 1e51 <benchreport+0x14e>
+     472:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     476:	eb 1b                	jmp    493 <printf+0x25d>
+          putc(fd, *s);
+     478:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     47c:	0f b6 00             	movzbl (%rax),%eax
+     47f:	0f be d0             	movsbl %al,%edx
+     482:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     485:	89 d6                	mov    %edx,%esi
+     487:	89 c7                	mov    %eax,%edi
+     489:	e8 ea fb ff ff       	call   78 <putc>
+        for (; *s; s++)
+     48e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     493:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     497:	0f b6 00             	movzbl (%rax),%eax
+     49a:	84 c0                	test   %al,%al
+     49c:	75 da                	jne    478 <printf+0x242>
+     49e:	eb 3b                	jmp    4db <printf+0x2a5>
+      } else if (c == '%') {
+     4a0:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     4a4:	75 14                	jne    4ba <printf+0x284>
+        putc(fd, c);
+     4a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4a9:	0f be d0             	movsbl %al,%edx
+     4ac:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4af:	89 d6                	mov    %edx,%esi
+     4b1:	89 c7                	mov    %eax,%edi
+     4b3:	e8 c0 fb ff ff       	call   78 <putc>
+     4b8:	eb 21                	jmp    4db <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     4ba:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4bd:	be 25 00 00 00       	mov    $0x25,%esi
+     4c2:	89 c7                	mov    %eax,%edi
+     4c4:	e8 af fb ff ff       	call   78 <putc>
+        putc(fd, c);
+     4c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4cc:	0f be d0             	movsbl %al,%edx
+     4cf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4d2:	89 d6                	mov    %edx,%esi
+     4d4:	89 c7                	mov    %eax,%edi
+     4d6:	e8 9d fb ff ff       	call   78 <putc>
+      }
+      state = 0;
+     4db:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     4e2:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     4e6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     4e9:	48 63 d0             	movslq %eax,%rdx
+     4ec:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     4f0:	48 01 d0             	add    %rdx,%rax
+     4f3:	0f b6 00             	movzbl (%rax),%eax
+     4f6:	84 c0                	test   %al,%al
+     4f8:	0f 85 81 fd ff ff    	jne    27f <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     4fe:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     501:	89 c7                	mov    %eax,%edi
+     503:	e8 ee 02 00 00       	call   7f6 <bflushtty>
+}
+     508:	90                   	nop
+     509:	c9                   	leave
+     50a:	c3                   	ret
+
+000000000000050b <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     50b:	55                   	push   %rbp
+     50c:	48 89 e5             	mov    %rsp,%rbp
+     50f:	48 83 ec 30          	sub    $0x30,%rsp
+     513:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     516:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     51a:	78 06                	js     522 <getbuf+0x17>
+     51c:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     520:	7e 0a                	jle    52c <getbuf+0x21>
+    return 0;
+     522:	b8 00 00 00 00       	mov    $0x0,%eax
+     527:	e9 94 00 00 00       	jmp    5c0 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     52c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     52f:	48 98                	cltq
+     531:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     538:	00 
+     539:	48 8d 05 00 2b 00 00 	lea    0x2b00(%rip),%rax        # 3040 <obufs>
+     540:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     544:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     548:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     54d:	75 6d                	jne    5bc <getbuf+0xb1>
+     54f:	bf 08 02 00 00       	mov    $0x208,%edi
+     554:	e8 bd 13 00 00       	call   1916 <malloc>
+     559:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     55d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     562:	74 58                	je     5bc <getbuf+0xb1>
+    b->n = 0;
+     564:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     568:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     56e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     572:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     575:	48 89 d6             	mov    %rdx,%rsi
+     578:	89 c7                	mov    %eax,%edi
+     57a:	e8 e4 0d 00 00       	call   1363 <fstat>
+     57f:	85 c0                	test   %eax,%eax
+     581:	75 11                	jne    594 <getbuf+0x89>
+     583:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     587:	66 83 f8 03          	cmp    $0x3,%ax
+     58b:	75 07                	jne    594 <getbuf+0x89>
+     58d:	ba 01 00 00 00       	mov    $0x1,%edx
+     592:	eb 05                	jmp    599 <getbuf+0x8e>
+     594:	ba 00 00 00 00       	mov    $0x0,%edx
+     599:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     59d:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     5a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5a3:	48 98                	cltq
+     5a5:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     5ac:	00 
+     5ad:	48 8d 15 8c 2a 00 00 	lea    0x2a8c(%rip),%rdx        # 3040 <obufs>
+     5b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5b8:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     5bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5c0:	c9                   	leave
+     5c1:	c3                   	ret
+
+00000000000005c2 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     5c2:	55                   	push   %rbp
+     5c3:	48 89 e5             	mov    %rsp,%rbp
+     5c6:	48 83 ec 20          	sub    $0x20,%rsp
+     5ca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     5cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     5d1:	78 33                	js     606 <bflush+0x44>
+     5d3:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     5d7:	7f 2d                	jg     606 <bflush+0x44>
+     5d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     5dc:	48 98                	cltq
+     5de:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     5e5:	00 
+     5e6:	48 8d 05 53 2a 00 00 	lea    0x2a53(%rip),%rax        # 3040 <obufs>
+     5ed:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     5f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     5f5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     5fa:	74 0a                	je     606 <bflush+0x44>
+     5fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     600:	8b 00                	mov    (%rax),%eax
+     602:	85 c0                	test   %eax,%eax
+     604:	75 07                	jne    60d <bflush+0x4b>
+    return 0;
+     606:	b8 00 00 00 00       	mov    $0x0,%eax
+     60b:	eb 3c                	jmp    649 <bflush+0x87>
+  n = b->n;
+     60d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     611:	8b 00                	mov    (%rax),%eax
+     613:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     61a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     620:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     624:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     628:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     62b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     62e:	48 89 ce             	mov    %rcx,%rsi
+     631:	89 c7                	mov    %eax,%edi
+     633:	e8 de 0c 00 00       	call   1316 <write>
+     638:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     63b:	75 07                	jne    644 <bflush+0x82>
+     63d:	b8 00 00 00 00       	mov    $0x0,%eax
+     642:	eb 05                	jmp    649 <bflush+0x87>
+     644:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     649:	c9                   	leave
+     64a:	c3                   	ret
+
+000000000000064b <bflushall>:
+
+void bflushall(void) {
+     64b:	55                   	push   %rbp
+     64c:	48 89 e5             	mov    %rsp,%rbp
+     64f:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     653:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     65a:	eb 0e                	jmp    66a <bflushall+0x1f>
+    bflush(fd);
+     65c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     65f:	89 c7                	mov    %eax,%edi
+     661:	e8 5c ff ff ff       	call   5c2 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     666:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     66a:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     66e:	7e ec                	jle    65c <bflushall+0x11>
+}
+     670:	90                   	nop
+     671:	90                   	nop
+     672:	c9                   	leave
+     673:	c3                   	ret
+
+0000000000000674 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     674:	55                   	push   %rbp
+     675:	48 89 e5             	mov    %rsp,%rbp
+     678:	48 83 ec 30          	sub    $0x30,%rsp
+     67c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     67f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     683:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     686:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     689:	89 c7                	mov    %eax,%edi
+     68b:	e8 7b fe ff ff       	call   50b <getbuf>
+     690:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     694:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     699:	75 19                	jne    6b4 <bwrite+0x40>
+    return write(fd, s, n);
+     69b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     69e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     6a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6a5:	48 89 ce             	mov    %rcx,%rsi
+     6a8:	89 c7                	mov    %eax,%edi
+     6aa:	e8 67 0c 00 00       	call   1316 <write>
+     6af:	e9 cd 00 00 00       	jmp    781 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     6b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6bb:	e9 92 00 00 00       	jmp    752 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     6c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6c4:	8b 00                	mov    (%rax),%eax
+     6c6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6cb:	75 18                	jne    6e5 <bwrite+0x71>
+     6cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6d0:	89 c7                	mov    %eax,%edi
+     6d2:	e8 eb fe ff ff       	call   5c2 <bflush>
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	79 0a                	jns    6e5 <bwrite+0x71>
+      return -1;
+     6db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6e0:	e9 9c 00 00 00       	jmp    781 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     6e5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6e8:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     6eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     6ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6f2:	8b 00                	mov    (%rax),%eax
+     6f4:	ba 00 02 00 00       	mov    $0x200,%edx
+     6f9:	29 c2                	sub    %eax,%edx
+     6fb:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     6fe:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     701:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     704:	39 c2                	cmp    %eax,%edx
+     706:	0f 4e c2             	cmovle %edx,%eax
+     709:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     70c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     70f:	48 63 d0             	movslq %eax,%rdx
+     712:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     716:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     71a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     71e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     726:	8b 00                	mov    (%rax),%eax
+     728:	48 98                	cltq
+     72a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     72e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     731:	89 c2                	mov    %eax,%edx
+     733:	48 89 cf             	mov    %rcx,%rdi
+     736:	e8 e9 06 00 00       	call   e24 <memmove>
+    b->n += m;
+     73b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     73f:	8b 10                	mov    (%rax),%edx
+     741:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     744:	01 c2                	add    %eax,%edx
+     746:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     74a:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     74c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     74f:	01 45 fc             	add    %eax,-0x4(%rbp)
+     752:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     755:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     758:	0f 8c 62 ff ff ff    	jl     6c0 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     75e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     762:	8b 40 04             	mov    0x4(%rax),%eax
+     765:	85 c0                	test   %eax,%eax
+     767:	74 15                	je     77e <bwrite+0x10a>
+     769:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     76c:	89 c7                	mov    %eax,%edi
+     76e:	e8 4f fe ff ff       	call   5c2 <bflush>
+     773:	85 c0                	test   %eax,%eax
+     775:	79 07                	jns    77e <bwrite+0x10a>
+    return -1;
+     777:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     77c:	eb 03                	jmp    781 <bwrite+0x10d>
+  return n;
+     77e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     781:	c9                   	leave
+     782:	c3                   	ret
+
+0000000000000783 <bputc>:
+
+void bputc(int fd, char c) {
+     783:	55                   	push   %rbp
+     784:	48 89 e5             	mov    %rsp,%rbp
+     787:	48 83 ec 20          	sub    $0x20,%rsp
+     78b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     78e:	89 f0                	mov    %esi,%eax
+     790:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     793:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     796:	89 c7                	mov    %eax,%edi
+     798:	e8 6e fd ff ff       	call   50b <getbuf>
+     79d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     7a1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     7a6:	75 18                	jne    7c0 <bputc+0x3d>
+    write(fd, &c, 1);
+     7a8:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     7ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7af:	ba 01 00 00 00       	mov    $0x1,%edx
+     7b4:	48 89 ce             	mov    %rcx,%rsi
+     7b7:	89 c7                	mov    %eax,%edi
+     7b9:	e8 58 0b 00 00       	call   1316 <write>
+    return;
+     7be:	eb 34                	jmp    7f4 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     7c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7c4:	8b 00                	mov    (%rax),%eax
+     7c6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7cb:	75 0a                	jne    7d7 <bputc+0x54>
+    bflush(fd);
+     7cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7d0:	89 c7                	mov    %eax,%edi
+     7d2:	e8 eb fd ff ff       	call   5c2 <bflush>
+  b->data[b->n++] = c;
+     7d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7db:	8b 00                	mov    (%rax),%eax
+     7dd:	8d 48 01             	lea    0x1(%rax),%ecx
+     7e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     7e4:	89 0a                	mov    %ecx,(%rdx)
+     7e6:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     7ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     7ee:	48 98                	cltq
+     7f0:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     7f4:	c9                   	leave
+     7f5:	c3                   	ret
+
+00000000000007f6 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     7f6:	55                   	push   %rbp
+     7f7:	48 89 e5             	mov    %rsp,%rbp
+     7fa:	48 83 ec 10          	sub    $0x10,%rsp
+     7fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     801:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     805:	78 4c                	js     853 <bflushtty+0x5d>
+     807:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     80b:	7f 46                	jg     853 <bflushtty+0x5d>
+     80d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     810:	48 98                	cltq
+     812:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     819:	00 
+     81a:	48 8d 05 1f 28 00 00 	lea    0x281f(%rip),%rax        # 3040 <obufs>
+     821:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     825:	48 85 c0             	test   %rax,%rax
+     828:	74 29                	je     853 <bflushtty+0x5d>
+     82a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     82d:	48 98                	cltq
+     82f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     836:	00 
+     837:	48 8d 05 02 28 00 00 	lea    0x2802(%rip),%rax        # 3040 <obufs>
+     83e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     842:	8b 40 04             	mov    0x4(%rax),%eax
+     845:	85 c0                	test   %eax,%eax
+     847:	74 0a                	je     853 <bflushtty+0x5d>
+    bflush(fd);
+     849:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     84c:	89 c7                	mov    %eax,%edi
+     84e:	e8 6f fd ff ff       	call   5c2 <bflush>
+}
+     853:	90                   	nop
+     854:	c9                   	leave
+     855:	c3                   	ret
+
+0000000000000856 <fork>:
+
+int fork(void) {
+     856:	55                   	push   %rbp
+     857:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     85a:	e8 ec fd ff ff       	call   64b <bflushall>
+  return _fork();
+     85f:	e8 7b 0a 00 00       	call   12df <_fork>
+}
+     864:	5d                   	pop    %rbp
+     865:	c3                   	ret
+
+0000000000000866 <exit>:
+
+noreturn void exit(void) {
+     866:	55                   	push   %rbp
+     867:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     86a:	e8 dc fd ff ff       	call   64b <bflushall>
+  _exit();
+     86f:	e8 76 0a 00 00       	call   12ea <_exit>
+
+0000000000000874 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     874:	55                   	push   %rbp
+     875:	48 89 e5             	mov    %rsp,%rbp
+     878:	48 83 ec 10          	sub    $0x10,%rsp
+     87c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     880:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     884:	e8 c2 fd ff ff       	call   64b <bflushall>
+  return _exec(path, argv);
+     889:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     88d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     891:	48 89 d6             	mov    %rdx,%rsi
+     894:	48 89 c7             	mov    %rax,%rdi
+     897:	e8 9b 0a 00 00       	call   1337 <_exec>
+}
+     89c:	c9                   	leave
+     89d:	c3                   	ret
+
+000000000000089e <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     89e:	55                   	push   %rbp
+     89f:	48 89 e5             	mov    %rsp,%rbp
+     8a2:	48 83 ec 20          	sub    $0x20,%rsp
+     8a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     8ae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     8b2:	e8 94 fd ff ff       	call   64b <bflushall>
+  return _spawn(path, argv, fds);
+     8b7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     8bb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8c3:	48 89 ce             	mov    %rcx,%rsi
+     8c6:	48 89 c7             	mov    %rax,%rdi
+     8c9:	e8 2f 0b 00 00       	call   13fd <_spawn>
+}
+     8ce:	c9                   	leave
+     8cf:	c3                   	ret
+
+00000000000008d0 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     8d0:	55                   	push   %rbp
+     8d1:	48 89 e5             	mov    %rsp,%rbp
+     8d4:	48 83 ec 10          	sub    $0x10,%rsp
+     8d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     8db:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8df:	78 69                	js     94a <close+0x7a>
+     8e1:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     8e5:	7f 63                	jg     94a <close+0x7a>
+     8e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8ea:	48 98                	cltq
+     8ec:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8f3:	00 
+     8f4:	48 8d 05 45 27 00 00 	lea    0x2745(%rip),%rax        # 3040 <obufs>
+     8fb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8ff:	48 85 c0             	test   %rax,%rax
+     902:	74 46                	je     94a <close+0x7a>
+    bflush(fd);
+     904:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     907:	89 c7                	mov    %eax,%edi
+     909:	e8 b4 fc ff ff       	call   5c2 <bflush>
+    free(obufs[fd]);
+     90e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     911:	48 98                	cltq
+     913:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     91a:	00 
+     91b:	48 8d 05 1e 27 00 00 	lea    0x271e(%rip),%rax        # 3040 <obufs>
+     922:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     926:	48 89 c7             	mov    %rax,%rdi
+     929:	e8 90 11 00 00       	call   1abe <free>
+    obufs[fd] = 0;
+     92e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     931:	48 98                	cltq
+     933:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     93a:	00 
+     93b:	48 8d 05 fe 26 00 00 	lea    0x26fe(%rip),%rax        # 3040 <obufs>
+     942:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     949:	00 
+  }
+  return _close(fd);
+     94a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     94d:	89 c7                	mov    %eax,%edi
+     94f:	e8 cd 09 00 00       	call   1321 <_close>
+}
+     954:	c9                   	leave
+     955:	c3                   	ret
+
+0000000000000956 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     956:	55                   	push   %rbp
+     957:	48 89 e5             	mov    %rsp,%rbp
+     95a:	53                   	push   %rbx
+     95b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     95f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     963:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     967:	48 8b 36             	mov    (%rsi),%rsi
+     96a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     96e:	48 29 f7             	sub    %rsi,%rdi
+     971:	48 89 f9             	mov    %rdi,%rcx
+     974:	bb 00 00 00 00       	mov    $0x0,%ebx
+     979:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     97d:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     981:	48 89 f0             	mov    %rsi,%rax
+     984:	ba 00 00 00 00       	mov    $0x0,%edx
+     989:	48 89 df             	mov    %rbx,%rdi
+     98c:	48 0f af f8          	imul   %rax,%rdi
+     990:	48 89 d6             	mov    %rdx,%rsi
+     993:	48 0f af f1          	imul   %rcx,%rsi
+     997:	48 01 fe             	add    %rdi,%rsi
+     99a:	48 f7 e1             	mul    %rcx
+     99d:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     9a1:	48 89 ca             	mov    %rcx,%rdx
+     9a4:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     9a9:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     9ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     9b1:	c9                   	leave
+     9b2:	c3                   	ret
+
+00000000000009b3 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     9b3:	55                   	push   %rbp
+     9b4:	48 89 e5             	mov    %rsp,%rbp
+     9b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9bb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     9be:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     9c1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9c5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     9c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     9cb:	48 89 ce             	mov    %rcx,%rsi
+     9ce:	48 89 f7             	mov    %rsi,%rdi
+     9d1:	89 d1                	mov    %edx,%ecx
+     9d3:	fc                   	cld
+     9d4:	f3 aa                	rep stos %al,%es:(%rdi)
+     9d6:	89 ca                	mov    %ecx,%edx
+     9d8:	48 89 fe             	mov    %rdi,%rsi
+     9db:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     9df:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     9e2:	90                   	nop
+     9e3:	5d                   	pop    %rbp
+     9e4:	c3                   	ret
+
+00000000000009e5 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     9e5:	55                   	push   %rbp
+     9e6:	48 89 e5             	mov    %rsp,%rbp
+     9e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     9f1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     9f5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     9fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a01:	48 89 ce             	mov    %rcx,%rsi
+     a04:	48 89 f7             	mov    %rsi,%rdi
+     a07:	48 89 d1             	mov    %rdx,%rcx
+     a0a:	fc                   	cld
+     a0b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     a0e:	48 89 ca             	mov    %rcx,%rdx
+     a11:	48 89 fe             	mov    %rdi,%rsi
+     a14:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a18:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a1c:	90                   	nop
+     a1d:	5d                   	pop    %rbp
+     a1e:	c3                   	ret
+
+0000000000000a1f <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     a1f:	55                   	push   %rbp
+     a20:	48 89 e5             	mov    %rsp,%rbp
+     a23:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a27:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a2b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     a2f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a33:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a3b:	48 89 cf             	mov    %rcx,%rdi
+     a3e:	48 89 d6             	mov    %rdx,%rsi
+     a41:	48 89 c1             	mov    %rax,%rcx
+     a44:	fc                   	cld
+     a45:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     a47:	48 89 c8             	mov    %rcx,%rax
+     a4a:	48 89 f2             	mov    %rsi,%rdx
+     a4d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a51:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a55:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a59:	90                   	nop
+     a5a:	5d                   	pop    %rbp
+     a5b:	c3                   	ret
+
+0000000000000a5c <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     a5c:	55                   	push   %rbp
+     a5d:	48 89 e5             	mov    %rsp,%rbp
+     a60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a68:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     a6c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a70:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a78:	48 89 cf             	mov    %rcx,%rdi
+     a7b:	48 89 d6             	mov    %rdx,%rsi
+     a7e:	48 89 c1             	mov    %rax,%rcx
+     a81:	fc                   	cld
+     a82:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     a85:	48 89 c8             	mov    %rcx,%rax
+     a88:	48 89 f2             	mov    %rsi,%rdx
+     a8b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a8f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a97:	90                   	nop
+     a98:	5d                   	pop    %rbp
+     a99:	c3                   	ret
+
+0000000000000a9a <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     a9a:	55                   	push   %rbp
+     a9b:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     a9e:	0f 31                	rdtsc
+     aa0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     aa3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     aa6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     aa9:	48 c1 e0 20          	shl    $0x20,%rax
+     aad:	48 89 c2             	mov    %rax,%rdx
+     ab0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ab3:	48 09 d0             	or     %rdx,%rax
+}
+     ab6:	5d                   	pop    %rbp
+     ab7:	c3                   	ret
+
+0000000000000ab8 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     ab8:	55                   	push   %rbp
+     ab9:	48 89 e5             	mov    %rsp,%rbp
+     abc:	53                   	push   %rbx
+     abd:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     ac0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     ac4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     ac8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     acc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     ad0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ad3:	0f a2                	cpuid
+     ad5:	89 de                	mov    %ebx,%esi
+     ad7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ada:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     add:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     ae0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     ae3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     ae8:	74 09                	je     af3 <cpuid+0x3b>
+    *eaxp = eax;
+     aea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     aee:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     af1:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     af3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     af8:	74 09                	je     b03 <cpuid+0x4b>
+    *ebxp = ebx;
+     afa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     afe:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b01:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     b03:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b08:	74 09                	je     b13 <cpuid+0x5b>
+    *ecxp = ecx;
+     b0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b0e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b11:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     b13:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     b18:	74 09                	je     b23 <cpuid+0x6b>
+    *edxp = edx;
+     b1a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     b1e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     b21:	89 10                	mov    %edx,(%rax)
+}
+     b23:	90                   	nop
+     b24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b28:	c9                   	leave
+     b29:	c3                   	ret
+
+0000000000000b2a <strcpy>:
+char *strcpy(char *s, char *t) {
+     b2a:	55                   	push   %rbp
+     b2b:	48 89 e5             	mov    %rsp,%rbp
+     b2e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b32:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     b36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     b3e:	90                   	nop
+     b3f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b43:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     b47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     b4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b4f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     b53:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     b57:	0f b6 12             	movzbl (%rdx),%edx
+     b5a:	88 10                	mov    %dl,(%rax)
+     b5c:	0f b6 00             	movzbl (%rax),%eax
+     b5f:	84 c0                	test   %al,%al
+     b61:	75 dc                	jne    b3f <strcpy+0x15>
+  return os;
+     b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b67:	5d                   	pop    %rbp
+     b68:	c3                   	ret
+
+0000000000000b69 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     b69:	55                   	push   %rbp
+     b6a:	48 89 e5             	mov    %rsp,%rbp
+     b6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     b75:	eb 0a                	jmp    b81 <strcmp+0x18>
+    p++, q++;
+     b77:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     b7c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b85:	0f b6 00             	movzbl (%rax),%eax
+     b88:	84 c0                	test   %al,%al
+     b8a:	74 12                	je     b9e <strcmp+0x35>
+     b8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b90:	0f b6 10             	movzbl (%rax),%edx
+     b93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b97:	0f b6 00             	movzbl (%rax),%eax
+     b9a:	38 c2                	cmp    %al,%dl
+     b9c:	74 d9                	je     b77 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     b9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ba2:	0f b6 00             	movzbl (%rax),%eax
+     ba5:	0f b6 d0             	movzbl %al,%edx
+     ba8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bac:	0f b6 00             	movzbl (%rax),%eax
+     baf:	0f b6 c0             	movzbl %al,%eax
+     bb2:	29 c2                	sub    %eax,%edx
+     bb4:	89 d0                	mov    %edx,%eax
+}
+     bb6:	5d                   	pop    %rbp
+     bb7:	c3                   	ret
+
+0000000000000bb8 <strlen>:
+uint strlen(char *s) {
+     bb8:	55                   	push   %rbp
+     bb9:	48 89 e5             	mov    %rsp,%rbp
+     bbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     bc0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bc7:	eb 04                	jmp    bcd <strlen+0x15>
+     bc9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     bcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bd0:	48 63 d0             	movslq %eax,%rdx
+     bd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bd7:	48 01 d0             	add    %rdx,%rax
+     bda:	0f b6 00             	movzbl (%rax),%eax
+     bdd:	84 c0                	test   %al,%al
+     bdf:	75 e8                	jne    bc9 <strlen+0x11>
+    ;
+  return n;
+     be1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     be4:	5d                   	pop    %rbp
+     be5:	c3                   	ret
+
+0000000000000be6 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     be6:	55                   	push   %rbp
+     be7:	48 89 e5             	mov    %rsp,%rbp
+     bea:	53                   	push   %rbx
+     beb:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     bef:	8b 05 3f 24 00 00    	mov    0x243f(%rip),%eax        # 3034 <erms>
+     bf5:	85 c0                	test   %eax,%eax
+     bf7:	79 53                	jns    c4c <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     bf9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     bfd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     c03:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c08:	ba 00 00 00 00       	mov    $0x0,%edx
+     c0d:	48 89 c6             	mov    %rax,%rsi
+     c10:	bf 00 00 00 00       	mov    $0x0,%edi
+     c15:	e8 9e fe ff ff       	call   ab8 <cpuid>
+    ebx = 0;
+     c1a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     c21:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c24:	83 f8 06             	cmp    $0x6,%eax
+     c27:	76 14                	jbe    c3d <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     c29:	b8 07 00 00 00       	mov    $0x7,%eax
+     c2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c33:	0f a2                	cpuid
+     c35:	89 d9                	mov    %ebx,%ecx
+     c37:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     c3a:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     c3d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c40:	c1 e8 09             	shr    $0x9,%eax
+     c43:	83 e0 01             	and    $0x1,%eax
+     c46:	89 05 e8 23 00 00    	mov    %eax,0x23e8(%rip)        # 3034 <erms>
+  }
+  return erms;
+     c4c:	8b 05 e2 23 00 00    	mov    0x23e2(%rip),%eax        # 3034 <erms>
+}
+     c52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c56:	c9                   	leave
+     c57:	c3                   	ret
+
+0000000000000c58 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     c58:	55                   	push   %rbp
+     c59:	48 89 e5             	mov    %rsp,%rbp
+     c5c:	48 83 ec 10          	sub    $0x10,%rsp
+     c60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c64:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c67:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     c6a:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     c6e:	76 09                	jbe    c79 <memset+0x21>
+     c70:	e8 71 ff ff ff       	call   be6 <haserms>
+     c75:	85 c0                	test   %eax,%eax
+     c77:	74 16                	je     c8f <memset+0x37>
+    stosb(dst, c, n);
+     c79:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c7c:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     c7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c83:	89 ce                	mov    %ecx,%esi
+     c85:	48 89 c7             	mov    %rax,%rdi
+     c88:	e8 26 fd ff ff       	call   9b3 <stosb>
+     c8d:	eb 58                	jmp    ce7 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     c8f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c92:	c1 e8 03             	shr    $0x3,%eax
+     c95:	89 c6                	mov    %eax,%esi
+     c97:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c9a:	48 98                	cltq
+     c9c:	0f b6 c0             	movzbl %al,%eax
+     c9f:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     ca6:	01 01 01 
+     ca9:	48 0f af c2          	imul   %rdx,%rax
+     cad:	48 89 c1             	mov    %rax,%rcx
+     cb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb4:	48 89 f2             	mov    %rsi,%rdx
+     cb7:	48 89 ce             	mov    %rcx,%rsi
+     cba:	48 89 c7             	mov    %rax,%rdi
+     cbd:	e8 23 fd ff ff       	call   9e5 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     cc2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cc5:	83 e0 07             	and    $0x7,%eax
+     cc8:	89 c2                	mov    %eax,%edx
+     cca:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     ccd:	83 e0 f8             	and    $0xfffffff8,%eax
+     cd0:	48 89 c1             	mov    %rax,%rcx
+     cd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd7:	48 01 c1             	add    %rax,%rcx
+     cda:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cdd:	89 c6                	mov    %eax,%esi
+     cdf:	48 89 cf             	mov    %rcx,%rdi
+     ce2:	e8 cc fc ff ff       	call   9b3 <stosb>
+  }
+  return dst;
+     ce7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     ceb:	c9                   	leave
+     cec:	c3                   	ret
+
+0000000000000ced <strchr>:
+
+char *strchr(const char *s, char c) {
+     ced:	55                   	push   %rbp
+     cee:	48 89 e5             	mov    %rsp,%rbp
+     cf1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cf5:	89 f0                	mov    %esi,%eax
+     cf7:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     cfa:	eb 17                	jmp    d13 <strchr+0x26>
+    if (*s == c)
+     cfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d00:	0f b6 00             	movzbl (%rax),%eax
+     d03:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     d06:	75 06                	jne    d0e <strchr+0x21>
+      return (char *)s;
+     d08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d0c:	eb 15                	jmp    d23 <strchr+0x36>
+  for (; *s; s++)
+     d0e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d17:	0f b6 00             	movzbl (%rax),%eax
+     d1a:	84 c0                	test   %al,%al
+     d1c:	75 de                	jne    cfc <strchr+0xf>
+  return 0;
+     d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d23:	5d                   	pop    %rbp
+     d24:	c3                   	ret
+
+0000000000000d25 <gets>:
+
+char *gets(char *buf, int max) {
+     d25:	55                   	push   %rbp
+     d26:	48 89 e5             	mov    %rsp,%rbp
+     d29:	48 83 ec 20          	sub    $0x20,%rsp
+     d2d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d31:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     d34:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d3b:	eb 48                	jmp    d85 <gets+0x60>
+    cc = read(0, &c, 1);
+     d3d:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d41:	ba 01 00 00 00       	mov    $0x1,%edx
+     d46:	48 89 c6             	mov    %rax,%rsi
+     d49:	bf 00 00 00 00       	mov    $0x0,%edi
+     d4e:	e8 b8 05 00 00       	call   130b <read>
+     d53:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     d56:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d5a:	7e 36                	jle    d92 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d5f:	8d 50 01             	lea    0x1(%rax),%edx
+     d62:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d65:	48 63 d0             	movslq %eax,%rdx
+     d68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d6c:	48 01 c2             	add    %rax,%rdx
+     d6f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d73:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     d75:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d79:	3c 0a                	cmp    $0xa,%al
+     d7b:	74 16                	je     d93 <gets+0x6e>
+     d7d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d81:	3c 0d                	cmp    $0xd,%al
+     d83:	74 0e                	je     d93 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     d85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d88:	83 c0 01             	add    $0x1,%eax
+     d8b:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     d8e:	7f ad                	jg     d3d <gets+0x18>
+     d90:	eb 01                	jmp    d93 <gets+0x6e>
+      break;
+     d92:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     d93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d96:	48 63 d0             	movslq %eax,%rdx
+     d99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d9d:	48 01 d0             	add    %rdx,%rax
+     da0:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     da7:	c9                   	leave
+     da8:	c3                   	ret
+
+0000000000000da9 <stat>:
+
+int stat(char *n, struct stat *st) {
+     da9:	55                   	push   %rbp
+     daa:	48 89 e5             	mov    %rsp,%rbp
+     dad:	48 83 ec 10          	sub    $0x10,%rsp
+     db1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     db5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     db9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc1:	48 89 c6             	mov    %rax,%rsi
+     dc4:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     dc9:	e8 58 07 00 00       	call   1526 <fstatat>
+}
+     dce:	c9                   	leave
+     dcf:	c3                   	ret
+
+0000000000000dd0 <atoi>:
+
+int atoi(const char *s) {
+     dd0:	55                   	push   %rbp
+     dd1:	48 89 e5             	mov    %rsp,%rbp
+     dd4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     dd8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     ddf:	eb 28                	jmp    e09 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     de1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     de4:	89 d0                	mov    %edx,%eax
+     de6:	c1 e0 02             	shl    $0x2,%eax
+     de9:	01 d0                	add    %edx,%eax
+     deb:	01 c0                	add    %eax,%eax
+     ded:	89 c1                	mov    %eax,%ecx
+     def:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     df3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     df7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     dfb:	0f b6 00             	movzbl (%rax),%eax
+     dfe:	0f be c0             	movsbl %al,%eax
+     e01:	01 c8                	add    %ecx,%eax
+     e03:	83 e8 30             	sub    $0x30,%eax
+     e06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e0d:	0f b6 00             	movzbl (%rax),%eax
+     e10:	3c 2f                	cmp    $0x2f,%al
+     e12:	7e 0b                	jle    e1f <atoi+0x4f>
+     e14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e18:	0f b6 00             	movzbl (%rax),%eax
+     e1b:	3c 39                	cmp    $0x39,%al
+     e1d:	7e c2                	jle    de1 <atoi+0x11>
+  return n;
+     e1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e22:	5d                   	pop    %rbp
+     e23:	c3                   	ret
+
+0000000000000e24 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     e24:	55                   	push   %rbp
+     e25:	48 89 e5             	mov    %rsp,%rbp
+     e28:	48 83 ec 28          	sub    $0x28,%rsp
+     e2c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e30:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e34:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     e37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e3b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     e47:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e4b:	7f 09                	jg     e56 <memmove+0x32>
+    return vdst;
+     e4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e51:	e9 29 01 00 00       	jmp    f7f <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     e56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e5a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     e5e:	0f 83 87 00 00 00    	jae    eeb <memmove+0xc7>
+     e64:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e67:	48 63 d0             	movslq %eax,%rdx
+     e6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e6e:	48 01 d0             	add    %rdx,%rax
+     e71:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e75:	73 74                	jae    eeb <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     e77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e7a:	48 98                	cltq
+     e7c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     e80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e83:	48 98                	cltq
+     e85:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     e89:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e91:	48 09 d0             	or     %rdx,%rax
+     e94:	83 e0 07             	and    $0x7,%eax
+     e97:	48 85 c0             	test   %rax,%rax
+     e9a:	75 3d                	jne    ed9 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     e9c:	eb 1c                	jmp    eba <memmove+0x96>
+        src -= 8;
+     e9e:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     ea3:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     ea8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eac:	48 8b 10             	mov    (%rax),%rdx
+     eaf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb3:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     eb6:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     eba:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     ebe:	7f de                	jg     e9e <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     ec0:	eb 17                	jmp    ed9 <memmove+0xb5>
+      *--dst = *--src;
+     ec2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     ec7:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     ecc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ed0:	0f b6 10             	movzbl (%rax),%edx
+     ed3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed7:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     ed9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     edc:	8d 50 ff             	lea    -0x1(%rax),%edx
+     edf:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     ee2:	85 c0                	test   %eax,%eax
+     ee4:	7f dc                	jg     ec2 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     ee6:	e9 90 00 00 00       	jmp    f7b <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     eeb:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     eef:	7e 09                	jle    efa <memmove+0xd6>
+     ef1:	e8 f0 fc ff ff       	call   be6 <haserms>
+     ef6:	85 c0                	test   %eax,%eax
+     ef8:	74 1b                	je     f15 <memmove+0xf1>
+    movsb(dst, src, n);
+     efa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     efd:	48 63 d0             	movslq %eax,%rdx
+     f00:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f08:	48 89 ce             	mov    %rcx,%rsi
+     f0b:	48 89 c7             	mov    %rax,%rdi
+     f0e:	e8 0c fb ff ff       	call   a1f <movsb>
+     f13:	eb 66                	jmp    f7b <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     f15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f18:	8d 50 07             	lea    0x7(%rax),%edx
+     f1b:	85 c0                	test   %eax,%eax
+     f1d:	0f 48 c2             	cmovs  %edx,%eax
+     f20:	c1 f8 03             	sar    $0x3,%eax
+     f23:	48 63 d0             	movslq %eax,%rdx
+     f26:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f2e:	48 89 ce             	mov    %rcx,%rsi
+     f31:	48 89 c7             	mov    %rax,%rdi
+     f34:	e8 23 fb ff ff       	call   a5c <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     f39:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f3c:	89 d0                	mov    %edx,%eax
+     f3e:	c1 f8 1f             	sar    $0x1f,%eax
+     f41:	c1 e8 1d             	shr    $0x1d,%eax
+     f44:	01 c2                	add    %eax,%edx
+     f46:	83 e2 07             	and    $0x7,%edx
+     f49:	29 c2                	sub    %eax,%edx
+     f4b:	89 d0                	mov    %edx,%eax
+     f4d:	48 98                	cltq
+     f4f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f52:	83 e2 f8             	and    $0xfffffff8,%edx
+     f55:	48 63 ca             	movslq %edx,%rcx
+     f58:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f5c:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     f60:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f63:	83 e2 f8             	and    $0xfffffff8,%edx
+     f66:	48 63 ca             	movslq %edx,%rcx
+     f69:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     f6d:	48 01 d1             	add    %rdx,%rcx
+     f70:	48 89 c2             	mov    %rax,%rdx
+     f73:	48 89 cf             	mov    %rcx,%rdi
+     f76:	e8 a4 fa ff ff       	call   a1f <movsb>
+  }
+  return vdst;
+     f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     f7f:	c9                   	leave
+     f80:	c3                   	ret
+
+0000000000000f81 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+     f81:	55                   	push   %rbp
+     f82:	48 89 e5             	mov    %rsp,%rbp
+     f85:	48 83 ec 20          	sub    $0x20,%rsp
+     f89:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     f8c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+     f90:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+     f97:	00 00 00 
+     f9a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+     f9e:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     fa2:	75 0d                	jne    fb1 <clock_gettime+0x30>
+     fa4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fa8:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fac:	48 85 c0             	test   %rax,%rax
+     faf:	75 13                	jne    fc4 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+     fb1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     fb5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fb8:	48 89 d6             	mov    %rdx,%rsi
+     fbb:	89 c7                	mov    %eax,%edi
+     fbd:	e8 e0 04 00 00       	call   14a2 <_clock_gettime>
+     fc2:	eb 7d                	jmp    1041 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+     fc4:	e8 d1 fa ff ff       	call   a9a <rdtsc>
+     fc9:	48 89 c2             	mov    %rax,%rdx
+     fcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd0:	48 89 d6             	mov    %rdx,%rsi
+     fd3:	48 89 c7             	mov    %rax,%rdi
+     fd6:	e8 7b f9 ff ff       	call   956 <clockns>
+     fdb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+     fdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fe3:	48 c1 e8 09          	shr    $0x9,%rax
+     fe7:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+     fee:	b8 44 00 
+     ff1:	48 f7 e2             	mul    %rdx
+     ff4:	48 89 d0             	mov    %rdx,%rax
+     ff7:	48 c1 e8 0b          	shr    $0xb,%rax
+     ffb:	48 89 c2             	mov    %rax,%rdx
+     ffe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1002:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1005:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1009:	48 89 c8             	mov    %rcx,%rax
+    100c:	48 c1 e8 09          	shr    $0x9,%rax
+    1010:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1017:	b8 44 00 
+    101a:	48 f7 e2             	mul    %rdx
+    101d:	48 89 d0             	mov    %rdx,%rax
+    1020:	48 c1 e8 0b          	shr    $0xb,%rax
+    1024:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    102b:	48 89 c8             	mov    %rcx,%rax
+    102e:	48 29 d0             	sub    %rdx,%rax
+    1031:	48 89 c2             	mov    %rax,%rdx
+    1034:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1038:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    103c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1041:	c9                   	leave
+    1042:	c3                   	ret
+
+0000000000001043 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1043:	55                   	push   %rbp
+    1044:	48 89 e5             	mov    %rsp,%rbp
+    1047:	48 83 ec 10          	sub    $0x10,%rsp
+    104b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    104f:	eb 11                	jmp    1062 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1051:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1055:	be 02 00 00 00       	mov    $0x2,%esi
+    105a:	48 89 c7             	mov    %rax,%rdi
+    105d:	e8 6c 04 00 00       	call   14ce <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1062:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1066:	b8 02 00 00 00       	mov    $0x2,%eax
+    106b:	87 02                	xchg   %eax,(%rdx)
+    106d:	85 c0                	test   %eax,%eax
+    106f:	75 e0                	jne    1051 <mutex_wait+0xe>
+}
+    1071:	90                   	nop
+    1072:	90                   	nop
+    1073:	c9                   	leave
+    1074:	c3                   	ret
+
+0000000000001075 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1075:	55                   	push   %rbp
+    1076:	48 89 e5             	mov    %rsp,%rbp
+    1079:	48 83 ec 20          	sub    $0x20,%rsp
+    107d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1081:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1088:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    108c:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1090:	8b 02                	mov    (%rdx),%eax
+    1092:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1097:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    109b:	89 c1                	mov    %eax,%ecx
+    109d:	0f 94 c0             	sete   %al
+    10a0:	84 c0                	test   %al,%al
+    10a2:	75 02                	jne    10a6 <mutex_lock+0x31>
+    10a4:	89 0a                	mov    %ecx,(%rdx)
+    10a6:	83 f0 01             	xor    $0x1,%eax
+    10a9:	84 c0                	test   %al,%al
+    10ab:	74 0c                	je     10b9 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    10ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10b1:	48 89 c7             	mov    %rax,%rdi
+    10b4:	e8 8a ff ff ff       	call   1043 <mutex_wait>
+}
+    10b9:	90                   	nop
+    10ba:	c9                   	leave
+    10bb:	c3                   	ret
+
+00000000000010bc <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    10bc:	55                   	push   %rbp
+    10bd:	48 89 e5             	mov    %rsp,%rbp
+    10c0:	48 83 ec 10          	sub    $0x10,%rsp
+    10c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    10c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10cc:	ba 00 00 00 00       	mov    $0x0,%edx
+    10d1:	87 10                	xchg   %edx,(%rax)
+    10d3:	83 fa 02             	cmp    $0x2,%edx
+    10d6:	75 11                	jne    10e9 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    10d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10dc:	be 01 00 00 00       	mov    $0x1,%esi
+    10e1:	48 89 c7             	mov    %rax,%rdi
+    10e4:	e8 f0 03 00 00       	call   14d9 <futex_wake>
+}
+    10e9:	90                   	nop
+    10ea:	c9                   	leave
+    10eb:	c3                   	ret
+
+00000000000010ec <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    10ec:	55                   	push   %rbp
+    10ed:	48 89 e5             	mov    %rsp,%rbp
+    10f0:	48 83 ec 20          	sub    $0x20,%rsp
+    10f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    10f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    10fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1100:	48 83 c0 04          	add    $0x4,%rax
+    1104:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    110c:	8b 00                	mov    (%rax),%eax
+    110e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1111:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1115:	48 89 c7             	mov    %rax,%rdi
+    1118:	e8 9f ff ff ff       	call   10bc <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    111d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1121:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1124:	89 d6                	mov    %edx,%esi
+    1126:	48 89 c7             	mov    %rax,%rdi
+    1129:	e8 a0 03 00 00       	call   14ce <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    112e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1132:	48 83 c0 04          	add    $0x4,%rax
+    1136:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    113a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    113e:	48 89 c7             	mov    %rax,%rdi
+    1141:	e8 fd fe ff ff       	call   1043 <mutex_wait>
+}
+    1146:	90                   	nop
+    1147:	c9                   	leave
+    1148:	c3                   	ret
+
+0000000000001149 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1149:	55                   	push   %rbp
+    114a:	48 89 e5             	mov    %rsp,%rbp
+    114d:	48 83 ec 10          	sub    $0x10,%rsp
+    1151:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1155:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1159:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    115d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1161:	48 83 c0 04          	add    $0x4,%rax
+    1165:	8b 00                	mov    (%rax),%eax
+    1167:	85 c0                	test   %eax,%eax
+    1169:	7e 11                	jle    117c <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    116b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    116f:	be 01 00 00 00       	mov    $0x1,%esi
+    1174:	48 89 c7             	mov    %rax,%rdi
+    1177:	e8 5d 03 00 00       	call   14d9 <futex_wake>
+}
+    117c:	90                   	nop
+    117d:	c9                   	leave
+    117e:	c3                   	ret
+
+000000000000117f <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    117f:	55                   	push   %rbp
+    1180:	48 89 e5             	mov    %rsp,%rbp
+    1183:	48 83 ec 10          	sub    $0x10,%rsp
+    1187:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    118b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    118f:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1193:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1197:	48 83 c0 04          	add    $0x4,%rax
+    119b:	8b 00                	mov    (%rax),%eax
+    119d:	85 c0                	test   %eax,%eax
+    119f:	7e 11                	jle    11b2 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    11a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a5:	be 00 00 00 40       	mov    $0x40000000,%esi
+    11aa:	48 89 c7             	mov    %rax,%rdi
+    11ad:	e8 27 03 00 00       	call   14d9 <futex_wake>
+}
+    11b2:	90                   	nop
+    11b3:	c9                   	leave
+    11b4:	c3                   	ret
+
+00000000000011b5 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    11b5:	55                   	push   %rbp
+    11b6:	48 89 e5             	mov    %rsp,%rbp
+    11b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11bd:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    11c0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    11c4:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    11c8:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    11cc:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    11d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11d4:	8b 40 04             	mov    0x4(%rax),%eax
+    11d7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    11da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11de:	8b 00                	mov    (%rax),%eax
+    11e0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    11e3:	29 c2                	sub    %eax,%edx
+    11e5:	83 fa 1f             	cmp    $0x1f,%edx
+    11e8:	76 07                	jbe    11f1 <ring_push+0x3c>
+    return -1;
+    11ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11ef:	eb 7e                	jmp    126f <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    11f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11f4:	83 e0 1f             	and    $0x1f,%eax
+    11f7:	89 c2                	mov    %eax,%edx
+    11f9:	48 89 d0             	mov    %rdx,%rax
+    11fc:	48 01 c0             	add    %rax,%rax
+    11ff:	48 01 d0             	add    %rdx,%rax
+    1202:	48 c1 e0 04          	shl    $0x4,%rax
+    1206:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    120a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    120e:	48 01 d0             	add    %rdx,%rax
+    1211:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1215:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1219:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    121c:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    121e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1222:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1226:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    122a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    122e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1232:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1236:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    123a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    123e:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1242:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1246:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    124a:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    124e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1252:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1256:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    125a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    125d:	8d 50 01             	lea    0x1(%rax),%edx
+    1260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1264:	48 83 c0 04          	add    $0x4,%rax
+    1268:	89 10                	mov    %edx,(%rax)
+  return 0;
+    126a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    126f:	5d                   	pop    %rbp
+    1270:	c3                   	ret
+
+0000000000001271 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1271:	55                   	push   %rbp
+    1272:	48 89 e5             	mov    %rsp,%rbp
+    1275:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1279:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    127d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1281:	8b 40 08             	mov    0x8(%rax),%eax
+    1284:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1287:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    128b:	48 83 c0 0c          	add    $0xc,%rax
+    128f:	8b 00                	mov    (%rax),%eax
+    1291:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1294:	75 07                	jne    129d <ring_pop+0x2c>
+    return -1;
+    1296:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    129b:	eb 40                	jmp    12dd <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    129d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12a0:	83 e0 1f             	and    $0x1f,%eax
+    12a3:	89 c2                	mov    %eax,%edx
+    12a5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    12a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ad:	89 d2                	mov    %edx,%edx
+    12af:	48 83 c2 61          	add    $0x61,%rdx
+    12b3:	48 c1 e2 04          	shl    $0x4,%rdx
+    12b7:	48 01 d0             	add    %rdx,%rax
+    12ba:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    12be:	48 8b 00             	mov    (%rax),%rax
+    12c1:	48 89 01             	mov    %rax,(%rcx)
+    12c4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    12c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12cb:	8d 50 01             	lea    0x1(%rax),%edx
+    12ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12d2:	48 83 c0 08          	add    $0x8,%rax
+    12d6:	89 10                	mov    %edx,(%rax)
+  return 0;
+    12d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12dd:	5d                   	pop    %rbp
+    12de:	c3                   	ret
+
+00000000000012df <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    12df:	b8 01 00 00 00       	mov    $0x1,%eax
+    12e4:	49 89 ca             	mov    %rcx,%r10
+    12e7:	0f 05                	syscall
+    12e9:	c3                   	ret
+
+00000000000012ea <_exit>:
+SYSCALL_(exit)
+    12ea:	b8 02 00 00 00       	mov    $0x2,%eax
+    12ef:	49 89 ca             	mov    %rcx,%r10
+    12f2:	0f 05                	syscall
+    12f4:	c3                   	ret
+
+00000000000012f5 <wait>:
+SYSCALL(wait)
+    12f5:	b8 03 00 00 00       	mov    $0x3,%eax
+    12fa:	49 89 ca             	mov    %rcx,%r10
+    12fd:	0f 05                	syscall
+    12ff:	c3                   	ret
+
+0000000000001300 <pipe>:
+SYSCALL(pipe)
+    1300:	b8 04 00 00 00       	mov    $0x4,%eax
+    1305:	49 89 ca             	mov    %rcx,%r10
+    1308:	0f 05                	syscall
+    130a:	c3                   	ret
+
+000000000000130b <read>:
+SYSCALL(read)
+    130b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1310:	49 89 ca             	mov    %rcx,%r10
+    1313:	0f 05                	syscall
+    1315:	c3                   	ret
+
+0000000000001316 <write>:
+SYSCALL(write)
+    1316:	b8 10 00 00 00       	mov    $0x10,%eax
+    131b:	49 89 ca             	mov    %rcx,%r10
+    131e:	0f 05                	syscall
+    1320:	c3                   	ret
+
+0000000000001321 <_close>:
+SYSCALL_(close)
+    1321:	b8 15 00 00 00       	mov    $0x15,%eax
+    1326:	49 89 ca             	mov    %rcx,%r10
+    1329:	0f 05                	syscall
+    132b:	c3                   	ret
+
+000000000000132c <kill>:
+SYSCALL(kill)
+    132c:	b8 06 00 00 00       	mov    $0x6,%eax
+    1331:	49 89 ca             	mov    %rcx,%r10
+    1334:	0f 05                	syscall
+    1336:	c3                   	ret
+
+0000000000001337 <_exec>:
+SYSCALL_(exec)
+    1337:	b8 07 00 00 00       	mov    $0x7,%eax
+    133c:	49 89 ca             	mov    %rcx,%r10
+    133f:	0f 05                	syscall
+    1341:	c3                   	ret
+
+0000000000001342 <open>:
+SYSCALL(open)
+    1342:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1347:	49 89 ca             	mov    %rcx,%r10
+    134a:	0f 05                	syscall
+    134c:	c3                   	ret
+
+000000000000134d <mknod>:
+SYSCALL(mknod)
+    134d:	b8 11 00 00 00       	mov    $0x11,%eax
+    1352:	49 89 ca             	mov    %rcx,%r10
+    1355:	0f 05                	syscall
+    1357:	c3                   	ret
+
+0000000000001358 <unlink>:
+SYSCALL(unlink)
+    1358:	b8 12 00 00 00       	mov    $0x12,%eax
+    135d:	49 89 ca             	mov    %rcx,%r10
+    1360:	0f 05                	syscall
+    1362:	c3                   	ret
+
+0000000000001363 <fstat>:
+SYSCALL(fstat)
+    1363:	b8 08 00 00 00       	mov    $0x8,%eax
+    1368:	49 89 ca             	mov    %rcx,%r10
+    136b:	0f 05                	syscall
+    136d:	c3                   	ret
+
+000000000000136e <link>:
+SYSCALL(link)
+    136e:	b8 13 00 00 00       	mov    $0x13,%eax
+    1373:	49 89 ca             	mov    %rcx,%r10
+    1376:	0f 05                	syscall
+    1378:	c3                   	ret
+
+0000000000001379 <mkdir>:
+SYSCALL(mkdir)
+    1379:	b8 14 00 00 00       	mov    $0x14,%eax
+    137e:	49 89 ca             	mov    %rcx,%r10
+    1381:	0f 05                	syscall
+    1383:	c3                   	ret
+
+0000000000001384 <chdir>:
+SYSCALL(chdir)
+    1384:	b8 09 00 00 00       	mov    $0x9,%eax
+    1389:	49 89 ca             	mov    %rcx,%r10
+    138c:	0f 05                	syscall
+    138e:	c3                   	ret
+
+000000000000138f <dup>:
+SYSCALL(dup)
+    138f:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1394:	49 89 ca             	mov    %rcx,%r10
+    1397:	0f 05                	syscall
+    1399:	c3                   	ret
+
+000000000000139a <getpid>:
+SYSCALL(getpid)
+    139a:	b8 0b 00 00 00       	mov    $0xb,%eax
+    139f:	49 89 ca             	mov    %rcx,%r10
+    13a2:	0f 05                	syscall
+    13a4:	c3                   	ret
+
+00000000000013a5 <sbrk>:
+SYSCALL(sbrk)
+    13a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13aa:	49 89 ca             	mov    %rcx,%r10
+    13ad:	0f 05                	syscall
+    13af:	c3                   	ret
+
+00000000000013b0 <sleep>:
+SYSCALL(sleep)
+    13b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13b5:	49 89 ca             	mov    %rcx,%r10
+    13b8:	0f 05                	syscall
+    13ba:	c3                   	ret
+
+00000000000013bb <uptime>:
+SYSCALL(uptime)
+    13bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13c0:	49 89 ca             	mov    %rcx,%r10
+    13c3:	0f 05                	syscall
+    13c5:	c3                   	ret
+
+00000000000013c6 <sysinfo>:
+SYSCALL(sysinfo)
+    13c6:	b8 16 00 00 00       	mov    $0x16,%eax
+    13cb:	49 89 ca             	mov    %rcx,%r10
+    13ce:	0f 05                	syscall
+    13d0:	c3                   	ret
+
+00000000000013d1 <crashn>:
+SYSCALL(crashn)
+    13d1:	b8 17 00 00 00       	mov    $0x17,%eax
+    13d6:	49 89 ca             	mov    %rcx,%r10
+    13d9:	0f 05                	syscall
+    13db:	c3                   	ret
+
+00000000000013dc <mmap>:
+SYSCALL(mmap)
+    13dc:	b8 18 00 00 00       	mov    $0x18,%eax
+    13e1:	49 89 ca             	mov    %rcx,%r10
+    13e4:	0f 05                	syscall
+    13e6:	c3                   	ret
+
+00000000000013e7 <munmap>:
+SYSCALL(munmap)
+    13e7:	b8 19 00 00 00       	mov    $0x19,%eax
+    13ec:	49 89 ca             	mov    %rcx,%r10
+    13ef:	0f 05                	syscall
+    13f1:	c3                   	ret
+
+00000000000013f2 <nice>:
+SYSCALL(nice)
+    13f2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13f7:	49 89 ca             	mov    %rcx,%r10
+    13fa:	0f 05                	syscall
+    13fc:	c3                   	ret
+
+00000000000013fd <_spawn>:
+SYSCALL_(spawn)
+    13fd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1402:	49 89 ca             	mov    %rcx,%r10
+    1405:	0f 05                	syscall
+    1407:	c3                   	ret
+
+0000000000001408 <pread>:
+SYSCALL(pread)
+    1408:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    140d:	49 89 ca             	mov    %rcx,%r10
+    1410:	0f 05                	syscall
+    1412:	c3                   	ret
+
+0000000000001413 <pwrite>:
+SYSCALL(pwrite)
+    1413:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1418:	49 89 ca             	mov    %rcx,%r10
+    141b:	0f 05                	syscall
+    141d:	c3                   	ret
+
+000000000000141e <readv>:
+SYSCALL(readv)
+    141e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1423:	49 89 ca             	mov    %rcx,%r10
+    1426:	0f 05                	syscall
+    1428:	c3                   	ret
+
+0000000000001429 <writev>:
+SYSCALL(writev)
+    1429:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    142e:	49 89 ca             	mov    %rcx,%r10
+    1431:	0f 05                	syscall
+    1433:	c3                   	ret
+
+0000000000001434 <sendfile>:
+SYSCALL(sendfile)
+    1434:	b8 20 00 00 00       	mov    $0x20,%eax
+    1439:	49 89 ca             	mov    %rcx,%r10
+    143c:	0f 05                	syscall
+    143e:	c3                   	ret
+
+000000000000143f <splice>:
+SYSCALL(splice)
+    143f:	b8 21 00 00 00       	mov    $0x21,%eax
+    1444:	49 89 ca             	mov    %rcx,%r10
+    1447:	0f 05                	syscall
+    1449:	c3                   	ret
+
+000000000000144a <poll>:
+SYSCALL(poll)
+    144a:	b8 22 00 00 00       	mov    $0x22,%eax
+    144f:	49 89 ca             	mov    %rcx,%r10
+    1452:	0f 05                	syscall
+    1454:	c3                   	ret
+
+0000000000001455 <fsync>:
+SYSCALL(fsync)
+    1455:	b8 23 00 00 00       	mov    $0x23,%eax
+    145a:	49 89 ca             	mov    %rcx,%r10
+    145d:	0f 05                	syscall
+    145f:	c3                   	ret
+
+0000000000001460 <fdatasync>:
+SYSCALL(fdatasync)
+    1460:	b8 24 00 00 00       	mov    $0x24,%eax
+    1465:	49 89 ca             	mov    %rcx,%r10
+    1468:	0f 05                	syscall
+    146a:	c3                   	ret
+
+000000000000146b <lockstat>:
+SYSCALL(lockstat)
+    146b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1470:	49 89 ca             	mov    %rcx,%r10
+    1473:	0f 05                	syscall
+    1475:	c3                   	ret
+
+0000000000001476 <syscallstat>:
+SYSCALL(syscallstat)
+    1476:	b8 26 00 00 00       	mov    $0x26,%eax
+    147b:	49 89 ca             	mov    %rcx,%r10
+    147e:	0f 05                	syscall
+    1480:	c3                   	ret
+
+0000000000001481 <trace>:
+SYSCALL(trace)
+    1481:	b8 27 00 00 00       	mov    $0x27,%eax
+    1486:	49 89 ca             	mov    %rcx,%r10
+    1489:	0f 05                	syscall
+    148b:	c3                   	ret
+
+000000000000148c <profile>:
+SYSCALL(profile)
+    148c:	b8 28 00 00 00       	mov    $0x28,%eax
+    1491:	49 89 ca             	mov    %rcx,%r10
+    1494:	0f 05                	syscall
+    1496:	c3                   	ret
+
+0000000000001497 <cycles>:
+SYSCALL(cycles)
+    1497:	b8 29 00 00 00       	mov    $0x29,%eax
+    149c:	49 89 ca             	mov    %rcx,%r10
+    149f:	0f 05                	syscall
+    14a1:	c3                   	ret
+
+00000000000014a2 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    14a2:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14a7:	49 89 ca             	mov    %rcx,%r10
+    14aa:	0f 05                	syscall
+    14ac:	c3                   	ret
+
+00000000000014ad <consmode>:
+SYSCALL(consmode)
+    14ad:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    14b2:	49 89 ca             	mov    %rcx,%r10
+    14b5:	0f 05                	syscall
+    14b7:	c3                   	ret
+
+00000000000014b8 <clone>:
+SYSCALL(clone)
+    14b8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    14bd:	49 89 ca             	mov    %rcx,%r10
+    14c0:	0f 05                	syscall
+    14c2:	c3                   	ret
+
+00000000000014c3 <join>:
+SYSCALL(join)
+    14c3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    14c8:	49 89 ca             	mov    %rcx,%r10
+    14cb:	0f 05                	syscall
+    14cd:	c3                   	ret
+
+00000000000014ce <futex_wait>:
+SYSCALL(futex_wait)
+    14ce:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    14d3:	49 89 ca             	mov    %rcx,%r10
+    14d6:	0f 05                	syscall
+    14d8:	c3                   	ret
+
+00000000000014d9 <futex_wake>:
+SYSCALL(futex_wake)
+    14d9:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    14de:	49 89 ca             	mov    %rcx,%r10
+    14e1:	0f 05                	syscall
+    14e3:	c3                   	ret
+
+00000000000014e4 <shmget>:
+SYSCALL(shmget)
+    14e4:	b8 30 00 00 00       	mov    $0x30,%eax
+    14e9:	49 89 ca             	mov    %rcx,%r10
+    14ec:	0f 05                	syscall
+    14ee:	c3                   	ret
+
+00000000000014ef <shmat>:
+SYSCALL(shmat)
+    14ef:	b8 31 00 00 00       	mov    $0x31,%eax
+    14f4:	49 89 ca             	mov    %rcx,%r10
+    14f7:	0f 05                	syscall
+    14f9:	c3                   	ret
+
+00000000000014fa <shmdt>:
+SYSCALL(shmdt)
+    14fa:	b8 32 00 00 00       	mov    $0x32,%eax
+    14ff:	49 89 ca             	mov    %rcx,%r10
+    1502:	0f 05                	syscall
+    1504:	c3                   	ret
+
+0000000000001505 <ring_setup>:
+SYSCALL(ring_setup)
+    1505:	b8 33 00 00 00       	mov    $0x33,%eax
+    150a:	49 89 ca             	mov    %rcx,%r10
+    150d:	0f 05                	syscall
+    150f:	c3                   	ret
+
+0000000000001510 <ring_enter>:
+SYSCALL(ring_enter)
+    1510:	b8 34 00 00 00       	mov    $0x34,%eax
+    1515:	49 89 ca             	mov    %rcx,%r10
+    1518:	0f 05                	syscall
+    151a:	c3                   	ret
+
+000000000000151b <getdents>:
+SYSCALL(getdents)
+    151b:	b8 35 00 00 00       	mov    $0x35,%eax
+    1520:	49 89 ca             	mov    %rcx,%r10
+    1523:	0f 05                	syscall
+    1525:	c3                   	ret
+
+0000000000001526 <fstatat>:
+SYSCALL(fstatat)
+    1526:	b8 36 00 00 00       	mov    $0x36,%eax
+    152b:	49 89 ca             	mov    %rcx,%r10
+    152e:	0f 05                	syscall
+    1530:	c3                   	ret
+
+0000000000001531 <clone_file>:
+SYSCALL(clone_file)
+    1531:	b8 37 00 00 00       	mov    $0x37,%eax
+    1536:	49 89 ca             	mov    %rcx,%r10
+    1539:	0f 05                	syscall
+    153b:	c3                   	ret
+
+000000000000153c <fpunch>:
+SYSCALL(fpunch)
+    153c:	b8 38 00 00 00       	mov    $0x38,%eax
+    1541:	49 89 ca             	mov    %rcx,%r10
+    1544:	0f 05                	syscall
+    1546:	c3                   	ret
+
+0000000000001547 <defrag>:
+SYSCALL(defrag)
+    1547:	b8 39 00 00 00       	mov    $0x39,%eax
+    154c:	49 89 ca             	mov    %rcx,%r10
+    154f:	0f 05                	syscall
+    1551:	c3                   	ret
+
+0000000000001552 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1552:	55                   	push   %rbp
+    1553:	48 89 e5             	mov    %rsp,%rbp
+    1556:	48 83 ec 20          	sub    $0x20,%rsp
+    155a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    155e:	bf 00 00 00 00       	mov    $0x0,%edi
+    1563:	e8 3d fe ff ff       	call   13a5 <sbrk>
+    1568:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    156c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1570:	48 f7 d8             	neg    %rax
+    1573:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1578:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    157c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1580:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1584:	48 01 c2             	add    %rax,%rdx
+    1587:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    158c:	48 39 c2             	cmp    %rax,%rdx
+    158f:	73 1e                	jae    15af <morecore+0x5d>
+    1591:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1595:	89 c2                	mov    %eax,%edx
+    1597:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    159b:	01 d0                	add    %edx,%eax
+    159d:	89 c7                	mov    %eax,%edi
+    159f:	e8 01 fe ff ff       	call   13a5 <sbrk>
+    15a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15a8:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15ad:	75 07                	jne    15b6 <morecore+0x64>
+    return 0;
+    15af:	b8 00 00 00 00       	mov    $0x0,%eax
+    15b4:	eb 27                	jmp    15dd <morecore+0x8b>
+  stats.heap += n + pad;
+    15b6:	48 8b 05 b3 1b 00 00 	mov    0x1bb3(%rip),%rax        # 3170 <stats+0x50>
+    15bd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    15c1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    15c5:	48 01 ca             	add    %rcx,%rdx
+    15c8:	48 01 d0             	add    %rdx,%rax
+    15cb:	48 89 05 9e 1b 00 00 	mov    %rax,0x1b9e(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    15d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15da:	48 01 d0             	add    %rdx,%rax
+}
+    15dd:	c9                   	leave
+    15de:	c3                   	ret
+
+00000000000015df <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    15df:	55                   	push   %rbp
+    15e0:	48 89 e5             	mov    %rsp,%rbp
+    15e3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    15e7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    15eb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    15f2:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    15f3:	48 8d 05 06 1b 00 00 	lea    0x1b06(%rip),%rax        # 3100 <runs>
+    15fa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15fe:	eb 1a                	jmp    161a <pagefree+0x3b>
+    prev = *rp;
+    1600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1604:	48 8b 00             	mov    (%rax),%rax
+    1607:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    160b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160f:	48 8b 00             	mov    (%rax),%rax
+    1612:	48 83 c0 08          	add    $0x8,%rax
+    1616:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    161a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    161e:	48 8b 00             	mov    (%rax),%rax
+    1621:	48 85 c0             	test   %rax,%rax
+    1624:	74 0d                	je     1633 <pagefree+0x54>
+    1626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    162a:	48 8b 00             	mov    (%rax),%rax
+    162d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1631:	72 cd                	jb     1600 <pagefree+0x21>
+  r = (struct run *)p;
+    1633:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1637:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    163b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    163f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1643:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1646:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    164a:	48 8b 10             	mov    (%rax),%rdx
+    164d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1651:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1655:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1659:	48 8b 40 08          	mov    0x8(%rax),%rax
+    165d:	48 85 c0             	test   %rax,%rax
+    1660:	74 48                	je     16aa <pagefree+0xcb>
+    1662:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1666:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    166a:	48 01 c2             	add    %rax,%rdx
+    166d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1671:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1675:	48 39 c2             	cmp    %rax,%rdx
+    1678:	75 30                	jne    16aa <pagefree+0xcb>
+    r->size += r->next->size;
+    167a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    167e:	48 8b 10             	mov    (%rax),%rdx
+    1681:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1685:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1689:	48 8b 00             	mov    (%rax),%rax
+    168c:	48 01 c2             	add    %rax,%rdx
+    168f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1693:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1696:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    169a:	48 8b 40 08          	mov    0x8(%rax),%rax
+    169e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16a6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    16aa:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16af:	74 46                	je     16f7 <pagefree+0x118>
+    16b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16b5:	48 8b 10             	mov    (%rax),%rdx
+    16b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16bc:	48 01 d0             	add    %rdx,%rax
+    16bf:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    16c3:	75 32                	jne    16f7 <pagefree+0x118>
+    prev->size += r->size;
+    16c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c9:	48 8b 10             	mov    (%rax),%rdx
+    16cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d0:	48 8b 00             	mov    (%rax),%rax
+    16d3:	48 01 c2             	add    %rax,%rdx
+    16d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16da:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    16dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16e1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    16ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    16f5:	eb 0c                	jmp    1703 <pagefree+0x124>
+  } else {
+    *rp = r;
+    16f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16ff:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1702:	90                   	nop
+    1703:	90                   	nop
+    1704:	5d                   	pop    %rbp
+    1705:	c3                   	ret
+
+0000000000001706 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1706:	55                   	push   %rbp
+    1707:	48 89 e5             	mov    %rsp,%rbp
+    170a:	48 83 ec 40          	sub    $0x40,%rsp
+    170e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1712:	48 8d 05 e7 19 00 00 	lea    0x19e7(%rip),%rax        # 3100 <runs>
+    1719:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    171d:	eb 66                	jmp    1785 <pagealloc+0x7f>
+    if (r->size == n) {
+    171f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1723:	48 8b 00             	mov    (%rax),%rax
+    1726:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    172a:	75 18                	jne    1744 <pagealloc+0x3e>
+      *rp = r->next;
+    172c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1730:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1738:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    173b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173f:	e9 ca 00 00 00       	jmp    180e <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1748:	48 8b 00             	mov    (%rax),%rax
+    174b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    174f:	73 28                	jae    1779 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1751:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1755:	48 8b 00             	mov    (%rax),%rax
+    1758:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    175c:	48 89 c2             	mov    %rax,%rdx
+    175f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1763:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1766:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176a:	48 8b 10             	mov    (%rax),%rdx
+    176d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1771:	48 01 d0             	add    %rdx,%rax
+    1774:	e9 95 00 00 00       	jmp    180e <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1779:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    177d:	48 83 c0 08          	add    $0x8,%rax
+    1781:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1785:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1789:	48 8b 00             	mov    (%rax),%rax
+    178c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1790:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1795:	75 88                	jne    171f <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1797:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    179b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    179f:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    17a6:	00 
+    17a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17af:	48 39 c2             	cmp    %rax,%rdx
+    17b2:	48 0f 43 c2          	cmovae %rdx,%rax
+    17b6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    17ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17be:	48 89 c7             	mov    %rax,%rdi
+    17c1:	e8 8c fd ff ff       	call   1552 <morecore>
+    17c6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    17ca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    17cf:	75 07                	jne    17d8 <pagealloc+0xd2>
+    return 0;
+    17d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    17d6:	eb 36                	jmp    180e <pagealloc+0x108>
+  if (m > n)
+    17d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17dc:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    17e0:	73 1a                	jae    17fc <pagealloc+0xf6>
+    pagefree(p, m - n);
+    17e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17e6:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    17ea:	48 89 c2             	mov    %rax,%rdx
+    17ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17f1:	48 89 d6             	mov    %rdx,%rsi
+    17f4:	48 89 c7             	mov    %rax,%rdi
+    17f7:	e8 e3 fd ff ff       	call   15df <pagefree>
+  return p + m - n;
+    17fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1800:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1804:	48 89 c2             	mov    %rax,%rdx
+    1807:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    180b:	48 01 d0             	add    %rdx,%rax
+}
+    180e:	c9                   	leave
+    180f:	c3                   	ret
+
+0000000000001810 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1810:	55                   	push   %rbp
+    1811:	48 89 e5             	mov    %rsp,%rbp
+    1814:	48 83 ec 30          	sub    $0x30,%rsp
+    1818:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    181b:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1820:	e8 e1 fe ff ff       	call   1706 <pagealloc>
+    1825:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1829:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    182e:	75 0a                	jne    183a <refill+0x2a>
+    return -1;
+    1830:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1835:	e9 da 00 00 00       	jmp    1914 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    183a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1841:	00 
+    1842:	e9 ba 00 00 00       	jmp    1901 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1847:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    184b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    184f:	48 01 d0             	add    %rdx,%rax
+    1852:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1856:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1859:	ba 20 00 00 00       	mov    $0x20,%edx
+    185e:	89 c1                	mov    %eax,%ecx
+    1860:	48 d3 e2             	shl    %cl,%rdx
+    1863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1867:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    186a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    186d:	48 63 d0             	movslq %eax,%rdx
+    1870:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1874:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1878:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    187b:	48 98                	cltq
+    187d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1884:	00 
+    1885:	48 8d 05 34 18 00 00 	lea    0x1834(%rip),%rax        # 30c0 <freelist>
+    188c:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1894:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1898:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    189b:	48 98                	cltq
+    189d:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    18a4:	00 
+    18a5:	48 8d 15 14 18 00 00 	lea    0x1814(%rip),%rdx        # 30c0 <freelist>
+    18ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18b0:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    18b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18b7:	48 98                	cltq
+    18b9:	48 83 c0 08          	add    $0x8,%rax
+    18bd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18c4:	00 
+    18c5:	48 8d 05 58 18 00 00 	lea    0x1858(%rip),%rax        # 3124 <stats+0x4>
+    18cc:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    18cf:	8d 48 01             	lea    0x1(%rax),%ecx
+    18d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18d5:	48 98                	cltq
+    18d7:	48 83 c0 08          	add    $0x8,%rax
+    18db:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18e2:	00 
+    18e3:	48 8d 05 3a 18 00 00 	lea    0x183a(%rip),%rax        # 3124 <stats+0x4>
+    18ea:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    18ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18f0:	ba 20 00 00 00       	mov    $0x20,%edx
+    18f5:	89 c1                	mov    %eax,%ecx
+    18f7:	48 d3 e2             	shl    %cl,%rdx
+    18fa:	48 89 d0             	mov    %rdx,%rax
+    18fd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1901:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1908:	00 
+    1909:	0f 86 38 ff ff ff    	jbe    1847 <refill+0x37>
+  }
+  return 0;
+    190f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1914:	c9                   	leave
+    1915:	c3                   	ret
+
+0000000000001916 <malloc>:
+
+void *malloc(uint nbytes) {
+    1916:	55                   	push   %rbp
+    1917:	48 89 e5             	mov    %rsp,%rbp
+    191a:	48 83 ec 30          	sub    $0x30,%rsp
+    191e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1921:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1924:	48 83 c0 10          	add    $0x10,%rax
+    1928:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    192c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1933:	eb 04                	jmp    1939 <malloc+0x23>
+    1935:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1939:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    193d:	7f 16                	jg     1955 <malloc+0x3f>
+    193f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1942:	ba 20 00 00 00       	mov    $0x20,%edx
+    1947:	89 c1                	mov    %eax,%ecx
+    1949:	48 d3 e2             	shl    %cl,%rdx
+    194c:	48 89 d0             	mov    %rdx,%rax
+    194f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1953:	72 e0                	jb     1935 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1955:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1959:	75 7d                	jne    19d8 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    195b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195f:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1965:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    196b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    196f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1973:	48 89 c7             	mov    %rax,%rdi
+    1976:	e8 8b fd ff ff       	call   1706 <pagealloc>
+    197b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    197f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1984:	75 0a                	jne    1990 <malloc+0x7a>
+      return 0;
+    1986:	b8 00 00 00 00       	mov    $0x0,%eax
+    198b:	e9 2c 01 00 00       	jmp    1abc <malloc+0x1a6>
+    h->size = n;
+    1990:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1994:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1998:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    199b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    199f:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    19a6:	00 
+    stats.inuse[LARGE]++;
+    19a7:	8b 05 93 17 00 00    	mov    0x1793(%rip),%eax        # 3140 <stats+0x20>
+    19ad:	83 c0 01             	add    $0x1,%eax
+    19b0:	89 05 8a 17 00 00    	mov    %eax,0x178a(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    19b6:	48 8b 15 ab 17 00 00 	mov    0x17ab(%rip),%rdx        # 3168 <stats+0x48>
+    19bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19c1:	48 01 d0             	add    %rdx,%rax
+    19c4:	48 89 05 9d 17 00 00 	mov    %rax,0x179d(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    19cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19cf:	48 83 c0 10          	add    $0x10,%rax
+    19d3:	e9 e4 00 00 00       	jmp    1abc <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    19d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19db:	48 98                	cltq
+    19dd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    19e4:	00 
+    19e5:	48 8d 05 d4 16 00 00 	lea    0x16d4(%rip),%rax        # 30c0 <freelist>
+    19ec:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    19f0:	48 85 c0             	test   %rax,%rax
+    19f3:	75 18                	jne    1a0d <malloc+0xf7>
+    19f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19f8:	89 c7                	mov    %eax,%edi
+    19fa:	e8 11 fe ff ff       	call   1810 <refill>
+    19ff:	85 c0                	test   %eax,%eax
+    1a01:	79 0a                	jns    1a0d <malloc+0xf7>
+    return 0;
+    1a03:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a08:	e9 af 00 00 00       	jmp    1abc <malloc+0x1a6>
+  b = freelist[c];
+    1a0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a10:	48 98                	cltq
+    1a12:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a19:	00 
+    1a1a:	48 8d 05 9f 16 00 00 	lea    0x169f(%rip),%rax        # 30c0 <freelist>
+    1a21:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a25:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1a29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a2d:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1a31:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1a34:	48 63 d2             	movslq %edx,%rdx
+    1a37:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1a3e:	00 
+    1a3f:	48 8d 15 7a 16 00 00 	lea    0x167a(%rip),%rdx        # 30c0 <freelist>
+    1a46:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1a4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a4d:	48 98                	cltq
+    1a4f:	48 83 c0 08          	add    $0x8,%rax
+    1a53:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a5a:	00 
+    1a5b:	48 8d 05 c2 16 00 00 	lea    0x16c2(%rip),%rax        # 3124 <stats+0x4>
+    1a62:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a65:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1a68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a6b:	48 98                	cltq
+    1a6d:	48 83 c0 08          	add    $0x8,%rax
+    1a71:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a78:	00 
+    1a79:	48 8d 05 a4 16 00 00 	lea    0x16a4(%rip),%rax        # 3124 <stats+0x4>
+    1a80:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1a83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a86:	48 98                	cltq
+    1a88:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a8f:	00 
+    1a90:	48 8d 05 89 16 00 00 	lea    0x1689(%rip),%rax        # 3120 <stats>
+    1a97:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a9a:	8d 48 01             	lea    0x1(%rax),%ecx
+    1a9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aa0:	48 98                	cltq
+    1aa2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1aa9:	00 
+    1aaa:	48 8d 05 6f 16 00 00 	lea    0x166f(%rip),%rax        # 3120 <stats>
+    1ab1:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1ab4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ab8:	48 83 c0 10          	add    $0x10,%rax
+}
+    1abc:	c9                   	leave
+    1abd:	c3                   	ret
+
+0000000000001abe <free>:
+
+void free(void *ap) {
+    1abe:	55                   	push   %rbp
+    1abf:	48 89 e5             	mov    %rsp,%rbp
+    1ac2:	48 83 ec 18          	sub    $0x18,%rsp
+    1ac6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1aca:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1acf:	0f 84 03 01 00 00    	je     1bd8 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1ad5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ad9:	48 83 e8 10          	sub    $0x10,%rax
+    1add:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1ae1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ae5:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1ae9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1aed:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1af2:	75 42                	jne    1b36 <free+0x78>
+    stats.inuse[LARGE]--;
+    1af4:	8b 05 46 16 00 00    	mov    0x1646(%rip),%eax        # 3140 <stats+0x20>
+    1afa:	83 e8 01             	sub    $0x1,%eax
+    1afd:	89 05 3d 16 00 00    	mov    %eax,0x163d(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1b03:	48 8b 15 5e 16 00 00 	mov    0x165e(%rip),%rdx        # 3168 <stats+0x48>
+    1b0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b0e:	48 8b 00             	mov    (%rax),%rax
+    1b11:	48 29 c2             	sub    %rax,%rdx
+    1b14:	48 89 15 4d 16 00 00 	mov    %rdx,0x164d(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1b1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1f:	48 8b 10             	mov    (%rax),%rdx
+    1b22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b26:	48 89 d6             	mov    %rdx,%rsi
+    1b29:	48 89 c7             	mov    %rax,%rdi
+    1b2c:	e8 ae fa ff ff       	call   15df <pagefree>
+    return;
+    1b31:	e9 a3 00 00 00       	jmp    1bd9 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1b36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b3a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b41:	00 
+    1b42:	48 8d 05 77 15 00 00 	lea    0x1577(%rip),%rax        # 30c0 <freelist>
+    1b49:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b51:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1b55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b59:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b60:	00 
+    1b61:	48 8d 15 58 15 00 00 	lea    0x1558(%rip),%rdx        # 30c0 <freelist>
+    1b68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b6c:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1b70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b74:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b7b:	00 
+    1b7c:	48 8d 05 9d 15 00 00 	lea    0x159d(%rip),%rax        # 3120 <stats>
+    1b83:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b86:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1b89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b8d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b94:	00 
+    1b95:	48 8d 05 84 15 00 00 	lea    0x1584(%rip),%rax        # 3120 <stats>
+    1b9c:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1b9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ba3:	48 83 c0 08          	add    $0x8,%rax
+    1ba7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bae:	00 
+    1baf:	48 8d 05 6e 15 00 00 	lea    0x156e(%rip),%rax        # 3124 <stats+0x4>
+    1bb6:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bb9:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc0:	48 83 c0 08          	add    $0x8,%rax
+    1bc4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bcb:	00 
+    1bcc:	48 8d 05 51 15 00 00 	lea    0x1551(%rip),%rax        # 3124 <stats+0x4>
+    1bd3:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1bd6:	eb 01                	jmp    1bd9 <free+0x11b>
+    return;
+    1bd8:	90                   	nop
+}
+    1bd9:	c9                   	leave
+    1bda:	c3                   	ret
+
+0000000000001bdb <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1bdb:	55                   	push   %rbp
+    1bdc:	48 89 e5             	mov    %rsp,%rbp
+    1bdf:	48 83 ec 30          	sub    $0x30,%rsp
+    1be3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1be6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1be9:	48 8d 15 68 02 00 00 	lea    0x268(%rip),%rdx        # 1e58 <benchreport+0x155>
+    1bf0:	48 89 d6             	mov    %rdx,%rsi
+    1bf3:	89 c7                	mov    %eax,%edi
+    1bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bfa:	e8 37 e6 ff ff       	call   236 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1bff:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1c06:	eb 67                	jmp    1c6f <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1c08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c0b:	48 98                	cltq
+    1c0d:	48 83 c0 08          	add    $0x8,%rax
+    1c11:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c18:	00 
+    1c19:	48 8d 05 04 15 00 00 	lea    0x1504(%rip),%rax        # 3124 <stats+0x4>
+    1c20:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1c23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c26:	48 98                	cltq
+    1c28:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c2f:	00 
+    1c30:	48 8d 05 e9 14 00 00 	lea    0x14e9(%rip),%rax        # 3120 <stats>
+    1c37:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1c3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c3d:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c42:	89 c1                	mov    %eax,%ecx
+    1c44:	48 d3 e2             	shl    %cl,%rdx
+    1c47:	48 89 d0             	mov    %rdx,%rax
+    1c4a:	89 c1                	mov    %eax,%ecx
+    1c4c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c52:	41 89 f9             	mov    %edi,%r9d
+    1c55:	41 89 f0             	mov    %esi,%r8d
+    1c58:	48 8d 35 10 02 00 00 	lea    0x210(%rip),%rsi        # 1e6f <benchreport+0x16c>
+    1c5f:	89 c7                	mov    %eax,%edi
+    1c61:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c66:	e8 cb e5 ff ff       	call   236 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c6b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1c6f:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1c73:	7e 93                	jle    1c08 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1c75:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1c7c:	00 
+  for (r = runs; r; r = r->next)
+    1c7d:	48 8b 05 7c 14 00 00 	mov    0x147c(%rip),%rax        # 3100 <runs>
+    1c84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c88:	eb 17                	jmp    1ca1 <mallocstats+0xc6>
+    nfree += r->size;
+    1c8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c8e:	48 8b 00             	mov    (%rax),%rax
+    1c91:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1c95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c99:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1c9d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ca1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1ca6:	75 e2                	jne    1c8a <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1ca8:	48 8b 05 c1 14 00 00 	mov    0x14c1(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1caf:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb5:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cb9:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cbb:	48 8b 05 a6 14 00 00 	mov    0x14a6(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cc2:	89 c1                	mov    %eax,%ecx
+    1cc4:	8b 15 76 14 00 00    	mov    0x1476(%rip),%edx        # 3140 <stats+0x20>
+    1cca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ccd:	41 89 f9             	mov    %edi,%r9d
+    1cd0:	41 89 f0             	mov    %esi,%r8d
+    1cd3:	48 8d 35 a6 01 00 00 	lea    0x1a6(%rip),%rsi        # 1e80 <benchreport+0x17d>
+    1cda:	89 c7                	mov    %eax,%edi
+    1cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ce1:	e8 50 e5 ff ff       	call   236 <printf>
+}
+    1ce6:	90                   	nop
+    1ce7:	c9                   	leave
+    1ce8:	c3                   	ret
+
+0000000000001ce9 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1ce9:	55                   	push   %rbp
+    1cea:	48 89 e5             	mov    %rsp,%rbp
+    1ced:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1cf1:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1cf5:	48 89 c7             	mov    %rax,%rdi
+    1cf8:	e8 9a f7 ff ff       	call   1497 <cycles>
+  return t;
+    1cfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d01:	c9                   	leave
+    1d02:	c3                   	ret
+
+0000000000001d03 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1d03:	55                   	push   %rbp
+    1d04:	48 89 e5             	mov    %rsp,%rbp
+    1d07:	48 83 ec 30          	sub    $0x30,%rsp
+    1d0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d0f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d13:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1d16:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1d1a:	0f 8e 24 01 00 00    	jle    1e44 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1d20:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1d27:	e9 98 00 00 00       	jmp    1dc4 <benchreport+0xc1>
+    x = t[i];
+    1d2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d2f:	48 98                	cltq
+    1d31:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d38:	00 
+    1d39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d3d:	48 01 d0             	add    %rdx,%rax
+    1d40:	48 8b 00             	mov    (%rax),%rax
+    1d43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d4a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1d4d:	eb 33                	jmp    1d82 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1d4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d52:	48 98                	cltq
+    1d54:	48 c1 e0 03          	shl    $0x3,%rax
+    1d58:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d60:	48 01 d0             	add    %rdx,%rax
+    1d63:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1d66:	48 63 d2             	movslq %edx,%rdx
+    1d69:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d70:	00 
+    1d71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d75:	48 01 ca             	add    %rcx,%rdx
+    1d78:	48 8b 00             	mov    (%rax),%rax
+    1d7b:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d7e:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1d82:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1d86:	7e 1d                	jle    1da5 <benchreport+0xa2>
+    1d88:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d8b:	48 98                	cltq
+    1d8d:	48 c1 e0 03          	shl    $0x3,%rax
+    1d91:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d99:	48 01 d0             	add    %rdx,%rax
+    1d9c:	48 8b 00             	mov    (%rax),%rax
+    1d9f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1da3:	72 aa                	jb     1d4f <benchreport+0x4c>
+    t[j] = x;
+    1da5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1da8:	48 98                	cltq
+    1daa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1db1:	00 
+    1db2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1db6:	48 01 c2             	add    %rax,%rdx
+    1db9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dbd:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1dc0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1dc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dc7:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1dca:	0f 8c 5c ff ff ff    	jl     1d2c <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1dd0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dd3:	48 98                	cltq
+    1dd5:	48 c1 e0 03          	shl    $0x3,%rax
+    1dd9:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ddd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1de1:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1de4:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1de7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dea:	89 c2                	mov    %eax,%edx
+    1dec:	c1 ea 1f             	shr    $0x1f,%edx
+    1def:	01 d0                	add    %edx,%eax
+    1df1:	d1 f8                	sar    %eax
+    1df3:	48 98                	cltq
+    1df5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1dfc:	00 
+    1dfd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e01:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e04:	48 8b 38             	mov    (%rax),%rdi
+    1e07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e0b:	48 8b 30             	mov    (%rax),%rsi
+    1e0e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e15:	48 83 ec 08          	sub    $0x8,%rsp
+    1e19:	51                   	push   %rcx
+    1e1a:	49 89 f9             	mov    %rdi,%r9
+    1e1d:	49 89 f0             	mov    %rsi,%r8
+    1e20:	89 d1                	mov    %edx,%ecx
+    1e22:	48 89 c2             	mov    %rax,%rdx
+    1e25:	48 8d 05 94 00 00 00 	lea    0x94(%rip),%rax        # 1ec0 <benchreport+0x1bd>
+    1e2c:	48 89 c6             	mov    %rax,%rsi
+    1e2f:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e34:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e39:	e8 f8 e3 ff ff       	call   236 <printf>
+    1e3e:	48 83 c4 10          	add    $0x10,%rsp
+    1e42:	eb 01                	jmp    1e45 <benchreport+0x142>
+    return;
+    1e44:	90                   	nop
+}
+    1e45:	c9                   	leave
+    1e46:	c3                   	ret
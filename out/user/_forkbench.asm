@@ -0,0 +1,3488 @@
+
+out/user/_forkbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <forkwait>:
+// again with BIGHEAP bytes of heap touched, whose pages fork() shares
+// copy-on-write.
+
+#define BIGHEAP (1024 * 1024)
+
+static void forkwait(char *name, uint64_t *t, int n) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	53                   	push   %rbx
+       5:	48 83 ec 38          	sub    $0x38,%rsp
+       9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+       d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+      11:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int i, pid;
+
+  for (i = 0; i < n; i++) {
+      14:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+      1b:	e9 97 00 00 00       	jmp    b7 <forkwait+0xb7>
+    t[i] = now();
+      20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      23:	48 98                	cltq
+      25:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      2c:	00 
+      2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+      31:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+      35:	e8 07 1e 00 00       	call   1e41 <now>
+      3a:	48 89 03             	mov    %rax,(%rbx)
+    if ((pid = fork()) == 0)
+      3d:	e8 6c 09 00 00       	call   9ae <fork>
+      42:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      45:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      49:	75 05                	jne    50 <forkwait+0x50>
+      exit();
+      4b:	e8 6e 09 00 00       	call   9be <exit>
+    if (pid < 0) {
+      50:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      54:	79 1e                	jns    74 <forkwait+0x74>
+      printf(2, "forkbench: fork failed\n");
+      56:	48 8d 05 43 1f 00 00 	lea    0x1f43(%rip),%rax        # 1fa0 <benchreport+0x145>
+      5d:	48 89 c6             	mov    %rax,%rsi
+      60:	bf 02 00 00 00       	mov    $0x2,%edi
+      65:	b8 00 00 00 00       	mov    $0x0,%eax
+      6a:	e8 1f 03 00 00       	call   38e <printf>
+      exit();
+      6f:	e8 4a 09 00 00       	call   9be <exit>
+    }
+    wait();
+      74:	e8 d4 13 00 00       	call   144d <wait>
+    t[i] = now() - t[i];
+      79:	e8 c3 1d 00 00       	call   1e41 <now>
+      7e:	48 89 c2             	mov    %rax,%rdx
+      81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      84:	48 98                	cltq
+      86:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+      8d:	00 
+      8e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+      92:	48 01 c8             	add    %rcx,%rax
+      95:	48 8b 00             	mov    (%rax),%rax
+      98:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+      9b:	48 63 c9             	movslq %ecx,%rcx
+      9e:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+      a5:	00 
+      a6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+      aa:	48 01 f1             	add    %rsi,%rcx
+      ad:	48 29 c2             	sub    %rax,%rdx
+      b0:	48 89 11             	mov    %rdx,(%rcx)
+  for (i = 0; i < n; i++) {
+      b3:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+      b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      ba:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+      bd:	0f 8c 5d ff ff ff    	jl     20 <forkwait+0x20>
+  }
+  benchreport(name, t, n);
+      c3:	8b 55 cc             	mov    -0x34(%rbp),%edx
+      c6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+      ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      ce:	48 89 ce             	mov    %rcx,%rsi
+      d1:	48 89 c7             	mov    %rax,%rdi
+      d4:	e8 82 1d 00 00       	call   1e5b <benchreport>
+}
+      d9:	90                   	nop
+      da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+      de:	c9                   	leave
+      df:	c3                   	ret
+
+00000000000000e0 <main>:
+
+int main(int argc, char *argv[]) {
+      e0:	55                   	push   %rbp
+      e1:	48 89 e5             	mov    %rsp,%rbp
+      e4:	48 83 ec 30          	sub    $0x30,%rsp
+      e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+      eb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t *t;
+  char *heap;
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 100;
+      ef:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+      f3:	7e 15                	jle    10a <main+0x2a>
+      f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+      f9:	48 83 c0 08          	add    $0x8,%rax
+      fd:	48 8b 00             	mov    (%rax),%rax
+     100:	48 89 c7             	mov    %rax,%rdi
+     103:	e8 20 0e 00 00       	call   f28 <atoi>
+     108:	eb 05                	jmp    10f <main+0x2f>
+     10a:	b8 64 00 00 00       	mov    $0x64,%eax
+     10f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (n <= 0 || (t = malloc(n * sizeof(*t))) == 0) {
+     112:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     116:	7e 1a                	jle    132 <main+0x52>
+     118:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     11b:	48 98                	cltq
+     11d:	c1 e0 03             	shl    $0x3,%eax
+     120:	89 c7                	mov    %eax,%edi
+     122:	e8 47 19 00 00       	call   1a6e <malloc>
+     127:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     12b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     130:	75 1e                	jne    150 <main+0x70>
+    printf(2, "usage: forkbench [n]\n");
+     132:	48 8d 05 7f 1e 00 00 	lea    0x1e7f(%rip),%rax        # 1fb8 <benchreport+0x15d>
+     139:	48 89 c6             	mov    %rax,%rsi
+     13c:	bf 02 00 00 00       	mov    $0x2,%edi
+     141:	b8 00 00 00 00       	mov    $0x0,%eax
+     146:	e8 43 02 00 00       	call   38e <printf>
+    exit();
+     14b:	e8 6e 08 00 00       	call   9be <exit>
+  }
+  forkwait("fork+wait", t, n);
+     150:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     153:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     157:	48 89 c6             	mov    %rax,%rsi
+     15a:	48 8d 05 6d 1e 00 00 	lea    0x1e6d(%rip),%rax        # 1fce <benchreport+0x173>
+     161:	48 89 c7             	mov    %rax,%rdi
+     164:	e8 97 fe ff ff       	call   0 <forkwait>
+
+  if ((heap = sbrk(BIGHEAP)) == (char *)-1) {
+     169:	bf 00 00 10 00       	mov    $0x100000,%edi
+     16e:	e8 8a 13 00 00       	call   14fd <sbrk>
+     173:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+     177:	48 83 7d e8 ff       	cmpq   $0xffffffffffffffff,-0x18(%rbp)
+     17c:	75 1e                	jne    19c <main+0xbc>
+    printf(2, "forkbench: sbrk failed\n");
+     17e:	48 8d 05 53 1e 00 00 	lea    0x1e53(%rip),%rax        # 1fd8 <benchreport+0x17d>
+     185:	48 89 c6             	mov    %rax,%rsi
+     188:	bf 02 00 00 00       	mov    $0x2,%edi
+     18d:	b8 00 00 00 00       	mov    $0x0,%eax
+     192:	e8 f7 01 00 00       	call   38e <printf>
+    exit();
+     197:	e8 22 08 00 00       	call   9be <exit>
+  }
+  memset(heap, 1, BIGHEAP);
+     19c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1a0:	ba 00 00 10 00       	mov    $0x100000,%edx
+     1a5:	be 01 00 00 00       	mov    $0x1,%esi
+     1aa:	48 89 c7             	mov    %rax,%rdi
+     1ad:	e8 fe 0b 00 00       	call   db0 <memset>
+  forkwait("fork+wait 1M heap", t, n);
+     1b2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     1b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1b9:	48 89 c6             	mov    %rax,%rsi
+     1bc:	48 8d 05 2d 1e 00 00 	lea    0x1e2d(%rip),%rax        # 1ff0 <benchreport+0x195>
+     1c3:	48 89 c7             	mov    %rax,%rdi
+     1c6:	e8 35 fe ff ff       	call   0 <forkwait>
+  exit();
+     1cb:	e8 ee 07 00 00       	call   9be <exit>
+
+00000000000001d0 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     1d0:	55                   	push   %rbp
+     1d1:	48 89 e5             	mov    %rsp,%rbp
+     1d4:	48 83 ec 10          	sub    $0x10,%rsp
+     1d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     1db:	89 f0                	mov    %esi,%eax
+     1dd:	88 45 f8             	mov    %al,-0x8(%rbp)
+     1e0:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     1e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e7:	89 d6                	mov    %edx,%esi
+     1e9:	89 c7                	mov    %eax,%edi
+     1eb:	e8 eb 06 00 00       	call   8db <bputc>
+     1f0:	90                   	nop
+     1f1:	c9                   	leave
+     1f2:	c3                   	ret
+
+00000000000001f3 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     1f3:	55                   	push   %rbp
+     1f4:	48 89 e5             	mov    %rsp,%rbp
+     1f7:	48 83 ec 50          	sub    $0x50,%rsp
+     1fb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     1fe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     202:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     205:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     208:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     20c:	74 21                	je     22f <printint64+0x3c>
+     20e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     212:	48 c1 e8 3f          	shr    $0x3f,%rax
+     216:	0f b6 c0             	movzbl %al,%eax
+     219:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     21c:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     220:	74 0d                	je     22f <printint64+0x3c>
+    x = -xx;
+     222:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     226:	48 f7 d8             	neg    %rax
+     229:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     22d:	eb 08                	jmp    237 <printint64+0x44>
+  else
+    x = xx;
+     22f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     233:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     237:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     23e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     241:	48 63 c8             	movslq %eax,%rcx
+     244:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     248:	ba 00 00 00 00       	mov    $0x0,%edx
+     24d:	48 f7 f1             	div    %rcx
+     250:	48 89 d1             	mov    %rdx,%rcx
+     253:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     256:	8d 50 01             	lea    0x1(%rax),%edx
+     259:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     25c:	48 8d 15 9d 2d 00 00 	lea    0x2d9d(%rip),%rdx        # 3000 <digits.1>
+     263:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     267:	48 98                	cltq
+     269:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     26d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     270:	48 63 f0             	movslq %eax,%rsi
+     273:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     277:	ba 00 00 00 00       	mov    $0x0,%edx
+     27c:	48 f7 f6             	div    %rsi
+     27f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     283:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     288:	75 b4                	jne    23e <printint64+0x4b>
+
+  if (sgn)
+     28a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     28e:	74 2b                	je     2bb <printint64+0xc8>
+    buf[i++] = '-';
+     290:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     293:	8d 50 01             	lea    0x1(%rax),%edx
+     296:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     299:	48 98                	cltq
+     29b:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     2a0:	eb 19                	jmp    2bb <printint64+0xc8>
+    putc(fd, buf[i]);
+     2a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2a5:	48 98                	cltq
+     2a7:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     2ac:	0f be d0             	movsbl %al,%edx
+     2af:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     2b2:	89 d6                	mov    %edx,%esi
+     2b4:	89 c7                	mov    %eax,%edi
+     2b6:	e8 15 ff ff ff       	call   1d0 <putc>
+  while (--i >= 0)
+     2bb:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     2bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2c3:	79 dd                	jns    2a2 <printint64+0xaf>
+}
+     2c5:	90                   	nop
+     2c6:	90                   	nop
+     2c7:	c9                   	leave
+     2c8:	c3                   	ret
+
+00000000000002c9 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     2c9:	55                   	push   %rbp
+     2ca:	48 89 e5             	mov    %rsp,%rbp
+     2cd:	48 83 ec 30          	sub    $0x30,%rsp
+     2d1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     2d4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     2d7:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     2da:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     2dd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     2e4:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     2e8:	74 17                	je     301 <printint+0x38>
+     2ea:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     2ee:	79 11                	jns    301 <printint+0x38>
+    neg = 1;
+     2f0:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     2f7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2fa:	f7 d8                	neg    %eax
+     2fc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     2ff:	eb 06                	jmp    307 <printint+0x3e>
+  } else {
+    x = xx;
+     301:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     304:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     307:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     30e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     311:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     314:	ba 00 00 00 00       	mov    $0x0,%edx
+     319:	f7 f1                	div    %ecx
+     31b:	89 d1                	mov    %edx,%ecx
+     31d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     320:	8d 50 01             	lea    0x1(%rax),%edx
+     323:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     326:	89 c9                	mov    %ecx,%ecx
+     328:	48 8d 15 f1 2c 00 00 	lea    0x2cf1(%rip),%rdx        # 3020 <digits.0>
+     32f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     333:	48 98                	cltq
+     335:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     339:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     33c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     33f:	ba 00 00 00 00       	mov    $0x0,%edx
+     344:	f7 f6                	div    %esi
+     346:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     349:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     34d:	75 bf                	jne    30e <printint+0x45>
+  if (neg)
+     34f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     353:	74 2b                	je     380 <printint+0xb7>
+    buf[i++] = '-';
+     355:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     358:	8d 50 01             	lea    0x1(%rax),%edx
+     35b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     35e:	48 98                	cltq
+     360:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     365:	eb 19                	jmp    380 <printint+0xb7>
+    putc(fd, buf[i]);
+     367:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     36a:	48 98                	cltq
+     36c:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     371:	0f be d0             	movsbl %al,%edx
+     374:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     377:	89 d6                	mov    %edx,%esi
+     379:	89 c7                	mov    %eax,%edi
+     37b:	e8 50 fe ff ff       	call   1d0 <putc>
+  while (--i >= 0)
+     380:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     384:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     388:	79 dd                	jns    367 <printint+0x9e>
+}
+     38a:	90                   	nop
+     38b:	90                   	nop
+     38c:	c9                   	leave
+     38d:	c3                   	ret
+
+000000000000038e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     38e:	55                   	push   %rbp
+     38f:	48 89 e5             	mov    %rsp,%rbp
+     392:	48 83 ec 70          	sub    $0x70,%rsp
+     396:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     399:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     39d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     3a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     3a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     3a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     3ad:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     3b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     3b8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     3bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     3c0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     3c4:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     3cb:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     3d2:	e9 67 02 00 00       	jmp    63e <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     3d7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     3da:	48 63 d0             	movslq %eax,%rdx
+     3dd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     3e1:	48 01 d0             	add    %rdx,%rax
+     3e4:	0f b6 00             	movzbl (%rax),%eax
+     3e7:	0f be c0             	movsbl %al,%eax
+     3ea:	25 ff 00 00 00       	and    $0xff,%eax
+     3ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     3f2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     3f6:	75 30                	jne    428 <printf+0x9a>
+      if (c == '%') {
+     3f8:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     3fc:	75 13                	jne    411 <printf+0x83>
+        state = '%';
+     3fe:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     405:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     40c:	e9 29 02 00 00       	jmp    63a <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     411:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     414:	0f be d0             	movsbl %al,%edx
+     417:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     41a:	89 d6                	mov    %edx,%esi
+     41c:	89 c7                	mov    %eax,%edi
+     41e:	e8 ad fd ff ff       	call   1d0 <putc>
+     423:	e9 12 02 00 00       	jmp    63a <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     428:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     42c:	0f 85 08 02 00 00    	jne    63a <printf+0x2ac>
+      if (c == 'l') {
+     432:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     436:	75 0c                	jne    444 <printf+0xb6>
+        lflag = 1;
+     438:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     43f:	e9 f6 01 00 00       	jmp    63a <printf+0x2ac>
+      } else if (c == 'd') {
+     444:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     448:	0f 85 93 00 00 00    	jne    4e1 <printf+0x153>
+        if (lflag == 1)
+     44e:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     452:	75 47                	jne    49b <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     454:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     457:	83 f8 2f             	cmp    $0x2f,%eax
+     45a:	77 17                	ja     473 <printf+0xe5>
+     45c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     460:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     463:	89 d2                	mov    %edx,%edx
+     465:	48 01 d0             	add    %rdx,%rax
+     468:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     46b:	83 c2 08             	add    $0x8,%edx
+     46e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     471:	eb 0c                	jmp    47f <printf+0xf1>
+     473:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     477:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     47b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     47f:	48 8b 30             	mov    (%rax),%rsi
+     482:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     485:	b9 01 00 00 00       	mov    $0x1,%ecx
+     48a:	ba 0a 00 00 00       	mov    $0xa,%edx
+     48f:	89 c7                	mov    %eax,%edi
+     491:	e8 5d fd ff ff       	call   1f3 <printint64>
+     496:	e9 98 01 00 00       	jmp    633 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     49b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     49e:	83 f8 2f             	cmp    $0x2f,%eax
+     4a1:	77 17                	ja     4ba <printf+0x12c>
+     4a3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4a7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4aa:	89 d2                	mov    %edx,%edx
+     4ac:	48 01 d0             	add    %rdx,%rax
+     4af:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4b2:	83 c2 08             	add    $0x8,%edx
+     4b5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4b8:	eb 0c                	jmp    4c6 <printf+0x138>
+     4ba:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4be:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4c2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4c6:	8b 30                	mov    (%rax),%esi
+     4c8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4cb:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4d0:	ba 0a 00 00 00       	mov    $0xa,%edx
+     4d5:	89 c7                	mov    %eax,%edi
+     4d7:	e8 ed fd ff ff       	call   2c9 <printint>
+     4dc:	e9 52 01 00 00       	jmp    633 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     4e1:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     4e5:	74 0a                	je     4f1 <printf+0x163>
+     4e7:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     4eb:	0f 85 93 00 00 00    	jne    584 <printf+0x1f6>
+        if (lflag == 1)
+     4f1:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     4f5:	75 47                	jne    53e <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     4f7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4fa:	83 f8 2f             	cmp    $0x2f,%eax
+     4fd:	77 17                	ja     516 <printf+0x188>
+     4ff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     503:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     506:	89 d2                	mov    %edx,%edx
+     508:	48 01 d0             	add    %rdx,%rax
+     50b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     50e:	83 c2 08             	add    $0x8,%edx
+     511:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     514:	eb 0c                	jmp    522 <printf+0x194>
+     516:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     51a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     51e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     522:	48 8b 30             	mov    (%rax),%rsi
+     525:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     528:	b9 00 00 00 00       	mov    $0x0,%ecx
+     52d:	ba 10 00 00 00       	mov    $0x10,%edx
+     532:	89 c7                	mov    %eax,%edi
+     534:	e8 ba fc ff ff       	call   1f3 <printint64>
+        if (lflag == 1)
+     539:	e9 f5 00 00 00       	jmp    633 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     53e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     541:	83 f8 2f             	cmp    $0x2f,%eax
+     544:	77 17                	ja     55d <printf+0x1cf>
+     546:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     54a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     54d:	89 d2                	mov    %edx,%edx
+     54f:	48 01 d0             	add    %rdx,%rax
+     552:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     555:	83 c2 08             	add    $0x8,%edx
+     558:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     55b:	eb 0c                	jmp    569 <printf+0x1db>
+     55d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     561:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     565:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     569:	8b 30                	mov    (%rax),%esi
+     56b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     56e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     573:	ba 10 00 00 00       	mov    $0x10,%edx
+     578:	89 c7                	mov    %eax,%edi
+     57a:	e8 4a fd ff ff       	call   2c9 <printint>
+        if (lflag == 1)
+     57f:	e9 af 00 00 00       	jmp    633 <printf+0x2a5>
+      } else if (c == 's') {
+     584:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     588:	75 6e                	jne    5f8 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     58a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     58d:	83 f8 2f             	cmp    $0x2f,%eax
+     590:	77 17                	ja     5a9 <printf+0x21b>
+     592:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     596:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     599:	89 d2                	mov    %edx,%edx
+     59b:	48 01 d0             	add    %rdx,%rax
+     59e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5a1:	83 c2 08             	add    $0x8,%edx
+     5a4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     5a7:	eb 0c                	jmp    5b5 <printf+0x227>
+     5a9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     5ad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     5b1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     5b5:	48 8b 00             	mov    (%rax),%rax
+     5b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     5bc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     5c1:	75 28                	jne    5eb <printf+0x25d>
+          s = "(null)";
+     5c3:	48 8d 05 38 1a 00 00 	lea    0x1a38(%rip),%rax        # 2002 <benchreport+0x1a7>
+     5ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     5ce:	eb 1b                	jmp    5eb <printf+0x25d>
+          putc(fd, *s);
+     5d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     5d4:	0f b6 00             	movzbl (%rax),%eax
+     5d7:	0f be d0             	movsbl %al,%edx
+     5da:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5dd:	89 d6                	mov    %edx,%esi
+     5df:	89 c7                	mov    %eax,%edi
+     5e1:	e8 ea fb ff ff       	call   1d0 <putc>
+        for (; *s; s++)
+     5e6:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     5eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     5ef:	0f b6 00             	movzbl (%rax),%eax
+     5f2:	84 c0                	test   %al,%al
+     5f4:	75 da                	jne    5d0 <printf+0x242>
+     5f6:	eb 3b                	jmp    633 <printf+0x2a5>
+      } else if (c == '%') {
+     5f8:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     5fc:	75 14                	jne    612 <printf+0x284>
+        putc(fd, c);
+     5fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     601:	0f be d0             	movsbl %al,%edx
+     604:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     607:	89 d6                	mov    %edx,%esi
+     609:	89 c7                	mov    %eax,%edi
+     60b:	e8 c0 fb ff ff       	call   1d0 <putc>
+     610:	eb 21                	jmp    633 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     612:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     615:	be 25 00 00 00       	mov    $0x25,%esi
+     61a:	89 c7                	mov    %eax,%edi
+     61c:	e8 af fb ff ff       	call   1d0 <putc>
+        putc(fd, c);
+     621:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     624:	0f be d0             	movsbl %al,%edx
+     627:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     62a:	89 d6                	mov    %edx,%esi
+     62c:	89 c7                	mov    %eax,%edi
+     62e:	e8 9d fb ff ff       	call   1d0 <putc>
+      }
+      state = 0;
+     633:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     63a:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     63e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     641:	48 63 d0             	movslq %eax,%rdx
+     644:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     648:	48 01 d0             	add    %rdx,%rax
+     64b:	0f b6 00             	movzbl (%rax),%eax
+     64e:	84 c0                	test   %al,%al
+     650:	0f 85 81 fd ff ff    	jne    3d7 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     656:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     659:	89 c7                	mov    %eax,%edi
+     65b:	e8 ee 02 00 00       	call   94e <bflushtty>
+}
+     660:	90                   	nop
+     661:	c9                   	leave
+     662:	c3                   	ret
+
+0000000000000663 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     663:	55                   	push   %rbp
+     664:	48 89 e5             	mov    %rsp,%rbp
+     667:	48 83 ec 30          	sub    $0x30,%rsp
+     66b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     66e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     672:	78 06                	js     67a <getbuf+0x17>
+     674:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     678:	7e 0a                	jle    684 <getbuf+0x21>
+    return 0;
+     67a:	b8 00 00 00 00       	mov    $0x0,%eax
+     67f:	e9 94 00 00 00       	jmp    718 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     684:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     687:	48 98                	cltq
+     689:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     690:	00 
+     691:	48 8d 05 a8 29 00 00 	lea    0x29a8(%rip),%rax        # 3040 <obufs>
+     698:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     69c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6a0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6a5:	75 6d                	jne    714 <getbuf+0xb1>
+     6a7:	bf 08 02 00 00       	mov    $0x208,%edi
+     6ac:	e8 bd 13 00 00       	call   1a6e <malloc>
+     6b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6b5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6ba:	74 58                	je     714 <getbuf+0xb1>
+    b->n = 0;
+     6bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6c0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     6c6:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     6ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6cd:	48 89 d6             	mov    %rdx,%rsi
+     6d0:	89 c7                	mov    %eax,%edi
+     6d2:	e8 e4 0d 00 00       	call   14bb <fstat>
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	75 11                	jne    6ec <getbuf+0x89>
+     6db:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     6df:	66 83 f8 03          	cmp    $0x3,%ax
+     6e3:	75 07                	jne    6ec <getbuf+0x89>
+     6e5:	ba 01 00 00 00       	mov    $0x1,%edx
+     6ea:	eb 05                	jmp    6f1 <getbuf+0x8e>
+     6ec:	ba 00 00 00 00       	mov    $0x0,%edx
+     6f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6f5:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     6f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6fb:	48 98                	cltq
+     6fd:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     704:	00 
+     705:	48 8d 15 34 29 00 00 	lea    0x2934(%rip),%rdx        # 3040 <obufs>
+     70c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     710:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     718:	c9                   	leave
+     719:	c3                   	ret
+
+000000000000071a <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     71a:	55                   	push   %rbp
+     71b:	48 89 e5             	mov    %rsp,%rbp
+     71e:	48 83 ec 20          	sub    $0x20,%rsp
+     722:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     725:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     729:	78 33                	js     75e <bflush+0x44>
+     72b:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     72f:	7f 2d                	jg     75e <bflush+0x44>
+     731:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     734:	48 98                	cltq
+     736:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     73d:	00 
+     73e:	48 8d 05 fb 28 00 00 	lea    0x28fb(%rip),%rax        # 3040 <obufs>
+     745:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     749:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     74d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     752:	74 0a                	je     75e <bflush+0x44>
+     754:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     758:	8b 00                	mov    (%rax),%eax
+     75a:	85 c0                	test   %eax,%eax
+     75c:	75 07                	jne    765 <bflush+0x4b>
+    return 0;
+     75e:	b8 00 00 00 00       	mov    $0x0,%eax
+     763:	eb 3c                	jmp    7a1 <bflush+0x87>
+  n = b->n;
+     765:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     769:	8b 00                	mov    (%rax),%eax
+     76b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     76e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     772:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     778:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     77c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     780:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     783:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     786:	48 89 ce             	mov    %rcx,%rsi
+     789:	89 c7                	mov    %eax,%edi
+     78b:	e8 de 0c 00 00       	call   146e <write>
+     790:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     793:	75 07                	jne    79c <bflush+0x82>
+     795:	b8 00 00 00 00       	mov    $0x0,%eax
+     79a:	eb 05                	jmp    7a1 <bflush+0x87>
+     79c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     7a1:	c9                   	leave
+     7a2:	c3                   	ret
+
+00000000000007a3 <bflushall>:
+
+void bflushall(void) {
+     7a3:	55                   	push   %rbp
+     7a4:	48 89 e5             	mov    %rsp,%rbp
+     7a7:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     7ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7b2:	eb 0e                	jmp    7c2 <bflushall+0x1f>
+    bflush(fd);
+     7b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7b7:	89 c7                	mov    %eax,%edi
+     7b9:	e8 5c ff ff ff       	call   71a <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     7be:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     7c2:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     7c6:	7e ec                	jle    7b4 <bflushall+0x11>
+}
+     7c8:	90                   	nop
+     7c9:	90                   	nop
+     7ca:	c9                   	leave
+     7cb:	c3                   	ret
+
+00000000000007cc <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     7cc:	55                   	push   %rbp
+     7cd:	48 89 e5             	mov    %rsp,%rbp
+     7d0:	48 83 ec 30          	sub    $0x30,%rsp
+     7d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     7d7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     7db:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     7de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7e1:	89 c7                	mov    %eax,%edi
+     7e3:	e8 7b fe ff ff       	call   663 <getbuf>
+     7e8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     7ec:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     7f1:	75 19                	jne    80c <bwrite+0x40>
+    return write(fd, s, n);
+     7f3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     7f6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     7fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7fd:	48 89 ce             	mov    %rcx,%rsi
+     800:	89 c7                	mov    %eax,%edi
+     802:	e8 67 0c 00 00       	call   146e <write>
+     807:	e9 cd 00 00 00       	jmp    8d9 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     80c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     813:	e9 92 00 00 00       	jmp    8aa <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     818:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     81c:	8b 00                	mov    (%rax),%eax
+     81e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     823:	75 18                	jne    83d <bwrite+0x71>
+     825:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     828:	89 c7                	mov    %eax,%edi
+     82a:	e8 eb fe ff ff       	call   71a <bflush>
+     82f:	85 c0                	test   %eax,%eax
+     831:	79 0a                	jns    83d <bwrite+0x71>
+      return -1;
+     833:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     838:	e9 9c 00 00 00       	jmp    8d9 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     83d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     840:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     843:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     846:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     84a:	8b 00                	mov    (%rax),%eax
+     84c:	ba 00 02 00 00       	mov    $0x200,%edx
+     851:	29 c2                	sub    %eax,%edx
+     853:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     856:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     859:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     85c:	39 c2                	cmp    %eax,%edx
+     85e:	0f 4e c2             	cmovle %edx,%eax
+     861:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     864:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     867:	48 63 d0             	movslq %eax,%rdx
+     86a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     86e:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     872:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     876:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     87a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     87e:	8b 00                	mov    (%rax),%eax
+     880:	48 98                	cltq
+     882:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     886:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     889:	89 c2                	mov    %eax,%edx
+     88b:	48 89 cf             	mov    %rcx,%rdi
+     88e:	e8 e9 06 00 00       	call   f7c <memmove>
+    b->n += m;
+     893:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     897:	8b 10                	mov    (%rax),%edx
+     899:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     89c:	01 c2                	add    %eax,%edx
+     89e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8a2:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     8a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     8a7:	01 45 fc             	add    %eax,-0x4(%rbp)
+     8aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8ad:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     8b0:	0f 8c 62 ff ff ff    	jl     818 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     8b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8ba:	8b 40 04             	mov    0x4(%rax),%eax
+     8bd:	85 c0                	test   %eax,%eax
+     8bf:	74 15                	je     8d6 <bwrite+0x10a>
+     8c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8c4:	89 c7                	mov    %eax,%edi
+     8c6:	e8 4f fe ff ff       	call   71a <bflush>
+     8cb:	85 c0                	test   %eax,%eax
+     8cd:	79 07                	jns    8d6 <bwrite+0x10a>
+    return -1;
+     8cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     8d4:	eb 03                	jmp    8d9 <bwrite+0x10d>
+  return n;
+     8d6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     8d9:	c9                   	leave
+     8da:	c3                   	ret
+
+00000000000008db <bputc>:
+
+void bputc(int fd, char c) {
+     8db:	55                   	push   %rbp
+     8dc:	48 89 e5             	mov    %rsp,%rbp
+     8df:	48 83 ec 20          	sub    $0x20,%rsp
+     8e3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     8e6:	89 f0                	mov    %esi,%eax
+     8e8:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     8eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8ee:	89 c7                	mov    %eax,%edi
+     8f0:	e8 6e fd ff ff       	call   663 <getbuf>
+     8f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8f9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8fe:	75 18                	jne    918 <bputc+0x3d>
+    write(fd, &c, 1);
+     900:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     904:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     907:	ba 01 00 00 00       	mov    $0x1,%edx
+     90c:	48 89 ce             	mov    %rcx,%rsi
+     90f:	89 c7                	mov    %eax,%edi
+     911:	e8 58 0b 00 00       	call   146e <write>
+    return;
+     916:	eb 34                	jmp    94c <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     918:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     91c:	8b 00                	mov    (%rax),%eax
+     91e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     923:	75 0a                	jne    92f <bputc+0x54>
+    bflush(fd);
+     925:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     928:	89 c7                	mov    %eax,%edi
+     92a:	e8 eb fd ff ff       	call   71a <bflush>
+  b->data[b->n++] = c;
+     92f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     933:	8b 00                	mov    (%rax),%eax
+     935:	8d 48 01             	lea    0x1(%rax),%ecx
+     938:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     93c:	89 0a                	mov    %ecx,(%rdx)
+     93e:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     942:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     946:	48 98                	cltq
+     948:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     94c:	c9                   	leave
+     94d:	c3                   	ret
+
+000000000000094e <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     94e:	55                   	push   %rbp
+     94f:	48 89 e5             	mov    %rsp,%rbp
+     952:	48 83 ec 10          	sub    $0x10,%rsp
+     956:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     959:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     95d:	78 4c                	js     9ab <bflushtty+0x5d>
+     95f:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     963:	7f 46                	jg     9ab <bflushtty+0x5d>
+     965:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     968:	48 98                	cltq
+     96a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     971:	00 
+     972:	48 8d 05 c7 26 00 00 	lea    0x26c7(%rip),%rax        # 3040 <obufs>
+     979:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     97d:	48 85 c0             	test   %rax,%rax
+     980:	74 29                	je     9ab <bflushtty+0x5d>
+     982:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     985:	48 98                	cltq
+     987:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     98e:	00 
+     98f:	48 8d 05 aa 26 00 00 	lea    0x26aa(%rip),%rax        # 3040 <obufs>
+     996:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     99a:	8b 40 04             	mov    0x4(%rax),%eax
+     99d:	85 c0                	test   %eax,%eax
+     99f:	74 0a                	je     9ab <bflushtty+0x5d>
+    bflush(fd);
+     9a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9a4:	89 c7                	mov    %eax,%edi
+     9a6:	e8 6f fd ff ff       	call   71a <bflush>
+}
+     9ab:	90                   	nop
+     9ac:	c9                   	leave
+     9ad:	c3                   	ret
+
+00000000000009ae <fork>:
+
+int fork(void) {
+     9ae:	55                   	push   %rbp
+     9af:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     9b2:	e8 ec fd ff ff       	call   7a3 <bflushall>
+  return _fork();
+     9b7:	e8 7b 0a 00 00       	call   1437 <_fork>
+}
+     9bc:	5d                   	pop    %rbp
+     9bd:	c3                   	ret
+
+00000000000009be <exit>:
+
+noreturn void exit(void) {
+     9be:	55                   	push   %rbp
+     9bf:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     9c2:	e8 dc fd ff ff       	call   7a3 <bflushall>
+  _exit();
+     9c7:	e8 76 0a 00 00       	call   1442 <_exit>
+
+00000000000009cc <exec>:
+}
+
+int exec(char *path, char **argv) {
+     9cc:	55                   	push   %rbp
+     9cd:	48 89 e5             	mov    %rsp,%rbp
+     9d0:	48 83 ec 10          	sub    $0x10,%rsp
+     9d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     9dc:	e8 c2 fd ff ff       	call   7a3 <bflushall>
+  return _exec(path, argv);
+     9e1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     9e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9e9:	48 89 d6             	mov    %rdx,%rsi
+     9ec:	48 89 c7             	mov    %rax,%rdi
+     9ef:	e8 9b 0a 00 00       	call   148f <_exec>
+}
+     9f4:	c9                   	leave
+     9f5:	c3                   	ret
+
+00000000000009f6 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     9f6:	55                   	push   %rbp
+     9f7:	48 89 e5             	mov    %rsp,%rbp
+     9fa:	48 83 ec 20          	sub    $0x20,%rsp
+     9fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a02:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a06:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     a0a:	e8 94 fd ff ff       	call   7a3 <bflushall>
+  return _spawn(path, argv, fds);
+     a0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a13:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     a17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a1b:	48 89 ce             	mov    %rcx,%rsi
+     a1e:	48 89 c7             	mov    %rax,%rdi
+     a21:	e8 2f 0b 00 00       	call   1555 <_spawn>
+}
+     a26:	c9                   	leave
+     a27:	c3                   	ret
+
+0000000000000a28 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     a28:	55                   	push   %rbp
+     a29:	48 89 e5             	mov    %rsp,%rbp
+     a2c:	48 83 ec 10          	sub    $0x10,%rsp
+     a30:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     a33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     a37:	78 69                	js     aa2 <close+0x7a>
+     a39:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     a3d:	7f 63                	jg     aa2 <close+0x7a>
+     a3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a42:	48 98                	cltq
+     a44:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a4b:	00 
+     a4c:	48 8d 05 ed 25 00 00 	lea    0x25ed(%rip),%rax        # 3040 <obufs>
+     a53:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a57:	48 85 c0             	test   %rax,%rax
+     a5a:	74 46                	je     aa2 <close+0x7a>
+    bflush(fd);
+     a5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a5f:	89 c7                	mov    %eax,%edi
+     a61:	e8 b4 fc ff ff       	call   71a <bflush>
+    free(obufs[fd]);
+     a66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a69:	48 98                	cltq
+     a6b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a72:	00 
+     a73:	48 8d 05 c6 25 00 00 	lea    0x25c6(%rip),%rax        # 3040 <obufs>
+     a7a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a7e:	48 89 c7             	mov    %rax,%rdi
+     a81:	e8 90 11 00 00       	call   1c16 <free>
+    obufs[fd] = 0;
+     a86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a89:	48 98                	cltq
+     a8b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a92:	00 
+     a93:	48 8d 05 a6 25 00 00 	lea    0x25a6(%rip),%rax        # 3040 <obufs>
+     a9a:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     aa1:	00 
+  }
+  return _close(fd);
+     aa2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aa5:	89 c7                	mov    %eax,%edi
+     aa7:	e8 cd 09 00 00       	call   1479 <_close>
+}
+     aac:	c9                   	leave
+     aad:	c3                   	ret
+
+0000000000000aae <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     aae:	55                   	push   %rbp
+     aaf:	48 89 e5             	mov    %rsp,%rbp
+     ab2:	53                   	push   %rbx
+     ab3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ab7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     abb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     abf:	48 8b 36             	mov    (%rsi),%rsi
+     ac2:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     ac6:	48 29 f7             	sub    %rsi,%rdi
+     ac9:	48 89 f9             	mov    %rdi,%rcx
+     acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ad1:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     ad5:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     ad9:	48 89 f0             	mov    %rsi,%rax
+     adc:	ba 00 00 00 00       	mov    $0x0,%edx
+     ae1:	48 89 df             	mov    %rbx,%rdi
+     ae4:	48 0f af f8          	imul   %rax,%rdi
+     ae8:	48 89 d6             	mov    %rdx,%rsi
+     aeb:	48 0f af f1          	imul   %rcx,%rsi
+     aef:	48 01 fe             	add    %rdi,%rsi
+     af2:	48 f7 e1             	mul    %rcx
+     af5:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     af9:	48 89 ca             	mov    %rcx,%rdx
+     afc:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     b01:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     b05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b09:	c9                   	leave
+     b0a:	c3                   	ret
+
+0000000000000b0b <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     b0b:	55                   	push   %rbp
+     b0c:	48 89 e5             	mov    %rsp,%rbp
+     b0f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b13:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     b16:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     b19:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b1d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b23:	48 89 ce             	mov    %rcx,%rsi
+     b26:	48 89 f7             	mov    %rsi,%rdi
+     b29:	89 d1                	mov    %edx,%ecx
+     b2b:	fc                   	cld
+     b2c:	f3 aa                	rep stos %al,%es:(%rdi)
+     b2e:	89 ca                	mov    %ecx,%edx
+     b30:	48 89 fe             	mov    %rdi,%rsi
+     b33:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b37:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b3a:	90                   	nop
+     b3b:	5d                   	pop    %rbp
+     b3c:	c3                   	ret
+
+0000000000000b3d <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     b3d:	55                   	push   %rbp
+     b3e:	48 89 e5             	mov    %rsp,%rbp
+     b41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b49:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     b4d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b51:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b59:	48 89 ce             	mov    %rcx,%rsi
+     b5c:	48 89 f7             	mov    %rsi,%rdi
+     b5f:	48 89 d1             	mov    %rdx,%rcx
+     b62:	fc                   	cld
+     b63:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     b66:	48 89 ca             	mov    %rcx,%rdx
+     b69:	48 89 fe             	mov    %rdi,%rsi
+     b6c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b70:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b74:	90                   	nop
+     b75:	5d                   	pop    %rbp
+     b76:	c3                   	ret
+
+0000000000000b77 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     b77:	55                   	push   %rbp
+     b78:	48 89 e5             	mov    %rsp,%rbp
+     b7b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b7f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b83:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     b87:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b8b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b93:	48 89 cf             	mov    %rcx,%rdi
+     b96:	48 89 d6             	mov    %rdx,%rsi
+     b99:	48 89 c1             	mov    %rax,%rcx
+     b9c:	fc                   	cld
+     b9d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     b9f:	48 89 c8             	mov    %rcx,%rax
+     ba2:	48 89 f2             	mov    %rsi,%rdx
+     ba5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ba9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     bad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     bb1:	90                   	nop
+     bb2:	5d                   	pop    %rbp
+     bb3:	c3                   	ret
+
+0000000000000bb4 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     bb4:	55                   	push   %rbp
+     bb5:	48 89 e5             	mov    %rsp,%rbp
+     bb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bbc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     bc0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     bc4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     bc8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     bcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bd0:	48 89 cf             	mov    %rcx,%rdi
+     bd3:	48 89 d6             	mov    %rdx,%rsi
+     bd6:	48 89 c1             	mov    %rax,%rcx
+     bd9:	fc                   	cld
+     bda:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     bdd:	48 89 c8             	mov    %rcx,%rax
+     be0:	48 89 f2             	mov    %rsi,%rdx
+     be3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     be7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     beb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     bef:	90                   	nop
+     bf0:	5d                   	pop    %rbp
+     bf1:	c3                   	ret
+
+0000000000000bf2 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     bf2:	55                   	push   %rbp
+     bf3:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     bf6:	0f 31                	rdtsc
+     bf8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     bfb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     bfe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c01:	48 c1 e0 20          	shl    $0x20,%rax
+     c05:	48 89 c2             	mov    %rax,%rdx
+     c08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c0b:	48 09 d0             	or     %rdx,%rax
+}
+     c0e:	5d                   	pop    %rbp
+     c0f:	c3                   	ret
+
+0000000000000c10 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     c10:	55                   	push   %rbp
+     c11:	48 89 e5             	mov    %rsp,%rbp
+     c14:	53                   	push   %rbx
+     c15:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     c18:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     c1c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     c20:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     c24:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     c28:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c2b:	0f a2                	cpuid
+     c2d:	89 de                	mov    %ebx,%esi
+     c2f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     c32:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     c35:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     c38:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     c3b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     c40:	74 09                	je     c4b <cpuid+0x3b>
+    *eaxp = eax;
+     c42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     c46:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     c49:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     c4b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     c50:	74 09                	je     c5b <cpuid+0x4b>
+    *ebxp = ebx;
+     c52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c56:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c59:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     c5b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     c60:	74 09                	je     c6b <cpuid+0x5b>
+    *ecxp = ecx;
+     c62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c66:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c69:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     c6b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     c70:	74 09                	je     c7b <cpuid+0x6b>
+    *edxp = edx;
+     c72:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     c76:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     c79:	89 10                	mov    %edx,(%rax)
+}
+     c7b:	90                   	nop
+     c7c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c80:	c9                   	leave
+     c81:	c3                   	ret
+
+0000000000000c82 <strcpy>:
+char *strcpy(char *s, char *t) {
+     c82:	55                   	push   %rbp
+     c83:	48 89 e5             	mov    %rsp,%rbp
+     c86:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c8a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     c8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c92:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     c96:	90                   	nop
+     c97:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c9b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     c9f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     ca3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ca7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     cab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     caf:	0f b6 12             	movzbl (%rdx),%edx
+     cb2:	88 10                	mov    %dl,(%rax)
+     cb4:	0f b6 00             	movzbl (%rax),%eax
+     cb7:	84 c0                	test   %al,%al
+     cb9:	75 dc                	jne    c97 <strcpy+0x15>
+  return os;
+     cbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     cbf:	5d                   	pop    %rbp
+     cc0:	c3                   	ret
+
+0000000000000cc1 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     cc1:	55                   	push   %rbp
+     cc2:	48 89 e5             	mov    %rsp,%rbp
+     cc5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cc9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     ccd:	eb 0a                	jmp    cd9 <strcmp+0x18>
+    p++, q++;
+     ccf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     cd4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     cd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cdd:	0f b6 00             	movzbl (%rax),%eax
+     ce0:	84 c0                	test   %al,%al
+     ce2:	74 12                	je     cf6 <strcmp+0x35>
+     ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce8:	0f b6 10             	movzbl (%rax),%edx
+     ceb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cef:	0f b6 00             	movzbl (%rax),%eax
+     cf2:	38 c2                	cmp    %al,%dl
+     cf4:	74 d9                	je     ccf <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     cf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cfa:	0f b6 00             	movzbl (%rax),%eax
+     cfd:	0f b6 d0             	movzbl %al,%edx
+     d00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d04:	0f b6 00             	movzbl (%rax),%eax
+     d07:	0f b6 c0             	movzbl %al,%eax
+     d0a:	29 c2                	sub    %eax,%edx
+     d0c:	89 d0                	mov    %edx,%eax
+}
+     d0e:	5d                   	pop    %rbp
+     d0f:	c3                   	ret
+
+0000000000000d10 <strlen>:
+uint strlen(char *s) {
+     d10:	55                   	push   %rbp
+     d11:	48 89 e5             	mov    %rsp,%rbp
+     d14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     d18:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d1f:	eb 04                	jmp    d25 <strlen+0x15>
+     d21:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d28:	48 63 d0             	movslq %eax,%rdx
+     d2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d2f:	48 01 d0             	add    %rdx,%rax
+     d32:	0f b6 00             	movzbl (%rax),%eax
+     d35:	84 c0                	test   %al,%al
+     d37:	75 e8                	jne    d21 <strlen+0x11>
+    ;
+  return n;
+     d39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     d3c:	5d                   	pop    %rbp
+     d3d:	c3                   	ret
+
+0000000000000d3e <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     d3e:	55                   	push   %rbp
+     d3f:	48 89 e5             	mov    %rsp,%rbp
+     d42:	53                   	push   %rbx
+     d43:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     d47:	8b 05 e7 22 00 00    	mov    0x22e7(%rip),%eax        # 3034 <erms>
+     d4d:	85 c0                	test   %eax,%eax
+     d4f:	79 53                	jns    da4 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     d51:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     d55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     d5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d60:	ba 00 00 00 00       	mov    $0x0,%edx
+     d65:	48 89 c6             	mov    %rax,%rsi
+     d68:	bf 00 00 00 00       	mov    $0x0,%edi
+     d6d:	e8 9e fe ff ff       	call   c10 <cpuid>
+    ebx = 0;
+     d72:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     d79:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d7c:	83 f8 06             	cmp    $0x6,%eax
+     d7f:	76 14                	jbe    d95 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     d81:	b8 07 00 00 00       	mov    $0x7,%eax
+     d86:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d8b:	0f a2                	cpuid
+     d8d:	89 d9                	mov    %ebx,%ecx
+     d8f:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     d92:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     d95:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d98:	c1 e8 09             	shr    $0x9,%eax
+     d9b:	83 e0 01             	and    $0x1,%eax
+     d9e:	89 05 90 22 00 00    	mov    %eax,0x2290(%rip)        # 3034 <erms>
+  }
+  return erms;
+     da4:	8b 05 8a 22 00 00    	mov    0x228a(%rip),%eax        # 3034 <erms>
+}
+     daa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     dae:	c9                   	leave
+     daf:	c3                   	ret
+
+0000000000000db0 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     db0:	55                   	push   %rbp
+     db1:	48 89 e5             	mov    %rsp,%rbp
+     db4:	48 83 ec 10          	sub    $0x10,%rsp
+     db8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dbc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     dbf:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     dc2:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     dc6:	76 09                	jbe    dd1 <memset+0x21>
+     dc8:	e8 71 ff ff ff       	call   d3e <haserms>
+     dcd:	85 c0                	test   %eax,%eax
+     dcf:	74 16                	je     de7 <memset+0x37>
+    stosb(dst, c, n);
+     dd1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     dd4:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     dd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ddb:	89 ce                	mov    %ecx,%esi
+     ddd:	48 89 c7             	mov    %rax,%rdi
+     de0:	e8 26 fd ff ff       	call   b0b <stosb>
+     de5:	eb 58                	jmp    e3f <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     de7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     dea:	c1 e8 03             	shr    $0x3,%eax
+     ded:	89 c6                	mov    %eax,%esi
+     def:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     df2:	48 98                	cltq
+     df4:	0f b6 c0             	movzbl %al,%eax
+     df7:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     dfe:	01 01 01 
+     e01:	48 0f af c2          	imul   %rdx,%rax
+     e05:	48 89 c1             	mov    %rax,%rcx
+     e08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e0c:	48 89 f2             	mov    %rsi,%rdx
+     e0f:	48 89 ce             	mov    %rcx,%rsi
+     e12:	48 89 c7             	mov    %rax,%rdi
+     e15:	e8 23 fd ff ff       	call   b3d <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     e1a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e1d:	83 e0 07             	and    $0x7,%eax
+     e20:	89 c2                	mov    %eax,%edx
+     e22:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e25:	83 e0 f8             	and    $0xfffffff8,%eax
+     e28:	48 89 c1             	mov    %rax,%rcx
+     e2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e2f:	48 01 c1             	add    %rax,%rcx
+     e32:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e35:	89 c6                	mov    %eax,%esi
+     e37:	48 89 cf             	mov    %rcx,%rdi
+     e3a:	e8 cc fc ff ff       	call   b0b <stosb>
+  }
+  return dst;
+     e3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e43:	c9                   	leave
+     e44:	c3                   	ret
+
+0000000000000e45 <strchr>:
+
+char *strchr(const char *s, char c) {
+     e45:	55                   	push   %rbp
+     e46:	48 89 e5             	mov    %rsp,%rbp
+     e49:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e4d:	89 f0                	mov    %esi,%eax
+     e4f:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     e52:	eb 17                	jmp    e6b <strchr+0x26>
+    if (*s == c)
+     e54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e58:	0f b6 00             	movzbl (%rax),%eax
+     e5b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     e5e:	75 06                	jne    e66 <strchr+0x21>
+      return (char *)s;
+     e60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e64:	eb 15                	jmp    e7b <strchr+0x36>
+  for (; *s; s++)
+     e66:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e6f:	0f b6 00             	movzbl (%rax),%eax
+     e72:	84 c0                	test   %al,%al
+     e74:	75 de                	jne    e54 <strchr+0xf>
+  return 0;
+     e76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e7b:	5d                   	pop    %rbp
+     e7c:	c3                   	ret
+
+0000000000000e7d <gets>:
+
+char *gets(char *buf, int max) {
+     e7d:	55                   	push   %rbp
+     e7e:	48 89 e5             	mov    %rsp,%rbp
+     e81:	48 83 ec 20          	sub    $0x20,%rsp
+     e85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e89:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     e8c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e93:	eb 48                	jmp    edd <gets+0x60>
+    cc = read(0, &c, 1);
+     e95:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     e99:	ba 01 00 00 00       	mov    $0x1,%edx
+     e9e:	48 89 c6             	mov    %rax,%rsi
+     ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+     ea6:	e8 b8 05 00 00       	call   1463 <read>
+     eab:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     eae:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     eb2:	7e 36                	jle    eea <gets+0x6d>
+      break;
+    buf[i++] = c;
+     eb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eb7:	8d 50 01             	lea    0x1(%rax),%edx
+     eba:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ebd:	48 63 d0             	movslq %eax,%rdx
+     ec0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ec4:	48 01 c2             	add    %rax,%rdx
+     ec7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ecb:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     ecd:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ed1:	3c 0a                	cmp    $0xa,%al
+     ed3:	74 16                	je     eeb <gets+0x6e>
+     ed5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ed9:	3c 0d                	cmp    $0xd,%al
+     edb:	74 0e                	je     eeb <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     edd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ee0:	83 c0 01             	add    $0x1,%eax
+     ee3:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     ee6:	7f ad                	jg     e95 <gets+0x18>
+     ee8:	eb 01                	jmp    eeb <gets+0x6e>
+      break;
+     eea:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     eeb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eee:	48 63 d0             	movslq %eax,%rdx
+     ef1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ef5:	48 01 d0             	add    %rdx,%rax
+     ef8:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     efb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     eff:	c9                   	leave
+     f00:	c3                   	ret
+
+0000000000000f01 <stat>:
+
+int stat(char *n, struct stat *st) {
+     f01:	55                   	push   %rbp
+     f02:	48 89 e5             	mov    %rsp,%rbp
+     f05:	48 83 ec 10          	sub    $0x10,%rsp
+     f09:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f0d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     f11:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f19:	48 89 c6             	mov    %rax,%rsi
+     f1c:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     f21:	e8 58 07 00 00       	call   167e <fstatat>
+}
+     f26:	c9                   	leave
+     f27:	c3                   	ret
+
+0000000000000f28 <atoi>:
+
+int atoi(const char *s) {
+     f28:	55                   	push   %rbp
+     f29:	48 89 e5             	mov    %rsp,%rbp
+     f2c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     f30:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f37:	eb 28                	jmp    f61 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     f39:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f3c:	89 d0                	mov    %edx,%eax
+     f3e:	c1 e0 02             	shl    $0x2,%eax
+     f41:	01 d0                	add    %edx,%eax
+     f43:	01 c0                	add    %eax,%eax
+     f45:	89 c1                	mov    %eax,%ecx
+     f47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f4b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     f4f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     f53:	0f b6 00             	movzbl (%rax),%eax
+     f56:	0f be c0             	movsbl %al,%eax
+     f59:	01 c8                	add    %ecx,%eax
+     f5b:	83 e8 30             	sub    $0x30,%eax
+     f5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f65:	0f b6 00             	movzbl (%rax),%eax
+     f68:	3c 2f                	cmp    $0x2f,%al
+     f6a:	7e 0b                	jle    f77 <atoi+0x4f>
+     f6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f70:	0f b6 00             	movzbl (%rax),%eax
+     f73:	3c 39                	cmp    $0x39,%al
+     f75:	7e c2                	jle    f39 <atoi+0x11>
+  return n;
+     f77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     f7a:	5d                   	pop    %rbp
+     f7b:	c3                   	ret
+
+0000000000000f7c <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     f7c:	55                   	push   %rbp
+     f7d:	48 89 e5             	mov    %rsp,%rbp
+     f80:	48 83 ec 28          	sub    $0x28,%rsp
+     f84:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     f88:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     f8c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     f8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f93:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     f97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     f9f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     fa3:	7f 09                	jg     fae <memmove+0x32>
+    return vdst;
+     fa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fa9:	e9 29 01 00 00       	jmp    10d7 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     fae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fb2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     fb6:	0f 83 87 00 00 00    	jae    1043 <memmove+0xc7>
+     fbc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fbf:	48 63 d0             	movslq %eax,%rdx
+     fc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fc6:	48 01 d0             	add    %rdx,%rax
+     fc9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     fcd:	73 74                	jae    1043 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     fcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fd2:	48 98                	cltq
+     fd4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     fd8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fdb:	48 98                	cltq
+     fdd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     fe1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     fe5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fe9:	48 09 d0             	or     %rdx,%rax
+     fec:	83 e0 07             	and    $0x7,%eax
+     fef:	48 85 c0             	test   %rax,%rax
+     ff2:	75 3d                	jne    1031 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     ff4:	eb 1c                	jmp    1012 <memmove+0x96>
+        src -= 8;
+     ff6:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     ffb:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1000:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1004:	48 8b 10             	mov    (%rax),%rdx
+    1007:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    100b:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    100e:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1012:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1016:	7f de                	jg     ff6 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1018:	eb 17                	jmp    1031 <memmove+0xb5>
+      *--dst = *--src;
+    101a:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    101f:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1028:	0f b6 10             	movzbl (%rax),%edx
+    102b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    102f:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1031:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1034:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1037:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    103a:	85 c0                	test   %eax,%eax
+    103c:	7f dc                	jg     101a <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    103e:	e9 90 00 00 00       	jmp    10d3 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1043:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1047:	7e 09                	jle    1052 <memmove+0xd6>
+    1049:	e8 f0 fc ff ff       	call   d3e <haserms>
+    104e:	85 c0                	test   %eax,%eax
+    1050:	74 1b                	je     106d <memmove+0xf1>
+    movsb(dst, src, n);
+    1052:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1055:	48 63 d0             	movslq %eax,%rdx
+    1058:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    105c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1060:	48 89 ce             	mov    %rcx,%rsi
+    1063:	48 89 c7             	mov    %rax,%rdi
+    1066:	e8 0c fb ff ff       	call   b77 <movsb>
+    106b:	eb 66                	jmp    10d3 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    106d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1070:	8d 50 07             	lea    0x7(%rax),%edx
+    1073:	85 c0                	test   %eax,%eax
+    1075:	0f 48 c2             	cmovs  %edx,%eax
+    1078:	c1 f8 03             	sar    $0x3,%eax
+    107b:	48 63 d0             	movslq %eax,%rdx
+    107e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1082:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1086:	48 89 ce             	mov    %rcx,%rsi
+    1089:	48 89 c7             	mov    %rax,%rdi
+    108c:	e8 23 fb ff ff       	call   bb4 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1091:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1094:	89 d0                	mov    %edx,%eax
+    1096:	c1 f8 1f             	sar    $0x1f,%eax
+    1099:	c1 e8 1d             	shr    $0x1d,%eax
+    109c:	01 c2                	add    %eax,%edx
+    109e:	83 e2 07             	and    $0x7,%edx
+    10a1:	29 c2                	sub    %eax,%edx
+    10a3:	89 d0                	mov    %edx,%eax
+    10a5:	48 98                	cltq
+    10a7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10aa:	83 e2 f8             	and    $0xfffffff8,%edx
+    10ad:	48 63 ca             	movslq %edx,%rcx
+    10b0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    10b4:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    10b8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10bb:	83 e2 f8             	and    $0xfffffff8,%edx
+    10be:	48 63 ca             	movslq %edx,%rcx
+    10c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    10c5:	48 01 d1             	add    %rdx,%rcx
+    10c8:	48 89 c2             	mov    %rax,%rdx
+    10cb:	48 89 cf             	mov    %rcx,%rdi
+    10ce:	e8 a4 fa ff ff       	call   b77 <movsb>
+  }
+  return vdst;
+    10d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    10d7:	c9                   	leave
+    10d8:	c3                   	ret
+
+00000000000010d9 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    10d9:	55                   	push   %rbp
+    10da:	48 89 e5             	mov    %rsp,%rbp
+    10dd:	48 83 ec 20          	sub    $0x20,%rsp
+    10e1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    10e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    10e8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    10ef:	00 00 00 
+    10f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    10f6:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    10fa:	75 0d                	jne    1109 <clock_gettime+0x30>
+    10fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1100:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1104:	48 85 c0             	test   %rax,%rax
+    1107:	75 13                	jne    111c <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1109:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    110d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1110:	48 89 d6             	mov    %rdx,%rsi
+    1113:	89 c7                	mov    %eax,%edi
+    1115:	e8 e0 04 00 00       	call   15fa <_clock_gettime>
+    111a:	eb 7d                	jmp    1199 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    111c:	e8 d1 fa ff ff       	call   bf2 <rdtsc>
+    1121:	48 89 c2             	mov    %rax,%rdx
+    1124:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1128:	48 89 d6             	mov    %rdx,%rsi
+    112b:	48 89 c7             	mov    %rax,%rdi
+    112e:	e8 7b f9 ff ff       	call   aae <clockns>
+    1133:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1137:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    113b:	48 c1 e8 09          	shr    $0x9,%rax
+    113f:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1146:	b8 44 00 
+    1149:	48 f7 e2             	mul    %rdx
+    114c:	48 89 d0             	mov    %rdx,%rax
+    114f:	48 c1 e8 0b          	shr    $0xb,%rax
+    1153:	48 89 c2             	mov    %rax,%rdx
+    1156:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    115a:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    115d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1161:	48 89 c8             	mov    %rcx,%rax
+    1164:	48 c1 e8 09          	shr    $0x9,%rax
+    1168:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    116f:	b8 44 00 
+    1172:	48 f7 e2             	mul    %rdx
+    1175:	48 89 d0             	mov    %rdx,%rax
+    1178:	48 c1 e8 0b          	shr    $0xb,%rax
+    117c:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1183:	48 89 c8             	mov    %rcx,%rax
+    1186:	48 29 d0             	sub    %rdx,%rax
+    1189:	48 89 c2             	mov    %rax,%rdx
+    118c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1190:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1194:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1199:	c9                   	leave
+    119a:	c3                   	ret
+
+000000000000119b <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    119b:	55                   	push   %rbp
+    119c:	48 89 e5             	mov    %rsp,%rbp
+    119f:	48 83 ec 10          	sub    $0x10,%rsp
+    11a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    11a7:	eb 11                	jmp    11ba <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    11a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ad:	be 02 00 00 00       	mov    $0x2,%esi
+    11b2:	48 89 c7             	mov    %rax,%rdi
+    11b5:	e8 6c 04 00 00       	call   1626 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    11ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    11be:	b8 02 00 00 00       	mov    $0x2,%eax
+    11c3:	87 02                	xchg   %eax,(%rdx)
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	75 e0                	jne    11a9 <mutex_wait+0xe>
+}
+    11c9:	90                   	nop
+    11ca:	90                   	nop
+    11cb:	c9                   	leave
+    11cc:	c3                   	ret
+
+00000000000011cd <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    11cd:	55                   	push   %rbp
+    11ce:	48 89 e5             	mov    %rsp,%rbp
+    11d1:	48 83 ec 20          	sub    $0x20,%rsp
+    11d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    11d9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    11e0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    11e4:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    11e8:	8b 02                	mov    (%rdx),%eax
+    11ea:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11ef:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    11f3:	89 c1                	mov    %eax,%ecx
+    11f5:	0f 94 c0             	sete   %al
+    11f8:	84 c0                	test   %al,%al
+    11fa:	75 02                	jne    11fe <mutex_lock+0x31>
+    11fc:	89 0a                	mov    %ecx,(%rdx)
+    11fe:	83 f0 01             	xor    $0x1,%eax
+    1201:	84 c0                	test   %al,%al
+    1203:	74 0c                	je     1211 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1205:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1209:	48 89 c7             	mov    %rax,%rdi
+    120c:	e8 8a ff ff ff       	call   119b <mutex_wait>
+}
+    1211:	90                   	nop
+    1212:	c9                   	leave
+    1213:	c3                   	ret
+
+0000000000001214 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1214:	55                   	push   %rbp
+    1215:	48 89 e5             	mov    %rsp,%rbp
+    1218:	48 83 ec 10          	sub    $0x10,%rsp
+    121c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1224:	ba 00 00 00 00       	mov    $0x0,%edx
+    1229:	87 10                	xchg   %edx,(%rax)
+    122b:	83 fa 02             	cmp    $0x2,%edx
+    122e:	75 11                	jne    1241 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1230:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1234:	be 01 00 00 00       	mov    $0x1,%esi
+    1239:	48 89 c7             	mov    %rax,%rdi
+    123c:	e8 f0 03 00 00       	call   1631 <futex_wake>
+}
+    1241:	90                   	nop
+    1242:	c9                   	leave
+    1243:	c3                   	ret
+
+0000000000001244 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1244:	55                   	push   %rbp
+    1245:	48 89 e5             	mov    %rsp,%rbp
+    1248:	48 83 ec 20          	sub    $0x20,%rsp
+    124c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1250:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1254:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1258:	48 83 c0 04          	add    $0x4,%rax
+    125c:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1264:	8b 00                	mov    (%rax),%eax
+    1266:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1269:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    126d:	48 89 c7             	mov    %rax,%rdi
+    1270:	e8 9f ff ff ff       	call   1214 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1275:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1279:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    127c:	89 d6                	mov    %edx,%esi
+    127e:	48 89 c7             	mov    %rax,%rdi
+    1281:	e8 a0 03 00 00       	call   1626 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1286:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    128a:	48 83 c0 04          	add    $0x4,%rax
+    128e:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1292:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1296:	48 89 c7             	mov    %rax,%rdi
+    1299:	e8 fd fe ff ff       	call   119b <mutex_wait>
+}
+    129e:	90                   	nop
+    129f:	c9                   	leave
+    12a0:	c3                   	ret
+
+00000000000012a1 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    12a1:	55                   	push   %rbp
+    12a2:	48 89 e5             	mov    %rsp,%rbp
+    12a5:	48 83 ec 10          	sub    $0x10,%rsp
+    12a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    12ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b1:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    12b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b9:	48 83 c0 04          	add    $0x4,%rax
+    12bd:	8b 00                	mov    (%rax),%eax
+    12bf:	85 c0                	test   %eax,%eax
+    12c1:	7e 11                	jle    12d4 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    12c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12c7:	be 01 00 00 00       	mov    $0x1,%esi
+    12cc:	48 89 c7             	mov    %rax,%rdi
+    12cf:	e8 5d 03 00 00       	call   1631 <futex_wake>
+}
+    12d4:	90                   	nop
+    12d5:	c9                   	leave
+    12d6:	c3                   	ret
+
+00000000000012d7 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    12d7:	55                   	push   %rbp
+    12d8:	48 89 e5             	mov    %rsp,%rbp
+    12db:	48 83 ec 10          	sub    $0x10,%rsp
+    12df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    12e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12e7:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    12eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12ef:	48 83 c0 04          	add    $0x4,%rax
+    12f3:	8b 00                	mov    (%rax),%eax
+    12f5:	85 c0                	test   %eax,%eax
+    12f7:	7e 11                	jle    130a <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    12f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12fd:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1302:	48 89 c7             	mov    %rax,%rdi
+    1305:	e8 27 03 00 00       	call   1631 <futex_wake>
+}
+    130a:	90                   	nop
+    130b:	c9                   	leave
+    130c:	c3                   	ret
+
+000000000000130d <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    130d:	55                   	push   %rbp
+    130e:	48 89 e5             	mov    %rsp,%rbp
+    1311:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1315:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1318:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    131c:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1320:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1324:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1328:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    132c:	8b 40 04             	mov    0x4(%rax),%eax
+    132f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1332:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1336:	8b 00                	mov    (%rax),%eax
+    1338:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    133b:	29 c2                	sub    %eax,%edx
+    133d:	83 fa 1f             	cmp    $0x1f,%edx
+    1340:	76 07                	jbe    1349 <ring_push+0x3c>
+    return -1;
+    1342:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1347:	eb 7e                	jmp    13c7 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1349:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    134c:	83 e0 1f             	and    $0x1f,%eax
+    134f:	89 c2                	mov    %eax,%edx
+    1351:	48 89 d0             	mov    %rdx,%rax
+    1354:	48 01 c0             	add    %rax,%rax
+    1357:	48 01 d0             	add    %rdx,%rax
+    135a:	48 c1 e0 04          	shl    $0x4,%rax
+    135e:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1362:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1366:	48 01 d0             	add    %rdx,%rax
+    1369:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    136d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1371:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1374:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1376:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    137a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    137e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1382:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1386:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    138a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    138e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1392:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1396:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    139a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    139e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    13a2:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    13a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13aa:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    13ae:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    13b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13b5:	8d 50 01             	lea    0x1(%rax),%edx
+    13b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13bc:	48 83 c0 04          	add    $0x4,%rax
+    13c0:	89 10                	mov    %edx,(%rax)
+  return 0;
+    13c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13c7:	5d                   	pop    %rbp
+    13c8:	c3                   	ret
+
+00000000000013c9 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    13c9:	55                   	push   %rbp
+    13ca:	48 89 e5             	mov    %rsp,%rbp
+    13cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    13d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13d9:	8b 40 08             	mov    0x8(%rax),%eax
+    13dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    13df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e3:	48 83 c0 0c          	add    $0xc,%rax
+    13e7:	8b 00                	mov    (%rax),%eax
+    13e9:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    13ec:	75 07                	jne    13f5 <ring_pop+0x2c>
+    return -1;
+    13ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13f3:	eb 40                	jmp    1435 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    13f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13f8:	83 e0 1f             	and    $0x1f,%eax
+    13fb:	89 c2                	mov    %eax,%edx
+    13fd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1401:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1405:	89 d2                	mov    %edx,%edx
+    1407:	48 83 c2 61          	add    $0x61,%rdx
+    140b:	48 c1 e2 04          	shl    $0x4,%rdx
+    140f:	48 01 d0             	add    %rdx,%rax
+    1412:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1416:	48 8b 00             	mov    (%rax),%rax
+    1419:	48 89 01             	mov    %rax,(%rcx)
+    141c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1420:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1423:	8d 50 01             	lea    0x1(%rax),%edx
+    1426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    142a:	48 83 c0 08          	add    $0x8,%rax
+    142e:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1435:	5d                   	pop    %rbp
+    1436:	c3                   	ret
+
+0000000000001437 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1437:	b8 01 00 00 00       	mov    $0x1,%eax
+    143c:	49 89 ca             	mov    %rcx,%r10
+    143f:	0f 05                	syscall
+    1441:	c3                   	ret
+
+0000000000001442 <_exit>:
+SYSCALL_(exit)
+    1442:	b8 02 00 00 00       	mov    $0x2,%eax
+    1447:	49 89 ca             	mov    %rcx,%r10
+    144a:	0f 05                	syscall
+    144c:	c3                   	ret
+
+000000000000144d <wait>:
+SYSCALL(wait)
+    144d:	b8 03 00 00 00       	mov    $0x3,%eax
+    1452:	49 89 ca             	mov    %rcx,%r10
+    1455:	0f 05                	syscall
+    1457:	c3                   	ret
+
+0000000000001458 <pipe>:
+SYSCALL(pipe)
+    1458:	b8 04 00 00 00       	mov    $0x4,%eax
+    145d:	49 89 ca             	mov    %rcx,%r10
+    1460:	0f 05                	syscall
+    1462:	c3                   	ret
+
+0000000000001463 <read>:
+SYSCALL(read)
+    1463:	b8 05 00 00 00       	mov    $0x5,%eax
+    1468:	49 89 ca             	mov    %rcx,%r10
+    146b:	0f 05                	syscall
+    146d:	c3                   	ret
+
+000000000000146e <write>:
+SYSCALL(write)
+    146e:	b8 10 00 00 00       	mov    $0x10,%eax
+    1473:	49 89 ca             	mov    %rcx,%r10
+    1476:	0f 05                	syscall
+    1478:	c3                   	ret
+
+0000000000001479 <_close>:
+SYSCALL_(close)
+    1479:	b8 15 00 00 00       	mov    $0x15,%eax
+    147e:	49 89 ca             	mov    %rcx,%r10
+    1481:	0f 05                	syscall
+    1483:	c3                   	ret
+
+0000000000001484 <kill>:
+SYSCALL(kill)
+    1484:	b8 06 00 00 00       	mov    $0x6,%eax
+    1489:	49 89 ca             	mov    %rcx,%r10
+    148c:	0f 05                	syscall
+    148e:	c3                   	ret
+
+000000000000148f <_exec>:
+SYSCALL_(exec)
+    148f:	b8 07 00 00 00       	mov    $0x7,%eax
+    1494:	49 89 ca             	mov    %rcx,%r10
+    1497:	0f 05                	syscall
+    1499:	c3                   	ret
+
+000000000000149a <open>:
+SYSCALL(open)
+    149a:	b8 0f 00 00 00       	mov    $0xf,%eax
+    149f:	49 89 ca             	mov    %rcx,%r10
+    14a2:	0f 05                	syscall
+    14a4:	c3                   	ret
+
+00000000000014a5 <mknod>:
+SYSCALL(mknod)
+    14a5:	b8 11 00 00 00       	mov    $0x11,%eax
+    14aa:	49 89 ca             	mov    %rcx,%r10
+    14ad:	0f 05                	syscall
+    14af:	c3                   	ret
+
+00000000000014b0 <unlink>:
+SYSCALL(unlink)
+    14b0:	b8 12 00 00 00       	mov    $0x12,%eax
+    14b5:	49 89 ca             	mov    %rcx,%r10
+    14b8:	0f 05                	syscall
+    14ba:	c3                   	ret
+
+00000000000014bb <fstat>:
+SYSCALL(fstat)
+    14bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    14c0:	49 89 ca             	mov    %rcx,%r10
+    14c3:	0f 05                	syscall
+    14c5:	c3                   	ret
+
+00000000000014c6 <link>:
+SYSCALL(link)
+    14c6:	b8 13 00 00 00       	mov    $0x13,%eax
+    14cb:	49 89 ca             	mov    %rcx,%r10
+    14ce:	0f 05                	syscall
+    14d0:	c3                   	ret
+
+00000000000014d1 <mkdir>:
+SYSCALL(mkdir)
+    14d1:	b8 14 00 00 00       	mov    $0x14,%eax
+    14d6:	49 89 ca             	mov    %rcx,%r10
+    14d9:	0f 05                	syscall
+    14db:	c3                   	ret
+
+00000000000014dc <chdir>:
+SYSCALL(chdir)
+    14dc:	b8 09 00 00 00       	mov    $0x9,%eax
+    14e1:	49 89 ca             	mov    %rcx,%r10
+    14e4:	0f 05                	syscall
+    14e6:	c3                   	ret
+
+00000000000014e7 <dup>:
+SYSCALL(dup)
+    14e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14ec:	49 89 ca             	mov    %rcx,%r10
+    14ef:	0f 05                	syscall
+    14f1:	c3                   	ret
+
+00000000000014f2 <getpid>:
+SYSCALL(getpid)
+    14f2:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14f7:	49 89 ca             	mov    %rcx,%r10
+    14fa:	0f 05                	syscall
+    14fc:	c3                   	ret
+
+00000000000014fd <sbrk>:
+SYSCALL(sbrk)
+    14fd:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1502:	49 89 ca             	mov    %rcx,%r10
+    1505:	0f 05                	syscall
+    1507:	c3                   	ret
+
+0000000000001508 <sleep>:
+SYSCALL(sleep)
+    1508:	b8 0d 00 00 00       	mov    $0xd,%eax
+    150d:	49 89 ca             	mov    %rcx,%r10
+    1510:	0f 05                	syscall
+    1512:	c3                   	ret
+
+0000000000001513 <uptime>:
+SYSCALL(uptime)
+    1513:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1518:	49 89 ca             	mov    %rcx,%r10
+    151b:	0f 05                	syscall
+    151d:	c3                   	ret
+
+000000000000151e <sysinfo>:
+SYSCALL(sysinfo)
+    151e:	b8 16 00 00 00       	mov    $0x16,%eax
+    1523:	49 89 ca             	mov    %rcx,%r10
+    1526:	0f 05                	syscall
+    1528:	c3                   	ret
+
+0000000000001529 <crashn>:
+SYSCALL(crashn)
+    1529:	b8 17 00 00 00       	mov    $0x17,%eax
+    152e:	49 89 ca             	mov    %rcx,%r10
+    1531:	0f 05                	syscall
+    1533:	c3                   	ret
+
+0000000000001534 <mmap>:
+SYSCALL(mmap)
+    1534:	b8 18 00 00 00       	mov    $0x18,%eax
+    1539:	49 89 ca             	mov    %rcx,%r10
+    153c:	0f 05                	syscall
+    153e:	c3                   	ret
+
+000000000000153f <munmap>:
+SYSCALL(munmap)
+    153f:	b8 19 00 00 00       	mov    $0x19,%eax
+    1544:	49 89 ca             	mov    %rcx,%r10
+    1547:	0f 05                	syscall
+    1549:	c3                   	ret
+
+000000000000154a <nice>:
+SYSCALL(nice)
+    154a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    154f:	49 89 ca             	mov    %rcx,%r10
+    1552:	0f 05                	syscall
+    1554:	c3                   	ret
+
+0000000000001555 <_spawn>:
+SYSCALL_(spawn)
+    1555:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    155a:	49 89 ca             	mov    %rcx,%r10
+    155d:	0f 05                	syscall
+    155f:	c3                   	ret
+
+0000000000001560 <pread>:
+SYSCALL(pread)
+    1560:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1565:	49 89 ca             	mov    %rcx,%r10
+    1568:	0f 05                	syscall
+    156a:	c3                   	ret
+
+000000000000156b <pwrite>:
+SYSCALL(pwrite)
+    156b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1570:	49 89 ca             	mov    %rcx,%r10
+    1573:	0f 05                	syscall
+    1575:	c3                   	ret
+
+0000000000001576 <readv>:
+SYSCALL(readv)
+    1576:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    157b:	49 89 ca             	mov    %rcx,%r10
+    157e:	0f 05                	syscall
+    1580:	c3                   	ret
+
+0000000000001581 <writev>:
+SYSCALL(writev)
+    1581:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1586:	49 89 ca             	mov    %rcx,%r10
+    1589:	0f 05                	syscall
+    158b:	c3                   	ret
+
+000000000000158c <sendfile>:
+SYSCALL(sendfile)
+    158c:	b8 20 00 00 00       	mov    $0x20,%eax
+    1591:	49 89 ca             	mov    %rcx,%r10
+    1594:	0f 05                	syscall
+    1596:	c3                   	ret
+
+0000000000001597 <splice>:
+SYSCALL(splice)
+    1597:	b8 21 00 00 00       	mov    $0x21,%eax
+    159c:	49 89 ca             	mov    %rcx,%r10
+    159f:	0f 05                	syscall
+    15a1:	c3                   	ret
+
+00000000000015a2 <poll>:
+SYSCALL(poll)
+    15a2:	b8 22 00 00 00       	mov    $0x22,%eax
+    15a7:	49 89 ca             	mov    %rcx,%r10
+    15aa:	0f 05                	syscall
+    15ac:	c3                   	ret
+
+00000000000015ad <fsync>:
+SYSCALL(fsync)
+    15ad:	b8 23 00 00 00       	mov    $0x23,%eax
+    15b2:	49 89 ca             	mov    %rcx,%r10
+    15b5:	0f 05                	syscall
+    15b7:	c3                   	ret
+
+00000000000015b8 <fdatasync>:
+SYSCALL(fdatasync)
+    15b8:	b8 24 00 00 00       	mov    $0x24,%eax
+    15bd:	49 89 ca             	mov    %rcx,%r10
+    15c0:	0f 05                	syscall
+    15c2:	c3                   	ret
+
+00000000000015c3 <lockstat>:
+SYSCALL(lockstat)
+    15c3:	b8 25 00 00 00       	mov    $0x25,%eax
+    15c8:	49 89 ca             	mov    %rcx,%r10
+    15cb:	0f 05                	syscall
+    15cd:	c3                   	ret
+
+00000000000015ce <syscallstat>:
+SYSCALL(syscallstat)
+    15ce:	b8 26 00 00 00       	mov    $0x26,%eax
+    15d3:	49 89 ca             	mov    %rcx,%r10
+    15d6:	0f 05                	syscall
+    15d8:	c3                   	ret
+
+00000000000015d9 <trace>:
+SYSCALL(trace)
+    15d9:	b8 27 00 00 00       	mov    $0x27,%eax
+    15de:	49 89 ca             	mov    %rcx,%r10
+    15e1:	0f 05                	syscall
+    15e3:	c3                   	ret
+
+00000000000015e4 <profile>:
+SYSCALL(profile)
+    15e4:	b8 28 00 00 00       	mov    $0x28,%eax
+    15e9:	49 89 ca             	mov    %rcx,%r10
+    15ec:	0f 05                	syscall
+    15ee:	c3                   	ret
+
+00000000000015ef <cycles>:
+SYSCALL(cycles)
+    15ef:	b8 29 00 00 00       	mov    $0x29,%eax
+    15f4:	49 89 ca             	mov    %rcx,%r10
+    15f7:	0f 05                	syscall
+    15f9:	c3                   	ret
+
+00000000000015fa <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    15fa:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    15ff:	49 89 ca             	mov    %rcx,%r10
+    1602:	0f 05                	syscall
+    1604:	c3                   	ret
+
+0000000000001605 <consmode>:
+SYSCALL(consmode)
+    1605:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    160a:	49 89 ca             	mov    %rcx,%r10
+    160d:	0f 05                	syscall
+    160f:	c3                   	ret
+
+0000000000001610 <clone>:
+SYSCALL(clone)
+    1610:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1615:	49 89 ca             	mov    %rcx,%r10
+    1618:	0f 05                	syscall
+    161a:	c3                   	ret
+
+000000000000161b <join>:
+SYSCALL(join)
+    161b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1620:	49 89 ca             	mov    %rcx,%r10
+    1623:	0f 05                	syscall
+    1625:	c3                   	ret
+
+0000000000001626 <futex_wait>:
+SYSCALL(futex_wait)
+    1626:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    162b:	49 89 ca             	mov    %rcx,%r10
+    162e:	0f 05                	syscall
+    1630:	c3                   	ret
+
+0000000000001631 <futex_wake>:
+SYSCALL(futex_wake)
+    1631:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1636:	49 89 ca             	mov    %rcx,%r10
+    1639:	0f 05                	syscall
+    163b:	c3                   	ret
+
+000000000000163c <shmget>:
+SYSCALL(shmget)
+    163c:	b8 30 00 00 00       	mov    $0x30,%eax
+    1641:	49 89 ca             	mov    %rcx,%r10
+    1644:	0f 05                	syscall
+    1646:	c3                   	ret
+
+0000000000001647 <shmat>:
+SYSCALL(shmat)
+    1647:	b8 31 00 00 00       	mov    $0x31,%eax
+    164c:	49 89 ca             	mov    %rcx,%r10
+    164f:	0f 05                	syscall
+    1651:	c3                   	ret
+
+0000000000001652 <shmdt>:
+SYSCALL(shmdt)
+    1652:	b8 32 00 00 00       	mov    $0x32,%eax
+    1657:	49 89 ca             	mov    %rcx,%r10
+    165a:	0f 05                	syscall
+    165c:	c3                   	ret
+
+000000000000165d <ring_setup>:
+SYSCALL(ring_setup)
+    165d:	b8 33 00 00 00       	mov    $0x33,%eax
+    1662:	49 89 ca             	mov    %rcx,%r10
+    1665:	0f 05                	syscall
+    1667:	c3                   	ret
+
+0000000000001668 <ring_enter>:
+SYSCALL(ring_enter)
+    1668:	b8 34 00 00 00       	mov    $0x34,%eax
+    166d:	49 89 ca             	mov    %rcx,%r10
+    1670:	0f 05                	syscall
+    1672:	c3                   	ret
+
+0000000000001673 <getdents>:
+SYSCALL(getdents)
+    1673:	b8 35 00 00 00       	mov    $0x35,%eax
+    1678:	49 89 ca             	mov    %rcx,%r10
+    167b:	0f 05                	syscall
+    167d:	c3                   	ret
+
+000000000000167e <fstatat>:
+SYSCALL(fstatat)
+    167e:	b8 36 00 00 00       	mov    $0x36,%eax
+    1683:	49 89 ca             	mov    %rcx,%r10
+    1686:	0f 05                	syscall
+    1688:	c3                   	ret
+
+0000000000001689 <clone_file>:
+SYSCALL(clone_file)
+    1689:	b8 37 00 00 00       	mov    $0x37,%eax
+    168e:	49 89 ca             	mov    %rcx,%r10
+    1691:	0f 05                	syscall
+    1693:	c3                   	ret
+
+0000000000001694 <fpunch>:
+SYSCALL(fpunch)
+    1694:	b8 38 00 00 00       	mov    $0x38,%eax
+    1699:	49 89 ca             	mov    %rcx,%r10
+    169c:	0f 05                	syscall
+    169e:	c3                   	ret
+
+000000000000169f <defrag>:
+SYSCALL(defrag)
+    169f:	b8 39 00 00 00       	mov    $0x39,%eax
+    16a4:	49 89 ca             	mov    %rcx,%r10
+    16a7:	0f 05                	syscall
+    16a9:	c3                   	ret
+
+00000000000016aa <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    16aa:	55                   	push   %rbp
+    16ab:	48 89 e5             	mov    %rsp,%rbp
+    16ae:	48 83 ec 20          	sub    $0x20,%rsp
+    16b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    16b6:	bf 00 00 00 00       	mov    $0x0,%edi
+    16bb:	e8 3d fe ff ff       	call   14fd <sbrk>
+    16c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    16c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16c8:	48 f7 d8             	neg    %rax
+    16cb:	25 ff 0f 00 00       	and    $0xfff,%eax
+    16d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    16d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16dc:	48 01 c2             	add    %rax,%rdx
+    16df:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    16e4:	48 39 c2             	cmp    %rax,%rdx
+    16e7:	73 1e                	jae    1707 <morecore+0x5d>
+    16e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ed:	89 c2                	mov    %eax,%edx
+    16ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f3:	01 d0                	add    %edx,%eax
+    16f5:	89 c7                	mov    %eax,%edi
+    16f7:	e8 01 fe ff ff       	call   14fd <sbrk>
+    16fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1700:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1705:	75 07                	jne    170e <morecore+0x64>
+    return 0;
+    1707:	b8 00 00 00 00       	mov    $0x0,%eax
+    170c:	eb 27                	jmp    1735 <morecore+0x8b>
+  stats.heap += n + pad;
+    170e:	48 8b 05 5b 1a 00 00 	mov    0x1a5b(%rip),%rax        # 3170 <stats+0x50>
+    1715:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1719:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    171d:	48 01 ca             	add    %rcx,%rdx
+    1720:	48 01 d0             	add    %rdx,%rax
+    1723:	48 89 05 46 1a 00 00 	mov    %rax,0x1a46(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    172a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    172e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1732:	48 01 d0             	add    %rdx,%rax
+}
+    1735:	c9                   	leave
+    1736:	c3                   	ret
+
+0000000000001737 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1737:	55                   	push   %rbp
+    1738:	48 89 e5             	mov    %rsp,%rbp
+    173b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    173f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1743:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    174a:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    174b:	48 8d 05 ae 19 00 00 	lea    0x19ae(%rip),%rax        # 3100 <runs>
+    1752:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1756:	eb 1a                	jmp    1772 <pagefree+0x3b>
+    prev = *rp;
+    1758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    175c:	48 8b 00             	mov    (%rax),%rax
+    175f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1763:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1767:	48 8b 00             	mov    (%rax),%rax
+    176a:	48 83 c0 08          	add    $0x8,%rax
+    176e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1772:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1776:	48 8b 00             	mov    (%rax),%rax
+    1779:	48 85 c0             	test   %rax,%rax
+    177c:	74 0d                	je     178b <pagefree+0x54>
+    177e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1782:	48 8b 00             	mov    (%rax),%rax
+    1785:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1789:	72 cd                	jb     1758 <pagefree+0x21>
+  r = (struct run *)p;
+    178b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    178f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1793:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1797:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    179b:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    179e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17a2:	48 8b 10             	mov    (%rax),%rdx
+    17a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17a9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    17ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17b1:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17b5:	48 85 c0             	test   %rax,%rax
+    17b8:	74 48                	je     1802 <pagefree+0xcb>
+    17ba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    17be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17c2:	48 01 c2             	add    %rax,%rdx
+    17c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17c9:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17cd:	48 39 c2             	cmp    %rax,%rdx
+    17d0:	75 30                	jne    1802 <pagefree+0xcb>
+    r->size += r->next->size;
+    17d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d6:	48 8b 10             	mov    (%rax),%rdx
+    17d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17e1:	48 8b 00             	mov    (%rax),%rax
+    17e4:	48 01 c2             	add    %rax,%rdx
+    17e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17eb:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    17ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f2:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17f6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17fe:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1802:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1807:	74 46                	je     184f <pagefree+0x118>
+    1809:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    180d:	48 8b 10             	mov    (%rax),%rdx
+    1810:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1814:	48 01 d0             	add    %rdx,%rax
+    1817:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    181b:	75 32                	jne    184f <pagefree+0x118>
+    prev->size += r->size;
+    181d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1821:	48 8b 10             	mov    (%rax),%rdx
+    1824:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1828:	48 8b 00             	mov    (%rax),%rax
+    182b:	48 01 c2             	add    %rax,%rdx
+    182e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1832:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1835:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1839:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    183d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1841:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1845:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1849:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    184d:	eb 0c                	jmp    185b <pagefree+0x124>
+  } else {
+    *rp = r;
+    184f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1853:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1857:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    185a:	90                   	nop
+    185b:	90                   	nop
+    185c:	5d                   	pop    %rbp
+    185d:	c3                   	ret
+
+000000000000185e <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    185e:	55                   	push   %rbp
+    185f:	48 89 e5             	mov    %rsp,%rbp
+    1862:	48 83 ec 40          	sub    $0x40,%rsp
+    1866:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    186a:	48 8d 05 8f 18 00 00 	lea    0x188f(%rip),%rax        # 3100 <runs>
+    1871:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1875:	eb 66                	jmp    18dd <pagealloc+0x7f>
+    if (r->size == n) {
+    1877:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    187b:	48 8b 00             	mov    (%rax),%rax
+    187e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1882:	75 18                	jne    189c <pagealloc+0x3e>
+      *rp = r->next;
+    1884:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1888:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    188c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1890:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1893:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1897:	e9 ca 00 00 00       	jmp    1966 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    189c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a0:	48 8b 00             	mov    (%rax),%rax
+    18a3:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    18a7:	73 28                	jae    18d1 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    18a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18ad:	48 8b 00             	mov    (%rax),%rax
+    18b0:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18b4:	48 89 c2             	mov    %rax,%rdx
+    18b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18bb:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    18be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18c2:	48 8b 10             	mov    (%rax),%rdx
+    18c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18c9:	48 01 d0             	add    %rdx,%rax
+    18cc:	e9 95 00 00 00       	jmp    1966 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    18d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18d5:	48 83 c0 08          	add    $0x8,%rax
+    18d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e1:	48 8b 00             	mov    (%rax),%rax
+    18e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18e8:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    18ed:	75 88                	jne    1877 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    18ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    18f3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    18f7:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    18fe:	00 
+    18ff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1903:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1907:	48 39 c2             	cmp    %rax,%rdx
+    190a:	48 0f 43 c2          	cmovae %rdx,%rax
+    190e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1912:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1916:	48 89 c7             	mov    %rax,%rdi
+    1919:	e8 8c fd ff ff       	call   16aa <morecore>
+    191e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1922:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1927:	75 07                	jne    1930 <pagealloc+0xd2>
+    return 0;
+    1929:	b8 00 00 00 00       	mov    $0x0,%eax
+    192e:	eb 36                	jmp    1966 <pagealloc+0x108>
+  if (m > n)
+    1930:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1934:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1938:	73 1a                	jae    1954 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    193a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    193e:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1942:	48 89 c2             	mov    %rax,%rdx
+    1945:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1949:	48 89 d6             	mov    %rdx,%rsi
+    194c:	48 89 c7             	mov    %rax,%rdi
+    194f:	e8 e3 fd ff ff       	call   1737 <pagefree>
+  return p + m - n;
+    1954:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1958:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    195c:	48 89 c2             	mov    %rax,%rdx
+    195f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1963:	48 01 d0             	add    %rdx,%rax
+}
+    1966:	c9                   	leave
+    1967:	c3                   	ret
+
+0000000000001968 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1968:	55                   	push   %rbp
+    1969:	48 89 e5             	mov    %rsp,%rbp
+    196c:	48 83 ec 30          	sub    $0x30,%rsp
+    1970:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1973:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1978:	e8 e1 fe ff ff       	call   185e <pagealloc>
+    197d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1981:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1986:	75 0a                	jne    1992 <refill+0x2a>
+    return -1;
+    1988:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    198d:	e9 da 00 00 00       	jmp    1a6c <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1992:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1999:	00 
+    199a:	e9 ba 00 00 00       	jmp    1a59 <refill+0xf1>
+    b = (struct block *)(p + off);
+    199f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a7:	48 01 d0             	add    %rdx,%rax
+    19aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    19ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19b1:	ba 20 00 00 00       	mov    $0x20,%edx
+    19b6:	89 c1                	mov    %eax,%ecx
+    19b8:	48 d3 e2             	shl    %cl,%rdx
+    19bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19bf:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    19c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19c5:	48 63 d0             	movslq %eax,%rdx
+    19c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19cc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    19d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19d3:	48 98                	cltq
+    19d5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    19dc:	00 
+    19dd:	48 8d 05 dc 16 00 00 	lea    0x16dc(%rip),%rax        # 30c0 <freelist>
+    19e4:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    19e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19ec:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    19f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19f3:	48 98                	cltq
+    19f5:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    19fc:	00 
+    19fd:	48 8d 15 bc 16 00 00 	lea    0x16bc(%rip),%rdx        # 30c0 <freelist>
+    1a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a08:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1a0c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a0f:	48 98                	cltq
+    1a11:	48 83 c0 08          	add    $0x8,%rax
+    1a15:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a1c:	00 
+    1a1d:	48 8d 05 00 17 00 00 	lea    0x1700(%rip),%rax        # 3124 <stats+0x4>
+    1a24:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a27:	8d 48 01             	lea    0x1(%rax),%ecx
+    1a2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a2d:	48 98                	cltq
+    1a2f:	48 83 c0 08          	add    $0x8,%rax
+    1a33:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a3a:	00 
+    1a3b:	48 8d 05 e2 16 00 00 	lea    0x16e2(%rip),%rax        # 3124 <stats+0x4>
+    1a42:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1a45:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a48:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a4d:	89 c1                	mov    %eax,%ecx
+    1a4f:	48 d3 e2             	shl    %cl,%rdx
+    1a52:	48 89 d0             	mov    %rdx,%rax
+    1a55:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1a59:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1a60:	00 
+    1a61:	0f 86 38 ff ff ff    	jbe    199f <refill+0x37>
+  }
+  return 0;
+    1a67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a6c:	c9                   	leave
+    1a6d:	c3                   	ret
+
+0000000000001a6e <malloc>:
+
+void *malloc(uint nbytes) {
+    1a6e:	55                   	push   %rbp
+    1a6f:	48 89 e5             	mov    %rsp,%rbp
+    1a72:	48 83 ec 30          	sub    $0x30,%rsp
+    1a76:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1a79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a7c:	48 83 c0 10          	add    $0x10,%rax
+    1a80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1a84:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1a8b:	eb 04                	jmp    1a91 <malloc+0x23>
+    1a8d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1a91:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1a95:	7f 16                	jg     1aad <malloc+0x3f>
+    1a97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a9a:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a9f:	89 c1                	mov    %eax,%ecx
+    1aa1:	48 d3 e2             	shl    %cl,%rdx
+    1aa4:	48 89 d0             	mov    %rdx,%rax
+    1aa7:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1aab:	72 e0                	jb     1a8d <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1aad:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1ab1:	75 7d                	jne    1b30 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab7:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1abd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1ac3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1ac7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1acb:	48 89 c7             	mov    %rax,%rdi
+    1ace:	e8 8b fd ff ff       	call   185e <pagealloc>
+    1ad3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1ad7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1adc:	75 0a                	jne    1ae8 <malloc+0x7a>
+      return 0;
+    1ade:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ae3:	e9 2c 01 00 00       	jmp    1c14 <malloc+0x1a6>
+    h->size = n;
+    1ae8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1aec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1af0:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1af3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1af7:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1afe:	00 
+    stats.inuse[LARGE]++;
+    1aff:	8b 05 3b 16 00 00    	mov    0x163b(%rip),%eax        # 3140 <stats+0x20>
+    1b05:	83 c0 01             	add    $0x1,%eax
+    1b08:	89 05 32 16 00 00    	mov    %eax,0x1632(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    1b0e:	48 8b 15 53 16 00 00 	mov    0x1653(%rip),%rdx        # 3168 <stats+0x48>
+    1b15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b19:	48 01 d0             	add    %rdx,%rax
+    1b1c:	48 89 05 45 16 00 00 	mov    %rax,0x1645(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    1b23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b27:	48 83 c0 10          	add    $0x10,%rax
+    1b2b:	e9 e4 00 00 00       	jmp    1c14 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1b30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b33:	48 98                	cltq
+    1b35:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b3c:	00 
+    1b3d:	48 8d 05 7c 15 00 00 	lea    0x157c(%rip),%rax        # 30c0 <freelist>
+    1b44:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b48:	48 85 c0             	test   %rax,%rax
+    1b4b:	75 18                	jne    1b65 <malloc+0xf7>
+    1b4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b50:	89 c7                	mov    %eax,%edi
+    1b52:	e8 11 fe ff ff       	call   1968 <refill>
+    1b57:	85 c0                	test   %eax,%eax
+    1b59:	79 0a                	jns    1b65 <malloc+0xf7>
+    return 0;
+    1b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b60:	e9 af 00 00 00       	jmp    1c14 <malloc+0x1a6>
+  b = freelist[c];
+    1b65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b68:	48 98                	cltq
+    1b6a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b71:	00 
+    1b72:	48 8d 05 47 15 00 00 	lea    0x1547(%rip),%rax        # 30c0 <freelist>
+    1b79:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b7d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b85:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1b89:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1b8c:	48 63 d2             	movslq %edx,%rdx
+    1b8f:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1b96:	00 
+    1b97:	48 8d 15 22 15 00 00 	lea    0x1522(%rip),%rdx        # 30c0 <freelist>
+    1b9e:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1ba2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ba5:	48 98                	cltq
+    1ba7:	48 83 c0 08          	add    $0x8,%rax
+    1bab:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bb2:	00 
+    1bb3:	48 8d 05 6a 15 00 00 	lea    0x156a(%rip),%rax        # 3124 <stats+0x4>
+    1bba:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bbd:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1bc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bc3:	48 98                	cltq
+    1bc5:	48 83 c0 08          	add    $0x8,%rax
+    1bc9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bd0:	00 
+    1bd1:	48 8d 05 4c 15 00 00 	lea    0x154c(%rip),%rax        # 3124 <stats+0x4>
+    1bd8:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1bdb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bde:	48 98                	cltq
+    1be0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1be7:	00 
+    1be8:	48 8d 05 31 15 00 00 	lea    0x1531(%rip),%rax        # 3120 <stats>
+    1bef:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bf2:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bf5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bf8:	48 98                	cltq
+    1bfa:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c01:	00 
+    1c02:	48 8d 05 17 15 00 00 	lea    0x1517(%rip),%rax        # 3120 <stats>
+    1c09:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1c0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c10:	48 83 c0 10          	add    $0x10,%rax
+}
+    1c14:	c9                   	leave
+    1c15:	c3                   	ret
+
+0000000000001c16 <free>:
+
+void free(void *ap) {
+    1c16:	55                   	push   %rbp
+    1c17:	48 89 e5             	mov    %rsp,%rbp
+    1c1a:	48 83 ec 18          	sub    $0x18,%rsp
+    1c1e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1c22:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1c27:	0f 84 03 01 00 00    	je     1d30 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1c2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c31:	48 83 e8 10          	sub    $0x10,%rax
+    1c35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1c39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1c41:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1c45:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1c4a:	75 42                	jne    1c8e <free+0x78>
+    stats.inuse[LARGE]--;
+    1c4c:	8b 05 ee 14 00 00    	mov    0x14ee(%rip),%eax        # 3140 <stats+0x20>
+    1c52:	83 e8 01             	sub    $0x1,%eax
+    1c55:	89 05 e5 14 00 00    	mov    %eax,0x14e5(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1c5b:	48 8b 15 06 15 00 00 	mov    0x1506(%rip),%rdx        # 3168 <stats+0x48>
+    1c62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c66:	48 8b 00             	mov    (%rax),%rax
+    1c69:	48 29 c2             	sub    %rax,%rdx
+    1c6c:	48 89 15 f5 14 00 00 	mov    %rdx,0x14f5(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1c73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c77:	48 8b 10             	mov    (%rax),%rdx
+    1c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7e:	48 89 d6             	mov    %rdx,%rsi
+    1c81:	48 89 c7             	mov    %rax,%rdi
+    1c84:	e8 ae fa ff ff       	call   1737 <pagefree>
+    return;
+    1c89:	e9 a3 00 00 00       	jmp    1d31 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1c8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c92:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c99:	00 
+    1c9a:	48 8d 05 1f 14 00 00 	lea    0x141f(%rip),%rax        # 30c0 <freelist>
+    1ca1:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1ca5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca9:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1cad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb1:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1cb8:	00 
+    1cb9:	48 8d 15 00 14 00 00 	lea    0x1400(%rip),%rdx        # 30c0 <freelist>
+    1cc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc4:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1cc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ccc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cd3:	00 
+    1cd4:	48 8d 05 45 14 00 00 	lea    0x1445(%rip),%rax        # 3120 <stats>
+    1cdb:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1cde:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1ce1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ce5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cec:	00 
+    1ced:	48 8d 05 2c 14 00 00 	lea    0x142c(%rip),%rax        # 3120 <stats>
+    1cf4:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1cf7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cfb:	48 83 c0 08          	add    $0x8,%rax
+    1cff:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d06:	00 
+    1d07:	48 8d 05 16 14 00 00 	lea    0x1416(%rip),%rax        # 3124 <stats+0x4>
+    1d0e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d11:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d18:	48 83 c0 08          	add    $0x8,%rax
+    1d1c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d23:	00 
+    1d24:	48 8d 05 f9 13 00 00 	lea    0x13f9(%rip),%rax        # 3124 <stats+0x4>
+    1d2b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1d2e:	eb 01                	jmp    1d31 <free+0x11b>
+    return;
+    1d30:	90                   	nop
+}
+    1d31:	c9                   	leave
+    1d32:	c3                   	ret
+
+0000000000001d33 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1d33:	55                   	push   %rbp
+    1d34:	48 89 e5             	mov    %rsp,%rbp
+    1d37:	48 83 ec 30          	sub    $0x30,%rsp
+    1d3b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1d3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d41:	48 8d 15 c8 02 00 00 	lea    0x2c8(%rip),%rdx        # 2010 <benchreport+0x1b5>
+    1d48:	48 89 d6             	mov    %rdx,%rsi
+    1d4b:	89 c7                	mov    %eax,%edi
+    1d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d52:	e8 37 e6 ff ff       	call   38e <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d57:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1d5e:	eb 67                	jmp    1dc7 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1d60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d63:	48 98                	cltq
+    1d65:	48 83 c0 08          	add    $0x8,%rax
+    1d69:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d70:	00 
+    1d71:	48 8d 05 ac 13 00 00 	lea    0x13ac(%rip),%rax        # 3124 <stats+0x4>
+    1d78:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1d7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d7e:	48 98                	cltq
+    1d80:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d87:	00 
+    1d88:	48 8d 05 91 13 00 00 	lea    0x1391(%rip),%rax        # 3120 <stats>
+    1d8f:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1d92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d95:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d9a:	89 c1                	mov    %eax,%ecx
+    1d9c:	48 d3 e2             	shl    %cl,%rdx
+    1d9f:	48 89 d0             	mov    %rdx,%rax
+    1da2:	89 c1                	mov    %eax,%ecx
+    1da4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1da7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1daa:	41 89 f9             	mov    %edi,%r9d
+    1dad:	41 89 f0             	mov    %esi,%r8d
+    1db0:	48 8d 35 70 02 00 00 	lea    0x270(%rip),%rsi        # 2027 <benchreport+0x1cc>
+    1db7:	89 c7                	mov    %eax,%edi
+    1db9:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dbe:	e8 cb e5 ff ff       	call   38e <printf>
+  for (c = 0; c < NCLASS; c++)
+    1dc3:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1dc7:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1dcb:	7e 93                	jle    1d60 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1dcd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1dd4:	00 
+  for (r = runs; r; r = r->next)
+    1dd5:	48 8b 05 24 13 00 00 	mov    0x1324(%rip),%rax        # 3100 <runs>
+    1ddc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1de0:	eb 17                	jmp    1df9 <mallocstats+0xc6>
+    nfree += r->size;
+    1de2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de6:	48 8b 00             	mov    (%rax),%rax
+    1de9:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1ded:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1df1:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1df5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1df9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1dfe:	75 e2                	jne    1de2 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1e00:	48 8b 05 69 13 00 00 	mov    0x1369(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e07:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1e09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e0d:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e11:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1e13:	48 8b 05 4e 13 00 00 	mov    0x134e(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e1a:	89 c1                	mov    %eax,%ecx
+    1e1c:	8b 15 1e 13 00 00    	mov    0x131e(%rip),%edx        # 3140 <stats+0x20>
+    1e22:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e25:	41 89 f9             	mov    %edi,%r9d
+    1e28:	41 89 f0             	mov    %esi,%r8d
+    1e2b:	48 8d 35 06 02 00 00 	lea    0x206(%rip),%rsi        # 2038 <benchreport+0x1dd>
+    1e32:	89 c7                	mov    %eax,%edi
+    1e34:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e39:	e8 50 e5 ff ff       	call   38e <printf>
+}
+    1e3e:	90                   	nop
+    1e3f:	c9                   	leave
+    1e40:	c3                   	ret
+
+0000000000001e41 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1e41:	55                   	push   %rbp
+    1e42:	48 89 e5             	mov    %rsp,%rbp
+    1e45:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1e49:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1e4d:	48 89 c7             	mov    %rax,%rdi
+    1e50:	e8 9a f7 ff ff       	call   15ef <cycles>
+  return t;
+    1e55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1e59:	c9                   	leave
+    1e5a:	c3                   	ret
+
+0000000000001e5b <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1e5b:	55                   	push   %rbp
+    1e5c:	48 89 e5             	mov    %rsp,%rbp
+    1e5f:	48 83 ec 30          	sub    $0x30,%rsp
+    1e63:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e6b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1e6e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1e72:	0f 8e 24 01 00 00    	jle    1f9c <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1e78:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1e7f:	e9 98 00 00 00       	jmp    1f1c <benchreport+0xc1>
+    x = t[i];
+    1e84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e87:	48 98                	cltq
+    1e89:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e90:	00 
+    1e91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e95:	48 01 d0             	add    %rdx,%rax
+    1e98:	48 8b 00             	mov    (%rax),%rax
+    1e9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ea2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1ea5:	eb 33                	jmp    1eda <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1ea7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1eaa:	48 98                	cltq
+    1eac:	48 c1 e0 03          	shl    $0x3,%rax
+    1eb0:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1eb4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1eb8:	48 01 d0             	add    %rdx,%rax
+    1ebb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1ebe:	48 63 d2             	movslq %edx,%rdx
+    1ec1:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1ec8:	00 
+    1ec9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1ecd:	48 01 ca             	add    %rcx,%rdx
+    1ed0:	48 8b 00             	mov    (%rax),%rax
+    1ed3:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1ed6:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1eda:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1ede:	7e 1d                	jle    1efd <benchreport+0xa2>
+    1ee0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ee3:	48 98                	cltq
+    1ee5:	48 c1 e0 03          	shl    $0x3,%rax
+    1ee9:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1eed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ef1:	48 01 d0             	add    %rdx,%rax
+    1ef4:	48 8b 00             	mov    (%rax),%rax
+    1ef7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1efb:	72 aa                	jb     1ea7 <benchreport+0x4c>
+    t[j] = x;
+    1efd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1f00:	48 98                	cltq
+    1f02:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f09:	00 
+    1f0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f0e:	48 01 c2             	add    %rax,%rdx
+    1f11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f15:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1f18:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1f1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f1f:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1f22:	0f 8c 5c ff ff ff    	jl     1e84 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1f28:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f2b:	48 98                	cltq
+    1f2d:	48 c1 e0 03          	shl    $0x3,%rax
+    1f31:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1f35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f39:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f3c:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1f3f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f42:	89 c2                	mov    %eax,%edx
+    1f44:	c1 ea 1f             	shr    $0x1f,%edx
+    1f47:	01 d0                	add    %edx,%eax
+    1f49:	d1 f8                	sar    %eax
+    1f4b:	48 98                	cltq
+    1f4d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f54:	00 
+    1f55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f59:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f5c:	48 8b 38             	mov    (%rax),%rdi
+    1f5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f63:	48 8b 30             	mov    (%rax),%rsi
+    1f66:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f6d:	48 83 ec 08          	sub    $0x8,%rsp
+    1f71:	51                   	push   %rcx
+    1f72:	49 89 f9             	mov    %rdi,%r9
+    1f75:	49 89 f0             	mov    %rsi,%r8
+    1f78:	89 d1                	mov    %edx,%ecx
+    1f7a:	48 89 c2             	mov    %rax,%rdx
+    1f7d:	48 8d 05 f4 00 00 00 	lea    0xf4(%rip),%rax        # 2078 <benchreport+0x21d>
+    1f84:	48 89 c6             	mov    %rax,%rsi
+    1f87:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f91:	e8 f8 e3 ff ff       	call   38e <printf>
+    1f96:	48 83 c4 10          	add    $0x10,%rsp
+    1f9a:	eb 01                	jmp    1f9d <benchreport+0x142>
+    return;
+    1f9c:	90                   	nop
+}
+    1f9d:	c9                   	leave
+    1f9e:	c3                   	ret
@@ -0,0 +1,4491 @@
+
+out/user/_fsbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <rdtsc>:
+static char *buf;
+static int filesize;
+static struct sys_info before, after;
+static int t0;
+
+static uint64_t rdtsc(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+       4:	0f 31                	rdtsc
+       6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+       9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+       c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+       f:	48 c1 e0 20          	shl    $0x20,%rax
+      13:	48 89 c2             	mov    %rax,%rdx
+      16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      19:	48 09 d0             	or     %rdx,%rax
+}
+      1c:	5d                   	pop    %rbp
+      1d:	c3                   	ret
+
+000000000000001e <random>:
+
+static uint rnd = 1;
+
+static uint random(void) {
+      1e:	55                   	push   %rbp
+      1f:	48 89 e5             	mov    %rsp,%rbp
+  rnd = rnd * 1103515245 + 12345;
+      22:	8b 05 d8 3f 00 00    	mov    0x3fd8(%rip),%eax        # 4000 <rnd>
+      28:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+      2e:	05 39 30 00 00       	add    $0x3039,%eax
+      33:	89 05 c7 3f 00 00    	mov    %eax,0x3fc7(%rip)        # 4000 <rnd>
+  return rnd >> 8;
+      39:	8b 05 c1 3f 00 00    	mov    0x3fc1(%rip),%eax        # 4000 <rnd>
+      3f:	c1 e8 08             	shr    $0x8,%eax
+}
+      42:	5d                   	pop    %rbp
+      43:	c3                   	ret
+
+0000000000000044 <start>:
+
+static void start(void) {
+      44:	55                   	push   %rbp
+      45:	48 89 e5             	mov    %rsp,%rbp
+  sysinfo(&before);
+      48:	48 8d 05 d1 40 00 00 	lea    0x40d1(%rip),%rax        # 4120 <before>
+      4f:	48 89 c7             	mov    %rax,%rdi
+      52:	e8 69 1f 00 00       	call   1fc0 <sysinfo>
+  t0 = uptime();
+      57:	e8 59 1f 00 00       	call   1fb5 <uptime>
+      5c:	89 05 f6 46 00 00    	mov    %eax,0x46f6(%rip)        # 4758 <t0>
+}
+      62:	90                   	nop
+      63:	5d                   	pop    %rbp
+      64:	c3                   	ret
+
+0000000000000065 <stop>:
+
+// Report n operations moving bytes bytes since start().
+static void stop(char *name, int iosize, int n, uint64_t bytes) {
+      65:	55                   	push   %rbp
+      66:	48 89 e5             	mov    %rsp,%rbp
+      69:	48 83 ec 30          	sub    $0x30,%rsp
+      6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+      71:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+      74:	89 55 e0             	mov    %edx,-0x20(%rbp)
+      77:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+  int ticks;
+
+  ticks = uptime() - t0;
+      7b:	e8 35 1f 00 00       	call   1fb5 <uptime>
+      80:	89 c2                	mov    %eax,%edx
+      82:	8b 05 d0 46 00 00    	mov    0x46d0(%rip),%eax        # 4758 <t0>
+      88:	29 c2                	sub    %eax,%edx
+      8a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+  sysinfo(&after);
+      8d:	48 8d 05 ac 43 00 00 	lea    0x43ac(%rip),%rax        # 4440 <after>
+      94:	48 89 c7             	mov    %rax,%rdi
+      97:	e8 24 1f 00 00       	call   1fc0 <sysinfo>
+  printf(1, "%s", name);
+      9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      a0:	48 89 c2             	mov    %rax,%rdx
+      a3:	48 8d 05 9e 29 00 00 	lea    0x299e(%rip),%rax        # 2a48 <benchreport+0x14b>
+      aa:	48 89 c6             	mov    %rax,%rsi
+      ad:	bf 01 00 00 00       	mov    $0x1,%edi
+      b2:	b8 00 00 00 00       	mov    $0x0,%eax
+      b7:	e8 74 0d 00 00       	call   e30 <printf>
+  if (iosize > 0)
+      bc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+      c0:	7e 1e                	jle    e0 <stop+0x7b>
+    printf(1, " %d", iosize);
+      c2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      c5:	89 c2                	mov    %eax,%edx
+      c7:	48 8d 05 7d 29 00 00 	lea    0x297d(%rip),%rax        # 2a4b <benchreport+0x14e>
+      ce:	48 89 c6             	mov    %rax,%rsi
+      d1:	bf 01 00 00 00       	mov    $0x1,%edi
+      d6:	b8 00 00 00 00       	mov    $0x0,%eax
+      db:	e8 50 0d 00 00       	call   e30 <printf>
+  printf(1, ": %d ops %d ticks", n, ticks);
+      e0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      e3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      e6:	89 d1                	mov    %edx,%ecx
+      e8:	89 c2                	mov    %eax,%edx
+      ea:	48 8d 05 5e 29 00 00 	lea    0x295e(%rip),%rax        # 2a4f <benchreport+0x152>
+      f1:	48 89 c6             	mov    %rax,%rsi
+      f4:	bf 01 00 00 00       	mov    $0x1,%edi
+      f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fe:	e8 2d 0d 00 00       	call   e30 <printf>
+  if (ticks > 0) {
+     103:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     107:	0f 8e a5 00 00 00    	jle    1b2 <stop+0x14d>
+    printf(1, " %d ops/s", (int)((uint64_t)n * HZ / ticks));
+     10d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     110:	48 63 d0             	movslq %eax,%rdx
+     113:	48 89 d0             	mov    %rdx,%rax
+     116:	48 c1 e0 02          	shl    $0x2,%rax
+     11a:	48 01 d0             	add    %rdx,%rax
+     11d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     124:	00 
+     125:	48 01 d0             	add    %rdx,%rax
+     128:	48 c1 e0 02          	shl    $0x2,%rax
+     12c:	48 89 c1             	mov    %rax,%rcx
+     12f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     132:	48 63 f0             	movslq %eax,%rsi
+     135:	48 89 c8             	mov    %rcx,%rax
+     138:	ba 00 00 00 00       	mov    $0x0,%edx
+     13d:	48 f7 f6             	div    %rsi
+     140:	89 c2                	mov    %eax,%edx
+     142:	48 8d 05 18 29 00 00 	lea    0x2918(%rip),%rax        # 2a61 <benchreport+0x164>
+     149:	48 89 c6             	mov    %rax,%rsi
+     14c:	bf 01 00 00 00       	mov    $0x1,%edi
+     151:	b8 00 00 00 00       	mov    $0x0,%eax
+     156:	e8 d5 0c 00 00       	call   e30 <printf>
+    if (bytes > 0)
+     15b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     160:	74 50                	je     1b2 <stop+0x14d>
+      printf(1, " %d KB/s", (int)(bytes * HZ / ticks / 1024));
+     162:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     166:	48 89 d0             	mov    %rdx,%rax
+     169:	48 c1 e0 02          	shl    $0x2,%rax
+     16d:	48 01 d0             	add    %rdx,%rax
+     170:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     177:	00 
+     178:	48 01 d0             	add    %rdx,%rax
+     17b:	48 c1 e0 02          	shl    $0x2,%rax
+     17f:	48 89 c1             	mov    %rax,%rcx
+     182:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     185:	48 63 f8             	movslq %eax,%rdi
+     188:	48 89 c8             	mov    %rcx,%rax
+     18b:	ba 00 00 00 00       	mov    $0x0,%edx
+     190:	48 f7 f7             	div    %rdi
+     193:	48 c1 e8 0a          	shr    $0xa,%rax
+     197:	89 c2                	mov    %eax,%edx
+     199:	48 8d 05 cb 28 00 00 	lea    0x28cb(%rip),%rax        # 2a6b <benchreport+0x16e>
+     1a0:	48 89 c6             	mov    %rax,%rsi
+     1a3:	bf 01 00 00 00       	mov    $0x1,%edi
+     1a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ad:	e8 7e 0c 00 00       	call   e30 <printf>
+         after.disk_writes - before.disk_writes,
+         after.disk_requests - before.disk_requests,
+         after.log_commits - before.log_commits,
+         after.log_blocks - before.log_blocks,
+         after.bcache_hits - before.bcache_hits,
+         after.bcache_misses - before.bcache_misses);
+     1b2:	8b 15 c4 42 00 00    	mov    0x42c4(%rip),%edx        # 447c <after+0x3c>
+     1b8:	8b 05 9e 3f 00 00    	mov    0x3f9e(%rip),%eax        # 415c <before+0x3c>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     1be:	29 c2                	sub    %eax,%edx
+     1c0:	41 89 d0             	mov    %edx,%r8d
+         after.bcache_hits - before.bcache_hits,
+     1c3:	8b 15 af 42 00 00    	mov    0x42af(%rip),%edx        # 4478 <after+0x38>
+     1c9:	8b 05 89 3f 00 00    	mov    0x3f89(%rip),%eax        # 4158 <before+0x38>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     1cf:	89 d7                	mov    %edx,%edi
+     1d1:	29 c7                	sub    %eax,%edi
+         after.log_blocks - before.log_blocks,
+     1d3:	48 8b 15 0e 43 00 00 	mov    0x430e(%rip),%rdx        # 44e8 <after+0xa8>
+     1da:	48 8b 05 e7 3f 00 00 	mov    0x3fe7(%rip),%rax        # 41c8 <before+0xa8>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     1e1:	48 89 d6             	mov    %rdx,%rsi
+     1e4:	48 29 c6             	sub    %rax,%rsi
+         after.log_commits - before.log_commits,
+     1e7:	48 8b 15 f2 42 00 00 	mov    0x42f2(%rip),%rdx        # 44e0 <after+0xa0>
+     1ee:	48 8b 05 cb 3f 00 00 	mov    0x3fcb(%rip),%rax        # 41c0 <before+0xa0>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     1f5:	48 29 c2             	sub    %rax,%rdx
+     1f8:	49 89 d1             	mov    %rdx,%r9
+         after.disk_requests - before.disk_requests,
+     1fb:	48 8b 15 d6 42 00 00 	mov    0x42d6(%rip),%rdx        # 44d8 <after+0x98>
+     202:	48 8b 05 af 3f 00 00 	mov    0x3faf(%rip),%rax        # 41b8 <before+0x98>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     209:	48 29 c2             	sub    %rax,%rdx
+     20c:	49 89 d2             	mov    %rdx,%r10
+         after.disk_writes - before.disk_writes,
+     20f:	48 8b 15 ba 42 00 00 	mov    0x42ba(%rip),%rdx        # 44d0 <after+0x90>
+     216:	48 8b 05 93 3f 00 00 	mov    0x3f93(%rip),%rax        # 41b0 <before+0x90>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     21d:	48 29 c2             	sub    %rax,%rdx
+         after.disk_reads - before.disk_reads,
+     220:	48 8b 05 a1 42 00 00 	mov    0x42a1(%rip),%rax        # 44c8 <after+0x88>
+     227:	48 8b 0d 7a 3f 00 00 	mov    0x3f7a(%rip),%rcx        # 41a8 <before+0x88>
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+     22e:	48 29 c8             	sub    %rcx,%rax
+     231:	48 83 ec 08          	sub    $0x8,%rsp
+     235:	41 50                	push   %r8
+     237:	57                   	push   %rdi
+     238:	56                   	push   %rsi
+     239:	4d 89 d0             	mov    %r10,%r8
+     23c:	48 89 d1             	mov    %rdx,%rcx
+     23f:	48 89 c2             	mov    %rax,%rdx
+     242:	48 8d 05 2f 28 00 00 	lea    0x282f(%rip),%rax        # 2a78 <benchreport+0x17b>
+     249:	48 89 c6             	mov    %rax,%rsi
+     24c:	bf 01 00 00 00       	mov    $0x1,%edi
+     251:	b8 00 00 00 00       	mov    $0x0,%eax
+     256:	e8 d5 0b 00 00       	call   e30 <printf>
+     25b:	48 83 c4 20          	add    $0x20,%rsp
+}
+     25f:	90                   	nop
+     260:	c9                   	leave
+     261:	c3                   	ret
+
+0000000000000262 <create>:
+
+static int create(char *path) {
+     262:	55                   	push   %rbp
+     263:	48 89 e5             	mov    %rsp,%rbp
+     266:	48 83 ec 20          	sub    $0x20,%rsp
+     26a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int fd;
+
+  unlink(path);
+     26e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     272:	48 89 c7             	mov    %rax,%rdi
+     275:	e8 d8 1c 00 00       	call   1f52 <unlink>
+  if ((fd = open(path, O_CREATE | O_RDWR)) < 0) {
+     27a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     27e:	be 02 02 00 00       	mov    $0x202,%esi
+     283:	48 89 c7             	mov    %rax,%rdi
+     286:	e8 b1 1c 00 00       	call   1f3c <open>
+     28b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     28e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     292:	79 25                	jns    2b9 <create+0x57>
+    printf(2, "fsbench: cannot create %s\n", path);
+     294:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     298:	48 89 c2             	mov    %rax,%rdx
+     29b:	48 8d 05 27 28 00 00 	lea    0x2827(%rip),%rax        # 2ac9 <benchreport+0x1cc>
+     2a2:	48 89 c6             	mov    %rax,%rsi
+     2a5:	bf 02 00 00 00       	mov    $0x2,%edi
+     2aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     2af:	e8 7c 0b 00 00       	call   e30 <printf>
+    exit();
+     2b4:	e8 a7 11 00 00       	call   1460 <exit>
+  }
+  return fd;
+     2b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     2bc:	c9                   	leave
+     2bd:	c3                   	ret
+
+00000000000002be <seqwrite>:
+
+static void seqwrite(void) {
+     2be:	55                   	push   %rbp
+     2bf:	48 89 e5             	mov    %rsp,%rbp
+     2c2:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, n, sizes[] = {512, 4096, MAXIO};
+     2c6:	c7 45 e8 00 02 00 00 	movl   $0x200,-0x18(%rbp)
+     2cd:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+     2d4:	c7 45 f0 00 80 00 00 	movl   $0x8000,-0x10(%rbp)
+
+  for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+     2db:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     2e2:	e9 c7 00 00 00       	jmp    3ae <seqwrite+0xf0>
+    fd = create("fsb.seq");
+     2e7:	48 8d 05 f6 27 00 00 	lea    0x27f6(%rip),%rax        # 2ae4 <benchreport+0x1e7>
+     2ee:	48 89 c7             	mov    %rax,%rdi
+     2f1:	e8 6c ff ff ff       	call   262 <create>
+     2f6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    start();
+     2f9:	e8 46 fd ff ff       	call   44 <start>
+    for (n = 0; n * sizes[i] < filesize; n++)
+     2fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     305:	eb 4b                	jmp    352 <seqwrite+0x94>
+      if (write(fd, buf, sizes[i]) != sizes[i]) {
+     307:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     30a:	48 98                	cltq
+     30c:	8b 54 85 e8          	mov    -0x18(%rbp,%rax,4),%edx
+     310:	48 8b 0d e9 3d 00 00 	mov    0x3de9(%rip),%rcx        # 4100 <buf>
+     317:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     31a:	48 89 ce             	mov    %rcx,%rsi
+     31d:	89 c7                	mov    %eax,%edi
+     31f:	e8 ec 1b 00 00       	call   1f10 <write>
+     324:	89 c2                	mov    %eax,%edx
+     326:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     329:	48 98                	cltq
+     32b:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+     32f:	39 c2                	cmp    %eax,%edx
+     331:	74 1b                	je     34e <seqwrite+0x90>
+        printf(2, "fsbench: write failed\n");
+     333:	48 8d 05 b2 27 00 00 	lea    0x27b2(%rip),%rax        # 2aec <benchreport+0x1ef>
+     33a:	48 89 c6             	mov    %rax,%rsi
+     33d:	bf 02 00 00 00       	mov    $0x2,%edi
+     342:	b8 00 00 00 00       	mov    $0x0,%eax
+     347:	e8 e4 0a 00 00       	call   e30 <printf>
+        break;
+     34c:	eb 1d                	jmp    36b <seqwrite+0xad>
+    for (n = 0; n * sizes[i] < filesize; n++)
+     34e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     352:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     355:	48 98                	cltq
+     357:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+     35b:	0f af 45 fc          	imul   -0x4(%rbp),%eax
+     35f:	89 c2                	mov    %eax,%edx
+     361:	8b 05 a1 3d 00 00    	mov    0x3da1(%rip),%eax        # 4108 <filesize>
+     367:	39 c2                	cmp    %eax,%edx
+     369:	7c 9c                	jl     307 <seqwrite+0x49>
+      }
+    close(fd);
+     36b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     36e:	89 c7                	mov    %eax,%edi
+     370:	e8 55 11 00 00       	call   14ca <close>
+    stop("seqwrite", sizes[i], n, (uint64_t)n * sizes[i]);
+     375:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     378:	48 63 d0             	movslq %eax,%rdx
+     37b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     37e:	48 98                	cltq
+     380:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+     384:	48 98                	cltq
+     386:	48 89 d1             	mov    %rdx,%rcx
+     389:	48 0f af c8          	imul   %rax,%rcx
+     38d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     390:	48 98                	cltq
+     392:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+     396:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     399:	89 c6                	mov    %eax,%esi
+     39b:	48 8d 05 61 27 00 00 	lea    0x2761(%rip),%rax        # 2b03 <benchreport+0x206>
+     3a2:	48 89 c7             	mov    %rax,%rdi
+     3a5:	e8 bb fc ff ff       	call   65 <stop>
+  for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+     3aa:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     3ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3b1:	83 f8 02             	cmp    $0x2,%eax
+     3b4:	0f 86 2d ff ff ff    	jbe    2e7 <seqwrite+0x29>
+  }
+}
+     3ba:	90                   	nop
+     3bb:	90                   	nop
+     3bc:	c9                   	leave
+     3bd:	c3                   	ret
+
+00000000000003be <seqread>:
+
+static void seqread(void) {
+     3be:	55                   	push   %rbp
+     3bf:	48 89 e5             	mov    %rsp,%rbp
+     3c2:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, n, r, sizes[] = {512, 4096, MAXIO};
+     3c6:	c7 45 e4 00 02 00 00 	movl   $0x200,-0x1c(%rbp)
+     3cd:	c7 45 e8 00 10 00 00 	movl   $0x1000,-0x18(%rbp)
+     3d4:	c7 45 ec 00 80 00 00 	movl   $0x8000,-0x14(%rbp)
+
+  for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+     3db:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     3e2:	e9 b6 00 00 00       	jmp    49d <seqread+0xdf>
+    if ((fd = open("fsb.seq", O_RDONLY)) < 0) {
+     3e7:	be 00 00 00 00       	mov    $0x0,%esi
+     3ec:	48 8d 05 f1 26 00 00 	lea    0x26f1(%rip),%rax        # 2ae4 <benchreport+0x1e7>
+     3f3:	48 89 c7             	mov    %rax,%rdi
+     3f6:	e8 41 1b 00 00       	call   1f3c <open>
+     3fb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     3fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     402:	79 1e                	jns    422 <seqread+0x64>
+      printf(2, "fsbench: seqread needs seqwrite's file\n");
+     404:	48 8d 05 05 27 00 00 	lea    0x2705(%rip),%rax        # 2b10 <benchreport+0x213>
+     40b:	48 89 c6             	mov    %rax,%rsi
+     40e:	bf 02 00 00 00       	mov    $0x2,%edi
+     413:	b8 00 00 00 00       	mov    $0x0,%eax
+     418:	e8 13 0a 00 00       	call   e30 <printf>
+     41d:	e9 87 00 00 00       	jmp    4a9 <seqread+0xeb>
+      return;
+    }
+    start();
+     422:	e8 1d fc ff ff       	call   44 <start>
+    for (n = 0; (r = read(fd, buf, sizes[i])) > 0; n++)
+     427:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     42e:	eb 04                	jmp    434 <seqread+0x76>
+     430:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     434:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     437:	48 98                	cltq
+     439:	8b 54 85 e4          	mov    -0x1c(%rbp,%rax,4),%edx
+     43d:	48 8b 0d bc 3c 00 00 	mov    0x3cbc(%rip),%rcx        # 4100 <buf>
+     444:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     447:	48 89 ce             	mov    %rcx,%rsi
+     44a:	89 c7                	mov    %eax,%edi
+     44c:	e8 b4 1a 00 00       	call   1f05 <read>
+     451:	89 45 f0             	mov    %eax,-0x10(%rbp)
+     454:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     458:	7f d6                	jg     430 <seqread+0x72>
+      ;
+    close(fd);
+     45a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     45d:	89 c7                	mov    %eax,%edi
+     45f:	e8 66 10 00 00       	call   14ca <close>
+    stop("seqread", sizes[i], n, (uint64_t)n * sizes[i]);
+     464:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     467:	48 63 d0             	movslq %eax,%rdx
+     46a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     46d:	48 98                	cltq
+     46f:	8b 44 85 e4          	mov    -0x1c(%rbp,%rax,4),%eax
+     473:	48 98                	cltq
+     475:	48 89 d1             	mov    %rdx,%rcx
+     478:	48 0f af c8          	imul   %rax,%rcx
+     47c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     47f:	48 98                	cltq
+     481:	8b 44 85 e4          	mov    -0x1c(%rbp,%rax,4),%eax
+     485:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     488:	89 c6                	mov    %eax,%esi
+     48a:	48 8d 05 a7 26 00 00 	lea    0x26a7(%rip),%rax        # 2b38 <benchreport+0x23b>
+     491:	48 89 c7             	mov    %rax,%rdi
+     494:	e8 cc fb ff ff       	call   65 <stop>
+  for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+     499:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     49d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4a0:	83 f8 02             	cmp    $0x2,%eax
+     4a3:	0f 86 3e ff ff ff    	jbe    3e7 <seqread+0x29>
+  }
+}
+     4a9:	c9                   	leave
+     4aa:	c3                   	ret
+
+00000000000004ab <randio>:
+
+static void randio(int writing) {
+     4ab:	55                   	push   %rbp
+     4ac:	48 89 e5             	mov    %rsp,%rbp
+     4af:	48 83 ec 20          	sub    $0x20,%rsp
+     4b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int fd, n, nblocks;
+
+  if ((fd = open("fsb.seq", O_RDWR)) < 0) {
+     4b6:	be 02 00 00 00       	mov    $0x2,%esi
+     4bb:	48 8d 05 22 26 00 00 	lea    0x2622(%rip),%rax        # 2ae4 <benchreport+0x1e7>
+     4c2:	48 89 c7             	mov    %rax,%rdi
+     4c5:	e8 72 1a 00 00       	call   1f3c <open>
+     4ca:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     4cd:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     4d1:	79 1e                	jns    4f1 <randio+0x46>
+    printf(2, "fsbench: random I/O needs seqwrite's file\n");
+     4d3:	48 8d 05 66 26 00 00 	lea    0x2666(%rip),%rax        # 2b40 <benchreport+0x243>
+     4da:	48 89 c6             	mov    %rax,%rsi
+     4dd:	bf 02 00 00 00       	mov    $0x2,%edi
+     4e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e7:	e8 44 09 00 00       	call   e30 <printf>
+    return;
+     4ec:	e9 d1 00 00 00       	jmp    5c2 <randio+0x117>
+  }
+  nblocks = filesize / 4096;
+     4f1:	8b 05 11 3c 00 00    	mov    0x3c11(%rip),%eax        # 4108 <filesize>
+     4f7:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+     4fd:	85 c0                	test   %eax,%eax
+     4ff:	0f 48 c2             	cmovs  %edx,%eax
+     502:	c1 f8 0c             	sar    $0xc,%eax
+     505:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  start();
+     508:	e8 37 fb ff ff       	call   44 <start>
+  for (n = 0; n < nblocks; n++) {
+     50d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     514:	eb 68                	jmp    57e <randio+0xd3>
+    if (writing)
+     516:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     51a:	74 30                	je     54c <randio+0xa1>
+      pwrite(fd, buf, 4096, random() % nblocks * 4096);
+     51c:	e8 fd fa ff ff       	call   1e <random>
+     521:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     524:	ba 00 00 00 00       	mov    $0x0,%edx
+     529:	f7 f1                	div    %ecx
+     52b:	89 d0                	mov    %edx,%eax
+     52d:	c1 e0 0c             	shl    $0xc,%eax
+     530:	89 c2                	mov    %eax,%edx
+     532:	48 8b 35 c7 3b 00 00 	mov    0x3bc7(%rip),%rsi        # 4100 <buf>
+     539:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     53c:	89 d1                	mov    %edx,%ecx
+     53e:	ba 00 10 00 00       	mov    $0x1000,%edx
+     543:	89 c7                	mov    %eax,%edi
+     545:	e8 c3 1a 00 00       	call   200d <pwrite>
+     54a:	eb 2e                	jmp    57a <randio+0xcf>
+    else
+      pread(fd, buf, 4096, random() % nblocks * 4096);
+     54c:	e8 cd fa ff ff       	call   1e <random>
+     551:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     554:	ba 00 00 00 00       	mov    $0x0,%edx
+     559:	f7 f1                	div    %ecx
+     55b:	89 d0                	mov    %edx,%eax
+     55d:	c1 e0 0c             	shl    $0xc,%eax
+     560:	89 c2                	mov    %eax,%edx
+     562:	48 8b 35 97 3b 00 00 	mov    0x3b97(%rip),%rsi        # 4100 <buf>
+     569:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     56c:	89 d1                	mov    %edx,%ecx
+     56e:	ba 00 10 00 00       	mov    $0x1000,%edx
+     573:	89 c7                	mov    %eax,%edi
+     575:	e8 88 1a 00 00       	call   2002 <pread>
+  for (n = 0; n < nblocks; n++) {
+     57a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     57e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     581:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+     584:	7c 90                	jl     516 <randio+0x6b>
+  }
+  close(fd);
+     586:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     589:	89 c7                	mov    %eax,%edi
+     58b:	e8 3a 0f 00 00       	call   14ca <close>
+  stop(writing ? "randwrite" : "randread", 4096, n, (uint64_t)n * 4096);
+     590:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     593:	48 98                	cltq
+     595:	48 c1 e0 0c          	shl    $0xc,%rax
+     599:	48 89 c1             	mov    %rax,%rcx
+     59c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     5a0:	74 09                	je     5ab <randio+0x100>
+     5a2:	48 8d 05 c2 25 00 00 	lea    0x25c2(%rip),%rax        # 2b6b <benchreport+0x26e>
+     5a9:	eb 07                	jmp    5b2 <randio+0x107>
+     5ab:	48 8d 05 c3 25 00 00 	lea    0x25c3(%rip),%rax        # 2b75 <benchreport+0x278>
+     5b2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     5b5:	be 00 10 00 00       	mov    $0x1000,%esi
+     5ba:	48 89 c7             	mov    %rax,%rdi
+     5bd:	e8 a3 fa ff ff       	call   65 <stop>
+}
+     5c2:	c9                   	leave
+     5c3:	c3                   	ret
+
+00000000000005c4 <randwrite>:
+
+static void randwrite(void) { randio(1); }
+     5c4:	55                   	push   %rbp
+     5c5:	48 89 e5             	mov    %rsp,%rbp
+     5c8:	bf 01 00 00 00       	mov    $0x1,%edi
+     5cd:	e8 d9 fe ff ff       	call   4ab <randio>
+     5d2:	90                   	nop
+     5d3:	5d                   	pop    %rbp
+     5d4:	c3                   	ret
+
+00000000000005d5 <randread>:
+static void randread(void) { randio(0); }
+     5d5:	55                   	push   %rbp
+     5d6:	48 89 e5             	mov    %rsp,%rbp
+     5d9:	bf 00 00 00 00       	mov    $0x0,%edi
+     5de:	e8 c8 fe ff ff       	call   4ab <randio>
+     5e3:	90                   	nop
+     5e4:	5d                   	pop    %rbp
+     5e5:	c3                   	ret
+
+00000000000005e6 <name>:
+
+static void name(char *path, int i) {
+     5e6:	55                   	push   %rbp
+     5e7:	48 89 e5             	mov    %rsp,%rbp
+     5ea:	48 83 ec 10          	sub    $0x10,%rsp
+     5ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     5f2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  strcpy(path, "fsb.f000");
+     5f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5f9:	48 8d 15 7e 25 00 00 	lea    0x257e(%rip),%rdx        # 2b7e <benchreport+0x281>
+     600:	48 89 d6             	mov    %rdx,%rsi
+     603:	48 89 c7             	mov    %rax,%rdi
+     606:	e8 19 11 00 00       	call   1724 <strcpy>
+  path[5] += i / 100 % 10;
+     60b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     60f:	48 83 c0 05          	add    $0x5,%rax
+     613:	0f b6 00             	movzbl (%rax),%eax
+     616:	89 c6                	mov    %eax,%esi
+     618:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     61b:	48 63 d0             	movslq %eax,%rdx
+     61e:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+     625:	48 c1 ea 20          	shr    $0x20,%rdx
+     629:	c1 fa 05             	sar    $0x5,%edx
+     62c:	c1 f8 1f             	sar    $0x1f,%eax
+     62f:	89 d1                	mov    %edx,%ecx
+     631:	29 c1                	sub    %eax,%ecx
+     633:	48 63 c1             	movslq %ecx,%rax
+     636:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+     63d:	48 c1 e8 20          	shr    $0x20,%rax
+     641:	89 c2                	mov    %eax,%edx
+     643:	c1 fa 02             	sar    $0x2,%edx
+     646:	89 c8                	mov    %ecx,%eax
+     648:	c1 f8 1f             	sar    $0x1f,%eax
+     64b:	29 c2                	sub    %eax,%edx
+     64d:	89 d0                	mov    %edx,%eax
+     64f:	c1 e0 02             	shl    $0x2,%eax
+     652:	01 d0                	add    %edx,%eax
+     654:	01 c0                	add    %eax,%eax
+     656:	29 c1                	sub    %eax,%ecx
+     658:	89 ca                	mov    %ecx,%edx
+     65a:	89 d0                	mov    %edx,%eax
+     65c:	8d 14 06             	lea    (%rsi,%rax,1),%edx
+     65f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     663:	48 83 c0 05          	add    $0x5,%rax
+     667:	88 10                	mov    %dl,(%rax)
+  path[6] += i / 10 % 10;
+     669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     66d:	48 83 c0 06          	add    $0x6,%rax
+     671:	0f b6 00             	movzbl (%rax),%eax
+     674:	89 c6                	mov    %eax,%esi
+     676:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     679:	48 63 d0             	movslq %eax,%rdx
+     67c:	48 69 d2 67 66 66 66 	imul   $0x66666667,%rdx,%rdx
+     683:	48 c1 ea 20          	shr    $0x20,%rdx
+     687:	c1 fa 02             	sar    $0x2,%edx
+     68a:	c1 f8 1f             	sar    $0x1f,%eax
+     68d:	89 d1                	mov    %edx,%ecx
+     68f:	29 c1                	sub    %eax,%ecx
+     691:	48 63 c1             	movslq %ecx,%rax
+     694:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+     69b:	48 c1 e8 20          	shr    $0x20,%rax
+     69f:	89 c2                	mov    %eax,%edx
+     6a1:	c1 fa 02             	sar    $0x2,%edx
+     6a4:	89 c8                	mov    %ecx,%eax
+     6a6:	c1 f8 1f             	sar    $0x1f,%eax
+     6a9:	29 c2                	sub    %eax,%edx
+     6ab:	89 d0                	mov    %edx,%eax
+     6ad:	c1 e0 02             	shl    $0x2,%eax
+     6b0:	01 d0                	add    %edx,%eax
+     6b2:	01 c0                	add    %eax,%eax
+     6b4:	29 c1                	sub    %eax,%ecx
+     6b6:	89 ca                	mov    %ecx,%edx
+     6b8:	89 d0                	mov    %edx,%eax
+     6ba:	8d 14 06             	lea    (%rsi,%rax,1),%edx
+     6bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6c1:	48 83 c0 06          	add    $0x6,%rax
+     6c5:	88 10                	mov    %dl,(%rax)
+  path[7] += i % 10;
+     6c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6cb:	48 83 c0 07          	add    $0x7,%rax
+     6cf:	0f b6 00             	movzbl (%rax),%eax
+     6d2:	89 c6                	mov    %eax,%esi
+     6d4:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     6d7:	48 63 c1             	movslq %ecx,%rax
+     6da:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+     6e1:	48 c1 e8 20          	shr    $0x20,%rax
+     6e5:	89 c2                	mov    %eax,%edx
+     6e7:	c1 fa 02             	sar    $0x2,%edx
+     6ea:	89 c8                	mov    %ecx,%eax
+     6ec:	c1 f8 1f             	sar    $0x1f,%eax
+     6ef:	29 c2                	sub    %eax,%edx
+     6f1:	89 d0                	mov    %edx,%eax
+     6f3:	c1 e0 02             	shl    $0x2,%eax
+     6f6:	01 d0                	add    %edx,%eax
+     6f8:	01 c0                	add    %eax,%eax
+     6fa:	29 c1                	sub    %eax,%ecx
+     6fc:	89 ca                	mov    %ecx,%edx
+     6fe:	89 d0                	mov    %edx,%eax
+     700:	8d 14 06             	lea    (%rsi,%rax,1),%edx
+     703:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     707:	48 83 c0 07          	add    $0x7,%rax
+     70b:	88 10                	mov    %dl,(%rax)
+}
+     70d:	90                   	nop
+     70e:	c9                   	leave
+     70f:	c3                   	ret
+
+0000000000000710 <creates>:
+
+static void creates(void) {
+     710:	55                   	push   %rbp
+     711:	48 89 e5             	mov    %rsp,%rbp
+     714:	48 83 ec 20          	sub    $0x20,%rsp
+  char path[16];
+  int i;
+
+  start();
+     718:	e8 27 f9 ff ff       	call   44 <start>
+  for (i = 0; i < NFILES; i++) {
+     71d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     724:	eb 28                	jmp    74e <creates+0x3e>
+    name(path, i);
+     726:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     729:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+     72d:	89 d6                	mov    %edx,%esi
+     72f:	48 89 c7             	mov    %rax,%rdi
+     732:	e8 af fe ff ff       	call   5e6 <name>
+    close(create(path));
+     737:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+     73b:	48 89 c7             	mov    %rax,%rdi
+     73e:	e8 1f fb ff ff       	call   262 <create>
+     743:	89 c7                	mov    %eax,%edi
+     745:	e8 80 0d 00 00       	call   14ca <close>
+  for (i = 0; i < NFILES; i++) {
+     74a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     74e:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     755:	7e cf                	jle    726 <creates+0x16>
+  }
+  stop("create", 0, NFILES, 0);
+     757:	b9 00 00 00 00       	mov    $0x0,%ecx
+     75c:	ba c8 00 00 00       	mov    $0xc8,%edx
+     761:	be 00 00 00 00       	mov    $0x0,%esi
+     766:	48 8d 05 1a 24 00 00 	lea    0x241a(%rip),%rax        # 2b87 <benchreport+0x28a>
+     76d:	48 89 c7             	mov    %rax,%rdi
+     770:	e8 f0 f8 ff ff       	call   65 <stop>
+}
+     775:	90                   	nop
+     776:	c9                   	leave
+     777:	c3                   	ret
+
+0000000000000778 <unlinks>:
+
+static void unlinks(void) {
+     778:	55                   	push   %rbp
+     779:	48 89 e5             	mov    %rsp,%rbp
+     77c:	48 83 ec 20          	sub    $0x20,%rsp
+  char path[16];
+  int i;
+
+  start();
+     780:	e8 bf f8 ff ff       	call   44 <start>
+  for (i = 0; i < NFILES; i++) {
+     785:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     78c:	eb 40                	jmp    7ce <unlinks+0x56>
+    name(path, i);
+     78e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     791:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+     795:	89 d6                	mov    %edx,%esi
+     797:	48 89 c7             	mov    %rax,%rdi
+     79a:	e8 47 fe ff ff       	call   5e6 <name>
+    if (unlink(path) < 0) {
+     79f:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+     7a3:	48 89 c7             	mov    %rax,%rdi
+     7a6:	e8 a7 17 00 00       	call   1f52 <unlink>
+     7ab:	85 c0                	test   %eax,%eax
+     7ad:	79 1b                	jns    7ca <unlinks+0x52>
+      printf(2, "fsbench: unlink needs create's files\n");
+     7af:	48 8d 05 da 23 00 00 	lea    0x23da(%rip),%rax        # 2b90 <benchreport+0x293>
+     7b6:	48 89 c6             	mov    %rax,%rsi
+     7b9:	bf 02 00 00 00       	mov    $0x2,%edi
+     7be:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c3:	e8 68 06 00 00       	call   e30 <printf>
+     7c8:	eb 2b                	jmp    7f5 <unlinks+0x7d>
+  for (i = 0; i < NFILES; i++) {
+     7ca:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     7ce:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     7d5:	7e b7                	jle    78e <unlinks+0x16>
+      return;
+    }
+  }
+  stop("unlink", 0, NFILES, 0);
+     7d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+     7dc:	ba c8 00 00 00       	mov    $0xc8,%edx
+     7e1:	be 00 00 00 00       	mov    $0x0,%esi
+     7e6:	48 8d 05 c9 23 00 00 	lea    0x23c9(%rip),%rax        # 2bb6 <benchreport+0x2b9>
+     7ed:	48 89 c7             	mov    %rax,%rdi
+     7f0:	e8 70 f8 ff ff       	call   65 <stop>
+}
+     7f5:	c9                   	leave
+     7f6:	c3                   	ret
+
+00000000000007f7 <appends>:
+
+static void appends(int sync) {
+     7f7:	55                   	push   %rbp
+     7f8:	48 89 e5             	mov    %rsp,%rbp
+     7fb:	48 83 ec 40          	sub    $0x40,%rsp
+     7ff:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  uint64_t t, total, worst;
+  int fd, i;
+
+  fd = create("fsb.app");
+     802:	48 8d 05 b4 23 00 00 	lea    0x23b4(%rip),%rax        # 2bbd <benchreport+0x2c0>
+     809:	48 89 c7             	mov    %rax,%rdi
+     80c:	e8 51 fa ff ff       	call   262 <create>
+     811:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  total = worst = 0;
+     814:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+     81b:	00 
+     81c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     820:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  start();
+     824:	e8 1b f8 ff ff       	call   44 <start>
+  for (i = 0; i < NAPPEND; i++) {
+     829:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     830:	eb 6e                	jmp    8a0 <appends+0xa9>
+    t = rdtsc();
+     832:	e8 c9 f7 ff ff       	call   0 <rdtsc>
+     837:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    write(fd, buf, APPENDSIZE);
+     83b:	48 8b 0d be 38 00 00 	mov    0x38be(%rip),%rcx        # 4100 <buf>
+     842:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     845:	ba 40 00 00 00       	mov    $0x40,%edx
+     84a:	48 89 ce             	mov    %rcx,%rsi
+     84d:	89 c7                	mov    %eax,%edi
+     84f:	e8 bc 16 00 00       	call   1f10 <write>
+    if (sync)
+     854:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+     858:	74 0a                	je     864 <appends+0x6d>
+      fsync(fd);
+     85a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     85d:	89 c7                	mov    %eax,%edi
+     85f:	e8 eb 17 00 00       	call   204f <fsync>
+    t = rdtsc() - t;
+     864:	e8 97 f7 ff ff       	call   0 <rdtsc>
+     869:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+     86d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    total += t;
+     871:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     875:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    worst = max(worst, t);
+     879:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     87d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+     881:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     885:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+     889:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     88d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     891:	48 39 c2             	cmp    %rax,%rdx
+     894:	48 0f 43 c2          	cmovae %rdx,%rax
+     898:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < NAPPEND; i++) {
+     89c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     8a0:	81 7d ec f3 01 00 00 	cmpl   $0x1f3,-0x14(%rbp)
+     8a7:	7e 89                	jle    832 <appends+0x3b>
+  }
+  close(fd);
+     8a9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     8ac:	89 c7                	mov    %eax,%edi
+     8ae:	e8 17 0c 00 00       	call   14ca <close>
+  stop(sync ? "syncappend" : "append", APPENDSIZE, NAPPEND,
+     8b3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+     8b7:	74 09                	je     8c2 <appends+0xcb>
+     8b9:	48 8d 05 05 23 00 00 	lea    0x2305(%rip),%rax        # 2bc5 <benchreport+0x2c8>
+     8c0:	eb 07                	jmp    8c9 <appends+0xd2>
+     8c2:	48 8d 05 07 23 00 00 	lea    0x2307(%rip),%rax        # 2bd0 <benchreport+0x2d3>
+     8c9:	b9 00 7d 00 00       	mov    $0x7d00,%ecx
+     8ce:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     8d3:	be 40 00 00 00       	mov    $0x40,%esi
+     8d8:	48 89 c7             	mov    %rax,%rdi
+     8db:	e8 85 f7 ff ff       	call   65 <stop>
+       NAPPEND * APPENDSIZE);
+  printf(1, "  cycles per append: mean %ld max %ld\n", total / NAPPEND, worst);
+     8e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8e4:	48 c1 e8 02          	shr    $0x2,%rax
+     8e8:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+     8ef:	9b c4 20 
+     8f2:	48 f7 e2             	mul    %rdx
+     8f5:	48 c1 ea 04          	shr    $0x4,%rdx
+     8f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8fd:	48 89 c1             	mov    %rax,%rcx
+     900:	48 8d 05 d1 22 00 00 	lea    0x22d1(%rip),%rax        # 2bd8 <benchreport+0x2db>
+     907:	48 89 c6             	mov    %rax,%rsi
+     90a:	bf 01 00 00 00       	mov    $0x1,%edi
+     90f:	b8 00 00 00 00       	mov    $0x0,%eax
+     914:	e8 17 05 00 00       	call   e30 <printf>
+  unlink("fsb.app");
+     919:	48 8d 05 9d 22 00 00 	lea    0x229d(%rip),%rax        # 2bbd <benchreport+0x2c0>
+     920:	48 89 c7             	mov    %rax,%rdi
+     923:	e8 2a 16 00 00       	call   1f52 <unlink>
+}
+     928:	90                   	nop
+     929:	c9                   	leave
+     92a:	c3                   	ret
+
+000000000000092b <append>:
+
+static void append(void) { appends(0); }
+     92b:	55                   	push   %rbp
+     92c:	48 89 e5             	mov    %rsp,%rbp
+     92f:	bf 00 00 00 00       	mov    $0x0,%edi
+     934:	e8 be fe ff ff       	call   7f7 <appends>
+     939:	90                   	nop
+     93a:	5d                   	pop    %rbp
+     93b:	c3                   	ret
+
+000000000000093c <syncappend>:
+static void syncappend(void) { appends(1); }
+     93c:	55                   	push   %rbp
+     93d:	48 89 e5             	mov    %rsp,%rbp
+     940:	bf 01 00 00 00       	mov    $0x1,%edi
+     945:	e8 ad fe ff ff       	call   7f7 <appends>
+     94a:	90                   	nop
+     94b:	5d                   	pop    %rbp
+     94c:	c3                   	ret
+
+000000000000094d <concurrent>:
+
+// Half the children each write a file of their own, the other half
+// all read seqwrite's file.
+static void concurrent(void) {
+     94d:	55                   	push   %rbp
+     94e:	48 89 e5             	mov    %rsp,%rbp
+     951:	48 83 ec 20          	sub    $0x20,%rsp
+  char path[] = "fsb.c0";
+     955:	c7 45 ed 66 73 62 2e 	movl   $0x2e627366,-0x13(%rbp)
+     95c:	c7 45 f0 2e 63 30 00 	movl   $0x30632e,-0x10(%rbp)
+  int i, fd, n;
+
+  start();
+     963:	e8 dc f6 ff ff       	call   44 <start>
+  for (i = 0; i < NCHILD; i++) {
+     968:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     96f:	e9 bd 00 00 00       	jmp    a31 <concurrent+0xe4>
+    if (fork() != 0)
+     974:	e8 d7 0a 00 00       	call   1450 <fork>
+     979:	85 c0                	test   %eax,%eax
+     97b:	0f 85 ab 00 00 00    	jne    a2c <concurrent+0xdf>
+      continue;
+    if (i % 2 == 0) {
+     981:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     984:	83 e0 01             	and    $0x1,%eax
+     987:	85 c0                	test   %eax,%eax
+     989:	75 57                	jne    9e2 <concurrent+0x95>
+      path[5] += i;
+     98b:	0f b6 45 f2          	movzbl -0xe(%rbp),%eax
+     98f:	89 c2                	mov    %eax,%edx
+     991:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     994:	01 d0                	add    %edx,%eax
+     996:	88 45 f2             	mov    %al,-0xe(%rbp)
+      fd = create(path);
+     999:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     99d:	48 89 c7             	mov    %rax,%rdi
+     9a0:	e8 bd f8 ff ff       	call   262 <create>
+     9a5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      for (n = 0; n * MAXIO < filesize; n++)
+     9a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     9af:	eb 1d                	jmp    9ce <concurrent+0x81>
+        write(fd, buf, MAXIO);
+     9b1:	48 8b 0d 48 37 00 00 	mov    0x3748(%rip),%rcx        # 4100 <buf>
+     9b8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     9bb:	ba 00 80 00 00       	mov    $0x8000,%edx
+     9c0:	48 89 ce             	mov    %rcx,%rsi
+     9c3:	89 c7                	mov    %eax,%edi
+     9c5:	e8 46 15 00 00       	call   1f10 <write>
+      for (n = 0; n * MAXIO < filesize; n++)
+     9ca:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     9ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     9d1:	c1 e0 0f             	shl    $0xf,%eax
+     9d4:	89 c2                	mov    %eax,%edx
+     9d6:	8b 05 2c 37 00 00    	mov    0x372c(%rip),%eax        # 4108 <filesize>
+     9dc:	39 c2                	cmp    %eax,%edx
+     9de:	7c d1                	jl     9b1 <concurrent+0x64>
+     9e0:	eb 3b                	jmp    a1d <concurrent+0xd0>
+    } else if ((fd = open("fsb.seq", O_RDONLY)) >= 0) {
+     9e2:	be 00 00 00 00       	mov    $0x0,%esi
+     9e7:	48 8d 05 f6 20 00 00 	lea    0x20f6(%rip),%rax        # 2ae4 <benchreport+0x1e7>
+     9ee:	48 89 c7             	mov    %rax,%rdi
+     9f1:	e8 46 15 00 00       	call   1f3c <open>
+     9f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     9f9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     9fd:	78 1e                	js     a1d <concurrent+0xd0>
+      while (read(fd, buf, MAXIO) > 0)
+     9ff:	90                   	nop
+     a00:	48 8b 0d f9 36 00 00 	mov    0x36f9(%rip),%rcx        # 4100 <buf>
+     a07:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a0a:	ba 00 80 00 00       	mov    $0x8000,%edx
+     a0f:	48 89 ce             	mov    %rcx,%rsi
+     a12:	89 c7                	mov    %eax,%edi
+     a14:	e8 ec 14 00 00       	call   1f05 <read>
+     a19:	85 c0                	test   %eax,%eax
+     a1b:	7f e3                	jg     a00 <concurrent+0xb3>
+        ;
+    }
+    close(fd);
+     a1d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a20:	89 c7                	mov    %eax,%edi
+     a22:	e8 a3 0a 00 00       	call   14ca <close>
+    exit();
+     a27:	e8 34 0a 00 00       	call   1460 <exit>
+      continue;
+     a2c:	90                   	nop
+  for (i = 0; i < NCHILD; i++) {
+     a2d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a31:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     a35:	0f 8e 39 ff ff ff    	jle    974 <concurrent+0x27>
+  }
+  for (i = 0; i < NCHILD; i++)
+     a3b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a42:	eb 09                	jmp    a4d <concurrent+0x100>
+    wait();
+     a44:	e8 a6 14 00 00       	call   1eef <wait>
+  for (i = 0; i < NCHILD; i++)
+     a49:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a4d:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     a51:	7e f1                	jle    a44 <concurrent+0xf7>
+  stop("concurrent", MAXIO, NCHILD, (uint64_t)NCHILD * filesize);
+     a53:	8b 05 af 36 00 00    	mov    0x36af(%rip),%eax        # 4108 <filesize>
+     a59:	48 98                	cltq
+     a5b:	48 c1 e0 02          	shl    $0x2,%rax
+     a5f:	48 89 c1             	mov    %rax,%rcx
+     a62:	ba 04 00 00 00       	mov    $0x4,%edx
+     a67:	be 00 80 00 00       	mov    $0x8000,%esi
+     a6c:	48 8d 05 8c 21 00 00 	lea    0x218c(%rip),%rax        # 2bff <benchreport+0x302>
+     a73:	48 89 c7             	mov    %rax,%rdi
+     a76:	e8 ea f5 ff ff       	call   65 <stop>
+  for (i = 0; i < NCHILD; i += 2) {
+     a7b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a82:	eb 19                	jmp    a9d <concurrent+0x150>
+    path[5] = '0' + i;
+     a84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a87:	83 c0 30             	add    $0x30,%eax
+     a8a:	88 45 f2             	mov    %al,-0xe(%rbp)
+    unlink(path);
+     a8d:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     a91:	48 89 c7             	mov    %rax,%rdi
+     a94:	e8 b9 14 00 00       	call   1f52 <unlink>
+  for (i = 0; i < NCHILD; i += 2) {
+     a99:	83 45 fc 02          	addl   $0x2,-0x4(%rbp)
+     a9d:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     aa1:	7e e1                	jle    a84 <concurrent+0x137>
+  }
+}
+     aa3:	90                   	nop
+     aa4:	90                   	nop
+     aa5:	c9                   	leave
+     aa6:	c3                   	ret
+
+0000000000000aa7 <main>:
+    {"concurrent", concurrent},
+};
+
+#define NTESTS (sizeof(tests) / sizeof(tests[0]))
+
+int main(int argc, char *argv[]) {
+     aa7:	55                   	push   %rbp
+     aa8:	48 89 e5             	mov    %rsp,%rbp
+     aab:	48 83 ec 20          	sub    $0x20,%rsp
+     aaf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     ab2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, j;
+
+  filesize = 1024 * 1024;
+     ab6:	c7 05 48 36 00 00 00 	movl   $0x100000,0x3648(%rip)        # 4108 <filesize>
+     abd:	00 10 00 
+  argv++;
+     ac0:	48 83 45 e0 08       	addq   $0x8,-0x20(%rbp)
+  argc--;
+     ac5:	83 6d ec 01          	subl   $0x1,-0x14(%rbp)
+  if (argc >= 2 && strcmp(argv[0], "-s") == 0) {
+     ac9:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     acd:	7e 42                	jle    b11 <main+0x6a>
+     acf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     ad3:	48 8b 00             	mov    (%rax),%rax
+     ad6:	48 8d 15 2d 21 00 00 	lea    0x212d(%rip),%rdx        # 2c0a <benchreport+0x30d>
+     add:	48 89 d6             	mov    %rdx,%rsi
+     ae0:	48 89 c7             	mov    %rax,%rdi
+     ae3:	e8 7b 0c 00 00       	call   1763 <strcmp>
+     ae8:	85 c0                	test   %eax,%eax
+     aea:	75 25                	jne    b11 <main+0x6a>
+    filesize = atoi(argv[1]) * 1024;
+     aec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     af0:	48 83 c0 08          	add    $0x8,%rax
+     af4:	48 8b 00             	mov    (%rax),%rax
+     af7:	48 89 c7             	mov    %rax,%rdi
+     afa:	e8 cb 0e 00 00       	call   19ca <atoi>
+     aff:	c1 e0 0a             	shl    $0xa,%eax
+     b02:	89 05 00 36 00 00    	mov    %eax,0x3600(%rip)        # 4108 <filesize>
+    argv += 2;
+     b08:	48 83 45 e0 10       	addq   $0x10,-0x20(%rbp)
+    argc -= 2;
+     b0d:	83 6d ec 02          	subl   $0x2,-0x14(%rbp)
+  }
+  if ((buf = malloc(MAXIO)) == 0) {
+     b11:	bf 00 80 00 00       	mov    $0x8000,%edi
+     b16:	e8 f5 19 00 00       	call   2510 <malloc>
+     b1b:	48 89 05 de 35 00 00 	mov    %rax,0x35de(%rip)        # 4100 <buf>
+     b22:	48 8b 05 d7 35 00 00 	mov    0x35d7(%rip),%rax        # 4100 <buf>
+     b29:	48 85 c0             	test   %rax,%rax
+     b2c:	75 1e                	jne    b4c <main+0xa5>
+    printf(2, "fsbench: out of memory\n");
+     b2e:	48 8d 05 d8 20 00 00 	lea    0x20d8(%rip),%rax        # 2c0d <benchreport+0x310>
+     b35:	48 89 c6             	mov    %rax,%rsi
+     b38:	bf 02 00 00 00       	mov    $0x2,%edi
+     b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+     b42:	e8 e9 02 00 00       	call   e30 <printf>
+    exit();
+     b47:	e8 14 09 00 00       	call   1460 <exit>
+  }
+  memset(buf, 'f', MAXIO);
+     b4c:	48 8b 05 ad 35 00 00 	mov    0x35ad(%rip),%rax        # 4100 <buf>
+     b53:	ba 00 80 00 00       	mov    $0x8000,%edx
+     b58:	be 66 00 00 00       	mov    $0x66,%esi
+     b5d:	48 89 c7             	mov    %rax,%rdi
+     b60:	e8 ed 0c 00 00       	call   1852 <memset>
+
+  if (argc == 0) {
+     b65:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     b69:	75 3d                	jne    ba8 <main+0x101>
+    for (i = 0; i < NTESTS; i++)
+     b6b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b72:	eb 1d                	jmp    b91 <main+0xea>
+      tests[i].fn();
+     b74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b77:	48 98                	cltq
+     b79:	48 c1 e0 04          	shl    $0x4,%rax
+     b7d:	48 89 c2             	mov    %rax,%rdx
+     b80:	48 8d 05 a1 34 00 00 	lea    0x34a1(%rip),%rax        # 4028 <tests+0x8>
+     b87:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b8b:	ff d0                	call   *%rax
+    for (i = 0; i < NTESTS; i++)
+     b8d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b94:	83 f8 08             	cmp    $0x8,%eax
+     b97:	76 db                	jbe    b74 <main+0xcd>
+    unlink("fsb.seq");
+     b99:	48 8d 05 44 1f 00 00 	lea    0x1f44(%rip),%rax        # 2ae4 <benchreport+0x1e7>
+     ba0:	48 89 c7             	mov    %rax,%rdi
+     ba3:	e8 aa 13 00 00       	call   1f52 <unlink>
+  }
+  for (j = 0; j < argc; j++) {
+     ba8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     baf:	e9 ad 00 00 00       	jmp    c61 <main+0x1ba>
+    for (i = 0; i < NTESTS && strcmp(argv[j], tests[i].name); i++)
+     bb4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bbb:	eb 04                	jmp    bc1 <main+0x11a>
+     bbd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     bc1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bc4:	83 f8 08             	cmp    $0x8,%eax
+     bc7:	77 3d                	ja     c06 <main+0x15f>
+     bc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bcc:	48 98                	cltq
+     bce:	48 c1 e0 04          	shl    $0x4,%rax
+     bd2:	48 89 c2             	mov    %rax,%rdx
+     bd5:	48 8d 05 44 34 00 00 	lea    0x3444(%rip),%rax        # 4020 <tests>
+     bdc:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+     be0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     be3:	48 98                	cltq
+     be5:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     bec:	00 
+     bed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     bf1:	48 01 c8             	add    %rcx,%rax
+     bf4:	48 8b 00             	mov    (%rax),%rax
+     bf7:	48 89 d6             	mov    %rdx,%rsi
+     bfa:	48 89 c7             	mov    %rax,%rdi
+     bfd:	e8 61 0b 00 00       	call   1763 <strcmp>
+     c02:	85 c0                	test   %eax,%eax
+     c04:	75 b7                	jne    bbd <main+0x116>
+      ;
+    if (i == NTESTS) {
+     c06:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     c0a:	75 38                	jne    c44 <main+0x19d>
+      printf(2, "fsbench: no test %s\n", argv[j]);
+     c0c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c0f:	48 98                	cltq
+     c11:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     c18:	00 
+     c19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     c1d:	48 01 d0             	add    %rdx,%rax
+     c20:	48 8b 00             	mov    (%rax),%rax
+     c23:	48 89 c2             	mov    %rax,%rdx
+     c26:	48 8d 05 f8 1f 00 00 	lea    0x1ff8(%rip),%rax        # 2c25 <benchreport+0x328>
+     c2d:	48 89 c6             	mov    %rax,%rsi
+     c30:	bf 02 00 00 00       	mov    $0x2,%edi
+     c35:	b8 00 00 00 00       	mov    $0x0,%eax
+     c3a:	e8 f1 01 00 00       	call   e30 <printf>
+      exit();
+     c3f:	e8 1c 08 00 00       	call   1460 <exit>
+    }
+    tests[i].fn();
+     c44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c47:	48 98                	cltq
+     c49:	48 c1 e0 04          	shl    $0x4,%rax
+     c4d:	48 89 c2             	mov    %rax,%rdx
+     c50:	48 8d 05 d1 33 00 00 	lea    0x33d1(%rip),%rax        # 4028 <tests+0x8>
+     c57:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     c5b:	ff d0                	call   *%rax
+  for (j = 0; j < argc; j++) {
+     c5d:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     c61:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c64:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     c67:	0f 8c 47 ff ff ff    	jl     bb4 <main+0x10d>
+  }
+  exit();
+     c6d:	e8 ee 07 00 00       	call   1460 <exit>
+
+0000000000000c72 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     c72:	55                   	push   %rbp
+     c73:	48 89 e5             	mov    %rsp,%rbp
+     c76:	48 83 ec 10          	sub    $0x10,%rsp
+     c7a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     c7d:	89 f0                	mov    %esi,%eax
+     c7f:	88 45 f8             	mov    %al,-0x8(%rbp)
+     c82:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     c86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c89:	89 d6                	mov    %edx,%esi
+     c8b:	89 c7                	mov    %eax,%edi
+     c8d:	e8 eb 06 00 00       	call   137d <bputc>
+     c92:	90                   	nop
+     c93:	c9                   	leave
+     c94:	c3                   	ret
+
+0000000000000c95 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     c95:	55                   	push   %rbp
+     c96:	48 89 e5             	mov    %rsp,%rbp
+     c99:	48 83 ec 50          	sub    $0x50,%rsp
+     c9d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     ca0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     ca4:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     ca7:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     caa:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     cae:	74 21                	je     cd1 <printint64+0x3c>
+     cb0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     cb4:	48 c1 e8 3f          	shr    $0x3f,%rax
+     cb8:	0f b6 c0             	movzbl %al,%eax
+     cbb:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     cbe:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     cc2:	74 0d                	je     cd1 <printint64+0x3c>
+    x = -xx;
+     cc4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     cc8:	48 f7 d8             	neg    %rax
+     ccb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     ccf:	eb 08                	jmp    cd9 <printint64+0x44>
+  else
+    x = xx;
+     cd1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     cd5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     cd9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     ce0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     ce3:	48 63 c8             	movslq %eax,%rcx
+     ce6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cea:	ba 00 00 00 00       	mov    $0x0,%edx
+     cef:	48 f7 f1             	div    %rcx
+     cf2:	48 89 d1             	mov    %rdx,%rcx
+     cf5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cf8:	8d 50 01             	lea    0x1(%rax),%edx
+     cfb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     cfe:	48 8d 15 ab 33 00 00 	lea    0x33ab(%rip),%rdx        # 40b0 <digits.1>
+     d05:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     d09:	48 98                	cltq
+     d0b:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     d0f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     d12:	48 63 f0             	movslq %eax,%rsi
+     d15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d19:	ba 00 00 00 00       	mov    $0x0,%edx
+     d1e:	48 f7 f6             	div    %rsi
+     d21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     d25:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     d2a:	75 b4                	jne    ce0 <printint64+0x4b>
+
+  if (sgn)
+     d2c:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     d30:	74 2b                	je     d5d <printint64+0xc8>
+    buf[i++] = '-';
+     d32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d35:	8d 50 01             	lea    0x1(%rax),%edx
+     d38:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d3b:	48 98                	cltq
+     d3d:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     d42:	eb 19                	jmp    d5d <printint64+0xc8>
+    putc(fd, buf[i]);
+     d44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d47:	48 98                	cltq
+     d49:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     d4e:	0f be d0             	movsbl %al,%edx
+     d51:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     d54:	89 d6                	mov    %edx,%esi
+     d56:	89 c7                	mov    %eax,%edi
+     d58:	e8 15 ff ff ff       	call   c72 <putc>
+  while (--i >= 0)
+     d5d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     d61:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d65:	79 dd                	jns    d44 <printint64+0xaf>
+}
+     d67:	90                   	nop
+     d68:	90                   	nop
+     d69:	c9                   	leave
+     d6a:	c3                   	ret
+
+0000000000000d6b <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     d6b:	55                   	push   %rbp
+     d6c:	48 89 e5             	mov    %rsp,%rbp
+     d6f:	48 83 ec 30          	sub    $0x30,%rsp
+     d73:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     d76:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     d79:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     d7c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     d7f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     d86:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     d8a:	74 17                	je     da3 <printint+0x38>
+     d8c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     d90:	79 11                	jns    da3 <printint+0x38>
+    neg = 1;
+     d92:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     d99:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     d9c:	f7 d8                	neg    %eax
+     d9e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     da1:	eb 06                	jmp    da9 <printint+0x3e>
+  } else {
+    x = xx;
+     da3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     da6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     da9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     db0:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     db3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     db6:	ba 00 00 00 00       	mov    $0x0,%edx
+     dbb:	f7 f1                	div    %ecx
+     dbd:	89 d1                	mov    %edx,%ecx
+     dbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dc2:	8d 50 01             	lea    0x1(%rax),%edx
+     dc5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     dc8:	89 c9                	mov    %ecx,%ecx
+     dca:	48 8d 15 ff 32 00 00 	lea    0x32ff(%rip),%rdx        # 40d0 <digits.0>
+     dd1:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     dd5:	48 98                	cltq
+     dd7:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     ddb:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     dde:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     de1:	ba 00 00 00 00       	mov    $0x0,%edx
+     de6:	f7 f6                	div    %esi
+     de8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     deb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     def:	75 bf                	jne    db0 <printint+0x45>
+  if (neg)
+     df1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     df5:	74 2b                	je     e22 <printint+0xb7>
+    buf[i++] = '-';
+     df7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dfa:	8d 50 01             	lea    0x1(%rax),%edx
+     dfd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e00:	48 98                	cltq
+     e02:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     e07:	eb 19                	jmp    e22 <printint+0xb7>
+    putc(fd, buf[i]);
+     e09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e0c:	48 98                	cltq
+     e0e:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     e13:	0f be d0             	movsbl %al,%edx
+     e16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e19:	89 d6                	mov    %edx,%esi
+     e1b:	89 c7                	mov    %eax,%edi
+     e1d:	e8 50 fe ff ff       	call   c72 <putc>
+  while (--i >= 0)
+     e22:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     e26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     e2a:	79 dd                	jns    e09 <printint+0x9e>
+}
+     e2c:	90                   	nop
+     e2d:	90                   	nop
+     e2e:	c9                   	leave
+     e2f:	c3                   	ret
+
+0000000000000e30 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     e30:	55                   	push   %rbp
+     e31:	48 89 e5             	mov    %rsp,%rbp
+     e34:	48 83 ec 70          	sub    $0x70,%rsp
+     e38:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     e3b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     e3f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     e43:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     e47:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     e4b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     e4f:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     e56:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     e5a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     e5e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     e62:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     e66:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     e6d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     e74:	e9 67 02 00 00       	jmp    10e0 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     e79:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     e7c:	48 63 d0             	movslq %eax,%rdx
+     e7f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     e83:	48 01 d0             	add    %rdx,%rax
+     e86:	0f b6 00             	movzbl (%rax),%eax
+     e89:	0f be c0             	movsbl %al,%eax
+     e8c:	25 ff 00 00 00       	and    $0xff,%eax
+     e91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     e94:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     e98:	75 30                	jne    eca <printf+0x9a>
+      if (c == '%') {
+     e9a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     e9e:	75 13                	jne    eb3 <printf+0x83>
+        state = '%';
+     ea0:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     ea7:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     eae:	e9 29 02 00 00       	jmp    10dc <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     eb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     eb6:	0f be d0             	movsbl %al,%edx
+     eb9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     ebc:	89 d6                	mov    %edx,%esi
+     ebe:	89 c7                	mov    %eax,%edi
+     ec0:	e8 ad fd ff ff       	call   c72 <putc>
+     ec5:	e9 12 02 00 00       	jmp    10dc <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     eca:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     ece:	0f 85 08 02 00 00    	jne    10dc <printf+0x2ac>
+      if (c == 'l') {
+     ed4:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     ed8:	75 0c                	jne    ee6 <printf+0xb6>
+        lflag = 1;
+     eda:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     ee1:	e9 f6 01 00 00       	jmp    10dc <printf+0x2ac>
+      } else if (c == 'd') {
+     ee6:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     eea:	0f 85 93 00 00 00    	jne    f83 <printf+0x153>
+        if (lflag == 1)
+     ef0:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     ef4:	75 47                	jne    f3d <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     ef6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     ef9:	83 f8 2f             	cmp    $0x2f,%eax
+     efc:	77 17                	ja     f15 <printf+0xe5>
+     efe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     f02:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f05:	89 d2                	mov    %edx,%edx
+     f07:	48 01 d0             	add    %rdx,%rax
+     f0a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f0d:	83 c2 08             	add    $0x8,%edx
+     f10:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     f13:	eb 0c                	jmp    f21 <printf+0xf1>
+     f15:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     f19:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     f1d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     f21:	48 8b 30             	mov    (%rax),%rsi
+     f24:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f27:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f2c:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f31:	89 c7                	mov    %eax,%edi
+     f33:	e8 5d fd ff ff       	call   c95 <printint64>
+     f38:	e9 98 01 00 00       	jmp    10d5 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     f3d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     f40:	83 f8 2f             	cmp    $0x2f,%eax
+     f43:	77 17                	ja     f5c <printf+0x12c>
+     f45:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     f49:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f4c:	89 d2                	mov    %edx,%edx
+     f4e:	48 01 d0             	add    %rdx,%rax
+     f51:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f54:	83 c2 08             	add    $0x8,%edx
+     f57:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     f5a:	eb 0c                	jmp    f68 <printf+0x138>
+     f5c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     f60:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     f64:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     f68:	8b 30                	mov    (%rax),%esi
+     f6a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f6d:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f72:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f77:	89 c7                	mov    %eax,%edi
+     f79:	e8 ed fd ff ff       	call   d6b <printint>
+     f7e:	e9 52 01 00 00       	jmp    10d5 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     f83:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     f87:	74 0a                	je     f93 <printf+0x163>
+     f89:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     f8d:	0f 85 93 00 00 00    	jne    1026 <printf+0x1f6>
+        if (lflag == 1)
+     f93:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     f97:	75 47                	jne    fe0 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     f99:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     f9c:	83 f8 2f             	cmp    $0x2f,%eax
+     f9f:	77 17                	ja     fb8 <printf+0x188>
+     fa1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     fa5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     fa8:	89 d2                	mov    %edx,%edx
+     faa:	48 01 d0             	add    %rdx,%rax
+     fad:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     fb0:	83 c2 08             	add    $0x8,%edx
+     fb3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     fb6:	eb 0c                	jmp    fc4 <printf+0x194>
+     fb8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     fbc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     fc0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     fc4:	48 8b 30             	mov    (%rax),%rsi
+     fc7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     fca:	b9 00 00 00 00       	mov    $0x0,%ecx
+     fcf:	ba 10 00 00 00       	mov    $0x10,%edx
+     fd4:	89 c7                	mov    %eax,%edi
+     fd6:	e8 ba fc ff ff       	call   c95 <printint64>
+        if (lflag == 1)
+     fdb:	e9 f5 00 00 00       	jmp    10d5 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     fe0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     fe3:	83 f8 2f             	cmp    $0x2f,%eax
+     fe6:	77 17                	ja     fff <printf+0x1cf>
+     fe8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     fec:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     fef:	89 d2                	mov    %edx,%edx
+     ff1:	48 01 d0             	add    %rdx,%rax
+     ff4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ff7:	83 c2 08             	add    $0x8,%edx
+     ffa:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     ffd:	eb 0c                	jmp    100b <printf+0x1db>
+     fff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1003:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1007:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    100b:	8b 30                	mov    (%rax),%esi
+    100d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1010:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1015:	ba 10 00 00 00       	mov    $0x10,%edx
+    101a:	89 c7                	mov    %eax,%edi
+    101c:	e8 4a fd ff ff       	call   d6b <printint>
+        if (lflag == 1)
+    1021:	e9 af 00 00 00       	jmp    10d5 <printf+0x2a5>
+      } else if (c == 's') {
+    1026:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    102a:	75 6e                	jne    109a <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    102c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    102f:	83 f8 2f             	cmp    $0x2f,%eax
+    1032:	77 17                	ja     104b <printf+0x21b>
+    1034:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1038:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    103b:	89 d2                	mov    %edx,%edx
+    103d:	48 01 d0             	add    %rdx,%rax
+    1040:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1043:	83 c2 08             	add    $0x8,%edx
+    1046:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1049:	eb 0c                	jmp    1057 <printf+0x227>
+    104b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    104f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1053:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1057:	48 8b 00             	mov    (%rax),%rax
+    105a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    105e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1063:	75 28                	jne    108d <printf+0x25d>
+          s = "(null)";
+    1065:	48 8d 05 ce 1b 00 00 	lea    0x1bce(%rip),%rax        # 2c3a <benchreport+0x33d>
+    106c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    1070:	eb 1b                	jmp    108d <printf+0x25d>
+          putc(fd, *s);
+    1072:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1076:	0f b6 00             	movzbl (%rax),%eax
+    1079:	0f be d0             	movsbl %al,%edx
+    107c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    107f:	89 d6                	mov    %edx,%esi
+    1081:	89 c7                	mov    %eax,%edi
+    1083:	e8 ea fb ff ff       	call   c72 <putc>
+        for (; *s; s++)
+    1088:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    108d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1091:	0f b6 00             	movzbl (%rax),%eax
+    1094:	84 c0                	test   %al,%al
+    1096:	75 da                	jne    1072 <printf+0x242>
+    1098:	eb 3b                	jmp    10d5 <printf+0x2a5>
+      } else if (c == '%') {
+    109a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    109e:	75 14                	jne    10b4 <printf+0x284>
+        putc(fd, c);
+    10a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    10a3:	0f be d0             	movsbl %al,%edx
+    10a6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10a9:	89 d6                	mov    %edx,%esi
+    10ab:	89 c7                	mov    %eax,%edi
+    10ad:	e8 c0 fb ff ff       	call   c72 <putc>
+    10b2:	eb 21                	jmp    10d5 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    10b4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10b7:	be 25 00 00 00       	mov    $0x25,%esi
+    10bc:	89 c7                	mov    %eax,%edi
+    10be:	e8 af fb ff ff       	call   c72 <putc>
+        putc(fd, c);
+    10c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    10c6:	0f be d0             	movsbl %al,%edx
+    10c9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10cc:	89 d6                	mov    %edx,%esi
+    10ce:	89 c7                	mov    %eax,%edi
+    10d0:	e8 9d fb ff ff       	call   c72 <putc>
+      }
+      state = 0;
+    10d5:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    10dc:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    10e0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    10e3:	48 63 d0             	movslq %eax,%rdx
+    10e6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    10ea:	48 01 d0             	add    %rdx,%rax
+    10ed:	0f b6 00             	movzbl (%rax),%eax
+    10f0:	84 c0                	test   %al,%al
+    10f2:	0f 85 81 fd ff ff    	jne    e79 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    10f8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10fb:	89 c7                	mov    %eax,%edi
+    10fd:	e8 ee 02 00 00       	call   13f0 <bflushtty>
+}
+    1102:	90                   	nop
+    1103:	c9                   	leave
+    1104:	c3                   	ret
+
+0000000000001105 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    1105:	55                   	push   %rbp
+    1106:	48 89 e5             	mov    %rsp,%rbp
+    1109:	48 83 ec 30          	sub    $0x30,%rsp
+    110d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    1110:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1114:	78 06                	js     111c <getbuf+0x17>
+    1116:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    111a:	7e 0a                	jle    1126 <getbuf+0x21>
+    return 0;
+    111c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1121:	e9 94 00 00 00       	jmp    11ba <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    1126:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1129:	48 98                	cltq
+    112b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1132:	00 
+    1133:	48 8d 05 26 36 00 00 	lea    0x3626(%rip),%rax        # 4760 <obufs>
+    113a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    113e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1142:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1147:	75 6d                	jne    11b6 <getbuf+0xb1>
+    1149:	bf 08 02 00 00       	mov    $0x208,%edi
+    114e:	e8 bd 13 00 00       	call   2510 <malloc>
+    1153:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1157:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    115c:	74 58                	je     11b6 <getbuf+0xb1>
+    b->n = 0;
+    115e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1162:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    1168:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    116c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    116f:	48 89 d6             	mov    %rdx,%rsi
+    1172:	89 c7                	mov    %eax,%edi
+    1174:	e8 e4 0d 00 00       	call   1f5d <fstat>
+    1179:	85 c0                	test   %eax,%eax
+    117b:	75 11                	jne    118e <getbuf+0x89>
+    117d:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    1181:	66 83 f8 03          	cmp    $0x3,%ax
+    1185:	75 07                	jne    118e <getbuf+0x89>
+    1187:	ba 01 00 00 00       	mov    $0x1,%edx
+    118c:	eb 05                	jmp    1193 <getbuf+0x8e>
+    118e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1193:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1197:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    119a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    119d:	48 98                	cltq
+    119f:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    11a6:	00 
+    11a7:	48 8d 15 b2 35 00 00 	lea    0x35b2(%rip),%rdx        # 4760 <obufs>
+    11ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b2:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    11b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    11ba:	c9                   	leave
+    11bb:	c3                   	ret
+
+00000000000011bc <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    11bc:	55                   	push   %rbp
+    11bd:	48 89 e5             	mov    %rsp,%rbp
+    11c0:	48 83 ec 20          	sub    $0x20,%rsp
+    11c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    11c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    11cb:	78 33                	js     1200 <bflush+0x44>
+    11cd:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    11d1:	7f 2d                	jg     1200 <bflush+0x44>
+    11d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11d6:	48 98                	cltq
+    11d8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    11df:	00 
+    11e0:	48 8d 05 79 35 00 00 	lea    0x3579(%rip),%rax        # 4760 <obufs>
+    11e7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    11eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    11ef:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    11f4:	74 0a                	je     1200 <bflush+0x44>
+    11f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11fa:	8b 00                	mov    (%rax),%eax
+    11fc:	85 c0                	test   %eax,%eax
+    11fe:	75 07                	jne    1207 <bflush+0x4b>
+    return 0;
+    1200:	b8 00 00 00 00       	mov    $0x0,%eax
+    1205:	eb 3c                	jmp    1243 <bflush+0x87>
+  n = b->n;
+    1207:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    120b:	8b 00                	mov    (%rax),%eax
+    120d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    1210:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1214:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    121a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    121e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    1222:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1225:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1228:	48 89 ce             	mov    %rcx,%rsi
+    122b:	89 c7                	mov    %eax,%edi
+    122d:	e8 de 0c 00 00       	call   1f10 <write>
+    1232:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1235:	75 07                	jne    123e <bflush+0x82>
+    1237:	b8 00 00 00 00       	mov    $0x0,%eax
+    123c:	eb 05                	jmp    1243 <bflush+0x87>
+    123e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1243:	c9                   	leave
+    1244:	c3                   	ret
+
+0000000000001245 <bflushall>:
+
+void bflushall(void) {
+    1245:	55                   	push   %rbp
+    1246:	48 89 e5             	mov    %rsp,%rbp
+    1249:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    124d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1254:	eb 0e                	jmp    1264 <bflushall+0x1f>
+    bflush(fd);
+    1256:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1259:	89 c7                	mov    %eax,%edi
+    125b:	e8 5c ff ff ff       	call   11bc <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    1260:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1264:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1268:	7e ec                	jle    1256 <bflushall+0x11>
+}
+    126a:	90                   	nop
+    126b:	90                   	nop
+    126c:	c9                   	leave
+    126d:	c3                   	ret
+
+000000000000126e <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    126e:	55                   	push   %rbp
+    126f:	48 89 e5             	mov    %rsp,%rbp
+    1272:	48 83 ec 30          	sub    $0x30,%rsp
+    1276:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1279:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    127d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    1280:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1283:	89 c7                	mov    %eax,%edi
+    1285:	e8 7b fe ff ff       	call   1105 <getbuf>
+    128a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    128e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1293:	75 19                	jne    12ae <bwrite+0x40>
+    return write(fd, s, n);
+    1295:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    1298:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    129c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    129f:	48 89 ce             	mov    %rcx,%rsi
+    12a2:	89 c7                	mov    %eax,%edi
+    12a4:	e8 67 0c 00 00       	call   1f10 <write>
+    12a9:	e9 cd 00 00 00       	jmp    137b <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    12ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    12b5:	e9 92 00 00 00       	jmp    134c <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    12ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12be:	8b 00                	mov    (%rax),%eax
+    12c0:	3d 00 02 00 00       	cmp    $0x200,%eax
+    12c5:	75 18                	jne    12df <bwrite+0x71>
+    12c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    12ca:	89 c7                	mov    %eax,%edi
+    12cc:	e8 eb fe ff ff       	call   11bc <bflush>
+    12d1:	85 c0                	test   %eax,%eax
+    12d3:	79 0a                	jns    12df <bwrite+0x71>
+      return -1;
+    12d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12da:	e9 9c 00 00 00       	jmp    137b <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    12df:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    12e2:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    12e5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    12e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12ec:	8b 00                	mov    (%rax),%eax
+    12ee:	ba 00 02 00 00       	mov    $0x200,%edx
+    12f3:	29 c2                	sub    %eax,%edx
+    12f5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    12f8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    12fb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    12fe:	39 c2                	cmp    %eax,%edx
+    1300:	0f 4e c2             	cmovle %edx,%eax
+    1303:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    1306:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1309:	48 63 d0             	movslq %eax,%rdx
+    130c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1310:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    1314:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1318:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    131c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1320:	8b 00                	mov    (%rax),%eax
+    1322:	48 98                	cltq
+    1324:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1328:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    132b:	89 c2                	mov    %eax,%edx
+    132d:	48 89 cf             	mov    %rcx,%rdi
+    1330:	e8 e9 06 00 00       	call   1a1e <memmove>
+    b->n += m;
+    1335:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1339:	8b 10                	mov    (%rax),%edx
+    133b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    133e:	01 c2                	add    %eax,%edx
+    1340:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1344:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    1346:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1349:	01 45 fc             	add    %eax,-0x4(%rbp)
+    134c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    134f:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    1352:	0f 8c 62 ff ff ff    	jl     12ba <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    1358:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    135c:	8b 40 04             	mov    0x4(%rax),%eax
+    135f:	85 c0                	test   %eax,%eax
+    1361:	74 15                	je     1378 <bwrite+0x10a>
+    1363:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1366:	89 c7                	mov    %eax,%edi
+    1368:	e8 4f fe ff ff       	call   11bc <bflush>
+    136d:	85 c0                	test   %eax,%eax
+    136f:	79 07                	jns    1378 <bwrite+0x10a>
+    return -1;
+    1371:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1376:	eb 03                	jmp    137b <bwrite+0x10d>
+  return n;
+    1378:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    137b:	c9                   	leave
+    137c:	c3                   	ret
+
+000000000000137d <bputc>:
+
+void bputc(int fd, char c) {
+    137d:	55                   	push   %rbp
+    137e:	48 89 e5             	mov    %rsp,%rbp
+    1381:	48 83 ec 20          	sub    $0x20,%rsp
+    1385:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1388:	89 f0                	mov    %esi,%eax
+    138a:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    138d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1390:	89 c7                	mov    %eax,%edi
+    1392:	e8 6e fd ff ff       	call   1105 <getbuf>
+    1397:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    139b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    13a0:	75 18                	jne    13ba <bputc+0x3d>
+    write(fd, &c, 1);
+    13a2:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    13a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    13a9:	ba 01 00 00 00       	mov    $0x1,%edx
+    13ae:	48 89 ce             	mov    %rcx,%rsi
+    13b1:	89 c7                	mov    %eax,%edi
+    13b3:	e8 58 0b 00 00       	call   1f10 <write>
+    return;
+    13b8:	eb 34                	jmp    13ee <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    13ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13be:	8b 00                	mov    (%rax),%eax
+    13c0:	3d 00 02 00 00       	cmp    $0x200,%eax
+    13c5:	75 0a                	jne    13d1 <bputc+0x54>
+    bflush(fd);
+    13c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    13ca:	89 c7                	mov    %eax,%edi
+    13cc:	e8 eb fd ff ff       	call   11bc <bflush>
+  b->data[b->n++] = c;
+    13d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13d5:	8b 00                	mov    (%rax),%eax
+    13d7:	8d 48 01             	lea    0x1(%rax),%ecx
+    13da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    13de:	89 0a                	mov    %ecx,(%rdx)
+    13e0:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    13e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    13e8:	48 98                	cltq
+    13ea:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    13ee:	c9                   	leave
+    13ef:	c3                   	ret
+
+00000000000013f0 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    13f0:	55                   	push   %rbp
+    13f1:	48 89 e5             	mov    %rsp,%rbp
+    13f4:	48 83 ec 10          	sub    $0x10,%rsp
+    13f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    13fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    13ff:	78 4c                	js     144d <bflushtty+0x5d>
+    1401:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1405:	7f 46                	jg     144d <bflushtty+0x5d>
+    1407:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    140a:	48 98                	cltq
+    140c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1413:	00 
+    1414:	48 8d 05 45 33 00 00 	lea    0x3345(%rip),%rax        # 4760 <obufs>
+    141b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    141f:	48 85 c0             	test   %rax,%rax
+    1422:	74 29                	je     144d <bflushtty+0x5d>
+    1424:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1427:	48 98                	cltq
+    1429:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1430:	00 
+    1431:	48 8d 05 28 33 00 00 	lea    0x3328(%rip),%rax        # 4760 <obufs>
+    1438:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    143c:	8b 40 04             	mov    0x4(%rax),%eax
+    143f:	85 c0                	test   %eax,%eax
+    1441:	74 0a                	je     144d <bflushtty+0x5d>
+    bflush(fd);
+    1443:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1446:	89 c7                	mov    %eax,%edi
+    1448:	e8 6f fd ff ff       	call   11bc <bflush>
+}
+    144d:	90                   	nop
+    144e:	c9                   	leave
+    144f:	c3                   	ret
+
+0000000000001450 <fork>:
+
+int fork(void) {
+    1450:	55                   	push   %rbp
+    1451:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1454:	e8 ec fd ff ff       	call   1245 <bflushall>
+  return _fork();
+    1459:	e8 7b 0a 00 00       	call   1ed9 <_fork>
+}
+    145e:	5d                   	pop    %rbp
+    145f:	c3                   	ret
+
+0000000000001460 <exit>:
+
+noreturn void exit(void) {
+    1460:	55                   	push   %rbp
+    1461:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1464:	e8 dc fd ff ff       	call   1245 <bflushall>
+  _exit();
+    1469:	e8 76 0a 00 00       	call   1ee4 <_exit>
+
+000000000000146e <exec>:
+}
+
+int exec(char *path, char **argv) {
+    146e:	55                   	push   %rbp
+    146f:	48 89 e5             	mov    %rsp,%rbp
+    1472:	48 83 ec 10          	sub    $0x10,%rsp
+    1476:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    147a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    147e:	e8 c2 fd ff ff       	call   1245 <bflushall>
+  return _exec(path, argv);
+    1483:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1487:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    148b:	48 89 d6             	mov    %rdx,%rsi
+    148e:	48 89 c7             	mov    %rax,%rdi
+    1491:	e8 9b 0a 00 00       	call   1f31 <_exec>
+}
+    1496:	c9                   	leave
+    1497:	c3                   	ret
+
+0000000000001498 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    1498:	55                   	push   %rbp
+    1499:	48 89 e5             	mov    %rsp,%rbp
+    149c:	48 83 ec 20          	sub    $0x20,%rsp
+    14a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    14a8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    14ac:	e8 94 fd ff ff       	call   1245 <bflushall>
+  return _spawn(path, argv, fds);
+    14b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    14b5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    14b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14bd:	48 89 ce             	mov    %rcx,%rsi
+    14c0:	48 89 c7             	mov    %rax,%rdi
+    14c3:	e8 2f 0b 00 00       	call   1ff7 <_spawn>
+}
+    14c8:	c9                   	leave
+    14c9:	c3                   	ret
+
+00000000000014ca <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    14ca:	55                   	push   %rbp
+    14cb:	48 89 e5             	mov    %rsp,%rbp
+    14ce:	48 83 ec 10          	sub    $0x10,%rsp
+    14d2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    14d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    14d9:	78 69                	js     1544 <close+0x7a>
+    14db:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    14df:	7f 63                	jg     1544 <close+0x7a>
+    14e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14e4:	48 98                	cltq
+    14e6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    14ed:	00 
+    14ee:	48 8d 05 6b 32 00 00 	lea    0x326b(%rip),%rax        # 4760 <obufs>
+    14f5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    14f9:	48 85 c0             	test   %rax,%rax
+    14fc:	74 46                	je     1544 <close+0x7a>
+    bflush(fd);
+    14fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1501:	89 c7                	mov    %eax,%edi
+    1503:	e8 b4 fc ff ff       	call   11bc <bflush>
+    free(obufs[fd]);
+    1508:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    150b:	48 98                	cltq
+    150d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1514:	00 
+    1515:	48 8d 05 44 32 00 00 	lea    0x3244(%rip),%rax        # 4760 <obufs>
+    151c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1520:	48 89 c7             	mov    %rax,%rdi
+    1523:	e8 90 11 00 00       	call   26b8 <free>
+    obufs[fd] = 0;
+    1528:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    152b:	48 98                	cltq
+    152d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1534:	00 
+    1535:	48 8d 05 24 32 00 00 	lea    0x3224(%rip),%rax        # 4760 <obufs>
+    153c:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    1543:	00 
+  }
+  return _close(fd);
+    1544:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1547:	89 c7                	mov    %eax,%edi
+    1549:	e8 cd 09 00 00       	call   1f1b <_close>
+}
+    154e:	c9                   	leave
+    154f:	c3                   	ret
+
+0000000000001550 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    1550:	55                   	push   %rbp
+    1551:	48 89 e5             	mov    %rsp,%rbp
+    1554:	53                   	push   %rbx
+    1555:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1559:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    155d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1561:	48 8b 36             	mov    (%rsi),%rsi
+    1564:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    1568:	48 29 f7             	sub    %rsi,%rdi
+    156b:	48 89 f9             	mov    %rdi,%rcx
+    156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1573:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1577:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    157b:	48 89 f0             	mov    %rsi,%rax
+    157e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1583:	48 89 df             	mov    %rbx,%rdi
+    1586:	48 0f af f8          	imul   %rax,%rdi
+    158a:	48 89 d6             	mov    %rdx,%rsi
+    158d:	48 0f af f1          	imul   %rcx,%rsi
+    1591:	48 01 fe             	add    %rdi,%rsi
+    1594:	48 f7 e1             	mul    %rcx
+    1597:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    159b:	48 89 ca             	mov    %rcx,%rdx
+    159e:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    15a3:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    15a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    15ab:	c9                   	leave
+    15ac:	c3                   	ret
+
+00000000000015ad <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    15ad:	55                   	push   %rbp
+    15ae:	48 89 e5             	mov    %rsp,%rbp
+    15b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15b5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    15b8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    15bb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    15bf:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    15c2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    15c5:	48 89 ce             	mov    %rcx,%rsi
+    15c8:	48 89 f7             	mov    %rsi,%rdi
+    15cb:	89 d1                	mov    %edx,%ecx
+    15cd:	fc                   	cld
+    15ce:	f3 aa                	rep stos %al,%es:(%rdi)
+    15d0:	89 ca                	mov    %ecx,%edx
+    15d2:	48 89 fe             	mov    %rdi,%rsi
+    15d5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    15d9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    15dc:	90                   	nop
+    15dd:	5d                   	pop    %rbp
+    15de:	c3                   	ret
+
+00000000000015df <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    15df:	55                   	push   %rbp
+    15e0:	48 89 e5             	mov    %rsp,%rbp
+    15e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    15eb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    15ef:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    15f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    15f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15fb:	48 89 ce             	mov    %rcx,%rsi
+    15fe:	48 89 f7             	mov    %rsi,%rdi
+    1601:	48 89 d1             	mov    %rdx,%rcx
+    1604:	fc                   	cld
+    1605:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1608:	48 89 ca             	mov    %rcx,%rdx
+    160b:	48 89 fe             	mov    %rdi,%rsi
+    160e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1612:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    1616:	90                   	nop
+    1617:	5d                   	pop    %rbp
+    1618:	c3                   	ret
+
+0000000000001619 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    1619:	55                   	push   %rbp
+    161a:	48 89 e5             	mov    %rsp,%rbp
+    161d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1621:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1625:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    1629:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    162d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1631:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1635:	48 89 cf             	mov    %rcx,%rdi
+    1638:	48 89 d6             	mov    %rdx,%rsi
+    163b:	48 89 c1             	mov    %rax,%rcx
+    163e:	fc                   	cld
+    163f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1641:	48 89 c8             	mov    %rcx,%rax
+    1644:	48 89 f2             	mov    %rsi,%rdx
+    1647:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    164b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    164f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1653:	90                   	nop
+    1654:	5d                   	pop    %rbp
+    1655:	c3                   	ret
+
+0000000000001656 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    1656:	55                   	push   %rbp
+    1657:	48 89 e5             	mov    %rsp,%rbp
+    165a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    165e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1662:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    1666:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    166a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    166e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1672:	48 89 cf             	mov    %rcx,%rdi
+    1675:	48 89 d6             	mov    %rdx,%rsi
+    1678:	48 89 c1             	mov    %rax,%rcx
+    167b:	fc                   	cld
+    167c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    167f:	48 89 c8             	mov    %rcx,%rax
+    1682:	48 89 f2             	mov    %rsi,%rdx
+    1685:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1689:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    168d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1691:	90                   	nop
+    1692:	5d                   	pop    %rbp
+    1693:	c3                   	ret
+
+0000000000001694 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    1694:	55                   	push   %rbp
+    1695:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    1698:	0f 31                	rdtsc
+    169a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    169d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    16a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    16a3:	48 c1 e0 20          	shl    $0x20,%rax
+    16a7:	48 89 c2             	mov    %rax,%rdx
+    16aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16ad:	48 09 d0             	or     %rdx,%rax
+}
+    16b0:	5d                   	pop    %rbp
+    16b1:	c3                   	ret
+
+00000000000016b2 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    16b2:	55                   	push   %rbp
+    16b3:	48 89 e5             	mov    %rsp,%rbp
+    16b6:	53                   	push   %rbx
+    16b7:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    16ba:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    16be:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    16c2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    16c6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    16ca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    16cd:	0f a2                	cpuid
+    16cf:	89 de                	mov    %ebx,%esi
+    16d1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    16d4:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    16d7:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    16da:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    16dd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    16e2:	74 09                	je     16ed <cpuid+0x3b>
+    *eaxp = eax;
+    16e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16e8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    16eb:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    16ed:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    16f2:	74 09                	je     16fd <cpuid+0x4b>
+    *ebxp = ebx;
+    16f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    16f8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    16fb:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    16fd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1702:	74 09                	je     170d <cpuid+0x5b>
+    *ecxp = ecx;
+    1704:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1708:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    170b:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    170d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    1712:	74 09                	je     171d <cpuid+0x6b>
+    *edxp = edx;
+    1714:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1718:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    171b:	89 10                	mov    %edx,(%rax)
+}
+    171d:	90                   	nop
+    171e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1722:	c9                   	leave
+    1723:	c3                   	ret
+
+0000000000001724 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1724:	55                   	push   %rbp
+    1725:	48 89 e5             	mov    %rsp,%rbp
+    1728:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    172c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1734:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1738:	90                   	nop
+    1739:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    173d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1741:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1745:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1749:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    174d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1751:	0f b6 12             	movzbl (%rdx),%edx
+    1754:	88 10                	mov    %dl,(%rax)
+    1756:	0f b6 00             	movzbl (%rax),%eax
+    1759:	84 c0                	test   %al,%al
+    175b:	75 dc                	jne    1739 <strcpy+0x15>
+  return os;
+    175d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1761:	5d                   	pop    %rbp
+    1762:	c3                   	ret
+
+0000000000001763 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1763:	55                   	push   %rbp
+    1764:	48 89 e5             	mov    %rsp,%rbp
+    1767:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    176b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    176f:	eb 0a                	jmp    177b <strcmp+0x18>
+    p++, q++;
+    1771:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1776:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    177b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177f:	0f b6 00             	movzbl (%rax),%eax
+    1782:	84 c0                	test   %al,%al
+    1784:	74 12                	je     1798 <strcmp+0x35>
+    1786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178a:	0f b6 10             	movzbl (%rax),%edx
+    178d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1791:	0f b6 00             	movzbl (%rax),%eax
+    1794:	38 c2                	cmp    %al,%dl
+    1796:	74 d9                	je     1771 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    179c:	0f b6 00             	movzbl (%rax),%eax
+    179f:	0f b6 d0             	movzbl %al,%edx
+    17a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a6:	0f b6 00             	movzbl (%rax),%eax
+    17a9:	0f b6 c0             	movzbl %al,%eax
+    17ac:	29 c2                	sub    %eax,%edx
+    17ae:	89 d0                	mov    %edx,%eax
+}
+    17b0:	5d                   	pop    %rbp
+    17b1:	c3                   	ret
+
+00000000000017b2 <strlen>:
+uint strlen(char *s) {
+    17b2:	55                   	push   %rbp
+    17b3:	48 89 e5             	mov    %rsp,%rbp
+    17b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    17ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    17c1:	eb 04                	jmp    17c7 <strlen+0x15>
+    17c3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    17c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17ca:	48 63 d0             	movslq %eax,%rdx
+    17cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d1:	48 01 d0             	add    %rdx,%rax
+    17d4:	0f b6 00             	movzbl (%rax),%eax
+    17d7:	84 c0                	test   %al,%al
+    17d9:	75 e8                	jne    17c3 <strlen+0x11>
+    ;
+  return n;
+    17db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    17de:	5d                   	pop    %rbp
+    17df:	c3                   	ret
+
+00000000000017e0 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    17e0:	55                   	push   %rbp
+    17e1:	48 89 e5             	mov    %rsp,%rbp
+    17e4:	53                   	push   %rbx
+    17e5:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    17e9:	8b 05 f5 28 00 00    	mov    0x28f5(%rip),%eax        # 40e4 <erms>
+    17ef:	85 c0                	test   %eax,%eax
+    17f1:	79 53                	jns    1846 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    17f3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    17f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    17fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1802:	ba 00 00 00 00       	mov    $0x0,%edx
+    1807:	48 89 c6             	mov    %rax,%rsi
+    180a:	bf 00 00 00 00       	mov    $0x0,%edi
+    180f:	e8 9e fe ff ff       	call   16b2 <cpuid>
+    ebx = 0;
+    1814:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    181b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    181e:	83 f8 06             	cmp    $0x6,%eax
+    1821:	76 14                	jbe    1837 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    1823:	b8 07 00 00 00       	mov    $0x7,%eax
+    1828:	b9 00 00 00 00       	mov    $0x0,%ecx
+    182d:	0f a2                	cpuid
+    182f:	89 d9                	mov    %ebx,%ecx
+    1831:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    1834:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    1837:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    183a:	c1 e8 09             	shr    $0x9,%eax
+    183d:	83 e0 01             	and    $0x1,%eax
+    1840:	89 05 9e 28 00 00    	mov    %eax,0x289e(%rip)        # 40e4 <erms>
+  }
+  return erms;
+    1846:	8b 05 98 28 00 00    	mov    0x2898(%rip),%eax        # 40e4 <erms>
+}
+    184c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1850:	c9                   	leave
+    1851:	c3                   	ret
+
+0000000000001852 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    1852:	55                   	push   %rbp
+    1853:	48 89 e5             	mov    %rsp,%rbp
+    1856:	48 83 ec 10          	sub    $0x10,%rsp
+    185a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    185e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1861:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    1864:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    1868:	76 09                	jbe    1873 <memset+0x21>
+    186a:	e8 71 ff ff ff       	call   17e0 <haserms>
+    186f:	85 c0                	test   %eax,%eax
+    1871:	74 16                	je     1889 <memset+0x37>
+    stosb(dst, c, n);
+    1873:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1876:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1879:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    187d:	89 ce                	mov    %ecx,%esi
+    187f:	48 89 c7             	mov    %rax,%rdi
+    1882:	e8 26 fd ff ff       	call   15ad <stosb>
+    1887:	eb 58                	jmp    18e1 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    1889:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    188c:	c1 e8 03             	shr    $0x3,%eax
+    188f:	89 c6                	mov    %eax,%esi
+    1891:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1894:	48 98                	cltq
+    1896:	0f b6 c0             	movzbl %al,%eax
+    1899:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    18a0:	01 01 01 
+    18a3:	48 0f af c2          	imul   %rdx,%rax
+    18a7:	48 89 c1             	mov    %rax,%rcx
+    18aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ae:	48 89 f2             	mov    %rsi,%rdx
+    18b1:	48 89 ce             	mov    %rcx,%rsi
+    18b4:	48 89 c7             	mov    %rax,%rdi
+    18b7:	e8 23 fd ff ff       	call   15df <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    18bc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    18bf:	83 e0 07             	and    $0x7,%eax
+    18c2:	89 c2                	mov    %eax,%edx
+    18c4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    18c7:	83 e0 f8             	and    $0xfffffff8,%eax
+    18ca:	48 89 c1             	mov    %rax,%rcx
+    18cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18d1:	48 01 c1             	add    %rax,%rcx
+    18d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18d7:	89 c6                	mov    %eax,%esi
+    18d9:	48 89 cf             	mov    %rcx,%rdi
+    18dc:	e8 cc fc ff ff       	call   15ad <stosb>
+  }
+  return dst;
+    18e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    18e5:	c9                   	leave
+    18e6:	c3                   	ret
+
+00000000000018e7 <strchr>:
+
+char *strchr(const char *s, char c) {
+    18e7:	55                   	push   %rbp
+    18e8:	48 89 e5             	mov    %rsp,%rbp
+    18eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18ef:	89 f0                	mov    %esi,%eax
+    18f1:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    18f4:	eb 17                	jmp    190d <strchr+0x26>
+    if (*s == c)
+    18f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18fa:	0f b6 00             	movzbl (%rax),%eax
+    18fd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1900:	75 06                	jne    1908 <strchr+0x21>
+      return (char *)s;
+    1902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1906:	eb 15                	jmp    191d <strchr+0x36>
+  for (; *s; s++)
+    1908:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    190d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1911:	0f b6 00             	movzbl (%rax),%eax
+    1914:	84 c0                	test   %al,%al
+    1916:	75 de                	jne    18f6 <strchr+0xf>
+  return 0;
+    1918:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    191d:	5d                   	pop    %rbp
+    191e:	c3                   	ret
+
+000000000000191f <gets>:
+
+char *gets(char *buf, int max) {
+    191f:	55                   	push   %rbp
+    1920:	48 89 e5             	mov    %rsp,%rbp
+    1923:	48 83 ec 20          	sub    $0x20,%rsp
+    1927:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    192b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    192e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1935:	eb 48                	jmp    197f <gets+0x60>
+    cc = read(0, &c, 1);
+    1937:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    193b:	ba 01 00 00 00       	mov    $0x1,%edx
+    1940:	48 89 c6             	mov    %rax,%rsi
+    1943:	bf 00 00 00 00       	mov    $0x0,%edi
+    1948:	e8 b8 05 00 00       	call   1f05 <read>
+    194d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1950:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1954:	7e 36                	jle    198c <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1956:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1959:	8d 50 01             	lea    0x1(%rax),%edx
+    195c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    195f:	48 63 d0             	movslq %eax,%rdx
+    1962:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1966:	48 01 c2             	add    %rax,%rdx
+    1969:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    196d:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    196f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1973:	3c 0a                	cmp    $0xa,%al
+    1975:	74 16                	je     198d <gets+0x6e>
+    1977:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    197b:	3c 0d                	cmp    $0xd,%al
+    197d:	74 0e                	je     198d <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    197f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1982:	83 c0 01             	add    $0x1,%eax
+    1985:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1988:	7f ad                	jg     1937 <gets+0x18>
+    198a:	eb 01                	jmp    198d <gets+0x6e>
+      break;
+    198c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    198d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1990:	48 63 d0             	movslq %eax,%rdx
+    1993:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1997:	48 01 d0             	add    %rdx,%rax
+    199a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    199d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    19a1:	c9                   	leave
+    19a2:	c3                   	ret
+
+00000000000019a3 <stat>:
+
+int stat(char *n, struct stat *st) {
+    19a3:	55                   	push   %rbp
+    19a4:	48 89 e5             	mov    %rsp,%rbp
+    19a7:	48 83 ec 10          	sub    $0x10,%rsp
+    19ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    19b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19bb:	48 89 c6             	mov    %rax,%rsi
+    19be:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    19c3:	e8 58 07 00 00       	call   2120 <fstatat>
+}
+    19c8:	c9                   	leave
+    19c9:	c3                   	ret
+
+00000000000019ca <atoi>:
+
+int atoi(const char *s) {
+    19ca:	55                   	push   %rbp
+    19cb:	48 89 e5             	mov    %rsp,%rbp
+    19ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    19d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    19d9:	eb 28                	jmp    1a03 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    19db:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    19de:	89 d0                	mov    %edx,%eax
+    19e0:	c1 e0 02             	shl    $0x2,%eax
+    19e3:	01 d0                	add    %edx,%eax
+    19e5:	01 c0                	add    %eax,%eax
+    19e7:	89 c1                	mov    %eax,%ecx
+    19e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19ed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    19f1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    19f5:	0f b6 00             	movzbl (%rax),%eax
+    19f8:	0f be c0             	movsbl %al,%eax
+    19fb:	01 c8                	add    %ecx,%eax
+    19fd:	83 e8 30             	sub    $0x30,%eax
+    1a00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a07:	0f b6 00             	movzbl (%rax),%eax
+    1a0a:	3c 2f                	cmp    $0x2f,%al
+    1a0c:	7e 0b                	jle    1a19 <atoi+0x4f>
+    1a0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a12:	0f b6 00             	movzbl (%rax),%eax
+    1a15:	3c 39                	cmp    $0x39,%al
+    1a17:	7e c2                	jle    19db <atoi+0x11>
+  return n;
+    1a19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1a1c:	5d                   	pop    %rbp
+    1a1d:	c3                   	ret
+
+0000000000001a1e <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1a1e:	55                   	push   %rbp
+    1a1f:	48 89 e5             	mov    %rsp,%rbp
+    1a22:	48 83 ec 28          	sub    $0x28,%rsp
+    1a26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a2a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1a2e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1a31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1a39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a3d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1a41:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1a45:	7f 09                	jg     1a50 <memmove+0x32>
+    return vdst;
+    1a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a4b:	e9 29 01 00 00       	jmp    1b79 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1a50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a54:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1a58:	0f 83 87 00 00 00    	jae    1ae5 <memmove+0xc7>
+    1a5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a61:	48 63 d0             	movslq %eax,%rdx
+    1a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a68:	48 01 d0             	add    %rdx,%rax
+    1a6b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a6f:	73 74                	jae    1ae5 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1a71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a74:	48 98                	cltq
+    1a76:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1a7a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a7d:	48 98                	cltq
+    1a7f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1a83:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a8b:	48 09 d0             	or     %rdx,%rax
+    1a8e:	83 e0 07             	and    $0x7,%eax
+    1a91:	48 85 c0             	test   %rax,%rax
+    1a94:	75 3d                	jne    1ad3 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1a96:	eb 1c                	jmp    1ab4 <memmove+0x96>
+        src -= 8;
+    1a98:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1a9d:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aa6:	48 8b 10             	mov    (%rax),%rdx
+    1aa9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aad:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1ab0:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1ab4:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1ab8:	7f de                	jg     1a98 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1aba:	eb 17                	jmp    1ad3 <memmove+0xb5>
+      *--dst = *--src;
+    1abc:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1ac1:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1ac6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aca:	0f b6 10             	movzbl (%rax),%edx
+    1acd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad1:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1ad3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ad6:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1ad9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1adc:	85 c0                	test   %eax,%eax
+    1ade:	7f dc                	jg     1abc <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1ae0:	e9 90 00 00 00       	jmp    1b75 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1ae5:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1ae9:	7e 09                	jle    1af4 <memmove+0xd6>
+    1aeb:	e8 f0 fc ff ff       	call   17e0 <haserms>
+    1af0:	85 c0                	test   %eax,%eax
+    1af2:	74 1b                	je     1b0f <memmove+0xf1>
+    movsb(dst, src, n);
+    1af4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1af7:	48 63 d0             	movslq %eax,%rdx
+    1afa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1afe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b02:	48 89 ce             	mov    %rcx,%rsi
+    1b05:	48 89 c7             	mov    %rax,%rdi
+    1b08:	e8 0c fb ff ff       	call   1619 <movsb>
+    1b0d:	eb 66                	jmp    1b75 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1b0f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b12:	8d 50 07             	lea    0x7(%rax),%edx
+    1b15:	85 c0                	test   %eax,%eax
+    1b17:	0f 48 c2             	cmovs  %edx,%eax
+    1b1a:	c1 f8 03             	sar    $0x3,%eax
+    1b1d:	48 63 d0             	movslq %eax,%rdx
+    1b20:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1b24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b28:	48 89 ce             	mov    %rcx,%rsi
+    1b2b:	48 89 c7             	mov    %rax,%rdi
+    1b2e:	e8 23 fb ff ff       	call   1656 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1b33:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1b36:	89 d0                	mov    %edx,%eax
+    1b38:	c1 f8 1f             	sar    $0x1f,%eax
+    1b3b:	c1 e8 1d             	shr    $0x1d,%eax
+    1b3e:	01 c2                	add    %eax,%edx
+    1b40:	83 e2 07             	and    $0x7,%edx
+    1b43:	29 c2                	sub    %eax,%edx
+    1b45:	89 d0                	mov    %edx,%eax
+    1b47:	48 98                	cltq
+    1b49:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1b4c:	83 e2 f8             	and    $0xfffffff8,%edx
+    1b4f:	48 63 ca             	movslq %edx,%rcx
+    1b52:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b56:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1b5a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1b5d:	83 e2 f8             	and    $0xfffffff8,%edx
+    1b60:	48 63 ca             	movslq %edx,%rcx
+    1b63:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1b67:	48 01 d1             	add    %rdx,%rcx
+    1b6a:	48 89 c2             	mov    %rax,%rdx
+    1b6d:	48 89 cf             	mov    %rcx,%rdi
+    1b70:	e8 a4 fa ff ff       	call   1619 <movsb>
+  }
+  return vdst;
+    1b75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1b79:	c9                   	leave
+    1b7a:	c3                   	ret
+
+0000000000001b7b <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1b7b:	55                   	push   %rbp
+    1b7c:	48 89 e5             	mov    %rsp,%rbp
+    1b7f:	48 83 ec 20          	sub    $0x20,%rsp
+    1b83:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1b86:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1b8a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1b91:	00 00 00 
+    1b94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1b98:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1b9c:	75 0d                	jne    1bab <clock_gettime+0x30>
+    1b9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba2:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1ba6:	48 85 c0             	test   %rax,%rax
+    1ba9:	75 13                	jne    1bbe <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1bab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1baf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1bb2:	48 89 d6             	mov    %rdx,%rsi
+    1bb5:	89 c7                	mov    %eax,%edi
+    1bb7:	e8 e0 04 00 00       	call   209c <_clock_gettime>
+    1bbc:	eb 7d                	jmp    1c3b <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1bbe:	e8 d1 fa ff ff       	call   1694 <rdtsc>
+    1bc3:	48 89 c2             	mov    %rax,%rdx
+    1bc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bca:	48 89 d6             	mov    %rdx,%rsi
+    1bcd:	48 89 c7             	mov    %rax,%rdi
+    1bd0:	e8 7b f9 ff ff       	call   1550 <clockns>
+    1bd5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1bd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bdd:	48 c1 e8 09          	shr    $0x9,%rax
+    1be1:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1be8:	b8 44 00 
+    1beb:	48 f7 e2             	mul    %rdx
+    1bee:	48 89 d0             	mov    %rdx,%rax
+    1bf1:	48 c1 e8 0b          	shr    $0xb,%rax
+    1bf5:	48 89 c2             	mov    %rax,%rdx
+    1bf8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1bfc:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1bff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1c03:	48 89 c8             	mov    %rcx,%rax
+    1c06:	48 c1 e8 09          	shr    $0x9,%rax
+    1c0a:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1c11:	b8 44 00 
+    1c14:	48 f7 e2             	mul    %rdx
+    1c17:	48 89 d0             	mov    %rdx,%rax
+    1c1a:	48 c1 e8 0b          	shr    $0xb,%rax
+    1c1e:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1c25:	48 89 c8             	mov    %rcx,%rax
+    1c28:	48 29 d0             	sub    %rdx,%rax
+    1c2b:	48 89 c2             	mov    %rax,%rdx
+    1c2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c32:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1c36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1c3b:	c9                   	leave
+    1c3c:	c3                   	ret
+
+0000000000001c3d <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1c3d:	55                   	push   %rbp
+    1c3e:	48 89 e5             	mov    %rsp,%rbp
+    1c41:	48 83 ec 10          	sub    $0x10,%rsp
+    1c45:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1c49:	eb 11                	jmp    1c5c <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1c4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c4f:	be 02 00 00 00       	mov    $0x2,%esi
+    1c54:	48 89 c7             	mov    %rax,%rdi
+    1c57:	e8 6c 04 00 00       	call   20c8 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1c5c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1c60:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c65:	87 02                	xchg   %eax,(%rdx)
+    1c67:	85 c0                	test   %eax,%eax
+    1c69:	75 e0                	jne    1c4b <mutex_wait+0xe>
+}
+    1c6b:	90                   	nop
+    1c6c:	90                   	nop
+    1c6d:	c9                   	leave
+    1c6e:	c3                   	ret
+
+0000000000001c6f <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1c6f:	55                   	push   %rbp
+    1c70:	48 89 e5             	mov    %rsp,%rbp
+    1c73:	48 83 ec 20          	sub    $0x20,%rsp
+    1c77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1c7b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1c82:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1c86:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1c8a:	8b 02                	mov    (%rdx),%eax
+    1c8c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1c91:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1c95:	89 c1                	mov    %eax,%ecx
+    1c97:	0f 94 c0             	sete   %al
+    1c9a:	84 c0                	test   %al,%al
+    1c9c:	75 02                	jne    1ca0 <mutex_lock+0x31>
+    1c9e:	89 0a                	mov    %ecx,(%rdx)
+    1ca0:	83 f0 01             	xor    $0x1,%eax
+    1ca3:	84 c0                	test   %al,%al
+    1ca5:	74 0c                	je     1cb3 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cab:	48 89 c7             	mov    %rax,%rdi
+    1cae:	e8 8a ff ff ff       	call   1c3d <mutex_wait>
+}
+    1cb3:	90                   	nop
+    1cb4:	c9                   	leave
+    1cb5:	c3                   	ret
+
+0000000000001cb6 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1cb6:	55                   	push   %rbp
+    1cb7:	48 89 e5             	mov    %rsp,%rbp
+    1cba:	48 83 ec 10          	sub    $0x10,%rsp
+    1cbe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1cc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc6:	ba 00 00 00 00       	mov    $0x0,%edx
+    1ccb:	87 10                	xchg   %edx,(%rax)
+    1ccd:	83 fa 02             	cmp    $0x2,%edx
+    1cd0:	75 11                	jne    1ce3 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1cd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cd6:	be 01 00 00 00       	mov    $0x1,%esi
+    1cdb:	48 89 c7             	mov    %rax,%rdi
+    1cde:	e8 f0 03 00 00       	call   20d3 <futex_wake>
+}
+    1ce3:	90                   	nop
+    1ce4:	c9                   	leave
+    1ce5:	c3                   	ret
+
+0000000000001ce6 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1ce6:	55                   	push   %rbp
+    1ce7:	48 89 e5             	mov    %rsp,%rbp
+    1cea:	48 83 ec 20          	sub    $0x20,%rsp
+    1cee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cf2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1cf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cfa:	48 83 c0 04          	add    $0x4,%rax
+    1cfe:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1d02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d06:	8b 00                	mov    (%rax),%eax
+    1d08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d0f:	48 89 c7             	mov    %rax,%rdi
+    1d12:	e8 9f ff ff ff       	call   1cb6 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1d17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d1b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1d1e:	89 d6                	mov    %edx,%esi
+    1d20:	48 89 c7             	mov    %rax,%rdi
+    1d23:	e8 a0 03 00 00       	call   20c8 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1d28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d2c:	48 83 c0 04          	add    $0x4,%rax
+    1d30:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1d34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d38:	48 89 c7             	mov    %rax,%rdi
+    1d3b:	e8 fd fe ff ff       	call   1c3d <mutex_wait>
+}
+    1d40:	90                   	nop
+    1d41:	c9                   	leave
+    1d42:	c3                   	ret
+
+0000000000001d43 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1d43:	55                   	push   %rbp
+    1d44:	48 89 e5             	mov    %rsp,%rbp
+    1d47:	48 83 ec 10          	sub    $0x10,%rsp
+    1d4b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1d4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d53:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1d57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5b:	48 83 c0 04          	add    $0x4,%rax
+    1d5f:	8b 00                	mov    (%rax),%eax
+    1d61:	85 c0                	test   %eax,%eax
+    1d63:	7e 11                	jle    1d76 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1d65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d69:	be 01 00 00 00       	mov    $0x1,%esi
+    1d6e:	48 89 c7             	mov    %rax,%rdi
+    1d71:	e8 5d 03 00 00       	call   20d3 <futex_wake>
+}
+    1d76:	90                   	nop
+    1d77:	c9                   	leave
+    1d78:	c3                   	ret
+
+0000000000001d79 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1d79:	55                   	push   %rbp
+    1d7a:	48 89 e5             	mov    %rsp,%rbp
+    1d7d:	48 83 ec 10          	sub    $0x10,%rsp
+    1d81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1d85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d89:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d91:	48 83 c0 04          	add    $0x4,%rax
+    1d95:	8b 00                	mov    (%rax),%eax
+    1d97:	85 c0                	test   %eax,%eax
+    1d99:	7e 11                	jle    1dac <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1d9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d9f:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1da4:	48 89 c7             	mov    %rax,%rdi
+    1da7:	e8 27 03 00 00       	call   20d3 <futex_wake>
+}
+    1dac:	90                   	nop
+    1dad:	c9                   	leave
+    1dae:	c3                   	ret
+
+0000000000001daf <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1daf:	55                   	push   %rbp
+    1db0:	48 89 e5             	mov    %rsp,%rbp
+    1db3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1db7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1dba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1dbe:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1dc2:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1dc6:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1dca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dce:	8b 40 04             	mov    0x4(%rax),%eax
+    1dd1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1dd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dd8:	8b 00                	mov    (%rax),%eax
+    1dda:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ddd:	29 c2                	sub    %eax,%edx
+    1ddf:	83 fa 1f             	cmp    $0x1f,%edx
+    1de2:	76 07                	jbe    1deb <ring_push+0x3c>
+    return -1;
+    1de4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1de9:	eb 7e                	jmp    1e69 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1deb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dee:	83 e0 1f             	and    $0x1f,%eax
+    1df1:	89 c2                	mov    %eax,%edx
+    1df3:	48 89 d0             	mov    %rdx,%rax
+    1df6:	48 01 c0             	add    %rax,%rax
+    1df9:	48 01 d0             	add    %rdx,%rax
+    1dfc:	48 c1 e0 04          	shl    $0x4,%rax
+    1e00:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1e04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e08:	48 01 d0             	add    %rdx,%rax
+    1e0b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1e0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e13:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1e16:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e1c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1e20:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1e24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e28:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1e2c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1e30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e34:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1e38:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1e3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1e44:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1e48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e4c:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1e50:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e57:	8d 50 01             	lea    0x1(%rax),%edx
+    1e5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e5e:	48 83 c0 04          	add    $0x4,%rax
+    1e62:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1e64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1e69:	5d                   	pop    %rbp
+    1e6a:	c3                   	ret
+
+0000000000001e6b <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1e6b:	55                   	push   %rbp
+    1e6c:	48 89 e5             	mov    %rsp,%rbp
+    1e6f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e73:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1e77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e7b:	8b 40 08             	mov    0x8(%rax),%eax
+    1e7e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e85:	48 83 c0 0c          	add    $0xc,%rax
+    1e89:	8b 00                	mov    (%rax),%eax
+    1e8b:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1e8e:	75 07                	jne    1e97 <ring_pop+0x2c>
+    return -1;
+    1e90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e95:	eb 40                	jmp    1ed7 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1e97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e9a:	83 e0 1f             	and    $0x1f,%eax
+    1e9d:	89 c2                	mov    %eax,%edx
+    1e9f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1ea3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ea7:	89 d2                	mov    %edx,%edx
+    1ea9:	48 83 c2 61          	add    $0x61,%rdx
+    1ead:	48 c1 e2 04          	shl    $0x4,%rdx
+    1eb1:	48 01 d0             	add    %rdx,%rax
+    1eb4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1eb8:	48 8b 00             	mov    (%rax),%rax
+    1ebb:	48 89 01             	mov    %rax,(%rcx)
+    1ebe:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1ec2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ec5:	8d 50 01             	lea    0x1(%rax),%edx
+    1ec8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ecc:	48 83 c0 08          	add    $0x8,%rax
+    1ed0:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1ed7:	5d                   	pop    %rbp
+    1ed8:	c3                   	ret
+
+0000000000001ed9 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1ed9:	b8 01 00 00 00       	mov    $0x1,%eax
+    1ede:	49 89 ca             	mov    %rcx,%r10
+    1ee1:	0f 05                	syscall
+    1ee3:	c3                   	ret
+
+0000000000001ee4 <_exit>:
+SYSCALL_(exit)
+    1ee4:	b8 02 00 00 00       	mov    $0x2,%eax
+    1ee9:	49 89 ca             	mov    %rcx,%r10
+    1eec:	0f 05                	syscall
+    1eee:	c3                   	ret
+
+0000000000001eef <wait>:
+SYSCALL(wait)
+    1eef:	b8 03 00 00 00       	mov    $0x3,%eax
+    1ef4:	49 89 ca             	mov    %rcx,%r10
+    1ef7:	0f 05                	syscall
+    1ef9:	c3                   	ret
+
+0000000000001efa <pipe>:
+SYSCALL(pipe)
+    1efa:	b8 04 00 00 00       	mov    $0x4,%eax
+    1eff:	49 89 ca             	mov    %rcx,%r10
+    1f02:	0f 05                	syscall
+    1f04:	c3                   	ret
+
+0000000000001f05 <read>:
+SYSCALL(read)
+    1f05:	b8 05 00 00 00       	mov    $0x5,%eax
+    1f0a:	49 89 ca             	mov    %rcx,%r10
+    1f0d:	0f 05                	syscall
+    1f0f:	c3                   	ret
+
+0000000000001f10 <write>:
+SYSCALL(write)
+    1f10:	b8 10 00 00 00       	mov    $0x10,%eax
+    1f15:	49 89 ca             	mov    %rcx,%r10
+    1f18:	0f 05                	syscall
+    1f1a:	c3                   	ret
+
+0000000000001f1b <_close>:
+SYSCALL_(close)
+    1f1b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1f20:	49 89 ca             	mov    %rcx,%r10
+    1f23:	0f 05                	syscall
+    1f25:	c3                   	ret
+
+0000000000001f26 <kill>:
+SYSCALL(kill)
+    1f26:	b8 06 00 00 00       	mov    $0x6,%eax
+    1f2b:	49 89 ca             	mov    %rcx,%r10
+    1f2e:	0f 05                	syscall
+    1f30:	c3                   	ret
+
+0000000000001f31 <_exec>:
+SYSCALL_(exec)
+    1f31:	b8 07 00 00 00       	mov    $0x7,%eax
+    1f36:	49 89 ca             	mov    %rcx,%r10
+    1f39:	0f 05                	syscall
+    1f3b:	c3                   	ret
+
+0000000000001f3c <open>:
+SYSCALL(open)
+    1f3c:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1f41:	49 89 ca             	mov    %rcx,%r10
+    1f44:	0f 05                	syscall
+    1f46:	c3                   	ret
+
+0000000000001f47 <mknod>:
+SYSCALL(mknod)
+    1f47:	b8 11 00 00 00       	mov    $0x11,%eax
+    1f4c:	49 89 ca             	mov    %rcx,%r10
+    1f4f:	0f 05                	syscall
+    1f51:	c3                   	ret
+
+0000000000001f52 <unlink>:
+SYSCALL(unlink)
+    1f52:	b8 12 00 00 00       	mov    $0x12,%eax
+    1f57:	49 89 ca             	mov    %rcx,%r10
+    1f5a:	0f 05                	syscall
+    1f5c:	c3                   	ret
+
+0000000000001f5d <fstat>:
+SYSCALL(fstat)
+    1f5d:	b8 08 00 00 00       	mov    $0x8,%eax
+    1f62:	49 89 ca             	mov    %rcx,%r10
+    1f65:	0f 05                	syscall
+    1f67:	c3                   	ret
+
+0000000000001f68 <link>:
+SYSCALL(link)
+    1f68:	b8 13 00 00 00       	mov    $0x13,%eax
+    1f6d:	49 89 ca             	mov    %rcx,%r10
+    1f70:	0f 05                	syscall
+    1f72:	c3                   	ret
+
+0000000000001f73 <mkdir>:
+SYSCALL(mkdir)
+    1f73:	b8 14 00 00 00       	mov    $0x14,%eax
+    1f78:	49 89 ca             	mov    %rcx,%r10
+    1f7b:	0f 05                	syscall
+    1f7d:	c3                   	ret
+
+0000000000001f7e <chdir>:
+SYSCALL(chdir)
+    1f7e:	b8 09 00 00 00       	mov    $0x9,%eax
+    1f83:	49 89 ca             	mov    %rcx,%r10
+    1f86:	0f 05                	syscall
+    1f88:	c3                   	ret
+
+0000000000001f89 <dup>:
+SYSCALL(dup)
+    1f89:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1f8e:	49 89 ca             	mov    %rcx,%r10
+    1f91:	0f 05                	syscall
+    1f93:	c3                   	ret
+
+0000000000001f94 <getpid>:
+SYSCALL(getpid)
+    1f94:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1f99:	49 89 ca             	mov    %rcx,%r10
+    1f9c:	0f 05                	syscall
+    1f9e:	c3                   	ret
+
+0000000000001f9f <sbrk>:
+SYSCALL(sbrk)
+    1f9f:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1fa4:	49 89 ca             	mov    %rcx,%r10
+    1fa7:	0f 05                	syscall
+    1fa9:	c3                   	ret
+
+0000000000001faa <sleep>:
+SYSCALL(sleep)
+    1faa:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1faf:	49 89 ca             	mov    %rcx,%r10
+    1fb2:	0f 05                	syscall
+    1fb4:	c3                   	ret
+
+0000000000001fb5 <uptime>:
+SYSCALL(uptime)
+    1fb5:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1fba:	49 89 ca             	mov    %rcx,%r10
+    1fbd:	0f 05                	syscall
+    1fbf:	c3                   	ret
+
+0000000000001fc0 <sysinfo>:
+SYSCALL(sysinfo)
+    1fc0:	b8 16 00 00 00       	mov    $0x16,%eax
+    1fc5:	49 89 ca             	mov    %rcx,%r10
+    1fc8:	0f 05                	syscall
+    1fca:	c3                   	ret
+
+0000000000001fcb <crashn>:
+SYSCALL(crashn)
+    1fcb:	b8 17 00 00 00       	mov    $0x17,%eax
+    1fd0:	49 89 ca             	mov    %rcx,%r10
+    1fd3:	0f 05                	syscall
+    1fd5:	c3                   	ret
+
+0000000000001fd6 <mmap>:
+SYSCALL(mmap)
+    1fd6:	b8 18 00 00 00       	mov    $0x18,%eax
+    1fdb:	49 89 ca             	mov    %rcx,%r10
+    1fde:	0f 05                	syscall
+    1fe0:	c3                   	ret
+
+0000000000001fe1 <munmap>:
+SYSCALL(munmap)
+    1fe1:	b8 19 00 00 00       	mov    $0x19,%eax
+    1fe6:	49 89 ca             	mov    %rcx,%r10
+    1fe9:	0f 05                	syscall
+    1feb:	c3                   	ret
+
+0000000000001fec <nice>:
+SYSCALL(nice)
+    1fec:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1ff1:	49 89 ca             	mov    %rcx,%r10
+    1ff4:	0f 05                	syscall
+    1ff6:	c3                   	ret
+
+0000000000001ff7 <_spawn>:
+SYSCALL_(spawn)
+    1ff7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1ffc:	49 89 ca             	mov    %rcx,%r10
+    1fff:	0f 05                	syscall
+    2001:	c3                   	ret
+
+0000000000002002 <pread>:
+SYSCALL(pread)
+    2002:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2007:	49 89 ca             	mov    %rcx,%r10
+    200a:	0f 05                	syscall
+    200c:	c3                   	ret
+
+000000000000200d <pwrite>:
+SYSCALL(pwrite)
+    200d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    2012:	49 89 ca             	mov    %rcx,%r10
+    2015:	0f 05                	syscall
+    2017:	c3                   	ret
+
+0000000000002018 <readv>:
+SYSCALL(readv)
+    2018:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    201d:	49 89 ca             	mov    %rcx,%r10
+    2020:	0f 05                	syscall
+    2022:	c3                   	ret
+
+0000000000002023 <writev>:
+SYSCALL(writev)
+    2023:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2028:	49 89 ca             	mov    %rcx,%r10
+    202b:	0f 05                	syscall
+    202d:	c3                   	ret
+
+000000000000202e <sendfile>:
+SYSCALL(sendfile)
+    202e:	b8 20 00 00 00       	mov    $0x20,%eax
+    2033:	49 89 ca             	mov    %rcx,%r10
+    2036:	0f 05                	syscall
+    2038:	c3                   	ret
+
+0000000000002039 <splice>:
+SYSCALL(splice)
+    2039:	b8 21 00 00 00       	mov    $0x21,%eax
+    203e:	49 89 ca             	mov    %rcx,%r10
+    2041:	0f 05                	syscall
+    2043:	c3                   	ret
+
+0000000000002044 <poll>:
+SYSCALL(poll)
+    2044:	b8 22 00 00 00       	mov    $0x22,%eax
+    2049:	49 89 ca             	mov    %rcx,%r10
+    204c:	0f 05                	syscall
+    204e:	c3                   	ret
+
+000000000000204f <fsync>:
+SYSCALL(fsync)
+    204f:	b8 23 00 00 00       	mov    $0x23,%eax
+    2054:	49 89 ca             	mov    %rcx,%r10
+    2057:	0f 05                	syscall
+    2059:	c3                   	ret
+
+000000000000205a <fdatasync>:
+SYSCALL(fdatasync)
+    205a:	b8 24 00 00 00       	mov    $0x24,%eax
+    205f:	49 89 ca             	mov    %rcx,%r10
+    2062:	0f 05                	syscall
+    2064:	c3                   	ret
+
+0000000000002065 <lockstat>:
+SYSCALL(lockstat)
+    2065:	b8 25 00 00 00       	mov    $0x25,%eax
+    206a:	49 89 ca             	mov    %rcx,%r10
+    206d:	0f 05                	syscall
+    206f:	c3                   	ret
+
+0000000000002070 <syscallstat>:
+SYSCALL(syscallstat)
+    2070:	b8 26 00 00 00       	mov    $0x26,%eax
+    2075:	49 89 ca             	mov    %rcx,%r10
+    2078:	0f 05                	syscall
+    207a:	c3                   	ret
+
+000000000000207b <trace>:
+SYSCALL(trace)
+    207b:	b8 27 00 00 00       	mov    $0x27,%eax
+    2080:	49 89 ca             	mov    %rcx,%r10
+    2083:	0f 05                	syscall
+    2085:	c3                   	ret
+
+0000000000002086 <profile>:
+SYSCALL(profile)
+    2086:	b8 28 00 00 00       	mov    $0x28,%eax
+    208b:	49 89 ca             	mov    %rcx,%r10
+    208e:	0f 05                	syscall
+    2090:	c3                   	ret
+
+0000000000002091 <cycles>:
+SYSCALL(cycles)
+    2091:	b8 29 00 00 00       	mov    $0x29,%eax
+    2096:	49 89 ca             	mov    %rcx,%r10
+    2099:	0f 05                	syscall
+    209b:	c3                   	ret
+
+000000000000209c <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    209c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    20a1:	49 89 ca             	mov    %rcx,%r10
+    20a4:	0f 05                	syscall
+    20a6:	c3                   	ret
+
+00000000000020a7 <consmode>:
+SYSCALL(consmode)
+    20a7:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    20ac:	49 89 ca             	mov    %rcx,%r10
+    20af:	0f 05                	syscall
+    20b1:	c3                   	ret
+
+00000000000020b2 <clone>:
+SYSCALL(clone)
+    20b2:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    20b7:	49 89 ca             	mov    %rcx,%r10
+    20ba:	0f 05                	syscall
+    20bc:	c3                   	ret
+
+00000000000020bd <join>:
+SYSCALL(join)
+    20bd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    20c2:	49 89 ca             	mov    %rcx,%r10
+    20c5:	0f 05                	syscall
+    20c7:	c3                   	ret
+
+00000000000020c8 <futex_wait>:
+SYSCALL(futex_wait)
+    20c8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    20cd:	49 89 ca             	mov    %rcx,%r10
+    20d0:	0f 05                	syscall
+    20d2:	c3                   	ret
+
+00000000000020d3 <futex_wake>:
+SYSCALL(futex_wake)
+    20d3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    20d8:	49 89 ca             	mov    %rcx,%r10
+    20db:	0f 05                	syscall
+    20dd:	c3                   	ret
+
+00000000000020de <shmget>:
+SYSCALL(shmget)
+    20de:	b8 30 00 00 00       	mov    $0x30,%eax
+    20e3:	49 89 ca             	mov    %rcx,%r10
+    20e6:	0f 05                	syscall
+    20e8:	c3                   	ret
+
+00000000000020e9 <shmat>:
+SYSCALL(shmat)
+    20e9:	b8 31 00 00 00       	mov    $0x31,%eax
+    20ee:	49 89 ca             	mov    %rcx,%r10
+    20f1:	0f 05                	syscall
+    20f3:	c3                   	ret
+
+00000000000020f4 <shmdt>:
+SYSCALL(shmdt)
+    20f4:	b8 32 00 00 00       	mov    $0x32,%eax
+    20f9:	49 89 ca             	mov    %rcx,%r10
+    20fc:	0f 05                	syscall
+    20fe:	c3                   	ret
+
+00000000000020ff <ring_setup>:
+SYSCALL(ring_setup)
+    20ff:	b8 33 00 00 00       	mov    $0x33,%eax
+    2104:	49 89 ca             	mov    %rcx,%r10
+    2107:	0f 05                	syscall
+    2109:	c3                   	ret
+
+000000000000210a <ring_enter>:
+SYSCALL(ring_enter)
+    210a:	b8 34 00 00 00       	mov    $0x34,%eax
+    210f:	49 89 ca             	mov    %rcx,%r10
+    2112:	0f 05                	syscall
+    2114:	c3                   	ret
+
+0000000000002115 <getdents>:
+SYSCALL(getdents)
+    2115:	b8 35 00 00 00       	mov    $0x35,%eax
+    211a:	49 89 ca             	mov    %rcx,%r10
+    211d:	0f 05                	syscall
+    211f:	c3                   	ret
+
+0000000000002120 <fstatat>:
+SYSCALL(fstatat)
+    2120:	b8 36 00 00 00       	mov    $0x36,%eax
+    2125:	49 89 ca             	mov    %rcx,%r10
+    2128:	0f 05                	syscall
+    212a:	c3                   	ret
+
+000000000000212b <clone_file>:
+SYSCALL(clone_file)
+    212b:	b8 37 00 00 00       	mov    $0x37,%eax
+    2130:	49 89 ca             	mov    %rcx,%r10
+    2133:	0f 05                	syscall
+    2135:	c3                   	ret
+
+0000000000002136 <fpunch>:
+SYSCALL(fpunch)
+    2136:	b8 38 00 00 00       	mov    $0x38,%eax
+    213b:	49 89 ca             	mov    %rcx,%r10
+    213e:	0f 05                	syscall
+    2140:	c3                   	ret
+
+0000000000002141 <defrag>:
+SYSCALL(defrag)
+    2141:	b8 39 00 00 00       	mov    $0x39,%eax
+    2146:	49 89 ca             	mov    %rcx,%r10
+    2149:	0f 05                	syscall
+    214b:	c3                   	ret
+
+000000000000214c <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    214c:	55                   	push   %rbp
+    214d:	48 89 e5             	mov    %rsp,%rbp
+    2150:	48 83 ec 20          	sub    $0x20,%rsp
+    2154:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    2158:	bf 00 00 00 00       	mov    $0x0,%edi
+    215d:	e8 3d fe ff ff       	call   1f9f <sbrk>
+    2162:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    2166:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    216a:	48 f7 d8             	neg    %rax
+    216d:	25 ff 0f 00 00       	and    $0xfff,%eax
+    2172:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    2176:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    217a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    217e:	48 01 c2             	add    %rax,%rdx
+    2181:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    2186:	48 39 c2             	cmp    %rax,%rdx
+    2189:	73 1e                	jae    21a9 <morecore+0x5d>
+    218b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    218f:	89 c2                	mov    %eax,%edx
+    2191:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2195:	01 d0                	add    %edx,%eax
+    2197:	89 c7                	mov    %eax,%edi
+    2199:	e8 01 fe ff ff       	call   1f9f <sbrk>
+    219e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21a2:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    21a7:	75 07                	jne    21b0 <morecore+0x64>
+    return 0;
+    21a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    21ae:	eb 27                	jmp    21d7 <morecore+0x8b>
+  stats.heap += n + pad;
+    21b0:	48 8b 05 d9 26 00 00 	mov    0x26d9(%rip),%rax        # 4890 <stats+0x50>
+    21b7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    21bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    21bf:	48 01 ca             	add    %rcx,%rdx
+    21c2:	48 01 d0             	add    %rdx,%rax
+    21c5:	48 89 05 c4 26 00 00 	mov    %rax,0x26c4(%rip)        # 4890 <stats+0x50>
+  return p + pad;
+    21cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    21d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21d4:	48 01 d0             	add    %rdx,%rax
+}
+    21d7:	c9                   	leave
+    21d8:	c3                   	ret
+
+00000000000021d9 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    21d9:	55                   	push   %rbp
+    21da:	48 89 e5             	mov    %rsp,%rbp
+    21dd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    21e1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    21e5:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    21ec:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    21ed:	48 8d 05 2c 26 00 00 	lea    0x262c(%rip),%rax        # 4820 <runs>
+    21f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21f8:	eb 1a                	jmp    2214 <pagefree+0x3b>
+    prev = *rp;
+    21fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21fe:	48 8b 00             	mov    (%rax),%rax
+    2201:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2205:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2209:	48 8b 00             	mov    (%rax),%rax
+    220c:	48 83 c0 08          	add    $0x8,%rax
+    2210:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2214:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2218:	48 8b 00             	mov    (%rax),%rax
+    221b:	48 85 c0             	test   %rax,%rax
+    221e:	74 0d                	je     222d <pagefree+0x54>
+    2220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2224:	48 8b 00             	mov    (%rax),%rax
+    2227:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    222b:	72 cd                	jb     21fa <pagefree+0x21>
+  r = (struct run *)p;
+    222d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2231:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    2235:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2239:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    223d:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    2240:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2244:	48 8b 10             	mov    (%rax),%rdx
+    2247:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    224b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    224f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2253:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2257:	48 85 c0             	test   %rax,%rax
+    225a:	74 48                	je     22a4 <pagefree+0xcb>
+    225c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2260:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2264:	48 01 c2             	add    %rax,%rdx
+    2267:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    226b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    226f:	48 39 c2             	cmp    %rax,%rdx
+    2272:	75 30                	jne    22a4 <pagefree+0xcb>
+    r->size += r->next->size;
+    2274:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2278:	48 8b 10             	mov    (%rax),%rdx
+    227b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    227f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2283:	48 8b 00             	mov    (%rax),%rax
+    2286:	48 01 c2             	add    %rax,%rdx
+    2289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    228d:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    2290:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2294:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2298:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    229c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22a0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    22a4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    22a9:	74 46                	je     22f1 <pagefree+0x118>
+    22ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22af:	48 8b 10             	mov    (%rax),%rdx
+    22b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22b6:	48 01 d0             	add    %rdx,%rax
+    22b9:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    22bd:	75 32                	jne    22f1 <pagefree+0x118>
+    prev->size += r->size;
+    22bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22c3:	48 8b 10             	mov    (%rax),%rdx
+    22c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22ca:	48 8b 00             	mov    (%rax),%rax
+    22cd:	48 01 c2             	add    %rax,%rdx
+    22d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22d4:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    22d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22db:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    22df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22e3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    22e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22eb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    22ef:	eb 0c                	jmp    22fd <pagefree+0x124>
+  } else {
+    *rp = r;
+    22f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    22f9:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    22fc:	90                   	nop
+    22fd:	90                   	nop
+    22fe:	5d                   	pop    %rbp
+    22ff:	c3                   	ret
+
+0000000000002300 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    2300:	55                   	push   %rbp
+    2301:	48 89 e5             	mov    %rsp,%rbp
+    2304:	48 83 ec 40          	sub    $0x40,%rsp
+    2308:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    230c:	48 8d 05 0d 25 00 00 	lea    0x250d(%rip),%rax        # 4820 <runs>
+    2313:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2317:	eb 66                	jmp    237f <pagealloc+0x7f>
+    if (r->size == n) {
+    2319:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    231d:	48 8b 00             	mov    (%rax),%rax
+    2320:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2324:	75 18                	jne    233e <pagealloc+0x3e>
+      *rp = r->next;
+    2326:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    232a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    232e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2332:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    2335:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2339:	e9 ca 00 00 00       	jmp    2408 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    233e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2342:	48 8b 00             	mov    (%rax),%rax
+    2345:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2349:	73 28                	jae    2373 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    234b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    234f:	48 8b 00             	mov    (%rax),%rax
+    2352:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2356:	48 89 c2             	mov    %rax,%rdx
+    2359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    235d:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    2360:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2364:	48 8b 10             	mov    (%rax),%rdx
+    2367:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    236b:	48 01 d0             	add    %rdx,%rax
+    236e:	e9 95 00 00 00       	jmp    2408 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2373:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2377:	48 83 c0 08          	add    $0x8,%rax
+    237b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    237f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2383:	48 8b 00             	mov    (%rax),%rax
+    2386:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    238a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    238f:	75 88                	jne    2319 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    2391:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2395:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2399:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    23a0:	00 
+    23a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    23a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    23a9:	48 39 c2             	cmp    %rax,%rdx
+    23ac:	48 0f 43 c2          	cmovae %rdx,%rax
+    23b0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    23b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23b8:	48 89 c7             	mov    %rax,%rdi
+    23bb:	e8 8c fd ff ff       	call   214c <morecore>
+    23c0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    23c4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    23c9:	75 07                	jne    23d2 <pagealloc+0xd2>
+    return 0;
+    23cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    23d0:	eb 36                	jmp    2408 <pagealloc+0x108>
+  if (m > n)
+    23d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23d6:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    23da:	73 1a                	jae    23f6 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    23dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23e0:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    23e4:	48 89 c2             	mov    %rax,%rdx
+    23e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    23eb:	48 89 d6             	mov    %rdx,%rsi
+    23ee:	48 89 c7             	mov    %rax,%rdi
+    23f1:	e8 e3 fd ff ff       	call   21d9 <pagefree>
+  return p + m - n;
+    23f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    23fa:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    23fe:	48 89 c2             	mov    %rax,%rdx
+    2401:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2405:	48 01 d0             	add    %rdx,%rax
+}
+    2408:	c9                   	leave
+    2409:	c3                   	ret
+
+000000000000240a <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    240a:	55                   	push   %rbp
+    240b:	48 89 e5             	mov    %rsp,%rbp
+    240e:	48 83 ec 30          	sub    $0x30,%rsp
+    2412:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    2415:	bf 00 10 00 00       	mov    $0x1000,%edi
+    241a:	e8 e1 fe ff ff       	call   2300 <pagealloc>
+    241f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2423:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2428:	75 0a                	jne    2434 <refill+0x2a>
+    return -1;
+    242a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    242f:	e9 da 00 00 00       	jmp    250e <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2434:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    243b:	00 
+    243c:	e9 ba 00 00 00       	jmp    24fb <refill+0xf1>
+    b = (struct block *)(p + off);
+    2441:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2445:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2449:	48 01 d0             	add    %rdx,%rax
+    244c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    2450:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2453:	ba 20 00 00 00       	mov    $0x20,%edx
+    2458:	89 c1                	mov    %eax,%ecx
+    245a:	48 d3 e2             	shl    %cl,%rdx
+    245d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2461:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    2464:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2467:	48 63 d0             	movslq %eax,%rdx
+    246a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    246e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    2472:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2475:	48 98                	cltq
+    2477:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    247e:	00 
+    247f:	48 8d 05 5a 23 00 00 	lea    0x235a(%rip),%rax        # 47e0 <freelist>
+    2486:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    248a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    248e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    2492:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2495:	48 98                	cltq
+    2497:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    249e:	00 
+    249f:	48 8d 15 3a 23 00 00 	lea    0x233a(%rip),%rdx        # 47e0 <freelist>
+    24a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24aa:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    24ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    24b1:	48 98                	cltq
+    24b3:	48 83 c0 08          	add    $0x8,%rax
+    24b7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    24be:	00 
+    24bf:	48 8d 05 7e 23 00 00 	lea    0x237e(%rip),%rax        # 4844 <stats+0x4>
+    24c6:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    24c9:	8d 48 01             	lea    0x1(%rax),%ecx
+    24cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    24cf:	48 98                	cltq
+    24d1:	48 83 c0 08          	add    $0x8,%rax
+    24d5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    24dc:	00 
+    24dd:	48 8d 05 60 23 00 00 	lea    0x2360(%rip),%rax        # 4844 <stats+0x4>
+    24e4:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    24e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    24ea:	ba 20 00 00 00       	mov    $0x20,%edx
+    24ef:	89 c1                	mov    %eax,%ecx
+    24f1:	48 d3 e2             	shl    %cl,%rdx
+    24f4:	48 89 d0             	mov    %rdx,%rax
+    24f7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    24fb:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    2502:	00 
+    2503:	0f 86 38 ff ff ff    	jbe    2441 <refill+0x37>
+  }
+  return 0;
+    2509:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    250e:	c9                   	leave
+    250f:	c3                   	ret
+
+0000000000002510 <malloc>:
+
+void *malloc(uint nbytes) {
+    2510:	55                   	push   %rbp
+    2511:	48 89 e5             	mov    %rsp,%rbp
+    2514:	48 83 ec 30          	sub    $0x30,%rsp
+    2518:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    251b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    251e:	48 83 c0 10          	add    $0x10,%rax
+    2522:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    2526:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    252d:	eb 04                	jmp    2533 <malloc+0x23>
+    252f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2533:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    2537:	7f 16                	jg     254f <malloc+0x3f>
+    2539:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    253c:	ba 20 00 00 00       	mov    $0x20,%edx
+    2541:	89 c1                	mov    %eax,%ecx
+    2543:	48 d3 e2             	shl    %cl,%rdx
+    2546:	48 89 d0             	mov    %rdx,%rax
+    2549:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    254d:	72 e0                	jb     252f <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    254f:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    2553:	75 7d                	jne    25d2 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    2555:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2559:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    255f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    2565:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    2569:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    256d:	48 89 c7             	mov    %rax,%rdi
+    2570:	e8 8b fd ff ff       	call   2300 <pagealloc>
+    2575:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2579:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    257e:	75 0a                	jne    258a <malloc+0x7a>
+      return 0;
+    2580:	b8 00 00 00 00       	mov    $0x0,%eax
+    2585:	e9 2c 01 00 00       	jmp    26b6 <malloc+0x1a6>
+    h->size = n;
+    258a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    258e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2592:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    2595:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2599:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    25a0:	00 
+    stats.inuse[LARGE]++;
+    25a1:	8b 05 b9 22 00 00    	mov    0x22b9(%rip),%eax        # 4860 <stats+0x20>
+    25a7:	83 c0 01             	add    $0x1,%eax
+    25aa:	89 05 b0 22 00 00    	mov    %eax,0x22b0(%rip)        # 4860 <stats+0x20>
+    stats.large += n;
+    25b0:	48 8b 15 d1 22 00 00 	mov    0x22d1(%rip),%rdx        # 4888 <stats+0x48>
+    25b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25bb:	48 01 d0             	add    %rdx,%rax
+    25be:	48 89 05 c3 22 00 00 	mov    %rax,0x22c3(%rip)        # 4888 <stats+0x48>
+    return h + 1;
+    25c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25c9:	48 83 c0 10          	add    $0x10,%rax
+    25cd:	e9 e4 00 00 00       	jmp    26b6 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    25d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    25d5:	48 98                	cltq
+    25d7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    25de:	00 
+    25df:	48 8d 05 fa 21 00 00 	lea    0x21fa(%rip),%rax        # 47e0 <freelist>
+    25e6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    25ea:	48 85 c0             	test   %rax,%rax
+    25ed:	75 18                	jne    2607 <malloc+0xf7>
+    25ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    25f2:	89 c7                	mov    %eax,%edi
+    25f4:	e8 11 fe ff ff       	call   240a <refill>
+    25f9:	85 c0                	test   %eax,%eax
+    25fb:	79 0a                	jns    2607 <malloc+0xf7>
+    return 0;
+    25fd:	b8 00 00 00 00       	mov    $0x0,%eax
+    2602:	e9 af 00 00 00       	jmp    26b6 <malloc+0x1a6>
+  b = freelist[c];
+    2607:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    260a:	48 98                	cltq
+    260c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2613:	00 
+    2614:	48 8d 05 c5 21 00 00 	lea    0x21c5(%rip),%rax        # 47e0 <freelist>
+    261b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    261f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    2623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2627:	48 8b 40 10          	mov    0x10(%rax),%rax
+    262b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    262e:	48 63 d2             	movslq %edx,%rdx
+    2631:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2638:	00 
+    2639:	48 8d 15 a0 21 00 00 	lea    0x21a0(%rip),%rdx        # 47e0 <freelist>
+    2640:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    2644:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2647:	48 98                	cltq
+    2649:	48 83 c0 08          	add    $0x8,%rax
+    264d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2654:	00 
+    2655:	48 8d 05 e8 21 00 00 	lea    0x21e8(%rip),%rax        # 4844 <stats+0x4>
+    265c:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    265f:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2662:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2665:	48 98                	cltq
+    2667:	48 83 c0 08          	add    $0x8,%rax
+    266b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2672:	00 
+    2673:	48 8d 05 ca 21 00 00 	lea    0x21ca(%rip),%rax        # 4844 <stats+0x4>
+    267a:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    267d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2680:	48 98                	cltq
+    2682:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2689:	00 
+    268a:	48 8d 05 af 21 00 00 	lea    0x21af(%rip),%rax        # 4840 <stats>
+    2691:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2694:	8d 48 01             	lea    0x1(%rax),%ecx
+    2697:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    269a:	48 98                	cltq
+    269c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    26a3:	00 
+    26a4:	48 8d 05 95 21 00 00 	lea    0x2195(%rip),%rax        # 4840 <stats>
+    26ab:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    26ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26b2:	48 83 c0 10          	add    $0x10,%rax
+}
+    26b6:	c9                   	leave
+    26b7:	c3                   	ret
+
+00000000000026b8 <free>:
+
+void free(void *ap) {
+    26b8:	55                   	push   %rbp
+    26b9:	48 89 e5             	mov    %rsp,%rbp
+    26bc:	48 83 ec 18          	sub    $0x18,%rsp
+    26c0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    26c4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    26c9:	0f 84 03 01 00 00    	je     27d2 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    26cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26d3:	48 83 e8 10          	sub    $0x10,%rax
+    26d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    26db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26df:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    26e7:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    26ec:	75 42                	jne    2730 <free+0x78>
+    stats.inuse[LARGE]--;
+    26ee:	8b 05 6c 21 00 00    	mov    0x216c(%rip),%eax        # 4860 <stats+0x20>
+    26f4:	83 e8 01             	sub    $0x1,%eax
+    26f7:	89 05 63 21 00 00    	mov    %eax,0x2163(%rip)        # 4860 <stats+0x20>
+    stats.large -= b->h.size;
+    26fd:	48 8b 15 84 21 00 00 	mov    0x2184(%rip),%rdx        # 4888 <stats+0x48>
+    2704:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2708:	48 8b 00             	mov    (%rax),%rax
+    270b:	48 29 c2             	sub    %rax,%rdx
+    270e:	48 89 15 73 21 00 00 	mov    %rdx,0x2173(%rip)        # 4888 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    2715:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2719:	48 8b 10             	mov    (%rax),%rdx
+    271c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2720:	48 89 d6             	mov    %rdx,%rsi
+    2723:	48 89 c7             	mov    %rax,%rdi
+    2726:	e8 ae fa ff ff       	call   21d9 <pagefree>
+    return;
+    272b:	e9 a3 00 00 00       	jmp    27d3 <free+0x11b>
+  }
+  b->next = freelist[c];
+    2730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2734:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    273b:	00 
+    273c:	48 8d 05 9d 20 00 00 	lea    0x209d(%rip),%rax        # 47e0 <freelist>
+    2743:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2747:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    274b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    274f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2753:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    275a:	00 
+    275b:	48 8d 15 7e 20 00 00 	lea    0x207e(%rip),%rdx        # 47e0 <freelist>
+    2762:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2766:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    276a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    276e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2775:	00 
+    2776:	48 8d 05 c3 20 00 00 	lea    0x20c3(%rip),%rax        # 4840 <stats>
+    277d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2780:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2783:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2787:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    278e:	00 
+    278f:	48 8d 05 aa 20 00 00 	lea    0x20aa(%rip),%rax        # 4840 <stats>
+    2796:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    2799:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    279d:	48 83 c0 08          	add    $0x8,%rax
+    27a1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    27a8:	00 
+    27a9:	48 8d 05 94 20 00 00 	lea    0x2094(%rip),%rax        # 4844 <stats+0x4>
+    27b0:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    27b3:	8d 48 01             	lea    0x1(%rax),%ecx
+    27b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27ba:	48 83 c0 08          	add    $0x8,%rax
+    27be:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    27c5:	00 
+    27c6:	48 8d 05 77 20 00 00 	lea    0x2077(%rip),%rax        # 4844 <stats+0x4>
+    27cd:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    27d0:	eb 01                	jmp    27d3 <free+0x11b>
+    return;
+    27d2:	90                   	nop
+}
+    27d3:	c9                   	leave
+    27d4:	c3                   	ret
+
+00000000000027d5 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    27d5:	55                   	push   %rbp
+    27d6:	48 89 e5             	mov    %rsp,%rbp
+    27d9:	48 83 ec 30          	sub    $0x30,%rsp
+    27dd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    27e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    27e3:	48 8d 15 5e 04 00 00 	lea    0x45e(%rip),%rdx        # 2c48 <benchreport+0x34b>
+    27ea:	48 89 d6             	mov    %rdx,%rsi
+    27ed:	89 c7                	mov    %eax,%edi
+    27ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    27f4:	e8 37 e6 ff ff       	call   e30 <printf>
+  for (c = 0; c < NCLASS; c++)
+    27f9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2800:	eb 67                	jmp    2869 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2802:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2805:	48 98                	cltq
+    2807:	48 83 c0 08          	add    $0x8,%rax
+    280b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2812:	00 
+    2813:	48 8d 05 2a 20 00 00 	lea    0x202a(%rip),%rax        # 4844 <stats+0x4>
+    281a:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    281d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2820:	48 98                	cltq
+    2822:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2829:	00 
+    282a:	48 8d 05 0f 20 00 00 	lea    0x200f(%rip),%rax        # 4840 <stats>
+    2831:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    2834:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2837:	ba 20 00 00 00       	mov    $0x20,%edx
+    283c:	89 c1                	mov    %eax,%ecx
+    283e:	48 d3 e2             	shl    %cl,%rdx
+    2841:	48 89 d0             	mov    %rdx,%rax
+    2844:	89 c1                	mov    %eax,%ecx
+    2846:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2849:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    284c:	41 89 f9             	mov    %edi,%r9d
+    284f:	41 89 f0             	mov    %esi,%r8d
+    2852:	48 8d 35 06 04 00 00 	lea    0x406(%rip),%rsi        # 2c5f <benchreport+0x362>
+    2859:	89 c7                	mov    %eax,%edi
+    285b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2860:	e8 cb e5 ff ff       	call   e30 <printf>
+  for (c = 0; c < NCLASS; c++)
+    2865:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    2869:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    286d:	7e 93                	jle    2802 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    286f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2876:	00 
+  for (r = runs; r; r = r->next)
+    2877:	48 8b 05 a2 1f 00 00 	mov    0x1fa2(%rip),%rax        # 4820 <runs>
+    287e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2882:	eb 17                	jmp    289b <mallocstats+0xc6>
+    nfree += r->size;
+    2884:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2888:	48 8b 00             	mov    (%rax),%rax
+    288b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    288f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2893:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2897:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    289b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    28a0:	75 e2                	jne    2884 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    28a2:	48 8b 05 e7 1f 00 00 	mov    0x1fe7(%rip),%rax        # 4890 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    28a9:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    28ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28af:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    28b3:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    28b5:	48 8b 05 cc 1f 00 00 	mov    0x1fcc(%rip),%rax        # 4888 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    28bc:	89 c1                	mov    %eax,%ecx
+    28be:	8b 15 9c 1f 00 00    	mov    0x1f9c(%rip),%edx        # 4860 <stats+0x20>
+    28c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28c7:	41 89 f9             	mov    %edi,%r9d
+    28ca:	41 89 f0             	mov    %esi,%r8d
+    28cd:	48 8d 35 9c 03 00 00 	lea    0x39c(%rip),%rsi        # 2c70 <benchreport+0x373>
+    28d4:	89 c7                	mov    %eax,%edi
+    28d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    28db:	e8 50 e5 ff ff       	call   e30 <printf>
+}
+    28e0:	90                   	nop
+    28e1:	c9                   	leave
+    28e2:	c3                   	ret
+
+00000000000028e3 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    28e3:	55                   	push   %rbp
+    28e4:	48 89 e5             	mov    %rsp,%rbp
+    28e7:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    28eb:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    28ef:	48 89 c7             	mov    %rax,%rdi
+    28f2:	e8 9a f7 ff ff       	call   2091 <cycles>
+  return t;
+    28f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    28fb:	c9                   	leave
+    28fc:	c3                   	ret
+
+00000000000028fd <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    28fd:	55                   	push   %rbp
+    28fe:	48 89 e5             	mov    %rsp,%rbp
+    2901:	48 83 ec 30          	sub    $0x30,%rsp
+    2905:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2909:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    290d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    2910:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2914:	0f 8e 24 01 00 00    	jle    2a3e <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    291a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2921:	e9 98 00 00 00       	jmp    29be <benchreport+0xc1>
+    x = t[i];
+    2926:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2929:	48 98                	cltq
+    292b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2932:	00 
+    2933:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2937:	48 01 d0             	add    %rdx,%rax
+    293a:	48 8b 00             	mov    (%rax),%rax
+    293d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2941:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2944:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2947:	eb 33                	jmp    297c <benchreport+0x7f>
+      t[j] = t[j - 1];
+    2949:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    294c:	48 98                	cltq
+    294e:	48 c1 e0 03          	shl    $0x3,%rax
+    2952:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2956:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    295a:	48 01 d0             	add    %rdx,%rax
+    295d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2960:	48 63 d2             	movslq %edx,%rdx
+    2963:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    296a:	00 
+    296b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    296f:	48 01 ca             	add    %rcx,%rdx
+    2972:	48 8b 00             	mov    (%rax),%rax
+    2975:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2978:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    297c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2980:	7e 1d                	jle    299f <benchreport+0xa2>
+    2982:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2985:	48 98                	cltq
+    2987:	48 c1 e0 03          	shl    $0x3,%rax
+    298b:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    298f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2993:	48 01 d0             	add    %rdx,%rax
+    2996:	48 8b 00             	mov    (%rax),%rax
+    2999:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    299d:	72 aa                	jb     2949 <benchreport+0x4c>
+    t[j] = x;
+    299f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    29a2:	48 98                	cltq
+    29a4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    29ab:	00 
+    29ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29b0:	48 01 c2             	add    %rax,%rdx
+    29b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29b7:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    29ba:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    29be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    29c1:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    29c4:	0f 8c 5c ff ff ff    	jl     2926 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    29ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    29cd:	48 98                	cltq
+    29cf:	48 c1 e0 03          	shl    $0x3,%rax
+    29d3:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    29d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29db:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    29de:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    29e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    29e4:	89 c2                	mov    %eax,%edx
+    29e6:	c1 ea 1f             	shr    $0x1f,%edx
+    29e9:	01 d0                	add    %edx,%eax
+    29eb:	d1 f8                	sar    %eax
+    29ed:	48 98                	cltq
+    29ef:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    29f6:	00 
+    29f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29fb:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    29fe:	48 8b 38             	mov    (%rax),%rdi
+    2a01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a05:	48 8b 30             	mov    (%rax),%rsi
+    2a08:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2a0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a0f:	48 83 ec 08          	sub    $0x8,%rsp
+    2a13:	51                   	push   %rcx
+    2a14:	49 89 f9             	mov    %rdi,%r9
+    2a17:	49 89 f0             	mov    %rsi,%r8
+    2a1a:	89 d1                	mov    %edx,%ecx
+    2a1c:	48 89 c2             	mov    %rax,%rdx
+    2a1f:	48 8d 05 8a 02 00 00 	lea    0x28a(%rip),%rax        # 2cb0 <benchreport+0x3b3>
+    2a26:	48 89 c6             	mov    %rax,%rsi
+    2a29:	bf 01 00 00 00       	mov    $0x1,%edi
+    2a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a33:	e8 f8 e3 ff ff       	call   e30 <printf>
+    2a38:	48 83 c4 10          	add    $0x10,%rsp
+    2a3c:	eb 01                	jmp    2a3f <benchreport+0x142>
+    return;
+    2a3e:	90                   	nop
+}
+    2a3f:	c9                   	leave
+    2a40:	c3                   	ret
@@ -0,0 +1,4115 @@
+
+out/user/_grep:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <compile>:
+static int literal;    // the pattern has no operators
+static int patlen;
+static int shift[256]; // Horspool's skip for each byte
+
+// Get ready to search for pattern as a string, if it is one.
+static void compile(char *pattern) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+
+  literal = strchr(pattern, '^') == 0 && strchr(pattern, '.') == 0 &&
+       c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      10:	be 5e 00 00 00       	mov    $0x5e,%esi
+      15:	48 89 c7             	mov    %rax,%rdi
+      18:	e8 93 14 00 00       	call   14b0 <strchr>
+            strchr(pattern, '*') == 0 && strchr(pattern, '$') == 0;
+      1d:	48 85 c0             	test   %rax,%rax
+      20:	75 49                	jne    6b <compile+0x6b>
+  literal = strchr(pattern, '^') == 0 && strchr(pattern, '.') == 0 &&
+      22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      26:	be 2e 00 00 00       	mov    $0x2e,%esi
+      2b:	48 89 c7             	mov    %rax,%rdi
+      2e:	e8 7d 14 00 00       	call   14b0 <strchr>
+      33:	48 85 c0             	test   %rax,%rax
+      36:	75 33                	jne    6b <compile+0x6b>
+            strchr(pattern, '*') == 0 && strchr(pattern, '$') == 0;
+      38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      3c:	be 2a 00 00 00       	mov    $0x2a,%esi
+      41:	48 89 c7             	mov    %rax,%rdi
+      44:	e8 67 14 00 00       	call   14b0 <strchr>
+  literal = strchr(pattern, '^') == 0 && strchr(pattern, '.') == 0 &&
+      49:	48 85 c0             	test   %rax,%rax
+      4c:	75 1d                	jne    6b <compile+0x6b>
+            strchr(pattern, '*') == 0 && strchr(pattern, '$') == 0;
+      4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      52:	be 24 00 00 00       	mov    $0x24,%esi
+      57:	48 89 c7             	mov    %rax,%rdi
+      5a:	e8 51 14 00 00       	call   14b0 <strchr>
+      5f:	48 85 c0             	test   %rax,%rax
+      62:	75 07                	jne    6b <compile+0x6b>
+      64:	b8 01 00 00 00       	mov    $0x1,%eax
+      69:	eb 05                	jmp    70 <compile+0x70>
+      6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  literal = strchr(pattern, '^') == 0 && strchr(pattern, '.') == 0 &&
+      70:	89 05 ce 2f 01 00    	mov    %eax,0x12fce(%rip)        # 13044 <literal>
+  patlen = strlen(pattern);
+      76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      7a:	48 89 c7             	mov    %rax,%rdi
+      7d:	e8 f9 12 00 00       	call   137b <strlen>
+      82:	89 05 c0 2f 01 00    	mov    %eax,0x12fc0(%rip)        # 13048 <patlen>
+  for (i = 0; i < 256; i++)
+      88:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      8f:	eb 22                	jmp    b3 <compile+0xb3>
+    shift[i] = patlen;
+      91:	8b 05 b1 2f 01 00    	mov    0x12fb1(%rip),%eax        # 13048 <patlen>
+      97:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      9a:	48 63 d2             	movslq %edx,%rdx
+      9d:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+      a4:	00 
+      a5:	48 8d 15 b4 2f 01 00 	lea    0x12fb4(%rip),%rdx        # 13060 <shift>
+      ac:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+  for (i = 0; i < 256; i++)
+      af:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      b3:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+      ba:	7e d5                	jle    91 <compile+0x91>
+  for (i = 0; i + 1 < patlen; i++)
+      bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      c3:	eb 38                	jmp    fd <compile+0xfd>
+    shift[(uchar)pattern[i]] = patlen - 1 - i;
+      c5:	8b 05 7d 2f 01 00    	mov    0x12f7d(%rip),%eax        # 13048 <patlen>
+      cb:	83 e8 01             	sub    $0x1,%eax
+      ce:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      d1:	48 63 ca             	movslq %edx,%rcx
+      d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+      d8:	48 01 ca             	add    %rcx,%rdx
+      db:	0f b6 12             	movzbl (%rdx),%edx
+      de:	0f b6 d2             	movzbl %dl,%edx
+      e1:	2b 45 fc             	sub    -0x4(%rbp),%eax
+      e4:	48 63 d2             	movslq %edx,%rdx
+      e7:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+      ee:	00 
+      ef:	48 8d 15 6a 2f 01 00 	lea    0x12f6a(%rip),%rdx        # 13060 <shift>
+      f6:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+  for (i = 0; i + 1 < patlen; i++)
+      f9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     100:	8d 50 01             	lea    0x1(%rax),%edx
+     103:	8b 05 3f 2f 01 00    	mov    0x12f3f(%rip),%eax        # 13048 <patlen>
+     109:	39 c2                	cmp    %eax,%edx
+     10b:	7c b8                	jl     c5 <compile+0xc5>
+}
+     10d:	90                   	nop
+     10e:	90                   	nop
+     10f:	c9                   	leave
+     110:	c3                   	ret
+
+0000000000000111 <search>:
+
+// The first occurrence of the literal pattern in the n bytes at s,
+// or 0.
+static char *search(char *pattern, char *s, int n) {
+     111:	55                   	push   %rbp
+     112:	48 89 e5             	mov    %rsp,%rbp
+     115:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     119:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     11d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char last;
+  int i, j;
+
+  if (patlen == 0)
+     120:	8b 05 22 2f 01 00    	mov    0x12f22(%rip),%eax        # 13048 <patlen>
+     126:	85 c0                	test   %eax,%eax
+     128:	75 09                	jne    133 <search+0x22>
+    return s;
+     12a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     12e:	e9 f5 00 00 00       	jmp    228 <search+0x117>
+  last = pattern[patlen - 1];
+     133:	8b 05 0f 2f 01 00    	mov    0x12f0f(%rip),%eax        # 13048 <patlen>
+     139:	48 98                	cltq
+     13b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+     13f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     143:	48 01 d0             	add    %rdx,%rax
+     146:	0f b6 00             	movzbl (%rax),%eax
+     149:	88 45 f7             	mov    %al,-0x9(%rbp)
+  for (i = 0; i + patlen <= n; i += shift[(uchar)s[i + patlen - 1]]) {
+     14c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     153:	e9 b7 00 00 00       	jmp    20f <search+0xfe>
+    if (s[i + patlen - 1] != last)
+     158:	8b 15 ea 2e 01 00    	mov    0x12eea(%rip),%edx        # 13048 <patlen>
+     15e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     161:	01 d0                	add    %edx,%eax
+     163:	48 98                	cltq
+     165:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+     169:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     16d:	48 01 d0             	add    %rdx,%rax
+     170:	0f b6 00             	movzbl (%rax),%eax
+     173:	38 45 f7             	cmp    %al,-0x9(%rbp)
+     176:	75 61                	jne    1d9 <search+0xc8>
+      continue;
+    for (j = 0; j < patlen - 1 && s[i + j] == pattern[j]; j++)
+     178:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     17f:	eb 04                	jmp    185 <search+0x74>
+     181:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     185:	8b 05 bd 2e 01 00    	mov    0x12ebd(%rip),%eax        # 13048 <patlen>
+     18b:	83 e8 01             	sub    $0x1,%eax
+     18e:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     191:	7d 29                	jge    1bc <search+0xab>
+     193:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     196:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     199:	01 d0                	add    %edx,%eax
+     19b:	48 63 d0             	movslq %eax,%rdx
+     19e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1a2:	48 01 d0             	add    %rdx,%rax
+     1a5:	0f b6 10             	movzbl (%rax),%edx
+     1a8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1ab:	48 63 c8             	movslq %eax,%rcx
+     1ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1b2:	48 01 c8             	add    %rcx,%rax
+     1b5:	0f b6 00             	movzbl (%rax),%eax
+     1b8:	38 c2                	cmp    %al,%dl
+     1ba:	74 c5                	je     181 <search+0x70>
+      ;
+    if (j == patlen - 1)
+     1bc:	8b 05 86 2e 01 00    	mov    0x12e86(%rip),%eax        # 13048 <patlen>
+     1c2:	83 e8 01             	sub    $0x1,%eax
+     1c5:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     1c8:	75 10                	jne    1da <search+0xc9>
+      return s + i;
+     1ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1cd:	48 63 d0             	movslq %eax,%rdx
+     1d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1d4:	48 01 d0             	add    %rdx,%rax
+     1d7:	eb 4f                	jmp    228 <search+0x117>
+      continue;
+     1d9:	90                   	nop
+  for (i = 0; i + patlen <= n; i += shift[(uchar)s[i + patlen - 1]]) {
+     1da:	8b 15 68 2e 01 00    	mov    0x12e68(%rip),%edx        # 13048 <patlen>
+     1e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e3:	01 d0                	add    %edx,%eax
+     1e5:	48 98                	cltq
+     1e7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+     1eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1ef:	48 01 d0             	add    %rdx,%rax
+     1f2:	0f b6 00             	movzbl (%rax),%eax
+     1f5:	0f b6 c0             	movzbl %al,%eax
+     1f8:	48 98                	cltq
+     1fa:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     201:	00 
+     202:	48 8d 05 57 2e 01 00 	lea    0x12e57(%rip),%rax        # 13060 <shift>
+     209:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     20c:	01 45 fc             	add    %eax,-0x4(%rbp)
+     20f:	8b 15 33 2e 01 00    	mov    0x12e33(%rip),%edx        # 13048 <patlen>
+     215:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     218:	01 d0                	add    %edx,%eax
+     21a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+     21d:	0f 8d 35 ff ff ff    	jge    158 <search+0x47>
+  }
+  return 0;
+     223:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     228:	5d                   	pop    %rbp
+     229:	c3                   	ret
+
+000000000000022a <greplines>:
+
+// Print, or count, the lines of [p, end) that match pattern.  Each
+// line ends in a newline.  Returns the number that matched.
+static int greplines(char *pattern, char *p, char *end) {
+     22a:	55                   	push   %rbp
+     22b:	48 89 e5             	mov    %rsp,%rbp
+     22e:	48 83 ec 40          	sub    $0x40,%rsp
+     232:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+     236:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     23a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  char *q, *line;
+  int count = 0;
+     23e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  if (literal) {
+     245:	8b 05 f9 2d 01 00    	mov    0x12df9(%rip),%eax        # 13044 <literal>
+     24b:	85 c0                	test   %eax,%eax
+     24d:	0f 84 34 01 00 00    	je     387 <greplines+0x15d>
+    while (p < end && (q = search(pattern, p, end - p)) != 0) {
+     253:	eb 73                	jmp    2c8 <greplines+0x9e>
+      for (line = q; line > p && line[-1] != '\n'; line--)
+     255:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     259:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     25d:	eb 05                	jmp    264 <greplines+0x3a>
+     25f:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     268:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+     26c:	73 16                	jae    284 <greplines+0x5a>
+     26e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     272:	48 83 e8 01          	sub    $0x1,%rax
+     276:	0f b6 00             	movzbl (%rax),%eax
+     279:	3c 0a                	cmp    $0xa,%al
+     27b:	75 e2                	jne    25f <greplines+0x35>
+        ;
+      while (*q != '\n')
+     27d:	eb 05                	jmp    284 <greplines+0x5a>
+        q++;
+     27f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+      while (*q != '\n')
+     284:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     288:	0f b6 00             	movzbl (%rax),%eax
+     28b:	3c 0a                	cmp    $0xa,%al
+     28d:	75 f0                	jne    27f <greplines+0x55>
+      if (!countonly)
+     28f:	8b 05 ab 2d 01 00    	mov    0x12dab(%rip),%eax        # 13040 <countonly>
+     295:	85 c0                	test   %eax,%eax
+     297:	75 1f                	jne    2b8 <greplines+0x8e>
+        bwrite(1, line, q + 1 - line);
+     299:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     29d:	48 83 c0 01          	add    $0x1,%rax
+     2a1:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+     2a5:	89 c2                	mov    %eax,%edx
+     2a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2ab:	48 89 c6             	mov    %rax,%rsi
+     2ae:	bf 01 00 00 00       	mov    $0x1,%edi
+     2b3:	e8 7f 0b 00 00       	call   e37 <bwrite>
+      count++;
+     2b8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+      p = q + 1;
+     2bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     2c0:	48 83 c0 01          	add    $0x1,%rax
+     2c4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    while (p < end && (q = search(pattern, p, end - p)) != 0) {
+     2c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     2cc:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+     2d0:	73 2c                	jae    2fe <greplines+0xd4>
+     2d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     2d6:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+     2da:	89 c2                	mov    %eax,%edx
+     2dc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     2e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     2e4:	48 89 ce             	mov    %rcx,%rsi
+     2e7:	48 89 c7             	mov    %rax,%rdi
+     2ea:	e8 22 fe ff ff       	call   111 <search>
+     2ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     2f3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     2f8:	0f 85 57 ff ff ff    	jne    255 <greplines+0x2b>
+    }
+    return count;
+     2fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     301:	e9 95 00 00 00       	jmp    39b <greplines+0x171>
+  }
+
+  for (; p < end; p = q + 1) {
+    // A nul byte hides the rest of the line from strchr()
+    if ((q = strchr(p, '\n')) == 0)
+     306:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     30a:	be 0a 00 00 00       	mov    $0xa,%esi
+     30f:	48 89 c7             	mov    %rax,%rdi
+     312:	e8 99 11 00 00       	call   14b0 <strchr>
+     317:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     31b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     320:	74 75                	je     397 <greplines+0x16d>
+      break;
+    *q = 0;
+     322:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     326:	c6 00 00             	movb   $0x0,(%rax)
+    if (match(pattern, p)) {
+     329:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     32d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     331:	48 89 d6             	mov    %rdx,%rsi
+     334:	48 89 c7             	mov    %rax,%rdi
+     337:	e8 66 03 00 00       	call   6a2 <match>
+     33c:	85 c0                	test   %eax,%eax
+     33e:	74 34                	je     374 <greplines+0x14a>
+      if (!countonly) {
+     340:	8b 05 fa 2c 01 00    	mov    0x12cfa(%rip),%eax        # 13040 <countonly>
+     346:	85 c0                	test   %eax,%eax
+     348:	75 26                	jne    370 <greplines+0x146>
+        *q = '\n';
+     34a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     34e:	c6 00 0a             	movb   $0xa,(%rax)
+        bwrite(1, p, q + 1 - p);
+     351:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     355:	48 83 c0 01          	add    $0x1,%rax
+     359:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+     35d:	89 c2                	mov    %eax,%edx
+     35f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     363:	48 89 c6             	mov    %rax,%rsi
+     366:	bf 01 00 00 00       	mov    $0x1,%edi
+     36b:	e8 c7 0a 00 00       	call   e37 <bwrite>
+      }
+      count++;
+     370:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    }
+    *q = '\n';
+     374:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     378:	c6 00 0a             	movb   $0xa,(%rax)
+  for (; p < end; p = q + 1) {
+     37b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     37f:	48 83 c0 01          	add    $0x1,%rax
+     383:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+     387:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     38b:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+     38f:	0f 82 71 ff ff ff    	jb     306 <greplines+0xdc>
+     395:	eb 01                	jmp    398 <greplines+0x16e>
+      break;
+     397:	90                   	nop
+  }
+  return count;
+     398:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+     39b:	c9                   	leave
+     39c:	c3                   	ret
+
+000000000000039d <grep>:
+
+// Returns the number of lines of fd that match pattern.
+int grep(char *pattern, int fd) {
+     39d:	55                   	push   %rbp
+     39e:	48 89 e5             	mov    %rsp,%rbp
+     3a1:	48 83 ec 30          	sub    $0x30,%rsp
+     3a5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+     3a9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  int n, m, count;
+  char *end;
+
+  count = 0;
+     3ac:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  m = 0;
+     3b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ((n = read(fd, buf + m, sizeof(buf) - m - 1)) > 0) {
+     3ba:	e9 c4 00 00 00       	jmp    483 <grep+0xe6>
+    m += n;
+     3bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     3c2:	01 45 fc             	add    %eax,-0x4(%rbp)
+    buf[m] = '\0';
+     3c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3c8:	48 98                	cltq
+     3ca:	48 8d 15 6f 2c 00 00 	lea    0x2c6f(%rip),%rdx        # 3040 <buf>
+     3d1:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+    // Take the whole lines; the rest waits for the next read
+    for (end = buf + m; end > buf && end[-1] != '\n'; end--)
+     3d5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3d8:	48 98                	cltq
+     3da:	48 8d 15 5f 2c 00 00 	lea    0x2c5f(%rip),%rdx        # 3040 <buf>
+     3e1:	48 01 d0             	add    %rdx,%rax
+     3e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     3e8:	eb 05                	jmp    3ef <grep+0x52>
+     3ea:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     3ef:	48 8d 05 4a 2c 00 00 	lea    0x2c4a(%rip),%rax        # 3040 <buf>
+     3f6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+     3fa:	73 0f                	jae    40b <grep+0x6e>
+     3fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     400:	48 83 e8 01          	sub    $0x1,%rax
+     404:	0f b6 00             	movzbl (%rax),%eax
+     407:	3c 0a                	cmp    $0xa,%al
+     409:	75 df                	jne    3ea <grep+0x4d>
+      ;
+    count += greplines(pattern, buf, end);
+     40b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     40f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     413:	48 8d 0d 26 2c 00 00 	lea    0x2c26(%rip),%rcx        # 3040 <buf>
+     41a:	48 89 ce             	mov    %rcx,%rsi
+     41d:	48 89 c7             	mov    %rax,%rdi
+     420:	e8 05 fe ff ff       	call   22a <greplines>
+     425:	01 45 f8             	add    %eax,-0x8(%rbp)
+    if (end == buf && m == sizeof(buf) - 1)
+     428:	48 8d 05 11 2c 00 00 	lea    0x2c11(%rip),%rax        # 3040 <buf>
+     42f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     433:	75 10                	jne    445 <grep+0xa8>
+     435:	81 7d fc ff ff 00 00 	cmpl   $0xffff,-0x4(%rbp)
+     43c:	75 07                	jne    445 <grep+0xa8>
+      m = 0; // a line longer than the buffer is dropped
+     43e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    if (end > buf) {
+     445:	48 8d 05 f4 2b 00 00 	lea    0x2bf4(%rip),%rax        # 3040 <buf>
+     44c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+     450:	73 31                	jae    483 <grep+0xe6>
+      m -= end - buf;
+     452:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     455:	48 8d 15 e4 2b 00 00 	lea    0x2be4(%rip),%rdx        # 3040 <buf>
+     45c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     460:	48 29 d1             	sub    %rdx,%rcx
+     463:	89 ca                	mov    %ecx,%edx
+     465:	29 d0                	sub    %edx,%eax
+     467:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      memmove(buf, end, m);
+     46a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     46d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     471:	48 89 c6             	mov    %rax,%rsi
+     474:	48 8d 05 c5 2b 00 00 	lea    0x2bc5(%rip),%rax        # 3040 <buf>
+     47b:	48 89 c7             	mov    %rax,%rdi
+     47e:	e8 64 11 00 00       	call   15e7 <memmove>
+  while ((n = read(fd, buf + m, sizeof(buf) - m - 1)) > 0) {
+     483:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     486:	ba ff ff 00 00       	mov    $0xffff,%edx
+     48b:	29 c2                	sub    %eax,%edx
+     48d:	89 d6                	mov    %edx,%esi
+     48f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     492:	48 98                	cltq
+     494:	48 8d 15 a5 2b 00 00 	lea    0x2ba5(%rip),%rdx        # 3040 <buf>
+     49b:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+     49f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     4a2:	89 f2                	mov    %esi,%edx
+     4a4:	48 89 ce             	mov    %rcx,%rsi
+     4a7:	89 c7                	mov    %eax,%edi
+     4a9:	e8 20 16 00 00       	call   1ace <read>
+     4ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     4b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     4b5:	0f 8f 04 ff ff ff    	jg     3bf <grep+0x22>
+    }
+  }
+  return count;
+     4bb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     4be:	c9                   	leave
+     4bf:	c3                   	ret
+
+00000000000004c0 <main>:
+
+int main(int argc, char *argv[]) {
+     4c0:	55                   	push   %rbp
+     4c1:	48 89 e5             	mov    %rsp,%rbp
+     4c4:	48 83 ec 30          	sub    $0x30,%rsp
+     4c8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     4cb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int fd, i, count;
+  char *pattern;
+
+  if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+     4cf:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+     4d3:	7e 34                	jle    509 <main+0x49>
+     4d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     4d9:	48 83 c0 08          	add    $0x8,%rax
+     4dd:	48 8b 00             	mov    (%rax),%rax
+     4e0:	48 8d 15 29 21 00 00 	lea    0x2129(%rip),%rdx        # 2610 <benchreport+0x14a>
+     4e7:	48 89 d6             	mov    %rdx,%rsi
+     4ea:	48 89 c7             	mov    %rax,%rdi
+     4ed:	e8 3a 0e 00 00       	call   132c <strcmp>
+     4f2:	85 c0                	test   %eax,%eax
+     4f4:	75 13                	jne    509 <main+0x49>
+    countonly = 1;
+     4f6:	c7 05 40 2b 01 00 01 	movl   $0x1,0x12b40(%rip)        # 13040 <countonly>
+     4fd:	00 00 00 
+    argc--;
+     500:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+    argv++;
+     504:	48 83 45 d0 08       	addq   $0x8,-0x30(%rbp)
+  }
+  if (argc <= 1) {
+     509:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+     50d:	7f 1e                	jg     52d <main+0x6d>
+    printf(2, "usage: grep [-c] pattern [file ...]\n");
+     50f:	48 8d 05 02 21 00 00 	lea    0x2102(%rip),%rax        # 2618 <benchreport+0x152>
+     516:	48 89 c6             	mov    %rax,%rsi
+     519:	bf 02 00 00 00       	mov    $0x2,%edi
+     51e:	b8 00 00 00 00       	mov    $0x0,%eax
+     523:	e8 d1 04 00 00       	call   9f9 <printf>
+    exit();
+     528:	e8 fc 0a 00 00       	call   1029 <exit>
+  }
+  pattern = argv[1];
+     52d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     531:	48 8b 40 08          	mov    0x8(%rax),%rax
+     535:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  compile(pattern);
+     539:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     53d:	48 89 c7             	mov    %rax,%rdi
+     540:	e8 bb fa ff ff       	call   0 <compile>
+
+  if (argc <= 2) {
+     545:	83 7d dc 02          	cmpl   $0x2,-0x24(%rbp)
+     549:	7f 41                	jg     58c <main+0xcc>
+    count = grep(pattern, 0);
+     54b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     54f:	be 00 00 00 00       	mov    $0x0,%esi
+     554:	48 89 c7             	mov    %rax,%rdi
+     557:	e8 41 fe ff ff       	call   39d <grep>
+     55c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    if (countonly)
+     55f:	8b 05 db 2a 01 00    	mov    0x12adb(%rip),%eax        # 13040 <countonly>
+     565:	85 c0                	test   %eax,%eax
+     567:	74 1e                	je     587 <main+0xc7>
+      printf(1, "%d\n", count);
+     569:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     56c:	89 c2                	mov    %eax,%edx
+     56e:	48 8d 05 c8 20 00 00 	lea    0x20c8(%rip),%rax        # 263d <benchreport+0x177>
+     575:	48 89 c6             	mov    %rax,%rsi
+     578:	bf 01 00 00 00       	mov    $0x1,%edi
+     57d:	b8 00 00 00 00       	mov    $0x0,%eax
+     582:	e8 72 04 00 00       	call   9f9 <printf>
+    exit();
+     587:	e8 9d 0a 00 00       	call   1029 <exit>
+  }
+
+  for (i = 2; i < argc; i++) {
+     58c:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+     593:	e9 f9 00 00 00       	jmp    691 <main+0x1d1>
+    if ((fd = open(argv[i], 0)) < 0) {
+     598:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     59b:	48 98                	cltq
+     59d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     5a4:	00 
+     5a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     5a9:	48 01 d0             	add    %rdx,%rax
+     5ac:	48 8b 00             	mov    (%rax),%rax
+     5af:	be 00 00 00 00       	mov    $0x0,%esi
+     5b4:	48 89 c7             	mov    %rax,%rdi
+     5b7:	e8 49 15 00 00       	call   1b05 <open>
+     5bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     5bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     5c3:	79 38                	jns    5fd <main+0x13d>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     5c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5c8:	48 98                	cltq
+     5ca:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     5d1:	00 
+     5d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     5d6:	48 01 d0             	add    %rdx,%rax
+     5d9:	48 8b 00             	mov    (%rax),%rax
+     5dc:	48 89 c2             	mov    %rax,%rdx
+     5df:	48 8d 05 5b 20 00 00 	lea    0x205b(%rip),%rax        # 2641 <benchreport+0x17b>
+     5e6:	48 89 c6             	mov    %rax,%rsi
+     5e9:	bf 01 00 00 00       	mov    $0x1,%edi
+     5ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f3:	e8 01 04 00 00       	call   9f9 <printf>
+      exit();
+     5f8:	e8 2c 0a 00 00       	call   1029 <exit>
+    }
+    count = grep(pattern, fd);
+     5fd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     600:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     604:	89 d6                	mov    %edx,%esi
+     606:	48 89 c7             	mov    %rax,%rdi
+     609:	e8 8f fd ff ff       	call   39d <grep>
+     60e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    if (countonly && argc > 3)
+     611:	8b 05 29 2a 01 00    	mov    0x12a29(%rip),%eax        # 13040 <countonly>
+     617:	85 c0                	test   %eax,%eax
+     619:	74 40                	je     65b <main+0x19b>
+     61b:	83 7d dc 03          	cmpl   $0x3,-0x24(%rbp)
+     61f:	7e 3a                	jle    65b <main+0x19b>
+      printf(1, "%s:%d\n", argv[i], count);
+     621:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     624:	48 98                	cltq
+     626:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     62d:	00 
+     62e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     632:	48 01 d0             	add    %rdx,%rax
+     635:	48 8b 00             	mov    (%rax),%rax
+     638:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     63b:	89 d1                	mov    %edx,%ecx
+     63d:	48 89 c2             	mov    %rax,%rdx
+     640:	48 8d 05 10 20 00 00 	lea    0x2010(%rip),%rax        # 2657 <benchreport+0x191>
+     647:	48 89 c6             	mov    %rax,%rsi
+     64a:	bf 01 00 00 00       	mov    $0x1,%edi
+     64f:	b8 00 00 00 00       	mov    $0x0,%eax
+     654:	e8 a0 03 00 00       	call   9f9 <printf>
+     659:	eb 28                	jmp    683 <main+0x1c3>
+    else if (countonly)
+     65b:	8b 05 df 29 01 00    	mov    0x129df(%rip),%eax        # 13040 <countonly>
+     661:	85 c0                	test   %eax,%eax
+     663:	74 1e                	je     683 <main+0x1c3>
+      printf(1, "%d\n", count);
+     665:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     668:	89 c2                	mov    %eax,%edx
+     66a:	48 8d 05 cc 1f 00 00 	lea    0x1fcc(%rip),%rax        # 263d <benchreport+0x177>
+     671:	48 89 c6             	mov    %rax,%rsi
+     674:	bf 01 00 00 00       	mov    $0x1,%edi
+     679:	b8 00 00 00 00       	mov    $0x0,%eax
+     67e:	e8 76 03 00 00       	call   9f9 <printf>
+    close(fd);
+     683:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     686:	89 c7                	mov    %eax,%edi
+     688:	e8 06 0a 00 00       	call   1093 <close>
+  for (i = 2; i < argc; i++) {
+     68d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     691:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     694:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+     697:	0f 8c fb fe ff ff    	jl     598 <main+0xd8>
+  }
+  exit();
+     69d:	e8 87 09 00 00       	call   1029 <exit>
+
+00000000000006a2 <match>:
+// The Practice of Programming, Chapter 9.
+
+int matchhere(char *, char *);
+int matchstar(int, char *, char *);
+
+int match(char *re, char *text) {
+     6a2:	55                   	push   %rbp
+     6a3:	48 89 e5             	mov    %rsp,%rbp
+     6a6:	48 83 ec 10          	sub    $0x10,%rsp
+     6aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     6ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (re[0] == '^')
+     6b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6b6:	0f b6 00             	movzbl (%rax),%eax
+     6b9:	3c 5e                	cmp    $0x5e,%al
+     6bb:	75 19                	jne    6d6 <match+0x34>
+    return matchhere(re + 1, text);
+     6bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6c1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     6c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6c9:	48 89 c6             	mov    %rax,%rsi
+     6cc:	48 89 d7             	mov    %rdx,%rdi
+     6cf:	e8 3a 00 00 00       	call   70e <matchhere>
+     6d4:	eb 36                	jmp    70c <match+0x6a>
+  do { // must look at empty string
+    if (matchhere(re, text))
+     6d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     6da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6de:	48 89 d6             	mov    %rdx,%rsi
+     6e1:	48 89 c7             	mov    %rax,%rdi
+     6e4:	e8 25 00 00 00       	call   70e <matchhere>
+     6e9:	85 c0                	test   %eax,%eax
+     6eb:	74 07                	je     6f4 <match+0x52>
+      return 1;
+     6ed:	b8 01 00 00 00       	mov    $0x1,%eax
+     6f2:	eb 18                	jmp    70c <match+0x6a>
+  } while (*text++ != '\0');
+     6f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6f8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     6fc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     700:	0f b6 00             	movzbl (%rax),%eax
+     703:	84 c0                	test   %al,%al
+     705:	75 cf                	jne    6d6 <match+0x34>
+  return 0;
+     707:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     70c:	c9                   	leave
+     70d:	c3                   	ret
+
+000000000000070e <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text) {
+     70e:	55                   	push   %rbp
+     70f:	48 89 e5             	mov    %rsp,%rbp
+     712:	48 83 ec 10          	sub    $0x10,%rsp
+     716:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     71a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (re[0] == '\0')
+     71e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     722:	0f b6 00             	movzbl (%rax),%eax
+     725:	84 c0                	test   %al,%al
+     727:	75 0a                	jne    733 <matchhere+0x25>
+    return 1;
+     729:	b8 01 00 00 00       	mov    $0x1,%eax
+     72e:	e9 a6 00 00 00       	jmp    7d9 <matchhere+0xcb>
+  if (re[1] == '*')
+     733:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     737:	48 83 c0 01          	add    $0x1,%rax
+     73b:	0f b6 00             	movzbl (%rax),%eax
+     73e:	3c 2a                	cmp    $0x2a,%al
+     740:	75 22                	jne    764 <matchhere+0x56>
+    return matchstar(re[0], re + 2, text);
+     742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     746:	48 8d 48 02          	lea    0x2(%rax),%rcx
+     74a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     74e:	0f b6 00             	movzbl (%rax),%eax
+     751:	0f be c0             	movsbl %al,%eax
+     754:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     758:	48 89 ce             	mov    %rcx,%rsi
+     75b:	89 c7                	mov    %eax,%edi
+     75d:	e8 79 00 00 00       	call   7db <matchstar>
+     762:	eb 75                	jmp    7d9 <matchhere+0xcb>
+  if (re[0] == '$' && re[1] == '\0')
+     764:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     768:	0f b6 00             	movzbl (%rax),%eax
+     76b:	3c 24                	cmp    $0x24,%al
+     76d:	75 20                	jne    78f <matchhere+0x81>
+     76f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     773:	48 83 c0 01          	add    $0x1,%rax
+     777:	0f b6 00             	movzbl (%rax),%eax
+     77a:	84 c0                	test   %al,%al
+     77c:	75 11                	jne    78f <matchhere+0x81>
+    return *text == '\0';
+     77e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     782:	0f b6 00             	movzbl (%rax),%eax
+     785:	84 c0                	test   %al,%al
+     787:	0f 94 c0             	sete   %al
+     78a:	0f b6 c0             	movzbl %al,%eax
+     78d:	eb 4a                	jmp    7d9 <matchhere+0xcb>
+  if (*text != '\0' && (re[0] == '.' || re[0] == *text))
+     78f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     793:	0f b6 00             	movzbl (%rax),%eax
+     796:	84 c0                	test   %al,%al
+     798:	74 3a                	je     7d4 <matchhere+0xc6>
+     79a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     79e:	0f b6 00             	movzbl (%rax),%eax
+     7a1:	3c 2e                	cmp    $0x2e,%al
+     7a3:	74 12                	je     7b7 <matchhere+0xa9>
+     7a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7a9:	0f b6 10             	movzbl (%rax),%edx
+     7ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7b0:	0f b6 00             	movzbl (%rax),%eax
+     7b3:	38 c2                	cmp    %al,%dl
+     7b5:	75 1d                	jne    7d4 <matchhere+0xc6>
+    return matchhere(re + 1, text + 1);
+     7b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7bb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     7bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7c3:	48 83 c0 01          	add    $0x1,%rax
+     7c7:	48 89 d6             	mov    %rdx,%rsi
+     7ca:	48 89 c7             	mov    %rax,%rdi
+     7cd:	e8 3c ff ff ff       	call   70e <matchhere>
+     7d2:	eb 05                	jmp    7d9 <matchhere+0xcb>
+  return 0;
+     7d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     7d9:	c9                   	leave
+     7da:	c3                   	ret
+
+00000000000007db <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text) {
+     7db:	55                   	push   %rbp
+     7dc:	48 89 e5             	mov    %rsp,%rbp
+     7df:	48 83 ec 20          	sub    $0x20,%rsp
+     7e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     7e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     7ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  do { // a * matches zero or more instances
+    if (matchhere(re, text))
+     7ee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     7f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7f6:	48 89 d6             	mov    %rdx,%rsi
+     7f9:	48 89 c7             	mov    %rax,%rdi
+     7fc:	e8 0d ff ff ff       	call   70e <matchhere>
+     801:	85 c0                	test   %eax,%eax
+     803:	74 07                	je     80c <matchstar+0x31>
+      return 1;
+     805:	b8 01 00 00 00       	mov    $0x1,%eax
+     80a:	eb 2d                	jmp    839 <matchstar+0x5e>
+  } while (*text != '\0' && (*text++ == c || c == '.'));
+     80c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     810:	0f b6 00             	movzbl (%rax),%eax
+     813:	84 c0                	test   %al,%al
+     815:	74 1d                	je     834 <matchstar+0x59>
+     817:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     81b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     81f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     823:	0f b6 00             	movzbl (%rax),%eax
+     826:	0f be c0             	movsbl %al,%eax
+     829:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     82c:	74 c0                	je     7ee <matchstar+0x13>
+     82e:	83 7d fc 2e          	cmpl   $0x2e,-0x4(%rbp)
+     832:	74 ba                	je     7ee <matchstar+0x13>
+  return 0;
+     834:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     839:	c9                   	leave
+     83a:	c3                   	ret
+
+000000000000083b <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     83b:	55                   	push   %rbp
+     83c:	48 89 e5             	mov    %rsp,%rbp
+     83f:	48 83 ec 10          	sub    $0x10,%rsp
+     843:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     846:	89 f0                	mov    %esi,%eax
+     848:	88 45 f8             	mov    %al,-0x8(%rbp)
+     84b:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     84f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     852:	89 d6                	mov    %edx,%esi
+     854:	89 c7                	mov    %eax,%edi
+     856:	e8 eb 06 00 00       	call   f46 <bputc>
+     85b:	90                   	nop
+     85c:	c9                   	leave
+     85d:	c3                   	ret
+
+000000000000085e <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     85e:	55                   	push   %rbp
+     85f:	48 89 e5             	mov    %rsp,%rbp
+     862:	48 83 ec 50          	sub    $0x50,%rsp
+     866:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     869:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     86d:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     870:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     873:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     877:	74 21                	je     89a <printint64+0x3c>
+     879:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     87d:	48 c1 e8 3f          	shr    $0x3f,%rax
+     881:	0f b6 c0             	movzbl %al,%eax
+     884:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     887:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     88b:	74 0d                	je     89a <printint64+0x3c>
+    x = -xx;
+     88d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     891:	48 f7 d8             	neg    %rax
+     894:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     898:	eb 08                	jmp    8a2 <printint64+0x44>
+  else
+    x = xx;
+     89a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     89e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     8a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     8a9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     8ac:	48 63 c8             	movslq %eax,%rcx
+     8af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8b3:	ba 00 00 00 00       	mov    $0x0,%edx
+     8b8:	48 f7 f1             	div    %rcx
+     8bb:	48 89 d1             	mov    %rdx,%rcx
+     8be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8c1:	8d 50 01             	lea    0x1(%rax),%edx
+     8c4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     8c7:	48 8d 15 32 27 00 00 	lea    0x2732(%rip),%rdx        # 3000 <digits.1>
+     8ce:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     8d2:	48 98                	cltq
+     8d4:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     8d8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     8db:	48 63 f0             	movslq %eax,%rsi
+     8de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8e2:	ba 00 00 00 00       	mov    $0x0,%edx
+     8e7:	48 f7 f6             	div    %rsi
+     8ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     8ee:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     8f3:	75 b4                	jne    8a9 <printint64+0x4b>
+
+  if (sgn)
+     8f5:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     8f9:	74 2b                	je     926 <printint64+0xc8>
+    buf[i++] = '-';
+     8fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8fe:	8d 50 01             	lea    0x1(%rax),%edx
+     901:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     904:	48 98                	cltq
+     906:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     90b:	eb 19                	jmp    926 <printint64+0xc8>
+    putc(fd, buf[i]);
+     90d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     910:	48 98                	cltq
+     912:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     917:	0f be d0             	movsbl %al,%edx
+     91a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     91d:	89 d6                	mov    %edx,%esi
+     91f:	89 c7                	mov    %eax,%edi
+     921:	e8 15 ff ff ff       	call   83b <putc>
+  while (--i >= 0)
+     926:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     92a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     92e:	79 dd                	jns    90d <printint64+0xaf>
+}
+     930:	90                   	nop
+     931:	90                   	nop
+     932:	c9                   	leave
+     933:	c3                   	ret
+
+0000000000000934 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     934:	55                   	push   %rbp
+     935:	48 89 e5             	mov    %rsp,%rbp
+     938:	48 83 ec 30          	sub    $0x30,%rsp
+     93c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     93f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     942:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     945:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     948:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     94f:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     953:	74 17                	je     96c <printint+0x38>
+     955:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     959:	79 11                	jns    96c <printint+0x38>
+    neg = 1;
+     95b:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     962:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     965:	f7 d8                	neg    %eax
+     967:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     96a:	eb 06                	jmp    972 <printint+0x3e>
+  } else {
+    x = xx;
+     96c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     96f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     972:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     979:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     97c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     97f:	ba 00 00 00 00       	mov    $0x0,%edx
+     984:	f7 f1                	div    %ecx
+     986:	89 d1                	mov    %edx,%ecx
+     988:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     98b:	8d 50 01             	lea    0x1(%rax),%edx
+     98e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     991:	89 c9                	mov    %ecx,%ecx
+     993:	48 8d 15 86 26 00 00 	lea    0x2686(%rip),%rdx        # 3020 <digits.0>
+     99a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     99e:	48 98                	cltq
+     9a0:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     9a4:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     9a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     9aa:	ba 00 00 00 00       	mov    $0x0,%edx
+     9af:	f7 f6                	div    %esi
+     9b1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     9b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     9b8:	75 bf                	jne    979 <printint+0x45>
+  if (neg)
+     9ba:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     9be:	74 2b                	je     9eb <printint+0xb7>
+    buf[i++] = '-';
+     9c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9c3:	8d 50 01             	lea    0x1(%rax),%edx
+     9c6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     9c9:	48 98                	cltq
+     9cb:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     9d0:	eb 19                	jmp    9eb <printint+0xb7>
+    putc(fd, buf[i]);
+     9d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d5:	48 98                	cltq
+     9d7:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     9dc:	0f be d0             	movsbl %al,%edx
+     9df:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     9e2:	89 d6                	mov    %edx,%esi
+     9e4:	89 c7                	mov    %eax,%edi
+     9e6:	e8 50 fe ff ff       	call   83b <putc>
+  while (--i >= 0)
+     9eb:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     9ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     9f3:	79 dd                	jns    9d2 <printint+0x9e>
+}
+     9f5:	90                   	nop
+     9f6:	90                   	nop
+     9f7:	c9                   	leave
+     9f8:	c3                   	ret
+
+00000000000009f9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     9f9:	55                   	push   %rbp
+     9fa:	48 89 e5             	mov    %rsp,%rbp
+     9fd:	48 83 ec 70          	sub    $0x70,%rsp
+     a01:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     a04:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     a08:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     a0c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     a10:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     a14:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     a18:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     a1f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     a23:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     a27:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     a2b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     a2f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     a36:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     a3d:	e9 67 02 00 00       	jmp    ca9 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     a42:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     a45:	48 63 d0             	movslq %eax,%rdx
+     a48:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     a4c:	48 01 d0             	add    %rdx,%rax
+     a4f:	0f b6 00             	movzbl (%rax),%eax
+     a52:	0f be c0             	movsbl %al,%eax
+     a55:	25 ff 00 00 00       	and    $0xff,%eax
+     a5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     a5d:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     a61:	75 30                	jne    a93 <printf+0x9a>
+      if (c == '%') {
+     a63:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     a67:	75 13                	jne    a7c <printf+0x83>
+        state = '%';
+     a69:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     a70:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     a77:	e9 29 02 00 00       	jmp    ca5 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     a7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     a7f:	0f be d0             	movsbl %al,%edx
+     a82:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a85:	89 d6                	mov    %edx,%esi
+     a87:	89 c7                	mov    %eax,%edi
+     a89:	e8 ad fd ff ff       	call   83b <putc>
+     a8e:	e9 12 02 00 00       	jmp    ca5 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     a93:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     a97:	0f 85 08 02 00 00    	jne    ca5 <printf+0x2ac>
+      if (c == 'l') {
+     a9d:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     aa1:	75 0c                	jne    aaf <printf+0xb6>
+        lflag = 1;
+     aa3:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     aaa:	e9 f6 01 00 00       	jmp    ca5 <printf+0x2ac>
+      } else if (c == 'd') {
+     aaf:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     ab3:	0f 85 93 00 00 00    	jne    b4c <printf+0x153>
+        if (lflag == 1)
+     ab9:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     abd:	75 47                	jne    b06 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     abf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     ac2:	83 f8 2f             	cmp    $0x2f,%eax
+     ac5:	77 17                	ja     ade <printf+0xe5>
+     ac7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     acb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ace:	89 d2                	mov    %edx,%edx
+     ad0:	48 01 d0             	add    %rdx,%rax
+     ad3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ad6:	83 c2 08             	add    $0x8,%edx
+     ad9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     adc:	eb 0c                	jmp    aea <printf+0xf1>
+     ade:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     ae2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ae6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     aea:	48 8b 30             	mov    (%rax),%rsi
+     aed:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     af0:	b9 01 00 00 00       	mov    $0x1,%ecx
+     af5:	ba 0a 00 00 00       	mov    $0xa,%edx
+     afa:	89 c7                	mov    %eax,%edi
+     afc:	e8 5d fd ff ff       	call   85e <printint64>
+     b01:	e9 98 01 00 00       	jmp    c9e <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     b06:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     b09:	83 f8 2f             	cmp    $0x2f,%eax
+     b0c:	77 17                	ja     b25 <printf+0x12c>
+     b0e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     b12:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     b15:	89 d2                	mov    %edx,%edx
+     b17:	48 01 d0             	add    %rdx,%rax
+     b1a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     b1d:	83 c2 08             	add    $0x8,%edx
+     b20:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     b23:	eb 0c                	jmp    b31 <printf+0x138>
+     b25:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     b29:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b2d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     b31:	8b 30                	mov    (%rax),%esi
+     b33:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b36:	b9 01 00 00 00       	mov    $0x1,%ecx
+     b3b:	ba 0a 00 00 00       	mov    $0xa,%edx
+     b40:	89 c7                	mov    %eax,%edi
+     b42:	e8 ed fd ff ff       	call   934 <printint>
+     b47:	e9 52 01 00 00       	jmp    c9e <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     b4c:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     b50:	74 0a                	je     b5c <printf+0x163>
+     b52:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     b56:	0f 85 93 00 00 00    	jne    bef <printf+0x1f6>
+        if (lflag == 1)
+     b5c:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     b60:	75 47                	jne    ba9 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     b62:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     b65:	83 f8 2f             	cmp    $0x2f,%eax
+     b68:	77 17                	ja     b81 <printf+0x188>
+     b6a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     b6e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     b71:	89 d2                	mov    %edx,%edx
+     b73:	48 01 d0             	add    %rdx,%rax
+     b76:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     b79:	83 c2 08             	add    $0x8,%edx
+     b7c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     b7f:	eb 0c                	jmp    b8d <printf+0x194>
+     b81:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     b85:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     b89:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     b8d:	48 8b 30             	mov    (%rax),%rsi
+     b90:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b93:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b98:	ba 10 00 00 00       	mov    $0x10,%edx
+     b9d:	89 c7                	mov    %eax,%edi
+     b9f:	e8 ba fc ff ff       	call   85e <printint64>
+        if (lflag == 1)
+     ba4:	e9 f5 00 00 00       	jmp    c9e <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     ba9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     bac:	83 f8 2f             	cmp    $0x2f,%eax
+     baf:	77 17                	ja     bc8 <printf+0x1cf>
+     bb1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     bb5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     bb8:	89 d2                	mov    %edx,%edx
+     bba:	48 01 d0             	add    %rdx,%rax
+     bbd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     bc0:	83 c2 08             	add    $0x8,%edx
+     bc3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     bc6:	eb 0c                	jmp    bd4 <printf+0x1db>
+     bc8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     bcc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     bd0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     bd4:	8b 30                	mov    (%rax),%esi
+     bd6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     bd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+     bde:	ba 10 00 00 00       	mov    $0x10,%edx
+     be3:	89 c7                	mov    %eax,%edi
+     be5:	e8 4a fd ff ff       	call   934 <printint>
+        if (lflag == 1)
+     bea:	e9 af 00 00 00       	jmp    c9e <printf+0x2a5>
+      } else if (c == 's') {
+     bef:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     bf3:	75 6e                	jne    c63 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     bf5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     bf8:	83 f8 2f             	cmp    $0x2f,%eax
+     bfb:	77 17                	ja     c14 <printf+0x21b>
+     bfd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     c01:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     c04:	89 d2                	mov    %edx,%edx
+     c06:	48 01 d0             	add    %rdx,%rax
+     c09:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     c0c:	83 c2 08             	add    $0x8,%edx
+     c0f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     c12:	eb 0c                	jmp    c20 <printf+0x227>
+     c14:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     c18:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c1c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     c20:	48 8b 00             	mov    (%rax),%rax
+     c23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     c27:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     c2c:	75 28                	jne    c56 <printf+0x25d>
+          s = "(null)";
+     c2e:	48 8d 05 29 1a 00 00 	lea    0x1a29(%rip),%rax        # 265e <benchreport+0x198>
+     c35:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     c39:	eb 1b                	jmp    c56 <printf+0x25d>
+          putc(fd, *s);
+     c3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c3f:	0f b6 00             	movzbl (%rax),%eax
+     c42:	0f be d0             	movsbl %al,%edx
+     c45:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     c48:	89 d6                	mov    %edx,%esi
+     c4a:	89 c7                	mov    %eax,%edi
+     c4c:	e8 ea fb ff ff       	call   83b <putc>
+        for (; *s; s++)
+     c51:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     c56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c5a:	0f b6 00             	movzbl (%rax),%eax
+     c5d:	84 c0                	test   %al,%al
+     c5f:	75 da                	jne    c3b <printf+0x242>
+     c61:	eb 3b                	jmp    c9e <printf+0x2a5>
+      } else if (c == '%') {
+     c63:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     c67:	75 14                	jne    c7d <printf+0x284>
+        putc(fd, c);
+     c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     c6c:	0f be d0             	movsbl %al,%edx
+     c6f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     c72:	89 d6                	mov    %edx,%esi
+     c74:	89 c7                	mov    %eax,%edi
+     c76:	e8 c0 fb ff ff       	call   83b <putc>
+     c7b:	eb 21                	jmp    c9e <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     c7d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     c80:	be 25 00 00 00       	mov    $0x25,%esi
+     c85:	89 c7                	mov    %eax,%edi
+     c87:	e8 af fb ff ff       	call   83b <putc>
+        putc(fd, c);
+     c8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     c8f:	0f be d0             	movsbl %al,%edx
+     c92:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     c95:	89 d6                	mov    %edx,%esi
+     c97:	89 c7                	mov    %eax,%edi
+     c99:	e8 9d fb ff ff       	call   83b <putc>
+      }
+      state = 0;
+     c9e:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     ca5:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     ca9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     cac:	48 63 d0             	movslq %eax,%rdx
+     caf:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     cb3:	48 01 d0             	add    %rdx,%rax
+     cb6:	0f b6 00             	movzbl (%rax),%eax
+     cb9:	84 c0                	test   %al,%al
+     cbb:	0f 85 81 fd ff ff    	jne    a42 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     cc1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     cc4:	89 c7                	mov    %eax,%edi
+     cc6:	e8 ee 02 00 00       	call   fb9 <bflushtty>
+}
+     ccb:	90                   	nop
+     ccc:	c9                   	leave
+     ccd:	c3                   	ret
+
+0000000000000cce <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     cce:	55                   	push   %rbp
+     ccf:	48 89 e5             	mov    %rsp,%rbp
+     cd2:	48 83 ec 30          	sub    $0x30,%rsp
+     cd6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     cd9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     cdd:	78 06                	js     ce5 <getbuf+0x17>
+     cdf:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     ce3:	7e 0a                	jle    cef <getbuf+0x21>
+    return 0;
+     ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+     cea:	e9 94 00 00 00       	jmp    d83 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     cef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     cf2:	48 98                	cltq
+     cf4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     cfb:	00 
+     cfc:	48 8d 05 5d 27 01 00 	lea    0x1275d(%rip),%rax        # 13460 <obufs>
+     d03:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d07:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     d0b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     d10:	75 6d                	jne    d7f <getbuf+0xb1>
+     d12:	bf 08 02 00 00       	mov    $0x208,%edi
+     d17:	e8 bd 13 00 00       	call   20d9 <malloc>
+     d1c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     d20:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     d25:	74 58                	je     d7f <getbuf+0xb1>
+    b->n = 0;
+     d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d2b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     d31:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     d35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d38:	48 89 d6             	mov    %rdx,%rsi
+     d3b:	89 c7                	mov    %eax,%edi
+     d3d:	e8 e4 0d 00 00       	call   1b26 <fstat>
+     d42:	85 c0                	test   %eax,%eax
+     d44:	75 11                	jne    d57 <getbuf+0x89>
+     d46:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     d4a:	66 83 f8 03          	cmp    $0x3,%ax
+     d4e:	75 07                	jne    d57 <getbuf+0x89>
+     d50:	ba 01 00 00 00       	mov    $0x1,%edx
+     d55:	eb 05                	jmp    d5c <getbuf+0x8e>
+     d57:	ba 00 00 00 00       	mov    $0x0,%edx
+     d5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d60:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     d63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d66:	48 98                	cltq
+     d68:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     d6f:	00 
+     d70:	48 8d 15 e9 26 01 00 	lea    0x126e9(%rip),%rdx        # 13460 <obufs>
+     d77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d7b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     d83:	c9                   	leave
+     d84:	c3                   	ret
+
+0000000000000d85 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     d85:	55                   	push   %rbp
+     d86:	48 89 e5             	mov    %rsp,%rbp
+     d89:	48 83 ec 20          	sub    $0x20,%rsp
+     d8d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     d90:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     d94:	78 33                	js     dc9 <bflush+0x44>
+     d96:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     d9a:	7f 2d                	jg     dc9 <bflush+0x44>
+     d9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d9f:	48 98                	cltq
+     da1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     da8:	00 
+     da9:	48 8d 05 b0 26 01 00 	lea    0x126b0(%rip),%rax        # 13460 <obufs>
+     db0:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     db4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     db8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     dbd:	74 0a                	je     dc9 <bflush+0x44>
+     dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc3:	8b 00                	mov    (%rax),%eax
+     dc5:	85 c0                	test   %eax,%eax
+     dc7:	75 07                	jne    dd0 <bflush+0x4b>
+    return 0;
+     dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+     dce:	eb 3c                	jmp    e0c <bflush+0x87>
+  n = b->n;
+     dd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dd4:	8b 00                	mov    (%rax),%eax
+     dd6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     dd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ddd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     de3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     deb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     dee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     df1:	48 89 ce             	mov    %rcx,%rsi
+     df4:	89 c7                	mov    %eax,%edi
+     df6:	e8 de 0c 00 00       	call   1ad9 <write>
+     dfb:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     dfe:	75 07                	jne    e07 <bflush+0x82>
+     e00:	b8 00 00 00 00       	mov    $0x0,%eax
+     e05:	eb 05                	jmp    e0c <bflush+0x87>
+     e07:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     e0c:	c9                   	leave
+     e0d:	c3                   	ret
+
+0000000000000e0e <bflushall>:
+
+void bflushall(void) {
+     e0e:	55                   	push   %rbp
+     e0f:	48 89 e5             	mov    %rsp,%rbp
+     e12:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     e16:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e1d:	eb 0e                	jmp    e2d <bflushall+0x1f>
+    bflush(fd);
+     e1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e22:	89 c7                	mov    %eax,%edi
+     e24:	e8 5c ff ff ff       	call   d85 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     e29:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e2d:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     e31:	7e ec                	jle    e1f <bflushall+0x11>
+}
+     e33:	90                   	nop
+     e34:	90                   	nop
+     e35:	c9                   	leave
+     e36:	c3                   	ret
+
+0000000000000e37 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     e37:	55                   	push   %rbp
+     e38:	48 89 e5             	mov    %rsp,%rbp
+     e3b:	48 83 ec 30          	sub    $0x30,%rsp
+     e3f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     e42:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     e46:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     e49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e4c:	89 c7                	mov    %eax,%edi
+     e4e:	e8 7b fe ff ff       	call   cce <getbuf>
+     e53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e57:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     e5c:	75 19                	jne    e77 <bwrite+0x40>
+    return write(fd, s, n);
+     e5e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     e61:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     e65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e68:	48 89 ce             	mov    %rcx,%rsi
+     e6b:	89 c7                	mov    %eax,%edi
+     e6d:	e8 67 0c 00 00       	call   1ad9 <write>
+     e72:	e9 cd 00 00 00       	jmp    f44 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     e77:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e7e:	e9 92 00 00 00       	jmp    f15 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     e83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e87:	8b 00                	mov    (%rax),%eax
+     e89:	3d 00 02 00 00       	cmp    $0x200,%eax
+     e8e:	75 18                	jne    ea8 <bwrite+0x71>
+     e90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e93:	89 c7                	mov    %eax,%edi
+     e95:	e8 eb fe ff ff       	call   d85 <bflush>
+     e9a:	85 c0                	test   %eax,%eax
+     e9c:	79 0a                	jns    ea8 <bwrite+0x71>
+      return -1;
+     e9e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ea3:	e9 9c 00 00 00       	jmp    f44 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     ea8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     eab:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     eae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     eb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eb5:	8b 00                	mov    (%rax),%eax
+     eb7:	ba 00 02 00 00       	mov    $0x200,%edx
+     ebc:	29 c2                	sub    %eax,%edx
+     ebe:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     ec1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     ec4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     ec7:	39 c2                	cmp    %eax,%edx
+     ec9:	0f 4e c2             	cmovle %edx,%eax
+     ecc:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     ecf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ed2:	48 63 d0             	movslq %eax,%rdx
+     ed5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ed9:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     edd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ee5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee9:	8b 00                	mov    (%rax),%eax
+     eeb:	48 98                	cltq
+     eed:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     ef1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ef4:	89 c2                	mov    %eax,%edx
+     ef6:	48 89 cf             	mov    %rcx,%rdi
+     ef9:	e8 e9 06 00 00       	call   15e7 <memmove>
+    b->n += m;
+     efe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f02:	8b 10                	mov    (%rax),%edx
+     f04:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     f07:	01 c2                	add    %eax,%edx
+     f09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f0d:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     f0f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     f12:	01 45 fc             	add    %eax,-0x4(%rbp)
+     f15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f18:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     f1b:	0f 8c 62 ff ff ff    	jl     e83 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     f21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f25:	8b 40 04             	mov    0x4(%rax),%eax
+     f28:	85 c0                	test   %eax,%eax
+     f2a:	74 15                	je     f41 <bwrite+0x10a>
+     f2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f2f:	89 c7                	mov    %eax,%edi
+     f31:	e8 4f fe ff ff       	call   d85 <bflush>
+     f36:	85 c0                	test   %eax,%eax
+     f38:	79 07                	jns    f41 <bwrite+0x10a>
+    return -1;
+     f3a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f3f:	eb 03                	jmp    f44 <bwrite+0x10d>
+  return n;
+     f41:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     f44:	c9                   	leave
+     f45:	c3                   	ret
+
+0000000000000f46 <bputc>:
+
+void bputc(int fd, char c) {
+     f46:	55                   	push   %rbp
+     f47:	48 89 e5             	mov    %rsp,%rbp
+     f4a:	48 83 ec 20          	sub    $0x20,%rsp
+     f4e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     f51:	89 f0                	mov    %esi,%eax
+     f53:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     f56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f59:	89 c7                	mov    %eax,%edi
+     f5b:	e8 6e fd ff ff       	call   cce <getbuf>
+     f60:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     f64:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     f69:	75 18                	jne    f83 <bputc+0x3d>
+    write(fd, &c, 1);
+     f6b:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     f6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f72:	ba 01 00 00 00       	mov    $0x1,%edx
+     f77:	48 89 ce             	mov    %rcx,%rsi
+     f7a:	89 c7                	mov    %eax,%edi
+     f7c:	e8 58 0b 00 00       	call   1ad9 <write>
+    return;
+     f81:	eb 34                	jmp    fb7 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     f83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f87:	8b 00                	mov    (%rax),%eax
+     f89:	3d 00 02 00 00       	cmp    $0x200,%eax
+     f8e:	75 0a                	jne    f9a <bputc+0x54>
+    bflush(fd);
+     f90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f93:	89 c7                	mov    %eax,%edi
+     f95:	e8 eb fd ff ff       	call   d85 <bflush>
+  b->data[b->n++] = c;
+     f9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f9e:	8b 00                	mov    (%rax),%eax
+     fa0:	8d 48 01             	lea    0x1(%rax),%ecx
+     fa3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     fa7:	89 0a                	mov    %ecx,(%rdx)
+     fa9:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     fad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     fb1:	48 98                	cltq
+     fb3:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     fb7:	c9                   	leave
+     fb8:	c3                   	ret
+
+0000000000000fb9 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     fb9:	55                   	push   %rbp
+     fba:	48 89 e5             	mov    %rsp,%rbp
+     fbd:	48 83 ec 10          	sub    $0x10,%rsp
+     fc1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     fc4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     fc8:	78 4c                	js     1016 <bflushtty+0x5d>
+     fca:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     fce:	7f 46                	jg     1016 <bflushtty+0x5d>
+     fd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fd3:	48 98                	cltq
+     fd5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     fdc:	00 
+     fdd:	48 8d 05 7c 24 01 00 	lea    0x1247c(%rip),%rax        # 13460 <obufs>
+     fe4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     fe8:	48 85 c0             	test   %rax,%rax
+     feb:	74 29                	je     1016 <bflushtty+0x5d>
+     fed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ff0:	48 98                	cltq
+     ff2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ff9:	00 
+     ffa:	48 8d 05 5f 24 01 00 	lea    0x1245f(%rip),%rax        # 13460 <obufs>
+    1001:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1005:	8b 40 04             	mov    0x4(%rax),%eax
+    1008:	85 c0                	test   %eax,%eax
+    100a:	74 0a                	je     1016 <bflushtty+0x5d>
+    bflush(fd);
+    100c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    100f:	89 c7                	mov    %eax,%edi
+    1011:	e8 6f fd ff ff       	call   d85 <bflush>
+}
+    1016:	90                   	nop
+    1017:	c9                   	leave
+    1018:	c3                   	ret
+
+0000000000001019 <fork>:
+
+int fork(void) {
+    1019:	55                   	push   %rbp
+    101a:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    101d:	e8 ec fd ff ff       	call   e0e <bflushall>
+  return _fork();
+    1022:	e8 7b 0a 00 00       	call   1aa2 <_fork>
+}
+    1027:	5d                   	pop    %rbp
+    1028:	c3                   	ret
+
+0000000000001029 <exit>:
+
+noreturn void exit(void) {
+    1029:	55                   	push   %rbp
+    102a:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    102d:	e8 dc fd ff ff       	call   e0e <bflushall>
+  _exit();
+    1032:	e8 76 0a 00 00       	call   1aad <_exit>
+
+0000000000001037 <exec>:
+}
+
+int exec(char *path, char **argv) {
+    1037:	55                   	push   %rbp
+    1038:	48 89 e5             	mov    %rsp,%rbp
+    103b:	48 83 ec 10          	sub    $0x10,%rsp
+    103f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1043:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    1047:	e8 c2 fd ff ff       	call   e0e <bflushall>
+  return _exec(path, argv);
+    104c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1050:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1054:	48 89 d6             	mov    %rdx,%rsi
+    1057:	48 89 c7             	mov    %rax,%rdi
+    105a:	e8 9b 0a 00 00       	call   1afa <_exec>
+}
+    105f:	c9                   	leave
+    1060:	c3                   	ret
+
+0000000000001061 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    1061:	55                   	push   %rbp
+    1062:	48 89 e5             	mov    %rsp,%rbp
+    1065:	48 83 ec 20          	sub    $0x20,%rsp
+    1069:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    106d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1071:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    1075:	e8 94 fd ff ff       	call   e0e <bflushall>
+  return _spawn(path, argv, fds);
+    107a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    107e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1082:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1086:	48 89 ce             	mov    %rcx,%rsi
+    1089:	48 89 c7             	mov    %rax,%rdi
+    108c:	e8 2f 0b 00 00       	call   1bc0 <_spawn>
+}
+    1091:	c9                   	leave
+    1092:	c3                   	ret
+
+0000000000001093 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    1093:	55                   	push   %rbp
+    1094:	48 89 e5             	mov    %rsp,%rbp
+    1097:	48 83 ec 10          	sub    $0x10,%rsp
+    109b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    109e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    10a2:	78 69                	js     110d <close+0x7a>
+    10a4:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    10a8:	7f 63                	jg     110d <close+0x7a>
+    10aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10ad:	48 98                	cltq
+    10af:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    10b6:	00 
+    10b7:	48 8d 05 a2 23 01 00 	lea    0x123a2(%rip),%rax        # 13460 <obufs>
+    10be:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    10c2:	48 85 c0             	test   %rax,%rax
+    10c5:	74 46                	je     110d <close+0x7a>
+    bflush(fd);
+    10c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10ca:	89 c7                	mov    %eax,%edi
+    10cc:	e8 b4 fc ff ff       	call   d85 <bflush>
+    free(obufs[fd]);
+    10d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10d4:	48 98                	cltq
+    10d6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    10dd:	00 
+    10de:	48 8d 05 7b 23 01 00 	lea    0x1237b(%rip),%rax        # 13460 <obufs>
+    10e5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    10e9:	48 89 c7             	mov    %rax,%rdi
+    10ec:	e8 90 11 00 00       	call   2281 <free>
+    obufs[fd] = 0;
+    10f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10f4:	48 98                	cltq
+    10f6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    10fd:	00 
+    10fe:	48 8d 05 5b 23 01 00 	lea    0x1235b(%rip),%rax        # 13460 <obufs>
+    1105:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    110c:	00 
+  }
+  return _close(fd);
+    110d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1110:	89 c7                	mov    %eax,%edi
+    1112:	e8 cd 09 00 00       	call   1ae4 <_close>
+}
+    1117:	c9                   	leave
+    1118:	c3                   	ret
+
+0000000000001119 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    1119:	55                   	push   %rbp
+    111a:	48 89 e5             	mov    %rsp,%rbp
+    111d:	53                   	push   %rbx
+    111e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1122:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    1126:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    112a:	48 8b 36             	mov    (%rsi),%rsi
+    112d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    1131:	48 29 f7             	sub    %rsi,%rdi
+    1134:	48 89 f9             	mov    %rdi,%rcx
+    1137:	bb 00 00 00 00       	mov    $0x0,%ebx
+    113c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1140:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    1144:	48 89 f0             	mov    %rsi,%rax
+    1147:	ba 00 00 00 00       	mov    $0x0,%edx
+    114c:	48 89 df             	mov    %rbx,%rdi
+    114f:	48 0f af f8          	imul   %rax,%rdi
+    1153:	48 89 d6             	mov    %rdx,%rsi
+    1156:	48 0f af f1          	imul   %rcx,%rsi
+    115a:	48 01 fe             	add    %rdi,%rsi
+    115d:	48 f7 e1             	mul    %rcx
+    1160:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    1164:	48 89 ca             	mov    %rcx,%rdx
+    1167:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    116c:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    1170:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+
+0000000000001176 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    1176:	55                   	push   %rbp
+    1177:	48 89 e5             	mov    %rsp,%rbp
+    117a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    117e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1181:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    1184:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1188:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    118b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    118e:	48 89 ce             	mov    %rcx,%rsi
+    1191:	48 89 f7             	mov    %rsi,%rdi
+    1194:	89 d1                	mov    %edx,%ecx
+    1196:	fc                   	cld
+    1197:	f3 aa                	rep stos %al,%es:(%rdi)
+    1199:	89 ca                	mov    %ecx,%edx
+    119b:	48 89 fe             	mov    %rdi,%rsi
+    119e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    11a2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    11a5:	90                   	nop
+    11a6:	5d                   	pop    %rbp
+    11a7:	c3                   	ret
+
+00000000000011a8 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    11a8:	55                   	push   %rbp
+    11a9:	48 89 e5             	mov    %rsp,%rbp
+    11ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    11b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    11b8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    11bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    11c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11c4:	48 89 ce             	mov    %rcx,%rsi
+    11c7:	48 89 f7             	mov    %rsi,%rdi
+    11ca:	48 89 d1             	mov    %rdx,%rcx
+    11cd:	fc                   	cld
+    11ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    11d1:	48 89 ca             	mov    %rcx,%rdx
+    11d4:	48 89 fe             	mov    %rdi,%rsi
+    11d7:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    11db:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    11df:	90                   	nop
+    11e0:	5d                   	pop    %rbp
+    11e1:	c3                   	ret
+
+00000000000011e2 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    11e2:	55                   	push   %rbp
+    11e3:	48 89 e5             	mov    %rsp,%rbp
+    11e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    11ee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    11f2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    11f6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    11fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11fe:	48 89 cf             	mov    %rcx,%rdi
+    1201:	48 89 d6             	mov    %rdx,%rsi
+    1204:	48 89 c1             	mov    %rax,%rcx
+    1207:	fc                   	cld
+    1208:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    120a:	48 89 c8             	mov    %rcx,%rax
+    120d:	48 89 f2             	mov    %rsi,%rdx
+    1210:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1214:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1218:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    121c:	90                   	nop
+    121d:	5d                   	pop    %rbp
+    121e:	c3                   	ret
+
+000000000000121f <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    121f:	55                   	push   %rbp
+    1220:	48 89 e5             	mov    %rsp,%rbp
+    1223:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1227:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    122b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    122f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1233:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    123b:	48 89 cf             	mov    %rcx,%rdi
+    123e:	48 89 d6             	mov    %rdx,%rsi
+    1241:	48 89 c1             	mov    %rax,%rcx
+    1244:	fc                   	cld
+    1245:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    1248:	48 89 c8             	mov    %rcx,%rax
+    124b:	48 89 f2             	mov    %rsi,%rdx
+    124e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1252:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1256:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    125a:	90                   	nop
+    125b:	5d                   	pop    %rbp
+    125c:	c3                   	ret
+
+000000000000125d <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    125d:	55                   	push   %rbp
+    125e:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    1261:	0f 31                	rdtsc
+    1263:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1266:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    1269:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    126c:	48 c1 e0 20          	shl    $0x20,%rax
+    1270:	48 89 c2             	mov    %rax,%rdx
+    1273:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1276:	48 09 d0             	or     %rdx,%rax
+}
+    1279:	5d                   	pop    %rbp
+    127a:	c3                   	ret
+
+000000000000127b <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    127b:	55                   	push   %rbp
+    127c:	48 89 e5             	mov    %rsp,%rbp
+    127f:	53                   	push   %rbx
+    1280:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    1283:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    1287:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    128b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    128f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    1293:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1296:	0f a2                	cpuid
+    1298:	89 de                	mov    %ebx,%esi
+    129a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    129d:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    12a0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    12a3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    12a6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    12ab:	74 09                	je     12b6 <cpuid+0x3b>
+    *eaxp = eax;
+    12ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    12b1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    12b4:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    12b6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    12bb:	74 09                	je     12c6 <cpuid+0x4b>
+    *ebxp = ebx;
+    12bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    12c1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    12c4:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    12c6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    12cb:	74 09                	je     12d6 <cpuid+0x5b>
+    *ecxp = ecx;
+    12cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    12d1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    12d4:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    12d6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    12db:	74 09                	je     12e6 <cpuid+0x6b>
+    *edxp = edx;
+    12dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    12e1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    12e4:	89 10                	mov    %edx,(%rax)
+}
+    12e6:	90                   	nop
+    12e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    12eb:	c9                   	leave
+    12ec:	c3                   	ret
+
+00000000000012ed <strcpy>:
+char *strcpy(char *s, char *t) {
+    12ed:	55                   	push   %rbp
+    12ee:	48 89 e5             	mov    %rsp,%rbp
+    12f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    12f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1301:	90                   	nop
+    1302:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1306:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    130a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    130e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1312:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1316:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    131a:	0f b6 12             	movzbl (%rdx),%edx
+    131d:	88 10                	mov    %dl,(%rax)
+    131f:	0f b6 00             	movzbl (%rax),%eax
+    1322:	84 c0                	test   %al,%al
+    1324:	75 dc                	jne    1302 <strcpy+0x15>
+  return os;
+    1326:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    132a:	5d                   	pop    %rbp
+    132b:	c3                   	ret
+
+000000000000132c <strcmp>:
+int strcmp(const char *p, const char *q) {
+    132c:	55                   	push   %rbp
+    132d:	48 89 e5             	mov    %rsp,%rbp
+    1330:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1334:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1338:	eb 0a                	jmp    1344 <strcmp+0x18>
+    p++, q++;
+    133a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    133f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1344:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1348:	0f b6 00             	movzbl (%rax),%eax
+    134b:	84 c0                	test   %al,%al
+    134d:	74 12                	je     1361 <strcmp+0x35>
+    134f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1353:	0f b6 10             	movzbl (%rax),%edx
+    1356:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    135a:	0f b6 00             	movzbl (%rax),%eax
+    135d:	38 c2                	cmp    %al,%dl
+    135f:	74 d9                	je     133a <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1361:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1365:	0f b6 00             	movzbl (%rax),%eax
+    1368:	0f b6 d0             	movzbl %al,%edx
+    136b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    136f:	0f b6 00             	movzbl (%rax),%eax
+    1372:	0f b6 c0             	movzbl %al,%eax
+    1375:	29 c2                	sub    %eax,%edx
+    1377:	89 d0                	mov    %edx,%eax
+}
+    1379:	5d                   	pop    %rbp
+    137a:	c3                   	ret
+
+000000000000137b <strlen>:
+uint strlen(char *s) {
+    137b:	55                   	push   %rbp
+    137c:	48 89 e5             	mov    %rsp,%rbp
+    137f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1383:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    138a:	eb 04                	jmp    1390 <strlen+0x15>
+    138c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1390:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1393:	48 63 d0             	movslq %eax,%rdx
+    1396:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    139a:	48 01 d0             	add    %rdx,%rax
+    139d:	0f b6 00             	movzbl (%rax),%eax
+    13a0:	84 c0                	test   %al,%al
+    13a2:	75 e8                	jne    138c <strlen+0x11>
+    ;
+  return n;
+    13a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    13a7:	5d                   	pop    %rbp
+    13a8:	c3                   	ret
+
+00000000000013a9 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    13a9:	55                   	push   %rbp
+    13aa:	48 89 e5             	mov    %rsp,%rbp
+    13ad:	53                   	push   %rbx
+    13ae:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    13b2:	8b 05 7c 1c 00 00    	mov    0x1c7c(%rip),%eax        # 3034 <erms>
+    13b8:	85 c0                	test   %eax,%eax
+    13ba:	79 53                	jns    140f <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    13bc:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    13c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    13c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    13cb:	ba 00 00 00 00       	mov    $0x0,%edx
+    13d0:	48 89 c6             	mov    %rax,%rsi
+    13d3:	bf 00 00 00 00       	mov    $0x0,%edi
+    13d8:	e8 9e fe ff ff       	call   127b <cpuid>
+    ebx = 0;
+    13dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    13e4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    13e7:	83 f8 06             	cmp    $0x6,%eax
+    13ea:	76 14                	jbe    1400 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    13ec:	b8 07 00 00 00       	mov    $0x7,%eax
+    13f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    13f6:	0f a2                	cpuid
+    13f8:	89 d9                	mov    %ebx,%ecx
+    13fa:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    13fd:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    1400:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1403:	c1 e8 09             	shr    $0x9,%eax
+    1406:	83 e0 01             	and    $0x1,%eax
+    1409:	89 05 25 1c 00 00    	mov    %eax,0x1c25(%rip)        # 3034 <erms>
+  }
+  return erms;
+    140f:	8b 05 1f 1c 00 00    	mov    0x1c1f(%rip),%eax        # 3034 <erms>
+}
+    1415:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1419:	c9                   	leave
+    141a:	c3                   	ret
+
+000000000000141b <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    141b:	55                   	push   %rbp
+    141c:	48 89 e5             	mov    %rsp,%rbp
+    141f:	48 83 ec 10          	sub    $0x10,%rsp
+    1423:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1427:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    142a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    142d:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    1431:	76 09                	jbe    143c <memset+0x21>
+    1433:	e8 71 ff ff ff       	call   13a9 <haserms>
+    1438:	85 c0                	test   %eax,%eax
+    143a:	74 16                	je     1452 <memset+0x37>
+    stosb(dst, c, n);
+    143c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    143f:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1446:	89 ce                	mov    %ecx,%esi
+    1448:	48 89 c7             	mov    %rax,%rdi
+    144b:	e8 26 fd ff ff       	call   1176 <stosb>
+    1450:	eb 58                	jmp    14aa <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    1452:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1455:	c1 e8 03             	shr    $0x3,%eax
+    1458:	89 c6                	mov    %eax,%esi
+    145a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    145d:	48 98                	cltq
+    145f:	0f b6 c0             	movzbl %al,%eax
+    1462:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    1469:	01 01 01 
+    146c:	48 0f af c2          	imul   %rdx,%rax
+    1470:	48 89 c1             	mov    %rax,%rcx
+    1473:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1477:	48 89 f2             	mov    %rsi,%rdx
+    147a:	48 89 ce             	mov    %rcx,%rsi
+    147d:	48 89 c7             	mov    %rax,%rdi
+    1480:	e8 23 fd ff ff       	call   11a8 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    1485:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1488:	83 e0 07             	and    $0x7,%eax
+    148b:	89 c2                	mov    %eax,%edx
+    148d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1490:	83 e0 f8             	and    $0xfffffff8,%eax
+    1493:	48 89 c1             	mov    %rax,%rcx
+    1496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    149a:	48 01 c1             	add    %rax,%rcx
+    149d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    14a0:	89 c6                	mov    %eax,%esi
+    14a2:	48 89 cf             	mov    %rcx,%rdi
+    14a5:	e8 cc fc ff ff       	call   1176 <stosb>
+  }
+  return dst;
+    14aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    14ae:	c9                   	leave
+    14af:	c3                   	ret
+
+00000000000014b0 <strchr>:
+
+char *strchr(const char *s, char c) {
+    14b0:	55                   	push   %rbp
+    14b1:	48 89 e5             	mov    %rsp,%rbp
+    14b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14b8:	89 f0                	mov    %esi,%eax
+    14ba:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    14bd:	eb 17                	jmp    14d6 <strchr+0x26>
+    if (*s == c)
+    14bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14c3:	0f b6 00             	movzbl (%rax),%eax
+    14c6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    14c9:	75 06                	jne    14d1 <strchr+0x21>
+      return (char *)s;
+    14cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14cf:	eb 15                	jmp    14e6 <strchr+0x36>
+  for (; *s; s++)
+    14d1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    14d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14da:	0f b6 00             	movzbl (%rax),%eax
+    14dd:	84 c0                	test   %al,%al
+    14df:	75 de                	jne    14bf <strchr+0xf>
+  return 0;
+    14e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    14e6:	5d                   	pop    %rbp
+    14e7:	c3                   	ret
+
+00000000000014e8 <gets>:
+
+char *gets(char *buf, int max) {
+    14e8:	55                   	push   %rbp
+    14e9:	48 89 e5             	mov    %rsp,%rbp
+    14ec:	48 83 ec 20          	sub    $0x20,%rsp
+    14f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    14f4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    14f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    14fe:	eb 48                	jmp    1548 <gets+0x60>
+    cc = read(0, &c, 1);
+    1500:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1504:	ba 01 00 00 00       	mov    $0x1,%edx
+    1509:	48 89 c6             	mov    %rax,%rsi
+    150c:	bf 00 00 00 00       	mov    $0x0,%edi
+    1511:	e8 b8 05 00 00       	call   1ace <read>
+    1516:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1519:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    151d:	7e 36                	jle    1555 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    151f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1522:	8d 50 01             	lea    0x1(%rax),%edx
+    1525:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1528:	48 63 d0             	movslq %eax,%rdx
+    152b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    152f:	48 01 c2             	add    %rax,%rdx
+    1532:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1536:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1538:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    153c:	3c 0a                	cmp    $0xa,%al
+    153e:	74 16                	je     1556 <gets+0x6e>
+    1540:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1544:	3c 0d                	cmp    $0xd,%al
+    1546:	74 0e                	je     1556 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1548:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    154b:	83 c0 01             	add    $0x1,%eax
+    154e:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1551:	7f ad                	jg     1500 <gets+0x18>
+    1553:	eb 01                	jmp    1556 <gets+0x6e>
+      break;
+    1555:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1556:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1559:	48 63 d0             	movslq %eax,%rdx
+    155c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1560:	48 01 d0             	add    %rdx,%rax
+    1563:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1566:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    156a:	c9                   	leave
+    156b:	c3                   	ret
+
+000000000000156c <stat>:
+
+int stat(char *n, struct stat *st) {
+    156c:	55                   	push   %rbp
+    156d:	48 89 e5             	mov    %rsp,%rbp
+    1570:	48 83 ec 10          	sub    $0x10,%rsp
+    1574:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1578:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    157c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1584:	48 89 c6             	mov    %rax,%rsi
+    1587:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    158c:	e8 58 07 00 00       	call   1ce9 <fstatat>
+}
+    1591:	c9                   	leave
+    1592:	c3                   	ret
+
+0000000000001593 <atoi>:
+
+int atoi(const char *s) {
+    1593:	55                   	push   %rbp
+    1594:	48 89 e5             	mov    %rsp,%rbp
+    1597:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    159b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    15a2:	eb 28                	jmp    15cc <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    15a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    15a7:	89 d0                	mov    %edx,%eax
+    15a9:	c1 e0 02             	shl    $0x2,%eax
+    15ac:	01 d0                	add    %edx,%eax
+    15ae:	01 c0                	add    %eax,%eax
+    15b0:	89 c1                	mov    %eax,%ecx
+    15b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15b6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    15ba:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    15be:	0f b6 00             	movzbl (%rax),%eax
+    15c1:	0f be c0             	movsbl %al,%eax
+    15c4:	01 c8                	add    %ecx,%eax
+    15c6:	83 e8 30             	sub    $0x30,%eax
+    15c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    15cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15d0:	0f b6 00             	movzbl (%rax),%eax
+    15d3:	3c 2f                	cmp    $0x2f,%al
+    15d5:	7e 0b                	jle    15e2 <atoi+0x4f>
+    15d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15db:	0f b6 00             	movzbl (%rax),%eax
+    15de:	3c 39                	cmp    $0x39,%al
+    15e0:	7e c2                	jle    15a4 <atoi+0x11>
+  return n;
+    15e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    15e5:	5d                   	pop    %rbp
+    15e6:	c3                   	ret
+
+00000000000015e7 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    15e7:	55                   	push   %rbp
+    15e8:	48 89 e5             	mov    %rsp,%rbp
+    15eb:	48 83 ec 28          	sub    $0x28,%rsp
+    15ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    15f7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    15fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1602:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1606:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    160a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    160e:	7f 09                	jg     1619 <memmove+0x32>
+    return vdst;
+    1610:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1614:	e9 29 01 00 00       	jmp    1742 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1619:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    161d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1621:	0f 83 87 00 00 00    	jae    16ae <memmove+0xc7>
+    1627:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    162a:	48 63 d0             	movslq %eax,%rdx
+    162d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1631:	48 01 d0             	add    %rdx,%rax
+    1634:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1638:	73 74                	jae    16ae <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    163a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    163d:	48 98                	cltq
+    163f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1643:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1646:	48 98                	cltq
+    1648:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    164c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1654:	48 09 d0             	or     %rdx,%rax
+    1657:	83 e0 07             	and    $0x7,%eax
+    165a:	48 85 c0             	test   %rax,%rax
+    165d:	75 3d                	jne    169c <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    165f:	eb 1c                	jmp    167d <memmove+0x96>
+        src -= 8;
+    1661:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1666:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    166b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    166f:	48 8b 10             	mov    (%rax),%rdx
+    1672:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1676:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1679:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    167d:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1681:	7f de                	jg     1661 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1683:	eb 17                	jmp    169c <memmove+0xb5>
+      *--dst = *--src;
+    1685:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    168a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    168f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1693:	0f b6 10             	movzbl (%rax),%edx
+    1696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    169a:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    169c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    169f:	8d 50 ff             	lea    -0x1(%rax),%edx
+    16a2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    16a5:	85 c0                	test   %eax,%eax
+    16a7:	7f dc                	jg     1685 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    16a9:	e9 90 00 00 00       	jmp    173e <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    16ae:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    16b2:	7e 09                	jle    16bd <memmove+0xd6>
+    16b4:	e8 f0 fc ff ff       	call   13a9 <haserms>
+    16b9:	85 c0                	test   %eax,%eax
+    16bb:	74 1b                	je     16d8 <memmove+0xf1>
+    movsb(dst, src, n);
+    16bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16c0:	48 63 d0             	movslq %eax,%rdx
+    16c3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    16c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16cb:	48 89 ce             	mov    %rcx,%rsi
+    16ce:	48 89 c7             	mov    %rax,%rdi
+    16d1:	e8 0c fb ff ff       	call   11e2 <movsb>
+    16d6:	eb 66                	jmp    173e <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    16d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16db:	8d 50 07             	lea    0x7(%rax),%edx
+    16de:	85 c0                	test   %eax,%eax
+    16e0:	0f 48 c2             	cmovs  %edx,%eax
+    16e3:	c1 f8 03             	sar    $0x3,%eax
+    16e6:	48 63 d0             	movslq %eax,%rdx
+    16e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    16ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f1:	48 89 ce             	mov    %rcx,%rsi
+    16f4:	48 89 c7             	mov    %rax,%rdi
+    16f7:	e8 23 fb ff ff       	call   121f <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    16fc:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    16ff:	89 d0                	mov    %edx,%eax
+    1701:	c1 f8 1f             	sar    $0x1f,%eax
+    1704:	c1 e8 1d             	shr    $0x1d,%eax
+    1707:	01 c2                	add    %eax,%edx
+    1709:	83 e2 07             	and    $0x7,%edx
+    170c:	29 c2                	sub    %eax,%edx
+    170e:	89 d0                	mov    %edx,%eax
+    1710:	48 98                	cltq
+    1712:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1715:	83 e2 f8             	and    $0xfffffff8,%edx
+    1718:	48 63 ca             	movslq %edx,%rcx
+    171b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    171f:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1723:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1726:	83 e2 f8             	and    $0xfffffff8,%edx
+    1729:	48 63 ca             	movslq %edx,%rcx
+    172c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1730:	48 01 d1             	add    %rdx,%rcx
+    1733:	48 89 c2             	mov    %rax,%rdx
+    1736:	48 89 cf             	mov    %rcx,%rdi
+    1739:	e8 a4 fa ff ff       	call   11e2 <movsb>
+  }
+  return vdst;
+    173e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1742:	c9                   	leave
+    1743:	c3                   	ret
+
+0000000000001744 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1744:	55                   	push   %rbp
+    1745:	48 89 e5             	mov    %rsp,%rbp
+    1748:	48 83 ec 20          	sub    $0x20,%rsp
+    174c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    174f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1753:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    175a:	00 00 00 
+    175d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1761:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1765:	75 0d                	jne    1774 <clock_gettime+0x30>
+    1767:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    176b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    176f:	48 85 c0             	test   %rax,%rax
+    1772:	75 13                	jne    1787 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1774:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1778:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    177b:	48 89 d6             	mov    %rdx,%rsi
+    177e:	89 c7                	mov    %eax,%edi
+    1780:	e8 e0 04 00 00       	call   1c65 <_clock_gettime>
+    1785:	eb 7d                	jmp    1804 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1787:	e8 d1 fa ff ff       	call   125d <rdtsc>
+    178c:	48 89 c2             	mov    %rax,%rdx
+    178f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1793:	48 89 d6             	mov    %rdx,%rsi
+    1796:	48 89 c7             	mov    %rax,%rdi
+    1799:	e8 7b f9 ff ff       	call   1119 <clockns>
+    179e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    17a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a6:	48 c1 e8 09          	shr    $0x9,%rax
+    17aa:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    17b1:	b8 44 00 
+    17b4:	48 f7 e2             	mul    %rdx
+    17b7:	48 89 d0             	mov    %rdx,%rax
+    17ba:	48 c1 e8 0b          	shr    $0xb,%rax
+    17be:	48 89 c2             	mov    %rax,%rdx
+    17c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17c5:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    17c8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    17cc:	48 89 c8             	mov    %rcx,%rax
+    17cf:	48 c1 e8 09          	shr    $0x9,%rax
+    17d3:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    17da:	b8 44 00 
+    17dd:	48 f7 e2             	mul    %rdx
+    17e0:	48 89 d0             	mov    %rdx,%rax
+    17e3:	48 c1 e8 0b          	shr    $0xb,%rax
+    17e7:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    17ee:	48 89 c8             	mov    %rcx,%rax
+    17f1:	48 29 d0             	sub    %rdx,%rax
+    17f4:	48 89 c2             	mov    %rax,%rdx
+    17f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17fb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    17ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1804:	c9                   	leave
+    1805:	c3                   	ret
+
+0000000000001806 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1806:	55                   	push   %rbp
+    1807:	48 89 e5             	mov    %rsp,%rbp
+    180a:	48 83 ec 10          	sub    $0x10,%rsp
+    180e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1812:	eb 11                	jmp    1825 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1818:	be 02 00 00 00       	mov    $0x2,%esi
+    181d:	48 89 c7             	mov    %rax,%rdi
+    1820:	e8 6c 04 00 00       	call   1c91 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1825:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1829:	b8 02 00 00 00       	mov    $0x2,%eax
+    182e:	87 02                	xchg   %eax,(%rdx)
+    1830:	85 c0                	test   %eax,%eax
+    1832:	75 e0                	jne    1814 <mutex_wait+0xe>
+}
+    1834:	90                   	nop
+    1835:	90                   	nop
+    1836:	c9                   	leave
+    1837:	c3                   	ret
+
+0000000000001838 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1838:	55                   	push   %rbp
+    1839:	48 89 e5             	mov    %rsp,%rbp
+    183c:	48 83 ec 20          	sub    $0x20,%rsp
+    1840:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1844:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    184b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    184f:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1853:	8b 02                	mov    (%rdx),%eax
+    1855:	b9 01 00 00 00       	mov    $0x1,%ecx
+    185a:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    185e:	89 c1                	mov    %eax,%ecx
+    1860:	0f 94 c0             	sete   %al
+    1863:	84 c0                	test   %al,%al
+    1865:	75 02                	jne    1869 <mutex_lock+0x31>
+    1867:	89 0a                	mov    %ecx,(%rdx)
+    1869:	83 f0 01             	xor    $0x1,%eax
+    186c:	84 c0                	test   %al,%al
+    186e:	74 0c                	je     187c <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1870:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1874:	48 89 c7             	mov    %rax,%rdi
+    1877:	e8 8a ff ff ff       	call   1806 <mutex_wait>
+}
+    187c:	90                   	nop
+    187d:	c9                   	leave
+    187e:	c3                   	ret
+
+000000000000187f <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    187f:	55                   	push   %rbp
+    1880:	48 89 e5             	mov    %rsp,%rbp
+    1883:	48 83 ec 10          	sub    $0x10,%rsp
+    1887:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    188b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    188f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1894:	87 10                	xchg   %edx,(%rax)
+    1896:	83 fa 02             	cmp    $0x2,%edx
+    1899:	75 11                	jne    18ac <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    189b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    189f:	be 01 00 00 00       	mov    $0x1,%esi
+    18a4:	48 89 c7             	mov    %rax,%rdi
+    18a7:	e8 f0 03 00 00       	call   1c9c <futex_wake>
+}
+    18ac:	90                   	nop
+    18ad:	c9                   	leave
+    18ae:	c3                   	ret
+
+00000000000018af <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    18af:	55                   	push   %rbp
+    18b0:	48 89 e5             	mov    %rsp,%rbp
+    18b3:	48 83 ec 20          	sub    $0x20,%rsp
+    18b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    18bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    18bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18c3:	48 83 c0 04          	add    $0x4,%rax
+    18c7:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    18cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18cf:	8b 00                	mov    (%rax),%eax
+    18d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    18d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18d8:	48 89 c7             	mov    %rax,%rdi
+    18db:	e8 9f ff ff ff       	call   187f <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    18e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    18e7:	89 d6                	mov    %edx,%esi
+    18e9:	48 89 c7             	mov    %rax,%rdi
+    18ec:	e8 a0 03 00 00       	call   1c91 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    18f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18f5:	48 83 c0 04          	add    $0x4,%rax
+    18f9:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    18fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1901:	48 89 c7             	mov    %rax,%rdi
+    1904:	e8 fd fe ff ff       	call   1806 <mutex_wait>
+}
+    1909:	90                   	nop
+    190a:	c9                   	leave
+    190b:	c3                   	ret
+
+000000000000190c <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    190c:	55                   	push   %rbp
+    190d:	48 89 e5             	mov    %rsp,%rbp
+    1910:	48 83 ec 10          	sub    $0x10,%rsp
+    1914:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1918:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    191c:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1920:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1924:	48 83 c0 04          	add    $0x4,%rax
+    1928:	8b 00                	mov    (%rax),%eax
+    192a:	85 c0                	test   %eax,%eax
+    192c:	7e 11                	jle    193f <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    192e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1932:	be 01 00 00 00       	mov    $0x1,%esi
+    1937:	48 89 c7             	mov    %rax,%rdi
+    193a:	e8 5d 03 00 00       	call   1c9c <futex_wake>
+}
+    193f:	90                   	nop
+    1940:	c9                   	leave
+    1941:	c3                   	ret
+
+0000000000001942 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1942:	55                   	push   %rbp
+    1943:	48 89 e5             	mov    %rsp,%rbp
+    1946:	48 83 ec 10          	sub    $0x10,%rsp
+    194a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    194e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1952:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1956:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    195a:	48 83 c0 04          	add    $0x4,%rax
+    195e:	8b 00                	mov    (%rax),%eax
+    1960:	85 c0                	test   %eax,%eax
+    1962:	7e 11                	jle    1975 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1968:	be 00 00 00 40       	mov    $0x40000000,%esi
+    196d:	48 89 c7             	mov    %rax,%rdi
+    1970:	e8 27 03 00 00       	call   1c9c <futex_wake>
+}
+    1975:	90                   	nop
+    1976:	c9                   	leave
+    1977:	c3                   	ret
+
+0000000000001978 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1978:	55                   	push   %rbp
+    1979:	48 89 e5             	mov    %rsp,%rbp
+    197c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1980:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1983:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1987:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    198b:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    198f:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1993:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1997:	8b 40 04             	mov    0x4(%rax),%eax
+    199a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    199d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19a1:	8b 00                	mov    (%rax),%eax
+    19a3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    19a6:	29 c2                	sub    %eax,%edx
+    19a8:	83 fa 1f             	cmp    $0x1f,%edx
+    19ab:	76 07                	jbe    19b4 <ring_push+0x3c>
+    return -1;
+    19ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    19b2:	eb 7e                	jmp    1a32 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    19b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19b7:	83 e0 1f             	and    $0x1f,%eax
+    19ba:	89 c2                	mov    %eax,%edx
+    19bc:	48 89 d0             	mov    %rdx,%rax
+    19bf:	48 01 c0             	add    %rax,%rax
+    19c2:	48 01 d0             	add    %rdx,%rax
+    19c5:	48 c1 e0 04          	shl    $0x4,%rax
+    19c9:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    19cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19d1:	48 01 d0             	add    %rdx,%rax
+    19d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    19d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19dc:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    19df:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    19e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19e5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    19e9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    19ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19f1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    19f5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    19f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19fd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1a01:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1a0d:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1a11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a15:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1a19:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1a1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a20:	8d 50 01             	lea    0x1(%rax),%edx
+    1a23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a27:	48 83 c0 04          	add    $0x4,%rax
+    1a2b:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a32:	5d                   	pop    %rbp
+    1a33:	c3                   	ret
+
+0000000000001a34 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1a34:	55                   	push   %rbp
+    1a35:	48 89 e5             	mov    %rsp,%rbp
+    1a38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1a40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a44:	8b 40 08             	mov    0x8(%rax),%eax
+    1a47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1a4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a4e:	48 83 c0 0c          	add    $0xc,%rax
+    1a52:	8b 00                	mov    (%rax),%eax
+    1a54:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1a57:	75 07                	jne    1a60 <ring_pop+0x2c>
+    return -1;
+    1a59:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a5e:	eb 40                	jmp    1aa0 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1a60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a63:	83 e0 1f             	and    $0x1f,%eax
+    1a66:	89 c2                	mov    %eax,%edx
+    1a68:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a70:	89 d2                	mov    %edx,%edx
+    1a72:	48 83 c2 61          	add    $0x61,%rdx
+    1a76:	48 c1 e2 04          	shl    $0x4,%rdx
+    1a7a:	48 01 d0             	add    %rdx,%rax
+    1a7d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1a81:	48 8b 00             	mov    (%rax),%rax
+    1a84:	48 89 01             	mov    %rax,(%rcx)
+    1a87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1a8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a8e:	8d 50 01             	lea    0x1(%rax),%edx
+    1a91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a95:	48 83 c0 08          	add    $0x8,%rax
+    1a99:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1aa0:	5d                   	pop    %rbp
+    1aa1:	c3                   	ret
+
+0000000000001aa2 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1aa2:	b8 01 00 00 00       	mov    $0x1,%eax
+    1aa7:	49 89 ca             	mov    %rcx,%r10
+    1aaa:	0f 05                	syscall
+    1aac:	c3                   	ret
+
+0000000000001aad <_exit>:
+SYSCALL_(exit)
+    1aad:	b8 02 00 00 00       	mov    $0x2,%eax
+    1ab2:	49 89 ca             	mov    %rcx,%r10
+    1ab5:	0f 05                	syscall
+    1ab7:	c3                   	ret
+
+0000000000001ab8 <wait>:
+SYSCALL(wait)
+    1ab8:	b8 03 00 00 00       	mov    $0x3,%eax
+    1abd:	49 89 ca             	mov    %rcx,%r10
+    1ac0:	0f 05                	syscall
+    1ac2:	c3                   	ret
+
+0000000000001ac3 <pipe>:
+SYSCALL(pipe)
+    1ac3:	b8 04 00 00 00       	mov    $0x4,%eax
+    1ac8:	49 89 ca             	mov    %rcx,%r10
+    1acb:	0f 05                	syscall
+    1acd:	c3                   	ret
+
+0000000000001ace <read>:
+SYSCALL(read)
+    1ace:	b8 05 00 00 00       	mov    $0x5,%eax
+    1ad3:	49 89 ca             	mov    %rcx,%r10
+    1ad6:	0f 05                	syscall
+    1ad8:	c3                   	ret
+
+0000000000001ad9 <write>:
+SYSCALL(write)
+    1ad9:	b8 10 00 00 00       	mov    $0x10,%eax
+    1ade:	49 89 ca             	mov    %rcx,%r10
+    1ae1:	0f 05                	syscall
+    1ae3:	c3                   	ret
+
+0000000000001ae4 <_close>:
+SYSCALL_(close)
+    1ae4:	b8 15 00 00 00       	mov    $0x15,%eax
+    1ae9:	49 89 ca             	mov    %rcx,%r10
+    1aec:	0f 05                	syscall
+    1aee:	c3                   	ret
+
+0000000000001aef <kill>:
+SYSCALL(kill)
+    1aef:	b8 06 00 00 00       	mov    $0x6,%eax
+    1af4:	49 89 ca             	mov    %rcx,%r10
+    1af7:	0f 05                	syscall
+    1af9:	c3                   	ret
+
+0000000000001afa <_exec>:
+SYSCALL_(exec)
+    1afa:	b8 07 00 00 00       	mov    $0x7,%eax
+    1aff:	49 89 ca             	mov    %rcx,%r10
+    1b02:	0f 05                	syscall
+    1b04:	c3                   	ret
+
+0000000000001b05 <open>:
+SYSCALL(open)
+    1b05:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1b0a:	49 89 ca             	mov    %rcx,%r10
+    1b0d:	0f 05                	syscall
+    1b0f:	c3                   	ret
+
+0000000000001b10 <mknod>:
+SYSCALL(mknod)
+    1b10:	b8 11 00 00 00       	mov    $0x11,%eax
+    1b15:	49 89 ca             	mov    %rcx,%r10
+    1b18:	0f 05                	syscall
+    1b1a:	c3                   	ret
+
+0000000000001b1b <unlink>:
+SYSCALL(unlink)
+    1b1b:	b8 12 00 00 00       	mov    $0x12,%eax
+    1b20:	49 89 ca             	mov    %rcx,%r10
+    1b23:	0f 05                	syscall
+    1b25:	c3                   	ret
+
+0000000000001b26 <fstat>:
+SYSCALL(fstat)
+    1b26:	b8 08 00 00 00       	mov    $0x8,%eax
+    1b2b:	49 89 ca             	mov    %rcx,%r10
+    1b2e:	0f 05                	syscall
+    1b30:	c3                   	ret
+
+0000000000001b31 <link>:
+SYSCALL(link)
+    1b31:	b8 13 00 00 00       	mov    $0x13,%eax
+    1b36:	49 89 ca             	mov    %rcx,%r10
+    1b39:	0f 05                	syscall
+    1b3b:	c3                   	ret
+
+0000000000001b3c <mkdir>:
+SYSCALL(mkdir)
+    1b3c:	b8 14 00 00 00       	mov    $0x14,%eax
+    1b41:	49 89 ca             	mov    %rcx,%r10
+    1b44:	0f 05                	syscall
+    1b46:	c3                   	ret
+
+0000000000001b47 <chdir>:
+SYSCALL(chdir)
+    1b47:	b8 09 00 00 00       	mov    $0x9,%eax
+    1b4c:	49 89 ca             	mov    %rcx,%r10
+    1b4f:	0f 05                	syscall
+    1b51:	c3                   	ret
+
+0000000000001b52 <dup>:
+SYSCALL(dup)
+    1b52:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1b57:	49 89 ca             	mov    %rcx,%r10
+    1b5a:	0f 05                	syscall
+    1b5c:	c3                   	ret
+
+0000000000001b5d <getpid>:
+SYSCALL(getpid)
+    1b5d:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1b62:	49 89 ca             	mov    %rcx,%r10
+    1b65:	0f 05                	syscall
+    1b67:	c3                   	ret
+
+0000000000001b68 <sbrk>:
+SYSCALL(sbrk)
+    1b68:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1b6d:	49 89 ca             	mov    %rcx,%r10
+    1b70:	0f 05                	syscall
+    1b72:	c3                   	ret
+
+0000000000001b73 <sleep>:
+SYSCALL(sleep)
+    1b73:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1b78:	49 89 ca             	mov    %rcx,%r10
+    1b7b:	0f 05                	syscall
+    1b7d:	c3                   	ret
+
+0000000000001b7e <uptime>:
+SYSCALL(uptime)
+    1b7e:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1b83:	49 89 ca             	mov    %rcx,%r10
+    1b86:	0f 05                	syscall
+    1b88:	c3                   	ret
+
+0000000000001b89 <sysinfo>:
+SYSCALL(sysinfo)
+    1b89:	b8 16 00 00 00       	mov    $0x16,%eax
+    1b8e:	49 89 ca             	mov    %rcx,%r10
+    1b91:	0f 05                	syscall
+    1b93:	c3                   	ret
+
+0000000000001b94 <crashn>:
+SYSCALL(crashn)
+    1b94:	b8 17 00 00 00       	mov    $0x17,%eax
+    1b99:	49 89 ca             	mov    %rcx,%r10
+    1b9c:	0f 05                	syscall
+    1b9e:	c3                   	ret
+
+0000000000001b9f <mmap>:
+SYSCALL(mmap)
+    1b9f:	b8 18 00 00 00       	mov    $0x18,%eax
+    1ba4:	49 89 ca             	mov    %rcx,%r10
+    1ba7:	0f 05                	syscall
+    1ba9:	c3                   	ret
+
+0000000000001baa <munmap>:
+SYSCALL(munmap)
+    1baa:	b8 19 00 00 00       	mov    $0x19,%eax
+    1baf:	49 89 ca             	mov    %rcx,%r10
+    1bb2:	0f 05                	syscall
+    1bb4:	c3                   	ret
+
+0000000000001bb5 <nice>:
+SYSCALL(nice)
+    1bb5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1bba:	49 89 ca             	mov    %rcx,%r10
+    1bbd:	0f 05                	syscall
+    1bbf:	c3                   	ret
+
+0000000000001bc0 <_spawn>:
+SYSCALL_(spawn)
+    1bc0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1bc5:	49 89 ca             	mov    %rcx,%r10
+    1bc8:	0f 05                	syscall
+    1bca:	c3                   	ret
+
+0000000000001bcb <pread>:
+SYSCALL(pread)
+    1bcb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1bd0:	49 89 ca             	mov    %rcx,%r10
+    1bd3:	0f 05                	syscall
+    1bd5:	c3                   	ret
+
+0000000000001bd6 <pwrite>:
+SYSCALL(pwrite)
+    1bd6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1bdb:	49 89 ca             	mov    %rcx,%r10
+    1bde:	0f 05                	syscall
+    1be0:	c3                   	ret
+
+0000000000001be1 <readv>:
+SYSCALL(readv)
+    1be1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1be6:	49 89 ca             	mov    %rcx,%r10
+    1be9:	0f 05                	syscall
+    1beb:	c3                   	ret
+
+0000000000001bec <writev>:
+SYSCALL(writev)
+    1bec:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1bf1:	49 89 ca             	mov    %rcx,%r10
+    1bf4:	0f 05                	syscall
+    1bf6:	c3                   	ret
+
+0000000000001bf7 <sendfile>:
+SYSCALL(sendfile)
+    1bf7:	b8 20 00 00 00       	mov    $0x20,%eax
+    1bfc:	49 89 ca             	mov    %rcx,%r10
+    1bff:	0f 05                	syscall
+    1c01:	c3                   	ret
+
+0000000000001c02 <splice>:
+SYSCALL(splice)
+    1c02:	b8 21 00 00 00       	mov    $0x21,%eax
+    1c07:	49 89 ca             	mov    %rcx,%r10
+    1c0a:	0f 05                	syscall
+    1c0c:	c3                   	ret
+
+0000000000001c0d <poll>:
+SYSCALL(poll)
+    1c0d:	b8 22 00 00 00       	mov    $0x22,%eax
+    1c12:	49 89 ca             	mov    %rcx,%r10
+    1c15:	0f 05                	syscall
+    1c17:	c3                   	ret
+
+0000000000001c18 <fsync>:
+SYSCALL(fsync)
+    1c18:	b8 23 00 00 00       	mov    $0x23,%eax
+    1c1d:	49 89 ca             	mov    %rcx,%r10
+    1c20:	0f 05                	syscall
+    1c22:	c3                   	ret
+
+0000000000001c23 <fdatasync>:
+SYSCALL(fdatasync)
+    1c23:	b8 24 00 00 00       	mov    $0x24,%eax
+    1c28:	49 89 ca             	mov    %rcx,%r10
+    1c2b:	0f 05                	syscall
+    1c2d:	c3                   	ret
+
+0000000000001c2e <lockstat>:
+SYSCALL(lockstat)
+    1c2e:	b8 25 00 00 00       	mov    $0x25,%eax
+    1c33:	49 89 ca             	mov    %rcx,%r10
+    1c36:	0f 05                	syscall
+    1c38:	c3                   	ret
+
+0000000000001c39 <syscallstat>:
+SYSCALL(syscallstat)
+    1c39:	b8 26 00 00 00       	mov    $0x26,%eax
+    1c3e:	49 89 ca             	mov    %rcx,%r10
+    1c41:	0f 05                	syscall
+    1c43:	c3                   	ret
+
+0000000000001c44 <trace>:
+SYSCALL(trace)
+    1c44:	b8 27 00 00 00       	mov    $0x27,%eax
+    1c49:	49 89 ca             	mov    %rcx,%r10
+    1c4c:	0f 05                	syscall
+    1c4e:	c3                   	ret
+
+0000000000001c4f <profile>:
+SYSCALL(profile)
+    1c4f:	b8 28 00 00 00       	mov    $0x28,%eax
+    1c54:	49 89 ca             	mov    %rcx,%r10
+    1c57:	0f 05                	syscall
+    1c59:	c3                   	ret
+
+0000000000001c5a <cycles>:
+SYSCALL(cycles)
+    1c5a:	b8 29 00 00 00       	mov    $0x29,%eax
+    1c5f:	49 89 ca             	mov    %rcx,%r10
+    1c62:	0f 05                	syscall
+    1c64:	c3                   	ret
+
+0000000000001c65 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1c65:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1c6a:	49 89 ca             	mov    %rcx,%r10
+    1c6d:	0f 05                	syscall
+    1c6f:	c3                   	ret
+
+0000000000001c70 <consmode>:
+SYSCALL(consmode)
+    1c70:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1c75:	49 89 ca             	mov    %rcx,%r10
+    1c78:	0f 05                	syscall
+    1c7a:	c3                   	ret
+
+0000000000001c7b <clone>:
+SYSCALL(clone)
+    1c7b:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1c80:	49 89 ca             	mov    %rcx,%r10
+    1c83:	0f 05                	syscall
+    1c85:	c3                   	ret
+
+0000000000001c86 <join>:
+SYSCALL(join)
+    1c86:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1c8b:	49 89 ca             	mov    %rcx,%r10
+    1c8e:	0f 05                	syscall
+    1c90:	c3                   	ret
+
+0000000000001c91 <futex_wait>:
+SYSCALL(futex_wait)
+    1c91:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1c96:	49 89 ca             	mov    %rcx,%r10
+    1c99:	0f 05                	syscall
+    1c9b:	c3                   	ret
+
+0000000000001c9c <futex_wake>:
+SYSCALL(futex_wake)
+    1c9c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1ca1:	49 89 ca             	mov    %rcx,%r10
+    1ca4:	0f 05                	syscall
+    1ca6:	c3                   	ret
+
+0000000000001ca7 <shmget>:
+SYSCALL(shmget)
+    1ca7:	b8 30 00 00 00       	mov    $0x30,%eax
+    1cac:	49 89 ca             	mov    %rcx,%r10
+    1caf:	0f 05                	syscall
+    1cb1:	c3                   	ret
+
+0000000000001cb2 <shmat>:
+SYSCALL(shmat)
+    1cb2:	b8 31 00 00 00       	mov    $0x31,%eax
+    1cb7:	49 89 ca             	mov    %rcx,%r10
+    1cba:	0f 05                	syscall
+    1cbc:	c3                   	ret
+
+0000000000001cbd <shmdt>:
+SYSCALL(shmdt)
+    1cbd:	b8 32 00 00 00       	mov    $0x32,%eax
+    1cc2:	49 89 ca             	mov    %rcx,%r10
+    1cc5:	0f 05                	syscall
+    1cc7:	c3                   	ret
+
+0000000000001cc8 <ring_setup>:
+SYSCALL(ring_setup)
+    1cc8:	b8 33 00 00 00       	mov    $0x33,%eax
+    1ccd:	49 89 ca             	mov    %rcx,%r10
+    1cd0:	0f 05                	syscall
+    1cd2:	c3                   	ret
+
+0000000000001cd3 <ring_enter>:
+SYSCALL(ring_enter)
+    1cd3:	b8 34 00 00 00       	mov    $0x34,%eax
+    1cd8:	49 89 ca             	mov    %rcx,%r10
+    1cdb:	0f 05                	syscall
+    1cdd:	c3                   	ret
+
+0000000000001cde <getdents>:
+SYSCALL(getdents)
+    1cde:	b8 35 00 00 00       	mov    $0x35,%eax
+    1ce3:	49 89 ca             	mov    %rcx,%r10
+    1ce6:	0f 05                	syscall
+    1ce8:	c3                   	ret
+
+0000000000001ce9 <fstatat>:
+SYSCALL(fstatat)
+    1ce9:	b8 36 00 00 00       	mov    $0x36,%eax
+    1cee:	49 89 ca             	mov    %rcx,%r10
+    1cf1:	0f 05                	syscall
+    1cf3:	c3                   	ret
+
+0000000000001cf4 <clone_file>:
+SYSCALL(clone_file)
+    1cf4:	b8 37 00 00 00       	mov    $0x37,%eax
+    1cf9:	49 89 ca             	mov    %rcx,%r10
+    1cfc:	0f 05                	syscall
+    1cfe:	c3                   	ret
+
+0000000000001cff <fpunch>:
+SYSCALL(fpunch)
+    1cff:	b8 38 00 00 00       	mov    $0x38,%eax
+    1d04:	49 89 ca             	mov    %rcx,%r10
+    1d07:	0f 05                	syscall
+    1d09:	c3                   	ret
+
+0000000000001d0a <defrag>:
+SYSCALL(defrag)
+    1d0a:	b8 39 00 00 00       	mov    $0x39,%eax
+    1d0f:	49 89 ca             	mov    %rcx,%r10
+    1d12:	0f 05                	syscall
+    1d14:	c3                   	ret
+
+0000000000001d15 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1d15:	55                   	push   %rbp
+    1d16:	48 89 e5             	mov    %rsp,%rbp
+    1d19:	48 83 ec 20          	sub    $0x20,%rsp
+    1d1d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1d21:	bf 00 00 00 00       	mov    $0x0,%edi
+    1d26:	e8 3d fe ff ff       	call   1b68 <sbrk>
+    1d2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1d2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d33:	48 f7 d8             	neg    %rax
+    1d36:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1d3b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1d3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d47:	48 01 c2             	add    %rax,%rdx
+    1d4a:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1d4f:	48 39 c2             	cmp    %rax,%rdx
+    1d52:	73 1e                	jae    1d72 <morecore+0x5d>
+    1d54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d58:	89 c2                	mov    %eax,%edx
+    1d5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d5e:	01 d0                	add    %edx,%eax
+    1d60:	89 c7                	mov    %eax,%edi
+    1d62:	e8 01 fe ff ff       	call   1b68 <sbrk>
+    1d67:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d6b:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1d70:	75 07                	jne    1d79 <morecore+0x64>
+    return 0;
+    1d72:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d77:	eb 27                	jmp    1da0 <morecore+0x8b>
+  stats.heap += n + pad;
+    1d79:	48 8b 05 10 18 01 00 	mov    0x11810(%rip),%rax        # 13590 <stats+0x50>
+    1d80:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1d84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d88:	48 01 ca             	add    %rcx,%rdx
+    1d8b:	48 01 d0             	add    %rdx,%rax
+    1d8e:	48 89 05 fb 17 01 00 	mov    %rax,0x117fb(%rip)        # 13590 <stats+0x50>
+  return p + pad;
+    1d95:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1d99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d9d:	48 01 d0             	add    %rdx,%rax
+}
+    1da0:	c9                   	leave
+    1da1:	c3                   	ret
+
+0000000000001da2 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1da2:	55                   	push   %rbp
+    1da3:	48 89 e5             	mov    %rsp,%rbp
+    1da6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1daa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1dae:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1db5:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1db6:	48 8d 05 63 17 01 00 	lea    0x11763(%rip),%rax        # 13520 <runs>
+    1dbd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1dc1:	eb 1a                	jmp    1ddd <pagefree+0x3b>
+    prev = *rp;
+    1dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dc7:	48 8b 00             	mov    (%rax),%rax
+    1dca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1dce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd2:	48 8b 00             	mov    (%rax),%rax
+    1dd5:	48 83 c0 08          	add    $0x8,%rax
+    1dd9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ddd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de1:	48 8b 00             	mov    (%rax),%rax
+    1de4:	48 85 c0             	test   %rax,%rax
+    1de7:	74 0d                	je     1df6 <pagefree+0x54>
+    1de9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ded:	48 8b 00             	mov    (%rax),%rax
+    1df0:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1df4:	72 cd                	jb     1dc3 <pagefree+0x21>
+  r = (struct run *)p;
+    1df6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1dfa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1dfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e02:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1e06:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1e09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e0d:	48 8b 10             	mov    (%rax),%rdx
+    1e10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e14:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e20:	48 85 c0             	test   %rax,%rax
+    1e23:	74 48                	je     1e6d <pagefree+0xcb>
+    1e25:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1e29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1e2d:	48 01 c2             	add    %rax,%rdx
+    1e30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e34:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e38:	48 39 c2             	cmp    %rax,%rdx
+    1e3b:	75 30                	jne    1e6d <pagefree+0xcb>
+    r->size += r->next->size;
+    1e3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e41:	48 8b 10             	mov    (%rax),%rdx
+    1e44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e48:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e4c:	48 8b 00             	mov    (%rax),%rax
+    1e4f:	48 01 c2             	add    %rax,%rdx
+    1e52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e56:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1e59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e61:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1e65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e69:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1e6d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1e72:	74 46                	je     1eba <pagefree+0x118>
+    1e74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e78:	48 8b 10             	mov    (%rax),%rdx
+    1e7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e7f:	48 01 d0             	add    %rdx,%rax
+    1e82:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1e86:	75 32                	jne    1eba <pagefree+0x118>
+    prev->size += r->size;
+    1e88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e8c:	48 8b 10             	mov    (%rax),%rdx
+    1e8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e93:	48 8b 00             	mov    (%rax),%rax
+    1e96:	48 01 c2             	add    %rax,%rdx
+    1e99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e9d:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1ea0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ea4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1ea8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eac:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1eb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eb4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1eb8:	eb 0c                	jmp    1ec6 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1eba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ebe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ec2:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1ec5:	90                   	nop
+    1ec6:	90                   	nop
+    1ec7:	5d                   	pop    %rbp
+    1ec8:	c3                   	ret
+
+0000000000001ec9 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1ec9:	55                   	push   %rbp
+    1eca:	48 89 e5             	mov    %rsp,%rbp
+    1ecd:	48 83 ec 40          	sub    $0x40,%rsp
+    1ed1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1ed5:	48 8d 05 44 16 01 00 	lea    0x11644(%rip),%rax        # 13520 <runs>
+    1edc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ee0:	eb 66                	jmp    1f48 <pagealloc+0x7f>
+    if (r->size == n) {
+    1ee2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ee6:	48 8b 00             	mov    (%rax),%rax
+    1ee9:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1eed:	75 18                	jne    1f07 <pagealloc+0x3e>
+      *rp = r->next;
+    1eef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ef3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1ef7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1efb:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1efe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f02:	e9 ca 00 00 00       	jmp    1fd1 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1f07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f0b:	48 8b 00             	mov    (%rax),%rax
+    1f0e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1f12:	73 28                	jae    1f3c <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1f14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f18:	48 8b 00             	mov    (%rax),%rax
+    1f1b:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1f1f:	48 89 c2             	mov    %rax,%rdx
+    1f22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f26:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1f29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f2d:	48 8b 10             	mov    (%rax),%rdx
+    1f30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f34:	48 01 d0             	add    %rdx,%rax
+    1f37:	e9 95 00 00 00       	jmp    1fd1 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1f3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f40:	48 83 c0 08          	add    $0x8,%rax
+    1f44:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f4c:	48 8b 00             	mov    (%rax),%rax
+    1f4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1f53:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1f58:	75 88                	jne    1ee2 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1f5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1f5e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1f62:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1f69:	00 
+    1f6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1f6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f72:	48 39 c2             	cmp    %rax,%rdx
+    1f75:	48 0f 43 c2          	cmovae %rdx,%rax
+    1f79:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1f7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f81:	48 89 c7             	mov    %rax,%rdi
+    1f84:	e8 8c fd ff ff       	call   1d15 <morecore>
+    1f89:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1f8d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1f92:	75 07                	jne    1f9b <pagealloc+0xd2>
+    return 0;
+    1f94:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f99:	eb 36                	jmp    1fd1 <pagealloc+0x108>
+  if (m > n)
+    1f9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f9f:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1fa3:	73 1a                	jae    1fbf <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1fa5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1fa9:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1fad:	48 89 c2             	mov    %rax,%rdx
+    1fb0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1fb4:	48 89 d6             	mov    %rdx,%rsi
+    1fb7:	48 89 c7             	mov    %rax,%rdi
+    1fba:	e8 e3 fd ff ff       	call   1da2 <pagefree>
+  return p + m - n;
+    1fbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1fc3:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1fc7:	48 89 c2             	mov    %rax,%rdx
+    1fca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1fce:	48 01 d0             	add    %rdx,%rax
+}
+    1fd1:	c9                   	leave
+    1fd2:	c3                   	ret
+
+0000000000001fd3 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1fd3:	55                   	push   %rbp
+    1fd4:	48 89 e5             	mov    %rsp,%rbp
+    1fd7:	48 83 ec 30          	sub    $0x30,%rsp
+    1fdb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1fde:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1fe3:	e8 e1 fe ff ff       	call   1ec9 <pagealloc>
+    1fe8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1fec:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ff1:	75 0a                	jne    1ffd <refill+0x2a>
+    return -1;
+    1ff3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1ff8:	e9 da 00 00 00       	jmp    20d7 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1ffd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2004:	00 
+    2005:	e9 ba 00 00 00       	jmp    20c4 <refill+0xf1>
+    b = (struct block *)(p + off);
+    200a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    200e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2012:	48 01 d0             	add    %rdx,%rax
+    2015:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    2019:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    201c:	ba 20 00 00 00       	mov    $0x20,%edx
+    2021:	89 c1                	mov    %eax,%ecx
+    2023:	48 d3 e2             	shl    %cl,%rdx
+    2026:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    202a:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    202d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2030:	48 63 d0             	movslq %eax,%rdx
+    2033:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2037:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    203b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    203e:	48 98                	cltq
+    2040:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2047:	00 
+    2048:	48 8d 05 91 14 01 00 	lea    0x11491(%rip),%rax        # 134e0 <freelist>
+    204f:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2053:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2057:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    205b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    205e:	48 98                	cltq
+    2060:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2067:	00 
+    2068:	48 8d 15 71 14 01 00 	lea    0x11471(%rip),%rdx        # 134e0 <freelist>
+    206f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2073:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    2077:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    207a:	48 98                	cltq
+    207c:	48 83 c0 08          	add    $0x8,%rax
+    2080:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2087:	00 
+    2088:	48 8d 05 b5 14 01 00 	lea    0x114b5(%rip),%rax        # 13544 <stats+0x4>
+    208f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2092:	8d 48 01             	lea    0x1(%rax),%ecx
+    2095:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2098:	48 98                	cltq
+    209a:	48 83 c0 08          	add    $0x8,%rax
+    209e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20a5:	00 
+    20a6:	48 8d 05 97 14 01 00 	lea    0x11497(%rip),%rax        # 13544 <stats+0x4>
+    20ad:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    20b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20b3:	ba 20 00 00 00       	mov    $0x20,%edx
+    20b8:	89 c1                	mov    %eax,%ecx
+    20ba:	48 d3 e2             	shl    %cl,%rdx
+    20bd:	48 89 d0             	mov    %rdx,%rax
+    20c0:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    20c4:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    20cb:	00 
+    20cc:	0f 86 38 ff ff ff    	jbe    200a <refill+0x37>
+  }
+  return 0;
+    20d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    20d7:	c9                   	leave
+    20d8:	c3                   	ret
+
+00000000000020d9 <malloc>:
+
+void *malloc(uint nbytes) {
+    20d9:	55                   	push   %rbp
+    20da:	48 89 e5             	mov    %rsp,%rbp
+    20dd:	48 83 ec 30          	sub    $0x30,%rsp
+    20e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    20e4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20e7:	48 83 c0 10          	add    $0x10,%rax
+    20eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    20ef:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    20f6:	eb 04                	jmp    20fc <malloc+0x23>
+    20f8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    20fc:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    2100:	7f 16                	jg     2118 <malloc+0x3f>
+    2102:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2105:	ba 20 00 00 00       	mov    $0x20,%edx
+    210a:	89 c1                	mov    %eax,%ecx
+    210c:	48 d3 e2             	shl    %cl,%rdx
+    210f:	48 89 d0             	mov    %rdx,%rax
+    2112:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    2116:	72 e0                	jb     20f8 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    2118:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    211c:	75 7d                	jne    219b <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    211e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2122:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    2128:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    212e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    2132:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2136:	48 89 c7             	mov    %rax,%rdi
+    2139:	e8 8b fd ff ff       	call   1ec9 <pagealloc>
+    213e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2142:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    2147:	75 0a                	jne    2153 <malloc+0x7a>
+      return 0;
+    2149:	b8 00 00 00 00       	mov    $0x0,%eax
+    214e:	e9 2c 01 00 00       	jmp    227f <malloc+0x1a6>
+    h->size = n;
+    2153:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2157:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    215b:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    215e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2162:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    2169:	00 
+    stats.inuse[LARGE]++;
+    216a:	8b 05 f0 13 01 00    	mov    0x113f0(%rip),%eax        # 13560 <stats+0x20>
+    2170:	83 c0 01             	add    $0x1,%eax
+    2173:	89 05 e7 13 01 00    	mov    %eax,0x113e7(%rip)        # 13560 <stats+0x20>
+    stats.large += n;
+    2179:	48 8b 15 08 14 01 00 	mov    0x11408(%rip),%rdx        # 13588 <stats+0x48>
+    2180:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2184:	48 01 d0             	add    %rdx,%rax
+    2187:	48 89 05 fa 13 01 00 	mov    %rax,0x113fa(%rip)        # 13588 <stats+0x48>
+    return h + 1;
+    218e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2192:	48 83 c0 10          	add    $0x10,%rax
+    2196:	e9 e4 00 00 00       	jmp    227f <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    219b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    219e:	48 98                	cltq
+    21a0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    21a7:	00 
+    21a8:	48 8d 05 31 13 01 00 	lea    0x11331(%rip),%rax        # 134e0 <freelist>
+    21af:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    21b3:	48 85 c0             	test   %rax,%rax
+    21b6:	75 18                	jne    21d0 <malloc+0xf7>
+    21b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21bb:	89 c7                	mov    %eax,%edi
+    21bd:	e8 11 fe ff ff       	call   1fd3 <refill>
+    21c2:	85 c0                	test   %eax,%eax
+    21c4:	79 0a                	jns    21d0 <malloc+0xf7>
+    return 0;
+    21c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    21cb:	e9 af 00 00 00       	jmp    227f <malloc+0x1a6>
+  b = freelist[c];
+    21d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21d3:	48 98                	cltq
+    21d5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    21dc:	00 
+    21dd:	48 8d 05 fc 12 01 00 	lea    0x112fc(%rip),%rax        # 134e0 <freelist>
+    21e4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    21e8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    21ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21f0:	48 8b 40 10          	mov    0x10(%rax),%rax
+    21f4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    21f7:	48 63 d2             	movslq %edx,%rdx
+    21fa:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2201:	00 
+    2202:	48 8d 15 d7 12 01 00 	lea    0x112d7(%rip),%rdx        # 134e0 <freelist>
+    2209:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    220d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2210:	48 98                	cltq
+    2212:	48 83 c0 08          	add    $0x8,%rax
+    2216:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    221d:	00 
+    221e:	48 8d 05 1f 13 01 00 	lea    0x1131f(%rip),%rax        # 13544 <stats+0x4>
+    2225:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2228:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    222b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    222e:	48 98                	cltq
+    2230:	48 83 c0 08          	add    $0x8,%rax
+    2234:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    223b:	00 
+    223c:	48 8d 05 01 13 01 00 	lea    0x11301(%rip),%rax        # 13544 <stats+0x4>
+    2243:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    2246:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2249:	48 98                	cltq
+    224b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2252:	00 
+    2253:	48 8d 05 e6 12 01 00 	lea    0x112e6(%rip),%rax        # 13540 <stats>
+    225a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    225d:	8d 48 01             	lea    0x1(%rax),%ecx
+    2260:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2263:	48 98                	cltq
+    2265:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    226c:	00 
+    226d:	48 8d 05 cc 12 01 00 	lea    0x112cc(%rip),%rax        # 13540 <stats>
+    2274:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    2277:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    227b:	48 83 c0 10          	add    $0x10,%rax
+}
+    227f:	c9                   	leave
+    2280:	c3                   	ret
+
+0000000000002281 <free>:
+
+void free(void *ap) {
+    2281:	55                   	push   %rbp
+    2282:	48 89 e5             	mov    %rsp,%rbp
+    2285:	48 83 ec 18          	sub    $0x18,%rsp
+    2289:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    228d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2292:	0f 84 03 01 00 00    	je     239b <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    2298:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    229c:	48 83 e8 10          	sub    $0x10,%rax
+    22a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    22a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+    22ac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    22b0:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    22b5:	75 42                	jne    22f9 <free+0x78>
+    stats.inuse[LARGE]--;
+    22b7:	8b 05 a3 12 01 00    	mov    0x112a3(%rip),%eax        # 13560 <stats+0x20>
+    22bd:	83 e8 01             	sub    $0x1,%eax
+    22c0:	89 05 9a 12 01 00    	mov    %eax,0x1129a(%rip)        # 13560 <stats+0x20>
+    stats.large -= b->h.size;
+    22c6:	48 8b 15 bb 12 01 00 	mov    0x112bb(%rip),%rdx        # 13588 <stats+0x48>
+    22cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d1:	48 8b 00             	mov    (%rax),%rax
+    22d4:	48 29 c2             	sub    %rax,%rdx
+    22d7:	48 89 15 aa 12 01 00 	mov    %rdx,0x112aa(%rip)        # 13588 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    22de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22e2:	48 8b 10             	mov    (%rax),%rdx
+    22e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22e9:	48 89 d6             	mov    %rdx,%rsi
+    22ec:	48 89 c7             	mov    %rax,%rdi
+    22ef:	e8 ae fa ff ff       	call   1da2 <pagefree>
+    return;
+    22f4:	e9 a3 00 00 00       	jmp    239c <free+0x11b>
+  }
+  b->next = freelist[c];
+    22f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22fd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2304:	00 
+    2305:	48 8d 05 d4 11 01 00 	lea    0x111d4(%rip),%rax        # 134e0 <freelist>
+    230c:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2310:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2314:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    2318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    231c:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2323:	00 
+    2324:	48 8d 15 b5 11 01 00 	lea    0x111b5(%rip),%rdx        # 134e0 <freelist>
+    232b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    232f:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    2333:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2337:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    233e:	00 
+    233f:	48 8d 05 fa 11 01 00 	lea    0x111fa(%rip),%rax        # 13540 <stats>
+    2346:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2349:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    234c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2350:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2357:	00 
+    2358:	48 8d 05 e1 11 01 00 	lea    0x111e1(%rip),%rax        # 13540 <stats>
+    235f:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    2362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2366:	48 83 c0 08          	add    $0x8,%rax
+    236a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2371:	00 
+    2372:	48 8d 05 cb 11 01 00 	lea    0x111cb(%rip),%rax        # 13544 <stats+0x4>
+    2379:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    237c:	8d 48 01             	lea    0x1(%rax),%ecx
+    237f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2383:	48 83 c0 08          	add    $0x8,%rax
+    2387:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    238e:	00 
+    238f:	48 8d 05 ae 11 01 00 	lea    0x111ae(%rip),%rax        # 13544 <stats+0x4>
+    2396:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    2399:	eb 01                	jmp    239c <free+0x11b>
+    return;
+    239b:	90                   	nop
+}
+    239c:	c9                   	leave
+    239d:	c3                   	ret
+
+000000000000239e <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    239e:	55                   	push   %rbp
+    239f:	48 89 e5             	mov    %rsp,%rbp
+    23a2:	48 83 ec 30          	sub    $0x30,%rsp
+    23a6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    23a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    23ac:	48 8d 15 b5 02 00 00 	lea    0x2b5(%rip),%rdx        # 2668 <benchreport+0x1a2>
+    23b3:	48 89 d6             	mov    %rdx,%rsi
+    23b6:	89 c7                	mov    %eax,%edi
+    23b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    23bd:	e8 37 e6 ff ff       	call   9f9 <printf>
+  for (c = 0; c < NCLASS; c++)
+    23c2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    23c9:	eb 67                	jmp    2432 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    23cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    23ce:	48 98                	cltq
+    23d0:	48 83 c0 08          	add    $0x8,%rax
+    23d4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    23db:	00 
+    23dc:	48 8d 05 61 11 01 00 	lea    0x11161(%rip),%rax        # 13544 <stats+0x4>
+    23e3:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    23e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    23e9:	48 98                	cltq
+    23eb:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    23f2:	00 
+    23f3:	48 8d 05 46 11 01 00 	lea    0x11146(%rip),%rax        # 13540 <stats>
+    23fa:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    23fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2400:	ba 20 00 00 00       	mov    $0x20,%edx
+    2405:	89 c1                	mov    %eax,%ecx
+    2407:	48 d3 e2             	shl    %cl,%rdx
+    240a:	48 89 d0             	mov    %rdx,%rax
+    240d:	89 c1                	mov    %eax,%ecx
+    240f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2412:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2415:	41 89 f9             	mov    %edi,%r9d
+    2418:	41 89 f0             	mov    %esi,%r8d
+    241b:	48 8d 35 5d 02 00 00 	lea    0x25d(%rip),%rsi        # 267f <benchreport+0x1b9>
+    2422:	89 c7                	mov    %eax,%edi
+    2424:	b8 00 00 00 00       	mov    $0x0,%eax
+    2429:	e8 cb e5 ff ff       	call   9f9 <printf>
+  for (c = 0; c < NCLASS; c++)
+    242e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    2432:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    2436:	7e 93                	jle    23cb <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    2438:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    243f:	00 
+  for (r = runs; r; r = r->next)
+    2440:	48 8b 05 d9 10 01 00 	mov    0x110d9(%rip),%rax        # 13520 <runs>
+    2447:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    244b:	eb 17                	jmp    2464 <mallocstats+0xc6>
+    nfree += r->size;
+    244d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2451:	48 8b 00             	mov    (%rax),%rax
+    2454:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    2458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    245c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2460:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2464:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2469:	75 e2                	jne    244d <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    246b:	48 8b 05 1e 11 01 00 	mov    0x1111e(%rip),%rax        # 13590 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2472:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2474:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2478:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    247c:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    247e:	48 8b 05 03 11 01 00 	mov    0x11103(%rip),%rax        # 13588 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2485:	89 c1                	mov    %eax,%ecx
+    2487:	8b 15 d3 10 01 00    	mov    0x110d3(%rip),%edx        # 13560 <stats+0x20>
+    248d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2490:	41 89 f9             	mov    %edi,%r9d
+    2493:	41 89 f0             	mov    %esi,%r8d
+    2496:	48 8d 35 f3 01 00 00 	lea    0x1f3(%rip),%rsi        # 2690 <benchreport+0x1ca>
+    249d:	89 c7                	mov    %eax,%edi
+    249f:	b8 00 00 00 00       	mov    $0x0,%eax
+    24a4:	e8 50 e5 ff ff       	call   9f9 <printf>
+}
+    24a9:	90                   	nop
+    24aa:	c9                   	leave
+    24ab:	c3                   	ret
+
+00000000000024ac <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    24ac:	55                   	push   %rbp
+    24ad:	48 89 e5             	mov    %rsp,%rbp
+    24b0:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    24b4:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    24b8:	48 89 c7             	mov    %rax,%rdi
+    24bb:	e8 9a f7 ff ff       	call   1c5a <cycles>
+  return t;
+    24c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    24c4:	c9                   	leave
+    24c5:	c3                   	ret
+
+00000000000024c6 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    24c6:	55                   	push   %rbp
+    24c7:	48 89 e5             	mov    %rsp,%rbp
+    24ca:	48 83 ec 30          	sub    $0x30,%rsp
+    24ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24d2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    24d6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    24d9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    24dd:	0f 8e 24 01 00 00    	jle    2607 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    24e3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    24ea:	e9 98 00 00 00       	jmp    2587 <benchreport+0xc1>
+    x = t[i];
+    24ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    24f2:	48 98                	cltq
+    24f4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    24fb:	00 
+    24fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2500:	48 01 d0             	add    %rdx,%rax
+    2503:	48 8b 00             	mov    (%rax),%rax
+    2506:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    250a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    250d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2510:	eb 33                	jmp    2545 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    2512:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2515:	48 98                	cltq
+    2517:	48 c1 e0 03          	shl    $0x3,%rax
+    251b:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    251f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2523:	48 01 d0             	add    %rdx,%rax
+    2526:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2529:	48 63 d2             	movslq %edx,%rdx
+    252c:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2533:	00 
+    2534:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2538:	48 01 ca             	add    %rcx,%rdx
+    253b:	48 8b 00             	mov    (%rax),%rax
+    253e:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2541:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    2545:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2549:	7e 1d                	jle    2568 <benchreport+0xa2>
+    254b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    254e:	48 98                	cltq
+    2550:	48 c1 e0 03          	shl    $0x3,%rax
+    2554:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2558:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    255c:	48 01 d0             	add    %rdx,%rax
+    255f:	48 8b 00             	mov    (%rax),%rax
+    2562:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2566:	72 aa                	jb     2512 <benchreport+0x4c>
+    t[j] = x;
+    2568:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    256b:	48 98                	cltq
+    256d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2574:	00 
+    2575:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2579:	48 01 c2             	add    %rax,%rdx
+    257c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2580:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    2583:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2587:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    258a:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    258d:	0f 8c 5c ff ff ff    	jl     24ef <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    2593:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2596:	48 98                	cltq
+    2598:	48 c1 e0 03          	shl    $0x3,%rax
+    259c:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    25a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25a4:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    25a7:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    25aa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    25ad:	89 c2                	mov    %eax,%edx
+    25af:	c1 ea 1f             	shr    $0x1f,%edx
+    25b2:	01 d0                	add    %edx,%eax
+    25b4:	d1 f8                	sar    %eax
+    25b6:	48 98                	cltq
+    25b8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    25bf:	00 
+    25c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25c4:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    25c7:	48 8b 38             	mov    (%rax),%rdi
+    25ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    25ce:	48 8b 30             	mov    (%rax),%rsi
+    25d1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    25d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25d8:	48 83 ec 08          	sub    $0x8,%rsp
+    25dc:	51                   	push   %rcx
+    25dd:	49 89 f9             	mov    %rdi,%r9
+    25e0:	49 89 f0             	mov    %rsi,%r8
+    25e3:	89 d1                	mov    %edx,%ecx
+    25e5:	48 89 c2             	mov    %rax,%rdx
+    25e8:	48 8d 05 e1 00 00 00 	lea    0xe1(%rip),%rax        # 26d0 <benchreport+0x20a>
+    25ef:	48 89 c6             	mov    %rax,%rsi
+    25f2:	bf 01 00 00 00       	mov    $0x1,%edi
+    25f7:	b8 00 00 00 00       	mov    $0x0,%eax
+    25fc:	e8 f8 e3 ff ff       	call   9f9 <printf>
+    2601:	48 83 c4 10          	add    $0x10,%rsp
+    2605:	eb 01                	jmp    2608 <benchreport+0x142>
+    return;
+    2607:	90                   	nop
+}
+    2608:	c9                   	leave
+    2609:	c3                   	ret
@@ -0,0 +1,3403 @@
+
+out/user/_init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <stat.h>
+#include <user.h>
+
+char *argv[] = {"sh", 0};
+
+int main(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, wpid;
+
+  if (open("console", O_RDWR) < 0) {
+       8:	be 02 00 00 00       	mov    $0x2,%esi
+       d:	48 8d 05 b7 1e 00 00 	lea    0x1eb7(%rip),%rax        # 1ecb <benchreport+0x149>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 a5 13 00 00       	call   13c1 <open>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	79 2d                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+      20:	ba 01 00 00 00       	mov    $0x1,%edx
+      25:	be 01 00 00 00       	mov    $0x1,%esi
+      2a:	48 8d 05 9a 1e 00 00 	lea    0x1e9a(%rip),%rax        # 1ecb <benchreport+0x149>
+      31:	48 89 c7             	mov    %rax,%rdi
+      34:	e8 93 13 00 00       	call   13cc <mknod>
+    open("console", O_RDWR);
+      39:	be 02 00 00 00       	mov    $0x2,%esi
+      3e:	48 8d 05 86 1e 00 00 	lea    0x1e86(%rip),%rax        # 1ecb <benchreport+0x149>
+      45:	48 89 c7             	mov    %rax,%rdi
+      48:	e8 74 13 00 00       	call   13c1 <open>
+  }
+  dup(0); // stdout
+      4d:	bf 00 00 00 00       	mov    $0x0,%edi
+      52:	e8 b7 13 00 00       	call   140e <dup>
+  dup(0); // stderr
+      57:	bf 00 00 00 00       	mov    $0x0,%edi
+      5c:	e8 ad 13 00 00       	call   140e <dup>
+
+  for (;;) {
+    printf(1, "init: starting sh\n");
+      61:	48 8d 05 6b 1e 00 00 	lea    0x1e6b(%rip),%rax        # 1ed3 <benchreport+0x151>
+      68:	48 89 c6             	mov    %rax,%rsi
+      6b:	bf 01 00 00 00       	mov    $0x1,%edi
+      70:	b8 00 00 00 00       	mov    $0x0,%eax
+      75:	e8 3b 02 00 00       	call   2b5 <printf>
+    pid = spawn("sh", argv, 0);
+      7a:	ba 00 00 00 00       	mov    $0x0,%edx
+      7f:	48 8d 05 7a 2f 00 00 	lea    0x2f7a(%rip),%rax        # 3000 <argv>
+      86:	48 89 c6             	mov    %rax,%rsi
+      89:	48 8d 05 38 1e 00 00 	lea    0x1e38(%rip),%rax        # 1ec8 <benchreport+0x146>
+      90:	48 89 c7             	mov    %rax,%rdi
+      93:	e8 85 08 00 00       	call   91d <spawn>
+      98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (pid < 0) {
+      9b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      9f:	79 37                	jns    d8 <main+0xd8>
+      printf(1, "init: spawn sh failed\n");
+      a1:	48 8d 05 3e 1e 00 00 	lea    0x1e3e(%rip),%rax        # 1ee6 <benchreport+0x164>
+      a8:	48 89 c6             	mov    %rax,%rsi
+      ab:	bf 01 00 00 00       	mov    $0x1,%edi
+      b0:	b8 00 00 00 00       	mov    $0x0,%eax
+      b5:	e8 fb 01 00 00       	call   2b5 <printf>
+      exit();
+      ba:	e8 26 08 00 00       	call   8e5 <exit>
+    }
+    while ((wpid = wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+      bf:	48 8d 05 37 1e 00 00 	lea    0x1e37(%rip),%rax        # 1efd <benchreport+0x17b>
+      c6:	48 89 c6             	mov    %rax,%rsi
+      c9:	bf 01 00 00 00       	mov    $0x1,%edi
+      ce:	b8 00 00 00 00       	mov    $0x0,%eax
+      d3:	e8 dd 01 00 00       	call   2b5 <printf>
+    while ((wpid = wait()) >= 0 && wpid != pid)
+      d8:	e8 97 12 00 00       	call   1374 <wait>
+      dd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      e0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      e4:	0f 88 77 ff ff ff    	js     61 <main+0x61>
+      ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ed:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+      f0:	75 cd                	jne    bf <main+0xbf>
+    printf(1, "init: starting sh\n");
+      f2:	e9 6a ff ff ff       	jmp    61 <main+0x61>
+
+00000000000000f7 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      f7:	55                   	push   %rbp
+      f8:	48 89 e5             	mov    %rsp,%rbp
+      fb:	48 83 ec 10          	sub    $0x10,%rsp
+      ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     102:	89 f0                	mov    %esi,%eax
+     104:	88 45 f8             	mov    %al,-0x8(%rbp)
+     107:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     10b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     10e:	89 d6                	mov    %edx,%esi
+     110:	89 c7                	mov    %eax,%edi
+     112:	e8 eb 06 00 00       	call   802 <bputc>
+     117:	90                   	nop
+     118:	c9                   	leave
+     119:	c3                   	ret
+
+000000000000011a <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     11a:	55                   	push   %rbp
+     11b:	48 89 e5             	mov    %rsp,%rbp
+     11e:	48 83 ec 50          	sub    $0x50,%rsp
+     122:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     125:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     129:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     12c:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     12f:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     133:	74 21                	je     156 <printint64+0x3c>
+     135:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     139:	48 c1 e8 3f          	shr    $0x3f,%rax
+     13d:	0f b6 c0             	movzbl %al,%eax
+     140:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     143:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     147:	74 0d                	je     156 <printint64+0x3c>
+    x = -xx;
+     149:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     14d:	48 f7 d8             	neg    %rax
+     150:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     154:	eb 08                	jmp    15e <printint64+0x44>
+  else
+    x = xx;
+     156:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     15a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     15e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     165:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     168:	48 63 c8             	movslq %eax,%rcx
+     16b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     16f:	ba 00 00 00 00       	mov    $0x0,%edx
+     174:	48 f7 f1             	div    %rcx
+     177:	48 89 d1             	mov    %rdx,%rcx
+     17a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     17d:	8d 50 01             	lea    0x1(%rax),%edx
+     180:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     183:	48 8d 15 86 2e 00 00 	lea    0x2e86(%rip),%rdx        # 3010 <digits.1>
+     18a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     18e:	48 98                	cltq
+     190:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     194:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     197:	48 63 f0             	movslq %eax,%rsi
+     19a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     19e:	ba 00 00 00 00       	mov    $0x0,%edx
+     1a3:	48 f7 f6             	div    %rsi
+     1a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     1aa:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     1af:	75 b4                	jne    165 <printint64+0x4b>
+
+  if (sgn)
+     1b1:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     1b5:	74 2b                	je     1e2 <printint64+0xc8>
+    buf[i++] = '-';
+     1b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1ba:	8d 50 01             	lea    0x1(%rax),%edx
+     1bd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1c0:	48 98                	cltq
+     1c2:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     1c7:	eb 19                	jmp    1e2 <printint64+0xc8>
+    putc(fd, buf[i]);
+     1c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1cc:	48 98                	cltq
+     1ce:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     1d3:	0f be d0             	movsbl %al,%edx
+     1d6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     1d9:	89 d6                	mov    %edx,%esi
+     1db:	89 c7                	mov    %eax,%edi
+     1dd:	e8 15 ff ff ff       	call   f7 <putc>
+  while (--i >= 0)
+     1e2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     1e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1ea:	79 dd                	jns    1c9 <printint64+0xaf>
+}
+     1ec:	90                   	nop
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+00000000000001f0 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     1f0:	55                   	push   %rbp
+     1f1:	48 89 e5             	mov    %rsp,%rbp
+     1f4:	48 83 ec 30          	sub    $0x30,%rsp
+     1f8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     1fb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     1fe:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     201:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     204:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     20b:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     20f:	74 17                	je     228 <printint+0x38>
+     211:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     215:	79 11                	jns    228 <printint+0x38>
+    neg = 1;
+     217:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     21e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     221:	f7 d8                	neg    %eax
+     223:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     226:	eb 06                	jmp    22e <printint+0x3e>
+  } else {
+    x = xx;
+     228:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     22b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     22e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     235:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     238:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     23b:	ba 00 00 00 00       	mov    $0x0,%edx
+     240:	f7 f1                	div    %ecx
+     242:	89 d1                	mov    %edx,%ecx
+     244:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     247:	8d 50 01             	lea    0x1(%rax),%edx
+     24a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     24d:	89 c9                	mov    %ecx,%ecx
+     24f:	48 8d 15 da 2d 00 00 	lea    0x2dda(%rip),%rdx        # 3030 <digits.0>
+     256:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     25a:	48 98                	cltq
+     25c:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     260:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     263:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     266:	ba 00 00 00 00       	mov    $0x0,%edx
+     26b:	f7 f6                	div    %esi
+     26d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     270:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     274:	75 bf                	jne    235 <printint+0x45>
+  if (neg)
+     276:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     27a:	74 2b                	je     2a7 <printint+0xb7>
+    buf[i++] = '-';
+     27c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     27f:	8d 50 01             	lea    0x1(%rax),%edx
+     282:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     285:	48 98                	cltq
+     287:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     28c:	eb 19                	jmp    2a7 <printint+0xb7>
+    putc(fd, buf[i]);
+     28e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     291:	48 98                	cltq
+     293:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     298:	0f be d0             	movsbl %al,%edx
+     29b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     29e:	89 d6                	mov    %edx,%esi
+     2a0:	89 c7                	mov    %eax,%edi
+     2a2:	e8 50 fe ff ff       	call   f7 <putc>
+  while (--i >= 0)
+     2a7:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     2ab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2af:	79 dd                	jns    28e <printint+0x9e>
+}
+     2b1:	90                   	nop
+     2b2:	90                   	nop
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+
+00000000000002b5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     2b5:	55                   	push   %rbp
+     2b6:	48 89 e5             	mov    %rsp,%rbp
+     2b9:	48 83 ec 70          	sub    $0x70,%rsp
+     2bd:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     2c0:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     2c4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     2c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     2cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     2d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     2d4:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     2db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     2df:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     2e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     2e7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     2eb:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     2f2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     2f9:	e9 67 02 00 00       	jmp    565 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     2fe:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     301:	48 63 d0             	movslq %eax,%rdx
+     304:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     308:	48 01 d0             	add    %rdx,%rax
+     30b:	0f b6 00             	movzbl (%rax),%eax
+     30e:	0f be c0             	movsbl %al,%eax
+     311:	25 ff 00 00 00       	and    $0xff,%eax
+     316:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     319:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     31d:	75 30                	jne    34f <printf+0x9a>
+      if (c == '%') {
+     31f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     323:	75 13                	jne    338 <printf+0x83>
+        state = '%';
+     325:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     32c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     333:	e9 29 02 00 00       	jmp    561 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     338:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     33b:	0f be d0             	movsbl %al,%edx
+     33e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     341:	89 d6                	mov    %edx,%esi
+     343:	89 c7                	mov    %eax,%edi
+     345:	e8 ad fd ff ff       	call   f7 <putc>
+     34a:	e9 12 02 00 00       	jmp    561 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     34f:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     353:	0f 85 08 02 00 00    	jne    561 <printf+0x2ac>
+      if (c == 'l') {
+     359:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     35d:	75 0c                	jne    36b <printf+0xb6>
+        lflag = 1;
+     35f:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     366:	e9 f6 01 00 00       	jmp    561 <printf+0x2ac>
+      } else if (c == 'd') {
+     36b:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     36f:	0f 85 93 00 00 00    	jne    408 <printf+0x153>
+        if (lflag == 1)
+     375:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     379:	75 47                	jne    3c2 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     37b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     37e:	83 f8 2f             	cmp    $0x2f,%eax
+     381:	77 17                	ja     39a <printf+0xe5>
+     383:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     387:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     38a:	89 d2                	mov    %edx,%edx
+     38c:	48 01 d0             	add    %rdx,%rax
+     38f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     392:	83 c2 08             	add    $0x8,%edx
+     395:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     398:	eb 0c                	jmp    3a6 <printf+0xf1>
+     39a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     39e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3a2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3a6:	48 8b 30             	mov    (%rax),%rsi
+     3a9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+     3b1:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3b6:	89 c7                	mov    %eax,%edi
+     3b8:	e8 5d fd ff ff       	call   11a <printint64>
+     3bd:	e9 98 01 00 00       	jmp    55a <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     3c2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3c5:	83 f8 2f             	cmp    $0x2f,%eax
+     3c8:	77 17                	ja     3e1 <printf+0x12c>
+     3ca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3ce:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3d1:	89 d2                	mov    %edx,%edx
+     3d3:	48 01 d0             	add    %rdx,%rax
+     3d6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3d9:	83 c2 08             	add    $0x8,%edx
+     3dc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3df:	eb 0c                	jmp    3ed <printf+0x138>
+     3e1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3e5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3e9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3ed:	8b 30                	mov    (%rax),%esi
+     3ef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+     3f7:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3fc:	89 c7                	mov    %eax,%edi
+     3fe:	e8 ed fd ff ff       	call   1f0 <printint>
+     403:	e9 52 01 00 00       	jmp    55a <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     408:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     40c:	74 0a                	je     418 <printf+0x163>
+     40e:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     412:	0f 85 93 00 00 00    	jne    4ab <printf+0x1f6>
+        if (lflag == 1)
+     418:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     41c:	75 47                	jne    465 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     41e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     421:	83 f8 2f             	cmp    $0x2f,%eax
+     424:	77 17                	ja     43d <printf+0x188>
+     426:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     42a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     42d:	89 d2                	mov    %edx,%edx
+     42f:	48 01 d0             	add    %rdx,%rax
+     432:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     435:	83 c2 08             	add    $0x8,%edx
+     438:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     43b:	eb 0c                	jmp    449 <printf+0x194>
+     43d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     441:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     445:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     449:	48 8b 30             	mov    (%rax),%rsi
+     44c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     44f:	b9 00 00 00 00       	mov    $0x0,%ecx
+     454:	ba 10 00 00 00       	mov    $0x10,%edx
+     459:	89 c7                	mov    %eax,%edi
+     45b:	e8 ba fc ff ff       	call   11a <printint64>
+        if (lflag == 1)
+     460:	e9 f5 00 00 00       	jmp    55a <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     465:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     468:	83 f8 2f             	cmp    $0x2f,%eax
+     46b:	77 17                	ja     484 <printf+0x1cf>
+     46d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     471:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     474:	89 d2                	mov    %edx,%edx
+     476:	48 01 d0             	add    %rdx,%rax
+     479:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     47c:	83 c2 08             	add    $0x8,%edx
+     47f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     482:	eb 0c                	jmp    490 <printf+0x1db>
+     484:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     488:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     48c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     490:	8b 30                	mov    (%rax),%esi
+     492:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     495:	b9 00 00 00 00       	mov    $0x0,%ecx
+     49a:	ba 10 00 00 00       	mov    $0x10,%edx
+     49f:	89 c7                	mov    %eax,%edi
+     4a1:	e8 4a fd ff ff       	call   1f0 <printint>
+        if (lflag == 1)
+     4a6:	e9 af 00 00 00       	jmp    55a <printf+0x2a5>
+      } else if (c == 's') {
+     4ab:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     4af:	75 6e                	jne    51f <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     4b1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4b4:	83 f8 2f             	cmp    $0x2f,%eax
+     4b7:	77 17                	ja     4d0 <printf+0x21b>
+     4b9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4bd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4c0:	89 d2                	mov    %edx,%edx
+     4c2:	48 01 d0             	add    %rdx,%rax
+     4c5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4c8:	83 c2 08             	add    $0x8,%edx
+     4cb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4ce:	eb 0c                	jmp    4dc <printf+0x227>
+     4d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4d4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4d8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4dc:	48 8b 00             	mov    (%rax),%rax
+     4df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     4e3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     4e8:	75 28                	jne    512 <printf+0x25d>
+          s = "(null)";
+     4ea:	48 8d 05 15 1a 00 00 	lea    0x1a15(%rip),%rax        # 1f06 <benchreport+0x184>
+     4f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     4f5:	eb 1b                	jmp    512 <printf+0x25d>
+          putc(fd, *s);
+     4f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     4fb:	0f b6 00             	movzbl (%rax),%eax
+     4fe:	0f be d0             	movsbl %al,%edx
+     501:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     504:	89 d6                	mov    %edx,%esi
+     506:	89 c7                	mov    %eax,%edi
+     508:	e8 ea fb ff ff       	call   f7 <putc>
+        for (; *s; s++)
+     50d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     512:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     516:	0f b6 00             	movzbl (%rax),%eax
+     519:	84 c0                	test   %al,%al
+     51b:	75 da                	jne    4f7 <printf+0x242>
+     51d:	eb 3b                	jmp    55a <printf+0x2a5>
+      } else if (c == '%') {
+     51f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     523:	75 14                	jne    539 <printf+0x284>
+        putc(fd, c);
+     525:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     528:	0f be d0             	movsbl %al,%edx
+     52b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     52e:	89 d6                	mov    %edx,%esi
+     530:	89 c7                	mov    %eax,%edi
+     532:	e8 c0 fb ff ff       	call   f7 <putc>
+     537:	eb 21                	jmp    55a <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     539:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     53c:	be 25 00 00 00       	mov    $0x25,%esi
+     541:	89 c7                	mov    %eax,%edi
+     543:	e8 af fb ff ff       	call   f7 <putc>
+        putc(fd, c);
+     548:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     54b:	0f be d0             	movsbl %al,%edx
+     54e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     551:	89 d6                	mov    %edx,%esi
+     553:	89 c7                	mov    %eax,%edi
+     555:	e8 9d fb ff ff       	call   f7 <putc>
+      }
+      state = 0;
+     55a:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     561:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     565:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     568:	48 63 d0             	movslq %eax,%rdx
+     56b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     56f:	48 01 d0             	add    %rdx,%rax
+     572:	0f b6 00             	movzbl (%rax),%eax
+     575:	84 c0                	test   %al,%al
+     577:	0f 85 81 fd ff ff    	jne    2fe <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     57d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     580:	89 c7                	mov    %eax,%edi
+     582:	e8 ee 02 00 00       	call   875 <bflushtty>
+}
+     587:	90                   	nop
+     588:	c9                   	leave
+     589:	c3                   	ret
+
+000000000000058a <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     58a:	55                   	push   %rbp
+     58b:	48 89 e5             	mov    %rsp,%rbp
+     58e:	48 83 ec 30          	sub    $0x30,%rsp
+     592:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     595:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     599:	78 06                	js     5a1 <getbuf+0x17>
+     59b:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     59f:	7e 0a                	jle    5ab <getbuf+0x21>
+    return 0;
+     5a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a6:	e9 94 00 00 00       	jmp    63f <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     5ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5ae:	48 98                	cltq
+     5b0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     5b7:	00 
+     5b8:	48 8d 05 a1 2a 00 00 	lea    0x2aa1(%rip),%rax        # 3060 <obufs>
+     5bf:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     5c3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     5c7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     5cc:	75 6d                	jne    63b <getbuf+0xb1>
+     5ce:	bf 08 02 00 00       	mov    $0x208,%edi
+     5d3:	e8 bd 13 00 00       	call   1995 <malloc>
+     5d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     5dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     5e1:	74 58                	je     63b <getbuf+0xb1>
+    b->n = 0;
+     5e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5e7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     5ed:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     5f1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5f4:	48 89 d6             	mov    %rdx,%rsi
+     5f7:	89 c7                	mov    %eax,%edi
+     5f9:	e8 e4 0d 00 00       	call   13e2 <fstat>
+     5fe:	85 c0                	test   %eax,%eax
+     600:	75 11                	jne    613 <getbuf+0x89>
+     602:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     606:	66 83 f8 03          	cmp    $0x3,%ax
+     60a:	75 07                	jne    613 <getbuf+0x89>
+     60c:	ba 01 00 00 00       	mov    $0x1,%edx
+     611:	eb 05                	jmp    618 <getbuf+0x8e>
+     613:	ba 00 00 00 00       	mov    $0x0,%edx
+     618:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     61c:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     61f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     622:	48 98                	cltq
+     624:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     62b:	00 
+     62c:	48 8d 15 2d 2a 00 00 	lea    0x2a2d(%rip),%rdx        # 3060 <obufs>
+     633:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     637:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     63b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     63f:	c9                   	leave
+     640:	c3                   	ret
+
+0000000000000641 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     641:	55                   	push   %rbp
+     642:	48 89 e5             	mov    %rsp,%rbp
+     645:	48 83 ec 20          	sub    $0x20,%rsp
+     649:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     64c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     650:	78 33                	js     685 <bflush+0x44>
+     652:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     656:	7f 2d                	jg     685 <bflush+0x44>
+     658:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     65b:	48 98                	cltq
+     65d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     664:	00 
+     665:	48 8d 05 f4 29 00 00 	lea    0x29f4(%rip),%rax        # 3060 <obufs>
+     66c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     670:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     674:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     679:	74 0a                	je     685 <bflush+0x44>
+     67b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     67f:	8b 00                	mov    (%rax),%eax
+     681:	85 c0                	test   %eax,%eax
+     683:	75 07                	jne    68c <bflush+0x4b>
+    return 0;
+     685:	b8 00 00 00 00       	mov    $0x0,%eax
+     68a:	eb 3c                	jmp    6c8 <bflush+0x87>
+  n = b->n;
+     68c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     690:	8b 00                	mov    (%rax),%eax
+     692:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     699:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     69f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6a3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     6a7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     6aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6ad:	48 89 ce             	mov    %rcx,%rsi
+     6b0:	89 c7                	mov    %eax,%edi
+     6b2:	e8 de 0c 00 00       	call   1395 <write>
+     6b7:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     6ba:	75 07                	jne    6c3 <bflush+0x82>
+     6bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c1:	eb 05                	jmp    6c8 <bflush+0x87>
+     6c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     6c8:	c9                   	leave
+     6c9:	c3                   	ret
+
+00000000000006ca <bflushall>:
+
+void bflushall(void) {
+     6ca:	55                   	push   %rbp
+     6cb:	48 89 e5             	mov    %rsp,%rbp
+     6ce:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     6d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6d9:	eb 0e                	jmp    6e9 <bflushall+0x1f>
+    bflush(fd);
+     6db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6de:	89 c7                	mov    %eax,%edi
+     6e0:	e8 5c ff ff ff       	call   641 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     6e5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     6e9:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     6ed:	7e ec                	jle    6db <bflushall+0x11>
+}
+     6ef:	90                   	nop
+     6f0:	90                   	nop
+     6f1:	c9                   	leave
+     6f2:	c3                   	ret
+
+00000000000006f3 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     6f3:	55                   	push   %rbp
+     6f4:	48 89 e5             	mov    %rsp,%rbp
+     6f7:	48 83 ec 30          	sub    $0x30,%rsp
+     6fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     6fe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     702:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     705:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     708:	89 c7                	mov    %eax,%edi
+     70a:	e8 7b fe ff ff       	call   58a <getbuf>
+     70f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     713:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     718:	75 19                	jne    733 <bwrite+0x40>
+    return write(fd, s, n);
+     71a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     71d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     721:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     724:	48 89 ce             	mov    %rcx,%rsi
+     727:	89 c7                	mov    %eax,%edi
+     729:	e8 67 0c 00 00       	call   1395 <write>
+     72e:	e9 cd 00 00 00       	jmp    800 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     733:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     73a:	e9 92 00 00 00       	jmp    7d1 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     73f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     743:	8b 00                	mov    (%rax),%eax
+     745:	3d 00 02 00 00       	cmp    $0x200,%eax
+     74a:	75 18                	jne    764 <bwrite+0x71>
+     74c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     74f:	89 c7                	mov    %eax,%edi
+     751:	e8 eb fe ff ff       	call   641 <bflush>
+     756:	85 c0                	test   %eax,%eax
+     758:	79 0a                	jns    764 <bwrite+0x71>
+      return -1;
+     75a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     75f:	e9 9c 00 00 00       	jmp    800 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     764:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     767:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     76a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     76d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     771:	8b 00                	mov    (%rax),%eax
+     773:	ba 00 02 00 00       	mov    $0x200,%edx
+     778:	29 c2                	sub    %eax,%edx
+     77a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     77d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     780:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     783:	39 c2                	cmp    %eax,%edx
+     785:	0f 4e c2             	cmovle %edx,%eax
+     788:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     78b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     78e:	48 63 d0             	movslq %eax,%rdx
+     791:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     795:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     799:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     79d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     7a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7a5:	8b 00                	mov    (%rax),%eax
+     7a7:	48 98                	cltq
+     7a9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     7ad:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     7b0:	89 c2                	mov    %eax,%edx
+     7b2:	48 89 cf             	mov    %rcx,%rdi
+     7b5:	e8 e9 06 00 00       	call   ea3 <memmove>
+    b->n += m;
+     7ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7be:	8b 10                	mov    (%rax),%edx
+     7c0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     7c3:	01 c2                	add    %eax,%edx
+     7c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7c9:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     7cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     7ce:	01 45 fc             	add    %eax,-0x4(%rbp)
+     7d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7d4:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     7d7:	0f 8c 62 ff ff ff    	jl     73f <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     7dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7e1:	8b 40 04             	mov    0x4(%rax),%eax
+     7e4:	85 c0                	test   %eax,%eax
+     7e6:	74 15                	je     7fd <bwrite+0x10a>
+     7e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7eb:	89 c7                	mov    %eax,%edi
+     7ed:	e8 4f fe ff ff       	call   641 <bflush>
+     7f2:	85 c0                	test   %eax,%eax
+     7f4:	79 07                	jns    7fd <bwrite+0x10a>
+    return -1;
+     7f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7fb:	eb 03                	jmp    800 <bwrite+0x10d>
+  return n;
+     7fd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     800:	c9                   	leave
+     801:	c3                   	ret
+
+0000000000000802 <bputc>:
+
+void bputc(int fd, char c) {
+     802:	55                   	push   %rbp
+     803:	48 89 e5             	mov    %rsp,%rbp
+     806:	48 83 ec 20          	sub    $0x20,%rsp
+     80a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     80d:	89 f0                	mov    %esi,%eax
+     80f:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     812:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     815:	89 c7                	mov    %eax,%edi
+     817:	e8 6e fd ff ff       	call   58a <getbuf>
+     81c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     820:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     825:	75 18                	jne    83f <bputc+0x3d>
+    write(fd, &c, 1);
+     827:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     82b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     82e:	ba 01 00 00 00       	mov    $0x1,%edx
+     833:	48 89 ce             	mov    %rcx,%rsi
+     836:	89 c7                	mov    %eax,%edi
+     838:	e8 58 0b 00 00       	call   1395 <write>
+    return;
+     83d:	eb 34                	jmp    873 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     83f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     843:	8b 00                	mov    (%rax),%eax
+     845:	3d 00 02 00 00       	cmp    $0x200,%eax
+     84a:	75 0a                	jne    856 <bputc+0x54>
+    bflush(fd);
+     84c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     84f:	89 c7                	mov    %eax,%edi
+     851:	e8 eb fd ff ff       	call   641 <bflush>
+  b->data[b->n++] = c;
+     856:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     85a:	8b 00                	mov    (%rax),%eax
+     85c:	8d 48 01             	lea    0x1(%rax),%ecx
+     85f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     863:	89 0a                	mov    %ecx,(%rdx)
+     865:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     869:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     86d:	48 98                	cltq
+     86f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     873:	c9                   	leave
+     874:	c3                   	ret
+
+0000000000000875 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     875:	55                   	push   %rbp
+     876:	48 89 e5             	mov    %rsp,%rbp
+     879:	48 83 ec 10          	sub    $0x10,%rsp
+     87d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     880:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     884:	78 4c                	js     8d2 <bflushtty+0x5d>
+     886:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     88a:	7f 46                	jg     8d2 <bflushtty+0x5d>
+     88c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     88f:	48 98                	cltq
+     891:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     898:	00 
+     899:	48 8d 05 c0 27 00 00 	lea    0x27c0(%rip),%rax        # 3060 <obufs>
+     8a0:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8a4:	48 85 c0             	test   %rax,%rax
+     8a7:	74 29                	je     8d2 <bflushtty+0x5d>
+     8a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8ac:	48 98                	cltq
+     8ae:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8b5:	00 
+     8b6:	48 8d 05 a3 27 00 00 	lea    0x27a3(%rip),%rax        # 3060 <obufs>
+     8bd:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8c1:	8b 40 04             	mov    0x4(%rax),%eax
+     8c4:	85 c0                	test   %eax,%eax
+     8c6:	74 0a                	je     8d2 <bflushtty+0x5d>
+    bflush(fd);
+     8c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8cb:	89 c7                	mov    %eax,%edi
+     8cd:	e8 6f fd ff ff       	call   641 <bflush>
+}
+     8d2:	90                   	nop
+     8d3:	c9                   	leave
+     8d4:	c3                   	ret
+
+00000000000008d5 <fork>:
+
+int fork(void) {
+     8d5:	55                   	push   %rbp
+     8d6:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     8d9:	e8 ec fd ff ff       	call   6ca <bflushall>
+  return _fork();
+     8de:	e8 7b 0a 00 00       	call   135e <_fork>
+}
+     8e3:	5d                   	pop    %rbp
+     8e4:	c3                   	ret
+
+00000000000008e5 <exit>:
+
+noreturn void exit(void) {
+     8e5:	55                   	push   %rbp
+     8e6:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     8e9:	e8 dc fd ff ff       	call   6ca <bflushall>
+  _exit();
+     8ee:	e8 76 0a 00 00       	call   1369 <_exit>
+
+00000000000008f3 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     8f3:	55                   	push   %rbp
+     8f4:	48 89 e5             	mov    %rsp,%rbp
+     8f7:	48 83 ec 10          	sub    $0x10,%rsp
+     8fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     903:	e8 c2 fd ff ff       	call   6ca <bflushall>
+  return _exec(path, argv);
+     908:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     90c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     910:	48 89 d6             	mov    %rdx,%rsi
+     913:	48 89 c7             	mov    %rax,%rdi
+     916:	e8 9b 0a 00 00       	call   13b6 <_exec>
+}
+     91b:	c9                   	leave
+     91c:	c3                   	ret
+
+000000000000091d <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     91d:	55                   	push   %rbp
+     91e:	48 89 e5             	mov    %rsp,%rbp
+     921:	48 83 ec 20          	sub    $0x20,%rsp
+     925:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     929:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     92d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     931:	e8 94 fd ff ff       	call   6ca <bflushall>
+  return _spawn(path, argv, fds);
+     936:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     93a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     93e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     942:	48 89 ce             	mov    %rcx,%rsi
+     945:	48 89 c7             	mov    %rax,%rdi
+     948:	e8 2f 0b 00 00       	call   147c <_spawn>
+}
+     94d:	c9                   	leave
+     94e:	c3                   	ret
+
+000000000000094f <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     94f:	55                   	push   %rbp
+     950:	48 89 e5             	mov    %rsp,%rbp
+     953:	48 83 ec 10          	sub    $0x10,%rsp
+     957:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     95a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     95e:	78 69                	js     9c9 <close+0x7a>
+     960:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     964:	7f 63                	jg     9c9 <close+0x7a>
+     966:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     969:	48 98                	cltq
+     96b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     972:	00 
+     973:	48 8d 05 e6 26 00 00 	lea    0x26e6(%rip),%rax        # 3060 <obufs>
+     97a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     97e:	48 85 c0             	test   %rax,%rax
+     981:	74 46                	je     9c9 <close+0x7a>
+    bflush(fd);
+     983:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     986:	89 c7                	mov    %eax,%edi
+     988:	e8 b4 fc ff ff       	call   641 <bflush>
+    free(obufs[fd]);
+     98d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     990:	48 98                	cltq
+     992:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     999:	00 
+     99a:	48 8d 05 bf 26 00 00 	lea    0x26bf(%rip),%rax        # 3060 <obufs>
+     9a1:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9a5:	48 89 c7             	mov    %rax,%rdi
+     9a8:	e8 90 11 00 00       	call   1b3d <free>
+    obufs[fd] = 0;
+     9ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9b0:	48 98                	cltq
+     9b2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     9b9:	00 
+     9ba:	48 8d 05 9f 26 00 00 	lea    0x269f(%rip),%rax        # 3060 <obufs>
+     9c1:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     9c8:	00 
+  }
+  return _close(fd);
+     9c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9cc:	89 c7                	mov    %eax,%edi
+     9ce:	e8 cd 09 00 00       	call   13a0 <_close>
+}
+     9d3:	c9                   	leave
+     9d4:	c3                   	ret
+
+00000000000009d5 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     9d5:	55                   	push   %rbp
+     9d6:	48 89 e5             	mov    %rsp,%rbp
+     9d9:	53                   	push   %rbx
+     9da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     9de:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     9e2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     9e6:	48 8b 36             	mov    (%rsi),%rsi
+     9e9:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     9ed:	48 29 f7             	sub    %rsi,%rdi
+     9f0:	48 89 f9             	mov    %rdi,%rcx
+     9f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+     9f8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     9fc:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     a00:	48 89 f0             	mov    %rsi,%rax
+     a03:	ba 00 00 00 00       	mov    $0x0,%edx
+     a08:	48 89 df             	mov    %rbx,%rdi
+     a0b:	48 0f af f8          	imul   %rax,%rdi
+     a0f:	48 89 d6             	mov    %rdx,%rsi
+     a12:	48 0f af f1          	imul   %rcx,%rsi
+     a16:	48 01 fe             	add    %rdi,%rsi
+     a19:	48 f7 e1             	mul    %rcx
+     a1c:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     a20:	48 89 ca             	mov    %rcx,%rdx
+     a23:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     a28:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     a2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     a30:	c9                   	leave
+     a31:	c3                   	ret
+
+0000000000000a32 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     a32:	55                   	push   %rbp
+     a33:	48 89 e5             	mov    %rsp,%rbp
+     a36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a3a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     a3d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     a40:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a44:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     a47:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a4a:	48 89 ce             	mov    %rcx,%rsi
+     a4d:	48 89 f7             	mov    %rsi,%rdi
+     a50:	89 d1                	mov    %edx,%ecx
+     a52:	fc                   	cld
+     a53:	f3 aa                	rep stos %al,%es:(%rdi)
+     a55:	89 ca                	mov    %ecx,%edx
+     a57:	48 89 fe             	mov    %rdi,%rsi
+     a5a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a5e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a61:	90                   	nop
+     a62:	5d                   	pop    %rbp
+     a63:	c3                   	ret
+
+0000000000000a64 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     a64:	55                   	push   %rbp
+     a65:	48 89 e5             	mov    %rsp,%rbp
+     a68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a70:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     a74:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a78:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a80:	48 89 ce             	mov    %rcx,%rsi
+     a83:	48 89 f7             	mov    %rsi,%rdi
+     a86:	48 89 d1             	mov    %rdx,%rcx
+     a89:	fc                   	cld
+     a8a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     a8d:	48 89 ca             	mov    %rcx,%rdx
+     a90:	48 89 fe             	mov    %rdi,%rsi
+     a93:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a97:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a9b:	90                   	nop
+     a9c:	5d                   	pop    %rbp
+     a9d:	c3                   	ret
+
+0000000000000a9e <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     a9e:	55                   	push   %rbp
+     a9f:	48 89 e5             	mov    %rsp,%rbp
+     aa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     aa6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     aaa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     aae:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ab2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ab6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     aba:	48 89 cf             	mov    %rcx,%rdi
+     abd:	48 89 d6             	mov    %rdx,%rsi
+     ac0:	48 89 c1             	mov    %rax,%rcx
+     ac3:	fc                   	cld
+     ac4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     ac6:	48 89 c8             	mov    %rcx,%rax
+     ac9:	48 89 f2             	mov    %rsi,%rdx
+     acc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ad0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     ad4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     ad8:	90                   	nop
+     ad9:	5d                   	pop    %rbp
+     ada:	c3                   	ret
+
+0000000000000adb <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     adb:	55                   	push   %rbp
+     adc:	48 89 e5             	mov    %rsp,%rbp
+     adf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ae3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     ae7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     aeb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     aef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     af3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     af7:	48 89 cf             	mov    %rcx,%rdi
+     afa:	48 89 d6             	mov    %rdx,%rsi
+     afd:	48 89 c1             	mov    %rax,%rcx
+     b00:	fc                   	cld
+     b01:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     b04:	48 89 c8             	mov    %rcx,%rax
+     b07:	48 89 f2             	mov    %rsi,%rdx
+     b0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b0e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     b12:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     b16:	90                   	nop
+     b17:	5d                   	pop    %rbp
+     b18:	c3                   	ret
+
+0000000000000b19 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     b19:	55                   	push   %rbp
+     b1a:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     b1d:	0f 31                	rdtsc
+     b1f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     b22:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     b25:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b28:	48 c1 e0 20          	shl    $0x20,%rax
+     b2c:	48 89 c2             	mov    %rax,%rdx
+     b2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b32:	48 09 d0             	or     %rdx,%rax
+}
+     b35:	5d                   	pop    %rbp
+     b36:	c3                   	ret
+
+0000000000000b37 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     b37:	55                   	push   %rbp
+     b38:	48 89 e5             	mov    %rsp,%rbp
+     b3b:	53                   	push   %rbx
+     b3c:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     b3f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     b43:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     b47:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     b4b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     b4f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b52:	0f a2                	cpuid
+     b54:	89 de                	mov    %ebx,%esi
+     b56:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     b59:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     b5c:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     b5f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     b62:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     b67:	74 09                	je     b72 <cpuid+0x3b>
+    *eaxp = eax;
+     b69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     b6d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b70:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     b72:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     b77:	74 09                	je     b82 <cpuid+0x4b>
+    *ebxp = ebx;
+     b79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     b7d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b80:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     b82:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b87:	74 09                	je     b92 <cpuid+0x5b>
+    *ecxp = ecx;
+     b89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b8d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b90:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     b92:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     b97:	74 09                	je     ba2 <cpuid+0x6b>
+    *edxp = edx;
+     b99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     b9d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     ba0:	89 10                	mov    %edx,(%rax)
+}
+     ba2:	90                   	nop
+     ba3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     ba7:	c9                   	leave
+     ba8:	c3                   	ret
+
+0000000000000ba9 <strcpy>:
+char *strcpy(char *s, char *t) {
+     ba9:	55                   	push   %rbp
+     baa:	48 89 e5             	mov    %rsp,%rbp
+     bad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     bb1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     bb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     bbd:	90                   	nop
+     bbe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     bc2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     bc6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     bca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bce:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     bd2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     bd6:	0f b6 12             	movzbl (%rdx),%edx
+     bd9:	88 10                	mov    %dl,(%rax)
+     bdb:	0f b6 00             	movzbl (%rax),%eax
+     bde:	84 c0                	test   %al,%al
+     be0:	75 dc                	jne    bbe <strcpy+0x15>
+  return os;
+     be2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     be6:	5d                   	pop    %rbp
+     be7:	c3                   	ret
+
+0000000000000be8 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     be8:	55                   	push   %rbp
+     be9:	48 89 e5             	mov    %rsp,%rbp
+     bec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bf0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     bf4:	eb 0a                	jmp    c00 <strcmp+0x18>
+    p++, q++;
+     bf6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     bfb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     c00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c04:	0f b6 00             	movzbl (%rax),%eax
+     c07:	84 c0                	test   %al,%al
+     c09:	74 12                	je     c1d <strcmp+0x35>
+     c0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c0f:	0f b6 10             	movzbl (%rax),%edx
+     c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c16:	0f b6 00             	movzbl (%rax),%eax
+     c19:	38 c2                	cmp    %al,%dl
+     c1b:	74 d9                	je     bf6 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     c1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c21:	0f b6 00             	movzbl (%rax),%eax
+     c24:	0f b6 d0             	movzbl %al,%edx
+     c27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c2b:	0f b6 00             	movzbl (%rax),%eax
+     c2e:	0f b6 c0             	movzbl %al,%eax
+     c31:	29 c2                	sub    %eax,%edx
+     c33:	89 d0                	mov    %edx,%eax
+}
+     c35:	5d                   	pop    %rbp
+     c36:	c3                   	ret
+
+0000000000000c37 <strlen>:
+uint strlen(char *s) {
+     c37:	55                   	push   %rbp
+     c38:	48 89 e5             	mov    %rsp,%rbp
+     c3b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     c3f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c46:	eb 04                	jmp    c4c <strlen+0x15>
+     c48:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c4f:	48 63 d0             	movslq %eax,%rdx
+     c52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c56:	48 01 d0             	add    %rdx,%rax
+     c59:	0f b6 00             	movzbl (%rax),%eax
+     c5c:	84 c0                	test   %al,%al
+     c5e:	75 e8                	jne    c48 <strlen+0x11>
+    ;
+  return n;
+     c60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c63:	5d                   	pop    %rbp
+     c64:	c3                   	ret
+
+0000000000000c65 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     c65:	55                   	push   %rbp
+     c66:	48 89 e5             	mov    %rsp,%rbp
+     c69:	53                   	push   %rbx
+     c6a:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     c6e:	8b 05 d0 23 00 00    	mov    0x23d0(%rip),%eax        # 3044 <erms>
+     c74:	85 c0                	test   %eax,%eax
+     c76:	79 53                	jns    ccb <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     c78:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     c7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     c82:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c87:	ba 00 00 00 00       	mov    $0x0,%edx
+     c8c:	48 89 c6             	mov    %rax,%rsi
+     c8f:	bf 00 00 00 00       	mov    $0x0,%edi
+     c94:	e8 9e fe ff ff       	call   b37 <cpuid>
+    ebx = 0;
+     c99:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     ca0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     ca3:	83 f8 06             	cmp    $0x6,%eax
+     ca6:	76 14                	jbe    cbc <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     ca8:	b8 07 00 00 00       	mov    $0x7,%eax
+     cad:	b9 00 00 00 00       	mov    $0x0,%ecx
+     cb2:	0f a2                	cpuid
+     cb4:	89 d9                	mov    %ebx,%ecx
+     cb6:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     cb9:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     cbc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cbf:	c1 e8 09             	shr    $0x9,%eax
+     cc2:	83 e0 01             	and    $0x1,%eax
+     cc5:	89 05 79 23 00 00    	mov    %eax,0x2379(%rip)        # 3044 <erms>
+  }
+  return erms;
+     ccb:	8b 05 73 23 00 00    	mov    0x2373(%rip),%eax        # 3044 <erms>
+}
+     cd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     cd5:	c9                   	leave
+     cd6:	c3                   	ret
+
+0000000000000cd7 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     cd7:	55                   	push   %rbp
+     cd8:	48 89 e5             	mov    %rsp,%rbp
+     cdb:	48 83 ec 10          	sub    $0x10,%rsp
+     cdf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ce3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ce6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     ce9:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     ced:	76 09                	jbe    cf8 <memset+0x21>
+     cef:	e8 71 ff ff ff       	call   c65 <haserms>
+     cf4:	85 c0                	test   %eax,%eax
+     cf6:	74 16                	je     d0e <memset+0x37>
+    stosb(dst, c, n);
+     cf8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     cfb:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     cfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d02:	89 ce                	mov    %ecx,%esi
+     d04:	48 89 c7             	mov    %rax,%rdi
+     d07:	e8 26 fd ff ff       	call   a32 <stosb>
+     d0c:	eb 58                	jmp    d66 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     d0e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d11:	c1 e8 03             	shr    $0x3,%eax
+     d14:	89 c6                	mov    %eax,%esi
+     d16:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d19:	48 98                	cltq
+     d1b:	0f b6 c0             	movzbl %al,%eax
+     d1e:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     d25:	01 01 01 
+     d28:	48 0f af c2          	imul   %rdx,%rax
+     d2c:	48 89 c1             	mov    %rax,%rcx
+     d2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d33:	48 89 f2             	mov    %rsi,%rdx
+     d36:	48 89 ce             	mov    %rcx,%rsi
+     d39:	48 89 c7             	mov    %rax,%rdi
+     d3c:	e8 23 fd ff ff       	call   a64 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     d41:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d44:	83 e0 07             	and    $0x7,%eax
+     d47:	89 c2                	mov    %eax,%edx
+     d49:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d4c:	83 e0 f8             	and    $0xfffffff8,%eax
+     d4f:	48 89 c1             	mov    %rax,%rcx
+     d52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d56:	48 01 c1             	add    %rax,%rcx
+     d59:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d5c:	89 c6                	mov    %eax,%esi
+     d5e:	48 89 cf             	mov    %rcx,%rdi
+     d61:	e8 cc fc ff ff       	call   a32 <stosb>
+  }
+  return dst;
+     d66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     d6a:	c9                   	leave
+     d6b:	c3                   	ret
+
+0000000000000d6c <strchr>:
+
+char *strchr(const char *s, char c) {
+     d6c:	55                   	push   %rbp
+     d6d:	48 89 e5             	mov    %rsp,%rbp
+     d70:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d74:	89 f0                	mov    %esi,%eax
+     d76:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     d79:	eb 17                	jmp    d92 <strchr+0x26>
+    if (*s == c)
+     d7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d7f:	0f b6 00             	movzbl (%rax),%eax
+     d82:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     d85:	75 06                	jne    d8d <strchr+0x21>
+      return (char *)s;
+     d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d8b:	eb 15                	jmp    da2 <strchr+0x36>
+  for (; *s; s++)
+     d8d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d96:	0f b6 00             	movzbl (%rax),%eax
+     d99:	84 c0                	test   %al,%al
+     d9b:	75 de                	jne    d7b <strchr+0xf>
+  return 0;
+     d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     da2:	5d                   	pop    %rbp
+     da3:	c3                   	ret
+
+0000000000000da4 <gets>:
+
+char *gets(char *buf, int max) {
+     da4:	55                   	push   %rbp
+     da5:	48 89 e5             	mov    %rsp,%rbp
+     da8:	48 83 ec 20          	sub    $0x20,%rsp
+     dac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     db0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     db3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     dba:	eb 48                	jmp    e04 <gets+0x60>
+    cc = read(0, &c, 1);
+     dbc:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     dc0:	ba 01 00 00 00       	mov    $0x1,%edx
+     dc5:	48 89 c6             	mov    %rax,%rsi
+     dc8:	bf 00 00 00 00       	mov    $0x0,%edi
+     dcd:	e8 b8 05 00 00       	call   138a <read>
+     dd2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     dd5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     dd9:	7e 36                	jle    e11 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     ddb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dde:	8d 50 01             	lea    0x1(%rax),%edx
+     de1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     de4:	48 63 d0             	movslq %eax,%rdx
+     de7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     deb:	48 01 c2             	add    %rax,%rdx
+     dee:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     df2:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     df4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     df8:	3c 0a                	cmp    $0xa,%al
+     dfa:	74 16                	je     e12 <gets+0x6e>
+     dfc:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e00:	3c 0d                	cmp    $0xd,%al
+     e02:	74 0e                	je     e12 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     e04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e07:	83 c0 01             	add    $0x1,%eax
+     e0a:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     e0d:	7f ad                	jg     dbc <gets+0x18>
+     e0f:	eb 01                	jmp    e12 <gets+0x6e>
+      break;
+     e11:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     e12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e15:	48 63 d0             	movslq %eax,%rdx
+     e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e1c:	48 01 d0             	add    %rdx,%rax
+     e1f:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     e22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     e26:	c9                   	leave
+     e27:	c3                   	ret
+
+0000000000000e28 <stat>:
+
+int stat(char *n, struct stat *st) {
+     e28:	55                   	push   %rbp
+     e29:	48 89 e5             	mov    %rsp,%rbp
+     e2c:	48 83 ec 10          	sub    $0x10,%rsp
+     e30:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e34:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     e38:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e40:	48 89 c6             	mov    %rax,%rsi
+     e43:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     e48:	e8 58 07 00 00       	call   15a5 <fstatat>
+}
+     e4d:	c9                   	leave
+     e4e:	c3                   	ret
+
+0000000000000e4f <atoi>:
+
+int atoi(const char *s) {
+     e4f:	55                   	push   %rbp
+     e50:	48 89 e5             	mov    %rsp,%rbp
+     e53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     e57:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e5e:	eb 28                	jmp    e88 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     e60:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e63:	89 d0                	mov    %edx,%eax
+     e65:	c1 e0 02             	shl    $0x2,%eax
+     e68:	01 d0                	add    %edx,%eax
+     e6a:	01 c0                	add    %eax,%eax
+     e6c:	89 c1                	mov    %eax,%ecx
+     e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e72:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     e76:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     e7a:	0f b6 00             	movzbl (%rax),%eax
+     e7d:	0f be c0             	movsbl %al,%eax
+     e80:	01 c8                	add    %ecx,%eax
+     e82:	83 e8 30             	sub    $0x30,%eax
+     e85:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e8c:	0f b6 00             	movzbl (%rax),%eax
+     e8f:	3c 2f                	cmp    $0x2f,%al
+     e91:	7e 0b                	jle    e9e <atoi+0x4f>
+     e93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e97:	0f b6 00             	movzbl (%rax),%eax
+     e9a:	3c 39                	cmp    $0x39,%al
+     e9c:	7e c2                	jle    e60 <atoi+0x11>
+  return n;
+     e9e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     ea1:	5d                   	pop    %rbp
+     ea2:	c3                   	ret
+
+0000000000000ea3 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     ea3:	55                   	push   %rbp
+     ea4:	48 89 e5             	mov    %rsp,%rbp
+     ea7:	48 83 ec 28          	sub    $0x28,%rsp
+     eab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     eaf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     eb3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     eb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     ebe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     ec2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     ec6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     eca:	7f 09                	jg     ed5 <memmove+0x32>
+    return vdst;
+     ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ed0:	e9 29 01 00 00       	jmp    ffe <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ed9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     edd:	0f 83 87 00 00 00    	jae    f6a <memmove+0xc7>
+     ee3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ee6:	48 63 d0             	movslq %eax,%rdx
+     ee9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eed:	48 01 d0             	add    %rdx,%rax
+     ef0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ef4:	73 74                	jae    f6a <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     ef6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ef9:	48 98                	cltq
+     efb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     eff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f02:	48 98                	cltq
+     f04:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     f08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f10:	48 09 d0             	or     %rdx,%rax
+     f13:	83 e0 07             	and    $0x7,%eax
+     f16:	48 85 c0             	test   %rax,%rax
+     f19:	75 3d                	jne    f58 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     f1b:	eb 1c                	jmp    f39 <memmove+0x96>
+        src -= 8;
+     f1d:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     f22:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f2b:	48 8b 10             	mov    (%rax),%rdx
+     f2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f32:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     f35:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     f39:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     f3d:	7f de                	jg     f1d <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     f3f:	eb 17                	jmp    f58 <memmove+0xb5>
+      *--dst = *--src;
+     f41:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     f46:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     f4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f4f:	0f b6 10             	movzbl (%rax),%edx
+     f52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f56:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     f58:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f5b:	8d 50 ff             	lea    -0x1(%rax),%edx
+     f5e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     f61:	85 c0                	test   %eax,%eax
+     f63:	7f dc                	jg     f41 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     f65:	e9 90 00 00 00       	jmp    ffa <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     f6a:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     f6e:	7e 09                	jle    f79 <memmove+0xd6>
+     f70:	e8 f0 fc ff ff       	call   c65 <haserms>
+     f75:	85 c0                	test   %eax,%eax
+     f77:	74 1b                	je     f94 <memmove+0xf1>
+    movsb(dst, src, n);
+     f79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f7c:	48 63 d0             	movslq %eax,%rdx
+     f7f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f87:	48 89 ce             	mov    %rcx,%rsi
+     f8a:	48 89 c7             	mov    %rax,%rdi
+     f8d:	e8 0c fb ff ff       	call   a9e <movsb>
+     f92:	eb 66                	jmp    ffa <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     f94:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f97:	8d 50 07             	lea    0x7(%rax),%edx
+     f9a:	85 c0                	test   %eax,%eax
+     f9c:	0f 48 c2             	cmovs  %edx,%eax
+     f9f:	c1 f8 03             	sar    $0x3,%eax
+     fa2:	48 63 d0             	movslq %eax,%rdx
+     fa5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     fa9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fad:	48 89 ce             	mov    %rcx,%rsi
+     fb0:	48 89 c7             	mov    %rax,%rdi
+     fb3:	e8 23 fb ff ff       	call   adb <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     fb8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     fbb:	89 d0                	mov    %edx,%eax
+     fbd:	c1 f8 1f             	sar    $0x1f,%eax
+     fc0:	c1 e8 1d             	shr    $0x1d,%eax
+     fc3:	01 c2                	add    %eax,%edx
+     fc5:	83 e2 07             	and    $0x7,%edx
+     fc8:	29 c2                	sub    %eax,%edx
+     fca:	89 d0                	mov    %edx,%eax
+     fcc:	48 98                	cltq
+     fce:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     fd1:	83 e2 f8             	and    $0xfffffff8,%edx
+     fd4:	48 63 ca             	movslq %edx,%rcx
+     fd7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     fdb:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     fdf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     fe2:	83 e2 f8             	and    $0xfffffff8,%edx
+     fe5:	48 63 ca             	movslq %edx,%rcx
+     fe8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     fec:	48 01 d1             	add    %rdx,%rcx
+     fef:	48 89 c2             	mov    %rax,%rdx
+     ff2:	48 89 cf             	mov    %rcx,%rdi
+     ff5:	e8 a4 fa ff ff       	call   a9e <movsb>
+  }
+  return vdst;
+     ffa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     ffe:	c9                   	leave
+     fff:	c3                   	ret
+
+0000000000001000 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1000:	55                   	push   %rbp
+    1001:	48 89 e5             	mov    %rsp,%rbp
+    1004:	48 83 ec 20          	sub    $0x20,%rsp
+    1008:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    100b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    100f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1016:	00 00 00 
+    1019:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    101d:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1021:	75 0d                	jne    1030 <clock_gettime+0x30>
+    1023:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1027:	48 8b 40 08          	mov    0x8(%rax),%rax
+    102b:	48 85 c0             	test   %rax,%rax
+    102e:	75 13                	jne    1043 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1030:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1034:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1037:	48 89 d6             	mov    %rdx,%rsi
+    103a:	89 c7                	mov    %eax,%edi
+    103c:	e8 e0 04 00 00       	call   1521 <_clock_gettime>
+    1041:	eb 7d                	jmp    10c0 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1043:	e8 d1 fa ff ff       	call   b19 <rdtsc>
+    1048:	48 89 c2             	mov    %rax,%rdx
+    104b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    104f:	48 89 d6             	mov    %rdx,%rsi
+    1052:	48 89 c7             	mov    %rax,%rdi
+    1055:	e8 7b f9 ff ff       	call   9d5 <clockns>
+    105a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    105e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1062:	48 c1 e8 09          	shr    $0x9,%rax
+    1066:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    106d:	b8 44 00 
+    1070:	48 f7 e2             	mul    %rdx
+    1073:	48 89 d0             	mov    %rdx,%rax
+    1076:	48 c1 e8 0b          	shr    $0xb,%rax
+    107a:	48 89 c2             	mov    %rax,%rdx
+    107d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1081:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1084:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1088:	48 89 c8             	mov    %rcx,%rax
+    108b:	48 c1 e8 09          	shr    $0x9,%rax
+    108f:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1096:	b8 44 00 
+    1099:	48 f7 e2             	mul    %rdx
+    109c:	48 89 d0             	mov    %rdx,%rax
+    109f:	48 c1 e8 0b          	shr    $0xb,%rax
+    10a3:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    10aa:	48 89 c8             	mov    %rcx,%rax
+    10ad:	48 29 d0             	sub    %rdx,%rax
+    10b0:	48 89 c2             	mov    %rax,%rdx
+    10b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10b7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    10bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    10c0:	c9                   	leave
+    10c1:	c3                   	ret
+
+00000000000010c2 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    10c2:	55                   	push   %rbp
+    10c3:	48 89 e5             	mov    %rsp,%rbp
+    10c6:	48 83 ec 10          	sub    $0x10,%rsp
+    10ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    10ce:	eb 11                	jmp    10e1 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    10d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d4:	be 02 00 00 00       	mov    $0x2,%esi
+    10d9:	48 89 c7             	mov    %rax,%rdi
+    10dc:	e8 6c 04 00 00       	call   154d <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    10e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    10e5:	b8 02 00 00 00       	mov    $0x2,%eax
+    10ea:	87 02                	xchg   %eax,(%rdx)
+    10ec:	85 c0                	test   %eax,%eax
+    10ee:	75 e0                	jne    10d0 <mutex_wait+0xe>
+}
+    10f0:	90                   	nop
+    10f1:	90                   	nop
+    10f2:	c9                   	leave
+    10f3:	c3                   	ret
+
+00000000000010f4 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    10f4:	55                   	push   %rbp
+    10f5:	48 89 e5             	mov    %rsp,%rbp
+    10f8:	48 83 ec 20          	sub    $0x20,%rsp
+    10fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1107:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    110b:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    110f:	8b 02                	mov    (%rdx),%eax
+    1111:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1116:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    111a:	89 c1                	mov    %eax,%ecx
+    111c:	0f 94 c0             	sete   %al
+    111f:	84 c0                	test   %al,%al
+    1121:	75 02                	jne    1125 <mutex_lock+0x31>
+    1123:	89 0a                	mov    %ecx,(%rdx)
+    1125:	83 f0 01             	xor    $0x1,%eax
+    1128:	84 c0                	test   %al,%al
+    112a:	74 0c                	je     1138 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    112c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1130:	48 89 c7             	mov    %rax,%rdi
+    1133:	e8 8a ff ff ff       	call   10c2 <mutex_wait>
+}
+    1138:	90                   	nop
+    1139:	c9                   	leave
+    113a:	c3                   	ret
+
+000000000000113b <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    113b:	55                   	push   %rbp
+    113c:	48 89 e5             	mov    %rsp,%rbp
+    113f:	48 83 ec 10          	sub    $0x10,%rsp
+    1143:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1147:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    114b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1150:	87 10                	xchg   %edx,(%rax)
+    1152:	83 fa 02             	cmp    $0x2,%edx
+    1155:	75 11                	jne    1168 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1157:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    115b:	be 01 00 00 00       	mov    $0x1,%esi
+    1160:	48 89 c7             	mov    %rax,%rdi
+    1163:	e8 f0 03 00 00       	call   1558 <futex_wake>
+}
+    1168:	90                   	nop
+    1169:	c9                   	leave
+    116a:	c3                   	ret
+
+000000000000116b <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    116b:	55                   	push   %rbp
+    116c:	48 89 e5             	mov    %rsp,%rbp
+    116f:	48 83 ec 20          	sub    $0x20,%rsp
+    1173:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1177:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    117b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    117f:	48 83 c0 04          	add    $0x4,%rax
+    1183:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    118b:	8b 00                	mov    (%rax),%eax
+    118d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1190:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1194:	48 89 c7             	mov    %rax,%rdi
+    1197:	e8 9f ff ff ff       	call   113b <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    119c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11a0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    11a3:	89 d6                	mov    %edx,%esi
+    11a5:	48 89 c7             	mov    %rax,%rdi
+    11a8:	e8 a0 03 00 00       	call   154d <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    11ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11b1:	48 83 c0 04          	add    $0x4,%rax
+    11b5:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    11b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    11bd:	48 89 c7             	mov    %rax,%rdi
+    11c0:	e8 fd fe ff ff       	call   10c2 <mutex_wait>
+}
+    11c5:	90                   	nop
+    11c6:	c9                   	leave
+    11c7:	c3                   	ret
+
+00000000000011c8 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    11c8:	55                   	push   %rbp
+    11c9:	48 89 e5             	mov    %rsp,%rbp
+    11cc:	48 83 ec 10          	sub    $0x10,%rsp
+    11d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    11d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11d8:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    11dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11e0:	48 83 c0 04          	add    $0x4,%rax
+    11e4:	8b 00                	mov    (%rax),%eax
+    11e6:	85 c0                	test   %eax,%eax
+    11e8:	7e 11                	jle    11fb <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    11ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ee:	be 01 00 00 00       	mov    $0x1,%esi
+    11f3:	48 89 c7             	mov    %rax,%rdi
+    11f6:	e8 5d 03 00 00       	call   1558 <futex_wake>
+}
+    11fb:	90                   	nop
+    11fc:	c9                   	leave
+    11fd:	c3                   	ret
+
+00000000000011fe <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    11fe:	55                   	push   %rbp
+    11ff:	48 89 e5             	mov    %rsp,%rbp
+    1202:	48 83 ec 10          	sub    $0x10,%rsp
+    1206:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    120a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    120e:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1212:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1216:	48 83 c0 04          	add    $0x4,%rax
+    121a:	8b 00                	mov    (%rax),%eax
+    121c:	85 c0                	test   %eax,%eax
+    121e:	7e 11                	jle    1231 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1224:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1229:	48 89 c7             	mov    %rax,%rdi
+    122c:	e8 27 03 00 00       	call   1558 <futex_wake>
+}
+    1231:	90                   	nop
+    1232:	c9                   	leave
+    1233:	c3                   	ret
+
+0000000000001234 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1234:	55                   	push   %rbp
+    1235:	48 89 e5             	mov    %rsp,%rbp
+    1238:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    123c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    123f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1243:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1247:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    124b:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    124f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1253:	8b 40 04             	mov    0x4(%rax),%eax
+    1256:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1259:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    125d:	8b 00                	mov    (%rax),%eax
+    125f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1262:	29 c2                	sub    %eax,%edx
+    1264:	83 fa 1f             	cmp    $0x1f,%edx
+    1267:	76 07                	jbe    1270 <ring_push+0x3c>
+    return -1;
+    1269:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    126e:	eb 7e                	jmp    12ee <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1270:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1273:	83 e0 1f             	and    $0x1f,%eax
+    1276:	89 c2                	mov    %eax,%edx
+    1278:	48 89 d0             	mov    %rdx,%rax
+    127b:	48 01 c0             	add    %rax,%rax
+    127e:	48 01 d0             	add    %rdx,%rax
+    1281:	48 c1 e0 04          	shl    $0x4,%rax
+    1285:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    128d:	48 01 d0             	add    %rdx,%rax
+    1290:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1294:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1298:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    129b:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    129d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12a1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    12a5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    12a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12ad:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    12b1:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    12b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12b9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    12bd:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    12c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    12c9:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    12cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12d1:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    12d5:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    12d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12dc:	8d 50 01             	lea    0x1(%rax),%edx
+    12df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12e3:	48 83 c0 04          	add    $0x4,%rax
+    12e7:	89 10                	mov    %edx,(%rax)
+  return 0;
+    12e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12ee:	5d                   	pop    %rbp
+    12ef:	c3                   	ret
+
+00000000000012f0 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    12f0:	55                   	push   %rbp
+    12f1:	48 89 e5             	mov    %rsp,%rbp
+    12f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    12fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1300:	8b 40 08             	mov    0x8(%rax),%eax
+    1303:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1306:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    130a:	48 83 c0 0c          	add    $0xc,%rax
+    130e:	8b 00                	mov    (%rax),%eax
+    1310:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1313:	75 07                	jne    131c <ring_pop+0x2c>
+    return -1;
+    1315:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    131a:	eb 40                	jmp    135c <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    131c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    131f:	83 e0 1f             	and    $0x1f,%eax
+    1322:	89 c2                	mov    %eax,%edx
+    1324:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1328:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    132c:	89 d2                	mov    %edx,%edx
+    132e:	48 83 c2 61          	add    $0x61,%rdx
+    1332:	48 c1 e2 04          	shl    $0x4,%rdx
+    1336:	48 01 d0             	add    %rdx,%rax
+    1339:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    133d:	48 8b 00             	mov    (%rax),%rax
+    1340:	48 89 01             	mov    %rax,(%rcx)
+    1343:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1347:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    134a:	8d 50 01             	lea    0x1(%rax),%edx
+    134d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1351:	48 83 c0 08          	add    $0x8,%rax
+    1355:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1357:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    135c:	5d                   	pop    %rbp
+    135d:	c3                   	ret
+
+000000000000135e <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    135e:	b8 01 00 00 00       	mov    $0x1,%eax
+    1363:	49 89 ca             	mov    %rcx,%r10
+    1366:	0f 05                	syscall
+    1368:	c3                   	ret
+
+0000000000001369 <_exit>:
+SYSCALL_(exit)
+    1369:	b8 02 00 00 00       	mov    $0x2,%eax
+    136e:	49 89 ca             	mov    %rcx,%r10
+    1371:	0f 05                	syscall
+    1373:	c3                   	ret
+
+0000000000001374 <wait>:
+SYSCALL(wait)
+    1374:	b8 03 00 00 00       	mov    $0x3,%eax
+    1379:	49 89 ca             	mov    %rcx,%r10
+    137c:	0f 05                	syscall
+    137e:	c3                   	ret
+
+000000000000137f <pipe>:
+SYSCALL(pipe)
+    137f:	b8 04 00 00 00       	mov    $0x4,%eax
+    1384:	49 89 ca             	mov    %rcx,%r10
+    1387:	0f 05                	syscall
+    1389:	c3                   	ret
+
+000000000000138a <read>:
+SYSCALL(read)
+    138a:	b8 05 00 00 00       	mov    $0x5,%eax
+    138f:	49 89 ca             	mov    %rcx,%r10
+    1392:	0f 05                	syscall
+    1394:	c3                   	ret
+
+0000000000001395 <write>:
+SYSCALL(write)
+    1395:	b8 10 00 00 00       	mov    $0x10,%eax
+    139a:	49 89 ca             	mov    %rcx,%r10
+    139d:	0f 05                	syscall
+    139f:	c3                   	ret
+
+00000000000013a0 <_close>:
+SYSCALL_(close)
+    13a0:	b8 15 00 00 00       	mov    $0x15,%eax
+    13a5:	49 89 ca             	mov    %rcx,%r10
+    13a8:	0f 05                	syscall
+    13aa:	c3                   	ret
+
+00000000000013ab <kill>:
+SYSCALL(kill)
+    13ab:	b8 06 00 00 00       	mov    $0x6,%eax
+    13b0:	49 89 ca             	mov    %rcx,%r10
+    13b3:	0f 05                	syscall
+    13b5:	c3                   	ret
+
+00000000000013b6 <_exec>:
+SYSCALL_(exec)
+    13b6:	b8 07 00 00 00       	mov    $0x7,%eax
+    13bb:	49 89 ca             	mov    %rcx,%r10
+    13be:	0f 05                	syscall
+    13c0:	c3                   	ret
+
+00000000000013c1 <open>:
+SYSCALL(open)
+    13c1:	b8 0f 00 00 00       	mov    $0xf,%eax
+    13c6:	49 89 ca             	mov    %rcx,%r10
+    13c9:	0f 05                	syscall
+    13cb:	c3                   	ret
+
+00000000000013cc <mknod>:
+SYSCALL(mknod)
+    13cc:	b8 11 00 00 00       	mov    $0x11,%eax
+    13d1:	49 89 ca             	mov    %rcx,%r10
+    13d4:	0f 05                	syscall
+    13d6:	c3                   	ret
+
+00000000000013d7 <unlink>:
+SYSCALL(unlink)
+    13d7:	b8 12 00 00 00       	mov    $0x12,%eax
+    13dc:	49 89 ca             	mov    %rcx,%r10
+    13df:	0f 05                	syscall
+    13e1:	c3                   	ret
+
+00000000000013e2 <fstat>:
+SYSCALL(fstat)
+    13e2:	b8 08 00 00 00       	mov    $0x8,%eax
+    13e7:	49 89 ca             	mov    %rcx,%r10
+    13ea:	0f 05                	syscall
+    13ec:	c3                   	ret
+
+00000000000013ed <link>:
+SYSCALL(link)
+    13ed:	b8 13 00 00 00       	mov    $0x13,%eax
+    13f2:	49 89 ca             	mov    %rcx,%r10
+    13f5:	0f 05                	syscall
+    13f7:	c3                   	ret
+
+00000000000013f8 <mkdir>:
+SYSCALL(mkdir)
+    13f8:	b8 14 00 00 00       	mov    $0x14,%eax
+    13fd:	49 89 ca             	mov    %rcx,%r10
+    1400:	0f 05                	syscall
+    1402:	c3                   	ret
+
+0000000000001403 <chdir>:
+SYSCALL(chdir)
+    1403:	b8 09 00 00 00       	mov    $0x9,%eax
+    1408:	49 89 ca             	mov    %rcx,%r10
+    140b:	0f 05                	syscall
+    140d:	c3                   	ret
+
+000000000000140e <dup>:
+SYSCALL(dup)
+    140e:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1413:	49 89 ca             	mov    %rcx,%r10
+    1416:	0f 05                	syscall
+    1418:	c3                   	ret
+
+0000000000001419 <getpid>:
+SYSCALL(getpid)
+    1419:	b8 0b 00 00 00       	mov    $0xb,%eax
+    141e:	49 89 ca             	mov    %rcx,%r10
+    1421:	0f 05                	syscall
+    1423:	c3                   	ret
+
+0000000000001424 <sbrk>:
+SYSCALL(sbrk)
+    1424:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1429:	49 89 ca             	mov    %rcx,%r10
+    142c:	0f 05                	syscall
+    142e:	c3                   	ret
+
+000000000000142f <sleep>:
+SYSCALL(sleep)
+    142f:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1434:	49 89 ca             	mov    %rcx,%r10
+    1437:	0f 05                	syscall
+    1439:	c3                   	ret
+
+000000000000143a <uptime>:
+SYSCALL(uptime)
+    143a:	b8 0e 00 00 00       	mov    $0xe,%eax
+    143f:	49 89 ca             	mov    %rcx,%r10
+    1442:	0f 05                	syscall
+    1444:	c3                   	ret
+
+0000000000001445 <sysinfo>:
+SYSCALL(sysinfo)
+    1445:	b8 16 00 00 00       	mov    $0x16,%eax
+    144a:	49 89 ca             	mov    %rcx,%r10
+    144d:	0f 05                	syscall
+    144f:	c3                   	ret
+
+0000000000001450 <crashn>:
+SYSCALL(crashn)
+    1450:	b8 17 00 00 00       	mov    $0x17,%eax
+    1455:	49 89 ca             	mov    %rcx,%r10
+    1458:	0f 05                	syscall
+    145a:	c3                   	ret
+
+000000000000145b <mmap>:
+SYSCALL(mmap)
+    145b:	b8 18 00 00 00       	mov    $0x18,%eax
+    1460:	49 89 ca             	mov    %rcx,%r10
+    1463:	0f 05                	syscall
+    1465:	c3                   	ret
+
+0000000000001466 <munmap>:
+SYSCALL(munmap)
+    1466:	b8 19 00 00 00       	mov    $0x19,%eax
+    146b:	49 89 ca             	mov    %rcx,%r10
+    146e:	0f 05                	syscall
+    1470:	c3                   	ret
+
+0000000000001471 <nice>:
+SYSCALL(nice)
+    1471:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1476:	49 89 ca             	mov    %rcx,%r10
+    1479:	0f 05                	syscall
+    147b:	c3                   	ret
+
+000000000000147c <_spawn>:
+SYSCALL_(spawn)
+    147c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1481:	49 89 ca             	mov    %rcx,%r10
+    1484:	0f 05                	syscall
+    1486:	c3                   	ret
+
+0000000000001487 <pread>:
+SYSCALL(pread)
+    1487:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    148c:	49 89 ca             	mov    %rcx,%r10
+    148f:	0f 05                	syscall
+    1491:	c3                   	ret
+
+0000000000001492 <pwrite>:
+SYSCALL(pwrite)
+    1492:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1497:	49 89 ca             	mov    %rcx,%r10
+    149a:	0f 05                	syscall
+    149c:	c3                   	ret
+
+000000000000149d <readv>:
+SYSCALL(readv)
+    149d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    14a2:	49 89 ca             	mov    %rcx,%r10
+    14a5:	0f 05                	syscall
+    14a7:	c3                   	ret
+
+00000000000014a8 <writev>:
+SYSCALL(writev)
+    14a8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    14ad:	49 89 ca             	mov    %rcx,%r10
+    14b0:	0f 05                	syscall
+    14b2:	c3                   	ret
+
+00000000000014b3 <sendfile>:
+SYSCALL(sendfile)
+    14b3:	b8 20 00 00 00       	mov    $0x20,%eax
+    14b8:	49 89 ca             	mov    %rcx,%r10
+    14bb:	0f 05                	syscall
+    14bd:	c3                   	ret
+
+00000000000014be <splice>:
+SYSCALL(splice)
+    14be:	b8 21 00 00 00       	mov    $0x21,%eax
+    14c3:	49 89 ca             	mov    %rcx,%r10
+    14c6:	0f 05                	syscall
+    14c8:	c3                   	ret
+
+00000000000014c9 <poll>:
+SYSCALL(poll)
+    14c9:	b8 22 00 00 00       	mov    $0x22,%eax
+    14ce:	49 89 ca             	mov    %rcx,%r10
+    14d1:	0f 05                	syscall
+    14d3:	c3                   	ret
+
+00000000000014d4 <fsync>:
+SYSCALL(fsync)
+    14d4:	b8 23 00 00 00       	mov    $0x23,%eax
+    14d9:	49 89 ca             	mov    %rcx,%r10
+    14dc:	0f 05                	syscall
+    14de:	c3                   	ret
+
+00000000000014df <fdatasync>:
+SYSCALL(fdatasync)
+    14df:	b8 24 00 00 00       	mov    $0x24,%eax
+    14e4:	49 89 ca             	mov    %rcx,%r10
+    14e7:	0f 05                	syscall
+    14e9:	c3                   	ret
+
+00000000000014ea <lockstat>:
+SYSCALL(lockstat)
+    14ea:	b8 25 00 00 00       	mov    $0x25,%eax
+    14ef:	49 89 ca             	mov    %rcx,%r10
+    14f2:	0f 05                	syscall
+    14f4:	c3                   	ret
+
+00000000000014f5 <syscallstat>:
+SYSCALL(syscallstat)
+    14f5:	b8 26 00 00 00       	mov    $0x26,%eax
+    14fa:	49 89 ca             	mov    %rcx,%r10
+    14fd:	0f 05                	syscall
+    14ff:	c3                   	ret
+
+0000000000001500 <trace>:
+SYSCALL(trace)
+    1500:	b8 27 00 00 00       	mov    $0x27,%eax
+    1505:	49 89 ca             	mov    %rcx,%r10
+    1508:	0f 05                	syscall
+    150a:	c3                   	ret
+
+000000000000150b <profile>:
+SYSCALL(profile)
+    150b:	b8 28 00 00 00       	mov    $0x28,%eax
+    1510:	49 89 ca             	mov    %rcx,%r10
+    1513:	0f 05                	syscall
+    1515:	c3                   	ret
+
+0000000000001516 <cycles>:
+SYSCALL(cycles)
+    1516:	b8 29 00 00 00       	mov    $0x29,%eax
+    151b:	49 89 ca             	mov    %rcx,%r10
+    151e:	0f 05                	syscall
+    1520:	c3                   	ret
+
+0000000000001521 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1521:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1526:	49 89 ca             	mov    %rcx,%r10
+    1529:	0f 05                	syscall
+    152b:	c3                   	ret
+
+000000000000152c <consmode>:
+SYSCALL(consmode)
+    152c:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1531:	49 89 ca             	mov    %rcx,%r10
+    1534:	0f 05                	syscall
+    1536:	c3                   	ret
+
+0000000000001537 <clone>:
+SYSCALL(clone)
+    1537:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    153c:	49 89 ca             	mov    %rcx,%r10
+    153f:	0f 05                	syscall
+    1541:	c3                   	ret
+
+0000000000001542 <join>:
+SYSCALL(join)
+    1542:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1547:	49 89 ca             	mov    %rcx,%r10
+    154a:	0f 05                	syscall
+    154c:	c3                   	ret
+
+000000000000154d <futex_wait>:
+SYSCALL(futex_wait)
+    154d:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1552:	49 89 ca             	mov    %rcx,%r10
+    1555:	0f 05                	syscall
+    1557:	c3                   	ret
+
+0000000000001558 <futex_wake>:
+SYSCALL(futex_wake)
+    1558:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    155d:	49 89 ca             	mov    %rcx,%r10
+    1560:	0f 05                	syscall
+    1562:	c3                   	ret
+
+0000000000001563 <shmget>:
+SYSCALL(shmget)
+    1563:	b8 30 00 00 00       	mov    $0x30,%eax
+    1568:	49 89 ca             	mov    %rcx,%r10
+    156b:	0f 05                	syscall
+    156d:	c3                   	ret
+
+000000000000156e <shmat>:
+SYSCALL(shmat)
+    156e:	b8 31 00 00 00       	mov    $0x31,%eax
+    1573:	49 89 ca             	mov    %rcx,%r10
+    1576:	0f 05                	syscall
+    1578:	c3                   	ret
+
+0000000000001579 <shmdt>:
+SYSCALL(shmdt)
+    1579:	b8 32 00 00 00       	mov    $0x32,%eax
+    157e:	49 89 ca             	mov    %rcx,%r10
+    1581:	0f 05                	syscall
+    1583:	c3                   	ret
+
+0000000000001584 <ring_setup>:
+SYSCALL(ring_setup)
+    1584:	b8 33 00 00 00       	mov    $0x33,%eax
+    1589:	49 89 ca             	mov    %rcx,%r10
+    158c:	0f 05                	syscall
+    158e:	c3                   	ret
+
+000000000000158f <ring_enter>:
+SYSCALL(ring_enter)
+    158f:	b8 34 00 00 00       	mov    $0x34,%eax
+    1594:	49 89 ca             	mov    %rcx,%r10
+    1597:	0f 05                	syscall
+    1599:	c3                   	ret
+
+000000000000159a <getdents>:
+SYSCALL(getdents)
+    159a:	b8 35 00 00 00       	mov    $0x35,%eax
+    159f:	49 89 ca             	mov    %rcx,%r10
+    15a2:	0f 05                	syscall
+    15a4:	c3                   	ret
+
+00000000000015a5 <fstatat>:
+SYSCALL(fstatat)
+    15a5:	b8 36 00 00 00       	mov    $0x36,%eax
+    15aa:	49 89 ca             	mov    %rcx,%r10
+    15ad:	0f 05                	syscall
+    15af:	c3                   	ret
+
+00000000000015b0 <clone_file>:
+SYSCALL(clone_file)
+    15b0:	b8 37 00 00 00       	mov    $0x37,%eax
+    15b5:	49 89 ca             	mov    %rcx,%r10
+    15b8:	0f 05                	syscall
+    15ba:	c3                   	ret
+
+00000000000015bb <fpunch>:
+SYSCALL(fpunch)
+    15bb:	b8 38 00 00 00       	mov    $0x38,%eax
+    15c0:	49 89 ca             	mov    %rcx,%r10
+    15c3:	0f 05                	syscall
+    15c5:	c3                   	ret
+
+00000000000015c6 <defrag>:
+SYSCALL(defrag)
+    15c6:	b8 39 00 00 00       	mov    $0x39,%eax
+    15cb:	49 89 ca             	mov    %rcx,%r10
+    15ce:	0f 05                	syscall
+    15d0:	c3                   	ret
+
+00000000000015d1 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    15d1:	55                   	push   %rbp
+    15d2:	48 89 e5             	mov    %rsp,%rbp
+    15d5:	48 83 ec 20          	sub    $0x20,%rsp
+    15d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    15dd:	bf 00 00 00 00       	mov    $0x0,%edi
+    15e2:	e8 3d fe ff ff       	call   1424 <sbrk>
+    15e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    15eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ef:	48 f7 d8             	neg    %rax
+    15f2:	25 ff 0f 00 00       	and    $0xfff,%eax
+    15f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    15fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    15ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1603:	48 01 c2             	add    %rax,%rdx
+    1606:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    160b:	48 39 c2             	cmp    %rax,%rdx
+    160e:	73 1e                	jae    162e <morecore+0x5d>
+    1610:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1614:	89 c2                	mov    %eax,%edx
+    1616:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    161a:	01 d0                	add    %edx,%eax
+    161c:	89 c7                	mov    %eax,%edi
+    161e:	e8 01 fe ff ff       	call   1424 <sbrk>
+    1623:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1627:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    162c:	75 07                	jne    1635 <morecore+0x64>
+    return 0;
+    162e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1633:	eb 27                	jmp    165c <morecore+0x8b>
+  stats.heap += n + pad;
+    1635:	48 8b 05 54 1b 00 00 	mov    0x1b54(%rip),%rax        # 3190 <stats+0x50>
+    163c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1640:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1644:	48 01 ca             	add    %rcx,%rdx
+    1647:	48 01 d0             	add    %rdx,%rax
+    164a:	48 89 05 3f 1b 00 00 	mov    %rax,0x1b3f(%rip)        # 3190 <stats+0x50>
+  return p + pad;
+    1651:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1655:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1659:	48 01 d0             	add    %rdx,%rax
+}
+    165c:	c9                   	leave
+    165d:	c3                   	ret
+
+000000000000165e <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    165e:	55                   	push   %rbp
+    165f:	48 89 e5             	mov    %rsp,%rbp
+    1662:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1666:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    166a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1671:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1672:	48 8d 05 a7 1a 00 00 	lea    0x1aa7(%rip),%rax        # 3120 <runs>
+    1679:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    167d:	eb 1a                	jmp    1699 <pagefree+0x3b>
+    prev = *rp;
+    167f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1683:	48 8b 00             	mov    (%rax),%rax
+    1686:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    168a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168e:	48 8b 00             	mov    (%rax),%rax
+    1691:	48 83 c0 08          	add    $0x8,%rax
+    1695:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    169d:	48 8b 00             	mov    (%rax),%rax
+    16a0:	48 85 c0             	test   %rax,%rax
+    16a3:	74 0d                	je     16b2 <pagefree+0x54>
+    16a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a9:	48 8b 00             	mov    (%rax),%rax
+    16ac:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    16b0:	72 cd                	jb     167f <pagefree+0x21>
+  r = (struct run *)p;
+    16b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    16b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    16ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16be:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    16c2:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    16c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16c9:	48 8b 10             	mov    (%rax),%rdx
+    16cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    16d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16dc:	48 85 c0             	test   %rax,%rax
+    16df:	74 48                	je     1729 <pagefree+0xcb>
+    16e1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    16e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    16e9:	48 01 c2             	add    %rax,%rdx
+    16ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16f0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16f4:	48 39 c2             	cmp    %rax,%rdx
+    16f7:	75 30                	jne    1729 <pagefree+0xcb>
+    r->size += r->next->size;
+    16f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16fd:	48 8b 10             	mov    (%rax),%rdx
+    1700:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1704:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1708:	48 8b 00             	mov    (%rax),%rax
+    170b:	48 01 c2             	add    %rax,%rdx
+    170e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1712:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1719:	48 8b 40 08          	mov    0x8(%rax),%rax
+    171d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1721:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1725:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1729:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    172e:	74 46                	je     1776 <pagefree+0x118>
+    1730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1734:	48 8b 10             	mov    (%rax),%rdx
+    1737:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173b:	48 01 d0             	add    %rdx,%rax
+    173e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1742:	75 32                	jne    1776 <pagefree+0x118>
+    prev->size += r->size;
+    1744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1748:	48 8b 10             	mov    (%rax),%rdx
+    174b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    174f:	48 8b 00             	mov    (%rax),%rax
+    1752:	48 01 c2             	add    %rax,%rdx
+    1755:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1759:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    175c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1760:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1764:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1768:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    176c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1770:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1774:	eb 0c                	jmp    1782 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1776:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    177e:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1781:	90                   	nop
+    1782:	90                   	nop
+    1783:	5d                   	pop    %rbp
+    1784:	c3                   	ret
+
+0000000000001785 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1785:	55                   	push   %rbp
+    1786:	48 89 e5             	mov    %rsp,%rbp
+    1789:	48 83 ec 40          	sub    $0x40,%rsp
+    178d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1791:	48 8d 05 88 19 00 00 	lea    0x1988(%rip),%rax        # 3120 <runs>
+    1798:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    179c:	eb 66                	jmp    1804 <pagealloc+0x7f>
+    if (r->size == n) {
+    179e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a2:	48 8b 00             	mov    (%rax),%rax
+    17a5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    17a9:	75 18                	jne    17c3 <pagealloc+0x3e>
+      *rp = r->next;
+    17ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17af:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b7:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    17ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17be:	e9 ca 00 00 00       	jmp    188d <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    17c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17c7:	48 8b 00             	mov    (%rax),%rax
+    17ca:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    17ce:	73 28                	jae    17f8 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    17d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17d4:	48 8b 00             	mov    (%rax),%rax
+    17d7:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    17db:	48 89 c2             	mov    %rax,%rdx
+    17de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17e2:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    17e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17e9:	48 8b 10             	mov    (%rax),%rdx
+    17ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17f0:	48 01 d0             	add    %rdx,%rax
+    17f3:	e9 95 00 00 00       	jmp    188d <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    17f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17fc:	48 83 c0 08          	add    $0x8,%rax
+    1800:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1808:	48 8b 00             	mov    (%rax),%rax
+    180b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    180f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1814:	75 88                	jne    179e <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1816:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    181a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    181e:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1825:	00 
+    1826:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    182a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    182e:	48 39 c2             	cmp    %rax,%rdx
+    1831:	48 0f 43 c2          	cmovae %rdx,%rax
+    1835:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1839:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    183d:	48 89 c7             	mov    %rax,%rdi
+    1840:	e8 8c fd ff ff       	call   15d1 <morecore>
+    1845:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1849:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    184e:	75 07                	jne    1857 <pagealloc+0xd2>
+    return 0;
+    1850:	b8 00 00 00 00       	mov    $0x0,%eax
+    1855:	eb 36                	jmp    188d <pagealloc+0x108>
+  if (m > n)
+    1857:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    185b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    185f:	73 1a                	jae    187b <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1861:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1865:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1869:	48 89 c2             	mov    %rax,%rdx
+    186c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1870:	48 89 d6             	mov    %rdx,%rsi
+    1873:	48 89 c7             	mov    %rax,%rdi
+    1876:	e8 e3 fd ff ff       	call   165e <pagefree>
+  return p + m - n;
+    187b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    187f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1883:	48 89 c2             	mov    %rax,%rdx
+    1886:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    188a:	48 01 d0             	add    %rdx,%rax
+}
+    188d:	c9                   	leave
+    188e:	c3                   	ret
+
+000000000000188f <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    188f:	55                   	push   %rbp
+    1890:	48 89 e5             	mov    %rsp,%rbp
+    1893:	48 83 ec 30          	sub    $0x30,%rsp
+    1897:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    189a:	bf 00 10 00 00       	mov    $0x1000,%edi
+    189f:	e8 e1 fe ff ff       	call   1785 <pagealloc>
+    18a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18a8:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    18ad:	75 0a                	jne    18b9 <refill+0x2a>
+    return -1;
+    18af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    18b4:	e9 da 00 00 00       	jmp    1993 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    18b9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    18c0:	00 
+    18c1:	e9 ba 00 00 00       	jmp    1980 <refill+0xf1>
+    b = (struct block *)(p + off);
+    18c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    18ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ce:	48 01 d0             	add    %rdx,%rax
+    18d1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    18d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18d8:	ba 20 00 00 00       	mov    $0x20,%edx
+    18dd:	89 c1                	mov    %eax,%ecx
+    18df:	48 d3 e2             	shl    %cl,%rdx
+    18e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e6:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    18e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18ec:	48 63 d0             	movslq %eax,%rdx
+    18ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18f3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    18f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18fa:	48 98                	cltq
+    18fc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1903:	00 
+    1904:	48 8d 05 d5 17 00 00 	lea    0x17d5(%rip),%rax        # 30e0 <freelist>
+    190b:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    190f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1913:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1917:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    191a:	48 98                	cltq
+    191c:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1923:	00 
+    1924:	48 8d 15 b5 17 00 00 	lea    0x17b5(%rip),%rdx        # 30e0 <freelist>
+    192b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    192f:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1933:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1936:	48 98                	cltq
+    1938:	48 83 c0 08          	add    $0x8,%rax
+    193c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1943:	00 
+    1944:	48 8d 05 f9 17 00 00 	lea    0x17f9(%rip),%rax        # 3144 <stats+0x4>
+    194b:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    194e:	8d 48 01             	lea    0x1(%rax),%ecx
+    1951:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1954:	48 98                	cltq
+    1956:	48 83 c0 08          	add    $0x8,%rax
+    195a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1961:	00 
+    1962:	48 8d 05 db 17 00 00 	lea    0x17db(%rip),%rax        # 3144 <stats+0x4>
+    1969:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    196c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    196f:	ba 20 00 00 00       	mov    $0x20,%edx
+    1974:	89 c1                	mov    %eax,%ecx
+    1976:	48 d3 e2             	shl    %cl,%rdx
+    1979:	48 89 d0             	mov    %rdx,%rax
+    197c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1980:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1987:	00 
+    1988:	0f 86 38 ff ff ff    	jbe    18c6 <refill+0x37>
+  }
+  return 0;
+    198e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1993:	c9                   	leave
+    1994:	c3                   	ret
+
+0000000000001995 <malloc>:
+
+void *malloc(uint nbytes) {
+    1995:	55                   	push   %rbp
+    1996:	48 89 e5             	mov    %rsp,%rbp
+    1999:	48 83 ec 30          	sub    $0x30,%rsp
+    199d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    19a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19a3:	48 83 c0 10          	add    $0x10,%rax
+    19a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    19ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    19b2:	eb 04                	jmp    19b8 <malloc+0x23>
+    19b4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    19b8:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    19bc:	7f 16                	jg     19d4 <malloc+0x3f>
+    19be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19c1:	ba 20 00 00 00       	mov    $0x20,%edx
+    19c6:	89 c1                	mov    %eax,%ecx
+    19c8:	48 d3 e2             	shl    %cl,%rdx
+    19cb:	48 89 d0             	mov    %rdx,%rax
+    19ce:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    19d2:	72 e0                	jb     19b4 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    19d4:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    19d8:	75 7d                	jne    1a57 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    19da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19de:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    19e4:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    19ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    19ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19f2:	48 89 c7             	mov    %rax,%rdi
+    19f5:	e8 8b fd ff ff       	call   1785 <pagealloc>
+    19fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    19fe:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1a03:	75 0a                	jne    1a0f <malloc+0x7a>
+      return 0;
+    1a05:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a0a:	e9 2c 01 00 00       	jmp    1b3b <malloc+0x1a6>
+    h->size = n;
+    1a0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a13:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a17:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1a1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a1e:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1a25:	00 
+    stats.inuse[LARGE]++;
+    1a26:	8b 05 34 17 00 00    	mov    0x1734(%rip),%eax        # 3160 <stats+0x20>
+    1a2c:	83 c0 01             	add    $0x1,%eax
+    1a2f:	89 05 2b 17 00 00    	mov    %eax,0x172b(%rip)        # 3160 <stats+0x20>
+    stats.large += n;
+    1a35:	48 8b 15 4c 17 00 00 	mov    0x174c(%rip),%rdx        # 3188 <stats+0x48>
+    1a3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a40:	48 01 d0             	add    %rdx,%rax
+    1a43:	48 89 05 3e 17 00 00 	mov    %rax,0x173e(%rip)        # 3188 <stats+0x48>
+    return h + 1;
+    1a4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a4e:	48 83 c0 10          	add    $0x10,%rax
+    1a52:	e9 e4 00 00 00       	jmp    1b3b <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1a57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a5a:	48 98                	cltq
+    1a5c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a63:	00 
+    1a64:	48 8d 05 75 16 00 00 	lea    0x1675(%rip),%rax        # 30e0 <freelist>
+    1a6b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a6f:	48 85 c0             	test   %rax,%rax
+    1a72:	75 18                	jne    1a8c <malloc+0xf7>
+    1a74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a77:	89 c7                	mov    %eax,%edi
+    1a79:	e8 11 fe ff ff       	call   188f <refill>
+    1a7e:	85 c0                	test   %eax,%eax
+    1a80:	79 0a                	jns    1a8c <malloc+0xf7>
+    return 0;
+    1a82:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a87:	e9 af 00 00 00       	jmp    1b3b <malloc+0x1a6>
+  b = freelist[c];
+    1a8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a8f:	48 98                	cltq
+    1a91:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a98:	00 
+    1a99:	48 8d 05 40 16 00 00 	lea    0x1640(%rip),%rax        # 30e0 <freelist>
+    1aa0:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1aa4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1aa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aac:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1ab0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ab3:	48 63 d2             	movslq %edx,%rdx
+    1ab6:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1abd:	00 
+    1abe:	48 8d 15 1b 16 00 00 	lea    0x161b(%rip),%rdx        # 30e0 <freelist>
+    1ac5:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1ac9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1acc:	48 98                	cltq
+    1ace:	48 83 c0 08          	add    $0x8,%rax
+    1ad2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ad9:	00 
+    1ada:	48 8d 05 63 16 00 00 	lea    0x1663(%rip),%rax        # 3144 <stats+0x4>
+    1ae1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ae4:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1ae7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aea:	48 98                	cltq
+    1aec:	48 83 c0 08          	add    $0x8,%rax
+    1af0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1af7:	00 
+    1af8:	48 8d 05 45 16 00 00 	lea    0x1645(%rip),%rax        # 3144 <stats+0x4>
+    1aff:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1b02:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b05:	48 98                	cltq
+    1b07:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b0e:	00 
+    1b0f:	48 8d 05 2a 16 00 00 	lea    0x162a(%rip),%rax        # 3140 <stats>
+    1b16:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b19:	8d 48 01             	lea    0x1(%rax),%ecx
+    1b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b1f:	48 98                	cltq
+    1b21:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b28:	00 
+    1b29:	48 8d 05 10 16 00 00 	lea    0x1610(%rip),%rax        # 3140 <stats>
+    1b30:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1b33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b37:	48 83 c0 10          	add    $0x10,%rax
+}
+    1b3b:	c9                   	leave
+    1b3c:	c3                   	ret
+
+0000000000001b3d <free>:
+
+void free(void *ap) {
+    1b3d:	55                   	push   %rbp
+    1b3e:	48 89 e5             	mov    %rsp,%rbp
+    1b41:	48 83 ec 18          	sub    $0x18,%rsp
+    1b45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1b49:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1b4e:	0f 84 03 01 00 00    	je     1c57 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1b54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b58:	48 83 e8 10          	sub    $0x10,%rax
+    1b5c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1b60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b64:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b68:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1b6c:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1b71:	75 42                	jne    1bb5 <free+0x78>
+    stats.inuse[LARGE]--;
+    1b73:	8b 05 e7 15 00 00    	mov    0x15e7(%rip),%eax        # 3160 <stats+0x20>
+    1b79:	83 e8 01             	sub    $0x1,%eax
+    1b7c:	89 05 de 15 00 00    	mov    %eax,0x15de(%rip)        # 3160 <stats+0x20>
+    stats.large -= b->h.size;
+    1b82:	48 8b 15 ff 15 00 00 	mov    0x15ff(%rip),%rdx        # 3188 <stats+0x48>
+    1b89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b8d:	48 8b 00             	mov    (%rax),%rax
+    1b90:	48 29 c2             	sub    %rax,%rdx
+    1b93:	48 89 15 ee 15 00 00 	mov    %rdx,0x15ee(%rip)        # 3188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1b9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b9e:	48 8b 10             	mov    (%rax),%rdx
+    1ba1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba5:	48 89 d6             	mov    %rdx,%rsi
+    1ba8:	48 89 c7             	mov    %rax,%rdi
+    1bab:	e8 ae fa ff ff       	call   165e <pagefree>
+    return;
+    1bb0:	e9 a3 00 00 00       	jmp    1c58 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1bb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bb9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1bc0:	00 
+    1bc1:	48 8d 05 18 15 00 00 	lea    0x1518(%rip),%rax        # 30e0 <freelist>
+    1bc8:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1bcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1bd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bd8:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1bdf:	00 
+    1be0:	48 8d 15 f9 14 00 00 	lea    0x14f9(%rip),%rdx        # 30e0 <freelist>
+    1be7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1beb:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1bef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bfa:	00 
+    1bfb:	48 8d 05 3e 15 00 00 	lea    0x153e(%rip),%rax        # 3140 <stats>
+    1c02:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c05:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1c08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c0c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c13:	00 
+    1c14:	48 8d 05 25 15 00 00 	lea    0x1525(%rip),%rax        # 3140 <stats>
+    1c1b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c22:	48 83 c0 08          	add    $0x8,%rax
+    1c26:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c2d:	00 
+    1c2e:	48 8d 05 0f 15 00 00 	lea    0x150f(%rip),%rax        # 3144 <stats+0x4>
+    1c35:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c38:	8d 48 01             	lea    0x1(%rax),%ecx
+    1c3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c3f:	48 83 c0 08          	add    $0x8,%rax
+    1c43:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c4a:	00 
+    1c4b:	48 8d 05 f2 14 00 00 	lea    0x14f2(%rip),%rax        # 3144 <stats+0x4>
+    1c52:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1c55:	eb 01                	jmp    1c58 <free+0x11b>
+    return;
+    1c57:	90                   	nop
+}
+    1c58:	c9                   	leave
+    1c59:	c3                   	ret
+
+0000000000001c5a <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1c5a:	55                   	push   %rbp
+    1c5b:	48 89 e5             	mov    %rsp,%rbp
+    1c5e:	48 83 ec 30          	sub    $0x30,%rsp
+    1c62:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1c65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c68:	48 8d 15 a1 02 00 00 	lea    0x2a1(%rip),%rdx        # 1f10 <benchreport+0x18e>
+    1c6f:	48 89 d6             	mov    %rdx,%rsi
+    1c72:	89 c7                	mov    %eax,%edi
+    1c74:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c79:	e8 37 e6 ff ff       	call   2b5 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c7e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1c85:	eb 67                	jmp    1cee <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1c87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c8a:	48 98                	cltq
+    1c8c:	48 83 c0 08          	add    $0x8,%rax
+    1c90:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c97:	00 
+    1c98:	48 8d 05 a5 14 00 00 	lea    0x14a5(%rip),%rax        # 3144 <stats+0x4>
+    1c9f:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1ca2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ca5:	48 98                	cltq
+    1ca7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cae:	00 
+    1caf:	48 8d 05 8a 14 00 00 	lea    0x148a(%rip),%rax        # 3140 <stats>
+    1cb6:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1cb9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1cbc:	ba 20 00 00 00       	mov    $0x20,%edx
+    1cc1:	89 c1                	mov    %eax,%ecx
+    1cc3:	48 d3 e2             	shl    %cl,%rdx
+    1cc6:	48 89 d0             	mov    %rdx,%rax
+    1cc9:	89 c1                	mov    %eax,%ecx
+    1ccb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1cce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cd1:	41 89 f9             	mov    %edi,%r9d
+    1cd4:	41 89 f0             	mov    %esi,%r8d
+    1cd7:	48 8d 35 49 02 00 00 	lea    0x249(%rip),%rsi        # 1f27 <benchreport+0x1a5>
+    1cde:	89 c7                	mov    %eax,%edi
+    1ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ce5:	e8 cb e5 ff ff       	call   2b5 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1cea:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1cee:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1cf2:	7e 93                	jle    1c87 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1cf4:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1cfb:	00 
+  for (r = runs; r; r = r->next)
+    1cfc:	48 8b 05 1d 14 00 00 	mov    0x141d(%rip),%rax        # 3120 <runs>
+    1d03:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d07:	eb 17                	jmp    1d20 <mallocstats+0xc6>
+    nfree += r->size;
+    1d09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d0d:	48 8b 00             	mov    (%rax),%rax
+    1d10:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d18:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1d1c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d20:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1d25:	75 e2                	jne    1d09 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1d27:	48 8b 05 62 14 00 00 	mov    0x1462(%rip),%rax        # 3190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d2e:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1d30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d34:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d38:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1d3a:	48 8b 05 47 14 00 00 	mov    0x1447(%rip),%rax        # 3188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d41:	89 c1                	mov    %eax,%ecx
+    1d43:	8b 15 17 14 00 00    	mov    0x1417(%rip),%edx        # 3160 <stats+0x20>
+    1d49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d4c:	41 89 f9             	mov    %edi,%r9d
+    1d4f:	41 89 f0             	mov    %esi,%r8d
+    1d52:	48 8d 35 df 01 00 00 	lea    0x1df(%rip),%rsi        # 1f38 <benchreport+0x1b6>
+    1d59:	89 c7                	mov    %eax,%edi
+    1d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d60:	e8 50 e5 ff ff       	call   2b5 <printf>
+}
+    1d65:	90                   	nop
+    1d66:	c9                   	leave
+    1d67:	c3                   	ret
+
+0000000000001d68 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1d68:	55                   	push   %rbp
+    1d69:	48 89 e5             	mov    %rsp,%rbp
+    1d6c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1d70:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1d74:	48 89 c7             	mov    %rax,%rdi
+    1d77:	e8 9a f7 ff ff       	call   1516 <cycles>
+  return t;
+    1d7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d80:	c9                   	leave
+    1d81:	c3                   	ret
+
+0000000000001d82 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1d82:	55                   	push   %rbp
+    1d83:	48 89 e5             	mov    %rsp,%rbp
+    1d86:	48 83 ec 30          	sub    $0x30,%rsp
+    1d8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d8e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d92:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1d95:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1d99:	0f 8e 24 01 00 00    	jle    1ec3 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1d9f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1da6:	e9 98 00 00 00       	jmp    1e43 <benchreport+0xc1>
+    x = t[i];
+    1dab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dae:	48 98                	cltq
+    1db0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1db7:	00 
+    1db8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dbc:	48 01 d0             	add    %rdx,%rax
+    1dbf:	48 8b 00             	mov    (%rax),%rax
+    1dc2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1dc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dc9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1dcc:	eb 33                	jmp    1e01 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1dce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1dd1:	48 98                	cltq
+    1dd3:	48 c1 e0 03          	shl    $0x3,%rax
+    1dd7:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ddb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ddf:	48 01 d0             	add    %rdx,%rax
+    1de2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1de5:	48 63 d2             	movslq %edx,%rdx
+    1de8:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1def:	00 
+    1df0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1df4:	48 01 ca             	add    %rcx,%rdx
+    1df7:	48 8b 00             	mov    (%rax),%rax
+    1dfa:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1dfd:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1e01:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1e05:	7e 1d                	jle    1e24 <benchreport+0xa2>
+    1e07:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e0a:	48 98                	cltq
+    1e0c:	48 c1 e0 03          	shl    $0x3,%rax
+    1e10:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e18:	48 01 d0             	add    %rdx,%rax
+    1e1b:	48 8b 00             	mov    (%rax),%rax
+    1e1e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1e22:	72 aa                	jb     1dce <benchreport+0x4c>
+    t[j] = x;
+    1e24:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e27:	48 98                	cltq
+    1e29:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e30:	00 
+    1e31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e35:	48 01 c2             	add    %rax,%rdx
+    1e38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e3c:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1e3f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1e43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e46:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1e49:	0f 8c 5c ff ff ff    	jl     1dab <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1e4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e52:	48 98                	cltq
+    1e54:	48 c1 e0 03          	shl    $0x3,%rax
+    1e58:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e60:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e63:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1e66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e69:	89 c2                	mov    %eax,%edx
+    1e6b:	c1 ea 1f             	shr    $0x1f,%edx
+    1e6e:	01 d0                	add    %edx,%eax
+    1e70:	d1 f8                	sar    %eax
+    1e72:	48 98                	cltq
+    1e74:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e7b:	00 
+    1e7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e80:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e83:	48 8b 38             	mov    (%rax),%rdi
+    1e86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e8a:	48 8b 30             	mov    (%rax),%rsi
+    1e8d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1e90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e94:	48 83 ec 08          	sub    $0x8,%rsp
+    1e98:	51                   	push   %rcx
+    1e99:	49 89 f9             	mov    %rdi,%r9
+    1e9c:	49 89 f0             	mov    %rsi,%r8
+    1e9f:	89 d1                	mov    %edx,%ecx
+    1ea1:	48 89 c2             	mov    %rax,%rdx
+    1ea4:	48 8d 05 cd 00 00 00 	lea    0xcd(%rip),%rax        # 1f78 <benchreport+0x1f6>
+    1eab:	48 89 c6             	mov    %rax,%rsi
+    1eae:	bf 01 00 00 00       	mov    $0x1,%edi
+    1eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1eb8:	e8 f8 e3 ff ff       	call   2b5 <printf>
+    1ebd:	48 83 c4 10          	add    $0x10,%rsp
+    1ec1:	eb 01                	jmp    1ec4 <benchreport+0x142>
+    return;
+    1ec3:	90                   	nop
+}
+    1ec4:	c9                   	leave
+    1ec5:	c3                   	ret
@@ -0,0 +1,3368 @@
+
+out/user/_kill:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char **argv) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+       b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (argc < 2) {
+       f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+      13:	7f 1e                	jg     33 <main+0x33>
+    printf(2, "usage: kill pid...\n");
+      15:	48 8d 05 2c 1e 00 00 	lea    0x1e2c(%rip),%rax        # 1e48 <benchreport+0x14a>
+      1c:	48 89 c6             	mov    %rax,%rsi
+      1f:	bf 02 00 00 00       	mov    $0x2,%edi
+      24:	b8 00 00 00 00       	mov    $0x0,%eax
+      29:	e8 03 02 00 00       	call   231 <printf>
+    exit();
+      2e:	e8 2e 08 00 00       	call   861 <exit>
+  }
+  for (i = 1; i < argc; i++)
+      33:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      3a:	eb 2a                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+      3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      3f:	48 98                	cltq
+      41:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      48:	00 
+      49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      4d:	48 01 d0             	add    %rdx,%rax
+      50:	48 8b 00             	mov    (%rax),%rax
+      53:	48 89 c7             	mov    %rax,%rdi
+      56:	e8 70 0d 00 00       	call   dcb <atoi>
+      5b:	89 c7                	mov    %eax,%edi
+      5d:	e8 c5 12 00 00       	call   1327 <kill>
+  for (i = 1; i < argc; i++)
+      62:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      69:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+      6c:	7c ce                	jl     3c <main+0x3c>
+  exit();
+      6e:	e8 ee 07 00 00       	call   861 <exit>
+
+0000000000000073 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      73:	55                   	push   %rbp
+      74:	48 89 e5             	mov    %rsp,%rbp
+      77:	48 83 ec 10          	sub    $0x10,%rsp
+      7b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+      7e:	89 f0                	mov    %esi,%eax
+      80:	88 45 f8             	mov    %al,-0x8(%rbp)
+      83:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+      87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8a:	89 d6                	mov    %edx,%esi
+      8c:	89 c7                	mov    %eax,%edi
+      8e:	e8 eb 06 00 00       	call   77e <bputc>
+      93:	90                   	nop
+      94:	c9                   	leave
+      95:	c3                   	ret
+
+0000000000000096 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+      96:	55                   	push   %rbp
+      97:	48 89 e5             	mov    %rsp,%rbp
+      9a:	48 83 ec 50          	sub    $0x50,%rsp
+      9e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+      a1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+      a5:	89 55 c8             	mov    %edx,-0x38(%rbp)
+      a8:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+      ab:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      af:	74 21                	je     d2 <printint64+0x3c>
+      b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      b5:	48 c1 e8 3f          	shr    $0x3f,%rax
+      b9:	0f b6 c0             	movzbl %al,%eax
+      bc:	89 45 bc             	mov    %eax,-0x44(%rbp)
+      bf:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      c3:	74 0d                	je     d2 <printint64+0x3c>
+    x = -xx;
+      c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      c9:	48 f7 d8             	neg    %rax
+      cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      d0:	eb 08                	jmp    da <printint64+0x44>
+  else
+    x = xx;
+      d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+      da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+      e1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+      e4:	48 63 c8             	movslq %eax,%rcx
+      e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      eb:	ba 00 00 00 00       	mov    $0x0,%edx
+      f0:	48 f7 f1             	div    %rcx
+      f3:	48 89 d1             	mov    %rdx,%rcx
+      f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      f9:	8d 50 01             	lea    0x1(%rax),%edx
+      fc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+      ff:	48 8d 15 fa 2e 00 00 	lea    0x2efa(%rip),%rdx        # 3000 <digits.1>
+     106:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     10a:	48 98                	cltq
+     10c:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     110:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     113:	48 63 f0             	movslq %eax,%rsi
+     116:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     11a:	ba 00 00 00 00       	mov    $0x0,%edx
+     11f:	48 f7 f6             	div    %rsi
+     122:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     126:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     12b:	75 b4                	jne    e1 <printint64+0x4b>
+
+  if (sgn)
+     12d:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     131:	74 2b                	je     15e <printint64+0xc8>
+    buf[i++] = '-';
+     133:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     136:	8d 50 01             	lea    0x1(%rax),%edx
+     139:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     13c:	48 98                	cltq
+     13e:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     143:	eb 19                	jmp    15e <printint64+0xc8>
+    putc(fd, buf[i]);
+     145:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     148:	48 98                	cltq
+     14a:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     14f:	0f be d0             	movsbl %al,%edx
+     152:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     155:	89 d6                	mov    %edx,%esi
+     157:	89 c7                	mov    %eax,%edi
+     159:	e8 15 ff ff ff       	call   73 <putc>
+  while (--i >= 0)
+     15e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     162:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     166:	79 dd                	jns    145 <printint64+0xaf>
+}
+     168:	90                   	nop
+     169:	90                   	nop
+     16a:	c9                   	leave
+     16b:	c3                   	ret
+
+000000000000016c <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     16c:	55                   	push   %rbp
+     16d:	48 89 e5             	mov    %rsp,%rbp
+     170:	48 83 ec 30          	sub    $0x30,%rsp
+     174:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     177:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     17a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     17d:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     180:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     187:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     18b:	74 17                	je     1a4 <printint+0x38>
+     18d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     191:	79 11                	jns    1a4 <printint+0x38>
+    neg = 1;
+     193:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     19a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     19d:	f7 d8                	neg    %eax
+     19f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1a2:	eb 06                	jmp    1aa <printint+0x3e>
+  } else {
+    x = xx;
+     1a4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1a7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     1aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1b1:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     1b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1b7:	ba 00 00 00 00       	mov    $0x0,%edx
+     1bc:	f7 f1                	div    %ecx
+     1be:	89 d1                	mov    %edx,%ecx
+     1c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1c3:	8d 50 01             	lea    0x1(%rax),%edx
+     1c6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1c9:	89 c9                	mov    %ecx,%ecx
+     1cb:	48 8d 15 4e 2e 00 00 	lea    0x2e4e(%rip),%rdx        # 3020 <digits.0>
+     1d2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     1d6:	48 98                	cltq
+     1d8:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     1dc:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     1df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1e2:	ba 00 00 00 00       	mov    $0x0,%edx
+     1e7:	f7 f6                	div    %esi
+     1e9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     1f0:	75 bf                	jne    1b1 <printint+0x45>
+  if (neg)
+     1f2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     1f6:	74 2b                	je     223 <printint+0xb7>
+    buf[i++] = '-';
+     1f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1fb:	8d 50 01             	lea    0x1(%rax),%edx
+     1fe:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     201:	48 98                	cltq
+     203:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     208:	eb 19                	jmp    223 <printint+0xb7>
+    putc(fd, buf[i]);
+     20a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     20d:	48 98                	cltq
+     20f:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     214:	0f be d0             	movsbl %al,%edx
+     217:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     21a:	89 d6                	mov    %edx,%esi
+     21c:	89 c7                	mov    %eax,%edi
+     21e:	e8 50 fe ff ff       	call   73 <putc>
+  while (--i >= 0)
+     223:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     227:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     22b:	79 dd                	jns    20a <printint+0x9e>
+}
+     22d:	90                   	nop
+     22e:	90                   	nop
+     22f:	c9                   	leave
+     230:	c3                   	ret
+
+0000000000000231 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     231:	55                   	push   %rbp
+     232:	48 89 e5             	mov    %rsp,%rbp
+     235:	48 83 ec 70          	sub    $0x70,%rsp
+     239:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     23c:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     240:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     244:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     248:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     24c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     250:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     257:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     25b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     25f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     263:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     267:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     26e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     275:	e9 67 02 00 00       	jmp    4e1 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     27a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     27d:	48 63 d0             	movslq %eax,%rdx
+     280:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     284:	48 01 d0             	add    %rdx,%rax
+     287:	0f b6 00             	movzbl (%rax),%eax
+     28a:	0f be c0             	movsbl %al,%eax
+     28d:	25 ff 00 00 00       	and    $0xff,%eax
+     292:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     295:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     299:	75 30                	jne    2cb <printf+0x9a>
+      if (c == '%') {
+     29b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     29f:	75 13                	jne    2b4 <printf+0x83>
+        state = '%';
+     2a1:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     2a8:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     2af:	e9 29 02 00 00       	jmp    4dd <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     2b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     2b7:	0f be d0             	movsbl %al,%edx
+     2ba:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     2bd:	89 d6                	mov    %edx,%esi
+     2bf:	89 c7                	mov    %eax,%edi
+     2c1:	e8 ad fd ff ff       	call   73 <putc>
+     2c6:	e9 12 02 00 00       	jmp    4dd <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     2cb:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     2cf:	0f 85 08 02 00 00    	jne    4dd <printf+0x2ac>
+      if (c == 'l') {
+     2d5:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     2d9:	75 0c                	jne    2e7 <printf+0xb6>
+        lflag = 1;
+     2db:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     2e2:	e9 f6 01 00 00       	jmp    4dd <printf+0x2ac>
+      } else if (c == 'd') {
+     2e7:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     2eb:	0f 85 93 00 00 00    	jne    384 <printf+0x153>
+        if (lflag == 1)
+     2f1:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     2f5:	75 47                	jne    33e <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     2f7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     2fa:	83 f8 2f             	cmp    $0x2f,%eax
+     2fd:	77 17                	ja     316 <printf+0xe5>
+     2ff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     303:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     306:	89 d2                	mov    %edx,%edx
+     308:	48 01 d0             	add    %rdx,%rax
+     30b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     30e:	83 c2 08             	add    $0x8,%edx
+     311:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     314:	eb 0c                	jmp    322 <printf+0xf1>
+     316:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     31a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     31e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     322:	48 8b 30             	mov    (%rax),%rsi
+     325:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     328:	b9 01 00 00 00       	mov    $0x1,%ecx
+     32d:	ba 0a 00 00 00       	mov    $0xa,%edx
+     332:	89 c7                	mov    %eax,%edi
+     334:	e8 5d fd ff ff       	call   96 <printint64>
+     339:	e9 98 01 00 00       	jmp    4d6 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     33e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     341:	83 f8 2f             	cmp    $0x2f,%eax
+     344:	77 17                	ja     35d <printf+0x12c>
+     346:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     34a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     34d:	89 d2                	mov    %edx,%edx
+     34f:	48 01 d0             	add    %rdx,%rax
+     352:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     355:	83 c2 08             	add    $0x8,%edx
+     358:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     35b:	eb 0c                	jmp    369 <printf+0x138>
+     35d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     361:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     365:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     369:	8b 30                	mov    (%rax),%esi
+     36b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     36e:	b9 01 00 00 00       	mov    $0x1,%ecx
+     373:	ba 0a 00 00 00       	mov    $0xa,%edx
+     378:	89 c7                	mov    %eax,%edi
+     37a:	e8 ed fd ff ff       	call   16c <printint>
+     37f:	e9 52 01 00 00       	jmp    4d6 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     384:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     388:	74 0a                	je     394 <printf+0x163>
+     38a:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     38e:	0f 85 93 00 00 00    	jne    427 <printf+0x1f6>
+        if (lflag == 1)
+     394:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     398:	75 47                	jne    3e1 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     39a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     39d:	83 f8 2f             	cmp    $0x2f,%eax
+     3a0:	77 17                	ja     3b9 <printf+0x188>
+     3a2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3a9:	89 d2                	mov    %edx,%edx
+     3ab:	48 01 d0             	add    %rdx,%rax
+     3ae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3b1:	83 c2 08             	add    $0x8,%edx
+     3b4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3b7:	eb 0c                	jmp    3c5 <printf+0x194>
+     3b9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3bd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3c1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3c5:	48 8b 30             	mov    (%rax),%rsi
+     3c8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+     3d0:	ba 10 00 00 00       	mov    $0x10,%edx
+     3d5:	89 c7                	mov    %eax,%edi
+     3d7:	e8 ba fc ff ff       	call   96 <printint64>
+        if (lflag == 1)
+     3dc:	e9 f5 00 00 00       	jmp    4d6 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     3e1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3e4:	83 f8 2f             	cmp    $0x2f,%eax
+     3e7:	77 17                	ja     400 <printf+0x1cf>
+     3e9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3ed:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3f0:	89 d2                	mov    %edx,%edx
+     3f2:	48 01 d0             	add    %rdx,%rax
+     3f5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3f8:	83 c2 08             	add    $0x8,%edx
+     3fb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3fe:	eb 0c                	jmp    40c <printf+0x1db>
+     400:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     404:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     408:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     40c:	8b 30                	mov    (%rax),%esi
+     40e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     411:	b9 00 00 00 00       	mov    $0x0,%ecx
+     416:	ba 10 00 00 00       	mov    $0x10,%edx
+     41b:	89 c7                	mov    %eax,%edi
+     41d:	e8 4a fd ff ff       	call   16c <printint>
+        if (lflag == 1)
+     422:	e9 af 00 00 00       	jmp    4d6 <printf+0x2a5>
+      } else if (c == 's') {
+     427:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     42b:	75 6e                	jne    49b <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     42d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     430:	83 f8 2f             	cmp    $0x2f,%eax
+     433:	77 17                	ja     44c <printf+0x21b>
+     435:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     439:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     43c:	89 d2                	mov    %edx,%edx
+     43e:	48 01 d0             	add    %rdx,%rax
+     441:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     444:	83 c2 08             	add    $0x8,%edx
+     447:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     44a:	eb 0c                	jmp    458 <printf+0x227>
+     44c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     450:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     454:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     458:	48 8b 00             	mov    (%rax),%rax
+     45b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     45f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     464:	75 28                	jne    48e <printf+0x25d>
+          s = "(null)";
+     466:	48 8d 05 ef 19 00 00 	lea    0x19ef(%rip),%rax        # 1e5c <benchreport+0x15e>
+     46d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     471:	eb 1b                	jmp    48e <printf+0x25d>
+          putc(fd, *s);
+     473:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     477:	0f b6 00             	movzbl (%rax),%eax
+     47a:	0f be d0             	movsbl %al,%edx
+     47d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     480:	89 d6                	mov    %edx,%esi
+     482:	89 c7                	mov    %eax,%edi
+     484:	e8 ea fb ff ff       	call   73 <putc>
+        for (; *s; s++)
+     489:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     48e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     492:	0f b6 00             	movzbl (%rax),%eax
+     495:	84 c0                	test   %al,%al
+     497:	75 da                	jne    473 <printf+0x242>
+     499:	eb 3b                	jmp    4d6 <printf+0x2a5>
+      } else if (c == '%') {
+     49b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     49f:	75 14                	jne    4b5 <printf+0x284>
+        putc(fd, c);
+     4a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4a4:	0f be d0             	movsbl %al,%edx
+     4a7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4aa:	89 d6                	mov    %edx,%esi
+     4ac:	89 c7                	mov    %eax,%edi
+     4ae:	e8 c0 fb ff ff       	call   73 <putc>
+     4b3:	eb 21                	jmp    4d6 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     4b5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4b8:	be 25 00 00 00       	mov    $0x25,%esi
+     4bd:	89 c7                	mov    %eax,%edi
+     4bf:	e8 af fb ff ff       	call   73 <putc>
+        putc(fd, c);
+     4c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4c7:	0f be d0             	movsbl %al,%edx
+     4ca:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4cd:	89 d6                	mov    %edx,%esi
+     4cf:	89 c7                	mov    %eax,%edi
+     4d1:	e8 9d fb ff ff       	call   73 <putc>
+      }
+      state = 0;
+     4d6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     4dd:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     4e1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     4e4:	48 63 d0             	movslq %eax,%rdx
+     4e7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     4eb:	48 01 d0             	add    %rdx,%rax
+     4ee:	0f b6 00             	movzbl (%rax),%eax
+     4f1:	84 c0                	test   %al,%al
+     4f3:	0f 85 81 fd ff ff    	jne    27a <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     4f9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4fc:	89 c7                	mov    %eax,%edi
+     4fe:	e8 ee 02 00 00       	call   7f1 <bflushtty>
+}
+     503:	90                   	nop
+     504:	c9                   	leave
+     505:	c3                   	ret
+
+0000000000000506 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     506:	55                   	push   %rbp
+     507:	48 89 e5             	mov    %rsp,%rbp
+     50a:	48 83 ec 30          	sub    $0x30,%rsp
+     50e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     511:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     515:	78 06                	js     51d <getbuf+0x17>
+     517:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     51b:	7e 0a                	jle    527 <getbuf+0x21>
+    return 0;
+     51d:	b8 00 00 00 00       	mov    $0x0,%eax
+     522:	e9 94 00 00 00       	jmp    5bb <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     527:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     52a:	48 98                	cltq
+     52c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     533:	00 
+     534:	48 8d 05 05 2b 00 00 	lea    0x2b05(%rip),%rax        # 3040 <obufs>
+     53b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     53f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     543:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     548:	75 6d                	jne    5b7 <getbuf+0xb1>
+     54a:	bf 08 02 00 00       	mov    $0x208,%edi
+     54f:	e8 bd 13 00 00       	call   1911 <malloc>
+     554:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     558:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     55d:	74 58                	je     5b7 <getbuf+0xb1>
+    b->n = 0;
+     55f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     563:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     569:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     56d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     570:	48 89 d6             	mov    %rdx,%rsi
+     573:	89 c7                	mov    %eax,%edi
+     575:	e8 e4 0d 00 00       	call   135e <fstat>
+     57a:	85 c0                	test   %eax,%eax
+     57c:	75 11                	jne    58f <getbuf+0x89>
+     57e:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     582:	66 83 f8 03          	cmp    $0x3,%ax
+     586:	75 07                	jne    58f <getbuf+0x89>
+     588:	ba 01 00 00 00       	mov    $0x1,%edx
+     58d:	eb 05                	jmp    594 <getbuf+0x8e>
+     58f:	ba 00 00 00 00       	mov    $0x0,%edx
+     594:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     598:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     59b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     59e:	48 98                	cltq
+     5a0:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     5a7:	00 
+     5a8:	48 8d 15 91 2a 00 00 	lea    0x2a91(%rip),%rdx        # 3040 <obufs>
+     5af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5b3:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     5b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5bb:	c9                   	leave
+     5bc:	c3                   	ret
+
+00000000000005bd <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     5bd:	55                   	push   %rbp
+     5be:	48 89 e5             	mov    %rsp,%rbp
+     5c1:	48 83 ec 20          	sub    $0x20,%rsp
+     5c5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     5c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     5cc:	78 33                	js     601 <bflush+0x44>
+     5ce:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     5d2:	7f 2d                	jg     601 <bflush+0x44>
+     5d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     5d7:	48 98                	cltq
+     5d9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     5e0:	00 
+     5e1:	48 8d 05 58 2a 00 00 	lea    0x2a58(%rip),%rax        # 3040 <obufs>
+     5e8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     5ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     5f0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     5f5:	74 0a                	je     601 <bflush+0x44>
+     5f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5fb:	8b 00                	mov    (%rax),%eax
+     5fd:	85 c0                	test   %eax,%eax
+     5ff:	75 07                	jne    608 <bflush+0x4b>
+    return 0;
+     601:	b8 00 00 00 00       	mov    $0x0,%eax
+     606:	eb 3c                	jmp    644 <bflush+0x87>
+  n = b->n;
+     608:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     60c:	8b 00                	mov    (%rax),%eax
+     60e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     611:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     615:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     61b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     61f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     623:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     626:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     629:	48 89 ce             	mov    %rcx,%rsi
+     62c:	89 c7                	mov    %eax,%edi
+     62e:	e8 de 0c 00 00       	call   1311 <write>
+     633:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     636:	75 07                	jne    63f <bflush+0x82>
+     638:	b8 00 00 00 00       	mov    $0x0,%eax
+     63d:	eb 05                	jmp    644 <bflush+0x87>
+     63f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     644:	c9                   	leave
+     645:	c3                   	ret
+
+0000000000000646 <bflushall>:
+
+void bflushall(void) {
+     646:	55                   	push   %rbp
+     647:	48 89 e5             	mov    %rsp,%rbp
+     64a:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     64e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     655:	eb 0e                	jmp    665 <bflushall+0x1f>
+    bflush(fd);
+     657:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     65a:	89 c7                	mov    %eax,%edi
+     65c:	e8 5c ff ff ff       	call   5bd <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     661:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     665:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     669:	7e ec                	jle    657 <bflushall+0x11>
+}
+     66b:	90                   	nop
+     66c:	90                   	nop
+     66d:	c9                   	leave
+     66e:	c3                   	ret
+
+000000000000066f <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     66f:	55                   	push   %rbp
+     670:	48 89 e5             	mov    %rsp,%rbp
+     673:	48 83 ec 30          	sub    $0x30,%rsp
+     677:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     67a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     67e:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     681:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     684:	89 c7                	mov    %eax,%edi
+     686:	e8 7b fe ff ff       	call   506 <getbuf>
+     68b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     68f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     694:	75 19                	jne    6af <bwrite+0x40>
+    return write(fd, s, n);
+     696:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     699:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     69d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6a0:	48 89 ce             	mov    %rcx,%rsi
+     6a3:	89 c7                	mov    %eax,%edi
+     6a5:	e8 67 0c 00 00       	call   1311 <write>
+     6aa:	e9 cd 00 00 00       	jmp    77c <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     6af:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6b6:	e9 92 00 00 00       	jmp    74d <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     6bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6bf:	8b 00                	mov    (%rax),%eax
+     6c1:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6c6:	75 18                	jne    6e0 <bwrite+0x71>
+     6c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6cb:	89 c7                	mov    %eax,%edi
+     6cd:	e8 eb fe ff ff       	call   5bd <bflush>
+     6d2:	85 c0                	test   %eax,%eax
+     6d4:	79 0a                	jns    6e0 <bwrite+0x71>
+      return -1;
+     6d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6db:	e9 9c 00 00 00       	jmp    77c <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     6e0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6e3:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     6e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     6e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6ed:	8b 00                	mov    (%rax),%eax
+     6ef:	ba 00 02 00 00       	mov    $0x200,%edx
+     6f4:	29 c2                	sub    %eax,%edx
+     6f6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     6f9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     6fc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     6ff:	39 c2                	cmp    %eax,%edx
+     701:	0f 4e c2             	cmovle %edx,%eax
+     704:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     707:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     70a:	48 63 d0             	movslq %eax,%rdx
+     70d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     711:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     715:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     719:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     71d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     721:	8b 00                	mov    (%rax),%eax
+     723:	48 98                	cltq
+     725:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     729:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     72c:	89 c2                	mov    %eax,%edx
+     72e:	48 89 cf             	mov    %rcx,%rdi
+     731:	e8 e9 06 00 00       	call   e1f <memmove>
+    b->n += m;
+     736:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     73a:	8b 10                	mov    (%rax),%edx
+     73c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     73f:	01 c2                	add    %eax,%edx
+     741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     745:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     747:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     74a:	01 45 fc             	add    %eax,-0x4(%rbp)
+     74d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     750:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     753:	0f 8c 62 ff ff ff    	jl     6bb <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     75d:	8b 40 04             	mov    0x4(%rax),%eax
+     760:	85 c0                	test   %eax,%eax
+     762:	74 15                	je     779 <bwrite+0x10a>
+     764:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     767:	89 c7                	mov    %eax,%edi
+     769:	e8 4f fe ff ff       	call   5bd <bflush>
+     76e:	85 c0                	test   %eax,%eax
+     770:	79 07                	jns    779 <bwrite+0x10a>
+    return -1;
+     772:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     777:	eb 03                	jmp    77c <bwrite+0x10d>
+  return n;
+     779:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     77c:	c9                   	leave
+     77d:	c3                   	ret
+
+000000000000077e <bputc>:
+
+void bputc(int fd, char c) {
+     77e:	55                   	push   %rbp
+     77f:	48 89 e5             	mov    %rsp,%rbp
+     782:	48 83 ec 20          	sub    $0x20,%rsp
+     786:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     789:	89 f0                	mov    %esi,%eax
+     78b:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     78e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     791:	89 c7                	mov    %eax,%edi
+     793:	e8 6e fd ff ff       	call   506 <getbuf>
+     798:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     79c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     7a1:	75 18                	jne    7bb <bputc+0x3d>
+    write(fd, &c, 1);
+     7a3:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     7a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7aa:	ba 01 00 00 00       	mov    $0x1,%edx
+     7af:	48 89 ce             	mov    %rcx,%rsi
+     7b2:	89 c7                	mov    %eax,%edi
+     7b4:	e8 58 0b 00 00       	call   1311 <write>
+    return;
+     7b9:	eb 34                	jmp    7ef <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     7bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7bf:	8b 00                	mov    (%rax),%eax
+     7c1:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7c6:	75 0a                	jne    7d2 <bputc+0x54>
+    bflush(fd);
+     7c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7cb:	89 c7                	mov    %eax,%edi
+     7cd:	e8 eb fd ff ff       	call   5bd <bflush>
+  b->data[b->n++] = c;
+     7d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7d6:	8b 00                	mov    (%rax),%eax
+     7d8:	8d 48 01             	lea    0x1(%rax),%ecx
+     7db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     7df:	89 0a                	mov    %ecx,(%rdx)
+     7e1:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     7e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     7e9:	48 98                	cltq
+     7eb:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     7ef:	c9                   	leave
+     7f0:	c3                   	ret
+
+00000000000007f1 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     7f1:	55                   	push   %rbp
+     7f2:	48 89 e5             	mov    %rsp,%rbp
+     7f5:	48 83 ec 10          	sub    $0x10,%rsp
+     7f9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     7fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     800:	78 4c                	js     84e <bflushtty+0x5d>
+     802:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     806:	7f 46                	jg     84e <bflushtty+0x5d>
+     808:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     80b:	48 98                	cltq
+     80d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     814:	00 
+     815:	48 8d 05 24 28 00 00 	lea    0x2824(%rip),%rax        # 3040 <obufs>
+     81c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     820:	48 85 c0             	test   %rax,%rax
+     823:	74 29                	je     84e <bflushtty+0x5d>
+     825:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     828:	48 98                	cltq
+     82a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     831:	00 
+     832:	48 8d 05 07 28 00 00 	lea    0x2807(%rip),%rax        # 3040 <obufs>
+     839:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     83d:	8b 40 04             	mov    0x4(%rax),%eax
+     840:	85 c0                	test   %eax,%eax
+     842:	74 0a                	je     84e <bflushtty+0x5d>
+    bflush(fd);
+     844:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     847:	89 c7                	mov    %eax,%edi
+     849:	e8 6f fd ff ff       	call   5bd <bflush>
+}
+     84e:	90                   	nop
+     84f:	c9                   	leave
+     850:	c3                   	ret
+
+0000000000000851 <fork>:
+
+int fork(void) {
+     851:	55                   	push   %rbp
+     852:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     855:	e8 ec fd ff ff       	call   646 <bflushall>
+  return _fork();
+     85a:	e8 7b 0a 00 00       	call   12da <_fork>
+}
+     85f:	5d                   	pop    %rbp
+     860:	c3                   	ret
+
+0000000000000861 <exit>:
+
+noreturn void exit(void) {
+     861:	55                   	push   %rbp
+     862:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     865:	e8 dc fd ff ff       	call   646 <bflushall>
+  _exit();
+     86a:	e8 76 0a 00 00       	call   12e5 <_exit>
+
+000000000000086f <exec>:
+}
+
+int exec(char *path, char **argv) {
+     86f:	55                   	push   %rbp
+     870:	48 89 e5             	mov    %rsp,%rbp
+     873:	48 83 ec 10          	sub    $0x10,%rsp
+     877:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     87b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     87f:	e8 c2 fd ff ff       	call   646 <bflushall>
+  return _exec(path, argv);
+     884:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     88c:	48 89 d6             	mov    %rdx,%rsi
+     88f:	48 89 c7             	mov    %rax,%rdi
+     892:	e8 9b 0a 00 00       	call   1332 <_exec>
+}
+     897:	c9                   	leave
+     898:	c3                   	ret
+
+0000000000000899 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     899:	55                   	push   %rbp
+     89a:	48 89 e5             	mov    %rsp,%rbp
+     89d:	48 83 ec 20          	sub    $0x20,%rsp
+     8a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     8a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     8ad:	e8 94 fd ff ff       	call   646 <bflushall>
+  return _spawn(path, argv, fds);
+     8b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     8b6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8be:	48 89 ce             	mov    %rcx,%rsi
+     8c1:	48 89 c7             	mov    %rax,%rdi
+     8c4:	e8 2f 0b 00 00       	call   13f8 <_spawn>
+}
+     8c9:	c9                   	leave
+     8ca:	c3                   	ret
+
+00000000000008cb <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     8cb:	55                   	push   %rbp
+     8cc:	48 89 e5             	mov    %rsp,%rbp
+     8cf:	48 83 ec 10          	sub    $0x10,%rsp
+     8d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     8d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8da:	78 69                	js     945 <close+0x7a>
+     8dc:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     8e0:	7f 63                	jg     945 <close+0x7a>
+     8e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8e5:	48 98                	cltq
+     8e7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8ee:	00 
+     8ef:	48 8d 05 4a 27 00 00 	lea    0x274a(%rip),%rax        # 3040 <obufs>
+     8f6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8fa:	48 85 c0             	test   %rax,%rax
+     8fd:	74 46                	je     945 <close+0x7a>
+    bflush(fd);
+     8ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     902:	89 c7                	mov    %eax,%edi
+     904:	e8 b4 fc ff ff       	call   5bd <bflush>
+    free(obufs[fd]);
+     909:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     90c:	48 98                	cltq
+     90e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     915:	00 
+     916:	48 8d 05 23 27 00 00 	lea    0x2723(%rip),%rax        # 3040 <obufs>
+     91d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     921:	48 89 c7             	mov    %rax,%rdi
+     924:	e8 90 11 00 00       	call   1ab9 <free>
+    obufs[fd] = 0;
+     929:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     92c:	48 98                	cltq
+     92e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     935:	00 
+     936:	48 8d 05 03 27 00 00 	lea    0x2703(%rip),%rax        # 3040 <obufs>
+     93d:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     944:	00 
+  }
+  return _close(fd);
+     945:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     948:	89 c7                	mov    %eax,%edi
+     94a:	e8 cd 09 00 00       	call   131c <_close>
+}
+     94f:	c9                   	leave
+     950:	c3                   	ret
+
+0000000000000951 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     951:	55                   	push   %rbp
+     952:	48 89 e5             	mov    %rsp,%rbp
+     955:	53                   	push   %rbx
+     956:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     95a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     95e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     962:	48 8b 36             	mov    (%rsi),%rsi
+     965:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     969:	48 29 f7             	sub    %rsi,%rdi
+     96c:	48 89 f9             	mov    %rdi,%rcx
+     96f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     974:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     978:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     97c:	48 89 f0             	mov    %rsi,%rax
+     97f:	ba 00 00 00 00       	mov    $0x0,%edx
+     984:	48 89 df             	mov    %rbx,%rdi
+     987:	48 0f af f8          	imul   %rax,%rdi
+     98b:	48 89 d6             	mov    %rdx,%rsi
+     98e:	48 0f af f1          	imul   %rcx,%rsi
+     992:	48 01 fe             	add    %rdi,%rsi
+     995:	48 f7 e1             	mul    %rcx
+     998:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     99c:	48 89 ca             	mov    %rcx,%rdx
+     99f:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     9a4:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     9a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     9ac:	c9                   	leave
+     9ad:	c3                   	ret
+
+00000000000009ae <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     9ae:	55                   	push   %rbp
+     9af:	48 89 e5             	mov    %rsp,%rbp
+     9b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9b6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     9b9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     9bc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9c0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     9c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     9c6:	48 89 ce             	mov    %rcx,%rsi
+     9c9:	48 89 f7             	mov    %rsi,%rdi
+     9cc:	89 d1                	mov    %edx,%ecx
+     9ce:	fc                   	cld
+     9cf:	f3 aa                	rep stos %al,%es:(%rdi)
+     9d1:	89 ca                	mov    %ecx,%edx
+     9d3:	48 89 fe             	mov    %rdi,%rsi
+     9d6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     9da:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     9dd:	90                   	nop
+     9de:	5d                   	pop    %rbp
+     9df:	c3                   	ret
+
+00000000000009e0 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     9e0:	55                   	push   %rbp
+     9e1:	48 89 e5             	mov    %rsp,%rbp
+     9e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     9ec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     9f0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     9f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9fc:	48 89 ce             	mov    %rcx,%rsi
+     9ff:	48 89 f7             	mov    %rsi,%rdi
+     a02:	48 89 d1             	mov    %rdx,%rcx
+     a05:	fc                   	cld
+     a06:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     a09:	48 89 ca             	mov    %rcx,%rdx
+     a0c:	48 89 fe             	mov    %rdi,%rsi
+     a0f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a13:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a17:	90                   	nop
+     a18:	5d                   	pop    %rbp
+     a19:	c3                   	ret
+
+0000000000000a1a <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     a1a:	55                   	push   %rbp
+     a1b:	48 89 e5             	mov    %rsp,%rbp
+     a1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     a2a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a2e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a36:	48 89 cf             	mov    %rcx,%rdi
+     a39:	48 89 d6             	mov    %rdx,%rsi
+     a3c:	48 89 c1             	mov    %rax,%rcx
+     a3f:	fc                   	cld
+     a40:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     a42:	48 89 c8             	mov    %rcx,%rax
+     a45:	48 89 f2             	mov    %rsi,%rdx
+     a48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a4c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a50:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a54:	90                   	nop
+     a55:	5d                   	pop    %rbp
+     a56:	c3                   	ret
+
+0000000000000a57 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     a57:	55                   	push   %rbp
+     a58:	48 89 e5             	mov    %rsp,%rbp
+     a5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a5f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a63:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     a67:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a6b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a73:	48 89 cf             	mov    %rcx,%rdi
+     a76:	48 89 d6             	mov    %rdx,%rsi
+     a79:	48 89 c1             	mov    %rax,%rcx
+     a7c:	fc                   	cld
+     a7d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     a80:	48 89 c8             	mov    %rcx,%rax
+     a83:	48 89 f2             	mov    %rsi,%rdx
+     a86:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a8a:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a92:	90                   	nop
+     a93:	5d                   	pop    %rbp
+     a94:	c3                   	ret
+
+0000000000000a95 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     a95:	55                   	push   %rbp
+     a96:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     a99:	0f 31                	rdtsc
+     a9b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     a9e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     aa1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     aa4:	48 c1 e0 20          	shl    $0x20,%rax
+     aa8:	48 89 c2             	mov    %rax,%rdx
+     aab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aae:	48 09 d0             	or     %rdx,%rax
+}
+     ab1:	5d                   	pop    %rbp
+     ab2:	c3                   	ret
+
+0000000000000ab3 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     ab3:	55                   	push   %rbp
+     ab4:	48 89 e5             	mov    %rsp,%rbp
+     ab7:	53                   	push   %rbx
+     ab8:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     abb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     abf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     ac3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     ac7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     acb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ace:	0f a2                	cpuid
+     ad0:	89 de                	mov    %ebx,%esi
+     ad2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ad5:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     ad8:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     adb:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     ade:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     ae3:	74 09                	je     aee <cpuid+0x3b>
+    *eaxp = eax;
+     ae5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     ae9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     aec:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     aee:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     af3:	74 09                	je     afe <cpuid+0x4b>
+    *ebxp = ebx;
+     af5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     af9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     afc:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     afe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b03:	74 09                	je     b0e <cpuid+0x5b>
+    *ecxp = ecx;
+     b05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b09:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b0c:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     b0e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     b13:	74 09                	je     b1e <cpuid+0x6b>
+    *edxp = edx;
+     b15:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     b19:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     b1c:	89 10                	mov    %edx,(%rax)
+}
+     b1e:	90                   	nop
+     b1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b23:	c9                   	leave
+     b24:	c3                   	ret
+
+0000000000000b25 <strcpy>:
+char *strcpy(char *s, char *t) {
+     b25:	55                   	push   %rbp
+     b26:	48 89 e5             	mov    %rsp,%rbp
+     b29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b2d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     b31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     b39:	90                   	nop
+     b3a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b3e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     b42:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     b46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b4a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     b4e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     b52:	0f b6 12             	movzbl (%rdx),%edx
+     b55:	88 10                	mov    %dl,(%rax)
+     b57:	0f b6 00             	movzbl (%rax),%eax
+     b5a:	84 c0                	test   %al,%al
+     b5c:	75 dc                	jne    b3a <strcpy+0x15>
+  return os;
+     b5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b62:	5d                   	pop    %rbp
+     b63:	c3                   	ret
+
+0000000000000b64 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     b64:	55                   	push   %rbp
+     b65:	48 89 e5             	mov    %rsp,%rbp
+     b68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     b70:	eb 0a                	jmp    b7c <strcmp+0x18>
+    p++, q++;
+     b72:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     b77:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     b7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b80:	0f b6 00             	movzbl (%rax),%eax
+     b83:	84 c0                	test   %al,%al
+     b85:	74 12                	je     b99 <strcmp+0x35>
+     b87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b8b:	0f b6 10             	movzbl (%rax),%edx
+     b8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b92:	0f b6 00             	movzbl (%rax),%eax
+     b95:	38 c2                	cmp    %al,%dl
+     b97:	74 d9                	je     b72 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     b99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b9d:	0f b6 00             	movzbl (%rax),%eax
+     ba0:	0f b6 d0             	movzbl %al,%edx
+     ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ba7:	0f b6 00             	movzbl (%rax),%eax
+     baa:	0f b6 c0             	movzbl %al,%eax
+     bad:	29 c2                	sub    %eax,%edx
+     baf:	89 d0                	mov    %edx,%eax
+}
+     bb1:	5d                   	pop    %rbp
+     bb2:	c3                   	ret
+
+0000000000000bb3 <strlen>:
+uint strlen(char *s) {
+     bb3:	55                   	push   %rbp
+     bb4:	48 89 e5             	mov    %rsp,%rbp
+     bb7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     bbb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bc2:	eb 04                	jmp    bc8 <strlen+0x15>
+     bc4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     bc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bcb:	48 63 d0             	movslq %eax,%rdx
+     bce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bd2:	48 01 d0             	add    %rdx,%rax
+     bd5:	0f b6 00             	movzbl (%rax),%eax
+     bd8:	84 c0                	test   %al,%al
+     bda:	75 e8                	jne    bc4 <strlen+0x11>
+    ;
+  return n;
+     bdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     bdf:	5d                   	pop    %rbp
+     be0:	c3                   	ret
+
+0000000000000be1 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     be1:	55                   	push   %rbp
+     be2:	48 89 e5             	mov    %rsp,%rbp
+     be5:	53                   	push   %rbx
+     be6:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     bea:	8b 05 44 24 00 00    	mov    0x2444(%rip),%eax        # 3034 <erms>
+     bf0:	85 c0                	test   %eax,%eax
+     bf2:	79 53                	jns    c47 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     bf4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     bf8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     bfe:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c03:	ba 00 00 00 00       	mov    $0x0,%edx
+     c08:	48 89 c6             	mov    %rax,%rsi
+     c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+     c10:	e8 9e fe ff ff       	call   ab3 <cpuid>
+    ebx = 0;
+     c15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     c1c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c1f:	83 f8 06             	cmp    $0x6,%eax
+     c22:	76 14                	jbe    c38 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     c24:	b8 07 00 00 00       	mov    $0x7,%eax
+     c29:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c2e:	0f a2                	cpuid
+     c30:	89 d9                	mov    %ebx,%ecx
+     c32:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     c35:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     c38:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c3b:	c1 e8 09             	shr    $0x9,%eax
+     c3e:	83 e0 01             	and    $0x1,%eax
+     c41:	89 05 ed 23 00 00    	mov    %eax,0x23ed(%rip)        # 3034 <erms>
+  }
+  return erms;
+     c47:	8b 05 e7 23 00 00    	mov    0x23e7(%rip),%eax        # 3034 <erms>
+}
+     c4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c51:	c9                   	leave
+     c52:	c3                   	ret
+
+0000000000000c53 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     c53:	55                   	push   %rbp
+     c54:	48 89 e5             	mov    %rsp,%rbp
+     c57:	48 83 ec 10          	sub    $0x10,%rsp
+     c5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c5f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c62:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     c65:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     c69:	76 09                	jbe    c74 <memset+0x21>
+     c6b:	e8 71 ff ff ff       	call   be1 <haserms>
+     c70:	85 c0                	test   %eax,%eax
+     c72:	74 16                	je     c8a <memset+0x37>
+    stosb(dst, c, n);
+     c74:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c77:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c7e:	89 ce                	mov    %ecx,%esi
+     c80:	48 89 c7             	mov    %rax,%rdi
+     c83:	e8 26 fd ff ff       	call   9ae <stosb>
+     c88:	eb 58                	jmp    ce2 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     c8a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c8d:	c1 e8 03             	shr    $0x3,%eax
+     c90:	89 c6                	mov    %eax,%esi
+     c92:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c95:	48 98                	cltq
+     c97:	0f b6 c0             	movzbl %al,%eax
+     c9a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     ca1:	01 01 01 
+     ca4:	48 0f af c2          	imul   %rdx,%rax
+     ca8:	48 89 c1             	mov    %rax,%rcx
+     cab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     caf:	48 89 f2             	mov    %rsi,%rdx
+     cb2:	48 89 ce             	mov    %rcx,%rsi
+     cb5:	48 89 c7             	mov    %rax,%rdi
+     cb8:	e8 23 fd ff ff       	call   9e0 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     cbd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cc0:	83 e0 07             	and    $0x7,%eax
+     cc3:	89 c2                	mov    %eax,%edx
+     cc5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cc8:	83 e0 f8             	and    $0xfffffff8,%eax
+     ccb:	48 89 c1             	mov    %rax,%rcx
+     cce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd2:	48 01 c1             	add    %rax,%rcx
+     cd5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cd8:	89 c6                	mov    %eax,%esi
+     cda:	48 89 cf             	mov    %rcx,%rdi
+     cdd:	e8 cc fc ff ff       	call   9ae <stosb>
+  }
+  return dst;
+     ce2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     ce6:	c9                   	leave
+     ce7:	c3                   	ret
+
+0000000000000ce8 <strchr>:
+
+char *strchr(const char *s, char c) {
+     ce8:	55                   	push   %rbp
+     ce9:	48 89 e5             	mov    %rsp,%rbp
+     cec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cf0:	89 f0                	mov    %esi,%eax
+     cf2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     cf5:	eb 17                	jmp    d0e <strchr+0x26>
+    if (*s == c)
+     cf7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cfb:	0f b6 00             	movzbl (%rax),%eax
+     cfe:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     d01:	75 06                	jne    d09 <strchr+0x21>
+      return (char *)s;
+     d03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d07:	eb 15                	jmp    d1e <strchr+0x36>
+  for (; *s; s++)
+     d09:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d12:	0f b6 00             	movzbl (%rax),%eax
+     d15:	84 c0                	test   %al,%al
+     d17:	75 de                	jne    cf7 <strchr+0xf>
+  return 0;
+     d19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d1e:	5d                   	pop    %rbp
+     d1f:	c3                   	ret
+
+0000000000000d20 <gets>:
+
+char *gets(char *buf, int max) {
+     d20:	55                   	push   %rbp
+     d21:	48 89 e5             	mov    %rsp,%rbp
+     d24:	48 83 ec 20          	sub    $0x20,%rsp
+     d28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d2c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     d2f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d36:	eb 48                	jmp    d80 <gets+0x60>
+    cc = read(0, &c, 1);
+     d38:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d3c:	ba 01 00 00 00       	mov    $0x1,%edx
+     d41:	48 89 c6             	mov    %rax,%rsi
+     d44:	bf 00 00 00 00       	mov    $0x0,%edi
+     d49:	e8 b8 05 00 00       	call   1306 <read>
+     d4e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     d51:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d55:	7e 36                	jle    d8d <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d5a:	8d 50 01             	lea    0x1(%rax),%edx
+     d5d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d60:	48 63 d0             	movslq %eax,%rdx
+     d63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d67:	48 01 c2             	add    %rax,%rdx
+     d6a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d6e:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     d70:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d74:	3c 0a                	cmp    $0xa,%al
+     d76:	74 16                	je     d8e <gets+0x6e>
+     d78:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d7c:	3c 0d                	cmp    $0xd,%al
+     d7e:	74 0e                	je     d8e <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     d80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d83:	83 c0 01             	add    $0x1,%eax
+     d86:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     d89:	7f ad                	jg     d38 <gets+0x18>
+     d8b:	eb 01                	jmp    d8e <gets+0x6e>
+      break;
+     d8d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     d8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d91:	48 63 d0             	movslq %eax,%rdx
+     d94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d98:	48 01 d0             	add    %rdx,%rax
+     d9b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     d9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     da2:	c9                   	leave
+     da3:	c3                   	ret
+
+0000000000000da4 <stat>:
+
+int stat(char *n, struct stat *st) {
+     da4:	55                   	push   %rbp
+     da5:	48 89 e5             	mov    %rsp,%rbp
+     da8:	48 83 ec 10          	sub    $0x10,%rsp
+     dac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     db0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     db4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     db8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dbc:	48 89 c6             	mov    %rax,%rsi
+     dbf:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     dc4:	e8 58 07 00 00       	call   1521 <fstatat>
+}
+     dc9:	c9                   	leave
+     dca:	c3                   	ret
+
+0000000000000dcb <atoi>:
+
+int atoi(const char *s) {
+     dcb:	55                   	push   %rbp
+     dcc:	48 89 e5             	mov    %rsp,%rbp
+     dcf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     dd3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     dda:	eb 28                	jmp    e04 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     ddc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     ddf:	89 d0                	mov    %edx,%eax
+     de1:	c1 e0 02             	shl    $0x2,%eax
+     de4:	01 d0                	add    %edx,%eax
+     de6:	01 c0                	add    %eax,%eax
+     de8:	89 c1                	mov    %eax,%ecx
+     dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dee:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     df2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     df6:	0f b6 00             	movzbl (%rax),%eax
+     df9:	0f be c0             	movsbl %al,%eax
+     dfc:	01 c8                	add    %ecx,%eax
+     dfe:	83 e8 30             	sub    $0x30,%eax
+     e01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e08:	0f b6 00             	movzbl (%rax),%eax
+     e0b:	3c 2f                	cmp    $0x2f,%al
+     e0d:	7e 0b                	jle    e1a <atoi+0x4f>
+     e0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e13:	0f b6 00             	movzbl (%rax),%eax
+     e16:	3c 39                	cmp    $0x39,%al
+     e18:	7e c2                	jle    ddc <atoi+0x11>
+  return n;
+     e1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e1d:	5d                   	pop    %rbp
+     e1e:	c3                   	ret
+
+0000000000000e1f <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     e1f:	55                   	push   %rbp
+     e20:	48 89 e5             	mov    %rsp,%rbp
+     e23:	48 83 ec 28          	sub    $0x28,%rsp
+     e27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e2b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e2f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     e32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     e42:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e46:	7f 09                	jg     e51 <memmove+0x32>
+    return vdst;
+     e48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e4c:	e9 29 01 00 00       	jmp    f7a <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     e51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e55:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     e59:	0f 83 87 00 00 00    	jae    ee6 <memmove+0xc7>
+     e5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e62:	48 63 d0             	movslq %eax,%rdx
+     e65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e69:	48 01 d0             	add    %rdx,%rax
+     e6c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e70:	73 74                	jae    ee6 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     e72:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e75:	48 98                	cltq
+     e77:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     e7b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e7e:	48 98                	cltq
+     e80:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     e84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e8c:	48 09 d0             	or     %rdx,%rax
+     e8f:	83 e0 07             	and    $0x7,%eax
+     e92:	48 85 c0             	test   %rax,%rax
+     e95:	75 3d                	jne    ed4 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     e97:	eb 1c                	jmp    eb5 <memmove+0x96>
+        src -= 8;
+     e99:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     e9e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     ea3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea7:	48 8b 10             	mov    (%rax),%rdx
+     eaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eae:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     eb1:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     eb5:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     eb9:	7f de                	jg     e99 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     ebb:	eb 17                	jmp    ed4 <memmove+0xb5>
+      *--dst = *--src;
+     ebd:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     ec2:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     ec7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ecb:	0f b6 10             	movzbl (%rax),%edx
+     ece:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     ed4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ed7:	8d 50 ff             	lea    -0x1(%rax),%edx
+     eda:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     edd:	85 c0                	test   %eax,%eax
+     edf:	7f dc                	jg     ebd <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     ee1:	e9 90 00 00 00       	jmp    f76 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     ee6:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     eea:	7e 09                	jle    ef5 <memmove+0xd6>
+     eec:	e8 f0 fc ff ff       	call   be1 <haserms>
+     ef1:	85 c0                	test   %eax,%eax
+     ef3:	74 1b                	je     f10 <memmove+0xf1>
+    movsb(dst, src, n);
+     ef5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ef8:	48 63 d0             	movslq %eax,%rdx
+     efb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     eff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f03:	48 89 ce             	mov    %rcx,%rsi
+     f06:	48 89 c7             	mov    %rax,%rdi
+     f09:	e8 0c fb ff ff       	call   a1a <movsb>
+     f0e:	eb 66                	jmp    f76 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     f10:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f13:	8d 50 07             	lea    0x7(%rax),%edx
+     f16:	85 c0                	test   %eax,%eax
+     f18:	0f 48 c2             	cmovs  %edx,%eax
+     f1b:	c1 f8 03             	sar    $0x3,%eax
+     f1e:	48 63 d0             	movslq %eax,%rdx
+     f21:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f29:	48 89 ce             	mov    %rcx,%rsi
+     f2c:	48 89 c7             	mov    %rax,%rdi
+     f2f:	e8 23 fb ff ff       	call   a57 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     f34:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f37:	89 d0                	mov    %edx,%eax
+     f39:	c1 f8 1f             	sar    $0x1f,%eax
+     f3c:	c1 e8 1d             	shr    $0x1d,%eax
+     f3f:	01 c2                	add    %eax,%edx
+     f41:	83 e2 07             	and    $0x7,%edx
+     f44:	29 c2                	sub    %eax,%edx
+     f46:	89 d0                	mov    %edx,%eax
+     f48:	48 98                	cltq
+     f4a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f4d:	83 e2 f8             	and    $0xfffffff8,%edx
+     f50:	48 63 ca             	movslq %edx,%rcx
+     f53:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f57:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     f5b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f5e:	83 e2 f8             	and    $0xfffffff8,%edx
+     f61:	48 63 ca             	movslq %edx,%rcx
+     f64:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     f68:	48 01 d1             	add    %rdx,%rcx
+     f6b:	48 89 c2             	mov    %rax,%rdx
+     f6e:	48 89 cf             	mov    %rcx,%rdi
+     f71:	e8 a4 fa ff ff       	call   a1a <movsb>
+  }
+  return vdst;
+     f76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     f7a:	c9                   	leave
+     f7b:	c3                   	ret
+
+0000000000000f7c <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+     f7c:	55                   	push   %rbp
+     f7d:	48 89 e5             	mov    %rsp,%rbp
+     f80:	48 83 ec 20          	sub    $0x20,%rsp
+     f84:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     f87:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+     f8b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+     f92:	00 00 00 
+     f95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+     f99:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     f9d:	75 0d                	jne    fac <clock_gettime+0x30>
+     f9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fa3:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fa7:	48 85 c0             	test   %rax,%rax
+     faa:	75 13                	jne    fbf <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+     fac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     fb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fb3:	48 89 d6             	mov    %rdx,%rsi
+     fb6:	89 c7                	mov    %eax,%edi
+     fb8:	e8 e0 04 00 00       	call   149d <_clock_gettime>
+     fbd:	eb 7d                	jmp    103c <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+     fbf:	e8 d1 fa ff ff       	call   a95 <rdtsc>
+     fc4:	48 89 c2             	mov    %rax,%rdx
+     fc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fcb:	48 89 d6             	mov    %rdx,%rsi
+     fce:	48 89 c7             	mov    %rax,%rdi
+     fd1:	e8 7b f9 ff ff       	call   951 <clockns>
+     fd6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+     fda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fde:	48 c1 e8 09          	shr    $0x9,%rax
+     fe2:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+     fe9:	b8 44 00 
+     fec:	48 f7 e2             	mul    %rdx
+     fef:	48 89 d0             	mov    %rdx,%rax
+     ff2:	48 c1 e8 0b          	shr    $0xb,%rax
+     ff6:	48 89 c2             	mov    %rax,%rdx
+     ff9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     ffd:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1000:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1004:	48 89 c8             	mov    %rcx,%rax
+    1007:	48 c1 e8 09          	shr    $0x9,%rax
+    100b:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1012:	b8 44 00 
+    1015:	48 f7 e2             	mul    %rdx
+    1018:	48 89 d0             	mov    %rdx,%rax
+    101b:	48 c1 e8 0b          	shr    $0xb,%rax
+    101f:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1026:	48 89 c8             	mov    %rcx,%rax
+    1029:	48 29 d0             	sub    %rdx,%rax
+    102c:	48 89 c2             	mov    %rax,%rdx
+    102f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1033:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1037:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    103c:	c9                   	leave
+    103d:	c3                   	ret
+
+000000000000103e <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    103e:	55                   	push   %rbp
+    103f:	48 89 e5             	mov    %rsp,%rbp
+    1042:	48 83 ec 10          	sub    $0x10,%rsp
+    1046:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    104a:	eb 11                	jmp    105d <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    104c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1050:	be 02 00 00 00       	mov    $0x2,%esi
+    1055:	48 89 c7             	mov    %rax,%rdi
+    1058:	e8 6c 04 00 00       	call   14c9 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    105d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1061:	b8 02 00 00 00       	mov    $0x2,%eax
+    1066:	87 02                	xchg   %eax,(%rdx)
+    1068:	85 c0                	test   %eax,%eax
+    106a:	75 e0                	jne    104c <mutex_wait+0xe>
+}
+    106c:	90                   	nop
+    106d:	90                   	nop
+    106e:	c9                   	leave
+    106f:	c3                   	ret
+
+0000000000001070 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1070:	55                   	push   %rbp
+    1071:	48 89 e5             	mov    %rsp,%rbp
+    1074:	48 83 ec 20          	sub    $0x20,%rsp
+    1078:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    107c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1083:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1087:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    108b:	8b 02                	mov    (%rdx),%eax
+    108d:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1092:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1096:	89 c1                	mov    %eax,%ecx
+    1098:	0f 94 c0             	sete   %al
+    109b:	84 c0                	test   %al,%al
+    109d:	75 02                	jne    10a1 <mutex_lock+0x31>
+    109f:	89 0a                	mov    %ecx,(%rdx)
+    10a1:	83 f0 01             	xor    $0x1,%eax
+    10a4:	84 c0                	test   %al,%al
+    10a6:	74 0c                	je     10b4 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    10a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10ac:	48 89 c7             	mov    %rax,%rdi
+    10af:	e8 8a ff ff ff       	call   103e <mutex_wait>
+}
+    10b4:	90                   	nop
+    10b5:	c9                   	leave
+    10b6:	c3                   	ret
+
+00000000000010b7 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    10b7:	55                   	push   %rbp
+    10b8:	48 89 e5             	mov    %rsp,%rbp
+    10bb:	48 83 ec 10          	sub    $0x10,%rsp
+    10bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    10c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10c7:	ba 00 00 00 00       	mov    $0x0,%edx
+    10cc:	87 10                	xchg   %edx,(%rax)
+    10ce:	83 fa 02             	cmp    $0x2,%edx
+    10d1:	75 11                	jne    10e4 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    10d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d7:	be 01 00 00 00       	mov    $0x1,%esi
+    10dc:	48 89 c7             	mov    %rax,%rdi
+    10df:	e8 f0 03 00 00       	call   14d4 <futex_wake>
+}
+    10e4:	90                   	nop
+    10e5:	c9                   	leave
+    10e6:	c3                   	ret
+
+00000000000010e7 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    10e7:	55                   	push   %rbp
+    10e8:	48 89 e5             	mov    %rsp,%rbp
+    10eb:	48 83 ec 20          	sub    $0x20,%rsp
+    10ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    10f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    10f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10fb:	48 83 c0 04          	add    $0x4,%rax
+    10ff:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1103:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1107:	8b 00                	mov    (%rax),%eax
+    1109:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    110c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1110:	48 89 c7             	mov    %rax,%rdi
+    1113:	e8 9f ff ff ff       	call   10b7 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    111c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    111f:	89 d6                	mov    %edx,%esi
+    1121:	48 89 c7             	mov    %rax,%rdi
+    1124:	e8 a0 03 00 00       	call   14c9 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1129:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    112d:	48 83 c0 04          	add    $0x4,%rax
+    1131:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1135:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1139:	48 89 c7             	mov    %rax,%rdi
+    113c:	e8 fd fe ff ff       	call   103e <mutex_wait>
+}
+    1141:	90                   	nop
+    1142:	c9                   	leave
+    1143:	c3                   	ret
+
+0000000000001144 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1144:	55                   	push   %rbp
+    1145:	48 89 e5             	mov    %rsp,%rbp
+    1148:	48 83 ec 10          	sub    $0x10,%rsp
+    114c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1150:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1154:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1158:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    115c:	48 83 c0 04          	add    $0x4,%rax
+    1160:	8b 00                	mov    (%rax),%eax
+    1162:	85 c0                	test   %eax,%eax
+    1164:	7e 11                	jle    1177 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1166:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    116a:	be 01 00 00 00       	mov    $0x1,%esi
+    116f:	48 89 c7             	mov    %rax,%rdi
+    1172:	e8 5d 03 00 00       	call   14d4 <futex_wake>
+}
+    1177:	90                   	nop
+    1178:	c9                   	leave
+    1179:	c3                   	ret
+
+000000000000117a <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    117a:	55                   	push   %rbp
+    117b:	48 89 e5             	mov    %rsp,%rbp
+    117e:	48 83 ec 10          	sub    $0x10,%rsp
+    1182:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1186:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    118a:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    118e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1192:	48 83 c0 04          	add    $0x4,%rax
+    1196:	8b 00                	mov    (%rax),%eax
+    1198:	85 c0                	test   %eax,%eax
+    119a:	7e 11                	jle    11ad <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    119c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a0:	be 00 00 00 40       	mov    $0x40000000,%esi
+    11a5:	48 89 c7             	mov    %rax,%rdi
+    11a8:	e8 27 03 00 00       	call   14d4 <futex_wake>
+}
+    11ad:	90                   	nop
+    11ae:	c9                   	leave
+    11af:	c3                   	ret
+
+00000000000011b0 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    11b0:	55                   	push   %rbp
+    11b1:	48 89 e5             	mov    %rsp,%rbp
+    11b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11b8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    11bb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    11bf:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    11c3:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    11c7:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    11cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11cf:	8b 40 04             	mov    0x4(%rax),%eax
+    11d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    11d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11d9:	8b 00                	mov    (%rax),%eax
+    11db:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    11de:	29 c2                	sub    %eax,%edx
+    11e0:	83 fa 1f             	cmp    $0x1f,%edx
+    11e3:	76 07                	jbe    11ec <ring_push+0x3c>
+    return -1;
+    11e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11ea:	eb 7e                	jmp    126a <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    11ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11ef:	83 e0 1f             	and    $0x1f,%eax
+    11f2:	89 c2                	mov    %eax,%edx
+    11f4:	48 89 d0             	mov    %rdx,%rax
+    11f7:	48 01 c0             	add    %rax,%rax
+    11fa:	48 01 d0             	add    %rdx,%rax
+    11fd:	48 c1 e0 04          	shl    $0x4,%rax
+    1201:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1205:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1209:	48 01 d0             	add    %rdx,%rax
+    120c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1210:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1214:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1217:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1219:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    121d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1221:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1225:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1229:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    122d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1231:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1235:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1239:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    123d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1241:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1245:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1249:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    124d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1251:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1255:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1258:	8d 50 01             	lea    0x1(%rax),%edx
+    125b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    125f:	48 83 c0 04          	add    $0x4,%rax
+    1263:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1265:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    126a:	5d                   	pop    %rbp
+    126b:	c3                   	ret
+
+000000000000126c <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    126c:	55                   	push   %rbp
+    126d:	48 89 e5             	mov    %rsp,%rbp
+    1270:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1274:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1278:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    127c:	8b 40 08             	mov    0x8(%rax),%eax
+    127f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1282:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1286:	48 83 c0 0c          	add    $0xc,%rax
+    128a:	8b 00                	mov    (%rax),%eax
+    128c:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    128f:	75 07                	jne    1298 <ring_pop+0x2c>
+    return -1;
+    1291:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1296:	eb 40                	jmp    12d8 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1298:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    129b:	83 e0 1f             	and    $0x1f,%eax
+    129e:	89 c2                	mov    %eax,%edx
+    12a0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    12a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12a8:	89 d2                	mov    %edx,%edx
+    12aa:	48 83 c2 61          	add    $0x61,%rdx
+    12ae:	48 c1 e2 04          	shl    $0x4,%rdx
+    12b2:	48 01 d0             	add    %rdx,%rax
+    12b5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    12b9:	48 8b 00             	mov    (%rax),%rax
+    12bc:	48 89 01             	mov    %rax,(%rcx)
+    12bf:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    12c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12c6:	8d 50 01             	lea    0x1(%rax),%edx
+    12c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12cd:	48 83 c0 08          	add    $0x8,%rax
+    12d1:	89 10                	mov    %edx,(%rax)
+  return 0;
+    12d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12d8:	5d                   	pop    %rbp
+    12d9:	c3                   	ret
+
+00000000000012da <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    12da:	b8 01 00 00 00       	mov    $0x1,%eax
+    12df:	49 89 ca             	mov    %rcx,%r10
+    12e2:	0f 05                	syscall
+    12e4:	c3                   	ret
+
+00000000000012e5 <_exit>:
+SYSCALL_(exit)
+    12e5:	b8 02 00 00 00       	mov    $0x2,%eax
+    12ea:	49 89 ca             	mov    %rcx,%r10
+    12ed:	0f 05                	syscall
+    12ef:	c3                   	ret
+
+00000000000012f0 <wait>:
+SYSCALL(wait)
+    12f0:	b8 03 00 00 00       	mov    $0x3,%eax
+    12f5:	49 89 ca             	mov    %rcx,%r10
+    12f8:	0f 05                	syscall
+    12fa:	c3                   	ret
+
+00000000000012fb <pipe>:
+SYSCALL(pipe)
+    12fb:	b8 04 00 00 00       	mov    $0x4,%eax
+    1300:	49 89 ca             	mov    %rcx,%r10
+    1303:	0f 05                	syscall
+    1305:	c3                   	ret
+
+0000000000001306 <read>:
+SYSCALL(read)
+    1306:	b8 05 00 00 00       	mov    $0x5,%eax
+    130b:	49 89 ca             	mov    %rcx,%r10
+    130e:	0f 05                	syscall
+    1310:	c3                   	ret
+
+0000000000001311 <write>:
+SYSCALL(write)
+    1311:	b8 10 00 00 00       	mov    $0x10,%eax
+    1316:	49 89 ca             	mov    %rcx,%r10
+    1319:	0f 05                	syscall
+    131b:	c3                   	ret
+
+000000000000131c <_close>:
+SYSCALL_(close)
+    131c:	b8 15 00 00 00       	mov    $0x15,%eax
+    1321:	49 89 ca             	mov    %rcx,%r10
+    1324:	0f 05                	syscall
+    1326:	c3                   	ret
+
+0000000000001327 <kill>:
+SYSCALL(kill)
+    1327:	b8 06 00 00 00       	mov    $0x6,%eax
+    132c:	49 89 ca             	mov    %rcx,%r10
+    132f:	0f 05                	syscall
+    1331:	c3                   	ret
+
+0000000000001332 <_exec>:
+SYSCALL_(exec)
+    1332:	b8 07 00 00 00       	mov    $0x7,%eax
+    1337:	49 89 ca             	mov    %rcx,%r10
+    133a:	0f 05                	syscall
+    133c:	c3                   	ret
+
+000000000000133d <open>:
+SYSCALL(open)
+    133d:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1342:	49 89 ca             	mov    %rcx,%r10
+    1345:	0f 05                	syscall
+    1347:	c3                   	ret
+
+0000000000001348 <mknod>:
+SYSCALL(mknod)
+    1348:	b8 11 00 00 00       	mov    $0x11,%eax
+    134d:	49 89 ca             	mov    %rcx,%r10
+    1350:	0f 05                	syscall
+    1352:	c3                   	ret
+
+0000000000001353 <unlink>:
+SYSCALL(unlink)
+    1353:	b8 12 00 00 00       	mov    $0x12,%eax
+    1358:	49 89 ca             	mov    %rcx,%r10
+    135b:	0f 05                	syscall
+    135d:	c3                   	ret
+
+000000000000135e <fstat>:
+SYSCALL(fstat)
+    135e:	b8 08 00 00 00       	mov    $0x8,%eax
+    1363:	49 89 ca             	mov    %rcx,%r10
+    1366:	0f 05                	syscall
+    1368:	c3                   	ret
+
+0000000000001369 <link>:
+SYSCALL(link)
+    1369:	b8 13 00 00 00       	mov    $0x13,%eax
+    136e:	49 89 ca             	mov    %rcx,%r10
+    1371:	0f 05                	syscall
+    1373:	c3                   	ret
+
+0000000000001374 <mkdir>:
+SYSCALL(mkdir)
+    1374:	b8 14 00 00 00       	mov    $0x14,%eax
+    1379:	49 89 ca             	mov    %rcx,%r10
+    137c:	0f 05                	syscall
+    137e:	c3                   	ret
+
+000000000000137f <chdir>:
+SYSCALL(chdir)
+    137f:	b8 09 00 00 00       	mov    $0x9,%eax
+    1384:	49 89 ca             	mov    %rcx,%r10
+    1387:	0f 05                	syscall
+    1389:	c3                   	ret
+
+000000000000138a <dup>:
+SYSCALL(dup)
+    138a:	b8 0a 00 00 00       	mov    $0xa,%eax
+    138f:	49 89 ca             	mov    %rcx,%r10
+    1392:	0f 05                	syscall
+    1394:	c3                   	ret
+
+0000000000001395 <getpid>:
+SYSCALL(getpid)
+    1395:	b8 0b 00 00 00       	mov    $0xb,%eax
+    139a:	49 89 ca             	mov    %rcx,%r10
+    139d:	0f 05                	syscall
+    139f:	c3                   	ret
+
+00000000000013a0 <sbrk>:
+SYSCALL(sbrk)
+    13a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13a5:	49 89 ca             	mov    %rcx,%r10
+    13a8:	0f 05                	syscall
+    13aa:	c3                   	ret
+
+00000000000013ab <sleep>:
+SYSCALL(sleep)
+    13ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13b0:	49 89 ca             	mov    %rcx,%r10
+    13b3:	0f 05                	syscall
+    13b5:	c3                   	ret
+
+00000000000013b6 <uptime>:
+SYSCALL(uptime)
+    13b6:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13bb:	49 89 ca             	mov    %rcx,%r10
+    13be:	0f 05                	syscall
+    13c0:	c3                   	ret
+
+00000000000013c1 <sysinfo>:
+SYSCALL(sysinfo)
+    13c1:	b8 16 00 00 00       	mov    $0x16,%eax
+    13c6:	49 89 ca             	mov    %rcx,%r10
+    13c9:	0f 05                	syscall
+    13cb:	c3                   	ret
+
+00000000000013cc <crashn>:
+SYSCALL(crashn)
+    13cc:	b8 17 00 00 00       	mov    $0x17,%eax
+    13d1:	49 89 ca             	mov    %rcx,%r10
+    13d4:	0f 05                	syscall
+    13d6:	c3                   	ret
+
+00000000000013d7 <mmap>:
+SYSCALL(mmap)
+    13d7:	b8 18 00 00 00       	mov    $0x18,%eax
+    13dc:	49 89 ca             	mov    %rcx,%r10
+    13df:	0f 05                	syscall
+    13e1:	c3                   	ret
+
+00000000000013e2 <munmap>:
+SYSCALL(munmap)
+    13e2:	b8 19 00 00 00       	mov    $0x19,%eax
+    13e7:	49 89 ca             	mov    %rcx,%r10
+    13ea:	0f 05                	syscall
+    13ec:	c3                   	ret
+
+00000000000013ed <nice>:
+SYSCALL(nice)
+    13ed:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    13f2:	49 89 ca             	mov    %rcx,%r10
+    13f5:	0f 05                	syscall
+    13f7:	c3                   	ret
+
+00000000000013f8 <_spawn>:
+SYSCALL_(spawn)
+    13f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13fd:	49 89 ca             	mov    %rcx,%r10
+    1400:	0f 05                	syscall
+    1402:	c3                   	ret
+
+0000000000001403 <pread>:
+SYSCALL(pread)
+    1403:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1408:	49 89 ca             	mov    %rcx,%r10
+    140b:	0f 05                	syscall
+    140d:	c3                   	ret
+
+000000000000140e <pwrite>:
+SYSCALL(pwrite)
+    140e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1413:	49 89 ca             	mov    %rcx,%r10
+    1416:	0f 05                	syscall
+    1418:	c3                   	ret
+
+0000000000001419 <readv>:
+SYSCALL(readv)
+    1419:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    141e:	49 89 ca             	mov    %rcx,%r10
+    1421:	0f 05                	syscall
+    1423:	c3                   	ret
+
+0000000000001424 <writev>:
+SYSCALL(writev)
+    1424:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1429:	49 89 ca             	mov    %rcx,%r10
+    142c:	0f 05                	syscall
+    142e:	c3                   	ret
+
+000000000000142f <sendfile>:
+SYSCALL(sendfile)
+    142f:	b8 20 00 00 00       	mov    $0x20,%eax
+    1434:	49 89 ca             	mov    %rcx,%r10
+    1437:	0f 05                	syscall
+    1439:	c3                   	ret
+
+000000000000143a <splice>:
+SYSCALL(splice)
+    143a:	b8 21 00 00 00       	mov    $0x21,%eax
+    143f:	49 89 ca             	mov    %rcx,%r10
+    1442:	0f 05                	syscall
+    1444:	c3                   	ret
+
+0000000000001445 <poll>:
+SYSCALL(poll)
+    1445:	b8 22 00 00 00       	mov    $0x22,%eax
+    144a:	49 89 ca             	mov    %rcx,%r10
+    144d:	0f 05                	syscall
+    144f:	c3                   	ret
+
+0000000000001450 <fsync>:
+SYSCALL(fsync)
+    1450:	b8 23 00 00 00       	mov    $0x23,%eax
+    1455:	49 89 ca             	mov    %rcx,%r10
+    1458:	0f 05                	syscall
+    145a:	c3                   	ret
+
+000000000000145b <fdatasync>:
+SYSCALL(fdatasync)
+    145b:	b8 24 00 00 00       	mov    $0x24,%eax
+    1460:	49 89 ca             	mov    %rcx,%r10
+    1463:	0f 05                	syscall
+    1465:	c3                   	ret
+
+0000000000001466 <lockstat>:
+SYSCALL(lockstat)
+    1466:	b8 25 00 00 00       	mov    $0x25,%eax
+    146b:	49 89 ca             	mov    %rcx,%r10
+    146e:	0f 05                	syscall
+    1470:	c3                   	ret
+
+0000000000001471 <syscallstat>:
+SYSCALL(syscallstat)
+    1471:	b8 26 00 00 00       	mov    $0x26,%eax
+    1476:	49 89 ca             	mov    %rcx,%r10
+    1479:	0f 05                	syscall
+    147b:	c3                   	ret
+
+000000000000147c <trace>:
+SYSCALL(trace)
+    147c:	b8 27 00 00 00       	mov    $0x27,%eax
+    1481:	49 89 ca             	mov    %rcx,%r10
+    1484:	0f 05                	syscall
+    1486:	c3                   	ret
+
+0000000000001487 <profile>:
+SYSCALL(profile)
+    1487:	b8 28 00 00 00       	mov    $0x28,%eax
+    148c:	49 89 ca             	mov    %rcx,%r10
+    148f:	0f 05                	syscall
+    1491:	c3                   	ret
+
+0000000000001492 <cycles>:
+SYSCALL(cycles)
+    1492:	b8 29 00 00 00       	mov    $0x29,%eax
+    1497:	49 89 ca             	mov    %rcx,%r10
+    149a:	0f 05                	syscall
+    149c:	c3                   	ret
+
+000000000000149d <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    149d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14a2:	49 89 ca             	mov    %rcx,%r10
+    14a5:	0f 05                	syscall
+    14a7:	c3                   	ret
+
+00000000000014a8 <consmode>:
+SYSCALL(consmode)
+    14a8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    14ad:	49 89 ca             	mov    %rcx,%r10
+    14b0:	0f 05                	syscall
+    14b2:	c3                   	ret
+
+00000000000014b3 <clone>:
+SYSCALL(clone)
+    14b3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    14b8:	49 89 ca             	mov    %rcx,%r10
+    14bb:	0f 05                	syscall
+    14bd:	c3                   	ret
+
+00000000000014be <join>:
+SYSCALL(join)
+    14be:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    14c3:	49 89 ca             	mov    %rcx,%r10
+    14c6:	0f 05                	syscall
+    14c8:	c3                   	ret
+
+00000000000014c9 <futex_wait>:
+SYSCALL(futex_wait)
+    14c9:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    14ce:	49 89 ca             	mov    %rcx,%r10
+    14d1:	0f 05                	syscall
+    14d3:	c3                   	ret
+
+00000000000014d4 <futex_wake>:
+SYSCALL(futex_wake)
+    14d4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    14d9:	49 89 ca             	mov    %rcx,%r10
+    14dc:	0f 05                	syscall
+    14de:	c3                   	ret
+
+00000000000014df <shmget>:
+SYSCALL(shmget)
+    14df:	b8 30 00 00 00       	mov    $0x30,%eax
+    14e4:	49 89 ca             	mov    %rcx,%r10
+    14e7:	0f 05                	syscall
+    14e9:	c3                   	ret
+
+00000000000014ea <shmat>:
+SYSCALL(shmat)
+    14ea:	b8 31 00 00 00       	mov    $0x31,%eax
+    14ef:	49 89 ca             	mov    %rcx,%r10
+    14f2:	0f 05                	syscall
+    14f4:	c3                   	ret
+
+00000000000014f5 <shmdt>:
+SYSCALL(shmdt)
+    14f5:	b8 32 00 00 00       	mov    $0x32,%eax
+    14fa:	49 89 ca             	mov    %rcx,%r10
+    14fd:	0f 05                	syscall
+    14ff:	c3                   	ret
+
+0000000000001500 <ring_setup>:
+SYSCALL(ring_setup)
+    1500:	b8 33 00 00 00       	mov    $0x33,%eax
+    1505:	49 89 ca             	mov    %rcx,%r10
+    1508:	0f 05                	syscall
+    150a:	c3                   	ret
+
+000000000000150b <ring_enter>:
+SYSCALL(ring_enter)
+    150b:	b8 34 00 00 00       	mov    $0x34,%eax
+    1510:	49 89 ca             	mov    %rcx,%r10
+    1513:	0f 05                	syscall
+    1515:	c3                   	ret
+
+0000000000001516 <getdents>:
+SYSCALL(getdents)
+    1516:	b8 35 00 00 00       	mov    $0x35,%eax
+    151b:	49 89 ca             	mov    %rcx,%r10
+    151e:	0f 05                	syscall
+    1520:	c3                   	ret
+
+0000000000001521 <fstatat>:
+SYSCALL(fstatat)
+    1521:	b8 36 00 00 00       	mov    $0x36,%eax
+    1526:	49 89 ca             	mov    %rcx,%r10
+    1529:	0f 05                	syscall
+    152b:	c3                   	ret
+
+000000000000152c <clone_file>:
+SYSCALL(clone_file)
+    152c:	b8 37 00 00 00       	mov    $0x37,%eax
+    1531:	49 89 ca             	mov    %rcx,%r10
+    1534:	0f 05                	syscall
+    1536:	c3                   	ret
+
+0000000000001537 <fpunch>:
+SYSCALL(fpunch)
+    1537:	b8 38 00 00 00       	mov    $0x38,%eax
+    153c:	49 89 ca             	mov    %rcx,%r10
+    153f:	0f 05                	syscall
+    1541:	c3                   	ret
+
+0000000000001542 <defrag>:
+SYSCALL(defrag)
+    1542:	b8 39 00 00 00       	mov    $0x39,%eax
+    1547:	49 89 ca             	mov    %rcx,%r10
+    154a:	0f 05                	syscall
+    154c:	c3                   	ret
+
+000000000000154d <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    154d:	55                   	push   %rbp
+    154e:	48 89 e5             	mov    %rsp,%rbp
+    1551:	48 83 ec 20          	sub    $0x20,%rsp
+    1555:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1559:	bf 00 00 00 00       	mov    $0x0,%edi
+    155e:	e8 3d fe ff ff       	call   13a0 <sbrk>
+    1563:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1567:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    156b:	48 f7 d8             	neg    %rax
+    156e:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1573:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1577:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    157b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    157f:	48 01 c2             	add    %rax,%rdx
+    1582:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1587:	48 39 c2             	cmp    %rax,%rdx
+    158a:	73 1e                	jae    15aa <morecore+0x5d>
+    158c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1590:	89 c2                	mov    %eax,%edx
+    1592:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1596:	01 d0                	add    %edx,%eax
+    1598:	89 c7                	mov    %eax,%edi
+    159a:	e8 01 fe ff ff       	call   13a0 <sbrk>
+    159f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15a3:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15a8:	75 07                	jne    15b1 <morecore+0x64>
+    return 0;
+    15aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    15af:	eb 27                	jmp    15d8 <morecore+0x8b>
+  stats.heap += n + pad;
+    15b1:	48 8b 05 b8 1b 00 00 	mov    0x1bb8(%rip),%rax        # 3170 <stats+0x50>
+    15b8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    15bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    15c0:	48 01 ca             	add    %rcx,%rdx
+    15c3:	48 01 d0             	add    %rdx,%rax
+    15c6:	48 89 05 a3 1b 00 00 	mov    %rax,0x1ba3(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    15cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15d5:	48 01 d0             	add    %rdx,%rax
+}
+    15d8:	c9                   	leave
+    15d9:	c3                   	ret
+
+00000000000015da <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    15da:	55                   	push   %rbp
+    15db:	48 89 e5             	mov    %rsp,%rbp
+    15de:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    15e2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    15e6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    15ed:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    15ee:	48 8d 05 0b 1b 00 00 	lea    0x1b0b(%rip),%rax        # 3100 <runs>
+    15f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15f9:	eb 1a                	jmp    1615 <pagefree+0x3b>
+    prev = *rp;
+    15fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ff:	48 8b 00             	mov    (%rax),%rax
+    1602:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1606:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160a:	48 8b 00             	mov    (%rax),%rax
+    160d:	48 83 c0 08          	add    $0x8,%rax
+    1611:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1615:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1619:	48 8b 00             	mov    (%rax),%rax
+    161c:	48 85 c0             	test   %rax,%rax
+    161f:	74 0d                	je     162e <pagefree+0x54>
+    1621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1625:	48 8b 00             	mov    (%rax),%rax
+    1628:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    162c:	72 cd                	jb     15fb <pagefree+0x21>
+  r = (struct run *)p;
+    162e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1632:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1636:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    163a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    163e:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1645:	48 8b 10             	mov    (%rax),%rdx
+    1648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    164c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1654:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1658:	48 85 c0             	test   %rax,%rax
+    165b:	74 48                	je     16a5 <pagefree+0xcb>
+    165d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1661:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1665:	48 01 c2             	add    %rax,%rdx
+    1668:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    166c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1670:	48 39 c2             	cmp    %rax,%rdx
+    1673:	75 30                	jne    16a5 <pagefree+0xcb>
+    r->size += r->next->size;
+    1675:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1679:	48 8b 10             	mov    (%rax),%rdx
+    167c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1680:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1684:	48 8b 00             	mov    (%rax),%rax
+    1687:	48 01 c2             	add    %rax,%rdx
+    168a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    168e:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1691:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1695:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1699:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    169d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16a1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    16a5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16aa:	74 46                	je     16f2 <pagefree+0x118>
+    16ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16b0:	48 8b 10             	mov    (%rax),%rdx
+    16b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16b7:	48 01 d0             	add    %rdx,%rax
+    16ba:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    16be:	75 32                	jne    16f2 <pagefree+0x118>
+    prev->size += r->size;
+    16c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c4:	48 8b 10             	mov    (%rax),%rdx
+    16c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16cb:	48 8b 00             	mov    (%rax),%rax
+    16ce:	48 01 c2             	add    %rax,%rdx
+    16d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d5:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    16d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16dc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    16e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    16f0:	eb 0c                	jmp    16fe <pagefree+0x124>
+  } else {
+    *rp = r;
+    16f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16fa:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    16fd:	90                   	nop
+    16fe:	90                   	nop
+    16ff:	5d                   	pop    %rbp
+    1700:	c3                   	ret
+
+0000000000001701 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1701:	55                   	push   %rbp
+    1702:	48 89 e5             	mov    %rsp,%rbp
+    1705:	48 83 ec 40          	sub    $0x40,%rsp
+    1709:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    170d:	48 8d 05 ec 19 00 00 	lea    0x19ec(%rip),%rax        # 3100 <runs>
+    1714:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1718:	eb 66                	jmp    1780 <pagealloc+0x7f>
+    if (r->size == n) {
+    171a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    171e:	48 8b 00             	mov    (%rax),%rax
+    1721:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1725:	75 18                	jne    173f <pagealloc+0x3e>
+      *rp = r->next;
+    1727:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    172b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    172f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1733:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1736:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173a:	e9 ca 00 00 00       	jmp    1809 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    173f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1743:	48 8b 00             	mov    (%rax),%rax
+    1746:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    174a:	73 28                	jae    1774 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    174c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1750:	48 8b 00             	mov    (%rax),%rax
+    1753:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1757:	48 89 c2             	mov    %rax,%rdx
+    175a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    175e:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1761:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1765:	48 8b 10             	mov    (%rax),%rdx
+    1768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176c:	48 01 d0             	add    %rdx,%rax
+    176f:	e9 95 00 00 00       	jmp    1809 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1774:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1778:	48 83 c0 08          	add    $0x8,%rax
+    177c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1780:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1784:	48 8b 00             	mov    (%rax),%rax
+    1787:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    178b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1790:	75 88                	jne    171a <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1792:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1796:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    179a:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    17a1:	00 
+    17a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17aa:	48 39 c2             	cmp    %rax,%rdx
+    17ad:	48 0f 43 c2          	cmovae %rdx,%rax
+    17b1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    17b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17b9:	48 89 c7             	mov    %rax,%rdi
+    17bc:	e8 8c fd ff ff       	call   154d <morecore>
+    17c1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    17c5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    17ca:	75 07                	jne    17d3 <pagealloc+0xd2>
+    return 0;
+    17cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    17d1:	eb 36                	jmp    1809 <pagealloc+0x108>
+  if (m > n)
+    17d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17d7:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    17db:	73 1a                	jae    17f7 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    17dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17e1:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    17e5:	48 89 c2             	mov    %rax,%rdx
+    17e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17ec:	48 89 d6             	mov    %rdx,%rsi
+    17ef:	48 89 c7             	mov    %rax,%rdi
+    17f2:	e8 e3 fd ff ff       	call   15da <pagefree>
+  return p + m - n;
+    17f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17fb:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    17ff:	48 89 c2             	mov    %rax,%rdx
+    1802:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1806:	48 01 d0             	add    %rdx,%rax
+}
+    1809:	c9                   	leave
+    180a:	c3                   	ret
+
+000000000000180b <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    180b:	55                   	push   %rbp
+    180c:	48 89 e5             	mov    %rsp,%rbp
+    180f:	48 83 ec 30          	sub    $0x30,%rsp
+    1813:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1816:	bf 00 10 00 00       	mov    $0x1000,%edi
+    181b:	e8 e1 fe ff ff       	call   1701 <pagealloc>
+    1820:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1824:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1829:	75 0a                	jne    1835 <refill+0x2a>
+    return -1;
+    182b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1830:	e9 da 00 00 00       	jmp    190f <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1835:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    183c:	00 
+    183d:	e9 ba 00 00 00       	jmp    18fc <refill+0xf1>
+    b = (struct block *)(p + off);
+    1842:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1846:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    184a:	48 01 d0             	add    %rdx,%rax
+    184d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1851:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1854:	ba 20 00 00 00       	mov    $0x20,%edx
+    1859:	89 c1                	mov    %eax,%ecx
+    185b:	48 d3 e2             	shl    %cl,%rdx
+    185e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1862:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1865:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1868:	48 63 d0             	movslq %eax,%rdx
+    186b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    186f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1873:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1876:	48 98                	cltq
+    1878:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    187f:	00 
+    1880:	48 8d 05 39 18 00 00 	lea    0x1839(%rip),%rax        # 30c0 <freelist>
+    1887:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    188b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    188f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1893:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1896:	48 98                	cltq
+    1898:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    189f:	00 
+    18a0:	48 8d 15 19 18 00 00 	lea    0x1819(%rip),%rdx        # 30c0 <freelist>
+    18a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ab:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    18af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18b2:	48 98                	cltq
+    18b4:	48 83 c0 08          	add    $0x8,%rax
+    18b8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18bf:	00 
+    18c0:	48 8d 05 5d 18 00 00 	lea    0x185d(%rip),%rax        # 3124 <stats+0x4>
+    18c7:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    18ca:	8d 48 01             	lea    0x1(%rax),%ecx
+    18cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18d0:	48 98                	cltq
+    18d2:	48 83 c0 08          	add    $0x8,%rax
+    18d6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18dd:	00 
+    18de:	48 8d 05 3f 18 00 00 	lea    0x183f(%rip),%rax        # 3124 <stats+0x4>
+    18e5:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    18e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18eb:	ba 20 00 00 00       	mov    $0x20,%edx
+    18f0:	89 c1                	mov    %eax,%ecx
+    18f2:	48 d3 e2             	shl    %cl,%rdx
+    18f5:	48 89 d0             	mov    %rdx,%rax
+    18f8:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    18fc:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1903:	00 
+    1904:	0f 86 38 ff ff ff    	jbe    1842 <refill+0x37>
+  }
+  return 0;
+    190a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    190f:	c9                   	leave
+    1910:	c3                   	ret
+
+0000000000001911 <malloc>:
+
+void *malloc(uint nbytes) {
+    1911:	55                   	push   %rbp
+    1912:	48 89 e5             	mov    %rsp,%rbp
+    1915:	48 83 ec 30          	sub    $0x30,%rsp
+    1919:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    191c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    191f:	48 83 c0 10          	add    $0x10,%rax
+    1923:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1927:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    192e:	eb 04                	jmp    1934 <malloc+0x23>
+    1930:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1934:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1938:	7f 16                	jg     1950 <malloc+0x3f>
+    193a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    193d:	ba 20 00 00 00       	mov    $0x20,%edx
+    1942:	89 c1                	mov    %eax,%ecx
+    1944:	48 d3 e2             	shl    %cl,%rdx
+    1947:	48 89 d0             	mov    %rdx,%rax
+    194a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    194e:	72 e0                	jb     1930 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1950:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1954:	75 7d                	jne    19d3 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1960:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1966:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    196a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    196e:	48 89 c7             	mov    %rax,%rdi
+    1971:	e8 8b fd ff ff       	call   1701 <pagealloc>
+    1976:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    197a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    197f:	75 0a                	jne    198b <malloc+0x7a>
+      return 0;
+    1981:	b8 00 00 00 00       	mov    $0x0,%eax
+    1986:	e9 2c 01 00 00       	jmp    1ab7 <malloc+0x1a6>
+    h->size = n;
+    198b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    198f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1993:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1996:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    199a:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    19a1:	00 
+    stats.inuse[LARGE]++;
+    19a2:	8b 05 98 17 00 00    	mov    0x1798(%rip),%eax        # 3140 <stats+0x20>
+    19a8:	83 c0 01             	add    $0x1,%eax
+    19ab:	89 05 8f 17 00 00    	mov    %eax,0x178f(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    19b1:	48 8b 15 b0 17 00 00 	mov    0x17b0(%rip),%rdx        # 3168 <stats+0x48>
+    19b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19bc:	48 01 d0             	add    %rdx,%rax
+    19bf:	48 89 05 a2 17 00 00 	mov    %rax,0x17a2(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    19c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19ca:	48 83 c0 10          	add    $0x10,%rax
+    19ce:	e9 e4 00 00 00       	jmp    1ab7 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    19d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19d6:	48 98                	cltq
+    19d8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    19df:	00 
+    19e0:	48 8d 05 d9 16 00 00 	lea    0x16d9(%rip),%rax        # 30c0 <freelist>
+    19e7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    19eb:	48 85 c0             	test   %rax,%rax
+    19ee:	75 18                	jne    1a08 <malloc+0xf7>
+    19f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19f3:	89 c7                	mov    %eax,%edi
+    19f5:	e8 11 fe ff ff       	call   180b <refill>
+    19fa:	85 c0                	test   %eax,%eax
+    19fc:	79 0a                	jns    1a08 <malloc+0xf7>
+    return 0;
+    19fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a03:	e9 af 00 00 00       	jmp    1ab7 <malloc+0x1a6>
+  b = freelist[c];
+    1a08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a0b:	48 98                	cltq
+    1a0d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a14:	00 
+    1a15:	48 8d 05 a4 16 00 00 	lea    0x16a4(%rip),%rax        # 30c0 <freelist>
+    1a1c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1a24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a28:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1a2c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1a2f:	48 63 d2             	movslq %edx,%rdx
+    1a32:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1a39:	00 
+    1a3a:	48 8d 15 7f 16 00 00 	lea    0x167f(%rip),%rdx        # 30c0 <freelist>
+    1a41:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1a45:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a48:	48 98                	cltq
+    1a4a:	48 83 c0 08          	add    $0x8,%rax
+    1a4e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a55:	00 
+    1a56:	48 8d 05 c7 16 00 00 	lea    0x16c7(%rip),%rax        # 3124 <stats+0x4>
+    1a5d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a60:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1a63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a66:	48 98                	cltq
+    1a68:	48 83 c0 08          	add    $0x8,%rax
+    1a6c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a73:	00 
+    1a74:	48 8d 05 a9 16 00 00 	lea    0x16a9(%rip),%rax        # 3124 <stats+0x4>
+    1a7b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1a7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a81:	48 98                	cltq
+    1a83:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a8a:	00 
+    1a8b:	48 8d 05 8e 16 00 00 	lea    0x168e(%rip),%rax        # 3120 <stats>
+    1a92:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a95:	8d 48 01             	lea    0x1(%rax),%ecx
+    1a98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a9b:	48 98                	cltq
+    1a9d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1aa4:	00 
+    1aa5:	48 8d 05 74 16 00 00 	lea    0x1674(%rip),%rax        # 3120 <stats>
+    1aac:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ab3:	48 83 c0 10          	add    $0x10,%rax
+}
+    1ab7:	c9                   	leave
+    1ab8:	c3                   	ret
+
+0000000000001ab9 <free>:
+
+void free(void *ap) {
+    1ab9:	55                   	push   %rbp
+    1aba:	48 89 e5             	mov    %rsp,%rbp
+    1abd:	48 83 ec 18          	sub    $0x18,%rsp
+    1ac1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1ac5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1aca:	0f 84 03 01 00 00    	je     1bd3 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1ad0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ad4:	48 83 e8 10          	sub    $0x10,%rax
+    1ad8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1adc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ae0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1ae4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1ae8:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1aed:	75 42                	jne    1b31 <free+0x78>
+    stats.inuse[LARGE]--;
+    1aef:	8b 05 4b 16 00 00    	mov    0x164b(%rip),%eax        # 3140 <stats+0x20>
+    1af5:	83 e8 01             	sub    $0x1,%eax
+    1af8:	89 05 42 16 00 00    	mov    %eax,0x1642(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1afe:	48 8b 15 63 16 00 00 	mov    0x1663(%rip),%rdx        # 3168 <stats+0x48>
+    1b05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b09:	48 8b 00             	mov    (%rax),%rax
+    1b0c:	48 29 c2             	sub    %rax,%rdx
+    1b0f:	48 89 15 52 16 00 00 	mov    %rdx,0x1652(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1a:	48 8b 10             	mov    (%rax),%rdx
+    1b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b21:	48 89 d6             	mov    %rdx,%rsi
+    1b24:	48 89 c7             	mov    %rax,%rdi
+    1b27:	e8 ae fa ff ff       	call   15da <pagefree>
+    return;
+    1b2c:	e9 a3 00 00 00       	jmp    1bd4 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1b31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b35:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b3c:	00 
+    1b3d:	48 8d 05 7c 15 00 00 	lea    0x157c(%rip),%rax        # 30c0 <freelist>
+    1b44:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b4c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1b50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b54:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b5b:	00 
+    1b5c:	48 8d 15 5d 15 00 00 	lea    0x155d(%rip),%rdx        # 30c0 <freelist>
+    1b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b67:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1b6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b6f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b76:	00 
+    1b77:	48 8d 05 a2 15 00 00 	lea    0x15a2(%rip),%rax        # 3120 <stats>
+    1b7e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b81:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1b84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b88:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b8f:	00 
+    1b90:	48 8d 05 89 15 00 00 	lea    0x1589(%rip),%rax        # 3120 <stats>
+    1b97:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1b9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b9e:	48 83 c0 08          	add    $0x8,%rax
+    1ba2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ba9:	00 
+    1baa:	48 8d 05 73 15 00 00 	lea    0x1573(%rip),%rax        # 3124 <stats+0x4>
+    1bb1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bb4:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bbb:	48 83 c0 08          	add    $0x8,%rax
+    1bbf:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bc6:	00 
+    1bc7:	48 8d 05 56 15 00 00 	lea    0x1556(%rip),%rax        # 3124 <stats+0x4>
+    1bce:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1bd1:	eb 01                	jmp    1bd4 <free+0x11b>
+    return;
+    1bd3:	90                   	nop
+}
+    1bd4:	c9                   	leave
+    1bd5:	c3                   	ret
+
+0000000000001bd6 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1bd6:	55                   	push   %rbp
+    1bd7:	48 89 e5             	mov    %rsp,%rbp
+    1bda:	48 83 ec 30          	sub    $0x30,%rsp
+    1bde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1be1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1be4:	48 8d 15 7d 02 00 00 	lea    0x27d(%rip),%rdx        # 1e68 <benchreport+0x16a>
+    1beb:	48 89 d6             	mov    %rdx,%rsi
+    1bee:	89 c7                	mov    %eax,%edi
+    1bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bf5:	e8 37 e6 ff ff       	call   231 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1bfa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1c01:	eb 67                	jmp    1c6a <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1c03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c06:	48 98                	cltq
+    1c08:	48 83 c0 08          	add    $0x8,%rax
+    1c0c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c13:	00 
+    1c14:	48 8d 05 09 15 00 00 	lea    0x1509(%rip),%rax        # 3124 <stats+0x4>
+    1c1b:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1c1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c21:	48 98                	cltq
+    1c23:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c2a:	00 
+    1c2b:	48 8d 05 ee 14 00 00 	lea    0x14ee(%rip),%rax        # 3120 <stats>
+    1c32:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1c35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c38:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c3d:	89 c1                	mov    %eax,%ecx
+    1c3f:	48 d3 e2             	shl    %cl,%rdx
+    1c42:	48 89 d0             	mov    %rdx,%rax
+    1c45:	89 c1                	mov    %eax,%ecx
+    1c47:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c4d:	41 89 f9             	mov    %edi,%r9d
+    1c50:	41 89 f0             	mov    %esi,%r8d
+    1c53:	48 8d 35 25 02 00 00 	lea    0x225(%rip),%rsi        # 1e7f <benchreport+0x181>
+    1c5a:	89 c7                	mov    %eax,%edi
+    1c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c61:	e8 cb e5 ff ff       	call   231 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c66:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1c6a:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1c6e:	7e 93                	jle    1c03 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1c70:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1c77:	00 
+  for (r = runs; r; r = r->next)
+    1c78:	48 8b 05 81 14 00 00 	mov    0x1481(%rip),%rax        # 3100 <runs>
+    1c7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c83:	eb 17                	jmp    1c9c <mallocstats+0xc6>
+    nfree += r->size;
+    1c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c89:	48 8b 00             	mov    (%rax),%rax
+    1c8c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c94:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1c98:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c9c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1ca1:	75 e2                	jne    1c85 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1ca3:	48 8b 05 c6 14 00 00 	mov    0x14c6(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1caa:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb0:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cb4:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cb6:	48 8b 05 ab 14 00 00 	mov    0x14ab(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cbd:	89 c1                	mov    %eax,%ecx
+    1cbf:	8b 15 7b 14 00 00    	mov    0x147b(%rip),%edx        # 3140 <stats+0x20>
+    1cc5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cc8:	41 89 f9             	mov    %edi,%r9d
+    1ccb:	41 89 f0             	mov    %esi,%r8d
+    1cce:	48 8d 35 bb 01 00 00 	lea    0x1bb(%rip),%rsi        # 1e90 <benchreport+0x192>
+    1cd5:	89 c7                	mov    %eax,%edi
+    1cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cdc:	e8 50 e5 ff ff       	call   231 <printf>
+}
+    1ce1:	90                   	nop
+    1ce2:	c9                   	leave
+    1ce3:	c3                   	ret
+
+0000000000001ce4 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1ce4:	55                   	push   %rbp
+    1ce5:	48 89 e5             	mov    %rsp,%rbp
+    1ce8:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1cec:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1cf0:	48 89 c7             	mov    %rax,%rdi
+    1cf3:	e8 9a f7 ff ff       	call   1492 <cycles>
+  return t;
+    1cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1cfc:	c9                   	leave
+    1cfd:	c3                   	ret
+
+0000000000001cfe <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1cfe:	55                   	push   %rbp
+    1cff:	48 89 e5             	mov    %rsp,%rbp
+    1d02:	48 83 ec 30          	sub    $0x30,%rsp
+    1d06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d0e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1d11:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1d15:	0f 8e 24 01 00 00    	jle    1e3f <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1d1b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1d22:	e9 98 00 00 00       	jmp    1dbf <benchreport+0xc1>
+    x = t[i];
+    1d27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d2a:	48 98                	cltq
+    1d2c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d33:	00 
+    1d34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d38:	48 01 d0             	add    %rdx,%rax
+    1d3b:	48 8b 00             	mov    (%rax),%rax
+    1d3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d45:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1d48:	eb 33                	jmp    1d7d <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1d4a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d4d:	48 98                	cltq
+    1d4f:	48 c1 e0 03          	shl    $0x3,%rax
+    1d53:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d5b:	48 01 d0             	add    %rdx,%rax
+    1d5e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1d61:	48 63 d2             	movslq %edx,%rdx
+    1d64:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d6b:	00 
+    1d6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d70:	48 01 ca             	add    %rcx,%rdx
+    1d73:	48 8b 00             	mov    (%rax),%rax
+    1d76:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d79:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1d7d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1d81:	7e 1d                	jle    1da0 <benchreport+0xa2>
+    1d83:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d86:	48 98                	cltq
+    1d88:	48 c1 e0 03          	shl    $0x3,%rax
+    1d8c:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d94:	48 01 d0             	add    %rdx,%rax
+    1d97:	48 8b 00             	mov    (%rax),%rax
+    1d9a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d9e:	72 aa                	jb     1d4a <benchreport+0x4c>
+    t[j] = x;
+    1da0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1da3:	48 98                	cltq
+    1da5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1dac:	00 
+    1dad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1db1:	48 01 c2             	add    %rax,%rdx
+    1db4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db8:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1dbb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1dbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dc2:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1dc5:	0f 8c 5c ff ff ff    	jl     1d27 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1dcb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dce:	48 98                	cltq
+    1dd0:	48 c1 e0 03          	shl    $0x3,%rax
+    1dd4:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1dd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ddc:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1ddf:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1de2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1de5:	89 c2                	mov    %eax,%edx
+    1de7:	c1 ea 1f             	shr    $0x1f,%edx
+    1dea:	01 d0                	add    %edx,%eax
+    1dec:	d1 f8                	sar    %eax
+    1dee:	48 98                	cltq
+    1df0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1df7:	00 
+    1df8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dfc:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1dff:	48 8b 38             	mov    (%rax),%rdi
+    1e02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e06:	48 8b 30             	mov    (%rax),%rsi
+    1e09:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1e0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e10:	48 83 ec 08          	sub    $0x8,%rsp
+    1e14:	51                   	push   %rcx
+    1e15:	49 89 f9             	mov    %rdi,%r9
+    1e18:	49 89 f0             	mov    %rsi,%r8
+    1e1b:	89 d1                	mov    %edx,%ecx
+    1e1d:	48 89 c2             	mov    %rax,%rdx
+    1e20:	48 8d 05 a9 00 00 00 	lea    0xa9(%rip),%rax        # 1ed0 <benchreport+0x1d2>
+    1e27:	48 89 c6             	mov    %rax,%rsi
+    1e2a:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e34:	e8 f8 e3 ff ff       	call   231 <printf>
+    1e39:	48 83 c4 10          	add    $0x10,%rsp
+    1e3d:	eb 01                	jmp    1e40 <benchreport+0x142>
+    return;
+    1e3f:	90                   	nop
+}
+    1e40:	c9                   	leave
+    1e41:	c3                   	ret
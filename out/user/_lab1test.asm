@@ -0,0 +1,5210 @@
+
+out/user/_lab1test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void testinvalidargs(void);
+void smallfilereadtest(void);
+void duptest(void);
+void nofilestest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+  if(open("console", O_RDWR) < 0){
+       4:	be 02 00 00 00       	mov    $0x2,%esi
+       9:	48 8d 05 d8 37 00 00 	lea    0x37d8(%rip),%rax        # 37e8 <benchreport+0x14b>
+      10:	48 89 c7             	mov    %rax,%rdi
+      13:	e8 c4 2c 00 00       	call   2cdc <open>
+      18:	85 c0                	test   %eax,%eax
+      1a:	79 07                	jns    23 <main+0x23>
+    return -1;
+      1c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      21:	eb 58                	jmp    7b <main+0x7b>
+  }
+  dup(0);     // stdout
+      23:	bf 00 00 00 00       	mov    $0x0,%edi
+      28:	e8 fc 2c 00 00       	call   2d29 <dup>
+  dup(0);     // stderr
+      2d:	bf 00 00 00 00       	mov    $0x0,%edi
+      32:	e8 f2 2c 00 00       	call   2d29 <dup>
+
+  sleep(1);
+      37:	bf 01 00 00 00       	mov    $0x1,%edi
+      3c:	e8 09 2d 00 00       	call   2d4a <sleep>
+  
+  testopen();
+      41:	e8 37 00 00 00       	call   7d <testopen>
+  testinvalidargs();
+      46:	e8 43 03 00 00       	call   38e <testinvalidargs>
+  smallfilereadtest();
+      4b:	e8 b9 0a 00 00       	call   b09 <smallfilereadtest>
+  duptest();
+      50:	e8 67 10 00 00       	call   10bc <duptest>
+  nofilestest();
+      55:	e8 f0 16 00 00       	call   174a <nofilestest>
+
+  printf(stdout, "lab1 tests passed!\n");
+      5a:	8b 05 a0 4f 00 00    	mov    0x4fa0(%rip),%eax        # 5000 <stdout>
+      60:	48 8d 15 89 37 00 00 	lea    0x3789(%rip),%rdx        # 37f0 <benchreport+0x153>
+      67:	48 89 d6             	mov    %rdx,%rsi
+      6a:	89 c7                	mov    %eax,%edi
+      6c:	b8 00 00 00 00       	mov    $0x0,%eax
+      71:	e8 5a 1b 00 00       	call   1bd0 <printf>
+
+  exit();
+      76:	e8 85 21 00 00       	call   2200 <exit>
+  return 0;
+}
+      7b:	5d                   	pop    %rbp
+      7c:	c3                   	ret
+
+000000000000007d <testopen>:
+
+void testopen(void) {
+      7d:	55                   	push   %rbp
+      7e:	48 89 e5             	mov    %rsp,%rbp
+      81:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, fd2;
+
+  // test invalid open arguments.
+  if (open("/other.txt", O_CREATE) != -1)
+      85:	be 00 02 00 00       	mov    $0x200,%esi
+      8a:	48 8d 05 73 37 00 00 	lea    0x3773(%rip),%rax        # 3804 <benchreport+0x167>
+      91:	48 89 c7             	mov    %rax,%rdi
+      94:	e8 43 2c 00 00       	call   2cdc <open>
+      99:	83 f8 ff             	cmp    $0xffffffff,%eax
+      9c:	74 5c                	je     fa <testopen+0x7d>
+    error("created file in read only file system");
+      9e:	8b 05 5c 4f 00 00    	mov    0x4f5c(%rip),%eax        # 5000 <stdout>
+      a4:	ba 3e 00 00 00       	mov    $0x3e,%edx
+      a9:	48 8d 0d 5f 37 00 00 	lea    0x375f(%rip),%rcx        # 380f <benchreport+0x172>
+      b0:	48 89 ce             	mov    %rcx,%rsi
+      b3:	89 c7                	mov    %eax,%edi
+      b5:	b8 00 00 00 00       	mov    $0x0,%eax
+      ba:	e8 11 1b 00 00       	call   1bd0 <printf>
+      bf:	8b 05 3b 4f 00 00    	mov    0x4f3b(%rip),%eax        # 5000 <stdout>
+      c5:	48 8d 15 5c 37 00 00 	lea    0x375c(%rip),%rdx        # 3828 <benchreport+0x18b>
+      cc:	48 89 d6             	mov    %rdx,%rsi
+      cf:	89 c7                	mov    %eax,%edi
+      d1:	b8 00 00 00 00       	mov    $0x0,%eax
+      d6:	e8 f5 1a 00 00       	call   1bd0 <printf>
+      db:	8b 05 1f 4f 00 00    	mov    0x4f1f(%rip),%eax        # 5000 <stdout>
+      e1:	48 8d 15 66 37 00 00 	lea    0x3766(%rip),%rdx        # 384e <benchreport+0x1b1>
+      e8:	48 89 d6             	mov    %rdx,%rsi
+      eb:	89 c7                	mov    %eax,%edi
+      ed:	b8 00 00 00 00       	mov    $0x0,%eax
+      f2:	e8 d9 1a 00 00       	call   1bd0 <printf>
+      f7:	90                   	nop
+      f8:	eb fd                	jmp    f7 <testopen+0x7a>
+
+  if (open("/small.txt", O_RDWR) != -1 || open("/small.txt", O_WRONLY) != -1)
+      fa:	be 02 00 00 00       	mov    $0x2,%esi
+      ff:	48 8d 05 4a 37 00 00 	lea    0x374a(%rip),%rax        # 3850 <benchreport+0x1b3>
+     106:	48 89 c7             	mov    %rax,%rdi
+     109:	e8 ce 2b 00 00       	call   2cdc <open>
+     10e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     111:	75 19                	jne    12c <testopen+0xaf>
+     113:	be 01 00 00 00       	mov    $0x1,%esi
+     118:	48 8d 05 31 37 00 00 	lea    0x3731(%rip),%rax        # 3850 <benchreport+0x1b3>
+     11f:	48 89 c7             	mov    %rax,%rdi
+     122:	e8 b5 2b 00 00       	call   2cdc <open>
+     127:	83 f8 ff             	cmp    $0xffffffff,%eax
+     12a:	74 5c                	je     188 <testopen+0x10b>
+    error("tried to open a file for writing in read only fs");
+     12c:	8b 05 ce 4e 00 00    	mov    0x4ece(%rip),%eax        # 5000 <stdout>
+     132:	ba 41 00 00 00       	mov    $0x41,%edx
+     137:	48 8d 0d d1 36 00 00 	lea    0x36d1(%rip),%rcx        # 380f <benchreport+0x172>
+     13e:	48 89 ce             	mov    %rcx,%rsi
+     141:	89 c7                	mov    %eax,%edi
+     143:	b8 00 00 00 00       	mov    $0x0,%eax
+     148:	e8 83 1a 00 00       	call   1bd0 <printf>
+     14d:	8b 05 ad 4e 00 00    	mov    0x4ead(%rip),%eax        # 5000 <stdout>
+     153:	48 8d 15 06 37 00 00 	lea    0x3706(%rip),%rdx        # 3860 <benchreport+0x1c3>
+     15a:	48 89 d6             	mov    %rdx,%rsi
+     15d:	89 c7                	mov    %eax,%edi
+     15f:	b8 00 00 00 00       	mov    $0x0,%eax
+     164:	e8 67 1a 00 00       	call   1bd0 <printf>
+     169:	8b 05 91 4e 00 00    	mov    0x4e91(%rip),%eax        # 5000 <stdout>
+     16f:	48 8d 15 d8 36 00 00 	lea    0x36d8(%rip),%rdx        # 384e <benchreport+0x1b1>
+     176:	48 89 d6             	mov    %rdx,%rsi
+     179:	89 c7                	mov    %eax,%edi
+     17b:	b8 00 00 00 00       	mov    $0x0,%eax
+     180:	e8 4b 1a 00 00       	call   1bd0 <printf>
+     185:	90                   	nop
+     186:	eb fd                	jmp    185 <testopen+0x108>
+  if (open("/other.txt", O_RDONLY) != -1)
+     188:	be 00 00 00 00       	mov    $0x0,%esi
+     18d:	48 8d 05 70 36 00 00 	lea    0x3670(%rip),%rax        # 3804 <benchreport+0x167>
+     194:	48 89 c7             	mov    %rax,%rdi
+     197:	e8 40 2b 00 00       	call   2cdc <open>
+     19c:	83 f8 ff             	cmp    $0xffffffff,%eax
+     19f:	74 5c                	je     1fd <testopen+0x180>
+    error("opened a file that doesn't exist");
+     1a1:	8b 05 59 4e 00 00    	mov    0x4e59(%rip),%eax        # 5000 <stdout>
+     1a7:	ba 43 00 00 00       	mov    $0x43,%edx
+     1ac:	48 8d 0d 5c 36 00 00 	lea    0x365c(%rip),%rcx        # 380f <benchreport+0x172>
+     1b3:	48 89 ce             	mov    %rcx,%rsi
+     1b6:	89 c7                	mov    %eax,%edi
+     1b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1bd:	e8 0e 1a 00 00       	call   1bd0 <printf>
+     1c2:	8b 05 38 4e 00 00    	mov    0x4e38(%rip),%eax        # 5000 <stdout>
+     1c8:	48 8d 15 c9 36 00 00 	lea    0x36c9(%rip),%rdx        # 3898 <benchreport+0x1fb>
+     1cf:	48 89 d6             	mov    %rdx,%rsi
+     1d2:	89 c7                	mov    %eax,%edi
+     1d4:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d9:	e8 f2 19 00 00       	call   1bd0 <printf>
+     1de:	8b 05 1c 4e 00 00    	mov    0x4e1c(%rip),%eax        # 5000 <stdout>
+     1e4:	48 8d 15 63 36 00 00 	lea    0x3663(%rip),%rdx        # 384e <benchreport+0x1b1>
+     1eb:	48 89 d6             	mov    %rdx,%rsi
+     1ee:	89 c7                	mov    %eax,%edi
+     1f0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f5:	e8 d6 19 00 00       	call   1bd0 <printf>
+     1fa:	90                   	nop
+     1fb:	eb fd                	jmp    1fa <testopen+0x17d>
+
+  fd = open("/small.txt", O_RDONLY);
+     1fd:	be 00 00 00 00       	mov    $0x0,%esi
+     202:	48 8d 05 47 36 00 00 	lea    0x3647(%rip),%rax        # 3850 <benchreport+0x1b3>
+     209:	48 89 c7             	mov    %rax,%rdi
+     20c:	e8 cb 2a 00 00       	call   2cdc <open>
+     211:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd == -1)
+     214:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     218:	75 5c                	jne    276 <testopen+0x1f9>
+    error("cannot open small.txt");
+     21a:	8b 05 e0 4d 00 00    	mov    0x4de0(%rip),%eax        # 5000 <stdout>
+     220:	ba 47 00 00 00       	mov    $0x47,%edx
+     225:	48 8d 0d e3 35 00 00 	lea    0x35e3(%rip),%rcx        # 380f <benchreport+0x172>
+     22c:	48 89 ce             	mov    %rcx,%rsi
+     22f:	89 c7                	mov    %eax,%edi
+     231:	b8 00 00 00 00       	mov    $0x0,%eax
+     236:	e8 95 19 00 00       	call   1bd0 <printf>
+     23b:	8b 05 bf 4d 00 00    	mov    0x4dbf(%rip),%eax        # 5000 <stdout>
+     241:	48 8d 15 71 36 00 00 	lea    0x3671(%rip),%rdx        # 38b9 <benchreport+0x21c>
+     248:	48 89 d6             	mov    %rdx,%rsi
+     24b:	89 c7                	mov    %eax,%edi
+     24d:	b8 00 00 00 00       	mov    $0x0,%eax
+     252:	e8 79 19 00 00       	call   1bd0 <printf>
+     257:	8b 05 a3 4d 00 00    	mov    0x4da3(%rip),%eax        # 5000 <stdout>
+     25d:	48 8d 15 ea 35 00 00 	lea    0x35ea(%rip),%rdx        # 384e <benchreport+0x1b1>
+     264:	48 89 d6             	mov    %rdx,%rsi
+     267:	89 c7                	mov    %eax,%edi
+     269:	b8 00 00 00 00       	mov    $0x0,%eax
+     26e:	e8 5d 19 00 00       	call   1bd0 <printf>
+     273:	90                   	nop
+     274:	eb fd                	jmp    273 <testopen+0x1f6>
+  printf(stdout, "passed argument checking for open\n");
+     276:	8b 05 84 4d 00 00    	mov    0x4d84(%rip),%eax        # 5000 <stdout>
+     27c:	48 8d 15 4d 36 00 00 	lea    0x364d(%rip),%rdx        # 38d0 <benchreport+0x233>
+     283:	48 89 d6             	mov    %rdx,%rsi
+     286:	89 c7                	mov    %eax,%edi
+     288:	b8 00 00 00 00       	mov    $0x0,%eax
+     28d:	e8 3e 19 00 00       	call   1bd0 <printf>
+
+  // ensure opening the same file results with a
+  // different file descriptor.
+  fd2 = open("/small.txt", O_RDONLY);
+     292:	be 00 00 00 00       	mov    $0x0,%esi
+     297:	48 8d 05 b2 35 00 00 	lea    0x35b2(%rip),%rax        # 3850 <benchreport+0x1b3>
+     29e:	48 89 c7             	mov    %rax,%rdi
+     2a1:	e8 36 2a 00 00       	call   2cdc <open>
+     2a6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (fd2 == -1)
+     2a9:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     2ad:	75 5c                	jne    30b <testopen+0x28e>
+    error("cannot open small.txt on 2nd try");
+     2af:	8b 05 4b 4d 00 00    	mov    0x4d4b(%rip),%eax        # 5000 <stdout>
+     2b5:	ba 4e 00 00 00       	mov    $0x4e,%edx
+     2ba:	48 8d 0d 4e 35 00 00 	lea    0x354e(%rip),%rcx        # 380f <benchreport+0x172>
+     2c1:	48 89 ce             	mov    %rcx,%rsi
+     2c4:	89 c7                	mov    %eax,%edi
+     2c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cb:	e8 00 19 00 00       	call   1bd0 <printf>
+     2d0:	8b 05 2a 4d 00 00    	mov    0x4d2a(%rip),%eax        # 5000 <stdout>
+     2d6:	48 8d 15 1b 36 00 00 	lea    0x361b(%rip),%rdx        # 38f8 <benchreport+0x25b>
+     2dd:	48 89 d6             	mov    %rdx,%rsi
+     2e0:	89 c7                	mov    %eax,%edi
+     2e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e7:	e8 e4 18 00 00       	call   1bd0 <printf>
+     2ec:	8b 05 0e 4d 00 00    	mov    0x4d0e(%rip),%eax        # 5000 <stdout>
+     2f2:	48 8d 15 55 35 00 00 	lea    0x3555(%rip),%rdx        # 384e <benchreport+0x1b1>
+     2f9:	48 89 d6             	mov    %rdx,%rsi
+     2fc:	89 c7                	mov    %eax,%edi
+     2fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     303:	e8 c8 18 00 00       	call   1bd0 <printf>
+     308:	90                   	nop
+     309:	eb fd                	jmp    308 <testopen+0x28b>
+  if (fd == fd2)
+     30b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     30e:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     311:	75 5c                	jne    36f <testopen+0x2f2>
+    error("opening same file results with same file descriptor");
+     313:	8b 05 e7 4c 00 00    	mov    0x4ce7(%rip),%eax        # 5000 <stdout>
+     319:	ba 50 00 00 00       	mov    $0x50,%edx
+     31e:	48 8d 0d ea 34 00 00 	lea    0x34ea(%rip),%rcx        # 380f <benchreport+0x172>
+     325:	48 89 ce             	mov    %rcx,%rsi
+     328:	89 c7                	mov    %eax,%edi
+     32a:	b8 00 00 00 00       	mov    $0x0,%eax
+     32f:	e8 9c 18 00 00       	call   1bd0 <printf>
+     334:	8b 05 c6 4c 00 00    	mov    0x4cc6(%rip),%eax        # 5000 <stdout>
+     33a:	48 8d 15 df 35 00 00 	lea    0x35df(%rip),%rdx        # 3920 <benchreport+0x283>
+     341:	48 89 d6             	mov    %rdx,%rsi
+     344:	89 c7                	mov    %eax,%edi
+     346:	b8 00 00 00 00       	mov    $0x0,%eax
+     34b:	e8 80 18 00 00       	call   1bd0 <printf>
+     350:	8b 05 aa 4c 00 00    	mov    0x4caa(%rip),%eax        # 5000 <stdout>
+     356:	48 8d 15 f1 34 00 00 	lea    0x34f1(%rip),%rdx        # 384e <benchreport+0x1b1>
+     35d:	48 89 d6             	mov    %rdx,%rsi
+     360:	89 c7                	mov    %eax,%edi
+     362:	b8 00 00 00 00       	mov    $0x0,%eax
+     367:	e8 64 18 00 00       	call   1bd0 <printf>
+     36c:	90                   	nop
+     36d:	eb fd                	jmp    36c <testopen+0x2ef>
+
+  printf(stdout, "passed opening same file twice.\n");
+     36f:	8b 05 8b 4c 00 00    	mov    0x4c8b(%rip),%eax        # 5000 <stdout>
+     375:	48 8d 15 dc 35 00 00 	lea    0x35dc(%rip),%rdx        # 3958 <benchreport+0x2bb>
+     37c:	48 89 d6             	mov    %rdx,%rsi
+     37f:	89 c7                	mov    %eax,%edi
+     381:	b8 00 00 00 00       	mov    $0x0,%eax
+     386:	e8 45 18 00 00       	call   1bd0 <printf>
+}
+     38b:	90                   	nop
+     38c:	c9                   	leave
+     38d:	c3                   	ret
+
+000000000000038e <testinvalidargs>:
+
+void testinvalidargs(void) {
+     38e:	55                   	push   %rbp
+     38f:	48 89 e5             	mov    %rsp,%rbp
+     392:	48 83 ec 30          	sub    $0x30,%rsp
+  int fd, i;
+  char buf[11];
+  struct stat st;
+
+  // read
+  if (read(15, buf, 11) != -1)
+     396:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     39a:	ba 0b 00 00 00       	mov    $0xb,%edx
+     39f:	48 89 c6             	mov    %rax,%rsi
+     3a2:	bf 0f 00 00 00       	mov    $0xf,%edi
+     3a7:	e8 f9 28 00 00       	call   2ca5 <read>
+     3ac:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3af:	74 5c                	je     40d <testinvalidargs+0x7f>
+    error("read on a non existent file descriptor");
+     3b1:	8b 05 49 4c 00 00    	mov    0x4c49(%rip),%eax        # 5000 <stdout>
+     3b7:	ba 5c 00 00 00       	mov    $0x5c,%edx
+     3bc:	48 8d 0d 4c 34 00 00 	lea    0x344c(%rip),%rcx        # 380f <benchreport+0x172>
+     3c3:	48 89 ce             	mov    %rcx,%rsi
+     3c6:	89 c7                	mov    %eax,%edi
+     3c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     3cd:	e8 fe 17 00 00       	call   1bd0 <printf>
+     3d2:	8b 05 28 4c 00 00    	mov    0x4c28(%rip),%eax        # 5000 <stdout>
+     3d8:	48 8d 15 a1 35 00 00 	lea    0x35a1(%rip),%rdx        # 3980 <benchreport+0x2e3>
+     3df:	48 89 d6             	mov    %rdx,%rsi
+     3e2:	89 c7                	mov    %eax,%edi
+     3e4:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e9:	e8 e2 17 00 00       	call   1bd0 <printf>
+     3ee:	8b 05 0c 4c 00 00    	mov    0x4c0c(%rip),%eax        # 5000 <stdout>
+     3f4:	48 8d 15 53 34 00 00 	lea    0x3453(%rip),%rdx        # 384e <benchreport+0x1b1>
+     3fb:	48 89 d6             	mov    %rdx,%rsi
+     3fe:	89 c7                	mov    %eax,%edi
+     400:	b8 00 00 00 00       	mov    $0x0,%eax
+     405:	e8 c6 17 00 00       	call   1bd0 <printf>
+     40a:	90                   	nop
+     40b:	eb fd                	jmp    40a <testinvalidargs+0x7c>
+
+  fd = open("console", O_WRONLY);
+     40d:	be 01 00 00 00       	mov    $0x1,%esi
+     412:	48 8d 05 cf 33 00 00 	lea    0x33cf(%rip),%rax        # 37e8 <benchreport+0x14b>
+     419:	48 89 c7             	mov    %rax,%rdi
+     41c:	e8 bb 28 00 00       	call   2cdc <open>
+     421:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  assert(fd != -1);
+     424:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     428:	75 2b                	jne    455 <testinvalidargs+0xc7>
+     42a:	8b 05 d0 4b 00 00    	mov    0x4bd0(%rip),%eax        # 5000 <stdout>
+     430:	48 8d 15 70 35 00 00 	lea    0x3570(%rip),%rdx        # 39a7 <benchreport+0x30a>
+     437:	48 89 d1             	mov    %rdx,%rcx
+     43a:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     43f:	48 8d 35 6a 35 00 00 	lea    0x356a(%rip),%rsi        # 39b0 <benchreport+0x313>
+     446:	89 c7                	mov    %eax,%edi
+     448:	b8 00 00 00 00       	mov    $0x0,%eax
+     44d:	e8 7e 17 00 00       	call   1bd0 <printf>
+     452:	90                   	nop
+     453:	eb fd                	jmp    452 <testinvalidargs+0xc4>
+
+  if (read(fd, buf, 10) != -1)
+     455:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     459:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     45c:	ba 0a 00 00 00       	mov    $0xa,%edx
+     461:	48 89 ce             	mov    %rcx,%rsi
+     464:	89 c7                	mov    %eax,%edi
+     466:	e8 3a 28 00 00       	call   2ca5 <read>
+     46b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     46e:	74 5c                	je     4cc <testinvalidargs+0x13e>
+    // NOTE: If the test hangs here it's because you're trying to read from
+    // stdin (hint: shouldn't happen).
+    error("able to read from a write only console");
+     470:	8b 05 8a 4b 00 00    	mov    0x4b8a(%rip),%eax        # 5000 <stdout>
+     476:	ba 64 00 00 00       	mov    $0x64,%edx
+     47b:	48 8d 0d 8d 33 00 00 	lea    0x338d(%rip),%rcx        # 380f <benchreport+0x172>
+     482:	48 89 ce             	mov    %rcx,%rsi
+     485:	89 c7                	mov    %eax,%edi
+     487:	b8 00 00 00 00       	mov    $0x0,%eax
+     48c:	e8 3f 17 00 00       	call   1bd0 <printf>
+     491:	8b 05 69 4b 00 00    	mov    0x4b69(%rip),%eax        # 5000 <stdout>
+     497:	48 8d 15 32 35 00 00 	lea    0x3532(%rip),%rdx        # 39d0 <benchreport+0x333>
+     49e:	48 89 d6             	mov    %rdx,%rsi
+     4a1:	89 c7                	mov    %eax,%edi
+     4a3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4a8:	e8 23 17 00 00       	call   1bd0 <printf>
+     4ad:	8b 05 4d 4b 00 00    	mov    0x4b4d(%rip),%eax        # 5000 <stdout>
+     4b3:	48 8d 15 94 33 00 00 	lea    0x3394(%rip),%rdx        # 384e <benchreport+0x1b1>
+     4ba:	48 89 d6             	mov    %rdx,%rsi
+     4bd:	89 c7                	mov    %eax,%edi
+     4bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c4:	e8 07 17 00 00       	call   1bd0 <printf>
+     4c9:	90                   	nop
+     4ca:	eb fd                	jmp    4c9 <testinvalidargs+0x13b>
+  assert(close(fd) == 0);
+     4cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4cf:	89 c7                	mov    %eax,%edi
+     4d1:	e8 94 1d 00 00       	call   226a <close>
+     4d6:	85 c0                	test   %eax,%eax
+     4d8:	74 2b                	je     505 <testinvalidargs+0x177>
+     4da:	8b 05 20 4b 00 00    	mov    0x4b20(%rip),%eax        # 5000 <stdout>
+     4e0:	48 8d 15 10 35 00 00 	lea    0x3510(%rip),%rdx        # 39f7 <benchreport+0x35a>
+     4e7:	48 89 d1             	mov    %rdx,%rcx
+     4ea:	ba 65 00 00 00       	mov    $0x65,%edx
+     4ef:	48 8d 35 ba 34 00 00 	lea    0x34ba(%rip),%rsi        # 39b0 <benchreport+0x313>
+     4f6:	89 c7                	mov    %eax,%edi
+     4f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4fd:	e8 ce 16 00 00       	call   1bd0 <printf>
+     502:	90                   	nop
+     503:	eb fd                	jmp    502 <testinvalidargs+0x174>
+
+  fd = open("/small.txt", O_RDONLY);
+     505:	be 00 00 00 00       	mov    $0x0,%esi
+     50a:	48 8d 05 3f 33 00 00 	lea    0x333f(%rip),%rax        # 3850 <benchreport+0x1b3>
+     511:	48 89 c7             	mov    %rax,%rdi
+     514:	e8 c3 27 00 00       	call   2cdc <open>
+     519:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if ((i = read(fd, buf, -100)) != -1)
+     51c:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     523:	ba 9c ff ff ff       	mov    $0xffffff9c,%edx
+     528:	48 89 ce             	mov    %rcx,%rsi
+     52b:	89 c7                	mov    %eax,%edi
+     52d:	e8 73 27 00 00       	call   2ca5 <read>
+     532:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     535:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     539:	74 5f                	je     59a <testinvalidargs+0x20c>
+    error("negative n didn't return error, return value was '%d'", i);
+     53b:	8b 05 bf 4a 00 00    	mov    0x4abf(%rip),%eax        # 5000 <stdout>
+     541:	ba 6a 00 00 00       	mov    $0x6a,%edx
+     546:	48 8d 0d c2 32 00 00 	lea    0x32c2(%rip),%rcx        # 380f <benchreport+0x172>
+     54d:	48 89 ce             	mov    %rcx,%rsi
+     550:	89 c7                	mov    %eax,%edi
+     552:	b8 00 00 00 00       	mov    $0x0,%eax
+     557:	e8 74 16 00 00       	call   1bd0 <printf>
+     55c:	8b 05 9e 4a 00 00    	mov    0x4a9e(%rip),%eax        # 5000 <stdout>
+     562:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     565:	48 8d 0d 9c 34 00 00 	lea    0x349c(%rip),%rcx        # 3a08 <benchreport+0x36b>
+     56c:	48 89 ce             	mov    %rcx,%rsi
+     56f:	89 c7                	mov    %eax,%edi
+     571:	b8 00 00 00 00       	mov    $0x0,%eax
+     576:	e8 55 16 00 00       	call   1bd0 <printf>
+     57b:	8b 05 7f 4a 00 00    	mov    0x4a7f(%rip),%eax        # 5000 <stdout>
+     581:	48 8d 15 c6 32 00 00 	lea    0x32c6(%rip),%rdx        # 384e <benchreport+0x1b1>
+     588:	48 89 d6             	mov    %rdx,%rsi
+     58b:	89 c7                	mov    %eax,%edi
+     58d:	b8 00 00 00 00       	mov    $0x0,%eax
+     592:	e8 39 16 00 00       	call   1bd0 <printf>
+     597:	90                   	nop
+     598:	eb fd                	jmp    597 <testinvalidargs+0x209>
+
+  if (read(fd, (char *)0xffffff00, 10) != -1)
+     59a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     59d:	ba 0a 00 00 00       	mov    $0xa,%edx
+     5a2:	b9 00 ff ff ff       	mov    $0xffffff00,%ecx
+     5a7:	48 89 ce             	mov    %rcx,%rsi
+     5aa:	89 c7                	mov    %eax,%edi
+     5ac:	e8 f4 26 00 00       	call   2ca5 <read>
+     5b1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5b4:	74 5c                	je     612 <testinvalidargs+0x284>
+    error("able to read to a buffer not in my memory region");
+     5b6:	8b 05 44 4a 00 00    	mov    0x4a44(%rip),%eax        # 5000 <stdout>
+     5bc:	ba 6d 00 00 00       	mov    $0x6d,%edx
+     5c1:	48 8d 0d 47 32 00 00 	lea    0x3247(%rip),%rcx        # 380f <benchreport+0x172>
+     5c8:	48 89 ce             	mov    %rcx,%rsi
+     5cb:	89 c7                	mov    %eax,%edi
+     5cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     5d2:	e8 f9 15 00 00       	call   1bd0 <printf>
+     5d7:	8b 05 23 4a 00 00    	mov    0x4a23(%rip),%eax        # 5000 <stdout>
+     5dd:	48 8d 15 5c 34 00 00 	lea    0x345c(%rip),%rdx        # 3a40 <benchreport+0x3a3>
+     5e4:	48 89 d6             	mov    %rdx,%rsi
+     5e7:	89 c7                	mov    %eax,%edi
+     5e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ee:	e8 dd 15 00 00       	call   1bd0 <printf>
+     5f3:	8b 05 07 4a 00 00    	mov    0x4a07(%rip),%eax        # 5000 <stdout>
+     5f9:	48 8d 15 4e 32 00 00 	lea    0x324e(%rip),%rdx        # 384e <benchreport+0x1b1>
+     600:	48 89 d6             	mov    %rdx,%rsi
+     603:	89 c7                	mov    %eax,%edi
+     605:	b8 00 00 00 00       	mov    $0x0,%eax
+     60a:	e8 c1 15 00 00       	call   1bd0 <printf>
+     60f:	90                   	nop
+     610:	eb fd                	jmp    60f <testinvalidargs+0x281>
+
+  printf(stdout, "passed argument checking for read\n");
+     612:	8b 05 e8 49 00 00    	mov    0x49e8(%rip),%eax        # 5000 <stdout>
+     618:	48 8d 15 59 34 00 00 	lea    0x3459(%rip),%rdx        # 3a78 <benchreport+0x3db>
+     61f:	48 89 d6             	mov    %rdx,%rsi
+     622:	89 c7                	mov    %eax,%edi
+     624:	b8 00 00 00 00       	mov    $0x0,%eax
+     629:	e8 a2 15 00 00       	call   1bd0 <printf>
+
+  // write
+  if (write(15, buf, 11) != -1)
+     62e:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     632:	ba 0b 00 00 00       	mov    $0xb,%edx
+     637:	48 89 c6             	mov    %rax,%rsi
+     63a:	bf 0f 00 00 00       	mov    $0xf,%edi
+     63f:	e8 6c 26 00 00       	call   2cb0 <write>
+     644:	83 f8 ff             	cmp    $0xffffffff,%eax
+     647:	74 5c                	je     6a5 <testinvalidargs+0x317>
+    error("write on a non existent file descriptor");
+     649:	8b 05 b1 49 00 00    	mov    0x49b1(%rip),%eax        # 5000 <stdout>
+     64f:	ba 73 00 00 00       	mov    $0x73,%edx
+     654:	48 8d 0d b4 31 00 00 	lea    0x31b4(%rip),%rcx        # 380f <benchreport+0x172>
+     65b:	48 89 ce             	mov    %rcx,%rsi
+     65e:	89 c7                	mov    %eax,%edi
+     660:	b8 00 00 00 00       	mov    $0x0,%eax
+     665:	e8 66 15 00 00       	call   1bd0 <printf>
+     66a:	8b 05 90 49 00 00    	mov    0x4990(%rip),%eax        # 5000 <stdout>
+     670:	48 8d 15 29 34 00 00 	lea    0x3429(%rip),%rdx        # 3aa0 <benchreport+0x403>
+     677:	48 89 d6             	mov    %rdx,%rsi
+     67a:	89 c7                	mov    %eax,%edi
+     67c:	b8 00 00 00 00       	mov    $0x0,%eax
+     681:	e8 4a 15 00 00       	call   1bd0 <printf>
+     686:	8b 05 74 49 00 00    	mov    0x4974(%rip),%eax        # 5000 <stdout>
+     68c:	48 8d 15 bb 31 00 00 	lea    0x31bb(%rip),%rdx        # 384e <benchreport+0x1b1>
+     693:	48 89 d6             	mov    %rdx,%rsi
+     696:	89 c7                	mov    %eax,%edi
+     698:	b8 00 00 00 00       	mov    $0x0,%eax
+     69d:	e8 2e 15 00 00       	call   1bd0 <printf>
+     6a2:	90                   	nop
+     6a3:	eb fd                	jmp    6a2 <testinvalidargs+0x314>
+
+  if (write(fd, buf, 11) != -1)
+     6a5:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     6a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6ac:	ba 0b 00 00 00       	mov    $0xb,%edx
+     6b1:	48 89 ce             	mov    %rcx,%rsi
+     6b4:	89 c7                	mov    %eax,%edi
+     6b6:	e8 f5 25 00 00       	call   2cb0 <write>
+     6bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6be:	74 5c                	je     71c <testinvalidargs+0x38e>
+    error("able to write to a file in read only fs");
+     6c0:	8b 05 3a 49 00 00    	mov    0x493a(%rip),%eax        # 5000 <stdout>
+     6c6:	ba 76 00 00 00       	mov    $0x76,%edx
+     6cb:	48 8d 0d 3d 31 00 00 	lea    0x313d(%rip),%rcx        # 380f <benchreport+0x172>
+     6d2:	48 89 ce             	mov    %rcx,%rsi
+     6d5:	89 c7                	mov    %eax,%edi
+     6d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6dc:	e8 ef 14 00 00       	call   1bd0 <printf>
+     6e1:	8b 05 19 49 00 00    	mov    0x4919(%rip),%eax        # 5000 <stdout>
+     6e7:	48 8d 15 da 33 00 00 	lea    0x33da(%rip),%rdx        # 3ac8 <benchreport+0x42b>
+     6ee:	48 89 d6             	mov    %rdx,%rsi
+     6f1:	89 c7                	mov    %eax,%edi
+     6f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f8:	e8 d3 14 00 00       	call   1bd0 <printf>
+     6fd:	8b 05 fd 48 00 00    	mov    0x48fd(%rip),%eax        # 5000 <stdout>
+     703:	48 8d 15 44 31 00 00 	lea    0x3144(%rip),%rdx        # 384e <benchreport+0x1b1>
+     70a:	48 89 d6             	mov    %rdx,%rsi
+     70d:	89 c7                	mov    %eax,%edi
+     70f:	b8 00 00 00 00       	mov    $0x0,%eax
+     714:	e8 b7 14 00 00       	call   1bd0 <printf>
+     719:	90                   	nop
+     71a:	eb fd                	jmp    719 <testinvalidargs+0x38b>
+
+  printf(stdout, "passed argument checking for write\n");
+     71c:	8b 05 de 48 00 00    	mov    0x48de(%rip),%eax        # 5000 <stdout>
+     722:	48 8d 15 c7 33 00 00 	lea    0x33c7(%rip),%rdx        # 3af0 <benchreport+0x453>
+     729:	48 89 d6             	mov    %rdx,%rsi
+     72c:	89 c7                	mov    %eax,%edi
+     72e:	b8 00 00 00 00       	mov    $0x0,%eax
+     733:	e8 98 14 00 00       	call   1bd0 <printf>
+
+  // stat
+  if (fstat(15, &st) != -1)
+     738:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     73c:	48 89 c6             	mov    %rax,%rsi
+     73f:	bf 0f 00 00 00       	mov    $0xf,%edi
+     744:	e8 b4 25 00 00       	call   2cfd <fstat>
+     749:	83 f8 ff             	cmp    $0xffffffff,%eax
+     74c:	74 5c                	je     7aa <testinvalidargs+0x41c>
+    error("tried to fstat on a non existent file descriptor");
+     74e:	8b 05 ac 48 00 00    	mov    0x48ac(%rip),%eax        # 5000 <stdout>
+     754:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     759:	48 8d 0d af 30 00 00 	lea    0x30af(%rip),%rcx        # 380f <benchreport+0x172>
+     760:	48 89 ce             	mov    %rcx,%rsi
+     763:	89 c7                	mov    %eax,%edi
+     765:	b8 00 00 00 00       	mov    $0x0,%eax
+     76a:	e8 61 14 00 00       	call   1bd0 <printf>
+     76f:	8b 05 8b 48 00 00    	mov    0x488b(%rip),%eax        # 5000 <stdout>
+     775:	48 8d 15 9c 33 00 00 	lea    0x339c(%rip),%rdx        # 3b18 <benchreport+0x47b>
+     77c:	48 89 d6             	mov    %rdx,%rsi
+     77f:	89 c7                	mov    %eax,%edi
+     781:	b8 00 00 00 00       	mov    $0x0,%eax
+     786:	e8 45 14 00 00       	call   1bd0 <printf>
+     78b:	8b 05 6f 48 00 00    	mov    0x486f(%rip),%eax        # 5000 <stdout>
+     791:	48 8d 15 b6 30 00 00 	lea    0x30b6(%rip),%rdx        # 384e <benchreport+0x1b1>
+     798:	48 89 d6             	mov    %rdx,%rsi
+     79b:	89 c7                	mov    %eax,%edi
+     79d:	b8 00 00 00 00       	mov    $0x0,%eax
+     7a2:	e8 29 14 00 00       	call   1bd0 <printf>
+     7a7:	90                   	nop
+     7a8:	eb fd                	jmp    7a7 <testinvalidargs+0x419>
+
+  if (fstat(stdout, &st) != 0) error("couldn't fstat on stdout");
+     7aa:	8b 05 50 48 00 00    	mov    0x4850(%rip),%eax        # 5000 <stdout>
+     7b0:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+     7b4:	48 89 d6             	mov    %rdx,%rsi
+     7b7:	89 c7                	mov    %eax,%edi
+     7b9:	e8 3f 25 00 00       	call   2cfd <fstat>
+     7be:	85 c0                	test   %eax,%eax
+     7c0:	74 5c                	je     81e <testinvalidargs+0x490>
+     7c2:	8b 05 38 48 00 00    	mov    0x4838(%rip),%eax        # 5000 <stdout>
+     7c8:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     7cd:	48 8d 0d 3b 30 00 00 	lea    0x303b(%rip),%rcx        # 380f <benchreport+0x172>
+     7d4:	48 89 ce             	mov    %rcx,%rsi
+     7d7:	89 c7                	mov    %eax,%edi
+     7d9:	b8 00 00 00 00       	mov    $0x0,%eax
+     7de:	e8 ed 13 00 00       	call   1bd0 <printf>
+     7e3:	8b 05 17 48 00 00    	mov    0x4817(%rip),%eax        # 5000 <stdout>
+     7e9:	48 8d 15 59 33 00 00 	lea    0x3359(%rip),%rdx        # 3b49 <benchreport+0x4ac>
+     7f0:	48 89 d6             	mov    %rdx,%rsi
+     7f3:	89 c7                	mov    %eax,%edi
+     7f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     7fa:	e8 d1 13 00 00       	call   1bd0 <printf>
+     7ff:	8b 05 fb 47 00 00    	mov    0x47fb(%rip),%eax        # 5000 <stdout>
+     805:	48 8d 15 42 30 00 00 	lea    0x3042(%rip),%rdx        # 384e <benchreport+0x1b1>
+     80c:	48 89 d6             	mov    %rdx,%rsi
+     80f:	89 c7                	mov    %eax,%edi
+     811:	b8 00 00 00 00       	mov    $0x0,%eax
+     816:	e8 b5 13 00 00       	call   1bd0 <printf>
+     81b:	90                   	nop
+     81c:	eb fd                	jmp    81b <testinvalidargs+0x48d>
+
+  assert(st.type == T_DEV);
+     81e:	0f b7 45 dc          	movzwl -0x24(%rbp),%eax
+     822:	66 83 f8 03          	cmp    $0x3,%ax
+     826:	74 2b                	je     853 <testinvalidargs+0x4c5>
+     828:	8b 05 d2 47 00 00    	mov    0x47d2(%rip),%eax        # 5000 <stdout>
+     82e:	48 8d 15 2d 33 00 00 	lea    0x332d(%rip),%rdx        # 3b62 <benchreport+0x4c5>
+     835:	48 89 d1             	mov    %rdx,%rcx
+     838:	ba 80 00 00 00       	mov    $0x80,%edx
+     83d:	48 8d 35 6c 31 00 00 	lea    0x316c(%rip),%rsi        # 39b0 <benchreport+0x313>
+     844:	89 c7                	mov    %eax,%edi
+     846:	b8 00 00 00 00       	mov    $0x0,%eax
+     84b:	e8 80 13 00 00       	call   1bd0 <printf>
+     850:	90                   	nop
+     851:	eb fd                	jmp    850 <testinvalidargs+0x4c2>
+  assert(st.size == 0);
+     853:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     856:	85 c0                	test   %eax,%eax
+     858:	74 2b                	je     885 <testinvalidargs+0x4f7>
+     85a:	8b 05 a0 47 00 00    	mov    0x47a0(%rip),%eax        # 5000 <stdout>
+     860:	48 8d 15 0c 33 00 00 	lea    0x330c(%rip),%rdx        # 3b73 <benchreport+0x4d6>
+     867:	48 89 d1             	mov    %rdx,%rcx
+     86a:	ba 81 00 00 00       	mov    $0x81,%edx
+     86f:	48 8d 35 3a 31 00 00 	lea    0x313a(%rip),%rsi        # 39b0 <benchreport+0x313>
+     876:	89 c7                	mov    %eax,%edi
+     878:	b8 00 00 00 00       	mov    $0x0,%eax
+     87d:	e8 4e 13 00 00       	call   1bd0 <printf>
+     882:	90                   	nop
+     883:	eb fd                	jmp    882 <testinvalidargs+0x4f4>
+
+  if (stat("/small.txt", &st) != 0) error("couldn't stat on '/small.txt'");
+     885:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     889:	48 89 c6             	mov    %rax,%rsi
+     88c:	48 8d 05 bd 2f 00 00 	lea    0x2fbd(%rip),%rax        # 3850 <benchreport+0x1b3>
+     893:	48 89 c7             	mov    %rax,%rdi
+     896:	e8 a8 1e 00 00       	call   2743 <stat>
+     89b:	85 c0                	test   %eax,%eax
+     89d:	74 5c                	je     8fb <testinvalidargs+0x56d>
+     89f:	8b 05 5b 47 00 00    	mov    0x475b(%rip),%eax        # 5000 <stdout>
+     8a5:	ba 83 00 00 00       	mov    $0x83,%edx
+     8aa:	48 8d 0d 5e 2f 00 00 	lea    0x2f5e(%rip),%rcx        # 380f <benchreport+0x172>
+     8b1:	48 89 ce             	mov    %rcx,%rsi
+     8b4:	89 c7                	mov    %eax,%edi
+     8b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     8bb:	e8 10 13 00 00       	call   1bd0 <printf>
+     8c0:	8b 05 3a 47 00 00    	mov    0x473a(%rip),%eax        # 5000 <stdout>
+     8c6:	48 8d 15 b3 32 00 00 	lea    0x32b3(%rip),%rdx        # 3b80 <benchreport+0x4e3>
+     8cd:	48 89 d6             	mov    %rdx,%rsi
+     8d0:	89 c7                	mov    %eax,%edi
+     8d2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d7:	e8 f4 12 00 00       	call   1bd0 <printf>
+     8dc:	8b 05 1e 47 00 00    	mov    0x471e(%rip),%eax        # 5000 <stdout>
+     8e2:	48 8d 15 65 2f 00 00 	lea    0x2f65(%rip),%rdx        # 384e <benchreport+0x1b1>
+     8e9:	48 89 d6             	mov    %rdx,%rsi
+     8ec:	89 c7                	mov    %eax,%edi
+     8ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f3:	e8 d8 12 00 00       	call   1bd0 <printf>
+     8f8:	90                   	nop
+     8f9:	eb fd                	jmp    8f8 <testinvalidargs+0x56a>
+
+  assert(st.type == T_FILE);
+     8fb:	0f b7 45 dc          	movzwl -0x24(%rbp),%eax
+     8ff:	66 83 f8 02          	cmp    $0x2,%ax
+     903:	74 2b                	je     930 <testinvalidargs+0x5a2>
+     905:	8b 05 f5 46 00 00    	mov    0x46f5(%rip),%eax        # 5000 <stdout>
+     90b:	48 8d 15 8c 32 00 00 	lea    0x328c(%rip),%rdx        # 3b9e <benchreport+0x501>
+     912:	48 89 d1             	mov    %rdx,%rcx
+     915:	ba 85 00 00 00       	mov    $0x85,%edx
+     91a:	48 8d 35 8f 30 00 00 	lea    0x308f(%rip),%rsi        # 39b0 <benchreport+0x313>
+     921:	89 c7                	mov    %eax,%edi
+     923:	b8 00 00 00 00       	mov    $0x0,%eax
+     928:	e8 a3 12 00 00       	call   1bd0 <printf>
+     92d:	90                   	nop
+     92e:	eb fd                	jmp    92d <testinvalidargs+0x59f>
+  assert(st.size == 26);
+     930:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     933:	83 f8 1a             	cmp    $0x1a,%eax
+     936:	74 2b                	je     963 <testinvalidargs+0x5d5>
+     938:	8b 05 c2 46 00 00    	mov    0x46c2(%rip),%eax        # 5000 <stdout>
+     93e:	48 8d 15 6b 32 00 00 	lea    0x326b(%rip),%rdx        # 3bb0 <benchreport+0x513>
+     945:	48 89 d1             	mov    %rdx,%rcx
+     948:	ba 86 00 00 00       	mov    $0x86,%edx
+     94d:	48 8d 35 5c 30 00 00 	lea    0x305c(%rip),%rsi        # 39b0 <benchreport+0x313>
+     954:	89 c7                	mov    %eax,%edi
+     956:	b8 00 00 00 00       	mov    $0x0,%eax
+     95b:	e8 70 12 00 00       	call   1bd0 <printf>
+     960:	90                   	nop
+     961:	eb fd                	jmp    960 <testinvalidargs+0x5d2>
+
+  printf(stdout, "passed argument checking for fstat\n");
+     963:	8b 05 97 46 00 00    	mov    0x4697(%rip),%eax        # 5000 <stdout>
+     969:	48 8d 15 50 32 00 00 	lea    0x3250(%rip),%rdx        # 3bc0 <benchreport+0x523>
+     970:	48 89 d6             	mov    %rdx,%rsi
+     973:	89 c7                	mov    %eax,%edi
+     975:	b8 00 00 00 00       	mov    $0x0,%eax
+     97a:	e8 51 12 00 00       	call   1bd0 <printf>
+
+  // dup
+  if (dup(15) != -1)
+     97f:	bf 0f 00 00 00       	mov    $0xf,%edi
+     984:	e8 a0 23 00 00       	call   2d29 <dup>
+     989:	83 f8 ff             	cmp    $0xffffffff,%eax
+     98c:	74 5c                	je     9ea <testinvalidargs+0x65c>
+    error("able to duplicated a non open file");
+     98e:	8b 05 6c 46 00 00    	mov    0x466c(%rip),%eax        # 5000 <stdout>
+     994:	ba 8c 00 00 00       	mov    $0x8c,%edx
+     999:	48 8d 0d 6f 2e 00 00 	lea    0x2e6f(%rip),%rcx        # 380f <benchreport+0x172>
+     9a0:	48 89 ce             	mov    %rcx,%rsi
+     9a3:	89 c7                	mov    %eax,%edi
+     9a5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9aa:	e8 21 12 00 00       	call   1bd0 <printf>
+     9af:	8b 05 4b 46 00 00    	mov    0x464b(%rip),%eax        # 5000 <stdout>
+     9b5:	48 8d 15 2c 32 00 00 	lea    0x322c(%rip),%rdx        # 3be8 <benchreport+0x54b>
+     9bc:	48 89 d6             	mov    %rdx,%rsi
+     9bf:	89 c7                	mov    %eax,%edi
+     9c1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9c6:	e8 05 12 00 00       	call   1bd0 <printf>
+     9cb:	8b 05 2f 46 00 00    	mov    0x462f(%rip),%eax        # 5000 <stdout>
+     9d1:	48 8d 15 76 2e 00 00 	lea    0x2e76(%rip),%rdx        # 384e <benchreport+0x1b1>
+     9d8:	48 89 d6             	mov    %rdx,%rsi
+     9db:	89 c7                	mov    %eax,%edi
+     9dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     9e2:	e8 e9 11 00 00       	call   1bd0 <printf>
+     9e7:	90                   	nop
+     9e8:	eb fd                	jmp    9e7 <testinvalidargs+0x659>
+
+  printf(stdout, "passed argument checking for dup\n");
+     9ea:	8b 05 10 46 00 00    	mov    0x4610(%rip),%eax        # 5000 <stdout>
+     9f0:	48 8d 15 19 32 00 00 	lea    0x3219(%rip),%rdx        # 3c10 <benchreport+0x573>
+     9f7:	48 89 d6             	mov    %rdx,%rsi
+     9fa:	89 c7                	mov    %eax,%edi
+     9fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     a01:	e8 ca 11 00 00       	call   1bd0 <printf>
+
+  // close
+  if (close(15) != -1)
+     a06:	bf 0f 00 00 00       	mov    $0xf,%edi
+     a0b:	e8 5a 18 00 00       	call   226a <close>
+     a10:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a13:	74 5c                	je     a71 <testinvalidargs+0x6e3>
+    error("able to close non open file");
+     a15:	8b 05 e5 45 00 00    	mov    0x45e5(%rip),%eax        # 5000 <stdout>
+     a1b:	ba 92 00 00 00       	mov    $0x92,%edx
+     a20:	48 8d 0d e8 2d 00 00 	lea    0x2de8(%rip),%rcx        # 380f <benchreport+0x172>
+     a27:	48 89 ce             	mov    %rcx,%rsi
+     a2a:	89 c7                	mov    %eax,%edi
+     a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+     a31:	e8 9a 11 00 00       	call   1bd0 <printf>
+     a36:	8b 05 c4 45 00 00    	mov    0x45c4(%rip),%eax        # 5000 <stdout>
+     a3c:	48 8d 15 ef 31 00 00 	lea    0x31ef(%rip),%rdx        # 3c32 <benchreport+0x595>
+     a43:	48 89 d6             	mov    %rdx,%rsi
+     a46:	89 c7                	mov    %eax,%edi
+     a48:	b8 00 00 00 00       	mov    $0x0,%eax
+     a4d:	e8 7e 11 00 00       	call   1bd0 <printf>
+     a52:	8b 05 a8 45 00 00    	mov    0x45a8(%rip),%eax        # 5000 <stdout>
+     a58:	48 8d 15 ef 2d 00 00 	lea    0x2def(%rip),%rdx        # 384e <benchreport+0x1b1>
+     a5f:	48 89 d6             	mov    %rdx,%rsi
+     a62:	89 c7                	mov    %eax,%edi
+     a64:	b8 00 00 00 00       	mov    $0x0,%eax
+     a69:	e8 62 11 00 00       	call   1bd0 <printf>
+     a6e:	90                   	nop
+     a6f:	eb fd                	jmp    a6e <testinvalidargs+0x6e0>
+
+  if (close(fd) > 0 && close(fd) != -1)
+     a71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a74:	89 c7                	mov    %eax,%edi
+     a76:	e8 ef 17 00 00       	call   226a <close>
+     a7b:	85 c0                	test   %eax,%eax
+     a7d:	7e 6b                	jle    aea <testinvalidargs+0x75c>
+     a7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a82:	89 c7                	mov    %eax,%edi
+     a84:	e8 e1 17 00 00       	call   226a <close>
+     a89:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a8c:	74 5c                	je     aea <testinvalidargs+0x75c>
+    error("able to close same file twice");
+     a8e:	8b 05 6c 45 00 00    	mov    0x456c(%rip),%eax        # 5000 <stdout>
+     a94:	ba 95 00 00 00       	mov    $0x95,%edx
+     a99:	48 8d 0d 6f 2d 00 00 	lea    0x2d6f(%rip),%rcx        # 380f <benchreport+0x172>
+     aa0:	48 89 ce             	mov    %rcx,%rsi
+     aa3:	89 c7                	mov    %eax,%edi
+     aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+     aaa:	e8 21 11 00 00       	call   1bd0 <printf>
+     aaf:	8b 05 4b 45 00 00    	mov    0x454b(%rip),%eax        # 5000 <stdout>
+     ab5:	48 8d 15 92 31 00 00 	lea    0x3192(%rip),%rdx        # 3c4e <benchreport+0x5b1>
+     abc:	48 89 d6             	mov    %rdx,%rsi
+     abf:	89 c7                	mov    %eax,%edi
+     ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac6:	e8 05 11 00 00       	call   1bd0 <printf>
+     acb:	8b 05 2f 45 00 00    	mov    0x452f(%rip),%eax        # 5000 <stdout>
+     ad1:	48 8d 15 76 2d 00 00 	lea    0x2d76(%rip),%rdx        # 384e <benchreport+0x1b1>
+     ad8:	48 89 d6             	mov    %rdx,%rsi
+     adb:	89 c7                	mov    %eax,%edi
+     add:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae2:	e8 e9 10 00 00       	call   1bd0 <printf>
+     ae7:	90                   	nop
+     ae8:	eb fd                	jmp    ae7 <testinvalidargs+0x759>
+
+  printf(stdout, "passed argument checking for close\n");
+     aea:	8b 05 10 45 00 00    	mov    0x4510(%rip),%eax        # 5000 <stdout>
+     af0:	48 8d 15 79 31 00 00 	lea    0x3179(%rip),%rdx        # 3c70 <benchreport+0x5d3>
+     af7:	48 89 d6             	mov    %rdx,%rsi
+     afa:	89 c7                	mov    %eax,%edi
+     afc:	b8 00 00 00 00       	mov    $0x0,%eax
+     b01:	e8 ca 10 00 00       	call   1bd0 <printf>
+}
+     b06:	90                   	nop
+     b07:	c9                   	leave
+     b08:	c3                   	ret
+
+0000000000000b09 <smallfilereadtest>:
+
+void smallfilereadtest(void) {
+     b09:	55                   	push   %rbp
+     b0a:	48 89 e5             	mov    %rsp,%rbp
+     b0d:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, i;
+  char buf[11];
+
+  printf(stdout, "small file test\n");
+     b11:	8b 05 e9 44 00 00    	mov    0x44e9(%rip),%eax        # 5000 <stdout>
+     b17:	48 8d 15 76 31 00 00 	lea    0x3176(%rip),%rdx        # 3c94 <benchreport+0x5f7>
+     b1e:	48 89 d6             	mov    %rdx,%rsi
+     b21:	89 c7                	mov    %eax,%edi
+     b23:	b8 00 00 00 00       	mov    $0x0,%eax
+     b28:	e8 a3 10 00 00       	call   1bd0 <printf>
+  // Test read only funcionality
+  fd = open("/small.txt", O_RDONLY);
+     b2d:	be 00 00 00 00       	mov    $0x0,%esi
+     b32:	48 8d 05 17 2d 00 00 	lea    0x2d17(%rip),%rax        # 3850 <benchreport+0x1b3>
+     b39:	48 89 c7             	mov    %rax,%rdi
+     b3c:	e8 9b 21 00 00       	call   2cdc <open>
+     b41:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0)
+     b44:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b48:	79 5c                	jns    ba6 <smallfilereadtest+0x9d>
+    error("unable to open small file");
+     b4a:	8b 05 b0 44 00 00    	mov    0x44b0(%rip),%eax        # 5000 <stdout>
+     b50:	ba a2 00 00 00       	mov    $0xa2,%edx
+     b55:	48 8d 0d b3 2c 00 00 	lea    0x2cb3(%rip),%rcx        # 380f <benchreport+0x172>
+     b5c:	48 89 ce             	mov    %rcx,%rsi
+     b5f:	89 c7                	mov    %eax,%edi
+     b61:	b8 00 00 00 00       	mov    $0x0,%eax
+     b66:	e8 65 10 00 00       	call   1bd0 <printf>
+     b6b:	8b 05 8f 44 00 00    	mov    0x448f(%rip),%eax        # 5000 <stdout>
+     b71:	48 8d 15 2d 31 00 00 	lea    0x312d(%rip),%rdx        # 3ca5 <benchreport+0x608>
+     b78:	48 89 d6             	mov    %rdx,%rsi
+     b7b:	89 c7                	mov    %eax,%edi
+     b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+     b82:	e8 49 10 00 00       	call   1bd0 <printf>
+     b87:	8b 05 73 44 00 00    	mov    0x4473(%rip),%eax        # 5000 <stdout>
+     b8d:	48 8d 15 ba 2c 00 00 	lea    0x2cba(%rip),%rdx        # 384e <benchreport+0x1b1>
+     b94:	48 89 d6             	mov    %rdx,%rsi
+     b97:	89 c7                	mov    %eax,%edi
+     b99:	b8 00 00 00 00       	mov    $0x0,%eax
+     b9e:	e8 2d 10 00 00       	call   1bd0 <printf>
+     ba3:	90                   	nop
+     ba4:	eb fd                	jmp    ba3 <smallfilereadtest+0x9a>
+
+  printf(stdout, "open small file succeeded; ok\n");
+     ba6:	8b 05 54 44 00 00    	mov    0x4454(%rip),%eax        # 5000 <stdout>
+     bac:	48 8d 15 0d 31 00 00 	lea    0x310d(%rip),%rdx        # 3cc0 <benchreport+0x623>
+     bb3:	48 89 d6             	mov    %rdx,%rsi
+     bb6:	89 c7                	mov    %eax,%edi
+     bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+     bbd:	e8 0e 10 00 00       	call   1bd0 <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     bc2:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     bc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bc9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     bce:	48 89 ce             	mov    %rcx,%rsi
+     bd1:	89 c7                	mov    %eax,%edi
+     bd3:	e8 cd 20 00 00       	call   2ca5 <read>
+     bd8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     bdb:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     bdf:	74 5f                	je     c40 <smallfilereadtest+0x137>
+    error("read of first 10 bytes unsucessful was %d bytes", i);
+     be1:	8b 05 19 44 00 00    	mov    0x4419(%rip),%eax        # 5000 <stdout>
+     be7:	ba a7 00 00 00       	mov    $0xa7,%edx
+     bec:	48 8d 0d 1c 2c 00 00 	lea    0x2c1c(%rip),%rcx        # 380f <benchreport+0x172>
+     bf3:	48 89 ce             	mov    %rcx,%rsi
+     bf6:	89 c7                	mov    %eax,%edi
+     bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+     bfd:	e8 ce 0f 00 00       	call   1bd0 <printf>
+     c02:	8b 05 f8 43 00 00    	mov    0x43f8(%rip),%eax        # 5000 <stdout>
+     c08:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     c0b:	48 8d 0d ce 30 00 00 	lea    0x30ce(%rip),%rcx        # 3ce0 <benchreport+0x643>
+     c12:	48 89 ce             	mov    %rcx,%rsi
+     c15:	89 c7                	mov    %eax,%edi
+     c17:	b8 00 00 00 00       	mov    $0x0,%eax
+     c1c:	e8 af 0f 00 00       	call   1bd0 <printf>
+     c21:	8b 05 d9 43 00 00    	mov    0x43d9(%rip),%eax        # 5000 <stdout>
+     c27:	48 8d 15 20 2c 00 00 	lea    0x2c20(%rip),%rdx        # 384e <benchreport+0x1b1>
+     c2e:	48 89 d6             	mov    %rdx,%rsi
+     c31:	89 c7                	mov    %eax,%edi
+     c33:	b8 00 00 00 00       	mov    $0x0,%eax
+     c38:	e8 93 0f 00 00       	call   1bd0 <printf>
+     c3d:	90                   	nop
+     c3e:	eb fd                	jmp    c3d <smallfilereadtest+0x134>
+
+  buf[10] = 0;
+     c40:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+     c44:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     c48:	48 8d 15 c1 30 00 00 	lea    0x30c1(%rip),%rdx        # 3d10 <benchreport+0x673>
+     c4f:	48 89 d6             	mov    %rdx,%rsi
+     c52:	48 89 c7             	mov    %rax,%rdi
+     c55:	e8 a9 18 00 00       	call   2503 <strcmp>
+     c5a:	85 c0                	test   %eax,%eax
+     c5c:	74 60                	je     cbe <smallfilereadtest+0x1b5>
+    error("buf was not 10 a's, was: '%s'", buf);
+     c5e:	8b 05 9c 43 00 00    	mov    0x439c(%rip),%eax        # 5000 <stdout>
+     c64:	ba ab 00 00 00       	mov    $0xab,%edx
+     c69:	48 8d 0d 9f 2b 00 00 	lea    0x2b9f(%rip),%rcx        # 380f <benchreport+0x172>
+     c70:	48 89 ce             	mov    %rcx,%rsi
+     c73:	89 c7                	mov    %eax,%edi
+     c75:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7a:	e8 51 0f 00 00       	call   1bd0 <printf>
+     c7f:	8b 05 7b 43 00 00    	mov    0x437b(%rip),%eax        # 5000 <stdout>
+     c85:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     c89:	48 8d 0d 8b 30 00 00 	lea    0x308b(%rip),%rcx        # 3d1b <benchreport+0x67e>
+     c90:	48 89 ce             	mov    %rcx,%rsi
+     c93:	89 c7                	mov    %eax,%edi
+     c95:	b8 00 00 00 00       	mov    $0x0,%eax
+     c9a:	e8 31 0f 00 00       	call   1bd0 <printf>
+     c9f:	8b 05 5b 43 00 00    	mov    0x435b(%rip),%eax        # 5000 <stdout>
+     ca5:	48 8d 15 a2 2b 00 00 	lea    0x2ba2(%rip),%rdx        # 384e <benchreport+0x1b1>
+     cac:	48 89 d6             	mov    %rdx,%rsi
+     caf:	89 c7                	mov    %eax,%edi
+     cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb6:	e8 15 0f 00 00       	call   1bd0 <printf>
+     cbb:	90                   	nop
+     cbc:	eb fd                	jmp    cbb <smallfilereadtest+0x1b2>
+  printf(stdout, "read of first 10 bytes sucessful\n");
+     cbe:	8b 05 3c 43 00 00    	mov    0x433c(%rip),%eax        # 5000 <stdout>
+     cc4:	48 8d 15 75 30 00 00 	lea    0x3075(%rip),%rdx        # 3d40 <benchreport+0x6a3>
+     ccb:	48 89 d6             	mov    %rdx,%rsi
+     cce:	89 c7                	mov    %eax,%edi
+     cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd5:	e8 f6 0e 00 00       	call   1bd0 <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     cda:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     cde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ce1:	ba 0a 00 00 00       	mov    $0xa,%edx
+     ce6:	48 89 ce             	mov    %rcx,%rsi
+     ce9:	89 c7                	mov    %eax,%edi
+     ceb:	e8 b5 1f 00 00       	call   2ca5 <read>
+     cf0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     cf3:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     cf7:	74 5f                	je     d58 <smallfilereadtest+0x24f>
+    error("read of second 10 bytes unsucessful was %d bytes", i);
+     cf9:	8b 05 01 43 00 00    	mov    0x4301(%rip),%eax        # 5000 <stdout>
+     cff:	ba af 00 00 00       	mov    $0xaf,%edx
+     d04:	48 8d 0d 04 2b 00 00 	lea    0x2b04(%rip),%rcx        # 380f <benchreport+0x172>
+     d0b:	48 89 ce             	mov    %rcx,%rsi
+     d0e:	89 c7                	mov    %eax,%edi
+     d10:	b8 00 00 00 00       	mov    $0x0,%eax
+     d15:	e8 b6 0e 00 00       	call   1bd0 <printf>
+     d1a:	8b 05 e0 42 00 00    	mov    0x42e0(%rip),%eax        # 5000 <stdout>
+     d20:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     d23:	48 8d 0d 3e 30 00 00 	lea    0x303e(%rip),%rcx        # 3d68 <benchreport+0x6cb>
+     d2a:	48 89 ce             	mov    %rcx,%rsi
+     d2d:	89 c7                	mov    %eax,%edi
+     d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+     d34:	e8 97 0e 00 00       	call   1bd0 <printf>
+     d39:	8b 05 c1 42 00 00    	mov    0x42c1(%rip),%eax        # 5000 <stdout>
+     d3f:	48 8d 15 08 2b 00 00 	lea    0x2b08(%rip),%rdx        # 384e <benchreport+0x1b1>
+     d46:	48 89 d6             	mov    %rdx,%rsi
+     d49:	89 c7                	mov    %eax,%edi
+     d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+     d50:	e8 7b 0e 00 00       	call   1bd0 <printf>
+     d55:	90                   	nop
+     d56:	eb fd                	jmp    d55 <smallfilereadtest+0x24c>
+
+  buf[10] = 0;
+     d58:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+     d5c:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     d60:	48 8d 15 32 30 00 00 	lea    0x3032(%rip),%rdx        # 3d99 <benchreport+0x6fc>
+     d67:	48 89 d6             	mov    %rdx,%rsi
+     d6a:	48 89 c7             	mov    %rax,%rdi
+     d6d:	e8 91 17 00 00       	call   2503 <strcmp>
+     d72:	85 c0                	test   %eax,%eax
+     d74:	74 60                	je     dd6 <smallfilereadtest+0x2cd>
+    error("buf was not 10 b's, was: '%s'", buf);
+     d76:	8b 05 84 42 00 00    	mov    0x4284(%rip),%eax        # 5000 <stdout>
+     d7c:	ba b3 00 00 00       	mov    $0xb3,%edx
+     d81:	48 8d 0d 87 2a 00 00 	lea    0x2a87(%rip),%rcx        # 380f <benchreport+0x172>
+     d88:	48 89 ce             	mov    %rcx,%rsi
+     d8b:	89 c7                	mov    %eax,%edi
+     d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d92:	e8 39 0e 00 00       	call   1bd0 <printf>
+     d97:	8b 05 63 42 00 00    	mov    0x4263(%rip),%eax        # 5000 <stdout>
+     d9d:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     da1:	48 8d 0d fc 2f 00 00 	lea    0x2ffc(%rip),%rcx        # 3da4 <benchreport+0x707>
+     da8:	48 89 ce             	mov    %rcx,%rsi
+     dab:	89 c7                	mov    %eax,%edi
+     dad:	b8 00 00 00 00       	mov    $0x0,%eax
+     db2:	e8 19 0e 00 00       	call   1bd0 <printf>
+     db7:	8b 05 43 42 00 00    	mov    0x4243(%rip),%eax        # 5000 <stdout>
+     dbd:	48 8d 15 8a 2a 00 00 	lea    0x2a8a(%rip),%rdx        # 384e <benchreport+0x1b1>
+     dc4:	48 89 d6             	mov    %rdx,%rsi
+     dc7:	89 c7                	mov    %eax,%edi
+     dc9:	b8 00 00 00 00       	mov    $0x0,%eax
+     dce:	e8 fd 0d 00 00       	call   1bd0 <printf>
+     dd3:	90                   	nop
+     dd4:	eb fd                	jmp    dd3 <smallfilereadtest+0x2ca>
+  printf(stdout, "read of second 10 bytes sucessful\n");
+     dd6:	8b 05 24 42 00 00    	mov    0x4224(%rip),%eax        # 5000 <stdout>
+     ddc:	48 8d 15 e5 2f 00 00 	lea    0x2fe5(%rip),%rdx        # 3dc8 <benchreport+0x72b>
+     de3:	48 89 d6             	mov    %rdx,%rsi
+     de6:	89 c7                	mov    %eax,%edi
+     de8:	b8 00 00 00 00       	mov    $0x0,%eax
+     ded:	e8 de 0d 00 00       	call   1bd0 <printf>
+
+  // only 25 byte file
+  if ((i = read(fd, buf, 10)) != 6)
+     df2:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     df6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     df9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     dfe:	48 89 ce             	mov    %rcx,%rsi
+     e01:	89 c7                	mov    %eax,%edi
+     e03:	e8 9d 1e 00 00       	call   2ca5 <read>
+     e08:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     e0b:	83 7d f8 06          	cmpl   $0x6,-0x8(%rbp)
+     e0f:	74 5f                	je     e70 <smallfilereadtest+0x367>
+    error("read of last 6 bytes unsucessful was %d bytes", i);
+     e11:	8b 05 e9 41 00 00    	mov    0x41e9(%rip),%eax        # 5000 <stdout>
+     e17:	ba b8 00 00 00       	mov    $0xb8,%edx
+     e1c:	48 8d 0d ec 29 00 00 	lea    0x29ec(%rip),%rcx        # 380f <benchreport+0x172>
+     e23:	48 89 ce             	mov    %rcx,%rsi
+     e26:	89 c7                	mov    %eax,%edi
+     e28:	b8 00 00 00 00       	mov    $0x0,%eax
+     e2d:	e8 9e 0d 00 00       	call   1bd0 <printf>
+     e32:	8b 05 c8 41 00 00    	mov    0x41c8(%rip),%eax        # 5000 <stdout>
+     e38:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     e3b:	48 8d 0d ae 2f 00 00 	lea    0x2fae(%rip),%rcx        # 3df0 <benchreport+0x753>
+     e42:	48 89 ce             	mov    %rcx,%rsi
+     e45:	89 c7                	mov    %eax,%edi
+     e47:	b8 00 00 00 00       	mov    $0x0,%eax
+     e4c:	e8 7f 0d 00 00       	call   1bd0 <printf>
+     e51:	8b 05 a9 41 00 00    	mov    0x41a9(%rip),%eax        # 5000 <stdout>
+     e57:	48 8d 15 f0 29 00 00 	lea    0x29f0(%rip),%rdx        # 384e <benchreport+0x1b1>
+     e5e:	48 89 d6             	mov    %rdx,%rsi
+     e61:	89 c7                	mov    %eax,%edi
+     e63:	b8 00 00 00 00       	mov    $0x0,%eax
+     e68:	e8 63 0d 00 00       	call   1bd0 <printf>
+     e6d:	90                   	nop
+     e6e:	eb fd                	jmp    e6d <smallfilereadtest+0x364>
+
+  buf[6] = 0;
+     e70:	c6 45 f3 00          	movb   $0x0,-0xd(%rbp)
+  if (strcmp(buf, "ccccc\n") != 0)
+     e74:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     e78:	48 8d 15 9f 2f 00 00 	lea    0x2f9f(%rip),%rdx        # 3e1e <benchreport+0x781>
+     e7f:	48 89 d6             	mov    %rdx,%rsi
+     e82:	48 89 c7             	mov    %rax,%rdi
+     e85:	e8 79 16 00 00       	call   2503 <strcmp>
+     e8a:	85 c0                	test   %eax,%eax
+     e8c:	74 60                	je     eee <smallfilereadtest+0x3e5>
+    error("buf was not 5 c's (and a newline), was: '%s'", buf);
+     e8e:	8b 05 6c 41 00 00    	mov    0x416c(%rip),%eax        # 5000 <stdout>
+     e94:	ba bc 00 00 00       	mov    $0xbc,%edx
+     e99:	48 8d 0d 6f 29 00 00 	lea    0x296f(%rip),%rcx        # 380f <benchreport+0x172>
+     ea0:	48 89 ce             	mov    %rcx,%rsi
+     ea3:	89 c7                	mov    %eax,%edi
+     ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eaa:	e8 21 0d 00 00       	call   1bd0 <printf>
+     eaf:	8b 05 4b 41 00 00    	mov    0x414b(%rip),%eax        # 5000 <stdout>
+     eb5:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     eb9:	48 8d 0d 68 2f 00 00 	lea    0x2f68(%rip),%rcx        # 3e28 <benchreport+0x78b>
+     ec0:	48 89 ce             	mov    %rcx,%rsi
+     ec3:	89 c7                	mov    %eax,%edi
+     ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eca:	e8 01 0d 00 00       	call   1bd0 <printf>
+     ecf:	8b 05 2b 41 00 00    	mov    0x412b(%rip),%eax        # 5000 <stdout>
+     ed5:	48 8d 15 72 29 00 00 	lea    0x2972(%rip),%rdx        # 384e <benchreport+0x1b1>
+     edc:	48 89 d6             	mov    %rdx,%rsi
+     edf:	89 c7                	mov    %eax,%edi
+     ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee6:	e8 e5 0c 00 00       	call   1bd0 <printf>
+     eeb:	90                   	nop
+     eec:	eb fd                	jmp    eeb <smallfilereadtest+0x3e2>
+
+  printf(stdout, "read of last 5 bytes sucessful\n");
+     eee:	8b 05 0c 41 00 00    	mov    0x410c(%rip),%eax        # 5000 <stdout>
+     ef4:	48 8d 15 5d 2f 00 00 	lea    0x2f5d(%rip),%rdx        # 3e58 <benchreport+0x7bb>
+     efb:	48 89 d6             	mov    %rdx,%rsi
+     efe:	89 c7                	mov    %eax,%edi
+     f00:	b8 00 00 00 00       	mov    $0x0,%eax
+     f05:	e8 c6 0c 00 00       	call   1bd0 <printf>
+
+  if (read(fd, buf, 10) != 0)
+     f0a:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     f0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f11:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f16:	48 89 ce             	mov    %rcx,%rsi
+     f19:	89 c7                	mov    %eax,%edi
+     f1b:	e8 85 1d 00 00       	call   2ca5 <read>
+     f20:	85 c0                	test   %eax,%eax
+     f22:	74 5c                	je     f80 <smallfilereadtest+0x477>
+    error("read more bytes than should be possible");
+     f24:	8b 05 d6 40 00 00    	mov    0x40d6(%rip),%eax        # 5000 <stdout>
+     f2a:	ba c1 00 00 00       	mov    $0xc1,%edx
+     f2f:	48 8d 0d d9 28 00 00 	lea    0x28d9(%rip),%rcx        # 380f <benchreport+0x172>
+     f36:	48 89 ce             	mov    %rcx,%rsi
+     f39:	89 c7                	mov    %eax,%edi
+     f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+     f40:	e8 8b 0c 00 00       	call   1bd0 <printf>
+     f45:	8b 05 b5 40 00 00    	mov    0x40b5(%rip),%eax        # 5000 <stdout>
+     f4b:	48 8d 15 26 2f 00 00 	lea    0x2f26(%rip),%rdx        # 3e78 <benchreport+0x7db>
+     f52:	48 89 d6             	mov    %rdx,%rsi
+     f55:	89 c7                	mov    %eax,%edi
+     f57:	b8 00 00 00 00       	mov    $0x0,%eax
+     f5c:	e8 6f 0c 00 00       	call   1bd0 <printf>
+     f61:	8b 05 99 40 00 00    	mov    0x4099(%rip),%eax        # 5000 <stdout>
+     f67:	48 8d 15 e0 28 00 00 	lea    0x28e0(%rip),%rdx        # 384e <benchreport+0x1b1>
+     f6e:	48 89 d6             	mov    %rdx,%rsi
+     f71:	89 c7                	mov    %eax,%edi
+     f73:	b8 00 00 00 00       	mov    $0x0,%eax
+     f78:	e8 53 0c 00 00       	call   1bd0 <printf>
+     f7d:	90                   	nop
+     f7e:	eb fd                	jmp    f7d <smallfilereadtest+0x474>
+
+  strcpy(buf, "stdout\n");
+     f80:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     f84:	48 8d 15 15 2f 00 00 	lea    0x2f15(%rip),%rdx        # 3ea0 <benchreport+0x803>
+     f8b:	48 89 d6             	mov    %rdx,%rsi
+     f8e:	48 89 c7             	mov    %rax,%rdi
+     f91:	e8 2e 15 00 00       	call   24c4 <strcpy>
+
+  if ((i = write(stdout, buf, 7)) != 7)
+     f96:	8b 05 64 40 00 00    	mov    0x4064(%rip),%eax        # 5000 <stdout>
+     f9c:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     fa0:	ba 07 00 00 00       	mov    $0x7,%edx
+     fa5:	48 89 ce             	mov    %rcx,%rsi
+     fa8:	89 c7                	mov    %eax,%edi
+     faa:	e8 01 1d 00 00       	call   2cb0 <write>
+     faf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     fb2:	83 7d f8 07          	cmpl   $0x7,-0x8(%rbp)
+     fb6:	74 5f                	je     1017 <smallfilereadtest+0x50e>
+    error("wasn't able to write to stdout, return value was '%d'", i);
+     fb8:	8b 05 42 40 00 00    	mov    0x4042(%rip),%eax        # 5000 <stdout>
+     fbe:	ba c6 00 00 00       	mov    $0xc6,%edx
+     fc3:	48 8d 0d 45 28 00 00 	lea    0x2845(%rip),%rcx        # 380f <benchreport+0x172>
+     fca:	48 89 ce             	mov    %rcx,%rsi
+     fcd:	89 c7                	mov    %eax,%edi
+     fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+     fd4:	e8 f7 0b 00 00       	call   1bd0 <printf>
+     fd9:	8b 05 21 40 00 00    	mov    0x4021(%rip),%eax        # 5000 <stdout>
+     fdf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     fe2:	48 8d 0d bf 2e 00 00 	lea    0x2ebf(%rip),%rcx        # 3ea8 <benchreport+0x80b>
+     fe9:	48 89 ce             	mov    %rcx,%rsi
+     fec:	89 c7                	mov    %eax,%edi
+     fee:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff3:	e8 d8 0b 00 00       	call   1bd0 <printf>
+     ff8:	8b 05 02 40 00 00    	mov    0x4002(%rip),%eax        # 5000 <stdout>
+     ffe:	48 8d 15 49 28 00 00 	lea    0x2849(%rip),%rdx        # 384e <benchreport+0x1b1>
+    1005:	48 89 d6             	mov    %rdx,%rsi
+    1008:	89 c7                	mov    %eax,%edi
+    100a:	b8 00 00 00 00       	mov    $0x0,%eax
+    100f:	e8 bc 0b 00 00       	call   1bd0 <printf>
+    1014:	90                   	nop
+    1015:	eb fd                	jmp    1014 <smallfilereadtest+0x50b>
+
+  printf(stdout, "write to stdout directly ok\n");
+    1017:	8b 05 e3 3f 00 00    	mov    0x3fe3(%rip),%eax        # 5000 <stdout>
+    101d:	48 8d 15 ba 2e 00 00 	lea    0x2eba(%rip),%rdx        # 3ede <benchreport+0x841>
+    1024:	48 89 d6             	mov    %rdx,%rsi
+    1027:	89 c7                	mov    %eax,%edi
+    1029:	b8 00 00 00 00       	mov    $0x0,%eax
+    102e:	e8 9d 0b 00 00       	call   1bd0 <printf>
+
+  if (close(fd) != 0)
+    1033:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1036:	89 c7                	mov    %eax,%edi
+    1038:	e8 2d 12 00 00       	call   226a <close>
+    103d:	85 c0                	test   %eax,%eax
+    103f:	74 5c                	je     109d <smallfilereadtest+0x594>
+    error("error closing fd");
+    1041:	8b 05 b9 3f 00 00    	mov    0x3fb9(%rip),%eax        # 5000 <stdout>
+    1047:	ba cb 00 00 00       	mov    $0xcb,%edx
+    104c:	48 8d 0d bc 27 00 00 	lea    0x27bc(%rip),%rcx        # 380f <benchreport+0x172>
+    1053:	48 89 ce             	mov    %rcx,%rsi
+    1056:	89 c7                	mov    %eax,%edi
+    1058:	b8 00 00 00 00       	mov    $0x0,%eax
+    105d:	e8 6e 0b 00 00       	call   1bd0 <printf>
+    1062:	8b 05 98 3f 00 00    	mov    0x3f98(%rip),%eax        # 5000 <stdout>
+    1068:	48 8d 15 8c 2e 00 00 	lea    0x2e8c(%rip),%rdx        # 3efb <benchreport+0x85e>
+    106f:	48 89 d6             	mov    %rdx,%rsi
+    1072:	89 c7                	mov    %eax,%edi
+    1074:	b8 00 00 00 00       	mov    $0x0,%eax
+    1079:	e8 52 0b 00 00       	call   1bd0 <printf>
+    107e:	8b 05 7c 3f 00 00    	mov    0x3f7c(%rip),%eax        # 5000 <stdout>
+    1084:	48 8d 15 c3 27 00 00 	lea    0x27c3(%rip),%rdx        # 384e <benchreport+0x1b1>
+    108b:	48 89 d6             	mov    %rdx,%rsi
+    108e:	89 c7                	mov    %eax,%edi
+    1090:	b8 00 00 00 00       	mov    $0x0,%eax
+    1095:	e8 36 0b 00 00       	call   1bd0 <printf>
+    109a:	90                   	nop
+    109b:	eb fd                	jmp    109a <smallfilereadtest+0x591>
+
+  printf(stdout, "small file test ok\n");
+    109d:	8b 05 5d 3f 00 00    	mov    0x3f5d(%rip),%eax        # 5000 <stdout>
+    10a3:	48 8d 15 62 2e 00 00 	lea    0x2e62(%rip),%rdx        # 3f0c <benchreport+0x86f>
+    10aa:	48 89 d6             	mov    %rdx,%rsi
+    10ad:	89 c7                	mov    %eax,%edi
+    10af:	b8 00 00 00 00       	mov    $0x0,%eax
+    10b4:	e8 17 0b 00 00       	call   1bd0 <printf>
+}
+    10b9:	90                   	nop
+    10ba:	c9                   	leave
+    10bb:	c3                   	ret
+
+00000000000010bc <duptest>:
+
+void duptest(void) {
+    10bc:	55                   	push   %rbp
+    10bd:	48 89 e5             	mov    %rsp,%rbp
+    10c0:	53                   	push   %rbx
+    10c1:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  int fd1, fd2, stdout_cpy;
+  char buf[100];
+
+  printf(stdout, "dup test\n");
+    10c8:	8b 05 32 3f 00 00    	mov    0x3f32(%rip),%eax        # 5000 <stdout>
+    10ce:	48 8d 15 4b 2e 00 00 	lea    0x2e4b(%rip),%rdx        # 3f20 <benchreport+0x883>
+    10d5:	48 89 d6             	mov    %rdx,%rsi
+    10d8:	89 c7                	mov    %eax,%edi
+    10da:	b8 00 00 00 00       	mov    $0x0,%eax
+    10df:	e8 ec 0a 00 00       	call   1bd0 <printf>
+  // Test read only funcionality
+  fd1 = open("/small.txt", O_RDONLY);
+    10e4:	be 00 00 00 00       	mov    $0x0,%esi
+    10e9:	48 8d 05 60 27 00 00 	lea    0x2760(%rip),%rax        # 3850 <benchreport+0x1b3>
+    10f0:	48 89 c7             	mov    %rax,%rdi
+    10f3:	e8 e4 1b 00 00       	call   2cdc <open>
+    10f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd1 < 0)
+    10fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    10ff:	79 5c                	jns    115d <duptest+0xa1>
+    error("unable to open small file");
+    1101:	8b 05 f9 3e 00 00    	mov    0x3ef9(%rip),%eax        # 5000 <stdout>
+    1107:	ba d8 00 00 00       	mov    $0xd8,%edx
+    110c:	48 8d 0d fc 26 00 00 	lea    0x26fc(%rip),%rcx        # 380f <benchreport+0x172>
+    1113:	48 89 ce             	mov    %rcx,%rsi
+    1116:	89 c7                	mov    %eax,%edi
+    1118:	b8 00 00 00 00       	mov    $0x0,%eax
+    111d:	e8 ae 0a 00 00       	call   1bd0 <printf>
+    1122:	8b 05 d8 3e 00 00    	mov    0x3ed8(%rip),%eax        # 5000 <stdout>
+    1128:	48 8d 15 76 2b 00 00 	lea    0x2b76(%rip),%rdx        # 3ca5 <benchreport+0x608>
+    112f:	48 89 d6             	mov    %rdx,%rsi
+    1132:	89 c7                	mov    %eax,%edi
+    1134:	b8 00 00 00 00       	mov    $0x0,%eax
+    1139:	e8 92 0a 00 00       	call   1bd0 <printf>
+    113e:	8b 05 bc 3e 00 00    	mov    0x3ebc(%rip),%eax        # 5000 <stdout>
+    1144:	48 8d 15 03 27 00 00 	lea    0x2703(%rip),%rdx        # 384e <benchreport+0x1b1>
+    114b:	48 89 d6             	mov    %rdx,%rsi
+    114e:	89 c7                	mov    %eax,%edi
+    1150:	b8 00 00 00 00       	mov    $0x0,%eax
+    1155:	e8 76 0a 00 00       	call   1bd0 <printf>
+    115a:	90                   	nop
+    115b:	eb fd                	jmp    115a <duptest+0x9e>
+
+  if ((fd2 = dup(fd1)) != fd1 + 1)
+    115d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1160:	89 c7                	mov    %eax,%edi
+    1162:	e8 c2 1b 00 00       	call   2d29 <dup>
+    1167:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    116a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    116d:	83 c0 01             	add    $0x1,%eax
+    1170:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+    1173:	74 5f                	je     11d4 <duptest+0x118>
+    error("returned fd from dup was not the smallest free fd, was '%d'", fd2);
+    1175:	8b 05 85 3e 00 00    	mov    0x3e85(%rip),%eax        # 5000 <stdout>
+    117b:	ba db 00 00 00       	mov    $0xdb,%edx
+    1180:	48 8d 0d 88 26 00 00 	lea    0x2688(%rip),%rcx        # 380f <benchreport+0x172>
+    1187:	48 89 ce             	mov    %rcx,%rsi
+    118a:	89 c7                	mov    %eax,%edi
+    118c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1191:	e8 3a 0a 00 00       	call   1bd0 <printf>
+    1196:	8b 05 64 3e 00 00    	mov    0x3e64(%rip),%eax        # 5000 <stdout>
+    119c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    119f:	48 8d 0d 8a 2d 00 00 	lea    0x2d8a(%rip),%rcx        # 3f30 <benchreport+0x893>
+    11a6:	48 89 ce             	mov    %rcx,%rsi
+    11a9:	89 c7                	mov    %eax,%edi
+    11ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    11b0:	e8 1b 0a 00 00       	call   1bd0 <printf>
+    11b5:	8b 05 45 3e 00 00    	mov    0x3e45(%rip),%eax        # 5000 <stdout>
+    11bb:	48 8d 15 8c 26 00 00 	lea    0x268c(%rip),%rdx        # 384e <benchreport+0x1b1>
+    11c2:	48 89 d6             	mov    %rdx,%rsi
+    11c5:	89 c7                	mov    %eax,%edi
+    11c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cc:	e8 ff 09 00 00       	call   1bd0 <printf>
+    11d1:	90                   	nop
+    11d2:	eb fd                	jmp    11d1 <duptest+0x115>
+
+  // test offsets are respected in dupped files
+  assert(read(fd1, buf, 10) == 10);
+    11d4:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    11db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    11de:	ba 0a 00 00 00       	mov    $0xa,%edx
+    11e3:	48 89 ce             	mov    %rcx,%rsi
+    11e6:	89 c7                	mov    %eax,%edi
+    11e8:	e8 b8 1a 00 00       	call   2ca5 <read>
+    11ed:	83 f8 0a             	cmp    $0xa,%eax
+    11f0:	74 2b                	je     121d <duptest+0x161>
+    11f2:	8b 05 08 3e 00 00    	mov    0x3e08(%rip),%eax        # 5000 <stdout>
+    11f8:	48 8d 15 6d 2d 00 00 	lea    0x2d6d(%rip),%rdx        # 3f6c <benchreport+0x8cf>
+    11ff:	48 89 d1             	mov    %rdx,%rcx
+    1202:	ba de 00 00 00       	mov    $0xde,%edx
+    1207:	48 8d 35 a2 27 00 00 	lea    0x27a2(%rip),%rsi        # 39b0 <benchreport+0x313>
+    120e:	89 c7                	mov    %eax,%edi
+    1210:	b8 00 00 00 00       	mov    $0x0,%eax
+    1215:	e8 b6 09 00 00       	call   1bd0 <printf>
+    121a:	90                   	nop
+    121b:	eb fd                	jmp    121a <duptest+0x15e>
+  buf[10] = 0;
+    121d:	c6 85 7e ff ff ff 00 	movb   $0x0,-0x82(%rbp)
+
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+    1224:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    122b:	48 8d 15 de 2a 00 00 	lea    0x2ade(%rip),%rdx        # 3d10 <benchreport+0x673>
+    1232:	48 89 d6             	mov    %rdx,%rsi
+    1235:	48 89 c7             	mov    %rax,%rdi
+    1238:	e8 c6 12 00 00       	call   2503 <strcmp>
+    123d:	85 c0                	test   %eax,%eax
+    123f:	74 5c                	je     129d <duptest+0x1e1>
+    error("couldn't read from original fd after dup");
+    1241:	8b 05 b9 3d 00 00    	mov    0x3db9(%rip),%eax        # 5000 <stdout>
+    1247:	ba e2 00 00 00       	mov    $0xe2,%edx
+    124c:	48 8d 0d bc 25 00 00 	lea    0x25bc(%rip),%rcx        # 380f <benchreport+0x172>
+    1253:	48 89 ce             	mov    %rcx,%rsi
+    1256:	89 c7                	mov    %eax,%edi
+    1258:	b8 00 00 00 00       	mov    $0x0,%eax
+    125d:	e8 6e 09 00 00       	call   1bd0 <printf>
+    1262:	8b 05 98 3d 00 00    	mov    0x3d98(%rip),%eax        # 5000 <stdout>
+    1268:	48 8d 15 19 2d 00 00 	lea    0x2d19(%rip),%rdx        # 3f88 <benchreport+0x8eb>
+    126f:	48 89 d6             	mov    %rdx,%rsi
+    1272:	89 c7                	mov    %eax,%edi
+    1274:	b8 00 00 00 00       	mov    $0x0,%eax
+    1279:	e8 52 09 00 00       	call   1bd0 <printf>
+    127e:	8b 05 7c 3d 00 00    	mov    0x3d7c(%rip),%eax        # 5000 <stdout>
+    1284:	48 8d 15 c3 25 00 00 	lea    0x25c3(%rip),%rdx        # 384e <benchreport+0x1b1>
+    128b:	48 89 d6             	mov    %rdx,%rsi
+    128e:	89 c7                	mov    %eax,%edi
+    1290:	b8 00 00 00 00       	mov    $0x0,%eax
+    1295:	e8 36 09 00 00       	call   1bd0 <printf>
+    129a:	90                   	nop
+    129b:	eb fd                	jmp    129a <duptest+0x1de>
+
+  if (read(fd2, buf, 10) != 10)
+    129d:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    12a4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    12a7:	ba 0a 00 00 00       	mov    $0xa,%edx
+    12ac:	48 89 ce             	mov    %rcx,%rsi
+    12af:	89 c7                	mov    %eax,%edi
+    12b1:	e8 ef 19 00 00       	call   2ca5 <read>
+    12b6:	83 f8 0a             	cmp    $0xa,%eax
+    12b9:	74 5c                	je     1317 <duptest+0x25b>
+    error("coudn't read from the dupped fd");
+    12bb:	8b 05 3f 3d 00 00    	mov    0x3d3f(%rip),%eax        # 5000 <stdout>
+    12c1:	ba e5 00 00 00       	mov    $0xe5,%edx
+    12c6:	48 8d 0d 42 25 00 00 	lea    0x2542(%rip),%rcx        # 380f <benchreport+0x172>
+    12cd:	48 89 ce             	mov    %rcx,%rsi
+    12d0:	89 c7                	mov    %eax,%edi
+    12d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12d7:	e8 f4 08 00 00       	call   1bd0 <printf>
+    12dc:	8b 05 1e 3d 00 00    	mov    0x3d1e(%rip),%eax        # 5000 <stdout>
+    12e2:	48 8d 15 cf 2c 00 00 	lea    0x2ccf(%rip),%rdx        # 3fb8 <benchreport+0x91b>
+    12e9:	48 89 d6             	mov    %rdx,%rsi
+    12ec:	89 c7                	mov    %eax,%edi
+    12ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f3:	e8 d8 08 00 00       	call   1bd0 <printf>
+    12f8:	8b 05 02 3d 00 00    	mov    0x3d02(%rip),%eax        # 5000 <stdout>
+    12fe:	48 8d 15 49 25 00 00 	lea    0x2549(%rip),%rdx        # 384e <benchreport+0x1b1>
+    1305:	48 89 d6             	mov    %rdx,%rsi
+    1308:	89 c7                	mov    %eax,%edi
+    130a:	b8 00 00 00 00       	mov    $0x0,%eax
+    130f:	e8 bc 08 00 00       	call   1bd0 <printf>
+    1314:	90                   	nop
+    1315:	eb fd                	jmp    1314 <duptest+0x258>
+  buf[10] = 0;
+    1317:	c6 85 7e ff ff ff 00 	movb   $0x0,-0x82(%rbp)
+
+  if (strcmp(buf, "aaaaaaaaaa") == 0)
+    131e:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1325:	48 8d 15 e4 29 00 00 	lea    0x29e4(%rip),%rdx        # 3d10 <benchreport+0x673>
+    132c:	48 89 d6             	mov    %rdx,%rsi
+    132f:	48 89 c7             	mov    %rax,%rdi
+    1332:	e8 cc 11 00 00       	call   2503 <strcmp>
+    1337:	85 c0                	test   %eax,%eax
+    1339:	75 5c                	jne    1397 <duptest+0x2db>
+    error("the duped fd didn't respect the read offset from the other file.");
+    133b:	8b 05 bf 3c 00 00    	mov    0x3cbf(%rip),%eax        # 5000 <stdout>
+    1341:	ba e9 00 00 00       	mov    $0xe9,%edx
+    1346:	48 8d 0d c2 24 00 00 	lea    0x24c2(%rip),%rcx        # 380f <benchreport+0x172>
+    134d:	48 89 ce             	mov    %rcx,%rsi
+    1350:	89 c7                	mov    %eax,%edi
+    1352:	b8 00 00 00 00       	mov    $0x0,%eax
+    1357:	e8 74 08 00 00       	call   1bd0 <printf>
+    135c:	8b 05 9e 3c 00 00    	mov    0x3c9e(%rip),%eax        # 5000 <stdout>
+    1362:	48 8d 15 6f 2c 00 00 	lea    0x2c6f(%rip),%rdx        # 3fd8 <benchreport+0x93b>
+    1369:	48 89 d6             	mov    %rdx,%rsi
+    136c:	89 c7                	mov    %eax,%edi
+    136e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1373:	e8 58 08 00 00       	call   1bd0 <printf>
+    1378:	8b 05 82 3c 00 00    	mov    0x3c82(%rip),%eax        # 5000 <stdout>
+    137e:	48 8d 15 c9 24 00 00 	lea    0x24c9(%rip),%rdx        # 384e <benchreport+0x1b1>
+    1385:	48 89 d6             	mov    %rdx,%rsi
+    1388:	89 c7                	mov    %eax,%edi
+    138a:	b8 00 00 00 00       	mov    $0x0,%eax
+    138f:	e8 3c 08 00 00       	call   1bd0 <printf>
+    1394:	90                   	nop
+    1395:	eb fd                	jmp    1394 <duptest+0x2d8>
+
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+    1397:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    139e:	48 8d 15 f4 29 00 00 	lea    0x29f4(%rip),%rdx        # 3d99 <benchreport+0x6fc>
+    13a5:	48 89 d6             	mov    %rdx,%rsi
+    13a8:	48 89 c7             	mov    %rax,%rdi
+    13ab:	e8 53 11 00 00       	call   2503 <strcmp>
+    13b0:	85 c0                	test   %eax,%eax
+    13b2:	74 5c                	je     1410 <duptest+0x354>
+    error(
+    13b4:	8b 05 46 3c 00 00    	mov    0x3c46(%rip),%eax        # 5000 <stdout>
+    13ba:	ba ec 00 00 00       	mov    $0xec,%edx
+    13bf:	48 8d 0d 49 24 00 00 	lea    0x2449(%rip),%rcx        # 380f <benchreport+0x172>
+    13c6:	48 89 ce             	mov    %rcx,%rsi
+    13c9:	89 c7                	mov    %eax,%edi
+    13cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    13d0:	e8 fb 07 00 00       	call   1bd0 <printf>
+    13d5:	8b 05 25 3c 00 00    	mov    0x3c25(%rip),%eax        # 5000 <stdout>
+    13db:	48 8d 15 3e 2c 00 00 	lea    0x2c3e(%rip),%rdx        # 4020 <benchreport+0x983>
+    13e2:	48 89 d6             	mov    %rdx,%rsi
+    13e5:	89 c7                	mov    %eax,%edi
+    13e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    13ec:	e8 df 07 00 00       	call   1bd0 <printf>
+    13f1:	8b 05 09 3c 00 00    	mov    0x3c09(%rip),%eax        # 5000 <stdout>
+    13f7:	48 8d 15 50 24 00 00 	lea    0x2450(%rip),%rdx        # 384e <benchreport+0x1b1>
+    13fe:	48 89 d6             	mov    %rdx,%rsi
+    1401:	89 c7                	mov    %eax,%edi
+    1403:	b8 00 00 00 00       	mov    $0x0,%eax
+    1408:	e8 c3 07 00 00       	call   1bd0 <printf>
+    140d:	90                   	nop
+    140e:	eb fd                	jmp    140d <duptest+0x351>
+        "the duped fd didn't read the correct 10 bytes at the 10 byte offset");
+
+  if (close(fd1) != 0)
+    1410:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1413:	89 c7                	mov    %eax,%edi
+    1415:	e8 50 0e 00 00       	call   226a <close>
+    141a:	85 c0                	test   %eax,%eax
+    141c:	74 5c                	je     147a <duptest+0x3be>
+    error("closing the original file");
+    141e:	8b 05 dc 3b 00 00    	mov    0x3bdc(%rip),%eax        # 5000 <stdout>
+    1424:	ba f0 00 00 00       	mov    $0xf0,%edx
+    1429:	48 8d 0d df 23 00 00 	lea    0x23df(%rip),%rcx        # 380f <benchreport+0x172>
+    1430:	48 89 ce             	mov    %rcx,%rsi
+    1433:	89 c7                	mov    %eax,%edi
+    1435:	b8 00 00 00 00       	mov    $0x0,%eax
+    143a:	e8 91 07 00 00       	call   1bd0 <printf>
+    143f:	8b 05 bb 3b 00 00    	mov    0x3bbb(%rip),%eax        # 5000 <stdout>
+    1445:	48 8d 15 18 2c 00 00 	lea    0x2c18(%rip),%rdx        # 4064 <benchreport+0x9c7>
+    144c:	48 89 d6             	mov    %rdx,%rsi
+    144f:	89 c7                	mov    %eax,%edi
+    1451:	b8 00 00 00 00       	mov    $0x0,%eax
+    1456:	e8 75 07 00 00       	call   1bd0 <printf>
+    145b:	8b 05 9f 3b 00 00    	mov    0x3b9f(%rip),%eax        # 5000 <stdout>
+    1461:	48 8d 15 e6 23 00 00 	lea    0x23e6(%rip),%rdx        # 384e <benchreport+0x1b1>
+    1468:	48 89 d6             	mov    %rdx,%rsi
+    146b:	89 c7                	mov    %eax,%edi
+    146d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1472:	e8 59 07 00 00       	call   1bd0 <printf>
+    1477:	90                   	nop
+    1478:	eb fd                	jmp    1477 <duptest+0x3bb>
+
+  if (read(fd2, buf, 5) != 5)
+    147a:	48 8d 8d 74 ff ff ff 	lea    -0x8c(%rbp),%rcx
+    1481:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1484:	ba 05 00 00 00       	mov    $0x5,%edx
+    1489:	48 89 ce             	mov    %rcx,%rsi
+    148c:	89 c7                	mov    %eax,%edi
+    148e:	e8 12 18 00 00       	call   2ca5 <read>
+    1493:	83 f8 05             	cmp    $0x5,%eax
+    1496:	74 5c                	je     14f4 <duptest+0x438>
+    error("wasn't able to read from the duped file after the original file was "
+    1498:	8b 05 62 3b 00 00    	mov    0x3b62(%rip),%eax        # 5000 <stdout>
+    149e:	ba f3 00 00 00       	mov    $0xf3,%edx
+    14a3:	48 8d 0d 65 23 00 00 	lea    0x2365(%rip),%rcx        # 380f <benchreport+0x172>
+    14aa:	48 89 ce             	mov    %rcx,%rsi
+    14ad:	89 c7                	mov    %eax,%edi
+    14af:	b8 00 00 00 00       	mov    $0x0,%eax
+    14b4:	e8 17 07 00 00       	call   1bd0 <printf>
+    14b9:	8b 05 41 3b 00 00    	mov    0x3b41(%rip),%eax        # 5000 <stdout>
+    14bf:	48 8d 15 ba 2b 00 00 	lea    0x2bba(%rip),%rdx        # 4080 <benchreport+0x9e3>
+    14c6:	48 89 d6             	mov    %rdx,%rsi
+    14c9:	89 c7                	mov    %eax,%edi
+    14cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    14d0:	e8 fb 06 00 00       	call   1bd0 <printf>
+    14d5:	8b 05 25 3b 00 00    	mov    0x3b25(%rip),%eax        # 5000 <stdout>
+    14db:	48 8d 15 6c 23 00 00 	lea    0x236c(%rip),%rdx        # 384e <benchreport+0x1b1>
+    14e2:	48 89 d6             	mov    %rdx,%rsi
+    14e5:	89 c7                	mov    %eax,%edi
+    14e7:	b8 00 00 00 00       	mov    $0x0,%eax
+    14ec:	e8 df 06 00 00       	call   1bd0 <printf>
+    14f1:	90                   	nop
+    14f2:	eb fd                	jmp    14f1 <duptest+0x435>
+          "closed");
+
+  buf[5] = 0;
+    14f4:	c6 85 79 ff ff ff 00 	movb   $0x0,-0x87(%rbp)
+  assert(strcmp(buf, "ccccc") == 0);
+    14fb:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1502:	48 8d 15 c2 2b 00 00 	lea    0x2bc2(%rip),%rdx        # 40cb <benchreport+0xa2e>
+    1509:	48 89 d6             	mov    %rdx,%rsi
+    150c:	48 89 c7             	mov    %rax,%rdi
+    150f:	e8 ef 0f 00 00       	call   2503 <strcmp>
+    1514:	85 c0                	test   %eax,%eax
+    1516:	74 2b                	je     1543 <duptest+0x487>
+    1518:	8b 05 e2 3a 00 00    	mov    0x3ae2(%rip),%eax        # 5000 <stdout>
+    151e:	48 8d 15 ac 2b 00 00 	lea    0x2bac(%rip),%rdx        # 40d1 <benchreport+0xa34>
+    1525:	48 89 d1             	mov    %rdx,%rcx
+    1528:	ba f7 00 00 00       	mov    $0xf7,%edx
+    152d:	48 8d 35 7c 24 00 00 	lea    0x247c(%rip),%rsi        # 39b0 <benchreport+0x313>
+    1534:	89 c7                	mov    %eax,%edi
+    1536:	b8 00 00 00 00       	mov    $0x0,%eax
+    153b:	e8 90 06 00 00       	call   1bd0 <printf>
+    1540:	90                   	nop
+    1541:	eb fd                	jmp    1540 <duptest+0x484>
+
+  printf(stdout, "dup read offsets ok\n");
+    1543:	8b 05 b7 3a 00 00    	mov    0x3ab7(%rip),%eax        # 5000 <stdout>
+    1549:	48 8d 15 9b 2b 00 00 	lea    0x2b9b(%rip),%rdx        # 40eb <benchreport+0xa4e>
+    1550:	48 89 d6             	mov    %rdx,%rsi
+    1553:	89 c7                	mov    %eax,%edi
+    1555:	b8 00 00 00 00       	mov    $0x0,%eax
+    155a:	e8 71 06 00 00       	call   1bd0 <printf>
+
+  if (close(fd2) != 0)
+    155f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1562:	89 c7                	mov    %eax,%edi
+    1564:	e8 01 0d 00 00       	call   226a <close>
+    1569:	85 c0                	test   %eax,%eax
+    156b:	74 5c                	je     15c9 <duptest+0x50d>
+    error("closing the duped file");
+    156d:	8b 05 8d 3a 00 00    	mov    0x3a8d(%rip),%eax        # 5000 <stdout>
+    1573:	ba fc 00 00 00       	mov    $0xfc,%edx
+    1578:	48 8d 0d 90 22 00 00 	lea    0x2290(%rip),%rcx        # 380f <benchreport+0x172>
+    157f:	48 89 ce             	mov    %rcx,%rsi
+    1582:	89 c7                	mov    %eax,%edi
+    1584:	b8 00 00 00 00       	mov    $0x0,%eax
+    1589:	e8 42 06 00 00       	call   1bd0 <printf>
+    158e:	8b 05 6c 3a 00 00    	mov    0x3a6c(%rip),%eax        # 5000 <stdout>
+    1594:	48 8d 15 65 2b 00 00 	lea    0x2b65(%rip),%rdx        # 4100 <benchreport+0xa63>
+    159b:	48 89 d6             	mov    %rdx,%rsi
+    159e:	89 c7                	mov    %eax,%edi
+    15a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    15a5:	e8 26 06 00 00       	call   1bd0 <printf>
+    15aa:	8b 05 50 3a 00 00    	mov    0x3a50(%rip),%eax        # 5000 <stdout>
+    15b0:	48 8d 15 97 22 00 00 	lea    0x2297(%rip),%rdx        # 384e <benchreport+0x1b1>
+    15b7:	48 89 d6             	mov    %rdx,%rsi
+    15ba:	89 c7                	mov    %eax,%edi
+    15bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    15c1:	e8 0a 06 00 00       	call   1bd0 <printf>
+    15c6:	90                   	nop
+    15c7:	eb fd                	jmp    15c6 <duptest+0x50a>
+
+  // test duping of stdout
+  // should be fd1, because that is the first file I opened (and closed) earlier
+  if ((stdout_cpy = dup(stdout)) != fd1)
+    15c9:	8b 05 31 3a 00 00    	mov    0x3a31(%rip),%eax        # 5000 <stdout>
+    15cf:	89 c7                	mov    %eax,%edi
+    15d1:	e8 53 17 00 00       	call   2d29 <dup>
+    15d6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    15d9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    15dc:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    15df:	74 5f                	je     1640 <duptest+0x584>
+    error("returned fd from dup that was not the smallest free fd, was '%d'",
+    15e1:	8b 05 19 3a 00 00    	mov    0x3a19(%rip),%eax        # 5000 <stdout>
+    15e7:	ba 01 01 00 00       	mov    $0x101,%edx
+    15ec:	48 8d 0d 1c 22 00 00 	lea    0x221c(%rip),%rcx        # 380f <benchreport+0x172>
+    15f3:	48 89 ce             	mov    %rcx,%rsi
+    15f6:	89 c7                	mov    %eax,%edi
+    15f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    15fd:	e8 ce 05 00 00       	call   1bd0 <printf>
+    1602:	8b 05 f8 39 00 00    	mov    0x39f8(%rip),%eax        # 5000 <stdout>
+    1608:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    160b:	48 8d 0d 06 2b 00 00 	lea    0x2b06(%rip),%rcx        # 4118 <benchreport+0xa7b>
+    1612:	48 89 ce             	mov    %rcx,%rsi
+    1615:	89 c7                	mov    %eax,%edi
+    1617:	b8 00 00 00 00       	mov    $0x0,%eax
+    161c:	e8 af 05 00 00       	call   1bd0 <printf>
+    1621:	8b 05 d9 39 00 00    	mov    0x39d9(%rip),%eax        # 5000 <stdout>
+    1627:	48 8d 15 20 22 00 00 	lea    0x2220(%rip),%rdx        # 384e <benchreport+0x1b1>
+    162e:	48 89 d6             	mov    %rdx,%rsi
+    1631:	89 c7                	mov    %eax,%edi
+    1633:	b8 00 00 00 00       	mov    $0x0,%eax
+    1638:	e8 93 05 00 00       	call   1bd0 <printf>
+    163d:	90                   	nop
+    163e:	eb fd                	jmp    163d <duptest+0x581>
+          stdout_cpy);
+
+  char *consolestr = "print to console directly from write\n";
+    1640:	48 8d 05 19 2b 00 00 	lea    0x2b19(%rip),%rax        # 4160 <benchreport+0xac3>
+    1647:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  strcpy(buf, consolestr);
+    164b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    164f:	48 8d 85 74 ff ff ff 	lea    -0x8c(%rbp),%rax
+    1656:	48 89 d6             	mov    %rdx,%rsi
+    1659:	48 89 c7             	mov    %rax,%rdi
+    165c:	e8 63 0e 00 00       	call   24c4 <strcpy>
+
+  if (write(stdout_cpy, consolestr, strlen(consolestr)) != strlen(consolestr))
+    1661:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1665:	48 89 c7             	mov    %rax,%rdi
+    1668:	e8 e5 0e 00 00       	call   2552 <strlen>
+    166d:	89 c2                	mov    %eax,%edx
+    166f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+    1673:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1676:	48 89 ce             	mov    %rcx,%rsi
+    1679:	89 c7                	mov    %eax,%edi
+    167b:	e8 30 16 00 00       	call   2cb0 <write>
+    1680:	89 c3                	mov    %eax,%ebx
+    1682:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1686:	48 89 c7             	mov    %rax,%rdi
+    1689:	e8 c4 0e 00 00       	call   2552 <strlen>
+    168e:	39 c3                	cmp    %eax,%ebx
+    1690:	74 5c                	je     16ee <duptest+0x632>
+    error("couldn't write to console from duped fd");
+    1692:	8b 05 68 39 00 00    	mov    0x3968(%rip),%eax        # 5000 <stdout>
+    1698:	ba 08 01 00 00       	mov    $0x108,%edx
+    169d:	48 8d 0d 6b 21 00 00 	lea    0x216b(%rip),%rcx        # 380f <benchreport+0x172>
+    16a4:	48 89 ce             	mov    %rcx,%rsi
+    16a7:	89 c7                	mov    %eax,%edi
+    16a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    16ae:	e8 1d 05 00 00       	call   1bd0 <printf>
+    16b3:	8b 05 47 39 00 00    	mov    0x3947(%rip),%eax        # 5000 <stdout>
+    16b9:	48 8d 15 c8 2a 00 00 	lea    0x2ac8(%rip),%rdx        # 4188 <benchreport+0xaeb>
+    16c0:	48 89 d6             	mov    %rdx,%rsi
+    16c3:	89 c7                	mov    %eax,%edi
+    16c5:	b8 00 00 00 00       	mov    $0x0,%eax
+    16ca:	e8 01 05 00 00       	call   1bd0 <printf>
+    16cf:	8b 05 2b 39 00 00    	mov    0x392b(%rip),%eax        # 5000 <stdout>
+    16d5:	48 8d 15 72 21 00 00 	lea    0x2172(%rip),%rdx        # 384e <benchreport+0x1b1>
+    16dc:	48 89 d6             	mov    %rdx,%rsi
+    16df:	89 c7                	mov    %eax,%edi
+    16e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e6:	e8 e5 04 00 00       	call   1bd0 <printf>
+    16eb:	90                   	nop
+    16ec:	eb fd                	jmp    16eb <duptest+0x62f>
+
+  assert(close(stdout_cpy) == 0);
+    16ee:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    16f1:	89 c7                	mov    %eax,%edi
+    16f3:	e8 72 0b 00 00       	call   226a <close>
+    16f8:	85 c0                	test   %eax,%eax
+    16fa:	74 2b                	je     1727 <duptest+0x66b>
+    16fc:	8b 05 fe 38 00 00    	mov    0x38fe(%rip),%eax        # 5000 <stdout>
+    1702:	48 8d 15 a7 2a 00 00 	lea    0x2aa7(%rip),%rdx        # 41b0 <benchreport+0xb13>
+    1709:	48 89 d1             	mov    %rdx,%rcx
+    170c:	ba 0a 01 00 00       	mov    $0x10a,%edx
+    1711:	48 8d 35 98 22 00 00 	lea    0x2298(%rip),%rsi        # 39b0 <benchreport+0x313>
+    1718:	89 c7                	mov    %eax,%edi
+    171a:	b8 00 00 00 00       	mov    $0x0,%eax
+    171f:	e8 ac 04 00 00       	call   1bd0 <printf>
+    1724:	90                   	nop
+    1725:	eb fd                	jmp    1724 <duptest+0x668>
+
+  printf(stdout, "dup test ok\n");
+    1727:	8b 05 d3 38 00 00    	mov    0x38d3(%rip),%eax        # 5000 <stdout>
+    172d:	48 8d 15 93 2a 00 00 	lea    0x2a93(%rip),%rdx        # 41c7 <benchreport+0xb2a>
+    1734:	48 89 d6             	mov    %rdx,%rsi
+    1737:	89 c7                	mov    %eax,%edi
+    1739:	b8 00 00 00 00       	mov    $0x0,%eax
+    173e:	e8 8d 04 00 00       	call   1bd0 <printf>
+}
+    1743:	90                   	nop
+    1744:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1748:	c9                   	leave
+    1749:	c3                   	ret
+
+000000000000174a <nofilestest>:
+
+void nofilestest() {
+    174a:	55                   	push   %rbp
+    174b:	48 89 e5             	mov    %rsp,%rbp
+    174e:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, tmpfd;
+
+  printf(stdout, "nofiles test\n");
+    1752:	8b 05 a8 38 00 00    	mov    0x38a8(%rip),%eax        # 5000 <stdout>
+    1758:	48 8d 15 75 2a 00 00 	lea    0x2a75(%rip),%rdx        # 41d4 <benchreport+0xb37>
+    175f:	48 89 d6             	mov    %rdx,%rsi
+    1762:	89 c7                	mov    %eax,%edi
+    1764:	b8 00 00 00 00       	mov    $0x0,%eax
+    1769:	e8 62 04 00 00       	call   1bd0 <printf>
+  fd = open("/small.txt", O_RDONLY);
+    176e:	be 00 00 00 00       	mov    $0x0,%esi
+    1773:	48 8d 05 d6 20 00 00 	lea    0x20d6(%rip),%rax        # 3850 <benchreport+0x1b3>
+    177a:	48 89 c7             	mov    %rax,%rdi
+    177d:	e8 5a 15 00 00       	call   2cdc <open>
+    1782:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  assert(fd != -1);
+    1785:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+    1789:	75 2b                	jne    17b6 <nofilestest+0x6c>
+    178b:	8b 05 6f 38 00 00    	mov    0x386f(%rip),%eax        # 5000 <stdout>
+    1791:	48 8d 15 0f 22 00 00 	lea    0x220f(%rip),%rdx        # 39a7 <benchreport+0x30a>
+    1798:	48 89 d1             	mov    %rdx,%rcx
+    179b:	ba 14 01 00 00       	mov    $0x114,%edx
+    17a0:	48 8d 35 09 22 00 00 	lea    0x2209(%rip),%rsi        # 39b0 <benchreport+0x313>
+    17a7:	89 c7                	mov    %eax,%edi
+    17a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    17ae:	e8 1d 04 00 00       	call   1bd0 <printf>
+    17b3:	90                   	nop
+    17b4:	eb fd                	jmp    17b3 <nofilestest+0x69>
+
+  for (tmpfd = fd + 1; tmpfd < NOFILE; tmpfd++) {
+    17b6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    17b9:	83 c0 01             	add    $0x1,%eax
+    17bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    17bf:	e9 82 00 00 00       	jmp    1846 <nofilestest+0xfc>
+    int newfd = open("/small.txt", O_RDONLY);
+    17c4:	be 00 00 00 00       	mov    $0x0,%esi
+    17c9:	48 8d 05 80 20 00 00 	lea    0x2080(%rip),%rax        # 3850 <benchreport+0x1b3>
+    17d0:	48 89 c7             	mov    %rax,%rdi
+    17d3:	e8 04 15 00 00       	call   2cdc <open>
+    17d8:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (newfd != tmpfd)
+    17db:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    17de:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+    17e1:	74 5f                	je     1842 <nofilestest+0xf8>
+      error("returned fd from open was not the smallest free fd, was '%d'",
+    17e3:	8b 05 17 38 00 00    	mov    0x3817(%rip),%eax        # 5000 <stdout>
+    17e9:	ba 19 01 00 00       	mov    $0x119,%edx
+    17ee:	48 8d 0d 1a 20 00 00 	lea    0x201a(%rip),%rcx        # 380f <benchreport+0x172>
+    17f5:	48 89 ce             	mov    %rcx,%rsi
+    17f8:	89 c7                	mov    %eax,%edi
+    17fa:	b8 00 00 00 00       	mov    $0x0,%eax
+    17ff:	e8 cc 03 00 00       	call   1bd0 <printf>
+    1804:	8b 05 f6 37 00 00    	mov    0x37f6(%rip),%eax        # 5000 <stdout>
+    180a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    180d:	48 8d 0d d4 29 00 00 	lea    0x29d4(%rip),%rcx        # 41e8 <benchreport+0xb4b>
+    1814:	48 89 ce             	mov    %rcx,%rsi
+    1817:	89 c7                	mov    %eax,%edi
+    1819:	b8 00 00 00 00       	mov    $0x0,%eax
+    181e:	e8 ad 03 00 00       	call   1bd0 <printf>
+    1823:	8b 05 d7 37 00 00    	mov    0x37d7(%rip),%eax        # 5000 <stdout>
+    1829:	48 8d 15 1e 20 00 00 	lea    0x201e(%rip),%rdx        # 384e <benchreport+0x1b1>
+    1830:	48 89 d6             	mov    %rdx,%rsi
+    1833:	89 c7                	mov    %eax,%edi
+    1835:	b8 00 00 00 00       	mov    $0x0,%eax
+    183a:	e8 91 03 00 00       	call   1bd0 <printf>
+    183f:	90                   	nop
+    1840:	eb fd                	jmp    183f <nofilestest+0xf5>
+  for (tmpfd = fd + 1; tmpfd < NOFILE; tmpfd++) {
+    1842:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1846:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    184a:	0f 8e 74 ff ff ff    	jle    17c4 <nofilestest+0x7a>
+            newfd);
+  }
+
+  // Opening should fail as we have reached the NOFILE limit
+  if (open("/small.txt", O_RDONLY) != -1)
+    1850:	be 00 00 00 00       	mov    $0x0,%esi
+    1855:	48 8d 05 f4 1f 00 00 	lea    0x1ff4(%rip),%rax        # 3850 <benchreport+0x1b3>
+    185c:	48 89 c7             	mov    %rax,%rdi
+    185f:	e8 78 14 00 00       	call   2cdc <open>
+    1864:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1867:	74 5c                	je     18c5 <nofilestest+0x17b>
+    error("opened more files than allowed");
+    1869:	8b 05 91 37 00 00    	mov    0x3791(%rip),%eax        # 5000 <stdout>
+    186f:	ba 1f 01 00 00       	mov    $0x11f,%edx
+    1874:	48 8d 0d 94 1f 00 00 	lea    0x1f94(%rip),%rcx        # 380f <benchreport+0x172>
+    187b:	48 89 ce             	mov    %rcx,%rsi
+    187e:	89 c7                	mov    %eax,%edi
+    1880:	b8 00 00 00 00       	mov    $0x0,%eax
+    1885:	e8 46 03 00 00       	call   1bd0 <printf>
+    188a:	8b 05 70 37 00 00    	mov    0x3770(%rip),%eax        # 5000 <stdout>
+    1890:	48 8d 15 91 29 00 00 	lea    0x2991(%rip),%rdx        # 4228 <benchreport+0xb8b>
+    1897:	48 89 d6             	mov    %rdx,%rsi
+    189a:	89 c7                	mov    %eax,%edi
+    189c:	b8 00 00 00 00       	mov    $0x0,%eax
+    18a1:	e8 2a 03 00 00       	call   1bd0 <printf>
+    18a6:	8b 05 54 37 00 00    	mov    0x3754(%rip),%eax        # 5000 <stdout>
+    18ac:	48 8d 15 9b 1f 00 00 	lea    0x1f9b(%rip),%rdx        # 384e <benchreport+0x1b1>
+    18b3:	48 89 d6             	mov    %rdx,%rsi
+    18b6:	89 c7                	mov    %eax,%edi
+    18b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    18bd:	e8 0e 03 00 00       	call   1bd0 <printf>
+    18c2:	90                   	nop
+    18c3:	eb fd                	jmp    18c2 <nofilestest+0x178>
+
+  assert(close(NOFILE - 1) == 0);
+    18c5:	bf 0f 00 00 00       	mov    $0xf,%edi
+    18ca:	e8 9b 09 00 00       	call   226a <close>
+    18cf:	85 c0                	test   %eax,%eax
+    18d1:	74 2b                	je     18fe <nofilestest+0x1b4>
+    18d3:	8b 05 27 37 00 00    	mov    0x3727(%rip),%eax        # 5000 <stdout>
+    18d9:	48 8d 15 67 29 00 00 	lea    0x2967(%rip),%rdx        # 4247 <benchreport+0xbaa>
+    18e0:	48 89 d1             	mov    %rdx,%rcx
+    18e3:	ba 21 01 00 00       	mov    $0x121,%edx
+    18e8:	48 8d 35 c1 20 00 00 	lea    0x20c1(%rip),%rsi        # 39b0 <benchreport+0x313>
+    18ef:	89 c7                	mov    %eax,%edi
+    18f1:	b8 00 00 00 00       	mov    $0x0,%eax
+    18f6:	e8 d5 02 00 00       	call   1bd0 <printf>
+    18fb:	90                   	nop
+    18fc:	eb fd                	jmp    18fb <nofilestest+0x1b1>
+  // Opening should work once there is a fd available
+  int fd2 = open("/small.txt", O_RDONLY);
+    18fe:	be 00 00 00 00       	mov    $0x0,%esi
+    1903:	48 8d 05 46 1f 00 00 	lea    0x1f46(%rip),%rax        # 3850 <benchreport+0x1b3>
+    190a:	48 89 c7             	mov    %rax,%rdi
+    190d:	e8 ca 13 00 00       	call   2cdc <open>
+    1912:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd2 == -1) error("unable to open file after an fd is available");
+    1915:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%rbp)
+    1919:	75 5c                	jne    1977 <nofilestest+0x22d>
+    191b:	8b 05 df 36 00 00    	mov    0x36df(%rip),%eax        # 5000 <stdout>
+    1921:	ba 24 01 00 00       	mov    $0x124,%edx
+    1926:	48 8d 0d e2 1e 00 00 	lea    0x1ee2(%rip),%rcx        # 380f <benchreport+0x172>
+    192d:	48 89 ce             	mov    %rcx,%rsi
+    1930:	89 c7                	mov    %eax,%edi
+    1932:	b8 00 00 00 00       	mov    $0x0,%eax
+    1937:	e8 94 02 00 00       	call   1bd0 <printf>
+    193c:	8b 05 be 36 00 00    	mov    0x36be(%rip),%eax        # 5000 <stdout>
+    1942:	48 8d 15 17 29 00 00 	lea    0x2917(%rip),%rdx        # 4260 <benchreport+0xbc3>
+    1949:	48 89 d6             	mov    %rdx,%rsi
+    194c:	89 c7                	mov    %eax,%edi
+    194e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1953:	e8 78 02 00 00       	call   1bd0 <printf>
+    1958:	8b 05 a2 36 00 00    	mov    0x36a2(%rip),%eax        # 5000 <stdout>
+    195e:	48 8d 15 e9 1e 00 00 	lea    0x1ee9(%rip),%rdx        # 384e <benchreport+0x1b1>
+    1965:	48 89 d6             	mov    %rdx,%rsi
+    1968:	89 c7                	mov    %eax,%edi
+    196a:	b8 00 00 00 00       	mov    $0x0,%eax
+    196f:	e8 5c 02 00 00       	call   1bd0 <printf>
+    1974:	90                   	nop
+    1975:	eb fd                	jmp    1974 <nofilestest+0x22a>
+
+  assert(fd2 == NOFILE - 1);
+    1977:	83 7d f4 0f          	cmpl   $0xf,-0xc(%rbp)
+    197b:	74 2b                	je     19a8 <nofilestest+0x25e>
+    197d:	8b 05 7d 36 00 00    	mov    0x367d(%rip),%eax        # 5000 <stdout>
+    1983:	48 8d 15 03 29 00 00 	lea    0x2903(%rip),%rdx        # 428d <benchreport+0xbf0>
+    198a:	48 89 d1             	mov    %rdx,%rcx
+    198d:	ba 26 01 00 00       	mov    $0x126,%edx
+    1992:	48 8d 35 17 20 00 00 	lea    0x2017(%rip),%rsi        # 39b0 <benchreport+0x313>
+    1999:	89 c7                	mov    %eax,%edi
+    199b:	b8 00 00 00 00       	mov    $0x0,%eax
+    19a0:	e8 2b 02 00 00       	call   1bd0 <printf>
+    19a5:	90                   	nop
+    19a6:	eb fd                	jmp    19a5 <nofilestest+0x25b>
+
+  for (tmpfd = fd; tmpfd < NOFILE; tmpfd++) {
+    19a8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    19ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    19ae:	eb 3d                	jmp    19ed <nofilestest+0x2a3>
+    assert(close(tmpfd) == 0);
+    19b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19b3:	89 c7                	mov    %eax,%edi
+    19b5:	e8 b0 08 00 00       	call   226a <close>
+    19ba:	85 c0                	test   %eax,%eax
+    19bc:	74 2b                	je     19e9 <nofilestest+0x29f>
+    19be:	8b 05 3c 36 00 00    	mov    0x363c(%rip),%eax        # 5000 <stdout>
+    19c4:	48 8d 15 d4 28 00 00 	lea    0x28d4(%rip),%rdx        # 429f <benchreport+0xc02>
+    19cb:	48 89 d1             	mov    %rdx,%rcx
+    19ce:	ba 29 01 00 00       	mov    $0x129,%edx
+    19d3:	48 8d 35 d6 1f 00 00 	lea    0x1fd6(%rip),%rsi        # 39b0 <benchreport+0x313>
+    19da:	89 c7                	mov    %eax,%edi
+    19dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    19e1:	e8 ea 01 00 00       	call   1bd0 <printf>
+    19e6:	90                   	nop
+    19e7:	eb fd                	jmp    19e6 <nofilestest+0x29c>
+  for (tmpfd = fd; tmpfd < NOFILE; tmpfd++) {
+    19e9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    19ed:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    19f1:	7e bd                	jle    19b0 <nofilestest+0x266>
+  }
+
+  printf(stdout, "nofiles test ok\n");
+    19f3:	8b 05 07 36 00 00    	mov    0x3607(%rip),%eax        # 5000 <stdout>
+    19f9:	48 8d 15 b1 28 00 00 	lea    0x28b1(%rip),%rdx        # 42b1 <benchreport+0xc14>
+    1a00:	48 89 d6             	mov    %rdx,%rsi
+    1a03:	89 c7                	mov    %eax,%edi
+    1a05:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a0a:	e8 c1 01 00 00       	call   1bd0 <printf>
+}
+    1a0f:	90                   	nop
+    1a10:	c9                   	leave
+    1a11:	c3                   	ret
+
+0000000000001a12 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    1a12:	55                   	push   %rbp
+    1a13:	48 89 e5             	mov    %rsp,%rbp
+    1a16:	48 83 ec 10          	sub    $0x10,%rsp
+    1a1a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1a1d:	89 f0                	mov    %esi,%eax
+    1a1f:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1a22:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    1a26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a29:	89 d6                	mov    %edx,%esi
+    1a2b:	89 c7                	mov    %eax,%edi
+    1a2d:	e8 eb 06 00 00       	call   211d <bputc>
+    1a32:	90                   	nop
+    1a33:	c9                   	leave
+    1a34:	c3                   	ret
+
+0000000000001a35 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    1a35:	55                   	push   %rbp
+    1a36:	48 89 e5             	mov    %rsp,%rbp
+    1a39:	48 83 ec 50          	sub    $0x50,%rsp
+    1a3d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1a40:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1a44:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    1a47:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1a4a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1a4e:	74 21                	je     1a71 <printint64+0x3c>
+    1a50:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1a54:	48 c1 e8 3f          	shr    $0x3f,%rax
+    1a58:	0f b6 c0             	movzbl %al,%eax
+    1a5b:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    1a5e:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1a62:	74 0d                	je     1a71 <printint64+0x3c>
+    x = -xx;
+    1a64:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1a68:	48 f7 d8             	neg    %rax
+    1a6b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a6f:	eb 08                	jmp    1a79 <printint64+0x44>
+  else
+    x = xx;
+    1a71:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1a75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1a79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1a80:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1a83:	48 63 c8             	movslq %eax,%rcx
+    1a86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+    1a8f:	48 f7 f1             	div    %rcx
+    1a92:	48 89 d1             	mov    %rdx,%rcx
+    1a95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a98:	8d 50 01             	lea    0x1(%rax),%edx
+    1a9b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1a9e:	48 8d 15 6b 35 00 00 	lea    0x356b(%rip),%rdx        # 5010 <digits.1>
+    1aa5:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1aa9:	48 98                	cltq
+    1aab:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1aaf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1ab2:	48 63 f0             	movslq %eax,%rsi
+    1ab5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab9:	ba 00 00 00 00       	mov    $0x0,%edx
+    1abe:	48 f7 f6             	div    %rsi
+    1ac1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ac5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1aca:	75 b4                	jne    1a80 <printint64+0x4b>
+
+  if (sgn)
+    1acc:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1ad0:	74 2b                	je     1afd <printint64+0xc8>
+    buf[i++] = '-';
+    1ad2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ad5:	8d 50 01             	lea    0x1(%rax),%edx
+    1ad8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1adb:	48 98                	cltq
+    1add:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1ae2:	eb 19                	jmp    1afd <printint64+0xc8>
+    putc(fd, buf[i]);
+    1ae4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ae7:	48 98                	cltq
+    1ae9:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1aee:	0f be d0             	movsbl %al,%edx
+    1af1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1af4:	89 d6                	mov    %edx,%esi
+    1af6:	89 c7                	mov    %eax,%edi
+    1af8:	e8 15 ff ff ff       	call   1a12 <putc>
+  while (--i >= 0)
+    1afd:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1b01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1b05:	79 dd                	jns    1ae4 <printint64+0xaf>
+}
+    1b07:	90                   	nop
+    1b08:	90                   	nop
+    1b09:	c9                   	leave
+    1b0a:	c3                   	ret
+
+0000000000001b0b <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1b0b:	55                   	push   %rbp
+    1b0c:	48 89 e5             	mov    %rsp,%rbp
+    1b0f:	48 83 ec 30          	sub    $0x30,%rsp
+    1b13:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1b16:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1b19:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1b1c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1b1f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1b26:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1b2a:	74 17                	je     1b43 <printint+0x38>
+    1b2c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1b30:	79 11                	jns    1b43 <printint+0x38>
+    neg = 1;
+    1b32:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1b39:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1b3c:	f7 d8                	neg    %eax
+    1b3e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1b41:	eb 06                	jmp    1b49 <printint+0x3e>
+  } else {
+    x = xx;
+    1b43:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1b46:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1b49:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1b50:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1b53:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b56:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b5b:	f7 f1                	div    %ecx
+    1b5d:	89 d1                	mov    %edx,%ecx
+    1b5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b62:	8d 50 01             	lea    0x1(%rax),%edx
+    1b65:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1b68:	89 c9                	mov    %ecx,%ecx
+    1b6a:	48 8d 15 bf 34 00 00 	lea    0x34bf(%rip),%rdx        # 5030 <digits.0>
+    1b71:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1b75:	48 98                	cltq
+    1b77:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1b7b:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1b7e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b81:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b86:	f7 f6                	div    %esi
+    1b88:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1b8b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1b8f:	75 bf                	jne    1b50 <printint+0x45>
+  if (neg)
+    1b91:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1b95:	74 2b                	je     1bc2 <printint+0xb7>
+    buf[i++] = '-';
+    1b97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b9a:	8d 50 01             	lea    0x1(%rax),%edx
+    1b9d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ba0:	48 98                	cltq
+    1ba2:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1ba7:	eb 19                	jmp    1bc2 <printint+0xb7>
+    putc(fd, buf[i]);
+    1ba9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bac:	48 98                	cltq
+    1bae:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1bb3:	0f be d0             	movsbl %al,%edx
+    1bb6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bb9:	89 d6                	mov    %edx,%esi
+    1bbb:	89 c7                	mov    %eax,%edi
+    1bbd:	e8 50 fe ff ff       	call   1a12 <putc>
+  while (--i >= 0)
+    1bc2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1bc6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1bca:	79 dd                	jns    1ba9 <printint+0x9e>
+}
+    1bcc:	90                   	nop
+    1bcd:	90                   	nop
+    1bce:	c9                   	leave
+    1bcf:	c3                   	ret
+
+0000000000001bd0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1bd0:	55                   	push   %rbp
+    1bd1:	48 89 e5             	mov    %rsp,%rbp
+    1bd4:	48 83 ec 70          	sub    $0x70,%rsp
+    1bd8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1bdb:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1bdf:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1be3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1be7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1beb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1bef:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1bf6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1bfa:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1bfe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1c02:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1c06:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1c0d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1c14:	e9 67 02 00 00       	jmp    1e80 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    1c19:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1c1c:	48 63 d0             	movslq %eax,%rdx
+    1c1f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1c23:	48 01 d0             	add    %rdx,%rax
+    1c26:	0f b6 00             	movzbl (%rax),%eax
+    1c29:	0f be c0             	movsbl %al,%eax
+    1c2c:	25 ff 00 00 00       	and    $0xff,%eax
+    1c31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1c34:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1c38:	75 30                	jne    1c6a <printf+0x9a>
+      if (c == '%') {
+    1c3a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1c3e:	75 13                	jne    1c53 <printf+0x83>
+        state = '%';
+    1c40:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1c47:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1c4e:	e9 29 02 00 00       	jmp    1e7c <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    1c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1c56:	0f be d0             	movsbl %al,%edx
+    1c59:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1c5c:	89 d6                	mov    %edx,%esi
+    1c5e:	89 c7                	mov    %eax,%edi
+    1c60:	e8 ad fd ff ff       	call   1a12 <putc>
+    1c65:	e9 12 02 00 00       	jmp    1e7c <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    1c6a:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1c6e:	0f 85 08 02 00 00    	jne    1e7c <printf+0x2ac>
+      if (c == 'l') {
+    1c74:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1c78:	75 0c                	jne    1c86 <printf+0xb6>
+        lflag = 1;
+    1c7a:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1c81:	e9 f6 01 00 00       	jmp    1e7c <printf+0x2ac>
+      } else if (c == 'd') {
+    1c86:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1c8a:	0f 85 93 00 00 00    	jne    1d23 <printf+0x153>
+        if (lflag == 1)
+    1c90:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1c94:	75 47                	jne    1cdd <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1c96:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1c99:	83 f8 2f             	cmp    $0x2f,%eax
+    1c9c:	77 17                	ja     1cb5 <printf+0xe5>
+    1c9e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ca2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ca5:	89 d2                	mov    %edx,%edx
+    1ca7:	48 01 d0             	add    %rdx,%rax
+    1caa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1cad:	83 c2 08             	add    $0x8,%edx
+    1cb0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1cb3:	eb 0c                	jmp    1cc1 <printf+0xf1>
+    1cb5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1cb9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1cbd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1cc1:	48 8b 30             	mov    (%rax),%rsi
+    1cc4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1cc7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1ccc:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1cd1:	89 c7                	mov    %eax,%edi
+    1cd3:	e8 5d fd ff ff       	call   1a35 <printint64>
+    1cd8:	e9 98 01 00 00       	jmp    1e75 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1cdd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1ce0:	83 f8 2f             	cmp    $0x2f,%eax
+    1ce3:	77 17                	ja     1cfc <printf+0x12c>
+    1ce5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1ce9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1cec:	89 d2                	mov    %edx,%edx
+    1cee:	48 01 d0             	add    %rdx,%rax
+    1cf1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1cf4:	83 c2 08             	add    $0x8,%edx
+    1cf7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1cfa:	eb 0c                	jmp    1d08 <printf+0x138>
+    1cfc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1d00:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1d04:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1d08:	8b 30                	mov    (%rax),%esi
+    1d0a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1d0d:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1d12:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1d17:	89 c7                	mov    %eax,%edi
+    1d19:	e8 ed fd ff ff       	call   1b0b <printint>
+    1d1e:	e9 52 01 00 00       	jmp    1e75 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    1d23:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1d27:	74 0a                	je     1d33 <printf+0x163>
+    1d29:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1d2d:	0f 85 93 00 00 00    	jne    1dc6 <printf+0x1f6>
+        if (lflag == 1)
+    1d33:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1d37:	75 47                	jne    1d80 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1d39:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1d3c:	83 f8 2f             	cmp    $0x2f,%eax
+    1d3f:	77 17                	ja     1d58 <printf+0x188>
+    1d41:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d45:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d48:	89 d2                	mov    %edx,%edx
+    1d4a:	48 01 d0             	add    %rdx,%rax
+    1d4d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d50:	83 c2 08             	add    $0x8,%edx
+    1d53:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1d56:	eb 0c                	jmp    1d64 <printf+0x194>
+    1d58:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1d5c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1d60:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1d64:	48 8b 30             	mov    (%rax),%rsi
+    1d67:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1d6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1d6f:	ba 10 00 00 00       	mov    $0x10,%edx
+    1d74:	89 c7                	mov    %eax,%edi
+    1d76:	e8 ba fc ff ff       	call   1a35 <printint64>
+        if (lflag == 1)
+    1d7b:	e9 f5 00 00 00       	jmp    1e75 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1d80:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1d83:	83 f8 2f             	cmp    $0x2f,%eax
+    1d86:	77 17                	ja     1d9f <printf+0x1cf>
+    1d88:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1d8c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d8f:	89 d2                	mov    %edx,%edx
+    1d91:	48 01 d0             	add    %rdx,%rax
+    1d94:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1d97:	83 c2 08             	add    $0x8,%edx
+    1d9a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1d9d:	eb 0c                	jmp    1dab <printf+0x1db>
+    1d9f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1da3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1da7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1dab:	8b 30                	mov    (%rax),%esi
+    1dad:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1db5:	ba 10 00 00 00       	mov    $0x10,%edx
+    1dba:	89 c7                	mov    %eax,%edi
+    1dbc:	e8 4a fd ff ff       	call   1b0b <printint>
+        if (lflag == 1)
+    1dc1:	e9 af 00 00 00       	jmp    1e75 <printf+0x2a5>
+      } else if (c == 's') {
+    1dc6:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1dca:	75 6e                	jne    1e3a <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1dcc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1dcf:	83 f8 2f             	cmp    $0x2f,%eax
+    1dd2:	77 17                	ja     1deb <printf+0x21b>
+    1dd4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1dd8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ddb:	89 d2                	mov    %edx,%edx
+    1ddd:	48 01 d0             	add    %rdx,%rax
+    1de0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1de3:	83 c2 08             	add    $0x8,%edx
+    1de6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1de9:	eb 0c                	jmp    1df7 <printf+0x227>
+    1deb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1def:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1df3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1df7:	48 8b 00             	mov    (%rax),%rax
+    1dfa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1dfe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1e03:	75 28                	jne    1e2d <printf+0x25d>
+          s = "(null)";
+    1e05:	48 8d 05 b6 24 00 00 	lea    0x24b6(%rip),%rax        # 42c2 <benchreport+0xc25>
+    1e0c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    1e10:	eb 1b                	jmp    1e2d <printf+0x25d>
+          putc(fd, *s);
+    1e12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e16:	0f b6 00             	movzbl (%rax),%eax
+    1e19:	0f be d0             	movsbl %al,%edx
+    1e1c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e1f:	89 d6                	mov    %edx,%esi
+    1e21:	89 c7                	mov    %eax,%edi
+    1e23:	e8 ea fb ff ff       	call   1a12 <putc>
+        for (; *s; s++)
+    1e28:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1e2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1e31:	0f b6 00             	movzbl (%rax),%eax
+    1e34:	84 c0                	test   %al,%al
+    1e36:	75 da                	jne    1e12 <printf+0x242>
+    1e38:	eb 3b                	jmp    1e75 <printf+0x2a5>
+      } else if (c == '%') {
+    1e3a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1e3e:	75 14                	jne    1e54 <printf+0x284>
+        putc(fd, c);
+    1e40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1e43:	0f be d0             	movsbl %al,%edx
+    1e46:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e49:	89 d6                	mov    %edx,%esi
+    1e4b:	89 c7                	mov    %eax,%edi
+    1e4d:	e8 c0 fb ff ff       	call   1a12 <putc>
+    1e52:	eb 21                	jmp    1e75 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1e54:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e57:	be 25 00 00 00       	mov    $0x25,%esi
+    1e5c:	89 c7                	mov    %eax,%edi
+    1e5e:	e8 af fb ff ff       	call   1a12 <putc>
+        putc(fd, c);
+    1e63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1e66:	0f be d0             	movsbl %al,%edx
+    1e69:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e6c:	89 d6                	mov    %edx,%esi
+    1e6e:	89 c7                	mov    %eax,%edi
+    1e70:	e8 9d fb ff ff       	call   1a12 <putc>
+      }
+      state = 0;
+    1e75:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1e7c:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1e80:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1e83:	48 63 d0             	movslq %eax,%rdx
+    1e86:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1e8a:	48 01 d0             	add    %rdx,%rax
+    1e8d:	0f b6 00             	movzbl (%rax),%eax
+    1e90:	84 c0                	test   %al,%al
+    1e92:	0f 85 81 fd ff ff    	jne    1c19 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    1e98:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1e9b:	89 c7                	mov    %eax,%edi
+    1e9d:	e8 ee 02 00 00       	call   2190 <bflushtty>
+}
+    1ea2:	90                   	nop
+    1ea3:	c9                   	leave
+    1ea4:	c3                   	ret
+
+0000000000001ea5 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    1ea5:	55                   	push   %rbp
+    1ea6:	48 89 e5             	mov    %rsp,%rbp
+    1ea9:	48 83 ec 30          	sub    $0x30,%rsp
+    1ead:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    1eb0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1eb4:	78 06                	js     1ebc <getbuf+0x17>
+    1eb6:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    1eba:	7e 0a                	jle    1ec6 <getbuf+0x21>
+    return 0;
+    1ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ec1:	e9 94 00 00 00       	jmp    1f5a <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    1ec6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ec9:	48 98                	cltq
+    1ecb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ed2:	00 
+    1ed3:	48 8d 05 86 31 00 00 	lea    0x3186(%rip),%rax        # 5060 <obufs>
+    1eda:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1ede:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ee2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1ee7:	75 6d                	jne    1f56 <getbuf+0xb1>
+    1ee9:	bf 08 02 00 00       	mov    $0x208,%edi
+    1eee:	e8 bd 13 00 00       	call   32b0 <malloc>
+    1ef3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ef7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1efc:	74 58                	je     1f56 <getbuf+0xb1>
+    b->n = 0;
+    1efe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f02:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    1f08:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    1f0c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f0f:	48 89 d6             	mov    %rdx,%rsi
+    1f12:	89 c7                	mov    %eax,%edi
+    1f14:	e8 e4 0d 00 00       	call   2cfd <fstat>
+    1f19:	85 c0                	test   %eax,%eax
+    1f1b:	75 11                	jne    1f2e <getbuf+0x89>
+    1f1d:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    1f21:	66 83 f8 03          	cmp    $0x3,%ax
+    1f25:	75 07                	jne    1f2e <getbuf+0x89>
+    1f27:	ba 01 00 00 00       	mov    $0x1,%edx
+    1f2c:	eb 05                	jmp    1f33 <getbuf+0x8e>
+    1f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1f33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f37:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    1f3a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f3d:	48 98                	cltq
+    1f3f:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1f46:	00 
+    1f47:	48 8d 15 12 31 00 00 	lea    0x3112(%rip),%rdx        # 5060 <obufs>
+    1f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f52:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    1f56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1f5a:	c9                   	leave
+    1f5b:	c3                   	ret
+
+0000000000001f5c <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    1f5c:	55                   	push   %rbp
+    1f5d:	48 89 e5             	mov    %rsp,%rbp
+    1f60:	48 83 ec 20          	sub    $0x20,%rsp
+    1f64:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    1f67:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1f6b:	78 33                	js     1fa0 <bflush+0x44>
+    1f6d:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    1f71:	7f 2d                	jg     1fa0 <bflush+0x44>
+    1f73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f76:	48 98                	cltq
+    1f78:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f7f:	00 
+    1f80:	48 8d 05 d9 30 00 00 	lea    0x30d9(%rip),%rax        # 5060 <obufs>
+    1f87:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f8b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f8f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1f94:	74 0a                	je     1fa0 <bflush+0x44>
+    1f96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f9a:	8b 00                	mov    (%rax),%eax
+    1f9c:	85 c0                	test   %eax,%eax
+    1f9e:	75 07                	jne    1fa7 <bflush+0x4b>
+    return 0;
+    1fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fa5:	eb 3c                	jmp    1fe3 <bflush+0x87>
+  n = b->n;
+    1fa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fab:	8b 00                	mov    (%rax),%eax
+    1fad:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    1fb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    1fba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fbe:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    1fc2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1fc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1fc8:	48 89 ce             	mov    %rcx,%rsi
+    1fcb:	89 c7                	mov    %eax,%edi
+    1fcd:	e8 de 0c 00 00       	call   2cb0 <write>
+    1fd2:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1fd5:	75 07                	jne    1fde <bflush+0x82>
+    1fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fdc:	eb 05                	jmp    1fe3 <bflush+0x87>
+    1fde:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1fe3:	c9                   	leave
+    1fe4:	c3                   	ret
+
+0000000000001fe5 <bflushall>:
+
+void bflushall(void) {
+    1fe5:	55                   	push   %rbp
+    1fe6:	48 89 e5             	mov    %rsp,%rbp
+    1fe9:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    1fed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1ff4:	eb 0e                	jmp    2004 <bflushall+0x1f>
+    bflush(fd);
+    1ff6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ff9:	89 c7                	mov    %eax,%edi
+    1ffb:	e8 5c ff ff ff       	call   1f5c <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    2000:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2004:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    2008:	7e ec                	jle    1ff6 <bflushall+0x11>
+}
+    200a:	90                   	nop
+    200b:	90                   	nop
+    200c:	c9                   	leave
+    200d:	c3                   	ret
+
+000000000000200e <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    200e:	55                   	push   %rbp
+    200f:	48 89 e5             	mov    %rsp,%rbp
+    2012:	48 83 ec 30          	sub    $0x30,%rsp
+    2016:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    2019:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    201d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    2020:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2023:	89 c7                	mov    %eax,%edi
+    2025:	e8 7b fe ff ff       	call   1ea5 <getbuf>
+    202a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    202e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2033:	75 19                	jne    204e <bwrite+0x40>
+    return write(fd, s, n);
+    2035:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    2038:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    203c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    203f:	48 89 ce             	mov    %rcx,%rsi
+    2042:	89 c7                	mov    %eax,%edi
+    2044:	e8 67 0c 00 00       	call   2cb0 <write>
+    2049:	e9 cd 00 00 00       	jmp    211b <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    204e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2055:	e9 92 00 00 00       	jmp    20ec <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    205a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    205e:	8b 00                	mov    (%rax),%eax
+    2060:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2065:	75 18                	jne    207f <bwrite+0x71>
+    2067:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    206a:	89 c7                	mov    %eax,%edi
+    206c:	e8 eb fe ff ff       	call   1f5c <bflush>
+    2071:	85 c0                	test   %eax,%eax
+    2073:	79 0a                	jns    207f <bwrite+0x71>
+      return -1;
+    2075:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    207a:	e9 9c 00 00 00       	jmp    211b <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    207f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2082:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    2085:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    2088:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    208c:	8b 00                	mov    (%rax),%eax
+    208e:	ba 00 02 00 00       	mov    $0x200,%edx
+    2093:	29 c2                	sub    %eax,%edx
+    2095:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    2098:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    209b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    209e:	39 c2                	cmp    %eax,%edx
+    20a0:	0f 4e c2             	cmovle %edx,%eax
+    20a3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    20a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20a9:	48 63 d0             	movslq %eax,%rdx
+    20ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20b0:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    20b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20b8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    20bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20c0:	8b 00                	mov    (%rax),%eax
+    20c2:	48 98                	cltq
+    20c4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    20c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    20cb:	89 c2                	mov    %eax,%edx
+    20cd:	48 89 cf             	mov    %rcx,%rdi
+    20d0:	e8 e9 06 00 00       	call   27be <memmove>
+    b->n += m;
+    20d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20d9:	8b 10                	mov    (%rax),%edx
+    20db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    20de:	01 c2                	add    %eax,%edx
+    20e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20e4:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    20e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    20e9:	01 45 fc             	add    %eax,-0x4(%rbp)
+    20ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20ef:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    20f2:	0f 8c 62 ff ff ff    	jl     205a <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    20f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20fc:	8b 40 04             	mov    0x4(%rax),%eax
+    20ff:	85 c0                	test   %eax,%eax
+    2101:	74 15                	je     2118 <bwrite+0x10a>
+    2103:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2106:	89 c7                	mov    %eax,%edi
+    2108:	e8 4f fe ff ff       	call   1f5c <bflush>
+    210d:	85 c0                	test   %eax,%eax
+    210f:	79 07                	jns    2118 <bwrite+0x10a>
+    return -1;
+    2111:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2116:	eb 03                	jmp    211b <bwrite+0x10d>
+  return n;
+    2118:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    211b:	c9                   	leave
+    211c:	c3                   	ret
+
+000000000000211d <bputc>:
+
+void bputc(int fd, char c) {
+    211d:	55                   	push   %rbp
+    211e:	48 89 e5             	mov    %rsp,%rbp
+    2121:	48 83 ec 20          	sub    $0x20,%rsp
+    2125:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2128:	89 f0                	mov    %esi,%eax
+    212a:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    212d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2130:	89 c7                	mov    %eax,%edi
+    2132:	e8 6e fd ff ff       	call   1ea5 <getbuf>
+    2137:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    213b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2140:	75 18                	jne    215a <bputc+0x3d>
+    write(fd, &c, 1);
+    2142:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    2146:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2149:	ba 01 00 00 00       	mov    $0x1,%edx
+    214e:	48 89 ce             	mov    %rcx,%rsi
+    2151:	89 c7                	mov    %eax,%edi
+    2153:	e8 58 0b 00 00       	call   2cb0 <write>
+    return;
+    2158:	eb 34                	jmp    218e <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    215a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    215e:	8b 00                	mov    (%rax),%eax
+    2160:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2165:	75 0a                	jne    2171 <bputc+0x54>
+    bflush(fd);
+    2167:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    216a:	89 c7                	mov    %eax,%edi
+    216c:	e8 eb fd ff ff       	call   1f5c <bflush>
+  b->data[b->n++] = c;
+    2171:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2175:	8b 00                	mov    (%rax),%eax
+    2177:	8d 48 01             	lea    0x1(%rax),%ecx
+    217a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    217e:	89 0a                	mov    %ecx,(%rdx)
+    2180:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    2184:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2188:	48 98                	cltq
+    218a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    218e:	c9                   	leave
+    218f:	c3                   	ret
+
+0000000000002190 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    2190:	55                   	push   %rbp
+    2191:	48 89 e5             	mov    %rsp,%rbp
+    2194:	48 83 ec 10          	sub    $0x10,%rsp
+    2198:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    219b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    219f:	78 4c                	js     21ed <bflushtty+0x5d>
+    21a1:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    21a5:	7f 46                	jg     21ed <bflushtty+0x5d>
+    21a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21aa:	48 98                	cltq
+    21ac:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    21b3:	00 
+    21b4:	48 8d 05 a5 2e 00 00 	lea    0x2ea5(%rip),%rax        # 5060 <obufs>
+    21bb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    21bf:	48 85 c0             	test   %rax,%rax
+    21c2:	74 29                	je     21ed <bflushtty+0x5d>
+    21c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21c7:	48 98                	cltq
+    21c9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    21d0:	00 
+    21d1:	48 8d 05 88 2e 00 00 	lea    0x2e88(%rip),%rax        # 5060 <obufs>
+    21d8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    21dc:	8b 40 04             	mov    0x4(%rax),%eax
+    21df:	85 c0                	test   %eax,%eax
+    21e1:	74 0a                	je     21ed <bflushtty+0x5d>
+    bflush(fd);
+    21e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21e6:	89 c7                	mov    %eax,%edi
+    21e8:	e8 6f fd ff ff       	call   1f5c <bflush>
+}
+    21ed:	90                   	nop
+    21ee:	c9                   	leave
+    21ef:	c3                   	ret
+
+00000000000021f0 <fork>:
+
+int fork(void) {
+    21f0:	55                   	push   %rbp
+    21f1:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    21f4:	e8 ec fd ff ff       	call   1fe5 <bflushall>
+  return _fork();
+    21f9:	e8 7b 0a 00 00       	call   2c79 <_fork>
+}
+    21fe:	5d                   	pop    %rbp
+    21ff:	c3                   	ret
+
+0000000000002200 <exit>:
+
+noreturn void exit(void) {
+    2200:	55                   	push   %rbp
+    2201:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    2204:	e8 dc fd ff ff       	call   1fe5 <bflushall>
+  _exit();
+    2209:	e8 76 0a 00 00       	call   2c84 <_exit>
+
+000000000000220e <exec>:
+}
+
+int exec(char *path, char **argv) {
+    220e:	55                   	push   %rbp
+    220f:	48 89 e5             	mov    %rsp,%rbp
+    2212:	48 83 ec 10          	sub    $0x10,%rsp
+    2216:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    221a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    221e:	e8 c2 fd ff ff       	call   1fe5 <bflushall>
+  return _exec(path, argv);
+    2223:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2227:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    222b:	48 89 d6             	mov    %rdx,%rsi
+    222e:	48 89 c7             	mov    %rax,%rdi
+    2231:	e8 9b 0a 00 00       	call   2cd1 <_exec>
+}
+    2236:	c9                   	leave
+    2237:	c3                   	ret
+
+0000000000002238 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    2238:	55                   	push   %rbp
+    2239:	48 89 e5             	mov    %rsp,%rbp
+    223c:	48 83 ec 20          	sub    $0x20,%rsp
+    2240:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2244:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2248:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    224c:	e8 94 fd ff ff       	call   1fe5 <bflushall>
+  return _spawn(path, argv, fds);
+    2251:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2255:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2259:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    225d:	48 89 ce             	mov    %rcx,%rsi
+    2260:	48 89 c7             	mov    %rax,%rdi
+    2263:	e8 2f 0b 00 00       	call   2d97 <_spawn>
+}
+    2268:	c9                   	leave
+    2269:	c3                   	ret
+
+000000000000226a <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    226a:	55                   	push   %rbp
+    226b:	48 89 e5             	mov    %rsp,%rbp
+    226e:	48 83 ec 10          	sub    $0x10,%rsp
+    2272:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    2275:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2279:	78 69                	js     22e4 <close+0x7a>
+    227b:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    227f:	7f 63                	jg     22e4 <close+0x7a>
+    2281:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2284:	48 98                	cltq
+    2286:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    228d:	00 
+    228e:	48 8d 05 cb 2d 00 00 	lea    0x2dcb(%rip),%rax        # 5060 <obufs>
+    2295:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2299:	48 85 c0             	test   %rax,%rax
+    229c:	74 46                	je     22e4 <close+0x7a>
+    bflush(fd);
+    229e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22a1:	89 c7                	mov    %eax,%edi
+    22a3:	e8 b4 fc ff ff       	call   1f5c <bflush>
+    free(obufs[fd]);
+    22a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22ab:	48 98                	cltq
+    22ad:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22b4:	00 
+    22b5:	48 8d 05 a4 2d 00 00 	lea    0x2da4(%rip),%rax        # 5060 <obufs>
+    22bc:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    22c0:	48 89 c7             	mov    %rax,%rdi
+    22c3:	e8 90 11 00 00       	call   3458 <free>
+    obufs[fd] = 0;
+    22c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22cb:	48 98                	cltq
+    22cd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22d4:	00 
+    22d5:	48 8d 05 84 2d 00 00 	lea    0x2d84(%rip),%rax        # 5060 <obufs>
+    22dc:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    22e3:	00 
+  }
+  return _close(fd);
+    22e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22e7:	89 c7                	mov    %eax,%edi
+    22e9:	e8 cd 09 00 00       	call   2cbb <_close>
+}
+    22ee:	c9                   	leave
+    22ef:	c3                   	ret
+
+00000000000022f0 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    22f0:	55                   	push   %rbp
+    22f1:	48 89 e5             	mov    %rsp,%rbp
+    22f4:	53                   	push   %rbx
+    22f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    22f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    22fd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2301:	48 8b 36             	mov    (%rsi),%rsi
+    2304:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    2308:	48 29 f7             	sub    %rsi,%rdi
+    230b:	48 89 f9             	mov    %rdi,%rcx
+    230e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2313:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2317:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    231b:	48 89 f0             	mov    %rsi,%rax
+    231e:	ba 00 00 00 00       	mov    $0x0,%edx
+    2323:	48 89 df             	mov    %rbx,%rdi
+    2326:	48 0f af f8          	imul   %rax,%rdi
+    232a:	48 89 d6             	mov    %rdx,%rsi
+    232d:	48 0f af f1          	imul   %rcx,%rsi
+    2331:	48 01 fe             	add    %rdi,%rsi
+    2334:	48 f7 e1             	mul    %rcx
+    2337:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    233b:	48 89 ca             	mov    %rcx,%rdx
+    233e:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    2343:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    2347:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    234b:	c9                   	leave
+    234c:	c3                   	ret
+
+000000000000234d <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    234d:	55                   	push   %rbp
+    234e:	48 89 e5             	mov    %rsp,%rbp
+    2351:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2355:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2358:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    235b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    235f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2362:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2365:	48 89 ce             	mov    %rcx,%rsi
+    2368:	48 89 f7             	mov    %rsi,%rdi
+    236b:	89 d1                	mov    %edx,%ecx
+    236d:	fc                   	cld
+    236e:	f3 aa                	rep stos %al,%es:(%rdi)
+    2370:	89 ca                	mov    %ecx,%edx
+    2372:	48 89 fe             	mov    %rdi,%rsi
+    2375:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    2379:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    237c:	90                   	nop
+    237d:	5d                   	pop    %rbp
+    237e:	c3                   	ret
+
+000000000000237f <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    237f:	55                   	push   %rbp
+    2380:	48 89 e5             	mov    %rsp,%rbp
+    2383:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2387:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    238b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    238f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2393:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    239b:	48 89 ce             	mov    %rcx,%rsi
+    239e:	48 89 f7             	mov    %rsi,%rdi
+    23a1:	48 89 d1             	mov    %rdx,%rcx
+    23a4:	fc                   	cld
+    23a5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    23a8:	48 89 ca             	mov    %rcx,%rdx
+    23ab:	48 89 fe             	mov    %rdi,%rsi
+    23ae:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    23b2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    23b6:	90                   	nop
+    23b7:	5d                   	pop    %rbp
+    23b8:	c3                   	ret
+
+00000000000023b9 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    23b9:	55                   	push   %rbp
+    23ba:	48 89 e5             	mov    %rsp,%rbp
+    23bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    23c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    23c9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    23cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    23d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23d5:	48 89 cf             	mov    %rcx,%rdi
+    23d8:	48 89 d6             	mov    %rdx,%rsi
+    23db:	48 89 c1             	mov    %rax,%rcx
+    23de:	fc                   	cld
+    23df:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    23e1:	48 89 c8             	mov    %rcx,%rax
+    23e4:	48 89 f2             	mov    %rsi,%rdx
+    23e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23eb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    23ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    23f3:	90                   	nop
+    23f4:	5d                   	pop    %rbp
+    23f5:	c3                   	ret
+
+00000000000023f6 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    23f6:	55                   	push   %rbp
+    23f7:	48 89 e5             	mov    %rsp,%rbp
+    23fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2402:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    2406:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    240a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    240e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2412:	48 89 cf             	mov    %rcx,%rdi
+    2415:	48 89 d6             	mov    %rdx,%rsi
+    2418:	48 89 c1             	mov    %rax,%rcx
+    241b:	fc                   	cld
+    241c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    241f:	48 89 c8             	mov    %rcx,%rax
+    2422:	48 89 f2             	mov    %rsi,%rdx
+    2425:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2429:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    242d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2431:	90                   	nop
+    2432:	5d                   	pop    %rbp
+    2433:	c3                   	ret
+
+0000000000002434 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    2434:	55                   	push   %rbp
+    2435:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    2438:	0f 31                	rdtsc
+    243a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    243d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    2440:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2443:	48 c1 e0 20          	shl    $0x20,%rax
+    2447:	48 89 c2             	mov    %rax,%rdx
+    244a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    244d:	48 09 d0             	or     %rdx,%rax
+}
+    2450:	5d                   	pop    %rbp
+    2451:	c3                   	ret
+
+0000000000002452 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    2452:	55                   	push   %rbp
+    2453:	48 89 e5             	mov    %rsp,%rbp
+    2456:	53                   	push   %rbx
+    2457:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    245a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    245e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    2462:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    2466:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    246a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    246d:	0f a2                	cpuid
+    246f:	89 de                	mov    %ebx,%esi
+    2471:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2474:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    2477:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    247a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    247d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    2482:	74 09                	je     248d <cpuid+0x3b>
+    *eaxp = eax;
+    2484:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2488:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    248b:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    248d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2492:	74 09                	je     249d <cpuid+0x4b>
+    *ebxp = ebx;
+    2494:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2498:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    249b:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    249d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    24a2:	74 09                	je     24ad <cpuid+0x5b>
+    *ecxp = ecx;
+    24a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    24a8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    24ab:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    24ad:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    24b2:	74 09                	je     24bd <cpuid+0x6b>
+    *edxp = edx;
+    24b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    24b8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    24bb:	89 10                	mov    %edx,(%rax)
+}
+    24bd:	90                   	nop
+    24be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    24c2:	c9                   	leave
+    24c3:	c3                   	ret
+
+00000000000024c4 <strcpy>:
+char *strcpy(char *s, char *t) {
+    24c4:	55                   	push   %rbp
+    24c5:	48 89 e5             	mov    %rsp,%rbp
+    24c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    24d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    24d8:	90                   	nop
+    24d9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    24dd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    24e1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    24e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24e9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    24ed:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    24f1:	0f b6 12             	movzbl (%rdx),%edx
+    24f4:	88 10                	mov    %dl,(%rax)
+    24f6:	0f b6 00             	movzbl (%rax),%eax
+    24f9:	84 c0                	test   %al,%al
+    24fb:	75 dc                	jne    24d9 <strcpy+0x15>
+  return os;
+    24fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2501:	5d                   	pop    %rbp
+    2502:	c3                   	ret
+
+0000000000002503 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2503:	55                   	push   %rbp
+    2504:	48 89 e5             	mov    %rsp,%rbp
+    2507:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    250b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    250f:	eb 0a                	jmp    251b <strcmp+0x18>
+    p++, q++;
+    2511:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2516:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    251b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    251f:	0f b6 00             	movzbl (%rax),%eax
+    2522:	84 c0                	test   %al,%al
+    2524:	74 12                	je     2538 <strcmp+0x35>
+    2526:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    252a:	0f b6 10             	movzbl (%rax),%edx
+    252d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2531:	0f b6 00             	movzbl (%rax),%eax
+    2534:	38 c2                	cmp    %al,%dl
+    2536:	74 d9                	je     2511 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2538:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    253c:	0f b6 00             	movzbl (%rax),%eax
+    253f:	0f b6 d0             	movzbl %al,%edx
+    2542:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2546:	0f b6 00             	movzbl (%rax),%eax
+    2549:	0f b6 c0             	movzbl %al,%eax
+    254c:	29 c2                	sub    %eax,%edx
+    254e:	89 d0                	mov    %edx,%eax
+}
+    2550:	5d                   	pop    %rbp
+    2551:	c3                   	ret
+
+0000000000002552 <strlen>:
+uint strlen(char *s) {
+    2552:	55                   	push   %rbp
+    2553:	48 89 e5             	mov    %rsp,%rbp
+    2556:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    255a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2561:	eb 04                	jmp    2567 <strlen+0x15>
+    2563:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2567:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    256a:	48 63 d0             	movslq %eax,%rdx
+    256d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2571:	48 01 d0             	add    %rdx,%rax
+    2574:	0f b6 00             	movzbl (%rax),%eax
+    2577:	84 c0                	test   %al,%al
+    2579:	75 e8                	jne    2563 <strlen+0x11>
+    ;
+  return n;
+    257b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    257e:	5d                   	pop    %rbp
+    257f:	c3                   	ret
+
+0000000000002580 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    2580:	55                   	push   %rbp
+    2581:	48 89 e5             	mov    %rsp,%rbp
+    2584:	53                   	push   %rbx
+    2585:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    2589:	8b 05 b5 2a 00 00    	mov    0x2ab5(%rip),%eax        # 5044 <erms>
+    258f:	85 c0                	test   %eax,%eax
+    2591:	79 53                	jns    25e6 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    2593:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2597:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    259d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    25a2:	ba 00 00 00 00       	mov    $0x0,%edx
+    25a7:	48 89 c6             	mov    %rax,%rsi
+    25aa:	bf 00 00 00 00       	mov    $0x0,%edi
+    25af:	e8 9e fe ff ff       	call   2452 <cpuid>
+    ebx = 0;
+    25b4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    25bb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    25be:	83 f8 06             	cmp    $0x6,%eax
+    25c1:	76 14                	jbe    25d7 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    25c3:	b8 07 00 00 00       	mov    $0x7,%eax
+    25c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    25cd:	0f a2                	cpuid
+    25cf:	89 d9                	mov    %ebx,%ecx
+    25d1:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    25d4:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    25d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    25da:	c1 e8 09             	shr    $0x9,%eax
+    25dd:	83 e0 01             	and    $0x1,%eax
+    25e0:	89 05 5e 2a 00 00    	mov    %eax,0x2a5e(%rip)        # 5044 <erms>
+  }
+  return erms;
+    25e6:	8b 05 58 2a 00 00    	mov    0x2a58(%rip),%eax        # 5044 <erms>
+}
+    25ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    25f0:	c9                   	leave
+    25f1:	c3                   	ret
+
+00000000000025f2 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    25f2:	55                   	push   %rbp
+    25f3:	48 89 e5             	mov    %rsp,%rbp
+    25f6:	48 83 ec 10          	sub    $0x10,%rsp
+    25fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    25fe:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2601:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    2604:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    2608:	76 09                	jbe    2613 <memset+0x21>
+    260a:	e8 71 ff ff ff       	call   2580 <haserms>
+    260f:	85 c0                	test   %eax,%eax
+    2611:	74 16                	je     2629 <memset+0x37>
+    stosb(dst, c, n);
+    2613:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2616:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    2619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    261d:	89 ce                	mov    %ecx,%esi
+    261f:	48 89 c7             	mov    %rax,%rdi
+    2622:	e8 26 fd ff ff       	call   234d <stosb>
+    2627:	eb 58                	jmp    2681 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    2629:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    262c:	c1 e8 03             	shr    $0x3,%eax
+    262f:	89 c6                	mov    %eax,%esi
+    2631:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2634:	48 98                	cltq
+    2636:	0f b6 c0             	movzbl %al,%eax
+    2639:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    2640:	01 01 01 
+    2643:	48 0f af c2          	imul   %rdx,%rax
+    2647:	48 89 c1             	mov    %rax,%rcx
+    264a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    264e:	48 89 f2             	mov    %rsi,%rdx
+    2651:	48 89 ce             	mov    %rcx,%rsi
+    2654:	48 89 c7             	mov    %rax,%rdi
+    2657:	e8 23 fd ff ff       	call   237f <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    265c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    265f:	83 e0 07             	and    $0x7,%eax
+    2662:	89 c2                	mov    %eax,%edx
+    2664:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2667:	83 e0 f8             	and    $0xfffffff8,%eax
+    266a:	48 89 c1             	mov    %rax,%rcx
+    266d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2671:	48 01 c1             	add    %rax,%rcx
+    2674:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2677:	89 c6                	mov    %eax,%esi
+    2679:	48 89 cf             	mov    %rcx,%rdi
+    267c:	e8 cc fc ff ff       	call   234d <stosb>
+  }
+  return dst;
+    2681:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2685:	c9                   	leave
+    2686:	c3                   	ret
+
+0000000000002687 <strchr>:
+
+char *strchr(const char *s, char c) {
+    2687:	55                   	push   %rbp
+    2688:	48 89 e5             	mov    %rsp,%rbp
+    268b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    268f:	89 f0                	mov    %esi,%eax
+    2691:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    2694:	eb 17                	jmp    26ad <strchr+0x26>
+    if (*s == c)
+    2696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    269a:	0f b6 00             	movzbl (%rax),%eax
+    269d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    26a0:	75 06                	jne    26a8 <strchr+0x21>
+      return (char *)s;
+    26a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26a6:	eb 15                	jmp    26bd <strchr+0x36>
+  for (; *s; s++)
+    26a8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    26ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    26b1:	0f b6 00             	movzbl (%rax),%eax
+    26b4:	84 c0                	test   %al,%al
+    26b6:	75 de                	jne    2696 <strchr+0xf>
+  return 0;
+    26b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    26bd:	5d                   	pop    %rbp
+    26be:	c3                   	ret
+
+00000000000026bf <gets>:
+
+char *gets(char *buf, int max) {
+    26bf:	55                   	push   %rbp
+    26c0:	48 89 e5             	mov    %rsp,%rbp
+    26c3:	48 83 ec 20          	sub    $0x20,%rsp
+    26c7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    26cb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    26ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    26d5:	eb 48                	jmp    271f <gets+0x60>
+    cc = read(0, &c, 1);
+    26d7:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    26db:	ba 01 00 00 00       	mov    $0x1,%edx
+    26e0:	48 89 c6             	mov    %rax,%rsi
+    26e3:	bf 00 00 00 00       	mov    $0x0,%edi
+    26e8:	e8 b8 05 00 00       	call   2ca5 <read>
+    26ed:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    26f0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    26f4:	7e 36                	jle    272c <gets+0x6d>
+      break;
+    buf[i++] = c;
+    26f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    26f9:	8d 50 01             	lea    0x1(%rax),%edx
+    26fc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    26ff:	48 63 d0             	movslq %eax,%rdx
+    2702:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2706:	48 01 c2             	add    %rax,%rdx
+    2709:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    270d:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    270f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2713:	3c 0a                	cmp    $0xa,%al
+    2715:	74 16                	je     272d <gets+0x6e>
+    2717:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    271b:	3c 0d                	cmp    $0xd,%al
+    271d:	74 0e                	je     272d <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    271f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2722:	83 c0 01             	add    $0x1,%eax
+    2725:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2728:	7f ad                	jg     26d7 <gets+0x18>
+    272a:	eb 01                	jmp    272d <gets+0x6e>
+      break;
+    272c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    272d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2730:	48 63 d0             	movslq %eax,%rdx
+    2733:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2737:	48 01 d0             	add    %rdx,%rax
+    273a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    273d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2741:	c9                   	leave
+    2742:	c3                   	ret
+
+0000000000002743 <stat>:
+
+int stat(char *n, struct stat *st) {
+    2743:	55                   	push   %rbp
+    2744:	48 89 e5             	mov    %rsp,%rbp
+    2747:	48 83 ec 10          	sub    $0x10,%rsp
+    274b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    274f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    2753:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    275b:	48 89 c6             	mov    %rax,%rsi
+    275e:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    2763:	e8 58 07 00 00       	call   2ec0 <fstatat>
+}
+    2768:	c9                   	leave
+    2769:	c3                   	ret
+
+000000000000276a <atoi>:
+
+int atoi(const char *s) {
+    276a:	55                   	push   %rbp
+    276b:	48 89 e5             	mov    %rsp,%rbp
+    276e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    2772:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2779:	eb 28                	jmp    27a3 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    277b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    277e:	89 d0                	mov    %edx,%eax
+    2780:	c1 e0 02             	shl    $0x2,%eax
+    2783:	01 d0                	add    %edx,%eax
+    2785:	01 c0                	add    %eax,%eax
+    2787:	89 c1                	mov    %eax,%ecx
+    2789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    278d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    2791:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2795:	0f b6 00             	movzbl (%rax),%eax
+    2798:	0f be c0             	movsbl %al,%eax
+    279b:	01 c8                	add    %ecx,%eax
+    279d:	83 e8 30             	sub    $0x30,%eax
+    27a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    27a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27a7:	0f b6 00             	movzbl (%rax),%eax
+    27aa:	3c 2f                	cmp    $0x2f,%al
+    27ac:	7e 0b                	jle    27b9 <atoi+0x4f>
+    27ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27b2:	0f b6 00             	movzbl (%rax),%eax
+    27b5:	3c 39                	cmp    $0x39,%al
+    27b7:	7e c2                	jle    277b <atoi+0x11>
+  return n;
+    27b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    27bc:	5d                   	pop    %rbp
+    27bd:	c3                   	ret
+
+00000000000027be <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    27be:	55                   	push   %rbp
+    27bf:	48 89 e5             	mov    %rsp,%rbp
+    27c2:	48 83 ec 28          	sub    $0x28,%rsp
+    27c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    27ce:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    27d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27d5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    27d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    27e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    27e5:	7f 09                	jg     27f0 <memmove+0x32>
+    return vdst;
+    27e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27eb:	e9 29 01 00 00       	jmp    2919 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    27f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27f4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    27f8:	0f 83 87 00 00 00    	jae    2885 <memmove+0xc7>
+    27fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2801:	48 63 d0             	movslq %eax,%rdx
+    2804:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2808:	48 01 d0             	add    %rdx,%rax
+    280b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    280f:	73 74                	jae    2885 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    2811:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2814:	48 98                	cltq
+    2816:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    281a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    281d:	48 98                	cltq
+    281f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    2823:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    282b:	48 09 d0             	or     %rdx,%rax
+    282e:	83 e0 07             	and    $0x7,%eax
+    2831:	48 85 c0             	test   %rax,%rax
+    2834:	75 3d                	jne    2873 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    2836:	eb 1c                	jmp    2854 <memmove+0x96>
+        src -= 8;
+    2838:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    283d:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    2842:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2846:	48 8b 10             	mov    (%rax),%rdx
+    2849:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    284d:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    2850:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    2854:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2858:	7f de                	jg     2838 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    285a:	eb 17                	jmp    2873 <memmove+0xb5>
+      *--dst = *--src;
+    285c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    2861:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    2866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    286a:	0f b6 10             	movzbl (%rax),%edx
+    286d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2871:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    2873:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2876:	8d 50 ff             	lea    -0x1(%rax),%edx
+    2879:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    287c:	85 c0                	test   %eax,%eax
+    287e:	7f dc                	jg     285c <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    2880:	e9 90 00 00 00       	jmp    2915 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    2885:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2889:	7e 09                	jle    2894 <memmove+0xd6>
+    288b:	e8 f0 fc ff ff       	call   2580 <haserms>
+    2890:	85 c0                	test   %eax,%eax
+    2892:	74 1b                	je     28af <memmove+0xf1>
+    movsb(dst, src, n);
+    2894:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2897:	48 63 d0             	movslq %eax,%rdx
+    289a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    289e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a2:	48 89 ce             	mov    %rcx,%rsi
+    28a5:	48 89 c7             	mov    %rax,%rdi
+    28a8:	e8 0c fb ff ff       	call   23b9 <movsb>
+    28ad:	eb 66                	jmp    2915 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    28af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28b2:	8d 50 07             	lea    0x7(%rax),%edx
+    28b5:	85 c0                	test   %eax,%eax
+    28b7:	0f 48 c2             	cmovs  %edx,%eax
+    28ba:	c1 f8 03             	sar    $0x3,%eax
+    28bd:	48 63 d0             	movslq %eax,%rdx
+    28c0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    28c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28c8:	48 89 ce             	mov    %rcx,%rsi
+    28cb:	48 89 c7             	mov    %rax,%rdi
+    28ce:	e8 23 fb ff ff       	call   23f6 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    28d3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    28d6:	89 d0                	mov    %edx,%eax
+    28d8:	c1 f8 1f             	sar    $0x1f,%eax
+    28db:	c1 e8 1d             	shr    $0x1d,%eax
+    28de:	01 c2                	add    %eax,%edx
+    28e0:	83 e2 07             	and    $0x7,%edx
+    28e3:	29 c2                	sub    %eax,%edx
+    28e5:	89 d0                	mov    %edx,%eax
+    28e7:	48 98                	cltq
+    28e9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    28ec:	83 e2 f8             	and    $0xfffffff8,%edx
+    28ef:	48 63 ca             	movslq %edx,%rcx
+    28f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    28f6:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    28fa:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    28fd:	83 e2 f8             	and    $0xfffffff8,%edx
+    2900:	48 63 ca             	movslq %edx,%rcx
+    2903:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2907:	48 01 d1             	add    %rdx,%rcx
+    290a:	48 89 c2             	mov    %rax,%rdx
+    290d:	48 89 cf             	mov    %rcx,%rdi
+    2910:	e8 a4 fa ff ff       	call   23b9 <movsb>
+  }
+  return vdst;
+    2915:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2919:	c9                   	leave
+    291a:	c3                   	ret
+
+000000000000291b <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    291b:	55                   	push   %rbp
+    291c:	48 89 e5             	mov    %rsp,%rbp
+    291f:	48 83 ec 20          	sub    $0x20,%rsp
+    2923:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2926:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    292a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    2931:	00 00 00 
+    2934:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    2938:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    293c:	75 0d                	jne    294b <clock_gettime+0x30>
+    293e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2942:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2946:	48 85 c0             	test   %rax,%rax
+    2949:	75 13                	jne    295e <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    294b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    294f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2952:	48 89 d6             	mov    %rdx,%rsi
+    2955:	89 c7                	mov    %eax,%edi
+    2957:	e8 e0 04 00 00       	call   2e3c <_clock_gettime>
+    295c:	eb 7d                	jmp    29db <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    295e:	e8 d1 fa ff ff       	call   2434 <rdtsc>
+    2963:	48 89 c2             	mov    %rax,%rdx
+    2966:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    296a:	48 89 d6             	mov    %rdx,%rsi
+    296d:	48 89 c7             	mov    %rax,%rdi
+    2970:	e8 7b f9 ff ff       	call   22f0 <clockns>
+    2975:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    2979:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    297d:	48 c1 e8 09          	shr    $0x9,%rax
+    2981:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    2988:	b8 44 00 
+    298b:	48 f7 e2             	mul    %rdx
+    298e:	48 89 d0             	mov    %rdx,%rax
+    2991:	48 c1 e8 0b          	shr    $0xb,%rax
+    2995:	48 89 c2             	mov    %rax,%rdx
+    2998:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    299c:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    299f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    29a3:	48 89 c8             	mov    %rcx,%rax
+    29a6:	48 c1 e8 09          	shr    $0x9,%rax
+    29aa:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    29b1:	b8 44 00 
+    29b4:	48 f7 e2             	mul    %rdx
+    29b7:	48 89 d0             	mov    %rdx,%rax
+    29ba:	48 c1 e8 0b          	shr    $0xb,%rax
+    29be:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    29c5:	48 89 c8             	mov    %rcx,%rax
+    29c8:	48 29 d0             	sub    %rdx,%rax
+    29cb:	48 89 c2             	mov    %rax,%rdx
+    29ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29d2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    29d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    29db:	c9                   	leave
+    29dc:	c3                   	ret
+
+00000000000029dd <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    29dd:	55                   	push   %rbp
+    29de:	48 89 e5             	mov    %rsp,%rbp
+    29e1:	48 83 ec 10          	sub    $0x10,%rsp
+    29e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    29e9:	eb 11                	jmp    29fc <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    29eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29ef:	be 02 00 00 00       	mov    $0x2,%esi
+    29f4:	48 89 c7             	mov    %rax,%rdi
+    29f7:	e8 6c 04 00 00       	call   2e68 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    29fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2a00:	b8 02 00 00 00       	mov    $0x2,%eax
+    2a05:	87 02                	xchg   %eax,(%rdx)
+    2a07:	85 c0                	test   %eax,%eax
+    2a09:	75 e0                	jne    29eb <mutex_wait+0xe>
+}
+    2a0b:	90                   	nop
+    2a0c:	90                   	nop
+    2a0d:	c9                   	leave
+    2a0e:	c3                   	ret
+
+0000000000002a0f <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    2a0f:	55                   	push   %rbp
+    2a10:	48 89 e5             	mov    %rsp,%rbp
+    2a13:	48 83 ec 20          	sub    $0x20,%rsp
+    2a17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    2a1b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    2a22:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2a26:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    2a2a:	8b 02                	mov    (%rdx),%eax
+    2a2c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2a31:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    2a35:	89 c1                	mov    %eax,%ecx
+    2a37:	0f 94 c0             	sete   %al
+    2a3a:	84 c0                	test   %al,%al
+    2a3c:	75 02                	jne    2a40 <mutex_lock+0x31>
+    2a3e:	89 0a                	mov    %ecx,(%rdx)
+    2a40:	83 f0 01             	xor    $0x1,%eax
+    2a43:	84 c0                	test   %al,%al
+    2a45:	74 0c                	je     2a53 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    2a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a4b:	48 89 c7             	mov    %rax,%rdi
+    2a4e:	e8 8a ff ff ff       	call   29dd <mutex_wait>
+}
+    2a53:	90                   	nop
+    2a54:	c9                   	leave
+    2a55:	c3                   	ret
+
+0000000000002a56 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    2a56:	55                   	push   %rbp
+    2a57:	48 89 e5             	mov    %rsp,%rbp
+    2a5a:	48 83 ec 10          	sub    $0x10,%rsp
+    2a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    2a62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a66:	ba 00 00 00 00       	mov    $0x0,%edx
+    2a6b:	87 10                	xchg   %edx,(%rax)
+    2a6d:	83 fa 02             	cmp    $0x2,%edx
+    2a70:	75 11                	jne    2a83 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    2a72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a76:	be 01 00 00 00       	mov    $0x1,%esi
+    2a7b:	48 89 c7             	mov    %rax,%rdi
+    2a7e:	e8 f0 03 00 00       	call   2e73 <futex_wake>
+}
+    2a83:	90                   	nop
+    2a84:	c9                   	leave
+    2a85:	c3                   	ret
+
+0000000000002a86 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    2a86:	55                   	push   %rbp
+    2a87:	48 89 e5             	mov    %rsp,%rbp
+    2a8a:	48 83 ec 20          	sub    $0x20,%rsp
+    2a8e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a92:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    2a96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a9a:	48 83 c0 04          	add    $0x4,%rax
+    2a9e:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    2aa2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aa6:	8b 00                	mov    (%rax),%eax
+    2aa8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    2aab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2aaf:	48 89 c7             	mov    %rax,%rdi
+    2ab2:	e8 9f ff ff ff       	call   2a56 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    2ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2abb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2abe:	89 d6                	mov    %edx,%esi
+    2ac0:	48 89 c7             	mov    %rax,%rdi
+    2ac3:	e8 a0 03 00 00       	call   2e68 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    2ac8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2acc:	48 83 c0 04          	add    $0x4,%rax
+    2ad0:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    2ad4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ad8:	48 89 c7             	mov    %rax,%rdi
+    2adb:	e8 fd fe ff ff       	call   29dd <mutex_wait>
+}
+    2ae0:	90                   	nop
+    2ae1:	c9                   	leave
+    2ae2:	c3                   	ret
+
+0000000000002ae3 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    2ae3:	55                   	push   %rbp
+    2ae4:	48 89 e5             	mov    %rsp,%rbp
+    2ae7:	48 83 ec 10          	sub    $0x10,%rsp
+    2aeb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    2aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2af3:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    2af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2afb:	48 83 c0 04          	add    $0x4,%rax
+    2aff:	8b 00                	mov    (%rax),%eax
+    2b01:	85 c0                	test   %eax,%eax
+    2b03:	7e 11                	jle    2b16 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    2b05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b09:	be 01 00 00 00       	mov    $0x1,%esi
+    2b0e:	48 89 c7             	mov    %rax,%rdi
+    2b11:	e8 5d 03 00 00       	call   2e73 <futex_wake>
+}
+    2b16:	90                   	nop
+    2b17:	c9                   	leave
+    2b18:	c3                   	ret
+
+0000000000002b19 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    2b19:	55                   	push   %rbp
+    2b1a:	48 89 e5             	mov    %rsp,%rbp
+    2b1d:	48 83 ec 10          	sub    $0x10,%rsp
+    2b21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    2b25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b29:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    2b2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b31:	48 83 c0 04          	add    $0x4,%rax
+    2b35:	8b 00                	mov    (%rax),%eax
+    2b37:	85 c0                	test   %eax,%eax
+    2b39:	7e 11                	jle    2b4c <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    2b3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b3f:	be 00 00 00 40       	mov    $0x40000000,%esi
+    2b44:	48 89 c7             	mov    %rax,%rdi
+    2b47:	e8 27 03 00 00       	call   2e73 <futex_wake>
+}
+    2b4c:	90                   	nop
+    2b4d:	c9                   	leave
+    2b4e:	c3                   	ret
+
+0000000000002b4f <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    2b4f:	55                   	push   %rbp
+    2b50:	48 89 e5             	mov    %rsp,%rbp
+    2b53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b57:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    2b5a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2b5e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    2b62:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    2b66:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    2b6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b6e:	8b 40 04             	mov    0x4(%rax),%eax
+    2b71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    2b74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b78:	8b 00                	mov    (%rax),%eax
+    2b7a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2b7d:	29 c2                	sub    %eax,%edx
+    2b7f:	83 fa 1f             	cmp    $0x1f,%edx
+    2b82:	76 07                	jbe    2b8b <ring_push+0x3c>
+    return -1;
+    2b84:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2b89:	eb 7e                	jmp    2c09 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    2b8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b8e:	83 e0 1f             	and    $0x1f,%eax
+    2b91:	89 c2                	mov    %eax,%edx
+    2b93:	48 89 d0             	mov    %rdx,%rax
+    2b96:	48 01 c0             	add    %rax,%rax
+    2b99:	48 01 d0             	add    %rdx,%rax
+    2b9c:	48 c1 e0 04          	shl    $0x4,%rax
+    2ba0:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    2ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ba8:	48 01 d0             	add    %rdx,%rax
+    2bab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    2baf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bb3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    2bb6:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    2bb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bbc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2bc0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    2bc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bc8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2bcc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    2bd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bd4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2bd8:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    2bdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2be0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2be4:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    2be8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bec:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    2bf0:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    2bf4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2bf7:	8d 50 01             	lea    0x1(%rax),%edx
+    2bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bfe:	48 83 c0 04          	add    $0x4,%rax
+    2c02:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2c04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2c09:	5d                   	pop    %rbp
+    2c0a:	c3                   	ret
+
+0000000000002c0b <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    2c0b:	55                   	push   %rbp
+    2c0c:	48 89 e5             	mov    %rsp,%rbp
+    2c0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2c13:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    2c17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c1b:	8b 40 08             	mov    0x8(%rax),%eax
+    2c1e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    2c21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c25:	48 83 c0 0c          	add    $0xc,%rax
+    2c29:	8b 00                	mov    (%rax),%eax
+    2c2b:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    2c2e:	75 07                	jne    2c37 <ring_pop+0x2c>
+    return -1;
+    2c30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2c35:	eb 40                	jmp    2c77 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    2c37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c3a:	83 e0 1f             	and    $0x1f,%eax
+    2c3d:	89 c2                	mov    %eax,%edx
+    2c3f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2c43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c47:	89 d2                	mov    %edx,%edx
+    2c49:	48 83 c2 61          	add    $0x61,%rdx
+    2c4d:	48 c1 e2 04          	shl    $0x4,%rdx
+    2c51:	48 01 d0             	add    %rdx,%rax
+    2c54:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2c58:	48 8b 00             	mov    (%rax),%rax
+    2c5b:	48 89 01             	mov    %rax,(%rcx)
+    2c5e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    2c62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c65:	8d 50 01             	lea    0x1(%rax),%edx
+    2c68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c6c:	48 83 c0 08          	add    $0x8,%rax
+    2c70:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2c72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2c77:	5d                   	pop    %rbp
+    2c78:	c3                   	ret
+
+0000000000002c79 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    2c79:	b8 01 00 00 00       	mov    $0x1,%eax
+    2c7e:	49 89 ca             	mov    %rcx,%r10
+    2c81:	0f 05                	syscall
+    2c83:	c3                   	ret
+
+0000000000002c84 <_exit>:
+SYSCALL_(exit)
+    2c84:	b8 02 00 00 00       	mov    $0x2,%eax
+    2c89:	49 89 ca             	mov    %rcx,%r10
+    2c8c:	0f 05                	syscall
+    2c8e:	c3                   	ret
+
+0000000000002c8f <wait>:
+SYSCALL(wait)
+    2c8f:	b8 03 00 00 00       	mov    $0x3,%eax
+    2c94:	49 89 ca             	mov    %rcx,%r10
+    2c97:	0f 05                	syscall
+    2c99:	c3                   	ret
+
+0000000000002c9a <pipe>:
+SYSCALL(pipe)
+    2c9a:	b8 04 00 00 00       	mov    $0x4,%eax
+    2c9f:	49 89 ca             	mov    %rcx,%r10
+    2ca2:	0f 05                	syscall
+    2ca4:	c3                   	ret
+
+0000000000002ca5 <read>:
+SYSCALL(read)
+    2ca5:	b8 05 00 00 00       	mov    $0x5,%eax
+    2caa:	49 89 ca             	mov    %rcx,%r10
+    2cad:	0f 05                	syscall
+    2caf:	c3                   	ret
+
+0000000000002cb0 <write>:
+SYSCALL(write)
+    2cb0:	b8 10 00 00 00       	mov    $0x10,%eax
+    2cb5:	49 89 ca             	mov    %rcx,%r10
+    2cb8:	0f 05                	syscall
+    2cba:	c3                   	ret
+
+0000000000002cbb <_close>:
+SYSCALL_(close)
+    2cbb:	b8 15 00 00 00       	mov    $0x15,%eax
+    2cc0:	49 89 ca             	mov    %rcx,%r10
+    2cc3:	0f 05                	syscall
+    2cc5:	c3                   	ret
+
+0000000000002cc6 <kill>:
+SYSCALL(kill)
+    2cc6:	b8 06 00 00 00       	mov    $0x6,%eax
+    2ccb:	49 89 ca             	mov    %rcx,%r10
+    2cce:	0f 05                	syscall
+    2cd0:	c3                   	ret
+
+0000000000002cd1 <_exec>:
+SYSCALL_(exec)
+    2cd1:	b8 07 00 00 00       	mov    $0x7,%eax
+    2cd6:	49 89 ca             	mov    %rcx,%r10
+    2cd9:	0f 05                	syscall
+    2cdb:	c3                   	ret
+
+0000000000002cdc <open>:
+SYSCALL(open)
+    2cdc:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2ce1:	49 89 ca             	mov    %rcx,%r10
+    2ce4:	0f 05                	syscall
+    2ce6:	c3                   	ret
+
+0000000000002ce7 <mknod>:
+SYSCALL(mknod)
+    2ce7:	b8 11 00 00 00       	mov    $0x11,%eax
+    2cec:	49 89 ca             	mov    %rcx,%r10
+    2cef:	0f 05                	syscall
+    2cf1:	c3                   	ret
+
+0000000000002cf2 <unlink>:
+SYSCALL(unlink)
+    2cf2:	b8 12 00 00 00       	mov    $0x12,%eax
+    2cf7:	49 89 ca             	mov    %rcx,%r10
+    2cfa:	0f 05                	syscall
+    2cfc:	c3                   	ret
+
+0000000000002cfd <fstat>:
+SYSCALL(fstat)
+    2cfd:	b8 08 00 00 00       	mov    $0x8,%eax
+    2d02:	49 89 ca             	mov    %rcx,%r10
+    2d05:	0f 05                	syscall
+    2d07:	c3                   	ret
+
+0000000000002d08 <link>:
+SYSCALL(link)
+    2d08:	b8 13 00 00 00       	mov    $0x13,%eax
+    2d0d:	49 89 ca             	mov    %rcx,%r10
+    2d10:	0f 05                	syscall
+    2d12:	c3                   	ret
+
+0000000000002d13 <mkdir>:
+SYSCALL(mkdir)
+    2d13:	b8 14 00 00 00       	mov    $0x14,%eax
+    2d18:	49 89 ca             	mov    %rcx,%r10
+    2d1b:	0f 05                	syscall
+    2d1d:	c3                   	ret
+
+0000000000002d1e <chdir>:
+SYSCALL(chdir)
+    2d1e:	b8 09 00 00 00       	mov    $0x9,%eax
+    2d23:	49 89 ca             	mov    %rcx,%r10
+    2d26:	0f 05                	syscall
+    2d28:	c3                   	ret
+
+0000000000002d29 <dup>:
+SYSCALL(dup)
+    2d29:	b8 0a 00 00 00       	mov    $0xa,%eax
+    2d2e:	49 89 ca             	mov    %rcx,%r10
+    2d31:	0f 05                	syscall
+    2d33:	c3                   	ret
+
+0000000000002d34 <getpid>:
+SYSCALL(getpid)
+    2d34:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2d39:	49 89 ca             	mov    %rcx,%r10
+    2d3c:	0f 05                	syscall
+    2d3e:	c3                   	ret
+
+0000000000002d3f <sbrk>:
+SYSCALL(sbrk)
+    2d3f:	b8 0c 00 00 00       	mov    $0xc,%eax
+    2d44:	49 89 ca             	mov    %rcx,%r10
+    2d47:	0f 05                	syscall
+    2d49:	c3                   	ret
+
+0000000000002d4a <sleep>:
+SYSCALL(sleep)
+    2d4a:	b8 0d 00 00 00       	mov    $0xd,%eax
+    2d4f:	49 89 ca             	mov    %rcx,%r10
+    2d52:	0f 05                	syscall
+    2d54:	c3                   	ret
+
+0000000000002d55 <uptime>:
+SYSCALL(uptime)
+    2d55:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2d5a:	49 89 ca             	mov    %rcx,%r10
+    2d5d:	0f 05                	syscall
+    2d5f:	c3                   	ret
+
+0000000000002d60 <sysinfo>:
+SYSCALL(sysinfo)
+    2d60:	b8 16 00 00 00       	mov    $0x16,%eax
+    2d65:	49 89 ca             	mov    %rcx,%r10
+    2d68:	0f 05                	syscall
+    2d6a:	c3                   	ret
+
+0000000000002d6b <crashn>:
+SYSCALL(crashn)
+    2d6b:	b8 17 00 00 00       	mov    $0x17,%eax
+    2d70:	49 89 ca             	mov    %rcx,%r10
+    2d73:	0f 05                	syscall
+    2d75:	c3                   	ret
+
+0000000000002d76 <mmap>:
+SYSCALL(mmap)
+    2d76:	b8 18 00 00 00       	mov    $0x18,%eax
+    2d7b:	49 89 ca             	mov    %rcx,%r10
+    2d7e:	0f 05                	syscall
+    2d80:	c3                   	ret
+
+0000000000002d81 <munmap>:
+SYSCALL(munmap)
+    2d81:	b8 19 00 00 00       	mov    $0x19,%eax
+    2d86:	49 89 ca             	mov    %rcx,%r10
+    2d89:	0f 05                	syscall
+    2d8b:	c3                   	ret
+
+0000000000002d8c <nice>:
+SYSCALL(nice)
+    2d8c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    2d91:	49 89 ca             	mov    %rcx,%r10
+    2d94:	0f 05                	syscall
+    2d96:	c3                   	ret
+
+0000000000002d97 <_spawn>:
+SYSCALL_(spawn)
+    2d97:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    2d9c:	49 89 ca             	mov    %rcx,%r10
+    2d9f:	0f 05                	syscall
+    2da1:	c3                   	ret
+
+0000000000002da2 <pread>:
+SYSCALL(pread)
+    2da2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2da7:	49 89 ca             	mov    %rcx,%r10
+    2daa:	0f 05                	syscall
+    2dac:	c3                   	ret
+
+0000000000002dad <pwrite>:
+SYSCALL(pwrite)
+    2dad:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    2db2:	49 89 ca             	mov    %rcx,%r10
+    2db5:	0f 05                	syscall
+    2db7:	c3                   	ret
+
+0000000000002db8 <readv>:
+SYSCALL(readv)
+    2db8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    2dbd:	49 89 ca             	mov    %rcx,%r10
+    2dc0:	0f 05                	syscall
+    2dc2:	c3                   	ret
+
+0000000000002dc3 <writev>:
+SYSCALL(writev)
+    2dc3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2dc8:	49 89 ca             	mov    %rcx,%r10
+    2dcb:	0f 05                	syscall
+    2dcd:	c3                   	ret
+
+0000000000002dce <sendfile>:
+SYSCALL(sendfile)
+    2dce:	b8 20 00 00 00       	mov    $0x20,%eax
+    2dd3:	49 89 ca             	mov    %rcx,%r10
+    2dd6:	0f 05                	syscall
+    2dd8:	c3                   	ret
+
+0000000000002dd9 <splice>:
+SYSCALL(splice)
+    2dd9:	b8 21 00 00 00       	mov    $0x21,%eax
+    2dde:	49 89 ca             	mov    %rcx,%r10
+    2de1:	0f 05                	syscall
+    2de3:	c3                   	ret
+
+0000000000002de4 <poll>:
+SYSCALL(poll)
+    2de4:	b8 22 00 00 00       	mov    $0x22,%eax
+    2de9:	49 89 ca             	mov    %rcx,%r10
+    2dec:	0f 05                	syscall
+    2dee:	c3                   	ret
+
+0000000000002def <fsync>:
+SYSCALL(fsync)
+    2def:	b8 23 00 00 00       	mov    $0x23,%eax
+    2df4:	49 89 ca             	mov    %rcx,%r10
+    2df7:	0f 05                	syscall
+    2df9:	c3                   	ret
+
+0000000000002dfa <fdatasync>:
+SYSCALL(fdatasync)
+    2dfa:	b8 24 00 00 00       	mov    $0x24,%eax
+    2dff:	49 89 ca             	mov    %rcx,%r10
+    2e02:	0f 05                	syscall
+    2e04:	c3                   	ret
+
+0000000000002e05 <lockstat>:
+SYSCALL(lockstat)
+    2e05:	b8 25 00 00 00       	mov    $0x25,%eax
+    2e0a:	49 89 ca             	mov    %rcx,%r10
+    2e0d:	0f 05                	syscall
+    2e0f:	c3                   	ret
+
+0000000000002e10 <syscallstat>:
+SYSCALL(syscallstat)
+    2e10:	b8 26 00 00 00       	mov    $0x26,%eax
+    2e15:	49 89 ca             	mov    %rcx,%r10
+    2e18:	0f 05                	syscall
+    2e1a:	c3                   	ret
+
+0000000000002e1b <trace>:
+SYSCALL(trace)
+    2e1b:	b8 27 00 00 00       	mov    $0x27,%eax
+    2e20:	49 89 ca             	mov    %rcx,%r10
+    2e23:	0f 05                	syscall
+    2e25:	c3                   	ret
+
+0000000000002e26 <profile>:
+SYSCALL(profile)
+    2e26:	b8 28 00 00 00       	mov    $0x28,%eax
+    2e2b:	49 89 ca             	mov    %rcx,%r10
+    2e2e:	0f 05                	syscall
+    2e30:	c3                   	ret
+
+0000000000002e31 <cycles>:
+SYSCALL(cycles)
+    2e31:	b8 29 00 00 00       	mov    $0x29,%eax
+    2e36:	49 89 ca             	mov    %rcx,%r10
+    2e39:	0f 05                	syscall
+    2e3b:	c3                   	ret
+
+0000000000002e3c <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    2e3c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    2e41:	49 89 ca             	mov    %rcx,%r10
+    2e44:	0f 05                	syscall
+    2e46:	c3                   	ret
+
+0000000000002e47 <consmode>:
+SYSCALL(consmode)
+    2e47:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    2e4c:	49 89 ca             	mov    %rcx,%r10
+    2e4f:	0f 05                	syscall
+    2e51:	c3                   	ret
+
+0000000000002e52 <clone>:
+SYSCALL(clone)
+    2e52:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    2e57:	49 89 ca             	mov    %rcx,%r10
+    2e5a:	0f 05                	syscall
+    2e5c:	c3                   	ret
+
+0000000000002e5d <join>:
+SYSCALL(join)
+    2e5d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    2e62:	49 89 ca             	mov    %rcx,%r10
+    2e65:	0f 05                	syscall
+    2e67:	c3                   	ret
+
+0000000000002e68 <futex_wait>:
+SYSCALL(futex_wait)
+    2e68:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    2e6d:	49 89 ca             	mov    %rcx,%r10
+    2e70:	0f 05                	syscall
+    2e72:	c3                   	ret
+
+0000000000002e73 <futex_wake>:
+SYSCALL(futex_wake)
+    2e73:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    2e78:	49 89 ca             	mov    %rcx,%r10
+    2e7b:	0f 05                	syscall
+    2e7d:	c3                   	ret
+
+0000000000002e7e <shmget>:
+SYSCALL(shmget)
+    2e7e:	b8 30 00 00 00       	mov    $0x30,%eax
+    2e83:	49 89 ca             	mov    %rcx,%r10
+    2e86:	0f 05                	syscall
+    2e88:	c3                   	ret
+
+0000000000002e89 <shmat>:
+SYSCALL(shmat)
+    2e89:	b8 31 00 00 00       	mov    $0x31,%eax
+    2e8e:	49 89 ca             	mov    %rcx,%r10
+    2e91:	0f 05                	syscall
+    2e93:	c3                   	ret
+
+0000000000002e94 <shmdt>:
+SYSCALL(shmdt)
+    2e94:	b8 32 00 00 00       	mov    $0x32,%eax
+    2e99:	49 89 ca             	mov    %rcx,%r10
+    2e9c:	0f 05                	syscall
+    2e9e:	c3                   	ret
+
+0000000000002e9f <ring_setup>:
+SYSCALL(ring_setup)
+    2e9f:	b8 33 00 00 00       	mov    $0x33,%eax
+    2ea4:	49 89 ca             	mov    %rcx,%r10
+    2ea7:	0f 05                	syscall
+    2ea9:	c3                   	ret
+
+0000000000002eaa <ring_enter>:
+SYSCALL(ring_enter)
+    2eaa:	b8 34 00 00 00       	mov    $0x34,%eax
+    2eaf:	49 89 ca             	mov    %rcx,%r10
+    2eb2:	0f 05                	syscall
+    2eb4:	c3                   	ret
+
+0000000000002eb5 <getdents>:
+SYSCALL(getdents)
+    2eb5:	b8 35 00 00 00       	mov    $0x35,%eax
+    2eba:	49 89 ca             	mov    %rcx,%r10
+    2ebd:	0f 05                	syscall
+    2ebf:	c3                   	ret
+
+0000000000002ec0 <fstatat>:
+SYSCALL(fstatat)
+    2ec0:	b8 36 00 00 00       	mov    $0x36,%eax
+    2ec5:	49 89 ca             	mov    %rcx,%r10
+    2ec8:	0f 05                	syscall
+    2eca:	c3                   	ret
+
+0000000000002ecb <clone_file>:
+SYSCALL(clone_file)
+    2ecb:	b8 37 00 00 00       	mov    $0x37,%eax
+    2ed0:	49 89 ca             	mov    %rcx,%r10
+    2ed3:	0f 05                	syscall
+    2ed5:	c3                   	ret
+
+0000000000002ed6 <fpunch>:
+SYSCALL(fpunch)
+    2ed6:	b8 38 00 00 00       	mov    $0x38,%eax
+    2edb:	49 89 ca             	mov    %rcx,%r10
+    2ede:	0f 05                	syscall
+    2ee0:	c3                   	ret
+
+0000000000002ee1 <defrag>:
+SYSCALL(defrag)
+    2ee1:	b8 39 00 00 00       	mov    $0x39,%eax
+    2ee6:	49 89 ca             	mov    %rcx,%r10
+    2ee9:	0f 05                	syscall
+    2eeb:	c3                   	ret
+
+0000000000002eec <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    2eec:	55                   	push   %rbp
+    2eed:	48 89 e5             	mov    %rsp,%rbp
+    2ef0:	48 83 ec 20          	sub    $0x20,%rsp
+    2ef4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    2ef8:	bf 00 00 00 00       	mov    $0x0,%edi
+    2efd:	e8 3d fe ff ff       	call   2d3f <sbrk>
+    2f02:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    2f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f0a:	48 f7 d8             	neg    %rax
+    2f0d:	25 ff 0f 00 00       	and    $0xfff,%eax
+    2f12:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    2f16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2f1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f1e:	48 01 c2             	add    %rax,%rdx
+    2f21:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    2f26:	48 39 c2             	cmp    %rax,%rdx
+    2f29:	73 1e                	jae    2f49 <morecore+0x5d>
+    2f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f2f:	89 c2                	mov    %eax,%edx
+    2f31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f35:	01 d0                	add    %edx,%eax
+    2f37:	89 c7                	mov    %eax,%edi
+    2f39:	e8 01 fe ff ff       	call   2d3f <sbrk>
+    2f3e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2f42:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2f47:	75 07                	jne    2f50 <morecore+0x64>
+    return 0;
+    2f49:	b8 00 00 00 00       	mov    $0x0,%eax
+    2f4e:	eb 27                	jmp    2f77 <morecore+0x8b>
+  stats.heap += n + pad;
+    2f50:	48 8b 05 39 22 00 00 	mov    0x2239(%rip),%rax        # 5190 <stats+0x50>
+    2f57:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2f5b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2f5f:	48 01 ca             	add    %rcx,%rdx
+    2f62:	48 01 d0             	add    %rdx,%rax
+    2f65:	48 89 05 24 22 00 00 	mov    %rax,0x2224(%rip)        # 5190 <stats+0x50>
+  return p + pad;
+    2f6c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2f70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f74:	48 01 d0             	add    %rdx,%rax
+}
+    2f77:	c9                   	leave
+    2f78:	c3                   	ret
+
+0000000000002f79 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    2f79:	55                   	push   %rbp
+    2f7a:	48 89 e5             	mov    %rsp,%rbp
+    2f7d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2f81:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    2f85:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2f8c:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2f8d:	48 8d 05 8c 21 00 00 	lea    0x218c(%rip),%rax        # 5120 <runs>
+    2f94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2f98:	eb 1a                	jmp    2fb4 <pagefree+0x3b>
+    prev = *rp;
+    2f9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f9e:	48 8b 00             	mov    (%rax),%rax
+    2fa1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2fa5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fa9:	48 8b 00             	mov    (%rax),%rax
+    2fac:	48 83 c0 08          	add    $0x8,%rax
+    2fb0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2fb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fb8:	48 8b 00             	mov    (%rax),%rax
+    2fbb:	48 85 c0             	test   %rax,%rax
+    2fbe:	74 0d                	je     2fcd <pagefree+0x54>
+    2fc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fc4:	48 8b 00             	mov    (%rax),%rax
+    2fc7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2fcb:	72 cd                	jb     2f9a <pagefree+0x21>
+  r = (struct run *)p;
+    2fcd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2fd1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    2fd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fd9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2fdd:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    2fe0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fe4:	48 8b 10             	mov    (%rax),%rdx
+    2fe7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2feb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    2fef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ff3:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2ff7:	48 85 c0             	test   %rax,%rax
+    2ffa:	74 48                	je     3044 <pagefree+0xcb>
+    2ffc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3000:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3004:	48 01 c2             	add    %rax,%rdx
+    3007:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    300b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    300f:	48 39 c2             	cmp    %rax,%rdx
+    3012:	75 30                	jne    3044 <pagefree+0xcb>
+    r->size += r->next->size;
+    3014:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3018:	48 8b 10             	mov    (%rax),%rdx
+    301b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    301f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3023:	48 8b 00             	mov    (%rax),%rax
+    3026:	48 01 c2             	add    %rax,%rdx
+    3029:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    302d:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    3030:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3034:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3038:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    303c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3040:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    3044:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3049:	74 46                	je     3091 <pagefree+0x118>
+    304b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    304f:	48 8b 10             	mov    (%rax),%rdx
+    3052:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3056:	48 01 d0             	add    %rdx,%rax
+    3059:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    305d:	75 32                	jne    3091 <pagefree+0x118>
+    prev->size += r->size;
+    305f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3063:	48 8b 10             	mov    (%rax),%rdx
+    3066:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    306a:	48 8b 00             	mov    (%rax),%rax
+    306d:	48 01 c2             	add    %rax,%rdx
+    3070:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3074:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    3077:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    307b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    307f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3083:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    3087:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    308b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    308f:	eb 0c                	jmp    309d <pagefree+0x124>
+  } else {
+    *rp = r;
+    3091:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3095:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3099:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    309c:	90                   	nop
+    309d:	90                   	nop
+    309e:	5d                   	pop    %rbp
+    309f:	c3                   	ret
+
+00000000000030a0 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    30a0:	55                   	push   %rbp
+    30a1:	48 89 e5             	mov    %rsp,%rbp
+    30a4:	48 83 ec 40          	sub    $0x40,%rsp
+    30a8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    30ac:	48 8d 05 6d 20 00 00 	lea    0x206d(%rip),%rax        # 5120 <runs>
+    30b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    30b7:	eb 66                	jmp    311f <pagealloc+0x7f>
+    if (r->size == n) {
+    30b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30bd:	48 8b 00             	mov    (%rax),%rax
+    30c0:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    30c4:	75 18                	jne    30de <pagealloc+0x3e>
+      *rp = r->next;
+    30c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30ca:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    30ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30d2:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    30d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30d9:	e9 ca 00 00 00       	jmp    31a8 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    30de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30e2:	48 8b 00             	mov    (%rax),%rax
+    30e5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    30e9:	73 28                	jae    3113 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    30eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30ef:	48 8b 00             	mov    (%rax),%rax
+    30f2:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    30f6:	48 89 c2             	mov    %rax,%rdx
+    30f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    30fd:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    3100:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3104:	48 8b 10             	mov    (%rax),%rdx
+    3107:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    310b:	48 01 d0             	add    %rdx,%rax
+    310e:	e9 95 00 00 00       	jmp    31a8 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    3113:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3117:	48 83 c0 08          	add    $0x8,%rax
+    311b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    311f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3123:	48 8b 00             	mov    (%rax),%rax
+    3126:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    312a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    312f:	75 88                	jne    30b9 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    3131:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3135:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    3139:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    3140:	00 
+    3141:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3145:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3149:	48 39 c2             	cmp    %rax,%rdx
+    314c:	48 0f 43 c2          	cmovae %rdx,%rax
+    3150:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    3154:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3158:	48 89 c7             	mov    %rax,%rdi
+    315b:	e8 8c fd ff ff       	call   2eec <morecore>
+    3160:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3164:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3169:	75 07                	jne    3172 <pagealloc+0xd2>
+    return 0;
+    316b:	b8 00 00 00 00       	mov    $0x0,%eax
+    3170:	eb 36                	jmp    31a8 <pagealloc+0x108>
+  if (m > n)
+    3172:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3176:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    317a:	73 1a                	jae    3196 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    317c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3180:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3184:	48 89 c2             	mov    %rax,%rdx
+    3187:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    318b:	48 89 d6             	mov    %rdx,%rsi
+    318e:	48 89 c7             	mov    %rax,%rdi
+    3191:	e8 e3 fd ff ff       	call   2f79 <pagefree>
+  return p + m - n;
+    3196:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    319a:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    319e:	48 89 c2             	mov    %rax,%rdx
+    31a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    31a5:	48 01 d0             	add    %rdx,%rax
+}
+    31a8:	c9                   	leave
+    31a9:	c3                   	ret
+
+00000000000031aa <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    31aa:	55                   	push   %rbp
+    31ab:	48 89 e5             	mov    %rsp,%rbp
+    31ae:	48 83 ec 30          	sub    $0x30,%rsp
+    31b2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    31b5:	bf 00 10 00 00       	mov    $0x1000,%edi
+    31ba:	e8 e1 fe ff ff       	call   30a0 <pagealloc>
+    31bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    31c3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    31c8:	75 0a                	jne    31d4 <refill+0x2a>
+    return -1;
+    31ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    31cf:	e9 da 00 00 00       	jmp    32ae <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    31d4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    31db:	00 
+    31dc:	e9 ba 00 00 00       	jmp    329b <refill+0xf1>
+    b = (struct block *)(p + off);
+    31e1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    31e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31e9:	48 01 d0             	add    %rdx,%rax
+    31ec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    31f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    31f3:	ba 20 00 00 00       	mov    $0x20,%edx
+    31f8:	89 c1                	mov    %eax,%ecx
+    31fa:	48 d3 e2             	shl    %cl,%rdx
+    31fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3201:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    3204:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3207:	48 63 d0             	movslq %eax,%rdx
+    320a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    320e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    3212:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3215:	48 98                	cltq
+    3217:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    321e:	00 
+    321f:	48 8d 05 ba 1e 00 00 	lea    0x1eba(%rip),%rax        # 50e0 <freelist>
+    3226:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    322a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    322e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    3232:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3235:	48 98                	cltq
+    3237:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    323e:	00 
+    323f:	48 8d 15 9a 1e 00 00 	lea    0x1e9a(%rip),%rdx        # 50e0 <freelist>
+    3246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    324a:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    324e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3251:	48 98                	cltq
+    3253:	48 83 c0 08          	add    $0x8,%rax
+    3257:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    325e:	00 
+    325f:	48 8d 05 de 1e 00 00 	lea    0x1ede(%rip),%rax        # 5144 <stats+0x4>
+    3266:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3269:	8d 48 01             	lea    0x1(%rax),%ecx
+    326c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    326f:	48 98                	cltq
+    3271:	48 83 c0 08          	add    $0x8,%rax
+    3275:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    327c:	00 
+    327d:	48 8d 05 c0 1e 00 00 	lea    0x1ec0(%rip),%rax        # 5144 <stats+0x4>
+    3284:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    3287:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    328a:	ba 20 00 00 00       	mov    $0x20,%edx
+    328f:	89 c1                	mov    %eax,%ecx
+    3291:	48 d3 e2             	shl    %cl,%rdx
+    3294:	48 89 d0             	mov    %rdx,%rax
+    3297:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    329b:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    32a2:	00 
+    32a3:	0f 86 38 ff ff ff    	jbe    31e1 <refill+0x37>
+  }
+  return 0;
+    32a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    32ae:	c9                   	leave
+    32af:	c3                   	ret
+
+00000000000032b0 <malloc>:
+
+void *malloc(uint nbytes) {
+    32b0:	55                   	push   %rbp
+    32b1:	48 89 e5             	mov    %rsp,%rbp
+    32b4:	48 83 ec 30          	sub    $0x30,%rsp
+    32b8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    32bb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    32be:	48 83 c0 10          	add    $0x10,%rax
+    32c2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    32c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    32cd:	eb 04                	jmp    32d3 <malloc+0x23>
+    32cf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    32d3:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    32d7:	7f 16                	jg     32ef <malloc+0x3f>
+    32d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    32dc:	ba 20 00 00 00       	mov    $0x20,%edx
+    32e1:	89 c1                	mov    %eax,%ecx
+    32e3:	48 d3 e2             	shl    %cl,%rdx
+    32e6:	48 89 d0             	mov    %rdx,%rax
+    32e9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    32ed:	72 e0                	jb     32cf <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    32ef:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    32f3:	75 7d                	jne    3372 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    32f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32f9:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    32ff:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    3305:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    3309:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    330d:	48 89 c7             	mov    %rax,%rdi
+    3310:	e8 8b fd ff ff       	call   30a0 <pagealloc>
+    3315:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3319:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    331e:	75 0a                	jne    332a <malloc+0x7a>
+      return 0;
+    3320:	b8 00 00 00 00       	mov    $0x0,%eax
+    3325:	e9 2c 01 00 00       	jmp    3456 <malloc+0x1a6>
+    h->size = n;
+    332a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    332e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3332:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    3335:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3339:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    3340:	00 
+    stats.inuse[LARGE]++;
+    3341:	8b 05 19 1e 00 00    	mov    0x1e19(%rip),%eax        # 5160 <stats+0x20>
+    3347:	83 c0 01             	add    $0x1,%eax
+    334a:	89 05 10 1e 00 00    	mov    %eax,0x1e10(%rip)        # 5160 <stats+0x20>
+    stats.large += n;
+    3350:	48 8b 15 31 1e 00 00 	mov    0x1e31(%rip),%rdx        # 5188 <stats+0x48>
+    3357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    335b:	48 01 d0             	add    %rdx,%rax
+    335e:	48 89 05 23 1e 00 00 	mov    %rax,0x1e23(%rip)        # 5188 <stats+0x48>
+    return h + 1;
+    3365:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3369:	48 83 c0 10          	add    $0x10,%rax
+    336d:	e9 e4 00 00 00       	jmp    3456 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    3372:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3375:	48 98                	cltq
+    3377:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    337e:	00 
+    337f:	48 8d 05 5a 1d 00 00 	lea    0x1d5a(%rip),%rax        # 50e0 <freelist>
+    3386:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    338a:	48 85 c0             	test   %rax,%rax
+    338d:	75 18                	jne    33a7 <malloc+0xf7>
+    338f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3392:	89 c7                	mov    %eax,%edi
+    3394:	e8 11 fe ff ff       	call   31aa <refill>
+    3399:	85 c0                	test   %eax,%eax
+    339b:	79 0a                	jns    33a7 <malloc+0xf7>
+    return 0;
+    339d:	b8 00 00 00 00       	mov    $0x0,%eax
+    33a2:	e9 af 00 00 00       	jmp    3456 <malloc+0x1a6>
+  b = freelist[c];
+    33a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    33aa:	48 98                	cltq
+    33ac:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    33b3:	00 
+    33b4:	48 8d 05 25 1d 00 00 	lea    0x1d25(%rip),%rax        # 50e0 <freelist>
+    33bb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    33bf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    33c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33c7:	48 8b 40 10          	mov    0x10(%rax),%rax
+    33cb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    33ce:	48 63 d2             	movslq %edx,%rdx
+    33d1:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    33d8:	00 
+    33d9:	48 8d 15 00 1d 00 00 	lea    0x1d00(%rip),%rdx        # 50e0 <freelist>
+    33e0:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    33e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    33e7:	48 98                	cltq
+    33e9:	48 83 c0 08          	add    $0x8,%rax
+    33ed:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    33f4:	00 
+    33f5:	48 8d 05 48 1d 00 00 	lea    0x1d48(%rip),%rax        # 5144 <stats+0x4>
+    33fc:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    33ff:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3402:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3405:	48 98                	cltq
+    3407:	48 83 c0 08          	add    $0x8,%rax
+    340b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3412:	00 
+    3413:	48 8d 05 2a 1d 00 00 	lea    0x1d2a(%rip),%rax        # 5144 <stats+0x4>
+    341a:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    341d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3420:	48 98                	cltq
+    3422:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3429:	00 
+    342a:	48 8d 05 0f 1d 00 00 	lea    0x1d0f(%rip),%rax        # 5140 <stats>
+    3431:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3434:	8d 48 01             	lea    0x1(%rax),%ecx
+    3437:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    343a:	48 98                	cltq
+    343c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3443:	00 
+    3444:	48 8d 05 f5 1c 00 00 	lea    0x1cf5(%rip),%rax        # 5140 <stats>
+    344b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    344e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3452:	48 83 c0 10          	add    $0x10,%rax
+}
+    3456:	c9                   	leave
+    3457:	c3                   	ret
+
+0000000000003458 <free>:
+
+void free(void *ap) {
+    3458:	55                   	push   %rbp
+    3459:	48 89 e5             	mov    %rsp,%rbp
+    345c:	48 83 ec 18          	sub    $0x18,%rsp
+    3460:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    3464:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3469:	0f 84 03 01 00 00    	je     3572 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    346f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3473:	48 83 e8 10          	sub    $0x10,%rax
+    3477:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    347b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    347f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3483:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    3487:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    348c:	75 42                	jne    34d0 <free+0x78>
+    stats.inuse[LARGE]--;
+    348e:	8b 05 cc 1c 00 00    	mov    0x1ccc(%rip),%eax        # 5160 <stats+0x20>
+    3494:	83 e8 01             	sub    $0x1,%eax
+    3497:	89 05 c3 1c 00 00    	mov    %eax,0x1cc3(%rip)        # 5160 <stats+0x20>
+    stats.large -= b->h.size;
+    349d:	48 8b 15 e4 1c 00 00 	mov    0x1ce4(%rip),%rdx        # 5188 <stats+0x48>
+    34a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34a8:	48 8b 00             	mov    (%rax),%rax
+    34ab:	48 29 c2             	sub    %rax,%rdx
+    34ae:	48 89 15 d3 1c 00 00 	mov    %rdx,0x1cd3(%rip)        # 5188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    34b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34b9:	48 8b 10             	mov    (%rax),%rdx
+    34bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34c0:	48 89 d6             	mov    %rdx,%rsi
+    34c3:	48 89 c7             	mov    %rax,%rdi
+    34c6:	e8 ae fa ff ff       	call   2f79 <pagefree>
+    return;
+    34cb:	e9 a3 00 00 00       	jmp    3573 <free+0x11b>
+  }
+  b->next = freelist[c];
+    34d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    34d4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    34db:	00 
+    34dc:	48 8d 05 fd 1b 00 00 	lea    0x1bfd(%rip),%rax        # 50e0 <freelist>
+    34e3:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    34e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34eb:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    34ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    34f3:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    34fa:	00 
+    34fb:	48 8d 15 de 1b 00 00 	lea    0x1bde(%rip),%rdx        # 50e0 <freelist>
+    3502:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3506:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    350a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    350e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3515:	00 
+    3516:	48 8d 05 23 1c 00 00 	lea    0x1c23(%rip),%rax        # 5140 <stats>
+    351d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3520:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3523:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3527:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    352e:	00 
+    352f:	48 8d 05 0a 1c 00 00 	lea    0x1c0a(%rip),%rax        # 5140 <stats>
+    3536:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    3539:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    353d:	48 83 c0 08          	add    $0x8,%rax
+    3541:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3548:	00 
+    3549:	48 8d 05 f4 1b 00 00 	lea    0x1bf4(%rip),%rax        # 5144 <stats+0x4>
+    3550:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3553:	8d 48 01             	lea    0x1(%rax),%ecx
+    3556:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    355a:	48 83 c0 08          	add    $0x8,%rax
+    355e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3565:	00 
+    3566:	48 8d 05 d7 1b 00 00 	lea    0x1bd7(%rip),%rax        # 5144 <stats+0x4>
+    356d:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    3570:	eb 01                	jmp    3573 <free+0x11b>
+    return;
+    3572:	90                   	nop
+}
+    3573:	c9                   	leave
+    3574:	c3                   	ret
+
+0000000000003575 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    3575:	55                   	push   %rbp
+    3576:	48 89 e5             	mov    %rsp,%rbp
+    3579:	48 83 ec 30          	sub    $0x30,%rsp
+    357d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    3580:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3583:	48 8d 15 46 0d 00 00 	lea    0xd46(%rip),%rdx        # 42d0 <benchreport+0xc33>
+    358a:	48 89 d6             	mov    %rdx,%rsi
+    358d:	89 c7                	mov    %eax,%edi
+    358f:	b8 00 00 00 00       	mov    $0x0,%eax
+    3594:	e8 37 e6 ff ff       	call   1bd0 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3599:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    35a0:	eb 67                	jmp    3609 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    35a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    35a5:	48 98                	cltq
+    35a7:	48 83 c0 08          	add    $0x8,%rax
+    35ab:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    35b2:	00 
+    35b3:	48 8d 05 8a 1b 00 00 	lea    0x1b8a(%rip),%rax        # 5144 <stats+0x4>
+    35ba:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    35bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    35c0:	48 98                	cltq
+    35c2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    35c9:	00 
+    35ca:	48 8d 05 6f 1b 00 00 	lea    0x1b6f(%rip),%rax        # 5140 <stats>
+    35d1:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    35d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    35d7:	ba 20 00 00 00       	mov    $0x20,%edx
+    35dc:	89 c1                	mov    %eax,%ecx
+    35de:	48 d3 e2             	shl    %cl,%rdx
+    35e1:	48 89 d0             	mov    %rdx,%rax
+    35e4:	89 c1                	mov    %eax,%ecx
+    35e6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    35e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    35ec:	41 89 f9             	mov    %edi,%r9d
+    35ef:	41 89 f0             	mov    %esi,%r8d
+    35f2:	48 8d 35 ee 0c 00 00 	lea    0xcee(%rip),%rsi        # 42e7 <benchreport+0xc4a>
+    35f9:	89 c7                	mov    %eax,%edi
+    35fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    3600:	e8 cb e5 ff ff       	call   1bd0 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3605:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    3609:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    360d:	7e 93                	jle    35a2 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    360f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3616:	00 
+  for (r = runs; r; r = r->next)
+    3617:	48 8b 05 02 1b 00 00 	mov    0x1b02(%rip),%rax        # 5120 <runs>
+    361e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3622:	eb 17                	jmp    363b <mallocstats+0xc6>
+    nfree += r->size;
+    3624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3628:	48 8b 00             	mov    (%rax),%rax
+    362b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    362f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3633:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3637:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    363b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    3640:	75 e2                	jne    3624 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    3642:	48 8b 05 47 1b 00 00 	mov    0x1b47(%rip),%rax        # 5190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3649:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    364b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    364f:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3653:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3655:	48 8b 05 2c 1b 00 00 	mov    0x1b2c(%rip),%rax        # 5188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    365c:	89 c1                	mov    %eax,%ecx
+    365e:	8b 15 fc 1a 00 00    	mov    0x1afc(%rip),%edx        # 5160 <stats+0x20>
+    3664:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3667:	41 89 f9             	mov    %edi,%r9d
+    366a:	41 89 f0             	mov    %esi,%r8d
+    366d:	48 8d 35 84 0c 00 00 	lea    0xc84(%rip),%rsi        # 42f8 <benchreport+0xc5b>
+    3674:	89 c7                	mov    %eax,%edi
+    3676:	b8 00 00 00 00       	mov    $0x0,%eax
+    367b:	e8 50 e5 ff ff       	call   1bd0 <printf>
+}
+    3680:	90                   	nop
+    3681:	c9                   	leave
+    3682:	c3                   	ret
+
+0000000000003683 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    3683:	55                   	push   %rbp
+    3684:	48 89 e5             	mov    %rsp,%rbp
+    3687:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    368b:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    368f:	48 89 c7             	mov    %rax,%rdi
+    3692:	e8 9a f7 ff ff       	call   2e31 <cycles>
+  return t;
+    3697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    369b:	c9                   	leave
+    369c:	c3                   	ret
+
+000000000000369d <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    369d:	55                   	push   %rbp
+    369e:	48 89 e5             	mov    %rsp,%rbp
+    36a1:	48 83 ec 30          	sub    $0x30,%rsp
+    36a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    36a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    36ad:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    36b0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    36b4:	0f 8e 24 01 00 00    	jle    37de <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    36ba:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    36c1:	e9 98 00 00 00       	jmp    375e <benchreport+0xc1>
+    x = t[i];
+    36c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    36c9:	48 98                	cltq
+    36cb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    36d2:	00 
+    36d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36d7:	48 01 d0             	add    %rdx,%rax
+    36da:	48 8b 00             	mov    (%rax),%rax
+    36dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    36e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    36e4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    36e7:	eb 33                	jmp    371c <benchreport+0x7f>
+      t[j] = t[j - 1];
+    36e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    36ec:	48 98                	cltq
+    36ee:	48 c1 e0 03          	shl    $0x3,%rax
+    36f2:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    36f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36fa:	48 01 d0             	add    %rdx,%rax
+    36fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    3700:	48 63 d2             	movslq %edx,%rdx
+    3703:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    370a:	00 
+    370b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    370f:	48 01 ca             	add    %rcx,%rdx
+    3712:	48 8b 00             	mov    (%rax),%rax
+    3715:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3718:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    371c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    3720:	7e 1d                	jle    373f <benchreport+0xa2>
+    3722:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3725:	48 98                	cltq
+    3727:	48 c1 e0 03          	shl    $0x3,%rax
+    372b:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    372f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3733:	48 01 d0             	add    %rdx,%rax
+    3736:	48 8b 00             	mov    (%rax),%rax
+    3739:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    373d:	72 aa                	jb     36e9 <benchreport+0x4c>
+    t[j] = x;
+    373f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3742:	48 98                	cltq
+    3744:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    374b:	00 
+    374c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3750:	48 01 c2             	add    %rax,%rdx
+    3753:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3757:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    375a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    375e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3761:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    3764:	0f 8c 5c ff ff ff    	jl     36c6 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    376a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    376d:	48 98                	cltq
+    376f:	48 c1 e0 03          	shl    $0x3,%rax
+    3773:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3777:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    377b:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    377e:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    3781:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3784:	89 c2                	mov    %eax,%edx
+    3786:	c1 ea 1f             	shr    $0x1f,%edx
+    3789:	01 d0                	add    %edx,%eax
+    378b:	d1 f8                	sar    %eax
+    378d:	48 98                	cltq
+    378f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3796:	00 
+    3797:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    379b:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    379e:	48 8b 38             	mov    (%rax),%rdi
+    37a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    37a5:	48 8b 30             	mov    (%rax),%rsi
+    37a8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    37ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37af:	48 83 ec 08          	sub    $0x8,%rsp
+    37b3:	51                   	push   %rcx
+    37b4:	49 89 f9             	mov    %rdi,%r9
+    37b7:	49 89 f0             	mov    %rsi,%r8
+    37ba:	89 d1                	mov    %edx,%ecx
+    37bc:	48 89 c2             	mov    %rax,%rdx
+    37bf:	48 8d 05 72 0b 00 00 	lea    0xb72(%rip),%rax        # 4338 <benchreport+0xc9b>
+    37c6:	48 89 c6             	mov    %rax,%rsi
+    37c9:	bf 01 00 00 00       	mov    $0x1,%edi
+    37ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    37d3:	e8 f8 e3 ff ff       	call   1bd0 <printf>
+    37d8:	48 83 c4 10          	add    $0x10,%rsp
+    37dc:	eb 01                	jmp    37df <benchreport+0x142>
+    return;
+    37de:	90                   	nop
+}
+    37df:	c9                   	leave
+    37e0:	c3                   	ret
@@ -0,0 +1,5607 @@
+
+out/user/_lab2test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void racetest(void);
+void childpidtest(void);
+void exectest(void);
+
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, wpid;
+
+  if (open("console", O_RDWR) < 0) {
+       8:	be 02 00 00 00       	mov    $0x2,%esi
+       d:	48 8d 05 0c 3b 00 00 	lea    0x3b0c(%rip),%rax        # 3b20 <benchreport+0x146>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 fd 2f 00 00       	call   3019 <open>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	79 5c                	jns    7c <main+0x7c>
+    error("main: failed to open console file\n");
+      20:	8b 05 da 4f 00 00    	mov    0x4fda(%rip),%eax        # 5000 <stdout>
+      26:	ba 2a 00 00 00       	mov    $0x2a,%edx
+      2b:	48 8d 0d f6 3a 00 00 	lea    0x3af6(%rip),%rcx        # 3b28 <benchreport+0x14e>
+      32:	48 89 ce             	mov    %rcx,%rsi
+      35:	89 c7                	mov    %eax,%edi
+      37:	b8 00 00 00 00       	mov    $0x0,%eax
+      3c:	e8 cc 1e 00 00       	call   1f0d <printf>
+      41:	8b 05 b9 4f 00 00    	mov    0x4fb9(%rip),%eax        # 5000 <stdout>
+      47:	48 8d 15 f2 3a 00 00 	lea    0x3af2(%rip),%rdx        # 3b40 <benchreport+0x166>
+      4e:	48 89 d6             	mov    %rdx,%rsi
+      51:	89 c7                	mov    %eax,%edi
+      53:	b8 00 00 00 00       	mov    $0x0,%eax
+      58:	e8 b0 1e 00 00       	call   1f0d <printf>
+      5d:	8b 05 9d 4f 00 00    	mov    0x4f9d(%rip),%eax        # 5000 <stdout>
+      63:	48 8d 15 f9 3a 00 00 	lea    0x3af9(%rip),%rdx        # 3b63 <benchreport+0x189>
+      6a:	48 89 d6             	mov    %rdx,%rsi
+      6d:	89 c7                	mov    %eax,%edi
+      6f:	b8 00 00 00 00       	mov    $0x0,%eax
+      74:	e8 94 1e 00 00       	call   1f0d <printf>
+      79:	90                   	nop
+      7a:	eb fd                	jmp    79 <main+0x79>
+  }
+  dup(0); // stdout
+      7c:	bf 00 00 00 00       	mov    $0x0,%edi
+      81:	e8 e0 2f 00 00       	call   3066 <dup>
+  dup(0); // stderr
+      86:	bf 00 00 00 00       	mov    $0x0,%edi
+      8b:	e8 d6 2f 00 00       	call   3066 <dup>
+  pid = fork();
+      90:	e8 98 24 00 00       	call   252d <fork>
+      95:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (pid < 0) {
+      98:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      9c:	79 1e                	jns    bc <main+0xbc>
+    printf(1, "fork failed\n");
+      9e:	48 8d 05 c0 3a 00 00 	lea    0x3ac0(%rip),%rax        # 3b65 <benchreport+0x18b>
+      a5:	48 89 c6             	mov    %rax,%rsi
+      a8:	bf 01 00 00 00       	mov    $0x1,%edi
+      ad:	b8 00 00 00 00       	mov    $0x0,%eax
+      b2:	e8 56 1e 00 00       	call   1f0d <printf>
+    exit();
+      b7:	e8 81 24 00 00       	call   253d <exit>
+  }
+
+
+  if (pid == 0) {
+      bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      c0:	75 5d                	jne    11f <main+0x11f>
+    forktest();
+      c2:	e8 73 00 00 00       	call   13a <forktest>
+    racetest();
+      c7:	e8 03 0d 00 00       	call   dcf <racetest>
+    fdesctest();
+      cc:	e8 17 0e 00 00       	call   ee8 <fdesctest>
+    pipetest();
+      d1:	e8 19 02 00 00       	call   2ef <pipetest>
+    extendedpipetest();
+      d6:	e8 8c 05 00 00       	call   667 <extendedpipetest>
+    childpidtest();
+      db:	e8 3e 15 00 00       	call   161e <childpidtest>
+    exectest();
+      e0:	e8 7c 15 00 00       	call   1661 <exectest>
+    pkilltest();
+      e5:	e8 ed 0a 00 00       	call   bd7 <pkilltest>
+
+    printf(1, "lab2 tests passed!!\n");
+      ea:	48 8d 05 81 3a 00 00 	lea    0x3a81(%rip),%rax        # 3b72 <benchreport+0x198>
+      f1:	48 89 c6             	mov    %rax,%rsi
+      f4:	bf 01 00 00 00       	mov    $0x1,%edi
+      f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fe:	e8 0a 1e 00 00       	call   1f0d <printf>
+
+    while (1)
+     103:	90                   	nop
+     104:	eb fd                	jmp    103 <main+0x103>
+  }
+
+
+
+  while ((wpid = wait()) >= 0 && wpid != pid)
+    printf(1, "zombie!\n");
+     106:	48 8d 05 7a 3a 00 00 	lea    0x3a7a(%rip),%rax        # 3b87 <benchreport+0x1ad>
+     10d:	48 89 c6             	mov    %rax,%rsi
+     110:	bf 01 00 00 00       	mov    $0x1,%edi
+     115:	b8 00 00 00 00       	mov    $0x0,%eax
+     11a:	e8 ee 1d 00 00       	call   1f0d <printf>
+  while ((wpid = wait()) >= 0 && wpid != pid)
+     11f:	e8 a8 2e 00 00       	call   2fcc <wait>
+     124:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     127:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     12b:	78 08                	js     135 <main+0x135>
+     12d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     130:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+     133:	75 d1                	jne    106 <main+0x106>
+
+
+  exit();
+     135:	e8 03 24 00 00       	call   253d <exit>
+
+000000000000013a <forktest>:
+  return 0;
+}
+
+
+void forktest(void) {
+     13a:	55                   	push   %rbp
+     13b:	48 89 e5             	mov    %rsp,%rbp
+     13e:	48 83 ec 10          	sub    $0x10,%rsp
+  int n, pid;
+  int nproc = 6;
+     142:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+
+  printf(1, "forktest\n");
+     149:	48 8d 05 40 3a 00 00 	lea    0x3a40(%rip),%rax        # 3b90 <benchreport+0x1b6>
+     150:	48 89 c6             	mov    %rax,%rsi
+     153:	bf 01 00 00 00       	mov    $0x1,%edi
+     158:	b8 00 00 00 00       	mov    $0x0,%eax
+     15d:	e8 ab 1d 00 00       	call   1f0d <printf>
+
+  for (n = 0; n < nproc; n++) {
+     162:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     169:	eb 1d                	jmp    188 <forktest+0x4e>
+    pid = fork();
+     16b:	e8 bd 23 00 00       	call   252d <fork>
+     170:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (pid < 0)
+     173:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     177:	78 19                	js     192 <forktest+0x58>
+      break;
+    if (pid == 0) {
+     179:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     17d:	75 05                	jne    184 <forktest+0x4a>
+      exit();
+     17f:	e8 b9 23 00 00       	call   253d <exit>
+  for (n = 0; n < nproc; n++) {
+     184:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     188:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     18b:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     18e:	7c db                	jl     16b <forktest+0x31>
+     190:	eb 01                	jmp    193 <forktest+0x59>
+      break;
+     192:	90                   	nop
+      error("forktest: exit failed to destroy this process");
+    }
+  }
+
+
+  if (n != nproc) {
+     193:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     196:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     199:	0f 84 c8 00 00 00    	je     267 <forktest+0x12d>
+    error("forktest: fork claimed to work %d times! but only %d\n", nproc, n);
+     19f:	8b 05 5b 4e 00 00    	mov    0x4e5b(%rip),%eax        # 5000 <stdout>
+     1a5:	ba 63 00 00 00       	mov    $0x63,%edx
+     1aa:	48 8d 0d 77 39 00 00 	lea    0x3977(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     1b1:	48 89 ce             	mov    %rcx,%rsi
+     1b4:	89 c7                	mov    %eax,%edi
+     1b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1bb:	e8 4d 1d 00 00       	call   1f0d <printf>
+     1c0:	8b 05 3a 4e 00 00    	mov    0x4e3a(%rip),%eax        # 5000 <stdout>
+     1c6:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     1c9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     1cc:	48 8d 35 cd 39 00 00 	lea    0x39cd(%rip),%rsi        # 3ba0 <benchreport+0x1c6>
+     1d3:	89 c7                	mov    %eax,%edi
+     1d5:	b8 00 00 00 00       	mov    $0x0,%eax
+     1da:	e8 2e 1d 00 00       	call   1f0d <printf>
+     1df:	8b 05 1b 4e 00 00    	mov    0x4e1b(%rip),%eax        # 5000 <stdout>
+     1e5:	48 8d 15 77 39 00 00 	lea    0x3977(%rip),%rdx        # 3b63 <benchreport+0x189>
+     1ec:	48 89 d6             	mov    %rdx,%rsi
+     1ef:	89 c7                	mov    %eax,%edi
+     1f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f6:	e8 12 1d 00 00       	call   1f0d <printf>
+     1fb:	90                   	nop
+     1fc:	eb fd                	jmp    1fb <forktest+0xc1>
+  }
+
+  for (; n > 0; n--) {
+    if (wait() < 0) {
+     1fe:	e8 c9 2d 00 00       	call   2fcc <wait>
+     203:	85 c0                	test   %eax,%eax
+     205:	79 5c                	jns    263 <forktest+0x129>
+      error("forktest: wait stopped early\n");
+     207:	8b 05 f3 4d 00 00    	mov    0x4df3(%rip),%eax        # 5000 <stdout>
+     20d:	ba 68 00 00 00       	mov    $0x68,%edx
+     212:	48 8d 0d 0f 39 00 00 	lea    0x390f(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     219:	48 89 ce             	mov    %rcx,%rsi
+     21c:	89 c7                	mov    %eax,%edi
+     21e:	b8 00 00 00 00       	mov    $0x0,%eax
+     223:	e8 e5 1c 00 00       	call   1f0d <printf>
+     228:	8b 05 d2 4d 00 00    	mov    0x4dd2(%rip),%eax        # 5000 <stdout>
+     22e:	48 8d 15 a1 39 00 00 	lea    0x39a1(%rip),%rdx        # 3bd6 <benchreport+0x1fc>
+     235:	48 89 d6             	mov    %rdx,%rsi
+     238:	89 c7                	mov    %eax,%edi
+     23a:	b8 00 00 00 00       	mov    $0x0,%eax
+     23f:	e8 c9 1c 00 00       	call   1f0d <printf>
+     244:	8b 05 b6 4d 00 00    	mov    0x4db6(%rip),%eax        # 5000 <stdout>
+     24a:	48 8d 15 12 39 00 00 	lea    0x3912(%rip),%rdx        # 3b63 <benchreport+0x189>
+     251:	48 89 d6             	mov    %rdx,%rsi
+     254:	89 c7                	mov    %eax,%edi
+     256:	b8 00 00 00 00       	mov    $0x0,%eax
+     25b:	e8 ad 1c 00 00       	call   1f0d <printf>
+     260:	90                   	nop
+     261:	eb fd                	jmp    260 <forktest+0x126>
+  for (; n > 0; n--) {
+     263:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     267:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     26b:	7f 91                	jg     1fe <forktest+0xc4>
+    }
+  }
+
+  if (wait() != -1) {
+     26d:	e8 5a 2d 00 00       	call   2fcc <wait>
+     272:	83 f8 ff             	cmp    $0xffffffff,%eax
+     275:	74 5c                	je     2d3 <forktest+0x199>
+    error("forktest: wait got too many\n");
+     277:	8b 05 83 4d 00 00    	mov    0x4d83(%rip),%eax        # 5000 <stdout>
+     27d:	ba 6d 00 00 00       	mov    $0x6d,%edx
+     282:	48 8d 0d 9f 38 00 00 	lea    0x389f(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     289:	48 89 ce             	mov    %rcx,%rsi
+     28c:	89 c7                	mov    %eax,%edi
+     28e:	b8 00 00 00 00       	mov    $0x0,%eax
+     293:	e8 75 1c 00 00       	call   1f0d <printf>
+     298:	8b 05 62 4d 00 00    	mov    0x4d62(%rip),%eax        # 5000 <stdout>
+     29e:	48 8d 15 4f 39 00 00 	lea    0x394f(%rip),%rdx        # 3bf4 <benchreport+0x21a>
+     2a5:	48 89 d6             	mov    %rdx,%rsi
+     2a8:	89 c7                	mov    %eax,%edi
+     2aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     2af:	e8 59 1c 00 00       	call   1f0d <printf>
+     2b4:	8b 05 46 4d 00 00    	mov    0x4d46(%rip),%eax        # 5000 <stdout>
+     2ba:	48 8d 15 a2 38 00 00 	lea    0x38a2(%rip),%rdx        # 3b63 <benchreport+0x189>
+     2c1:	48 89 d6             	mov    %rdx,%rsi
+     2c4:	89 c7                	mov    %eax,%edi
+     2c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cb:	e8 3d 1c 00 00       	call   1f0d <printf>
+     2d0:	90                   	nop
+     2d1:	eb fd                	jmp    2d0 <forktest+0x196>
+  }
+
+  printf(1, "forktest: ok\n");
+     2d3:	48 8d 05 37 39 00 00 	lea    0x3937(%rip),%rax        # 3c11 <benchreport+0x237>
+     2da:	48 89 c6             	mov    %rax,%rsi
+     2dd:	bf 01 00 00 00       	mov    $0x1,%edi
+     2e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e7:	e8 21 1c 00 00       	call   1f0d <printf>
+}
+     2ec:	90                   	nop
+     2ed:	c9                   	leave
+     2ee:	c3                   	ret
+
+00000000000002ef <pipetest>:
+
+void pipetest(void) {
+     2ef:	55                   	push   %rbp
+     2f0:	48 89 e5             	mov    %rsp,%rbp
+     2f3:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  char buf[500];
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  printf(1, "pipetest\n");
+     2fa:	48 8d 05 1e 39 00 00 	lea    0x391e(%rip),%rax        # 3c1f <benchreport+0x245>
+     301:	48 89 c6             	mov    %rax,%rsi
+     304:	bf 01 00 00 00       	mov    $0x1,%edi
+     309:	b8 00 00 00 00       	mov    $0x0,%eax
+     30e:	e8 fa 1b 00 00       	call   1f0d <printf>
+
+  if (pipe(fds) != 0) {
+     313:	48 8d 85 ec fd ff ff 	lea    -0x214(%rbp),%rax
+     31a:	48 89 c7             	mov    %rax,%rdi
+     31d:	e8 b5 2c 00 00       	call   2fd7 <pipe>
+     322:	85 c0                	test   %eax,%eax
+     324:	74 5c                	je     382 <pipetest+0x93>
+    error("pipetest: pipe() failed\n");
+     326:	8b 05 d4 4c 00 00    	mov    0x4cd4(%rip),%eax        # 5000 <stdout>
+     32c:	ba 7b 00 00 00       	mov    $0x7b,%edx
+     331:	48 8d 0d f0 37 00 00 	lea    0x37f0(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     338:	48 89 ce             	mov    %rcx,%rsi
+     33b:	89 c7                	mov    %eax,%edi
+     33d:	b8 00 00 00 00       	mov    $0x0,%eax
+     342:	e8 c6 1b 00 00       	call   1f0d <printf>
+     347:	8b 05 b3 4c 00 00    	mov    0x4cb3(%rip),%eax        # 5000 <stdout>
+     34d:	48 8d 15 d5 38 00 00 	lea    0x38d5(%rip),%rdx        # 3c29 <benchreport+0x24f>
+     354:	48 89 d6             	mov    %rdx,%rsi
+     357:	89 c7                	mov    %eax,%edi
+     359:	b8 00 00 00 00       	mov    $0x0,%eax
+     35e:	e8 aa 1b 00 00       	call   1f0d <printf>
+     363:	8b 05 97 4c 00 00    	mov    0x4c97(%rip),%eax        # 5000 <stdout>
+     369:	48 8d 15 f3 37 00 00 	lea    0x37f3(%rip),%rdx        # 3b63 <benchreport+0x189>
+     370:	48 89 d6             	mov    %rdx,%rsi
+     373:	89 c7                	mov    %eax,%edi
+     375:	b8 00 00 00 00       	mov    $0x0,%eax
+     37a:	e8 8e 1b 00 00       	call   1f0d <printf>
+     37f:	90                   	nop
+     380:	eb fd                	jmp    37f <pipetest+0x90>
+  }
+  pid = fork();
+     382:	e8 a6 21 00 00       	call   252d <fork>
+     387:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  seq = 0;
+     38a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (pid == 0) {
+     391:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     395:	0f 85 d3 00 00 00    	jne    46e <pipetest+0x17f>
+    close(fds[0]); // 1
+     39b:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     3a1:	89 c7                	mov    %eax,%edi
+     3a3:	e8 ff 21 00 00       	call   25a7 <close>
+    for (n = 0; n < 5; n++) {
+     3a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     3af:	e9 ab 00 00 00       	jmp    45f <pipetest+0x170>
+      for (i = 0; i < 95; i++)
+     3b4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     3bb:	eb 1b                	jmp    3d8 <pipetest+0xe9>
+        buf[i] = seq++;
+     3bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3c0:	8d 50 01             	lea    0x1(%rax),%edx
+     3c3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3c6:	89 c2                	mov    %eax,%edx
+     3c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3cb:	48 98                	cltq
+     3cd:	88 94 05 f4 fd ff ff 	mov    %dl,-0x20c(%rbp,%rax,1)
+      for (i = 0; i < 95; i++)
+     3d4:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     3d8:	83 7d f8 5e          	cmpl   $0x5e,-0x8(%rbp)
+     3dc:	7e df                	jle    3bd <pipetest+0xce>
+      if (write(fds[1], buf, 95) != 95) {
+     3de:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     3e4:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     3eb:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     3f0:	48 89 ce             	mov    %rcx,%rsi
+     3f3:	89 c7                	mov    %eax,%edi
+     3f5:	e8 f3 2b 00 00       	call   2fed <write>
+     3fa:	83 f8 5f             	cmp    $0x5f,%eax
+     3fd:	74 5c                	je     45b <pipetest+0x16c>
+        error("pipetest: oops 1\n");
+     3ff:	8b 05 fb 4b 00 00    	mov    0x4bfb(%rip),%eax        # 5000 <stdout>
+     405:	ba 85 00 00 00       	mov    $0x85,%edx
+     40a:	48 8d 0d 17 37 00 00 	lea    0x3717(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     411:	48 89 ce             	mov    %rcx,%rsi
+     414:	89 c7                	mov    %eax,%edi
+     416:	b8 00 00 00 00       	mov    $0x0,%eax
+     41b:	e8 ed 1a 00 00       	call   1f0d <printf>
+     420:	8b 05 da 4b 00 00    	mov    0x4bda(%rip),%eax        # 5000 <stdout>
+     426:	48 8d 15 15 38 00 00 	lea    0x3815(%rip),%rdx        # 3c42 <benchreport+0x268>
+     42d:	48 89 d6             	mov    %rdx,%rsi
+     430:	89 c7                	mov    %eax,%edi
+     432:	b8 00 00 00 00       	mov    $0x0,%eax
+     437:	e8 d1 1a 00 00       	call   1f0d <printf>
+     43c:	8b 05 be 4b 00 00    	mov    0x4bbe(%rip),%eax        # 5000 <stdout>
+     442:	48 8d 15 1a 37 00 00 	lea    0x371a(%rip),%rdx        # 3b63 <benchreport+0x189>
+     449:	48 89 d6             	mov    %rdx,%rsi
+     44c:	89 c7                	mov    %eax,%edi
+     44e:	b8 00 00 00 00       	mov    $0x0,%eax
+     453:	e8 b5 1a 00 00       	call   1f0d <printf>
+     458:	90                   	nop
+     459:	eb fd                	jmp    458 <pipetest+0x169>
+    for (n = 0; n < 5; n++) {
+     45b:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     45f:	83 7d f4 04          	cmpl   $0x4,-0xc(%rbp)
+     463:	0f 8e 4b ff ff ff    	jle    3b4 <pipetest+0xc5>
+      }
+    }
+    exit();
+     469:	e8 cf 20 00 00       	call   253d <exit>
+  } else if (pid > 0) {
+     46e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     472:	0f 8e 77 01 00 00    	jle    5ef <pipetest+0x300>
+    close(fds[1]);
+     478:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     47e:	89 c7                	mov    %eax,%edi
+     480:	e8 22 21 00 00       	call   25a7 <close>
+    total = 0;
+     485:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    cc = 1;
+     48c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%rbp)
+    while ((n = read(fds[0], buf, cc)) > 0) {
+     493:	e9 b4 00 00 00       	jmp    54c <pipetest+0x25d>
+      for (i = 0; i < n; i++) {
+     498:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     49f:	e9 82 00 00 00       	jmp    526 <pipetest+0x237>
+        if ((buf[i] & 0xff) != (seq++ & 0xff)) {
+     4a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4a7:	48 98                	cltq
+     4a9:	0f b6 84 05 f4 fd ff 	movzbl -0x20c(%rbp,%rax,1),%eax
+     4b0:	ff 
+     4b1:	0f be c8             	movsbl %al,%ecx
+     4b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4b7:	8d 50 01             	lea    0x1(%rax),%edx
+     4ba:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4bd:	31 c8                	xor    %ecx,%eax
+     4bf:	0f b6 c0             	movzbl %al,%eax
+     4c2:	85 c0                	test   %eax,%eax
+     4c4:	74 5c                	je     522 <pipetest+0x233>
+          error("pipetest: oops 2\n");
+     4c6:	8b 05 34 4b 00 00    	mov    0x4b34(%rip),%eax        # 5000 <stdout>
+     4cc:	ba 90 00 00 00       	mov    $0x90,%edx
+     4d1:	48 8d 0d 50 36 00 00 	lea    0x3650(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     4d8:	48 89 ce             	mov    %rcx,%rsi
+     4db:	89 c7                	mov    %eax,%edi
+     4dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e2:	e8 26 1a 00 00       	call   1f0d <printf>
+     4e7:	8b 05 13 4b 00 00    	mov    0x4b13(%rip),%eax        # 5000 <stdout>
+     4ed:	48 8d 15 60 37 00 00 	lea    0x3760(%rip),%rdx        # 3c54 <benchreport+0x27a>
+     4f4:	48 89 d6             	mov    %rdx,%rsi
+     4f7:	89 c7                	mov    %eax,%edi
+     4f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     4fe:	e8 0a 1a 00 00       	call   1f0d <printf>
+     503:	8b 05 f7 4a 00 00    	mov    0x4af7(%rip),%eax        # 5000 <stdout>
+     509:	48 8d 15 53 36 00 00 	lea    0x3653(%rip),%rdx        # 3b63 <benchreport+0x189>
+     510:	48 89 d6             	mov    %rdx,%rsi
+     513:	89 c7                	mov    %eax,%edi
+     515:	b8 00 00 00 00       	mov    $0x0,%eax
+     51a:	e8 ee 19 00 00       	call   1f0d <printf>
+     51f:	90                   	nop
+     520:	eb fd                	jmp    51f <pipetest+0x230>
+      for (i = 0; i < n; i++) {
+     522:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     526:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     529:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+     52c:	0f 8c 72 ff ff ff    	jl     4a4 <pipetest+0x1b5>
+        }
+      }
+      total += n;
+     532:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     535:	01 45 ec             	add    %eax,-0x14(%rbp)
+      cc = cc * 2;
+     538:	d1 65 f0             	shll   -0x10(%rbp)
+      if (cc > sizeof(buf))
+     53b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     53e:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     543:	76 07                	jbe    54c <pipetest+0x25d>
+        cc = sizeof(buf);
+     545:	c7 45 f0 f4 01 00 00 	movl   $0x1f4,-0x10(%rbp)
+    while ((n = read(fds[0], buf, cc)) > 0) {
+     54c:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     552:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     555:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     55c:	48 89 ce             	mov    %rcx,%rsi
+     55f:	89 c7                	mov    %eax,%edi
+     561:	e8 7c 2a 00 00       	call   2fe2 <read>
+     566:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     569:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     56d:	0f 8f 25 ff ff ff    	jg     498 <pipetest+0x1a9>
+    }
+    if (total != 5 * 95) {
+     573:	81 7d ec db 01 00 00 	cmpl   $0x1db,-0x14(%rbp)
+     57a:	74 5f                	je     5db <pipetest+0x2ec>
+      error("pipetest: oops 3 total %d\n", total);
+     57c:	8b 05 7e 4a 00 00    	mov    0x4a7e(%rip),%eax        # 5000 <stdout>
+     582:	ba 99 00 00 00       	mov    $0x99,%edx
+     587:	48 8d 0d 9a 35 00 00 	lea    0x359a(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     58e:	48 89 ce             	mov    %rcx,%rsi
+     591:	89 c7                	mov    %eax,%edi
+     593:	b8 00 00 00 00       	mov    $0x0,%eax
+     598:	e8 70 19 00 00       	call   1f0d <printf>
+     59d:	8b 05 5d 4a 00 00    	mov    0x4a5d(%rip),%eax        # 5000 <stdout>
+     5a3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     5a6:	48 8d 0d b9 36 00 00 	lea    0x36b9(%rip),%rcx        # 3c66 <benchreport+0x28c>
+     5ad:	48 89 ce             	mov    %rcx,%rsi
+     5b0:	89 c7                	mov    %eax,%edi
+     5b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     5b7:	e8 51 19 00 00       	call   1f0d <printf>
+     5bc:	8b 05 3e 4a 00 00    	mov    0x4a3e(%rip),%eax        # 5000 <stdout>
+     5c2:	48 8d 15 9a 35 00 00 	lea    0x359a(%rip),%rdx        # 3b63 <benchreport+0x189>
+     5c9:	48 89 d6             	mov    %rdx,%rsi
+     5cc:	89 c7                	mov    %eax,%edi
+     5ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     5d3:	e8 35 19 00 00       	call   1f0d <printf>
+     5d8:	90                   	nop
+     5d9:	eb fd                	jmp    5d8 <pipetest+0x2e9>
+    }
+    close(fds[0]);
+     5db:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     5e1:	89 c7                	mov    %eax,%edi
+     5e3:	e8 bf 1f 00 00       	call   25a7 <close>
+    wait();
+     5e8:	e8 df 29 00 00       	call   2fcc <wait>
+     5ed:	eb 5c                	jmp    64b <pipetest+0x35c>
+  } else {
+    error("pipetest: fork() failed\n");
+     5ef:	8b 05 0b 4a 00 00    	mov    0x4a0b(%rip),%eax        # 5000 <stdout>
+     5f5:	ba 9e 00 00 00       	mov    $0x9e,%edx
+     5fa:	48 8d 0d 27 35 00 00 	lea    0x3527(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     601:	48 89 ce             	mov    %rcx,%rsi
+     604:	89 c7                	mov    %eax,%edi
+     606:	b8 00 00 00 00       	mov    $0x0,%eax
+     60b:	e8 fd 18 00 00       	call   1f0d <printf>
+     610:	8b 05 ea 49 00 00    	mov    0x49ea(%rip),%eax        # 5000 <stdout>
+     616:	48 8d 15 64 36 00 00 	lea    0x3664(%rip),%rdx        # 3c81 <benchreport+0x2a7>
+     61d:	48 89 d6             	mov    %rdx,%rsi
+     620:	89 c7                	mov    %eax,%edi
+     622:	b8 00 00 00 00       	mov    $0x0,%eax
+     627:	e8 e1 18 00 00       	call   1f0d <printf>
+     62c:	8b 05 ce 49 00 00    	mov    0x49ce(%rip),%eax        # 5000 <stdout>
+     632:	48 8d 15 2a 35 00 00 	lea    0x352a(%rip),%rdx        # 3b63 <benchreport+0x189>
+     639:	48 89 d6             	mov    %rdx,%rsi
+     63c:	89 c7                	mov    %eax,%edi
+     63e:	b8 00 00 00 00       	mov    $0x0,%eax
+     643:	e8 c5 18 00 00       	call   1f0d <printf>
+     648:	90                   	nop
+     649:	eb fd                	jmp    648 <pipetest+0x359>
+  }
+  printf(1, "pipetest: ok\n");
+     64b:	48 8d 05 48 36 00 00 	lea    0x3648(%rip),%rax        # 3c9a <benchreport+0x2c0>
+     652:	48 89 c6             	mov    %rax,%rsi
+     655:	bf 01 00 00 00       	mov    $0x1,%edi
+     65a:	b8 00 00 00 00       	mov    $0x0,%eax
+     65f:	e8 a9 18 00 00       	call   1f0d <printf>
+}
+     664:	90                   	nop
+     665:	c9                   	leave
+     666:	c3                   	ret
+
+0000000000000667 <extendedpipetest>:
+
+void extendedpipetest(void) {
+     667:	55                   	push   %rbp
+     668:	48 89 e5             	mov    %rsp,%rbp
+     66b:	48 83 ec 30          	sub    $0x30,%rsp
+  // read return remaining bytes when write-end is closed,
+  // then return 0 at EOF
+  int pid;
+  int fds[2];
+  char *buf = "pipetestwrite";
+     66f:	48 8d 05 32 36 00 00 	lea    0x3632(%rip),%rax        # 3ca8 <benchreport+0x2ce>
+     676:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  printf(1, "extendedpipetest\n");
+     67a:	48 8d 05 35 36 00 00 	lea    0x3635(%rip),%rax        # 3cb6 <benchreport+0x2dc>
+     681:	48 89 c6             	mov    %rax,%rsi
+     684:	bf 01 00 00 00       	mov    $0x1,%edi
+     689:	b8 00 00 00 00       	mov    $0x0,%eax
+     68e:	e8 7a 18 00 00       	call   1f0d <printf>
+  if (pipe(fds) != 0) {
+     693:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     697:	48 89 c7             	mov    %rax,%rdi
+     69a:	e8 38 29 00 00       	call   2fd7 <pipe>
+     69f:	85 c0                	test   %eax,%eax
+     6a1:	74 5c                	je     6ff <extendedpipetest+0x98>
+    error("extended pipe test: pipe() failed\n");
+     6a3:	8b 05 57 49 00 00    	mov    0x4957(%rip),%eax        # 5000 <stdout>
+     6a9:	ba ac 00 00 00       	mov    $0xac,%edx
+     6ae:	48 8d 0d 73 34 00 00 	lea    0x3473(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     6b5:	48 89 ce             	mov    %rcx,%rsi
+     6b8:	89 c7                	mov    %eax,%edi
+     6ba:	b8 00 00 00 00       	mov    $0x0,%eax
+     6bf:	e8 49 18 00 00       	call   1f0d <printf>
+     6c4:	8b 05 36 49 00 00    	mov    0x4936(%rip),%eax        # 5000 <stdout>
+     6ca:	48 8d 15 f7 35 00 00 	lea    0x35f7(%rip),%rdx        # 3cc8 <benchreport+0x2ee>
+     6d1:	48 89 d6             	mov    %rdx,%rsi
+     6d4:	89 c7                	mov    %eax,%edi
+     6d6:	b8 00 00 00 00       	mov    $0x0,%eax
+     6db:	e8 2d 18 00 00       	call   1f0d <printf>
+     6e0:	8b 05 1a 49 00 00    	mov    0x491a(%rip),%eax        # 5000 <stdout>
+     6e6:	48 8d 15 76 34 00 00 	lea    0x3476(%rip),%rdx        # 3b63 <benchreport+0x189>
+     6ed:	48 89 d6             	mov    %rdx,%rsi
+     6f0:	89 c7                	mov    %eax,%edi
+     6f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f7:	e8 11 18 00 00       	call   1f0d <printf>
+     6fc:	90                   	nop
+     6fd:	eb fd                	jmp    6fc <extendedpipetest+0x95>
+  }
+  pid = fork();
+     6ff:	e8 29 1e 00 00       	call   252d <fork>
+     704:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (pid == 0) {
+     707:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     70b:	0f 85 86 00 00 00    	jne    797 <extendedpipetest+0x130>
+    sleep(100);
+     711:	bf 64 00 00 00       	mov    $0x64,%edi
+     716:	e8 6c 29 00 00       	call   3087 <sleep>
+    if (write(fds[1], buf, 14) != 14) {
+     71b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     71e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     722:	ba 0e 00 00 00       	mov    $0xe,%edx
+     727:	48 89 ce             	mov    %rcx,%rsi
+     72a:	89 c7                	mov    %eax,%edi
+     72c:	e8 bc 28 00 00       	call   2fed <write>
+     731:	83 f8 0e             	cmp    $0xe,%eax
+     734:	74 5c                	je     792 <extendedpipetest+0x12b>
+      error("extended pipe test: oops 1\n");
+     736:	8b 05 c4 48 00 00    	mov    0x48c4(%rip),%eax        # 5000 <stdout>
+     73c:	ba b2 00 00 00       	mov    $0xb2,%edx
+     741:	48 8d 0d e0 33 00 00 	lea    0x33e0(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     748:	48 89 ce             	mov    %rcx,%rsi
+     74b:	89 c7                	mov    %eax,%edi
+     74d:	b8 00 00 00 00       	mov    $0x0,%eax
+     752:	e8 b6 17 00 00       	call   1f0d <printf>
+     757:	8b 05 a3 48 00 00    	mov    0x48a3(%rip),%eax        # 5000 <stdout>
+     75d:	48 8d 15 87 35 00 00 	lea    0x3587(%rip),%rdx        # 3ceb <benchreport+0x311>
+     764:	48 89 d6             	mov    %rdx,%rsi
+     767:	89 c7                	mov    %eax,%edi
+     769:	b8 00 00 00 00       	mov    $0x0,%eax
+     76e:	e8 9a 17 00 00       	call   1f0d <printf>
+     773:	8b 05 87 48 00 00    	mov    0x4887(%rip),%eax        # 5000 <stdout>
+     779:	48 8d 15 e3 33 00 00 	lea    0x33e3(%rip),%rdx        # 3b63 <benchreport+0x189>
+     780:	48 89 d6             	mov    %rdx,%rsi
+     783:	89 c7                	mov    %eax,%edi
+     785:	b8 00 00 00 00       	mov    $0x0,%eax
+     78a:	e8 7e 17 00 00       	call   1f0d <printf>
+     78f:	90                   	nop
+     790:	eb fd                	jmp    78f <extendedpipetest+0x128>
+    }
+    exit();
+     792:	e8 a6 1d 00 00       	call   253d <exit>
+  } else if (pid > 0) {
+     797:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     79b:	0f 8e 5d 02 00 00    	jle    9fe <extendedpipetest+0x397>
+    close(fds[1]);
+     7a1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     7a4:	89 c7                	mov    %eax,%edi
+     7a6:	e8 fc 1d 00 00       	call   25a7 <close>
+    if (wait() != pid) {
+     7ab:	e8 1c 28 00 00       	call   2fcc <wait>
+     7b0:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     7b3:	74 5c                	je     811 <extendedpipetest+0x1aa>
+      error("extended pipe test: wait() failed\n");
+     7b5:	8b 05 45 48 00 00    	mov    0x4845(%rip),%eax        # 5000 <stdout>
+     7bb:	ba b8 00 00 00       	mov    $0xb8,%edx
+     7c0:	48 8d 0d 61 33 00 00 	lea    0x3361(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     7c7:	48 89 ce             	mov    %rcx,%rsi
+     7ca:	89 c7                	mov    %eax,%edi
+     7cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d1:	e8 37 17 00 00       	call   1f0d <printf>
+     7d6:	8b 05 24 48 00 00    	mov    0x4824(%rip),%eax        # 5000 <stdout>
+     7dc:	48 8d 15 25 35 00 00 	lea    0x3525(%rip),%rdx        # 3d08 <benchreport+0x32e>
+     7e3:	48 89 d6             	mov    %rdx,%rsi
+     7e6:	89 c7                	mov    %eax,%edi
+     7e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ed:	e8 1b 17 00 00       	call   1f0d <printf>
+     7f2:	8b 05 08 48 00 00    	mov    0x4808(%rip),%eax        # 5000 <stdout>
+     7f8:	48 8d 15 64 33 00 00 	lea    0x3364(%rip),%rdx        # 3b63 <benchreport+0x189>
+     7ff:	48 89 d6             	mov    %rdx,%rsi
+     802:	89 c7                	mov    %eax,%edi
+     804:	b8 00 00 00 00       	mov    $0x0,%eax
+     809:	e8 ff 16 00 00       	call   1f0d <printf>
+     80e:	90                   	nop
+     80f:	eb fd                	jmp    80e <extendedpipetest+0x1a7>
+    }
+
+    int bytes_to_read = 14;
+     811:	c7 45 fc 0e 00 00 00 	movl   $0xe,-0x4(%rbp)
+    int n = 0;
+     818:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    char buf2[14];
+    while(bytes_to_read > 0) {
+     81f:	e9 8e 00 00 00       	jmp    8b2 <extendedpipetest+0x24b>
+      int retval = read(fds[0], buf2 + n, bytes_to_read);
+     824:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     827:	48 98                	cltq
+     829:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     82d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     831:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     834:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     837:	48 89 ce             	mov    %rcx,%rsi
+     83a:	89 c7                	mov    %eax,%edi
+     83c:	e8 a1 27 00 00       	call   2fe2 <read>
+     841:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      if (retval <= 0) {
+     844:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     848:	7f 5c                	jg     8a6 <extendedpipetest+0x23f>
+        error("extended pipe test: read() failed\n");
+     84a:	8b 05 b0 47 00 00    	mov    0x47b0(%rip),%eax        # 5000 <stdout>
+     850:	ba c1 00 00 00       	mov    $0xc1,%edx
+     855:	48 8d 0d cc 32 00 00 	lea    0x32cc(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     85c:	48 89 ce             	mov    %rcx,%rsi
+     85f:	89 c7                	mov    %eax,%edi
+     861:	b8 00 00 00 00       	mov    $0x0,%eax
+     866:	e8 a2 16 00 00       	call   1f0d <printf>
+     86b:	8b 05 8f 47 00 00    	mov    0x478f(%rip),%eax        # 5000 <stdout>
+     871:	48 8d 15 b8 34 00 00 	lea    0x34b8(%rip),%rdx        # 3d30 <benchreport+0x356>
+     878:	48 89 d6             	mov    %rdx,%rsi
+     87b:	89 c7                	mov    %eax,%edi
+     87d:	b8 00 00 00 00       	mov    $0x0,%eax
+     882:	e8 86 16 00 00       	call   1f0d <printf>
+     887:	8b 05 73 47 00 00    	mov    0x4773(%rip),%eax        # 5000 <stdout>
+     88d:	48 8d 15 cf 32 00 00 	lea    0x32cf(%rip),%rdx        # 3b63 <benchreport+0x189>
+     894:	48 89 d6             	mov    %rdx,%rsi
+     897:	89 c7                	mov    %eax,%edi
+     899:	b8 00 00 00 00       	mov    $0x0,%eax
+     89e:	e8 6a 16 00 00       	call   1f0d <printf>
+     8a3:	90                   	nop
+     8a4:	eb fd                	jmp    8a3 <extendedpipetest+0x23c>
+      }
+      n += retval;
+     8a6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     8a9:	01 45 f8             	add    %eax,-0x8(%rbp)
+      bytes_to_read -= retval;
+     8ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     8af:	29 45 fc             	sub    %eax,-0x4(%rbp)
+    while(bytes_to_read > 0) {
+     8b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8b6:	0f 8f 68 ff ff ff    	jg     824 <extendedpipetest+0x1bd>
+    }
+
+    if (read(fds[0], buf, 1) != 0) {
+     8bc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     8bf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8c3:	ba 01 00 00 00       	mov    $0x1,%edx
+     8c8:	48 89 ce             	mov    %rcx,%rsi
+     8cb:	89 c7                	mov    %eax,%edi
+     8cd:	e8 10 27 00 00       	call   2fe2 <read>
+     8d2:	85 c0                	test   %eax,%eax
+     8d4:	74 5c                	je     932 <extendedpipetest+0x2cb>
+      error("pipe tet: read() returns non-zero at EOF\n");
+     8d6:	8b 05 24 47 00 00    	mov    0x4724(%rip),%eax        # 5000 <stdout>
+     8dc:	ba c8 00 00 00       	mov    $0xc8,%edx
+     8e1:	48 8d 0d 40 32 00 00 	lea    0x3240(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     8e8:	48 89 ce             	mov    %rcx,%rsi
+     8eb:	89 c7                	mov    %eax,%edi
+     8ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f2:	e8 16 16 00 00       	call   1f0d <printf>
+     8f7:	8b 05 03 47 00 00    	mov    0x4703(%rip),%eax        # 5000 <stdout>
+     8fd:	48 8d 15 54 34 00 00 	lea    0x3454(%rip),%rdx        # 3d58 <benchreport+0x37e>
+     904:	48 89 d6             	mov    %rdx,%rsi
+     907:	89 c7                	mov    %eax,%edi
+     909:	b8 00 00 00 00       	mov    $0x0,%eax
+     90e:	e8 fa 15 00 00       	call   1f0d <printf>
+     913:	8b 05 e7 46 00 00    	mov    0x46e7(%rip),%eax        # 5000 <stdout>
+     919:	48 8d 15 43 32 00 00 	lea    0x3243(%rip),%rdx        # 3b63 <benchreport+0x189>
+     920:	48 89 d6             	mov    %rdx,%rsi
+     923:	89 c7                	mov    %eax,%edi
+     925:	b8 00 00 00 00       	mov    $0x0,%eax
+     92a:	e8 de 15 00 00       	call   1f0d <printf>
+     92f:	90                   	nop
+     930:	eb fd                	jmp    92f <extendedpipetest+0x2c8>
+    }
+
+    if (strcmp(buf, buf2) != 0) {
+     932:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     936:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     93a:	48 89 d6             	mov    %rdx,%rsi
+     93d:	48 89 c7             	mov    %rax,%rdi
+     940:	e8 fb 1e 00 00       	call   2840 <strcmp>
+     945:	85 c0                	test   %eax,%eax
+     947:	0f 84 91 00 00 00    	je     9de <extendedpipetest+0x377>
+      printf(stdout, "extended pipe test: bad output:\n");
+     94d:	8b 05 ad 46 00 00    	mov    0x46ad(%rip),%eax        # 5000 <stdout>
+     953:	48 8d 15 2e 34 00 00 	lea    0x342e(%rip),%rdx        # 3d88 <benchreport+0x3ae>
+     95a:	48 89 d6             	mov    %rdx,%rsi
+     95d:	89 c7                	mov    %eax,%edi
+     95f:	b8 00 00 00 00       	mov    $0x0,%eax
+     964:	e8 a4 15 00 00       	call   1f0d <printf>
+      printf(stdout, buf2);
+     969:	8b 05 91 46 00 00    	mov    0x4691(%rip),%eax        # 5000 <stdout>
+     96f:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+     973:	48 89 d6             	mov    %rdx,%rsi
+     976:	89 c7                	mov    %eax,%edi
+     978:	b8 00 00 00 00       	mov    $0x0,%eax
+     97d:	e8 8b 15 00 00       	call   1f0d <printf>
+      error("extended pipe test: output test failed");
+     982:	8b 05 78 46 00 00    	mov    0x4678(%rip),%eax        # 5000 <stdout>
+     988:	ba ce 00 00 00       	mov    $0xce,%edx
+     98d:	48 8d 0d 94 31 00 00 	lea    0x3194(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     994:	48 89 ce             	mov    %rcx,%rsi
+     997:	89 c7                	mov    %eax,%edi
+     999:	b8 00 00 00 00       	mov    $0x0,%eax
+     99e:	e8 6a 15 00 00       	call   1f0d <printf>
+     9a3:	8b 05 57 46 00 00    	mov    0x4657(%rip),%eax        # 5000 <stdout>
+     9a9:	48 8d 15 00 34 00 00 	lea    0x3400(%rip),%rdx        # 3db0 <benchreport+0x3d6>
+     9b0:	48 89 d6             	mov    %rdx,%rsi
+     9b3:	89 c7                	mov    %eax,%edi
+     9b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ba:	e8 4e 15 00 00       	call   1f0d <printf>
+     9bf:	8b 05 3b 46 00 00    	mov    0x463b(%rip),%eax        # 5000 <stdout>
+     9c5:	48 8d 15 97 31 00 00 	lea    0x3197(%rip),%rdx        # 3b63 <benchreport+0x189>
+     9cc:	48 89 d6             	mov    %rdx,%rsi
+     9cf:	89 c7                	mov    %eax,%edi
+     9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d6:	e8 32 15 00 00       	call   1f0d <printf>
+     9db:	90                   	nop
+     9dc:	eb fd                	jmp    9db <extendedpipetest+0x374>
+    }
+    close(fds[0]);
+     9de:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     9e1:	89 c7                	mov    %eax,%edi
+     9e3:	e8 bf 1b 00 00       	call   25a7 <close>
+  } else {
+    error("extended pipe test: fork() failed\n");
+  }
+
+  // write return -1 when read-end is closed
+  if (pipe(fds) != 0) {
+     9e8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     9ec:	48 89 c7             	mov    %rax,%rdi
+     9ef:	e8 e3 25 00 00       	call   2fd7 <pipe>
+     9f4:	85 c0                	test   %eax,%eax
+     9f6:	0f 84 ba 00 00 00    	je     ab6 <extendedpipetest+0x44f>
+     9fc:	eb 5c                	jmp    a5a <extendedpipetest+0x3f3>
+    error("extended pipe test: fork() failed\n");
+     9fe:	8b 05 fc 45 00 00    	mov    0x45fc(%rip),%eax        # 5000 <stdout>
+     a04:	ba d2 00 00 00       	mov    $0xd2,%edx
+     a09:	48 8d 0d 18 31 00 00 	lea    0x3118(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     a10:	48 89 ce             	mov    %rcx,%rsi
+     a13:	89 c7                	mov    %eax,%edi
+     a15:	b8 00 00 00 00       	mov    $0x0,%eax
+     a1a:	e8 ee 14 00 00       	call   1f0d <printf>
+     a1f:	8b 05 db 45 00 00    	mov    0x45db(%rip),%eax        # 5000 <stdout>
+     a25:	48 8d 15 ac 33 00 00 	lea    0x33ac(%rip),%rdx        # 3dd8 <benchreport+0x3fe>
+     a2c:	48 89 d6             	mov    %rdx,%rsi
+     a2f:	89 c7                	mov    %eax,%edi
+     a31:	b8 00 00 00 00       	mov    $0x0,%eax
+     a36:	e8 d2 14 00 00       	call   1f0d <printf>
+     a3b:	8b 05 bf 45 00 00    	mov    0x45bf(%rip),%eax        # 5000 <stdout>
+     a41:	48 8d 15 1b 31 00 00 	lea    0x311b(%rip),%rdx        # 3b63 <benchreport+0x189>
+     a48:	48 89 d6             	mov    %rdx,%rsi
+     a4b:	89 c7                	mov    %eax,%edi
+     a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a52:	e8 b6 14 00 00       	call   1f0d <printf>
+     a57:	90                   	nop
+     a58:	eb fd                	jmp    a57 <extendedpipetest+0x3f0>
+    error("extended pipe test: pipe() failed\n");
+     a5a:	8b 05 a0 45 00 00    	mov    0x45a0(%rip),%eax        # 5000 <stdout>
+     a60:	ba d7 00 00 00       	mov    $0xd7,%edx
+     a65:	48 8d 0d bc 30 00 00 	lea    0x30bc(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     a6c:	48 89 ce             	mov    %rcx,%rsi
+     a6f:	89 c7                	mov    %eax,%edi
+     a71:	b8 00 00 00 00       	mov    $0x0,%eax
+     a76:	e8 92 14 00 00       	call   1f0d <printf>
+     a7b:	8b 05 7f 45 00 00    	mov    0x457f(%rip),%eax        # 5000 <stdout>
+     a81:	48 8d 15 40 32 00 00 	lea    0x3240(%rip),%rdx        # 3cc8 <benchreport+0x2ee>
+     a88:	48 89 d6             	mov    %rdx,%rsi
+     a8b:	89 c7                	mov    %eax,%edi
+     a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a92:	e8 76 14 00 00       	call   1f0d <printf>
+     a97:	8b 05 63 45 00 00    	mov    0x4563(%rip),%eax        # 5000 <stdout>
+     a9d:	48 8d 15 bf 30 00 00 	lea    0x30bf(%rip),%rdx        # 3b63 <benchreport+0x189>
+     aa4:	48 89 d6             	mov    %rdx,%rsi
+     aa7:	89 c7                	mov    %eax,%edi
+     aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+     aae:	e8 5a 14 00 00       	call   1f0d <printf>
+     ab3:	90                   	nop
+     ab4:	eb fd                	jmp    ab3 <extendedpipetest+0x44c>
+  }
+  if (write(fds[1], buf, 14) != 14) {
+     ab6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ab9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     abd:	ba 0e 00 00 00       	mov    $0xe,%edx
+     ac2:	48 89 ce             	mov    %rcx,%rsi
+     ac5:	89 c7                	mov    %eax,%edi
+     ac7:	e8 21 25 00 00       	call   2fed <write>
+     acc:	83 f8 0e             	cmp    $0xe,%eax
+     acf:	74 5c                	je     b2d <extendedpipetest+0x4c6>
+      error("extended pipe test: oops 1\n");
+     ad1:	8b 05 29 45 00 00    	mov    0x4529(%rip),%eax        # 5000 <stdout>
+     ad7:	ba da 00 00 00       	mov    $0xda,%edx
+     adc:	48 8d 0d 45 30 00 00 	lea    0x3045(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     ae3:	48 89 ce             	mov    %rcx,%rsi
+     ae6:	89 c7                	mov    %eax,%edi
+     ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+     aed:	e8 1b 14 00 00       	call   1f0d <printf>
+     af2:	8b 05 08 45 00 00    	mov    0x4508(%rip),%eax        # 5000 <stdout>
+     af8:	48 8d 15 ec 31 00 00 	lea    0x31ec(%rip),%rdx        # 3ceb <benchreport+0x311>
+     aff:	48 89 d6             	mov    %rdx,%rsi
+     b02:	89 c7                	mov    %eax,%edi
+     b04:	b8 00 00 00 00       	mov    $0x0,%eax
+     b09:	e8 ff 13 00 00       	call   1f0d <printf>
+     b0e:	8b 05 ec 44 00 00    	mov    0x44ec(%rip),%eax        # 5000 <stdout>
+     b14:	48 8d 15 48 30 00 00 	lea    0x3048(%rip),%rdx        # 3b63 <benchreport+0x189>
+     b1b:	48 89 d6             	mov    %rdx,%rsi
+     b1e:	89 c7                	mov    %eax,%edi
+     b20:	b8 00 00 00 00       	mov    $0x0,%eax
+     b25:	e8 e3 13 00 00       	call   1f0d <printf>
+     b2a:	90                   	nop
+     b2b:	eb fd                	jmp    b2a <extendedpipetest+0x4c3>
+    }
+  close(fds[0]);
+     b2d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     b30:	89 c7                	mov    %eax,%edi
+     b32:	e8 70 1a 00 00       	call   25a7 <close>
+  if (write(fds[1], buf, 14) != -1) {
+     b37:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b3a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     b3e:	ba 0e 00 00 00       	mov    $0xe,%edx
+     b43:	48 89 ce             	mov    %rcx,%rsi
+     b46:	89 c7                	mov    %eax,%edi
+     b48:	e8 a0 24 00 00       	call   2fed <write>
+     b4d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b50:	74 5c                	je     bae <extendedpipetest+0x547>
+    error("extended pipe test: not returning -1 when read-end is closed\n");
+     b52:	8b 05 a8 44 00 00    	mov    0x44a8(%rip),%eax        # 5000 <stdout>
+     b58:	ba de 00 00 00       	mov    $0xde,%edx
+     b5d:	48 8d 0d c4 2f 00 00 	lea    0x2fc4(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     b64:	48 89 ce             	mov    %rcx,%rsi
+     b67:	89 c7                	mov    %eax,%edi
+     b69:	b8 00 00 00 00       	mov    $0x0,%eax
+     b6e:	e8 9a 13 00 00       	call   1f0d <printf>
+     b73:	8b 05 87 44 00 00    	mov    0x4487(%rip),%eax        # 5000 <stdout>
+     b79:	48 8d 15 80 32 00 00 	lea    0x3280(%rip),%rdx        # 3e00 <benchreport+0x426>
+     b80:	48 89 d6             	mov    %rdx,%rsi
+     b83:	89 c7                	mov    %eax,%edi
+     b85:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8a:	e8 7e 13 00 00       	call   1f0d <printf>
+     b8f:	8b 05 6b 44 00 00    	mov    0x446b(%rip),%eax        # 5000 <stdout>
+     b95:	48 8d 15 c7 2f 00 00 	lea    0x2fc7(%rip),%rdx        # 3b63 <benchreport+0x189>
+     b9c:	48 89 d6             	mov    %rdx,%rsi
+     b9f:	89 c7                	mov    %eax,%edi
+     ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ba6:	e8 62 13 00 00       	call   1f0d <printf>
+     bab:	90                   	nop
+     bac:	eb fd                	jmp    bab <extendedpipetest+0x544>
+  }
+  close(fds[1]);
+     bae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     bb1:	89 c7                	mov    %eax,%edi
+     bb3:	e8 ef 19 00 00       	call   25a7 <close>
+
+  printf(stdout, "extendedpipetest: ok\n");
+     bb8:	8b 05 42 44 00 00    	mov    0x4442(%rip),%eax        # 5000 <stdout>
+     bbe:	48 8d 15 79 32 00 00 	lea    0x3279(%rip),%rdx        # 3e3e <benchreport+0x464>
+     bc5:	48 89 d6             	mov    %rdx,%rsi
+     bc8:	89 c7                	mov    %eax,%edi
+     bca:	b8 00 00 00 00       	mov    $0x0,%eax
+     bcf:	e8 39 13 00 00       	call   1f0d <printf>
+}
+     bd4:	90                   	nop
+     bd5:	c9                   	leave
+     bd6:	c3                   	ret
+
+0000000000000bd7 <pkilltest>:
+
+void pkilltest(void) {
+     bd7:	55                   	push   %rbp
+     bd8:	48 89 e5             	mov    %rsp,%rbp
+     bdb:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[11];
+
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     bdf:	48 8d 05 6e 32 00 00 	lea    0x326e(%rip),%rax        # 3e54 <benchreport+0x47a>
+     be6:	48 89 c6             	mov    %rax,%rsi
+     be9:	bf 01 00 00 00       	mov    $0x1,%edi
+     bee:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf3:	e8 15 13 00 00       	call   1f0d <printf>
+  pid1 = fork();
+     bf8:	e8 30 19 00 00       	call   252d <fork>
+     bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid1 == 0)
+     c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c04:	75 03                	jne    c09 <pkilltest+0x32>
+    for (;;)
+     c06:	90                   	nop
+     c07:	eb fd                	jmp    c06 <pkilltest+0x2f>
+      ;
+
+  pid2 = fork();
+     c09:	e8 1f 19 00 00       	call   252d <fork>
+     c0e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (pid2 == 0)
+     c11:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     c15:	75 03                	jne    c1a <pkilltest+0x43>
+    for (;;)
+     c17:	90                   	nop
+     c18:	eb fd                	jmp    c17 <pkilltest+0x40>
+      ;
+
+  pipe(pfds);
+     c1a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     c1e:	48 89 c7             	mov    %rax,%rdi
+     c21:	e8 b1 23 00 00       	call   2fd7 <pipe>
+  pid3 = fork();
+     c26:	e8 02 19 00 00       	call   252d <fork>
+     c2b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid3 == 0) {
+     c2e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     c32:	0f 85 91 00 00 00    	jne    cc9 <pkilltest+0xf2>
+    close(pfds[0]);
+     c38:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     c3b:	89 c7                	mov    %eax,%edi
+     c3d:	e8 65 19 00 00       	call   25a7 <close>
+    if (write(pfds[1], "x", 1) != 1)
+     c42:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c45:	ba 01 00 00 00       	mov    $0x1,%edx
+     c4a:	48 8d 0d 0d 32 00 00 	lea    0x320d(%rip),%rcx        # 3e5e <benchreport+0x484>
+     c51:	48 89 ce             	mov    %rcx,%rsi
+     c54:	89 c7                	mov    %eax,%edi
+     c56:	e8 92 23 00 00       	call   2fed <write>
+     c5b:	83 f8 01             	cmp    $0x1,%eax
+     c5e:	74 5c                	je     cbc <pkilltest+0xe5>
+      error("pkilltest: write error");
+     c60:	8b 05 9a 43 00 00    	mov    0x439a(%rip),%eax        # 5000 <stdout>
+     c66:	ba fb 00 00 00       	mov    $0xfb,%edx
+     c6b:	48 8d 0d b6 2e 00 00 	lea    0x2eb6(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     c72:	48 89 ce             	mov    %rcx,%rsi
+     c75:	89 c7                	mov    %eax,%edi
+     c77:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7c:	e8 8c 12 00 00       	call   1f0d <printf>
+     c81:	8b 05 79 43 00 00    	mov    0x4379(%rip),%eax        # 5000 <stdout>
+     c87:	48 8d 15 d2 31 00 00 	lea    0x31d2(%rip),%rdx        # 3e60 <benchreport+0x486>
+     c8e:	48 89 d6             	mov    %rdx,%rsi
+     c91:	89 c7                	mov    %eax,%edi
+     c93:	b8 00 00 00 00       	mov    $0x0,%eax
+     c98:	e8 70 12 00 00       	call   1f0d <printf>
+     c9d:	8b 05 5d 43 00 00    	mov    0x435d(%rip),%eax        # 5000 <stdout>
+     ca3:	48 8d 15 b9 2e 00 00 	lea    0x2eb9(%rip),%rdx        # 3b63 <benchreport+0x189>
+     caa:	48 89 d6             	mov    %rdx,%rsi
+     cad:	89 c7                	mov    %eax,%edi
+     caf:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb4:	e8 54 12 00 00       	call   1f0d <printf>
+     cb9:	90                   	nop
+     cba:	eb fd                	jmp    cb9 <pkilltest+0xe2>
+    close(pfds[1]);
+     cbc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     cbf:	89 c7                	mov    %eax,%edi
+     cc1:	e8 e1 18 00 00       	call   25a7 <close>
+    for (;;)
+     cc6:	90                   	nop
+     cc7:	eb fd                	jmp    cc6 <pkilltest+0xef>
+      ;
+  }
+
+  close(pfds[1]);
+     cc9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ccc:	89 c7                	mov    %eax,%edi
+     cce:	e8 d4 18 00 00       	call   25a7 <close>
+  if (read(pfds[0], buf, sizeof(buf)) != 1) {
+     cd3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     cd6:	48 8d 4d e9          	lea    -0x17(%rbp),%rcx
+     cda:	ba 0b 00 00 00       	mov    $0xb,%edx
+     cdf:	48 89 ce             	mov    %rcx,%rsi
+     ce2:	89 c7                	mov    %eax,%edi
+     ce4:	e8 f9 22 00 00       	call   2fe2 <read>
+     ce9:	83 f8 01             	cmp    $0x1,%eax
+     cec:	74 5c                	je     d4a <pkilltest+0x173>
+    error("pkilltest: read error");
+     cee:	8b 05 0c 43 00 00    	mov    0x430c(%rip),%eax        # 5000 <stdout>
+     cf4:	ba 03 01 00 00       	mov    $0x103,%edx
+     cf9:	48 8d 0d 28 2e 00 00 	lea    0x2e28(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     d00:	48 89 ce             	mov    %rcx,%rsi
+     d03:	89 c7                	mov    %eax,%edi
+     d05:	b8 00 00 00 00       	mov    $0x0,%eax
+     d0a:	e8 fe 11 00 00       	call   1f0d <printf>
+     d0f:	8b 05 eb 42 00 00    	mov    0x42eb(%rip),%eax        # 5000 <stdout>
+     d15:	48 8d 15 5b 31 00 00 	lea    0x315b(%rip),%rdx        # 3e77 <benchreport+0x49d>
+     d1c:	48 89 d6             	mov    %rdx,%rsi
+     d1f:	89 c7                	mov    %eax,%edi
+     d21:	b8 00 00 00 00       	mov    $0x0,%eax
+     d26:	e8 e2 11 00 00       	call   1f0d <printf>
+     d2b:	8b 05 cf 42 00 00    	mov    0x42cf(%rip),%eax        # 5000 <stdout>
+     d31:	48 8d 15 2b 2e 00 00 	lea    0x2e2b(%rip),%rdx        # 3b63 <benchreport+0x189>
+     d38:	48 89 d6             	mov    %rdx,%rsi
+     d3b:	89 c7                	mov    %eax,%edi
+     d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d42:	e8 c6 11 00 00       	call   1f0d <printf>
+     d47:	90                   	nop
+     d48:	eb fd                	jmp    d47 <pkilltest+0x170>
+  }
+  close(pfds[0]);
+     d4a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     d4d:	89 c7                	mov    %eax,%edi
+     d4f:	e8 53 18 00 00       	call   25a7 <close>
+  printf(1, "kill... ");
+     d54:	48 8d 05 32 31 00 00 	lea    0x3132(%rip),%rax        # 3e8d <benchreport+0x4b3>
+     d5b:	48 89 c6             	mov    %rax,%rsi
+     d5e:	bf 01 00 00 00       	mov    $0x1,%edi
+     d63:	b8 00 00 00 00       	mov    $0x0,%eax
+     d68:	e8 a0 11 00 00       	call   1f0d <printf>
+  kill(pid1);
+     d6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d70:	89 c7                	mov    %eax,%edi
+     d72:	e8 8c 22 00 00       	call   3003 <kill>
+  kill(pid2);
+     d77:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d7a:	89 c7                	mov    %eax,%edi
+     d7c:	e8 82 22 00 00       	call   3003 <kill>
+  kill(pid3);
+     d81:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d84:	89 c7                	mov    %eax,%edi
+     d86:	e8 78 22 00 00       	call   3003 <kill>
+  printf(1, "wait... ");
+     d8b:	48 8d 05 04 31 00 00 	lea    0x3104(%rip),%rax        # 3e96 <benchreport+0x4bc>
+     d92:	48 89 c6             	mov    %rax,%rsi
+     d95:	bf 01 00 00 00       	mov    $0x1,%edi
+     d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d9f:	e8 69 11 00 00       	call   1f0d <printf>
+  wait();
+     da4:	e8 23 22 00 00       	call   2fcc <wait>
+  wait();
+     da9:	e8 1e 22 00 00       	call   2fcc <wait>
+  wait();
+     dae:	e8 19 22 00 00       	call   2fcc <wait>
+  printf(1, "pkilltest: ok\n");
+     db3:	48 8d 05 e5 30 00 00 	lea    0x30e5(%rip),%rax        # 3e9f <benchreport+0x4c5>
+     dba:	48 89 c6             	mov    %rax,%rsi
+     dbd:	bf 01 00 00 00       	mov    $0x1,%edi
+     dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc7:	e8 41 11 00 00       	call   1f0d <printf>
+}
+     dcc:	90                   	nop
+     dcd:	c9                   	leave
+     dce:	c3                   	ret
+
+0000000000000dcf <racetest>:
+
+void racetest(void) {
+     dcf:	55                   	push   %rbp
+     dd0:	48 89 e5             	mov    %rsp,%rbp
+     dd3:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, pid;
+
+  for (i = 0; i < 100; i++) {
+     dd7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     dde:	e9 df 00 00 00       	jmp    ec2 <racetest+0xf3>
+    pid = fork();
+     de3:	e8 45 17 00 00       	call   252d <fork>
+     de8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (pid < 0) {
+     deb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     def:	79 5c                	jns    e4d <racetest+0x7e>
+      error("racetest: fork failed\n");
+     df1:	8b 05 09 42 00 00    	mov    0x4209(%rip),%eax        # 5000 <stdout>
+     df7:	ba 17 01 00 00       	mov    $0x117,%edx
+     dfc:	48 8d 0d 25 2d 00 00 	lea    0x2d25(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     e03:	48 89 ce             	mov    %rcx,%rsi
+     e06:	89 c7                	mov    %eax,%edi
+     e08:	b8 00 00 00 00       	mov    $0x0,%eax
+     e0d:	e8 fb 10 00 00       	call   1f0d <printf>
+     e12:	8b 05 e8 41 00 00    	mov    0x41e8(%rip),%eax        # 5000 <stdout>
+     e18:	48 8d 15 8f 30 00 00 	lea    0x308f(%rip),%rdx        # 3eae <benchreport+0x4d4>
+     e1f:	48 89 d6             	mov    %rdx,%rsi
+     e22:	89 c7                	mov    %eax,%edi
+     e24:	b8 00 00 00 00       	mov    $0x0,%eax
+     e29:	e8 df 10 00 00       	call   1f0d <printf>
+     e2e:	8b 05 cc 41 00 00    	mov    0x41cc(%rip),%eax        # 5000 <stdout>
+     e34:	48 8d 15 28 2d 00 00 	lea    0x2d28(%rip),%rdx        # 3b63 <benchreport+0x189>
+     e3b:	48 89 d6             	mov    %rdx,%rsi
+     e3e:	89 c7                	mov    %eax,%edi
+     e40:	b8 00 00 00 00       	mov    $0x0,%eax
+     e45:	e8 c3 10 00 00       	call   1f0d <printf>
+     e4a:	90                   	nop
+     e4b:	eb fd                	jmp    e4a <racetest+0x7b>
+    }
+    if (pid) {
+     e4d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e51:	74 66                	je     eb9 <racetest+0xea>
+      if (wait() != pid) {
+     e53:	e8 74 21 00 00       	call   2fcc <wait>
+     e58:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     e5b:	74 61                	je     ebe <racetest+0xef>
+        error("racetest: wait wrong pid\n");
+     e5d:	8b 05 9d 41 00 00    	mov    0x419d(%rip),%eax        # 5000 <stdout>
+     e63:	ba 1b 01 00 00       	mov    $0x11b,%edx
+     e68:	48 8d 0d b9 2c 00 00 	lea    0x2cb9(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     e6f:	48 89 ce             	mov    %rcx,%rsi
+     e72:	89 c7                	mov    %eax,%edi
+     e74:	b8 00 00 00 00       	mov    $0x0,%eax
+     e79:	e8 8f 10 00 00       	call   1f0d <printf>
+     e7e:	8b 05 7c 41 00 00    	mov    0x417c(%rip),%eax        # 5000 <stdout>
+     e84:	48 8d 15 3a 30 00 00 	lea    0x303a(%rip),%rdx        # 3ec5 <benchreport+0x4eb>
+     e8b:	48 89 d6             	mov    %rdx,%rsi
+     e8e:	89 c7                	mov    %eax,%edi
+     e90:	b8 00 00 00 00       	mov    $0x0,%eax
+     e95:	e8 73 10 00 00       	call   1f0d <printf>
+     e9a:	8b 05 60 41 00 00    	mov    0x4160(%rip),%eax        # 5000 <stdout>
+     ea0:	48 8d 15 bc 2c 00 00 	lea    0x2cbc(%rip),%rdx        # 3b63 <benchreport+0x189>
+     ea7:	48 89 d6             	mov    %rdx,%rsi
+     eaa:	89 c7                	mov    %eax,%edi
+     eac:	b8 00 00 00 00       	mov    $0x0,%eax
+     eb1:	e8 57 10 00 00       	call   1f0d <printf>
+     eb6:	90                   	nop
+     eb7:	eb fd                	jmp    eb6 <racetest+0xe7>
+      }
+    } else {
+      exit();
+     eb9:	e8 7f 16 00 00       	call   253d <exit>
+  for (i = 0; i < 100; i++) {
+     ebe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ec2:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+     ec6:	0f 8e 17 ff ff ff    	jle    de3 <racetest+0x14>
+    }
+  }
+  printf(1, "racetest: ok\n");
+     ecc:	48 8d 05 0c 30 00 00 	lea    0x300c(%rip),%rax        # 3edf <benchreport+0x505>
+     ed3:	48 89 c6             	mov    %rax,%rsi
+     ed6:	bf 01 00 00 00       	mov    $0x1,%edi
+     edb:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee0:	e8 28 10 00 00       	call   1f0d <printf>
+}
+     ee5:	90                   	nop
+     ee6:	c9                   	leave
+     ee7:	c3                   	ret
+
+0000000000000ee8 <fdesctest>:
+
+void fdesctest(void) {
+     ee8:	55                   	push   %rbp
+     ee9:	48 89 e5             	mov    %rsp,%rbp
+     eec:	48 83 ec 20          	sub    $0x20,%rsp
+  printf(1, "fdesctest\n");
+     ef0:	48 8d 05 f6 2f 00 00 	lea    0x2ff6(%rip),%rax        # 3eed <benchreport+0x513>
+     ef7:	48 89 c6             	mov    %rax,%rsi
+     efa:	bf 01 00 00 00       	mov    $0x1,%edi
+     eff:	b8 00 00 00 00       	mov    $0x0,%eax
+     f04:	e8 04 10 00 00       	call   1f0d <printf>
+  int fd1;
+  char buf[11] = {0};
+     f09:	48 c7 45 e1 00 00 00 	movq   $0x0,-0x1f(%rbp)
+     f10:	00 
+     f11:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+
+  // Make sure offsets are shared
+  assert((fd1 = open("l2_share.txt", O_RDONLY)) > -1);
+     f18:	be 00 00 00 00       	mov    $0x0,%esi
+     f1d:	48 8d 05 d4 2f 00 00 	lea    0x2fd4(%rip),%rax        # 3ef8 <benchreport+0x51e>
+     f24:	48 89 c7             	mov    %rax,%rdi
+     f27:	e8 ed 20 00 00       	call   3019 <open>
+     f2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     f2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     f33:	79 2b                	jns    f60 <fdesctest+0x78>
+     f35:	8b 05 c5 40 00 00    	mov    0x40c5(%rip),%eax        # 5000 <stdout>
+     f3b:	48 8d 15 c6 2f 00 00 	lea    0x2fc6(%rip),%rdx        # 3f08 <benchreport+0x52e>
+     f42:	48 89 d1             	mov    %rdx,%rcx
+     f45:	ba 2a 01 00 00       	mov    $0x12a,%edx
+     f4a:	48 8d 35 e7 2f 00 00 	lea    0x2fe7(%rip),%rsi        # 3f38 <benchreport+0x55e>
+     f51:	89 c7                	mov    %eax,%edi
+     f53:	b8 00 00 00 00       	mov    $0x0,%eax
+     f58:	e8 b0 0f 00 00       	call   1f0d <printf>
+     f5d:	90                   	nop
+     f5e:	eb fd                	jmp    f5d <fdesctest+0x75>
+
+  if (!fork()) {
+     f60:	e8 c8 15 00 00       	call   252d <fork>
+     f65:	85 c0                	test   %eax,%eax
+     f67:	0f 85 f6 00 00 00    	jne    1063 <fdesctest+0x17b>
+    if (read(fd1, buf, 10) != 10)
+     f6d:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+     f71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f74:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f79:	48 89 ce             	mov    %rcx,%rsi
+     f7c:	89 c7                	mov    %eax,%edi
+     f7e:	e8 5f 20 00 00       	call   2fe2 <read>
+     f83:	83 f8 0a             	cmp    $0xa,%eax
+     f86:	74 5c                	je     fe4 <fdesctest+0xfc>
+      error("tried to read 10 bytes from fd1");
+     f88:	8b 05 72 40 00 00    	mov    0x4072(%rip),%eax        # 5000 <stdout>
+     f8e:	ba 2e 01 00 00       	mov    $0x12e,%edx
+     f93:	48 8d 0d 8e 2b 00 00 	lea    0x2b8e(%rip),%rcx        # 3b28 <benchreport+0x14e>
+     f9a:	48 89 ce             	mov    %rcx,%rsi
+     f9d:	89 c7                	mov    %eax,%edi
+     f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+     fa4:	e8 64 0f 00 00       	call   1f0d <printf>
+     fa9:	8b 05 51 40 00 00    	mov    0x4051(%rip),%eax        # 5000 <stdout>
+     faf:	48 8d 15 a2 2f 00 00 	lea    0x2fa2(%rip),%rdx        # 3f58 <benchreport+0x57e>
+     fb6:	48 89 d6             	mov    %rdx,%rsi
+     fb9:	89 c7                	mov    %eax,%edi
+     fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+     fc0:	e8 48 0f 00 00       	call   1f0d <printf>
+     fc5:	8b 05 35 40 00 00    	mov    0x4035(%rip),%eax        # 5000 <stdout>
+     fcb:	48 8d 15 91 2b 00 00 	lea    0x2b91(%rip),%rdx        # 3b63 <benchreport+0x189>
+     fd2:	48 89 d6             	mov    %rdx,%rsi
+     fd5:	89 c7                	mov    %eax,%edi
+     fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+     fdc:	e8 2c 0f 00 00       	call   1f0d <printf>
+     fe1:	90                   	nop
+     fe2:	eb fd                	jmp    fe1 <fdesctest+0xf9>
+
+    if (strcmp("cccccccccc", buf))
+     fe4:	48 8d 45 e1          	lea    -0x1f(%rbp),%rax
+     fe8:	48 89 c6             	mov    %rax,%rsi
+     feb:	48 8d 05 86 2f 00 00 	lea    0x2f86(%rip),%rax        # 3f78 <benchreport+0x59e>
+     ff2:	48 89 c7             	mov    %rax,%rdi
+     ff5:	e8 46 18 00 00       	call   2840 <strcmp>
+     ffa:	85 c0                	test   %eax,%eax
+     ffc:	74 60                	je     105e <fdesctest+0x176>
+      error("should have reead 10 c's, instead: '%s'", buf);
+     ffe:	8b 05 fc 3f 00 00    	mov    0x3ffc(%rip),%eax        # 5000 <stdout>
+    1004:	ba 31 01 00 00       	mov    $0x131,%edx
+    1009:	48 8d 0d 18 2b 00 00 	lea    0x2b18(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    1010:	48 89 ce             	mov    %rcx,%rsi
+    1013:	89 c7                	mov    %eax,%edi
+    1015:	b8 00 00 00 00       	mov    $0x0,%eax
+    101a:	e8 ee 0e 00 00       	call   1f0d <printf>
+    101f:	8b 05 db 3f 00 00    	mov    0x3fdb(%rip),%eax        # 5000 <stdout>
+    1025:	48 8d 55 e1          	lea    -0x1f(%rbp),%rdx
+    1029:	48 8d 0d 58 2f 00 00 	lea    0x2f58(%rip),%rcx        # 3f88 <benchreport+0x5ae>
+    1030:	48 89 ce             	mov    %rcx,%rsi
+    1033:	89 c7                	mov    %eax,%edi
+    1035:	b8 00 00 00 00       	mov    $0x0,%eax
+    103a:	e8 ce 0e 00 00       	call   1f0d <printf>
+    103f:	8b 05 bb 3f 00 00    	mov    0x3fbb(%rip),%eax        # 5000 <stdout>
+    1045:	48 8d 15 17 2b 00 00 	lea    0x2b17(%rip),%rdx        # 3b63 <benchreport+0x189>
+    104c:	48 89 d6             	mov    %rdx,%rsi
+    104f:	89 c7                	mov    %eax,%edi
+    1051:	b8 00 00 00 00       	mov    $0x0,%eax
+    1056:	e8 b2 0e 00 00       	call   1f0d <printf>
+    105b:	90                   	nop
+    105c:	eb fd                	jmp    105b <fdesctest+0x173>
+    exit();
+    105e:	e8 da 14 00 00       	call   253d <exit>
+  } else {
+    wait();
+    1063:	e8 64 1f 00 00       	call   2fcc <wait>
+  }
+
+  if (read(fd1, buf, 10) != 10)
+    1068:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    106c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    106f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1074:	48 89 ce             	mov    %rcx,%rsi
+    1077:	89 c7                	mov    %eax,%edi
+    1079:	e8 64 1f 00 00       	call   2fe2 <read>
+    107e:	83 f8 0a             	cmp    $0xa,%eax
+    1081:	74 5c                	je     10df <fdesctest+0x1f7>
+    error("tried to read 10 bytes from fd1");
+    1083:	8b 05 77 3f 00 00    	mov    0x3f77(%rip),%eax        # 5000 <stdout>
+    1089:	ba 38 01 00 00       	mov    $0x138,%edx
+    108e:	48 8d 0d 93 2a 00 00 	lea    0x2a93(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    1095:	48 89 ce             	mov    %rcx,%rsi
+    1098:	89 c7                	mov    %eax,%edi
+    109a:	b8 00 00 00 00       	mov    $0x0,%eax
+    109f:	e8 69 0e 00 00       	call   1f0d <printf>
+    10a4:	8b 05 56 3f 00 00    	mov    0x3f56(%rip),%eax        # 5000 <stdout>
+    10aa:	48 8d 15 a7 2e 00 00 	lea    0x2ea7(%rip),%rdx        # 3f58 <benchreport+0x57e>
+    10b1:	48 89 d6             	mov    %rdx,%rsi
+    10b4:	89 c7                	mov    %eax,%edi
+    10b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10bb:	e8 4d 0e 00 00       	call   1f0d <printf>
+    10c0:	8b 05 3a 3f 00 00    	mov    0x3f3a(%rip),%eax        # 5000 <stdout>
+    10c6:	48 8d 15 96 2a 00 00 	lea    0x2a96(%rip),%rdx        # 3b63 <benchreport+0x189>
+    10cd:	48 89 d6             	mov    %rdx,%rsi
+    10d0:	89 c7                	mov    %eax,%edi
+    10d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d7:	e8 31 0e 00 00       	call   1f0d <printf>
+    10dc:	90                   	nop
+    10dd:	eb fd                	jmp    10dc <fdesctest+0x1f4>
+
+  if (strcmp("ppppppppp\n", buf))
+    10df:	48 8d 45 e1          	lea    -0x1f(%rbp),%rax
+    10e3:	48 89 c6             	mov    %rax,%rsi
+    10e6:	48 8d 05 c3 2e 00 00 	lea    0x2ec3(%rip),%rax        # 3fb0 <benchreport+0x5d6>
+    10ed:	48 89 c7             	mov    %rax,%rdi
+    10f0:	e8 4b 17 00 00       	call   2840 <strcmp>
+    10f5:	85 c0                	test   %eax,%eax
+    10f7:	74 60                	je     1159 <fdesctest+0x271>
+    error("should have reead 9 p's (and a newline), instead: '%s'", buf);
+    10f9:	8b 05 01 3f 00 00    	mov    0x3f01(%rip),%eax        # 5000 <stdout>
+    10ff:	ba 3b 01 00 00       	mov    $0x13b,%edx
+    1104:	48 8d 0d 1d 2a 00 00 	lea    0x2a1d(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    110b:	48 89 ce             	mov    %rcx,%rsi
+    110e:	89 c7                	mov    %eax,%edi
+    1110:	b8 00 00 00 00       	mov    $0x0,%eax
+    1115:	e8 f3 0d 00 00       	call   1f0d <printf>
+    111a:	8b 05 e0 3e 00 00    	mov    0x3ee0(%rip),%eax        # 5000 <stdout>
+    1120:	48 8d 55 e1          	lea    -0x1f(%rbp),%rdx
+    1124:	48 8d 0d 95 2e 00 00 	lea    0x2e95(%rip),%rcx        # 3fc0 <benchreport+0x5e6>
+    112b:	48 89 ce             	mov    %rcx,%rsi
+    112e:	89 c7                	mov    %eax,%edi
+    1130:	b8 00 00 00 00       	mov    $0x0,%eax
+    1135:	e8 d3 0d 00 00       	call   1f0d <printf>
+    113a:	8b 05 c0 3e 00 00    	mov    0x3ec0(%rip),%eax        # 5000 <stdout>
+    1140:	48 8d 15 1c 2a 00 00 	lea    0x2a1c(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1147:	48 89 d6             	mov    %rdx,%rsi
+    114a:	89 c7                	mov    %eax,%edi
+    114c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1151:	e8 b7 0d 00 00       	call   1f0d <printf>
+    1156:	90                   	nop
+    1157:	eb fd                	jmp    1156 <fdesctest+0x26e>
+
+  close(fd1);
+    1159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    115c:	89 c7                	mov    %eax,%edi
+    115e:	e8 44 14 00 00       	call   25a7 <close>
+
+  // Make sure the correct file descriptor ints are maintained
+  
+  int fd2, fd3, fd4, fd5;
+  assert((fd2 = open("l2_share.txt", O_RDONLY)) > -1);
+    1163:	be 00 00 00 00       	mov    $0x0,%esi
+    1168:	48 8d 05 89 2d 00 00 	lea    0x2d89(%rip),%rax        # 3ef8 <benchreport+0x51e>
+    116f:	48 89 c7             	mov    %rax,%rdi
+    1172:	e8 a2 1e 00 00       	call   3019 <open>
+    1177:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    117a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    117e:	79 2b                	jns    11ab <fdesctest+0x2c3>
+    1180:	8b 05 7a 3e 00 00    	mov    0x3e7a(%rip),%eax        # 5000 <stdout>
+    1186:	48 8d 15 6b 2e 00 00 	lea    0x2e6b(%rip),%rdx        # 3ff8 <benchreport+0x61e>
+    118d:	48 89 d1             	mov    %rdx,%rcx
+    1190:	ba 42 01 00 00       	mov    $0x142,%edx
+    1195:	48 8d 35 9c 2d 00 00 	lea    0x2d9c(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    119c:	89 c7                	mov    %eax,%edi
+    119e:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a3:	e8 65 0d 00 00       	call   1f0d <printf>
+    11a8:	90                   	nop
+    11a9:	eb fd                	jmp    11a8 <fdesctest+0x2c0>
+  assert((fd3 = open("l2_share.txt", O_RDONLY)) > -1);
+    11ab:	be 00 00 00 00       	mov    $0x0,%esi
+    11b0:	48 8d 05 41 2d 00 00 	lea    0x2d41(%rip),%rax        # 3ef8 <benchreport+0x51e>
+    11b7:	48 89 c7             	mov    %rax,%rdi
+    11ba:	e8 5a 1e 00 00       	call   3019 <open>
+    11bf:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    11c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    11c6:	79 2b                	jns    11f3 <fdesctest+0x30b>
+    11c8:	8b 05 32 3e 00 00    	mov    0x3e32(%rip),%eax        # 5000 <stdout>
+    11ce:	48 8d 15 53 2e 00 00 	lea    0x2e53(%rip),%rdx        # 4028 <benchreport+0x64e>
+    11d5:	48 89 d1             	mov    %rdx,%rcx
+    11d8:	ba 43 01 00 00       	mov    $0x143,%edx
+    11dd:	48 8d 35 54 2d 00 00 	lea    0x2d54(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    11e4:	89 c7                	mov    %eax,%edi
+    11e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11eb:	e8 1d 0d 00 00       	call   1f0d <printf>
+    11f0:	90                   	nop
+    11f1:	eb fd                	jmp    11f0 <fdesctest+0x308>
+  assert((fd4 = open("l2_share.txt", O_RDONLY)) > -1);
+    11f3:	be 00 00 00 00       	mov    $0x0,%esi
+    11f8:	48 8d 05 f9 2c 00 00 	lea    0x2cf9(%rip),%rax        # 3ef8 <benchreport+0x51e>
+    11ff:	48 89 c7             	mov    %rax,%rdi
+    1202:	e8 12 1e 00 00       	call   3019 <open>
+    1207:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    120a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+    120e:	79 2b                	jns    123b <fdesctest+0x353>
+    1210:	8b 05 ea 3d 00 00    	mov    0x3dea(%rip),%eax        # 5000 <stdout>
+    1216:	48 8d 15 3b 2e 00 00 	lea    0x2e3b(%rip),%rdx        # 4058 <benchreport+0x67e>
+    121d:	48 89 d1             	mov    %rdx,%rcx
+    1220:	ba 44 01 00 00       	mov    $0x144,%edx
+    1225:	48 8d 35 0c 2d 00 00 	lea    0x2d0c(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    122c:	89 c7                	mov    %eax,%edi
+    122e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1233:	e8 d5 0c 00 00       	call   1f0d <printf>
+    1238:	90                   	nop
+    1239:	eb fd                	jmp    1238 <fdesctest+0x350>
+  assert((fd5 = open("l2_share.txt", O_RDONLY)) > -1);
+    123b:	be 00 00 00 00       	mov    $0x0,%esi
+    1240:	48 8d 05 b1 2c 00 00 	lea    0x2cb1(%rip),%rax        # 3ef8 <benchreport+0x51e>
+    1247:	48 89 c7             	mov    %rax,%rdi
+    124a:	e8 ca 1d 00 00       	call   3019 <open>
+    124f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    1252:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1256:	79 2b                	jns    1283 <fdesctest+0x39b>
+    1258:	8b 05 a2 3d 00 00    	mov    0x3da2(%rip),%eax        # 5000 <stdout>
+    125e:	48 8d 15 23 2e 00 00 	lea    0x2e23(%rip),%rdx        # 4088 <benchreport+0x6ae>
+    1265:	48 89 d1             	mov    %rdx,%rcx
+    1268:	ba 45 01 00 00       	mov    $0x145,%edx
+    126d:	48 8d 35 c4 2c 00 00 	lea    0x2cc4(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    1274:	89 c7                	mov    %eax,%edi
+    1276:	b8 00 00 00 00       	mov    $0x0,%eax
+    127b:	e8 8d 0c 00 00       	call   1f0d <printf>
+    1280:	90                   	nop
+    1281:	eb fd                	jmp    1280 <fdesctest+0x398>
+
+  assert(close(fd3) != -1);
+    1283:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1286:	89 c7                	mov    %eax,%edi
+    1288:	e8 1a 13 00 00       	call   25a7 <close>
+    128d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1290:	75 2b                	jne    12bd <fdesctest+0x3d5>
+    1292:	8b 05 68 3d 00 00    	mov    0x3d68(%rip),%eax        # 5000 <stdout>
+    1298:	48 8d 15 15 2e 00 00 	lea    0x2e15(%rip),%rdx        # 40b4 <benchreport+0x6da>
+    129f:	48 89 d1             	mov    %rdx,%rcx
+    12a2:	ba 47 01 00 00       	mov    $0x147,%edx
+    12a7:	48 8d 35 8a 2c 00 00 	lea    0x2c8a(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    12ae:	89 c7                	mov    %eax,%edi
+    12b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b5:	e8 53 0c 00 00       	call   1f0d <printf>
+    12ba:	90                   	nop
+    12bb:	eb fd                	jmp    12ba <fdesctest+0x3d2>
+  assert(close(fd4) != -1);
+    12bd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    12c0:	89 c7                	mov    %eax,%edi
+    12c2:	e8 e0 12 00 00       	call   25a7 <close>
+    12c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12ca:	75 2b                	jne    12f7 <fdesctest+0x40f>
+    12cc:	8b 05 2e 3d 00 00    	mov    0x3d2e(%rip),%eax        # 5000 <stdout>
+    12d2:	48 8d 15 ec 2d 00 00 	lea    0x2dec(%rip),%rdx        # 40c5 <benchreport+0x6eb>
+    12d9:	48 89 d1             	mov    %rdx,%rcx
+    12dc:	ba 48 01 00 00       	mov    $0x148,%edx
+    12e1:	48 8d 35 50 2c 00 00 	lea    0x2c50(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    12e8:	89 c7                	mov    %eax,%edi
+    12ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    12ef:	e8 19 0c 00 00       	call   1f0d <printf>
+    12f4:	90                   	nop
+    12f5:	eb fd                	jmp    12f4 <fdesctest+0x40c>
+
+  if (!fork()) {
+    12f7:	e8 31 12 00 00       	call   252d <fork>
+    12fc:	85 c0                	test   %eax,%eax
+    12fe:	0f 85 1d 01 00 00    	jne    1421 <fdesctest+0x539>
+    assert(read(fd2, buf, 10) == 10);
+    1304:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    1308:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    130b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1310:	48 89 ce             	mov    %rcx,%rsi
+    1313:	89 c7                	mov    %eax,%edi
+    1315:	e8 c8 1c 00 00       	call   2fe2 <read>
+    131a:	83 f8 0a             	cmp    $0xa,%eax
+    131d:	74 2b                	je     134a <fdesctest+0x462>
+    131f:	8b 05 db 3c 00 00    	mov    0x3cdb(%rip),%eax        # 5000 <stdout>
+    1325:	48 8d 15 aa 2d 00 00 	lea    0x2daa(%rip),%rdx        # 40d6 <benchreport+0x6fc>
+    132c:	48 89 d1             	mov    %rdx,%rcx
+    132f:	ba 4b 01 00 00       	mov    $0x14b,%edx
+    1334:	48 8d 35 fd 2b 00 00 	lea    0x2bfd(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    133b:	89 c7                	mov    %eax,%edi
+    133d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1342:	e8 c6 0b 00 00       	call   1f0d <printf>
+    1347:	90                   	nop
+    1348:	eb fd                	jmp    1347 <fdesctest+0x45f>
+    assert(read(fd3, buf, 10) == -1); // this fd shouldn't be open
+    134a:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    134e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1351:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1356:	48 89 ce             	mov    %rcx,%rsi
+    1359:	89 c7                	mov    %eax,%edi
+    135b:	e8 82 1c 00 00       	call   2fe2 <read>
+    1360:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1363:	74 2b                	je     1390 <fdesctest+0x4a8>
+    1365:	8b 05 95 3c 00 00    	mov    0x3c95(%rip),%eax        # 5000 <stdout>
+    136b:	48 8d 15 7d 2d 00 00 	lea    0x2d7d(%rip),%rdx        # 40ef <benchreport+0x715>
+    1372:	48 89 d1             	mov    %rdx,%rcx
+    1375:	ba 4c 01 00 00       	mov    $0x14c,%edx
+    137a:	48 8d 35 b7 2b 00 00 	lea    0x2bb7(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    1381:	89 c7                	mov    %eax,%edi
+    1383:	b8 00 00 00 00       	mov    $0x0,%eax
+    1388:	e8 80 0b 00 00       	call   1f0d <printf>
+    138d:	90                   	nop
+    138e:	eb fd                	jmp    138d <fdesctest+0x4a5>
+    assert(read(fd4, buf, 10) == -1); // this fd shouldn't be open
+    1390:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    1394:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1397:	ba 0a 00 00 00       	mov    $0xa,%edx
+    139c:	48 89 ce             	mov    %rcx,%rsi
+    139f:	89 c7                	mov    %eax,%edi
+    13a1:	e8 3c 1c 00 00       	call   2fe2 <read>
+    13a6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13a9:	74 2b                	je     13d6 <fdesctest+0x4ee>
+    13ab:	8b 05 4f 3c 00 00    	mov    0x3c4f(%rip),%eax        # 5000 <stdout>
+    13b1:	48 8d 15 50 2d 00 00 	lea    0x2d50(%rip),%rdx        # 4108 <benchreport+0x72e>
+    13b8:	48 89 d1             	mov    %rdx,%rcx
+    13bb:	ba 4d 01 00 00       	mov    $0x14d,%edx
+    13c0:	48 8d 35 71 2b 00 00 	lea    0x2b71(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    13c7:	89 c7                	mov    %eax,%edi
+    13c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    13ce:	e8 3a 0b 00 00       	call   1f0d <printf>
+    13d3:	90                   	nop
+    13d4:	eb fd                	jmp    13d3 <fdesctest+0x4eb>
+    assert(read(fd5, buf, 10) == 10);
+    13d6:	48 8d 4d e1          	lea    -0x1f(%rbp),%rcx
+    13da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    13dd:	ba 0a 00 00 00       	mov    $0xa,%edx
+    13e2:	48 89 ce             	mov    %rcx,%rsi
+    13e5:	89 c7                	mov    %eax,%edi
+    13e7:	e8 f6 1b 00 00       	call   2fe2 <read>
+    13ec:	83 f8 0a             	cmp    $0xa,%eax
+    13ef:	74 2b                	je     141c <fdesctest+0x534>
+    13f1:	8b 05 09 3c 00 00    	mov    0x3c09(%rip),%eax        # 5000 <stdout>
+    13f7:	48 8d 15 23 2d 00 00 	lea    0x2d23(%rip),%rdx        # 4121 <benchreport+0x747>
+    13fe:	48 89 d1             	mov    %rdx,%rcx
+    1401:	ba 4e 01 00 00       	mov    $0x14e,%edx
+    1406:	48 8d 35 2b 2b 00 00 	lea    0x2b2b(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    140d:	89 c7                	mov    %eax,%edi
+    140f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1414:	e8 f4 0a 00 00       	call   1f0d <printf>
+    1419:	90                   	nop
+    141a:	eb fd                	jmp    1419 <fdesctest+0x531>
+    exit();
+    141c:	e8 1c 11 00 00       	call   253d <exit>
+  } else {
+    wait();
+    1421:	e8 a6 1b 00 00       	call   2fcc <wait>
+  }
+
+  printf(1, "fdesctest: ok\n");
+    1426:	48 8d 05 0d 2d 00 00 	lea    0x2d0d(%rip),%rax        # 413a <benchreport+0x760>
+    142d:	48 89 c6             	mov    %rax,%rsi
+    1430:	bf 01 00 00 00       	mov    $0x1,%edi
+    1435:	b8 00 00 00 00       	mov    $0x0,%eax
+    143a:	e8 ce 0a 00 00       	call   1f0d <printf>
+}
+    143f:	90                   	nop
+    1440:	c9                   	leave
+    1441:	c3                   	ret
+
+0000000000001442 <childpidtesthelper>:
+
+static void childpidtesthelper(int depth) {
+    1442:	55                   	push   %rbp
+    1443:	48 89 e5             	mov    %rsp,%rbp
+    1446:	48 83 ec 30          	sub    $0x30,%rsp
+    144a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  int pids[3];
+  int i, j, p;
+
+  if (depth == 0)
+    144d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1451:	0f 84 c4 01 00 00    	je     161b <childpidtesthelper+0x1d9>
+    return;
+
+  for (i = 0; i < 3; i++) {
+    1457:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    145e:	eb 6a                	jmp    14ca <childpidtesthelper+0x88>
+    pids[i] = fork();
+    1460:	e8 c8 10 00 00       	call   252d <fork>
+    1465:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1468:	48 63 d2             	movslq %edx,%rdx
+    146b:	89 44 95 e8          	mov    %eax,-0x18(%rbp,%rdx,4)
+    assert(pids[i] >= 0);
+    146f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1472:	48 98                	cltq
+    1474:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    1478:	85 c0                	test   %eax,%eax
+    147a:	79 2b                	jns    14a7 <childpidtesthelper+0x65>
+    147c:	8b 05 7e 3b 00 00    	mov    0x3b7e(%rip),%eax        # 5000 <stdout>
+    1482:	48 8d 15 c0 2c 00 00 	lea    0x2cc0(%rip),%rdx        # 4149 <benchreport+0x76f>
+    1489:	48 89 d1             	mov    %rdx,%rcx
+    148c:	ba 60 01 00 00       	mov    $0x160,%edx
+    1491:	48 8d 35 a0 2a 00 00 	lea    0x2aa0(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    1498:	89 c7                	mov    %eax,%edi
+    149a:	b8 00 00 00 00       	mov    $0x0,%eax
+    149f:	e8 69 0a 00 00       	call   1f0d <printf>
+    14a4:	90                   	nop
+    14a5:	eb fd                	jmp    14a4 <childpidtesthelper+0x62>
+    if (!pids[i]) {
+    14a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14aa:	48 98                	cltq
+    14ac:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    14b0:	85 c0                	test   %eax,%eax
+    14b2:	75 12                	jne    14c6 <childpidtesthelper+0x84>
+      childpidtesthelper(depth - 1);
+    14b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    14b7:	83 e8 01             	sub    $0x1,%eax
+    14ba:	89 c7                	mov    %eax,%edi
+    14bc:	e8 81 ff ff ff       	call   1442 <childpidtesthelper>
+      exit();
+    14c1:	e8 77 10 00 00       	call   253d <exit>
+  for (i = 0; i < 3; i++) {
+    14c6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    14ca:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    14ce:	7e 90                	jle    1460 <childpidtesthelper+0x1e>
+    }
+  }
+
+  for (i = 0; i < 3; i++) {
+    14d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    14d7:	e9 cf 00 00 00       	jmp    15ab <childpidtesthelper+0x169>
+    p = wait();
+    14dc:	e8 eb 1a 00 00       	call   2fcc <wait>
+    14e1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    assert(p > 0);
+    14e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    14e8:	7f 2b                	jg     1515 <childpidtesthelper+0xd3>
+    14ea:	8b 05 10 3b 00 00    	mov    0x3b10(%rip),%eax        # 5000 <stdout>
+    14f0:	48 8d 15 5f 2c 00 00 	lea    0x2c5f(%rip),%rdx        # 4156 <benchreport+0x77c>
+    14f7:	48 89 d1             	mov    %rdx,%rcx
+    14fa:	ba 69 01 00 00       	mov    $0x169,%edx
+    14ff:	48 8d 35 32 2a 00 00 	lea    0x2a32(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    1506:	89 c7                	mov    %eax,%edi
+    1508:	b8 00 00 00 00       	mov    $0x0,%eax
+    150d:	e8 fb 09 00 00       	call   1f0d <printf>
+    1512:	90                   	nop
+    1513:	eb fd                	jmp    1512 <childpidtesthelper+0xd0>
+    for (j = 0; j < 3; j++) {
+    1515:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    151c:	eb 21                	jmp    153f <childpidtesthelper+0xfd>
+      if (p == pids[j]) {
+    151e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1521:	48 98                	cltq
+    1523:	8b 44 85 e8          	mov    -0x18(%rbp,%rax,4),%eax
+    1527:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    152a:	75 0f                	jne    153b <childpidtesthelper+0xf9>
+        pids[j] = -1; // make sure duplicates are not returned
+    152c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    152f:	48 98                	cltq
+    1531:	c7 44 85 e8 ff ff ff 	movl   $0xffffffff,-0x18(%rbp,%rax,4)
+    1538:	ff 
+        break;
+    1539:	eb 0a                	jmp    1545 <childpidtesthelper+0x103>
+    for (j = 0; j < 3; j++) {
+    153b:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    153f:	83 7d f8 02          	cmpl   $0x2,-0x8(%rbp)
+    1543:	7e d9                	jle    151e <childpidtesthelper+0xdc>
+      }
+    }
+    if (j == 3)
+    1545:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+    1549:	75 5c                	jne    15a7 <childpidtesthelper+0x165>
+      error("returned pid was not a child");
+    154b:	8b 05 af 3a 00 00    	mov    0x3aaf(%rip),%eax        # 5000 <stdout>
+    1551:	ba 71 01 00 00       	mov    $0x171,%edx
+    1556:	48 8d 0d cb 25 00 00 	lea    0x25cb(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    155d:	48 89 ce             	mov    %rcx,%rsi
+    1560:	89 c7                	mov    %eax,%edi
+    1562:	b8 00 00 00 00       	mov    $0x0,%eax
+    1567:	e8 a1 09 00 00       	call   1f0d <printf>
+    156c:	8b 05 8e 3a 00 00    	mov    0x3a8e(%rip),%eax        # 5000 <stdout>
+    1572:	48 8d 15 e3 2b 00 00 	lea    0x2be3(%rip),%rdx        # 415c <benchreport+0x782>
+    1579:	48 89 d6             	mov    %rdx,%rsi
+    157c:	89 c7                	mov    %eax,%edi
+    157e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1583:	e8 85 09 00 00       	call   1f0d <printf>
+    1588:	8b 05 72 3a 00 00    	mov    0x3a72(%rip),%eax        # 5000 <stdout>
+    158e:	48 8d 15 ce 25 00 00 	lea    0x25ce(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1595:	48 89 d6             	mov    %rdx,%rsi
+    1598:	89 c7                	mov    %eax,%edi
+    159a:	b8 00 00 00 00       	mov    $0x0,%eax
+    159f:	e8 69 09 00 00       	call   1f0d <printf>
+    15a4:	90                   	nop
+    15a5:	eb fd                	jmp    15a4 <childpidtesthelper+0x162>
+  for (i = 0; i < 3; i++) {
+    15a7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    15ab:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    15af:	0f 8e 27 ff ff ff    	jle    14dc <childpidtesthelper+0x9a>
+  }
+
+  // No more children
+  if (wait() != -1)
+    15b5:	e8 12 1a 00 00       	call   2fcc <wait>
+    15ba:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15bd:	74 5d                	je     161c <childpidtesthelper+0x1da>
+    error("there should be no more children");
+    15bf:	8b 05 3b 3a 00 00    	mov    0x3a3b(%rip),%eax        # 5000 <stdout>
+    15c5:	ba 76 01 00 00       	mov    $0x176,%edx
+    15ca:	48 8d 0d 57 25 00 00 	lea    0x2557(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    15d1:	48 89 ce             	mov    %rcx,%rsi
+    15d4:	89 c7                	mov    %eax,%edi
+    15d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    15db:	e8 2d 09 00 00       	call   1f0d <printf>
+    15e0:	8b 05 1a 3a 00 00    	mov    0x3a1a(%rip),%eax        # 5000 <stdout>
+    15e6:	48 8d 15 93 2b 00 00 	lea    0x2b93(%rip),%rdx        # 4180 <benchreport+0x7a6>
+    15ed:	48 89 d6             	mov    %rdx,%rsi
+    15f0:	89 c7                	mov    %eax,%edi
+    15f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15f7:	e8 11 09 00 00       	call   1f0d <printf>
+    15fc:	8b 05 fe 39 00 00    	mov    0x39fe(%rip),%eax        # 5000 <stdout>
+    1602:	48 8d 15 5a 25 00 00 	lea    0x255a(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1609:	48 89 d6             	mov    %rdx,%rsi
+    160c:	89 c7                	mov    %eax,%edi
+    160e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1613:	e8 f5 08 00 00       	call   1f0d <printf>
+    1618:	90                   	nop
+    1619:	eb fd                	jmp    1618 <childpidtesthelper+0x1d6>
+    return;
+    161b:	90                   	nop
+}
+    161c:	c9                   	leave
+    161d:	c3                   	ret
+
+000000000000161e <childpidtest>:
+
+void childpidtest() {
+    161e:	55                   	push   %rbp
+    161f:	48 89 e5             	mov    %rsp,%rbp
+  printf(1, "childpidtest\n");
+    1622:	48 8d 05 78 2b 00 00 	lea    0x2b78(%rip),%rax        # 41a1 <benchreport+0x7c7>
+    1629:	48 89 c6             	mov    %rax,%rsi
+    162c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1631:	b8 00 00 00 00       	mov    $0x0,%eax
+    1636:	e8 d2 08 00 00       	call   1f0d <printf>
+  childpidtesthelper(2);
+    163b:	bf 02 00 00 00       	mov    $0x2,%edi
+    1640:	e8 fd fd ff ff       	call   1442 <childpidtesthelper>
+  printf(1, "childpidtest: ok\n");
+    1645:	48 8d 05 63 2b 00 00 	lea    0x2b63(%rip),%rax        # 41af <benchreport+0x7d5>
+    164c:	48 89 c6             	mov    %rax,%rsi
+    164f:	bf 01 00 00 00       	mov    $0x1,%edi
+    1654:	b8 00 00 00 00       	mov    $0x0,%eax
+    1659:	e8 af 08 00 00       	call   1f0d <printf>
+}
+    165e:	90                   	nop
+    165f:	5d                   	pop    %rbp
+    1660:	c3                   	ret
+
+0000000000001661 <exectest>:
+
+void exectest(void) {
+    1661:	55                   	push   %rbp
+    1662:	48 89 e5             	mov    %rsp,%rbp
+    1665:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  printf(1, "exectest\n");
+    166c:	48 8d 05 4e 2b 00 00 	lea    0x2b4e(%rip),%rax        # 41c1 <benchreport+0x7e7>
+    1673:	48 89 c6             	mov    %rax,%rsi
+    1676:	bf 01 00 00 00       	mov    $0x1,%edi
+    167b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1680:	e8 88 08 00 00       	call   1f0d <printf>
+  // exectest arg checking
+  int pid = fork();
+    1685:	e8 a3 0e 00 00       	call   252d <fork>
+    168a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    168d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1691:	79 5c                	jns    16ef <exectest+0x8e>
+    error("exectest: fork failed\n");
+    1693:	8b 05 67 39 00 00    	mov    0x3967(%rip),%eax        # 5000 <stdout>
+    1699:	ba 84 01 00 00       	mov    $0x184,%edx
+    169e:	48 8d 0d 83 24 00 00 	lea    0x2483(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    16a5:	48 89 ce             	mov    %rcx,%rsi
+    16a8:	89 c7                	mov    %eax,%edi
+    16aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    16af:	e8 59 08 00 00       	call   1f0d <printf>
+    16b4:	8b 05 46 39 00 00    	mov    0x3946(%rip),%eax        # 5000 <stdout>
+    16ba:	48 8d 15 0a 2b 00 00 	lea    0x2b0a(%rip),%rdx        # 41cb <benchreport+0x7f1>
+    16c1:	48 89 d6             	mov    %rdx,%rsi
+    16c4:	89 c7                	mov    %eax,%edi
+    16c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    16cb:	e8 3d 08 00 00       	call   1f0d <printf>
+    16d0:	8b 05 2a 39 00 00    	mov    0x392a(%rip),%eax        # 5000 <stdout>
+    16d6:	48 8d 15 86 24 00 00 	lea    0x2486(%rip),%rdx        # 3b63 <benchreport+0x189>
+    16dd:	48 89 d6             	mov    %rdx,%rsi
+    16e0:	89 c7                	mov    %eax,%edi
+    16e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e7:	e8 21 08 00 00       	call   1f0d <printf>
+    16ec:	90                   	nop
+    16ed:	eb fd                	jmp    16ec <exectest+0x8b>
+  }
+  if (pid == 0) {
+    16ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    16f3:	0f 85 18 01 00 00    	jne    1811 <exectest+0x1b0>
+    // test for invalid argv
+    char **argv1 = (char **)0xf00df00d;
+    16f9:	b8 0d f0 0d f0       	mov    $0xf00df00d,%eax
+    16fe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (exec("ls", argv1) != -1)
+    1702:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1706:	48 89 c6             	mov    %rax,%rsi
+    1709:	48 8d 05 d2 2a 00 00 	lea    0x2ad2(%rip),%rax        # 41e2 <benchreport+0x808>
+    1710:	48 89 c7             	mov    %rax,%rdi
+    1713:	e8 33 0e 00 00       	call   254b <exec>
+    1718:	83 f8 ff             	cmp    $0xffffffff,%eax
+    171b:	74 5c                	je     1779 <exectest+0x118>
+      error("exec test: invalid argv\n");
+    171d:	8b 05 dd 38 00 00    	mov    0x38dd(%rip),%eax        # 5000 <stdout>
+    1723:	ba 8a 01 00 00       	mov    $0x18a,%edx
+    1728:	48 8d 0d f9 23 00 00 	lea    0x23f9(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    172f:	48 89 ce             	mov    %rcx,%rsi
+    1732:	89 c7                	mov    %eax,%edi
+    1734:	b8 00 00 00 00       	mov    $0x0,%eax
+    1739:	e8 cf 07 00 00       	call   1f0d <printf>
+    173e:	8b 05 bc 38 00 00    	mov    0x38bc(%rip),%eax        # 5000 <stdout>
+    1744:	48 8d 15 9a 2a 00 00 	lea    0x2a9a(%rip),%rdx        # 41e5 <benchreport+0x80b>
+    174b:	48 89 d6             	mov    %rdx,%rsi
+    174e:	89 c7                	mov    %eax,%edi
+    1750:	b8 00 00 00 00       	mov    $0x0,%eax
+    1755:	e8 b3 07 00 00       	call   1f0d <printf>
+    175a:	8b 05 a0 38 00 00    	mov    0x38a0(%rip),%eax        # 5000 <stdout>
+    1760:	48 8d 15 fc 23 00 00 	lea    0x23fc(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1767:	48 89 d6             	mov    %rdx,%rsi
+    176a:	89 c7                	mov    %eax,%edi
+    176c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1771:	e8 97 07 00 00       	call   1f0d <printf>
+    1776:	90                   	nop
+    1777:	eb fd                	jmp    1776 <exectest+0x115>
+
+    // test for invalid argv[1]
+    char *argv3[] = { "ls", (char *) 0xf00df00d, 0 };
+    1779:	48 8d 05 62 2a 00 00 	lea    0x2a62(%rip),%rax        # 41e2 <benchreport+0x808>
+    1780:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+    1784:	b8 0d f0 0d f0       	mov    $0xf00df00d,%eax
+    1789:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+    178d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+    1794:	00 
+    if (exec("ls", argv3) != -1)
+    1795:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+    1799:	48 89 c6             	mov    %rax,%rsi
+    179c:	48 8d 05 3f 2a 00 00 	lea    0x2a3f(%rip),%rax        # 41e2 <benchreport+0x808>
+    17a3:	48 89 c7             	mov    %rax,%rdi
+    17a6:	e8 a0 0d 00 00       	call   254b <exec>
+    17ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17ae:	74 5c                	je     180c <exectest+0x1ab>
+      error("exec test: argv[1] out of stack\n");
+    17b0:	8b 05 4a 38 00 00    	mov    0x384a(%rip),%eax        # 5000 <stdout>
+    17b6:	ba 8f 01 00 00       	mov    $0x18f,%edx
+    17bb:	48 8d 0d 66 23 00 00 	lea    0x2366(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    17c2:	48 89 ce             	mov    %rcx,%rsi
+    17c5:	89 c7                	mov    %eax,%edi
+    17c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    17cc:	e8 3c 07 00 00       	call   1f0d <printf>
+    17d1:	8b 05 29 38 00 00    	mov    0x3829(%rip),%eax        # 5000 <stdout>
+    17d7:	48 8d 15 22 2a 00 00 	lea    0x2a22(%rip),%rdx        # 4200 <benchreport+0x826>
+    17de:	48 89 d6             	mov    %rdx,%rsi
+    17e1:	89 c7                	mov    %eax,%edi
+    17e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    17e8:	e8 20 07 00 00       	call   1f0d <printf>
+    17ed:	8b 05 0d 38 00 00    	mov    0x380d(%rip),%eax        # 5000 <stdout>
+    17f3:	48 8d 15 69 23 00 00 	lea    0x2369(%rip),%rdx        # 3b63 <benchreport+0x189>
+    17fa:	48 89 d6             	mov    %rdx,%rsi
+    17fd:	89 c7                	mov    %eax,%edi
+    17ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1804:	e8 04 07 00 00       	call   1f0d <printf>
+    1809:	90                   	nop
+    180a:	eb fd                	jmp    1809 <exectest+0x1a8>
+
+    exit();
+    180c:	e8 2c 0d 00 00       	call   253d <exit>
+  } else {
+    if (wait() != pid) {
+    1811:	e8 b6 17 00 00       	call   2fcc <wait>
+    1816:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1819:	74 5c                	je     1877 <exectest+0x216>
+      error("exec test: wait wrong pid");
+    181b:	8b 05 df 37 00 00    	mov    0x37df(%rip),%eax        # 5000 <stdout>
+    1821:	ba 94 01 00 00       	mov    $0x194,%edx
+    1826:	48 8d 0d fb 22 00 00 	lea    0x22fb(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    182d:	48 89 ce             	mov    %rcx,%rsi
+    1830:	89 c7                	mov    %eax,%edi
+    1832:	b8 00 00 00 00       	mov    $0x0,%eax
+    1837:	e8 d1 06 00 00       	call   1f0d <printf>
+    183c:	8b 05 be 37 00 00    	mov    0x37be(%rip),%eax        # 5000 <stdout>
+    1842:	48 8d 15 d8 29 00 00 	lea    0x29d8(%rip),%rdx        # 4221 <benchreport+0x847>
+    1849:	48 89 d6             	mov    %rdx,%rsi
+    184c:	89 c7                	mov    %eax,%edi
+    184e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1853:	e8 b5 06 00 00       	call   1f0d <printf>
+    1858:	8b 05 a2 37 00 00    	mov    0x37a2(%rip),%eax        # 5000 <stdout>
+    185e:	48 8d 15 fe 22 00 00 	lea    0x22fe(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1865:	48 89 d6             	mov    %rdx,%rsi
+    1868:	89 c7                	mov    %eax,%edi
+    186a:	b8 00 00 00 00       	mov    $0x0,%eax
+    186f:	e8 99 06 00 00       	call   1f0d <printf>
+    1874:	90                   	nop
+    1875:	eb fd                	jmp    1874 <exectest+0x213>
+    }
+  }
+	printf(1, "exectest: testing ls\n");
+    1877:	48 8d 05 bd 29 00 00 	lea    0x29bd(%rip),%rax        # 423b <benchreport+0x861>
+    187e:	48 89 c6             	mov    %rax,%rsi
+    1881:	bf 01 00 00 00       	mov    $0x1,%edi
+    1886:	b8 00 00 00 00       	mov    $0x0,%eax
+    188b:	e8 7d 06 00 00       	call   1f0d <printf>
+  pid = fork();
+    1890:	e8 98 0c 00 00       	call   252d <fork>
+    1895:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    1898:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    189c:	79 5c                	jns    18fa <exectest+0x299>
+    error("exectest: fork failed\n");
+    189e:	8b 05 5c 37 00 00    	mov    0x375c(%rip),%eax        # 5000 <stdout>
+    18a4:	ba 9a 01 00 00       	mov    $0x19a,%edx
+    18a9:	48 8d 0d 78 22 00 00 	lea    0x2278(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    18b0:	48 89 ce             	mov    %rcx,%rsi
+    18b3:	89 c7                	mov    %eax,%edi
+    18b5:	b8 00 00 00 00       	mov    $0x0,%eax
+    18ba:	e8 4e 06 00 00       	call   1f0d <printf>
+    18bf:	8b 05 3b 37 00 00    	mov    0x373b(%rip),%eax        # 5000 <stdout>
+    18c5:	48 8d 15 ff 28 00 00 	lea    0x28ff(%rip),%rdx        # 41cb <benchreport+0x7f1>
+    18cc:	48 89 d6             	mov    %rdx,%rsi
+    18cf:	89 c7                	mov    %eax,%edi
+    18d1:	b8 00 00 00 00       	mov    $0x0,%eax
+    18d6:	e8 32 06 00 00       	call   1f0d <printf>
+    18db:	8b 05 1f 37 00 00    	mov    0x371f(%rip),%eax        # 5000 <stdout>
+    18e1:	48 8d 15 7b 22 00 00 	lea    0x227b(%rip),%rdx        # 3b63 <benchreport+0x189>
+    18e8:	48 89 d6             	mov    %rdx,%rsi
+    18eb:	89 c7                	mov    %eax,%edi
+    18ed:	b8 00 00 00 00       	mov    $0x0,%eax
+    18f2:	e8 16 06 00 00       	call   1f0d <printf>
+    18f7:	90                   	nop
+    18f8:	eb fd                	jmp    18f7 <exectest+0x296>
+  }
+  char *argv[] = {"ls", 0};
+    18fa:	48 8d 05 e1 28 00 00 	lea    0x28e1(%rip),%rax        # 41e2 <benchreport+0x808>
+    1901:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1905:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+    190c:	00 
+
+  if (pid == 0) {
+    190d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1911:	75 72                	jne    1985 <exectest+0x324>
+    exec("ls", argv);
+    1913:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+    1917:	48 89 c6             	mov    %rax,%rsi
+    191a:	48 8d 05 c1 28 00 00 	lea    0x28c1(%rip),%rax        # 41e2 <benchreport+0x808>
+    1921:	48 89 c7             	mov    %rax,%rdi
+    1924:	e8 22 0c 00 00       	call   254b <exec>
+    error("exectest: exec ls failed\n");
+    1929:	8b 05 d1 36 00 00    	mov    0x36d1(%rip),%eax        # 5000 <stdout>
+    192f:	ba a0 01 00 00       	mov    $0x1a0,%edx
+    1934:	48 8d 0d ed 21 00 00 	lea    0x21ed(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    193b:	48 89 ce             	mov    %rcx,%rsi
+    193e:	89 c7                	mov    %eax,%edi
+    1940:	b8 00 00 00 00       	mov    $0x0,%eax
+    1945:	e8 c3 05 00 00       	call   1f0d <printf>
+    194a:	8b 05 b0 36 00 00    	mov    0x36b0(%rip),%eax        # 5000 <stdout>
+    1950:	48 8d 15 fa 28 00 00 	lea    0x28fa(%rip),%rdx        # 4251 <benchreport+0x877>
+    1957:	48 89 d6             	mov    %rdx,%rsi
+    195a:	89 c7                	mov    %eax,%edi
+    195c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1961:	e8 a7 05 00 00       	call   1f0d <printf>
+    1966:	8b 05 94 36 00 00    	mov    0x3694(%rip),%eax        # 5000 <stdout>
+    196c:	48 8d 15 f0 21 00 00 	lea    0x21f0(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1973:	48 89 d6             	mov    %rdx,%rsi
+    1976:	89 c7                	mov    %eax,%edi
+    1978:	b8 00 00 00 00       	mov    $0x0,%eax
+    197d:	e8 8b 05 00 00       	call   1f0d <printf>
+    1982:	90                   	nop
+    1983:	eb fd                	jmp    1982 <exectest+0x321>
+  } else {
+    pid = wait();
+    1985:	e8 42 16 00 00       	call   2fcc <wait>
+    198a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  char *echoargv[] = {"echo", "echotest", "ok", 0};
+    198d:	48 8d 05 d7 28 00 00 	lea    0x28d7(%rip),%rax        # 426b <benchreport+0x891>
+    1994:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1998:	48 8d 05 d1 28 00 00 	lea    0x28d1(%rip),%rax        # 4270 <benchreport+0x896>
+    199f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    19a3:	48 8d 05 cf 28 00 00 	lea    0x28cf(%rip),%rax        # 4279 <benchreport+0x89f>
+    19aa:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    19ae:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+    19b5:	00 
+  printf(stdout, "exectest: test argument\n");
+    19b6:	8b 05 44 36 00 00    	mov    0x3644(%rip),%eax        # 5000 <stdout>
+    19bc:	48 8d 15 b9 28 00 00 	lea    0x28b9(%rip),%rdx        # 427c <benchreport+0x8a2>
+    19c3:	48 89 d6             	mov    %rdx,%rsi
+    19c6:	89 c7                	mov    %eax,%edi
+    19c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    19cd:	e8 3b 05 00 00       	call   1f0d <printf>
+
+  int fds[2];
+  assert(pipe(fds) == 0);
+    19d2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+    19d6:	48 89 c7             	mov    %rax,%rdi
+    19d9:	e8 f9 15 00 00       	call   2fd7 <pipe>
+    19de:	85 c0                	test   %eax,%eax
+    19e0:	74 2b                	je     1a0d <exectest+0x3ac>
+    19e2:	8b 05 18 36 00 00    	mov    0x3618(%rip),%eax        # 5000 <stdout>
+    19e8:	48 8d 15 a6 28 00 00 	lea    0x28a6(%rip),%rdx        # 4295 <benchreport+0x8bb>
+    19ef:	48 89 d1             	mov    %rdx,%rcx
+    19f2:	ba a9 01 00 00       	mov    $0x1a9,%edx
+    19f7:	48 8d 35 3a 25 00 00 	lea    0x253a(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    19fe:	89 c7                	mov    %eax,%edi
+    1a00:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a05:	e8 03 05 00 00       	call   1f0d <printf>
+    1a0a:	90                   	nop
+    1a0b:	eb fd                	jmp    1a0a <exectest+0x3a9>
+
+  pid = fork();
+    1a0d:	e8 1b 0b 00 00       	call   252d <fork>
+    1a12:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (pid < 0) {
+    1a15:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1a19:	79 5c                	jns    1a77 <exectest+0x416>
+    error("exectest: fork failed\n");
+    1a1b:	8b 05 df 35 00 00    	mov    0x35df(%rip),%eax        # 5000 <stdout>
+    1a21:	ba ad 01 00 00       	mov    $0x1ad,%edx
+    1a26:	48 8d 0d fb 20 00 00 	lea    0x20fb(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    1a2d:	48 89 ce             	mov    %rcx,%rsi
+    1a30:	89 c7                	mov    %eax,%edi
+    1a32:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a37:	e8 d1 04 00 00       	call   1f0d <printf>
+    1a3c:	8b 05 be 35 00 00    	mov    0x35be(%rip),%eax        # 5000 <stdout>
+    1a42:	48 8d 15 82 27 00 00 	lea    0x2782(%rip),%rdx        # 41cb <benchreport+0x7f1>
+    1a49:	48 89 d6             	mov    %rdx,%rsi
+    1a4c:	89 c7                	mov    %eax,%edi
+    1a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a53:	e8 b5 04 00 00       	call   1f0d <printf>
+    1a58:	8b 05 a2 35 00 00    	mov    0x35a2(%rip),%eax        # 5000 <stdout>
+    1a5e:	48 8d 15 fe 20 00 00 	lea    0x20fe(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1a65:	48 89 d6             	mov    %rdx,%rsi
+    1a68:	89 c7                	mov    %eax,%edi
+    1a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a6f:	e8 99 04 00 00       	call   1f0d <printf>
+    1a74:	90                   	nop
+    1a75:	eb fd                	jmp    1a74 <exectest+0x413>
+  }
+
+  if (pid == 0) {
+    1a77:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1a7b:	0f 85 c0 00 00 00    	jne    1b41 <exectest+0x4e0>
+    // send output to parent.
+    close(stdout);
+    1a81:	8b 05 79 35 00 00    	mov    0x3579(%rip),%eax        # 5000 <stdout>
+    1a87:	89 c7                	mov    %eax,%edi
+    1a89:	e8 19 0b 00 00       	call   25a7 <close>
+    assert(dup(fds[1]) == stdout);
+    1a8e:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1a91:	89 c7                	mov    %eax,%edi
+    1a93:	e8 ce 15 00 00       	call   3066 <dup>
+    1a98:	89 c2                	mov    %eax,%edx
+    1a9a:	8b 05 60 35 00 00    	mov    0x3560(%rip),%eax        # 5000 <stdout>
+    1aa0:	39 c2                	cmp    %eax,%edx
+    1aa2:	74 2b                	je     1acf <exectest+0x46e>
+    1aa4:	8b 05 56 35 00 00    	mov    0x3556(%rip),%eax        # 5000 <stdout>
+    1aaa:	48 8d 15 f3 27 00 00 	lea    0x27f3(%rip),%rdx        # 42a4 <benchreport+0x8ca>
+    1ab1:	48 89 d1             	mov    %rdx,%rcx
+    1ab4:	ba b3 01 00 00       	mov    $0x1b3,%edx
+    1ab9:	48 8d 35 78 24 00 00 	lea    0x2478(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    1ac0:	89 c7                	mov    %eax,%edi
+    1ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ac7:	e8 41 04 00 00       	call   1f0d <printf>
+    1acc:	90                   	nop
+    1acd:	eb fd                	jmp    1acc <exectest+0x46b>
+    exec("echo", echoargv);
+    1acf:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+    1ad3:	48 89 c6             	mov    %rax,%rsi
+    1ad6:	48 8d 05 8e 27 00 00 	lea    0x278e(%rip),%rax        # 426b <benchreport+0x891>
+    1add:	48 89 c7             	mov    %rax,%rdi
+    1ae0:	e8 66 0a 00 00       	call   254b <exec>
+    error("exectest: exec echo failed\n");
+    1ae5:	8b 05 15 35 00 00    	mov    0x3515(%rip),%eax        # 5000 <stdout>
+    1aeb:	ba b5 01 00 00       	mov    $0x1b5,%edx
+    1af0:	48 8d 0d 31 20 00 00 	lea    0x2031(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    1af7:	48 89 ce             	mov    %rcx,%rsi
+    1afa:	89 c7                	mov    %eax,%edi
+    1afc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b01:	e8 07 04 00 00       	call   1f0d <printf>
+    1b06:	8b 05 f4 34 00 00    	mov    0x34f4(%rip),%eax        # 5000 <stdout>
+    1b0c:	48 8d 15 a7 27 00 00 	lea    0x27a7(%rip),%rdx        # 42ba <benchreport+0x8e0>
+    1b13:	48 89 d6             	mov    %rdx,%rsi
+    1b16:	89 c7                	mov    %eax,%edi
+    1b18:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b1d:	e8 eb 03 00 00       	call   1f0d <printf>
+    1b22:	8b 05 d8 34 00 00    	mov    0x34d8(%rip),%eax        # 5000 <stdout>
+    1b28:	48 8d 15 34 20 00 00 	lea    0x2034(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1b2f:	48 89 d6             	mov    %rdx,%rsi
+    1b32:	89 c7                	mov    %eax,%edi
+    1b34:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b39:	e8 cf 03 00 00       	call   1f0d <printf>
+    1b3e:	90                   	nop
+    1b3f:	eb fd                	jmp    1b3e <exectest+0x4dd>
+  } else {
+    assert(wait() == pid);
+    1b41:	e8 86 14 00 00       	call   2fcc <wait>
+    1b46:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1b49:	74 2b                	je     1b76 <exectest+0x515>
+    1b4b:	8b 05 af 34 00 00    	mov    0x34af(%rip),%eax        # 5000 <stdout>
+    1b51:	48 8d 15 7e 27 00 00 	lea    0x277e(%rip),%rdx        # 42d6 <benchreport+0x8fc>
+    1b58:	48 89 d1             	mov    %rdx,%rcx
+    1b5b:	ba b7 01 00 00       	mov    $0x1b7,%edx
+    1b60:	48 8d 35 d1 23 00 00 	lea    0x23d1(%rip),%rsi        # 3f38 <benchreport+0x55e>
+    1b67:	89 c7                	mov    %eax,%edi
+    1b69:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b6e:	e8 9a 03 00 00       	call   1f0d <printf>
+    1b73:	90                   	nop
+    1b74:	eb fd                	jmp    1b73 <exectest+0x512>
+
+    // read output from child.
+    printf(stdout, "exectest: test output\n");
+    1b76:	8b 05 84 34 00 00    	mov    0x3484(%rip),%eax        # 5000 <stdout>
+    1b7c:	48 8d 15 61 27 00 00 	lea    0x2761(%rip),%rdx        # 42e4 <benchreport+0x90a>
+    1b83:	48 89 d6             	mov    %rdx,%rsi
+    1b86:	89 c7                	mov    %eax,%edi
+    1b88:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b8d:	e8 7b 03 00 00       	call   1f0d <printf>
+    close(fds[1]); // close write end, read until EOF
+    1b92:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1b95:	89 c7                	mov    %eax,%edi
+    1b97:	e8 0b 0a 00 00       	call   25a7 <close>
+    char buf[16];
+    char *expected = "echotest ok\n";
+    1b9c:	48 8d 05 58 27 00 00 	lea    0x2758(%rip),%rax        # 42fb <benchreport+0x921>
+    1ba3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+    int byte_to_read = 15;
+    1ba7:	c7 45 fc 0f 00 00 00 	movl   $0xf,-0x4(%rbp)
+    int count = 0;
+    1bae:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    while (count < 12) {
+    1bb5:	e9 97 00 00 00       	jmp    1c51 <exectest+0x5f0>
+      int ret = read(fds[0], buf + count, byte_to_read);
+    1bba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1bbd:	48 98                	cltq
+    1bbf:	48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    1bc6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1bca:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1bcd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1bd0:	48 89 ce             	mov    %rcx,%rsi
+    1bd3:	89 c7                	mov    %eax,%edi
+    1bd5:	e8 08 14 00 00       	call   2fe2 <read>
+    1bda:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+      if (ret == 0 || ret == -1)
+    1bdd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    1be1:	74 06                	je     1be9 <exectest+0x588>
+    1be3:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%rbp)
+    1be7:	75 5c                	jne    1c45 <exectest+0x5e4>
+        error("exectest: exec echotest no output");
+    1be9:	8b 05 11 34 00 00    	mov    0x3411(%rip),%eax        # 5000 <stdout>
+    1bef:	ba c4 01 00 00       	mov    $0x1c4,%edx
+    1bf4:	48 8d 0d 2d 1f 00 00 	lea    0x1f2d(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    1bfb:	48 89 ce             	mov    %rcx,%rsi
+    1bfe:	89 c7                	mov    %eax,%edi
+    1c00:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c05:	e8 03 03 00 00       	call   1f0d <printf>
+    1c0a:	8b 05 f0 33 00 00    	mov    0x33f0(%rip),%eax        # 5000 <stdout>
+    1c10:	48 8d 15 f1 26 00 00 	lea    0x26f1(%rip),%rdx        # 4308 <benchreport+0x92e>
+    1c17:	48 89 d6             	mov    %rdx,%rsi
+    1c1a:	89 c7                	mov    %eax,%edi
+    1c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c21:	e8 e7 02 00 00       	call   1f0d <printf>
+    1c26:	8b 05 d4 33 00 00    	mov    0x33d4(%rip),%eax        # 5000 <stdout>
+    1c2c:	48 8d 15 30 1f 00 00 	lea    0x1f30(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1c33:	48 89 d6             	mov    %rdx,%rsi
+    1c36:	89 c7                	mov    %eax,%edi
+    1c38:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c3d:	e8 cb 02 00 00       	call   1f0d <printf>
+    1c42:	90                   	nop
+    1c43:	eb fd                	jmp    1c42 <exectest+0x5e1>
+      byte_to_read -= ret;
+    1c45:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1c48:	29 45 fc             	sub    %eax,-0x4(%rbp)
+      count += ret;
+    1c4b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1c4e:	01 45 f8             	add    %eax,-0x8(%rbp)
+    while (count < 12) {
+    1c51:	83 7d f8 0b          	cmpl   $0xb,-0x8(%rbp)
+    1c55:	0f 8e 5f ff ff ff    	jle    1bba <exectest+0x559>
+    }
+
+    buf[count] = 0;
+    1c5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1c5e:	48 98                	cltq
+    1c60:	c6 84 05 78 ff ff ff 	movb   $0x0,-0x88(%rbp,%rax,1)
+    1c67:	00 
+    if (strcmp(buf, expected) != 0) {
+    1c68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c6c:	48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+    1c73:	48 89 d6             	mov    %rdx,%rsi
+    1c76:	48 89 c7             	mov    %rax,%rdi
+    1c79:	e8 c2 0b 00 00       	call   2840 <strcmp>
+    1c7e:	85 c0                	test   %eax,%eax
+    1c80:	0f 84 94 00 00 00    	je     1d1a <exectest+0x6b9>
+      printf(stdout, "exectest: bad output:\n");
+    1c86:	8b 05 74 33 00 00    	mov    0x3374(%rip),%eax        # 5000 <stdout>
+    1c8c:	48 8d 15 97 26 00 00 	lea    0x2697(%rip),%rdx        # 432a <benchreport+0x950>
+    1c93:	48 89 d6             	mov    %rdx,%rsi
+    1c96:	89 c7                	mov    %eax,%edi
+    1c98:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c9d:	e8 6b 02 00 00       	call   1f0d <printf>
+      printf(stdout, buf);
+    1ca2:	8b 05 58 33 00 00    	mov    0x3358(%rip),%eax        # 5000 <stdout>
+    1ca8:	48 8d 95 78 ff ff ff 	lea    -0x88(%rbp),%rdx
+    1caf:	48 89 d6             	mov    %rdx,%rsi
+    1cb2:	89 c7                	mov    %eax,%edi
+    1cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cb9:	e8 4f 02 00 00       	call   1f0d <printf>
+      error("exectest: output test failed");
+    1cbe:	8b 05 3c 33 00 00    	mov    0x333c(%rip),%eax        # 5000 <stdout>
+    1cc4:	ba cd 01 00 00       	mov    $0x1cd,%edx
+    1cc9:	48 8d 0d 58 1e 00 00 	lea    0x1e58(%rip),%rcx        # 3b28 <benchreport+0x14e>
+    1cd0:	48 89 ce             	mov    %rcx,%rsi
+    1cd3:	89 c7                	mov    %eax,%edi
+    1cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cda:	e8 2e 02 00 00       	call   1f0d <printf>
+    1cdf:	8b 05 1b 33 00 00    	mov    0x331b(%rip),%eax        # 5000 <stdout>
+    1ce5:	48 8d 15 55 26 00 00 	lea    0x2655(%rip),%rdx        # 4341 <benchreport+0x967>
+    1cec:	48 89 d6             	mov    %rdx,%rsi
+    1cef:	89 c7                	mov    %eax,%edi
+    1cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cf6:	e8 12 02 00 00       	call   1f0d <printf>
+    1cfb:	8b 05 ff 32 00 00    	mov    0x32ff(%rip),%eax        # 5000 <stdout>
+    1d01:	48 8d 15 5b 1e 00 00 	lea    0x1e5b(%rip),%rdx        # 3b63 <benchreport+0x189>
+    1d08:	48 89 d6             	mov    %rdx,%rsi
+    1d0b:	89 c7                	mov    %eax,%edi
+    1d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d12:	e8 f6 01 00 00       	call   1f0d <printf>
+    1d17:	90                   	nop
+    1d18:	eb fd                	jmp    1d17 <exectest+0x6b6>
+    }
+    printf(stdout, expected);
+    1d1a:	8b 05 e0 32 00 00    	mov    0x32e0(%rip),%eax        # 5000 <stdout>
+    1d20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1d24:	48 89 d6             	mov    %rdx,%rsi
+    1d27:	89 c7                	mov    %eax,%edi
+    1d29:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d2e:	e8 da 01 00 00       	call   1f0d <printf>
+  }
+
+  printf(1, "exectest: ok\n");
+    1d33:	48 8d 05 24 26 00 00 	lea    0x2624(%rip),%rax        # 435e <benchreport+0x984>
+    1d3a:	48 89 c6             	mov    %rax,%rsi
+    1d3d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1d42:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d47:	e8 c1 01 00 00       	call   1f0d <printf>
+}
+    1d4c:	90                   	nop
+    1d4d:	c9                   	leave
+    1d4e:	c3                   	ret
+
+0000000000001d4f <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    1d4f:	55                   	push   %rbp
+    1d50:	48 89 e5             	mov    %rsp,%rbp
+    1d53:	48 83 ec 10          	sub    $0x10,%rsp
+    1d57:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1d5a:	89 f0                	mov    %esi,%eax
+    1d5c:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1d5f:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    1d63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d66:	89 d6                	mov    %edx,%esi
+    1d68:	89 c7                	mov    %eax,%edi
+    1d6a:	e8 eb 06 00 00       	call   245a <bputc>
+    1d6f:	90                   	nop
+    1d70:	c9                   	leave
+    1d71:	c3                   	ret
+
+0000000000001d72 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    1d72:	55                   	push   %rbp
+    1d73:	48 89 e5             	mov    %rsp,%rbp
+    1d76:	48 83 ec 50          	sub    $0x50,%rsp
+    1d7a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1d7d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1d81:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    1d84:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    1d87:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1d8b:	74 21                	je     1dae <printint64+0x3c>
+    1d8d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1d91:	48 c1 e8 3f          	shr    $0x3f,%rax
+    1d95:	0f b6 c0             	movzbl %al,%eax
+    1d98:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    1d9b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1d9f:	74 0d                	je     1dae <printint64+0x3c>
+    x = -xx;
+    1da1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1da5:	48 f7 d8             	neg    %rax
+    1da8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1dac:	eb 08                	jmp    1db6 <printint64+0x44>
+  else
+    x = xx;
+    1dae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1db2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1db6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1dbd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1dc0:	48 63 c8             	movslq %eax,%rcx
+    1dc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dc7:	ba 00 00 00 00       	mov    $0x0,%edx
+    1dcc:	48 f7 f1             	div    %rcx
+    1dcf:	48 89 d1             	mov    %rdx,%rcx
+    1dd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dd5:	8d 50 01             	lea    0x1(%rax),%edx
+    1dd8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ddb:	48 8d 15 2e 32 00 00 	lea    0x322e(%rip),%rdx        # 5010 <digits.1>
+    1de2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1de6:	48 98                	cltq
+    1de8:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1dec:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1def:	48 63 f0             	movslq %eax,%rsi
+    1df2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1df6:	ba 00 00 00 00       	mov    $0x0,%edx
+    1dfb:	48 f7 f6             	div    %rsi
+    1dfe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1e02:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1e07:	75 b4                	jne    1dbd <printint64+0x4b>
+
+  if (sgn)
+    1e09:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1e0d:	74 2b                	je     1e3a <printint64+0xc8>
+    buf[i++] = '-';
+    1e0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e12:	8d 50 01             	lea    0x1(%rax),%edx
+    1e15:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1e18:	48 98                	cltq
+    1e1a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1e1f:	eb 19                	jmp    1e3a <printint64+0xc8>
+    putc(fd, buf[i]);
+    1e21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e24:	48 98                	cltq
+    1e26:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    1e2b:	0f be d0             	movsbl %al,%edx
+    1e2e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1e31:	89 d6                	mov    %edx,%esi
+    1e33:	89 c7                	mov    %eax,%edi
+    1e35:	e8 15 ff ff ff       	call   1d4f <putc>
+  while (--i >= 0)
+    1e3a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1e3e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1e42:	79 dd                	jns    1e21 <printint64+0xaf>
+}
+    1e44:	90                   	nop
+    1e45:	90                   	nop
+    1e46:	c9                   	leave
+    1e47:	c3                   	ret
+
+0000000000001e48 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1e48:	55                   	push   %rbp
+    1e49:	48 89 e5             	mov    %rsp,%rbp
+    1e4c:	48 83 ec 30          	sub    $0x30,%rsp
+    1e50:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1e53:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1e56:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1e59:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1e5c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1e63:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1e67:	74 17                	je     1e80 <printint+0x38>
+    1e69:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1e6d:	79 11                	jns    1e80 <printint+0x38>
+    neg = 1;
+    1e6f:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1e76:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1e79:	f7 d8                	neg    %eax
+    1e7b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1e7e:	eb 06                	jmp    1e86 <printint+0x3e>
+  } else {
+    x = xx;
+    1e80:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1e83:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1e86:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1e8d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1e90:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1e93:	ba 00 00 00 00       	mov    $0x0,%edx
+    1e98:	f7 f1                	div    %ecx
+    1e9a:	89 d1                	mov    %edx,%ecx
+    1e9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e9f:	8d 50 01             	lea    0x1(%rax),%edx
+    1ea2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ea5:	89 c9                	mov    %ecx,%ecx
+    1ea7:	48 8d 15 82 31 00 00 	lea    0x3182(%rip),%rdx        # 5030 <digits.0>
+    1eae:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1eb2:	48 98                	cltq
+    1eb4:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1eb8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1ebb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+    1ec3:	f7 f6                	div    %esi
+    1ec5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1ec8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1ecc:	75 bf                	jne    1e8d <printint+0x45>
+  if (neg)
+    1ece:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1ed2:	74 2b                	je     1eff <printint+0xb7>
+    buf[i++] = '-';
+    1ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ed7:	8d 50 01             	lea    0x1(%rax),%edx
+    1eda:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1edd:	48 98                	cltq
+    1edf:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1ee4:	eb 19                	jmp    1eff <printint+0xb7>
+    putc(fd, buf[i]);
+    1ee6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ee9:	48 98                	cltq
+    1eeb:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1ef0:	0f be d0             	movsbl %al,%edx
+    1ef3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ef6:	89 d6                	mov    %edx,%esi
+    1ef8:	89 c7                	mov    %eax,%edi
+    1efa:	e8 50 fe ff ff       	call   1d4f <putc>
+  while (--i >= 0)
+    1eff:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1f03:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1f07:	79 dd                	jns    1ee6 <printint+0x9e>
+}
+    1f09:	90                   	nop
+    1f0a:	90                   	nop
+    1f0b:	c9                   	leave
+    1f0c:	c3                   	ret
+
+0000000000001f0d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1f0d:	55                   	push   %rbp
+    1f0e:	48 89 e5             	mov    %rsp,%rbp
+    1f11:	48 83 ec 70          	sub    $0x70,%rsp
+    1f15:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1f18:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1f1c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1f20:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1f24:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1f28:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1f2c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1f33:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1f37:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1f3b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1f3f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1f43:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1f4a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1f51:	e9 67 02 00 00       	jmp    21bd <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    1f56:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1f59:	48 63 d0             	movslq %eax,%rdx
+    1f5c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1f60:	48 01 d0             	add    %rdx,%rax
+    1f63:	0f b6 00             	movzbl (%rax),%eax
+    1f66:	0f be c0             	movsbl %al,%eax
+    1f69:	25 ff 00 00 00       	and    $0xff,%eax
+    1f6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1f71:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1f75:	75 30                	jne    1fa7 <printf+0x9a>
+      if (c == '%') {
+    1f77:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1f7b:	75 13                	jne    1f90 <printf+0x83>
+        state = '%';
+    1f7d:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1f84:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1f8b:	e9 29 02 00 00       	jmp    21b9 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    1f90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1f93:	0f be d0             	movsbl %al,%edx
+    1f96:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1f99:	89 d6                	mov    %edx,%esi
+    1f9b:	89 c7                	mov    %eax,%edi
+    1f9d:	e8 ad fd ff ff       	call   1d4f <putc>
+    1fa2:	e9 12 02 00 00       	jmp    21b9 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    1fa7:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1fab:	0f 85 08 02 00 00    	jne    21b9 <printf+0x2ac>
+      if (c == 'l') {
+    1fb1:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1fb5:	75 0c                	jne    1fc3 <printf+0xb6>
+        lflag = 1;
+    1fb7:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1fbe:	e9 f6 01 00 00       	jmp    21b9 <printf+0x2ac>
+      } else if (c == 'd') {
+    1fc3:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1fc7:	0f 85 93 00 00 00    	jne    2060 <printf+0x153>
+        if (lflag == 1)
+    1fcd:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1fd1:	75 47                	jne    201a <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1fd3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1fd6:	83 f8 2f             	cmp    $0x2f,%eax
+    1fd9:	77 17                	ja     1ff2 <printf+0xe5>
+    1fdb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1fdf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fe2:	89 d2                	mov    %edx,%edx
+    1fe4:	48 01 d0             	add    %rdx,%rax
+    1fe7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1fea:	83 c2 08             	add    $0x8,%edx
+    1fed:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1ff0:	eb 0c                	jmp    1ffe <printf+0xf1>
+    1ff2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1ff6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ffa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1ffe:	48 8b 30             	mov    (%rax),%rsi
+    2001:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2004:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2009:	ba 0a 00 00 00       	mov    $0xa,%edx
+    200e:	89 c7                	mov    %eax,%edi
+    2010:	e8 5d fd ff ff       	call   1d72 <printint64>
+    2015:	e9 98 01 00 00       	jmp    21b2 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    201a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    201d:	83 f8 2f             	cmp    $0x2f,%eax
+    2020:	77 17                	ja     2039 <printf+0x12c>
+    2022:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2026:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2029:	89 d2                	mov    %edx,%edx
+    202b:	48 01 d0             	add    %rdx,%rax
+    202e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2031:	83 c2 08             	add    $0x8,%edx
+    2034:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2037:	eb 0c                	jmp    2045 <printf+0x138>
+    2039:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    203d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2041:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2045:	8b 30                	mov    (%rax),%esi
+    2047:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    204a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    204f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2054:	89 c7                	mov    %eax,%edi
+    2056:	e8 ed fd ff ff       	call   1e48 <printint>
+    205b:	e9 52 01 00 00       	jmp    21b2 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    2060:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    2064:	74 0a                	je     2070 <printf+0x163>
+    2066:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    206a:	0f 85 93 00 00 00    	jne    2103 <printf+0x1f6>
+        if (lflag == 1)
+    2070:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2074:	75 47                	jne    20bd <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    2076:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2079:	83 f8 2f             	cmp    $0x2f,%eax
+    207c:	77 17                	ja     2095 <printf+0x188>
+    207e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2082:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2085:	89 d2                	mov    %edx,%edx
+    2087:	48 01 d0             	add    %rdx,%rax
+    208a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    208d:	83 c2 08             	add    $0x8,%edx
+    2090:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2093:	eb 0c                	jmp    20a1 <printf+0x194>
+    2095:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2099:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    209d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    20a1:	48 8b 30             	mov    (%rax),%rsi
+    20a4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    20a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    20ac:	ba 10 00 00 00       	mov    $0x10,%edx
+    20b1:	89 c7                	mov    %eax,%edi
+    20b3:	e8 ba fc ff ff       	call   1d72 <printint64>
+        if (lflag == 1)
+    20b8:	e9 f5 00 00 00       	jmp    21b2 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    20bd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    20c0:	83 f8 2f             	cmp    $0x2f,%eax
+    20c3:	77 17                	ja     20dc <printf+0x1cf>
+    20c5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    20c9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    20cc:	89 d2                	mov    %edx,%edx
+    20ce:	48 01 d0             	add    %rdx,%rax
+    20d1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    20d4:	83 c2 08             	add    $0x8,%edx
+    20d7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    20da:	eb 0c                	jmp    20e8 <printf+0x1db>
+    20dc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    20e0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    20e4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    20e8:	8b 30                	mov    (%rax),%esi
+    20ea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    20ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+    20f2:	ba 10 00 00 00       	mov    $0x10,%edx
+    20f7:	89 c7                	mov    %eax,%edi
+    20f9:	e8 4a fd ff ff       	call   1e48 <printint>
+        if (lflag == 1)
+    20fe:	e9 af 00 00 00       	jmp    21b2 <printf+0x2a5>
+      } else if (c == 's') {
+    2103:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    2107:	75 6e                	jne    2177 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    2109:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    210c:	83 f8 2f             	cmp    $0x2f,%eax
+    210f:	77 17                	ja     2128 <printf+0x21b>
+    2111:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2115:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2118:	89 d2                	mov    %edx,%edx
+    211a:	48 01 d0             	add    %rdx,%rax
+    211d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2120:	83 c2 08             	add    $0x8,%edx
+    2123:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2126:	eb 0c                	jmp    2134 <printf+0x227>
+    2128:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    212c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2130:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2134:	48 8b 00             	mov    (%rax),%rax
+    2137:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    213b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    2140:	75 28                	jne    216a <printf+0x25d>
+          s = "(null)";
+    2142:	48 8d 05 23 22 00 00 	lea    0x2223(%rip),%rax        # 436c <benchreport+0x992>
+    2149:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    214d:	eb 1b                	jmp    216a <printf+0x25d>
+          putc(fd, *s);
+    214f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2153:	0f b6 00             	movzbl (%rax),%eax
+    2156:	0f be d0             	movsbl %al,%edx
+    2159:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    215c:	89 d6                	mov    %edx,%esi
+    215e:	89 c7                	mov    %eax,%edi
+    2160:	e8 ea fb ff ff       	call   1d4f <putc>
+        for (; *s; s++)
+    2165:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    216a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    216e:	0f b6 00             	movzbl (%rax),%eax
+    2171:	84 c0                	test   %al,%al
+    2173:	75 da                	jne    214f <printf+0x242>
+    2175:	eb 3b                	jmp    21b2 <printf+0x2a5>
+      } else if (c == '%') {
+    2177:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    217b:	75 14                	jne    2191 <printf+0x284>
+        putc(fd, c);
+    217d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2180:	0f be d0             	movsbl %al,%edx
+    2183:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2186:	89 d6                	mov    %edx,%esi
+    2188:	89 c7                	mov    %eax,%edi
+    218a:	e8 c0 fb ff ff       	call   1d4f <putc>
+    218f:	eb 21                	jmp    21b2 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    2191:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2194:	be 25 00 00 00       	mov    $0x25,%esi
+    2199:	89 c7                	mov    %eax,%edi
+    219b:	e8 af fb ff ff       	call   1d4f <putc>
+        putc(fd, c);
+    21a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    21a3:	0f be d0             	movsbl %al,%edx
+    21a6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    21a9:	89 d6                	mov    %edx,%esi
+    21ab:	89 c7                	mov    %eax,%edi
+    21ad:	e8 9d fb ff ff       	call   1d4f <putc>
+      }
+      state = 0;
+    21b2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    21b9:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    21bd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    21c0:	48 63 d0             	movslq %eax,%rdx
+    21c3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    21c7:	48 01 d0             	add    %rdx,%rax
+    21ca:	0f b6 00             	movzbl (%rax),%eax
+    21cd:	84 c0                	test   %al,%al
+    21cf:	0f 85 81 fd ff ff    	jne    1f56 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    21d5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    21d8:	89 c7                	mov    %eax,%edi
+    21da:	e8 ee 02 00 00       	call   24cd <bflushtty>
+}
+    21df:	90                   	nop
+    21e0:	c9                   	leave
+    21e1:	c3                   	ret
+
+00000000000021e2 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    21e2:	55                   	push   %rbp
+    21e3:	48 89 e5             	mov    %rsp,%rbp
+    21e6:	48 83 ec 30          	sub    $0x30,%rsp
+    21ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    21ed:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    21f1:	78 06                	js     21f9 <getbuf+0x17>
+    21f3:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    21f7:	7e 0a                	jle    2203 <getbuf+0x21>
+    return 0;
+    21f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    21fe:	e9 94 00 00 00       	jmp    2297 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    2203:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2206:	48 98                	cltq
+    2208:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    220f:	00 
+    2210:	48 8d 05 49 2e 00 00 	lea    0x2e49(%rip),%rax        # 5060 <obufs>
+    2217:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    221b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    221f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2224:	75 6d                	jne    2293 <getbuf+0xb1>
+    2226:	bf 08 02 00 00       	mov    $0x208,%edi
+    222b:	e8 bd 13 00 00       	call   35ed <malloc>
+    2230:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2234:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2239:	74 58                	je     2293 <getbuf+0xb1>
+    b->n = 0;
+    223b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    223f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    2245:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    2249:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    224c:	48 89 d6             	mov    %rdx,%rsi
+    224f:	89 c7                	mov    %eax,%edi
+    2251:	e8 e4 0d 00 00       	call   303a <fstat>
+    2256:	85 c0                	test   %eax,%eax
+    2258:	75 11                	jne    226b <getbuf+0x89>
+    225a:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    225e:	66 83 f8 03          	cmp    $0x3,%ax
+    2262:	75 07                	jne    226b <getbuf+0x89>
+    2264:	ba 01 00 00 00       	mov    $0x1,%edx
+    2269:	eb 05                	jmp    2270 <getbuf+0x8e>
+    226b:	ba 00 00 00 00       	mov    $0x0,%edx
+    2270:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2274:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    2277:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    227a:	48 98                	cltq
+    227c:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2283:	00 
+    2284:	48 8d 15 d5 2d 00 00 	lea    0x2dd5(%rip),%rdx        # 5060 <obufs>
+    228b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    228f:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    2293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2297:	c9                   	leave
+    2298:	c3                   	ret
+
+0000000000002299 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    2299:	55                   	push   %rbp
+    229a:	48 89 e5             	mov    %rsp,%rbp
+    229d:	48 83 ec 20          	sub    $0x20,%rsp
+    22a1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    22a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    22a8:	78 33                	js     22dd <bflush+0x44>
+    22aa:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    22ae:	7f 2d                	jg     22dd <bflush+0x44>
+    22b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    22b3:	48 98                	cltq
+    22b5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22bc:	00 
+    22bd:	48 8d 05 9c 2d 00 00 	lea    0x2d9c(%rip),%rax        # 5060 <obufs>
+    22c4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    22c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    22cc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    22d1:	74 0a                	je     22dd <bflush+0x44>
+    22d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22d7:	8b 00                	mov    (%rax),%eax
+    22d9:	85 c0                	test   %eax,%eax
+    22db:	75 07                	jne    22e4 <bflush+0x4b>
+    return 0;
+    22dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    22e2:	eb 3c                	jmp    2320 <bflush+0x87>
+  n = b->n;
+    22e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22e8:	8b 00                	mov    (%rax),%eax
+    22ea:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    22ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22f1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    22f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    22fb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    22ff:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2302:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2305:	48 89 ce             	mov    %rcx,%rsi
+    2308:	89 c7                	mov    %eax,%edi
+    230a:	e8 de 0c 00 00       	call   2fed <write>
+    230f:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    2312:	75 07                	jne    231b <bflush+0x82>
+    2314:	b8 00 00 00 00       	mov    $0x0,%eax
+    2319:	eb 05                	jmp    2320 <bflush+0x87>
+    231b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    2320:	c9                   	leave
+    2321:	c3                   	ret
+
+0000000000002322 <bflushall>:
+
+void bflushall(void) {
+    2322:	55                   	push   %rbp
+    2323:	48 89 e5             	mov    %rsp,%rbp
+    2326:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    232a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2331:	eb 0e                	jmp    2341 <bflushall+0x1f>
+    bflush(fd);
+    2333:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2336:	89 c7                	mov    %eax,%edi
+    2338:	e8 5c ff ff ff       	call   2299 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    233d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2341:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    2345:	7e ec                	jle    2333 <bflushall+0x11>
+}
+    2347:	90                   	nop
+    2348:	90                   	nop
+    2349:	c9                   	leave
+    234a:	c3                   	ret
+
+000000000000234b <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    234b:	55                   	push   %rbp
+    234c:	48 89 e5             	mov    %rsp,%rbp
+    234f:	48 83 ec 30          	sub    $0x30,%rsp
+    2353:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    2356:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    235a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    235d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2360:	89 c7                	mov    %eax,%edi
+    2362:	e8 7b fe ff ff       	call   21e2 <getbuf>
+    2367:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    236b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2370:	75 19                	jne    238b <bwrite+0x40>
+    return write(fd, s, n);
+    2372:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    2375:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    2379:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    237c:	48 89 ce             	mov    %rcx,%rsi
+    237f:	89 c7                	mov    %eax,%edi
+    2381:	e8 67 0c 00 00       	call   2fed <write>
+    2386:	e9 cd 00 00 00       	jmp    2458 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    238b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2392:	e9 92 00 00 00       	jmp    2429 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    2397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    239b:	8b 00                	mov    (%rax),%eax
+    239d:	3d 00 02 00 00       	cmp    $0x200,%eax
+    23a2:	75 18                	jne    23bc <bwrite+0x71>
+    23a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    23a7:	89 c7                	mov    %eax,%edi
+    23a9:	e8 eb fe ff ff       	call   2299 <bflush>
+    23ae:	85 c0                	test   %eax,%eax
+    23b0:	79 0a                	jns    23bc <bwrite+0x71>
+      return -1;
+    23b2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    23b7:	e9 9c 00 00 00       	jmp    2458 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    23bc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    23bf:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    23c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    23c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23c9:	8b 00                	mov    (%rax),%eax
+    23cb:	ba 00 02 00 00       	mov    $0x200,%edx
+    23d0:	29 c2                	sub    %eax,%edx
+    23d2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    23d5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    23d8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    23db:	39 c2                	cmp    %eax,%edx
+    23dd:	0f 4e c2             	cmovle %edx,%eax
+    23e0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    23e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    23e6:	48 63 d0             	movslq %eax,%rdx
+    23e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    23ed:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    23f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23f5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    23f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23fd:	8b 00                	mov    (%rax),%eax
+    23ff:	48 98                	cltq
+    2401:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2405:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2408:	89 c2                	mov    %eax,%edx
+    240a:	48 89 cf             	mov    %rcx,%rdi
+    240d:	e8 e9 06 00 00       	call   2afb <memmove>
+    b->n += m;
+    2412:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2416:	8b 10                	mov    (%rax),%edx
+    2418:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    241b:	01 c2                	add    %eax,%edx
+    241d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2421:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    2423:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2426:	01 45 fc             	add    %eax,-0x4(%rbp)
+    2429:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    242c:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    242f:	0f 8c 62 ff ff ff    	jl     2397 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    2435:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2439:	8b 40 04             	mov    0x4(%rax),%eax
+    243c:	85 c0                	test   %eax,%eax
+    243e:	74 15                	je     2455 <bwrite+0x10a>
+    2440:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2443:	89 c7                	mov    %eax,%edi
+    2445:	e8 4f fe ff ff       	call   2299 <bflush>
+    244a:	85 c0                	test   %eax,%eax
+    244c:	79 07                	jns    2455 <bwrite+0x10a>
+    return -1;
+    244e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2453:	eb 03                	jmp    2458 <bwrite+0x10d>
+  return n;
+    2455:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    2458:	c9                   	leave
+    2459:	c3                   	ret
+
+000000000000245a <bputc>:
+
+void bputc(int fd, char c) {
+    245a:	55                   	push   %rbp
+    245b:	48 89 e5             	mov    %rsp,%rbp
+    245e:	48 83 ec 20          	sub    $0x20,%rsp
+    2462:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2465:	89 f0                	mov    %esi,%eax
+    2467:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    246a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    246d:	89 c7                	mov    %eax,%edi
+    246f:	e8 6e fd ff ff       	call   21e2 <getbuf>
+    2474:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2478:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    247d:	75 18                	jne    2497 <bputc+0x3d>
+    write(fd, &c, 1);
+    247f:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    2483:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2486:	ba 01 00 00 00       	mov    $0x1,%edx
+    248b:	48 89 ce             	mov    %rcx,%rsi
+    248e:	89 c7                	mov    %eax,%edi
+    2490:	e8 58 0b 00 00       	call   2fed <write>
+    return;
+    2495:	eb 34                	jmp    24cb <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    2497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    249b:	8b 00                	mov    (%rax),%eax
+    249d:	3d 00 02 00 00       	cmp    $0x200,%eax
+    24a2:	75 0a                	jne    24ae <bputc+0x54>
+    bflush(fd);
+    24a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    24a7:	89 c7                	mov    %eax,%edi
+    24a9:	e8 eb fd ff ff       	call   2299 <bflush>
+  b->data[b->n++] = c;
+    24ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    24b2:	8b 00                	mov    (%rax),%eax
+    24b4:	8d 48 01             	lea    0x1(%rax),%ecx
+    24b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    24bb:	89 0a                	mov    %ecx,(%rdx)
+    24bd:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    24c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    24c5:	48 98                	cltq
+    24c7:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    24cb:	c9                   	leave
+    24cc:	c3                   	ret
+
+00000000000024cd <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    24cd:	55                   	push   %rbp
+    24ce:	48 89 e5             	mov    %rsp,%rbp
+    24d1:	48 83 ec 10          	sub    $0x10,%rsp
+    24d5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    24d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    24dc:	78 4c                	js     252a <bflushtty+0x5d>
+    24de:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    24e2:	7f 46                	jg     252a <bflushtty+0x5d>
+    24e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    24e7:	48 98                	cltq
+    24e9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    24f0:	00 
+    24f1:	48 8d 05 68 2b 00 00 	lea    0x2b68(%rip),%rax        # 5060 <obufs>
+    24f8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    24fc:	48 85 c0             	test   %rax,%rax
+    24ff:	74 29                	je     252a <bflushtty+0x5d>
+    2501:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2504:	48 98                	cltq
+    2506:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    250d:	00 
+    250e:	48 8d 05 4b 2b 00 00 	lea    0x2b4b(%rip),%rax        # 5060 <obufs>
+    2515:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2519:	8b 40 04             	mov    0x4(%rax),%eax
+    251c:	85 c0                	test   %eax,%eax
+    251e:	74 0a                	je     252a <bflushtty+0x5d>
+    bflush(fd);
+    2520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2523:	89 c7                	mov    %eax,%edi
+    2525:	e8 6f fd ff ff       	call   2299 <bflush>
+}
+    252a:	90                   	nop
+    252b:	c9                   	leave
+    252c:	c3                   	ret
+
+000000000000252d <fork>:
+
+int fork(void) {
+    252d:	55                   	push   %rbp
+    252e:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    2531:	e8 ec fd ff ff       	call   2322 <bflushall>
+  return _fork();
+    2536:	e8 7b 0a 00 00       	call   2fb6 <_fork>
+}
+    253b:	5d                   	pop    %rbp
+    253c:	c3                   	ret
+
+000000000000253d <exit>:
+
+noreturn void exit(void) {
+    253d:	55                   	push   %rbp
+    253e:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    2541:	e8 dc fd ff ff       	call   2322 <bflushall>
+  _exit();
+    2546:	e8 76 0a 00 00       	call   2fc1 <_exit>
+
+000000000000254b <exec>:
+}
+
+int exec(char *path, char **argv) {
+    254b:	55                   	push   %rbp
+    254c:	48 89 e5             	mov    %rsp,%rbp
+    254f:	48 83 ec 10          	sub    $0x10,%rsp
+    2553:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2557:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    255b:	e8 c2 fd ff ff       	call   2322 <bflushall>
+  return _exec(path, argv);
+    2560:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2564:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2568:	48 89 d6             	mov    %rdx,%rsi
+    256b:	48 89 c7             	mov    %rax,%rdi
+    256e:	e8 9b 0a 00 00       	call   300e <_exec>
+}
+    2573:	c9                   	leave
+    2574:	c3                   	ret
+
+0000000000002575 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    2575:	55                   	push   %rbp
+    2576:	48 89 e5             	mov    %rsp,%rbp
+    2579:	48 83 ec 20          	sub    $0x20,%rsp
+    257d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2581:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2585:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    2589:	e8 94 fd ff ff       	call   2322 <bflushall>
+  return _spawn(path, argv, fds);
+    258e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2592:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    259a:	48 89 ce             	mov    %rcx,%rsi
+    259d:	48 89 c7             	mov    %rax,%rdi
+    25a0:	e8 2f 0b 00 00       	call   30d4 <_spawn>
+}
+    25a5:	c9                   	leave
+    25a6:	c3                   	ret
+
+00000000000025a7 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    25a7:	55                   	push   %rbp
+    25a8:	48 89 e5             	mov    %rsp,%rbp
+    25ab:	48 83 ec 10          	sub    $0x10,%rsp
+    25af:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    25b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    25b6:	78 69                	js     2621 <close+0x7a>
+    25b8:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    25bc:	7f 63                	jg     2621 <close+0x7a>
+    25be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    25c1:	48 98                	cltq
+    25c3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    25ca:	00 
+    25cb:	48 8d 05 8e 2a 00 00 	lea    0x2a8e(%rip),%rax        # 5060 <obufs>
+    25d2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    25d6:	48 85 c0             	test   %rax,%rax
+    25d9:	74 46                	je     2621 <close+0x7a>
+    bflush(fd);
+    25db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    25de:	89 c7                	mov    %eax,%edi
+    25e0:	e8 b4 fc ff ff       	call   2299 <bflush>
+    free(obufs[fd]);
+    25e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    25e8:	48 98                	cltq
+    25ea:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    25f1:	00 
+    25f2:	48 8d 05 67 2a 00 00 	lea    0x2a67(%rip),%rax        # 5060 <obufs>
+    25f9:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    25fd:	48 89 c7             	mov    %rax,%rdi
+    2600:	e8 90 11 00 00       	call   3795 <free>
+    obufs[fd] = 0;
+    2605:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2608:	48 98                	cltq
+    260a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2611:	00 
+    2612:	48 8d 05 47 2a 00 00 	lea    0x2a47(%rip),%rax        # 5060 <obufs>
+    2619:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    2620:	00 
+  }
+  return _close(fd);
+    2621:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2624:	89 c7                	mov    %eax,%edi
+    2626:	e8 cd 09 00 00       	call   2ff8 <_close>
+}
+    262b:	c9                   	leave
+    262c:	c3                   	ret
+
+000000000000262d <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    262d:	55                   	push   %rbp
+    262e:	48 89 e5             	mov    %rsp,%rbp
+    2631:	53                   	push   %rbx
+    2632:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2636:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    263a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    263e:	48 8b 36             	mov    (%rsi),%rsi
+    2641:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    2645:	48 29 f7             	sub    %rsi,%rdi
+    2648:	48 89 f9             	mov    %rdi,%rcx
+    264b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2650:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2654:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    2658:	48 89 f0             	mov    %rsi,%rax
+    265b:	ba 00 00 00 00       	mov    $0x0,%edx
+    2660:	48 89 df             	mov    %rbx,%rdi
+    2663:	48 0f af f8          	imul   %rax,%rdi
+    2667:	48 89 d6             	mov    %rdx,%rsi
+    266a:	48 0f af f1          	imul   %rcx,%rsi
+    266e:	48 01 fe             	add    %rdi,%rsi
+    2671:	48 f7 e1             	mul    %rcx
+    2674:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    2678:	48 89 ca             	mov    %rcx,%rdx
+    267b:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    2680:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    2684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2688:	c9                   	leave
+    2689:	c3                   	ret
+
+000000000000268a <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    268a:	55                   	push   %rbp
+    268b:	48 89 e5             	mov    %rsp,%rbp
+    268e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2692:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2695:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    2698:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    269c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    269f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    26a2:	48 89 ce             	mov    %rcx,%rsi
+    26a5:	48 89 f7             	mov    %rsi,%rdi
+    26a8:	89 d1                	mov    %edx,%ecx
+    26aa:	fc                   	cld
+    26ab:	f3 aa                	rep stos %al,%es:(%rdi)
+    26ad:	89 ca                	mov    %ecx,%edx
+    26af:	48 89 fe             	mov    %rdi,%rsi
+    26b2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    26b6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    26b9:	90                   	nop
+    26ba:	5d                   	pop    %rbp
+    26bb:	c3                   	ret
+
+00000000000026bc <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    26bc:	55                   	push   %rbp
+    26bd:	48 89 e5             	mov    %rsp,%rbp
+    26c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    26c8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    26cc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    26d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    26d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26d8:	48 89 ce             	mov    %rcx,%rsi
+    26db:	48 89 f7             	mov    %rsi,%rdi
+    26de:	48 89 d1             	mov    %rdx,%rcx
+    26e1:	fc                   	cld
+    26e2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    26e5:	48 89 ca             	mov    %rcx,%rdx
+    26e8:	48 89 fe             	mov    %rdi,%rsi
+    26eb:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    26ef:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    26f3:	90                   	nop
+    26f4:	5d                   	pop    %rbp
+    26f5:	c3                   	ret
+
+00000000000026f6 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    26f6:	55                   	push   %rbp
+    26f7:	48 89 e5             	mov    %rsp,%rbp
+    26fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    26fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2702:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    2706:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    270a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    270e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2712:	48 89 cf             	mov    %rcx,%rdi
+    2715:	48 89 d6             	mov    %rdx,%rsi
+    2718:	48 89 c1             	mov    %rax,%rcx
+    271b:	fc                   	cld
+    271c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    271e:	48 89 c8             	mov    %rcx,%rax
+    2721:	48 89 f2             	mov    %rsi,%rdx
+    2724:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2728:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    272c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2730:	90                   	nop
+    2731:	5d                   	pop    %rbp
+    2732:	c3                   	ret
+
+0000000000002733 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    2733:	55                   	push   %rbp
+    2734:	48 89 e5             	mov    %rsp,%rbp
+    2737:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    273b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    273f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    2743:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2747:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    274b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    274f:	48 89 cf             	mov    %rcx,%rdi
+    2752:	48 89 d6             	mov    %rdx,%rsi
+    2755:	48 89 c1             	mov    %rax,%rcx
+    2758:	fc                   	cld
+    2759:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    275c:	48 89 c8             	mov    %rcx,%rax
+    275f:	48 89 f2             	mov    %rsi,%rdx
+    2762:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2766:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    276a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    276e:	90                   	nop
+    276f:	5d                   	pop    %rbp
+    2770:	c3                   	ret
+
+0000000000002771 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    2771:	55                   	push   %rbp
+    2772:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    2775:	0f 31                	rdtsc
+    2777:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    277a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    277d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2780:	48 c1 e0 20          	shl    $0x20,%rax
+    2784:	48 89 c2             	mov    %rax,%rdx
+    2787:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    278a:	48 09 d0             	or     %rdx,%rax
+}
+    278d:	5d                   	pop    %rbp
+    278e:	c3                   	ret
+
+000000000000278f <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    278f:	55                   	push   %rbp
+    2790:	48 89 e5             	mov    %rsp,%rbp
+    2793:	53                   	push   %rbx
+    2794:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    2797:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    279b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    279f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    27a3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    27a7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    27aa:	0f a2                	cpuid
+    27ac:	89 de                	mov    %ebx,%esi
+    27ae:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    27b1:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    27b4:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    27b7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    27ba:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    27bf:	74 09                	je     27ca <cpuid+0x3b>
+    *eaxp = eax;
+    27c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27c5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    27c8:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    27ca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    27cf:	74 09                	je     27da <cpuid+0x4b>
+    *ebxp = ebx;
+    27d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    27d5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    27d8:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    27da:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    27df:	74 09                	je     27ea <cpuid+0x5b>
+    *ecxp = ecx;
+    27e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    27e5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    27e8:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    27ea:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    27ef:	74 09                	je     27fa <cpuid+0x6b>
+    *edxp = edx;
+    27f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    27f5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    27f8:	89 10                	mov    %edx,(%rax)
+}
+    27fa:	90                   	nop
+    27fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    27ff:	c9                   	leave
+    2800:	c3                   	ret
+
+0000000000002801 <strcpy>:
+char *strcpy(char *s, char *t) {
+    2801:	55                   	push   %rbp
+    2802:	48 89 e5             	mov    %rsp,%rbp
+    2805:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2809:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    280d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2811:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    2815:	90                   	nop
+    2816:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    281a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    281e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2826:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    282a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    282e:	0f b6 12             	movzbl (%rdx),%edx
+    2831:	88 10                	mov    %dl,(%rax)
+    2833:	0f b6 00             	movzbl (%rax),%eax
+    2836:	84 c0                	test   %al,%al
+    2838:	75 dc                	jne    2816 <strcpy+0x15>
+  return os;
+    283a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    283e:	5d                   	pop    %rbp
+    283f:	c3                   	ret
+
+0000000000002840 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2840:	55                   	push   %rbp
+    2841:	48 89 e5             	mov    %rsp,%rbp
+    2844:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2848:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    284c:	eb 0a                	jmp    2858 <strcmp+0x18>
+    p++, q++;
+    284e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2853:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    2858:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    285c:	0f b6 00             	movzbl (%rax),%eax
+    285f:	84 c0                	test   %al,%al
+    2861:	74 12                	je     2875 <strcmp+0x35>
+    2863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2867:	0f b6 10             	movzbl (%rax),%edx
+    286a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    286e:	0f b6 00             	movzbl (%rax),%eax
+    2871:	38 c2                	cmp    %al,%dl
+    2873:	74 d9                	je     284e <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2875:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2879:	0f b6 00             	movzbl (%rax),%eax
+    287c:	0f b6 d0             	movzbl %al,%edx
+    287f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2883:	0f b6 00             	movzbl (%rax),%eax
+    2886:	0f b6 c0             	movzbl %al,%eax
+    2889:	29 c2                	sub    %eax,%edx
+    288b:	89 d0                	mov    %edx,%eax
+}
+    288d:	5d                   	pop    %rbp
+    288e:	c3                   	ret
+
+000000000000288f <strlen>:
+uint strlen(char *s) {
+    288f:	55                   	push   %rbp
+    2890:	48 89 e5             	mov    %rsp,%rbp
+    2893:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    2897:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    289e:	eb 04                	jmp    28a4 <strlen+0x15>
+    28a0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    28a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    28a7:	48 63 d0             	movslq %eax,%rdx
+    28aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ae:	48 01 d0             	add    %rdx,%rax
+    28b1:	0f b6 00             	movzbl (%rax),%eax
+    28b4:	84 c0                	test   %al,%al
+    28b6:	75 e8                	jne    28a0 <strlen+0x11>
+    ;
+  return n;
+    28b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    28bb:	5d                   	pop    %rbp
+    28bc:	c3                   	ret
+
+00000000000028bd <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    28bd:	55                   	push   %rbp
+    28be:	48 89 e5             	mov    %rsp,%rbp
+    28c1:	53                   	push   %rbx
+    28c2:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    28c6:	8b 05 78 27 00 00    	mov    0x2778(%rip),%eax        # 5044 <erms>
+    28cc:	85 c0                	test   %eax,%eax
+    28ce:	79 53                	jns    2923 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    28d0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    28d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    28da:	b9 00 00 00 00       	mov    $0x0,%ecx
+    28df:	ba 00 00 00 00       	mov    $0x0,%edx
+    28e4:	48 89 c6             	mov    %rax,%rsi
+    28e7:	bf 00 00 00 00       	mov    $0x0,%edi
+    28ec:	e8 9e fe ff ff       	call   278f <cpuid>
+    ebx = 0;
+    28f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    28f8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    28fb:	83 f8 06             	cmp    $0x6,%eax
+    28fe:	76 14                	jbe    2914 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    2900:	b8 07 00 00 00       	mov    $0x7,%eax
+    2905:	b9 00 00 00 00       	mov    $0x0,%ecx
+    290a:	0f a2                	cpuid
+    290c:	89 d9                	mov    %ebx,%ecx
+    290e:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    2911:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    2914:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2917:	c1 e8 09             	shr    $0x9,%eax
+    291a:	83 e0 01             	and    $0x1,%eax
+    291d:	89 05 21 27 00 00    	mov    %eax,0x2721(%rip)        # 5044 <erms>
+  }
+  return erms;
+    2923:	8b 05 1b 27 00 00    	mov    0x271b(%rip),%eax        # 5044 <erms>
+}
+    2929:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    292d:	c9                   	leave
+    292e:	c3                   	ret
+
+000000000000292f <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    292f:	55                   	push   %rbp
+    2930:	48 89 e5             	mov    %rsp,%rbp
+    2933:	48 83 ec 10          	sub    $0x10,%rsp
+    2937:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    293b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    293e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    2941:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    2945:	76 09                	jbe    2950 <memset+0x21>
+    2947:	e8 71 ff ff ff       	call   28bd <haserms>
+    294c:	85 c0                	test   %eax,%eax
+    294e:	74 16                	je     2966 <memset+0x37>
+    stosb(dst, c, n);
+    2950:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2953:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    2956:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    295a:	89 ce                	mov    %ecx,%esi
+    295c:	48 89 c7             	mov    %rax,%rdi
+    295f:	e8 26 fd ff ff       	call   268a <stosb>
+    2964:	eb 58                	jmp    29be <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    2966:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2969:	c1 e8 03             	shr    $0x3,%eax
+    296c:	89 c6                	mov    %eax,%esi
+    296e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2971:	48 98                	cltq
+    2973:	0f b6 c0             	movzbl %al,%eax
+    2976:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    297d:	01 01 01 
+    2980:	48 0f af c2          	imul   %rdx,%rax
+    2984:	48 89 c1             	mov    %rax,%rcx
+    2987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    298b:	48 89 f2             	mov    %rsi,%rdx
+    298e:	48 89 ce             	mov    %rcx,%rsi
+    2991:	48 89 c7             	mov    %rax,%rdi
+    2994:	e8 23 fd ff ff       	call   26bc <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    2999:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    299c:	83 e0 07             	and    $0x7,%eax
+    299f:	89 c2                	mov    %eax,%edx
+    29a1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    29a4:	83 e0 f8             	and    $0xfffffff8,%eax
+    29a7:	48 89 c1             	mov    %rax,%rcx
+    29aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29ae:	48 01 c1             	add    %rax,%rcx
+    29b1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    29b4:	89 c6                	mov    %eax,%esi
+    29b6:	48 89 cf             	mov    %rcx,%rdi
+    29b9:	e8 cc fc ff ff       	call   268a <stosb>
+  }
+  return dst;
+    29be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    29c2:	c9                   	leave
+    29c3:	c3                   	ret
+
+00000000000029c4 <strchr>:
+
+char *strchr(const char *s, char c) {
+    29c4:	55                   	push   %rbp
+    29c5:	48 89 e5             	mov    %rsp,%rbp
+    29c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    29cc:	89 f0                	mov    %esi,%eax
+    29ce:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    29d1:	eb 17                	jmp    29ea <strchr+0x26>
+    if (*s == c)
+    29d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29d7:	0f b6 00             	movzbl (%rax),%eax
+    29da:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    29dd:	75 06                	jne    29e5 <strchr+0x21>
+      return (char *)s;
+    29df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29e3:	eb 15                	jmp    29fa <strchr+0x36>
+  for (; *s; s++)
+    29e5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    29ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    29ee:	0f b6 00             	movzbl (%rax),%eax
+    29f1:	84 c0                	test   %al,%al
+    29f3:	75 de                	jne    29d3 <strchr+0xf>
+  return 0;
+    29f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    29fa:	5d                   	pop    %rbp
+    29fb:	c3                   	ret
+
+00000000000029fc <gets>:
+
+char *gets(char *buf, int max) {
+    29fc:	55                   	push   %rbp
+    29fd:	48 89 e5             	mov    %rsp,%rbp
+    2a00:	48 83 ec 20          	sub    $0x20,%rsp
+    2a04:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2a08:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    2a0b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2a12:	eb 48                	jmp    2a5c <gets+0x60>
+    cc = read(0, &c, 1);
+    2a14:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    2a18:	ba 01 00 00 00       	mov    $0x1,%edx
+    2a1d:	48 89 c6             	mov    %rax,%rsi
+    2a20:	bf 00 00 00 00       	mov    $0x0,%edi
+    2a25:	e8 b8 05 00 00       	call   2fe2 <read>
+    2a2a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2a2d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2a31:	7e 36                	jle    2a69 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    2a33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a36:	8d 50 01             	lea    0x1(%rax),%edx
+    2a39:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2a3c:	48 63 d0             	movslq %eax,%rdx
+    2a3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a43:	48 01 c2             	add    %rax,%rdx
+    2a46:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2a4a:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2a4c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2a50:	3c 0a                	cmp    $0xa,%al
+    2a52:	74 16                	je     2a6a <gets+0x6e>
+    2a54:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2a58:	3c 0d                	cmp    $0xd,%al
+    2a5a:	74 0e                	je     2a6a <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2a5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a5f:	83 c0 01             	add    $0x1,%eax
+    2a62:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2a65:	7f ad                	jg     2a14 <gets+0x18>
+    2a67:	eb 01                	jmp    2a6a <gets+0x6e>
+      break;
+    2a69:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    2a6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a6d:	48 63 d0             	movslq %eax,%rdx
+    2a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a74:	48 01 d0             	add    %rdx,%rax
+    2a77:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    2a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2a7e:	c9                   	leave
+    2a7f:	c3                   	ret
+
+0000000000002a80 <stat>:
+
+int stat(char *n, struct stat *st) {
+    2a80:	55                   	push   %rbp
+    2a81:	48 89 e5             	mov    %rsp,%rbp
+    2a84:	48 83 ec 10          	sub    $0x10,%rsp
+    2a88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    2a90:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2a94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2a98:	48 89 c6             	mov    %rax,%rsi
+    2a9b:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    2aa0:	e8 58 07 00 00       	call   31fd <fstatat>
+}
+    2aa5:	c9                   	leave
+    2aa6:	c3                   	ret
+
+0000000000002aa7 <atoi>:
+
+int atoi(const char *s) {
+    2aa7:	55                   	push   %rbp
+    2aa8:	48 89 e5             	mov    %rsp,%rbp
+    2aab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    2aaf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2ab6:	eb 28                	jmp    2ae0 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    2ab8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2abb:	89 d0                	mov    %edx,%eax
+    2abd:	c1 e0 02             	shl    $0x2,%eax
+    2ac0:	01 d0                	add    %edx,%eax
+    2ac2:	01 c0                	add    %eax,%eax
+    2ac4:	89 c1                	mov    %eax,%ecx
+    2ac6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    2ace:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2ad2:	0f b6 00             	movzbl (%rax),%eax
+    2ad5:	0f be c0             	movsbl %al,%eax
+    2ad8:	01 c8                	add    %ecx,%eax
+    2ada:	83 e8 30             	sub    $0x30,%eax
+    2add:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2ae0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ae4:	0f b6 00             	movzbl (%rax),%eax
+    2ae7:	3c 2f                	cmp    $0x2f,%al
+    2ae9:	7e 0b                	jle    2af6 <atoi+0x4f>
+    2aeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aef:	0f b6 00             	movzbl (%rax),%eax
+    2af2:	3c 39                	cmp    $0x39,%al
+    2af4:	7e c2                	jle    2ab8 <atoi+0x11>
+  return n;
+    2af6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2af9:	5d                   	pop    %rbp
+    2afa:	c3                   	ret
+
+0000000000002afb <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    2afb:	55                   	push   %rbp
+    2afc:	48 89 e5             	mov    %rsp,%rbp
+    2aff:	48 83 ec 28          	sub    $0x28,%rsp
+    2b03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b07:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2b0b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    2b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    2b16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2b1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    2b1e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2b22:	7f 09                	jg     2b2d <memmove+0x32>
+    return vdst;
+    2b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b28:	e9 29 01 00 00       	jmp    2c56 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    2b2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b31:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2b35:	0f 83 87 00 00 00    	jae    2bc2 <memmove+0xc7>
+    2b3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2b3e:	48 63 d0             	movslq %eax,%rdx
+    2b41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b45:	48 01 d0             	add    %rdx,%rax
+    2b48:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2b4c:	73 74                	jae    2bc2 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    2b4e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2b51:	48 98                	cltq
+    2b53:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    2b57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2b5a:	48 98                	cltq
+    2b5c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    2b60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2b64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b68:	48 09 d0             	or     %rdx,%rax
+    2b6b:	83 e0 07             	and    $0x7,%eax
+    2b6e:	48 85 c0             	test   %rax,%rax
+    2b71:	75 3d                	jne    2bb0 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    2b73:	eb 1c                	jmp    2b91 <memmove+0x96>
+        src -= 8;
+    2b75:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    2b7a:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    2b7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b83:	48 8b 10             	mov    (%rax),%rdx
+    2b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b8a:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    2b8d:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    2b91:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2b95:	7f de                	jg     2b75 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    2b97:	eb 17                	jmp    2bb0 <memmove+0xb5>
+      *--dst = *--src;
+    2b99:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    2b9e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    2ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ba7:	0f b6 10             	movzbl (%rax),%edx
+    2baa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bae:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    2bb0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2bb3:	8d 50 ff             	lea    -0x1(%rax),%edx
+    2bb6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    2bb9:	85 c0                	test   %eax,%eax
+    2bbb:	7f dc                	jg     2b99 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    2bbd:	e9 90 00 00 00       	jmp    2c52 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    2bc2:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2bc6:	7e 09                	jle    2bd1 <memmove+0xd6>
+    2bc8:	e8 f0 fc ff ff       	call   28bd <haserms>
+    2bcd:	85 c0                	test   %eax,%eax
+    2bcf:	74 1b                	je     2bec <memmove+0xf1>
+    movsb(dst, src, n);
+    2bd1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2bd4:	48 63 d0             	movslq %eax,%rdx
+    2bd7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2bdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bdf:	48 89 ce             	mov    %rcx,%rsi
+    2be2:	48 89 c7             	mov    %rax,%rdi
+    2be5:	e8 0c fb ff ff       	call   26f6 <movsb>
+    2bea:	eb 66                	jmp    2c52 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    2bec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2bef:	8d 50 07             	lea    0x7(%rax),%edx
+    2bf2:	85 c0                	test   %eax,%eax
+    2bf4:	0f 48 c2             	cmovs  %edx,%eax
+    2bf7:	c1 f8 03             	sar    $0x3,%eax
+    2bfa:	48 63 d0             	movslq %eax,%rdx
+    2bfd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2c01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c05:	48 89 ce             	mov    %rcx,%rsi
+    2c08:	48 89 c7             	mov    %rax,%rdi
+    2c0b:	e8 23 fb ff ff       	call   2733 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    2c10:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2c13:	89 d0                	mov    %edx,%eax
+    2c15:	c1 f8 1f             	sar    $0x1f,%eax
+    2c18:	c1 e8 1d             	shr    $0x1d,%eax
+    2c1b:	01 c2                	add    %eax,%edx
+    2c1d:	83 e2 07             	and    $0x7,%edx
+    2c20:	29 c2                	sub    %eax,%edx
+    2c22:	89 d0                	mov    %edx,%eax
+    2c24:	48 98                	cltq
+    2c26:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2c29:	83 e2 f8             	and    $0xfffffff8,%edx
+    2c2c:	48 63 ca             	movslq %edx,%rcx
+    2c2f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2c33:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    2c37:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2c3a:	83 e2 f8             	and    $0xfffffff8,%edx
+    2c3d:	48 63 ca             	movslq %edx,%rcx
+    2c40:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2c44:	48 01 d1             	add    %rdx,%rcx
+    2c47:	48 89 c2             	mov    %rax,%rdx
+    2c4a:	48 89 cf             	mov    %rcx,%rdi
+    2c4d:	e8 a4 fa ff ff       	call   26f6 <movsb>
+  }
+  return vdst;
+    2c52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2c56:	c9                   	leave
+    2c57:	c3                   	ret
+
+0000000000002c58 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    2c58:	55                   	push   %rbp
+    2c59:	48 89 e5             	mov    %rsp,%rbp
+    2c5c:	48 83 ec 20          	sub    $0x20,%rsp
+    2c60:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2c63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    2c67:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    2c6e:	00 00 00 
+    2c71:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    2c75:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    2c79:	75 0d                	jne    2c88 <clock_gettime+0x30>
+    2c7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c7f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2c83:	48 85 c0             	test   %rax,%rax
+    2c86:	75 13                	jne    2c9b <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    2c88:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2c8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c8f:	48 89 d6             	mov    %rdx,%rsi
+    2c92:	89 c7                	mov    %eax,%edi
+    2c94:	e8 e0 04 00 00       	call   3179 <_clock_gettime>
+    2c99:	eb 7d                	jmp    2d18 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    2c9b:	e8 d1 fa ff ff       	call   2771 <rdtsc>
+    2ca0:	48 89 c2             	mov    %rax,%rdx
+    2ca3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ca7:	48 89 d6             	mov    %rdx,%rsi
+    2caa:	48 89 c7             	mov    %rax,%rdi
+    2cad:	e8 7b f9 ff ff       	call   262d <clockns>
+    2cb2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    2cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cba:	48 c1 e8 09          	shr    $0x9,%rax
+    2cbe:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    2cc5:	b8 44 00 
+    2cc8:	48 f7 e2             	mul    %rdx
+    2ccb:	48 89 d0             	mov    %rdx,%rax
+    2cce:	48 c1 e8 0b          	shr    $0xb,%rax
+    2cd2:	48 89 c2             	mov    %rax,%rdx
+    2cd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2cd9:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    2cdc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2ce0:	48 89 c8             	mov    %rcx,%rax
+    2ce3:	48 c1 e8 09          	shr    $0x9,%rax
+    2ce7:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    2cee:	b8 44 00 
+    2cf1:	48 f7 e2             	mul    %rdx
+    2cf4:	48 89 d0             	mov    %rdx,%rax
+    2cf7:	48 c1 e8 0b          	shr    $0xb,%rax
+    2cfb:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    2d02:	48 89 c8             	mov    %rcx,%rax
+    2d05:	48 29 d0             	sub    %rdx,%rax
+    2d08:	48 89 c2             	mov    %rax,%rdx
+    2d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d0f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    2d13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2d18:	c9                   	leave
+    2d19:	c3                   	ret
+
+0000000000002d1a <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    2d1a:	55                   	push   %rbp
+    2d1b:	48 89 e5             	mov    %rsp,%rbp
+    2d1e:	48 83 ec 10          	sub    $0x10,%rsp
+    2d22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    2d26:	eb 11                	jmp    2d39 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    2d28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d2c:	be 02 00 00 00       	mov    $0x2,%esi
+    2d31:	48 89 c7             	mov    %rax,%rdi
+    2d34:	e8 6c 04 00 00       	call   31a5 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    2d39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2d3d:	b8 02 00 00 00       	mov    $0x2,%eax
+    2d42:	87 02                	xchg   %eax,(%rdx)
+    2d44:	85 c0                	test   %eax,%eax
+    2d46:	75 e0                	jne    2d28 <mutex_wait+0xe>
+}
+    2d48:	90                   	nop
+    2d49:	90                   	nop
+    2d4a:	c9                   	leave
+    2d4b:	c3                   	ret
+
+0000000000002d4c <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    2d4c:	55                   	push   %rbp
+    2d4d:	48 89 e5             	mov    %rsp,%rbp
+    2d50:	48 83 ec 20          	sub    $0x20,%rsp
+    2d54:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    2d58:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    2d5f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2d63:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    2d67:	8b 02                	mov    (%rdx),%eax
+    2d69:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2d6e:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    2d72:	89 c1                	mov    %eax,%ecx
+    2d74:	0f 94 c0             	sete   %al
+    2d77:	84 c0                	test   %al,%al
+    2d79:	75 02                	jne    2d7d <mutex_lock+0x31>
+    2d7b:	89 0a                	mov    %ecx,(%rdx)
+    2d7d:	83 f0 01             	xor    $0x1,%eax
+    2d80:	84 c0                	test   %al,%al
+    2d82:	74 0c                	je     2d90 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    2d84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d88:	48 89 c7             	mov    %rax,%rdi
+    2d8b:	e8 8a ff ff ff       	call   2d1a <mutex_wait>
+}
+    2d90:	90                   	nop
+    2d91:	c9                   	leave
+    2d92:	c3                   	ret
+
+0000000000002d93 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    2d93:	55                   	push   %rbp
+    2d94:	48 89 e5             	mov    %rsp,%rbp
+    2d97:	48 83 ec 10          	sub    $0x10,%rsp
+    2d9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    2d9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2da3:	ba 00 00 00 00       	mov    $0x0,%edx
+    2da8:	87 10                	xchg   %edx,(%rax)
+    2daa:	83 fa 02             	cmp    $0x2,%edx
+    2dad:	75 11                	jne    2dc0 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    2daf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2db3:	be 01 00 00 00       	mov    $0x1,%esi
+    2db8:	48 89 c7             	mov    %rax,%rdi
+    2dbb:	e8 f0 03 00 00       	call   31b0 <futex_wake>
+}
+    2dc0:	90                   	nop
+    2dc1:	c9                   	leave
+    2dc2:	c3                   	ret
+
+0000000000002dc3 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    2dc3:	55                   	push   %rbp
+    2dc4:	48 89 e5             	mov    %rsp,%rbp
+    2dc7:	48 83 ec 20          	sub    $0x20,%rsp
+    2dcb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2dcf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    2dd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2dd7:	48 83 c0 04          	add    $0x4,%rax
+    2ddb:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    2ddf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2de3:	8b 00                	mov    (%rax),%eax
+    2de5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    2de8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2dec:	48 89 c7             	mov    %rax,%rdi
+    2def:	e8 9f ff ff ff       	call   2d93 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    2df4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2df8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2dfb:	89 d6                	mov    %edx,%esi
+    2dfd:	48 89 c7             	mov    %rax,%rdi
+    2e00:	e8 a0 03 00 00       	call   31a5 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    2e05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e09:	48 83 c0 04          	add    $0x4,%rax
+    2e0d:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    2e11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e15:	48 89 c7             	mov    %rax,%rdi
+    2e18:	e8 fd fe ff ff       	call   2d1a <mutex_wait>
+}
+    2e1d:	90                   	nop
+    2e1e:	c9                   	leave
+    2e1f:	c3                   	ret
+
+0000000000002e20 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    2e20:	55                   	push   %rbp
+    2e21:	48 89 e5             	mov    %rsp,%rbp
+    2e24:	48 83 ec 10          	sub    $0x10,%rsp
+    2e28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    2e2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e30:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    2e34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e38:	48 83 c0 04          	add    $0x4,%rax
+    2e3c:	8b 00                	mov    (%rax),%eax
+    2e3e:	85 c0                	test   %eax,%eax
+    2e40:	7e 11                	jle    2e53 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    2e42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e46:	be 01 00 00 00       	mov    $0x1,%esi
+    2e4b:	48 89 c7             	mov    %rax,%rdi
+    2e4e:	e8 5d 03 00 00       	call   31b0 <futex_wake>
+}
+    2e53:	90                   	nop
+    2e54:	c9                   	leave
+    2e55:	c3                   	ret
+
+0000000000002e56 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    2e56:	55                   	push   %rbp
+    2e57:	48 89 e5             	mov    %rsp,%rbp
+    2e5a:	48 83 ec 10          	sub    $0x10,%rsp
+    2e5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    2e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e66:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    2e6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e6e:	48 83 c0 04          	add    $0x4,%rax
+    2e72:	8b 00                	mov    (%rax),%eax
+    2e74:	85 c0                	test   %eax,%eax
+    2e76:	7e 11                	jle    2e89 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    2e78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e7c:	be 00 00 00 40       	mov    $0x40000000,%esi
+    2e81:	48 89 c7             	mov    %rax,%rdi
+    2e84:	e8 27 03 00 00       	call   31b0 <futex_wake>
+}
+    2e89:	90                   	nop
+    2e8a:	c9                   	leave
+    2e8b:	c3                   	ret
+
+0000000000002e8c <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    2e8c:	55                   	push   %rbp
+    2e8d:	48 89 e5             	mov    %rsp,%rbp
+    2e90:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e94:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    2e97:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    2e9b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    2e9f:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    2ea3:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    2ea7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2eab:	8b 40 04             	mov    0x4(%rax),%eax
+    2eae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    2eb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2eb5:	8b 00                	mov    (%rax),%eax
+    2eb7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2eba:	29 c2                	sub    %eax,%edx
+    2ebc:	83 fa 1f             	cmp    $0x1f,%edx
+    2ebf:	76 07                	jbe    2ec8 <ring_push+0x3c>
+    return -1;
+    2ec1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2ec6:	eb 7e                	jmp    2f46 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    2ec8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2ecb:	83 e0 1f             	and    $0x1f,%eax
+    2ece:	89 c2                	mov    %eax,%edx
+    2ed0:	48 89 d0             	mov    %rdx,%rax
+    2ed3:	48 01 c0             	add    %rax,%rax
+    2ed6:	48 01 d0             	add    %rdx,%rax
+    2ed9:	48 c1 e0 04          	shl    $0x4,%rax
+    2edd:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    2ee1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ee5:	48 01 d0             	add    %rdx,%rax
+    2ee8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    2eec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ef0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    2ef3:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    2ef5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ef9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2efd:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    2f01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f05:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2f09:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    2f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f11:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2f15:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    2f19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2f21:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    2f25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f29:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    2f2d:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    2f31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2f34:	8d 50 01             	lea    0x1(%rax),%edx
+    2f37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f3b:	48 83 c0 04          	add    $0x4,%rax
+    2f3f:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2f41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2f46:	5d                   	pop    %rbp
+    2f47:	c3                   	ret
+
+0000000000002f48 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    2f48:	55                   	push   %rbp
+    2f49:	48 89 e5             	mov    %rsp,%rbp
+    2f4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2f50:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    2f54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f58:	8b 40 08             	mov    0x8(%rax),%eax
+    2f5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    2f5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f62:	48 83 c0 0c          	add    $0xc,%rax
+    2f66:	8b 00                	mov    (%rax),%eax
+    2f68:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    2f6b:	75 07                	jne    2f74 <ring_pop+0x2c>
+    return -1;
+    2f6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2f72:	eb 40                	jmp    2fb4 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    2f74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2f77:	83 e0 1f             	and    $0x1f,%eax
+    2f7a:	89 c2                	mov    %eax,%edx
+    2f7c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f84:	89 d2                	mov    %edx,%edx
+    2f86:	48 83 c2 61          	add    $0x61,%rdx
+    2f8a:	48 c1 e2 04          	shl    $0x4,%rdx
+    2f8e:	48 01 d0             	add    %rdx,%rax
+    2f91:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2f95:	48 8b 00             	mov    (%rax),%rax
+    2f98:	48 89 01             	mov    %rax,(%rcx)
+    2f9b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    2f9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2fa2:	8d 50 01             	lea    0x1(%rax),%edx
+    2fa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2fa9:	48 83 c0 08          	add    $0x8,%rax
+    2fad:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2faf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2fb4:	5d                   	pop    %rbp
+    2fb5:	c3                   	ret
+
+0000000000002fb6 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    2fb6:	b8 01 00 00 00       	mov    $0x1,%eax
+    2fbb:	49 89 ca             	mov    %rcx,%r10
+    2fbe:	0f 05                	syscall
+    2fc0:	c3                   	ret
+
+0000000000002fc1 <_exit>:
+SYSCALL_(exit)
+    2fc1:	b8 02 00 00 00       	mov    $0x2,%eax
+    2fc6:	49 89 ca             	mov    %rcx,%r10
+    2fc9:	0f 05                	syscall
+    2fcb:	c3                   	ret
+
+0000000000002fcc <wait>:
+SYSCALL(wait)
+    2fcc:	b8 03 00 00 00       	mov    $0x3,%eax
+    2fd1:	49 89 ca             	mov    %rcx,%r10
+    2fd4:	0f 05                	syscall
+    2fd6:	c3                   	ret
+
+0000000000002fd7 <pipe>:
+SYSCALL(pipe)
+    2fd7:	b8 04 00 00 00       	mov    $0x4,%eax
+    2fdc:	49 89 ca             	mov    %rcx,%r10
+    2fdf:	0f 05                	syscall
+    2fe1:	c3                   	ret
+
+0000000000002fe2 <read>:
+SYSCALL(read)
+    2fe2:	b8 05 00 00 00       	mov    $0x5,%eax
+    2fe7:	49 89 ca             	mov    %rcx,%r10
+    2fea:	0f 05                	syscall
+    2fec:	c3                   	ret
+
+0000000000002fed <write>:
+SYSCALL(write)
+    2fed:	b8 10 00 00 00       	mov    $0x10,%eax
+    2ff2:	49 89 ca             	mov    %rcx,%r10
+    2ff5:	0f 05                	syscall
+    2ff7:	c3                   	ret
+
+0000000000002ff8 <_close>:
+SYSCALL_(close)
+    2ff8:	b8 15 00 00 00       	mov    $0x15,%eax
+    2ffd:	49 89 ca             	mov    %rcx,%r10
+    3000:	0f 05                	syscall
+    3002:	c3                   	ret
+
+0000000000003003 <kill>:
+SYSCALL(kill)
+    3003:	b8 06 00 00 00       	mov    $0x6,%eax
+    3008:	49 89 ca             	mov    %rcx,%r10
+    300b:	0f 05                	syscall
+    300d:	c3                   	ret
+
+000000000000300e <_exec>:
+SYSCALL_(exec)
+    300e:	b8 07 00 00 00       	mov    $0x7,%eax
+    3013:	49 89 ca             	mov    %rcx,%r10
+    3016:	0f 05                	syscall
+    3018:	c3                   	ret
+
+0000000000003019 <open>:
+SYSCALL(open)
+    3019:	b8 0f 00 00 00       	mov    $0xf,%eax
+    301e:	49 89 ca             	mov    %rcx,%r10
+    3021:	0f 05                	syscall
+    3023:	c3                   	ret
+
+0000000000003024 <mknod>:
+SYSCALL(mknod)
+    3024:	b8 11 00 00 00       	mov    $0x11,%eax
+    3029:	49 89 ca             	mov    %rcx,%r10
+    302c:	0f 05                	syscall
+    302e:	c3                   	ret
+
+000000000000302f <unlink>:
+SYSCALL(unlink)
+    302f:	b8 12 00 00 00       	mov    $0x12,%eax
+    3034:	49 89 ca             	mov    %rcx,%r10
+    3037:	0f 05                	syscall
+    3039:	c3                   	ret
+
+000000000000303a <fstat>:
+SYSCALL(fstat)
+    303a:	b8 08 00 00 00       	mov    $0x8,%eax
+    303f:	49 89 ca             	mov    %rcx,%r10
+    3042:	0f 05                	syscall
+    3044:	c3                   	ret
+
+0000000000003045 <link>:
+SYSCALL(link)
+    3045:	b8 13 00 00 00       	mov    $0x13,%eax
+    304a:	49 89 ca             	mov    %rcx,%r10
+    304d:	0f 05                	syscall
+    304f:	c3                   	ret
+
+0000000000003050 <mkdir>:
+SYSCALL(mkdir)
+    3050:	b8 14 00 00 00       	mov    $0x14,%eax
+    3055:	49 89 ca             	mov    %rcx,%r10
+    3058:	0f 05                	syscall
+    305a:	c3                   	ret
+
+000000000000305b <chdir>:
+SYSCALL(chdir)
+    305b:	b8 09 00 00 00       	mov    $0x9,%eax
+    3060:	49 89 ca             	mov    %rcx,%r10
+    3063:	0f 05                	syscall
+    3065:	c3                   	ret
+
+0000000000003066 <dup>:
+SYSCALL(dup)
+    3066:	b8 0a 00 00 00       	mov    $0xa,%eax
+    306b:	49 89 ca             	mov    %rcx,%r10
+    306e:	0f 05                	syscall
+    3070:	c3                   	ret
+
+0000000000003071 <getpid>:
+SYSCALL(getpid)
+    3071:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3076:	49 89 ca             	mov    %rcx,%r10
+    3079:	0f 05                	syscall
+    307b:	c3                   	ret
+
+000000000000307c <sbrk>:
+SYSCALL(sbrk)
+    307c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3081:	49 89 ca             	mov    %rcx,%r10
+    3084:	0f 05                	syscall
+    3086:	c3                   	ret
+
+0000000000003087 <sleep>:
+SYSCALL(sleep)
+    3087:	b8 0d 00 00 00       	mov    $0xd,%eax
+    308c:	49 89 ca             	mov    %rcx,%r10
+    308f:	0f 05                	syscall
+    3091:	c3                   	ret
+
+0000000000003092 <uptime>:
+SYSCALL(uptime)
+    3092:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3097:	49 89 ca             	mov    %rcx,%r10
+    309a:	0f 05                	syscall
+    309c:	c3                   	ret
+
+000000000000309d <sysinfo>:
+SYSCALL(sysinfo)
+    309d:	b8 16 00 00 00       	mov    $0x16,%eax
+    30a2:	49 89 ca             	mov    %rcx,%r10
+    30a5:	0f 05                	syscall
+    30a7:	c3                   	ret
+
+00000000000030a8 <crashn>:
+SYSCALL(crashn)
+    30a8:	b8 17 00 00 00       	mov    $0x17,%eax
+    30ad:	49 89 ca             	mov    %rcx,%r10
+    30b0:	0f 05                	syscall
+    30b2:	c3                   	ret
+
+00000000000030b3 <mmap>:
+SYSCALL(mmap)
+    30b3:	b8 18 00 00 00       	mov    $0x18,%eax
+    30b8:	49 89 ca             	mov    %rcx,%r10
+    30bb:	0f 05                	syscall
+    30bd:	c3                   	ret
+
+00000000000030be <munmap>:
+SYSCALL(munmap)
+    30be:	b8 19 00 00 00       	mov    $0x19,%eax
+    30c3:	49 89 ca             	mov    %rcx,%r10
+    30c6:	0f 05                	syscall
+    30c8:	c3                   	ret
+
+00000000000030c9 <nice>:
+SYSCALL(nice)
+    30c9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    30ce:	49 89 ca             	mov    %rcx,%r10
+    30d1:	0f 05                	syscall
+    30d3:	c3                   	ret
+
+00000000000030d4 <_spawn>:
+SYSCALL_(spawn)
+    30d4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    30d9:	49 89 ca             	mov    %rcx,%r10
+    30dc:	0f 05                	syscall
+    30de:	c3                   	ret
+
+00000000000030df <pread>:
+SYSCALL(pread)
+    30df:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    30e4:	49 89 ca             	mov    %rcx,%r10
+    30e7:	0f 05                	syscall
+    30e9:	c3                   	ret
+
+00000000000030ea <pwrite>:
+SYSCALL(pwrite)
+    30ea:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    30ef:	49 89 ca             	mov    %rcx,%r10
+    30f2:	0f 05                	syscall
+    30f4:	c3                   	ret
+
+00000000000030f5 <readv>:
+SYSCALL(readv)
+    30f5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    30fa:	49 89 ca             	mov    %rcx,%r10
+    30fd:	0f 05                	syscall
+    30ff:	c3                   	ret
+
+0000000000003100 <writev>:
+SYSCALL(writev)
+    3100:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3105:	49 89 ca             	mov    %rcx,%r10
+    3108:	0f 05                	syscall
+    310a:	c3                   	ret
+
+000000000000310b <sendfile>:
+SYSCALL(sendfile)
+    310b:	b8 20 00 00 00       	mov    $0x20,%eax
+    3110:	49 89 ca             	mov    %rcx,%r10
+    3113:	0f 05                	syscall
+    3115:	c3                   	ret
+
+0000000000003116 <splice>:
+SYSCALL(splice)
+    3116:	b8 21 00 00 00       	mov    $0x21,%eax
+    311b:	49 89 ca             	mov    %rcx,%r10
+    311e:	0f 05                	syscall
+    3120:	c3                   	ret
+
+0000000000003121 <poll>:
+SYSCALL(poll)
+    3121:	b8 22 00 00 00       	mov    $0x22,%eax
+    3126:	49 89 ca             	mov    %rcx,%r10
+    3129:	0f 05                	syscall
+    312b:	c3                   	ret
+
+000000000000312c <fsync>:
+SYSCALL(fsync)
+    312c:	b8 23 00 00 00       	mov    $0x23,%eax
+    3131:	49 89 ca             	mov    %rcx,%r10
+    3134:	0f 05                	syscall
+    3136:	c3                   	ret
+
+0000000000003137 <fdatasync>:
+SYSCALL(fdatasync)
+    3137:	b8 24 00 00 00       	mov    $0x24,%eax
+    313c:	49 89 ca             	mov    %rcx,%r10
+    313f:	0f 05                	syscall
+    3141:	c3                   	ret
+
+0000000000003142 <lockstat>:
+SYSCALL(lockstat)
+    3142:	b8 25 00 00 00       	mov    $0x25,%eax
+    3147:	49 89 ca             	mov    %rcx,%r10
+    314a:	0f 05                	syscall
+    314c:	c3                   	ret
+
+000000000000314d <syscallstat>:
+SYSCALL(syscallstat)
+    314d:	b8 26 00 00 00       	mov    $0x26,%eax
+    3152:	49 89 ca             	mov    %rcx,%r10
+    3155:	0f 05                	syscall
+    3157:	c3                   	ret
+
+0000000000003158 <trace>:
+SYSCALL(trace)
+    3158:	b8 27 00 00 00       	mov    $0x27,%eax
+    315d:	49 89 ca             	mov    %rcx,%r10
+    3160:	0f 05                	syscall
+    3162:	c3                   	ret
+
+0000000000003163 <profile>:
+SYSCALL(profile)
+    3163:	b8 28 00 00 00       	mov    $0x28,%eax
+    3168:	49 89 ca             	mov    %rcx,%r10
+    316b:	0f 05                	syscall
+    316d:	c3                   	ret
+
+000000000000316e <cycles>:
+SYSCALL(cycles)
+    316e:	b8 29 00 00 00       	mov    $0x29,%eax
+    3173:	49 89 ca             	mov    %rcx,%r10
+    3176:	0f 05                	syscall
+    3178:	c3                   	ret
+
+0000000000003179 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    3179:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    317e:	49 89 ca             	mov    %rcx,%r10
+    3181:	0f 05                	syscall
+    3183:	c3                   	ret
+
+0000000000003184 <consmode>:
+SYSCALL(consmode)
+    3184:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    3189:	49 89 ca             	mov    %rcx,%r10
+    318c:	0f 05                	syscall
+    318e:	c3                   	ret
+
+000000000000318f <clone>:
+SYSCALL(clone)
+    318f:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    3194:	49 89 ca             	mov    %rcx,%r10
+    3197:	0f 05                	syscall
+    3199:	c3                   	ret
+
+000000000000319a <join>:
+SYSCALL(join)
+    319a:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    319f:	49 89 ca             	mov    %rcx,%r10
+    31a2:	0f 05                	syscall
+    31a4:	c3                   	ret
+
+00000000000031a5 <futex_wait>:
+SYSCALL(futex_wait)
+    31a5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    31aa:	49 89 ca             	mov    %rcx,%r10
+    31ad:	0f 05                	syscall
+    31af:	c3                   	ret
+
+00000000000031b0 <futex_wake>:
+SYSCALL(futex_wake)
+    31b0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    31b5:	49 89 ca             	mov    %rcx,%r10
+    31b8:	0f 05                	syscall
+    31ba:	c3                   	ret
+
+00000000000031bb <shmget>:
+SYSCALL(shmget)
+    31bb:	b8 30 00 00 00       	mov    $0x30,%eax
+    31c0:	49 89 ca             	mov    %rcx,%r10
+    31c3:	0f 05                	syscall
+    31c5:	c3                   	ret
+
+00000000000031c6 <shmat>:
+SYSCALL(shmat)
+    31c6:	b8 31 00 00 00       	mov    $0x31,%eax
+    31cb:	49 89 ca             	mov    %rcx,%r10
+    31ce:	0f 05                	syscall
+    31d0:	c3                   	ret
+
+00000000000031d1 <shmdt>:
+SYSCALL(shmdt)
+    31d1:	b8 32 00 00 00       	mov    $0x32,%eax
+    31d6:	49 89 ca             	mov    %rcx,%r10
+    31d9:	0f 05                	syscall
+    31db:	c3                   	ret
+
+00000000000031dc <ring_setup>:
+SYSCALL(ring_setup)
+    31dc:	b8 33 00 00 00       	mov    $0x33,%eax
+    31e1:	49 89 ca             	mov    %rcx,%r10
+    31e4:	0f 05                	syscall
+    31e6:	c3                   	ret
+
+00000000000031e7 <ring_enter>:
+SYSCALL(ring_enter)
+    31e7:	b8 34 00 00 00       	mov    $0x34,%eax
+    31ec:	49 89 ca             	mov    %rcx,%r10
+    31ef:	0f 05                	syscall
+    31f1:	c3                   	ret
+
+00000000000031f2 <getdents>:
+SYSCALL(getdents)
+    31f2:	b8 35 00 00 00       	mov    $0x35,%eax
+    31f7:	49 89 ca             	mov    %rcx,%r10
+    31fa:	0f 05                	syscall
+    31fc:	c3                   	ret
+
+00000000000031fd <fstatat>:
+SYSCALL(fstatat)
+    31fd:	b8 36 00 00 00       	mov    $0x36,%eax
+    3202:	49 89 ca             	mov    %rcx,%r10
+    3205:	0f 05                	syscall
+    3207:	c3                   	ret
+
+0000000000003208 <clone_file>:
+SYSCALL(clone_file)
+    3208:	b8 37 00 00 00       	mov    $0x37,%eax
+    320d:	49 89 ca             	mov    %rcx,%r10
+    3210:	0f 05                	syscall
+    3212:	c3                   	ret
+
+0000000000003213 <fpunch>:
+SYSCALL(fpunch)
+    3213:	b8 38 00 00 00       	mov    $0x38,%eax
+    3218:	49 89 ca             	mov    %rcx,%r10
+    321b:	0f 05                	syscall
+    321d:	c3                   	ret
+
+000000000000321e <defrag>:
+SYSCALL(defrag)
+    321e:	b8 39 00 00 00       	mov    $0x39,%eax
+    3223:	49 89 ca             	mov    %rcx,%r10
+    3226:	0f 05                	syscall
+    3228:	c3                   	ret
+
+0000000000003229 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    3229:	55                   	push   %rbp
+    322a:	48 89 e5             	mov    %rsp,%rbp
+    322d:	48 83 ec 20          	sub    $0x20,%rsp
+    3231:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    3235:	bf 00 00 00 00       	mov    $0x0,%edi
+    323a:	e8 3d fe ff ff       	call   307c <sbrk>
+    323f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    3243:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3247:	48 f7 d8             	neg    %rax
+    324a:	25 ff 0f 00 00       	and    $0xfff,%eax
+    324f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    3253:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3257:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    325b:	48 01 c2             	add    %rax,%rdx
+    325e:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    3263:	48 39 c2             	cmp    %rax,%rdx
+    3266:	73 1e                	jae    3286 <morecore+0x5d>
+    3268:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    326c:	89 c2                	mov    %eax,%edx
+    326e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3272:	01 d0                	add    %edx,%eax
+    3274:	89 c7                	mov    %eax,%edi
+    3276:	e8 01 fe ff ff       	call   307c <sbrk>
+    327b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    327f:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    3284:	75 07                	jne    328d <morecore+0x64>
+    return 0;
+    3286:	b8 00 00 00 00       	mov    $0x0,%eax
+    328b:	eb 27                	jmp    32b4 <morecore+0x8b>
+  stats.heap += n + pad;
+    328d:	48 8b 05 fc 1e 00 00 	mov    0x1efc(%rip),%rax        # 5190 <stats+0x50>
+    3294:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    3298:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    329c:	48 01 ca             	add    %rcx,%rdx
+    329f:	48 01 d0             	add    %rdx,%rax
+    32a2:	48 89 05 e7 1e 00 00 	mov    %rax,0x1ee7(%rip)        # 5190 <stats+0x50>
+  return p + pad;
+    32a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    32ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32b1:	48 01 d0             	add    %rdx,%rax
+}
+    32b4:	c9                   	leave
+    32b5:	c3                   	ret
+
+00000000000032b6 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    32b6:	55                   	push   %rbp
+    32b7:	48 89 e5             	mov    %rsp,%rbp
+    32ba:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    32be:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    32c2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    32c9:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    32ca:	48 8d 05 4f 1e 00 00 	lea    0x1e4f(%rip),%rax        # 5120 <runs>
+    32d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    32d5:	eb 1a                	jmp    32f1 <pagefree+0x3b>
+    prev = *rp;
+    32d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32db:	48 8b 00             	mov    (%rax),%rax
+    32de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    32e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32e6:	48 8b 00             	mov    (%rax),%rax
+    32e9:	48 83 c0 08          	add    $0x8,%rax
+    32ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    32f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32f5:	48 8b 00             	mov    (%rax),%rax
+    32f8:	48 85 c0             	test   %rax,%rax
+    32fb:	74 0d                	je     330a <pagefree+0x54>
+    32fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3301:	48 8b 00             	mov    (%rax),%rax
+    3304:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    3308:	72 cd                	jb     32d7 <pagefree+0x21>
+  r = (struct run *)p;
+    330a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    330e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    3312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3316:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    331a:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    331d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3321:	48 8b 10             	mov    (%rax),%rdx
+    3324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3328:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    332c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3330:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3334:	48 85 c0             	test   %rax,%rax
+    3337:	74 48                	je     3381 <pagefree+0xcb>
+    3339:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    333d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3341:	48 01 c2             	add    %rax,%rdx
+    3344:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3348:	48 8b 40 08          	mov    0x8(%rax),%rax
+    334c:	48 39 c2             	cmp    %rax,%rdx
+    334f:	75 30                	jne    3381 <pagefree+0xcb>
+    r->size += r->next->size;
+    3351:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3355:	48 8b 10             	mov    (%rax),%rdx
+    3358:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    335c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3360:	48 8b 00             	mov    (%rax),%rax
+    3363:	48 01 c2             	add    %rax,%rdx
+    3366:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    336a:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    336d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3371:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3375:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3379:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    337d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    3381:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3386:	74 46                	je     33ce <pagefree+0x118>
+    3388:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    338c:	48 8b 10             	mov    (%rax),%rdx
+    338f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3393:	48 01 d0             	add    %rdx,%rax
+    3396:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    339a:	75 32                	jne    33ce <pagefree+0x118>
+    prev->size += r->size;
+    339c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33a0:	48 8b 10             	mov    (%rax),%rdx
+    33a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33a7:	48 8b 00             	mov    (%rax),%rax
+    33aa:	48 01 c2             	add    %rax,%rdx
+    33ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33b1:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    33b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33b8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    33bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33c0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    33c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33c8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    33cc:	eb 0c                	jmp    33da <pagefree+0x124>
+  } else {
+    *rp = r;
+    33ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    33d6:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    33d9:	90                   	nop
+    33da:	90                   	nop
+    33db:	5d                   	pop    %rbp
+    33dc:	c3                   	ret
+
+00000000000033dd <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    33dd:	55                   	push   %rbp
+    33de:	48 89 e5             	mov    %rsp,%rbp
+    33e1:	48 83 ec 40          	sub    $0x40,%rsp
+    33e5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    33e9:	48 8d 05 30 1d 00 00 	lea    0x1d30(%rip),%rax        # 5120 <runs>
+    33f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    33f4:	eb 66                	jmp    345c <pagealloc+0x7f>
+    if (r->size == n) {
+    33f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    33fa:	48 8b 00             	mov    (%rax),%rax
+    33fd:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3401:	75 18                	jne    341b <pagealloc+0x3e>
+      *rp = r->next;
+    3403:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3407:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    340b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    340f:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    3412:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3416:	e9 ca 00 00 00       	jmp    34e5 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    341b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    341f:	48 8b 00             	mov    (%rax),%rax
+    3422:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3426:	73 28                	jae    3450 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    3428:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    342c:	48 8b 00             	mov    (%rax),%rax
+    342f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3433:	48 89 c2             	mov    %rax,%rdx
+    3436:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    343a:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    343d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3441:	48 8b 10             	mov    (%rax),%rdx
+    3444:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3448:	48 01 d0             	add    %rdx,%rax
+    344b:	e9 95 00 00 00       	jmp    34e5 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    3450:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3454:	48 83 c0 08          	add    $0x8,%rax
+    3458:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    345c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3460:	48 8b 00             	mov    (%rax),%rax
+    3463:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3467:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    346c:	75 88                	jne    33f6 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    346e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3472:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    3476:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    347d:	00 
+    347e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3482:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3486:	48 39 c2             	cmp    %rax,%rdx
+    3489:	48 0f 43 c2          	cmovae %rdx,%rax
+    348d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    3491:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3495:	48 89 c7             	mov    %rax,%rdi
+    3498:	e8 8c fd ff ff       	call   3229 <morecore>
+    349d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    34a1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    34a6:	75 07                	jne    34af <pagealloc+0xd2>
+    return 0;
+    34a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    34ad:	eb 36                	jmp    34e5 <pagealloc+0x108>
+  if (m > n)
+    34af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34b3:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    34b7:	73 1a                	jae    34d3 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    34b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34bd:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    34c1:	48 89 c2             	mov    %rax,%rdx
+    34c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    34c8:	48 89 d6             	mov    %rdx,%rsi
+    34cb:	48 89 c7             	mov    %rax,%rdi
+    34ce:	e8 e3 fd ff ff       	call   32b6 <pagefree>
+  return p + m - n;
+    34d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    34d7:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    34db:	48 89 c2             	mov    %rax,%rdx
+    34de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    34e2:	48 01 d0             	add    %rdx,%rax
+}
+    34e5:	c9                   	leave
+    34e6:	c3                   	ret
+
+00000000000034e7 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    34e7:	55                   	push   %rbp
+    34e8:	48 89 e5             	mov    %rsp,%rbp
+    34eb:	48 83 ec 30          	sub    $0x30,%rsp
+    34ef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    34f2:	bf 00 10 00 00       	mov    $0x1000,%edi
+    34f7:	e8 e1 fe ff ff       	call   33dd <pagealloc>
+    34fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3500:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3505:	75 0a                	jne    3511 <refill+0x2a>
+    return -1;
+    3507:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    350c:	e9 da 00 00 00       	jmp    35eb <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    3511:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    3518:	00 
+    3519:	e9 ba 00 00 00       	jmp    35d8 <refill+0xf1>
+    b = (struct block *)(p + off);
+    351e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3526:	48 01 d0             	add    %rdx,%rax
+    3529:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    352d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3530:	ba 20 00 00 00       	mov    $0x20,%edx
+    3535:	89 c1                	mov    %eax,%ecx
+    3537:	48 d3 e2             	shl    %cl,%rdx
+    353a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    353e:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    3541:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3544:	48 63 d0             	movslq %eax,%rdx
+    3547:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    354b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    354f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3552:	48 98                	cltq
+    3554:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    355b:	00 
+    355c:	48 8d 05 7d 1b 00 00 	lea    0x1b7d(%rip),%rax        # 50e0 <freelist>
+    3563:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    3567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    356b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    356f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3572:	48 98                	cltq
+    3574:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    357b:	00 
+    357c:	48 8d 15 5d 1b 00 00 	lea    0x1b5d(%rip),%rdx        # 50e0 <freelist>
+    3583:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3587:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    358b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    358e:	48 98                	cltq
+    3590:	48 83 c0 08          	add    $0x8,%rax
+    3594:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    359b:	00 
+    359c:	48 8d 05 a1 1b 00 00 	lea    0x1ba1(%rip),%rax        # 5144 <stats+0x4>
+    35a3:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    35a6:	8d 48 01             	lea    0x1(%rax),%ecx
+    35a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    35ac:	48 98                	cltq
+    35ae:	48 83 c0 08          	add    $0x8,%rax
+    35b2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    35b9:	00 
+    35ba:	48 8d 05 83 1b 00 00 	lea    0x1b83(%rip),%rax        # 5144 <stats+0x4>
+    35c1:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    35c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    35c7:	ba 20 00 00 00       	mov    $0x20,%edx
+    35cc:	89 c1                	mov    %eax,%ecx
+    35ce:	48 d3 e2             	shl    %cl,%rdx
+    35d1:	48 89 d0             	mov    %rdx,%rax
+    35d4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    35d8:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    35df:	00 
+    35e0:	0f 86 38 ff ff ff    	jbe    351e <refill+0x37>
+  }
+  return 0;
+    35e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    35eb:	c9                   	leave
+    35ec:	c3                   	ret
+
+00000000000035ed <malloc>:
+
+void *malloc(uint nbytes) {
+    35ed:	55                   	push   %rbp
+    35ee:	48 89 e5             	mov    %rsp,%rbp
+    35f1:	48 83 ec 30          	sub    $0x30,%rsp
+    35f5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    35f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    35fb:	48 83 c0 10          	add    $0x10,%rax
+    35ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    3603:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    360a:	eb 04                	jmp    3610 <malloc+0x23>
+    360c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    3610:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    3614:	7f 16                	jg     362c <malloc+0x3f>
+    3616:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3619:	ba 20 00 00 00       	mov    $0x20,%edx
+    361e:	89 c1                	mov    %eax,%ecx
+    3620:	48 d3 e2             	shl    %cl,%rdx
+    3623:	48 89 d0             	mov    %rdx,%rax
+    3626:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    362a:	72 e0                	jb     360c <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    362c:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    3630:	75 7d                	jne    36af <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    3632:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3636:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    363c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    3642:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    3646:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    364a:	48 89 c7             	mov    %rax,%rdi
+    364d:	e8 8b fd ff ff       	call   33dd <pagealloc>
+    3652:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3656:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    365b:	75 0a                	jne    3667 <malloc+0x7a>
+      return 0;
+    365d:	b8 00 00 00 00       	mov    $0x0,%eax
+    3662:	e9 2c 01 00 00       	jmp    3793 <malloc+0x1a6>
+    h->size = n;
+    3667:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    366b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    366f:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    3672:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3676:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    367d:	00 
+    stats.inuse[LARGE]++;
+    367e:	8b 05 dc 1a 00 00    	mov    0x1adc(%rip),%eax        # 5160 <stats+0x20>
+    3684:	83 c0 01             	add    $0x1,%eax
+    3687:	89 05 d3 1a 00 00    	mov    %eax,0x1ad3(%rip)        # 5160 <stats+0x20>
+    stats.large += n;
+    368d:	48 8b 15 f4 1a 00 00 	mov    0x1af4(%rip),%rdx        # 5188 <stats+0x48>
+    3694:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3698:	48 01 d0             	add    %rdx,%rax
+    369b:	48 89 05 e6 1a 00 00 	mov    %rax,0x1ae6(%rip)        # 5188 <stats+0x48>
+    return h + 1;
+    36a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    36a6:	48 83 c0 10          	add    $0x10,%rax
+    36aa:	e9 e4 00 00 00       	jmp    3793 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    36af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    36b2:	48 98                	cltq
+    36b4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    36bb:	00 
+    36bc:	48 8d 05 1d 1a 00 00 	lea    0x1a1d(%rip),%rax        # 50e0 <freelist>
+    36c3:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    36c7:	48 85 c0             	test   %rax,%rax
+    36ca:	75 18                	jne    36e4 <malloc+0xf7>
+    36cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    36cf:	89 c7                	mov    %eax,%edi
+    36d1:	e8 11 fe ff ff       	call   34e7 <refill>
+    36d6:	85 c0                	test   %eax,%eax
+    36d8:	79 0a                	jns    36e4 <malloc+0xf7>
+    return 0;
+    36da:	b8 00 00 00 00       	mov    $0x0,%eax
+    36df:	e9 af 00 00 00       	jmp    3793 <malloc+0x1a6>
+  b = freelist[c];
+    36e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    36e7:	48 98                	cltq
+    36e9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    36f0:	00 
+    36f1:	48 8d 05 e8 19 00 00 	lea    0x19e8(%rip),%rax        # 50e0 <freelist>
+    36f8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    36fc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    3700:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3704:	48 8b 40 10          	mov    0x10(%rax),%rax
+    3708:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    370b:	48 63 d2             	movslq %edx,%rdx
+    370e:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3715:	00 
+    3716:	48 8d 15 c3 19 00 00 	lea    0x19c3(%rip),%rdx        # 50e0 <freelist>
+    371d:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    3721:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3724:	48 98                	cltq
+    3726:	48 83 c0 08          	add    $0x8,%rax
+    372a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3731:	00 
+    3732:	48 8d 05 0b 1a 00 00 	lea    0x1a0b(%rip),%rax        # 5144 <stats+0x4>
+    3739:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    373c:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    373f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3742:	48 98                	cltq
+    3744:	48 83 c0 08          	add    $0x8,%rax
+    3748:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    374f:	00 
+    3750:	48 8d 05 ed 19 00 00 	lea    0x19ed(%rip),%rax        # 5144 <stats+0x4>
+    3757:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    375a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    375d:	48 98                	cltq
+    375f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3766:	00 
+    3767:	48 8d 05 d2 19 00 00 	lea    0x19d2(%rip),%rax        # 5140 <stats>
+    376e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3771:	8d 48 01             	lea    0x1(%rax),%ecx
+    3774:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3777:	48 98                	cltq
+    3779:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3780:	00 
+    3781:	48 8d 05 b8 19 00 00 	lea    0x19b8(%rip),%rax        # 5140 <stats>
+    3788:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    378b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    378f:	48 83 c0 10          	add    $0x10,%rax
+}
+    3793:	c9                   	leave
+    3794:	c3                   	ret
+
+0000000000003795 <free>:
+
+void free(void *ap) {
+    3795:	55                   	push   %rbp
+    3796:	48 89 e5             	mov    %rsp,%rbp
+    3799:	48 83 ec 18          	sub    $0x18,%rsp
+    379d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    37a1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    37a6:	0f 84 03 01 00 00    	je     38af <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    37ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    37b0:	48 83 e8 10          	sub    $0x10,%rax
+    37b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    37b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+    37c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    37c4:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    37c9:	75 42                	jne    380d <free+0x78>
+    stats.inuse[LARGE]--;
+    37cb:	8b 05 8f 19 00 00    	mov    0x198f(%rip),%eax        # 5160 <stats+0x20>
+    37d1:	83 e8 01             	sub    $0x1,%eax
+    37d4:	89 05 86 19 00 00    	mov    %eax,0x1986(%rip)        # 5160 <stats+0x20>
+    stats.large -= b->h.size;
+    37da:	48 8b 15 a7 19 00 00 	mov    0x19a7(%rip),%rdx        # 5188 <stats+0x48>
+    37e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37e5:	48 8b 00             	mov    (%rax),%rax
+    37e8:	48 29 c2             	sub    %rax,%rdx
+    37eb:	48 89 15 96 19 00 00 	mov    %rdx,0x1996(%rip)        # 5188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    37f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37f6:	48 8b 10             	mov    (%rax),%rdx
+    37f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37fd:	48 89 d6             	mov    %rdx,%rsi
+    3800:	48 89 c7             	mov    %rax,%rdi
+    3803:	e8 ae fa ff ff       	call   32b6 <pagefree>
+    return;
+    3808:	e9 a3 00 00 00       	jmp    38b0 <free+0x11b>
+  }
+  b->next = freelist[c];
+    380d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3811:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3818:	00 
+    3819:	48 8d 05 c0 18 00 00 	lea    0x18c0(%rip),%rax        # 50e0 <freelist>
+    3820:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    3824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3828:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    382c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3830:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    3837:	00 
+    3838:	48 8d 15 a1 18 00 00 	lea    0x18a1(%rip),%rdx        # 50e0 <freelist>
+    383f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3843:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    3847:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    384b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3852:	00 
+    3853:	48 8d 05 e6 18 00 00 	lea    0x18e6(%rip),%rax        # 5140 <stats>
+    385a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    385d:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3860:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3864:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    386b:	00 
+    386c:	48 8d 05 cd 18 00 00 	lea    0x18cd(%rip),%rax        # 5140 <stats>
+    3873:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    3876:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    387a:	48 83 c0 08          	add    $0x8,%rax
+    387e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3885:	00 
+    3886:	48 8d 05 b7 18 00 00 	lea    0x18b7(%rip),%rax        # 5144 <stats+0x4>
+    388d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3890:	8d 48 01             	lea    0x1(%rax),%ecx
+    3893:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3897:	48 83 c0 08          	add    $0x8,%rax
+    389b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    38a2:	00 
+    38a3:	48 8d 05 9a 18 00 00 	lea    0x189a(%rip),%rax        # 5144 <stats+0x4>
+    38aa:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    38ad:	eb 01                	jmp    38b0 <free+0x11b>
+    return;
+    38af:	90                   	nop
+}
+    38b0:	c9                   	leave
+    38b1:	c3                   	ret
+
+00000000000038b2 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    38b2:	55                   	push   %rbp
+    38b3:	48 89 e5             	mov    %rsp,%rbp
+    38b6:	48 83 ec 30          	sub    $0x30,%rsp
+    38ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    38bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    38c0:	48 8d 15 b1 0a 00 00 	lea    0xab1(%rip),%rdx        # 4378 <benchreport+0x99e>
+    38c7:	48 89 d6             	mov    %rdx,%rsi
+    38ca:	89 c7                	mov    %eax,%edi
+    38cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    38d1:	e8 37 e6 ff ff       	call   1f0d <printf>
+  for (c = 0; c < NCLASS; c++)
+    38d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    38dd:	eb 67                	jmp    3946 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    38df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    38e2:	48 98                	cltq
+    38e4:	48 83 c0 08          	add    $0x8,%rax
+    38e8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    38ef:	00 
+    38f0:	48 8d 05 4d 18 00 00 	lea    0x184d(%rip),%rax        # 5144 <stats+0x4>
+    38f7:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    38fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    38fd:	48 98                	cltq
+    38ff:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3906:	00 
+    3907:	48 8d 05 32 18 00 00 	lea    0x1832(%rip),%rax        # 5140 <stats>
+    390e:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    3911:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3914:	ba 20 00 00 00       	mov    $0x20,%edx
+    3919:	89 c1                	mov    %eax,%ecx
+    391b:	48 d3 e2             	shl    %cl,%rdx
+    391e:	48 89 d0             	mov    %rdx,%rax
+    3921:	89 c1                	mov    %eax,%ecx
+    3923:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    3926:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3929:	41 89 f9             	mov    %edi,%r9d
+    392c:	41 89 f0             	mov    %esi,%r8d
+    392f:	48 8d 35 59 0a 00 00 	lea    0xa59(%rip),%rsi        # 438f <benchreport+0x9b5>
+    3936:	89 c7                	mov    %eax,%edi
+    3938:	b8 00 00 00 00       	mov    $0x0,%eax
+    393d:	e8 cb e5 ff ff       	call   1f0d <printf>
+  for (c = 0; c < NCLASS; c++)
+    3942:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    3946:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    394a:	7e 93                	jle    38df <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    394c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3953:	00 
+  for (r = runs; r; r = r->next)
+    3954:	48 8b 05 c5 17 00 00 	mov    0x17c5(%rip),%rax        # 5120 <runs>
+    395b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    395f:	eb 17                	jmp    3978 <mallocstats+0xc6>
+    nfree += r->size;
+    3961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3965:	48 8b 00             	mov    (%rax),%rax
+    3968:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    396c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3970:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3974:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3978:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    397d:	75 e2                	jne    3961 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    397f:	48 8b 05 0a 18 00 00 	mov    0x180a(%rip),%rax        # 5190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3986:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3988:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    398c:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3990:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3992:	48 8b 05 ef 17 00 00 	mov    0x17ef(%rip),%rax        # 5188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3999:	89 c1                	mov    %eax,%ecx
+    399b:	8b 15 bf 17 00 00    	mov    0x17bf(%rip),%edx        # 5160 <stats+0x20>
+    39a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    39a4:	41 89 f9             	mov    %edi,%r9d
+    39a7:	41 89 f0             	mov    %esi,%r8d
+    39aa:	48 8d 35 ef 09 00 00 	lea    0x9ef(%rip),%rsi        # 43a0 <benchreport+0x9c6>
+    39b1:	89 c7                	mov    %eax,%edi
+    39b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    39b8:	e8 50 e5 ff ff       	call   1f0d <printf>
+}
+    39bd:	90                   	nop
+    39be:	c9                   	leave
+    39bf:	c3                   	ret
+
+00000000000039c0 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    39c0:	55                   	push   %rbp
+    39c1:	48 89 e5             	mov    %rsp,%rbp
+    39c4:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    39c8:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    39cc:	48 89 c7             	mov    %rax,%rdi
+    39cf:	e8 9a f7 ff ff       	call   316e <cycles>
+  return t;
+    39d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    39d8:	c9                   	leave
+    39d9:	c3                   	ret
+
+00000000000039da <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    39da:	55                   	push   %rbp
+    39db:	48 89 e5             	mov    %rsp,%rbp
+    39de:	48 83 ec 30          	sub    $0x30,%rsp
+    39e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    39e6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    39ea:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    39ed:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    39f1:	0f 8e 24 01 00 00    	jle    3b1b <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    39f7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    39fe:	e9 98 00 00 00       	jmp    3a9b <benchreport+0xc1>
+    x = t[i];
+    3a03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3a06:	48 98                	cltq
+    3a08:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3a0f:	00 
+    3a10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3a14:	48 01 d0             	add    %rdx,%rax
+    3a17:	48 8b 00             	mov    (%rax),%rax
+    3a1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3a1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3a21:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    3a24:	eb 33                	jmp    3a59 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    3a26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3a29:	48 98                	cltq
+    3a2b:	48 c1 e0 03          	shl    $0x3,%rax
+    3a2f:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3a33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3a37:	48 01 d0             	add    %rdx,%rax
+    3a3a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    3a3d:	48 63 d2             	movslq %edx,%rdx
+    3a40:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3a47:	00 
+    3a48:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3a4c:	48 01 ca             	add    %rcx,%rdx
+    3a4f:	48 8b 00             	mov    (%rax),%rax
+    3a52:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3a55:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    3a59:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    3a5d:	7e 1d                	jle    3a7c <benchreport+0xa2>
+    3a5f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3a62:	48 98                	cltq
+    3a64:	48 c1 e0 03          	shl    $0x3,%rax
+    3a68:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3a6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3a70:	48 01 d0             	add    %rdx,%rax
+    3a73:	48 8b 00             	mov    (%rax),%rax
+    3a76:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    3a7a:	72 aa                	jb     3a26 <benchreport+0x4c>
+    t[j] = x;
+    3a7c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3a7f:	48 98                	cltq
+    3a81:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3a88:	00 
+    3a89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3a8d:	48 01 c2             	add    %rax,%rdx
+    3a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a94:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    3a97:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    3a9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3a9e:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    3aa1:	0f 8c 5c ff ff ff    	jl     3a03 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    3aa7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3aaa:	48 98                	cltq
+    3aac:	48 c1 e0 03          	shl    $0x3,%rax
+    3ab0:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3ab4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ab8:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    3abb:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    3abe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3ac1:	89 c2                	mov    %eax,%edx
+    3ac3:	c1 ea 1f             	shr    $0x1f,%edx
+    3ac6:	01 d0                	add    %edx,%eax
+    3ac8:	d1 f8                	sar    %eax
+    3aca:	48 98                	cltq
+    3acc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3ad3:	00 
+    3ad4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ad8:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    3adb:	48 8b 38             	mov    (%rax),%rdi
+    3ade:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ae2:	48 8b 30             	mov    (%rax),%rsi
+    3ae5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    3ae8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3aec:	48 83 ec 08          	sub    $0x8,%rsp
+    3af0:	51                   	push   %rcx
+    3af1:	49 89 f9             	mov    %rdi,%r9
+    3af4:	49 89 f0             	mov    %rsi,%r8
+    3af7:	89 d1                	mov    %edx,%ecx
+    3af9:	48 89 c2             	mov    %rax,%rdx
+    3afc:	48 8d 05 dd 08 00 00 	lea    0x8dd(%rip),%rax        # 43e0 <benchreport+0xa06>
+    3b03:	48 89 c6             	mov    %rax,%rsi
+    3b06:	bf 01 00 00 00       	mov    $0x1,%edi
+    3b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+    3b10:	e8 f8 e3 ff ff       	call   1f0d <printf>
+    3b15:	48 83 c4 10          	add    $0x10,%rsp
+    3b19:	eb 01                	jmp    3b1c <benchreport+0x142>
+    return;
+    3b1b:	90                   	nop
+}
+    3b1c:	c9                   	leave
+    3b1d:	c3                   	ret
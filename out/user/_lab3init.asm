@@ -0,0 +1,3375 @@
+
+out/user/_lab3init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <stat.h>
+#include <user.h>
+
+char *argv[] = {"lab3test", 0};
+
+int main(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+  if (open("console", O_RDWR) < 0) {
+       4:	be 02 00 00 00       	mov    $0x2,%esi
+       9:	48 8d 05 79 1e 00 00 	lea    0x1e79(%rip),%rax        # 1e89 <benchreport+0x151>
+      10:	48 89 c7             	mov    %rax,%rdi
+      13:	e8 5f 13 00 00       	call   1377 <open>
+      18:	85 c0                	test   %eax,%eax
+      1a:	79 2d                	jns    49 <main+0x49>
+    mknod("console", 1, 1);
+      1c:	ba 01 00 00 00       	mov    $0x1,%edx
+      21:	be 01 00 00 00       	mov    $0x1,%esi
+      26:	48 8d 05 5c 1e 00 00 	lea    0x1e5c(%rip),%rax        # 1e89 <benchreport+0x151>
+      2d:	48 89 c7             	mov    %rax,%rdi
+      30:	e8 4d 13 00 00       	call   1382 <mknod>
+    open("console", O_RDWR);
+      35:	be 02 00 00 00       	mov    $0x2,%esi
+      3a:	48 8d 05 48 1e 00 00 	lea    0x1e48(%rip),%rax        # 1e89 <benchreport+0x151>
+      41:	48 89 c7             	mov    %rax,%rdi
+      44:	e8 2e 13 00 00       	call   1377 <open>
+  }
+  dup(0); // stdout
+      49:	bf 00 00 00 00       	mov    $0x0,%edi
+      4e:	e8 71 13 00 00       	call   13c4 <dup>
+  dup(0); // stderr
+      53:	bf 00 00 00 00       	mov    $0x0,%edi
+      58:	e8 67 13 00 00       	call   13c4 <dup>
+  printf(1, "lab3init running\n");
+      5d:	48 8d 05 2d 1e 00 00 	lea    0x1e2d(%rip),%rax        # 1e91 <benchreport+0x159>
+      64:	48 89 c6             	mov    %rax,%rsi
+      67:	bf 01 00 00 00       	mov    $0x1,%edi
+      6c:	b8 00 00 00 00       	mov    $0x0,%eax
+      71:	e8 f5 01 00 00       	call   26b <printf>
+  exec("lab3test", argv);
+      76:	48 8d 05 83 2f 00 00 	lea    0x2f83(%rip),%rax        # 3000 <argv>
+      7d:	48 89 c6             	mov    %rax,%rsi
+      80:	48 8d 05 f9 1d 00 00 	lea    0x1df9(%rip),%rax        # 1e80 <benchreport+0x148>
+      87:	48 89 c7             	mov    %rax,%rdi
+      8a:	e8 1a 08 00 00       	call   8a9 <exec>
+  printf(1, "lab3init: exec failed\n");
+      8f:	48 8d 05 0d 1e 00 00 	lea    0x1e0d(%rip),%rax        # 1ea3 <benchreport+0x16b>
+      96:	48 89 c6             	mov    %rax,%rsi
+      99:	bf 01 00 00 00       	mov    $0x1,%edi
+      9e:	b8 00 00 00 00       	mov    $0x0,%eax
+      a3:	e8 c3 01 00 00       	call   26b <printf>
+  exit();
+      a8:	e8 ee 07 00 00       	call   89b <exit>
+
+00000000000000ad <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      ad:	55                   	push   %rbp
+      ae:	48 89 e5             	mov    %rsp,%rbp
+      b1:	48 83 ec 10          	sub    $0x10,%rsp
+      b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+      b8:	89 f0                	mov    %esi,%eax
+      ba:	88 45 f8             	mov    %al,-0x8(%rbp)
+      bd:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+      c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      c4:	89 d6                	mov    %edx,%esi
+      c6:	89 c7                	mov    %eax,%edi
+      c8:	e8 eb 06 00 00       	call   7b8 <bputc>
+      cd:	90                   	nop
+      ce:	c9                   	leave
+      cf:	c3                   	ret
+
+00000000000000d0 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+      d0:	55                   	push   %rbp
+      d1:	48 89 e5             	mov    %rsp,%rbp
+      d4:	48 83 ec 50          	sub    $0x50,%rsp
+      d8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+      db:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+      df:	89 55 c8             	mov    %edx,-0x38(%rbp)
+      e2:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+      e5:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      e9:	74 21                	je     10c <printint64+0x3c>
+      eb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      ef:	48 c1 e8 3f          	shr    $0x3f,%rax
+      f3:	0f b6 c0             	movzbl %al,%eax
+      f6:	89 45 bc             	mov    %eax,-0x44(%rbp)
+      f9:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      fd:	74 0d                	je     10c <printint64+0x3c>
+    x = -xx;
+      ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     103:	48 f7 d8             	neg    %rax
+     106:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     10a:	eb 08                	jmp    114 <printint64+0x44>
+  else
+    x = xx;
+     10c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     110:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     114:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     11b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     11e:	48 63 c8             	movslq %eax,%rcx
+     121:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     125:	ba 00 00 00 00       	mov    $0x0,%edx
+     12a:	48 f7 f1             	div    %rcx
+     12d:	48 89 d1             	mov    %rdx,%rcx
+     130:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     133:	8d 50 01             	lea    0x1(%rax),%edx
+     136:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     139:	48 8d 15 d0 2e 00 00 	lea    0x2ed0(%rip),%rdx        # 3010 <digits.1>
+     140:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     144:	48 98                	cltq
+     146:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     14a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     14d:	48 63 f0             	movslq %eax,%rsi
+     150:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     154:	ba 00 00 00 00       	mov    $0x0,%edx
+     159:	48 f7 f6             	div    %rsi
+     15c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     160:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     165:	75 b4                	jne    11b <printint64+0x4b>
+
+  if (sgn)
+     167:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     16b:	74 2b                	je     198 <printint64+0xc8>
+    buf[i++] = '-';
+     16d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     170:	8d 50 01             	lea    0x1(%rax),%edx
+     173:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     176:	48 98                	cltq
+     178:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     17d:	eb 19                	jmp    198 <printint64+0xc8>
+    putc(fd, buf[i]);
+     17f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     182:	48 98                	cltq
+     184:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     189:	0f be d0             	movsbl %al,%edx
+     18c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     18f:	89 d6                	mov    %edx,%esi
+     191:	89 c7                	mov    %eax,%edi
+     193:	e8 15 ff ff ff       	call   ad <putc>
+  while (--i >= 0)
+     198:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     19c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1a0:	79 dd                	jns    17f <printint64+0xaf>
+}
+     1a2:	90                   	nop
+     1a3:	90                   	nop
+     1a4:	c9                   	leave
+     1a5:	c3                   	ret
+
+00000000000001a6 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     1a6:	55                   	push   %rbp
+     1a7:	48 89 e5             	mov    %rsp,%rbp
+     1aa:	48 83 ec 30          	sub    $0x30,%rsp
+     1ae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     1b1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     1b4:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     1b7:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     1ba:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     1c1:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     1c5:	74 17                	je     1de <printint+0x38>
+     1c7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     1cb:	79 11                	jns    1de <printint+0x38>
+    neg = 1;
+     1cd:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     1d4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1d7:	f7 d8                	neg    %eax
+     1d9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1dc:	eb 06                	jmp    1e4 <printint+0x3e>
+  } else {
+    x = xx;
+     1de:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1e1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     1e4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1eb:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     1ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1f1:	ba 00 00 00 00       	mov    $0x0,%edx
+     1f6:	f7 f1                	div    %ecx
+     1f8:	89 d1                	mov    %edx,%ecx
+     1fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1fd:	8d 50 01             	lea    0x1(%rax),%edx
+     200:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     203:	89 c9                	mov    %ecx,%ecx
+     205:	48 8d 15 24 2e 00 00 	lea    0x2e24(%rip),%rdx        # 3030 <digits.0>
+     20c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     210:	48 98                	cltq
+     212:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     216:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     219:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     21c:	ba 00 00 00 00       	mov    $0x0,%edx
+     221:	f7 f6                	div    %esi
+     223:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     226:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     22a:	75 bf                	jne    1eb <printint+0x45>
+  if (neg)
+     22c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     230:	74 2b                	je     25d <printint+0xb7>
+    buf[i++] = '-';
+     232:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     235:	8d 50 01             	lea    0x1(%rax),%edx
+     238:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     23b:	48 98                	cltq
+     23d:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     242:	eb 19                	jmp    25d <printint+0xb7>
+    putc(fd, buf[i]);
+     244:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     247:	48 98                	cltq
+     249:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     24e:	0f be d0             	movsbl %al,%edx
+     251:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     254:	89 d6                	mov    %edx,%esi
+     256:	89 c7                	mov    %eax,%edi
+     258:	e8 50 fe ff ff       	call   ad <putc>
+  while (--i >= 0)
+     25d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     261:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     265:	79 dd                	jns    244 <printint+0x9e>
+}
+     267:	90                   	nop
+     268:	90                   	nop
+     269:	c9                   	leave
+     26a:	c3                   	ret
+
+000000000000026b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     26b:	55                   	push   %rbp
+     26c:	48 89 e5             	mov    %rsp,%rbp
+     26f:	48 83 ec 70          	sub    $0x70,%rsp
+     273:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     276:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     27a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     27e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     282:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     286:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     28a:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     291:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     295:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     299:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     29d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     2a1:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     2a8:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     2af:	e9 67 02 00 00       	jmp    51b <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     2b4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     2b7:	48 63 d0             	movslq %eax,%rdx
+     2ba:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     2be:	48 01 d0             	add    %rdx,%rax
+     2c1:	0f b6 00             	movzbl (%rax),%eax
+     2c4:	0f be c0             	movsbl %al,%eax
+     2c7:	25 ff 00 00 00       	and    $0xff,%eax
+     2cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     2cf:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     2d3:	75 30                	jne    305 <printf+0x9a>
+      if (c == '%') {
+     2d5:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     2d9:	75 13                	jne    2ee <printf+0x83>
+        state = '%';
+     2db:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     2e2:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     2e9:	e9 29 02 00 00       	jmp    517 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     2ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     2f1:	0f be d0             	movsbl %al,%edx
+     2f4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     2f7:	89 d6                	mov    %edx,%esi
+     2f9:	89 c7                	mov    %eax,%edi
+     2fb:	e8 ad fd ff ff       	call   ad <putc>
+     300:	e9 12 02 00 00       	jmp    517 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     305:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     309:	0f 85 08 02 00 00    	jne    517 <printf+0x2ac>
+      if (c == 'l') {
+     30f:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     313:	75 0c                	jne    321 <printf+0xb6>
+        lflag = 1;
+     315:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     31c:	e9 f6 01 00 00       	jmp    517 <printf+0x2ac>
+      } else if (c == 'd') {
+     321:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     325:	0f 85 93 00 00 00    	jne    3be <printf+0x153>
+        if (lflag == 1)
+     32b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     32f:	75 47                	jne    378 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     331:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     334:	83 f8 2f             	cmp    $0x2f,%eax
+     337:	77 17                	ja     350 <printf+0xe5>
+     339:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     33d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     340:	89 d2                	mov    %edx,%edx
+     342:	48 01 d0             	add    %rdx,%rax
+     345:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     348:	83 c2 08             	add    $0x8,%edx
+     34b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     34e:	eb 0c                	jmp    35c <printf+0xf1>
+     350:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     354:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     358:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     35c:	48 8b 30             	mov    (%rax),%rsi
+     35f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     362:	b9 01 00 00 00       	mov    $0x1,%ecx
+     367:	ba 0a 00 00 00       	mov    $0xa,%edx
+     36c:	89 c7                	mov    %eax,%edi
+     36e:	e8 5d fd ff ff       	call   d0 <printint64>
+     373:	e9 98 01 00 00       	jmp    510 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     378:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     37b:	83 f8 2f             	cmp    $0x2f,%eax
+     37e:	77 17                	ja     397 <printf+0x12c>
+     380:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     384:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     387:	89 d2                	mov    %edx,%edx
+     389:	48 01 d0             	add    %rdx,%rax
+     38c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     38f:	83 c2 08             	add    $0x8,%edx
+     392:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     395:	eb 0c                	jmp    3a3 <printf+0x138>
+     397:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     39b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     39f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3a3:	8b 30                	mov    (%rax),%esi
+     3a5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3a8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     3ad:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3b2:	89 c7                	mov    %eax,%edi
+     3b4:	e8 ed fd ff ff       	call   1a6 <printint>
+     3b9:	e9 52 01 00 00       	jmp    510 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     3be:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     3c2:	74 0a                	je     3ce <printf+0x163>
+     3c4:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     3c8:	0f 85 93 00 00 00    	jne    461 <printf+0x1f6>
+        if (lflag == 1)
+     3ce:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     3d2:	75 47                	jne    41b <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     3d4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3d7:	83 f8 2f             	cmp    $0x2f,%eax
+     3da:	77 17                	ja     3f3 <printf+0x188>
+     3dc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3e0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3e3:	89 d2                	mov    %edx,%edx
+     3e5:	48 01 d0             	add    %rdx,%rax
+     3e8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3eb:	83 c2 08             	add    $0x8,%edx
+     3ee:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3f1:	eb 0c                	jmp    3ff <printf+0x194>
+     3f3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3f7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3fb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3ff:	48 8b 30             	mov    (%rax),%rsi
+     402:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     405:	b9 00 00 00 00       	mov    $0x0,%ecx
+     40a:	ba 10 00 00 00       	mov    $0x10,%edx
+     40f:	89 c7                	mov    %eax,%edi
+     411:	e8 ba fc ff ff       	call   d0 <printint64>
+        if (lflag == 1)
+     416:	e9 f5 00 00 00       	jmp    510 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     41b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     41e:	83 f8 2f             	cmp    $0x2f,%eax
+     421:	77 17                	ja     43a <printf+0x1cf>
+     423:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     427:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     42a:	89 d2                	mov    %edx,%edx
+     42c:	48 01 d0             	add    %rdx,%rax
+     42f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     432:	83 c2 08             	add    $0x8,%edx
+     435:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     438:	eb 0c                	jmp    446 <printf+0x1db>
+     43a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     43e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     442:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     446:	8b 30                	mov    (%rax),%esi
+     448:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     44b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     450:	ba 10 00 00 00       	mov    $0x10,%edx
+     455:	89 c7                	mov    %eax,%edi
+     457:	e8 4a fd ff ff       	call   1a6 <printint>
+        if (lflag == 1)
+     45c:	e9 af 00 00 00       	jmp    510 <printf+0x2a5>
+      } else if (c == 's') {
+     461:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     465:	75 6e                	jne    4d5 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     467:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     46a:	83 f8 2f             	cmp    $0x2f,%eax
+     46d:	77 17                	ja     486 <printf+0x21b>
+     46f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     473:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     476:	89 d2                	mov    %edx,%edx
+     478:	48 01 d0             	add    %rdx,%rax
+     47b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     47e:	83 c2 08             	add    $0x8,%edx
+     481:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     484:	eb 0c                	jmp    492 <printf+0x227>
+     486:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     48a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     48e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     492:	48 8b 00             	mov    (%rax),%rax
+     495:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     499:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     49e:	75 28                	jne    4c8 <printf+0x25d>
+          s = "(null)";
+     4a0:	48 8d 05 13 1a 00 00 	lea    0x1a13(%rip),%rax        # 1eba <benchreport+0x182>
+     4a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     4ab:	eb 1b                	jmp    4c8 <printf+0x25d>
+          putc(fd, *s);
+     4ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     4b1:	0f b6 00             	movzbl (%rax),%eax
+     4b4:	0f be d0             	movsbl %al,%edx
+     4b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4ba:	89 d6                	mov    %edx,%esi
+     4bc:	89 c7                	mov    %eax,%edi
+     4be:	e8 ea fb ff ff       	call   ad <putc>
+        for (; *s; s++)
+     4c3:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     4c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     4cc:	0f b6 00             	movzbl (%rax),%eax
+     4cf:	84 c0                	test   %al,%al
+     4d1:	75 da                	jne    4ad <printf+0x242>
+     4d3:	eb 3b                	jmp    510 <printf+0x2a5>
+      } else if (c == '%') {
+     4d5:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     4d9:	75 14                	jne    4ef <printf+0x284>
+        putc(fd, c);
+     4db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4de:	0f be d0             	movsbl %al,%edx
+     4e1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4e4:	89 d6                	mov    %edx,%esi
+     4e6:	89 c7                	mov    %eax,%edi
+     4e8:	e8 c0 fb ff ff       	call   ad <putc>
+     4ed:	eb 21                	jmp    510 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     4ef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4f2:	be 25 00 00 00       	mov    $0x25,%esi
+     4f7:	89 c7                	mov    %eax,%edi
+     4f9:	e8 af fb ff ff       	call   ad <putc>
+        putc(fd, c);
+     4fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     501:	0f be d0             	movsbl %al,%edx
+     504:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     507:	89 d6                	mov    %edx,%esi
+     509:	89 c7                	mov    %eax,%edi
+     50b:	e8 9d fb ff ff       	call   ad <putc>
+      }
+      state = 0;
+     510:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     517:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     51b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     51e:	48 63 d0             	movslq %eax,%rdx
+     521:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     525:	48 01 d0             	add    %rdx,%rax
+     528:	0f b6 00             	movzbl (%rax),%eax
+     52b:	84 c0                	test   %al,%al
+     52d:	0f 85 81 fd ff ff    	jne    2b4 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     533:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     536:	89 c7                	mov    %eax,%edi
+     538:	e8 ee 02 00 00       	call   82b <bflushtty>
+}
+     53d:	90                   	nop
+     53e:	c9                   	leave
+     53f:	c3                   	ret
+
+0000000000000540 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     540:	55                   	push   %rbp
+     541:	48 89 e5             	mov    %rsp,%rbp
+     544:	48 83 ec 30          	sub    $0x30,%rsp
+     548:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     54b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     54f:	78 06                	js     557 <getbuf+0x17>
+     551:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     555:	7e 0a                	jle    561 <getbuf+0x21>
+    return 0;
+     557:	b8 00 00 00 00       	mov    $0x0,%eax
+     55c:	e9 94 00 00 00       	jmp    5f5 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     561:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     564:	48 98                	cltq
+     566:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     56d:	00 
+     56e:	48 8d 05 eb 2a 00 00 	lea    0x2aeb(%rip),%rax        # 3060 <obufs>
+     575:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     579:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     57d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     582:	75 6d                	jne    5f1 <getbuf+0xb1>
+     584:	bf 08 02 00 00       	mov    $0x208,%edi
+     589:	e8 bd 13 00 00       	call   194b <malloc>
+     58e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     592:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     597:	74 58                	je     5f1 <getbuf+0xb1>
+    b->n = 0;
+     599:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     59d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     5a3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     5a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5aa:	48 89 d6             	mov    %rdx,%rsi
+     5ad:	89 c7                	mov    %eax,%edi
+     5af:	e8 e4 0d 00 00       	call   1398 <fstat>
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	75 11                	jne    5c9 <getbuf+0x89>
+     5b8:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     5bc:	66 83 f8 03          	cmp    $0x3,%ax
+     5c0:	75 07                	jne    5c9 <getbuf+0x89>
+     5c2:	ba 01 00 00 00       	mov    $0x1,%edx
+     5c7:	eb 05                	jmp    5ce <getbuf+0x8e>
+     5c9:	ba 00 00 00 00       	mov    $0x0,%edx
+     5ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5d2:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     5d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5d8:	48 98                	cltq
+     5da:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     5e1:	00 
+     5e2:	48 8d 15 77 2a 00 00 	lea    0x2a77(%rip),%rdx        # 3060 <obufs>
+     5e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5ed:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     5f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5f5:	c9                   	leave
+     5f6:	c3                   	ret
+
+00000000000005f7 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     5f7:	55                   	push   %rbp
+     5f8:	48 89 e5             	mov    %rsp,%rbp
+     5fb:	48 83 ec 20          	sub    $0x20,%rsp
+     5ff:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     602:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     606:	78 33                	js     63b <bflush+0x44>
+     608:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     60c:	7f 2d                	jg     63b <bflush+0x44>
+     60e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     611:	48 98                	cltq
+     613:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     61a:	00 
+     61b:	48 8d 05 3e 2a 00 00 	lea    0x2a3e(%rip),%rax        # 3060 <obufs>
+     622:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     626:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     62a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     62f:	74 0a                	je     63b <bflush+0x44>
+     631:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     635:	8b 00                	mov    (%rax),%eax
+     637:	85 c0                	test   %eax,%eax
+     639:	75 07                	jne    642 <bflush+0x4b>
+    return 0;
+     63b:	b8 00 00 00 00       	mov    $0x0,%eax
+     640:	eb 3c                	jmp    67e <bflush+0x87>
+  n = b->n;
+     642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     646:	8b 00                	mov    (%rax),%eax
+     648:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     64b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     64f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     655:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     659:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     65d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     660:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     663:	48 89 ce             	mov    %rcx,%rsi
+     666:	89 c7                	mov    %eax,%edi
+     668:	e8 de 0c 00 00       	call   134b <write>
+     66d:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     670:	75 07                	jne    679 <bflush+0x82>
+     672:	b8 00 00 00 00       	mov    $0x0,%eax
+     677:	eb 05                	jmp    67e <bflush+0x87>
+     679:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     67e:	c9                   	leave
+     67f:	c3                   	ret
+
+0000000000000680 <bflushall>:
+
+void bflushall(void) {
+     680:	55                   	push   %rbp
+     681:	48 89 e5             	mov    %rsp,%rbp
+     684:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     688:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     68f:	eb 0e                	jmp    69f <bflushall+0x1f>
+    bflush(fd);
+     691:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     694:	89 c7                	mov    %eax,%edi
+     696:	e8 5c ff ff ff       	call   5f7 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     69b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     69f:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     6a3:	7e ec                	jle    691 <bflushall+0x11>
+}
+     6a5:	90                   	nop
+     6a6:	90                   	nop
+     6a7:	c9                   	leave
+     6a8:	c3                   	ret
+
+00000000000006a9 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     6a9:	55                   	push   %rbp
+     6aa:	48 89 e5             	mov    %rsp,%rbp
+     6ad:	48 83 ec 30          	sub    $0x30,%rsp
+     6b1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     6b4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     6b8:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     6bb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6be:	89 c7                	mov    %eax,%edi
+     6c0:	e8 7b fe ff ff       	call   540 <getbuf>
+     6c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     6c9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     6ce:	75 19                	jne    6e9 <bwrite+0x40>
+    return write(fd, s, n);
+     6d0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     6d3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     6d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6da:	48 89 ce             	mov    %rcx,%rsi
+     6dd:	89 c7                	mov    %eax,%edi
+     6df:	e8 67 0c 00 00       	call   134b <write>
+     6e4:	e9 cd 00 00 00       	jmp    7b6 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     6e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6f0:	e9 92 00 00 00       	jmp    787 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     6f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6f9:	8b 00                	mov    (%rax),%eax
+     6fb:	3d 00 02 00 00       	cmp    $0x200,%eax
+     700:	75 18                	jne    71a <bwrite+0x71>
+     702:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     705:	89 c7                	mov    %eax,%edi
+     707:	e8 eb fe ff ff       	call   5f7 <bflush>
+     70c:	85 c0                	test   %eax,%eax
+     70e:	79 0a                	jns    71a <bwrite+0x71>
+      return -1;
+     710:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     715:	e9 9c 00 00 00       	jmp    7b6 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     71a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     71d:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     720:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     723:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     727:	8b 00                	mov    (%rax),%eax
+     729:	ba 00 02 00 00       	mov    $0x200,%edx
+     72e:	29 c2                	sub    %eax,%edx
+     730:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     733:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     736:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     739:	39 c2                	cmp    %eax,%edx
+     73b:	0f 4e c2             	cmovle %edx,%eax
+     73e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     741:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     744:	48 63 d0             	movslq %eax,%rdx
+     747:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     74b:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     74f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     753:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     757:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     75b:	8b 00                	mov    (%rax),%eax
+     75d:	48 98                	cltq
+     75f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     763:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     766:	89 c2                	mov    %eax,%edx
+     768:	48 89 cf             	mov    %rcx,%rdi
+     76b:	e8 e9 06 00 00       	call   e59 <memmove>
+    b->n += m;
+     770:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     774:	8b 10                	mov    (%rax),%edx
+     776:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     779:	01 c2                	add    %eax,%edx
+     77b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     77f:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     781:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     784:	01 45 fc             	add    %eax,-0x4(%rbp)
+     787:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     78a:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     78d:	0f 8c 62 ff ff ff    	jl     6f5 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     797:	8b 40 04             	mov    0x4(%rax),%eax
+     79a:	85 c0                	test   %eax,%eax
+     79c:	74 15                	je     7b3 <bwrite+0x10a>
+     79e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7a1:	89 c7                	mov    %eax,%edi
+     7a3:	e8 4f fe ff ff       	call   5f7 <bflush>
+     7a8:	85 c0                	test   %eax,%eax
+     7aa:	79 07                	jns    7b3 <bwrite+0x10a>
+    return -1;
+     7ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7b1:	eb 03                	jmp    7b6 <bwrite+0x10d>
+  return n;
+     7b3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     7b6:	c9                   	leave
+     7b7:	c3                   	ret
+
+00000000000007b8 <bputc>:
+
+void bputc(int fd, char c) {
+     7b8:	55                   	push   %rbp
+     7b9:	48 89 e5             	mov    %rsp,%rbp
+     7bc:	48 83 ec 20          	sub    $0x20,%rsp
+     7c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     7c3:	89 f0                	mov    %esi,%eax
+     7c5:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     7c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7cb:	89 c7                	mov    %eax,%edi
+     7cd:	e8 6e fd ff ff       	call   540 <getbuf>
+     7d2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     7d6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     7db:	75 18                	jne    7f5 <bputc+0x3d>
+    write(fd, &c, 1);
+     7dd:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     7e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7e4:	ba 01 00 00 00       	mov    $0x1,%edx
+     7e9:	48 89 ce             	mov    %rcx,%rsi
+     7ec:	89 c7                	mov    %eax,%edi
+     7ee:	e8 58 0b 00 00       	call   134b <write>
+    return;
+     7f3:	eb 34                	jmp    829 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     7f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7f9:	8b 00                	mov    (%rax),%eax
+     7fb:	3d 00 02 00 00       	cmp    $0x200,%eax
+     800:	75 0a                	jne    80c <bputc+0x54>
+    bflush(fd);
+     802:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     805:	89 c7                	mov    %eax,%edi
+     807:	e8 eb fd ff ff       	call   5f7 <bflush>
+  b->data[b->n++] = c;
+     80c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     810:	8b 00                	mov    (%rax),%eax
+     812:	8d 48 01             	lea    0x1(%rax),%ecx
+     815:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     819:	89 0a                	mov    %ecx,(%rdx)
+     81b:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     81f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     823:	48 98                	cltq
+     825:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     829:	c9                   	leave
+     82a:	c3                   	ret
+
+000000000000082b <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     82b:	55                   	push   %rbp
+     82c:	48 89 e5             	mov    %rsp,%rbp
+     82f:	48 83 ec 10          	sub    $0x10,%rsp
+     833:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     836:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     83a:	78 4c                	js     888 <bflushtty+0x5d>
+     83c:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     840:	7f 46                	jg     888 <bflushtty+0x5d>
+     842:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     845:	48 98                	cltq
+     847:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     84e:	00 
+     84f:	48 8d 05 0a 28 00 00 	lea    0x280a(%rip),%rax        # 3060 <obufs>
+     856:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     85a:	48 85 c0             	test   %rax,%rax
+     85d:	74 29                	je     888 <bflushtty+0x5d>
+     85f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     862:	48 98                	cltq
+     864:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     86b:	00 
+     86c:	48 8d 05 ed 27 00 00 	lea    0x27ed(%rip),%rax        # 3060 <obufs>
+     873:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     877:	8b 40 04             	mov    0x4(%rax),%eax
+     87a:	85 c0                	test   %eax,%eax
+     87c:	74 0a                	je     888 <bflushtty+0x5d>
+    bflush(fd);
+     87e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     881:	89 c7                	mov    %eax,%edi
+     883:	e8 6f fd ff ff       	call   5f7 <bflush>
+}
+     888:	90                   	nop
+     889:	c9                   	leave
+     88a:	c3                   	ret
+
+000000000000088b <fork>:
+
+int fork(void) {
+     88b:	55                   	push   %rbp
+     88c:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     88f:	e8 ec fd ff ff       	call   680 <bflushall>
+  return _fork();
+     894:	e8 7b 0a 00 00       	call   1314 <_fork>
+}
+     899:	5d                   	pop    %rbp
+     89a:	c3                   	ret
+
+000000000000089b <exit>:
+
+noreturn void exit(void) {
+     89b:	55                   	push   %rbp
+     89c:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     89f:	e8 dc fd ff ff       	call   680 <bflushall>
+  _exit();
+     8a4:	e8 76 0a 00 00       	call   131f <_exit>
+
+00000000000008a9 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     8a9:	55                   	push   %rbp
+     8aa:	48 89 e5             	mov    %rsp,%rbp
+     8ad:	48 83 ec 10          	sub    $0x10,%rsp
+     8b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     8b9:	e8 c2 fd ff ff       	call   680 <bflushall>
+  return _exec(path, argv);
+     8be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     8c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8c6:	48 89 d6             	mov    %rdx,%rsi
+     8c9:	48 89 c7             	mov    %rax,%rdi
+     8cc:	e8 9b 0a 00 00       	call   136c <_exec>
+}
+     8d1:	c9                   	leave
+     8d2:	c3                   	ret
+
+00000000000008d3 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     8d3:	55                   	push   %rbp
+     8d4:	48 89 e5             	mov    %rsp,%rbp
+     8d7:	48 83 ec 20          	sub    $0x20,%rsp
+     8db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     8e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     8e7:	e8 94 fd ff ff       	call   680 <bflushall>
+  return _spawn(path, argv, fds);
+     8ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     8f0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8f8:	48 89 ce             	mov    %rcx,%rsi
+     8fb:	48 89 c7             	mov    %rax,%rdi
+     8fe:	e8 2f 0b 00 00       	call   1432 <_spawn>
+}
+     903:	c9                   	leave
+     904:	c3                   	ret
+
+0000000000000905 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     905:	55                   	push   %rbp
+     906:	48 89 e5             	mov    %rsp,%rbp
+     909:	48 83 ec 10          	sub    $0x10,%rsp
+     90d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     910:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     914:	78 69                	js     97f <close+0x7a>
+     916:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     91a:	7f 63                	jg     97f <close+0x7a>
+     91c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     91f:	48 98                	cltq
+     921:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     928:	00 
+     929:	48 8d 05 30 27 00 00 	lea    0x2730(%rip),%rax        # 3060 <obufs>
+     930:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     934:	48 85 c0             	test   %rax,%rax
+     937:	74 46                	je     97f <close+0x7a>
+    bflush(fd);
+     939:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     93c:	89 c7                	mov    %eax,%edi
+     93e:	e8 b4 fc ff ff       	call   5f7 <bflush>
+    free(obufs[fd]);
+     943:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     946:	48 98                	cltq
+     948:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     94f:	00 
+     950:	48 8d 05 09 27 00 00 	lea    0x2709(%rip),%rax        # 3060 <obufs>
+     957:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     95b:	48 89 c7             	mov    %rax,%rdi
+     95e:	e8 90 11 00 00       	call   1af3 <free>
+    obufs[fd] = 0;
+     963:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     966:	48 98                	cltq
+     968:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     96f:	00 
+     970:	48 8d 05 e9 26 00 00 	lea    0x26e9(%rip),%rax        # 3060 <obufs>
+     977:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     97e:	00 
+  }
+  return _close(fd);
+     97f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     982:	89 c7                	mov    %eax,%edi
+     984:	e8 cd 09 00 00       	call   1356 <_close>
+}
+     989:	c9                   	leave
+     98a:	c3                   	ret
+
+000000000000098b <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     98b:	55                   	push   %rbp
+     98c:	48 89 e5             	mov    %rsp,%rbp
+     98f:	53                   	push   %rbx
+     990:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     994:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     998:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     99c:	48 8b 36             	mov    (%rsi),%rsi
+     99f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     9a3:	48 29 f7             	sub    %rsi,%rdi
+     9a6:	48 89 f9             	mov    %rdi,%rcx
+     9a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+     9ae:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     9b2:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     9b6:	48 89 f0             	mov    %rsi,%rax
+     9b9:	ba 00 00 00 00       	mov    $0x0,%edx
+     9be:	48 89 df             	mov    %rbx,%rdi
+     9c1:	48 0f af f8          	imul   %rax,%rdi
+     9c5:	48 89 d6             	mov    %rdx,%rsi
+     9c8:	48 0f af f1          	imul   %rcx,%rsi
+     9cc:	48 01 fe             	add    %rdi,%rsi
+     9cf:	48 f7 e1             	mul    %rcx
+     9d2:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     9d6:	48 89 ca             	mov    %rcx,%rdx
+     9d9:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     9de:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     9e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     9e6:	c9                   	leave
+     9e7:	c3                   	ret
+
+00000000000009e8 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     9e8:	55                   	push   %rbp
+     9e9:	48 89 e5             	mov    %rsp,%rbp
+     9ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9f0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     9f3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     9f6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9fa:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     9fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a00:	48 89 ce             	mov    %rcx,%rsi
+     a03:	48 89 f7             	mov    %rsi,%rdi
+     a06:	89 d1                	mov    %edx,%ecx
+     a08:	fc                   	cld
+     a09:	f3 aa                	rep stos %al,%es:(%rdi)
+     a0b:	89 ca                	mov    %ecx,%edx
+     a0d:	48 89 fe             	mov    %rdi,%rsi
+     a10:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a14:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a17:	90                   	nop
+     a18:	5d                   	pop    %rbp
+     a19:	c3                   	ret
+
+0000000000000a1a <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     a1a:	55                   	push   %rbp
+     a1b:	48 89 e5             	mov    %rsp,%rbp
+     a1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     a2a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a36:	48 89 ce             	mov    %rcx,%rsi
+     a39:	48 89 f7             	mov    %rsi,%rdi
+     a3c:	48 89 d1             	mov    %rdx,%rcx
+     a3f:	fc                   	cld
+     a40:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     a43:	48 89 ca             	mov    %rcx,%rdx
+     a46:	48 89 fe             	mov    %rdi,%rsi
+     a49:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a4d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a51:	90                   	nop
+     a52:	5d                   	pop    %rbp
+     a53:	c3                   	ret
+
+0000000000000a54 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     a54:	55                   	push   %rbp
+     a55:	48 89 e5             	mov    %rsp,%rbp
+     a58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a60:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     a64:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a70:	48 89 cf             	mov    %rcx,%rdi
+     a73:	48 89 d6             	mov    %rdx,%rsi
+     a76:	48 89 c1             	mov    %rax,%rcx
+     a79:	fc                   	cld
+     a7a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     a7c:	48 89 c8             	mov    %rcx,%rax
+     a7f:	48 89 f2             	mov    %rsi,%rdx
+     a82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a86:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a8a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a8e:	90                   	nop
+     a8f:	5d                   	pop    %rbp
+     a90:	c3                   	ret
+
+0000000000000a91 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     a91:	55                   	push   %rbp
+     a92:	48 89 e5             	mov    %rsp,%rbp
+     a95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a9d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     aa1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     aa5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     aa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     aad:	48 89 cf             	mov    %rcx,%rdi
+     ab0:	48 89 d6             	mov    %rdx,%rsi
+     ab3:	48 89 c1             	mov    %rax,%rcx
+     ab6:	fc                   	cld
+     ab7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     aba:	48 89 c8             	mov    %rcx,%rax
+     abd:	48 89 f2             	mov    %rsi,%rdx
+     ac0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ac4:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     ac8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     acc:	90                   	nop
+     acd:	5d                   	pop    %rbp
+     ace:	c3                   	ret
+
+0000000000000acf <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     acf:	55                   	push   %rbp
+     ad0:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     ad3:	0f 31                	rdtsc
+     ad5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     ad8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     adb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     ade:	48 c1 e0 20          	shl    $0x20,%rax
+     ae2:	48 89 c2             	mov    %rax,%rdx
+     ae5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ae8:	48 09 d0             	or     %rdx,%rax
+}
+     aeb:	5d                   	pop    %rbp
+     aec:	c3                   	ret
+
+0000000000000aed <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     aed:	55                   	push   %rbp
+     aee:	48 89 e5             	mov    %rsp,%rbp
+     af1:	53                   	push   %rbx
+     af2:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     af5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     af9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     afd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     b01:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     b05:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b08:	0f a2                	cpuid
+     b0a:	89 de                	mov    %ebx,%esi
+     b0c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     b0f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     b12:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     b15:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     b18:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     b1d:	74 09                	je     b28 <cpuid+0x3b>
+    *eaxp = eax;
+     b1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     b23:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b26:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     b28:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     b2d:	74 09                	je     b38 <cpuid+0x4b>
+    *ebxp = ebx;
+     b2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     b33:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b36:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     b38:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b3d:	74 09                	je     b48 <cpuid+0x5b>
+    *ecxp = ecx;
+     b3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b43:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b46:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     b48:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     b4d:	74 09                	je     b58 <cpuid+0x6b>
+    *edxp = edx;
+     b4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     b53:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     b56:	89 10                	mov    %edx,(%rax)
+}
+     b58:	90                   	nop
+     b59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b5d:	c9                   	leave
+     b5e:	c3                   	ret
+
+0000000000000b5f <strcpy>:
+char *strcpy(char *s, char *t) {
+     b5f:	55                   	push   %rbp
+     b60:	48 89 e5             	mov    %rsp,%rbp
+     b63:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     b6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     b73:	90                   	nop
+     b74:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b78:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     b7c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     b80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b84:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     b88:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     b8c:	0f b6 12             	movzbl (%rdx),%edx
+     b8f:	88 10                	mov    %dl,(%rax)
+     b91:	0f b6 00             	movzbl (%rax),%eax
+     b94:	84 c0                	test   %al,%al
+     b96:	75 dc                	jne    b74 <strcpy+0x15>
+  return os;
+     b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b9c:	5d                   	pop    %rbp
+     b9d:	c3                   	ret
+
+0000000000000b9e <strcmp>:
+int strcmp(const char *p, const char *q) {
+     b9e:	55                   	push   %rbp
+     b9f:	48 89 e5             	mov    %rsp,%rbp
+     ba2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ba6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     baa:	eb 0a                	jmp    bb6 <strcmp+0x18>
+    p++, q++;
+     bac:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     bb1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     bb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bba:	0f b6 00             	movzbl (%rax),%eax
+     bbd:	84 c0                	test   %al,%al
+     bbf:	74 12                	je     bd3 <strcmp+0x35>
+     bc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bc5:	0f b6 10             	movzbl (%rax),%edx
+     bc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bcc:	0f b6 00             	movzbl (%rax),%eax
+     bcf:	38 c2                	cmp    %al,%dl
+     bd1:	74 d9                	je     bac <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     bd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bd7:	0f b6 00             	movzbl (%rax),%eax
+     bda:	0f b6 d0             	movzbl %al,%edx
+     bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     be1:	0f b6 00             	movzbl (%rax),%eax
+     be4:	0f b6 c0             	movzbl %al,%eax
+     be7:	29 c2                	sub    %eax,%edx
+     be9:	89 d0                	mov    %edx,%eax
+}
+     beb:	5d                   	pop    %rbp
+     bec:	c3                   	ret
+
+0000000000000bed <strlen>:
+uint strlen(char *s) {
+     bed:	55                   	push   %rbp
+     bee:	48 89 e5             	mov    %rsp,%rbp
+     bf1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     bf5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bfc:	eb 04                	jmp    c02 <strlen+0x15>
+     bfe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c02:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c05:	48 63 d0             	movslq %eax,%rdx
+     c08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c0c:	48 01 d0             	add    %rdx,%rax
+     c0f:	0f b6 00             	movzbl (%rax),%eax
+     c12:	84 c0                	test   %al,%al
+     c14:	75 e8                	jne    bfe <strlen+0x11>
+    ;
+  return n;
+     c16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c19:	5d                   	pop    %rbp
+     c1a:	c3                   	ret
+
+0000000000000c1b <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     c1b:	55                   	push   %rbp
+     c1c:	48 89 e5             	mov    %rsp,%rbp
+     c1f:	53                   	push   %rbx
+     c20:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     c24:	8b 05 1a 24 00 00    	mov    0x241a(%rip),%eax        # 3044 <erms>
+     c2a:	85 c0                	test   %eax,%eax
+     c2c:	79 53                	jns    c81 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     c2e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     c32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     c38:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+     c42:	48 89 c6             	mov    %rax,%rsi
+     c45:	bf 00 00 00 00       	mov    $0x0,%edi
+     c4a:	e8 9e fe ff ff       	call   aed <cpuid>
+    ebx = 0;
+     c4f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     c56:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c59:	83 f8 06             	cmp    $0x6,%eax
+     c5c:	76 14                	jbe    c72 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     c5e:	b8 07 00 00 00       	mov    $0x7,%eax
+     c63:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c68:	0f a2                	cpuid
+     c6a:	89 d9                	mov    %ebx,%ecx
+     c6c:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     c6f:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     c72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c75:	c1 e8 09             	shr    $0x9,%eax
+     c78:	83 e0 01             	and    $0x1,%eax
+     c7b:	89 05 c3 23 00 00    	mov    %eax,0x23c3(%rip)        # 3044 <erms>
+  }
+  return erms;
+     c81:	8b 05 bd 23 00 00    	mov    0x23bd(%rip),%eax        # 3044 <erms>
+}
+     c87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c8b:	c9                   	leave
+     c8c:	c3                   	ret
+
+0000000000000c8d <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     c8d:	55                   	push   %rbp
+     c8e:	48 89 e5             	mov    %rsp,%rbp
+     c91:	48 83 ec 10          	sub    $0x10,%rsp
+     c95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c99:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c9c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     c9f:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     ca3:	76 09                	jbe    cae <memset+0x21>
+     ca5:	e8 71 ff ff ff       	call   c1b <haserms>
+     caa:	85 c0                	test   %eax,%eax
+     cac:	74 16                	je     cc4 <memset+0x37>
+    stosb(dst, c, n);
+     cae:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     cb1:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     cb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb8:	89 ce                	mov    %ecx,%esi
+     cba:	48 89 c7             	mov    %rax,%rdi
+     cbd:	e8 26 fd ff ff       	call   9e8 <stosb>
+     cc2:	eb 58                	jmp    d1c <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     cc4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cc7:	c1 e8 03             	shr    $0x3,%eax
+     cca:	89 c6                	mov    %eax,%esi
+     ccc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ccf:	48 98                	cltq
+     cd1:	0f b6 c0             	movzbl %al,%eax
+     cd4:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     cdb:	01 01 01 
+     cde:	48 0f af c2          	imul   %rdx,%rax
+     ce2:	48 89 c1             	mov    %rax,%rcx
+     ce5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce9:	48 89 f2             	mov    %rsi,%rdx
+     cec:	48 89 ce             	mov    %rcx,%rsi
+     cef:	48 89 c7             	mov    %rax,%rdi
+     cf2:	e8 23 fd ff ff       	call   a1a <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     cf7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cfa:	83 e0 07             	and    $0x7,%eax
+     cfd:	89 c2                	mov    %eax,%edx
+     cff:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d02:	83 e0 f8             	and    $0xfffffff8,%eax
+     d05:	48 89 c1             	mov    %rax,%rcx
+     d08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d0c:	48 01 c1             	add    %rax,%rcx
+     d0f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d12:	89 c6                	mov    %eax,%esi
+     d14:	48 89 cf             	mov    %rcx,%rdi
+     d17:	e8 cc fc ff ff       	call   9e8 <stosb>
+  }
+  return dst;
+     d1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     d20:	c9                   	leave
+     d21:	c3                   	ret
+
+0000000000000d22 <strchr>:
+
+char *strchr(const char *s, char c) {
+     d22:	55                   	push   %rbp
+     d23:	48 89 e5             	mov    %rsp,%rbp
+     d26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d2a:	89 f0                	mov    %esi,%eax
+     d2c:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     d2f:	eb 17                	jmp    d48 <strchr+0x26>
+    if (*s == c)
+     d31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d35:	0f b6 00             	movzbl (%rax),%eax
+     d38:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     d3b:	75 06                	jne    d43 <strchr+0x21>
+      return (char *)s;
+     d3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d41:	eb 15                	jmp    d58 <strchr+0x36>
+  for (; *s; s++)
+     d43:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d4c:	0f b6 00             	movzbl (%rax),%eax
+     d4f:	84 c0                	test   %al,%al
+     d51:	75 de                	jne    d31 <strchr+0xf>
+  return 0;
+     d53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d58:	5d                   	pop    %rbp
+     d59:	c3                   	ret
+
+0000000000000d5a <gets>:
+
+char *gets(char *buf, int max) {
+     d5a:	55                   	push   %rbp
+     d5b:	48 89 e5             	mov    %rsp,%rbp
+     d5e:	48 83 ec 20          	sub    $0x20,%rsp
+     d62:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d66:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     d69:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d70:	eb 48                	jmp    dba <gets+0x60>
+    cc = read(0, &c, 1);
+     d72:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d76:	ba 01 00 00 00       	mov    $0x1,%edx
+     d7b:	48 89 c6             	mov    %rax,%rsi
+     d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+     d83:	e8 b8 05 00 00       	call   1340 <read>
+     d88:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     d8b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d8f:	7e 36                	jle    dc7 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d94:	8d 50 01             	lea    0x1(%rax),%edx
+     d97:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d9a:	48 63 d0             	movslq %eax,%rdx
+     d9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     da1:	48 01 c2             	add    %rax,%rdx
+     da4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     da8:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     daa:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     dae:	3c 0a                	cmp    $0xa,%al
+     db0:	74 16                	je     dc8 <gets+0x6e>
+     db2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     db6:	3c 0d                	cmp    $0xd,%al
+     db8:	74 0e                	je     dc8 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     dba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dbd:	83 c0 01             	add    $0x1,%eax
+     dc0:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     dc3:	7f ad                	jg     d72 <gets+0x18>
+     dc5:	eb 01                	jmp    dc8 <gets+0x6e>
+      break;
+     dc7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     dc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dcb:	48 63 d0             	movslq %eax,%rdx
+     dce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dd2:	48 01 d0             	add    %rdx,%rax
+     dd5:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     ddc:	c9                   	leave
+     ddd:	c3                   	ret
+
+0000000000000dde <stat>:
+
+int stat(char *n, struct stat *st) {
+     dde:	55                   	push   %rbp
+     ddf:	48 89 e5             	mov    %rsp,%rbp
+     de2:	48 83 ec 10          	sub    $0x10,%rsp
+     de6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     dee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     df2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     df6:	48 89 c6             	mov    %rax,%rsi
+     df9:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     dfe:	e8 58 07 00 00       	call   155b <fstatat>
+}
+     e03:	c9                   	leave
+     e04:	c3                   	ret
+
+0000000000000e05 <atoi>:
+
+int atoi(const char *s) {
+     e05:	55                   	push   %rbp
+     e06:	48 89 e5             	mov    %rsp,%rbp
+     e09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     e0d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e14:	eb 28                	jmp    e3e <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     e16:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e19:	89 d0                	mov    %edx,%eax
+     e1b:	c1 e0 02             	shl    $0x2,%eax
+     e1e:	01 d0                	add    %edx,%eax
+     e20:	01 c0                	add    %eax,%eax
+     e22:	89 c1                	mov    %eax,%ecx
+     e24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e28:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     e2c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     e30:	0f b6 00             	movzbl (%rax),%eax
+     e33:	0f be c0             	movsbl %al,%eax
+     e36:	01 c8                	add    %ecx,%eax
+     e38:	83 e8 30             	sub    $0x30,%eax
+     e3b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e42:	0f b6 00             	movzbl (%rax),%eax
+     e45:	3c 2f                	cmp    $0x2f,%al
+     e47:	7e 0b                	jle    e54 <atoi+0x4f>
+     e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e4d:	0f b6 00             	movzbl (%rax),%eax
+     e50:	3c 39                	cmp    $0x39,%al
+     e52:	7e c2                	jle    e16 <atoi+0x11>
+  return n;
+     e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e57:	5d                   	pop    %rbp
+     e58:	c3                   	ret
+
+0000000000000e59 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     e59:	55                   	push   %rbp
+     e5a:	48 89 e5             	mov    %rsp,%rbp
+     e5d:	48 83 ec 28          	sub    $0x28,%rsp
+     e61:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e65:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e69:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     e6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e70:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     e7c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e80:	7f 09                	jg     e8b <memmove+0x32>
+    return vdst;
+     e82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e86:	e9 29 01 00 00       	jmp    fb4 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     e8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e8f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     e93:	0f 83 87 00 00 00    	jae    f20 <memmove+0xc7>
+     e99:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e9c:	48 63 d0             	movslq %eax,%rdx
+     e9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea3:	48 01 d0             	add    %rdx,%rax
+     ea6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     eaa:	73 74                	jae    f20 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     eac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     eaf:	48 98                	cltq
+     eb1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     eb5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     eb8:	48 98                	cltq
+     eba:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     ebe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ec2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ec6:	48 09 d0             	or     %rdx,%rax
+     ec9:	83 e0 07             	and    $0x7,%eax
+     ecc:	48 85 c0             	test   %rax,%rax
+     ecf:	75 3d                	jne    f0e <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     ed1:	eb 1c                	jmp    eef <memmove+0x96>
+        src -= 8;
+     ed3:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     ed8:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     edd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee1:	48 8b 10             	mov    (%rax),%rdx
+     ee4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ee8:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     eeb:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     eef:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     ef3:	7f de                	jg     ed3 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     ef5:	eb 17                	jmp    f0e <memmove+0xb5>
+      *--dst = *--src;
+     ef7:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     efc:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     f01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f05:	0f b6 10             	movzbl (%rax),%edx
+     f08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f0c:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     f0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f11:	8d 50 ff             	lea    -0x1(%rax),%edx
+     f14:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     f17:	85 c0                	test   %eax,%eax
+     f19:	7f dc                	jg     ef7 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     f1b:	e9 90 00 00 00       	jmp    fb0 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     f20:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     f24:	7e 09                	jle    f2f <memmove+0xd6>
+     f26:	e8 f0 fc ff ff       	call   c1b <haserms>
+     f2b:	85 c0                	test   %eax,%eax
+     f2d:	74 1b                	je     f4a <memmove+0xf1>
+    movsb(dst, src, n);
+     f2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f32:	48 63 d0             	movslq %eax,%rdx
+     f35:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f3d:	48 89 ce             	mov    %rcx,%rsi
+     f40:	48 89 c7             	mov    %rax,%rdi
+     f43:	e8 0c fb ff ff       	call   a54 <movsb>
+     f48:	eb 66                	jmp    fb0 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     f4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f4d:	8d 50 07             	lea    0x7(%rax),%edx
+     f50:	85 c0                	test   %eax,%eax
+     f52:	0f 48 c2             	cmovs  %edx,%eax
+     f55:	c1 f8 03             	sar    $0x3,%eax
+     f58:	48 63 d0             	movslq %eax,%rdx
+     f5b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f63:	48 89 ce             	mov    %rcx,%rsi
+     f66:	48 89 c7             	mov    %rax,%rdi
+     f69:	e8 23 fb ff ff       	call   a91 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     f6e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f71:	89 d0                	mov    %edx,%eax
+     f73:	c1 f8 1f             	sar    $0x1f,%eax
+     f76:	c1 e8 1d             	shr    $0x1d,%eax
+     f79:	01 c2                	add    %eax,%edx
+     f7b:	83 e2 07             	and    $0x7,%edx
+     f7e:	29 c2                	sub    %eax,%edx
+     f80:	89 d0                	mov    %edx,%eax
+     f82:	48 98                	cltq
+     f84:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f87:	83 e2 f8             	and    $0xfffffff8,%edx
+     f8a:	48 63 ca             	movslq %edx,%rcx
+     f8d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f91:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     f95:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f98:	83 e2 f8             	and    $0xfffffff8,%edx
+     f9b:	48 63 ca             	movslq %edx,%rcx
+     f9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     fa2:	48 01 d1             	add    %rdx,%rcx
+     fa5:	48 89 c2             	mov    %rax,%rdx
+     fa8:	48 89 cf             	mov    %rcx,%rdi
+     fab:	e8 a4 fa ff ff       	call   a54 <movsb>
+  }
+  return vdst;
+     fb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     fb4:	c9                   	leave
+     fb5:	c3                   	ret
+
+0000000000000fb6 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+     fb6:	55                   	push   %rbp
+     fb7:	48 89 e5             	mov    %rsp,%rbp
+     fba:	48 83 ec 20          	sub    $0x20,%rsp
+     fbe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     fc1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+     fc5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+     fcc:	00 00 00 
+     fcf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+     fd3:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     fd7:	75 0d                	jne    fe6 <clock_gettime+0x30>
+     fd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fdd:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fe1:	48 85 c0             	test   %rax,%rax
+     fe4:	75 13                	jne    ff9 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+     fe6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     fea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fed:	48 89 d6             	mov    %rdx,%rsi
+     ff0:	89 c7                	mov    %eax,%edi
+     ff2:	e8 e0 04 00 00       	call   14d7 <_clock_gettime>
+     ff7:	eb 7d                	jmp    1076 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+     ff9:	e8 d1 fa ff ff       	call   acf <rdtsc>
+     ffe:	48 89 c2             	mov    %rax,%rdx
+    1001:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1005:	48 89 d6             	mov    %rdx,%rsi
+    1008:	48 89 c7             	mov    %rax,%rdi
+    100b:	e8 7b f9 ff ff       	call   98b <clockns>
+    1010:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1014:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1018:	48 c1 e8 09          	shr    $0x9,%rax
+    101c:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1023:	b8 44 00 
+    1026:	48 f7 e2             	mul    %rdx
+    1029:	48 89 d0             	mov    %rdx,%rax
+    102c:	48 c1 e8 0b          	shr    $0xb,%rax
+    1030:	48 89 c2             	mov    %rax,%rdx
+    1033:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1037:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    103a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    103e:	48 89 c8             	mov    %rcx,%rax
+    1041:	48 c1 e8 09          	shr    $0x9,%rax
+    1045:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    104c:	b8 44 00 
+    104f:	48 f7 e2             	mul    %rdx
+    1052:	48 89 d0             	mov    %rdx,%rax
+    1055:	48 c1 e8 0b          	shr    $0xb,%rax
+    1059:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1060:	48 89 c8             	mov    %rcx,%rax
+    1063:	48 29 d0             	sub    %rdx,%rax
+    1066:	48 89 c2             	mov    %rax,%rdx
+    1069:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    106d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1071:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1076:	c9                   	leave
+    1077:	c3                   	ret
+
+0000000000001078 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1078:	55                   	push   %rbp
+    1079:	48 89 e5             	mov    %rsp,%rbp
+    107c:	48 83 ec 10          	sub    $0x10,%rsp
+    1080:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1084:	eb 11                	jmp    1097 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1086:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    108a:	be 02 00 00 00       	mov    $0x2,%esi
+    108f:	48 89 c7             	mov    %rax,%rdi
+    1092:	e8 6c 04 00 00       	call   1503 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1097:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    109b:	b8 02 00 00 00       	mov    $0x2,%eax
+    10a0:	87 02                	xchg   %eax,(%rdx)
+    10a2:	85 c0                	test   %eax,%eax
+    10a4:	75 e0                	jne    1086 <mutex_wait+0xe>
+}
+    10a6:	90                   	nop
+    10a7:	90                   	nop
+    10a8:	c9                   	leave
+    10a9:	c3                   	ret
+
+00000000000010aa <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    10aa:	55                   	push   %rbp
+    10ab:	48 89 e5             	mov    %rsp,%rbp
+    10ae:	48 83 ec 20          	sub    $0x20,%rsp
+    10b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    10b6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    10bd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    10c1:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    10c5:	8b 02                	mov    (%rdx),%eax
+    10c7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10cc:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    10d0:	89 c1                	mov    %eax,%ecx
+    10d2:	0f 94 c0             	sete   %al
+    10d5:	84 c0                	test   %al,%al
+    10d7:	75 02                	jne    10db <mutex_lock+0x31>
+    10d9:	89 0a                	mov    %ecx,(%rdx)
+    10db:	83 f0 01             	xor    $0x1,%eax
+    10de:	84 c0                	test   %al,%al
+    10e0:	74 0c                	je     10ee <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    10e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10e6:	48 89 c7             	mov    %rax,%rdi
+    10e9:	e8 8a ff ff ff       	call   1078 <mutex_wait>
+}
+    10ee:	90                   	nop
+    10ef:	c9                   	leave
+    10f0:	c3                   	ret
+
+00000000000010f1 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    10f1:	55                   	push   %rbp
+    10f2:	48 89 e5             	mov    %rsp,%rbp
+    10f5:	48 83 ec 10          	sub    $0x10,%rsp
+    10f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    10fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1101:	ba 00 00 00 00       	mov    $0x0,%edx
+    1106:	87 10                	xchg   %edx,(%rax)
+    1108:	83 fa 02             	cmp    $0x2,%edx
+    110b:	75 11                	jne    111e <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    110d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1111:	be 01 00 00 00       	mov    $0x1,%esi
+    1116:	48 89 c7             	mov    %rax,%rdi
+    1119:	e8 f0 03 00 00       	call   150e <futex_wake>
+}
+    111e:	90                   	nop
+    111f:	c9                   	leave
+    1120:	c3                   	ret
+
+0000000000001121 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1121:	55                   	push   %rbp
+    1122:	48 89 e5             	mov    %rsp,%rbp
+    1125:	48 83 ec 20          	sub    $0x20,%rsp
+    1129:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    112d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1131:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1135:	48 83 c0 04          	add    $0x4,%rax
+    1139:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    113d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1141:	8b 00                	mov    (%rax),%eax
+    1143:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1146:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    114a:	48 89 c7             	mov    %rax,%rdi
+    114d:	e8 9f ff ff ff       	call   10f1 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1156:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1159:	89 d6                	mov    %edx,%esi
+    115b:	48 89 c7             	mov    %rax,%rdi
+    115e:	e8 a0 03 00 00       	call   1503 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1163:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1167:	48 83 c0 04          	add    $0x4,%rax
+    116b:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    116f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1173:	48 89 c7             	mov    %rax,%rdi
+    1176:	e8 fd fe ff ff       	call   1078 <mutex_wait>
+}
+    117b:	90                   	nop
+    117c:	c9                   	leave
+    117d:	c3                   	ret
+
+000000000000117e <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    117e:	55                   	push   %rbp
+    117f:	48 89 e5             	mov    %rsp,%rbp
+    1182:	48 83 ec 10          	sub    $0x10,%rsp
+    1186:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    118a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    118e:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1192:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1196:	48 83 c0 04          	add    $0x4,%rax
+    119a:	8b 00                	mov    (%rax),%eax
+    119c:	85 c0                	test   %eax,%eax
+    119e:	7e 11                	jle    11b1 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    11a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a4:	be 01 00 00 00       	mov    $0x1,%esi
+    11a9:	48 89 c7             	mov    %rax,%rdi
+    11ac:	e8 5d 03 00 00       	call   150e <futex_wake>
+}
+    11b1:	90                   	nop
+    11b2:	c9                   	leave
+    11b3:	c3                   	ret
+
+00000000000011b4 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    11b4:	55                   	push   %rbp
+    11b5:	48 89 e5             	mov    %rsp,%rbp
+    11b8:	48 83 ec 10          	sub    $0x10,%rsp
+    11bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    11c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11c4:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    11c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11cc:	48 83 c0 04          	add    $0x4,%rax
+    11d0:	8b 00                	mov    (%rax),%eax
+    11d2:	85 c0                	test   %eax,%eax
+    11d4:	7e 11                	jle    11e7 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    11d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11da:	be 00 00 00 40       	mov    $0x40000000,%esi
+    11df:	48 89 c7             	mov    %rax,%rdi
+    11e2:	e8 27 03 00 00       	call   150e <futex_wake>
+}
+    11e7:	90                   	nop
+    11e8:	c9                   	leave
+    11e9:	c3                   	ret
+
+00000000000011ea <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    11ea:	55                   	push   %rbp
+    11eb:	48 89 e5             	mov    %rsp,%rbp
+    11ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11f2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    11f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    11f9:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    11fd:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1201:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1205:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1209:	8b 40 04             	mov    0x4(%rax),%eax
+    120c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    120f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1213:	8b 00                	mov    (%rax),%eax
+    1215:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1218:	29 c2                	sub    %eax,%edx
+    121a:	83 fa 1f             	cmp    $0x1f,%edx
+    121d:	76 07                	jbe    1226 <ring_push+0x3c>
+    return -1;
+    121f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1224:	eb 7e                	jmp    12a4 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1226:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1229:	83 e0 1f             	and    $0x1f,%eax
+    122c:	89 c2                	mov    %eax,%edx
+    122e:	48 89 d0             	mov    %rdx,%rax
+    1231:	48 01 c0             	add    %rax,%rax
+    1234:	48 01 d0             	add    %rdx,%rax
+    1237:	48 c1 e0 04          	shl    $0x4,%rax
+    123b:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    123f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1243:	48 01 d0             	add    %rdx,%rax
+    1246:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    124a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    124e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1251:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1253:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1257:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    125b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    125f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1263:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1267:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    126b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    126f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1273:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1277:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    127b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    127f:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1283:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1287:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    128b:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    128f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1292:	8d 50 01             	lea    0x1(%rax),%edx
+    1295:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1299:	48 83 c0 04          	add    $0x4,%rax
+    129d:	89 10                	mov    %edx,(%rax)
+  return 0;
+    129f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12a4:	5d                   	pop    %rbp
+    12a5:	c3                   	ret
+
+00000000000012a6 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    12a6:	55                   	push   %rbp
+    12a7:	48 89 e5             	mov    %rsp,%rbp
+    12aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    12b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12b6:	8b 40 08             	mov    0x8(%rax),%eax
+    12b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    12bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12c0:	48 83 c0 0c          	add    $0xc,%rax
+    12c4:	8b 00                	mov    (%rax),%eax
+    12c6:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    12c9:	75 07                	jne    12d2 <ring_pop+0x2c>
+    return -1;
+    12cb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d0:	eb 40                	jmp    1312 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    12d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12d5:	83 e0 1f             	and    $0x1f,%eax
+    12d8:	89 c2                	mov    %eax,%edx
+    12da:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    12de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12e2:	89 d2                	mov    %edx,%edx
+    12e4:	48 83 c2 61          	add    $0x61,%rdx
+    12e8:	48 c1 e2 04          	shl    $0x4,%rdx
+    12ec:	48 01 d0             	add    %rdx,%rax
+    12ef:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    12f3:	48 8b 00             	mov    (%rax),%rax
+    12f6:	48 89 01             	mov    %rax,(%rcx)
+    12f9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    12fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1300:	8d 50 01             	lea    0x1(%rax),%edx
+    1303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1307:	48 83 c0 08          	add    $0x8,%rax
+    130b:	89 10                	mov    %edx,(%rax)
+  return 0;
+    130d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1312:	5d                   	pop    %rbp
+    1313:	c3                   	ret
+
+0000000000001314 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1314:	b8 01 00 00 00       	mov    $0x1,%eax
+    1319:	49 89 ca             	mov    %rcx,%r10
+    131c:	0f 05                	syscall
+    131e:	c3                   	ret
+
+000000000000131f <_exit>:
+SYSCALL_(exit)
+    131f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1324:	49 89 ca             	mov    %rcx,%r10
+    1327:	0f 05                	syscall
+    1329:	c3                   	ret
+
+000000000000132a <wait>:
+SYSCALL(wait)
+    132a:	b8 03 00 00 00       	mov    $0x3,%eax
+    132f:	49 89 ca             	mov    %rcx,%r10
+    1332:	0f 05                	syscall
+    1334:	c3                   	ret
+
+0000000000001335 <pipe>:
+SYSCALL(pipe)
+    1335:	b8 04 00 00 00       	mov    $0x4,%eax
+    133a:	49 89 ca             	mov    %rcx,%r10
+    133d:	0f 05                	syscall
+    133f:	c3                   	ret
+
+0000000000001340 <read>:
+SYSCALL(read)
+    1340:	b8 05 00 00 00       	mov    $0x5,%eax
+    1345:	49 89 ca             	mov    %rcx,%r10
+    1348:	0f 05                	syscall
+    134a:	c3                   	ret
+
+000000000000134b <write>:
+SYSCALL(write)
+    134b:	b8 10 00 00 00       	mov    $0x10,%eax
+    1350:	49 89 ca             	mov    %rcx,%r10
+    1353:	0f 05                	syscall
+    1355:	c3                   	ret
+
+0000000000001356 <_close>:
+SYSCALL_(close)
+    1356:	b8 15 00 00 00       	mov    $0x15,%eax
+    135b:	49 89 ca             	mov    %rcx,%r10
+    135e:	0f 05                	syscall
+    1360:	c3                   	ret
+
+0000000000001361 <kill>:
+SYSCALL(kill)
+    1361:	b8 06 00 00 00       	mov    $0x6,%eax
+    1366:	49 89 ca             	mov    %rcx,%r10
+    1369:	0f 05                	syscall
+    136b:	c3                   	ret
+
+000000000000136c <_exec>:
+SYSCALL_(exec)
+    136c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1371:	49 89 ca             	mov    %rcx,%r10
+    1374:	0f 05                	syscall
+    1376:	c3                   	ret
+
+0000000000001377 <open>:
+SYSCALL(open)
+    1377:	b8 0f 00 00 00       	mov    $0xf,%eax
+    137c:	49 89 ca             	mov    %rcx,%r10
+    137f:	0f 05                	syscall
+    1381:	c3                   	ret
+
+0000000000001382 <mknod>:
+SYSCALL(mknod)
+    1382:	b8 11 00 00 00       	mov    $0x11,%eax
+    1387:	49 89 ca             	mov    %rcx,%r10
+    138a:	0f 05                	syscall
+    138c:	c3                   	ret
+
+000000000000138d <unlink>:
+SYSCALL(unlink)
+    138d:	b8 12 00 00 00       	mov    $0x12,%eax
+    1392:	49 89 ca             	mov    %rcx,%r10
+    1395:	0f 05                	syscall
+    1397:	c3                   	ret
+
+0000000000001398 <fstat>:
+SYSCALL(fstat)
+    1398:	b8 08 00 00 00       	mov    $0x8,%eax
+    139d:	49 89 ca             	mov    %rcx,%r10
+    13a0:	0f 05                	syscall
+    13a2:	c3                   	ret
+
+00000000000013a3 <link>:
+SYSCALL(link)
+    13a3:	b8 13 00 00 00       	mov    $0x13,%eax
+    13a8:	49 89 ca             	mov    %rcx,%r10
+    13ab:	0f 05                	syscall
+    13ad:	c3                   	ret
+
+00000000000013ae <mkdir>:
+SYSCALL(mkdir)
+    13ae:	b8 14 00 00 00       	mov    $0x14,%eax
+    13b3:	49 89 ca             	mov    %rcx,%r10
+    13b6:	0f 05                	syscall
+    13b8:	c3                   	ret
+
+00000000000013b9 <chdir>:
+SYSCALL(chdir)
+    13b9:	b8 09 00 00 00       	mov    $0x9,%eax
+    13be:	49 89 ca             	mov    %rcx,%r10
+    13c1:	0f 05                	syscall
+    13c3:	c3                   	ret
+
+00000000000013c4 <dup>:
+SYSCALL(dup)
+    13c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13c9:	49 89 ca             	mov    %rcx,%r10
+    13cc:	0f 05                	syscall
+    13ce:	c3                   	ret
+
+00000000000013cf <getpid>:
+SYSCALL(getpid)
+    13cf:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13d4:	49 89 ca             	mov    %rcx,%r10
+    13d7:	0f 05                	syscall
+    13d9:	c3                   	ret
+
+00000000000013da <sbrk>:
+SYSCALL(sbrk)
+    13da:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13df:	49 89 ca             	mov    %rcx,%r10
+    13e2:	0f 05                	syscall
+    13e4:	c3                   	ret
+
+00000000000013e5 <sleep>:
+SYSCALL(sleep)
+    13e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13ea:	49 89 ca             	mov    %rcx,%r10
+    13ed:	0f 05                	syscall
+    13ef:	c3                   	ret
+
+00000000000013f0 <uptime>:
+SYSCALL(uptime)
+    13f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13f5:	49 89 ca             	mov    %rcx,%r10
+    13f8:	0f 05                	syscall
+    13fa:	c3                   	ret
+
+00000000000013fb <sysinfo>:
+SYSCALL(sysinfo)
+    13fb:	b8 16 00 00 00       	mov    $0x16,%eax
+    1400:	49 89 ca             	mov    %rcx,%r10
+    1403:	0f 05                	syscall
+    1405:	c3                   	ret
+
+0000000000001406 <crashn>:
+SYSCALL(crashn)
+    1406:	b8 17 00 00 00       	mov    $0x17,%eax
+    140b:	49 89 ca             	mov    %rcx,%r10
+    140e:	0f 05                	syscall
+    1410:	c3                   	ret
+
+0000000000001411 <mmap>:
+SYSCALL(mmap)
+    1411:	b8 18 00 00 00       	mov    $0x18,%eax
+    1416:	49 89 ca             	mov    %rcx,%r10
+    1419:	0f 05                	syscall
+    141b:	c3                   	ret
+
+000000000000141c <munmap>:
+SYSCALL(munmap)
+    141c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1421:	49 89 ca             	mov    %rcx,%r10
+    1424:	0f 05                	syscall
+    1426:	c3                   	ret
+
+0000000000001427 <nice>:
+SYSCALL(nice)
+    1427:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    142c:	49 89 ca             	mov    %rcx,%r10
+    142f:	0f 05                	syscall
+    1431:	c3                   	ret
+
+0000000000001432 <_spawn>:
+SYSCALL_(spawn)
+    1432:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1437:	49 89 ca             	mov    %rcx,%r10
+    143a:	0f 05                	syscall
+    143c:	c3                   	ret
+
+000000000000143d <pread>:
+SYSCALL(pread)
+    143d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1442:	49 89 ca             	mov    %rcx,%r10
+    1445:	0f 05                	syscall
+    1447:	c3                   	ret
+
+0000000000001448 <pwrite>:
+SYSCALL(pwrite)
+    1448:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    144d:	49 89 ca             	mov    %rcx,%r10
+    1450:	0f 05                	syscall
+    1452:	c3                   	ret
+
+0000000000001453 <readv>:
+SYSCALL(readv)
+    1453:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1458:	49 89 ca             	mov    %rcx,%r10
+    145b:	0f 05                	syscall
+    145d:	c3                   	ret
+
+000000000000145e <writev>:
+SYSCALL(writev)
+    145e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1463:	49 89 ca             	mov    %rcx,%r10
+    1466:	0f 05                	syscall
+    1468:	c3                   	ret
+
+0000000000001469 <sendfile>:
+SYSCALL(sendfile)
+    1469:	b8 20 00 00 00       	mov    $0x20,%eax
+    146e:	49 89 ca             	mov    %rcx,%r10
+    1471:	0f 05                	syscall
+    1473:	c3                   	ret
+
+0000000000001474 <splice>:
+SYSCALL(splice)
+    1474:	b8 21 00 00 00       	mov    $0x21,%eax
+    1479:	49 89 ca             	mov    %rcx,%r10
+    147c:	0f 05                	syscall
+    147e:	c3                   	ret
+
+000000000000147f <poll>:
+SYSCALL(poll)
+    147f:	b8 22 00 00 00       	mov    $0x22,%eax
+    1484:	49 89 ca             	mov    %rcx,%r10
+    1487:	0f 05                	syscall
+    1489:	c3                   	ret
+
+000000000000148a <fsync>:
+SYSCALL(fsync)
+    148a:	b8 23 00 00 00       	mov    $0x23,%eax
+    148f:	49 89 ca             	mov    %rcx,%r10
+    1492:	0f 05                	syscall
+    1494:	c3                   	ret
+
+0000000000001495 <fdatasync>:
+SYSCALL(fdatasync)
+    1495:	b8 24 00 00 00       	mov    $0x24,%eax
+    149a:	49 89 ca             	mov    %rcx,%r10
+    149d:	0f 05                	syscall
+    149f:	c3                   	ret
+
+00000000000014a0 <lockstat>:
+SYSCALL(lockstat)
+    14a0:	b8 25 00 00 00       	mov    $0x25,%eax
+    14a5:	49 89 ca             	mov    %rcx,%r10
+    14a8:	0f 05                	syscall
+    14aa:	c3                   	ret
+
+00000000000014ab <syscallstat>:
+SYSCALL(syscallstat)
+    14ab:	b8 26 00 00 00       	mov    $0x26,%eax
+    14b0:	49 89 ca             	mov    %rcx,%r10
+    14b3:	0f 05                	syscall
+    14b5:	c3                   	ret
+
+00000000000014b6 <trace>:
+SYSCALL(trace)
+    14b6:	b8 27 00 00 00       	mov    $0x27,%eax
+    14bb:	49 89 ca             	mov    %rcx,%r10
+    14be:	0f 05                	syscall
+    14c0:	c3                   	ret
+
+00000000000014c1 <profile>:
+SYSCALL(profile)
+    14c1:	b8 28 00 00 00       	mov    $0x28,%eax
+    14c6:	49 89 ca             	mov    %rcx,%r10
+    14c9:	0f 05                	syscall
+    14cb:	c3                   	ret
+
+00000000000014cc <cycles>:
+SYSCALL(cycles)
+    14cc:	b8 29 00 00 00       	mov    $0x29,%eax
+    14d1:	49 89 ca             	mov    %rcx,%r10
+    14d4:	0f 05                	syscall
+    14d6:	c3                   	ret
+
+00000000000014d7 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    14d7:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14dc:	49 89 ca             	mov    %rcx,%r10
+    14df:	0f 05                	syscall
+    14e1:	c3                   	ret
+
+00000000000014e2 <consmode>:
+SYSCALL(consmode)
+    14e2:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    14e7:	49 89 ca             	mov    %rcx,%r10
+    14ea:	0f 05                	syscall
+    14ec:	c3                   	ret
+
+00000000000014ed <clone>:
+SYSCALL(clone)
+    14ed:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    14f2:	49 89 ca             	mov    %rcx,%r10
+    14f5:	0f 05                	syscall
+    14f7:	c3                   	ret
+
+00000000000014f8 <join>:
+SYSCALL(join)
+    14f8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    14fd:	49 89 ca             	mov    %rcx,%r10
+    1500:	0f 05                	syscall
+    1502:	c3                   	ret
+
+0000000000001503 <futex_wait>:
+SYSCALL(futex_wait)
+    1503:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1508:	49 89 ca             	mov    %rcx,%r10
+    150b:	0f 05                	syscall
+    150d:	c3                   	ret
+
+000000000000150e <futex_wake>:
+SYSCALL(futex_wake)
+    150e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1513:	49 89 ca             	mov    %rcx,%r10
+    1516:	0f 05                	syscall
+    1518:	c3                   	ret
+
+0000000000001519 <shmget>:
+SYSCALL(shmget)
+    1519:	b8 30 00 00 00       	mov    $0x30,%eax
+    151e:	49 89 ca             	mov    %rcx,%r10
+    1521:	0f 05                	syscall
+    1523:	c3                   	ret
+
+0000000000001524 <shmat>:
+SYSCALL(shmat)
+    1524:	b8 31 00 00 00       	mov    $0x31,%eax
+    1529:	49 89 ca             	mov    %rcx,%r10
+    152c:	0f 05                	syscall
+    152e:	c3                   	ret
+
+000000000000152f <shmdt>:
+SYSCALL(shmdt)
+    152f:	b8 32 00 00 00       	mov    $0x32,%eax
+    1534:	49 89 ca             	mov    %rcx,%r10
+    1537:	0f 05                	syscall
+    1539:	c3                   	ret
+
+000000000000153a <ring_setup>:
+SYSCALL(ring_setup)
+    153a:	b8 33 00 00 00       	mov    $0x33,%eax
+    153f:	49 89 ca             	mov    %rcx,%r10
+    1542:	0f 05                	syscall
+    1544:	c3                   	ret
+
+0000000000001545 <ring_enter>:
+SYSCALL(ring_enter)
+    1545:	b8 34 00 00 00       	mov    $0x34,%eax
+    154a:	49 89 ca             	mov    %rcx,%r10
+    154d:	0f 05                	syscall
+    154f:	c3                   	ret
+
+0000000000001550 <getdents>:
+SYSCALL(getdents)
+    1550:	b8 35 00 00 00       	mov    $0x35,%eax
+    1555:	49 89 ca             	mov    %rcx,%r10
+    1558:	0f 05                	syscall
+    155a:	c3                   	ret
+
+000000000000155b <fstatat>:
+SYSCALL(fstatat)
+    155b:	b8 36 00 00 00       	mov    $0x36,%eax
+    1560:	49 89 ca             	mov    %rcx,%r10
+    1563:	0f 05                	syscall
+    1565:	c3                   	ret
+
+0000000000001566 <clone_file>:
+SYSCALL(clone_file)
+    1566:	b8 37 00 00 00       	mov    $0x37,%eax
+    156b:	49 89 ca             	mov    %rcx,%r10
+    156e:	0f 05                	syscall
+    1570:	c3                   	ret
+
+0000000000001571 <fpunch>:
+SYSCALL(fpunch)
+    1571:	b8 38 00 00 00       	mov    $0x38,%eax
+    1576:	49 89 ca             	mov    %rcx,%r10
+    1579:	0f 05                	syscall
+    157b:	c3                   	ret
+
+000000000000157c <defrag>:
+SYSCALL(defrag)
+    157c:	b8 39 00 00 00       	mov    $0x39,%eax
+    1581:	49 89 ca             	mov    %rcx,%r10
+    1584:	0f 05                	syscall
+    1586:	c3                   	ret
+
+0000000000001587 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1587:	55                   	push   %rbp
+    1588:	48 89 e5             	mov    %rsp,%rbp
+    158b:	48 83 ec 20          	sub    $0x20,%rsp
+    158f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1593:	bf 00 00 00 00       	mov    $0x0,%edi
+    1598:	e8 3d fe ff ff       	call   13da <sbrk>
+    159d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    15a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15a5:	48 f7 d8             	neg    %rax
+    15a8:	25 ff 0f 00 00       	and    $0xfff,%eax
+    15ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    15b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    15b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15b9:	48 01 c2             	add    %rax,%rdx
+    15bc:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    15c1:	48 39 c2             	cmp    %rax,%rdx
+    15c4:	73 1e                	jae    15e4 <morecore+0x5d>
+    15c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ca:	89 c2                	mov    %eax,%edx
+    15cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15d0:	01 d0                	add    %edx,%eax
+    15d2:	89 c7                	mov    %eax,%edi
+    15d4:	e8 01 fe ff ff       	call   13da <sbrk>
+    15d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15dd:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15e2:	75 07                	jne    15eb <morecore+0x64>
+    return 0;
+    15e4:	b8 00 00 00 00       	mov    $0x0,%eax
+    15e9:	eb 27                	jmp    1612 <morecore+0x8b>
+  stats.heap += n + pad;
+    15eb:	48 8b 05 9e 1b 00 00 	mov    0x1b9e(%rip),%rax        # 3190 <stats+0x50>
+    15f2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    15f6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    15fa:	48 01 ca             	add    %rcx,%rdx
+    15fd:	48 01 d0             	add    %rdx,%rax
+    1600:	48 89 05 89 1b 00 00 	mov    %rax,0x1b89(%rip)        # 3190 <stats+0x50>
+  return p + pad;
+    1607:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    160b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    160f:	48 01 d0             	add    %rdx,%rax
+}
+    1612:	c9                   	leave
+    1613:	c3                   	ret
+
+0000000000001614 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1614:	55                   	push   %rbp
+    1615:	48 89 e5             	mov    %rsp,%rbp
+    1618:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    161c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1620:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1627:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1628:	48 8d 05 f1 1a 00 00 	lea    0x1af1(%rip),%rax        # 3120 <runs>
+    162f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1633:	eb 1a                	jmp    164f <pagefree+0x3b>
+    prev = *rp;
+    1635:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1639:	48 8b 00             	mov    (%rax),%rax
+    163c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1640:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1644:	48 8b 00             	mov    (%rax),%rax
+    1647:	48 83 c0 08          	add    $0x8,%rax
+    164b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    164f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1653:	48 8b 00             	mov    (%rax),%rax
+    1656:	48 85 c0             	test   %rax,%rax
+    1659:	74 0d                	je     1668 <pagefree+0x54>
+    165b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    165f:	48 8b 00             	mov    (%rax),%rax
+    1662:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1666:	72 cd                	jb     1635 <pagefree+0x21>
+  r = (struct run *)p;
+    1668:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    166c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1670:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1674:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1678:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    167b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    167f:	48 8b 10             	mov    (%rax),%rdx
+    1682:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1686:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    168a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    168e:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1692:	48 85 c0             	test   %rax,%rax
+    1695:	74 48                	je     16df <pagefree+0xcb>
+    1697:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    169b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    169f:	48 01 c2             	add    %rax,%rdx
+    16a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16aa:	48 39 c2             	cmp    %rax,%rdx
+    16ad:	75 30                	jne    16df <pagefree+0xcb>
+    r->size += r->next->size;
+    16af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16b3:	48 8b 10             	mov    (%rax),%rdx
+    16b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16be:	48 8b 00             	mov    (%rax),%rax
+    16c1:	48 01 c2             	add    %rax,%rdx
+    16c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c8:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    16cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16d3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16db:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    16df:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16e4:	74 46                	je     172c <pagefree+0x118>
+    16e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ea:	48 8b 10             	mov    (%rax),%rdx
+    16ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f1:	48 01 d0             	add    %rdx,%rax
+    16f4:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    16f8:	75 32                	jne    172c <pagefree+0x118>
+    prev->size += r->size;
+    16fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16fe:	48 8b 10             	mov    (%rax),%rdx
+    1701:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1705:	48 8b 00             	mov    (%rax),%rax
+    1708:	48 01 c2             	add    %rax,%rdx
+    170b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170f:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1712:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1716:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    171a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    171e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1726:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    172a:	eb 0c                	jmp    1738 <pagefree+0x124>
+  } else {
+    *rp = r;
+    172c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1730:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1734:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1737:	90                   	nop
+    1738:	90                   	nop
+    1739:	5d                   	pop    %rbp
+    173a:	c3                   	ret
+
+000000000000173b <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    173b:	55                   	push   %rbp
+    173c:	48 89 e5             	mov    %rsp,%rbp
+    173f:	48 83 ec 40          	sub    $0x40,%rsp
+    1743:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1747:	48 8d 05 d2 19 00 00 	lea    0x19d2(%rip),%rax        # 3120 <runs>
+    174e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1752:	eb 66                	jmp    17ba <pagealloc+0x7f>
+    if (r->size == n) {
+    1754:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1758:	48 8b 00             	mov    (%rax),%rax
+    175b:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    175f:	75 18                	jne    1779 <pagealloc+0x3e>
+      *rp = r->next;
+    1761:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1765:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1769:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    176d:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1770:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1774:	e9 ca 00 00 00       	jmp    1843 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1779:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    177d:	48 8b 00             	mov    (%rax),%rax
+    1780:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1784:	73 28                	jae    17ae <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1786:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    178a:	48 8b 00             	mov    (%rax),%rax
+    178d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1791:	48 89 c2             	mov    %rax,%rdx
+    1794:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1798:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    179b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    179f:	48 8b 10             	mov    (%rax),%rdx
+    17a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a6:	48 01 d0             	add    %rdx,%rax
+    17a9:	e9 95 00 00 00       	jmp    1843 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    17ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17b2:	48 83 c0 08          	add    $0x8,%rax
+    17b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17be:	48 8b 00             	mov    (%rax),%rax
+    17c1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17c5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17ca:	75 88                	jne    1754 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    17cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    17d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    17d4:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    17db:	00 
+    17dc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17e4:	48 39 c2             	cmp    %rax,%rdx
+    17e7:	48 0f 43 c2          	cmovae %rdx,%rax
+    17eb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    17ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17f3:	48 89 c7             	mov    %rax,%rdi
+    17f6:	e8 8c fd ff ff       	call   1587 <morecore>
+    17fb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    17ff:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1804:	75 07                	jne    180d <pagealloc+0xd2>
+    return 0;
+    1806:	b8 00 00 00 00       	mov    $0x0,%eax
+    180b:	eb 36                	jmp    1843 <pagealloc+0x108>
+  if (m > n)
+    180d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1811:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1815:	73 1a                	jae    1831 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1817:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    181b:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    181f:	48 89 c2             	mov    %rax,%rdx
+    1822:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1826:	48 89 d6             	mov    %rdx,%rsi
+    1829:	48 89 c7             	mov    %rax,%rdi
+    182c:	e8 e3 fd ff ff       	call   1614 <pagefree>
+  return p + m - n;
+    1831:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1835:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1839:	48 89 c2             	mov    %rax,%rdx
+    183c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1840:	48 01 d0             	add    %rdx,%rax
+}
+    1843:	c9                   	leave
+    1844:	c3                   	ret
+
+0000000000001845 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1845:	55                   	push   %rbp
+    1846:	48 89 e5             	mov    %rsp,%rbp
+    1849:	48 83 ec 30          	sub    $0x30,%rsp
+    184d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1850:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1855:	e8 e1 fe ff ff       	call   173b <pagealloc>
+    185a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    185e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1863:	75 0a                	jne    186f <refill+0x2a>
+    return -1;
+    1865:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    186a:	e9 da 00 00 00       	jmp    1949 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    186f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1876:	00 
+    1877:	e9 ba 00 00 00       	jmp    1936 <refill+0xf1>
+    b = (struct block *)(p + off);
+    187c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1884:	48 01 d0             	add    %rdx,%rax
+    1887:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    188b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    188e:	ba 20 00 00 00       	mov    $0x20,%edx
+    1893:	89 c1                	mov    %eax,%ecx
+    1895:	48 d3 e2             	shl    %cl,%rdx
+    1898:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    189c:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    189f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18a2:	48 63 d0             	movslq %eax,%rdx
+    18a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18a9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    18ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18b0:	48 98                	cltq
+    18b2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    18b9:	00 
+    18ba:	48 8d 05 1f 18 00 00 	lea    0x181f(%rip),%rax        # 30e0 <freelist>
+    18c1:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    18c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18c9:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    18cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18d0:	48 98                	cltq
+    18d2:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    18d9:	00 
+    18da:	48 8d 15 ff 17 00 00 	lea    0x17ff(%rip),%rdx        # 30e0 <freelist>
+    18e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e5:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    18e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18ec:	48 98                	cltq
+    18ee:	48 83 c0 08          	add    $0x8,%rax
+    18f2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18f9:	00 
+    18fa:	48 8d 05 43 18 00 00 	lea    0x1843(%rip),%rax        # 3144 <stats+0x4>
+    1901:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1904:	8d 48 01             	lea    0x1(%rax),%ecx
+    1907:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    190a:	48 98                	cltq
+    190c:	48 83 c0 08          	add    $0x8,%rax
+    1910:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1917:	00 
+    1918:	48 8d 05 25 18 00 00 	lea    0x1825(%rip),%rax        # 3144 <stats+0x4>
+    191f:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1922:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1925:	ba 20 00 00 00       	mov    $0x20,%edx
+    192a:	89 c1                	mov    %eax,%ecx
+    192c:	48 d3 e2             	shl    %cl,%rdx
+    192f:	48 89 d0             	mov    %rdx,%rax
+    1932:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1936:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    193d:	00 
+    193e:	0f 86 38 ff ff ff    	jbe    187c <refill+0x37>
+  }
+  return 0;
+    1944:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1949:	c9                   	leave
+    194a:	c3                   	ret
+
+000000000000194b <malloc>:
+
+void *malloc(uint nbytes) {
+    194b:	55                   	push   %rbp
+    194c:	48 89 e5             	mov    %rsp,%rbp
+    194f:	48 83 ec 30          	sub    $0x30,%rsp
+    1953:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1956:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1959:	48 83 c0 10          	add    $0x10,%rax
+    195d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1961:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1968:	eb 04                	jmp    196e <malloc+0x23>
+    196a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    196e:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1972:	7f 16                	jg     198a <malloc+0x3f>
+    1974:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1977:	ba 20 00 00 00       	mov    $0x20,%edx
+    197c:	89 c1                	mov    %eax,%ecx
+    197e:	48 d3 e2             	shl    %cl,%rdx
+    1981:	48 89 d0             	mov    %rdx,%rax
+    1984:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1988:	72 e0                	jb     196a <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    198a:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    198e:	75 7d                	jne    1a0d <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1990:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1994:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    199a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    19a0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    19a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19a8:	48 89 c7             	mov    %rax,%rdi
+    19ab:	e8 8b fd ff ff       	call   173b <pagealloc>
+    19b0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    19b4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    19b9:	75 0a                	jne    19c5 <malloc+0x7a>
+      return 0;
+    19bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    19c0:	e9 2c 01 00 00       	jmp    1af1 <malloc+0x1a6>
+    h->size = n;
+    19c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19cd:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    19d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19d4:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    19db:	00 
+    stats.inuse[LARGE]++;
+    19dc:	8b 05 7e 17 00 00    	mov    0x177e(%rip),%eax        # 3160 <stats+0x20>
+    19e2:	83 c0 01             	add    $0x1,%eax
+    19e5:	89 05 75 17 00 00    	mov    %eax,0x1775(%rip)        # 3160 <stats+0x20>
+    stats.large += n;
+    19eb:	48 8b 15 96 17 00 00 	mov    0x1796(%rip),%rdx        # 3188 <stats+0x48>
+    19f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19f6:	48 01 d0             	add    %rdx,%rax
+    19f9:	48 89 05 88 17 00 00 	mov    %rax,0x1788(%rip)        # 3188 <stats+0x48>
+    return h + 1;
+    1a00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a04:	48 83 c0 10          	add    $0x10,%rax
+    1a08:	e9 e4 00 00 00       	jmp    1af1 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1a0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a10:	48 98                	cltq
+    1a12:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a19:	00 
+    1a1a:	48 8d 05 bf 16 00 00 	lea    0x16bf(%rip),%rax        # 30e0 <freelist>
+    1a21:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a25:	48 85 c0             	test   %rax,%rax
+    1a28:	75 18                	jne    1a42 <malloc+0xf7>
+    1a2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a2d:	89 c7                	mov    %eax,%edi
+    1a2f:	e8 11 fe ff ff       	call   1845 <refill>
+    1a34:	85 c0                	test   %eax,%eax
+    1a36:	79 0a                	jns    1a42 <malloc+0xf7>
+    return 0;
+    1a38:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a3d:	e9 af 00 00 00       	jmp    1af1 <malloc+0x1a6>
+  b = freelist[c];
+    1a42:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a45:	48 98                	cltq
+    1a47:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a4e:	00 
+    1a4f:	48 8d 05 8a 16 00 00 	lea    0x168a(%rip),%rax        # 30e0 <freelist>
+    1a56:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1a5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a62:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1a66:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1a69:	48 63 d2             	movslq %edx,%rdx
+    1a6c:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1a73:	00 
+    1a74:	48 8d 15 65 16 00 00 	lea    0x1665(%rip),%rdx        # 30e0 <freelist>
+    1a7b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1a7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a82:	48 98                	cltq
+    1a84:	48 83 c0 08          	add    $0x8,%rax
+    1a88:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a8f:	00 
+    1a90:	48 8d 05 ad 16 00 00 	lea    0x16ad(%rip),%rax        # 3144 <stats+0x4>
+    1a97:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a9a:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1a9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aa0:	48 98                	cltq
+    1aa2:	48 83 c0 08          	add    $0x8,%rax
+    1aa6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1aad:	00 
+    1aae:	48 8d 05 8f 16 00 00 	lea    0x168f(%rip),%rax        # 3144 <stats+0x4>
+    1ab5:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1ab8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1abb:	48 98                	cltq
+    1abd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ac4:	00 
+    1ac5:	48 8d 05 74 16 00 00 	lea    0x1674(%rip),%rax        # 3140 <stats>
+    1acc:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1acf:	8d 48 01             	lea    0x1(%rax),%ecx
+    1ad2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ad5:	48 98                	cltq
+    1ad7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ade:	00 
+    1adf:	48 8d 05 5a 16 00 00 	lea    0x165a(%rip),%rax        # 3140 <stats>
+    1ae6:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1ae9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aed:	48 83 c0 10          	add    $0x10,%rax
+}
+    1af1:	c9                   	leave
+    1af2:	c3                   	ret
+
+0000000000001af3 <free>:
+
+void free(void *ap) {
+    1af3:	55                   	push   %rbp
+    1af4:	48 89 e5             	mov    %rsp,%rbp
+    1af7:	48 83 ec 18          	sub    $0x18,%rsp
+    1afb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1aff:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1b04:	0f 84 03 01 00 00    	je     1c0d <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1b0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b0e:	48 83 e8 10          	sub    $0x10,%rax
+    1b12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b1e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1b22:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1b27:	75 42                	jne    1b6b <free+0x78>
+    stats.inuse[LARGE]--;
+    1b29:	8b 05 31 16 00 00    	mov    0x1631(%rip),%eax        # 3160 <stats+0x20>
+    1b2f:	83 e8 01             	sub    $0x1,%eax
+    1b32:	89 05 28 16 00 00    	mov    %eax,0x1628(%rip)        # 3160 <stats+0x20>
+    stats.large -= b->h.size;
+    1b38:	48 8b 15 49 16 00 00 	mov    0x1649(%rip),%rdx        # 3188 <stats+0x48>
+    1b3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b43:	48 8b 00             	mov    (%rax),%rax
+    1b46:	48 29 c2             	sub    %rax,%rdx
+    1b49:	48 89 15 38 16 00 00 	mov    %rdx,0x1638(%rip)        # 3188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b54:	48 8b 10             	mov    (%rax),%rdx
+    1b57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b5b:	48 89 d6             	mov    %rdx,%rsi
+    1b5e:	48 89 c7             	mov    %rax,%rdi
+    1b61:	e8 ae fa ff ff       	call   1614 <pagefree>
+    return;
+    1b66:	e9 a3 00 00 00       	jmp    1c0e <free+0x11b>
+  }
+  b->next = freelist[c];
+    1b6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b6f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b76:	00 
+    1b77:	48 8d 05 62 15 00 00 	lea    0x1562(%rip),%rax        # 30e0 <freelist>
+    1b7e:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b86:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1b8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b8e:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b95:	00 
+    1b96:	48 8d 15 43 15 00 00 	lea    0x1543(%rip),%rdx        # 30e0 <freelist>
+    1b9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba1:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1ba5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ba9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bb0:	00 
+    1bb1:	48 8d 05 88 15 00 00 	lea    0x1588(%rip),%rax        # 3140 <stats>
+    1bb8:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bbb:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1bbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bc9:	00 
+    1bca:	48 8d 05 6f 15 00 00 	lea    0x156f(%rip),%rax        # 3140 <stats>
+    1bd1:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1bd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bd8:	48 83 c0 08          	add    $0x8,%rax
+    1bdc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1be3:	00 
+    1be4:	48 8d 05 59 15 00 00 	lea    0x1559(%rip),%rax        # 3144 <stats+0x4>
+    1beb:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bee:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf5:	48 83 c0 08          	add    $0x8,%rax
+    1bf9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c00:	00 
+    1c01:	48 8d 05 3c 15 00 00 	lea    0x153c(%rip),%rax        # 3144 <stats+0x4>
+    1c08:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1c0b:	eb 01                	jmp    1c0e <free+0x11b>
+    return;
+    1c0d:	90                   	nop
+}
+    1c0e:	c9                   	leave
+    1c0f:	c3                   	ret
+
+0000000000001c10 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1c10:	55                   	push   %rbp
+    1c11:	48 89 e5             	mov    %rsp,%rbp
+    1c14:	48 83 ec 30          	sub    $0x30,%rsp
+    1c18:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1c1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c1e:	48 8d 15 a3 02 00 00 	lea    0x2a3(%rip),%rdx        # 1ec8 <benchreport+0x190>
+    1c25:	48 89 d6             	mov    %rdx,%rsi
+    1c28:	89 c7                	mov    %eax,%edi
+    1c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c2f:	e8 37 e6 ff ff       	call   26b <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c34:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1c3b:	eb 67                	jmp    1ca4 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1c3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c40:	48 98                	cltq
+    1c42:	48 83 c0 08          	add    $0x8,%rax
+    1c46:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c4d:	00 
+    1c4e:	48 8d 05 ef 14 00 00 	lea    0x14ef(%rip),%rax        # 3144 <stats+0x4>
+    1c55:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1c58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c5b:	48 98                	cltq
+    1c5d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c64:	00 
+    1c65:	48 8d 05 d4 14 00 00 	lea    0x14d4(%rip),%rax        # 3140 <stats>
+    1c6c:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1c6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c72:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c77:	89 c1                	mov    %eax,%ecx
+    1c79:	48 d3 e2             	shl    %cl,%rdx
+    1c7c:	48 89 d0             	mov    %rdx,%rax
+    1c7f:	89 c1                	mov    %eax,%ecx
+    1c81:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c87:	41 89 f9             	mov    %edi,%r9d
+    1c8a:	41 89 f0             	mov    %esi,%r8d
+    1c8d:	48 8d 35 4b 02 00 00 	lea    0x24b(%rip),%rsi        # 1edf <benchreport+0x1a7>
+    1c94:	89 c7                	mov    %eax,%edi
+    1c96:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c9b:	e8 cb e5 ff ff       	call   26b <printf>
+  for (c = 0; c < NCLASS; c++)
+    1ca0:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1ca4:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1ca8:	7e 93                	jle    1c3d <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1caa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1cb1:	00 
+  for (r = runs; r; r = r->next)
+    1cb2:	48 8b 05 67 14 00 00 	mov    0x1467(%rip),%rax        # 3120 <runs>
+    1cb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cbd:	eb 17                	jmp    1cd6 <mallocstats+0xc6>
+    nfree += r->size;
+    1cbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc3:	48 8b 00             	mov    (%rax),%rax
+    1cc6:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1cca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cce:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1cd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cd6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1cdb:	75 e2                	jne    1cbf <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1cdd:	48 8b 05 ac 14 00 00 	mov    0x14ac(%rip),%rax        # 3190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1ce4:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1ce6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cea:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cee:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cf0:	48 8b 05 91 14 00 00 	mov    0x1491(%rip),%rax        # 3188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cf7:	89 c1                	mov    %eax,%ecx
+    1cf9:	8b 15 61 14 00 00    	mov    0x1461(%rip),%edx        # 3160 <stats+0x20>
+    1cff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d02:	41 89 f9             	mov    %edi,%r9d
+    1d05:	41 89 f0             	mov    %esi,%r8d
+    1d08:	48 8d 35 e1 01 00 00 	lea    0x1e1(%rip),%rsi        # 1ef0 <benchreport+0x1b8>
+    1d0f:	89 c7                	mov    %eax,%edi
+    1d11:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d16:	e8 50 e5 ff ff       	call   26b <printf>
+}
+    1d1b:	90                   	nop
+    1d1c:	c9                   	leave
+    1d1d:	c3                   	ret
+
+0000000000001d1e <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1d1e:	55                   	push   %rbp
+    1d1f:	48 89 e5             	mov    %rsp,%rbp
+    1d22:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1d26:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1d2a:	48 89 c7             	mov    %rax,%rdi
+    1d2d:	e8 9a f7 ff ff       	call   14cc <cycles>
+  return t;
+    1d32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d36:	c9                   	leave
+    1d37:	c3                   	ret
+
+0000000000001d38 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1d38:	55                   	push   %rbp
+    1d39:	48 89 e5             	mov    %rsp,%rbp
+    1d3c:	48 83 ec 30          	sub    $0x30,%rsp
+    1d40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d44:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d48:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1d4b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1d4f:	0f 8e 24 01 00 00    	jle    1e79 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1d55:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1d5c:	e9 98 00 00 00       	jmp    1df9 <benchreport+0xc1>
+    x = t[i];
+    1d61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d64:	48 98                	cltq
+    1d66:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d6d:	00 
+    1d6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d72:	48 01 d0             	add    %rdx,%rax
+    1d75:	48 8b 00             	mov    (%rax),%rax
+    1d78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d7f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1d82:	eb 33                	jmp    1db7 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1d84:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d87:	48 98                	cltq
+    1d89:	48 c1 e0 03          	shl    $0x3,%rax
+    1d8d:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d95:	48 01 d0             	add    %rdx,%rax
+    1d98:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1d9b:	48 63 d2             	movslq %edx,%rdx
+    1d9e:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1da5:	00 
+    1da6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1daa:	48 01 ca             	add    %rcx,%rdx
+    1dad:	48 8b 00             	mov    (%rax),%rax
+    1db0:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1db3:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1db7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1dbb:	7e 1d                	jle    1dda <benchreport+0xa2>
+    1dbd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1dc0:	48 98                	cltq
+    1dc2:	48 c1 e0 03          	shl    $0x3,%rax
+    1dc6:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1dca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dce:	48 01 d0             	add    %rdx,%rax
+    1dd1:	48 8b 00             	mov    (%rax),%rax
+    1dd4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1dd8:	72 aa                	jb     1d84 <benchreport+0x4c>
+    t[j] = x;
+    1dda:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ddd:	48 98                	cltq
+    1ddf:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1de6:	00 
+    1de7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1deb:	48 01 c2             	add    %rax,%rdx
+    1dee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1df2:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1df5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1df9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dfc:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1dff:	0f 8c 5c ff ff ff    	jl     1d61 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1e05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e08:	48 98                	cltq
+    1e0a:	48 c1 e0 03          	shl    $0x3,%rax
+    1e0e:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e16:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e19:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1e1c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e1f:	89 c2                	mov    %eax,%edx
+    1e21:	c1 ea 1f             	shr    $0x1f,%edx
+    1e24:	01 d0                	add    %edx,%eax
+    1e26:	d1 f8                	sar    %eax
+    1e28:	48 98                	cltq
+    1e2a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e31:	00 
+    1e32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e36:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e39:	48 8b 38             	mov    (%rax),%rdi
+    1e3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e40:	48 8b 30             	mov    (%rax),%rsi
+    1e43:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1e46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e4a:	48 83 ec 08          	sub    $0x8,%rsp
+    1e4e:	51                   	push   %rcx
+    1e4f:	49 89 f9             	mov    %rdi,%r9
+    1e52:	49 89 f0             	mov    %rsi,%r8
+    1e55:	89 d1                	mov    %edx,%ecx
+    1e57:	48 89 c2             	mov    %rax,%rdx
+    1e5a:	48 8d 05 cf 00 00 00 	lea    0xcf(%rip),%rax        # 1f30 <benchreport+0x1f8>
+    1e61:	48 89 c6             	mov    %rax,%rsi
+    1e64:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e69:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e6e:	e8 f8 e3 ff ff       	call   26b <printf>
+    1e73:	48 83 c4 10          	add    $0x10,%rsp
+    1e77:	eb 01                	jmp    1e7a <benchreport+0x142>
+    return;
+    1e79:	90                   	nop
+}
+    1e7a:	c9                   	leave
+    1e7b:	c3                   	ret
@@ -0,0 +1,4640 @@
+
+out/user/_lab3test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void sbrktest(void);
+void growstacktest(void);
+void growstacktest_edgecase(void);
+void copyonwriteforktest(void);
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  memtest();
+       f:	e8 35 00 00 00       	call   49 <memtest>
+  sbrktest();
+      14:	e8 8c 01 00 00       	call   1a5 <sbrktest>
+  growstacktest();
+      19:	e8 ae 08 00 00       	call   8cc <growstacktest>
+  growstacktest_edgecase();
+      1e:	e8 d6 0a 00 00       	call   af9 <growstacktest_edgecase>
+  copyonwriteforktest();
+      23:	e8 f1 0c 00 00       	call   d19 <copyonwriteforktest>
+  printf(stdout, "lab3 tests passed!!\n");
+      28:	8b 05 d2 3f 00 00    	mov    0x3fd2(%rip),%eax        # 4000 <stdout>
+      2e:	48 8d 15 5b 2e 00 00 	lea    0x2e5b(%rip),%rdx        # 2e90 <benchreport+0x147>
+      35:	48 89 d6             	mov    %rdx,%rsi
+      38:	89 c7                	mov    %eax,%edi
+      3a:	b8 00 00 00 00       	mov    $0x0,%eax
+      3f:	e8 38 12 00 00       	call   127c <printf>
+
+  exit();
+      44:	e8 63 18 00 00       	call   18ac <exit>
+
+0000000000000049 <memtest>:
+  return 0;
+}
+
+void memtest() {
+      49:	55                   	push   %rbp
+      4a:	48 89 e5             	mov    %rsp,%rbp
+      4d:	48 83 ec 20          	sub    $0x20,%rsp
+  void *m1, *m2;
+  int pid;
+  int i;
+
+  printf(stdout, "memtest\n");
+      51:	8b 05 a9 3f 00 00    	mov    0x3fa9(%rip),%eax        # 4000 <stdout>
+      57:	48 8d 15 47 2e 00 00 	lea    0x2e47(%rip),%rdx        # 2ea5 <benchreport+0x15c>
+      5e:	48 89 d6             	mov    %rdx,%rsi
+      61:	89 c7                	mov    %eax,%edi
+      63:	b8 00 00 00 00       	mov    $0x0,%eax
+      68:	e8 0f 12 00 00       	call   127c <printf>
+  if ((pid = fork()) == 0) {
+      6d:	e8 2a 18 00 00       	call   189c <fork>
+      72:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      75:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+      79:	0f 85 02 01 00 00    	jne    181 <memtest+0x138>
+    m1 = 0;
+      7f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+      86:	00 
+    for (i = 0; i < 10; i++) {
+      87:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      8e:	eb 25                	jmp    b5 <memtest+0x6c>
+      m2 = malloc(10001);
+      90:	bf 11 27 00 00       	mov    $0x2711,%edi
+      95:	e8 c2 28 00 00       	call   295c <malloc>
+      9a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      *(char **)m2 = m1;
+      9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+      a6:	48 89 10             	mov    %rdx,(%rax)
+      m1 = m2;
+      a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (i = 0; i < 10; i++) {
+      b1:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+      b5:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+      b9:	7e d5                	jle    90 <memtest+0x47>
+    }
+    while (m1) {
+      bb:	eb 1f                	jmp    dc <memtest+0x93>
+      m2 = *(char **)m1;
+      bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      c1:	48 8b 00             	mov    (%rax),%rax
+      c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      free(m1);
+      c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      cc:	48 89 c7             	mov    %rax,%rdi
+      cf:	e8 30 2a 00 00       	call   2b04 <free>
+      m1 = m2;
+      d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    while (m1) {
+      dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      e1:	75 da                	jne    bd <memtest+0x74>
+    }
+    m1 = malloc(1024 * 20);
+      e3:	bf 00 50 00 00       	mov    $0x5000,%edi
+      e8:	e8 6f 28 00 00       	call   295c <malloc>
+      ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (m1 == 0) {
+      f1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      f6:	75 5c                	jne    154 <memtest+0x10b>
+      error("couldn't allocate mem?!!\n");
+      f8:	8b 05 02 3f 00 00    	mov    0x3f02(%rip),%eax        # 4000 <stdout>
+      fe:	ba 3d 00 00 00       	mov    $0x3d,%edx
+     103:	48 8d 0d a4 2d 00 00 	lea    0x2da4(%rip),%rcx        # 2eae <benchreport+0x165>
+     10a:	48 89 ce             	mov    %rcx,%rsi
+     10d:	89 c7                	mov    %eax,%edi
+     10f:	b8 00 00 00 00       	mov    $0x0,%eax
+     114:	e8 63 11 00 00       	call   127c <printf>
+     119:	8b 05 e1 3e 00 00    	mov    0x3ee1(%rip),%eax        # 4000 <stdout>
+     11f:	48 8d 15 9a 2d 00 00 	lea    0x2d9a(%rip),%rdx        # 2ec0 <benchreport+0x177>
+     126:	48 89 d6             	mov    %rdx,%rsi
+     129:	89 c7                	mov    %eax,%edi
+     12b:	b8 00 00 00 00       	mov    $0x0,%eax
+     130:	e8 47 11 00 00       	call   127c <printf>
+     135:	8b 05 c5 3e 00 00    	mov    0x3ec5(%rip),%eax        # 4000 <stdout>
+     13b:	48 8d 15 98 2d 00 00 	lea    0x2d98(%rip),%rdx        # 2eda <benchreport+0x191>
+     142:	48 89 d6             	mov    %rdx,%rsi
+     145:	89 c7                	mov    %eax,%edi
+     147:	b8 00 00 00 00       	mov    $0x0,%eax
+     14c:	e8 2b 11 00 00       	call   127c <printf>
+     151:	90                   	nop
+     152:	eb fd                	jmp    151 <memtest+0x108>
+    }
+    free(m1);
+     154:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     158:	48 89 c7             	mov    %rax,%rdi
+     15b:	e8 a4 29 00 00       	call   2b04 <free>
+    printf(stdout, "mem ok\n");
+     160:	8b 05 9a 3e 00 00    	mov    0x3e9a(%rip),%eax        # 4000 <stdout>
+     166:	48 8d 15 6f 2d 00 00 	lea    0x2d6f(%rip),%rdx        # 2edc <benchreport+0x193>
+     16d:	48 89 d6             	mov    %rdx,%rsi
+     170:	89 c7                	mov    %eax,%edi
+     172:	b8 00 00 00 00       	mov    $0x0,%eax
+     177:	e8 00 11 00 00       	call   127c <printf>
+    exit();
+     17c:	e8 2b 17 00 00       	call   18ac <exit>
+  } else {
+    wait();
+     181:	e8 b5 21 00 00       	call   233b <wait>
+  }
+  printf(stdout, "memtest passed\n");
+     186:	8b 05 74 3e 00 00    	mov    0x3e74(%rip),%eax        # 4000 <stdout>
+     18c:	48 8d 15 51 2d 00 00 	lea    0x2d51(%rip),%rdx        # 2ee4 <benchreport+0x19b>
+     193:	48 89 d6             	mov    %rdx,%rsi
+     196:	89 c7                	mov    %eax,%edi
+     198:	b8 00 00 00 00       	mov    $0x0,%eax
+     19d:	e8 da 10 00 00       	call   127c <printf>
+}
+     1a2:	90                   	nop
+     1a3:	c9                   	leave
+     1a4:	c3                   	ret
+
+00000000000001a5 <sbrktest>:
+
+void sbrktest(void) {
+     1a5:	55                   	push   %rbp
+     1a6:	48 89 e5             	mov    %rsp,%rbp
+     1a9:	48 81 ec 80 03 00 00 	sub    $0x380,%rsp
+  int pid, free_pages;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p;
+  uint64_t amt;
+  struct sys_info info;
+
+  printf(stdout, "sbrktest\n");
+     1b0:	8b 05 4a 3e 00 00    	mov    0x3e4a(%rip),%eax        # 4000 <stdout>
+     1b6:	48 8d 15 37 2d 00 00 	lea    0x2d37(%rip),%rdx        # 2ef4 <benchreport+0x1ab>
+     1bd:	48 89 d6             	mov    %rdx,%rsi
+     1c0:	89 c7                	mov    %eax,%edi
+     1c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c7:	e8 b0 10 00 00       	call   127c <printf>
+  oldbrk = sbrk(0);
+     1cc:	bf 00 00 00 00       	mov    $0x0,%edi
+     1d1:	e8 15 22 00 00       	call   23eb <sbrk>
+     1d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+     1da:	bf 00 00 00 00       	mov    $0x0,%edi
+     1df:	e8 07 22 00 00       	call   23eb <sbrk>
+     1e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  int i;
+  for (i = 0; i < 5000; i++) {
+     1e8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     1ef:	e9 96 00 00 00       	jmp    28a <sbrktest+0xe5>
+    b = sbrk(1);
+     1f4:	bf 01 00 00 00       	mov    $0x1,%edi
+     1f9:	e8 ed 21 00 00       	call   23eb <sbrk>
+     1fe:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    if (b != a) {
+     202:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     206:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     20a:	74 67                	je     273 <sbrktest+0xce>
+      error("sbrk test failed %d %x %x\n", i, a, b);
+     20c:	8b 05 ee 3d 00 00    	mov    0x3dee(%rip),%eax        # 4000 <stdout>
+     212:	ba 57 00 00 00       	mov    $0x57,%edx
+     217:	48 8d 0d 90 2c 00 00 	lea    0x2c90(%rip),%rcx        # 2eae <benchreport+0x165>
+     21e:	48 89 ce             	mov    %rcx,%rsi
+     221:	89 c7                	mov    %eax,%edi
+     223:	b8 00 00 00 00       	mov    $0x0,%eax
+     228:	e8 4f 10 00 00       	call   127c <printf>
+     22d:	8b 05 cd 3d 00 00    	mov    0x3dcd(%rip),%eax        # 4000 <stdout>
+     233:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+     237:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     23b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     23e:	49 89 f0             	mov    %rsi,%r8
+     241:	48 8d 35 b6 2c 00 00 	lea    0x2cb6(%rip),%rsi        # 2efe <benchreport+0x1b5>
+     248:	89 c7                	mov    %eax,%edi
+     24a:	b8 00 00 00 00       	mov    $0x0,%eax
+     24f:	e8 28 10 00 00       	call   127c <printf>
+     254:	8b 05 a6 3d 00 00    	mov    0x3da6(%rip),%eax        # 4000 <stdout>
+     25a:	48 8d 15 79 2c 00 00 	lea    0x2c79(%rip),%rdx        # 2eda <benchreport+0x191>
+     261:	48 89 d6             	mov    %rdx,%rsi
+     264:	89 c7                	mov    %eax,%edi
+     266:	b8 00 00 00 00       	mov    $0x0,%eax
+     26b:	e8 0c 10 00 00       	call   127c <printf>
+     270:	90                   	nop
+     271:	eb fd                	jmp    270 <sbrktest+0xcb>
+    }
+    *b = 1;
+     273:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     277:	c6 00 01             	movb   $0x1,(%rax)
+    a = b + 1;
+     27a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+     27e:	48 83 c0 01          	add    $0x1,%rax
+     282:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for (i = 0; i < 5000; i++) {
+     286:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     28a:	81 7d f4 87 13 00 00 	cmpl   $0x1387,-0xc(%rbp)
+     291:	0f 8e 5d ff ff ff    	jle    1f4 <sbrktest+0x4f>
+  }
+  pid = fork();
+     297:	e8 00 16 00 00       	call   189c <fork>
+     29c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if (pid < 0) {
+     29f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     2a3:	79 5c                	jns    301 <sbrktest+0x15c>
+    error("sbrk test fork failed\n");
+     2a5:	8b 05 55 3d 00 00    	mov    0x3d55(%rip),%eax        # 4000 <stdout>
+     2ab:	ba 5e 00 00 00       	mov    $0x5e,%edx
+     2b0:	48 8d 0d f7 2b 00 00 	lea    0x2bf7(%rip),%rcx        # 2eae <benchreport+0x165>
+     2b7:	48 89 ce             	mov    %rcx,%rsi
+     2ba:	89 c7                	mov    %eax,%edi
+     2bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c1:	e8 b6 0f 00 00       	call   127c <printf>
+     2c6:	8b 05 34 3d 00 00    	mov    0x3d34(%rip),%eax        # 4000 <stdout>
+     2cc:	48 8d 15 46 2c 00 00 	lea    0x2c46(%rip),%rdx        # 2f19 <benchreport+0x1d0>
+     2d3:	48 89 d6             	mov    %rdx,%rsi
+     2d6:	89 c7                	mov    %eax,%edi
+     2d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2dd:	e8 9a 0f 00 00       	call   127c <printf>
+     2e2:	8b 05 18 3d 00 00    	mov    0x3d18(%rip),%eax        # 4000 <stdout>
+     2e8:	48 8d 15 eb 2b 00 00 	lea    0x2beb(%rip),%rdx        # 2eda <benchreport+0x191>
+     2ef:	48 89 d6             	mov    %rdx,%rsi
+     2f2:	89 c7                	mov    %eax,%edi
+     2f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f9:	e8 7e 0f 00 00       	call   127c <printf>
+     2fe:	90                   	nop
+     2ff:	eb fd                	jmp    2fe <sbrktest+0x159>
+  }
+  c = sbrk(1);  
+     301:	bf 01 00 00 00       	mov    $0x1,%edi
+     306:	e8 e0 20 00 00       	call   23eb <sbrk>
+     30b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  c = sbrk(1);
+     30f:	bf 01 00 00 00       	mov    $0x1,%edi
+     314:	e8 d2 20 00 00       	call   23eb <sbrk>
+     319:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if (c != a + 1) {
+     31d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     321:	48 83 c0 01          	add    $0x1,%rax
+     325:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     329:	74 5c                	je     387 <sbrktest+0x1e2>
+    error("sbrk test failed post-fork\n");
+     32b:	8b 05 cf 3c 00 00    	mov    0x3ccf(%rip),%eax        # 4000 <stdout>
+     331:	ba 63 00 00 00       	mov    $0x63,%edx
+     336:	48 8d 0d 71 2b 00 00 	lea    0x2b71(%rip),%rcx        # 2eae <benchreport+0x165>
+     33d:	48 89 ce             	mov    %rcx,%rsi
+     340:	89 c7                	mov    %eax,%edi
+     342:	b8 00 00 00 00       	mov    $0x0,%eax
+     347:	e8 30 0f 00 00       	call   127c <printf>
+     34c:	8b 05 ae 3c 00 00    	mov    0x3cae(%rip),%eax        # 4000 <stdout>
+     352:	48 8d 15 d7 2b 00 00 	lea    0x2bd7(%rip),%rdx        # 2f30 <benchreport+0x1e7>
+     359:	48 89 d6             	mov    %rdx,%rsi
+     35c:	89 c7                	mov    %eax,%edi
+     35e:	b8 00 00 00 00       	mov    $0x0,%eax
+     363:	e8 14 0f 00 00       	call   127c <printf>
+     368:	8b 05 92 3c 00 00    	mov    0x3c92(%rip),%eax        # 4000 <stdout>
+     36e:	48 8d 15 65 2b 00 00 	lea    0x2b65(%rip),%rdx        # 2eda <benchreport+0x191>
+     375:	48 89 d6             	mov    %rdx,%rsi
+     378:	89 c7                	mov    %eax,%edi
+     37a:	b8 00 00 00 00       	mov    $0x0,%eax
+     37f:	e8 f8 0e 00 00       	call   127c <printf>
+     384:	90                   	nop
+     385:	eb fd                	jmp    384 <sbrktest+0x1df>
+  }
+  if (pid == 0)
+     387:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     38b:	75 05                	jne    392 <sbrktest+0x1ed>
+    exit();
+     38d:	e8 1a 15 00 00       	call   18ac <exit>
+  wait();
+     392:	e8 a4 1f 00 00       	call   233b <wait>
+
+  // can one grow address space to something big?
+#define BIG (1 * 1024 * 1024)
+  a = sbrk(0);
+     397:	bf 00 00 00 00       	mov    $0x0,%edi
+     39c:	e8 4a 20 00 00       	call   23eb <sbrk>
+     3a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  amt = (BIG) - (uint64_t)a;
+     3a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3a9:	ba 00 00 10 00       	mov    $0x100000,%edx
+     3ae:	48 29 c2             	sub    %rax,%rdx
+     3b1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  p = sbrk(amt);
+     3b5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     3b9:	89 c7                	mov    %eax,%edi
+     3bb:	e8 2b 20 00 00       	call   23eb <sbrk>
+     3c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (p != a) {
+     3c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     3c8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     3cc:	74 5c                	je     42a <sbrktest+0x285>
+    error("sbrk test failed to grow big address space; enough phys mem?\n");
+     3ce:	8b 05 2c 3c 00 00    	mov    0x3c2c(%rip),%eax        # 4000 <stdout>
+     3d4:	ba 6f 00 00 00       	mov    $0x6f,%edx
+     3d9:	48 8d 0d ce 2a 00 00 	lea    0x2ace(%rip),%rcx        # 2eae <benchreport+0x165>
+     3e0:	48 89 ce             	mov    %rcx,%rsi
+     3e3:	89 c7                	mov    %eax,%edi
+     3e5:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ea:	e8 8d 0e 00 00       	call   127c <printf>
+     3ef:	8b 05 0b 3c 00 00    	mov    0x3c0b(%rip),%eax        # 4000 <stdout>
+     3f5:	48 8d 15 54 2b 00 00 	lea    0x2b54(%rip),%rdx        # 2f50 <benchreport+0x207>
+     3fc:	48 89 d6             	mov    %rdx,%rsi
+     3ff:	89 c7                	mov    %eax,%edi
+     401:	b8 00 00 00 00       	mov    $0x0,%eax
+     406:	e8 71 0e 00 00       	call   127c <printf>
+     40b:	8b 05 ef 3b 00 00    	mov    0x3bef(%rip),%eax        # 4000 <stdout>
+     411:	48 8d 15 c2 2a 00 00 	lea    0x2ac2(%rip),%rdx        # 2eda <benchreport+0x191>
+     418:	48 89 d6             	mov    %rdx,%rsi
+     41b:	89 c7                	mov    %eax,%edi
+     41d:	b8 00 00 00 00       	mov    $0x0,%eax
+     422:	e8 55 0e 00 00       	call   127c <printf>
+     427:	90                   	nop
+     428:	eb fd                	jmp    427 <sbrktest+0x282>
+  }
+  lastaddr = (char *)(BIG - 1);
+     42a:	48 c7 45 c0 ff ff 0f 	movq   $0xfffff,-0x40(%rbp)
+     431:	00 
+  *lastaddr = 99;
+     432:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     436:	c6 00 63             	movb   $0x63,(%rax)
+
+  // can we read the kernel's memory?
+  printf(stdout, "pids 4-43 (6-45 if ran after sh) should be killed with trap 14 err 5\n");
+     439:	8b 05 c1 3b 00 00    	mov    0x3bc1(%rip),%eax        # 4000 <stdout>
+     43f:	48 8d 15 4a 2b 00 00 	lea    0x2b4a(%rip),%rdx        # 2f90 <benchreport+0x247>
+     446:	48 89 d6             	mov    %rdx,%rsi
+     449:	89 c7                	mov    %eax,%edi
+     44b:	b8 00 00 00 00       	mov    $0x0,%eax
+     450:	e8 27 0e 00 00       	call   127c <printf>
+  for (a = (char *)(KERNBASE); a < (char *)(KERNBASE + 2000000); a += 50000) {
+     455:	48 c7 45 f8 00 00 00 	movq   $0xffffffff80000000,-0x8(%rbp)
+     45c:	80 
+     45d:	e9 04 01 00 00       	jmp    566 <sbrktest+0x3c1>
+    pid = fork();
+     462:	e8 35 14 00 00       	call   189c <fork>
+     467:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (pid < 0) {
+     46a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     46e:	79 5c                	jns    4cc <sbrktest+0x327>
+      error("fork failed\n");
+     470:	8b 05 8a 3b 00 00    	mov    0x3b8a(%rip),%eax        # 4000 <stdout>
+     476:	ba 79 00 00 00       	mov    $0x79,%edx
+     47b:	48 8d 0d 2c 2a 00 00 	lea    0x2a2c(%rip),%rcx        # 2eae <benchreport+0x165>
+     482:	48 89 ce             	mov    %rcx,%rsi
+     485:	89 c7                	mov    %eax,%edi
+     487:	b8 00 00 00 00       	mov    $0x0,%eax
+     48c:	e8 eb 0d 00 00       	call   127c <printf>
+     491:	8b 05 69 3b 00 00    	mov    0x3b69(%rip),%eax        # 4000 <stdout>
+     497:	48 8d 15 38 2b 00 00 	lea    0x2b38(%rip),%rdx        # 2fd6 <benchreport+0x28d>
+     49e:	48 89 d6             	mov    %rdx,%rsi
+     4a1:	89 c7                	mov    %eax,%edi
+     4a3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4a8:	e8 cf 0d 00 00       	call   127c <printf>
+     4ad:	8b 05 4d 3b 00 00    	mov    0x3b4d(%rip),%eax        # 4000 <stdout>
+     4b3:	48 8d 15 20 2a 00 00 	lea    0x2a20(%rip),%rdx        # 2eda <benchreport+0x191>
+     4ba:	48 89 d6             	mov    %rdx,%rsi
+     4bd:	89 c7                	mov    %eax,%edi
+     4bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c4:	e8 b3 0d 00 00       	call   127c <printf>
+     4c9:	90                   	nop
+     4ca:	eb fd                	jmp    4c9 <sbrktest+0x324>
+    }
+    if (pid == 0) {
+     4cc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     4d0:	0f 85 83 00 00 00    	jne    559 <sbrktest+0x3b4>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+     4d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4da:	0f b6 00             	movzbl (%rax),%eax
+     4dd:	0f be c8             	movsbl %al,%ecx
+     4e0:	8b 05 1a 3b 00 00    	mov    0x3b1a(%rip),%eax        # 4000 <stdout>
+     4e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     4ea:	48 8d 35 f2 2a 00 00 	lea    0x2af2(%rip),%rsi        # 2fe3 <benchreport+0x29a>
+     4f1:	89 c7                	mov    %eax,%edi
+     4f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f8:	e8 7f 0d 00 00       	call   127c <printf>
+      error("a bad process is not killed!");
+     4fd:	8b 05 fd 3a 00 00    	mov    0x3afd(%rip),%eax        # 4000 <stdout>
+     503:	ba 7d 00 00 00       	mov    $0x7d,%edx
+     508:	48 8d 0d 9f 29 00 00 	lea    0x299f(%rip),%rcx        # 2eae <benchreport+0x165>
+     50f:	48 89 ce             	mov    %rcx,%rsi
+     512:	89 c7                	mov    %eax,%edi
+     514:	b8 00 00 00 00       	mov    $0x0,%eax
+     519:	e8 5e 0d 00 00       	call   127c <printf>
+     51e:	8b 05 dc 3a 00 00    	mov    0x3adc(%rip),%eax        # 4000 <stdout>
+     524:	48 8d 15 d1 2a 00 00 	lea    0x2ad1(%rip),%rdx        # 2ffc <benchreport+0x2b3>
+     52b:	48 89 d6             	mov    %rdx,%rsi
+     52e:	89 c7                	mov    %eax,%edi
+     530:	b8 00 00 00 00       	mov    $0x0,%eax
+     535:	e8 42 0d 00 00       	call   127c <printf>
+     53a:	8b 05 c0 3a 00 00    	mov    0x3ac0(%rip),%eax        # 4000 <stdout>
+     540:	48 8d 15 93 29 00 00 	lea    0x2993(%rip),%rdx        # 2eda <benchreport+0x191>
+     547:	48 89 d6             	mov    %rdx,%rsi
+     54a:	89 c7                	mov    %eax,%edi
+     54c:	b8 00 00 00 00       	mov    $0x0,%eax
+     551:	e8 26 0d 00 00       	call   127c <printf>
+     556:	90                   	nop
+     557:	eb fd                	jmp    556 <sbrktest+0x3b1>
+    }
+    wait();
+     559:	e8 dd 1d 00 00       	call   233b <wait>
+  for (a = (char *)(KERNBASE); a < (char *)(KERNBASE + 2000000); a += 50000) {
+     55e:	48 81 45 f8 50 c3 00 	addq   $0xc350,-0x8(%rbp)
+     565:	00 
+     566:	48 81 7d f8 7f 84 1e 	cmpq   $0xffffffff801e847f,-0x8(%rbp)
+     56d:	80 
+     56e:	0f 86 ee fe ff ff    	jbe    462 <sbrktest+0x2bd>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if (fork() == 0) {
+     574:	e8 23 13 00 00       	call   189c <fork>
+     579:	85 c0                	test   %eax,%eax
+     57b:	0f 85 e8 00 00 00    	jne    669 <sbrktest+0x4c4>
+    do {
+      sysinfo(&info);
+     581:	48 8d 85 88 fc ff ff 	lea    -0x378(%rbp),%rax
+     588:	48 89 c7             	mov    %rax,%rdi
+     58b:	e8 7c 1e 00 00       	call   240c <sysinfo>
+      free_pages = info.free_pages;
+     590:	8b 85 98 fc ff ff    	mov    -0x368(%rbp),%eax
+     596:	89 45 ac             	mov    %eax,-0x54(%rbp)
+      // printf(stdout, "free pages before sbrk: %d\n", free_pages);
+      c = sbrk(BIG);
+     599:	bf 00 00 10 00       	mov    $0x100000,%edi
+     59e:	e8 48 1e 00 00       	call   23eb <sbrk>
+     5a3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    } while ((c = sbrk(BIG)) != (char *) -1);
+     5a7:	bf 00 00 10 00       	mov    $0x100000,%edi
+     5ac:	e8 3a 1e 00 00       	call   23eb <sbrk>
+     5b1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+     5b5:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     5ba:	75 c5                	jne    581 <sbrktest+0x3dc>
+    sysinfo(&info);
+     5bc:	48 8d 85 88 fc ff ff 	lea    -0x378(%rbp),%rax
+     5c3:	48 89 c7             	mov    %rax,%rdi
+     5c6:	e8 41 1e 00 00       	call   240c <sysinfo>
+    printf(stdout, "free pages after out-of-memory(shouldn't be 0): %d\n", info.free_pages);
+     5cb:	8b 95 98 fc ff ff    	mov    -0x368(%rbp),%edx
+     5d1:	8b 05 29 3a 00 00    	mov    0x3a29(%rip),%eax        # 4000 <stdout>
+     5d7:	48 8d 0d 42 2a 00 00 	lea    0x2a42(%rip),%rcx        # 3020 <benchreport+0x2d7>
+     5de:	48 89 ce             	mov    %rcx,%rsi
+     5e1:	89 c7                	mov    %eax,%edi
+     5e3:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e8:	e8 8f 0c 00 00       	call   127c <printf>
+
+    // if those failed allocations freed up the pages they did allocate,
+    // we'll be able to allocate here
+    c = sbrk(4096);
+     5ed:	bf 00 10 00 00       	mov    $0x1000,%edi
+     5f2:	e8 f4 1d 00 00       	call   23eb <sbrk>
+     5f7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if (free_pages != 0 && c == (char *) -1) {
+     5fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+     5ff:	74 63                	je     664 <sbrktest+0x4bf>
+     601:	48 83 7d d8 ff       	cmpq   $0xffffffffffffffff,-0x28(%rbp)
+     606:	75 5c                	jne    664 <sbrktest+0x4bf>
+      error("failed sbrk leaked memory. Uncomment lines 136 for more information.\n");
+     608:	8b 05 f2 39 00 00    	mov    0x39f2(%rip),%eax        # 4000 <stdout>
+     60e:	ba 92 00 00 00       	mov    $0x92,%edx
+     613:	48 8d 0d 94 28 00 00 	lea    0x2894(%rip),%rcx        # 2eae <benchreport+0x165>
+     61a:	48 89 ce             	mov    %rcx,%rsi
+     61d:	89 c7                	mov    %eax,%edi
+     61f:	b8 00 00 00 00       	mov    $0x0,%eax
+     624:	e8 53 0c 00 00       	call   127c <printf>
+     629:	8b 05 d1 39 00 00    	mov    0x39d1(%rip),%eax        # 4000 <stdout>
+     62f:	48 8d 15 22 2a 00 00 	lea    0x2a22(%rip),%rdx        # 3058 <benchreport+0x30f>
+     636:	48 89 d6             	mov    %rdx,%rsi
+     639:	89 c7                	mov    %eax,%edi
+     63b:	b8 00 00 00 00       	mov    $0x0,%eax
+     640:	e8 37 0c 00 00       	call   127c <printf>
+     645:	8b 05 b5 39 00 00    	mov    0x39b5(%rip),%eax        # 4000 <stdout>
+     64b:	48 8d 15 88 28 00 00 	lea    0x2888(%rip),%rdx        # 2eda <benchreport+0x191>
+     652:	48 89 d6             	mov    %rdx,%rsi
+     655:	89 c7                	mov    %eax,%edi
+     657:	b8 00 00 00 00       	mov    $0x0,%eax
+     65c:	e8 1b 0c 00 00       	call   127c <printf>
+     661:	90                   	nop
+     662:	eb fd                	jmp    661 <sbrktest+0x4bc>
+    }
+    exit();
+     664:	e8 43 12 00 00       	call   18ac <exit>
+  } else {
+    wait();
+     669:	e8 cd 1c 00 00       	call   233b <wait>
+  }
+
+  char *d = sbrk(0);
+     66e:	bf 00 00 00 00       	mov    $0x0,%edi
+     673:	e8 73 1d 00 00       	call   23eb <sbrk>
+     678:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if (d > oldbrk) {
+     67c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     680:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     684:	0f 83 23 02 00 00    	jae    8ad <sbrktest+0x708>
+    if (sbrk(-(d - oldbrk)) != d)
+     68a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     68e:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+     692:	89 c7                	mov    %eax,%edi
+     694:	e8 52 1d 00 00       	call   23eb <sbrk>
+     699:	48 39 45 b8          	cmp    %rax,-0x48(%rbp)
+     69d:	74 5c                	je     6fb <sbrktest+0x556>
+      error("sbrk negative number doesn't return prev break\n");
+     69f:	8b 05 5b 39 00 00    	mov    0x395b(%rip),%eax        # 4000 <stdout>
+     6a5:	ba 9c 00 00 00       	mov    $0x9c,%edx
+     6aa:	48 8d 0d fd 27 00 00 	lea    0x27fd(%rip),%rcx        # 2eae <benchreport+0x165>
+     6b1:	48 89 ce             	mov    %rcx,%rsi
+     6b4:	89 c7                	mov    %eax,%edi
+     6b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     6bb:	e8 bc 0b 00 00       	call   127c <printf>
+     6c0:	8b 05 3a 39 00 00    	mov    0x393a(%rip),%eax        # 4000 <stdout>
+     6c6:	48 8d 15 d3 29 00 00 	lea    0x29d3(%rip),%rdx        # 30a0 <benchreport+0x357>
+     6cd:	48 89 d6             	mov    %rdx,%rsi
+     6d0:	89 c7                	mov    %eax,%edi
+     6d2:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d7:	e8 a0 0b 00 00       	call   127c <printf>
+     6dc:	8b 05 1e 39 00 00    	mov    0x391e(%rip),%eax        # 4000 <stdout>
+     6e2:	48 8d 15 f1 27 00 00 	lea    0x27f1(%rip),%rdx        # 2eda <benchreport+0x191>
+     6e9:	48 89 d6             	mov    %rdx,%rsi
+     6ec:	89 c7                	mov    %eax,%edi
+     6ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f3:	e8 84 0b 00 00       	call   127c <printf>
+     6f8:	90                   	nop
+     6f9:	eb fd                	jmp    6f8 <sbrktest+0x553>
+
+    // OPTIONAL TESTS FOR SBRK DECREMENT
+    if (sbrk(0) == oldbrk) {
+     6fb:	bf 00 00 00 00       	mov    $0x0,%edi
+     700:	e8 e6 1c 00 00       	call   23eb <sbrk>
+     705:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     709:	0f 85 9e 01 00 00    	jne    8ad <sbrktest+0x708>
+      printf(stdout, "Good job! sbrk decrement implemented!\n");
+     70f:	8b 05 eb 38 00 00    	mov    0x38eb(%rip),%eax        # 4000 <stdout>
+     715:	48 8d 15 b4 29 00 00 	lea    0x29b4(%rip),%rdx        # 30d0 <benchreport+0x387>
+     71c:	48 89 d6             	mov    %rdx,%rsi
+     71f:	89 c7                	mov    %eax,%edi
+     721:	b8 00 00 00 00       	mov    $0x0,%eax
+     726:	e8 51 0b 00 00       	call   127c <printf>
+      if (sbrk(-1) != oldbrk) {
+     72b:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+     730:	e8 b6 1c 00 00       	call   23eb <sbrk>
+     735:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     739:	74 5c                	je     797 <sbrktest+0x5f2>
+        error("sbrk decrement more than allocated should do nothing\n");
+     73b:	8b 05 bf 38 00 00    	mov    0x38bf(%rip),%eax        # 4000 <stdout>
+     741:	ba a2 00 00 00       	mov    $0xa2,%edx
+     746:	48 8d 0d 61 27 00 00 	lea    0x2761(%rip),%rcx        # 2eae <benchreport+0x165>
+     74d:	48 89 ce             	mov    %rcx,%rsi
+     750:	89 c7                	mov    %eax,%edi
+     752:	b8 00 00 00 00       	mov    $0x0,%eax
+     757:	e8 20 0b 00 00       	call   127c <printf>
+     75c:	8b 05 9e 38 00 00    	mov    0x389e(%rip),%eax        # 4000 <stdout>
+     762:	48 8d 15 8f 29 00 00 	lea    0x298f(%rip),%rdx        # 30f8 <benchreport+0x3af>
+     769:	48 89 d6             	mov    %rdx,%rsi
+     76c:	89 c7                	mov    %eax,%edi
+     76e:	b8 00 00 00 00       	mov    $0x0,%eax
+     773:	e8 04 0b 00 00       	call   127c <printf>
+     778:	8b 05 82 38 00 00    	mov    0x3882(%rip),%eax        # 4000 <stdout>
+     77e:	48 8d 15 55 27 00 00 	lea    0x2755(%rip),%rdx        # 2eda <benchreport+0x191>
+     785:	48 89 d6             	mov    %rdx,%rsi
+     788:	89 c7                	mov    %eax,%edi
+     78a:	b8 00 00 00 00       	mov    $0x0,%eax
+     78f:	e8 e8 0a 00 00       	call   127c <printf>
+     794:	90                   	nop
+     795:	eb fd                	jmp    794 <sbrktest+0x5ef>
+      }
+      sbrk(10);
+     797:	bf 0a 00 00 00       	mov    $0xa,%edi
+     79c:	e8 4a 1c 00 00       	call   23eb <sbrk>
+      char *newbrk = sbrk(0);
+     7a1:	bf 00 00 00 00       	mov    $0x0,%edi
+     7a6:	e8 40 1c 00 00       	call   23eb <sbrk>
+     7ab:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+      if (sbrk(-100) != newbrk) {
+     7af:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     7b4:	e8 32 1c 00 00       	call   23eb <sbrk>
+     7b9:	48 39 45 b0          	cmp    %rax,-0x50(%rbp)
+     7bd:	74 5c                	je     81b <sbrktest+0x676>
+        error("sbrk decrement more than allocated should do nothing\n");
+     7bf:	8b 05 3b 38 00 00    	mov    0x383b(%rip),%eax        # 4000 <stdout>
+     7c5:	ba a7 00 00 00       	mov    $0xa7,%edx
+     7ca:	48 8d 0d dd 26 00 00 	lea    0x26dd(%rip),%rcx        # 2eae <benchreport+0x165>
+     7d1:	48 89 ce             	mov    %rcx,%rsi
+     7d4:	89 c7                	mov    %eax,%edi
+     7d6:	b8 00 00 00 00       	mov    $0x0,%eax
+     7db:	e8 9c 0a 00 00       	call   127c <printf>
+     7e0:	8b 05 1a 38 00 00    	mov    0x381a(%rip),%eax        # 4000 <stdout>
+     7e6:	48 8d 15 0b 29 00 00 	lea    0x290b(%rip),%rdx        # 30f8 <benchreport+0x3af>
+     7ed:	48 89 d6             	mov    %rdx,%rsi
+     7f0:	89 c7                	mov    %eax,%edi
+     7f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f7:	e8 80 0a 00 00       	call   127c <printf>
+     7fc:	8b 05 fe 37 00 00    	mov    0x37fe(%rip),%eax        # 4000 <stdout>
+     802:	48 8d 15 d1 26 00 00 	lea    0x26d1(%rip),%rdx        # 2eda <benchreport+0x191>
+     809:	48 89 d6             	mov    %rdx,%rsi
+     80c:	89 c7                	mov    %eax,%edi
+     80e:	b8 00 00 00 00       	mov    $0x0,%eax
+     813:	e8 64 0a 00 00       	call   127c <printf>
+     818:	90                   	nop
+     819:	eb fd                	jmp    818 <sbrktest+0x673>
+      }
+      sbrk(-10);
+     81b:	bf f6 ff ff ff       	mov    $0xfffffff6,%edi
+     820:	e8 c6 1b 00 00       	call   23eb <sbrk>
+      if (sbrk(0) != oldbrk) {
+     825:	bf 00 00 00 00       	mov    $0x0,%edi
+     82a:	e8 bc 1b 00 00       	call   23eb <sbrk>
+     82f:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     833:	74 5c                	je     891 <sbrktest+0x6ec>
+        error("not releasing all heap memoery\n");
+     835:	8b 05 c5 37 00 00    	mov    0x37c5(%rip),%eax        # 4000 <stdout>
+     83b:	ba ab 00 00 00       	mov    $0xab,%edx
+     840:	48 8d 0d 67 26 00 00 	lea    0x2667(%rip),%rcx        # 2eae <benchreport+0x165>
+     847:	48 89 ce             	mov    %rcx,%rsi
+     84a:	89 c7                	mov    %eax,%edi
+     84c:	b8 00 00 00 00       	mov    $0x0,%eax
+     851:	e8 26 0a 00 00       	call   127c <printf>
+     856:	8b 05 a4 37 00 00    	mov    0x37a4(%rip),%eax        # 4000 <stdout>
+     85c:	48 8d 15 cd 28 00 00 	lea    0x28cd(%rip),%rdx        # 3130 <benchreport+0x3e7>
+     863:	48 89 d6             	mov    %rdx,%rsi
+     866:	89 c7                	mov    %eax,%edi
+     868:	b8 00 00 00 00       	mov    $0x0,%eax
+     86d:	e8 0a 0a 00 00       	call   127c <printf>
+     872:	8b 05 88 37 00 00    	mov    0x3788(%rip),%eax        # 4000 <stdout>
+     878:	48 8d 15 5b 26 00 00 	lea    0x265b(%rip),%rdx        # 2eda <benchreport+0x191>
+     87f:	48 89 d6             	mov    %rdx,%rsi
+     882:	89 c7                	mov    %eax,%edi
+     884:	b8 00 00 00 00       	mov    $0x0,%eax
+     889:	e8 ee 09 00 00       	call   127c <printf>
+     88e:	90                   	nop
+     88f:	eb fd                	jmp    88e <sbrktest+0x6e9>
+      }
+      printf(stdout, "sbrk decrement test passed!\n");
+     891:	8b 05 69 37 00 00    	mov    0x3769(%rip),%eax        # 4000 <stdout>
+     897:	48 8d 15 b2 28 00 00 	lea    0x28b2(%rip),%rdx        # 3150 <benchreport+0x407>
+     89e:	48 89 d6             	mov    %rdx,%rsi
+     8a1:	89 c7                	mov    %eax,%edi
+     8a3:	b8 00 00 00 00       	mov    $0x0,%eax
+     8a8:	e8 cf 09 00 00       	call   127c <printf>
+    }
+  }
+  
+  printf(stdout, "sbrktest passed\n");
+     8ad:	8b 05 4d 37 00 00    	mov    0x374d(%rip),%eax        # 4000 <stdout>
+     8b3:	48 8d 15 b3 28 00 00 	lea    0x28b3(%rip),%rdx        # 316d <benchreport+0x424>
+     8ba:	48 89 d6             	mov    %rdx,%rsi
+     8bd:	89 c7                	mov    %eax,%edi
+     8bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     8c4:	e8 b3 09 00 00       	call   127c <printf>
+}
+     8c9:	90                   	nop
+     8ca:	c9                   	leave
+     8cb:	c3                   	ret
+
+00000000000008cc <growstacktest>:
+
+void growstacktest() {
+     8cc:	55                   	push   %rbp
+     8cd:	48 89 e5             	mov    %rsp,%rbp
+     8d0:	41 57                	push   %r15
+     8d2:	41 56                	push   %r14
+     8d4:	41 55                	push   %r13
+     8d6:	41 54                	push   %r12
+     8d8:	53                   	push   %rbx
+     8d9:	48 81 ec 58 06 00 00 	sub    $0x658,%rsp
+     8e0:	48 89 e0             	mov    %rsp,%rax
+     8e3:	48 89 c3             	mov    %rax,%rbx
+  int i;
+  struct sys_info info1, info2;
+  printf(stdout, "growstacktest\n");
+     8e6:	8b 05 14 37 00 00    	mov    0x3714(%rip),%eax        # 4000 <stdout>
+     8ec:	48 8d 15 8b 28 00 00 	lea    0x288b(%rip),%rdx        # 317e <benchreport+0x435>
+     8f3:	48 89 d6             	mov    %rdx,%rsi
+     8f6:	89 c7                	mov    %eax,%edi
+     8f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8fd:	e8 7a 09 00 00       	call   127c <printf>
+  sysinfo(&info1);
+     902:	48 8d 85 a0 fc ff ff 	lea    -0x360(%rbp),%rax
+     909:	48 89 c7             	mov    %rax,%rdi
+     90c:	e8 fb 1a 00 00       	call   240c <sysinfo>
+
+  printf(stdout, "pages_in_use before stack allocation = %d\n",
+     911:	8b 95 a8 fc ff ff    	mov    -0x358(%rbp),%edx
+     917:	8b 05 e3 36 00 00    	mov    0x36e3(%rip),%eax        # 4000 <stdout>
+     91d:	48 8d 0d 6c 28 00 00 	lea    0x286c(%rip),%rcx        # 3190 <benchreport+0x447>
+     924:	48 89 ce             	mov    %rcx,%rsi
+     927:	89 c7                	mov    %eax,%edi
+     929:	b8 00 00 00 00       	mov    $0x0,%eax
+     92e:	e8 49 09 00 00       	call   127c <printf>
+         info1.pages_in_use);
+  printf(stdout, "pages_in_swap before stack allocation = %d\n",
+     933:	8b 95 ac fc ff ff    	mov    -0x354(%rbp),%edx
+     939:	8b 05 c1 36 00 00    	mov    0x36c1(%rip),%eax        # 4000 <stdout>
+     93f:	48 8d 0d 7a 28 00 00 	lea    0x287a(%rip),%rcx        # 31c0 <benchreport+0x477>
+     946:	48 89 ce             	mov    %rcx,%rsi
+     949:	89 c7                	mov    %eax,%edi
+     94b:	b8 00 00 00 00       	mov    $0x0,%eax
+     950:	e8 27 09 00 00       	call   127c <printf>
+         info1.pages_in_swap);
+
+  int page8 = 8 * 4096;
+     955:	c7 45 c8 00 80 00 00 	movl   $0x8000,-0x38(%rbp)
+  char buf[page8];
+     95c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     95f:	48 63 d0             	movslq %eax,%rdx
+     962:	48 83 ea 01          	sub    $0x1,%rdx
+     966:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     96a:	48 63 d0             	movslq %eax,%rdx
+     96d:	49 89 d6             	mov    %rdx,%r14
+     970:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     976:	48 63 d0             	movslq %eax,%rdx
+     979:	49 89 d4             	mov    %rdx,%r12
+     97c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     982:	48 98                	cltq
+     984:	ba 10 00 00 00       	mov    $0x10,%edx
+     989:	48 83 ea 01          	sub    $0x1,%rdx
+     98d:	48 01 d0             	add    %rdx,%rax
+     990:	be 10 00 00 00       	mov    $0x10,%esi
+     995:	ba 00 00 00 00       	mov    $0x0,%edx
+     99a:	48 f7 f6             	div    %rsi
+     99d:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     9a1:	48 29 c4             	sub    %rax,%rsp
+     9a4:	48 89 e0             	mov    %rsp,%rax
+     9a7:	48 83 c0 00          	add    $0x0,%rax
+     9ab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  for (i = 0; i < 8; i++) {
+     9af:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+     9b6:	eb 3a                	jmp    9f2 <growstacktest+0x126>
+    buf[i * 4096] = 'a';
+     9b8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     9bb:	c1 e0 0c             	shl    $0xc,%eax
+     9be:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     9c2:	48 98                	cltq
+     9c4:	c6 04 02 61          	movb   $0x61,(%rdx,%rax,1)
+    buf[i * 4096 - 1] = buf[i * 4096];
+     9c8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     9cb:	c1 e0 0c             	shl    $0xc,%eax
+     9ce:	89 c1                	mov    %eax,%ecx
+     9d0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     9d3:	c1 e0 0c             	shl    $0xc,%eax
+     9d6:	8d 70 ff             	lea    -0x1(%rax),%esi
+     9d9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     9dd:	48 63 c1             	movslq %ecx,%rax
+     9e0:	0f b6 0c 02          	movzbl (%rdx,%rax,1),%ecx
+     9e4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     9e8:	48 63 c6             	movslq %esi,%rax
+     9eb:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  for (i = 0; i < 8; i++) {
+     9ee:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+     9f2:	83 7d cc 07          	cmpl   $0x7,-0x34(%rbp)
+     9f6:	7e c0                	jle    9b8 <growstacktest+0xec>
+  }
+  sysinfo(&info2);
+     9f8:	48 8d 85 88 f9 ff ff 	lea    -0x678(%rbp),%rax
+     9ff:	48 89 c7             	mov    %rax,%rdi
+     a02:	e8 05 1a 00 00       	call   240c <sysinfo>
+
+  printf(stdout, "pages_in_use after stack allocation = %d\n",
+     a07:	8b 95 90 f9 ff ff    	mov    -0x670(%rbp),%edx
+     a0d:	8b 05 ed 35 00 00    	mov    0x35ed(%rip),%eax        # 4000 <stdout>
+     a13:	48 8d 0d d6 27 00 00 	lea    0x27d6(%rip),%rcx        # 31f0 <benchreport+0x4a7>
+     a1a:	48 89 ce             	mov    %rcx,%rsi
+     a1d:	89 c7                	mov    %eax,%edi
+     a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a24:	e8 53 08 00 00       	call   127c <printf>
+         info2.pages_in_use);
+  printf(stdout, "pages_in_swap after stack allocation = %d\n",
+     a29:	8b 95 94 f9 ff ff    	mov    -0x66c(%rbp),%edx
+     a2f:	8b 05 cb 35 00 00    	mov    0x35cb(%rip),%eax        # 4000 <stdout>
+     a35:	48 8d 0d e4 27 00 00 	lea    0x27e4(%rip),%rcx        # 3220 <benchreport+0x4d7>
+     a3c:	48 89 ce             	mov    %rcx,%rsi
+     a3f:	89 c7                	mov    %eax,%edi
+     a41:	b8 00 00 00 00       	mov    $0x0,%eax
+     a46:	e8 31 08 00 00       	call   127c <printf>
+         info2.pages_in_swap);
+
+  // if grow ustack on-demand is implemented, then the 8 pages are allocated at
+  // run-time
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     a4b:	8b 95 90 f9 ff ff    	mov    -0x670(%rbp),%edx
+     a51:	8b 85 a8 fc ff ff    	mov    -0x358(%rbp),%eax
+     a57:	29 c2                	sub    %eax,%edx
+     a59:	8b 85 ac fc ff ff    	mov    -0x354(%rbp),%eax
+     a5f:	01 c2                	add    %eax,%edx
+          info2.pages_in_swap !=
+     a61:	8b 85 94 f9 ff ff    	mov    -0x66c(%rbp),%eax
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     a67:	29 c2                	sub    %eax,%edx
+     a69:	83 fa 08             	cmp    $0x8,%edx
+     a6c:	74 5c                	je     aca <growstacktest+0x1fe>
+      8)
+    error("user stack is not growing");
+     a6e:	8b 05 8c 35 00 00    	mov    0x358c(%rip),%eax        # 4000 <stdout>
+     a74:	ba d1 00 00 00       	mov    $0xd1,%edx
+     a79:	48 8d 0d 2e 24 00 00 	lea    0x242e(%rip),%rcx        # 2eae <benchreport+0x165>
+     a80:	48 89 ce             	mov    %rcx,%rsi
+     a83:	89 c7                	mov    %eax,%edi
+     a85:	b8 00 00 00 00       	mov    $0x0,%eax
+     a8a:	e8 ed 07 00 00       	call   127c <printf>
+     a8f:	8b 05 6b 35 00 00    	mov    0x356b(%rip),%eax        # 4000 <stdout>
+     a95:	48 8d 15 af 27 00 00 	lea    0x27af(%rip),%rdx        # 324b <benchreport+0x502>
+     a9c:	48 89 d6             	mov    %rdx,%rsi
+     a9f:	89 c7                	mov    %eax,%edi
+     aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+     aa6:	e8 d1 07 00 00       	call   127c <printf>
+     aab:	8b 05 4f 35 00 00    	mov    0x354f(%rip),%eax        # 4000 <stdout>
+     ab1:	48 8d 15 22 24 00 00 	lea    0x2422(%rip),%rdx        # 2eda <benchreport+0x191>
+     ab8:	48 89 d6             	mov    %rdx,%rsi
+     abb:	89 c7                	mov    %eax,%edi
+     abd:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac2:	e8 b5 07 00 00       	call   127c <printf>
+     ac7:	90                   	nop
+     ac8:	eb fd                	jmp    ac7 <growstacktest+0x1fb>
+
+  printf(stdout, "growstacktest passed\n");
+     aca:	8b 05 30 35 00 00    	mov    0x3530(%rip),%eax        # 4000 <stdout>
+     ad0:	48 8d 15 8e 27 00 00 	lea    0x278e(%rip),%rdx        # 3265 <benchreport+0x51c>
+     ad7:	48 89 d6             	mov    %rdx,%rsi
+     ada:	89 c7                	mov    %eax,%edi
+     adc:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae1:	e8 96 07 00 00       	call   127c <printf>
+     ae6:	48 89 dc             	mov    %rbx,%rsp
+}
+     ae9:	90                   	nop
+     aea:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     aee:	5b                   	pop    %rbx
+     aef:	41 5c                	pop    %r12
+     af1:	41 5d                	pop    %r13
+     af3:	41 5e                	pop    %r14
+     af5:	41 5f                	pop    %r15
+     af7:	5d                   	pop    %rbp
+     af8:	c3                   	ret
+
+0000000000000af9 <growstacktest_edgecase>:
+
+void growstacktest_edgecase() {
+     af9:	55                   	push   %rbp
+     afa:	48 89 e5             	mov    %rsp,%rbp
+     afd:	48 83 ec 20          	sub    $0x20,%rsp
+  printf(stdout, "growstacktest_edgecase\n");
+     b01:	8b 05 f9 34 00 00    	mov    0x34f9(%rip),%eax        # 4000 <stdout>
+     b07:	48 8d 15 6d 27 00 00 	lea    0x276d(%rip),%rdx        # 327b <benchreport+0x532>
+     b0e:	48 89 d6             	mov    %rdx,%rsi
+     b11:	89 c7                	mov    %eax,%edi
+     b13:	b8 00 00 00 00       	mov    $0x0,%eax
+     b18:	e8 5f 07 00 00       	call   127c <printf>
+  printf(stdout, "next 2 processes should be killed with trap 14 err 6\n");
+     b1d:	8b 05 dd 34 00 00    	mov    0x34dd(%rip),%eax        # 4000 <stdout>
+     b23:	48 8d 15 6e 27 00 00 	lea    0x276e(%rip),%rdx        # 3298 <benchreport+0x54f>
+     b2a:	48 89 d6             	mov    %rdx,%rsi
+     b2d:	89 c7                	mov    %eax,%edi
+     b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b34:	e8 43 07 00 00       	call   127c <printf>
+
+  int pid = fork();
+     b39:	e8 5e 0d 00 00       	call   189c <fork>
+     b3e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == 0) {
+     b41:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b45:	75 6b                	jne    bb2 <growstacktest_edgecase+0xb9>
+    char *buf = (char *) STACKBASE - 11 * 4096;
+     b47:	48 c7 45 e8 00 50 ff 	movq   $0x7fff5000,-0x18(%rbp)
+     b4e:	7f 
+    // can we get 11 pages on the stack?
+    *buf = 0;
+     b4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b53:	c6 00 00             	movb   $0x0,(%rax)
+    error("we can get 11 pages on stack");
+     b56:	8b 05 a4 34 00 00    	mov    0x34a4(%rip),%eax        # 4000 <stdout>
+     b5c:	ba df 00 00 00       	mov    $0xdf,%edx
+     b61:	48 8d 0d 46 23 00 00 	lea    0x2346(%rip),%rcx        # 2eae <benchreport+0x165>
+     b68:	48 89 ce             	mov    %rcx,%rsi
+     b6b:	89 c7                	mov    %eax,%edi
+     b6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     b72:	e8 05 07 00 00       	call   127c <printf>
+     b77:	8b 05 83 34 00 00    	mov    0x3483(%rip),%eax        # 4000 <stdout>
+     b7d:	48 8d 15 4a 27 00 00 	lea    0x274a(%rip),%rdx        # 32ce <benchreport+0x585>
+     b84:	48 89 d6             	mov    %rdx,%rsi
+     b87:	89 c7                	mov    %eax,%edi
+     b89:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8e:	e8 e9 06 00 00       	call   127c <printf>
+     b93:	8b 05 67 34 00 00    	mov    0x3467(%rip),%eax        # 4000 <stdout>
+     b99:	48 8d 15 3a 23 00 00 	lea    0x233a(%rip),%rdx        # 2eda <benchreport+0x191>
+     ba0:	48 89 d6             	mov    %rdx,%rsi
+     ba3:	89 c7                	mov    %eax,%edi
+     ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+     baa:	e8 cd 06 00 00       	call   127c <printf>
+     baf:	90                   	nop
+     bb0:	eb fd                	jmp    baf <growstacktest_edgecase+0xb6>
+  } else if (pid < 0) {
+     bb2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     bb6:	79 5c                	jns    c14 <growstacktest_edgecase+0x11b>
+    error("fork() failed!\n");
+     bb8:	8b 05 42 34 00 00    	mov    0x3442(%rip),%eax        # 4000 <stdout>
+     bbe:	ba e1 00 00 00       	mov    $0xe1,%edx
+     bc3:	48 8d 0d e4 22 00 00 	lea    0x22e4(%rip),%rcx        # 2eae <benchreport+0x165>
+     bca:	48 89 ce             	mov    %rcx,%rsi
+     bcd:	89 c7                	mov    %eax,%edi
+     bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+     bd4:	e8 a3 06 00 00       	call   127c <printf>
+     bd9:	8b 05 21 34 00 00    	mov    0x3421(%rip),%eax        # 4000 <stdout>
+     bdf:	48 8d 15 05 27 00 00 	lea    0x2705(%rip),%rdx        # 32eb <benchreport+0x5a2>
+     be6:	48 89 d6             	mov    %rdx,%rsi
+     be9:	89 c7                	mov    %eax,%edi
+     beb:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf0:	e8 87 06 00 00       	call   127c <printf>
+     bf5:	8b 05 05 34 00 00    	mov    0x3405(%rip),%eax        # 4000 <stdout>
+     bfb:	48 8d 15 d8 22 00 00 	lea    0x22d8(%rip),%rdx        # 2eda <benchreport+0x191>
+     c02:	48 89 d6             	mov    %rdx,%rsi
+     c05:	89 c7                	mov    %eax,%edi
+     c07:	b8 00 00 00 00       	mov    $0x0,%eax
+     c0c:	e8 6b 06 00 00       	call   127c <printf>
+     c11:	90                   	nop
+     c12:	eb fd                	jmp    c11 <growstacktest_edgecase+0x118>
+  } else {
+    wait();
+     c14:	e8 22 17 00 00       	call   233b <wait>
+  }
+
+  pid = fork();
+     c19:	e8 7e 0c 00 00       	call   189c <fork>
+     c1e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == 0) {
+     c21:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c25:	75 6c                	jne    c93 <growstacktest_edgecase+0x19a>
+    char *buf = (char *) STACKBASE;
+     c27:	b8 00 00 00 80       	mov    $0x80000000,%eax
+     c2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    // can the stack grow upwards?
+    *buf = 0;
+     c30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c34:	c6 00 00             	movb   $0x0,(%rax)
+    error("stack can grow upwards!");
+     c37:	8b 05 c3 33 00 00    	mov    0x33c3(%rip),%eax        # 4000 <stdout>
+     c3d:	ba eb 00 00 00       	mov    $0xeb,%edx
+     c42:	48 8d 0d 65 22 00 00 	lea    0x2265(%rip),%rcx        # 2eae <benchreport+0x165>
+     c49:	48 89 ce             	mov    %rcx,%rsi
+     c4c:	89 c7                	mov    %eax,%edi
+     c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+     c53:	e8 24 06 00 00       	call   127c <printf>
+     c58:	8b 05 a2 33 00 00    	mov    0x33a2(%rip),%eax        # 4000 <stdout>
+     c5e:	48 8d 15 96 26 00 00 	lea    0x2696(%rip),%rdx        # 32fb <benchreport+0x5b2>
+     c65:	48 89 d6             	mov    %rdx,%rsi
+     c68:	89 c7                	mov    %eax,%edi
+     c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c6f:	e8 08 06 00 00       	call   127c <printf>
+     c74:	8b 05 86 33 00 00    	mov    0x3386(%rip),%eax        # 4000 <stdout>
+     c7a:	48 8d 15 59 22 00 00 	lea    0x2259(%rip),%rdx        # 2eda <benchreport+0x191>
+     c81:	48 89 d6             	mov    %rdx,%rsi
+     c84:	89 c7                	mov    %eax,%edi
+     c86:	b8 00 00 00 00       	mov    $0x0,%eax
+     c8b:	e8 ec 05 00 00       	call   127c <printf>
+     c90:	90                   	nop
+     c91:	eb fd                	jmp    c90 <growstacktest_edgecase+0x197>
+  } else if (pid < 0) {
+     c93:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c97:	79 5c                	jns    cf5 <growstacktest_edgecase+0x1fc>
+    error("fork() failed!\n");
+     c99:	8b 05 61 33 00 00    	mov    0x3361(%rip),%eax        # 4000 <stdout>
+     c9f:	ba ed 00 00 00       	mov    $0xed,%edx
+     ca4:	48 8d 0d 03 22 00 00 	lea    0x2203(%rip),%rcx        # 2eae <benchreport+0x165>
+     cab:	48 89 ce             	mov    %rcx,%rsi
+     cae:	89 c7                	mov    %eax,%edi
+     cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb5:	e8 c2 05 00 00       	call   127c <printf>
+     cba:	8b 05 40 33 00 00    	mov    0x3340(%rip),%eax        # 4000 <stdout>
+     cc0:	48 8d 15 24 26 00 00 	lea    0x2624(%rip),%rdx        # 32eb <benchreport+0x5a2>
+     cc7:	48 89 d6             	mov    %rdx,%rsi
+     cca:	89 c7                	mov    %eax,%edi
+     ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd1:	e8 a6 05 00 00       	call   127c <printf>
+     cd6:	8b 05 24 33 00 00    	mov    0x3324(%rip),%eax        # 4000 <stdout>
+     cdc:	48 8d 15 f7 21 00 00 	lea    0x21f7(%rip),%rdx        # 2eda <benchreport+0x191>
+     ce3:	48 89 d6             	mov    %rdx,%rsi
+     ce6:	89 c7                	mov    %eax,%edi
+     ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+     ced:	e8 8a 05 00 00       	call   127c <printf>
+     cf2:	90                   	nop
+     cf3:	eb fd                	jmp    cf2 <growstacktest_edgecase+0x1f9>
+  } else {
+    wait();
+     cf5:	e8 41 16 00 00       	call   233b <wait>
+  }
+
+  printf(stdout, "growstacktest_edgecase passed\n");
+     cfa:	8b 05 00 33 00 00    	mov    0x3300(%rip),%eax        # 4000 <stdout>
+     d00:	48 8d 15 11 26 00 00 	lea    0x2611(%rip),%rdx        # 3318 <benchreport+0x5cf>
+     d07:	48 89 d6             	mov    %rdx,%rsi
+     d0a:	89 c7                	mov    %eax,%edi
+     d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+     d11:	e8 66 05 00 00       	call   127c <printf>
+}
+     d16:	90                   	nop
+     d17:	c9                   	leave
+     d18:	c3                   	ret
+
+0000000000000d19 <copyonwriteforktest>:
+
+void copyonwriteforktest() {
+     d19:	55                   	push   %rbp
+     d1a:	48 89 e5             	mov    %rsp,%rbp
+     d1d:	48 81 ec 80 0c 00 00 	sub    $0xc80,%rsp
+  struct sys_info info1, info2, info3, info4;
+  int page200 = 200 * 4096;
+     d24:	c7 45 f4 00 80 0c 00 	movl   $0xc8000,-0xc(%rbp)
+  char *a = sbrk(page200);
+     d2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d2e:	89 c7                	mov    %eax,%edi
+     d30:	e8 b6 16 00 00       	call   23eb <sbrk>
+     d35:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  char b;
+  int j;
+
+  a[0] = 0;
+     d39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d3d:	c6 00 00             	movb   $0x0,(%rax)
+  printf(stdout, "copyonwriteforktest\n");
+     d40:	8b 05 ba 32 00 00    	mov    0x32ba(%rip),%eax        # 4000 <stdout>
+     d46:	48 8d 15 ea 25 00 00 	lea    0x25ea(%rip),%rdx        # 3337 <benchreport+0x5ee>
+     d4d:	48 89 d6             	mov    %rdx,%rsi
+     d50:	89 c7                	mov    %eax,%edi
+     d52:	b8 00 00 00 00       	mov    $0x0,%eax
+     d57:	e8 20 05 00 00       	call   127c <printf>
+  sysinfo(&info1);
+     d5c:	48 8d 85 c8 fc ff ff 	lea    -0x338(%rbp),%rax
+     d63:	48 89 c7             	mov    %rax,%rdi
+     d66:	e8 a1 16 00 00       	call   240c <sysinfo>
+  printf(stdout, "pages_in_use before copy-on-write fork = %d\n",
+     d6b:	8b 95 d0 fc ff ff    	mov    -0x330(%rbp),%edx
+     d71:	8b 05 89 32 00 00    	mov    0x3289(%rip),%eax        # 4000 <stdout>
+     d77:	48 8d 0d d2 25 00 00 	lea    0x25d2(%rip),%rcx        # 3350 <benchreport+0x607>
+     d7e:	48 89 ce             	mov    %rcx,%rsi
+     d81:	89 c7                	mov    %eax,%edi
+     d83:	b8 00 00 00 00       	mov    $0x0,%eax
+     d88:	e8 ef 04 00 00       	call   127c <printf>
+         info1.pages_in_use);
+  printf(stdout, "pages_in_swap before copy-on-write fork = %d\n",
+     d8d:	8b 95 d4 fc ff ff    	mov    -0x32c(%rbp),%edx
+     d93:	8b 05 67 32 00 00    	mov    0x3267(%rip),%eax        # 4000 <stdout>
+     d99:	48 8d 0d e0 25 00 00 	lea    0x25e0(%rip),%rcx        # 3380 <benchreport+0x637>
+     da0:	48 89 ce             	mov    %rcx,%rsi
+     da3:	89 c7                	mov    %eax,%edi
+     da5:	b8 00 00 00 00       	mov    $0x0,%eax
+     daa:	e8 cd 04 00 00       	call   127c <printf>
+         info1.pages_in_swap);
+  int pid = fork();
+     daf:	e8 e8 0a 00 00       	call   189c <fork>
+     db4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+  if (pid == 0) {
+     db7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     dbb:	75 0f                	jne    dcc <copyonwriteforktest+0xb3>
+    sleep(100);
+     dbd:	bf 64 00 00 00       	mov    $0x64,%edi
+     dc2:	e8 2f 16 00 00       	call   23f6 <sleep>
+    exit();
+     dc7:	e8 e0 0a 00 00       	call   18ac <exit>
+  } else {
+    sysinfo(&info2);
+     dcc:	48 8d 85 b0 f9 ff ff 	lea    -0x650(%rbp),%rax
+     dd3:	48 89 c7             	mov    %rax,%rdi
+     dd6:	e8 31 16 00 00       	call   240c <sysinfo>
+    printf(stdout, "pages_in_use after copy-on-write fork = %d\n",
+     ddb:	8b 95 b8 f9 ff ff    	mov    -0x648(%rbp),%edx
+     de1:	8b 05 19 32 00 00    	mov    0x3219(%rip),%eax        # 4000 <stdout>
+     de7:	48 8d 0d c2 25 00 00 	lea    0x25c2(%rip),%rcx        # 33b0 <benchreport+0x667>
+     dee:	48 89 ce             	mov    %rcx,%rsi
+     df1:	89 c7                	mov    %eax,%edi
+     df3:	b8 00 00 00 00       	mov    $0x0,%eax
+     df8:	e8 7f 04 00 00       	call   127c <printf>
+           info2.pages_in_use);
+    printf(stdout, "pages_in_swap after copy-on-write fork = %d\n",
+     dfd:	8b 95 bc f9 ff ff    	mov    -0x644(%rbp),%edx
+     e03:	8b 05 f7 31 00 00    	mov    0x31f7(%rip),%eax        # 4000 <stdout>
+     e09:	48 8d 0d d0 25 00 00 	lea    0x25d0(%rip),%rcx        # 33e0 <benchreport+0x697>
+     e10:	48 89 ce             	mov    %rcx,%rsi
+     e13:	89 c7                	mov    %eax,%edi
+     e15:	b8 00 00 00 00       	mov    $0x0,%eax
+     e1a:	e8 5d 04 00 00       	call   127c <printf>
+           info2.pages_in_swap);
+
+    // if copy-on-write is implemented, there is no way a new process can take
+    // more than 100 pages
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     e1f:	8b 95 b8 f9 ff ff    	mov    -0x648(%rbp),%edx
+     e25:	8b 85 d0 fc ff ff    	mov    -0x330(%rbp),%eax
+     e2b:	29 c2                	sub    %eax,%edx
+     e2d:	8b 85 d4 fc ff ff    	mov    -0x32c(%rbp),%eax
+     e33:	01 c2                	add    %eax,%edx
+            info2.pages_in_swap >
+     e35:	8b 85 bc f9 ff ff    	mov    -0x644(%rbp),%eax
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap -
+     e3b:	29 c2                	sub    %eax,%edx
+     e3d:	83 fa 64             	cmp    $0x64,%edx
+     e40:	7e 5c                	jle    e9e <copyonwriteforktest+0x185>
+        100)
+      error("too much memory is used for fork");
+     e42:	8b 05 b8 31 00 00    	mov    0x31b8(%rip),%eax        # 4000 <stdout>
+     e48:	ba 14 01 00 00       	mov    $0x114,%edx
+     e4d:	48 8d 0d 5a 20 00 00 	lea    0x205a(%rip),%rcx        # 2eae <benchreport+0x165>
+     e54:	48 89 ce             	mov    %rcx,%rsi
+     e57:	89 c7                	mov    %eax,%edi
+     e59:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5e:	e8 19 04 00 00       	call   127c <printf>
+     e63:	8b 05 97 31 00 00    	mov    0x3197(%rip),%eax        # 4000 <stdout>
+     e69:	48 8d 15 a0 25 00 00 	lea    0x25a0(%rip),%rdx        # 3410 <benchreport+0x6c7>
+     e70:	48 89 d6             	mov    %rdx,%rsi
+     e73:	89 c7                	mov    %eax,%edi
+     e75:	b8 00 00 00 00       	mov    $0x0,%eax
+     e7a:	e8 fd 03 00 00       	call   127c <printf>
+     e7f:	8b 05 7b 31 00 00    	mov    0x317b(%rip),%eax        # 4000 <stdout>
+     e85:	48 8d 15 4e 20 00 00 	lea    0x204e(%rip),%rdx        # 2eda <benchreport+0x191>
+     e8c:	48 89 d6             	mov    %rdx,%rsi
+     e8f:	89 c7                	mov    %eax,%edi
+     e91:	b8 00 00 00 00       	mov    $0x0,%eax
+     e96:	e8 e1 03 00 00       	call   127c <printf>
+     e9b:	90                   	nop
+     e9c:	eb fd                	jmp    e9b <copyonwriteforktest+0x182>
+
+    for (j = 0; j < 200; j++) {
+     e9e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     ea5:	eb 1a                	jmp    ec1 <copyonwriteforktest+0x1a8>
+      b = a[j * 4096];
+     ea7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     eaa:	c1 e0 0c             	shl    $0xc,%eax
+     ead:	48 63 d0             	movslq %eax,%rdx
+     eb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eb4:	48 01 d0             	add    %rdx,%rax
+     eb7:	0f b6 00             	movzbl (%rax),%eax
+     eba:	88 45 ff             	mov    %al,-0x1(%rbp)
+    for (j = 0; j < 200; j++) {
+     ebd:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     ec1:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+     ec8:	7e dd                	jle    ea7 <copyonwriteforktest+0x18e>
+    }
+
+    sysinfo(&info3);
+     eca:	48 8d 85 98 f6 ff ff 	lea    -0x968(%rbp),%rax
+     ed1:	48 89 c7             	mov    %rax,%rdi
+     ed4:	e8 33 15 00 00       	call   240c <sysinfo>
+    printf(stdout, "pages_in_use after read = %d\n", info3.pages_in_use);
+     ed9:	8b 95 a0 f6 ff ff    	mov    -0x960(%rbp),%edx
+     edf:	8b 05 1b 31 00 00    	mov    0x311b(%rip),%eax        # 4000 <stdout>
+     ee5:	48 8d 0d 45 25 00 00 	lea    0x2545(%rip),%rcx        # 3431 <benchreport+0x6e8>
+     eec:	48 89 ce             	mov    %rcx,%rsi
+     eef:	89 c7                	mov    %eax,%edi
+     ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef6:	e8 81 03 00 00       	call   127c <printf>
+    printf(stdout, "pages_in_swap after read = %d\n", info3.pages_in_swap);
+     efb:	8b 95 a4 f6 ff ff    	mov    -0x95c(%rbp),%edx
+     f01:	8b 05 f9 30 00 00    	mov    0x30f9(%rip),%eax        # 4000 <stdout>
+     f07:	48 8d 0d 42 25 00 00 	lea    0x2542(%rip),%rcx        # 3450 <benchreport+0x707>
+     f0e:	48 89 ce             	mov    %rcx,%rsi
+     f11:	89 c7                	mov    %eax,%edi
+     f13:	b8 00 00 00 00       	mov    $0x0,%eax
+     f18:	e8 5f 03 00 00       	call   127c <printf>
+
+    // Read should not increase the amount of memory allocated
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap -
+     f1d:	8b 95 a0 f6 ff ff    	mov    -0x960(%rbp),%edx
+     f23:	8b 85 b8 f9 ff ff    	mov    -0x648(%rbp),%eax
+     f29:	29 c2                	sub    %eax,%edx
+     f2b:	8b 85 a4 f6 ff ff    	mov    -0x95c(%rbp),%eax
+     f31:	01 c2                	add    %eax,%edx
+            info2.pages_in_swap >
+     f33:	8b 85 bc f9 ff ff    	mov    -0x644(%rbp),%eax
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap -
+     f39:	29 c2                	sub    %eax,%edx
+     f3b:	83 fa 64             	cmp    $0x64,%edx
+     f3e:	7e 5c                	jle    f9c <copyonwriteforktest+0x283>
+        100)
+      error("too much memory is used for read");
+     f40:	8b 05 ba 30 00 00    	mov    0x30ba(%rip),%eax        # 4000 <stdout>
+     f46:	ba 22 01 00 00       	mov    $0x122,%edx
+     f4b:	48 8d 0d 5c 1f 00 00 	lea    0x1f5c(%rip),%rcx        # 2eae <benchreport+0x165>
+     f52:	48 89 ce             	mov    %rcx,%rsi
+     f55:	89 c7                	mov    %eax,%edi
+     f57:	b8 00 00 00 00       	mov    $0x0,%eax
+     f5c:	e8 1b 03 00 00       	call   127c <printf>
+     f61:	8b 05 99 30 00 00    	mov    0x3099(%rip),%eax        # 4000 <stdout>
+     f67:	48 8d 15 02 25 00 00 	lea    0x2502(%rip),%rdx        # 3470 <benchreport+0x727>
+     f6e:	48 89 d6             	mov    %rdx,%rsi
+     f71:	89 c7                	mov    %eax,%edi
+     f73:	b8 00 00 00 00       	mov    $0x0,%eax
+     f78:	e8 ff 02 00 00       	call   127c <printf>
+     f7d:	8b 05 7d 30 00 00    	mov    0x307d(%rip),%eax        # 4000 <stdout>
+     f83:	48 8d 15 50 1f 00 00 	lea    0x1f50(%rip),%rdx        # 2eda <benchreport+0x191>
+     f8a:	48 89 d6             	mov    %rdx,%rsi
+     f8d:	89 c7                	mov    %eax,%edi
+     f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f94:	e8 e3 02 00 00       	call   127c <printf>
+     f99:	90                   	nop
+     f9a:	eb fd                	jmp    f99 <copyonwriteforktest+0x280>
+
+    for (j = 0; j < 200; j++) {
+     f9c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     fa3:	eb 1a                	jmp    fbf <copyonwriteforktest+0x2a6>
+      a[j * 4096] = b;
+     fa5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     fa8:	c1 e0 0c             	shl    $0xc,%eax
+     fab:	48 63 d0             	movslq %eax,%rdx
+     fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fb2:	48 01 c2             	add    %rax,%rdx
+     fb5:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+     fb9:	88 02                	mov    %al,(%rdx)
+    for (j = 0; j < 200; j++) {
+     fbb:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     fbf:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+     fc6:	7e dd                	jle    fa5 <copyonwriteforktest+0x28c>
+    }
+
+    sysinfo(&info4);
+     fc8:	48 8d 85 80 f3 ff ff 	lea    -0xc80(%rbp),%rax
+     fcf:	48 89 c7             	mov    %rax,%rdi
+     fd2:	e8 35 14 00 00       	call   240c <sysinfo>
+    printf(stdout, "pages_in_use after write = %d\n", info4.pages_in_use);
+     fd7:	8b 95 88 f3 ff ff    	mov    -0xc78(%rbp),%edx
+     fdd:	8b 05 1d 30 00 00    	mov    0x301d(%rip),%eax        # 4000 <stdout>
+     fe3:	48 8d 0d ae 24 00 00 	lea    0x24ae(%rip),%rcx        # 3498 <benchreport+0x74f>
+     fea:	48 89 ce             	mov    %rcx,%rsi
+     fed:	89 c7                	mov    %eax,%edi
+     fef:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff4:	e8 83 02 00 00       	call   127c <printf>
+    printf(stdout, "pages_in_swap after write = %d\n", info4.pages_in_swap);
+     ff9:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+     fff:	8b 05 fb 2f 00 00    	mov    0x2ffb(%rip),%eax        # 4000 <stdout>
+    1005:	48 8d 0d ac 24 00 00 	lea    0x24ac(%rip),%rcx        # 34b8 <benchreport+0x76f>
+    100c:	48 89 ce             	mov    %rcx,%rsi
+    100f:	89 c7                	mov    %eax,%edi
+    1011:	b8 00 00 00 00       	mov    $0x0,%eax
+    1016:	e8 61 02 00 00       	call   127c <printf>
+
+    // Write should allocate the 200 pages of memory
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap -
+    101b:	8b 95 88 f3 ff ff    	mov    -0xc78(%rbp),%edx
+    1021:	8b 85 a0 f6 ff ff    	mov    -0x960(%rbp),%eax
+    1027:	29 c2                	sub    %eax,%edx
+    1029:	8b 85 8c f3 ff ff    	mov    -0xc74(%rbp),%eax
+    102f:	01 c2                	add    %eax,%edx
+            info3.pages_in_swap <
+    1031:	8b 85 a4 f6 ff ff    	mov    -0x95c(%rbp),%eax
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap -
+    1037:	29 c2                	sub    %eax,%edx
+    1039:	83 fa 63             	cmp    $0x63,%edx
+    103c:	7f 5c                	jg     109a <copyonwriteforktest+0x381>
+        100)
+      error("too less memory is used for write");
+    103e:	8b 05 bc 2f 00 00    	mov    0x2fbc(%rip),%eax        # 4000 <stdout>
+    1044:	ba 30 01 00 00       	mov    $0x130,%edx
+    1049:	48 8d 0d 5e 1e 00 00 	lea    0x1e5e(%rip),%rcx        # 2eae <benchreport+0x165>
+    1050:	48 89 ce             	mov    %rcx,%rsi
+    1053:	89 c7                	mov    %eax,%edi
+    1055:	b8 00 00 00 00       	mov    $0x0,%eax
+    105a:	e8 1d 02 00 00       	call   127c <printf>
+    105f:	8b 05 9b 2f 00 00    	mov    0x2f9b(%rip),%eax        # 4000 <stdout>
+    1065:	48 8d 15 6c 24 00 00 	lea    0x246c(%rip),%rdx        # 34d8 <benchreport+0x78f>
+    106c:	48 89 d6             	mov    %rdx,%rsi
+    106f:	89 c7                	mov    %eax,%edi
+    1071:	b8 00 00 00 00       	mov    $0x0,%eax
+    1076:	e8 01 02 00 00       	call   127c <printf>
+    107b:	8b 05 7f 2f 00 00    	mov    0x2f7f(%rip),%eax        # 4000 <stdout>
+    1081:	48 8d 15 52 1e 00 00 	lea    0x1e52(%rip),%rdx        # 2eda <benchreport+0x191>
+    1088:	48 89 d6             	mov    %rdx,%rsi
+    108b:	89 c7                	mov    %eax,%edi
+    108d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1092:	e8 e5 01 00 00       	call   127c <printf>
+    1097:	90                   	nop
+    1098:	eb fd                	jmp    1097 <copyonwriteforktest+0x37e>
+    
+    wait();
+    109a:	e8 9c 12 00 00       	call   233b <wait>
+  }
+
+  printf(stdout, "copyonwriteforktest passed\n");
+    109f:	8b 05 5b 2f 00 00    	mov    0x2f5b(%rip),%eax        # 4000 <stdout>
+    10a5:	48 8d 15 4e 24 00 00 	lea    0x244e(%rip),%rdx        # 34fa <benchreport+0x7b1>
+    10ac:	48 89 d6             	mov    %rdx,%rsi
+    10af:	89 c7                	mov    %eax,%edi
+    10b1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10b6:	e8 c1 01 00 00       	call   127c <printf>
+}
+    10bb:	90                   	nop
+    10bc:	c9                   	leave
+    10bd:	c3                   	ret
+
+00000000000010be <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    10be:	55                   	push   %rbp
+    10bf:	48 89 e5             	mov    %rsp,%rbp
+    10c2:	48 83 ec 10          	sub    $0x10,%rsp
+    10c6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    10c9:	89 f0                	mov    %esi,%eax
+    10cb:	88 45 f8             	mov    %al,-0x8(%rbp)
+    10ce:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    10d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10d5:	89 d6                	mov    %edx,%esi
+    10d7:	89 c7                	mov    %eax,%edi
+    10d9:	e8 eb 06 00 00       	call   17c9 <bputc>
+    10de:	90                   	nop
+    10df:	c9                   	leave
+    10e0:	c3                   	ret
+
+00000000000010e1 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    10e1:	55                   	push   %rbp
+    10e2:	48 89 e5             	mov    %rsp,%rbp
+    10e5:	48 83 ec 50          	sub    $0x50,%rsp
+    10e9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    10ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    10f0:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    10f3:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    10f6:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    10fa:	74 21                	je     111d <printint64+0x3c>
+    10fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1100:	48 c1 e8 3f          	shr    $0x3f,%rax
+    1104:	0f b6 c0             	movzbl %al,%eax
+    1107:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    110a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    110e:	74 0d                	je     111d <printint64+0x3c>
+    x = -xx;
+    1110:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1114:	48 f7 d8             	neg    %rax
+    1117:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    111b:	eb 08                	jmp    1125 <printint64+0x44>
+  else
+    x = xx;
+    111d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1121:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1125:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    112c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    112f:	48 63 c8             	movslq %eax,%rcx
+    1132:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1136:	ba 00 00 00 00       	mov    $0x0,%edx
+    113b:	48 f7 f1             	div    %rcx
+    113e:	48 89 d1             	mov    %rdx,%rcx
+    1141:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1144:	8d 50 01             	lea    0x1(%rax),%edx
+    1147:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    114a:	48 8d 15 bf 2e 00 00 	lea    0x2ebf(%rip),%rdx        # 4010 <digits.1>
+    1151:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1155:	48 98                	cltq
+    1157:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    115b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    115e:	48 63 f0             	movslq %eax,%rsi
+    1161:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1165:	ba 00 00 00 00       	mov    $0x0,%edx
+    116a:	48 f7 f6             	div    %rsi
+    116d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1171:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1176:	75 b4                	jne    112c <printint64+0x4b>
+
+  if (sgn)
+    1178:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    117c:	74 2b                	je     11a9 <printint64+0xc8>
+    buf[i++] = '-';
+    117e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1181:	8d 50 01             	lea    0x1(%rax),%edx
+    1184:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1187:	48 98                	cltq
+    1189:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    118e:	eb 19                	jmp    11a9 <printint64+0xc8>
+    putc(fd, buf[i]);
+    1190:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1193:	48 98                	cltq
+    1195:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    119a:	0f be d0             	movsbl %al,%edx
+    119d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    11a0:	89 d6                	mov    %edx,%esi
+    11a2:	89 c7                	mov    %eax,%edi
+    11a4:	e8 15 ff ff ff       	call   10be <putc>
+  while (--i >= 0)
+    11a9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    11ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    11b1:	79 dd                	jns    1190 <printint64+0xaf>
+}
+    11b3:	90                   	nop
+    11b4:	90                   	nop
+    11b5:	c9                   	leave
+    11b6:	c3                   	ret
+
+00000000000011b7 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    11b7:	55                   	push   %rbp
+    11b8:	48 89 e5             	mov    %rsp,%rbp
+    11bb:	48 83 ec 30          	sub    $0x30,%rsp
+    11bf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    11c2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    11c5:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    11c8:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    11cb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    11d2:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    11d6:	74 17                	je     11ef <printint+0x38>
+    11d8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    11dc:	79 11                	jns    11ef <printint+0x38>
+    neg = 1;
+    11de:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    11e5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    11e8:	f7 d8                	neg    %eax
+    11ea:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    11ed:	eb 06                	jmp    11f5 <printint+0x3e>
+  } else {
+    x = xx;
+    11ef:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    11f2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    11f5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    11fc:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    11ff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1202:	ba 00 00 00 00       	mov    $0x0,%edx
+    1207:	f7 f1                	div    %ecx
+    1209:	89 d1                	mov    %edx,%ecx
+    120b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    120e:	8d 50 01             	lea    0x1(%rax),%edx
+    1211:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1214:	89 c9                	mov    %ecx,%ecx
+    1216:	48 8d 15 13 2e 00 00 	lea    0x2e13(%rip),%rdx        # 4030 <digits.0>
+    121d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1221:	48 98                	cltq
+    1223:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    1227:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    122a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    122d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1232:	f7 f6                	div    %esi
+    1234:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1237:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    123b:	75 bf                	jne    11fc <printint+0x45>
+  if (neg)
+    123d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1241:	74 2b                	je     126e <printint+0xb7>
+    buf[i++] = '-';
+    1243:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1246:	8d 50 01             	lea    0x1(%rax),%edx
+    1249:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    124c:	48 98                	cltq
+    124e:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1253:	eb 19                	jmp    126e <printint+0xb7>
+    putc(fd, buf[i]);
+    1255:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1258:	48 98                	cltq
+    125a:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    125f:	0f be d0             	movsbl %al,%edx
+    1262:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1265:	89 d6                	mov    %edx,%esi
+    1267:	89 c7                	mov    %eax,%edi
+    1269:	e8 50 fe ff ff       	call   10be <putc>
+  while (--i >= 0)
+    126e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1272:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1276:	79 dd                	jns    1255 <printint+0x9e>
+}
+    1278:	90                   	nop
+    1279:	90                   	nop
+    127a:	c9                   	leave
+    127b:	c3                   	ret
+
+000000000000127c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    127c:	55                   	push   %rbp
+    127d:	48 89 e5             	mov    %rsp,%rbp
+    1280:	48 83 ec 70          	sub    $0x70,%rsp
+    1284:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1287:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    128b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    128f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1293:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1297:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    129b:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    12a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    12a6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    12aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    12ae:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    12b2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    12b9:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    12c0:	e9 67 02 00 00       	jmp    152c <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    12c5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    12c8:	48 63 d0             	movslq %eax,%rdx
+    12cb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    12cf:	48 01 d0             	add    %rdx,%rax
+    12d2:	0f b6 00             	movzbl (%rax),%eax
+    12d5:	0f be c0             	movsbl %al,%eax
+    12d8:	25 ff 00 00 00       	and    $0xff,%eax
+    12dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    12e0:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    12e4:	75 30                	jne    1316 <printf+0x9a>
+      if (c == '%') {
+    12e6:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    12ea:	75 13                	jne    12ff <printf+0x83>
+        state = '%';
+    12ec:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    12f3:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    12fa:	e9 29 02 00 00       	jmp    1528 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    12ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1302:	0f be d0             	movsbl %al,%edx
+    1305:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1308:	89 d6                	mov    %edx,%esi
+    130a:	89 c7                	mov    %eax,%edi
+    130c:	e8 ad fd ff ff       	call   10be <putc>
+    1311:	e9 12 02 00 00       	jmp    1528 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    1316:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    131a:	0f 85 08 02 00 00    	jne    1528 <printf+0x2ac>
+      if (c == 'l') {
+    1320:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1324:	75 0c                	jne    1332 <printf+0xb6>
+        lflag = 1;
+    1326:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    132d:	e9 f6 01 00 00       	jmp    1528 <printf+0x2ac>
+      } else if (c == 'd') {
+    1332:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1336:	0f 85 93 00 00 00    	jne    13cf <printf+0x153>
+        if (lflag == 1)
+    133c:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1340:	75 47                	jne    1389 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1342:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1345:	83 f8 2f             	cmp    $0x2f,%eax
+    1348:	77 17                	ja     1361 <printf+0xe5>
+    134a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    134e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1351:	89 d2                	mov    %edx,%edx
+    1353:	48 01 d0             	add    %rdx,%rax
+    1356:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1359:	83 c2 08             	add    $0x8,%edx
+    135c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    135f:	eb 0c                	jmp    136d <printf+0xf1>
+    1361:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1365:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1369:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    136d:	48 8b 30             	mov    (%rax),%rsi
+    1370:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1373:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1378:	ba 0a 00 00 00       	mov    $0xa,%edx
+    137d:	89 c7                	mov    %eax,%edi
+    137f:	e8 5d fd ff ff       	call   10e1 <printint64>
+    1384:	e9 98 01 00 00       	jmp    1521 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1389:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    138c:	83 f8 2f             	cmp    $0x2f,%eax
+    138f:	77 17                	ja     13a8 <printf+0x12c>
+    1391:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1395:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1398:	89 d2                	mov    %edx,%edx
+    139a:	48 01 d0             	add    %rdx,%rax
+    139d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13a0:	83 c2 08             	add    $0x8,%edx
+    13a3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    13a6:	eb 0c                	jmp    13b4 <printf+0x138>
+    13a8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    13ac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    13b0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    13b4:	8b 30                	mov    (%rax),%esi
+    13b6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    13b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+    13be:	ba 0a 00 00 00       	mov    $0xa,%edx
+    13c3:	89 c7                	mov    %eax,%edi
+    13c5:	e8 ed fd ff ff       	call   11b7 <printint>
+    13ca:	e9 52 01 00 00       	jmp    1521 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    13cf:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    13d3:	74 0a                	je     13df <printf+0x163>
+    13d5:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    13d9:	0f 85 93 00 00 00    	jne    1472 <printf+0x1f6>
+        if (lflag == 1)
+    13df:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    13e3:	75 47                	jne    142c <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    13e5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    13e8:	83 f8 2f             	cmp    $0x2f,%eax
+    13eb:	77 17                	ja     1404 <printf+0x188>
+    13ed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13f1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13f4:	89 d2                	mov    %edx,%edx
+    13f6:	48 01 d0             	add    %rdx,%rax
+    13f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13fc:	83 c2 08             	add    $0x8,%edx
+    13ff:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1402:	eb 0c                	jmp    1410 <printf+0x194>
+    1404:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1408:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    140c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1410:	48 8b 30             	mov    (%rax),%rsi
+    1413:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1416:	b9 00 00 00 00       	mov    $0x0,%ecx
+    141b:	ba 10 00 00 00       	mov    $0x10,%edx
+    1420:	89 c7                	mov    %eax,%edi
+    1422:	e8 ba fc ff ff       	call   10e1 <printint64>
+        if (lflag == 1)
+    1427:	e9 f5 00 00 00       	jmp    1521 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    142c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    142f:	83 f8 2f             	cmp    $0x2f,%eax
+    1432:	77 17                	ja     144b <printf+0x1cf>
+    1434:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1438:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    143b:	89 d2                	mov    %edx,%edx
+    143d:	48 01 d0             	add    %rdx,%rax
+    1440:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1443:	83 c2 08             	add    $0x8,%edx
+    1446:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1449:	eb 0c                	jmp    1457 <printf+0x1db>
+    144b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    144f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1453:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1457:	8b 30                	mov    (%rax),%esi
+    1459:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    145c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1461:	ba 10 00 00 00       	mov    $0x10,%edx
+    1466:	89 c7                	mov    %eax,%edi
+    1468:	e8 4a fd ff ff       	call   11b7 <printint>
+        if (lflag == 1)
+    146d:	e9 af 00 00 00       	jmp    1521 <printf+0x2a5>
+      } else if (c == 's') {
+    1472:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1476:	75 6e                	jne    14e6 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1478:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    147b:	83 f8 2f             	cmp    $0x2f,%eax
+    147e:	77 17                	ja     1497 <printf+0x21b>
+    1480:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1484:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1487:	89 d2                	mov    %edx,%edx
+    1489:	48 01 d0             	add    %rdx,%rax
+    148c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    148f:	83 c2 08             	add    $0x8,%edx
+    1492:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1495:	eb 0c                	jmp    14a3 <printf+0x227>
+    1497:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    149b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    149f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    14a3:	48 8b 00             	mov    (%rax),%rax
+    14a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    14aa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    14af:	75 28                	jne    14d9 <printf+0x25d>
+          s = "(null)";
+    14b1:	48 8d 05 5e 20 00 00 	lea    0x205e(%rip),%rax        # 3516 <benchreport+0x7cd>
+    14b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    14bc:	eb 1b                	jmp    14d9 <printf+0x25d>
+          putc(fd, *s);
+    14be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    14c2:	0f b6 00             	movzbl (%rax),%eax
+    14c5:	0f be d0             	movsbl %al,%edx
+    14c8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14cb:	89 d6                	mov    %edx,%esi
+    14cd:	89 c7                	mov    %eax,%edi
+    14cf:	e8 ea fb ff ff       	call   10be <putc>
+        for (; *s; s++)
+    14d4:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    14d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    14dd:	0f b6 00             	movzbl (%rax),%eax
+    14e0:	84 c0                	test   %al,%al
+    14e2:	75 da                	jne    14be <printf+0x242>
+    14e4:	eb 3b                	jmp    1521 <printf+0x2a5>
+      } else if (c == '%') {
+    14e6:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    14ea:	75 14                	jne    1500 <printf+0x284>
+        putc(fd, c);
+    14ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    14ef:	0f be d0             	movsbl %al,%edx
+    14f2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14f5:	89 d6                	mov    %edx,%esi
+    14f7:	89 c7                	mov    %eax,%edi
+    14f9:	e8 c0 fb ff ff       	call   10be <putc>
+    14fe:	eb 21                	jmp    1521 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1500:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1503:	be 25 00 00 00       	mov    $0x25,%esi
+    1508:	89 c7                	mov    %eax,%edi
+    150a:	e8 af fb ff ff       	call   10be <putc>
+        putc(fd, c);
+    150f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1512:	0f be d0             	movsbl %al,%edx
+    1515:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1518:	89 d6                	mov    %edx,%esi
+    151a:	89 c7                	mov    %eax,%edi
+    151c:	e8 9d fb ff ff       	call   10be <putc>
+      }
+      state = 0;
+    1521:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1528:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    152c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    152f:	48 63 d0             	movslq %eax,%rdx
+    1532:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1536:	48 01 d0             	add    %rdx,%rax
+    1539:	0f b6 00             	movzbl (%rax),%eax
+    153c:	84 c0                	test   %al,%al
+    153e:	0f 85 81 fd ff ff    	jne    12c5 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    1544:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1547:	89 c7                	mov    %eax,%edi
+    1549:	e8 ee 02 00 00       	call   183c <bflushtty>
+}
+    154e:	90                   	nop
+    154f:	c9                   	leave
+    1550:	c3                   	ret
+
+0000000000001551 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    1551:	55                   	push   %rbp
+    1552:	48 89 e5             	mov    %rsp,%rbp
+    1555:	48 83 ec 30          	sub    $0x30,%rsp
+    1559:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    155c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1560:	78 06                	js     1568 <getbuf+0x17>
+    1562:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    1566:	7e 0a                	jle    1572 <getbuf+0x21>
+    return 0;
+    1568:	b8 00 00 00 00       	mov    $0x0,%eax
+    156d:	e9 94 00 00 00       	jmp    1606 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    1572:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1575:	48 98                	cltq
+    1577:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    157e:	00 
+    157f:	48 8d 05 da 4a 00 00 	lea    0x4ada(%rip),%rax        # 6060 <obufs>
+    1586:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    158a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    158e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1593:	75 6d                	jne    1602 <getbuf+0xb1>
+    1595:	bf 08 02 00 00       	mov    $0x208,%edi
+    159a:	e8 bd 13 00 00       	call   295c <malloc>
+    159f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15a3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    15a8:	74 58                	je     1602 <getbuf+0xb1>
+    b->n = 0;
+    15aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ae:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    15b4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    15b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    15bb:	48 89 d6             	mov    %rdx,%rsi
+    15be:	89 c7                	mov    %eax,%edi
+    15c0:	e8 e4 0d 00 00       	call   23a9 <fstat>
+    15c5:	85 c0                	test   %eax,%eax
+    15c7:	75 11                	jne    15da <getbuf+0x89>
+    15c9:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    15cd:	66 83 f8 03          	cmp    $0x3,%ax
+    15d1:	75 07                	jne    15da <getbuf+0x89>
+    15d3:	ba 01 00 00 00       	mov    $0x1,%edx
+    15d8:	eb 05                	jmp    15df <getbuf+0x8e>
+    15da:	ba 00 00 00 00       	mov    $0x0,%edx
+    15df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e3:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    15e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    15e9:	48 98                	cltq
+    15eb:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    15f2:	00 
+    15f3:	48 8d 15 66 4a 00 00 	lea    0x4a66(%rip),%rdx        # 6060 <obufs>
+    15fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15fe:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    1602:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1606:	c9                   	leave
+    1607:	c3                   	ret
+
+0000000000001608 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    1608:	55                   	push   %rbp
+    1609:	48 89 e5             	mov    %rsp,%rbp
+    160c:	48 83 ec 20          	sub    $0x20,%rsp
+    1610:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    1613:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1617:	78 33                	js     164c <bflush+0x44>
+    1619:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    161d:	7f 2d                	jg     164c <bflush+0x44>
+    161f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1622:	48 98                	cltq
+    1624:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    162b:	00 
+    162c:	48 8d 05 2d 4a 00 00 	lea    0x4a2d(%rip),%rax        # 6060 <obufs>
+    1633:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1637:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    163b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1640:	74 0a                	je     164c <bflush+0x44>
+    1642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1646:	8b 00                	mov    (%rax),%eax
+    1648:	85 c0                	test   %eax,%eax
+    164a:	75 07                	jne    1653 <bflush+0x4b>
+    return 0;
+    164c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1651:	eb 3c                	jmp    168f <bflush+0x87>
+  n = b->n;
+    1653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1657:	8b 00                	mov    (%rax),%eax
+    1659:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    165c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1660:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    1666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    166e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1671:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1674:	48 89 ce             	mov    %rcx,%rsi
+    1677:	89 c7                	mov    %eax,%edi
+    1679:	e8 de 0c 00 00       	call   235c <write>
+    167e:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1681:	75 07                	jne    168a <bflush+0x82>
+    1683:	b8 00 00 00 00       	mov    $0x0,%eax
+    1688:	eb 05                	jmp    168f <bflush+0x87>
+    168a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    168f:	c9                   	leave
+    1690:	c3                   	ret
+
+0000000000001691 <bflushall>:
+
+void bflushall(void) {
+    1691:	55                   	push   %rbp
+    1692:	48 89 e5             	mov    %rsp,%rbp
+    1695:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    1699:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    16a0:	eb 0e                	jmp    16b0 <bflushall+0x1f>
+    bflush(fd);
+    16a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16a5:	89 c7                	mov    %eax,%edi
+    16a7:	e8 5c ff ff ff       	call   1608 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    16ac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    16b0:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    16b4:	7e ec                	jle    16a2 <bflushall+0x11>
+}
+    16b6:	90                   	nop
+    16b7:	90                   	nop
+    16b8:	c9                   	leave
+    16b9:	c3                   	ret
+
+00000000000016ba <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    16ba:	55                   	push   %rbp
+    16bb:	48 89 e5             	mov    %rsp,%rbp
+    16be:	48 83 ec 30          	sub    $0x30,%rsp
+    16c2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    16c5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    16c9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    16cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16cf:	89 c7                	mov    %eax,%edi
+    16d1:	e8 7b fe ff ff       	call   1551 <getbuf>
+    16d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    16da:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16df:	75 19                	jne    16fa <bwrite+0x40>
+    return write(fd, s, n);
+    16e1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    16e4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    16e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16eb:	48 89 ce             	mov    %rcx,%rsi
+    16ee:	89 c7                	mov    %eax,%edi
+    16f0:	e8 67 0c 00 00       	call   235c <write>
+    16f5:	e9 cd 00 00 00       	jmp    17c7 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    16fa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1701:	e9 92 00 00 00       	jmp    1798 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    1706:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170a:	8b 00                	mov    (%rax),%eax
+    170c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1711:	75 18                	jne    172b <bwrite+0x71>
+    1713:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1716:	89 c7                	mov    %eax,%edi
+    1718:	e8 eb fe ff ff       	call   1608 <bflush>
+    171d:	85 c0                	test   %eax,%eax
+    171f:	79 0a                	jns    172b <bwrite+0x71>
+      return -1;
+    1721:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1726:	e9 9c 00 00 00       	jmp    17c7 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    172b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    172e:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    1731:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    1734:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1738:	8b 00                	mov    (%rax),%eax
+    173a:	ba 00 02 00 00       	mov    $0x200,%edx
+    173f:	29 c2                	sub    %eax,%edx
+    1741:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    1744:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1747:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    174a:	39 c2                	cmp    %eax,%edx
+    174c:	0f 4e c2             	cmovle %edx,%eax
+    174f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    1752:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1755:	48 63 d0             	movslq %eax,%rdx
+    1758:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    175c:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    1760:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1764:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176c:	8b 00                	mov    (%rax),%eax
+    176e:	48 98                	cltq
+    1770:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1774:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1777:	89 c2                	mov    %eax,%edx
+    1779:	48 89 cf             	mov    %rcx,%rdi
+    177c:	e8 e9 06 00 00       	call   1e6a <memmove>
+    b->n += m;
+    1781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1785:	8b 10                	mov    (%rax),%edx
+    1787:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    178a:	01 c2                	add    %eax,%edx
+    178c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1790:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    1792:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1795:	01 45 fc             	add    %eax,-0x4(%rbp)
+    1798:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    179b:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    179e:	0f 8c 62 ff ff ff    	jl     1706 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    17a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a8:	8b 40 04             	mov    0x4(%rax),%eax
+    17ab:	85 c0                	test   %eax,%eax
+    17ad:	74 15                	je     17c4 <bwrite+0x10a>
+    17af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    17b2:	89 c7                	mov    %eax,%edi
+    17b4:	e8 4f fe ff ff       	call   1608 <bflush>
+    17b9:	85 c0                	test   %eax,%eax
+    17bb:	79 07                	jns    17c4 <bwrite+0x10a>
+    return -1;
+    17bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    17c2:	eb 03                	jmp    17c7 <bwrite+0x10d>
+  return n;
+    17c4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    17c7:	c9                   	leave
+    17c8:	c3                   	ret
+
+00000000000017c9 <bputc>:
+
+void bputc(int fd, char c) {
+    17c9:	55                   	push   %rbp
+    17ca:	48 89 e5             	mov    %rsp,%rbp
+    17cd:	48 83 ec 20          	sub    $0x20,%rsp
+    17d1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    17d4:	89 f0                	mov    %esi,%eax
+    17d6:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    17d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    17dc:	89 c7                	mov    %eax,%edi
+    17de:	e8 6e fd ff ff       	call   1551 <getbuf>
+    17e3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17e7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    17ec:	75 18                	jne    1806 <bputc+0x3d>
+    write(fd, &c, 1);
+    17ee:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    17f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    17f5:	ba 01 00 00 00       	mov    $0x1,%edx
+    17fa:	48 89 ce             	mov    %rcx,%rsi
+    17fd:	89 c7                	mov    %eax,%edi
+    17ff:	e8 58 0b 00 00       	call   235c <write>
+    return;
+    1804:	eb 34                	jmp    183a <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    1806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    180a:	8b 00                	mov    (%rax),%eax
+    180c:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1811:	75 0a                	jne    181d <bputc+0x54>
+    bflush(fd);
+    1813:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1816:	89 c7                	mov    %eax,%edi
+    1818:	e8 eb fd ff ff       	call   1608 <bflush>
+  b->data[b->n++] = c;
+    181d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1821:	8b 00                	mov    (%rax),%eax
+    1823:	8d 48 01             	lea    0x1(%rax),%ecx
+    1826:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    182a:	89 0a                	mov    %ecx,(%rdx)
+    182c:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    1830:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1834:	48 98                	cltq
+    1836:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    183a:	c9                   	leave
+    183b:	c3                   	ret
+
+000000000000183c <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    183c:	55                   	push   %rbp
+    183d:	48 89 e5             	mov    %rsp,%rbp
+    1840:	48 83 ec 10          	sub    $0x10,%rsp
+    1844:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    1847:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    184b:	78 4c                	js     1899 <bflushtty+0x5d>
+    184d:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1851:	7f 46                	jg     1899 <bflushtty+0x5d>
+    1853:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1856:	48 98                	cltq
+    1858:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    185f:	00 
+    1860:	48 8d 05 f9 47 00 00 	lea    0x47f9(%rip),%rax        # 6060 <obufs>
+    1867:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    186b:	48 85 c0             	test   %rax,%rax
+    186e:	74 29                	je     1899 <bflushtty+0x5d>
+    1870:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1873:	48 98                	cltq
+    1875:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    187c:	00 
+    187d:	48 8d 05 dc 47 00 00 	lea    0x47dc(%rip),%rax        # 6060 <obufs>
+    1884:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1888:	8b 40 04             	mov    0x4(%rax),%eax
+    188b:	85 c0                	test   %eax,%eax
+    188d:	74 0a                	je     1899 <bflushtty+0x5d>
+    bflush(fd);
+    188f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1892:	89 c7                	mov    %eax,%edi
+    1894:	e8 6f fd ff ff       	call   1608 <bflush>
+}
+    1899:	90                   	nop
+    189a:	c9                   	leave
+    189b:	c3                   	ret
+
+000000000000189c <fork>:
+
+int fork(void) {
+    189c:	55                   	push   %rbp
+    189d:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    18a0:	e8 ec fd ff ff       	call   1691 <bflushall>
+  return _fork();
+    18a5:	e8 7b 0a 00 00       	call   2325 <_fork>
+}
+    18aa:	5d                   	pop    %rbp
+    18ab:	c3                   	ret
+
+00000000000018ac <exit>:
+
+noreturn void exit(void) {
+    18ac:	55                   	push   %rbp
+    18ad:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    18b0:	e8 dc fd ff ff       	call   1691 <bflushall>
+  _exit();
+    18b5:	e8 76 0a 00 00       	call   2330 <_exit>
+
+00000000000018ba <exec>:
+}
+
+int exec(char *path, char **argv) {
+    18ba:	55                   	push   %rbp
+    18bb:	48 89 e5             	mov    %rsp,%rbp
+    18be:	48 83 ec 10          	sub    $0x10,%rsp
+    18c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    18ca:	e8 c2 fd ff ff       	call   1691 <bflushall>
+  return _exec(path, argv);
+    18cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    18d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18d7:	48 89 d6             	mov    %rdx,%rsi
+    18da:	48 89 c7             	mov    %rax,%rdi
+    18dd:	e8 9b 0a 00 00       	call   237d <_exec>
+}
+    18e2:	c9                   	leave
+    18e3:	c3                   	ret
+
+00000000000018e4 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    18e4:	55                   	push   %rbp
+    18e5:	48 89 e5             	mov    %rsp,%rbp
+    18e8:	48 83 ec 20          	sub    $0x20,%rsp
+    18ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    18f4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    18f8:	e8 94 fd ff ff       	call   1691 <bflushall>
+  return _spawn(path, argv, fds);
+    18fd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1901:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1905:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1909:	48 89 ce             	mov    %rcx,%rsi
+    190c:	48 89 c7             	mov    %rax,%rdi
+    190f:	e8 2f 0b 00 00       	call   2443 <_spawn>
+}
+    1914:	c9                   	leave
+    1915:	c3                   	ret
+
+0000000000001916 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    1916:	55                   	push   %rbp
+    1917:	48 89 e5             	mov    %rsp,%rbp
+    191a:	48 83 ec 10          	sub    $0x10,%rsp
+    191e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    1921:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1925:	78 69                	js     1990 <close+0x7a>
+    1927:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    192b:	7f 63                	jg     1990 <close+0x7a>
+    192d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1930:	48 98                	cltq
+    1932:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1939:	00 
+    193a:	48 8d 05 1f 47 00 00 	lea    0x471f(%rip),%rax        # 6060 <obufs>
+    1941:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1945:	48 85 c0             	test   %rax,%rax
+    1948:	74 46                	je     1990 <close+0x7a>
+    bflush(fd);
+    194a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    194d:	89 c7                	mov    %eax,%edi
+    194f:	e8 b4 fc ff ff       	call   1608 <bflush>
+    free(obufs[fd]);
+    1954:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1957:	48 98                	cltq
+    1959:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1960:	00 
+    1961:	48 8d 05 f8 46 00 00 	lea    0x46f8(%rip),%rax        # 6060 <obufs>
+    1968:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    196c:	48 89 c7             	mov    %rax,%rdi
+    196f:	e8 90 11 00 00       	call   2b04 <free>
+    obufs[fd] = 0;
+    1974:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1977:	48 98                	cltq
+    1979:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1980:	00 
+    1981:	48 8d 05 d8 46 00 00 	lea    0x46d8(%rip),%rax        # 6060 <obufs>
+    1988:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    198f:	00 
+  }
+  return _close(fd);
+    1990:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1993:	89 c7                	mov    %eax,%edi
+    1995:	e8 cd 09 00 00       	call   2367 <_close>
+}
+    199a:	c9                   	leave
+    199b:	c3                   	ret
+
+000000000000199c <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    199c:	55                   	push   %rbp
+    199d:	48 89 e5             	mov    %rsp,%rbp
+    19a0:	53                   	push   %rbx
+    19a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    19a9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    19ad:	48 8b 36             	mov    (%rsi),%rsi
+    19b0:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    19b4:	48 29 f7             	sub    %rsi,%rdi
+    19b7:	48 89 f9             	mov    %rdi,%rcx
+    19ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    19bf:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    19c3:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    19c7:	48 89 f0             	mov    %rsi,%rax
+    19ca:	ba 00 00 00 00       	mov    $0x0,%edx
+    19cf:	48 89 df             	mov    %rbx,%rdi
+    19d2:	48 0f af f8          	imul   %rax,%rdi
+    19d6:	48 89 d6             	mov    %rdx,%rsi
+    19d9:	48 0f af f1          	imul   %rcx,%rsi
+    19dd:	48 01 fe             	add    %rdi,%rsi
+    19e0:	48 f7 e1             	mul    %rcx
+    19e3:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    19e7:	48 89 ca             	mov    %rcx,%rdx
+    19ea:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    19ef:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    19f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    19f7:	c9                   	leave
+    19f8:	c3                   	ret
+
+00000000000019f9 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    19f9:	55                   	push   %rbp
+    19fa:	48 89 e5             	mov    %rsp,%rbp
+    19fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a01:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1a04:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    1a07:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a0b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1a0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1a11:	48 89 ce             	mov    %rcx,%rsi
+    1a14:	48 89 f7             	mov    %rsi,%rdi
+    1a17:	89 d1                	mov    %edx,%ecx
+    1a19:	fc                   	cld
+    1a1a:	f3 aa                	rep stos %al,%es:(%rdi)
+    1a1c:	89 ca                	mov    %ecx,%edx
+    1a1e:	48 89 fe             	mov    %rdi,%rsi
+    1a21:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1a25:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    1a28:	90                   	nop
+    1a29:	5d                   	pop    %rbp
+    1a2a:	c3                   	ret
+
+0000000000001a2b <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    1a2b:	55                   	push   %rbp
+    1a2c:	48 89 e5             	mov    %rsp,%rbp
+    1a2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a33:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a37:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    1a3b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a47:	48 89 ce             	mov    %rcx,%rsi
+    1a4a:	48 89 f7             	mov    %rsi,%rdi
+    1a4d:	48 89 d1             	mov    %rdx,%rcx
+    1a50:	fc                   	cld
+    1a51:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1a54:	48 89 ca             	mov    %rcx,%rdx
+    1a57:	48 89 fe             	mov    %rdi,%rsi
+    1a5a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1a5e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    1a62:	90                   	nop
+    1a63:	5d                   	pop    %rbp
+    1a64:	c3                   	ret
+
+0000000000001a65 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    1a65:	55                   	push   %rbp
+    1a66:	48 89 e5             	mov    %rsp,%rbp
+    1a69:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a6d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a71:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    1a75:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a81:	48 89 cf             	mov    %rcx,%rdi
+    1a84:	48 89 d6             	mov    %rdx,%rsi
+    1a87:	48 89 c1             	mov    %rax,%rcx
+    1a8a:	fc                   	cld
+    1a8b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1a8d:	48 89 c8             	mov    %rcx,%rax
+    1a90:	48 89 f2             	mov    %rsi,%rdx
+    1a93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a97:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1a9b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1a9f:	90                   	nop
+    1aa0:	5d                   	pop    %rbp
+    1aa1:	c3                   	ret
+
+0000000000001aa2 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    1aa2:	55                   	push   %rbp
+    1aa3:	48 89 e5             	mov    %rsp,%rbp
+    1aa6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1aaa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1aae:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    1ab2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1ab6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1aba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1abe:	48 89 cf             	mov    %rcx,%rdi
+    1ac1:	48 89 d6             	mov    %rdx,%rsi
+    1ac4:	48 89 c1             	mov    %rax,%rcx
+    1ac7:	fc                   	cld
+    1ac8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    1acb:	48 89 c8             	mov    %rcx,%rax
+    1ace:	48 89 f2             	mov    %rsi,%rdx
+    1ad1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1ad5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1ad9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1add:	90                   	nop
+    1ade:	5d                   	pop    %rbp
+    1adf:	c3                   	ret
+
+0000000000001ae0 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    1ae0:	55                   	push   %rbp
+    1ae1:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    1ae4:	0f 31                	rdtsc
+    1ae6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1ae9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    1aec:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1aef:	48 c1 e0 20          	shl    $0x20,%rax
+    1af3:	48 89 c2             	mov    %rax,%rdx
+    1af6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1af9:	48 09 d0             	or     %rdx,%rax
+}
+    1afc:	5d                   	pop    %rbp
+    1afd:	c3                   	ret
+
+0000000000001afe <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    1afe:	55                   	push   %rbp
+    1aff:	48 89 e5             	mov    %rsp,%rbp
+    1b02:	53                   	push   %rbx
+    1b03:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    1b06:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    1b0a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    1b0e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    1b12:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    1b16:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1b19:	0f a2                	cpuid
+    1b1b:	89 de                	mov    %ebx,%esi
+    1b1d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1b20:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    1b23:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    1b26:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    1b29:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1b2e:	74 09                	je     1b39 <cpuid+0x3b>
+    *eaxp = eax;
+    1b30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b34:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1b37:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    1b39:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1b3e:	74 09                	je     1b49 <cpuid+0x4b>
+    *ebxp = ebx;
+    1b40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b44:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1b47:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    1b49:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1b4e:	74 09                	je     1b59 <cpuid+0x5b>
+    *ecxp = ecx;
+    1b50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b54:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b57:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    1b59:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    1b5e:	74 09                	je     1b69 <cpuid+0x6b>
+    *edxp = edx;
+    1b60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1b64:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    1b67:	89 10                	mov    %edx,(%rax)
+}
+    1b69:	90                   	nop
+    1b6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1b6e:	c9                   	leave
+    1b6f:	c3                   	ret
+
+0000000000001b70 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1b70:	55                   	push   %rbp
+    1b71:	48 89 e5             	mov    %rsp,%rbp
+    1b74:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b78:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1b84:	90                   	nop
+    1b85:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1b89:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1b8d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1b91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b95:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1b99:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1b9d:	0f b6 12             	movzbl (%rdx),%edx
+    1ba0:	88 10                	mov    %dl,(%rax)
+    1ba2:	0f b6 00             	movzbl (%rax),%eax
+    1ba5:	84 c0                	test   %al,%al
+    1ba7:	75 dc                	jne    1b85 <strcpy+0x15>
+  return os;
+    1ba9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1bad:	5d                   	pop    %rbp
+    1bae:	c3                   	ret
+
+0000000000001baf <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1baf:	55                   	push   %rbp
+    1bb0:	48 89 e5             	mov    %rsp,%rbp
+    1bb3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1bb7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1bbb:	eb 0a                	jmp    1bc7 <strcmp+0x18>
+    p++, q++;
+    1bbd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1bc2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1bc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bcb:	0f b6 00             	movzbl (%rax),%eax
+    1bce:	84 c0                	test   %al,%al
+    1bd0:	74 12                	je     1be4 <strcmp+0x35>
+    1bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd6:	0f b6 10             	movzbl (%rax),%edx
+    1bd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bdd:	0f b6 00             	movzbl (%rax),%eax
+    1be0:	38 c2                	cmp    %al,%dl
+    1be2:	74 d9                	je     1bbd <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1be4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1be8:	0f b6 00             	movzbl (%rax),%eax
+    1beb:	0f b6 d0             	movzbl %al,%edx
+    1bee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf2:	0f b6 00             	movzbl (%rax),%eax
+    1bf5:	0f b6 c0             	movzbl %al,%eax
+    1bf8:	29 c2                	sub    %eax,%edx
+    1bfa:	89 d0                	mov    %edx,%eax
+}
+    1bfc:	5d                   	pop    %rbp
+    1bfd:	c3                   	ret
+
+0000000000001bfe <strlen>:
+uint strlen(char *s) {
+    1bfe:	55                   	push   %rbp
+    1bff:	48 89 e5             	mov    %rsp,%rbp
+    1c02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1c06:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1c0d:	eb 04                	jmp    1c13 <strlen+0x15>
+    1c0f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1c13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c16:	48 63 d0             	movslq %eax,%rdx
+    1c19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c1d:	48 01 d0             	add    %rdx,%rax
+    1c20:	0f b6 00             	movzbl (%rax),%eax
+    1c23:	84 c0                	test   %al,%al
+    1c25:	75 e8                	jne    1c0f <strlen+0x11>
+    ;
+  return n;
+    1c27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1c2a:	5d                   	pop    %rbp
+    1c2b:	c3                   	ret
+
+0000000000001c2c <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    1c2c:	55                   	push   %rbp
+    1c2d:	48 89 e5             	mov    %rsp,%rbp
+    1c30:	53                   	push   %rbx
+    1c31:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    1c35:	8b 05 09 24 00 00    	mov    0x2409(%rip),%eax        # 4044 <erms>
+    1c3b:	85 c0                	test   %eax,%eax
+    1c3d:	79 53                	jns    1c92 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    1c3f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1c43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    1c49:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1c4e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1c53:	48 89 c6             	mov    %rax,%rsi
+    1c56:	bf 00 00 00 00       	mov    $0x0,%edi
+    1c5b:	e8 9e fe ff ff       	call   1afe <cpuid>
+    ebx = 0;
+    1c60:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    1c67:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1c6a:	83 f8 06             	cmp    $0x6,%eax
+    1c6d:	76 14                	jbe    1c83 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    1c6f:	b8 07 00 00 00       	mov    $0x7,%eax
+    1c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1c79:	0f a2                	cpuid
+    1c7b:	89 d9                	mov    %ebx,%ecx
+    1c7d:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    1c80:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    1c83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1c86:	c1 e8 09             	shr    $0x9,%eax
+    1c89:	83 e0 01             	and    $0x1,%eax
+    1c8c:	89 05 b2 23 00 00    	mov    %eax,0x23b2(%rip)        # 4044 <erms>
+  }
+  return erms;
+    1c92:	8b 05 ac 23 00 00    	mov    0x23ac(%rip),%eax        # 4044 <erms>
+}
+    1c98:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c9c:	c9                   	leave
+    1c9d:	c3                   	ret
+
+0000000000001c9e <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    1c9e:	55                   	push   %rbp
+    1c9f:	48 89 e5             	mov    %rsp,%rbp
+    1ca2:	48 83 ec 10          	sub    $0x10,%rsp
+    1ca6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1caa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1cad:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    1cb0:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    1cb4:	76 09                	jbe    1cbf <memset+0x21>
+    1cb6:	e8 71 ff ff ff       	call   1c2c <haserms>
+    1cbb:	85 c0                	test   %eax,%eax
+    1cbd:	74 16                	je     1cd5 <memset+0x37>
+    stosb(dst, c, n);
+    1cbf:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1cc2:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1cc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc9:	89 ce                	mov    %ecx,%esi
+    1ccb:	48 89 c7             	mov    %rax,%rdi
+    1cce:	e8 26 fd ff ff       	call   19f9 <stosb>
+    1cd3:	eb 58                	jmp    1d2d <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    1cd5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1cd8:	c1 e8 03             	shr    $0x3,%eax
+    1cdb:	89 c6                	mov    %eax,%esi
+    1cdd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1ce0:	48 98                	cltq
+    1ce2:	0f b6 c0             	movzbl %al,%eax
+    1ce5:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    1cec:	01 01 01 
+    1cef:	48 0f af c2          	imul   %rdx,%rax
+    1cf3:	48 89 c1             	mov    %rax,%rcx
+    1cf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cfa:	48 89 f2             	mov    %rsi,%rdx
+    1cfd:	48 89 ce             	mov    %rcx,%rsi
+    1d00:	48 89 c7             	mov    %rax,%rdi
+    1d03:	e8 23 fd ff ff       	call   1a2b <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    1d08:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1d0b:	83 e0 07             	and    $0x7,%eax
+    1d0e:	89 c2                	mov    %eax,%edx
+    1d10:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1d13:	83 e0 f8             	and    $0xfffffff8,%eax
+    1d16:	48 89 c1             	mov    %rax,%rcx
+    1d19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d1d:	48 01 c1             	add    %rax,%rcx
+    1d20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1d23:	89 c6                	mov    %eax,%esi
+    1d25:	48 89 cf             	mov    %rcx,%rdi
+    1d28:	e8 cc fc ff ff       	call   19f9 <stosb>
+  }
+  return dst;
+    1d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d31:	c9                   	leave
+    1d32:	c3                   	ret
+
+0000000000001d33 <strchr>:
+
+char *strchr(const char *s, char c) {
+    1d33:	55                   	push   %rbp
+    1d34:	48 89 e5             	mov    %rsp,%rbp
+    1d37:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d3b:	89 f0                	mov    %esi,%eax
+    1d3d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1d40:	eb 17                	jmp    1d59 <strchr+0x26>
+    if (*s == c)
+    1d42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d46:	0f b6 00             	movzbl (%rax),%eax
+    1d49:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1d4c:	75 06                	jne    1d54 <strchr+0x21>
+      return (char *)s;
+    1d4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d52:	eb 15                	jmp    1d69 <strchr+0x36>
+  for (; *s; s++)
+    1d54:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1d59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5d:	0f b6 00             	movzbl (%rax),%eax
+    1d60:	84 c0                	test   %al,%al
+    1d62:	75 de                	jne    1d42 <strchr+0xf>
+  return 0;
+    1d64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1d69:	5d                   	pop    %rbp
+    1d6a:	c3                   	ret
+
+0000000000001d6b <gets>:
+
+char *gets(char *buf, int max) {
+    1d6b:	55                   	push   %rbp
+    1d6c:	48 89 e5             	mov    %rsp,%rbp
+    1d6f:	48 83 ec 20          	sub    $0x20,%rsp
+    1d73:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d77:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    1d7a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d81:	eb 48                	jmp    1dcb <gets+0x60>
+    cc = read(0, &c, 1);
+    1d83:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1d87:	ba 01 00 00 00       	mov    $0x1,%edx
+    1d8c:	48 89 c6             	mov    %rax,%rsi
+    1d8f:	bf 00 00 00 00       	mov    $0x0,%edi
+    1d94:	e8 b8 05 00 00       	call   2351 <read>
+    1d99:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1d9c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1da0:	7e 36                	jle    1dd8 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1da2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1da5:	8d 50 01             	lea    0x1(%rax),%edx
+    1da8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1dab:	48 63 d0             	movslq %eax,%rdx
+    1dae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1db2:	48 01 c2             	add    %rax,%rdx
+    1db5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1db9:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1dbb:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1dbf:	3c 0a                	cmp    $0xa,%al
+    1dc1:	74 16                	je     1dd9 <gets+0x6e>
+    1dc3:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1dc7:	3c 0d                	cmp    $0xd,%al
+    1dc9:	74 0e                	je     1dd9 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1dcb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dce:	83 c0 01             	add    $0x1,%eax
+    1dd1:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1dd4:	7f ad                	jg     1d83 <gets+0x18>
+    1dd6:	eb 01                	jmp    1dd9 <gets+0x6e>
+      break;
+    1dd8:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1dd9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ddc:	48 63 d0             	movslq %eax,%rdx
+    1ddf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1de3:	48 01 d0             	add    %rdx,%rax
+    1de6:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1de9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1ded:	c9                   	leave
+    1dee:	c3                   	ret
+
+0000000000001def <stat>:
+
+int stat(char *n, struct stat *st) {
+    1def:	55                   	push   %rbp
+    1df0:	48 89 e5             	mov    %rsp,%rbp
+    1df3:	48 83 ec 10          	sub    $0x10,%rsp
+    1df7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1dfb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    1dff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e07:	48 89 c6             	mov    %rax,%rsi
+    1e0a:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1e0f:	e8 58 07 00 00       	call   256c <fstatat>
+}
+    1e14:	c9                   	leave
+    1e15:	c3                   	ret
+
+0000000000001e16 <atoi>:
+
+int atoi(const char *s) {
+    1e16:	55                   	push   %rbp
+    1e17:	48 89 e5             	mov    %rsp,%rbp
+    1e1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1e1e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1e25:	eb 28                	jmp    1e4f <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    1e27:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1e2a:	89 d0                	mov    %edx,%eax
+    1e2c:	c1 e0 02             	shl    $0x2,%eax
+    1e2f:	01 d0                	add    %edx,%eax
+    1e31:	01 c0                	add    %eax,%eax
+    1e33:	89 c1                	mov    %eax,%ecx
+    1e35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e39:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1e3d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1e41:	0f b6 00             	movzbl (%rax),%eax
+    1e44:	0f be c0             	movsbl %al,%eax
+    1e47:	01 c8                	add    %ecx,%eax
+    1e49:	83 e8 30             	sub    $0x30,%eax
+    1e4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1e4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e53:	0f b6 00             	movzbl (%rax),%eax
+    1e56:	3c 2f                	cmp    $0x2f,%al
+    1e58:	7e 0b                	jle    1e65 <atoi+0x4f>
+    1e5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e5e:	0f b6 00             	movzbl (%rax),%eax
+    1e61:	3c 39                	cmp    $0x39,%al
+    1e63:	7e c2                	jle    1e27 <atoi+0x11>
+  return n;
+    1e65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1e68:	5d                   	pop    %rbp
+    1e69:	c3                   	ret
+
+0000000000001e6a <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1e6a:	55                   	push   %rbp
+    1e6b:	48 89 e5             	mov    %rsp,%rbp
+    1e6e:	48 83 ec 28          	sub    $0x28,%rsp
+    1e72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e76:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e7a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1e7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e81:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1e85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e89:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1e8d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1e91:	7f 09                	jg     1e9c <memmove+0x32>
+    return vdst;
+    1e93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e97:	e9 29 01 00 00       	jmp    1fc5 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1e9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ea0:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1ea4:	0f 83 87 00 00 00    	jae    1f31 <memmove+0xc7>
+    1eaa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ead:	48 63 d0             	movslq %eax,%rdx
+    1eb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eb4:	48 01 d0             	add    %rdx,%rax
+    1eb7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1ebb:	73 74                	jae    1f31 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1ebd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ec0:	48 98                	cltq
+    1ec2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1ec6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ec9:	48 98                	cltq
+    1ecb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1ecf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ed3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ed7:	48 09 d0             	or     %rdx,%rax
+    1eda:	83 e0 07             	and    $0x7,%eax
+    1edd:	48 85 c0             	test   %rax,%rax
+    1ee0:	75 3d                	jne    1f1f <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1ee2:	eb 1c                	jmp    1f00 <memmove+0x96>
+        src -= 8;
+    1ee4:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1ee9:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1eee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ef2:	48 8b 10             	mov    (%rax),%rdx
+    1ef5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef9:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1efc:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1f00:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1f04:	7f de                	jg     1ee4 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1f06:	eb 17                	jmp    1f1f <memmove+0xb5>
+      *--dst = *--src;
+    1f08:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1f0d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1f12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f16:	0f b6 10             	movzbl (%rax),%edx
+    1f19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f1d:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1f1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f22:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1f25:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1f28:	85 c0                	test   %eax,%eax
+    1f2a:	7f dc                	jg     1f08 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1f2c:	e9 90 00 00 00       	jmp    1fc1 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1f31:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1f35:	7e 09                	jle    1f40 <memmove+0xd6>
+    1f37:	e8 f0 fc ff ff       	call   1c2c <haserms>
+    1f3c:	85 c0                	test   %eax,%eax
+    1f3e:	74 1b                	je     1f5b <memmove+0xf1>
+    movsb(dst, src, n);
+    1f40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f43:	48 63 d0             	movslq %eax,%rdx
+    1f46:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1f4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f4e:	48 89 ce             	mov    %rcx,%rsi
+    1f51:	48 89 c7             	mov    %rax,%rdi
+    1f54:	e8 0c fb ff ff       	call   1a65 <movsb>
+    1f59:	eb 66                	jmp    1fc1 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1f5b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f5e:	8d 50 07             	lea    0x7(%rax),%edx
+    1f61:	85 c0                	test   %eax,%eax
+    1f63:	0f 48 c2             	cmovs  %edx,%eax
+    1f66:	c1 f8 03             	sar    $0x3,%eax
+    1f69:	48 63 d0             	movslq %eax,%rdx
+    1f6c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f74:	48 89 ce             	mov    %rcx,%rsi
+    1f77:	48 89 c7             	mov    %rax,%rdi
+    1f7a:	e8 23 fb ff ff       	call   1aa2 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1f7f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f82:	89 d0                	mov    %edx,%eax
+    1f84:	c1 f8 1f             	sar    $0x1f,%eax
+    1f87:	c1 e8 1d             	shr    $0x1d,%eax
+    1f8a:	01 c2                	add    %eax,%edx
+    1f8c:	83 e2 07             	and    $0x7,%edx
+    1f8f:	29 c2                	sub    %eax,%edx
+    1f91:	89 d0                	mov    %edx,%eax
+    1f93:	48 98                	cltq
+    1f95:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f98:	83 e2 f8             	and    $0xfffffff8,%edx
+    1f9b:	48 63 ca             	movslq %edx,%rcx
+    1f9e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1fa2:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1fa6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1fa9:	83 e2 f8             	and    $0xfffffff8,%edx
+    1fac:	48 63 ca             	movslq %edx,%rcx
+    1faf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1fb3:	48 01 d1             	add    %rdx,%rcx
+    1fb6:	48 89 c2             	mov    %rax,%rdx
+    1fb9:	48 89 cf             	mov    %rcx,%rdi
+    1fbc:	e8 a4 fa ff ff       	call   1a65 <movsb>
+  }
+  return vdst;
+    1fc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1fc5:	c9                   	leave
+    1fc6:	c3                   	ret
+
+0000000000001fc7 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1fc7:	55                   	push   %rbp
+    1fc8:	48 89 e5             	mov    %rsp,%rbp
+    1fcb:	48 83 ec 20          	sub    $0x20,%rsp
+    1fcf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1fd2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1fd6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1fdd:	00 00 00 
+    1fe0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1fe4:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1fe8:	75 0d                	jne    1ff7 <clock_gettime+0x30>
+    1fea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fee:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1ff2:	48 85 c0             	test   %rax,%rax
+    1ff5:	75 13                	jne    200a <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1ff7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1ffb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ffe:	48 89 d6             	mov    %rdx,%rsi
+    2001:	89 c7                	mov    %eax,%edi
+    2003:	e8 e0 04 00 00       	call   24e8 <_clock_gettime>
+    2008:	eb 7d                	jmp    2087 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    200a:	e8 d1 fa ff ff       	call   1ae0 <rdtsc>
+    200f:	48 89 c2             	mov    %rax,%rdx
+    2012:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2016:	48 89 d6             	mov    %rdx,%rsi
+    2019:	48 89 c7             	mov    %rax,%rdi
+    201c:	e8 7b f9 ff ff       	call   199c <clockns>
+    2021:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    2025:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2029:	48 c1 e8 09          	shr    $0x9,%rax
+    202d:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    2034:	b8 44 00 
+    2037:	48 f7 e2             	mul    %rdx
+    203a:	48 89 d0             	mov    %rdx,%rax
+    203d:	48 c1 e8 0b          	shr    $0xb,%rax
+    2041:	48 89 c2             	mov    %rax,%rdx
+    2044:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2048:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    204b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    204f:	48 89 c8             	mov    %rcx,%rax
+    2052:	48 c1 e8 09          	shr    $0x9,%rax
+    2056:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    205d:	b8 44 00 
+    2060:	48 f7 e2             	mul    %rdx
+    2063:	48 89 d0             	mov    %rdx,%rax
+    2066:	48 c1 e8 0b          	shr    $0xb,%rax
+    206a:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    2071:	48 89 c8             	mov    %rcx,%rax
+    2074:	48 29 d0             	sub    %rdx,%rax
+    2077:	48 89 c2             	mov    %rax,%rdx
+    207a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    207e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    2082:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2087:	c9                   	leave
+    2088:	c3                   	ret
+
+0000000000002089 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    2089:	55                   	push   %rbp
+    208a:	48 89 e5             	mov    %rsp,%rbp
+    208d:	48 83 ec 10          	sub    $0x10,%rsp
+    2091:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    2095:	eb 11                	jmp    20a8 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    2097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    209b:	be 02 00 00 00       	mov    $0x2,%esi
+    20a0:	48 89 c7             	mov    %rax,%rdi
+    20a3:	e8 6c 04 00 00       	call   2514 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    20a8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    20ac:	b8 02 00 00 00       	mov    $0x2,%eax
+    20b1:	87 02                	xchg   %eax,(%rdx)
+    20b3:	85 c0                	test   %eax,%eax
+    20b5:	75 e0                	jne    2097 <mutex_wait+0xe>
+}
+    20b7:	90                   	nop
+    20b8:	90                   	nop
+    20b9:	c9                   	leave
+    20ba:	c3                   	ret
+
+00000000000020bb <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    20bb:	55                   	push   %rbp
+    20bc:	48 89 e5             	mov    %rsp,%rbp
+    20bf:	48 83 ec 20          	sub    $0x20,%rsp
+    20c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    20c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    20ce:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    20d2:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    20d6:	8b 02                	mov    (%rdx),%eax
+    20d8:	b9 01 00 00 00       	mov    $0x1,%ecx
+    20dd:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    20e1:	89 c1                	mov    %eax,%ecx
+    20e3:	0f 94 c0             	sete   %al
+    20e6:	84 c0                	test   %al,%al
+    20e8:	75 02                	jne    20ec <mutex_lock+0x31>
+    20ea:	89 0a                	mov    %ecx,(%rdx)
+    20ec:	83 f0 01             	xor    $0x1,%eax
+    20ef:	84 c0                	test   %al,%al
+    20f1:	74 0c                	je     20ff <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    20f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20f7:	48 89 c7             	mov    %rax,%rdi
+    20fa:	e8 8a ff ff ff       	call   2089 <mutex_wait>
+}
+    20ff:	90                   	nop
+    2100:	c9                   	leave
+    2101:	c3                   	ret
+
+0000000000002102 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    2102:	55                   	push   %rbp
+    2103:	48 89 e5             	mov    %rsp,%rbp
+    2106:	48 83 ec 10          	sub    $0x10,%rsp
+    210a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    210e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2112:	ba 00 00 00 00       	mov    $0x0,%edx
+    2117:	87 10                	xchg   %edx,(%rax)
+    2119:	83 fa 02             	cmp    $0x2,%edx
+    211c:	75 11                	jne    212f <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    211e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2122:	be 01 00 00 00       	mov    $0x1,%esi
+    2127:	48 89 c7             	mov    %rax,%rdi
+    212a:	e8 f0 03 00 00       	call   251f <futex_wake>
+}
+    212f:	90                   	nop
+    2130:	c9                   	leave
+    2131:	c3                   	ret
+
+0000000000002132 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    2132:	55                   	push   %rbp
+    2133:	48 89 e5             	mov    %rsp,%rbp
+    2136:	48 83 ec 20          	sub    $0x20,%rsp
+    213a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    213e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    2142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2146:	48 83 c0 04          	add    $0x4,%rax
+    214a:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    214e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2152:	8b 00                	mov    (%rax),%eax
+    2154:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    2157:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    215b:	48 89 c7             	mov    %rax,%rdi
+    215e:	e8 9f ff ff ff       	call   2102 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    2163:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2167:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    216a:	89 d6                	mov    %edx,%esi
+    216c:	48 89 c7             	mov    %rax,%rdi
+    216f:	e8 a0 03 00 00       	call   2514 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    2174:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2178:	48 83 c0 04          	add    $0x4,%rax
+    217c:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    2180:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2184:	48 89 c7             	mov    %rax,%rdi
+    2187:	e8 fd fe ff ff       	call   2089 <mutex_wait>
+}
+    218c:	90                   	nop
+    218d:	c9                   	leave
+    218e:	c3                   	ret
+
+000000000000218f <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    218f:	55                   	push   %rbp
+    2190:	48 89 e5             	mov    %rsp,%rbp
+    2193:	48 83 ec 10          	sub    $0x10,%rsp
+    2197:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    219b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    219f:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    21a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21a7:	48 83 c0 04          	add    $0x4,%rax
+    21ab:	8b 00                	mov    (%rax),%eax
+    21ad:	85 c0                	test   %eax,%eax
+    21af:	7e 11                	jle    21c2 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    21b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21b5:	be 01 00 00 00       	mov    $0x1,%esi
+    21ba:	48 89 c7             	mov    %rax,%rdi
+    21bd:	e8 5d 03 00 00       	call   251f <futex_wake>
+}
+    21c2:	90                   	nop
+    21c3:	c9                   	leave
+    21c4:	c3                   	ret
+
+00000000000021c5 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    21c5:	55                   	push   %rbp
+    21c6:	48 89 e5             	mov    %rsp,%rbp
+    21c9:	48 83 ec 10          	sub    $0x10,%rsp
+    21cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    21d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21d5:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    21d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21dd:	48 83 c0 04          	add    $0x4,%rax
+    21e1:	8b 00                	mov    (%rax),%eax
+    21e3:	85 c0                	test   %eax,%eax
+    21e5:	7e 11                	jle    21f8 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    21e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21eb:	be 00 00 00 40       	mov    $0x40000000,%esi
+    21f0:	48 89 c7             	mov    %rax,%rdi
+    21f3:	e8 27 03 00 00       	call   251f <futex_wake>
+}
+    21f8:	90                   	nop
+    21f9:	c9                   	leave
+    21fa:	c3                   	ret
+
+00000000000021fb <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    21fb:	55                   	push   %rbp
+    21fc:	48 89 e5             	mov    %rsp,%rbp
+    21ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2203:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    2206:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    220a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    220e:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    2212:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    2216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    221a:	8b 40 04             	mov    0x4(%rax),%eax
+    221d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    2220:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2224:	8b 00                	mov    (%rax),%eax
+    2226:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2229:	29 c2                	sub    %eax,%edx
+    222b:	83 fa 1f             	cmp    $0x1f,%edx
+    222e:	76 07                	jbe    2237 <ring_push+0x3c>
+    return -1;
+    2230:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2235:	eb 7e                	jmp    22b5 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    2237:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    223a:	83 e0 1f             	and    $0x1f,%eax
+    223d:	89 c2                	mov    %eax,%edx
+    223f:	48 89 d0             	mov    %rdx,%rax
+    2242:	48 01 c0             	add    %rax,%rax
+    2245:	48 01 d0             	add    %rdx,%rax
+    2248:	48 c1 e0 04          	shl    $0x4,%rax
+    224c:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    2250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2254:	48 01 d0             	add    %rdx,%rax
+    2257:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    225b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    225f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    2262:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    2264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2268:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    226c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    2270:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2274:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2278:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    227c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2280:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2284:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    2288:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    228c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2290:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    2294:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2298:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    229c:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    22a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22a3:	8d 50 01             	lea    0x1(%rax),%edx
+    22a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22aa:	48 83 c0 04          	add    $0x4,%rax
+    22ae:	89 10                	mov    %edx,(%rax)
+  return 0;
+    22b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    22b5:	5d                   	pop    %rbp
+    22b6:	c3                   	ret
+
+00000000000022b7 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    22b7:	55                   	push   %rbp
+    22b8:	48 89 e5             	mov    %rsp,%rbp
+    22bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    22bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    22c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22c7:	8b 40 08             	mov    0x8(%rax),%eax
+    22ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    22cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22d1:	48 83 c0 0c          	add    $0xc,%rax
+    22d5:	8b 00                	mov    (%rax),%eax
+    22d7:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    22da:	75 07                	jne    22e3 <ring_pop+0x2c>
+    return -1;
+    22dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    22e1:	eb 40                	jmp    2323 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    22e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22e6:	83 e0 1f             	and    $0x1f,%eax
+    22e9:	89 c2                	mov    %eax,%edx
+    22eb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    22ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22f3:	89 d2                	mov    %edx,%edx
+    22f5:	48 83 c2 61          	add    $0x61,%rdx
+    22f9:	48 c1 e2 04          	shl    $0x4,%rdx
+    22fd:	48 01 d0             	add    %rdx,%rax
+    2300:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2304:	48 8b 00             	mov    (%rax),%rax
+    2307:	48 89 01             	mov    %rax,(%rcx)
+    230a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    230e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2311:	8d 50 01             	lea    0x1(%rax),%edx
+    2314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2318:	48 83 c0 08          	add    $0x8,%rax
+    231c:	89 10                	mov    %edx,(%rax)
+  return 0;
+    231e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2323:	5d                   	pop    %rbp
+    2324:	c3                   	ret
+
+0000000000002325 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    2325:	b8 01 00 00 00       	mov    $0x1,%eax
+    232a:	49 89 ca             	mov    %rcx,%r10
+    232d:	0f 05                	syscall
+    232f:	c3                   	ret
+
+0000000000002330 <_exit>:
+SYSCALL_(exit)
+    2330:	b8 02 00 00 00       	mov    $0x2,%eax
+    2335:	49 89 ca             	mov    %rcx,%r10
+    2338:	0f 05                	syscall
+    233a:	c3                   	ret
+
+000000000000233b <wait>:
+SYSCALL(wait)
+    233b:	b8 03 00 00 00       	mov    $0x3,%eax
+    2340:	49 89 ca             	mov    %rcx,%r10
+    2343:	0f 05                	syscall
+    2345:	c3                   	ret
+
+0000000000002346 <pipe>:
+SYSCALL(pipe)
+    2346:	b8 04 00 00 00       	mov    $0x4,%eax
+    234b:	49 89 ca             	mov    %rcx,%r10
+    234e:	0f 05                	syscall
+    2350:	c3                   	ret
+
+0000000000002351 <read>:
+SYSCALL(read)
+    2351:	b8 05 00 00 00       	mov    $0x5,%eax
+    2356:	49 89 ca             	mov    %rcx,%r10
+    2359:	0f 05                	syscall
+    235b:	c3                   	ret
+
+000000000000235c <write>:
+SYSCALL(write)
+    235c:	b8 10 00 00 00       	mov    $0x10,%eax
+    2361:	49 89 ca             	mov    %rcx,%r10
+    2364:	0f 05                	syscall
+    2366:	c3                   	ret
+
+0000000000002367 <_close>:
+SYSCALL_(close)
+    2367:	b8 15 00 00 00       	mov    $0x15,%eax
+    236c:	49 89 ca             	mov    %rcx,%r10
+    236f:	0f 05                	syscall
+    2371:	c3                   	ret
+
+0000000000002372 <kill>:
+SYSCALL(kill)
+    2372:	b8 06 00 00 00       	mov    $0x6,%eax
+    2377:	49 89 ca             	mov    %rcx,%r10
+    237a:	0f 05                	syscall
+    237c:	c3                   	ret
+
+000000000000237d <_exec>:
+SYSCALL_(exec)
+    237d:	b8 07 00 00 00       	mov    $0x7,%eax
+    2382:	49 89 ca             	mov    %rcx,%r10
+    2385:	0f 05                	syscall
+    2387:	c3                   	ret
+
+0000000000002388 <open>:
+SYSCALL(open)
+    2388:	b8 0f 00 00 00       	mov    $0xf,%eax
+    238d:	49 89 ca             	mov    %rcx,%r10
+    2390:	0f 05                	syscall
+    2392:	c3                   	ret
+
+0000000000002393 <mknod>:
+SYSCALL(mknod)
+    2393:	b8 11 00 00 00       	mov    $0x11,%eax
+    2398:	49 89 ca             	mov    %rcx,%r10
+    239b:	0f 05                	syscall
+    239d:	c3                   	ret
+
+000000000000239e <unlink>:
+SYSCALL(unlink)
+    239e:	b8 12 00 00 00       	mov    $0x12,%eax
+    23a3:	49 89 ca             	mov    %rcx,%r10
+    23a6:	0f 05                	syscall
+    23a8:	c3                   	ret
+
+00000000000023a9 <fstat>:
+SYSCALL(fstat)
+    23a9:	b8 08 00 00 00       	mov    $0x8,%eax
+    23ae:	49 89 ca             	mov    %rcx,%r10
+    23b1:	0f 05                	syscall
+    23b3:	c3                   	ret
+
+00000000000023b4 <link>:
+SYSCALL(link)
+    23b4:	b8 13 00 00 00       	mov    $0x13,%eax
+    23b9:	49 89 ca             	mov    %rcx,%r10
+    23bc:	0f 05                	syscall
+    23be:	c3                   	ret
+
+00000000000023bf <mkdir>:
+SYSCALL(mkdir)
+    23bf:	b8 14 00 00 00       	mov    $0x14,%eax
+    23c4:	49 89 ca             	mov    %rcx,%r10
+    23c7:	0f 05                	syscall
+    23c9:	c3                   	ret
+
+00000000000023ca <chdir>:
+SYSCALL(chdir)
+    23ca:	b8 09 00 00 00       	mov    $0x9,%eax
+    23cf:	49 89 ca             	mov    %rcx,%r10
+    23d2:	0f 05                	syscall
+    23d4:	c3                   	ret
+
+00000000000023d5 <dup>:
+SYSCALL(dup)
+    23d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+    23da:	49 89 ca             	mov    %rcx,%r10
+    23dd:	0f 05                	syscall
+    23df:	c3                   	ret
+
+00000000000023e0 <getpid>:
+SYSCALL(getpid)
+    23e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+    23e5:	49 89 ca             	mov    %rcx,%r10
+    23e8:	0f 05                	syscall
+    23ea:	c3                   	ret
+
+00000000000023eb <sbrk>:
+SYSCALL(sbrk)
+    23eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    23f0:	49 89 ca             	mov    %rcx,%r10
+    23f3:	0f 05                	syscall
+    23f5:	c3                   	ret
+
+00000000000023f6 <sleep>:
+SYSCALL(sleep)
+    23f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+    23fb:	49 89 ca             	mov    %rcx,%r10
+    23fe:	0f 05                	syscall
+    2400:	c3                   	ret
+
+0000000000002401 <uptime>:
+SYSCALL(uptime)
+    2401:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2406:	49 89 ca             	mov    %rcx,%r10
+    2409:	0f 05                	syscall
+    240b:	c3                   	ret
+
+000000000000240c <sysinfo>:
+SYSCALL(sysinfo)
+    240c:	b8 16 00 00 00       	mov    $0x16,%eax
+    2411:	49 89 ca             	mov    %rcx,%r10
+    2414:	0f 05                	syscall
+    2416:	c3                   	ret
+
+0000000000002417 <crashn>:
+SYSCALL(crashn)
+    2417:	b8 17 00 00 00       	mov    $0x17,%eax
+    241c:	49 89 ca             	mov    %rcx,%r10
+    241f:	0f 05                	syscall
+    2421:	c3                   	ret
+
+0000000000002422 <mmap>:
+SYSCALL(mmap)
+    2422:	b8 18 00 00 00       	mov    $0x18,%eax
+    2427:	49 89 ca             	mov    %rcx,%r10
+    242a:	0f 05                	syscall
+    242c:	c3                   	ret
+
+000000000000242d <munmap>:
+SYSCALL(munmap)
+    242d:	b8 19 00 00 00       	mov    $0x19,%eax
+    2432:	49 89 ca             	mov    %rcx,%r10
+    2435:	0f 05                	syscall
+    2437:	c3                   	ret
+
+0000000000002438 <nice>:
+SYSCALL(nice)
+    2438:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    243d:	49 89 ca             	mov    %rcx,%r10
+    2440:	0f 05                	syscall
+    2442:	c3                   	ret
+
+0000000000002443 <_spawn>:
+SYSCALL_(spawn)
+    2443:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    2448:	49 89 ca             	mov    %rcx,%r10
+    244b:	0f 05                	syscall
+    244d:	c3                   	ret
+
+000000000000244e <pread>:
+SYSCALL(pread)
+    244e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2453:	49 89 ca             	mov    %rcx,%r10
+    2456:	0f 05                	syscall
+    2458:	c3                   	ret
+
+0000000000002459 <pwrite>:
+SYSCALL(pwrite)
+    2459:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    245e:	49 89 ca             	mov    %rcx,%r10
+    2461:	0f 05                	syscall
+    2463:	c3                   	ret
+
+0000000000002464 <readv>:
+SYSCALL(readv)
+    2464:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    2469:	49 89 ca             	mov    %rcx,%r10
+    246c:	0f 05                	syscall
+    246e:	c3                   	ret
+
+000000000000246f <writev>:
+SYSCALL(writev)
+    246f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2474:	49 89 ca             	mov    %rcx,%r10
+    2477:	0f 05                	syscall
+    2479:	c3                   	ret
+
+000000000000247a <sendfile>:
+SYSCALL(sendfile)
+    247a:	b8 20 00 00 00       	mov    $0x20,%eax
+    247f:	49 89 ca             	mov    %rcx,%r10
+    2482:	0f 05                	syscall
+    2484:	c3                   	ret
+
+0000000000002485 <splice>:
+SYSCALL(splice)
+    2485:	b8 21 00 00 00       	mov    $0x21,%eax
+    248a:	49 89 ca             	mov    %rcx,%r10
+    248d:	0f 05                	syscall
+    248f:	c3                   	ret
+
+0000000000002490 <poll>:
+SYSCALL(poll)
+    2490:	b8 22 00 00 00       	mov    $0x22,%eax
+    2495:	49 89 ca             	mov    %rcx,%r10
+    2498:	0f 05                	syscall
+    249a:	c3                   	ret
+
+000000000000249b <fsync>:
+SYSCALL(fsync)
+    249b:	b8 23 00 00 00       	mov    $0x23,%eax
+    24a0:	49 89 ca             	mov    %rcx,%r10
+    24a3:	0f 05                	syscall
+    24a5:	c3                   	ret
+
+00000000000024a6 <fdatasync>:
+SYSCALL(fdatasync)
+    24a6:	b8 24 00 00 00       	mov    $0x24,%eax
+    24ab:	49 89 ca             	mov    %rcx,%r10
+    24ae:	0f 05                	syscall
+    24b0:	c3                   	ret
+
+00000000000024b1 <lockstat>:
+SYSCALL(lockstat)
+    24b1:	b8 25 00 00 00       	mov    $0x25,%eax
+    24b6:	49 89 ca             	mov    %rcx,%r10
+    24b9:	0f 05                	syscall
+    24bb:	c3                   	ret
+
+00000000000024bc <syscallstat>:
+SYSCALL(syscallstat)
+    24bc:	b8 26 00 00 00       	mov    $0x26,%eax
+    24c1:	49 89 ca             	mov    %rcx,%r10
+    24c4:	0f 05                	syscall
+    24c6:	c3                   	ret
+
+00000000000024c7 <trace>:
+SYSCALL(trace)
+    24c7:	b8 27 00 00 00       	mov    $0x27,%eax
+    24cc:	49 89 ca             	mov    %rcx,%r10
+    24cf:	0f 05                	syscall
+    24d1:	c3                   	ret
+
+00000000000024d2 <profile>:
+SYSCALL(profile)
+    24d2:	b8 28 00 00 00       	mov    $0x28,%eax
+    24d7:	49 89 ca             	mov    %rcx,%r10
+    24da:	0f 05                	syscall
+    24dc:	c3                   	ret
+
+00000000000024dd <cycles>:
+SYSCALL(cycles)
+    24dd:	b8 29 00 00 00       	mov    $0x29,%eax
+    24e2:	49 89 ca             	mov    %rcx,%r10
+    24e5:	0f 05                	syscall
+    24e7:	c3                   	ret
+
+00000000000024e8 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    24e8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    24ed:	49 89 ca             	mov    %rcx,%r10
+    24f0:	0f 05                	syscall
+    24f2:	c3                   	ret
+
+00000000000024f3 <consmode>:
+SYSCALL(consmode)
+    24f3:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    24f8:	49 89 ca             	mov    %rcx,%r10
+    24fb:	0f 05                	syscall
+    24fd:	c3                   	ret
+
+00000000000024fe <clone>:
+SYSCALL(clone)
+    24fe:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    2503:	49 89 ca             	mov    %rcx,%r10
+    2506:	0f 05                	syscall
+    2508:	c3                   	ret
+
+0000000000002509 <join>:
+SYSCALL(join)
+    2509:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    250e:	49 89 ca             	mov    %rcx,%r10
+    2511:	0f 05                	syscall
+    2513:	c3                   	ret
+
+0000000000002514 <futex_wait>:
+SYSCALL(futex_wait)
+    2514:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    2519:	49 89 ca             	mov    %rcx,%r10
+    251c:	0f 05                	syscall
+    251e:	c3                   	ret
+
+000000000000251f <futex_wake>:
+SYSCALL(futex_wake)
+    251f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    2524:	49 89 ca             	mov    %rcx,%r10
+    2527:	0f 05                	syscall
+    2529:	c3                   	ret
+
+000000000000252a <shmget>:
+SYSCALL(shmget)
+    252a:	b8 30 00 00 00       	mov    $0x30,%eax
+    252f:	49 89 ca             	mov    %rcx,%r10
+    2532:	0f 05                	syscall
+    2534:	c3                   	ret
+
+0000000000002535 <shmat>:
+SYSCALL(shmat)
+    2535:	b8 31 00 00 00       	mov    $0x31,%eax
+    253a:	49 89 ca             	mov    %rcx,%r10
+    253d:	0f 05                	syscall
+    253f:	c3                   	ret
+
+0000000000002540 <shmdt>:
+SYSCALL(shmdt)
+    2540:	b8 32 00 00 00       	mov    $0x32,%eax
+    2545:	49 89 ca             	mov    %rcx,%r10
+    2548:	0f 05                	syscall
+    254a:	c3                   	ret
+
+000000000000254b <ring_setup>:
+SYSCALL(ring_setup)
+    254b:	b8 33 00 00 00       	mov    $0x33,%eax
+    2550:	49 89 ca             	mov    %rcx,%r10
+    2553:	0f 05                	syscall
+    2555:	c3                   	ret
+
+0000000000002556 <ring_enter>:
+SYSCALL(ring_enter)
+    2556:	b8 34 00 00 00       	mov    $0x34,%eax
+    255b:	49 89 ca             	mov    %rcx,%r10
+    255e:	0f 05                	syscall
+    2560:	c3                   	ret
+
+0000000000002561 <getdents>:
+SYSCALL(getdents)
+    2561:	b8 35 00 00 00       	mov    $0x35,%eax
+    2566:	49 89 ca             	mov    %rcx,%r10
+    2569:	0f 05                	syscall
+    256b:	c3                   	ret
+
+000000000000256c <fstatat>:
+SYSCALL(fstatat)
+    256c:	b8 36 00 00 00       	mov    $0x36,%eax
+    2571:	49 89 ca             	mov    %rcx,%r10
+    2574:	0f 05                	syscall
+    2576:	c3                   	ret
+
+0000000000002577 <clone_file>:
+SYSCALL(clone_file)
+    2577:	b8 37 00 00 00       	mov    $0x37,%eax
+    257c:	49 89 ca             	mov    %rcx,%r10
+    257f:	0f 05                	syscall
+    2581:	c3                   	ret
+
+0000000000002582 <fpunch>:
+SYSCALL(fpunch)
+    2582:	b8 38 00 00 00       	mov    $0x38,%eax
+    2587:	49 89 ca             	mov    %rcx,%r10
+    258a:	0f 05                	syscall
+    258c:	c3                   	ret
+
+000000000000258d <defrag>:
+SYSCALL(defrag)
+    258d:	b8 39 00 00 00       	mov    $0x39,%eax
+    2592:	49 89 ca             	mov    %rcx,%r10
+    2595:	0f 05                	syscall
+    2597:	c3                   	ret
+
+0000000000002598 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    2598:	55                   	push   %rbp
+    2599:	48 89 e5             	mov    %rsp,%rbp
+    259c:	48 83 ec 20          	sub    $0x20,%rsp
+    25a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    25a4:	bf 00 00 00 00       	mov    $0x0,%edi
+    25a9:	e8 3d fe ff ff       	call   23eb <sbrk>
+    25ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    25b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25b6:	48 f7 d8             	neg    %rax
+    25b9:	25 ff 0f 00 00       	and    $0xfff,%eax
+    25be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    25c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    25c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25ca:	48 01 c2             	add    %rax,%rdx
+    25cd:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    25d2:	48 39 c2             	cmp    %rax,%rdx
+    25d5:	73 1e                	jae    25f5 <morecore+0x5d>
+    25d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25db:	89 c2                	mov    %eax,%edx
+    25dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25e1:	01 d0                	add    %edx,%eax
+    25e3:	89 c7                	mov    %eax,%edi
+    25e5:	e8 01 fe ff ff       	call   23eb <sbrk>
+    25ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    25ee:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    25f3:	75 07                	jne    25fc <morecore+0x64>
+    return 0;
+    25f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    25fa:	eb 27                	jmp    2623 <morecore+0x8b>
+  stats.heap += n + pad;
+    25fc:	48 8b 05 8d 3b 00 00 	mov    0x3b8d(%rip),%rax        # 6190 <stats+0x50>
+    2603:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2607:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    260b:	48 01 ca             	add    %rcx,%rdx
+    260e:	48 01 d0             	add    %rdx,%rax
+    2611:	48 89 05 78 3b 00 00 	mov    %rax,0x3b78(%rip)        # 6190 <stats+0x50>
+  return p + pad;
+    2618:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    261c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2620:	48 01 d0             	add    %rdx,%rax
+}
+    2623:	c9                   	leave
+    2624:	c3                   	ret
+
+0000000000002625 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    2625:	55                   	push   %rbp
+    2626:	48 89 e5             	mov    %rsp,%rbp
+    2629:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    262d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    2631:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2638:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2639:	48 8d 05 e0 3a 00 00 	lea    0x3ae0(%rip),%rax        # 6120 <runs>
+    2640:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2644:	eb 1a                	jmp    2660 <pagefree+0x3b>
+    prev = *rp;
+    2646:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    264a:	48 8b 00             	mov    (%rax),%rax
+    264d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2651:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2655:	48 8b 00             	mov    (%rax),%rax
+    2658:	48 83 c0 08          	add    $0x8,%rax
+    265c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2664:	48 8b 00             	mov    (%rax),%rax
+    2667:	48 85 c0             	test   %rax,%rax
+    266a:	74 0d                	je     2679 <pagefree+0x54>
+    266c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2670:	48 8b 00             	mov    (%rax),%rax
+    2673:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2677:	72 cd                	jb     2646 <pagefree+0x21>
+  r = (struct run *)p;
+    2679:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    267d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    2681:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2685:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2689:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    268c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2690:	48 8b 10             	mov    (%rax),%rdx
+    2693:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2697:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    269b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    269f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26a3:	48 85 c0             	test   %rax,%rax
+    26a6:	74 48                	je     26f0 <pagefree+0xcb>
+    26a8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    26ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    26b0:	48 01 c2             	add    %rax,%rdx
+    26b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26bb:	48 39 c2             	cmp    %rax,%rdx
+    26be:	75 30                	jne    26f0 <pagefree+0xcb>
+    r->size += r->next->size;
+    26c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26c4:	48 8b 10             	mov    (%rax),%rdx
+    26c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26cf:	48 8b 00             	mov    (%rax),%rax
+    26d2:	48 01 c2             	add    %rax,%rdx
+    26d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26d9:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    26dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26e4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    26e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26ec:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    26f0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    26f5:	74 46                	je     273d <pagefree+0x118>
+    26f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26fb:	48 8b 10             	mov    (%rax),%rdx
+    26fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2702:	48 01 d0             	add    %rdx,%rax
+    2705:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    2709:	75 32                	jne    273d <pagefree+0x118>
+    prev->size += r->size;
+    270b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    270f:	48 8b 10             	mov    (%rax),%rdx
+    2712:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2716:	48 8b 00             	mov    (%rax),%rax
+    2719:	48 01 c2             	add    %rax,%rdx
+    271c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2720:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    2723:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2727:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    272b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    272f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    2733:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2737:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    273b:	eb 0c                	jmp    2749 <pagefree+0x124>
+  } else {
+    *rp = r;
+    273d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2741:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2745:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    2748:	90                   	nop
+    2749:	90                   	nop
+    274a:	5d                   	pop    %rbp
+    274b:	c3                   	ret
+
+000000000000274c <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    274c:	55                   	push   %rbp
+    274d:	48 89 e5             	mov    %rsp,%rbp
+    2750:	48 83 ec 40          	sub    $0x40,%rsp
+    2754:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2758:	48 8d 05 c1 39 00 00 	lea    0x39c1(%rip),%rax        # 6120 <runs>
+    275f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2763:	eb 66                	jmp    27cb <pagealloc+0x7f>
+    if (r->size == n) {
+    2765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2769:	48 8b 00             	mov    (%rax),%rax
+    276c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2770:	75 18                	jne    278a <pagealloc+0x3e>
+      *rp = r->next;
+    2772:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2776:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    277a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    277e:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    2781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2785:	e9 ca 00 00 00       	jmp    2854 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    278a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    278e:	48 8b 00             	mov    (%rax),%rax
+    2791:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2795:	73 28                	jae    27bf <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    2797:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    279b:	48 8b 00             	mov    (%rax),%rax
+    279e:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    27a2:	48 89 c2             	mov    %rax,%rdx
+    27a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27a9:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    27ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27b0:	48 8b 10             	mov    (%rax),%rdx
+    27b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27b7:	48 01 d0             	add    %rdx,%rax
+    27ba:	e9 95 00 00 00       	jmp    2854 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    27bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27c3:	48 83 c0 08          	add    $0x8,%rax
+    27c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    27cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27cf:	48 8b 00             	mov    (%rax),%rax
+    27d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    27d6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    27db:	75 88                	jne    2765 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    27dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    27e1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    27e5:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    27ec:	00 
+    27ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    27f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27f5:	48 39 c2             	cmp    %rax,%rdx
+    27f8:	48 0f 43 c2          	cmovae %rdx,%rax
+    27fc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    2800:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2804:	48 89 c7             	mov    %rax,%rdi
+    2807:	e8 8c fd ff ff       	call   2598 <morecore>
+    280c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2810:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2815:	75 07                	jne    281e <pagealloc+0xd2>
+    return 0;
+    2817:	b8 00 00 00 00       	mov    $0x0,%eax
+    281c:	eb 36                	jmp    2854 <pagealloc+0x108>
+  if (m > n)
+    281e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2822:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2826:	73 1a                	jae    2842 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    2828:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    282c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2830:	48 89 c2             	mov    %rax,%rdx
+    2833:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2837:	48 89 d6             	mov    %rdx,%rsi
+    283a:	48 89 c7             	mov    %rax,%rdi
+    283d:	e8 e3 fd ff ff       	call   2625 <pagefree>
+  return p + m - n;
+    2842:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2846:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    284a:	48 89 c2             	mov    %rax,%rdx
+    284d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2851:	48 01 d0             	add    %rdx,%rax
+}
+    2854:	c9                   	leave
+    2855:	c3                   	ret
+
+0000000000002856 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    2856:	55                   	push   %rbp
+    2857:	48 89 e5             	mov    %rsp,%rbp
+    285a:	48 83 ec 30          	sub    $0x30,%rsp
+    285e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    2861:	bf 00 10 00 00       	mov    $0x1000,%edi
+    2866:	e8 e1 fe ff ff       	call   274c <pagealloc>
+    286b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    286f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2874:	75 0a                	jne    2880 <refill+0x2a>
+    return -1;
+    2876:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    287b:	e9 da 00 00 00       	jmp    295a <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2880:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2887:	00 
+    2888:	e9 ba 00 00 00       	jmp    2947 <refill+0xf1>
+    b = (struct block *)(p + off);
+    288d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2891:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2895:	48 01 d0             	add    %rdx,%rax
+    2898:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    289c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    289f:	ba 20 00 00 00       	mov    $0x20,%edx
+    28a4:	89 c1                	mov    %eax,%ecx
+    28a6:	48 d3 e2             	shl    %cl,%rdx
+    28a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ad:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    28b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28b3:	48 63 d0             	movslq %eax,%rdx
+    28b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ba:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    28be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28c1:	48 98                	cltq
+    28c3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    28ca:	00 
+    28cb:	48 8d 05 0e 38 00 00 	lea    0x380e(%rip),%rax        # 60e0 <freelist>
+    28d2:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    28d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28da:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    28de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28e1:	48 98                	cltq
+    28e3:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    28ea:	00 
+    28eb:	48 8d 15 ee 37 00 00 	lea    0x37ee(%rip),%rdx        # 60e0 <freelist>
+    28f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28f6:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    28fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28fd:	48 98                	cltq
+    28ff:	48 83 c0 08          	add    $0x8,%rax
+    2903:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    290a:	00 
+    290b:	48 8d 05 32 38 00 00 	lea    0x3832(%rip),%rax        # 6144 <stats+0x4>
+    2912:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2915:	8d 48 01             	lea    0x1(%rax),%ecx
+    2918:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    291b:	48 98                	cltq
+    291d:	48 83 c0 08          	add    $0x8,%rax
+    2921:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2928:	00 
+    2929:	48 8d 05 14 38 00 00 	lea    0x3814(%rip),%rax        # 6144 <stats+0x4>
+    2930:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2933:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2936:	ba 20 00 00 00       	mov    $0x20,%edx
+    293b:	89 c1                	mov    %eax,%ecx
+    293d:	48 d3 e2             	shl    %cl,%rdx
+    2940:	48 89 d0             	mov    %rdx,%rax
+    2943:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    2947:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    294e:	00 
+    294f:	0f 86 38 ff ff ff    	jbe    288d <refill+0x37>
+  }
+  return 0;
+    2955:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    295a:	c9                   	leave
+    295b:	c3                   	ret
+
+000000000000295c <malloc>:
+
+void *malloc(uint nbytes) {
+    295c:	55                   	push   %rbp
+    295d:	48 89 e5             	mov    %rsp,%rbp
+    2960:	48 83 ec 30          	sub    $0x30,%rsp
+    2964:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    2967:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    296a:	48 83 c0 10          	add    $0x10,%rax
+    296e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    2972:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2979:	eb 04                	jmp    297f <malloc+0x23>
+    297b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    297f:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    2983:	7f 16                	jg     299b <malloc+0x3f>
+    2985:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2988:	ba 20 00 00 00       	mov    $0x20,%edx
+    298d:	89 c1                	mov    %eax,%ecx
+    298f:	48 d3 e2             	shl    %cl,%rdx
+    2992:	48 89 d0             	mov    %rdx,%rax
+    2995:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    2999:	72 e0                	jb     297b <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    299b:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    299f:	75 7d                	jne    2a1e <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    29a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29a5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    29ab:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    29b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    29b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29b9:	48 89 c7             	mov    %rax,%rdi
+    29bc:	e8 8b fd ff ff       	call   274c <pagealloc>
+    29c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    29c5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    29ca:	75 0a                	jne    29d6 <malloc+0x7a>
+      return 0;
+    29cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    29d1:	e9 2c 01 00 00       	jmp    2b02 <malloc+0x1a6>
+    h->size = n;
+    29d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29da:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    29de:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    29e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29e5:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    29ec:	00 
+    stats.inuse[LARGE]++;
+    29ed:	8b 05 6d 37 00 00    	mov    0x376d(%rip),%eax        # 6160 <stats+0x20>
+    29f3:	83 c0 01             	add    $0x1,%eax
+    29f6:	89 05 64 37 00 00    	mov    %eax,0x3764(%rip)        # 6160 <stats+0x20>
+    stats.large += n;
+    29fc:	48 8b 15 85 37 00 00 	mov    0x3785(%rip),%rdx        # 6188 <stats+0x48>
+    2a03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a07:	48 01 d0             	add    %rdx,%rax
+    2a0a:	48 89 05 77 37 00 00 	mov    %rax,0x3777(%rip)        # 6188 <stats+0x48>
+    return h + 1;
+    2a11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2a15:	48 83 c0 10          	add    $0x10,%rax
+    2a19:	e9 e4 00 00 00       	jmp    2b02 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    2a1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a21:	48 98                	cltq
+    2a23:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2a2a:	00 
+    2a2b:	48 8d 05 ae 36 00 00 	lea    0x36ae(%rip),%rax        # 60e0 <freelist>
+    2a32:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2a36:	48 85 c0             	test   %rax,%rax
+    2a39:	75 18                	jne    2a53 <malloc+0xf7>
+    2a3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a3e:	89 c7                	mov    %eax,%edi
+    2a40:	e8 11 fe ff ff       	call   2856 <refill>
+    2a45:	85 c0                	test   %eax,%eax
+    2a47:	79 0a                	jns    2a53 <malloc+0xf7>
+    return 0;
+    2a49:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a4e:	e9 af 00 00 00       	jmp    2b02 <malloc+0x1a6>
+  b = freelist[c];
+    2a53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a56:	48 98                	cltq
+    2a58:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2a5f:	00 
+    2a60:	48 8d 05 79 36 00 00 	lea    0x3679(%rip),%rax        # 60e0 <freelist>
+    2a67:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2a6b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    2a6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a73:	48 8b 40 10          	mov    0x10(%rax),%rax
+    2a77:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2a7a:	48 63 d2             	movslq %edx,%rdx
+    2a7d:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2a84:	00 
+    2a85:	48 8d 15 54 36 00 00 	lea    0x3654(%rip),%rdx        # 60e0 <freelist>
+    2a8c:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    2a90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a93:	48 98                	cltq
+    2a95:	48 83 c0 08          	add    $0x8,%rax
+    2a99:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2aa0:	00 
+    2aa1:	48 8d 05 9c 36 00 00 	lea    0x369c(%rip),%rax        # 6144 <stats+0x4>
+    2aa8:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2aab:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2aae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2ab1:	48 98                	cltq
+    2ab3:	48 83 c0 08          	add    $0x8,%rax
+    2ab7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2abe:	00 
+    2abf:	48 8d 05 7e 36 00 00 	lea    0x367e(%rip),%rax        # 6144 <stats+0x4>
+    2ac6:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    2ac9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2acc:	48 98                	cltq
+    2ace:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2ad5:	00 
+    2ad6:	48 8d 05 63 36 00 00 	lea    0x3663(%rip),%rax        # 6140 <stats>
+    2add:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2ae0:	8d 48 01             	lea    0x1(%rax),%ecx
+    2ae3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2ae6:	48 98                	cltq
+    2ae8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2aef:	00 
+    2af0:	48 8d 05 49 36 00 00 	lea    0x3649(%rip),%rax        # 6140 <stats>
+    2af7:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    2afa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2afe:	48 83 c0 10          	add    $0x10,%rax
+}
+    2b02:	c9                   	leave
+    2b03:	c3                   	ret
+
+0000000000002b04 <free>:
+
+void free(void *ap) {
+    2b04:	55                   	push   %rbp
+    2b05:	48 89 e5             	mov    %rsp,%rbp
+    2b08:	48 83 ec 18          	sub    $0x18,%rsp
+    2b0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    2b10:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2b15:	0f 84 03 01 00 00    	je     2c1e <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    2b1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2b1f:	48 83 e8 10          	sub    $0x10,%rax
+    2b23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    2b27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b2b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2b2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    2b33:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    2b38:	75 42                	jne    2b7c <free+0x78>
+    stats.inuse[LARGE]--;
+    2b3a:	8b 05 20 36 00 00    	mov    0x3620(%rip),%eax        # 6160 <stats+0x20>
+    2b40:	83 e8 01             	sub    $0x1,%eax
+    2b43:	89 05 17 36 00 00    	mov    %eax,0x3617(%rip)        # 6160 <stats+0x20>
+    stats.large -= b->h.size;
+    2b49:	48 8b 15 38 36 00 00 	mov    0x3638(%rip),%rdx        # 6188 <stats+0x48>
+    2b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b54:	48 8b 00             	mov    (%rax),%rax
+    2b57:	48 29 c2             	sub    %rax,%rdx
+    2b5a:	48 89 15 27 36 00 00 	mov    %rdx,0x3627(%rip)        # 6188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    2b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b65:	48 8b 10             	mov    (%rax),%rdx
+    2b68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b6c:	48 89 d6             	mov    %rdx,%rsi
+    2b6f:	48 89 c7             	mov    %rax,%rdi
+    2b72:	e8 ae fa ff ff       	call   2625 <pagefree>
+    return;
+    2b77:	e9 a3 00 00 00       	jmp    2c1f <free+0x11b>
+  }
+  b->next = freelist[c];
+    2b7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b80:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2b87:	00 
+    2b88:	48 8d 05 51 35 00 00 	lea    0x3551(%rip),%rax        # 60e0 <freelist>
+    2b8f:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2b93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b97:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    2b9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b9f:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2ba6:	00 
+    2ba7:	48 8d 15 32 35 00 00 	lea    0x3532(%rip),%rdx        # 60e0 <freelist>
+    2bae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bb2:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    2bb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bba:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2bc1:	00 
+    2bc2:	48 8d 05 77 35 00 00 	lea    0x3577(%rip),%rax        # 6140 <stats>
+    2bc9:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2bcc:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2bcf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bd3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2bda:	00 
+    2bdb:	48 8d 05 5e 35 00 00 	lea    0x355e(%rip),%rax        # 6140 <stats>
+    2be2:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    2be5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2be9:	48 83 c0 08          	add    $0x8,%rax
+    2bed:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2bf4:	00 
+    2bf5:	48 8d 05 48 35 00 00 	lea    0x3548(%rip),%rax        # 6144 <stats+0x4>
+    2bfc:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2bff:	8d 48 01             	lea    0x1(%rax),%ecx
+    2c02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c06:	48 83 c0 08          	add    $0x8,%rax
+    2c0a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2c11:	00 
+    2c12:	48 8d 05 2b 35 00 00 	lea    0x352b(%rip),%rax        # 6144 <stats+0x4>
+    2c19:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    2c1c:	eb 01                	jmp    2c1f <free+0x11b>
+    return;
+    2c1e:	90                   	nop
+}
+    2c1f:	c9                   	leave
+    2c20:	c3                   	ret
+
+0000000000002c21 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    2c21:	55                   	push   %rbp
+    2c22:	48 89 e5             	mov    %rsp,%rbp
+    2c25:	48 83 ec 30          	sub    $0x30,%rsp
+    2c29:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    2c2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2c2f:	48 8d 15 ea 08 00 00 	lea    0x8ea(%rip),%rdx        # 3520 <benchreport+0x7d7>
+    2c36:	48 89 d6             	mov    %rdx,%rsi
+    2c39:	89 c7                	mov    %eax,%edi
+    2c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2c40:	e8 37 e6 ff ff       	call   127c <printf>
+  for (c = 0; c < NCLASS; c++)
+    2c45:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2c4c:	eb 67                	jmp    2cb5 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2c4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c51:	48 98                	cltq
+    2c53:	48 83 c0 08          	add    $0x8,%rax
+    2c57:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2c5e:	00 
+    2c5f:	48 8d 05 de 34 00 00 	lea    0x34de(%rip),%rax        # 6144 <stats+0x4>
+    2c66:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    2c69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c6c:	48 98                	cltq
+    2c6e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2c75:	00 
+    2c76:	48 8d 05 c3 34 00 00 	lea    0x34c3(%rip),%rax        # 6140 <stats>
+    2c7d:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    2c80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c83:	ba 20 00 00 00       	mov    $0x20,%edx
+    2c88:	89 c1                	mov    %eax,%ecx
+    2c8a:	48 d3 e2             	shl    %cl,%rdx
+    2c8d:	48 89 d0             	mov    %rdx,%rax
+    2c90:	89 c1                	mov    %eax,%ecx
+    2c92:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2c95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2c98:	41 89 f9             	mov    %edi,%r9d
+    2c9b:	41 89 f0             	mov    %esi,%r8d
+    2c9e:	48 8d 35 92 08 00 00 	lea    0x892(%rip),%rsi        # 3537 <benchreport+0x7ee>
+    2ca5:	89 c7                	mov    %eax,%edi
+    2ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+    2cac:	e8 cb e5 ff ff       	call   127c <printf>
+  for (c = 0; c < NCLASS; c++)
+    2cb1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    2cb5:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    2cb9:	7e 93                	jle    2c4e <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    2cbb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2cc2:	00 
+  for (r = runs; r; r = r->next)
+    2cc3:	48 8b 05 56 34 00 00 	mov    0x3456(%rip),%rax        # 6120 <runs>
+    2cca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2cce:	eb 17                	jmp    2ce7 <mallocstats+0xc6>
+    nfree += r->size;
+    2cd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cd4:	48 8b 00             	mov    (%rax),%rax
+    2cd7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    2cdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cdf:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2ce3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2ce7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2cec:	75 e2                	jne    2cd0 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    2cee:	48 8b 05 9b 34 00 00 	mov    0x349b(%rip),%rax        # 6190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2cf5:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2cf7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2cfb:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2cff:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2d01:	48 8b 05 80 34 00 00 	mov    0x3480(%rip),%rax        # 6188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2d08:	89 c1                	mov    %eax,%ecx
+    2d0a:	8b 15 50 34 00 00    	mov    0x3450(%rip),%edx        # 6160 <stats+0x20>
+    2d10:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2d13:	41 89 f9             	mov    %edi,%r9d
+    2d16:	41 89 f0             	mov    %esi,%r8d
+    2d19:	48 8d 35 28 08 00 00 	lea    0x828(%rip),%rsi        # 3548 <benchreport+0x7ff>
+    2d20:	89 c7                	mov    %eax,%edi
+    2d22:	b8 00 00 00 00       	mov    $0x0,%eax
+    2d27:	e8 50 e5 ff ff       	call   127c <printf>
+}
+    2d2c:	90                   	nop
+    2d2d:	c9                   	leave
+    2d2e:	c3                   	ret
+
+0000000000002d2f <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    2d2f:	55                   	push   %rbp
+    2d30:	48 89 e5             	mov    %rsp,%rbp
+    2d33:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    2d37:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    2d3b:	48 89 c7             	mov    %rax,%rdi
+    2d3e:	e8 9a f7 ff ff       	call   24dd <cycles>
+  return t;
+    2d43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2d47:	c9                   	leave
+    2d48:	c3                   	ret
+
+0000000000002d49 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    2d49:	55                   	push   %rbp
+    2d4a:	48 89 e5             	mov    %rsp,%rbp
+    2d4d:	48 83 ec 30          	sub    $0x30,%rsp
+    2d51:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2d55:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2d59:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    2d5c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2d60:	0f 8e 24 01 00 00    	jle    2e8a <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    2d66:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2d6d:	e9 98 00 00 00       	jmp    2e0a <benchreport+0xc1>
+    x = t[i];
+    2d72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2d75:	48 98                	cltq
+    2d77:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2d7e:	00 
+    2d7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d83:	48 01 d0             	add    %rdx,%rax
+    2d86:	48 8b 00             	mov    (%rax),%rax
+    2d89:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2d8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2d90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2d93:	eb 33                	jmp    2dc8 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    2d95:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2d98:	48 98                	cltq
+    2d9a:	48 c1 e0 03          	shl    $0x3,%rax
+    2d9e:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2da2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2da6:	48 01 d0             	add    %rdx,%rax
+    2da9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2dac:	48 63 d2             	movslq %edx,%rdx
+    2daf:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2db6:	00 
+    2db7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2dbb:	48 01 ca             	add    %rcx,%rdx
+    2dbe:	48 8b 00             	mov    (%rax),%rax
+    2dc1:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2dc4:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    2dc8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2dcc:	7e 1d                	jle    2deb <benchreport+0xa2>
+    2dce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2dd1:	48 98                	cltq
+    2dd3:	48 c1 e0 03          	shl    $0x3,%rax
+    2dd7:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2ddb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2ddf:	48 01 d0             	add    %rdx,%rax
+    2de2:	48 8b 00             	mov    (%rax),%rax
+    2de5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2de9:	72 aa                	jb     2d95 <benchreport+0x4c>
+    t[j] = x;
+    2deb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2dee:	48 98                	cltq
+    2df0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2df7:	00 
+    2df8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2dfc:	48 01 c2             	add    %rax,%rdx
+    2dff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e03:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    2e06:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2e0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2e0d:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2e10:	0f 8c 5c ff ff ff    	jl     2d72 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    2e16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2e19:	48 98                	cltq
+    2e1b:	48 c1 e0 03          	shl    $0x3,%rax
+    2e1f:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2e23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e27:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2e2a:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    2e2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2e30:	89 c2                	mov    %eax,%edx
+    2e32:	c1 ea 1f             	shr    $0x1f,%edx
+    2e35:	01 d0                	add    %edx,%eax
+    2e37:	d1 f8                	sar    %eax
+    2e39:	48 98                	cltq
+    2e3b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2e42:	00 
+    2e43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e47:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2e4a:	48 8b 38             	mov    (%rax),%rdi
+    2e4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e51:	48 8b 30             	mov    (%rax),%rsi
+    2e54:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2e57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e5b:	48 83 ec 08          	sub    $0x8,%rsp
+    2e5f:	51                   	push   %rcx
+    2e60:	49 89 f9             	mov    %rdi,%r9
+    2e63:	49 89 f0             	mov    %rsi,%r8
+    2e66:	89 d1                	mov    %edx,%ecx
+    2e68:	48 89 c2             	mov    %rax,%rdx
+    2e6b:	48 8d 05 16 07 00 00 	lea    0x716(%rip),%rax        # 3588 <benchreport+0x83f>
+    2e72:	48 89 c6             	mov    %rax,%rsi
+    2e75:	bf 01 00 00 00       	mov    $0x1,%edi
+    2e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    2e7f:	e8 f8 e3 ff ff       	call   127c <printf>
+    2e84:	48 83 c4 10          	add    $0x10,%rsp
+    2e88:	eb 01                	jmp    2e8b <benchreport+0x142>
+    return;
+    2e8a:	90                   	nop
+}
+    2e8b:	c9                   	leave
+    2e8c:	c3                   	ret
@@ -0,0 +1,5621 @@
+
+out/user/_lab4test_a:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <overwrite>:
+      while (1)                                                                \
+        ;                                                                      \
+    }                                                                          \
+  } while (0)
+
+void overwrite(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  printf(stdout, "overwrite...\n");
+       8:	8b 05 f2 4f 00 00    	mov    0x4ff2(%rip),%eax        # 5000 <stdout>
+       e:	48 8d 15 a3 3e 00 00 	lea    0x3ea3(%rip),%rdx        # 3eb8 <benchreport+0x14a>
+      15:	48 89 d6             	mov    %rdx,%rsi
+      18:	89 c7                	mov    %eax,%edi
+      1a:	b8 00 00 00 00       	mov    $0x0,%eax
+      1f:	e8 7d 22 00 00       	call   22a1 <printf>
+  strcpy(buf, "lab5 is the last 451 lab\n");
+      24:	48 8d 05 9b 3e 00 00 	lea    0x3e9b(%rip),%rax        # 3ec6 <benchreport+0x158>
+      2b:	48 89 c6             	mov    %rax,%rsi
+      2e:	48 8d 05 2b 50 00 00 	lea    0x502b(%rip),%rax        # 5060 <buf>
+      35:	48 89 c7             	mov    %rax,%rdi
+      38:	e8 58 2b 00 00       	call   2b95 <strcpy>
+  fd = open("small.txt", O_RDWR);
+      3d:	be 02 00 00 00       	mov    $0x2,%esi
+      42:	48 8d 05 97 3e 00 00 	lea    0x3e97(%rip),%rax        # 3ee0 <benchreport+0x172>
+      49:	48 89 c7             	mov    %rax,%rdi
+      4c:	e8 5c 33 00 00       	call   33ad <open>
+      51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+      54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      58:	79 5e                	jns    b8 <overwrite+0xb8>
+    error("Could not open small.txt with RW permissions");
+      5a:	8b 05 a0 4f 00 00    	mov    0x4fa0(%rip),%eax        # 5000 <stdout>
+      60:	ba 28 00 00 00       	mov    $0x28,%edx
+      65:	48 8d 0d 7e 3e 00 00 	lea    0x3e7e(%rip),%rcx        # 3eea <benchreport+0x17c>
+      6c:	48 89 ce             	mov    %rcx,%rsi
+      6f:	89 c7                	mov    %eax,%edi
+      71:	b8 00 00 00 00       	mov    $0x0,%eax
+      76:	e8 26 22 00 00       	call   22a1 <printf>
+      7b:	8b 05 7f 4f 00 00    	mov    0x4f7f(%rip),%eax        # 5000 <stdout>
+      81:	48 8d 15 78 3e 00 00 	lea    0x3e78(%rip),%rdx        # 3f00 <benchreport+0x192>
+      88:	48 89 d6             	mov    %rdx,%rsi
+      8b:	89 c7                	mov    %eax,%edi
+      8d:	b8 00 00 00 00       	mov    $0x0,%eax
+      92:	e8 0a 22 00 00       	call   22a1 <printf>
+      97:	8b 05 63 4f 00 00    	mov    0x4f63(%rip),%eax        # 5000 <stdout>
+      9d:	48 8d 15 89 3e 00 00 	lea    0x3e89(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+      a4:	48 89 d6             	mov    %rdx,%rsi
+      a7:	89 c7                	mov    %eax,%edi
+      a9:	b8 00 00 00 00       	mov    $0x0,%eax
+      ae:	e8 ee 21 00 00       	call   22a1 <printf>
+      b3:	e8 19 28 00 00       	call   28d1 <exit>
+  }
+  // overwrite the original data.
+  int n = write(fd, buf, strlen(buf) + 1);
+      b8:	48 8d 05 a1 4f 00 00 	lea    0x4fa1(%rip),%rax        # 5060 <buf>
+      bf:	48 89 c7             	mov    %rax,%rdi
+      c2:	e8 5c 2b 00 00       	call   2c23 <strlen>
+      c7:	83 c0 01             	add    $0x1,%eax
+      ca:	89 c2                	mov    %eax,%edx
+      cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      cf:	48 8d 0d 8a 4f 00 00 	lea    0x4f8a(%rip),%rcx        # 5060 <buf>
+      d6:	48 89 ce             	mov    %rcx,%rsi
+      d9:	89 c7                	mov    %eax,%edi
+      db:	e8 a1 32 00 00       	call   3381 <write>
+      e0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != strlen(buf) + 1) {
+      e3:	48 8d 05 76 4f 00 00 	lea    0x4f76(%rip),%rax        # 5060 <buf>
+      ea:	48 89 c7             	mov    %rax,%rdi
+      ed:	e8 31 2b 00 00       	call   2c23 <strlen>
+      f2:	8d 50 01             	lea    0x1(%rax),%edx
+      f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      f8:	39 c2                	cmp    %eax,%edx
+      fa:	74 74                	je     170 <overwrite+0x170>
+    error("Did not write entire buffer. Wanted: %d, Wrote: %d\n", strlen(buf) + 1, n);
+      fc:	8b 05 fe 4e 00 00    	mov    0x4efe(%rip),%eax        # 5000 <stdout>
+     102:	ba 2d 00 00 00       	mov    $0x2d,%edx
+     107:	48 8d 0d dc 3d 00 00 	lea    0x3ddc(%rip),%rcx        # 3eea <benchreport+0x17c>
+     10e:	48 89 ce             	mov    %rcx,%rsi
+     111:	89 c7                	mov    %eax,%edi
+     113:	b8 00 00 00 00       	mov    $0x0,%eax
+     118:	e8 84 21 00 00       	call   22a1 <printf>
+     11d:	48 8d 05 3c 4f 00 00 	lea    0x4f3c(%rip),%rax        # 5060 <buf>
+     124:	48 89 c7             	mov    %rax,%rdi
+     127:	e8 f7 2a 00 00       	call   2c23 <strlen>
+     12c:	8d 70 01             	lea    0x1(%rax),%esi
+     12f:	8b 05 cb 4e 00 00    	mov    0x4ecb(%rip),%eax        # 5000 <stdout>
+     135:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     138:	89 d1                	mov    %edx,%ecx
+     13a:	89 f2                	mov    %esi,%edx
+     13c:	48 8d 35 ed 3d 00 00 	lea    0x3ded(%rip),%rsi        # 3f30 <benchreport+0x1c2>
+     143:	89 c7                	mov    %eax,%edi
+     145:	b8 00 00 00 00       	mov    $0x0,%eax
+     14a:	e8 52 21 00 00       	call   22a1 <printf>
+     14f:	8b 05 ab 4e 00 00    	mov    0x4eab(%rip),%eax        # 5000 <stdout>
+     155:	48 8d 15 d1 3d 00 00 	lea    0x3dd1(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     15c:	48 89 d6             	mov    %rdx,%rsi
+     15f:	89 c7                	mov    %eax,%edi
+     161:	b8 00 00 00 00       	mov    $0x0,%eax
+     166:	e8 36 21 00 00       	call   22a1 <printf>
+     16b:	e8 61 27 00 00       	call   28d1 <exit>
+  }
+  close(fd);
+     170:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     173:	89 c7                	mov    %eax,%edi
+     175:	e8 c1 27 00 00       	call   293b <close>
+
+  fd = open("small.txt", O_RDONLY);
+     17a:	be 00 00 00 00       	mov    $0x0,%esi
+     17f:	48 8d 05 5a 3d 00 00 	lea    0x3d5a(%rip),%rax        # 3ee0 <benchreport+0x172>
+     186:	48 89 c7             	mov    %rax,%rdi
+     189:	e8 1f 32 00 00       	call   33ad <open>
+     18e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  read(fd, buf, 50);
+     191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     194:	ba 32 00 00 00       	mov    $0x32,%edx
+     199:	48 8d 0d c0 4e 00 00 	lea    0x4ec0(%rip),%rcx        # 5060 <buf>
+     1a0:	48 89 ce             	mov    %rcx,%rsi
+     1a3:	89 c7                	mov    %eax,%edi
+     1a5:	e8 cc 31 00 00       	call   3376 <read>
+  if (strcmp(buf, "lab5 is the last 451 lab\n") != 0)
+     1aa:	48 8d 05 15 3d 00 00 	lea    0x3d15(%rip),%rax        # 3ec6 <benchreport+0x158>
+     1b1:	48 89 c6             	mov    %rax,%rsi
+     1b4:	48 8d 05 a5 4e 00 00 	lea    0x4ea5(%rip),%rax        # 5060 <buf>
+     1bb:	48 89 c7             	mov    %rax,%rdi
+     1be:	e8 11 2a 00 00       	call   2bd4 <strcmp>
+     1c3:	85 c0                	test   %eax,%eax
+     1c5:	74 65                	je     22c <overwrite+0x22c>
+    error("file content was not 'lab5 is the last 451 lab', was: '%s'", buf);
+     1c7:	8b 05 33 4e 00 00    	mov    0x4e33(%rip),%eax        # 5000 <stdout>
+     1cd:	ba 34 00 00 00       	mov    $0x34,%edx
+     1d2:	48 8d 0d 11 3d 00 00 	lea    0x3d11(%rip),%rcx        # 3eea <benchreport+0x17c>
+     1d9:	48 89 ce             	mov    %rcx,%rsi
+     1dc:	89 c7                	mov    %eax,%edi
+     1de:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e3:	e8 b9 20 00 00       	call   22a1 <printf>
+     1e8:	8b 05 12 4e 00 00    	mov    0x4e12(%rip),%eax        # 5000 <stdout>
+     1ee:	48 8d 15 6b 4e 00 00 	lea    0x4e6b(%rip),%rdx        # 5060 <buf>
+     1f5:	48 8d 0d 6c 3d 00 00 	lea    0x3d6c(%rip),%rcx        # 3f68 <benchreport+0x1fa>
+     1fc:	48 89 ce             	mov    %rcx,%rsi
+     1ff:	89 c7                	mov    %eax,%edi
+     201:	b8 00 00 00 00       	mov    $0x0,%eax
+     206:	e8 96 20 00 00       	call   22a1 <printf>
+     20b:	8b 05 ef 4d 00 00    	mov    0x4def(%rip),%eax        # 5000 <stdout>
+     211:	48 8d 15 15 3d 00 00 	lea    0x3d15(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     218:	48 89 d6             	mov    %rdx,%rsi
+     21b:	89 c7                	mov    %eax,%edi
+     21d:	b8 00 00 00 00       	mov    $0x0,%eax
+     222:	e8 7a 20 00 00       	call   22a1 <printf>
+     227:	e8 a5 26 00 00       	call   28d1 <exit>
+
+  close(fd);
+     22c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     22f:	89 c7                	mov    %eax,%edi
+     231:	e8 05 27 00 00       	call   293b <close>
+
+  printf(stdout, "overwrite ok\n");
+     236:	8b 05 c4 4d 00 00    	mov    0x4dc4(%rip),%eax        # 5000 <stdout>
+     23c:	48 8d 15 60 3d 00 00 	lea    0x3d60(%rip),%rdx        # 3fa3 <benchreport+0x235>
+     243:	48 89 d6             	mov    %rdx,%rsi
+     246:	89 c7                	mov    %eax,%edi
+     248:	b8 00 00 00 00       	mov    $0x0,%eax
+     24d:	e8 4f 20 00 00       	call   22a1 <printf>
+}
+     252:	90                   	nop
+     253:	c9                   	leave
+     254:	c3                   	ret
+
+0000000000000255 <append>:
+
+void append(void) {
+     255:	55                   	push   %rbp
+     256:	48 89 e5             	mov    %rsp,%rbp
+     259:	41 57                	push   %r15
+     25b:	41 56                	push   %r14
+     25d:	41 55                	push   %r13
+     25f:	41 54                	push   %r12
+     261:	53                   	push   %rbx
+     262:	48 83 ec 28          	sub    $0x28,%rsp
+     266:	48 89 e0             	mov    %rsp,%rax
+     269:	48 89 c3             	mov    %rax,%rbx
+  int fd;
+  int old_size;
+
+  printf(stdout, "append...\n");
+     26c:	8b 05 8e 4d 00 00    	mov    0x4d8e(%rip),%eax        # 5000 <stdout>
+     272:	48 8d 15 38 3d 00 00 	lea    0x3d38(%rip),%rdx        # 3fb1 <benchreport+0x243>
+     279:	48 89 d6             	mov    %rdx,%rsi
+     27c:	89 c7                	mov    %eax,%edi
+     27e:	b8 00 00 00 00       	mov    $0x0,%eax
+     283:	e8 19 20 00 00       	call   22a1 <printf>
+
+  old_size = strlen(buf);
+     288:	48 8d 05 d1 4d 00 00 	lea    0x4dd1(%rip),%rax        # 5060 <buf>
+     28f:	48 89 c7             	mov    %rax,%rdi
+     292:	e8 8c 29 00 00       	call   2c23 <strlen>
+     297:	89 45 cc             	mov    %eax,-0x34(%rbp)
+
+  fd = open("small.txt", O_RDWR);
+     29a:	be 02 00 00 00       	mov    $0x2,%esi
+     29f:	48 8d 05 3a 3c 00 00 	lea    0x3c3a(%rip),%rax        # 3ee0 <benchreport+0x172>
+     2a6:	48 89 c7             	mov    %rax,%rdi
+     2a9:	e8 ff 30 00 00       	call   33ad <open>
+     2ae:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  if (fd < 0) {
+     2b1:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+     2b5:	79 5e                	jns    315 <append+0xc0>
+    error("Could not open small.txt with RW permissions");
+     2b7:	8b 05 43 4d 00 00    	mov    0x4d43(%rip),%eax        # 5000 <stdout>
+     2bd:	ba 45 00 00 00       	mov    $0x45,%edx
+     2c2:	48 8d 0d 21 3c 00 00 	lea    0x3c21(%rip),%rcx        # 3eea <benchreport+0x17c>
+     2c9:	48 89 ce             	mov    %rcx,%rsi
+     2cc:	89 c7                	mov    %eax,%edi
+     2ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d3:	e8 c9 1f 00 00       	call   22a1 <printf>
+     2d8:	8b 05 22 4d 00 00    	mov    0x4d22(%rip),%eax        # 5000 <stdout>
+     2de:	48 8d 15 1b 3c 00 00 	lea    0x3c1b(%rip),%rdx        # 3f00 <benchreport+0x192>
+     2e5:	48 89 d6             	mov    %rdx,%rsi
+     2e8:	89 c7                	mov    %eax,%edi
+     2ea:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ef:	e8 ad 1f 00 00       	call   22a1 <printf>
+     2f4:	8b 05 06 4d 00 00    	mov    0x4d06(%rip),%eax        # 5000 <stdout>
+     2fa:	48 8d 15 2c 3c 00 00 	lea    0x3c2c(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     301:	48 89 d6             	mov    %rdx,%rsi
+     304:	89 c7                	mov    %eax,%edi
+     306:	b8 00 00 00 00       	mov    $0x0,%eax
+     30b:	e8 91 1f 00 00       	call   22a1 <printf>
+     310:	e8 bc 25 00 00       	call   28d1 <exit>
+  }
+
+  // Advance the fd offset to 1 less than the size of file.
+  char garbo[old_size];
+     315:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     318:	48 63 d0             	movslq %eax,%rdx
+     31b:	48 83 ea 01          	sub    $0x1,%rdx
+     31f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     323:	48 63 d0             	movslq %eax,%rdx
+     326:	49 89 d6             	mov    %rdx,%r14
+     329:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     32f:	48 63 d0             	movslq %eax,%rdx
+     332:	49 89 d4             	mov    %rdx,%r12
+     335:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     33b:	48 98                	cltq
+     33d:	ba 10 00 00 00       	mov    $0x10,%edx
+     342:	48 83 ea 01          	sub    $0x1,%rdx
+     346:	48 01 d0             	add    %rdx,%rax
+     349:	b9 10 00 00 00       	mov    $0x10,%ecx
+     34e:	ba 00 00 00 00       	mov    $0x0,%edx
+     353:	48 f7 f1             	div    %rcx
+     356:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     35a:	48 29 c4             	sub    %rax,%rsp
+     35d:	48 89 e0             	mov    %rsp,%rax
+     360:	48 83 c0 00          	add    $0x0,%rax
+     364:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  int n = read(fd, &garbo, old_size - 1);
+     368:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     36b:	8d 50 ff             	lea    -0x1(%rax),%edx
+     36e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+     372:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     375:	48 89 ce             	mov    %rcx,%rsi
+     378:	89 c7                	mov    %eax,%edi
+     37a:	e8 f7 2f 00 00       	call   3376 <read>
+     37f:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (n != old_size - 1) {
+     382:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     385:	83 e8 01             	sub    $0x1,%eax
+     388:	39 45 b4             	cmp    %eax,-0x4c(%rbp)
+     38b:	74 5e                	je     3eb <append+0x196>
+    error("read failed");
+     38d:	8b 05 6d 4c 00 00    	mov    0x4c6d(%rip),%eax        # 5000 <stdout>
+     393:	ba 4c 00 00 00       	mov    $0x4c,%edx
+     398:	48 8d 0d 4b 3b 00 00 	lea    0x3b4b(%rip),%rcx        # 3eea <benchreport+0x17c>
+     39f:	48 89 ce             	mov    %rcx,%rsi
+     3a2:	89 c7                	mov    %eax,%edi
+     3a4:	b8 00 00 00 00       	mov    $0x0,%eax
+     3a9:	e8 f3 1e 00 00       	call   22a1 <printf>
+     3ae:	8b 05 4c 4c 00 00    	mov    0x4c4c(%rip),%eax        # 5000 <stdout>
+     3b4:	48 8d 15 01 3c 00 00 	lea    0x3c01(%rip),%rdx        # 3fbc <benchreport+0x24e>
+     3bb:	48 89 d6             	mov    %rdx,%rsi
+     3be:	89 c7                	mov    %eax,%edi
+     3c0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3c5:	e8 d7 1e 00 00       	call   22a1 <printf>
+     3ca:	8b 05 30 4c 00 00    	mov    0x4c30(%rip),%eax        # 5000 <stdout>
+     3d0:	48 8d 15 56 3b 00 00 	lea    0x3b56(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     3d7:	48 89 d6             	mov    %rdx,%rsi
+     3da:	89 c7                	mov    %eax,%edi
+     3dc:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e1:	e8 bb 1e 00 00       	call   22a1 <printf>
+     3e6:	e8 e6 24 00 00       	call   28d1 <exit>
+  }
+  strcpy(buf, ", but this is just the beginning :(\n");
+     3eb:	48 8d 05 d6 3b 00 00 	lea    0x3bd6(%rip),%rax        # 3fc8 <benchreport+0x25a>
+     3f2:	48 89 c6             	mov    %rax,%rsi
+     3f5:	48 8d 05 64 4c 00 00 	lea    0x4c64(%rip),%rax        # 5060 <buf>
+     3fc:	48 89 c7             	mov    %rax,%rdi
+     3ff:	e8 91 27 00 00       	call   2b95 <strcpy>
+
+  // overwrite the last char, and append data.
+  n = write(fd, buf, strlen(buf) + 1);
+     404:	48 8d 05 55 4c 00 00 	lea    0x4c55(%rip),%rax        # 5060 <buf>
+     40b:	48 89 c7             	mov    %rax,%rdi
+     40e:	e8 10 28 00 00       	call   2c23 <strlen>
+     413:	83 c0 01             	add    $0x1,%eax
+     416:	89 c2                	mov    %eax,%edx
+     418:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     41b:	48 8d 0d 3e 4c 00 00 	lea    0x4c3e(%rip),%rcx        # 5060 <buf>
+     422:	48 89 ce             	mov    %rcx,%rsi
+     425:	89 c7                	mov    %eax,%edi
+     427:	e8 55 2f 00 00       	call   3381 <write>
+     42c:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (n != strlen(buf) + 1) {
+     42f:	48 8d 05 2a 4c 00 00 	lea    0x4c2a(%rip),%rax        # 5060 <buf>
+     436:	48 89 c7             	mov    %rax,%rdi
+     439:	e8 e5 27 00 00       	call   2c23 <strlen>
+     43e:	8d 50 01             	lea    0x1(%rax),%edx
+     441:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+     444:	39 c2                	cmp    %eax,%edx
+     446:	74 74                	je     4bc <append+0x267>
+    error("Did not write entire buffer. Wanted: %d, Wrote: %d\n", strlen(buf) + 1, n);
+     448:	8b 05 b2 4b 00 00    	mov    0x4bb2(%rip),%eax        # 5000 <stdout>
+     44e:	ba 53 00 00 00       	mov    $0x53,%edx
+     453:	48 8d 0d 90 3a 00 00 	lea    0x3a90(%rip),%rcx        # 3eea <benchreport+0x17c>
+     45a:	48 89 ce             	mov    %rcx,%rsi
+     45d:	89 c7                	mov    %eax,%edi
+     45f:	b8 00 00 00 00       	mov    $0x0,%eax
+     464:	e8 38 1e 00 00       	call   22a1 <printf>
+     469:	48 8d 05 f0 4b 00 00 	lea    0x4bf0(%rip),%rax        # 5060 <buf>
+     470:	48 89 c7             	mov    %rax,%rdi
+     473:	e8 ab 27 00 00       	call   2c23 <strlen>
+     478:	8d 70 01             	lea    0x1(%rax),%esi
+     47b:	8b 05 7f 4b 00 00    	mov    0x4b7f(%rip),%eax        # 5000 <stdout>
+     481:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+     484:	89 d1                	mov    %edx,%ecx
+     486:	89 f2                	mov    %esi,%edx
+     488:	48 8d 35 a1 3a 00 00 	lea    0x3aa1(%rip),%rsi        # 3f30 <benchreport+0x1c2>
+     48f:	89 c7                	mov    %eax,%edi
+     491:	b8 00 00 00 00       	mov    $0x0,%eax
+     496:	e8 06 1e 00 00       	call   22a1 <printf>
+     49b:	8b 05 5f 4b 00 00    	mov    0x4b5f(%rip),%eax        # 5000 <stdout>
+     4a1:	48 8d 15 85 3a 00 00 	lea    0x3a85(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     4a8:	48 89 d6             	mov    %rdx,%rsi
+     4ab:	89 c7                	mov    %eax,%edi
+     4ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b2:	e8 ea 1d 00 00       	call   22a1 <printf>
+     4b7:	e8 15 24 00 00       	call   28d1 <exit>
+  }
+  close(fd);
+     4bc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     4bf:	89 c7                	mov    %eax,%edi
+     4c1:	e8 75 24 00 00       	call   293b <close>
+
+  fd = open("small.txt", O_RDWR);
+     4c6:	be 02 00 00 00       	mov    $0x2,%esi
+     4cb:	48 8d 05 0e 3a 00 00 	lea    0x3a0e(%rip),%rax        # 3ee0 <benchreport+0x172>
+     4d2:	48 89 c7             	mov    %rax,%rdi
+     4d5:	e8 d3 2e 00 00       	call   33ad <open>
+     4da:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  read(fd, buf, 62);
+     4dd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     4e0:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     4e5:	48 8d 0d 74 4b 00 00 	lea    0x4b74(%rip),%rcx        # 5060 <buf>
+     4ec:	48 89 ce             	mov    %rcx,%rsi
+     4ef:	89 c7                	mov    %eax,%edi
+     4f1:	e8 80 2e 00 00       	call   3376 <read>
+
+  // If the content hasn't changed, then the dinode size is not being
+  // updated for the file.
+  if (strcmp(buf, "lab5 is the last 451 lab, but this is just the beginning :(\n") != 0)
+     4f6:	48 8d 05 f3 3a 00 00 	lea    0x3af3(%rip),%rax        # 3ff0 <benchreport+0x282>
+     4fd:	48 89 c6             	mov    %rax,%rsi
+     500:	48 8d 05 59 4b 00 00 	lea    0x4b59(%rip),%rax        # 5060 <buf>
+     507:	48 89 c7             	mov    %rax,%rdi
+     50a:	e8 c5 26 00 00       	call   2bd4 <strcmp>
+     50f:	85 c0                	test   %eax,%eax
+     511:	74 65                	je     578 <append+0x323>
+    error("file content did not match expected, was: '%s'", buf);
+     513:	8b 05 e7 4a 00 00    	mov    0x4ae7(%rip),%eax        # 5000 <stdout>
+     519:	ba 5d 00 00 00       	mov    $0x5d,%edx
+     51e:	48 8d 0d c5 39 00 00 	lea    0x39c5(%rip),%rcx        # 3eea <benchreport+0x17c>
+     525:	48 89 ce             	mov    %rcx,%rsi
+     528:	89 c7                	mov    %eax,%edi
+     52a:	b8 00 00 00 00       	mov    $0x0,%eax
+     52f:	e8 6d 1d 00 00       	call   22a1 <printf>
+     534:	8b 05 c6 4a 00 00    	mov    0x4ac6(%rip),%eax        # 5000 <stdout>
+     53a:	48 8d 15 1f 4b 00 00 	lea    0x4b1f(%rip),%rdx        # 5060 <buf>
+     541:	48 8d 0d e8 3a 00 00 	lea    0x3ae8(%rip),%rcx        # 4030 <benchreport+0x2c2>
+     548:	48 89 ce             	mov    %rcx,%rsi
+     54b:	89 c7                	mov    %eax,%edi
+     54d:	b8 00 00 00 00       	mov    $0x0,%eax
+     552:	e8 4a 1d 00 00       	call   22a1 <printf>
+     557:	8b 05 a3 4a 00 00    	mov    0x4aa3(%rip),%eax        # 5000 <stdout>
+     55d:	48 8d 15 c9 39 00 00 	lea    0x39c9(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     564:	48 89 d6             	mov    %rdx,%rsi
+     567:	89 c7                	mov    %eax,%edi
+     569:	b8 00 00 00 00       	mov    $0x0,%eax
+     56e:	e8 2e 1d 00 00       	call   22a1 <printf>
+     573:	e8 59 23 00 00       	call   28d1 <exit>
+
+  close(fd);
+     578:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     57b:	89 c7                	mov    %eax,%edi
+     57d:	e8 b9 23 00 00       	call   293b <close>
+
+  printf(stdout, "append ok\n");
+     582:	8b 05 78 4a 00 00    	mov    0x4a78(%rip),%eax        # 5000 <stdout>
+     588:	48 8d 15 d0 3a 00 00 	lea    0x3ad0(%rip),%rdx        # 405f <benchreport+0x2f1>
+     58f:	48 89 d6             	mov    %rdx,%rsi
+     592:	89 c7                	mov    %eax,%edi
+     594:	b8 00 00 00 00       	mov    $0x0,%eax
+     599:	e8 03 1d 00 00       	call   22a1 <printf>
+     59e:	48 89 dc             	mov    %rbx,%rsp
+}
+     5a1:	90                   	nop
+     5a2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     5a6:	5b                   	pop    %rbx
+     5a7:	41 5c                	pop    %r12
+     5a9:	41 5d                	pop    %r13
+     5ab:	41 5e                	pop    %r14
+     5ad:	41 5f                	pop    %r15
+     5af:	5d                   	pop    %rbp
+     5b0:	c3                   	ret
+
+00000000000005b1 <filecreation>:
+
+
+// Creates a new file.
+// Writes 1 byte to it, reads 1 byte from it.
+void filecreation(void) {
+     5b1:	55                   	push   %rbp
+     5b2:	48 89 e5             	mov    %rsp,%rbp
+     5b5:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, n;
+  printf(1, "filecreation...\n");
+     5b9:	48 8d 05 aa 3a 00 00 	lea    0x3aaa(%rip),%rax        # 406a <benchreport+0x2fc>
+     5c0:	48 89 c6             	mov    %rax,%rsi
+     5c3:	bf 01 00 00 00       	mov    $0x1,%edi
+     5c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cd:	e8 cf 1c 00 00       	call   22a1 <printf>
+
+  if ((fd = open("create.txt", O_CREATE|O_RDWR)) < 0)
+     5d2:	be 02 02 00 00       	mov    $0x202,%esi
+     5d7:	48 8d 05 9d 3a 00 00 	lea    0x3a9d(%rip),%rax        # 407b <benchreport+0x30d>
+     5de:	48 89 c7             	mov    %rax,%rdi
+     5e1:	e8 c7 2d 00 00       	call   33ad <open>
+     5e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     5e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     5ed:	79 5e                	jns    64d <filecreation+0x9c>
+    error("create 'create.txt' failed");
+     5ef:	8b 05 0b 4a 00 00    	mov    0x4a0b(%rip),%eax        # 5000 <stdout>
+     5f5:	ba 6c 00 00 00       	mov    $0x6c,%edx
+     5fa:	48 8d 0d e9 38 00 00 	lea    0x38e9(%rip),%rcx        # 3eea <benchreport+0x17c>
+     601:	48 89 ce             	mov    %rcx,%rsi
+     604:	89 c7                	mov    %eax,%edi
+     606:	b8 00 00 00 00       	mov    $0x0,%eax
+     60b:	e8 91 1c 00 00       	call   22a1 <printf>
+     610:	8b 05 ea 49 00 00    	mov    0x49ea(%rip),%eax        # 5000 <stdout>
+     616:	48 8d 15 69 3a 00 00 	lea    0x3a69(%rip),%rdx        # 4086 <benchreport+0x318>
+     61d:	48 89 d6             	mov    %rdx,%rsi
+     620:	89 c7                	mov    %eax,%edi
+     622:	b8 00 00 00 00       	mov    $0x0,%eax
+     627:	e8 75 1c 00 00       	call   22a1 <printf>
+     62c:	8b 05 ce 49 00 00    	mov    0x49ce(%rip),%eax        # 5000 <stdout>
+     632:	48 8d 15 f4 38 00 00 	lea    0x38f4(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     639:	48 89 d6             	mov    %rdx,%rsi
+     63c:	89 c7                	mov    %eax,%edi
+     63e:	b8 00 00 00 00       	mov    $0x0,%eax
+     643:	e8 59 1c 00 00       	call   22a1 <printf>
+     648:	e8 84 22 00 00       	call   28d1 <exit>
+  close(fd);
+     64d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     650:	89 c7                	mov    %eax,%edi
+     652:	e8 e4 22 00 00       	call   293b <close>
+
+  // Reopen and write 1 byte.
+  if ((fd = open("create.txt", O_RDWR)) < 0)
+     657:	be 02 00 00 00       	mov    $0x2,%esi
+     65c:	48 8d 05 18 3a 00 00 	lea    0x3a18(%rip),%rax        # 407b <benchreport+0x30d>
+     663:	48 89 c7             	mov    %rax,%rdi
+     666:	e8 42 2d 00 00       	call   33ad <open>
+     66b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     66e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     672:	79 5e                	jns    6d2 <filecreation+0x121>
+    error("open 'create.txt' after creation failed");
+     674:	8b 05 86 49 00 00    	mov    0x4986(%rip),%eax        # 5000 <stdout>
+     67a:	ba 71 00 00 00       	mov    $0x71,%edx
+     67f:	48 8d 0d 64 38 00 00 	lea    0x3864(%rip),%rcx        # 3eea <benchreport+0x17c>
+     686:	48 89 ce             	mov    %rcx,%rsi
+     689:	89 c7                	mov    %eax,%edi
+     68b:	b8 00 00 00 00       	mov    $0x0,%eax
+     690:	e8 0c 1c 00 00       	call   22a1 <printf>
+     695:	8b 05 65 49 00 00    	mov    0x4965(%rip),%eax        # 5000 <stdout>
+     69b:	48 8d 15 06 3a 00 00 	lea    0x3a06(%rip),%rdx        # 40a8 <benchreport+0x33a>
+     6a2:	48 89 d6             	mov    %rdx,%rsi
+     6a5:	89 c7                	mov    %eax,%edi
+     6a7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ac:	e8 f0 1b 00 00       	call   22a1 <printf>
+     6b1:	8b 05 49 49 00 00    	mov    0x4949(%rip),%eax        # 5000 <stdout>
+     6b7:	48 8d 15 6f 38 00 00 	lea    0x386f(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     6be:	48 89 d6             	mov    %rdx,%rsi
+     6c1:	89 c7                	mov    %eax,%edi
+     6c3:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c8:	e8 d4 1b 00 00       	call   22a1 <printf>
+     6cd:	e8 ff 21 00 00       	call   28d1 <exit>
+  memset(buf, 1, 1);
+     6d2:	ba 01 00 00 00       	mov    $0x1,%edx
+     6d7:	be 01 00 00 00       	mov    $0x1,%esi
+     6dc:	48 8d 05 7d 49 00 00 	lea    0x497d(%rip),%rax        # 5060 <buf>
+     6e3:	48 89 c7             	mov    %rax,%rdi
+     6e6:	e8 d8 25 00 00       	call   2cc3 <memset>
+  n = write(fd, buf, 1);
+     6eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6ee:	ba 01 00 00 00       	mov    $0x1,%edx
+     6f3:	48 8d 0d 66 49 00 00 	lea    0x4966(%rip),%rcx        # 5060 <buf>
+     6fa:	48 89 ce             	mov    %rcx,%rsi
+     6fd:	89 c7                	mov    %eax,%edi
+     6ff:	e8 7d 2c 00 00       	call   3381 <write>
+     704:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != 1) {
+     707:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     70b:	74 5e                	je     76b <filecreation+0x1ba>
+    error("error writing to created file.\n");
+     70d:	8b 05 ed 48 00 00    	mov    0x48ed(%rip),%eax        # 5000 <stdout>
+     713:	ba 75 00 00 00       	mov    $0x75,%edx
+     718:	48 8d 0d cb 37 00 00 	lea    0x37cb(%rip),%rcx        # 3eea <benchreport+0x17c>
+     71f:	48 89 ce             	mov    %rcx,%rsi
+     722:	89 c7                	mov    %eax,%edi
+     724:	b8 00 00 00 00       	mov    $0x0,%eax
+     729:	e8 73 1b 00 00       	call   22a1 <printf>
+     72e:	8b 05 cc 48 00 00    	mov    0x48cc(%rip),%eax        # 5000 <stdout>
+     734:	48 8d 15 95 39 00 00 	lea    0x3995(%rip),%rdx        # 40d0 <benchreport+0x362>
+     73b:	48 89 d6             	mov    %rdx,%rsi
+     73e:	89 c7                	mov    %eax,%edi
+     740:	b8 00 00 00 00       	mov    $0x0,%eax
+     745:	e8 57 1b 00 00       	call   22a1 <printf>
+     74a:	8b 05 b0 48 00 00    	mov    0x48b0(%rip),%eax        # 5000 <stdout>
+     750:	48 8d 15 d6 37 00 00 	lea    0x37d6(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     757:	48 89 d6             	mov    %rdx,%rsi
+     75a:	89 c7                	mov    %eax,%edi
+     75c:	b8 00 00 00 00       	mov    $0x0,%eax
+     761:	e8 3b 1b 00 00       	call   22a1 <printf>
+     766:	e8 66 21 00 00       	call   28d1 <exit>
+  }
+  close(fd);
+     76b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     76e:	89 c7                	mov    %eax,%edi
+     770:	e8 c6 21 00 00       	call   293b <close>
+
+  // Reopen and read 1 byte.
+  if ((fd = open("create.txt", O_RDWR)) < 0)
+     775:	be 02 00 00 00       	mov    $0x2,%esi
+     77a:	48 8d 05 fa 38 00 00 	lea    0x38fa(%rip),%rax        # 407b <benchreport+0x30d>
+     781:	48 89 c7             	mov    %rax,%rdi
+     784:	e8 24 2c 00 00       	call   33ad <open>
+     789:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     78c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     790:	79 5e                	jns    7f0 <filecreation+0x23f>
+    error("open 'create.txt' after creation failed");
+     792:	8b 05 68 48 00 00    	mov    0x4868(%rip),%eax        # 5000 <stdout>
+     798:	ba 7b 00 00 00       	mov    $0x7b,%edx
+     79d:	48 8d 0d 46 37 00 00 	lea    0x3746(%rip),%rcx        # 3eea <benchreport+0x17c>
+     7a4:	48 89 ce             	mov    %rcx,%rsi
+     7a7:	89 c7                	mov    %eax,%edi
+     7a9:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ae:	e8 ee 1a 00 00       	call   22a1 <printf>
+     7b3:	8b 05 47 48 00 00    	mov    0x4847(%rip),%eax        # 5000 <stdout>
+     7b9:	48 8d 15 e8 38 00 00 	lea    0x38e8(%rip),%rdx        # 40a8 <benchreport+0x33a>
+     7c0:	48 89 d6             	mov    %rdx,%rsi
+     7c3:	89 c7                	mov    %eax,%edi
+     7c5:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ca:	e8 d2 1a 00 00       	call   22a1 <printf>
+     7cf:	8b 05 2b 48 00 00    	mov    0x482b(%rip),%eax        # 5000 <stdout>
+     7d5:	48 8d 15 51 37 00 00 	lea    0x3751(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     7dc:	48 89 d6             	mov    %rdx,%rsi
+     7df:	89 c7                	mov    %eax,%edi
+     7e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     7e6:	e8 b6 1a 00 00       	call   22a1 <printf>
+     7eb:	e8 e1 20 00 00       	call   28d1 <exit>
+  memset(buf, 0, 1);
+     7f0:	ba 01 00 00 00       	mov    $0x1,%edx
+     7f5:	be 00 00 00 00       	mov    $0x0,%esi
+     7fa:	48 8d 05 5f 48 00 00 	lea    0x485f(%rip),%rax        # 5060 <buf>
+     801:	48 89 c7             	mov    %rax,%rdi
+     804:	e8 ba 24 00 00       	call   2cc3 <memset>
+  n = read(fd, buf, 1);
+     809:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     80c:	ba 01 00 00 00       	mov    $0x1,%edx
+     811:	48 8d 0d 48 48 00 00 	lea    0x4848(%rip),%rcx        # 5060 <buf>
+     818:	48 89 ce             	mov    %rcx,%rsi
+     81b:	89 c7                	mov    %eax,%edi
+     81d:	e8 54 2b 00 00       	call   3376 <read>
+     822:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n != 1) {
+     825:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     829:	74 5e                	je     889 <filecreation+0x2d8>
+    error("error reading from created file.\n");
+     82b:	8b 05 cf 47 00 00    	mov    0x47cf(%rip),%eax        # 5000 <stdout>
+     831:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     836:	48 8d 0d ad 36 00 00 	lea    0x36ad(%rip),%rcx        # 3eea <benchreport+0x17c>
+     83d:	48 89 ce             	mov    %rcx,%rsi
+     840:	89 c7                	mov    %eax,%edi
+     842:	b8 00 00 00 00       	mov    $0x0,%eax
+     847:	e8 55 1a 00 00       	call   22a1 <printf>
+     84c:	8b 05 ae 47 00 00    	mov    0x47ae(%rip),%eax        # 5000 <stdout>
+     852:	48 8d 15 97 38 00 00 	lea    0x3897(%rip),%rdx        # 40f0 <benchreport+0x382>
+     859:	48 89 d6             	mov    %rdx,%rsi
+     85c:	89 c7                	mov    %eax,%edi
+     85e:	b8 00 00 00 00       	mov    $0x0,%eax
+     863:	e8 39 1a 00 00       	call   22a1 <printf>
+     868:	8b 05 92 47 00 00    	mov    0x4792(%rip),%eax        # 5000 <stdout>
+     86e:	48 8d 15 b8 36 00 00 	lea    0x36b8(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     875:	48 89 d6             	mov    %rdx,%rsi
+     878:	89 c7                	mov    %eax,%edi
+     87a:	b8 00 00 00 00       	mov    $0x0,%eax
+     87f:	e8 1d 1a 00 00       	call   22a1 <printf>
+     884:	e8 48 20 00 00       	call   28d1 <exit>
+  }
+
+  // Ensure read got the correct value.
+  assert(buf[0] == 1);
+     889:	0f b6 05 d0 47 00 00 	movzbl 0x47d0(%rip),%eax        # 5060 <buf>
+     890:	3c 01                	cmp    $0x1,%al
+     892:	74 2b                	je     8bf <filecreation+0x30e>
+     894:	8b 05 66 47 00 00    	mov    0x4766(%rip),%eax        # 5000 <stdout>
+     89a:	48 8d 15 71 38 00 00 	lea    0x3871(%rip),%rdx        # 4112 <benchreport+0x3a4>
+     8a1:	48 89 d1             	mov    %rdx,%rcx
+     8a4:	ba 83 00 00 00       	mov    $0x83,%edx
+     8a9:	48 8d 35 70 38 00 00 	lea    0x3870(%rip),%rsi        # 4120 <benchreport+0x3b2>
+     8b0:	89 c7                	mov    %eax,%edi
+     8b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b7:	e8 e5 19 00 00       	call   22a1 <printf>
+     8bc:	90                   	nop
+     8bd:	eb fd                	jmp    8bc <filecreation+0x30b>
+
+  printf(1, "filecreation ok\n");
+     8bf:	48 8d 05 7a 38 00 00 	lea    0x387a(%rip),%rax        # 4140 <benchreport+0x3d2>
+     8c6:	48 89 c6             	mov    %rax,%rsi
+     8c9:	bf 01 00 00 00       	mov    $0x1,%edi
+     8ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d3:	e8 c9 19 00 00       	call   22a1 <printf>
+
+}
+     8d8:	90                   	nop
+     8d9:	c9                   	leave
+     8da:	c3                   	ret
+
+00000000000008db <onefile>:
+
+
+// Creates a file, writes and reads data.
+// Data is written and read by 500 bytes to try
+// and catch errors in writing.
+void onefile(void) {
+     8db:	55                   	push   %rbp
+     8dc:	48 89 e5             	mov    %rsp,%rbp
+     8df:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i, j;
+  printf(1, "onefile...\n");
+     8e3:	48 8d 05 67 38 00 00 	lea    0x3867(%rip),%rax        # 4151 <benchreport+0x3e3>
+     8ea:	48 89 c6             	mov    %rax,%rsi
+     8ed:	bf 01 00 00 00       	mov    $0x1,%edi
+     8f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f7:	e8 a5 19 00 00       	call   22a1 <printf>
+
+  if ((fd = open("onefile.txt", O_CREATE|O_RDWR)) < 0)
+     8fc:	be 02 02 00 00       	mov    $0x202,%esi
+     901:	48 8d 05 55 38 00 00 	lea    0x3855(%rip),%rax        # 415d <benchreport+0x3ef>
+     908:	48 89 c7             	mov    %rax,%rdi
+     90b:	e8 9d 2a 00 00       	call   33ad <open>
+     910:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     913:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     917:	79 5e                	jns    977 <onefile+0x9c>
+    error("create 'onefile.txt' failed");
+     919:	8b 05 e1 46 00 00    	mov    0x46e1(%rip),%eax        # 5000 <stdout>
+     91f:	ba 92 00 00 00       	mov    $0x92,%edx
+     924:	48 8d 0d bf 35 00 00 	lea    0x35bf(%rip),%rcx        # 3eea <benchreport+0x17c>
+     92b:	48 89 ce             	mov    %rcx,%rsi
+     92e:	89 c7                	mov    %eax,%edi
+     930:	b8 00 00 00 00       	mov    $0x0,%eax
+     935:	e8 67 19 00 00       	call   22a1 <printf>
+     93a:	8b 05 c0 46 00 00    	mov    0x46c0(%rip),%eax        # 5000 <stdout>
+     940:	48 8d 15 22 38 00 00 	lea    0x3822(%rip),%rdx        # 4169 <benchreport+0x3fb>
+     947:	48 89 d6             	mov    %rdx,%rsi
+     94a:	89 c7                	mov    %eax,%edi
+     94c:	b8 00 00 00 00       	mov    $0x0,%eax
+     951:	e8 4b 19 00 00       	call   22a1 <printf>
+     956:	8b 05 a4 46 00 00    	mov    0x46a4(%rip),%eax        # 5000 <stdout>
+     95c:	48 8d 15 ca 35 00 00 	lea    0x35ca(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     963:	48 89 d6             	mov    %rdx,%rsi
+     966:	89 c7                	mov    %eax,%edi
+     968:	b8 00 00 00 00       	mov    $0x0,%eax
+     96d:	e8 2f 19 00 00       	call   22a1 <printf>
+     972:	e8 5a 1f 00 00       	call   28d1 <exit>
+
+  close(fd);
+     977:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     97a:	89 c7                	mov    %eax,%edi
+     97c:	e8 ba 1f 00 00       	call   293b <close>
+  if ((fd = open("onefile.txt", O_RDWR)) < 0)
+     981:	be 02 00 00 00       	mov    $0x2,%esi
+     986:	48 8d 05 d0 37 00 00 	lea    0x37d0(%rip),%rax        # 415d <benchreport+0x3ef>
+     98d:	48 89 c7             	mov    %rax,%rdi
+     990:	e8 18 2a 00 00       	call   33ad <open>
+     995:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     998:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     99c:	79 5e                	jns    9fc <onefile+0x121>
+    error("open 'onefile.txt' after creation failed");
+     99e:	8b 05 5c 46 00 00    	mov    0x465c(%rip),%eax        # 5000 <stdout>
+     9a4:	ba 96 00 00 00       	mov    $0x96,%edx
+     9a9:	48 8d 0d 3a 35 00 00 	lea    0x353a(%rip),%rcx        # 3eea <benchreport+0x17c>
+     9b0:	48 89 ce             	mov    %rcx,%rsi
+     9b3:	89 c7                	mov    %eax,%edi
+     9b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ba:	e8 e2 18 00 00       	call   22a1 <printf>
+     9bf:	8b 05 3b 46 00 00    	mov    0x463b(%rip),%eax        # 5000 <stdout>
+     9c5:	48 8d 15 bc 37 00 00 	lea    0x37bc(%rip),%rdx        # 4188 <benchreport+0x41a>
+     9cc:	48 89 d6             	mov    %rdx,%rsi
+     9cf:	89 c7                	mov    %eax,%edi
+     9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d6:	e8 c6 18 00 00       	call   22a1 <printf>
+     9db:	8b 05 1f 46 00 00    	mov    0x461f(%rip),%eax        # 5000 <stdout>
+     9e1:	48 8d 15 45 35 00 00 	lea    0x3545(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     9e8:	48 89 d6             	mov    %rdx,%rsi
+     9eb:	89 c7                	mov    %eax,%edi
+     9ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f2:	e8 aa 18 00 00       	call   22a1 <printf>
+     9f7:	e8 d5 1e 00 00       	call   28d1 <exit>
+
+
+  memset(buf, 0, sizeof(buf));
+     9fc:	ba 00 20 00 00       	mov    $0x2000,%edx
+     a01:	be 00 00 00 00       	mov    $0x0,%esi
+     a06:	48 8d 05 53 46 00 00 	lea    0x4653(%rip),%rax        # 5060 <buf>
+     a0d:	48 89 c7             	mov    %rax,%rdi
+     a10:	e8 ae 22 00 00       	call   2cc3 <memset>
+  for (i = 0; i < 10; i++) {
+     a15:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a1c:	eb 36                	jmp    a54 <onefile+0x179>
+    memset(buf, i, 500);
+     a1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a21:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     a26:	89 c6                	mov    %eax,%esi
+     a28:	48 8d 05 31 46 00 00 	lea    0x4631(%rip),%rax        # 5060 <buf>
+     a2f:	48 89 c7             	mov    %rax,%rdi
+     a32:	e8 8c 22 00 00       	call   2cc3 <memset>
+    write(fd, buf, 500);
+     a37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a3a:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     a3f:	48 8d 0d 1a 46 00 00 	lea    0x461a(%rip),%rcx        # 5060 <buf>
+     a46:	48 89 ce             	mov    %rcx,%rsi
+     a49:	89 c7                	mov    %eax,%edi
+     a4b:	e8 31 29 00 00       	call   3381 <write>
+  for (i = 0; i < 10; i++) {
+     a50:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a54:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     a58:	7e c4                	jle    a1e <onefile+0x143>
+  }
+  close(fd);
+     a5a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a5d:	89 c7                	mov    %eax,%edi
+     a5f:	e8 d7 1e 00 00       	call   293b <close>
+  if ((fd = open("onefile.txt", O_RDONLY)) < 0)
+     a64:	be 00 00 00 00       	mov    $0x0,%esi
+     a69:	48 8d 05 ed 36 00 00 	lea    0x36ed(%rip),%rax        # 415d <benchreport+0x3ef>
+     a70:	48 89 c7             	mov    %rax,%rdi
+     a73:	e8 35 29 00 00       	call   33ad <open>
+     a78:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a7b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     a7f:	79 5e                	jns    adf <onefile+0x204>
+    error("couldn't reopen 'onefile.txt'");
+     a81:	8b 05 79 45 00 00    	mov    0x4579(%rip),%eax        # 5000 <stdout>
+     a87:	ba a0 00 00 00       	mov    $0xa0,%edx
+     a8c:	48 8d 0d 57 34 00 00 	lea    0x3457(%rip),%rcx        # 3eea <benchreport+0x17c>
+     a93:	48 89 ce             	mov    %rcx,%rsi
+     a96:	89 c7                	mov    %eax,%edi
+     a98:	b8 00 00 00 00       	mov    $0x0,%eax
+     a9d:	e8 ff 17 00 00       	call   22a1 <printf>
+     aa2:	8b 05 58 45 00 00    	mov    0x4558(%rip),%eax        # 5000 <stdout>
+     aa8:	48 8d 15 02 37 00 00 	lea    0x3702(%rip),%rdx        # 41b1 <benchreport+0x443>
+     aaf:	48 89 d6             	mov    %rdx,%rsi
+     ab2:	89 c7                	mov    %eax,%edi
+     ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ab9:	e8 e3 17 00 00       	call   22a1 <printf>
+     abe:	8b 05 3c 45 00 00    	mov    0x453c(%rip),%eax        # 5000 <stdout>
+     ac4:	48 8d 15 62 34 00 00 	lea    0x3462(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     acb:	48 89 d6             	mov    %rdx,%rsi
+     ace:	89 c7                	mov    %eax,%edi
+     ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ad5:	e8 c7 17 00 00       	call   22a1 <printf>
+     ada:	e8 f2 1d 00 00       	call   28d1 <exit>
+
+  memset(buf, 0, sizeof(buf));
+     adf:	ba 00 20 00 00       	mov    $0x2000,%edx
+     ae4:	be 00 00 00 00       	mov    $0x0,%esi
+     ae9:	48 8d 05 70 45 00 00 	lea    0x4570(%rip),%rax        # 5060 <buf>
+     af0:	48 89 c7             	mov    %rax,%rdi
+     af3:	e8 cb 21 00 00       	call   2cc3 <memset>
+  for (i = 0; i < 10; i++) {
+     af8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     aff:	e9 de 00 00 00       	jmp    be2 <onefile+0x307>
+    if (read(fd, buf, 500) != 500)
+     b04:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b07:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     b0c:	48 8d 0d 4d 45 00 00 	lea    0x454d(%rip),%rcx        # 5060 <buf>
+     b13:	48 89 ce             	mov    %rcx,%rsi
+     b16:	89 c7                	mov    %eax,%edi
+     b18:	e8 59 28 00 00       	call   3376 <read>
+     b1d:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     b22:	74 61                	je     b85 <onefile+0x2aa>
+      error("couldn't read the bytes for iteration %d", i);
+     b24:	8b 05 d6 44 00 00    	mov    0x44d6(%rip),%eax        # 5000 <stdout>
+     b2a:	ba a5 00 00 00       	mov    $0xa5,%edx
+     b2f:	48 8d 0d b4 33 00 00 	lea    0x33b4(%rip),%rcx        # 3eea <benchreport+0x17c>
+     b36:	48 89 ce             	mov    %rcx,%rsi
+     b39:	89 c7                	mov    %eax,%edi
+     b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+     b40:	e8 5c 17 00 00       	call   22a1 <printf>
+     b45:	8b 05 b5 44 00 00    	mov    0x44b5(%rip),%eax        # 5000 <stdout>
+     b4b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     b4e:	48 8d 0d 7b 36 00 00 	lea    0x367b(%rip),%rcx        # 41d0 <benchreport+0x462>
+     b55:	48 89 ce             	mov    %rcx,%rsi
+     b58:	89 c7                	mov    %eax,%edi
+     b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     b5f:	e8 3d 17 00 00       	call   22a1 <printf>
+     b64:	8b 05 96 44 00 00    	mov    0x4496(%rip),%eax        # 5000 <stdout>
+     b6a:	48 8d 15 bc 33 00 00 	lea    0x33bc(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     b71:	48 89 d6             	mov    %rdx,%rsi
+     b74:	89 c7                	mov    %eax,%edi
+     b76:	b8 00 00 00 00       	mov    $0x0,%eax
+     b7b:	e8 21 17 00 00       	call   22a1 <printf>
+     b80:	e8 4c 1d 00 00       	call   28d1 <exit>
+
+    for (j = 0; j < 500; j++) {
+     b85:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     b8c:	eb 47                	jmp    bd5 <onefile+0x2fa>
+      assert(i == buf[j]);
+     b8e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b91:	48 98                	cltq
+     b93:	48 8d 15 c6 44 00 00 	lea    0x44c6(%rip),%rdx        # 5060 <buf>
+     b9a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     b9e:	0f be c0             	movsbl %al,%eax
+     ba1:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     ba4:	74 2b                	je     bd1 <onefile+0x2f6>
+     ba6:	8b 05 54 44 00 00    	mov    0x4454(%rip),%eax        # 5000 <stdout>
+     bac:	48 8d 15 46 36 00 00 	lea    0x3646(%rip),%rdx        # 41f9 <benchreport+0x48b>
+     bb3:	48 89 d1             	mov    %rdx,%rcx
+     bb6:	ba a8 00 00 00       	mov    $0xa8,%edx
+     bbb:	48 8d 35 5e 35 00 00 	lea    0x355e(%rip),%rsi        # 4120 <benchreport+0x3b2>
+     bc2:	89 c7                	mov    %eax,%edi
+     bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc9:	e8 d3 16 00 00       	call   22a1 <printf>
+     bce:	90                   	nop
+     bcf:	eb fd                	jmp    bce <onefile+0x2f3>
+    for (j = 0; j < 500; j++) {
+     bd1:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     bd5:	81 7d f8 f3 01 00 00 	cmpl   $0x1f3,-0x8(%rbp)
+     bdc:	7e b0                	jle    b8e <onefile+0x2b3>
+  for (i = 0; i < 10; i++) {
+     bde:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     be2:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     be6:	0f 8e 18 ff ff ff    	jle    b04 <onefile+0x229>
+    }
+  }
+
+  printf(1, "onefile ok\n");
+     bec:	48 8d 05 12 36 00 00 	lea    0x3612(%rip),%rax        # 4205 <benchreport+0x497>
+     bf3:	48 89 c6             	mov    %rax,%rsi
+     bf6:	bf 01 00 00 00       	mov    $0x1,%edi
+     bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+     c00:	e8 9c 16 00 00       	call   22a1 <printf>
+}
+     c05:	90                   	nop
+     c06:	c9                   	leave
+     c07:	c3                   	ret
+
+0000000000000c08 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test concurrent block allocation.
+void fourfiles(void) {
+     c08:	55                   	push   %rbp
+     c09:	48 89 e5             	mov    %rsp,%rbp
+     c0c:	48 83 ec 50          	sub    $0x50,%rsp
+  int fd, pid, i, j, n, total, pi;
+  int num = 4;
+     c10:	c7 45 ec 04 00 00 00 	movl   $0x4,-0x14(%rbp)
+  char *names[] = {"f0", "f1", "f2", "f3"};
+     c17:	48 8d 05 f3 35 00 00 	lea    0x35f3(%rip),%rax        # 4211 <benchreport+0x4a3>
+     c1e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+     c22:	48 8d 05 eb 35 00 00 	lea    0x35eb(%rip),%rax        # 4214 <benchreport+0x4a6>
+     c29:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+     c2d:	48 8d 05 e3 35 00 00 	lea    0x35e3(%rip),%rax        # 4217 <benchreport+0x4a9>
+     c34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+     c38:	48 8d 05 db 35 00 00 	lea    0x35db(%rip),%rax        # 421a <benchreport+0x4ac>
+     c3f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  char *fname;
+
+  printf(1, "fourfiles...\n");
+     c43:	48 8d 05 d3 35 00 00 	lea    0x35d3(%rip),%rax        # 421d <benchreport+0x4af>
+     c4a:	48 89 c6             	mov    %rax,%rsi
+     c4d:	bf 01 00 00 00       	mov    $0x1,%edi
+     c52:	b8 00 00 00 00       	mov    $0x0,%eax
+     c57:	e8 45 16 00 00       	call   22a1 <printf>
+
+  for (pi = 0; pi < num; pi++) {
+     c5c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+     c63:	e9 c1 01 00 00       	jmp    e29 <fourfiles+0x221>
+    fname = names[pi];
+     c68:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c6b:	48 98                	cltq
+     c6d:	48 8b 44 c5 b0       	mov    -0x50(%rbp,%rax,8),%rax
+     c72:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    pid = fork();
+     c76:	e8 46 1c 00 00       	call   28c1 <fork>
+     c7b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+    if (pid < 0) {
+     c7e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+     c82:	79 5e                	jns    ce2 <fourfiles+0xda>
+      error("fork failed.");
+     c84:	8b 05 76 43 00 00    	mov    0x4376(%rip),%eax        # 5000 <stdout>
+     c8a:	ba bd 00 00 00       	mov    $0xbd,%edx
+     c8f:	48 8d 0d 54 32 00 00 	lea    0x3254(%rip),%rcx        # 3eea <benchreport+0x17c>
+     c96:	48 89 ce             	mov    %rcx,%rsi
+     c99:	89 c7                	mov    %eax,%edi
+     c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+     ca0:	e8 fc 15 00 00       	call   22a1 <printf>
+     ca5:	8b 05 55 43 00 00    	mov    0x4355(%rip),%eax        # 5000 <stdout>
+     cab:	48 8d 15 79 35 00 00 	lea    0x3579(%rip),%rdx        # 422b <benchreport+0x4bd>
+     cb2:	48 89 d6             	mov    %rdx,%rsi
+     cb5:	89 c7                	mov    %eax,%edi
+     cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cbc:	e8 e0 15 00 00       	call   22a1 <printf>
+     cc1:	8b 05 39 43 00 00    	mov    0x4339(%rip),%eax        # 5000 <stdout>
+     cc7:	48 8d 15 5f 32 00 00 	lea    0x325f(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     cce:	48 89 d6             	mov    %rdx,%rsi
+     cd1:	89 c7                	mov    %eax,%edi
+     cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd8:	e8 c4 15 00 00       	call   22a1 <printf>
+     cdd:	e8 ef 1b 00 00       	call   28d1 <exit>
+    }
+
+    if (pid == 0) {
+     ce2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+     ce6:	0f 85 39 01 00 00    	jne    e25 <fourfiles+0x21d>
+      fd = open(fname, O_CREATE | O_RDWR);
+     cec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     cf0:	be 02 02 00 00       	mov    $0x202,%esi
+     cf5:	48 89 c7             	mov    %rax,%rdi
+     cf8:	e8 b0 26 00 00       	call   33ad <open>
+     cfd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+      if (fd < 0) {
+     d00:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     d04:	79 5e                	jns    d64 <fourfiles+0x15c>
+        error("create failed\n");
+     d06:	8b 05 f4 42 00 00    	mov    0x42f4(%rip),%eax        # 5000 <stdout>
+     d0c:	ba c3 00 00 00       	mov    $0xc3,%edx
+     d11:	48 8d 0d d2 31 00 00 	lea    0x31d2(%rip),%rcx        # 3eea <benchreport+0x17c>
+     d18:	48 89 ce             	mov    %rcx,%rsi
+     d1b:	89 c7                	mov    %eax,%edi
+     d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d22:	e8 7a 15 00 00       	call   22a1 <printf>
+     d27:	8b 05 d3 42 00 00    	mov    0x42d3(%rip),%eax        # 5000 <stdout>
+     d2d:	48 8d 15 04 35 00 00 	lea    0x3504(%rip),%rdx        # 4238 <benchreport+0x4ca>
+     d34:	48 89 d6             	mov    %rdx,%rsi
+     d37:	89 c7                	mov    %eax,%edi
+     d39:	b8 00 00 00 00       	mov    $0x0,%eax
+     d3e:	e8 5e 15 00 00       	call   22a1 <printf>
+     d43:	8b 05 b7 42 00 00    	mov    0x42b7(%rip),%eax        # 5000 <stdout>
+     d49:	48 8d 15 dd 31 00 00 	lea    0x31dd(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     d50:	48 89 d6             	mov    %rdx,%rsi
+     d53:	89 c7                	mov    %eax,%edi
+     d55:	b8 00 00 00 00       	mov    $0x0,%eax
+     d5a:	e8 42 15 00 00       	call   22a1 <printf>
+     d5f:	e8 6d 1b 00 00       	call   28d1 <exit>
+      }
+      memset(buf, '0' + pi, 512);
+     d64:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d67:	83 c0 30             	add    $0x30,%eax
+     d6a:	ba 00 02 00 00       	mov    $0x200,%edx
+     d6f:	89 c6                	mov    %eax,%esi
+     d71:	48 8d 05 e8 42 00 00 	lea    0x42e8(%rip),%rax        # 5060 <buf>
+     d78:	48 89 c7             	mov    %rax,%rdi
+     d7b:	e8 43 1f 00 00       	call   2cc3 <memset>
+      for (i = 0; i < 12; i++) {
+     d80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d87:	e9 8a 00 00 00       	jmp    e16 <fourfiles+0x20e>
+        if ((n = write(fd, buf, 500)) != 500) {
+     d8c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     d8f:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     d94:	48 8d 0d c5 42 00 00 	lea    0x42c5(%rip),%rcx        # 5060 <buf>
+     d9b:	48 89 ce             	mov    %rcx,%rsi
+     d9e:	89 c7                	mov    %eax,%edi
+     da0:	e8 dc 25 00 00       	call   3381 <write>
+     da5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+     da8:	81 7d d8 f4 01 00 00 	cmpl   $0x1f4,-0x28(%rbp)
+     daf:	74 61                	je     e12 <fourfiles+0x20a>
+          error("write failed %d\n", n);
+     db1:	8b 05 49 42 00 00    	mov    0x4249(%rip),%eax        # 5000 <stdout>
+     db7:	ba c8 00 00 00       	mov    $0xc8,%edx
+     dbc:	48 8d 0d 27 31 00 00 	lea    0x3127(%rip),%rcx        # 3eea <benchreport+0x17c>
+     dc3:	48 89 ce             	mov    %rcx,%rsi
+     dc6:	89 c7                	mov    %eax,%edi
+     dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+     dcd:	e8 cf 14 00 00       	call   22a1 <printf>
+     dd2:	8b 05 28 42 00 00    	mov    0x4228(%rip),%eax        # 5000 <stdout>
+     dd8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     ddb:	48 8d 0d 65 34 00 00 	lea    0x3465(%rip),%rcx        # 4247 <benchreport+0x4d9>
+     de2:	48 89 ce             	mov    %rcx,%rsi
+     de5:	89 c7                	mov    %eax,%edi
+     de7:	b8 00 00 00 00       	mov    $0x0,%eax
+     dec:	e8 b0 14 00 00       	call   22a1 <printf>
+     df1:	8b 05 09 42 00 00    	mov    0x4209(%rip),%eax        # 5000 <stdout>
+     df7:	48 8d 15 2f 31 00 00 	lea    0x312f(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     dfe:	48 89 d6             	mov    %rdx,%rsi
+     e01:	89 c7                	mov    %eax,%edi
+     e03:	b8 00 00 00 00       	mov    $0x0,%eax
+     e08:	e8 94 14 00 00       	call   22a1 <printf>
+     e0d:	e8 bf 1a 00 00       	call   28d1 <exit>
+      for (i = 0; i < 12; i++) {
+     e12:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e16:	83 7d fc 0b          	cmpl   $0xb,-0x4(%rbp)
+     e1a:	0f 8e 6c ff ff ff    	jle    d8c <fourfiles+0x184>
+        }
+      }
+      exit();
+     e20:	e8 ac 1a 00 00       	call   28d1 <exit>
+  for (pi = 0; pi < num; pi++) {
+     e25:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+     e29:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e2c:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     e2f:	0f 8c 33 fe ff ff    	jl     c68 <fourfiles+0x60>
+    }
+  }
+
+  for (pi = 0; pi < num; pi++) {
+     e35:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+     e3c:	eb 09                	jmp    e47 <fourfiles+0x23f>
+    wait();
+     e3e:	e8 1d 25 00 00       	call   3360 <wait>
+  for (pi = 0; pi < num; pi++) {
+     e43:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+     e47:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e4a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     e4d:	7c ef                	jl     e3e <fourfiles+0x236>
+  }
+
+  for (i = 0; i < num; i++) {
+     e4f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e56:	e9 ef 01 00 00       	jmp    104a <fourfiles+0x442>
+    fname = names[i];
+     e5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e5e:	48 98                	cltq
+     e60:	48 8b 44 c5 b0       	mov    -0x50(%rbp,%rax,8),%rax
+     e65:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    fd = open(fname, O_RDONLY);
+     e69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e6d:	be 00 00 00 00       	mov    $0x0,%esi
+     e72:	48 89 c7             	mov    %rax,%rdi
+     e75:	e8 33 25 00 00       	call   33ad <open>
+     e7a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (fd < 0) {
+     e7d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e81:	79 62                	jns    ee5 <fourfiles+0x2dd>
+      error("file open failed for fname=%s\n", fname);
+     e83:	8b 05 77 41 00 00    	mov    0x4177(%rip),%eax        # 5000 <stdout>
+     e89:	ba d7 00 00 00       	mov    $0xd7,%edx
+     e8e:	48 8d 0d 55 30 00 00 	lea    0x3055(%rip),%rcx        # 3eea <benchreport+0x17c>
+     e95:	48 89 ce             	mov    %rcx,%rsi
+     e98:	89 c7                	mov    %eax,%edi
+     e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e9f:	e8 fd 13 00 00       	call   22a1 <printf>
+     ea4:	8b 05 56 41 00 00    	mov    0x4156(%rip),%eax        # 5000 <stdout>
+     eaa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     eae:	48 8d 0d a3 33 00 00 	lea    0x33a3(%rip),%rcx        # 4258 <benchreport+0x4ea>
+     eb5:	48 89 ce             	mov    %rcx,%rsi
+     eb8:	89 c7                	mov    %eax,%edi
+     eba:	b8 00 00 00 00       	mov    $0x0,%eax
+     ebf:	e8 dd 13 00 00       	call   22a1 <printf>
+     ec4:	8b 05 36 41 00 00    	mov    0x4136(%rip),%eax        # 5000 <stdout>
+     eca:	48 8d 15 5c 30 00 00 	lea    0x305c(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     ed1:	48 89 d6             	mov    %rdx,%rsi
+     ed4:	89 c7                	mov    %eax,%edi
+     ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+     edb:	e8 c1 13 00 00       	call   22a1 <printf>
+     ee0:	e8 ec 19 00 00       	call   28d1 <exit>
+    }
+    total = 0;
+     ee5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+     eec:	e9 b3 00 00 00       	jmp    fa4 <fourfiles+0x39c>
+      for (j = 0; j < n; j++) {
+     ef1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     ef8:	e9 95 00 00 00       	jmp    f92 <fourfiles+0x38a>
+        if (buf[j] != '0' + i) {
+     efd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f00:	48 98                	cltq
+     f02:	48 8d 15 57 41 00 00 	lea    0x4157(%rip),%rdx        # 5060 <buf>
+     f09:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     f0d:	0f be d0             	movsbl %al,%edx
+     f10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f13:	83 c0 30             	add    $0x30,%eax
+     f16:	39 c2                	cmp    %eax,%edx
+     f18:	74 74                	je     f8e <fourfiles+0x386>
+          error("wrong char, was %d should be %d\n", buf[j], '0' + i);
+     f1a:	8b 05 e0 40 00 00    	mov    0x40e0(%rip),%eax        # 5000 <stdout>
+     f20:	ba dd 00 00 00       	mov    $0xdd,%edx
+     f25:	48 8d 0d be 2f 00 00 	lea    0x2fbe(%rip),%rcx        # 3eea <benchreport+0x17c>
+     f2c:	48 89 ce             	mov    %rcx,%rsi
+     f2f:	89 c7                	mov    %eax,%edi
+     f31:	b8 00 00 00 00       	mov    $0x0,%eax
+     f36:	e8 66 13 00 00       	call   22a1 <printf>
+     f3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f3e:	8d 48 30             	lea    0x30(%rax),%ecx
+     f41:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f44:	48 98                	cltq
+     f46:	48 8d 15 13 41 00 00 	lea    0x4113(%rip),%rdx        # 5060 <buf>
+     f4d:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     f51:	0f be d0             	movsbl %al,%edx
+     f54:	8b 05 a6 40 00 00    	mov    0x40a6(%rip),%eax        # 5000 <stdout>
+     f5a:	48 8d 35 17 33 00 00 	lea    0x3317(%rip),%rsi        # 4278 <benchreport+0x50a>
+     f61:	89 c7                	mov    %eax,%edi
+     f63:	b8 00 00 00 00       	mov    $0x0,%eax
+     f68:	e8 34 13 00 00       	call   22a1 <printf>
+     f6d:	8b 05 8d 40 00 00    	mov    0x408d(%rip),%eax        # 5000 <stdout>
+     f73:	48 8d 15 b3 2f 00 00 	lea    0x2fb3(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+     f7a:	48 89 d6             	mov    %rdx,%rsi
+     f7d:	89 c7                	mov    %eax,%edi
+     f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f84:	e8 18 13 00 00       	call   22a1 <printf>
+     f89:	e8 43 19 00 00       	call   28d1 <exit>
+      for (j = 0; j < n; j++) {
+     f8e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     f92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f95:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     f98:	0f 8c 5f ff ff ff    	jl     efd <fourfiles+0x2f5>
+        }
+      }
+      total += n;
+     f9e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     fa1:	01 45 f4             	add    %eax,-0xc(%rbp)
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+     fa4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fa7:	ba 00 20 00 00       	mov    $0x2000,%edx
+     fac:	48 8d 0d ad 40 00 00 	lea    0x40ad(%rip),%rcx        # 5060 <buf>
+     fb3:	48 89 ce             	mov    %rcx,%rsi
+     fb6:	89 c7                	mov    %eax,%edi
+     fb8:	e8 b9 23 00 00       	call   3376 <read>
+     fbd:	89 45 d8             	mov    %eax,-0x28(%rbp)
+     fc0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     fc4:	0f 8f 27 ff ff ff    	jg     ef1 <fourfiles+0x2e9>
+    }
+    close(fd);
+     fca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fcd:	89 c7                	mov    %eax,%edi
+     fcf:	e8 67 19 00 00       	call   293b <close>
+    if (total != 12 * 500) {
+     fd4:	81 7d f4 70 17 00 00 	cmpl   $0x1770,-0xc(%rbp)
+     fdb:	74 69                	je     1046 <fourfiles+0x43e>
+      error("wrong length i:%d, wanted:%d, %d\n", i, 12 * 500, total);
+     fdd:	8b 05 1d 40 00 00    	mov    0x401d(%rip),%eax        # 5000 <stdout>
+     fe3:	ba e4 00 00 00       	mov    $0xe4,%edx
+     fe8:	48 8d 0d fb 2e 00 00 	lea    0x2efb(%rip),%rcx        # 3eea <benchreport+0x17c>
+     fef:	48 89 ce             	mov    %rcx,%rsi
+     ff2:	89 c7                	mov    %eax,%edi
+     ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff9:	e8 a3 12 00 00       	call   22a1 <printf>
+     ffe:	8b 05 fc 3f 00 00    	mov    0x3ffc(%rip),%eax        # 5000 <stdout>
+    1004:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1007:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    100a:	41 89 c8             	mov    %ecx,%r8d
+    100d:	b9 70 17 00 00       	mov    $0x1770,%ecx
+    1012:	48 8d 35 87 32 00 00 	lea    0x3287(%rip),%rsi        # 42a0 <benchreport+0x532>
+    1019:	89 c7                	mov    %eax,%edi
+    101b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1020:	e8 7c 12 00 00       	call   22a1 <printf>
+    1025:	8b 05 d5 3f 00 00    	mov    0x3fd5(%rip),%eax        # 5000 <stdout>
+    102b:	48 8d 15 fb 2e 00 00 	lea    0x2efb(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1032:	48 89 d6             	mov    %rdx,%rsi
+    1035:	89 c7                	mov    %eax,%edi
+    1037:	b8 00 00 00 00       	mov    $0x0,%eax
+    103c:	e8 60 12 00 00       	call   22a1 <printf>
+    1041:	e8 8b 18 00 00       	call   28d1 <exit>
+  for (i = 0; i < num; i++) {
+    1046:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    104a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    104d:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1050:	0f 8c 05 fe ff ff    	jl     e5b <fourfiles+0x253>
+    }
+  }
+
+  printf(1, "fourfiles ok\n");
+    1056:	48 8d 05 65 32 00 00 	lea    0x3265(%rip),%rax        # 42c2 <benchreport+0x554>
+    105d:	48 89 c6             	mov    %rax,%rsi
+    1060:	bf 01 00 00 00       	mov    $0x1,%edi
+    1065:	b8 00 00 00 00       	mov    $0x0,%eax
+    106a:	e8 32 12 00 00       	call   22a1 <printf>
+}
+    106f:	90                   	nop
+    1070:	c9                   	leave
+    1071:	c3                   	ret
+
+0000000000001072 <simpledelete>:
+
+void simpledelete() {
+    1072:	55                   	push   %rbp
+    1073:	48 89 e5             	mov    %rsp,%rbp
+    1076:	48 83 ec 70          	sub    $0x70,%rsp
+  printf(1, "Starting delete test...\n");
+    107a:	48 8d 05 4f 32 00 00 	lea    0x324f(%rip),%rax        # 42d0 <benchreport+0x562>
+    1081:	48 89 c6             	mov    %rax,%rsi
+    1084:	bf 01 00 00 00       	mov    $0x1,%edi
+    1089:	b8 00 00 00 00       	mov    $0x0,%eax
+    108e:	e8 0e 12 00 00       	call   22a1 <printf>
+  // Check a couple cases of things you should never be able to delete
+  if (unlink("file_not_existing") != -1) {
+    1093:	48 8d 05 4f 32 00 00 	lea    0x324f(%rip),%rax        # 42e9 <benchreport+0x57b>
+    109a:	48 89 c7             	mov    %rax,%rdi
+    109d:	e8 21 23 00 00       	call   33c3 <unlink>
+    10a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10a5:	74 5e                	je     1105 <simpledelete+0x93>
+    error("Able to delete file that doesn't exist");
+    10a7:	8b 05 53 3f 00 00    	mov    0x3f53(%rip),%eax        # 5000 <stdout>
+    10ad:	ba ef 00 00 00       	mov    $0xef,%edx
+    10b2:	48 8d 0d 31 2e 00 00 	lea    0x2e31(%rip),%rcx        # 3eea <benchreport+0x17c>
+    10b9:	48 89 ce             	mov    %rcx,%rsi
+    10bc:	89 c7                	mov    %eax,%edi
+    10be:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c3:	e8 d9 11 00 00       	call   22a1 <printf>
+    10c8:	8b 05 32 3f 00 00    	mov    0x3f32(%rip),%eax        # 5000 <stdout>
+    10ce:	48 8d 15 2b 32 00 00 	lea    0x322b(%rip),%rdx        # 4300 <benchreport+0x592>
+    10d5:	48 89 d6             	mov    %rdx,%rsi
+    10d8:	89 c7                	mov    %eax,%edi
+    10da:	b8 00 00 00 00       	mov    $0x0,%eax
+    10df:	e8 bd 11 00 00       	call   22a1 <printf>
+    10e4:	8b 05 16 3f 00 00    	mov    0x3f16(%rip),%eax        # 5000 <stdout>
+    10ea:	48 8d 15 3c 2e 00 00 	lea    0x2e3c(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    10f1:	48 89 d6             	mov    %rdx,%rsi
+    10f4:	89 c7                	mov    %eax,%edi
+    10f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    10fb:	e8 a1 11 00 00       	call   22a1 <printf>
+    1100:	e8 cc 17 00 00       	call   28d1 <exit>
+  }
+  if (unlink("..") != -1 || unlink(".") != -1)
+    1105:	48 8d 05 1b 32 00 00 	lea    0x321b(%rip),%rax        # 4327 <benchreport+0x5b9>
+    110c:	48 89 c7             	mov    %rax,%rdi
+    110f:	e8 af 22 00 00       	call   33c3 <unlink>
+    1114:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1117:	75 14                	jne    112d <simpledelete+0xbb>
+    1119:	48 8d 05 0a 32 00 00 	lea    0x320a(%rip),%rax        # 432a <benchreport+0x5bc>
+    1120:	48 89 c7             	mov    %rax,%rdi
+    1123:	e8 9b 22 00 00       	call   33c3 <unlink>
+    1128:	83 f8 ff             	cmp    $0xffffffff,%eax
+    112b:	74 5e                	je     118b <simpledelete+0x119>
+    error("Able to unlink directories");
+    112d:	8b 05 cd 3e 00 00    	mov    0x3ecd(%rip),%eax        # 5000 <stdout>
+    1133:	ba f2 00 00 00       	mov    $0xf2,%edx
+    1138:	48 8d 0d ab 2d 00 00 	lea    0x2dab(%rip),%rcx        # 3eea <benchreport+0x17c>
+    113f:	48 89 ce             	mov    %rcx,%rsi
+    1142:	89 c7                	mov    %eax,%edi
+    1144:	b8 00 00 00 00       	mov    $0x0,%eax
+    1149:	e8 53 11 00 00       	call   22a1 <printf>
+    114e:	8b 05 ac 3e 00 00    	mov    0x3eac(%rip),%eax        # 5000 <stdout>
+    1154:	48 8d 15 d1 31 00 00 	lea    0x31d1(%rip),%rdx        # 432c <benchreport+0x5be>
+    115b:	48 89 d6             	mov    %rdx,%rsi
+    115e:	89 c7                	mov    %eax,%edi
+    1160:	b8 00 00 00 00       	mov    $0x0,%eax
+    1165:	e8 37 11 00 00       	call   22a1 <printf>
+    116a:	8b 05 90 3e 00 00    	mov    0x3e90(%rip),%eax        # 5000 <stdout>
+    1170:	48 8d 15 b6 2d 00 00 	lea    0x2db6(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1177:	48 89 d6             	mov    %rdx,%rsi
+    117a:	89 c7                	mov    %eax,%edi
+    117c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1181:	e8 1b 11 00 00       	call   22a1 <printf>
+    1186:	e8 46 17 00 00       	call   28d1 <exit>
+
+  // Can't delete open file (in this process or another)
+  char* name = "some_other_file";
+    118b:	48 8d 05 b5 31 00 00 	lea    0x31b5(%rip),%rax        # 4347 <benchreport+0x5d9>
+    1192:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int fd = open(name, O_RDWR | O_CREATE);
+    1196:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    119a:	be 02 02 00 00       	mov    $0x202,%esi
+    119f:	48 89 c7             	mov    %rax,%rdi
+    11a2:	e8 06 22 00 00       	call   33ad <open>
+    11a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1)
+    11aa:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    11ae:	75 5e                	jne    120e <simpledelete+0x19c>
+    error("Unable to create file");
+    11b0:	8b 05 4a 3e 00 00    	mov    0x3e4a(%rip),%eax        # 5000 <stdout>
+    11b6:	ba f8 00 00 00       	mov    $0xf8,%edx
+    11bb:	48 8d 0d 28 2d 00 00 	lea    0x2d28(%rip),%rcx        # 3eea <benchreport+0x17c>
+    11c2:	48 89 ce             	mov    %rcx,%rsi
+    11c5:	89 c7                	mov    %eax,%edi
+    11c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cc:	e8 d0 10 00 00       	call   22a1 <printf>
+    11d1:	8b 05 29 3e 00 00    	mov    0x3e29(%rip),%eax        # 5000 <stdout>
+    11d7:	48 8d 15 79 31 00 00 	lea    0x3179(%rip),%rdx        # 4357 <benchreport+0x5e9>
+    11de:	48 89 d6             	mov    %rdx,%rsi
+    11e1:	89 c7                	mov    %eax,%edi
+    11e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11e8:	e8 b4 10 00 00       	call   22a1 <printf>
+    11ed:	8b 05 0d 3e 00 00    	mov    0x3e0d(%rip),%eax        # 5000 <stdout>
+    11f3:	48 8d 15 33 2d 00 00 	lea    0x2d33(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    11fa:	48 89 d6             	mov    %rdx,%rsi
+    11fd:	89 c7                	mov    %eax,%edi
+    11ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1204:	e8 98 10 00 00       	call   22a1 <printf>
+    1209:	e8 c3 16 00 00       	call   28d1 <exit>
+  if (unlink(name) != -1)
+    120e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1212:	48 89 c7             	mov    %rax,%rdi
+    1215:	e8 a9 21 00 00       	call   33c3 <unlink>
+    121a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    121d:	74 5e                	je     127d <simpledelete+0x20b>
+    error("Able to delete file that's currently open");
+    121f:	8b 05 db 3d 00 00    	mov    0x3ddb(%rip),%eax        # 5000 <stdout>
+    1225:	ba fa 00 00 00       	mov    $0xfa,%edx
+    122a:	48 8d 0d b9 2c 00 00 	lea    0x2cb9(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1231:	48 89 ce             	mov    %rcx,%rsi
+    1234:	89 c7                	mov    %eax,%edi
+    1236:	b8 00 00 00 00       	mov    $0x0,%eax
+    123b:	e8 61 10 00 00       	call   22a1 <printf>
+    1240:	8b 05 ba 3d 00 00    	mov    0x3dba(%rip),%eax        # 5000 <stdout>
+    1246:	48 8d 15 23 31 00 00 	lea    0x3123(%rip),%rdx        # 4370 <benchreport+0x602>
+    124d:	48 89 d6             	mov    %rdx,%rsi
+    1250:	89 c7                	mov    %eax,%edi
+    1252:	b8 00 00 00 00       	mov    $0x0,%eax
+    1257:	e8 45 10 00 00       	call   22a1 <printf>
+    125c:	8b 05 9e 3d 00 00    	mov    0x3d9e(%rip),%eax        # 5000 <stdout>
+    1262:	48 8d 15 c4 2c 00 00 	lea    0x2cc4(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1269:	48 89 d6             	mov    %rdx,%rsi
+    126c:	89 c7                	mov    %eax,%edi
+    126e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1273:	e8 29 10 00 00       	call   22a1 <printf>
+    1278:	e8 54 16 00 00       	call   28d1 <exit>
+  if (close(fd) == -1)
+    127d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1280:	89 c7                	mov    %eax,%edi
+    1282:	e8 b4 16 00 00       	call   293b <close>
+    1287:	83 f8 ff             	cmp    $0xffffffff,%eax
+    128a:	75 5e                	jne    12ea <simpledelete+0x278>
+      error("Unable to close file");
+    128c:	8b 05 6e 3d 00 00    	mov    0x3d6e(%rip),%eax        # 5000 <stdout>
+    1292:	ba fc 00 00 00       	mov    $0xfc,%edx
+    1297:	48 8d 0d 4c 2c 00 00 	lea    0x2c4c(%rip),%rcx        # 3eea <benchreport+0x17c>
+    129e:	48 89 ce             	mov    %rcx,%rsi
+    12a1:	89 c7                	mov    %eax,%edi
+    12a3:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a8:	e8 f4 0f 00 00       	call   22a1 <printf>
+    12ad:	8b 05 4d 3d 00 00    	mov    0x3d4d(%rip),%eax        # 5000 <stdout>
+    12b3:	48 8d 15 e0 30 00 00 	lea    0x30e0(%rip),%rdx        # 439a <benchreport+0x62c>
+    12ba:	48 89 d6             	mov    %rdx,%rsi
+    12bd:	89 c7                	mov    %eax,%edi
+    12bf:	b8 00 00 00 00       	mov    $0x0,%eax
+    12c4:	e8 d8 0f 00 00       	call   22a1 <printf>
+    12c9:	8b 05 31 3d 00 00    	mov    0x3d31(%rip),%eax        # 5000 <stdout>
+    12cf:	48 8d 15 57 2c 00 00 	lea    0x2c57(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    12d6:	48 89 d6             	mov    %rdx,%rsi
+    12d9:	89 c7                	mov    %eax,%edi
+    12db:	b8 00 00 00 00       	mov    $0x0,%eax
+    12e0:	e8 bc 0f 00 00       	call   22a1 <printf>
+    12e5:	e8 e7 15 00 00       	call   28d1 <exit>
+
+  int pid = fork();
+    12ea:	e8 d2 15 00 00       	call   28c1 <fork>
+    12ef:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  if (pid == 0) {
+    12f2:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+    12f6:	75 20                	jne    1318 <simpledelete+0x2a6>
+    open(name, O_RDWR);
+    12f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12fc:	be 02 00 00 00       	mov    $0x2,%esi
+    1301:	48 89 c7             	mov    %rax,%rdi
+    1304:	e8 a4 20 00 00       	call   33ad <open>
+    sleep(999999999);
+    1309:	bf ff c9 9a 3b       	mov    $0x3b9ac9ff,%edi
+    130e:	e8 08 21 00 00       	call   341b <sleep>
+    exit();
+    1313:	e8 b9 15 00 00       	call   28d1 <exit>
+  } else {
+    sleep(20); // Should be enough time
+    1318:	bf 14 00 00 00       	mov    $0x14,%edi
+    131d:	e8 f9 20 00 00       	call   341b <sleep>
+    if (unlink(name) != -1)
+    1322:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1326:	48 89 c7             	mov    %rax,%rdi
+    1329:	e8 95 20 00 00       	call   33c3 <unlink>
+    132e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1331:	74 5e                	je     1391 <simpledelete+0x31f>
+      error("Able to delete file that's open in another process");
+    1333:	8b 05 c7 3c 00 00    	mov    0x3cc7(%rip),%eax        # 5000 <stdout>
+    1339:	ba 06 01 00 00       	mov    $0x106,%edx
+    133e:	48 8d 0d a5 2b 00 00 	lea    0x2ba5(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1345:	48 89 ce             	mov    %rcx,%rsi
+    1348:	89 c7                	mov    %eax,%edi
+    134a:	b8 00 00 00 00       	mov    $0x0,%eax
+    134f:	e8 4d 0f 00 00       	call   22a1 <printf>
+    1354:	8b 05 a6 3c 00 00    	mov    0x3ca6(%rip),%eax        # 5000 <stdout>
+    135a:	48 8d 15 4f 30 00 00 	lea    0x304f(%rip),%rdx        # 43b0 <benchreport+0x642>
+    1361:	48 89 d6             	mov    %rdx,%rsi
+    1364:	89 c7                	mov    %eax,%edi
+    1366:	b8 00 00 00 00       	mov    $0x0,%eax
+    136b:	e8 31 0f 00 00       	call   22a1 <printf>
+    1370:	8b 05 8a 3c 00 00    	mov    0x3c8a(%rip),%eax        # 5000 <stdout>
+    1376:	48 8d 15 b0 2b 00 00 	lea    0x2bb0(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    137d:	48 89 d6             	mov    %rdx,%rsi
+    1380:	89 c7                	mov    %eax,%edi
+    1382:	b8 00 00 00 00       	mov    $0x0,%eax
+    1387:	e8 15 0f 00 00       	call   22a1 <printf>
+    138c:	e8 40 15 00 00       	call   28d1 <exit>
+    kill(pid);
+    1391:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1394:	89 c7                	mov    %eax,%edi
+    1396:	e8 fc 1f 00 00       	call   3397 <kill>
+    wait();
+    139b:	e8 c0 1f 00 00       	call   3360 <wait>
+  }
+  if (unlink(name) == -1)
+    13a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13a4:	48 89 c7             	mov    %rax,%rdi
+    13a7:	e8 17 20 00 00       	call   33c3 <unlink>
+    13ac:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13af:	75 5e                	jne    140f <simpledelete+0x39d>
+    error("Unable to delete file once all references closed");
+    13b1:	8b 05 49 3c 00 00    	mov    0x3c49(%rip),%eax        # 5000 <stdout>
+    13b7:	ba 0b 01 00 00       	mov    $0x10b,%edx
+    13bc:	48 8d 0d 27 2b 00 00 	lea    0x2b27(%rip),%rcx        # 3eea <benchreport+0x17c>
+    13c3:	48 89 ce             	mov    %rcx,%rsi
+    13c6:	89 c7                	mov    %eax,%edi
+    13c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13cd:	e8 cf 0e 00 00       	call   22a1 <printf>
+    13d2:	8b 05 28 3c 00 00    	mov    0x3c28(%rip),%eax        # 5000 <stdout>
+    13d8:	48 8d 15 09 30 00 00 	lea    0x3009(%rip),%rdx        # 43e8 <benchreport+0x67a>
+    13df:	48 89 d6             	mov    %rdx,%rsi
+    13e2:	89 c7                	mov    %eax,%edi
+    13e4:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e9:	e8 b3 0e 00 00       	call   22a1 <printf>
+    13ee:	8b 05 0c 3c 00 00    	mov    0x3c0c(%rip),%eax        # 5000 <stdout>
+    13f4:	48 8d 15 32 2b 00 00 	lea    0x2b32(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    13fb:	48 89 d6             	mov    %rdx,%rsi
+    13fe:	89 c7                	mov    %eax,%edi
+    1400:	b8 00 00 00 00       	mov    $0x0,%eax
+    1405:	e8 97 0e 00 00       	call   22a1 <printf>
+    140a:	e8 c2 14 00 00       	call   28d1 <exit>
+  if (open(name, O_RDWR) != -1)
+    140f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1413:	be 02 00 00 00       	mov    $0x2,%esi
+    1418:	48 89 c7             	mov    %rax,%rdi
+    141b:	e8 8d 1f 00 00       	call   33ad <open>
+    1420:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1423:	74 5e                	je     1483 <simpledelete+0x411>
+    error("Able to open already-deleted file");
+    1425:	8b 05 d5 3b 00 00    	mov    0x3bd5(%rip),%eax        # 5000 <stdout>
+    142b:	ba 0d 01 00 00       	mov    $0x10d,%edx
+    1430:	48 8d 0d b3 2a 00 00 	lea    0x2ab3(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1437:	48 89 ce             	mov    %rcx,%rsi
+    143a:	89 c7                	mov    %eax,%edi
+    143c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1441:	e8 5b 0e 00 00       	call   22a1 <printf>
+    1446:	8b 05 b4 3b 00 00    	mov    0x3bb4(%rip),%eax        # 5000 <stdout>
+    144c:	48 8d 15 cd 2f 00 00 	lea    0x2fcd(%rip),%rdx        # 4420 <benchreport+0x6b2>
+    1453:	48 89 d6             	mov    %rdx,%rsi
+    1456:	89 c7                	mov    %eax,%edi
+    1458:	b8 00 00 00 00       	mov    $0x0,%eax
+    145d:	e8 3f 0e 00 00       	call   22a1 <printf>
+    1462:	8b 05 98 3b 00 00    	mov    0x3b98(%rip),%eax        # 5000 <stdout>
+    1468:	48 8d 15 be 2a 00 00 	lea    0x2abe(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    146f:	48 89 d6             	mov    %rdx,%rsi
+    1472:	89 c7                	mov    %eax,%edi
+    1474:	b8 00 00 00 00       	mov    $0x0,%eax
+    1479:	e8 23 0e 00 00       	call   22a1 <printf>
+    147e:	e8 4e 14 00 00       	call   28d1 <exit>
+
+  printf(1, "delete open ok\n");
+    1483:	48 8d 05 b8 2f 00 00 	lea    0x2fb8(%rip),%rax        # 4442 <benchreport+0x6d4>
+    148a:	48 89 c6             	mov    %rax,%rsi
+    148d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1492:	b8 00 00 00 00       	mov    $0x0,%eax
+    1497:	e8 05 0e 00 00       	call   22a1 <printf>
+
+  // Make sure deleting one file doesn't interfere with other open ones
+  char* n1 = "small.txt";
+    149c:	48 8d 05 3d 2a 00 00 	lea    0x2a3d(%rip),%rax        # 3ee0 <benchreport+0x172>
+    14a3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  char* n2 = "arbitrary";
+    14a7:	48 8d 05 a4 2f 00 00 	lea    0x2fa4(%rip),%rax        # 4452 <benchreport+0x6e4>
+    14ae:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  int fdn1 = open(n1, O_RDWR);
+    14b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14b6:	be 02 00 00 00       	mov    $0x2,%esi
+    14bb:	48 89 c7             	mov    %rax,%rdi
+    14be:	e8 ea 1e 00 00       	call   33ad <open>
+    14c3:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  int fdn2 = open(n2, O_RDWR | O_CREATE);
+    14c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    14ca:	be 02 02 00 00       	mov    $0x202,%esi
+    14cf:	48 89 c7             	mov    %rax,%rdi
+    14d2:	e8 d6 1e 00 00       	call   33ad <open>
+    14d7:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  if (fdn1 == -1 || fdn2 == -1)
+    14da:	83 7d d4 ff          	cmpl   $0xffffffff,-0x2c(%rbp)
+    14de:	74 06                	je     14e6 <simpledelete+0x474>
+    14e0:	83 7d d0 ff          	cmpl   $0xffffffff,-0x30(%rbp)
+    14e4:	75 5e                	jne    1544 <simpledelete+0x4d2>
+    error("error opening files");
+    14e6:	8b 05 14 3b 00 00    	mov    0x3b14(%rip),%eax        # 5000 <stdout>
+    14ec:	ba 17 01 00 00       	mov    $0x117,%edx
+    14f1:	48 8d 0d f2 29 00 00 	lea    0x29f2(%rip),%rcx        # 3eea <benchreport+0x17c>
+    14f8:	48 89 ce             	mov    %rcx,%rsi
+    14fb:	89 c7                	mov    %eax,%edi
+    14fd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1502:	e8 9a 0d 00 00       	call   22a1 <printf>
+    1507:	8b 05 f3 3a 00 00    	mov    0x3af3(%rip),%eax        # 5000 <stdout>
+    150d:	48 8d 15 48 2f 00 00 	lea    0x2f48(%rip),%rdx        # 445c <benchreport+0x6ee>
+    1514:	48 89 d6             	mov    %rdx,%rsi
+    1517:	89 c7                	mov    %eax,%edi
+    1519:	b8 00 00 00 00       	mov    $0x0,%eax
+    151e:	e8 7e 0d 00 00       	call   22a1 <printf>
+    1523:	8b 05 d7 3a 00 00    	mov    0x3ad7(%rip),%eax        # 5000 <stdout>
+    1529:	48 8d 15 fd 29 00 00 	lea    0x29fd(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1530:	48 89 d6             	mov    %rdx,%rsi
+    1533:	89 c7                	mov    %eax,%edi
+    1535:	b8 00 00 00 00       	mov    $0x0,%eax
+    153a:	e8 62 0d 00 00       	call   22a1 <printf>
+    153f:	e8 8d 13 00 00       	call   28d1 <exit>
+  if (close(fdn2) == -1)
+    1544:	8b 45 d0             	mov    -0x30(%rbp),%eax
+    1547:	89 c7                	mov    %eax,%edi
+    1549:	e8 ed 13 00 00       	call   293b <close>
+    154e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1551:	75 5e                	jne    15b1 <simpledelete+0x53f>
+    error("error closing arbitrary");
+    1553:	8b 05 a7 3a 00 00    	mov    0x3aa7(%rip),%eax        # 5000 <stdout>
+    1559:	ba 19 01 00 00       	mov    $0x119,%edx
+    155e:	48 8d 0d 85 29 00 00 	lea    0x2985(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1565:	48 89 ce             	mov    %rcx,%rsi
+    1568:	89 c7                	mov    %eax,%edi
+    156a:	b8 00 00 00 00       	mov    $0x0,%eax
+    156f:	e8 2d 0d 00 00       	call   22a1 <printf>
+    1574:	8b 05 86 3a 00 00    	mov    0x3a86(%rip),%eax        # 5000 <stdout>
+    157a:	48 8d 15 ef 2e 00 00 	lea    0x2eef(%rip),%rdx        # 4470 <benchreport+0x702>
+    1581:	48 89 d6             	mov    %rdx,%rsi
+    1584:	89 c7                	mov    %eax,%edi
+    1586:	b8 00 00 00 00       	mov    $0x0,%eax
+    158b:	e8 11 0d 00 00       	call   22a1 <printf>
+    1590:	8b 05 6a 3a 00 00    	mov    0x3a6a(%rip),%eax        # 5000 <stdout>
+    1596:	48 8d 15 90 29 00 00 	lea    0x2990(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    159d:	48 89 d6             	mov    %rdx,%rsi
+    15a0:	89 c7                	mov    %eax,%edi
+    15a2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15a7:	e8 f5 0c 00 00       	call   22a1 <printf>
+    15ac:	e8 20 13 00 00       	call   28d1 <exit>
+  if (unlink(n2) == -1)
+    15b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15b5:	48 89 c7             	mov    %rax,%rdi
+    15b8:	e8 06 1e 00 00       	call   33c3 <unlink>
+    15bd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15c0:	75 5e                	jne    1620 <simpledelete+0x5ae>
+    error("error unlinking arbitrary");
+    15c2:	8b 05 38 3a 00 00    	mov    0x3a38(%rip),%eax        # 5000 <stdout>
+    15c8:	ba 1b 01 00 00       	mov    $0x11b,%edx
+    15cd:	48 8d 0d 16 29 00 00 	lea    0x2916(%rip),%rcx        # 3eea <benchreport+0x17c>
+    15d4:	48 89 ce             	mov    %rcx,%rsi
+    15d7:	89 c7                	mov    %eax,%edi
+    15d9:	b8 00 00 00 00       	mov    $0x0,%eax
+    15de:	e8 be 0c 00 00       	call   22a1 <printf>
+    15e3:	8b 05 17 3a 00 00    	mov    0x3a17(%rip),%eax        # 5000 <stdout>
+    15e9:	48 8d 15 98 2e 00 00 	lea    0x2e98(%rip),%rdx        # 4488 <benchreport+0x71a>
+    15f0:	48 89 d6             	mov    %rdx,%rsi
+    15f3:	89 c7                	mov    %eax,%edi
+    15f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    15fa:	e8 a2 0c 00 00       	call   22a1 <printf>
+    15ff:	8b 05 fb 39 00 00    	mov    0x39fb(%rip),%eax        # 5000 <stdout>
+    1605:	48 8d 15 21 29 00 00 	lea    0x2921(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    160c:	48 89 d6             	mov    %rdx,%rsi
+    160f:	89 c7                	mov    %eax,%edi
+    1611:	b8 00 00 00 00       	mov    $0x0,%eax
+    1616:	e8 86 0c 00 00       	call   22a1 <printf>
+    161b:	e8 b1 12 00 00       	call   28d1 <exit>
+  if (read(fdn1, buf, 62) == -1)
+    1620:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+    1623:	ba 3e 00 00 00       	mov    $0x3e,%edx
+    1628:	48 8d 0d 31 3a 00 00 	lea    0x3a31(%rip),%rcx        # 5060 <buf>
+    162f:	48 89 ce             	mov    %rcx,%rsi
+    1632:	89 c7                	mov    %eax,%edi
+    1634:	e8 3d 1d 00 00       	call   3376 <read>
+    1639:	83 f8 ff             	cmp    $0xffffffff,%eax
+    163c:	75 5e                	jne    169c <simpledelete+0x62a>
+    error("couldn't read from small after unlink");
+    163e:	8b 05 bc 39 00 00    	mov    0x39bc(%rip),%eax        # 5000 <stdout>
+    1644:	ba 1d 01 00 00       	mov    $0x11d,%edx
+    1649:	48 8d 0d 9a 28 00 00 	lea    0x289a(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1650:	48 89 ce             	mov    %rcx,%rsi
+    1653:	89 c7                	mov    %eax,%edi
+    1655:	b8 00 00 00 00       	mov    $0x0,%eax
+    165a:	e8 42 0c 00 00       	call   22a1 <printf>
+    165f:	8b 05 9b 39 00 00    	mov    0x399b(%rip),%eax        # 5000 <stdout>
+    1665:	48 8d 15 3c 2e 00 00 	lea    0x2e3c(%rip),%rdx        # 44a8 <benchreport+0x73a>
+    166c:	48 89 d6             	mov    %rdx,%rsi
+    166f:	89 c7                	mov    %eax,%edi
+    1671:	b8 00 00 00 00       	mov    $0x0,%eax
+    1676:	e8 26 0c 00 00       	call   22a1 <printf>
+    167b:	8b 05 7f 39 00 00    	mov    0x397f(%rip),%eax        # 5000 <stdout>
+    1681:	48 8d 15 a5 28 00 00 	lea    0x28a5(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1688:	48 89 d6             	mov    %rdx,%rsi
+    168b:	89 c7                	mov    %eax,%edi
+    168d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1692:	e8 0a 0c 00 00       	call   22a1 <printf>
+    1697:	e8 35 12 00 00       	call   28d1 <exit>
+  if (strcmp(buf, "lab5 is the last 451 lab, but this is just the beginning :(\n") != 0)
+    169c:	48 8d 05 4d 29 00 00 	lea    0x294d(%rip),%rax        # 3ff0 <benchreport+0x282>
+    16a3:	48 89 c6             	mov    %rax,%rsi
+    16a6:	48 8d 05 b3 39 00 00 	lea    0x39b3(%rip),%rax        # 5060 <buf>
+    16ad:	48 89 c7             	mov    %rax,%rdi
+    16b0:	e8 1f 15 00 00       	call   2bd4 <strcmp>
+    16b5:	85 c0                	test   %eax,%eax
+    16b7:	74 65                	je     171e <simpledelete+0x6ac>
+    error("file content did not match expected after unlink, was: '%s'", buf);
+    16b9:	8b 05 41 39 00 00    	mov    0x3941(%rip),%eax        # 5000 <stdout>
+    16bf:	ba 1f 01 00 00       	mov    $0x11f,%edx
+    16c4:	48 8d 0d 1f 28 00 00 	lea    0x281f(%rip),%rcx        # 3eea <benchreport+0x17c>
+    16cb:	48 89 ce             	mov    %rcx,%rsi
+    16ce:	89 c7                	mov    %eax,%edi
+    16d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    16d5:	e8 c7 0b 00 00       	call   22a1 <printf>
+    16da:	8b 05 20 39 00 00    	mov    0x3920(%rip),%eax        # 5000 <stdout>
+    16e0:	48 8d 15 79 39 00 00 	lea    0x3979(%rip),%rdx        # 5060 <buf>
+    16e7:	48 8d 0d e2 2d 00 00 	lea    0x2de2(%rip),%rcx        # 44d0 <benchreport+0x762>
+    16ee:	48 89 ce             	mov    %rcx,%rsi
+    16f1:	89 c7                	mov    %eax,%edi
+    16f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f8:	e8 a4 0b 00 00       	call   22a1 <printf>
+    16fd:	8b 05 fd 38 00 00    	mov    0x38fd(%rip),%eax        # 5000 <stdout>
+    1703:	48 8d 15 23 28 00 00 	lea    0x2823(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    170a:	48 89 d6             	mov    %rdx,%rsi
+    170d:	89 c7                	mov    %eax,%edi
+    170f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1714:	e8 88 0b 00 00       	call   22a1 <printf>
+    1719:	e8 b3 11 00 00       	call   28d1 <exit>
+
+  // Check inum usage/reuse and ordering
+  struct stat ss;
+  int fd1 = open("df1", O_RDWR | O_CREATE);
+    171e:	be 02 02 00 00       	mov    $0x202,%esi
+    1723:	48 8d 05 e2 2d 00 00 	lea    0x2de2(%rip),%rax        # 450c <benchreport+0x79e>
+    172a:	48 89 c7             	mov    %rax,%rdi
+    172d:	e8 7b 1c 00 00       	call   33ad <open>
+    1732:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  if (fd1 == -1)
+    1735:	83 7d cc ff          	cmpl   $0xffffffff,-0x34(%rbp)
+    1739:	75 5e                	jne    1799 <simpledelete+0x727>
+    error("Unable to open df1");
+    173b:	8b 05 bf 38 00 00    	mov    0x38bf(%rip),%eax        # 5000 <stdout>
+    1741:	ba 25 01 00 00       	mov    $0x125,%edx
+    1746:	48 8d 0d 9d 27 00 00 	lea    0x279d(%rip),%rcx        # 3eea <benchreport+0x17c>
+    174d:	48 89 ce             	mov    %rcx,%rsi
+    1750:	89 c7                	mov    %eax,%edi
+    1752:	b8 00 00 00 00       	mov    $0x0,%eax
+    1757:	e8 45 0b 00 00       	call   22a1 <printf>
+    175c:	8b 05 9e 38 00 00    	mov    0x389e(%rip),%eax        # 5000 <stdout>
+    1762:	48 8d 15 a7 2d 00 00 	lea    0x2da7(%rip),%rdx        # 4510 <benchreport+0x7a2>
+    1769:	48 89 d6             	mov    %rdx,%rsi
+    176c:	89 c7                	mov    %eax,%edi
+    176e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1773:	e8 29 0b 00 00       	call   22a1 <printf>
+    1778:	8b 05 82 38 00 00    	mov    0x3882(%rip),%eax        # 5000 <stdout>
+    177e:	48 8d 15 a8 27 00 00 	lea    0x27a8(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1785:	48 89 d6             	mov    %rdx,%rsi
+    1788:	89 c7                	mov    %eax,%edi
+    178a:	b8 00 00 00 00       	mov    $0x0,%eax
+    178f:	e8 0d 0b 00 00       	call   22a1 <printf>
+    1794:	e8 38 11 00 00       	call   28d1 <exit>
+  if (fstat(fd1, &ss) == -1)
+    1799:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    179d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    17a0:	48 89 d6             	mov    %rdx,%rsi
+    17a3:	89 c7                	mov    %eax,%edi
+    17a5:	e8 24 1c 00 00       	call   33ce <fstat>
+    17aa:	83 f8 ff             	cmp    $0xffffffff,%eax
+    17ad:	75 5e                	jne    180d <simpledelete+0x79b>
+    error("Unable to stat open df1");
+    17af:	8b 05 4b 38 00 00    	mov    0x384b(%rip),%eax        # 5000 <stdout>
+    17b5:	ba 27 01 00 00       	mov    $0x127,%edx
+    17ba:	48 8d 0d 29 27 00 00 	lea    0x2729(%rip),%rcx        # 3eea <benchreport+0x17c>
+    17c1:	48 89 ce             	mov    %rcx,%rsi
+    17c4:	89 c7                	mov    %eax,%edi
+    17c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    17cb:	e8 d1 0a 00 00       	call   22a1 <printf>
+    17d0:	8b 05 2a 38 00 00    	mov    0x382a(%rip),%eax        # 5000 <stdout>
+    17d6:	48 8d 15 46 2d 00 00 	lea    0x2d46(%rip),%rdx        # 4523 <benchreport+0x7b5>
+    17dd:	48 89 d6             	mov    %rdx,%rsi
+    17e0:	89 c7                	mov    %eax,%edi
+    17e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    17e7:	e8 b5 0a 00 00       	call   22a1 <printf>
+    17ec:	8b 05 0e 38 00 00    	mov    0x380e(%rip),%eax        # 5000 <stdout>
+    17f2:	48 8d 15 34 27 00 00 	lea    0x2734(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    17f9:	48 89 d6             	mov    %rdx,%rsi
+    17fc:	89 c7                	mov    %eax,%edi
+    17fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1803:	e8 99 0a 00 00       	call   22a1 <printf>
+    1808:	e8 c4 10 00 00       	call   28d1 <exit>
+  int in1 = ss.ino;
+    180d:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1810:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  int fd2 = open("df2", O_RDWR | O_CREATE);
+    1813:	be 02 02 00 00       	mov    $0x202,%esi
+    1818:	48 8d 05 1c 2d 00 00 	lea    0x2d1c(%rip),%rax        # 453b <benchreport+0x7cd>
+    181f:	48 89 c7             	mov    %rax,%rdi
+    1822:	e8 86 1b 00 00       	call   33ad <open>
+    1827:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+  if (fd2 == -1)
+    182a:	83 7d c4 ff          	cmpl   $0xffffffff,-0x3c(%rbp)
+    182e:	75 5e                	jne    188e <simpledelete+0x81c>
+    error("Unable to open df2");
+    1830:	8b 05 ca 37 00 00    	mov    0x37ca(%rip),%eax        # 5000 <stdout>
+    1836:	ba 2b 01 00 00       	mov    $0x12b,%edx
+    183b:	48 8d 0d a8 26 00 00 	lea    0x26a8(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1842:	48 89 ce             	mov    %rcx,%rsi
+    1845:	89 c7                	mov    %eax,%edi
+    1847:	b8 00 00 00 00       	mov    $0x0,%eax
+    184c:	e8 50 0a 00 00       	call   22a1 <printf>
+    1851:	8b 05 a9 37 00 00    	mov    0x37a9(%rip),%eax        # 5000 <stdout>
+    1857:	48 8d 15 e1 2c 00 00 	lea    0x2ce1(%rip),%rdx        # 453f <benchreport+0x7d1>
+    185e:	48 89 d6             	mov    %rdx,%rsi
+    1861:	89 c7                	mov    %eax,%edi
+    1863:	b8 00 00 00 00       	mov    $0x0,%eax
+    1868:	e8 34 0a 00 00       	call   22a1 <printf>
+    186d:	8b 05 8d 37 00 00    	mov    0x378d(%rip),%eax        # 5000 <stdout>
+    1873:	48 8d 15 b3 26 00 00 	lea    0x26b3(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    187a:	48 89 d6             	mov    %rdx,%rsi
+    187d:	89 c7                	mov    %eax,%edi
+    187f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1884:	e8 18 0a 00 00       	call   22a1 <printf>
+    1889:	e8 43 10 00 00       	call   28d1 <exit>
+  if (fstat(fd2, &ss) == -1)
+    188e:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    1892:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1895:	48 89 d6             	mov    %rdx,%rsi
+    1898:	89 c7                	mov    %eax,%edi
+    189a:	e8 2f 1b 00 00       	call   33ce <fstat>
+    189f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18a2:	75 5e                	jne    1902 <simpledelete+0x890>
+    error("Unable to stat open df2");
+    18a4:	8b 05 56 37 00 00    	mov    0x3756(%rip),%eax        # 5000 <stdout>
+    18aa:	ba 2d 01 00 00       	mov    $0x12d,%edx
+    18af:	48 8d 0d 34 26 00 00 	lea    0x2634(%rip),%rcx        # 3eea <benchreport+0x17c>
+    18b6:	48 89 ce             	mov    %rcx,%rsi
+    18b9:	89 c7                	mov    %eax,%edi
+    18bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    18c0:	e8 dc 09 00 00       	call   22a1 <printf>
+    18c5:	8b 05 35 37 00 00    	mov    0x3735(%rip),%eax        # 5000 <stdout>
+    18cb:	48 8d 15 80 2c 00 00 	lea    0x2c80(%rip),%rdx        # 4552 <benchreport+0x7e4>
+    18d2:	48 89 d6             	mov    %rdx,%rsi
+    18d5:	89 c7                	mov    %eax,%edi
+    18d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    18dc:	e8 c0 09 00 00       	call   22a1 <printf>
+    18e1:	8b 05 19 37 00 00    	mov    0x3719(%rip),%eax        # 5000 <stdout>
+    18e7:	48 8d 15 3f 26 00 00 	lea    0x263f(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    18ee:	48 89 d6             	mov    %rdx,%rsi
+    18f1:	89 c7                	mov    %eax,%edi
+    18f3:	b8 00 00 00 00       	mov    $0x0,%eax
+    18f8:	e8 a4 09 00 00       	call   22a1 <printf>
+    18fd:	e8 cf 0f 00 00       	call   28d1 <exit>
+  int in2 = ss.ino;
+    1902:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1905:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  if (close(fd1) == -1)
+    1908:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    190b:	89 c7                	mov    %eax,%edi
+    190d:	e8 29 10 00 00       	call   293b <close>
+    1912:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1915:	75 5e                	jne    1975 <simpledelete+0x903>
+    error("unable to close df1");
+    1917:	8b 05 e3 36 00 00    	mov    0x36e3(%rip),%eax        # 5000 <stdout>
+    191d:	ba 30 01 00 00       	mov    $0x130,%edx
+    1922:	48 8d 0d c1 25 00 00 	lea    0x25c1(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1929:	48 89 ce             	mov    %rcx,%rsi
+    192c:	89 c7                	mov    %eax,%edi
+    192e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1933:	e8 69 09 00 00       	call   22a1 <printf>
+    1938:	8b 05 c2 36 00 00    	mov    0x36c2(%rip),%eax        # 5000 <stdout>
+    193e:	48 8d 15 25 2c 00 00 	lea    0x2c25(%rip),%rdx        # 456a <benchreport+0x7fc>
+    1945:	48 89 d6             	mov    %rdx,%rsi
+    1948:	89 c7                	mov    %eax,%edi
+    194a:	b8 00 00 00 00       	mov    $0x0,%eax
+    194f:	e8 4d 09 00 00       	call   22a1 <printf>
+    1954:	8b 05 a6 36 00 00    	mov    0x36a6(%rip),%eax        # 5000 <stdout>
+    195a:	48 8d 15 cc 25 00 00 	lea    0x25cc(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1961:	48 89 d6             	mov    %rdx,%rsi
+    1964:	89 c7                	mov    %eax,%edi
+    1966:	b8 00 00 00 00       	mov    $0x0,%eax
+    196b:	e8 31 09 00 00       	call   22a1 <printf>
+    1970:	e8 5c 0f 00 00       	call   28d1 <exit>
+  if (unlink("df1") == -1)
+    1975:	48 8d 05 90 2b 00 00 	lea    0x2b90(%rip),%rax        # 450c <benchreport+0x79e>
+    197c:	48 89 c7             	mov    %rax,%rdi
+    197f:	e8 3f 1a 00 00       	call   33c3 <unlink>
+    1984:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1987:	75 5e                	jne    19e7 <simpledelete+0x975>
+    error("unable to unlink df1");
+    1989:	8b 05 71 36 00 00    	mov    0x3671(%rip),%eax        # 5000 <stdout>
+    198f:	ba 32 01 00 00       	mov    $0x132,%edx
+    1994:	48 8d 0d 4f 25 00 00 	lea    0x254f(%rip),%rcx        # 3eea <benchreport+0x17c>
+    199b:	48 89 ce             	mov    %rcx,%rsi
+    199e:	89 c7                	mov    %eax,%edi
+    19a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    19a5:	e8 f7 08 00 00       	call   22a1 <printf>
+    19aa:	8b 05 50 36 00 00    	mov    0x3650(%rip),%eax        # 5000 <stdout>
+    19b0:	48 8d 15 c7 2b 00 00 	lea    0x2bc7(%rip),%rdx        # 457e <benchreport+0x810>
+    19b7:	48 89 d6             	mov    %rdx,%rsi
+    19ba:	89 c7                	mov    %eax,%edi
+    19bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    19c1:	e8 db 08 00 00       	call   22a1 <printf>
+    19c6:	8b 05 34 36 00 00    	mov    0x3634(%rip),%eax        # 5000 <stdout>
+    19cc:	48 8d 15 5a 25 00 00 	lea    0x255a(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    19d3:	48 89 d6             	mov    %rdx,%rsi
+    19d6:	89 c7                	mov    %eax,%edi
+    19d8:	b8 00 00 00 00       	mov    $0x0,%eax
+    19dd:	e8 bf 08 00 00       	call   22a1 <printf>
+    19e2:	e8 ea 0e 00 00       	call   28d1 <exit>
+  int fd3 = open("df3", O_RDWR | O_CREATE);
+    19e7:	be 02 02 00 00       	mov    $0x202,%esi
+    19ec:	48 8d 05 a0 2b 00 00 	lea    0x2ba0(%rip),%rax        # 4593 <benchreport+0x825>
+    19f3:	48 89 c7             	mov    %rax,%rdi
+    19f6:	e8 b2 19 00 00       	call   33ad <open>
+    19fb:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  if (fd3 == -1)
+    19fe:	83 7d bc ff          	cmpl   $0xffffffff,-0x44(%rbp)
+    1a02:	75 5e                	jne    1a62 <simpledelete+0x9f0>
+    error("Unable to open df3");
+    1a04:	8b 05 f6 35 00 00    	mov    0x35f6(%rip),%eax        # 5000 <stdout>
+    1a0a:	ba 35 01 00 00       	mov    $0x135,%edx
+    1a0f:	48 8d 0d d4 24 00 00 	lea    0x24d4(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1a16:	48 89 ce             	mov    %rcx,%rsi
+    1a19:	89 c7                	mov    %eax,%edi
+    1a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a20:	e8 7c 08 00 00       	call   22a1 <printf>
+    1a25:	8b 05 d5 35 00 00    	mov    0x35d5(%rip),%eax        # 5000 <stdout>
+    1a2b:	48 8d 15 65 2b 00 00 	lea    0x2b65(%rip),%rdx        # 4597 <benchreport+0x829>
+    1a32:	48 89 d6             	mov    %rdx,%rsi
+    1a35:	89 c7                	mov    %eax,%edi
+    1a37:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a3c:	e8 60 08 00 00       	call   22a1 <printf>
+    1a41:	8b 05 b9 35 00 00    	mov    0x35b9(%rip),%eax        # 5000 <stdout>
+    1a47:	48 8d 15 df 24 00 00 	lea    0x24df(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1a4e:	48 89 d6             	mov    %rdx,%rsi
+    1a51:	89 c7                	mov    %eax,%edi
+    1a53:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a58:	e8 44 08 00 00       	call   22a1 <printf>
+    1a5d:	e8 6f 0e 00 00       	call   28d1 <exit>
+  if (fstat(fd3, &ss) == -1)
+    1a62:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    1a66:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    1a69:	48 89 d6             	mov    %rdx,%rsi
+    1a6c:	89 c7                	mov    %eax,%edi
+    1a6e:	e8 5b 19 00 00       	call   33ce <fstat>
+    1a73:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a76:	75 5e                	jne    1ad6 <simpledelete+0xa64>
+    error("Unable to stat open file");
+    1a78:	8b 05 82 35 00 00    	mov    0x3582(%rip),%eax        # 5000 <stdout>
+    1a7e:	ba 37 01 00 00       	mov    $0x137,%edx
+    1a83:	48 8d 0d 60 24 00 00 	lea    0x2460(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1a8a:	48 89 ce             	mov    %rcx,%rsi
+    1a8d:	89 c7                	mov    %eax,%edi
+    1a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a94:	e8 08 08 00 00       	call   22a1 <printf>
+    1a99:	8b 05 61 35 00 00    	mov    0x3561(%rip),%eax        # 5000 <stdout>
+    1a9f:	48 8d 15 04 2b 00 00 	lea    0x2b04(%rip),%rdx        # 45aa <benchreport+0x83c>
+    1aa6:	48 89 d6             	mov    %rdx,%rsi
+    1aa9:	89 c7                	mov    %eax,%edi
+    1aab:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ab0:	e8 ec 07 00 00       	call   22a1 <printf>
+    1ab5:	8b 05 45 35 00 00    	mov    0x3545(%rip),%eax        # 5000 <stdout>
+    1abb:	48 8d 15 6b 24 00 00 	lea    0x246b(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1ac2:	48 89 d6             	mov    %rdx,%rsi
+    1ac5:	89 c7                	mov    %eax,%edi
+    1ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1acc:	e8 d0 07 00 00       	call   22a1 <printf>
+    1ad1:	e8 fb 0d 00 00       	call   28d1 <exit>
+  int in3 = ss.ino;
+    1ad6:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  if (in3 != in1 || in3 == in2)
+    1adc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1adf:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+    1ae2:	75 08                	jne    1aec <simpledelete+0xa7a>
+    1ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1ae7:	3b 45 c0             	cmp    -0x40(%rbp),%eax
+    1aea:	75 5e                	jne    1b4a <simpledelete+0xad8>
+    error("File allocation does not reuse inums");
+    1aec:	8b 05 0e 35 00 00    	mov    0x350e(%rip),%eax        # 5000 <stdout>
+    1af2:	ba 3a 01 00 00       	mov    $0x13a,%edx
+    1af7:	48 8d 0d ec 23 00 00 	lea    0x23ec(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1afe:	48 89 ce             	mov    %rcx,%rsi
+    1b01:	89 c7                	mov    %eax,%edi
+    1b03:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b08:	e8 94 07 00 00       	call   22a1 <printf>
+    1b0d:	8b 05 ed 34 00 00    	mov    0x34ed(%rip),%eax        # 5000 <stdout>
+    1b13:	48 8d 15 ae 2a 00 00 	lea    0x2aae(%rip),%rdx        # 45c8 <benchreport+0x85a>
+    1b1a:	48 89 d6             	mov    %rdx,%rsi
+    1b1d:	89 c7                	mov    %eax,%edi
+    1b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b24:	e8 78 07 00 00       	call   22a1 <printf>
+    1b29:	8b 05 d1 34 00 00    	mov    0x34d1(%rip),%eax        # 5000 <stdout>
+    1b2f:	48 8d 15 f7 23 00 00 	lea    0x23f7(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1b36:	48 89 d6             	mov    %rdx,%rsi
+    1b39:	89 c7                	mov    %eax,%edi
+    1b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b40:	e8 5c 07 00 00       	call   22a1 <printf>
+    1b45:	e8 87 0d 00 00       	call   28d1 <exit>
+  int fd4 = open("df4", O_RDWR | O_CREATE);
+    1b4a:	be 02 02 00 00       	mov    $0x202,%esi
+    1b4f:	48 8d 05 97 2a 00 00 	lea    0x2a97(%rip),%rax        # 45ed <benchreport+0x87f>
+    1b56:	48 89 c7             	mov    %rax,%rdi
+    1b59:	e8 4f 18 00 00       	call   33ad <open>
+    1b5e:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  if (fd4 == -1)
+    1b61:	83 7d b4 ff          	cmpl   $0xffffffff,-0x4c(%rbp)
+    1b65:	75 5e                	jne    1bc5 <simpledelete+0xb53>
+    error("Unable to open df4");
+    1b67:	8b 05 93 34 00 00    	mov    0x3493(%rip),%eax        # 5000 <stdout>
+    1b6d:	ba 3d 01 00 00       	mov    $0x13d,%edx
+    1b72:	48 8d 0d 71 23 00 00 	lea    0x2371(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1b79:	48 89 ce             	mov    %rcx,%rsi
+    1b7c:	89 c7                	mov    %eax,%edi
+    1b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b83:	e8 19 07 00 00       	call   22a1 <printf>
+    1b88:	8b 05 72 34 00 00    	mov    0x3472(%rip),%eax        # 5000 <stdout>
+    1b8e:	48 8d 15 5c 2a 00 00 	lea    0x2a5c(%rip),%rdx        # 45f1 <benchreport+0x883>
+    1b95:	48 89 d6             	mov    %rdx,%rsi
+    1b98:	89 c7                	mov    %eax,%edi
+    1b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b9f:	e8 fd 06 00 00       	call   22a1 <printf>
+    1ba4:	8b 05 56 34 00 00    	mov    0x3456(%rip),%eax        # 5000 <stdout>
+    1baa:	48 8d 15 7c 23 00 00 	lea    0x237c(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1bb1:	48 89 d6             	mov    %rdx,%rsi
+    1bb4:	89 c7                	mov    %eax,%edi
+    1bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bbb:	e8 e1 06 00 00       	call   22a1 <printf>
+    1bc0:	e8 0c 0d 00 00       	call   28d1 <exit>
+  if (fstat(fd4, &ss) == -1)
+    1bc5:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+    1bc9:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+    1bcc:	48 89 d6             	mov    %rdx,%rsi
+    1bcf:	89 c7                	mov    %eax,%edi
+    1bd1:	e8 f8 17 00 00       	call   33ce <fstat>
+    1bd6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1bd9:	75 5e                	jne    1c39 <simpledelete+0xbc7>
+    error("Unable to stat open file");
+    1bdb:	8b 05 1f 34 00 00    	mov    0x341f(%rip),%eax        # 5000 <stdout>
+    1be1:	ba 3f 01 00 00       	mov    $0x13f,%edx
+    1be6:	48 8d 0d fd 22 00 00 	lea    0x22fd(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1bed:	48 89 ce             	mov    %rcx,%rsi
+    1bf0:	89 c7                	mov    %eax,%edi
+    1bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bf7:	e8 a5 06 00 00       	call   22a1 <printf>
+    1bfc:	8b 05 fe 33 00 00    	mov    0x33fe(%rip),%eax        # 5000 <stdout>
+    1c02:	48 8d 15 a1 29 00 00 	lea    0x29a1(%rip),%rdx        # 45aa <benchreport+0x83c>
+    1c09:	48 89 d6             	mov    %rdx,%rsi
+    1c0c:	89 c7                	mov    %eax,%edi
+    1c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c13:	e8 89 06 00 00       	call   22a1 <printf>
+    1c18:	8b 05 e2 33 00 00    	mov    0x33e2(%rip),%eax        # 5000 <stdout>
+    1c1e:	48 8d 15 08 23 00 00 	lea    0x2308(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1c25:	48 89 d6             	mov    %rdx,%rsi
+    1c28:	89 c7                	mov    %eax,%edi
+    1c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c2f:	e8 6d 06 00 00       	call   22a1 <printf>
+    1c34:	e8 98 0c 00 00       	call   28d1 <exit>
+  int in4 = ss.ino;
+    1c39:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    1c3c:	89 45 b0             	mov    %eax,-0x50(%rbp)
+  if (in4 == in3 || in4 == in1 || in4 != in2 + 1)
+    1c3f:	8b 45 b0             	mov    -0x50(%rbp),%eax
+    1c42:	3b 45 b8             	cmp    -0x48(%rbp),%eax
+    1c45:	74 13                	je     1c5a <simpledelete+0xbe8>
+    1c47:	8b 45 b0             	mov    -0x50(%rbp),%eax
+    1c4a:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+    1c4d:	74 0b                	je     1c5a <simpledelete+0xbe8>
+    1c4f:	8b 45 c0             	mov    -0x40(%rbp),%eax
+    1c52:	83 c0 01             	add    $0x1,%eax
+    1c55:	39 45 b0             	cmp    %eax,-0x50(%rbp)
+    1c58:	74 5e                	je     1cb8 <simpledelete+0xc46>
+    error("File allocation improperly finds inums");
+    1c5a:	8b 05 a0 33 00 00    	mov    0x33a0(%rip),%eax        # 5000 <stdout>
+    1c60:	ba 42 01 00 00       	mov    $0x142,%edx
+    1c65:	48 8d 0d 7e 22 00 00 	lea    0x227e(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1c6c:	48 89 ce             	mov    %rcx,%rsi
+    1c6f:	89 c7                	mov    %eax,%edi
+    1c71:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c76:	e8 26 06 00 00       	call   22a1 <printf>
+    1c7b:	8b 05 7f 33 00 00    	mov    0x337f(%rip),%eax        # 5000 <stdout>
+    1c81:	48 8d 15 80 29 00 00 	lea    0x2980(%rip),%rdx        # 4608 <benchreport+0x89a>
+    1c88:	48 89 d6             	mov    %rdx,%rsi
+    1c8b:	89 c7                	mov    %eax,%edi
+    1c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c92:	e8 0a 06 00 00       	call   22a1 <printf>
+    1c97:	8b 05 63 33 00 00    	mov    0x3363(%rip),%eax        # 5000 <stdout>
+    1c9d:	48 8d 15 89 22 00 00 	lea    0x2289(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1ca4:	48 89 d6             	mov    %rdx,%rsi
+    1ca7:	89 c7                	mov    %eax,%edi
+    1ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cae:	e8 ee 05 00 00       	call   22a1 <printf>
+    1cb3:	e8 19 0c 00 00       	call   28d1 <exit>
+  if (close(fd2) != 0 || close(fd3) != 0 || close(fd4) != 0 || unlink("df2") != 0 || unlink("df3") != 0 || unlink("df4") != 0)
+    1cb8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1cbb:	89 c7                	mov    %eax,%edi
+    1cbd:	e8 79 0c 00 00       	call   293b <close>
+    1cc2:	85 c0                	test   %eax,%eax
+    1cc4:	75 55                	jne    1d1b <simpledelete+0xca9>
+    1cc6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    1cc9:	89 c7                	mov    %eax,%edi
+    1ccb:	e8 6b 0c 00 00       	call   293b <close>
+    1cd0:	85 c0                	test   %eax,%eax
+    1cd2:	75 47                	jne    1d1b <simpledelete+0xca9>
+    1cd4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+    1cd7:	89 c7                	mov    %eax,%edi
+    1cd9:	e8 5d 0c 00 00       	call   293b <close>
+    1cde:	85 c0                	test   %eax,%eax
+    1ce0:	75 39                	jne    1d1b <simpledelete+0xca9>
+    1ce2:	48 8d 05 52 28 00 00 	lea    0x2852(%rip),%rax        # 453b <benchreport+0x7cd>
+    1ce9:	48 89 c7             	mov    %rax,%rdi
+    1cec:	e8 d2 16 00 00       	call   33c3 <unlink>
+    1cf1:	85 c0                	test   %eax,%eax
+    1cf3:	75 26                	jne    1d1b <simpledelete+0xca9>
+    1cf5:	48 8d 05 97 28 00 00 	lea    0x2897(%rip),%rax        # 4593 <benchreport+0x825>
+    1cfc:	48 89 c7             	mov    %rax,%rdi
+    1cff:	e8 bf 16 00 00       	call   33c3 <unlink>
+    1d04:	85 c0                	test   %eax,%eax
+    1d06:	75 13                	jne    1d1b <simpledelete+0xca9>
+    1d08:	48 8d 05 de 28 00 00 	lea    0x28de(%rip),%rax        # 45ed <benchreport+0x87f>
+    1d0f:	48 89 c7             	mov    %rax,%rdi
+    1d12:	e8 ac 16 00 00       	call   33c3 <unlink>
+    1d17:	85 c0                	test   %eax,%eax
+    1d19:	74 5e                	je     1d79 <simpledelete+0xd07>
+    error("Unable to clean up after inum allocation test");
+    1d1b:	8b 05 df 32 00 00    	mov    0x32df(%rip),%eax        # 5000 <stdout>
+    1d21:	ba 44 01 00 00       	mov    $0x144,%edx
+    1d26:	48 8d 0d bd 21 00 00 	lea    0x21bd(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1d2d:	48 89 ce             	mov    %rcx,%rsi
+    1d30:	89 c7                	mov    %eax,%edi
+    1d32:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d37:	e8 65 05 00 00       	call   22a1 <printf>
+    1d3c:	8b 05 be 32 00 00    	mov    0x32be(%rip),%eax        # 5000 <stdout>
+    1d42:	48 8d 15 e7 28 00 00 	lea    0x28e7(%rip),%rdx        # 4630 <benchreport+0x8c2>
+    1d49:	48 89 d6             	mov    %rdx,%rsi
+    1d4c:	89 c7                	mov    %eax,%edi
+    1d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d53:	e8 49 05 00 00       	call   22a1 <printf>
+    1d58:	8b 05 a2 32 00 00    	mov    0x32a2(%rip),%eax        # 5000 <stdout>
+    1d5e:	48 8d 15 c8 21 00 00 	lea    0x21c8(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1d65:	48 89 d6             	mov    %rdx,%rsi
+    1d68:	89 c7                	mov    %eax,%edi
+    1d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d6f:	e8 2d 05 00 00       	call   22a1 <printf>
+    1d74:	e8 58 0b 00 00       	call   28d1 <exit>
+
+  // You should not be able to read from a deleted file
+  for (int i = 0; i < 8; ++i)
+    1d79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d80:	eb 1b                	jmp    1d9d <simpledelete+0xd2b>
+    buf[i] = i + 1;
+    1d82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d85:	83 c0 01             	add    $0x1,%eax
+    1d88:	89 c1                	mov    %eax,%ecx
+    1d8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d8d:	48 98                	cltq
+    1d8f:	48 8d 15 ca 32 00 00 	lea    0x32ca(%rip),%rdx        # 5060 <buf>
+    1d96:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for (int i = 0; i < 8; ++i)
+    1d99:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1d9d:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1da1:	7e df                	jle    1d82 <simpledelete+0xd10>
+  fd = open("file", O_RDWR | O_CREATE);
+    1da3:	be 02 02 00 00       	mov    $0x202,%esi
+    1da8:	48 8d 05 af 28 00 00 	lea    0x28af(%rip),%rax        # 465e <benchreport+0x8f0>
+    1daf:	48 89 c7             	mov    %rax,%rdi
+    1db2:	e8 f6 15 00 00       	call   33ad <open>
+    1db7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1 || write(fd, buf, 8) != 8)
+    1dba:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    1dbe:	74 1e                	je     1dde <simpledelete+0xd6c>
+    1dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1dc3:	ba 08 00 00 00       	mov    $0x8,%edx
+    1dc8:	48 8d 0d 91 32 00 00 	lea    0x3291(%rip),%rcx        # 5060 <buf>
+    1dcf:	48 89 ce             	mov    %rcx,%rsi
+    1dd2:	89 c7                	mov    %eax,%edi
+    1dd4:	e8 a8 15 00 00       	call   3381 <write>
+    1dd9:	83 f8 08             	cmp    $0x8,%eax
+    1ddc:	74 5e                	je     1e3c <simpledelete+0xdca>
+    error("Unable to open/write to file");
+    1dde:	8b 05 1c 32 00 00    	mov    0x321c(%rip),%eax        # 5000 <stdout>
+    1de4:	ba 4b 01 00 00       	mov    $0x14b,%edx
+    1de9:	48 8d 0d fa 20 00 00 	lea    0x20fa(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1df0:	48 89 ce             	mov    %rcx,%rsi
+    1df3:	89 c7                	mov    %eax,%edi
+    1df5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dfa:	e8 a2 04 00 00       	call   22a1 <printf>
+    1dff:	8b 05 fb 31 00 00    	mov    0x31fb(%rip),%eax        # 5000 <stdout>
+    1e05:	48 8d 15 57 28 00 00 	lea    0x2857(%rip),%rdx        # 4663 <benchreport+0x8f5>
+    1e0c:	48 89 d6             	mov    %rdx,%rsi
+    1e0f:	89 c7                	mov    %eax,%edi
+    1e11:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e16:	e8 86 04 00 00       	call   22a1 <printf>
+    1e1b:	8b 05 df 31 00 00    	mov    0x31df(%rip),%eax        # 5000 <stdout>
+    1e21:	48 8d 15 05 21 00 00 	lea    0x2105(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1e28:	48 89 d6             	mov    %rdx,%rsi
+    1e2b:	89 c7                	mov    %eax,%edi
+    1e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e32:	e8 6a 04 00 00       	call   22a1 <printf>
+    1e37:	e8 95 0a 00 00       	call   28d1 <exit>
+  for (int i = 0; i < 8; ++i)
+    1e3c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    1e43:	eb 14                	jmp    1e59 <simpledelete+0xde7>
+    buf[i] = 0;
+    1e45:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e48:	48 98                	cltq
+    1e4a:	48 8d 15 0f 32 00 00 	lea    0x320f(%rip),%rdx        # 5060 <buf>
+    1e51:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+  for (int i = 0; i < 8; ++i)
+    1e55:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1e59:	83 7d f8 07          	cmpl   $0x7,-0x8(%rbp)
+    1e5d:	7e e6                	jle    1e45 <simpledelete+0xdd3>
+  if (close(fd) != 0 || unlink("file") != 0)
+    1e5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e62:	89 c7                	mov    %eax,%edi
+    1e64:	e8 d2 0a 00 00       	call   293b <close>
+    1e69:	85 c0                	test   %eax,%eax
+    1e6b:	75 13                	jne    1e80 <simpledelete+0xe0e>
+    1e6d:	48 8d 05 ea 27 00 00 	lea    0x27ea(%rip),%rax        # 465e <benchreport+0x8f0>
+    1e74:	48 89 c7             	mov    %rax,%rdi
+    1e77:	e8 47 15 00 00       	call   33c3 <unlink>
+    1e7c:	85 c0                	test   %eax,%eax
+    1e7e:	74 5e                	je     1ede <simpledelete+0xe6c>
+    error("Unable to clean up file (1)");
+    1e80:	8b 05 7a 31 00 00    	mov    0x317a(%rip),%eax        # 5000 <stdout>
+    1e86:	ba 4f 01 00 00       	mov    $0x14f,%edx
+    1e8b:	48 8d 0d 58 20 00 00 	lea    0x2058(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1e92:	48 89 ce             	mov    %rcx,%rsi
+    1e95:	89 c7                	mov    %eax,%edi
+    1e97:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e9c:	e8 00 04 00 00       	call   22a1 <printf>
+    1ea1:	8b 05 59 31 00 00    	mov    0x3159(%rip),%eax        # 5000 <stdout>
+    1ea7:	48 8d 15 d2 27 00 00 	lea    0x27d2(%rip),%rdx        # 4680 <benchreport+0x912>
+    1eae:	48 89 d6             	mov    %rdx,%rsi
+    1eb1:	89 c7                	mov    %eax,%edi
+    1eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1eb8:	e8 e4 03 00 00       	call   22a1 <printf>
+    1ebd:	8b 05 3d 31 00 00    	mov    0x313d(%rip),%eax        # 5000 <stdout>
+    1ec3:	48 8d 15 63 20 00 00 	lea    0x2063(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1eca:	48 89 d6             	mov    %rdx,%rsi
+    1ecd:	89 c7                	mov    %eax,%edi
+    1ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ed4:	e8 c8 03 00 00       	call   22a1 <printf>
+    1ed9:	e8 f3 09 00 00       	call   28d1 <exit>
+  fd = open("file", O_RDWR | O_CREATE);
+    1ede:	be 02 02 00 00       	mov    $0x202,%esi
+    1ee3:	48 8d 05 74 27 00 00 	lea    0x2774(%rip),%rax        # 465e <benchreport+0x8f0>
+    1eea:	48 89 c7             	mov    %rax,%rdi
+    1eed:	e8 bb 14 00 00       	call   33ad <open>
+    1ef2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (fd == -1)
+    1ef5:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%rbp)
+    1ef9:	75 5e                	jne    1f59 <simpledelete+0xee7>
+    error("Unable to reopen file");
+    1efb:	8b 05 ff 30 00 00    	mov    0x30ff(%rip),%eax        # 5000 <stdout>
+    1f01:	ba 52 01 00 00       	mov    $0x152,%edx
+    1f06:	48 8d 0d dd 1f 00 00 	lea    0x1fdd(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1f0d:	48 89 ce             	mov    %rcx,%rsi
+    1f10:	89 c7                	mov    %eax,%edi
+    1f12:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f17:	e8 85 03 00 00       	call   22a1 <printf>
+    1f1c:	8b 05 de 30 00 00    	mov    0x30de(%rip),%eax        # 5000 <stdout>
+    1f22:	48 8d 15 73 27 00 00 	lea    0x2773(%rip),%rdx        # 469c <benchreport+0x92e>
+    1f29:	48 89 d6             	mov    %rdx,%rsi
+    1f2c:	89 c7                	mov    %eax,%edi
+    1f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f33:	e8 69 03 00 00       	call   22a1 <printf>
+    1f38:	8b 05 c2 30 00 00    	mov    0x30c2(%rip),%eax        # 5000 <stdout>
+    1f3e:	48 8d 15 e8 1f 00 00 	lea    0x1fe8(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1f45:	48 89 d6             	mov    %rdx,%rsi
+    1f48:	89 c7                	mov    %eax,%edi
+    1f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f4f:	e8 4d 03 00 00       	call   22a1 <printf>
+    1f54:	e8 78 09 00 00       	call   28d1 <exit>
+  int r = read(fd, buf, 8);
+    1f59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f5c:	ba 08 00 00 00       	mov    $0x8,%edx
+    1f61:	48 8d 0d f8 30 00 00 	lea    0x30f8(%rip),%rcx        # 5060 <buf>
+    1f68:	48 89 ce             	mov    %rcx,%rsi
+    1f6b:	89 c7                	mov    %eax,%edi
+    1f6d:	e8 04 14 00 00       	call   3376 <read>
+    1f72:	89 45 ac             	mov    %eax,-0x54(%rbp)
+  if (r > 0)
+    1f75:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+    1f79:	7e 5e                	jle    1fd9 <simpledelete+0xf67>
+    error("Able to read from fresh file");
+    1f7b:	8b 05 7f 30 00 00    	mov    0x307f(%rip),%eax        # 5000 <stdout>
+    1f81:	ba 55 01 00 00       	mov    $0x155,%edx
+    1f86:	48 8d 0d 5d 1f 00 00 	lea    0x1f5d(%rip),%rcx        # 3eea <benchreport+0x17c>
+    1f8d:	48 89 ce             	mov    %rcx,%rsi
+    1f90:	89 c7                	mov    %eax,%edi
+    1f92:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f97:	e8 05 03 00 00       	call   22a1 <printf>
+    1f9c:	8b 05 5e 30 00 00    	mov    0x305e(%rip),%eax        # 5000 <stdout>
+    1fa2:	48 8d 15 09 27 00 00 	lea    0x2709(%rip),%rdx        # 46b2 <benchreport+0x944>
+    1fa9:	48 89 d6             	mov    %rdx,%rsi
+    1fac:	89 c7                	mov    %eax,%edi
+    1fae:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb3:	e8 e9 02 00 00       	call   22a1 <printf>
+    1fb8:	8b 05 42 30 00 00    	mov    0x3042(%rip),%eax        # 5000 <stdout>
+    1fbe:	48 8d 15 68 1f 00 00 	lea    0x1f68(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    1fc5:	48 89 d6             	mov    %rdx,%rsi
+    1fc8:	89 c7                	mov    %eax,%edi
+    1fca:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fcf:	e8 cd 02 00 00       	call   22a1 <printf>
+    1fd4:	e8 f8 08 00 00       	call   28d1 <exit>
+  if (close(fd) != 0 || unlink("file") != 0)
+    1fd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1fdc:	89 c7                	mov    %eax,%edi
+    1fde:	e8 58 09 00 00       	call   293b <close>
+    1fe3:	85 c0                	test   %eax,%eax
+    1fe5:	75 13                	jne    1ffa <simpledelete+0xf88>
+    1fe7:	48 8d 05 70 26 00 00 	lea    0x2670(%rip),%rax        # 465e <benchreport+0x8f0>
+    1fee:	48 89 c7             	mov    %rax,%rdi
+    1ff1:	e8 cd 13 00 00       	call   33c3 <unlink>
+    1ff6:	85 c0                	test   %eax,%eax
+    1ff8:	74 5e                	je     2058 <simpledelete+0xfe6>
+    error("Unable to clean up file");
+    1ffa:	8b 05 00 30 00 00    	mov    0x3000(%rip),%eax        # 5000 <stdout>
+    2000:	ba 57 01 00 00       	mov    $0x157,%edx
+    2005:	48 8d 0d de 1e 00 00 	lea    0x1ede(%rip),%rcx        # 3eea <benchreport+0x17c>
+    200c:	48 89 ce             	mov    %rcx,%rsi
+    200f:	89 c7                	mov    %eax,%edi
+    2011:	b8 00 00 00 00       	mov    $0x0,%eax
+    2016:	e8 86 02 00 00       	call   22a1 <printf>
+    201b:	8b 05 df 2f 00 00    	mov    0x2fdf(%rip),%eax        # 5000 <stdout>
+    2021:	48 8d 15 a7 26 00 00 	lea    0x26a7(%rip),%rdx        # 46cf <benchreport+0x961>
+    2028:	48 89 d6             	mov    %rdx,%rsi
+    202b:	89 c7                	mov    %eax,%edi
+    202d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2032:	e8 6a 02 00 00       	call   22a1 <printf>
+    2037:	8b 05 c3 2f 00 00    	mov    0x2fc3(%rip),%eax        # 5000 <stdout>
+    203d:	48 8d 15 e9 1e 00 00 	lea    0x1ee9(%rip),%rdx        # 3f2d <benchreport+0x1bf>
+    2044:	48 89 d6             	mov    %rdx,%rsi
+    2047:	89 c7                	mov    %eax,%edi
+    2049:	b8 00 00 00 00       	mov    $0x0,%eax
+    204e:	e8 4e 02 00 00       	call   22a1 <printf>
+    2053:	e8 79 08 00 00       	call   28d1 <exit>
+  printf(1, "simple deletion ok\n");
+    2058:	48 8d 05 88 26 00 00 	lea    0x2688(%rip),%rax        # 46e7 <benchreport+0x979>
+    205f:	48 89 c6             	mov    %rax,%rsi
+    2062:	bf 01 00 00 00       	mov    $0x1,%edi
+    2067:	b8 00 00 00 00       	mov    $0x0,%eax
+    206c:	e8 30 02 00 00       	call   22a1 <printf>
+}
+    2071:	90                   	nop
+    2072:	c9                   	leave
+    2073:	c3                   	ret
+
+0000000000002074 <main>:
+
+int main(int argc, char *argv[]) {
+    2074:	55                   	push   %rbp
+    2075:	48 89 e5             	mov    %rsp,%rbp
+    2078:	48 83 ec 10          	sub    $0x10,%rsp
+    207c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    207f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab4test_a starting\n");
+    2083:	8b 05 77 2f 00 00    	mov    0x2f77(%rip),%eax        # 5000 <stdout>
+    2089:	48 8d 15 6b 26 00 00 	lea    0x266b(%rip),%rdx        # 46fb <benchreport+0x98d>
+    2090:	48 89 d6             	mov    %rdx,%rsi
+    2093:	89 c7                	mov    %eax,%edi
+    2095:	b8 00 00 00 00       	mov    $0x0,%eax
+    209a:	e8 02 02 00 00       	call   22a1 <printf>
+  overwrite();
+    209f:	e8 5c df ff ff       	call   0 <overwrite>
+  append();
+    20a4:	e8 ac e1 ff ff       	call   255 <append>
+  filecreation();
+    20a9:	e8 03 e5 ff ff       	call   5b1 <filecreation>
+  onefile();
+    20ae:	e8 28 e8 ff ff       	call   8db <onefile>
+  fourfiles();
+    20b3:	e8 50 eb ff ff       	call   c08 <fourfiles>
+  simpledelete();
+    20b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    20bd:	e8 b0 ef ff ff       	call   1072 <simpledelete>
+  printf(stdout, "lab4test_a passed!\n");
+    20c2:	8b 05 38 2f 00 00    	mov    0x2f38(%rip),%eax        # 5000 <stdout>
+    20c8:	48 8d 15 41 26 00 00 	lea    0x2641(%rip),%rdx        # 4710 <benchreport+0x9a2>
+    20cf:	48 89 d6             	mov    %rdx,%rsi
+    20d2:	89 c7                	mov    %eax,%edi
+    20d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    20d9:	e8 c3 01 00 00       	call   22a1 <printf>
+  exit();
+    20de:	e8 ee 07 00 00       	call   28d1 <exit>
+
+00000000000020e3 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    20e3:	55                   	push   %rbp
+    20e4:	48 89 e5             	mov    %rsp,%rbp
+    20e7:	48 83 ec 10          	sub    $0x10,%rsp
+    20eb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    20ee:	89 f0                	mov    %esi,%eax
+    20f0:	88 45 f8             	mov    %al,-0x8(%rbp)
+    20f3:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    20f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20fa:	89 d6                	mov    %edx,%esi
+    20fc:	89 c7                	mov    %eax,%edi
+    20fe:	e8 eb 06 00 00       	call   27ee <bputc>
+    2103:	90                   	nop
+    2104:	c9                   	leave
+    2105:	c3                   	ret
+
+0000000000002106 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    2106:	55                   	push   %rbp
+    2107:	48 89 e5             	mov    %rsp,%rbp
+    210a:	48 83 ec 50          	sub    $0x50,%rsp
+    210e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    2111:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    2115:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    2118:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    211b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    211f:	74 21                	je     2142 <printint64+0x3c>
+    2121:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2125:	48 c1 e8 3f          	shr    $0x3f,%rax
+    2129:	0f b6 c0             	movzbl %al,%eax
+    212c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    212f:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    2133:	74 0d                	je     2142 <printint64+0x3c>
+    x = -xx;
+    2135:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2139:	48 f7 d8             	neg    %rax
+    213c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2140:	eb 08                	jmp    214a <printint64+0x44>
+  else
+    x = xx;
+    2142:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2146:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    214a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    2151:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    2154:	48 63 c8             	movslq %eax,%rcx
+    2157:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    215b:	ba 00 00 00 00       	mov    $0x0,%edx
+    2160:	48 f7 f1             	div    %rcx
+    2163:	48 89 d1             	mov    %rdx,%rcx
+    2166:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2169:	8d 50 01             	lea    0x1(%rax),%edx
+    216c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    216f:	48 8d 15 9a 2e 00 00 	lea    0x2e9a(%rip),%rdx        # 5010 <digits.1>
+    2176:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    217a:	48 98                	cltq
+    217c:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    2180:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    2183:	48 63 f0             	movslq %eax,%rsi
+    2186:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    218a:	ba 00 00 00 00       	mov    $0x0,%edx
+    218f:	48 f7 f6             	div    %rsi
+    2192:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2196:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    219b:	75 b4                	jne    2151 <printint64+0x4b>
+
+  if (sgn)
+    219d:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    21a1:	74 2b                	je     21ce <printint64+0xc8>
+    buf[i++] = '-';
+    21a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21a6:	8d 50 01             	lea    0x1(%rax),%edx
+    21a9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    21ac:	48 98                	cltq
+    21ae:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    21b3:	eb 19                	jmp    21ce <printint64+0xc8>
+    putc(fd, buf[i]);
+    21b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21b8:	48 98                	cltq
+    21ba:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    21bf:	0f be d0             	movsbl %al,%edx
+    21c2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    21c5:	89 d6                	mov    %edx,%esi
+    21c7:	89 c7                	mov    %eax,%edi
+    21c9:	e8 15 ff ff ff       	call   20e3 <putc>
+  while (--i >= 0)
+    21ce:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    21d2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    21d6:	79 dd                	jns    21b5 <printint64+0xaf>
+}
+    21d8:	90                   	nop
+    21d9:	90                   	nop
+    21da:	c9                   	leave
+    21db:	c3                   	ret
+
+00000000000021dc <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    21dc:	55                   	push   %rbp
+    21dd:	48 89 e5             	mov    %rsp,%rbp
+    21e0:	48 83 ec 30          	sub    $0x30,%rsp
+    21e4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    21e7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    21ea:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    21ed:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    21f0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    21f7:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    21fb:	74 17                	je     2214 <printint+0x38>
+    21fd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    2201:	79 11                	jns    2214 <printint+0x38>
+    neg = 1;
+    2203:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    220a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    220d:	f7 d8                	neg    %eax
+    220f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2212:	eb 06                	jmp    221a <printint+0x3e>
+  } else {
+    x = xx;
+    2214:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2217:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    221a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    2221:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    2224:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2227:	ba 00 00 00 00       	mov    $0x0,%edx
+    222c:	f7 f1                	div    %ecx
+    222e:	89 d1                	mov    %edx,%ecx
+    2230:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2233:	8d 50 01             	lea    0x1(%rax),%edx
+    2236:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2239:	89 c9                	mov    %ecx,%ecx
+    223b:	48 8d 15 ee 2d 00 00 	lea    0x2dee(%rip),%rdx        # 5030 <digits.0>
+    2242:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    2246:	48 98                	cltq
+    2248:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    224c:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    224f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2252:	ba 00 00 00 00       	mov    $0x0,%edx
+    2257:	f7 f6                	div    %esi
+    2259:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    225c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    2260:	75 bf                	jne    2221 <printint+0x45>
+  if (neg)
+    2262:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2266:	74 2b                	je     2293 <printint+0xb7>
+    buf[i++] = '-';
+    2268:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    226b:	8d 50 01             	lea    0x1(%rax),%edx
+    226e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2271:	48 98                	cltq
+    2273:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    2278:	eb 19                	jmp    2293 <printint+0xb7>
+    putc(fd, buf[i]);
+    227a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    227d:	48 98                	cltq
+    227f:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    2284:	0f be d0             	movsbl %al,%edx
+    2287:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    228a:	89 d6                	mov    %edx,%esi
+    228c:	89 c7                	mov    %eax,%edi
+    228e:	e8 50 fe ff ff       	call   20e3 <putc>
+  while (--i >= 0)
+    2293:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    2297:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    229b:	79 dd                	jns    227a <printint+0x9e>
+}
+    229d:	90                   	nop
+    229e:	90                   	nop
+    229f:	c9                   	leave
+    22a0:	c3                   	ret
+
+00000000000022a1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    22a1:	55                   	push   %rbp
+    22a2:	48 89 e5             	mov    %rsp,%rbp
+    22a5:	48 83 ec 70          	sub    $0x70,%rsp
+    22a9:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    22ac:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    22b0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    22b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    22b8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    22bc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    22c0:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    22c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    22cb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    22cf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    22d3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    22d7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    22de:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    22e5:	e9 67 02 00 00       	jmp    2551 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    22ea:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    22ed:	48 63 d0             	movslq %eax,%rdx
+    22f0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    22f4:	48 01 d0             	add    %rdx,%rax
+    22f7:	0f b6 00             	movzbl (%rax),%eax
+    22fa:	0f be c0             	movsbl %al,%eax
+    22fd:	25 ff 00 00 00       	and    $0xff,%eax
+    2302:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    2305:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    2309:	75 30                	jne    233b <printf+0x9a>
+      if (c == '%') {
+    230b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    230f:	75 13                	jne    2324 <printf+0x83>
+        state = '%';
+    2311:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    2318:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    231f:	e9 29 02 00 00       	jmp    254d <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    2324:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2327:	0f be d0             	movsbl %al,%edx
+    232a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    232d:	89 d6                	mov    %edx,%esi
+    232f:	89 c7                	mov    %eax,%edi
+    2331:	e8 ad fd ff ff       	call   20e3 <putc>
+    2336:	e9 12 02 00 00       	jmp    254d <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    233b:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    233f:	0f 85 08 02 00 00    	jne    254d <printf+0x2ac>
+      if (c == 'l') {
+    2345:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    2349:	75 0c                	jne    2357 <printf+0xb6>
+        lflag = 1;
+    234b:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    2352:	e9 f6 01 00 00       	jmp    254d <printf+0x2ac>
+      } else if (c == 'd') {
+    2357:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    235b:	0f 85 93 00 00 00    	jne    23f4 <printf+0x153>
+        if (lflag == 1)
+    2361:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2365:	75 47                	jne    23ae <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    2367:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    236a:	83 f8 2f             	cmp    $0x2f,%eax
+    236d:	77 17                	ja     2386 <printf+0xe5>
+    236f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2373:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2376:	89 d2                	mov    %edx,%edx
+    2378:	48 01 d0             	add    %rdx,%rax
+    237b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    237e:	83 c2 08             	add    $0x8,%edx
+    2381:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2384:	eb 0c                	jmp    2392 <printf+0xf1>
+    2386:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    238a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    238e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2392:	48 8b 30             	mov    (%rax),%rsi
+    2395:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2398:	b9 01 00 00 00       	mov    $0x1,%ecx
+    239d:	ba 0a 00 00 00       	mov    $0xa,%edx
+    23a2:	89 c7                	mov    %eax,%edi
+    23a4:	e8 5d fd ff ff       	call   2106 <printint64>
+    23a9:	e9 98 01 00 00       	jmp    2546 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    23ae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    23b1:	83 f8 2f             	cmp    $0x2f,%eax
+    23b4:	77 17                	ja     23cd <printf+0x12c>
+    23b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    23ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    23bd:	89 d2                	mov    %edx,%edx
+    23bf:	48 01 d0             	add    %rdx,%rax
+    23c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    23c5:	83 c2 08             	add    $0x8,%edx
+    23c8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    23cb:	eb 0c                	jmp    23d9 <printf+0x138>
+    23cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    23d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    23d5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    23d9:	8b 30                	mov    (%rax),%esi
+    23db:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    23de:	b9 01 00 00 00       	mov    $0x1,%ecx
+    23e3:	ba 0a 00 00 00       	mov    $0xa,%edx
+    23e8:	89 c7                	mov    %eax,%edi
+    23ea:	e8 ed fd ff ff       	call   21dc <printint>
+    23ef:	e9 52 01 00 00       	jmp    2546 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    23f4:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    23f8:	74 0a                	je     2404 <printf+0x163>
+    23fa:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    23fe:	0f 85 93 00 00 00    	jne    2497 <printf+0x1f6>
+        if (lflag == 1)
+    2404:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2408:	75 47                	jne    2451 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    240a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    240d:	83 f8 2f             	cmp    $0x2f,%eax
+    2410:	77 17                	ja     2429 <printf+0x188>
+    2412:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2416:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2419:	89 d2                	mov    %edx,%edx
+    241b:	48 01 d0             	add    %rdx,%rax
+    241e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2421:	83 c2 08             	add    $0x8,%edx
+    2424:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2427:	eb 0c                	jmp    2435 <printf+0x194>
+    2429:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    242d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2431:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2435:	48 8b 30             	mov    (%rax),%rsi
+    2438:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    243b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2440:	ba 10 00 00 00       	mov    $0x10,%edx
+    2445:	89 c7                	mov    %eax,%edi
+    2447:	e8 ba fc ff ff       	call   2106 <printint64>
+        if (lflag == 1)
+    244c:	e9 f5 00 00 00       	jmp    2546 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    2451:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2454:	83 f8 2f             	cmp    $0x2f,%eax
+    2457:	77 17                	ja     2470 <printf+0x1cf>
+    2459:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    245d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2460:	89 d2                	mov    %edx,%edx
+    2462:	48 01 d0             	add    %rdx,%rax
+    2465:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2468:	83 c2 08             	add    $0x8,%edx
+    246b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    246e:	eb 0c                	jmp    247c <printf+0x1db>
+    2470:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2474:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2478:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    247c:	8b 30                	mov    (%rax),%esi
+    247e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2481:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2486:	ba 10 00 00 00       	mov    $0x10,%edx
+    248b:	89 c7                	mov    %eax,%edi
+    248d:	e8 4a fd ff ff       	call   21dc <printint>
+        if (lflag == 1)
+    2492:	e9 af 00 00 00       	jmp    2546 <printf+0x2a5>
+      } else if (c == 's') {
+    2497:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    249b:	75 6e                	jne    250b <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    249d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    24a0:	83 f8 2f             	cmp    $0x2f,%eax
+    24a3:	77 17                	ja     24bc <printf+0x21b>
+    24a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    24a9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    24ac:	89 d2                	mov    %edx,%edx
+    24ae:	48 01 d0             	add    %rdx,%rax
+    24b1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    24b4:	83 c2 08             	add    $0x8,%edx
+    24b7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    24ba:	eb 0c                	jmp    24c8 <printf+0x227>
+    24bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    24c0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    24c4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    24c8:	48 8b 00             	mov    (%rax),%rax
+    24cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    24cf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    24d4:	75 28                	jne    24fe <printf+0x25d>
+          s = "(null)";
+    24d6:	48 8d 05 47 22 00 00 	lea    0x2247(%rip),%rax        # 4724 <benchreport+0x9b6>
+    24dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    24e1:	eb 1b                	jmp    24fe <printf+0x25d>
+          putc(fd, *s);
+    24e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    24e7:	0f b6 00             	movzbl (%rax),%eax
+    24ea:	0f be d0             	movsbl %al,%edx
+    24ed:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    24f0:	89 d6                	mov    %edx,%esi
+    24f2:	89 c7                	mov    %eax,%edi
+    24f4:	e8 ea fb ff ff       	call   20e3 <putc>
+        for (; *s; s++)
+    24f9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    24fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2502:	0f b6 00             	movzbl (%rax),%eax
+    2505:	84 c0                	test   %al,%al
+    2507:	75 da                	jne    24e3 <printf+0x242>
+    2509:	eb 3b                	jmp    2546 <printf+0x2a5>
+      } else if (c == '%') {
+    250b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    250f:	75 14                	jne    2525 <printf+0x284>
+        putc(fd, c);
+    2511:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2514:	0f be d0             	movsbl %al,%edx
+    2517:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    251a:	89 d6                	mov    %edx,%esi
+    251c:	89 c7                	mov    %eax,%edi
+    251e:	e8 c0 fb ff ff       	call   20e3 <putc>
+    2523:	eb 21                	jmp    2546 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    2525:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2528:	be 25 00 00 00       	mov    $0x25,%esi
+    252d:	89 c7                	mov    %eax,%edi
+    252f:	e8 af fb ff ff       	call   20e3 <putc>
+        putc(fd, c);
+    2534:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    2537:	0f be d0             	movsbl %al,%edx
+    253a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    253d:	89 d6                	mov    %edx,%esi
+    253f:	89 c7                	mov    %eax,%edi
+    2541:	e8 9d fb ff ff       	call   20e3 <putc>
+      }
+      state = 0;
+    2546:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    254d:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    2551:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    2554:	48 63 d0             	movslq %eax,%rdx
+    2557:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    255b:	48 01 d0             	add    %rdx,%rax
+    255e:	0f b6 00             	movzbl (%rax),%eax
+    2561:	84 c0                	test   %al,%al
+    2563:	0f 85 81 fd ff ff    	jne    22ea <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    2569:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    256c:	89 c7                	mov    %eax,%edi
+    256e:	e8 ee 02 00 00       	call   2861 <bflushtty>
+}
+    2573:	90                   	nop
+    2574:	c9                   	leave
+    2575:	c3                   	ret
+
+0000000000002576 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    2576:	55                   	push   %rbp
+    2577:	48 89 e5             	mov    %rsp,%rbp
+    257a:	48 83 ec 30          	sub    $0x30,%rsp
+    257e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    2581:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2585:	78 06                	js     258d <getbuf+0x17>
+    2587:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    258b:	7e 0a                	jle    2597 <getbuf+0x21>
+    return 0;
+    258d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2592:	e9 94 00 00 00       	jmp    262b <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    2597:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    259a:	48 98                	cltq
+    259c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    25a3:	00 
+    25a4:	48 8d 05 b5 4a 00 00 	lea    0x4ab5(%rip),%rax        # 7060 <obufs>
+    25ab:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    25af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    25b3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    25b8:	75 6d                	jne    2627 <getbuf+0xb1>
+    25ba:	bf 08 02 00 00       	mov    $0x208,%edi
+    25bf:	e8 bd 13 00 00       	call   3981 <malloc>
+    25c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    25c8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    25cd:	74 58                	je     2627 <getbuf+0xb1>
+    b->n = 0;
+    25cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25d3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    25d9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    25dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    25e0:	48 89 d6             	mov    %rdx,%rsi
+    25e3:	89 c7                	mov    %eax,%edi
+    25e5:	e8 e4 0d 00 00       	call   33ce <fstat>
+    25ea:	85 c0                	test   %eax,%eax
+    25ec:	75 11                	jne    25ff <getbuf+0x89>
+    25ee:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    25f2:	66 83 f8 03          	cmp    $0x3,%ax
+    25f6:	75 07                	jne    25ff <getbuf+0x89>
+    25f8:	ba 01 00 00 00       	mov    $0x1,%edx
+    25fd:	eb 05                	jmp    2604 <getbuf+0x8e>
+    25ff:	ba 00 00 00 00       	mov    $0x0,%edx
+    2604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2608:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    260b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    260e:	48 98                	cltq
+    2610:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2617:	00 
+    2618:	48 8d 15 41 4a 00 00 	lea    0x4a41(%rip),%rdx        # 7060 <obufs>
+    261f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2623:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    2627:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    262b:	c9                   	leave
+    262c:	c3                   	ret
+
+000000000000262d <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    262d:	55                   	push   %rbp
+    262e:	48 89 e5             	mov    %rsp,%rbp
+    2631:	48 83 ec 20          	sub    $0x20,%rsp
+    2635:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    2638:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    263c:	78 33                	js     2671 <bflush+0x44>
+    263e:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    2642:	7f 2d                	jg     2671 <bflush+0x44>
+    2644:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2647:	48 98                	cltq
+    2649:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2650:	00 
+    2651:	48 8d 05 08 4a 00 00 	lea    0x4a08(%rip),%rax        # 7060 <obufs>
+    2658:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    265c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2660:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2665:	74 0a                	je     2671 <bflush+0x44>
+    2667:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    266b:	8b 00                	mov    (%rax),%eax
+    266d:	85 c0                	test   %eax,%eax
+    266f:	75 07                	jne    2678 <bflush+0x4b>
+    return 0;
+    2671:	b8 00 00 00 00       	mov    $0x0,%eax
+    2676:	eb 3c                	jmp    26b4 <bflush+0x87>
+  n = b->n;
+    2678:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    267c:	8b 00                	mov    (%rax),%eax
+    267e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    2681:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2685:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    268b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    268f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    2693:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2696:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2699:	48 89 ce             	mov    %rcx,%rsi
+    269c:	89 c7                	mov    %eax,%edi
+    269e:	e8 de 0c 00 00       	call   3381 <write>
+    26a3:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    26a6:	75 07                	jne    26af <bflush+0x82>
+    26a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    26ad:	eb 05                	jmp    26b4 <bflush+0x87>
+    26af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    26b4:	c9                   	leave
+    26b5:	c3                   	ret
+
+00000000000026b6 <bflushall>:
+
+void bflushall(void) {
+    26b6:	55                   	push   %rbp
+    26b7:	48 89 e5             	mov    %rsp,%rbp
+    26ba:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    26be:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    26c5:	eb 0e                	jmp    26d5 <bflushall+0x1f>
+    bflush(fd);
+    26c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    26ca:	89 c7                	mov    %eax,%edi
+    26cc:	e8 5c ff ff ff       	call   262d <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    26d1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    26d5:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    26d9:	7e ec                	jle    26c7 <bflushall+0x11>
+}
+    26db:	90                   	nop
+    26dc:	90                   	nop
+    26dd:	c9                   	leave
+    26de:	c3                   	ret
+
+00000000000026df <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    26df:	55                   	push   %rbp
+    26e0:	48 89 e5             	mov    %rsp,%rbp
+    26e3:	48 83 ec 30          	sub    $0x30,%rsp
+    26e7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    26ea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    26ee:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    26f1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    26f4:	89 c7                	mov    %eax,%edi
+    26f6:	e8 7b fe ff ff       	call   2576 <getbuf>
+    26fb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    26ff:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2704:	75 19                	jne    271f <bwrite+0x40>
+    return write(fd, s, n);
+    2706:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    2709:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    270d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2710:	48 89 ce             	mov    %rcx,%rsi
+    2713:	89 c7                	mov    %eax,%edi
+    2715:	e8 67 0c 00 00       	call   3381 <write>
+    271a:	e9 cd 00 00 00       	jmp    27ec <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    271f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2726:	e9 92 00 00 00       	jmp    27bd <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    272b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    272f:	8b 00                	mov    (%rax),%eax
+    2731:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2736:	75 18                	jne    2750 <bwrite+0x71>
+    2738:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    273b:	89 c7                	mov    %eax,%edi
+    273d:	e8 eb fe ff ff       	call   262d <bflush>
+    2742:	85 c0                	test   %eax,%eax
+    2744:	79 0a                	jns    2750 <bwrite+0x71>
+      return -1;
+    2746:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    274b:	e9 9c 00 00 00       	jmp    27ec <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    2750:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    2753:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    2756:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    2759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    275d:	8b 00                	mov    (%rax),%eax
+    275f:	ba 00 02 00 00       	mov    $0x200,%edx
+    2764:	29 c2                	sub    %eax,%edx
+    2766:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    2769:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    276c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    276f:	39 c2                	cmp    %eax,%edx
+    2771:	0f 4e c2             	cmovle %edx,%eax
+    2774:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    2777:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    277a:	48 63 d0             	movslq %eax,%rdx
+    277d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2781:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    2785:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2789:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    278d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2791:	8b 00                	mov    (%rax),%eax
+    2793:	48 98                	cltq
+    2795:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2799:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    279c:	89 c2                	mov    %eax,%edx
+    279e:	48 89 cf             	mov    %rcx,%rdi
+    27a1:	e8 e9 06 00 00       	call   2e8f <memmove>
+    b->n += m;
+    27a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27aa:	8b 10                	mov    (%rax),%edx
+    27ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    27af:	01 c2                	add    %eax,%edx
+    27b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27b5:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    27b7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    27ba:	01 45 fc             	add    %eax,-0x4(%rbp)
+    27bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    27c0:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    27c3:	0f 8c 62 ff ff ff    	jl     272b <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    27c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    27cd:	8b 40 04             	mov    0x4(%rax),%eax
+    27d0:	85 c0                	test   %eax,%eax
+    27d2:	74 15                	je     27e9 <bwrite+0x10a>
+    27d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    27d7:	89 c7                	mov    %eax,%edi
+    27d9:	e8 4f fe ff ff       	call   262d <bflush>
+    27de:	85 c0                	test   %eax,%eax
+    27e0:	79 07                	jns    27e9 <bwrite+0x10a>
+    return -1;
+    27e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    27e7:	eb 03                	jmp    27ec <bwrite+0x10d>
+  return n;
+    27e9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    27ec:	c9                   	leave
+    27ed:	c3                   	ret
+
+00000000000027ee <bputc>:
+
+void bputc(int fd, char c) {
+    27ee:	55                   	push   %rbp
+    27ef:	48 89 e5             	mov    %rsp,%rbp
+    27f2:	48 83 ec 20          	sub    $0x20,%rsp
+    27f6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    27f9:	89 f0                	mov    %esi,%eax
+    27fb:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    27fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2801:	89 c7                	mov    %eax,%edi
+    2803:	e8 6e fd ff ff       	call   2576 <getbuf>
+    2808:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    280c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2811:	75 18                	jne    282b <bputc+0x3d>
+    write(fd, &c, 1);
+    2813:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    2817:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    281a:	ba 01 00 00 00       	mov    $0x1,%edx
+    281f:	48 89 ce             	mov    %rcx,%rsi
+    2822:	89 c7                	mov    %eax,%edi
+    2824:	e8 58 0b 00 00       	call   3381 <write>
+    return;
+    2829:	eb 34                	jmp    285f <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    282b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    282f:	8b 00                	mov    (%rax),%eax
+    2831:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2836:	75 0a                	jne    2842 <bputc+0x54>
+    bflush(fd);
+    2838:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    283b:	89 c7                	mov    %eax,%edi
+    283d:	e8 eb fd ff ff       	call   262d <bflush>
+  b->data[b->n++] = c;
+    2842:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2846:	8b 00                	mov    (%rax),%eax
+    2848:	8d 48 01             	lea    0x1(%rax),%ecx
+    284b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    284f:	89 0a                	mov    %ecx,(%rdx)
+    2851:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    2855:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2859:	48 98                	cltq
+    285b:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    285f:	c9                   	leave
+    2860:	c3                   	ret
+
+0000000000002861 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    2861:	55                   	push   %rbp
+    2862:	48 89 e5             	mov    %rsp,%rbp
+    2865:	48 83 ec 10          	sub    $0x10,%rsp
+    2869:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    286c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2870:	78 4c                	js     28be <bflushtty+0x5d>
+    2872:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    2876:	7f 46                	jg     28be <bflushtty+0x5d>
+    2878:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    287b:	48 98                	cltq
+    287d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2884:	00 
+    2885:	48 8d 05 d4 47 00 00 	lea    0x47d4(%rip),%rax        # 7060 <obufs>
+    288c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2890:	48 85 c0             	test   %rax,%rax
+    2893:	74 29                	je     28be <bflushtty+0x5d>
+    2895:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2898:	48 98                	cltq
+    289a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    28a1:	00 
+    28a2:	48 8d 05 b7 47 00 00 	lea    0x47b7(%rip),%rax        # 7060 <obufs>
+    28a9:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    28ad:	8b 40 04             	mov    0x4(%rax),%eax
+    28b0:	85 c0                	test   %eax,%eax
+    28b2:	74 0a                	je     28be <bflushtty+0x5d>
+    bflush(fd);
+    28b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    28b7:	89 c7                	mov    %eax,%edi
+    28b9:	e8 6f fd ff ff       	call   262d <bflush>
+}
+    28be:	90                   	nop
+    28bf:	c9                   	leave
+    28c0:	c3                   	ret
+
+00000000000028c1 <fork>:
+
+int fork(void) {
+    28c1:	55                   	push   %rbp
+    28c2:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    28c5:	e8 ec fd ff ff       	call   26b6 <bflushall>
+  return _fork();
+    28ca:	e8 7b 0a 00 00       	call   334a <_fork>
+}
+    28cf:	5d                   	pop    %rbp
+    28d0:	c3                   	ret
+
+00000000000028d1 <exit>:
+
+noreturn void exit(void) {
+    28d1:	55                   	push   %rbp
+    28d2:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    28d5:	e8 dc fd ff ff       	call   26b6 <bflushall>
+  _exit();
+    28da:	e8 76 0a 00 00       	call   3355 <_exit>
+
+00000000000028df <exec>:
+}
+
+int exec(char *path, char **argv) {
+    28df:	55                   	push   %rbp
+    28e0:	48 89 e5             	mov    %rsp,%rbp
+    28e3:	48 83 ec 10          	sub    $0x10,%rsp
+    28e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    28eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    28ef:	e8 c2 fd ff ff       	call   26b6 <bflushall>
+  return _exec(path, argv);
+    28f4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    28f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28fc:	48 89 d6             	mov    %rdx,%rsi
+    28ff:	48 89 c7             	mov    %rax,%rdi
+    2902:	e8 9b 0a 00 00       	call   33a2 <_exec>
+}
+    2907:	c9                   	leave
+    2908:	c3                   	ret
+
+0000000000002909 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    2909:	55                   	push   %rbp
+    290a:	48 89 e5             	mov    %rsp,%rbp
+    290d:	48 83 ec 20          	sub    $0x20,%rsp
+    2911:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2915:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2919:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    291d:	e8 94 fd ff ff       	call   26b6 <bflushall>
+  return _spawn(path, argv, fds);
+    2922:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2926:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    292a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    292e:	48 89 ce             	mov    %rcx,%rsi
+    2931:	48 89 c7             	mov    %rax,%rdi
+    2934:	e8 2f 0b 00 00       	call   3468 <_spawn>
+}
+    2939:	c9                   	leave
+    293a:	c3                   	ret
+
+000000000000293b <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    293b:	55                   	push   %rbp
+    293c:	48 89 e5             	mov    %rsp,%rbp
+    293f:	48 83 ec 10          	sub    $0x10,%rsp
+    2943:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    2946:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    294a:	78 69                	js     29b5 <close+0x7a>
+    294c:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    2950:	7f 63                	jg     29b5 <close+0x7a>
+    2952:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2955:	48 98                	cltq
+    2957:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    295e:	00 
+    295f:	48 8d 05 fa 46 00 00 	lea    0x46fa(%rip),%rax        # 7060 <obufs>
+    2966:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    296a:	48 85 c0             	test   %rax,%rax
+    296d:	74 46                	je     29b5 <close+0x7a>
+    bflush(fd);
+    296f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2972:	89 c7                	mov    %eax,%edi
+    2974:	e8 b4 fc ff ff       	call   262d <bflush>
+    free(obufs[fd]);
+    2979:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    297c:	48 98                	cltq
+    297e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2985:	00 
+    2986:	48 8d 05 d3 46 00 00 	lea    0x46d3(%rip),%rax        # 7060 <obufs>
+    298d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2991:	48 89 c7             	mov    %rax,%rdi
+    2994:	e8 90 11 00 00       	call   3b29 <free>
+    obufs[fd] = 0;
+    2999:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    299c:	48 98                	cltq
+    299e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    29a5:	00 
+    29a6:	48 8d 05 b3 46 00 00 	lea    0x46b3(%rip),%rax        # 7060 <obufs>
+    29ad:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    29b4:	00 
+  }
+  return _close(fd);
+    29b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    29b8:	89 c7                	mov    %eax,%edi
+    29ba:	e8 cd 09 00 00       	call   338c <_close>
+}
+    29bf:	c9                   	leave
+    29c0:	c3                   	ret
+
+00000000000029c1 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    29c1:	55                   	push   %rbp
+    29c2:	48 89 e5             	mov    %rsp,%rbp
+    29c5:	53                   	push   %rbx
+    29c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    29ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    29ce:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    29d2:	48 8b 36             	mov    (%rsi),%rsi
+    29d5:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    29d9:	48 29 f7             	sub    %rsi,%rdi
+    29dc:	48 89 f9             	mov    %rdi,%rcx
+    29df:	bb 00 00 00 00       	mov    $0x0,%ebx
+    29e4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    29e8:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    29ec:	48 89 f0             	mov    %rsi,%rax
+    29ef:	ba 00 00 00 00       	mov    $0x0,%edx
+    29f4:	48 89 df             	mov    %rbx,%rdi
+    29f7:	48 0f af f8          	imul   %rax,%rdi
+    29fb:	48 89 d6             	mov    %rdx,%rsi
+    29fe:	48 0f af f1          	imul   %rcx,%rsi
+    2a02:	48 01 fe             	add    %rdi,%rsi
+    2a05:	48 f7 e1             	mul    %rcx
+    2a08:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    2a0c:	48 89 ca             	mov    %rcx,%rdx
+    2a0f:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    2a14:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    2a18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2a1c:	c9                   	leave
+    2a1d:	c3                   	ret
+
+0000000000002a1e <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    2a1e:	55                   	push   %rbp
+    2a1f:	48 89 e5             	mov    %rsp,%rbp
+    2a22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a26:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2a29:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    2a2c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2a30:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2a33:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2a36:	48 89 ce             	mov    %rcx,%rsi
+    2a39:	48 89 f7             	mov    %rsi,%rdi
+    2a3c:	89 d1                	mov    %edx,%ecx
+    2a3e:	fc                   	cld
+    2a3f:	f3 aa                	rep stos %al,%es:(%rdi)
+    2a41:	89 ca                	mov    %ecx,%edx
+    2a43:	48 89 fe             	mov    %rdi,%rsi
+    2a46:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    2a4a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    2a4d:	90                   	nop
+    2a4e:	5d                   	pop    %rbp
+    2a4f:	c3                   	ret
+
+0000000000002a50 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    2a50:	55                   	push   %rbp
+    2a51:	48 89 e5             	mov    %rsp,%rbp
+    2a54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a5c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    2a60:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2a64:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2a68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a6c:	48 89 ce             	mov    %rcx,%rsi
+    2a6f:	48 89 f7             	mov    %rsi,%rdi
+    2a72:	48 89 d1             	mov    %rdx,%rcx
+    2a75:	fc                   	cld
+    2a76:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    2a79:	48 89 ca             	mov    %rcx,%rdx
+    2a7c:	48 89 fe             	mov    %rdi,%rsi
+    2a7f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    2a83:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    2a87:	90                   	nop
+    2a88:	5d                   	pop    %rbp
+    2a89:	c3                   	ret
+
+0000000000002a8a <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    2a8a:	55                   	push   %rbp
+    2a8b:	48 89 e5             	mov    %rsp,%rbp
+    2a8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2a92:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2a96:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    2a9a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2a9e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2aa2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2aa6:	48 89 cf             	mov    %rcx,%rdi
+    2aa9:	48 89 d6             	mov    %rdx,%rsi
+    2aac:	48 89 c1             	mov    %rax,%rcx
+    2aaf:	fc                   	cld
+    2ab0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    2ab2:	48 89 c8             	mov    %rcx,%rax
+    2ab5:	48 89 f2             	mov    %rsi,%rdx
+    2ab8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2abc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    2ac0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2ac4:	90                   	nop
+    2ac5:	5d                   	pop    %rbp
+    2ac6:	c3                   	ret
+
+0000000000002ac7 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    2ac7:	55                   	push   %rbp
+    2ac8:	48 89 e5             	mov    %rsp,%rbp
+    2acb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2acf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2ad3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    2ad7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2adb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2adf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ae3:	48 89 cf             	mov    %rcx,%rdi
+    2ae6:	48 89 d6             	mov    %rdx,%rsi
+    2ae9:	48 89 c1             	mov    %rax,%rcx
+    2aec:	fc                   	cld
+    2aed:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    2af0:	48 89 c8             	mov    %rcx,%rax
+    2af3:	48 89 f2             	mov    %rsi,%rdx
+    2af6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2afa:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    2afe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2b02:	90                   	nop
+    2b03:	5d                   	pop    %rbp
+    2b04:	c3                   	ret
+
+0000000000002b05 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    2b05:	55                   	push   %rbp
+    2b06:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    2b09:	0f 31                	rdtsc
+    2b0b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    2b0e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    2b11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2b14:	48 c1 e0 20          	shl    $0x20,%rax
+    2b18:	48 89 c2             	mov    %rax,%rdx
+    2b1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b1e:	48 09 d0             	or     %rdx,%rax
+}
+    2b21:	5d                   	pop    %rbp
+    2b22:	c3                   	ret
+
+0000000000002b23 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    2b23:	55                   	push   %rbp
+    2b24:	48 89 e5             	mov    %rsp,%rbp
+    2b27:	53                   	push   %rbx
+    2b28:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    2b2b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    2b2f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    2b33:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    2b37:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    2b3b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2b3e:	0f a2                	cpuid
+    2b40:	89 de                	mov    %ebx,%esi
+    2b42:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2b45:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    2b48:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    2b4b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    2b4e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    2b53:	74 09                	je     2b5e <cpuid+0x3b>
+    *eaxp = eax;
+    2b55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2b59:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2b5c:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    2b5e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2b63:	74 09                	je     2b6e <cpuid+0x4b>
+    *ebxp = ebx;
+    2b65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2b69:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2b6c:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    2b6e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    2b73:	74 09                	je     2b7e <cpuid+0x5b>
+    *ecxp = ecx;
+    2b75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2b79:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2b7c:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    2b7e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    2b83:	74 09                	je     2b8e <cpuid+0x6b>
+    *edxp = edx;
+    2b85:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2b89:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    2b8c:	89 10                	mov    %edx,(%rax)
+}
+    2b8e:	90                   	nop
+    2b8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2b93:	c9                   	leave
+    2b94:	c3                   	ret
+
+0000000000002b95 <strcpy>:
+char *strcpy(char *s, char *t) {
+    2b95:	55                   	push   %rbp
+    2b96:	48 89 e5             	mov    %rsp,%rbp
+    2b99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2b9d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    2ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ba5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    2ba9:	90                   	nop
+    2baa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2bae:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2bb2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2bb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2bba:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2bbe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2bc2:	0f b6 12             	movzbl (%rdx),%edx
+    2bc5:	88 10                	mov    %dl,(%rax)
+    2bc7:	0f b6 00             	movzbl (%rax),%eax
+    2bca:	84 c0                	test   %al,%al
+    2bcc:	75 dc                	jne    2baa <strcpy+0x15>
+  return os;
+    2bce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2bd2:	5d                   	pop    %rbp
+    2bd3:	c3                   	ret
+
+0000000000002bd4 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2bd4:	55                   	push   %rbp
+    2bd5:	48 89 e5             	mov    %rsp,%rbp
+    2bd8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bdc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    2be0:	eb 0a                	jmp    2bec <strcmp+0x18>
+    p++, q++;
+    2be2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2be7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    2bec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bf0:	0f b6 00             	movzbl (%rax),%eax
+    2bf3:	84 c0                	test   %al,%al
+    2bf5:	74 12                	je     2c09 <strcmp+0x35>
+    2bf7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bfb:	0f b6 10             	movzbl (%rax),%edx
+    2bfe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c02:	0f b6 00             	movzbl (%rax),%eax
+    2c05:	38 c2                	cmp    %al,%dl
+    2c07:	74 d9                	je     2be2 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2c09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c0d:	0f b6 00             	movzbl (%rax),%eax
+    2c10:	0f b6 d0             	movzbl %al,%edx
+    2c13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c17:	0f b6 00             	movzbl (%rax),%eax
+    2c1a:	0f b6 c0             	movzbl %al,%eax
+    2c1d:	29 c2                	sub    %eax,%edx
+    2c1f:	89 d0                	mov    %edx,%eax
+}
+    2c21:	5d                   	pop    %rbp
+    2c22:	c3                   	ret
+
+0000000000002c23 <strlen>:
+uint strlen(char *s) {
+    2c23:	55                   	push   %rbp
+    2c24:	48 89 e5             	mov    %rsp,%rbp
+    2c27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    2c2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2c32:	eb 04                	jmp    2c38 <strlen+0x15>
+    2c34:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2c38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c3b:	48 63 d0             	movslq %eax,%rdx
+    2c3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c42:	48 01 d0             	add    %rdx,%rax
+    2c45:	0f b6 00             	movzbl (%rax),%eax
+    2c48:	84 c0                	test   %al,%al
+    2c4a:	75 e8                	jne    2c34 <strlen+0x11>
+    ;
+  return n;
+    2c4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2c4f:	5d                   	pop    %rbp
+    2c50:	c3                   	ret
+
+0000000000002c51 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    2c51:	55                   	push   %rbp
+    2c52:	48 89 e5             	mov    %rsp,%rbp
+    2c55:	53                   	push   %rbx
+    2c56:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    2c5a:	8b 05 e4 23 00 00    	mov    0x23e4(%rip),%eax        # 5044 <erms>
+    2c60:	85 c0                	test   %eax,%eax
+    2c62:	79 53                	jns    2cb7 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    2c64:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2c68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    2c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2c73:	ba 00 00 00 00       	mov    $0x0,%edx
+    2c78:	48 89 c6             	mov    %rax,%rsi
+    2c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+    2c80:	e8 9e fe ff ff       	call   2b23 <cpuid>
+    ebx = 0;
+    2c85:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    2c8c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2c8f:	83 f8 06             	cmp    $0x6,%eax
+    2c92:	76 14                	jbe    2ca8 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    2c94:	b8 07 00 00 00       	mov    $0x7,%eax
+    2c99:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2c9e:	0f a2                	cpuid
+    2ca0:	89 d9                	mov    %ebx,%ecx
+    2ca2:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    2ca5:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    2ca8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2cab:	c1 e8 09             	shr    $0x9,%eax
+    2cae:	83 e0 01             	and    $0x1,%eax
+    2cb1:	89 05 8d 23 00 00    	mov    %eax,0x238d(%rip)        # 5044 <erms>
+  }
+  return erms;
+    2cb7:	8b 05 87 23 00 00    	mov    0x2387(%rip),%eax        # 5044 <erms>
+}
+    2cbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2cc1:	c9                   	leave
+    2cc2:	c3                   	ret
+
+0000000000002cc3 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    2cc3:	55                   	push   %rbp
+    2cc4:	48 89 e5             	mov    %rsp,%rbp
+    2cc7:	48 83 ec 10          	sub    $0x10,%rsp
+    2ccb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2ccf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2cd2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    2cd5:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    2cd9:	76 09                	jbe    2ce4 <memset+0x21>
+    2cdb:	e8 71 ff ff ff       	call   2c51 <haserms>
+    2ce0:	85 c0                	test   %eax,%eax
+    2ce2:	74 16                	je     2cfa <memset+0x37>
+    stosb(dst, c, n);
+    2ce4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2ce7:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    2cea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cee:	89 ce                	mov    %ecx,%esi
+    2cf0:	48 89 c7             	mov    %rax,%rdi
+    2cf3:	e8 26 fd ff ff       	call   2a1e <stosb>
+    2cf8:	eb 58                	jmp    2d52 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    2cfa:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2cfd:	c1 e8 03             	shr    $0x3,%eax
+    2d00:	89 c6                	mov    %eax,%esi
+    2d02:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2d05:	48 98                	cltq
+    2d07:	0f b6 c0             	movzbl %al,%eax
+    2d0a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    2d11:	01 01 01 
+    2d14:	48 0f af c2          	imul   %rdx,%rax
+    2d18:	48 89 c1             	mov    %rax,%rcx
+    2d1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d1f:	48 89 f2             	mov    %rsi,%rdx
+    2d22:	48 89 ce             	mov    %rcx,%rsi
+    2d25:	48 89 c7             	mov    %rax,%rdi
+    2d28:	e8 23 fd ff ff       	call   2a50 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    2d2d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2d30:	83 e0 07             	and    $0x7,%eax
+    2d33:	89 c2                	mov    %eax,%edx
+    2d35:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2d38:	83 e0 f8             	and    $0xfffffff8,%eax
+    2d3b:	48 89 c1             	mov    %rax,%rcx
+    2d3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d42:	48 01 c1             	add    %rax,%rcx
+    2d45:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2d48:	89 c6                	mov    %eax,%esi
+    2d4a:	48 89 cf             	mov    %rcx,%rdi
+    2d4d:	e8 cc fc ff ff       	call   2a1e <stosb>
+  }
+  return dst;
+    2d52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2d56:	c9                   	leave
+    2d57:	c3                   	ret
+
+0000000000002d58 <strchr>:
+
+char *strchr(const char *s, char c) {
+    2d58:	55                   	push   %rbp
+    2d59:	48 89 e5             	mov    %rsp,%rbp
+    2d5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d60:	89 f0                	mov    %esi,%eax
+    2d62:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    2d65:	eb 17                	jmp    2d7e <strchr+0x26>
+    if (*s == c)
+    2d67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d6b:	0f b6 00             	movzbl (%rax),%eax
+    2d6e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    2d71:	75 06                	jne    2d79 <strchr+0x21>
+      return (char *)s;
+    2d73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d77:	eb 15                	jmp    2d8e <strchr+0x36>
+  for (; *s; s++)
+    2d79:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2d7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d82:	0f b6 00             	movzbl (%rax),%eax
+    2d85:	84 c0                	test   %al,%al
+    2d87:	75 de                	jne    2d67 <strchr+0xf>
+  return 0;
+    2d89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2d8e:	5d                   	pop    %rbp
+    2d8f:	c3                   	ret
+
+0000000000002d90 <gets>:
+
+char *gets(char *buf, int max) {
+    2d90:	55                   	push   %rbp
+    2d91:	48 89 e5             	mov    %rsp,%rbp
+    2d94:	48 83 ec 20          	sub    $0x20,%rsp
+    2d98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2d9c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    2d9f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2da6:	eb 48                	jmp    2df0 <gets+0x60>
+    cc = read(0, &c, 1);
+    2da8:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    2dac:	ba 01 00 00 00       	mov    $0x1,%edx
+    2db1:	48 89 c6             	mov    %rax,%rsi
+    2db4:	bf 00 00 00 00       	mov    $0x0,%edi
+    2db9:	e8 b8 05 00 00       	call   3376 <read>
+    2dbe:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2dc1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2dc5:	7e 36                	jle    2dfd <gets+0x6d>
+      break;
+    buf[i++] = c;
+    2dc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2dca:	8d 50 01             	lea    0x1(%rax),%edx
+    2dcd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2dd0:	48 63 d0             	movslq %eax,%rdx
+    2dd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2dd7:	48 01 c2             	add    %rax,%rdx
+    2dda:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2dde:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2de0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2de4:	3c 0a                	cmp    $0xa,%al
+    2de6:	74 16                	je     2dfe <gets+0x6e>
+    2de8:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2dec:	3c 0d                	cmp    $0xd,%al
+    2dee:	74 0e                	je     2dfe <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2df0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2df3:	83 c0 01             	add    $0x1,%eax
+    2df6:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2df9:	7f ad                	jg     2da8 <gets+0x18>
+    2dfb:	eb 01                	jmp    2dfe <gets+0x6e>
+      break;
+    2dfd:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    2dfe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2e01:	48 63 d0             	movslq %eax,%rdx
+    2e04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e08:	48 01 d0             	add    %rdx,%rax
+    2e0b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    2e0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2e12:	c9                   	leave
+    2e13:	c3                   	ret
+
+0000000000002e14 <stat>:
+
+int stat(char *n, struct stat *st) {
+    2e14:	55                   	push   %rbp
+    2e15:	48 89 e5             	mov    %rsp,%rbp
+    2e18:	48 83 ec 10          	sub    $0x10,%rsp
+    2e1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e20:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    2e24:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2e28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e2c:	48 89 c6             	mov    %rax,%rsi
+    2e2f:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    2e34:	e8 58 07 00 00       	call   3591 <fstatat>
+}
+    2e39:	c9                   	leave
+    2e3a:	c3                   	ret
+
+0000000000002e3b <atoi>:
+
+int atoi(const char *s) {
+    2e3b:	55                   	push   %rbp
+    2e3c:	48 89 e5             	mov    %rsp,%rbp
+    2e3f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    2e43:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2e4a:	eb 28                	jmp    2e74 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    2e4c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2e4f:	89 d0                	mov    %edx,%eax
+    2e51:	c1 e0 02             	shl    $0x2,%eax
+    2e54:	01 d0                	add    %edx,%eax
+    2e56:	01 c0                	add    %eax,%eax
+    2e58:	89 c1                	mov    %eax,%ecx
+    2e5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e5e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    2e62:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    2e66:	0f b6 00             	movzbl (%rax),%eax
+    2e69:	0f be c0             	movsbl %al,%eax
+    2e6c:	01 c8                	add    %ecx,%eax
+    2e6e:	83 e8 30             	sub    $0x30,%eax
+    2e71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    2e74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e78:	0f b6 00             	movzbl (%rax),%eax
+    2e7b:	3c 2f                	cmp    $0x2f,%al
+    2e7d:	7e 0b                	jle    2e8a <atoi+0x4f>
+    2e7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e83:	0f b6 00             	movzbl (%rax),%eax
+    2e86:	3c 39                	cmp    $0x39,%al
+    2e88:	7e c2                	jle    2e4c <atoi+0x11>
+  return n;
+    2e8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2e8d:	5d                   	pop    %rbp
+    2e8e:	c3                   	ret
+
+0000000000002e8f <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    2e8f:	55                   	push   %rbp
+    2e90:	48 89 e5             	mov    %rsp,%rbp
+    2e93:	48 83 ec 28          	sub    $0x28,%rsp
+    2e97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e9b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2e9f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    2ea2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ea6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    2eaa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2eae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    2eb2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2eb6:	7f 09                	jg     2ec1 <memmove+0x32>
+    return vdst;
+    2eb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ebc:	e9 29 01 00 00       	jmp    2fea <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    2ec1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ec5:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2ec9:	0f 83 87 00 00 00    	jae    2f56 <memmove+0xc7>
+    2ecf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2ed2:	48 63 d0             	movslq %eax,%rdx
+    2ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ed9:	48 01 d0             	add    %rdx,%rax
+    2edc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2ee0:	73 74                	jae    2f56 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    2ee2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2ee5:	48 98                	cltq
+    2ee7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    2eeb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2eee:	48 98                	cltq
+    2ef0:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    2ef4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2ef8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2efc:	48 09 d0             	or     %rdx,%rax
+    2eff:	83 e0 07             	and    $0x7,%eax
+    2f02:	48 85 c0             	test   %rax,%rax
+    2f05:	75 3d                	jne    2f44 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    2f07:	eb 1c                	jmp    2f25 <memmove+0x96>
+        src -= 8;
+    2f09:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    2f0e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    2f13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f17:	48 8b 10             	mov    (%rax),%rdx
+    2f1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f1e:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    2f21:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    2f25:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2f29:	7f de                	jg     2f09 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    2f2b:	eb 17                	jmp    2f44 <memmove+0xb5>
+      *--dst = *--src;
+    2f2d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    2f32:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    2f37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2f3b:	0f b6 10             	movzbl (%rax),%edx
+    2f3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f42:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    2f44:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f47:	8d 50 ff             	lea    -0x1(%rax),%edx
+    2f4a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    2f4d:	85 c0                	test   %eax,%eax
+    2f4f:	7f dc                	jg     2f2d <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    2f51:	e9 90 00 00 00       	jmp    2fe6 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    2f56:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2f5a:	7e 09                	jle    2f65 <memmove+0xd6>
+    2f5c:	e8 f0 fc ff ff       	call   2c51 <haserms>
+    2f61:	85 c0                	test   %eax,%eax
+    2f63:	74 1b                	je     2f80 <memmove+0xf1>
+    movsb(dst, src, n);
+    2f65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f68:	48 63 d0             	movslq %eax,%rdx
+    2f6b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f73:	48 89 ce             	mov    %rcx,%rsi
+    2f76:	48 89 c7             	mov    %rax,%rdi
+    2f79:	e8 0c fb ff ff       	call   2a8a <movsb>
+    2f7e:	eb 66                	jmp    2fe6 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    2f80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f83:	8d 50 07             	lea    0x7(%rax),%edx
+    2f86:	85 c0                	test   %eax,%eax
+    2f88:	0f 48 c2             	cmovs  %edx,%eax
+    2f8b:	c1 f8 03             	sar    $0x3,%eax
+    2f8e:	48 63 d0             	movslq %eax,%rdx
+    2f91:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2f95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f99:	48 89 ce             	mov    %rcx,%rsi
+    2f9c:	48 89 c7             	mov    %rax,%rdi
+    2f9f:	e8 23 fb ff ff       	call   2ac7 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    2fa4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2fa7:	89 d0                	mov    %edx,%eax
+    2fa9:	c1 f8 1f             	sar    $0x1f,%eax
+    2fac:	c1 e8 1d             	shr    $0x1d,%eax
+    2faf:	01 c2                	add    %eax,%edx
+    2fb1:	83 e2 07             	and    $0x7,%edx
+    2fb4:	29 c2                	sub    %eax,%edx
+    2fb6:	89 d0                	mov    %edx,%eax
+    2fb8:	48 98                	cltq
+    2fba:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2fbd:	83 e2 f8             	and    $0xfffffff8,%edx
+    2fc0:	48 63 ca             	movslq %edx,%rcx
+    2fc3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2fc7:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    2fcb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2fce:	83 e2 f8             	and    $0xfffffff8,%edx
+    2fd1:	48 63 ca             	movslq %edx,%rcx
+    2fd4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2fd8:	48 01 d1             	add    %rdx,%rcx
+    2fdb:	48 89 c2             	mov    %rax,%rdx
+    2fde:	48 89 cf             	mov    %rcx,%rdi
+    2fe1:	e8 a4 fa ff ff       	call   2a8a <movsb>
+  }
+  return vdst;
+    2fe6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2fea:	c9                   	leave
+    2feb:	c3                   	ret
+
+0000000000002fec <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    2fec:	55                   	push   %rbp
+    2fed:	48 89 e5             	mov    %rsp,%rbp
+    2ff0:	48 83 ec 20          	sub    $0x20,%rsp
+    2ff4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2ff7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    2ffb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    3002:	00 00 00 
+    3005:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    3009:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    300d:	75 0d                	jne    301c <clock_gettime+0x30>
+    300f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3013:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3017:	48 85 c0             	test   %rax,%rax
+    301a:	75 13                	jne    302f <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    301c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3020:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3023:	48 89 d6             	mov    %rdx,%rsi
+    3026:	89 c7                	mov    %eax,%edi
+    3028:	e8 e0 04 00 00       	call   350d <_clock_gettime>
+    302d:	eb 7d                	jmp    30ac <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    302f:	e8 d1 fa ff ff       	call   2b05 <rdtsc>
+    3034:	48 89 c2             	mov    %rax,%rdx
+    3037:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    303b:	48 89 d6             	mov    %rdx,%rsi
+    303e:	48 89 c7             	mov    %rax,%rdi
+    3041:	e8 7b f9 ff ff       	call   29c1 <clockns>
+    3046:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    304a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    304e:	48 c1 e8 09          	shr    $0x9,%rax
+    3052:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    3059:	b8 44 00 
+    305c:	48 f7 e2             	mul    %rdx
+    305f:	48 89 d0             	mov    %rdx,%rax
+    3062:	48 c1 e8 0b          	shr    $0xb,%rax
+    3066:	48 89 c2             	mov    %rax,%rdx
+    3069:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    306d:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    3070:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3074:	48 89 c8             	mov    %rcx,%rax
+    3077:	48 c1 e8 09          	shr    $0x9,%rax
+    307b:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    3082:	b8 44 00 
+    3085:	48 f7 e2             	mul    %rdx
+    3088:	48 89 d0             	mov    %rdx,%rax
+    308b:	48 c1 e8 0b          	shr    $0xb,%rax
+    308f:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    3096:	48 89 c8             	mov    %rcx,%rax
+    3099:	48 29 d0             	sub    %rdx,%rax
+    309c:	48 89 c2             	mov    %rax,%rdx
+    309f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    30a3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    30a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    30ac:	c9                   	leave
+    30ad:	c3                   	ret
+
+00000000000030ae <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    30ae:	55                   	push   %rbp
+    30af:	48 89 e5             	mov    %rsp,%rbp
+    30b2:	48 83 ec 10          	sub    $0x10,%rsp
+    30b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    30ba:	eb 11                	jmp    30cd <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    30bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30c0:	be 02 00 00 00       	mov    $0x2,%esi
+    30c5:	48 89 c7             	mov    %rax,%rdi
+    30c8:	e8 6c 04 00 00       	call   3539 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    30cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    30d1:	b8 02 00 00 00       	mov    $0x2,%eax
+    30d6:	87 02                	xchg   %eax,(%rdx)
+    30d8:	85 c0                	test   %eax,%eax
+    30da:	75 e0                	jne    30bc <mutex_wait+0xe>
+}
+    30dc:	90                   	nop
+    30dd:	90                   	nop
+    30de:	c9                   	leave
+    30df:	c3                   	ret
+
+00000000000030e0 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    30e0:	55                   	push   %rbp
+    30e1:	48 89 e5             	mov    %rsp,%rbp
+    30e4:	48 83 ec 20          	sub    $0x20,%rsp
+    30e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    30ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    30f3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    30f7:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    30fb:	8b 02                	mov    (%rdx),%eax
+    30fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+    3102:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    3106:	89 c1                	mov    %eax,%ecx
+    3108:	0f 94 c0             	sete   %al
+    310b:	84 c0                	test   %al,%al
+    310d:	75 02                	jne    3111 <mutex_lock+0x31>
+    310f:	89 0a                	mov    %ecx,(%rdx)
+    3111:	83 f0 01             	xor    $0x1,%eax
+    3114:	84 c0                	test   %al,%al
+    3116:	74 0c                	je     3124 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    3118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    311c:	48 89 c7             	mov    %rax,%rdi
+    311f:	e8 8a ff ff ff       	call   30ae <mutex_wait>
+}
+    3124:	90                   	nop
+    3125:	c9                   	leave
+    3126:	c3                   	ret
+
+0000000000003127 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    3127:	55                   	push   %rbp
+    3128:	48 89 e5             	mov    %rsp,%rbp
+    312b:	48 83 ec 10          	sub    $0x10,%rsp
+    312f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    3133:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3137:	ba 00 00 00 00       	mov    $0x0,%edx
+    313c:	87 10                	xchg   %edx,(%rax)
+    313e:	83 fa 02             	cmp    $0x2,%edx
+    3141:	75 11                	jne    3154 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    3143:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3147:	be 01 00 00 00       	mov    $0x1,%esi
+    314c:	48 89 c7             	mov    %rax,%rdi
+    314f:	e8 f0 03 00 00       	call   3544 <futex_wake>
+}
+    3154:	90                   	nop
+    3155:	c9                   	leave
+    3156:	c3                   	ret
+
+0000000000003157 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    3157:	55                   	push   %rbp
+    3158:	48 89 e5             	mov    %rsp,%rbp
+    315b:	48 83 ec 20          	sub    $0x20,%rsp
+    315f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3163:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    3167:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    316b:	48 83 c0 04          	add    $0x4,%rax
+    316f:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    3173:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3177:	8b 00                	mov    (%rax),%eax
+    3179:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    317c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3180:	48 89 c7             	mov    %rax,%rdi
+    3183:	e8 9f ff ff ff       	call   3127 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    3188:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    318c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    318f:	89 d6                	mov    %edx,%esi
+    3191:	48 89 c7             	mov    %rax,%rdi
+    3194:	e8 a0 03 00 00       	call   3539 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    3199:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    319d:	48 83 c0 04          	add    $0x4,%rax
+    31a1:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    31a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    31a9:	48 89 c7             	mov    %rax,%rdi
+    31ac:	e8 fd fe ff ff       	call   30ae <mutex_wait>
+}
+    31b1:	90                   	nop
+    31b2:	c9                   	leave
+    31b3:	c3                   	ret
+
+00000000000031b4 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    31b4:	55                   	push   %rbp
+    31b5:	48 89 e5             	mov    %rsp,%rbp
+    31b8:	48 83 ec 10          	sub    $0x10,%rsp
+    31bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    31c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31c4:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    31c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31cc:	48 83 c0 04          	add    $0x4,%rax
+    31d0:	8b 00                	mov    (%rax),%eax
+    31d2:	85 c0                	test   %eax,%eax
+    31d4:	7e 11                	jle    31e7 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    31d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31da:	be 01 00 00 00       	mov    $0x1,%esi
+    31df:	48 89 c7             	mov    %rax,%rdi
+    31e2:	e8 5d 03 00 00       	call   3544 <futex_wake>
+}
+    31e7:	90                   	nop
+    31e8:	c9                   	leave
+    31e9:	c3                   	ret
+
+00000000000031ea <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    31ea:	55                   	push   %rbp
+    31eb:	48 89 e5             	mov    %rsp,%rbp
+    31ee:	48 83 ec 10          	sub    $0x10,%rsp
+    31f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    31f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31fa:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    31fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3202:	48 83 c0 04          	add    $0x4,%rax
+    3206:	8b 00                	mov    (%rax),%eax
+    3208:	85 c0                	test   %eax,%eax
+    320a:	7e 11                	jle    321d <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    320c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3210:	be 00 00 00 40       	mov    $0x40000000,%esi
+    3215:	48 89 c7             	mov    %rax,%rdi
+    3218:	e8 27 03 00 00       	call   3544 <futex_wake>
+}
+    321d:	90                   	nop
+    321e:	c9                   	leave
+    321f:	c3                   	ret
+
+0000000000003220 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    3220:	55                   	push   %rbp
+    3221:	48 89 e5             	mov    %rsp,%rbp
+    3224:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3228:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    322b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    322f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    3233:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    3237:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    323b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    323f:	8b 40 04             	mov    0x4(%rax),%eax
+    3242:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    3245:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3249:	8b 00                	mov    (%rax),%eax
+    324b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    324e:	29 c2                	sub    %eax,%edx
+    3250:	83 fa 1f             	cmp    $0x1f,%edx
+    3253:	76 07                	jbe    325c <ring_push+0x3c>
+    return -1;
+    3255:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    325a:	eb 7e                	jmp    32da <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    325c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    325f:	83 e0 1f             	and    $0x1f,%eax
+    3262:	89 c2                	mov    %eax,%edx
+    3264:	48 89 d0             	mov    %rdx,%rax
+    3267:	48 01 c0             	add    %rax,%rax
+    326a:	48 01 d0             	add    %rdx,%rax
+    326d:	48 c1 e0 04          	shl    $0x4,%rax
+    3271:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    3275:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3279:	48 01 d0             	add    %rdx,%rax
+    327c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    3280:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3284:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    3287:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    3289:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    328d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3291:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    3295:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3299:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    329d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    32a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32a5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    32a9:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    32ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    32b5:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    32b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32bd:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    32c1:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    32c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    32c8:	8d 50 01             	lea    0x1(%rax),%edx
+    32cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32cf:	48 83 c0 04          	add    $0x4,%rax
+    32d3:	89 10                	mov    %edx,(%rax)
+  return 0;
+    32d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    32da:	5d                   	pop    %rbp
+    32db:	c3                   	ret
+
+00000000000032dc <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    32dc:	55                   	push   %rbp
+    32dd:	48 89 e5             	mov    %rsp,%rbp
+    32e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    32e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    32e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32ec:	8b 40 08             	mov    0x8(%rax),%eax
+    32ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    32f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    32f6:	48 83 c0 0c          	add    $0xc,%rax
+    32fa:	8b 00                	mov    (%rax),%eax
+    32fc:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    32ff:	75 07                	jne    3308 <ring_pop+0x2c>
+    return -1;
+    3301:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    3306:	eb 40                	jmp    3348 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    3308:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    330b:	83 e0 1f             	and    $0x1f,%eax
+    330e:	89 c2                	mov    %eax,%edx
+    3310:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    3314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3318:	89 d2                	mov    %edx,%edx
+    331a:	48 83 c2 61          	add    $0x61,%rdx
+    331e:	48 c1 e2 04          	shl    $0x4,%rdx
+    3322:	48 01 d0             	add    %rdx,%rax
+    3325:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3329:	48 8b 00             	mov    (%rax),%rax
+    332c:	48 89 01             	mov    %rax,(%rcx)
+    332f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    3333:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3336:	8d 50 01             	lea    0x1(%rax),%edx
+    3339:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    333d:	48 83 c0 08          	add    $0x8,%rax
+    3341:	89 10                	mov    %edx,(%rax)
+  return 0;
+    3343:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    3348:	5d                   	pop    %rbp
+    3349:	c3                   	ret
+
+000000000000334a <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    334a:	b8 01 00 00 00       	mov    $0x1,%eax
+    334f:	49 89 ca             	mov    %rcx,%r10
+    3352:	0f 05                	syscall
+    3354:	c3                   	ret
+
+0000000000003355 <_exit>:
+SYSCALL_(exit)
+    3355:	b8 02 00 00 00       	mov    $0x2,%eax
+    335a:	49 89 ca             	mov    %rcx,%r10
+    335d:	0f 05                	syscall
+    335f:	c3                   	ret
+
+0000000000003360 <wait>:
+SYSCALL(wait)
+    3360:	b8 03 00 00 00       	mov    $0x3,%eax
+    3365:	49 89 ca             	mov    %rcx,%r10
+    3368:	0f 05                	syscall
+    336a:	c3                   	ret
+
+000000000000336b <pipe>:
+SYSCALL(pipe)
+    336b:	b8 04 00 00 00       	mov    $0x4,%eax
+    3370:	49 89 ca             	mov    %rcx,%r10
+    3373:	0f 05                	syscall
+    3375:	c3                   	ret
+
+0000000000003376 <read>:
+SYSCALL(read)
+    3376:	b8 05 00 00 00       	mov    $0x5,%eax
+    337b:	49 89 ca             	mov    %rcx,%r10
+    337e:	0f 05                	syscall
+    3380:	c3                   	ret
+
+0000000000003381 <write>:
+SYSCALL(write)
+    3381:	b8 10 00 00 00       	mov    $0x10,%eax
+    3386:	49 89 ca             	mov    %rcx,%r10
+    3389:	0f 05                	syscall
+    338b:	c3                   	ret
+
+000000000000338c <_close>:
+SYSCALL_(close)
+    338c:	b8 15 00 00 00       	mov    $0x15,%eax
+    3391:	49 89 ca             	mov    %rcx,%r10
+    3394:	0f 05                	syscall
+    3396:	c3                   	ret
+
+0000000000003397 <kill>:
+SYSCALL(kill)
+    3397:	b8 06 00 00 00       	mov    $0x6,%eax
+    339c:	49 89 ca             	mov    %rcx,%r10
+    339f:	0f 05                	syscall
+    33a1:	c3                   	ret
+
+00000000000033a2 <_exec>:
+SYSCALL_(exec)
+    33a2:	b8 07 00 00 00       	mov    $0x7,%eax
+    33a7:	49 89 ca             	mov    %rcx,%r10
+    33aa:	0f 05                	syscall
+    33ac:	c3                   	ret
+
+00000000000033ad <open>:
+SYSCALL(open)
+    33ad:	b8 0f 00 00 00       	mov    $0xf,%eax
+    33b2:	49 89 ca             	mov    %rcx,%r10
+    33b5:	0f 05                	syscall
+    33b7:	c3                   	ret
+
+00000000000033b8 <mknod>:
+SYSCALL(mknod)
+    33b8:	b8 11 00 00 00       	mov    $0x11,%eax
+    33bd:	49 89 ca             	mov    %rcx,%r10
+    33c0:	0f 05                	syscall
+    33c2:	c3                   	ret
+
+00000000000033c3 <unlink>:
+SYSCALL(unlink)
+    33c3:	b8 12 00 00 00       	mov    $0x12,%eax
+    33c8:	49 89 ca             	mov    %rcx,%r10
+    33cb:	0f 05                	syscall
+    33cd:	c3                   	ret
+
+00000000000033ce <fstat>:
+SYSCALL(fstat)
+    33ce:	b8 08 00 00 00       	mov    $0x8,%eax
+    33d3:	49 89 ca             	mov    %rcx,%r10
+    33d6:	0f 05                	syscall
+    33d8:	c3                   	ret
+
+00000000000033d9 <link>:
+SYSCALL(link)
+    33d9:	b8 13 00 00 00       	mov    $0x13,%eax
+    33de:	49 89 ca             	mov    %rcx,%r10
+    33e1:	0f 05                	syscall
+    33e3:	c3                   	ret
+
+00000000000033e4 <mkdir>:
+SYSCALL(mkdir)
+    33e4:	b8 14 00 00 00       	mov    $0x14,%eax
+    33e9:	49 89 ca             	mov    %rcx,%r10
+    33ec:	0f 05                	syscall
+    33ee:	c3                   	ret
+
+00000000000033ef <chdir>:
+SYSCALL(chdir)
+    33ef:	b8 09 00 00 00       	mov    $0x9,%eax
+    33f4:	49 89 ca             	mov    %rcx,%r10
+    33f7:	0f 05                	syscall
+    33f9:	c3                   	ret
+
+00000000000033fa <dup>:
+SYSCALL(dup)
+    33fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+    33ff:	49 89 ca             	mov    %rcx,%r10
+    3402:	0f 05                	syscall
+    3404:	c3                   	ret
+
+0000000000003405 <getpid>:
+SYSCALL(getpid)
+    3405:	b8 0b 00 00 00       	mov    $0xb,%eax
+    340a:	49 89 ca             	mov    %rcx,%r10
+    340d:	0f 05                	syscall
+    340f:	c3                   	ret
+
+0000000000003410 <sbrk>:
+SYSCALL(sbrk)
+    3410:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3415:	49 89 ca             	mov    %rcx,%r10
+    3418:	0f 05                	syscall
+    341a:	c3                   	ret
+
+000000000000341b <sleep>:
+SYSCALL(sleep)
+    341b:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3420:	49 89 ca             	mov    %rcx,%r10
+    3423:	0f 05                	syscall
+    3425:	c3                   	ret
+
+0000000000003426 <uptime>:
+SYSCALL(uptime)
+    3426:	b8 0e 00 00 00       	mov    $0xe,%eax
+    342b:	49 89 ca             	mov    %rcx,%r10
+    342e:	0f 05                	syscall
+    3430:	c3                   	ret
+
+0000000000003431 <sysinfo>:
+SYSCALL(sysinfo)
+    3431:	b8 16 00 00 00       	mov    $0x16,%eax
+    3436:	49 89 ca             	mov    %rcx,%r10
+    3439:	0f 05                	syscall
+    343b:	c3                   	ret
+
+000000000000343c <crashn>:
+SYSCALL(crashn)
+    343c:	b8 17 00 00 00       	mov    $0x17,%eax
+    3441:	49 89 ca             	mov    %rcx,%r10
+    3444:	0f 05                	syscall
+    3446:	c3                   	ret
+
+0000000000003447 <mmap>:
+SYSCALL(mmap)
+    3447:	b8 18 00 00 00       	mov    $0x18,%eax
+    344c:	49 89 ca             	mov    %rcx,%r10
+    344f:	0f 05                	syscall
+    3451:	c3                   	ret
+
+0000000000003452 <munmap>:
+SYSCALL(munmap)
+    3452:	b8 19 00 00 00       	mov    $0x19,%eax
+    3457:	49 89 ca             	mov    %rcx,%r10
+    345a:	0f 05                	syscall
+    345c:	c3                   	ret
+
+000000000000345d <nice>:
+SYSCALL(nice)
+    345d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3462:	49 89 ca             	mov    %rcx,%r10
+    3465:	0f 05                	syscall
+    3467:	c3                   	ret
+
+0000000000003468 <_spawn>:
+SYSCALL_(spawn)
+    3468:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    346d:	49 89 ca             	mov    %rcx,%r10
+    3470:	0f 05                	syscall
+    3472:	c3                   	ret
+
+0000000000003473 <pread>:
+SYSCALL(pread)
+    3473:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3478:	49 89 ca             	mov    %rcx,%r10
+    347b:	0f 05                	syscall
+    347d:	c3                   	ret
+
+000000000000347e <pwrite>:
+SYSCALL(pwrite)
+    347e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3483:	49 89 ca             	mov    %rcx,%r10
+    3486:	0f 05                	syscall
+    3488:	c3                   	ret
+
+0000000000003489 <readv>:
+SYSCALL(readv)
+    3489:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    348e:	49 89 ca             	mov    %rcx,%r10
+    3491:	0f 05                	syscall
+    3493:	c3                   	ret
+
+0000000000003494 <writev>:
+SYSCALL(writev)
+    3494:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3499:	49 89 ca             	mov    %rcx,%r10
+    349c:	0f 05                	syscall
+    349e:	c3                   	ret
+
+000000000000349f <sendfile>:
+SYSCALL(sendfile)
+    349f:	b8 20 00 00 00       	mov    $0x20,%eax
+    34a4:	49 89 ca             	mov    %rcx,%r10
+    34a7:	0f 05                	syscall
+    34a9:	c3                   	ret
+
+00000000000034aa <splice>:
+SYSCALL(splice)
+    34aa:	b8 21 00 00 00       	mov    $0x21,%eax
+    34af:	49 89 ca             	mov    %rcx,%r10
+    34b2:	0f 05                	syscall
+    34b4:	c3                   	ret
+
+00000000000034b5 <poll>:
+SYSCALL(poll)
+    34b5:	b8 22 00 00 00       	mov    $0x22,%eax
+    34ba:	49 89 ca             	mov    %rcx,%r10
+    34bd:	0f 05                	syscall
+    34bf:	c3                   	ret
+
+00000000000034c0 <fsync>:
+SYSCALL(fsync)
+    34c0:	b8 23 00 00 00       	mov    $0x23,%eax
+    34c5:	49 89 ca             	mov    %rcx,%r10
+    34c8:	0f 05                	syscall
+    34ca:	c3                   	ret
+
+00000000000034cb <fdatasync>:
+SYSCALL(fdatasync)
+    34cb:	b8 24 00 00 00       	mov    $0x24,%eax
+    34d0:	49 89 ca             	mov    %rcx,%r10
+    34d3:	0f 05                	syscall
+    34d5:	c3                   	ret
+
+00000000000034d6 <lockstat>:
+SYSCALL(lockstat)
+    34d6:	b8 25 00 00 00       	mov    $0x25,%eax
+    34db:	49 89 ca             	mov    %rcx,%r10
+    34de:	0f 05                	syscall
+    34e0:	c3                   	ret
+
+00000000000034e1 <syscallstat>:
+SYSCALL(syscallstat)
+    34e1:	b8 26 00 00 00       	mov    $0x26,%eax
+    34e6:	49 89 ca             	mov    %rcx,%r10
+    34e9:	0f 05                	syscall
+    34eb:	c3                   	ret
+
+00000000000034ec <trace>:
+SYSCALL(trace)
+    34ec:	b8 27 00 00 00       	mov    $0x27,%eax
+    34f1:	49 89 ca             	mov    %rcx,%r10
+    34f4:	0f 05                	syscall
+    34f6:	c3                   	ret
+
+00000000000034f7 <profile>:
+SYSCALL(profile)
+    34f7:	b8 28 00 00 00       	mov    $0x28,%eax
+    34fc:	49 89 ca             	mov    %rcx,%r10
+    34ff:	0f 05                	syscall
+    3501:	c3                   	ret
+
+0000000000003502 <cycles>:
+SYSCALL(cycles)
+    3502:	b8 29 00 00 00       	mov    $0x29,%eax
+    3507:	49 89 ca             	mov    %rcx,%r10
+    350a:	0f 05                	syscall
+    350c:	c3                   	ret
+
+000000000000350d <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    350d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    3512:	49 89 ca             	mov    %rcx,%r10
+    3515:	0f 05                	syscall
+    3517:	c3                   	ret
+
+0000000000003518 <consmode>:
+SYSCALL(consmode)
+    3518:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    351d:	49 89 ca             	mov    %rcx,%r10
+    3520:	0f 05                	syscall
+    3522:	c3                   	ret
+
+0000000000003523 <clone>:
+SYSCALL(clone)
+    3523:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    3528:	49 89 ca             	mov    %rcx,%r10
+    352b:	0f 05                	syscall
+    352d:	c3                   	ret
+
+000000000000352e <join>:
+SYSCALL(join)
+    352e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    3533:	49 89 ca             	mov    %rcx,%r10
+    3536:	0f 05                	syscall
+    3538:	c3                   	ret
+
+0000000000003539 <futex_wait>:
+SYSCALL(futex_wait)
+    3539:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    353e:	49 89 ca             	mov    %rcx,%r10
+    3541:	0f 05                	syscall
+    3543:	c3                   	ret
+
+0000000000003544 <futex_wake>:
+SYSCALL(futex_wake)
+    3544:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    3549:	49 89 ca             	mov    %rcx,%r10
+    354c:	0f 05                	syscall
+    354e:	c3                   	ret
+
+000000000000354f <shmget>:
+SYSCALL(shmget)
+    354f:	b8 30 00 00 00       	mov    $0x30,%eax
+    3554:	49 89 ca             	mov    %rcx,%r10
+    3557:	0f 05                	syscall
+    3559:	c3                   	ret
+
+000000000000355a <shmat>:
+SYSCALL(shmat)
+    355a:	b8 31 00 00 00       	mov    $0x31,%eax
+    355f:	49 89 ca             	mov    %rcx,%r10
+    3562:	0f 05                	syscall
+    3564:	c3                   	ret
+
+0000000000003565 <shmdt>:
+SYSCALL(shmdt)
+    3565:	b8 32 00 00 00       	mov    $0x32,%eax
+    356a:	49 89 ca             	mov    %rcx,%r10
+    356d:	0f 05                	syscall
+    356f:	c3                   	ret
+
+0000000000003570 <ring_setup>:
+SYSCALL(ring_setup)
+    3570:	b8 33 00 00 00       	mov    $0x33,%eax
+    3575:	49 89 ca             	mov    %rcx,%r10
+    3578:	0f 05                	syscall
+    357a:	c3                   	ret
+
+000000000000357b <ring_enter>:
+SYSCALL(ring_enter)
+    357b:	b8 34 00 00 00       	mov    $0x34,%eax
+    3580:	49 89 ca             	mov    %rcx,%r10
+    3583:	0f 05                	syscall
+    3585:	c3                   	ret
+
+0000000000003586 <getdents>:
+SYSCALL(getdents)
+    3586:	b8 35 00 00 00       	mov    $0x35,%eax
+    358b:	49 89 ca             	mov    %rcx,%r10
+    358e:	0f 05                	syscall
+    3590:	c3                   	ret
+
+0000000000003591 <fstatat>:
+SYSCALL(fstatat)
+    3591:	b8 36 00 00 00       	mov    $0x36,%eax
+    3596:	49 89 ca             	mov    %rcx,%r10
+    3599:	0f 05                	syscall
+    359b:	c3                   	ret
+
+000000000000359c <clone_file>:
+SYSCALL(clone_file)
+    359c:	b8 37 00 00 00       	mov    $0x37,%eax
+    35a1:	49 89 ca             	mov    %rcx,%r10
+    35a4:	0f 05                	syscall
+    35a6:	c3                   	ret
+
+00000000000035a7 <fpunch>:
+SYSCALL(fpunch)
+    35a7:	b8 38 00 00 00       	mov    $0x38,%eax
+    35ac:	49 89 ca             	mov    %rcx,%r10
+    35af:	0f 05                	syscall
+    35b1:	c3                   	ret
+
+00000000000035b2 <defrag>:
+SYSCALL(defrag)
+    35b2:	b8 39 00 00 00       	mov    $0x39,%eax
+    35b7:	49 89 ca             	mov    %rcx,%r10
+    35ba:	0f 05                	syscall
+    35bc:	c3                   	ret
+
+00000000000035bd <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    35bd:	55                   	push   %rbp
+    35be:	48 89 e5             	mov    %rsp,%rbp
+    35c1:	48 83 ec 20          	sub    $0x20,%rsp
+    35c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    35c9:	bf 00 00 00 00       	mov    $0x0,%edi
+    35ce:	e8 3d fe ff ff       	call   3410 <sbrk>
+    35d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    35d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    35db:	48 f7 d8             	neg    %rax
+    35de:	25 ff 0f 00 00       	and    $0xfff,%eax
+    35e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    35e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    35eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    35ef:	48 01 c2             	add    %rax,%rdx
+    35f2:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    35f7:	48 39 c2             	cmp    %rax,%rdx
+    35fa:	73 1e                	jae    361a <morecore+0x5d>
+    35fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3600:	89 c2                	mov    %eax,%edx
+    3602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3606:	01 d0                	add    %edx,%eax
+    3608:	89 c7                	mov    %eax,%edi
+    360a:	e8 01 fe ff ff       	call   3410 <sbrk>
+    360f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3613:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    3618:	75 07                	jne    3621 <morecore+0x64>
+    return 0;
+    361a:	b8 00 00 00 00       	mov    $0x0,%eax
+    361f:	eb 27                	jmp    3648 <morecore+0x8b>
+  stats.heap += n + pad;
+    3621:	48 8b 05 68 3b 00 00 	mov    0x3b68(%rip),%rax        # 7190 <stats+0x50>
+    3628:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    362c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3630:	48 01 ca             	add    %rcx,%rdx
+    3633:	48 01 d0             	add    %rdx,%rax
+    3636:	48 89 05 53 3b 00 00 	mov    %rax,0x3b53(%rip)        # 7190 <stats+0x50>
+  return p + pad;
+    363d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3641:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3645:	48 01 d0             	add    %rdx,%rax
+}
+    3648:	c9                   	leave
+    3649:	c3                   	ret
+
+000000000000364a <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    364a:	55                   	push   %rbp
+    364b:	48 89 e5             	mov    %rsp,%rbp
+    364e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    3652:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    3656:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    365d:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    365e:	48 8d 05 bb 3a 00 00 	lea    0x3abb(%rip),%rax        # 7120 <runs>
+    3665:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3669:	eb 1a                	jmp    3685 <pagefree+0x3b>
+    prev = *rp;
+    366b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    366f:	48 8b 00             	mov    (%rax),%rax
+    3672:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    3676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    367a:	48 8b 00             	mov    (%rax),%rax
+    367d:	48 83 c0 08          	add    $0x8,%rax
+    3681:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3689:	48 8b 00             	mov    (%rax),%rax
+    368c:	48 85 c0             	test   %rax,%rax
+    368f:	74 0d                	je     369e <pagefree+0x54>
+    3691:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3695:	48 8b 00             	mov    (%rax),%rax
+    3698:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    369c:	72 cd                	jb     366b <pagefree+0x21>
+  r = (struct run *)p;
+    369e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    36a2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    36a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36aa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    36ae:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    36b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    36b5:	48 8b 10             	mov    (%rax),%rdx
+    36b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36bc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    36c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    36c8:	48 85 c0             	test   %rax,%rax
+    36cb:	74 48                	je     3715 <pagefree+0xcb>
+    36cd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    36d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    36d5:	48 01 c2             	add    %rax,%rdx
+    36d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+    36e0:	48 39 c2             	cmp    %rax,%rdx
+    36e3:	75 30                	jne    3715 <pagefree+0xcb>
+    r->size += r->next->size;
+    36e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36e9:	48 8b 10             	mov    (%rax),%rdx
+    36ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36f0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    36f4:	48 8b 00             	mov    (%rax),%rax
+    36f7:	48 01 c2             	add    %rax,%rdx
+    36fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    36fe:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    3701:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3705:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3709:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    370d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3711:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    3715:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    371a:	74 46                	je     3762 <pagefree+0x118>
+    371c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3720:	48 8b 10             	mov    (%rax),%rdx
+    3723:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3727:	48 01 d0             	add    %rdx,%rax
+    372a:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    372e:	75 32                	jne    3762 <pagefree+0x118>
+    prev->size += r->size;
+    3730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3734:	48 8b 10             	mov    (%rax),%rdx
+    3737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    373b:	48 8b 00             	mov    (%rax),%rax
+    373e:	48 01 c2             	add    %rax,%rdx
+    3741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3745:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    3748:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    374c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3750:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3754:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    3758:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    375c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    3760:	eb 0c                	jmp    376e <pagefree+0x124>
+  } else {
+    *rp = r;
+    3762:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3766:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    376a:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    376d:	90                   	nop
+    376e:	90                   	nop
+    376f:	5d                   	pop    %rbp
+    3770:	c3                   	ret
+
+0000000000003771 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    3771:	55                   	push   %rbp
+    3772:	48 89 e5             	mov    %rsp,%rbp
+    3775:	48 83 ec 40          	sub    $0x40,%rsp
+    3779:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    377d:	48 8d 05 9c 39 00 00 	lea    0x399c(%rip),%rax        # 7120 <runs>
+    3784:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3788:	eb 66                	jmp    37f0 <pagealloc+0x7f>
+    if (r->size == n) {
+    378a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    378e:	48 8b 00             	mov    (%rax),%rax
+    3791:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3795:	75 18                	jne    37af <pagealloc+0x3e>
+      *rp = r->next;
+    3797:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    379b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    379f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37a3:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    37a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37aa:	e9 ca 00 00 00       	jmp    3879 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    37af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37b3:	48 8b 00             	mov    (%rax),%rax
+    37b6:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    37ba:	73 28                	jae    37e4 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    37bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37c0:	48 8b 00             	mov    (%rax),%rax
+    37c3:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    37c7:	48 89 c2             	mov    %rax,%rdx
+    37ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37ce:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    37d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37d5:	48 8b 10             	mov    (%rax),%rdx
+    37d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37dc:	48 01 d0             	add    %rdx,%rax
+    37df:	e9 95 00 00 00       	jmp    3879 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    37e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    37e8:	48 83 c0 08          	add    $0x8,%rax
+    37ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    37f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    37f4:	48 8b 00             	mov    (%rax),%rax
+    37f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    37fb:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3800:	75 88                	jne    378a <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    3802:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3806:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    380a:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    3811:	00 
+    3812:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3816:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    381a:	48 39 c2             	cmp    %rax,%rdx
+    381d:	48 0f 43 c2          	cmovae %rdx,%rax
+    3821:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    3825:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3829:	48 89 c7             	mov    %rax,%rdi
+    382c:	e8 8c fd ff ff       	call   35bd <morecore>
+    3831:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3835:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    383a:	75 07                	jne    3843 <pagealloc+0xd2>
+    return 0;
+    383c:	b8 00 00 00 00       	mov    $0x0,%eax
+    3841:	eb 36                	jmp    3879 <pagealloc+0x108>
+  if (m > n)
+    3843:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3847:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    384b:	73 1a                	jae    3867 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    384d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3851:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3855:	48 89 c2             	mov    %rax,%rdx
+    3858:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    385c:	48 89 d6             	mov    %rdx,%rsi
+    385f:	48 89 c7             	mov    %rax,%rdi
+    3862:	e8 e3 fd ff ff       	call   364a <pagefree>
+  return p + m - n;
+    3867:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    386b:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    386f:	48 89 c2             	mov    %rax,%rdx
+    3872:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3876:	48 01 d0             	add    %rdx,%rax
+}
+    3879:	c9                   	leave
+    387a:	c3                   	ret
+
+000000000000387b <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    387b:	55                   	push   %rbp
+    387c:	48 89 e5             	mov    %rsp,%rbp
+    387f:	48 83 ec 30          	sub    $0x30,%rsp
+    3883:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    3886:	bf 00 10 00 00       	mov    $0x1000,%edi
+    388b:	e8 e1 fe ff ff       	call   3771 <pagealloc>
+    3890:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3894:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3899:	75 0a                	jne    38a5 <refill+0x2a>
+    return -1;
+    389b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    38a0:	e9 da 00 00 00       	jmp    397f <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    38a5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    38ac:	00 
+    38ad:	e9 ba 00 00 00       	jmp    396c <refill+0xf1>
+    b = (struct block *)(p + off);
+    38b2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    38b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    38ba:	48 01 d0             	add    %rdx,%rax
+    38bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    38c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    38c4:	ba 20 00 00 00       	mov    $0x20,%edx
+    38c9:	89 c1                	mov    %eax,%ecx
+    38cb:	48 d3 e2             	shl    %cl,%rdx
+    38ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38d2:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    38d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    38d8:	48 63 d0             	movslq %eax,%rdx
+    38db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38df:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    38e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    38e6:	48 98                	cltq
+    38e8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    38ef:	00 
+    38f0:	48 8d 05 e9 37 00 00 	lea    0x37e9(%rip),%rax        # 70e0 <freelist>
+    38f7:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    38fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38ff:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    3903:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3906:	48 98                	cltq
+    3908:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    390f:	00 
+    3910:	48 8d 15 c9 37 00 00 	lea    0x37c9(%rip),%rdx        # 70e0 <freelist>
+    3917:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    391b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    391f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3922:	48 98                	cltq
+    3924:	48 83 c0 08          	add    $0x8,%rax
+    3928:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    392f:	00 
+    3930:	48 8d 05 0d 38 00 00 	lea    0x380d(%rip),%rax        # 7144 <stats+0x4>
+    3937:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    393a:	8d 48 01             	lea    0x1(%rax),%ecx
+    393d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3940:	48 98                	cltq
+    3942:	48 83 c0 08          	add    $0x8,%rax
+    3946:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    394d:	00 
+    394e:	48 8d 05 ef 37 00 00 	lea    0x37ef(%rip),%rax        # 7144 <stats+0x4>
+    3955:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    3958:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    395b:	ba 20 00 00 00       	mov    $0x20,%edx
+    3960:	89 c1                	mov    %eax,%ecx
+    3962:	48 d3 e2             	shl    %cl,%rdx
+    3965:	48 89 d0             	mov    %rdx,%rax
+    3968:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    396c:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    3973:	00 
+    3974:	0f 86 38 ff ff ff    	jbe    38b2 <refill+0x37>
+  }
+  return 0;
+    397a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    397f:	c9                   	leave
+    3980:	c3                   	ret
+
+0000000000003981 <malloc>:
+
+void *malloc(uint nbytes) {
+    3981:	55                   	push   %rbp
+    3982:	48 89 e5             	mov    %rsp,%rbp
+    3985:	48 83 ec 30          	sub    $0x30,%rsp
+    3989:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    398c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    398f:	48 83 c0 10          	add    $0x10,%rax
+    3993:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    3997:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    399e:	eb 04                	jmp    39a4 <malloc+0x23>
+    39a0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    39a4:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    39a8:	7f 16                	jg     39c0 <malloc+0x3f>
+    39aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    39ad:	ba 20 00 00 00       	mov    $0x20,%edx
+    39b2:	89 c1                	mov    %eax,%ecx
+    39b4:	48 d3 e2             	shl    %cl,%rdx
+    39b7:	48 89 d0             	mov    %rdx,%rax
+    39ba:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    39be:	72 e0                	jb     39a0 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    39c0:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    39c4:	75 7d                	jne    3a43 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    39c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39ca:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    39d0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    39d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    39da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39de:	48 89 c7             	mov    %rax,%rdi
+    39e1:	e8 8b fd ff ff       	call   3771 <pagealloc>
+    39e6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    39ea:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    39ef:	75 0a                	jne    39fb <malloc+0x7a>
+      return 0;
+    39f1:	b8 00 00 00 00       	mov    $0x0,%eax
+    39f6:	e9 2c 01 00 00       	jmp    3b27 <malloc+0x1a6>
+    h->size = n;
+    39fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    39ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3a03:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    3a06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3a0a:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    3a11:	00 
+    stats.inuse[LARGE]++;
+    3a12:	8b 05 48 37 00 00    	mov    0x3748(%rip),%eax        # 7160 <stats+0x20>
+    3a18:	83 c0 01             	add    $0x1,%eax
+    3a1b:	89 05 3f 37 00 00    	mov    %eax,0x373f(%rip)        # 7160 <stats+0x20>
+    stats.large += n;
+    3a21:	48 8b 15 60 37 00 00 	mov    0x3760(%rip),%rdx        # 7188 <stats+0x48>
+    3a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a2c:	48 01 d0             	add    %rdx,%rax
+    3a2f:	48 89 05 52 37 00 00 	mov    %rax,0x3752(%rip)        # 7188 <stats+0x48>
+    return h + 1;
+    3a36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3a3a:	48 83 c0 10          	add    $0x10,%rax
+    3a3e:	e9 e4 00 00 00       	jmp    3b27 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    3a43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3a46:	48 98                	cltq
+    3a48:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3a4f:	00 
+    3a50:	48 8d 05 89 36 00 00 	lea    0x3689(%rip),%rax        # 70e0 <freelist>
+    3a57:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    3a5b:	48 85 c0             	test   %rax,%rax
+    3a5e:	75 18                	jne    3a78 <malloc+0xf7>
+    3a60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3a63:	89 c7                	mov    %eax,%edi
+    3a65:	e8 11 fe ff ff       	call   387b <refill>
+    3a6a:	85 c0                	test   %eax,%eax
+    3a6c:	79 0a                	jns    3a78 <malloc+0xf7>
+    return 0;
+    3a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    3a73:	e9 af 00 00 00       	jmp    3b27 <malloc+0x1a6>
+  b = freelist[c];
+    3a78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3a7b:	48 98                	cltq
+    3a7d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3a84:	00 
+    3a85:	48 8d 05 54 36 00 00 	lea    0x3654(%rip),%rax        # 70e0 <freelist>
+    3a8c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    3a90:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    3a94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3a98:	48 8b 40 10          	mov    0x10(%rax),%rax
+    3a9c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    3a9f:	48 63 d2             	movslq %edx,%rdx
+    3aa2:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3aa9:	00 
+    3aaa:	48 8d 15 2f 36 00 00 	lea    0x362f(%rip),%rdx        # 70e0 <freelist>
+    3ab1:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    3ab5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3ab8:	48 98                	cltq
+    3aba:	48 83 c0 08          	add    $0x8,%rax
+    3abe:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3ac5:	00 
+    3ac6:	48 8d 05 77 36 00 00 	lea    0x3677(%rip),%rax        # 7144 <stats+0x4>
+    3acd:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3ad0:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3ad3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3ad6:	48 98                	cltq
+    3ad8:	48 83 c0 08          	add    $0x8,%rax
+    3adc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3ae3:	00 
+    3ae4:	48 8d 05 59 36 00 00 	lea    0x3659(%rip),%rax        # 7144 <stats+0x4>
+    3aeb:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    3aee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3af1:	48 98                	cltq
+    3af3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3afa:	00 
+    3afb:	48 8d 05 3e 36 00 00 	lea    0x363e(%rip),%rax        # 7140 <stats>
+    3b02:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3b05:	8d 48 01             	lea    0x1(%rax),%ecx
+    3b08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3b0b:	48 98                	cltq
+    3b0d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3b14:	00 
+    3b15:	48 8d 05 24 36 00 00 	lea    0x3624(%rip),%rax        # 7140 <stats>
+    3b1c:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    3b1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b23:	48 83 c0 10          	add    $0x10,%rax
+}
+    3b27:	c9                   	leave
+    3b28:	c3                   	ret
+
+0000000000003b29 <free>:
+
+void free(void *ap) {
+    3b29:	55                   	push   %rbp
+    3b2a:	48 89 e5             	mov    %rsp,%rbp
+    3b2d:	48 83 ec 18          	sub    $0x18,%rsp
+    3b31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    3b35:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3b3a:	0f 84 03 01 00 00    	je     3c43 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    3b40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b44:	48 83 e8 10          	sub    $0x10,%rax
+    3b48:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    3b4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b50:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3b54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    3b58:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    3b5d:	75 42                	jne    3ba1 <free+0x78>
+    stats.inuse[LARGE]--;
+    3b5f:	8b 05 fb 35 00 00    	mov    0x35fb(%rip),%eax        # 7160 <stats+0x20>
+    3b65:	83 e8 01             	sub    $0x1,%eax
+    3b68:	89 05 f2 35 00 00    	mov    %eax,0x35f2(%rip)        # 7160 <stats+0x20>
+    stats.large -= b->h.size;
+    3b6e:	48 8b 15 13 36 00 00 	mov    0x3613(%rip),%rdx        # 7188 <stats+0x48>
+    3b75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b79:	48 8b 00             	mov    (%rax),%rax
+    3b7c:	48 29 c2             	sub    %rax,%rdx
+    3b7f:	48 89 15 02 36 00 00 	mov    %rdx,0x3602(%rip)        # 7188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    3b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b8a:	48 8b 10             	mov    (%rax),%rdx
+    3b8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b91:	48 89 d6             	mov    %rdx,%rsi
+    3b94:	48 89 c7             	mov    %rax,%rdi
+    3b97:	e8 ae fa ff ff       	call   364a <pagefree>
+    return;
+    3b9c:	e9 a3 00 00 00       	jmp    3c44 <free+0x11b>
+  }
+  b->next = freelist[c];
+    3ba1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ba5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3bac:	00 
+    3bad:	48 8d 05 2c 35 00 00 	lea    0x352c(%rip),%rax        # 70e0 <freelist>
+    3bb4:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    3bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bbc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    3bc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3bc4:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    3bcb:	00 
+    3bcc:	48 8d 15 0d 35 00 00 	lea    0x350d(%rip),%rdx        # 70e0 <freelist>
+    3bd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3bd7:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    3bdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3bdf:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3be6:	00 
+    3be7:	48 8d 05 52 35 00 00 	lea    0x3552(%rip),%rax        # 7140 <stats>
+    3bee:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3bf1:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3bf4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3bf8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3bff:	00 
+    3c00:	48 8d 05 39 35 00 00 	lea    0x3539(%rip),%rax        # 7140 <stats>
+    3c07:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    3c0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c0e:	48 83 c0 08          	add    $0x8,%rax
+    3c12:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3c19:	00 
+    3c1a:	48 8d 05 23 35 00 00 	lea    0x3523(%rip),%rax        # 7144 <stats+0x4>
+    3c21:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3c24:	8d 48 01             	lea    0x1(%rax),%ecx
+    3c27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c2b:	48 83 c0 08          	add    $0x8,%rax
+    3c2f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3c36:	00 
+    3c37:	48 8d 05 06 35 00 00 	lea    0x3506(%rip),%rax        # 7144 <stats+0x4>
+    3c3e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    3c41:	eb 01                	jmp    3c44 <free+0x11b>
+    return;
+    3c43:	90                   	nop
+}
+    3c44:	c9                   	leave
+    3c45:	c3                   	ret
+
+0000000000003c46 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    3c46:	55                   	push   %rbp
+    3c47:	48 89 e5             	mov    %rsp,%rbp
+    3c4a:	48 83 ec 30          	sub    $0x30,%rsp
+    3c4e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    3c51:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3c54:	48 8d 15 d5 0a 00 00 	lea    0xad5(%rip),%rdx        # 4730 <benchreport+0x9c2>
+    3c5b:	48 89 d6             	mov    %rdx,%rsi
+    3c5e:	89 c7                	mov    %eax,%edi
+    3c60:	b8 00 00 00 00       	mov    $0x0,%eax
+    3c65:	e8 37 e6 ff ff       	call   22a1 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3c6a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    3c71:	eb 67                	jmp    3cda <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    3c73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3c76:	48 98                	cltq
+    3c78:	48 83 c0 08          	add    $0x8,%rax
+    3c7c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3c83:	00 
+    3c84:	48 8d 05 b9 34 00 00 	lea    0x34b9(%rip),%rax        # 7144 <stats+0x4>
+    3c8b:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    3c8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3c91:	48 98                	cltq
+    3c93:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3c9a:	00 
+    3c9b:	48 8d 05 9e 34 00 00 	lea    0x349e(%rip),%rax        # 7140 <stats>
+    3ca2:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    3ca5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3ca8:	ba 20 00 00 00       	mov    $0x20,%edx
+    3cad:	89 c1                	mov    %eax,%ecx
+    3caf:	48 d3 e2             	shl    %cl,%rdx
+    3cb2:	48 89 d0             	mov    %rdx,%rax
+    3cb5:	89 c1                	mov    %eax,%ecx
+    3cb7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    3cba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3cbd:	41 89 f9             	mov    %edi,%r9d
+    3cc0:	41 89 f0             	mov    %esi,%r8d
+    3cc3:	48 8d 35 7d 0a 00 00 	lea    0xa7d(%rip),%rsi        # 4747 <benchreport+0x9d9>
+    3cca:	89 c7                	mov    %eax,%edi
+    3ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+    3cd1:	e8 cb e5 ff ff       	call   22a1 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3cd6:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    3cda:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    3cde:	7e 93                	jle    3c73 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    3ce0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3ce7:	00 
+  for (r = runs; r; r = r->next)
+    3ce8:	48 8b 05 31 34 00 00 	mov    0x3431(%rip),%rax        # 7120 <runs>
+    3cef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3cf3:	eb 17                	jmp    3d0c <mallocstats+0xc6>
+    nfree += r->size;
+    3cf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3cf9:	48 8b 00             	mov    (%rax),%rax
+    3cfc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    3d00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3d04:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3d08:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3d0c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    3d11:	75 e2                	jne    3cf5 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    3d13:	48 8b 05 76 34 00 00 	mov    0x3476(%rip),%rax        # 7190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3d1a:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3d1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3d20:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3d24:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3d26:	48 8b 05 5b 34 00 00 	mov    0x345b(%rip),%rax        # 7188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3d2d:	89 c1                	mov    %eax,%ecx
+    3d2f:	8b 15 2b 34 00 00    	mov    0x342b(%rip),%edx        # 7160 <stats+0x20>
+    3d35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3d38:	41 89 f9             	mov    %edi,%r9d
+    3d3b:	41 89 f0             	mov    %esi,%r8d
+    3d3e:	48 8d 35 13 0a 00 00 	lea    0xa13(%rip),%rsi        # 4758 <benchreport+0x9ea>
+    3d45:	89 c7                	mov    %eax,%edi
+    3d47:	b8 00 00 00 00       	mov    $0x0,%eax
+    3d4c:	e8 50 e5 ff ff       	call   22a1 <printf>
+}
+    3d51:	90                   	nop
+    3d52:	c9                   	leave
+    3d53:	c3                   	ret
+
+0000000000003d54 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    3d54:	55                   	push   %rbp
+    3d55:	48 89 e5             	mov    %rsp,%rbp
+    3d58:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    3d5c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    3d60:	48 89 c7             	mov    %rax,%rdi
+    3d63:	e8 9a f7 ff ff       	call   3502 <cycles>
+  return t;
+    3d68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    3d6c:	c9                   	leave
+    3d6d:	c3                   	ret
+
+0000000000003d6e <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    3d6e:	55                   	push   %rbp
+    3d6f:	48 89 e5             	mov    %rsp,%rbp
+    3d72:	48 83 ec 30          	sub    $0x30,%rsp
+    3d76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3d7a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3d7e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    3d81:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    3d85:	0f 8e 24 01 00 00    	jle    3eaf <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    3d8b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    3d92:	e9 98 00 00 00       	jmp    3e2f <benchreport+0xc1>
+    x = t[i];
+    3d97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3d9a:	48 98                	cltq
+    3d9c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3da3:	00 
+    3da4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3da8:	48 01 d0             	add    %rdx,%rax
+    3dab:	48 8b 00             	mov    (%rax),%rax
+    3dae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3db2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3db5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    3db8:	eb 33                	jmp    3ded <benchreport+0x7f>
+      t[j] = t[j - 1];
+    3dba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3dbd:	48 98                	cltq
+    3dbf:	48 c1 e0 03          	shl    $0x3,%rax
+    3dc3:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3dc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3dcb:	48 01 d0             	add    %rdx,%rax
+    3dce:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    3dd1:	48 63 d2             	movslq %edx,%rdx
+    3dd4:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3ddb:	00 
+    3ddc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3de0:	48 01 ca             	add    %rcx,%rdx
+    3de3:	48 8b 00             	mov    (%rax),%rax
+    3de6:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3de9:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    3ded:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    3df1:	7e 1d                	jle    3e10 <benchreport+0xa2>
+    3df3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3df6:	48 98                	cltq
+    3df8:	48 c1 e0 03          	shl    $0x3,%rax
+    3dfc:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3e00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e04:	48 01 d0             	add    %rdx,%rax
+    3e07:	48 8b 00             	mov    (%rax),%rax
+    3e0a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    3e0e:	72 aa                	jb     3dba <benchreport+0x4c>
+    t[j] = x;
+    3e10:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3e13:	48 98                	cltq
+    3e15:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3e1c:	00 
+    3e1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e21:	48 01 c2             	add    %rax,%rdx
+    3e24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3e28:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    3e2b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    3e2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3e32:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    3e35:	0f 8c 5c ff ff ff    	jl     3d97 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    3e3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3e3e:	48 98                	cltq
+    3e40:	48 c1 e0 03          	shl    $0x3,%rax
+    3e44:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3e48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e4c:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    3e4f:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    3e52:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3e55:	89 c2                	mov    %eax,%edx
+    3e57:	c1 ea 1f             	shr    $0x1f,%edx
+    3e5a:	01 d0                	add    %edx,%eax
+    3e5c:	d1 f8                	sar    %eax
+    3e5e:	48 98                	cltq
+    3e60:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3e67:	00 
+    3e68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e6c:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    3e6f:	48 8b 38             	mov    (%rax),%rdi
+    3e72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3e76:	48 8b 30             	mov    (%rax),%rsi
+    3e79:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    3e7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3e80:	48 83 ec 08          	sub    $0x8,%rsp
+    3e84:	51                   	push   %rcx
+    3e85:	49 89 f9             	mov    %rdi,%r9
+    3e88:	49 89 f0             	mov    %rsi,%r8
+    3e8b:	89 d1                	mov    %edx,%ecx
+    3e8d:	48 89 c2             	mov    %rax,%rdx
+    3e90:	48 8d 05 01 09 00 00 	lea    0x901(%rip),%rax        # 4798 <benchreport+0xa2a>
+    3e97:	48 89 c6             	mov    %rax,%rsi
+    3e9a:	bf 01 00 00 00       	mov    $0x1,%edi
+    3e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+    3ea4:	e8 f8 e3 ff ff       	call   22a1 <printf>
+    3ea9:	48 83 c4 10          	add    $0x10,%rsp
+    3ead:	eb 01                	jmp    3eb0 <benchreport+0x142>
+    return;
+    3eaf:	90                   	nop
+}
+    3eb0:	c9                   	leave
+    3eb1:	c3                   	ret
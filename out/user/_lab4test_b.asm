@@ -0,0 +1,5127 @@
+
+out/user/_lab4test_b:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <concurrent_dup_test>:
+      while (1)                                                                \
+        ;                                                                      \
+    }                                                                          \
+  } while (0)
+
+void concurrent_dup_test() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, pid, fd1, fd2, fd3, fd4;
+
+  fd1 = open("concurrent_dup.txt", O_CREATE | O_RDWR);
+       8:	be 02 02 00 00       	mov    $0x202,%esi
+       d:	48 8d 05 04 35 00 00 	lea    0x3504(%rip),%rax        # 3518 <benchreport+0x14a>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 f1 29 00 00       	call   2a0d <open>
+      1c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  assert(fd1 == 3);
+      1f:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+      23:	74 2b                	je     50 <concurrent_dup_test+0x50>
+      25:	8b 05 d5 4f 00 00    	mov    0x4fd5(%rip),%eax        # 5000 <stdout>
+      2b:	48 8d 15 f9 34 00 00 	lea    0x34f9(%rip),%rdx        # 352b <benchreport+0x15d>
+      32:	48 89 d1             	mov    %rdx,%rcx
+      35:	ba 1f 00 00 00       	mov    $0x1f,%edx
+      3a:	48 8d 35 f7 34 00 00 	lea    0x34f7(%rip),%rsi        # 3538 <benchreport+0x16a>
+      41:	89 c7                	mov    %eax,%edi
+      43:	b8 00 00 00 00       	mov    $0x0,%eax
+      48:	e8 b4 18 00 00       	call   1901 <printf>
+      4d:	90                   	nop
+      4e:	eb fd                	jmp    4d <concurrent_dup_test+0x4d>
+
+  for (i = 0; i < 50; i++) {
+      50:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      57:	e9 27 02 00 00       	jmp    283 <concurrent_dup_test+0x283>
+    pid = fork();
+      5c:	e8 c0 1e 00 00       	call   1f21 <fork>
+      61:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (pid == 0) {
+      64:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+      68:	0f 85 ad 01 00 00    	jne    21b <concurrent_dup_test+0x21b>
+      fd2 = dup(fd1);
+      6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      71:	89 c7                	mov    %eax,%edi
+      73:	e8 e2 29 00 00       	call   2a5a <dup>
+      78:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      assert(fd2 == 4);
+      7b:	83 7d f0 04          	cmpl   $0x4,-0x10(%rbp)
+      7f:	74 2b                	je     ac <concurrent_dup_test+0xac>
+      81:	8b 05 79 4f 00 00    	mov    0x4f79(%rip),%eax        # 5000 <stdout>
+      87:	48 8d 15 ca 34 00 00 	lea    0x34ca(%rip),%rdx        # 3558 <benchreport+0x18a>
+      8e:	48 89 d1             	mov    %rdx,%rcx
+      91:	ba 25 00 00 00       	mov    $0x25,%edx
+      96:	48 8d 35 9b 34 00 00 	lea    0x349b(%rip),%rsi        # 3538 <benchreport+0x16a>
+      9d:	89 c7                	mov    %eax,%edi
+      9f:	b8 00 00 00 00       	mov    $0x0,%eax
+      a4:	e8 58 18 00 00       	call   1901 <printf>
+      a9:	90                   	nop
+      aa:	eb fd                	jmp    a9 <concurrent_dup_test+0xa9>
+      fd3 = dup(fd1);
+      ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      af:	89 c7                	mov    %eax,%edi
+      b1:	e8 a4 29 00 00       	call   2a5a <dup>
+      b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+      assert(fd3 == 5);
+      b9:	83 7d ec 05          	cmpl   $0x5,-0x14(%rbp)
+      bd:	74 2b                	je     ea <concurrent_dup_test+0xea>
+      bf:	8b 05 3b 4f 00 00    	mov    0x4f3b(%rip),%eax        # 5000 <stdout>
+      c5:	48 8d 15 95 34 00 00 	lea    0x3495(%rip),%rdx        # 3561 <benchreport+0x193>
+      cc:	48 89 d1             	mov    %rdx,%rcx
+      cf:	ba 27 00 00 00       	mov    $0x27,%edx
+      d4:	48 8d 35 5d 34 00 00 	lea    0x345d(%rip),%rsi        # 3538 <benchreport+0x16a>
+      db:	89 c7                	mov    %eax,%edi
+      dd:	b8 00 00 00 00       	mov    $0x0,%eax
+      e2:	e8 1a 18 00 00       	call   1901 <printf>
+      e7:	90                   	nop
+      e8:	eb fd                	jmp    e7 <concurrent_dup_test+0xe7>
+      fd4 = dup(fd1);
+      ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ed:	89 c7                	mov    %eax,%edi
+      ef:	e8 66 29 00 00       	call   2a5a <dup>
+      f4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      assert(fd4 == 6);
+      f7:	83 7d e8 06          	cmpl   $0x6,-0x18(%rbp)
+      fb:	74 2b                	je     128 <concurrent_dup_test+0x128>
+      fd:	8b 05 fd 4e 00 00    	mov    0x4efd(%rip),%eax        # 5000 <stdout>
+     103:	48 8d 15 60 34 00 00 	lea    0x3460(%rip),%rdx        # 356a <benchreport+0x19c>
+     10a:	48 89 d1             	mov    %rdx,%rcx
+     10d:	ba 29 00 00 00       	mov    $0x29,%edx
+     112:	48 8d 35 1f 34 00 00 	lea    0x341f(%rip),%rsi        # 3538 <benchreport+0x16a>
+     119:	89 c7                	mov    %eax,%edi
+     11b:	b8 00 00 00 00       	mov    $0x0,%eax
+     120:	e8 dc 17 00 00       	call   1901 <printf>
+     125:	90                   	nop
+     126:	eb fd                	jmp    125 <concurrent_dup_test+0x125>
+
+      sleep(50);
+     128:	bf 32 00 00 00       	mov    $0x32,%edi
+     12d:	e8 49 29 00 00       	call   2a7b <sleep>
+
+      assert(close(fd1) >= 0);
+     132:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     135:	89 c7                	mov    %eax,%edi
+     137:	e8 5f 1e 00 00       	call   1f9b <close>
+     13c:	85 c0                	test   %eax,%eax
+     13e:	79 2b                	jns    16b <concurrent_dup_test+0x16b>
+     140:	8b 05 ba 4e 00 00    	mov    0x4eba(%rip),%eax        # 5000 <stdout>
+     146:	48 8d 15 26 34 00 00 	lea    0x3426(%rip),%rdx        # 3573 <benchreport+0x1a5>
+     14d:	48 89 d1             	mov    %rdx,%rcx
+     150:	ba 2d 00 00 00       	mov    $0x2d,%edx
+     155:	48 8d 35 dc 33 00 00 	lea    0x33dc(%rip),%rsi        # 3538 <benchreport+0x16a>
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	b8 00 00 00 00       	mov    $0x0,%eax
+     163:	e8 99 17 00 00       	call   1901 <printf>
+     168:	90                   	nop
+     169:	eb fd                	jmp    168 <concurrent_dup_test+0x168>
+      assert(close(fd2) >= 0);
+     16b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     16e:	89 c7                	mov    %eax,%edi
+     170:	e8 26 1e 00 00       	call   1f9b <close>
+     175:	85 c0                	test   %eax,%eax
+     177:	79 2b                	jns    1a4 <concurrent_dup_test+0x1a4>
+     179:	8b 05 81 4e 00 00    	mov    0x4e81(%rip),%eax        # 5000 <stdout>
+     17f:	48 8d 15 fd 33 00 00 	lea    0x33fd(%rip),%rdx        # 3583 <benchreport+0x1b5>
+     186:	48 89 d1             	mov    %rdx,%rcx
+     189:	ba 2e 00 00 00       	mov    $0x2e,%edx
+     18e:	48 8d 35 a3 33 00 00 	lea    0x33a3(%rip),%rsi        # 3538 <benchreport+0x16a>
+     195:	89 c7                	mov    %eax,%edi
+     197:	b8 00 00 00 00       	mov    $0x0,%eax
+     19c:	e8 60 17 00 00       	call   1901 <printf>
+     1a1:	90                   	nop
+     1a2:	eb fd                	jmp    1a1 <concurrent_dup_test+0x1a1>
+      assert(close(fd3) >= 0);
+     1a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1a7:	89 c7                	mov    %eax,%edi
+     1a9:	e8 ed 1d 00 00       	call   1f9b <close>
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 2b                	jns    1dd <concurrent_dup_test+0x1dd>
+     1b2:	8b 05 48 4e 00 00    	mov    0x4e48(%rip),%eax        # 5000 <stdout>
+     1b8:	48 8d 15 d4 33 00 00 	lea    0x33d4(%rip),%rdx        # 3593 <benchreport+0x1c5>
+     1bf:	48 89 d1             	mov    %rdx,%rcx
+     1c2:	ba 2f 00 00 00       	mov    $0x2f,%edx
+     1c7:	48 8d 35 6a 33 00 00 	lea    0x336a(%rip),%rsi        # 3538 <benchreport+0x16a>
+     1ce:	89 c7                	mov    %eax,%edi
+     1d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d5:	e8 27 17 00 00       	call   1901 <printf>
+     1da:	90                   	nop
+     1db:	eb fd                	jmp    1da <concurrent_dup_test+0x1da>
+      assert(close(fd4) >= 0);
+     1dd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     1e0:	89 c7                	mov    %eax,%edi
+     1e2:	e8 b4 1d 00 00       	call   1f9b <close>
+     1e7:	85 c0                	test   %eax,%eax
+     1e9:	79 2b                	jns    216 <concurrent_dup_test+0x216>
+     1eb:	8b 05 0f 4e 00 00    	mov    0x4e0f(%rip),%eax        # 5000 <stdout>
+     1f1:	48 8d 15 ab 33 00 00 	lea    0x33ab(%rip),%rdx        # 35a3 <benchreport+0x1d5>
+     1f8:	48 89 d1             	mov    %rdx,%rcx
+     1fb:	ba 30 00 00 00       	mov    $0x30,%edx
+     200:	48 8d 35 31 33 00 00 	lea    0x3331(%rip),%rsi        # 3538 <benchreport+0x16a>
+     207:	89 c7                	mov    %eax,%edi
+     209:	b8 00 00 00 00       	mov    $0x0,%eax
+     20e:	e8 ee 16 00 00       	call   1901 <printf>
+     213:	90                   	nop
+     214:	eb fd                	jmp    213 <concurrent_dup_test+0x213>
+      exit();
+     216:	e8 16 1d 00 00       	call   1f31 <exit>
+    } else if (pid < 0) {
+     21b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     21f:	79 5e                	jns    27f <concurrent_dup_test+0x27f>
+      error("fork() failed");
+     221:	8b 05 d9 4d 00 00    	mov    0x4dd9(%rip),%eax        # 5000 <stdout>
+     227:	ba 33 00 00 00       	mov    $0x33,%edx
+     22c:	48 8d 0d 80 33 00 00 	lea    0x3380(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     233:	48 89 ce             	mov    %rcx,%rsi
+     236:	89 c7                	mov    %eax,%edi
+     238:	b8 00 00 00 00       	mov    $0x0,%eax
+     23d:	e8 bf 16 00 00       	call   1901 <printf>
+     242:	8b 05 b8 4d 00 00    	mov    0x4db8(%rip),%eax        # 5000 <stdout>
+     248:	48 8d 15 76 33 00 00 	lea    0x3376(%rip),%rdx        # 35c5 <benchreport+0x1f7>
+     24f:	48 89 d6             	mov    %rdx,%rsi
+     252:	89 c7                	mov    %eax,%edi
+     254:	b8 00 00 00 00       	mov    $0x0,%eax
+     259:	e8 a3 16 00 00       	call   1901 <printf>
+     25e:	8b 05 9c 4d 00 00    	mov    0x4d9c(%rip),%eax        # 5000 <stdout>
+     264:	48 8d 15 68 33 00 00 	lea    0x3368(%rip),%rdx        # 35d3 <benchreport+0x205>
+     26b:	48 89 d6             	mov    %rdx,%rsi
+     26e:	89 c7                	mov    %eax,%edi
+     270:	b8 00 00 00 00       	mov    $0x0,%eax
+     275:	e8 87 16 00 00       	call   1901 <printf>
+     27a:	e8 b2 1c 00 00       	call   1f31 <exit>
+  for (i = 0; i < 50; i++) {
+     27f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     283:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     287:	0f 8e cf fd ff ff    	jle    5c <concurrent_dup_test+0x5c>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     28d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     294:	eb 09                	jmp    29f <concurrent_dup_test+0x29f>
+    wait();
+     296:	e8 25 27 00 00       	call   29c0 <wait>
+  for (i = 0; i < 50; i++) {
+     29b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     29f:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     2a3:	7e f1                	jle    296 <concurrent_dup_test+0x296>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     2a5:	e8 16 27 00 00       	call   29c0 <wait>
+     2aa:	85 c0                	test   %eax,%eax
+     2ac:	78 5e                	js     30c <concurrent_dup_test+0x30c>
+    error("ghost child!");
+     2ae:	8b 05 4c 4d 00 00    	mov    0x4d4c(%rip),%eax        # 5000 <stdout>
+     2b4:	ba 3d 00 00 00       	mov    $0x3d,%edx
+     2b9:	48 8d 0d f3 32 00 00 	lea    0x32f3(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     2c0:	48 89 ce             	mov    %rcx,%rsi
+     2c3:	89 c7                	mov    %eax,%edi
+     2c5:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ca:	e8 32 16 00 00       	call   1901 <printf>
+     2cf:	8b 05 2b 4d 00 00    	mov    0x4d2b(%rip),%eax        # 5000 <stdout>
+     2d5:	48 8d 15 f9 32 00 00 	lea    0x32f9(%rip),%rdx        # 35d5 <benchreport+0x207>
+     2dc:	48 89 d6             	mov    %rdx,%rsi
+     2df:	89 c7                	mov    %eax,%edi
+     2e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     2e6:	e8 16 16 00 00       	call   1901 <printf>
+     2eb:	8b 05 0f 4d 00 00    	mov    0x4d0f(%rip),%eax        # 5000 <stdout>
+     2f1:	48 8d 15 db 32 00 00 	lea    0x32db(%rip),%rdx        # 35d3 <benchreport+0x205>
+     2f8:	48 89 d6             	mov    %rdx,%rsi
+     2fb:	89 c7                	mov    %eax,%edi
+     2fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     302:	e8 fa 15 00 00       	call   1901 <printf>
+     307:	e8 25 1c 00 00       	call   1f31 <exit>
+  }
+
+  assert(close(fd1) >= 0);
+     30c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     30f:	89 c7                	mov    %eax,%edi
+     311:	e8 85 1c 00 00       	call   1f9b <close>
+     316:	85 c0                	test   %eax,%eax
+     318:	79 2b                	jns    345 <concurrent_dup_test+0x345>
+     31a:	8b 05 e0 4c 00 00    	mov    0x4ce0(%rip),%eax        # 5000 <stdout>
+     320:	48 8d 15 4c 32 00 00 	lea    0x324c(%rip),%rdx        # 3573 <benchreport+0x1a5>
+     327:	48 89 d1             	mov    %rdx,%rcx
+     32a:	ba 40 00 00 00       	mov    $0x40,%edx
+     32f:	48 8d 35 02 32 00 00 	lea    0x3202(%rip),%rsi        # 3538 <benchreport+0x16a>
+     336:	89 c7                	mov    %eax,%edi
+     338:	b8 00 00 00 00       	mov    $0x0,%eax
+     33d:	e8 bf 15 00 00       	call   1901 <printf>
+     342:	90                   	nop
+     343:	eb fd                	jmp    342 <concurrent_dup_test+0x342>
+  printf(stdout, "concurrent dup test OK\n");
+     345:	8b 05 b5 4c 00 00    	mov    0x4cb5(%rip),%eax        # 5000 <stdout>
+     34b:	48 8d 15 90 32 00 00 	lea    0x3290(%rip),%rdx        # 35e2 <benchreport+0x214>
+     352:	48 89 d6             	mov    %rdx,%rsi
+     355:	89 c7                	mov    %eax,%edi
+     357:	b8 00 00 00 00       	mov    $0x0,%eax
+     35c:	e8 a0 15 00 00       	call   1901 <printf>
+}
+     361:	90                   	nop
+     362:	c9                   	leave
+     363:	c3                   	ret
+
+0000000000000364 <concurrent_create_test>:
+
+void concurrent_create_test() {
+     364:	55                   	push   %rbp
+     365:	48 89 e5             	mov    %rsp,%rbp
+     368:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, j, pid, fd, ret;
+  char buf[5];
+
+  fd = open("cc_create.txt", O_CREATE | O_WRONLY);
+     36c:	be 01 02 00 00       	mov    $0x201,%esi
+     371:	48 8d 05 82 32 00 00 	lea    0x3282(%rip),%rax        # 35fa <benchreport+0x22c>
+     378:	48 89 c7             	mov    %rax,%rdi
+     37b:	e8 8d 26 00 00       	call   2a0d <open>
+     380:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     383:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     387:	74 2b                	je     3b4 <concurrent_create_test+0x50>
+     389:	8b 05 71 4c 00 00    	mov    0x4c71(%rip),%eax        # 5000 <stdout>
+     38f:	48 8d 15 72 32 00 00 	lea    0x3272(%rip),%rdx        # 3608 <benchreport+0x23a>
+     396:	48 89 d1             	mov    %rdx,%rcx
+     399:	ba 49 00 00 00       	mov    $0x49,%edx
+     39e:	48 8d 35 93 31 00 00 	lea    0x3193(%rip),%rsi        # 3538 <benchreport+0x16a>
+     3a5:	89 c7                	mov    %eax,%edi
+     3a7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ac:	e8 50 15 00 00       	call   1901 <printf>
+     3b1:	90                   	nop
+     3b2:	eb fd                	jmp    3b1 <concurrent_create_test+0x4d>
+
+  memset(buf, 0, 5);
+     3b4:	48 8d 45 e7          	lea    -0x19(%rbp),%rax
+     3b8:	ba 05 00 00 00       	mov    $0x5,%edx
+     3bd:	be 00 00 00 00       	mov    $0x0,%esi
+     3c2:	48 89 c7             	mov    %rax,%rdi
+     3c5:	e8 59 1f 00 00       	call   2323 <memset>
+  for (i = 0; i < 1000; i++) {
+     3ca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     3d1:	eb 4a                	jmp    41d <concurrent_create_test+0xb9>
+    assert(write(fd, buf, 5) == 5);
+     3d3:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     3d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     3da:	ba 05 00 00 00       	mov    $0x5,%edx
+     3df:	48 89 ce             	mov    %rcx,%rsi
+     3e2:	89 c7                	mov    %eax,%edi
+     3e4:	e8 f8 25 00 00       	call   29e1 <write>
+     3e9:	83 f8 05             	cmp    $0x5,%eax
+     3ec:	74 2b                	je     419 <concurrent_create_test+0xb5>
+     3ee:	8b 05 0c 4c 00 00    	mov    0x4c0c(%rip),%eax        # 5000 <stdout>
+     3f4:	48 8d 15 15 32 00 00 	lea    0x3215(%rip),%rdx        # 3610 <benchreport+0x242>
+     3fb:	48 89 d1             	mov    %rdx,%rcx
+     3fe:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     403:	48 8d 35 2e 31 00 00 	lea    0x312e(%rip),%rsi        # 3538 <benchreport+0x16a>
+     40a:	89 c7                	mov    %eax,%edi
+     40c:	b8 00 00 00 00       	mov    $0x0,%eax
+     411:	e8 eb 14 00 00       	call   1901 <printf>
+     416:	90                   	nop
+     417:	eb fd                	jmp    416 <concurrent_create_test+0xb2>
+  for (i = 0; i < 1000; i++) {
+     419:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     41d:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+     424:	7e ad                	jle    3d3 <concurrent_create_test+0x6f>
+  }
+
+  assert(close(fd) >= 0);
+     426:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     429:	89 c7                	mov    %eax,%edi
+     42b:	e8 6b 1b 00 00       	call   1f9b <close>
+     430:	85 c0                	test   %eax,%eax
+     432:	79 2b                	jns    45f <concurrent_create_test+0xfb>
+     434:	8b 05 c6 4b 00 00    	mov    0x4bc6(%rip),%eax        # 5000 <stdout>
+     43a:	48 8d 15 e6 31 00 00 	lea    0x31e6(%rip),%rdx        # 3627 <benchreport+0x259>
+     441:	48 89 d1             	mov    %rdx,%rcx
+     444:	ba 50 00 00 00       	mov    $0x50,%edx
+     449:	48 8d 35 e8 30 00 00 	lea    0x30e8(%rip),%rsi        # 3538 <benchreport+0x16a>
+     450:	89 c7                	mov    %eax,%edi
+     452:	b8 00 00 00 00       	mov    $0x0,%eax
+     457:	e8 a5 14 00 00       	call   1901 <printf>
+     45c:	90                   	nop
+     45d:	eb fd                	jmp    45c <concurrent_create_test+0xf8>
+
+  for (i = 0; i < 50; i++) {
+     45f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     466:	e9 d3 01 00 00       	jmp    63e <concurrent_create_test+0x2da>
+    pid = fork();
+     46b:	e8 b1 1a 00 00       	call   1f21 <fork>
+     470:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid == 0) {
+     473:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     477:	0f 85 59 01 00 00    	jne    5d6 <concurrent_create_test+0x272>
+      fd = open("cc_create.txt", O_CREATE | O_RDWR);
+     47d:	be 02 02 00 00       	mov    $0x202,%esi
+     482:	48 8d 05 71 31 00 00 	lea    0x3171(%rip),%rax        # 35fa <benchreport+0x22c>
+     489:	48 89 c7             	mov    %rax,%rdi
+     48c:	e8 7c 25 00 00       	call   2a0d <open>
+     491:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      assert(fd == 3);
+     494:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     498:	74 2b                	je     4c5 <concurrent_create_test+0x161>
+     49a:	8b 05 60 4b 00 00    	mov    0x4b60(%rip),%eax        # 5000 <stdout>
+     4a0:	48 8d 15 61 31 00 00 	lea    0x3161(%rip),%rdx        # 3608 <benchreport+0x23a>
+     4a7:	48 89 d1             	mov    %rdx,%rcx
+     4aa:	ba 56 00 00 00       	mov    $0x56,%edx
+     4af:	48 8d 35 82 30 00 00 	lea    0x3082(%rip),%rsi        # 3538 <benchreport+0x16a>
+     4b6:	89 c7                	mov    %eax,%edi
+     4b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4bd:	e8 3f 14 00 00       	call   1901 <printf>
+     4c2:	90                   	nop
+     4c3:	eb fd                	jmp    4c2 <concurrent_create_test+0x15e>
+
+      j = 100 * i;
+     4c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4c8:	6b c0 64             	imul   $0x64,%eax,%eax
+     4cb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      while (j > 0) {
+     4ce:	eb 50                	jmp    520 <concurrent_create_test+0x1bc>
+        assert((ret = read(fd, buf, 5)) >= 0);
+     4d0:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     4d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4d7:	ba 05 00 00 00       	mov    $0x5,%edx
+     4dc:	48 89 ce             	mov    %rcx,%rsi
+     4df:	89 c7                	mov    %eax,%edi
+     4e1:	e8 f0 24 00 00       	call   29d6 <read>
+     4e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     4e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     4ed:	79 2b                	jns    51a <concurrent_create_test+0x1b6>
+     4ef:	8b 05 0b 4b 00 00    	mov    0x4b0b(%rip),%eax        # 5000 <stdout>
+     4f5:	48 8d 15 3a 31 00 00 	lea    0x313a(%rip),%rdx        # 3636 <benchreport+0x268>
+     4fc:	48 89 d1             	mov    %rdx,%rcx
+     4ff:	ba 5a 00 00 00       	mov    $0x5a,%edx
+     504:	48 8d 35 2d 30 00 00 	lea    0x302d(%rip),%rsi        # 3538 <benchreport+0x16a>
+     50b:	89 c7                	mov    %eax,%edi
+     50d:	b8 00 00 00 00       	mov    $0x0,%eax
+     512:	e8 ea 13 00 00       	call   1901 <printf>
+     517:	90                   	nop
+     518:	eb fd                	jmp    517 <concurrent_create_test+0x1b3>
+        j -= ret;
+     51a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     51d:	29 45 f8             	sub    %eax,-0x8(%rbp)
+      while (j > 0) {
+     520:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     524:	7f aa                	jg     4d0 <concurrent_create_test+0x16c>
+      }
+
+      memset(buf, 65 + i, 5);
+     526:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     529:	8d 48 41             	lea    0x41(%rax),%ecx
+     52c:	48 8d 45 e7          	lea    -0x19(%rbp),%rax
+     530:	ba 05 00 00 00       	mov    $0x5,%edx
+     535:	89 ce                	mov    %ecx,%esi
+     537:	48 89 c7             	mov    %rax,%rdi
+     53a:	e8 e4 1d 00 00       	call   2323 <memset>
+      for (j = 0; j < 20; j++) {
+     53f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     546:	eb 4a                	jmp    592 <concurrent_create_test+0x22e>
+        assert(write(fd, buf, 5) == 5);
+     548:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     54c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     54f:	ba 05 00 00 00       	mov    $0x5,%edx
+     554:	48 89 ce             	mov    %rcx,%rsi
+     557:	89 c7                	mov    %eax,%edi
+     559:	e8 83 24 00 00       	call   29e1 <write>
+     55e:	83 f8 05             	cmp    $0x5,%eax
+     561:	74 2b                	je     58e <concurrent_create_test+0x22a>
+     563:	8b 05 97 4a 00 00    	mov    0x4a97(%rip),%eax        # 5000 <stdout>
+     569:	48 8d 15 a0 30 00 00 	lea    0x30a0(%rip),%rdx        # 3610 <benchreport+0x242>
+     570:	48 89 d1             	mov    %rdx,%rcx
+     573:	ba 60 00 00 00       	mov    $0x60,%edx
+     578:	48 8d 35 b9 2f 00 00 	lea    0x2fb9(%rip),%rsi        # 3538 <benchreport+0x16a>
+     57f:	89 c7                	mov    %eax,%edi
+     581:	b8 00 00 00 00       	mov    $0x0,%eax
+     586:	e8 76 13 00 00       	call   1901 <printf>
+     58b:	90                   	nop
+     58c:	eb fd                	jmp    58b <concurrent_create_test+0x227>
+      for (j = 0; j < 20; j++) {
+     58e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     592:	83 7d f8 13          	cmpl   $0x13,-0x8(%rbp)
+     596:	7e b0                	jle    548 <concurrent_create_test+0x1e4>
+      }
+
+      assert(close(fd) >= 0);
+     598:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     59b:	89 c7                	mov    %eax,%edi
+     59d:	e8 f9 19 00 00       	call   1f9b <close>
+     5a2:	85 c0                	test   %eax,%eax
+     5a4:	79 2b                	jns    5d1 <concurrent_create_test+0x26d>
+     5a6:	8b 05 54 4a 00 00    	mov    0x4a54(%rip),%eax        # 5000 <stdout>
+     5ac:	48 8d 15 74 30 00 00 	lea    0x3074(%rip),%rdx        # 3627 <benchreport+0x259>
+     5b3:	48 89 d1             	mov    %rdx,%rcx
+     5b6:	ba 63 00 00 00       	mov    $0x63,%edx
+     5bb:	48 8d 35 76 2f 00 00 	lea    0x2f76(%rip),%rsi        # 3538 <benchreport+0x16a>
+     5c2:	89 c7                	mov    %eax,%edi
+     5c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c9:	e8 33 13 00 00       	call   1901 <printf>
+     5ce:	90                   	nop
+     5cf:	eb fd                	jmp    5ce <concurrent_create_test+0x26a>
+      exit();
+     5d1:	e8 5b 19 00 00       	call   1f31 <exit>
+    } else if (pid < 0) {
+     5d6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     5da:	79 5e                	jns    63a <concurrent_create_test+0x2d6>
+      error("fork() failed");
+     5dc:	8b 05 1e 4a 00 00    	mov    0x4a1e(%rip),%eax        # 5000 <stdout>
+     5e2:	ba 66 00 00 00       	mov    $0x66,%edx
+     5e7:	48 8d 0d c5 2f 00 00 	lea    0x2fc5(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     5ee:	48 89 ce             	mov    %rcx,%rsi
+     5f1:	89 c7                	mov    %eax,%edi
+     5f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f8:	e8 04 13 00 00       	call   1901 <printf>
+     5fd:	8b 05 fd 49 00 00    	mov    0x49fd(%rip),%eax        # 5000 <stdout>
+     603:	48 8d 15 bb 2f 00 00 	lea    0x2fbb(%rip),%rdx        # 35c5 <benchreport+0x1f7>
+     60a:	48 89 d6             	mov    %rdx,%rsi
+     60d:	89 c7                	mov    %eax,%edi
+     60f:	b8 00 00 00 00       	mov    $0x0,%eax
+     614:	e8 e8 12 00 00       	call   1901 <printf>
+     619:	8b 05 e1 49 00 00    	mov    0x49e1(%rip),%eax        # 5000 <stdout>
+     61f:	48 8d 15 ad 2f 00 00 	lea    0x2fad(%rip),%rdx        # 35d3 <benchreport+0x205>
+     626:	48 89 d6             	mov    %rdx,%rsi
+     629:	89 c7                	mov    %eax,%edi
+     62b:	b8 00 00 00 00       	mov    $0x0,%eax
+     630:	e8 cc 12 00 00       	call   1901 <printf>
+     635:	e8 f7 18 00 00       	call   1f31 <exit>
+  for (i = 0; i < 50; i++) {
+     63a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     63e:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     642:	0f 8e 23 fe ff ff    	jle    46b <concurrent_create_test+0x107>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     648:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     64f:	eb 09                	jmp    65a <concurrent_create_test+0x2f6>
+    wait();
+     651:	e8 6a 23 00 00       	call   29c0 <wait>
+  for (i = 0; i < 50; i++) {
+     656:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     65a:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     65e:	7e f1                	jle    651 <concurrent_create_test+0x2ed>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     660:	e8 5b 23 00 00       	call   29c0 <wait>
+     665:	85 c0                	test   %eax,%eax
+     667:	78 5e                	js     6c7 <concurrent_create_test+0x363>
+    error("ghost child!");
+     669:	8b 05 91 49 00 00    	mov    0x4991(%rip),%eax        # 5000 <stdout>
+     66f:	ba 70 00 00 00       	mov    $0x70,%edx
+     674:	48 8d 0d 38 2f 00 00 	lea    0x2f38(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     67b:	48 89 ce             	mov    %rcx,%rsi
+     67e:	89 c7                	mov    %eax,%edi
+     680:	b8 00 00 00 00       	mov    $0x0,%eax
+     685:	e8 77 12 00 00       	call   1901 <printf>
+     68a:	8b 05 70 49 00 00    	mov    0x4970(%rip),%eax        # 5000 <stdout>
+     690:	48 8d 15 3e 2f 00 00 	lea    0x2f3e(%rip),%rdx        # 35d5 <benchreport+0x207>
+     697:	48 89 d6             	mov    %rdx,%rsi
+     69a:	89 c7                	mov    %eax,%edi
+     69c:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a1:	e8 5b 12 00 00       	call   1901 <printf>
+     6a6:	8b 05 54 49 00 00    	mov    0x4954(%rip),%eax        # 5000 <stdout>
+     6ac:	48 8d 15 20 2f 00 00 	lea    0x2f20(%rip),%rdx        # 35d3 <benchreport+0x205>
+     6b3:	48 89 d6             	mov    %rdx,%rsi
+     6b6:	89 c7                	mov    %eax,%edi
+     6b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     6bd:	e8 3f 12 00 00       	call   1901 <printf>
+     6c2:	e8 6a 18 00 00       	call   1f31 <exit>
+  }
+
+  fd = open("cc_create.txt", O_RDONLY);
+     6c7:	be 00 00 00 00       	mov    $0x0,%esi
+     6cc:	48 8d 05 27 2f 00 00 	lea    0x2f27(%rip),%rax        # 35fa <benchreport+0x22c>
+     6d3:	48 89 c7             	mov    %rax,%rdi
+     6d6:	e8 32 23 00 00       	call   2a0d <open>
+     6db:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     6de:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     6e2:	74 2b                	je     70f <concurrent_create_test+0x3ab>
+     6e4:	8b 05 16 49 00 00    	mov    0x4916(%rip),%eax        # 5000 <stdout>
+     6ea:	48 8d 15 17 2f 00 00 	lea    0x2f17(%rip),%rdx        # 3608 <benchreport+0x23a>
+     6f1:	48 89 d1             	mov    %rdx,%rcx
+     6f4:	ba 74 00 00 00       	mov    $0x74,%edx
+     6f9:	48 8d 35 38 2e 00 00 	lea    0x2e38(%rip),%rsi        # 3538 <benchreport+0x16a>
+     700:	89 c7                	mov    %eax,%edi
+     702:	b8 00 00 00 00       	mov    $0x0,%eax
+     707:	e8 f5 11 00 00       	call   1901 <printf>
+     70c:	90                   	nop
+     70d:	eb fd                	jmp    70c <concurrent_create_test+0x3a8>
+
+  for (i = 0; i < 50; i++) {
+     70f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     716:	eb 6e                	jmp    786 <concurrent_create_test+0x422>
+    for (j = 0; j < 100; j++) {
+     718:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     71f:	eb 5b                	jmp    77c <concurrent_create_test+0x418>
+      while (read(fd, buf, 1) <= 0);
+     721:	90                   	nop
+     722:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     726:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     729:	ba 01 00 00 00       	mov    $0x1,%edx
+     72e:	48 89 ce             	mov    %rcx,%rsi
+     731:	89 c7                	mov    %eax,%edi
+     733:	e8 9e 22 00 00       	call   29d6 <read>
+     738:	85 c0                	test   %eax,%eax
+     73a:	7e e6                	jle    722 <concurrent_create_test+0x3be>
+      assert(buf[0] == (i + 65));
+     73c:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+     740:	0f be d0             	movsbl %al,%edx
+     743:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     746:	83 c0 41             	add    $0x41,%eax
+     749:	39 c2                	cmp    %eax,%edx
+     74b:	74 2b                	je     778 <concurrent_create_test+0x414>
+     74d:	8b 05 ad 48 00 00    	mov    0x48ad(%rip),%eax        # 5000 <stdout>
+     753:	48 8d 15 fa 2e 00 00 	lea    0x2efa(%rip),%rdx        # 3654 <benchreport+0x286>
+     75a:	48 89 d1             	mov    %rdx,%rcx
+     75d:	ba 79 00 00 00       	mov    $0x79,%edx
+     762:	48 8d 35 cf 2d 00 00 	lea    0x2dcf(%rip),%rsi        # 3538 <benchreport+0x16a>
+     769:	89 c7                	mov    %eax,%edi
+     76b:	b8 00 00 00 00       	mov    $0x0,%eax
+     770:	e8 8c 11 00 00       	call   1901 <printf>
+     775:	90                   	nop
+     776:	eb fd                	jmp    775 <concurrent_create_test+0x411>
+    for (j = 0; j < 100; j++) {
+     778:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     77c:	83 7d f8 63          	cmpl   $0x63,-0x8(%rbp)
+     780:	7e 9f                	jle    721 <concurrent_create_test+0x3bd>
+  for (i = 0; i < 50; i++) {
+     782:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     786:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     78a:	7e 8c                	jle    718 <concurrent_create_test+0x3b4>
+    }
+  }
+
+  // EOF
+  assert(read(fd, buf, 1) == 0);
+     78c:	48 8d 4d e7          	lea    -0x19(%rbp),%rcx
+     790:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     793:	ba 01 00 00 00       	mov    $0x1,%edx
+     798:	48 89 ce             	mov    %rcx,%rsi
+     79b:	89 c7                	mov    %eax,%edi
+     79d:	e8 34 22 00 00       	call   29d6 <read>
+     7a2:	85 c0                	test   %eax,%eax
+     7a4:	74 2b                	je     7d1 <concurrent_create_test+0x46d>
+     7a6:	8b 05 54 48 00 00    	mov    0x4854(%rip),%eax        # 5000 <stdout>
+     7ac:	48 8d 15 b4 2e 00 00 	lea    0x2eb4(%rip),%rdx        # 3667 <benchreport+0x299>
+     7b3:	48 89 d1             	mov    %rdx,%rcx
+     7b6:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     7bb:	48 8d 35 76 2d 00 00 	lea    0x2d76(%rip),%rsi        # 3538 <benchreport+0x16a>
+     7c2:	89 c7                	mov    %eax,%edi
+     7c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c9:	e8 33 11 00 00       	call   1901 <printf>
+     7ce:	90                   	nop
+     7cf:	eb fd                	jmp    7ce <concurrent_create_test+0x46a>
+  assert(close(fd) >= 0);
+     7d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     7d4:	89 c7                	mov    %eax,%edi
+     7d6:	e8 c0 17 00 00       	call   1f9b <close>
+     7db:	85 c0                	test   %eax,%eax
+     7dd:	79 2b                	jns    80a <concurrent_create_test+0x4a6>
+     7df:	8b 05 1b 48 00 00    	mov    0x481b(%rip),%eax        # 5000 <stdout>
+     7e5:	48 8d 15 3b 2e 00 00 	lea    0x2e3b(%rip),%rdx        # 3627 <benchreport+0x259>
+     7ec:	48 89 d1             	mov    %rdx,%rcx
+     7ef:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     7f4:	48 8d 35 3d 2d 00 00 	lea    0x2d3d(%rip),%rsi        # 3538 <benchreport+0x16a>
+     7fb:	89 c7                	mov    %eax,%edi
+     7fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     802:	e8 fa 10 00 00       	call   1901 <printf>
+     807:	90                   	nop
+     808:	eb fd                	jmp    807 <concurrent_create_test+0x4a3>
+
+  printf(stdout, "concurrent create test OK\n");
+     80a:	8b 05 f0 47 00 00    	mov    0x47f0(%rip),%eax        # 5000 <stdout>
+     810:	48 8d 15 66 2e 00 00 	lea    0x2e66(%rip),%rdx        # 367d <benchreport+0x2af>
+     817:	48 89 d6             	mov    %rdx,%rsi
+     81a:	89 c7                	mov    %eax,%edi
+     81c:	b8 00 00 00 00       	mov    $0x0,%eax
+     821:	e8 db 10 00 00       	call   1901 <printf>
+}
+     826:	90                   	nop
+     827:	c9                   	leave
+     828:	c3                   	ret
+
+0000000000000829 <concurrent_write_test>:
+
+void concurrent_write_test() {
+     829:	55                   	push   %rbp
+     82a:	48 89 e5             	mov    %rsp,%rbp
+     82d:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  int i, j, pid, fd;
+  int map[50];
+  char buf[5];
+
+  fd = open("cc_write.txt", O_CREATE | O_WRONLY);
+     834:	be 01 02 00 00       	mov    $0x201,%esi
+     839:	48 8d 05 58 2e 00 00 	lea    0x2e58(%rip),%rax        # 3698 <benchreport+0x2ca>
+     840:	48 89 c7             	mov    %rax,%rdi
+     843:	e8 c5 21 00 00       	call   2a0d <open>
+     848:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     84b:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     84f:	74 2b                	je     87c <concurrent_write_test+0x53>
+     851:	8b 05 a9 47 00 00    	mov    0x47a9(%rip),%eax        # 5000 <stdout>
+     857:	48 8d 15 aa 2d 00 00 	lea    0x2daa(%rip),%rdx        # 3608 <benchreport+0x23a>
+     85e:	48 89 d1             	mov    %rdx,%rcx
+     861:	ba 8a 00 00 00       	mov    $0x8a,%edx
+     866:	48 8d 35 cb 2c 00 00 	lea    0x2ccb(%rip),%rsi        # 3538 <benchreport+0x16a>
+     86d:	89 c7                	mov    %eax,%edi
+     86f:	b8 00 00 00 00       	mov    $0x0,%eax
+     874:	e8 88 10 00 00       	call   1901 <printf>
+     879:	90                   	nop
+     87a:	eb fd                	jmp    879 <concurrent_write_test+0x50>
+
+  for (i = 0; i < 50; i++) {
+     87c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     883:	e9 02 01 00 00       	jmp    98a <concurrent_write_test+0x161>
+    pid = fork();
+     888:	e8 94 16 00 00       	call   1f21 <fork>
+     88d:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid == 0) {
+     890:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     894:	0f 85 88 00 00 00    	jne    922 <concurrent_write_test+0xf9>
+      for (j = 0; j < 5; j++) {
+     89a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     8a1:	eb 18                	jmp    8bb <concurrent_write_test+0x92>
+        buf[j] = i + 65;
+     8a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8a6:	83 c0 41             	add    $0x41,%eax
+     8a9:	89 c2                	mov    %eax,%edx
+     8ab:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8ae:	48 98                	cltq
+     8b0:	88 94 05 23 ff ff ff 	mov    %dl,-0xdd(%rbp,%rax,1)
+      for (j = 0; j < 5; j++) {
+     8b7:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     8bb:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+     8bf:	7e e2                	jle    8a3 <concurrent_write_test+0x7a>
+      }
+
+      for (j = 0; j < 20; j++) {
+     8c1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     8c8:	eb 4d                	jmp    917 <concurrent_write_test+0xee>
+        assert(write(fd, buf, 5) == 5);
+     8ca:	48 8d 8d 23 ff ff ff 	lea    -0xdd(%rbp),%rcx
+     8d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8d4:	ba 05 00 00 00       	mov    $0x5,%edx
+     8d9:	48 89 ce             	mov    %rcx,%rsi
+     8dc:	89 c7                	mov    %eax,%edi
+     8de:	e8 fe 20 00 00       	call   29e1 <write>
+     8e3:	83 f8 05             	cmp    $0x5,%eax
+     8e6:	74 2b                	je     913 <concurrent_write_test+0xea>
+     8e8:	8b 05 12 47 00 00    	mov    0x4712(%rip),%eax        # 5000 <stdout>
+     8ee:	48 8d 15 1b 2d 00 00 	lea    0x2d1b(%rip),%rdx        # 3610 <benchreport+0x242>
+     8f5:	48 89 d1             	mov    %rdx,%rcx
+     8f8:	ba 94 00 00 00       	mov    $0x94,%edx
+     8fd:	48 8d 35 34 2c 00 00 	lea    0x2c34(%rip),%rsi        # 3538 <benchreport+0x16a>
+     904:	89 c7                	mov    %eax,%edi
+     906:	b8 00 00 00 00       	mov    $0x0,%eax
+     90b:	e8 f1 0f 00 00       	call   1901 <printf>
+     910:	90                   	nop
+     911:	eb fd                	jmp    910 <concurrent_write_test+0xe7>
+      for (j = 0; j < 20; j++) {
+     913:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     917:	83 7d f8 13          	cmpl   $0x13,-0x8(%rbp)
+     91b:	7e ad                	jle    8ca <concurrent_write_test+0xa1>
+      }
+
+      exit();
+     91d:	e8 0f 16 00 00       	call   1f31 <exit>
+    } else if (pid < 0) {
+     922:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     926:	79 5e                	jns    986 <concurrent_write_test+0x15d>
+      error("fork() failed");
+     928:	8b 05 d2 46 00 00    	mov    0x46d2(%rip),%eax        # 5000 <stdout>
+     92e:	ba 99 00 00 00       	mov    $0x99,%edx
+     933:	48 8d 0d 79 2c 00 00 	lea    0x2c79(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     93a:	48 89 ce             	mov    %rcx,%rsi
+     93d:	89 c7                	mov    %eax,%edi
+     93f:	b8 00 00 00 00       	mov    $0x0,%eax
+     944:	e8 b8 0f 00 00       	call   1901 <printf>
+     949:	8b 05 b1 46 00 00    	mov    0x46b1(%rip),%eax        # 5000 <stdout>
+     94f:	48 8d 15 6f 2c 00 00 	lea    0x2c6f(%rip),%rdx        # 35c5 <benchreport+0x1f7>
+     956:	48 89 d6             	mov    %rdx,%rsi
+     959:	89 c7                	mov    %eax,%edi
+     95b:	b8 00 00 00 00       	mov    $0x0,%eax
+     960:	e8 9c 0f 00 00       	call   1901 <printf>
+     965:	8b 05 95 46 00 00    	mov    0x4695(%rip),%eax        # 5000 <stdout>
+     96b:	48 8d 15 61 2c 00 00 	lea    0x2c61(%rip),%rdx        # 35d3 <benchreport+0x205>
+     972:	48 89 d6             	mov    %rdx,%rsi
+     975:	89 c7                	mov    %eax,%edi
+     977:	b8 00 00 00 00       	mov    $0x0,%eax
+     97c:	e8 80 0f 00 00       	call   1901 <printf>
+     981:	e8 ab 15 00 00       	call   1f31 <exit>
+  for (i = 0; i < 50; i++) {
+     986:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     98a:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     98e:	0f 8e f4 fe ff ff    	jle    888 <concurrent_write_test+0x5f>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     994:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     99b:	eb 09                	jmp    9a6 <concurrent_write_test+0x17d>
+    wait();
+     99d:	e8 1e 20 00 00       	call   29c0 <wait>
+  for (i = 0; i < 50; i++) {
+     9a2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9a6:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     9aa:	7e f1                	jle    99d <concurrent_write_test+0x174>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     9ac:	e8 0f 20 00 00       	call   29c0 <wait>
+     9b1:	85 c0                	test   %eax,%eax
+     9b3:	78 5e                	js     a13 <concurrent_write_test+0x1ea>
+    error("ghost child!");
+     9b5:	8b 05 45 46 00 00    	mov    0x4645(%rip),%eax        # 5000 <stdout>
+     9bb:	ba a3 00 00 00       	mov    $0xa3,%edx
+     9c0:	48 8d 0d ec 2b 00 00 	lea    0x2bec(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     9c7:	48 89 ce             	mov    %rcx,%rsi
+     9ca:	89 c7                	mov    %eax,%edi
+     9cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d1:	e8 2b 0f 00 00       	call   1901 <printf>
+     9d6:	8b 05 24 46 00 00    	mov    0x4624(%rip),%eax        # 5000 <stdout>
+     9dc:	48 8d 15 f2 2b 00 00 	lea    0x2bf2(%rip),%rdx        # 35d5 <benchreport+0x207>
+     9e3:	48 89 d6             	mov    %rdx,%rsi
+     9e6:	89 c7                	mov    %eax,%edi
+     9e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ed:	e8 0f 0f 00 00       	call   1901 <printf>
+     9f2:	8b 05 08 46 00 00    	mov    0x4608(%rip),%eax        # 5000 <stdout>
+     9f8:	48 8d 15 d4 2b 00 00 	lea    0x2bd4(%rip),%rdx        # 35d3 <benchreport+0x205>
+     9ff:	48 89 d6             	mov    %rdx,%rsi
+     a02:	89 c7                	mov    %eax,%edi
+     a04:	b8 00 00 00 00       	mov    $0x0,%eax
+     a09:	e8 f3 0e 00 00       	call   1901 <printf>
+     a0e:	e8 1e 15 00 00       	call   1f31 <exit>
+  }
+
+  assert(close(fd) >= 0);
+     a13:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a16:	89 c7                	mov    %eax,%edi
+     a18:	e8 7e 15 00 00       	call   1f9b <close>
+     a1d:	85 c0                	test   %eax,%eax
+     a1f:	79 2b                	jns    a4c <concurrent_write_test+0x223>
+     a21:	8b 05 d9 45 00 00    	mov    0x45d9(%rip),%eax        # 5000 <stdout>
+     a27:	48 8d 15 f9 2b 00 00 	lea    0x2bf9(%rip),%rdx        # 3627 <benchreport+0x259>
+     a2e:	48 89 d1             	mov    %rdx,%rcx
+     a31:	ba a6 00 00 00       	mov    $0xa6,%edx
+     a36:	48 8d 35 fb 2a 00 00 	lea    0x2afb(%rip),%rsi        # 3538 <benchreport+0x16a>
+     a3d:	89 c7                	mov    %eax,%edi
+     a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a44:	e8 b8 0e 00 00       	call   1901 <printf>
+     a49:	90                   	nop
+     a4a:	eb fd                	jmp    a49 <concurrent_write_test+0x220>
+  fd = open("cc_write.txt", O_RDONLY);
+     a4c:	be 00 00 00 00       	mov    $0x0,%esi
+     a51:	48 8d 05 40 2c 00 00 	lea    0x2c40(%rip),%rax        # 3698 <benchreport+0x2ca>
+     a58:	48 89 c7             	mov    %rax,%rdi
+     a5b:	e8 ad 1f 00 00       	call   2a0d <open>
+     a60:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     a63:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     a67:	74 2b                	je     a94 <concurrent_write_test+0x26b>
+     a69:	8b 05 91 45 00 00    	mov    0x4591(%rip),%eax        # 5000 <stdout>
+     a6f:	48 8d 15 92 2b 00 00 	lea    0x2b92(%rip),%rdx        # 3608 <benchreport+0x23a>
+     a76:	48 89 d1             	mov    %rdx,%rcx
+     a79:	ba a8 00 00 00       	mov    $0xa8,%edx
+     a7e:	48 8d 35 b3 2a 00 00 	lea    0x2ab3(%rip),%rsi        # 3538 <benchreport+0x16a>
+     a85:	89 c7                	mov    %eax,%edi
+     a87:	b8 00 00 00 00       	mov    $0x0,%eax
+     a8c:	e8 70 0e 00 00       	call   1901 <printf>
+     a91:	90                   	nop
+     a92:	eb fd                	jmp    a91 <concurrent_write_test+0x268>
+
+  for (i = 0; i < 50; i++) {
+     a94:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a9b:	eb 14                	jmp    ab1 <concurrent_write_test+0x288>
+    map[i] = 0;
+     a9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aa0:	48 98                	cltq
+     aa2:	c7 84 85 28 ff ff ff 	movl   $0x0,-0xd8(%rbp,%rax,4)
+     aa9:	00 00 00 00 
+  for (i = 0; i < 50; i++) {
+     aad:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ab1:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     ab5:	7e e6                	jle    a9d <concurrent_write_test+0x274>
+  }
+
+  for (i = 0; i < 5000; i++) {
+     ab7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     abe:	eb 45                	jmp    b05 <concurrent_write_test+0x2dc>
+    while (read(fd, buf, 1) <= 0);
+     ac0:	90                   	nop
+     ac1:	48 8d 8d 23 ff ff ff 	lea    -0xdd(%rbp),%rcx
+     ac8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     acb:	ba 01 00 00 00       	mov    $0x1,%edx
+     ad0:	48 89 ce             	mov    %rcx,%rsi
+     ad3:	89 c7                	mov    %eax,%edi
+     ad5:	e8 fc 1e 00 00       	call   29d6 <read>
+     ada:	85 c0                	test   %eax,%eax
+     adc:	7e e3                	jle    ac1 <concurrent_write_test+0x298>
+    map[buf[0] - 65]++;
+     ade:	0f b6 85 23 ff ff ff 	movzbl -0xdd(%rbp),%eax
+     ae5:	0f be c0             	movsbl %al,%eax
+     ae8:	83 e8 41             	sub    $0x41,%eax
+     aeb:	48 63 d0             	movslq %eax,%rdx
+     aee:	8b 94 95 28 ff ff ff 	mov    -0xd8(%rbp,%rdx,4),%edx
+     af5:	83 c2 01             	add    $0x1,%edx
+     af8:	48 98                	cltq
+     afa:	89 94 85 28 ff ff ff 	mov    %edx,-0xd8(%rbp,%rax,4)
+  for (i = 0; i < 5000; i++) {
+     b01:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b05:	81 7d fc 87 13 00 00 	cmpl   $0x1387,-0x4(%rbp)
+     b0c:	7e b2                	jle    ac0 <concurrent_write_test+0x297>
+  }
+
+  // EOF
+  assert(read(fd, buf, 1) == 0);
+     b0e:	48 8d 8d 23 ff ff ff 	lea    -0xdd(%rbp),%rcx
+     b15:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b18:	ba 01 00 00 00       	mov    $0x1,%edx
+     b1d:	48 89 ce             	mov    %rcx,%rsi
+     b20:	89 c7                	mov    %eax,%edi
+     b22:	e8 af 1e 00 00       	call   29d6 <read>
+     b27:	85 c0                	test   %eax,%eax
+     b29:	74 2b                	je     b56 <concurrent_write_test+0x32d>
+     b2b:	8b 05 cf 44 00 00    	mov    0x44cf(%rip),%eax        # 5000 <stdout>
+     b31:	48 8d 15 2f 2b 00 00 	lea    0x2b2f(%rip),%rdx        # 3667 <benchreport+0x299>
+     b38:	48 89 d1             	mov    %rdx,%rcx
+     b3b:	ba b4 00 00 00       	mov    $0xb4,%edx
+     b40:	48 8d 35 f1 29 00 00 	lea    0x29f1(%rip),%rsi        # 3538 <benchreport+0x16a>
+     b47:	89 c7                	mov    %eax,%edi
+     b49:	b8 00 00 00 00       	mov    $0x0,%eax
+     b4e:	e8 ae 0d 00 00       	call   1901 <printf>
+     b53:	90                   	nop
+     b54:	eb fd                	jmp    b53 <concurrent_write_test+0x32a>
+  assert(close(fd) >= 0);
+     b56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b59:	89 c7                	mov    %eax,%edi
+     b5b:	e8 3b 14 00 00       	call   1f9b <close>
+     b60:	85 c0                	test   %eax,%eax
+     b62:	79 2b                	jns    b8f <concurrent_write_test+0x366>
+     b64:	8b 05 96 44 00 00    	mov    0x4496(%rip),%eax        # 5000 <stdout>
+     b6a:	48 8d 15 b6 2a 00 00 	lea    0x2ab6(%rip),%rdx        # 3627 <benchreport+0x259>
+     b71:	48 89 d1             	mov    %rdx,%rcx
+     b74:	ba b5 00 00 00       	mov    $0xb5,%edx
+     b79:	48 8d 35 b8 29 00 00 	lea    0x29b8(%rip),%rsi        # 3538 <benchreport+0x16a>
+     b80:	89 c7                	mov    %eax,%edi
+     b82:	b8 00 00 00 00       	mov    $0x0,%eax
+     b87:	e8 75 0d 00 00       	call   1901 <printf>
+     b8c:	90                   	nop
+     b8d:	eb fd                	jmp    b8c <concurrent_write_test+0x363>
+
+  for (i = 0; i < 50; i++) {
+     b8f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b96:	eb 76                	jmp    c0e <concurrent_write_test+0x3e5>
+    if (map[i] != 100)
+     b98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b9b:	48 98                	cltq
+     b9d:	8b 84 85 28 ff ff ff 	mov    -0xd8(%rbp,%rax,4),%eax
+     ba4:	83 f8 64             	cmp    $0x64,%eax
+     ba7:	74 61                	je     c0a <concurrent_write_test+0x3e1>
+      error("missing byte from child %d", i);
+     ba9:	8b 05 51 44 00 00    	mov    0x4451(%rip),%eax        # 5000 <stdout>
+     baf:	ba b9 00 00 00       	mov    $0xb9,%edx
+     bb4:	48 8d 0d f8 29 00 00 	lea    0x29f8(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     bbb:	48 89 ce             	mov    %rcx,%rsi
+     bbe:	89 c7                	mov    %eax,%edi
+     bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc5:	e8 37 0d 00 00       	call   1901 <printf>
+     bca:	8b 05 30 44 00 00    	mov    0x4430(%rip),%eax        # 5000 <stdout>
+     bd0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     bd3:	48 8d 0d cb 2a 00 00 	lea    0x2acb(%rip),%rcx        # 36a5 <benchreport+0x2d7>
+     bda:	48 89 ce             	mov    %rcx,%rsi
+     bdd:	89 c7                	mov    %eax,%edi
+     bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+     be4:	e8 18 0d 00 00       	call   1901 <printf>
+     be9:	8b 05 11 44 00 00    	mov    0x4411(%rip),%eax        # 5000 <stdout>
+     bef:	48 8d 15 dd 29 00 00 	lea    0x29dd(%rip),%rdx        # 35d3 <benchreport+0x205>
+     bf6:	48 89 d6             	mov    %rdx,%rsi
+     bf9:	89 c7                	mov    %eax,%edi
+     bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+     c00:	e8 fc 0c 00 00       	call   1901 <printf>
+     c05:	e8 27 13 00 00       	call   1f31 <exit>
+  for (i = 0; i < 50; i++) {
+     c0a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c0e:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     c12:	7e 84                	jle    b98 <concurrent_write_test+0x36f>
+  }
+  printf(stdout, "concurrent write test OK\n");
+     c14:	8b 05 e6 43 00 00    	mov    0x43e6(%rip),%eax        # 5000 <stdout>
+     c1a:	48 8d 15 9f 2a 00 00 	lea    0x2a9f(%rip),%rdx        # 36c0 <benchreport+0x2f2>
+     c21:	48 89 d6             	mov    %rdx,%rsi
+     c24:	89 c7                	mov    %eax,%edi
+     c26:	b8 00 00 00 00       	mov    $0x0,%eax
+     c2b:	e8 d1 0c 00 00       	call   1901 <printf>
+}
+     c30:	90                   	nop
+     c31:	c9                   	leave
+     c32:	c3                   	ret
+
+0000000000000c33 <concurrent_read_test>:
+
+void concurrent_read_test() {
+     c33:	55                   	push   %rbp
+     c34:	48 89 e5             	mov    %rsp,%rbp
+     c37:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, j, pid, fd;
+  uchar buf[5];
+
+  fd = open("cc_write.txt", O_CREATE | O_WRONLY);
+     c3b:	be 01 02 00 00       	mov    $0x201,%esi
+     c40:	48 8d 05 51 2a 00 00 	lea    0x2a51(%rip),%rax        # 3698 <benchreport+0x2ca>
+     c47:	48 89 c7             	mov    %rax,%rdi
+     c4a:	e8 be 1d 00 00       	call   2a0d <open>
+     c4f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     c52:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     c56:	74 2b                	je     c83 <concurrent_read_test+0x50>
+     c58:	8b 05 a2 43 00 00    	mov    0x43a2(%rip),%eax        # 5000 <stdout>
+     c5e:	48 8d 15 a3 29 00 00 	lea    0x29a3(%rip),%rdx        # 3608 <benchreport+0x23a>
+     c65:	48 89 d1             	mov    %rdx,%rcx
+     c68:	ba c3 00 00 00       	mov    $0xc3,%edx
+     c6d:	48 8d 35 c4 28 00 00 	lea    0x28c4(%rip),%rsi        # 3538 <benchreport+0x16a>
+     c74:	89 c7                	mov    %eax,%edi
+     c76:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7b:	e8 81 0c 00 00       	call   1901 <printf>
+     c80:	90                   	nop
+     c81:	eb fd                	jmp    c80 <concurrent_read_test+0x4d>
+
+  for (i = 0; i < 250; i++) {
+     c83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c8a:	eb 7e                	jmp    d0a <concurrent_read_test+0xd7>
+    for (j = 0; j < 5; j++) {
+     c8c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     c93:	eb 12                	jmp    ca7 <concurrent_read_test+0x74>
+      buf[j] = i;
+     c95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c98:	89 c2                	mov    %eax,%edx
+     c9a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c9d:	48 98                	cltq
+     c9f:	88 54 05 eb          	mov    %dl,-0x15(%rbp,%rax,1)
+    for (j = 0; j < 5; j++) {
+     ca3:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     ca7:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+     cab:	7e e8                	jle    c95 <concurrent_read_test+0x62>
+    }
+    for (j = 0; j < 4; j++) {
+     cad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     cb4:	eb 4a                	jmp    d00 <concurrent_read_test+0xcd>
+      assert(write(fd, buf, 5) == 5);
+     cb6:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+     cba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cbd:	ba 05 00 00 00       	mov    $0x5,%edx
+     cc2:	48 89 ce             	mov    %rcx,%rsi
+     cc5:	89 c7                	mov    %eax,%edi
+     cc7:	e8 15 1d 00 00       	call   29e1 <write>
+     ccc:	83 f8 05             	cmp    $0x5,%eax
+     ccf:	74 2b                	je     cfc <concurrent_read_test+0xc9>
+     cd1:	8b 05 29 43 00 00    	mov    0x4329(%rip),%eax        # 5000 <stdout>
+     cd7:	48 8d 15 32 29 00 00 	lea    0x2932(%rip),%rdx        # 3610 <benchreport+0x242>
+     cde:	48 89 d1             	mov    %rdx,%rcx
+     ce1:	ba ca 00 00 00       	mov    $0xca,%edx
+     ce6:	48 8d 35 4b 28 00 00 	lea    0x284b(%rip),%rsi        # 3538 <benchreport+0x16a>
+     ced:	89 c7                	mov    %eax,%edi
+     cef:	b8 00 00 00 00       	mov    $0x0,%eax
+     cf4:	e8 08 0c 00 00       	call   1901 <printf>
+     cf9:	90                   	nop
+     cfa:	eb fd                	jmp    cf9 <concurrent_read_test+0xc6>
+    for (j = 0; j < 4; j++) {
+     cfc:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     d00:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+     d04:	7e b0                	jle    cb6 <concurrent_read_test+0x83>
+  for (i = 0; i < 250; i++) {
+     d06:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d0a:	81 7d fc f9 00 00 00 	cmpl   $0xf9,-0x4(%rbp)
+     d11:	0f 8e 75 ff ff ff    	jle    c8c <concurrent_read_test+0x59>
+    }
+  }
+
+  assert(close(fd) >= 0);
+     d17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d1a:	89 c7                	mov    %eax,%edi
+     d1c:	e8 7a 12 00 00       	call   1f9b <close>
+     d21:	85 c0                	test   %eax,%eax
+     d23:	79 2b                	jns    d50 <concurrent_read_test+0x11d>
+     d25:	8b 05 d5 42 00 00    	mov    0x42d5(%rip),%eax        # 5000 <stdout>
+     d2b:	48 8d 15 f5 28 00 00 	lea    0x28f5(%rip),%rdx        # 3627 <benchreport+0x259>
+     d32:	48 89 d1             	mov    %rdx,%rcx
+     d35:	ba ce 00 00 00       	mov    $0xce,%edx
+     d3a:	48 8d 35 f7 27 00 00 	lea    0x27f7(%rip),%rsi        # 3538 <benchreport+0x16a>
+     d41:	89 c7                	mov    %eax,%edi
+     d43:	b8 00 00 00 00       	mov    $0x0,%eax
+     d48:	e8 b4 0b 00 00       	call   1901 <printf>
+     d4d:	90                   	nop
+     d4e:	eb fd                	jmp    d4d <concurrent_read_test+0x11a>
+  fd = open("cc_write.txt", O_RDONLY);
+     d50:	be 00 00 00 00       	mov    $0x0,%esi
+     d55:	48 8d 05 3c 29 00 00 	lea    0x293c(%rip),%rax        # 3698 <benchreport+0x2ca>
+     d5c:	48 89 c7             	mov    %rax,%rdi
+     d5f:	e8 a9 1c 00 00       	call   2a0d <open>
+     d64:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  assert(fd == 3);
+     d67:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     d6b:	74 2b                	je     d98 <concurrent_read_test+0x165>
+     d6d:	8b 05 8d 42 00 00    	mov    0x428d(%rip),%eax        # 5000 <stdout>
+     d73:	48 8d 15 8e 28 00 00 	lea    0x288e(%rip),%rdx        # 3608 <benchreport+0x23a>
+     d7a:	48 89 d1             	mov    %rdx,%rcx
+     d7d:	ba d0 00 00 00       	mov    $0xd0,%edx
+     d82:	48 8d 35 af 27 00 00 	lea    0x27af(%rip),%rsi        # 3538 <benchreport+0x16a>
+     d89:	89 c7                	mov    %eax,%edi
+     d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+     d90:	e8 6c 0b 00 00       	call   1901 <printf>
+     d95:	90                   	nop
+     d96:	eb fd                	jmp    d95 <concurrent_read_test+0x162>
+
+  buf[0] = 0;
+     d98:	c6 45 eb 00          	movb   $0x0,-0x15(%rbp)
+  for (i = 0; i < 50; i++) {
+     d9c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     da3:	e9 3c 01 00 00       	jmp    ee4 <concurrent_read_test+0x2b1>
+    pid = fork();
+     da8:	e8 74 11 00 00       	call   1f21 <fork>
+     dad:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid == 0) {
+     db0:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     db4:	0f 85 c2 00 00 00    	jne    e7c <concurrent_read_test+0x249>
+      for (j = 0; j < 100; j++) {
+     dba:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     dc1:	e9 a7 00 00 00       	jmp    e6d <concurrent_read_test+0x23a>
+        while (read(fd, buf + 1, 1) <= 0);
+     dc6:	90                   	nop
+     dc7:	48 8d 45 eb          	lea    -0x15(%rbp),%rax
+     dcb:	48 83 c0 01          	add    $0x1,%rax
+     dcf:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     dd2:	ba 01 00 00 00       	mov    $0x1,%edx
+     dd7:	48 89 c6             	mov    %rax,%rsi
+     dda:	89 cf                	mov    %ecx,%edi
+     ddc:	e8 f5 1b 00 00       	call   29d6 <read>
+     de1:	85 c0                	test   %eax,%eax
+     de3:	7e e2                	jle    dc7 <concurrent_read_test+0x194>
+        if (buf[1] >= buf[0]) {
+     de5:	0f b6 55 ec          	movzbl -0x14(%rbp),%edx
+     de9:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+     ded:	38 c2                	cmp    %al,%dl
+     def:	72 09                	jb     dfa <concurrent_read_test+0x1c7>
+          buf[0] = buf[1];
+     df1:	0f b6 45 ec          	movzbl -0x14(%rbp),%eax
+     df5:	88 45 eb             	mov    %al,-0x15(%rbp)
+     df8:	eb 6f                	jmp    e69 <concurrent_read_test+0x236>
+        } else {
+          error("read out of order: read %d before %d in child %d", buf[0], buf[1], i);
+     dfa:	8b 05 00 42 00 00    	mov    0x4200(%rip),%eax        # 5000 <stdout>
+     e00:	ba db 00 00 00       	mov    $0xdb,%edx
+     e05:	48 8d 0d a7 27 00 00 	lea    0x27a7(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     e0c:	48 89 ce             	mov    %rcx,%rsi
+     e0f:	89 c7                	mov    %eax,%edi
+     e11:	b8 00 00 00 00       	mov    $0x0,%eax
+     e16:	e8 e6 0a 00 00       	call   1901 <printf>
+     e1b:	0f b6 45 ec          	movzbl -0x14(%rbp),%eax
+     e1f:	0f b6 c8             	movzbl %al,%ecx
+     e22:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+     e26:	0f b6 d0             	movzbl %al,%edx
+     e29:	8b 05 d1 41 00 00    	mov    0x41d1(%rip),%eax        # 5000 <stdout>
+     e2f:	8b 75 fc             	mov    -0x4(%rbp),%esi
+     e32:	41 89 f0             	mov    %esi,%r8d
+     e35:	48 8d 35 a4 28 00 00 	lea    0x28a4(%rip),%rsi        # 36e0 <benchreport+0x312>
+     e3c:	89 c7                	mov    %eax,%edi
+     e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e43:	e8 b9 0a 00 00       	call   1901 <printf>
+     e48:	8b 05 b2 41 00 00    	mov    0x41b2(%rip),%eax        # 5000 <stdout>
+     e4e:	48 8d 15 7e 27 00 00 	lea    0x277e(%rip),%rdx        # 35d3 <benchreport+0x205>
+     e55:	48 89 d6             	mov    %rdx,%rsi
+     e58:	89 c7                	mov    %eax,%edi
+     e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e5f:	e8 9d 0a 00 00       	call   1901 <printf>
+     e64:	e8 c8 10 00 00       	call   1f31 <exit>
+      for (j = 0; j < 100; j++) {
+     e69:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     e6d:	83 7d f8 63          	cmpl   $0x63,-0x8(%rbp)
+     e71:	0f 8e 4f ff ff ff    	jle    dc6 <concurrent_read_test+0x193>
+        }
+      }
+      exit();
+     e77:	e8 b5 10 00 00       	call   1f31 <exit>
+    } else if (pid < 0) {
+     e7c:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     e80:	79 5e                	jns    ee0 <concurrent_read_test+0x2ad>
+      error("fork() failed");
+     e82:	8b 05 78 41 00 00    	mov    0x4178(%rip),%eax        # 5000 <stdout>
+     e88:	ba e0 00 00 00       	mov    $0xe0,%edx
+     e8d:	48 8d 0d 1f 27 00 00 	lea    0x271f(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     e94:	48 89 ce             	mov    %rcx,%rsi
+     e97:	89 c7                	mov    %eax,%edi
+     e99:	b8 00 00 00 00       	mov    $0x0,%eax
+     e9e:	e8 5e 0a 00 00       	call   1901 <printf>
+     ea3:	8b 05 57 41 00 00    	mov    0x4157(%rip),%eax        # 5000 <stdout>
+     ea9:	48 8d 15 15 27 00 00 	lea    0x2715(%rip),%rdx        # 35c5 <benchreport+0x1f7>
+     eb0:	48 89 d6             	mov    %rdx,%rsi
+     eb3:	89 c7                	mov    %eax,%edi
+     eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eba:	e8 42 0a 00 00       	call   1901 <printf>
+     ebf:	8b 05 3b 41 00 00    	mov    0x413b(%rip),%eax        # 5000 <stdout>
+     ec5:	48 8d 15 07 27 00 00 	lea    0x2707(%rip),%rdx        # 35d3 <benchreport+0x205>
+     ecc:	48 89 d6             	mov    %rdx,%rsi
+     ecf:	89 c7                	mov    %eax,%edi
+     ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed6:	e8 26 0a 00 00       	call   1901 <printf>
+     edb:	e8 51 10 00 00       	call   1f31 <exit>
+  for (i = 0; i < 50; i++) {
+     ee0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ee4:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     ee8:	0f 8e ba fe ff ff    	jle    da8 <concurrent_read_test+0x175>
+    }
+  }
+
+  for (i = 0; i < 50; i++) {
+     eee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ef5:	eb 09                	jmp    f00 <concurrent_read_test+0x2cd>
+    wait();
+     ef7:	e8 c4 1a 00 00       	call   29c0 <wait>
+  for (i = 0; i < 50; i++) {
+     efc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     f00:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+     f04:	7e f1                	jle    ef7 <concurrent_read_test+0x2c4>
+  }
+
+  // no more children
+  if (wait() >= 0) {
+     f06:	e8 b5 1a 00 00       	call   29c0 <wait>
+     f0b:	85 c0                	test   %eax,%eax
+     f0d:	78 5e                	js     f6d <concurrent_read_test+0x33a>
+    error("ghost child!");
+     f0f:	8b 05 eb 40 00 00    	mov    0x40eb(%rip),%eax        # 5000 <stdout>
+     f15:	ba ea 00 00 00       	mov    $0xea,%edx
+     f1a:	48 8d 0d 92 26 00 00 	lea    0x2692(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+     f21:	48 89 ce             	mov    %rcx,%rsi
+     f24:	89 c7                	mov    %eax,%edi
+     f26:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2b:	e8 d1 09 00 00       	call   1901 <printf>
+     f30:	8b 05 ca 40 00 00    	mov    0x40ca(%rip),%eax        # 5000 <stdout>
+     f36:	48 8d 15 98 26 00 00 	lea    0x2698(%rip),%rdx        # 35d5 <benchreport+0x207>
+     f3d:	48 89 d6             	mov    %rdx,%rsi
+     f40:	89 c7                	mov    %eax,%edi
+     f42:	b8 00 00 00 00       	mov    $0x0,%eax
+     f47:	e8 b5 09 00 00       	call   1901 <printf>
+     f4c:	8b 05 ae 40 00 00    	mov    0x40ae(%rip),%eax        # 5000 <stdout>
+     f52:	48 8d 15 7a 26 00 00 	lea    0x267a(%rip),%rdx        # 35d3 <benchreport+0x205>
+     f59:	48 89 d6             	mov    %rdx,%rsi
+     f5c:	89 c7                	mov    %eax,%edi
+     f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+     f63:	e8 99 09 00 00       	call   1901 <printf>
+     f68:	e8 c4 0f 00 00       	call   1f31 <exit>
+  }
+
+  assert(read(fd, buf, 1) == 0);
+     f6d:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+     f71:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f74:	ba 01 00 00 00       	mov    $0x1,%edx
+     f79:	48 89 ce             	mov    %rcx,%rsi
+     f7c:	89 c7                	mov    %eax,%edi
+     f7e:	e8 53 1a 00 00       	call   29d6 <read>
+     f83:	85 c0                	test   %eax,%eax
+     f85:	74 2b                	je     fb2 <concurrent_read_test+0x37f>
+     f87:	8b 05 73 40 00 00    	mov    0x4073(%rip),%eax        # 5000 <stdout>
+     f8d:	48 8d 15 d3 26 00 00 	lea    0x26d3(%rip),%rdx        # 3667 <benchreport+0x299>
+     f94:	48 89 d1             	mov    %rdx,%rcx
+     f97:	ba ed 00 00 00       	mov    $0xed,%edx
+     f9c:	48 8d 35 95 25 00 00 	lea    0x2595(%rip),%rsi        # 3538 <benchreport+0x16a>
+     fa3:	89 c7                	mov    %eax,%edi
+     fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+     faa:	e8 52 09 00 00       	call   1901 <printf>
+     faf:	90                   	nop
+     fb0:	eb fd                	jmp    faf <concurrent_read_test+0x37c>
+  assert(close(fd) >= 0);
+     fb2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fb5:	89 c7                	mov    %eax,%edi
+     fb7:	e8 df 0f 00 00       	call   1f9b <close>
+     fbc:	85 c0                	test   %eax,%eax
+     fbe:	79 2b                	jns    feb <concurrent_read_test+0x3b8>
+     fc0:	8b 05 3a 40 00 00    	mov    0x403a(%rip),%eax        # 5000 <stdout>
+     fc6:	48 8d 15 5a 26 00 00 	lea    0x265a(%rip),%rdx        # 3627 <benchreport+0x259>
+     fcd:	48 89 d1             	mov    %rdx,%rcx
+     fd0:	ba ee 00 00 00       	mov    $0xee,%edx
+     fd5:	48 8d 35 5c 25 00 00 	lea    0x255c(%rip),%rsi        # 3538 <benchreport+0x16a>
+     fdc:	89 c7                	mov    %eax,%edi
+     fde:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe3:	e8 19 09 00 00       	call   1901 <printf>
+     fe8:	90                   	nop
+     fe9:	eb fd                	jmp    fe8 <concurrent_read_test+0x3b5>
+
+  printf(stdout, "concurrent read test OK\n");
+     feb:	8b 05 0f 40 00 00    	mov    0x400f(%rip),%eax        # 5000 <stdout>
+     ff1:	48 8d 15 19 27 00 00 	lea    0x2719(%rip),%rdx        # 3711 <benchreport+0x343>
+     ff8:	48 89 d6             	mov    %rdx,%rsi
+     ffb:	89 c7                	mov    %eax,%edi
+     ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1002:	e8 fa 08 00 00       	call   1901 <printf>
+}
+    1007:	90                   	nop
+    1008:	c9                   	leave
+    1009:	c3                   	ret
+
+000000000000100a <concurrent_delete_test>:
+
+void concurrent_delete_test() {
+    100a:	55                   	push   %rbp
+    100b:	48 89 e5             	mov    %rsp,%rbp
+    100e:	48 83 ec 20          	sub    $0x20,%rsp
+  int pipes[2];
+  pipe(pipes);
+    1012:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+    1016:	48 89 c7             	mov    %rax,%rdi
+    1019:	e8 ad 19 00 00       	call   29cb <pipe>
+  char buf[2];
+  int fd = open("cc_del", O_RDWR | O_CREATE);
+    101e:	be 02 02 00 00       	mov    $0x202,%esi
+    1023:	48 8d 05 00 27 00 00 	lea    0x2700(%rip),%rax        # 372a <benchreport+0x35c>
+    102a:	48 89 c7             	mov    %rax,%rdi
+    102d:	e8 db 19 00 00       	call   2a0d <open>
+    1032:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd < 0)
+    1035:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1039:	79 5e                	jns    1099 <concurrent_delete_test+0x8f>
+    error("open failed");
+    103b:	8b 05 bf 3f 00 00    	mov    0x3fbf(%rip),%eax        # 5000 <stdout>
+    1041:	ba f9 00 00 00       	mov    $0xf9,%edx
+    1046:	48 8d 0d 66 25 00 00 	lea    0x2566(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    104d:	48 89 ce             	mov    %rcx,%rsi
+    1050:	89 c7                	mov    %eax,%edi
+    1052:	b8 00 00 00 00       	mov    $0x0,%eax
+    1057:	e8 a5 08 00 00       	call   1901 <printf>
+    105c:	8b 05 9e 3f 00 00    	mov    0x3f9e(%rip),%eax        # 5000 <stdout>
+    1062:	48 8d 15 c8 26 00 00 	lea    0x26c8(%rip),%rdx        # 3731 <benchreport+0x363>
+    1069:	48 89 d6             	mov    %rdx,%rsi
+    106c:	89 c7                	mov    %eax,%edi
+    106e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1073:	e8 89 08 00 00       	call   1901 <printf>
+    1078:	8b 05 82 3f 00 00    	mov    0x3f82(%rip),%eax        # 5000 <stdout>
+    107e:	48 8d 15 4e 25 00 00 	lea    0x254e(%rip),%rdx        # 35d3 <benchreport+0x205>
+    1085:	48 89 d6             	mov    %rdx,%rsi
+    1088:	89 c7                	mov    %eax,%edi
+    108a:	b8 00 00 00 00       	mov    $0x0,%eax
+    108f:	e8 6d 08 00 00       	call   1901 <printf>
+    1094:	e8 98 0e 00 00       	call   1f31 <exit>
+
+  for (int i = 0; i < 50; ++i) {
+    1099:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10a0:	eb 42                	jmp    10e4 <concurrent_delete_test+0xda>
+    int pid = fork();
+    10a2:	e8 7a 0e 00 00       	call   1f21 <fork>
+    10a7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if (pid != 0)
+    10aa:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+    10ae:	75 2f                	jne    10df <concurrent_delete_test+0xd5>
+      continue;
+    if (unlink("cc_del") != -1)
+    10b0:	48 8d 05 73 26 00 00 	lea    0x2673(%rip),%rax        # 372a <benchreport+0x35c>
+    10b7:	48 89 c7             	mov    %rax,%rdi
+    10ba:	e8 64 19 00 00       	call   2a23 <unlink>
+    10bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10c2:	74 16                	je     10da <concurrent_delete_test+0xd0>
+      write(pipes[1], &buf, 1);
+    10c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10c7:	48 8d 4d e6          	lea    -0x1a(%rbp),%rcx
+    10cb:	ba 01 00 00 00       	mov    $0x1,%edx
+    10d0:	48 89 ce             	mov    %rcx,%rsi
+    10d3:	89 c7                	mov    %eax,%edi
+    10d5:	e8 07 19 00 00       	call   29e1 <write>
+    exit();
+    10da:	e8 52 0e 00 00       	call   1f31 <exit>
+      continue;
+    10df:	90                   	nop
+  for (int i = 0; i < 50; ++i) {
+    10e0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10e4:	83 7d fc 31          	cmpl   $0x31,-0x4(%rbp)
+    10e8:	7e b8                	jle    10a2 <concurrent_delete_test+0x98>
+  }
+  for (int i = 0; i < 50; ++i)
+    10ea:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    10f1:	eb 09                	jmp    10fc <concurrent_delete_test+0xf2>
+    wait();
+    10f3:	e8 c8 18 00 00       	call   29c0 <wait>
+  for (int i = 0; i < 50; ++i)
+    10f8:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    10fc:	83 7d f8 31          	cmpl   $0x31,-0x8(%rbp)
+    1100:	7e f1                	jle    10f3 <concurrent_delete_test+0xe9>
+  close(pipes[1]);
+    1102:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1105:	89 c7                	mov    %eax,%edi
+    1107:	e8 8f 0e 00 00       	call   1f9b <close>
+  if (2 == read(pipes[0], &buf, 2))
+    110c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    110f:	48 8d 4d e6          	lea    -0x1a(%rbp),%rcx
+    1113:	ba 02 00 00 00       	mov    $0x2,%edx
+    1118:	48 89 ce             	mov    %rcx,%rsi
+    111b:	89 c7                	mov    %eax,%edi
+    111d:	e8 b4 18 00 00       	call   29d6 <read>
+    1122:	83 f8 02             	cmp    $0x2,%eax
+    1125:	75 5e                	jne    1185 <concurrent_delete_test+0x17b>
+    error("File deleted multiple times");
+    1127:	8b 05 d3 3e 00 00    	mov    0x3ed3(%rip),%eax        # 5000 <stdout>
+    112d:	ba 07 01 00 00       	mov    $0x107,%edx
+    1132:	48 8d 0d 7a 24 00 00 	lea    0x247a(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    1139:	48 89 ce             	mov    %rcx,%rsi
+    113c:	89 c7                	mov    %eax,%edi
+    113e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1143:	e8 b9 07 00 00       	call   1901 <printf>
+    1148:	8b 05 b2 3e 00 00    	mov    0x3eb2(%rip),%eax        # 5000 <stdout>
+    114e:	48 8d 15 e8 25 00 00 	lea    0x25e8(%rip),%rdx        # 373d <benchreport+0x36f>
+    1155:	48 89 d6             	mov    %rdx,%rsi
+    1158:	89 c7                	mov    %eax,%edi
+    115a:	b8 00 00 00 00       	mov    $0x0,%eax
+    115f:	e8 9d 07 00 00       	call   1901 <printf>
+    1164:	8b 05 96 3e 00 00    	mov    0x3e96(%rip),%eax        # 5000 <stdout>
+    116a:	48 8d 15 62 24 00 00 	lea    0x2462(%rip),%rdx        # 35d3 <benchreport+0x205>
+    1171:	48 89 d6             	mov    %rdx,%rsi
+    1174:	89 c7                	mov    %eax,%edi
+    1176:	b8 00 00 00 00       	mov    $0x0,%eax
+    117b:	e8 81 07 00 00       	call   1901 <printf>
+    1180:	e8 ac 0d 00 00       	call   1f31 <exit>
+ printf(stdout, "concurrent delete test OK\n");
+    1185:	8b 05 75 3e 00 00    	mov    0x3e75(%rip),%eax        # 5000 <stdout>
+    118b:	48 8d 15 c7 25 00 00 	lea    0x25c7(%rip),%rdx        # 3759 <benchreport+0x38b>
+    1192:	48 89 d6             	mov    %rdx,%rsi
+    1195:	89 c7                	mov    %eax,%edi
+    1197:	b8 00 00 00 00       	mov    $0x0,%eax
+    119c:	e8 60 07 00 00       	call   1901 <printf>
+
+}
+    11a1:	90                   	nop
+    11a2:	c9                   	leave
+    11a3:	c3                   	ret
+
+00000000000011a4 <printBar>:
+
+void printBar(int count, bool backspace) {
+    11a4:	55                   	push   %rbp
+    11a5:	48 89 e5             	mov    %rsp,%rbp
+    11a8:	48 83 ec 20          	sub    $0x20,%rsp
+    11ac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    11af:	89 f0                	mov    %esi,%eax
+    11b1:	88 45 e8             	mov    %al,-0x18(%rbp)
+  if (backspace)
+    11b4:	80 7d e8 00          	cmpb   $0x0,-0x18(%rbp)
+    11b8:	74 2c                	je     11e6 <printBar+0x42>
+    for (int i = 0; i < 100 + 2; ++i)
+    11ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    11c1:	eb 1d                	jmp    11e0 <printBar+0x3c>
+      printf(1, "\b");
+    11c3:	48 8d 05 aa 25 00 00 	lea    0x25aa(%rip),%rax        # 3774 <benchreport+0x3a6>
+    11ca:	48 89 c6             	mov    %rax,%rsi
+    11cd:	bf 01 00 00 00       	mov    $0x1,%edi
+    11d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    11d7:	e8 25 07 00 00       	call   1901 <printf>
+    for (int i = 0; i < 100 + 2; ++i)
+    11dc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    11e0:	83 7d fc 65          	cmpl   $0x65,-0x4(%rbp)
+    11e4:	7e dd                	jle    11c3 <printBar+0x1f>
+  printf(1, "[");
+    11e6:	48 8d 05 89 25 00 00 	lea    0x2589(%rip),%rax        # 3776 <benchreport+0x3a8>
+    11ed:	48 89 c6             	mov    %rax,%rsi
+    11f0:	bf 01 00 00 00       	mov    $0x1,%edi
+    11f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    11fa:	e8 02 07 00 00       	call   1901 <printf>
+  for (int i = 0; i < 100; ++i)
+    11ff:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    1206:	eb 40                	jmp    1248 <printBar+0xa4>
+    if (i < count)
+    1208:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    120b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    120e:	7d 1b                	jge    122b <printBar+0x87>
+      printf(1, "#");
+    1210:	48 8d 05 61 25 00 00 	lea    0x2561(%rip),%rax        # 3778 <benchreport+0x3aa>
+    1217:	48 89 c6             	mov    %rax,%rsi
+    121a:	bf 01 00 00 00       	mov    $0x1,%edi
+    121f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1224:	e8 d8 06 00 00       	call   1901 <printf>
+    1229:	eb 19                	jmp    1244 <printBar+0xa0>
+    else printf(1, " ");
+    122b:	48 8d 05 48 25 00 00 	lea    0x2548(%rip),%rax        # 377a <benchreport+0x3ac>
+    1232:	48 89 c6             	mov    %rax,%rsi
+    1235:	bf 01 00 00 00       	mov    $0x1,%edi
+    123a:	b8 00 00 00 00       	mov    $0x0,%eax
+    123f:	e8 bd 06 00 00       	call   1901 <printf>
+  for (int i = 0; i < 100; ++i)
+    1244:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1248:	83 7d f8 63          	cmpl   $0x63,-0x8(%rbp)
+    124c:	7e ba                	jle    1208 <printBar+0x64>
+  printf(1, "]");
+    124e:	48 8d 05 27 25 00 00 	lea    0x2527(%rip),%rax        # 377c <benchreport+0x3ae>
+    1255:	48 89 c6             	mov    %rax,%rsi
+    1258:	bf 01 00 00 00       	mov    $0x1,%edi
+    125d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1262:	e8 9a 06 00 00       	call   1901 <printf>
+
+}
+    1267:	90                   	nop
+    1268:	c9                   	leave
+    1269:	c3                   	ret
+
+000000000000126a <delete_stress_test>:
+
+void delete_stress_test() {
+    126a:	55                   	push   %rbp
+    126b:	48 89 e5             	mov    %rsp,%rbp
+    126e:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  int fd0 = open("ddf1", O_RDWR | O_CREATE);
+    1275:	be 02 02 00 00       	mov    $0x202,%esi
+    127a:	48 8d 05 fd 24 00 00 	lea    0x24fd(%rip),%rax        # 377e <benchreport+0x3b0>
+    1281:	48 89 c7             	mov    %rax,%rdi
+    1284:	e8 84 17 00 00       	call   2a0d <open>
+    1289:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  char buf[128];
+  char* text = "This is the data that goes into the file created here.";
+    128c:	48 8d 05 f5 24 00 00 	lea    0x24f5(%rip),%rax        # 3788 <benchreport+0x3ba>
+    1293:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  // overwrite the last char, and append data.
+  int n = write(fd0, text, strlen(text));
+    1297:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    129b:	48 89 c7             	mov    %rax,%rdi
+    129e:	e8 e0 0f 00 00       	call   2283 <strlen>
+    12a3:	89 c2                	mov    %eax,%edx
+    12a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    12a9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    12ac:	48 89 ce             	mov    %rcx,%rsi
+    12af:	89 c7                	mov    %eax,%edi
+    12b1:	e8 2b 17 00 00       	call   29e1 <write>
+    12b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (n < 0)
+    12b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    12bd:	79 5e                	jns    131d <delete_stress_test+0xb3>
+    error("write failed");
+    12bf:	8b 05 3b 3d 00 00    	mov    0x3d3b(%rip),%eax        # 5000 <stdout>
+    12c5:	ba 20 01 00 00       	mov    $0x120,%edx
+    12ca:	48 8d 0d e2 22 00 00 	lea    0x22e2(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    12d1:	48 89 ce             	mov    %rcx,%rsi
+    12d4:	89 c7                	mov    %eax,%edi
+    12d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    12db:	e8 21 06 00 00       	call   1901 <printf>
+    12e0:	8b 05 1a 3d 00 00    	mov    0x3d1a(%rip),%eax        # 5000 <stdout>
+    12e6:	48 8d 15 d2 24 00 00 	lea    0x24d2(%rip),%rdx        # 37bf <benchreport+0x3f1>
+    12ed:	48 89 d6             	mov    %rdx,%rsi
+    12f0:	89 c7                	mov    %eax,%edi
+    12f2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f7:	e8 05 06 00 00       	call   1901 <printf>
+    12fc:	8b 05 fe 3c 00 00    	mov    0x3cfe(%rip),%eax        # 5000 <stdout>
+    1302:	48 8d 15 ca 22 00 00 	lea    0x22ca(%rip),%rdx        # 35d3 <benchreport+0x205>
+    1309:	48 89 d6             	mov    %rdx,%rsi
+    130c:	89 c7                	mov    %eax,%edi
+    130e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1313:	e8 e9 05 00 00       	call   1901 <printf>
+    1318:	e8 14 0c 00 00       	call   1f31 <exit>
+
+  if (close(fd0) == -1)
+    131d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1320:	89 c7                	mov    %eax,%edi
+    1322:	e8 74 0c 00 00       	call   1f9b <close>
+    1327:	83 f8 ff             	cmp    $0xffffffff,%eax
+    132a:	75 5e                	jne    138a <delete_stress_test+0x120>
+    error("unable to close");
+    132c:	8b 05 ce 3c 00 00    	mov    0x3cce(%rip),%eax        # 5000 <stdout>
+    1332:	ba 23 01 00 00       	mov    $0x123,%edx
+    1337:	48 8d 0d 75 22 00 00 	lea    0x2275(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    133e:	48 89 ce             	mov    %rcx,%rsi
+    1341:	89 c7                	mov    %eax,%edi
+    1343:	b8 00 00 00 00       	mov    $0x0,%eax
+    1348:	e8 b4 05 00 00       	call   1901 <printf>
+    134d:	8b 05 ad 3c 00 00    	mov    0x3cad(%rip),%eax        # 5000 <stdout>
+    1353:	48 8d 15 72 24 00 00 	lea    0x2472(%rip),%rdx        # 37cc <benchreport+0x3fe>
+    135a:	48 89 d6             	mov    %rdx,%rsi
+    135d:	89 c7                	mov    %eax,%edi
+    135f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1364:	e8 98 05 00 00       	call   1901 <printf>
+    1369:	8b 05 91 3c 00 00    	mov    0x3c91(%rip),%eax        # 5000 <stdout>
+    136f:	48 8d 15 5d 22 00 00 	lea    0x225d(%rip),%rdx        # 35d3 <benchreport+0x205>
+    1376:	48 89 d6             	mov    %rdx,%rsi
+    1379:	89 c7                	mov    %eax,%edi
+    137b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1380:	e8 7c 05 00 00       	call   1901 <printf>
+    1385:	e8 a7 0b 00 00       	call   1f31 <exit>
+  fd0 = open("ddf1", O_RDONLY);
+    138a:	be 00 00 00 00       	mov    $0x0,%esi
+    138f:	48 8d 05 e8 23 00 00 	lea    0x23e8(%rip),%rax        # 377e <benchreport+0x3b0>
+    1396:	48 89 c7             	mov    %rax,%rdi
+    1399:	e8 6f 16 00 00       	call   2a0d <open>
+    139e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (fd0 == -1)
+    13a1:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+    13a5:	75 5e                	jne    1405 <delete_stress_test+0x19b>
+    error("unable to reopen");
+    13a7:	8b 05 53 3c 00 00    	mov    0x3c53(%rip),%eax        # 5000 <stdout>
+    13ad:	ba 26 01 00 00       	mov    $0x126,%edx
+    13b2:	48 8d 0d fa 21 00 00 	lea    0x21fa(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    13b9:	48 89 ce             	mov    %rcx,%rsi
+    13bc:	89 c7                	mov    %eax,%edi
+    13be:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c3:	e8 39 05 00 00       	call   1901 <printf>
+    13c8:	8b 05 32 3c 00 00    	mov    0x3c32(%rip),%eax        # 5000 <stdout>
+    13ce:	48 8d 15 07 24 00 00 	lea    0x2407(%rip),%rdx        # 37dc <benchreport+0x40e>
+    13d5:	48 89 d6             	mov    %rdx,%rsi
+    13d8:	89 c7                	mov    %eax,%edi
+    13da:	b8 00 00 00 00       	mov    $0x0,%eax
+    13df:	e8 1d 05 00 00       	call   1901 <printf>
+    13e4:	8b 05 16 3c 00 00    	mov    0x3c16(%rip),%eax        # 5000 <stdout>
+    13ea:	48 8d 15 e2 21 00 00 	lea    0x21e2(%rip),%rdx        # 35d3 <benchreport+0x205>
+    13f1:	48 89 d6             	mov    %rdx,%rsi
+    13f4:	89 c7                	mov    %eax,%edi
+    13f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    13fb:	e8 01 05 00 00       	call   1901 <printf>
+    1400:	e8 2c 0b 00 00       	call   1f31 <exit>
+  // You better be reclaiming everything......
+  printf(1, "starting delete stress test (this should take around 5-10 min)...\n");
+    1405:	48 8d 05 e4 23 00 00 	lea    0x23e4(%rip),%rax        # 37f0 <benchreport+0x422>
+    140c:	48 89 c6             	mov    %rax,%rsi
+    140f:	bf 01 00 00 00       	mov    $0x1,%edi
+    1414:	b8 00 00 00 00       	mov    $0x0,%eax
+    1419:	e8 e3 04 00 00       	call   1901 <printf>
+  printBar(0, false);
+    141e:	be 00 00 00 00       	mov    $0x0,%esi
+    1423:	bf 00 00 00 00       	mov    $0x0,%edi
+    1428:	e8 77 fd ff ff       	call   11a4 <printBar>
+  // 2) change the number of loop iterations to (FSSIZE / min_file_blocks) * 2
+  //    (so if you always allocate 20 blocks per file, and drop FSSIZE to 10k,
+  //     you could try dropping this down to 1k iterations)
+  //
+  // Just make sure you test on the original parameters before submission!
+  for (int i = 1; i <= 100000; ++i) {
+    142d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1434:	e9 b7 01 00 00       	jmp    15f0 <delete_stress_test+0x386>
+    int fd = open("file", O_RDWR | O_CREATE);
+    1439:	be 02 02 00 00       	mov    $0x202,%esi
+    143e:	48 8d 05 ee 23 00 00 	lea    0x23ee(%rip),%rax        # 3833 <benchreport+0x465>
+    1445:	48 89 c7             	mov    %rax,%rdi
+    1448:	e8 c0 15 00 00       	call   2a0d <open>
+    144d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    if (fd == -1)
+    1450:	83 7d e8 ff          	cmpl   $0xffffffff,-0x18(%rbp)
+    1454:	75 61                	jne    14b7 <delete_stress_test+0x24d>
+      error("Unable to open file on %d", i);
+    1456:	8b 05 a4 3b 00 00    	mov    0x3ba4(%rip),%eax        # 5000 <stdout>
+    145c:	ba 39 01 00 00       	mov    $0x139,%edx
+    1461:	48 8d 0d 4b 21 00 00 	lea    0x214b(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    1468:	48 89 ce             	mov    %rcx,%rsi
+    146b:	89 c7                	mov    %eax,%edi
+    146d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1472:	e8 8a 04 00 00       	call   1901 <printf>
+    1477:	8b 05 83 3b 00 00    	mov    0x3b83(%rip),%eax        # 5000 <stdout>
+    147d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1480:	48 8d 0d b1 23 00 00 	lea    0x23b1(%rip),%rcx        # 3838 <benchreport+0x46a>
+    1487:	48 89 ce             	mov    %rcx,%rsi
+    148a:	89 c7                	mov    %eax,%edi
+    148c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1491:	e8 6b 04 00 00       	call   1901 <printf>
+    1496:	8b 05 64 3b 00 00    	mov    0x3b64(%rip),%eax        # 5000 <stdout>
+    149c:	48 8d 15 30 21 00 00 	lea    0x2130(%rip),%rdx        # 35d3 <benchreport+0x205>
+    14a3:	48 89 d6             	mov    %rdx,%rsi
+    14a6:	89 c7                	mov    %eax,%edi
+    14a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    14ad:	e8 4f 04 00 00       	call   1901 <printf>
+    14b2:	e8 7a 0a 00 00       	call   1f31 <exit>
+    if (close(fd) == -1)
+    14b7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    14ba:	89 c7                	mov    %eax,%edi
+    14bc:	e8 da 0a 00 00       	call   1f9b <close>
+    14c1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14c4:	75 61                	jne    1527 <delete_stress_test+0x2bd>
+      error("Unable to close file on %d", i);
+    14c6:	8b 05 34 3b 00 00    	mov    0x3b34(%rip),%eax        # 5000 <stdout>
+    14cc:	ba 3b 01 00 00       	mov    $0x13b,%edx
+    14d1:	48 8d 0d db 20 00 00 	lea    0x20db(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    14d8:	48 89 ce             	mov    %rcx,%rsi
+    14db:	89 c7                	mov    %eax,%edi
+    14dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    14e2:	e8 1a 04 00 00       	call   1901 <printf>
+    14e7:	8b 05 13 3b 00 00    	mov    0x3b13(%rip),%eax        # 5000 <stdout>
+    14ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    14f0:	48 8d 0d 5b 23 00 00 	lea    0x235b(%rip),%rcx        # 3852 <benchreport+0x484>
+    14f7:	48 89 ce             	mov    %rcx,%rsi
+    14fa:	89 c7                	mov    %eax,%edi
+    14fc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1501:	e8 fb 03 00 00       	call   1901 <printf>
+    1506:	8b 05 f4 3a 00 00    	mov    0x3af4(%rip),%eax        # 5000 <stdout>
+    150c:	48 8d 15 c0 20 00 00 	lea    0x20c0(%rip),%rdx        # 35d3 <benchreport+0x205>
+    1513:	48 89 d6             	mov    %rdx,%rsi
+    1516:	89 c7                	mov    %eax,%edi
+    1518:	b8 00 00 00 00       	mov    $0x0,%eax
+    151d:	e8 df 03 00 00       	call   1901 <printf>
+    1522:	e8 0a 0a 00 00       	call   1f31 <exit>
+    if (unlink("file") == -1)
+    1527:	48 8d 05 05 23 00 00 	lea    0x2305(%rip),%rax        # 3833 <benchreport+0x465>
+    152e:	48 89 c7             	mov    %rax,%rdi
+    1531:	e8 ed 14 00 00       	call   2a23 <unlink>
+    1536:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1539:	75 61                	jne    159c <delete_stress_test+0x332>
+      error("Unable to unlink file on %d", i);
+    153b:	8b 05 bf 3a 00 00    	mov    0x3abf(%rip),%eax        # 5000 <stdout>
+    1541:	ba 3d 01 00 00       	mov    $0x13d,%edx
+    1546:	48 8d 0d 66 20 00 00 	lea    0x2066(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    154d:	48 89 ce             	mov    %rcx,%rsi
+    1550:	89 c7                	mov    %eax,%edi
+    1552:	b8 00 00 00 00       	mov    $0x0,%eax
+    1557:	e8 a5 03 00 00       	call   1901 <printf>
+    155c:	8b 05 9e 3a 00 00    	mov    0x3a9e(%rip),%eax        # 5000 <stdout>
+    1562:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1565:	48 8d 0d 01 23 00 00 	lea    0x2301(%rip),%rcx        # 386d <benchreport+0x49f>
+    156c:	48 89 ce             	mov    %rcx,%rsi
+    156f:	89 c7                	mov    %eax,%edi
+    1571:	b8 00 00 00 00       	mov    $0x0,%eax
+    1576:	e8 86 03 00 00       	call   1901 <printf>
+    157b:	8b 05 7f 3a 00 00    	mov    0x3a7f(%rip),%eax        # 5000 <stdout>
+    1581:	48 8d 15 4b 20 00 00 	lea    0x204b(%rip),%rdx        # 35d3 <benchreport+0x205>
+    1588:	48 89 d6             	mov    %rdx,%rsi
+    158b:	89 c7                	mov    %eax,%edi
+    158d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1592:	e8 6a 03 00 00       	call   1901 <printf>
+    1597:	e8 95 09 00 00       	call   1f31 <exit>
+   if (i % 1000 == 0)
+    159c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    159f:	48 63 c2             	movslq %edx,%rax
+    15a2:	48 69 c0 d3 4d 62 10 	imul   $0x10624dd3,%rax,%rax
+    15a9:	48 c1 e8 20          	shr    $0x20,%rax
+    15ad:	c1 f8 06             	sar    $0x6,%eax
+    15b0:	89 d1                	mov    %edx,%ecx
+    15b2:	c1 f9 1f             	sar    $0x1f,%ecx
+    15b5:	29 c8                	sub    %ecx,%eax
+    15b7:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+    15bd:	89 d0                	mov    %edx,%eax
+    15bf:	29 c8                	sub    %ecx,%eax
+    15c1:	85 c0                	test   %eax,%eax
+    15c3:	75 27                	jne    15ec <delete_stress_test+0x382>
+      printBar(i / 1000, true);
+    15c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15c8:	48 63 d0             	movslq %eax,%rdx
+    15cb:	48 69 d2 d3 4d 62 10 	imul   $0x10624dd3,%rdx,%rdx
+    15d2:	48 c1 ea 20          	shr    $0x20,%rdx
+    15d6:	89 d1                	mov    %edx,%ecx
+    15d8:	c1 f9 06             	sar    $0x6,%ecx
+    15db:	99                   	cltd
+    15dc:	89 c8                	mov    %ecx,%eax
+    15de:	29 d0                	sub    %edx,%eax
+    15e0:	be 01 00 00 00       	mov    $0x1,%esi
+    15e5:	89 c7                	mov    %eax,%edi
+    15e7:	e8 b8 fb ff ff       	call   11a4 <printBar>
+  for (int i = 1; i <= 100000; ++i) {
+    15ec:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    15f0:	81 7d fc a0 86 01 00 	cmpl   $0x186a0,-0x4(%rbp)
+    15f7:	0f 8e 3c fe ff ff    	jle    1439 <delete_stress_test+0x1cf>
+  }
+
+  read(fd0, &buf, strlen(text));
+    15fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1601:	48 89 c7             	mov    %rax,%rdi
+    1604:	e8 7a 0c 00 00       	call   2283 <strlen>
+    1609:	89 c2                	mov    %eax,%edx
+    160b:	48 8d 8d 68 ff ff ff 	lea    -0x98(%rbp),%rcx
+    1612:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1615:	48 89 ce             	mov    %rcx,%rsi
+    1618:	89 c7                	mov    %eax,%edi
+    161a:	e8 b7 13 00 00       	call   29d6 <read>
+  if (strcmp(buf, text) != 0)
+    161f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1623:	48 8d 85 68 ff ff ff 	lea    -0x98(%rbp),%rax
+    162a:	48 89 d6             	mov    %rdx,%rsi
+    162d:	48 89 c7             	mov    %rax,%rdi
+    1630:	e8 ff 0b 00 00       	call   2234 <strcmp>
+    1635:	85 c0                	test   %eax,%eax
+    1637:	74 66                	je     169f <delete_stress_test+0x435>
+    error("Bad. %s  //  %s\n", buf, text);
+    1639:	8b 05 c1 39 00 00    	mov    0x39c1(%rip),%eax        # 5000 <stdout>
+    163f:	ba 44 01 00 00       	mov    $0x144,%edx
+    1644:	48 8d 0d 68 1f 00 00 	lea    0x1f68(%rip),%rcx        # 35b3 <benchreport+0x1e5>
+    164b:	48 89 ce             	mov    %rcx,%rsi
+    164e:	89 c7                	mov    %eax,%edi
+    1650:	b8 00 00 00 00       	mov    $0x0,%eax
+    1655:	e8 a7 02 00 00       	call   1901 <printf>
+    165a:	8b 05 a0 39 00 00    	mov    0x39a0(%rip),%eax        # 5000 <stdout>
+    1660:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1664:	48 8d 95 68 ff ff ff 	lea    -0x98(%rbp),%rdx
+    166b:	48 8d 35 17 22 00 00 	lea    0x2217(%rip),%rsi        # 3889 <benchreport+0x4bb>
+    1672:	89 c7                	mov    %eax,%edi
+    1674:	b8 00 00 00 00       	mov    $0x0,%eax
+    1679:	e8 83 02 00 00       	call   1901 <printf>
+    167e:	8b 05 7c 39 00 00    	mov    0x397c(%rip),%eax        # 5000 <stdout>
+    1684:	48 8d 15 48 1f 00 00 	lea    0x1f48(%rip),%rdx        # 35d3 <benchreport+0x205>
+    168b:	48 89 d6             	mov    %rdx,%rsi
+    168e:	89 c7                	mov    %eax,%edi
+    1690:	b8 00 00 00 00       	mov    $0x0,%eax
+    1695:	e8 67 02 00 00       	call   1901 <printf>
+    169a:	e8 92 08 00 00       	call   1f31 <exit>
+
+  printf(1, "\ndelete stress test OK\n");
+    169f:	48 8d 05 f4 21 00 00 	lea    0x21f4(%rip),%rax        # 389a <benchreport+0x4cc>
+    16a6:	48 89 c6             	mov    %rax,%rsi
+    16a9:	bf 01 00 00 00       	mov    $0x1,%edi
+    16ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    16b3:	e8 49 02 00 00       	call   1901 <printf>
+
+}
+    16b8:	90                   	nop
+    16b9:	c9                   	leave
+    16ba:	c3                   	ret
+
+00000000000016bb <main>:
+
+int main(int argc, char *argv[]) {
+    16bb:	55                   	push   %rbp
+    16bc:	48 89 e5             	mov    %rsp,%rbp
+    16bf:	48 83 ec 10          	sub    $0x10,%rsp
+    16c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    16c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab4test_b starting\n");
+    16ca:	8b 05 30 39 00 00    	mov    0x3930(%rip),%eax        # 5000 <stdout>
+    16d0:	48 8d 15 db 21 00 00 	lea    0x21db(%rip),%rdx        # 38b2 <benchreport+0x4e4>
+    16d7:	48 89 d6             	mov    %rdx,%rsi
+    16da:	89 c7                	mov    %eax,%edi
+    16dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e1:	e8 1b 02 00 00       	call   1901 <printf>
+  concurrent_dup_test();
+    16e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    16eb:	e8 10 e9 ff ff       	call   0 <concurrent_dup_test>
+  concurrent_create_test();
+    16f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f5:	e8 6a ec ff ff       	call   364 <concurrent_create_test>
+  concurrent_write_test();
+    16fa:	b8 00 00 00 00       	mov    $0x0,%eax
+    16ff:	e8 25 f1 ff ff       	call   829 <concurrent_write_test>
+  concurrent_read_test();
+    1704:	b8 00 00 00 00       	mov    $0x0,%eax
+    1709:	e8 25 f5 ff ff       	call   c33 <concurrent_read_test>
+  concurrent_delete_test();
+    170e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1713:	e8 f2 f8 ff ff       	call   100a <concurrent_delete_test>
+  delete_stress_test();
+    1718:	b8 00 00 00 00       	mov    $0x0,%eax
+    171d:	e8 48 fb ff ff       	call   126a <delete_stress_test>
+  printf(stdout, "lab4test_b passed!\n");
+    1722:	8b 05 d8 38 00 00    	mov    0x38d8(%rip),%eax        # 5000 <stdout>
+    1728:	48 8d 15 98 21 00 00 	lea    0x2198(%rip),%rdx        # 38c7 <benchreport+0x4f9>
+    172f:	48 89 d6             	mov    %rdx,%rsi
+    1732:	89 c7                	mov    %eax,%edi
+    1734:	b8 00 00 00 00       	mov    $0x0,%eax
+    1739:	e8 c3 01 00 00       	call   1901 <printf>
+  exit();
+    173e:	e8 ee 07 00 00       	call   1f31 <exit>
+
+0000000000001743 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    1743:	55                   	push   %rbp
+    1744:	48 89 e5             	mov    %rsp,%rbp
+    1747:	48 83 ec 10          	sub    $0x10,%rsp
+    174b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    174e:	89 f0                	mov    %esi,%eax
+    1750:	88 45 f8             	mov    %al,-0x8(%rbp)
+    1753:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    1757:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    175a:	89 d6                	mov    %edx,%esi
+    175c:	89 c7                	mov    %eax,%edi
+    175e:	e8 eb 06 00 00       	call   1e4e <bputc>
+    1763:	90                   	nop
+    1764:	c9                   	leave
+    1765:	c3                   	ret
+
+0000000000001766 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    1766:	55                   	push   %rbp
+    1767:	48 89 e5             	mov    %rsp,%rbp
+    176a:	48 83 ec 50          	sub    $0x50,%rsp
+    176e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1771:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    1775:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    1778:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    177b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    177f:	74 21                	je     17a2 <printint64+0x3c>
+    1781:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1785:	48 c1 e8 3f          	shr    $0x3f,%rax
+    1789:	0f b6 c0             	movzbl %al,%eax
+    178c:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    178f:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1793:	74 0d                	je     17a2 <printint64+0x3c>
+    x = -xx;
+    1795:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1799:	48 f7 d8             	neg    %rax
+    179c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17a0:	eb 08                	jmp    17aa <printint64+0x44>
+  else
+    x = xx;
+    17a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    17a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    17aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    17b1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    17b4:	48 63 c8             	movslq %eax,%rcx
+    17b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17bb:	ba 00 00 00 00       	mov    $0x0,%edx
+    17c0:	48 f7 f1             	div    %rcx
+    17c3:	48 89 d1             	mov    %rdx,%rcx
+    17c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17c9:	8d 50 01             	lea    0x1(%rax),%edx
+    17cc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    17cf:	48 8d 15 3a 38 00 00 	lea    0x383a(%rip),%rdx        # 5010 <digits.1>
+    17d6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    17da:	48 98                	cltq
+    17dc:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    17e0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    17e3:	48 63 f0             	movslq %eax,%rsi
+    17e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17ea:	ba 00 00 00 00       	mov    $0x0,%edx
+    17ef:	48 f7 f6             	div    %rsi
+    17f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17f6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17fb:	75 b4                	jne    17b1 <printint64+0x4b>
+
+  if (sgn)
+    17fd:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    1801:	74 2b                	je     182e <printint64+0xc8>
+    buf[i++] = '-';
+    1803:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1806:	8d 50 01             	lea    0x1(%rax),%edx
+    1809:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    180c:	48 98                	cltq
+    180e:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1813:	eb 19                	jmp    182e <printint64+0xc8>
+    putc(fd, buf[i]);
+    1815:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1818:	48 98                	cltq
+    181a:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    181f:	0f be d0             	movsbl %al,%edx
+    1822:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1825:	89 d6                	mov    %edx,%esi
+    1827:	89 c7                	mov    %eax,%edi
+    1829:	e8 15 ff ff ff       	call   1743 <putc>
+  while (--i >= 0)
+    182e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1832:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1836:	79 dd                	jns    1815 <printint64+0xaf>
+}
+    1838:	90                   	nop
+    1839:	90                   	nop
+    183a:	c9                   	leave
+    183b:	c3                   	ret
+
+000000000000183c <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    183c:	55                   	push   %rbp
+    183d:	48 89 e5             	mov    %rsp,%rbp
+    1840:	48 83 ec 30          	sub    $0x30,%rsp
+    1844:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1847:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    184a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    184d:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1850:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    1857:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    185b:	74 17                	je     1874 <printint+0x38>
+    185d:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1861:	79 11                	jns    1874 <printint+0x38>
+    neg = 1;
+    1863:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    186a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    186d:	f7 d8                	neg    %eax
+    186f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1872:	eb 06                	jmp    187a <printint+0x3e>
+  } else {
+    x = xx;
+    1874:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1877:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    187a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    1881:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1884:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1887:	ba 00 00 00 00       	mov    $0x0,%edx
+    188c:	f7 f1                	div    %ecx
+    188e:	89 d1                	mov    %edx,%ecx
+    1890:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1893:	8d 50 01             	lea    0x1(%rax),%edx
+    1896:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1899:	89 c9                	mov    %ecx,%ecx
+    189b:	48 8d 15 8e 37 00 00 	lea    0x378e(%rip),%rdx        # 5030 <digits.0>
+    18a2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    18a6:	48 98                	cltq
+    18a8:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    18ac:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    18af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18b2:	ba 00 00 00 00       	mov    $0x0,%edx
+    18b7:	f7 f6                	div    %esi
+    18b9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    18bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    18c0:	75 bf                	jne    1881 <printint+0x45>
+  if (neg)
+    18c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    18c6:	74 2b                	je     18f3 <printint+0xb7>
+    buf[i++] = '-';
+    18c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18cb:	8d 50 01             	lea    0x1(%rax),%edx
+    18ce:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    18d1:	48 98                	cltq
+    18d3:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    18d8:	eb 19                	jmp    18f3 <printint+0xb7>
+    putc(fd, buf[i]);
+    18da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18dd:	48 98                	cltq
+    18df:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    18e4:	0f be d0             	movsbl %al,%edx
+    18e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18ea:	89 d6                	mov    %edx,%esi
+    18ec:	89 c7                	mov    %eax,%edi
+    18ee:	e8 50 fe ff ff       	call   1743 <putc>
+  while (--i >= 0)
+    18f3:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    18f7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    18fb:	79 dd                	jns    18da <printint+0x9e>
+}
+    18fd:	90                   	nop
+    18fe:	90                   	nop
+    18ff:	c9                   	leave
+    1900:	c3                   	ret
+
+0000000000001901 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    1901:	55                   	push   %rbp
+    1902:	48 89 e5             	mov    %rsp,%rbp
+    1905:	48 83 ec 70          	sub    $0x70,%rsp
+    1909:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    190c:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1910:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1914:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1918:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    191c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    1920:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1927:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    192b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    192f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1933:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1937:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    193e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1945:	e9 67 02 00 00       	jmp    1bb1 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    194a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    194d:	48 63 d0             	movslq %eax,%rdx
+    1950:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1954:	48 01 d0             	add    %rdx,%rax
+    1957:	0f b6 00             	movzbl (%rax),%eax
+    195a:	0f be c0             	movsbl %al,%eax
+    195d:	25 ff 00 00 00       	and    $0xff,%eax
+    1962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    1965:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1969:	75 30                	jne    199b <printf+0x9a>
+      if (c == '%') {
+    196b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    196f:	75 13                	jne    1984 <printf+0x83>
+        state = '%';
+    1971:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1978:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    197f:	e9 29 02 00 00       	jmp    1bad <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    1984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1987:	0f be d0             	movsbl %al,%edx
+    198a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    198d:	89 d6                	mov    %edx,%esi
+    198f:	89 c7                	mov    %eax,%edi
+    1991:	e8 ad fd ff ff       	call   1743 <putc>
+    1996:	e9 12 02 00 00       	jmp    1bad <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    199b:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    199f:	0f 85 08 02 00 00    	jne    1bad <printf+0x2ac>
+      if (c == 'l') {
+    19a5:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    19a9:	75 0c                	jne    19b7 <printf+0xb6>
+        lflag = 1;
+    19ab:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    19b2:	e9 f6 01 00 00       	jmp    1bad <printf+0x2ac>
+      } else if (c == 'd') {
+    19b7:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    19bb:	0f 85 93 00 00 00    	jne    1a54 <printf+0x153>
+        if (lflag == 1)
+    19c1:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    19c5:	75 47                	jne    1a0e <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    19c7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    19ca:	83 f8 2f             	cmp    $0x2f,%eax
+    19cd:	77 17                	ja     19e6 <printf+0xe5>
+    19cf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    19d3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    19d6:	89 d2                	mov    %edx,%edx
+    19d8:	48 01 d0             	add    %rdx,%rax
+    19db:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    19de:	83 c2 08             	add    $0x8,%edx
+    19e1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    19e4:	eb 0c                	jmp    19f2 <printf+0xf1>
+    19e6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    19ea:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    19ee:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    19f2:	48 8b 30             	mov    (%rax),%rsi
+    19f5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19f8:	b9 01 00 00 00       	mov    $0x1,%ecx
+    19fd:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1a02:	89 c7                	mov    %eax,%edi
+    1a04:	e8 5d fd ff ff       	call   1766 <printint64>
+    1a09:	e9 98 01 00 00       	jmp    1ba6 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    1a0e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1a11:	83 f8 2f             	cmp    $0x2f,%eax
+    1a14:	77 17                	ja     1a2d <printf+0x12c>
+    1a16:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a1a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a1d:	89 d2                	mov    %edx,%edx
+    1a1f:	48 01 d0             	add    %rdx,%rax
+    1a22:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a25:	83 c2 08             	add    $0x8,%edx
+    1a28:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1a2b:	eb 0c                	jmp    1a39 <printf+0x138>
+    1a2d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1a31:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1a35:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1a39:	8b 30                	mov    (%rax),%esi
+    1a3b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1a3e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1a43:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1a48:	89 c7                	mov    %eax,%edi
+    1a4a:	e8 ed fd ff ff       	call   183c <printint>
+    1a4f:	e9 52 01 00 00       	jmp    1ba6 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    1a54:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1a58:	74 0a                	je     1a64 <printf+0x163>
+    1a5a:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1a5e:	0f 85 93 00 00 00    	jne    1af7 <printf+0x1f6>
+        if (lflag == 1)
+    1a64:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1a68:	75 47                	jne    1ab1 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1a6a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1a6d:	83 f8 2f             	cmp    $0x2f,%eax
+    1a70:	77 17                	ja     1a89 <printf+0x188>
+    1a72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a76:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a79:	89 d2                	mov    %edx,%edx
+    1a7b:	48 01 d0             	add    %rdx,%rax
+    1a7e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a81:	83 c2 08             	add    $0x8,%edx
+    1a84:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1a87:	eb 0c                	jmp    1a95 <printf+0x194>
+    1a89:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1a8d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1a91:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1a95:	48 8b 30             	mov    (%rax),%rsi
+    1a98:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1a9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1aa0:	ba 10 00 00 00       	mov    $0x10,%edx
+    1aa5:	89 c7                	mov    %eax,%edi
+    1aa7:	e8 ba fc ff ff       	call   1766 <printint64>
+        if (lflag == 1)
+    1aac:	e9 f5 00 00 00       	jmp    1ba6 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1ab1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1ab4:	83 f8 2f             	cmp    $0x2f,%eax
+    1ab7:	77 17                	ja     1ad0 <printf+0x1cf>
+    1ab9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1abd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ac0:	89 d2                	mov    %edx,%edx
+    1ac2:	48 01 d0             	add    %rdx,%rax
+    1ac5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1ac8:	83 c2 08             	add    $0x8,%edx
+    1acb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1ace:	eb 0c                	jmp    1adc <printf+0x1db>
+    1ad0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1ad4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ad8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1adc:	8b 30                	mov    (%rax),%esi
+    1ade:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1ae1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1ae6:	ba 10 00 00 00       	mov    $0x10,%edx
+    1aeb:	89 c7                	mov    %eax,%edi
+    1aed:	e8 4a fd ff ff       	call   183c <printint>
+        if (lflag == 1)
+    1af2:	e9 af 00 00 00       	jmp    1ba6 <printf+0x2a5>
+      } else if (c == 's') {
+    1af7:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1afb:	75 6e                	jne    1b6b <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1afd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1b00:	83 f8 2f             	cmp    $0x2f,%eax
+    1b03:	77 17                	ja     1b1c <printf+0x21b>
+    1b05:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1b09:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1b0c:	89 d2                	mov    %edx,%edx
+    1b0e:	48 01 d0             	add    %rdx,%rax
+    1b11:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1b14:	83 c2 08             	add    $0x8,%edx
+    1b17:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1b1a:	eb 0c                	jmp    1b28 <printf+0x227>
+    1b1c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1b20:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1b24:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1b28:	48 8b 00             	mov    (%rax),%rax
+    1b2b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1b2f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1b34:	75 28                	jne    1b5e <printf+0x25d>
+          s = "(null)";
+    1b36:	48 8d 05 9e 1d 00 00 	lea    0x1d9e(%rip),%rax        # 38db <benchreport+0x50d>
+    1b3d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    1b41:	eb 1b                	jmp    1b5e <printf+0x25d>
+          putc(fd, *s);
+    1b43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b47:	0f b6 00             	movzbl (%rax),%eax
+    1b4a:	0f be d0             	movsbl %al,%edx
+    1b4d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b50:	89 d6                	mov    %edx,%esi
+    1b52:	89 c7                	mov    %eax,%edi
+    1b54:	e8 ea fb ff ff       	call   1743 <putc>
+        for (; *s; s++)
+    1b59:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1b5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b62:	0f b6 00             	movzbl (%rax),%eax
+    1b65:	84 c0                	test   %al,%al
+    1b67:	75 da                	jne    1b43 <printf+0x242>
+    1b69:	eb 3b                	jmp    1ba6 <printf+0x2a5>
+      } else if (c == '%') {
+    1b6b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1b6f:	75 14                	jne    1b85 <printf+0x284>
+        putc(fd, c);
+    1b71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1b74:	0f be d0             	movsbl %al,%edx
+    1b77:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b7a:	89 d6                	mov    %edx,%esi
+    1b7c:	89 c7                	mov    %eax,%edi
+    1b7e:	e8 c0 fb ff ff       	call   1743 <putc>
+    1b83:	eb 21                	jmp    1ba6 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1b85:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b88:	be 25 00 00 00       	mov    $0x25,%esi
+    1b8d:	89 c7                	mov    %eax,%edi
+    1b8f:	e8 af fb ff ff       	call   1743 <putc>
+        putc(fd, c);
+    1b94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1b97:	0f be d0             	movsbl %al,%edx
+    1b9a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1b9d:	89 d6                	mov    %edx,%esi
+    1b9f:	89 c7                	mov    %eax,%edi
+    1ba1:	e8 9d fb ff ff       	call   1743 <putc>
+      }
+      state = 0;
+    1ba6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    1bad:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1bb1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1bb4:	48 63 d0             	movslq %eax,%rdx
+    1bb7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1bbb:	48 01 d0             	add    %rdx,%rax
+    1bbe:	0f b6 00             	movzbl (%rax),%eax
+    1bc1:	84 c0                	test   %al,%al
+    1bc3:	0f 85 81 fd ff ff    	jne    194a <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    1bc9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1bcc:	89 c7                	mov    %eax,%edi
+    1bce:	e8 ee 02 00 00       	call   1ec1 <bflushtty>
+}
+    1bd3:	90                   	nop
+    1bd4:	c9                   	leave
+    1bd5:	c3                   	ret
+
+0000000000001bd6 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    1bd6:	55                   	push   %rbp
+    1bd7:	48 89 e5             	mov    %rsp,%rbp
+    1bda:	48 83 ec 30          	sub    $0x30,%rsp
+    1bde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    1be1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1be5:	78 06                	js     1bed <getbuf+0x17>
+    1be7:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    1beb:	7e 0a                	jle    1bf7 <getbuf+0x21>
+    return 0;
+    1bed:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bf2:	e9 94 00 00 00       	jmp    1c8b <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    1bf7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bfa:	48 98                	cltq
+    1bfc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c03:	00 
+    1c04:	48 8d 05 55 34 00 00 	lea    0x3455(%rip),%rax        # 5060 <obufs>
+    1c0b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1c0f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c13:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1c18:	75 6d                	jne    1c87 <getbuf+0xb1>
+    1c1a:	bf 08 02 00 00       	mov    $0x208,%edi
+    1c1f:	e8 bd 13 00 00       	call   2fe1 <malloc>
+    1c24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c28:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1c2d:	74 58                	je     1c87 <getbuf+0xb1>
+    b->n = 0;
+    1c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c33:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    1c39:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    1c3d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c40:	48 89 d6             	mov    %rdx,%rsi
+    1c43:	89 c7                	mov    %eax,%edi
+    1c45:	e8 e4 0d 00 00       	call   2a2e <fstat>
+    1c4a:	85 c0                	test   %eax,%eax
+    1c4c:	75 11                	jne    1c5f <getbuf+0x89>
+    1c4e:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    1c52:	66 83 f8 03          	cmp    $0x3,%ax
+    1c56:	75 07                	jne    1c5f <getbuf+0x89>
+    1c58:	ba 01 00 00 00       	mov    $0x1,%edx
+    1c5d:	eb 05                	jmp    1c64 <getbuf+0x8e>
+    1c5f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1c64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c68:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    1c6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c6e:	48 98                	cltq
+    1c70:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1c77:	00 
+    1c78:	48 8d 15 e1 33 00 00 	lea    0x33e1(%rip),%rdx        # 5060 <obufs>
+    1c7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c83:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    1c87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c8b:	c9                   	leave
+    1c8c:	c3                   	ret
+
+0000000000001c8d <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    1c8d:	55                   	push   %rbp
+    1c8e:	48 89 e5             	mov    %rsp,%rbp
+    1c91:	48 83 ec 20          	sub    $0x20,%rsp
+    1c95:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    1c98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1c9c:	78 33                	js     1cd1 <bflush+0x44>
+    1c9e:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    1ca2:	7f 2d                	jg     1cd1 <bflush+0x44>
+    1ca4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ca7:	48 98                	cltq
+    1ca9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cb0:	00 
+    1cb1:	48 8d 05 a8 33 00 00 	lea    0x33a8(%rip),%rax        # 5060 <obufs>
+    1cb8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1cbc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cc0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1cc5:	74 0a                	je     1cd1 <bflush+0x44>
+    1cc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ccb:	8b 00                	mov    (%rax),%eax
+    1ccd:	85 c0                	test   %eax,%eax
+    1ccf:	75 07                	jne    1cd8 <bflush+0x4b>
+    return 0;
+    1cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cd6:	eb 3c                	jmp    1d14 <bflush+0x87>
+  n = b->n;
+    1cd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cdc:	8b 00                	mov    (%rax),%eax
+    1cde:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    1ce1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ce5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    1ceb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    1cf3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1cf6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1cf9:	48 89 ce             	mov    %rcx,%rsi
+    1cfc:	89 c7                	mov    %eax,%edi
+    1cfe:	e8 de 0c 00 00       	call   29e1 <write>
+    1d03:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1d06:	75 07                	jne    1d0f <bflush+0x82>
+    1d08:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d0d:	eb 05                	jmp    1d14 <bflush+0x87>
+    1d0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1d14:	c9                   	leave
+    1d15:	c3                   	ret
+
+0000000000001d16 <bflushall>:
+
+void bflushall(void) {
+    1d16:	55                   	push   %rbp
+    1d17:	48 89 e5             	mov    %rsp,%rbp
+    1d1a:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    1d1e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d25:	eb 0e                	jmp    1d35 <bflushall+0x1f>
+    bflush(fd);
+    1d27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d2a:	89 c7                	mov    %eax,%edi
+    1d2c:	e8 5c ff ff ff       	call   1c8d <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    1d31:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1d35:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1d39:	7e ec                	jle    1d27 <bflushall+0x11>
+}
+    1d3b:	90                   	nop
+    1d3c:	90                   	nop
+    1d3d:	c9                   	leave
+    1d3e:	c3                   	ret
+
+0000000000001d3f <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    1d3f:	55                   	push   %rbp
+    1d40:	48 89 e5             	mov    %rsp,%rbp
+    1d43:	48 83 ec 30          	sub    $0x30,%rsp
+    1d47:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1d4a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    1d4e:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    1d51:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d54:	89 c7                	mov    %eax,%edi
+    1d56:	e8 7b fe ff ff       	call   1bd6 <getbuf>
+    1d5b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d5f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1d64:	75 19                	jne    1d7f <bwrite+0x40>
+    return write(fd, s, n);
+    1d66:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    1d69:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    1d6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d70:	48 89 ce             	mov    %rcx,%rsi
+    1d73:	89 c7                	mov    %eax,%edi
+    1d75:	e8 67 0c 00 00       	call   29e1 <write>
+    1d7a:	e9 cd 00 00 00       	jmp    1e4c <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    1d7f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d86:	e9 92 00 00 00       	jmp    1e1d <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    1d8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d8f:	8b 00                	mov    (%rax),%eax
+    1d91:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1d96:	75 18                	jne    1db0 <bwrite+0x71>
+    1d98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d9b:	89 c7                	mov    %eax,%edi
+    1d9d:	e8 eb fe ff ff       	call   1c8d <bflush>
+    1da2:	85 c0                	test   %eax,%eax
+    1da4:	79 0a                	jns    1db0 <bwrite+0x71>
+      return -1;
+    1da6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1dab:	e9 9c 00 00 00       	jmp    1e4c <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    1db0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1db3:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    1db6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    1db9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dbd:	8b 00                	mov    (%rax),%eax
+    1dbf:	ba 00 02 00 00       	mov    $0x200,%edx
+    1dc4:	29 c2                	sub    %eax,%edx
+    1dc6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    1dc9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1dcc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    1dcf:	39 c2                	cmp    %eax,%edx
+    1dd1:	0f 4e c2             	cmovle %edx,%eax
+    1dd4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    1dd7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dda:	48 63 d0             	movslq %eax,%rdx
+    1ddd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1de1:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    1de5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1de9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1ded:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1df1:	8b 00                	mov    (%rax),%eax
+    1df3:	48 98                	cltq
+    1df5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1df9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1dfc:	89 c2                	mov    %eax,%edx
+    1dfe:	48 89 cf             	mov    %rcx,%rdi
+    1e01:	e8 e9 06 00 00       	call   24ef <memmove>
+    b->n += m;
+    1e06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e0a:	8b 10                	mov    (%rax),%edx
+    1e0c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1e0f:	01 c2                	add    %eax,%edx
+    1e11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e15:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    1e17:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1e1a:	01 45 fc             	add    %eax,-0x4(%rbp)
+    1e1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e20:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    1e23:	0f 8c 62 ff ff ff    	jl     1d8b <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    1e29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e2d:	8b 40 04             	mov    0x4(%rax),%eax
+    1e30:	85 c0                	test   %eax,%eax
+    1e32:	74 15                	je     1e49 <bwrite+0x10a>
+    1e34:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e37:	89 c7                	mov    %eax,%edi
+    1e39:	e8 4f fe ff ff       	call   1c8d <bflush>
+    1e3e:	85 c0                	test   %eax,%eax
+    1e40:	79 07                	jns    1e49 <bwrite+0x10a>
+    return -1;
+    1e42:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1e47:	eb 03                	jmp    1e4c <bwrite+0x10d>
+  return n;
+    1e49:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    1e4c:	c9                   	leave
+    1e4d:	c3                   	ret
+
+0000000000001e4e <bputc>:
+
+void bputc(int fd, char c) {
+    1e4e:	55                   	push   %rbp
+    1e4f:	48 89 e5             	mov    %rsp,%rbp
+    1e52:	48 83 ec 20          	sub    $0x20,%rsp
+    1e56:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1e59:	89 f0                	mov    %esi,%eax
+    1e5b:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    1e5e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e61:	89 c7                	mov    %eax,%edi
+    1e63:	e8 6e fd ff ff       	call   1bd6 <getbuf>
+    1e68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1e6c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1e71:	75 18                	jne    1e8b <bputc+0x3d>
+    write(fd, &c, 1);
+    1e73:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    1e77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e7a:	ba 01 00 00 00       	mov    $0x1,%edx
+    1e7f:	48 89 ce             	mov    %rcx,%rsi
+    1e82:	89 c7                	mov    %eax,%edi
+    1e84:	e8 58 0b 00 00       	call   29e1 <write>
+    return;
+    1e89:	eb 34                	jmp    1ebf <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    1e8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e8f:	8b 00                	mov    (%rax),%eax
+    1e91:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1e96:	75 0a                	jne    1ea2 <bputc+0x54>
+    bflush(fd);
+    1e98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e9b:	89 c7                	mov    %eax,%edi
+    1e9d:	e8 eb fd ff ff       	call   1c8d <bflush>
+  b->data[b->n++] = c;
+    1ea2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ea6:	8b 00                	mov    (%rax),%eax
+    1ea8:	8d 48 01             	lea    0x1(%rax),%ecx
+    1eab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1eaf:	89 0a                	mov    %ecx,(%rdx)
+    1eb1:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    1eb5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1eb9:	48 98                	cltq
+    1ebb:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    1ebf:	c9                   	leave
+    1ec0:	c3                   	ret
+
+0000000000001ec1 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    1ec1:	55                   	push   %rbp
+    1ec2:	48 89 e5             	mov    %rsp,%rbp
+    1ec5:	48 83 ec 10          	sub    $0x10,%rsp
+    1ec9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    1ecc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1ed0:	78 4c                	js     1f1e <bflushtty+0x5d>
+    1ed2:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1ed6:	7f 46                	jg     1f1e <bflushtty+0x5d>
+    1ed8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1edb:	48 98                	cltq
+    1edd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ee4:	00 
+    1ee5:	48 8d 05 74 31 00 00 	lea    0x3174(%rip),%rax        # 5060 <obufs>
+    1eec:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1ef0:	48 85 c0             	test   %rax,%rax
+    1ef3:	74 29                	je     1f1e <bflushtty+0x5d>
+    1ef5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ef8:	48 98                	cltq
+    1efa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f01:	00 
+    1f02:	48 8d 05 57 31 00 00 	lea    0x3157(%rip),%rax        # 5060 <obufs>
+    1f09:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f0d:	8b 40 04             	mov    0x4(%rax),%eax
+    1f10:	85 c0                	test   %eax,%eax
+    1f12:	74 0a                	je     1f1e <bflushtty+0x5d>
+    bflush(fd);
+    1f14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f17:	89 c7                	mov    %eax,%edi
+    1f19:	e8 6f fd ff ff       	call   1c8d <bflush>
+}
+    1f1e:	90                   	nop
+    1f1f:	c9                   	leave
+    1f20:	c3                   	ret
+
+0000000000001f21 <fork>:
+
+int fork(void) {
+    1f21:	55                   	push   %rbp
+    1f22:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1f25:	e8 ec fd ff ff       	call   1d16 <bflushall>
+  return _fork();
+    1f2a:	e8 7b 0a 00 00       	call   29aa <_fork>
+}
+    1f2f:	5d                   	pop    %rbp
+    1f30:	c3                   	ret
+
+0000000000001f31 <exit>:
+
+noreturn void exit(void) {
+    1f31:	55                   	push   %rbp
+    1f32:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1f35:	e8 dc fd ff ff       	call   1d16 <bflushall>
+  _exit();
+    1f3a:	e8 76 0a 00 00       	call   29b5 <_exit>
+
+0000000000001f3f <exec>:
+}
+
+int exec(char *path, char **argv) {
+    1f3f:	55                   	push   %rbp
+    1f40:	48 89 e5             	mov    %rsp,%rbp
+    1f43:	48 83 ec 10          	sub    $0x10,%rsp
+    1f47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f4b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    1f4f:	e8 c2 fd ff ff       	call   1d16 <bflushall>
+  return _exec(path, argv);
+    1f54:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1f58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f5c:	48 89 d6             	mov    %rdx,%rsi
+    1f5f:	48 89 c7             	mov    %rax,%rdi
+    1f62:	e8 9b 0a 00 00       	call   2a02 <_exec>
+}
+    1f67:	c9                   	leave
+    1f68:	c3                   	ret
+
+0000000000001f69 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    1f69:	55                   	push   %rbp
+    1f6a:	48 89 e5             	mov    %rsp,%rbp
+    1f6d:	48 83 ec 20          	sub    $0x20,%rsp
+    1f71:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1f75:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1f79:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    1f7d:	e8 94 fd ff ff       	call   1d16 <bflushall>
+  return _spawn(path, argv, fds);
+    1f82:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1f86:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1f8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f8e:	48 89 ce             	mov    %rcx,%rsi
+    1f91:	48 89 c7             	mov    %rax,%rdi
+    1f94:	e8 2f 0b 00 00       	call   2ac8 <_spawn>
+}
+    1f99:	c9                   	leave
+    1f9a:	c3                   	ret
+
+0000000000001f9b <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    1f9b:	55                   	push   %rbp
+    1f9c:	48 89 e5             	mov    %rsp,%rbp
+    1f9f:	48 83 ec 10          	sub    $0x10,%rsp
+    1fa3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    1fa6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1faa:	78 69                	js     2015 <close+0x7a>
+    1fac:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1fb0:	7f 63                	jg     2015 <close+0x7a>
+    1fb2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fb5:	48 98                	cltq
+    1fb7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1fbe:	00 
+    1fbf:	48 8d 05 9a 30 00 00 	lea    0x309a(%rip),%rax        # 5060 <obufs>
+    1fc6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1fca:	48 85 c0             	test   %rax,%rax
+    1fcd:	74 46                	je     2015 <close+0x7a>
+    bflush(fd);
+    1fcf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fd2:	89 c7                	mov    %eax,%edi
+    1fd4:	e8 b4 fc ff ff       	call   1c8d <bflush>
+    free(obufs[fd]);
+    1fd9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fdc:	48 98                	cltq
+    1fde:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1fe5:	00 
+    1fe6:	48 8d 05 73 30 00 00 	lea    0x3073(%rip),%rax        # 5060 <obufs>
+    1fed:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1ff1:	48 89 c7             	mov    %rax,%rdi
+    1ff4:	e8 90 11 00 00       	call   3189 <free>
+    obufs[fd] = 0;
+    1ff9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ffc:	48 98                	cltq
+    1ffe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2005:	00 
+    2006:	48 8d 05 53 30 00 00 	lea    0x3053(%rip),%rax        # 5060 <obufs>
+    200d:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    2014:	00 
+  }
+  return _close(fd);
+    2015:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2018:	89 c7                	mov    %eax,%edi
+    201a:	e8 cd 09 00 00       	call   29ec <_close>
+}
+    201f:	c9                   	leave
+    2020:	c3                   	ret
+
+0000000000002021 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    2021:	55                   	push   %rbp
+    2022:	48 89 e5             	mov    %rsp,%rbp
+    2025:	53                   	push   %rbx
+    2026:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    202a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    202e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2032:	48 8b 36             	mov    (%rsi),%rsi
+    2035:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    2039:	48 29 f7             	sub    %rsi,%rdi
+    203c:	48 89 f9             	mov    %rdi,%rcx
+    203f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2044:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2048:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    204c:	48 89 f0             	mov    %rsi,%rax
+    204f:	ba 00 00 00 00       	mov    $0x0,%edx
+    2054:	48 89 df             	mov    %rbx,%rdi
+    2057:	48 0f af f8          	imul   %rax,%rdi
+    205b:	48 89 d6             	mov    %rdx,%rsi
+    205e:	48 0f af f1          	imul   %rcx,%rsi
+    2062:	48 01 fe             	add    %rdi,%rsi
+    2065:	48 f7 e1             	mul    %rcx
+    2068:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    206c:	48 89 ca             	mov    %rcx,%rdx
+    206f:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    2074:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    2078:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    207c:	c9                   	leave
+    207d:	c3                   	ret
+
+000000000000207e <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    207e:	55                   	push   %rbp
+    207f:	48 89 e5             	mov    %rsp,%rbp
+    2082:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2086:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2089:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    208c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2090:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2093:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2096:	48 89 ce             	mov    %rcx,%rsi
+    2099:	48 89 f7             	mov    %rsi,%rdi
+    209c:	89 d1                	mov    %edx,%ecx
+    209e:	fc                   	cld
+    209f:	f3 aa                	rep stos %al,%es:(%rdi)
+    20a1:	89 ca                	mov    %ecx,%edx
+    20a3:	48 89 fe             	mov    %rdi,%rsi
+    20a6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    20aa:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    20ad:	90                   	nop
+    20ae:	5d                   	pop    %rbp
+    20af:	c3                   	ret
+
+00000000000020b0 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    20b0:	55                   	push   %rbp
+    20b1:	48 89 e5             	mov    %rsp,%rbp
+    20b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20b8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    20c0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    20c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    20c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20cc:	48 89 ce             	mov    %rcx,%rsi
+    20cf:	48 89 f7             	mov    %rsi,%rdi
+    20d2:	48 89 d1             	mov    %rdx,%rcx
+    20d5:	fc                   	cld
+    20d6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    20d9:	48 89 ca             	mov    %rcx,%rdx
+    20dc:	48 89 fe             	mov    %rdi,%rsi
+    20df:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    20e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    20e7:	90                   	nop
+    20e8:	5d                   	pop    %rbp
+    20e9:	c3                   	ret
+
+00000000000020ea <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    20ea:	55                   	push   %rbp
+    20eb:	48 89 e5             	mov    %rsp,%rbp
+    20ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    20f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    20f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    20fa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    20fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2102:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2106:	48 89 cf             	mov    %rcx,%rdi
+    2109:	48 89 d6             	mov    %rdx,%rsi
+    210c:	48 89 c1             	mov    %rax,%rcx
+    210f:	fc                   	cld
+    2110:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    2112:	48 89 c8             	mov    %rcx,%rax
+    2115:	48 89 f2             	mov    %rsi,%rdx
+    2118:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    211c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    2120:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2124:	90                   	nop
+    2125:	5d                   	pop    %rbp
+    2126:	c3                   	ret
+
+0000000000002127 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    2127:	55                   	push   %rbp
+    2128:	48 89 e5             	mov    %rsp,%rbp
+    212b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    212f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2133:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    2137:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    213b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    213f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2143:	48 89 cf             	mov    %rcx,%rdi
+    2146:	48 89 d6             	mov    %rdx,%rsi
+    2149:	48 89 c1             	mov    %rax,%rcx
+    214c:	fc                   	cld
+    214d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    2150:	48 89 c8             	mov    %rcx,%rax
+    2153:	48 89 f2             	mov    %rsi,%rdx
+    2156:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    215a:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    215e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2162:	90                   	nop
+    2163:	5d                   	pop    %rbp
+    2164:	c3                   	ret
+
+0000000000002165 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    2165:	55                   	push   %rbp
+    2166:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    2169:	0f 31                	rdtsc
+    216b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    216e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    2171:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2174:	48 c1 e0 20          	shl    $0x20,%rax
+    2178:	48 89 c2             	mov    %rax,%rdx
+    217b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    217e:	48 09 d0             	or     %rdx,%rax
+}
+    2181:	5d                   	pop    %rbp
+    2182:	c3                   	ret
+
+0000000000002183 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    2183:	55                   	push   %rbp
+    2184:	48 89 e5             	mov    %rsp,%rbp
+    2187:	53                   	push   %rbx
+    2188:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    218b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    218f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    2193:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    2197:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    219b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    219e:	0f a2                	cpuid
+    21a0:	89 de                	mov    %ebx,%esi
+    21a2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    21a5:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    21a8:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    21ab:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    21ae:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    21b3:	74 09                	je     21be <cpuid+0x3b>
+    *eaxp = eax;
+    21b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    21b9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    21bc:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    21be:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    21c3:	74 09                	je     21ce <cpuid+0x4b>
+    *ebxp = ebx;
+    21c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    21c9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    21cc:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    21ce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    21d3:	74 09                	je     21de <cpuid+0x5b>
+    *ecxp = ecx;
+    21d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    21d9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    21dc:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    21de:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    21e3:	74 09                	je     21ee <cpuid+0x6b>
+    *edxp = edx;
+    21e5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    21e9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    21ec:	89 10                	mov    %edx,(%rax)
+}
+    21ee:	90                   	nop
+    21ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    21f3:	c9                   	leave
+    21f4:	c3                   	ret
+
+00000000000021f5 <strcpy>:
+char *strcpy(char *s, char *t) {
+    21f5:	55                   	push   %rbp
+    21f6:	48 89 e5             	mov    %rsp,%rbp
+    21f9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    21fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    2201:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2205:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    2209:	90                   	nop
+    220a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    220e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2212:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    221a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    221e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2222:	0f b6 12             	movzbl (%rdx),%edx
+    2225:	88 10                	mov    %dl,(%rax)
+    2227:	0f b6 00             	movzbl (%rax),%eax
+    222a:	84 c0                	test   %al,%al
+    222c:	75 dc                	jne    220a <strcpy+0x15>
+  return os;
+    222e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2232:	5d                   	pop    %rbp
+    2233:	c3                   	ret
+
+0000000000002234 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2234:	55                   	push   %rbp
+    2235:	48 89 e5             	mov    %rsp,%rbp
+    2238:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    223c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    2240:	eb 0a                	jmp    224c <strcmp+0x18>
+    p++, q++;
+    2242:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2247:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    224c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2250:	0f b6 00             	movzbl (%rax),%eax
+    2253:	84 c0                	test   %al,%al
+    2255:	74 12                	je     2269 <strcmp+0x35>
+    2257:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    225b:	0f b6 10             	movzbl (%rax),%edx
+    225e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2262:	0f b6 00             	movzbl (%rax),%eax
+    2265:	38 c2                	cmp    %al,%dl
+    2267:	74 d9                	je     2242 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2269:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    226d:	0f b6 00             	movzbl (%rax),%eax
+    2270:	0f b6 d0             	movzbl %al,%edx
+    2273:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2277:	0f b6 00             	movzbl (%rax),%eax
+    227a:	0f b6 c0             	movzbl %al,%eax
+    227d:	29 c2                	sub    %eax,%edx
+    227f:	89 d0                	mov    %edx,%eax
+}
+    2281:	5d                   	pop    %rbp
+    2282:	c3                   	ret
+
+0000000000002283 <strlen>:
+uint strlen(char *s) {
+    2283:	55                   	push   %rbp
+    2284:	48 89 e5             	mov    %rsp,%rbp
+    2287:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    228b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2292:	eb 04                	jmp    2298 <strlen+0x15>
+    2294:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2298:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    229b:	48 63 d0             	movslq %eax,%rdx
+    229e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22a2:	48 01 d0             	add    %rdx,%rax
+    22a5:	0f b6 00             	movzbl (%rax),%eax
+    22a8:	84 c0                	test   %al,%al
+    22aa:	75 e8                	jne    2294 <strlen+0x11>
+    ;
+  return n;
+    22ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    22af:	5d                   	pop    %rbp
+    22b0:	c3                   	ret
+
+00000000000022b1 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    22b1:	55                   	push   %rbp
+    22b2:	48 89 e5             	mov    %rsp,%rbp
+    22b5:	53                   	push   %rbx
+    22b6:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    22ba:	8b 05 84 2d 00 00    	mov    0x2d84(%rip),%eax        # 5044 <erms>
+    22c0:	85 c0                	test   %eax,%eax
+    22c2:	79 53                	jns    2317 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    22c4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    22c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    22ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+    22d3:	ba 00 00 00 00       	mov    $0x0,%edx
+    22d8:	48 89 c6             	mov    %rax,%rsi
+    22db:	bf 00 00 00 00       	mov    $0x0,%edi
+    22e0:	e8 9e fe ff ff       	call   2183 <cpuid>
+    ebx = 0;
+    22e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    22ec:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    22ef:	83 f8 06             	cmp    $0x6,%eax
+    22f2:	76 14                	jbe    2308 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    22f4:	b8 07 00 00 00       	mov    $0x7,%eax
+    22f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    22fe:	0f a2                	cpuid
+    2300:	89 d9                	mov    %ebx,%ecx
+    2302:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    2305:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    2308:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    230b:	c1 e8 09             	shr    $0x9,%eax
+    230e:	83 e0 01             	and    $0x1,%eax
+    2311:	89 05 2d 2d 00 00    	mov    %eax,0x2d2d(%rip)        # 5044 <erms>
+  }
+  return erms;
+    2317:	8b 05 27 2d 00 00    	mov    0x2d27(%rip),%eax        # 5044 <erms>
+}
+    231d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2321:	c9                   	leave
+    2322:	c3                   	ret
+
+0000000000002323 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    2323:	55                   	push   %rbp
+    2324:	48 89 e5             	mov    %rsp,%rbp
+    2327:	48 83 ec 10          	sub    $0x10,%rsp
+    232b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    232f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2332:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    2335:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    2339:	76 09                	jbe    2344 <memset+0x21>
+    233b:	e8 71 ff ff ff       	call   22b1 <haserms>
+    2340:	85 c0                	test   %eax,%eax
+    2342:	74 16                	je     235a <memset+0x37>
+    stosb(dst, c, n);
+    2344:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2347:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    234a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    234e:	89 ce                	mov    %ecx,%esi
+    2350:	48 89 c7             	mov    %rax,%rdi
+    2353:	e8 26 fd ff ff       	call   207e <stosb>
+    2358:	eb 58                	jmp    23b2 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    235a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    235d:	c1 e8 03             	shr    $0x3,%eax
+    2360:	89 c6                	mov    %eax,%esi
+    2362:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2365:	48 98                	cltq
+    2367:	0f b6 c0             	movzbl %al,%eax
+    236a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    2371:	01 01 01 
+    2374:	48 0f af c2          	imul   %rdx,%rax
+    2378:	48 89 c1             	mov    %rax,%rcx
+    237b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    237f:	48 89 f2             	mov    %rsi,%rdx
+    2382:	48 89 ce             	mov    %rcx,%rsi
+    2385:	48 89 c7             	mov    %rax,%rdi
+    2388:	e8 23 fd ff ff       	call   20b0 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    238d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2390:	83 e0 07             	and    $0x7,%eax
+    2393:	89 c2                	mov    %eax,%edx
+    2395:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2398:	83 e0 f8             	and    $0xfffffff8,%eax
+    239b:	48 89 c1             	mov    %rax,%rcx
+    239e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23a2:	48 01 c1             	add    %rax,%rcx
+    23a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    23a8:	89 c6                	mov    %eax,%esi
+    23aa:	48 89 cf             	mov    %rcx,%rdi
+    23ad:	e8 cc fc ff ff       	call   207e <stosb>
+  }
+  return dst;
+    23b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    23b6:	c9                   	leave
+    23b7:	c3                   	ret
+
+00000000000023b8 <strchr>:
+
+char *strchr(const char *s, char c) {
+    23b8:	55                   	push   %rbp
+    23b9:	48 89 e5             	mov    %rsp,%rbp
+    23bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    23c0:	89 f0                	mov    %esi,%eax
+    23c2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    23c5:	eb 17                	jmp    23de <strchr+0x26>
+    if (*s == c)
+    23c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23cb:	0f b6 00             	movzbl (%rax),%eax
+    23ce:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    23d1:	75 06                	jne    23d9 <strchr+0x21>
+      return (char *)s;
+    23d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23d7:	eb 15                	jmp    23ee <strchr+0x36>
+  for (; *s; s++)
+    23d9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    23de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23e2:	0f b6 00             	movzbl (%rax),%eax
+    23e5:	84 c0                	test   %al,%al
+    23e7:	75 de                	jne    23c7 <strchr+0xf>
+  return 0;
+    23e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    23ee:	5d                   	pop    %rbp
+    23ef:	c3                   	ret
+
+00000000000023f0 <gets>:
+
+char *gets(char *buf, int max) {
+    23f0:	55                   	push   %rbp
+    23f1:	48 89 e5             	mov    %rsp,%rbp
+    23f4:	48 83 ec 20          	sub    $0x20,%rsp
+    23f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    23fc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    23ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2406:	eb 48                	jmp    2450 <gets+0x60>
+    cc = read(0, &c, 1);
+    2408:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    240c:	ba 01 00 00 00       	mov    $0x1,%edx
+    2411:	48 89 c6             	mov    %rax,%rsi
+    2414:	bf 00 00 00 00       	mov    $0x0,%edi
+    2419:	e8 b8 05 00 00       	call   29d6 <read>
+    241e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    2421:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2425:	7e 36                	jle    245d <gets+0x6d>
+      break;
+    buf[i++] = c;
+    2427:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    242a:	8d 50 01             	lea    0x1(%rax),%edx
+    242d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2430:	48 63 d0             	movslq %eax,%rdx
+    2433:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2437:	48 01 c2             	add    %rax,%rdx
+    243a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    243e:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    2440:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    2444:	3c 0a                	cmp    $0xa,%al
+    2446:	74 16                	je     245e <gets+0x6e>
+    2448:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    244c:	3c 0d                	cmp    $0xd,%al
+    244e:	74 0e                	je     245e <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    2450:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2453:	83 c0 01             	add    $0x1,%eax
+    2456:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    2459:	7f ad                	jg     2408 <gets+0x18>
+    245b:	eb 01                	jmp    245e <gets+0x6e>
+      break;
+    245d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    245e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2461:	48 63 d0             	movslq %eax,%rdx
+    2464:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2468:	48 01 d0             	add    %rdx,%rax
+    246b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    246e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    2472:	c9                   	leave
+    2473:	c3                   	ret
+
+0000000000002474 <stat>:
+
+int stat(char *n, struct stat *st) {
+    2474:	55                   	push   %rbp
+    2475:	48 89 e5             	mov    %rsp,%rbp
+    2478:	48 83 ec 10          	sub    $0x10,%rsp
+    247c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2480:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    2484:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    248c:	48 89 c6             	mov    %rax,%rsi
+    248f:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    2494:	e8 58 07 00 00       	call   2bf1 <fstatat>
+}
+    2499:	c9                   	leave
+    249a:	c3                   	ret
+
+000000000000249b <atoi>:
+
+int atoi(const char *s) {
+    249b:	55                   	push   %rbp
+    249c:	48 89 e5             	mov    %rsp,%rbp
+    249f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    24a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    24aa:	eb 28                	jmp    24d4 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    24ac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    24af:	89 d0                	mov    %edx,%eax
+    24b1:	c1 e0 02             	shl    $0x2,%eax
+    24b4:	01 d0                	add    %edx,%eax
+    24b6:	01 c0                	add    %eax,%eax
+    24b8:	89 c1                	mov    %eax,%ecx
+    24ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24be:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    24c2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    24c6:	0f b6 00             	movzbl (%rax),%eax
+    24c9:	0f be c0             	movsbl %al,%eax
+    24cc:	01 c8                	add    %ecx,%eax
+    24ce:	83 e8 30             	sub    $0x30,%eax
+    24d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    24d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24d8:	0f b6 00             	movzbl (%rax),%eax
+    24db:	3c 2f                	cmp    $0x2f,%al
+    24dd:	7e 0b                	jle    24ea <atoi+0x4f>
+    24df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    24e3:	0f b6 00             	movzbl (%rax),%eax
+    24e6:	3c 39                	cmp    $0x39,%al
+    24e8:	7e c2                	jle    24ac <atoi+0x11>
+  return n;
+    24ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    24ed:	5d                   	pop    %rbp
+    24ee:	c3                   	ret
+
+00000000000024ef <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    24ef:	55                   	push   %rbp
+    24f0:	48 89 e5             	mov    %rsp,%rbp
+    24f3:	48 83 ec 28          	sub    $0x28,%rsp
+    24f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    24fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    24ff:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    2502:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2506:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    250a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    250e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    2512:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2516:	7f 09                	jg     2521 <memmove+0x32>
+    return vdst;
+    2518:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    251c:	e9 29 01 00 00       	jmp    264a <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    2521:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2525:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    2529:	0f 83 87 00 00 00    	jae    25b6 <memmove+0xc7>
+    252f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2532:	48 63 d0             	movslq %eax,%rdx
+    2535:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2539:	48 01 d0             	add    %rdx,%rax
+    253c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2540:	73 74                	jae    25b6 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    2542:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2545:	48 98                	cltq
+    2547:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    254b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    254e:	48 98                	cltq
+    2550:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    2554:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    255c:	48 09 d0             	or     %rdx,%rax
+    255f:	83 e0 07             	and    $0x7,%eax
+    2562:	48 85 c0             	test   %rax,%rax
+    2565:	75 3d                	jne    25a4 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    2567:	eb 1c                	jmp    2585 <memmove+0x96>
+        src -= 8;
+    2569:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    256e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    2573:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2577:	48 8b 10             	mov    (%rax),%rdx
+    257a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    257e:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    2581:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    2585:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    2589:	7f de                	jg     2569 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    258b:	eb 17                	jmp    25a4 <memmove+0xb5>
+      *--dst = *--src;
+    258d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    2592:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    2597:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    259b:	0f b6 10             	movzbl (%rax),%edx
+    259e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25a2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    25a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    25a7:	8d 50 ff             	lea    -0x1(%rax),%edx
+    25aa:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    25ad:	85 c0                	test   %eax,%eax
+    25af:	7f dc                	jg     258d <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    25b1:	e9 90 00 00 00       	jmp    2646 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    25b6:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    25ba:	7e 09                	jle    25c5 <memmove+0xd6>
+    25bc:	e8 f0 fc ff ff       	call   22b1 <haserms>
+    25c1:	85 c0                	test   %eax,%eax
+    25c3:	74 1b                	je     25e0 <memmove+0xf1>
+    movsb(dst, src, n);
+    25c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    25c8:	48 63 d0             	movslq %eax,%rdx
+    25cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    25cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25d3:	48 89 ce             	mov    %rcx,%rsi
+    25d6:	48 89 c7             	mov    %rax,%rdi
+    25d9:	e8 0c fb ff ff       	call   20ea <movsb>
+    25de:	eb 66                	jmp    2646 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    25e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    25e3:	8d 50 07             	lea    0x7(%rax),%edx
+    25e6:	85 c0                	test   %eax,%eax
+    25e8:	0f 48 c2             	cmovs  %edx,%eax
+    25eb:	c1 f8 03             	sar    $0x3,%eax
+    25ee:	48 63 d0             	movslq %eax,%rdx
+    25f1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    25f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    25f9:	48 89 ce             	mov    %rcx,%rsi
+    25fc:	48 89 c7             	mov    %rax,%rdi
+    25ff:	e8 23 fb ff ff       	call   2127 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    2604:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2607:	89 d0                	mov    %edx,%eax
+    2609:	c1 f8 1f             	sar    $0x1f,%eax
+    260c:	c1 e8 1d             	shr    $0x1d,%eax
+    260f:	01 c2                	add    %eax,%edx
+    2611:	83 e2 07             	and    $0x7,%edx
+    2614:	29 c2                	sub    %eax,%edx
+    2616:	89 d0                	mov    %edx,%eax
+    2618:	48 98                	cltq
+    261a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    261d:	83 e2 f8             	and    $0xfffffff8,%edx
+    2620:	48 63 ca             	movslq %edx,%rcx
+    2623:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2627:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    262b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    262e:	83 e2 f8             	and    $0xfffffff8,%edx
+    2631:	48 63 ca             	movslq %edx,%rcx
+    2634:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2638:	48 01 d1             	add    %rdx,%rcx
+    263b:	48 89 c2             	mov    %rax,%rdx
+    263e:	48 89 cf             	mov    %rcx,%rdi
+    2641:	e8 a4 fa ff ff       	call   20ea <movsb>
+  }
+  return vdst;
+    2646:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    264a:	c9                   	leave
+    264b:	c3                   	ret
+
+000000000000264c <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    264c:	55                   	push   %rbp
+    264d:	48 89 e5             	mov    %rsp,%rbp
+    2650:	48 83 ec 20          	sub    $0x20,%rsp
+    2654:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2657:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    265b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    2662:	00 00 00 
+    2665:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    2669:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    266d:	75 0d                	jne    267c <clock_gettime+0x30>
+    266f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2673:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2677:	48 85 c0             	test   %rax,%rax
+    267a:	75 13                	jne    268f <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    267c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2680:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2683:	48 89 d6             	mov    %rdx,%rsi
+    2686:	89 c7                	mov    %eax,%edi
+    2688:	e8 e0 04 00 00       	call   2b6d <_clock_gettime>
+    268d:	eb 7d                	jmp    270c <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    268f:	e8 d1 fa ff ff       	call   2165 <rdtsc>
+    2694:	48 89 c2             	mov    %rax,%rdx
+    2697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    269b:	48 89 d6             	mov    %rdx,%rsi
+    269e:	48 89 c7             	mov    %rax,%rdi
+    26a1:	e8 7b f9 ff ff       	call   2021 <clockns>
+    26a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    26aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26ae:	48 c1 e8 09          	shr    $0x9,%rax
+    26b2:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    26b9:	b8 44 00 
+    26bc:	48 f7 e2             	mul    %rdx
+    26bf:	48 89 d0             	mov    %rdx,%rax
+    26c2:	48 c1 e8 0b          	shr    $0xb,%rax
+    26c6:	48 89 c2             	mov    %rax,%rdx
+    26c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26cd:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    26d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    26d4:	48 89 c8             	mov    %rcx,%rax
+    26d7:	48 c1 e8 09          	shr    $0x9,%rax
+    26db:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    26e2:	b8 44 00 
+    26e5:	48 f7 e2             	mul    %rdx
+    26e8:	48 89 d0             	mov    %rdx,%rax
+    26eb:	48 c1 e8 0b          	shr    $0xb,%rax
+    26ef:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    26f6:	48 89 c8             	mov    %rcx,%rax
+    26f9:	48 29 d0             	sub    %rdx,%rax
+    26fc:	48 89 c2             	mov    %rax,%rdx
+    26ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2703:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    2707:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    270c:	c9                   	leave
+    270d:	c3                   	ret
+
+000000000000270e <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    270e:	55                   	push   %rbp
+    270f:	48 89 e5             	mov    %rsp,%rbp
+    2712:	48 83 ec 10          	sub    $0x10,%rsp
+    2716:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    271a:	eb 11                	jmp    272d <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    271c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2720:	be 02 00 00 00       	mov    $0x2,%esi
+    2725:	48 89 c7             	mov    %rax,%rdi
+    2728:	e8 6c 04 00 00       	call   2b99 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    272d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2731:	b8 02 00 00 00       	mov    $0x2,%eax
+    2736:	87 02                	xchg   %eax,(%rdx)
+    2738:	85 c0                	test   %eax,%eax
+    273a:	75 e0                	jne    271c <mutex_wait+0xe>
+}
+    273c:	90                   	nop
+    273d:	90                   	nop
+    273e:	c9                   	leave
+    273f:	c3                   	ret
+
+0000000000002740 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    2740:	55                   	push   %rbp
+    2741:	48 89 e5             	mov    %rsp,%rbp
+    2744:	48 83 ec 20          	sub    $0x20,%rsp
+    2748:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    274c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    2753:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2757:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    275b:	8b 02                	mov    (%rdx),%eax
+    275d:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2762:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    2766:	89 c1                	mov    %eax,%ecx
+    2768:	0f 94 c0             	sete   %al
+    276b:	84 c0                	test   %al,%al
+    276d:	75 02                	jne    2771 <mutex_lock+0x31>
+    276f:	89 0a                	mov    %ecx,(%rdx)
+    2771:	83 f0 01             	xor    $0x1,%eax
+    2774:	84 c0                	test   %al,%al
+    2776:	74 0c                	je     2784 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    2778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    277c:	48 89 c7             	mov    %rax,%rdi
+    277f:	e8 8a ff ff ff       	call   270e <mutex_wait>
+}
+    2784:	90                   	nop
+    2785:	c9                   	leave
+    2786:	c3                   	ret
+
+0000000000002787 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    2787:	55                   	push   %rbp
+    2788:	48 89 e5             	mov    %rsp,%rbp
+    278b:	48 83 ec 10          	sub    $0x10,%rsp
+    278f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    2793:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2797:	ba 00 00 00 00       	mov    $0x0,%edx
+    279c:	87 10                	xchg   %edx,(%rax)
+    279e:	83 fa 02             	cmp    $0x2,%edx
+    27a1:	75 11                	jne    27b4 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    27a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27a7:	be 01 00 00 00       	mov    $0x1,%esi
+    27ac:	48 89 c7             	mov    %rax,%rdi
+    27af:	e8 f0 03 00 00       	call   2ba4 <futex_wake>
+}
+    27b4:	90                   	nop
+    27b5:	c9                   	leave
+    27b6:	c3                   	ret
+
+00000000000027b7 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    27b7:	55                   	push   %rbp
+    27b8:	48 89 e5             	mov    %rsp,%rbp
+    27bb:	48 83 ec 20          	sub    $0x20,%rsp
+    27bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    27c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    27c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27cb:	48 83 c0 04          	add    $0x4,%rax
+    27cf:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    27d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27d7:	8b 00                	mov    (%rax),%eax
+    27d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    27dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27e0:	48 89 c7             	mov    %rax,%rdi
+    27e3:	e8 9f ff ff ff       	call   2787 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    27e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27ec:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    27ef:	89 d6                	mov    %edx,%esi
+    27f1:	48 89 c7             	mov    %rax,%rdi
+    27f4:	e8 a0 03 00 00       	call   2b99 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    27f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    27fd:	48 83 c0 04          	add    $0x4,%rax
+    2801:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    2805:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2809:	48 89 c7             	mov    %rax,%rdi
+    280c:	e8 fd fe ff ff       	call   270e <mutex_wait>
+}
+    2811:	90                   	nop
+    2812:	c9                   	leave
+    2813:	c3                   	ret
+
+0000000000002814 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    2814:	55                   	push   %rbp
+    2815:	48 89 e5             	mov    %rsp,%rbp
+    2818:	48 83 ec 10          	sub    $0x10,%rsp
+    281c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    2820:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2824:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    2828:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    282c:	48 83 c0 04          	add    $0x4,%rax
+    2830:	8b 00                	mov    (%rax),%eax
+    2832:	85 c0                	test   %eax,%eax
+    2834:	7e 11                	jle    2847 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    2836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    283a:	be 01 00 00 00       	mov    $0x1,%esi
+    283f:	48 89 c7             	mov    %rax,%rdi
+    2842:	e8 5d 03 00 00       	call   2ba4 <futex_wake>
+}
+    2847:	90                   	nop
+    2848:	c9                   	leave
+    2849:	c3                   	ret
+
+000000000000284a <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    284a:	55                   	push   %rbp
+    284b:	48 89 e5             	mov    %rsp,%rbp
+    284e:	48 83 ec 10          	sub    $0x10,%rsp
+    2852:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    2856:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    285a:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    285e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2862:	48 83 c0 04          	add    $0x4,%rax
+    2866:	8b 00                	mov    (%rax),%eax
+    2868:	85 c0                	test   %eax,%eax
+    286a:	7e 11                	jle    287d <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    286c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2870:	be 00 00 00 40       	mov    $0x40000000,%esi
+    2875:	48 89 c7             	mov    %rax,%rdi
+    2878:	e8 27 03 00 00       	call   2ba4 <futex_wake>
+}
+    287d:	90                   	nop
+    287e:	c9                   	leave
+    287f:	c3                   	ret
+
+0000000000002880 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    2880:	55                   	push   %rbp
+    2881:	48 89 e5             	mov    %rsp,%rbp
+    2884:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2888:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    288b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    288f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    2893:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    2897:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    289b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    289f:	8b 40 04             	mov    0x4(%rax),%eax
+    28a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    28a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28a9:	8b 00                	mov    (%rax),%eax
+    28ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    28ae:	29 c2                	sub    %eax,%edx
+    28b0:	83 fa 1f             	cmp    $0x1f,%edx
+    28b3:	76 07                	jbe    28bc <ring_push+0x3c>
+    return -1;
+    28b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    28ba:	eb 7e                	jmp    293a <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    28bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    28bf:	83 e0 1f             	and    $0x1f,%eax
+    28c2:	89 c2                	mov    %eax,%edx
+    28c4:	48 89 d0             	mov    %rdx,%rax
+    28c7:	48 01 c0             	add    %rax,%rax
+    28ca:	48 01 d0             	add    %rdx,%rax
+    28cd:	48 c1 e0 04          	shl    $0x4,%rax
+    28d1:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    28d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28d9:	48 01 d0             	add    %rdx,%rax
+    28dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    28e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28e4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    28e7:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    28e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28ed:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    28f1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    28f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    28f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    28fd:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    2901:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2905:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2909:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    290d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2915:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    2919:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    291d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    2921:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    2925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2928:	8d 50 01             	lea    0x1(%rax),%edx
+    292b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    292f:	48 83 c0 04          	add    $0x4,%rax
+    2933:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2935:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    293a:	5d                   	pop    %rbp
+    293b:	c3                   	ret
+
+000000000000293c <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    293c:	55                   	push   %rbp
+    293d:	48 89 e5             	mov    %rsp,%rbp
+    2940:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2944:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    2948:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    294c:	8b 40 08             	mov    0x8(%rax),%eax
+    294f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    2952:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2956:	48 83 c0 0c          	add    $0xc,%rax
+    295a:	8b 00                	mov    (%rax),%eax
+    295c:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    295f:	75 07                	jne    2968 <ring_pop+0x2c>
+    return -1;
+    2961:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2966:	eb 40                	jmp    29a8 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    2968:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    296b:	83 e0 1f             	and    $0x1f,%eax
+    296e:	89 c2                	mov    %eax,%edx
+    2970:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    2974:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2978:	89 d2                	mov    %edx,%edx
+    297a:	48 83 c2 61          	add    $0x61,%rdx
+    297e:	48 c1 e2 04          	shl    $0x4,%rdx
+    2982:	48 01 d0             	add    %rdx,%rax
+    2985:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2989:	48 8b 00             	mov    (%rax),%rax
+    298c:	48 89 01             	mov    %rax,(%rcx)
+    298f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    2993:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2996:	8d 50 01             	lea    0x1(%rax),%edx
+    2999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    299d:	48 83 c0 08          	add    $0x8,%rax
+    29a1:	89 10                	mov    %edx,(%rax)
+  return 0;
+    29a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    29a8:	5d                   	pop    %rbp
+    29a9:	c3                   	ret
+
+00000000000029aa <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    29aa:	b8 01 00 00 00       	mov    $0x1,%eax
+    29af:	49 89 ca             	mov    %rcx,%r10
+    29b2:	0f 05                	syscall
+    29b4:	c3                   	ret
+
+00000000000029b5 <_exit>:
+SYSCALL_(exit)
+    29b5:	b8 02 00 00 00       	mov    $0x2,%eax
+    29ba:	49 89 ca             	mov    %rcx,%r10
+    29bd:	0f 05                	syscall
+    29bf:	c3                   	ret
+
+00000000000029c0 <wait>:
+SYSCALL(wait)
+    29c0:	b8 03 00 00 00       	mov    $0x3,%eax
+    29c5:	49 89 ca             	mov    %rcx,%r10
+    29c8:	0f 05                	syscall
+    29ca:	c3                   	ret
+
+00000000000029cb <pipe>:
+SYSCALL(pipe)
+    29cb:	b8 04 00 00 00       	mov    $0x4,%eax
+    29d0:	49 89 ca             	mov    %rcx,%r10
+    29d3:	0f 05                	syscall
+    29d5:	c3                   	ret
+
+00000000000029d6 <read>:
+SYSCALL(read)
+    29d6:	b8 05 00 00 00       	mov    $0x5,%eax
+    29db:	49 89 ca             	mov    %rcx,%r10
+    29de:	0f 05                	syscall
+    29e0:	c3                   	ret
+
+00000000000029e1 <write>:
+SYSCALL(write)
+    29e1:	b8 10 00 00 00       	mov    $0x10,%eax
+    29e6:	49 89 ca             	mov    %rcx,%r10
+    29e9:	0f 05                	syscall
+    29eb:	c3                   	ret
+
+00000000000029ec <_close>:
+SYSCALL_(close)
+    29ec:	b8 15 00 00 00       	mov    $0x15,%eax
+    29f1:	49 89 ca             	mov    %rcx,%r10
+    29f4:	0f 05                	syscall
+    29f6:	c3                   	ret
+
+00000000000029f7 <kill>:
+SYSCALL(kill)
+    29f7:	b8 06 00 00 00       	mov    $0x6,%eax
+    29fc:	49 89 ca             	mov    %rcx,%r10
+    29ff:	0f 05                	syscall
+    2a01:	c3                   	ret
+
+0000000000002a02 <_exec>:
+SYSCALL_(exec)
+    2a02:	b8 07 00 00 00       	mov    $0x7,%eax
+    2a07:	49 89 ca             	mov    %rcx,%r10
+    2a0a:	0f 05                	syscall
+    2a0c:	c3                   	ret
+
+0000000000002a0d <open>:
+SYSCALL(open)
+    2a0d:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2a12:	49 89 ca             	mov    %rcx,%r10
+    2a15:	0f 05                	syscall
+    2a17:	c3                   	ret
+
+0000000000002a18 <mknod>:
+SYSCALL(mknod)
+    2a18:	b8 11 00 00 00       	mov    $0x11,%eax
+    2a1d:	49 89 ca             	mov    %rcx,%r10
+    2a20:	0f 05                	syscall
+    2a22:	c3                   	ret
+
+0000000000002a23 <unlink>:
+SYSCALL(unlink)
+    2a23:	b8 12 00 00 00       	mov    $0x12,%eax
+    2a28:	49 89 ca             	mov    %rcx,%r10
+    2a2b:	0f 05                	syscall
+    2a2d:	c3                   	ret
+
+0000000000002a2e <fstat>:
+SYSCALL(fstat)
+    2a2e:	b8 08 00 00 00       	mov    $0x8,%eax
+    2a33:	49 89 ca             	mov    %rcx,%r10
+    2a36:	0f 05                	syscall
+    2a38:	c3                   	ret
+
+0000000000002a39 <link>:
+SYSCALL(link)
+    2a39:	b8 13 00 00 00       	mov    $0x13,%eax
+    2a3e:	49 89 ca             	mov    %rcx,%r10
+    2a41:	0f 05                	syscall
+    2a43:	c3                   	ret
+
+0000000000002a44 <mkdir>:
+SYSCALL(mkdir)
+    2a44:	b8 14 00 00 00       	mov    $0x14,%eax
+    2a49:	49 89 ca             	mov    %rcx,%r10
+    2a4c:	0f 05                	syscall
+    2a4e:	c3                   	ret
+
+0000000000002a4f <chdir>:
+SYSCALL(chdir)
+    2a4f:	b8 09 00 00 00       	mov    $0x9,%eax
+    2a54:	49 89 ca             	mov    %rcx,%r10
+    2a57:	0f 05                	syscall
+    2a59:	c3                   	ret
+
+0000000000002a5a <dup>:
+SYSCALL(dup)
+    2a5a:	b8 0a 00 00 00       	mov    $0xa,%eax
+    2a5f:	49 89 ca             	mov    %rcx,%r10
+    2a62:	0f 05                	syscall
+    2a64:	c3                   	ret
+
+0000000000002a65 <getpid>:
+SYSCALL(getpid)
+    2a65:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2a6a:	49 89 ca             	mov    %rcx,%r10
+    2a6d:	0f 05                	syscall
+    2a6f:	c3                   	ret
+
+0000000000002a70 <sbrk>:
+SYSCALL(sbrk)
+    2a70:	b8 0c 00 00 00       	mov    $0xc,%eax
+    2a75:	49 89 ca             	mov    %rcx,%r10
+    2a78:	0f 05                	syscall
+    2a7a:	c3                   	ret
+
+0000000000002a7b <sleep>:
+SYSCALL(sleep)
+    2a7b:	b8 0d 00 00 00       	mov    $0xd,%eax
+    2a80:	49 89 ca             	mov    %rcx,%r10
+    2a83:	0f 05                	syscall
+    2a85:	c3                   	ret
+
+0000000000002a86 <uptime>:
+SYSCALL(uptime)
+    2a86:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2a8b:	49 89 ca             	mov    %rcx,%r10
+    2a8e:	0f 05                	syscall
+    2a90:	c3                   	ret
+
+0000000000002a91 <sysinfo>:
+SYSCALL(sysinfo)
+    2a91:	b8 16 00 00 00       	mov    $0x16,%eax
+    2a96:	49 89 ca             	mov    %rcx,%r10
+    2a99:	0f 05                	syscall
+    2a9b:	c3                   	ret
+
+0000000000002a9c <crashn>:
+SYSCALL(crashn)
+    2a9c:	b8 17 00 00 00       	mov    $0x17,%eax
+    2aa1:	49 89 ca             	mov    %rcx,%r10
+    2aa4:	0f 05                	syscall
+    2aa6:	c3                   	ret
+
+0000000000002aa7 <mmap>:
+SYSCALL(mmap)
+    2aa7:	b8 18 00 00 00       	mov    $0x18,%eax
+    2aac:	49 89 ca             	mov    %rcx,%r10
+    2aaf:	0f 05                	syscall
+    2ab1:	c3                   	ret
+
+0000000000002ab2 <munmap>:
+SYSCALL(munmap)
+    2ab2:	b8 19 00 00 00       	mov    $0x19,%eax
+    2ab7:	49 89 ca             	mov    %rcx,%r10
+    2aba:	0f 05                	syscall
+    2abc:	c3                   	ret
+
+0000000000002abd <nice>:
+SYSCALL(nice)
+    2abd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    2ac2:	49 89 ca             	mov    %rcx,%r10
+    2ac5:	0f 05                	syscall
+    2ac7:	c3                   	ret
+
+0000000000002ac8 <_spawn>:
+SYSCALL_(spawn)
+    2ac8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    2acd:	49 89 ca             	mov    %rcx,%r10
+    2ad0:	0f 05                	syscall
+    2ad2:	c3                   	ret
+
+0000000000002ad3 <pread>:
+SYSCALL(pread)
+    2ad3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2ad8:	49 89 ca             	mov    %rcx,%r10
+    2adb:	0f 05                	syscall
+    2add:	c3                   	ret
+
+0000000000002ade <pwrite>:
+SYSCALL(pwrite)
+    2ade:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    2ae3:	49 89 ca             	mov    %rcx,%r10
+    2ae6:	0f 05                	syscall
+    2ae8:	c3                   	ret
+
+0000000000002ae9 <readv>:
+SYSCALL(readv)
+    2ae9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    2aee:	49 89 ca             	mov    %rcx,%r10
+    2af1:	0f 05                	syscall
+    2af3:	c3                   	ret
+
+0000000000002af4 <writev>:
+SYSCALL(writev)
+    2af4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2af9:	49 89 ca             	mov    %rcx,%r10
+    2afc:	0f 05                	syscall
+    2afe:	c3                   	ret
+
+0000000000002aff <sendfile>:
+SYSCALL(sendfile)
+    2aff:	b8 20 00 00 00       	mov    $0x20,%eax
+    2b04:	49 89 ca             	mov    %rcx,%r10
+    2b07:	0f 05                	syscall
+    2b09:	c3                   	ret
+
+0000000000002b0a <splice>:
+SYSCALL(splice)
+    2b0a:	b8 21 00 00 00       	mov    $0x21,%eax
+    2b0f:	49 89 ca             	mov    %rcx,%r10
+    2b12:	0f 05                	syscall
+    2b14:	c3                   	ret
+
+0000000000002b15 <poll>:
+SYSCALL(poll)
+    2b15:	b8 22 00 00 00       	mov    $0x22,%eax
+    2b1a:	49 89 ca             	mov    %rcx,%r10
+    2b1d:	0f 05                	syscall
+    2b1f:	c3                   	ret
+
+0000000000002b20 <fsync>:
+SYSCALL(fsync)
+    2b20:	b8 23 00 00 00       	mov    $0x23,%eax
+    2b25:	49 89 ca             	mov    %rcx,%r10
+    2b28:	0f 05                	syscall
+    2b2a:	c3                   	ret
+
+0000000000002b2b <fdatasync>:
+SYSCALL(fdatasync)
+    2b2b:	b8 24 00 00 00       	mov    $0x24,%eax
+    2b30:	49 89 ca             	mov    %rcx,%r10
+    2b33:	0f 05                	syscall
+    2b35:	c3                   	ret
+
+0000000000002b36 <lockstat>:
+SYSCALL(lockstat)
+    2b36:	b8 25 00 00 00       	mov    $0x25,%eax
+    2b3b:	49 89 ca             	mov    %rcx,%r10
+    2b3e:	0f 05                	syscall
+    2b40:	c3                   	ret
+
+0000000000002b41 <syscallstat>:
+SYSCALL(syscallstat)
+    2b41:	b8 26 00 00 00       	mov    $0x26,%eax
+    2b46:	49 89 ca             	mov    %rcx,%r10
+    2b49:	0f 05                	syscall
+    2b4b:	c3                   	ret
+
+0000000000002b4c <trace>:
+SYSCALL(trace)
+    2b4c:	b8 27 00 00 00       	mov    $0x27,%eax
+    2b51:	49 89 ca             	mov    %rcx,%r10
+    2b54:	0f 05                	syscall
+    2b56:	c3                   	ret
+
+0000000000002b57 <profile>:
+SYSCALL(profile)
+    2b57:	b8 28 00 00 00       	mov    $0x28,%eax
+    2b5c:	49 89 ca             	mov    %rcx,%r10
+    2b5f:	0f 05                	syscall
+    2b61:	c3                   	ret
+
+0000000000002b62 <cycles>:
+SYSCALL(cycles)
+    2b62:	b8 29 00 00 00       	mov    $0x29,%eax
+    2b67:	49 89 ca             	mov    %rcx,%r10
+    2b6a:	0f 05                	syscall
+    2b6c:	c3                   	ret
+
+0000000000002b6d <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    2b6d:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    2b72:	49 89 ca             	mov    %rcx,%r10
+    2b75:	0f 05                	syscall
+    2b77:	c3                   	ret
+
+0000000000002b78 <consmode>:
+SYSCALL(consmode)
+    2b78:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    2b7d:	49 89 ca             	mov    %rcx,%r10
+    2b80:	0f 05                	syscall
+    2b82:	c3                   	ret
+
+0000000000002b83 <clone>:
+SYSCALL(clone)
+    2b83:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    2b88:	49 89 ca             	mov    %rcx,%r10
+    2b8b:	0f 05                	syscall
+    2b8d:	c3                   	ret
+
+0000000000002b8e <join>:
+SYSCALL(join)
+    2b8e:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    2b93:	49 89 ca             	mov    %rcx,%r10
+    2b96:	0f 05                	syscall
+    2b98:	c3                   	ret
+
+0000000000002b99 <futex_wait>:
+SYSCALL(futex_wait)
+    2b99:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    2b9e:	49 89 ca             	mov    %rcx,%r10
+    2ba1:	0f 05                	syscall
+    2ba3:	c3                   	ret
+
+0000000000002ba4 <futex_wake>:
+SYSCALL(futex_wake)
+    2ba4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    2ba9:	49 89 ca             	mov    %rcx,%r10
+    2bac:	0f 05                	syscall
+    2bae:	c3                   	ret
+
+0000000000002baf <shmget>:
+SYSCALL(shmget)
+    2baf:	b8 30 00 00 00       	mov    $0x30,%eax
+    2bb4:	49 89 ca             	mov    %rcx,%r10
+    2bb7:	0f 05                	syscall
+    2bb9:	c3                   	ret
+
+0000000000002bba <shmat>:
+SYSCALL(shmat)
+    2bba:	b8 31 00 00 00       	mov    $0x31,%eax
+    2bbf:	49 89 ca             	mov    %rcx,%r10
+    2bc2:	0f 05                	syscall
+    2bc4:	c3                   	ret
+
+0000000000002bc5 <shmdt>:
+SYSCALL(shmdt)
+    2bc5:	b8 32 00 00 00       	mov    $0x32,%eax
+    2bca:	49 89 ca             	mov    %rcx,%r10
+    2bcd:	0f 05                	syscall
+    2bcf:	c3                   	ret
+
+0000000000002bd0 <ring_setup>:
+SYSCALL(ring_setup)
+    2bd0:	b8 33 00 00 00       	mov    $0x33,%eax
+    2bd5:	49 89 ca             	mov    %rcx,%r10
+    2bd8:	0f 05                	syscall
+    2bda:	c3                   	ret
+
+0000000000002bdb <ring_enter>:
+SYSCALL(ring_enter)
+    2bdb:	b8 34 00 00 00       	mov    $0x34,%eax
+    2be0:	49 89 ca             	mov    %rcx,%r10
+    2be3:	0f 05                	syscall
+    2be5:	c3                   	ret
+
+0000000000002be6 <getdents>:
+SYSCALL(getdents)
+    2be6:	b8 35 00 00 00       	mov    $0x35,%eax
+    2beb:	49 89 ca             	mov    %rcx,%r10
+    2bee:	0f 05                	syscall
+    2bf0:	c3                   	ret
+
+0000000000002bf1 <fstatat>:
+SYSCALL(fstatat)
+    2bf1:	b8 36 00 00 00       	mov    $0x36,%eax
+    2bf6:	49 89 ca             	mov    %rcx,%r10
+    2bf9:	0f 05                	syscall
+    2bfb:	c3                   	ret
+
+0000000000002bfc <clone_file>:
+SYSCALL(clone_file)
+    2bfc:	b8 37 00 00 00       	mov    $0x37,%eax
+    2c01:	49 89 ca             	mov    %rcx,%r10
+    2c04:	0f 05                	syscall
+    2c06:	c3                   	ret
+
+0000000000002c07 <fpunch>:
+SYSCALL(fpunch)
+    2c07:	b8 38 00 00 00       	mov    $0x38,%eax
+    2c0c:	49 89 ca             	mov    %rcx,%r10
+    2c0f:	0f 05                	syscall
+    2c11:	c3                   	ret
+
+0000000000002c12 <defrag>:
+SYSCALL(defrag)
+    2c12:	b8 39 00 00 00       	mov    $0x39,%eax
+    2c17:	49 89 ca             	mov    %rcx,%r10
+    2c1a:	0f 05                	syscall
+    2c1c:	c3                   	ret
+
+0000000000002c1d <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    2c1d:	55                   	push   %rbp
+    2c1e:	48 89 e5             	mov    %rsp,%rbp
+    2c21:	48 83 ec 20          	sub    $0x20,%rsp
+    2c25:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    2c29:	bf 00 00 00 00       	mov    $0x0,%edi
+    2c2e:	e8 3d fe ff ff       	call   2a70 <sbrk>
+    2c33:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    2c37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2c3b:	48 f7 d8             	neg    %rax
+    2c3e:	25 ff 0f 00 00       	and    $0xfff,%eax
+    2c43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    2c47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2c4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c4f:	48 01 c2             	add    %rax,%rdx
+    2c52:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    2c57:	48 39 c2             	cmp    %rax,%rdx
+    2c5a:	73 1e                	jae    2c7a <morecore+0x5d>
+    2c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2c60:	89 c2                	mov    %eax,%edx
+    2c62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2c66:	01 d0                	add    %edx,%eax
+    2c68:	89 c7                	mov    %eax,%edi
+    2c6a:	e8 01 fe ff ff       	call   2a70 <sbrk>
+    2c6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2c73:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2c78:	75 07                	jne    2c81 <morecore+0x64>
+    return 0;
+    2c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    2c7f:	eb 27                	jmp    2ca8 <morecore+0x8b>
+  stats.heap += n + pad;
+    2c81:	48 8b 05 08 25 00 00 	mov    0x2508(%rip),%rax        # 5190 <stats+0x50>
+    2c88:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    2c8c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2c90:	48 01 ca             	add    %rcx,%rdx
+    2c93:	48 01 d0             	add    %rdx,%rax
+    2c96:	48 89 05 f3 24 00 00 	mov    %rax,0x24f3(%rip)        # 5190 <stats+0x50>
+  return p + pad;
+    2c9d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2ca1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ca5:	48 01 d0             	add    %rdx,%rax
+}
+    2ca8:	c9                   	leave
+    2ca9:	c3                   	ret
+
+0000000000002caa <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    2caa:	55                   	push   %rbp
+    2cab:	48 89 e5             	mov    %rsp,%rbp
+    2cae:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    2cb2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    2cb6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2cbd:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2cbe:	48 8d 05 5b 24 00 00 	lea    0x245b(%rip),%rax        # 5120 <runs>
+    2cc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2cc9:	eb 1a                	jmp    2ce5 <pagefree+0x3b>
+    prev = *rp;
+    2ccb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ccf:	48 8b 00             	mov    (%rax),%rax
+    2cd2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2cd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cda:	48 8b 00             	mov    (%rax),%rax
+    2cdd:	48 83 c0 08          	add    $0x8,%rax
+    2ce1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2ce5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ce9:	48 8b 00             	mov    (%rax),%rax
+    2cec:	48 85 c0             	test   %rax,%rax
+    2cef:	74 0d                	je     2cfe <pagefree+0x54>
+    2cf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cf5:	48 8b 00             	mov    (%rax),%rax
+    2cf8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2cfc:	72 cd                	jb     2ccb <pagefree+0x21>
+  r = (struct run *)p;
+    2cfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2d02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    2d06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d0a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2d0e:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    2d11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2d15:	48 8b 10             	mov    (%rax),%rdx
+    2d18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d1c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    2d20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d24:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2d28:	48 85 c0             	test   %rax,%rax
+    2d2b:	74 48                	je     2d75 <pagefree+0xcb>
+    2d2d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    2d31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2d35:	48 01 c2             	add    %rax,%rdx
+    2d38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2d40:	48 39 c2             	cmp    %rax,%rdx
+    2d43:	75 30                	jne    2d75 <pagefree+0xcb>
+    r->size += r->next->size;
+    2d45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d49:	48 8b 10             	mov    (%rax),%rdx
+    2d4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d50:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2d54:	48 8b 00             	mov    (%rax),%rax
+    2d57:	48 01 c2             	add    %rax,%rdx
+    2d5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d5e:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    2d61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d65:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2d69:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2d6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d71:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    2d75:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2d7a:	74 46                	je     2dc2 <pagefree+0x118>
+    2d7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d80:	48 8b 10             	mov    (%rax),%rdx
+    2d83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d87:	48 01 d0             	add    %rdx,%rax
+    2d8a:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    2d8e:	75 32                	jne    2dc2 <pagefree+0x118>
+    prev->size += r->size;
+    2d90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d94:	48 8b 10             	mov    (%rax),%rdx
+    2d97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d9b:	48 8b 00             	mov    (%rax),%rax
+    2d9e:	48 01 c2             	add    %rax,%rdx
+    2da1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2da5:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    2da8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2dac:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2db0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2db4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    2db8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2dbc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2dc0:	eb 0c                	jmp    2dce <pagefree+0x124>
+  } else {
+    *rp = r;
+    2dc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2dc6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2dca:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    2dcd:	90                   	nop
+    2dce:	90                   	nop
+    2dcf:	5d                   	pop    %rbp
+    2dd0:	c3                   	ret
+
+0000000000002dd1 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    2dd1:	55                   	push   %rbp
+    2dd2:	48 89 e5             	mov    %rsp,%rbp
+    2dd5:	48 83 ec 40          	sub    $0x40,%rsp
+    2dd9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2ddd:	48 8d 05 3c 23 00 00 	lea    0x233c(%rip),%rax        # 5120 <runs>
+    2de4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2de8:	eb 66                	jmp    2e50 <pagealloc+0x7f>
+    if (r->size == n) {
+    2dea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2dee:	48 8b 00             	mov    (%rax),%rax
+    2df1:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2df5:	75 18                	jne    2e0f <pagealloc+0x3e>
+      *rp = r->next;
+    2df7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2dfb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2dff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e03:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    2e06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e0a:	e9 ca 00 00 00       	jmp    2ed9 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    2e0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e13:	48 8b 00             	mov    (%rax),%rax
+    2e16:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2e1a:	73 28                	jae    2e44 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    2e1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e20:	48 8b 00             	mov    (%rax),%rax
+    2e23:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2e27:	48 89 c2             	mov    %rax,%rdx
+    2e2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e2e:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    2e31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e35:	48 8b 10             	mov    (%rax),%rdx
+    2e38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e3c:	48 01 d0             	add    %rdx,%rax
+    2e3f:	e9 95 00 00 00       	jmp    2ed9 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2e44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2e48:	48 83 c0 08          	add    $0x8,%rax
+    2e4c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2e50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e54:	48 8b 00             	mov    (%rax),%rax
+    2e57:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2e5b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2e60:	75 88                	jne    2dea <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    2e62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2e66:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    2e6a:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    2e71:	00 
+    2e72:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2e76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e7a:	48 39 c2             	cmp    %rax,%rdx
+    2e7d:	48 0f 43 c2          	cmovae %rdx,%rax
+    2e81:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    2e85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2e89:	48 89 c7             	mov    %rax,%rdi
+    2e8c:	e8 8c fd ff ff       	call   2c1d <morecore>
+    2e91:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2e95:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2e9a:	75 07                	jne    2ea3 <pagealloc+0xd2>
+    return 0;
+    2e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ea1:	eb 36                	jmp    2ed9 <pagealloc+0x108>
+  if (m > n)
+    2ea3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2ea7:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2eab:	73 1a                	jae    2ec7 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    2ead:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2eb1:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2eb5:	48 89 c2             	mov    %rax,%rdx
+    2eb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2ebc:	48 89 d6             	mov    %rdx,%rsi
+    2ebf:	48 89 c7             	mov    %rax,%rdi
+    2ec2:	e8 e3 fd ff ff       	call   2caa <pagefree>
+  return p + m - n;
+    2ec7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2ecb:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2ecf:	48 89 c2             	mov    %rax,%rdx
+    2ed2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2ed6:	48 01 d0             	add    %rdx,%rax
+}
+    2ed9:	c9                   	leave
+    2eda:	c3                   	ret
+
+0000000000002edb <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    2edb:	55                   	push   %rbp
+    2edc:	48 89 e5             	mov    %rsp,%rbp
+    2edf:	48 83 ec 30          	sub    $0x30,%rsp
+    2ee3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    2ee6:	bf 00 10 00 00       	mov    $0x1000,%edi
+    2eeb:	e8 e1 fe ff ff       	call   2dd1 <pagealloc>
+    2ef0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2ef4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2ef9:	75 0a                	jne    2f05 <refill+0x2a>
+    return -1;
+    2efb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2f00:	e9 da 00 00 00       	jmp    2fdf <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2f05:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2f0c:	00 
+    2f0d:	e9 ba 00 00 00       	jmp    2fcc <refill+0xf1>
+    b = (struct block *)(p + off);
+    2f12:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2f16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f1a:	48 01 d0             	add    %rdx,%rax
+    2f1d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    2f21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f24:	ba 20 00 00 00       	mov    $0x20,%edx
+    2f29:	89 c1                	mov    %eax,%ecx
+    2f2b:	48 d3 e2             	shl    %cl,%rdx
+    2f2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f32:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    2f35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f38:	48 63 d0             	movslq %eax,%rdx
+    2f3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f3f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    2f43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f46:	48 98                	cltq
+    2f48:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2f4f:	00 
+    2f50:	48 8d 05 89 21 00 00 	lea    0x2189(%rip),%rax        # 50e0 <freelist>
+    2f57:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f5f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    2f63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f66:	48 98                	cltq
+    2f68:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2f6f:	00 
+    2f70:	48 8d 15 69 21 00 00 	lea    0x2169(%rip),%rdx        # 50e0 <freelist>
+    2f77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2f7b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    2f7f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2f82:	48 98                	cltq
+    2f84:	48 83 c0 08          	add    $0x8,%rax
+    2f88:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2f8f:	00 
+    2f90:	48 8d 05 ad 21 00 00 	lea    0x21ad(%rip),%rax        # 5144 <stats+0x4>
+    2f97:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2f9a:	8d 48 01             	lea    0x1(%rax),%ecx
+    2f9d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2fa0:	48 98                	cltq
+    2fa2:	48 83 c0 08          	add    $0x8,%rax
+    2fa6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2fad:	00 
+    2fae:	48 8d 05 8f 21 00 00 	lea    0x218f(%rip),%rax        # 5144 <stats+0x4>
+    2fb5:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2fb8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2fbb:	ba 20 00 00 00       	mov    $0x20,%edx
+    2fc0:	89 c1                	mov    %eax,%ecx
+    2fc2:	48 d3 e2             	shl    %cl,%rdx
+    2fc5:	48 89 d0             	mov    %rdx,%rax
+    2fc8:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    2fcc:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    2fd3:	00 
+    2fd4:	0f 86 38 ff ff ff    	jbe    2f12 <refill+0x37>
+  }
+  return 0;
+    2fda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2fdf:	c9                   	leave
+    2fe0:	c3                   	ret
+
+0000000000002fe1 <malloc>:
+
+void *malloc(uint nbytes) {
+    2fe1:	55                   	push   %rbp
+    2fe2:	48 89 e5             	mov    %rsp,%rbp
+    2fe5:	48 83 ec 30          	sub    $0x30,%rsp
+    2fe9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    2fec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2fef:	48 83 c0 10          	add    $0x10,%rax
+    2ff3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    2ff7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2ffe:	eb 04                	jmp    3004 <malloc+0x23>
+    3000:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    3004:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    3008:	7f 16                	jg     3020 <malloc+0x3f>
+    300a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    300d:	ba 20 00 00 00       	mov    $0x20,%edx
+    3012:	89 c1                	mov    %eax,%ecx
+    3014:	48 d3 e2             	shl    %cl,%rdx
+    3017:	48 89 d0             	mov    %rdx,%rax
+    301a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    301e:	72 e0                	jb     3000 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    3020:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    3024:	75 7d                	jne    30a3 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    3026:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    302a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    3030:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    3036:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    303a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    303e:	48 89 c7             	mov    %rax,%rdi
+    3041:	e8 8b fd ff ff       	call   2dd1 <pagealloc>
+    3046:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    304a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    304f:	75 0a                	jne    305b <malloc+0x7a>
+      return 0;
+    3051:	b8 00 00 00 00       	mov    $0x0,%eax
+    3056:	e9 2c 01 00 00       	jmp    3187 <malloc+0x1a6>
+    h->size = n;
+    305b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    305f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3063:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    3066:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    306a:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    3071:	00 
+    stats.inuse[LARGE]++;
+    3072:	8b 05 e8 20 00 00    	mov    0x20e8(%rip),%eax        # 5160 <stats+0x20>
+    3078:	83 c0 01             	add    $0x1,%eax
+    307b:	89 05 df 20 00 00    	mov    %eax,0x20df(%rip)        # 5160 <stats+0x20>
+    stats.large += n;
+    3081:	48 8b 15 00 21 00 00 	mov    0x2100(%rip),%rdx        # 5188 <stats+0x48>
+    3088:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    308c:	48 01 d0             	add    %rdx,%rax
+    308f:	48 89 05 f2 20 00 00 	mov    %rax,0x20f2(%rip)        # 5188 <stats+0x48>
+    return h + 1;
+    3096:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    309a:	48 83 c0 10          	add    $0x10,%rax
+    309e:	e9 e4 00 00 00       	jmp    3187 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    30a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    30a6:	48 98                	cltq
+    30a8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    30af:	00 
+    30b0:	48 8d 05 29 20 00 00 	lea    0x2029(%rip),%rax        # 50e0 <freelist>
+    30b7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    30bb:	48 85 c0             	test   %rax,%rax
+    30be:	75 18                	jne    30d8 <malloc+0xf7>
+    30c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    30c3:	89 c7                	mov    %eax,%edi
+    30c5:	e8 11 fe ff ff       	call   2edb <refill>
+    30ca:	85 c0                	test   %eax,%eax
+    30cc:	79 0a                	jns    30d8 <malloc+0xf7>
+    return 0;
+    30ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    30d3:	e9 af 00 00 00       	jmp    3187 <malloc+0x1a6>
+  b = freelist[c];
+    30d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    30db:	48 98                	cltq
+    30dd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    30e4:	00 
+    30e5:	48 8d 05 f4 1f 00 00 	lea    0x1ff4(%rip),%rax        # 50e0 <freelist>
+    30ec:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    30f0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    30f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30f8:	48 8b 40 10          	mov    0x10(%rax),%rax
+    30fc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    30ff:	48 63 d2             	movslq %edx,%rdx
+    3102:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3109:	00 
+    310a:	48 8d 15 cf 1f 00 00 	lea    0x1fcf(%rip),%rdx        # 50e0 <freelist>
+    3111:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    3115:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3118:	48 98                	cltq
+    311a:	48 83 c0 08          	add    $0x8,%rax
+    311e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3125:	00 
+    3126:	48 8d 05 17 20 00 00 	lea    0x2017(%rip),%rax        # 5144 <stats+0x4>
+    312d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3130:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3133:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3136:	48 98                	cltq
+    3138:	48 83 c0 08          	add    $0x8,%rax
+    313c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3143:	00 
+    3144:	48 8d 05 f9 1f 00 00 	lea    0x1ff9(%rip),%rax        # 5144 <stats+0x4>
+    314b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    314e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3151:	48 98                	cltq
+    3153:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    315a:	00 
+    315b:	48 8d 05 de 1f 00 00 	lea    0x1fde(%rip),%rax        # 5140 <stats>
+    3162:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3165:	8d 48 01             	lea    0x1(%rax),%ecx
+    3168:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    316b:	48 98                	cltq
+    316d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3174:	00 
+    3175:	48 8d 05 c4 1f 00 00 	lea    0x1fc4(%rip),%rax        # 5140 <stats>
+    317c:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    317f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3183:	48 83 c0 10          	add    $0x10,%rax
+}
+    3187:	c9                   	leave
+    3188:	c3                   	ret
+
+0000000000003189 <free>:
+
+void free(void *ap) {
+    3189:	55                   	push   %rbp
+    318a:	48 89 e5             	mov    %rsp,%rbp
+    318d:	48 83 ec 18          	sub    $0x18,%rsp
+    3191:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    3195:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    319a:	0f 84 03 01 00 00    	je     32a3 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    31a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    31a4:	48 83 e8 10          	sub    $0x10,%rax
+    31a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    31ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    31b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    31b8:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    31bd:	75 42                	jne    3201 <free+0x78>
+    stats.inuse[LARGE]--;
+    31bf:	8b 05 9b 1f 00 00    	mov    0x1f9b(%rip),%eax        # 5160 <stats+0x20>
+    31c5:	83 e8 01             	sub    $0x1,%eax
+    31c8:	89 05 92 1f 00 00    	mov    %eax,0x1f92(%rip)        # 5160 <stats+0x20>
+    stats.large -= b->h.size;
+    31ce:	48 8b 15 b3 1f 00 00 	mov    0x1fb3(%rip),%rdx        # 5188 <stats+0x48>
+    31d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31d9:	48 8b 00             	mov    (%rax),%rax
+    31dc:	48 29 c2             	sub    %rax,%rdx
+    31df:	48 89 15 a2 1f 00 00 	mov    %rdx,0x1fa2(%rip)        # 5188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    31e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31ea:	48 8b 10             	mov    (%rax),%rdx
+    31ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31f1:	48 89 d6             	mov    %rdx,%rsi
+    31f4:	48 89 c7             	mov    %rax,%rdi
+    31f7:	e8 ae fa ff ff       	call   2caa <pagefree>
+    return;
+    31fc:	e9 a3 00 00 00       	jmp    32a4 <free+0x11b>
+  }
+  b->next = freelist[c];
+    3201:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3205:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    320c:	00 
+    320d:	48 8d 05 cc 1e 00 00 	lea    0x1ecc(%rip),%rax        # 50e0 <freelist>
+    3214:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    3218:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    321c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    3220:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3224:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    322b:	00 
+    322c:	48 8d 15 ad 1e 00 00 	lea    0x1ead(%rip),%rdx        # 50e0 <freelist>
+    3233:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3237:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    323b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    323f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3246:	00 
+    3247:	48 8d 05 f2 1e 00 00 	lea    0x1ef2(%rip),%rax        # 5140 <stats>
+    324e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3251:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3254:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3258:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    325f:	00 
+    3260:	48 8d 05 d9 1e 00 00 	lea    0x1ed9(%rip),%rax        # 5140 <stats>
+    3267:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    326a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    326e:	48 83 c0 08          	add    $0x8,%rax
+    3272:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3279:	00 
+    327a:	48 8d 05 c3 1e 00 00 	lea    0x1ec3(%rip),%rax        # 5144 <stats+0x4>
+    3281:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3284:	8d 48 01             	lea    0x1(%rax),%ecx
+    3287:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    328b:	48 83 c0 08          	add    $0x8,%rax
+    328f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3296:	00 
+    3297:	48 8d 05 a6 1e 00 00 	lea    0x1ea6(%rip),%rax        # 5144 <stats+0x4>
+    329e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    32a1:	eb 01                	jmp    32a4 <free+0x11b>
+    return;
+    32a3:	90                   	nop
+}
+    32a4:	c9                   	leave
+    32a5:	c3                   	ret
+
+00000000000032a6 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    32a6:	55                   	push   %rbp
+    32a7:	48 89 e5             	mov    %rsp,%rbp
+    32aa:	48 83 ec 30          	sub    $0x30,%rsp
+    32ae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    32b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    32b4:	48 8d 15 2d 06 00 00 	lea    0x62d(%rip),%rdx        # 38e8 <benchreport+0x51a>
+    32bb:	48 89 d6             	mov    %rdx,%rsi
+    32be:	89 c7                	mov    %eax,%edi
+    32c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    32c5:	e8 37 e6 ff ff       	call   1901 <printf>
+  for (c = 0; c < NCLASS; c++)
+    32ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    32d1:	eb 67                	jmp    333a <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    32d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    32d6:	48 98                	cltq
+    32d8:	48 83 c0 08          	add    $0x8,%rax
+    32dc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    32e3:	00 
+    32e4:	48 8d 05 59 1e 00 00 	lea    0x1e59(%rip),%rax        # 5144 <stats+0x4>
+    32eb:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    32ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    32f1:	48 98                	cltq
+    32f3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    32fa:	00 
+    32fb:	48 8d 05 3e 1e 00 00 	lea    0x1e3e(%rip),%rax        # 5140 <stats>
+    3302:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    3305:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3308:	ba 20 00 00 00       	mov    $0x20,%edx
+    330d:	89 c1                	mov    %eax,%ecx
+    330f:	48 d3 e2             	shl    %cl,%rdx
+    3312:	48 89 d0             	mov    %rdx,%rax
+    3315:	89 c1                	mov    %eax,%ecx
+    3317:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    331a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    331d:	41 89 f9             	mov    %edi,%r9d
+    3320:	41 89 f0             	mov    %esi,%r8d
+    3323:	48 8d 35 d5 05 00 00 	lea    0x5d5(%rip),%rsi        # 38ff <benchreport+0x531>
+    332a:	89 c7                	mov    %eax,%edi
+    332c:	b8 00 00 00 00       	mov    $0x0,%eax
+    3331:	e8 cb e5 ff ff       	call   1901 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3336:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    333a:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    333e:	7e 93                	jle    32d3 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    3340:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3347:	00 
+  for (r = runs; r; r = r->next)
+    3348:	48 8b 05 d1 1d 00 00 	mov    0x1dd1(%rip),%rax        # 5120 <runs>
+    334f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3353:	eb 17                	jmp    336c <mallocstats+0xc6>
+    nfree += r->size;
+    3355:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3359:	48 8b 00             	mov    (%rax),%rax
+    335c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    3360:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3364:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3368:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    336c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    3371:	75 e2                	jne    3355 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    3373:	48 8b 05 16 1e 00 00 	mov    0x1e16(%rip),%rax        # 5190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    337a:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    337c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3380:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3384:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3386:	48 8b 05 fb 1d 00 00 	mov    0x1dfb(%rip),%rax        # 5188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    338d:	89 c1                	mov    %eax,%ecx
+    338f:	8b 15 cb 1d 00 00    	mov    0x1dcb(%rip),%edx        # 5160 <stats+0x20>
+    3395:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3398:	41 89 f9             	mov    %edi,%r9d
+    339b:	41 89 f0             	mov    %esi,%r8d
+    339e:	48 8d 35 6b 05 00 00 	lea    0x56b(%rip),%rsi        # 3910 <benchreport+0x542>
+    33a5:	89 c7                	mov    %eax,%edi
+    33a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    33ac:	e8 50 e5 ff ff       	call   1901 <printf>
+}
+    33b1:	90                   	nop
+    33b2:	c9                   	leave
+    33b3:	c3                   	ret
+
+00000000000033b4 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    33b4:	55                   	push   %rbp
+    33b5:	48 89 e5             	mov    %rsp,%rbp
+    33b8:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    33bc:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    33c0:	48 89 c7             	mov    %rax,%rdi
+    33c3:	e8 9a f7 ff ff       	call   2b62 <cycles>
+  return t;
+    33c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    33cc:	c9                   	leave
+    33cd:	c3                   	ret
+
+00000000000033ce <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    33ce:	55                   	push   %rbp
+    33cf:	48 89 e5             	mov    %rsp,%rbp
+    33d2:	48 83 ec 30          	sub    $0x30,%rsp
+    33d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    33da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    33de:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    33e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    33e5:	0f 8e 24 01 00 00    	jle    350f <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    33eb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    33f2:	e9 98 00 00 00       	jmp    348f <benchreport+0xc1>
+    x = t[i];
+    33f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    33fa:	48 98                	cltq
+    33fc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3403:	00 
+    3404:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3408:	48 01 d0             	add    %rdx,%rax
+    340b:	48 8b 00             	mov    (%rax),%rax
+    340e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3412:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3415:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    3418:	eb 33                	jmp    344d <benchreport+0x7f>
+      t[j] = t[j - 1];
+    341a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    341d:	48 98                	cltq
+    341f:	48 c1 e0 03          	shl    $0x3,%rax
+    3423:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3427:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    342b:	48 01 d0             	add    %rdx,%rax
+    342e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    3431:	48 63 d2             	movslq %edx,%rdx
+    3434:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    343b:	00 
+    343c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    3440:	48 01 ca             	add    %rcx,%rdx
+    3443:	48 8b 00             	mov    (%rax),%rax
+    3446:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    3449:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    344d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    3451:	7e 1d                	jle    3470 <benchreport+0xa2>
+    3453:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3456:	48 98                	cltq
+    3458:	48 c1 e0 03          	shl    $0x3,%rax
+    345c:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    3460:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3464:	48 01 d0             	add    %rdx,%rax
+    3467:	48 8b 00             	mov    (%rax),%rax
+    346a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    346e:	72 aa                	jb     341a <benchreport+0x4c>
+    t[j] = x;
+    3470:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    3473:	48 98                	cltq
+    3475:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    347c:	00 
+    347d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3481:	48 01 c2             	add    %rax,%rdx
+    3484:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3488:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    348b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    348f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3492:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    3495:	0f 8c 5c ff ff ff    	jl     33f7 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    349b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    349e:	48 98                	cltq
+    34a0:	48 c1 e0 03          	shl    $0x3,%rax
+    34a4:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    34a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34ac:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    34af:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    34b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    34b5:	89 c2                	mov    %eax,%edx
+    34b7:	c1 ea 1f             	shr    $0x1f,%edx
+    34ba:	01 d0                	add    %edx,%eax
+    34bc:	d1 f8                	sar    %eax
+    34be:	48 98                	cltq
+    34c0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    34c7:	00 
+    34c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34cc:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    34cf:	48 8b 38             	mov    (%rax),%rdi
+    34d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    34d6:	48 8b 30             	mov    (%rax),%rsi
+    34d9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    34dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34e0:	48 83 ec 08          	sub    $0x8,%rsp
+    34e4:	51                   	push   %rcx
+    34e5:	49 89 f9             	mov    %rdi,%r9
+    34e8:	49 89 f0             	mov    %rsi,%r8
+    34eb:	89 d1                	mov    %edx,%ecx
+    34ed:	48 89 c2             	mov    %rax,%rdx
+    34f0:	48 8d 05 59 04 00 00 	lea    0x459(%rip),%rax        # 3950 <benchreport+0x582>
+    34f7:	48 89 c6             	mov    %rax,%rsi
+    34fa:	bf 01 00 00 00       	mov    $0x1,%edi
+    34ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    3504:	e8 f8 e3 ff ff       	call   1901 <printf>
+    3509:	48 83 c4 10          	add    $0x10,%rsp
+    350d:	eb 01                	jmp    3510 <benchreport+0x142>
+    return;
+    350f:	90                   	nop
+}
+    3510:	c9                   	leave
+    3511:	c3                   	ret
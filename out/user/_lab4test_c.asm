@@ -0,0 +1,3786 @@
+
+out/user/_lab4test_c:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <check_system_consistent>:
+  } while (0)
+
+
+// will return only if
+// system is consistent.
+void check_system_consistent() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd;
+  struct stat st;
+  fd = open(file_name, O_RDONLY);
+       8:	48 8b 05 01 30 00 00 	mov    0x3001(%rip),%rax        # 3010 <file_name>
+       f:	be 00 00 00 00       	mov    $0x0,%esi
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 77 18 00 00       	call   1893 <open>
+      1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+      1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      23:	0f 89 5e 01 00 00    	jns    187 <check_system_consistent+0x187>
+    // File has not been created yet.
+    // Ensure the root directory hasn't changed.
+    fd = open(".", O_RDONLY);
+      29:	be 00 00 00 00       	mov    $0x0,%esi
+      2e:	48 8d 05 6f 23 00 00 	lea    0x236f(%rip),%rax        # 23a4 <benchreport+0x150>
+      35:	48 89 c7             	mov    %rax,%rdi
+      38:	e8 56 18 00 00       	call   1893 <open>
+      3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (fstat(fd, &st) != 0) {
+      40:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+      44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      47:	48 89 d6             	mov    %rdx,%rsi
+      4a:	89 c7                	mov    %eax,%edi
+      4c:	e8 63 18 00 00       	call   18b4 <fstat>
+      51:	85 c0                	test   %eax,%eax
+      53:	74 5c                	je     b1 <check_system_consistent+0xb1>
+      error("New file does not exist: Cannot stat root directoy. Not consistent.");
+      55:	8b 05 a5 2f 00 00    	mov    0x2fa5(%rip),%eax        # 3000 <stdout>
+      5b:	ba 27 00 00 00       	mov    $0x27,%edx
+      60:	48 8d 0d 3f 23 00 00 	lea    0x233f(%rip),%rcx        # 23a6 <benchreport+0x152>
+      67:	48 89 ce             	mov    %rcx,%rsi
+      6a:	89 c7                	mov    %eax,%edi
+      6c:	b8 00 00 00 00       	mov    $0x0,%eax
+      71:	e8 11 07 00 00       	call   787 <printf>
+      76:	8b 05 84 2f 00 00    	mov    0x2f84(%rip),%eax        # 3000 <stdout>
+      7c:	48 8d 15 35 23 00 00 	lea    0x2335(%rip),%rdx        # 23b8 <benchreport+0x164>
+      83:	48 89 d6             	mov    %rdx,%rsi
+      86:	89 c7                	mov    %eax,%edi
+      88:	b8 00 00 00 00       	mov    $0x0,%eax
+      8d:	e8 f5 06 00 00       	call   787 <printf>
+      92:	8b 05 68 2f 00 00    	mov    0x2f68(%rip),%eax        # 3000 <stdout>
+      98:	48 8d 15 5d 23 00 00 	lea    0x235d(%rip),%rdx        # 23fc <benchreport+0x1a8>
+      9f:	48 89 d6             	mov    %rdx,%rsi
+      a2:	89 c7                	mov    %eax,%edi
+      a4:	b8 00 00 00 00       	mov    $0x0,%eax
+      a9:	e8 d9 06 00 00       	call   787 <printf>
+      ae:	90                   	nop
+      af:	eb fd                	jmp    ae <check_system_consistent+0xae>
+    }
+    if (st.size > ROOT_DIR_START_SIZE) {
+      b1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      b4:	8b 15 4a 2f 00 00    	mov    0x2f4a(%rip),%edx        # 3004 <ROOT_DIR_START_SIZE>
+      ba:	39 c2                	cmp    %eax,%edx
+      bc:	73 5c                	jae    11a <check_system_consistent+0x11a>
+      error("Root dir size grew, but data does not exist. Not consistent.");
+      be:	8b 05 3c 2f 00 00    	mov    0x2f3c(%rip),%eax        # 3000 <stdout>
+      c4:	ba 2a 00 00 00       	mov    $0x2a,%edx
+      c9:	48 8d 0d d6 22 00 00 	lea    0x22d6(%rip),%rcx        # 23a6 <benchreport+0x152>
+      d0:	48 89 ce             	mov    %rcx,%rsi
+      d3:	89 c7                	mov    %eax,%edi
+      d5:	b8 00 00 00 00       	mov    $0x0,%eax
+      da:	e8 a8 06 00 00       	call   787 <printf>
+      df:	8b 05 1b 2f 00 00    	mov    0x2f1b(%rip),%eax        # 3000 <stdout>
+      e5:	48 8d 15 14 23 00 00 	lea    0x2314(%rip),%rdx        # 2400 <benchreport+0x1ac>
+      ec:	48 89 d6             	mov    %rdx,%rsi
+      ef:	89 c7                	mov    %eax,%edi
+      f1:	b8 00 00 00 00       	mov    $0x0,%eax
+      f6:	e8 8c 06 00 00       	call   787 <printf>
+      fb:	8b 05 ff 2e 00 00    	mov    0x2eff(%rip),%eax        # 3000 <stdout>
+     101:	48 8d 15 f4 22 00 00 	lea    0x22f4(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     108:	48 89 d6             	mov    %rdx,%rsi
+     10b:	89 c7                	mov    %eax,%edi
+     10d:	b8 00 00 00 00       	mov    $0x0,%eax
+     112:	e8 70 06 00 00       	call   787 <printf>
+     117:	90                   	nop
+     118:	eb fd                	jmp    117 <check_system_consistent+0x117>
+    }
+    if (st.size < ROOT_DIR_START_SIZE) {
+     11a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     11d:	8b 15 e1 2e 00 00    	mov    0x2ee1(%rip),%edx        # 3004 <ROOT_DIR_START_SIZE>
+     123:	39 d0                	cmp    %edx,%eax
+     125:	0f 83 4a 02 00 00    	jae    375 <check_system_consistent+0x375>
+      error("Root size shrunk, uh oh. Not consistent.");
+     12b:	8b 05 cf 2e 00 00    	mov    0x2ecf(%rip),%eax        # 3000 <stdout>
+     131:	ba 2d 00 00 00       	mov    $0x2d,%edx
+     136:	48 8d 0d 69 22 00 00 	lea    0x2269(%rip),%rcx        # 23a6 <benchreport+0x152>
+     13d:	48 89 ce             	mov    %rcx,%rsi
+     140:	89 c7                	mov    %eax,%edi
+     142:	b8 00 00 00 00       	mov    $0x0,%eax
+     147:	e8 3b 06 00 00       	call   787 <printf>
+     14c:	8b 05 ae 2e 00 00    	mov    0x2eae(%rip),%eax        # 3000 <stdout>
+     152:	48 8d 15 e7 22 00 00 	lea    0x22e7(%rip),%rdx        # 2440 <benchreport+0x1ec>
+     159:	48 89 d6             	mov    %rdx,%rsi
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	b8 00 00 00 00       	mov    $0x0,%eax
+     163:	e8 1f 06 00 00       	call   787 <printf>
+     168:	8b 05 92 2e 00 00    	mov    0x2e92(%rip),%eax        # 3000 <stdout>
+     16e:	48 8d 15 87 22 00 00 	lea    0x2287(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     175:	48 89 d6             	mov    %rdx,%rsi
+     178:	89 c7                	mov    %eax,%edi
+     17a:	b8 00 00 00 00       	mov    $0x0,%eax
+     17f:	e8 03 06 00 00       	call   787 <printf>
+     184:	90                   	nop
+     185:	eb fd                	jmp    184 <check_system_consistent+0x184>
+    }
+  } else {
+    // File does exist.
+    if (fstat(fd, &st) != 0) {
+     187:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+     18b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     18e:	48 89 d6             	mov    %rdx,%rsi
+     191:	89 c7                	mov    %eax,%edi
+     193:	e8 1c 17 00 00       	call   18b4 <fstat>
+     198:	85 c0                	test   %eax,%eax
+     19a:	74 5c                	je     1f8 <check_system_consistent+0x1f8>
+      error("Cannot stat new file. Not consistent.");
+     19c:	8b 05 5e 2e 00 00    	mov    0x2e5e(%rip),%eax        # 3000 <stdout>
+     1a2:	ba 32 00 00 00       	mov    $0x32,%edx
+     1a7:	48 8d 0d f8 21 00 00 	lea    0x21f8(%rip),%rcx        # 23a6 <benchreport+0x152>
+     1ae:	48 89 ce             	mov    %rcx,%rsi
+     1b1:	89 c7                	mov    %eax,%edi
+     1b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b8:	e8 ca 05 00 00       	call   787 <printf>
+     1bd:	8b 05 3d 2e 00 00    	mov    0x2e3d(%rip),%eax        # 3000 <stdout>
+     1c3:	48 8d 15 a6 22 00 00 	lea    0x22a6(%rip),%rdx        # 2470 <benchreport+0x21c>
+     1ca:	48 89 d6             	mov    %rdx,%rsi
+     1cd:	89 c7                	mov    %eax,%edi
+     1cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d4:	e8 ae 05 00 00       	call   787 <printf>
+     1d9:	8b 05 21 2e 00 00    	mov    0x2e21(%rip),%eax        # 3000 <stdout>
+     1df:	48 8d 15 16 22 00 00 	lea    0x2216(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     1e6:	48 89 d6             	mov    %rdx,%rsi
+     1e9:	89 c7                	mov    %eax,%edi
+     1eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f0:	e8 92 05 00 00       	call   787 <printf>
+     1f5:	90                   	nop
+     1f6:	eb fd                	jmp    1f5 <check_system_consistent+0x1f5>
+    }
+    // Ensure that the inode wasn't already allocated in the inodefile.
+    // Note: This will error when the inodefile is updated, but the root inode wasn't.
+    if (st.ino != INUM_START + 1) {
+     1f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1fb:	8b 15 0b 2e 00 00    	mov    0x2e0b(%rip),%edx        # 300c <INUM_START>
+     201:	83 c2 01             	add    $0x1,%edx
+     204:	39 d0                	cmp    %edx,%eax
+     206:	74 65                	je     26d <check_system_consistent+0x26d>
+      error("New file inum is invalid, inum=%d, inum_expected=%d. Not consistent.", st.ino, INUM_START + 1);
+     208:	8b 05 f2 2d 00 00    	mov    0x2df2(%rip),%eax        # 3000 <stdout>
+     20e:	ba 37 00 00 00       	mov    $0x37,%edx
+     213:	48 8d 0d 8c 21 00 00 	lea    0x218c(%rip),%rcx        # 23a6 <benchreport+0x152>
+     21a:	48 89 ce             	mov    %rcx,%rsi
+     21d:	89 c7                	mov    %eax,%edi
+     21f:	b8 00 00 00 00       	mov    $0x0,%eax
+     224:	e8 5e 05 00 00       	call   787 <printf>
+     229:	8b 05 dd 2d 00 00    	mov    0x2ddd(%rip),%eax        # 300c <INUM_START>
+     22f:	8d 48 01             	lea    0x1(%rax),%ecx
+     232:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     235:	8b 05 c5 2d 00 00    	mov    0x2dc5(%rip),%eax        # 3000 <stdout>
+     23b:	48 8d 35 56 22 00 00 	lea    0x2256(%rip),%rsi        # 2498 <benchreport+0x244>
+     242:	89 c7                	mov    %eax,%edi
+     244:	b8 00 00 00 00       	mov    $0x0,%eax
+     249:	e8 39 05 00 00       	call   787 <printf>
+     24e:	8b 05 ac 2d 00 00    	mov    0x2dac(%rip),%eax        # 3000 <stdout>
+     254:	48 8d 15 a1 21 00 00 	lea    0x21a1(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     25b:	48 89 d6             	mov    %rdx,%rsi
+     25e:	89 c7                	mov    %eax,%edi
+     260:	b8 00 00 00 00       	mov    $0x0,%eax
+     265:	e8 1d 05 00 00       	call   787 <printf>
+     26a:	90                   	nop
+     26b:	eb fd                	jmp    26a <check_system_consistent+0x26a>
+    }
+    // Ensure that the root directory grew by 1 dirent.
+    fd = open(".", O_RDONLY);
+     26d:	be 00 00 00 00       	mov    $0x0,%esi
+     272:	48 8d 05 2b 21 00 00 	lea    0x212b(%rip),%rax        # 23a4 <benchreport+0x150>
+     279:	48 89 c7             	mov    %rax,%rdi
+     27c:	e8 12 16 00 00       	call   1893 <open>
+     281:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (fstat(fd, &st) != 0) {
+     284:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+     288:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     28b:	48 89 d6             	mov    %rdx,%rsi
+     28e:	89 c7                	mov    %eax,%edi
+     290:	e8 1f 16 00 00       	call   18b4 <fstat>
+     295:	85 c0                	test   %eax,%eax
+     297:	74 5c                	je     2f5 <check_system_consistent+0x2f5>
+      error("Cannot stat root directoy. Not consistent.");
+     299:	8b 05 61 2d 00 00    	mov    0x2d61(%rip),%eax        # 3000 <stdout>
+     29f:	ba 3c 00 00 00       	mov    $0x3c,%edx
+     2a4:	48 8d 0d fb 20 00 00 	lea    0x20fb(%rip),%rcx        # 23a6 <benchreport+0x152>
+     2ab:	48 89 ce             	mov    %rcx,%rsi
+     2ae:	89 c7                	mov    %eax,%edi
+     2b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b5:	e8 cd 04 00 00       	call   787 <printf>
+     2ba:	8b 05 40 2d 00 00    	mov    0x2d40(%rip),%eax        # 3000 <stdout>
+     2c0:	48 8d 15 19 22 00 00 	lea    0x2219(%rip),%rdx        # 24e0 <benchreport+0x28c>
+     2c7:	48 89 d6             	mov    %rdx,%rsi
+     2ca:	89 c7                	mov    %eax,%edi
+     2cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d1:	e8 b1 04 00 00       	call   787 <printf>
+     2d6:	8b 05 24 2d 00 00    	mov    0x2d24(%rip),%eax        # 3000 <stdout>
+     2dc:	48 8d 15 19 21 00 00 	lea    0x2119(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     2e3:	48 89 d6             	mov    %rdx,%rsi
+     2e6:	89 c7                	mov    %eax,%edi
+     2e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ed:	e8 95 04 00 00       	call   787 <printf>
+     2f2:	90                   	nop
+     2f3:	eb fd                	jmp    2f2 <check_system_consistent+0x2f2>
+    }
+    if (st.size != ROOT_DIR_START_SIZE + DIRENT_SIZE) {
+     2f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2f8:	8b 0d 06 2d 00 00    	mov    0x2d06(%rip),%ecx        # 3004 <ROOT_DIR_START_SIZE>
+     2fe:	8b 15 04 2d 00 00    	mov    0x2d04(%rip),%edx        # 3008 <DIRENT_SIZE>
+     304:	01 ca                	add    %ecx,%edx
+     306:	39 d0                	cmp    %edx,%eax
+     308:	74 6b                	je     375 <check_system_consistent+0x375>
+      error("File exists but root directory size is incorrect, size=%d, size_expected=%d. Not consistent.", st.size, ROOT_DIR_START_SIZE + DIRENT_SIZE);
+     30a:	8b 05 f0 2c 00 00    	mov    0x2cf0(%rip),%eax        # 3000 <stdout>
+     310:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     315:	48 8d 0d 8a 20 00 00 	lea    0x208a(%rip),%rcx        # 23a6 <benchreport+0x152>
+     31c:	48 89 ce             	mov    %rcx,%rsi
+     31f:	89 c7                	mov    %eax,%edi
+     321:	b8 00 00 00 00       	mov    $0x0,%eax
+     326:	e8 5c 04 00 00       	call   787 <printf>
+     32b:	8b 15 d3 2c 00 00    	mov    0x2cd3(%rip),%edx        # 3004 <ROOT_DIR_START_SIZE>
+     331:	8b 05 d1 2c 00 00    	mov    0x2cd1(%rip),%eax        # 3008 <DIRENT_SIZE>
+     337:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+     33a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     33d:	8b 05 bd 2c 00 00    	mov    0x2cbd(%rip),%eax        # 3000 <stdout>
+     343:	48 8d 35 c6 21 00 00 	lea    0x21c6(%rip),%rsi        # 2510 <benchreport+0x2bc>
+     34a:	89 c7                	mov    %eax,%edi
+     34c:	b8 00 00 00 00       	mov    $0x0,%eax
+     351:	e8 31 04 00 00       	call   787 <printf>
+     356:	8b 05 a4 2c 00 00    	mov    0x2ca4(%rip),%eax        # 3000 <stdout>
+     35c:	48 8d 15 99 20 00 00 	lea    0x2099(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     363:	48 89 d6             	mov    %rdx,%rsi
+     366:	89 c7                	mov    %eax,%edi
+     368:	b8 00 00 00 00       	mov    $0x0,%eax
+     36d:	e8 15 04 00 00       	call   787 <printf>
+     372:	90                   	nop
+     373:	eb fd                	jmp    372 <check_system_consistent+0x372>
+    }
+  }
+}
+     375:	90                   	nop
+     376:	c9                   	leave
+     377:	c3                   	ret
+
+0000000000000378 <check_before_file_creation>:
+
+void check_before_file_creation() {
+     378:	55                   	push   %rbp
+     379:	48 89 e5             	mov    %rsp,%rbp
+     37c:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+  fd = open(file_name, O_RDONLY);
+     380:	48 8b 05 89 2c 00 00 	mov    0x2c89(%rip),%rax        # 3010 <file_name>
+     387:	be 00 00 00 00       	mov    $0x0,%esi
+     38c:	48 89 c7             	mov    %rax,%rdi
+     38f:	e8 ff 14 00 00       	call   1893 <open>
+     394:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+     397:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     39b:	79 1e                	jns    3bb <check_before_file_creation+0x43>
+    printf(stdout, "File does not exist yet.\n");
+     39d:	8b 05 5d 2c 00 00    	mov    0x2c5d(%rip),%eax        # 3000 <stdout>
+     3a3:	48 8d 15 c3 21 00 00 	lea    0x21c3(%rip),%rdx        # 256d <benchreport+0x319>
+     3aa:	48 89 d6             	mov    %rdx,%rsi
+     3ad:	89 c7                	mov    %eax,%edi
+     3af:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b4:	e8 ce 03 00 00       	call   787 <printf>
+    return;
+     3b9:	eb 63                	jmp    41e <check_before_file_creation+0xa6>
+  }
+  printf(stdout, "File does exist before creation. Checking consistency.\n");
+     3bb:	8b 05 3f 2c 00 00    	mov    0x2c3f(%rip),%eax        # 3000 <stdout>
+     3c1:	48 8d 15 c0 21 00 00 	lea    0x21c0(%rip),%rdx        # 2588 <benchreport+0x334>
+     3c8:	48 89 d6             	mov    %rdx,%rsi
+     3cb:	89 c7                	mov    %eax,%edi
+     3cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     3d2:	e8 b0 03 00 00       	call   787 <printf>
+  // File has been created.
+  check_system_consistent();
+     3d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3dc:	e8 1f fc ff ff       	call   0 <check_system_consistent>
+  printf(stdout, "File has been created and system is good!\n");
+     3e1:	8b 05 19 2c 00 00    	mov    0x2c19(%rip),%eax        # 3000 <stdout>
+     3e7:	48 8d 15 d2 21 00 00 	lea    0x21d2(%rip),%rdx        # 25c0 <benchreport+0x36c>
+     3ee:	48 89 d6             	mov    %rdx,%rsi
+     3f1:	89 c7                	mov    %eax,%edi
+     3f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f8:	e8 8a 03 00 00       	call   787 <printf>
+  printf(stdout, "lab4test_c passed!\n");
+     3fd:	8b 05 fd 2b 00 00    	mov    0x2bfd(%rip),%eax        # 3000 <stdout>
+     403:	48 8d 15 e1 21 00 00 	lea    0x21e1(%rip),%rdx        # 25eb <benchreport+0x397>
+     40a:	48 89 d6             	mov    %rdx,%rsi
+     40d:	89 c7                	mov    %eax,%edi
+     40f:	b8 00 00 00 00       	mov    $0x0,%eax
+     414:	e8 6e 03 00 00       	call   787 <printf>
+  exit();
+     419:	e8 99 09 00 00       	call   db7 <exit>
+}
+     41e:	c9                   	leave
+     41f:	c3                   	ret
+
+0000000000000420 <check_after_file_creation>:
+
+void check_after_file_creation() {
+     420:	55                   	push   %rbp
+     421:	48 89 e5             	mov    %rsp,%rbp
+     424:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+  fd = open(file_name, O_RDONLY);
+     428:	48 8b 05 e1 2b 00 00 	mov    0x2be1(%rip),%rax        # 3010 <file_name>
+     42f:	be 00 00 00 00       	mov    $0x0,%esi
+     434:	48 89 c7             	mov    %rax,%rdi
+     437:	e8 57 14 00 00       	call   1893 <open>
+     43c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+     43f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     443:	79 5c                	jns    4a1 <check_after_file_creation+0x81>
+    // File does not exist yet.
+    error("File was not created. Not consistent.");
+     445:	8b 05 b5 2b 00 00    	mov    0x2bb5(%rip),%eax        # 3000 <stdout>
+     44b:	ba 58 00 00 00       	mov    $0x58,%edx
+     450:	48 8d 0d 4f 1f 00 00 	lea    0x1f4f(%rip),%rcx        # 23a6 <benchreport+0x152>
+     457:	48 89 ce             	mov    %rcx,%rsi
+     45a:	89 c7                	mov    %eax,%edi
+     45c:	b8 00 00 00 00       	mov    $0x0,%eax
+     461:	e8 21 03 00 00       	call   787 <printf>
+     466:	8b 05 94 2b 00 00    	mov    0x2b94(%rip),%eax        # 3000 <stdout>
+     46c:	48 8d 15 8d 21 00 00 	lea    0x218d(%rip),%rdx        # 2600 <benchreport+0x3ac>
+     473:	48 89 d6             	mov    %rdx,%rsi
+     476:	89 c7                	mov    %eax,%edi
+     478:	b8 00 00 00 00       	mov    $0x0,%eax
+     47d:	e8 05 03 00 00       	call   787 <printf>
+     482:	8b 05 78 2b 00 00    	mov    0x2b78(%rip),%eax        # 3000 <stdout>
+     488:	48 8d 15 6d 1f 00 00 	lea    0x1f6d(%rip),%rdx        # 23fc <benchreport+0x1a8>
+     48f:	48 89 d6             	mov    %rdx,%rsi
+     492:	89 c7                	mov    %eax,%edi
+     494:	b8 00 00 00 00       	mov    $0x0,%eax
+     499:	e8 e9 02 00 00       	call   787 <printf>
+     49e:	90                   	nop
+     49f:	eb fd                	jmp    49e <check_after_file_creation+0x7e>
+  }
+  // File has been created.
+  check_system_consistent();
+     4a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     4a6:	e8 55 fb ff ff       	call   0 <check_system_consistent>
+  printf(stdout, "File has been created and system is good!\n");
+     4ab:	8b 05 4f 2b 00 00    	mov    0x2b4f(%rip),%eax        # 3000 <stdout>
+     4b1:	48 8d 15 08 21 00 00 	lea    0x2108(%rip),%rdx        # 25c0 <benchreport+0x36c>
+     4b8:	48 89 d6             	mov    %rdx,%rsi
+     4bb:	89 c7                	mov    %eax,%edi
+     4bd:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c2:	e8 c0 02 00 00       	call   787 <printf>
+}
+     4c7:	90                   	nop
+     4c8:	c9                   	leave
+     4c9:	c3                   	ret
+
+00000000000004ca <create_file>:
+
+// Tries to create a file.
+// Will crash afters steps bwrite calls if (steps != 0).
+void create_file(int steps) {
+     4ca:	55                   	push   %rbp
+     4cb:	48 89 e5             	mov    %rsp,%rbp
+     4ce:	48 83 ec 20          	sub    $0x20,%rsp
+     4d2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int fd;
+  if (steps)
+     4d5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     4d9:	74 0a                	je     4e5 <create_file+0x1b>
+    crashn(steps);
+     4db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     4de:	89 c7                	mov    %eax,%edi
+     4e0:	e8 3d 14 00 00       	call   1922 <crashn>
+  fd = open(file_name, O_CREATE | O_RDWR);
+     4e5:	48 8b 05 24 2b 00 00 	mov    0x2b24(%rip),%rax        # 3010 <file_name>
+     4ec:	be 02 02 00 00       	mov    $0x202,%esi
+     4f1:	48 89 c7             	mov    %rax,%rdi
+     4f4:	e8 9a 13 00 00       	call   1893 <open>
+     4f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd) {
+     4fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     500:	74 19                	je     51b <create_file+0x51>
+    printf(1, "File created successfully\n");
+     502:	48 8d 05 1d 21 00 00 	lea    0x211d(%rip),%rax        # 2626 <benchreport+0x3d2>
+     509:	48 89 c6             	mov    %rax,%rsi
+     50c:	bf 01 00 00 00       	mov    $0x1,%edi
+     511:	b8 00 00 00 00       	mov    $0x0,%eax
+     516:	e8 6c 02 00 00       	call   787 <printf>
+  }
+}
+     51b:	90                   	nop
+     51c:	c9                   	leave
+     51d:	c3                   	ret
+
+000000000000051e <main>:
+
+int main(int argc, char *argv[]) {
+     51e:	55                   	push   %rbp
+     51f:	48 89 e5             	mov    %rsp,%rbp
+     522:	48 83 ec 20          	sub    $0x20,%rsp
+     526:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     529:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int steps = 0;
+     52d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  printf(stdout, "lab4test_c starting\n");
+     534:	8b 05 c6 2a 00 00    	mov    0x2ac6(%rip),%eax        # 3000 <stdout>
+     53a:	48 8d 15 00 21 00 00 	lea    0x2100(%rip),%rdx        # 2641 <benchreport+0x3ed>
+     541:	48 89 d6             	mov    %rdx,%rsi
+     544:	89 c7                	mov    %eax,%edi
+     546:	b8 00 00 00 00       	mov    $0x0,%eax
+     54b:	e8 37 02 00 00       	call   787 <printf>
+  if (argc > 1) {
+     550:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     554:	7e 34                	jle    58a <main+0x6c>
+    steps = atoi(argv[1]);
+     556:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     55a:	48 83 c0 08          	add    $0x8,%rax
+     55e:	48 8b 00             	mov    (%rax),%rax
+     561:	48 89 c7             	mov    %rax,%rdi
+     564:	e8 b8 0d 00 00       	call   1321 <atoi>
+     569:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    printf(1, "crashing after %d bwrites\n", steps);
+     56c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     56f:	89 c2                	mov    %eax,%edx
+     571:	48 8d 05 de 20 00 00 	lea    0x20de(%rip),%rax        # 2656 <benchreport+0x402>
+     578:	48 89 c6             	mov    %rax,%rsi
+     57b:	bf 01 00 00 00       	mov    $0x1,%edi
+     580:	b8 00 00 00 00       	mov    $0x0,%eax
+     585:	e8 fd 01 00 00       	call   787 <printf>
+  }
+  check_before_file_creation();
+     58a:	b8 00 00 00 00       	mov    $0x0,%eax
+     58f:	e8 e4 fd ff ff       	call   378 <check_before_file_creation>
+  create_file(steps);
+     594:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     597:	89 c7                	mov    %eax,%edi
+     599:	e8 2c ff ff ff       	call   4ca <create_file>
+  check_after_file_creation();
+     59e:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a3:	e8 78 fe ff ff       	call   420 <check_after_file_creation>
+  printf(stdout, "lab4test_c passed!\n");
+     5a8:	8b 05 52 2a 00 00    	mov    0x2a52(%rip),%eax        # 3000 <stdout>
+     5ae:	48 8d 15 36 20 00 00 	lea    0x2036(%rip),%rdx        # 25eb <benchreport+0x397>
+     5b5:	48 89 d6             	mov    %rdx,%rsi
+     5b8:	89 c7                	mov    %eax,%edi
+     5ba:	b8 00 00 00 00       	mov    $0x0,%eax
+     5bf:	e8 c3 01 00 00       	call   787 <printf>
+  exit();
+     5c4:	e8 ee 07 00 00       	call   db7 <exit>
+
+00000000000005c9 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     5c9:	55                   	push   %rbp
+     5ca:	48 89 e5             	mov    %rsp,%rbp
+     5cd:	48 83 ec 10          	sub    $0x10,%rsp
+     5d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     5d4:	89 f0                	mov    %esi,%eax
+     5d6:	88 45 f8             	mov    %al,-0x8(%rbp)
+     5d9:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     5dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5e0:	89 d6                	mov    %edx,%esi
+     5e2:	89 c7                	mov    %eax,%edi
+     5e4:	e8 eb 06 00 00       	call   cd4 <bputc>
+     5e9:	90                   	nop
+     5ea:	c9                   	leave
+     5eb:	c3                   	ret
+
+00000000000005ec <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     5ec:	55                   	push   %rbp
+     5ed:	48 89 e5             	mov    %rsp,%rbp
+     5f0:	48 83 ec 50          	sub    $0x50,%rsp
+     5f4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     5f7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     5fb:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     5fe:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     601:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     605:	74 21                	je     628 <printint64+0x3c>
+     607:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     60b:	48 c1 e8 3f          	shr    $0x3f,%rax
+     60f:	0f b6 c0             	movzbl %al,%eax
+     612:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     615:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     619:	74 0d                	je     628 <printint64+0x3c>
+    x = -xx;
+     61b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     61f:	48 f7 d8             	neg    %rax
+     622:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     626:	eb 08                	jmp    630 <printint64+0x44>
+  else
+    x = xx;
+     628:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     62c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     630:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     637:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     63a:	48 63 c8             	movslq %eax,%rcx
+     63d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     641:	ba 00 00 00 00       	mov    $0x0,%edx
+     646:	48 f7 f1             	div    %rcx
+     649:	48 89 d1             	mov    %rdx,%rcx
+     64c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     64f:	8d 50 01             	lea    0x1(%rax),%edx
+     652:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     655:	48 8d 15 c4 29 00 00 	lea    0x29c4(%rip),%rdx        # 3020 <digits.1>
+     65c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     660:	48 98                	cltq
+     662:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     666:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     669:	48 63 f0             	movslq %eax,%rsi
+     66c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     670:	ba 00 00 00 00       	mov    $0x0,%edx
+     675:	48 f7 f6             	div    %rsi
+     678:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     67c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     681:	75 b4                	jne    637 <printint64+0x4b>
+
+  if (sgn)
+     683:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     687:	74 2b                	je     6b4 <printint64+0xc8>
+    buf[i++] = '-';
+     689:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     68c:	8d 50 01             	lea    0x1(%rax),%edx
+     68f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     692:	48 98                	cltq
+     694:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     699:	eb 19                	jmp    6b4 <printint64+0xc8>
+    putc(fd, buf[i]);
+     69b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     69e:	48 98                	cltq
+     6a0:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     6a5:	0f be d0             	movsbl %al,%edx
+     6a8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     6ab:	89 d6                	mov    %edx,%esi
+     6ad:	89 c7                	mov    %eax,%edi
+     6af:	e8 15 ff ff ff       	call   5c9 <putc>
+  while (--i >= 0)
+     6b4:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     6b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     6bc:	79 dd                	jns    69b <printint64+0xaf>
+}
+     6be:	90                   	nop
+     6bf:	90                   	nop
+     6c0:	c9                   	leave
+     6c1:	c3                   	ret
+
+00000000000006c2 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     6c2:	55                   	push   %rbp
+     6c3:	48 89 e5             	mov    %rsp,%rbp
+     6c6:	48 83 ec 30          	sub    $0x30,%rsp
+     6ca:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     6cd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     6d0:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     6d3:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     6d6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     6dd:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     6e1:	74 17                	je     6fa <printint+0x38>
+     6e3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     6e7:	79 11                	jns    6fa <printint+0x38>
+    neg = 1;
+     6e9:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     6f0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6f3:	f7 d8                	neg    %eax
+     6f5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6f8:	eb 06                	jmp    700 <printint+0x3e>
+  } else {
+    x = xx;
+     6fa:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6fd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     700:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     707:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     70a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     70d:	ba 00 00 00 00       	mov    $0x0,%edx
+     712:	f7 f1                	div    %ecx
+     714:	89 d1                	mov    %edx,%ecx
+     716:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     719:	8d 50 01             	lea    0x1(%rax),%edx
+     71c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     71f:	89 c9                	mov    %ecx,%ecx
+     721:	48 8d 15 18 29 00 00 	lea    0x2918(%rip),%rdx        # 3040 <digits.0>
+     728:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     72c:	48 98                	cltq
+     72e:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     732:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     735:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     738:	ba 00 00 00 00       	mov    $0x0,%edx
+     73d:	f7 f6                	div    %esi
+     73f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     742:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     746:	75 bf                	jne    707 <printint+0x45>
+  if (neg)
+     748:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     74c:	74 2b                	je     779 <printint+0xb7>
+    buf[i++] = '-';
+     74e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     751:	8d 50 01             	lea    0x1(%rax),%edx
+     754:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     757:	48 98                	cltq
+     759:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     75e:	eb 19                	jmp    779 <printint+0xb7>
+    putc(fd, buf[i]);
+     760:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     763:	48 98                	cltq
+     765:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     76a:	0f be d0             	movsbl %al,%edx
+     76d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     770:	89 d6                	mov    %edx,%esi
+     772:	89 c7                	mov    %eax,%edi
+     774:	e8 50 fe ff ff       	call   5c9 <putc>
+  while (--i >= 0)
+     779:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     77d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     781:	79 dd                	jns    760 <printint+0x9e>
+}
+     783:	90                   	nop
+     784:	90                   	nop
+     785:	c9                   	leave
+     786:	c3                   	ret
+
+0000000000000787 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     787:	55                   	push   %rbp
+     788:	48 89 e5             	mov    %rsp,%rbp
+     78b:	48 83 ec 70          	sub    $0x70,%rsp
+     78f:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     792:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     796:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     79a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     79e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     7a2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     7a6:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     7ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     7b1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     7b5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     7b9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     7bd:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     7c4:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     7cb:	e9 67 02 00 00       	jmp    a37 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     7d0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     7d3:	48 63 d0             	movslq %eax,%rdx
+     7d6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     7da:	48 01 d0             	add    %rdx,%rax
+     7dd:	0f b6 00             	movzbl (%rax),%eax
+     7e0:	0f be c0             	movsbl %al,%eax
+     7e3:	25 ff 00 00 00       	and    $0xff,%eax
+     7e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     7eb:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     7ef:	75 30                	jne    821 <printf+0x9a>
+      if (c == '%') {
+     7f1:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     7f5:	75 13                	jne    80a <printf+0x83>
+        state = '%';
+     7f7:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     7fe:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     805:	e9 29 02 00 00       	jmp    a33 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     80a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     80d:	0f be d0             	movsbl %al,%edx
+     810:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     813:	89 d6                	mov    %edx,%esi
+     815:	89 c7                	mov    %eax,%edi
+     817:	e8 ad fd ff ff       	call   5c9 <putc>
+     81c:	e9 12 02 00 00       	jmp    a33 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     821:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     825:	0f 85 08 02 00 00    	jne    a33 <printf+0x2ac>
+      if (c == 'l') {
+     82b:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     82f:	75 0c                	jne    83d <printf+0xb6>
+        lflag = 1;
+     831:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     838:	e9 f6 01 00 00       	jmp    a33 <printf+0x2ac>
+      } else if (c == 'd') {
+     83d:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     841:	0f 85 93 00 00 00    	jne    8da <printf+0x153>
+        if (lflag == 1)
+     847:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     84b:	75 47                	jne    894 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     84d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     850:	83 f8 2f             	cmp    $0x2f,%eax
+     853:	77 17                	ja     86c <printf+0xe5>
+     855:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     859:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     85c:	89 d2                	mov    %edx,%edx
+     85e:	48 01 d0             	add    %rdx,%rax
+     861:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     864:	83 c2 08             	add    $0x8,%edx
+     867:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     86a:	eb 0c                	jmp    878 <printf+0xf1>
+     86c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     870:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     874:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     878:	48 8b 30             	mov    (%rax),%rsi
+     87b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     87e:	b9 01 00 00 00       	mov    $0x1,%ecx
+     883:	ba 0a 00 00 00       	mov    $0xa,%edx
+     888:	89 c7                	mov    %eax,%edi
+     88a:	e8 5d fd ff ff       	call   5ec <printint64>
+     88f:	e9 98 01 00 00       	jmp    a2c <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     894:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     897:	83 f8 2f             	cmp    $0x2f,%eax
+     89a:	77 17                	ja     8b3 <printf+0x12c>
+     89c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8a0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8a3:	89 d2                	mov    %edx,%edx
+     8a5:	48 01 d0             	add    %rdx,%rax
+     8a8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8ab:	83 c2 08             	add    $0x8,%edx
+     8ae:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     8b1:	eb 0c                	jmp    8bf <printf+0x138>
+     8b3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8b7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8bb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     8bf:	8b 30                	mov    (%rax),%esi
+     8c1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+     8c9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     8ce:	89 c7                	mov    %eax,%edi
+     8d0:	e8 ed fd ff ff       	call   6c2 <printint>
+     8d5:	e9 52 01 00 00       	jmp    a2c <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     8da:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     8de:	74 0a                	je     8ea <printf+0x163>
+     8e0:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     8e4:	0f 85 93 00 00 00    	jne    97d <printf+0x1f6>
+        if (lflag == 1)
+     8ea:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     8ee:	75 47                	jne    937 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     8f0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8f3:	83 f8 2f             	cmp    $0x2f,%eax
+     8f6:	77 17                	ja     90f <printf+0x188>
+     8f8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8fc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8ff:	89 d2                	mov    %edx,%edx
+     901:	48 01 d0             	add    %rdx,%rax
+     904:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     907:	83 c2 08             	add    $0x8,%edx
+     90a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     90d:	eb 0c                	jmp    91b <printf+0x194>
+     90f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     913:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     917:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     91b:	48 8b 30             	mov    (%rax),%rsi
+     91e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     921:	b9 00 00 00 00       	mov    $0x0,%ecx
+     926:	ba 10 00 00 00       	mov    $0x10,%edx
+     92b:	89 c7                	mov    %eax,%edi
+     92d:	e8 ba fc ff ff       	call   5ec <printint64>
+        if (lflag == 1)
+     932:	e9 f5 00 00 00       	jmp    a2c <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     937:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     93a:	83 f8 2f             	cmp    $0x2f,%eax
+     93d:	77 17                	ja     956 <printf+0x1cf>
+     93f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     943:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     946:	89 d2                	mov    %edx,%edx
+     948:	48 01 d0             	add    %rdx,%rax
+     94b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     94e:	83 c2 08             	add    $0x8,%edx
+     951:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     954:	eb 0c                	jmp    962 <printf+0x1db>
+     956:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     95a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     95e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     962:	8b 30                	mov    (%rax),%esi
+     964:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     967:	b9 00 00 00 00       	mov    $0x0,%ecx
+     96c:	ba 10 00 00 00       	mov    $0x10,%edx
+     971:	89 c7                	mov    %eax,%edi
+     973:	e8 4a fd ff ff       	call   6c2 <printint>
+        if (lflag == 1)
+     978:	e9 af 00 00 00       	jmp    a2c <printf+0x2a5>
+      } else if (c == 's') {
+     97d:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     981:	75 6e                	jne    9f1 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     983:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     986:	83 f8 2f             	cmp    $0x2f,%eax
+     989:	77 17                	ja     9a2 <printf+0x21b>
+     98b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     98f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     992:	89 d2                	mov    %edx,%edx
+     994:	48 01 d0             	add    %rdx,%rax
+     997:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     99a:	83 c2 08             	add    $0x8,%edx
+     99d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     9a0:	eb 0c                	jmp    9ae <printf+0x227>
+     9a2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     9a6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9aa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     9ae:	48 8b 00             	mov    (%rax),%rax
+     9b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     9b5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     9ba:	75 28                	jne    9e4 <printf+0x25d>
+          s = "(null)";
+     9bc:	48 8d 05 ae 1c 00 00 	lea    0x1cae(%rip),%rax        # 2671 <benchreport+0x41d>
+     9c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     9c7:	eb 1b                	jmp    9e4 <printf+0x25d>
+          putc(fd, *s);
+     9c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     9cd:	0f b6 00             	movzbl (%rax),%eax
+     9d0:	0f be d0             	movsbl %al,%edx
+     9d3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9d6:	89 d6                	mov    %edx,%esi
+     9d8:	89 c7                	mov    %eax,%edi
+     9da:	e8 ea fb ff ff       	call   5c9 <putc>
+        for (; *s; s++)
+     9df:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     9e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     9e8:	0f b6 00             	movzbl (%rax),%eax
+     9eb:	84 c0                	test   %al,%al
+     9ed:	75 da                	jne    9c9 <printf+0x242>
+     9ef:	eb 3b                	jmp    a2c <printf+0x2a5>
+      } else if (c == '%') {
+     9f1:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     9f5:	75 14                	jne    a0b <printf+0x284>
+        putc(fd, c);
+     9f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     9fa:	0f be d0             	movsbl %al,%edx
+     9fd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a00:	89 d6                	mov    %edx,%esi
+     a02:	89 c7                	mov    %eax,%edi
+     a04:	e8 c0 fb ff ff       	call   5c9 <putc>
+     a09:	eb 21                	jmp    a2c <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     a0b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a0e:	be 25 00 00 00       	mov    $0x25,%esi
+     a13:	89 c7                	mov    %eax,%edi
+     a15:	e8 af fb ff ff       	call   5c9 <putc>
+        putc(fd, c);
+     a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     a1d:	0f be d0             	movsbl %al,%edx
+     a20:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a23:	89 d6                	mov    %edx,%esi
+     a25:	89 c7                	mov    %eax,%edi
+     a27:	e8 9d fb ff ff       	call   5c9 <putc>
+      }
+      state = 0;
+     a2c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     a33:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     a37:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     a3a:	48 63 d0             	movslq %eax,%rdx
+     a3d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     a41:	48 01 d0             	add    %rdx,%rax
+     a44:	0f b6 00             	movzbl (%rax),%eax
+     a47:	84 c0                	test   %al,%al
+     a49:	0f 85 81 fd ff ff    	jne    7d0 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     a4f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a52:	89 c7                	mov    %eax,%edi
+     a54:	e8 ee 02 00 00       	call   d47 <bflushtty>
+}
+     a59:	90                   	nop
+     a5a:	c9                   	leave
+     a5b:	c3                   	ret
+
+0000000000000a5c <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     a5c:	55                   	push   %rbp
+     a5d:	48 89 e5             	mov    %rsp,%rbp
+     a60:	48 83 ec 30          	sub    $0x30,%rsp
+     a64:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     a67:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     a6b:	78 06                	js     a73 <getbuf+0x17>
+     a6d:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     a71:	7e 0a                	jle    a7d <getbuf+0x21>
+    return 0;
+     a73:	b8 00 00 00 00       	mov    $0x0,%eax
+     a78:	e9 94 00 00 00       	jmp    b11 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     a7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a80:	48 98                	cltq
+     a82:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a89:	00 
+     a8a:	48 8d 05 cf 45 00 00 	lea    0x45cf(%rip),%rax        # 5060 <obufs>
+     a91:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a99:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a9e:	75 6d                	jne    b0d <getbuf+0xb1>
+     aa0:	bf 08 02 00 00       	mov    $0x208,%edi
+     aa5:	e8 bd 13 00 00       	call   1e67 <malloc>
+     aaa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     aae:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     ab3:	74 58                	je     b0d <getbuf+0xb1>
+    b->n = 0;
+     ab5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ab9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     abf:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     ac3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ac6:	48 89 d6             	mov    %rdx,%rsi
+     ac9:	89 c7                	mov    %eax,%edi
+     acb:	e8 e4 0d 00 00       	call   18b4 <fstat>
+     ad0:	85 c0                	test   %eax,%eax
+     ad2:	75 11                	jne    ae5 <getbuf+0x89>
+     ad4:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     ad8:	66 83 f8 03          	cmp    $0x3,%ax
+     adc:	75 07                	jne    ae5 <getbuf+0x89>
+     ade:	ba 01 00 00 00       	mov    $0x1,%edx
+     ae3:	eb 05                	jmp    aea <getbuf+0x8e>
+     ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+     aea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aee:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     af1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     af4:	48 98                	cltq
+     af6:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     afd:	00 
+     afe:	48 8d 15 5b 45 00 00 	lea    0x455b(%rip),%rdx        # 5060 <obufs>
+     b05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b09:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     b0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b11:	c9                   	leave
+     b12:	c3                   	ret
+
+0000000000000b13 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     b13:	55                   	push   %rbp
+     b14:	48 89 e5             	mov    %rsp,%rbp
+     b17:	48 83 ec 20          	sub    $0x20,%rsp
+     b1b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     b1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     b22:	78 33                	js     b57 <bflush+0x44>
+     b24:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     b28:	7f 2d                	jg     b57 <bflush+0x44>
+     b2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b2d:	48 98                	cltq
+     b2f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     b36:	00 
+     b37:	48 8d 05 22 45 00 00 	lea    0x4522(%rip),%rax        # 5060 <obufs>
+     b3e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     b46:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     b4b:	74 0a                	je     b57 <bflush+0x44>
+     b4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b51:	8b 00                	mov    (%rax),%eax
+     b53:	85 c0                	test   %eax,%eax
+     b55:	75 07                	jne    b5e <bflush+0x4b>
+    return 0;
+     b57:	b8 00 00 00 00       	mov    $0x0,%eax
+     b5c:	eb 3c                	jmp    b9a <bflush+0x87>
+  n = b->n;
+     b5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b62:	8b 00                	mov    (%rax),%eax
+     b64:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b6b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     b71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b75:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     b79:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b7f:	48 89 ce             	mov    %rcx,%rsi
+     b82:	89 c7                	mov    %eax,%edi
+     b84:	e8 de 0c 00 00       	call   1867 <write>
+     b89:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     b8c:	75 07                	jne    b95 <bflush+0x82>
+     b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+     b93:	eb 05                	jmp    b9a <bflush+0x87>
+     b95:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     b9a:	c9                   	leave
+     b9b:	c3                   	ret
+
+0000000000000b9c <bflushall>:
+
+void bflushall(void) {
+     b9c:	55                   	push   %rbp
+     b9d:	48 89 e5             	mov    %rsp,%rbp
+     ba0:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     ba4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bab:	eb 0e                	jmp    bbb <bflushall+0x1f>
+    bflush(fd);
+     bad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bb0:	89 c7                	mov    %eax,%edi
+     bb2:	e8 5c ff ff ff       	call   b13 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     bb7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     bbb:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     bbf:	7e ec                	jle    bad <bflushall+0x11>
+}
+     bc1:	90                   	nop
+     bc2:	90                   	nop
+     bc3:	c9                   	leave
+     bc4:	c3                   	ret
+
+0000000000000bc5 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     bc5:	55                   	push   %rbp
+     bc6:	48 89 e5             	mov    %rsp,%rbp
+     bc9:	48 83 ec 30          	sub    $0x30,%rsp
+     bcd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     bd0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     bd4:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     bd7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     bda:	89 c7                	mov    %eax,%edi
+     bdc:	e8 7b fe ff ff       	call   a5c <getbuf>
+     be1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     be5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     bea:	75 19                	jne    c05 <bwrite+0x40>
+    return write(fd, s, n);
+     bec:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     bef:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     bf3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     bf6:	48 89 ce             	mov    %rcx,%rsi
+     bf9:	89 c7                	mov    %eax,%edi
+     bfb:	e8 67 0c 00 00       	call   1867 <write>
+     c00:	e9 cd 00 00 00       	jmp    cd2 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     c05:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c0c:	e9 92 00 00 00       	jmp    ca3 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     c11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c15:	8b 00                	mov    (%rax),%eax
+     c17:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c1c:	75 18                	jne    c36 <bwrite+0x71>
+     c1e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     c21:	89 c7                	mov    %eax,%edi
+     c23:	e8 eb fe ff ff       	call   b13 <bflush>
+     c28:	85 c0                	test   %eax,%eax
+     c2a:	79 0a                	jns    c36 <bwrite+0x71>
+      return -1;
+     c2c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c31:	e9 9c 00 00 00       	jmp    cd2 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     c36:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     c39:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     c3c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     c3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c43:	8b 00                	mov    (%rax),%eax
+     c45:	ba 00 02 00 00       	mov    $0x200,%edx
+     c4a:	29 c2                	sub    %eax,%edx
+     c4c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     c4f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c52:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     c55:	39 c2                	cmp    %eax,%edx
+     c57:	0f 4e c2             	cmovle %edx,%eax
+     c5a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     c5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c60:	48 63 d0             	movslq %eax,%rdx
+     c63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c67:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     c6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c6f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c77:	8b 00                	mov    (%rax),%eax
+     c79:	48 98                	cltq
+     c7b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     c7f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c82:	89 c2                	mov    %eax,%edx
+     c84:	48 89 cf             	mov    %rcx,%rdi
+     c87:	e8 e9 06 00 00       	call   1375 <memmove>
+    b->n += m;
+     c8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c90:	8b 10                	mov    (%rax),%edx
+     c92:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c95:	01 c2                	add    %eax,%edx
+     c97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c9b:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     c9d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ca0:	01 45 fc             	add    %eax,-0x4(%rbp)
+     ca3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ca6:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     ca9:	0f 8c 62 ff ff ff    	jl     c11 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     caf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cb3:	8b 40 04             	mov    0x4(%rax),%eax
+     cb6:	85 c0                	test   %eax,%eax
+     cb8:	74 15                	je     ccf <bwrite+0x10a>
+     cba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     cbd:	89 c7                	mov    %eax,%edi
+     cbf:	e8 4f fe ff ff       	call   b13 <bflush>
+     cc4:	85 c0                	test   %eax,%eax
+     cc6:	79 07                	jns    ccf <bwrite+0x10a>
+    return -1;
+     cc8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ccd:	eb 03                	jmp    cd2 <bwrite+0x10d>
+  return n;
+     ccf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     cd2:	c9                   	leave
+     cd3:	c3                   	ret
+
+0000000000000cd4 <bputc>:
+
+void bputc(int fd, char c) {
+     cd4:	55                   	push   %rbp
+     cd5:	48 89 e5             	mov    %rsp,%rbp
+     cd8:	48 83 ec 20          	sub    $0x20,%rsp
+     cdc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     cdf:	89 f0                	mov    %esi,%eax
+     ce1:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     ce4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ce7:	89 c7                	mov    %eax,%edi
+     ce9:	e8 6e fd ff ff       	call   a5c <getbuf>
+     cee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     cf2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     cf7:	75 18                	jne    d11 <bputc+0x3d>
+    write(fd, &c, 1);
+     cf9:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     cfd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d00:	ba 01 00 00 00       	mov    $0x1,%edx
+     d05:	48 89 ce             	mov    %rcx,%rsi
+     d08:	89 c7                	mov    %eax,%edi
+     d0a:	e8 58 0b 00 00       	call   1867 <write>
+    return;
+     d0f:	eb 34                	jmp    d45 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     d11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d15:	8b 00                	mov    (%rax),%eax
+     d17:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d1c:	75 0a                	jne    d28 <bputc+0x54>
+    bflush(fd);
+     d1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d21:	89 c7                	mov    %eax,%edi
+     d23:	e8 eb fd ff ff       	call   b13 <bflush>
+  b->data[b->n++] = c;
+     d28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d2c:	8b 00                	mov    (%rax),%eax
+     d2e:	8d 48 01             	lea    0x1(%rax),%ecx
+     d31:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     d35:	89 0a                	mov    %ecx,(%rdx)
+     d37:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     d3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     d3f:	48 98                	cltq
+     d41:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     d45:	c9                   	leave
+     d46:	c3                   	ret
+
+0000000000000d47 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     d47:	55                   	push   %rbp
+     d48:	48 89 e5             	mov    %rsp,%rbp
+     d4b:	48 83 ec 10          	sub    $0x10,%rsp
+     d4f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     d52:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d56:	78 4c                	js     da4 <bflushtty+0x5d>
+     d58:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     d5c:	7f 46                	jg     da4 <bflushtty+0x5d>
+     d5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d61:	48 98                	cltq
+     d63:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d6a:	00 
+     d6b:	48 8d 05 ee 42 00 00 	lea    0x42ee(%rip),%rax        # 5060 <obufs>
+     d72:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d76:	48 85 c0             	test   %rax,%rax
+     d79:	74 29                	je     da4 <bflushtty+0x5d>
+     d7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d7e:	48 98                	cltq
+     d80:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d87:	00 
+     d88:	48 8d 05 d1 42 00 00 	lea    0x42d1(%rip),%rax        # 5060 <obufs>
+     d8f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d93:	8b 40 04             	mov    0x4(%rax),%eax
+     d96:	85 c0                	test   %eax,%eax
+     d98:	74 0a                	je     da4 <bflushtty+0x5d>
+    bflush(fd);
+     d9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d9d:	89 c7                	mov    %eax,%edi
+     d9f:	e8 6f fd ff ff       	call   b13 <bflush>
+}
+     da4:	90                   	nop
+     da5:	c9                   	leave
+     da6:	c3                   	ret
+
+0000000000000da7 <fork>:
+
+int fork(void) {
+     da7:	55                   	push   %rbp
+     da8:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     dab:	e8 ec fd ff ff       	call   b9c <bflushall>
+  return _fork();
+     db0:	e8 7b 0a 00 00       	call   1830 <_fork>
+}
+     db5:	5d                   	pop    %rbp
+     db6:	c3                   	ret
+
+0000000000000db7 <exit>:
+
+noreturn void exit(void) {
+     db7:	55                   	push   %rbp
+     db8:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     dbb:	e8 dc fd ff ff       	call   b9c <bflushall>
+  _exit();
+     dc0:	e8 76 0a 00 00       	call   183b <_exit>
+
+0000000000000dc5 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     dc5:	55                   	push   %rbp
+     dc6:	48 89 e5             	mov    %rsp,%rbp
+     dc9:	48 83 ec 10          	sub    $0x10,%rsp
+     dcd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     dd5:	e8 c2 fd ff ff       	call   b9c <bflushall>
+  return _exec(path, argv);
+     dda:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de2:	48 89 d6             	mov    %rdx,%rsi
+     de5:	48 89 c7             	mov    %rax,%rdi
+     de8:	e8 9b 0a 00 00       	call   1888 <_exec>
+}
+     ded:	c9                   	leave
+     dee:	c3                   	ret
+
+0000000000000def <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     def:	55                   	push   %rbp
+     df0:	48 89 e5             	mov    %rsp,%rbp
+     df3:	48 83 ec 20          	sub    $0x20,%rsp
+     df7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dfb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     dff:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     e03:	e8 94 fd ff ff       	call   b9c <bflushall>
+  return _spawn(path, argv, fds);
+     e08:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     e0c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     e10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e14:	48 89 ce             	mov    %rcx,%rsi
+     e17:	48 89 c7             	mov    %rax,%rdi
+     e1a:	e8 2f 0b 00 00       	call   194e <_spawn>
+}
+     e1f:	c9                   	leave
+     e20:	c3                   	ret
+
+0000000000000e21 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     e21:	55                   	push   %rbp
+     e22:	48 89 e5             	mov    %rsp,%rbp
+     e25:	48 83 ec 10          	sub    $0x10,%rsp
+     e29:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     e2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     e30:	78 69                	js     e9b <close+0x7a>
+     e32:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     e36:	7f 63                	jg     e9b <close+0x7a>
+     e38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e3b:	48 98                	cltq
+     e3d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e44:	00 
+     e45:	48 8d 05 14 42 00 00 	lea    0x4214(%rip),%rax        # 5060 <obufs>
+     e4c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     e50:	48 85 c0             	test   %rax,%rax
+     e53:	74 46                	je     e9b <close+0x7a>
+    bflush(fd);
+     e55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e58:	89 c7                	mov    %eax,%edi
+     e5a:	e8 b4 fc ff ff       	call   b13 <bflush>
+    free(obufs[fd]);
+     e5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e62:	48 98                	cltq
+     e64:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e6b:	00 
+     e6c:	48 8d 05 ed 41 00 00 	lea    0x41ed(%rip),%rax        # 5060 <obufs>
+     e73:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     e77:	48 89 c7             	mov    %rax,%rdi
+     e7a:	e8 90 11 00 00       	call   200f <free>
+    obufs[fd] = 0;
+     e7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e82:	48 98                	cltq
+     e84:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e8b:	00 
+     e8c:	48 8d 05 cd 41 00 00 	lea    0x41cd(%rip),%rax        # 5060 <obufs>
+     e93:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     e9a:	00 
+  }
+  return _close(fd);
+     e9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e9e:	89 c7                	mov    %eax,%edi
+     ea0:	e8 cd 09 00 00       	call   1872 <_close>
+}
+     ea5:	c9                   	leave
+     ea6:	c3                   	ret
+
+0000000000000ea7 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     ea7:	55                   	push   %rbp
+     ea8:	48 89 e5             	mov    %rsp,%rbp
+     eab:	53                   	push   %rbx
+     eac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     eb0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     eb4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     eb8:	48 8b 36             	mov    (%rsi),%rsi
+     ebb:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     ebf:	48 29 f7             	sub    %rsi,%rdi
+     ec2:	48 89 f9             	mov    %rdi,%rcx
+     ec5:	bb 00 00 00 00       	mov    $0x0,%ebx
+     eca:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     ece:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     ed2:	48 89 f0             	mov    %rsi,%rax
+     ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+     eda:	48 89 df             	mov    %rbx,%rdi
+     edd:	48 0f af f8          	imul   %rax,%rdi
+     ee1:	48 89 d6             	mov    %rdx,%rsi
+     ee4:	48 0f af f1          	imul   %rcx,%rsi
+     ee8:	48 01 fe             	add    %rdi,%rsi
+     eeb:	48 f7 e1             	mul    %rcx
+     eee:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     ef2:	48 89 ca             	mov    %rcx,%rdx
+     ef5:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     efa:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     efe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f02:	c9                   	leave
+     f03:	c3                   	ret
+
+0000000000000f04 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     f04:	55                   	push   %rbp
+     f05:	48 89 e5             	mov    %rsp,%rbp
+     f08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f0c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     f0f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     f12:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f16:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f19:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f1c:	48 89 ce             	mov    %rcx,%rsi
+     f1f:	48 89 f7             	mov    %rsi,%rdi
+     f22:	89 d1                	mov    %edx,%ecx
+     f24:	fc                   	cld
+     f25:	f3 aa                	rep stos %al,%es:(%rdi)
+     f27:	89 ca                	mov    %ecx,%edx
+     f29:	48 89 fe             	mov    %rdi,%rsi
+     f2c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     f30:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     f33:	90                   	nop
+     f34:	5d                   	pop    %rbp
+     f35:	c3                   	ret
+
+0000000000000f36 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     f36:	55                   	push   %rbp
+     f37:	48 89 e5             	mov    %rsp,%rbp
+     f3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f3e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     f42:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     f46:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     f4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f52:	48 89 ce             	mov    %rcx,%rsi
+     f55:	48 89 f7             	mov    %rsi,%rdi
+     f58:	48 89 d1             	mov    %rdx,%rcx
+     f5b:	fc                   	cld
+     f5c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     f5f:	48 89 ca             	mov    %rcx,%rdx
+     f62:	48 89 fe             	mov    %rdi,%rsi
+     f65:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     f69:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     f6d:	90                   	nop
+     f6e:	5d                   	pop    %rbp
+     f6f:	c3                   	ret
+
+0000000000000f70 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     f70:	55                   	push   %rbp
+     f71:	48 89 e5             	mov    %rsp,%rbp
+     f74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f78:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     f7c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     f80:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f8c:	48 89 cf             	mov    %rcx,%rdi
+     f8f:	48 89 d6             	mov    %rdx,%rsi
+     f92:	48 89 c1             	mov    %rax,%rcx
+     f95:	fc                   	cld
+     f96:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     f98:	48 89 c8             	mov    %rcx,%rax
+     f9b:	48 89 f2             	mov    %rsi,%rdx
+     f9e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fa2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     fa6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     faa:	90                   	nop
+     fab:	5d                   	pop    %rbp
+     fac:	c3                   	ret
+
+0000000000000fad <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     fad:	55                   	push   %rbp
+     fae:	48 89 e5             	mov    %rsp,%rbp
+     fb1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fb5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     fb9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     fbd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     fc1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     fc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fc9:	48 89 cf             	mov    %rcx,%rdi
+     fcc:	48 89 d6             	mov    %rdx,%rsi
+     fcf:	48 89 c1             	mov    %rax,%rcx
+     fd2:	fc                   	cld
+     fd3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     fd6:	48 89 c8             	mov    %rcx,%rax
+     fd9:	48 89 f2             	mov    %rsi,%rdx
+     fdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fe0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     fe4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     fe8:	90                   	nop
+     fe9:	5d                   	pop    %rbp
+     fea:	c3                   	ret
+
+0000000000000feb <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     feb:	55                   	push   %rbp
+     fec:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     fef:	0f 31                	rdtsc
+     ff1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     ff4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     ff7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     ffa:	48 c1 e0 20          	shl    $0x20,%rax
+     ffe:	48 89 c2             	mov    %rax,%rdx
+    1001:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1004:	48 09 d0             	or     %rdx,%rax
+}
+    1007:	5d                   	pop    %rbp
+    1008:	c3                   	ret
+
+0000000000001009 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    1009:	55                   	push   %rbp
+    100a:	48 89 e5             	mov    %rsp,%rbp
+    100d:	53                   	push   %rbx
+    100e:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    1011:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    1015:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    1019:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    101d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    1021:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1024:	0f a2                	cpuid
+    1026:	89 de                	mov    %ebx,%esi
+    1028:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    102b:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    102e:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    1031:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    1034:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1039:	74 09                	je     1044 <cpuid+0x3b>
+    *eaxp = eax;
+    103b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    103f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1042:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    1044:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1049:	74 09                	je     1054 <cpuid+0x4b>
+    *ebxp = ebx;
+    104b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    104f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1052:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    1054:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1059:	74 09                	je     1064 <cpuid+0x5b>
+    *ecxp = ecx;
+    105b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    105f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1062:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    1064:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    1069:	74 09                	je     1074 <cpuid+0x6b>
+    *edxp = edx;
+    106b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    106f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    1072:	89 10                	mov    %edx,(%rax)
+}
+    1074:	90                   	nop
+    1075:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1079:	c9                   	leave
+    107a:	c3                   	ret
+
+000000000000107b <strcpy>:
+char *strcpy(char *s, char *t) {
+    107b:	55                   	push   %rbp
+    107c:	48 89 e5             	mov    %rsp,%rbp
+    107f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1083:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1087:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    108b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    108f:	90                   	nop
+    1090:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1094:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1098:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    109c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10a0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    10a4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    10a8:	0f b6 12             	movzbl (%rdx),%edx
+    10ab:	88 10                	mov    %dl,(%rax)
+    10ad:	0f b6 00             	movzbl (%rax),%eax
+    10b0:	84 c0                	test   %al,%al
+    10b2:	75 dc                	jne    1090 <strcpy+0x15>
+  return os;
+    10b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    10b8:	5d                   	pop    %rbp
+    10b9:	c3                   	ret
+
+00000000000010ba <strcmp>:
+int strcmp(const char *p, const char *q) {
+    10ba:	55                   	push   %rbp
+    10bb:	48 89 e5             	mov    %rsp,%rbp
+    10be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    10c2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    10c6:	eb 0a                	jmp    10d2 <strcmp+0x18>
+    p++, q++;
+    10c8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    10cd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    10d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d6:	0f b6 00             	movzbl (%rax),%eax
+    10d9:	84 c0                	test   %al,%al
+    10db:	74 12                	je     10ef <strcmp+0x35>
+    10dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10e1:	0f b6 10             	movzbl (%rax),%edx
+    10e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10e8:	0f b6 00             	movzbl (%rax),%eax
+    10eb:	38 c2                	cmp    %al,%dl
+    10ed:	74 d9                	je     10c8 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    10ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10f3:	0f b6 00             	movzbl (%rax),%eax
+    10f6:	0f b6 d0             	movzbl %al,%edx
+    10f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10fd:	0f b6 00             	movzbl (%rax),%eax
+    1100:	0f b6 c0             	movzbl %al,%eax
+    1103:	29 c2                	sub    %eax,%edx
+    1105:	89 d0                	mov    %edx,%eax
+}
+    1107:	5d                   	pop    %rbp
+    1108:	c3                   	ret
+
+0000000000001109 <strlen>:
+uint strlen(char *s) {
+    1109:	55                   	push   %rbp
+    110a:	48 89 e5             	mov    %rsp,%rbp
+    110d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1111:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1118:	eb 04                	jmp    111e <strlen+0x15>
+    111a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    111e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1121:	48 63 d0             	movslq %eax,%rdx
+    1124:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1128:	48 01 d0             	add    %rdx,%rax
+    112b:	0f b6 00             	movzbl (%rax),%eax
+    112e:	84 c0                	test   %al,%al
+    1130:	75 e8                	jne    111a <strlen+0x11>
+    ;
+  return n;
+    1132:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1135:	5d                   	pop    %rbp
+    1136:	c3                   	ret
+
+0000000000001137 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    1137:	55                   	push   %rbp
+    1138:	48 89 e5             	mov    %rsp,%rbp
+    113b:	53                   	push   %rbx
+    113c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    1140:	8b 05 0e 1f 00 00    	mov    0x1f0e(%rip),%eax        # 3054 <erms>
+    1146:	85 c0                	test   %eax,%eax
+    1148:	79 53                	jns    119d <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    114a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    114e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    1154:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1159:	ba 00 00 00 00       	mov    $0x0,%edx
+    115e:	48 89 c6             	mov    %rax,%rsi
+    1161:	bf 00 00 00 00       	mov    $0x0,%edi
+    1166:	e8 9e fe ff ff       	call   1009 <cpuid>
+    ebx = 0;
+    116b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    1172:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1175:	83 f8 06             	cmp    $0x6,%eax
+    1178:	76 14                	jbe    118e <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    117a:	b8 07 00 00 00       	mov    $0x7,%eax
+    117f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1184:	0f a2                	cpuid
+    1186:	89 d9                	mov    %ebx,%ecx
+    1188:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    118b:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    118e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1191:	c1 e8 09             	shr    $0x9,%eax
+    1194:	83 e0 01             	and    $0x1,%eax
+    1197:	89 05 b7 1e 00 00    	mov    %eax,0x1eb7(%rip)        # 3054 <erms>
+  }
+  return erms;
+    119d:	8b 05 b1 1e 00 00    	mov    0x1eb1(%rip),%eax        # 3054 <erms>
+}
+    11a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    11a7:	c9                   	leave
+    11a8:	c3                   	ret
+
+00000000000011a9 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    11a9:	55                   	push   %rbp
+    11aa:	48 89 e5             	mov    %rsp,%rbp
+    11ad:	48 83 ec 10          	sub    $0x10,%rsp
+    11b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11b5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11b8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    11bb:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    11bf:	76 09                	jbe    11ca <memset+0x21>
+    11c1:	e8 71 ff ff ff       	call   1137 <haserms>
+    11c6:	85 c0                	test   %eax,%eax
+    11c8:	74 16                	je     11e0 <memset+0x37>
+    stosb(dst, c, n);
+    11ca:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    11cd:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    11d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11d4:	89 ce                	mov    %ecx,%esi
+    11d6:	48 89 c7             	mov    %rax,%rdi
+    11d9:	e8 26 fd ff ff       	call   f04 <stosb>
+    11de:	eb 58                	jmp    1238 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    11e0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    11e3:	c1 e8 03             	shr    $0x3,%eax
+    11e6:	89 c6                	mov    %eax,%esi
+    11e8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11eb:	48 98                	cltq
+    11ed:	0f b6 c0             	movzbl %al,%eax
+    11f0:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    11f7:	01 01 01 
+    11fa:	48 0f af c2          	imul   %rdx,%rax
+    11fe:	48 89 c1             	mov    %rax,%rcx
+    1201:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1205:	48 89 f2             	mov    %rsi,%rdx
+    1208:	48 89 ce             	mov    %rcx,%rsi
+    120b:	48 89 c7             	mov    %rax,%rdi
+    120e:	e8 23 fd ff ff       	call   f36 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    1213:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1216:	83 e0 07             	and    $0x7,%eax
+    1219:	89 c2                	mov    %eax,%edx
+    121b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    121e:	83 e0 f8             	and    $0xfffffff8,%eax
+    1221:	48 89 c1             	mov    %rax,%rcx
+    1224:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1228:	48 01 c1             	add    %rax,%rcx
+    122b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    122e:	89 c6                	mov    %eax,%esi
+    1230:	48 89 cf             	mov    %rcx,%rdi
+    1233:	e8 cc fc ff ff       	call   f04 <stosb>
+  }
+  return dst;
+    1238:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    123c:	c9                   	leave
+    123d:	c3                   	ret
+
+000000000000123e <strchr>:
+
+char *strchr(const char *s, char c) {
+    123e:	55                   	push   %rbp
+    123f:	48 89 e5             	mov    %rsp,%rbp
+    1242:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1246:	89 f0                	mov    %esi,%eax
+    1248:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    124b:	eb 17                	jmp    1264 <strchr+0x26>
+    if (*s == c)
+    124d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1251:	0f b6 00             	movzbl (%rax),%eax
+    1254:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1257:	75 06                	jne    125f <strchr+0x21>
+      return (char *)s;
+    1259:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    125d:	eb 15                	jmp    1274 <strchr+0x36>
+  for (; *s; s++)
+    125f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1264:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1268:	0f b6 00             	movzbl (%rax),%eax
+    126b:	84 c0                	test   %al,%al
+    126d:	75 de                	jne    124d <strchr+0xf>
+  return 0;
+    126f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1274:	5d                   	pop    %rbp
+    1275:	c3                   	ret
+
+0000000000001276 <gets>:
+
+char *gets(char *buf, int max) {
+    1276:	55                   	push   %rbp
+    1277:	48 89 e5             	mov    %rsp,%rbp
+    127a:	48 83 ec 20          	sub    $0x20,%rsp
+    127e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1282:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    1285:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    128c:	eb 48                	jmp    12d6 <gets+0x60>
+    cc = read(0, &c, 1);
+    128e:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1292:	ba 01 00 00 00       	mov    $0x1,%edx
+    1297:	48 89 c6             	mov    %rax,%rsi
+    129a:	bf 00 00 00 00       	mov    $0x0,%edi
+    129f:	e8 b8 05 00 00       	call   185c <read>
+    12a4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    12a7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    12ab:	7e 36                	jle    12e3 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    12ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12b0:	8d 50 01             	lea    0x1(%rax),%edx
+    12b3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12b6:	48 63 d0             	movslq %eax,%rdx
+    12b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12bd:	48 01 c2             	add    %rax,%rdx
+    12c0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12c4:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    12c6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12ca:	3c 0a                	cmp    $0xa,%al
+    12cc:	74 16                	je     12e4 <gets+0x6e>
+    12ce:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12d2:	3c 0d                	cmp    $0xd,%al
+    12d4:	74 0e                	je     12e4 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    12d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12d9:	83 c0 01             	add    $0x1,%eax
+    12dc:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    12df:	7f ad                	jg     128e <gets+0x18>
+    12e1:	eb 01                	jmp    12e4 <gets+0x6e>
+      break;
+    12e3:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    12e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12e7:	48 63 d0             	movslq %eax,%rdx
+    12ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ee:	48 01 d0             	add    %rdx,%rax
+    12f1:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    12f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    12f8:	c9                   	leave
+    12f9:	c3                   	ret
+
+00000000000012fa <stat>:
+
+int stat(char *n, struct stat *st) {
+    12fa:	55                   	push   %rbp
+    12fb:	48 89 e5             	mov    %rsp,%rbp
+    12fe:	48 83 ec 10          	sub    $0x10,%rsp
+    1302:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1306:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    130a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    130e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1312:	48 89 c6             	mov    %rax,%rsi
+    1315:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    131a:	e8 58 07 00 00       	call   1a77 <fstatat>
+}
+    131f:	c9                   	leave
+    1320:	c3                   	ret
+
+0000000000001321 <atoi>:
+
+int atoi(const char *s) {
+    1321:	55                   	push   %rbp
+    1322:	48 89 e5             	mov    %rsp,%rbp
+    1325:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1329:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1330:	eb 28                	jmp    135a <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    1332:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1335:	89 d0                	mov    %edx,%eax
+    1337:	c1 e0 02             	shl    $0x2,%eax
+    133a:	01 d0                	add    %edx,%eax
+    133c:	01 c0                	add    %eax,%eax
+    133e:	89 c1                	mov    %eax,%ecx
+    1340:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1344:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1348:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    134c:	0f b6 00             	movzbl (%rax),%eax
+    134f:	0f be c0             	movsbl %al,%eax
+    1352:	01 c8                	add    %ecx,%eax
+    1354:	83 e8 30             	sub    $0x30,%eax
+    1357:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    135a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    135e:	0f b6 00             	movzbl (%rax),%eax
+    1361:	3c 2f                	cmp    $0x2f,%al
+    1363:	7e 0b                	jle    1370 <atoi+0x4f>
+    1365:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1369:	0f b6 00             	movzbl (%rax),%eax
+    136c:	3c 39                	cmp    $0x39,%al
+    136e:	7e c2                	jle    1332 <atoi+0x11>
+  return n;
+    1370:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1373:	5d                   	pop    %rbp
+    1374:	c3                   	ret
+
+0000000000001375 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1375:	55                   	push   %rbp
+    1376:	48 89 e5             	mov    %rsp,%rbp
+    1379:	48 83 ec 28          	sub    $0x28,%rsp
+    137d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1381:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1385:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1388:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    138c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1390:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1394:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1398:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    139c:	7f 09                	jg     13a7 <memmove+0x32>
+    return vdst;
+    139e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13a2:	e9 29 01 00 00       	jmp    14d0 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    13a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13ab:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    13af:	0f 83 87 00 00 00    	jae    143c <memmove+0xc7>
+    13b5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13b8:	48 63 d0             	movslq %eax,%rdx
+    13bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13bf:	48 01 d0             	add    %rdx,%rax
+    13c2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    13c6:	73 74                	jae    143c <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    13c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13cb:	48 98                	cltq
+    13cd:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    13d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13d4:	48 98                	cltq
+    13d6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    13da:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    13de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13e2:	48 09 d0             	or     %rdx,%rax
+    13e5:	83 e0 07             	and    $0x7,%eax
+    13e8:	48 85 c0             	test   %rax,%rax
+    13eb:	75 3d                	jne    142a <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    13ed:	eb 1c                	jmp    140b <memmove+0x96>
+        src -= 8;
+    13ef:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    13f4:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    13f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13fd:	48 8b 10             	mov    (%rax),%rdx
+    1400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1404:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1407:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    140b:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    140f:	7f de                	jg     13ef <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1411:	eb 17                	jmp    142a <memmove+0xb5>
+      *--dst = *--src;
+    1413:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1418:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    141d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1421:	0f b6 10             	movzbl (%rax),%edx
+    1424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1428:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    142a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    142d:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1430:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1433:	85 c0                	test   %eax,%eax
+    1435:	7f dc                	jg     1413 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1437:	e9 90 00 00 00       	jmp    14cc <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    143c:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1440:	7e 09                	jle    144b <memmove+0xd6>
+    1442:	e8 f0 fc ff ff       	call   1137 <haserms>
+    1447:	85 c0                	test   %eax,%eax
+    1449:	74 1b                	je     1466 <memmove+0xf1>
+    movsb(dst, src, n);
+    144b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    144e:	48 63 d0             	movslq %eax,%rdx
+    1451:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1455:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1459:	48 89 ce             	mov    %rcx,%rsi
+    145c:	48 89 c7             	mov    %rax,%rdi
+    145f:	e8 0c fb ff ff       	call   f70 <movsb>
+    1464:	eb 66                	jmp    14cc <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1466:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1469:	8d 50 07             	lea    0x7(%rax),%edx
+    146c:	85 c0                	test   %eax,%eax
+    146e:	0f 48 c2             	cmovs  %edx,%eax
+    1471:	c1 f8 03             	sar    $0x3,%eax
+    1474:	48 63 d0             	movslq %eax,%rdx
+    1477:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    147b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    147f:	48 89 ce             	mov    %rcx,%rsi
+    1482:	48 89 c7             	mov    %rax,%rdi
+    1485:	e8 23 fb ff ff       	call   fad <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    148a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    148d:	89 d0                	mov    %edx,%eax
+    148f:	c1 f8 1f             	sar    $0x1f,%eax
+    1492:	c1 e8 1d             	shr    $0x1d,%eax
+    1495:	01 c2                	add    %eax,%edx
+    1497:	83 e2 07             	and    $0x7,%edx
+    149a:	29 c2                	sub    %eax,%edx
+    149c:	89 d0                	mov    %edx,%eax
+    149e:	48 98                	cltq
+    14a0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    14a3:	83 e2 f8             	and    $0xfffffff8,%edx
+    14a6:	48 63 ca             	movslq %edx,%rcx
+    14a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    14ad:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    14b1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    14b4:	83 e2 f8             	and    $0xfffffff8,%edx
+    14b7:	48 63 ca             	movslq %edx,%rcx
+    14ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    14be:	48 01 d1             	add    %rdx,%rcx
+    14c1:	48 89 c2             	mov    %rax,%rdx
+    14c4:	48 89 cf             	mov    %rcx,%rdi
+    14c7:	e8 a4 fa ff ff       	call   f70 <movsb>
+  }
+  return vdst;
+    14cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    14d0:	c9                   	leave
+    14d1:	c3                   	ret
+
+00000000000014d2 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    14d2:	55                   	push   %rbp
+    14d3:	48 89 e5             	mov    %rsp,%rbp
+    14d6:	48 83 ec 20          	sub    $0x20,%rsp
+    14da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    14dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    14e1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    14e8:	00 00 00 
+    14eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    14ef:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    14f3:	75 0d                	jne    1502 <clock_gettime+0x30>
+    14f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14f9:	48 8b 40 08          	mov    0x8(%rax),%rax
+    14fd:	48 85 c0             	test   %rax,%rax
+    1500:	75 13                	jne    1515 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1502:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1506:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1509:	48 89 d6             	mov    %rdx,%rsi
+    150c:	89 c7                	mov    %eax,%edi
+    150e:	e8 e0 04 00 00       	call   19f3 <_clock_gettime>
+    1513:	eb 7d                	jmp    1592 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1515:	e8 d1 fa ff ff       	call   feb <rdtsc>
+    151a:	48 89 c2             	mov    %rax,%rdx
+    151d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1521:	48 89 d6             	mov    %rdx,%rsi
+    1524:	48 89 c7             	mov    %rax,%rdi
+    1527:	e8 7b f9 ff ff       	call   ea7 <clockns>
+    152c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1530:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1534:	48 c1 e8 09          	shr    $0x9,%rax
+    1538:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    153f:	b8 44 00 
+    1542:	48 f7 e2             	mul    %rdx
+    1545:	48 89 d0             	mov    %rdx,%rax
+    1548:	48 c1 e8 0b          	shr    $0xb,%rax
+    154c:	48 89 c2             	mov    %rax,%rdx
+    154f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1553:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1556:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    155a:	48 89 c8             	mov    %rcx,%rax
+    155d:	48 c1 e8 09          	shr    $0x9,%rax
+    1561:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1568:	b8 44 00 
+    156b:	48 f7 e2             	mul    %rdx
+    156e:	48 89 d0             	mov    %rdx,%rax
+    1571:	48 c1 e8 0b          	shr    $0xb,%rax
+    1575:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    157c:	48 89 c8             	mov    %rcx,%rax
+    157f:	48 29 d0             	sub    %rdx,%rax
+    1582:	48 89 c2             	mov    %rax,%rdx
+    1585:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1589:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    158d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1592:	c9                   	leave
+    1593:	c3                   	ret
+
+0000000000001594 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1594:	55                   	push   %rbp
+    1595:	48 89 e5             	mov    %rsp,%rbp
+    1598:	48 83 ec 10          	sub    $0x10,%rsp
+    159c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    15a0:	eb 11                	jmp    15b3 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    15a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15a6:	be 02 00 00 00       	mov    $0x2,%esi
+    15ab:	48 89 c7             	mov    %rax,%rdi
+    15ae:	e8 6c 04 00 00       	call   1a1f <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    15b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15b7:	b8 02 00 00 00       	mov    $0x2,%eax
+    15bc:	87 02                	xchg   %eax,(%rdx)
+    15be:	85 c0                	test   %eax,%eax
+    15c0:	75 e0                	jne    15a2 <mutex_wait+0xe>
+}
+    15c2:	90                   	nop
+    15c3:	90                   	nop
+    15c4:	c9                   	leave
+    15c5:	c3                   	ret
+
+00000000000015c6 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    15c6:	55                   	push   %rbp
+    15c7:	48 89 e5             	mov    %rsp,%rbp
+    15ca:	48 83 ec 20          	sub    $0x20,%rsp
+    15ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    15d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    15d9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    15dd:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    15e1:	8b 02                	mov    (%rdx),%eax
+    15e3:	b9 01 00 00 00       	mov    $0x1,%ecx
+    15e8:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    15ec:	89 c1                	mov    %eax,%ecx
+    15ee:	0f 94 c0             	sete   %al
+    15f1:	84 c0                	test   %al,%al
+    15f3:	75 02                	jne    15f7 <mutex_lock+0x31>
+    15f5:	89 0a                	mov    %ecx,(%rdx)
+    15f7:	83 f0 01             	xor    $0x1,%eax
+    15fa:	84 c0                	test   %al,%al
+    15fc:	74 0c                	je     160a <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    15fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1602:	48 89 c7             	mov    %rax,%rdi
+    1605:	e8 8a ff ff ff       	call   1594 <mutex_wait>
+}
+    160a:	90                   	nop
+    160b:	c9                   	leave
+    160c:	c3                   	ret
+
+000000000000160d <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    160d:	55                   	push   %rbp
+    160e:	48 89 e5             	mov    %rsp,%rbp
+    1611:	48 83 ec 10          	sub    $0x10,%rsp
+    1615:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    161d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1622:	87 10                	xchg   %edx,(%rax)
+    1624:	83 fa 02             	cmp    $0x2,%edx
+    1627:	75 11                	jne    163a <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1629:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    162d:	be 01 00 00 00       	mov    $0x1,%esi
+    1632:	48 89 c7             	mov    %rax,%rdi
+    1635:	e8 f0 03 00 00       	call   1a2a <futex_wake>
+}
+    163a:	90                   	nop
+    163b:	c9                   	leave
+    163c:	c3                   	ret
+
+000000000000163d <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    163d:	55                   	push   %rbp
+    163e:	48 89 e5             	mov    %rsp,%rbp
+    1641:	48 83 ec 20          	sub    $0x20,%rsp
+    1645:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1649:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    164d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1651:	48 83 c0 04          	add    $0x4,%rax
+    1655:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    165d:	8b 00                	mov    (%rax),%eax
+    165f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1662:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1666:	48 89 c7             	mov    %rax,%rdi
+    1669:	e8 9f ff ff ff       	call   160d <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    166e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1672:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1675:	89 d6                	mov    %edx,%esi
+    1677:	48 89 c7             	mov    %rax,%rdi
+    167a:	e8 a0 03 00 00       	call   1a1f <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    167f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1683:	48 83 c0 04          	add    $0x4,%rax
+    1687:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    168b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    168f:	48 89 c7             	mov    %rax,%rdi
+    1692:	e8 fd fe ff ff       	call   1594 <mutex_wait>
+}
+    1697:	90                   	nop
+    1698:	c9                   	leave
+    1699:	c3                   	ret
+
+000000000000169a <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    169a:	55                   	push   %rbp
+    169b:	48 89 e5             	mov    %rsp,%rbp
+    169e:	48 83 ec 10          	sub    $0x10,%rsp
+    16a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    16a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16aa:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    16ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b2:	48 83 c0 04          	add    $0x4,%rax
+    16b6:	8b 00                	mov    (%rax),%eax
+    16b8:	85 c0                	test   %eax,%eax
+    16ba:	7e 11                	jle    16cd <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    16bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16c0:	be 01 00 00 00       	mov    $0x1,%esi
+    16c5:	48 89 c7             	mov    %rax,%rdi
+    16c8:	e8 5d 03 00 00       	call   1a2a <futex_wake>
+}
+    16cd:	90                   	nop
+    16ce:	c9                   	leave
+    16cf:	c3                   	ret
+
+00000000000016d0 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    16d0:	55                   	push   %rbp
+    16d1:	48 89 e5             	mov    %rsp,%rbp
+    16d4:	48 83 ec 10          	sub    $0x10,%rsp
+    16d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    16dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e0:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    16e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e8:	48 83 c0 04          	add    $0x4,%rax
+    16ec:	8b 00                	mov    (%rax),%eax
+    16ee:	85 c0                	test   %eax,%eax
+    16f0:	7e 11                	jle    1703 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    16f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f6:	be 00 00 00 40       	mov    $0x40000000,%esi
+    16fb:	48 89 c7             	mov    %rax,%rdi
+    16fe:	e8 27 03 00 00       	call   1a2a <futex_wake>
+}
+    1703:	90                   	nop
+    1704:	c9                   	leave
+    1705:	c3                   	ret
+
+0000000000001706 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1706:	55                   	push   %rbp
+    1707:	48 89 e5             	mov    %rsp,%rbp
+    170a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    170e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1711:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1715:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1719:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    171d:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1721:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1725:	8b 40 04             	mov    0x4(%rax),%eax
+    1728:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    172b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    172f:	8b 00                	mov    (%rax),%eax
+    1731:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1734:	29 c2                	sub    %eax,%edx
+    1736:	83 fa 1f             	cmp    $0x1f,%edx
+    1739:	76 07                	jbe    1742 <ring_push+0x3c>
+    return -1;
+    173b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1740:	eb 7e                	jmp    17c0 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1742:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1745:	83 e0 1f             	and    $0x1f,%eax
+    1748:	89 c2                	mov    %eax,%edx
+    174a:	48 89 d0             	mov    %rdx,%rax
+    174d:	48 01 c0             	add    %rax,%rax
+    1750:	48 01 d0             	add    %rdx,%rax
+    1753:	48 c1 e0 04          	shl    $0x4,%rax
+    1757:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    175b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    175f:	48 01 d0             	add    %rdx,%rax
+    1762:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1766:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    176d:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    176f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1773:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1777:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    177b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    177f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1783:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1787:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    178b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    178f:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1797:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    179b:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    179f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a3:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    17a7:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    17ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17ae:	8d 50 01             	lea    0x1(%rax),%edx
+    17b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17b5:	48 83 c0 04          	add    $0x4,%rax
+    17b9:	89 10                	mov    %edx,(%rax)
+  return 0;
+    17bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17c0:	5d                   	pop    %rbp
+    17c1:	c3                   	ret
+
+00000000000017c2 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    17c2:	55                   	push   %rbp
+    17c3:	48 89 e5             	mov    %rsp,%rbp
+    17c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    17ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d2:	8b 40 08             	mov    0x8(%rax),%eax
+    17d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    17d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17dc:	48 83 c0 0c          	add    $0xc,%rax
+    17e0:	8b 00                	mov    (%rax),%eax
+    17e2:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    17e5:	75 07                	jne    17ee <ring_pop+0x2c>
+    return -1;
+    17e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    17ec:	eb 40                	jmp    182e <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    17ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17f1:	83 e0 1f             	and    $0x1f,%eax
+    17f4:	89 c2                	mov    %eax,%edx
+    17f6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    17fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17fe:	89 d2                	mov    %edx,%edx
+    1800:	48 83 c2 61          	add    $0x61,%rdx
+    1804:	48 c1 e2 04          	shl    $0x4,%rdx
+    1808:	48 01 d0             	add    %rdx,%rax
+    180b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    180f:	48 8b 00             	mov    (%rax),%rax
+    1812:	48 89 01             	mov    %rax,(%rcx)
+    1815:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    181c:	8d 50 01             	lea    0x1(%rax),%edx
+    181f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1823:	48 83 c0 08          	add    $0x8,%rax
+    1827:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1829:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    182e:	5d                   	pop    %rbp
+    182f:	c3                   	ret
+
+0000000000001830 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1830:	b8 01 00 00 00       	mov    $0x1,%eax
+    1835:	49 89 ca             	mov    %rcx,%r10
+    1838:	0f 05                	syscall
+    183a:	c3                   	ret
+
+000000000000183b <_exit>:
+SYSCALL_(exit)
+    183b:	b8 02 00 00 00       	mov    $0x2,%eax
+    1840:	49 89 ca             	mov    %rcx,%r10
+    1843:	0f 05                	syscall
+    1845:	c3                   	ret
+
+0000000000001846 <wait>:
+SYSCALL(wait)
+    1846:	b8 03 00 00 00       	mov    $0x3,%eax
+    184b:	49 89 ca             	mov    %rcx,%r10
+    184e:	0f 05                	syscall
+    1850:	c3                   	ret
+
+0000000000001851 <pipe>:
+SYSCALL(pipe)
+    1851:	b8 04 00 00 00       	mov    $0x4,%eax
+    1856:	49 89 ca             	mov    %rcx,%r10
+    1859:	0f 05                	syscall
+    185b:	c3                   	ret
+
+000000000000185c <read>:
+SYSCALL(read)
+    185c:	b8 05 00 00 00       	mov    $0x5,%eax
+    1861:	49 89 ca             	mov    %rcx,%r10
+    1864:	0f 05                	syscall
+    1866:	c3                   	ret
+
+0000000000001867 <write>:
+SYSCALL(write)
+    1867:	b8 10 00 00 00       	mov    $0x10,%eax
+    186c:	49 89 ca             	mov    %rcx,%r10
+    186f:	0f 05                	syscall
+    1871:	c3                   	ret
+
+0000000000001872 <_close>:
+SYSCALL_(close)
+    1872:	b8 15 00 00 00       	mov    $0x15,%eax
+    1877:	49 89 ca             	mov    %rcx,%r10
+    187a:	0f 05                	syscall
+    187c:	c3                   	ret
+
+000000000000187d <kill>:
+SYSCALL(kill)
+    187d:	b8 06 00 00 00       	mov    $0x6,%eax
+    1882:	49 89 ca             	mov    %rcx,%r10
+    1885:	0f 05                	syscall
+    1887:	c3                   	ret
+
+0000000000001888 <_exec>:
+SYSCALL_(exec)
+    1888:	b8 07 00 00 00       	mov    $0x7,%eax
+    188d:	49 89 ca             	mov    %rcx,%r10
+    1890:	0f 05                	syscall
+    1892:	c3                   	ret
+
+0000000000001893 <open>:
+SYSCALL(open)
+    1893:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1898:	49 89 ca             	mov    %rcx,%r10
+    189b:	0f 05                	syscall
+    189d:	c3                   	ret
+
+000000000000189e <mknod>:
+SYSCALL(mknod)
+    189e:	b8 11 00 00 00       	mov    $0x11,%eax
+    18a3:	49 89 ca             	mov    %rcx,%r10
+    18a6:	0f 05                	syscall
+    18a8:	c3                   	ret
+
+00000000000018a9 <unlink>:
+SYSCALL(unlink)
+    18a9:	b8 12 00 00 00       	mov    $0x12,%eax
+    18ae:	49 89 ca             	mov    %rcx,%r10
+    18b1:	0f 05                	syscall
+    18b3:	c3                   	ret
+
+00000000000018b4 <fstat>:
+SYSCALL(fstat)
+    18b4:	b8 08 00 00 00       	mov    $0x8,%eax
+    18b9:	49 89 ca             	mov    %rcx,%r10
+    18bc:	0f 05                	syscall
+    18be:	c3                   	ret
+
+00000000000018bf <link>:
+SYSCALL(link)
+    18bf:	b8 13 00 00 00       	mov    $0x13,%eax
+    18c4:	49 89 ca             	mov    %rcx,%r10
+    18c7:	0f 05                	syscall
+    18c9:	c3                   	ret
+
+00000000000018ca <mkdir>:
+SYSCALL(mkdir)
+    18ca:	b8 14 00 00 00       	mov    $0x14,%eax
+    18cf:	49 89 ca             	mov    %rcx,%r10
+    18d2:	0f 05                	syscall
+    18d4:	c3                   	ret
+
+00000000000018d5 <chdir>:
+SYSCALL(chdir)
+    18d5:	b8 09 00 00 00       	mov    $0x9,%eax
+    18da:	49 89 ca             	mov    %rcx,%r10
+    18dd:	0f 05                	syscall
+    18df:	c3                   	ret
+
+00000000000018e0 <dup>:
+SYSCALL(dup)
+    18e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+    18e5:	49 89 ca             	mov    %rcx,%r10
+    18e8:	0f 05                	syscall
+    18ea:	c3                   	ret
+
+00000000000018eb <getpid>:
+SYSCALL(getpid)
+    18eb:	b8 0b 00 00 00       	mov    $0xb,%eax
+    18f0:	49 89 ca             	mov    %rcx,%r10
+    18f3:	0f 05                	syscall
+    18f5:	c3                   	ret
+
+00000000000018f6 <sbrk>:
+SYSCALL(sbrk)
+    18f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+    18fb:	49 89 ca             	mov    %rcx,%r10
+    18fe:	0f 05                	syscall
+    1900:	c3                   	ret
+
+0000000000001901 <sleep>:
+SYSCALL(sleep)
+    1901:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1906:	49 89 ca             	mov    %rcx,%r10
+    1909:	0f 05                	syscall
+    190b:	c3                   	ret
+
+000000000000190c <uptime>:
+SYSCALL(uptime)
+    190c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1911:	49 89 ca             	mov    %rcx,%r10
+    1914:	0f 05                	syscall
+    1916:	c3                   	ret
+
+0000000000001917 <sysinfo>:
+SYSCALL(sysinfo)
+    1917:	b8 16 00 00 00       	mov    $0x16,%eax
+    191c:	49 89 ca             	mov    %rcx,%r10
+    191f:	0f 05                	syscall
+    1921:	c3                   	ret
+
+0000000000001922 <crashn>:
+SYSCALL(crashn)
+    1922:	b8 17 00 00 00       	mov    $0x17,%eax
+    1927:	49 89 ca             	mov    %rcx,%r10
+    192a:	0f 05                	syscall
+    192c:	c3                   	ret
+
+000000000000192d <mmap>:
+SYSCALL(mmap)
+    192d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1932:	49 89 ca             	mov    %rcx,%r10
+    1935:	0f 05                	syscall
+    1937:	c3                   	ret
+
+0000000000001938 <munmap>:
+SYSCALL(munmap)
+    1938:	b8 19 00 00 00       	mov    $0x19,%eax
+    193d:	49 89 ca             	mov    %rcx,%r10
+    1940:	0f 05                	syscall
+    1942:	c3                   	ret
+
+0000000000001943 <nice>:
+SYSCALL(nice)
+    1943:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1948:	49 89 ca             	mov    %rcx,%r10
+    194b:	0f 05                	syscall
+    194d:	c3                   	ret
+
+000000000000194e <_spawn>:
+SYSCALL_(spawn)
+    194e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1953:	49 89 ca             	mov    %rcx,%r10
+    1956:	0f 05                	syscall
+    1958:	c3                   	ret
+
+0000000000001959 <pread>:
+SYSCALL(pread)
+    1959:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    195e:	49 89 ca             	mov    %rcx,%r10
+    1961:	0f 05                	syscall
+    1963:	c3                   	ret
+
+0000000000001964 <pwrite>:
+SYSCALL(pwrite)
+    1964:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1969:	49 89 ca             	mov    %rcx,%r10
+    196c:	0f 05                	syscall
+    196e:	c3                   	ret
+
+000000000000196f <readv>:
+SYSCALL(readv)
+    196f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1974:	49 89 ca             	mov    %rcx,%r10
+    1977:	0f 05                	syscall
+    1979:	c3                   	ret
+
+000000000000197a <writev>:
+SYSCALL(writev)
+    197a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    197f:	49 89 ca             	mov    %rcx,%r10
+    1982:	0f 05                	syscall
+    1984:	c3                   	ret
+
+0000000000001985 <sendfile>:
+SYSCALL(sendfile)
+    1985:	b8 20 00 00 00       	mov    $0x20,%eax
+    198a:	49 89 ca             	mov    %rcx,%r10
+    198d:	0f 05                	syscall
+    198f:	c3                   	ret
+
+0000000000001990 <splice>:
+SYSCALL(splice)
+    1990:	b8 21 00 00 00       	mov    $0x21,%eax
+    1995:	49 89 ca             	mov    %rcx,%r10
+    1998:	0f 05                	syscall
+    199a:	c3                   	ret
+
+000000000000199b <poll>:
+SYSCALL(poll)
+    199b:	b8 22 00 00 00       	mov    $0x22,%eax
+    19a0:	49 89 ca             	mov    %rcx,%r10
+    19a3:	0f 05                	syscall
+    19a5:	c3                   	ret
+
+00000000000019a6 <fsync>:
+SYSCALL(fsync)
+    19a6:	b8 23 00 00 00       	mov    $0x23,%eax
+    19ab:	49 89 ca             	mov    %rcx,%r10
+    19ae:	0f 05                	syscall
+    19b0:	c3                   	ret
+
+00000000000019b1 <fdatasync>:
+SYSCALL(fdatasync)
+    19b1:	b8 24 00 00 00       	mov    $0x24,%eax
+    19b6:	49 89 ca             	mov    %rcx,%r10
+    19b9:	0f 05                	syscall
+    19bb:	c3                   	ret
+
+00000000000019bc <lockstat>:
+SYSCALL(lockstat)
+    19bc:	b8 25 00 00 00       	mov    $0x25,%eax
+    19c1:	49 89 ca             	mov    %rcx,%r10
+    19c4:	0f 05                	syscall
+    19c6:	c3                   	ret
+
+00000000000019c7 <syscallstat>:
+SYSCALL(syscallstat)
+    19c7:	b8 26 00 00 00       	mov    $0x26,%eax
+    19cc:	49 89 ca             	mov    %rcx,%r10
+    19cf:	0f 05                	syscall
+    19d1:	c3                   	ret
+
+00000000000019d2 <trace>:
+SYSCALL(trace)
+    19d2:	b8 27 00 00 00       	mov    $0x27,%eax
+    19d7:	49 89 ca             	mov    %rcx,%r10
+    19da:	0f 05                	syscall
+    19dc:	c3                   	ret
+
+00000000000019dd <profile>:
+SYSCALL(profile)
+    19dd:	b8 28 00 00 00       	mov    $0x28,%eax
+    19e2:	49 89 ca             	mov    %rcx,%r10
+    19e5:	0f 05                	syscall
+    19e7:	c3                   	ret
+
+00000000000019e8 <cycles>:
+SYSCALL(cycles)
+    19e8:	b8 29 00 00 00       	mov    $0x29,%eax
+    19ed:	49 89 ca             	mov    %rcx,%r10
+    19f0:	0f 05                	syscall
+    19f2:	c3                   	ret
+
+00000000000019f3 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    19f3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    19f8:	49 89 ca             	mov    %rcx,%r10
+    19fb:	0f 05                	syscall
+    19fd:	c3                   	ret
+
+00000000000019fe <consmode>:
+SYSCALL(consmode)
+    19fe:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1a03:	49 89 ca             	mov    %rcx,%r10
+    1a06:	0f 05                	syscall
+    1a08:	c3                   	ret
+
+0000000000001a09 <clone>:
+SYSCALL(clone)
+    1a09:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1a0e:	49 89 ca             	mov    %rcx,%r10
+    1a11:	0f 05                	syscall
+    1a13:	c3                   	ret
+
+0000000000001a14 <join>:
+SYSCALL(join)
+    1a14:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1a19:	49 89 ca             	mov    %rcx,%r10
+    1a1c:	0f 05                	syscall
+    1a1e:	c3                   	ret
+
+0000000000001a1f <futex_wait>:
+SYSCALL(futex_wait)
+    1a1f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1a24:	49 89 ca             	mov    %rcx,%r10
+    1a27:	0f 05                	syscall
+    1a29:	c3                   	ret
+
+0000000000001a2a <futex_wake>:
+SYSCALL(futex_wake)
+    1a2a:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1a2f:	49 89 ca             	mov    %rcx,%r10
+    1a32:	0f 05                	syscall
+    1a34:	c3                   	ret
+
+0000000000001a35 <shmget>:
+SYSCALL(shmget)
+    1a35:	b8 30 00 00 00       	mov    $0x30,%eax
+    1a3a:	49 89 ca             	mov    %rcx,%r10
+    1a3d:	0f 05                	syscall
+    1a3f:	c3                   	ret
+
+0000000000001a40 <shmat>:
+SYSCALL(shmat)
+    1a40:	b8 31 00 00 00       	mov    $0x31,%eax
+    1a45:	49 89 ca             	mov    %rcx,%r10
+    1a48:	0f 05                	syscall
+    1a4a:	c3                   	ret
+
+0000000000001a4b <shmdt>:
+SYSCALL(shmdt)
+    1a4b:	b8 32 00 00 00       	mov    $0x32,%eax
+    1a50:	49 89 ca             	mov    %rcx,%r10
+    1a53:	0f 05                	syscall
+    1a55:	c3                   	ret
+
+0000000000001a56 <ring_setup>:
+SYSCALL(ring_setup)
+    1a56:	b8 33 00 00 00       	mov    $0x33,%eax
+    1a5b:	49 89 ca             	mov    %rcx,%r10
+    1a5e:	0f 05                	syscall
+    1a60:	c3                   	ret
+
+0000000000001a61 <ring_enter>:
+SYSCALL(ring_enter)
+    1a61:	b8 34 00 00 00       	mov    $0x34,%eax
+    1a66:	49 89 ca             	mov    %rcx,%r10
+    1a69:	0f 05                	syscall
+    1a6b:	c3                   	ret
+
+0000000000001a6c <getdents>:
+SYSCALL(getdents)
+    1a6c:	b8 35 00 00 00       	mov    $0x35,%eax
+    1a71:	49 89 ca             	mov    %rcx,%r10
+    1a74:	0f 05                	syscall
+    1a76:	c3                   	ret
+
+0000000000001a77 <fstatat>:
+SYSCALL(fstatat)
+    1a77:	b8 36 00 00 00       	mov    $0x36,%eax
+    1a7c:	49 89 ca             	mov    %rcx,%r10
+    1a7f:	0f 05                	syscall
+    1a81:	c3                   	ret
+
+0000000000001a82 <clone_file>:
+SYSCALL(clone_file)
+    1a82:	b8 37 00 00 00       	mov    $0x37,%eax
+    1a87:	49 89 ca             	mov    %rcx,%r10
+    1a8a:	0f 05                	syscall
+    1a8c:	c3                   	ret
+
+0000000000001a8d <fpunch>:
+SYSCALL(fpunch)
+    1a8d:	b8 38 00 00 00       	mov    $0x38,%eax
+    1a92:	49 89 ca             	mov    %rcx,%r10
+    1a95:	0f 05                	syscall
+    1a97:	c3                   	ret
+
+0000000000001a98 <defrag>:
+SYSCALL(defrag)
+    1a98:	b8 39 00 00 00       	mov    $0x39,%eax
+    1a9d:	49 89 ca             	mov    %rcx,%r10
+    1aa0:	0f 05                	syscall
+    1aa2:	c3                   	ret
+
+0000000000001aa3 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1aa3:	55                   	push   %rbp
+    1aa4:	48 89 e5             	mov    %rsp,%rbp
+    1aa7:	48 83 ec 20          	sub    $0x20,%rsp
+    1aab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1aaf:	bf 00 00 00 00       	mov    $0x0,%edi
+    1ab4:	e8 3d fe ff ff       	call   18f6 <sbrk>
+    1ab9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1abd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ac1:	48 f7 d8             	neg    %rax
+    1ac4:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1ac9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1acd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ad1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad5:	48 01 c2             	add    %rax,%rdx
+    1ad8:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1add:	48 39 c2             	cmp    %rax,%rdx
+    1ae0:	73 1e                	jae    1b00 <morecore+0x5d>
+    1ae2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ae6:	89 c2                	mov    %eax,%edx
+    1ae8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aec:	01 d0                	add    %edx,%eax
+    1aee:	89 c7                	mov    %eax,%edi
+    1af0:	e8 01 fe ff ff       	call   18f6 <sbrk>
+    1af5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1af9:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1afe:	75 07                	jne    1b07 <morecore+0x64>
+    return 0;
+    1b00:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b05:	eb 27                	jmp    1b2e <morecore+0x8b>
+  stats.heap += n + pad;
+    1b07:	48 8b 05 82 36 00 00 	mov    0x3682(%rip),%rax        # 5190 <stats+0x50>
+    1b0e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1b12:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b16:	48 01 ca             	add    %rcx,%rdx
+    1b19:	48 01 d0             	add    %rdx,%rax
+    1b1c:	48 89 05 6d 36 00 00 	mov    %rax,0x366d(%rip)        # 5190 <stats+0x50>
+  return p + pad;
+    1b23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b2b:	48 01 d0             	add    %rdx,%rax
+}
+    1b2e:	c9                   	leave
+    1b2f:	c3                   	ret
+
+0000000000001b30 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1b30:	55                   	push   %rbp
+    1b31:	48 89 e5             	mov    %rsp,%rbp
+    1b34:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1b38:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1b3c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1b43:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1b44:	48 8d 05 d5 35 00 00 	lea    0x35d5(%rip),%rax        # 5120 <runs>
+    1b4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b4f:	eb 1a                	jmp    1b6b <pagefree+0x3b>
+    prev = *rp;
+    1b51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b55:	48 8b 00             	mov    (%rax),%rax
+    1b58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1b5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b60:	48 8b 00             	mov    (%rax),%rax
+    1b63:	48 83 c0 08          	add    $0x8,%rax
+    1b67:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b6f:	48 8b 00             	mov    (%rax),%rax
+    1b72:	48 85 c0             	test   %rax,%rax
+    1b75:	74 0d                	je     1b84 <pagefree+0x54>
+    1b77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b7b:	48 8b 00             	mov    (%rax),%rax
+    1b7e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1b82:	72 cd                	jb     1b51 <pagefree+0x21>
+  r = (struct run *)p;
+    1b84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b88:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1b8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b90:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1b94:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1b97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b9b:	48 8b 10             	mov    (%rax),%rdx
+    1b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ba2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1ba6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1baa:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bae:	48 85 c0             	test   %rax,%rax
+    1bb1:	74 48                	je     1bfb <pagefree+0xcb>
+    1bb3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1bb7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1bbb:	48 01 c2             	add    %rax,%rdx
+    1bbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bc2:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bc6:	48 39 c2             	cmp    %rax,%rdx
+    1bc9:	75 30                	jne    1bfb <pagefree+0xcb>
+    r->size += r->next->size;
+    1bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bcf:	48 8b 10             	mov    (%rax),%rdx
+    1bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bd6:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bda:	48 8b 00             	mov    (%rax),%rax
+    1bdd:	48 01 c2             	add    %rax,%rdx
+    1be0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1be4:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1be7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1beb:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bef:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1bf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bf7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1bfb:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1c00:	74 46                	je     1c48 <pagefree+0x118>
+    1c02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c06:	48 8b 10             	mov    (%rax),%rdx
+    1c09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c0d:	48 01 d0             	add    %rdx,%rax
+    1c10:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1c14:	75 32                	jne    1c48 <pagefree+0x118>
+    prev->size += r->size;
+    1c16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c1a:	48 8b 10             	mov    (%rax),%rdx
+    1c1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c21:	48 8b 00             	mov    (%rax),%rax
+    1c24:	48 01 c2             	add    %rax,%rdx
+    1c27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c2b:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1c2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c32:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1c36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c3a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1c3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1c46:	eb 0c                	jmp    1c54 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1c48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c4c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c50:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1c53:	90                   	nop
+    1c54:	90                   	nop
+    1c55:	5d                   	pop    %rbp
+    1c56:	c3                   	ret
+
+0000000000001c57 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1c57:	55                   	push   %rbp
+    1c58:	48 89 e5             	mov    %rsp,%rbp
+    1c5b:	48 83 ec 40          	sub    $0x40,%rsp
+    1c5f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1c63:	48 8d 05 b6 34 00 00 	lea    0x34b6(%rip),%rax        # 5120 <runs>
+    1c6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c6e:	eb 66                	jmp    1cd6 <pagealloc+0x7f>
+    if (r->size == n) {
+    1c70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c74:	48 8b 00             	mov    (%rax),%rax
+    1c77:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1c7b:	75 18                	jne    1c95 <pagealloc+0x3e>
+      *rp = r->next;
+    1c7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c81:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c89:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1c8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c90:	e9 ca 00 00 00       	jmp    1d5f <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1c95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c99:	48 8b 00             	mov    (%rax),%rax
+    1c9c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1ca0:	73 28                	jae    1cca <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1ca2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca6:	48 8b 00             	mov    (%rax),%rax
+    1ca9:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1cad:	48 89 c2             	mov    %rax,%rdx
+    1cb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb4:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1cb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cbb:	48 8b 10             	mov    (%rax),%rdx
+    1cbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cc2:	48 01 d0             	add    %rdx,%rax
+    1cc5:	e9 95 00 00 00       	jmp    1d5f <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1cca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cce:	48 83 c0 08          	add    $0x8,%rax
+    1cd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cda:	48 8b 00             	mov    (%rax),%rax
+    1cdd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ce1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ce6:	75 88                	jne    1c70 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1ce8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1cec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1cf0:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1cf7:	00 
+    1cf8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1cfc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d00:	48 39 c2             	cmp    %rax,%rdx
+    1d03:	48 0f 43 c2          	cmovae %rdx,%rax
+    1d07:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1d0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d0f:	48 89 c7             	mov    %rax,%rdi
+    1d12:	e8 8c fd ff ff       	call   1aa3 <morecore>
+    1d17:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1d1b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1d20:	75 07                	jne    1d29 <pagealloc+0xd2>
+    return 0;
+    1d22:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d27:	eb 36                	jmp    1d5f <pagealloc+0x108>
+  if (m > n)
+    1d29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d2d:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1d31:	73 1a                	jae    1d4d <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1d33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d37:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1d3b:	48 89 c2             	mov    %rax,%rdx
+    1d3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d42:	48 89 d6             	mov    %rdx,%rsi
+    1d45:	48 89 c7             	mov    %rax,%rdi
+    1d48:	e8 e3 fd ff ff       	call   1b30 <pagefree>
+  return p + m - n;
+    1d4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d51:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1d55:	48 89 c2             	mov    %rax,%rdx
+    1d58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d5c:	48 01 d0             	add    %rdx,%rax
+}
+    1d5f:	c9                   	leave
+    1d60:	c3                   	ret
+
+0000000000001d61 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1d61:	55                   	push   %rbp
+    1d62:	48 89 e5             	mov    %rsp,%rbp
+    1d65:	48 83 ec 30          	sub    $0x30,%rsp
+    1d69:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1d6c:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1d71:	e8 e1 fe ff ff       	call   1c57 <pagealloc>
+    1d76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d7a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1d7f:	75 0a                	jne    1d8b <refill+0x2a>
+    return -1;
+    1d81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d86:	e9 da 00 00 00       	jmp    1e65 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1d8b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1d92:	00 
+    1d93:	e9 ba 00 00 00       	jmp    1e52 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1d98:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1da0:	48 01 d0             	add    %rdx,%rax
+    1da3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1da7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1daa:	ba 20 00 00 00       	mov    $0x20,%edx
+    1daf:	89 c1                	mov    %eax,%ecx
+    1db1:	48 d3 e2             	shl    %cl,%rdx
+    1db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1db8:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1dbb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dbe:	48 63 d0             	movslq %eax,%rdx
+    1dc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dc5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1dc9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dcc:	48 98                	cltq
+    1dce:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1dd5:	00 
+    1dd6:	48 8d 05 03 33 00 00 	lea    0x3303(%rip),%rax        # 50e0 <freelist>
+    1ddd:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1de1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1de5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1de9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dec:	48 98                	cltq
+    1dee:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1df5:	00 
+    1df6:	48 8d 15 e3 32 00 00 	lea    0x32e3(%rip),%rdx        # 50e0 <freelist>
+    1dfd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e01:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1e05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e08:	48 98                	cltq
+    1e0a:	48 83 c0 08          	add    $0x8,%rax
+    1e0e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e15:	00 
+    1e16:	48 8d 05 27 33 00 00 	lea    0x3327(%rip),%rax        # 5144 <stats+0x4>
+    1e1d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e20:	8d 48 01             	lea    0x1(%rax),%ecx
+    1e23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e26:	48 98                	cltq
+    1e28:	48 83 c0 08          	add    $0x8,%rax
+    1e2c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e33:	00 
+    1e34:	48 8d 05 09 33 00 00 	lea    0x3309(%rip),%rax        # 5144 <stats+0x4>
+    1e3b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1e3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e41:	ba 20 00 00 00       	mov    $0x20,%edx
+    1e46:	89 c1                	mov    %eax,%ecx
+    1e48:	48 d3 e2             	shl    %cl,%rdx
+    1e4b:	48 89 d0             	mov    %rdx,%rax
+    1e4e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1e52:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1e59:	00 
+    1e5a:	0f 86 38 ff ff ff    	jbe    1d98 <refill+0x37>
+  }
+  return 0;
+    1e60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1e65:	c9                   	leave
+    1e66:	c3                   	ret
+
+0000000000001e67 <malloc>:
+
+void *malloc(uint nbytes) {
+    1e67:	55                   	push   %rbp
+    1e68:	48 89 e5             	mov    %rsp,%rbp
+    1e6b:	48 83 ec 30          	sub    $0x30,%rsp
+    1e6f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1e72:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e75:	48 83 c0 10          	add    $0x10,%rax
+    1e79:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1e7d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1e84:	eb 04                	jmp    1e8a <malloc+0x23>
+    1e86:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1e8a:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1e8e:	7f 16                	jg     1ea6 <malloc+0x3f>
+    1e90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e93:	ba 20 00 00 00       	mov    $0x20,%edx
+    1e98:	89 c1                	mov    %eax,%ecx
+    1e9a:	48 d3 e2             	shl    %cl,%rdx
+    1e9d:	48 89 d0             	mov    %rdx,%rax
+    1ea0:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1ea4:	72 e0                	jb     1e86 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1ea6:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1eaa:	75 7d                	jne    1f29 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1eac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eb0:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1eb6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1ebc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1ec0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ec4:	48 89 c7             	mov    %rax,%rdi
+    1ec7:	e8 8b fd ff ff       	call   1c57 <pagealloc>
+    1ecc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1ed0:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1ed5:	75 0a                	jne    1ee1 <malloc+0x7a>
+      return 0;
+    1ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1edc:	e9 2c 01 00 00       	jmp    200d <malloc+0x1a6>
+    h->size = n;
+    1ee1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ee5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ee9:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1eec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ef0:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1ef7:	00 
+    stats.inuse[LARGE]++;
+    1ef8:	8b 05 62 32 00 00    	mov    0x3262(%rip),%eax        # 5160 <stats+0x20>
+    1efe:	83 c0 01             	add    $0x1,%eax
+    1f01:	89 05 59 32 00 00    	mov    %eax,0x3259(%rip)        # 5160 <stats+0x20>
+    stats.large += n;
+    1f07:	48 8b 15 7a 32 00 00 	mov    0x327a(%rip),%rdx        # 5188 <stats+0x48>
+    1f0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f12:	48 01 d0             	add    %rdx,%rax
+    1f15:	48 89 05 6c 32 00 00 	mov    %rax,0x326c(%rip)        # 5188 <stats+0x48>
+    return h + 1;
+    1f1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f20:	48 83 c0 10          	add    $0x10,%rax
+    1f24:	e9 e4 00 00 00       	jmp    200d <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1f29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f2c:	48 98                	cltq
+    1f2e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f35:	00 
+    1f36:	48 8d 05 a3 31 00 00 	lea    0x31a3(%rip),%rax        # 50e0 <freelist>
+    1f3d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f41:	48 85 c0             	test   %rax,%rax
+    1f44:	75 18                	jne    1f5e <malloc+0xf7>
+    1f46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f49:	89 c7                	mov    %eax,%edi
+    1f4b:	e8 11 fe ff ff       	call   1d61 <refill>
+    1f50:	85 c0                	test   %eax,%eax
+    1f52:	79 0a                	jns    1f5e <malloc+0xf7>
+    return 0;
+    1f54:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f59:	e9 af 00 00 00       	jmp    200d <malloc+0x1a6>
+  b = freelist[c];
+    1f5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f61:	48 98                	cltq
+    1f63:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f6a:	00 
+    1f6b:	48 8d 05 6e 31 00 00 	lea    0x316e(%rip),%rax        # 50e0 <freelist>
+    1f72:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f76:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1f7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f7e:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1f82:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1f85:	48 63 d2             	movslq %edx,%rdx
+    1f88:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1f8f:	00 
+    1f90:	48 8d 15 49 31 00 00 	lea    0x3149(%rip),%rdx        # 50e0 <freelist>
+    1f97:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1f9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f9e:	48 98                	cltq
+    1fa0:	48 83 c0 08          	add    $0x8,%rax
+    1fa4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fab:	00 
+    1fac:	48 8d 05 91 31 00 00 	lea    0x3191(%rip),%rax        # 5144 <stats+0x4>
+    1fb3:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1fb6:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1fb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fbc:	48 98                	cltq
+    1fbe:	48 83 c0 08          	add    $0x8,%rax
+    1fc2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fc9:	00 
+    1fca:	48 8d 05 73 31 00 00 	lea    0x3173(%rip),%rax        # 5144 <stats+0x4>
+    1fd1:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1fd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fd7:	48 98                	cltq
+    1fd9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fe0:	00 
+    1fe1:	48 8d 05 58 31 00 00 	lea    0x3158(%rip),%rax        # 5140 <stats>
+    1fe8:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1feb:	8d 48 01             	lea    0x1(%rax),%ecx
+    1fee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ff1:	48 98                	cltq
+    1ff3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ffa:	00 
+    1ffb:	48 8d 05 3e 31 00 00 	lea    0x313e(%rip),%rax        # 5140 <stats>
+    2002:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    2005:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2009:	48 83 c0 10          	add    $0x10,%rax
+}
+    200d:	c9                   	leave
+    200e:	c3                   	ret
+
+000000000000200f <free>:
+
+void free(void *ap) {
+    200f:	55                   	push   %rbp
+    2010:	48 89 e5             	mov    %rsp,%rbp
+    2013:	48 83 ec 18          	sub    $0x18,%rsp
+    2017:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    201b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2020:	0f 84 03 01 00 00    	je     2129 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    2026:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    202a:	48 83 e8 10          	sub    $0x10,%rax
+    202e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    2032:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2036:	48 8b 40 08          	mov    0x8(%rax),%rax
+    203a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    203e:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    2043:	75 42                	jne    2087 <free+0x78>
+    stats.inuse[LARGE]--;
+    2045:	8b 05 15 31 00 00    	mov    0x3115(%rip),%eax        # 5160 <stats+0x20>
+    204b:	83 e8 01             	sub    $0x1,%eax
+    204e:	89 05 0c 31 00 00    	mov    %eax,0x310c(%rip)        # 5160 <stats+0x20>
+    stats.large -= b->h.size;
+    2054:	48 8b 15 2d 31 00 00 	mov    0x312d(%rip),%rdx        # 5188 <stats+0x48>
+    205b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    205f:	48 8b 00             	mov    (%rax),%rax
+    2062:	48 29 c2             	sub    %rax,%rdx
+    2065:	48 89 15 1c 31 00 00 	mov    %rdx,0x311c(%rip)        # 5188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    206c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2070:	48 8b 10             	mov    (%rax),%rdx
+    2073:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2077:	48 89 d6             	mov    %rdx,%rsi
+    207a:	48 89 c7             	mov    %rax,%rdi
+    207d:	e8 ae fa ff ff       	call   1b30 <pagefree>
+    return;
+    2082:	e9 a3 00 00 00       	jmp    212a <free+0x11b>
+  }
+  b->next = freelist[c];
+    2087:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    208b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2092:	00 
+    2093:	48 8d 05 46 30 00 00 	lea    0x3046(%rip),%rax        # 50e0 <freelist>
+    209a:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    209e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20a2:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    20a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20aa:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    20b1:	00 
+    20b2:	48 8d 15 27 30 00 00 	lea    0x3027(%rip),%rdx        # 50e0 <freelist>
+    20b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20bd:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    20c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20c5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20cc:	00 
+    20cd:	48 8d 05 6c 30 00 00 	lea    0x306c(%rip),%rax        # 5140 <stats>
+    20d4:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    20d7:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    20da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20de:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20e5:	00 
+    20e6:	48 8d 05 53 30 00 00 	lea    0x3053(%rip),%rax        # 5140 <stats>
+    20ed:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    20f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20f4:	48 83 c0 08          	add    $0x8,%rax
+    20f8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20ff:	00 
+    2100:	48 8d 05 3d 30 00 00 	lea    0x303d(%rip),%rax        # 5144 <stats+0x4>
+    2107:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    210a:	8d 48 01             	lea    0x1(%rax),%ecx
+    210d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2111:	48 83 c0 08          	add    $0x8,%rax
+    2115:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    211c:	00 
+    211d:	48 8d 05 20 30 00 00 	lea    0x3020(%rip),%rax        # 5144 <stats+0x4>
+    2124:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    2127:	eb 01                	jmp    212a <free+0x11b>
+    return;
+    2129:	90                   	nop
+}
+    212a:	c9                   	leave
+    212b:	c3                   	ret
+
+000000000000212c <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    212c:	55                   	push   %rbp
+    212d:	48 89 e5             	mov    %rsp,%rbp
+    2130:	48 83 ec 30          	sub    $0x30,%rsp
+    2134:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    2137:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    213a:	48 8d 15 37 05 00 00 	lea    0x537(%rip),%rdx        # 2678 <benchreport+0x424>
+    2141:	48 89 d6             	mov    %rdx,%rsi
+    2144:	89 c7                	mov    %eax,%edi
+    2146:	b8 00 00 00 00       	mov    $0x0,%eax
+    214b:	e8 37 e6 ff ff       	call   787 <printf>
+  for (c = 0; c < NCLASS; c++)
+    2150:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2157:	eb 67                	jmp    21c0 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2159:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    215c:	48 98                	cltq
+    215e:	48 83 c0 08          	add    $0x8,%rax
+    2162:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2169:	00 
+    216a:	48 8d 05 d3 2f 00 00 	lea    0x2fd3(%rip),%rax        # 5144 <stats+0x4>
+    2171:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    2174:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2177:	48 98                	cltq
+    2179:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2180:	00 
+    2181:	48 8d 05 b8 2f 00 00 	lea    0x2fb8(%rip),%rax        # 5140 <stats>
+    2188:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    218b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    218e:	ba 20 00 00 00       	mov    $0x20,%edx
+    2193:	89 c1                	mov    %eax,%ecx
+    2195:	48 d3 e2             	shl    %cl,%rdx
+    2198:	48 89 d0             	mov    %rdx,%rax
+    219b:	89 c1                	mov    %eax,%ecx
+    219d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    21a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    21a3:	41 89 f9             	mov    %edi,%r9d
+    21a6:	41 89 f0             	mov    %esi,%r8d
+    21a9:	48 8d 35 df 04 00 00 	lea    0x4df(%rip),%rsi        # 268f <benchreport+0x43b>
+    21b0:	89 c7                	mov    %eax,%edi
+    21b2:	b8 00 00 00 00       	mov    $0x0,%eax
+    21b7:	e8 cb e5 ff ff       	call   787 <printf>
+  for (c = 0; c < NCLASS; c++)
+    21bc:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    21c0:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    21c4:	7e 93                	jle    2159 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    21c6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    21cd:	00 
+  for (r = runs; r; r = r->next)
+    21ce:	48 8b 05 4b 2f 00 00 	mov    0x2f4b(%rip),%rax        # 5120 <runs>
+    21d5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21d9:	eb 17                	jmp    21f2 <mallocstats+0xc6>
+    nfree += r->size;
+    21db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21df:	48 8b 00             	mov    (%rax),%rax
+    21e2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    21e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21ea:	48 8b 40 08          	mov    0x8(%rax),%rax
+    21ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21f2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    21f7:	75 e2                	jne    21db <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    21f9:	48 8b 05 90 2f 00 00 	mov    0x2f90(%rip),%rax        # 5190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2200:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2202:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2206:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    220a:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    220c:	48 8b 05 75 2f 00 00 	mov    0x2f75(%rip),%rax        # 5188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2213:	89 c1                	mov    %eax,%ecx
+    2215:	8b 15 45 2f 00 00    	mov    0x2f45(%rip),%edx        # 5160 <stats+0x20>
+    221b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    221e:	41 89 f9             	mov    %edi,%r9d
+    2221:	41 89 f0             	mov    %esi,%r8d
+    2224:	48 8d 35 75 04 00 00 	lea    0x475(%rip),%rsi        # 26a0 <benchreport+0x44c>
+    222b:	89 c7                	mov    %eax,%edi
+    222d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2232:	e8 50 e5 ff ff       	call   787 <printf>
+}
+    2237:	90                   	nop
+    2238:	c9                   	leave
+    2239:	c3                   	ret
+
+000000000000223a <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    223a:	55                   	push   %rbp
+    223b:	48 89 e5             	mov    %rsp,%rbp
+    223e:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    2242:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    2246:	48 89 c7             	mov    %rax,%rdi
+    2249:	e8 9a f7 ff ff       	call   19e8 <cycles>
+  return t;
+    224e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2252:	c9                   	leave
+    2253:	c3                   	ret
+
+0000000000002254 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    2254:	55                   	push   %rbp
+    2255:	48 89 e5             	mov    %rsp,%rbp
+    2258:	48 83 ec 30          	sub    $0x30,%rsp
+    225c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2260:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2264:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    2267:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    226b:	0f 8e 24 01 00 00    	jle    2395 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    2271:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2278:	e9 98 00 00 00       	jmp    2315 <benchreport+0xc1>
+    x = t[i];
+    227d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2280:	48 98                	cltq
+    2282:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2289:	00 
+    228a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    228e:	48 01 d0             	add    %rdx,%rax
+    2291:	48 8b 00             	mov    (%rax),%rax
+    2294:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2298:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    229b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    229e:	eb 33                	jmp    22d3 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    22a0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    22a3:	48 98                	cltq
+    22a5:	48 c1 e0 03          	shl    $0x3,%rax
+    22a9:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    22ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22b1:	48 01 d0             	add    %rdx,%rax
+    22b4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    22b7:	48 63 d2             	movslq %edx,%rdx
+    22ba:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    22c1:	00 
+    22c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    22c6:	48 01 ca             	add    %rcx,%rdx
+    22c9:	48 8b 00             	mov    (%rax),%rax
+    22cc:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    22cf:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    22d3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    22d7:	7e 1d                	jle    22f6 <benchreport+0xa2>
+    22d9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    22dc:	48 98                	cltq
+    22de:	48 c1 e0 03          	shl    $0x3,%rax
+    22e2:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    22e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22ea:	48 01 d0             	add    %rdx,%rax
+    22ed:	48 8b 00             	mov    (%rax),%rax
+    22f0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    22f4:	72 aa                	jb     22a0 <benchreport+0x4c>
+    t[j] = x;
+    22f6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    22f9:	48 98                	cltq
+    22fb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2302:	00 
+    2303:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2307:	48 01 c2             	add    %rax,%rdx
+    230a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    230e:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    2311:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2315:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2318:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    231b:	0f 8c 5c ff ff ff    	jl     227d <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    2321:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2324:	48 98                	cltq
+    2326:	48 c1 e0 03          	shl    $0x3,%rax
+    232a:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    232e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2332:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2335:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    2338:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    233b:	89 c2                	mov    %eax,%edx
+    233d:	c1 ea 1f             	shr    $0x1f,%edx
+    2340:	01 d0                	add    %edx,%eax
+    2342:	d1 f8                	sar    %eax
+    2344:	48 98                	cltq
+    2346:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    234d:	00 
+    234e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2352:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2355:	48 8b 38             	mov    (%rax),%rdi
+    2358:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    235c:	48 8b 30             	mov    (%rax),%rsi
+    235f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2362:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2366:	48 83 ec 08          	sub    $0x8,%rsp
+    236a:	51                   	push   %rcx
+    236b:	49 89 f9             	mov    %rdi,%r9
+    236e:	49 89 f0             	mov    %rsi,%r8
+    2371:	89 d1                	mov    %edx,%ecx
+    2373:	48 89 c2             	mov    %rax,%rdx
+    2376:	48 8d 05 63 03 00 00 	lea    0x363(%rip),%rax        # 26e0 <benchreport+0x48c>
+    237d:	48 89 c6             	mov    %rax,%rsi
+    2380:	bf 01 00 00 00       	mov    $0x1,%edi
+    2385:	b8 00 00 00 00       	mov    $0x0,%eax
+    238a:	e8 f8 e3 ff ff       	call   787 <printf>
+    238f:	48 83 c4 10          	add    $0x10,%rsp
+    2393:	eb 01                	jmp    2396 <benchreport+0x142>
+    return;
+    2395:	90                   	nop
+}
+    2396:	c9                   	leave
+    2397:	c3                   	ret
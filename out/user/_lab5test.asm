@@ -0,0 +1,5821 @@
+
+out/user/_lab5test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void shmtest(void);
+void clonefiletest(void);
+void punchtest(void);
+void gaptest(void);
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  mmaptest();
+       f:	e8 44 00 00 00       	call   58 <mmaptest>
+  threadtest();
+      14:	e8 28 06 00 00       	call   641 <threadtest>
+  mutextest();
+      19:	e8 d9 0a 00 00       	call   af7 <mutextest>
+  condtest();
+      1e:	e8 3a 0e 00 00       	call   e5d <condtest>
+  shmtest();
+      23:	e8 4e 10 00 00       	call   1076 <shmtest>
+  clonefiletest();
+      28:	e8 47 14 00 00       	call   1474 <clonefiletest>
+  punchtest();
+      2d:	e8 71 19 00 00       	call   19a3 <punchtest>
+  gaptest();
+      32:	e8 aa 1d 00 00       	call   1de1 <gaptest>
+  printf(stdout, "lab5 tests passed!!\n");
+      37:	8b 05 c3 5f 00 00    	mov    0x5fc3(%rip),%eax        # 6000 <stdout>
+      3d:	48 8d 15 14 41 00 00 	lea    0x4114(%rip),%rdx        # 4158 <benchreport+0x149>
+      44:	48 89 d6             	mov    %rdx,%rsi
+      47:	89 c7                	mov    %eax,%edi
+      49:	b8 00 00 00 00       	mov    $0x0,%eax
+      4e:	e8 ef 24 00 00       	call   2542 <printf>
+
+  exit();
+      53:	e8 1a 2b 00 00       	call   2b72 <exit>
+
+0000000000000058 <mmaptest>:
+}
+
+// Writes a file and maps it: the mapping holds what was written, and
+// sees later writes both to a page it has touched and to one it has
+// not.
+void mmaptest(void) {
+      58:	55                   	push   %rbp
+      59:	48 89 e5             	mov    %rsp,%rbp
+      5c:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i;
+  char *p;
+
+  printf(stdout, "mmaptest\n");
+      60:	8b 05 9a 5f 00 00    	mov    0x5f9a(%rip),%eax        # 6000 <stdout>
+      66:	48 8d 15 00 41 00 00 	lea    0x4100(%rip),%rdx        # 416d <benchreport+0x15e>
+      6d:	48 89 d6             	mov    %rdx,%rsi
+      70:	89 c7                	mov    %eax,%edi
+      72:	b8 00 00 00 00       	mov    $0x0,%eax
+      77:	e8 c6 24 00 00       	call   2542 <printf>
+  if ((fd = open("mmap.txt", O_CREATE | O_RDWR)) < 0)
+      7c:	be 02 02 00 00       	mov    $0x202,%esi
+      81:	48 8d 05 ef 40 00 00 	lea    0x40ef(%rip),%rax        # 4177 <benchreport+0x168>
+      88:	48 89 c7             	mov    %rax,%rdi
+      8b:	e8 be 35 00 00       	call   364e <open>
+      90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      93:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      97:	79 5e                	jns    f7 <mmaptest+0x9f>
+    error("create 'mmap.txt' failed");
+      99:	8b 05 61 5f 00 00    	mov    0x5f61(%rip),%eax        # 6000 <stdout>
+      9f:	ba 37 00 00 00       	mov    $0x37,%edx
+      a4:	48 8d 0d d5 40 00 00 	lea    0x40d5(%rip),%rcx        # 4180 <benchreport+0x171>
+      ab:	48 89 ce             	mov    %rcx,%rsi
+      ae:	89 c7                	mov    %eax,%edi
+      b0:	b8 00 00 00 00       	mov    $0x0,%eax
+      b5:	e8 88 24 00 00       	call   2542 <printf>
+      ba:	8b 05 40 5f 00 00    	mov    0x5f40(%rip),%eax        # 6000 <stdout>
+      c0:	48 8d 15 cb 40 00 00 	lea    0x40cb(%rip),%rdx        # 4192 <benchreport+0x183>
+      c7:	48 89 d6             	mov    %rdx,%rsi
+      ca:	89 c7                	mov    %eax,%edi
+      cc:	b8 00 00 00 00       	mov    $0x0,%eax
+      d1:	e8 6c 24 00 00       	call   2542 <printf>
+      d6:	8b 05 24 5f 00 00    	mov    0x5f24(%rip),%eax        # 6000 <stdout>
+      dc:	48 8d 15 c8 40 00 00 	lea    0x40c8(%rip),%rdx        # 41ab <benchreport+0x19c>
+      e3:	48 89 d6             	mov    %rdx,%rsi
+      e6:	89 c7                	mov    %eax,%edi
+      e8:	b8 00 00 00 00       	mov    $0x0,%eax
+      ed:	e8 50 24 00 00       	call   2542 <printf>
+      f2:	e8 7b 2a 00 00       	call   2b72 <exit>
+  for (i = 0; i < 2 * PGSIZE; i++)
+      f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      fe:	eb 3c                	jmp    13c <mmaptest+0xe4>
+    buf[i] = 'a' + i % 26;
+     100:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     103:	48 63 d0             	movslq %eax,%rdx
+     106:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     10d:	48 c1 ea 20          	shr    $0x20,%rdx
+     111:	c1 fa 03             	sar    $0x3,%edx
+     114:	89 c1                	mov    %eax,%ecx
+     116:	c1 f9 1f             	sar    $0x1f,%ecx
+     119:	29 ca                	sub    %ecx,%edx
+     11b:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     11e:	29 c8                	sub    %ecx,%eax
+     120:	89 c2                	mov    %eax,%edx
+     122:	89 d0                	mov    %edx,%eax
+     124:	83 c0 61             	add    $0x61,%eax
+     127:	89 c1                	mov    %eax,%ecx
+     129:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     12c:	48 98                	cltq
+     12e:	48 8d 15 2b 5f 00 00 	lea    0x5f2b(%rip),%rdx        # 6060 <buf>
+     135:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for (i = 0; i < 2 * PGSIZE; i++)
+     138:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     13c:	81 7d fc ff 1f 00 00 	cmpl   $0x1fff,-0x4(%rbp)
+     143:	7e bb                	jle    100 <mmaptest+0xa8>
+  if (write(fd, buf, 2 * PGSIZE) != 2 * PGSIZE)
+     145:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     148:	ba 00 20 00 00       	mov    $0x2000,%edx
+     14d:	48 8d 0d 0c 5f 00 00 	lea    0x5f0c(%rip),%rcx        # 6060 <buf>
+     154:	48 89 ce             	mov    %rcx,%rsi
+     157:	89 c7                	mov    %eax,%edi
+     159:	e8 c4 34 00 00       	call   3622 <write>
+     15e:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     163:	74 5e                	je     1c3 <mmaptest+0x16b>
+    error("write to 'mmap.txt' failed");
+     165:	8b 05 95 5e 00 00    	mov    0x5e95(%rip),%eax        # 6000 <stdout>
+     16b:	ba 3b 00 00 00       	mov    $0x3b,%edx
+     170:	48 8d 0d 09 40 00 00 	lea    0x4009(%rip),%rcx        # 4180 <benchreport+0x171>
+     177:	48 89 ce             	mov    %rcx,%rsi
+     17a:	89 c7                	mov    %eax,%edi
+     17c:	b8 00 00 00 00       	mov    $0x0,%eax
+     181:	e8 bc 23 00 00       	call   2542 <printf>
+     186:	8b 05 74 5e 00 00    	mov    0x5e74(%rip),%eax        # 6000 <stdout>
+     18c:	48 8d 15 1a 40 00 00 	lea    0x401a(%rip),%rdx        # 41ad <benchreport+0x19e>
+     193:	48 89 d6             	mov    %rdx,%rsi
+     196:	89 c7                	mov    %eax,%edi
+     198:	b8 00 00 00 00       	mov    $0x0,%eax
+     19d:	e8 a0 23 00 00       	call   2542 <printf>
+     1a2:	8b 05 58 5e 00 00    	mov    0x5e58(%rip),%eax        # 6000 <stdout>
+     1a8:	48 8d 15 fc 3f 00 00 	lea    0x3ffc(%rip),%rdx        # 41ab <benchreport+0x19c>
+     1af:	48 89 d6             	mov    %rdx,%rsi
+     1b2:	89 c7                	mov    %eax,%edi
+     1b4:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b9:	e8 84 23 00 00       	call   2542 <printf>
+     1be:	e8 af 29 00 00       	call   2b72 <exit>
+
+  if ((p = mmap(fd, 0, 2 * PGSIZE, PROT_READ)) == (char *)-1)
+     1c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1c6:	b9 01 00 00 00       	mov    $0x1,%ecx
+     1cb:	ba 00 20 00 00       	mov    $0x2000,%edx
+     1d0:	be 00 00 00 00       	mov    $0x0,%esi
+     1d5:	89 c7                	mov    %eax,%edi
+     1d7:	e8 0c 35 00 00       	call   36e8 <mmap>
+     1dc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     1e0:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     1e5:	75 5e                	jne    245 <mmaptest+0x1ed>
+    error("mmap of 'mmap.txt' failed");
+     1e7:	8b 05 13 5e 00 00    	mov    0x5e13(%rip),%eax        # 6000 <stdout>
+     1ed:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     1f2:	48 8d 0d 87 3f 00 00 	lea    0x3f87(%rip),%rcx        # 4180 <benchreport+0x171>
+     1f9:	48 89 ce             	mov    %rcx,%rsi
+     1fc:	89 c7                	mov    %eax,%edi
+     1fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     203:	e8 3a 23 00 00       	call   2542 <printf>
+     208:	8b 05 f2 5d 00 00    	mov    0x5df2(%rip),%eax        # 6000 <stdout>
+     20e:	48 8d 15 b3 3f 00 00 	lea    0x3fb3(%rip),%rdx        # 41c8 <benchreport+0x1b9>
+     215:	48 89 d6             	mov    %rdx,%rsi
+     218:	89 c7                	mov    %eax,%edi
+     21a:	b8 00 00 00 00       	mov    $0x0,%eax
+     21f:	e8 1e 23 00 00       	call   2542 <printf>
+     224:	8b 05 d6 5d 00 00    	mov    0x5dd6(%rip),%eax        # 6000 <stdout>
+     22a:	48 8d 15 7a 3f 00 00 	lea    0x3f7a(%rip),%rdx        # 41ab <benchreport+0x19c>
+     231:	48 89 d6             	mov    %rdx,%rsi
+     234:	89 c7                	mov    %eax,%edi
+     236:	b8 00 00 00 00       	mov    $0x0,%eax
+     23b:	e8 02 23 00 00       	call   2542 <printf>
+     240:	e8 2d 29 00 00       	call   2b72 <exit>
+  for (i = 0; i < PGSIZE; i++)
+     245:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     24c:	e9 b3 00 00 00       	jmp    304 <mmaptest+0x2ac>
+    if (p[i] != buf[i])
+     251:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     254:	48 63 d0             	movslq %eax,%rdx
+     257:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     25b:	48 01 d0             	add    %rdx,%rax
+     25e:	0f b6 10             	movzbl (%rax),%edx
+     261:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     264:	48 98                	cltq
+     266:	48 8d 0d f3 5d 00 00 	lea    0x5df3(%rip),%rcx        # 6060 <buf>
+     26d:	0f b6 04 08          	movzbl (%rax,%rcx,1),%eax
+     271:	38 c2                	cmp    %al,%dl
+     273:	0f 84 87 00 00 00    	je     300 <mmaptest+0x2a8>
+      error("mapped byte %d was %d, wanted %d", i, p[i], buf[i]);
+     279:	8b 05 81 5d 00 00    	mov    0x5d81(%rip),%eax        # 6000 <stdout>
+     27f:	ba 41 00 00 00       	mov    $0x41,%edx
+     284:	48 8d 0d f5 3e 00 00 	lea    0x3ef5(%rip),%rcx        # 4180 <benchreport+0x171>
+     28b:	48 89 ce             	mov    %rcx,%rsi
+     28e:	89 c7                	mov    %eax,%edi
+     290:	b8 00 00 00 00       	mov    $0x0,%eax
+     295:	e8 a8 22 00 00       	call   2542 <printf>
+     29a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     29d:	48 98                	cltq
+     29f:	48 8d 15 ba 5d 00 00 	lea    0x5dba(%rip),%rdx        # 6060 <buf>
+     2a6:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     2aa:	0f be f0             	movsbl %al,%esi
+     2ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2b0:	48 63 d0             	movslq %eax,%rdx
+     2b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2b7:	48 01 d0             	add    %rdx,%rax
+     2ba:	0f b6 00             	movzbl (%rax),%eax
+     2bd:	0f be c8             	movsbl %al,%ecx
+     2c0:	8b 05 3a 5d 00 00    	mov    0x5d3a(%rip),%eax        # 6000 <stdout>
+     2c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     2c9:	41 89 f0             	mov    %esi,%r8d
+     2cc:	48 8d 35 15 3f 00 00 	lea    0x3f15(%rip),%rsi        # 41e8 <benchreport+0x1d9>
+     2d3:	89 c7                	mov    %eax,%edi
+     2d5:	b8 00 00 00 00       	mov    $0x0,%eax
+     2da:	e8 63 22 00 00       	call   2542 <printf>
+     2df:	8b 05 1b 5d 00 00    	mov    0x5d1b(%rip),%eax        # 6000 <stdout>
+     2e5:	48 8d 15 bf 3e 00 00 	lea    0x3ebf(%rip),%rdx        # 41ab <benchreport+0x19c>
+     2ec:	48 89 d6             	mov    %rdx,%rsi
+     2ef:	89 c7                	mov    %eax,%edi
+     2f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f6:	e8 47 22 00 00       	call   2542 <printf>
+     2fb:	e8 72 28 00 00       	call   2b72 <exit>
+  for (i = 0; i < PGSIZE; i++)
+     300:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     304:	81 7d fc ff 0f 00 00 	cmpl   $0xfff,-0x4(%rbp)
+     30b:	0f 8e 40 ff ff ff    	jle    251 <mmaptest+0x1f9>
+
+  if (pwrite(fd, "XYZ", 3, 10) != 3 || pwrite(fd, "XYZ", 3, PGSIZE) != 3)
+     311:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     314:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     319:	ba 03 00 00 00       	mov    $0x3,%edx
+     31e:	48 8d 35 e4 3e 00 00 	lea    0x3ee4(%rip),%rsi        # 4209 <benchreport+0x1fa>
+     325:	89 c7                	mov    %eax,%edi
+     327:	e8 f3 33 00 00       	call   371f <pwrite>
+     32c:	83 f8 03             	cmp    $0x3,%eax
+     32f:	75 20                	jne    351 <mmaptest+0x2f9>
+     331:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     334:	b9 00 10 00 00       	mov    $0x1000,%ecx
+     339:	ba 03 00 00 00       	mov    $0x3,%edx
+     33e:	48 8d 35 c4 3e 00 00 	lea    0x3ec4(%rip),%rsi        # 4209 <benchreport+0x1fa>
+     345:	89 c7                	mov    %eax,%edi
+     347:	e8 d3 33 00 00       	call   371f <pwrite>
+     34c:	83 f8 03             	cmp    $0x3,%eax
+     34f:	74 5e                	je     3af <mmaptest+0x357>
+    error("pwrite to 'mmap.txt' failed");
+     351:	8b 05 a9 5c 00 00    	mov    0x5ca9(%rip),%eax        # 6000 <stdout>
+     357:	ba 44 00 00 00       	mov    $0x44,%edx
+     35c:	48 8d 0d 1d 3e 00 00 	lea    0x3e1d(%rip),%rcx        # 4180 <benchreport+0x171>
+     363:	48 89 ce             	mov    %rcx,%rsi
+     366:	89 c7                	mov    %eax,%edi
+     368:	b8 00 00 00 00       	mov    $0x0,%eax
+     36d:	e8 d0 21 00 00       	call   2542 <printf>
+     372:	8b 05 88 5c 00 00    	mov    0x5c88(%rip),%eax        # 6000 <stdout>
+     378:	48 8d 15 8e 3e 00 00 	lea    0x3e8e(%rip),%rdx        # 420d <benchreport+0x1fe>
+     37f:	48 89 d6             	mov    %rdx,%rsi
+     382:	89 c7                	mov    %eax,%edi
+     384:	b8 00 00 00 00       	mov    $0x0,%eax
+     389:	e8 b4 21 00 00       	call   2542 <printf>
+     38e:	8b 05 6c 5c 00 00    	mov    0x5c6c(%rip),%eax        # 6000 <stdout>
+     394:	48 8d 15 10 3e 00 00 	lea    0x3e10(%rip),%rdx        # 41ab <benchreport+0x19c>
+     39b:	48 89 d6             	mov    %rdx,%rsi
+     39e:	89 c7                	mov    %eax,%edi
+     3a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3a5:	e8 98 21 00 00       	call   2542 <printf>
+     3aa:	e8 c3 27 00 00       	call   2b72 <exit>
+  if (p[10] != 'X' || p[12] != 'Z' || p[13] != buf[13])
+     3af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3b3:	48 83 c0 0a          	add    $0xa,%rax
+     3b7:	0f b6 00             	movzbl (%rax),%eax
+     3ba:	3c 58                	cmp    $0x58,%al
+     3bc:	75 25                	jne    3e3 <mmaptest+0x38b>
+     3be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3c2:	48 83 c0 0c          	add    $0xc,%rax
+     3c6:	0f b6 00             	movzbl (%rax),%eax
+     3c9:	3c 5a                	cmp    $0x5a,%al
+     3cb:	75 16                	jne    3e3 <mmaptest+0x38b>
+     3cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3d1:	48 83 c0 0d          	add    $0xd,%rax
+     3d5:	0f b6 10             	movzbl (%rax),%edx
+     3d8:	0f b6 05 8e 5c 00 00 	movzbl 0x5c8e(%rip),%eax        # 606d <buf+0xd>
+     3df:	38 c2                	cmp    %al,%dl
+     3e1:	74 5e                	je     441 <mmaptest+0x3e9>
+    error("mapping did not see a write to a page it had touched");
+     3e3:	8b 05 17 5c 00 00    	mov    0x5c17(%rip),%eax        # 6000 <stdout>
+     3e9:	ba 46 00 00 00       	mov    $0x46,%edx
+     3ee:	48 8d 0d 8b 3d 00 00 	lea    0x3d8b(%rip),%rcx        # 4180 <benchreport+0x171>
+     3f5:	48 89 ce             	mov    %rcx,%rsi
+     3f8:	89 c7                	mov    %eax,%edi
+     3fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ff:	e8 3e 21 00 00       	call   2542 <printf>
+     404:	8b 05 f6 5b 00 00    	mov    0x5bf6(%rip),%eax        # 6000 <stdout>
+     40a:	48 8d 15 1f 3e 00 00 	lea    0x3e1f(%rip),%rdx        # 4230 <benchreport+0x221>
+     411:	48 89 d6             	mov    %rdx,%rsi
+     414:	89 c7                	mov    %eax,%edi
+     416:	b8 00 00 00 00       	mov    $0x0,%eax
+     41b:	e8 22 21 00 00       	call   2542 <printf>
+     420:	8b 05 da 5b 00 00    	mov    0x5bda(%rip),%eax        # 6000 <stdout>
+     426:	48 8d 15 7e 3d 00 00 	lea    0x3d7e(%rip),%rdx        # 41ab <benchreport+0x19c>
+     42d:	48 89 d6             	mov    %rdx,%rsi
+     430:	89 c7                	mov    %eax,%edi
+     432:	b8 00 00 00 00       	mov    $0x0,%eax
+     437:	e8 06 21 00 00       	call   2542 <printf>
+     43c:	e8 31 27 00 00       	call   2b72 <exit>
+  if (p[PGSIZE] != 'X' || p[PGSIZE + 2] != 'Z' || p[PGSIZE + 3] != buf[PGSIZE + 3])
+     441:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     445:	48 05 00 10 00 00    	add    $0x1000,%rax
+     44b:	0f b6 00             	movzbl (%rax),%eax
+     44e:	3c 58                	cmp    $0x58,%al
+     450:	75 29                	jne    47b <mmaptest+0x423>
+     452:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     456:	48 05 02 10 00 00    	add    $0x1002,%rax
+     45c:	0f b6 00             	movzbl (%rax),%eax
+     45f:	3c 5a                	cmp    $0x5a,%al
+     461:	75 18                	jne    47b <mmaptest+0x423>
+     463:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     467:	48 05 03 10 00 00    	add    $0x1003,%rax
+     46d:	0f b6 10             	movzbl (%rax),%edx
+     470:	0f b6 05 ec 6b 00 00 	movzbl 0x6bec(%rip),%eax        # 7063 <buf+0x1003>
+     477:	38 c2                	cmp    %al,%dl
+     479:	74 5e                	je     4d9 <mmaptest+0x481>
+    error("mapping did not see a write to a page it had not touched");
+     47b:	8b 05 7f 5b 00 00    	mov    0x5b7f(%rip),%eax        # 6000 <stdout>
+     481:	ba 48 00 00 00       	mov    $0x48,%edx
+     486:	48 8d 0d f3 3c 00 00 	lea    0x3cf3(%rip),%rcx        # 4180 <benchreport+0x171>
+     48d:	48 89 ce             	mov    %rcx,%rsi
+     490:	89 c7                	mov    %eax,%edi
+     492:	b8 00 00 00 00       	mov    $0x0,%eax
+     497:	e8 a6 20 00 00       	call   2542 <printf>
+     49c:	8b 05 5e 5b 00 00    	mov    0x5b5e(%rip),%eax        # 6000 <stdout>
+     4a2:	48 8d 15 bf 3d 00 00 	lea    0x3dbf(%rip),%rdx        # 4268 <benchreport+0x259>
+     4a9:	48 89 d6             	mov    %rdx,%rsi
+     4ac:	89 c7                	mov    %eax,%edi
+     4ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b3:	e8 8a 20 00 00       	call   2542 <printf>
+     4b8:	8b 05 42 5b 00 00    	mov    0x5b42(%rip),%eax        # 6000 <stdout>
+     4be:	48 8d 15 e6 3c 00 00 	lea    0x3ce6(%rip),%rdx        # 41ab <benchreport+0x19c>
+     4c5:	48 89 d6             	mov    %rdx,%rsi
+     4c8:	89 c7                	mov    %eax,%edi
+     4ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     4cf:	e8 6e 20 00 00       	call   2542 <printf>
+     4d4:	e8 99 26 00 00       	call   2b72 <exit>
+
+  if (munmap(p, 2 * PGSIZE) < 0)
+     4d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     4dd:	be 00 20 00 00       	mov    $0x2000,%esi
+     4e2:	48 89 c7             	mov    %rax,%rdi
+     4e5:	e8 09 32 00 00       	call   36f3 <munmap>
+     4ea:	85 c0                	test   %eax,%eax
+     4ec:	79 5e                	jns    54c <mmaptest+0x4f4>
+    error("munmap failed");
+     4ee:	8b 05 0c 5b 00 00    	mov    0x5b0c(%rip),%eax        # 6000 <stdout>
+     4f4:	ba 4b 00 00 00       	mov    $0x4b,%edx
+     4f9:	48 8d 0d 80 3c 00 00 	lea    0x3c80(%rip),%rcx        # 4180 <benchreport+0x171>
+     500:	48 89 ce             	mov    %rcx,%rsi
+     503:	89 c7                	mov    %eax,%edi
+     505:	b8 00 00 00 00       	mov    $0x0,%eax
+     50a:	e8 33 20 00 00       	call   2542 <printf>
+     50f:	8b 05 eb 5a 00 00    	mov    0x5aeb(%rip),%eax        # 6000 <stdout>
+     515:	48 8d 15 85 3d 00 00 	lea    0x3d85(%rip),%rdx        # 42a1 <benchreport+0x292>
+     51c:	48 89 d6             	mov    %rdx,%rsi
+     51f:	89 c7                	mov    %eax,%edi
+     521:	b8 00 00 00 00       	mov    $0x0,%eax
+     526:	e8 17 20 00 00       	call   2542 <printf>
+     52b:	8b 05 cf 5a 00 00    	mov    0x5acf(%rip),%eax        # 6000 <stdout>
+     531:	48 8d 15 73 3c 00 00 	lea    0x3c73(%rip),%rdx        # 41ab <benchreport+0x19c>
+     538:	48 89 d6             	mov    %rdx,%rsi
+     53b:	89 c7                	mov    %eax,%edi
+     53d:	b8 00 00 00 00       	mov    $0x0,%eax
+     542:	e8 fb 1f 00 00       	call   2542 <printf>
+     547:	e8 26 26 00 00       	call   2b72 <exit>
+  close(fd);
+     54c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     54f:	89 c7                	mov    %eax,%edi
+     551:	e8 86 26 00 00       	call   2bdc <close>
+  unlink("mmap.txt");
+     556:	48 8d 05 1a 3c 00 00 	lea    0x3c1a(%rip),%rax        # 4177 <benchreport+0x168>
+     55d:	48 89 c7             	mov    %rax,%rdi
+     560:	e8 ff 30 00 00       	call   3664 <unlink>
+  printf(stdout, "mmaptest ok\n");
+     565:	8b 05 95 5a 00 00    	mov    0x5a95(%rip),%eax        # 6000 <stdout>
+     56b:	48 8d 15 3d 3d 00 00 	lea    0x3d3d(%rip),%rdx        # 42af <benchreport+0x2a0>
+     572:	48 89 d6             	mov    %rdx,%rsi
+     575:	89 c7                	mov    %eax,%edi
+     577:	b8 00 00 00 00       	mov    $0x0,%eax
+     57c:	e8 c1 1f 00 00       	call   2542 <printf>
+}
+     581:	90                   	nop
+     582:	c9                   	leave
+     583:	c3                   	ret
+
+0000000000000584 <markslot>:
+int slots[NTHREAD];
+int threadpipe[2];
+
+// Marks its slot in memory shared with the main thread and writes
+// its number to a pipe the main thread opened.
+static void markslot(void *arg) {
+     584:	55                   	push   %rbp
+     585:	48 89 e5             	mov    %rsp,%rbp
+     588:	48 83 ec 20          	sub    $0x20,%rsp
+     58c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i = (int)(uint64_t)arg;
+     590:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     594:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  char c = '0' + i;
+     597:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     59a:	83 c0 30             	add    $0x30,%eax
+     59d:	88 45 fb             	mov    %al,-0x5(%rbp)
+
+  slots[i] = i + 1;
+     5a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5a3:	8d 48 01             	lea    0x1(%rax),%ecx
+     5a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5a9:	48 98                	cltq
+     5ab:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     5b2:	00 
+     5b3:	48 8d 05 a6 da 00 00 	lea    0xdaa6(%rip),%rax        # e060 <slots>
+     5ba:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  if (write(threadpipe[1], &c, 1) != 1)
+     5bd:	8b 05 b1 da 00 00    	mov    0xdab1(%rip),%eax        # e074 <threadpipe+0x4>
+     5c3:	48 8d 4d fb          	lea    -0x5(%rbp),%rcx
+     5c7:	ba 01 00 00 00       	mov    $0x1,%edx
+     5cc:	48 89 ce             	mov    %rcx,%rsi
+     5cf:	89 c7                	mov    %eax,%edi
+     5d1:	e8 4c 30 00 00       	call   3622 <write>
+     5d6:	83 f8 01             	cmp    $0x1,%eax
+     5d9:	74 61                	je     63c <markslot+0xb8>
+    error("thread %d could not write to the shared pipe", i);
+     5db:	8b 05 1f 5a 00 00    	mov    0x5a1f(%rip),%eax        # 6000 <stdout>
+     5e1:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     5e6:	48 8d 0d 93 3b 00 00 	lea    0x3b93(%rip),%rcx        # 4180 <benchreport+0x171>
+     5ed:	48 89 ce             	mov    %rcx,%rsi
+     5f0:	89 c7                	mov    %eax,%edi
+     5f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     5f7:	e8 46 1f 00 00       	call   2542 <printf>
+     5fc:	8b 05 fe 59 00 00    	mov    0x59fe(%rip),%eax        # 6000 <stdout>
+     602:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     605:	48 8d 0d b4 3c 00 00 	lea    0x3cb4(%rip),%rcx        # 42c0 <benchreport+0x2b1>
+     60c:	48 89 ce             	mov    %rcx,%rsi
+     60f:	89 c7                	mov    %eax,%edi
+     611:	b8 00 00 00 00       	mov    $0x0,%eax
+     616:	e8 27 1f 00 00       	call   2542 <printf>
+     61b:	8b 05 df 59 00 00    	mov    0x59df(%rip),%eax        # 6000 <stdout>
+     621:	48 8d 15 83 3b 00 00 	lea    0x3b83(%rip),%rdx        # 41ab <benchreport+0x19c>
+     628:	48 89 d6             	mov    %rdx,%rsi
+     62b:	89 c7                	mov    %eax,%edi
+     62d:	b8 00 00 00 00       	mov    $0x0,%eax
+     632:	e8 0b 1f 00 00       	call   2542 <printf>
+     637:	e8 36 25 00 00       	call   2b72 <exit>
+  exit();
+     63c:	e8 31 25 00 00       	call   2b72 <exit>
+
+0000000000000641 <threadtest>:
+}
+
+// Starts threads with clone(), which share memory and open files, and
+// waits for each with join().
+void threadtest(void) {
+     641:	55                   	push   %rbp
+     642:	48 89 e5             	mov    %rsp,%rbp
+     645:	48 83 ec 20          	sub    $0x20,%rsp
+  int pids[NTHREAD];
+  int i, j, pid;
+  char c;
+
+  printf(stdout, "threadtest\n");
+     649:	8b 05 b1 59 00 00    	mov    0x59b1(%rip),%eax        # 6000 <stdout>
+     64f:	48 8d 15 97 3c 00 00 	lea    0x3c97(%rip),%rdx        # 42ed <benchreport+0x2de>
+     656:	48 89 d6             	mov    %rdx,%rsi
+     659:	89 c7                	mov    %eax,%edi
+     65b:	b8 00 00 00 00       	mov    $0x0,%eax
+     660:	e8 dd 1e 00 00       	call   2542 <printf>
+  if (pipe(threadpipe) < 0)
+     665:	48 8d 05 04 da 00 00 	lea    0xda04(%rip),%rax        # e070 <threadpipe>
+     66c:	48 89 c7             	mov    %rax,%rdi
+     66f:	e8 98 2f 00 00       	call   360c <pipe>
+     674:	85 c0                	test   %eax,%eax
+     676:	79 5e                	jns    6d6 <threadtest+0x95>
+    error("pipe failed");
+     678:	8b 05 82 59 00 00    	mov    0x5982(%rip),%eax        # 6000 <stdout>
+     67e:	ba 6c 00 00 00       	mov    $0x6c,%edx
+     683:	48 8d 0d f6 3a 00 00 	lea    0x3af6(%rip),%rcx        # 4180 <benchreport+0x171>
+     68a:	48 89 ce             	mov    %rcx,%rsi
+     68d:	89 c7                	mov    %eax,%edi
+     68f:	b8 00 00 00 00       	mov    $0x0,%eax
+     694:	e8 a9 1e 00 00       	call   2542 <printf>
+     699:	8b 05 61 59 00 00    	mov    0x5961(%rip),%eax        # 6000 <stdout>
+     69f:	48 8d 15 53 3c 00 00 	lea    0x3c53(%rip),%rdx        # 42f9 <benchreport+0x2ea>
+     6a6:	48 89 d6             	mov    %rdx,%rsi
+     6a9:	89 c7                	mov    %eax,%edi
+     6ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     6b0:	e8 8d 1e 00 00       	call   2542 <printf>
+     6b5:	8b 05 45 59 00 00    	mov    0x5945(%rip),%eax        # 6000 <stdout>
+     6bb:	48 8d 15 e9 3a 00 00 	lea    0x3ae9(%rip),%rdx        # 41ab <benchreport+0x19c>
+     6c2:	48 89 d6             	mov    %rdx,%rsi
+     6c5:	89 c7                	mov    %eax,%edi
+     6c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cc:	e8 71 1e 00 00       	call   2542 <printf>
+     6d1:	e8 9c 24 00 00       	call   2b72 <exit>
+  for (i = 0; i < NTHREAD; i++) {
+     6d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6dd:	e9 d0 00 00 00       	jmp    7b2 <threadtest+0x171>
+    slots[i] = 0;
+     6e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6e5:	48 98                	cltq
+     6e7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     6ee:	00 
+     6ef:	48 8d 05 6a d9 00 00 	lea    0xd96a(%rip),%rax        # e060 <slots>
+     6f6:	c7 04 02 00 00 00 00 	movl   $0x0,(%rdx,%rax,1)
+    if ((pids[i] = clone(markslot, stacks[i] + PGSIZE, (void *)(uint64_t)i)) < 0)
+     6fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     700:	48 98                	cltq
+     702:	48 89 c1             	mov    %rax,%rcx
+     705:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     708:	48 98                	cltq
+     70a:	48 c1 e0 0c          	shl    $0xc,%rax
+     70e:	48 89 c2             	mov    %rax,%rdx
+     711:	48 8d 05 48 99 00 00 	lea    0x9948(%rip),%rax        # a060 <stacks>
+     718:	48 01 d0             	add    %rdx,%rax
+     71b:	48 05 00 10 00 00    	add    $0x1000,%rax
+     721:	48 89 ca             	mov    %rcx,%rdx
+     724:	48 89 c6             	mov    %rax,%rsi
+     727:	48 8d 05 56 fe ff ff 	lea    -0x1aa(%rip),%rax        # 584 <markslot>
+     72e:	48 89 c7             	mov    %rax,%rdi
+     731:	e8 8e 30 00 00       	call   37c4 <clone>
+     736:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     739:	48 63 d2             	movslq %edx,%rdx
+     73c:	89 44 95 e4          	mov    %eax,-0x1c(%rbp,%rdx,4)
+     740:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     743:	48 98                	cltq
+     745:	8b 44 85 e4          	mov    -0x1c(%rbp,%rax,4),%eax
+     749:	85 c0                	test   %eax,%eax
+     74b:	79 61                	jns    7ae <threadtest+0x16d>
+      error("clone %d failed", i);
+     74d:	8b 05 ad 58 00 00    	mov    0x58ad(%rip),%eax        # 6000 <stdout>
+     753:	ba 70 00 00 00       	mov    $0x70,%edx
+     758:	48 8d 0d 21 3a 00 00 	lea    0x3a21(%rip),%rcx        # 4180 <benchreport+0x171>
+     75f:	48 89 ce             	mov    %rcx,%rsi
+     762:	89 c7                	mov    %eax,%edi
+     764:	b8 00 00 00 00       	mov    $0x0,%eax
+     769:	e8 d4 1d 00 00       	call   2542 <printf>
+     76e:	8b 05 8c 58 00 00    	mov    0x588c(%rip),%eax        # 6000 <stdout>
+     774:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     777:	48 8d 0d 87 3b 00 00 	lea    0x3b87(%rip),%rcx        # 4305 <benchreport+0x2f6>
+     77e:	48 89 ce             	mov    %rcx,%rsi
+     781:	89 c7                	mov    %eax,%edi
+     783:	b8 00 00 00 00       	mov    $0x0,%eax
+     788:	e8 b5 1d 00 00       	call   2542 <printf>
+     78d:	8b 05 6d 58 00 00    	mov    0x586d(%rip),%eax        # 6000 <stdout>
+     793:	48 8d 15 11 3a 00 00 	lea    0x3a11(%rip),%rdx        # 41ab <benchreport+0x19c>
+     79a:	48 89 d6             	mov    %rdx,%rsi
+     79d:	89 c7                	mov    %eax,%edi
+     79f:	b8 00 00 00 00       	mov    $0x0,%eax
+     7a4:	e8 99 1d 00 00       	call   2542 <printf>
+     7a9:	e8 c4 23 00 00       	call   2b72 <exit>
+  for (i = 0; i < NTHREAD; i++) {
+     7ae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     7b2:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     7b6:	0f 8e 26 ff ff ff    	jle    6e2 <threadtest+0xa1>
+  }
+  for (i = 0; i < NTHREAD; i++) {
+     7bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7c3:	e9 08 01 00 00       	jmp    8d0 <threadtest+0x28f>
+    if ((pid = join()) < 0)
+     7c8:	e8 02 30 00 00       	call   37cf <join>
+     7cd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     7d0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     7d4:	79 61                	jns    837 <threadtest+0x1f6>
+      error("join %d failed", i);
+     7d6:	8b 05 24 58 00 00    	mov    0x5824(%rip),%eax        # 6000 <stdout>
+     7dc:	ba 74 00 00 00       	mov    $0x74,%edx
+     7e1:	48 8d 0d 98 39 00 00 	lea    0x3998(%rip),%rcx        # 4180 <benchreport+0x171>
+     7e8:	48 89 ce             	mov    %rcx,%rsi
+     7eb:	89 c7                	mov    %eax,%edi
+     7ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f2:	e8 4b 1d 00 00       	call   2542 <printf>
+     7f7:	8b 05 03 58 00 00    	mov    0x5803(%rip),%eax        # 6000 <stdout>
+     7fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     800:	48 8d 0d 0e 3b 00 00 	lea    0x3b0e(%rip),%rcx        # 4315 <benchreport+0x306>
+     807:	48 89 ce             	mov    %rcx,%rsi
+     80a:	89 c7                	mov    %eax,%edi
+     80c:	b8 00 00 00 00       	mov    $0x0,%eax
+     811:	e8 2c 1d 00 00       	call   2542 <printf>
+     816:	8b 05 e4 57 00 00    	mov    0x57e4(%rip),%eax        # 6000 <stdout>
+     81c:	48 8d 15 88 39 00 00 	lea    0x3988(%rip),%rdx        # 41ab <benchreport+0x19c>
+     823:	48 89 d6             	mov    %rdx,%rsi
+     826:	89 c7                	mov    %eax,%edi
+     828:	b8 00 00 00 00       	mov    $0x0,%eax
+     82d:	e8 10 1d 00 00       	call   2542 <printf>
+     832:	e8 3b 23 00 00       	call   2b72 <exit>
+    for (j = 0; j < NTHREAD && pids[j] != pid; j++)
+     837:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     83e:	eb 04                	jmp    844 <threadtest+0x203>
+     840:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     844:	83 7d f8 03          	cmpl   $0x3,-0x8(%rbp)
+     848:	7f 0e                	jg     858 <threadtest+0x217>
+     84a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     84d:	48 98                	cltq
+     84f:	8b 44 85 e4          	mov    -0x1c(%rbp,%rax,4),%eax
+     853:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     856:	75 e8                	jne    840 <threadtest+0x1ff>
+      ;
+    if (j == NTHREAD)
+     858:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+     85c:	75 61                	jne    8bf <threadtest+0x27e>
+      error("join returned pid %d, which clone did not", pid);
+     85e:	8b 05 9c 57 00 00    	mov    0x579c(%rip),%eax        # 6000 <stdout>
+     864:	ba 78 00 00 00       	mov    $0x78,%edx
+     869:	48 8d 0d 10 39 00 00 	lea    0x3910(%rip),%rcx        # 4180 <benchreport+0x171>
+     870:	48 89 ce             	mov    %rcx,%rsi
+     873:	89 c7                	mov    %eax,%edi
+     875:	b8 00 00 00 00       	mov    $0x0,%eax
+     87a:	e8 c3 1c 00 00       	call   2542 <printf>
+     87f:	8b 05 7b 57 00 00    	mov    0x577b(%rip),%eax        # 6000 <stdout>
+     885:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     888:	48 8d 0d 99 3a 00 00 	lea    0x3a99(%rip),%rcx        # 4328 <benchreport+0x319>
+     88f:	48 89 ce             	mov    %rcx,%rsi
+     892:	89 c7                	mov    %eax,%edi
+     894:	b8 00 00 00 00       	mov    $0x0,%eax
+     899:	e8 a4 1c 00 00       	call   2542 <printf>
+     89e:	8b 05 5c 57 00 00    	mov    0x575c(%rip),%eax        # 6000 <stdout>
+     8a4:	48 8d 15 00 39 00 00 	lea    0x3900(%rip),%rdx        # 41ab <benchreport+0x19c>
+     8ab:	48 89 d6             	mov    %rdx,%rsi
+     8ae:	89 c7                	mov    %eax,%edi
+     8b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b5:	e8 88 1c 00 00       	call   2542 <printf>
+     8ba:	e8 b3 22 00 00       	call   2b72 <exit>
+    pids[j] = -1;
+     8bf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8c2:	48 98                	cltq
+     8c4:	c7 44 85 e4 ff ff ff 	movl   $0xffffffff,-0x1c(%rbp,%rax,4)
+     8cb:	ff 
+  for (i = 0; i < NTHREAD; i++) {
+     8cc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     8d0:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     8d4:	0f 8e ee fe ff ff    	jle    7c8 <threadtest+0x187>
+  }
+  if (join() != -1)
+     8da:	e8 f0 2e 00 00       	call   37cf <join>
+     8df:	83 f8 ff             	cmp    $0xffffffff,%eax
+     8e2:	74 5e                	je     942 <threadtest+0x301>
+    error("join with no threads left did not fail");
+     8e4:	8b 05 16 57 00 00    	mov    0x5716(%rip),%eax        # 6000 <stdout>
+     8ea:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     8ef:	48 8d 0d 8a 38 00 00 	lea    0x388a(%rip),%rcx        # 4180 <benchreport+0x171>
+     8f6:	48 89 ce             	mov    %rcx,%rsi
+     8f9:	89 c7                	mov    %eax,%edi
+     8fb:	b8 00 00 00 00       	mov    $0x0,%eax
+     900:	e8 3d 1c 00 00       	call   2542 <printf>
+     905:	8b 05 f5 56 00 00    	mov    0x56f5(%rip),%eax        # 6000 <stdout>
+     90b:	48 8d 15 46 3a 00 00 	lea    0x3a46(%rip),%rdx        # 4358 <benchreport+0x349>
+     912:	48 89 d6             	mov    %rdx,%rsi
+     915:	89 c7                	mov    %eax,%edi
+     917:	b8 00 00 00 00       	mov    $0x0,%eax
+     91c:	e8 21 1c 00 00       	call   2542 <printf>
+     921:	8b 05 d9 56 00 00    	mov    0x56d9(%rip),%eax        # 6000 <stdout>
+     927:	48 8d 15 7d 38 00 00 	lea    0x387d(%rip),%rdx        # 41ab <benchreport+0x19c>
+     92e:	48 89 d6             	mov    %rdx,%rsi
+     931:	89 c7                	mov    %eax,%edi
+     933:	b8 00 00 00 00       	mov    $0x0,%eax
+     938:	e8 05 1c 00 00       	call   2542 <printf>
+     93d:	e8 30 22 00 00       	call   2b72 <exit>
+
+  for (i = 0; i < NTHREAD; i++) {
+     942:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     949:	e9 12 01 00 00       	jmp    a60 <threadtest+0x41f>
+    if (slots[i] != i + 1)
+     94e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     951:	48 98                	cltq
+     953:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     95a:	00 
+     95b:	48 8d 05 fe d6 00 00 	lea    0xd6fe(%rip),%rax        # e060 <slots>
+     962:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     965:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     968:	83 c0 01             	add    $0x1,%eax
+     96b:	39 c2                	cmp    %eax,%edx
+     96d:	74 61                	je     9d0 <threadtest+0x38f>
+      error("thread %d's write to shared memory was not seen", i);
+     96f:	8b 05 8b 56 00 00    	mov    0x568b(%rip),%eax        # 6000 <stdout>
+     975:	ba 80 00 00 00       	mov    $0x80,%edx
+     97a:	48 8d 0d ff 37 00 00 	lea    0x37ff(%rip),%rcx        # 4180 <benchreport+0x171>
+     981:	48 89 ce             	mov    %rcx,%rsi
+     984:	89 c7                	mov    %eax,%edi
+     986:	b8 00 00 00 00       	mov    $0x0,%eax
+     98b:	e8 b2 1b 00 00       	call   2542 <printf>
+     990:	8b 05 6a 56 00 00    	mov    0x566a(%rip),%eax        # 6000 <stdout>
+     996:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     999:	48 8d 0d e0 39 00 00 	lea    0x39e0(%rip),%rcx        # 4380 <benchreport+0x371>
+     9a0:	48 89 ce             	mov    %rcx,%rsi
+     9a3:	89 c7                	mov    %eax,%edi
+     9a5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9aa:	e8 93 1b 00 00       	call   2542 <printf>
+     9af:	8b 05 4b 56 00 00    	mov    0x564b(%rip),%eax        # 6000 <stdout>
+     9b5:	48 8d 15 ef 37 00 00 	lea    0x37ef(%rip),%rdx        # 41ab <benchreport+0x19c>
+     9bc:	48 89 d6             	mov    %rdx,%rsi
+     9bf:	89 c7                	mov    %eax,%edi
+     9c1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9c6:	e8 77 1b 00 00       	call   2542 <printf>
+     9cb:	e8 a2 21 00 00       	call   2b72 <exit>
+    if (read(threadpipe[0], &c, 1) != 1 || c < '0' || c >= '0' + NTHREAD)
+     9d0:	8b 05 9a d6 00 00    	mov    0xd69a(%rip),%eax        # e070 <threadpipe>
+     9d6:	48 8d 4d e3          	lea    -0x1d(%rbp),%rcx
+     9da:	ba 01 00 00 00       	mov    $0x1,%edx
+     9df:	48 89 ce             	mov    %rcx,%rsi
+     9e2:	89 c7                	mov    %eax,%edi
+     9e4:	e8 2e 2c 00 00       	call   3617 <read>
+     9e9:	83 f8 01             	cmp    $0x1,%eax
+     9ec:	75 10                	jne    9fe <threadtest+0x3bd>
+     9ee:	0f b6 45 e3          	movzbl -0x1d(%rbp),%eax
+     9f2:	3c 2f                	cmp    $0x2f,%al
+     9f4:	7e 08                	jle    9fe <threadtest+0x3bd>
+     9f6:	0f b6 45 e3          	movzbl -0x1d(%rbp),%eax
+     9fa:	3c 33                	cmp    $0x33,%al
+     9fc:	7e 5e                	jle    a5c <threadtest+0x41b>
+      error("threads' writes to the shared pipe were not seen");
+     9fe:	8b 05 fc 55 00 00    	mov    0x55fc(%rip),%eax        # 6000 <stdout>
+     a04:	ba 82 00 00 00       	mov    $0x82,%edx
+     a09:	48 8d 0d 70 37 00 00 	lea    0x3770(%rip),%rcx        # 4180 <benchreport+0x171>
+     a10:	48 89 ce             	mov    %rcx,%rsi
+     a13:	89 c7                	mov    %eax,%edi
+     a15:	b8 00 00 00 00       	mov    $0x0,%eax
+     a1a:	e8 23 1b 00 00       	call   2542 <printf>
+     a1f:	8b 05 db 55 00 00    	mov    0x55db(%rip),%eax        # 6000 <stdout>
+     a25:	48 8d 15 84 39 00 00 	lea    0x3984(%rip),%rdx        # 43b0 <benchreport+0x3a1>
+     a2c:	48 89 d6             	mov    %rdx,%rsi
+     a2f:	89 c7                	mov    %eax,%edi
+     a31:	b8 00 00 00 00       	mov    $0x0,%eax
+     a36:	e8 07 1b 00 00       	call   2542 <printf>
+     a3b:	8b 05 bf 55 00 00    	mov    0x55bf(%rip),%eax        # 6000 <stdout>
+     a41:	48 8d 15 63 37 00 00 	lea    0x3763(%rip),%rdx        # 41ab <benchreport+0x19c>
+     a48:	48 89 d6             	mov    %rdx,%rsi
+     a4b:	89 c7                	mov    %eax,%edi
+     a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a52:	e8 eb 1a 00 00       	call   2542 <printf>
+     a57:	e8 16 21 00 00       	call   2b72 <exit>
+  for (i = 0; i < NTHREAD; i++) {
+     a5c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a60:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     a64:	0f 8e e4 fe ff ff    	jle    94e <threadtest+0x30d>
+  }
+  close(threadpipe[0]);
+     a6a:	8b 05 00 d6 00 00    	mov    0xd600(%rip),%eax        # e070 <threadpipe>
+     a70:	89 c7                	mov    %eax,%edi
+     a72:	e8 65 21 00 00       	call   2bdc <close>
+  close(threadpipe[1]);
+     a77:	8b 05 f7 d5 00 00    	mov    0xd5f7(%rip),%eax        # e074 <threadpipe+0x4>
+     a7d:	89 c7                	mov    %eax,%edi
+     a7f:	e8 58 21 00 00       	call   2bdc <close>
+  printf(stdout, "threadtest ok\n");
+     a84:	8b 05 76 55 00 00    	mov    0x5576(%rip),%eax        # 6000 <stdout>
+     a8a:	48 8d 15 50 39 00 00 	lea    0x3950(%rip),%rdx        # 43e1 <benchreport+0x3d2>
+     a91:	48 89 d6             	mov    %rdx,%rsi
+     a94:	89 c7                	mov    %eax,%edi
+     a96:	b8 00 00 00 00       	mov    $0x0,%eax
+     a9b:	e8 a2 1a 00 00       	call   2542 <printf>
+}
+     aa0:	90                   	nop
+     aa1:	c9                   	leave
+     aa2:	c3                   	ret
+
+0000000000000aa3 <addcount>:
+#define NITEMS 100
+
+struct mutex countlock;
+int count;
+
+static void addcount(void *arg) {
+     aa3:	55                   	push   %rbp
+     aa4:	48 89 e5             	mov    %rsp,%rbp
+     aa7:	48 83 ec 20          	sub    $0x20,%rsp
+     aab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+
+  for (i = 0; i < NINCR; i++) {
+     aaf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ab6:	eb 31                	jmp    ae9 <addcount+0x46>
+    mutex_lock(&countlock);
+     ab8:	48 8d 05 b9 d5 00 00 	lea    0xd5b9(%rip),%rax        # e078 <countlock>
+     abf:	48 89 c7             	mov    %rax,%rdi
+     ac2:	e8 ba 28 00 00       	call   3381 <mutex_lock>
+    count++;
+     ac7:	8b 05 af d5 00 00    	mov    0xd5af(%rip),%eax        # e07c <count>
+     acd:	83 c0 01             	add    $0x1,%eax
+     ad0:	89 05 a6 d5 00 00    	mov    %eax,0xd5a6(%rip)        # e07c <count>
+    mutex_unlock(&countlock);
+     ad6:	48 8d 05 9b d5 00 00 	lea    0xd59b(%rip),%rax        # e078 <countlock>
+     add:	48 89 c7             	mov    %rax,%rdi
+     ae0:	e8 e3 28 00 00       	call   33c8 <mutex_unlock>
+  for (i = 0; i < NINCR; i++) {
+     ae5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ae9:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+     af0:	7e c6                	jle    ab8 <addcount+0x15>
+  }
+  exit();
+     af2:	e8 7b 20 00 00       	call   2b72 <exit>
+
+0000000000000af7 <mutextest>:
+}
+
+// Threads add to a counter under a mutex; none of the increments may
+// be lost.  futex_wait() only sleeps if the word holds the value.
+void mutextest(void) {
+     af7:	55                   	push   %rbp
+     af8:	48 89 e5             	mov    %rsp,%rbp
+     afb:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, word;
+
+  printf(stdout, "mutextest\n");
+     aff:	8b 05 fb 54 00 00    	mov    0x54fb(%rip),%eax        # 6000 <stdout>
+     b05:	48 8d 15 e4 38 00 00 	lea    0x38e4(%rip),%rdx        # 43f0 <benchreport+0x3e1>
+     b0c:	48 89 d6             	mov    %rdx,%rsi
+     b0f:	89 c7                	mov    %eax,%edi
+     b11:	b8 00 00 00 00       	mov    $0x0,%eax
+     b16:	e8 27 1a 00 00       	call   2542 <printf>
+  word = 1;
+     b1b:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+  if (futex_wait(&word, 0) != -1)
+     b22:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+     b26:	be 00 00 00 00       	mov    $0x0,%esi
+     b2b:	48 89 c7             	mov    %rax,%rdi
+     b2e:	e8 a7 2c 00 00       	call   37da <futex_wait>
+     b33:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b36:	74 5e                	je     b96 <mutextest+0x9f>
+    error("futex_wait on a changed word did not return -1");
+     b38:	8b 05 c2 54 00 00    	mov    0x54c2(%rip),%eax        # 6000 <stdout>
+     b3e:	ba a2 00 00 00       	mov    $0xa2,%edx
+     b43:	48 8d 0d 36 36 00 00 	lea    0x3636(%rip),%rcx        # 4180 <benchreport+0x171>
+     b4a:	48 89 ce             	mov    %rcx,%rsi
+     b4d:	89 c7                	mov    %eax,%edi
+     b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b54:	e8 e9 19 00 00       	call   2542 <printf>
+     b59:	8b 05 a1 54 00 00    	mov    0x54a1(%rip),%eax        # 6000 <stdout>
+     b5f:	48 8d 15 9a 38 00 00 	lea    0x389a(%rip),%rdx        # 4400 <benchreport+0x3f1>
+     b66:	48 89 d6             	mov    %rdx,%rsi
+     b69:	89 c7                	mov    %eax,%edi
+     b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+     b70:	e8 cd 19 00 00       	call   2542 <printf>
+     b75:	8b 05 85 54 00 00    	mov    0x5485(%rip),%eax        # 6000 <stdout>
+     b7b:	48 8d 15 29 36 00 00 	lea    0x3629(%rip),%rdx        # 41ab <benchreport+0x19c>
+     b82:	48 89 d6             	mov    %rdx,%rsi
+     b85:	89 c7                	mov    %eax,%edi
+     b87:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8c:	e8 b1 19 00 00       	call   2542 <printf>
+     b91:	e8 dc 1f 00 00       	call   2b72 <exit>
+  if (futex_wake(&word, 1) != 0)
+     b96:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+     b9a:	be 01 00 00 00       	mov    $0x1,%esi
+     b9f:	48 89 c7             	mov    %rax,%rdi
+     ba2:	e8 3e 2c 00 00       	call   37e5 <futex_wake>
+     ba7:	85 c0                	test   %eax,%eax
+     ba9:	74 5e                	je     c09 <mutextest+0x112>
+    error("futex_wake with no waiters woke someone");
+     bab:	8b 05 4f 54 00 00    	mov    0x544f(%rip),%eax        # 6000 <stdout>
+     bb1:	ba a4 00 00 00       	mov    $0xa4,%edx
+     bb6:	48 8d 0d c3 35 00 00 	lea    0x35c3(%rip),%rcx        # 4180 <benchreport+0x171>
+     bbd:	48 89 ce             	mov    %rcx,%rsi
+     bc0:	89 c7                	mov    %eax,%edi
+     bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc7:	e8 76 19 00 00       	call   2542 <printf>
+     bcc:	8b 05 2e 54 00 00    	mov    0x542e(%rip),%eax        # 6000 <stdout>
+     bd2:	48 8d 15 57 38 00 00 	lea    0x3857(%rip),%rdx        # 4430 <benchreport+0x421>
+     bd9:	48 89 d6             	mov    %rdx,%rsi
+     bdc:	89 c7                	mov    %eax,%edi
+     bde:	b8 00 00 00 00       	mov    $0x0,%eax
+     be3:	e8 5a 19 00 00       	call   2542 <printf>
+     be8:	8b 05 12 54 00 00    	mov    0x5412(%rip),%eax        # 6000 <stdout>
+     bee:	48 8d 15 b6 35 00 00 	lea    0x35b6(%rip),%rdx        # 41ab <benchreport+0x19c>
+     bf5:	48 89 d6             	mov    %rdx,%rsi
+     bf8:	89 c7                	mov    %eax,%edi
+     bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+     bff:	e8 3e 19 00 00       	call   2542 <printf>
+     c04:	e8 69 1f 00 00       	call   2b72 <exit>
+
+  count = 0;
+     c09:	c7 05 69 d4 00 00 00 	movl   $0x0,0xd469(%rip)        # e07c <count>
+     c10:	00 00 00 
+  for (i = 0; i < NTHREAD; i++)
+     c13:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c1a:	e9 9c 00 00 00       	jmp    cbb <mutextest+0x1c4>
+    if (clone(addcount, stacks[i] + PGSIZE, 0) < 0)
+     c1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c22:	48 98                	cltq
+     c24:	48 c1 e0 0c          	shl    $0xc,%rax
+     c28:	48 89 c2             	mov    %rax,%rdx
+     c2b:	48 8d 05 2e 94 00 00 	lea    0x942e(%rip),%rax        # a060 <stacks>
+     c32:	48 01 d0             	add    %rdx,%rax
+     c35:	48 05 00 10 00 00    	add    $0x1000,%rax
+     c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+     c40:	48 89 c6             	mov    %rax,%rsi
+     c43:	48 8d 05 59 fe ff ff 	lea    -0x1a7(%rip),%rax        # aa3 <addcount>
+     c4a:	48 89 c7             	mov    %rax,%rdi
+     c4d:	e8 72 2b 00 00       	call   37c4 <clone>
+     c52:	85 c0                	test   %eax,%eax
+     c54:	79 61                	jns    cb7 <mutextest+0x1c0>
+      error("clone %d failed", i);
+     c56:	8b 05 a4 53 00 00    	mov    0x53a4(%rip),%eax        # 6000 <stdout>
+     c5c:	ba a9 00 00 00       	mov    $0xa9,%edx
+     c61:	48 8d 0d 18 35 00 00 	lea    0x3518(%rip),%rcx        # 4180 <benchreport+0x171>
+     c68:	48 89 ce             	mov    %rcx,%rsi
+     c6b:	89 c7                	mov    %eax,%edi
+     c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c72:	e8 cb 18 00 00       	call   2542 <printf>
+     c77:	8b 05 83 53 00 00    	mov    0x5383(%rip),%eax        # 6000 <stdout>
+     c7d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     c80:	48 8d 0d 7e 36 00 00 	lea    0x367e(%rip),%rcx        # 4305 <benchreport+0x2f6>
+     c87:	48 89 ce             	mov    %rcx,%rsi
+     c8a:	89 c7                	mov    %eax,%edi
+     c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     c91:	e8 ac 18 00 00       	call   2542 <printf>
+     c96:	8b 05 64 53 00 00    	mov    0x5364(%rip),%eax        # 6000 <stdout>
+     c9c:	48 8d 15 08 35 00 00 	lea    0x3508(%rip),%rdx        # 41ab <benchreport+0x19c>
+     ca3:	48 89 d6             	mov    %rdx,%rsi
+     ca6:	89 c7                	mov    %eax,%edi
+     ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+     cad:	e8 90 18 00 00       	call   2542 <printf>
+     cb2:	e8 bb 1e 00 00       	call   2b72 <exit>
+  for (i = 0; i < NTHREAD; i++)
+     cb7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     cbb:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     cbf:	0f 8e 5a ff ff ff    	jle    c1f <mutextest+0x128>
+  for (i = 0; i < NTHREAD; i++)
+     cc5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ccc:	eb 6e                	jmp    d3c <mutextest+0x245>
+    if (join() < 0)
+     cce:	e8 fc 2a 00 00       	call   37cf <join>
+     cd3:	85 c0                	test   %eax,%eax
+     cd5:	79 61                	jns    d38 <mutextest+0x241>
+      error("join %d failed", i);
+     cd7:	8b 05 23 53 00 00    	mov    0x5323(%rip),%eax        # 6000 <stdout>
+     cdd:	ba ac 00 00 00       	mov    $0xac,%edx
+     ce2:	48 8d 0d 97 34 00 00 	lea    0x3497(%rip),%rcx        # 4180 <benchreport+0x171>
+     ce9:	48 89 ce             	mov    %rcx,%rsi
+     cec:	89 c7                	mov    %eax,%edi
+     cee:	b8 00 00 00 00       	mov    $0x0,%eax
+     cf3:	e8 4a 18 00 00       	call   2542 <printf>
+     cf8:	8b 05 02 53 00 00    	mov    0x5302(%rip),%eax        # 6000 <stdout>
+     cfe:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d01:	48 8d 0d 0d 36 00 00 	lea    0x360d(%rip),%rcx        # 4315 <benchreport+0x306>
+     d08:	48 89 ce             	mov    %rcx,%rsi
+     d0b:	89 c7                	mov    %eax,%edi
+     d0d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d12:	e8 2b 18 00 00       	call   2542 <printf>
+     d17:	8b 05 e3 52 00 00    	mov    0x52e3(%rip),%eax        # 6000 <stdout>
+     d1d:	48 8d 15 87 34 00 00 	lea    0x3487(%rip),%rdx        # 41ab <benchreport+0x19c>
+     d24:	48 89 d6             	mov    %rdx,%rsi
+     d27:	89 c7                	mov    %eax,%edi
+     d29:	b8 00 00 00 00       	mov    $0x0,%eax
+     d2e:	e8 0f 18 00 00       	call   2542 <printf>
+     d33:	e8 3a 1e 00 00       	call   2b72 <exit>
+  for (i = 0; i < NTHREAD; i++)
+     d38:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d3c:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     d40:	7e 8c                	jle    cce <mutextest+0x1d7>
+  if (count != NTHREAD * NINCR)
+     d42:	8b 05 34 d3 00 00    	mov    0xd334(%rip),%eax        # e07c <count>
+     d48:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+     d4d:	74 66                	je     db5 <mutextest+0x2be>
+    error("count was %d, wanted %d", count, NTHREAD * NINCR);
+     d4f:	8b 05 ab 52 00 00    	mov    0x52ab(%rip),%eax        # 6000 <stdout>
+     d55:	ba ae 00 00 00       	mov    $0xae,%edx
+     d5a:	48 8d 0d 1f 34 00 00 	lea    0x341f(%rip),%rcx        # 4180 <benchreport+0x171>
+     d61:	48 89 ce             	mov    %rcx,%rsi
+     d64:	89 c7                	mov    %eax,%edi
+     d66:	b8 00 00 00 00       	mov    $0x0,%eax
+     d6b:	e8 d2 17 00 00       	call   2542 <printf>
+     d70:	8b 15 06 d3 00 00    	mov    0xd306(%rip),%edx        # e07c <count>
+     d76:	8b 05 84 52 00 00    	mov    0x5284(%rip),%eax        # 6000 <stdout>
+     d7c:	b9 a0 0f 00 00       	mov    $0xfa0,%ecx
+     d81:	48 8d 35 d0 36 00 00 	lea    0x36d0(%rip),%rsi        # 4458 <benchreport+0x449>
+     d88:	89 c7                	mov    %eax,%edi
+     d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d8f:	e8 ae 17 00 00       	call   2542 <printf>
+     d94:	8b 05 66 52 00 00    	mov    0x5266(%rip),%eax        # 6000 <stdout>
+     d9a:	48 8d 15 0a 34 00 00 	lea    0x340a(%rip),%rdx        # 41ab <benchreport+0x19c>
+     da1:	48 89 d6             	mov    %rdx,%rsi
+     da4:	89 c7                	mov    %eax,%edi
+     da6:	b8 00 00 00 00       	mov    $0x0,%eax
+     dab:	e8 92 17 00 00       	call   2542 <printf>
+     db0:	e8 bd 1d 00 00       	call   2b72 <exit>
+  printf(stdout, "mutextest ok\n");
+     db5:	8b 05 45 52 00 00    	mov    0x5245(%rip),%eax        # 6000 <stdout>
+     dbb:	48 8d 15 ae 36 00 00 	lea    0x36ae(%rip),%rdx        # 4470 <benchreport+0x461>
+     dc2:	48 89 d6             	mov    %rdx,%rsi
+     dc5:	89 c7                	mov    %eax,%edi
+     dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+     dcc:	e8 71 17 00 00       	call   2542 <printf>
+}
+     dd1:	90                   	nop
+     dd2:	c9                   	leave
+     dd3:	c3                   	ret
+
+0000000000000dd4 <produce>:
+// thread
+struct mutex boxlock;
+struct cond boxfull, boxempty;
+int boxhas, boxitem;
+
+static void produce(void *arg) {
+     dd4:	55                   	push   %rbp
+     dd5:	48 89 e5             	mov    %rsp,%rbp
+     dd8:	48 83 ec 20          	sub    $0x20,%rsp
+     ddc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+
+  for (i = 1; i <= NITEMS; i++) {
+     de0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     de7:	eb 69                	jmp    e52 <produce+0x7e>
+    mutex_lock(&boxlock);
+     de9:	48 8d 05 90 d2 00 00 	lea    0xd290(%rip),%rax        # e080 <boxlock>
+     df0:	48 89 c7             	mov    %rax,%rdi
+     df3:	e8 89 25 00 00       	call   3381 <mutex_lock>
+    while (boxhas)
+     df8:	eb 19                	jmp    e13 <produce+0x3f>
+      cond_wait(&boxempty, &boxlock);
+     dfa:	48 8d 05 7f d2 00 00 	lea    0xd27f(%rip),%rax        # e080 <boxlock>
+     e01:	48 89 c6             	mov    %rax,%rsi
+     e04:	48 8d 05 85 d2 00 00 	lea    0xd285(%rip),%rax        # e090 <boxempty>
+     e0b:	48 89 c7             	mov    %rax,%rdi
+     e0e:	e8 e5 25 00 00       	call   33f8 <cond_wait>
+    while (boxhas)
+     e13:	8b 05 7f d2 00 00    	mov    0xd27f(%rip),%eax        # e098 <boxhas>
+     e19:	85 c0                	test   %eax,%eax
+     e1b:	75 dd                	jne    dfa <produce+0x26>
+    boxitem = i;
+     e1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e20:	89 05 76 d2 00 00    	mov    %eax,0xd276(%rip)        # e09c <boxitem>
+    boxhas = 1;
+     e26:	c7 05 68 d2 00 00 01 	movl   $0x1,0xd268(%rip)        # e098 <boxhas>
+     e2d:	00 00 00 
+    cond_signal(&boxfull);
+     e30:	48 8d 05 51 d2 00 00 	lea    0xd251(%rip),%rax        # e088 <boxfull>
+     e37:	48 89 c7             	mov    %rax,%rdi
+     e3a:	e8 16 26 00 00       	call   3455 <cond_signal>
+    mutex_unlock(&boxlock);
+     e3f:	48 8d 05 3a d2 00 00 	lea    0xd23a(%rip),%rax        # e080 <boxlock>
+     e46:	48 89 c7             	mov    %rax,%rdi
+     e49:	e8 7a 25 00 00       	call   33c8 <mutex_unlock>
+  for (i = 1; i <= NITEMS; i++) {
+     e4e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e52:	83 7d fc 64          	cmpl   $0x64,-0x4(%rbp)
+     e56:	7e 91                	jle    de9 <produce+0x15>
+  }
+  exit();
+     e58:	e8 15 1d 00 00       	call   2b72 <exit>
+
+0000000000000e5d <condtest>:
+}
+
+// Items pass through the mailbox one at a time, each waiting on a
+// condition variable for the other side, and arrive in order.
+void condtest(void) {
+     e5d:	55                   	push   %rbp
+     e5e:	48 89 e5             	mov    %rsp,%rbp
+     e61:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+
+  printf(stdout, "condtest\n");
+     e65:	8b 05 95 51 00 00    	mov    0x5195(%rip),%eax        # 6000 <stdout>
+     e6b:	48 8d 15 0c 36 00 00 	lea    0x360c(%rip),%rdx        # 447e <benchreport+0x46f>
+     e72:	48 89 d6             	mov    %rdx,%rsi
+     e75:	89 c7                	mov    %eax,%edi
+     e77:	b8 00 00 00 00       	mov    $0x0,%eax
+     e7c:	e8 c1 16 00 00       	call   2542 <printf>
+  boxhas = 0;
+     e81:	c7 05 0d d2 00 00 00 	movl   $0x0,0xd20d(%rip)        # e098 <boxhas>
+     e88:	00 00 00 
+  if (clone(produce, stacks[0] + PGSIZE, 0) < 0)
+     e8b:	48 8d 05 ce a1 00 00 	lea    0xa1ce(%rip),%rax        # b060 <stacks+0x1000>
+     e92:	ba 00 00 00 00       	mov    $0x0,%edx
+     e97:	48 89 c6             	mov    %rax,%rsi
+     e9a:	48 8d 05 33 ff ff ff 	lea    -0xcd(%rip),%rax        # dd4 <produce>
+     ea1:	48 89 c7             	mov    %rax,%rdi
+     ea4:	e8 1b 29 00 00       	call   37c4 <clone>
+     ea9:	85 c0                	test   %eax,%eax
+     eab:	79 5e                	jns    f0b <condtest+0xae>
+    error("clone failed");
+     ead:	8b 05 4d 51 00 00    	mov    0x514d(%rip),%eax        # 6000 <stdout>
+     eb3:	ba cf 00 00 00       	mov    $0xcf,%edx
+     eb8:	48 8d 0d c1 32 00 00 	lea    0x32c1(%rip),%rcx        # 4180 <benchreport+0x171>
+     ebf:	48 89 ce             	mov    %rcx,%rsi
+     ec2:	89 c7                	mov    %eax,%edi
+     ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ec9:	e8 74 16 00 00       	call   2542 <printf>
+     ece:	8b 05 2c 51 00 00    	mov    0x512c(%rip),%eax        # 6000 <stdout>
+     ed4:	48 8d 15 ad 35 00 00 	lea    0x35ad(%rip),%rdx        # 4488 <benchreport+0x479>
+     edb:	48 89 d6             	mov    %rdx,%rsi
+     ede:	89 c7                	mov    %eax,%edi
+     ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee5:	e8 58 16 00 00       	call   2542 <printf>
+     eea:	8b 05 10 51 00 00    	mov    0x5110(%rip),%eax        # 6000 <stdout>
+     ef0:	48 8d 15 b4 32 00 00 	lea    0x32b4(%rip),%rdx        # 41ab <benchreport+0x19c>
+     ef7:	48 89 d6             	mov    %rdx,%rsi
+     efa:	89 c7                	mov    %eax,%edi
+     efc:	b8 00 00 00 00       	mov    $0x0,%eax
+     f01:	e8 3c 16 00 00       	call   2542 <printf>
+     f06:	e8 67 1c 00 00       	call   2b72 <exit>
+  for (i = 1; i <= NITEMS; i++) {
+     f0b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     f12:	e9 cf 00 00 00       	jmp    fe6 <condtest+0x189>
+    mutex_lock(&boxlock);
+     f17:	48 8d 05 62 d1 00 00 	lea    0xd162(%rip),%rax        # e080 <boxlock>
+     f1e:	48 89 c7             	mov    %rax,%rdi
+     f21:	e8 5b 24 00 00       	call   3381 <mutex_lock>
+    while (!boxhas)
+     f26:	eb 19                	jmp    f41 <condtest+0xe4>
+      cond_wait(&boxfull, &boxlock);
+     f28:	48 8d 05 51 d1 00 00 	lea    0xd151(%rip),%rax        # e080 <boxlock>
+     f2f:	48 89 c6             	mov    %rax,%rsi
+     f32:	48 8d 05 4f d1 00 00 	lea    0xd14f(%rip),%rax        # e088 <boxfull>
+     f39:	48 89 c7             	mov    %rax,%rdi
+     f3c:	e8 b7 24 00 00       	call   33f8 <cond_wait>
+    while (!boxhas)
+     f41:	8b 05 51 d1 00 00    	mov    0xd151(%rip),%eax        # e098 <boxhas>
+     f47:	85 c0                	test   %eax,%eax
+     f49:	74 dd                	je     f28 <condtest+0xcb>
+    if (boxitem != i)
+     f4b:	8b 05 4b d1 00 00    	mov    0xd14b(%rip),%eax        # e09c <boxitem>
+     f51:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     f54:	74 64                	je     fba <condtest+0x15d>
+      error("got item %d, wanted %d", boxitem, i);
+     f56:	8b 05 a4 50 00 00    	mov    0x50a4(%rip),%eax        # 6000 <stdout>
+     f5c:	ba d5 00 00 00       	mov    $0xd5,%edx
+     f61:	48 8d 0d 18 32 00 00 	lea    0x3218(%rip),%rcx        # 4180 <benchreport+0x171>
+     f68:	48 89 ce             	mov    %rcx,%rsi
+     f6b:	89 c7                	mov    %eax,%edi
+     f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     f72:	e8 cb 15 00 00       	call   2542 <printf>
+     f77:	8b 15 1f d1 00 00    	mov    0xd11f(%rip),%edx        # e09c <boxitem>
+     f7d:	8b 05 7d 50 00 00    	mov    0x507d(%rip),%eax        # 6000 <stdout>
+     f83:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     f86:	48 8d 35 08 35 00 00 	lea    0x3508(%rip),%rsi        # 4495 <benchreport+0x486>
+     f8d:	89 c7                	mov    %eax,%edi
+     f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f94:	e8 a9 15 00 00       	call   2542 <printf>
+     f99:	8b 05 61 50 00 00    	mov    0x5061(%rip),%eax        # 6000 <stdout>
+     f9f:	48 8d 15 05 32 00 00 	lea    0x3205(%rip),%rdx        # 41ab <benchreport+0x19c>
+     fa6:	48 89 d6             	mov    %rdx,%rsi
+     fa9:	89 c7                	mov    %eax,%edi
+     fab:	b8 00 00 00 00       	mov    $0x0,%eax
+     fb0:	e8 8d 15 00 00       	call   2542 <printf>
+     fb5:	e8 b8 1b 00 00       	call   2b72 <exit>
+    boxhas = 0;
+     fba:	c7 05 d4 d0 00 00 00 	movl   $0x0,0xd0d4(%rip)        # e098 <boxhas>
+     fc1:	00 00 00 
+    cond_signal(&boxempty);
+     fc4:	48 8d 05 c5 d0 00 00 	lea    0xd0c5(%rip),%rax        # e090 <boxempty>
+     fcb:	48 89 c7             	mov    %rax,%rdi
+     fce:	e8 82 24 00 00       	call   3455 <cond_signal>
+    mutex_unlock(&boxlock);
+     fd3:	48 8d 05 a6 d0 00 00 	lea    0xd0a6(%rip),%rax        # e080 <boxlock>
+     fda:	48 89 c7             	mov    %rax,%rdi
+     fdd:	e8 e6 23 00 00       	call   33c8 <mutex_unlock>
+  for (i = 1; i <= NITEMS; i++) {
+     fe2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     fe6:	83 7d fc 64          	cmpl   $0x64,-0x4(%rbp)
+     fea:	0f 8e 27 ff ff ff    	jle    f17 <condtest+0xba>
+  }
+  if (join() < 0)
+     ff0:	e8 da 27 00 00       	call   37cf <join>
+     ff5:	85 c0                	test   %eax,%eax
+     ff7:	79 5e                	jns    1057 <condtest+0x1fa>
+    error("join failed");
+     ff9:	8b 05 01 50 00 00    	mov    0x5001(%rip),%eax        # 6000 <stdout>
+     fff:	ba db 00 00 00       	mov    $0xdb,%edx
+    1004:	48 8d 0d 75 31 00 00 	lea    0x3175(%rip),%rcx        # 4180 <benchreport+0x171>
+    100b:	48 89 ce             	mov    %rcx,%rsi
+    100e:	89 c7                	mov    %eax,%edi
+    1010:	b8 00 00 00 00       	mov    $0x0,%eax
+    1015:	e8 28 15 00 00       	call   2542 <printf>
+    101a:	8b 05 e0 4f 00 00    	mov    0x4fe0(%rip),%eax        # 6000 <stdout>
+    1020:	48 8d 15 85 34 00 00 	lea    0x3485(%rip),%rdx        # 44ac <benchreport+0x49d>
+    1027:	48 89 d6             	mov    %rdx,%rsi
+    102a:	89 c7                	mov    %eax,%edi
+    102c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1031:	e8 0c 15 00 00       	call   2542 <printf>
+    1036:	8b 05 c4 4f 00 00    	mov    0x4fc4(%rip),%eax        # 6000 <stdout>
+    103c:	48 8d 15 68 31 00 00 	lea    0x3168(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1043:	48 89 d6             	mov    %rdx,%rsi
+    1046:	89 c7                	mov    %eax,%edi
+    1048:	b8 00 00 00 00       	mov    $0x0,%eax
+    104d:	e8 f0 14 00 00       	call   2542 <printf>
+    1052:	e8 1b 1b 00 00       	call   2b72 <exit>
+  printf(stdout, "condtest ok\n");
+    1057:	8b 05 a3 4f 00 00    	mov    0x4fa3(%rip),%eax        # 6000 <stdout>
+    105d:	48 8d 15 54 34 00 00 	lea    0x3454(%rip),%rdx        # 44b8 <benchreport+0x4a9>
+    1064:	48 89 d6             	mov    %rdx,%rsi
+    1067:	89 c7                	mov    %eax,%edi
+    1069:	b8 00 00 00 00       	mov    $0x0,%eax
+    106e:	e8 cf 14 00 00       	call   2542 <printf>
+}
+    1073:	90                   	nop
+    1074:	c9                   	leave
+    1075:	c3                   	ret
+
+0000000000001076 <shmtest>:
+
+// A segment attached before fork() is shared with the child both
+// ways, and shmget() of a key finds the segment it made before.
+void shmtest(void) {
+    1076:	55                   	push   %rbp
+    1077:	48 89 e5             	mov    %rsp,%rbp
+    107a:	48 83 ec 20          	sub    $0x20,%rsp
+  int id, pid;
+  char *p;
+
+  printf(stdout, "shmtest\n");
+    107e:	8b 05 7c 4f 00 00    	mov    0x4f7c(%rip),%eax        # 6000 <stdout>
+    1084:	48 8d 15 3a 34 00 00 	lea    0x343a(%rip),%rdx        # 44c5 <benchreport+0x4b6>
+    108b:	48 89 d6             	mov    %rdx,%rsi
+    108e:	89 c7                	mov    %eax,%edi
+    1090:	b8 00 00 00 00       	mov    $0x0,%eax
+    1095:	e8 a8 14 00 00       	call   2542 <printf>
+  if ((id = shmget(451, PGSIZE)) < 0)
+    109a:	be 00 10 00 00       	mov    $0x1000,%esi
+    109f:	bf c3 01 00 00       	mov    $0x1c3,%edi
+    10a4:	e8 47 27 00 00       	call   37f0 <shmget>
+    10a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    10ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    10b0:	79 5e                	jns    1110 <shmtest+0x9a>
+    error("shmget failed");
+    10b2:	8b 05 48 4f 00 00    	mov    0x4f48(%rip),%eax        # 6000 <stdout>
+    10b8:	ba e7 00 00 00       	mov    $0xe7,%edx
+    10bd:	48 8d 0d bc 30 00 00 	lea    0x30bc(%rip),%rcx        # 4180 <benchreport+0x171>
+    10c4:	48 89 ce             	mov    %rcx,%rsi
+    10c7:	89 c7                	mov    %eax,%edi
+    10c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ce:	e8 6f 14 00 00       	call   2542 <printf>
+    10d3:	8b 05 27 4f 00 00    	mov    0x4f27(%rip),%eax        # 6000 <stdout>
+    10d9:	48 8d 15 ee 33 00 00 	lea    0x33ee(%rip),%rdx        # 44ce <benchreport+0x4bf>
+    10e0:	48 89 d6             	mov    %rdx,%rsi
+    10e3:	89 c7                	mov    %eax,%edi
+    10e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ea:	e8 53 14 00 00       	call   2542 <printf>
+    10ef:	8b 05 0b 4f 00 00    	mov    0x4f0b(%rip),%eax        # 6000 <stdout>
+    10f5:	48 8d 15 af 30 00 00 	lea    0x30af(%rip),%rdx        # 41ab <benchreport+0x19c>
+    10fc:	48 89 d6             	mov    %rdx,%rsi
+    10ff:	89 c7                	mov    %eax,%edi
+    1101:	b8 00 00 00 00       	mov    $0x0,%eax
+    1106:	e8 37 14 00 00       	call   2542 <printf>
+    110b:	e8 62 1a 00 00       	call   2b72 <exit>
+  if (shmget(451, PGSIZE) != id)
+    1110:	be 00 10 00 00       	mov    $0x1000,%esi
+    1115:	bf c3 01 00 00       	mov    $0x1c3,%edi
+    111a:	e8 d1 26 00 00       	call   37f0 <shmget>
+    111f:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1122:	74 5e                	je     1182 <shmtest+0x10c>
+    error("shmget of the same key gave another segment");
+    1124:	8b 05 d6 4e 00 00    	mov    0x4ed6(%rip),%eax        # 6000 <stdout>
+    112a:	ba e9 00 00 00       	mov    $0xe9,%edx
+    112f:	48 8d 0d 4a 30 00 00 	lea    0x304a(%rip),%rcx        # 4180 <benchreport+0x171>
+    1136:	48 89 ce             	mov    %rcx,%rsi
+    1139:	89 c7                	mov    %eax,%edi
+    113b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1140:	e8 fd 13 00 00       	call   2542 <printf>
+    1145:	8b 05 b5 4e 00 00    	mov    0x4eb5(%rip),%eax        # 6000 <stdout>
+    114b:	48 8d 15 8e 33 00 00 	lea    0x338e(%rip),%rdx        # 44e0 <benchreport+0x4d1>
+    1152:	48 89 d6             	mov    %rdx,%rsi
+    1155:	89 c7                	mov    %eax,%edi
+    1157:	b8 00 00 00 00       	mov    $0x0,%eax
+    115c:	e8 e1 13 00 00       	call   2542 <printf>
+    1161:	8b 05 99 4e 00 00    	mov    0x4e99(%rip),%eax        # 6000 <stdout>
+    1167:	48 8d 15 3d 30 00 00 	lea    0x303d(%rip),%rdx        # 41ab <benchreport+0x19c>
+    116e:	48 89 d6             	mov    %rdx,%rsi
+    1171:	89 c7                	mov    %eax,%edi
+    1173:	b8 00 00 00 00       	mov    $0x0,%eax
+    1178:	e8 c5 13 00 00       	call   2542 <printf>
+    117d:	e8 f0 19 00 00       	call   2b72 <exit>
+  if ((p = shmat(id)) == (char *)-1)
+    1182:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1185:	89 c7                	mov    %eax,%edi
+    1187:	e8 6f 26 00 00       	call   37fb <shmat>
+    118c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1190:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+    1195:	75 5e                	jne    11f5 <shmtest+0x17f>
+    error("shmat failed");
+    1197:	8b 05 63 4e 00 00    	mov    0x4e63(%rip),%eax        # 6000 <stdout>
+    119d:	ba eb 00 00 00       	mov    $0xeb,%edx
+    11a2:	48 8d 0d d7 2f 00 00 	lea    0x2fd7(%rip),%rcx        # 4180 <benchreport+0x171>
+    11a9:	48 89 ce             	mov    %rcx,%rsi
+    11ac:	89 c7                	mov    %eax,%edi
+    11ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    11b3:	e8 8a 13 00 00       	call   2542 <printf>
+    11b8:	8b 05 42 4e 00 00    	mov    0x4e42(%rip),%eax        # 6000 <stdout>
+    11be:	48 8d 15 47 33 00 00 	lea    0x3347(%rip),%rdx        # 450c <benchreport+0x4fd>
+    11c5:	48 89 d6             	mov    %rdx,%rsi
+    11c8:	89 c7                	mov    %eax,%edi
+    11ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cf:	e8 6e 13 00 00       	call   2542 <printf>
+    11d4:	8b 05 26 4e 00 00    	mov    0x4e26(%rip),%eax        # 6000 <stdout>
+    11da:	48 8d 15 ca 2f 00 00 	lea    0x2fca(%rip),%rdx        # 41ab <benchreport+0x19c>
+    11e1:	48 89 d6             	mov    %rdx,%rsi
+    11e4:	89 c7                	mov    %eax,%edi
+    11e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11eb:	e8 52 13 00 00       	call   2542 <printf>
+    11f0:	e8 7d 19 00 00       	call   2b72 <exit>
+  strcpy(p, "parent");
+    11f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11f9:	48 8d 15 19 33 00 00 	lea    0x3319(%rip),%rdx        # 4519 <benchreport+0x50a>
+    1200:	48 89 d6             	mov    %rdx,%rsi
+    1203:	48 89 c7             	mov    %rax,%rdi
+    1206:	e8 2b 1c 00 00       	call   2e36 <strcpy>
+
+  if ((pid = fork()) < 0)
+    120b:	e8 52 19 00 00       	call   2b62 <fork>
+    1210:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    1213:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    1217:	79 5e                	jns    1277 <shmtest+0x201>
+    error("fork failed");
+    1219:	8b 05 e1 4d 00 00    	mov    0x4de1(%rip),%eax        # 6000 <stdout>
+    121f:	ba ef 00 00 00       	mov    $0xef,%edx
+    1224:	48 8d 0d 55 2f 00 00 	lea    0x2f55(%rip),%rcx        # 4180 <benchreport+0x171>
+    122b:	48 89 ce             	mov    %rcx,%rsi
+    122e:	89 c7                	mov    %eax,%edi
+    1230:	b8 00 00 00 00       	mov    $0x0,%eax
+    1235:	e8 08 13 00 00       	call   2542 <printf>
+    123a:	8b 05 c0 4d 00 00    	mov    0x4dc0(%rip),%eax        # 6000 <stdout>
+    1240:	48 8d 15 d9 32 00 00 	lea    0x32d9(%rip),%rdx        # 4520 <benchreport+0x511>
+    1247:	48 89 d6             	mov    %rdx,%rsi
+    124a:	89 c7                	mov    %eax,%edi
+    124c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1251:	e8 ec 12 00 00       	call   2542 <printf>
+    1256:	8b 05 a4 4d 00 00    	mov    0x4da4(%rip),%eax        # 6000 <stdout>
+    125c:	48 8d 15 48 2f 00 00 	lea    0x2f48(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1263:	48 89 d6             	mov    %rdx,%rsi
+    1266:	89 c7                	mov    %eax,%edi
+    1268:	b8 00 00 00 00       	mov    $0x0,%eax
+    126d:	e8 d0 12 00 00       	call   2542 <printf>
+    1272:	e8 fb 18 00 00       	call   2b72 <exit>
+  if (pid == 0) {
+    1277:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    127b:	0f 85 97 00 00 00    	jne    1318 <shmtest+0x2a2>
+    if (strcmp(p, "parent") != 0)
+    1281:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1285:	48 8d 15 8d 32 00 00 	lea    0x328d(%rip),%rdx        # 4519 <benchreport+0x50a>
+    128c:	48 89 d6             	mov    %rdx,%rsi
+    128f:	48 89 c7             	mov    %rax,%rdi
+    1292:	e8 de 1b 00 00       	call   2e75 <strcmp>
+    1297:	85 c0                	test   %eax,%eax
+    1299:	74 62                	je     12fd <shmtest+0x287>
+      error("child saw '%s' in the segment, wanted 'parent'", p);
+    129b:	8b 05 5f 4d 00 00    	mov    0x4d5f(%rip),%eax        # 6000 <stdout>
+    12a1:	ba f2 00 00 00       	mov    $0xf2,%edx
+    12a6:	48 8d 0d d3 2e 00 00 	lea    0x2ed3(%rip),%rcx        # 4180 <benchreport+0x171>
+    12ad:	48 89 ce             	mov    %rcx,%rsi
+    12b0:	89 c7                	mov    %eax,%edi
+    12b2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b7:	e8 86 12 00 00       	call   2542 <printf>
+    12bc:	8b 05 3e 4d 00 00    	mov    0x4d3e(%rip),%eax        # 6000 <stdout>
+    12c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    12c6:	48 8d 0d 63 32 00 00 	lea    0x3263(%rip),%rcx        # 4530 <benchreport+0x521>
+    12cd:	48 89 ce             	mov    %rcx,%rsi
+    12d0:	89 c7                	mov    %eax,%edi
+    12d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12d7:	e8 66 12 00 00       	call   2542 <printf>
+    12dc:	8b 05 1e 4d 00 00    	mov    0x4d1e(%rip),%eax        # 6000 <stdout>
+    12e2:	48 8d 15 c2 2e 00 00 	lea    0x2ec2(%rip),%rdx        # 41ab <benchreport+0x19c>
+    12e9:	48 89 d6             	mov    %rdx,%rsi
+    12ec:	89 c7                	mov    %eax,%edi
+    12ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f3:	e8 4a 12 00 00       	call   2542 <printf>
+    12f8:	e8 75 18 00 00       	call   2b72 <exit>
+    strcpy(p, "child");
+    12fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1301:	48 8d 15 57 32 00 00 	lea    0x3257(%rip),%rdx        # 455f <benchreport+0x550>
+    1308:	48 89 d6             	mov    %rdx,%rsi
+    130b:	48 89 c7             	mov    %rax,%rdi
+    130e:	e8 23 1b 00 00       	call   2e36 <strcpy>
+    exit();
+    1313:	e8 5a 18 00 00       	call   2b72 <exit>
+  }
+  wait();
+    1318:	e8 e4 22 00 00       	call   3601 <wait>
+  if (strcmp(p, "child") != 0)
+    131d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1321:	48 8d 15 37 32 00 00 	lea    0x3237(%rip),%rdx        # 455f <benchreport+0x550>
+    1328:	48 89 d6             	mov    %rdx,%rsi
+    132b:	48 89 c7             	mov    %rax,%rdi
+    132e:	e8 42 1b 00 00       	call   2e75 <strcmp>
+    1333:	85 c0                	test   %eax,%eax
+    1335:	74 62                	je     1399 <shmtest+0x323>
+    error("parent saw '%s' in the segment, wanted 'child'", p);
+    1337:	8b 05 c3 4c 00 00    	mov    0x4cc3(%rip),%eax        # 6000 <stdout>
+    133d:	ba f8 00 00 00       	mov    $0xf8,%edx
+    1342:	48 8d 0d 37 2e 00 00 	lea    0x2e37(%rip),%rcx        # 4180 <benchreport+0x171>
+    1349:	48 89 ce             	mov    %rcx,%rsi
+    134c:	89 c7                	mov    %eax,%edi
+    134e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1353:	e8 ea 11 00 00       	call   2542 <printf>
+    1358:	8b 05 a2 4c 00 00    	mov    0x4ca2(%rip),%eax        # 6000 <stdout>
+    135e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1362:	48 8d 0d ff 31 00 00 	lea    0x31ff(%rip),%rcx        # 4568 <benchreport+0x559>
+    1369:	48 89 ce             	mov    %rcx,%rsi
+    136c:	89 c7                	mov    %eax,%edi
+    136e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1373:	e8 ca 11 00 00       	call   2542 <printf>
+    1378:	8b 05 82 4c 00 00    	mov    0x4c82(%rip),%eax        # 6000 <stdout>
+    137e:	48 8d 15 26 2e 00 00 	lea    0x2e26(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1385:	48 89 d6             	mov    %rdx,%rsi
+    1388:	89 c7                	mov    %eax,%edi
+    138a:	b8 00 00 00 00       	mov    $0x0,%eax
+    138f:	e8 ae 11 00 00       	call   2542 <printf>
+    1394:	e8 d9 17 00 00       	call   2b72 <exit>
+  if (shmdt(p) < 0)
+    1399:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    139d:	48 89 c7             	mov    %rax,%rdi
+    13a0:	e8 61 24 00 00       	call   3806 <shmdt>
+    13a5:	85 c0                	test   %eax,%eax
+    13a7:	79 5e                	jns    1407 <shmtest+0x391>
+    error("shmdt failed");
+    13a9:	8b 05 51 4c 00 00    	mov    0x4c51(%rip),%eax        # 6000 <stdout>
+    13af:	ba fa 00 00 00       	mov    $0xfa,%edx
+    13b4:	48 8d 0d c5 2d 00 00 	lea    0x2dc5(%rip),%rcx        # 4180 <benchreport+0x171>
+    13bb:	48 89 ce             	mov    %rcx,%rsi
+    13be:	89 c7                	mov    %eax,%edi
+    13c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    13c5:	e8 78 11 00 00       	call   2542 <printf>
+    13ca:	8b 05 30 4c 00 00    	mov    0x4c30(%rip),%eax        # 6000 <stdout>
+    13d0:	48 8d 15 c0 31 00 00 	lea    0x31c0(%rip),%rdx        # 4597 <benchreport+0x588>
+    13d7:	48 89 d6             	mov    %rdx,%rsi
+    13da:	89 c7                	mov    %eax,%edi
+    13dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e1:	e8 5c 11 00 00       	call   2542 <printf>
+    13e6:	8b 05 14 4c 00 00    	mov    0x4c14(%rip),%eax        # 6000 <stdout>
+    13ec:	48 8d 15 b8 2d 00 00 	lea    0x2db8(%rip),%rdx        # 41ab <benchreport+0x19c>
+    13f3:	48 89 d6             	mov    %rdx,%rsi
+    13f6:	89 c7                	mov    %eax,%edi
+    13f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13fd:	e8 40 11 00 00       	call   2542 <printf>
+    1402:	e8 6b 17 00 00       	call   2b72 <exit>
+  printf(stdout, "shmtest ok\n");
+    1407:	8b 05 f3 4b 00 00    	mov    0x4bf3(%rip),%eax        # 6000 <stdout>
+    140d:	48 8d 15 90 31 00 00 	lea    0x3190(%rip),%rdx        # 45a4 <benchreport+0x595>
+    1414:	48 89 d6             	mov    %rdx,%rsi
+    1417:	89 c7                	mov    %eax,%edi
+    1419:	b8 00 00 00 00       	mov    $0x0,%eax
+    141e:	e8 1f 11 00 00       	call   2542 <printf>
+}
+    1423:	90                   	nop
+    1424:	c9                   	leave
+    1425:	c3                   	ret
+
+0000000000001426 <bufcmp>:
+
+// 0 if the n bytes at a and b are the same
+static int bufcmp(char *a, char *b, int n) {
+    1426:	55                   	push   %rbp
+    1427:	48 89 e5             	mov    %rsp,%rbp
+    142a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    142e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1432:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  while (n-- > 0)
+    1435:	eb 29                	jmp    1460 <bufcmp+0x3a>
+    if (*a++ != *b++)
+    1437:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    143b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    143f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    1443:	0f b6 08             	movzbl (%rax),%ecx
+    1446:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    144a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    144e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1452:	0f b6 00             	movzbl (%rax),%eax
+    1455:	38 c1                	cmp    %al,%cl
+    1457:	74 07                	je     1460 <bufcmp+0x3a>
+      return 1;
+    1459:	b8 01 00 00 00       	mov    $0x1,%eax
+    145e:	eb 12                	jmp    1472 <bufcmp+0x4c>
+  while (n-- > 0)
+    1460:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1463:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1466:	89 55 ec             	mov    %edx,-0x14(%rbp)
+    1469:	85 c0                	test   %eax,%eax
+    146b:	7f ca                	jg     1437 <bufcmp+0x11>
+  return 0;
+    146d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1472:	5d                   	pop    %rbp
+    1473:	c3                   	ret
+
+0000000000001474 <clonefiletest>:
+
+// A clone reads as its source did, and writing it afterwards leaves
+// the source as it was.
+void clonefiletest(void) {
+    1474:	55                   	push   %rbp
+    1475:	48 89 e5             	mov    %rsp,%rbp
+    1478:	48 83 ec 20          	sub    $0x20,%rsp
+  int src, dst, i;
+  struct stat st;
+
+  printf(stdout, "clonefiletest\n");
+    147c:	8b 05 7e 4b 00 00    	mov    0x4b7e(%rip),%eax        # 6000 <stdout>
+    1482:	48 8d 15 27 31 00 00 	lea    0x3127(%rip),%rdx        # 45b0 <benchreport+0x5a1>
+    1489:	48 89 d6             	mov    %rdx,%rsi
+    148c:	89 c7                	mov    %eax,%edi
+    148e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1493:	e8 aa 10 00 00       	call   2542 <printf>
+  if ((src = open("clonesrc.txt", O_CREATE | O_RDWR)) < 0 ||
+    1498:	be 02 02 00 00       	mov    $0x202,%esi
+    149d:	48 8d 05 1b 31 00 00 	lea    0x311b(%rip),%rax        # 45bf <benchreport+0x5b0>
+    14a4:	48 89 c7             	mov    %rax,%rdi
+    14a7:	e8 a2 21 00 00       	call   364e <open>
+    14ac:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    14af:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    14b3:	78 1d                	js     14d2 <clonefiletest+0x5e>
+      (dst = open("clonedst.txt", O_CREATE | O_RDWR)) < 0)
+    14b5:	be 02 02 00 00       	mov    $0x202,%esi
+    14ba:	48 8d 05 0b 31 00 00 	lea    0x310b(%rip),%rax        # 45cc <benchreport+0x5bd>
+    14c1:	48 89 c7             	mov    %rax,%rdi
+    14c4:	e8 85 21 00 00       	call   364e <open>
+    14c9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if ((src = open("clonesrc.txt", O_CREATE | O_RDWR)) < 0 ||
+    14cc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    14d0:	79 5e                	jns    1530 <clonefiletest+0xbc>
+    error("create 'clonesrc.txt' or 'clonedst.txt' failed");
+    14d2:	8b 05 28 4b 00 00    	mov    0x4b28(%rip),%eax        # 6000 <stdout>
+    14d8:	ba 0f 01 00 00       	mov    $0x10f,%edx
+    14dd:	48 8d 0d 9c 2c 00 00 	lea    0x2c9c(%rip),%rcx        # 4180 <benchreport+0x171>
+    14e4:	48 89 ce             	mov    %rcx,%rsi
+    14e7:	89 c7                	mov    %eax,%edi
+    14e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    14ee:	e8 4f 10 00 00       	call   2542 <printf>
+    14f3:	8b 05 07 4b 00 00    	mov    0x4b07(%rip),%eax        # 6000 <stdout>
+    14f9:	48 8d 15 e0 30 00 00 	lea    0x30e0(%rip),%rdx        # 45e0 <benchreport+0x5d1>
+    1500:	48 89 d6             	mov    %rdx,%rsi
+    1503:	89 c7                	mov    %eax,%edi
+    1505:	b8 00 00 00 00       	mov    $0x0,%eax
+    150a:	e8 33 10 00 00       	call   2542 <printf>
+    150f:	8b 05 eb 4a 00 00    	mov    0x4aeb(%rip),%eax        # 6000 <stdout>
+    1515:	48 8d 15 8f 2c 00 00 	lea    0x2c8f(%rip),%rdx        # 41ab <benchreport+0x19c>
+    151c:	48 89 d6             	mov    %rdx,%rsi
+    151f:	89 c7                	mov    %eax,%edi
+    1521:	b8 00 00 00 00       	mov    $0x0,%eax
+    1526:	e8 17 10 00 00       	call   2542 <printf>
+    152b:	e8 42 16 00 00       	call   2b72 <exit>
+  for (i = 0; i < sizeof(buf); i++)
+    1530:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1537:	eb 3c                	jmp    1575 <clonefiletest+0x101>
+    buf[i] = 'A' + i % 26;
+    1539:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    153c:	48 63 d0             	movslq %eax,%rdx
+    153f:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+    1546:	48 c1 ea 20          	shr    $0x20,%rdx
+    154a:	c1 fa 03             	sar    $0x3,%edx
+    154d:	89 c1                	mov    %eax,%ecx
+    154f:	c1 f9 1f             	sar    $0x1f,%ecx
+    1552:	29 ca                	sub    %ecx,%edx
+    1554:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+    1557:	29 c8                	sub    %ecx,%eax
+    1559:	89 c2                	mov    %eax,%edx
+    155b:	89 d0                	mov    %edx,%eax
+    155d:	83 c0 41             	add    $0x41,%eax
+    1560:	89 c1                	mov    %eax,%ecx
+    1562:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1565:	48 98                	cltq
+    1567:	48 8d 15 f2 4a 00 00 	lea    0x4af2(%rip),%rdx        # 6060 <buf>
+    156e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for (i = 0; i < sizeof(buf); i++)
+    1571:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1575:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1578:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+    157d:	76 ba                	jbe    1539 <clonefiletest+0xc5>
+  if (write(src, buf, sizeof(buf)) != sizeof(buf))
+    157f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1582:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1587:	48 8d 0d d2 4a 00 00 	lea    0x4ad2(%rip),%rcx        # 6060 <buf>
+    158e:	48 89 ce             	mov    %rcx,%rsi
+    1591:	89 c7                	mov    %eax,%edi
+    1593:	e8 8a 20 00 00       	call   3622 <write>
+    1598:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    159d:	74 5e                	je     15fd <clonefiletest+0x189>
+    error("write to 'clonesrc.txt' failed");
+    159f:	8b 05 5b 4a 00 00    	mov    0x4a5b(%rip),%eax        # 6000 <stdout>
+    15a5:	ba 13 01 00 00       	mov    $0x113,%edx
+    15aa:	48 8d 0d cf 2b 00 00 	lea    0x2bcf(%rip),%rcx        # 4180 <benchreport+0x171>
+    15b1:	48 89 ce             	mov    %rcx,%rsi
+    15b4:	89 c7                	mov    %eax,%edi
+    15b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    15bb:	e8 82 0f 00 00       	call   2542 <printf>
+    15c0:	8b 05 3a 4a 00 00    	mov    0x4a3a(%rip),%eax        # 6000 <stdout>
+    15c6:	48 8d 15 43 30 00 00 	lea    0x3043(%rip),%rdx        # 4610 <benchreport+0x601>
+    15cd:	48 89 d6             	mov    %rdx,%rsi
+    15d0:	89 c7                	mov    %eax,%edi
+    15d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    15d7:	e8 66 0f 00 00       	call   2542 <printf>
+    15dc:	8b 05 1e 4a 00 00    	mov    0x4a1e(%rip),%eax        # 6000 <stdout>
+    15e2:	48 8d 15 c2 2b 00 00 	lea    0x2bc2(%rip),%rdx        # 41ab <benchreport+0x19c>
+    15e9:	48 89 d6             	mov    %rdx,%rsi
+    15ec:	89 c7                	mov    %eax,%edi
+    15ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    15f3:	e8 4a 0f 00 00       	call   2542 <printf>
+    15f8:	e8 75 15 00 00       	call   2b72 <exit>
+  if (clone_file(src, dst) < 0)
+    15fd:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1600:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1603:	89 d6                	mov    %edx,%esi
+    1605:	89 c7                	mov    %eax,%edi
+    1607:	e8 31 22 00 00       	call   383d <clone_file>
+    160c:	85 c0                	test   %eax,%eax
+    160e:	79 5e                	jns    166e <clonefiletest+0x1fa>
+    error("clone_file failed");
+    1610:	8b 05 ea 49 00 00    	mov    0x49ea(%rip),%eax        # 6000 <stdout>
+    1616:	ba 15 01 00 00       	mov    $0x115,%edx
+    161b:	48 8d 0d 5e 2b 00 00 	lea    0x2b5e(%rip),%rcx        # 4180 <benchreport+0x171>
+    1622:	48 89 ce             	mov    %rcx,%rsi
+    1625:	89 c7                	mov    %eax,%edi
+    1627:	b8 00 00 00 00       	mov    $0x0,%eax
+    162c:	e8 11 0f 00 00       	call   2542 <printf>
+    1631:	8b 05 c9 49 00 00    	mov    0x49c9(%rip),%eax        # 6000 <stdout>
+    1637:	48 8d 15 f1 2f 00 00 	lea    0x2ff1(%rip),%rdx        # 462f <benchreport+0x620>
+    163e:	48 89 d6             	mov    %rdx,%rsi
+    1641:	89 c7                	mov    %eax,%edi
+    1643:	b8 00 00 00 00       	mov    $0x0,%eax
+    1648:	e8 f5 0e 00 00       	call   2542 <printf>
+    164d:	8b 05 ad 49 00 00    	mov    0x49ad(%rip),%eax        # 6000 <stdout>
+    1653:	48 8d 15 51 2b 00 00 	lea    0x2b51(%rip),%rdx        # 41ab <benchreport+0x19c>
+    165a:	48 89 d6             	mov    %rdx,%rsi
+    165d:	89 c7                	mov    %eax,%edi
+    165f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1664:	e8 d9 0e 00 00       	call   2542 <printf>
+    1669:	e8 04 15 00 00       	call   2b72 <exit>
+
+  if (fstat(dst, &st) < 0 || st.size != sizeof(buf))
+    166e:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    1672:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1675:	48 89 d6             	mov    %rdx,%rsi
+    1678:	89 c7                	mov    %eax,%edi
+    167a:	e8 f0 1f 00 00       	call   366f <fstat>
+    167f:	85 c0                	test   %eax,%eax
+    1681:	78 0a                	js     168d <clonefiletest+0x219>
+    1683:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1686:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    168b:	74 63                	je     16f0 <clonefiletest+0x27c>
+    error("clone's size was not %d", sizeof(buf));
+    168d:	8b 05 6d 49 00 00    	mov    0x496d(%rip),%eax        # 6000 <stdout>
+    1693:	ba 18 01 00 00       	mov    $0x118,%edx
+    1698:	48 8d 0d e1 2a 00 00 	lea    0x2ae1(%rip),%rcx        # 4180 <benchreport+0x171>
+    169f:	48 89 ce             	mov    %rcx,%rsi
+    16a2:	89 c7                	mov    %eax,%edi
+    16a4:	b8 00 00 00 00       	mov    $0x0,%eax
+    16a9:	e8 94 0e 00 00       	call   2542 <printf>
+    16ae:	8b 05 4c 49 00 00    	mov    0x494c(%rip),%eax        # 6000 <stdout>
+    16b4:	ba 00 20 00 00       	mov    $0x2000,%edx
+    16b9:	48 8d 0d 81 2f 00 00 	lea    0x2f81(%rip),%rcx        # 4641 <benchreport+0x632>
+    16c0:	48 89 ce             	mov    %rcx,%rsi
+    16c3:	89 c7                	mov    %eax,%edi
+    16c5:	b8 00 00 00 00       	mov    $0x0,%eax
+    16ca:	e8 73 0e 00 00       	call   2542 <printf>
+    16cf:	8b 05 2b 49 00 00    	mov    0x492b(%rip),%eax        # 6000 <stdout>
+    16d5:	48 8d 15 cf 2a 00 00 	lea    0x2acf(%rip),%rdx        # 41ab <benchreport+0x19c>
+    16dc:	48 89 d6             	mov    %rdx,%rsi
+    16df:	89 c7                	mov    %eax,%edi
+    16e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e6:	e8 57 0e 00 00       	call   2542 <printf>
+    16eb:	e8 82 14 00 00       	call   2b72 <exit>
+  if (pread(dst, buf2, sizeof(buf2), 0) != sizeof(buf2) ||
+    16f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    16f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+    16f8:	ba 00 20 00 00       	mov    $0x2000,%edx
+    16fd:	48 8d 35 5c 69 00 00 	lea    0x695c(%rip),%rsi        # 8060 <buf2>
+    1704:	89 c7                	mov    %eax,%edi
+    1706:	e8 09 20 00 00       	call   3714 <pread>
+    170b:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1710:	75 22                	jne    1734 <clonefiletest+0x2c0>
+      bufcmp(buf, buf2, sizeof(buf)) != 0)
+    1712:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1717:	48 8d 05 42 69 00 00 	lea    0x6942(%rip),%rax        # 8060 <buf2>
+    171e:	48 89 c6             	mov    %rax,%rsi
+    1721:	48 8d 05 38 49 00 00 	lea    0x4938(%rip),%rax        # 6060 <buf>
+    1728:	48 89 c7             	mov    %rax,%rdi
+    172b:	e8 f6 fc ff ff       	call   1426 <bufcmp>
+  if (pread(dst, buf2, sizeof(buf2), 0) != sizeof(buf2) ||
+    1730:	85 c0                	test   %eax,%eax
+    1732:	74 5e                	je     1792 <clonefiletest+0x31e>
+    error("clone did not read as its source");
+    1734:	8b 05 c6 48 00 00    	mov    0x48c6(%rip),%eax        # 6000 <stdout>
+    173a:	ba 1b 01 00 00       	mov    $0x11b,%edx
+    173f:	48 8d 0d 3a 2a 00 00 	lea    0x2a3a(%rip),%rcx        # 4180 <benchreport+0x171>
+    1746:	48 89 ce             	mov    %rcx,%rsi
+    1749:	89 c7                	mov    %eax,%edi
+    174b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1750:	e8 ed 0d 00 00       	call   2542 <printf>
+    1755:	8b 05 a5 48 00 00    	mov    0x48a5(%rip),%eax        # 6000 <stdout>
+    175b:	48 8d 15 fe 2e 00 00 	lea    0x2efe(%rip),%rdx        # 4660 <benchreport+0x651>
+    1762:	48 89 d6             	mov    %rdx,%rsi
+    1765:	89 c7                	mov    %eax,%edi
+    1767:	b8 00 00 00 00       	mov    $0x0,%eax
+    176c:	e8 d1 0d 00 00       	call   2542 <printf>
+    1771:	8b 05 89 48 00 00    	mov    0x4889(%rip),%eax        # 6000 <stdout>
+    1777:	48 8d 15 2d 2a 00 00 	lea    0x2a2d(%rip),%rdx        # 41ab <benchreport+0x19c>
+    177e:	48 89 d6             	mov    %rdx,%rsi
+    1781:	89 c7                	mov    %eax,%edi
+    1783:	b8 00 00 00 00       	mov    $0x0,%eax
+    1788:	e8 b5 0d 00 00       	call   2542 <printf>
+    178d:	e8 e0 13 00 00       	call   2b72 <exit>
+
+  if (pwrite(dst, "clone", 5, 100) != 5)
+    1792:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1795:	b9 64 00 00 00       	mov    $0x64,%ecx
+    179a:	ba 05 00 00 00       	mov    $0x5,%edx
+    179f:	48 8d 35 db 2e 00 00 	lea    0x2edb(%rip),%rsi        # 4681 <benchreport+0x672>
+    17a6:	89 c7                	mov    %eax,%edi
+    17a8:	e8 72 1f 00 00       	call   371f <pwrite>
+    17ad:	83 f8 05             	cmp    $0x5,%eax
+    17b0:	74 5e                	je     1810 <clonefiletest+0x39c>
+    error("write to the clone failed");
+    17b2:	8b 05 48 48 00 00    	mov    0x4848(%rip),%eax        # 6000 <stdout>
+    17b8:	ba 1e 01 00 00       	mov    $0x11e,%edx
+    17bd:	48 8d 0d bc 29 00 00 	lea    0x29bc(%rip),%rcx        # 4180 <benchreport+0x171>
+    17c4:	48 89 ce             	mov    %rcx,%rsi
+    17c7:	89 c7                	mov    %eax,%edi
+    17c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    17ce:	e8 6f 0d 00 00       	call   2542 <printf>
+    17d3:	8b 05 27 48 00 00    	mov    0x4827(%rip),%eax        # 6000 <stdout>
+    17d9:	48 8d 15 a7 2e 00 00 	lea    0x2ea7(%rip),%rdx        # 4687 <benchreport+0x678>
+    17e0:	48 89 d6             	mov    %rdx,%rsi
+    17e3:	89 c7                	mov    %eax,%edi
+    17e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    17ea:	e8 53 0d 00 00       	call   2542 <printf>
+    17ef:	8b 05 0b 48 00 00    	mov    0x480b(%rip),%eax        # 6000 <stdout>
+    17f5:	48 8d 15 af 29 00 00 	lea    0x29af(%rip),%rdx        # 41ab <benchreport+0x19c>
+    17fc:	48 89 d6             	mov    %rdx,%rsi
+    17ff:	89 c7                	mov    %eax,%edi
+    1801:	b8 00 00 00 00       	mov    $0x0,%eax
+    1806:	e8 37 0d 00 00       	call   2542 <printf>
+    180b:	e8 62 13 00 00       	call   2b72 <exit>
+  if (pread(src, buf2, sizeof(buf2), 0) != sizeof(buf2) ||
+    1810:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1813:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1818:	ba 00 20 00 00       	mov    $0x2000,%edx
+    181d:	48 8d 35 3c 68 00 00 	lea    0x683c(%rip),%rsi        # 8060 <buf2>
+    1824:	89 c7                	mov    %eax,%edi
+    1826:	e8 e9 1e 00 00       	call   3714 <pread>
+    182b:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1830:	75 22                	jne    1854 <clonefiletest+0x3e0>
+      bufcmp(buf, buf2, sizeof(buf)) != 0)
+    1832:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1837:	48 8d 05 22 68 00 00 	lea    0x6822(%rip),%rax        # 8060 <buf2>
+    183e:	48 89 c6             	mov    %rax,%rsi
+    1841:	48 8d 05 18 48 00 00 	lea    0x4818(%rip),%rax        # 6060 <buf>
+    1848:	48 89 c7             	mov    %rax,%rdi
+    184b:	e8 d6 fb ff ff       	call   1426 <bufcmp>
+  if (pread(src, buf2, sizeof(buf2), 0) != sizeof(buf2) ||
+    1850:	85 c0                	test   %eax,%eax
+    1852:	74 5e                	je     18b2 <clonefiletest+0x43e>
+    error("writing the clone changed its source");
+    1854:	8b 05 a6 47 00 00    	mov    0x47a6(%rip),%eax        # 6000 <stdout>
+    185a:	ba 21 01 00 00       	mov    $0x121,%edx
+    185f:	48 8d 0d 1a 29 00 00 	lea    0x291a(%rip),%rcx        # 4180 <benchreport+0x171>
+    1866:	48 89 ce             	mov    %rcx,%rsi
+    1869:	89 c7                	mov    %eax,%edi
+    186b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1870:	e8 cd 0c 00 00       	call   2542 <printf>
+    1875:	8b 05 85 47 00 00    	mov    0x4785(%rip),%eax        # 6000 <stdout>
+    187b:	48 8d 15 26 2e 00 00 	lea    0x2e26(%rip),%rdx        # 46a8 <benchreport+0x699>
+    1882:	48 89 d6             	mov    %rdx,%rsi
+    1885:	89 c7                	mov    %eax,%edi
+    1887:	b8 00 00 00 00       	mov    $0x0,%eax
+    188c:	e8 b1 0c 00 00       	call   2542 <printf>
+    1891:	8b 05 69 47 00 00    	mov    0x4769(%rip),%eax        # 6000 <stdout>
+    1897:	48 8d 15 0d 29 00 00 	lea    0x290d(%rip),%rdx        # 41ab <benchreport+0x19c>
+    189e:	48 89 d6             	mov    %rdx,%rsi
+    18a1:	89 c7                	mov    %eax,%edi
+    18a3:	b8 00 00 00 00       	mov    $0x0,%eax
+    18a8:	e8 95 0c 00 00       	call   2542 <printf>
+    18ad:	e8 c0 12 00 00       	call   2b72 <exit>
+  if (pread(dst, buf2, 5, 100) != 5 || bufcmp(buf2, "clone", 5) != 0)
+    18b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18b5:	b9 64 00 00 00       	mov    $0x64,%ecx
+    18ba:	ba 05 00 00 00       	mov    $0x5,%edx
+    18bf:	48 8d 35 9a 67 00 00 	lea    0x679a(%rip),%rsi        # 8060 <buf2>
+    18c6:	89 c7                	mov    %eax,%edi
+    18c8:	e8 47 1e 00 00       	call   3714 <pread>
+    18cd:	83 f8 05             	cmp    $0x5,%eax
+    18d0:	75 22                	jne    18f4 <clonefiletest+0x480>
+    18d2:	ba 05 00 00 00       	mov    $0x5,%edx
+    18d7:	48 8d 05 a3 2d 00 00 	lea    0x2da3(%rip),%rax        # 4681 <benchreport+0x672>
+    18de:	48 89 c6             	mov    %rax,%rsi
+    18e1:	48 8d 05 78 67 00 00 	lea    0x6778(%rip),%rax        # 8060 <buf2>
+    18e8:	48 89 c7             	mov    %rax,%rdi
+    18eb:	e8 36 fb ff ff       	call   1426 <bufcmp>
+    18f0:	85 c0                	test   %eax,%eax
+    18f2:	74 5e                	je     1952 <clonefiletest+0x4de>
+    error("clone did not read back its own write");
+    18f4:	8b 05 06 47 00 00    	mov    0x4706(%rip),%eax        # 6000 <stdout>
+    18fa:	ba 23 01 00 00       	mov    $0x123,%edx
+    18ff:	48 8d 0d 7a 28 00 00 	lea    0x287a(%rip),%rcx        # 4180 <benchreport+0x171>
+    1906:	48 89 ce             	mov    %rcx,%rsi
+    1909:	89 c7                	mov    %eax,%edi
+    190b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1910:	e8 2d 0c 00 00       	call   2542 <printf>
+    1915:	8b 05 e5 46 00 00    	mov    0x46e5(%rip),%eax        # 6000 <stdout>
+    191b:	48 8d 15 ae 2d 00 00 	lea    0x2dae(%rip),%rdx        # 46d0 <benchreport+0x6c1>
+    1922:	48 89 d6             	mov    %rdx,%rsi
+    1925:	89 c7                	mov    %eax,%edi
+    1927:	b8 00 00 00 00       	mov    $0x0,%eax
+    192c:	e8 11 0c 00 00       	call   2542 <printf>
+    1931:	8b 05 c9 46 00 00    	mov    0x46c9(%rip),%eax        # 6000 <stdout>
+    1937:	48 8d 15 6d 28 00 00 	lea    0x286d(%rip),%rdx        # 41ab <benchreport+0x19c>
+    193e:	48 89 d6             	mov    %rdx,%rsi
+    1941:	89 c7                	mov    %eax,%edi
+    1943:	b8 00 00 00 00       	mov    $0x0,%eax
+    1948:	e8 f5 0b 00 00       	call   2542 <printf>
+    194d:	e8 20 12 00 00       	call   2b72 <exit>
+
+  close(src);
+    1952:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1955:	89 c7                	mov    %eax,%edi
+    1957:	e8 80 12 00 00       	call   2bdc <close>
+  close(dst);
+    195c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    195f:	89 c7                	mov    %eax,%edi
+    1961:	e8 76 12 00 00       	call   2bdc <close>
+  unlink("clonesrc.txt");
+    1966:	48 8d 05 52 2c 00 00 	lea    0x2c52(%rip),%rax        # 45bf <benchreport+0x5b0>
+    196d:	48 89 c7             	mov    %rax,%rdi
+    1970:	e8 ef 1c 00 00       	call   3664 <unlink>
+  unlink("clonedst.txt");
+    1975:	48 8d 05 50 2c 00 00 	lea    0x2c50(%rip),%rax        # 45cc <benchreport+0x5bd>
+    197c:	48 89 c7             	mov    %rax,%rdi
+    197f:	e8 e0 1c 00 00       	call   3664 <unlink>
+  printf(stdout, "clonefiletest ok\n");
+    1984:	8b 05 76 46 00 00    	mov    0x4676(%rip),%eax        # 6000 <stdout>
+    198a:	48 8d 15 65 2d 00 00 	lea    0x2d65(%rip),%rdx        # 46f6 <benchreport+0x6e7>
+    1991:	48 89 d6             	mov    %rdx,%rsi
+    1994:	89 c7                	mov    %eax,%edi
+    1996:	b8 00 00 00 00       	mov    $0x0,%eax
+    199b:	e8 a2 0b 00 00       	call   2542 <printf>
+}
+    19a0:	90                   	nop
+    19a1:	c9                   	leave
+    19a2:	c3                   	ret
+
+00000000000019a3 <punchtest>:
+
+// A punched range reads back as zeros, the rest of the file and its
+// size are untouched, and a write into the hole lands.
+void punchtest(void) {
+    19a3:	55                   	push   %rbp
+    19a4:	48 89 e5             	mov    %rsp,%rbp
+    19a7:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, i;
+  struct stat st;
+
+  printf(stdout, "punchtest\n");
+    19ab:	8b 05 4f 46 00 00    	mov    0x464f(%rip),%eax        # 6000 <stdout>
+    19b1:	48 8d 15 50 2d 00 00 	lea    0x2d50(%rip),%rdx        # 4708 <benchreport+0x6f9>
+    19b8:	48 89 d6             	mov    %rdx,%rsi
+    19bb:	89 c7                	mov    %eax,%edi
+    19bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    19c2:	e8 7b 0b 00 00       	call   2542 <printf>
+  if ((fd = open("punch.txt", O_CREATE | O_RDWR)) < 0)
+    19c7:	be 02 02 00 00       	mov    $0x202,%esi
+    19cc:	48 8d 05 40 2d 00 00 	lea    0x2d40(%rip),%rax        # 4713 <benchreport+0x704>
+    19d3:	48 89 c7             	mov    %rax,%rdi
+    19d6:	e8 73 1c 00 00       	call   364e <open>
+    19db:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    19de:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    19e2:	79 5e                	jns    1a42 <punchtest+0x9f>
+    error("create 'punch.txt' failed");
+    19e4:	8b 05 16 46 00 00    	mov    0x4616(%rip),%eax        # 6000 <stdout>
+    19ea:	ba 34 01 00 00       	mov    $0x134,%edx
+    19ef:	48 8d 0d 8a 27 00 00 	lea    0x278a(%rip),%rcx        # 4180 <benchreport+0x171>
+    19f6:	48 89 ce             	mov    %rcx,%rsi
+    19f9:	89 c7                	mov    %eax,%edi
+    19fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a00:	e8 3d 0b 00 00       	call   2542 <printf>
+    1a05:	8b 05 f5 45 00 00    	mov    0x45f5(%rip),%eax        # 6000 <stdout>
+    1a0b:	48 8d 15 0b 2d 00 00 	lea    0x2d0b(%rip),%rdx        # 471d <benchreport+0x70e>
+    1a12:	48 89 d6             	mov    %rdx,%rsi
+    1a15:	89 c7                	mov    %eax,%edi
+    1a17:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a1c:	e8 21 0b 00 00       	call   2542 <printf>
+    1a21:	8b 05 d9 45 00 00    	mov    0x45d9(%rip),%eax        # 6000 <stdout>
+    1a27:	48 8d 15 7d 27 00 00 	lea    0x277d(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1a2e:	48 89 d6             	mov    %rdx,%rsi
+    1a31:	89 c7                	mov    %eax,%edi
+    1a33:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a38:	e8 05 0b 00 00       	call   2542 <printf>
+    1a3d:	e8 30 11 00 00       	call   2b72 <exit>
+  memset(buf, 'p', sizeof(buf));
+    1a42:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1a47:	be 70 00 00 00       	mov    $0x70,%esi
+    1a4c:	48 8d 05 0d 46 00 00 	lea    0x460d(%rip),%rax        # 6060 <buf>
+    1a53:	48 89 c7             	mov    %rax,%rdi
+    1a56:	e8 09 15 00 00       	call   2f64 <memset>
+  if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+    1a5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1a5e:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1a63:	48 8d 0d f6 45 00 00 	lea    0x45f6(%rip),%rcx        # 6060 <buf>
+    1a6a:	48 89 ce             	mov    %rcx,%rsi
+    1a6d:	89 c7                	mov    %eax,%edi
+    1a6f:	e8 ae 1b 00 00       	call   3622 <write>
+    1a74:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1a79:	74 5e                	je     1ad9 <punchtest+0x136>
+    error("write to 'punch.txt' failed");
+    1a7b:	8b 05 7f 45 00 00    	mov    0x457f(%rip),%eax        # 6000 <stdout>
+    1a81:	ba 37 01 00 00       	mov    $0x137,%edx
+    1a86:	48 8d 0d f3 26 00 00 	lea    0x26f3(%rip),%rcx        # 4180 <benchreport+0x171>
+    1a8d:	48 89 ce             	mov    %rcx,%rsi
+    1a90:	89 c7                	mov    %eax,%edi
+    1a92:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a97:	e8 a6 0a 00 00       	call   2542 <printf>
+    1a9c:	8b 05 5e 45 00 00    	mov    0x455e(%rip),%eax        # 6000 <stdout>
+    1aa2:	48 8d 15 8e 2c 00 00 	lea    0x2c8e(%rip),%rdx        # 4737 <benchreport+0x728>
+    1aa9:	48 89 d6             	mov    %rdx,%rsi
+    1aac:	89 c7                	mov    %eax,%edi
+    1aae:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ab3:	e8 8a 0a 00 00       	call   2542 <printf>
+    1ab8:	8b 05 42 45 00 00    	mov    0x4542(%rip),%eax        # 6000 <stdout>
+    1abe:	48 8d 15 e6 26 00 00 	lea    0x26e6(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1ac5:	48 89 d6             	mov    %rdx,%rsi
+    1ac8:	89 c7                	mov    %eax,%edi
+    1aca:	b8 00 00 00 00       	mov    $0x0,%eax
+    1acf:	e8 6e 0a 00 00       	call   2542 <printf>
+    1ad4:	e8 99 10 00 00       	call   2b72 <exit>
+  if (fpunch(fd, 1000, 5000) < 0)
+    1ad9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1adc:	ba 88 13 00 00       	mov    $0x1388,%edx
+    1ae1:	be e8 03 00 00       	mov    $0x3e8,%esi
+    1ae6:	89 c7                	mov    %eax,%edi
+    1ae8:	e8 5b 1d 00 00       	call   3848 <fpunch>
+    1aed:	85 c0                	test   %eax,%eax
+    1aef:	79 5e                	jns    1b4f <punchtest+0x1ac>
+    error("fpunch failed");
+    1af1:	8b 05 09 45 00 00    	mov    0x4509(%rip),%eax        # 6000 <stdout>
+    1af7:	ba 39 01 00 00       	mov    $0x139,%edx
+    1afc:	48 8d 0d 7d 26 00 00 	lea    0x267d(%rip),%rcx        # 4180 <benchreport+0x171>
+    1b03:	48 89 ce             	mov    %rcx,%rsi
+    1b06:	89 c7                	mov    %eax,%edi
+    1b08:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b0d:	e8 30 0a 00 00       	call   2542 <printf>
+    1b12:	8b 05 e8 44 00 00    	mov    0x44e8(%rip),%eax        # 6000 <stdout>
+    1b18:	48 8d 15 34 2c 00 00 	lea    0x2c34(%rip),%rdx        # 4753 <benchreport+0x744>
+    1b1f:	48 89 d6             	mov    %rdx,%rsi
+    1b22:	89 c7                	mov    %eax,%edi
+    1b24:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b29:	e8 14 0a 00 00       	call   2542 <printf>
+    1b2e:	8b 05 cc 44 00 00    	mov    0x44cc(%rip),%eax        # 6000 <stdout>
+    1b34:	48 8d 15 70 26 00 00 	lea    0x2670(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1b3b:	48 89 d6             	mov    %rdx,%rsi
+    1b3e:	89 c7                	mov    %eax,%edi
+    1b40:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b45:	e8 f8 09 00 00       	call   2542 <printf>
+    1b4a:	e8 23 10 00 00       	call   2b72 <exit>
+  if (pwrite(fd, "h", 1, 3000) != 1)
+    1b4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1b52:	b9 b8 0b 00 00       	mov    $0xbb8,%ecx
+    1b57:	ba 01 00 00 00       	mov    $0x1,%edx
+    1b5c:	48 8d 35 fe 2b 00 00 	lea    0x2bfe(%rip),%rsi        # 4761 <benchreport+0x752>
+    1b63:	89 c7                	mov    %eax,%edi
+    1b65:	e8 b5 1b 00 00       	call   371f <pwrite>
+    1b6a:	83 f8 01             	cmp    $0x1,%eax
+    1b6d:	74 5e                	je     1bcd <punchtest+0x22a>
+    error("write into the hole failed");
+    1b6f:	8b 05 8b 44 00 00    	mov    0x448b(%rip),%eax        # 6000 <stdout>
+    1b75:	ba 3b 01 00 00       	mov    $0x13b,%edx
+    1b7a:	48 8d 0d ff 25 00 00 	lea    0x25ff(%rip),%rcx        # 4180 <benchreport+0x171>
+    1b81:	48 89 ce             	mov    %rcx,%rsi
+    1b84:	89 c7                	mov    %eax,%edi
+    1b86:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b8b:	e8 b2 09 00 00       	call   2542 <printf>
+    1b90:	8b 05 6a 44 00 00    	mov    0x446a(%rip),%eax        # 6000 <stdout>
+    1b96:	48 8d 15 c6 2b 00 00 	lea    0x2bc6(%rip),%rdx        # 4763 <benchreport+0x754>
+    1b9d:	48 89 d6             	mov    %rdx,%rsi
+    1ba0:	89 c7                	mov    %eax,%edi
+    1ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ba7:	e8 96 09 00 00       	call   2542 <printf>
+    1bac:	8b 05 4e 44 00 00    	mov    0x444e(%rip),%eax        # 6000 <stdout>
+    1bb2:	48 8d 15 f2 25 00 00 	lea    0x25f2(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1bb9:	48 89 d6             	mov    %rdx,%rsi
+    1bbc:	89 c7                	mov    %eax,%edi
+    1bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bc3:	e8 7a 09 00 00       	call   2542 <printf>
+    1bc8:	e8 a5 0f 00 00       	call   2b72 <exit>
+
+  if (pread(fd, buf, sizeof(buf), 0) != sizeof(buf))
+    1bcd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1bd5:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1bda:	48 8d 35 7f 44 00 00 	lea    0x447f(%rip),%rsi        # 6060 <buf>
+    1be1:	89 c7                	mov    %eax,%edi
+    1be3:	e8 2c 1b 00 00       	call   3714 <pread>
+    1be8:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1bed:	74 5e                	je     1c4d <punchtest+0x2aa>
+    error("read of 'punch.txt' was short");
+    1bef:	8b 05 0b 44 00 00    	mov    0x440b(%rip),%eax        # 6000 <stdout>
+    1bf5:	ba 3e 01 00 00       	mov    $0x13e,%edx
+    1bfa:	48 8d 0d 7f 25 00 00 	lea    0x257f(%rip),%rcx        # 4180 <benchreport+0x171>
+    1c01:	48 89 ce             	mov    %rcx,%rsi
+    1c04:	89 c7                	mov    %eax,%edi
+    1c06:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c0b:	e8 32 09 00 00       	call   2542 <printf>
+    1c10:	8b 05 ea 43 00 00    	mov    0x43ea(%rip),%eax        # 6000 <stdout>
+    1c16:	48 8d 15 61 2b 00 00 	lea    0x2b61(%rip),%rdx        # 477e <benchreport+0x76f>
+    1c1d:	48 89 d6             	mov    %rdx,%rsi
+    1c20:	89 c7                	mov    %eax,%edi
+    1c22:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c27:	e8 16 09 00 00       	call   2542 <printf>
+    1c2c:	8b 05 ce 43 00 00    	mov    0x43ce(%rip),%eax        # 6000 <stdout>
+    1c32:	48 8d 15 72 25 00 00 	lea    0x2572(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1c39:	48 89 d6             	mov    %rdx,%rsi
+    1c3c:	89 c7                	mov    %eax,%edi
+    1c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c43:	e8 fa 08 00 00       	call   2542 <printf>
+    1c48:	e8 25 0f 00 00       	call   2b72 <exit>
+  for (i = 0; i < sizeof(buf); i++) {
+    1c4d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1c54:	e9 c2 00 00 00       	jmp    1d1b <punchtest+0x378>
+    char want = i == 3000 ? 'h' : i >= 1000 && i < 6000 ? 0 : 'p';
+    1c59:	81 7d fc b8 0b 00 00 	cmpl   $0xbb8,-0x4(%rbp)
+    1c60:	74 20                	je     1c82 <punchtest+0x2df>
+    1c62:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+    1c69:	7e 10                	jle    1c7b <punchtest+0x2d8>
+    1c6b:	81 7d fc 6f 17 00 00 	cmpl   $0x176f,-0x4(%rbp)
+    1c72:	7f 07                	jg     1c7b <punchtest+0x2d8>
+    1c74:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c79:	eb 0c                	jmp    1c87 <punchtest+0x2e4>
+    1c7b:	b8 70 00 00 00       	mov    $0x70,%eax
+    1c80:	eb 05                	jmp    1c87 <punchtest+0x2e4>
+    1c82:	b8 68 00 00 00       	mov    $0x68,%eax
+    1c87:	88 45 f7             	mov    %al,-0x9(%rbp)
+    if (buf[i] != want)
+    1c8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c8d:	48 98                	cltq
+    1c8f:	48 8d 15 ca 43 00 00 	lea    0x43ca(%rip),%rdx        # 6060 <buf>
+    1c96:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    1c9a:	38 45 f7             	cmp    %al,-0x9(%rbp)
+    1c9d:	74 78                	je     1d17 <punchtest+0x374>
+      error("byte %d was %d, wanted %d", i, buf[i], want);
+    1c9f:	8b 05 5b 43 00 00    	mov    0x435b(%rip),%eax        # 6000 <stdout>
+    1ca5:	ba 42 01 00 00       	mov    $0x142,%edx
+    1caa:	48 8d 0d cf 24 00 00 	lea    0x24cf(%rip),%rcx        # 4180 <benchreport+0x171>
+    1cb1:	48 89 ce             	mov    %rcx,%rsi
+    1cb4:	89 c7                	mov    %eax,%edi
+    1cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cbb:	e8 82 08 00 00       	call   2542 <printf>
+    1cc0:	0f be 75 f7          	movsbl -0x9(%rbp),%esi
+    1cc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cc7:	48 98                	cltq
+    1cc9:	48 8d 15 90 43 00 00 	lea    0x4390(%rip),%rdx        # 6060 <buf>
+    1cd0:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    1cd4:	0f be c8             	movsbl %al,%ecx
+    1cd7:	8b 05 23 43 00 00    	mov    0x4323(%rip),%eax        # 6000 <stdout>
+    1cdd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ce0:	41 89 f0             	mov    %esi,%r8d
+    1ce3:	48 8d 35 b2 2a 00 00 	lea    0x2ab2(%rip),%rsi        # 479c <benchreport+0x78d>
+    1cea:	89 c7                	mov    %eax,%edi
+    1cec:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cf1:	e8 4c 08 00 00       	call   2542 <printf>
+    1cf6:	8b 05 04 43 00 00    	mov    0x4304(%rip),%eax        # 6000 <stdout>
+    1cfc:	48 8d 15 a8 24 00 00 	lea    0x24a8(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1d03:	48 89 d6             	mov    %rdx,%rsi
+    1d06:	89 c7                	mov    %eax,%edi
+    1d08:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d0d:	e8 30 08 00 00       	call   2542 <printf>
+    1d12:	e8 5b 0e 00 00       	call   2b72 <exit>
+  for (i = 0; i < sizeof(buf); i++) {
+    1d17:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1d1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d1e:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+    1d23:	0f 86 30 ff ff ff    	jbe    1c59 <punchtest+0x2b6>
+  }
+  if (fstat(fd, &st) < 0 || st.size != sizeof(buf))
+    1d29:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+    1d2d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d30:	48 89 d6             	mov    %rdx,%rsi
+    1d33:	89 c7                	mov    %eax,%edi
+    1d35:	e8 35 19 00 00       	call   366f <fstat>
+    1d3a:	85 c0                	test   %eax,%eax
+    1d3c:	78 0a                	js     1d48 <punchtest+0x3a5>
+    1d3e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1d41:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1d46:	74 61                	je     1da9 <punchtest+0x406>
+    error("fpunch changed the size to %d", st.size);
+    1d48:	8b 05 b2 42 00 00    	mov    0x42b2(%rip),%eax        # 6000 <stdout>
+    1d4e:	ba 45 01 00 00       	mov    $0x145,%edx
+    1d53:	48 8d 0d 26 24 00 00 	lea    0x2426(%rip),%rcx        # 4180 <benchreport+0x171>
+    1d5a:	48 89 ce             	mov    %rcx,%rsi
+    1d5d:	89 c7                	mov    %eax,%edi
+    1d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d64:	e8 d9 07 00 00       	call   2542 <printf>
+    1d69:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1d6c:	8b 05 8e 42 00 00    	mov    0x428e(%rip),%eax        # 6000 <stdout>
+    1d72:	48 8d 0d 3d 2a 00 00 	lea    0x2a3d(%rip),%rcx        # 47b6 <benchreport+0x7a7>
+    1d79:	48 89 ce             	mov    %rcx,%rsi
+    1d7c:	89 c7                	mov    %eax,%edi
+    1d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d83:	e8 ba 07 00 00       	call   2542 <printf>
+    1d88:	8b 05 72 42 00 00    	mov    0x4272(%rip),%eax        # 6000 <stdout>
+    1d8e:	48 8d 15 16 24 00 00 	lea    0x2416(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1d95:	48 89 d6             	mov    %rdx,%rsi
+    1d98:	89 c7                	mov    %eax,%edi
+    1d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d9f:	e8 9e 07 00 00       	call   2542 <printf>
+    1da4:	e8 c9 0d 00 00       	call   2b72 <exit>
+
+  close(fd);
+    1da9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1dac:	89 c7                	mov    %eax,%edi
+    1dae:	e8 29 0e 00 00       	call   2bdc <close>
+  unlink("punch.txt");
+    1db3:	48 8d 05 59 29 00 00 	lea    0x2959(%rip),%rax        # 4713 <benchreport+0x704>
+    1dba:	48 89 c7             	mov    %rax,%rdi
+    1dbd:	e8 a2 18 00 00       	call   3664 <unlink>
+  printf(stdout, "punchtest ok\n");
+    1dc2:	8b 05 38 42 00 00    	mov    0x4238(%rip),%eax        # 6000 <stdout>
+    1dc8:	48 8d 15 05 2a 00 00 	lea    0x2a05(%rip),%rdx        # 47d4 <benchreport+0x7c5>
+    1dcf:	48 89 d6             	mov    %rdx,%rsi
+    1dd2:	89 c7                	mov    %eax,%edi
+    1dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dd9:	e8 64 07 00 00       	call   2542 <printf>
+}
+    1dde:	90                   	nop
+    1ddf:	c9                   	leave
+    1de0:	c3                   	ret
+
+0000000000001de1 <gaptest>:
+
+// A file that grows by appends is given blocks ahead of its writes,
+// which hold whatever they last held.  A write past the end that
+// leaves a gap over them must still read back zeros in the gap, even
+// when the blocks were just freed by a file full of other data.
+void gaptest(void) {
+    1de1:	55                   	push   %rbp
+    1de2:	48 89 e5             	mov    %rsp,%rbp
+    1de5:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, i, end;
+  struct stat st;
+
+  printf(stdout, "gaptest\n");
+    1de9:	8b 05 11 42 00 00    	mov    0x4211(%rip),%eax        # 6000 <stdout>
+    1def:	48 8d 15 ec 29 00 00 	lea    0x29ec(%rip),%rdx        # 47e2 <benchreport+0x7d3>
+    1df6:	48 89 d6             	mov    %rdx,%rsi
+    1df9:	89 c7                	mov    %eax,%edi
+    1dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e00:	e8 3d 07 00 00       	call   2542 <printf>
+  if ((fd = open("junk.txt", O_CREATE | O_RDWR)) < 0)
+    1e05:	be 02 02 00 00       	mov    $0x202,%esi
+    1e0a:	48 8d 05 da 29 00 00 	lea    0x29da(%rip),%rax        # 47eb <benchreport+0x7dc>
+    1e11:	48 89 c7             	mov    %rax,%rdi
+    1e14:	e8 35 18 00 00       	call   364e <open>
+    1e19:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1e1c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1e20:	79 5e                	jns    1e80 <gaptest+0x9f>
+    error("create 'junk.txt' failed");
+    1e22:	8b 05 d8 41 00 00    	mov    0x41d8(%rip),%eax        # 6000 <stdout>
+    1e28:	ba 56 01 00 00       	mov    $0x156,%edx
+    1e2d:	48 8d 0d 4c 23 00 00 	lea    0x234c(%rip),%rcx        # 4180 <benchreport+0x171>
+    1e34:	48 89 ce             	mov    %rcx,%rsi
+    1e37:	89 c7                	mov    %eax,%edi
+    1e39:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e3e:	e8 ff 06 00 00       	call   2542 <printf>
+    1e43:	8b 05 b7 41 00 00    	mov    0x41b7(%rip),%eax        # 6000 <stdout>
+    1e49:	48 8d 15 a4 29 00 00 	lea    0x29a4(%rip),%rdx        # 47f4 <benchreport+0x7e5>
+    1e50:	48 89 d6             	mov    %rdx,%rsi
+    1e53:	89 c7                	mov    %eax,%edi
+    1e55:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e5a:	e8 e3 06 00 00       	call   2542 <printf>
+    1e5f:	8b 05 9b 41 00 00    	mov    0x419b(%rip),%eax        # 6000 <stdout>
+    1e65:	48 8d 15 3f 23 00 00 	lea    0x233f(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1e6c:	48 89 d6             	mov    %rdx,%rsi
+    1e6f:	89 c7                	mov    %eax,%edi
+    1e71:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e76:	e8 c7 06 00 00       	call   2542 <printf>
+    1e7b:	e8 f2 0c 00 00       	call   2b72 <exit>
+  memset(buf, 'j', sizeof(buf));
+    1e80:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1e85:	be 6a 00 00 00       	mov    $0x6a,%esi
+    1e8a:	48 8d 05 cf 41 00 00 	lea    0x41cf(%rip),%rax        # 6060 <buf>
+    1e91:	48 89 c7             	mov    %rax,%rdi
+    1e94:	e8 cb 10 00 00       	call   2f64 <memset>
+  for (i = 0; i < 8; i++)
+    1e99:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1ea0:	e9 82 00 00 00       	jmp    1f27 <gaptest+0x146>
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+    1ea5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ea8:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1ead:	48 8d 0d ac 41 00 00 	lea    0x41ac(%rip),%rcx        # 6060 <buf>
+    1eb4:	48 89 ce             	mov    %rcx,%rsi
+    1eb7:	89 c7                	mov    %eax,%edi
+    1eb9:	e8 64 17 00 00       	call   3622 <write>
+    1ebe:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1ec3:	74 5e                	je     1f23 <gaptest+0x142>
+      error("write to 'junk.txt' failed");
+    1ec5:	8b 05 35 41 00 00    	mov    0x4135(%rip),%eax        # 6000 <stdout>
+    1ecb:	ba 5a 01 00 00       	mov    $0x15a,%edx
+    1ed0:	48 8d 0d a9 22 00 00 	lea    0x22a9(%rip),%rcx        # 4180 <benchreport+0x171>
+    1ed7:	48 89 ce             	mov    %rcx,%rsi
+    1eda:	89 c7                	mov    %eax,%edi
+    1edc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ee1:	e8 5c 06 00 00       	call   2542 <printf>
+    1ee6:	8b 05 14 41 00 00    	mov    0x4114(%rip),%eax        # 6000 <stdout>
+    1eec:	48 8d 15 1a 29 00 00 	lea    0x291a(%rip),%rdx        # 480d <benchreport+0x7fe>
+    1ef3:	48 89 d6             	mov    %rdx,%rsi
+    1ef6:	89 c7                	mov    %eax,%edi
+    1ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+    1efd:	e8 40 06 00 00       	call   2542 <printf>
+    1f02:	8b 05 f8 40 00 00    	mov    0x40f8(%rip),%eax        # 6000 <stdout>
+    1f08:	48 8d 15 9c 22 00 00 	lea    0x229c(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1f0f:	48 89 d6             	mov    %rdx,%rsi
+    1f12:	89 c7                	mov    %eax,%edi
+    1f14:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f19:	e8 24 06 00 00       	call   2542 <printf>
+    1f1e:	e8 4f 0c 00 00       	call   2b72 <exit>
+  for (i = 0; i < 8; i++)
+    1f23:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1f27:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1f2b:	0f 8e 74 ff ff ff    	jle    1ea5 <gaptest+0xc4>
+  close(fd);
+    1f31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1f34:	89 c7                	mov    %eax,%edi
+    1f36:	e8 a1 0c 00 00       	call   2bdc <close>
+  if (unlink("junk.txt") < 0)
+    1f3b:	48 8d 05 a9 28 00 00 	lea    0x28a9(%rip),%rax        # 47eb <benchreport+0x7dc>
+    1f42:	48 89 c7             	mov    %rax,%rdi
+    1f45:	e8 1a 17 00 00       	call   3664 <unlink>
+    1f4a:	85 c0                	test   %eax,%eax
+    1f4c:	79 5e                	jns    1fac <gaptest+0x1cb>
+    error("unlink 'junk.txt' failed");
+    1f4e:	8b 05 ac 40 00 00    	mov    0x40ac(%rip),%eax        # 6000 <stdout>
+    1f54:	ba 5d 01 00 00       	mov    $0x15d,%edx
+    1f59:	48 8d 0d 20 22 00 00 	lea    0x2220(%rip),%rcx        # 4180 <benchreport+0x171>
+    1f60:	48 89 ce             	mov    %rcx,%rsi
+    1f63:	89 c7                	mov    %eax,%edi
+    1f65:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f6a:	e8 d3 05 00 00       	call   2542 <printf>
+    1f6f:	8b 05 8b 40 00 00    	mov    0x408b(%rip),%eax        # 6000 <stdout>
+    1f75:	48 8d 15 ac 28 00 00 	lea    0x28ac(%rip),%rdx        # 4828 <benchreport+0x819>
+    1f7c:	48 89 d6             	mov    %rdx,%rsi
+    1f7f:	89 c7                	mov    %eax,%edi
+    1f81:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f86:	e8 b7 05 00 00       	call   2542 <printf>
+    1f8b:	8b 05 6f 40 00 00    	mov    0x406f(%rip),%eax        # 6000 <stdout>
+    1f91:	48 8d 15 13 22 00 00 	lea    0x2213(%rip),%rdx        # 41ab <benchreport+0x19c>
+    1f98:	48 89 d6             	mov    %rdx,%rsi
+    1f9b:	89 c7                	mov    %eax,%edi
+    1f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fa2:	e8 9b 05 00 00       	call   2542 <printf>
+    1fa7:	e8 c6 0b 00 00       	call   2b72 <exit>
+
+  // The second write appends, and gets blocks past it preallocated
+  if ((fd = open("gap.txt", O_CREATE | O_RDWR)) < 0)
+    1fac:	be 02 02 00 00       	mov    $0x202,%esi
+    1fb1:	48 8d 05 89 28 00 00 	lea    0x2889(%rip),%rax        # 4841 <benchreport+0x832>
+    1fb8:	48 89 c7             	mov    %rax,%rdi
+    1fbb:	e8 8e 16 00 00       	call   364e <open>
+    1fc0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1fc3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1fc7:	79 5e                	jns    2027 <gaptest+0x246>
+    error("create 'gap.txt' failed");
+    1fc9:	8b 05 31 40 00 00    	mov    0x4031(%rip),%eax        # 6000 <stdout>
+    1fcf:	ba 61 01 00 00       	mov    $0x161,%edx
+    1fd4:	48 8d 0d a5 21 00 00 	lea    0x21a5(%rip),%rcx        # 4180 <benchreport+0x171>
+    1fdb:	48 89 ce             	mov    %rcx,%rsi
+    1fde:	89 c7                	mov    %eax,%edi
+    1fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fe5:	e8 58 05 00 00       	call   2542 <printf>
+    1fea:	8b 05 10 40 00 00    	mov    0x4010(%rip),%eax        # 6000 <stdout>
+    1ff0:	48 8d 15 52 28 00 00 	lea    0x2852(%rip),%rdx        # 4849 <benchreport+0x83a>
+    1ff7:	48 89 d6             	mov    %rdx,%rsi
+    1ffa:	89 c7                	mov    %eax,%edi
+    1ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+    2001:	e8 3c 05 00 00       	call   2542 <printf>
+    2006:	8b 05 f4 3f 00 00    	mov    0x3ff4(%rip),%eax        # 6000 <stdout>
+    200c:	48 8d 15 98 21 00 00 	lea    0x2198(%rip),%rdx        # 41ab <benchreport+0x19c>
+    2013:	48 89 d6             	mov    %rdx,%rsi
+    2016:	89 c7                	mov    %eax,%edi
+    2018:	b8 00 00 00 00       	mov    $0x0,%eax
+    201d:	e8 20 05 00 00       	call   2542 <printf>
+    2022:	e8 4b 0b 00 00       	call   2b72 <exit>
+  memset(buf, 'g', sizeof(buf));
+    2027:	ba 00 20 00 00       	mov    $0x2000,%edx
+    202c:	be 67 00 00 00       	mov    $0x67,%esi
+    2031:	48 8d 05 28 40 00 00 	lea    0x4028(%rip),%rax        # 6060 <buf>
+    2038:	48 89 c7             	mov    %rax,%rdi
+    203b:	e8 24 0f 00 00       	call   2f64 <memset>
+  if (write(fd, buf, 4096) != 4096 || write(fd, buf, 100) != 100)
+    2040:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2043:	ba 00 10 00 00       	mov    $0x1000,%edx
+    2048:	48 8d 0d 11 40 00 00 	lea    0x4011(%rip),%rcx        # 6060 <buf>
+    204f:	48 89 ce             	mov    %rcx,%rsi
+    2052:	89 c7                	mov    %eax,%edi
+    2054:	e8 c9 15 00 00       	call   3622 <write>
+    2059:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    205e:	75 1e                	jne    207e <gaptest+0x29d>
+    2060:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2063:	ba 64 00 00 00       	mov    $0x64,%edx
+    2068:	48 8d 0d f1 3f 00 00 	lea    0x3ff1(%rip),%rcx        # 6060 <buf>
+    206f:	48 89 ce             	mov    %rcx,%rsi
+    2072:	89 c7                	mov    %eax,%edi
+    2074:	e8 a9 15 00 00       	call   3622 <write>
+    2079:	83 f8 64             	cmp    $0x64,%eax
+    207c:	74 5e                	je     20dc <gaptest+0x2fb>
+    error("write to 'gap.txt' failed");
+    207e:	8b 05 7c 3f 00 00    	mov    0x3f7c(%rip),%eax        # 6000 <stdout>
+    2084:	ba 64 01 00 00       	mov    $0x164,%edx
+    2089:	48 8d 0d f0 20 00 00 	lea    0x20f0(%rip),%rcx        # 4180 <benchreport+0x171>
+    2090:	48 89 ce             	mov    %rcx,%rsi
+    2093:	89 c7                	mov    %eax,%edi
+    2095:	b8 00 00 00 00       	mov    $0x0,%eax
+    209a:	e8 a3 04 00 00       	call   2542 <printf>
+    209f:	8b 05 5b 3f 00 00    	mov    0x3f5b(%rip),%eax        # 6000 <stdout>
+    20a5:	48 8d 15 b5 27 00 00 	lea    0x27b5(%rip),%rdx        # 4861 <benchreport+0x852>
+    20ac:	48 89 d6             	mov    %rdx,%rsi
+    20af:	89 c7                	mov    %eax,%edi
+    20b1:	b8 00 00 00 00       	mov    $0x0,%eax
+    20b6:	e8 87 04 00 00       	call   2542 <printf>
+    20bb:	8b 05 3f 3f 00 00    	mov    0x3f3f(%rip),%eax        # 6000 <stdout>
+    20c1:	48 8d 15 e3 20 00 00 	lea    0x20e3(%rip),%rdx        # 41ab <benchreport+0x19c>
+    20c8:	48 89 d6             	mov    %rdx,%rsi
+    20cb:	89 c7                	mov    %eax,%edi
+    20cd:	b8 00 00 00 00       	mov    $0x0,%eax
+    20d2:	e8 6b 04 00 00       	call   2542 <printf>
+    20d7:	e8 96 0a 00 00       	call   2b72 <exit>
+  end = 4196 + 3000;
+    20dc:	c7 45 f4 1c 1c 00 00 	movl   $0x1c1c,-0xc(%rbp)
+  if (pwrite(fd, "end", 3, end) != 3)
+    20e3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    20e6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    20e9:	89 d1                	mov    %edx,%ecx
+    20eb:	ba 03 00 00 00       	mov    $0x3,%edx
+    20f0:	48 8d 35 84 27 00 00 	lea    0x2784(%rip),%rsi        # 487b <benchreport+0x86c>
+    20f7:	89 c7                	mov    %eax,%edi
+    20f9:	e8 21 16 00 00       	call   371f <pwrite>
+    20fe:	83 f8 03             	cmp    $0x3,%eax
+    2101:	74 5e                	je     2161 <gaptest+0x380>
+    error("write past the end of 'gap.txt' failed");
+    2103:	8b 05 f7 3e 00 00    	mov    0x3ef7(%rip),%eax        # 6000 <stdout>
+    2109:	ba 67 01 00 00       	mov    $0x167,%edx
+    210e:	48 8d 0d 6b 20 00 00 	lea    0x206b(%rip),%rcx        # 4180 <benchreport+0x171>
+    2115:	48 89 ce             	mov    %rcx,%rsi
+    2118:	89 c7                	mov    %eax,%edi
+    211a:	b8 00 00 00 00       	mov    $0x0,%eax
+    211f:	e8 1e 04 00 00       	call   2542 <printf>
+    2124:	8b 05 d6 3e 00 00    	mov    0x3ed6(%rip),%eax        # 6000 <stdout>
+    212a:	48 8d 15 4f 27 00 00 	lea    0x274f(%rip),%rdx        # 4880 <benchreport+0x871>
+    2131:	48 89 d6             	mov    %rdx,%rsi
+    2134:	89 c7                	mov    %eax,%edi
+    2136:	b8 00 00 00 00       	mov    $0x0,%eax
+    213b:	e8 02 04 00 00       	call   2542 <printf>
+    2140:	8b 05 ba 3e 00 00    	mov    0x3eba(%rip),%eax        # 6000 <stdout>
+    2146:	48 8d 15 5e 20 00 00 	lea    0x205e(%rip),%rdx        # 41ab <benchreport+0x19c>
+    214d:	48 89 d6             	mov    %rdx,%rsi
+    2150:	89 c7                	mov    %eax,%edi
+    2152:	b8 00 00 00 00       	mov    $0x0,%eax
+    2157:	e8 e6 03 00 00       	call   2542 <printf>
+    215c:	e8 11 0a 00 00       	call   2b72 <exit>
+
+  if (fstat(fd, &st) < 0 || st.size != end + 3)
+    2161:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+    2165:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2168:	48 89 d6             	mov    %rdx,%rsi
+    216b:	89 c7                	mov    %eax,%edi
+    216d:	e8 fd 14 00 00       	call   366f <fstat>
+    2172:	85 c0                	test   %eax,%eax
+    2174:	78 0d                	js     2183 <gaptest+0x3a2>
+    2176:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2179:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    217c:	83 c2 03             	add    $0x3,%edx
+    217f:	39 d0                	cmp    %edx,%eax
+    2181:	74 64                	je     21e7 <gaptest+0x406>
+    error("size was %d, wanted %d", st.size, end + 3);
+    2183:	8b 05 77 3e 00 00    	mov    0x3e77(%rip),%eax        # 6000 <stdout>
+    2189:	ba 6a 01 00 00       	mov    $0x16a,%edx
+    218e:	48 8d 0d eb 1f 00 00 	lea    0x1feb(%rip),%rcx        # 4180 <benchreport+0x171>
+    2195:	48 89 ce             	mov    %rcx,%rsi
+    2198:	89 c7                	mov    %eax,%edi
+    219a:	b8 00 00 00 00       	mov    $0x0,%eax
+    219f:	e8 9e 03 00 00       	call   2542 <printf>
+    21a4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    21a7:	8d 48 03             	lea    0x3(%rax),%ecx
+    21aa:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    21ad:	8b 05 4d 3e 00 00    	mov    0x3e4d(%rip),%eax        # 6000 <stdout>
+    21b3:	48 8d 35 ed 26 00 00 	lea    0x26ed(%rip),%rsi        # 48a7 <benchreport+0x898>
+    21ba:	89 c7                	mov    %eax,%edi
+    21bc:	b8 00 00 00 00       	mov    $0x0,%eax
+    21c1:	e8 7c 03 00 00       	call   2542 <printf>
+    21c6:	8b 05 34 3e 00 00    	mov    0x3e34(%rip),%eax        # 6000 <stdout>
+    21cc:	48 8d 15 d8 1f 00 00 	lea    0x1fd8(%rip),%rdx        # 41ab <benchreport+0x19c>
+    21d3:	48 89 d6             	mov    %rdx,%rsi
+    21d6:	89 c7                	mov    %eax,%edi
+    21d8:	b8 00 00 00 00       	mov    $0x0,%eax
+    21dd:	e8 60 03 00 00       	call   2542 <printf>
+    21e2:	e8 8b 09 00 00       	call   2b72 <exit>
+  if (pread(fd, buf, end + 3, 0) != end + 3)
+    21e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    21ea:	8d 50 03             	lea    0x3(%rax),%edx
+    21ed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    21f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    21f5:	48 8d 35 64 3e 00 00 	lea    0x3e64(%rip),%rsi        # 6060 <buf>
+    21fc:	89 c7                	mov    %eax,%edi
+    21fe:	e8 11 15 00 00       	call   3714 <pread>
+    2203:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2206:	83 c2 03             	add    $0x3,%edx
+    2209:	39 d0                	cmp    %edx,%eax
+    220b:	74 5e                	je     226b <gaptest+0x48a>
+    error("read of 'gap.txt' was short");
+    220d:	8b 05 ed 3d 00 00    	mov    0x3ded(%rip),%eax        # 6000 <stdout>
+    2213:	ba 6c 01 00 00       	mov    $0x16c,%edx
+    2218:	48 8d 0d 61 1f 00 00 	lea    0x1f61(%rip),%rcx        # 4180 <benchreport+0x171>
+    221f:	48 89 ce             	mov    %rcx,%rsi
+    2222:	89 c7                	mov    %eax,%edi
+    2224:	b8 00 00 00 00       	mov    $0x0,%eax
+    2229:	e8 14 03 00 00       	call   2542 <printf>
+    222e:	8b 05 cc 3d 00 00    	mov    0x3dcc(%rip),%eax        # 6000 <stdout>
+    2234:	48 8d 15 83 26 00 00 	lea    0x2683(%rip),%rdx        # 48be <benchreport+0x8af>
+    223b:	48 89 d6             	mov    %rdx,%rsi
+    223e:	89 c7                	mov    %eax,%edi
+    2240:	b8 00 00 00 00       	mov    $0x0,%eax
+    2245:	e8 f8 02 00 00       	call   2542 <printf>
+    224a:	8b 05 b0 3d 00 00    	mov    0x3db0(%rip),%eax        # 6000 <stdout>
+    2250:	48 8d 15 54 1f 00 00 	lea    0x1f54(%rip),%rdx        # 41ab <benchreport+0x19c>
+    2257:	48 89 d6             	mov    %rdx,%rsi
+    225a:	89 c7                	mov    %eax,%edi
+    225c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2261:	e8 dc 02 00 00       	call   2542 <printf>
+    2266:	e8 07 09 00 00       	call   2b72 <exit>
+  for (i = 0; i < end + 3; i++) {
+    226b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2272:	e9 c6 00 00 00       	jmp    233d <gaptest+0x55c>
+    char want = i < 4196 ? 'g' : i < end ? 0 : "end"[i - end];
+    2277:	81 7d fc 63 10 00 00 	cmpl   $0x1063,-0x4(%rbp)
+    227e:	7e 24                	jle    22a4 <gaptest+0x4c3>
+    2280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2283:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+    2286:	7c 15                	jl     229d <gaptest+0x4bc>
+    2288:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    228b:	2b 45 f4             	sub    -0xc(%rbp),%eax
+    228e:	48 98                	cltq
+    2290:	48 8d 15 e4 25 00 00 	lea    0x25e4(%rip),%rdx        # 487b <benchreport+0x86c>
+    2297:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    229b:	eb 0c                	jmp    22a9 <gaptest+0x4c8>
+    229d:	b8 00 00 00 00       	mov    $0x0,%eax
+    22a2:	eb 05                	jmp    22a9 <gaptest+0x4c8>
+    22a4:	b8 67 00 00 00       	mov    $0x67,%eax
+    22a9:	88 45 f3             	mov    %al,-0xd(%rbp)
+    if (buf[i] != want)
+    22ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22af:	48 98                	cltq
+    22b1:	48 8d 15 a8 3d 00 00 	lea    0x3da8(%rip),%rdx        # 6060 <buf>
+    22b8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    22bc:	38 45 f3             	cmp    %al,-0xd(%rbp)
+    22bf:	74 78                	je     2339 <gaptest+0x558>
+      error("byte %d was %d, wanted %d", i, buf[i], want);
+    22c1:	8b 05 39 3d 00 00    	mov    0x3d39(%rip),%eax        # 6000 <stdout>
+    22c7:	ba 70 01 00 00       	mov    $0x170,%edx
+    22cc:	48 8d 0d ad 1e 00 00 	lea    0x1ead(%rip),%rcx        # 4180 <benchreport+0x171>
+    22d3:	48 89 ce             	mov    %rcx,%rsi
+    22d6:	89 c7                	mov    %eax,%edi
+    22d8:	b8 00 00 00 00       	mov    $0x0,%eax
+    22dd:	e8 60 02 00 00       	call   2542 <printf>
+    22e2:	0f be 75 f3          	movsbl -0xd(%rbp),%esi
+    22e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22e9:	48 98                	cltq
+    22eb:	48 8d 15 6e 3d 00 00 	lea    0x3d6e(%rip),%rdx        # 6060 <buf>
+    22f2:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+    22f6:	0f be c8             	movsbl %al,%ecx
+    22f9:	8b 05 01 3d 00 00    	mov    0x3d01(%rip),%eax        # 6000 <stdout>
+    22ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2302:	41 89 f0             	mov    %esi,%r8d
+    2305:	48 8d 35 90 24 00 00 	lea    0x2490(%rip),%rsi        # 479c <benchreport+0x78d>
+    230c:	89 c7                	mov    %eax,%edi
+    230e:	b8 00 00 00 00       	mov    $0x0,%eax
+    2313:	e8 2a 02 00 00       	call   2542 <printf>
+    2318:	8b 05 e2 3c 00 00    	mov    0x3ce2(%rip),%eax        # 6000 <stdout>
+    231e:	48 8d 15 86 1e 00 00 	lea    0x1e86(%rip),%rdx        # 41ab <benchreport+0x19c>
+    2325:	48 89 d6             	mov    %rdx,%rsi
+    2328:	89 c7                	mov    %eax,%edi
+    232a:	b8 00 00 00 00       	mov    $0x0,%eax
+    232f:	e8 0e 02 00 00       	call   2542 <printf>
+    2334:	e8 39 08 00 00       	call   2b72 <exit>
+  for (i = 0; i < end + 3; i++) {
+    2339:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    233d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2340:	83 c0 02             	add    $0x2,%eax
+    2343:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    2346:	0f 8e 2b ff ff ff    	jle    2277 <gaptest+0x496>
+  }
+
+  close(fd);
+    234c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    234f:	89 c7                	mov    %eax,%edi
+    2351:	e8 86 08 00 00       	call   2bdc <close>
+  unlink("gap.txt");
+    2356:	48 8d 05 e4 24 00 00 	lea    0x24e4(%rip),%rax        # 4841 <benchreport+0x832>
+    235d:	48 89 c7             	mov    %rax,%rdi
+    2360:	e8 ff 12 00 00       	call   3664 <unlink>
+  printf(stdout, "gaptest ok\n");
+    2365:	8b 05 95 3c 00 00    	mov    0x3c95(%rip),%eax        # 6000 <stdout>
+    236b:	48 8d 15 68 25 00 00 	lea    0x2568(%rip),%rdx        # 48da <benchreport+0x8cb>
+    2372:	48 89 d6             	mov    %rdx,%rsi
+    2375:	89 c7                	mov    %eax,%edi
+    2377:	b8 00 00 00 00       	mov    $0x0,%eax
+    237c:	e8 c1 01 00 00       	call   2542 <printf>
+}
+    2381:	90                   	nop
+    2382:	c9                   	leave
+    2383:	c3                   	ret
+
+0000000000002384 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    2384:	55                   	push   %rbp
+    2385:	48 89 e5             	mov    %rsp,%rbp
+    2388:	48 83 ec 10          	sub    $0x10,%rsp
+    238c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    238f:	89 f0                	mov    %esi,%eax
+    2391:	88 45 f8             	mov    %al,-0x8(%rbp)
+    2394:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    2398:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    239b:	89 d6                	mov    %edx,%esi
+    239d:	89 c7                	mov    %eax,%edi
+    239f:	e8 eb 06 00 00       	call   2a8f <bputc>
+    23a4:	90                   	nop
+    23a5:	c9                   	leave
+    23a6:	c3                   	ret
+
+00000000000023a7 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    23a7:	55                   	push   %rbp
+    23a8:	48 89 e5             	mov    %rsp,%rbp
+    23ab:	48 83 ec 50          	sub    $0x50,%rsp
+    23af:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    23b2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    23b6:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    23b9:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    23bc:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    23c0:	74 21                	je     23e3 <printint64+0x3c>
+    23c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    23c6:	48 c1 e8 3f          	shr    $0x3f,%rax
+    23ca:	0f b6 c0             	movzbl %al,%eax
+    23cd:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    23d0:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    23d4:	74 0d                	je     23e3 <printint64+0x3c>
+    x = -xx;
+    23d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    23da:	48 f7 d8             	neg    %rax
+    23dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    23e1:	eb 08                	jmp    23eb <printint64+0x44>
+  else
+    x = xx;
+    23e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    23e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    23eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    23f2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    23f5:	48 63 c8             	movslq %eax,%rcx
+    23f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    23fc:	ba 00 00 00 00       	mov    $0x0,%edx
+    2401:	48 f7 f1             	div    %rcx
+    2404:	48 89 d1             	mov    %rdx,%rcx
+    2407:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    240a:	8d 50 01             	lea    0x1(%rax),%edx
+    240d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2410:	48 8d 15 f9 3b 00 00 	lea    0x3bf9(%rip),%rdx        # 6010 <digits.1>
+    2417:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    241b:	48 98                	cltq
+    241d:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    2421:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    2424:	48 63 f0             	movslq %eax,%rsi
+    2427:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    242b:	ba 00 00 00 00       	mov    $0x0,%edx
+    2430:	48 f7 f6             	div    %rsi
+    2433:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2437:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    243c:	75 b4                	jne    23f2 <printint64+0x4b>
+
+  if (sgn)
+    243e:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    2442:	74 2b                	je     246f <printint64+0xc8>
+    buf[i++] = '-';
+    2444:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2447:	8d 50 01             	lea    0x1(%rax),%edx
+    244a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    244d:	48 98                	cltq
+    244f:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    2454:	eb 19                	jmp    246f <printint64+0xc8>
+    putc(fd, buf[i]);
+    2456:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2459:	48 98                	cltq
+    245b:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    2460:	0f be d0             	movsbl %al,%edx
+    2463:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    2466:	89 d6                	mov    %edx,%esi
+    2468:	89 c7                	mov    %eax,%edi
+    246a:	e8 15 ff ff ff       	call   2384 <putc>
+  while (--i >= 0)
+    246f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    2473:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2477:	79 dd                	jns    2456 <printint64+0xaf>
+}
+    2479:	90                   	nop
+    247a:	90                   	nop
+    247b:	c9                   	leave
+    247c:	c3                   	ret
+
+000000000000247d <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    247d:	55                   	push   %rbp
+    247e:	48 89 e5             	mov    %rsp,%rbp
+    2481:	48 83 ec 30          	sub    $0x30,%rsp
+    2485:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    2488:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    248b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    248e:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    2491:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    2498:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    249c:	74 17                	je     24b5 <printint+0x38>
+    249e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    24a2:	79 11                	jns    24b5 <printint+0x38>
+    neg = 1;
+    24a4:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    24ab:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    24ae:	f7 d8                	neg    %eax
+    24b0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    24b3:	eb 06                	jmp    24bb <printint+0x3e>
+  } else {
+    x = xx;
+    24b5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    24b8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    24bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    24c2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    24c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    24c8:	ba 00 00 00 00       	mov    $0x0,%edx
+    24cd:	f7 f1                	div    %ecx
+    24cf:	89 d1                	mov    %edx,%ecx
+    24d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    24d4:	8d 50 01             	lea    0x1(%rax),%edx
+    24d7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    24da:	89 c9                	mov    %ecx,%ecx
+    24dc:	48 8d 15 4d 3b 00 00 	lea    0x3b4d(%rip),%rdx        # 6030 <digits.0>
+    24e3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    24e7:	48 98                	cltq
+    24e9:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    24ed:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    24f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    24f3:	ba 00 00 00 00       	mov    $0x0,%edx
+    24f8:	f7 f6                	div    %esi
+    24fa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    24fd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    2501:	75 bf                	jne    24c2 <printint+0x45>
+  if (neg)
+    2503:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2507:	74 2b                	je     2534 <printint+0xb7>
+    buf[i++] = '-';
+    2509:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    250c:	8d 50 01             	lea    0x1(%rax),%edx
+    250f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    2512:	48 98                	cltq
+    2514:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    2519:	eb 19                	jmp    2534 <printint+0xb7>
+    putc(fd, buf[i]);
+    251b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    251e:	48 98                	cltq
+    2520:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    2525:	0f be d0             	movsbl %al,%edx
+    2528:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    252b:	89 d6                	mov    %edx,%esi
+    252d:	89 c7                	mov    %eax,%edi
+    252f:	e8 50 fe ff ff       	call   2384 <putc>
+  while (--i >= 0)
+    2534:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    2538:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    253c:	79 dd                	jns    251b <printint+0x9e>
+}
+    253e:	90                   	nop
+    253f:	90                   	nop
+    2540:	c9                   	leave
+    2541:	c3                   	ret
+
+0000000000002542 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    2542:	55                   	push   %rbp
+    2543:	48 89 e5             	mov    %rsp,%rbp
+    2546:	48 83 ec 70          	sub    $0x70,%rsp
+    254a:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    254d:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    2551:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    2555:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2559:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    255d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    2561:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    2568:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    256c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    2570:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    2574:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    2578:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    257f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    2586:	e9 67 02 00 00       	jmp    27f2 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    258b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    258e:	48 63 d0             	movslq %eax,%rdx
+    2591:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    2595:	48 01 d0             	add    %rdx,%rax
+    2598:	0f b6 00             	movzbl (%rax),%eax
+    259b:	0f be c0             	movsbl %al,%eax
+    259e:	25 ff 00 00 00       	and    $0xff,%eax
+    25a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    25a6:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    25aa:	75 30                	jne    25dc <printf+0x9a>
+      if (c == '%') {
+    25ac:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    25b0:	75 13                	jne    25c5 <printf+0x83>
+        state = '%';
+    25b2:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    25b9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    25c0:	e9 29 02 00 00       	jmp    27ee <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    25c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    25c8:	0f be d0             	movsbl %al,%edx
+    25cb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    25ce:	89 d6                	mov    %edx,%esi
+    25d0:	89 c7                	mov    %eax,%edi
+    25d2:	e8 ad fd ff ff       	call   2384 <putc>
+    25d7:	e9 12 02 00 00       	jmp    27ee <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    25dc:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    25e0:	0f 85 08 02 00 00    	jne    27ee <printf+0x2ac>
+      if (c == 'l') {
+    25e6:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    25ea:	75 0c                	jne    25f8 <printf+0xb6>
+        lflag = 1;
+    25ec:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    25f3:	e9 f6 01 00 00       	jmp    27ee <printf+0x2ac>
+      } else if (c == 'd') {
+    25f8:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    25fc:	0f 85 93 00 00 00    	jne    2695 <printf+0x153>
+        if (lflag == 1)
+    2602:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    2606:	75 47                	jne    264f <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    2608:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    260b:	83 f8 2f             	cmp    $0x2f,%eax
+    260e:	77 17                	ja     2627 <printf+0xe5>
+    2610:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    2614:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2617:	89 d2                	mov    %edx,%edx
+    2619:	48 01 d0             	add    %rdx,%rax
+    261c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    261f:	83 c2 08             	add    $0x8,%edx
+    2622:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    2625:	eb 0c                	jmp    2633 <printf+0xf1>
+    2627:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    262b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    262f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2633:	48 8b 30             	mov    (%rax),%rsi
+    2636:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2639:	b9 01 00 00 00       	mov    $0x1,%ecx
+    263e:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2643:	89 c7                	mov    %eax,%edi
+    2645:	e8 5d fd ff ff       	call   23a7 <printint64>
+    264a:	e9 98 01 00 00       	jmp    27e7 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    264f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2652:	83 f8 2f             	cmp    $0x2f,%eax
+    2655:	77 17                	ja     266e <printf+0x12c>
+    2657:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    265b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    265e:	89 d2                	mov    %edx,%edx
+    2660:	48 01 d0             	add    %rdx,%rax
+    2663:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2666:	83 c2 08             	add    $0x8,%edx
+    2669:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    266c:	eb 0c                	jmp    267a <printf+0x138>
+    266e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2672:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2676:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    267a:	8b 30                	mov    (%rax),%esi
+    267c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    267f:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2684:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2689:	89 c7                	mov    %eax,%edi
+    268b:	e8 ed fd ff ff       	call   247d <printint>
+    2690:	e9 52 01 00 00       	jmp    27e7 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    2695:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    2699:	74 0a                	je     26a5 <printf+0x163>
+    269b:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    269f:	0f 85 93 00 00 00    	jne    2738 <printf+0x1f6>
+        if (lflag == 1)
+    26a5:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    26a9:	75 47                	jne    26f2 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    26ab:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    26ae:	83 f8 2f             	cmp    $0x2f,%eax
+    26b1:	77 17                	ja     26ca <printf+0x188>
+    26b3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    26b7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    26ba:	89 d2                	mov    %edx,%edx
+    26bc:	48 01 d0             	add    %rdx,%rax
+    26bf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    26c2:	83 c2 08             	add    $0x8,%edx
+    26c5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    26c8:	eb 0c                	jmp    26d6 <printf+0x194>
+    26ca:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    26ce:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    26d2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    26d6:	48 8b 30             	mov    (%rax),%rsi
+    26d9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    26dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+    26e1:	ba 10 00 00 00       	mov    $0x10,%edx
+    26e6:	89 c7                	mov    %eax,%edi
+    26e8:	e8 ba fc ff ff       	call   23a7 <printint64>
+        if (lflag == 1)
+    26ed:	e9 f5 00 00 00       	jmp    27e7 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    26f2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    26f5:	83 f8 2f             	cmp    $0x2f,%eax
+    26f8:	77 17                	ja     2711 <printf+0x1cf>
+    26fa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    26fe:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2701:	89 d2                	mov    %edx,%edx
+    2703:	48 01 d0             	add    %rdx,%rax
+    2706:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2709:	83 c2 08             	add    $0x8,%edx
+    270c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    270f:	eb 0c                	jmp    271d <printf+0x1db>
+    2711:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2715:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2719:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    271d:	8b 30                	mov    (%rax),%esi
+    271f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2722:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2727:	ba 10 00 00 00       	mov    $0x10,%edx
+    272c:	89 c7                	mov    %eax,%edi
+    272e:	e8 4a fd ff ff       	call   247d <printint>
+        if (lflag == 1)
+    2733:	e9 af 00 00 00       	jmp    27e7 <printf+0x2a5>
+      } else if (c == 's') {
+    2738:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    273c:	75 6e                	jne    27ac <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    273e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    2741:	83 f8 2f             	cmp    $0x2f,%eax
+    2744:	77 17                	ja     275d <printf+0x21b>
+    2746:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    274a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    274d:	89 d2                	mov    %edx,%edx
+    274f:	48 01 d0             	add    %rdx,%rax
+    2752:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    2755:	83 c2 08             	add    $0x8,%edx
+    2758:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    275b:	eb 0c                	jmp    2769 <printf+0x227>
+    275d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    2761:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2765:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    2769:	48 8b 00             	mov    (%rax),%rax
+    276c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    2770:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    2775:	75 28                	jne    279f <printf+0x25d>
+          s = "(null)";
+    2777:	48 8d 05 68 21 00 00 	lea    0x2168(%rip),%rax        # 48e6 <benchreport+0x8d7>
+    277e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    2782:	eb 1b                	jmp    279f <printf+0x25d>
+          putc(fd, *s);
+    2784:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2788:	0f b6 00             	movzbl (%rax),%eax
+    278b:	0f be d0             	movsbl %al,%edx
+    278e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    2791:	89 d6                	mov    %edx,%esi
+    2793:	89 c7                	mov    %eax,%edi
+    2795:	e8 ea fb ff ff       	call   2384 <putc>
+        for (; *s; s++)
+    279a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    279f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    27a3:	0f b6 00             	movzbl (%rax),%eax
+    27a6:	84 c0                	test   %al,%al
+    27a8:	75 da                	jne    2784 <printf+0x242>
+    27aa:	eb 3b                	jmp    27e7 <printf+0x2a5>
+      } else if (c == '%') {
+    27ac:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    27b0:	75 14                	jne    27c6 <printf+0x284>
+        putc(fd, c);
+    27b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    27b5:	0f be d0             	movsbl %al,%edx
+    27b8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    27bb:	89 d6                	mov    %edx,%esi
+    27bd:	89 c7                	mov    %eax,%edi
+    27bf:	e8 c0 fb ff ff       	call   2384 <putc>
+    27c4:	eb 21                	jmp    27e7 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    27c6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    27c9:	be 25 00 00 00       	mov    $0x25,%esi
+    27ce:	89 c7                	mov    %eax,%edi
+    27d0:	e8 af fb ff ff       	call   2384 <putc>
+        putc(fd, c);
+    27d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    27d8:	0f be d0             	movsbl %al,%edx
+    27db:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    27de:	89 d6                	mov    %edx,%esi
+    27e0:	89 c7                	mov    %eax,%edi
+    27e2:	e8 9d fb ff ff       	call   2384 <putc>
+      }
+      state = 0;
+    27e7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    27ee:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    27f2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    27f5:	48 63 d0             	movslq %eax,%rdx
+    27f8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    27fc:	48 01 d0             	add    %rdx,%rax
+    27ff:	0f b6 00             	movzbl (%rax),%eax
+    2802:	84 c0                	test   %al,%al
+    2804:	0f 85 81 fd ff ff    	jne    258b <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    280a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    280d:	89 c7                	mov    %eax,%edi
+    280f:	e8 ee 02 00 00       	call   2b02 <bflushtty>
+}
+    2814:	90                   	nop
+    2815:	c9                   	leave
+    2816:	c3                   	ret
+
+0000000000002817 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    2817:	55                   	push   %rbp
+    2818:	48 89 e5             	mov    %rsp,%rbp
+    281b:	48 83 ec 30          	sub    $0x30,%rsp
+    281f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    2822:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2826:	78 06                	js     282e <getbuf+0x17>
+    2828:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    282c:	7e 0a                	jle    2838 <getbuf+0x21>
+    return 0;
+    282e:	b8 00 00 00 00       	mov    $0x0,%eax
+    2833:	e9 94 00 00 00       	jmp    28cc <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    2838:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    283b:	48 98                	cltq
+    283d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2844:	00 
+    2845:	48 8d 05 54 b8 00 00 	lea    0xb854(%rip),%rax        # e0a0 <obufs>
+    284c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2850:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2854:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2859:	75 6d                	jne    28c8 <getbuf+0xb1>
+    285b:	bf 08 02 00 00       	mov    $0x208,%edi
+    2860:	e8 bd 13 00 00       	call   3c22 <malloc>
+    2865:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2869:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    286e:	74 58                	je     28c8 <getbuf+0xb1>
+    b->n = 0;
+    2870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2874:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    287a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    287e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2881:	48 89 d6             	mov    %rdx,%rsi
+    2884:	89 c7                	mov    %eax,%edi
+    2886:	e8 e4 0d 00 00       	call   366f <fstat>
+    288b:	85 c0                	test   %eax,%eax
+    288d:	75 11                	jne    28a0 <getbuf+0x89>
+    288f:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    2893:	66 83 f8 03          	cmp    $0x3,%ax
+    2897:	75 07                	jne    28a0 <getbuf+0x89>
+    2899:	ba 01 00 00 00       	mov    $0x1,%edx
+    289e:	eb 05                	jmp    28a5 <getbuf+0x8e>
+    28a0:	ba 00 00 00 00       	mov    $0x0,%edx
+    28a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28a9:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    28ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28af:	48 98                	cltq
+    28b1:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    28b8:	00 
+    28b9:	48 8d 15 e0 b7 00 00 	lea    0xb7e0(%rip),%rdx        # e0a0 <obufs>
+    28c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    28c4:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    28c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    28cc:	c9                   	leave
+    28cd:	c3                   	ret
+
+00000000000028ce <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    28ce:	55                   	push   %rbp
+    28cf:	48 89 e5             	mov    %rsp,%rbp
+    28d2:	48 83 ec 20          	sub    $0x20,%rsp
+    28d6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    28d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    28dd:	78 33                	js     2912 <bflush+0x44>
+    28df:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    28e3:	7f 2d                	jg     2912 <bflush+0x44>
+    28e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    28e8:	48 98                	cltq
+    28ea:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    28f1:	00 
+    28f2:	48 8d 05 a7 b7 00 00 	lea    0xb7a7(%rip),%rax        # e0a0 <obufs>
+    28f9:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    28fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2901:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2906:	74 0a                	je     2912 <bflush+0x44>
+    2908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    290c:	8b 00                	mov    (%rax),%eax
+    290e:	85 c0                	test   %eax,%eax
+    2910:	75 07                	jne    2919 <bflush+0x4b>
+    return 0;
+    2912:	b8 00 00 00 00       	mov    $0x0,%eax
+    2917:	eb 3c                	jmp    2955 <bflush+0x87>
+  n = b->n;
+    2919:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    291d:	8b 00                	mov    (%rax),%eax
+    291f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    2922:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2926:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    292c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2930:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    2934:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2937:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    293a:	48 89 ce             	mov    %rcx,%rsi
+    293d:	89 c7                	mov    %eax,%edi
+    293f:	e8 de 0c 00 00       	call   3622 <write>
+    2944:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    2947:	75 07                	jne    2950 <bflush+0x82>
+    2949:	b8 00 00 00 00       	mov    $0x0,%eax
+    294e:	eb 05                	jmp    2955 <bflush+0x87>
+    2950:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    2955:	c9                   	leave
+    2956:	c3                   	ret
+
+0000000000002957 <bflushall>:
+
+void bflushall(void) {
+    2957:	55                   	push   %rbp
+    2958:	48 89 e5             	mov    %rsp,%rbp
+    295b:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    295f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2966:	eb 0e                	jmp    2976 <bflushall+0x1f>
+    bflush(fd);
+    2968:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    296b:	89 c7                	mov    %eax,%edi
+    296d:	e8 5c ff ff ff       	call   28ce <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    2972:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2976:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    297a:	7e ec                	jle    2968 <bflushall+0x11>
+}
+    297c:	90                   	nop
+    297d:	90                   	nop
+    297e:	c9                   	leave
+    297f:	c3                   	ret
+
+0000000000002980 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    2980:	55                   	push   %rbp
+    2981:	48 89 e5             	mov    %rsp,%rbp
+    2984:	48 83 ec 30          	sub    $0x30,%rsp
+    2988:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    298b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    298f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    2992:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2995:	89 c7                	mov    %eax,%edi
+    2997:	e8 7b fe ff ff       	call   2817 <getbuf>
+    299c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    29a0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    29a5:	75 19                	jne    29c0 <bwrite+0x40>
+    return write(fd, s, n);
+    29a7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    29aa:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    29ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    29b1:	48 89 ce             	mov    %rcx,%rsi
+    29b4:	89 c7                	mov    %eax,%edi
+    29b6:	e8 67 0c 00 00       	call   3622 <write>
+    29bb:	e9 cd 00 00 00       	jmp    2a8d <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    29c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    29c7:	e9 92 00 00 00       	jmp    2a5e <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    29cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29d0:	8b 00                	mov    (%rax),%eax
+    29d2:	3d 00 02 00 00       	cmp    $0x200,%eax
+    29d7:	75 18                	jne    29f1 <bwrite+0x71>
+    29d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    29dc:	89 c7                	mov    %eax,%edi
+    29de:	e8 eb fe ff ff       	call   28ce <bflush>
+    29e3:	85 c0                	test   %eax,%eax
+    29e5:	79 0a                	jns    29f1 <bwrite+0x71>
+      return -1;
+    29e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    29ec:	e9 9c 00 00 00       	jmp    2a8d <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    29f1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    29f4:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    29f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    29fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29fe:	8b 00                	mov    (%rax),%eax
+    2a00:	ba 00 02 00 00       	mov    $0x200,%edx
+    2a05:	29 c2                	sub    %eax,%edx
+    2a07:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    2a0a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2a0d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    2a10:	39 c2                	cmp    %eax,%edx
+    2a12:	0f 4e c2             	cmovle %edx,%eax
+    2a15:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    2a18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a1b:	48 63 d0             	movslq %eax,%rdx
+    2a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2a22:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    2a26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a2a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a32:	8b 00                	mov    (%rax),%eax
+    2a34:	48 98                	cltq
+    2a36:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    2a3a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2a3d:	89 c2                	mov    %eax,%edx
+    2a3f:	48 89 cf             	mov    %rcx,%rdi
+    2a42:	e8 e9 06 00 00       	call   3130 <memmove>
+    b->n += m;
+    2a47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a4b:	8b 10                	mov    (%rax),%edx
+    2a4d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2a50:	01 c2                	add    %eax,%edx
+    2a52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a56:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    2a58:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2a5b:	01 45 fc             	add    %eax,-0x4(%rbp)
+    2a5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a61:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    2a64:	0f 8c 62 ff ff ff    	jl     29cc <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    2a6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2a6e:	8b 40 04             	mov    0x4(%rax),%eax
+    2a71:	85 c0                	test   %eax,%eax
+    2a73:	74 15                	je     2a8a <bwrite+0x10a>
+    2a75:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2a78:	89 c7                	mov    %eax,%edi
+    2a7a:	e8 4f fe ff ff       	call   28ce <bflush>
+    2a7f:	85 c0                	test   %eax,%eax
+    2a81:	79 07                	jns    2a8a <bwrite+0x10a>
+    return -1;
+    2a83:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2a88:	eb 03                	jmp    2a8d <bwrite+0x10d>
+  return n;
+    2a8a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    2a8d:	c9                   	leave
+    2a8e:	c3                   	ret
+
+0000000000002a8f <bputc>:
+
+void bputc(int fd, char c) {
+    2a8f:	55                   	push   %rbp
+    2a90:	48 89 e5             	mov    %rsp,%rbp
+    2a93:	48 83 ec 20          	sub    $0x20,%rsp
+    2a97:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    2a9a:	89 f0                	mov    %esi,%eax
+    2a9c:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    2a9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2aa2:	89 c7                	mov    %eax,%edi
+    2aa4:	e8 6e fd ff ff       	call   2817 <getbuf>
+    2aa9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2aad:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2ab2:	75 18                	jne    2acc <bputc+0x3d>
+    write(fd, &c, 1);
+    2ab4:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    2ab8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2abb:	ba 01 00 00 00       	mov    $0x1,%edx
+    2ac0:	48 89 ce             	mov    %rcx,%rsi
+    2ac3:	89 c7                	mov    %eax,%edi
+    2ac5:	e8 58 0b 00 00       	call   3622 <write>
+    return;
+    2aca:	eb 34                	jmp    2b00 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    2acc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ad0:	8b 00                	mov    (%rax),%eax
+    2ad2:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2ad7:	75 0a                	jne    2ae3 <bputc+0x54>
+    bflush(fd);
+    2ad9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2adc:	89 c7                	mov    %eax,%edi
+    2ade:	e8 eb fd ff ff       	call   28ce <bflush>
+  b->data[b->n++] = c;
+    2ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ae7:	8b 00                	mov    (%rax),%eax
+    2ae9:	8d 48 01             	lea    0x1(%rax),%ecx
+    2aec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2af0:	89 0a                	mov    %ecx,(%rdx)
+    2af2:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    2af6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    2afa:	48 98                	cltq
+    2afc:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    2b00:	c9                   	leave
+    2b01:	c3                   	ret
+
+0000000000002b02 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    2b02:	55                   	push   %rbp
+    2b03:	48 89 e5             	mov    %rsp,%rbp
+    2b06:	48 83 ec 10          	sub    $0x10,%rsp
+    2b0a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    2b0d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2b11:	78 4c                	js     2b5f <bflushtty+0x5d>
+    2b13:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    2b17:	7f 46                	jg     2b5f <bflushtty+0x5d>
+    2b19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b1c:	48 98                	cltq
+    2b1e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2b25:	00 
+    2b26:	48 8d 05 73 b5 00 00 	lea    0xb573(%rip),%rax        # e0a0 <obufs>
+    2b2d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2b31:	48 85 c0             	test   %rax,%rax
+    2b34:	74 29                	je     2b5f <bflushtty+0x5d>
+    2b36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b39:	48 98                	cltq
+    2b3b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2b42:	00 
+    2b43:	48 8d 05 56 b5 00 00 	lea    0xb556(%rip),%rax        # e0a0 <obufs>
+    2b4a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2b4e:	8b 40 04             	mov    0x4(%rax),%eax
+    2b51:	85 c0                	test   %eax,%eax
+    2b53:	74 0a                	je     2b5f <bflushtty+0x5d>
+    bflush(fd);
+    2b55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2b58:	89 c7                	mov    %eax,%edi
+    2b5a:	e8 6f fd ff ff       	call   28ce <bflush>
+}
+    2b5f:	90                   	nop
+    2b60:	c9                   	leave
+    2b61:	c3                   	ret
+
+0000000000002b62 <fork>:
+
+int fork(void) {
+    2b62:	55                   	push   %rbp
+    2b63:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    2b66:	e8 ec fd ff ff       	call   2957 <bflushall>
+  return _fork();
+    2b6b:	e8 7b 0a 00 00       	call   35eb <_fork>
+}
+    2b70:	5d                   	pop    %rbp
+    2b71:	c3                   	ret
+
+0000000000002b72 <exit>:
+
+noreturn void exit(void) {
+    2b72:	55                   	push   %rbp
+    2b73:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    2b76:	e8 dc fd ff ff       	call   2957 <bflushall>
+  _exit();
+    2b7b:	e8 76 0a 00 00       	call   35f6 <_exit>
+
+0000000000002b80 <exec>:
+}
+
+int exec(char *path, char **argv) {
+    2b80:	55                   	push   %rbp
+    2b81:	48 89 e5             	mov    %rsp,%rbp
+    2b84:	48 83 ec 10          	sub    $0x10,%rsp
+    2b88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2b8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    2b90:	e8 c2 fd ff ff       	call   2957 <bflushall>
+  return _exec(path, argv);
+    2b95:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2b99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b9d:	48 89 d6             	mov    %rdx,%rsi
+    2ba0:	48 89 c7             	mov    %rax,%rdi
+    2ba3:	e8 9b 0a 00 00       	call   3643 <_exec>
+}
+    2ba8:	c9                   	leave
+    2ba9:	c3                   	ret
+
+0000000000002baa <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    2baa:	55                   	push   %rbp
+    2bab:	48 89 e5             	mov    %rsp,%rbp
+    2bae:	48 83 ec 20          	sub    $0x20,%rsp
+    2bb2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2bb6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2bba:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    2bbe:	e8 94 fd ff ff       	call   2957 <bflushall>
+  return _spawn(path, argv, fds);
+    2bc3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2bc7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2bcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2bcf:	48 89 ce             	mov    %rcx,%rsi
+    2bd2:	48 89 c7             	mov    %rax,%rdi
+    2bd5:	e8 2f 0b 00 00       	call   3709 <_spawn>
+}
+    2bda:	c9                   	leave
+    2bdb:	c3                   	ret
+
+0000000000002bdc <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    2bdc:	55                   	push   %rbp
+    2bdd:	48 89 e5             	mov    %rsp,%rbp
+    2be0:	48 83 ec 10          	sub    $0x10,%rsp
+    2be4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    2be7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    2beb:	78 69                	js     2c56 <close+0x7a>
+    2bed:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    2bf1:	7f 63                	jg     2c56 <close+0x7a>
+    2bf3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2bf6:	48 98                	cltq
+    2bf8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2bff:	00 
+    2c00:	48 8d 05 99 b4 00 00 	lea    0xb499(%rip),%rax        # e0a0 <obufs>
+    2c07:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2c0b:	48 85 c0             	test   %rax,%rax
+    2c0e:	74 46                	je     2c56 <close+0x7a>
+    bflush(fd);
+    2c10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c13:	89 c7                	mov    %eax,%edi
+    2c15:	e8 b4 fc ff ff       	call   28ce <bflush>
+    free(obufs[fd]);
+    2c1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c1d:	48 98                	cltq
+    2c1f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2c26:	00 
+    2c27:	48 8d 05 72 b4 00 00 	lea    0xb472(%rip),%rax        # e0a0 <obufs>
+    2c2e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2c32:	48 89 c7             	mov    %rax,%rdi
+    2c35:	e8 90 11 00 00       	call   3dca <free>
+    obufs[fd] = 0;
+    2c3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c3d:	48 98                	cltq
+    2c3f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2c46:	00 
+    2c47:	48 8d 05 52 b4 00 00 	lea    0xb452(%rip),%rax        # e0a0 <obufs>
+    2c4e:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    2c55:	00 
+  }
+  return _close(fd);
+    2c56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2c59:	89 c7                	mov    %eax,%edi
+    2c5b:	e8 cd 09 00 00       	call   362d <_close>
+}
+    2c60:	c9                   	leave
+    2c61:	c3                   	ret
+
+0000000000002c62 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    2c62:	55                   	push   %rbp
+    2c63:	48 89 e5             	mov    %rsp,%rbp
+    2c66:	53                   	push   %rbx
+    2c67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2c6b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    2c6f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2c73:	48 8b 36             	mov    (%rsi),%rsi
+    2c76:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    2c7a:	48 29 f7             	sub    %rsi,%rdi
+    2c7d:	48 89 f9             	mov    %rdi,%rcx
+    2c80:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2c85:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    2c89:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    2c8d:	48 89 f0             	mov    %rsi,%rax
+    2c90:	ba 00 00 00 00       	mov    $0x0,%edx
+    2c95:	48 89 df             	mov    %rbx,%rdi
+    2c98:	48 0f af f8          	imul   %rax,%rdi
+    2c9c:	48 89 d6             	mov    %rdx,%rsi
+    2c9f:	48 0f af f1          	imul   %rcx,%rsi
+    2ca3:	48 01 fe             	add    %rdi,%rsi
+    2ca6:	48 f7 e1             	mul    %rcx
+    2ca9:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    2cad:	48 89 ca             	mov    %rcx,%rdx
+    2cb0:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    2cb5:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    2cb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2cbd:	c9                   	leave
+    2cbe:	c3                   	ret
+
+0000000000002cbf <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    2cbf:	55                   	push   %rbp
+    2cc0:	48 89 e5             	mov    %rsp,%rbp
+    2cc3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cc7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2cca:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    2ccd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2cd1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2cd4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2cd7:	48 89 ce             	mov    %rcx,%rsi
+    2cda:	48 89 f7             	mov    %rsi,%rdi
+    2cdd:	89 d1                	mov    %edx,%ecx
+    2cdf:	fc                   	cld
+    2ce0:	f3 aa                	rep stos %al,%es:(%rdi)
+    2ce2:	89 ca                	mov    %ecx,%edx
+    2ce4:	48 89 fe             	mov    %rdi,%rsi
+    2ce7:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    2ceb:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    2cee:	90                   	nop
+    2cef:	5d                   	pop    %rbp
+    2cf0:	c3                   	ret
+
+0000000000002cf1 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    2cf1:	55                   	push   %rbp
+    2cf2:	48 89 e5             	mov    %rsp,%rbp
+    2cf5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2cf9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2cfd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    2d01:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2d05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2d09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2d0d:	48 89 ce             	mov    %rcx,%rsi
+    2d10:	48 89 f7             	mov    %rsi,%rdi
+    2d13:	48 89 d1             	mov    %rdx,%rcx
+    2d16:	fc                   	cld
+    2d17:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    2d1a:	48 89 ca             	mov    %rcx,%rdx
+    2d1d:	48 89 fe             	mov    %rdi,%rsi
+    2d20:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    2d24:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    2d28:	90                   	nop
+    2d29:	5d                   	pop    %rbp
+    2d2a:	c3                   	ret
+
+0000000000002d2b <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    2d2b:	55                   	push   %rbp
+    2d2c:	48 89 e5             	mov    %rsp,%rbp
+    2d2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d33:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d37:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    2d3b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2d3f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2d43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d47:	48 89 cf             	mov    %rcx,%rdi
+    2d4a:	48 89 d6             	mov    %rdx,%rsi
+    2d4d:	48 89 c1             	mov    %rax,%rcx
+    2d50:	fc                   	cld
+    2d51:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    2d53:	48 89 c8             	mov    %rcx,%rax
+    2d56:	48 89 f2             	mov    %rsi,%rdx
+    2d59:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d5d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    2d61:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2d65:	90                   	nop
+    2d66:	5d                   	pop    %rbp
+    2d67:	c3                   	ret
+
+0000000000002d68 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    2d68:	55                   	push   %rbp
+    2d69:	48 89 e5             	mov    %rsp,%rbp
+    2d6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d70:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    2d74:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    2d78:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    2d7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2d80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2d84:	48 89 cf             	mov    %rcx,%rdi
+    2d87:	48 89 d6             	mov    %rdx,%rsi
+    2d8a:	48 89 c1             	mov    %rax,%rcx
+    2d8d:	fc                   	cld
+    2d8e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    2d91:	48 89 c8             	mov    %rcx,%rax
+    2d94:	48 89 f2             	mov    %rsi,%rdx
+    2d97:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2d9b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    2d9f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    2da3:	90                   	nop
+    2da4:	5d                   	pop    %rbp
+    2da5:	c3                   	ret
+
+0000000000002da6 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    2da6:	55                   	push   %rbp
+    2da7:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    2daa:	0f 31                	rdtsc
+    2dac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    2daf:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    2db2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2db5:	48 c1 e0 20          	shl    $0x20,%rax
+    2db9:	48 89 c2             	mov    %rax,%rdx
+    2dbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2dbf:	48 09 d0             	or     %rdx,%rax
+}
+    2dc2:	5d                   	pop    %rbp
+    2dc3:	c3                   	ret
+
+0000000000002dc4 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    2dc4:	55                   	push   %rbp
+    2dc5:	48 89 e5             	mov    %rsp,%rbp
+    2dc8:	53                   	push   %rbx
+    2dc9:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    2dcc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    2dd0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    2dd4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    2dd8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    2ddc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    2ddf:	0f a2                	cpuid
+    2de1:	89 de                	mov    %ebx,%esi
+    2de3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    2de6:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    2de9:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    2dec:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    2def:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    2df4:	74 09                	je     2dff <cpuid+0x3b>
+    *eaxp = eax;
+    2df6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2dfa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    2dfd:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    2dff:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    2e04:	74 09                	je     2e0f <cpuid+0x4b>
+    *ebxp = ebx;
+    2e06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2e0a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2e0d:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    2e0f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    2e14:	74 09                	je     2e1f <cpuid+0x5b>
+    *ecxp = ecx;
+    2e16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2e1a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2e1d:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    2e1f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    2e24:	74 09                	je     2e2f <cpuid+0x6b>
+    *edxp = edx;
+    2e26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    2e2a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    2e2d:	89 10                	mov    %edx,(%rax)
+}
+    2e2f:	90                   	nop
+    2e30:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2e34:	c9                   	leave
+    2e35:	c3                   	ret
+
+0000000000002e36 <strcpy>:
+char *strcpy(char *s, char *t) {
+    2e36:	55                   	push   %rbp
+    2e37:	48 89 e5             	mov    %rsp,%rbp
+    2e3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2e3e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    2e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    2e4a:	90                   	nop
+    2e4b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2e4f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    2e53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2e57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e5b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    2e5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    2e63:	0f b6 12             	movzbl (%rdx),%edx
+    2e66:	88 10                	mov    %dl,(%rax)
+    2e68:	0f b6 00             	movzbl (%rax),%eax
+    2e6b:	84 c0                	test   %al,%al
+    2e6d:	75 dc                	jne    2e4b <strcpy+0x15>
+  return os;
+    2e6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2e73:	5d                   	pop    %rbp
+    2e74:	c3                   	ret
+
+0000000000002e75 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    2e75:	55                   	push   %rbp
+    2e76:	48 89 e5             	mov    %rsp,%rbp
+    2e79:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2e7d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    2e81:	eb 0a                	jmp    2e8d <strcmp+0x18>
+    p++, q++;
+    2e83:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    2e88:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    2e8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e91:	0f b6 00             	movzbl (%rax),%eax
+    2e94:	84 c0                	test   %al,%al
+    2e96:	74 12                	je     2eaa <strcmp+0x35>
+    2e98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2e9c:	0f b6 10             	movzbl (%rax),%edx
+    2e9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ea3:	0f b6 00             	movzbl (%rax),%eax
+    2ea6:	38 c2                	cmp    %al,%dl
+    2ea8:	74 d9                	je     2e83 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    2eaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2eae:	0f b6 00             	movzbl (%rax),%eax
+    2eb1:	0f b6 d0             	movzbl %al,%edx
+    2eb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2eb8:	0f b6 00             	movzbl (%rax),%eax
+    2ebb:	0f b6 c0             	movzbl %al,%eax
+    2ebe:	29 c2                	sub    %eax,%edx
+    2ec0:	89 d0                	mov    %edx,%eax
+}
+    2ec2:	5d                   	pop    %rbp
+    2ec3:	c3                   	ret
+
+0000000000002ec4 <strlen>:
+uint strlen(char *s) {
+    2ec4:	55                   	push   %rbp
+    2ec5:	48 89 e5             	mov    %rsp,%rbp
+    2ec8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    2ecc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    2ed3:	eb 04                	jmp    2ed9 <strlen+0x15>
+    2ed5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2ed9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2edc:	48 63 d0             	movslq %eax,%rdx
+    2edf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2ee3:	48 01 d0             	add    %rdx,%rax
+    2ee6:	0f b6 00             	movzbl (%rax),%eax
+    2ee9:	84 c0                	test   %al,%al
+    2eeb:	75 e8                	jne    2ed5 <strlen+0x11>
+    ;
+  return n;
+    2eed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    2ef0:	5d                   	pop    %rbp
+    2ef1:	c3                   	ret
+
+0000000000002ef2 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    2ef2:	55                   	push   %rbp
+    2ef3:	48 89 e5             	mov    %rsp,%rbp
+    2ef6:	53                   	push   %rbx
+    2ef7:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    2efb:	8b 05 43 31 00 00    	mov    0x3143(%rip),%eax        # 6044 <erms>
+    2f01:	85 c0                	test   %eax,%eax
+    2f03:	79 53                	jns    2f58 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    2f05:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    2f09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    2f0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2f14:	ba 00 00 00 00       	mov    $0x0,%edx
+    2f19:	48 89 c6             	mov    %rax,%rsi
+    2f1c:	bf 00 00 00 00       	mov    $0x0,%edi
+    2f21:	e8 9e fe ff ff       	call   2dc4 <cpuid>
+    ebx = 0;
+    2f26:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    2f2d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2f30:	83 f8 06             	cmp    $0x6,%eax
+    2f33:	76 14                	jbe    2f49 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    2f35:	b8 07 00 00 00       	mov    $0x7,%eax
+    2f3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    2f3f:	0f a2                	cpuid
+    2f41:	89 d9                	mov    %ebx,%ecx
+    2f43:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    2f46:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    2f49:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2f4c:	c1 e8 09             	shr    $0x9,%eax
+    2f4f:	83 e0 01             	and    $0x1,%eax
+    2f52:	89 05 ec 30 00 00    	mov    %eax,0x30ec(%rip)        # 6044 <erms>
+  }
+  return erms;
+    2f58:	8b 05 e6 30 00 00    	mov    0x30e6(%rip),%eax        # 6044 <erms>
+}
+    2f5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    2f62:	c9                   	leave
+    2f63:	c3                   	ret
+
+0000000000002f64 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    2f64:	55                   	push   %rbp
+    2f65:	48 89 e5             	mov    %rsp,%rbp
+    2f68:	48 83 ec 10          	sub    $0x10,%rsp
+    2f6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    2f70:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    2f73:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    2f76:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    2f7a:	76 09                	jbe    2f85 <memset+0x21>
+    2f7c:	e8 71 ff ff ff       	call   2ef2 <haserms>
+    2f81:	85 c0                	test   %eax,%eax
+    2f83:	74 16                	je     2f9b <memset+0x37>
+    stosb(dst, c, n);
+    2f85:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    2f88:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    2f8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2f8f:	89 ce                	mov    %ecx,%esi
+    2f91:	48 89 c7             	mov    %rax,%rdi
+    2f94:	e8 26 fd ff ff       	call   2cbf <stosb>
+    2f99:	eb 58                	jmp    2ff3 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    2f9b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2f9e:	c1 e8 03             	shr    $0x3,%eax
+    2fa1:	89 c6                	mov    %eax,%esi
+    2fa3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2fa6:	48 98                	cltq
+    2fa8:	0f b6 c0             	movzbl %al,%eax
+    2fab:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    2fb2:	01 01 01 
+    2fb5:	48 0f af c2          	imul   %rdx,%rax
+    2fb9:	48 89 c1             	mov    %rax,%rcx
+    2fbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fc0:	48 89 f2             	mov    %rsi,%rdx
+    2fc3:	48 89 ce             	mov    %rcx,%rsi
+    2fc6:	48 89 c7             	mov    %rax,%rdi
+    2fc9:	e8 23 fd ff ff       	call   2cf1 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    2fce:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2fd1:	83 e0 07             	and    $0x7,%eax
+    2fd4:	89 c2                	mov    %eax,%edx
+    2fd6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    2fd9:	83 e0 f8             	and    $0xfffffff8,%eax
+    2fdc:	48 89 c1             	mov    %rax,%rcx
+    2fdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2fe3:	48 01 c1             	add    %rax,%rcx
+    2fe6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    2fe9:	89 c6                	mov    %eax,%esi
+    2feb:	48 89 cf             	mov    %rcx,%rdi
+    2fee:	e8 cc fc ff ff       	call   2cbf <stosb>
+  }
+  return dst;
+    2ff3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2ff7:	c9                   	leave
+    2ff8:	c3                   	ret
+
+0000000000002ff9 <strchr>:
+
+char *strchr(const char *s, char c) {
+    2ff9:	55                   	push   %rbp
+    2ffa:	48 89 e5             	mov    %rsp,%rbp
+    2ffd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    3001:	89 f0                	mov    %esi,%eax
+    3003:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    3006:	eb 17                	jmp    301f <strchr+0x26>
+    if (*s == c)
+    3008:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    300c:	0f b6 00             	movzbl (%rax),%eax
+    300f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    3012:	75 06                	jne    301a <strchr+0x21>
+      return (char *)s;
+    3014:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3018:	eb 15                	jmp    302f <strchr+0x36>
+  for (; *s; s++)
+    301a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    301f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3023:	0f b6 00             	movzbl (%rax),%eax
+    3026:	84 c0                	test   %al,%al
+    3028:	75 de                	jne    3008 <strchr+0xf>
+  return 0;
+    302a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    302f:	5d                   	pop    %rbp
+    3030:	c3                   	ret
+
+0000000000003031 <gets>:
+
+char *gets(char *buf, int max) {
+    3031:	55                   	push   %rbp
+    3032:	48 89 e5             	mov    %rsp,%rbp
+    3035:	48 83 ec 20          	sub    $0x20,%rsp
+    3039:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    303d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    3040:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    3047:	eb 48                	jmp    3091 <gets+0x60>
+    cc = read(0, &c, 1);
+    3049:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    304d:	ba 01 00 00 00       	mov    $0x1,%edx
+    3052:	48 89 c6             	mov    %rax,%rsi
+    3055:	bf 00 00 00 00       	mov    $0x0,%edi
+    305a:	e8 b8 05 00 00       	call   3617 <read>
+    305f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    3062:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    3066:	7e 36                	jle    309e <gets+0x6d>
+      break;
+    buf[i++] = c;
+    3068:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    306b:	8d 50 01             	lea    0x1(%rax),%edx
+    306e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    3071:	48 63 d0             	movslq %eax,%rdx
+    3074:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3078:	48 01 c2             	add    %rax,%rdx
+    307b:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    307f:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    3081:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    3085:	3c 0a                	cmp    $0xa,%al
+    3087:	74 16                	je     309f <gets+0x6e>
+    3089:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    308d:	3c 0d                	cmp    $0xd,%al
+    308f:	74 0e                	je     309f <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    3091:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3094:	83 c0 01             	add    $0x1,%eax
+    3097:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    309a:	7f ad                	jg     3049 <gets+0x18>
+    309c:	eb 01                	jmp    309f <gets+0x6e>
+      break;
+    309e:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    309f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    30a2:	48 63 d0             	movslq %eax,%rdx
+    30a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30a9:	48 01 d0             	add    %rdx,%rax
+    30ac:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    30af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    30b3:	c9                   	leave
+    30b4:	c3                   	ret
+
+00000000000030b5 <stat>:
+
+int stat(char *n, struct stat *st) {
+    30b5:	55                   	push   %rbp
+    30b6:	48 89 e5             	mov    %rsp,%rbp
+    30b9:	48 83 ec 10          	sub    $0x10,%rsp
+    30bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    30c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    30c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    30c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    30cd:	48 89 c6             	mov    %rax,%rsi
+    30d0:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    30d5:	e8 58 07 00 00       	call   3832 <fstatat>
+}
+    30da:	c9                   	leave
+    30db:	c3                   	ret
+
+00000000000030dc <atoi>:
+
+int atoi(const char *s) {
+    30dc:	55                   	push   %rbp
+    30dd:	48 89 e5             	mov    %rsp,%rbp
+    30e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    30e4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    30eb:	eb 28                	jmp    3115 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    30ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    30f0:	89 d0                	mov    %edx,%eax
+    30f2:	c1 e0 02             	shl    $0x2,%eax
+    30f5:	01 d0                	add    %edx,%eax
+    30f7:	01 c0                	add    %eax,%eax
+    30f9:	89 c1                	mov    %eax,%ecx
+    30fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    30ff:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    3103:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    3107:	0f b6 00             	movzbl (%rax),%eax
+    310a:	0f be c0             	movsbl %al,%eax
+    310d:	01 c8                	add    %ecx,%eax
+    310f:	83 e8 30             	sub    $0x30,%eax
+    3112:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    3115:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3119:	0f b6 00             	movzbl (%rax),%eax
+    311c:	3c 2f                	cmp    $0x2f,%al
+    311e:	7e 0b                	jle    312b <atoi+0x4f>
+    3120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3124:	0f b6 00             	movzbl (%rax),%eax
+    3127:	3c 39                	cmp    $0x39,%al
+    3129:	7e c2                	jle    30ed <atoi+0x11>
+  return n;
+    312b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    312e:	5d                   	pop    %rbp
+    312f:	c3                   	ret
+
+0000000000003130 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    3130:	55                   	push   %rbp
+    3131:	48 89 e5             	mov    %rsp,%rbp
+    3134:	48 83 ec 28          	sub    $0x28,%rsp
+    3138:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    313c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    3140:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    3143:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3147:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    314b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    314f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    3153:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    3157:	7f 09                	jg     3162 <memmove+0x32>
+    return vdst;
+    3159:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    315d:	e9 29 01 00 00       	jmp    328b <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    3162:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3166:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    316a:	0f 83 87 00 00 00    	jae    31f7 <memmove+0xc7>
+    3170:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3173:	48 63 d0             	movslq %eax,%rdx
+    3176:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    317a:	48 01 d0             	add    %rdx,%rax
+    317d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    3181:	73 74                	jae    31f7 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    3183:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3186:	48 98                	cltq
+    3188:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    318c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    318f:	48 98                	cltq
+    3191:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    3195:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3199:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    319d:	48 09 d0             	or     %rdx,%rax
+    31a0:	83 e0 07             	and    $0x7,%eax
+    31a3:	48 85 c0             	test   %rax,%rax
+    31a6:	75 3d                	jne    31e5 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    31a8:	eb 1c                	jmp    31c6 <memmove+0x96>
+        src -= 8;
+    31aa:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    31af:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    31b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31b8:	48 8b 10             	mov    (%rax),%rdx
+    31bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31bf:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    31c2:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    31c6:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    31ca:	7f de                	jg     31aa <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    31cc:	eb 17                	jmp    31e5 <memmove+0xb5>
+      *--dst = *--src;
+    31ce:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    31d3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    31d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    31dc:	0f b6 10             	movzbl (%rax),%edx
+    31df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    31e3:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    31e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    31e8:	8d 50 ff             	lea    -0x1(%rax),%edx
+    31eb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    31ee:	85 c0                	test   %eax,%eax
+    31f0:	7f dc                	jg     31ce <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    31f2:	e9 90 00 00 00       	jmp    3287 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    31f7:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    31fb:	7e 09                	jle    3206 <memmove+0xd6>
+    31fd:	e8 f0 fc ff ff       	call   2ef2 <haserms>
+    3202:	85 c0                	test   %eax,%eax
+    3204:	74 1b                	je     3221 <memmove+0xf1>
+    movsb(dst, src, n);
+    3206:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3209:	48 63 d0             	movslq %eax,%rdx
+    320c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3210:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3214:	48 89 ce             	mov    %rcx,%rsi
+    3217:	48 89 c7             	mov    %rax,%rdi
+    321a:	e8 0c fb ff ff       	call   2d2b <movsb>
+    321f:	eb 66                	jmp    3287 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    3221:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3224:	8d 50 07             	lea    0x7(%rax),%edx
+    3227:	85 c0                	test   %eax,%eax
+    3229:	0f 48 c2             	cmovs  %edx,%eax
+    322c:	c1 f8 03             	sar    $0x3,%eax
+    322f:	48 63 d0             	movslq %eax,%rdx
+    3232:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3236:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    323a:	48 89 ce             	mov    %rcx,%rsi
+    323d:	48 89 c7             	mov    %rax,%rdi
+    3240:	e8 23 fb ff ff       	call   2d68 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    3245:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    3248:	89 d0                	mov    %edx,%eax
+    324a:	c1 f8 1f             	sar    $0x1f,%eax
+    324d:	c1 e8 1d             	shr    $0x1d,%eax
+    3250:	01 c2                	add    %eax,%edx
+    3252:	83 e2 07             	and    $0x7,%edx
+    3255:	29 c2                	sub    %eax,%edx
+    3257:	89 d0                	mov    %edx,%eax
+    3259:	48 98                	cltq
+    325b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    325e:	83 e2 f8             	and    $0xfffffff8,%edx
+    3261:	48 63 ca             	movslq %edx,%rcx
+    3264:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3268:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    326c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    326f:	83 e2 f8             	and    $0xfffffff8,%edx
+    3272:	48 63 ca             	movslq %edx,%rcx
+    3275:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3279:	48 01 d1             	add    %rdx,%rcx
+    327c:	48 89 c2             	mov    %rax,%rdx
+    327f:	48 89 cf             	mov    %rcx,%rdi
+    3282:	e8 a4 fa ff ff       	call   2d2b <movsb>
+  }
+  return vdst;
+    3287:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    328b:	c9                   	leave
+    328c:	c3                   	ret
+
+000000000000328d <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    328d:	55                   	push   %rbp
+    328e:	48 89 e5             	mov    %rsp,%rbp
+    3291:	48 83 ec 20          	sub    $0x20,%rsp
+    3295:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    3298:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    329c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    32a3:	00 00 00 
+    32a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    32aa:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    32ae:	75 0d                	jne    32bd <clock_gettime+0x30>
+    32b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32b4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    32b8:	48 85 c0             	test   %rax,%rax
+    32bb:	75 13                	jne    32d0 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    32bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    32c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    32c4:	48 89 d6             	mov    %rdx,%rsi
+    32c7:	89 c7                	mov    %eax,%edi
+    32c9:	e8 e0 04 00 00       	call   37ae <_clock_gettime>
+    32ce:	eb 7d                	jmp    334d <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    32d0:	e8 d1 fa ff ff       	call   2da6 <rdtsc>
+    32d5:	48 89 c2             	mov    %rax,%rdx
+    32d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    32dc:	48 89 d6             	mov    %rdx,%rsi
+    32df:	48 89 c7             	mov    %rax,%rdi
+    32e2:	e8 7b f9 ff ff       	call   2c62 <clockns>
+    32e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    32eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    32ef:	48 c1 e8 09          	shr    $0x9,%rax
+    32f3:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    32fa:	b8 44 00 
+    32fd:	48 f7 e2             	mul    %rdx
+    3300:	48 89 d0             	mov    %rdx,%rax
+    3303:	48 c1 e8 0b          	shr    $0xb,%rax
+    3307:	48 89 c2             	mov    %rax,%rdx
+    330a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    330e:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    3311:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    3315:	48 89 c8             	mov    %rcx,%rax
+    3318:	48 c1 e8 09          	shr    $0x9,%rax
+    331c:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    3323:	b8 44 00 
+    3326:	48 f7 e2             	mul    %rdx
+    3329:	48 89 d0             	mov    %rdx,%rax
+    332c:	48 c1 e8 0b          	shr    $0xb,%rax
+    3330:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    3337:	48 89 c8             	mov    %rcx,%rax
+    333a:	48 29 d0             	sub    %rdx,%rax
+    333d:	48 89 c2             	mov    %rax,%rdx
+    3340:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3344:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    3348:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    334d:	c9                   	leave
+    334e:	c3                   	ret
+
+000000000000334f <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    334f:	55                   	push   %rbp
+    3350:	48 89 e5             	mov    %rsp,%rbp
+    3353:	48 83 ec 10          	sub    $0x10,%rsp
+    3357:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    335b:	eb 11                	jmp    336e <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    335d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3361:	be 02 00 00 00       	mov    $0x2,%esi
+    3366:	48 89 c7             	mov    %rax,%rdi
+    3369:	e8 6c 04 00 00       	call   37da <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    336e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    3372:	b8 02 00 00 00       	mov    $0x2,%eax
+    3377:	87 02                	xchg   %eax,(%rdx)
+    3379:	85 c0                	test   %eax,%eax
+    337b:	75 e0                	jne    335d <mutex_wait+0xe>
+}
+    337d:	90                   	nop
+    337e:	90                   	nop
+    337f:	c9                   	leave
+    3380:	c3                   	ret
+
+0000000000003381 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    3381:	55                   	push   %rbp
+    3382:	48 89 e5             	mov    %rsp,%rbp
+    3385:	48 83 ec 20          	sub    $0x20,%rsp
+    3389:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    338d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    3394:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    3398:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    339c:	8b 02                	mov    (%rdx),%eax
+    339e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    33a3:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    33a7:	89 c1                	mov    %eax,%ecx
+    33a9:	0f 94 c0             	sete   %al
+    33ac:	84 c0                	test   %al,%al
+    33ae:	75 02                	jne    33b2 <mutex_lock+0x31>
+    33b0:	89 0a                	mov    %ecx,(%rdx)
+    33b2:	83 f0 01             	xor    $0x1,%eax
+    33b5:	84 c0                	test   %al,%al
+    33b7:	74 0c                	je     33c5 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    33b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    33bd:	48 89 c7             	mov    %rax,%rdi
+    33c0:	e8 8a ff ff ff       	call   334f <mutex_wait>
+}
+    33c5:	90                   	nop
+    33c6:	c9                   	leave
+    33c7:	c3                   	ret
+
+00000000000033c8 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    33c8:	55                   	push   %rbp
+    33c9:	48 89 e5             	mov    %rsp,%rbp
+    33cc:	48 83 ec 10          	sub    $0x10,%rsp
+    33d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    33d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33d8:	ba 00 00 00 00       	mov    $0x0,%edx
+    33dd:	87 10                	xchg   %edx,(%rax)
+    33df:	83 fa 02             	cmp    $0x2,%edx
+    33e2:	75 11                	jne    33f5 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    33e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    33e8:	be 01 00 00 00       	mov    $0x1,%esi
+    33ed:	48 89 c7             	mov    %rax,%rdi
+    33f0:	e8 f0 03 00 00       	call   37e5 <futex_wake>
+}
+    33f5:	90                   	nop
+    33f6:	c9                   	leave
+    33f7:	c3                   	ret
+
+00000000000033f8 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    33f8:	55                   	push   %rbp
+    33f9:	48 89 e5             	mov    %rsp,%rbp
+    33fc:	48 83 ec 20          	sub    $0x20,%rsp
+    3400:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3404:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    3408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    340c:	48 83 c0 04          	add    $0x4,%rax
+    3410:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    3414:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3418:	8b 00                	mov    (%rax),%eax
+    341a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    341d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3421:	48 89 c7             	mov    %rax,%rdi
+    3424:	e8 9f ff ff ff       	call   33c8 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    3429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    342d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    3430:	89 d6                	mov    %edx,%esi
+    3432:	48 89 c7             	mov    %rax,%rdi
+    3435:	e8 a0 03 00 00       	call   37da <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    343a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    343e:	48 83 c0 04          	add    $0x4,%rax
+    3442:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    3446:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    344a:	48 89 c7             	mov    %rax,%rdi
+    344d:	e8 fd fe ff ff       	call   334f <mutex_wait>
+}
+    3452:	90                   	nop
+    3453:	c9                   	leave
+    3454:	c3                   	ret
+
+0000000000003455 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    3455:	55                   	push   %rbp
+    3456:	48 89 e5             	mov    %rsp,%rbp
+    3459:	48 83 ec 10          	sub    $0x10,%rsp
+    345d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    3461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3465:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    3469:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    346d:	48 83 c0 04          	add    $0x4,%rax
+    3471:	8b 00                	mov    (%rax),%eax
+    3473:	85 c0                	test   %eax,%eax
+    3475:	7e 11                	jle    3488 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    3477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    347b:	be 01 00 00 00       	mov    $0x1,%esi
+    3480:	48 89 c7             	mov    %rax,%rdi
+    3483:	e8 5d 03 00 00       	call   37e5 <futex_wake>
+}
+    3488:	90                   	nop
+    3489:	c9                   	leave
+    348a:	c3                   	ret
+
+000000000000348b <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    348b:	55                   	push   %rbp
+    348c:	48 89 e5             	mov    %rsp,%rbp
+    348f:	48 83 ec 10          	sub    $0x10,%rsp
+    3493:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    3497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    349b:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    349f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34a3:	48 83 c0 04          	add    $0x4,%rax
+    34a7:	8b 00                	mov    (%rax),%eax
+    34a9:	85 c0                	test   %eax,%eax
+    34ab:	7e 11                	jle    34be <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    34ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    34b1:	be 00 00 00 40       	mov    $0x40000000,%esi
+    34b6:	48 89 c7             	mov    %rax,%rdi
+    34b9:	e8 27 03 00 00       	call   37e5 <futex_wake>
+}
+    34be:	90                   	nop
+    34bf:	c9                   	leave
+    34c0:	c3                   	ret
+
+00000000000034c1 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    34c1:	55                   	push   %rbp
+    34c2:	48 89 e5             	mov    %rsp,%rbp
+    34c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    34c9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    34cc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    34d0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    34d4:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    34d8:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    34dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34e0:	8b 40 04             	mov    0x4(%rax),%eax
+    34e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    34e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    34ea:	8b 00                	mov    (%rax),%eax
+    34ec:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    34ef:	29 c2                	sub    %eax,%edx
+    34f1:	83 fa 1f             	cmp    $0x1f,%edx
+    34f4:	76 07                	jbe    34fd <ring_push+0x3c>
+    return -1;
+    34f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    34fb:	eb 7e                	jmp    357b <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    34fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3500:	83 e0 1f             	and    $0x1f,%eax
+    3503:	89 c2                	mov    %eax,%edx
+    3505:	48 89 d0             	mov    %rdx,%rax
+    3508:	48 01 c0             	add    %rax,%rax
+    350b:	48 01 d0             	add    %rdx,%rax
+    350e:	48 c1 e0 04          	shl    $0x4,%rax
+    3512:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    3516:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    351a:	48 01 d0             	add    %rdx,%rax
+    351d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    3521:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3525:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    3528:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    352a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    352e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3532:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    3536:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    353a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    353e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    3542:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3546:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    354a:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    354e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3552:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    3556:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    355a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    355e:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    3562:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    3566:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3569:	8d 50 01             	lea    0x1(%rax),%edx
+    356c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3570:	48 83 c0 04          	add    $0x4,%rax
+    3574:	89 10                	mov    %edx,(%rax)
+  return 0;
+    3576:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    357b:	5d                   	pop    %rbp
+    357c:	c3                   	ret
+
+000000000000357d <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    357d:	55                   	push   %rbp
+    357e:	48 89 e5             	mov    %rsp,%rbp
+    3581:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    3585:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    3589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    358d:	8b 40 08             	mov    0x8(%rax),%eax
+    3590:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    3593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3597:	48 83 c0 0c          	add    $0xc,%rax
+    359b:	8b 00                	mov    (%rax),%eax
+    359d:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    35a0:	75 07                	jne    35a9 <ring_pop+0x2c>
+    return -1;
+    35a2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    35a7:	eb 40                	jmp    35e9 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    35a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    35ac:	83 e0 1f             	and    $0x1f,%eax
+    35af:	89 c2                	mov    %eax,%edx
+    35b1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    35b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    35b9:	89 d2                	mov    %edx,%edx
+    35bb:	48 83 c2 61          	add    $0x61,%rdx
+    35bf:	48 c1 e2 04          	shl    $0x4,%rdx
+    35c3:	48 01 d0             	add    %rdx,%rax
+    35c6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    35ca:	48 8b 00             	mov    (%rax),%rax
+    35cd:	48 89 01             	mov    %rax,(%rcx)
+    35d0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    35d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    35d7:	8d 50 01             	lea    0x1(%rax),%edx
+    35da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    35de:	48 83 c0 08          	add    $0x8,%rax
+    35e2:	89 10                	mov    %edx,(%rax)
+  return 0;
+    35e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    35e9:	5d                   	pop    %rbp
+    35ea:	c3                   	ret
+
+00000000000035eb <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    35eb:	b8 01 00 00 00       	mov    $0x1,%eax
+    35f0:	49 89 ca             	mov    %rcx,%r10
+    35f3:	0f 05                	syscall
+    35f5:	c3                   	ret
+
+00000000000035f6 <_exit>:
+SYSCALL_(exit)
+    35f6:	b8 02 00 00 00       	mov    $0x2,%eax
+    35fb:	49 89 ca             	mov    %rcx,%r10
+    35fe:	0f 05                	syscall
+    3600:	c3                   	ret
+
+0000000000003601 <wait>:
+SYSCALL(wait)
+    3601:	b8 03 00 00 00       	mov    $0x3,%eax
+    3606:	49 89 ca             	mov    %rcx,%r10
+    3609:	0f 05                	syscall
+    360b:	c3                   	ret
+
+000000000000360c <pipe>:
+SYSCALL(pipe)
+    360c:	b8 04 00 00 00       	mov    $0x4,%eax
+    3611:	49 89 ca             	mov    %rcx,%r10
+    3614:	0f 05                	syscall
+    3616:	c3                   	ret
+
+0000000000003617 <read>:
+SYSCALL(read)
+    3617:	b8 05 00 00 00       	mov    $0x5,%eax
+    361c:	49 89 ca             	mov    %rcx,%r10
+    361f:	0f 05                	syscall
+    3621:	c3                   	ret
+
+0000000000003622 <write>:
+SYSCALL(write)
+    3622:	b8 10 00 00 00       	mov    $0x10,%eax
+    3627:	49 89 ca             	mov    %rcx,%r10
+    362a:	0f 05                	syscall
+    362c:	c3                   	ret
+
+000000000000362d <_close>:
+SYSCALL_(close)
+    362d:	b8 15 00 00 00       	mov    $0x15,%eax
+    3632:	49 89 ca             	mov    %rcx,%r10
+    3635:	0f 05                	syscall
+    3637:	c3                   	ret
+
+0000000000003638 <kill>:
+SYSCALL(kill)
+    3638:	b8 06 00 00 00       	mov    $0x6,%eax
+    363d:	49 89 ca             	mov    %rcx,%r10
+    3640:	0f 05                	syscall
+    3642:	c3                   	ret
+
+0000000000003643 <_exec>:
+SYSCALL_(exec)
+    3643:	b8 07 00 00 00       	mov    $0x7,%eax
+    3648:	49 89 ca             	mov    %rcx,%r10
+    364b:	0f 05                	syscall
+    364d:	c3                   	ret
+
+000000000000364e <open>:
+SYSCALL(open)
+    364e:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3653:	49 89 ca             	mov    %rcx,%r10
+    3656:	0f 05                	syscall
+    3658:	c3                   	ret
+
+0000000000003659 <mknod>:
+SYSCALL(mknod)
+    3659:	b8 11 00 00 00       	mov    $0x11,%eax
+    365e:	49 89 ca             	mov    %rcx,%r10
+    3661:	0f 05                	syscall
+    3663:	c3                   	ret
+
+0000000000003664 <unlink>:
+SYSCALL(unlink)
+    3664:	b8 12 00 00 00       	mov    $0x12,%eax
+    3669:	49 89 ca             	mov    %rcx,%r10
+    366c:	0f 05                	syscall
+    366e:	c3                   	ret
+
+000000000000366f <fstat>:
+SYSCALL(fstat)
+    366f:	b8 08 00 00 00       	mov    $0x8,%eax
+    3674:	49 89 ca             	mov    %rcx,%r10
+    3677:	0f 05                	syscall
+    3679:	c3                   	ret
+
+000000000000367a <link>:
+SYSCALL(link)
+    367a:	b8 13 00 00 00       	mov    $0x13,%eax
+    367f:	49 89 ca             	mov    %rcx,%r10
+    3682:	0f 05                	syscall
+    3684:	c3                   	ret
+
+0000000000003685 <mkdir>:
+SYSCALL(mkdir)
+    3685:	b8 14 00 00 00       	mov    $0x14,%eax
+    368a:	49 89 ca             	mov    %rcx,%r10
+    368d:	0f 05                	syscall
+    368f:	c3                   	ret
+
+0000000000003690 <chdir>:
+SYSCALL(chdir)
+    3690:	b8 09 00 00 00       	mov    $0x9,%eax
+    3695:	49 89 ca             	mov    %rcx,%r10
+    3698:	0f 05                	syscall
+    369a:	c3                   	ret
+
+000000000000369b <dup>:
+SYSCALL(dup)
+    369b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    36a0:	49 89 ca             	mov    %rcx,%r10
+    36a3:	0f 05                	syscall
+    36a5:	c3                   	ret
+
+00000000000036a6 <getpid>:
+SYSCALL(getpid)
+    36a6:	b8 0b 00 00 00       	mov    $0xb,%eax
+    36ab:	49 89 ca             	mov    %rcx,%r10
+    36ae:	0f 05                	syscall
+    36b0:	c3                   	ret
+
+00000000000036b1 <sbrk>:
+SYSCALL(sbrk)
+    36b1:	b8 0c 00 00 00       	mov    $0xc,%eax
+    36b6:	49 89 ca             	mov    %rcx,%r10
+    36b9:	0f 05                	syscall
+    36bb:	c3                   	ret
+
+00000000000036bc <sleep>:
+SYSCALL(sleep)
+    36bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+    36c1:	49 89 ca             	mov    %rcx,%r10
+    36c4:	0f 05                	syscall
+    36c6:	c3                   	ret
+
+00000000000036c7 <uptime>:
+SYSCALL(uptime)
+    36c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+    36cc:	49 89 ca             	mov    %rcx,%r10
+    36cf:	0f 05                	syscall
+    36d1:	c3                   	ret
+
+00000000000036d2 <sysinfo>:
+SYSCALL(sysinfo)
+    36d2:	b8 16 00 00 00       	mov    $0x16,%eax
+    36d7:	49 89 ca             	mov    %rcx,%r10
+    36da:	0f 05                	syscall
+    36dc:	c3                   	ret
+
+00000000000036dd <crashn>:
+SYSCALL(crashn)
+    36dd:	b8 17 00 00 00       	mov    $0x17,%eax
+    36e2:	49 89 ca             	mov    %rcx,%r10
+    36e5:	0f 05                	syscall
+    36e7:	c3                   	ret
+
+00000000000036e8 <mmap>:
+SYSCALL(mmap)
+    36e8:	b8 18 00 00 00       	mov    $0x18,%eax
+    36ed:	49 89 ca             	mov    %rcx,%r10
+    36f0:	0f 05                	syscall
+    36f2:	c3                   	ret
+
+00000000000036f3 <munmap>:
+SYSCALL(munmap)
+    36f3:	b8 19 00 00 00       	mov    $0x19,%eax
+    36f8:	49 89 ca             	mov    %rcx,%r10
+    36fb:	0f 05                	syscall
+    36fd:	c3                   	ret
+
+00000000000036fe <nice>:
+SYSCALL(nice)
+    36fe:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3703:	49 89 ca             	mov    %rcx,%r10
+    3706:	0f 05                	syscall
+    3708:	c3                   	ret
+
+0000000000003709 <_spawn>:
+SYSCALL_(spawn)
+    3709:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    370e:	49 89 ca             	mov    %rcx,%r10
+    3711:	0f 05                	syscall
+    3713:	c3                   	ret
+
+0000000000003714 <pread>:
+SYSCALL(pread)
+    3714:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3719:	49 89 ca             	mov    %rcx,%r10
+    371c:	0f 05                	syscall
+    371e:	c3                   	ret
+
+000000000000371f <pwrite>:
+SYSCALL(pwrite)
+    371f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3724:	49 89 ca             	mov    %rcx,%r10
+    3727:	0f 05                	syscall
+    3729:	c3                   	ret
+
+000000000000372a <readv>:
+SYSCALL(readv)
+    372a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    372f:	49 89 ca             	mov    %rcx,%r10
+    3732:	0f 05                	syscall
+    3734:	c3                   	ret
+
+0000000000003735 <writev>:
+SYSCALL(writev)
+    3735:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    373a:	49 89 ca             	mov    %rcx,%r10
+    373d:	0f 05                	syscall
+    373f:	c3                   	ret
+
+0000000000003740 <sendfile>:
+SYSCALL(sendfile)
+    3740:	b8 20 00 00 00       	mov    $0x20,%eax
+    3745:	49 89 ca             	mov    %rcx,%r10
+    3748:	0f 05                	syscall
+    374a:	c3                   	ret
+
+000000000000374b <splice>:
+SYSCALL(splice)
+    374b:	b8 21 00 00 00       	mov    $0x21,%eax
+    3750:	49 89 ca             	mov    %rcx,%r10
+    3753:	0f 05                	syscall
+    3755:	c3                   	ret
+
+0000000000003756 <poll>:
+SYSCALL(poll)
+    3756:	b8 22 00 00 00       	mov    $0x22,%eax
+    375b:	49 89 ca             	mov    %rcx,%r10
+    375e:	0f 05                	syscall
+    3760:	c3                   	ret
+
+0000000000003761 <fsync>:
+SYSCALL(fsync)
+    3761:	b8 23 00 00 00       	mov    $0x23,%eax
+    3766:	49 89 ca             	mov    %rcx,%r10
+    3769:	0f 05                	syscall
+    376b:	c3                   	ret
+
+000000000000376c <fdatasync>:
+SYSCALL(fdatasync)
+    376c:	b8 24 00 00 00       	mov    $0x24,%eax
+    3771:	49 89 ca             	mov    %rcx,%r10
+    3774:	0f 05                	syscall
+    3776:	c3                   	ret
+
+0000000000003777 <lockstat>:
+SYSCALL(lockstat)
+    3777:	b8 25 00 00 00       	mov    $0x25,%eax
+    377c:	49 89 ca             	mov    %rcx,%r10
+    377f:	0f 05                	syscall
+    3781:	c3                   	ret
+
+0000000000003782 <syscallstat>:
+SYSCALL(syscallstat)
+    3782:	b8 26 00 00 00       	mov    $0x26,%eax
+    3787:	49 89 ca             	mov    %rcx,%r10
+    378a:	0f 05                	syscall
+    378c:	c3                   	ret
+
+000000000000378d <trace>:
+SYSCALL(trace)
+    378d:	b8 27 00 00 00       	mov    $0x27,%eax
+    3792:	49 89 ca             	mov    %rcx,%r10
+    3795:	0f 05                	syscall
+    3797:	c3                   	ret
+
+0000000000003798 <profile>:
+SYSCALL(profile)
+    3798:	b8 28 00 00 00       	mov    $0x28,%eax
+    379d:	49 89 ca             	mov    %rcx,%r10
+    37a0:	0f 05                	syscall
+    37a2:	c3                   	ret
+
+00000000000037a3 <cycles>:
+SYSCALL(cycles)
+    37a3:	b8 29 00 00 00       	mov    $0x29,%eax
+    37a8:	49 89 ca             	mov    %rcx,%r10
+    37ab:	0f 05                	syscall
+    37ad:	c3                   	ret
+
+00000000000037ae <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    37ae:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    37b3:	49 89 ca             	mov    %rcx,%r10
+    37b6:	0f 05                	syscall
+    37b8:	c3                   	ret
+
+00000000000037b9 <consmode>:
+SYSCALL(consmode)
+    37b9:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    37be:	49 89 ca             	mov    %rcx,%r10
+    37c1:	0f 05                	syscall
+    37c3:	c3                   	ret
+
+00000000000037c4 <clone>:
+SYSCALL(clone)
+    37c4:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    37c9:	49 89 ca             	mov    %rcx,%r10
+    37cc:	0f 05                	syscall
+    37ce:	c3                   	ret
+
+00000000000037cf <join>:
+SYSCALL(join)
+    37cf:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    37d4:	49 89 ca             	mov    %rcx,%r10
+    37d7:	0f 05                	syscall
+    37d9:	c3                   	ret
+
+00000000000037da <futex_wait>:
+SYSCALL(futex_wait)
+    37da:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    37df:	49 89 ca             	mov    %rcx,%r10
+    37e2:	0f 05                	syscall
+    37e4:	c3                   	ret
+
+00000000000037e5 <futex_wake>:
+SYSCALL(futex_wake)
+    37e5:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    37ea:	49 89 ca             	mov    %rcx,%r10
+    37ed:	0f 05                	syscall
+    37ef:	c3                   	ret
+
+00000000000037f0 <shmget>:
+SYSCALL(shmget)
+    37f0:	b8 30 00 00 00       	mov    $0x30,%eax
+    37f5:	49 89 ca             	mov    %rcx,%r10
+    37f8:	0f 05                	syscall
+    37fa:	c3                   	ret
+
+00000000000037fb <shmat>:
+SYSCALL(shmat)
+    37fb:	b8 31 00 00 00       	mov    $0x31,%eax
+    3800:	49 89 ca             	mov    %rcx,%r10
+    3803:	0f 05                	syscall
+    3805:	c3                   	ret
+
+0000000000003806 <shmdt>:
+SYSCALL(shmdt)
+    3806:	b8 32 00 00 00       	mov    $0x32,%eax
+    380b:	49 89 ca             	mov    %rcx,%r10
+    380e:	0f 05                	syscall
+    3810:	c3                   	ret
+
+0000000000003811 <ring_setup>:
+SYSCALL(ring_setup)
+    3811:	b8 33 00 00 00       	mov    $0x33,%eax
+    3816:	49 89 ca             	mov    %rcx,%r10
+    3819:	0f 05                	syscall
+    381b:	c3                   	ret
+
+000000000000381c <ring_enter>:
+SYSCALL(ring_enter)
+    381c:	b8 34 00 00 00       	mov    $0x34,%eax
+    3821:	49 89 ca             	mov    %rcx,%r10
+    3824:	0f 05                	syscall
+    3826:	c3                   	ret
+
+0000000000003827 <getdents>:
+SYSCALL(getdents)
+    3827:	b8 35 00 00 00       	mov    $0x35,%eax
+    382c:	49 89 ca             	mov    %rcx,%r10
+    382f:	0f 05                	syscall
+    3831:	c3                   	ret
+
+0000000000003832 <fstatat>:
+SYSCALL(fstatat)
+    3832:	b8 36 00 00 00       	mov    $0x36,%eax
+    3837:	49 89 ca             	mov    %rcx,%r10
+    383a:	0f 05                	syscall
+    383c:	c3                   	ret
+
+000000000000383d <clone_file>:
+SYSCALL(clone_file)
+    383d:	b8 37 00 00 00       	mov    $0x37,%eax
+    3842:	49 89 ca             	mov    %rcx,%r10
+    3845:	0f 05                	syscall
+    3847:	c3                   	ret
+
+0000000000003848 <fpunch>:
+SYSCALL(fpunch)
+    3848:	b8 38 00 00 00       	mov    $0x38,%eax
+    384d:	49 89 ca             	mov    %rcx,%r10
+    3850:	0f 05                	syscall
+    3852:	c3                   	ret
+
+0000000000003853 <defrag>:
+SYSCALL(defrag)
+    3853:	b8 39 00 00 00       	mov    $0x39,%eax
+    3858:	49 89 ca             	mov    %rcx,%r10
+    385b:	0f 05                	syscall
+    385d:	c3                   	ret
+
+000000000000385e <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    385e:	55                   	push   %rbp
+    385f:	48 89 e5             	mov    %rsp,%rbp
+    3862:	48 83 ec 20          	sub    $0x20,%rsp
+    3866:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    386a:	bf 00 00 00 00       	mov    $0x0,%edi
+    386f:	e8 3d fe ff ff       	call   36b1 <sbrk>
+    3874:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    3878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    387c:	48 f7 d8             	neg    %rax
+    387f:	25 ff 0f 00 00       	and    $0xfff,%eax
+    3884:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    3888:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    388c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3890:	48 01 c2             	add    %rax,%rdx
+    3893:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    3898:	48 39 c2             	cmp    %rax,%rdx
+    389b:	73 1e                	jae    38bb <morecore+0x5d>
+    389d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    38a1:	89 c2                	mov    %eax,%edx
+    38a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    38a7:	01 d0                	add    %edx,%eax
+    38a9:	89 c7                	mov    %eax,%edi
+    38ab:	e8 01 fe ff ff       	call   36b1 <sbrk>
+    38b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    38b4:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    38b9:	75 07                	jne    38c2 <morecore+0x64>
+    return 0;
+    38bb:	b8 00 00 00 00       	mov    $0x0,%eax
+    38c0:	eb 27                	jmp    38e9 <morecore+0x8b>
+  stats.heap += n + pad;
+    38c2:	48 8b 05 07 a9 00 00 	mov    0xa907(%rip),%rax        # e1d0 <stats+0x50>
+    38c9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    38cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    38d1:	48 01 ca             	add    %rcx,%rdx
+    38d4:	48 01 d0             	add    %rdx,%rax
+    38d7:	48 89 05 f2 a8 00 00 	mov    %rax,0xa8f2(%rip)        # e1d0 <stats+0x50>
+  return p + pad;
+    38de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    38e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    38e6:	48 01 d0             	add    %rdx,%rax
+}
+    38e9:	c9                   	leave
+    38ea:	c3                   	ret
+
+00000000000038eb <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    38eb:	55                   	push   %rbp
+    38ec:	48 89 e5             	mov    %rsp,%rbp
+    38ef:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    38f3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    38f7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    38fe:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    38ff:	48 8d 05 5a a8 00 00 	lea    0xa85a(%rip),%rax        # e160 <runs>
+    3906:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    390a:	eb 1a                	jmp    3926 <pagefree+0x3b>
+    prev = *rp;
+    390c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3910:	48 8b 00             	mov    (%rax),%rax
+    3913:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    3917:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    391b:	48 8b 00             	mov    (%rax),%rax
+    391e:	48 83 c0 08          	add    $0x8,%rax
+    3922:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3926:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    392a:	48 8b 00             	mov    (%rax),%rax
+    392d:	48 85 c0             	test   %rax,%rax
+    3930:	74 0d                	je     393f <pagefree+0x54>
+    3932:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3936:	48 8b 00             	mov    (%rax),%rax
+    3939:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    393d:	72 cd                	jb     390c <pagefree+0x21>
+  r = (struct run *)p;
+    393f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3943:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    3947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    394b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    394f:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    3952:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3956:	48 8b 10             	mov    (%rax),%rdx
+    3959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    395d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    3961:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3965:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3969:	48 85 c0             	test   %rax,%rax
+    396c:	74 48                	je     39b6 <pagefree+0xcb>
+    396e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    3972:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3976:	48 01 c2             	add    %rax,%rdx
+    3979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    397d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3981:	48 39 c2             	cmp    %rax,%rdx
+    3984:	75 30                	jne    39b6 <pagefree+0xcb>
+    r->size += r->next->size;
+    3986:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    398a:	48 8b 10             	mov    (%rax),%rdx
+    398d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3991:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3995:	48 8b 00             	mov    (%rax),%rax
+    3998:	48 01 c2             	add    %rax,%rdx
+    399b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    399f:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    39a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+    39aa:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    39ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39b2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    39b6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    39bb:	74 46                	je     3a03 <pagefree+0x118>
+    39bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39c1:	48 8b 10             	mov    (%rax),%rdx
+    39c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39c8:	48 01 d0             	add    %rdx,%rax
+    39cb:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    39cf:	75 32                	jne    3a03 <pagefree+0x118>
+    prev->size += r->size;
+    39d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39d5:	48 8b 10             	mov    (%rax),%rdx
+    39d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39dc:	48 8b 00             	mov    (%rax),%rax
+    39df:	48 01 c2             	add    %rax,%rdx
+    39e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39e6:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    39e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    39ed:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    39f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39f5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    39f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    39fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    3a01:	eb 0c                	jmp    3a0f <pagefree+0x124>
+  } else {
+    *rp = r;
+    3a03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3a0b:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    3a0e:	90                   	nop
+    3a0f:	90                   	nop
+    3a10:	5d                   	pop    %rbp
+    3a11:	c3                   	ret
+
+0000000000003a12 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    3a12:	55                   	push   %rbp
+    3a13:	48 89 e5             	mov    %rsp,%rbp
+    3a16:	48 83 ec 40          	sub    $0x40,%rsp
+    3a1a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    3a1e:	48 8d 05 3b a7 00 00 	lea    0xa73b(%rip),%rax        # e160 <runs>
+    3a25:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3a29:	eb 66                	jmp    3a91 <pagealloc+0x7f>
+    if (r->size == n) {
+    3a2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a2f:	48 8b 00             	mov    (%rax),%rax
+    3a32:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3a36:	75 18                	jne    3a50 <pagealloc+0x3e>
+      *rp = r->next;
+    3a38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a3c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    3a40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a44:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    3a47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a4b:	e9 ca 00 00 00       	jmp    3b1a <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    3a50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a54:	48 8b 00             	mov    (%rax),%rax
+    3a57:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3a5b:	73 28                	jae    3a85 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    3a5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a61:	48 8b 00             	mov    (%rax),%rax
+    3a64:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3a68:	48 89 c2             	mov    %rax,%rdx
+    3a6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a6f:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    3a72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a76:	48 8b 10             	mov    (%rax),%rdx
+    3a79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a7d:	48 01 d0             	add    %rdx,%rax
+    3a80:	e9 95 00 00 00       	jmp    3b1a <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    3a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3a89:	48 83 c0 08          	add    $0x8,%rax
+    3a8d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3a91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3a95:	48 8b 00             	mov    (%rax),%rax
+    3a98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3a9c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3aa1:	75 88                	jne    3a2b <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    3aa3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    3aa7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    3aab:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    3ab2:	00 
+    3ab3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    3ab7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3abb:	48 39 c2             	cmp    %rax,%rdx
+    3abe:	48 0f 43 c2          	cmovae %rdx,%rax
+    3ac2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    3ac6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3aca:	48 89 c7             	mov    %rax,%rdi
+    3acd:	e8 8c fd ff ff       	call   385e <morecore>
+    3ad2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    3ad6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    3adb:	75 07                	jne    3ae4 <pagealloc+0xd2>
+    return 0;
+    3add:	b8 00 00 00 00       	mov    $0x0,%eax
+    3ae2:	eb 36                	jmp    3b1a <pagealloc+0x108>
+  if (m > n)
+    3ae4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3ae8:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    3aec:	73 1a                	jae    3b08 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    3aee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3af2:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3af6:	48 89 c2             	mov    %rax,%rdx
+    3af9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3afd:	48 89 d6             	mov    %rdx,%rsi
+    3b00:	48 89 c7             	mov    %rax,%rdi
+    3b03:	e8 e3 fd ff ff       	call   38eb <pagefree>
+  return p + m - n;
+    3b08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    3b0c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    3b10:	48 89 c2             	mov    %rax,%rdx
+    3b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    3b17:	48 01 d0             	add    %rdx,%rax
+}
+    3b1a:	c9                   	leave
+    3b1b:	c3                   	ret
+
+0000000000003b1c <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    3b1c:	55                   	push   %rbp
+    3b1d:	48 89 e5             	mov    %rsp,%rbp
+    3b20:	48 83 ec 30          	sub    $0x30,%rsp
+    3b24:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    3b27:	bf 00 10 00 00       	mov    $0x1000,%edi
+    3b2c:	e8 e1 fe ff ff       	call   3a12 <pagealloc>
+    3b31:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    3b35:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    3b3a:	75 0a                	jne    3b46 <refill+0x2a>
+    return -1;
+    3b3c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    3b41:	e9 da 00 00 00       	jmp    3c20 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    3b46:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    3b4d:	00 
+    3b4e:	e9 ba 00 00 00       	jmp    3c0d <refill+0xf1>
+    b = (struct block *)(p + off);
+    3b53:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3b57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3b5b:	48 01 d0             	add    %rdx,%rax
+    3b5e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    3b62:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3b65:	ba 20 00 00 00       	mov    $0x20,%edx
+    3b6a:	89 c1                	mov    %eax,%ecx
+    3b6c:	48 d3 e2             	shl    %cl,%rdx
+    3b6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b73:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    3b76:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3b79:	48 63 d0             	movslq %eax,%rdx
+    3b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3b80:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    3b84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3b87:	48 98                	cltq
+    3b89:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3b90:	00 
+    3b91:	48 8d 05 88 a5 00 00 	lea    0xa588(%rip),%rax        # e120 <freelist>
+    3b98:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    3b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3ba0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    3ba4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3ba7:	48 98                	cltq
+    3ba9:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    3bb0:	00 
+    3bb1:	48 8d 15 68 a5 00 00 	lea    0xa568(%rip),%rdx        # e120 <freelist>
+    3bb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3bbc:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    3bc0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3bc3:	48 98                	cltq
+    3bc5:	48 83 c0 08          	add    $0x8,%rax
+    3bc9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3bd0:	00 
+    3bd1:	48 8d 05 ac a5 00 00 	lea    0xa5ac(%rip),%rax        # e184 <stats+0x4>
+    3bd8:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3bdb:	8d 48 01             	lea    0x1(%rax),%ecx
+    3bde:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3be1:	48 98                	cltq
+    3be3:	48 83 c0 08          	add    $0x8,%rax
+    3be7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3bee:	00 
+    3bef:	48 8d 05 8e a5 00 00 	lea    0xa58e(%rip),%rax        # e184 <stats+0x4>
+    3bf6:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    3bf9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3bfc:	ba 20 00 00 00       	mov    $0x20,%edx
+    3c01:	89 c1                	mov    %eax,%ecx
+    3c03:	48 d3 e2             	shl    %cl,%rdx
+    3c06:	48 89 d0             	mov    %rdx,%rax
+    3c09:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    3c0d:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    3c14:	00 
+    3c15:	0f 86 38 ff ff ff    	jbe    3b53 <refill+0x37>
+  }
+  return 0;
+    3c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    3c20:	c9                   	leave
+    3c21:	c3                   	ret
+
+0000000000003c22 <malloc>:
+
+void *malloc(uint nbytes) {
+    3c22:	55                   	push   %rbp
+    3c23:	48 89 e5             	mov    %rsp,%rbp
+    3c26:	48 83 ec 30          	sub    $0x30,%rsp
+    3c2a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    3c2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3c30:	48 83 c0 10          	add    $0x10,%rax
+    3c34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    3c38:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    3c3f:	eb 04                	jmp    3c45 <malloc+0x23>
+    3c41:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    3c45:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    3c49:	7f 16                	jg     3c61 <malloc+0x3f>
+    3c4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3c4e:	ba 20 00 00 00       	mov    $0x20,%edx
+    3c53:	89 c1                	mov    %eax,%ecx
+    3c55:	48 d3 e2             	shl    %cl,%rdx
+    3c58:	48 89 d0             	mov    %rdx,%rax
+    3c5b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    3c5f:	72 e0                	jb     3c41 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    3c61:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    3c65:	75 7d                	jne    3ce4 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    3c67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c6b:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    3c71:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    3c77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    3c7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3c7f:	48 89 c7             	mov    %rax,%rdi
+    3c82:	e8 8b fd ff ff       	call   3a12 <pagealloc>
+    3c87:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    3c8b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    3c90:	75 0a                	jne    3c9c <malloc+0x7a>
+      return 0;
+    3c92:	b8 00 00 00 00       	mov    $0x0,%eax
+    3c97:	e9 2c 01 00 00       	jmp    3dc8 <malloc+0x1a6>
+    h->size = n;
+    3c9c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3ca0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    3ca4:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    3ca7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3cab:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    3cb2:	00 
+    stats.inuse[LARGE]++;
+    3cb3:	8b 05 e7 a4 00 00    	mov    0xa4e7(%rip),%eax        # e1a0 <stats+0x20>
+    3cb9:	83 c0 01             	add    $0x1,%eax
+    3cbc:	89 05 de a4 00 00    	mov    %eax,0xa4de(%rip)        # e1a0 <stats+0x20>
+    stats.large += n;
+    3cc2:	48 8b 15 ff a4 00 00 	mov    0xa4ff(%rip),%rdx        # e1c8 <stats+0x48>
+    3cc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ccd:	48 01 d0             	add    %rdx,%rax
+    3cd0:	48 89 05 f1 a4 00 00 	mov    %rax,0xa4f1(%rip)        # e1c8 <stats+0x48>
+    return h + 1;
+    3cd7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    3cdb:	48 83 c0 10          	add    $0x10,%rax
+    3cdf:	e9 e4 00 00 00       	jmp    3dc8 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    3ce4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3ce7:	48 98                	cltq
+    3ce9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3cf0:	00 
+    3cf1:	48 8d 05 28 a4 00 00 	lea    0xa428(%rip),%rax        # e120 <freelist>
+    3cf8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    3cfc:	48 85 c0             	test   %rax,%rax
+    3cff:	75 18                	jne    3d19 <malloc+0xf7>
+    3d01:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3d04:	89 c7                	mov    %eax,%edi
+    3d06:	e8 11 fe ff ff       	call   3b1c <refill>
+    3d0b:	85 c0                	test   %eax,%eax
+    3d0d:	79 0a                	jns    3d19 <malloc+0xf7>
+    return 0;
+    3d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    3d14:	e9 af 00 00 00       	jmp    3dc8 <malloc+0x1a6>
+  b = freelist[c];
+    3d19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3d1c:	48 98                	cltq
+    3d1e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3d25:	00 
+    3d26:	48 8d 05 f3 a3 00 00 	lea    0xa3f3(%rip),%rax        # e120 <freelist>
+    3d2d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    3d31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    3d35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3d39:	48 8b 40 10          	mov    0x10(%rax),%rax
+    3d3d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    3d40:	48 63 d2             	movslq %edx,%rdx
+    3d43:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    3d4a:	00 
+    3d4b:	48 8d 15 ce a3 00 00 	lea    0xa3ce(%rip),%rdx        # e120 <freelist>
+    3d52:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    3d56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3d59:	48 98                	cltq
+    3d5b:	48 83 c0 08          	add    $0x8,%rax
+    3d5f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3d66:	00 
+    3d67:	48 8d 05 16 a4 00 00 	lea    0xa416(%rip),%rax        # e184 <stats+0x4>
+    3d6e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3d71:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3d74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3d77:	48 98                	cltq
+    3d79:	48 83 c0 08          	add    $0x8,%rax
+    3d7d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3d84:	00 
+    3d85:	48 8d 05 f8 a3 00 00 	lea    0xa3f8(%rip),%rax        # e184 <stats+0x4>
+    3d8c:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    3d8f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3d92:	48 98                	cltq
+    3d94:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3d9b:	00 
+    3d9c:	48 8d 05 dd a3 00 00 	lea    0xa3dd(%rip),%rax        # e180 <stats>
+    3da3:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3da6:	8d 48 01             	lea    0x1(%rax),%ecx
+    3da9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    3dac:	48 98                	cltq
+    3dae:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3db5:	00 
+    3db6:	48 8d 05 c3 a3 00 00 	lea    0xa3c3(%rip),%rax        # e180 <stats>
+    3dbd:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    3dc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3dc4:	48 83 c0 10          	add    $0x10,%rax
+}
+    3dc8:	c9                   	leave
+    3dc9:	c3                   	ret
+
+0000000000003dca <free>:
+
+void free(void *ap) {
+    3dca:	55                   	push   %rbp
+    3dcb:	48 89 e5             	mov    %rsp,%rbp
+    3dce:	48 83 ec 18          	sub    $0x18,%rsp
+    3dd2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    3dd6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    3ddb:	0f 84 03 01 00 00    	je     3ee4 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    3de1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    3de5:	48 83 e8 10          	sub    $0x10,%rax
+    3de9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    3ded:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3df1:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3df5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    3df9:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    3dfe:	75 42                	jne    3e42 <free+0x78>
+    stats.inuse[LARGE]--;
+    3e00:	8b 05 9a a3 00 00    	mov    0xa39a(%rip),%eax        # e1a0 <stats+0x20>
+    3e06:	83 e8 01             	sub    $0x1,%eax
+    3e09:	89 05 91 a3 00 00    	mov    %eax,0xa391(%rip)        # e1a0 <stats+0x20>
+    stats.large -= b->h.size;
+    3e0f:	48 8b 15 b2 a3 00 00 	mov    0xa3b2(%rip),%rdx        # e1c8 <stats+0x48>
+    3e16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e1a:	48 8b 00             	mov    (%rax),%rax
+    3e1d:	48 29 c2             	sub    %rax,%rdx
+    3e20:	48 89 15 a1 a3 00 00 	mov    %rdx,0xa3a1(%rip)        # e1c8 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    3e27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e2b:	48 8b 10             	mov    (%rax),%rdx
+    3e2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e32:	48 89 d6             	mov    %rdx,%rsi
+    3e35:	48 89 c7             	mov    %rax,%rdi
+    3e38:	e8 ae fa ff ff       	call   38eb <pagefree>
+    return;
+    3e3d:	e9 a3 00 00 00       	jmp    3ee5 <free+0x11b>
+  }
+  b->next = freelist[c];
+    3e42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3e46:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    3e4d:	00 
+    3e4e:	48 8d 05 cb a2 00 00 	lea    0xa2cb(%rip),%rax        # e120 <freelist>
+    3e55:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    3e59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e5d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    3e61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3e65:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    3e6c:	00 
+    3e6d:	48 8d 15 ac a2 00 00 	lea    0xa2ac(%rip),%rdx        # e120 <freelist>
+    3e74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3e78:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    3e7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3e80:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3e87:	00 
+    3e88:	48 8d 05 f1 a2 00 00 	lea    0xa2f1(%rip),%rax        # e180 <stats>
+    3e8f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3e92:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    3e95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3e99:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3ea0:	00 
+    3ea1:	48 8d 05 d8 a2 00 00 	lea    0xa2d8(%rip),%rax        # e180 <stats>
+    3ea8:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    3eab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3eaf:	48 83 c0 08          	add    $0x8,%rax
+    3eb3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3eba:	00 
+    3ebb:	48 8d 05 c2 a2 00 00 	lea    0xa2c2(%rip),%rax        # e184 <stats+0x4>
+    3ec2:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    3ec5:	8d 48 01             	lea    0x1(%rax),%ecx
+    3ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3ecc:	48 83 c0 08          	add    $0x8,%rax
+    3ed0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3ed7:	00 
+    3ed8:	48 8d 05 a5 a2 00 00 	lea    0xa2a5(%rip),%rax        # e184 <stats+0x4>
+    3edf:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    3ee2:	eb 01                	jmp    3ee5 <free+0x11b>
+    return;
+    3ee4:	90                   	nop
+}
+    3ee5:	c9                   	leave
+    3ee6:	c3                   	ret
+
+0000000000003ee7 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    3ee7:	55                   	push   %rbp
+    3ee8:	48 89 e5             	mov    %rsp,%rbp
+    3eeb:	48 83 ec 30          	sub    $0x30,%rsp
+    3eef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    3ef2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3ef5:	48 8d 15 f4 09 00 00 	lea    0x9f4(%rip),%rdx        # 48f0 <benchreport+0x8e1>
+    3efc:	48 89 d6             	mov    %rdx,%rsi
+    3eff:	89 c7                	mov    %eax,%edi
+    3f01:	b8 00 00 00 00       	mov    $0x0,%eax
+    3f06:	e8 37 e6 ff ff       	call   2542 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3f0b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    3f12:	eb 67                	jmp    3f7b <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    3f14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3f17:	48 98                	cltq
+    3f19:	48 83 c0 08          	add    $0x8,%rax
+    3f1d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3f24:	00 
+    3f25:	48 8d 05 58 a2 00 00 	lea    0xa258(%rip),%rax        # e184 <stats+0x4>
+    3f2c:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    3f2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3f32:	48 98                	cltq
+    3f34:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    3f3b:	00 
+    3f3c:	48 8d 05 3d a2 00 00 	lea    0xa23d(%rip),%rax        # e180 <stats>
+    3f43:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    3f46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    3f49:	ba 20 00 00 00       	mov    $0x20,%edx
+    3f4e:	89 c1                	mov    %eax,%ecx
+    3f50:	48 d3 e2             	shl    %cl,%rdx
+    3f53:	48 89 d0             	mov    %rdx,%rax
+    3f56:	89 c1                	mov    %eax,%ecx
+    3f58:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    3f5b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3f5e:	41 89 f9             	mov    %edi,%r9d
+    3f61:	41 89 f0             	mov    %esi,%r8d
+    3f64:	48 8d 35 9c 09 00 00 	lea    0x99c(%rip),%rsi        # 4907 <benchreport+0x8f8>
+    3f6b:	89 c7                	mov    %eax,%edi
+    3f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+    3f72:	e8 cb e5 ff ff       	call   2542 <printf>
+  for (c = 0; c < NCLASS; c++)
+    3f77:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    3f7b:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    3f7f:	7e 93                	jle    3f14 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    3f81:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    3f88:	00 
+  for (r = runs; r; r = r->next)
+    3f89:	48 8b 05 d0 a1 00 00 	mov    0xa1d0(%rip),%rax        # e160 <runs>
+    3f90:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3f94:	eb 17                	jmp    3fad <mallocstats+0xc6>
+    nfree += r->size;
+    3f96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3f9a:	48 8b 00             	mov    (%rax),%rax
+    3f9d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    3fa1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    3fa5:	48 8b 40 08          	mov    0x8(%rax),%rax
+    3fa9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    3fad:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    3fb2:	75 e2                	jne    3f96 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    3fb4:	48 8b 05 15 a2 00 00 	mov    0xa215(%rip),%rax        # e1d0 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3fbb:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3fbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    3fc1:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3fc5:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    3fc7:	48 8b 05 fa a1 00 00 	mov    0xa1fa(%rip),%rax        # e1c8 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    3fce:	89 c1                	mov    %eax,%ecx
+    3fd0:	8b 15 ca a1 00 00    	mov    0xa1ca(%rip),%edx        # e1a0 <stats+0x20>
+    3fd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    3fd9:	41 89 f9             	mov    %edi,%r9d
+    3fdc:	41 89 f0             	mov    %esi,%r8d
+    3fdf:	48 8d 35 32 09 00 00 	lea    0x932(%rip),%rsi        # 4918 <benchreport+0x909>
+    3fe6:	89 c7                	mov    %eax,%edi
+    3fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+    3fed:	e8 50 e5 ff ff       	call   2542 <printf>
+}
+    3ff2:	90                   	nop
+    3ff3:	c9                   	leave
+    3ff4:	c3                   	ret
+
+0000000000003ff5 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    3ff5:	55                   	push   %rbp
+    3ff6:	48 89 e5             	mov    %rsp,%rbp
+    3ff9:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    3ffd:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    4001:	48 89 c7             	mov    %rax,%rdi
+    4004:	e8 9a f7 ff ff       	call   37a3 <cycles>
+  return t;
+    4009:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    400d:	c9                   	leave
+    400e:	c3                   	ret
+
+000000000000400f <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    400f:	55                   	push   %rbp
+    4010:	48 89 e5             	mov    %rsp,%rbp
+    4013:	48 83 ec 30          	sub    $0x30,%rsp
+    4017:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    401b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    401f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    4022:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    4026:	0f 8e 24 01 00 00    	jle    4150 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    402c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    4033:	e9 98 00 00 00       	jmp    40d0 <benchreport+0xc1>
+    x = t[i];
+    4038:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    403b:	48 98                	cltq
+    403d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    4044:	00 
+    4045:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4049:	48 01 d0             	add    %rdx,%rax
+    404c:	48 8b 00             	mov    (%rax),%rax
+    404f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    4053:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    4056:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    4059:	eb 33                	jmp    408e <benchreport+0x7f>
+      t[j] = t[j - 1];
+    405b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    405e:	48 98                	cltq
+    4060:	48 c1 e0 03          	shl    $0x3,%rax
+    4064:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    4068:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    406c:	48 01 d0             	add    %rdx,%rax
+    406f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    4072:	48 63 d2             	movslq %edx,%rdx
+    4075:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    407c:	00 
+    407d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    4081:	48 01 ca             	add    %rcx,%rdx
+    4084:	48 8b 00             	mov    (%rax),%rax
+    4087:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    408a:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    408e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    4092:	7e 1d                	jle    40b1 <benchreport+0xa2>
+    4094:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    4097:	48 98                	cltq
+    4099:	48 c1 e0 03          	shl    $0x3,%rax
+    409d:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    40a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    40a5:	48 01 d0             	add    %rdx,%rax
+    40a8:	48 8b 00             	mov    (%rax),%rax
+    40ab:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    40af:	72 aa                	jb     405b <benchreport+0x4c>
+    t[j] = x;
+    40b1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    40b4:	48 98                	cltq
+    40b6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    40bd:	00 
+    40be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    40c2:	48 01 c2             	add    %rax,%rdx
+    40c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    40c9:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    40cc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    40d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    40d3:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    40d6:	0f 8c 5c ff ff ff    	jl     4038 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    40dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    40df:	48 98                	cltq
+    40e1:	48 c1 e0 03          	shl    $0x3,%rax
+    40e5:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    40e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    40ed:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    40f0:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    40f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    40f6:	89 c2                	mov    %eax,%edx
+    40f8:	c1 ea 1f             	shr    $0x1f,%edx
+    40fb:	01 d0                	add    %edx,%eax
+    40fd:	d1 f8                	sar    %eax
+    40ff:	48 98                	cltq
+    4101:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    4108:	00 
+    4109:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    410d:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    4110:	48 8b 38             	mov    (%rax),%rdi
+    4113:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    4117:	48 8b 30             	mov    (%rax),%rsi
+    411a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    411d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    4121:	48 83 ec 08          	sub    $0x8,%rsp
+    4125:	51                   	push   %rcx
+    4126:	49 89 f9             	mov    %rdi,%r9
+    4129:	49 89 f0             	mov    %rsi,%r8
+    412c:	89 d1                	mov    %edx,%ecx
+    412e:	48 89 c2             	mov    %rax,%rdx
+    4131:	48 8d 05 20 08 00 00 	lea    0x820(%rip),%rax        # 4958 <benchreport+0x949>
+    4138:	48 89 c6             	mov    %rax,%rsi
+    413b:	bf 01 00 00 00       	mov    $0x1,%edi
+    4140:	b8 00 00 00 00       	mov    $0x0,%eax
+    4145:	e8 f8 e3 ff ff       	call   2542 <printf>
+    414a:	48 83 c4 10          	add    $0x10,%rsp
+    414e:	eb 01                	jmp    4151 <benchreport+0x142>
+    return;
+    4150:	90                   	nop
+}
+    4151:	c9                   	leave
+    4152:	c3                   	ret
@@ -0,0 +1,3372 @@
+
+out/user/_ln:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (argc != 3) {
+       f:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+      13:	74 1e                	je     33 <main+0x33>
+    printf(2, "Usage: ln old new\n");
+      15:	48 8d 05 4c 1e 00 00 	lea    0x1e4c(%rip),%rax        # 1e68 <benchreport+0x14b>
+      1c:	48 89 c6             	mov    %rax,%rsi
+      1f:	bf 02 00 00 00       	mov    $0x2,%edi
+      24:	b8 00 00 00 00       	mov    $0x0,%eax
+      29:	e8 22 02 00 00       	call   250 <printf>
+    exit();
+      2e:	e8 4d 08 00 00       	call   880 <exit>
+  }
+  if (link(argv[1], argv[2]) < 0)
+      33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      37:	48 83 c0 10          	add    $0x10,%rax
+      3b:	48 8b 10             	mov    (%rax),%rdx
+      3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      42:	48 83 c0 08          	add    $0x8,%rax
+      46:	48 8b 00             	mov    (%rax),%rax
+      49:	48 89 d6             	mov    %rdx,%rsi
+      4c:	48 89 c7             	mov    %rax,%rdi
+      4f:	e8 34 13 00 00       	call   1388 <link>
+      54:	85 c0                	test   %eax,%eax
+      56:	79 35                	jns    8d <main+0x8d>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+      58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      5c:	48 83 c0 10          	add    $0x10,%rax
+      60:	48 8b 10             	mov    (%rax),%rdx
+      63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      67:	48 83 c0 08          	add    $0x8,%rax
+      6b:	48 8b 00             	mov    (%rax),%rax
+      6e:	48 89 d1             	mov    %rdx,%rcx
+      71:	48 89 c2             	mov    %rax,%rdx
+      74:	48 8d 05 00 1e 00 00 	lea    0x1e00(%rip),%rax        # 1e7b <benchreport+0x15e>
+      7b:	48 89 c6             	mov    %rax,%rsi
+      7e:	bf 02 00 00 00       	mov    $0x2,%edi
+      83:	b8 00 00 00 00       	mov    $0x0,%eax
+      88:	e8 c3 01 00 00       	call   250 <printf>
+  exit();
+      8d:	e8 ee 07 00 00       	call   880 <exit>
+
+0000000000000092 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      92:	55                   	push   %rbp
+      93:	48 89 e5             	mov    %rsp,%rbp
+      96:	48 83 ec 10          	sub    $0x10,%rsp
+      9a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+      9d:	89 f0                	mov    %esi,%eax
+      9f:	88 45 f8             	mov    %al,-0x8(%rbp)
+      a2:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+      a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      a9:	89 d6                	mov    %edx,%esi
+      ab:	89 c7                	mov    %eax,%edi
+      ad:	e8 eb 06 00 00       	call   79d <bputc>
+      b2:	90                   	nop
+      b3:	c9                   	leave
+      b4:	c3                   	ret
+
+00000000000000b5 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+      b5:	55                   	push   %rbp
+      b6:	48 89 e5             	mov    %rsp,%rbp
+      b9:	48 83 ec 50          	sub    $0x50,%rsp
+      bd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+      c0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+      c4:	89 55 c8             	mov    %edx,-0x38(%rbp)
+      c7:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+      ca:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      ce:	74 21                	je     f1 <printint64+0x3c>
+      d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      d4:	48 c1 e8 3f          	shr    $0x3f,%rax
+      d8:	0f b6 c0             	movzbl %al,%eax
+      db:	89 45 bc             	mov    %eax,-0x44(%rbp)
+      de:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      e2:	74 0d                	je     f1 <printint64+0x3c>
+    x = -xx;
+      e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      e8:	48 f7 d8             	neg    %rax
+      eb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      ef:	eb 08                	jmp    f9 <printint64+0x44>
+  else
+    x = xx;
+      f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+      f9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     100:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     103:	48 63 c8             	movslq %eax,%rcx
+     106:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     10a:	ba 00 00 00 00       	mov    $0x0,%edx
+     10f:	48 f7 f1             	div    %rcx
+     112:	48 89 d1             	mov    %rdx,%rcx
+     115:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     118:	8d 50 01             	lea    0x1(%rax),%edx
+     11b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     11e:	48 8d 15 db 2e 00 00 	lea    0x2edb(%rip),%rdx        # 3000 <digits.1>
+     125:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     129:	48 98                	cltq
+     12b:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     12f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     132:	48 63 f0             	movslq %eax,%rsi
+     135:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     139:	ba 00 00 00 00       	mov    $0x0,%edx
+     13e:	48 f7 f6             	div    %rsi
+     141:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     145:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     14a:	75 b4                	jne    100 <printint64+0x4b>
+
+  if (sgn)
+     14c:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     150:	74 2b                	je     17d <printint64+0xc8>
+    buf[i++] = '-';
+     152:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     155:	8d 50 01             	lea    0x1(%rax),%edx
+     158:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     15b:	48 98                	cltq
+     15d:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     162:	eb 19                	jmp    17d <printint64+0xc8>
+    putc(fd, buf[i]);
+     164:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     167:	48 98                	cltq
+     169:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     16e:	0f be d0             	movsbl %al,%edx
+     171:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     174:	89 d6                	mov    %edx,%esi
+     176:	89 c7                	mov    %eax,%edi
+     178:	e8 15 ff ff ff       	call   92 <putc>
+  while (--i >= 0)
+     17d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     181:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     185:	79 dd                	jns    164 <printint64+0xaf>
+}
+     187:	90                   	nop
+     188:	90                   	nop
+     189:	c9                   	leave
+     18a:	c3                   	ret
+
+000000000000018b <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     18b:	55                   	push   %rbp
+     18c:	48 89 e5             	mov    %rsp,%rbp
+     18f:	48 83 ec 30          	sub    $0x30,%rsp
+     193:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     196:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     199:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     19c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     19f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     1a6:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     1aa:	74 17                	je     1c3 <printint+0x38>
+     1ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     1b0:	79 11                	jns    1c3 <printint+0x38>
+    neg = 1;
+     1b2:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     1b9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1bc:	f7 d8                	neg    %eax
+     1be:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1c1:	eb 06                	jmp    1c9 <printint+0x3e>
+  } else {
+    x = xx;
+     1c3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1c6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     1c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1d0:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     1d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1d6:	ba 00 00 00 00       	mov    $0x0,%edx
+     1db:	f7 f1                	div    %ecx
+     1dd:	89 d1                	mov    %edx,%ecx
+     1df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e2:	8d 50 01             	lea    0x1(%rax),%edx
+     1e5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1e8:	89 c9                	mov    %ecx,%ecx
+     1ea:	48 8d 15 2f 2e 00 00 	lea    0x2e2f(%rip),%rdx        # 3020 <digits.0>
+     1f1:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     1f5:	48 98                	cltq
+     1f7:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     1fb:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     1fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     201:	ba 00 00 00 00       	mov    $0x0,%edx
+     206:	f7 f6                	div    %esi
+     208:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     20b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     20f:	75 bf                	jne    1d0 <printint+0x45>
+  if (neg)
+     211:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     215:	74 2b                	je     242 <printint+0xb7>
+    buf[i++] = '-';
+     217:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     21a:	8d 50 01             	lea    0x1(%rax),%edx
+     21d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     220:	48 98                	cltq
+     222:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     227:	eb 19                	jmp    242 <printint+0xb7>
+    putc(fd, buf[i]);
+     229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     22c:	48 98                	cltq
+     22e:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     233:	0f be d0             	movsbl %al,%edx
+     236:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     239:	89 d6                	mov    %edx,%esi
+     23b:	89 c7                	mov    %eax,%edi
+     23d:	e8 50 fe ff ff       	call   92 <putc>
+  while (--i >= 0)
+     242:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     246:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     24a:	79 dd                	jns    229 <printint+0x9e>
+}
+     24c:	90                   	nop
+     24d:	90                   	nop
+     24e:	c9                   	leave
+     24f:	c3                   	ret
+
+0000000000000250 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     250:	55                   	push   %rbp
+     251:	48 89 e5             	mov    %rsp,%rbp
+     254:	48 83 ec 70          	sub    $0x70,%rsp
+     258:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     25b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     25f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     263:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     267:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     26b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     26f:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     276:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     27a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     27e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     282:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     286:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     28d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     294:	e9 67 02 00 00       	jmp    500 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     299:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     29c:	48 63 d0             	movslq %eax,%rdx
+     29f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     2a3:	48 01 d0             	add    %rdx,%rax
+     2a6:	0f b6 00             	movzbl (%rax),%eax
+     2a9:	0f be c0             	movsbl %al,%eax
+     2ac:	25 ff 00 00 00       	and    $0xff,%eax
+     2b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     2b4:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     2b8:	75 30                	jne    2ea <printf+0x9a>
+      if (c == '%') {
+     2ba:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     2be:	75 13                	jne    2d3 <printf+0x83>
+        state = '%';
+     2c0:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     2c7:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     2ce:	e9 29 02 00 00       	jmp    4fc <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     2d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     2d6:	0f be d0             	movsbl %al,%edx
+     2d9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     2dc:	89 d6                	mov    %edx,%esi
+     2de:	89 c7                	mov    %eax,%edi
+     2e0:	e8 ad fd ff ff       	call   92 <putc>
+     2e5:	e9 12 02 00 00       	jmp    4fc <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     2ea:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     2ee:	0f 85 08 02 00 00    	jne    4fc <printf+0x2ac>
+      if (c == 'l') {
+     2f4:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     2f8:	75 0c                	jne    306 <printf+0xb6>
+        lflag = 1;
+     2fa:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     301:	e9 f6 01 00 00       	jmp    4fc <printf+0x2ac>
+      } else if (c == 'd') {
+     306:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     30a:	0f 85 93 00 00 00    	jne    3a3 <printf+0x153>
+        if (lflag == 1)
+     310:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     314:	75 47                	jne    35d <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     316:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     319:	83 f8 2f             	cmp    $0x2f,%eax
+     31c:	77 17                	ja     335 <printf+0xe5>
+     31e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     322:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     325:	89 d2                	mov    %edx,%edx
+     327:	48 01 d0             	add    %rdx,%rax
+     32a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     32d:	83 c2 08             	add    $0x8,%edx
+     330:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     333:	eb 0c                	jmp    341 <printf+0xf1>
+     335:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     339:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     33d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     341:	48 8b 30             	mov    (%rax),%rsi
+     344:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     347:	b9 01 00 00 00       	mov    $0x1,%ecx
+     34c:	ba 0a 00 00 00       	mov    $0xa,%edx
+     351:	89 c7                	mov    %eax,%edi
+     353:	e8 5d fd ff ff       	call   b5 <printint64>
+     358:	e9 98 01 00 00       	jmp    4f5 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     35d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     360:	83 f8 2f             	cmp    $0x2f,%eax
+     363:	77 17                	ja     37c <printf+0x12c>
+     365:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     369:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     36c:	89 d2                	mov    %edx,%edx
+     36e:	48 01 d0             	add    %rdx,%rax
+     371:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     374:	83 c2 08             	add    $0x8,%edx
+     377:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     37a:	eb 0c                	jmp    388 <printf+0x138>
+     37c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     380:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     384:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     388:	8b 30                	mov    (%rax),%esi
+     38a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     38d:	b9 01 00 00 00       	mov    $0x1,%ecx
+     392:	ba 0a 00 00 00       	mov    $0xa,%edx
+     397:	89 c7                	mov    %eax,%edi
+     399:	e8 ed fd ff ff       	call   18b <printint>
+     39e:	e9 52 01 00 00       	jmp    4f5 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     3a3:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     3a7:	74 0a                	je     3b3 <printf+0x163>
+     3a9:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     3ad:	0f 85 93 00 00 00    	jne    446 <printf+0x1f6>
+        if (lflag == 1)
+     3b3:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     3b7:	75 47                	jne    400 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     3b9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3bc:	83 f8 2f             	cmp    $0x2f,%eax
+     3bf:	77 17                	ja     3d8 <printf+0x188>
+     3c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3c5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3c8:	89 d2                	mov    %edx,%edx
+     3ca:	48 01 d0             	add    %rdx,%rax
+     3cd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3d0:	83 c2 08             	add    $0x8,%edx
+     3d3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3d6:	eb 0c                	jmp    3e4 <printf+0x194>
+     3d8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3dc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3e0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3e4:	48 8b 30             	mov    (%rax),%rsi
+     3e7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+     3ef:	ba 10 00 00 00       	mov    $0x10,%edx
+     3f4:	89 c7                	mov    %eax,%edi
+     3f6:	e8 ba fc ff ff       	call   b5 <printint64>
+        if (lflag == 1)
+     3fb:	e9 f5 00 00 00       	jmp    4f5 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     400:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     403:	83 f8 2f             	cmp    $0x2f,%eax
+     406:	77 17                	ja     41f <printf+0x1cf>
+     408:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     40c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     40f:	89 d2                	mov    %edx,%edx
+     411:	48 01 d0             	add    %rdx,%rax
+     414:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     417:	83 c2 08             	add    $0x8,%edx
+     41a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     41d:	eb 0c                	jmp    42b <printf+0x1db>
+     41f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     423:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     427:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     42b:	8b 30                	mov    (%rax),%esi
+     42d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     430:	b9 00 00 00 00       	mov    $0x0,%ecx
+     435:	ba 10 00 00 00       	mov    $0x10,%edx
+     43a:	89 c7                	mov    %eax,%edi
+     43c:	e8 4a fd ff ff       	call   18b <printint>
+        if (lflag == 1)
+     441:	e9 af 00 00 00       	jmp    4f5 <printf+0x2a5>
+      } else if (c == 's') {
+     446:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     44a:	75 6e                	jne    4ba <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     44c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     44f:	83 f8 2f             	cmp    $0x2f,%eax
+     452:	77 17                	ja     46b <printf+0x21b>
+     454:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     458:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     45b:	89 d2                	mov    %edx,%edx
+     45d:	48 01 d0             	add    %rdx,%rax
+     460:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     463:	83 c2 08             	add    $0x8,%edx
+     466:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     469:	eb 0c                	jmp    477 <printf+0x227>
+     46b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     46f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     473:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     477:	48 8b 00             	mov    (%rax),%rax
+     47a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     47e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     483:	75 28                	jne    4ad <printf+0x25d>
+          s = "(null)";
+     485:	48 8d 05 03 1a 00 00 	lea    0x1a03(%rip),%rax        # 1e8f <benchreport+0x172>
+     48c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     490:	eb 1b                	jmp    4ad <printf+0x25d>
+          putc(fd, *s);
+     492:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     496:	0f b6 00             	movzbl (%rax),%eax
+     499:	0f be d0             	movsbl %al,%edx
+     49c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     49f:	89 d6                	mov    %edx,%esi
+     4a1:	89 c7                	mov    %eax,%edi
+     4a3:	e8 ea fb ff ff       	call   92 <putc>
+        for (; *s; s++)
+     4a8:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     4ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     4b1:	0f b6 00             	movzbl (%rax),%eax
+     4b4:	84 c0                	test   %al,%al
+     4b6:	75 da                	jne    492 <printf+0x242>
+     4b8:	eb 3b                	jmp    4f5 <printf+0x2a5>
+      } else if (c == '%') {
+     4ba:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     4be:	75 14                	jne    4d4 <printf+0x284>
+        putc(fd, c);
+     4c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4c3:	0f be d0             	movsbl %al,%edx
+     4c6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4c9:	89 d6                	mov    %edx,%esi
+     4cb:	89 c7                	mov    %eax,%edi
+     4cd:	e8 c0 fb ff ff       	call   92 <putc>
+     4d2:	eb 21                	jmp    4f5 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     4d4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4d7:	be 25 00 00 00       	mov    $0x25,%esi
+     4dc:	89 c7                	mov    %eax,%edi
+     4de:	e8 af fb ff ff       	call   92 <putc>
+        putc(fd, c);
+     4e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4e6:	0f be d0             	movsbl %al,%edx
+     4e9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4ec:	89 d6                	mov    %edx,%esi
+     4ee:	89 c7                	mov    %eax,%edi
+     4f0:	e8 9d fb ff ff       	call   92 <putc>
+      }
+      state = 0;
+     4f5:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     4fc:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     500:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     503:	48 63 d0             	movslq %eax,%rdx
+     506:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     50a:	48 01 d0             	add    %rdx,%rax
+     50d:	0f b6 00             	movzbl (%rax),%eax
+     510:	84 c0                	test   %al,%al
+     512:	0f 85 81 fd ff ff    	jne    299 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     518:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     51b:	89 c7                	mov    %eax,%edi
+     51d:	e8 ee 02 00 00       	call   810 <bflushtty>
+}
+     522:	90                   	nop
+     523:	c9                   	leave
+     524:	c3                   	ret
+
+0000000000000525 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     525:	55                   	push   %rbp
+     526:	48 89 e5             	mov    %rsp,%rbp
+     529:	48 83 ec 30          	sub    $0x30,%rsp
+     52d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     530:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     534:	78 06                	js     53c <getbuf+0x17>
+     536:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     53a:	7e 0a                	jle    546 <getbuf+0x21>
+    return 0;
+     53c:	b8 00 00 00 00       	mov    $0x0,%eax
+     541:	e9 94 00 00 00       	jmp    5da <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     546:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     549:	48 98                	cltq
+     54b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     552:	00 
+     553:	48 8d 05 e6 2a 00 00 	lea    0x2ae6(%rip),%rax        # 3040 <obufs>
+     55a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     55e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     562:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     567:	75 6d                	jne    5d6 <getbuf+0xb1>
+     569:	bf 08 02 00 00       	mov    $0x208,%edi
+     56e:	e8 bd 13 00 00       	call   1930 <malloc>
+     573:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     577:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     57c:	74 58                	je     5d6 <getbuf+0xb1>
+    b->n = 0;
+     57e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     582:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     588:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     58c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     58f:	48 89 d6             	mov    %rdx,%rsi
+     592:	89 c7                	mov    %eax,%edi
+     594:	e8 e4 0d 00 00       	call   137d <fstat>
+     599:	85 c0                	test   %eax,%eax
+     59b:	75 11                	jne    5ae <getbuf+0x89>
+     59d:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     5a1:	66 83 f8 03          	cmp    $0x3,%ax
+     5a5:	75 07                	jne    5ae <getbuf+0x89>
+     5a7:	ba 01 00 00 00       	mov    $0x1,%edx
+     5ac:	eb 05                	jmp    5b3 <getbuf+0x8e>
+     5ae:	ba 00 00 00 00       	mov    $0x0,%edx
+     5b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5b7:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     5ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5bd:	48 98                	cltq
+     5bf:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     5c6:	00 
+     5c7:	48 8d 15 72 2a 00 00 	lea    0x2a72(%rip),%rdx        # 3040 <obufs>
+     5ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5d2:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     5d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5da:	c9                   	leave
+     5db:	c3                   	ret
+
+00000000000005dc <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     5dc:	55                   	push   %rbp
+     5dd:	48 89 e5             	mov    %rsp,%rbp
+     5e0:	48 83 ec 20          	sub    $0x20,%rsp
+     5e4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     5e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     5eb:	78 33                	js     620 <bflush+0x44>
+     5ed:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     5f1:	7f 2d                	jg     620 <bflush+0x44>
+     5f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     5f6:	48 98                	cltq
+     5f8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     5ff:	00 
+     600:	48 8d 05 39 2a 00 00 	lea    0x2a39(%rip),%rax        # 3040 <obufs>
+     607:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     60b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     60f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     614:	74 0a                	je     620 <bflush+0x44>
+     616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     61a:	8b 00                	mov    (%rax),%eax
+     61c:	85 c0                	test   %eax,%eax
+     61e:	75 07                	jne    627 <bflush+0x4b>
+    return 0;
+     620:	b8 00 00 00 00       	mov    $0x0,%eax
+     625:	eb 3c                	jmp    663 <bflush+0x87>
+  n = b->n;
+     627:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     62b:	8b 00                	mov    (%rax),%eax
+     62d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     630:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     634:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     63a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     63e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     642:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     645:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     648:	48 89 ce             	mov    %rcx,%rsi
+     64b:	89 c7                	mov    %eax,%edi
+     64d:	e8 de 0c 00 00       	call   1330 <write>
+     652:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     655:	75 07                	jne    65e <bflush+0x82>
+     657:	b8 00 00 00 00       	mov    $0x0,%eax
+     65c:	eb 05                	jmp    663 <bflush+0x87>
+     65e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     663:	c9                   	leave
+     664:	c3                   	ret
+
+0000000000000665 <bflushall>:
+
+void bflushall(void) {
+     665:	55                   	push   %rbp
+     666:	48 89 e5             	mov    %rsp,%rbp
+     669:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     66d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     674:	eb 0e                	jmp    684 <bflushall+0x1f>
+    bflush(fd);
+     676:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     679:	89 c7                	mov    %eax,%edi
+     67b:	e8 5c ff ff ff       	call   5dc <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     680:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     684:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     688:	7e ec                	jle    676 <bflushall+0x11>
+}
+     68a:	90                   	nop
+     68b:	90                   	nop
+     68c:	c9                   	leave
+     68d:	c3                   	ret
+
+000000000000068e <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     68e:	55                   	push   %rbp
+     68f:	48 89 e5             	mov    %rsp,%rbp
+     692:	48 83 ec 30          	sub    $0x30,%rsp
+     696:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     699:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     69d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     6a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6a3:	89 c7                	mov    %eax,%edi
+     6a5:	e8 7b fe ff ff       	call   525 <getbuf>
+     6aa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     6ae:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     6b3:	75 19                	jne    6ce <bwrite+0x40>
+    return write(fd, s, n);
+     6b5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     6b8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     6bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6bf:	48 89 ce             	mov    %rcx,%rsi
+     6c2:	89 c7                	mov    %eax,%edi
+     6c4:	e8 67 0c 00 00       	call   1330 <write>
+     6c9:	e9 cd 00 00 00       	jmp    79b <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     6ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6d5:	e9 92 00 00 00       	jmp    76c <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     6da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6de:	8b 00                	mov    (%rax),%eax
+     6e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e5:	75 18                	jne    6ff <bwrite+0x71>
+     6e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6ea:	89 c7                	mov    %eax,%edi
+     6ec:	e8 eb fe ff ff       	call   5dc <bflush>
+     6f1:	85 c0                	test   %eax,%eax
+     6f3:	79 0a                	jns    6ff <bwrite+0x71>
+      return -1;
+     6f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6fa:	e9 9c 00 00 00       	jmp    79b <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     6ff:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     702:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     705:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     708:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     70c:	8b 00                	mov    (%rax),%eax
+     70e:	ba 00 02 00 00       	mov    $0x200,%edx
+     713:	29 c2                	sub    %eax,%edx
+     715:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     718:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     71b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     71e:	39 c2                	cmp    %eax,%edx
+     720:	0f 4e c2             	cmovle %edx,%eax
+     723:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     726:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     729:	48 63 d0             	movslq %eax,%rdx
+     72c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     730:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     734:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     738:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     73c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     740:	8b 00                	mov    (%rax),%eax
+     742:	48 98                	cltq
+     744:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     748:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     74b:	89 c2                	mov    %eax,%edx
+     74d:	48 89 cf             	mov    %rcx,%rdi
+     750:	e8 e9 06 00 00       	call   e3e <memmove>
+    b->n += m;
+     755:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     759:	8b 10                	mov    (%rax),%edx
+     75b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     75e:	01 c2                	add    %eax,%edx
+     760:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     764:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     766:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     769:	01 45 fc             	add    %eax,-0x4(%rbp)
+     76c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     76f:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     772:	0f 8c 62 ff ff ff    	jl     6da <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     778:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     77c:	8b 40 04             	mov    0x4(%rax),%eax
+     77f:	85 c0                	test   %eax,%eax
+     781:	74 15                	je     798 <bwrite+0x10a>
+     783:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     786:	89 c7                	mov    %eax,%edi
+     788:	e8 4f fe ff ff       	call   5dc <bflush>
+     78d:	85 c0                	test   %eax,%eax
+     78f:	79 07                	jns    798 <bwrite+0x10a>
+    return -1;
+     791:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     796:	eb 03                	jmp    79b <bwrite+0x10d>
+  return n;
+     798:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     79b:	c9                   	leave
+     79c:	c3                   	ret
+
+000000000000079d <bputc>:
+
+void bputc(int fd, char c) {
+     79d:	55                   	push   %rbp
+     79e:	48 89 e5             	mov    %rsp,%rbp
+     7a1:	48 83 ec 20          	sub    $0x20,%rsp
+     7a5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     7a8:	89 f0                	mov    %esi,%eax
+     7aa:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     7ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7b0:	89 c7                	mov    %eax,%edi
+     7b2:	e8 6e fd ff ff       	call   525 <getbuf>
+     7b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     7bb:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     7c0:	75 18                	jne    7da <bputc+0x3d>
+    write(fd, &c, 1);
+     7c2:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     7c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7c9:	ba 01 00 00 00       	mov    $0x1,%edx
+     7ce:	48 89 ce             	mov    %rcx,%rsi
+     7d1:	89 c7                	mov    %eax,%edi
+     7d3:	e8 58 0b 00 00       	call   1330 <write>
+    return;
+     7d8:	eb 34                	jmp    80e <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     7da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7de:	8b 00                	mov    (%rax),%eax
+     7e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7e5:	75 0a                	jne    7f1 <bputc+0x54>
+    bflush(fd);
+     7e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7ea:	89 c7                	mov    %eax,%edi
+     7ec:	e8 eb fd ff ff       	call   5dc <bflush>
+  b->data[b->n++] = c;
+     7f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7f5:	8b 00                	mov    (%rax),%eax
+     7f7:	8d 48 01             	lea    0x1(%rax),%ecx
+     7fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     7fe:	89 0a                	mov    %ecx,(%rdx)
+     800:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     804:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     808:	48 98                	cltq
+     80a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     80e:	c9                   	leave
+     80f:	c3                   	ret
+
+0000000000000810 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     810:	55                   	push   %rbp
+     811:	48 89 e5             	mov    %rsp,%rbp
+     814:	48 83 ec 10          	sub    $0x10,%rsp
+     818:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     81b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     81f:	78 4c                	js     86d <bflushtty+0x5d>
+     821:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     825:	7f 46                	jg     86d <bflushtty+0x5d>
+     827:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     82a:	48 98                	cltq
+     82c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     833:	00 
+     834:	48 8d 05 05 28 00 00 	lea    0x2805(%rip),%rax        # 3040 <obufs>
+     83b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     83f:	48 85 c0             	test   %rax,%rax
+     842:	74 29                	je     86d <bflushtty+0x5d>
+     844:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     847:	48 98                	cltq
+     849:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     850:	00 
+     851:	48 8d 05 e8 27 00 00 	lea    0x27e8(%rip),%rax        # 3040 <obufs>
+     858:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     85c:	8b 40 04             	mov    0x4(%rax),%eax
+     85f:	85 c0                	test   %eax,%eax
+     861:	74 0a                	je     86d <bflushtty+0x5d>
+    bflush(fd);
+     863:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     866:	89 c7                	mov    %eax,%edi
+     868:	e8 6f fd ff ff       	call   5dc <bflush>
+}
+     86d:	90                   	nop
+     86e:	c9                   	leave
+     86f:	c3                   	ret
+
+0000000000000870 <fork>:
+
+int fork(void) {
+     870:	55                   	push   %rbp
+     871:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     874:	e8 ec fd ff ff       	call   665 <bflushall>
+  return _fork();
+     879:	e8 7b 0a 00 00       	call   12f9 <_fork>
+}
+     87e:	5d                   	pop    %rbp
+     87f:	c3                   	ret
+
+0000000000000880 <exit>:
+
+noreturn void exit(void) {
+     880:	55                   	push   %rbp
+     881:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     884:	e8 dc fd ff ff       	call   665 <bflushall>
+  _exit();
+     889:	e8 76 0a 00 00       	call   1304 <_exit>
+
+000000000000088e <exec>:
+}
+
+int exec(char *path, char **argv) {
+     88e:	55                   	push   %rbp
+     88f:	48 89 e5             	mov    %rsp,%rbp
+     892:	48 83 ec 10          	sub    $0x10,%rsp
+     896:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     89a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     89e:	e8 c2 fd ff ff       	call   665 <bflushall>
+  return _exec(path, argv);
+     8a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     8a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8ab:	48 89 d6             	mov    %rdx,%rsi
+     8ae:	48 89 c7             	mov    %rax,%rdi
+     8b1:	e8 9b 0a 00 00       	call   1351 <_exec>
+}
+     8b6:	c9                   	leave
+     8b7:	c3                   	ret
+
+00000000000008b8 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     8b8:	55                   	push   %rbp
+     8b9:	48 89 e5             	mov    %rsp,%rbp
+     8bc:	48 83 ec 20          	sub    $0x20,%rsp
+     8c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     8c8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     8cc:	e8 94 fd ff ff       	call   665 <bflushall>
+  return _spawn(path, argv, fds);
+     8d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     8d5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8dd:	48 89 ce             	mov    %rcx,%rsi
+     8e0:	48 89 c7             	mov    %rax,%rdi
+     8e3:	e8 2f 0b 00 00       	call   1417 <_spawn>
+}
+     8e8:	c9                   	leave
+     8e9:	c3                   	ret
+
+00000000000008ea <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     8ea:	55                   	push   %rbp
+     8eb:	48 89 e5             	mov    %rsp,%rbp
+     8ee:	48 83 ec 10          	sub    $0x10,%rsp
+     8f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     8f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8f9:	78 69                	js     964 <close+0x7a>
+     8fb:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     8ff:	7f 63                	jg     964 <close+0x7a>
+     901:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     904:	48 98                	cltq
+     906:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     90d:	00 
+     90e:	48 8d 05 2b 27 00 00 	lea    0x272b(%rip),%rax        # 3040 <obufs>
+     915:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     919:	48 85 c0             	test   %rax,%rax
+     91c:	74 46                	je     964 <close+0x7a>
+    bflush(fd);
+     91e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     921:	89 c7                	mov    %eax,%edi
+     923:	e8 b4 fc ff ff       	call   5dc <bflush>
+    free(obufs[fd]);
+     928:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     92b:	48 98                	cltq
+     92d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     934:	00 
+     935:	48 8d 05 04 27 00 00 	lea    0x2704(%rip),%rax        # 3040 <obufs>
+     93c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     940:	48 89 c7             	mov    %rax,%rdi
+     943:	e8 90 11 00 00       	call   1ad8 <free>
+    obufs[fd] = 0;
+     948:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     94b:	48 98                	cltq
+     94d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     954:	00 
+     955:	48 8d 05 e4 26 00 00 	lea    0x26e4(%rip),%rax        # 3040 <obufs>
+     95c:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     963:	00 
+  }
+  return _close(fd);
+     964:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     967:	89 c7                	mov    %eax,%edi
+     969:	e8 cd 09 00 00       	call   133b <_close>
+}
+     96e:	c9                   	leave
+     96f:	c3                   	ret
+
+0000000000000970 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     970:	55                   	push   %rbp
+     971:	48 89 e5             	mov    %rsp,%rbp
+     974:	53                   	push   %rbx
+     975:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     979:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     97d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     981:	48 8b 36             	mov    (%rsi),%rsi
+     984:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     988:	48 29 f7             	sub    %rsi,%rdi
+     98b:	48 89 f9             	mov    %rdi,%rcx
+     98e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     993:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     997:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     99b:	48 89 f0             	mov    %rsi,%rax
+     99e:	ba 00 00 00 00       	mov    $0x0,%edx
+     9a3:	48 89 df             	mov    %rbx,%rdi
+     9a6:	48 0f af f8          	imul   %rax,%rdi
+     9aa:	48 89 d6             	mov    %rdx,%rsi
+     9ad:	48 0f af f1          	imul   %rcx,%rsi
+     9b1:	48 01 fe             	add    %rdi,%rsi
+     9b4:	48 f7 e1             	mul    %rcx
+     9b7:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     9bb:	48 89 ca             	mov    %rcx,%rdx
+     9be:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     9c3:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     9c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     9cb:	c9                   	leave
+     9cc:	c3                   	ret
+
+00000000000009cd <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     9cd:	55                   	push   %rbp
+     9ce:	48 89 e5             	mov    %rsp,%rbp
+     9d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9d5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     9d8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     9db:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9df:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     9e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     9e5:	48 89 ce             	mov    %rcx,%rsi
+     9e8:	48 89 f7             	mov    %rsi,%rdi
+     9eb:	89 d1                	mov    %edx,%ecx
+     9ed:	fc                   	cld
+     9ee:	f3 aa                	rep stos %al,%es:(%rdi)
+     9f0:	89 ca                	mov    %ecx,%edx
+     9f2:	48 89 fe             	mov    %rdi,%rsi
+     9f5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     9f9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     9fc:	90                   	nop
+     9fd:	5d                   	pop    %rbp
+     9fe:	c3                   	ret
+
+00000000000009ff <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     9ff:	55                   	push   %rbp
+     a00:	48 89 e5             	mov    %rsp,%rbp
+     a03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a0b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     a0f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a1b:	48 89 ce             	mov    %rcx,%rsi
+     a1e:	48 89 f7             	mov    %rsi,%rdi
+     a21:	48 89 d1             	mov    %rdx,%rcx
+     a24:	fc                   	cld
+     a25:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     a28:	48 89 ca             	mov    %rcx,%rdx
+     a2b:	48 89 fe             	mov    %rdi,%rsi
+     a2e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a32:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a36:	90                   	nop
+     a37:	5d                   	pop    %rbp
+     a38:	c3                   	ret
+
+0000000000000a39 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     a39:	55                   	push   %rbp
+     a3a:	48 89 e5             	mov    %rsp,%rbp
+     a3d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a41:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a45:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     a49:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a4d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a55:	48 89 cf             	mov    %rcx,%rdi
+     a58:	48 89 d6             	mov    %rdx,%rsi
+     a5b:	48 89 c1             	mov    %rax,%rcx
+     a5e:	fc                   	cld
+     a5f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     a61:	48 89 c8             	mov    %rcx,%rax
+     a64:	48 89 f2             	mov    %rsi,%rdx
+     a67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a6b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a6f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a73:	90                   	nop
+     a74:	5d                   	pop    %rbp
+     a75:	c3                   	ret
+
+0000000000000a76 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     a76:	55                   	push   %rbp
+     a77:	48 89 e5             	mov    %rsp,%rbp
+     a7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a82:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     a86:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a8a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a92:	48 89 cf             	mov    %rcx,%rdi
+     a95:	48 89 d6             	mov    %rdx,%rsi
+     a98:	48 89 c1             	mov    %rax,%rcx
+     a9b:	fc                   	cld
+     a9c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     a9f:	48 89 c8             	mov    %rcx,%rax
+     aa2:	48 89 f2             	mov    %rsi,%rdx
+     aa5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     aa9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     aad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     ab1:	90                   	nop
+     ab2:	5d                   	pop    %rbp
+     ab3:	c3                   	ret
+
+0000000000000ab4 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     ab4:	55                   	push   %rbp
+     ab5:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     ab8:	0f 31                	rdtsc
+     aba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     abd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     ac0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     ac3:	48 c1 e0 20          	shl    $0x20,%rax
+     ac7:	48 89 c2             	mov    %rax,%rdx
+     aca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     acd:	48 09 d0             	or     %rdx,%rax
+}
+     ad0:	5d                   	pop    %rbp
+     ad1:	c3                   	ret
+
+0000000000000ad2 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     ad2:	55                   	push   %rbp
+     ad3:	48 89 e5             	mov    %rsp,%rbp
+     ad6:	53                   	push   %rbx
+     ad7:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     ada:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     ade:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     ae2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     ae6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     aea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     aed:	0f a2                	cpuid
+     aef:	89 de                	mov    %ebx,%esi
+     af1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     af4:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     af7:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     afa:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     afd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     b02:	74 09                	je     b0d <cpuid+0x3b>
+    *eaxp = eax;
+     b04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     b08:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b0b:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     b0d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     b12:	74 09                	je     b1d <cpuid+0x4b>
+    *ebxp = ebx;
+     b14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     b18:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b1b:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     b1d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b22:	74 09                	je     b2d <cpuid+0x5b>
+    *ecxp = ecx;
+     b24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b28:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b2b:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     b2d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     b32:	74 09                	je     b3d <cpuid+0x6b>
+    *edxp = edx;
+     b34:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     b38:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     b3b:	89 10                	mov    %edx,(%rax)
+}
+     b3d:	90                   	nop
+     b3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b42:	c9                   	leave
+     b43:	c3                   	ret
+
+0000000000000b44 <strcpy>:
+char *strcpy(char *s, char *t) {
+     b44:	55                   	push   %rbp
+     b45:	48 89 e5             	mov    %rsp,%rbp
+     b48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b4c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     b58:	90                   	nop
+     b59:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b5d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     b61:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b69:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     b6d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     b71:	0f b6 12             	movzbl (%rdx),%edx
+     b74:	88 10                	mov    %dl,(%rax)
+     b76:	0f b6 00             	movzbl (%rax),%eax
+     b79:	84 c0                	test   %al,%al
+     b7b:	75 dc                	jne    b59 <strcpy+0x15>
+  return os;
+     b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b81:	5d                   	pop    %rbp
+     b82:	c3                   	ret
+
+0000000000000b83 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     b83:	55                   	push   %rbp
+     b84:	48 89 e5             	mov    %rsp,%rbp
+     b87:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b8b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     b8f:	eb 0a                	jmp    b9b <strcmp+0x18>
+    p++, q++;
+     b91:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     b96:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     b9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b9f:	0f b6 00             	movzbl (%rax),%eax
+     ba2:	84 c0                	test   %al,%al
+     ba4:	74 12                	je     bb8 <strcmp+0x35>
+     ba6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     baa:	0f b6 10             	movzbl (%rax),%edx
+     bad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bb1:	0f b6 00             	movzbl (%rax),%eax
+     bb4:	38 c2                	cmp    %al,%dl
+     bb6:	74 d9                	je     b91 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bbc:	0f b6 00             	movzbl (%rax),%eax
+     bbf:	0f b6 d0             	movzbl %al,%edx
+     bc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bc6:	0f b6 00             	movzbl (%rax),%eax
+     bc9:	0f b6 c0             	movzbl %al,%eax
+     bcc:	29 c2                	sub    %eax,%edx
+     bce:	89 d0                	mov    %edx,%eax
+}
+     bd0:	5d                   	pop    %rbp
+     bd1:	c3                   	ret
+
+0000000000000bd2 <strlen>:
+uint strlen(char *s) {
+     bd2:	55                   	push   %rbp
+     bd3:	48 89 e5             	mov    %rsp,%rbp
+     bd6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     bda:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     be1:	eb 04                	jmp    be7 <strlen+0x15>
+     be3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     be7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bea:	48 63 d0             	movslq %eax,%rdx
+     bed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bf1:	48 01 d0             	add    %rdx,%rax
+     bf4:	0f b6 00             	movzbl (%rax),%eax
+     bf7:	84 c0                	test   %al,%al
+     bf9:	75 e8                	jne    be3 <strlen+0x11>
+    ;
+  return n;
+     bfb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     bfe:	5d                   	pop    %rbp
+     bff:	c3                   	ret
+
+0000000000000c00 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     c00:	55                   	push   %rbp
+     c01:	48 89 e5             	mov    %rsp,%rbp
+     c04:	53                   	push   %rbx
+     c05:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     c09:	8b 05 25 24 00 00    	mov    0x2425(%rip),%eax        # 3034 <erms>
+     c0f:	85 c0                	test   %eax,%eax
+     c11:	79 53                	jns    c66 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     c13:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     c17:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     c1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c22:	ba 00 00 00 00       	mov    $0x0,%edx
+     c27:	48 89 c6             	mov    %rax,%rsi
+     c2a:	bf 00 00 00 00       	mov    $0x0,%edi
+     c2f:	e8 9e fe ff ff       	call   ad2 <cpuid>
+    ebx = 0;
+     c34:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     c3b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c3e:	83 f8 06             	cmp    $0x6,%eax
+     c41:	76 14                	jbe    c57 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     c43:	b8 07 00 00 00       	mov    $0x7,%eax
+     c48:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c4d:	0f a2                	cpuid
+     c4f:	89 d9                	mov    %ebx,%ecx
+     c51:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     c54:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     c57:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c5a:	c1 e8 09             	shr    $0x9,%eax
+     c5d:	83 e0 01             	and    $0x1,%eax
+     c60:	89 05 ce 23 00 00    	mov    %eax,0x23ce(%rip)        # 3034 <erms>
+  }
+  return erms;
+     c66:	8b 05 c8 23 00 00    	mov    0x23c8(%rip),%eax        # 3034 <erms>
+}
+     c6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c70:	c9                   	leave
+     c71:	c3                   	ret
+
+0000000000000c72 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     c72:	55                   	push   %rbp
+     c73:	48 89 e5             	mov    %rsp,%rbp
+     c76:	48 83 ec 10          	sub    $0x10,%rsp
+     c7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c7e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c81:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     c84:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     c88:	76 09                	jbe    c93 <memset+0x21>
+     c8a:	e8 71 ff ff ff       	call   c00 <haserms>
+     c8f:	85 c0                	test   %eax,%eax
+     c91:	74 16                	je     ca9 <memset+0x37>
+    stosb(dst, c, n);
+     c93:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c96:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     c99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c9d:	89 ce                	mov    %ecx,%esi
+     c9f:	48 89 c7             	mov    %rax,%rdi
+     ca2:	e8 26 fd ff ff       	call   9cd <stosb>
+     ca7:	eb 58                	jmp    d01 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     ca9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cac:	c1 e8 03             	shr    $0x3,%eax
+     caf:	89 c6                	mov    %eax,%esi
+     cb1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cb4:	48 98                	cltq
+     cb6:	0f b6 c0             	movzbl %al,%eax
+     cb9:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     cc0:	01 01 01 
+     cc3:	48 0f af c2          	imul   %rdx,%rax
+     cc7:	48 89 c1             	mov    %rax,%rcx
+     cca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cce:	48 89 f2             	mov    %rsi,%rdx
+     cd1:	48 89 ce             	mov    %rcx,%rsi
+     cd4:	48 89 c7             	mov    %rax,%rdi
+     cd7:	e8 23 fd ff ff       	call   9ff <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     cdc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cdf:	83 e0 07             	and    $0x7,%eax
+     ce2:	89 c2                	mov    %eax,%edx
+     ce4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     ce7:	83 e0 f8             	and    $0xfffffff8,%eax
+     cea:	48 89 c1             	mov    %rax,%rcx
+     ced:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cf1:	48 01 c1             	add    %rax,%rcx
+     cf4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cf7:	89 c6                	mov    %eax,%esi
+     cf9:	48 89 cf             	mov    %rcx,%rdi
+     cfc:	e8 cc fc ff ff       	call   9cd <stosb>
+  }
+  return dst;
+     d01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     d05:	c9                   	leave
+     d06:	c3                   	ret
+
+0000000000000d07 <strchr>:
+
+char *strchr(const char *s, char c) {
+     d07:	55                   	push   %rbp
+     d08:	48 89 e5             	mov    %rsp,%rbp
+     d0b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d0f:	89 f0                	mov    %esi,%eax
+     d11:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     d14:	eb 17                	jmp    d2d <strchr+0x26>
+    if (*s == c)
+     d16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d1a:	0f b6 00             	movzbl (%rax),%eax
+     d1d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     d20:	75 06                	jne    d28 <strchr+0x21>
+      return (char *)s;
+     d22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d26:	eb 15                	jmp    d3d <strchr+0x36>
+  for (; *s; s++)
+     d28:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d31:	0f b6 00             	movzbl (%rax),%eax
+     d34:	84 c0                	test   %al,%al
+     d36:	75 de                	jne    d16 <strchr+0xf>
+  return 0;
+     d38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d3d:	5d                   	pop    %rbp
+     d3e:	c3                   	ret
+
+0000000000000d3f <gets>:
+
+char *gets(char *buf, int max) {
+     d3f:	55                   	push   %rbp
+     d40:	48 89 e5             	mov    %rsp,%rbp
+     d43:	48 83 ec 20          	sub    $0x20,%rsp
+     d47:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d4b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     d4e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d55:	eb 48                	jmp    d9f <gets+0x60>
+    cc = read(0, &c, 1);
+     d57:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d5b:	ba 01 00 00 00       	mov    $0x1,%edx
+     d60:	48 89 c6             	mov    %rax,%rsi
+     d63:	bf 00 00 00 00       	mov    $0x0,%edi
+     d68:	e8 b8 05 00 00       	call   1325 <read>
+     d6d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     d70:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d74:	7e 36                	jle    dac <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d79:	8d 50 01             	lea    0x1(%rax),%edx
+     d7c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d7f:	48 63 d0             	movslq %eax,%rdx
+     d82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d86:	48 01 c2             	add    %rax,%rdx
+     d89:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d8d:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     d8f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d93:	3c 0a                	cmp    $0xa,%al
+     d95:	74 16                	je     dad <gets+0x6e>
+     d97:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d9b:	3c 0d                	cmp    $0xd,%al
+     d9d:	74 0e                	je     dad <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     d9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     da2:	83 c0 01             	add    $0x1,%eax
+     da5:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     da8:	7f ad                	jg     d57 <gets+0x18>
+     daa:	eb 01                	jmp    dad <gets+0x6e>
+      break;
+     dac:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     dad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     db0:	48 63 d0             	movslq %eax,%rdx
+     db3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     db7:	48 01 d0             	add    %rdx,%rax
+     dba:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     dbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     dc1:	c9                   	leave
+     dc2:	c3                   	ret
+
+0000000000000dc3 <stat>:
+
+int stat(char *n, struct stat *st) {
+     dc3:	55                   	push   %rbp
+     dc4:	48 89 e5             	mov    %rsp,%rbp
+     dc7:	48 83 ec 10          	sub    $0x10,%rsp
+     dcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dcf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     dd3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ddb:	48 89 c6             	mov    %rax,%rsi
+     dde:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     de3:	e8 58 07 00 00       	call   1540 <fstatat>
+}
+     de8:	c9                   	leave
+     de9:	c3                   	ret
+
+0000000000000dea <atoi>:
+
+int atoi(const char *s) {
+     dea:	55                   	push   %rbp
+     deb:	48 89 e5             	mov    %rsp,%rbp
+     dee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     df2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     df9:	eb 28                	jmp    e23 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     dfb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     dfe:	89 d0                	mov    %edx,%eax
+     e00:	c1 e0 02             	shl    $0x2,%eax
+     e03:	01 d0                	add    %edx,%eax
+     e05:	01 c0                	add    %eax,%eax
+     e07:	89 c1                	mov    %eax,%ecx
+     e09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e0d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     e11:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     e15:	0f b6 00             	movzbl (%rax),%eax
+     e18:	0f be c0             	movsbl %al,%eax
+     e1b:	01 c8                	add    %ecx,%eax
+     e1d:	83 e8 30             	sub    $0x30,%eax
+     e20:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e27:	0f b6 00             	movzbl (%rax),%eax
+     e2a:	3c 2f                	cmp    $0x2f,%al
+     e2c:	7e 0b                	jle    e39 <atoi+0x4f>
+     e2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e32:	0f b6 00             	movzbl (%rax),%eax
+     e35:	3c 39                	cmp    $0x39,%al
+     e37:	7e c2                	jle    dfb <atoi+0x11>
+  return n;
+     e39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e3c:	5d                   	pop    %rbp
+     e3d:	c3                   	ret
+
+0000000000000e3e <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     e3e:	55                   	push   %rbp
+     e3f:	48 89 e5             	mov    %rsp,%rbp
+     e42:	48 83 ec 28          	sub    $0x28,%rsp
+     e46:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e4a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e4e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     e51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e55:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     e61:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e65:	7f 09                	jg     e70 <memmove+0x32>
+    return vdst;
+     e67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e6b:	e9 29 01 00 00       	jmp    f99 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     e70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e74:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     e78:	0f 83 87 00 00 00    	jae    f05 <memmove+0xc7>
+     e7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e81:	48 63 d0             	movslq %eax,%rdx
+     e84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e88:	48 01 d0             	add    %rdx,%rax
+     e8b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e8f:	73 74                	jae    f05 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     e91:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e94:	48 98                	cltq
+     e96:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     e9a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e9d:	48 98                	cltq
+     e9f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     ea3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ea7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eab:	48 09 d0             	or     %rdx,%rax
+     eae:	83 e0 07             	and    $0x7,%eax
+     eb1:	48 85 c0             	test   %rax,%rax
+     eb4:	75 3d                	jne    ef3 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     eb6:	eb 1c                	jmp    ed4 <memmove+0x96>
+        src -= 8;
+     eb8:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     ebd:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     ec2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ec6:	48 8b 10             	mov    (%rax),%rdx
+     ec9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ecd:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     ed0:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     ed4:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     ed8:	7f de                	jg     eb8 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     eda:	eb 17                	jmp    ef3 <memmove+0xb5>
+      *--dst = *--src;
+     edc:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     ee1:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     ee6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     eea:	0f b6 10             	movzbl (%rax),%edx
+     eed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef1:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     ef3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ef6:	8d 50 ff             	lea    -0x1(%rax),%edx
+     ef9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     efc:	85 c0                	test   %eax,%eax
+     efe:	7f dc                	jg     edc <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     f00:	e9 90 00 00 00       	jmp    f95 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     f05:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     f09:	7e 09                	jle    f14 <memmove+0xd6>
+     f0b:	e8 f0 fc ff ff       	call   c00 <haserms>
+     f10:	85 c0                	test   %eax,%eax
+     f12:	74 1b                	je     f2f <memmove+0xf1>
+    movsb(dst, src, n);
+     f14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f17:	48 63 d0             	movslq %eax,%rdx
+     f1a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f22:	48 89 ce             	mov    %rcx,%rsi
+     f25:	48 89 c7             	mov    %rax,%rdi
+     f28:	e8 0c fb ff ff       	call   a39 <movsb>
+     f2d:	eb 66                	jmp    f95 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     f2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f32:	8d 50 07             	lea    0x7(%rax),%edx
+     f35:	85 c0                	test   %eax,%eax
+     f37:	0f 48 c2             	cmovs  %edx,%eax
+     f3a:	c1 f8 03             	sar    $0x3,%eax
+     f3d:	48 63 d0             	movslq %eax,%rdx
+     f40:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f48:	48 89 ce             	mov    %rcx,%rsi
+     f4b:	48 89 c7             	mov    %rax,%rdi
+     f4e:	e8 23 fb ff ff       	call   a76 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     f53:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f56:	89 d0                	mov    %edx,%eax
+     f58:	c1 f8 1f             	sar    $0x1f,%eax
+     f5b:	c1 e8 1d             	shr    $0x1d,%eax
+     f5e:	01 c2                	add    %eax,%edx
+     f60:	83 e2 07             	and    $0x7,%edx
+     f63:	29 c2                	sub    %eax,%edx
+     f65:	89 d0                	mov    %edx,%eax
+     f67:	48 98                	cltq
+     f69:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f6c:	83 e2 f8             	and    $0xfffffff8,%edx
+     f6f:	48 63 ca             	movslq %edx,%rcx
+     f72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f76:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     f7a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f7d:	83 e2 f8             	and    $0xfffffff8,%edx
+     f80:	48 63 ca             	movslq %edx,%rcx
+     f83:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     f87:	48 01 d1             	add    %rdx,%rcx
+     f8a:	48 89 c2             	mov    %rax,%rdx
+     f8d:	48 89 cf             	mov    %rcx,%rdi
+     f90:	e8 a4 fa ff ff       	call   a39 <movsb>
+  }
+  return vdst;
+     f95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     f99:	c9                   	leave
+     f9a:	c3                   	ret
+
+0000000000000f9b <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+     f9b:	55                   	push   %rbp
+     f9c:	48 89 e5             	mov    %rsp,%rbp
+     f9f:	48 83 ec 20          	sub    $0x20,%rsp
+     fa3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     fa6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+     faa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+     fb1:	00 00 00 
+     fb4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+     fb8:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     fbc:	75 0d                	jne    fcb <clock_gettime+0x30>
+     fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fc2:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fc6:	48 85 c0             	test   %rax,%rax
+     fc9:	75 13                	jne    fde <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+     fcb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     fcf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fd2:	48 89 d6             	mov    %rdx,%rsi
+     fd5:	89 c7                	mov    %eax,%edi
+     fd7:	e8 e0 04 00 00       	call   14bc <_clock_gettime>
+     fdc:	eb 7d                	jmp    105b <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+     fde:	e8 d1 fa ff ff       	call   ab4 <rdtsc>
+     fe3:	48 89 c2             	mov    %rax,%rdx
+     fe6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fea:	48 89 d6             	mov    %rdx,%rsi
+     fed:	48 89 c7             	mov    %rax,%rdi
+     ff0:	e8 7b f9 ff ff       	call   970 <clockns>
+     ff5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+     ff9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ffd:	48 c1 e8 09          	shr    $0x9,%rax
+    1001:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1008:	b8 44 00 
+    100b:	48 f7 e2             	mul    %rdx
+    100e:	48 89 d0             	mov    %rdx,%rax
+    1011:	48 c1 e8 0b          	shr    $0xb,%rax
+    1015:	48 89 c2             	mov    %rax,%rdx
+    1018:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    101c:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    101f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1023:	48 89 c8             	mov    %rcx,%rax
+    1026:	48 c1 e8 09          	shr    $0x9,%rax
+    102a:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1031:	b8 44 00 
+    1034:	48 f7 e2             	mul    %rdx
+    1037:	48 89 d0             	mov    %rdx,%rax
+    103a:	48 c1 e8 0b          	shr    $0xb,%rax
+    103e:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1045:	48 89 c8             	mov    %rcx,%rax
+    1048:	48 29 d0             	sub    %rdx,%rax
+    104b:	48 89 c2             	mov    %rax,%rdx
+    104e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1052:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1056:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    105b:	c9                   	leave
+    105c:	c3                   	ret
+
+000000000000105d <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    105d:	55                   	push   %rbp
+    105e:	48 89 e5             	mov    %rsp,%rbp
+    1061:	48 83 ec 10          	sub    $0x10,%rsp
+    1065:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1069:	eb 11                	jmp    107c <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    106b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    106f:	be 02 00 00 00       	mov    $0x2,%esi
+    1074:	48 89 c7             	mov    %rax,%rdi
+    1077:	e8 6c 04 00 00       	call   14e8 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    107c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1080:	b8 02 00 00 00       	mov    $0x2,%eax
+    1085:	87 02                	xchg   %eax,(%rdx)
+    1087:	85 c0                	test   %eax,%eax
+    1089:	75 e0                	jne    106b <mutex_wait+0xe>
+}
+    108b:	90                   	nop
+    108c:	90                   	nop
+    108d:	c9                   	leave
+    108e:	c3                   	ret
+
+000000000000108f <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    108f:	55                   	push   %rbp
+    1090:	48 89 e5             	mov    %rsp,%rbp
+    1093:	48 83 ec 20          	sub    $0x20,%rsp
+    1097:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    109b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    10a2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    10a6:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    10aa:	8b 02                	mov    (%rdx),%eax
+    10ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10b1:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    10b5:	89 c1                	mov    %eax,%ecx
+    10b7:	0f 94 c0             	sete   %al
+    10ba:	84 c0                	test   %al,%al
+    10bc:	75 02                	jne    10c0 <mutex_lock+0x31>
+    10be:	89 0a                	mov    %ecx,(%rdx)
+    10c0:	83 f0 01             	xor    $0x1,%eax
+    10c3:	84 c0                	test   %al,%al
+    10c5:	74 0c                	je     10d3 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    10c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10cb:	48 89 c7             	mov    %rax,%rdi
+    10ce:	e8 8a ff ff ff       	call   105d <mutex_wait>
+}
+    10d3:	90                   	nop
+    10d4:	c9                   	leave
+    10d5:	c3                   	ret
+
+00000000000010d6 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    10d6:	55                   	push   %rbp
+    10d7:	48 89 e5             	mov    %rsp,%rbp
+    10da:	48 83 ec 10          	sub    $0x10,%rsp
+    10de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    10e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10e6:	ba 00 00 00 00       	mov    $0x0,%edx
+    10eb:	87 10                	xchg   %edx,(%rax)
+    10ed:	83 fa 02             	cmp    $0x2,%edx
+    10f0:	75 11                	jne    1103 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    10f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10f6:	be 01 00 00 00       	mov    $0x1,%esi
+    10fb:	48 89 c7             	mov    %rax,%rdi
+    10fe:	e8 f0 03 00 00       	call   14f3 <futex_wake>
+}
+    1103:	90                   	nop
+    1104:	c9                   	leave
+    1105:	c3                   	ret
+
+0000000000001106 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1106:	55                   	push   %rbp
+    1107:	48 89 e5             	mov    %rsp,%rbp
+    110a:	48 83 ec 20          	sub    $0x20,%rsp
+    110e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1112:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    111a:	48 83 c0 04          	add    $0x4,%rax
+    111e:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1122:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1126:	8b 00                	mov    (%rax),%eax
+    1128:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    112b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    112f:	48 89 c7             	mov    %rax,%rdi
+    1132:	e8 9f ff ff ff       	call   10d6 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1137:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    113b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    113e:	89 d6                	mov    %edx,%esi
+    1140:	48 89 c7             	mov    %rax,%rdi
+    1143:	e8 a0 03 00 00       	call   14e8 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1148:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    114c:	48 83 c0 04          	add    $0x4,%rax
+    1150:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1154:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1158:	48 89 c7             	mov    %rax,%rdi
+    115b:	e8 fd fe ff ff       	call   105d <mutex_wait>
+}
+    1160:	90                   	nop
+    1161:	c9                   	leave
+    1162:	c3                   	ret
+
+0000000000001163 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1163:	55                   	push   %rbp
+    1164:	48 89 e5             	mov    %rsp,%rbp
+    1167:	48 83 ec 10          	sub    $0x10,%rsp
+    116b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    116f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1173:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1177:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    117b:	48 83 c0 04          	add    $0x4,%rax
+    117f:	8b 00                	mov    (%rax),%eax
+    1181:	85 c0                	test   %eax,%eax
+    1183:	7e 11                	jle    1196 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1185:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1189:	be 01 00 00 00       	mov    $0x1,%esi
+    118e:	48 89 c7             	mov    %rax,%rdi
+    1191:	e8 5d 03 00 00       	call   14f3 <futex_wake>
+}
+    1196:	90                   	nop
+    1197:	c9                   	leave
+    1198:	c3                   	ret
+
+0000000000001199 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1199:	55                   	push   %rbp
+    119a:	48 89 e5             	mov    %rsp,%rbp
+    119d:	48 83 ec 10          	sub    $0x10,%rsp
+    11a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    11a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a9:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    11ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b1:	48 83 c0 04          	add    $0x4,%rax
+    11b5:	8b 00                	mov    (%rax),%eax
+    11b7:	85 c0                	test   %eax,%eax
+    11b9:	7e 11                	jle    11cc <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    11bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11bf:	be 00 00 00 40       	mov    $0x40000000,%esi
+    11c4:	48 89 c7             	mov    %rax,%rdi
+    11c7:	e8 27 03 00 00       	call   14f3 <futex_wake>
+}
+    11cc:	90                   	nop
+    11cd:	c9                   	leave
+    11ce:	c3                   	ret
+
+00000000000011cf <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    11cf:	55                   	push   %rbp
+    11d0:	48 89 e5             	mov    %rsp,%rbp
+    11d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11d7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    11da:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    11de:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    11e2:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    11e6:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    11ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11ee:	8b 40 04             	mov    0x4(%rax),%eax
+    11f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    11f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11f8:	8b 00                	mov    (%rax),%eax
+    11fa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    11fd:	29 c2                	sub    %eax,%edx
+    11ff:	83 fa 1f             	cmp    $0x1f,%edx
+    1202:	76 07                	jbe    120b <ring_push+0x3c>
+    return -1;
+    1204:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1209:	eb 7e                	jmp    1289 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    120b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    120e:	83 e0 1f             	and    $0x1f,%eax
+    1211:	89 c2                	mov    %eax,%edx
+    1213:	48 89 d0             	mov    %rdx,%rax
+    1216:	48 01 c0             	add    %rax,%rax
+    1219:	48 01 d0             	add    %rdx,%rax
+    121c:	48 c1 e0 04          	shl    $0x4,%rax
+    1220:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1224:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1228:	48 01 d0             	add    %rdx,%rax
+    122b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    122f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1233:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1236:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1238:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    123c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1240:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1244:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1248:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    124c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1254:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1258:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    125c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1260:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1264:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1268:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    126c:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1270:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1274:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1277:	8d 50 01             	lea    0x1(%rax),%edx
+    127a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    127e:	48 83 c0 04          	add    $0x4,%rax
+    1282:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1284:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1289:	5d                   	pop    %rbp
+    128a:	c3                   	ret
+
+000000000000128b <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    128b:	55                   	push   %rbp
+    128c:	48 89 e5             	mov    %rsp,%rbp
+    128f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1293:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    129b:	8b 40 08             	mov    0x8(%rax),%eax
+    129e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    12a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12a5:	48 83 c0 0c          	add    $0xc,%rax
+    12a9:	8b 00                	mov    (%rax),%eax
+    12ab:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    12ae:	75 07                	jne    12b7 <ring_pop+0x2c>
+    return -1;
+    12b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12b5:	eb 40                	jmp    12f7 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    12b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12ba:	83 e0 1f             	and    $0x1f,%eax
+    12bd:	89 c2                	mov    %eax,%edx
+    12bf:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    12c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12c7:	89 d2                	mov    %edx,%edx
+    12c9:	48 83 c2 61          	add    $0x61,%rdx
+    12cd:	48 c1 e2 04          	shl    $0x4,%rdx
+    12d1:	48 01 d0             	add    %rdx,%rax
+    12d4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    12d8:	48 8b 00             	mov    (%rax),%rax
+    12db:	48 89 01             	mov    %rax,(%rcx)
+    12de:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    12e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12e5:	8d 50 01             	lea    0x1(%rax),%edx
+    12e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ec:	48 83 c0 08          	add    $0x8,%rax
+    12f0:	89 10                	mov    %edx,(%rax)
+  return 0;
+    12f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12f7:	5d                   	pop    %rbp
+    12f8:	c3                   	ret
+
+00000000000012f9 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    12f9:	b8 01 00 00 00       	mov    $0x1,%eax
+    12fe:	49 89 ca             	mov    %rcx,%r10
+    1301:	0f 05                	syscall
+    1303:	c3                   	ret
+
+0000000000001304 <_exit>:
+SYSCALL_(exit)
+    1304:	b8 02 00 00 00       	mov    $0x2,%eax
+    1309:	49 89 ca             	mov    %rcx,%r10
+    130c:	0f 05                	syscall
+    130e:	c3                   	ret
+
+000000000000130f <wait>:
+SYSCALL(wait)
+    130f:	b8 03 00 00 00       	mov    $0x3,%eax
+    1314:	49 89 ca             	mov    %rcx,%r10
+    1317:	0f 05                	syscall
+    1319:	c3                   	ret
+
+000000000000131a <pipe>:
+SYSCALL(pipe)
+    131a:	b8 04 00 00 00       	mov    $0x4,%eax
+    131f:	49 89 ca             	mov    %rcx,%r10
+    1322:	0f 05                	syscall
+    1324:	c3                   	ret
+
+0000000000001325 <read>:
+SYSCALL(read)
+    1325:	b8 05 00 00 00       	mov    $0x5,%eax
+    132a:	49 89 ca             	mov    %rcx,%r10
+    132d:	0f 05                	syscall
+    132f:	c3                   	ret
+
+0000000000001330 <write>:
+SYSCALL(write)
+    1330:	b8 10 00 00 00       	mov    $0x10,%eax
+    1335:	49 89 ca             	mov    %rcx,%r10
+    1338:	0f 05                	syscall
+    133a:	c3                   	ret
+
+000000000000133b <_close>:
+SYSCALL_(close)
+    133b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1340:	49 89 ca             	mov    %rcx,%r10
+    1343:	0f 05                	syscall
+    1345:	c3                   	ret
+
+0000000000001346 <kill>:
+SYSCALL(kill)
+    1346:	b8 06 00 00 00       	mov    $0x6,%eax
+    134b:	49 89 ca             	mov    %rcx,%r10
+    134e:	0f 05                	syscall
+    1350:	c3                   	ret
+
+0000000000001351 <_exec>:
+SYSCALL_(exec)
+    1351:	b8 07 00 00 00       	mov    $0x7,%eax
+    1356:	49 89 ca             	mov    %rcx,%r10
+    1359:	0f 05                	syscall
+    135b:	c3                   	ret
+
+000000000000135c <open>:
+SYSCALL(open)
+    135c:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1361:	49 89 ca             	mov    %rcx,%r10
+    1364:	0f 05                	syscall
+    1366:	c3                   	ret
+
+0000000000001367 <mknod>:
+SYSCALL(mknod)
+    1367:	b8 11 00 00 00       	mov    $0x11,%eax
+    136c:	49 89 ca             	mov    %rcx,%r10
+    136f:	0f 05                	syscall
+    1371:	c3                   	ret
+
+0000000000001372 <unlink>:
+SYSCALL(unlink)
+    1372:	b8 12 00 00 00       	mov    $0x12,%eax
+    1377:	49 89 ca             	mov    %rcx,%r10
+    137a:	0f 05                	syscall
+    137c:	c3                   	ret
+
+000000000000137d <fstat>:
+SYSCALL(fstat)
+    137d:	b8 08 00 00 00       	mov    $0x8,%eax
+    1382:	49 89 ca             	mov    %rcx,%r10
+    1385:	0f 05                	syscall
+    1387:	c3                   	ret
+
+0000000000001388 <link>:
+SYSCALL(link)
+    1388:	b8 13 00 00 00       	mov    $0x13,%eax
+    138d:	49 89 ca             	mov    %rcx,%r10
+    1390:	0f 05                	syscall
+    1392:	c3                   	ret
+
+0000000000001393 <mkdir>:
+SYSCALL(mkdir)
+    1393:	b8 14 00 00 00       	mov    $0x14,%eax
+    1398:	49 89 ca             	mov    %rcx,%r10
+    139b:	0f 05                	syscall
+    139d:	c3                   	ret
+
+000000000000139e <chdir>:
+SYSCALL(chdir)
+    139e:	b8 09 00 00 00       	mov    $0x9,%eax
+    13a3:	49 89 ca             	mov    %rcx,%r10
+    13a6:	0f 05                	syscall
+    13a8:	c3                   	ret
+
+00000000000013a9 <dup>:
+SYSCALL(dup)
+    13a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13ae:	49 89 ca             	mov    %rcx,%r10
+    13b1:	0f 05                	syscall
+    13b3:	c3                   	ret
+
+00000000000013b4 <getpid>:
+SYSCALL(getpid)
+    13b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13b9:	49 89 ca             	mov    %rcx,%r10
+    13bc:	0f 05                	syscall
+    13be:	c3                   	ret
+
+00000000000013bf <sbrk>:
+SYSCALL(sbrk)
+    13bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13c4:	49 89 ca             	mov    %rcx,%r10
+    13c7:	0f 05                	syscall
+    13c9:	c3                   	ret
+
+00000000000013ca <sleep>:
+SYSCALL(sleep)
+    13ca:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13cf:	49 89 ca             	mov    %rcx,%r10
+    13d2:	0f 05                	syscall
+    13d4:	c3                   	ret
+
+00000000000013d5 <uptime>:
+SYSCALL(uptime)
+    13d5:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13da:	49 89 ca             	mov    %rcx,%r10
+    13dd:	0f 05                	syscall
+    13df:	c3                   	ret
+
+00000000000013e0 <sysinfo>:
+SYSCALL(sysinfo)
+    13e0:	b8 16 00 00 00       	mov    $0x16,%eax
+    13e5:	49 89 ca             	mov    %rcx,%r10
+    13e8:	0f 05                	syscall
+    13ea:	c3                   	ret
+
+00000000000013eb <crashn>:
+SYSCALL(crashn)
+    13eb:	b8 17 00 00 00       	mov    $0x17,%eax
+    13f0:	49 89 ca             	mov    %rcx,%r10
+    13f3:	0f 05                	syscall
+    13f5:	c3                   	ret
+
+00000000000013f6 <mmap>:
+SYSCALL(mmap)
+    13f6:	b8 18 00 00 00       	mov    $0x18,%eax
+    13fb:	49 89 ca             	mov    %rcx,%r10
+    13fe:	0f 05                	syscall
+    1400:	c3                   	ret
+
+0000000000001401 <munmap>:
+SYSCALL(munmap)
+    1401:	b8 19 00 00 00       	mov    $0x19,%eax
+    1406:	49 89 ca             	mov    %rcx,%r10
+    1409:	0f 05                	syscall
+    140b:	c3                   	ret
+
+000000000000140c <nice>:
+SYSCALL(nice)
+    140c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1411:	49 89 ca             	mov    %rcx,%r10
+    1414:	0f 05                	syscall
+    1416:	c3                   	ret
+
+0000000000001417 <_spawn>:
+SYSCALL_(spawn)
+    1417:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    141c:	49 89 ca             	mov    %rcx,%r10
+    141f:	0f 05                	syscall
+    1421:	c3                   	ret
+
+0000000000001422 <pread>:
+SYSCALL(pread)
+    1422:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1427:	49 89 ca             	mov    %rcx,%r10
+    142a:	0f 05                	syscall
+    142c:	c3                   	ret
+
+000000000000142d <pwrite>:
+SYSCALL(pwrite)
+    142d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1432:	49 89 ca             	mov    %rcx,%r10
+    1435:	0f 05                	syscall
+    1437:	c3                   	ret
+
+0000000000001438 <readv>:
+SYSCALL(readv)
+    1438:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    143d:	49 89 ca             	mov    %rcx,%r10
+    1440:	0f 05                	syscall
+    1442:	c3                   	ret
+
+0000000000001443 <writev>:
+SYSCALL(writev)
+    1443:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1448:	49 89 ca             	mov    %rcx,%r10
+    144b:	0f 05                	syscall
+    144d:	c3                   	ret
+
+000000000000144e <sendfile>:
+SYSCALL(sendfile)
+    144e:	b8 20 00 00 00       	mov    $0x20,%eax
+    1453:	49 89 ca             	mov    %rcx,%r10
+    1456:	0f 05                	syscall
+    1458:	c3                   	ret
+
+0000000000001459 <splice>:
+SYSCALL(splice)
+    1459:	b8 21 00 00 00       	mov    $0x21,%eax
+    145e:	49 89 ca             	mov    %rcx,%r10
+    1461:	0f 05                	syscall
+    1463:	c3                   	ret
+
+0000000000001464 <poll>:
+SYSCALL(poll)
+    1464:	b8 22 00 00 00       	mov    $0x22,%eax
+    1469:	49 89 ca             	mov    %rcx,%r10
+    146c:	0f 05                	syscall
+    146e:	c3                   	ret
+
+000000000000146f <fsync>:
+SYSCALL(fsync)
+    146f:	b8 23 00 00 00       	mov    $0x23,%eax
+    1474:	49 89 ca             	mov    %rcx,%r10
+    1477:	0f 05                	syscall
+    1479:	c3                   	ret
+
+000000000000147a <fdatasync>:
+SYSCALL(fdatasync)
+    147a:	b8 24 00 00 00       	mov    $0x24,%eax
+    147f:	49 89 ca             	mov    %rcx,%r10
+    1482:	0f 05                	syscall
+    1484:	c3                   	ret
+
+0000000000001485 <lockstat>:
+SYSCALL(lockstat)
+    1485:	b8 25 00 00 00       	mov    $0x25,%eax
+    148a:	49 89 ca             	mov    %rcx,%r10
+    148d:	0f 05                	syscall
+    148f:	c3                   	ret
+
+0000000000001490 <syscallstat>:
+SYSCALL(syscallstat)
+    1490:	b8 26 00 00 00       	mov    $0x26,%eax
+    1495:	49 89 ca             	mov    %rcx,%r10
+    1498:	0f 05                	syscall
+    149a:	c3                   	ret
+
+000000000000149b <trace>:
+SYSCALL(trace)
+    149b:	b8 27 00 00 00       	mov    $0x27,%eax
+    14a0:	49 89 ca             	mov    %rcx,%r10
+    14a3:	0f 05                	syscall
+    14a5:	c3                   	ret
+
+00000000000014a6 <profile>:
+SYSCALL(profile)
+    14a6:	b8 28 00 00 00       	mov    $0x28,%eax
+    14ab:	49 89 ca             	mov    %rcx,%r10
+    14ae:	0f 05                	syscall
+    14b0:	c3                   	ret
+
+00000000000014b1 <cycles>:
+SYSCALL(cycles)
+    14b1:	b8 29 00 00 00       	mov    $0x29,%eax
+    14b6:	49 89 ca             	mov    %rcx,%r10
+    14b9:	0f 05                	syscall
+    14bb:	c3                   	ret
+
+00000000000014bc <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    14bc:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14c1:	49 89 ca             	mov    %rcx,%r10
+    14c4:	0f 05                	syscall
+    14c6:	c3                   	ret
+
+00000000000014c7 <consmode>:
+SYSCALL(consmode)
+    14c7:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    14cc:	49 89 ca             	mov    %rcx,%r10
+    14cf:	0f 05                	syscall
+    14d1:	c3                   	ret
+
+00000000000014d2 <clone>:
+SYSCALL(clone)
+    14d2:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    14d7:	49 89 ca             	mov    %rcx,%r10
+    14da:	0f 05                	syscall
+    14dc:	c3                   	ret
+
+00000000000014dd <join>:
+SYSCALL(join)
+    14dd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    14e2:	49 89 ca             	mov    %rcx,%r10
+    14e5:	0f 05                	syscall
+    14e7:	c3                   	ret
+
+00000000000014e8 <futex_wait>:
+SYSCALL(futex_wait)
+    14e8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    14ed:	49 89 ca             	mov    %rcx,%r10
+    14f0:	0f 05                	syscall
+    14f2:	c3                   	ret
+
+00000000000014f3 <futex_wake>:
+SYSCALL(futex_wake)
+    14f3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    14f8:	49 89 ca             	mov    %rcx,%r10
+    14fb:	0f 05                	syscall
+    14fd:	c3                   	ret
+
+00000000000014fe <shmget>:
+SYSCALL(shmget)
+    14fe:	b8 30 00 00 00       	mov    $0x30,%eax
+    1503:	49 89 ca             	mov    %rcx,%r10
+    1506:	0f 05                	syscall
+    1508:	c3                   	ret
+
+0000000000001509 <shmat>:
+SYSCALL(shmat)
+    1509:	b8 31 00 00 00       	mov    $0x31,%eax
+    150e:	49 89 ca             	mov    %rcx,%r10
+    1511:	0f 05                	syscall
+    1513:	c3                   	ret
+
+0000000000001514 <shmdt>:
+SYSCALL(shmdt)
+    1514:	b8 32 00 00 00       	mov    $0x32,%eax
+    1519:	49 89 ca             	mov    %rcx,%r10
+    151c:	0f 05                	syscall
+    151e:	c3                   	ret
+
+000000000000151f <ring_setup>:
+SYSCALL(ring_setup)
+    151f:	b8 33 00 00 00       	mov    $0x33,%eax
+    1524:	49 89 ca             	mov    %rcx,%r10
+    1527:	0f 05                	syscall
+    1529:	c3                   	ret
+
+000000000000152a <ring_enter>:
+SYSCALL(ring_enter)
+    152a:	b8 34 00 00 00       	mov    $0x34,%eax
+    152f:	49 89 ca             	mov    %rcx,%r10
+    1532:	0f 05                	syscall
+    1534:	c3                   	ret
+
+0000000000001535 <getdents>:
+SYSCALL(getdents)
+    1535:	b8 35 00 00 00       	mov    $0x35,%eax
+    153a:	49 89 ca             	mov    %rcx,%r10
+    153d:	0f 05                	syscall
+    153f:	c3                   	ret
+
+0000000000001540 <fstatat>:
+SYSCALL(fstatat)
+    1540:	b8 36 00 00 00       	mov    $0x36,%eax
+    1545:	49 89 ca             	mov    %rcx,%r10
+    1548:	0f 05                	syscall
+    154a:	c3                   	ret
+
+000000000000154b <clone_file>:
+SYSCALL(clone_file)
+    154b:	b8 37 00 00 00       	mov    $0x37,%eax
+    1550:	49 89 ca             	mov    %rcx,%r10
+    1553:	0f 05                	syscall
+    1555:	c3                   	ret
+
+0000000000001556 <fpunch>:
+SYSCALL(fpunch)
+    1556:	b8 38 00 00 00       	mov    $0x38,%eax
+    155b:	49 89 ca             	mov    %rcx,%r10
+    155e:	0f 05                	syscall
+    1560:	c3                   	ret
+
+0000000000001561 <defrag>:
+SYSCALL(defrag)
+    1561:	b8 39 00 00 00       	mov    $0x39,%eax
+    1566:	49 89 ca             	mov    %rcx,%r10
+    1569:	0f 05                	syscall
+    156b:	c3                   	ret
+
+000000000000156c <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    156c:	55                   	push   %rbp
+    156d:	48 89 e5             	mov    %rsp,%rbp
+    1570:	48 83 ec 20          	sub    $0x20,%rsp
+    1574:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1578:	bf 00 00 00 00       	mov    $0x0,%edi
+    157d:	e8 3d fe ff ff       	call   13bf <sbrk>
+    1582:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1586:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    158a:	48 f7 d8             	neg    %rax
+    158d:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1592:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1596:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    159a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    159e:	48 01 c2             	add    %rax,%rdx
+    15a1:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    15a6:	48 39 c2             	cmp    %rax,%rdx
+    15a9:	73 1e                	jae    15c9 <morecore+0x5d>
+    15ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15af:	89 c2                	mov    %eax,%edx
+    15b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15b5:	01 d0                	add    %edx,%eax
+    15b7:	89 c7                	mov    %eax,%edi
+    15b9:	e8 01 fe ff ff       	call   13bf <sbrk>
+    15be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15c2:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15c7:	75 07                	jne    15d0 <morecore+0x64>
+    return 0;
+    15c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    15ce:	eb 27                	jmp    15f7 <morecore+0x8b>
+  stats.heap += n + pad;
+    15d0:	48 8b 05 99 1b 00 00 	mov    0x1b99(%rip),%rax        # 3170 <stats+0x50>
+    15d7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    15db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    15df:	48 01 ca             	add    %rcx,%rdx
+    15e2:	48 01 d0             	add    %rdx,%rax
+    15e5:	48 89 05 84 1b 00 00 	mov    %rax,0x1b84(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    15ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15f4:	48 01 d0             	add    %rdx,%rax
+}
+    15f7:	c9                   	leave
+    15f8:	c3                   	ret
+
+00000000000015f9 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    15f9:	55                   	push   %rbp
+    15fa:	48 89 e5             	mov    %rsp,%rbp
+    15fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1601:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1605:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    160c:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    160d:	48 8d 05 ec 1a 00 00 	lea    0x1aec(%rip),%rax        # 3100 <runs>
+    1614:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1618:	eb 1a                	jmp    1634 <pagefree+0x3b>
+    prev = *rp;
+    161a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    161e:	48 8b 00             	mov    (%rax),%rax
+    1621:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1625:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1629:	48 8b 00             	mov    (%rax),%rax
+    162c:	48 83 c0 08          	add    $0x8,%rax
+    1630:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1638:	48 8b 00             	mov    (%rax),%rax
+    163b:	48 85 c0             	test   %rax,%rax
+    163e:	74 0d                	je     164d <pagefree+0x54>
+    1640:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1644:	48 8b 00             	mov    (%rax),%rax
+    1647:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    164b:	72 cd                	jb     161a <pagefree+0x21>
+  r = (struct run *)p;
+    164d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1651:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1655:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1659:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    165d:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1664:	48 8b 10             	mov    (%rax),%rdx
+    1667:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    166b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    166f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1673:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1677:	48 85 c0             	test   %rax,%rax
+    167a:	74 48                	je     16c4 <pagefree+0xcb>
+    167c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1680:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1684:	48 01 c2             	add    %rax,%rdx
+    1687:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    168b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    168f:	48 39 c2             	cmp    %rax,%rdx
+    1692:	75 30                	jne    16c4 <pagefree+0xcb>
+    r->size += r->next->size;
+    1694:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1698:	48 8b 10             	mov    (%rax),%rdx
+    169b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    169f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16a3:	48 8b 00             	mov    (%rax),%rax
+    16a6:	48 01 c2             	add    %rax,%rdx
+    16a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ad:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    16b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16b4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16b8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    16c4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16c9:	74 46                	je     1711 <pagefree+0x118>
+    16cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16cf:	48 8b 10             	mov    (%rax),%rdx
+    16d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d6:	48 01 d0             	add    %rdx,%rax
+    16d9:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    16dd:	75 32                	jne    1711 <pagefree+0x118>
+    prev->size += r->size;
+    16df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e3:	48 8b 10             	mov    (%rax),%rdx
+    16e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ea:	48 8b 00             	mov    (%rax),%rax
+    16ed:	48 01 c2             	add    %rax,%rdx
+    16f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f4:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    16f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16fb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1703:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1707:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    170f:	eb 0c                	jmp    171d <pagefree+0x124>
+  } else {
+    *rp = r;
+    1711:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1715:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1719:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    171c:	90                   	nop
+    171d:	90                   	nop
+    171e:	5d                   	pop    %rbp
+    171f:	c3                   	ret
+
+0000000000001720 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1720:	55                   	push   %rbp
+    1721:	48 89 e5             	mov    %rsp,%rbp
+    1724:	48 83 ec 40          	sub    $0x40,%rsp
+    1728:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    172c:	48 8d 05 cd 19 00 00 	lea    0x19cd(%rip),%rax        # 3100 <runs>
+    1733:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1737:	eb 66                	jmp    179f <pagealloc+0x7f>
+    if (r->size == n) {
+    1739:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173d:	48 8b 00             	mov    (%rax),%rax
+    1740:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1744:	75 18                	jne    175e <pagealloc+0x3e>
+      *rp = r->next;
+    1746:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    174a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    174e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1752:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1755:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1759:	e9 ca 00 00 00       	jmp    1828 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    175e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1762:	48 8b 00             	mov    (%rax),%rax
+    1765:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1769:	73 28                	jae    1793 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    176b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176f:	48 8b 00             	mov    (%rax),%rax
+    1772:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1776:	48 89 c2             	mov    %rax,%rdx
+    1779:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    177d:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1780:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1784:	48 8b 10             	mov    (%rax),%rdx
+    1787:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    178b:	48 01 d0             	add    %rdx,%rax
+    178e:	e9 95 00 00 00       	jmp    1828 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1797:	48 83 c0 08          	add    $0x8,%rax
+    179b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    179f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17a3:	48 8b 00             	mov    (%rax),%rax
+    17a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17aa:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17af:	75 88                	jne    1739 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    17b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    17b5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    17b9:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    17c0:	00 
+    17c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17c9:	48 39 c2             	cmp    %rax,%rdx
+    17cc:	48 0f 43 c2          	cmovae %rdx,%rax
+    17d0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    17d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17d8:	48 89 c7             	mov    %rax,%rdi
+    17db:	e8 8c fd ff ff       	call   156c <morecore>
+    17e0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    17e4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    17e9:	75 07                	jne    17f2 <pagealloc+0xd2>
+    return 0;
+    17eb:	b8 00 00 00 00       	mov    $0x0,%eax
+    17f0:	eb 36                	jmp    1828 <pagealloc+0x108>
+  if (m > n)
+    17f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17f6:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    17fa:	73 1a                	jae    1816 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    17fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1800:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1804:	48 89 c2             	mov    %rax,%rdx
+    1807:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    180b:	48 89 d6             	mov    %rdx,%rsi
+    180e:	48 89 c7             	mov    %rax,%rdi
+    1811:	e8 e3 fd ff ff       	call   15f9 <pagefree>
+  return p + m - n;
+    1816:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    181a:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    181e:	48 89 c2             	mov    %rax,%rdx
+    1821:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1825:	48 01 d0             	add    %rdx,%rax
+}
+    1828:	c9                   	leave
+    1829:	c3                   	ret
+
+000000000000182a <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    182a:	55                   	push   %rbp
+    182b:	48 89 e5             	mov    %rsp,%rbp
+    182e:	48 83 ec 30          	sub    $0x30,%rsp
+    1832:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1835:	bf 00 10 00 00       	mov    $0x1000,%edi
+    183a:	e8 e1 fe ff ff       	call   1720 <pagealloc>
+    183f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1843:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1848:	75 0a                	jne    1854 <refill+0x2a>
+    return -1;
+    184a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    184f:	e9 da 00 00 00       	jmp    192e <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1854:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    185b:	00 
+    185c:	e9 ba 00 00 00       	jmp    191b <refill+0xf1>
+    b = (struct block *)(p + off);
+    1861:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1869:	48 01 d0             	add    %rdx,%rax
+    186c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1870:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1873:	ba 20 00 00 00       	mov    $0x20,%edx
+    1878:	89 c1                	mov    %eax,%ecx
+    187a:	48 d3 e2             	shl    %cl,%rdx
+    187d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1881:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1884:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1887:	48 63 d0             	movslq %eax,%rdx
+    188a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    188e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1892:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1895:	48 98                	cltq
+    1897:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    189e:	00 
+    189f:	48 8d 05 1a 18 00 00 	lea    0x181a(%rip),%rax        # 30c0 <freelist>
+    18a6:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    18aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ae:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    18b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18b5:	48 98                	cltq
+    18b7:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    18be:	00 
+    18bf:	48 8d 15 fa 17 00 00 	lea    0x17fa(%rip),%rdx        # 30c0 <freelist>
+    18c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ca:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    18ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18d1:	48 98                	cltq
+    18d3:	48 83 c0 08          	add    $0x8,%rax
+    18d7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18de:	00 
+    18df:	48 8d 05 3e 18 00 00 	lea    0x183e(%rip),%rax        # 3124 <stats+0x4>
+    18e6:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    18e9:	8d 48 01             	lea    0x1(%rax),%ecx
+    18ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18ef:	48 98                	cltq
+    18f1:	48 83 c0 08          	add    $0x8,%rax
+    18f5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18fc:	00 
+    18fd:	48 8d 05 20 18 00 00 	lea    0x1820(%rip),%rax        # 3124 <stats+0x4>
+    1904:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1907:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    190a:	ba 20 00 00 00       	mov    $0x20,%edx
+    190f:	89 c1                	mov    %eax,%ecx
+    1911:	48 d3 e2             	shl    %cl,%rdx
+    1914:	48 89 d0             	mov    %rdx,%rax
+    1917:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    191b:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1922:	00 
+    1923:	0f 86 38 ff ff ff    	jbe    1861 <refill+0x37>
+  }
+  return 0;
+    1929:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    192e:	c9                   	leave
+    192f:	c3                   	ret
+
+0000000000001930 <malloc>:
+
+void *malloc(uint nbytes) {
+    1930:	55                   	push   %rbp
+    1931:	48 89 e5             	mov    %rsp,%rbp
+    1934:	48 83 ec 30          	sub    $0x30,%rsp
+    1938:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    193b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    193e:	48 83 c0 10          	add    $0x10,%rax
+    1942:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1946:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    194d:	eb 04                	jmp    1953 <malloc+0x23>
+    194f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1953:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1957:	7f 16                	jg     196f <malloc+0x3f>
+    1959:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    195c:	ba 20 00 00 00       	mov    $0x20,%edx
+    1961:	89 c1                	mov    %eax,%ecx
+    1963:	48 d3 e2             	shl    %cl,%rdx
+    1966:	48 89 d0             	mov    %rdx,%rax
+    1969:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    196d:	72 e0                	jb     194f <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    196f:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1973:	75 7d                	jne    19f2 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1979:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    197f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1985:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1989:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    198d:	48 89 c7             	mov    %rax,%rdi
+    1990:	e8 8b fd ff ff       	call   1720 <pagealloc>
+    1995:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1999:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    199e:	75 0a                	jne    19aa <malloc+0x7a>
+      return 0;
+    19a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    19a5:	e9 2c 01 00 00       	jmp    1ad6 <malloc+0x1a6>
+    h->size = n;
+    19aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19b2:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    19b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19b9:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    19c0:	00 
+    stats.inuse[LARGE]++;
+    19c1:	8b 05 79 17 00 00    	mov    0x1779(%rip),%eax        # 3140 <stats+0x20>
+    19c7:	83 c0 01             	add    $0x1,%eax
+    19ca:	89 05 70 17 00 00    	mov    %eax,0x1770(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    19d0:	48 8b 15 91 17 00 00 	mov    0x1791(%rip),%rdx        # 3168 <stats+0x48>
+    19d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19db:	48 01 d0             	add    %rdx,%rax
+    19de:	48 89 05 83 17 00 00 	mov    %rax,0x1783(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    19e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19e9:	48 83 c0 10          	add    $0x10,%rax
+    19ed:	e9 e4 00 00 00       	jmp    1ad6 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    19f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19f5:	48 98                	cltq
+    19f7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    19fe:	00 
+    19ff:	48 8d 05 ba 16 00 00 	lea    0x16ba(%rip),%rax        # 30c0 <freelist>
+    1a06:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a0a:	48 85 c0             	test   %rax,%rax
+    1a0d:	75 18                	jne    1a27 <malloc+0xf7>
+    1a0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a12:	89 c7                	mov    %eax,%edi
+    1a14:	e8 11 fe ff ff       	call   182a <refill>
+    1a19:	85 c0                	test   %eax,%eax
+    1a1b:	79 0a                	jns    1a27 <malloc+0xf7>
+    return 0;
+    1a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a22:	e9 af 00 00 00       	jmp    1ad6 <malloc+0x1a6>
+  b = freelist[c];
+    1a27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a2a:	48 98                	cltq
+    1a2c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a33:	00 
+    1a34:	48 8d 05 85 16 00 00 	lea    0x1685(%rip),%rax        # 30c0 <freelist>
+    1a3b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a3f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1a43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a47:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1a4b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1a4e:	48 63 d2             	movslq %edx,%rdx
+    1a51:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1a58:	00 
+    1a59:	48 8d 15 60 16 00 00 	lea    0x1660(%rip),%rdx        # 30c0 <freelist>
+    1a60:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1a64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a67:	48 98                	cltq
+    1a69:	48 83 c0 08          	add    $0x8,%rax
+    1a6d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a74:	00 
+    1a75:	48 8d 05 a8 16 00 00 	lea    0x16a8(%rip),%rax        # 3124 <stats+0x4>
+    1a7c:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a7f:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1a82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a85:	48 98                	cltq
+    1a87:	48 83 c0 08          	add    $0x8,%rax
+    1a8b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a92:	00 
+    1a93:	48 8d 05 8a 16 00 00 	lea    0x168a(%rip),%rax        # 3124 <stats+0x4>
+    1a9a:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1a9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aa0:	48 98                	cltq
+    1aa2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1aa9:	00 
+    1aaa:	48 8d 05 6f 16 00 00 	lea    0x166f(%rip),%rax        # 3120 <stats>
+    1ab1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ab4:	8d 48 01             	lea    0x1(%rax),%ecx
+    1ab7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aba:	48 98                	cltq
+    1abc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ac3:	00 
+    1ac4:	48 8d 05 55 16 00 00 	lea    0x1655(%rip),%rax        # 3120 <stats>
+    1acb:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ad2:	48 83 c0 10          	add    $0x10,%rax
+}
+    1ad6:	c9                   	leave
+    1ad7:	c3                   	ret
+
+0000000000001ad8 <free>:
+
+void free(void *ap) {
+    1ad8:	55                   	push   %rbp
+    1ad9:	48 89 e5             	mov    %rsp,%rbp
+    1adc:	48 83 ec 18          	sub    $0x18,%rsp
+    1ae0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1ae4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1ae9:	0f 84 03 01 00 00    	je     1bf2 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1af3:	48 83 e8 10          	sub    $0x10,%rax
+    1af7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1afb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aff:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1b07:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1b0c:	75 42                	jne    1b50 <free+0x78>
+    stats.inuse[LARGE]--;
+    1b0e:	8b 05 2c 16 00 00    	mov    0x162c(%rip),%eax        # 3140 <stats+0x20>
+    1b14:	83 e8 01             	sub    $0x1,%eax
+    1b17:	89 05 23 16 00 00    	mov    %eax,0x1623(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1b1d:	48 8b 15 44 16 00 00 	mov    0x1644(%rip),%rdx        # 3168 <stats+0x48>
+    1b24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b28:	48 8b 00             	mov    (%rax),%rax
+    1b2b:	48 29 c2             	sub    %rax,%rdx
+    1b2e:	48 89 15 33 16 00 00 	mov    %rdx,0x1633(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1b35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b39:	48 8b 10             	mov    (%rax),%rdx
+    1b3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b40:	48 89 d6             	mov    %rdx,%rsi
+    1b43:	48 89 c7             	mov    %rax,%rdi
+    1b46:	e8 ae fa ff ff       	call   15f9 <pagefree>
+    return;
+    1b4b:	e9 a3 00 00 00       	jmp    1bf3 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1b50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b54:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b5b:	00 
+    1b5c:	48 8d 05 5d 15 00 00 	lea    0x155d(%rip),%rax        # 30c0 <freelist>
+    1b63:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b6b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1b6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b73:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b7a:	00 
+    1b7b:	48 8d 15 3e 15 00 00 	lea    0x153e(%rip),%rdx        # 30c0 <freelist>
+    1b82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b86:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1b8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b8e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b95:	00 
+    1b96:	48 8d 05 83 15 00 00 	lea    0x1583(%rip),%rax        # 3120 <stats>
+    1b9d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ba0:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1ba3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ba7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bae:	00 
+    1baf:	48 8d 05 6a 15 00 00 	lea    0x156a(%rip),%rax        # 3120 <stats>
+    1bb6:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1bb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bbd:	48 83 c0 08          	add    $0x8,%rax
+    1bc1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bc8:	00 
+    1bc9:	48 8d 05 54 15 00 00 	lea    0x1554(%rip),%rax        # 3124 <stats+0x4>
+    1bd0:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bd3:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bda:	48 83 c0 08          	add    $0x8,%rax
+    1bde:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1be5:	00 
+    1be6:	48 8d 05 37 15 00 00 	lea    0x1537(%rip),%rax        # 3124 <stats+0x4>
+    1bed:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1bf0:	eb 01                	jmp    1bf3 <free+0x11b>
+    return;
+    1bf2:	90                   	nop
+}
+    1bf3:	c9                   	leave
+    1bf4:	c3                   	ret
+
+0000000000001bf5 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1bf5:	55                   	push   %rbp
+    1bf6:	48 89 e5             	mov    %rsp,%rbp
+    1bf9:	48 83 ec 30          	sub    $0x30,%rsp
+    1bfd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1c00:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c03:	48 8d 15 8e 02 00 00 	lea    0x28e(%rip),%rdx        # 1e98 <benchreport+0x17b>
+    1c0a:	48 89 d6             	mov    %rdx,%rsi
+    1c0d:	89 c7                	mov    %eax,%edi
+    1c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c14:	e8 37 e6 ff ff       	call   250 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c19:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1c20:	eb 67                	jmp    1c89 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1c22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c25:	48 98                	cltq
+    1c27:	48 83 c0 08          	add    $0x8,%rax
+    1c2b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c32:	00 
+    1c33:	48 8d 05 ea 14 00 00 	lea    0x14ea(%rip),%rax        # 3124 <stats+0x4>
+    1c3a:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1c3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c40:	48 98                	cltq
+    1c42:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c49:	00 
+    1c4a:	48 8d 05 cf 14 00 00 	lea    0x14cf(%rip),%rax        # 3120 <stats>
+    1c51:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c57:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c5c:	89 c1                	mov    %eax,%ecx
+    1c5e:	48 d3 e2             	shl    %cl,%rdx
+    1c61:	48 89 d0             	mov    %rdx,%rax
+    1c64:	89 c1                	mov    %eax,%ecx
+    1c66:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c6c:	41 89 f9             	mov    %edi,%r9d
+    1c6f:	41 89 f0             	mov    %esi,%r8d
+    1c72:	48 8d 35 36 02 00 00 	lea    0x236(%rip),%rsi        # 1eaf <benchreport+0x192>
+    1c79:	89 c7                	mov    %eax,%edi
+    1c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c80:	e8 cb e5 ff ff       	call   250 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c85:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1c89:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1c8d:	7e 93                	jle    1c22 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1c8f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1c96:	00 
+  for (r = runs; r; r = r->next)
+    1c97:	48 8b 05 62 14 00 00 	mov    0x1462(%rip),%rax        # 3100 <runs>
+    1c9e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ca2:	eb 17                	jmp    1cbb <mallocstats+0xc6>
+    nfree += r->size;
+    1ca4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca8:	48 8b 00             	mov    (%rax),%rax
+    1cab:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1caf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cb3:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1cb7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cbb:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1cc0:	75 e2                	jne    1ca4 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1cc2:	48 8b 05 a7 14 00 00 	mov    0x14a7(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cc9:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ccf:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cd3:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cd5:	48 8b 05 8c 14 00 00 	mov    0x148c(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cdc:	89 c1                	mov    %eax,%ecx
+    1cde:	8b 15 5c 14 00 00    	mov    0x145c(%rip),%edx        # 3140 <stats+0x20>
+    1ce4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ce7:	41 89 f9             	mov    %edi,%r9d
+    1cea:	41 89 f0             	mov    %esi,%r8d
+    1ced:	48 8d 35 cc 01 00 00 	lea    0x1cc(%rip),%rsi        # 1ec0 <benchreport+0x1a3>
+    1cf4:	89 c7                	mov    %eax,%edi
+    1cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cfb:	e8 50 e5 ff ff       	call   250 <printf>
+}
+    1d00:	90                   	nop
+    1d01:	c9                   	leave
+    1d02:	c3                   	ret
+
+0000000000001d03 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1d03:	55                   	push   %rbp
+    1d04:	48 89 e5             	mov    %rsp,%rbp
+    1d07:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1d0b:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1d0f:	48 89 c7             	mov    %rax,%rdi
+    1d12:	e8 9a f7 ff ff       	call   14b1 <cycles>
+  return t;
+    1d17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d1b:	c9                   	leave
+    1d1c:	c3                   	ret
+
+0000000000001d1d <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1d1d:	55                   	push   %rbp
+    1d1e:	48 89 e5             	mov    %rsp,%rbp
+    1d21:	48 83 ec 30          	sub    $0x30,%rsp
+    1d25:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d29:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d2d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1d30:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1d34:	0f 8e 24 01 00 00    	jle    1e5e <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1d3a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1d41:	e9 98 00 00 00       	jmp    1dde <benchreport+0xc1>
+    x = t[i];
+    1d46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d49:	48 98                	cltq
+    1d4b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d52:	00 
+    1d53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d57:	48 01 d0             	add    %rdx,%rax
+    1d5a:	48 8b 00             	mov    (%rax),%rax
+    1d5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d64:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1d67:	eb 33                	jmp    1d9c <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1d69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d6c:	48 98                	cltq
+    1d6e:	48 c1 e0 03          	shl    $0x3,%rax
+    1d72:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d7a:	48 01 d0             	add    %rdx,%rax
+    1d7d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1d80:	48 63 d2             	movslq %edx,%rdx
+    1d83:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d8a:	00 
+    1d8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d8f:	48 01 ca             	add    %rcx,%rdx
+    1d92:	48 8b 00             	mov    (%rax),%rax
+    1d95:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d98:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1d9c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1da0:	7e 1d                	jle    1dbf <benchreport+0xa2>
+    1da2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1da5:	48 98                	cltq
+    1da7:	48 c1 e0 03          	shl    $0x3,%rax
+    1dab:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1daf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1db3:	48 01 d0             	add    %rdx,%rax
+    1db6:	48 8b 00             	mov    (%rax),%rax
+    1db9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1dbd:	72 aa                	jb     1d69 <benchreport+0x4c>
+    t[j] = x;
+    1dbf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1dc2:	48 98                	cltq
+    1dc4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1dcb:	00 
+    1dcc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dd0:	48 01 c2             	add    %rax,%rdx
+    1dd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dd7:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1dda:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1dde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1de1:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1de4:	0f 8c 5c ff ff ff    	jl     1d46 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1dea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ded:	48 98                	cltq
+    1def:	48 c1 e0 03          	shl    $0x3,%rax
+    1df3:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1df7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dfb:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1dfe:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1e01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e04:	89 c2                	mov    %eax,%edx
+    1e06:	c1 ea 1f             	shr    $0x1f,%edx
+    1e09:	01 d0                	add    %edx,%eax
+    1e0b:	d1 f8                	sar    %eax
+    1e0d:	48 98                	cltq
+    1e0f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e16:	00 
+    1e17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e1b:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e1e:	48 8b 38             	mov    (%rax),%rdi
+    1e21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e25:	48 8b 30             	mov    (%rax),%rsi
+    1e28:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1e2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e2f:	48 83 ec 08          	sub    $0x8,%rsp
+    1e33:	51                   	push   %rcx
+    1e34:	49 89 f9             	mov    %rdi,%r9
+    1e37:	49 89 f0             	mov    %rsi,%r8
+    1e3a:	89 d1                	mov    %edx,%ecx
+    1e3c:	48 89 c2             	mov    %rax,%rdx
+    1e3f:	48 8d 05 ba 00 00 00 	lea    0xba(%rip),%rax        # 1f00 <benchreport+0x1e3>
+    1e46:	48 89 c6             	mov    %rax,%rsi
+    1e49:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e53:	e8 f8 e3 ff ff       	call   250 <printf>
+    1e58:	48 83 c4 10          	add    $0x10,%rsp
+    1e5c:	eb 01                	jmp    1e5f <benchreport+0x142>
+    return;
+    1e5e:	90                   	nop
+}
+    1e5f:	c9                   	leave
+    1e60:	c3                   	ret
@@ -0,0 +1,3563 @@
+
+out/user/_lockstat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+static char *kinds[] = {[LS_SPIN] = "spin", [LS_SLEEP] = "sleep",
+                        [LS_RWSLEEP] = "rw"};
+
+struct lockstat st[NLOCKCLASS];
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 60          	sub    $0x60,%rsp
+       8:	89 7d ac             	mov    %edi,-0x54(%rbp)
+       b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  struct lockstat t;
+  int n, i, j, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+       f:	83 7d ac 01          	cmpl   $0x1,-0x54(%rbp)
+      13:	7e 28                	jle    3d <main+0x3d>
+      15:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+      19:	48 83 c0 08          	add    $0x8,%rax
+      1d:	48 8b 00             	mov    (%rax),%rax
+      20:	48 8d 15 f7 20 00 00 	lea    0x20f7(%rip),%rdx        # 211e <benchreport+0x154>
+      27:	48 89 d6             	mov    %rdx,%rsi
+      2a:	48 89 c7             	mov    %rax,%rdi
+      2d:	e8 fe 0d 00 00       	call   e30 <strcmp>
+      32:	85 c0                	test   %eax,%eax
+      34:	75 07                	jne    3d <main+0x3d>
+      36:	b8 01 00 00 00       	mov    $0x1,%eax
+      3b:	eb 05                	jmp    42 <main+0x42>
+      3d:	b8 00 00 00 00       	mov    $0x0,%eax
+      42:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if ((n = lockstat(st, NLOCKCLASS, reset)) < 0) {
+      45:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      48:	89 c2                	mov    %eax,%edx
+      4a:	be 40 00 00 00       	mov    $0x40,%esi
+      4f:	48 8d 05 0a 30 00 00 	lea    0x300a(%rip),%rax        # 3060 <st>
+      56:	48 89 c7             	mov    %rax,%rdi
+      59:	e8 d4 16 00 00       	call   1732 <lockstat>
+      5e:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      61:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+      65:	79 1e                	jns    85 <main+0x85>
+    printf(2, "lockstat: failed\n");
+      67:	48 8d 05 b3 20 00 00 	lea    0x20b3(%rip),%rax        # 2121 <benchreport+0x157>
+      6e:	48 89 c6             	mov    %rax,%rsi
+      71:	bf 02 00 00 00       	mov    $0x2,%edi
+      76:	b8 00 00 00 00       	mov    $0x0,%eax
+      7b:	e8 7d 04 00 00       	call   4fd <printf>
+    exit();
+      80:	e8 a8 0a 00 00       	call   b2d <exit>
+  }
+
+  for (i = 1; i < n; i++) {
+      85:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      8c:	e9 69 01 00 00       	jmp    1fa <main+0x1fa>
+    t = st[i];
+      91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      94:	48 98                	cltq
+      96:	48 c1 e0 06          	shl    $0x6,%rax
+      9a:	48 89 c2             	mov    %rax,%rdx
+      9d:	48 8d 05 bc 2f 00 00 	lea    0x2fbc(%rip),%rax        # 3060 <st>
+      a4:	48 8b 0c 02          	mov    (%rdx,%rax,1),%rcx
+      a8:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+      ac:	48 8b 4c 02 08       	mov    0x8(%rdx,%rax,1),%rcx
+      b1:	48 89 4d b8          	mov    %rcx,-0x48(%rbp)
+      b5:	48 8b 4c 02 10       	mov    0x10(%rdx,%rax,1),%rcx
+      ba:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+      be:	48 8b 4c 02 18       	mov    0x18(%rdx,%rax,1),%rcx
+      c3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+      c7:	48 8b 4c 02 20       	mov    0x20(%rdx,%rax,1),%rcx
+      cc:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+      d0:	48 8b 4c 02 28       	mov    0x28(%rdx,%rax,1),%rcx
+      d5:	48 89 4d d8          	mov    %rcx,-0x28(%rbp)
+      d9:	48 8b 4c 02 30       	mov    0x30(%rdx,%rax,1),%rcx
+      de:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+      e2:	48 8b 44 02 38       	mov    0x38(%rdx,%rax,1),%rax
+      e7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (j = i; j > 0 && st[j - 1].wait < t.wait; j--)
+      eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      ee:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      f1:	eb 7c                	jmp    16f <main+0x16f>
+      st[j] = st[j - 1];
+      f3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      f6:	8d 48 ff             	lea    -0x1(%rax),%ecx
+      f9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      fc:	48 98                	cltq
+      fe:	48 c1 e0 06          	shl    $0x6,%rax
+     102:	48 89 c2             	mov    %rax,%rdx
+     105:	48 8d 05 54 2f 00 00 	lea    0x2f54(%rip),%rax        # 3060 <st>
+     10c:	48 63 c9             	movslq %ecx,%rcx
+     10f:	48 89 ce             	mov    %rcx,%rsi
+     112:	48 c1 e6 06          	shl    $0x6,%rsi
+     116:	48 8d 0d 43 2f 00 00 	lea    0x2f43(%rip),%rcx        # 3060 <st>
+     11d:	48 8b 3c 0e          	mov    (%rsi,%rcx,1),%rdi
+     121:	48 89 3c 02          	mov    %rdi,(%rdx,%rax,1)
+     125:	48 8b 7c 0e 08       	mov    0x8(%rsi,%rcx,1),%rdi
+     12a:	48 89 7c 02 08       	mov    %rdi,0x8(%rdx,%rax,1)
+     12f:	48 8b 7c 0e 10       	mov    0x10(%rsi,%rcx,1),%rdi
+     134:	48 89 7c 02 10       	mov    %rdi,0x10(%rdx,%rax,1)
+     139:	48 8b 7c 0e 18       	mov    0x18(%rsi,%rcx,1),%rdi
+     13e:	48 89 7c 02 18       	mov    %rdi,0x18(%rdx,%rax,1)
+     143:	48 8b 7c 0e 20       	mov    0x20(%rsi,%rcx,1),%rdi
+     148:	48 89 7c 02 20       	mov    %rdi,0x20(%rdx,%rax,1)
+     14d:	48 8b 7c 0e 28       	mov    0x28(%rsi,%rcx,1),%rdi
+     152:	48 89 7c 02 28       	mov    %rdi,0x28(%rdx,%rax,1)
+     157:	48 8b 7c 0e 30       	mov    0x30(%rsi,%rcx,1),%rdi
+     15c:	48 89 7c 02 30       	mov    %rdi,0x30(%rdx,%rax,1)
+     161:	48 8b 4c 0e 38       	mov    0x38(%rsi,%rcx,1),%rcx
+     166:	48 89 4c 02 38       	mov    %rcx,0x38(%rdx,%rax,1)
+    for (j = i; j > 0 && st[j - 1].wait < t.wait; j--)
+     16b:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+     16f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     173:	7e 27                	jle    19c <main+0x19c>
+     175:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     178:	83 e8 01             	sub    $0x1,%eax
+     17b:	48 98                	cltq
+     17d:	48 c1 e0 06          	shl    $0x6,%rax
+     181:	48 89 c2             	mov    %rax,%rdx
+     184:	48 8d 05 fd 2e 00 00 	lea    0x2efd(%rip),%rax        # 3088 <st+0x28>
+     18b:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+     18f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     193:	48 39 c2             	cmp    %rax,%rdx
+     196:	0f 82 57 ff ff ff    	jb     f3 <main+0xf3>
+    st[j] = t;
+     19c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     19f:	48 98                	cltq
+     1a1:	48 c1 e0 06          	shl    $0x6,%rax
+     1a5:	48 89 c2             	mov    %rax,%rdx
+     1a8:	48 8d 05 b1 2e 00 00 	lea    0x2eb1(%rip),%rax        # 3060 <st>
+     1af:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+     1b3:	48 89 0c 02          	mov    %rcx,(%rdx,%rax,1)
+     1b7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+     1bb:	48 89 4c 02 08       	mov    %rcx,0x8(%rdx,%rax,1)
+     1c0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     1c4:	48 89 4c 02 10       	mov    %rcx,0x10(%rdx,%rax,1)
+     1c9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     1cd:	48 89 4c 02 18       	mov    %rcx,0x18(%rdx,%rax,1)
+     1d2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     1d6:	48 89 4c 02 20       	mov    %rcx,0x20(%rdx,%rax,1)
+     1db:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     1df:	48 89 4c 02 28       	mov    %rcx,0x28(%rdx,%rax,1)
+     1e4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     1e8:	48 89 4c 02 30       	mov    %rcx,0x30(%rdx,%rax,1)
+     1ed:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     1f1:	48 89 4c 02 38       	mov    %rcx,0x38(%rdx,%rax,1)
+  for (i = 1; i < n; i++) {
+     1f6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1fd:	3b 45 f0             	cmp    -0x10(%rbp),%eax
+     200:	0f 8c 8b fe ff ff    	jl     91 <main+0x91>
+  }
+
+  printf(1, "name kind acquires contended wait hold maxhold (cycles)\n");
+     206:	48 8d 05 2b 1f 00 00 	lea    0x1f2b(%rip),%rax        # 2138 <benchreport+0x16e>
+     20d:	48 89 c6             	mov    %rax,%rsi
+     210:	bf 01 00 00 00       	mov    $0x1,%edi
+     215:	b8 00 00 00 00       	mov    $0x0,%eax
+     21a:	e8 de 02 00 00       	call   4fd <printf>
+  for (i = 0; i < n; i++) {
+     21f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     226:	e9 03 01 00 00       	jmp    32e <main+0x32e>
+    if (st[i].acquires == 0)
+     22b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     22e:	48 98                	cltq
+     230:	48 c1 e0 06          	shl    $0x6,%rax
+     234:	48 89 c2             	mov    %rax,%rdx
+     237:	48 8d 05 3a 2e 00 00 	lea    0x2e3a(%rip),%rax        # 3078 <st+0x18>
+     23e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     242:	48 85 c0             	test   %rax,%rax
+     245:	0f 84 de 00 00 00    	je     329 <main+0x329>
+      continue;
+    printf(1, "%s %s %ld %ld %ld %ld %ld\n", st[i].name, kinds[st[i].kind],
+     24b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     24e:	48 98                	cltq
+     250:	48 c1 e0 06          	shl    $0x6,%rax
+     254:	48 89 c2             	mov    %rax,%rdx
+     257:	48 8d 05 3a 2e 00 00 	lea    0x2e3a(%rip),%rax        # 3098 <st+0x38>
+     25e:	48 8b 3c 02          	mov    (%rdx,%rax,1),%rdi
+     262:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     265:	48 98                	cltq
+     267:	48 c1 e0 06          	shl    $0x6,%rax
+     26b:	48 89 c2             	mov    %rax,%rdx
+     26e:	48 8d 05 1b 2e 00 00 	lea    0x2e1b(%rip),%rax        # 3090 <st+0x30>
+     275:	48 8b 34 02          	mov    (%rdx,%rax,1),%rsi
+     279:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     27c:	48 98                	cltq
+     27e:	48 c1 e0 06          	shl    $0x6,%rax
+     282:	48 89 c2             	mov    %rax,%rdx
+     285:	48 8d 05 fc 2d 00 00 	lea    0x2dfc(%rip),%rax        # 3088 <st+0x28>
+     28c:	48 8b 0c 02          	mov    (%rdx,%rax,1),%rcx
+     290:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     293:	48 98                	cltq
+     295:	48 c1 e0 06          	shl    $0x6,%rax
+     299:	48 89 c2             	mov    %rax,%rdx
+     29c:	48 8d 05 dd 2d 00 00 	lea    0x2ddd(%rip),%rax        # 3080 <st+0x20>
+     2a3:	4c 8b 0c 02          	mov    (%rdx,%rax,1),%r9
+     2a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2aa:	48 98                	cltq
+     2ac:	48 c1 e0 06          	shl    $0x6,%rax
+     2b0:	48 89 c2             	mov    %rax,%rdx
+     2b3:	48 8d 05 be 2d 00 00 	lea    0x2dbe(%rip),%rax        # 3078 <st+0x18>
+     2ba:	4c 8b 04 02          	mov    (%rdx,%rax,1),%r8
+     2be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2c1:	48 98                	cltq
+     2c3:	48 c1 e0 06          	shl    $0x6,%rax
+     2c7:	48 89 c2             	mov    %rax,%rdx
+     2ca:	48 8d 05 9f 2d 00 00 	lea    0x2d9f(%rip),%rax        # 3070 <st+0x10>
+     2d1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     2d4:	48 98                	cltq
+     2d6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     2dd:	00 
+     2de:	48 8d 05 1b 2d 00 00 	lea    0x2d1b(%rip),%rax        # 3000 <kinds>
+     2e5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     2e9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     2ec:	48 63 d2             	movslq %edx,%rdx
+     2ef:	48 c1 e2 06          	shl    $0x6,%rdx
+     2f3:	49 89 d2             	mov    %rdx,%r10
+     2f6:	48 8d 15 63 2d 00 00 	lea    0x2d63(%rip),%rdx        # 3060 <st>
+     2fd:	4c 01 d2             	add    %r10,%rdx
+     300:	48 83 ec 08          	sub    $0x8,%rsp
+     304:	57                   	push   %rdi
+     305:	56                   	push   %rsi
+     306:	51                   	push   %rcx
+     307:	48 89 c1             	mov    %rax,%rcx
+     30a:	48 8d 05 60 1e 00 00 	lea    0x1e60(%rip),%rax        # 2171 <benchreport+0x1a7>
+     311:	48 89 c6             	mov    %rax,%rsi
+     314:	bf 01 00 00 00       	mov    $0x1,%edi
+     319:	b8 00 00 00 00       	mov    $0x0,%eax
+     31e:	e8 da 01 00 00       	call   4fd <printf>
+     323:	48 83 c4 20          	add    $0x20,%rsp
+     327:	eb 01                	jmp    32a <main+0x32a>
+      continue;
+     329:	90                   	nop
+  for (i = 0; i < n; i++) {
+     32a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     32e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     331:	3b 45 f0             	cmp    -0x10(%rbp),%eax
+     334:	0f 8c f1 fe ff ff    	jl     22b <main+0x22b>
+           st[i].acquires, st[i].contended, st[i].wait, st[i].hold,
+           st[i].maxhold);
+  }
+  exit();
+     33a:	e8 ee 07 00 00       	call   b2d <exit>
+
+000000000000033f <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     33f:	55                   	push   %rbp
+     340:	48 89 e5             	mov    %rsp,%rbp
+     343:	48 83 ec 10          	sub    $0x10,%rsp
+     347:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     34a:	89 f0                	mov    %esi,%eax
+     34c:	88 45 f8             	mov    %al,-0x8(%rbp)
+     34f:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     353:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     356:	89 d6                	mov    %edx,%esi
+     358:	89 c7                	mov    %eax,%edi
+     35a:	e8 eb 06 00 00       	call   a4a <bputc>
+     35f:	90                   	nop
+     360:	c9                   	leave
+     361:	c3                   	ret
+
+0000000000000362 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     362:	55                   	push   %rbp
+     363:	48 89 e5             	mov    %rsp,%rbp
+     366:	48 83 ec 50          	sub    $0x50,%rsp
+     36a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     36d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     371:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     374:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     377:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     37b:	74 21                	je     39e <printint64+0x3c>
+     37d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     381:	48 c1 e8 3f          	shr    $0x3f,%rax
+     385:	0f b6 c0             	movzbl %al,%eax
+     388:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     38b:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     38f:	74 0d                	je     39e <printint64+0x3c>
+    x = -xx;
+     391:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     395:	48 f7 d8             	neg    %rax
+     398:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     39c:	eb 08                	jmp    3a6 <printint64+0x44>
+  else
+    x = xx;
+     39e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     3a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     3a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     3ad:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     3b0:	48 63 c8             	movslq %eax,%rcx
+     3b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3b7:	ba 00 00 00 00       	mov    $0x0,%edx
+     3bc:	48 f7 f1             	div    %rcx
+     3bf:	48 89 d1             	mov    %rdx,%rcx
+     3c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3c5:	8d 50 01             	lea    0x1(%rax),%edx
+     3c8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3cb:	48 8d 15 4e 2c 00 00 	lea    0x2c4e(%rip),%rdx        # 3020 <digits.1>
+     3d2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     3d6:	48 98                	cltq
+     3d8:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     3dc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     3df:	48 63 f0             	movslq %eax,%rsi
+     3e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3e6:	ba 00 00 00 00       	mov    $0x0,%edx
+     3eb:	48 f7 f6             	div    %rsi
+     3ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     3f2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     3f7:	75 b4                	jne    3ad <printint64+0x4b>
+
+  if (sgn)
+     3f9:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     3fd:	74 2b                	je     42a <printint64+0xc8>
+    buf[i++] = '-';
+     3ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     402:	8d 50 01             	lea    0x1(%rax),%edx
+     405:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     408:	48 98                	cltq
+     40a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     40f:	eb 19                	jmp    42a <printint64+0xc8>
+    putc(fd, buf[i]);
+     411:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     414:	48 98                	cltq
+     416:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     41b:	0f be d0             	movsbl %al,%edx
+     41e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     421:	89 d6                	mov    %edx,%esi
+     423:	89 c7                	mov    %eax,%edi
+     425:	e8 15 ff ff ff       	call   33f <putc>
+  while (--i >= 0)
+     42a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     42e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     432:	79 dd                	jns    411 <printint64+0xaf>
+}
+     434:	90                   	nop
+     435:	90                   	nop
+     436:	c9                   	leave
+     437:	c3                   	ret
+
+0000000000000438 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     438:	55                   	push   %rbp
+     439:	48 89 e5             	mov    %rsp,%rbp
+     43c:	48 83 ec 30          	sub    $0x30,%rsp
+     440:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     443:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     446:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     449:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     44c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     453:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     457:	74 17                	je     470 <printint+0x38>
+     459:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     45d:	79 11                	jns    470 <printint+0x38>
+    neg = 1;
+     45f:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     466:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     469:	f7 d8                	neg    %eax
+     46b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     46e:	eb 06                	jmp    476 <printint+0x3e>
+  } else {
+    x = xx;
+     470:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     473:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     476:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     47d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     480:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     483:	ba 00 00 00 00       	mov    $0x0,%edx
+     488:	f7 f1                	div    %ecx
+     48a:	89 d1                	mov    %edx,%ecx
+     48c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     48f:	8d 50 01             	lea    0x1(%rax),%edx
+     492:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     495:	89 c9                	mov    %ecx,%ecx
+     497:	48 8d 15 a2 2b 00 00 	lea    0x2ba2(%rip),%rdx        # 3040 <digits.0>
+     49e:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     4a2:	48 98                	cltq
+     4a4:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     4a8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     4ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4ae:	ba 00 00 00 00       	mov    $0x0,%edx
+     4b3:	f7 f6                	div    %esi
+     4b5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     4b8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     4bc:	75 bf                	jne    47d <printint+0x45>
+  if (neg)
+     4be:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     4c2:	74 2b                	je     4ef <printint+0xb7>
+    buf[i++] = '-';
+     4c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4c7:	8d 50 01             	lea    0x1(%rax),%edx
+     4ca:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4cd:	48 98                	cltq
+     4cf:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     4d4:	eb 19                	jmp    4ef <printint+0xb7>
+    putc(fd, buf[i]);
+     4d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4d9:	48 98                	cltq
+     4db:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     4e0:	0f be d0             	movsbl %al,%edx
+     4e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     4e6:	89 d6                	mov    %edx,%esi
+     4e8:	89 c7                	mov    %eax,%edi
+     4ea:	e8 50 fe ff ff       	call   33f <putc>
+  while (--i >= 0)
+     4ef:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     4f3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     4f7:	79 dd                	jns    4d6 <printint+0x9e>
+}
+     4f9:	90                   	nop
+     4fa:	90                   	nop
+     4fb:	c9                   	leave
+     4fc:	c3                   	ret
+
+00000000000004fd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     4fd:	55                   	push   %rbp
+     4fe:	48 89 e5             	mov    %rsp,%rbp
+     501:	48 83 ec 70          	sub    $0x70,%rsp
+     505:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     508:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     50c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     510:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     514:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     518:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     51c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     523:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     527:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     52b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     52f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     533:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     53a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     541:	e9 67 02 00 00       	jmp    7ad <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     546:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     549:	48 63 d0             	movslq %eax,%rdx
+     54c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     550:	48 01 d0             	add    %rdx,%rax
+     553:	0f b6 00             	movzbl (%rax),%eax
+     556:	0f be c0             	movsbl %al,%eax
+     559:	25 ff 00 00 00       	and    $0xff,%eax
+     55e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     561:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     565:	75 30                	jne    597 <printf+0x9a>
+      if (c == '%') {
+     567:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     56b:	75 13                	jne    580 <printf+0x83>
+        state = '%';
+     56d:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     574:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     57b:	e9 29 02 00 00       	jmp    7a9 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     580:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     583:	0f be d0             	movsbl %al,%edx
+     586:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     589:	89 d6                	mov    %edx,%esi
+     58b:	89 c7                	mov    %eax,%edi
+     58d:	e8 ad fd ff ff       	call   33f <putc>
+     592:	e9 12 02 00 00       	jmp    7a9 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     597:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     59b:	0f 85 08 02 00 00    	jne    7a9 <printf+0x2ac>
+      if (c == 'l') {
+     5a1:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     5a5:	75 0c                	jne    5b3 <printf+0xb6>
+        lflag = 1;
+     5a7:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     5ae:	e9 f6 01 00 00       	jmp    7a9 <printf+0x2ac>
+      } else if (c == 'd') {
+     5b3:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     5b7:	0f 85 93 00 00 00    	jne    650 <printf+0x153>
+        if (lflag == 1)
+     5bd:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     5c1:	75 47                	jne    60a <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     5c3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     5c6:	83 f8 2f             	cmp    $0x2f,%eax
+     5c9:	77 17                	ja     5e2 <printf+0xe5>
+     5cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     5cf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5d2:	89 d2                	mov    %edx,%edx
+     5d4:	48 01 d0             	add    %rdx,%rax
+     5d7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5da:	83 c2 08             	add    $0x8,%edx
+     5dd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     5e0:	eb 0c                	jmp    5ee <printf+0xf1>
+     5e2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     5e6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     5ea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     5ee:	48 8b 30             	mov    (%rax),%rsi
+     5f1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5f4:	b9 01 00 00 00       	mov    $0x1,%ecx
+     5f9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     5fe:	89 c7                	mov    %eax,%edi
+     600:	e8 5d fd ff ff       	call   362 <printint64>
+     605:	e9 98 01 00 00       	jmp    7a2 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     60a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     60d:	83 f8 2f             	cmp    $0x2f,%eax
+     610:	77 17                	ja     629 <printf+0x12c>
+     612:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     616:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     619:	89 d2                	mov    %edx,%edx
+     61b:	48 01 d0             	add    %rdx,%rax
+     61e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     621:	83 c2 08             	add    $0x8,%edx
+     624:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     627:	eb 0c                	jmp    635 <printf+0x138>
+     629:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     62d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     631:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     635:	8b 30                	mov    (%rax),%esi
+     637:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     63a:	b9 01 00 00 00       	mov    $0x1,%ecx
+     63f:	ba 0a 00 00 00       	mov    $0xa,%edx
+     644:	89 c7                	mov    %eax,%edi
+     646:	e8 ed fd ff ff       	call   438 <printint>
+     64b:	e9 52 01 00 00       	jmp    7a2 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     650:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     654:	74 0a                	je     660 <printf+0x163>
+     656:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     65a:	0f 85 93 00 00 00    	jne    6f3 <printf+0x1f6>
+        if (lflag == 1)
+     660:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     664:	75 47                	jne    6ad <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     666:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     669:	83 f8 2f             	cmp    $0x2f,%eax
+     66c:	77 17                	ja     685 <printf+0x188>
+     66e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     672:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     675:	89 d2                	mov    %edx,%edx
+     677:	48 01 d0             	add    %rdx,%rax
+     67a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     67d:	83 c2 08             	add    $0x8,%edx
+     680:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     683:	eb 0c                	jmp    691 <printf+0x194>
+     685:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     689:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     68d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     691:	48 8b 30             	mov    (%rax),%rsi
+     694:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     697:	b9 00 00 00 00       	mov    $0x0,%ecx
+     69c:	ba 10 00 00 00       	mov    $0x10,%edx
+     6a1:	89 c7                	mov    %eax,%edi
+     6a3:	e8 ba fc ff ff       	call   362 <printint64>
+        if (lflag == 1)
+     6a8:	e9 f5 00 00 00       	jmp    7a2 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     6ad:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     6b0:	83 f8 2f             	cmp    $0x2f,%eax
+     6b3:	77 17                	ja     6cc <printf+0x1cf>
+     6b5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     6b9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6bc:	89 d2                	mov    %edx,%edx
+     6be:	48 01 d0             	add    %rdx,%rax
+     6c1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6c4:	83 c2 08             	add    $0x8,%edx
+     6c7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     6ca:	eb 0c                	jmp    6d8 <printf+0x1db>
+     6cc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     6d0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     6d4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     6d8:	8b 30                	mov    (%rax),%esi
+     6da:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+     6e2:	ba 10 00 00 00       	mov    $0x10,%edx
+     6e7:	89 c7                	mov    %eax,%edi
+     6e9:	e8 4a fd ff ff       	call   438 <printint>
+        if (lflag == 1)
+     6ee:	e9 af 00 00 00       	jmp    7a2 <printf+0x2a5>
+      } else if (c == 's') {
+     6f3:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     6f7:	75 6e                	jne    767 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     6f9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     6fc:	83 f8 2f             	cmp    $0x2f,%eax
+     6ff:	77 17                	ja     718 <printf+0x21b>
+     701:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     705:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     708:	89 d2                	mov    %edx,%edx
+     70a:	48 01 d0             	add    %rdx,%rax
+     70d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     710:	83 c2 08             	add    $0x8,%edx
+     713:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     716:	eb 0c                	jmp    724 <printf+0x227>
+     718:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     71c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     720:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     724:	48 8b 00             	mov    (%rax),%rax
+     727:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     72b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     730:	75 28                	jne    75a <printf+0x25d>
+          s = "(null)";
+     732:	48 8d 05 53 1a 00 00 	lea    0x1a53(%rip),%rax        # 218c <benchreport+0x1c2>
+     739:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     73d:	eb 1b                	jmp    75a <printf+0x25d>
+          putc(fd, *s);
+     73f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     743:	0f b6 00             	movzbl (%rax),%eax
+     746:	0f be d0             	movsbl %al,%edx
+     749:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     74c:	89 d6                	mov    %edx,%esi
+     74e:	89 c7                	mov    %eax,%edi
+     750:	e8 ea fb ff ff       	call   33f <putc>
+        for (; *s; s++)
+     755:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     75a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     75e:	0f b6 00             	movzbl (%rax),%eax
+     761:	84 c0                	test   %al,%al
+     763:	75 da                	jne    73f <printf+0x242>
+     765:	eb 3b                	jmp    7a2 <printf+0x2a5>
+      } else if (c == '%') {
+     767:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     76b:	75 14                	jne    781 <printf+0x284>
+        putc(fd, c);
+     76d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     770:	0f be d0             	movsbl %al,%edx
+     773:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     776:	89 d6                	mov    %edx,%esi
+     778:	89 c7                	mov    %eax,%edi
+     77a:	e8 c0 fb ff ff       	call   33f <putc>
+     77f:	eb 21                	jmp    7a2 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     781:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     784:	be 25 00 00 00       	mov    $0x25,%esi
+     789:	89 c7                	mov    %eax,%edi
+     78b:	e8 af fb ff ff       	call   33f <putc>
+        putc(fd, c);
+     790:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     793:	0f be d0             	movsbl %al,%edx
+     796:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     799:	89 d6                	mov    %edx,%esi
+     79b:	89 c7                	mov    %eax,%edi
+     79d:	e8 9d fb ff ff       	call   33f <putc>
+      }
+      state = 0;
+     7a2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     7a9:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     7ad:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     7b0:	48 63 d0             	movslq %eax,%rdx
+     7b3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     7b7:	48 01 d0             	add    %rdx,%rax
+     7ba:	0f b6 00             	movzbl (%rax),%eax
+     7bd:	84 c0                	test   %al,%al
+     7bf:	0f 85 81 fd ff ff    	jne    546 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     7c5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7c8:	89 c7                	mov    %eax,%edi
+     7ca:	e8 ee 02 00 00       	call   abd <bflushtty>
+}
+     7cf:	90                   	nop
+     7d0:	c9                   	leave
+     7d1:	c3                   	ret
+
+00000000000007d2 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     7d2:	55                   	push   %rbp
+     7d3:	48 89 e5             	mov    %rsp,%rbp
+     7d6:	48 83 ec 30          	sub    $0x30,%rsp
+     7da:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     7dd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     7e1:	78 06                	js     7e9 <getbuf+0x17>
+     7e3:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     7e7:	7e 0a                	jle    7f3 <getbuf+0x21>
+    return 0;
+     7e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ee:	e9 94 00 00 00       	jmp    887 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     7f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7f6:	48 98                	cltq
+     7f8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     7ff:	00 
+     800:	48 8d 05 59 38 00 00 	lea    0x3859(%rip),%rax        # 4060 <obufs>
+     807:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     80b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     80f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     814:	75 6d                	jne    883 <getbuf+0xb1>
+     816:	bf 08 02 00 00       	mov    $0x208,%edi
+     81b:	e8 bd 13 00 00       	call   1bdd <malloc>
+     820:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     824:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     829:	74 58                	je     883 <getbuf+0xb1>
+    b->n = 0;
+     82b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     82f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     835:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     839:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     83c:	48 89 d6             	mov    %rdx,%rsi
+     83f:	89 c7                	mov    %eax,%edi
+     841:	e8 e4 0d 00 00       	call   162a <fstat>
+     846:	85 c0                	test   %eax,%eax
+     848:	75 11                	jne    85b <getbuf+0x89>
+     84a:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     84e:	66 83 f8 03          	cmp    $0x3,%ax
+     852:	75 07                	jne    85b <getbuf+0x89>
+     854:	ba 01 00 00 00       	mov    $0x1,%edx
+     859:	eb 05                	jmp    860 <getbuf+0x8e>
+     85b:	ba 00 00 00 00       	mov    $0x0,%edx
+     860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     864:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     867:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     86a:	48 98                	cltq
+     86c:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     873:	00 
+     874:	48 8d 15 e5 37 00 00 	lea    0x37e5(%rip),%rdx        # 4060 <obufs>
+     87b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     87f:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     887:	c9                   	leave
+     888:	c3                   	ret
+
+0000000000000889 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     889:	55                   	push   %rbp
+     88a:	48 89 e5             	mov    %rsp,%rbp
+     88d:	48 83 ec 20          	sub    $0x20,%rsp
+     891:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     894:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     898:	78 33                	js     8cd <bflush+0x44>
+     89a:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     89e:	7f 2d                	jg     8cd <bflush+0x44>
+     8a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8a3:	48 98                	cltq
+     8a5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8ac:	00 
+     8ad:	48 8d 05 ac 37 00 00 	lea    0x37ac(%rip),%rax        # 4060 <obufs>
+     8b4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8bc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8c1:	74 0a                	je     8cd <bflush+0x44>
+     8c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8c7:	8b 00                	mov    (%rax),%eax
+     8c9:	85 c0                	test   %eax,%eax
+     8cb:	75 07                	jne    8d4 <bflush+0x4b>
+    return 0;
+     8cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d2:	eb 3c                	jmp    910 <bflush+0x87>
+  n = b->n;
+     8d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8d8:	8b 00                	mov    (%rax),%eax
+     8da:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     8dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8e1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     8e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8eb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     8ef:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     8f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8f5:	48 89 ce             	mov    %rcx,%rsi
+     8f8:	89 c7                	mov    %eax,%edi
+     8fa:	e8 de 0c 00 00       	call   15dd <write>
+     8ff:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     902:	75 07                	jne    90b <bflush+0x82>
+     904:	b8 00 00 00 00       	mov    $0x0,%eax
+     909:	eb 05                	jmp    910 <bflush+0x87>
+     90b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     910:	c9                   	leave
+     911:	c3                   	ret
+
+0000000000000912 <bflushall>:
+
+void bflushall(void) {
+     912:	55                   	push   %rbp
+     913:	48 89 e5             	mov    %rsp,%rbp
+     916:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     91a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     921:	eb 0e                	jmp    931 <bflushall+0x1f>
+    bflush(fd);
+     923:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     926:	89 c7                	mov    %eax,%edi
+     928:	e8 5c ff ff ff       	call   889 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     92d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     931:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     935:	7e ec                	jle    923 <bflushall+0x11>
+}
+     937:	90                   	nop
+     938:	90                   	nop
+     939:	c9                   	leave
+     93a:	c3                   	ret
+
+000000000000093b <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     93b:	55                   	push   %rbp
+     93c:	48 89 e5             	mov    %rsp,%rbp
+     93f:	48 83 ec 30          	sub    $0x30,%rsp
+     943:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     946:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     94a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     94d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     950:	89 c7                	mov    %eax,%edi
+     952:	e8 7b fe ff ff       	call   7d2 <getbuf>
+     957:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     95b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     960:	75 19                	jne    97b <bwrite+0x40>
+    return write(fd, s, n);
+     962:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     965:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     969:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     96c:	48 89 ce             	mov    %rcx,%rsi
+     96f:	89 c7                	mov    %eax,%edi
+     971:	e8 67 0c 00 00       	call   15dd <write>
+     976:	e9 cd 00 00 00       	jmp    a48 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     97b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     982:	e9 92 00 00 00       	jmp    a19 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     987:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     98b:	8b 00                	mov    (%rax),%eax
+     98d:	3d 00 02 00 00       	cmp    $0x200,%eax
+     992:	75 18                	jne    9ac <bwrite+0x71>
+     994:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     997:	89 c7                	mov    %eax,%edi
+     999:	e8 eb fe ff ff       	call   889 <bflush>
+     99e:	85 c0                	test   %eax,%eax
+     9a0:	79 0a                	jns    9ac <bwrite+0x71>
+      return -1;
+     9a2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9a7:	e9 9c 00 00 00       	jmp    a48 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     9ac:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     9af:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     9b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     9b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9b9:	8b 00                	mov    (%rax),%eax
+     9bb:	ba 00 02 00 00       	mov    $0x200,%edx
+     9c0:	29 c2                	sub    %eax,%edx
+     9c2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     9c5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     9c8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     9cb:	39 c2                	cmp    %eax,%edx
+     9cd:	0f 4e c2             	cmovle %edx,%eax
+     9d0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     9d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d6:	48 63 d0             	movslq %eax,%rdx
+     9d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     9dd:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     9e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9e5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9ed:	8b 00                	mov    (%rax),%eax
+     9ef:	48 98                	cltq
+     9f1:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     9f5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     9f8:	89 c2                	mov    %eax,%edx
+     9fa:	48 89 cf             	mov    %rcx,%rdi
+     9fd:	e8 e9 06 00 00       	call   10eb <memmove>
+    b->n += m;
+     a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a06:	8b 10                	mov    (%rax),%edx
+     a08:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a0b:	01 c2                	add    %eax,%edx
+     a0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a11:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     a13:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a16:	01 45 fc             	add    %eax,-0x4(%rbp)
+     a19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a1c:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     a1f:	0f 8c 62 ff ff ff    	jl     987 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     a25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a29:	8b 40 04             	mov    0x4(%rax),%eax
+     a2c:	85 c0                	test   %eax,%eax
+     a2e:	74 15                	je     a45 <bwrite+0x10a>
+     a30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a33:	89 c7                	mov    %eax,%edi
+     a35:	e8 4f fe ff ff       	call   889 <bflush>
+     a3a:	85 c0                	test   %eax,%eax
+     a3c:	79 07                	jns    a45 <bwrite+0x10a>
+    return -1;
+     a3e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a43:	eb 03                	jmp    a48 <bwrite+0x10d>
+  return n;
+     a45:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     a48:	c9                   	leave
+     a49:	c3                   	ret
+
+0000000000000a4a <bputc>:
+
+void bputc(int fd, char c) {
+     a4a:	55                   	push   %rbp
+     a4b:	48 89 e5             	mov    %rsp,%rbp
+     a4e:	48 83 ec 20          	sub    $0x20,%rsp
+     a52:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     a55:	89 f0                	mov    %esi,%eax
+     a57:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     a5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a5d:	89 c7                	mov    %eax,%edi
+     a5f:	e8 6e fd ff ff       	call   7d2 <getbuf>
+     a64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a68:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a6d:	75 18                	jne    a87 <bputc+0x3d>
+    write(fd, &c, 1);
+     a6f:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     a73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a76:	ba 01 00 00 00       	mov    $0x1,%edx
+     a7b:	48 89 ce             	mov    %rcx,%rsi
+     a7e:	89 c7                	mov    %eax,%edi
+     a80:	e8 58 0b 00 00       	call   15dd <write>
+    return;
+     a85:	eb 34                	jmp    abb <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a8b:	8b 00                	mov    (%rax),%eax
+     a8d:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a92:	75 0a                	jne    a9e <bputc+0x54>
+    bflush(fd);
+     a94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a97:	89 c7                	mov    %eax,%edi
+     a99:	e8 eb fd ff ff       	call   889 <bflush>
+  b->data[b->n++] = c;
+     a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aa2:	8b 00                	mov    (%rax),%eax
+     aa4:	8d 48 01             	lea    0x1(%rax),%ecx
+     aa7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     aab:	89 0a                	mov    %ecx,(%rdx)
+     aad:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     ab1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     ab5:	48 98                	cltq
+     ab7:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     abb:	c9                   	leave
+     abc:	c3                   	ret
+
+0000000000000abd <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     abd:	55                   	push   %rbp
+     abe:	48 89 e5             	mov    %rsp,%rbp
+     ac1:	48 83 ec 10          	sub    $0x10,%rsp
+     ac5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     ac8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     acc:	78 4c                	js     b1a <bflushtty+0x5d>
+     ace:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     ad2:	7f 46                	jg     b1a <bflushtty+0x5d>
+     ad4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ad7:	48 98                	cltq
+     ad9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ae0:	00 
+     ae1:	48 8d 05 78 35 00 00 	lea    0x3578(%rip),%rax        # 4060 <obufs>
+     ae8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     aec:	48 85 c0             	test   %rax,%rax
+     aef:	74 29                	je     b1a <bflushtty+0x5d>
+     af1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     af4:	48 98                	cltq
+     af6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     afd:	00 
+     afe:	48 8d 05 5b 35 00 00 	lea    0x355b(%rip),%rax        # 4060 <obufs>
+     b05:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b09:	8b 40 04             	mov    0x4(%rax),%eax
+     b0c:	85 c0                	test   %eax,%eax
+     b0e:	74 0a                	je     b1a <bflushtty+0x5d>
+    bflush(fd);
+     b10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b13:	89 c7                	mov    %eax,%edi
+     b15:	e8 6f fd ff ff       	call   889 <bflush>
+}
+     b1a:	90                   	nop
+     b1b:	c9                   	leave
+     b1c:	c3                   	ret
+
+0000000000000b1d <fork>:
+
+int fork(void) {
+     b1d:	55                   	push   %rbp
+     b1e:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     b21:	e8 ec fd ff ff       	call   912 <bflushall>
+  return _fork();
+     b26:	e8 7b 0a 00 00       	call   15a6 <_fork>
+}
+     b2b:	5d                   	pop    %rbp
+     b2c:	c3                   	ret
+
+0000000000000b2d <exit>:
+
+noreturn void exit(void) {
+     b2d:	55                   	push   %rbp
+     b2e:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     b31:	e8 dc fd ff ff       	call   912 <bflushall>
+  _exit();
+     b36:	e8 76 0a 00 00       	call   15b1 <_exit>
+
+0000000000000b3b <exec>:
+}
+
+int exec(char *path, char **argv) {
+     b3b:	55                   	push   %rbp
+     b3c:	48 89 e5             	mov    %rsp,%rbp
+     b3f:	48 83 ec 10          	sub    $0x10,%rsp
+     b43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b47:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     b4b:	e8 c2 fd ff ff       	call   912 <bflushall>
+  return _exec(path, argv);
+     b50:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b58:	48 89 d6             	mov    %rdx,%rsi
+     b5b:	48 89 c7             	mov    %rax,%rdi
+     b5e:	e8 9b 0a 00 00       	call   15fe <_exec>
+}
+     b63:	c9                   	leave
+     b64:	c3                   	ret
+
+0000000000000b65 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     b65:	55                   	push   %rbp
+     b66:	48 89 e5             	mov    %rsp,%rbp
+     b69:	48 83 ec 20          	sub    $0x20,%rsp
+     b6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b75:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     b79:	e8 94 fd ff ff       	call   912 <bflushall>
+  return _spawn(path, argv, fds);
+     b7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b82:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b8a:	48 89 ce             	mov    %rcx,%rsi
+     b8d:	48 89 c7             	mov    %rax,%rdi
+     b90:	e8 2f 0b 00 00       	call   16c4 <_spawn>
+}
+     b95:	c9                   	leave
+     b96:	c3                   	ret
+
+0000000000000b97 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     b97:	55                   	push   %rbp
+     b98:	48 89 e5             	mov    %rsp,%rbp
+     b9b:	48 83 ec 10          	sub    $0x10,%rsp
+     b9f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     ba2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     ba6:	78 69                	js     c11 <close+0x7a>
+     ba8:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     bac:	7f 63                	jg     c11 <close+0x7a>
+     bae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bb1:	48 98                	cltq
+     bb3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     bba:	00 
+     bbb:	48 8d 05 9e 34 00 00 	lea    0x349e(%rip),%rax        # 4060 <obufs>
+     bc2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     bc6:	48 85 c0             	test   %rax,%rax
+     bc9:	74 46                	je     c11 <close+0x7a>
+    bflush(fd);
+     bcb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bce:	89 c7                	mov    %eax,%edi
+     bd0:	e8 b4 fc ff ff       	call   889 <bflush>
+    free(obufs[fd]);
+     bd5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bd8:	48 98                	cltq
+     bda:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     be1:	00 
+     be2:	48 8d 05 77 34 00 00 	lea    0x3477(%rip),%rax        # 4060 <obufs>
+     be9:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     bed:	48 89 c7             	mov    %rax,%rdi
+     bf0:	e8 90 11 00 00       	call   1d85 <free>
+    obufs[fd] = 0;
+     bf5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bf8:	48 98                	cltq
+     bfa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     c01:	00 
+     c02:	48 8d 05 57 34 00 00 	lea    0x3457(%rip),%rax        # 4060 <obufs>
+     c09:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     c10:	00 
+  }
+  return _close(fd);
+     c11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c14:	89 c7                	mov    %eax,%edi
+     c16:	e8 cd 09 00 00       	call   15e8 <_close>
+}
+     c1b:	c9                   	leave
+     c1c:	c3                   	ret
+
+0000000000000c1d <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     c1d:	55                   	push   %rbp
+     c1e:	48 89 e5             	mov    %rsp,%rbp
+     c21:	53                   	push   %rbx
+     c22:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c26:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     c2a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     c2e:	48 8b 36             	mov    (%rsi),%rsi
+     c31:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     c35:	48 29 f7             	sub    %rsi,%rdi
+     c38:	48 89 f9             	mov    %rdi,%rcx
+     c3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c40:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     c44:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     c48:	48 89 f0             	mov    %rsi,%rax
+     c4b:	ba 00 00 00 00       	mov    $0x0,%edx
+     c50:	48 89 df             	mov    %rbx,%rdi
+     c53:	48 0f af f8          	imul   %rax,%rdi
+     c57:	48 89 d6             	mov    %rdx,%rsi
+     c5a:	48 0f af f1          	imul   %rcx,%rsi
+     c5e:	48 01 fe             	add    %rdi,%rsi
+     c61:	48 f7 e1             	mul    %rcx
+     c64:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     c68:	48 89 ca             	mov    %rcx,%rdx
+     c6b:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     c70:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     c74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c78:	c9                   	leave
+     c79:	c3                   	ret
+
+0000000000000c7a <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     c7a:	55                   	push   %rbp
+     c7b:	48 89 e5             	mov    %rsp,%rbp
+     c7e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c82:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c85:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     c88:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     c8c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c8f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c92:	48 89 ce             	mov    %rcx,%rsi
+     c95:	48 89 f7             	mov    %rsi,%rdi
+     c98:	89 d1                	mov    %edx,%ecx
+     c9a:	fc                   	cld
+     c9b:	f3 aa                	rep stos %al,%es:(%rdi)
+     c9d:	89 ca                	mov    %ecx,%edx
+     c9f:	48 89 fe             	mov    %rdi,%rsi
+     ca2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     ca6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     ca9:	90                   	nop
+     caa:	5d                   	pop    %rbp
+     cab:	c3                   	ret
+
+0000000000000cac <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     cac:	55                   	push   %rbp
+     cad:	48 89 e5             	mov    %rsp,%rbp
+     cb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cb4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     cb8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     cbc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     cc0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     cc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cc8:	48 89 ce             	mov    %rcx,%rsi
+     ccb:	48 89 f7             	mov    %rsi,%rdi
+     cce:	48 89 d1             	mov    %rdx,%rcx
+     cd1:	fc                   	cld
+     cd2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     cd5:	48 89 ca             	mov    %rcx,%rdx
+     cd8:	48 89 fe             	mov    %rdi,%rsi
+     cdb:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     cdf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     ce3:	90                   	nop
+     ce4:	5d                   	pop    %rbp
+     ce5:	c3                   	ret
+
+0000000000000ce6 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     ce6:	55                   	push   %rbp
+     ce7:	48 89 e5             	mov    %rsp,%rbp
+     cea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     cf2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     cf6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     cfa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     cfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d02:	48 89 cf             	mov    %rcx,%rdi
+     d05:	48 89 d6             	mov    %rdx,%rsi
+     d08:	48 89 c1             	mov    %rax,%rcx
+     d0b:	fc                   	cld
+     d0c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     d0e:	48 89 c8             	mov    %rcx,%rax
+     d11:	48 89 f2             	mov    %rsi,%rdx
+     d14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d18:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     d1c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     d20:	90                   	nop
+     d21:	5d                   	pop    %rbp
+     d22:	c3                   	ret
+
+0000000000000d23 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     d23:	55                   	push   %rbp
+     d24:	48 89 e5             	mov    %rsp,%rbp
+     d27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     d2f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     d33:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     d37:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d3f:	48 89 cf             	mov    %rcx,%rdi
+     d42:	48 89 d6             	mov    %rdx,%rsi
+     d45:	48 89 c1             	mov    %rax,%rcx
+     d48:	fc                   	cld
+     d49:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     d4c:	48 89 c8             	mov    %rcx,%rax
+     d4f:	48 89 f2             	mov    %rsi,%rdx
+     d52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d56:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     d5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     d5e:	90                   	nop
+     d5f:	5d                   	pop    %rbp
+     d60:	c3                   	ret
+
+0000000000000d61 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     d61:	55                   	push   %rbp
+     d62:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     d65:	0f 31                	rdtsc
+     d67:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     d6a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     d6d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d70:	48 c1 e0 20          	shl    $0x20,%rax
+     d74:	48 89 c2             	mov    %rax,%rdx
+     d77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d7a:	48 09 d0             	or     %rdx,%rax
+}
+     d7d:	5d                   	pop    %rbp
+     d7e:	c3                   	ret
+
+0000000000000d7f <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     d7f:	55                   	push   %rbp
+     d80:	48 89 e5             	mov    %rsp,%rbp
+     d83:	53                   	push   %rbx
+     d84:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     d87:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     d8b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     d8f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     d93:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     d97:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     d9a:	0f a2                	cpuid
+     d9c:	89 de                	mov    %ebx,%esi
+     d9e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     da1:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     da4:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     da7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     daa:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     daf:	74 09                	je     dba <cpuid+0x3b>
+    *eaxp = eax;
+     db1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     db5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     db8:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     dba:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     dbf:	74 09                	je     dca <cpuid+0x4b>
+    *ebxp = ebx;
+     dc1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     dc5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     dc8:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     dca:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     dcf:	74 09                	je     dda <cpuid+0x5b>
+    *ecxp = ecx;
+     dd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     dd5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     dd8:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     dda:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     ddf:	74 09                	je     dea <cpuid+0x6b>
+    *edxp = edx;
+     de1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     de5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     de8:	89 10                	mov    %edx,(%rax)
+}
+     dea:	90                   	nop
+     deb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     def:	c9                   	leave
+     df0:	c3                   	ret
+
+0000000000000df1 <strcpy>:
+char *strcpy(char *s, char *t) {
+     df1:	55                   	push   %rbp
+     df2:	48 89 e5             	mov    %rsp,%rbp
+     df5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     df9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     dfd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     e05:	90                   	nop
+     e06:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     e0a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     e0e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     e12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e16:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     e1a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     e1e:	0f b6 12             	movzbl (%rdx),%edx
+     e21:	88 10                	mov    %dl,(%rax)
+     e23:	0f b6 00             	movzbl (%rax),%eax
+     e26:	84 c0                	test   %al,%al
+     e28:	75 dc                	jne    e06 <strcpy+0x15>
+  return os;
+     e2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e2e:	5d                   	pop    %rbp
+     e2f:	c3                   	ret
+
+0000000000000e30 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     e30:	55                   	push   %rbp
+     e31:	48 89 e5             	mov    %rsp,%rbp
+     e34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e38:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     e3c:	eb 0a                	jmp    e48 <strcmp+0x18>
+    p++, q++;
+     e3e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e43:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     e48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e4c:	0f b6 00             	movzbl (%rax),%eax
+     e4f:	84 c0                	test   %al,%al
+     e51:	74 12                	je     e65 <strcmp+0x35>
+     e53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e57:	0f b6 10             	movzbl (%rax),%edx
+     e5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e5e:	0f b6 00             	movzbl (%rax),%eax
+     e61:	38 c2                	cmp    %al,%dl
+     e63:	74 d9                	je     e3e <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     e65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e69:	0f b6 00             	movzbl (%rax),%eax
+     e6c:	0f b6 d0             	movzbl %al,%edx
+     e6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e73:	0f b6 00             	movzbl (%rax),%eax
+     e76:	0f b6 c0             	movzbl %al,%eax
+     e79:	29 c2                	sub    %eax,%edx
+     e7b:	89 d0                	mov    %edx,%eax
+}
+     e7d:	5d                   	pop    %rbp
+     e7e:	c3                   	ret
+
+0000000000000e7f <strlen>:
+uint strlen(char *s) {
+     e7f:	55                   	push   %rbp
+     e80:	48 89 e5             	mov    %rsp,%rbp
+     e83:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     e87:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e8e:	eb 04                	jmp    e94 <strlen+0x15>
+     e90:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e97:	48 63 d0             	movslq %eax,%rdx
+     e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e9e:	48 01 d0             	add    %rdx,%rax
+     ea1:	0f b6 00             	movzbl (%rax),%eax
+     ea4:	84 c0                	test   %al,%al
+     ea6:	75 e8                	jne    e90 <strlen+0x11>
+    ;
+  return n;
+     ea8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     eab:	5d                   	pop    %rbp
+     eac:	c3                   	ret
+
+0000000000000ead <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     ead:	55                   	push   %rbp
+     eae:	48 89 e5             	mov    %rsp,%rbp
+     eb1:	53                   	push   %rbx
+     eb2:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     eb6:	8b 05 98 21 00 00    	mov    0x2198(%rip),%eax        # 3054 <erms>
+     ebc:	85 c0                	test   %eax,%eax
+     ebe:	79 53                	jns    f13 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     ec0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     ec4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     eca:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+     ed4:	48 89 c6             	mov    %rax,%rsi
+     ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+     edc:	e8 9e fe ff ff       	call   d7f <cpuid>
+    ebx = 0;
+     ee1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     ee8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     eeb:	83 f8 06             	cmp    $0x6,%eax
+     eee:	76 14                	jbe    f04 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     ef0:	b8 07 00 00 00       	mov    $0x7,%eax
+     ef5:	b9 00 00 00 00       	mov    $0x0,%ecx
+     efa:	0f a2                	cpuid
+     efc:	89 d9                	mov    %ebx,%ecx
+     efe:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     f01:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     f04:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f07:	c1 e8 09             	shr    $0x9,%eax
+     f0a:	83 e0 01             	and    $0x1,%eax
+     f0d:	89 05 41 21 00 00    	mov    %eax,0x2141(%rip)        # 3054 <erms>
+  }
+  return erms;
+     f13:	8b 05 3b 21 00 00    	mov    0x213b(%rip),%eax        # 3054 <erms>
+}
+     f19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f1d:	c9                   	leave
+     f1e:	c3                   	ret
+
+0000000000000f1f <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     f1f:	55                   	push   %rbp
+     f20:	48 89 e5             	mov    %rsp,%rbp
+     f23:	48 83 ec 10          	sub    $0x10,%rsp
+     f27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f2b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     f2e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     f31:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     f35:	76 09                	jbe    f40 <memset+0x21>
+     f37:	e8 71 ff ff ff       	call   ead <haserms>
+     f3c:	85 c0                	test   %eax,%eax
+     f3e:	74 16                	je     f56 <memset+0x37>
+    stosb(dst, c, n);
+     f40:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f43:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     f46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f4a:	89 ce                	mov    %ecx,%esi
+     f4c:	48 89 c7             	mov    %rax,%rdi
+     f4f:	e8 26 fd ff ff       	call   c7a <stosb>
+     f54:	eb 58                	jmp    fae <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     f56:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f59:	c1 e8 03             	shr    $0x3,%eax
+     f5c:	89 c6                	mov    %eax,%esi
+     f5e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f61:	48 98                	cltq
+     f63:	0f b6 c0             	movzbl %al,%eax
+     f66:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     f6d:	01 01 01 
+     f70:	48 0f af c2          	imul   %rdx,%rax
+     f74:	48 89 c1             	mov    %rax,%rcx
+     f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f7b:	48 89 f2             	mov    %rsi,%rdx
+     f7e:	48 89 ce             	mov    %rcx,%rsi
+     f81:	48 89 c7             	mov    %rax,%rdi
+     f84:	e8 23 fd ff ff       	call   cac <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     f89:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f8c:	83 e0 07             	and    $0x7,%eax
+     f8f:	89 c2                	mov    %eax,%edx
+     f91:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f94:	83 e0 f8             	and    $0xfffffff8,%eax
+     f97:	48 89 c1             	mov    %rax,%rcx
+     f9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f9e:	48 01 c1             	add    %rax,%rcx
+     fa1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fa4:	89 c6                	mov    %eax,%esi
+     fa6:	48 89 cf             	mov    %rcx,%rdi
+     fa9:	e8 cc fc ff ff       	call   c7a <stosb>
+  }
+  return dst;
+     fae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     fb2:	c9                   	leave
+     fb3:	c3                   	ret
+
+0000000000000fb4 <strchr>:
+
+char *strchr(const char *s, char c) {
+     fb4:	55                   	push   %rbp
+     fb5:	48 89 e5             	mov    %rsp,%rbp
+     fb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fbc:	89 f0                	mov    %esi,%eax
+     fbe:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     fc1:	eb 17                	jmp    fda <strchr+0x26>
+    if (*s == c)
+     fc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fc7:	0f b6 00             	movzbl (%rax),%eax
+     fca:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     fcd:	75 06                	jne    fd5 <strchr+0x21>
+      return (char *)s;
+     fcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd3:	eb 15                	jmp    fea <strchr+0x36>
+  for (; *s; s++)
+     fd5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     fda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fde:	0f b6 00             	movzbl (%rax),%eax
+     fe1:	84 c0                	test   %al,%al
+     fe3:	75 de                	jne    fc3 <strchr+0xf>
+  return 0;
+     fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     fea:	5d                   	pop    %rbp
+     feb:	c3                   	ret
+
+0000000000000fec <gets>:
+
+char *gets(char *buf, int max) {
+     fec:	55                   	push   %rbp
+     fed:	48 89 e5             	mov    %rsp,%rbp
+     ff0:	48 83 ec 20          	sub    $0x20,%rsp
+     ff4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ff8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     ffb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1002:	eb 48                	jmp    104c <gets+0x60>
+    cc = read(0, &c, 1);
+    1004:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1008:	ba 01 00 00 00       	mov    $0x1,%edx
+    100d:	48 89 c6             	mov    %rax,%rsi
+    1010:	bf 00 00 00 00       	mov    $0x0,%edi
+    1015:	e8 b8 05 00 00       	call   15d2 <read>
+    101a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    101d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1021:	7e 36                	jle    1059 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1023:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1026:	8d 50 01             	lea    0x1(%rax),%edx
+    1029:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    102c:	48 63 d0             	movslq %eax,%rdx
+    102f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1033:	48 01 c2             	add    %rax,%rdx
+    1036:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    103a:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    103c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1040:	3c 0a                	cmp    $0xa,%al
+    1042:	74 16                	je     105a <gets+0x6e>
+    1044:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1048:	3c 0d                	cmp    $0xd,%al
+    104a:	74 0e                	je     105a <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    104c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    104f:	83 c0 01             	add    $0x1,%eax
+    1052:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1055:	7f ad                	jg     1004 <gets+0x18>
+    1057:	eb 01                	jmp    105a <gets+0x6e>
+      break;
+    1059:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    105a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    105d:	48 63 d0             	movslq %eax,%rdx
+    1060:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1064:	48 01 d0             	add    %rdx,%rax
+    1067:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    106a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    106e:	c9                   	leave
+    106f:	c3                   	ret
+
+0000000000001070 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1070:	55                   	push   %rbp
+    1071:	48 89 e5             	mov    %rsp,%rbp
+    1074:	48 83 ec 10          	sub    $0x10,%rsp
+    1078:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    107c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    1080:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1088:	48 89 c6             	mov    %rax,%rsi
+    108b:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1090:	e8 58 07 00 00       	call   17ed <fstatat>
+}
+    1095:	c9                   	leave
+    1096:	c3                   	ret
+
+0000000000001097 <atoi>:
+
+int atoi(const char *s) {
+    1097:	55                   	push   %rbp
+    1098:	48 89 e5             	mov    %rsp,%rbp
+    109b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    109f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    10a6:	eb 28                	jmp    10d0 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    10a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    10ab:	89 d0                	mov    %edx,%eax
+    10ad:	c1 e0 02             	shl    $0x2,%eax
+    10b0:	01 d0                	add    %edx,%eax
+    10b2:	01 c0                	add    %eax,%eax
+    10b4:	89 c1                	mov    %eax,%ecx
+    10b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10ba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    10be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    10c2:	0f b6 00             	movzbl (%rax),%eax
+    10c5:	0f be c0             	movsbl %al,%eax
+    10c8:	01 c8                	add    %ecx,%eax
+    10ca:	83 e8 30             	sub    $0x30,%eax
+    10cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    10d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10d4:	0f b6 00             	movzbl (%rax),%eax
+    10d7:	3c 2f                	cmp    $0x2f,%al
+    10d9:	7e 0b                	jle    10e6 <atoi+0x4f>
+    10db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10df:	0f b6 00             	movzbl (%rax),%eax
+    10e2:	3c 39                	cmp    $0x39,%al
+    10e4:	7e c2                	jle    10a8 <atoi+0x11>
+  return n;
+    10e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    10e9:	5d                   	pop    %rbp
+    10ea:	c3                   	ret
+
+00000000000010eb <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    10eb:	55                   	push   %rbp
+    10ec:	48 89 e5             	mov    %rsp,%rbp
+    10ef:	48 83 ec 28          	sub    $0x28,%rsp
+    10f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    10f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    10fb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    10fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1102:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1106:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    110a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    110e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1112:	7f 09                	jg     111d <memmove+0x32>
+    return vdst;
+    1114:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1118:	e9 29 01 00 00       	jmp    1246 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    111d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1121:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1125:	0f 83 87 00 00 00    	jae    11b2 <memmove+0xc7>
+    112b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    112e:	48 63 d0             	movslq %eax,%rdx
+    1131:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1135:	48 01 d0             	add    %rdx,%rax
+    1138:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    113c:	73 74                	jae    11b2 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    113e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1141:	48 98                	cltq
+    1143:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1147:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    114a:	48 98                	cltq
+    114c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1150:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1154:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1158:	48 09 d0             	or     %rdx,%rax
+    115b:	83 e0 07             	and    $0x7,%eax
+    115e:	48 85 c0             	test   %rax,%rax
+    1161:	75 3d                	jne    11a0 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1163:	eb 1c                	jmp    1181 <memmove+0x96>
+        src -= 8;
+    1165:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    116a:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    116f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1173:	48 8b 10             	mov    (%rax),%rdx
+    1176:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    117a:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    117d:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1181:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1185:	7f de                	jg     1165 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1187:	eb 17                	jmp    11a0 <memmove+0xb5>
+      *--dst = *--src;
+    1189:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    118e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1193:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1197:	0f b6 10             	movzbl (%rax),%edx
+    119a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    119e:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    11a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11a3:	8d 50 ff             	lea    -0x1(%rax),%edx
+    11a6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    11a9:	85 c0                	test   %eax,%eax
+    11ab:	7f dc                	jg     1189 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    11ad:	e9 90 00 00 00       	jmp    1242 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    11b2:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    11b6:	7e 09                	jle    11c1 <memmove+0xd6>
+    11b8:	e8 f0 fc ff ff       	call   ead <haserms>
+    11bd:	85 c0                	test   %eax,%eax
+    11bf:	74 1b                	je     11dc <memmove+0xf1>
+    movsb(dst, src, n);
+    11c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11c4:	48 63 d0             	movslq %eax,%rdx
+    11c7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    11cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11cf:	48 89 ce             	mov    %rcx,%rsi
+    11d2:	48 89 c7             	mov    %rax,%rdi
+    11d5:	e8 0c fb ff ff       	call   ce6 <movsb>
+    11da:	eb 66                	jmp    1242 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    11dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11df:	8d 50 07             	lea    0x7(%rax),%edx
+    11e2:	85 c0                	test   %eax,%eax
+    11e4:	0f 48 c2             	cmovs  %edx,%eax
+    11e7:	c1 f8 03             	sar    $0x3,%eax
+    11ea:	48 63 d0             	movslq %eax,%rdx
+    11ed:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    11f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11f5:	48 89 ce             	mov    %rcx,%rsi
+    11f8:	48 89 c7             	mov    %rax,%rdi
+    11fb:	e8 23 fb ff ff       	call   d23 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1200:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1203:	89 d0                	mov    %edx,%eax
+    1205:	c1 f8 1f             	sar    $0x1f,%eax
+    1208:	c1 e8 1d             	shr    $0x1d,%eax
+    120b:	01 c2                	add    %eax,%edx
+    120d:	83 e2 07             	and    $0x7,%edx
+    1210:	29 c2                	sub    %eax,%edx
+    1212:	89 d0                	mov    %edx,%eax
+    1214:	48 98                	cltq
+    1216:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1219:	83 e2 f8             	and    $0xfffffff8,%edx
+    121c:	48 63 ca             	movslq %edx,%rcx
+    121f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1223:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1227:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    122a:	83 e2 f8             	and    $0xfffffff8,%edx
+    122d:	48 63 ca             	movslq %edx,%rcx
+    1230:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1234:	48 01 d1             	add    %rdx,%rcx
+    1237:	48 89 c2             	mov    %rax,%rdx
+    123a:	48 89 cf             	mov    %rcx,%rdi
+    123d:	e8 a4 fa ff ff       	call   ce6 <movsb>
+  }
+  return vdst;
+    1242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1246:	c9                   	leave
+    1247:	c3                   	ret
+
+0000000000001248 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1248:	55                   	push   %rbp
+    1249:	48 89 e5             	mov    %rsp,%rbp
+    124c:	48 83 ec 20          	sub    $0x20,%rsp
+    1250:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1253:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1257:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    125e:	00 00 00 
+    1261:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1265:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1269:	75 0d                	jne    1278 <clock_gettime+0x30>
+    126b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    126f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1273:	48 85 c0             	test   %rax,%rax
+    1276:	75 13                	jne    128b <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1278:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    127c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    127f:	48 89 d6             	mov    %rdx,%rsi
+    1282:	89 c7                	mov    %eax,%edi
+    1284:	e8 e0 04 00 00       	call   1769 <_clock_gettime>
+    1289:	eb 7d                	jmp    1308 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    128b:	e8 d1 fa ff ff       	call   d61 <rdtsc>
+    1290:	48 89 c2             	mov    %rax,%rdx
+    1293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1297:	48 89 d6             	mov    %rdx,%rsi
+    129a:	48 89 c7             	mov    %rax,%rdi
+    129d:	e8 7b f9 ff ff       	call   c1d <clockns>
+    12a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    12a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12aa:	48 c1 e8 09          	shr    $0x9,%rax
+    12ae:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    12b5:	b8 44 00 
+    12b8:	48 f7 e2             	mul    %rdx
+    12bb:	48 89 d0             	mov    %rdx,%rax
+    12be:	48 c1 e8 0b          	shr    $0xb,%rax
+    12c2:	48 89 c2             	mov    %rax,%rdx
+    12c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12c9:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    12cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    12d0:	48 89 c8             	mov    %rcx,%rax
+    12d3:	48 c1 e8 09          	shr    $0x9,%rax
+    12d7:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    12de:	b8 44 00 
+    12e1:	48 f7 e2             	mul    %rdx
+    12e4:	48 89 d0             	mov    %rdx,%rax
+    12e7:	48 c1 e8 0b          	shr    $0xb,%rax
+    12eb:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    12f2:	48 89 c8             	mov    %rcx,%rax
+    12f5:	48 29 d0             	sub    %rdx,%rax
+    12f8:	48 89 c2             	mov    %rax,%rdx
+    12fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12ff:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1303:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1308:	c9                   	leave
+    1309:	c3                   	ret
+
+000000000000130a <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    130a:	55                   	push   %rbp
+    130b:	48 89 e5             	mov    %rsp,%rbp
+    130e:	48 83 ec 10          	sub    $0x10,%rsp
+    1312:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1316:	eb 11                	jmp    1329 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1318:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    131c:	be 02 00 00 00       	mov    $0x2,%esi
+    1321:	48 89 c7             	mov    %rax,%rdi
+    1324:	e8 6c 04 00 00       	call   1795 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1329:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    132d:	b8 02 00 00 00       	mov    $0x2,%eax
+    1332:	87 02                	xchg   %eax,(%rdx)
+    1334:	85 c0                	test   %eax,%eax
+    1336:	75 e0                	jne    1318 <mutex_wait+0xe>
+}
+    1338:	90                   	nop
+    1339:	90                   	nop
+    133a:	c9                   	leave
+    133b:	c3                   	ret
+
+000000000000133c <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    133c:	55                   	push   %rbp
+    133d:	48 89 e5             	mov    %rsp,%rbp
+    1340:	48 83 ec 20          	sub    $0x20,%rsp
+    1344:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1348:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    134f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1353:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1357:	8b 02                	mov    (%rdx),%eax
+    1359:	b9 01 00 00 00       	mov    $0x1,%ecx
+    135e:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1362:	89 c1                	mov    %eax,%ecx
+    1364:	0f 94 c0             	sete   %al
+    1367:	84 c0                	test   %al,%al
+    1369:	75 02                	jne    136d <mutex_lock+0x31>
+    136b:	89 0a                	mov    %ecx,(%rdx)
+    136d:	83 f0 01             	xor    $0x1,%eax
+    1370:	84 c0                	test   %al,%al
+    1372:	74 0c                	je     1380 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1374:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1378:	48 89 c7             	mov    %rax,%rdi
+    137b:	e8 8a ff ff ff       	call   130a <mutex_wait>
+}
+    1380:	90                   	nop
+    1381:	c9                   	leave
+    1382:	c3                   	ret
+
+0000000000001383 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1383:	55                   	push   %rbp
+    1384:	48 89 e5             	mov    %rsp,%rbp
+    1387:	48 83 ec 10          	sub    $0x10,%rsp
+    138b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    138f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1393:	ba 00 00 00 00       	mov    $0x0,%edx
+    1398:	87 10                	xchg   %edx,(%rax)
+    139a:	83 fa 02             	cmp    $0x2,%edx
+    139d:	75 11                	jne    13b0 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    139f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13a3:	be 01 00 00 00       	mov    $0x1,%esi
+    13a8:	48 89 c7             	mov    %rax,%rdi
+    13ab:	e8 f0 03 00 00       	call   17a0 <futex_wake>
+}
+    13b0:	90                   	nop
+    13b1:	c9                   	leave
+    13b2:	c3                   	ret
+
+00000000000013b3 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    13b3:	55                   	push   %rbp
+    13b4:	48 89 e5             	mov    %rsp,%rbp
+    13b7:	48 83 ec 20          	sub    $0x20,%rsp
+    13bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    13c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13c7:	48 83 c0 04          	add    $0x4,%rax
+    13cb:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    13cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13d3:	8b 00                	mov    (%rax),%eax
+    13d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    13d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    13dc:	48 89 c7             	mov    %rax,%rdi
+    13df:	e8 9f ff ff ff       	call   1383 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    13e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    13eb:	89 d6                	mov    %edx,%esi
+    13ed:	48 89 c7             	mov    %rax,%rdi
+    13f0:	e8 a0 03 00 00       	call   1795 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    13f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13f9:	48 83 c0 04          	add    $0x4,%rax
+    13fd:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1401:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1405:	48 89 c7             	mov    %rax,%rdi
+    1408:	e8 fd fe ff ff       	call   130a <mutex_wait>
+}
+    140d:	90                   	nop
+    140e:	c9                   	leave
+    140f:	c3                   	ret
+
+0000000000001410 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1410:	55                   	push   %rbp
+    1411:	48 89 e5             	mov    %rsp,%rbp
+    1414:	48 83 ec 10          	sub    $0x10,%rsp
+    1418:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    141c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1420:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1428:	48 83 c0 04          	add    $0x4,%rax
+    142c:	8b 00                	mov    (%rax),%eax
+    142e:	85 c0                	test   %eax,%eax
+    1430:	7e 11                	jle    1443 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1432:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1436:	be 01 00 00 00       	mov    $0x1,%esi
+    143b:	48 89 c7             	mov    %rax,%rdi
+    143e:	e8 5d 03 00 00       	call   17a0 <futex_wake>
+}
+    1443:	90                   	nop
+    1444:	c9                   	leave
+    1445:	c3                   	ret
+
+0000000000001446 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1446:	55                   	push   %rbp
+    1447:	48 89 e5             	mov    %rsp,%rbp
+    144a:	48 83 ec 10          	sub    $0x10,%rsp
+    144e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1452:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1456:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    145a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    145e:	48 83 c0 04          	add    $0x4,%rax
+    1462:	8b 00                	mov    (%rax),%eax
+    1464:	85 c0                	test   %eax,%eax
+    1466:	7e 11                	jle    1479 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1468:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    146c:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1471:	48 89 c7             	mov    %rax,%rdi
+    1474:	e8 27 03 00 00       	call   17a0 <futex_wake>
+}
+    1479:	90                   	nop
+    147a:	c9                   	leave
+    147b:	c3                   	ret
+
+000000000000147c <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    147c:	55                   	push   %rbp
+    147d:	48 89 e5             	mov    %rsp,%rbp
+    1480:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1484:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1487:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    148b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    148f:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1493:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1497:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    149b:	8b 40 04             	mov    0x4(%rax),%eax
+    149e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    14a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14a5:	8b 00                	mov    (%rax),%eax
+    14a7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    14aa:	29 c2                	sub    %eax,%edx
+    14ac:	83 fa 1f             	cmp    $0x1f,%edx
+    14af:	76 07                	jbe    14b8 <ring_push+0x3c>
+    return -1;
+    14b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14b6:	eb 7e                	jmp    1536 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    14b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14bb:	83 e0 1f             	and    $0x1f,%eax
+    14be:	89 c2                	mov    %eax,%edx
+    14c0:	48 89 d0             	mov    %rdx,%rax
+    14c3:	48 01 c0             	add    %rax,%rax
+    14c6:	48 01 d0             	add    %rdx,%rax
+    14c9:	48 c1 e0 04          	shl    $0x4,%rax
+    14cd:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    14d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14d5:	48 01 d0             	add    %rdx,%rax
+    14d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    14dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14e0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    14e3:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    14e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14e9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    14ed:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    14f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14f5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    14f9:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    14fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1501:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1505:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1509:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    150d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1511:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1515:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1519:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    151d:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1521:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1524:	8d 50 01             	lea    0x1(%rax),%edx
+    1527:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    152b:	48 83 c0 04          	add    $0x4,%rax
+    152f:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1531:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1536:	5d                   	pop    %rbp
+    1537:	c3                   	ret
+
+0000000000001538 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1538:	55                   	push   %rbp
+    1539:	48 89 e5             	mov    %rsp,%rbp
+    153c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1540:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1544:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1548:	8b 40 08             	mov    0x8(%rax),%eax
+    154b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    154e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1552:	48 83 c0 0c          	add    $0xc,%rax
+    1556:	8b 00                	mov    (%rax),%eax
+    1558:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    155b:	75 07                	jne    1564 <ring_pop+0x2c>
+    return -1;
+    155d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1562:	eb 40                	jmp    15a4 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1564:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1567:	83 e0 1f             	and    $0x1f,%eax
+    156a:	89 c2                	mov    %eax,%edx
+    156c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1574:	89 d2                	mov    %edx,%edx
+    1576:	48 83 c2 61          	add    $0x61,%rdx
+    157a:	48 c1 e2 04          	shl    $0x4,%rdx
+    157e:	48 01 d0             	add    %rdx,%rax
+    1581:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1585:	48 8b 00             	mov    (%rax),%rax
+    1588:	48 89 01             	mov    %rax,(%rcx)
+    158b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    158f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1592:	8d 50 01             	lea    0x1(%rax),%edx
+    1595:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1599:	48 83 c0 08          	add    $0x8,%rax
+    159d:	89 10                	mov    %edx,(%rax)
+  return 0;
+    159f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    15a4:	5d                   	pop    %rbp
+    15a5:	c3                   	ret
+
+00000000000015a6 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    15a6:	b8 01 00 00 00       	mov    $0x1,%eax
+    15ab:	49 89 ca             	mov    %rcx,%r10
+    15ae:	0f 05                	syscall
+    15b0:	c3                   	ret
+
+00000000000015b1 <_exit>:
+SYSCALL_(exit)
+    15b1:	b8 02 00 00 00       	mov    $0x2,%eax
+    15b6:	49 89 ca             	mov    %rcx,%r10
+    15b9:	0f 05                	syscall
+    15bb:	c3                   	ret
+
+00000000000015bc <wait>:
+SYSCALL(wait)
+    15bc:	b8 03 00 00 00       	mov    $0x3,%eax
+    15c1:	49 89 ca             	mov    %rcx,%r10
+    15c4:	0f 05                	syscall
+    15c6:	c3                   	ret
+
+00000000000015c7 <pipe>:
+SYSCALL(pipe)
+    15c7:	b8 04 00 00 00       	mov    $0x4,%eax
+    15cc:	49 89 ca             	mov    %rcx,%r10
+    15cf:	0f 05                	syscall
+    15d1:	c3                   	ret
+
+00000000000015d2 <read>:
+SYSCALL(read)
+    15d2:	b8 05 00 00 00       	mov    $0x5,%eax
+    15d7:	49 89 ca             	mov    %rcx,%r10
+    15da:	0f 05                	syscall
+    15dc:	c3                   	ret
+
+00000000000015dd <write>:
+SYSCALL(write)
+    15dd:	b8 10 00 00 00       	mov    $0x10,%eax
+    15e2:	49 89 ca             	mov    %rcx,%r10
+    15e5:	0f 05                	syscall
+    15e7:	c3                   	ret
+
+00000000000015e8 <_close>:
+SYSCALL_(close)
+    15e8:	b8 15 00 00 00       	mov    $0x15,%eax
+    15ed:	49 89 ca             	mov    %rcx,%r10
+    15f0:	0f 05                	syscall
+    15f2:	c3                   	ret
+
+00000000000015f3 <kill>:
+SYSCALL(kill)
+    15f3:	b8 06 00 00 00       	mov    $0x6,%eax
+    15f8:	49 89 ca             	mov    %rcx,%r10
+    15fb:	0f 05                	syscall
+    15fd:	c3                   	ret
+
+00000000000015fe <_exec>:
+SYSCALL_(exec)
+    15fe:	b8 07 00 00 00       	mov    $0x7,%eax
+    1603:	49 89 ca             	mov    %rcx,%r10
+    1606:	0f 05                	syscall
+    1608:	c3                   	ret
+
+0000000000001609 <open>:
+SYSCALL(open)
+    1609:	b8 0f 00 00 00       	mov    $0xf,%eax
+    160e:	49 89 ca             	mov    %rcx,%r10
+    1611:	0f 05                	syscall
+    1613:	c3                   	ret
+
+0000000000001614 <mknod>:
+SYSCALL(mknod)
+    1614:	b8 11 00 00 00       	mov    $0x11,%eax
+    1619:	49 89 ca             	mov    %rcx,%r10
+    161c:	0f 05                	syscall
+    161e:	c3                   	ret
+
+000000000000161f <unlink>:
+SYSCALL(unlink)
+    161f:	b8 12 00 00 00       	mov    $0x12,%eax
+    1624:	49 89 ca             	mov    %rcx,%r10
+    1627:	0f 05                	syscall
+    1629:	c3                   	ret
+
+000000000000162a <fstat>:
+SYSCALL(fstat)
+    162a:	b8 08 00 00 00       	mov    $0x8,%eax
+    162f:	49 89 ca             	mov    %rcx,%r10
+    1632:	0f 05                	syscall
+    1634:	c3                   	ret
+
+0000000000001635 <link>:
+SYSCALL(link)
+    1635:	b8 13 00 00 00       	mov    $0x13,%eax
+    163a:	49 89 ca             	mov    %rcx,%r10
+    163d:	0f 05                	syscall
+    163f:	c3                   	ret
+
+0000000000001640 <mkdir>:
+SYSCALL(mkdir)
+    1640:	b8 14 00 00 00       	mov    $0x14,%eax
+    1645:	49 89 ca             	mov    %rcx,%r10
+    1648:	0f 05                	syscall
+    164a:	c3                   	ret
+
+000000000000164b <chdir>:
+SYSCALL(chdir)
+    164b:	b8 09 00 00 00       	mov    $0x9,%eax
+    1650:	49 89 ca             	mov    %rcx,%r10
+    1653:	0f 05                	syscall
+    1655:	c3                   	ret
+
+0000000000001656 <dup>:
+SYSCALL(dup)
+    1656:	b8 0a 00 00 00       	mov    $0xa,%eax
+    165b:	49 89 ca             	mov    %rcx,%r10
+    165e:	0f 05                	syscall
+    1660:	c3                   	ret
+
+0000000000001661 <getpid>:
+SYSCALL(getpid)
+    1661:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1666:	49 89 ca             	mov    %rcx,%r10
+    1669:	0f 05                	syscall
+    166b:	c3                   	ret
+
+000000000000166c <sbrk>:
+SYSCALL(sbrk)
+    166c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1671:	49 89 ca             	mov    %rcx,%r10
+    1674:	0f 05                	syscall
+    1676:	c3                   	ret
+
+0000000000001677 <sleep>:
+SYSCALL(sleep)
+    1677:	b8 0d 00 00 00       	mov    $0xd,%eax
+    167c:	49 89 ca             	mov    %rcx,%r10
+    167f:	0f 05                	syscall
+    1681:	c3                   	ret
+
+0000000000001682 <uptime>:
+SYSCALL(uptime)
+    1682:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1687:	49 89 ca             	mov    %rcx,%r10
+    168a:	0f 05                	syscall
+    168c:	c3                   	ret
+
+000000000000168d <sysinfo>:
+SYSCALL(sysinfo)
+    168d:	b8 16 00 00 00       	mov    $0x16,%eax
+    1692:	49 89 ca             	mov    %rcx,%r10
+    1695:	0f 05                	syscall
+    1697:	c3                   	ret
+
+0000000000001698 <crashn>:
+SYSCALL(crashn)
+    1698:	b8 17 00 00 00       	mov    $0x17,%eax
+    169d:	49 89 ca             	mov    %rcx,%r10
+    16a0:	0f 05                	syscall
+    16a2:	c3                   	ret
+
+00000000000016a3 <mmap>:
+SYSCALL(mmap)
+    16a3:	b8 18 00 00 00       	mov    $0x18,%eax
+    16a8:	49 89 ca             	mov    %rcx,%r10
+    16ab:	0f 05                	syscall
+    16ad:	c3                   	ret
+
+00000000000016ae <munmap>:
+SYSCALL(munmap)
+    16ae:	b8 19 00 00 00       	mov    $0x19,%eax
+    16b3:	49 89 ca             	mov    %rcx,%r10
+    16b6:	0f 05                	syscall
+    16b8:	c3                   	ret
+
+00000000000016b9 <nice>:
+SYSCALL(nice)
+    16b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16be:	49 89 ca             	mov    %rcx,%r10
+    16c1:	0f 05                	syscall
+    16c3:	c3                   	ret
+
+00000000000016c4 <_spawn>:
+SYSCALL_(spawn)
+    16c4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16c9:	49 89 ca             	mov    %rcx,%r10
+    16cc:	0f 05                	syscall
+    16ce:	c3                   	ret
+
+00000000000016cf <pread>:
+SYSCALL(pread)
+    16cf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16d4:	49 89 ca             	mov    %rcx,%r10
+    16d7:	0f 05                	syscall
+    16d9:	c3                   	ret
+
+00000000000016da <pwrite>:
+SYSCALL(pwrite)
+    16da:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16df:	49 89 ca             	mov    %rcx,%r10
+    16e2:	0f 05                	syscall
+    16e4:	c3                   	ret
+
+00000000000016e5 <readv>:
+SYSCALL(readv)
+    16e5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    16ea:	49 89 ca             	mov    %rcx,%r10
+    16ed:	0f 05                	syscall
+    16ef:	c3                   	ret
+
+00000000000016f0 <writev>:
+SYSCALL(writev)
+    16f0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    16f5:	49 89 ca             	mov    %rcx,%r10
+    16f8:	0f 05                	syscall
+    16fa:	c3                   	ret
+
+00000000000016fb <sendfile>:
+SYSCALL(sendfile)
+    16fb:	b8 20 00 00 00       	mov    $0x20,%eax
+    1700:	49 89 ca             	mov    %rcx,%r10
+    1703:	0f 05                	syscall
+    1705:	c3                   	ret
+
+0000000000001706 <splice>:
+SYSCALL(splice)
+    1706:	b8 21 00 00 00       	mov    $0x21,%eax
+    170b:	49 89 ca             	mov    %rcx,%r10
+    170e:	0f 05                	syscall
+    1710:	c3                   	ret
+
+0000000000001711 <poll>:
+SYSCALL(poll)
+    1711:	b8 22 00 00 00       	mov    $0x22,%eax
+    1716:	49 89 ca             	mov    %rcx,%r10
+    1719:	0f 05                	syscall
+    171b:	c3                   	ret
+
+000000000000171c <fsync>:
+SYSCALL(fsync)
+    171c:	b8 23 00 00 00       	mov    $0x23,%eax
+    1721:	49 89 ca             	mov    %rcx,%r10
+    1724:	0f 05                	syscall
+    1726:	c3                   	ret
+
+0000000000001727 <fdatasync>:
+SYSCALL(fdatasync)
+    1727:	b8 24 00 00 00       	mov    $0x24,%eax
+    172c:	49 89 ca             	mov    %rcx,%r10
+    172f:	0f 05                	syscall
+    1731:	c3                   	ret
+
+0000000000001732 <lockstat>:
+SYSCALL(lockstat)
+    1732:	b8 25 00 00 00       	mov    $0x25,%eax
+    1737:	49 89 ca             	mov    %rcx,%r10
+    173a:	0f 05                	syscall
+    173c:	c3                   	ret
+
+000000000000173d <syscallstat>:
+SYSCALL(syscallstat)
+    173d:	b8 26 00 00 00       	mov    $0x26,%eax
+    1742:	49 89 ca             	mov    %rcx,%r10
+    1745:	0f 05                	syscall
+    1747:	c3                   	ret
+
+0000000000001748 <trace>:
+SYSCALL(trace)
+    1748:	b8 27 00 00 00       	mov    $0x27,%eax
+    174d:	49 89 ca             	mov    %rcx,%r10
+    1750:	0f 05                	syscall
+    1752:	c3                   	ret
+
+0000000000001753 <profile>:
+SYSCALL(profile)
+    1753:	b8 28 00 00 00       	mov    $0x28,%eax
+    1758:	49 89 ca             	mov    %rcx,%r10
+    175b:	0f 05                	syscall
+    175d:	c3                   	ret
+
+000000000000175e <cycles>:
+SYSCALL(cycles)
+    175e:	b8 29 00 00 00       	mov    $0x29,%eax
+    1763:	49 89 ca             	mov    %rcx,%r10
+    1766:	0f 05                	syscall
+    1768:	c3                   	ret
+
+0000000000001769 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1769:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    176e:	49 89 ca             	mov    %rcx,%r10
+    1771:	0f 05                	syscall
+    1773:	c3                   	ret
+
+0000000000001774 <consmode>:
+SYSCALL(consmode)
+    1774:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1779:	49 89 ca             	mov    %rcx,%r10
+    177c:	0f 05                	syscall
+    177e:	c3                   	ret
+
+000000000000177f <clone>:
+SYSCALL(clone)
+    177f:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1784:	49 89 ca             	mov    %rcx,%r10
+    1787:	0f 05                	syscall
+    1789:	c3                   	ret
+
+000000000000178a <join>:
+SYSCALL(join)
+    178a:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    178f:	49 89 ca             	mov    %rcx,%r10
+    1792:	0f 05                	syscall
+    1794:	c3                   	ret
+
+0000000000001795 <futex_wait>:
+SYSCALL(futex_wait)
+    1795:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    179a:	49 89 ca             	mov    %rcx,%r10
+    179d:	0f 05                	syscall
+    179f:	c3                   	ret
+
+00000000000017a0 <futex_wake>:
+SYSCALL(futex_wake)
+    17a0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    17a5:	49 89 ca             	mov    %rcx,%r10
+    17a8:	0f 05                	syscall
+    17aa:	c3                   	ret
+
+00000000000017ab <shmget>:
+SYSCALL(shmget)
+    17ab:	b8 30 00 00 00       	mov    $0x30,%eax
+    17b0:	49 89 ca             	mov    %rcx,%r10
+    17b3:	0f 05                	syscall
+    17b5:	c3                   	ret
+
+00000000000017b6 <shmat>:
+SYSCALL(shmat)
+    17b6:	b8 31 00 00 00       	mov    $0x31,%eax
+    17bb:	49 89 ca             	mov    %rcx,%r10
+    17be:	0f 05                	syscall
+    17c0:	c3                   	ret
+
+00000000000017c1 <shmdt>:
+SYSCALL(shmdt)
+    17c1:	b8 32 00 00 00       	mov    $0x32,%eax
+    17c6:	49 89 ca             	mov    %rcx,%r10
+    17c9:	0f 05                	syscall
+    17cb:	c3                   	ret
+
+00000000000017cc <ring_setup>:
+SYSCALL(ring_setup)
+    17cc:	b8 33 00 00 00       	mov    $0x33,%eax
+    17d1:	49 89 ca             	mov    %rcx,%r10
+    17d4:	0f 05                	syscall
+    17d6:	c3                   	ret
+
+00000000000017d7 <ring_enter>:
+SYSCALL(ring_enter)
+    17d7:	b8 34 00 00 00       	mov    $0x34,%eax
+    17dc:	49 89 ca             	mov    %rcx,%r10
+    17df:	0f 05                	syscall
+    17e1:	c3                   	ret
+
+00000000000017e2 <getdents>:
+SYSCALL(getdents)
+    17e2:	b8 35 00 00 00       	mov    $0x35,%eax
+    17e7:	49 89 ca             	mov    %rcx,%r10
+    17ea:	0f 05                	syscall
+    17ec:	c3                   	ret
+
+00000000000017ed <fstatat>:
+SYSCALL(fstatat)
+    17ed:	b8 36 00 00 00       	mov    $0x36,%eax
+    17f2:	49 89 ca             	mov    %rcx,%r10
+    17f5:	0f 05                	syscall
+    17f7:	c3                   	ret
+
+00000000000017f8 <clone_file>:
+SYSCALL(clone_file)
+    17f8:	b8 37 00 00 00       	mov    $0x37,%eax
+    17fd:	49 89 ca             	mov    %rcx,%r10
+    1800:	0f 05                	syscall
+    1802:	c3                   	ret
+
+0000000000001803 <fpunch>:
+SYSCALL(fpunch)
+    1803:	b8 38 00 00 00       	mov    $0x38,%eax
+    1808:	49 89 ca             	mov    %rcx,%r10
+    180b:	0f 05                	syscall
+    180d:	c3                   	ret
+
+000000000000180e <defrag>:
+SYSCALL(defrag)
+    180e:	b8 39 00 00 00       	mov    $0x39,%eax
+    1813:	49 89 ca             	mov    %rcx,%r10
+    1816:	0f 05                	syscall
+    1818:	c3                   	ret
+
+0000000000001819 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1819:	55                   	push   %rbp
+    181a:	48 89 e5             	mov    %rsp,%rbp
+    181d:	48 83 ec 20          	sub    $0x20,%rsp
+    1821:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1825:	bf 00 00 00 00       	mov    $0x0,%edi
+    182a:	e8 3d fe ff ff       	call   166c <sbrk>
+    182f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1833:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1837:	48 f7 d8             	neg    %rax
+    183a:	25 ff 0f 00 00       	and    $0xfff,%eax
+    183f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1843:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1847:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    184b:	48 01 c2             	add    %rax,%rdx
+    184e:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1853:	48 39 c2             	cmp    %rax,%rdx
+    1856:	73 1e                	jae    1876 <morecore+0x5d>
+    1858:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    185c:	89 c2                	mov    %eax,%edx
+    185e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1862:	01 d0                	add    %edx,%eax
+    1864:	89 c7                	mov    %eax,%edi
+    1866:	e8 01 fe ff ff       	call   166c <sbrk>
+    186b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    186f:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1874:	75 07                	jne    187d <morecore+0x64>
+    return 0;
+    1876:	b8 00 00 00 00       	mov    $0x0,%eax
+    187b:	eb 27                	jmp    18a4 <morecore+0x8b>
+  stats.heap += n + pad;
+    187d:	48 8b 05 0c 29 00 00 	mov    0x290c(%rip),%rax        # 4190 <stats+0x50>
+    1884:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1888:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    188c:	48 01 ca             	add    %rcx,%rdx
+    188f:	48 01 d0             	add    %rdx,%rax
+    1892:	48 89 05 f7 28 00 00 	mov    %rax,0x28f7(%rip)        # 4190 <stats+0x50>
+  return p + pad;
+    1899:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    189d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a1:	48 01 d0             	add    %rdx,%rax
+}
+    18a4:	c9                   	leave
+    18a5:	c3                   	ret
+
+00000000000018a6 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    18a6:	55                   	push   %rbp
+    18a7:	48 89 e5             	mov    %rsp,%rbp
+    18aa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    18ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    18b2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    18b9:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    18ba:	48 8d 05 5f 28 00 00 	lea    0x285f(%rip),%rax        # 4120 <runs>
+    18c1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18c5:	eb 1a                	jmp    18e1 <pagefree+0x3b>
+    prev = *rp;
+    18c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18cb:	48 8b 00             	mov    (%rax),%rax
+    18ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    18d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18d6:	48 8b 00             	mov    (%rax),%rax
+    18d9:	48 83 c0 08          	add    $0x8,%rax
+    18dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e5:	48 8b 00             	mov    (%rax),%rax
+    18e8:	48 85 c0             	test   %rax,%rax
+    18eb:	74 0d                	je     18fa <pagefree+0x54>
+    18ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f1:	48 8b 00             	mov    (%rax),%rax
+    18f4:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    18f8:	72 cd                	jb     18c7 <pagefree+0x21>
+  r = (struct run *)p;
+    18fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18fe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1906:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    190a:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    190d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1911:	48 8b 10             	mov    (%rax),%rdx
+    1914:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1918:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    191c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1920:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1924:	48 85 c0             	test   %rax,%rax
+    1927:	74 48                	je     1971 <pagefree+0xcb>
+    1929:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    192d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1931:	48 01 c2             	add    %rax,%rdx
+    1934:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1938:	48 8b 40 08          	mov    0x8(%rax),%rax
+    193c:	48 39 c2             	cmp    %rax,%rdx
+    193f:	75 30                	jne    1971 <pagefree+0xcb>
+    r->size += r->next->size;
+    1941:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1945:	48 8b 10             	mov    (%rax),%rdx
+    1948:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    194c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1950:	48 8b 00             	mov    (%rax),%rax
+    1953:	48 01 c2             	add    %rax,%rdx
+    1956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    195a:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    195d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1961:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1965:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    196d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1971:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1976:	74 46                	je     19be <pagefree+0x118>
+    1978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    197c:	48 8b 10             	mov    (%rax),%rdx
+    197f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1983:	48 01 d0             	add    %rdx,%rax
+    1986:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    198a:	75 32                	jne    19be <pagefree+0x118>
+    prev->size += r->size;
+    198c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1990:	48 8b 10             	mov    (%rax),%rdx
+    1993:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1997:	48 8b 00             	mov    (%rax),%rax
+    199a:	48 01 c2             	add    %rax,%rdx
+    199d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19a1:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    19a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19a8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    19ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19b0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    19b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19b8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    19bc:	eb 0c                	jmp    19ca <pagefree+0x124>
+  } else {
+    *rp = r;
+    19be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    19c6:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    19c9:	90                   	nop
+    19ca:	90                   	nop
+    19cb:	5d                   	pop    %rbp
+    19cc:	c3                   	ret
+
+00000000000019cd <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    19cd:	55                   	push   %rbp
+    19ce:	48 89 e5             	mov    %rsp,%rbp
+    19d1:	48 83 ec 40          	sub    $0x40,%rsp
+    19d5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    19d9:	48 8d 05 40 27 00 00 	lea    0x2740(%rip),%rax        # 4120 <runs>
+    19e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    19e4:	eb 66                	jmp    1a4c <pagealloc+0x7f>
+    if (r->size == n) {
+    19e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19ea:	48 8b 00             	mov    (%rax),%rax
+    19ed:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    19f1:	75 18                	jne    1a0b <pagealloc+0x3e>
+      *rp = r->next;
+    19f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19f7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    19fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ff:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a06:	e9 ca 00 00 00       	jmp    1ad5 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1a0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a0f:	48 8b 00             	mov    (%rax),%rax
+    1a12:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1a16:	73 28                	jae    1a40 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1a18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a1c:	48 8b 00             	mov    (%rax),%rax
+    1a1f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1a23:	48 89 c2             	mov    %rax,%rdx
+    1a26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a2a:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1a2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a31:	48 8b 10             	mov    (%rax),%rdx
+    1a34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a38:	48 01 d0             	add    %rdx,%rax
+    1a3b:	e9 95 00 00 00       	jmp    1ad5 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1a40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a44:	48 83 c0 08          	add    $0x8,%rax
+    1a48:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a50:	48 8b 00             	mov    (%rax),%rax
+    1a53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a57:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1a5c:	75 88                	jne    19e6 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1a5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1a62:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1a66:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1a6d:	00 
+    1a6e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a76:	48 39 c2             	cmp    %rax,%rdx
+    1a79:	48 0f 43 c2          	cmovae %rdx,%rax
+    1a7d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1a81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1a85:	48 89 c7             	mov    %rax,%rdi
+    1a88:	e8 8c fd ff ff       	call   1819 <morecore>
+    1a8d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1a91:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1a96:	75 07                	jne    1a9f <pagealloc+0xd2>
+    return 0;
+    1a98:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a9d:	eb 36                	jmp    1ad5 <pagealloc+0x108>
+  if (m > n)
+    1a9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1aa3:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1aa7:	73 1a                	jae    1ac3 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1aa9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1aad:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1ab1:	48 89 c2             	mov    %rax,%rdx
+    1ab4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1ab8:	48 89 d6             	mov    %rdx,%rsi
+    1abb:	48 89 c7             	mov    %rax,%rdi
+    1abe:	e8 e3 fd ff ff       	call   18a6 <pagefree>
+  return p + m - n;
+    1ac3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ac7:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1acb:	48 89 c2             	mov    %rax,%rdx
+    1ace:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1ad2:	48 01 d0             	add    %rdx,%rax
+}
+    1ad5:	c9                   	leave
+    1ad6:	c3                   	ret
+
+0000000000001ad7 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1ad7:	55                   	push   %rbp
+    1ad8:	48 89 e5             	mov    %rsp,%rbp
+    1adb:	48 83 ec 30          	sub    $0x30,%rsp
+    1adf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1ae2:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1ae7:	e8 e1 fe ff ff       	call   19cd <pagealloc>
+    1aec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1af0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1af5:	75 0a                	jne    1b01 <refill+0x2a>
+    return -1;
+    1af7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1afc:	e9 da 00 00 00       	jmp    1bdb <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1b01:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1b08:	00 
+    1b09:	e9 ba 00 00 00       	jmp    1bc8 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1b0e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b16:	48 01 d0             	add    %rdx,%rax
+    1b19:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1b1d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b20:	ba 20 00 00 00       	mov    $0x20,%edx
+    1b25:	89 c1                	mov    %eax,%ecx
+    1b27:	48 d3 e2             	shl    %cl,%rdx
+    1b2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b2e:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1b31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b34:	48 63 d0             	movslq %eax,%rdx
+    1b37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b3b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1b3f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b42:	48 98                	cltq
+    1b44:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b4b:	00 
+    1b4c:	48 8d 05 8d 25 00 00 	lea    0x258d(%rip),%rax        # 40e0 <freelist>
+    1b53:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b5b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1b5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b62:	48 98                	cltq
+    1b64:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b6b:	00 
+    1b6c:	48 8d 15 6d 25 00 00 	lea    0x256d(%rip),%rdx        # 40e0 <freelist>
+    1b73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b77:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1b7b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b7e:	48 98                	cltq
+    1b80:	48 83 c0 08          	add    $0x8,%rax
+    1b84:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b8b:	00 
+    1b8c:	48 8d 05 b1 25 00 00 	lea    0x25b1(%rip),%rax        # 4144 <stats+0x4>
+    1b93:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b96:	8d 48 01             	lea    0x1(%rax),%ecx
+    1b99:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b9c:	48 98                	cltq
+    1b9e:	48 83 c0 08          	add    $0x8,%rax
+    1ba2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ba9:	00 
+    1baa:	48 8d 05 93 25 00 00 	lea    0x2593(%rip),%rax        # 4144 <stats+0x4>
+    1bb1:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1bb4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bb7:	ba 20 00 00 00       	mov    $0x20,%edx
+    1bbc:	89 c1                	mov    %eax,%ecx
+    1bbe:	48 d3 e2             	shl    %cl,%rdx
+    1bc1:	48 89 d0             	mov    %rdx,%rax
+    1bc4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1bc8:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1bcf:	00 
+    1bd0:	0f 86 38 ff ff ff    	jbe    1b0e <refill+0x37>
+  }
+  return 0;
+    1bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1bdb:	c9                   	leave
+    1bdc:	c3                   	ret
+
+0000000000001bdd <malloc>:
+
+void *malloc(uint nbytes) {
+    1bdd:	55                   	push   %rbp
+    1bde:	48 89 e5             	mov    %rsp,%rbp
+    1be1:	48 83 ec 30          	sub    $0x30,%rsp
+    1be5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1be8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1beb:	48 83 c0 10          	add    $0x10,%rax
+    1bef:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1bf3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1bfa:	eb 04                	jmp    1c00 <malloc+0x23>
+    1bfc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1c00:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1c04:	7f 16                	jg     1c1c <malloc+0x3f>
+    1c06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c09:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c0e:	89 c1                	mov    %eax,%ecx
+    1c10:	48 d3 e2             	shl    %cl,%rdx
+    1c13:	48 89 d0             	mov    %rdx,%rax
+    1c16:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1c1a:	72 e0                	jb     1bfc <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1c1c:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1c20:	75 7d                	jne    1c9f <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1c22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c26:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1c2c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1c32:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1c36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c3a:	48 89 c7             	mov    %rax,%rdi
+    1c3d:	e8 8b fd ff ff       	call   19cd <pagealloc>
+    1c42:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1c46:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1c4b:	75 0a                	jne    1c57 <malloc+0x7a>
+      return 0;
+    1c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c52:	e9 2c 01 00 00       	jmp    1d83 <malloc+0x1a6>
+    h->size = n;
+    1c57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c5b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1c5f:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1c62:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c66:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1c6d:	00 
+    stats.inuse[LARGE]++;
+    1c6e:	8b 05 ec 24 00 00    	mov    0x24ec(%rip),%eax        # 4160 <stats+0x20>
+    1c74:	83 c0 01             	add    $0x1,%eax
+    1c77:	89 05 e3 24 00 00    	mov    %eax,0x24e3(%rip)        # 4160 <stats+0x20>
+    stats.large += n;
+    1c7d:	48 8b 15 04 25 00 00 	mov    0x2504(%rip),%rdx        # 4188 <stats+0x48>
+    1c84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c88:	48 01 d0             	add    %rdx,%rax
+    1c8b:	48 89 05 f6 24 00 00 	mov    %rax,0x24f6(%rip)        # 4188 <stats+0x48>
+    return h + 1;
+    1c92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c96:	48 83 c0 10          	add    $0x10,%rax
+    1c9a:	e9 e4 00 00 00       	jmp    1d83 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1c9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ca2:	48 98                	cltq
+    1ca4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cab:	00 
+    1cac:	48 8d 05 2d 24 00 00 	lea    0x242d(%rip),%rax        # 40e0 <freelist>
+    1cb3:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1cb7:	48 85 c0             	test   %rax,%rax
+    1cba:	75 18                	jne    1cd4 <malloc+0xf7>
+    1cbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cbf:	89 c7                	mov    %eax,%edi
+    1cc1:	e8 11 fe ff ff       	call   1ad7 <refill>
+    1cc6:	85 c0                	test   %eax,%eax
+    1cc8:	79 0a                	jns    1cd4 <malloc+0xf7>
+    return 0;
+    1cca:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ccf:	e9 af 00 00 00       	jmp    1d83 <malloc+0x1a6>
+  b = freelist[c];
+    1cd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cd7:	48 98                	cltq
+    1cd9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ce0:	00 
+    1ce1:	48 8d 05 f8 23 00 00 	lea    0x23f8(%rip),%rax        # 40e0 <freelist>
+    1ce8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1cec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1cf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cf4:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1cf8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1cfb:	48 63 d2             	movslq %edx,%rdx
+    1cfe:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d05:	00 
+    1d06:	48 8d 15 d3 23 00 00 	lea    0x23d3(%rip),%rdx        # 40e0 <freelist>
+    1d0d:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1d11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d14:	48 98                	cltq
+    1d16:	48 83 c0 08          	add    $0x8,%rax
+    1d1a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d21:	00 
+    1d22:	48 8d 05 1b 24 00 00 	lea    0x241b(%rip),%rax        # 4144 <stats+0x4>
+    1d29:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d2c:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1d2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d32:	48 98                	cltq
+    1d34:	48 83 c0 08          	add    $0x8,%rax
+    1d38:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d3f:	00 
+    1d40:	48 8d 05 fd 23 00 00 	lea    0x23fd(%rip),%rax        # 4144 <stats+0x4>
+    1d47:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1d4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d4d:	48 98                	cltq
+    1d4f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d56:	00 
+    1d57:	48 8d 05 e2 23 00 00 	lea    0x23e2(%rip),%rax        # 4140 <stats>
+    1d5e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d61:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d67:	48 98                	cltq
+    1d69:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d70:	00 
+    1d71:	48 8d 05 c8 23 00 00 	lea    0x23c8(%rip),%rax        # 4140 <stats>
+    1d78:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1d7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d7f:	48 83 c0 10          	add    $0x10,%rax
+}
+    1d83:	c9                   	leave
+    1d84:	c3                   	ret
+
+0000000000001d85 <free>:
+
+void free(void *ap) {
+    1d85:	55                   	push   %rbp
+    1d86:	48 89 e5             	mov    %rsp,%rbp
+    1d89:	48 83 ec 18          	sub    $0x18,%rsp
+    1d8d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1d91:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1d96:	0f 84 03 01 00 00    	je     1e9f <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1d9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1da0:	48 83 e8 10          	sub    $0x10,%rax
+    1da4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1da8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dac:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1db0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1db4:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1db9:	75 42                	jne    1dfd <free+0x78>
+    stats.inuse[LARGE]--;
+    1dbb:	8b 05 9f 23 00 00    	mov    0x239f(%rip),%eax        # 4160 <stats+0x20>
+    1dc1:	83 e8 01             	sub    $0x1,%eax
+    1dc4:	89 05 96 23 00 00    	mov    %eax,0x2396(%rip)        # 4160 <stats+0x20>
+    stats.large -= b->h.size;
+    1dca:	48 8b 15 b7 23 00 00 	mov    0x23b7(%rip),%rdx        # 4188 <stats+0x48>
+    1dd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd5:	48 8b 00             	mov    (%rax),%rax
+    1dd8:	48 29 c2             	sub    %rax,%rdx
+    1ddb:	48 89 15 a6 23 00 00 	mov    %rdx,0x23a6(%rip)        # 4188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1de2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de6:	48 8b 10             	mov    (%rax),%rdx
+    1de9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ded:	48 89 d6             	mov    %rdx,%rsi
+    1df0:	48 89 c7             	mov    %rax,%rdi
+    1df3:	e8 ae fa ff ff       	call   18a6 <pagefree>
+    return;
+    1df8:	e9 a3 00 00 00       	jmp    1ea0 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1dfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e01:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e08:	00 
+    1e09:	48 8d 05 d0 22 00 00 	lea    0x22d0(%rip),%rax        # 40e0 <freelist>
+    1e10:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1e14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e18:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1e1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e20:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1e27:	00 
+    1e28:	48 8d 15 b1 22 00 00 	lea    0x22b1(%rip),%rdx        # 40e0 <freelist>
+    1e2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e33:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1e37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e3b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e42:	00 
+    1e43:	48 8d 05 f6 22 00 00 	lea    0x22f6(%rip),%rax        # 4140 <stats>
+    1e4a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e4d:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1e50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e54:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e5b:	00 
+    1e5c:	48 8d 05 dd 22 00 00 	lea    0x22dd(%rip),%rax        # 4140 <stats>
+    1e63:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1e66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e6a:	48 83 c0 08          	add    $0x8,%rax
+    1e6e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e75:	00 
+    1e76:	48 8d 05 c7 22 00 00 	lea    0x22c7(%rip),%rax        # 4144 <stats+0x4>
+    1e7d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e80:	8d 48 01             	lea    0x1(%rax),%ecx
+    1e83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e87:	48 83 c0 08          	add    $0x8,%rax
+    1e8b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e92:	00 
+    1e93:	48 8d 05 aa 22 00 00 	lea    0x22aa(%rip),%rax        # 4144 <stats+0x4>
+    1e9a:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1e9d:	eb 01                	jmp    1ea0 <free+0x11b>
+    return;
+    1e9f:	90                   	nop
+}
+    1ea0:	c9                   	leave
+    1ea1:	c3                   	ret
+
+0000000000001ea2 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1ea2:	55                   	push   %rbp
+    1ea3:	48 89 e5             	mov    %rsp,%rbp
+    1ea6:	48 83 ec 30          	sub    $0x30,%rsp
+    1eaa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1ead:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1eb0:	48 8d 15 e1 02 00 00 	lea    0x2e1(%rip),%rdx        # 2198 <benchreport+0x1ce>
+    1eb7:	48 89 d6             	mov    %rdx,%rsi
+    1eba:	89 c7                	mov    %eax,%edi
+    1ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ec1:	e8 37 e6 ff ff       	call   4fd <printf>
+  for (c = 0; c < NCLASS; c++)
+    1ec6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1ecd:	eb 67                	jmp    1f36 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1ecf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ed2:	48 98                	cltq
+    1ed4:	48 83 c0 08          	add    $0x8,%rax
+    1ed8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1edf:	00 
+    1ee0:	48 8d 05 5d 22 00 00 	lea    0x225d(%rip),%rax        # 4144 <stats+0x4>
+    1ee7:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1eea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1eed:	48 98                	cltq
+    1eef:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ef6:	00 
+    1ef7:	48 8d 05 42 22 00 00 	lea    0x2242(%rip),%rax        # 4140 <stats>
+    1efe:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1f01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f04:	ba 20 00 00 00       	mov    $0x20,%edx
+    1f09:	89 c1                	mov    %eax,%ecx
+    1f0b:	48 d3 e2             	shl    %cl,%rdx
+    1f0e:	48 89 d0             	mov    %rdx,%rax
+    1f11:	89 c1                	mov    %eax,%ecx
+    1f13:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1f16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f19:	41 89 f9             	mov    %edi,%r9d
+    1f1c:	41 89 f0             	mov    %esi,%r8d
+    1f1f:	48 8d 35 89 02 00 00 	lea    0x289(%rip),%rsi        # 21af <benchreport+0x1e5>
+    1f26:	89 c7                	mov    %eax,%edi
+    1f28:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f2d:	e8 cb e5 ff ff       	call   4fd <printf>
+  for (c = 0; c < NCLASS; c++)
+    1f32:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1f36:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1f3a:	7e 93                	jle    1ecf <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1f3c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1f43:	00 
+  for (r = runs; r; r = r->next)
+    1f44:	48 8b 05 d5 21 00 00 	mov    0x21d5(%rip),%rax        # 4120 <runs>
+    1f4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f4f:	eb 17                	jmp    1f68 <mallocstats+0xc6>
+    nfree += r->size;
+    1f51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f55:	48 8b 00             	mov    (%rax),%rax
+    1f58:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1f5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f60:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f68:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1f6d:	75 e2                	jne    1f51 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1f6f:	48 8b 05 1a 22 00 00 	mov    0x221a(%rip),%rax        # 4190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f76:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1f78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f80:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1f82:	48 8b 05 ff 21 00 00 	mov    0x21ff(%rip),%rax        # 4188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f89:	89 c1                	mov    %eax,%ecx
+    1f8b:	8b 15 cf 21 00 00    	mov    0x21cf(%rip),%edx        # 4160 <stats+0x20>
+    1f91:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f94:	41 89 f9             	mov    %edi,%r9d
+    1f97:	41 89 f0             	mov    %esi,%r8d
+    1f9a:	48 8d 35 1f 02 00 00 	lea    0x21f(%rip),%rsi        # 21c0 <benchreport+0x1f6>
+    1fa1:	89 c7                	mov    %eax,%edi
+    1fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fa8:	e8 50 e5 ff ff       	call   4fd <printf>
+}
+    1fad:	90                   	nop
+    1fae:	c9                   	leave
+    1faf:	c3                   	ret
+
+0000000000001fb0 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1fb0:	55                   	push   %rbp
+    1fb1:	48 89 e5             	mov    %rsp,%rbp
+    1fb4:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1fb8:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1fbc:	48 89 c7             	mov    %rax,%rdi
+    1fbf:	e8 9a f7 ff ff       	call   175e <cycles>
+  return t;
+    1fc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1fc8:	c9                   	leave
+    1fc9:	c3                   	ret
+
+0000000000001fca <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1fca:	55                   	push   %rbp
+    1fcb:	48 89 e5             	mov    %rsp,%rbp
+    1fce:	48 83 ec 30          	sub    $0x30,%rsp
+    1fd2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fd6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1fda:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1fdd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1fe1:	0f 8e 24 01 00 00    	jle    210b <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1fe7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1fee:	e9 98 00 00 00       	jmp    208b <benchreport+0xc1>
+    x = t[i];
+    1ff3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ff6:	48 98                	cltq
+    1ff8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1fff:	00 
+    2000:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2004:	48 01 d0             	add    %rdx,%rax
+    2007:	48 8b 00             	mov    (%rax),%rax
+    200a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    200e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2011:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2014:	eb 33                	jmp    2049 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    2016:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2019:	48 98                	cltq
+    201b:	48 c1 e0 03          	shl    $0x3,%rax
+    201f:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2023:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2027:	48 01 d0             	add    %rdx,%rax
+    202a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    202d:	48 63 d2             	movslq %edx,%rdx
+    2030:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2037:	00 
+    2038:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    203c:	48 01 ca             	add    %rcx,%rdx
+    203f:	48 8b 00             	mov    (%rax),%rax
+    2042:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2045:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    2049:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    204d:	7e 1d                	jle    206c <benchreport+0xa2>
+    204f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2052:	48 98                	cltq
+    2054:	48 c1 e0 03          	shl    $0x3,%rax
+    2058:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    205c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2060:	48 01 d0             	add    %rdx,%rax
+    2063:	48 8b 00             	mov    (%rax),%rax
+    2066:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    206a:	72 aa                	jb     2016 <benchreport+0x4c>
+    t[j] = x;
+    206c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    206f:	48 98                	cltq
+    2071:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2078:	00 
+    2079:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    207d:	48 01 c2             	add    %rax,%rdx
+    2080:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2084:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    2087:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    208b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    208e:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2091:	0f 8c 5c ff ff ff    	jl     1ff3 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    2097:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    209a:	48 98                	cltq
+    209c:	48 c1 e0 03          	shl    $0x3,%rax
+    20a0:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    20a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20a8:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    20ab:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    20ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20b1:	89 c2                	mov    %eax,%edx
+    20b3:	c1 ea 1f             	shr    $0x1f,%edx
+    20b6:	01 d0                	add    %edx,%eax
+    20b8:	d1 f8                	sar    %eax
+    20ba:	48 98                	cltq
+    20bc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    20c3:	00 
+    20c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20c8:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    20cb:	48 8b 38             	mov    (%rax),%rdi
+    20ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20d2:	48 8b 30             	mov    (%rax),%rsi
+    20d5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    20d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20dc:	48 83 ec 08          	sub    $0x8,%rsp
+    20e0:	51                   	push   %rcx
+    20e1:	49 89 f9             	mov    %rdi,%r9
+    20e4:	49 89 f0             	mov    %rsi,%r8
+    20e7:	89 d1                	mov    %edx,%ecx
+    20e9:	48 89 c2             	mov    %rax,%rdx
+    20ec:	48 8d 05 0d 01 00 00 	lea    0x10d(%rip),%rax        # 2200 <benchreport+0x236>
+    20f3:	48 89 c6             	mov    %rax,%rsi
+    20f6:	bf 01 00 00 00       	mov    $0x1,%edi
+    20fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    2100:	e8 f8 e3 ff ff       	call   4fd <printf>
+    2105:	48 83 c4 10          	add    $0x10,%rsp
+    2109:	eb 01                	jmp    210c <benchreport+0x142>
+    return;
+    210b:	90                   	nop
+}
+    210c:	c9                   	leave
+    210d:	c3                   	ret
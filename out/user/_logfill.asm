@@ -0,0 +1,3443 @@
+
+out/user/_logfill:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+// logfill n writes n blocks to a file and commits them with fsync(),
+// which leaves them in the log until it next checkpoints, then makes
+// the very next disk write crash the machine.  The next boot has to
+// recover them; crash_safety_test.py --recovery times it.
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+       b:	89 bd ec fd ff ff    	mov    %edi,-0x214(%rbp)
+      11:	48 89 b5 e0 fd ff ff 	mov    %rsi,-0x220(%rbp)
+  char buf[BSIZE];
+  int fd, n, i;
+
+  if (argc != 2 || (n = atoi(argv[1])) < 0) {
+      18:	83 bd ec fd ff ff 02 	cmpl   $0x2,-0x214(%rbp)
+      1f:	75 1f                	jne    40 <main+0x40>
+      21:	48 8b 85 e0 fd ff ff 	mov    -0x220(%rbp),%rax
+      28:	48 83 c0 08          	add    $0x8,%rax
+      2c:	48 8b 00             	mov    (%rax),%rax
+      2f:	48 89 c7             	mov    %rax,%rdi
+      32:	e8 a8 0e 00 00       	call   edf <atoi>
+      37:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      3a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      3e:	79 1e                	jns    5e <main+0x5e>
+    printf(2, "usage: logfill nblocks\n");
+      40:	48 8d 05 11 1f 00 00 	lea    0x1f11(%rip),%rax        # 1f58 <benchreport+0x146>
+      47:	48 89 c6             	mov    %rax,%rsi
+      4a:	bf 02 00 00 00       	mov    $0x2,%edi
+      4f:	b8 00 00 00 00       	mov    $0x0,%eax
+      54:	e8 ec 02 00 00       	call   345 <printf>
+    exit();
+      59:	e8 17 09 00 00       	call   975 <exit>
+  }
+  unlink("logfill.dat");
+      5e:	48 8d 05 0b 1f 00 00 	lea    0x1f0b(%rip),%rax        # 1f70 <benchreport+0x15e>
+      65:	48 89 c7             	mov    %rax,%rdi
+      68:	e8 fa 13 00 00       	call   1467 <unlink>
+  if ((fd = open("logfill.dat", O_CREATE | O_RDWR)) < 0) {
+      6d:	be 02 02 00 00       	mov    $0x202,%esi
+      72:	48 8d 05 f7 1e 00 00 	lea    0x1ef7(%rip),%rax        # 1f70 <benchreport+0x15e>
+      79:	48 89 c7             	mov    %rax,%rdi
+      7c:	e8 d0 13 00 00       	call   1451 <open>
+      81:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      84:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+      88:	79 1e                	jns    a8 <main+0xa8>
+    printf(2, "logfill: cannot create logfill.dat\n");
+      8a:	48 8d 05 ef 1e 00 00 	lea    0x1eef(%rip),%rax        # 1f80 <benchreport+0x16e>
+      91:	48 89 c6             	mov    %rax,%rsi
+      94:	bf 02 00 00 00       	mov    $0x2,%edi
+      99:	b8 00 00 00 00       	mov    $0x0,%eax
+      9e:	e8 a2 02 00 00       	call   345 <printf>
+    exit();
+      a3:	e8 cd 08 00 00       	call   975 <exit>
+  }
+  memset(buf, 'l', sizeof(buf));
+      a8:	48 8d 85 f4 fd ff ff 	lea    -0x20c(%rbp),%rax
+      af:	ba 00 02 00 00       	mov    $0x200,%edx
+      b4:	be 6c 00 00 00       	mov    $0x6c,%esi
+      b9:	48 89 c7             	mov    %rax,%rdi
+      bc:	e8 a6 0c 00 00       	call   d67 <memset>
+  for (i = 0; i < n; i++)
+      c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      c8:	eb 42                	jmp    10c <main+0x10c>
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf)) {
+      ca:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+      d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      d4:	ba 00 02 00 00       	mov    $0x200,%edx
+      d9:	48 89 ce             	mov    %rcx,%rsi
+      dc:	89 c7                	mov    %eax,%edi
+      de:	e8 42 13 00 00       	call   1425 <write>
+      e3:	3d 00 02 00 00       	cmp    $0x200,%eax
+      e8:	74 1e                	je     108 <main+0x108>
+      printf(2, "logfill: write failed\n");
+      ea:	48 8d 05 b3 1e 00 00 	lea    0x1eb3(%rip),%rax        # 1fa4 <benchreport+0x192>
+      f1:	48 89 c6             	mov    %rax,%rsi
+      f4:	bf 02 00 00 00       	mov    $0x2,%edi
+      f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fe:	e8 42 02 00 00       	call   345 <printf>
+      exit();
+     103:	e8 6d 08 00 00       	call   975 <exit>
+  for (i = 0; i < n; i++)
+     108:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     10c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     10f:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     112:	7c b6                	jl     ca <main+0xca>
+    }
+  fsync(fd);
+     114:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     117:	89 c7                	mov    %eax,%edi
+     119:	e8 46 14 00 00       	call   1564 <fsync>
+  printf(1, "logfill: %d blocks committed, crashing\n", n);
+     11e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     121:	89 c2                	mov    %eax,%edx
+     123:	48 8d 05 96 1e 00 00 	lea    0x1e96(%rip),%rax        # 1fc0 <benchreport+0x1ae>
+     12a:	48 89 c6             	mov    %rax,%rsi
+     12d:	bf 01 00 00 00       	mov    $0x1,%edi
+     132:	b8 00 00 00 00       	mov    $0x0,%eax
+     137:	e8 09 02 00 00       	call   345 <printf>
+  crashn(0);
+     13c:	bf 00 00 00 00       	mov    $0x0,%edi
+     141:	e8 9a 13 00 00       	call   14e0 <crashn>
+  write(fd, buf, 1);
+     146:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     14d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     150:	ba 01 00 00 00       	mov    $0x1,%edx
+     155:	48 89 ce             	mov    %rcx,%rsi
+     158:	89 c7                	mov    %eax,%edi
+     15a:	e8 c6 12 00 00       	call   1425 <write>
+  fsync(fd);
+     15f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     162:	89 c7                	mov    %eax,%edi
+     164:	e8 fb 13 00 00       	call   1564 <fsync>
+  printf(2, "logfill: did not crash\n");
+     169:	48 8d 05 78 1e 00 00 	lea    0x1e78(%rip),%rax        # 1fe8 <benchreport+0x1d6>
+     170:	48 89 c6             	mov    %rax,%rsi
+     173:	bf 02 00 00 00       	mov    $0x2,%edi
+     178:	b8 00 00 00 00       	mov    $0x0,%eax
+     17d:	e8 c3 01 00 00       	call   345 <printf>
+  exit();
+     182:	e8 ee 07 00 00       	call   975 <exit>
+
+0000000000000187 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     187:	55                   	push   %rbp
+     188:	48 89 e5             	mov    %rsp,%rbp
+     18b:	48 83 ec 10          	sub    $0x10,%rsp
+     18f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     192:	89 f0                	mov    %esi,%eax
+     194:	88 45 f8             	mov    %al,-0x8(%rbp)
+     197:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     19b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     19e:	89 d6                	mov    %edx,%esi
+     1a0:	89 c7                	mov    %eax,%edi
+     1a2:	e8 eb 06 00 00       	call   892 <bputc>
+     1a7:	90                   	nop
+     1a8:	c9                   	leave
+     1a9:	c3                   	ret
+
+00000000000001aa <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     1aa:	55                   	push   %rbp
+     1ab:	48 89 e5             	mov    %rsp,%rbp
+     1ae:	48 83 ec 50          	sub    $0x50,%rsp
+     1b2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     1b5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     1b9:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     1bc:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     1bf:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     1c3:	74 21                	je     1e6 <printint64+0x3c>
+     1c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1c9:	48 c1 e8 3f          	shr    $0x3f,%rax
+     1cd:	0f b6 c0             	movzbl %al,%eax
+     1d0:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     1d3:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     1d7:	74 0d                	je     1e6 <printint64+0x3c>
+    x = -xx;
+     1d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1dd:	48 f7 d8             	neg    %rax
+     1e0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     1e4:	eb 08                	jmp    1ee <printint64+0x44>
+  else
+    x = xx;
+     1e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     1ee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1f5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     1f8:	48 63 c8             	movslq %eax,%rcx
+     1fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1ff:	ba 00 00 00 00       	mov    $0x0,%edx
+     204:	48 f7 f1             	div    %rcx
+     207:	48 89 d1             	mov    %rdx,%rcx
+     20a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     20d:	8d 50 01             	lea    0x1(%rax),%edx
+     210:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     213:	48 8d 15 e6 2d 00 00 	lea    0x2de6(%rip),%rdx        # 3000 <digits.1>
+     21a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     21e:	48 98                	cltq
+     220:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     224:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     227:	48 63 f0             	movslq %eax,%rsi
+     22a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     22e:	ba 00 00 00 00       	mov    $0x0,%edx
+     233:	48 f7 f6             	div    %rsi
+     236:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     23a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     23f:	75 b4                	jne    1f5 <printint64+0x4b>
+
+  if (sgn)
+     241:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     245:	74 2b                	je     272 <printint64+0xc8>
+    buf[i++] = '-';
+     247:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     24a:	8d 50 01             	lea    0x1(%rax),%edx
+     24d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     250:	48 98                	cltq
+     252:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     257:	eb 19                	jmp    272 <printint64+0xc8>
+    putc(fd, buf[i]);
+     259:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     25c:	48 98                	cltq
+     25e:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     263:	0f be d0             	movsbl %al,%edx
+     266:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     269:	89 d6                	mov    %edx,%esi
+     26b:	89 c7                	mov    %eax,%edi
+     26d:	e8 15 ff ff ff       	call   187 <putc>
+  while (--i >= 0)
+     272:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     276:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     27a:	79 dd                	jns    259 <printint64+0xaf>
+}
+     27c:	90                   	nop
+     27d:	90                   	nop
+     27e:	c9                   	leave
+     27f:	c3                   	ret
+
+0000000000000280 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     280:	55                   	push   %rbp
+     281:	48 89 e5             	mov    %rsp,%rbp
+     284:	48 83 ec 30          	sub    $0x30,%rsp
+     288:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     28b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     28e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     291:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     294:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     29b:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     29f:	74 17                	je     2b8 <printint+0x38>
+     2a1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     2a5:	79 11                	jns    2b8 <printint+0x38>
+    neg = 1;
+     2a7:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     2ae:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2b1:	f7 d8                	neg    %eax
+     2b3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     2b6:	eb 06                	jmp    2be <printint+0x3e>
+  } else {
+    x = xx;
+     2b8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2bb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     2be:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     2c5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     2c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2cb:	ba 00 00 00 00       	mov    $0x0,%edx
+     2d0:	f7 f1                	div    %ecx
+     2d2:	89 d1                	mov    %edx,%ecx
+     2d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2d7:	8d 50 01             	lea    0x1(%rax),%edx
+     2da:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2dd:	89 c9                	mov    %ecx,%ecx
+     2df:	48 8d 15 3a 2d 00 00 	lea    0x2d3a(%rip),%rdx        # 3020 <digits.0>
+     2e6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     2ea:	48 98                	cltq
+     2ec:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     2f0:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     2f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2f6:	ba 00 00 00 00       	mov    $0x0,%edx
+     2fb:	f7 f6                	div    %esi
+     2fd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     300:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     304:	75 bf                	jne    2c5 <printint+0x45>
+  if (neg)
+     306:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     30a:	74 2b                	je     337 <printint+0xb7>
+    buf[i++] = '-';
+     30c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     30f:	8d 50 01             	lea    0x1(%rax),%edx
+     312:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     315:	48 98                	cltq
+     317:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     31c:	eb 19                	jmp    337 <printint+0xb7>
+    putc(fd, buf[i]);
+     31e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     321:	48 98                	cltq
+     323:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     328:	0f be d0             	movsbl %al,%edx
+     32b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     32e:	89 d6                	mov    %edx,%esi
+     330:	89 c7                	mov    %eax,%edi
+     332:	e8 50 fe ff ff       	call   187 <putc>
+  while (--i >= 0)
+     337:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     33b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     33f:	79 dd                	jns    31e <printint+0x9e>
+}
+     341:	90                   	nop
+     342:	90                   	nop
+     343:	c9                   	leave
+     344:	c3                   	ret
+
+0000000000000345 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     345:	55                   	push   %rbp
+     346:	48 89 e5             	mov    %rsp,%rbp
+     349:	48 83 ec 70          	sub    $0x70,%rsp
+     34d:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     350:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     354:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     358:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     35c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     360:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     364:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     36b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     36f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     373:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     377:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     37b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     382:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     389:	e9 67 02 00 00       	jmp    5f5 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     38e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     391:	48 63 d0             	movslq %eax,%rdx
+     394:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     398:	48 01 d0             	add    %rdx,%rax
+     39b:	0f b6 00             	movzbl (%rax),%eax
+     39e:	0f be c0             	movsbl %al,%eax
+     3a1:	25 ff 00 00 00       	and    $0xff,%eax
+     3a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     3a9:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     3ad:	75 30                	jne    3df <printf+0x9a>
+      if (c == '%') {
+     3af:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     3b3:	75 13                	jne    3c8 <printf+0x83>
+        state = '%';
+     3b5:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     3bc:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     3c3:	e9 29 02 00 00       	jmp    5f1 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     3c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     3cb:	0f be d0             	movsbl %al,%edx
+     3ce:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3d1:	89 d6                	mov    %edx,%esi
+     3d3:	89 c7                	mov    %eax,%edi
+     3d5:	e8 ad fd ff ff       	call   187 <putc>
+     3da:	e9 12 02 00 00       	jmp    5f1 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     3df:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     3e3:	0f 85 08 02 00 00    	jne    5f1 <printf+0x2ac>
+      if (c == 'l') {
+     3e9:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     3ed:	75 0c                	jne    3fb <printf+0xb6>
+        lflag = 1;
+     3ef:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     3f6:	e9 f6 01 00 00       	jmp    5f1 <printf+0x2ac>
+      } else if (c == 'd') {
+     3fb:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     3ff:	0f 85 93 00 00 00    	jne    498 <printf+0x153>
+        if (lflag == 1)
+     405:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     409:	75 47                	jne    452 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     40b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     40e:	83 f8 2f             	cmp    $0x2f,%eax
+     411:	77 17                	ja     42a <printf+0xe5>
+     413:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     417:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     41a:	89 d2                	mov    %edx,%edx
+     41c:	48 01 d0             	add    %rdx,%rax
+     41f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     422:	83 c2 08             	add    $0x8,%edx
+     425:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     428:	eb 0c                	jmp    436 <printf+0xf1>
+     42a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     42e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     432:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     436:	48 8b 30             	mov    (%rax),%rsi
+     439:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     43c:	b9 01 00 00 00       	mov    $0x1,%ecx
+     441:	ba 0a 00 00 00       	mov    $0xa,%edx
+     446:	89 c7                	mov    %eax,%edi
+     448:	e8 5d fd ff ff       	call   1aa <printint64>
+     44d:	e9 98 01 00 00       	jmp    5ea <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     452:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     455:	83 f8 2f             	cmp    $0x2f,%eax
+     458:	77 17                	ja     471 <printf+0x12c>
+     45a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     45e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     461:	89 d2                	mov    %edx,%edx
+     463:	48 01 d0             	add    %rdx,%rax
+     466:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     469:	83 c2 08             	add    $0x8,%edx
+     46c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     46f:	eb 0c                	jmp    47d <printf+0x138>
+     471:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     475:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     479:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     47d:	8b 30                	mov    (%rax),%esi
+     47f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     482:	b9 01 00 00 00       	mov    $0x1,%ecx
+     487:	ba 0a 00 00 00       	mov    $0xa,%edx
+     48c:	89 c7                	mov    %eax,%edi
+     48e:	e8 ed fd ff ff       	call   280 <printint>
+     493:	e9 52 01 00 00       	jmp    5ea <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     498:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     49c:	74 0a                	je     4a8 <printf+0x163>
+     49e:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     4a2:	0f 85 93 00 00 00    	jne    53b <printf+0x1f6>
+        if (lflag == 1)
+     4a8:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     4ac:	75 47                	jne    4f5 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     4ae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4b1:	83 f8 2f             	cmp    $0x2f,%eax
+     4b4:	77 17                	ja     4cd <printf+0x188>
+     4b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4bd:	89 d2                	mov    %edx,%edx
+     4bf:	48 01 d0             	add    %rdx,%rax
+     4c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4c5:	83 c2 08             	add    $0x8,%edx
+     4c8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4cb:	eb 0c                	jmp    4d9 <printf+0x194>
+     4cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4d5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4d9:	48 8b 30             	mov    (%rax),%rsi
+     4dc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4df:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4e4:	ba 10 00 00 00       	mov    $0x10,%edx
+     4e9:	89 c7                	mov    %eax,%edi
+     4eb:	e8 ba fc ff ff       	call   1aa <printint64>
+        if (lflag == 1)
+     4f0:	e9 f5 00 00 00       	jmp    5ea <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     4f5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4f8:	83 f8 2f             	cmp    $0x2f,%eax
+     4fb:	77 17                	ja     514 <printf+0x1cf>
+     4fd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     501:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     504:	89 d2                	mov    %edx,%edx
+     506:	48 01 d0             	add    %rdx,%rax
+     509:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     50c:	83 c2 08             	add    $0x8,%edx
+     50f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     512:	eb 0c                	jmp    520 <printf+0x1db>
+     514:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     518:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     51c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     520:	8b 30                	mov    (%rax),%esi
+     522:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     525:	b9 00 00 00 00       	mov    $0x0,%ecx
+     52a:	ba 10 00 00 00       	mov    $0x10,%edx
+     52f:	89 c7                	mov    %eax,%edi
+     531:	e8 4a fd ff ff       	call   280 <printint>
+        if (lflag == 1)
+     536:	e9 af 00 00 00       	jmp    5ea <printf+0x2a5>
+      } else if (c == 's') {
+     53b:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     53f:	75 6e                	jne    5af <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     541:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     544:	83 f8 2f             	cmp    $0x2f,%eax
+     547:	77 17                	ja     560 <printf+0x21b>
+     549:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     54d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     550:	89 d2                	mov    %edx,%edx
+     552:	48 01 d0             	add    %rdx,%rax
+     555:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     558:	83 c2 08             	add    $0x8,%edx
+     55b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     55e:	eb 0c                	jmp    56c <printf+0x227>
+     560:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     564:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     568:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     56c:	48 8b 00             	mov    (%rax),%rax
+     56f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     573:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     578:	75 28                	jne    5a2 <printf+0x25d>
+          s = "(null)";
+     57a:	48 8d 05 7f 1a 00 00 	lea    0x1a7f(%rip),%rax        # 2000 <benchreport+0x1ee>
+     581:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     585:	eb 1b                	jmp    5a2 <printf+0x25d>
+          putc(fd, *s);
+     587:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     58b:	0f b6 00             	movzbl (%rax),%eax
+     58e:	0f be d0             	movsbl %al,%edx
+     591:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     594:	89 d6                	mov    %edx,%esi
+     596:	89 c7                	mov    %eax,%edi
+     598:	e8 ea fb ff ff       	call   187 <putc>
+        for (; *s; s++)
+     59d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     5a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     5a6:	0f b6 00             	movzbl (%rax),%eax
+     5a9:	84 c0                	test   %al,%al
+     5ab:	75 da                	jne    587 <printf+0x242>
+     5ad:	eb 3b                	jmp    5ea <printf+0x2a5>
+      } else if (c == '%') {
+     5af:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     5b3:	75 14                	jne    5c9 <printf+0x284>
+        putc(fd, c);
+     5b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     5b8:	0f be d0             	movsbl %al,%edx
+     5bb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5be:	89 d6                	mov    %edx,%esi
+     5c0:	89 c7                	mov    %eax,%edi
+     5c2:	e8 c0 fb ff ff       	call   187 <putc>
+     5c7:	eb 21                	jmp    5ea <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     5c9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5cc:	be 25 00 00 00       	mov    $0x25,%esi
+     5d1:	89 c7                	mov    %eax,%edi
+     5d3:	e8 af fb ff ff       	call   187 <putc>
+        putc(fd, c);
+     5d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     5db:	0f be d0             	movsbl %al,%edx
+     5de:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5e1:	89 d6                	mov    %edx,%esi
+     5e3:	89 c7                	mov    %eax,%edi
+     5e5:	e8 9d fb ff ff       	call   187 <putc>
+      }
+      state = 0;
+     5ea:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     5f1:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     5f5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     5f8:	48 63 d0             	movslq %eax,%rdx
+     5fb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     5ff:	48 01 d0             	add    %rdx,%rax
+     602:	0f b6 00             	movzbl (%rax),%eax
+     605:	84 c0                	test   %al,%al
+     607:	0f 85 81 fd ff ff    	jne    38e <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     60d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     610:	89 c7                	mov    %eax,%edi
+     612:	e8 ee 02 00 00       	call   905 <bflushtty>
+}
+     617:	90                   	nop
+     618:	c9                   	leave
+     619:	c3                   	ret
+
+000000000000061a <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     61a:	55                   	push   %rbp
+     61b:	48 89 e5             	mov    %rsp,%rbp
+     61e:	48 83 ec 30          	sub    $0x30,%rsp
+     622:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     625:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     629:	78 06                	js     631 <getbuf+0x17>
+     62b:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     62f:	7e 0a                	jle    63b <getbuf+0x21>
+    return 0;
+     631:	b8 00 00 00 00       	mov    $0x0,%eax
+     636:	e9 94 00 00 00       	jmp    6cf <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     63b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     63e:	48 98                	cltq
+     640:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     647:	00 
+     648:	48 8d 05 f1 29 00 00 	lea    0x29f1(%rip),%rax        # 3040 <obufs>
+     64f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     653:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     657:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     65c:	75 6d                	jne    6cb <getbuf+0xb1>
+     65e:	bf 08 02 00 00       	mov    $0x208,%edi
+     663:	e8 bd 13 00 00       	call   1a25 <malloc>
+     668:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     66c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     671:	74 58                	je     6cb <getbuf+0xb1>
+    b->n = 0;
+     673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     677:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     67d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     681:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     684:	48 89 d6             	mov    %rdx,%rsi
+     687:	89 c7                	mov    %eax,%edi
+     689:	e8 e4 0d 00 00       	call   1472 <fstat>
+     68e:	85 c0                	test   %eax,%eax
+     690:	75 11                	jne    6a3 <getbuf+0x89>
+     692:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     696:	66 83 f8 03          	cmp    $0x3,%ax
+     69a:	75 07                	jne    6a3 <getbuf+0x89>
+     69c:	ba 01 00 00 00       	mov    $0x1,%edx
+     6a1:	eb 05                	jmp    6a8 <getbuf+0x8e>
+     6a3:	ba 00 00 00 00       	mov    $0x0,%edx
+     6a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6ac:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     6af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6b2:	48 98                	cltq
+     6b4:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     6bb:	00 
+     6bc:	48 8d 15 7d 29 00 00 	lea    0x297d(%rip),%rdx        # 3040 <obufs>
+     6c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6c7:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     6cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     6cf:	c9                   	leave
+     6d0:	c3                   	ret
+
+00000000000006d1 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     6d1:	55                   	push   %rbp
+     6d2:	48 89 e5             	mov    %rsp,%rbp
+     6d5:	48 83 ec 20          	sub    $0x20,%rsp
+     6d9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     6dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     6e0:	78 33                	js     715 <bflush+0x44>
+     6e2:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     6e6:	7f 2d                	jg     715 <bflush+0x44>
+     6e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6eb:	48 98                	cltq
+     6ed:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     6f4:	00 
+     6f5:	48 8d 05 44 29 00 00 	lea    0x2944(%rip),%rax        # 3040 <obufs>
+     6fc:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     700:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     704:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     709:	74 0a                	je     715 <bflush+0x44>
+     70b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     70f:	8b 00                	mov    (%rax),%eax
+     711:	85 c0                	test   %eax,%eax
+     713:	75 07                	jne    71c <bflush+0x4b>
+    return 0;
+     715:	b8 00 00 00 00       	mov    $0x0,%eax
+     71a:	eb 3c                	jmp    758 <bflush+0x87>
+  n = b->n;
+     71c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     720:	8b 00                	mov    (%rax),%eax
+     722:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     725:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     729:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     72f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     733:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     737:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     73a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     73d:	48 89 ce             	mov    %rcx,%rsi
+     740:	89 c7                	mov    %eax,%edi
+     742:	e8 de 0c 00 00       	call   1425 <write>
+     747:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     74a:	75 07                	jne    753 <bflush+0x82>
+     74c:	b8 00 00 00 00       	mov    $0x0,%eax
+     751:	eb 05                	jmp    758 <bflush+0x87>
+     753:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     758:	c9                   	leave
+     759:	c3                   	ret
+
+000000000000075a <bflushall>:
+
+void bflushall(void) {
+     75a:	55                   	push   %rbp
+     75b:	48 89 e5             	mov    %rsp,%rbp
+     75e:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     762:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     769:	eb 0e                	jmp    779 <bflushall+0x1f>
+    bflush(fd);
+     76b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     76e:	89 c7                	mov    %eax,%edi
+     770:	e8 5c ff ff ff       	call   6d1 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     775:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     779:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     77d:	7e ec                	jle    76b <bflushall+0x11>
+}
+     77f:	90                   	nop
+     780:	90                   	nop
+     781:	c9                   	leave
+     782:	c3                   	ret
+
+0000000000000783 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     783:	55                   	push   %rbp
+     784:	48 89 e5             	mov    %rsp,%rbp
+     787:	48 83 ec 30          	sub    $0x30,%rsp
+     78b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     78e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     792:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     795:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     798:	89 c7                	mov    %eax,%edi
+     79a:	e8 7b fe ff ff       	call   61a <getbuf>
+     79f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     7a3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     7a8:	75 19                	jne    7c3 <bwrite+0x40>
+    return write(fd, s, n);
+     7aa:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     7ad:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     7b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7b4:	48 89 ce             	mov    %rcx,%rsi
+     7b7:	89 c7                	mov    %eax,%edi
+     7b9:	e8 67 0c 00 00       	call   1425 <write>
+     7be:	e9 cd 00 00 00       	jmp    890 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     7c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7ca:	e9 92 00 00 00       	jmp    861 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     7cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7d3:	8b 00                	mov    (%rax),%eax
+     7d5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7da:	75 18                	jne    7f4 <bwrite+0x71>
+     7dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7df:	89 c7                	mov    %eax,%edi
+     7e1:	e8 eb fe ff ff       	call   6d1 <bflush>
+     7e6:	85 c0                	test   %eax,%eax
+     7e8:	79 0a                	jns    7f4 <bwrite+0x71>
+      return -1;
+     7ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7ef:	e9 9c 00 00 00       	jmp    890 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     7f4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7f7:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     7fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     7fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     801:	8b 00                	mov    (%rax),%eax
+     803:	ba 00 02 00 00       	mov    $0x200,%edx
+     808:	29 c2                	sub    %eax,%edx
+     80a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     80d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     810:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     813:	39 c2                	cmp    %eax,%edx
+     815:	0f 4e c2             	cmovle %edx,%eax
+     818:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     81b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     81e:	48 63 d0             	movslq %eax,%rdx
+     821:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     825:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     829:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     82d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     831:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     835:	8b 00                	mov    (%rax),%eax
+     837:	48 98                	cltq
+     839:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     83d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     840:	89 c2                	mov    %eax,%edx
+     842:	48 89 cf             	mov    %rcx,%rdi
+     845:	e8 e9 06 00 00       	call   f33 <memmove>
+    b->n += m;
+     84a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     84e:	8b 10                	mov    (%rax),%edx
+     850:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     853:	01 c2                	add    %eax,%edx
+     855:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     859:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     85b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     85e:	01 45 fc             	add    %eax,-0x4(%rbp)
+     861:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     864:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     867:	0f 8c 62 ff ff ff    	jl     7cf <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     86d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     871:	8b 40 04             	mov    0x4(%rax),%eax
+     874:	85 c0                	test   %eax,%eax
+     876:	74 15                	je     88d <bwrite+0x10a>
+     878:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     87b:	89 c7                	mov    %eax,%edi
+     87d:	e8 4f fe ff ff       	call   6d1 <bflush>
+     882:	85 c0                	test   %eax,%eax
+     884:	79 07                	jns    88d <bwrite+0x10a>
+    return -1;
+     886:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     88b:	eb 03                	jmp    890 <bwrite+0x10d>
+  return n;
+     88d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     890:	c9                   	leave
+     891:	c3                   	ret
+
+0000000000000892 <bputc>:
+
+void bputc(int fd, char c) {
+     892:	55                   	push   %rbp
+     893:	48 89 e5             	mov    %rsp,%rbp
+     896:	48 83 ec 20          	sub    $0x20,%rsp
+     89a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     89d:	89 f0                	mov    %esi,%eax
+     89f:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     8a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8a5:	89 c7                	mov    %eax,%edi
+     8a7:	e8 6e fd ff ff       	call   61a <getbuf>
+     8ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8b0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8b5:	75 18                	jne    8cf <bputc+0x3d>
+    write(fd, &c, 1);
+     8b7:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     8bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8be:	ba 01 00 00 00       	mov    $0x1,%edx
+     8c3:	48 89 ce             	mov    %rcx,%rsi
+     8c6:	89 c7                	mov    %eax,%edi
+     8c8:	e8 58 0b 00 00       	call   1425 <write>
+    return;
+     8cd:	eb 34                	jmp    903 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     8cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8d3:	8b 00                	mov    (%rax),%eax
+     8d5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8da:	75 0a                	jne    8e6 <bputc+0x54>
+    bflush(fd);
+     8dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8df:	89 c7                	mov    %eax,%edi
+     8e1:	e8 eb fd ff ff       	call   6d1 <bflush>
+  b->data[b->n++] = c;
+     8e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8ea:	8b 00                	mov    (%rax),%eax
+     8ec:	8d 48 01             	lea    0x1(%rax),%ecx
+     8ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8f3:	89 0a                	mov    %ecx,(%rdx)
+     8f5:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     8f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8fd:	48 98                	cltq
+     8ff:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     903:	c9                   	leave
+     904:	c3                   	ret
+
+0000000000000905 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     905:	55                   	push   %rbp
+     906:	48 89 e5             	mov    %rsp,%rbp
+     909:	48 83 ec 10          	sub    $0x10,%rsp
+     90d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     910:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     914:	78 4c                	js     962 <bflushtty+0x5d>
+     916:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     91a:	7f 46                	jg     962 <bflushtty+0x5d>
+     91c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     91f:	48 98                	cltq
+     921:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     928:	00 
+     929:	48 8d 05 10 27 00 00 	lea    0x2710(%rip),%rax        # 3040 <obufs>
+     930:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     934:	48 85 c0             	test   %rax,%rax
+     937:	74 29                	je     962 <bflushtty+0x5d>
+     939:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     93c:	48 98                	cltq
+     93e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     945:	00 
+     946:	48 8d 05 f3 26 00 00 	lea    0x26f3(%rip),%rax        # 3040 <obufs>
+     94d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     951:	8b 40 04             	mov    0x4(%rax),%eax
+     954:	85 c0                	test   %eax,%eax
+     956:	74 0a                	je     962 <bflushtty+0x5d>
+    bflush(fd);
+     958:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     95b:	89 c7                	mov    %eax,%edi
+     95d:	e8 6f fd ff ff       	call   6d1 <bflush>
+}
+     962:	90                   	nop
+     963:	c9                   	leave
+     964:	c3                   	ret
+
+0000000000000965 <fork>:
+
+int fork(void) {
+     965:	55                   	push   %rbp
+     966:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     969:	e8 ec fd ff ff       	call   75a <bflushall>
+  return _fork();
+     96e:	e8 7b 0a 00 00       	call   13ee <_fork>
+}
+     973:	5d                   	pop    %rbp
+     974:	c3                   	ret
+
+0000000000000975 <exit>:
+
+noreturn void exit(void) {
+     975:	55                   	push   %rbp
+     976:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     979:	e8 dc fd ff ff       	call   75a <bflushall>
+  _exit();
+     97e:	e8 76 0a 00 00       	call   13f9 <_exit>
+
+0000000000000983 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     983:	55                   	push   %rbp
+     984:	48 89 e5             	mov    %rsp,%rbp
+     987:	48 83 ec 10          	sub    $0x10,%rsp
+     98b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     98f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     993:	e8 c2 fd ff ff       	call   75a <bflushall>
+  return _exec(path, argv);
+     998:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     99c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9a0:	48 89 d6             	mov    %rdx,%rsi
+     9a3:	48 89 c7             	mov    %rax,%rdi
+     9a6:	e8 9b 0a 00 00       	call   1446 <_exec>
+}
+     9ab:	c9                   	leave
+     9ac:	c3                   	ret
+
+00000000000009ad <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     9ad:	55                   	push   %rbp
+     9ae:	48 89 e5             	mov    %rsp,%rbp
+     9b1:	48 83 ec 20          	sub    $0x20,%rsp
+     9b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     9bd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     9c1:	e8 94 fd ff ff       	call   75a <bflushall>
+  return _spawn(path, argv, fds);
+     9c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     9ca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     9ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9d2:	48 89 ce             	mov    %rcx,%rsi
+     9d5:	48 89 c7             	mov    %rax,%rdi
+     9d8:	e8 2f 0b 00 00       	call   150c <_spawn>
+}
+     9dd:	c9                   	leave
+     9de:	c3                   	ret
+
+00000000000009df <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     9df:	55                   	push   %rbp
+     9e0:	48 89 e5             	mov    %rsp,%rbp
+     9e3:	48 83 ec 10          	sub    $0x10,%rsp
+     9e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     9ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     9ee:	78 69                	js     a59 <close+0x7a>
+     9f0:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     9f4:	7f 63                	jg     a59 <close+0x7a>
+     9f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9f9:	48 98                	cltq
+     9fb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a02:	00 
+     a03:	48 8d 05 36 26 00 00 	lea    0x2636(%rip),%rax        # 3040 <obufs>
+     a0a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a0e:	48 85 c0             	test   %rax,%rax
+     a11:	74 46                	je     a59 <close+0x7a>
+    bflush(fd);
+     a13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a16:	89 c7                	mov    %eax,%edi
+     a18:	e8 b4 fc ff ff       	call   6d1 <bflush>
+    free(obufs[fd]);
+     a1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a20:	48 98                	cltq
+     a22:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a29:	00 
+     a2a:	48 8d 05 0f 26 00 00 	lea    0x260f(%rip),%rax        # 3040 <obufs>
+     a31:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a35:	48 89 c7             	mov    %rax,%rdi
+     a38:	e8 90 11 00 00       	call   1bcd <free>
+    obufs[fd] = 0;
+     a3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a40:	48 98                	cltq
+     a42:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a49:	00 
+     a4a:	48 8d 05 ef 25 00 00 	lea    0x25ef(%rip),%rax        # 3040 <obufs>
+     a51:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     a58:	00 
+  }
+  return _close(fd);
+     a59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a5c:	89 c7                	mov    %eax,%edi
+     a5e:	e8 cd 09 00 00       	call   1430 <_close>
+}
+     a63:	c9                   	leave
+     a64:	c3                   	ret
+
+0000000000000a65 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     a65:	55                   	push   %rbp
+     a66:	48 89 e5             	mov    %rsp,%rbp
+     a69:	53                   	push   %rbx
+     a6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     a6e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     a72:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     a76:	48 8b 36             	mov    (%rsi),%rsi
+     a79:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     a7d:	48 29 f7             	sub    %rsi,%rdi
+     a80:	48 89 f9             	mov    %rdi,%rcx
+     a83:	bb 00 00 00 00       	mov    $0x0,%ebx
+     a88:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     a8c:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     a90:	48 89 f0             	mov    %rsi,%rax
+     a93:	ba 00 00 00 00       	mov    $0x0,%edx
+     a98:	48 89 df             	mov    %rbx,%rdi
+     a9b:	48 0f af f8          	imul   %rax,%rdi
+     a9f:	48 89 d6             	mov    %rdx,%rsi
+     aa2:	48 0f af f1          	imul   %rcx,%rsi
+     aa6:	48 01 fe             	add    %rdi,%rsi
+     aa9:	48 f7 e1             	mul    %rcx
+     aac:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     ab0:	48 89 ca             	mov    %rcx,%rdx
+     ab3:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     ab8:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     abc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     ac0:	c9                   	leave
+     ac1:	c3                   	ret
+
+0000000000000ac2 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     ac2:	55                   	push   %rbp
+     ac3:	48 89 e5             	mov    %rsp,%rbp
+     ac6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     aca:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     acd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     ad0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ad4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     ad7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ada:	48 89 ce             	mov    %rcx,%rsi
+     add:	48 89 f7             	mov    %rsi,%rdi
+     ae0:	89 d1                	mov    %edx,%ecx
+     ae2:	fc                   	cld
+     ae3:	f3 aa                	rep stos %al,%es:(%rdi)
+     ae5:	89 ca                	mov    %ecx,%edx
+     ae7:	48 89 fe             	mov    %rdi,%rsi
+     aea:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     aee:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     af1:	90                   	nop
+     af2:	5d                   	pop    %rbp
+     af3:	c3                   	ret
+
+0000000000000af4 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     af4:	55                   	push   %rbp
+     af5:	48 89 e5             	mov    %rsp,%rbp
+     af8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     afc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b00:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     b04:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b08:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b10:	48 89 ce             	mov    %rcx,%rsi
+     b13:	48 89 f7             	mov    %rsi,%rdi
+     b16:	48 89 d1             	mov    %rdx,%rcx
+     b19:	fc                   	cld
+     b1a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     b1d:	48 89 ca             	mov    %rcx,%rdx
+     b20:	48 89 fe             	mov    %rdi,%rsi
+     b23:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b27:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b2b:	90                   	nop
+     b2c:	5d                   	pop    %rbp
+     b2d:	c3                   	ret
+
+0000000000000b2e <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     b2e:	55                   	push   %rbp
+     b2f:	48 89 e5             	mov    %rsp,%rbp
+     b32:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b36:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b3a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     b3e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b42:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b4a:	48 89 cf             	mov    %rcx,%rdi
+     b4d:	48 89 d6             	mov    %rdx,%rsi
+     b50:	48 89 c1             	mov    %rax,%rcx
+     b53:	fc                   	cld
+     b54:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     b56:	48 89 c8             	mov    %rcx,%rax
+     b59:	48 89 f2             	mov    %rsi,%rdx
+     b5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b60:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     b64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     b68:	90                   	nop
+     b69:	5d                   	pop    %rbp
+     b6a:	c3                   	ret
+
+0000000000000b6b <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     b6b:	55                   	push   %rbp
+     b6c:	48 89 e5             	mov    %rsp,%rbp
+     b6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b73:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b77:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     b7b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b7f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b87:	48 89 cf             	mov    %rcx,%rdi
+     b8a:	48 89 d6             	mov    %rdx,%rsi
+     b8d:	48 89 c1             	mov    %rax,%rcx
+     b90:	fc                   	cld
+     b91:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     b94:	48 89 c8             	mov    %rcx,%rax
+     b97:	48 89 f2             	mov    %rsi,%rdx
+     b9a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b9e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     ba2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     ba6:	90                   	nop
+     ba7:	5d                   	pop    %rbp
+     ba8:	c3                   	ret
+
+0000000000000ba9 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     ba9:	55                   	push   %rbp
+     baa:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     bad:	0f 31                	rdtsc
+     baf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     bb2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     bb5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     bb8:	48 c1 e0 20          	shl    $0x20,%rax
+     bbc:	48 89 c2             	mov    %rax,%rdx
+     bbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bc2:	48 09 d0             	or     %rdx,%rax
+}
+     bc5:	5d                   	pop    %rbp
+     bc6:	c3                   	ret
+
+0000000000000bc7 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     bc7:	55                   	push   %rbp
+     bc8:	48 89 e5             	mov    %rsp,%rbp
+     bcb:	53                   	push   %rbx
+     bcc:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     bcf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     bd3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     bd7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     bdb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     bdf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     be2:	0f a2                	cpuid
+     be4:	89 de                	mov    %ebx,%esi
+     be6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     be9:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     bec:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     bef:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     bf2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     bf7:	74 09                	je     c02 <cpuid+0x3b>
+    *eaxp = eax;
+     bf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     bfd:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     c00:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     c02:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     c07:	74 09                	je     c12 <cpuid+0x4b>
+    *ebxp = ebx;
+     c09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c0d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c10:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     c12:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     c17:	74 09                	je     c22 <cpuid+0x5b>
+    *ecxp = ecx;
+     c19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c1d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c20:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     c22:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     c27:	74 09                	je     c32 <cpuid+0x6b>
+    *edxp = edx;
+     c29:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     c2d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     c30:	89 10                	mov    %edx,(%rax)
+}
+     c32:	90                   	nop
+     c33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c37:	c9                   	leave
+     c38:	c3                   	ret
+
+0000000000000c39 <strcpy>:
+char *strcpy(char *s, char *t) {
+     c39:	55                   	push   %rbp
+     c3a:	48 89 e5             	mov    %rsp,%rbp
+     c3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     c45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c49:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     c4d:	90                   	nop
+     c4e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c52:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     c56:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c5e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     c62:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     c66:	0f b6 12             	movzbl (%rdx),%edx
+     c69:	88 10                	mov    %dl,(%rax)
+     c6b:	0f b6 00             	movzbl (%rax),%eax
+     c6e:	84 c0                	test   %al,%al
+     c70:	75 dc                	jne    c4e <strcpy+0x15>
+  return os;
+     c72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c76:	5d                   	pop    %rbp
+     c77:	c3                   	ret
+
+0000000000000c78 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     c78:	55                   	push   %rbp
+     c79:	48 89 e5             	mov    %rsp,%rbp
+     c7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c80:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     c84:	eb 0a                	jmp    c90 <strcmp+0x18>
+    p++, q++;
+     c86:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     c8b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c94:	0f b6 00             	movzbl (%rax),%eax
+     c97:	84 c0                	test   %al,%al
+     c99:	74 12                	je     cad <strcmp+0x35>
+     c9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c9f:	0f b6 10             	movzbl (%rax),%edx
+     ca2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ca6:	0f b6 00             	movzbl (%rax),%eax
+     ca9:	38 c2                	cmp    %al,%dl
+     cab:	74 d9                	je     c86 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb1:	0f b6 00             	movzbl (%rax),%eax
+     cb4:	0f b6 d0             	movzbl %al,%edx
+     cb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cbb:	0f b6 00             	movzbl (%rax),%eax
+     cbe:	0f b6 c0             	movzbl %al,%eax
+     cc1:	29 c2                	sub    %eax,%edx
+     cc3:	89 d0                	mov    %edx,%eax
+}
+     cc5:	5d                   	pop    %rbp
+     cc6:	c3                   	ret
+
+0000000000000cc7 <strlen>:
+uint strlen(char *s) {
+     cc7:	55                   	push   %rbp
+     cc8:	48 89 e5             	mov    %rsp,%rbp
+     ccb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     ccf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     cd6:	eb 04                	jmp    cdc <strlen+0x15>
+     cd8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     cdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cdf:	48 63 d0             	movslq %eax,%rdx
+     ce2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ce6:	48 01 d0             	add    %rdx,%rax
+     ce9:	0f b6 00             	movzbl (%rax),%eax
+     cec:	84 c0                	test   %al,%al
+     cee:	75 e8                	jne    cd8 <strlen+0x11>
+    ;
+  return n;
+     cf0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     cf3:	5d                   	pop    %rbp
+     cf4:	c3                   	ret
+
+0000000000000cf5 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     cf5:	55                   	push   %rbp
+     cf6:	48 89 e5             	mov    %rsp,%rbp
+     cf9:	53                   	push   %rbx
+     cfa:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     cfe:	8b 05 30 23 00 00    	mov    0x2330(%rip),%eax        # 3034 <erms>
+     d04:	85 c0                	test   %eax,%eax
+     d06:	79 53                	jns    d5b <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     d08:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     d0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     d12:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d17:	ba 00 00 00 00       	mov    $0x0,%edx
+     d1c:	48 89 c6             	mov    %rax,%rsi
+     d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+     d24:	e8 9e fe ff ff       	call   bc7 <cpuid>
+    ebx = 0;
+     d29:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     d30:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d33:	83 f8 06             	cmp    $0x6,%eax
+     d36:	76 14                	jbe    d4c <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     d38:	b8 07 00 00 00       	mov    $0x7,%eax
+     d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d42:	0f a2                	cpuid
+     d44:	89 d9                	mov    %ebx,%ecx
+     d46:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     d49:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     d4c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d4f:	c1 e8 09             	shr    $0x9,%eax
+     d52:	83 e0 01             	and    $0x1,%eax
+     d55:	89 05 d9 22 00 00    	mov    %eax,0x22d9(%rip)        # 3034 <erms>
+  }
+  return erms;
+     d5b:	8b 05 d3 22 00 00    	mov    0x22d3(%rip),%eax        # 3034 <erms>
+}
+     d61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     d65:	c9                   	leave
+     d66:	c3                   	ret
+
+0000000000000d67 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     d67:	55                   	push   %rbp
+     d68:	48 89 e5             	mov    %rsp,%rbp
+     d6b:	48 83 ec 10          	sub    $0x10,%rsp
+     d6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d73:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     d76:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     d79:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     d7d:	76 09                	jbe    d88 <memset+0x21>
+     d7f:	e8 71 ff ff ff       	call   cf5 <haserms>
+     d84:	85 c0                	test   %eax,%eax
+     d86:	74 16                	je     d9e <memset+0x37>
+    stosb(dst, c, n);
+     d88:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     d8b:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     d8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d92:	89 ce                	mov    %ecx,%esi
+     d94:	48 89 c7             	mov    %rax,%rdi
+     d97:	e8 26 fd ff ff       	call   ac2 <stosb>
+     d9c:	eb 58                	jmp    df6 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     d9e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     da1:	c1 e8 03             	shr    $0x3,%eax
+     da4:	89 c6                	mov    %eax,%esi
+     da6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     da9:	48 98                	cltq
+     dab:	0f b6 c0             	movzbl %al,%eax
+     dae:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     db5:	01 01 01 
+     db8:	48 0f af c2          	imul   %rdx,%rax
+     dbc:	48 89 c1             	mov    %rax,%rcx
+     dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc3:	48 89 f2             	mov    %rsi,%rdx
+     dc6:	48 89 ce             	mov    %rcx,%rsi
+     dc9:	48 89 c7             	mov    %rax,%rdi
+     dcc:	e8 23 fd ff ff       	call   af4 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     dd1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     dd4:	83 e0 07             	and    $0x7,%eax
+     dd7:	89 c2                	mov    %eax,%edx
+     dd9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     ddc:	83 e0 f8             	and    $0xfffffff8,%eax
+     ddf:	48 89 c1             	mov    %rax,%rcx
+     de2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de6:	48 01 c1             	add    %rax,%rcx
+     de9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     dec:	89 c6                	mov    %eax,%esi
+     dee:	48 89 cf             	mov    %rcx,%rdi
+     df1:	e8 cc fc ff ff       	call   ac2 <stosb>
+  }
+  return dst;
+     df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     dfa:	c9                   	leave
+     dfb:	c3                   	ret
+
+0000000000000dfc <strchr>:
+
+char *strchr(const char *s, char c) {
+     dfc:	55                   	push   %rbp
+     dfd:	48 89 e5             	mov    %rsp,%rbp
+     e00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e04:	89 f0                	mov    %esi,%eax
+     e06:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     e09:	eb 17                	jmp    e22 <strchr+0x26>
+    if (*s == c)
+     e0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e0f:	0f b6 00             	movzbl (%rax),%eax
+     e12:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     e15:	75 06                	jne    e1d <strchr+0x21>
+      return (char *)s;
+     e17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e1b:	eb 15                	jmp    e32 <strchr+0x36>
+  for (; *s; s++)
+     e1d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e26:	0f b6 00             	movzbl (%rax),%eax
+     e29:	84 c0                	test   %al,%al
+     e2b:	75 de                	jne    e0b <strchr+0xf>
+  return 0;
+     e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e32:	5d                   	pop    %rbp
+     e33:	c3                   	ret
+
+0000000000000e34 <gets>:
+
+char *gets(char *buf, int max) {
+     e34:	55                   	push   %rbp
+     e35:	48 89 e5             	mov    %rsp,%rbp
+     e38:	48 83 ec 20          	sub    $0x20,%rsp
+     e3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e40:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     e43:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e4a:	eb 48                	jmp    e94 <gets+0x60>
+    cc = read(0, &c, 1);
+     e4c:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     e50:	ba 01 00 00 00       	mov    $0x1,%edx
+     e55:	48 89 c6             	mov    %rax,%rsi
+     e58:	bf 00 00 00 00       	mov    $0x0,%edi
+     e5d:	e8 b8 05 00 00       	call   141a <read>
+     e62:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     e65:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e69:	7e 36                	jle    ea1 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     e6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e6e:	8d 50 01             	lea    0x1(%rax),%edx
+     e71:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e74:	48 63 d0             	movslq %eax,%rdx
+     e77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e7b:	48 01 c2             	add    %rax,%rdx
+     e7e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e82:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     e84:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e88:	3c 0a                	cmp    $0xa,%al
+     e8a:	74 16                	je     ea2 <gets+0x6e>
+     e8c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e90:	3c 0d                	cmp    $0xd,%al
+     e92:	74 0e                	je     ea2 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     e94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e97:	83 c0 01             	add    $0x1,%eax
+     e9a:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     e9d:	7f ad                	jg     e4c <gets+0x18>
+     e9f:	eb 01                	jmp    ea2 <gets+0x6e>
+      break;
+     ea1:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     ea2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ea5:	48 63 d0             	movslq %eax,%rdx
+     ea8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eac:	48 01 d0             	add    %rdx,%rax
+     eaf:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     eb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     eb6:	c9                   	leave
+     eb7:	c3                   	ret
+
+0000000000000eb8 <stat>:
+
+int stat(char *n, struct stat *st) {
+     eb8:	55                   	push   %rbp
+     eb9:	48 89 e5             	mov    %rsp,%rbp
+     ebc:	48 83 ec 10          	sub    $0x10,%rsp
+     ec0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ec4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     ec8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ecc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed0:	48 89 c6             	mov    %rax,%rsi
+     ed3:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     ed8:	e8 58 07 00 00       	call   1635 <fstatat>
+}
+     edd:	c9                   	leave
+     ede:	c3                   	ret
+
+0000000000000edf <atoi>:
+
+int atoi(const char *s) {
+     edf:	55                   	push   %rbp
+     ee0:	48 89 e5             	mov    %rsp,%rbp
+     ee3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     ee7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     eee:	eb 28                	jmp    f18 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     ef0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     ef3:	89 d0                	mov    %edx,%eax
+     ef5:	c1 e0 02             	shl    $0x2,%eax
+     ef8:	01 d0                	add    %edx,%eax
+     efa:	01 c0                	add    %eax,%eax
+     efc:	89 c1                	mov    %eax,%ecx
+     efe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f02:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     f06:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     f0a:	0f b6 00             	movzbl (%rax),%eax
+     f0d:	0f be c0             	movsbl %al,%eax
+     f10:	01 c8                	add    %ecx,%eax
+     f12:	83 e8 30             	sub    $0x30,%eax
+     f15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f1c:	0f b6 00             	movzbl (%rax),%eax
+     f1f:	3c 2f                	cmp    $0x2f,%al
+     f21:	7e 0b                	jle    f2e <atoi+0x4f>
+     f23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f27:	0f b6 00             	movzbl (%rax),%eax
+     f2a:	3c 39                	cmp    $0x39,%al
+     f2c:	7e c2                	jle    ef0 <atoi+0x11>
+  return n;
+     f2e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     f31:	5d                   	pop    %rbp
+     f32:	c3                   	ret
+
+0000000000000f33 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     f33:	55                   	push   %rbp
+     f34:	48 89 e5             	mov    %rsp,%rbp
+     f37:	48 83 ec 28          	sub    $0x28,%rsp
+     f3b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     f3f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     f43:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     f46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f4a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     f4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     f56:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     f5a:	7f 09                	jg     f65 <memmove+0x32>
+    return vdst;
+     f5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f60:	e9 29 01 00 00       	jmp    108e <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     f65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f69:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     f6d:	0f 83 87 00 00 00    	jae    ffa <memmove+0xc7>
+     f73:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f76:	48 63 d0             	movslq %eax,%rdx
+     f79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f7d:	48 01 d0             	add    %rdx,%rax
+     f80:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     f84:	73 74                	jae    ffa <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     f86:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f89:	48 98                	cltq
+     f8b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     f8f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f92:	48 98                	cltq
+     f94:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     f98:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fa0:	48 09 d0             	or     %rdx,%rax
+     fa3:	83 e0 07             	and    $0x7,%eax
+     fa6:	48 85 c0             	test   %rax,%rax
+     fa9:	75 3d                	jne    fe8 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     fab:	eb 1c                	jmp    fc9 <memmove+0x96>
+        src -= 8;
+     fad:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     fb2:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     fb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fbb:	48 8b 10             	mov    (%rax),%rdx
+     fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fc2:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     fc5:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     fc9:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     fcd:	7f de                	jg     fad <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     fcf:	eb 17                	jmp    fe8 <memmove+0xb5>
+      *--dst = *--src;
+     fd1:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     fd6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     fdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fdf:	0f b6 10             	movzbl (%rax),%edx
+     fe2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fe6:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     fe8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     feb:	8d 50 ff             	lea    -0x1(%rax),%edx
+     fee:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     ff1:	85 c0                	test   %eax,%eax
+     ff3:	7f dc                	jg     fd1 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     ff5:	e9 90 00 00 00       	jmp    108a <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     ffa:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     ffe:	7e 09                	jle    1009 <memmove+0xd6>
+    1000:	e8 f0 fc ff ff       	call   cf5 <haserms>
+    1005:	85 c0                	test   %eax,%eax
+    1007:	74 1b                	je     1024 <memmove+0xf1>
+    movsb(dst, src, n);
+    1009:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    100c:	48 63 d0             	movslq %eax,%rdx
+    100f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1013:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1017:	48 89 ce             	mov    %rcx,%rsi
+    101a:	48 89 c7             	mov    %rax,%rdi
+    101d:	e8 0c fb ff ff       	call   b2e <movsb>
+    1022:	eb 66                	jmp    108a <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1024:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1027:	8d 50 07             	lea    0x7(%rax),%edx
+    102a:	85 c0                	test   %eax,%eax
+    102c:	0f 48 c2             	cmovs  %edx,%eax
+    102f:	c1 f8 03             	sar    $0x3,%eax
+    1032:	48 63 d0             	movslq %eax,%rdx
+    1035:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1039:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    103d:	48 89 ce             	mov    %rcx,%rsi
+    1040:	48 89 c7             	mov    %rax,%rdi
+    1043:	e8 23 fb ff ff       	call   b6b <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1048:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    104b:	89 d0                	mov    %edx,%eax
+    104d:	c1 f8 1f             	sar    $0x1f,%eax
+    1050:	c1 e8 1d             	shr    $0x1d,%eax
+    1053:	01 c2                	add    %eax,%edx
+    1055:	83 e2 07             	and    $0x7,%edx
+    1058:	29 c2                	sub    %eax,%edx
+    105a:	89 d0                	mov    %edx,%eax
+    105c:	48 98                	cltq
+    105e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1061:	83 e2 f8             	and    $0xfffffff8,%edx
+    1064:	48 63 ca             	movslq %edx,%rcx
+    1067:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    106b:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    106f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1072:	83 e2 f8             	and    $0xfffffff8,%edx
+    1075:	48 63 ca             	movslq %edx,%rcx
+    1078:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    107c:	48 01 d1             	add    %rdx,%rcx
+    107f:	48 89 c2             	mov    %rax,%rdx
+    1082:	48 89 cf             	mov    %rcx,%rdi
+    1085:	e8 a4 fa ff ff       	call   b2e <movsb>
+  }
+  return vdst;
+    108a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    108e:	c9                   	leave
+    108f:	c3                   	ret
+
+0000000000001090 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1090:	55                   	push   %rbp
+    1091:	48 89 e5             	mov    %rsp,%rbp
+    1094:	48 83 ec 20          	sub    $0x20,%rsp
+    1098:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    109b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    109f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    10a6:	00 00 00 
+    10a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    10ad:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    10b1:	75 0d                	jne    10c0 <clock_gettime+0x30>
+    10b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    10bb:	48 85 c0             	test   %rax,%rax
+    10be:	75 13                	jne    10d3 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    10c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    10c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10c7:	48 89 d6             	mov    %rdx,%rsi
+    10ca:	89 c7                	mov    %eax,%edi
+    10cc:	e8 e0 04 00 00       	call   15b1 <_clock_gettime>
+    10d1:	eb 7d                	jmp    1150 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    10d3:	e8 d1 fa ff ff       	call   ba9 <rdtsc>
+    10d8:	48 89 c2             	mov    %rax,%rdx
+    10db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10df:	48 89 d6             	mov    %rdx,%rsi
+    10e2:	48 89 c7             	mov    %rax,%rdi
+    10e5:	e8 7b f9 ff ff       	call   a65 <clockns>
+    10ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    10ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10f2:	48 c1 e8 09          	shr    $0x9,%rax
+    10f6:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    10fd:	b8 44 00 
+    1100:	48 f7 e2             	mul    %rdx
+    1103:	48 89 d0             	mov    %rdx,%rax
+    1106:	48 c1 e8 0b          	shr    $0xb,%rax
+    110a:	48 89 c2             	mov    %rax,%rdx
+    110d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1111:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1114:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1118:	48 89 c8             	mov    %rcx,%rax
+    111b:	48 c1 e8 09          	shr    $0x9,%rax
+    111f:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1126:	b8 44 00 
+    1129:	48 f7 e2             	mul    %rdx
+    112c:	48 89 d0             	mov    %rdx,%rax
+    112f:	48 c1 e8 0b          	shr    $0xb,%rax
+    1133:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    113a:	48 89 c8             	mov    %rcx,%rax
+    113d:	48 29 d0             	sub    %rdx,%rax
+    1140:	48 89 c2             	mov    %rax,%rdx
+    1143:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1147:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    114b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1150:	c9                   	leave
+    1151:	c3                   	ret
+
+0000000000001152 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1152:	55                   	push   %rbp
+    1153:	48 89 e5             	mov    %rsp,%rbp
+    1156:	48 83 ec 10          	sub    $0x10,%rsp
+    115a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    115e:	eb 11                	jmp    1171 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1160:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1164:	be 02 00 00 00       	mov    $0x2,%esi
+    1169:	48 89 c7             	mov    %rax,%rdi
+    116c:	e8 6c 04 00 00       	call   15dd <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1171:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1175:	b8 02 00 00 00       	mov    $0x2,%eax
+    117a:	87 02                	xchg   %eax,(%rdx)
+    117c:	85 c0                	test   %eax,%eax
+    117e:	75 e0                	jne    1160 <mutex_wait+0xe>
+}
+    1180:	90                   	nop
+    1181:	90                   	nop
+    1182:	c9                   	leave
+    1183:	c3                   	ret
+
+0000000000001184 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1184:	55                   	push   %rbp
+    1185:	48 89 e5             	mov    %rsp,%rbp
+    1188:	48 83 ec 20          	sub    $0x20,%rsp
+    118c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1190:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1197:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    119b:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    119f:	8b 02                	mov    (%rdx),%eax
+    11a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11a6:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    11aa:	89 c1                	mov    %eax,%ecx
+    11ac:	0f 94 c0             	sete   %al
+    11af:	84 c0                	test   %al,%al
+    11b1:	75 02                	jne    11b5 <mutex_lock+0x31>
+    11b3:	89 0a                	mov    %ecx,(%rdx)
+    11b5:	83 f0 01             	xor    $0x1,%eax
+    11b8:	84 c0                	test   %al,%al
+    11ba:	74 0c                	je     11c8 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    11bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11c0:	48 89 c7             	mov    %rax,%rdi
+    11c3:	e8 8a ff ff ff       	call   1152 <mutex_wait>
+}
+    11c8:	90                   	nop
+    11c9:	c9                   	leave
+    11ca:	c3                   	ret
+
+00000000000011cb <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    11cb:	55                   	push   %rbp
+    11cc:	48 89 e5             	mov    %rsp,%rbp
+    11cf:	48 83 ec 10          	sub    $0x10,%rsp
+    11d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    11d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11db:	ba 00 00 00 00       	mov    $0x0,%edx
+    11e0:	87 10                	xchg   %edx,(%rax)
+    11e2:	83 fa 02             	cmp    $0x2,%edx
+    11e5:	75 11                	jne    11f8 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    11e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11eb:	be 01 00 00 00       	mov    $0x1,%esi
+    11f0:	48 89 c7             	mov    %rax,%rdi
+    11f3:	e8 f0 03 00 00       	call   15e8 <futex_wake>
+}
+    11f8:	90                   	nop
+    11f9:	c9                   	leave
+    11fa:	c3                   	ret
+
+00000000000011fb <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    11fb:	55                   	push   %rbp
+    11fc:	48 89 e5             	mov    %rsp,%rbp
+    11ff:	48 83 ec 20          	sub    $0x20,%rsp
+    1203:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1207:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    120b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    120f:	48 83 c0 04          	add    $0x4,%rax
+    1213:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    121b:	8b 00                	mov    (%rax),%eax
+    121d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1220:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1224:	48 89 c7             	mov    %rax,%rdi
+    1227:	e8 9f ff ff ff       	call   11cb <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    122c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1230:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1233:	89 d6                	mov    %edx,%esi
+    1235:	48 89 c7             	mov    %rax,%rdi
+    1238:	e8 a0 03 00 00       	call   15dd <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    123d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1241:	48 83 c0 04          	add    $0x4,%rax
+    1245:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1249:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    124d:	48 89 c7             	mov    %rax,%rdi
+    1250:	e8 fd fe ff ff       	call   1152 <mutex_wait>
+}
+    1255:	90                   	nop
+    1256:	c9                   	leave
+    1257:	c3                   	ret
+
+0000000000001258 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1258:	55                   	push   %rbp
+    1259:	48 89 e5             	mov    %rsp,%rbp
+    125c:	48 83 ec 10          	sub    $0x10,%rsp
+    1260:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1264:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1268:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    126c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1270:	48 83 c0 04          	add    $0x4,%rax
+    1274:	8b 00                	mov    (%rax),%eax
+    1276:	85 c0                	test   %eax,%eax
+    1278:	7e 11                	jle    128b <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    127a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127e:	be 01 00 00 00       	mov    $0x1,%esi
+    1283:	48 89 c7             	mov    %rax,%rdi
+    1286:	e8 5d 03 00 00       	call   15e8 <futex_wake>
+}
+    128b:	90                   	nop
+    128c:	c9                   	leave
+    128d:	c3                   	ret
+
+000000000000128e <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    128e:	55                   	push   %rbp
+    128f:	48 89 e5             	mov    %rsp,%rbp
+    1292:	48 83 ec 10          	sub    $0x10,%rsp
+    1296:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    129a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    129e:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    12a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12a6:	48 83 c0 04          	add    $0x4,%rax
+    12aa:	8b 00                	mov    (%rax),%eax
+    12ac:	85 c0                	test   %eax,%eax
+    12ae:	7e 11                	jle    12c1 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    12b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b4:	be 00 00 00 40       	mov    $0x40000000,%esi
+    12b9:	48 89 c7             	mov    %rax,%rdi
+    12bc:	e8 27 03 00 00       	call   15e8 <futex_wake>
+}
+    12c1:	90                   	nop
+    12c2:	c9                   	leave
+    12c3:	c3                   	ret
+
+00000000000012c4 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    12c4:	55                   	push   %rbp
+    12c5:	48 89 e5             	mov    %rsp,%rbp
+    12c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12cc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    12cf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    12d3:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    12d7:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    12db:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    12df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12e3:	8b 40 04             	mov    0x4(%rax),%eax
+    12e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    12e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ed:	8b 00                	mov    (%rax),%eax
+    12ef:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    12f2:	29 c2                	sub    %eax,%edx
+    12f4:	83 fa 1f             	cmp    $0x1f,%edx
+    12f7:	76 07                	jbe    1300 <ring_push+0x3c>
+    return -1;
+    12f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12fe:	eb 7e                	jmp    137e <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1300:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1303:	83 e0 1f             	and    $0x1f,%eax
+    1306:	89 c2                	mov    %eax,%edx
+    1308:	48 89 d0             	mov    %rdx,%rax
+    130b:	48 01 c0             	add    %rax,%rax
+    130e:	48 01 d0             	add    %rdx,%rax
+    1311:	48 c1 e0 04          	shl    $0x4,%rax
+    1315:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    131d:	48 01 d0             	add    %rdx,%rax
+    1320:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1324:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1328:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    132b:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    132d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1331:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1335:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1339:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    133d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1341:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1345:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1349:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    134d:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1351:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1355:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1359:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    135d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1361:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1365:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    136c:	8d 50 01             	lea    0x1(%rax),%edx
+    136f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1373:	48 83 c0 04          	add    $0x4,%rax
+    1377:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1379:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    137e:	5d                   	pop    %rbp
+    137f:	c3                   	ret
+
+0000000000001380 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1380:	55                   	push   %rbp
+    1381:	48 89 e5             	mov    %rsp,%rbp
+    1384:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1388:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    138c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1390:	8b 40 08             	mov    0x8(%rax),%eax
+    1393:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1396:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    139a:	48 83 c0 0c          	add    $0xc,%rax
+    139e:	8b 00                	mov    (%rax),%eax
+    13a0:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    13a3:	75 07                	jne    13ac <ring_pop+0x2c>
+    return -1;
+    13a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    13aa:	eb 40                	jmp    13ec <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    13ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13af:	83 e0 1f             	and    $0x1f,%eax
+    13b2:	89 c2                	mov    %eax,%edx
+    13b4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    13b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13bc:	89 d2                	mov    %edx,%edx
+    13be:	48 83 c2 61          	add    $0x61,%rdx
+    13c2:	48 c1 e2 04          	shl    $0x4,%rdx
+    13c6:	48 01 d0             	add    %rdx,%rax
+    13c9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    13cd:	48 8b 00             	mov    (%rax),%rax
+    13d0:	48 89 01             	mov    %rax,(%rcx)
+    13d3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    13d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13da:	8d 50 01             	lea    0x1(%rax),%edx
+    13dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e1:	48 83 c0 08          	add    $0x8,%rax
+    13e5:	89 10                	mov    %edx,(%rax)
+  return 0;
+    13e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13ec:	5d                   	pop    %rbp
+    13ed:	c3                   	ret
+
+00000000000013ee <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    13ee:	b8 01 00 00 00       	mov    $0x1,%eax
+    13f3:	49 89 ca             	mov    %rcx,%r10
+    13f6:	0f 05                	syscall
+    13f8:	c3                   	ret
+
+00000000000013f9 <_exit>:
+SYSCALL_(exit)
+    13f9:	b8 02 00 00 00       	mov    $0x2,%eax
+    13fe:	49 89 ca             	mov    %rcx,%r10
+    1401:	0f 05                	syscall
+    1403:	c3                   	ret
+
+0000000000001404 <wait>:
+SYSCALL(wait)
+    1404:	b8 03 00 00 00       	mov    $0x3,%eax
+    1409:	49 89 ca             	mov    %rcx,%r10
+    140c:	0f 05                	syscall
+    140e:	c3                   	ret
+
+000000000000140f <pipe>:
+SYSCALL(pipe)
+    140f:	b8 04 00 00 00       	mov    $0x4,%eax
+    1414:	49 89 ca             	mov    %rcx,%r10
+    1417:	0f 05                	syscall
+    1419:	c3                   	ret
+
+000000000000141a <read>:
+SYSCALL(read)
+    141a:	b8 05 00 00 00       	mov    $0x5,%eax
+    141f:	49 89 ca             	mov    %rcx,%r10
+    1422:	0f 05                	syscall
+    1424:	c3                   	ret
+
+0000000000001425 <write>:
+SYSCALL(write)
+    1425:	b8 10 00 00 00       	mov    $0x10,%eax
+    142a:	49 89 ca             	mov    %rcx,%r10
+    142d:	0f 05                	syscall
+    142f:	c3                   	ret
+
+0000000000001430 <_close>:
+SYSCALL_(close)
+    1430:	b8 15 00 00 00       	mov    $0x15,%eax
+    1435:	49 89 ca             	mov    %rcx,%r10
+    1438:	0f 05                	syscall
+    143a:	c3                   	ret
+
+000000000000143b <kill>:
+SYSCALL(kill)
+    143b:	b8 06 00 00 00       	mov    $0x6,%eax
+    1440:	49 89 ca             	mov    %rcx,%r10
+    1443:	0f 05                	syscall
+    1445:	c3                   	ret
+
+0000000000001446 <_exec>:
+SYSCALL_(exec)
+    1446:	b8 07 00 00 00       	mov    $0x7,%eax
+    144b:	49 89 ca             	mov    %rcx,%r10
+    144e:	0f 05                	syscall
+    1450:	c3                   	ret
+
+0000000000001451 <open>:
+SYSCALL(open)
+    1451:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1456:	49 89 ca             	mov    %rcx,%r10
+    1459:	0f 05                	syscall
+    145b:	c3                   	ret
+
+000000000000145c <mknod>:
+SYSCALL(mknod)
+    145c:	b8 11 00 00 00       	mov    $0x11,%eax
+    1461:	49 89 ca             	mov    %rcx,%r10
+    1464:	0f 05                	syscall
+    1466:	c3                   	ret
+
+0000000000001467 <unlink>:
+SYSCALL(unlink)
+    1467:	b8 12 00 00 00       	mov    $0x12,%eax
+    146c:	49 89 ca             	mov    %rcx,%r10
+    146f:	0f 05                	syscall
+    1471:	c3                   	ret
+
+0000000000001472 <fstat>:
+SYSCALL(fstat)
+    1472:	b8 08 00 00 00       	mov    $0x8,%eax
+    1477:	49 89 ca             	mov    %rcx,%r10
+    147a:	0f 05                	syscall
+    147c:	c3                   	ret
+
+000000000000147d <link>:
+SYSCALL(link)
+    147d:	b8 13 00 00 00       	mov    $0x13,%eax
+    1482:	49 89 ca             	mov    %rcx,%r10
+    1485:	0f 05                	syscall
+    1487:	c3                   	ret
+
+0000000000001488 <mkdir>:
+SYSCALL(mkdir)
+    1488:	b8 14 00 00 00       	mov    $0x14,%eax
+    148d:	49 89 ca             	mov    %rcx,%r10
+    1490:	0f 05                	syscall
+    1492:	c3                   	ret
+
+0000000000001493 <chdir>:
+SYSCALL(chdir)
+    1493:	b8 09 00 00 00       	mov    $0x9,%eax
+    1498:	49 89 ca             	mov    %rcx,%r10
+    149b:	0f 05                	syscall
+    149d:	c3                   	ret
+
+000000000000149e <dup>:
+SYSCALL(dup)
+    149e:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14a3:	49 89 ca             	mov    %rcx,%r10
+    14a6:	0f 05                	syscall
+    14a8:	c3                   	ret
+
+00000000000014a9 <getpid>:
+SYSCALL(getpid)
+    14a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14ae:	49 89 ca             	mov    %rcx,%r10
+    14b1:	0f 05                	syscall
+    14b3:	c3                   	ret
+
+00000000000014b4 <sbrk>:
+SYSCALL(sbrk)
+    14b4:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14b9:	49 89 ca             	mov    %rcx,%r10
+    14bc:	0f 05                	syscall
+    14be:	c3                   	ret
+
+00000000000014bf <sleep>:
+SYSCALL(sleep)
+    14bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14c4:	49 89 ca             	mov    %rcx,%r10
+    14c7:	0f 05                	syscall
+    14c9:	c3                   	ret
+
+00000000000014ca <uptime>:
+SYSCALL(uptime)
+    14ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14cf:	49 89 ca             	mov    %rcx,%r10
+    14d2:	0f 05                	syscall
+    14d4:	c3                   	ret
+
+00000000000014d5 <sysinfo>:
+SYSCALL(sysinfo)
+    14d5:	b8 16 00 00 00       	mov    $0x16,%eax
+    14da:	49 89 ca             	mov    %rcx,%r10
+    14dd:	0f 05                	syscall
+    14df:	c3                   	ret
+
+00000000000014e0 <crashn>:
+SYSCALL(crashn)
+    14e0:	b8 17 00 00 00       	mov    $0x17,%eax
+    14e5:	49 89 ca             	mov    %rcx,%r10
+    14e8:	0f 05                	syscall
+    14ea:	c3                   	ret
+
+00000000000014eb <mmap>:
+SYSCALL(mmap)
+    14eb:	b8 18 00 00 00       	mov    $0x18,%eax
+    14f0:	49 89 ca             	mov    %rcx,%r10
+    14f3:	0f 05                	syscall
+    14f5:	c3                   	ret
+
+00000000000014f6 <munmap>:
+SYSCALL(munmap)
+    14f6:	b8 19 00 00 00       	mov    $0x19,%eax
+    14fb:	49 89 ca             	mov    %rcx,%r10
+    14fe:	0f 05                	syscall
+    1500:	c3                   	ret
+
+0000000000001501 <nice>:
+SYSCALL(nice)
+    1501:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1506:	49 89 ca             	mov    %rcx,%r10
+    1509:	0f 05                	syscall
+    150b:	c3                   	ret
+
+000000000000150c <_spawn>:
+SYSCALL_(spawn)
+    150c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1511:	49 89 ca             	mov    %rcx,%r10
+    1514:	0f 05                	syscall
+    1516:	c3                   	ret
+
+0000000000001517 <pread>:
+SYSCALL(pread)
+    1517:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    151c:	49 89 ca             	mov    %rcx,%r10
+    151f:	0f 05                	syscall
+    1521:	c3                   	ret
+
+0000000000001522 <pwrite>:
+SYSCALL(pwrite)
+    1522:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1527:	49 89 ca             	mov    %rcx,%r10
+    152a:	0f 05                	syscall
+    152c:	c3                   	ret
+
+000000000000152d <readv>:
+SYSCALL(readv)
+    152d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1532:	49 89 ca             	mov    %rcx,%r10
+    1535:	0f 05                	syscall
+    1537:	c3                   	ret
+
+0000000000001538 <writev>:
+SYSCALL(writev)
+    1538:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    153d:	49 89 ca             	mov    %rcx,%r10
+    1540:	0f 05                	syscall
+    1542:	c3                   	ret
+
+0000000000001543 <sendfile>:
+SYSCALL(sendfile)
+    1543:	b8 20 00 00 00       	mov    $0x20,%eax
+    1548:	49 89 ca             	mov    %rcx,%r10
+    154b:	0f 05                	syscall
+    154d:	c3                   	ret
+
+000000000000154e <splice>:
+SYSCALL(splice)
+    154e:	b8 21 00 00 00       	mov    $0x21,%eax
+    1553:	49 89 ca             	mov    %rcx,%r10
+    1556:	0f 05                	syscall
+    1558:	c3                   	ret
+
+0000000000001559 <poll>:
+SYSCALL(poll)
+    1559:	b8 22 00 00 00       	mov    $0x22,%eax
+    155e:	49 89 ca             	mov    %rcx,%r10
+    1561:	0f 05                	syscall
+    1563:	c3                   	ret
+
+0000000000001564 <fsync>:
+SYSCALL(fsync)
+    1564:	b8 23 00 00 00       	mov    $0x23,%eax
+    1569:	49 89 ca             	mov    %rcx,%r10
+    156c:	0f 05                	syscall
+    156e:	c3                   	ret
+
+000000000000156f <fdatasync>:
+SYSCALL(fdatasync)
+    156f:	b8 24 00 00 00       	mov    $0x24,%eax
+    1574:	49 89 ca             	mov    %rcx,%r10
+    1577:	0f 05                	syscall
+    1579:	c3                   	ret
+
+000000000000157a <lockstat>:
+SYSCALL(lockstat)
+    157a:	b8 25 00 00 00       	mov    $0x25,%eax
+    157f:	49 89 ca             	mov    %rcx,%r10
+    1582:	0f 05                	syscall
+    1584:	c3                   	ret
+
+0000000000001585 <syscallstat>:
+SYSCALL(syscallstat)
+    1585:	b8 26 00 00 00       	mov    $0x26,%eax
+    158a:	49 89 ca             	mov    %rcx,%r10
+    158d:	0f 05                	syscall
+    158f:	c3                   	ret
+
+0000000000001590 <trace>:
+SYSCALL(trace)
+    1590:	b8 27 00 00 00       	mov    $0x27,%eax
+    1595:	49 89 ca             	mov    %rcx,%r10
+    1598:	0f 05                	syscall
+    159a:	c3                   	ret
+
+000000000000159b <profile>:
+SYSCALL(profile)
+    159b:	b8 28 00 00 00       	mov    $0x28,%eax
+    15a0:	49 89 ca             	mov    %rcx,%r10
+    15a3:	0f 05                	syscall
+    15a5:	c3                   	ret
+
+00000000000015a6 <cycles>:
+SYSCALL(cycles)
+    15a6:	b8 29 00 00 00       	mov    $0x29,%eax
+    15ab:	49 89 ca             	mov    %rcx,%r10
+    15ae:	0f 05                	syscall
+    15b0:	c3                   	ret
+
+00000000000015b1 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    15b1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    15b6:	49 89 ca             	mov    %rcx,%r10
+    15b9:	0f 05                	syscall
+    15bb:	c3                   	ret
+
+00000000000015bc <consmode>:
+SYSCALL(consmode)
+    15bc:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    15c1:	49 89 ca             	mov    %rcx,%r10
+    15c4:	0f 05                	syscall
+    15c6:	c3                   	ret
+
+00000000000015c7 <clone>:
+SYSCALL(clone)
+    15c7:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    15cc:	49 89 ca             	mov    %rcx,%r10
+    15cf:	0f 05                	syscall
+    15d1:	c3                   	ret
+
+00000000000015d2 <join>:
+SYSCALL(join)
+    15d2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    15d7:	49 89 ca             	mov    %rcx,%r10
+    15da:	0f 05                	syscall
+    15dc:	c3                   	ret
+
+00000000000015dd <futex_wait>:
+SYSCALL(futex_wait)
+    15dd:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    15e2:	49 89 ca             	mov    %rcx,%r10
+    15e5:	0f 05                	syscall
+    15e7:	c3                   	ret
+
+00000000000015e8 <futex_wake>:
+SYSCALL(futex_wake)
+    15e8:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    15ed:	49 89 ca             	mov    %rcx,%r10
+    15f0:	0f 05                	syscall
+    15f2:	c3                   	ret
+
+00000000000015f3 <shmget>:
+SYSCALL(shmget)
+    15f3:	b8 30 00 00 00       	mov    $0x30,%eax
+    15f8:	49 89 ca             	mov    %rcx,%r10
+    15fb:	0f 05                	syscall
+    15fd:	c3                   	ret
+
+00000000000015fe <shmat>:
+SYSCALL(shmat)
+    15fe:	b8 31 00 00 00       	mov    $0x31,%eax
+    1603:	49 89 ca             	mov    %rcx,%r10
+    1606:	0f 05                	syscall
+    1608:	c3                   	ret
+
+0000000000001609 <shmdt>:
+SYSCALL(shmdt)
+    1609:	b8 32 00 00 00       	mov    $0x32,%eax
+    160e:	49 89 ca             	mov    %rcx,%r10
+    1611:	0f 05                	syscall
+    1613:	c3                   	ret
+
+0000000000001614 <ring_setup>:
+SYSCALL(ring_setup)
+    1614:	b8 33 00 00 00       	mov    $0x33,%eax
+    1619:	49 89 ca             	mov    %rcx,%r10
+    161c:	0f 05                	syscall
+    161e:	c3                   	ret
+
+000000000000161f <ring_enter>:
+SYSCALL(ring_enter)
+    161f:	b8 34 00 00 00       	mov    $0x34,%eax
+    1624:	49 89 ca             	mov    %rcx,%r10
+    1627:	0f 05                	syscall
+    1629:	c3                   	ret
+
+000000000000162a <getdents>:
+SYSCALL(getdents)
+    162a:	b8 35 00 00 00       	mov    $0x35,%eax
+    162f:	49 89 ca             	mov    %rcx,%r10
+    1632:	0f 05                	syscall
+    1634:	c3                   	ret
+
+0000000000001635 <fstatat>:
+SYSCALL(fstatat)
+    1635:	b8 36 00 00 00       	mov    $0x36,%eax
+    163a:	49 89 ca             	mov    %rcx,%r10
+    163d:	0f 05                	syscall
+    163f:	c3                   	ret
+
+0000000000001640 <clone_file>:
+SYSCALL(clone_file)
+    1640:	b8 37 00 00 00       	mov    $0x37,%eax
+    1645:	49 89 ca             	mov    %rcx,%r10
+    1648:	0f 05                	syscall
+    164a:	c3                   	ret
+
+000000000000164b <fpunch>:
+SYSCALL(fpunch)
+    164b:	b8 38 00 00 00       	mov    $0x38,%eax
+    1650:	49 89 ca             	mov    %rcx,%r10
+    1653:	0f 05                	syscall
+    1655:	c3                   	ret
+
+0000000000001656 <defrag>:
+SYSCALL(defrag)
+    1656:	b8 39 00 00 00       	mov    $0x39,%eax
+    165b:	49 89 ca             	mov    %rcx,%r10
+    165e:	0f 05                	syscall
+    1660:	c3                   	ret
+
+0000000000001661 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1661:	55                   	push   %rbp
+    1662:	48 89 e5             	mov    %rsp,%rbp
+    1665:	48 83 ec 20          	sub    $0x20,%rsp
+    1669:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    166d:	bf 00 00 00 00       	mov    $0x0,%edi
+    1672:	e8 3d fe ff ff       	call   14b4 <sbrk>
+    1677:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    167b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    167f:	48 f7 d8             	neg    %rax
+    1682:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1687:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    168b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    168f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1693:	48 01 c2             	add    %rax,%rdx
+    1696:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    169b:	48 39 c2             	cmp    %rax,%rdx
+    169e:	73 1e                	jae    16be <morecore+0x5d>
+    16a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16a4:	89 c2                	mov    %eax,%edx
+    16a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16aa:	01 d0                	add    %edx,%eax
+    16ac:	89 c7                	mov    %eax,%edi
+    16ae:	e8 01 fe ff ff       	call   14b4 <sbrk>
+    16b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16b7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    16bc:	75 07                	jne    16c5 <morecore+0x64>
+    return 0;
+    16be:	b8 00 00 00 00       	mov    $0x0,%eax
+    16c3:	eb 27                	jmp    16ec <morecore+0x8b>
+  stats.heap += n + pad;
+    16c5:	48 8b 05 a4 1a 00 00 	mov    0x1aa4(%rip),%rax        # 3170 <stats+0x50>
+    16cc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    16d0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    16d4:	48 01 ca             	add    %rcx,%rdx
+    16d7:	48 01 d0             	add    %rdx,%rax
+    16da:	48 89 05 8f 1a 00 00 	mov    %rax,0x1a8f(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    16e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    16e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e9:	48 01 d0             	add    %rdx,%rax
+}
+    16ec:	c9                   	leave
+    16ed:	c3                   	ret
+
+00000000000016ee <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    16ee:	55                   	push   %rbp
+    16ef:	48 89 e5             	mov    %rsp,%rbp
+    16f2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    16f6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    16fa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1701:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1702:	48 8d 05 f7 19 00 00 	lea    0x19f7(%rip),%rax        # 3100 <runs>
+    1709:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    170d:	eb 1a                	jmp    1729 <pagefree+0x3b>
+    prev = *rp;
+    170f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1713:	48 8b 00             	mov    (%rax),%rax
+    1716:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    171a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    171e:	48 8b 00             	mov    (%rax),%rax
+    1721:	48 83 c0 08          	add    $0x8,%rax
+    1725:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    172d:	48 8b 00             	mov    (%rax),%rax
+    1730:	48 85 c0             	test   %rax,%rax
+    1733:	74 0d                	je     1742 <pagefree+0x54>
+    1735:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1739:	48 8b 00             	mov    (%rax),%rax
+    173c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1740:	72 cd                	jb     170f <pagefree+0x21>
+  r = (struct run *)p;
+    1742:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1746:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    174a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    174e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1752:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1755:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1759:	48 8b 10             	mov    (%rax),%rdx
+    175c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1760:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1764:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1768:	48 8b 40 08          	mov    0x8(%rax),%rax
+    176c:	48 85 c0             	test   %rax,%rax
+    176f:	74 48                	je     17b9 <pagefree+0xcb>
+    1771:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1775:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1779:	48 01 c2             	add    %rax,%rdx
+    177c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1780:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1784:	48 39 c2             	cmp    %rax,%rdx
+    1787:	75 30                	jne    17b9 <pagefree+0xcb>
+    r->size += r->next->size;
+    1789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    178d:	48 8b 10             	mov    (%rax),%rdx
+    1790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1794:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1798:	48 8b 00             	mov    (%rax),%rax
+    179b:	48 01 c2             	add    %rax,%rdx
+    179e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17a2:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    17a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17a9:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17ad:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17b5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    17b9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17be:	74 46                	je     1806 <pagefree+0x118>
+    17c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17c4:	48 8b 10             	mov    (%rax),%rdx
+    17c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17cb:	48 01 d0             	add    %rdx,%rax
+    17ce:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    17d2:	75 32                	jne    1806 <pagefree+0x118>
+    prev->size += r->size;
+    17d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17d8:	48 8b 10             	mov    (%rax),%rdx
+    17db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17df:	48 8b 00             	mov    (%rax),%rax
+    17e2:	48 01 c2             	add    %rax,%rdx
+    17e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17e9:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    17ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17f8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    17fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1800:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1804:	eb 0c                	jmp    1812 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    180a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    180e:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1811:	90                   	nop
+    1812:	90                   	nop
+    1813:	5d                   	pop    %rbp
+    1814:	c3                   	ret
+
+0000000000001815 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1815:	55                   	push   %rbp
+    1816:	48 89 e5             	mov    %rsp,%rbp
+    1819:	48 83 ec 40          	sub    $0x40,%rsp
+    181d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1821:	48 8d 05 d8 18 00 00 	lea    0x18d8(%rip),%rax        # 3100 <runs>
+    1828:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    182c:	eb 66                	jmp    1894 <pagealloc+0x7f>
+    if (r->size == n) {
+    182e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1832:	48 8b 00             	mov    (%rax),%rax
+    1835:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1839:	75 18                	jne    1853 <pagealloc+0x3e>
+      *rp = r->next;
+    183b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    183f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1843:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1847:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    184a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    184e:	e9 ca 00 00 00       	jmp    191d <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1853:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1857:	48 8b 00             	mov    (%rax),%rax
+    185a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    185e:	73 28                	jae    1888 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1860:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1864:	48 8b 00             	mov    (%rax),%rax
+    1867:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    186b:	48 89 c2             	mov    %rax,%rdx
+    186e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1872:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1875:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1879:	48 8b 10             	mov    (%rax),%rdx
+    187c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1880:	48 01 d0             	add    %rdx,%rax
+    1883:	e9 95 00 00 00       	jmp    191d <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1888:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    188c:	48 83 c0 08          	add    $0x8,%rax
+    1890:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1898:	48 8b 00             	mov    (%rax),%rax
+    189b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    189f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    18a4:	75 88                	jne    182e <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    18a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    18aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    18ae:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    18b5:	00 
+    18b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    18ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18be:	48 39 c2             	cmp    %rax,%rdx
+    18c1:	48 0f 43 c2          	cmovae %rdx,%rax
+    18c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    18c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18cd:	48 89 c7             	mov    %rax,%rdi
+    18d0:	e8 8c fd ff ff       	call   1661 <morecore>
+    18d5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    18d9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    18de:	75 07                	jne    18e7 <pagealloc+0xd2>
+    return 0;
+    18e0:	b8 00 00 00 00       	mov    $0x0,%eax
+    18e5:	eb 36                	jmp    191d <pagealloc+0x108>
+  if (m > n)
+    18e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18eb:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    18ef:	73 1a                	jae    190b <pagealloc+0xf6>
+    pagefree(p, m - n);
+    18f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18f5:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18f9:	48 89 c2             	mov    %rax,%rdx
+    18fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1900:	48 89 d6             	mov    %rdx,%rsi
+    1903:	48 89 c7             	mov    %rax,%rdi
+    1906:	e8 e3 fd ff ff       	call   16ee <pagefree>
+  return p + m - n;
+    190b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    190f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1913:	48 89 c2             	mov    %rax,%rdx
+    1916:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    191a:	48 01 d0             	add    %rdx,%rax
+}
+    191d:	c9                   	leave
+    191e:	c3                   	ret
+
+000000000000191f <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    191f:	55                   	push   %rbp
+    1920:	48 89 e5             	mov    %rsp,%rbp
+    1923:	48 83 ec 30          	sub    $0x30,%rsp
+    1927:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    192a:	bf 00 10 00 00       	mov    $0x1000,%edi
+    192f:	e8 e1 fe ff ff       	call   1815 <pagealloc>
+    1934:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1938:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    193d:	75 0a                	jne    1949 <refill+0x2a>
+    return -1;
+    193f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1944:	e9 da 00 00 00       	jmp    1a23 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1949:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1950:	00 
+    1951:	e9 ba 00 00 00       	jmp    1a10 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1956:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    195a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    195e:	48 01 d0             	add    %rdx,%rax
+    1961:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1965:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1968:	ba 20 00 00 00       	mov    $0x20,%edx
+    196d:	89 c1                	mov    %eax,%ecx
+    196f:	48 d3 e2             	shl    %cl,%rdx
+    1972:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1976:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1979:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    197c:	48 63 d0             	movslq %eax,%rdx
+    197f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1983:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1987:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    198a:	48 98                	cltq
+    198c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1993:	00 
+    1994:	48 8d 05 25 17 00 00 	lea    0x1725(%rip),%rax        # 30c0 <freelist>
+    199b:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    199f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19a3:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    19a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19aa:	48 98                	cltq
+    19ac:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    19b3:	00 
+    19b4:	48 8d 15 05 17 00 00 	lea    0x1705(%rip),%rdx        # 30c0 <freelist>
+    19bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19bf:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    19c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19c6:	48 98                	cltq
+    19c8:	48 83 c0 08          	add    $0x8,%rax
+    19cc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    19d3:	00 
+    19d4:	48 8d 05 49 17 00 00 	lea    0x1749(%rip),%rax        # 3124 <stats+0x4>
+    19db:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    19de:	8d 48 01             	lea    0x1(%rax),%ecx
+    19e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19e4:	48 98                	cltq
+    19e6:	48 83 c0 08          	add    $0x8,%rax
+    19ea:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    19f1:	00 
+    19f2:	48 8d 05 2b 17 00 00 	lea    0x172b(%rip),%rax        # 3124 <stats+0x4>
+    19f9:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    19fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19ff:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a04:	89 c1                	mov    %eax,%ecx
+    1a06:	48 d3 e2             	shl    %cl,%rdx
+    1a09:	48 89 d0             	mov    %rdx,%rax
+    1a0c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1a10:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1a17:	00 
+    1a18:	0f 86 38 ff ff ff    	jbe    1956 <refill+0x37>
+  }
+  return 0;
+    1a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a23:	c9                   	leave
+    1a24:	c3                   	ret
+
+0000000000001a25 <malloc>:
+
+void *malloc(uint nbytes) {
+    1a25:	55                   	push   %rbp
+    1a26:	48 89 e5             	mov    %rsp,%rbp
+    1a29:	48 83 ec 30          	sub    $0x30,%rsp
+    1a2d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1a30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a33:	48 83 c0 10          	add    $0x10,%rax
+    1a37:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1a3b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1a42:	eb 04                	jmp    1a48 <malloc+0x23>
+    1a44:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1a48:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1a4c:	7f 16                	jg     1a64 <malloc+0x3f>
+    1a4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a51:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a56:	89 c1                	mov    %eax,%ecx
+    1a58:	48 d3 e2             	shl    %cl,%rdx
+    1a5b:	48 89 d0             	mov    %rdx,%rax
+    1a5e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1a62:	72 e0                	jb     1a44 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1a64:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1a68:	75 7d                	jne    1ae7 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1a6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a6e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1a74:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1a7a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1a7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a82:	48 89 c7             	mov    %rax,%rdi
+    1a85:	e8 8b fd ff ff       	call   1815 <pagealloc>
+    1a8a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1a8e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1a93:	75 0a                	jne    1a9f <malloc+0x7a>
+      return 0;
+    1a95:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a9a:	e9 2c 01 00 00       	jmp    1bcb <malloc+0x1a6>
+    h->size = n;
+    1a9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1aa3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1aa7:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1aaa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1aae:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1ab5:	00 
+    stats.inuse[LARGE]++;
+    1ab6:	8b 05 84 16 00 00    	mov    0x1684(%rip),%eax        # 3140 <stats+0x20>
+    1abc:	83 c0 01             	add    $0x1,%eax
+    1abf:	89 05 7b 16 00 00    	mov    %eax,0x167b(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    1ac5:	48 8b 15 9c 16 00 00 	mov    0x169c(%rip),%rdx        # 3168 <stats+0x48>
+    1acc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad0:	48 01 d0             	add    %rdx,%rax
+    1ad3:	48 89 05 8e 16 00 00 	mov    %rax,0x168e(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    1ada:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ade:	48 83 c0 10          	add    $0x10,%rax
+    1ae2:	e9 e4 00 00 00       	jmp    1bcb <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1ae7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aea:	48 98                	cltq
+    1aec:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1af3:	00 
+    1af4:	48 8d 05 c5 15 00 00 	lea    0x15c5(%rip),%rax        # 30c0 <freelist>
+    1afb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1aff:	48 85 c0             	test   %rax,%rax
+    1b02:	75 18                	jne    1b1c <malloc+0xf7>
+    1b04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b07:	89 c7                	mov    %eax,%edi
+    1b09:	e8 11 fe ff ff       	call   191f <refill>
+    1b0e:	85 c0                	test   %eax,%eax
+    1b10:	79 0a                	jns    1b1c <malloc+0xf7>
+    return 0;
+    1b12:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b17:	e9 af 00 00 00       	jmp    1bcb <malloc+0x1a6>
+  b = freelist[c];
+    1b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b1f:	48 98                	cltq
+    1b21:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b28:	00 
+    1b29:	48 8d 05 90 15 00 00 	lea    0x1590(%rip),%rax        # 30c0 <freelist>
+    1b30:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1b38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b3c:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1b40:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1b43:	48 63 d2             	movslq %edx,%rdx
+    1b46:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1b4d:	00 
+    1b4e:	48 8d 15 6b 15 00 00 	lea    0x156b(%rip),%rdx        # 30c0 <freelist>
+    1b55:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1b59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b5c:	48 98                	cltq
+    1b5e:	48 83 c0 08          	add    $0x8,%rax
+    1b62:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b69:	00 
+    1b6a:	48 8d 05 b3 15 00 00 	lea    0x15b3(%rip),%rax        # 3124 <stats+0x4>
+    1b71:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b74:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1b77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b7a:	48 98                	cltq
+    1b7c:	48 83 c0 08          	add    $0x8,%rax
+    1b80:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b87:	00 
+    1b88:	48 8d 05 95 15 00 00 	lea    0x1595(%rip),%rax        # 3124 <stats+0x4>
+    1b8f:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1b92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b95:	48 98                	cltq
+    1b97:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b9e:	00 
+    1b9f:	48 8d 05 7a 15 00 00 	lea    0x157a(%rip),%rax        # 3120 <stats>
+    1ba6:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ba9:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1baf:	48 98                	cltq
+    1bb1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bb8:	00 
+    1bb9:	48 8d 05 60 15 00 00 	lea    0x1560(%rip),%rax        # 3120 <stats>
+    1bc0:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bc7:	48 83 c0 10          	add    $0x10,%rax
+}
+    1bcb:	c9                   	leave
+    1bcc:	c3                   	ret
+
+0000000000001bcd <free>:
+
+void free(void *ap) {
+    1bcd:	55                   	push   %rbp
+    1bce:	48 89 e5             	mov    %rsp,%rbp
+    1bd1:	48 83 ec 18          	sub    $0x18,%rsp
+    1bd5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1bd9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1bde:	0f 84 03 01 00 00    	je     1ce7 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1be4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1be8:	48 83 e8 10          	sub    $0x10,%rax
+    1bec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1bf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bf8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1bfc:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1c01:	75 42                	jne    1c45 <free+0x78>
+    stats.inuse[LARGE]--;
+    1c03:	8b 05 37 15 00 00    	mov    0x1537(%rip),%eax        # 3140 <stats+0x20>
+    1c09:	83 e8 01             	sub    $0x1,%eax
+    1c0c:	89 05 2e 15 00 00    	mov    %eax,0x152e(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1c12:	48 8b 15 4f 15 00 00 	mov    0x154f(%rip),%rdx        # 3168 <stats+0x48>
+    1c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c1d:	48 8b 00             	mov    (%rax),%rax
+    1c20:	48 29 c2             	sub    %rax,%rdx
+    1c23:	48 89 15 3e 15 00 00 	mov    %rdx,0x153e(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c2e:	48 8b 10             	mov    (%rax),%rdx
+    1c31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c35:	48 89 d6             	mov    %rdx,%rsi
+    1c38:	48 89 c7             	mov    %rax,%rdi
+    1c3b:	e8 ae fa ff ff       	call   16ee <pagefree>
+    return;
+    1c40:	e9 a3 00 00 00       	jmp    1ce8 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1c45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c49:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c50:	00 
+    1c51:	48 8d 05 68 14 00 00 	lea    0x1468(%rip),%rax        # 30c0 <freelist>
+    1c58:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1c5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c60:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1c64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c68:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1c6f:	00 
+    1c70:	48 8d 15 49 14 00 00 	lea    0x1449(%rip),%rdx        # 30c0 <freelist>
+    1c77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1c7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c83:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c8a:	00 
+    1c8b:	48 8d 05 8e 14 00 00 	lea    0x148e(%rip),%rax        # 3120 <stats>
+    1c92:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c95:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c9c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ca3:	00 
+    1ca4:	48 8d 05 75 14 00 00 	lea    0x1475(%rip),%rax        # 3120 <stats>
+    1cab:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1cae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb2:	48 83 c0 08          	add    $0x8,%rax
+    1cb6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cbd:	00 
+    1cbe:	48 8d 05 5f 14 00 00 	lea    0x145f(%rip),%rax        # 3124 <stats+0x4>
+    1cc5:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1cc8:	8d 48 01             	lea    0x1(%rax),%ecx
+    1ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ccf:	48 83 c0 08          	add    $0x8,%rax
+    1cd3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cda:	00 
+    1cdb:	48 8d 05 42 14 00 00 	lea    0x1442(%rip),%rax        # 3124 <stats+0x4>
+    1ce2:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1ce5:	eb 01                	jmp    1ce8 <free+0x11b>
+    return;
+    1ce7:	90                   	nop
+}
+    1ce8:	c9                   	leave
+    1ce9:	c3                   	ret
+
+0000000000001cea <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1cea:	55                   	push   %rbp
+    1ceb:	48 89 e5             	mov    %rsp,%rbp
+    1cee:	48 83 ec 30          	sub    $0x30,%rsp
+    1cf2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1cf5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cf8:	48 8d 15 09 03 00 00 	lea    0x309(%rip),%rdx        # 2008 <benchreport+0x1f6>
+    1cff:	48 89 d6             	mov    %rdx,%rsi
+    1d02:	89 c7                	mov    %eax,%edi
+    1d04:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d09:	e8 37 e6 ff ff       	call   345 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d0e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1d15:	eb 67                	jmp    1d7e <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1d17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d1a:	48 98                	cltq
+    1d1c:	48 83 c0 08          	add    $0x8,%rax
+    1d20:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d27:	00 
+    1d28:	48 8d 05 f5 13 00 00 	lea    0x13f5(%rip),%rax        # 3124 <stats+0x4>
+    1d2f:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1d32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d35:	48 98                	cltq
+    1d37:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d3e:	00 
+    1d3f:	48 8d 05 da 13 00 00 	lea    0x13da(%rip),%rax        # 3120 <stats>
+    1d46:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1d49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d4c:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d51:	89 c1                	mov    %eax,%ecx
+    1d53:	48 d3 e2             	shl    %cl,%rdx
+    1d56:	48 89 d0             	mov    %rdx,%rax
+    1d59:	89 c1                	mov    %eax,%ecx
+    1d5b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1d5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d61:	41 89 f9             	mov    %edi,%r9d
+    1d64:	41 89 f0             	mov    %esi,%r8d
+    1d67:	48 8d 35 b1 02 00 00 	lea    0x2b1(%rip),%rsi        # 201f <benchreport+0x20d>
+    1d6e:	89 c7                	mov    %eax,%edi
+    1d70:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d75:	e8 cb e5 ff ff       	call   345 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d7a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1d7e:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1d82:	7e 93                	jle    1d17 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1d84:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1d8b:	00 
+  for (r = runs; r; r = r->next)
+    1d8c:	48 8b 05 6d 13 00 00 	mov    0x136d(%rip),%rax        # 3100 <runs>
+    1d93:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d97:	eb 17                	jmp    1db0 <mallocstats+0xc6>
+    nfree += r->size;
+    1d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d9d:	48 8b 00             	mov    (%rax),%rax
+    1da0:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1da4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1da8:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1dac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1db0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1db5:	75 e2                	jne    1d99 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1db7:	48 8b 05 b2 13 00 00 	mov    0x13b2(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1dbe:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1dc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dc4:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1dc8:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1dca:	48 8b 05 97 13 00 00 	mov    0x1397(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1dd1:	89 c1                	mov    %eax,%ecx
+    1dd3:	8b 15 67 13 00 00    	mov    0x1367(%rip),%edx        # 3140 <stats+0x20>
+    1dd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ddc:	41 89 f9             	mov    %edi,%r9d
+    1ddf:	41 89 f0             	mov    %esi,%r8d
+    1de2:	48 8d 35 47 02 00 00 	lea    0x247(%rip),%rsi        # 2030 <benchreport+0x21e>
+    1de9:	89 c7                	mov    %eax,%edi
+    1deb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1df0:	e8 50 e5 ff ff       	call   345 <printf>
+}
+    1df5:	90                   	nop
+    1df6:	c9                   	leave
+    1df7:	c3                   	ret
+
+0000000000001df8 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1df8:	55                   	push   %rbp
+    1df9:	48 89 e5             	mov    %rsp,%rbp
+    1dfc:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1e00:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1e04:	48 89 c7             	mov    %rax,%rdi
+    1e07:	e8 9a f7 ff ff       	call   15a6 <cycles>
+  return t;
+    1e0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1e10:	c9                   	leave
+    1e11:	c3                   	ret
+
+0000000000001e12 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1e12:	55                   	push   %rbp
+    1e13:	48 89 e5             	mov    %rsp,%rbp
+    1e16:	48 83 ec 30          	sub    $0x30,%rsp
+    1e1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e1e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e22:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1e25:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1e29:	0f 8e 24 01 00 00    	jle    1f53 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1e2f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1e36:	e9 98 00 00 00       	jmp    1ed3 <benchreport+0xc1>
+    x = t[i];
+    1e3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e3e:	48 98                	cltq
+    1e40:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e47:	00 
+    1e48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e4c:	48 01 d0             	add    %rdx,%rax
+    1e4f:	48 8b 00             	mov    (%rax),%rax
+    1e52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e59:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1e5c:	eb 33                	jmp    1e91 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1e5e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e61:	48 98                	cltq
+    1e63:	48 c1 e0 03          	shl    $0x3,%rax
+    1e67:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e6f:	48 01 d0             	add    %rdx,%rax
+    1e72:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1e75:	48 63 d2             	movslq %edx,%rdx
+    1e78:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1e7f:	00 
+    1e80:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1e84:	48 01 ca             	add    %rcx,%rdx
+    1e87:	48 8b 00             	mov    (%rax),%rax
+    1e8a:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e8d:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1e91:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1e95:	7e 1d                	jle    1eb4 <benchreport+0xa2>
+    1e97:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e9a:	48 98                	cltq
+    1e9c:	48 c1 e0 03          	shl    $0x3,%rax
+    1ea0:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ea4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ea8:	48 01 d0             	add    %rdx,%rax
+    1eab:	48 8b 00             	mov    (%rax),%rax
+    1eae:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1eb2:	72 aa                	jb     1e5e <benchreport+0x4c>
+    t[j] = x;
+    1eb4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1eb7:	48 98                	cltq
+    1eb9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ec0:	00 
+    1ec1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ec5:	48 01 c2             	add    %rax,%rdx
+    1ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ecc:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1ecf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1ed3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ed6:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1ed9:	0f 8c 5c ff ff ff    	jl     1e3b <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1edf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ee2:	48 98                	cltq
+    1ee4:	48 c1 e0 03          	shl    $0x3,%rax
+    1ee8:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1eec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ef0:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1ef3:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1ef6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ef9:	89 c2                	mov    %eax,%edx
+    1efb:	c1 ea 1f             	shr    $0x1f,%edx
+    1efe:	01 d0                	add    %edx,%eax
+    1f00:	d1 f8                	sar    %eax
+    1f02:	48 98                	cltq
+    1f04:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f0b:	00 
+    1f0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f10:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f13:	48 8b 38             	mov    (%rax),%rdi
+    1f16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f1a:	48 8b 30             	mov    (%rax),%rsi
+    1f1d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f24:	48 83 ec 08          	sub    $0x8,%rsp
+    1f28:	51                   	push   %rcx
+    1f29:	49 89 f9             	mov    %rdi,%r9
+    1f2c:	49 89 f0             	mov    %rsi,%r8
+    1f2f:	89 d1                	mov    %edx,%ecx
+    1f31:	48 89 c2             	mov    %rax,%rdx
+    1f34:	48 8d 05 35 01 00 00 	lea    0x135(%rip),%rax        # 2070 <benchreport+0x25e>
+    1f3b:	48 89 c6             	mov    %rax,%rsi
+    1f3e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f43:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f48:	e8 f8 e3 ff ff       	call   345 <printf>
+    1f4d:	48 83 c4 10          	add    $0x10,%rsp
+    1f51:	eb 01                	jmp    1f54 <benchreport+0x142>
+    return;
+    1f53:	90                   	nop
+}
+    1f54:	c9                   	leave
+    1f55:	c3                   	ret
@@ -0,0 +1,3623 @@
+
+out/user/_ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <fmtname>:
+#include <cdefs.h>
+#include <fs.h>
+#include <stat.h>
+#include <user.h>
+
+char *fmtname(char *path) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	53                   	push   %rbx
+       5:	48 83 ec 28          	sub    $0x28,%rsp
+       9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  static char buf[DIRSIZ + 1];
+  char *p;
+
+  // Find first character after last slash.
+  for (p = path + strlen(path); p >= path && *p != '/'; p--)
+       d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      11:	48 89 c7             	mov    %rax,%rdi
+      14:	e8 81 0e 00 00       	call   e9a <strlen>
+      19:	89 c2                	mov    %eax,%edx
+      1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      1f:	48 01 d0             	add    %rdx,%rax
+      22:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      26:	eb 05                	jmp    2d <fmtname+0x2d>
+      28:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+      2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      31:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+      35:	72 0b                	jb     42 <fmtname+0x42>
+      37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      3b:	0f b6 00             	movzbl (%rax),%eax
+      3e:	3c 2f                	cmp    $0x2f,%al
+      40:	75 e6                	jne    28 <fmtname+0x28>
+    ;
+  p++;
+      42:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+
+  // Return blank-padded name.
+  if (strlen(p) >= DIRSIZ)
+      47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      4b:	48 89 c7             	mov    %rax,%rdi
+      4e:	e8 47 0e 00 00       	call   e9a <strlen>
+      53:	83 f8 0d             	cmp    $0xd,%eax
+      56:	76 06                	jbe    5e <fmtname+0x5e>
+    return p;
+      58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      5c:	eb 67                	jmp    c5 <fmtname+0xc5>
+  memmove(buf, p, strlen(p));
+      5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      62:	48 89 c7             	mov    %rax,%rdi
+      65:	e8 30 0e 00 00       	call   e9a <strlen>
+      6a:	89 c2                	mov    %eax,%edx
+      6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      70:	48 89 c6             	mov    %rax,%rsi
+      73:	48 8d 05 c6 2f 00 00 	lea    0x2fc6(%rip),%rax        # 3040 <buf.0>
+      7a:	48 89 c7             	mov    %rax,%rdi
+      7d:	e8 84 10 00 00       	call   1106 <memmove>
+  memset(buf + strlen(p), ' ', DIRSIZ - strlen(p));
+      82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      86:	48 89 c7             	mov    %rax,%rdi
+      89:	e8 0c 0e 00 00       	call   e9a <strlen>
+      8e:	ba 0e 00 00 00       	mov    $0xe,%edx
+      93:	89 d3                	mov    %edx,%ebx
+      95:	29 c3                	sub    %eax,%ebx
+      97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      9b:	48 89 c7             	mov    %rax,%rdi
+      9e:	e8 f7 0d 00 00       	call   e9a <strlen>
+      a3:	89 c2                	mov    %eax,%edx
+      a5:	48 8d 05 94 2f 00 00 	lea    0x2f94(%rip),%rax        # 3040 <buf.0>
+      ac:	48 01 d0             	add    %rdx,%rax
+      af:	89 da                	mov    %ebx,%edx
+      b1:	be 20 00 00 00       	mov    $0x20,%esi
+      b6:	48 89 c7             	mov    %rax,%rdi
+      b9:	e8 7c 0e 00 00       	call   f3a <memset>
+  return buf;
+      be:	48 8d 05 7b 2f 00 00 	lea    0x2f7b(%rip),%rax        # 3040 <buf.0>
+}
+      c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+      c9:	c9                   	leave
+      ca:	c3                   	ret
+
+00000000000000cb <ls>:
+
+void ls(char *path) {
+      cb:	55                   	push   %rbp
+      cc:	48 89 e5             	mov    %rsp,%rbp
+      cf:	41 55                	push   %r13
+      d1:	41 54                	push   %r12
+      d3:	53                   	push   %rbx
+      d4:	48 81 ec 48 04 00 00 	sub    $0x448,%rsp
+      db:	48 89 bd a8 fb ff ff 	mov    %rdi,-0x458(%rbp)
+  char name[DIRSIZ + 1];
+  int fd, n, i;
+  struct dirent des[64];
+  struct stat st;
+
+  if ((fd = open(path, 0)) < 0) {
+      e2:	48 8b 85 a8 fb ff ff 	mov    -0x458(%rbp),%rax
+      e9:	be 00 00 00 00       	mov    $0x0,%esi
+      ee:	48 89 c7             	mov    %rax,%rdi
+      f1:	e8 2e 15 00 00       	call   1624 <open>
+      f6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+      f9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+      fd:	79 28                	jns    127 <ls+0x5c>
+    printf(2, "ls: cannot open %s\n", path);
+      ff:	48 8b 85 a8 fb ff ff 	mov    -0x458(%rbp),%rax
+     106:	48 89 c2             	mov    %rax,%rdx
+     109:	48 8d 05 20 20 00 00 	lea    0x2020(%rip),%rax        # 2130 <benchreport+0x14b>
+     110:	48 89 c6             	mov    %rax,%rsi
+     113:	bf 02 00 00 00       	mov    $0x2,%edi
+     118:	b8 00 00 00 00       	mov    $0x0,%eax
+     11d:	e8 f6 03 00 00       	call   518 <printf>
+    return;
+     122:	e9 c3 01 00 00       	jmp    2ea <ls+0x21f>
+  }
+
+  if (fstat(fd, &st) < 0) {
+     127:	48 8d 95 b4 fb ff ff 	lea    -0x44c(%rbp),%rdx
+     12e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     131:	48 89 d6             	mov    %rdx,%rsi
+     134:	89 c7                	mov    %eax,%edi
+     136:	e8 0a 15 00 00       	call   1645 <fstat>
+     13b:	85 c0                	test   %eax,%eax
+     13d:	79 32                	jns    171 <ls+0xa6>
+    printf(2, "ls: cannot stat %s\n", path);
+     13f:	48 8b 85 a8 fb ff ff 	mov    -0x458(%rbp),%rax
+     146:	48 89 c2             	mov    %rax,%rdx
+     149:	48 8d 05 f4 1f 00 00 	lea    0x1ff4(%rip),%rax        # 2144 <benchreport+0x15f>
+     150:	48 89 c6             	mov    %rax,%rsi
+     153:	bf 02 00 00 00       	mov    $0x2,%edi
+     158:	b8 00 00 00 00       	mov    $0x0,%eax
+     15d:	e8 b6 03 00 00       	call   518 <printf>
+    close(fd);
+     162:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     165:	89 c7                	mov    %eax,%edi
+     167:	e8 46 0a 00 00       	call   bb2 <close>
+    return;
+     16c:	e9 79 01 00 00       	jmp    2ea <ls+0x21f>
+  }
+
+  switch (st.type) {
+     171:	0f b7 85 b4 fb ff ff 	movzwl -0x44c(%rbp),%eax
+     178:	98                   	cwtl
+     179:	83 f8 01             	cmp    $0x1,%eax
+     17c:	0f 84 37 01 00 00    	je     2b9 <ls+0x1ee>
+     182:	83 f8 02             	cmp    $0x2,%eax
+     185:	0f 85 55 01 00 00    	jne    2e0 <ls+0x215>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     18b:	44 8b ad c0 fb ff ff 	mov    -0x440(%rbp),%r13d
+     192:	44 8b a5 bc fb ff ff 	mov    -0x444(%rbp),%r12d
+     199:	0f b7 85 b4 fb ff ff 	movzwl -0x44c(%rbp),%eax
+     1a0:	0f bf d8             	movswl %ax,%ebx
+     1a3:	48 8b 85 a8 fb ff ff 	mov    -0x458(%rbp),%rax
+     1aa:	48 89 c7             	mov    %rax,%rdi
+     1ad:	e8 4e fe ff ff       	call   0 <fmtname>
+     1b2:	45 89 e9             	mov    %r13d,%r9d
+     1b5:	45 89 e0             	mov    %r12d,%r8d
+     1b8:	89 d9                	mov    %ebx,%ecx
+     1ba:	48 89 c2             	mov    %rax,%rdx
+     1bd:	48 8d 05 94 1f 00 00 	lea    0x1f94(%rip),%rax        # 2158 <benchreport+0x173>
+     1c4:	48 89 c6             	mov    %rax,%rsi
+     1c7:	bf 01 00 00 00       	mov    $0x1,%edi
+     1cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d1:	e8 42 03 00 00       	call   518 <printf>
+    break;
+     1d6:	e9 05 01 00 00       	jmp    2e0 <ls+0x215>
+
+  case T_DIR:
+    // A batch of entries per call, each looked up in the directory
+    // without opening it
+    while ((n = getdents(fd, des, sizeof(des))) > 0) {
+      for (i = 0; i < n / sizeof(des[0]); i++) {
+     1db:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+     1e2:	e9 ba 00 00 00       	jmp    2a1 <ls+0x1d6>
+        memmove(name, des[i].name, DIRSIZ);
+     1e7:	48 8d 85 c4 fb ff ff 	lea    -0x43c(%rbp),%rax
+     1ee:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     1f1:	48 63 d2             	movslq %edx,%rdx
+     1f4:	48 c1 e2 04          	shl    $0x4,%rdx
+     1f8:	48 01 d0             	add    %rdx,%rax
+     1fb:	48 8d 48 02          	lea    0x2(%rax),%rcx
+     1ff:	48 8d 45 c5          	lea    -0x3b(%rbp),%rax
+     203:	ba 0e 00 00 00       	mov    $0xe,%edx
+     208:	48 89 ce             	mov    %rcx,%rsi
+     20b:	48 89 c7             	mov    %rax,%rdi
+     20e:	e8 f3 0e 00 00       	call   1106 <memmove>
+        name[DIRSIZ] = 0;
+     213:	c6 45 d3 00          	movb   $0x0,-0x2d(%rbp)
+        if (fstatat(fd, name, &st) < 0) {
+     217:	48 8d 95 b4 fb ff ff 	lea    -0x44c(%rbp),%rdx
+     21e:	48 8d 4d c5          	lea    -0x3b(%rbp),%rcx
+     222:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     225:	48 89 ce             	mov    %rcx,%rsi
+     228:	89 c7                	mov    %eax,%edi
+     22a:	e8 d9 15 00 00       	call   1808 <fstatat>
+     22f:	85 c0                	test   %eax,%eax
+     231:	79 22                	jns    255 <ls+0x18a>
+          printf(1, "ls: cannot stat %s\n", name);
+     233:	48 8d 45 c5          	lea    -0x3b(%rbp),%rax
+     237:	48 89 c2             	mov    %rax,%rdx
+     23a:	48 8d 05 03 1f 00 00 	lea    0x1f03(%rip),%rax        # 2144 <benchreport+0x15f>
+     241:	48 89 c6             	mov    %rax,%rsi
+     244:	bf 01 00 00 00       	mov    $0x1,%edi
+     249:	b8 00 00 00 00       	mov    $0x0,%eax
+     24e:	e8 c5 02 00 00       	call   518 <printf>
+          continue;
+     253:	eb 48                	jmp    29d <ls+0x1d2>
+        }
+        printf(1, "%s %d %d %d\n", fmtname(name), st.type, st.ino, st.size);
+     255:	44 8b ad c0 fb ff ff 	mov    -0x440(%rbp),%r13d
+     25c:	44 8b a5 bc fb ff ff 	mov    -0x444(%rbp),%r12d
+     263:	0f b7 85 b4 fb ff ff 	movzwl -0x44c(%rbp),%eax
+     26a:	0f bf d8             	movswl %ax,%ebx
+     26d:	48 8d 45 c5          	lea    -0x3b(%rbp),%rax
+     271:	48 89 c7             	mov    %rax,%rdi
+     274:	e8 87 fd ff ff       	call   0 <fmtname>
+     279:	45 89 e9             	mov    %r13d,%r9d
+     27c:	45 89 e0             	mov    %r12d,%r8d
+     27f:	89 d9                	mov    %ebx,%ecx
+     281:	48 89 c2             	mov    %rax,%rdx
+     284:	48 8d 05 cd 1e 00 00 	lea    0x1ecd(%rip),%rax        # 2158 <benchreport+0x173>
+     28b:	48 89 c6             	mov    %rax,%rsi
+     28e:	bf 01 00 00 00       	mov    $0x1,%edi
+     293:	b8 00 00 00 00       	mov    $0x0,%eax
+     298:	e8 7b 02 00 00       	call   518 <printf>
+      for (i = 0; i < n / sizeof(des[0]); i++) {
+     29d:	83 45 dc 01          	addl   $0x1,-0x24(%rbp)
+     2a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     2a4:	48 63 d0             	movslq %eax,%rdx
+     2a7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     2aa:	48 98                	cltq
+     2ac:	48 c1 e8 04          	shr    $0x4,%rax
+     2b0:	48 39 c2             	cmp    %rax,%rdx
+     2b3:	0f 82 2e ff ff ff    	jb     1e7 <ls+0x11c>
+    while ((n = getdents(fd, des, sizeof(des))) > 0) {
+     2b9:	48 8d 8d c4 fb ff ff 	lea    -0x43c(%rbp),%rcx
+     2c0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2c3:	ba 00 04 00 00       	mov    $0x400,%edx
+     2c8:	48 89 ce             	mov    %rcx,%rsi
+     2cb:	89 c7                	mov    %eax,%edi
+     2cd:	e8 2b 15 00 00       	call   17fd <getdents>
+     2d2:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+     2d5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+     2d9:	0f 8f fc fe ff ff    	jg     1db <ls+0x110>
+      }
+    }
+    break;
+     2df:	90                   	nop
+  }
+  close(fd);
+     2e0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     2e3:	89 c7                	mov    %eax,%edi
+     2e5:	e8 c8 08 00 00       	call   bb2 <close>
+}
+     2ea:	48 81 c4 48 04 00 00 	add    $0x448,%rsp
+     2f1:	5b                   	pop    %rbx
+     2f2:	41 5c                	pop    %r12
+     2f4:	41 5d                	pop    %r13
+     2f6:	5d                   	pop    %rbp
+     2f7:	c3                   	ret
+
+00000000000002f8 <main>:
+
+int main(int argc, char *argv[]) {
+     2f8:	55                   	push   %rbp
+     2f9:	48 89 e5             	mov    %rsp,%rbp
+     2fc:	48 83 ec 20          	sub    $0x20,%rsp
+     300:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     303:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (argc < 2) {
+     307:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     30b:	7f 14                	jg     321 <main+0x29>
+    ls(".");
+     30d:	48 8d 05 51 1e 00 00 	lea    0x1e51(%rip),%rax        # 2165 <benchreport+0x180>
+     314:	48 89 c7             	mov    %rax,%rdi
+     317:	e8 af fd ff ff       	call   cb <ls>
+    exit();
+     31c:	e8 27 08 00 00       	call   b48 <exit>
+  }
+  for (i = 1; i < argc; i++)
+     321:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     328:	eb 23                	jmp    34d <main+0x55>
+    ls(argv[i]);
+     32a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     32d:	48 98                	cltq
+     32f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     336:	00 
+     337:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     33b:	48 01 d0             	add    %rdx,%rax
+     33e:	48 8b 00             	mov    (%rax),%rax
+     341:	48 89 c7             	mov    %rax,%rdi
+     344:	e8 82 fd ff ff       	call   cb <ls>
+  for (i = 1; i < argc; i++)
+     349:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     34d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     350:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     353:	7c d5                	jl     32a <main+0x32>
+  exit();
+     355:	e8 ee 07 00 00       	call   b48 <exit>
+
+000000000000035a <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     35a:	55                   	push   %rbp
+     35b:	48 89 e5             	mov    %rsp,%rbp
+     35e:	48 83 ec 10          	sub    $0x10,%rsp
+     362:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     365:	89 f0                	mov    %esi,%eax
+     367:	88 45 f8             	mov    %al,-0x8(%rbp)
+     36a:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     36e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     371:	89 d6                	mov    %edx,%esi
+     373:	89 c7                	mov    %eax,%edi
+     375:	e8 eb 06 00 00       	call   a65 <bputc>
+     37a:	90                   	nop
+     37b:	c9                   	leave
+     37c:	c3                   	ret
+
+000000000000037d <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     37d:	55                   	push   %rbp
+     37e:	48 89 e5             	mov    %rsp,%rbp
+     381:	48 83 ec 50          	sub    $0x50,%rsp
+     385:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     388:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     38c:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     38f:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     392:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     396:	74 21                	je     3b9 <printint64+0x3c>
+     398:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     39c:	48 c1 e8 3f          	shr    $0x3f,%rax
+     3a0:	0f b6 c0             	movzbl %al,%eax
+     3a3:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     3a6:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     3aa:	74 0d                	je     3b9 <printint64+0x3c>
+    x = -xx;
+     3ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     3b0:	48 f7 d8             	neg    %rax
+     3b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     3b7:	eb 08                	jmp    3c1 <printint64+0x44>
+  else
+    x = xx;
+     3b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     3bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     3c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     3c8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     3cb:	48 63 c8             	movslq %eax,%rcx
+     3ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3d2:	ba 00 00 00 00       	mov    $0x0,%edx
+     3d7:	48 f7 f1             	div    %rcx
+     3da:	48 89 d1             	mov    %rdx,%rcx
+     3dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3e0:	8d 50 01             	lea    0x1(%rax),%edx
+     3e3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3e6:	48 8d 15 13 2c 00 00 	lea    0x2c13(%rip),%rdx        # 3000 <digits.1>
+     3ed:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     3f1:	48 98                	cltq
+     3f3:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     3f7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     3fa:	48 63 f0             	movslq %eax,%rsi
+     3fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     401:	ba 00 00 00 00       	mov    $0x0,%edx
+     406:	48 f7 f6             	div    %rsi
+     409:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     40d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     412:	75 b4                	jne    3c8 <printint64+0x4b>
+
+  if (sgn)
+     414:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     418:	74 2b                	je     445 <printint64+0xc8>
+    buf[i++] = '-';
+     41a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     41d:	8d 50 01             	lea    0x1(%rax),%edx
+     420:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     423:	48 98                	cltq
+     425:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     42a:	eb 19                	jmp    445 <printint64+0xc8>
+    putc(fd, buf[i]);
+     42c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     42f:	48 98                	cltq
+     431:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     436:	0f be d0             	movsbl %al,%edx
+     439:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     43c:	89 d6                	mov    %edx,%esi
+     43e:	89 c7                	mov    %eax,%edi
+     440:	e8 15 ff ff ff       	call   35a <putc>
+  while (--i >= 0)
+     445:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     449:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     44d:	79 dd                	jns    42c <printint64+0xaf>
+}
+     44f:	90                   	nop
+     450:	90                   	nop
+     451:	c9                   	leave
+     452:	c3                   	ret
+
+0000000000000453 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     453:	55                   	push   %rbp
+     454:	48 89 e5             	mov    %rsp,%rbp
+     457:	48 83 ec 30          	sub    $0x30,%rsp
+     45b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     45e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     461:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     464:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     467:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     46e:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     472:	74 17                	je     48b <printint+0x38>
+     474:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     478:	79 11                	jns    48b <printint+0x38>
+    neg = 1;
+     47a:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     481:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     484:	f7 d8                	neg    %eax
+     486:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     489:	eb 06                	jmp    491 <printint+0x3e>
+  } else {
+    x = xx;
+     48b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     48e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     491:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     498:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     49b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     49e:	ba 00 00 00 00       	mov    $0x0,%edx
+     4a3:	f7 f1                	div    %ecx
+     4a5:	89 d1                	mov    %edx,%ecx
+     4a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4aa:	8d 50 01             	lea    0x1(%rax),%edx
+     4ad:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4b0:	89 c9                	mov    %ecx,%ecx
+     4b2:	48 8d 15 67 2b 00 00 	lea    0x2b67(%rip),%rdx        # 3020 <digits.0>
+     4b9:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     4bd:	48 98                	cltq
+     4bf:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     4c3:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     4c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4c9:	ba 00 00 00 00       	mov    $0x0,%edx
+     4ce:	f7 f6                	div    %esi
+     4d0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     4d3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     4d7:	75 bf                	jne    498 <printint+0x45>
+  if (neg)
+     4d9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     4dd:	74 2b                	je     50a <printint+0xb7>
+    buf[i++] = '-';
+     4df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4e2:	8d 50 01             	lea    0x1(%rax),%edx
+     4e5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4e8:	48 98                	cltq
+     4ea:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     4ef:	eb 19                	jmp    50a <printint+0xb7>
+    putc(fd, buf[i]);
+     4f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4f4:	48 98                	cltq
+     4f6:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     4fb:	0f be d0             	movsbl %al,%edx
+     4fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     501:	89 d6                	mov    %edx,%esi
+     503:	89 c7                	mov    %eax,%edi
+     505:	e8 50 fe ff ff       	call   35a <putc>
+  while (--i >= 0)
+     50a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     50e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     512:	79 dd                	jns    4f1 <printint+0x9e>
+}
+     514:	90                   	nop
+     515:	90                   	nop
+     516:	c9                   	leave
+     517:	c3                   	ret
+
+0000000000000518 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     518:	55                   	push   %rbp
+     519:	48 89 e5             	mov    %rsp,%rbp
+     51c:	48 83 ec 70          	sub    $0x70,%rsp
+     520:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     523:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     527:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     52b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     52f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     533:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     537:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     53e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     542:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     546:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     54a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     54e:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     555:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     55c:	e9 67 02 00 00       	jmp    7c8 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     561:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     564:	48 63 d0             	movslq %eax,%rdx
+     567:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     56b:	48 01 d0             	add    %rdx,%rax
+     56e:	0f b6 00             	movzbl (%rax),%eax
+     571:	0f be c0             	movsbl %al,%eax
+     574:	25 ff 00 00 00       	and    $0xff,%eax
+     579:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     57c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     580:	75 30                	jne    5b2 <printf+0x9a>
+      if (c == '%') {
+     582:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     586:	75 13                	jne    59b <printf+0x83>
+        state = '%';
+     588:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     58f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     596:	e9 29 02 00 00       	jmp    7c4 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     59b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     59e:	0f be d0             	movsbl %al,%edx
+     5a1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5a4:	89 d6                	mov    %edx,%esi
+     5a6:	89 c7                	mov    %eax,%edi
+     5a8:	e8 ad fd ff ff       	call   35a <putc>
+     5ad:	e9 12 02 00 00       	jmp    7c4 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     5b2:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     5b6:	0f 85 08 02 00 00    	jne    7c4 <printf+0x2ac>
+      if (c == 'l') {
+     5bc:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     5c0:	75 0c                	jne    5ce <printf+0xb6>
+        lflag = 1;
+     5c2:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     5c9:	e9 f6 01 00 00       	jmp    7c4 <printf+0x2ac>
+      } else if (c == 'd') {
+     5ce:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     5d2:	0f 85 93 00 00 00    	jne    66b <printf+0x153>
+        if (lflag == 1)
+     5d8:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     5dc:	75 47                	jne    625 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     5de:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     5e1:	83 f8 2f             	cmp    $0x2f,%eax
+     5e4:	77 17                	ja     5fd <printf+0xe5>
+     5e6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     5ea:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5ed:	89 d2                	mov    %edx,%edx
+     5ef:	48 01 d0             	add    %rdx,%rax
+     5f2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5f5:	83 c2 08             	add    $0x8,%edx
+     5f8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     5fb:	eb 0c                	jmp    609 <printf+0xf1>
+     5fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     601:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     605:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     609:	48 8b 30             	mov    (%rax),%rsi
+     60c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     60f:	b9 01 00 00 00       	mov    $0x1,%ecx
+     614:	ba 0a 00 00 00       	mov    $0xa,%edx
+     619:	89 c7                	mov    %eax,%edi
+     61b:	e8 5d fd ff ff       	call   37d <printint64>
+     620:	e9 98 01 00 00       	jmp    7bd <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     625:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     628:	83 f8 2f             	cmp    $0x2f,%eax
+     62b:	77 17                	ja     644 <printf+0x12c>
+     62d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     631:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     634:	89 d2                	mov    %edx,%edx
+     636:	48 01 d0             	add    %rdx,%rax
+     639:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     63c:	83 c2 08             	add    $0x8,%edx
+     63f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     642:	eb 0c                	jmp    650 <printf+0x138>
+     644:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     648:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     64c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     650:	8b 30                	mov    (%rax),%esi
+     652:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     655:	b9 01 00 00 00       	mov    $0x1,%ecx
+     65a:	ba 0a 00 00 00       	mov    $0xa,%edx
+     65f:	89 c7                	mov    %eax,%edi
+     661:	e8 ed fd ff ff       	call   453 <printint>
+     666:	e9 52 01 00 00       	jmp    7bd <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     66b:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     66f:	74 0a                	je     67b <printf+0x163>
+     671:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     675:	0f 85 93 00 00 00    	jne    70e <printf+0x1f6>
+        if (lflag == 1)
+     67b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     67f:	75 47                	jne    6c8 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     681:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     684:	83 f8 2f             	cmp    $0x2f,%eax
+     687:	77 17                	ja     6a0 <printf+0x188>
+     689:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     68d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     690:	89 d2                	mov    %edx,%edx
+     692:	48 01 d0             	add    %rdx,%rax
+     695:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     698:	83 c2 08             	add    $0x8,%edx
+     69b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     69e:	eb 0c                	jmp    6ac <printf+0x194>
+     6a0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     6a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     6a8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     6ac:	48 8b 30             	mov    (%rax),%rsi
+     6af:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+     6b7:	ba 10 00 00 00       	mov    $0x10,%edx
+     6bc:	89 c7                	mov    %eax,%edi
+     6be:	e8 ba fc ff ff       	call   37d <printint64>
+        if (lflag == 1)
+     6c3:	e9 f5 00 00 00       	jmp    7bd <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     6c8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     6cb:	83 f8 2f             	cmp    $0x2f,%eax
+     6ce:	77 17                	ja     6e7 <printf+0x1cf>
+     6d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     6d4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6d7:	89 d2                	mov    %edx,%edx
+     6d9:	48 01 d0             	add    %rdx,%rax
+     6dc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6df:	83 c2 08             	add    $0x8,%edx
+     6e2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     6e5:	eb 0c                	jmp    6f3 <printf+0x1db>
+     6e7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     6eb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     6ef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     6f3:	8b 30                	mov    (%rax),%esi
+     6f5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+     6fd:	ba 10 00 00 00       	mov    $0x10,%edx
+     702:	89 c7                	mov    %eax,%edi
+     704:	e8 4a fd ff ff       	call   453 <printint>
+        if (lflag == 1)
+     709:	e9 af 00 00 00       	jmp    7bd <printf+0x2a5>
+      } else if (c == 's') {
+     70e:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     712:	75 6e                	jne    782 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     714:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     717:	83 f8 2f             	cmp    $0x2f,%eax
+     71a:	77 17                	ja     733 <printf+0x21b>
+     71c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     720:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     723:	89 d2                	mov    %edx,%edx
+     725:	48 01 d0             	add    %rdx,%rax
+     728:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     72b:	83 c2 08             	add    $0x8,%edx
+     72e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     731:	eb 0c                	jmp    73f <printf+0x227>
+     733:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     737:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     73b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     73f:	48 8b 00             	mov    (%rax),%rax
+     742:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     746:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     74b:	75 28                	jne    775 <printf+0x25d>
+          s = "(null)";
+     74d:	48 8d 05 13 1a 00 00 	lea    0x1a13(%rip),%rax        # 2167 <benchreport+0x182>
+     754:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     758:	eb 1b                	jmp    775 <printf+0x25d>
+          putc(fd, *s);
+     75a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     75e:	0f b6 00             	movzbl (%rax),%eax
+     761:	0f be d0             	movsbl %al,%edx
+     764:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     767:	89 d6                	mov    %edx,%esi
+     769:	89 c7                	mov    %eax,%edi
+     76b:	e8 ea fb ff ff       	call   35a <putc>
+        for (; *s; s++)
+     770:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     775:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     779:	0f b6 00             	movzbl (%rax),%eax
+     77c:	84 c0                	test   %al,%al
+     77e:	75 da                	jne    75a <printf+0x242>
+     780:	eb 3b                	jmp    7bd <printf+0x2a5>
+      } else if (c == '%') {
+     782:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     786:	75 14                	jne    79c <printf+0x284>
+        putc(fd, c);
+     788:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     78b:	0f be d0             	movsbl %al,%edx
+     78e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     791:	89 d6                	mov    %edx,%esi
+     793:	89 c7                	mov    %eax,%edi
+     795:	e8 c0 fb ff ff       	call   35a <putc>
+     79a:	eb 21                	jmp    7bd <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     79c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     79f:	be 25 00 00 00       	mov    $0x25,%esi
+     7a4:	89 c7                	mov    %eax,%edi
+     7a6:	e8 af fb ff ff       	call   35a <putc>
+        putc(fd, c);
+     7ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     7ae:	0f be d0             	movsbl %al,%edx
+     7b1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7b4:	89 d6                	mov    %edx,%esi
+     7b6:	89 c7                	mov    %eax,%edi
+     7b8:	e8 9d fb ff ff       	call   35a <putc>
+      }
+      state = 0;
+     7bd:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     7c4:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     7c8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     7cb:	48 63 d0             	movslq %eax,%rdx
+     7ce:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     7d2:	48 01 d0             	add    %rdx,%rax
+     7d5:	0f b6 00             	movzbl (%rax),%eax
+     7d8:	84 c0                	test   %al,%al
+     7da:	0f 85 81 fd ff ff    	jne    561 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     7e0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7e3:	89 c7                	mov    %eax,%edi
+     7e5:	e8 ee 02 00 00       	call   ad8 <bflushtty>
+}
+     7ea:	90                   	nop
+     7eb:	c9                   	leave
+     7ec:	c3                   	ret
+
+00000000000007ed <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     7ed:	55                   	push   %rbp
+     7ee:	48 89 e5             	mov    %rsp,%rbp
+     7f1:	48 83 ec 30          	sub    $0x30,%rsp
+     7f5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     7f8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     7fc:	78 06                	js     804 <getbuf+0x17>
+     7fe:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     802:	7e 0a                	jle    80e <getbuf+0x21>
+    return 0;
+     804:	b8 00 00 00 00       	mov    $0x0,%eax
+     809:	e9 94 00 00 00       	jmp    8a2 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     80e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     811:	48 98                	cltq
+     813:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     81a:	00 
+     81b:	48 8d 05 3e 28 00 00 	lea    0x283e(%rip),%rax        # 3060 <obufs>
+     822:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     826:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     82a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     82f:	75 6d                	jne    89e <getbuf+0xb1>
+     831:	bf 08 02 00 00       	mov    $0x208,%edi
+     836:	e8 bd 13 00 00       	call   1bf8 <malloc>
+     83b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     83f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     844:	74 58                	je     89e <getbuf+0xb1>
+    b->n = 0;
+     846:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     84a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     850:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     854:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     857:	48 89 d6             	mov    %rdx,%rsi
+     85a:	89 c7                	mov    %eax,%edi
+     85c:	e8 e4 0d 00 00       	call   1645 <fstat>
+     861:	85 c0                	test   %eax,%eax
+     863:	75 11                	jne    876 <getbuf+0x89>
+     865:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     869:	66 83 f8 03          	cmp    $0x3,%ax
+     86d:	75 07                	jne    876 <getbuf+0x89>
+     86f:	ba 01 00 00 00       	mov    $0x1,%edx
+     874:	eb 05                	jmp    87b <getbuf+0x8e>
+     876:	ba 00 00 00 00       	mov    $0x0,%edx
+     87b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     87f:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     882:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     885:	48 98                	cltq
+     887:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     88e:	00 
+     88f:	48 8d 15 ca 27 00 00 	lea    0x27ca(%rip),%rdx        # 3060 <obufs>
+     896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     89a:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     89e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     8a2:	c9                   	leave
+     8a3:	c3                   	ret
+
+00000000000008a4 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     8a4:	55                   	push   %rbp
+     8a5:	48 89 e5             	mov    %rsp,%rbp
+     8a8:	48 83 ec 20          	sub    $0x20,%rsp
+     8ac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     8af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     8b3:	78 33                	js     8e8 <bflush+0x44>
+     8b5:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     8b9:	7f 2d                	jg     8e8 <bflush+0x44>
+     8bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8be:	48 98                	cltq
+     8c0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8c7:	00 
+     8c8:	48 8d 05 91 27 00 00 	lea    0x2791(%rip),%rax        # 3060 <obufs>
+     8cf:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8d7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8dc:	74 0a                	je     8e8 <bflush+0x44>
+     8de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8e2:	8b 00                	mov    (%rax),%eax
+     8e4:	85 c0                	test   %eax,%eax
+     8e6:	75 07                	jne    8ef <bflush+0x4b>
+    return 0;
+     8e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8ed:	eb 3c                	jmp    92b <bflush+0x87>
+  n = b->n;
+     8ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8f3:	8b 00                	mov    (%rax),%eax
+     8f5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     8f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8fc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     906:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     90a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     90d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     910:	48 89 ce             	mov    %rcx,%rsi
+     913:	89 c7                	mov    %eax,%edi
+     915:	e8 de 0c 00 00       	call   15f8 <write>
+     91a:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     91d:	75 07                	jne    926 <bflush+0x82>
+     91f:	b8 00 00 00 00       	mov    $0x0,%eax
+     924:	eb 05                	jmp    92b <bflush+0x87>
+     926:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     92b:	c9                   	leave
+     92c:	c3                   	ret
+
+000000000000092d <bflushall>:
+
+void bflushall(void) {
+     92d:	55                   	push   %rbp
+     92e:	48 89 e5             	mov    %rsp,%rbp
+     931:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     935:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     93c:	eb 0e                	jmp    94c <bflushall+0x1f>
+    bflush(fd);
+     93e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     941:	89 c7                	mov    %eax,%edi
+     943:	e8 5c ff ff ff       	call   8a4 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     948:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     94c:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     950:	7e ec                	jle    93e <bflushall+0x11>
+}
+     952:	90                   	nop
+     953:	90                   	nop
+     954:	c9                   	leave
+     955:	c3                   	ret
+
+0000000000000956 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     956:	55                   	push   %rbp
+     957:	48 89 e5             	mov    %rsp,%rbp
+     95a:	48 83 ec 30          	sub    $0x30,%rsp
+     95e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     961:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     965:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     968:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     96b:	89 c7                	mov    %eax,%edi
+     96d:	e8 7b fe ff ff       	call   7ed <getbuf>
+     972:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     976:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     97b:	75 19                	jne    996 <bwrite+0x40>
+    return write(fd, s, n);
+     97d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     980:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     984:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     987:	48 89 ce             	mov    %rcx,%rsi
+     98a:	89 c7                	mov    %eax,%edi
+     98c:	e8 67 0c 00 00       	call   15f8 <write>
+     991:	e9 cd 00 00 00       	jmp    a63 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     996:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     99d:	e9 92 00 00 00       	jmp    a34 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     9a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9a6:	8b 00                	mov    (%rax),%eax
+     9a8:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9ad:	75 18                	jne    9c7 <bwrite+0x71>
+     9af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     9b2:	89 c7                	mov    %eax,%edi
+     9b4:	e8 eb fe ff ff       	call   8a4 <bflush>
+     9b9:	85 c0                	test   %eax,%eax
+     9bb:	79 0a                	jns    9c7 <bwrite+0x71>
+      return -1;
+     9bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9c2:	e9 9c 00 00 00       	jmp    a63 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     9c7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     9ca:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     9cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     9d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9d4:	8b 00                	mov    (%rax),%eax
+     9d6:	ba 00 02 00 00       	mov    $0x200,%edx
+     9db:	29 c2                	sub    %eax,%edx
+     9dd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     9e0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     9e3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     9e6:	39 c2                	cmp    %eax,%edx
+     9e8:	0f 4e c2             	cmovle %edx,%eax
+     9eb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     9ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9f1:	48 63 d0             	movslq %eax,%rdx
+     9f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     9f8:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     9fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a00:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a08:	8b 00                	mov    (%rax),%eax
+     a0a:	48 98                	cltq
+     a0c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     a10:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a13:	89 c2                	mov    %eax,%edx
+     a15:	48 89 cf             	mov    %rcx,%rdi
+     a18:	e8 e9 06 00 00       	call   1106 <memmove>
+    b->n += m;
+     a1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a21:	8b 10                	mov    (%rax),%edx
+     a23:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a26:	01 c2                	add    %eax,%edx
+     a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a2c:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     a2e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a31:	01 45 fc             	add    %eax,-0x4(%rbp)
+     a34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a37:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     a3a:	0f 8c 62 ff ff ff    	jl     9a2 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     a40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a44:	8b 40 04             	mov    0x4(%rax),%eax
+     a47:	85 c0                	test   %eax,%eax
+     a49:	74 15                	je     a60 <bwrite+0x10a>
+     a4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a4e:	89 c7                	mov    %eax,%edi
+     a50:	e8 4f fe ff ff       	call   8a4 <bflush>
+     a55:	85 c0                	test   %eax,%eax
+     a57:	79 07                	jns    a60 <bwrite+0x10a>
+    return -1;
+     a59:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a5e:	eb 03                	jmp    a63 <bwrite+0x10d>
+  return n;
+     a60:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     a63:	c9                   	leave
+     a64:	c3                   	ret
+
+0000000000000a65 <bputc>:
+
+void bputc(int fd, char c) {
+     a65:	55                   	push   %rbp
+     a66:	48 89 e5             	mov    %rsp,%rbp
+     a69:	48 83 ec 20          	sub    $0x20,%rsp
+     a6d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     a70:	89 f0                	mov    %esi,%eax
+     a72:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     a75:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a78:	89 c7                	mov    %eax,%edi
+     a7a:	e8 6e fd ff ff       	call   7ed <getbuf>
+     a7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a83:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a88:	75 18                	jne    aa2 <bputc+0x3d>
+    write(fd, &c, 1);
+     a8a:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     a8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a91:	ba 01 00 00 00       	mov    $0x1,%edx
+     a96:	48 89 ce             	mov    %rcx,%rsi
+     a99:	89 c7                	mov    %eax,%edi
+     a9b:	e8 58 0b 00 00       	call   15f8 <write>
+    return;
+     aa0:	eb 34                	jmp    ad6 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aa6:	8b 00                	mov    (%rax),%eax
+     aa8:	3d 00 02 00 00       	cmp    $0x200,%eax
+     aad:	75 0a                	jne    ab9 <bputc+0x54>
+    bflush(fd);
+     aaf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ab2:	89 c7                	mov    %eax,%edi
+     ab4:	e8 eb fd ff ff       	call   8a4 <bflush>
+  b->data[b->n++] = c;
+     ab9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     abd:	8b 00                	mov    (%rax),%eax
+     abf:	8d 48 01             	lea    0x1(%rax),%ecx
+     ac2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     ac6:	89 0a                	mov    %ecx,(%rdx)
+     ac8:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     acc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     ad0:	48 98                	cltq
+     ad2:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     ad6:	c9                   	leave
+     ad7:	c3                   	ret
+
+0000000000000ad8 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     ad8:	55                   	push   %rbp
+     ad9:	48 89 e5             	mov    %rsp,%rbp
+     adc:	48 83 ec 10          	sub    $0x10,%rsp
+     ae0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     ae3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     ae7:	78 4c                	js     b35 <bflushtty+0x5d>
+     ae9:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     aed:	7f 46                	jg     b35 <bflushtty+0x5d>
+     aef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     af2:	48 98                	cltq
+     af4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     afb:	00 
+     afc:	48 8d 05 5d 25 00 00 	lea    0x255d(%rip),%rax        # 3060 <obufs>
+     b03:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b07:	48 85 c0             	test   %rax,%rax
+     b0a:	74 29                	je     b35 <bflushtty+0x5d>
+     b0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b0f:	48 98                	cltq
+     b11:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     b18:	00 
+     b19:	48 8d 05 40 25 00 00 	lea    0x2540(%rip),%rax        # 3060 <obufs>
+     b20:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b24:	8b 40 04             	mov    0x4(%rax),%eax
+     b27:	85 c0                	test   %eax,%eax
+     b29:	74 0a                	je     b35 <bflushtty+0x5d>
+    bflush(fd);
+     b2b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b2e:	89 c7                	mov    %eax,%edi
+     b30:	e8 6f fd ff ff       	call   8a4 <bflush>
+}
+     b35:	90                   	nop
+     b36:	c9                   	leave
+     b37:	c3                   	ret
+
+0000000000000b38 <fork>:
+
+int fork(void) {
+     b38:	55                   	push   %rbp
+     b39:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     b3c:	e8 ec fd ff ff       	call   92d <bflushall>
+  return _fork();
+     b41:	e8 7b 0a 00 00       	call   15c1 <_fork>
+}
+     b46:	5d                   	pop    %rbp
+     b47:	c3                   	ret
+
+0000000000000b48 <exit>:
+
+noreturn void exit(void) {
+     b48:	55                   	push   %rbp
+     b49:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     b4c:	e8 dc fd ff ff       	call   92d <bflushall>
+  _exit();
+     b51:	e8 76 0a 00 00       	call   15cc <_exit>
+
+0000000000000b56 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     b56:	55                   	push   %rbp
+     b57:	48 89 e5             	mov    %rsp,%rbp
+     b5a:	48 83 ec 10          	sub    $0x10,%rsp
+     b5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     b66:	e8 c2 fd ff ff       	call   92d <bflushall>
+  return _exec(path, argv);
+     b6b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b73:	48 89 d6             	mov    %rdx,%rsi
+     b76:	48 89 c7             	mov    %rax,%rdi
+     b79:	e8 9b 0a 00 00       	call   1619 <_exec>
+}
+     b7e:	c9                   	leave
+     b7f:	c3                   	ret
+
+0000000000000b80 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     b80:	55                   	push   %rbp
+     b81:	48 89 e5             	mov    %rsp,%rbp
+     b84:	48 83 ec 20          	sub    $0x20,%rsp
+     b88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b90:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     b94:	e8 94 fd ff ff       	call   92d <bflushall>
+  return _spawn(path, argv, fds);
+     b99:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b9d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     ba1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ba5:	48 89 ce             	mov    %rcx,%rsi
+     ba8:	48 89 c7             	mov    %rax,%rdi
+     bab:	e8 2f 0b 00 00       	call   16df <_spawn>
+}
+     bb0:	c9                   	leave
+     bb1:	c3                   	ret
+
+0000000000000bb2 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     bb2:	55                   	push   %rbp
+     bb3:	48 89 e5             	mov    %rsp,%rbp
+     bb6:	48 83 ec 10          	sub    $0x10,%rsp
+     bba:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     bbd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     bc1:	78 69                	js     c2c <close+0x7a>
+     bc3:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     bc7:	7f 63                	jg     c2c <close+0x7a>
+     bc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bcc:	48 98                	cltq
+     bce:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     bd5:	00 
+     bd6:	48 8d 05 83 24 00 00 	lea    0x2483(%rip),%rax        # 3060 <obufs>
+     bdd:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     be1:	48 85 c0             	test   %rax,%rax
+     be4:	74 46                	je     c2c <close+0x7a>
+    bflush(fd);
+     be6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     be9:	89 c7                	mov    %eax,%edi
+     beb:	e8 b4 fc ff ff       	call   8a4 <bflush>
+    free(obufs[fd]);
+     bf0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bf3:	48 98                	cltq
+     bf5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     bfc:	00 
+     bfd:	48 8d 05 5c 24 00 00 	lea    0x245c(%rip),%rax        # 3060 <obufs>
+     c04:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     c08:	48 89 c7             	mov    %rax,%rdi
+     c0b:	e8 90 11 00 00       	call   1da0 <free>
+    obufs[fd] = 0;
+     c10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c13:	48 98                	cltq
+     c15:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     c1c:	00 
+     c1d:	48 8d 05 3c 24 00 00 	lea    0x243c(%rip),%rax        # 3060 <obufs>
+     c24:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     c2b:	00 
+  }
+  return _close(fd);
+     c2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c2f:	89 c7                	mov    %eax,%edi
+     c31:	e8 cd 09 00 00       	call   1603 <_close>
+}
+     c36:	c9                   	leave
+     c37:	c3                   	ret
+
+0000000000000c38 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     c38:	55                   	push   %rbp
+     c39:	48 89 e5             	mov    %rsp,%rbp
+     c3c:	53                   	push   %rbx
+     c3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     c45:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     c49:	48 8b 36             	mov    (%rsi),%rsi
+     c4c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     c50:	48 29 f7             	sub    %rsi,%rdi
+     c53:	48 89 f9             	mov    %rdi,%rcx
+     c56:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c5b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     c5f:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     c63:	48 89 f0             	mov    %rsi,%rax
+     c66:	ba 00 00 00 00       	mov    $0x0,%edx
+     c6b:	48 89 df             	mov    %rbx,%rdi
+     c6e:	48 0f af f8          	imul   %rax,%rdi
+     c72:	48 89 d6             	mov    %rdx,%rsi
+     c75:	48 0f af f1          	imul   %rcx,%rsi
+     c79:	48 01 fe             	add    %rdi,%rsi
+     c7c:	48 f7 e1             	mul    %rcx
+     c7f:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     c83:	48 89 ca             	mov    %rcx,%rdx
+     c86:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     c8b:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     c8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c93:	c9                   	leave
+     c94:	c3                   	ret
+
+0000000000000c95 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     c95:	55                   	push   %rbp
+     c96:	48 89 e5             	mov    %rsp,%rbp
+     c99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c9d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ca0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     ca3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ca7:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     caa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cad:	48 89 ce             	mov    %rcx,%rsi
+     cb0:	48 89 f7             	mov    %rsi,%rdi
+     cb3:	89 d1                	mov    %edx,%ecx
+     cb5:	fc                   	cld
+     cb6:	f3 aa                	rep stos %al,%es:(%rdi)
+     cb8:	89 ca                	mov    %ecx,%edx
+     cba:	48 89 fe             	mov    %rdi,%rsi
+     cbd:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     cc1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     cc4:	90                   	nop
+     cc5:	5d                   	pop    %rbp
+     cc6:	c3                   	ret
+
+0000000000000cc7 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     cc7:	55                   	push   %rbp
+     cc8:	48 89 e5             	mov    %rsp,%rbp
+     ccb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ccf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     cd3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     cd7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     cdb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     cdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ce3:	48 89 ce             	mov    %rcx,%rsi
+     ce6:	48 89 f7             	mov    %rsi,%rdi
+     ce9:	48 89 d1             	mov    %rdx,%rcx
+     cec:	fc                   	cld
+     ced:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     cf0:	48 89 ca             	mov    %rcx,%rdx
+     cf3:	48 89 fe             	mov    %rdi,%rsi
+     cf6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     cfa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     cfe:	90                   	nop
+     cff:	5d                   	pop    %rbp
+     d00:	c3                   	ret
+
+0000000000000d01 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     d01:	55                   	push   %rbp
+     d02:	48 89 e5             	mov    %rsp,%rbp
+     d05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d09:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     d0d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     d11:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     d15:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d1d:	48 89 cf             	mov    %rcx,%rdi
+     d20:	48 89 d6             	mov    %rdx,%rsi
+     d23:	48 89 c1             	mov    %rax,%rcx
+     d26:	fc                   	cld
+     d27:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     d29:	48 89 c8             	mov    %rcx,%rax
+     d2c:	48 89 f2             	mov    %rsi,%rdx
+     d2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d33:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     d37:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     d3b:	90                   	nop
+     d3c:	5d                   	pop    %rbp
+     d3d:	c3                   	ret
+
+0000000000000d3e <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     d3e:	55                   	push   %rbp
+     d3f:	48 89 e5             	mov    %rsp,%rbp
+     d42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d46:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     d4a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     d4e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     d52:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d5a:	48 89 cf             	mov    %rcx,%rdi
+     d5d:	48 89 d6             	mov    %rdx,%rsi
+     d60:	48 89 c1             	mov    %rax,%rcx
+     d63:	fc                   	cld
+     d64:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     d67:	48 89 c8             	mov    %rcx,%rax
+     d6a:	48 89 f2             	mov    %rsi,%rdx
+     d6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d71:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     d75:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     d79:	90                   	nop
+     d7a:	5d                   	pop    %rbp
+     d7b:	c3                   	ret
+
+0000000000000d7c <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     d7c:	55                   	push   %rbp
+     d7d:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     d80:	0f 31                	rdtsc
+     d82:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     d85:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     d88:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d8b:	48 c1 e0 20          	shl    $0x20,%rax
+     d8f:	48 89 c2             	mov    %rax,%rdx
+     d92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d95:	48 09 d0             	or     %rdx,%rax
+}
+     d98:	5d                   	pop    %rbp
+     d99:	c3                   	ret
+
+0000000000000d9a <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     d9a:	55                   	push   %rbp
+     d9b:	48 89 e5             	mov    %rsp,%rbp
+     d9e:	53                   	push   %rbx
+     d9f:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     da2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     da6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     daa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     dae:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     db2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     db5:	0f a2                	cpuid
+     db7:	89 de                	mov    %ebx,%esi
+     db9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     dbc:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     dbf:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     dc2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     dc5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     dca:	74 09                	je     dd5 <cpuid+0x3b>
+    *eaxp = eax;
+     dcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     dd0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     dd3:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     dd5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     dda:	74 09                	je     de5 <cpuid+0x4b>
+    *ebxp = ebx;
+     ddc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     de0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     de3:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     de5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     dea:	74 09                	je     df5 <cpuid+0x5b>
+    *ecxp = ecx;
+     dec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     df0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     df3:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     df5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     dfa:	74 09                	je     e05 <cpuid+0x6b>
+    *edxp = edx;
+     dfc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     e00:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     e03:	89 10                	mov    %edx,(%rax)
+}
+     e05:	90                   	nop
+     e06:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     e0a:	c9                   	leave
+     e0b:	c3                   	ret
+
+0000000000000e0c <strcpy>:
+char *strcpy(char *s, char *t) {
+     e0c:	55                   	push   %rbp
+     e0d:	48 89 e5             	mov    %rsp,%rbp
+     e10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e14:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e1c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     e20:	90                   	nop
+     e21:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     e25:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     e29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     e2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e31:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     e35:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     e39:	0f b6 12             	movzbl (%rdx),%edx
+     e3c:	88 10                	mov    %dl,(%rax)
+     e3e:	0f b6 00             	movzbl (%rax),%eax
+     e41:	84 c0                	test   %al,%al
+     e43:	75 dc                	jne    e21 <strcpy+0x15>
+  return os;
+     e45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e49:	5d                   	pop    %rbp
+     e4a:	c3                   	ret
+
+0000000000000e4b <strcmp>:
+int strcmp(const char *p, const char *q) {
+     e4b:	55                   	push   %rbp
+     e4c:	48 89 e5             	mov    %rsp,%rbp
+     e4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e53:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     e57:	eb 0a                	jmp    e63 <strcmp+0x18>
+    p++, q++;
+     e59:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e5e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     e63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e67:	0f b6 00             	movzbl (%rax),%eax
+     e6a:	84 c0                	test   %al,%al
+     e6c:	74 12                	je     e80 <strcmp+0x35>
+     e6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e72:	0f b6 10             	movzbl (%rax),%edx
+     e75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e79:	0f b6 00             	movzbl (%rax),%eax
+     e7c:	38 c2                	cmp    %al,%dl
+     e7e:	74 d9                	je     e59 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     e80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e84:	0f b6 00             	movzbl (%rax),%eax
+     e87:	0f b6 d0             	movzbl %al,%edx
+     e8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e8e:	0f b6 00             	movzbl (%rax),%eax
+     e91:	0f b6 c0             	movzbl %al,%eax
+     e94:	29 c2                	sub    %eax,%edx
+     e96:	89 d0                	mov    %edx,%eax
+}
+     e98:	5d                   	pop    %rbp
+     e99:	c3                   	ret
+
+0000000000000e9a <strlen>:
+uint strlen(char *s) {
+     e9a:	55                   	push   %rbp
+     e9b:	48 89 e5             	mov    %rsp,%rbp
+     e9e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     ea2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ea9:	eb 04                	jmp    eaf <strlen+0x15>
+     eab:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     eaf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eb2:	48 63 d0             	movslq %eax,%rdx
+     eb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eb9:	48 01 d0             	add    %rdx,%rax
+     ebc:	0f b6 00             	movzbl (%rax),%eax
+     ebf:	84 c0                	test   %al,%al
+     ec1:	75 e8                	jne    eab <strlen+0x11>
+    ;
+  return n;
+     ec3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     ec6:	5d                   	pop    %rbp
+     ec7:	c3                   	ret
+
+0000000000000ec8 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     ec8:	55                   	push   %rbp
+     ec9:	48 89 e5             	mov    %rsp,%rbp
+     ecc:	53                   	push   %rbx
+     ecd:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     ed1:	8b 05 5d 21 00 00    	mov    0x215d(%rip),%eax        # 3034 <erms>
+     ed7:	85 c0                	test   %eax,%eax
+     ed9:	79 53                	jns    f2e <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     edb:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     edf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     ee5:	b9 00 00 00 00       	mov    $0x0,%ecx
+     eea:	ba 00 00 00 00       	mov    $0x0,%edx
+     eef:	48 89 c6             	mov    %rax,%rsi
+     ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+     ef7:	e8 9e fe ff ff       	call   d9a <cpuid>
+    ebx = 0;
+     efc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     f03:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f06:	83 f8 06             	cmp    $0x6,%eax
+     f09:	76 14                	jbe    f1f <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     f0b:	b8 07 00 00 00       	mov    $0x7,%eax
+     f10:	b9 00 00 00 00       	mov    $0x0,%ecx
+     f15:	0f a2                	cpuid
+     f17:	89 d9                	mov    %ebx,%ecx
+     f19:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     f1c:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     f1f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f22:	c1 e8 09             	shr    $0x9,%eax
+     f25:	83 e0 01             	and    $0x1,%eax
+     f28:	89 05 06 21 00 00    	mov    %eax,0x2106(%rip)        # 3034 <erms>
+  }
+  return erms;
+     f2e:	8b 05 00 21 00 00    	mov    0x2100(%rip),%eax        # 3034 <erms>
+}
+     f34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f38:	c9                   	leave
+     f39:	c3                   	ret
+
+0000000000000f3a <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     f3a:	55                   	push   %rbp
+     f3b:	48 89 e5             	mov    %rsp,%rbp
+     f3e:	48 83 ec 10          	sub    $0x10,%rsp
+     f42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f46:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     f49:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     f4c:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     f50:	76 09                	jbe    f5b <memset+0x21>
+     f52:	e8 71 ff ff ff       	call   ec8 <haserms>
+     f57:	85 c0                	test   %eax,%eax
+     f59:	74 16                	je     f71 <memset+0x37>
+    stosb(dst, c, n);
+     f5b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f5e:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     f61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f65:	89 ce                	mov    %ecx,%esi
+     f67:	48 89 c7             	mov    %rax,%rdi
+     f6a:	e8 26 fd ff ff       	call   c95 <stosb>
+     f6f:	eb 58                	jmp    fc9 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     f71:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f74:	c1 e8 03             	shr    $0x3,%eax
+     f77:	89 c6                	mov    %eax,%esi
+     f79:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f7c:	48 98                	cltq
+     f7e:	0f b6 c0             	movzbl %al,%eax
+     f81:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     f88:	01 01 01 
+     f8b:	48 0f af c2          	imul   %rdx,%rax
+     f8f:	48 89 c1             	mov    %rax,%rcx
+     f92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f96:	48 89 f2             	mov    %rsi,%rdx
+     f99:	48 89 ce             	mov    %rcx,%rsi
+     f9c:	48 89 c7             	mov    %rax,%rdi
+     f9f:	e8 23 fd ff ff       	call   cc7 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     fa4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     fa7:	83 e0 07             	and    $0x7,%eax
+     faa:	89 c2                	mov    %eax,%edx
+     fac:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     faf:	83 e0 f8             	and    $0xfffffff8,%eax
+     fb2:	48 89 c1             	mov    %rax,%rcx
+     fb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fb9:	48 01 c1             	add    %rax,%rcx
+     fbc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fbf:	89 c6                	mov    %eax,%esi
+     fc1:	48 89 cf             	mov    %rcx,%rdi
+     fc4:	e8 cc fc ff ff       	call   c95 <stosb>
+  }
+  return dst;
+     fc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     fcd:	c9                   	leave
+     fce:	c3                   	ret
+
+0000000000000fcf <strchr>:
+
+char *strchr(const char *s, char c) {
+     fcf:	55                   	push   %rbp
+     fd0:	48 89 e5             	mov    %rsp,%rbp
+     fd3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fd7:	89 f0                	mov    %esi,%eax
+     fd9:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     fdc:	eb 17                	jmp    ff5 <strchr+0x26>
+    if (*s == c)
+     fde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fe2:	0f b6 00             	movzbl (%rax),%eax
+     fe5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     fe8:	75 06                	jne    ff0 <strchr+0x21>
+      return (char *)s;
+     fea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fee:	eb 15                	jmp    1005 <strchr+0x36>
+  for (; *s; s++)
+     ff0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff9:	0f b6 00             	movzbl (%rax),%eax
+     ffc:	84 c0                	test   %al,%al
+     ffe:	75 de                	jne    fde <strchr+0xf>
+  return 0;
+    1000:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1005:	5d                   	pop    %rbp
+    1006:	c3                   	ret
+
+0000000000001007 <gets>:
+
+char *gets(char *buf, int max) {
+    1007:	55                   	push   %rbp
+    1008:	48 89 e5             	mov    %rsp,%rbp
+    100b:	48 83 ec 20          	sub    $0x20,%rsp
+    100f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1013:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    1016:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    101d:	eb 48                	jmp    1067 <gets+0x60>
+    cc = read(0, &c, 1);
+    101f:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1023:	ba 01 00 00 00       	mov    $0x1,%edx
+    1028:	48 89 c6             	mov    %rax,%rsi
+    102b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1030:	e8 b8 05 00 00       	call   15ed <read>
+    1035:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1038:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    103c:	7e 36                	jle    1074 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    103e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1041:	8d 50 01             	lea    0x1(%rax),%edx
+    1044:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1047:	48 63 d0             	movslq %eax,%rdx
+    104a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    104e:	48 01 c2             	add    %rax,%rdx
+    1051:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1055:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1057:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    105b:	3c 0a                	cmp    $0xa,%al
+    105d:	74 16                	je     1075 <gets+0x6e>
+    105f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1063:	3c 0d                	cmp    $0xd,%al
+    1065:	74 0e                	je     1075 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1067:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    106a:	83 c0 01             	add    $0x1,%eax
+    106d:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1070:	7f ad                	jg     101f <gets+0x18>
+    1072:	eb 01                	jmp    1075 <gets+0x6e>
+      break;
+    1074:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1075:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1078:	48 63 d0             	movslq %eax,%rdx
+    107b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    107f:	48 01 d0             	add    %rdx,%rax
+    1082:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1085:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1089:	c9                   	leave
+    108a:	c3                   	ret
+
+000000000000108b <stat>:
+
+int stat(char *n, struct stat *st) {
+    108b:	55                   	push   %rbp
+    108c:	48 89 e5             	mov    %rsp,%rbp
+    108f:	48 83 ec 10          	sub    $0x10,%rsp
+    1093:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1097:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    109b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    109f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a3:	48 89 c6             	mov    %rax,%rsi
+    10a6:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    10ab:	e8 58 07 00 00       	call   1808 <fstatat>
+}
+    10b0:	c9                   	leave
+    10b1:	c3                   	ret
+
+00000000000010b2 <atoi>:
+
+int atoi(const char *s) {
+    10b2:	55                   	push   %rbp
+    10b3:	48 89 e5             	mov    %rsp,%rbp
+    10b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    10ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    10c1:	eb 28                	jmp    10eb <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    10c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    10c6:	89 d0                	mov    %edx,%eax
+    10c8:	c1 e0 02             	shl    $0x2,%eax
+    10cb:	01 d0                	add    %edx,%eax
+    10cd:	01 c0                	add    %eax,%eax
+    10cf:	89 c1                	mov    %eax,%ecx
+    10d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    10d9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    10dd:	0f b6 00             	movzbl (%rax),%eax
+    10e0:	0f be c0             	movsbl %al,%eax
+    10e3:	01 c8                	add    %ecx,%eax
+    10e5:	83 e8 30             	sub    $0x30,%eax
+    10e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    10eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10ef:	0f b6 00             	movzbl (%rax),%eax
+    10f2:	3c 2f                	cmp    $0x2f,%al
+    10f4:	7e 0b                	jle    1101 <atoi+0x4f>
+    10f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10fa:	0f b6 00             	movzbl (%rax),%eax
+    10fd:	3c 39                	cmp    $0x39,%al
+    10ff:	7e c2                	jle    10c3 <atoi+0x11>
+  return n;
+    1101:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1104:	5d                   	pop    %rbp
+    1105:	c3                   	ret
+
+0000000000001106 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1106:	55                   	push   %rbp
+    1107:	48 89 e5             	mov    %rsp,%rbp
+    110a:	48 83 ec 28          	sub    $0x28,%rsp
+    110e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1112:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1116:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1119:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    111d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1121:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1125:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1129:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    112d:	7f 09                	jg     1138 <memmove+0x32>
+    return vdst;
+    112f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1133:	e9 29 01 00 00       	jmp    1261 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1138:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    113c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1140:	0f 83 87 00 00 00    	jae    11cd <memmove+0xc7>
+    1146:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1149:	48 63 d0             	movslq %eax,%rdx
+    114c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1150:	48 01 d0             	add    %rdx,%rax
+    1153:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1157:	73 74                	jae    11cd <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1159:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    115c:	48 98                	cltq
+    115e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1162:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1165:	48 98                	cltq
+    1167:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    116b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    116f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1173:	48 09 d0             	or     %rdx,%rax
+    1176:	83 e0 07             	and    $0x7,%eax
+    1179:	48 85 c0             	test   %rax,%rax
+    117c:	75 3d                	jne    11bb <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    117e:	eb 1c                	jmp    119c <memmove+0x96>
+        src -= 8;
+    1180:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1185:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    118a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    118e:	48 8b 10             	mov    (%rax),%rdx
+    1191:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1195:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1198:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    119c:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    11a0:	7f de                	jg     1180 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    11a2:	eb 17                	jmp    11bb <memmove+0xb5>
+      *--dst = *--src;
+    11a4:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    11a9:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    11ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11b2:	0f b6 10             	movzbl (%rax),%edx
+    11b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    11bb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11be:	8d 50 ff             	lea    -0x1(%rax),%edx
+    11c1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    11c4:	85 c0                	test   %eax,%eax
+    11c6:	7f dc                	jg     11a4 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    11c8:	e9 90 00 00 00       	jmp    125d <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    11cd:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    11d1:	7e 09                	jle    11dc <memmove+0xd6>
+    11d3:	e8 f0 fc ff ff       	call   ec8 <haserms>
+    11d8:	85 c0                	test   %eax,%eax
+    11da:	74 1b                	je     11f7 <memmove+0xf1>
+    movsb(dst, src, n);
+    11dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11df:	48 63 d0             	movslq %eax,%rdx
+    11e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    11e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ea:	48 89 ce             	mov    %rcx,%rsi
+    11ed:	48 89 c7             	mov    %rax,%rdi
+    11f0:	e8 0c fb ff ff       	call   d01 <movsb>
+    11f5:	eb 66                	jmp    125d <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    11f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11fa:	8d 50 07             	lea    0x7(%rax),%edx
+    11fd:	85 c0                	test   %eax,%eax
+    11ff:	0f 48 c2             	cmovs  %edx,%eax
+    1202:	c1 f8 03             	sar    $0x3,%eax
+    1205:	48 63 d0             	movslq %eax,%rdx
+    1208:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    120c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1210:	48 89 ce             	mov    %rcx,%rsi
+    1213:	48 89 c7             	mov    %rax,%rdi
+    1216:	e8 23 fb ff ff       	call   d3e <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    121b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    121e:	89 d0                	mov    %edx,%eax
+    1220:	c1 f8 1f             	sar    $0x1f,%eax
+    1223:	c1 e8 1d             	shr    $0x1d,%eax
+    1226:	01 c2                	add    %eax,%edx
+    1228:	83 e2 07             	and    $0x7,%edx
+    122b:	29 c2                	sub    %eax,%edx
+    122d:	89 d0                	mov    %edx,%eax
+    122f:	48 98                	cltq
+    1231:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1234:	83 e2 f8             	and    $0xfffffff8,%edx
+    1237:	48 63 ca             	movslq %edx,%rcx
+    123a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    123e:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1242:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1245:	83 e2 f8             	and    $0xfffffff8,%edx
+    1248:	48 63 ca             	movslq %edx,%rcx
+    124b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    124f:	48 01 d1             	add    %rdx,%rcx
+    1252:	48 89 c2             	mov    %rax,%rdx
+    1255:	48 89 cf             	mov    %rcx,%rdi
+    1258:	e8 a4 fa ff ff       	call   d01 <movsb>
+  }
+  return vdst;
+    125d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1261:	c9                   	leave
+    1262:	c3                   	ret
+
+0000000000001263 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1263:	55                   	push   %rbp
+    1264:	48 89 e5             	mov    %rsp,%rbp
+    1267:	48 83 ec 20          	sub    $0x20,%rsp
+    126b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    126e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1272:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1279:	00 00 00 
+    127c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1280:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1284:	75 0d                	jne    1293 <clock_gettime+0x30>
+    1286:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    128a:	48 8b 40 08          	mov    0x8(%rax),%rax
+    128e:	48 85 c0             	test   %rax,%rax
+    1291:	75 13                	jne    12a6 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1293:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1297:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    129a:	48 89 d6             	mov    %rdx,%rsi
+    129d:	89 c7                	mov    %eax,%edi
+    129f:	e8 e0 04 00 00       	call   1784 <_clock_gettime>
+    12a4:	eb 7d                	jmp    1323 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    12a6:	e8 d1 fa ff ff       	call   d7c <rdtsc>
+    12ab:	48 89 c2             	mov    %rax,%rdx
+    12ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b2:	48 89 d6             	mov    %rdx,%rsi
+    12b5:	48 89 c7             	mov    %rax,%rdi
+    12b8:	e8 7b f9 ff ff       	call   c38 <clockns>
+    12bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    12c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12c5:	48 c1 e8 09          	shr    $0x9,%rax
+    12c9:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    12d0:	b8 44 00 
+    12d3:	48 f7 e2             	mul    %rdx
+    12d6:	48 89 d0             	mov    %rdx,%rax
+    12d9:	48 c1 e8 0b          	shr    $0xb,%rax
+    12dd:	48 89 c2             	mov    %rax,%rdx
+    12e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12e4:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    12e7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    12eb:	48 89 c8             	mov    %rcx,%rax
+    12ee:	48 c1 e8 09          	shr    $0x9,%rax
+    12f2:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    12f9:	b8 44 00 
+    12fc:	48 f7 e2             	mul    %rdx
+    12ff:	48 89 d0             	mov    %rdx,%rax
+    1302:	48 c1 e8 0b          	shr    $0xb,%rax
+    1306:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    130d:	48 89 c8             	mov    %rcx,%rax
+    1310:	48 29 d0             	sub    %rdx,%rax
+    1313:	48 89 c2             	mov    %rax,%rdx
+    1316:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    131a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    131e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1323:	c9                   	leave
+    1324:	c3                   	ret
+
+0000000000001325 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1325:	55                   	push   %rbp
+    1326:	48 89 e5             	mov    %rsp,%rbp
+    1329:	48 83 ec 10          	sub    $0x10,%rsp
+    132d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1331:	eb 11                	jmp    1344 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1333:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1337:	be 02 00 00 00       	mov    $0x2,%esi
+    133c:	48 89 c7             	mov    %rax,%rdi
+    133f:	e8 6c 04 00 00       	call   17b0 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1344:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1348:	b8 02 00 00 00       	mov    $0x2,%eax
+    134d:	87 02                	xchg   %eax,(%rdx)
+    134f:	85 c0                	test   %eax,%eax
+    1351:	75 e0                	jne    1333 <mutex_wait+0xe>
+}
+    1353:	90                   	nop
+    1354:	90                   	nop
+    1355:	c9                   	leave
+    1356:	c3                   	ret
+
+0000000000001357 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1357:	55                   	push   %rbp
+    1358:	48 89 e5             	mov    %rsp,%rbp
+    135b:	48 83 ec 20          	sub    $0x20,%rsp
+    135f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1363:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    136a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    136e:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1372:	8b 02                	mov    (%rdx),%eax
+    1374:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1379:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    137d:	89 c1                	mov    %eax,%ecx
+    137f:	0f 94 c0             	sete   %al
+    1382:	84 c0                	test   %al,%al
+    1384:	75 02                	jne    1388 <mutex_lock+0x31>
+    1386:	89 0a                	mov    %ecx,(%rdx)
+    1388:	83 f0 01             	xor    $0x1,%eax
+    138b:	84 c0                	test   %al,%al
+    138d:	74 0c                	je     139b <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    138f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1393:	48 89 c7             	mov    %rax,%rdi
+    1396:	e8 8a ff ff ff       	call   1325 <mutex_wait>
+}
+    139b:	90                   	nop
+    139c:	c9                   	leave
+    139d:	c3                   	ret
+
+000000000000139e <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    139e:	55                   	push   %rbp
+    139f:	48 89 e5             	mov    %rsp,%rbp
+    13a2:	48 83 ec 10          	sub    $0x10,%rsp
+    13a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    13aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13ae:	ba 00 00 00 00       	mov    $0x0,%edx
+    13b3:	87 10                	xchg   %edx,(%rax)
+    13b5:	83 fa 02             	cmp    $0x2,%edx
+    13b8:	75 11                	jne    13cb <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    13ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13be:	be 01 00 00 00       	mov    $0x1,%esi
+    13c3:	48 89 c7             	mov    %rax,%rdi
+    13c6:	e8 f0 03 00 00       	call   17bb <futex_wake>
+}
+    13cb:	90                   	nop
+    13cc:	c9                   	leave
+    13cd:	c3                   	ret
+
+00000000000013ce <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    13ce:	55                   	push   %rbp
+    13cf:	48 89 e5             	mov    %rsp,%rbp
+    13d2:	48 83 ec 20          	sub    $0x20,%rsp
+    13d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    13de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e2:	48 83 c0 04          	add    $0x4,%rax
+    13e6:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    13ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13ee:	8b 00                	mov    (%rax),%eax
+    13f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    13f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    13f7:	48 89 c7             	mov    %rax,%rdi
+    13fa:	e8 9f ff ff ff       	call   139e <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    13ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1403:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1406:	89 d6                	mov    %edx,%esi
+    1408:	48 89 c7             	mov    %rax,%rdi
+    140b:	e8 a0 03 00 00       	call   17b0 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1410:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1414:	48 83 c0 04          	add    $0x4,%rax
+    1418:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    141c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1420:	48 89 c7             	mov    %rax,%rdi
+    1423:	e8 fd fe ff ff       	call   1325 <mutex_wait>
+}
+    1428:	90                   	nop
+    1429:	c9                   	leave
+    142a:	c3                   	ret
+
+000000000000142b <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    142b:	55                   	push   %rbp
+    142c:	48 89 e5             	mov    %rsp,%rbp
+    142f:	48 83 ec 10          	sub    $0x10,%rsp
+    1433:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1437:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    143b:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    143f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1443:	48 83 c0 04          	add    $0x4,%rax
+    1447:	8b 00                	mov    (%rax),%eax
+    1449:	85 c0                	test   %eax,%eax
+    144b:	7e 11                	jle    145e <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    144d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1451:	be 01 00 00 00       	mov    $0x1,%esi
+    1456:	48 89 c7             	mov    %rax,%rdi
+    1459:	e8 5d 03 00 00       	call   17bb <futex_wake>
+}
+    145e:	90                   	nop
+    145f:	c9                   	leave
+    1460:	c3                   	ret
+
+0000000000001461 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1461:	55                   	push   %rbp
+    1462:	48 89 e5             	mov    %rsp,%rbp
+    1465:	48 83 ec 10          	sub    $0x10,%rsp
+    1469:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    146d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1471:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1475:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1479:	48 83 c0 04          	add    $0x4,%rax
+    147d:	8b 00                	mov    (%rax),%eax
+    147f:	85 c0                	test   %eax,%eax
+    1481:	7e 11                	jle    1494 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1487:	be 00 00 00 40       	mov    $0x40000000,%esi
+    148c:	48 89 c7             	mov    %rax,%rdi
+    148f:	e8 27 03 00 00       	call   17bb <futex_wake>
+}
+    1494:	90                   	nop
+    1495:	c9                   	leave
+    1496:	c3                   	ret
+
+0000000000001497 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1497:	55                   	push   %rbp
+    1498:	48 89 e5             	mov    %rsp,%rbp
+    149b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    149f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    14a2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    14a6:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    14aa:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    14ae:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    14b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14b6:	8b 40 04             	mov    0x4(%rax),%eax
+    14b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    14bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14c0:	8b 00                	mov    (%rax),%eax
+    14c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    14c5:	29 c2                	sub    %eax,%edx
+    14c7:	83 fa 1f             	cmp    $0x1f,%edx
+    14ca:	76 07                	jbe    14d3 <ring_push+0x3c>
+    return -1;
+    14cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14d1:	eb 7e                	jmp    1551 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    14d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14d6:	83 e0 1f             	and    $0x1f,%eax
+    14d9:	89 c2                	mov    %eax,%edx
+    14db:	48 89 d0             	mov    %rdx,%rax
+    14de:	48 01 c0             	add    %rax,%rax
+    14e1:	48 01 d0             	add    %rdx,%rax
+    14e4:	48 c1 e0 04          	shl    $0x4,%rax
+    14e8:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    14ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14f0:	48 01 d0             	add    %rdx,%rax
+    14f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    14f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14fb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    14fe:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1500:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1504:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1508:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    150c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1510:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1514:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    151c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1520:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1524:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1528:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    152c:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1530:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1534:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1538:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    153c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    153f:	8d 50 01             	lea    0x1(%rax),%edx
+    1542:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1546:	48 83 c0 04          	add    $0x4,%rax
+    154a:	89 10                	mov    %edx,(%rax)
+  return 0;
+    154c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1551:	5d                   	pop    %rbp
+    1552:	c3                   	ret
+
+0000000000001553 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1553:	55                   	push   %rbp
+    1554:	48 89 e5             	mov    %rsp,%rbp
+    1557:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    155b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    155f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1563:	8b 40 08             	mov    0x8(%rax),%eax
+    1566:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1569:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    156d:	48 83 c0 0c          	add    $0xc,%rax
+    1571:	8b 00                	mov    (%rax),%eax
+    1573:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1576:	75 07                	jne    157f <ring_pop+0x2c>
+    return -1;
+    1578:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    157d:	eb 40                	jmp    15bf <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    157f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1582:	83 e0 1f             	and    $0x1f,%eax
+    1585:	89 c2                	mov    %eax,%edx
+    1587:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    158b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    158f:	89 d2                	mov    %edx,%edx
+    1591:	48 83 c2 61          	add    $0x61,%rdx
+    1595:	48 c1 e2 04          	shl    $0x4,%rdx
+    1599:	48 01 d0             	add    %rdx,%rax
+    159c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    15a0:	48 8b 00             	mov    (%rax),%rax
+    15a3:	48 89 01             	mov    %rax,(%rcx)
+    15a6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    15aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15ad:	8d 50 01             	lea    0x1(%rax),%edx
+    15b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15b4:	48 83 c0 08          	add    $0x8,%rax
+    15b8:	89 10                	mov    %edx,(%rax)
+  return 0;
+    15ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    15bf:	5d                   	pop    %rbp
+    15c0:	c3                   	ret
+
+00000000000015c1 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    15c1:	b8 01 00 00 00       	mov    $0x1,%eax
+    15c6:	49 89 ca             	mov    %rcx,%r10
+    15c9:	0f 05                	syscall
+    15cb:	c3                   	ret
+
+00000000000015cc <_exit>:
+SYSCALL_(exit)
+    15cc:	b8 02 00 00 00       	mov    $0x2,%eax
+    15d1:	49 89 ca             	mov    %rcx,%r10
+    15d4:	0f 05                	syscall
+    15d6:	c3                   	ret
+
+00000000000015d7 <wait>:
+SYSCALL(wait)
+    15d7:	b8 03 00 00 00       	mov    $0x3,%eax
+    15dc:	49 89 ca             	mov    %rcx,%r10
+    15df:	0f 05                	syscall
+    15e1:	c3                   	ret
+
+00000000000015e2 <pipe>:
+SYSCALL(pipe)
+    15e2:	b8 04 00 00 00       	mov    $0x4,%eax
+    15e7:	49 89 ca             	mov    %rcx,%r10
+    15ea:	0f 05                	syscall
+    15ec:	c3                   	ret
+
+00000000000015ed <read>:
+SYSCALL(read)
+    15ed:	b8 05 00 00 00       	mov    $0x5,%eax
+    15f2:	49 89 ca             	mov    %rcx,%r10
+    15f5:	0f 05                	syscall
+    15f7:	c3                   	ret
+
+00000000000015f8 <write>:
+SYSCALL(write)
+    15f8:	b8 10 00 00 00       	mov    $0x10,%eax
+    15fd:	49 89 ca             	mov    %rcx,%r10
+    1600:	0f 05                	syscall
+    1602:	c3                   	ret
+
+0000000000001603 <_close>:
+SYSCALL_(close)
+    1603:	b8 15 00 00 00       	mov    $0x15,%eax
+    1608:	49 89 ca             	mov    %rcx,%r10
+    160b:	0f 05                	syscall
+    160d:	c3                   	ret
+
+000000000000160e <kill>:
+SYSCALL(kill)
+    160e:	b8 06 00 00 00       	mov    $0x6,%eax
+    1613:	49 89 ca             	mov    %rcx,%r10
+    1616:	0f 05                	syscall
+    1618:	c3                   	ret
+
+0000000000001619 <_exec>:
+SYSCALL_(exec)
+    1619:	b8 07 00 00 00       	mov    $0x7,%eax
+    161e:	49 89 ca             	mov    %rcx,%r10
+    1621:	0f 05                	syscall
+    1623:	c3                   	ret
+
+0000000000001624 <open>:
+SYSCALL(open)
+    1624:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1629:	49 89 ca             	mov    %rcx,%r10
+    162c:	0f 05                	syscall
+    162e:	c3                   	ret
+
+000000000000162f <mknod>:
+SYSCALL(mknod)
+    162f:	b8 11 00 00 00       	mov    $0x11,%eax
+    1634:	49 89 ca             	mov    %rcx,%r10
+    1637:	0f 05                	syscall
+    1639:	c3                   	ret
+
+000000000000163a <unlink>:
+SYSCALL(unlink)
+    163a:	b8 12 00 00 00       	mov    $0x12,%eax
+    163f:	49 89 ca             	mov    %rcx,%r10
+    1642:	0f 05                	syscall
+    1644:	c3                   	ret
+
+0000000000001645 <fstat>:
+SYSCALL(fstat)
+    1645:	b8 08 00 00 00       	mov    $0x8,%eax
+    164a:	49 89 ca             	mov    %rcx,%r10
+    164d:	0f 05                	syscall
+    164f:	c3                   	ret
+
+0000000000001650 <link>:
+SYSCALL(link)
+    1650:	b8 13 00 00 00       	mov    $0x13,%eax
+    1655:	49 89 ca             	mov    %rcx,%r10
+    1658:	0f 05                	syscall
+    165a:	c3                   	ret
+
+000000000000165b <mkdir>:
+SYSCALL(mkdir)
+    165b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1660:	49 89 ca             	mov    %rcx,%r10
+    1663:	0f 05                	syscall
+    1665:	c3                   	ret
+
+0000000000001666 <chdir>:
+SYSCALL(chdir)
+    1666:	b8 09 00 00 00       	mov    $0x9,%eax
+    166b:	49 89 ca             	mov    %rcx,%r10
+    166e:	0f 05                	syscall
+    1670:	c3                   	ret
+
+0000000000001671 <dup>:
+SYSCALL(dup)
+    1671:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1676:	49 89 ca             	mov    %rcx,%r10
+    1679:	0f 05                	syscall
+    167b:	c3                   	ret
+
+000000000000167c <getpid>:
+SYSCALL(getpid)
+    167c:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1681:	49 89 ca             	mov    %rcx,%r10
+    1684:	0f 05                	syscall
+    1686:	c3                   	ret
+
+0000000000001687 <sbrk>:
+SYSCALL(sbrk)
+    1687:	b8 0c 00 00 00       	mov    $0xc,%eax
+    168c:	49 89 ca             	mov    %rcx,%r10
+    168f:	0f 05                	syscall
+    1691:	c3                   	ret
+
+0000000000001692 <sleep>:
+SYSCALL(sleep)
+    1692:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1697:	49 89 ca             	mov    %rcx,%r10
+    169a:	0f 05                	syscall
+    169c:	c3                   	ret
+
+000000000000169d <uptime>:
+SYSCALL(uptime)
+    169d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    16a2:	49 89 ca             	mov    %rcx,%r10
+    16a5:	0f 05                	syscall
+    16a7:	c3                   	ret
+
+00000000000016a8 <sysinfo>:
+SYSCALL(sysinfo)
+    16a8:	b8 16 00 00 00       	mov    $0x16,%eax
+    16ad:	49 89 ca             	mov    %rcx,%r10
+    16b0:	0f 05                	syscall
+    16b2:	c3                   	ret
+
+00000000000016b3 <crashn>:
+SYSCALL(crashn)
+    16b3:	b8 17 00 00 00       	mov    $0x17,%eax
+    16b8:	49 89 ca             	mov    %rcx,%r10
+    16bb:	0f 05                	syscall
+    16bd:	c3                   	ret
+
+00000000000016be <mmap>:
+SYSCALL(mmap)
+    16be:	b8 18 00 00 00       	mov    $0x18,%eax
+    16c3:	49 89 ca             	mov    %rcx,%r10
+    16c6:	0f 05                	syscall
+    16c8:	c3                   	ret
+
+00000000000016c9 <munmap>:
+SYSCALL(munmap)
+    16c9:	b8 19 00 00 00       	mov    $0x19,%eax
+    16ce:	49 89 ca             	mov    %rcx,%r10
+    16d1:	0f 05                	syscall
+    16d3:	c3                   	ret
+
+00000000000016d4 <nice>:
+SYSCALL(nice)
+    16d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16d9:	49 89 ca             	mov    %rcx,%r10
+    16dc:	0f 05                	syscall
+    16de:	c3                   	ret
+
+00000000000016df <_spawn>:
+SYSCALL_(spawn)
+    16df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16e4:	49 89 ca             	mov    %rcx,%r10
+    16e7:	0f 05                	syscall
+    16e9:	c3                   	ret
+
+00000000000016ea <pread>:
+SYSCALL(pread)
+    16ea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16ef:	49 89 ca             	mov    %rcx,%r10
+    16f2:	0f 05                	syscall
+    16f4:	c3                   	ret
+
+00000000000016f5 <pwrite>:
+SYSCALL(pwrite)
+    16f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16fa:	49 89 ca             	mov    %rcx,%r10
+    16fd:	0f 05                	syscall
+    16ff:	c3                   	ret
+
+0000000000001700 <readv>:
+SYSCALL(readv)
+    1700:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1705:	49 89 ca             	mov    %rcx,%r10
+    1708:	0f 05                	syscall
+    170a:	c3                   	ret
+
+000000000000170b <writev>:
+SYSCALL(writev)
+    170b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1710:	49 89 ca             	mov    %rcx,%r10
+    1713:	0f 05                	syscall
+    1715:	c3                   	ret
+
+0000000000001716 <sendfile>:
+SYSCALL(sendfile)
+    1716:	b8 20 00 00 00       	mov    $0x20,%eax
+    171b:	49 89 ca             	mov    %rcx,%r10
+    171e:	0f 05                	syscall
+    1720:	c3                   	ret
+
+0000000000001721 <splice>:
+SYSCALL(splice)
+    1721:	b8 21 00 00 00       	mov    $0x21,%eax
+    1726:	49 89 ca             	mov    %rcx,%r10
+    1729:	0f 05                	syscall
+    172b:	c3                   	ret
+
+000000000000172c <poll>:
+SYSCALL(poll)
+    172c:	b8 22 00 00 00       	mov    $0x22,%eax
+    1731:	49 89 ca             	mov    %rcx,%r10
+    1734:	0f 05                	syscall
+    1736:	c3                   	ret
+
+0000000000001737 <fsync>:
+SYSCALL(fsync)
+    1737:	b8 23 00 00 00       	mov    $0x23,%eax
+    173c:	49 89 ca             	mov    %rcx,%r10
+    173f:	0f 05                	syscall
+    1741:	c3                   	ret
+
+0000000000001742 <fdatasync>:
+SYSCALL(fdatasync)
+    1742:	b8 24 00 00 00       	mov    $0x24,%eax
+    1747:	49 89 ca             	mov    %rcx,%r10
+    174a:	0f 05                	syscall
+    174c:	c3                   	ret
+
+000000000000174d <lockstat>:
+SYSCALL(lockstat)
+    174d:	b8 25 00 00 00       	mov    $0x25,%eax
+    1752:	49 89 ca             	mov    %rcx,%r10
+    1755:	0f 05                	syscall
+    1757:	c3                   	ret
+
+0000000000001758 <syscallstat>:
+SYSCALL(syscallstat)
+    1758:	b8 26 00 00 00       	mov    $0x26,%eax
+    175d:	49 89 ca             	mov    %rcx,%r10
+    1760:	0f 05                	syscall
+    1762:	c3                   	ret
+
+0000000000001763 <trace>:
+SYSCALL(trace)
+    1763:	b8 27 00 00 00       	mov    $0x27,%eax
+    1768:	49 89 ca             	mov    %rcx,%r10
+    176b:	0f 05                	syscall
+    176d:	c3                   	ret
+
+000000000000176e <profile>:
+SYSCALL(profile)
+    176e:	b8 28 00 00 00       	mov    $0x28,%eax
+    1773:	49 89 ca             	mov    %rcx,%r10
+    1776:	0f 05                	syscall
+    1778:	c3                   	ret
+
+0000000000001779 <cycles>:
+SYSCALL(cycles)
+    1779:	b8 29 00 00 00       	mov    $0x29,%eax
+    177e:	49 89 ca             	mov    %rcx,%r10
+    1781:	0f 05                	syscall
+    1783:	c3                   	ret
+
+0000000000001784 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1784:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1789:	49 89 ca             	mov    %rcx,%r10
+    178c:	0f 05                	syscall
+    178e:	c3                   	ret
+
+000000000000178f <consmode>:
+SYSCALL(consmode)
+    178f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1794:	49 89 ca             	mov    %rcx,%r10
+    1797:	0f 05                	syscall
+    1799:	c3                   	ret
+
+000000000000179a <clone>:
+SYSCALL(clone)
+    179a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    179f:	49 89 ca             	mov    %rcx,%r10
+    17a2:	0f 05                	syscall
+    17a4:	c3                   	ret
+
+00000000000017a5 <join>:
+SYSCALL(join)
+    17a5:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    17aa:	49 89 ca             	mov    %rcx,%r10
+    17ad:	0f 05                	syscall
+    17af:	c3                   	ret
+
+00000000000017b0 <futex_wait>:
+SYSCALL(futex_wait)
+    17b0:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    17b5:	49 89 ca             	mov    %rcx,%r10
+    17b8:	0f 05                	syscall
+    17ba:	c3                   	ret
+
+00000000000017bb <futex_wake>:
+SYSCALL(futex_wake)
+    17bb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    17c0:	49 89 ca             	mov    %rcx,%r10
+    17c3:	0f 05                	syscall
+    17c5:	c3                   	ret
+
+00000000000017c6 <shmget>:
+SYSCALL(shmget)
+    17c6:	b8 30 00 00 00       	mov    $0x30,%eax
+    17cb:	49 89 ca             	mov    %rcx,%r10
+    17ce:	0f 05                	syscall
+    17d0:	c3                   	ret
+
+00000000000017d1 <shmat>:
+SYSCALL(shmat)
+    17d1:	b8 31 00 00 00       	mov    $0x31,%eax
+    17d6:	49 89 ca             	mov    %rcx,%r10
+    17d9:	0f 05                	syscall
+    17db:	c3                   	ret
+
+00000000000017dc <shmdt>:
+SYSCALL(shmdt)
+    17dc:	b8 32 00 00 00       	mov    $0x32,%eax
+    17e1:	49 89 ca             	mov    %rcx,%r10
+    17e4:	0f 05                	syscall
+    17e6:	c3                   	ret
+
+00000000000017e7 <ring_setup>:
+SYSCALL(ring_setup)
+    17e7:	b8 33 00 00 00       	mov    $0x33,%eax
+    17ec:	49 89 ca             	mov    %rcx,%r10
+    17ef:	0f 05                	syscall
+    17f1:	c3                   	ret
+
+00000000000017f2 <ring_enter>:
+SYSCALL(ring_enter)
+    17f2:	b8 34 00 00 00       	mov    $0x34,%eax
+    17f7:	49 89 ca             	mov    %rcx,%r10
+    17fa:	0f 05                	syscall
+    17fc:	c3                   	ret
+
+00000000000017fd <getdents>:
+SYSCALL(getdents)
+    17fd:	b8 35 00 00 00       	mov    $0x35,%eax
+    1802:	49 89 ca             	mov    %rcx,%r10
+    1805:	0f 05                	syscall
+    1807:	c3                   	ret
+
+0000000000001808 <fstatat>:
+SYSCALL(fstatat)
+    1808:	b8 36 00 00 00       	mov    $0x36,%eax
+    180d:	49 89 ca             	mov    %rcx,%r10
+    1810:	0f 05                	syscall
+    1812:	c3                   	ret
+
+0000000000001813 <clone_file>:
+SYSCALL(clone_file)
+    1813:	b8 37 00 00 00       	mov    $0x37,%eax
+    1818:	49 89 ca             	mov    %rcx,%r10
+    181b:	0f 05                	syscall
+    181d:	c3                   	ret
+
+000000000000181e <fpunch>:
+SYSCALL(fpunch)
+    181e:	b8 38 00 00 00       	mov    $0x38,%eax
+    1823:	49 89 ca             	mov    %rcx,%r10
+    1826:	0f 05                	syscall
+    1828:	c3                   	ret
+
+0000000000001829 <defrag>:
+SYSCALL(defrag)
+    1829:	b8 39 00 00 00       	mov    $0x39,%eax
+    182e:	49 89 ca             	mov    %rcx,%r10
+    1831:	0f 05                	syscall
+    1833:	c3                   	ret
+
+0000000000001834 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1834:	55                   	push   %rbp
+    1835:	48 89 e5             	mov    %rsp,%rbp
+    1838:	48 83 ec 20          	sub    $0x20,%rsp
+    183c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1840:	bf 00 00 00 00       	mov    $0x0,%edi
+    1845:	e8 3d fe ff ff       	call   1687 <sbrk>
+    184a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    184e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1852:	48 f7 d8             	neg    %rax
+    1855:	25 ff 0f 00 00       	and    $0xfff,%eax
+    185a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    185e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1862:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1866:	48 01 c2             	add    %rax,%rdx
+    1869:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    186e:	48 39 c2             	cmp    %rax,%rdx
+    1871:	73 1e                	jae    1891 <morecore+0x5d>
+    1873:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1877:	89 c2                	mov    %eax,%edx
+    1879:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    187d:	01 d0                	add    %edx,%eax
+    187f:	89 c7                	mov    %eax,%edi
+    1881:	e8 01 fe ff ff       	call   1687 <sbrk>
+    1886:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    188a:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    188f:	75 07                	jne    1898 <morecore+0x64>
+    return 0;
+    1891:	b8 00 00 00 00       	mov    $0x0,%eax
+    1896:	eb 27                	jmp    18bf <morecore+0x8b>
+  stats.heap += n + pad;
+    1898:	48 8b 05 f1 18 00 00 	mov    0x18f1(%rip),%rax        # 3190 <stats+0x50>
+    189f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    18a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    18a7:	48 01 ca             	add    %rcx,%rdx
+    18aa:	48 01 d0             	add    %rdx,%rax
+    18ad:	48 89 05 dc 18 00 00 	mov    %rax,0x18dc(%rip)        # 3190 <stats+0x50>
+  return p + pad;
+    18b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    18b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18bc:	48 01 d0             	add    %rdx,%rax
+}
+    18bf:	c9                   	leave
+    18c0:	c3                   	ret
+
+00000000000018c1 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    18c1:	55                   	push   %rbp
+    18c2:	48 89 e5             	mov    %rsp,%rbp
+    18c5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    18c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    18cd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    18d4:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    18d5:	48 8d 05 44 18 00 00 	lea    0x1844(%rip),%rax        # 3120 <runs>
+    18dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18e0:	eb 1a                	jmp    18fc <pagefree+0x3b>
+    prev = *rp;
+    18e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e6:	48 8b 00             	mov    (%rax),%rax
+    18e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    18ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f1:	48 8b 00             	mov    (%rax),%rax
+    18f4:	48 83 c0 08          	add    $0x8,%rax
+    18f8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1900:	48 8b 00             	mov    (%rax),%rax
+    1903:	48 85 c0             	test   %rax,%rax
+    1906:	74 0d                	je     1915 <pagefree+0x54>
+    1908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    190c:	48 8b 00             	mov    (%rax),%rax
+    190f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1913:	72 cd                	jb     18e2 <pagefree+0x21>
+  r = (struct run *)p;
+    1915:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1919:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    191d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1921:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1925:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1928:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    192c:	48 8b 10             	mov    (%rax),%rdx
+    192f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1933:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1937:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    193f:	48 85 c0             	test   %rax,%rax
+    1942:	74 48                	je     198c <pagefree+0xcb>
+    1944:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1948:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    194c:	48 01 c2             	add    %rax,%rdx
+    194f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1953:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1957:	48 39 c2             	cmp    %rax,%rdx
+    195a:	75 30                	jne    198c <pagefree+0xcb>
+    r->size += r->next->size;
+    195c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1960:	48 8b 10             	mov    (%rax),%rdx
+    1963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1967:	48 8b 40 08          	mov    0x8(%rax),%rax
+    196b:	48 8b 00             	mov    (%rax),%rax
+    196e:	48 01 c2             	add    %rax,%rdx
+    1971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1975:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1978:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1980:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1984:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1988:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    198c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1991:	74 46                	je     19d9 <pagefree+0x118>
+    1993:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1997:	48 8b 10             	mov    (%rax),%rdx
+    199a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    199e:	48 01 d0             	add    %rdx,%rax
+    19a1:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    19a5:	75 32                	jne    19d9 <pagefree+0x118>
+    prev->size += r->size;
+    19a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19ab:	48 8b 10             	mov    (%rax),%rdx
+    19ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19b2:	48 8b 00             	mov    (%rax),%rax
+    19b5:	48 01 c2             	add    %rax,%rdx
+    19b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19bc:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    19bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19c3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    19c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19cb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    19cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    19d7:	eb 0c                	jmp    19e5 <pagefree+0x124>
+  } else {
+    *rp = r;
+    19d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    19e1:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    19e4:	90                   	nop
+    19e5:	90                   	nop
+    19e6:	5d                   	pop    %rbp
+    19e7:	c3                   	ret
+
+00000000000019e8 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    19e8:	55                   	push   %rbp
+    19e9:	48 89 e5             	mov    %rsp,%rbp
+    19ec:	48 83 ec 40          	sub    $0x40,%rsp
+    19f0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    19f4:	48 8d 05 25 17 00 00 	lea    0x1725(%rip),%rax        # 3120 <runs>
+    19fb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    19ff:	eb 66                	jmp    1a67 <pagealloc+0x7f>
+    if (r->size == n) {
+    1a01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a05:	48 8b 00             	mov    (%rax),%rax
+    1a08:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1a0c:	75 18                	jne    1a26 <pagealloc+0x3e>
+      *rp = r->next;
+    1a0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a12:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1a16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a1a:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1a1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a21:	e9 ca 00 00 00       	jmp    1af0 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1a26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a2a:	48 8b 00             	mov    (%rax),%rax
+    1a2d:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1a31:	73 28                	jae    1a5b <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1a33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a37:	48 8b 00             	mov    (%rax),%rax
+    1a3a:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1a3e:	48 89 c2             	mov    %rax,%rdx
+    1a41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a45:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1a48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a4c:	48 8b 10             	mov    (%rax),%rdx
+    1a4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a53:	48 01 d0             	add    %rdx,%rax
+    1a56:	e9 95 00 00 00       	jmp    1af0 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1a5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a5f:	48 83 c0 08          	add    $0x8,%rax
+    1a63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a6b:	48 8b 00             	mov    (%rax),%rax
+    1a6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a72:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1a77:	75 88                	jne    1a01 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1a79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1a7d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1a81:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1a88:	00 
+    1a89:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a91:	48 39 c2             	cmp    %rax,%rdx
+    1a94:	48 0f 43 c2          	cmovae %rdx,%rax
+    1a98:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1a9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1aa0:	48 89 c7             	mov    %rax,%rdi
+    1aa3:	e8 8c fd ff ff       	call   1834 <morecore>
+    1aa8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1aac:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1ab1:	75 07                	jne    1aba <pagealloc+0xd2>
+    return 0;
+    1ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ab8:	eb 36                	jmp    1af0 <pagealloc+0x108>
+  if (m > n)
+    1aba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1abe:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1ac2:	73 1a                	jae    1ade <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1ac4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ac8:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1acc:	48 89 c2             	mov    %rax,%rdx
+    1acf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1ad3:	48 89 d6             	mov    %rdx,%rsi
+    1ad6:	48 89 c7             	mov    %rax,%rdi
+    1ad9:	e8 e3 fd ff ff       	call   18c1 <pagefree>
+  return p + m - n;
+    1ade:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ae2:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1ae6:	48 89 c2             	mov    %rax,%rdx
+    1ae9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1aed:	48 01 d0             	add    %rdx,%rax
+}
+    1af0:	c9                   	leave
+    1af1:	c3                   	ret
+
+0000000000001af2 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1af2:	55                   	push   %rbp
+    1af3:	48 89 e5             	mov    %rsp,%rbp
+    1af6:	48 83 ec 30          	sub    $0x30,%rsp
+    1afa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1afd:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1b02:	e8 e1 fe ff ff       	call   19e8 <pagealloc>
+    1b07:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b0b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1b10:	75 0a                	jne    1b1c <refill+0x2a>
+    return -1;
+    1b12:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b17:	e9 da 00 00 00       	jmp    1bf6 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1b1c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1b23:	00 
+    1b24:	e9 ba 00 00 00       	jmp    1be3 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1b29:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b31:	48 01 d0             	add    %rdx,%rax
+    1b34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1b38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b3b:	ba 20 00 00 00       	mov    $0x20,%edx
+    1b40:	89 c1                	mov    %eax,%ecx
+    1b42:	48 d3 e2             	shl    %cl,%rdx
+    1b45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b49:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1b4c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b4f:	48 63 d0             	movslq %eax,%rdx
+    1b52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b56:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1b5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b5d:	48 98                	cltq
+    1b5f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b66:	00 
+    1b67:	48 8d 05 72 15 00 00 	lea    0x1572(%rip),%rax        # 30e0 <freelist>
+    1b6e:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b76:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1b7a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b7d:	48 98                	cltq
+    1b7f:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b86:	00 
+    1b87:	48 8d 15 52 15 00 00 	lea    0x1552(%rip),%rdx        # 30e0 <freelist>
+    1b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b92:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1b96:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b99:	48 98                	cltq
+    1b9b:	48 83 c0 08          	add    $0x8,%rax
+    1b9f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ba6:	00 
+    1ba7:	48 8d 05 96 15 00 00 	lea    0x1596(%rip),%rax        # 3144 <stats+0x4>
+    1bae:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bb1:	8d 48 01             	lea    0x1(%rax),%ecx
+    1bb4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bb7:	48 98                	cltq
+    1bb9:	48 83 c0 08          	add    $0x8,%rax
+    1bbd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bc4:	00 
+    1bc5:	48 8d 05 78 15 00 00 	lea    0x1578(%rip),%rax        # 3144 <stats+0x4>
+    1bcc:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1bcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bd2:	ba 20 00 00 00       	mov    $0x20,%edx
+    1bd7:	89 c1                	mov    %eax,%ecx
+    1bd9:	48 d3 e2             	shl    %cl,%rdx
+    1bdc:	48 89 d0             	mov    %rdx,%rax
+    1bdf:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1be3:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1bea:	00 
+    1beb:	0f 86 38 ff ff ff    	jbe    1b29 <refill+0x37>
+  }
+  return 0;
+    1bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1bf6:	c9                   	leave
+    1bf7:	c3                   	ret
+
+0000000000001bf8 <malloc>:
+
+void *malloc(uint nbytes) {
+    1bf8:	55                   	push   %rbp
+    1bf9:	48 89 e5             	mov    %rsp,%rbp
+    1bfc:	48 83 ec 30          	sub    $0x30,%rsp
+    1c00:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1c03:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c06:	48 83 c0 10          	add    $0x10,%rax
+    1c0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1c0e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1c15:	eb 04                	jmp    1c1b <malloc+0x23>
+    1c17:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1c1b:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1c1f:	7f 16                	jg     1c37 <malloc+0x3f>
+    1c21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c24:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c29:	89 c1                	mov    %eax,%ecx
+    1c2b:	48 d3 e2             	shl    %cl,%rdx
+    1c2e:	48 89 d0             	mov    %rdx,%rax
+    1c31:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1c35:	72 e0                	jb     1c17 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1c37:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1c3b:	75 7d                	jne    1cba <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1c3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c41:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1c47:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1c4d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1c51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c55:	48 89 c7             	mov    %rax,%rdi
+    1c58:	e8 8b fd ff ff       	call   19e8 <pagealloc>
+    1c5d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1c61:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1c66:	75 0a                	jne    1c72 <malloc+0x7a>
+      return 0;
+    1c68:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c6d:	e9 2c 01 00 00       	jmp    1d9e <malloc+0x1a6>
+    h->size = n;
+    1c72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c76:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1c7a:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1c7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c81:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1c88:	00 
+    stats.inuse[LARGE]++;
+    1c89:	8b 05 d1 14 00 00    	mov    0x14d1(%rip),%eax        # 3160 <stats+0x20>
+    1c8f:	83 c0 01             	add    $0x1,%eax
+    1c92:	89 05 c8 14 00 00    	mov    %eax,0x14c8(%rip)        # 3160 <stats+0x20>
+    stats.large += n;
+    1c98:	48 8b 15 e9 14 00 00 	mov    0x14e9(%rip),%rdx        # 3188 <stats+0x48>
+    1c9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca3:	48 01 d0             	add    %rdx,%rax
+    1ca6:	48 89 05 db 14 00 00 	mov    %rax,0x14db(%rip)        # 3188 <stats+0x48>
+    return h + 1;
+    1cad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1cb1:	48 83 c0 10          	add    $0x10,%rax
+    1cb5:	e9 e4 00 00 00       	jmp    1d9e <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1cba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cbd:	48 98                	cltq
+    1cbf:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cc6:	00 
+    1cc7:	48 8d 05 12 14 00 00 	lea    0x1412(%rip),%rax        # 30e0 <freelist>
+    1cce:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1cd2:	48 85 c0             	test   %rax,%rax
+    1cd5:	75 18                	jne    1cef <malloc+0xf7>
+    1cd7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cda:	89 c7                	mov    %eax,%edi
+    1cdc:	e8 11 fe ff ff       	call   1af2 <refill>
+    1ce1:	85 c0                	test   %eax,%eax
+    1ce3:	79 0a                	jns    1cef <malloc+0xf7>
+    return 0;
+    1ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cea:	e9 af 00 00 00       	jmp    1d9e <malloc+0x1a6>
+  b = freelist[c];
+    1cef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cf2:	48 98                	cltq
+    1cf4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cfb:	00 
+    1cfc:	48 8d 05 dd 13 00 00 	lea    0x13dd(%rip),%rax        # 30e0 <freelist>
+    1d03:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1d07:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d0f:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1d13:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1d16:	48 63 d2             	movslq %edx,%rdx
+    1d19:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d20:	00 
+    1d21:	48 8d 15 b8 13 00 00 	lea    0x13b8(%rip),%rdx        # 30e0 <freelist>
+    1d28:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1d2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d2f:	48 98                	cltq
+    1d31:	48 83 c0 08          	add    $0x8,%rax
+    1d35:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d3c:	00 
+    1d3d:	48 8d 05 00 14 00 00 	lea    0x1400(%rip),%rax        # 3144 <stats+0x4>
+    1d44:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d47:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1d4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d4d:	48 98                	cltq
+    1d4f:	48 83 c0 08          	add    $0x8,%rax
+    1d53:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d5a:	00 
+    1d5b:	48 8d 05 e2 13 00 00 	lea    0x13e2(%rip),%rax        # 3144 <stats+0x4>
+    1d62:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1d65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d68:	48 98                	cltq
+    1d6a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d71:	00 
+    1d72:	48 8d 05 c7 13 00 00 	lea    0x13c7(%rip),%rax        # 3140 <stats>
+    1d79:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d7c:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d82:	48 98                	cltq
+    1d84:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d8b:	00 
+    1d8c:	48 8d 05 ad 13 00 00 	lea    0x13ad(%rip),%rax        # 3140 <stats>
+    1d93:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1d96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d9a:	48 83 c0 10          	add    $0x10,%rax
+}
+    1d9e:	c9                   	leave
+    1d9f:	c3                   	ret
+
+0000000000001da0 <free>:
+
+void free(void *ap) {
+    1da0:	55                   	push   %rbp
+    1da1:	48 89 e5             	mov    %rsp,%rbp
+    1da4:	48 83 ec 18          	sub    $0x18,%rsp
+    1da8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1dac:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1db1:	0f 84 03 01 00 00    	je     1eba <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1db7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dbb:	48 83 e8 10          	sub    $0x10,%rax
+    1dbf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dc7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1dcb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1dcf:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1dd4:	75 42                	jne    1e18 <free+0x78>
+    stats.inuse[LARGE]--;
+    1dd6:	8b 05 84 13 00 00    	mov    0x1384(%rip),%eax        # 3160 <stats+0x20>
+    1ddc:	83 e8 01             	sub    $0x1,%eax
+    1ddf:	89 05 7b 13 00 00    	mov    %eax,0x137b(%rip)        # 3160 <stats+0x20>
+    stats.large -= b->h.size;
+    1de5:	48 8b 15 9c 13 00 00 	mov    0x139c(%rip),%rdx        # 3188 <stats+0x48>
+    1dec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1df0:	48 8b 00             	mov    (%rax),%rax
+    1df3:	48 29 c2             	sub    %rax,%rdx
+    1df6:	48 89 15 8b 13 00 00 	mov    %rdx,0x138b(%rip)        # 3188 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1dfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e01:	48 8b 10             	mov    (%rax),%rdx
+    1e04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e08:	48 89 d6             	mov    %rdx,%rsi
+    1e0b:	48 89 c7             	mov    %rax,%rdi
+    1e0e:	e8 ae fa ff ff       	call   18c1 <pagefree>
+    return;
+    1e13:	e9 a3 00 00 00       	jmp    1ebb <free+0x11b>
+  }
+  b->next = freelist[c];
+    1e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e1c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e23:	00 
+    1e24:	48 8d 05 b5 12 00 00 	lea    0x12b5(%rip),%rax        # 30e0 <freelist>
+    1e2b:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1e2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e33:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1e37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e3b:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1e42:	00 
+    1e43:	48 8d 15 96 12 00 00 	lea    0x1296(%rip),%rdx        # 30e0 <freelist>
+    1e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e4e:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1e52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e56:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e5d:	00 
+    1e5e:	48 8d 05 db 12 00 00 	lea    0x12db(%rip),%rax        # 3140 <stats>
+    1e65:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e68:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1e6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e6f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e76:	00 
+    1e77:	48 8d 05 c2 12 00 00 	lea    0x12c2(%rip),%rax        # 3140 <stats>
+    1e7e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1e81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e85:	48 83 c0 08          	add    $0x8,%rax
+    1e89:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e90:	00 
+    1e91:	48 8d 05 ac 12 00 00 	lea    0x12ac(%rip),%rax        # 3144 <stats+0x4>
+    1e98:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e9b:	8d 48 01             	lea    0x1(%rax),%ecx
+    1e9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ea2:	48 83 c0 08          	add    $0x8,%rax
+    1ea6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ead:	00 
+    1eae:	48 8d 05 8f 12 00 00 	lea    0x128f(%rip),%rax        # 3144 <stats+0x4>
+    1eb5:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1eb8:	eb 01                	jmp    1ebb <free+0x11b>
+    return;
+    1eba:	90                   	nop
+}
+    1ebb:	c9                   	leave
+    1ebc:	c3                   	ret
+
+0000000000001ebd <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1ebd:	55                   	push   %rbp
+    1ebe:	48 89 e5             	mov    %rsp,%rbp
+    1ec1:	48 83 ec 30          	sub    $0x30,%rsp
+    1ec5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1ec8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ecb:	48 8d 15 9e 02 00 00 	lea    0x29e(%rip),%rdx        # 2170 <benchreport+0x18b>
+    1ed2:	48 89 d6             	mov    %rdx,%rsi
+    1ed5:	89 c7                	mov    %eax,%edi
+    1ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1edc:	e8 37 e6 ff ff       	call   518 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1ee1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1ee8:	eb 67                	jmp    1f51 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1eea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1eed:	48 98                	cltq
+    1eef:	48 83 c0 08          	add    $0x8,%rax
+    1ef3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1efa:	00 
+    1efb:	48 8d 05 42 12 00 00 	lea    0x1242(%rip),%rax        # 3144 <stats+0x4>
+    1f02:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1f05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f08:	48 98                	cltq
+    1f0a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f11:	00 
+    1f12:	48 8d 05 27 12 00 00 	lea    0x1227(%rip),%rax        # 3140 <stats>
+    1f19:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1f1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f1f:	ba 20 00 00 00       	mov    $0x20,%edx
+    1f24:	89 c1                	mov    %eax,%ecx
+    1f26:	48 d3 e2             	shl    %cl,%rdx
+    1f29:	48 89 d0             	mov    %rdx,%rax
+    1f2c:	89 c1                	mov    %eax,%ecx
+    1f2e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1f31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f34:	41 89 f9             	mov    %edi,%r9d
+    1f37:	41 89 f0             	mov    %esi,%r8d
+    1f3a:	48 8d 35 46 02 00 00 	lea    0x246(%rip),%rsi        # 2187 <benchreport+0x1a2>
+    1f41:	89 c7                	mov    %eax,%edi
+    1f43:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f48:	e8 cb e5 ff ff       	call   518 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1f4d:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1f51:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1f55:	7e 93                	jle    1eea <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1f57:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1f5e:	00 
+  for (r = runs; r; r = r->next)
+    1f5f:	48 8b 05 ba 11 00 00 	mov    0x11ba(%rip),%rax        # 3120 <runs>
+    1f66:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f6a:	eb 17                	jmp    1f83 <mallocstats+0xc6>
+    nfree += r->size;
+    1f6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f70:	48 8b 00             	mov    (%rax),%rax
+    1f73:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1f77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f7b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f83:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1f88:	75 e2                	jne    1f6c <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1f8a:	48 8b 05 ff 11 00 00 	mov    0x11ff(%rip),%rax        # 3190 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f91:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1f93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f97:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f9b:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1f9d:	48 8b 05 e4 11 00 00 	mov    0x11e4(%rip),%rax        # 3188 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1fa4:	89 c1                	mov    %eax,%ecx
+    1fa6:	8b 15 b4 11 00 00    	mov    0x11b4(%rip),%edx        # 3160 <stats+0x20>
+    1fac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1faf:	41 89 f9             	mov    %edi,%r9d
+    1fb2:	41 89 f0             	mov    %esi,%r8d
+    1fb5:	48 8d 35 dc 01 00 00 	lea    0x1dc(%rip),%rsi        # 2198 <benchreport+0x1b3>
+    1fbc:	89 c7                	mov    %eax,%edi
+    1fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fc3:	e8 50 e5 ff ff       	call   518 <printf>
+}
+    1fc8:	90                   	nop
+    1fc9:	c9                   	leave
+    1fca:	c3                   	ret
+
+0000000000001fcb <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1fcb:	55                   	push   %rbp
+    1fcc:	48 89 e5             	mov    %rsp,%rbp
+    1fcf:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1fd3:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1fd7:	48 89 c7             	mov    %rax,%rdi
+    1fda:	e8 9a f7 ff ff       	call   1779 <cycles>
+  return t;
+    1fdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1fe3:	c9                   	leave
+    1fe4:	c3                   	ret
+
+0000000000001fe5 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1fe5:	55                   	push   %rbp
+    1fe6:	48 89 e5             	mov    %rsp,%rbp
+    1fe9:	48 83 ec 30          	sub    $0x30,%rsp
+    1fed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1ff1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1ff5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1ff8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1ffc:	0f 8e 24 01 00 00    	jle    2126 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    2002:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2009:	e9 98 00 00 00       	jmp    20a6 <benchreport+0xc1>
+    x = t[i];
+    200e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2011:	48 98                	cltq
+    2013:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    201a:	00 
+    201b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    201f:	48 01 d0             	add    %rdx,%rax
+    2022:	48 8b 00             	mov    (%rax),%rax
+    2025:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2029:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    202c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    202f:	eb 33                	jmp    2064 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    2031:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2034:	48 98                	cltq
+    2036:	48 c1 e0 03          	shl    $0x3,%rax
+    203a:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    203e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2042:	48 01 d0             	add    %rdx,%rax
+    2045:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2048:	48 63 d2             	movslq %edx,%rdx
+    204b:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2052:	00 
+    2053:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2057:	48 01 ca             	add    %rcx,%rdx
+    205a:	48 8b 00             	mov    (%rax),%rax
+    205d:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2060:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    2064:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2068:	7e 1d                	jle    2087 <benchreport+0xa2>
+    206a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    206d:	48 98                	cltq
+    206f:	48 c1 e0 03          	shl    $0x3,%rax
+    2073:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2077:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    207b:	48 01 d0             	add    %rdx,%rax
+    207e:	48 8b 00             	mov    (%rax),%rax
+    2081:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2085:	72 aa                	jb     2031 <benchreport+0x4c>
+    t[j] = x;
+    2087:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    208a:	48 98                	cltq
+    208c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2093:	00 
+    2094:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2098:	48 01 c2             	add    %rax,%rdx
+    209b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    209f:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    20a2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    20a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20a9:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    20ac:	0f 8c 5c ff ff ff    	jl     200e <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    20b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20b5:	48 98                	cltq
+    20b7:	48 c1 e0 03          	shl    $0x3,%rax
+    20bb:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    20bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20c3:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    20c6:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    20c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20cc:	89 c2                	mov    %eax,%edx
+    20ce:	c1 ea 1f             	shr    $0x1f,%edx
+    20d1:	01 d0                	add    %edx,%eax
+    20d3:	d1 f8                	sar    %eax
+    20d5:	48 98                	cltq
+    20d7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    20de:	00 
+    20df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20e3:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    20e6:	48 8b 38             	mov    (%rax),%rdi
+    20e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20ed:	48 8b 30             	mov    (%rax),%rsi
+    20f0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    20f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20f7:	48 83 ec 08          	sub    $0x8,%rsp
+    20fb:	51                   	push   %rcx
+    20fc:	49 89 f9             	mov    %rdi,%r9
+    20ff:	49 89 f0             	mov    %rsi,%r8
+    2102:	89 d1                	mov    %edx,%ecx
+    2104:	48 89 c2             	mov    %rax,%rdx
+    2107:	48 8d 05 ca 00 00 00 	lea    0xca(%rip),%rax        # 21d8 <benchreport+0x1f3>
+    210e:	48 89 c6             	mov    %rax,%rsi
+    2111:	bf 01 00 00 00       	mov    $0x1,%edi
+    2116:	b8 00 00 00 00       	mov    $0x0,%eax
+    211b:	e8 f8 e3 ff ff       	call   518 <printf>
+    2120:	48 83 c4 10          	add    $0x10,%rsp
+    2124:	eb 01                	jmp    2127 <benchreport+0x142>
+    return;
+    2126:	90                   	nop
+}
+    2127:	c9                   	leave
+    2128:	c3                   	ret
@@ -0,0 +1,3596 @@
+
+out/user/_membench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+//               its parent after fork()
+//   write       a write to a page that is already the process's own
+
+#define PGSIZE 4096
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	53                   	push   %rbx
+       5:	48 83 ec 38          	sub    $0x38,%rsp
+       9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+       c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  uint64_t *t;
+  char *p, *heap;
+  int n, i;
+
+  n = argc > 1 ? atoi(argv[1]) : 100;
+      10:	83 7d cc 01          	cmpl   $0x1,-0x34(%rbp)
+      14:	7e 15                	jle    2b <main+0x2b>
+      16:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      1a:	48 83 c0 08          	add    $0x8,%rax
+      1e:	48 8b 00             	mov    (%rax),%rax
+      21:	48 89 c7             	mov    %rax,%rdi
+      24:	e8 51 10 00 00       	call   107a <atoi>
+      29:	eb 05                	jmp    30 <main+0x30>
+      2b:	b8 64 00 00 00       	mov    $0x64,%eax
+      30:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  if (n <= 0 || (t = malloc(n * sizeof(*t))) == 0) {
+      33:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      37:	7e 1a                	jle    53 <main+0x53>
+      39:	8b 45 e8             	mov    -0x18(%rbp),%eax
+      3c:	48 98                	cltq
+      3e:	c1 e0 03             	shl    $0x3,%eax
+      41:	89 c7                	mov    %eax,%edi
+      43:	e8 78 1b 00 00       	call   1bc0 <malloc>
+      48:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      4c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+      51:	75 1e                	jne    71 <main+0x71>
+    printf(2, "usage: membench [n]\n");
+      53:	48 8d 05 9e 20 00 00 	lea    0x209e(%rip),%rax        # 20f8 <benchreport+0x14b>
+      5a:	48 89 c6             	mov    %rax,%rsi
+      5d:	bf 02 00 00 00       	mov    $0x2,%edi
+      62:	b8 00 00 00 00       	mov    $0x0,%eax
+      67:	e8 74 04 00 00       	call   4e0 <printf>
+    exit();
+      6c:	e8 9f 0a 00 00       	call   b10 <exit>
+  }
+
+  heap = sbrk(0);
+      71:	bf 00 00 00 00       	mov    $0x0,%edi
+      76:	e8 d4 15 00 00       	call   164f <sbrk>
+      7b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  for (i = 0; i < n; i++) {
+      7f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+      86:	e9 8e 00 00 00       	jmp    119 <main+0x119>
+    t[i] = now();
+      8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      8e:	48 98                	cltq
+      90:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      97:	00 
+      98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      9c:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+      a0:	e8 ee 1e 00 00       	call   1f93 <now>
+      a5:	48 89 03             	mov    %rax,(%rbx)
+    p = sbrk(PGSIZE);
+      a8:	bf 00 10 00 00       	mov    $0x1000,%edi
+      ad:	e8 9d 15 00 00       	call   164f <sbrk>
+      b2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    t[i] = now() - t[i];
+      b6:	e8 d8 1e 00 00       	call   1f93 <now>
+      bb:	48 89 c2             	mov    %rax,%rdx
+      be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      c1:	48 98                	cltq
+      c3:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+      ca:	00 
+      cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      cf:	48 01 c8             	add    %rcx,%rax
+      d2:	48 8b 00             	mov    (%rax),%rax
+      d5:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+      d8:	48 63 c9             	movslq %ecx,%rcx
+      db:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+      e2:	00 
+      e3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+      e7:	48 01 f1             	add    %rsi,%rcx
+      ea:	48 29 c2             	sub    %rax,%rdx
+      ed:	48 89 11             	mov    %rdx,(%rcx)
+    if (p == (char *)-1) {
+      f0:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+      f5:	75 1e                	jne    115 <main+0x115>
+      printf(2, "membench: sbrk failed\n");
+      f7:	48 8d 05 0f 20 00 00 	lea    0x200f(%rip),%rax        # 210d <benchreport+0x160>
+      fe:	48 89 c6             	mov    %rax,%rsi
+     101:	bf 02 00 00 00       	mov    $0x2,%edi
+     106:	b8 00 00 00 00       	mov    $0x0,%eax
+     10b:	e8 d0 03 00 00       	call   4e0 <printf>
+      exit();
+     110:	e8 fb 09 00 00       	call   b10 <exit>
+  for (i = 0; i < n; i++) {
+     115:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     119:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     11c:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+     11f:	0f 8c 66 ff ff ff    	jl     8b <main+0x8b>
+    }
+  }
+  benchreport("sbrk", t, n);
+     125:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     128:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     12c:	48 89 c6             	mov    %rax,%rsi
+     12f:	48 8d 05 ee 1f 00 00 	lea    0x1fee(%rip),%rax        # 2124 <benchreport+0x177>
+     136:	48 89 c7             	mov    %rax,%rdi
+     139:	e8 6f 1e 00 00       	call   1fad <benchreport>
+
+  for (i = 0; i < n; i++) {
+     13e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     145:	eb 6e                	jmp    1b5 <main+0x1b5>
+    t[i] = now();
+     147:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     14a:	48 98                	cltq
+     14c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     153:	00 
+     154:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     158:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+     15c:	e8 32 1e 00 00       	call   1f93 <now>
+     161:	48 89 03             	mov    %rax,(%rbx)
+    heap[i * PGSIZE] = 1;
+     164:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     167:	c1 e0 0c             	shl    $0xc,%eax
+     16a:	48 63 d0             	movslq %eax,%rdx
+     16d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     171:	48 01 d0             	add    %rdx,%rax
+     174:	c6 00 01             	movb   $0x1,(%rax)
+    t[i] = now() - t[i];
+     177:	e8 17 1e 00 00       	call   1f93 <now>
+     17c:	48 89 c2             	mov    %rax,%rdx
+     17f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     182:	48 98                	cltq
+     184:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     18b:	00 
+     18c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     190:	48 01 c8             	add    %rcx,%rax
+     193:	48 8b 00             	mov    (%rax),%rax
+     196:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     199:	48 63 c9             	movslq %ecx,%rcx
+     19c:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+     1a3:	00 
+     1a4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     1a8:	48 01 f1             	add    %rsi,%rcx
+     1ab:	48 29 c2             	sub    %rax,%rdx
+     1ae:	48 89 11             	mov    %rdx,(%rcx)
+  for (i = 0; i < n; i++) {
+     1b1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     1b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1b8:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+     1bb:	7c 8a                	jl     147 <main+0x147>
+  }
+  benchreport("first touch", t, n);
+     1bd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     1c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1c4:	48 89 c6             	mov    %rax,%rsi
+     1c7:	48 8d 05 5b 1f 00 00 	lea    0x1f5b(%rip),%rax        # 2129 <benchreport+0x17c>
+     1ce:	48 89 c7             	mov    %rax,%rdi
+     1d1:	e8 d7 1d 00 00       	call   1fad <benchreport>
+
+  if (fork() == 0) {
+     1d6:	e8 25 09 00 00       	call   b00 <fork>
+     1db:	85 c0                	test   %eax,%eax
+     1dd:	0f 85 35 01 00 00    	jne    318 <main+0x318>
+    for (i = 0; i < n; i++) {
+     1e3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     1ea:	eb 6e                	jmp    25a <main+0x25a>
+      t[i] = now();
+     1ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1ef:	48 98                	cltq
+     1f1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     1f8:	00 
+     1f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1fd:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+     201:	e8 8d 1d 00 00       	call   1f93 <now>
+     206:	48 89 03             	mov    %rax,(%rbx)
+      heap[i * PGSIZE] = 2;
+     209:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     20c:	c1 e0 0c             	shl    $0xc,%eax
+     20f:	48 63 d0             	movslq %eax,%rdx
+     212:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     216:	48 01 d0             	add    %rdx,%rax
+     219:	c6 00 02             	movb   $0x2,(%rax)
+      t[i] = now() - t[i];
+     21c:	e8 72 1d 00 00       	call   1f93 <now>
+     221:	48 89 c2             	mov    %rax,%rdx
+     224:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     227:	48 98                	cltq
+     229:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     230:	00 
+     231:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     235:	48 01 c8             	add    %rcx,%rax
+     238:	48 8b 00             	mov    (%rax),%rax
+     23b:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     23e:	48 63 c9             	movslq %ecx,%rcx
+     241:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+     248:	00 
+     249:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     24d:	48 01 f1             	add    %rsi,%rcx
+     250:	48 29 c2             	sub    %rax,%rdx
+     253:	48 89 11             	mov    %rdx,(%rcx)
+    for (i = 0; i < n; i++) {
+     256:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     25a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     25d:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+     260:	7c 8a                	jl     1ec <main+0x1ec>
+    }
+    benchreport("cow fault", t, n);
+     262:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     265:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     269:	48 89 c6             	mov    %rax,%rsi
+     26c:	48 8d 05 c2 1e 00 00 	lea    0x1ec2(%rip),%rax        # 2135 <benchreport+0x188>
+     273:	48 89 c7             	mov    %rax,%rdi
+     276:	e8 32 1d 00 00       	call   1fad <benchreport>
+    for (i = 0; i < n; i++) {
+     27b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     282:	eb 6e                	jmp    2f2 <main+0x2f2>
+      t[i] = now();
+     284:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     287:	48 98                	cltq
+     289:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     290:	00 
+     291:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     295:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+     299:	e8 f5 1c 00 00       	call   1f93 <now>
+     29e:	48 89 03             	mov    %rax,(%rbx)
+      heap[i * PGSIZE] = 3;
+     2a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     2a4:	c1 e0 0c             	shl    $0xc,%eax
+     2a7:	48 63 d0             	movslq %eax,%rdx
+     2aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     2ae:	48 01 d0             	add    %rdx,%rax
+     2b1:	c6 00 03             	movb   $0x3,(%rax)
+      t[i] = now() - t[i];
+     2b4:	e8 da 1c 00 00       	call   1f93 <now>
+     2b9:	48 89 c2             	mov    %rax,%rdx
+     2bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     2bf:	48 98                	cltq
+     2c1:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     2c8:	00 
+     2c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     2cd:	48 01 c8             	add    %rcx,%rax
+     2d0:	48 8b 00             	mov    (%rax),%rax
+     2d3:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     2d6:	48 63 c9             	movslq %ecx,%rcx
+     2d9:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+     2e0:	00 
+     2e1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     2e5:	48 01 f1             	add    %rsi,%rcx
+     2e8:	48 29 c2             	sub    %rax,%rdx
+     2eb:	48 89 11             	mov    %rdx,(%rcx)
+    for (i = 0; i < n; i++) {
+     2ee:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     2f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     2f5:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+     2f8:	7c 8a                	jl     284 <main+0x284>
+    }
+    benchreport("write", t, n);
+     2fa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     2fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     301:	48 89 c6             	mov    %rax,%rsi
+     304:	48 8d 05 34 1e 00 00 	lea    0x1e34(%rip),%rax        # 213f <benchreport+0x192>
+     30b:	48 89 c7             	mov    %rax,%rdi
+     30e:	e8 9a 1c 00 00       	call   1fad <benchreport>
+    exit();
+     313:	e8 f8 07 00 00       	call   b10 <exit>
+  }
+  wait();
+     318:	e8 82 12 00 00       	call   159f <wait>
+  exit();
+     31d:	e8 ee 07 00 00       	call   b10 <exit>
+
+0000000000000322 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     322:	55                   	push   %rbp
+     323:	48 89 e5             	mov    %rsp,%rbp
+     326:	48 83 ec 10          	sub    $0x10,%rsp
+     32a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     32d:	89 f0                	mov    %esi,%eax
+     32f:	88 45 f8             	mov    %al,-0x8(%rbp)
+     332:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     336:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     339:	89 d6                	mov    %edx,%esi
+     33b:	89 c7                	mov    %eax,%edi
+     33d:	e8 eb 06 00 00       	call   a2d <bputc>
+     342:	90                   	nop
+     343:	c9                   	leave
+     344:	c3                   	ret
+
+0000000000000345 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     345:	55                   	push   %rbp
+     346:	48 89 e5             	mov    %rsp,%rbp
+     349:	48 83 ec 50          	sub    $0x50,%rsp
+     34d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     350:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     354:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     357:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     35a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     35e:	74 21                	je     381 <printint64+0x3c>
+     360:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     364:	48 c1 e8 3f          	shr    $0x3f,%rax
+     368:	0f b6 c0             	movzbl %al,%eax
+     36b:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     36e:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     372:	74 0d                	je     381 <printint64+0x3c>
+    x = -xx;
+     374:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     378:	48 f7 d8             	neg    %rax
+     37b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     37f:	eb 08                	jmp    389 <printint64+0x44>
+  else
+    x = xx;
+     381:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     385:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     389:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     390:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     393:	48 63 c8             	movslq %eax,%rcx
+     396:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     39a:	ba 00 00 00 00       	mov    $0x0,%edx
+     39f:	48 f7 f1             	div    %rcx
+     3a2:	48 89 d1             	mov    %rdx,%rcx
+     3a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3a8:	8d 50 01             	lea    0x1(%rax),%edx
+     3ab:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3ae:	48 8d 15 4b 2c 00 00 	lea    0x2c4b(%rip),%rdx        # 3000 <digits.1>
+     3b5:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     3b9:	48 98                	cltq
+     3bb:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     3bf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     3c2:	48 63 f0             	movslq %eax,%rsi
+     3c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3c9:	ba 00 00 00 00       	mov    $0x0,%edx
+     3ce:	48 f7 f6             	div    %rsi
+     3d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     3d5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     3da:	75 b4                	jne    390 <printint64+0x4b>
+
+  if (sgn)
+     3dc:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     3e0:	74 2b                	je     40d <printint64+0xc8>
+    buf[i++] = '-';
+     3e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3e5:	8d 50 01             	lea    0x1(%rax),%edx
+     3e8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     3eb:	48 98                	cltq
+     3ed:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     3f2:	eb 19                	jmp    40d <printint64+0xc8>
+    putc(fd, buf[i]);
+     3f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3f7:	48 98                	cltq
+     3f9:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     3fe:	0f be d0             	movsbl %al,%edx
+     401:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     404:	89 d6                	mov    %edx,%esi
+     406:	89 c7                	mov    %eax,%edi
+     408:	e8 15 ff ff ff       	call   322 <putc>
+  while (--i >= 0)
+     40d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     411:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     415:	79 dd                	jns    3f4 <printint64+0xaf>
+}
+     417:	90                   	nop
+     418:	90                   	nop
+     419:	c9                   	leave
+     41a:	c3                   	ret
+
+000000000000041b <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     41b:	55                   	push   %rbp
+     41c:	48 89 e5             	mov    %rsp,%rbp
+     41f:	48 83 ec 30          	sub    $0x30,%rsp
+     423:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     426:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     429:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     42c:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     42f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     436:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     43a:	74 17                	je     453 <printint+0x38>
+     43c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     440:	79 11                	jns    453 <printint+0x38>
+    neg = 1;
+     442:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     449:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     44c:	f7 d8                	neg    %eax
+     44e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     451:	eb 06                	jmp    459 <printint+0x3e>
+  } else {
+    x = xx;
+     453:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     456:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     459:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     460:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     463:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     466:	ba 00 00 00 00       	mov    $0x0,%edx
+     46b:	f7 f1                	div    %ecx
+     46d:	89 d1                	mov    %edx,%ecx
+     46f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     472:	8d 50 01             	lea    0x1(%rax),%edx
+     475:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     478:	89 c9                	mov    %ecx,%ecx
+     47a:	48 8d 15 9f 2b 00 00 	lea    0x2b9f(%rip),%rdx        # 3020 <digits.0>
+     481:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     485:	48 98                	cltq
+     487:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     48b:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     48e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     491:	ba 00 00 00 00       	mov    $0x0,%edx
+     496:	f7 f6                	div    %esi
+     498:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     49b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     49f:	75 bf                	jne    460 <printint+0x45>
+  if (neg)
+     4a1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     4a5:	74 2b                	je     4d2 <printint+0xb7>
+    buf[i++] = '-';
+     4a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4aa:	8d 50 01             	lea    0x1(%rax),%edx
+     4ad:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4b0:	48 98                	cltq
+     4b2:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     4b7:	eb 19                	jmp    4d2 <printint+0xb7>
+    putc(fd, buf[i]);
+     4b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4bc:	48 98                	cltq
+     4be:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     4c3:	0f be d0             	movsbl %al,%edx
+     4c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     4c9:	89 d6                	mov    %edx,%esi
+     4cb:	89 c7                	mov    %eax,%edi
+     4cd:	e8 50 fe ff ff       	call   322 <putc>
+  while (--i >= 0)
+     4d2:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     4d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     4da:	79 dd                	jns    4b9 <printint+0x9e>
+}
+     4dc:	90                   	nop
+     4dd:	90                   	nop
+     4de:	c9                   	leave
+     4df:	c3                   	ret
+
+00000000000004e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     4e0:	55                   	push   %rbp
+     4e1:	48 89 e5             	mov    %rsp,%rbp
+     4e4:	48 83 ec 70          	sub    $0x70,%rsp
+     4e8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     4eb:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     4ef:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     4f3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     4f7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     4fb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     4ff:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     506:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     50a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     50e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     512:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     516:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     51d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     524:	e9 67 02 00 00       	jmp    790 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     529:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     52c:	48 63 d0             	movslq %eax,%rdx
+     52f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     533:	48 01 d0             	add    %rdx,%rax
+     536:	0f b6 00             	movzbl (%rax),%eax
+     539:	0f be c0             	movsbl %al,%eax
+     53c:	25 ff 00 00 00       	and    $0xff,%eax
+     541:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     544:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     548:	75 30                	jne    57a <printf+0x9a>
+      if (c == '%') {
+     54a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     54e:	75 13                	jne    563 <printf+0x83>
+        state = '%';
+     550:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     557:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     55e:	e9 29 02 00 00       	jmp    78c <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     563:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     566:	0f be d0             	movsbl %al,%edx
+     569:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     56c:	89 d6                	mov    %edx,%esi
+     56e:	89 c7                	mov    %eax,%edi
+     570:	e8 ad fd ff ff       	call   322 <putc>
+     575:	e9 12 02 00 00       	jmp    78c <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     57a:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     57e:	0f 85 08 02 00 00    	jne    78c <printf+0x2ac>
+      if (c == 'l') {
+     584:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     588:	75 0c                	jne    596 <printf+0xb6>
+        lflag = 1;
+     58a:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     591:	e9 f6 01 00 00       	jmp    78c <printf+0x2ac>
+      } else if (c == 'd') {
+     596:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     59a:	0f 85 93 00 00 00    	jne    633 <printf+0x153>
+        if (lflag == 1)
+     5a0:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     5a4:	75 47                	jne    5ed <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     5a6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     5a9:	83 f8 2f             	cmp    $0x2f,%eax
+     5ac:	77 17                	ja     5c5 <printf+0xe5>
+     5ae:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     5b2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5b5:	89 d2                	mov    %edx,%edx
+     5b7:	48 01 d0             	add    %rdx,%rax
+     5ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5bd:	83 c2 08             	add    $0x8,%edx
+     5c0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     5c3:	eb 0c                	jmp    5d1 <printf+0xf1>
+     5c5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     5c9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     5cd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     5d1:	48 8b 30             	mov    (%rax),%rsi
+     5d4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5d7:	b9 01 00 00 00       	mov    $0x1,%ecx
+     5dc:	ba 0a 00 00 00       	mov    $0xa,%edx
+     5e1:	89 c7                	mov    %eax,%edi
+     5e3:	e8 5d fd ff ff       	call   345 <printint64>
+     5e8:	e9 98 01 00 00       	jmp    785 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     5ed:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     5f0:	83 f8 2f             	cmp    $0x2f,%eax
+     5f3:	77 17                	ja     60c <printf+0x12c>
+     5f5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     5f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5fc:	89 d2                	mov    %edx,%edx
+     5fe:	48 01 d0             	add    %rdx,%rax
+     601:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     604:	83 c2 08             	add    $0x8,%edx
+     607:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     60a:	eb 0c                	jmp    618 <printf+0x138>
+     60c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     610:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     614:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     618:	8b 30                	mov    (%rax),%esi
+     61a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     61d:	b9 01 00 00 00       	mov    $0x1,%ecx
+     622:	ba 0a 00 00 00       	mov    $0xa,%edx
+     627:	89 c7                	mov    %eax,%edi
+     629:	e8 ed fd ff ff       	call   41b <printint>
+     62e:	e9 52 01 00 00       	jmp    785 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     633:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     637:	74 0a                	je     643 <printf+0x163>
+     639:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     63d:	0f 85 93 00 00 00    	jne    6d6 <printf+0x1f6>
+        if (lflag == 1)
+     643:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     647:	75 47                	jne    690 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     649:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     64c:	83 f8 2f             	cmp    $0x2f,%eax
+     64f:	77 17                	ja     668 <printf+0x188>
+     651:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     655:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     658:	89 d2                	mov    %edx,%edx
+     65a:	48 01 d0             	add    %rdx,%rax
+     65d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     660:	83 c2 08             	add    $0x8,%edx
+     663:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     666:	eb 0c                	jmp    674 <printf+0x194>
+     668:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     66c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     670:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     674:	48 8b 30             	mov    (%rax),%rsi
+     677:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     67a:	b9 00 00 00 00       	mov    $0x0,%ecx
+     67f:	ba 10 00 00 00       	mov    $0x10,%edx
+     684:	89 c7                	mov    %eax,%edi
+     686:	e8 ba fc ff ff       	call   345 <printint64>
+        if (lflag == 1)
+     68b:	e9 f5 00 00 00       	jmp    785 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     690:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     693:	83 f8 2f             	cmp    $0x2f,%eax
+     696:	77 17                	ja     6af <printf+0x1cf>
+     698:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     69c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     69f:	89 d2                	mov    %edx,%edx
+     6a1:	48 01 d0             	add    %rdx,%rax
+     6a4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6a7:	83 c2 08             	add    $0x8,%edx
+     6aa:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     6ad:	eb 0c                	jmp    6bb <printf+0x1db>
+     6af:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     6b3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     6b7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     6bb:	8b 30                	mov    (%rax),%esi
+     6bd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     6c5:	ba 10 00 00 00       	mov    $0x10,%edx
+     6ca:	89 c7                	mov    %eax,%edi
+     6cc:	e8 4a fd ff ff       	call   41b <printint>
+        if (lflag == 1)
+     6d1:	e9 af 00 00 00       	jmp    785 <printf+0x2a5>
+      } else if (c == 's') {
+     6d6:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     6da:	75 6e                	jne    74a <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     6dc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     6df:	83 f8 2f             	cmp    $0x2f,%eax
+     6e2:	77 17                	ja     6fb <printf+0x21b>
+     6e4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     6e8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6eb:	89 d2                	mov    %edx,%edx
+     6ed:	48 01 d0             	add    %rdx,%rax
+     6f0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6f3:	83 c2 08             	add    $0x8,%edx
+     6f6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     6f9:	eb 0c                	jmp    707 <printf+0x227>
+     6fb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     6ff:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     703:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     707:	48 8b 00             	mov    (%rax),%rax
+     70a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     70e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     713:	75 28                	jne    73d <printf+0x25d>
+          s = "(null)";
+     715:	48 8d 05 29 1a 00 00 	lea    0x1a29(%rip),%rax        # 2145 <benchreport+0x198>
+     71c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     720:	eb 1b                	jmp    73d <printf+0x25d>
+          putc(fd, *s);
+     722:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     726:	0f b6 00             	movzbl (%rax),%eax
+     729:	0f be d0             	movsbl %al,%edx
+     72c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     72f:	89 d6                	mov    %edx,%esi
+     731:	89 c7                	mov    %eax,%edi
+     733:	e8 ea fb ff ff       	call   322 <putc>
+        for (; *s; s++)
+     738:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     73d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     741:	0f b6 00             	movzbl (%rax),%eax
+     744:	84 c0                	test   %al,%al
+     746:	75 da                	jne    722 <printf+0x242>
+     748:	eb 3b                	jmp    785 <printf+0x2a5>
+      } else if (c == '%') {
+     74a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     74e:	75 14                	jne    764 <printf+0x284>
+        putc(fd, c);
+     750:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     753:	0f be d0             	movsbl %al,%edx
+     756:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     759:	89 d6                	mov    %edx,%esi
+     75b:	89 c7                	mov    %eax,%edi
+     75d:	e8 c0 fb ff ff       	call   322 <putc>
+     762:	eb 21                	jmp    785 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     764:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     767:	be 25 00 00 00       	mov    $0x25,%esi
+     76c:	89 c7                	mov    %eax,%edi
+     76e:	e8 af fb ff ff       	call   322 <putc>
+        putc(fd, c);
+     773:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     776:	0f be d0             	movsbl %al,%edx
+     779:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     77c:	89 d6                	mov    %edx,%esi
+     77e:	89 c7                	mov    %eax,%edi
+     780:	e8 9d fb ff ff       	call   322 <putc>
+      }
+      state = 0;
+     785:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     78c:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     790:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     793:	48 63 d0             	movslq %eax,%rdx
+     796:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     79a:	48 01 d0             	add    %rdx,%rax
+     79d:	0f b6 00             	movzbl (%rax),%eax
+     7a0:	84 c0                	test   %al,%al
+     7a2:	0f 85 81 fd ff ff    	jne    529 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     7a8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7ab:	89 c7                	mov    %eax,%edi
+     7ad:	e8 ee 02 00 00       	call   aa0 <bflushtty>
+}
+     7b2:	90                   	nop
+     7b3:	c9                   	leave
+     7b4:	c3                   	ret
+
+00000000000007b5 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     7b5:	55                   	push   %rbp
+     7b6:	48 89 e5             	mov    %rsp,%rbp
+     7b9:	48 83 ec 30          	sub    $0x30,%rsp
+     7bd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     7c0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     7c4:	78 06                	js     7cc <getbuf+0x17>
+     7c6:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     7ca:	7e 0a                	jle    7d6 <getbuf+0x21>
+    return 0;
+     7cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d1:	e9 94 00 00 00       	jmp    86a <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     7d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7d9:	48 98                	cltq
+     7db:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     7e2:	00 
+     7e3:	48 8d 05 56 28 00 00 	lea    0x2856(%rip),%rax        # 3040 <obufs>
+     7ea:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     7ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     7f2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     7f7:	75 6d                	jne    866 <getbuf+0xb1>
+     7f9:	bf 08 02 00 00       	mov    $0x208,%edi
+     7fe:	e8 bd 13 00 00       	call   1bc0 <malloc>
+     803:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     807:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     80c:	74 58                	je     866 <getbuf+0xb1>
+    b->n = 0;
+     80e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     812:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     818:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     81c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     81f:	48 89 d6             	mov    %rdx,%rsi
+     822:	89 c7                	mov    %eax,%edi
+     824:	e8 e4 0d 00 00       	call   160d <fstat>
+     829:	85 c0                	test   %eax,%eax
+     82b:	75 11                	jne    83e <getbuf+0x89>
+     82d:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     831:	66 83 f8 03          	cmp    $0x3,%ax
+     835:	75 07                	jne    83e <getbuf+0x89>
+     837:	ba 01 00 00 00       	mov    $0x1,%edx
+     83c:	eb 05                	jmp    843 <getbuf+0x8e>
+     83e:	ba 00 00 00 00       	mov    $0x0,%edx
+     843:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     847:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     84a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     84d:	48 98                	cltq
+     84f:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     856:	00 
+     857:	48 8d 15 e2 27 00 00 	lea    0x27e2(%rip),%rdx        # 3040 <obufs>
+     85e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     862:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     86a:	c9                   	leave
+     86b:	c3                   	ret
+
+000000000000086c <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     86c:	55                   	push   %rbp
+     86d:	48 89 e5             	mov    %rsp,%rbp
+     870:	48 83 ec 20          	sub    $0x20,%rsp
+     874:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     877:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     87b:	78 33                	js     8b0 <bflush+0x44>
+     87d:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     881:	7f 2d                	jg     8b0 <bflush+0x44>
+     883:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     886:	48 98                	cltq
+     888:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     88f:	00 
+     890:	48 8d 05 a9 27 00 00 	lea    0x27a9(%rip),%rax        # 3040 <obufs>
+     897:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     89b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     89f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8a4:	74 0a                	je     8b0 <bflush+0x44>
+     8a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8aa:	8b 00                	mov    (%rax),%eax
+     8ac:	85 c0                	test   %eax,%eax
+     8ae:	75 07                	jne    8b7 <bflush+0x4b>
+    return 0;
+     8b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b5:	eb 3c                	jmp    8f3 <bflush+0x87>
+  n = b->n;
+     8b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8bb:	8b 00                	mov    (%rax),%eax
+     8bd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     8c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8c4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     8ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8ce:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     8d2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     8d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8d8:	48 89 ce             	mov    %rcx,%rsi
+     8db:	89 c7                	mov    %eax,%edi
+     8dd:	e8 de 0c 00 00       	call   15c0 <write>
+     8e2:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     8e5:	75 07                	jne    8ee <bflush+0x82>
+     8e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     8ec:	eb 05                	jmp    8f3 <bflush+0x87>
+     8ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     8f3:	c9                   	leave
+     8f4:	c3                   	ret
+
+00000000000008f5 <bflushall>:
+
+void bflushall(void) {
+     8f5:	55                   	push   %rbp
+     8f6:	48 89 e5             	mov    %rsp,%rbp
+     8f9:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     8fd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     904:	eb 0e                	jmp    914 <bflushall+0x1f>
+    bflush(fd);
+     906:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     909:	89 c7                	mov    %eax,%edi
+     90b:	e8 5c ff ff ff       	call   86c <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     910:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     914:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     918:	7e ec                	jle    906 <bflushall+0x11>
+}
+     91a:	90                   	nop
+     91b:	90                   	nop
+     91c:	c9                   	leave
+     91d:	c3                   	ret
+
+000000000000091e <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     91e:	55                   	push   %rbp
+     91f:	48 89 e5             	mov    %rsp,%rbp
+     922:	48 83 ec 30          	sub    $0x30,%rsp
+     926:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     929:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     92d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     930:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     933:	89 c7                	mov    %eax,%edi
+     935:	e8 7b fe ff ff       	call   7b5 <getbuf>
+     93a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     93e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     943:	75 19                	jne    95e <bwrite+0x40>
+    return write(fd, s, n);
+     945:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     948:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     94c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     94f:	48 89 ce             	mov    %rcx,%rsi
+     952:	89 c7                	mov    %eax,%edi
+     954:	e8 67 0c 00 00       	call   15c0 <write>
+     959:	e9 cd 00 00 00       	jmp    a2b <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     95e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     965:	e9 92 00 00 00       	jmp    9fc <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     96a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     96e:	8b 00                	mov    (%rax),%eax
+     970:	3d 00 02 00 00       	cmp    $0x200,%eax
+     975:	75 18                	jne    98f <bwrite+0x71>
+     977:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     97a:	89 c7                	mov    %eax,%edi
+     97c:	e8 eb fe ff ff       	call   86c <bflush>
+     981:	85 c0                	test   %eax,%eax
+     983:	79 0a                	jns    98f <bwrite+0x71>
+      return -1;
+     985:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     98a:	e9 9c 00 00 00       	jmp    a2b <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     98f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     992:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     995:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     998:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     99c:	8b 00                	mov    (%rax),%eax
+     99e:	ba 00 02 00 00       	mov    $0x200,%edx
+     9a3:	29 c2                	sub    %eax,%edx
+     9a5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     9a8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     9ab:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     9ae:	39 c2                	cmp    %eax,%edx
+     9b0:	0f 4e c2             	cmovle %edx,%eax
+     9b3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     9b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9b9:	48 63 d0             	movslq %eax,%rdx
+     9bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     9c0:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     9c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9c8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9d0:	8b 00                	mov    (%rax),%eax
+     9d2:	48 98                	cltq
+     9d4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     9d8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     9db:	89 c2                	mov    %eax,%edx
+     9dd:	48 89 cf             	mov    %rcx,%rdi
+     9e0:	e8 e9 06 00 00       	call   10ce <memmove>
+    b->n += m;
+     9e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9e9:	8b 10                	mov    (%rax),%edx
+     9eb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     9ee:	01 c2                	add    %eax,%edx
+     9f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9f4:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     9f6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     9f9:	01 45 fc             	add    %eax,-0x4(%rbp)
+     9fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9ff:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     a02:	0f 8c 62 ff ff ff    	jl     96a <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     a08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a0c:	8b 40 04             	mov    0x4(%rax),%eax
+     a0f:	85 c0                	test   %eax,%eax
+     a11:	74 15                	je     a28 <bwrite+0x10a>
+     a13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a16:	89 c7                	mov    %eax,%edi
+     a18:	e8 4f fe ff ff       	call   86c <bflush>
+     a1d:	85 c0                	test   %eax,%eax
+     a1f:	79 07                	jns    a28 <bwrite+0x10a>
+    return -1;
+     a21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a26:	eb 03                	jmp    a2b <bwrite+0x10d>
+  return n;
+     a28:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     a2b:	c9                   	leave
+     a2c:	c3                   	ret
+
+0000000000000a2d <bputc>:
+
+void bputc(int fd, char c) {
+     a2d:	55                   	push   %rbp
+     a2e:	48 89 e5             	mov    %rsp,%rbp
+     a31:	48 83 ec 20          	sub    $0x20,%rsp
+     a35:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     a38:	89 f0                	mov    %esi,%eax
+     a3a:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     a3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a40:	89 c7                	mov    %eax,%edi
+     a42:	e8 6e fd ff ff       	call   7b5 <getbuf>
+     a47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a4b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a50:	75 18                	jne    a6a <bputc+0x3d>
+    write(fd, &c, 1);
+     a52:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     a56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a59:	ba 01 00 00 00       	mov    $0x1,%edx
+     a5e:	48 89 ce             	mov    %rcx,%rsi
+     a61:	89 c7                	mov    %eax,%edi
+     a63:	e8 58 0b 00 00       	call   15c0 <write>
+    return;
+     a68:	eb 34                	jmp    a9e <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     a6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a6e:	8b 00                	mov    (%rax),%eax
+     a70:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a75:	75 0a                	jne    a81 <bputc+0x54>
+    bflush(fd);
+     a77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a7a:	89 c7                	mov    %eax,%edi
+     a7c:	e8 eb fd ff ff       	call   86c <bflush>
+  b->data[b->n++] = c;
+     a81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a85:	8b 00                	mov    (%rax),%eax
+     a87:	8d 48 01             	lea    0x1(%rax),%ecx
+     a8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     a8e:	89 0a                	mov    %ecx,(%rdx)
+     a90:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     a94:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     a98:	48 98                	cltq
+     a9a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     a9e:	c9                   	leave
+     a9f:	c3                   	ret
+
+0000000000000aa0 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     aa0:	55                   	push   %rbp
+     aa1:	48 89 e5             	mov    %rsp,%rbp
+     aa4:	48 83 ec 10          	sub    $0x10,%rsp
+     aa8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     aab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     aaf:	78 4c                	js     afd <bflushtty+0x5d>
+     ab1:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     ab5:	7f 46                	jg     afd <bflushtty+0x5d>
+     ab7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aba:	48 98                	cltq
+     abc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ac3:	00 
+     ac4:	48 8d 05 75 25 00 00 	lea    0x2575(%rip),%rax        # 3040 <obufs>
+     acb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     acf:	48 85 c0             	test   %rax,%rax
+     ad2:	74 29                	je     afd <bflushtty+0x5d>
+     ad4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ad7:	48 98                	cltq
+     ad9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ae0:	00 
+     ae1:	48 8d 05 58 25 00 00 	lea    0x2558(%rip),%rax        # 3040 <obufs>
+     ae8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     aec:	8b 40 04             	mov    0x4(%rax),%eax
+     aef:	85 c0                	test   %eax,%eax
+     af1:	74 0a                	je     afd <bflushtty+0x5d>
+    bflush(fd);
+     af3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     af6:	89 c7                	mov    %eax,%edi
+     af8:	e8 6f fd ff ff       	call   86c <bflush>
+}
+     afd:	90                   	nop
+     afe:	c9                   	leave
+     aff:	c3                   	ret
+
+0000000000000b00 <fork>:
+
+int fork(void) {
+     b00:	55                   	push   %rbp
+     b01:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     b04:	e8 ec fd ff ff       	call   8f5 <bflushall>
+  return _fork();
+     b09:	e8 7b 0a 00 00       	call   1589 <_fork>
+}
+     b0e:	5d                   	pop    %rbp
+     b0f:	c3                   	ret
+
+0000000000000b10 <exit>:
+
+noreturn void exit(void) {
+     b10:	55                   	push   %rbp
+     b11:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     b14:	e8 dc fd ff ff       	call   8f5 <bflushall>
+  _exit();
+     b19:	e8 76 0a 00 00       	call   1594 <_exit>
+
+0000000000000b1e <exec>:
+}
+
+int exec(char *path, char **argv) {
+     b1e:	55                   	push   %rbp
+     b1f:	48 89 e5             	mov    %rsp,%rbp
+     b22:	48 83 ec 10          	sub    $0x10,%rsp
+     b26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b2a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     b2e:	e8 c2 fd ff ff       	call   8f5 <bflushall>
+  return _exec(path, argv);
+     b33:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b3b:	48 89 d6             	mov    %rdx,%rsi
+     b3e:	48 89 c7             	mov    %rax,%rdi
+     b41:	e8 9b 0a 00 00       	call   15e1 <_exec>
+}
+     b46:	c9                   	leave
+     b47:	c3                   	ret
+
+0000000000000b48 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     b48:	55                   	push   %rbp
+     b49:	48 89 e5             	mov    %rsp,%rbp
+     b4c:	48 83 ec 20          	sub    $0x20,%rsp
+     b50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b54:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b58:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     b5c:	e8 94 fd ff ff       	call   8f5 <bflushall>
+  return _spawn(path, argv, fds);
+     b61:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b65:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     b69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b6d:	48 89 ce             	mov    %rcx,%rsi
+     b70:	48 89 c7             	mov    %rax,%rdi
+     b73:	e8 2f 0b 00 00       	call   16a7 <_spawn>
+}
+     b78:	c9                   	leave
+     b79:	c3                   	ret
+
+0000000000000b7a <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     b7a:	55                   	push   %rbp
+     b7b:	48 89 e5             	mov    %rsp,%rbp
+     b7e:	48 83 ec 10          	sub    $0x10,%rsp
+     b82:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     b85:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b89:	78 69                	js     bf4 <close+0x7a>
+     b8b:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     b8f:	7f 63                	jg     bf4 <close+0x7a>
+     b91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b94:	48 98                	cltq
+     b96:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     b9d:	00 
+     b9e:	48 8d 05 9b 24 00 00 	lea    0x249b(%rip),%rax        # 3040 <obufs>
+     ba5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     ba9:	48 85 c0             	test   %rax,%rax
+     bac:	74 46                	je     bf4 <close+0x7a>
+    bflush(fd);
+     bae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bb1:	89 c7                	mov    %eax,%edi
+     bb3:	e8 b4 fc ff ff       	call   86c <bflush>
+    free(obufs[fd]);
+     bb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bbb:	48 98                	cltq
+     bbd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     bc4:	00 
+     bc5:	48 8d 05 74 24 00 00 	lea    0x2474(%rip),%rax        # 3040 <obufs>
+     bcc:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     bd0:	48 89 c7             	mov    %rax,%rdi
+     bd3:	e8 90 11 00 00       	call   1d68 <free>
+    obufs[fd] = 0;
+     bd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bdb:	48 98                	cltq
+     bdd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     be4:	00 
+     be5:	48 8d 05 54 24 00 00 	lea    0x2454(%rip),%rax        # 3040 <obufs>
+     bec:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     bf3:	00 
+  }
+  return _close(fd);
+     bf4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bf7:	89 c7                	mov    %eax,%edi
+     bf9:	e8 cd 09 00 00       	call   15cb <_close>
+}
+     bfe:	c9                   	leave
+     bff:	c3                   	ret
+
+0000000000000c00 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     c00:	55                   	push   %rbp
+     c01:	48 89 e5             	mov    %rsp,%rbp
+     c04:	53                   	push   %rbx
+     c05:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c09:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     c0d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     c11:	48 8b 36             	mov    (%rsi),%rsi
+     c14:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     c18:	48 29 f7             	sub    %rsi,%rdi
+     c1b:	48 89 f9             	mov    %rdi,%rcx
+     c1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c23:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     c27:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     c2b:	48 89 f0             	mov    %rsi,%rax
+     c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+     c33:	48 89 df             	mov    %rbx,%rdi
+     c36:	48 0f af f8          	imul   %rax,%rdi
+     c3a:	48 89 d6             	mov    %rdx,%rsi
+     c3d:	48 0f af f1          	imul   %rcx,%rsi
+     c41:	48 01 fe             	add    %rdi,%rsi
+     c44:	48 f7 e1             	mul    %rcx
+     c47:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     c4b:	48 89 ca             	mov    %rcx,%rdx
+     c4e:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     c53:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     c57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c5b:	c9                   	leave
+     c5c:	c3                   	ret
+
+0000000000000c5d <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     c5d:	55                   	push   %rbp
+     c5e:	48 89 e5             	mov    %rsp,%rbp
+     c61:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c65:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c68:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     c6b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     c6f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c75:	48 89 ce             	mov    %rcx,%rsi
+     c78:	48 89 f7             	mov    %rsi,%rdi
+     c7b:	89 d1                	mov    %edx,%ecx
+     c7d:	fc                   	cld
+     c7e:	f3 aa                	rep stos %al,%es:(%rdi)
+     c80:	89 ca                	mov    %ecx,%edx
+     c82:	48 89 fe             	mov    %rdi,%rsi
+     c85:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     c89:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     c8c:	90                   	nop
+     c8d:	5d                   	pop    %rbp
+     c8e:	c3                   	ret
+
+0000000000000c8f <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     c8f:	55                   	push   %rbp
+     c90:	48 89 e5             	mov    %rsp,%rbp
+     c93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c97:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     c9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     c9f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ca3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     ca7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cab:	48 89 ce             	mov    %rcx,%rsi
+     cae:	48 89 f7             	mov    %rsi,%rdi
+     cb1:	48 89 d1             	mov    %rdx,%rcx
+     cb4:	fc                   	cld
+     cb5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     cb8:	48 89 ca             	mov    %rcx,%rdx
+     cbb:	48 89 fe             	mov    %rdi,%rsi
+     cbe:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     cc2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     cc6:	90                   	nop
+     cc7:	5d                   	pop    %rbp
+     cc8:	c3                   	ret
+
+0000000000000cc9 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     cc9:	55                   	push   %rbp
+     cca:	48 89 e5             	mov    %rsp,%rbp
+     ccd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     cd5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     cd9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     cdd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ce1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ce5:	48 89 cf             	mov    %rcx,%rdi
+     ce8:	48 89 d6             	mov    %rdx,%rsi
+     ceb:	48 89 c1             	mov    %rax,%rcx
+     cee:	fc                   	cld
+     cef:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     cf1:	48 89 c8             	mov    %rcx,%rax
+     cf4:	48 89 f2             	mov    %rsi,%rdx
+     cf7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cfb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     cff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     d03:	90                   	nop
+     d04:	5d                   	pop    %rbp
+     d05:	c3                   	ret
+
+0000000000000d06 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     d06:	55                   	push   %rbp
+     d07:	48 89 e5             	mov    %rsp,%rbp
+     d0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d0e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     d12:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     d16:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     d1a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d22:	48 89 cf             	mov    %rcx,%rdi
+     d25:	48 89 d6             	mov    %rdx,%rsi
+     d28:	48 89 c1             	mov    %rax,%rcx
+     d2b:	fc                   	cld
+     d2c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     d2f:	48 89 c8             	mov    %rcx,%rax
+     d32:	48 89 f2             	mov    %rsi,%rdx
+     d35:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d39:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     d3d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     d41:	90                   	nop
+     d42:	5d                   	pop    %rbp
+     d43:	c3                   	ret
+
+0000000000000d44 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     d44:	55                   	push   %rbp
+     d45:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     d48:	0f 31                	rdtsc
+     d4a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     d4d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     d50:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d53:	48 c1 e0 20          	shl    $0x20,%rax
+     d57:	48 89 c2             	mov    %rax,%rdx
+     d5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d5d:	48 09 d0             	or     %rdx,%rax
+}
+     d60:	5d                   	pop    %rbp
+     d61:	c3                   	ret
+
+0000000000000d62 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     d62:	55                   	push   %rbp
+     d63:	48 89 e5             	mov    %rsp,%rbp
+     d66:	53                   	push   %rbx
+     d67:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     d6a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     d6e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     d72:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     d76:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     d7a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     d7d:	0f a2                	cpuid
+     d7f:	89 de                	mov    %ebx,%esi
+     d81:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     d84:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     d87:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     d8a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     d8d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     d92:	74 09                	je     d9d <cpuid+0x3b>
+    *eaxp = eax;
+     d94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     d98:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     d9b:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     d9d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     da2:	74 09                	je     dad <cpuid+0x4b>
+    *ebxp = ebx;
+     da4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     da8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     dab:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     dad:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     db2:	74 09                	je     dbd <cpuid+0x5b>
+    *ecxp = ecx;
+     db4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     db8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     dbb:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     dbd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     dc2:	74 09                	je     dcd <cpuid+0x6b>
+    *edxp = edx;
+     dc4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     dc8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     dcb:	89 10                	mov    %edx,(%rax)
+}
+     dcd:	90                   	nop
+     dce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     dd2:	c9                   	leave
+     dd3:	c3                   	ret
+
+0000000000000dd4 <strcpy>:
+char *strcpy(char *s, char *t) {
+     dd4:	55                   	push   %rbp
+     dd5:	48 89 e5             	mov    %rsp,%rbp
+     dd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ddc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     de0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     de4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     de8:	90                   	nop
+     de9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     ded:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     df1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     df5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     df9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     dfd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     e01:	0f b6 12             	movzbl (%rdx),%edx
+     e04:	88 10                	mov    %dl,(%rax)
+     e06:	0f b6 00             	movzbl (%rax),%eax
+     e09:	84 c0                	test   %al,%al
+     e0b:	75 dc                	jne    de9 <strcpy+0x15>
+  return os;
+     e0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e11:	5d                   	pop    %rbp
+     e12:	c3                   	ret
+
+0000000000000e13 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     e13:	55                   	push   %rbp
+     e14:	48 89 e5             	mov    %rsp,%rbp
+     e17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     e1f:	eb 0a                	jmp    e2b <strcmp+0x18>
+    p++, q++;
+     e21:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e26:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     e2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e2f:	0f b6 00             	movzbl (%rax),%eax
+     e32:	84 c0                	test   %al,%al
+     e34:	74 12                	je     e48 <strcmp+0x35>
+     e36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e3a:	0f b6 10             	movzbl (%rax),%edx
+     e3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e41:	0f b6 00             	movzbl (%rax),%eax
+     e44:	38 c2                	cmp    %al,%dl
+     e46:	74 d9                	je     e21 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     e48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e4c:	0f b6 00             	movzbl (%rax),%eax
+     e4f:	0f b6 d0             	movzbl %al,%edx
+     e52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e56:	0f b6 00             	movzbl (%rax),%eax
+     e59:	0f b6 c0             	movzbl %al,%eax
+     e5c:	29 c2                	sub    %eax,%edx
+     e5e:	89 d0                	mov    %edx,%eax
+}
+     e60:	5d                   	pop    %rbp
+     e61:	c3                   	ret
+
+0000000000000e62 <strlen>:
+uint strlen(char *s) {
+     e62:	55                   	push   %rbp
+     e63:	48 89 e5             	mov    %rsp,%rbp
+     e66:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     e6a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e71:	eb 04                	jmp    e77 <strlen+0x15>
+     e73:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     e77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e7a:	48 63 d0             	movslq %eax,%rdx
+     e7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e81:	48 01 d0             	add    %rdx,%rax
+     e84:	0f b6 00             	movzbl (%rax),%eax
+     e87:	84 c0                	test   %al,%al
+     e89:	75 e8                	jne    e73 <strlen+0x11>
+    ;
+  return n;
+     e8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e8e:	5d                   	pop    %rbp
+     e8f:	c3                   	ret
+
+0000000000000e90 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     e90:	55                   	push   %rbp
+     e91:	48 89 e5             	mov    %rsp,%rbp
+     e94:	53                   	push   %rbx
+     e95:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     e99:	8b 05 95 21 00 00    	mov    0x2195(%rip),%eax        # 3034 <erms>
+     e9f:	85 c0                	test   %eax,%eax
+     ea1:	79 53                	jns    ef6 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     ea3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     ea7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     ead:	b9 00 00 00 00       	mov    $0x0,%ecx
+     eb2:	ba 00 00 00 00       	mov    $0x0,%edx
+     eb7:	48 89 c6             	mov    %rax,%rsi
+     eba:	bf 00 00 00 00       	mov    $0x0,%edi
+     ebf:	e8 9e fe ff ff       	call   d62 <cpuid>
+    ebx = 0;
+     ec4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     ecb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     ece:	83 f8 06             	cmp    $0x6,%eax
+     ed1:	76 14                	jbe    ee7 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     ed3:	b8 07 00 00 00       	mov    $0x7,%eax
+     ed8:	b9 00 00 00 00       	mov    $0x0,%ecx
+     edd:	0f a2                	cpuid
+     edf:	89 d9                	mov    %ebx,%ecx
+     ee1:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     ee4:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     ee7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     eea:	c1 e8 09             	shr    $0x9,%eax
+     eed:	83 e0 01             	and    $0x1,%eax
+     ef0:	89 05 3e 21 00 00    	mov    %eax,0x213e(%rip)        # 3034 <erms>
+  }
+  return erms;
+     ef6:	8b 05 38 21 00 00    	mov    0x2138(%rip),%eax        # 3034 <erms>
+}
+     efc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     f00:	c9                   	leave
+     f01:	c3                   	ret
+
+0000000000000f02 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     f02:	55                   	push   %rbp
+     f03:	48 89 e5             	mov    %rsp,%rbp
+     f06:	48 83 ec 10          	sub    $0x10,%rsp
+     f0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f0e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     f11:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     f14:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     f18:	76 09                	jbe    f23 <memset+0x21>
+     f1a:	e8 71 ff ff ff       	call   e90 <haserms>
+     f1f:	85 c0                	test   %eax,%eax
+     f21:	74 16                	je     f39 <memset+0x37>
+    stosb(dst, c, n);
+     f23:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f26:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     f29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f2d:	89 ce                	mov    %ecx,%esi
+     f2f:	48 89 c7             	mov    %rax,%rdi
+     f32:	e8 26 fd ff ff       	call   c5d <stosb>
+     f37:	eb 58                	jmp    f91 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     f39:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f3c:	c1 e8 03             	shr    $0x3,%eax
+     f3f:	89 c6                	mov    %eax,%esi
+     f41:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f44:	48 98                	cltq
+     f46:	0f b6 c0             	movzbl %al,%eax
+     f49:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     f50:	01 01 01 
+     f53:	48 0f af c2          	imul   %rdx,%rax
+     f57:	48 89 c1             	mov    %rax,%rcx
+     f5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f5e:	48 89 f2             	mov    %rsi,%rdx
+     f61:	48 89 ce             	mov    %rcx,%rsi
+     f64:	48 89 c7             	mov    %rax,%rdi
+     f67:	e8 23 fd ff ff       	call   c8f <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     f6c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f6f:	83 e0 07             	and    $0x7,%eax
+     f72:	89 c2                	mov    %eax,%edx
+     f74:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f77:	83 e0 f8             	and    $0xfffffff8,%eax
+     f7a:	48 89 c1             	mov    %rax,%rcx
+     f7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f81:	48 01 c1             	add    %rax,%rcx
+     f84:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f87:	89 c6                	mov    %eax,%esi
+     f89:	48 89 cf             	mov    %rcx,%rdi
+     f8c:	e8 cc fc ff ff       	call   c5d <stosb>
+  }
+  return dst;
+     f91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     f95:	c9                   	leave
+     f96:	c3                   	ret
+
+0000000000000f97 <strchr>:
+
+char *strchr(const char *s, char c) {
+     f97:	55                   	push   %rbp
+     f98:	48 89 e5             	mov    %rsp,%rbp
+     f9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f9f:	89 f0                	mov    %esi,%eax
+     fa1:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     fa4:	eb 17                	jmp    fbd <strchr+0x26>
+    if (*s == c)
+     fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     faa:	0f b6 00             	movzbl (%rax),%eax
+     fad:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     fb0:	75 06                	jne    fb8 <strchr+0x21>
+      return (char *)s;
+     fb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fb6:	eb 15                	jmp    fcd <strchr+0x36>
+  for (; *s; s++)
+     fb8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     fbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fc1:	0f b6 00             	movzbl (%rax),%eax
+     fc4:	84 c0                	test   %al,%al
+     fc6:	75 de                	jne    fa6 <strchr+0xf>
+  return 0;
+     fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     fcd:	5d                   	pop    %rbp
+     fce:	c3                   	ret
+
+0000000000000fcf <gets>:
+
+char *gets(char *buf, int max) {
+     fcf:	55                   	push   %rbp
+     fd0:	48 89 e5             	mov    %rsp,%rbp
+     fd3:	48 83 ec 20          	sub    $0x20,%rsp
+     fd7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     fdb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     fde:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     fe5:	eb 48                	jmp    102f <gets+0x60>
+    cc = read(0, &c, 1);
+     fe7:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     feb:	ba 01 00 00 00       	mov    $0x1,%edx
+     ff0:	48 89 c6             	mov    %rax,%rsi
+     ff3:	bf 00 00 00 00       	mov    $0x0,%edi
+     ff8:	e8 b8 05 00 00       	call   15b5 <read>
+     ffd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1000:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1004:	7e 36                	jle    103c <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1006:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1009:	8d 50 01             	lea    0x1(%rax),%edx
+    100c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    100f:	48 63 d0             	movslq %eax,%rdx
+    1012:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1016:	48 01 c2             	add    %rax,%rdx
+    1019:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    101d:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    101f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1023:	3c 0a                	cmp    $0xa,%al
+    1025:	74 16                	je     103d <gets+0x6e>
+    1027:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    102b:	3c 0d                	cmp    $0xd,%al
+    102d:	74 0e                	je     103d <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    102f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1032:	83 c0 01             	add    $0x1,%eax
+    1035:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1038:	7f ad                	jg     fe7 <gets+0x18>
+    103a:	eb 01                	jmp    103d <gets+0x6e>
+      break;
+    103c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    103d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1040:	48 63 d0             	movslq %eax,%rdx
+    1043:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1047:	48 01 d0             	add    %rdx,%rax
+    104a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    104d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1051:	c9                   	leave
+    1052:	c3                   	ret
+
+0000000000001053 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1053:	55                   	push   %rbp
+    1054:	48 89 e5             	mov    %rsp,%rbp
+    1057:	48 83 ec 10          	sub    $0x10,%rsp
+    105b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    105f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    1063:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1067:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    106b:	48 89 c6             	mov    %rax,%rsi
+    106e:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1073:	e8 58 07 00 00       	call   17d0 <fstatat>
+}
+    1078:	c9                   	leave
+    1079:	c3                   	ret
+
+000000000000107a <atoi>:
+
+int atoi(const char *s) {
+    107a:	55                   	push   %rbp
+    107b:	48 89 e5             	mov    %rsp,%rbp
+    107e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1082:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1089:	eb 28                	jmp    10b3 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    108b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    108e:	89 d0                	mov    %edx,%eax
+    1090:	c1 e0 02             	shl    $0x2,%eax
+    1093:	01 d0                	add    %edx,%eax
+    1095:	01 c0                	add    %eax,%eax
+    1097:	89 c1                	mov    %eax,%ecx
+    1099:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    109d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    10a1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    10a5:	0f b6 00             	movzbl (%rax),%eax
+    10a8:	0f be c0             	movsbl %al,%eax
+    10ab:	01 c8                	add    %ecx,%eax
+    10ad:	83 e8 30             	sub    $0x30,%eax
+    10b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    10b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10b7:	0f b6 00             	movzbl (%rax),%eax
+    10ba:	3c 2f                	cmp    $0x2f,%al
+    10bc:	7e 0b                	jle    10c9 <atoi+0x4f>
+    10be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10c2:	0f b6 00             	movzbl (%rax),%eax
+    10c5:	3c 39                	cmp    $0x39,%al
+    10c7:	7e c2                	jle    108b <atoi+0x11>
+  return n;
+    10c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    10cc:	5d                   	pop    %rbp
+    10cd:	c3                   	ret
+
+00000000000010ce <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    10ce:	55                   	push   %rbp
+    10cf:	48 89 e5             	mov    %rsp,%rbp
+    10d2:	48 83 ec 28          	sub    $0x28,%rsp
+    10d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    10da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    10de:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    10e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    10e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    10f1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    10f5:	7f 09                	jg     1100 <memmove+0x32>
+    return vdst;
+    10f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10fb:	e9 29 01 00 00       	jmp    1229 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1100:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1104:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1108:	0f 83 87 00 00 00    	jae    1195 <memmove+0xc7>
+    110e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1111:	48 63 d0             	movslq %eax,%rdx
+    1114:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1118:	48 01 d0             	add    %rdx,%rax
+    111b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    111f:	73 74                	jae    1195 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1121:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1124:	48 98                	cltq
+    1126:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    112a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    112d:	48 98                	cltq
+    112f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1133:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1137:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    113b:	48 09 d0             	or     %rdx,%rax
+    113e:	83 e0 07             	and    $0x7,%eax
+    1141:	48 85 c0             	test   %rax,%rax
+    1144:	75 3d                	jne    1183 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1146:	eb 1c                	jmp    1164 <memmove+0x96>
+        src -= 8;
+    1148:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    114d:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1152:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1156:	48 8b 10             	mov    (%rax),%rdx
+    1159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    115d:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1160:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1164:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1168:	7f de                	jg     1148 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    116a:	eb 17                	jmp    1183 <memmove+0xb5>
+      *--dst = *--src;
+    116c:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1171:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1176:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    117a:	0f b6 10             	movzbl (%rax),%edx
+    117d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1181:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1183:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1186:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1189:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    118c:	85 c0                	test   %eax,%eax
+    118e:	7f dc                	jg     116c <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1190:	e9 90 00 00 00       	jmp    1225 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1195:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1199:	7e 09                	jle    11a4 <memmove+0xd6>
+    119b:	e8 f0 fc ff ff       	call   e90 <haserms>
+    11a0:	85 c0                	test   %eax,%eax
+    11a2:	74 1b                	je     11bf <memmove+0xf1>
+    movsb(dst, src, n);
+    11a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11a7:	48 63 d0             	movslq %eax,%rdx
+    11aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    11ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b2:	48 89 ce             	mov    %rcx,%rsi
+    11b5:	48 89 c7             	mov    %rax,%rdi
+    11b8:	e8 0c fb ff ff       	call   cc9 <movsb>
+    11bd:	eb 66                	jmp    1225 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    11bf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11c2:	8d 50 07             	lea    0x7(%rax),%edx
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	0f 48 c2             	cmovs  %edx,%eax
+    11ca:	c1 f8 03             	sar    $0x3,%eax
+    11cd:	48 63 d0             	movslq %eax,%rdx
+    11d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    11d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11d8:	48 89 ce             	mov    %rcx,%rsi
+    11db:	48 89 c7             	mov    %rax,%rdi
+    11de:	e8 23 fb ff ff       	call   d06 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    11e3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    11e6:	89 d0                	mov    %edx,%eax
+    11e8:	c1 f8 1f             	sar    $0x1f,%eax
+    11eb:	c1 e8 1d             	shr    $0x1d,%eax
+    11ee:	01 c2                	add    %eax,%edx
+    11f0:	83 e2 07             	and    $0x7,%edx
+    11f3:	29 c2                	sub    %eax,%edx
+    11f5:	89 d0                	mov    %edx,%eax
+    11f7:	48 98                	cltq
+    11f9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    11fc:	83 e2 f8             	and    $0xfffffff8,%edx
+    11ff:	48 63 ca             	movslq %edx,%rcx
+    1202:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1206:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    120a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    120d:	83 e2 f8             	and    $0xfffffff8,%edx
+    1210:	48 63 ca             	movslq %edx,%rcx
+    1213:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1217:	48 01 d1             	add    %rdx,%rcx
+    121a:	48 89 c2             	mov    %rax,%rdx
+    121d:	48 89 cf             	mov    %rcx,%rdi
+    1220:	e8 a4 fa ff ff       	call   cc9 <movsb>
+  }
+  return vdst;
+    1225:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1229:	c9                   	leave
+    122a:	c3                   	ret
+
+000000000000122b <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    122b:	55                   	push   %rbp
+    122c:	48 89 e5             	mov    %rsp,%rbp
+    122f:	48 83 ec 20          	sub    $0x20,%rsp
+    1233:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1236:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    123a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1241:	00 00 00 
+    1244:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1248:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    124c:	75 0d                	jne    125b <clock_gettime+0x30>
+    124e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1252:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1256:	48 85 c0             	test   %rax,%rax
+    1259:	75 13                	jne    126e <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    125b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    125f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1262:	48 89 d6             	mov    %rdx,%rsi
+    1265:	89 c7                	mov    %eax,%edi
+    1267:	e8 e0 04 00 00       	call   174c <_clock_gettime>
+    126c:	eb 7d                	jmp    12eb <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    126e:	e8 d1 fa ff ff       	call   d44 <rdtsc>
+    1273:	48 89 c2             	mov    %rax,%rdx
+    1276:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127a:	48 89 d6             	mov    %rdx,%rsi
+    127d:	48 89 c7             	mov    %rax,%rdi
+    1280:	e8 7b f9 ff ff       	call   c00 <clockns>
+    1285:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1289:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    128d:	48 c1 e8 09          	shr    $0x9,%rax
+    1291:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1298:	b8 44 00 
+    129b:	48 f7 e2             	mul    %rdx
+    129e:	48 89 d0             	mov    %rdx,%rax
+    12a1:	48 c1 e8 0b          	shr    $0xb,%rax
+    12a5:	48 89 c2             	mov    %rax,%rdx
+    12a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12ac:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    12af:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    12b3:	48 89 c8             	mov    %rcx,%rax
+    12b6:	48 c1 e8 09          	shr    $0x9,%rax
+    12ba:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    12c1:	b8 44 00 
+    12c4:	48 f7 e2             	mul    %rdx
+    12c7:	48 89 d0             	mov    %rdx,%rax
+    12ca:	48 c1 e8 0b          	shr    $0xb,%rax
+    12ce:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    12d5:	48 89 c8             	mov    %rcx,%rax
+    12d8:	48 29 d0             	sub    %rdx,%rax
+    12db:	48 89 c2             	mov    %rax,%rdx
+    12de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12e2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    12e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12eb:	c9                   	leave
+    12ec:	c3                   	ret
+
+00000000000012ed <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    12ed:	55                   	push   %rbp
+    12ee:	48 89 e5             	mov    %rsp,%rbp
+    12f1:	48 83 ec 10          	sub    $0x10,%rsp
+    12f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    12f9:	eb 11                	jmp    130c <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    12fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12ff:	be 02 00 00 00       	mov    $0x2,%esi
+    1304:	48 89 c7             	mov    %rax,%rdi
+    1307:	e8 6c 04 00 00       	call   1778 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    130c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1310:	b8 02 00 00 00       	mov    $0x2,%eax
+    1315:	87 02                	xchg   %eax,(%rdx)
+    1317:	85 c0                	test   %eax,%eax
+    1319:	75 e0                	jne    12fb <mutex_wait+0xe>
+}
+    131b:	90                   	nop
+    131c:	90                   	nop
+    131d:	c9                   	leave
+    131e:	c3                   	ret
+
+000000000000131f <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    131f:	55                   	push   %rbp
+    1320:	48 89 e5             	mov    %rsp,%rbp
+    1323:	48 83 ec 20          	sub    $0x20,%rsp
+    1327:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    132b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1332:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1336:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    133a:	8b 02                	mov    (%rdx),%eax
+    133c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1341:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1345:	89 c1                	mov    %eax,%ecx
+    1347:	0f 94 c0             	sete   %al
+    134a:	84 c0                	test   %al,%al
+    134c:	75 02                	jne    1350 <mutex_lock+0x31>
+    134e:	89 0a                	mov    %ecx,(%rdx)
+    1350:	83 f0 01             	xor    $0x1,%eax
+    1353:	84 c0                	test   %al,%al
+    1355:	74 0c                	je     1363 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1357:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    135b:	48 89 c7             	mov    %rax,%rdi
+    135e:	e8 8a ff ff ff       	call   12ed <mutex_wait>
+}
+    1363:	90                   	nop
+    1364:	c9                   	leave
+    1365:	c3                   	ret
+
+0000000000001366 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1366:	55                   	push   %rbp
+    1367:	48 89 e5             	mov    %rsp,%rbp
+    136a:	48 83 ec 10          	sub    $0x10,%rsp
+    136e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1372:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1376:	ba 00 00 00 00       	mov    $0x0,%edx
+    137b:	87 10                	xchg   %edx,(%rax)
+    137d:	83 fa 02             	cmp    $0x2,%edx
+    1380:	75 11                	jne    1393 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1382:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1386:	be 01 00 00 00       	mov    $0x1,%esi
+    138b:	48 89 c7             	mov    %rax,%rdi
+    138e:	e8 f0 03 00 00       	call   1783 <futex_wake>
+}
+    1393:	90                   	nop
+    1394:	c9                   	leave
+    1395:	c3                   	ret
+
+0000000000001396 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1396:	55                   	push   %rbp
+    1397:	48 89 e5             	mov    %rsp,%rbp
+    139a:	48 83 ec 20          	sub    $0x20,%rsp
+    139e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    13a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13aa:	48 83 c0 04          	add    $0x4,%rax
+    13ae:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    13b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13b6:	8b 00                	mov    (%rax),%eax
+    13b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    13bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    13bf:	48 89 c7             	mov    %rax,%rdi
+    13c2:	e8 9f ff ff ff       	call   1366 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    13c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13cb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    13ce:	89 d6                	mov    %edx,%esi
+    13d0:	48 89 c7             	mov    %rax,%rdi
+    13d3:	e8 a0 03 00 00       	call   1778 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    13d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13dc:	48 83 c0 04          	add    $0x4,%rax
+    13e0:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    13e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    13e8:	48 89 c7             	mov    %rax,%rdi
+    13eb:	e8 fd fe ff ff       	call   12ed <mutex_wait>
+}
+    13f0:	90                   	nop
+    13f1:	c9                   	leave
+    13f2:	c3                   	ret
+
+00000000000013f3 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    13f3:	55                   	push   %rbp
+    13f4:	48 89 e5             	mov    %rsp,%rbp
+    13f7:	48 83 ec 10          	sub    $0x10,%rsp
+    13fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    13ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1403:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    140b:	48 83 c0 04          	add    $0x4,%rax
+    140f:	8b 00                	mov    (%rax),%eax
+    1411:	85 c0                	test   %eax,%eax
+    1413:	7e 11                	jle    1426 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1415:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1419:	be 01 00 00 00       	mov    $0x1,%esi
+    141e:	48 89 c7             	mov    %rax,%rdi
+    1421:	e8 5d 03 00 00       	call   1783 <futex_wake>
+}
+    1426:	90                   	nop
+    1427:	c9                   	leave
+    1428:	c3                   	ret
+
+0000000000001429 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1429:	55                   	push   %rbp
+    142a:	48 89 e5             	mov    %rsp,%rbp
+    142d:	48 83 ec 10          	sub    $0x10,%rsp
+    1431:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1439:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    143d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1441:	48 83 c0 04          	add    $0x4,%rax
+    1445:	8b 00                	mov    (%rax),%eax
+    1447:	85 c0                	test   %eax,%eax
+    1449:	7e 11                	jle    145c <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    144b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    144f:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1454:	48 89 c7             	mov    %rax,%rdi
+    1457:	e8 27 03 00 00       	call   1783 <futex_wake>
+}
+    145c:	90                   	nop
+    145d:	c9                   	leave
+    145e:	c3                   	ret
+
+000000000000145f <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    145f:	55                   	push   %rbp
+    1460:	48 89 e5             	mov    %rsp,%rbp
+    1463:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1467:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    146a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    146e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1472:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1476:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    147a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    147e:	8b 40 04             	mov    0x4(%rax),%eax
+    1481:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1484:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1488:	8b 00                	mov    (%rax),%eax
+    148a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    148d:	29 c2                	sub    %eax,%edx
+    148f:	83 fa 1f             	cmp    $0x1f,%edx
+    1492:	76 07                	jbe    149b <ring_push+0x3c>
+    return -1;
+    1494:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1499:	eb 7e                	jmp    1519 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    149b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    149e:	83 e0 1f             	and    $0x1f,%eax
+    14a1:	89 c2                	mov    %eax,%edx
+    14a3:	48 89 d0             	mov    %rdx,%rax
+    14a6:	48 01 c0             	add    %rax,%rax
+    14a9:	48 01 d0             	add    %rdx,%rax
+    14ac:	48 c1 e0 04          	shl    $0x4,%rax
+    14b0:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    14b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14b8:	48 01 d0             	add    %rdx,%rax
+    14bb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    14bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14c3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    14c6:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    14c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    14d0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    14d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14d8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    14dc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    14e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14e4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    14e8:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    14ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    14f4:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    14f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14fc:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1500:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1504:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1507:	8d 50 01             	lea    0x1(%rax),%edx
+    150a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    150e:	48 83 c0 04          	add    $0x4,%rax
+    1512:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1514:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1519:	5d                   	pop    %rbp
+    151a:	c3                   	ret
+
+000000000000151b <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    151b:	55                   	push   %rbp
+    151c:	48 89 e5             	mov    %rsp,%rbp
+    151f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1523:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1527:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    152b:	8b 40 08             	mov    0x8(%rax),%eax
+    152e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1531:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1535:	48 83 c0 0c          	add    $0xc,%rax
+    1539:	8b 00                	mov    (%rax),%eax
+    153b:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    153e:	75 07                	jne    1547 <ring_pop+0x2c>
+    return -1;
+    1540:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1545:	eb 40                	jmp    1587 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1547:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    154a:	83 e0 1f             	and    $0x1f,%eax
+    154d:	89 c2                	mov    %eax,%edx
+    154f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1557:	89 d2                	mov    %edx,%edx
+    1559:	48 83 c2 61          	add    $0x61,%rdx
+    155d:	48 c1 e2 04          	shl    $0x4,%rdx
+    1561:	48 01 d0             	add    %rdx,%rax
+    1564:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1568:	48 8b 00             	mov    (%rax),%rax
+    156b:	48 89 01             	mov    %rax,(%rcx)
+    156e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1572:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1575:	8d 50 01             	lea    0x1(%rax),%edx
+    1578:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    157c:	48 83 c0 08          	add    $0x8,%rax
+    1580:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1582:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1587:	5d                   	pop    %rbp
+    1588:	c3                   	ret
+
+0000000000001589 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1589:	b8 01 00 00 00       	mov    $0x1,%eax
+    158e:	49 89 ca             	mov    %rcx,%r10
+    1591:	0f 05                	syscall
+    1593:	c3                   	ret
+
+0000000000001594 <_exit>:
+SYSCALL_(exit)
+    1594:	b8 02 00 00 00       	mov    $0x2,%eax
+    1599:	49 89 ca             	mov    %rcx,%r10
+    159c:	0f 05                	syscall
+    159e:	c3                   	ret
+
+000000000000159f <wait>:
+SYSCALL(wait)
+    159f:	b8 03 00 00 00       	mov    $0x3,%eax
+    15a4:	49 89 ca             	mov    %rcx,%r10
+    15a7:	0f 05                	syscall
+    15a9:	c3                   	ret
+
+00000000000015aa <pipe>:
+SYSCALL(pipe)
+    15aa:	b8 04 00 00 00       	mov    $0x4,%eax
+    15af:	49 89 ca             	mov    %rcx,%r10
+    15b2:	0f 05                	syscall
+    15b4:	c3                   	ret
+
+00000000000015b5 <read>:
+SYSCALL(read)
+    15b5:	b8 05 00 00 00       	mov    $0x5,%eax
+    15ba:	49 89 ca             	mov    %rcx,%r10
+    15bd:	0f 05                	syscall
+    15bf:	c3                   	ret
+
+00000000000015c0 <write>:
+SYSCALL(write)
+    15c0:	b8 10 00 00 00       	mov    $0x10,%eax
+    15c5:	49 89 ca             	mov    %rcx,%r10
+    15c8:	0f 05                	syscall
+    15ca:	c3                   	ret
+
+00000000000015cb <_close>:
+SYSCALL_(close)
+    15cb:	b8 15 00 00 00       	mov    $0x15,%eax
+    15d0:	49 89 ca             	mov    %rcx,%r10
+    15d3:	0f 05                	syscall
+    15d5:	c3                   	ret
+
+00000000000015d6 <kill>:
+SYSCALL(kill)
+    15d6:	b8 06 00 00 00       	mov    $0x6,%eax
+    15db:	49 89 ca             	mov    %rcx,%r10
+    15de:	0f 05                	syscall
+    15e0:	c3                   	ret
+
+00000000000015e1 <_exec>:
+SYSCALL_(exec)
+    15e1:	b8 07 00 00 00       	mov    $0x7,%eax
+    15e6:	49 89 ca             	mov    %rcx,%r10
+    15e9:	0f 05                	syscall
+    15eb:	c3                   	ret
+
+00000000000015ec <open>:
+SYSCALL(open)
+    15ec:	b8 0f 00 00 00       	mov    $0xf,%eax
+    15f1:	49 89 ca             	mov    %rcx,%r10
+    15f4:	0f 05                	syscall
+    15f6:	c3                   	ret
+
+00000000000015f7 <mknod>:
+SYSCALL(mknod)
+    15f7:	b8 11 00 00 00       	mov    $0x11,%eax
+    15fc:	49 89 ca             	mov    %rcx,%r10
+    15ff:	0f 05                	syscall
+    1601:	c3                   	ret
+
+0000000000001602 <unlink>:
+SYSCALL(unlink)
+    1602:	b8 12 00 00 00       	mov    $0x12,%eax
+    1607:	49 89 ca             	mov    %rcx,%r10
+    160a:	0f 05                	syscall
+    160c:	c3                   	ret
+
+000000000000160d <fstat>:
+SYSCALL(fstat)
+    160d:	b8 08 00 00 00       	mov    $0x8,%eax
+    1612:	49 89 ca             	mov    %rcx,%r10
+    1615:	0f 05                	syscall
+    1617:	c3                   	ret
+
+0000000000001618 <link>:
+SYSCALL(link)
+    1618:	b8 13 00 00 00       	mov    $0x13,%eax
+    161d:	49 89 ca             	mov    %rcx,%r10
+    1620:	0f 05                	syscall
+    1622:	c3                   	ret
+
+0000000000001623 <mkdir>:
+SYSCALL(mkdir)
+    1623:	b8 14 00 00 00       	mov    $0x14,%eax
+    1628:	49 89 ca             	mov    %rcx,%r10
+    162b:	0f 05                	syscall
+    162d:	c3                   	ret
+
+000000000000162e <chdir>:
+SYSCALL(chdir)
+    162e:	b8 09 00 00 00       	mov    $0x9,%eax
+    1633:	49 89 ca             	mov    %rcx,%r10
+    1636:	0f 05                	syscall
+    1638:	c3                   	ret
+
+0000000000001639 <dup>:
+SYSCALL(dup)
+    1639:	b8 0a 00 00 00       	mov    $0xa,%eax
+    163e:	49 89 ca             	mov    %rcx,%r10
+    1641:	0f 05                	syscall
+    1643:	c3                   	ret
+
+0000000000001644 <getpid>:
+SYSCALL(getpid)
+    1644:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1649:	49 89 ca             	mov    %rcx,%r10
+    164c:	0f 05                	syscall
+    164e:	c3                   	ret
+
+000000000000164f <sbrk>:
+SYSCALL(sbrk)
+    164f:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1654:	49 89 ca             	mov    %rcx,%r10
+    1657:	0f 05                	syscall
+    1659:	c3                   	ret
+
+000000000000165a <sleep>:
+SYSCALL(sleep)
+    165a:	b8 0d 00 00 00       	mov    $0xd,%eax
+    165f:	49 89 ca             	mov    %rcx,%r10
+    1662:	0f 05                	syscall
+    1664:	c3                   	ret
+
+0000000000001665 <uptime>:
+SYSCALL(uptime)
+    1665:	b8 0e 00 00 00       	mov    $0xe,%eax
+    166a:	49 89 ca             	mov    %rcx,%r10
+    166d:	0f 05                	syscall
+    166f:	c3                   	ret
+
+0000000000001670 <sysinfo>:
+SYSCALL(sysinfo)
+    1670:	b8 16 00 00 00       	mov    $0x16,%eax
+    1675:	49 89 ca             	mov    %rcx,%r10
+    1678:	0f 05                	syscall
+    167a:	c3                   	ret
+
+000000000000167b <crashn>:
+SYSCALL(crashn)
+    167b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1680:	49 89 ca             	mov    %rcx,%r10
+    1683:	0f 05                	syscall
+    1685:	c3                   	ret
+
+0000000000001686 <mmap>:
+SYSCALL(mmap)
+    1686:	b8 18 00 00 00       	mov    $0x18,%eax
+    168b:	49 89 ca             	mov    %rcx,%r10
+    168e:	0f 05                	syscall
+    1690:	c3                   	ret
+
+0000000000001691 <munmap>:
+SYSCALL(munmap)
+    1691:	b8 19 00 00 00       	mov    $0x19,%eax
+    1696:	49 89 ca             	mov    %rcx,%r10
+    1699:	0f 05                	syscall
+    169b:	c3                   	ret
+
+000000000000169c <nice>:
+SYSCALL(nice)
+    169c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16a1:	49 89 ca             	mov    %rcx,%r10
+    16a4:	0f 05                	syscall
+    16a6:	c3                   	ret
+
+00000000000016a7 <_spawn>:
+SYSCALL_(spawn)
+    16a7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16ac:	49 89 ca             	mov    %rcx,%r10
+    16af:	0f 05                	syscall
+    16b1:	c3                   	ret
+
+00000000000016b2 <pread>:
+SYSCALL(pread)
+    16b2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16b7:	49 89 ca             	mov    %rcx,%r10
+    16ba:	0f 05                	syscall
+    16bc:	c3                   	ret
+
+00000000000016bd <pwrite>:
+SYSCALL(pwrite)
+    16bd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16c2:	49 89 ca             	mov    %rcx,%r10
+    16c5:	0f 05                	syscall
+    16c7:	c3                   	ret
+
+00000000000016c8 <readv>:
+SYSCALL(readv)
+    16c8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    16cd:	49 89 ca             	mov    %rcx,%r10
+    16d0:	0f 05                	syscall
+    16d2:	c3                   	ret
+
+00000000000016d3 <writev>:
+SYSCALL(writev)
+    16d3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    16d8:	49 89 ca             	mov    %rcx,%r10
+    16db:	0f 05                	syscall
+    16dd:	c3                   	ret
+
+00000000000016de <sendfile>:
+SYSCALL(sendfile)
+    16de:	b8 20 00 00 00       	mov    $0x20,%eax
+    16e3:	49 89 ca             	mov    %rcx,%r10
+    16e6:	0f 05                	syscall
+    16e8:	c3                   	ret
+
+00000000000016e9 <splice>:
+SYSCALL(splice)
+    16e9:	b8 21 00 00 00       	mov    $0x21,%eax
+    16ee:	49 89 ca             	mov    %rcx,%r10
+    16f1:	0f 05                	syscall
+    16f3:	c3                   	ret
+
+00000000000016f4 <poll>:
+SYSCALL(poll)
+    16f4:	b8 22 00 00 00       	mov    $0x22,%eax
+    16f9:	49 89 ca             	mov    %rcx,%r10
+    16fc:	0f 05                	syscall
+    16fe:	c3                   	ret
+
+00000000000016ff <fsync>:
+SYSCALL(fsync)
+    16ff:	b8 23 00 00 00       	mov    $0x23,%eax
+    1704:	49 89 ca             	mov    %rcx,%r10
+    1707:	0f 05                	syscall
+    1709:	c3                   	ret
+
+000000000000170a <fdatasync>:
+SYSCALL(fdatasync)
+    170a:	b8 24 00 00 00       	mov    $0x24,%eax
+    170f:	49 89 ca             	mov    %rcx,%r10
+    1712:	0f 05                	syscall
+    1714:	c3                   	ret
+
+0000000000001715 <lockstat>:
+SYSCALL(lockstat)
+    1715:	b8 25 00 00 00       	mov    $0x25,%eax
+    171a:	49 89 ca             	mov    %rcx,%r10
+    171d:	0f 05                	syscall
+    171f:	c3                   	ret
+
+0000000000001720 <syscallstat>:
+SYSCALL(syscallstat)
+    1720:	b8 26 00 00 00       	mov    $0x26,%eax
+    1725:	49 89 ca             	mov    %rcx,%r10
+    1728:	0f 05                	syscall
+    172a:	c3                   	ret
+
+000000000000172b <trace>:
+SYSCALL(trace)
+    172b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1730:	49 89 ca             	mov    %rcx,%r10
+    1733:	0f 05                	syscall
+    1735:	c3                   	ret
+
+0000000000001736 <profile>:
+SYSCALL(profile)
+    1736:	b8 28 00 00 00       	mov    $0x28,%eax
+    173b:	49 89 ca             	mov    %rcx,%r10
+    173e:	0f 05                	syscall
+    1740:	c3                   	ret
+
+0000000000001741 <cycles>:
+SYSCALL(cycles)
+    1741:	b8 29 00 00 00       	mov    $0x29,%eax
+    1746:	49 89 ca             	mov    %rcx,%r10
+    1749:	0f 05                	syscall
+    174b:	c3                   	ret
+
+000000000000174c <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    174c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1751:	49 89 ca             	mov    %rcx,%r10
+    1754:	0f 05                	syscall
+    1756:	c3                   	ret
+
+0000000000001757 <consmode>:
+SYSCALL(consmode)
+    1757:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    175c:	49 89 ca             	mov    %rcx,%r10
+    175f:	0f 05                	syscall
+    1761:	c3                   	ret
+
+0000000000001762 <clone>:
+SYSCALL(clone)
+    1762:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1767:	49 89 ca             	mov    %rcx,%r10
+    176a:	0f 05                	syscall
+    176c:	c3                   	ret
+
+000000000000176d <join>:
+SYSCALL(join)
+    176d:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1772:	49 89 ca             	mov    %rcx,%r10
+    1775:	0f 05                	syscall
+    1777:	c3                   	ret
+
+0000000000001778 <futex_wait>:
+SYSCALL(futex_wait)
+    1778:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    177d:	49 89 ca             	mov    %rcx,%r10
+    1780:	0f 05                	syscall
+    1782:	c3                   	ret
+
+0000000000001783 <futex_wake>:
+SYSCALL(futex_wake)
+    1783:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1788:	49 89 ca             	mov    %rcx,%r10
+    178b:	0f 05                	syscall
+    178d:	c3                   	ret
+
+000000000000178e <shmget>:
+SYSCALL(shmget)
+    178e:	b8 30 00 00 00       	mov    $0x30,%eax
+    1793:	49 89 ca             	mov    %rcx,%r10
+    1796:	0f 05                	syscall
+    1798:	c3                   	ret
+
+0000000000001799 <shmat>:
+SYSCALL(shmat)
+    1799:	b8 31 00 00 00       	mov    $0x31,%eax
+    179e:	49 89 ca             	mov    %rcx,%r10
+    17a1:	0f 05                	syscall
+    17a3:	c3                   	ret
+
+00000000000017a4 <shmdt>:
+SYSCALL(shmdt)
+    17a4:	b8 32 00 00 00       	mov    $0x32,%eax
+    17a9:	49 89 ca             	mov    %rcx,%r10
+    17ac:	0f 05                	syscall
+    17ae:	c3                   	ret
+
+00000000000017af <ring_setup>:
+SYSCALL(ring_setup)
+    17af:	b8 33 00 00 00       	mov    $0x33,%eax
+    17b4:	49 89 ca             	mov    %rcx,%r10
+    17b7:	0f 05                	syscall
+    17b9:	c3                   	ret
+
+00000000000017ba <ring_enter>:
+SYSCALL(ring_enter)
+    17ba:	b8 34 00 00 00       	mov    $0x34,%eax
+    17bf:	49 89 ca             	mov    %rcx,%r10
+    17c2:	0f 05                	syscall
+    17c4:	c3                   	ret
+
+00000000000017c5 <getdents>:
+SYSCALL(getdents)
+    17c5:	b8 35 00 00 00       	mov    $0x35,%eax
+    17ca:	49 89 ca             	mov    %rcx,%r10
+    17cd:	0f 05                	syscall
+    17cf:	c3                   	ret
+
+00000000000017d0 <fstatat>:
+SYSCALL(fstatat)
+    17d0:	b8 36 00 00 00       	mov    $0x36,%eax
+    17d5:	49 89 ca             	mov    %rcx,%r10
+    17d8:	0f 05                	syscall
+    17da:	c3                   	ret
+
+00000000000017db <clone_file>:
+SYSCALL(clone_file)
+    17db:	b8 37 00 00 00       	mov    $0x37,%eax
+    17e0:	49 89 ca             	mov    %rcx,%r10
+    17e3:	0f 05                	syscall
+    17e5:	c3                   	ret
+
+00000000000017e6 <fpunch>:
+SYSCALL(fpunch)
+    17e6:	b8 38 00 00 00       	mov    $0x38,%eax
+    17eb:	49 89 ca             	mov    %rcx,%r10
+    17ee:	0f 05                	syscall
+    17f0:	c3                   	ret
+
+00000000000017f1 <defrag>:
+SYSCALL(defrag)
+    17f1:	b8 39 00 00 00       	mov    $0x39,%eax
+    17f6:	49 89 ca             	mov    %rcx,%r10
+    17f9:	0f 05                	syscall
+    17fb:	c3                   	ret
+
+00000000000017fc <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    17fc:	55                   	push   %rbp
+    17fd:	48 89 e5             	mov    %rsp,%rbp
+    1800:	48 83 ec 20          	sub    $0x20,%rsp
+    1804:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1808:	bf 00 00 00 00       	mov    $0x0,%edi
+    180d:	e8 3d fe ff ff       	call   164f <sbrk>
+    1812:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    181a:	48 f7 d8             	neg    %rax
+    181d:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1822:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1826:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    182a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    182e:	48 01 c2             	add    %rax,%rdx
+    1831:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1836:	48 39 c2             	cmp    %rax,%rdx
+    1839:	73 1e                	jae    1859 <morecore+0x5d>
+    183b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    183f:	89 c2                	mov    %eax,%edx
+    1841:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1845:	01 d0                	add    %edx,%eax
+    1847:	89 c7                	mov    %eax,%edi
+    1849:	e8 01 fe ff ff       	call   164f <sbrk>
+    184e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1852:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1857:	75 07                	jne    1860 <morecore+0x64>
+    return 0;
+    1859:	b8 00 00 00 00       	mov    $0x0,%eax
+    185e:	eb 27                	jmp    1887 <morecore+0x8b>
+  stats.heap += n + pad;
+    1860:	48 8b 05 09 19 00 00 	mov    0x1909(%rip),%rax        # 3170 <stats+0x50>
+    1867:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    186b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    186f:	48 01 ca             	add    %rcx,%rdx
+    1872:	48 01 d0             	add    %rdx,%rax
+    1875:	48 89 05 f4 18 00 00 	mov    %rax,0x18f4(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    187c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1880:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1884:	48 01 d0             	add    %rdx,%rax
+}
+    1887:	c9                   	leave
+    1888:	c3                   	ret
+
+0000000000001889 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1889:	55                   	push   %rbp
+    188a:	48 89 e5             	mov    %rsp,%rbp
+    188d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1891:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1895:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    189c:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    189d:	48 8d 05 5c 18 00 00 	lea    0x185c(%rip),%rax        # 3100 <runs>
+    18a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18a8:	eb 1a                	jmp    18c4 <pagefree+0x3b>
+    prev = *rp;
+    18aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ae:	48 8b 00             	mov    (%rax),%rax
+    18b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    18b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18b9:	48 8b 00             	mov    (%rax),%rax
+    18bc:	48 83 c0 08          	add    $0x8,%rax
+    18c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18c8:	48 8b 00             	mov    (%rax),%rax
+    18cb:	48 85 c0             	test   %rax,%rax
+    18ce:	74 0d                	je     18dd <pagefree+0x54>
+    18d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18d4:	48 8b 00             	mov    (%rax),%rax
+    18d7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    18db:	72 cd                	jb     18aa <pagefree+0x21>
+  r = (struct run *)p;
+    18dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18e1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    18e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    18ed:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    18f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f4:	48 8b 10             	mov    (%rax),%rdx
+    18f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18fb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    18ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1903:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1907:	48 85 c0             	test   %rax,%rax
+    190a:	74 48                	je     1954 <pagefree+0xcb>
+    190c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1910:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1914:	48 01 c2             	add    %rax,%rdx
+    1917:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    191b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    191f:	48 39 c2             	cmp    %rax,%rdx
+    1922:	75 30                	jne    1954 <pagefree+0xcb>
+    r->size += r->next->size;
+    1924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1928:	48 8b 10             	mov    (%rax),%rdx
+    192b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    192f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1933:	48 8b 00             	mov    (%rax),%rax
+    1936:	48 01 c2             	add    %rax,%rdx
+    1939:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    193d:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1940:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1944:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1948:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    194c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1950:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1954:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1959:	74 46                	je     19a1 <pagefree+0x118>
+    195b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195f:	48 8b 10             	mov    (%rax),%rdx
+    1962:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1966:	48 01 d0             	add    %rdx,%rax
+    1969:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    196d:	75 32                	jne    19a1 <pagefree+0x118>
+    prev->size += r->size;
+    196f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1973:	48 8b 10             	mov    (%rax),%rdx
+    1976:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197a:	48 8b 00             	mov    (%rax),%rax
+    197d:	48 01 c2             	add    %rax,%rdx
+    1980:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1984:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1987:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    198b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    198f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1993:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1997:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    199b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    199f:	eb 0c                	jmp    19ad <pagefree+0x124>
+  } else {
+    *rp = r;
+    19a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    19a9:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    19ac:	90                   	nop
+    19ad:	90                   	nop
+    19ae:	5d                   	pop    %rbp
+    19af:	c3                   	ret
+
+00000000000019b0 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    19b0:	55                   	push   %rbp
+    19b1:	48 89 e5             	mov    %rsp,%rbp
+    19b4:	48 83 ec 40          	sub    $0x40,%rsp
+    19b8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    19bc:	48 8d 05 3d 17 00 00 	lea    0x173d(%rip),%rax        # 3100 <runs>
+    19c3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    19c7:	eb 66                	jmp    1a2f <pagealloc+0x7f>
+    if (r->size == n) {
+    19c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19cd:	48 8b 00             	mov    (%rax),%rax
+    19d0:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    19d4:	75 18                	jne    19ee <pagealloc+0x3e>
+      *rp = r->next;
+    19d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19da:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    19de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e2:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    19e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19e9:	e9 ca 00 00 00       	jmp    1ab8 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    19ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19f2:	48 8b 00             	mov    (%rax),%rax
+    19f5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    19f9:	73 28                	jae    1a23 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    19fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19ff:	48 8b 00             	mov    (%rax),%rax
+    1a02:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1a06:	48 89 c2             	mov    %rax,%rdx
+    1a09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a0d:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1a10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a14:	48 8b 10             	mov    (%rax),%rdx
+    1a17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a1b:	48 01 d0             	add    %rdx,%rax
+    1a1e:	e9 95 00 00 00       	jmp    1ab8 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1a23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a27:	48 83 c0 08          	add    $0x8,%rax
+    1a2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a33:	48 8b 00             	mov    (%rax),%rax
+    1a36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a3a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1a3f:	75 88                	jne    19c9 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1a41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1a45:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1a49:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1a50:	00 
+    1a51:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a59:	48 39 c2             	cmp    %rax,%rdx
+    1a5c:	48 0f 43 c2          	cmovae %rdx,%rax
+    1a60:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1a64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1a68:	48 89 c7             	mov    %rax,%rdi
+    1a6b:	e8 8c fd ff ff       	call   17fc <morecore>
+    1a70:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1a74:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1a79:	75 07                	jne    1a82 <pagealloc+0xd2>
+    return 0;
+    1a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a80:	eb 36                	jmp    1ab8 <pagealloc+0x108>
+  if (m > n)
+    1a82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1a86:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1a8a:	73 1a                	jae    1aa6 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1a8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1a90:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1a94:	48 89 c2             	mov    %rax,%rdx
+    1a97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1a9b:	48 89 d6             	mov    %rdx,%rsi
+    1a9e:	48 89 c7             	mov    %rax,%rdi
+    1aa1:	e8 e3 fd ff ff       	call   1889 <pagefree>
+  return p + m - n;
+    1aa6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1aaa:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1aae:	48 89 c2             	mov    %rax,%rdx
+    1ab1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1ab5:	48 01 d0             	add    %rdx,%rax
+}
+    1ab8:	c9                   	leave
+    1ab9:	c3                   	ret
+
+0000000000001aba <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1aba:	55                   	push   %rbp
+    1abb:	48 89 e5             	mov    %rsp,%rbp
+    1abe:	48 83 ec 30          	sub    $0x30,%rsp
+    1ac2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1ac5:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1aca:	e8 e1 fe ff ff       	call   19b0 <pagealloc>
+    1acf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ad3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ad8:	75 0a                	jne    1ae4 <refill+0x2a>
+    return -1;
+    1ada:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1adf:	e9 da 00 00 00       	jmp    1bbe <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1ae4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1aeb:	00 
+    1aec:	e9 ba 00 00 00       	jmp    1bab <refill+0xf1>
+    b = (struct block *)(p + off);
+    1af1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1af5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1af9:	48 01 d0             	add    %rdx,%rax
+    1afc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1b00:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b03:	ba 20 00 00 00       	mov    $0x20,%edx
+    1b08:	89 c1                	mov    %eax,%ecx
+    1b0a:	48 d3 e2             	shl    %cl,%rdx
+    1b0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b11:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1b14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b17:	48 63 d0             	movslq %eax,%rdx
+    1b1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b1e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1b22:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b25:	48 98                	cltq
+    1b27:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b2e:	00 
+    1b2f:	48 8d 05 8a 15 00 00 	lea    0x158a(%rip),%rax        # 30c0 <freelist>
+    1b36:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b3e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1b42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b45:	48 98                	cltq
+    1b47:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b4e:	00 
+    1b4f:	48 8d 15 6a 15 00 00 	lea    0x156a(%rip),%rdx        # 30c0 <freelist>
+    1b56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b5a:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1b5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b61:	48 98                	cltq
+    1b63:	48 83 c0 08          	add    $0x8,%rax
+    1b67:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b6e:	00 
+    1b6f:	48 8d 05 ae 15 00 00 	lea    0x15ae(%rip),%rax        # 3124 <stats+0x4>
+    1b76:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b79:	8d 48 01             	lea    0x1(%rax),%ecx
+    1b7c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b7f:	48 98                	cltq
+    1b81:	48 83 c0 08          	add    $0x8,%rax
+    1b85:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b8c:	00 
+    1b8d:	48 8d 05 90 15 00 00 	lea    0x1590(%rip),%rax        # 3124 <stats+0x4>
+    1b94:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1b97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b9a:	ba 20 00 00 00       	mov    $0x20,%edx
+    1b9f:	89 c1                	mov    %eax,%ecx
+    1ba1:	48 d3 e2             	shl    %cl,%rdx
+    1ba4:	48 89 d0             	mov    %rdx,%rax
+    1ba7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1bab:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1bb2:	00 
+    1bb3:	0f 86 38 ff ff ff    	jbe    1af1 <refill+0x37>
+  }
+  return 0;
+    1bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1bbe:	c9                   	leave
+    1bbf:	c3                   	ret
+
+0000000000001bc0 <malloc>:
+
+void *malloc(uint nbytes) {
+    1bc0:	55                   	push   %rbp
+    1bc1:	48 89 e5             	mov    %rsp,%rbp
+    1bc4:	48 83 ec 30          	sub    $0x30,%rsp
+    1bc8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1bcb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bce:	48 83 c0 10          	add    $0x10,%rax
+    1bd2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1bd6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1bdd:	eb 04                	jmp    1be3 <malloc+0x23>
+    1bdf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1be3:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1be7:	7f 16                	jg     1bff <malloc+0x3f>
+    1be9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bec:	ba 20 00 00 00       	mov    $0x20,%edx
+    1bf1:	89 c1                	mov    %eax,%ecx
+    1bf3:	48 d3 e2             	shl    %cl,%rdx
+    1bf6:	48 89 d0             	mov    %rdx,%rax
+    1bf9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1bfd:	72 e0                	jb     1bdf <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1bff:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1c03:	75 7d                	jne    1c82 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1c05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c09:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1c0f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1c15:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1c19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c1d:	48 89 c7             	mov    %rax,%rdi
+    1c20:	e8 8b fd ff ff       	call   19b0 <pagealloc>
+    1c25:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1c29:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1c2e:	75 0a                	jne    1c3a <malloc+0x7a>
+      return 0;
+    1c30:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c35:	e9 2c 01 00 00       	jmp    1d66 <malloc+0x1a6>
+    h->size = n;
+    1c3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c3e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1c42:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1c45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c49:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1c50:	00 
+    stats.inuse[LARGE]++;
+    1c51:	8b 05 e9 14 00 00    	mov    0x14e9(%rip),%eax        # 3140 <stats+0x20>
+    1c57:	83 c0 01             	add    $0x1,%eax
+    1c5a:	89 05 e0 14 00 00    	mov    %eax,0x14e0(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    1c60:	48 8b 15 01 15 00 00 	mov    0x1501(%rip),%rdx        # 3168 <stats+0x48>
+    1c67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c6b:	48 01 d0             	add    %rdx,%rax
+    1c6e:	48 89 05 f3 14 00 00 	mov    %rax,0x14f3(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    1c75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c79:	48 83 c0 10          	add    $0x10,%rax
+    1c7d:	e9 e4 00 00 00       	jmp    1d66 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1c82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c85:	48 98                	cltq
+    1c87:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c8e:	00 
+    1c8f:	48 8d 05 2a 14 00 00 	lea    0x142a(%rip),%rax        # 30c0 <freelist>
+    1c96:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1c9a:	48 85 c0             	test   %rax,%rax
+    1c9d:	75 18                	jne    1cb7 <malloc+0xf7>
+    1c9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ca2:	89 c7                	mov    %eax,%edi
+    1ca4:	e8 11 fe ff ff       	call   1aba <refill>
+    1ca9:	85 c0                	test   %eax,%eax
+    1cab:	79 0a                	jns    1cb7 <malloc+0xf7>
+    return 0;
+    1cad:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cb2:	e9 af 00 00 00       	jmp    1d66 <malloc+0x1a6>
+  b = freelist[c];
+    1cb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cba:	48 98                	cltq
+    1cbc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cc3:	00 
+    1cc4:	48 8d 05 f5 13 00 00 	lea    0x13f5(%rip),%rax        # 30c0 <freelist>
+    1ccb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1ccf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1cd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cd7:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1cdb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1cde:	48 63 d2             	movslq %edx,%rdx
+    1ce1:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1ce8:	00 
+    1ce9:	48 8d 15 d0 13 00 00 	lea    0x13d0(%rip),%rdx        # 30c0 <freelist>
+    1cf0:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1cf4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cf7:	48 98                	cltq
+    1cf9:	48 83 c0 08          	add    $0x8,%rax
+    1cfd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d04:	00 
+    1d05:	48 8d 05 18 14 00 00 	lea    0x1418(%rip),%rax        # 3124 <stats+0x4>
+    1d0c:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d0f:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1d12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d15:	48 98                	cltq
+    1d17:	48 83 c0 08          	add    $0x8,%rax
+    1d1b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d22:	00 
+    1d23:	48 8d 05 fa 13 00 00 	lea    0x13fa(%rip),%rax        # 3124 <stats+0x4>
+    1d2a:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1d2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d30:	48 98                	cltq
+    1d32:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d39:	00 
+    1d3a:	48 8d 05 df 13 00 00 	lea    0x13df(%rip),%rax        # 3120 <stats>
+    1d41:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d44:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d4a:	48 98                	cltq
+    1d4c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d53:	00 
+    1d54:	48 8d 05 c5 13 00 00 	lea    0x13c5(%rip),%rax        # 3120 <stats>
+    1d5b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1d5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d62:	48 83 c0 10          	add    $0x10,%rax
+}
+    1d66:	c9                   	leave
+    1d67:	c3                   	ret
+
+0000000000001d68 <free>:
+
+void free(void *ap) {
+    1d68:	55                   	push   %rbp
+    1d69:	48 89 e5             	mov    %rsp,%rbp
+    1d6c:	48 83 ec 18          	sub    $0x18,%rsp
+    1d70:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1d74:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1d79:	0f 84 03 01 00 00    	je     1e82 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d83:	48 83 e8 10          	sub    $0x10,%rax
+    1d87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d8f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1d93:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1d97:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1d9c:	75 42                	jne    1de0 <free+0x78>
+    stats.inuse[LARGE]--;
+    1d9e:	8b 05 9c 13 00 00    	mov    0x139c(%rip),%eax        # 3140 <stats+0x20>
+    1da4:	83 e8 01             	sub    $0x1,%eax
+    1da7:	89 05 93 13 00 00    	mov    %eax,0x1393(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1dad:	48 8b 15 b4 13 00 00 	mov    0x13b4(%rip),%rdx        # 3168 <stats+0x48>
+    1db4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1db8:	48 8b 00             	mov    (%rax),%rax
+    1dbb:	48 29 c2             	sub    %rax,%rdx
+    1dbe:	48 89 15 a3 13 00 00 	mov    %rdx,0x13a3(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1dc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dc9:	48 8b 10             	mov    (%rax),%rdx
+    1dcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd0:	48 89 d6             	mov    %rdx,%rsi
+    1dd3:	48 89 c7             	mov    %rax,%rdi
+    1dd6:	e8 ae fa ff ff       	call   1889 <pagefree>
+    return;
+    1ddb:	e9 a3 00 00 00       	jmp    1e83 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1de0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1de4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1deb:	00 
+    1dec:	48 8d 05 cd 12 00 00 	lea    0x12cd(%rip),%rax        # 30c0 <freelist>
+    1df3:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1df7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dfb:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1dff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e03:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1e0a:	00 
+    1e0b:	48 8d 15 ae 12 00 00 	lea    0x12ae(%rip),%rdx        # 30c0 <freelist>
+    1e12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e16:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1e1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e1e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e25:	00 
+    1e26:	48 8d 05 f3 12 00 00 	lea    0x12f3(%rip),%rax        # 3120 <stats>
+    1e2d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e30:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1e33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e37:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e3e:	00 
+    1e3f:	48 8d 05 da 12 00 00 	lea    0x12da(%rip),%rax        # 3120 <stats>
+    1e46:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1e49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e4d:	48 83 c0 08          	add    $0x8,%rax
+    1e51:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e58:	00 
+    1e59:	48 8d 05 c4 12 00 00 	lea    0x12c4(%rip),%rax        # 3124 <stats+0x4>
+    1e60:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e63:	8d 48 01             	lea    0x1(%rax),%ecx
+    1e66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e6a:	48 83 c0 08          	add    $0x8,%rax
+    1e6e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e75:	00 
+    1e76:	48 8d 05 a7 12 00 00 	lea    0x12a7(%rip),%rax        # 3124 <stats+0x4>
+    1e7d:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1e80:	eb 01                	jmp    1e83 <free+0x11b>
+    return;
+    1e82:	90                   	nop
+}
+    1e83:	c9                   	leave
+    1e84:	c3                   	ret
+
+0000000000001e85 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1e85:	55                   	push   %rbp
+    1e86:	48 89 e5             	mov    %rsp,%rbp
+    1e89:	48 83 ec 30          	sub    $0x30,%rsp
+    1e8d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1e90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e93:	48 8d 15 b6 02 00 00 	lea    0x2b6(%rip),%rdx        # 2150 <benchreport+0x1a3>
+    1e9a:	48 89 d6             	mov    %rdx,%rsi
+    1e9d:	89 c7                	mov    %eax,%edi
+    1e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ea4:	e8 37 e6 ff ff       	call   4e0 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1ea9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1eb0:	eb 67                	jmp    1f19 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1eb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1eb5:	48 98                	cltq
+    1eb7:	48 83 c0 08          	add    $0x8,%rax
+    1ebb:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ec2:	00 
+    1ec3:	48 8d 05 5a 12 00 00 	lea    0x125a(%rip),%rax        # 3124 <stats+0x4>
+    1eca:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1ecd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ed0:	48 98                	cltq
+    1ed2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ed9:	00 
+    1eda:	48 8d 05 3f 12 00 00 	lea    0x123f(%rip),%rax        # 3120 <stats>
+    1ee1:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1ee4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ee7:	ba 20 00 00 00       	mov    $0x20,%edx
+    1eec:	89 c1                	mov    %eax,%ecx
+    1eee:	48 d3 e2             	shl    %cl,%rdx
+    1ef1:	48 89 d0             	mov    %rdx,%rax
+    1ef4:	89 c1                	mov    %eax,%ecx
+    1ef6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1ef9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1efc:	41 89 f9             	mov    %edi,%r9d
+    1eff:	41 89 f0             	mov    %esi,%r8d
+    1f02:	48 8d 35 5e 02 00 00 	lea    0x25e(%rip),%rsi        # 2167 <benchreport+0x1ba>
+    1f09:	89 c7                	mov    %eax,%edi
+    1f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f10:	e8 cb e5 ff ff       	call   4e0 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1f15:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1f19:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1f1d:	7e 93                	jle    1eb2 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1f1f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1f26:	00 
+  for (r = runs; r; r = r->next)
+    1f27:	48 8b 05 d2 11 00 00 	mov    0x11d2(%rip),%rax        # 3100 <runs>
+    1f2e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f32:	eb 17                	jmp    1f4b <mallocstats+0xc6>
+    nfree += r->size;
+    1f34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f38:	48 8b 00             	mov    (%rax),%rax
+    1f3b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f43:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f4b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1f50:	75 e2                	jne    1f34 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1f52:	48 8b 05 17 12 00 00 	mov    0x1217(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f59:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1f5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f5f:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f63:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1f65:	48 8b 05 fc 11 00 00 	mov    0x11fc(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1f6c:	89 c1                	mov    %eax,%ecx
+    1f6e:	8b 15 cc 11 00 00    	mov    0x11cc(%rip),%edx        # 3140 <stats+0x20>
+    1f74:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f77:	41 89 f9             	mov    %edi,%r9d
+    1f7a:	41 89 f0             	mov    %esi,%r8d
+    1f7d:	48 8d 35 f4 01 00 00 	lea    0x1f4(%rip),%rsi        # 2178 <benchreport+0x1cb>
+    1f84:	89 c7                	mov    %eax,%edi
+    1f86:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f8b:	e8 50 e5 ff ff       	call   4e0 <printf>
+}
+    1f90:	90                   	nop
+    1f91:	c9                   	leave
+    1f92:	c3                   	ret
+
+0000000000001f93 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1f93:	55                   	push   %rbp
+    1f94:	48 89 e5             	mov    %rsp,%rbp
+    1f97:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1f9b:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1f9f:	48 89 c7             	mov    %rax,%rdi
+    1fa2:	e8 9a f7 ff ff       	call   1741 <cycles>
+  return t;
+    1fa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1fab:	c9                   	leave
+    1fac:	c3                   	ret
+
+0000000000001fad <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1fad:	55                   	push   %rbp
+    1fae:	48 89 e5             	mov    %rsp,%rbp
+    1fb1:	48 83 ec 30          	sub    $0x30,%rsp
+    1fb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1fb9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1fbd:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1fc0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1fc4:	0f 8e 24 01 00 00    	jle    20ee <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1fca:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1fd1:	e9 98 00 00 00       	jmp    206e <benchreport+0xc1>
+    x = t[i];
+    1fd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fd9:	48 98                	cltq
+    1fdb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1fe2:	00 
+    1fe3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1fe7:	48 01 d0             	add    %rdx,%rax
+    1fea:	48 8b 00             	mov    (%rax),%rax
+    1fed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1ff1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ff4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1ff7:	eb 33                	jmp    202c <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1ff9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ffc:	48 98                	cltq
+    1ffe:	48 c1 e0 03          	shl    $0x3,%rax
+    2002:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2006:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    200a:	48 01 d0             	add    %rdx,%rax
+    200d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2010:	48 63 d2             	movslq %edx,%rdx
+    2013:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    201a:	00 
+    201b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    201f:	48 01 ca             	add    %rcx,%rdx
+    2022:	48 8b 00             	mov    (%rax),%rax
+    2025:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2028:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    202c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2030:	7e 1d                	jle    204f <benchreport+0xa2>
+    2032:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2035:	48 98                	cltq
+    2037:	48 c1 e0 03          	shl    $0x3,%rax
+    203b:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    203f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2043:	48 01 d0             	add    %rdx,%rax
+    2046:	48 8b 00             	mov    (%rax),%rax
+    2049:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    204d:	72 aa                	jb     1ff9 <benchreport+0x4c>
+    t[j] = x;
+    204f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2052:	48 98                	cltq
+    2054:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    205b:	00 
+    205c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2060:	48 01 c2             	add    %rax,%rdx
+    2063:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2067:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    206a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    206e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2071:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2074:	0f 8c 5c ff ff ff    	jl     1fd6 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    207a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    207d:	48 98                	cltq
+    207f:	48 c1 e0 03          	shl    $0x3,%rax
+    2083:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2087:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    208b:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    208e:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    2091:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2094:	89 c2                	mov    %eax,%edx
+    2096:	c1 ea 1f             	shr    $0x1f,%edx
+    2099:	01 d0                	add    %edx,%eax
+    209b:	d1 f8                	sar    %eax
+    209d:	48 98                	cltq
+    209f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    20a6:	00 
+    20a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20ab:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    20ae:	48 8b 38             	mov    (%rax),%rdi
+    20b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20b5:	48 8b 30             	mov    (%rax),%rsi
+    20b8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    20bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20bf:	48 83 ec 08          	sub    $0x8,%rsp
+    20c3:	51                   	push   %rcx
+    20c4:	49 89 f9             	mov    %rdi,%r9
+    20c7:	49 89 f0             	mov    %rsi,%r8
+    20ca:	89 d1                	mov    %edx,%ecx
+    20cc:	48 89 c2             	mov    %rax,%rdx
+    20cf:	48 8d 05 e2 00 00 00 	lea    0xe2(%rip),%rax        # 21b8 <benchreport+0x20b>
+    20d6:	48 89 c6             	mov    %rax,%rsi
+    20d9:	bf 01 00 00 00       	mov    $0x1,%edi
+    20de:	b8 00 00 00 00       	mov    $0x0,%eax
+    20e3:	e8 f8 e3 ff ff       	call   4e0 <printf>
+    20e8:	48 83 c4 10          	add    $0x10,%rsp
+    20ec:	eb 01                	jmp    20ef <benchreport+0x142>
+    return;
+    20ee:	90                   	nop
+}
+    20ef:	c9                   	leave
+    20f0:	c3                   	ret
@@ -0,0 +1,3684 @@
+
+out/user/_pipebench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <pingpong>:
+#define XFER (64 * 1024)
+#define MAXWRITE 4096
+
+static char buf[MAXWRITE];
+
+static void pingpong(uint64_t *t, int n) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	53                   	push   %rbx
+       5:	48 83 ec 38          	sub    $0x38,%rsp
+       9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+       d:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  int to[2], from[2], i;
+  char c;
+
+  if (pipe(to) < 0 || pipe(from) < 0) {
+      10:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 5a 16 00 00       	call   1676 <pipe>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	78 10                	js     30 <pingpong+0x30>
+      20:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+      24:	48 89 c7             	mov    %rax,%rdi
+      27:	e8 4a 16 00 00       	call   1676 <pipe>
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1e                	jns    4e <pingpong+0x4e>
+    printf(2, "pipebench: pipe failed\n");
+      30:	48 8d 05 89 21 00 00 	lea    0x2189(%rip),%rax        # 21c0 <benchreport+0x147>
+      37:	48 89 c6             	mov    %rax,%rsi
+      3a:	bf 02 00 00 00       	mov    $0x2,%edi
+      3f:	b8 00 00 00 00       	mov    $0x0,%eax
+      44:	e8 63 05 00 00       	call   5ac <printf>
+    exit();
+      49:	e8 8e 0b 00 00       	call   bdc <exit>
+  }
+  if (fork() == 0) {
+      4e:	e8 79 0b 00 00       	call   bcc <fork>
+      53:	85 c0                	test   %eax,%eax
+      55:	75 4c                	jne    a3 <pingpong+0xa3>
+    close(to[1]);
+      57:	8b 45 e8             	mov    -0x18(%rbp),%eax
+      5a:	89 c7                	mov    %eax,%edi
+      5c:	e8 e5 0b 00 00       	call   c46 <close>
+    close(from[0]);
+      61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      64:	89 c7                	mov    %eax,%edi
+      66:	e8 db 0b 00 00       	call   c46 <close>
+    while (read(to[0], &c, 1) == 1)
+      6b:	eb 16                	jmp    83 <pingpong+0x83>
+      write(from[1], &c, 1);
+      6d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      70:	48 8d 4d db          	lea    -0x25(%rbp),%rcx
+      74:	ba 01 00 00 00       	mov    $0x1,%edx
+      79:	48 89 ce             	mov    %rcx,%rsi
+      7c:	89 c7                	mov    %eax,%edi
+      7e:	e8 09 16 00 00       	call   168c <write>
+    while (read(to[0], &c, 1) == 1)
+      83:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      86:	48 8d 4d db          	lea    -0x25(%rbp),%rcx
+      8a:	ba 01 00 00 00       	mov    $0x1,%edx
+      8f:	48 89 ce             	mov    %rcx,%rsi
+      92:	89 c7                	mov    %eax,%edi
+      94:	e8 e8 15 00 00       	call   1681 <read>
+      99:	83 f8 01             	cmp    $0x1,%eax
+      9c:	74 cf                	je     6d <pingpong+0x6d>
+    exit();
+      9e:	e8 39 0b 00 00       	call   bdc <exit>
+  }
+  close(to[0]);
+      a3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      a6:	89 c7                	mov    %eax,%edi
+      a8:	e8 99 0b 00 00       	call   c46 <close>
+  close(from[1]);
+      ad:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      b0:	89 c7                	mov    %eax,%edi
+      b2:	e8 8f 0b 00 00       	call   c46 <close>
+  for (i = 0; i < n; i++) {
+      b7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+      be:	e9 8a 00 00 00       	jmp    14d <pingpong+0x14d>
+    t[i] = now();
+      c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      c6:	48 98                	cltq
+      c8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      cf:	00 
+      d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      d4:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+      d8:	e8 82 1f 00 00       	call   205f <now>
+      dd:	48 89 03             	mov    %rax,(%rbx)
+    write(to[1], "x", 1);
+      e0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+      e3:	ba 01 00 00 00       	mov    $0x1,%edx
+      e8:	48 8d 0d e9 20 00 00 	lea    0x20e9(%rip),%rcx        # 21d8 <benchreport+0x15f>
+      ef:	48 89 ce             	mov    %rcx,%rsi
+      f2:	89 c7                	mov    %eax,%edi
+      f4:	e8 93 15 00 00       	call   168c <write>
+    read(from[0], &c, 1);
+      f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      fc:	48 8d 4d db          	lea    -0x25(%rbp),%rcx
+     100:	ba 01 00 00 00       	mov    $0x1,%edx
+     105:	48 89 ce             	mov    %rcx,%rsi
+     108:	89 c7                	mov    %eax,%edi
+     10a:	e8 72 15 00 00       	call   1681 <read>
+    t[i] = now() - t[i];
+     10f:	e8 4b 1f 00 00       	call   205f <now>
+     114:	48 89 c2             	mov    %rax,%rdx
+     117:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     11a:	48 98                	cltq
+     11c:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     123:	00 
+     124:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     128:	48 01 c8             	add    %rcx,%rax
+     12b:	48 8b 00             	mov    (%rax),%rax
+     12e:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     131:	48 63 c9             	movslq %ecx,%rcx
+     134:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+     13b:	00 
+     13c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     140:	48 01 f1             	add    %rsi,%rcx
+     143:	48 29 c2             	sub    %rax,%rdx
+     146:	48 89 11             	mov    %rdx,(%rcx)
+  for (i = 0; i < n; i++) {
+     149:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     14d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     150:	3b 45 c4             	cmp    -0x3c(%rbp),%eax
+     153:	0f 8c 6a ff ff ff    	jl     c3 <pingpong+0xc3>
+  }
+  close(to[1]);
+     159:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     15c:	89 c7                	mov    %eax,%edi
+     15e:	e8 e3 0a 00 00       	call   c46 <close>
+  close(from[0]);
+     163:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     166:	89 c7                	mov    %eax,%edi
+     168:	e8 d9 0a 00 00       	call   c46 <close>
+  wait();
+     16d:	e8 f9 14 00 00       	call   166b <wait>
+  benchreport("pingpong", t, n);
+     172:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+     175:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     179:	48 89 c6             	mov    %rax,%rsi
+     17c:	48 8d 05 57 20 00 00 	lea    0x2057(%rip),%rax        # 21da <benchreport+0x161>
+     183:	48 89 c7             	mov    %rax,%rdi
+     186:	e8 ee 1e 00 00       	call   2079 <benchreport>
+}
+     18b:	90                   	nop
+     18c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     190:	c9                   	leave
+     191:	c3                   	ret
+
+0000000000000192 <throughput>:
+
+static void throughput(char *name, uint64_t *t, int n, int size) {
+     192:	55                   	push   %rbp
+     193:	48 89 e5             	mov    %rsp,%rbp
+     196:	53                   	push   %rbx
+     197:	48 83 ec 48          	sub    $0x48,%rsp
+     19b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+     19f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     1a3:	89 55 bc             	mov    %edx,-0x44(%rbp)
+     1a6:	89 4d b8             	mov    %ecx,-0x48(%rbp)
+  int fds[2], i, left, r;
+
+  for (i = 0; i < n; i++) {
+     1a9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     1b0:	e9 1d 01 00 00       	jmp    2d2 <throughput+0x140>
+    if (pipe(fds) < 0) {
+     1b5:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     1b9:	48 89 c7             	mov    %rax,%rdi
+     1bc:	e8 b5 14 00 00       	call   1676 <pipe>
+     1c1:	85 c0                	test   %eax,%eax
+     1c3:	79 1e                	jns    1e3 <throughput+0x51>
+      printf(2, "pipebench: pipe failed\n");
+     1c5:	48 8d 05 f4 1f 00 00 	lea    0x1ff4(%rip),%rax        # 21c0 <benchreport+0x147>
+     1cc:	48 89 c6             	mov    %rax,%rsi
+     1cf:	bf 02 00 00 00       	mov    $0x2,%edi
+     1d4:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d9:	e8 ce 03 00 00       	call   5ac <printf>
+      exit();
+     1de:	e8 f9 09 00 00       	call   bdc <exit>
+    }
+    t[i] = now();
+     1e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1e6:	48 98                	cltq
+     1e8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     1ef:	00 
+     1f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1f4:	48 8d 1c 02          	lea    (%rdx,%rax,1),%rbx
+     1f8:	e8 62 1e 00 00       	call   205f <now>
+     1fd:	48 89 03             	mov    %rax,(%rbx)
+    if (fork() == 0) {
+     200:	e8 c7 09 00 00       	call   bcc <fork>
+     205:	85 c0                	test   %eax,%eax
+     207:	75 3b                	jne    244 <throughput+0xb2>
+      close(fds[0]);
+     209:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     20c:	89 c7                	mov    %eax,%edi
+     20e:	e8 33 0a 00 00       	call   c46 <close>
+      for (left = XFER; left > 0; left -= size)
+     213:	c7 45 e8 00 00 01 00 	movl   $0x10000,-0x18(%rbp)
+     21a:	eb 1d                	jmp    239 <throughput+0xa7>
+        write(fds[1], buf, size);
+     21c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     21f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+     222:	48 8d 0d 17 2e 00 00 	lea    0x2e17(%rip),%rcx        # 3040 <buf>
+     229:	48 89 ce             	mov    %rcx,%rsi
+     22c:	89 c7                	mov    %eax,%edi
+     22e:	e8 59 14 00 00       	call   168c <write>
+      for (left = XFER; left > 0; left -= size)
+     233:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     236:	29 45 e8             	sub    %eax,-0x18(%rbp)
+     239:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     23d:	7f dd                	jg     21c <throughput+0x8a>
+      exit();
+     23f:	e8 98 09 00 00       	call   bdc <exit>
+    }
+    close(fds[1]);
+     244:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     247:	89 c7                	mov    %eax,%edi
+     249:	e8 f8 09 00 00       	call   c46 <close>
+    for (left = XFER; left > 0 && (r = read(fds[0], buf, MAXWRITE)) > 0;
+     24e:	c7 45 e8 00 00 01 00 	movl   $0x10000,-0x18(%rbp)
+     255:	eb 06                	jmp    25d <throughput+0xcb>
+         left -= r)
+     257:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     25a:	29 45 e8             	sub    %eax,-0x18(%rbp)
+    for (left = XFER; left > 0 && (r = read(fds[0], buf, MAXWRITE)) > 0;
+     25d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     261:	7e 22                	jle    285 <throughput+0xf3>
+     263:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     266:	ba 00 10 00 00       	mov    $0x1000,%edx
+     26b:	48 8d 0d ce 2d 00 00 	lea    0x2dce(%rip),%rcx        # 3040 <buf>
+     272:	48 89 ce             	mov    %rcx,%rsi
+     275:	89 c7                	mov    %eax,%edi
+     277:	e8 05 14 00 00       	call   1681 <read>
+     27c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+     27f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     283:	7f d2                	jg     257 <throughput+0xc5>
+      ;
+    t[i] = now() - t[i];
+     285:	e8 d5 1d 00 00       	call   205f <now>
+     28a:	48 89 c2             	mov    %rax,%rdx
+     28d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     290:	48 98                	cltq
+     292:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     299:	00 
+     29a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     29e:	48 01 c8             	add    %rcx,%rax
+     2a1:	48 8b 00             	mov    (%rax),%rax
+     2a4:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     2a7:	48 63 c9             	movslq %ecx,%rcx
+     2aa:	48 8d 34 cd 00 00 00 	lea    0x0(,%rcx,8),%rsi
+     2b1:	00 
+     2b2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     2b6:	48 01 f1             	add    %rsi,%rcx
+     2b9:	48 29 c2             	sub    %rax,%rdx
+     2bc:	48 89 11             	mov    %rdx,(%rcx)
+    close(fds[0]);
+     2bf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     2c2:	89 c7                	mov    %eax,%edi
+     2c4:	e8 7d 09 00 00       	call   c46 <close>
+    wait();
+     2c9:	e8 9d 13 00 00       	call   166b <wait>
+  for (i = 0; i < n; i++) {
+     2ce:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     2d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     2d5:	3b 45 bc             	cmp    -0x44(%rbp),%eax
+     2d8:	0f 8c d7 fe ff ff    	jl     1b5 <throughput+0x23>
+  }
+  benchreport(name, t, n);
+     2de:	8b 55 bc             	mov    -0x44(%rbp),%edx
+     2e1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     2e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     2e9:	48 89 ce             	mov    %rcx,%rsi
+     2ec:	48 89 c7             	mov    %rax,%rdi
+     2ef:	e8 85 1d 00 00       	call   2079 <benchreport>
+}
+     2f4:	90                   	nop
+     2f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     2f9:	c9                   	leave
+     2fa:	c3                   	ret
+
+00000000000002fb <main>:
+
+int main(int argc, char *argv[]) {
+     2fb:	55                   	push   %rbp
+     2fc:	48 89 e5             	mov    %rsp,%rbp
+     2ff:	48 83 ec 50          	sub    $0x50,%rsp
+     303:	89 7d bc             	mov    %edi,-0x44(%rbp)
+     306:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int sizes[] = {64, 512, 4096};
+     30a:	c7 45 e4 40 00 00 00 	movl   $0x40,-0x1c(%rbp)
+     311:	c7 45 e8 00 02 00 00 	movl   $0x200,-0x18(%rbp)
+     318:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  char *names[] = {"pipe 64K, 64 byte writes", "pipe 64K, 512 byte writes",
+     31f:	48 8d 05 bd 1e 00 00 	lea    0x1ebd(%rip),%rax        # 21e3 <benchreport+0x16a>
+     326:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     32a:	48 8d 05 cb 1e 00 00 	lea    0x1ecb(%rip),%rax        # 21fc <benchreport+0x183>
+     331:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+     335:	48 8d 05 da 1e 00 00 	lea    0x1eda(%rip),%rax        # 2216 <benchreport+0x19d>
+     33c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+                   "pipe 64K, 4K writes"};
+  uint64_t *t;
+  int n, i;
+
+  n = argc > 1 ? atoi(argv[1]) : 100;
+     340:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     344:	7e 15                	jle    35b <main+0x60>
+     346:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     34a:	48 83 c0 08          	add    $0x8,%rax
+     34e:	48 8b 00             	mov    (%rax),%rax
+     351:	48 89 c7             	mov    %rax,%rdi
+     354:	e8 ed 0d 00 00       	call   1146 <atoi>
+     359:	eb 05                	jmp    360 <main+0x65>
+     35b:	b8 64 00 00 00       	mov    $0x64,%eax
+     360:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (n <= 0 || (t = malloc(n * sizeof(*t))) == 0) {
+     363:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     367:	7e 1a                	jle    383 <main+0x88>
+     369:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     36c:	48 98                	cltq
+     36e:	c1 e0 03             	shl    $0x3,%eax
+     371:	89 c7                	mov    %eax,%edi
+     373:	e8 14 19 00 00       	call   1c8c <malloc>
+     378:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     37c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     381:	75 1e                	jne    3a1 <main+0xa6>
+    printf(2, "usage: pipebench [n]\n");
+     383:	48 8d 05 a0 1e 00 00 	lea    0x1ea0(%rip),%rax        # 222a <benchreport+0x1b1>
+     38a:	48 89 c6             	mov    %rax,%rsi
+     38d:	bf 02 00 00 00       	mov    $0x2,%edi
+     392:	b8 00 00 00 00       	mov    $0x0,%eax
+     397:	e8 10 02 00 00       	call   5ac <printf>
+    exit();
+     39c:	e8 3b 08 00 00       	call   bdc <exit>
+  }
+  pingpong(t, n);
+     3a1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     3a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3a8:	89 d6                	mov    %edx,%esi
+     3aa:	48 89 c7             	mov    %rax,%rdi
+     3ad:	e8 4e fc ff ff       	call   0 <pingpong>
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+     3b2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     3b9:	eb 26                	jmp    3e1 <main+0xe6>
+    throughput(names[i], t, n, sizes[i]);
+     3bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3be:	48 98                	cltq
+     3c0:	8b 4c 85 e4          	mov    -0x1c(%rbp,%rax,4),%ecx
+     3c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3c7:	48 98                	cltq
+     3c9:	48 8b 44 c5 c8       	mov    -0x38(%rbp,%rax,8),%rax
+     3ce:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     3d1:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     3d5:	48 89 c7             	mov    %rax,%rdi
+     3d8:	e8 b5 fd ff ff       	call   192 <throughput>
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+     3dd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     3e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3e4:	83 f8 02             	cmp    $0x2,%eax
+     3e7:	76 d2                	jbe    3bb <main+0xc0>
+  exit();
+     3e9:	e8 ee 07 00 00       	call   bdc <exit>
+
+00000000000003ee <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     3ee:	55                   	push   %rbp
+     3ef:	48 89 e5             	mov    %rsp,%rbp
+     3f2:	48 83 ec 10          	sub    $0x10,%rsp
+     3f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     3f9:	89 f0                	mov    %esi,%eax
+     3fb:	88 45 f8             	mov    %al,-0x8(%rbp)
+     3fe:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     402:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     405:	89 d6                	mov    %edx,%esi
+     407:	89 c7                	mov    %eax,%edi
+     409:	e8 eb 06 00 00       	call   af9 <bputc>
+     40e:	90                   	nop
+     40f:	c9                   	leave
+     410:	c3                   	ret
+
+0000000000000411 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     411:	55                   	push   %rbp
+     412:	48 89 e5             	mov    %rsp,%rbp
+     415:	48 83 ec 50          	sub    $0x50,%rsp
+     419:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     41c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     420:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     423:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     426:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     42a:	74 21                	je     44d <printint64+0x3c>
+     42c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     430:	48 c1 e8 3f          	shr    $0x3f,%rax
+     434:	0f b6 c0             	movzbl %al,%eax
+     437:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     43a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     43e:	74 0d                	je     44d <printint64+0x3c>
+    x = -xx;
+     440:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     444:	48 f7 d8             	neg    %rax
+     447:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     44b:	eb 08                	jmp    455 <printint64+0x44>
+  else
+    x = xx;
+     44d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     451:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     455:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     45c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     45f:	48 63 c8             	movslq %eax,%rcx
+     462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     466:	ba 00 00 00 00       	mov    $0x0,%edx
+     46b:	48 f7 f1             	div    %rcx
+     46e:	48 89 d1             	mov    %rdx,%rcx
+     471:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     474:	8d 50 01             	lea    0x1(%rax),%edx
+     477:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     47a:	48 8d 15 7f 2b 00 00 	lea    0x2b7f(%rip),%rdx        # 3000 <digits.1>
+     481:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     485:	48 98                	cltq
+     487:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     48b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     48e:	48 63 f0             	movslq %eax,%rsi
+     491:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     495:	ba 00 00 00 00       	mov    $0x0,%edx
+     49a:	48 f7 f6             	div    %rsi
+     49d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     4a1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     4a6:	75 b4                	jne    45c <printint64+0x4b>
+
+  if (sgn)
+     4a8:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     4ac:	74 2b                	je     4d9 <printint64+0xc8>
+    buf[i++] = '-';
+     4ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4b1:	8d 50 01             	lea    0x1(%rax),%edx
+     4b4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     4b7:	48 98                	cltq
+     4b9:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     4be:	eb 19                	jmp    4d9 <printint64+0xc8>
+    putc(fd, buf[i]);
+     4c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4c3:	48 98                	cltq
+     4c5:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     4ca:	0f be d0             	movsbl %al,%edx
+     4cd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     4d0:	89 d6                	mov    %edx,%esi
+     4d2:	89 c7                	mov    %eax,%edi
+     4d4:	e8 15 ff ff ff       	call   3ee <putc>
+  while (--i >= 0)
+     4d9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     4dd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     4e1:	79 dd                	jns    4c0 <printint64+0xaf>
+}
+     4e3:	90                   	nop
+     4e4:	90                   	nop
+     4e5:	c9                   	leave
+     4e6:	c3                   	ret
+
+00000000000004e7 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     4e7:	55                   	push   %rbp
+     4e8:	48 89 e5             	mov    %rsp,%rbp
+     4eb:	48 83 ec 30          	sub    $0x30,%rsp
+     4ef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     4f2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     4f5:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     4f8:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     4fb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     502:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     506:	74 17                	je     51f <printint+0x38>
+     508:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     50c:	79 11                	jns    51f <printint+0x38>
+    neg = 1;
+     50e:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     515:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     518:	f7 d8                	neg    %eax
+     51a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     51d:	eb 06                	jmp    525 <printint+0x3e>
+  } else {
+    x = xx;
+     51f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     522:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     525:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     52c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     52f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     532:	ba 00 00 00 00       	mov    $0x0,%edx
+     537:	f7 f1                	div    %ecx
+     539:	89 d1                	mov    %edx,%ecx
+     53b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     53e:	8d 50 01             	lea    0x1(%rax),%edx
+     541:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     544:	89 c9                	mov    %ecx,%ecx
+     546:	48 8d 15 d3 2a 00 00 	lea    0x2ad3(%rip),%rdx        # 3020 <digits.0>
+     54d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     551:	48 98                	cltq
+     553:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     557:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     55a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     55d:	ba 00 00 00 00       	mov    $0x0,%edx
+     562:	f7 f6                	div    %esi
+     564:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     567:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     56b:	75 bf                	jne    52c <printint+0x45>
+  if (neg)
+     56d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     571:	74 2b                	je     59e <printint+0xb7>
+    buf[i++] = '-';
+     573:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     576:	8d 50 01             	lea    0x1(%rax),%edx
+     579:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     57c:	48 98                	cltq
+     57e:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     583:	eb 19                	jmp    59e <printint+0xb7>
+    putc(fd, buf[i]);
+     585:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     588:	48 98                	cltq
+     58a:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     58f:	0f be d0             	movsbl %al,%edx
+     592:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     595:	89 d6                	mov    %edx,%esi
+     597:	89 c7                	mov    %eax,%edi
+     599:	e8 50 fe ff ff       	call   3ee <putc>
+  while (--i >= 0)
+     59e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     5a2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     5a6:	79 dd                	jns    585 <printint+0x9e>
+}
+     5a8:	90                   	nop
+     5a9:	90                   	nop
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+
+00000000000005ac <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     5ac:	55                   	push   %rbp
+     5ad:	48 89 e5             	mov    %rsp,%rbp
+     5b0:	48 83 ec 70          	sub    $0x70,%rsp
+     5b4:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     5b7:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     5bb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     5bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     5c3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     5c7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     5cb:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     5d2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     5d6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     5da:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     5de:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     5e2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     5e9:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     5f0:	e9 67 02 00 00       	jmp    85c <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     5f5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     5f8:	48 63 d0             	movslq %eax,%rdx
+     5fb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     5ff:	48 01 d0             	add    %rdx,%rax
+     602:	0f b6 00             	movzbl (%rax),%eax
+     605:	0f be c0             	movsbl %al,%eax
+     608:	25 ff 00 00 00       	and    $0xff,%eax
+     60d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     610:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     614:	75 30                	jne    646 <printf+0x9a>
+      if (c == '%') {
+     616:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     61a:	75 13                	jne    62f <printf+0x83>
+        state = '%';
+     61c:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     623:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     62a:	e9 29 02 00 00       	jmp    858 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     62f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     632:	0f be d0             	movsbl %al,%edx
+     635:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     638:	89 d6                	mov    %edx,%esi
+     63a:	89 c7                	mov    %eax,%edi
+     63c:	e8 ad fd ff ff       	call   3ee <putc>
+     641:	e9 12 02 00 00       	jmp    858 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     646:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     64a:	0f 85 08 02 00 00    	jne    858 <printf+0x2ac>
+      if (c == 'l') {
+     650:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     654:	75 0c                	jne    662 <printf+0xb6>
+        lflag = 1;
+     656:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     65d:	e9 f6 01 00 00       	jmp    858 <printf+0x2ac>
+      } else if (c == 'd') {
+     662:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     666:	0f 85 93 00 00 00    	jne    6ff <printf+0x153>
+        if (lflag == 1)
+     66c:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     670:	75 47                	jne    6b9 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     672:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     675:	83 f8 2f             	cmp    $0x2f,%eax
+     678:	77 17                	ja     691 <printf+0xe5>
+     67a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     67e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     681:	89 d2                	mov    %edx,%edx
+     683:	48 01 d0             	add    %rdx,%rax
+     686:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     689:	83 c2 08             	add    $0x8,%edx
+     68c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     68f:	eb 0c                	jmp    69d <printf+0xf1>
+     691:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     695:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     699:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     69d:	48 8b 30             	mov    (%rax),%rsi
+     6a0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6a3:	b9 01 00 00 00       	mov    $0x1,%ecx
+     6a8:	ba 0a 00 00 00       	mov    $0xa,%edx
+     6ad:	89 c7                	mov    %eax,%edi
+     6af:	e8 5d fd ff ff       	call   411 <printint64>
+     6b4:	e9 98 01 00 00       	jmp    851 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     6b9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     6bc:	83 f8 2f             	cmp    $0x2f,%eax
+     6bf:	77 17                	ja     6d8 <printf+0x12c>
+     6c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     6c5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6c8:	89 d2                	mov    %edx,%edx
+     6ca:	48 01 d0             	add    %rdx,%rax
+     6cd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     6d0:	83 c2 08             	add    $0x8,%edx
+     6d3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     6d6:	eb 0c                	jmp    6e4 <printf+0x138>
+     6d8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     6dc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     6e0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     6e4:	8b 30                	mov    (%rax),%esi
+     6e6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6e9:	b9 01 00 00 00       	mov    $0x1,%ecx
+     6ee:	ba 0a 00 00 00       	mov    $0xa,%edx
+     6f3:	89 c7                	mov    %eax,%edi
+     6f5:	e8 ed fd ff ff       	call   4e7 <printint>
+     6fa:	e9 52 01 00 00       	jmp    851 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     6ff:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     703:	74 0a                	je     70f <printf+0x163>
+     705:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     709:	0f 85 93 00 00 00    	jne    7a2 <printf+0x1f6>
+        if (lflag == 1)
+     70f:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     713:	75 47                	jne    75c <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     715:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     718:	83 f8 2f             	cmp    $0x2f,%eax
+     71b:	77 17                	ja     734 <printf+0x188>
+     71d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     721:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     724:	89 d2                	mov    %edx,%edx
+     726:	48 01 d0             	add    %rdx,%rax
+     729:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     72c:	83 c2 08             	add    $0x8,%edx
+     72f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     732:	eb 0c                	jmp    740 <printf+0x194>
+     734:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     738:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     73c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     740:	48 8b 30             	mov    (%rax),%rsi
+     743:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     746:	b9 00 00 00 00       	mov    $0x0,%ecx
+     74b:	ba 10 00 00 00       	mov    $0x10,%edx
+     750:	89 c7                	mov    %eax,%edi
+     752:	e8 ba fc ff ff       	call   411 <printint64>
+        if (lflag == 1)
+     757:	e9 f5 00 00 00       	jmp    851 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     75c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     75f:	83 f8 2f             	cmp    $0x2f,%eax
+     762:	77 17                	ja     77b <printf+0x1cf>
+     764:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     768:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     76b:	89 d2                	mov    %edx,%edx
+     76d:	48 01 d0             	add    %rdx,%rax
+     770:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     773:	83 c2 08             	add    $0x8,%edx
+     776:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     779:	eb 0c                	jmp    787 <printf+0x1db>
+     77b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     77f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     783:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     787:	8b 30                	mov    (%rax),%esi
+     789:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     78c:	b9 00 00 00 00       	mov    $0x0,%ecx
+     791:	ba 10 00 00 00       	mov    $0x10,%edx
+     796:	89 c7                	mov    %eax,%edi
+     798:	e8 4a fd ff ff       	call   4e7 <printint>
+        if (lflag == 1)
+     79d:	e9 af 00 00 00       	jmp    851 <printf+0x2a5>
+      } else if (c == 's') {
+     7a2:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     7a6:	75 6e                	jne    816 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     7a8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     7ab:	83 f8 2f             	cmp    $0x2f,%eax
+     7ae:	77 17                	ja     7c7 <printf+0x21b>
+     7b0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     7b4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7b7:	89 d2                	mov    %edx,%edx
+     7b9:	48 01 d0             	add    %rdx,%rax
+     7bc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7bf:	83 c2 08             	add    $0x8,%edx
+     7c2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     7c5:	eb 0c                	jmp    7d3 <printf+0x227>
+     7c7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     7cb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     7cf:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     7d3:	48 8b 00             	mov    (%rax),%rax
+     7d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     7da:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     7df:	75 28                	jne    809 <printf+0x25d>
+          s = "(null)";
+     7e1:	48 8d 05 58 1a 00 00 	lea    0x1a58(%rip),%rax        # 2240 <benchreport+0x1c7>
+     7e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     7ec:	eb 1b                	jmp    809 <printf+0x25d>
+          putc(fd, *s);
+     7ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     7f2:	0f b6 00             	movzbl (%rax),%eax
+     7f5:	0f be d0             	movsbl %al,%edx
+     7f8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7fb:	89 d6                	mov    %edx,%esi
+     7fd:	89 c7                	mov    %eax,%edi
+     7ff:	e8 ea fb ff ff       	call   3ee <putc>
+        for (; *s; s++)
+     804:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     809:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     80d:	0f b6 00             	movzbl (%rax),%eax
+     810:	84 c0                	test   %al,%al
+     812:	75 da                	jne    7ee <printf+0x242>
+     814:	eb 3b                	jmp    851 <printf+0x2a5>
+      } else if (c == '%') {
+     816:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     81a:	75 14                	jne    830 <printf+0x284>
+        putc(fd, c);
+     81c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     81f:	0f be d0             	movsbl %al,%edx
+     822:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     825:	89 d6                	mov    %edx,%esi
+     827:	89 c7                	mov    %eax,%edi
+     829:	e8 c0 fb ff ff       	call   3ee <putc>
+     82e:	eb 21                	jmp    851 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     830:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     833:	be 25 00 00 00       	mov    $0x25,%esi
+     838:	89 c7                	mov    %eax,%edi
+     83a:	e8 af fb ff ff       	call   3ee <putc>
+        putc(fd, c);
+     83f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     842:	0f be d0             	movsbl %al,%edx
+     845:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     848:	89 d6                	mov    %edx,%esi
+     84a:	89 c7                	mov    %eax,%edi
+     84c:	e8 9d fb ff ff       	call   3ee <putc>
+      }
+      state = 0;
+     851:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     858:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     85c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     85f:	48 63 d0             	movslq %eax,%rdx
+     862:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     866:	48 01 d0             	add    %rdx,%rax
+     869:	0f b6 00             	movzbl (%rax),%eax
+     86c:	84 c0                	test   %al,%al
+     86e:	0f 85 81 fd ff ff    	jne    5f5 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     874:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     877:	89 c7                	mov    %eax,%edi
+     879:	e8 ee 02 00 00       	call   b6c <bflushtty>
+}
+     87e:	90                   	nop
+     87f:	c9                   	leave
+     880:	c3                   	ret
+
+0000000000000881 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     881:	55                   	push   %rbp
+     882:	48 89 e5             	mov    %rsp,%rbp
+     885:	48 83 ec 30          	sub    $0x30,%rsp
+     889:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     88c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     890:	78 06                	js     898 <getbuf+0x17>
+     892:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     896:	7e 0a                	jle    8a2 <getbuf+0x21>
+    return 0;
+     898:	b8 00 00 00 00       	mov    $0x0,%eax
+     89d:	e9 94 00 00 00       	jmp    936 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     8a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8a5:	48 98                	cltq
+     8a7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8ae:	00 
+     8af:	48 8d 05 8a 37 00 00 	lea    0x378a(%rip),%rax        # 4040 <obufs>
+     8b6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8be:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8c3:	75 6d                	jne    932 <getbuf+0xb1>
+     8c5:	bf 08 02 00 00       	mov    $0x208,%edi
+     8ca:	e8 bd 13 00 00       	call   1c8c <malloc>
+     8cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     8d3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     8d8:	74 58                	je     932 <getbuf+0xb1>
+    b->n = 0;
+     8da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8de:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     8e4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     8e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8eb:	48 89 d6             	mov    %rdx,%rsi
+     8ee:	89 c7                	mov    %eax,%edi
+     8f0:	e8 e4 0d 00 00       	call   16d9 <fstat>
+     8f5:	85 c0                	test   %eax,%eax
+     8f7:	75 11                	jne    90a <getbuf+0x89>
+     8f9:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     8fd:	66 83 f8 03          	cmp    $0x3,%ax
+     901:	75 07                	jne    90a <getbuf+0x89>
+     903:	ba 01 00 00 00       	mov    $0x1,%edx
+     908:	eb 05                	jmp    90f <getbuf+0x8e>
+     90a:	ba 00 00 00 00       	mov    $0x0,%edx
+     90f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     913:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     916:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     919:	48 98                	cltq
+     91b:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     922:	00 
+     923:	48 8d 15 16 37 00 00 	lea    0x3716(%rip),%rdx        # 4040 <obufs>
+     92a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     92e:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     932:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     936:	c9                   	leave
+     937:	c3                   	ret
+
+0000000000000938 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     938:	55                   	push   %rbp
+     939:	48 89 e5             	mov    %rsp,%rbp
+     93c:	48 83 ec 20          	sub    $0x20,%rsp
+     940:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     943:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     947:	78 33                	js     97c <bflush+0x44>
+     949:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     94d:	7f 2d                	jg     97c <bflush+0x44>
+     94f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     952:	48 98                	cltq
+     954:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     95b:	00 
+     95c:	48 8d 05 dd 36 00 00 	lea    0x36dd(%rip),%rax        # 4040 <obufs>
+     963:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     967:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     96b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     970:	74 0a                	je     97c <bflush+0x44>
+     972:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     976:	8b 00                	mov    (%rax),%eax
+     978:	85 c0                	test   %eax,%eax
+     97a:	75 07                	jne    983 <bflush+0x4b>
+    return 0;
+     97c:	b8 00 00 00 00       	mov    $0x0,%eax
+     981:	eb 3c                	jmp    9bf <bflush+0x87>
+  n = b->n;
+     983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     987:	8b 00                	mov    (%rax),%eax
+     989:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     98c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     990:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     996:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     99a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     99e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     9a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     9a4:	48 89 ce             	mov    %rcx,%rsi
+     9a7:	89 c7                	mov    %eax,%edi
+     9a9:	e8 de 0c 00 00       	call   168c <write>
+     9ae:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     9b1:	75 07                	jne    9ba <bflush+0x82>
+     9b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b8:	eb 05                	jmp    9bf <bflush+0x87>
+     9ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     9bf:	c9                   	leave
+     9c0:	c3                   	ret
+
+00000000000009c1 <bflushall>:
+
+void bflushall(void) {
+     9c1:	55                   	push   %rbp
+     9c2:	48 89 e5             	mov    %rsp,%rbp
+     9c5:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     9c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     9d0:	eb 0e                	jmp    9e0 <bflushall+0x1f>
+    bflush(fd);
+     9d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d5:	89 c7                	mov    %eax,%edi
+     9d7:	e8 5c ff ff ff       	call   938 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     9dc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9e0:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     9e4:	7e ec                	jle    9d2 <bflushall+0x11>
+}
+     9e6:	90                   	nop
+     9e7:	90                   	nop
+     9e8:	c9                   	leave
+     9e9:	c3                   	ret
+
+00000000000009ea <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     9ea:	55                   	push   %rbp
+     9eb:	48 89 e5             	mov    %rsp,%rbp
+     9ee:	48 83 ec 30          	sub    $0x30,%rsp
+     9f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     9f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     9f9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     9fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     9ff:	89 c7                	mov    %eax,%edi
+     a01:	e8 7b fe ff ff       	call   881 <getbuf>
+     a06:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     a0a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     a0f:	75 19                	jne    a2a <bwrite+0x40>
+    return write(fd, s, n);
+     a11:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     a14:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     a18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a1b:	48 89 ce             	mov    %rcx,%rsi
+     a1e:	89 c7                	mov    %eax,%edi
+     a20:	e8 67 0c 00 00       	call   168c <write>
+     a25:	e9 cd 00 00 00       	jmp    af7 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     a2a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a31:	e9 92 00 00 00       	jmp    ac8 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     a36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a3a:	8b 00                	mov    (%rax),%eax
+     a3c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a41:	75 18                	jne    a5b <bwrite+0x71>
+     a43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a46:	89 c7                	mov    %eax,%edi
+     a48:	e8 eb fe ff ff       	call   938 <bflush>
+     a4d:	85 c0                	test   %eax,%eax
+     a4f:	79 0a                	jns    a5b <bwrite+0x71>
+      return -1;
+     a51:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a56:	e9 9c 00 00 00       	jmp    af7 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     a5b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a5e:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     a61:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a68:	8b 00                	mov    (%rax),%eax
+     a6a:	ba 00 02 00 00       	mov    $0x200,%edx
+     a6f:	29 c2                	sub    %eax,%edx
+     a71:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     a74:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     a77:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     a7a:	39 c2                	cmp    %eax,%edx
+     a7c:	0f 4e c2             	cmovle %edx,%eax
+     a7f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     a82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a85:	48 63 d0             	movslq %eax,%rdx
+     a88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     a8c:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a94:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a9c:	8b 00                	mov    (%rax),%eax
+     a9e:	48 98                	cltq
+     aa0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     aa4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     aa7:	89 c2                	mov    %eax,%edx
+     aa9:	48 89 cf             	mov    %rcx,%rdi
+     aac:	e8 e9 06 00 00       	call   119a <memmove>
+    b->n += m;
+     ab1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ab5:	8b 10                	mov    (%rax),%edx
+     ab7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     aba:	01 c2                	add    %eax,%edx
+     abc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ac0:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     ac2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ac5:	01 45 fc             	add    %eax,-0x4(%rbp)
+     ac8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     acb:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     ace:	0f 8c 62 ff ff ff    	jl     a36 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     ad4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ad8:	8b 40 04             	mov    0x4(%rax),%eax
+     adb:	85 c0                	test   %eax,%eax
+     add:	74 15                	je     af4 <bwrite+0x10a>
+     adf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ae2:	89 c7                	mov    %eax,%edi
+     ae4:	e8 4f fe ff ff       	call   938 <bflush>
+     ae9:	85 c0                	test   %eax,%eax
+     aeb:	79 07                	jns    af4 <bwrite+0x10a>
+    return -1;
+     aed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     af2:	eb 03                	jmp    af7 <bwrite+0x10d>
+  return n;
+     af4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     af7:	c9                   	leave
+     af8:	c3                   	ret
+
+0000000000000af9 <bputc>:
+
+void bputc(int fd, char c) {
+     af9:	55                   	push   %rbp
+     afa:	48 89 e5             	mov    %rsp,%rbp
+     afd:	48 83 ec 20          	sub    $0x20,%rsp
+     b01:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     b04:	89 f0                	mov    %esi,%eax
+     b06:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     b09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b0c:	89 c7                	mov    %eax,%edi
+     b0e:	e8 6e fd ff ff       	call   881 <getbuf>
+     b13:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     b17:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     b1c:	75 18                	jne    b36 <bputc+0x3d>
+    write(fd, &c, 1);
+     b1e:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     b22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b25:	ba 01 00 00 00       	mov    $0x1,%edx
+     b2a:	48 89 ce             	mov    %rcx,%rsi
+     b2d:	89 c7                	mov    %eax,%edi
+     b2f:	e8 58 0b 00 00       	call   168c <write>
+    return;
+     b34:	eb 34                	jmp    b6a <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     b36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b3a:	8b 00                	mov    (%rax),%eax
+     b3c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b41:	75 0a                	jne    b4d <bputc+0x54>
+    bflush(fd);
+     b43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b46:	89 c7                	mov    %eax,%edi
+     b48:	e8 eb fd ff ff       	call   938 <bflush>
+  b->data[b->n++] = c;
+     b4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b51:	8b 00                	mov    (%rax),%eax
+     b53:	8d 48 01             	lea    0x1(%rax),%ecx
+     b56:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     b5a:	89 0a                	mov    %ecx,(%rdx)
+     b5c:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     b60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     b64:	48 98                	cltq
+     b66:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     b6a:	c9                   	leave
+     b6b:	c3                   	ret
+
+0000000000000b6c <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     b6c:	55                   	push   %rbp
+     b6d:	48 89 e5             	mov    %rsp,%rbp
+     b70:	48 83 ec 10          	sub    $0x10,%rsp
+     b74:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     b77:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b7b:	78 4c                	js     bc9 <bflushtty+0x5d>
+     b7d:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     b81:	7f 46                	jg     bc9 <bflushtty+0x5d>
+     b83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b86:	48 98                	cltq
+     b88:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     b8f:	00 
+     b90:	48 8d 05 a9 34 00 00 	lea    0x34a9(%rip),%rax        # 4040 <obufs>
+     b97:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b9b:	48 85 c0             	test   %rax,%rax
+     b9e:	74 29                	je     bc9 <bflushtty+0x5d>
+     ba0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ba3:	48 98                	cltq
+     ba5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     bac:	00 
+     bad:	48 8d 05 8c 34 00 00 	lea    0x348c(%rip),%rax        # 4040 <obufs>
+     bb4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     bb8:	8b 40 04             	mov    0x4(%rax),%eax
+     bbb:	85 c0                	test   %eax,%eax
+     bbd:	74 0a                	je     bc9 <bflushtty+0x5d>
+    bflush(fd);
+     bbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bc2:	89 c7                	mov    %eax,%edi
+     bc4:	e8 6f fd ff ff       	call   938 <bflush>
+}
+     bc9:	90                   	nop
+     bca:	c9                   	leave
+     bcb:	c3                   	ret
+
+0000000000000bcc <fork>:
+
+int fork(void) {
+     bcc:	55                   	push   %rbp
+     bcd:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     bd0:	e8 ec fd ff ff       	call   9c1 <bflushall>
+  return _fork();
+     bd5:	e8 7b 0a 00 00       	call   1655 <_fork>
+}
+     bda:	5d                   	pop    %rbp
+     bdb:	c3                   	ret
+
+0000000000000bdc <exit>:
+
+noreturn void exit(void) {
+     bdc:	55                   	push   %rbp
+     bdd:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     be0:	e8 dc fd ff ff       	call   9c1 <bflushall>
+  _exit();
+     be5:	e8 76 0a 00 00       	call   1660 <_exit>
+
+0000000000000bea <exec>:
+}
+
+int exec(char *path, char **argv) {
+     bea:	55                   	push   %rbp
+     beb:	48 89 e5             	mov    %rsp,%rbp
+     bee:	48 83 ec 10          	sub    $0x10,%rsp
+     bf2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bf6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     bfa:	e8 c2 fd ff ff       	call   9c1 <bflushall>
+  return _exec(path, argv);
+     bff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     c03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c07:	48 89 d6             	mov    %rdx,%rsi
+     c0a:	48 89 c7             	mov    %rax,%rdi
+     c0d:	e8 9b 0a 00 00       	call   16ad <_exec>
+}
+     c12:	c9                   	leave
+     c13:	c3                   	ret
+
+0000000000000c14 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     c14:	55                   	push   %rbp
+     c15:	48 89 e5             	mov    %rsp,%rbp
+     c18:	48 83 ec 20          	sub    $0x20,%rsp
+     c1c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c20:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     c24:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     c28:	e8 94 fd ff ff       	call   9c1 <bflushall>
+  return _spawn(path, argv, fds);
+     c2d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     c31:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     c35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c39:	48 89 ce             	mov    %rcx,%rsi
+     c3c:	48 89 c7             	mov    %rax,%rdi
+     c3f:	e8 2f 0b 00 00       	call   1773 <_spawn>
+}
+     c44:	c9                   	leave
+     c45:	c3                   	ret
+
+0000000000000c46 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     c46:	55                   	push   %rbp
+     c47:	48 89 e5             	mov    %rsp,%rbp
+     c4a:	48 83 ec 10          	sub    $0x10,%rsp
+     c4e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     c51:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c55:	78 69                	js     cc0 <close+0x7a>
+     c57:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     c5b:	7f 63                	jg     cc0 <close+0x7a>
+     c5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c60:	48 98                	cltq
+     c62:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     c69:	00 
+     c6a:	48 8d 05 cf 33 00 00 	lea    0x33cf(%rip),%rax        # 4040 <obufs>
+     c71:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     c75:	48 85 c0             	test   %rax,%rax
+     c78:	74 46                	je     cc0 <close+0x7a>
+    bflush(fd);
+     c7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c7d:	89 c7                	mov    %eax,%edi
+     c7f:	e8 b4 fc ff ff       	call   938 <bflush>
+    free(obufs[fd]);
+     c84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c87:	48 98                	cltq
+     c89:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     c90:	00 
+     c91:	48 8d 05 a8 33 00 00 	lea    0x33a8(%rip),%rax        # 4040 <obufs>
+     c98:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     c9c:	48 89 c7             	mov    %rax,%rdi
+     c9f:	e8 90 11 00 00       	call   1e34 <free>
+    obufs[fd] = 0;
+     ca4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ca7:	48 98                	cltq
+     ca9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     cb0:	00 
+     cb1:	48 8d 05 88 33 00 00 	lea    0x3388(%rip),%rax        # 4040 <obufs>
+     cb8:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     cbf:	00 
+  }
+  return _close(fd);
+     cc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cc3:	89 c7                	mov    %eax,%edi
+     cc5:	e8 cd 09 00 00       	call   1697 <_close>
+}
+     cca:	c9                   	leave
+     ccb:	c3                   	ret
+
+0000000000000ccc <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     ccc:	55                   	push   %rbp
+     ccd:	48 89 e5             	mov    %rsp,%rbp
+     cd0:	53                   	push   %rbx
+     cd1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     cd5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     cd9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     cdd:	48 8b 36             	mov    (%rsi),%rsi
+     ce0:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     ce4:	48 29 f7             	sub    %rsi,%rdi
+     ce7:	48 89 f9             	mov    %rdi,%rcx
+     cea:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cef:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     cf3:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     cf7:	48 89 f0             	mov    %rsi,%rax
+     cfa:	ba 00 00 00 00       	mov    $0x0,%edx
+     cff:	48 89 df             	mov    %rbx,%rdi
+     d02:	48 0f af f8          	imul   %rax,%rdi
+     d06:	48 89 d6             	mov    %rdx,%rsi
+     d09:	48 0f af f1          	imul   %rcx,%rsi
+     d0d:	48 01 fe             	add    %rdi,%rsi
+     d10:	48 f7 e1             	mul    %rcx
+     d13:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     d17:	48 89 ca             	mov    %rcx,%rdx
+     d1a:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     d1f:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     d27:	c9                   	leave
+     d28:	c3                   	ret
+
+0000000000000d29 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     d29:	55                   	push   %rbp
+     d2a:	48 89 e5             	mov    %rsp,%rbp
+     d2d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d31:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     d34:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     d37:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     d3b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     d3e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d41:	48 89 ce             	mov    %rcx,%rsi
+     d44:	48 89 f7             	mov    %rsi,%rdi
+     d47:	89 d1                	mov    %edx,%ecx
+     d49:	fc                   	cld
+     d4a:	f3 aa                	rep stos %al,%es:(%rdi)
+     d4c:	89 ca                	mov    %ecx,%edx
+     d4e:	48 89 fe             	mov    %rdi,%rsi
+     d51:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     d55:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     d58:	90                   	nop
+     d59:	5d                   	pop    %rbp
+     d5a:	c3                   	ret
+
+0000000000000d5b <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     d5b:	55                   	push   %rbp
+     d5c:	48 89 e5             	mov    %rsp,%rbp
+     d5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     d67:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     d6b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     d6f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     d73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d77:	48 89 ce             	mov    %rcx,%rsi
+     d7a:	48 89 f7             	mov    %rsi,%rdi
+     d7d:	48 89 d1             	mov    %rdx,%rcx
+     d80:	fc                   	cld
+     d81:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     d84:	48 89 ca             	mov    %rcx,%rdx
+     d87:	48 89 fe             	mov    %rdi,%rsi
+     d8a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     d8e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     d92:	90                   	nop
+     d93:	5d                   	pop    %rbp
+     d94:	c3                   	ret
+
+0000000000000d95 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     d95:	55                   	push   %rbp
+     d96:	48 89 e5             	mov    %rsp,%rbp
+     d99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d9d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     da1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     da5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     da9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     db1:	48 89 cf             	mov    %rcx,%rdi
+     db4:	48 89 d6             	mov    %rdx,%rsi
+     db7:	48 89 c1             	mov    %rax,%rcx
+     dba:	fc                   	cld
+     dbb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     dbd:	48 89 c8             	mov    %rcx,%rax
+     dc0:	48 89 f2             	mov    %rsi,%rdx
+     dc3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dc7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     dcb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     dcf:	90                   	nop
+     dd0:	5d                   	pop    %rbp
+     dd1:	c3                   	ret
+
+0000000000000dd2 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     dd2:	55                   	push   %rbp
+     dd3:	48 89 e5             	mov    %rsp,%rbp
+     dd6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dda:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     dde:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     de2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     de6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dee:	48 89 cf             	mov    %rcx,%rdi
+     df1:	48 89 d6             	mov    %rdx,%rsi
+     df4:	48 89 c1             	mov    %rax,%rcx
+     df7:	fc                   	cld
+     df8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     dfb:	48 89 c8             	mov    %rcx,%rax
+     dfe:	48 89 f2             	mov    %rsi,%rdx
+     e01:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e05:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     e09:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     e0d:	90                   	nop
+     e0e:	5d                   	pop    %rbp
+     e0f:	c3                   	ret
+
+0000000000000e10 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     e10:	55                   	push   %rbp
+     e11:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     e14:	0f 31                	rdtsc
+     e16:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     e19:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     e1c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     e1f:	48 c1 e0 20          	shl    $0x20,%rax
+     e23:	48 89 c2             	mov    %rax,%rdx
+     e26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e29:	48 09 d0             	or     %rdx,%rax
+}
+     e2c:	5d                   	pop    %rbp
+     e2d:	c3                   	ret
+
+0000000000000e2e <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     e2e:	55                   	push   %rbp
+     e2f:	48 89 e5             	mov    %rsp,%rbp
+     e32:	53                   	push   %rbx
+     e33:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     e36:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     e3a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     e3e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     e42:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     e46:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     e49:	0f a2                	cpuid
+     e4b:	89 de                	mov    %ebx,%esi
+     e4d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     e50:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     e53:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     e56:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     e59:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     e5e:	74 09                	je     e69 <cpuid+0x3b>
+    *eaxp = eax;
+     e60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     e64:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     e67:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     e69:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     e6e:	74 09                	je     e79 <cpuid+0x4b>
+    *ebxp = ebx;
+     e70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     e74:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     e77:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     e79:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     e7e:	74 09                	je     e89 <cpuid+0x5b>
+    *ecxp = ecx;
+     e80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     e84:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     e87:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     e89:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     e8e:	74 09                	je     e99 <cpuid+0x6b>
+    *edxp = edx;
+     e90:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     e94:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     e97:	89 10                	mov    %edx,(%rax)
+}
+     e99:	90                   	nop
+     e9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     e9e:	c9                   	leave
+     e9f:	c3                   	ret
+
+0000000000000ea0 <strcpy>:
+char *strcpy(char *s, char *t) {
+     ea0:	55                   	push   %rbp
+     ea1:	48 89 e5             	mov    %rsp,%rbp
+     ea4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ea8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     eac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     eb0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     eb4:	90                   	nop
+     eb5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     eb9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     ebd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     ec1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ec5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     ec9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     ecd:	0f b6 12             	movzbl (%rdx),%edx
+     ed0:	88 10                	mov    %dl,(%rax)
+     ed2:	0f b6 00             	movzbl (%rax),%eax
+     ed5:	84 c0                	test   %al,%al
+     ed7:	75 dc                	jne    eb5 <strcpy+0x15>
+  return os;
+     ed9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     edd:	5d                   	pop    %rbp
+     ede:	c3                   	ret
+
+0000000000000edf <strcmp>:
+int strcmp(const char *p, const char *q) {
+     edf:	55                   	push   %rbp
+     ee0:	48 89 e5             	mov    %rsp,%rbp
+     ee3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ee7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     eeb:	eb 0a                	jmp    ef7 <strcmp+0x18>
+    p++, q++;
+     eed:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     ef2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     ef7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     efb:	0f b6 00             	movzbl (%rax),%eax
+     efe:	84 c0                	test   %al,%al
+     f00:	74 12                	je     f14 <strcmp+0x35>
+     f02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f06:	0f b6 10             	movzbl (%rax),%edx
+     f09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f0d:	0f b6 00             	movzbl (%rax),%eax
+     f10:	38 c2                	cmp    %al,%dl
+     f12:	74 d9                	je     eed <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     f14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f18:	0f b6 00             	movzbl (%rax),%eax
+     f1b:	0f b6 d0             	movzbl %al,%edx
+     f1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f22:	0f b6 00             	movzbl (%rax),%eax
+     f25:	0f b6 c0             	movzbl %al,%eax
+     f28:	29 c2                	sub    %eax,%edx
+     f2a:	89 d0                	mov    %edx,%eax
+}
+     f2c:	5d                   	pop    %rbp
+     f2d:	c3                   	ret
+
+0000000000000f2e <strlen>:
+uint strlen(char *s) {
+     f2e:	55                   	push   %rbp
+     f2f:	48 89 e5             	mov    %rsp,%rbp
+     f32:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     f36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     f3d:	eb 04                	jmp    f43 <strlen+0x15>
+     f3f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     f43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f46:	48 63 d0             	movslq %eax,%rdx
+     f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f4d:	48 01 d0             	add    %rdx,%rax
+     f50:	0f b6 00             	movzbl (%rax),%eax
+     f53:	84 c0                	test   %al,%al
+     f55:	75 e8                	jne    f3f <strlen+0x11>
+    ;
+  return n;
+     f57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     f5a:	5d                   	pop    %rbp
+     f5b:	c3                   	ret
+
+0000000000000f5c <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     f5c:	55                   	push   %rbp
+     f5d:	48 89 e5             	mov    %rsp,%rbp
+     f60:	53                   	push   %rbx
+     f61:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     f65:	8b 05 c9 20 00 00    	mov    0x20c9(%rip),%eax        # 3034 <erms>
+     f6b:	85 c0                	test   %eax,%eax
+     f6d:	79 53                	jns    fc2 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     f6f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     f73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+     f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+     f83:	48 89 c6             	mov    %rax,%rsi
+     f86:	bf 00 00 00 00       	mov    $0x0,%edi
+     f8b:	e8 9e fe ff ff       	call   e2e <cpuid>
+    ebx = 0;
+     f90:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     f97:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     f9a:	83 f8 06             	cmp    $0x6,%eax
+     f9d:	76 14                	jbe    fb3 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     f9f:	b8 07 00 00 00       	mov    $0x7,%eax
+     fa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+     fa9:	0f a2                	cpuid
+     fab:	89 d9                	mov    %ebx,%ecx
+     fad:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     fb0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     fb3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fb6:	c1 e8 09             	shr    $0x9,%eax
+     fb9:	83 e0 01             	and    $0x1,%eax
+     fbc:	89 05 72 20 00 00    	mov    %eax,0x2072(%rip)        # 3034 <erms>
+  }
+  return erms;
+     fc2:	8b 05 6c 20 00 00    	mov    0x206c(%rip),%eax        # 3034 <erms>
+}
+     fc8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     fcc:	c9                   	leave
+     fcd:	c3                   	ret
+
+0000000000000fce <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     fce:	55                   	push   %rbp
+     fcf:	48 89 e5             	mov    %rsp,%rbp
+     fd2:	48 83 ec 10          	sub    $0x10,%rsp
+     fd6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fda:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     fdd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     fe0:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     fe4:	76 09                	jbe    fef <memset+0x21>
+     fe6:	e8 71 ff ff ff       	call   f5c <haserms>
+     feb:	85 c0                	test   %eax,%eax
+     fed:	74 16                	je     1005 <memset+0x37>
+    stosb(dst, c, n);
+     fef:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     ff2:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff9:	89 ce                	mov    %ecx,%esi
+     ffb:	48 89 c7             	mov    %rax,%rdi
+     ffe:	e8 26 fd ff ff       	call   d29 <stosb>
+    1003:	eb 58                	jmp    105d <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    1005:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1008:	c1 e8 03             	shr    $0x3,%eax
+    100b:	89 c6                	mov    %eax,%esi
+    100d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1010:	48 98                	cltq
+    1012:	0f b6 c0             	movzbl %al,%eax
+    1015:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    101c:	01 01 01 
+    101f:	48 0f af c2          	imul   %rdx,%rax
+    1023:	48 89 c1             	mov    %rax,%rcx
+    1026:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    102a:	48 89 f2             	mov    %rsi,%rdx
+    102d:	48 89 ce             	mov    %rcx,%rsi
+    1030:	48 89 c7             	mov    %rax,%rdi
+    1033:	e8 23 fd ff ff       	call   d5b <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    1038:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    103b:	83 e0 07             	and    $0x7,%eax
+    103e:	89 c2                	mov    %eax,%edx
+    1040:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1043:	83 e0 f8             	and    $0xfffffff8,%eax
+    1046:	48 89 c1             	mov    %rax,%rcx
+    1049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    104d:	48 01 c1             	add    %rax,%rcx
+    1050:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1053:	89 c6                	mov    %eax,%esi
+    1055:	48 89 cf             	mov    %rcx,%rdi
+    1058:	e8 cc fc ff ff       	call   d29 <stosb>
+  }
+  return dst;
+    105d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1061:	c9                   	leave
+    1062:	c3                   	ret
+
+0000000000001063 <strchr>:
+
+char *strchr(const char *s, char c) {
+    1063:	55                   	push   %rbp
+    1064:	48 89 e5             	mov    %rsp,%rbp
+    1067:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    106b:	89 f0                	mov    %esi,%eax
+    106d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1070:	eb 17                	jmp    1089 <strchr+0x26>
+    if (*s == c)
+    1072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1076:	0f b6 00             	movzbl (%rax),%eax
+    1079:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    107c:	75 06                	jne    1084 <strchr+0x21>
+      return (char *)s;
+    107e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1082:	eb 15                	jmp    1099 <strchr+0x36>
+  for (; *s; s++)
+    1084:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1089:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    108d:	0f b6 00             	movzbl (%rax),%eax
+    1090:	84 c0                	test   %al,%al
+    1092:	75 de                	jne    1072 <strchr+0xf>
+  return 0;
+    1094:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1099:	5d                   	pop    %rbp
+    109a:	c3                   	ret
+
+000000000000109b <gets>:
+
+char *gets(char *buf, int max) {
+    109b:	55                   	push   %rbp
+    109c:	48 89 e5             	mov    %rsp,%rbp
+    109f:	48 83 ec 20          	sub    $0x20,%rsp
+    10a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    10a7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    10aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10b1:	eb 48                	jmp    10fb <gets+0x60>
+    cc = read(0, &c, 1);
+    10b3:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    10b7:	ba 01 00 00 00       	mov    $0x1,%edx
+    10bc:	48 89 c6             	mov    %rax,%rsi
+    10bf:	bf 00 00 00 00       	mov    $0x0,%edi
+    10c4:	e8 b8 05 00 00       	call   1681 <read>
+    10c9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    10cc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    10d0:	7e 36                	jle    1108 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    10d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10d5:	8d 50 01             	lea    0x1(%rax),%edx
+    10d8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    10db:	48 63 d0             	movslq %eax,%rdx
+    10de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10e2:	48 01 c2             	add    %rax,%rdx
+    10e5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    10e9:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    10eb:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    10ef:	3c 0a                	cmp    $0xa,%al
+    10f1:	74 16                	je     1109 <gets+0x6e>
+    10f3:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    10f7:	3c 0d                	cmp    $0xd,%al
+    10f9:	74 0e                	je     1109 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    10fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10fe:	83 c0 01             	add    $0x1,%eax
+    1101:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1104:	7f ad                	jg     10b3 <gets+0x18>
+    1106:	eb 01                	jmp    1109 <gets+0x6e>
+      break;
+    1108:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1109:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    110c:	48 63 d0             	movslq %eax,%rdx
+    110f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1113:	48 01 d0             	add    %rdx,%rax
+    1116:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1119:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    111d:	c9                   	leave
+    111e:	c3                   	ret
+
+000000000000111f <stat>:
+
+int stat(char *n, struct stat *st) {
+    111f:	55                   	push   %rbp
+    1120:	48 89 e5             	mov    %rsp,%rbp
+    1123:	48 83 ec 10          	sub    $0x10,%rsp
+    1127:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    112b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    112f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1133:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1137:	48 89 c6             	mov    %rax,%rsi
+    113a:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    113f:	e8 58 07 00 00       	call   189c <fstatat>
+}
+    1144:	c9                   	leave
+    1145:	c3                   	ret
+
+0000000000001146 <atoi>:
+
+int atoi(const char *s) {
+    1146:	55                   	push   %rbp
+    1147:	48 89 e5             	mov    %rsp,%rbp
+    114a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    114e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1155:	eb 28                	jmp    117f <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    1157:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    115a:	89 d0                	mov    %edx,%eax
+    115c:	c1 e0 02             	shl    $0x2,%eax
+    115f:	01 d0                	add    %edx,%eax
+    1161:	01 c0                	add    %eax,%eax
+    1163:	89 c1                	mov    %eax,%ecx
+    1165:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1169:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    116d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1171:	0f b6 00             	movzbl (%rax),%eax
+    1174:	0f be c0             	movsbl %al,%eax
+    1177:	01 c8                	add    %ecx,%eax
+    1179:	83 e8 30             	sub    $0x30,%eax
+    117c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    117f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1183:	0f b6 00             	movzbl (%rax),%eax
+    1186:	3c 2f                	cmp    $0x2f,%al
+    1188:	7e 0b                	jle    1195 <atoi+0x4f>
+    118a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    118e:	0f b6 00             	movzbl (%rax),%eax
+    1191:	3c 39                	cmp    $0x39,%al
+    1193:	7e c2                	jle    1157 <atoi+0x11>
+  return n;
+    1195:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1198:	5d                   	pop    %rbp
+    1199:	c3                   	ret
+
+000000000000119a <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    119a:	55                   	push   %rbp
+    119b:	48 89 e5             	mov    %rsp,%rbp
+    119e:	48 83 ec 28          	sub    $0x28,%rsp
+    11a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    11aa:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    11ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    11b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    11b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    11bd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    11c1:	7f 09                	jg     11cc <memmove+0x32>
+    return vdst;
+    11c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11c7:	e9 29 01 00 00       	jmp    12f5 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    11cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11d0:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    11d4:	0f 83 87 00 00 00    	jae    1261 <memmove+0xc7>
+    11da:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11dd:	48 63 d0             	movslq %eax,%rdx
+    11e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11e4:	48 01 d0             	add    %rdx,%rax
+    11e7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    11eb:	73 74                	jae    1261 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    11ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11f0:	48 98                	cltq
+    11f2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    11f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11f9:	48 98                	cltq
+    11fb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    11ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1203:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1207:	48 09 d0             	or     %rdx,%rax
+    120a:	83 e0 07             	and    $0x7,%eax
+    120d:	48 85 c0             	test   %rax,%rax
+    1210:	75 3d                	jne    124f <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1212:	eb 1c                	jmp    1230 <memmove+0x96>
+        src -= 8;
+    1214:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1219:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    121e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1222:	48 8b 10             	mov    (%rax),%rdx
+    1225:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1229:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    122c:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1230:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1234:	7f de                	jg     1214 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1236:	eb 17                	jmp    124f <memmove+0xb5>
+      *--dst = *--src;
+    1238:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    123d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1242:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1246:	0f b6 10             	movzbl (%rax),%edx
+    1249:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    124d:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    124f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1252:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1255:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1258:	85 c0                	test   %eax,%eax
+    125a:	7f dc                	jg     1238 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    125c:	e9 90 00 00 00       	jmp    12f1 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1261:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1265:	7e 09                	jle    1270 <memmove+0xd6>
+    1267:	e8 f0 fc ff ff       	call   f5c <haserms>
+    126c:	85 c0                	test   %eax,%eax
+    126e:	74 1b                	je     128b <memmove+0xf1>
+    movsb(dst, src, n);
+    1270:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1273:	48 63 d0             	movslq %eax,%rdx
+    1276:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    127a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127e:	48 89 ce             	mov    %rcx,%rsi
+    1281:	48 89 c7             	mov    %rax,%rdi
+    1284:	e8 0c fb ff ff       	call   d95 <movsb>
+    1289:	eb 66                	jmp    12f1 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    128b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    128e:	8d 50 07             	lea    0x7(%rax),%edx
+    1291:	85 c0                	test   %eax,%eax
+    1293:	0f 48 c2             	cmovs  %edx,%eax
+    1296:	c1 f8 03             	sar    $0x3,%eax
+    1299:	48 63 d0             	movslq %eax,%rdx
+    129c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    12a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12a4:	48 89 ce             	mov    %rcx,%rsi
+    12a7:	48 89 c7             	mov    %rax,%rdi
+    12aa:	e8 23 fb ff ff       	call   dd2 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    12af:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    12b2:	89 d0                	mov    %edx,%eax
+    12b4:	c1 f8 1f             	sar    $0x1f,%eax
+    12b7:	c1 e8 1d             	shr    $0x1d,%eax
+    12ba:	01 c2                	add    %eax,%edx
+    12bc:	83 e2 07             	and    $0x7,%edx
+    12bf:	29 c2                	sub    %eax,%edx
+    12c1:	89 d0                	mov    %edx,%eax
+    12c3:	48 98                	cltq
+    12c5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    12c8:	83 e2 f8             	and    $0xfffffff8,%edx
+    12cb:	48 63 ca             	movslq %edx,%rcx
+    12ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    12d2:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    12d6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    12d9:	83 e2 f8             	and    $0xfffffff8,%edx
+    12dc:	48 63 ca             	movslq %edx,%rcx
+    12df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    12e3:	48 01 d1             	add    %rdx,%rcx
+    12e6:	48 89 c2             	mov    %rax,%rdx
+    12e9:	48 89 cf             	mov    %rcx,%rdi
+    12ec:	e8 a4 fa ff ff       	call   d95 <movsb>
+  }
+  return vdst;
+    12f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    12f5:	c9                   	leave
+    12f6:	c3                   	ret
+
+00000000000012f7 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    12f7:	55                   	push   %rbp
+    12f8:	48 89 e5             	mov    %rsp,%rbp
+    12fb:	48 83 ec 20          	sub    $0x20,%rsp
+    12ff:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1302:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1306:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    130d:	00 00 00 
+    1310:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1314:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1318:	75 0d                	jne    1327 <clock_gettime+0x30>
+    131a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    131e:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1322:	48 85 c0             	test   %rax,%rax
+    1325:	75 13                	jne    133a <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1327:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    132b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    132e:	48 89 d6             	mov    %rdx,%rsi
+    1331:	89 c7                	mov    %eax,%edi
+    1333:	e8 e0 04 00 00       	call   1818 <_clock_gettime>
+    1338:	eb 7d                	jmp    13b7 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    133a:	e8 d1 fa ff ff       	call   e10 <rdtsc>
+    133f:	48 89 c2             	mov    %rax,%rdx
+    1342:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1346:	48 89 d6             	mov    %rdx,%rsi
+    1349:	48 89 c7             	mov    %rax,%rdi
+    134c:	e8 7b f9 ff ff       	call   ccc <clockns>
+    1351:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1355:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1359:	48 c1 e8 09          	shr    $0x9,%rax
+    135d:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1364:	b8 44 00 
+    1367:	48 f7 e2             	mul    %rdx
+    136a:	48 89 d0             	mov    %rdx,%rax
+    136d:	48 c1 e8 0b          	shr    $0xb,%rax
+    1371:	48 89 c2             	mov    %rax,%rdx
+    1374:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1378:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    137b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    137f:	48 89 c8             	mov    %rcx,%rax
+    1382:	48 c1 e8 09          	shr    $0x9,%rax
+    1386:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    138d:	b8 44 00 
+    1390:	48 f7 e2             	mul    %rdx
+    1393:	48 89 d0             	mov    %rdx,%rax
+    1396:	48 c1 e8 0b          	shr    $0xb,%rax
+    139a:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    13a1:	48 89 c8             	mov    %rcx,%rax
+    13a4:	48 29 d0             	sub    %rdx,%rax
+    13a7:	48 89 c2             	mov    %rax,%rdx
+    13aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    13ae:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    13b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13b7:	c9                   	leave
+    13b8:	c3                   	ret
+
+00000000000013b9 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    13b9:	55                   	push   %rbp
+    13ba:	48 89 e5             	mov    %rsp,%rbp
+    13bd:	48 83 ec 10          	sub    $0x10,%rsp
+    13c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    13c5:	eb 11                	jmp    13d8 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    13c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13cb:	be 02 00 00 00       	mov    $0x2,%esi
+    13d0:	48 89 c7             	mov    %rax,%rdi
+    13d3:	e8 6c 04 00 00       	call   1844 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    13d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    13dc:	b8 02 00 00 00       	mov    $0x2,%eax
+    13e1:	87 02                	xchg   %eax,(%rdx)
+    13e3:	85 c0                	test   %eax,%eax
+    13e5:	75 e0                	jne    13c7 <mutex_wait+0xe>
+}
+    13e7:	90                   	nop
+    13e8:	90                   	nop
+    13e9:	c9                   	leave
+    13ea:	c3                   	ret
+
+00000000000013eb <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    13eb:	55                   	push   %rbp
+    13ec:	48 89 e5             	mov    %rsp,%rbp
+    13ef:	48 83 ec 20          	sub    $0x20,%rsp
+    13f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    13f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    13fe:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1402:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1406:	8b 02                	mov    (%rdx),%eax
+    1408:	b9 01 00 00 00       	mov    $0x1,%ecx
+    140d:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1411:	89 c1                	mov    %eax,%ecx
+    1413:	0f 94 c0             	sete   %al
+    1416:	84 c0                	test   %al,%al
+    1418:	75 02                	jne    141c <mutex_lock+0x31>
+    141a:	89 0a                	mov    %ecx,(%rdx)
+    141c:	83 f0 01             	xor    $0x1,%eax
+    141f:	84 c0                	test   %al,%al
+    1421:	74 0c                	je     142f <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1423:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1427:	48 89 c7             	mov    %rax,%rdi
+    142a:	e8 8a ff ff ff       	call   13b9 <mutex_wait>
+}
+    142f:	90                   	nop
+    1430:	c9                   	leave
+    1431:	c3                   	ret
+
+0000000000001432 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1432:	55                   	push   %rbp
+    1433:	48 89 e5             	mov    %rsp,%rbp
+    1436:	48 83 ec 10          	sub    $0x10,%rsp
+    143a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    143e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1442:	ba 00 00 00 00       	mov    $0x0,%edx
+    1447:	87 10                	xchg   %edx,(%rax)
+    1449:	83 fa 02             	cmp    $0x2,%edx
+    144c:	75 11                	jne    145f <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    144e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1452:	be 01 00 00 00       	mov    $0x1,%esi
+    1457:	48 89 c7             	mov    %rax,%rdi
+    145a:	e8 f0 03 00 00       	call   184f <futex_wake>
+}
+    145f:	90                   	nop
+    1460:	c9                   	leave
+    1461:	c3                   	ret
+
+0000000000001462 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1462:	55                   	push   %rbp
+    1463:	48 89 e5             	mov    %rsp,%rbp
+    1466:	48 83 ec 20          	sub    $0x20,%rsp
+    146a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    146e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1472:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1476:	48 83 c0 04          	add    $0x4,%rax
+    147a:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    147e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1482:	8b 00                	mov    (%rax),%eax
+    1484:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1487:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    148b:	48 89 c7             	mov    %rax,%rdi
+    148e:	e8 9f ff ff ff       	call   1432 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1493:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1497:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    149a:	89 d6                	mov    %edx,%esi
+    149c:	48 89 c7             	mov    %rax,%rdi
+    149f:	e8 a0 03 00 00       	call   1844 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    14a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14a8:	48 83 c0 04          	add    $0x4,%rax
+    14ac:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    14b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14b4:	48 89 c7             	mov    %rax,%rdi
+    14b7:	e8 fd fe ff ff       	call   13b9 <mutex_wait>
+}
+    14bc:	90                   	nop
+    14bd:	c9                   	leave
+    14be:	c3                   	ret
+
+00000000000014bf <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    14bf:	55                   	push   %rbp
+    14c0:	48 89 e5             	mov    %rsp,%rbp
+    14c3:	48 83 ec 10          	sub    $0x10,%rsp
+    14c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    14cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14cf:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    14d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14d7:	48 83 c0 04          	add    $0x4,%rax
+    14db:	8b 00                	mov    (%rax),%eax
+    14dd:	85 c0                	test   %eax,%eax
+    14df:	7e 11                	jle    14f2 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    14e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14e5:	be 01 00 00 00       	mov    $0x1,%esi
+    14ea:	48 89 c7             	mov    %rax,%rdi
+    14ed:	e8 5d 03 00 00       	call   184f <futex_wake>
+}
+    14f2:	90                   	nop
+    14f3:	c9                   	leave
+    14f4:	c3                   	ret
+
+00000000000014f5 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    14f5:	55                   	push   %rbp
+    14f6:	48 89 e5             	mov    %rsp,%rbp
+    14f9:	48 83 ec 10          	sub    $0x10,%rsp
+    14fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1501:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1505:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1509:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    150d:	48 83 c0 04          	add    $0x4,%rax
+    1511:	8b 00                	mov    (%rax),%eax
+    1513:	85 c0                	test   %eax,%eax
+    1515:	7e 11                	jle    1528 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1517:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    151b:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1520:	48 89 c7             	mov    %rax,%rdi
+    1523:	e8 27 03 00 00       	call   184f <futex_wake>
+}
+    1528:	90                   	nop
+    1529:	c9                   	leave
+    152a:	c3                   	ret
+
+000000000000152b <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    152b:	55                   	push   %rbp
+    152c:	48 89 e5             	mov    %rsp,%rbp
+    152f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1533:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1536:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    153a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    153e:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1542:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1546:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    154a:	8b 40 04             	mov    0x4(%rax),%eax
+    154d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1550:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1554:	8b 00                	mov    (%rax),%eax
+    1556:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1559:	29 c2                	sub    %eax,%edx
+    155b:	83 fa 1f             	cmp    $0x1f,%edx
+    155e:	76 07                	jbe    1567 <ring_push+0x3c>
+    return -1;
+    1560:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1565:	eb 7e                	jmp    15e5 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1567:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    156a:	83 e0 1f             	and    $0x1f,%eax
+    156d:	89 c2                	mov    %eax,%edx
+    156f:	48 89 d0             	mov    %rdx,%rax
+    1572:	48 01 c0             	add    %rax,%rax
+    1575:	48 01 d0             	add    %rdx,%rax
+    1578:	48 c1 e0 04          	shl    $0x4,%rax
+    157c:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1580:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1584:	48 01 d0             	add    %rdx,%rax
+    1587:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    158b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    158f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1592:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1594:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1598:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    159c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    15a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    15a8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    15ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15b0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    15b4:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    15b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    15c0:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    15c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15c8:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    15cc:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    15d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15d3:	8d 50 01             	lea    0x1(%rax),%edx
+    15d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15da:	48 83 c0 04          	add    $0x4,%rax
+    15de:	89 10                	mov    %edx,(%rax)
+  return 0;
+    15e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    15e5:	5d                   	pop    %rbp
+    15e6:	c3                   	ret
+
+00000000000015e7 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    15e7:	55                   	push   %rbp
+    15e8:	48 89 e5             	mov    %rsp,%rbp
+    15eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    15f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15f7:	8b 40 08             	mov    0x8(%rax),%eax
+    15fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    15fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1601:	48 83 c0 0c          	add    $0xc,%rax
+    1605:	8b 00                	mov    (%rax),%eax
+    1607:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    160a:	75 07                	jne    1613 <ring_pop+0x2c>
+    return -1;
+    160c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1611:	eb 40                	jmp    1653 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1613:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1616:	83 e0 1f             	and    $0x1f,%eax
+    1619:	89 c2                	mov    %eax,%edx
+    161b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    161f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1623:	89 d2                	mov    %edx,%edx
+    1625:	48 83 c2 61          	add    $0x61,%rdx
+    1629:	48 c1 e2 04          	shl    $0x4,%rdx
+    162d:	48 01 d0             	add    %rdx,%rax
+    1630:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1634:	48 8b 00             	mov    (%rax),%rax
+    1637:	48 89 01             	mov    %rax,(%rcx)
+    163a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    163e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1641:	8d 50 01             	lea    0x1(%rax),%edx
+    1644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1648:	48 83 c0 08          	add    $0x8,%rax
+    164c:	89 10                	mov    %edx,(%rax)
+  return 0;
+    164e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1653:	5d                   	pop    %rbp
+    1654:	c3                   	ret
+
+0000000000001655 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1655:	b8 01 00 00 00       	mov    $0x1,%eax
+    165a:	49 89 ca             	mov    %rcx,%r10
+    165d:	0f 05                	syscall
+    165f:	c3                   	ret
+
+0000000000001660 <_exit>:
+SYSCALL_(exit)
+    1660:	b8 02 00 00 00       	mov    $0x2,%eax
+    1665:	49 89 ca             	mov    %rcx,%r10
+    1668:	0f 05                	syscall
+    166a:	c3                   	ret
+
+000000000000166b <wait>:
+SYSCALL(wait)
+    166b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1670:	49 89 ca             	mov    %rcx,%r10
+    1673:	0f 05                	syscall
+    1675:	c3                   	ret
+
+0000000000001676 <pipe>:
+SYSCALL(pipe)
+    1676:	b8 04 00 00 00       	mov    $0x4,%eax
+    167b:	49 89 ca             	mov    %rcx,%r10
+    167e:	0f 05                	syscall
+    1680:	c3                   	ret
+
+0000000000001681 <read>:
+SYSCALL(read)
+    1681:	b8 05 00 00 00       	mov    $0x5,%eax
+    1686:	49 89 ca             	mov    %rcx,%r10
+    1689:	0f 05                	syscall
+    168b:	c3                   	ret
+
+000000000000168c <write>:
+SYSCALL(write)
+    168c:	b8 10 00 00 00       	mov    $0x10,%eax
+    1691:	49 89 ca             	mov    %rcx,%r10
+    1694:	0f 05                	syscall
+    1696:	c3                   	ret
+
+0000000000001697 <_close>:
+SYSCALL_(close)
+    1697:	b8 15 00 00 00       	mov    $0x15,%eax
+    169c:	49 89 ca             	mov    %rcx,%r10
+    169f:	0f 05                	syscall
+    16a1:	c3                   	ret
+
+00000000000016a2 <kill>:
+SYSCALL(kill)
+    16a2:	b8 06 00 00 00       	mov    $0x6,%eax
+    16a7:	49 89 ca             	mov    %rcx,%r10
+    16aa:	0f 05                	syscall
+    16ac:	c3                   	ret
+
+00000000000016ad <_exec>:
+SYSCALL_(exec)
+    16ad:	b8 07 00 00 00       	mov    $0x7,%eax
+    16b2:	49 89 ca             	mov    %rcx,%r10
+    16b5:	0f 05                	syscall
+    16b7:	c3                   	ret
+
+00000000000016b8 <open>:
+SYSCALL(open)
+    16b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    16bd:	49 89 ca             	mov    %rcx,%r10
+    16c0:	0f 05                	syscall
+    16c2:	c3                   	ret
+
+00000000000016c3 <mknod>:
+SYSCALL(mknod)
+    16c3:	b8 11 00 00 00       	mov    $0x11,%eax
+    16c8:	49 89 ca             	mov    %rcx,%r10
+    16cb:	0f 05                	syscall
+    16cd:	c3                   	ret
+
+00000000000016ce <unlink>:
+SYSCALL(unlink)
+    16ce:	b8 12 00 00 00       	mov    $0x12,%eax
+    16d3:	49 89 ca             	mov    %rcx,%r10
+    16d6:	0f 05                	syscall
+    16d8:	c3                   	ret
+
+00000000000016d9 <fstat>:
+SYSCALL(fstat)
+    16d9:	b8 08 00 00 00       	mov    $0x8,%eax
+    16de:	49 89 ca             	mov    %rcx,%r10
+    16e1:	0f 05                	syscall
+    16e3:	c3                   	ret
+
+00000000000016e4 <link>:
+SYSCALL(link)
+    16e4:	b8 13 00 00 00       	mov    $0x13,%eax
+    16e9:	49 89 ca             	mov    %rcx,%r10
+    16ec:	0f 05                	syscall
+    16ee:	c3                   	ret
+
+00000000000016ef <mkdir>:
+SYSCALL(mkdir)
+    16ef:	b8 14 00 00 00       	mov    $0x14,%eax
+    16f4:	49 89 ca             	mov    %rcx,%r10
+    16f7:	0f 05                	syscall
+    16f9:	c3                   	ret
+
+00000000000016fa <chdir>:
+SYSCALL(chdir)
+    16fa:	b8 09 00 00 00       	mov    $0x9,%eax
+    16ff:	49 89 ca             	mov    %rcx,%r10
+    1702:	0f 05                	syscall
+    1704:	c3                   	ret
+
+0000000000001705 <dup>:
+SYSCALL(dup)
+    1705:	b8 0a 00 00 00       	mov    $0xa,%eax
+    170a:	49 89 ca             	mov    %rcx,%r10
+    170d:	0f 05                	syscall
+    170f:	c3                   	ret
+
+0000000000001710 <getpid>:
+SYSCALL(getpid)
+    1710:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1715:	49 89 ca             	mov    %rcx,%r10
+    1718:	0f 05                	syscall
+    171a:	c3                   	ret
+
+000000000000171b <sbrk>:
+SYSCALL(sbrk)
+    171b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1720:	49 89 ca             	mov    %rcx,%r10
+    1723:	0f 05                	syscall
+    1725:	c3                   	ret
+
+0000000000001726 <sleep>:
+SYSCALL(sleep)
+    1726:	b8 0d 00 00 00       	mov    $0xd,%eax
+    172b:	49 89 ca             	mov    %rcx,%r10
+    172e:	0f 05                	syscall
+    1730:	c3                   	ret
+
+0000000000001731 <uptime>:
+SYSCALL(uptime)
+    1731:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1736:	49 89 ca             	mov    %rcx,%r10
+    1739:	0f 05                	syscall
+    173b:	c3                   	ret
+
+000000000000173c <sysinfo>:
+SYSCALL(sysinfo)
+    173c:	b8 16 00 00 00       	mov    $0x16,%eax
+    1741:	49 89 ca             	mov    %rcx,%r10
+    1744:	0f 05                	syscall
+    1746:	c3                   	ret
+
+0000000000001747 <crashn>:
+SYSCALL(crashn)
+    1747:	b8 17 00 00 00       	mov    $0x17,%eax
+    174c:	49 89 ca             	mov    %rcx,%r10
+    174f:	0f 05                	syscall
+    1751:	c3                   	ret
+
+0000000000001752 <mmap>:
+SYSCALL(mmap)
+    1752:	b8 18 00 00 00       	mov    $0x18,%eax
+    1757:	49 89 ca             	mov    %rcx,%r10
+    175a:	0f 05                	syscall
+    175c:	c3                   	ret
+
+000000000000175d <munmap>:
+SYSCALL(munmap)
+    175d:	b8 19 00 00 00       	mov    $0x19,%eax
+    1762:	49 89 ca             	mov    %rcx,%r10
+    1765:	0f 05                	syscall
+    1767:	c3                   	ret
+
+0000000000001768 <nice>:
+SYSCALL(nice)
+    1768:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    176d:	49 89 ca             	mov    %rcx,%r10
+    1770:	0f 05                	syscall
+    1772:	c3                   	ret
+
+0000000000001773 <_spawn>:
+SYSCALL_(spawn)
+    1773:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1778:	49 89 ca             	mov    %rcx,%r10
+    177b:	0f 05                	syscall
+    177d:	c3                   	ret
+
+000000000000177e <pread>:
+SYSCALL(pread)
+    177e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1783:	49 89 ca             	mov    %rcx,%r10
+    1786:	0f 05                	syscall
+    1788:	c3                   	ret
+
+0000000000001789 <pwrite>:
+SYSCALL(pwrite)
+    1789:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    178e:	49 89 ca             	mov    %rcx,%r10
+    1791:	0f 05                	syscall
+    1793:	c3                   	ret
+
+0000000000001794 <readv>:
+SYSCALL(readv)
+    1794:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1799:	49 89 ca             	mov    %rcx,%r10
+    179c:	0f 05                	syscall
+    179e:	c3                   	ret
+
+000000000000179f <writev>:
+SYSCALL(writev)
+    179f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    17a4:	49 89 ca             	mov    %rcx,%r10
+    17a7:	0f 05                	syscall
+    17a9:	c3                   	ret
+
+00000000000017aa <sendfile>:
+SYSCALL(sendfile)
+    17aa:	b8 20 00 00 00       	mov    $0x20,%eax
+    17af:	49 89 ca             	mov    %rcx,%r10
+    17b2:	0f 05                	syscall
+    17b4:	c3                   	ret
+
+00000000000017b5 <splice>:
+SYSCALL(splice)
+    17b5:	b8 21 00 00 00       	mov    $0x21,%eax
+    17ba:	49 89 ca             	mov    %rcx,%r10
+    17bd:	0f 05                	syscall
+    17bf:	c3                   	ret
+
+00000000000017c0 <poll>:
+SYSCALL(poll)
+    17c0:	b8 22 00 00 00       	mov    $0x22,%eax
+    17c5:	49 89 ca             	mov    %rcx,%r10
+    17c8:	0f 05                	syscall
+    17ca:	c3                   	ret
+
+00000000000017cb <fsync>:
+SYSCALL(fsync)
+    17cb:	b8 23 00 00 00       	mov    $0x23,%eax
+    17d0:	49 89 ca             	mov    %rcx,%r10
+    17d3:	0f 05                	syscall
+    17d5:	c3                   	ret
+
+00000000000017d6 <fdatasync>:
+SYSCALL(fdatasync)
+    17d6:	b8 24 00 00 00       	mov    $0x24,%eax
+    17db:	49 89 ca             	mov    %rcx,%r10
+    17de:	0f 05                	syscall
+    17e0:	c3                   	ret
+
+00000000000017e1 <lockstat>:
+SYSCALL(lockstat)
+    17e1:	b8 25 00 00 00       	mov    $0x25,%eax
+    17e6:	49 89 ca             	mov    %rcx,%r10
+    17e9:	0f 05                	syscall
+    17eb:	c3                   	ret
+
+00000000000017ec <syscallstat>:
+SYSCALL(syscallstat)
+    17ec:	b8 26 00 00 00       	mov    $0x26,%eax
+    17f1:	49 89 ca             	mov    %rcx,%r10
+    17f4:	0f 05                	syscall
+    17f6:	c3                   	ret
+
+00000000000017f7 <trace>:
+SYSCALL(trace)
+    17f7:	b8 27 00 00 00       	mov    $0x27,%eax
+    17fc:	49 89 ca             	mov    %rcx,%r10
+    17ff:	0f 05                	syscall
+    1801:	c3                   	ret
+
+0000000000001802 <profile>:
+SYSCALL(profile)
+    1802:	b8 28 00 00 00       	mov    $0x28,%eax
+    1807:	49 89 ca             	mov    %rcx,%r10
+    180a:	0f 05                	syscall
+    180c:	c3                   	ret
+
+000000000000180d <cycles>:
+SYSCALL(cycles)
+    180d:	b8 29 00 00 00       	mov    $0x29,%eax
+    1812:	49 89 ca             	mov    %rcx,%r10
+    1815:	0f 05                	syscall
+    1817:	c3                   	ret
+
+0000000000001818 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1818:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    181d:	49 89 ca             	mov    %rcx,%r10
+    1820:	0f 05                	syscall
+    1822:	c3                   	ret
+
+0000000000001823 <consmode>:
+SYSCALL(consmode)
+    1823:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1828:	49 89 ca             	mov    %rcx,%r10
+    182b:	0f 05                	syscall
+    182d:	c3                   	ret
+
+000000000000182e <clone>:
+SYSCALL(clone)
+    182e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1833:	49 89 ca             	mov    %rcx,%r10
+    1836:	0f 05                	syscall
+    1838:	c3                   	ret
+
+0000000000001839 <join>:
+SYSCALL(join)
+    1839:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    183e:	49 89 ca             	mov    %rcx,%r10
+    1841:	0f 05                	syscall
+    1843:	c3                   	ret
+
+0000000000001844 <futex_wait>:
+SYSCALL(futex_wait)
+    1844:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1849:	49 89 ca             	mov    %rcx,%r10
+    184c:	0f 05                	syscall
+    184e:	c3                   	ret
+
+000000000000184f <futex_wake>:
+SYSCALL(futex_wake)
+    184f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1854:	49 89 ca             	mov    %rcx,%r10
+    1857:	0f 05                	syscall
+    1859:	c3                   	ret
+
+000000000000185a <shmget>:
+SYSCALL(shmget)
+    185a:	b8 30 00 00 00       	mov    $0x30,%eax
+    185f:	49 89 ca             	mov    %rcx,%r10
+    1862:	0f 05                	syscall
+    1864:	c3                   	ret
+
+0000000000001865 <shmat>:
+SYSCALL(shmat)
+    1865:	b8 31 00 00 00       	mov    $0x31,%eax
+    186a:	49 89 ca             	mov    %rcx,%r10
+    186d:	0f 05                	syscall
+    186f:	c3                   	ret
+
+0000000000001870 <shmdt>:
+SYSCALL(shmdt)
+    1870:	b8 32 00 00 00       	mov    $0x32,%eax
+    1875:	49 89 ca             	mov    %rcx,%r10
+    1878:	0f 05                	syscall
+    187a:	c3                   	ret
+
+000000000000187b <ring_setup>:
+SYSCALL(ring_setup)
+    187b:	b8 33 00 00 00       	mov    $0x33,%eax
+    1880:	49 89 ca             	mov    %rcx,%r10
+    1883:	0f 05                	syscall
+    1885:	c3                   	ret
+
+0000000000001886 <ring_enter>:
+SYSCALL(ring_enter)
+    1886:	b8 34 00 00 00       	mov    $0x34,%eax
+    188b:	49 89 ca             	mov    %rcx,%r10
+    188e:	0f 05                	syscall
+    1890:	c3                   	ret
+
+0000000000001891 <getdents>:
+SYSCALL(getdents)
+    1891:	b8 35 00 00 00       	mov    $0x35,%eax
+    1896:	49 89 ca             	mov    %rcx,%r10
+    1899:	0f 05                	syscall
+    189b:	c3                   	ret
+
+000000000000189c <fstatat>:
+SYSCALL(fstatat)
+    189c:	b8 36 00 00 00       	mov    $0x36,%eax
+    18a1:	49 89 ca             	mov    %rcx,%r10
+    18a4:	0f 05                	syscall
+    18a6:	c3                   	ret
+
+00000000000018a7 <clone_file>:
+SYSCALL(clone_file)
+    18a7:	b8 37 00 00 00       	mov    $0x37,%eax
+    18ac:	49 89 ca             	mov    %rcx,%r10
+    18af:	0f 05                	syscall
+    18b1:	c3                   	ret
+
+00000000000018b2 <fpunch>:
+SYSCALL(fpunch)
+    18b2:	b8 38 00 00 00       	mov    $0x38,%eax
+    18b7:	49 89 ca             	mov    %rcx,%r10
+    18ba:	0f 05                	syscall
+    18bc:	c3                   	ret
+
+00000000000018bd <defrag>:
+SYSCALL(defrag)
+    18bd:	b8 39 00 00 00       	mov    $0x39,%eax
+    18c2:	49 89 ca             	mov    %rcx,%r10
+    18c5:	0f 05                	syscall
+    18c7:	c3                   	ret
+
+00000000000018c8 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    18c8:	55                   	push   %rbp
+    18c9:	48 89 e5             	mov    %rsp,%rbp
+    18cc:	48 83 ec 20          	sub    $0x20,%rsp
+    18d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    18d4:	bf 00 00 00 00       	mov    $0x0,%edi
+    18d9:	e8 3d fe ff ff       	call   171b <sbrk>
+    18de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    18e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e6:	48 f7 d8             	neg    %rax
+    18e9:	25 ff 0f 00 00       	and    $0xfff,%eax
+    18ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    18f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    18f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18fa:	48 01 c2             	add    %rax,%rdx
+    18fd:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1902:	48 39 c2             	cmp    %rax,%rdx
+    1905:	73 1e                	jae    1925 <morecore+0x5d>
+    1907:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    190b:	89 c2                	mov    %eax,%edx
+    190d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1911:	01 d0                	add    %edx,%eax
+    1913:	89 c7                	mov    %eax,%edi
+    1915:	e8 01 fe ff ff       	call   171b <sbrk>
+    191a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    191e:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1923:	75 07                	jne    192c <morecore+0x64>
+    return 0;
+    1925:	b8 00 00 00 00       	mov    $0x0,%eax
+    192a:	eb 27                	jmp    1953 <morecore+0x8b>
+  stats.heap += n + pad;
+    192c:	48 8b 05 3d 28 00 00 	mov    0x283d(%rip),%rax        # 4170 <stats+0x50>
+    1933:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1937:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    193b:	48 01 ca             	add    %rcx,%rdx
+    193e:	48 01 d0             	add    %rdx,%rax
+    1941:	48 89 05 28 28 00 00 	mov    %rax,0x2828(%rip)        # 4170 <stats+0x50>
+  return p + pad;
+    1948:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    194c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1950:	48 01 d0             	add    %rdx,%rax
+}
+    1953:	c9                   	leave
+    1954:	c3                   	ret
+
+0000000000001955 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1955:	55                   	push   %rbp
+    1956:	48 89 e5             	mov    %rsp,%rbp
+    1959:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    195d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1961:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1968:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1969:	48 8d 05 90 27 00 00 	lea    0x2790(%rip),%rax        # 4100 <runs>
+    1970:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1974:	eb 1a                	jmp    1990 <pagefree+0x3b>
+    prev = *rp;
+    1976:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    197a:	48 8b 00             	mov    (%rax),%rax
+    197d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1981:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1985:	48 8b 00             	mov    (%rax),%rax
+    1988:	48 83 c0 08          	add    $0x8,%rax
+    198c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1990:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1994:	48 8b 00             	mov    (%rax),%rax
+    1997:	48 85 c0             	test   %rax,%rax
+    199a:	74 0d                	je     19a9 <pagefree+0x54>
+    199c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a0:	48 8b 00             	mov    (%rax),%rax
+    19a3:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    19a7:	72 cd                	jb     1976 <pagefree+0x21>
+  r = (struct run *)p;
+    19a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    19ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    19b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19b5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    19b9:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    19bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c0:	48 8b 10             	mov    (%rax),%rdx
+    19c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19c7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    19cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19cf:	48 8b 40 08          	mov    0x8(%rax),%rax
+    19d3:	48 85 c0             	test   %rax,%rax
+    19d6:	74 48                	je     1a20 <pagefree+0xcb>
+    19d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    19dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    19e0:	48 01 c2             	add    %rax,%rdx
+    19e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19e7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    19eb:	48 39 c2             	cmp    %rax,%rdx
+    19ee:	75 30                	jne    1a20 <pagefree+0xcb>
+    r->size += r->next->size;
+    19f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19f4:	48 8b 10             	mov    (%rax),%rdx
+    19f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+    19ff:	48 8b 00             	mov    (%rax),%rax
+    1a02:	48 01 c2             	add    %rax,%rdx
+    1a05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a09:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1a0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a10:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1a14:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a1c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1a20:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1a25:	74 46                	je     1a6d <pagefree+0x118>
+    1a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a2b:	48 8b 10             	mov    (%rax),%rdx
+    1a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a32:	48 01 d0             	add    %rdx,%rax
+    1a35:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1a39:	75 32                	jne    1a6d <pagefree+0x118>
+    prev->size += r->size;
+    1a3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a3f:	48 8b 10             	mov    (%rax),%rdx
+    1a42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a46:	48 8b 00             	mov    (%rax),%rax
+    1a49:	48 01 c2             	add    %rax,%rdx
+    1a4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a50:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1a53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a57:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1a5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a5f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1a63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a67:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1a6b:	eb 0c                	jmp    1a79 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1a6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a71:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a75:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1a78:	90                   	nop
+    1a79:	90                   	nop
+    1a7a:	5d                   	pop    %rbp
+    1a7b:	c3                   	ret
+
+0000000000001a7c <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1a7c:	55                   	push   %rbp
+    1a7d:	48 89 e5             	mov    %rsp,%rbp
+    1a80:	48 83 ec 40          	sub    $0x40,%rsp
+    1a84:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1a88:	48 8d 05 71 26 00 00 	lea    0x2671(%rip),%rax        # 4100 <runs>
+    1a8f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a93:	eb 66                	jmp    1afb <pagealloc+0x7f>
+    if (r->size == n) {
+    1a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a99:	48 8b 00             	mov    (%rax),%rax
+    1a9c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1aa0:	75 18                	jne    1aba <pagealloc+0x3e>
+      *rp = r->next;
+    1aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aa6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1aaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aae:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1ab1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ab5:	e9 ca 00 00 00       	jmp    1b84 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1aba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1abe:	48 8b 00             	mov    (%rax),%rax
+    1ac1:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1ac5:	73 28                	jae    1aef <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1ac7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1acb:	48 8b 00             	mov    (%rax),%rax
+    1ace:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1ad2:	48 89 c2             	mov    %rax,%rdx
+    1ad5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad9:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1adc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae0:	48 8b 10             	mov    (%rax),%rdx
+    1ae3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae7:	48 01 d0             	add    %rdx,%rax
+    1aea:	e9 95 00 00 00       	jmp    1b84 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1aef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1af3:	48 83 c0 08          	add    $0x8,%rax
+    1af7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1afb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aff:	48 8b 00             	mov    (%rax),%rax
+    1b02:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b06:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1b0b:	75 88                	jne    1a95 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1b0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b11:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1b15:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1b1c:	00 
+    1b1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1b21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b25:	48 39 c2             	cmp    %rax,%rdx
+    1b28:	48 0f 43 c2          	cmovae %rdx,%rax
+    1b2c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1b30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b34:	48 89 c7             	mov    %rax,%rdi
+    1b37:	e8 8c fd ff ff       	call   18c8 <morecore>
+    1b3c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1b40:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1b45:	75 07                	jne    1b4e <pagealloc+0xd2>
+    return 0;
+    1b47:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b4c:	eb 36                	jmp    1b84 <pagealloc+0x108>
+  if (m > n)
+    1b4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b52:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1b56:	73 1a                	jae    1b72 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1b58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b5c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1b60:	48 89 c2             	mov    %rax,%rdx
+    1b63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b67:	48 89 d6             	mov    %rdx,%rsi
+    1b6a:	48 89 c7             	mov    %rax,%rdi
+    1b6d:	e8 e3 fd ff ff       	call   1955 <pagefree>
+  return p + m - n;
+    1b72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b76:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1b7a:	48 89 c2             	mov    %rax,%rdx
+    1b7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b81:	48 01 d0             	add    %rdx,%rax
+}
+    1b84:	c9                   	leave
+    1b85:	c3                   	ret
+
+0000000000001b86 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1b86:	55                   	push   %rbp
+    1b87:	48 89 e5             	mov    %rsp,%rbp
+    1b8a:	48 83 ec 30          	sub    $0x30,%rsp
+    1b8e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1b91:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1b96:	e8 e1 fe ff ff       	call   1a7c <pagealloc>
+    1b9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b9f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ba4:	75 0a                	jne    1bb0 <refill+0x2a>
+    return -1;
+    1ba6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1bab:	e9 da 00 00 00       	jmp    1c8a <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1bb0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1bb7:	00 
+    1bb8:	e9 ba 00 00 00       	jmp    1c77 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1bbd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1bc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bc5:	48 01 d0             	add    %rdx,%rax
+    1bc8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1bcc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bcf:	ba 20 00 00 00       	mov    $0x20,%edx
+    1bd4:	89 c1                	mov    %eax,%ecx
+    1bd6:	48 d3 e2             	shl    %cl,%rdx
+    1bd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bdd:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1be0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1be3:	48 63 d0             	movslq %eax,%rdx
+    1be6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bea:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1bee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bf1:	48 98                	cltq
+    1bf3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1bfa:	00 
+    1bfb:	48 8d 05 be 24 00 00 	lea    0x24be(%rip),%rax        # 40c0 <freelist>
+    1c02:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1c06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c0a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1c0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c11:	48 98                	cltq
+    1c13:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1c1a:	00 
+    1c1b:	48 8d 15 9e 24 00 00 	lea    0x249e(%rip),%rdx        # 40c0 <freelist>
+    1c22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c26:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1c2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c2d:	48 98                	cltq
+    1c2f:	48 83 c0 08          	add    $0x8,%rax
+    1c33:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c3a:	00 
+    1c3b:	48 8d 05 e2 24 00 00 	lea    0x24e2(%rip),%rax        # 4124 <stats+0x4>
+    1c42:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c45:	8d 48 01             	lea    0x1(%rax),%ecx
+    1c48:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c4b:	48 98                	cltq
+    1c4d:	48 83 c0 08          	add    $0x8,%rax
+    1c51:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c58:	00 
+    1c59:	48 8d 05 c4 24 00 00 	lea    0x24c4(%rip),%rax        # 4124 <stats+0x4>
+    1c60:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1c63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c66:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c6b:	89 c1                	mov    %eax,%ecx
+    1c6d:	48 d3 e2             	shl    %cl,%rdx
+    1c70:	48 89 d0             	mov    %rdx,%rax
+    1c73:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1c77:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1c7e:	00 
+    1c7f:	0f 86 38 ff ff ff    	jbe    1bbd <refill+0x37>
+  }
+  return 0;
+    1c85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1c8a:	c9                   	leave
+    1c8b:	c3                   	ret
+
+0000000000001c8c <malloc>:
+
+void *malloc(uint nbytes) {
+    1c8c:	55                   	push   %rbp
+    1c8d:	48 89 e5             	mov    %rsp,%rbp
+    1c90:	48 83 ec 30          	sub    $0x30,%rsp
+    1c94:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1c97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c9a:	48 83 c0 10          	add    $0x10,%rax
+    1c9e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1ca2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1ca9:	eb 04                	jmp    1caf <malloc+0x23>
+    1cab:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1caf:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1cb3:	7f 16                	jg     1ccb <malloc+0x3f>
+    1cb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cb8:	ba 20 00 00 00       	mov    $0x20,%edx
+    1cbd:	89 c1                	mov    %eax,%ecx
+    1cbf:	48 d3 e2             	shl    %cl,%rdx
+    1cc2:	48 89 d0             	mov    %rdx,%rax
+    1cc5:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1cc9:	72 e0                	jb     1cab <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1ccb:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1ccf:	75 7d                	jne    1d4e <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1cd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cd5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1cdb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1ce1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1ce5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ce9:	48 89 c7             	mov    %rax,%rdi
+    1cec:	e8 8b fd ff ff       	call   1a7c <pagealloc>
+    1cf1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1cf5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1cfa:	75 0a                	jne    1d06 <malloc+0x7a>
+      return 0;
+    1cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d01:	e9 2c 01 00 00       	jmp    1e32 <malloc+0x1a6>
+    h->size = n;
+    1d06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d0a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d0e:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1d11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d15:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1d1c:	00 
+    stats.inuse[LARGE]++;
+    1d1d:	8b 05 1d 24 00 00    	mov    0x241d(%rip),%eax        # 4140 <stats+0x20>
+    1d23:	83 c0 01             	add    $0x1,%eax
+    1d26:	89 05 14 24 00 00    	mov    %eax,0x2414(%rip)        # 4140 <stats+0x20>
+    stats.large += n;
+    1d2c:	48 8b 15 35 24 00 00 	mov    0x2435(%rip),%rdx        # 4168 <stats+0x48>
+    1d33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d37:	48 01 d0             	add    %rdx,%rax
+    1d3a:	48 89 05 27 24 00 00 	mov    %rax,0x2427(%rip)        # 4168 <stats+0x48>
+    return h + 1;
+    1d41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d45:	48 83 c0 10          	add    $0x10,%rax
+    1d49:	e9 e4 00 00 00       	jmp    1e32 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1d4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d51:	48 98                	cltq
+    1d53:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d5a:	00 
+    1d5b:	48 8d 05 5e 23 00 00 	lea    0x235e(%rip),%rax        # 40c0 <freelist>
+    1d62:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1d66:	48 85 c0             	test   %rax,%rax
+    1d69:	75 18                	jne    1d83 <malloc+0xf7>
+    1d6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d6e:	89 c7                	mov    %eax,%edi
+    1d70:	e8 11 fe ff ff       	call   1b86 <refill>
+    1d75:	85 c0                	test   %eax,%eax
+    1d77:	79 0a                	jns    1d83 <malloc+0xf7>
+    return 0;
+    1d79:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d7e:	e9 af 00 00 00       	jmp    1e32 <malloc+0x1a6>
+  b = freelist[c];
+    1d83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d86:	48 98                	cltq
+    1d88:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d8f:	00 
+    1d90:	48 8d 05 29 23 00 00 	lea    0x2329(%rip),%rax        # 40c0 <freelist>
+    1d97:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1d9b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1d9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1da3:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1da7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1daa:	48 63 d2             	movslq %edx,%rdx
+    1dad:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1db4:	00 
+    1db5:	48 8d 15 04 23 00 00 	lea    0x2304(%rip),%rdx        # 40c0 <freelist>
+    1dbc:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1dc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dc3:	48 98                	cltq
+    1dc5:	48 83 c0 08          	add    $0x8,%rax
+    1dc9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1dd0:	00 
+    1dd1:	48 8d 05 4c 23 00 00 	lea    0x234c(%rip),%rax        # 4124 <stats+0x4>
+    1dd8:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ddb:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1dde:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1de1:	48 98                	cltq
+    1de3:	48 83 c0 08          	add    $0x8,%rax
+    1de7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1dee:	00 
+    1def:	48 8d 05 2e 23 00 00 	lea    0x232e(%rip),%rax        # 4124 <stats+0x4>
+    1df6:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1df9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dfc:	48 98                	cltq
+    1dfe:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e05:	00 
+    1e06:	48 8d 05 13 23 00 00 	lea    0x2313(%rip),%rax        # 4120 <stats>
+    1e0d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e10:	8d 48 01             	lea    0x1(%rax),%ecx
+    1e13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e16:	48 98                	cltq
+    1e18:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e1f:	00 
+    1e20:	48 8d 05 f9 22 00 00 	lea    0x22f9(%rip),%rax        # 4120 <stats>
+    1e27:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1e2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e2e:	48 83 c0 10          	add    $0x10,%rax
+}
+    1e32:	c9                   	leave
+    1e33:	c3                   	ret
+
+0000000000001e34 <free>:
+
+void free(void *ap) {
+    1e34:	55                   	push   %rbp
+    1e35:	48 89 e5             	mov    %rsp,%rbp
+    1e38:	48 83 ec 18          	sub    $0x18,%rsp
+    1e3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1e40:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1e45:	0f 84 03 01 00 00    	je     1f4e <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1e4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e4f:	48 83 e8 10          	sub    $0x10,%rax
+    1e53:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1e57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e5b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e5f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1e63:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1e68:	75 42                	jne    1eac <free+0x78>
+    stats.inuse[LARGE]--;
+    1e6a:	8b 05 d0 22 00 00    	mov    0x22d0(%rip),%eax        # 4140 <stats+0x20>
+    1e70:	83 e8 01             	sub    $0x1,%eax
+    1e73:	89 05 c7 22 00 00    	mov    %eax,0x22c7(%rip)        # 4140 <stats+0x20>
+    stats.large -= b->h.size;
+    1e79:	48 8b 15 e8 22 00 00 	mov    0x22e8(%rip),%rdx        # 4168 <stats+0x48>
+    1e80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e84:	48 8b 00             	mov    (%rax),%rax
+    1e87:	48 29 c2             	sub    %rax,%rdx
+    1e8a:	48 89 15 d7 22 00 00 	mov    %rdx,0x22d7(%rip)        # 4168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1e91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e95:	48 8b 10             	mov    (%rax),%rdx
+    1e98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e9c:	48 89 d6             	mov    %rdx,%rsi
+    1e9f:	48 89 c7             	mov    %rax,%rdi
+    1ea2:	e8 ae fa ff ff       	call   1955 <pagefree>
+    return;
+    1ea7:	e9 a3 00 00 00       	jmp    1f4f <free+0x11b>
+  }
+  b->next = freelist[c];
+    1eac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eb0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1eb7:	00 
+    1eb8:	48 8d 05 01 22 00 00 	lea    0x2201(%rip),%rax        # 40c0 <freelist>
+    1ebf:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1ec3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ec7:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1ecb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ecf:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1ed6:	00 
+    1ed7:	48 8d 15 e2 21 00 00 	lea    0x21e2(%rip),%rdx        # 40c0 <freelist>
+    1ede:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ee2:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1ee6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eea:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ef1:	00 
+    1ef2:	48 8d 05 27 22 00 00 	lea    0x2227(%rip),%rax        # 4120 <stats>
+    1ef9:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1efc:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1eff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f03:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f0a:	00 
+    1f0b:	48 8d 05 0e 22 00 00 	lea    0x220e(%rip),%rax        # 4120 <stats>
+    1f12:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1f15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f19:	48 83 c0 08          	add    $0x8,%rax
+    1f1d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f24:	00 
+    1f25:	48 8d 05 f8 21 00 00 	lea    0x21f8(%rip),%rax        # 4124 <stats+0x4>
+    1f2c:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1f2f:	8d 48 01             	lea    0x1(%rax),%ecx
+    1f32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f36:	48 83 c0 08          	add    $0x8,%rax
+    1f3a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f41:	00 
+    1f42:	48 8d 05 db 21 00 00 	lea    0x21db(%rip),%rax        # 4124 <stats+0x4>
+    1f49:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1f4c:	eb 01                	jmp    1f4f <free+0x11b>
+    return;
+    1f4e:	90                   	nop
+}
+    1f4f:	c9                   	leave
+    1f50:	c3                   	ret
+
+0000000000001f51 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1f51:	55                   	push   %rbp
+    1f52:	48 89 e5             	mov    %rsp,%rbp
+    1f55:	48 83 ec 30          	sub    $0x30,%rsp
+    1f59:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1f5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f5f:	48 8d 15 e2 02 00 00 	lea    0x2e2(%rip),%rdx        # 2248 <benchreport+0x1cf>
+    1f66:	48 89 d6             	mov    %rdx,%rsi
+    1f69:	89 c7                	mov    %eax,%edi
+    1f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f70:	e8 37 e6 ff ff       	call   5ac <printf>
+  for (c = 0; c < NCLASS; c++)
+    1f75:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1f7c:	eb 67                	jmp    1fe5 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1f7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f81:	48 98                	cltq
+    1f83:	48 83 c0 08          	add    $0x8,%rax
+    1f87:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f8e:	00 
+    1f8f:	48 8d 05 8e 21 00 00 	lea    0x218e(%rip),%rax        # 4124 <stats+0x4>
+    1f96:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1f99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f9c:	48 98                	cltq
+    1f9e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fa5:	00 
+    1fa6:	48 8d 05 73 21 00 00 	lea    0x2173(%rip),%rax        # 4120 <stats>
+    1fad:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1fb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1fb3:	ba 20 00 00 00       	mov    $0x20,%edx
+    1fb8:	89 c1                	mov    %eax,%ecx
+    1fba:	48 d3 e2             	shl    %cl,%rdx
+    1fbd:	48 89 d0             	mov    %rdx,%rax
+    1fc0:	89 c1                	mov    %eax,%ecx
+    1fc2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1fc5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1fc8:	41 89 f9             	mov    %edi,%r9d
+    1fcb:	41 89 f0             	mov    %esi,%r8d
+    1fce:	48 8d 35 8a 02 00 00 	lea    0x28a(%rip),%rsi        # 225f <benchreport+0x1e6>
+    1fd5:	89 c7                	mov    %eax,%edi
+    1fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fdc:	e8 cb e5 ff ff       	call   5ac <printf>
+  for (c = 0; c < NCLASS; c++)
+    1fe1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1fe5:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1fe9:	7e 93                	jle    1f7e <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1feb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1ff2:	00 
+  for (r = runs; r; r = r->next)
+    1ff3:	48 8b 05 06 21 00 00 	mov    0x2106(%rip),%rax        # 4100 <runs>
+    1ffa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ffe:	eb 17                	jmp    2017 <mallocstats+0xc6>
+    nfree += r->size;
+    2000:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2004:	48 8b 00             	mov    (%rax),%rax
+    2007:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    200b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    200f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2013:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2017:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    201c:	75 e2                	jne    2000 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    201e:	48 8b 05 4b 21 00 00 	mov    0x214b(%rip),%rax        # 4170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2025:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2027:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    202b:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    202f:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2031:	48 8b 05 30 21 00 00 	mov    0x2130(%rip),%rax        # 4168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2038:	89 c1                	mov    %eax,%ecx
+    203a:	8b 15 00 21 00 00    	mov    0x2100(%rip),%edx        # 4140 <stats+0x20>
+    2040:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2043:	41 89 f9             	mov    %edi,%r9d
+    2046:	41 89 f0             	mov    %esi,%r8d
+    2049:	48 8d 35 20 02 00 00 	lea    0x220(%rip),%rsi        # 2270 <benchreport+0x1f7>
+    2050:	89 c7                	mov    %eax,%edi
+    2052:	b8 00 00 00 00       	mov    $0x0,%eax
+    2057:	e8 50 e5 ff ff       	call   5ac <printf>
+}
+    205c:	90                   	nop
+    205d:	c9                   	leave
+    205e:	c3                   	ret
+
+000000000000205f <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    205f:	55                   	push   %rbp
+    2060:	48 89 e5             	mov    %rsp,%rbp
+    2063:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    2067:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    206b:	48 89 c7             	mov    %rax,%rdi
+    206e:	e8 9a f7 ff ff       	call   180d <cycles>
+  return t;
+    2073:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2077:	c9                   	leave
+    2078:	c3                   	ret
+
+0000000000002079 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    2079:	55                   	push   %rbp
+    207a:	48 89 e5             	mov    %rsp,%rbp
+    207d:	48 83 ec 30          	sub    $0x30,%rsp
+    2081:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2085:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2089:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    208c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2090:	0f 8e 24 01 00 00    	jle    21ba <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    2096:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    209d:	e9 98 00 00 00       	jmp    213a <benchreport+0xc1>
+    x = t[i];
+    20a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20a5:	48 98                	cltq
+    20a7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    20ae:	00 
+    20af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20b3:	48 01 d0             	add    %rdx,%rax
+    20b6:	48 8b 00             	mov    (%rax),%rax
+    20b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    20bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    20c0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    20c3:	eb 33                	jmp    20f8 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    20c5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    20c8:	48 98                	cltq
+    20ca:	48 c1 e0 03          	shl    $0x3,%rax
+    20ce:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    20d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    20d6:	48 01 d0             	add    %rdx,%rax
+    20d9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    20dc:	48 63 d2             	movslq %edx,%rdx
+    20df:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    20e6:	00 
+    20e7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    20eb:	48 01 ca             	add    %rcx,%rdx
+    20ee:	48 8b 00             	mov    (%rax),%rax
+    20f1:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    20f4:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    20f8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    20fc:	7e 1d                	jle    211b <benchreport+0xa2>
+    20fe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2101:	48 98                	cltq
+    2103:	48 c1 e0 03          	shl    $0x3,%rax
+    2107:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    210b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    210f:	48 01 d0             	add    %rdx,%rax
+    2112:	48 8b 00             	mov    (%rax),%rax
+    2115:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2119:	72 aa                	jb     20c5 <benchreport+0x4c>
+    t[j] = x;
+    211b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    211e:	48 98                	cltq
+    2120:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2127:	00 
+    2128:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    212c:	48 01 c2             	add    %rax,%rdx
+    212f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2133:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    2136:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    213a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    213d:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2140:	0f 8c 5c ff ff ff    	jl     20a2 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    2146:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2149:	48 98                	cltq
+    214b:	48 c1 e0 03          	shl    $0x3,%rax
+    214f:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2153:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2157:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    215a:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    215d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2160:	89 c2                	mov    %eax,%edx
+    2162:	c1 ea 1f             	shr    $0x1f,%edx
+    2165:	01 d0                	add    %edx,%eax
+    2167:	d1 f8                	sar    %eax
+    2169:	48 98                	cltq
+    216b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2172:	00 
+    2173:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2177:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    217a:	48 8b 38             	mov    (%rax),%rdi
+    217d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2181:	48 8b 30             	mov    (%rax),%rsi
+    2184:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    218b:	48 83 ec 08          	sub    $0x8,%rsp
+    218f:	51                   	push   %rcx
+    2190:	49 89 f9             	mov    %rdi,%r9
+    2193:	49 89 f0             	mov    %rsi,%r8
+    2196:	89 d1                	mov    %edx,%ecx
+    2198:	48 89 c2             	mov    %rax,%rdx
+    219b:	48 8d 05 0e 01 00 00 	lea    0x10e(%rip),%rax        # 22b0 <benchreport+0x237>
+    21a2:	48 89 c6             	mov    %rax,%rsi
+    21a5:	bf 01 00 00 00       	mov    $0x1,%edi
+    21aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    21af:	e8 f8 e3 ff ff       	call   5ac <printf>
+    21b4:	48 83 c4 10          	add    $0x10,%rsp
+    21b8:	eb 01                	jmp    21bb <benchreport+0x142>
+    return;
+    21ba:	90                   	nop
+}
+    21bb:	c9                   	leave
+    21bc:	c3                   	ret
@@ -0,0 +1,3837 @@
+
+out/user/_prof:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <same>:
+
+static struct entry *table;
+static struct profsample buf[NREAD];
+static int nsamples, nlost;
+
+static int same(struct profsample *a, struct profsample *b) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+       c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (a->rip != b->rip || a->user != b->user || strcmp(a->name, b->name))
+      10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      14:	48 8b 10             	mov    (%rax),%rdx
+      17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      1b:	48 8b 00             	mov    (%rax),%rax
+      1e:	48 39 c2             	cmp    %rax,%rdx
+      21:	75 34                	jne    57 <same+0x57>
+      23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      27:	0f b7 50 2a          	movzwl 0x2a(%rax),%edx
+      2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      2f:	0f b7 40 2a          	movzwl 0x2a(%rax),%eax
+      33:	66 39 c2             	cmp    %ax,%dx
+      36:	75 1f                	jne    57 <same+0x57>
+      38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      3c:	48 8d 50 30          	lea    0x30(%rax),%rdx
+      40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      44:	48 83 c0 30          	add    $0x30,%rax
+      48:	48 89 d6             	mov    %rdx,%rsi
+      4b:	48 89 c7             	mov    %rax,%rdi
+      4e:	e8 51 10 00 00       	call   10a4 <strcmp>
+      53:	85 c0                	test   %eax,%eax
+      55:	74 07                	je     5e <same+0x5e>
+    return 0;
+      57:	b8 00 00 00 00       	mov    $0x0,%eax
+      5c:	eb 42                	jmp    a0 <same+0xa0>
+  for (i = 0; i < PROFDEPTH; i++)
+      5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      65:	eb 2e                	jmp    95 <same+0x95>
+    if (a->pcs[i] != b->pcs[i])
+      67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      6b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      6e:	48 63 d2             	movslq %edx,%rdx
+      71:	48 8b 4c d0 08       	mov    0x8(%rax,%rdx,8),%rcx
+      76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      7a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      7d:	48 63 d2             	movslq %edx,%rdx
+      80:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+      85:	48 39 c1             	cmp    %rax,%rcx
+      88:	74 07                	je     91 <same+0x91>
+      return 0;
+      8a:	b8 00 00 00 00       	mov    $0x0,%eax
+      8f:	eb 0f                	jmp    a0 <same+0xa0>
+  for (i = 0; i < PROFDEPTH; i++)
+      91:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      95:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+      99:	7e cc                	jle    67 <same+0x67>
+  return 1;
+      9b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+      a0:	c9                   	leave
+      a1:	c3                   	ret
+
+00000000000000a2 <count>:
+
+static void count(struct profsample *s) {
+      a2:	55                   	push   %rbp
+      a3:	48 89 e5             	mov    %rsp,%rbp
+      a6:	48 83 ec 30          	sub    $0x30,%rsp
+      aa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  struct entry *e;
+  uint64_t h;
+  int i;
+
+  nsamples++;
+      ae:	8b 05 ac 3f 00 00    	mov    0x3fac(%rip),%eax        # 4060 <nsamples>
+      b4:	83 c0 01             	add    $0x1,%eax
+      b7:	89 05 a3 3f 00 00    	mov    %eax,0x3fa3(%rip)        # 4060 <nsamples>
+  h = s->rip;
+      bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      c1:	48 8b 00             	mov    (%rax),%rax
+      c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for (i = 0; i < PROFDEPTH; i++)
+      c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      cf:	eb 2b                	jmp    fc <count+0x5a>
+    h = h * 31 + s->pcs[i];
+      d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+      d5:	48 89 d0             	mov    %rdx,%rax
+      d8:	48 c1 e0 05          	shl    $0x5,%rax
+      dc:	48 29 d0             	sub    %rdx,%rax
+      df:	48 89 c1             	mov    %rax,%rcx
+      e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      e6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      e9:	48 63 d2             	movslq %edx,%rdx
+      ec:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+      f1:	48 01 c8             	add    %rcx,%rax
+      f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for (i = 0; i < PROFDEPTH; i++)
+      f8:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+      fc:	83 7d f4 03          	cmpl   $0x3,-0xc(%rbp)
+     100:	7e cf                	jle    d1 <count+0x2f>
+  for (i = 0; i < NBUCKET; i++) {
+     102:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     109:	e9 bd 00 00 00       	jmp    1cb <count+0x129>
+    e = &table[(h + i) % NBUCKET];
+     10e:	48 8b 0d 2b 2f 00 00 	mov    0x2f2b(%rip),%rcx        # 3040 <table>
+     115:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     118:	48 63 d0             	movslq %eax,%rdx
+     11b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     11f:	48 01 d0             	add    %rdx,%rax
+     122:	25 ff 03 00 00       	and    $0x3ff,%eax
+     127:	48 89 c2             	mov    %rax,%rdx
+     12a:	48 89 d0             	mov    %rdx,%rax
+     12d:	48 c1 e0 03          	shl    $0x3,%rax
+     131:	48 01 d0             	add    %rdx,%rax
+     134:	48 c1 e0 03          	shl    $0x3,%rax
+     138:	48 01 c8             	add    %rcx,%rax
+     13b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if (e->count == 0) {
+     13f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     143:	8b 40 40             	mov    0x40(%rax),%eax
+     146:	85 c0                	test   %eax,%eax
+     148:	75 53                	jne    19d <count+0xfb>
+      e->s = *s;
+     14a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     14e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     152:	48 8b 0a             	mov    (%rdx),%rcx
+     155:	48 89 08             	mov    %rcx,(%rax)
+     158:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+     15c:	48 89 48 08          	mov    %rcx,0x8(%rax)
+     160:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+     164:	48 89 48 10          	mov    %rcx,0x10(%rax)
+     168:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+     16c:	48 89 48 18          	mov    %rcx,0x18(%rax)
+     170:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+     174:	48 89 48 20          	mov    %rcx,0x20(%rax)
+     178:	48 8b 4a 28          	mov    0x28(%rdx),%rcx
+     17c:	48 89 48 28          	mov    %rcx,0x28(%rax)
+     180:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+     184:	48 89 48 30          	mov    %rcx,0x30(%rax)
+     188:	48 8b 52 38          	mov    0x38(%rdx),%rdx
+     18c:	48 89 50 38          	mov    %rdx,0x38(%rax)
+      e->count = 1;
+     190:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     194:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%rax)
+      return;
+     19b:	eb 4a                	jmp    1e7 <count+0x145>
+    }
+    if (same(&e->s, s)) {
+     19d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1a1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     1a5:	48 89 d6             	mov    %rdx,%rsi
+     1a8:	48 89 c7             	mov    %rax,%rdi
+     1ab:	e8 50 fe ff ff       	call   0 <same>
+     1b0:	85 c0                	test   %eax,%eax
+     1b2:	74 13                	je     1c7 <count+0x125>
+      e->count++;
+     1b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1b8:	8b 40 40             	mov    0x40(%rax),%eax
+     1bb:	8d 50 01             	lea    0x1(%rax),%edx
+     1be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1c2:	89 50 40             	mov    %edx,0x40(%rax)
+      return;
+     1c5:	eb 20                	jmp    1e7 <count+0x145>
+  for (i = 0; i < NBUCKET; i++) {
+     1c7:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     1cb:	81 7d f4 ff 03 00 00 	cmpl   $0x3ff,-0xc(%rbp)
+     1d2:	0f 8e 36 ff ff ff    	jle    10e <count+0x6c>
+    }
+  }
+  nlost++;
+     1d8:	8b 05 86 3e 00 00    	mov    0x3e86(%rip),%eax        # 4064 <nlost>
+     1de:	83 c0 01             	add    $0x1,%eax
+     1e1:	89 05 7d 3e 00 00    	mov    %eax,0x3e7d(%rip)        # 4064 <nlost>
+}
+     1e7:	c9                   	leave
+     1e8:	c3                   	ret
+
+00000000000001e9 <drain>:
+
+static void drain(void) {
+     1e9:	55                   	push   %rbp
+     1ea:	48 89 e5             	mov    %rsp,%rbp
+     1ed:	48 83 ec 10          	sub    $0x10,%rsp
+  int n, i;
+
+  while ((n = profile(PROF_READ, buf, NREAD)) > 0)
+     1f1:	eb 33                	jmp    226 <drain+0x3d>
+    for (i = 0; i < n; i++)
+     1f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1fa:	eb 22                	jmp    21e <drain+0x35>
+      count(&buf[i]);
+     1fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1ff:	48 98                	cltq
+     201:	48 c1 e0 06          	shl    $0x6,%rax
+     205:	48 89 c2             	mov    %rax,%rdx
+     208:	48 8d 05 51 2e 00 00 	lea    0x2e51(%rip),%rax        # 3060 <buf>
+     20f:	48 01 d0             	add    %rdx,%rax
+     212:	48 89 c7             	mov    %rax,%rdi
+     215:	e8 88 fe ff ff       	call   a2 <count>
+    for (i = 0; i < n; i++)
+     21a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     21e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     221:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     224:	7c d6                	jl     1fc <drain+0x13>
+  while ((n = profile(PROF_READ, buf, NREAD)) > 0)
+     226:	ba 40 00 00 00       	mov    $0x40,%edx
+     22b:	48 8d 05 2e 2e 00 00 	lea    0x2e2e(%rip),%rax        # 3060 <buf>
+     232:	48 89 c6             	mov    %rax,%rsi
+     235:	bf 02 00 00 00       	mov    $0x2,%edi
+     23a:	e8 88 17 00 00       	call   19c7 <profile>
+     23f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     242:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     246:	7f ab                	jg     1f3 <drain+0xa>
+}
+     248:	90                   	nop
+     249:	90                   	nop
+     24a:	c9                   	leave
+     24b:	c3                   	ret
+
+000000000000024c <main>:
+
+int main(int argc, char *argv[]) {
+     24c:	55                   	push   %rbp
+     24d:	48 89 e5             	mov    %rsp,%rbp
+     250:	48 83 ec 50          	sub    $0x50,%rsp
+     254:	89 7d bc             	mov    %edi,-0x44(%rbp)
+     257:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  struct pollfd pfd;
+  struct entry *e, *best;
+  int rate, pid, fds[2], dropped, i;
+  char c;
+
+  rate = 10;
+     25b:	c7 45 ec 0a 00 00 00 	movl   $0xa,-0x14(%rbp)
+  argv++;
+     262:	48 83 45 b0 08       	addq   $0x8,-0x50(%rbp)
+  argc--;
+     267:	83 6d bc 01          	subl   $0x1,-0x44(%rbp)
+  if (argc >= 2 && strcmp(argv[0], "-r") == 0) {
+     26b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     26f:	7e 3c                	jle    2ad <main+0x61>
+     271:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     275:	48 8b 00             	mov    (%rax),%rax
+     278:	48 8d 15 09 21 00 00 	lea    0x2109(%rip),%rdx        # 2388 <benchreport+0x14a>
+     27f:	48 89 d6             	mov    %rdx,%rsi
+     282:	48 89 c7             	mov    %rax,%rdi
+     285:	e8 1a 0e 00 00       	call   10a4 <strcmp>
+     28a:	85 c0                	test   %eax,%eax
+     28c:	75 1f                	jne    2ad <main+0x61>
+    rate = atoi(argv[1]);
+     28e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     292:	48 83 c0 08          	add    $0x8,%rax
+     296:	48 8b 00             	mov    (%rax),%rax
+     299:	48 89 c7             	mov    %rax,%rdi
+     29c:	e8 6a 10 00 00       	call   130b <atoi>
+     2a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    argv += 2;
+     2a4:	48 83 45 b0 10       	addq   $0x10,-0x50(%rbp)
+    argc -= 2;
+     2a9:	83 6d bc 02          	subl   $0x2,-0x44(%rbp)
+  }
+  if (argc < 1) {
+     2ad:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     2b1:	7f 1e                	jg     2d1 <main+0x85>
+    printf(2, "usage: prof [-r rate] cmd [args...]\n");
+     2b3:	48 8d 05 d6 20 00 00 	lea    0x20d6(%rip),%rax        # 2390 <benchreport+0x152>
+     2ba:	48 89 c6             	mov    %rax,%rsi
+     2bd:	bf 02 00 00 00       	mov    $0x2,%edi
+     2c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c7:	e8 a5 04 00 00       	call   771 <printf>
+    exit();
+     2cc:	e8 d0 0a 00 00       	call   da1 <exit>
+  }
+  if ((table = malloc(NBUCKET * sizeof(*table))) == 0) {
+     2d1:	bf 00 20 01 00       	mov    $0x12000,%edi
+     2d6:	e8 76 1b 00 00       	call   1e51 <malloc>
+     2db:	48 89 05 5e 2d 00 00 	mov    %rax,0x2d5e(%rip)        # 3040 <table>
+     2e2:	48 8b 05 57 2d 00 00 	mov    0x2d57(%rip),%rax        # 3040 <table>
+     2e9:	48 85 c0             	test   %rax,%rax
+     2ec:	75 1e                	jne    30c <main+0xc0>
+    printf(2, "prof: out of memory\n");
+     2ee:	48 8d 05 c0 20 00 00 	lea    0x20c0(%rip),%rax        # 23b5 <benchreport+0x177>
+     2f5:	48 89 c6             	mov    %rax,%rsi
+     2f8:	bf 02 00 00 00       	mov    $0x2,%edi
+     2fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     302:	e8 6a 04 00 00       	call   771 <printf>
+    exit();
+     307:	e8 95 0a 00 00       	call   da1 <exit>
+  }
+  memset(table, 0, NBUCKET * sizeof(*table));
+     30c:	48 8b 05 2d 2d 00 00 	mov    0x2d2d(%rip),%rax        # 3040 <table>
+     313:	ba 00 20 01 00       	mov    $0x12000,%edx
+     318:	be 00 00 00 00       	mov    $0x0,%esi
+     31d:	48 89 c7             	mov    %rax,%rdi
+     320:	e8 6e 0e 00 00       	call   1193 <memset>
+
+  // cmd holds the write end of the pipe, so the read end hangs up
+  // when it exits; until then keep the sample buffers drained
+  if (pipe(fds) < 0 || profile(PROF_ON, 0, rate) < 0) {
+     325:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     329:	48 89 c7             	mov    %rax,%rdi
+     32c:	e8 0a 15 00 00       	call   183b <pipe>
+     331:	85 c0                	test   %eax,%eax
+     333:	78 18                	js     34d <main+0x101>
+     335:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     338:	89 c2                	mov    %eax,%edx
+     33a:	be 00 00 00 00       	mov    $0x0,%esi
+     33f:	bf 00 00 00 00       	mov    $0x0,%edi
+     344:	e8 7e 16 00 00       	call   19c7 <profile>
+     349:	85 c0                	test   %eax,%eax
+     34b:	79 23                	jns    370 <main+0x124>
+    printf(2, "prof: cannot start profiling at rate %d\n", rate);
+     34d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     350:	89 c2                	mov    %eax,%edx
+     352:	48 8d 05 77 20 00 00 	lea    0x2077(%rip),%rax        # 23d0 <benchreport+0x192>
+     359:	48 89 c6             	mov    %rax,%rsi
+     35c:	bf 02 00 00 00       	mov    $0x2,%edi
+     361:	b8 00 00 00 00       	mov    $0x0,%eax
+     366:	e8 06 04 00 00       	call   771 <printf>
+    exit();
+     36b:	e8 31 0a 00 00       	call   da1 <exit>
+  }
+  if ((pid = fork()) == 0) {
+     370:	e8 1c 0a 00 00       	call   d91 <fork>
+     375:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+     378:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     37c:	75 48                	jne    3c6 <main+0x17a>
+    close(fds[0]);
+     37e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     381:	89 c7                	mov    %eax,%edi
+     383:	e8 83 0a 00 00       	call   e0b <close>
+    exec(argv[0], argv);
+     388:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     38c:	48 8b 00             	mov    (%rax),%rax
+     38f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+     393:	48 89 d6             	mov    %rdx,%rsi
+     396:	48 89 c7             	mov    %rax,%rdi
+     399:	e8 11 0a 00 00       	call   daf <exec>
+    printf(2, "prof: exec %s failed\n", argv[0]);
+     39e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3a2:	48 8b 00             	mov    (%rax),%rax
+     3a5:	48 89 c2             	mov    %rax,%rdx
+     3a8:	48 8d 05 4a 20 00 00 	lea    0x204a(%rip),%rax        # 23f9 <benchreport+0x1bb>
+     3af:	48 89 c6             	mov    %rax,%rsi
+     3b2:	bf 02 00 00 00       	mov    $0x2,%edi
+     3b7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3bc:	e8 b0 03 00 00       	call   771 <printf>
+    exit();
+     3c1:	e8 db 09 00 00       	call   da1 <exit>
+  }
+  close(fds[1]);
+     3c6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     3c9:	89 c7                	mov    %eax,%edi
+     3cb:	e8 3b 0a 00 00       	call   e0b <close>
+  pfd.fd = fds[0];
+     3d0:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     3d3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  pfd.events = POLLIN;
+     3d6:	66 c7 45 dc 01 00    	movw   $0x1,-0x24(%rbp)
+  while (pid > 0) {
+     3dc:	eb 39                	jmp    417 <main+0x1cb>
+    drain();
+     3de:	e8 06 fe ff ff       	call   1e9 <drain>
+    if (poll(&pfd, 1, 10) > 0 && read(fds[0], &c, 1) <= 0)
+     3e3:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     3e7:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3ec:	be 01 00 00 00       	mov    $0x1,%esi
+     3f1:	48 89 c7             	mov    %rax,%rdi
+     3f4:	e8 8c 15 00 00       	call   1985 <poll>
+     3f9:	85 c0                	test   %eax,%eax
+     3fb:	7e 1a                	jle    417 <main+0x1cb>
+     3fd:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     400:	48 8d 4d cf          	lea    -0x31(%rbp),%rcx
+     404:	ba 01 00 00 00       	mov    $0x1,%edx
+     409:	48 89 ce             	mov    %rcx,%rsi
+     40c:	89 c7                	mov    %eax,%edi
+     40e:	e8 33 14 00 00       	call   1846 <read>
+     413:	85 c0                	test   %eax,%eax
+     415:	7e 08                	jle    41f <main+0x1d3>
+  while (pid > 0) {
+     417:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     41b:	7f c1                	jg     3de <main+0x192>
+     41d:	eb 01                	jmp    420 <main+0x1d4>
+      break;
+     41f:	90                   	nop
+  }
+  dropped = profile(PROF_OFF, 0, 0);
+     420:	ba 00 00 00 00       	mov    $0x0,%edx
+     425:	be 00 00 00 00       	mov    $0x0,%esi
+     42a:	bf 01 00 00 00       	mov    $0x1,%edi
+     42f:	e8 93 15 00 00       	call   19c7 <profile>
+     434:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  drain();
+     437:	e8 ad fd ff ff       	call   1e9 <drain>
+  if (pid > 0)
+     43c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     440:	7e 05                	jle    447 <main+0x1fb>
+    wait();
+     442:	e8 e9 13 00 00       	call   1830 <wait>
+
+  printf(1, "prof: %d samples, %d dropped, %d not kept, rate %d\n", nsamples,
+     447:	8b 0d 17 3c 00 00    	mov    0x3c17(%rip),%ecx        # 4064 <nlost>
+     44d:	8b 05 0d 3c 00 00    	mov    0x3c0d(%rip),%eax        # 4060 <nsamples>
+     453:	8b 75 ec             	mov    -0x14(%rbp),%esi
+     456:	8b 55 e0             	mov    -0x20(%rbp),%edx
+     459:	41 89 f1             	mov    %esi,%r9d
+     45c:	41 89 c8             	mov    %ecx,%r8d
+     45f:	89 d1                	mov    %edx,%ecx
+     461:	89 c2                	mov    %eax,%edx
+     463:	48 8d 05 a6 1f 00 00 	lea    0x1fa6(%rip),%rax        # 2410 <benchreport+0x1d2>
+     46a:	48 89 c6             	mov    %rax,%rsi
+     46d:	bf 01 00 00 00       	mov    $0x1,%edi
+     472:	b8 00 00 00 00       	mov    $0x0,%eax
+     477:	e8 f5 02 00 00       	call   771 <printf>
+         dropped, nlost, rate);
+  for (;;) {
+    best = 0;
+     47c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+     483:	00 
+    for (e = table; e < table + NBUCKET; e++)
+     484:	48 8b 05 b5 2b 00 00 	mov    0x2bb5(%rip),%rax        # 3040 <table>
+     48b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     48f:	eb 31                	jmp    4c2 <main+0x276>
+      if (e->count > 0 && (best == 0 || e->count > best->count))
+     491:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     495:	8b 40 40             	mov    0x40(%rax),%eax
+     498:	85 c0                	test   %eax,%eax
+     49a:	7e 21                	jle    4bd <main+0x271>
+     49c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     4a1:	74 12                	je     4b5 <main+0x269>
+     4a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4a7:	8b 50 40             	mov    0x40(%rax),%edx
+     4aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     4ae:	8b 40 40             	mov    0x40(%rax),%eax
+     4b1:	39 c2                	cmp    %eax,%edx
+     4b3:	7e 08                	jle    4bd <main+0x271>
+        best = e;
+     4b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (e = table; e < table + NBUCKET; e++)
+     4bd:	48 83 45 f8 48       	addq   $0x48,-0x8(%rbp)
+     4c2:	48 8b 05 77 2b 00 00 	mov    0x2b77(%rip),%rax        # 3040 <table>
+     4c9:	48 05 00 20 01 00    	add    $0x12000,%rax
+     4cf:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     4d3:	72 bc                	jb     491 <main+0x245>
+    if (best == 0)
+     4d5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     4da:	0f 84 cd 00 00 00    	je     5ad <main+0x361>
+      break;
+    printf(1, "%d %s %s %lx", best->count, best->s.name,
+     4e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     4e4:	48 8b 30             	mov    (%rax),%rsi
+           best->s.user ? "u" : "k", best->s.rip);
+     4e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     4eb:	0f b7 40 2a          	movzwl 0x2a(%rax),%eax
+    printf(1, "%d %s %s %lx", best->count, best->s.name,
+     4ef:	66 85 c0             	test   %ax,%ax
+     4f2:	74 09                	je     4fd <main+0x2b1>
+     4f4:	48 8d 05 49 1f 00 00 	lea    0x1f49(%rip),%rax        # 2444 <benchreport+0x206>
+     4fb:	eb 07                	jmp    504 <main+0x2b8>
+     4fd:	48 8d 05 42 1f 00 00 	lea    0x1f42(%rip),%rax        # 2446 <benchreport+0x208>
+     504:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     508:	48 8d 4a 30          	lea    0x30(%rdx),%rcx
+     50c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     510:	8b 52 40             	mov    0x40(%rdx),%edx
+     513:	49 89 f1             	mov    %rsi,%r9
+     516:	49 89 c0             	mov    %rax,%r8
+     519:	48 8d 05 28 1f 00 00 	lea    0x1f28(%rip),%rax        # 2448 <benchreport+0x20a>
+     520:	48 89 c6             	mov    %rax,%rsi
+     523:	bf 01 00 00 00       	mov    $0x1,%edi
+     528:	b8 00 00 00 00       	mov    $0x0,%eax
+     52d:	e8 3f 02 00 00       	call   771 <printf>
+    for (i = 0; i < PROFDEPTH && best->s.pcs[i]; i++)
+     532:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+     539:	eb 2f                	jmp    56a <main+0x31e>
+      printf(1, " %lx", best->s.pcs[i]);
+     53b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     53f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     542:	48 63 d2             	movslq %edx,%rdx
+     545:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     54a:	48 89 c2             	mov    %rax,%rdx
+     54d:	48 8d 05 01 1f 00 00 	lea    0x1f01(%rip),%rax        # 2455 <benchreport+0x217>
+     554:	48 89 c6             	mov    %rax,%rsi
+     557:	bf 01 00 00 00       	mov    $0x1,%edi
+     55c:	b8 00 00 00 00       	mov    $0x0,%eax
+     561:	e8 0b 02 00 00       	call   771 <printf>
+    for (i = 0; i < PROFDEPTH && best->s.pcs[i]; i++)
+     566:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+     56a:	83 7d e8 03          	cmpl   $0x3,-0x18(%rbp)
+     56e:	7f 14                	jg     584 <main+0x338>
+     570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     574:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     577:	48 63 d2             	movslq %edx,%rdx
+     57a:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     57f:	48 85 c0             	test   %rax,%rax
+     582:	75 b7                	jne    53b <main+0x2ef>
+    printf(1, "\n");
+     584:	48 8d 05 cf 1e 00 00 	lea    0x1ecf(%rip),%rax        # 245a <benchreport+0x21c>
+     58b:	48 89 c6             	mov    %rax,%rsi
+     58e:	bf 01 00 00 00       	mov    $0x1,%edi
+     593:	b8 00 00 00 00       	mov    $0x0,%eax
+     598:	e8 d4 01 00 00       	call   771 <printf>
+    best->count = 0;
+     59d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5a1:	c7 40 40 00 00 00 00 	movl   $0x0,0x40(%rax)
+    best = 0;
+     5a8:	e9 cf fe ff ff       	jmp    47c <main+0x230>
+      break;
+     5ad:	90                   	nop
+  }
+  exit();
+     5ae:	e8 ee 07 00 00       	call   da1 <exit>
+
+00000000000005b3 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     5b3:	55                   	push   %rbp
+     5b4:	48 89 e5             	mov    %rsp,%rbp
+     5b7:	48 83 ec 10          	sub    $0x10,%rsp
+     5bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     5be:	89 f0                	mov    %esi,%eax
+     5c0:	88 45 f8             	mov    %al,-0x8(%rbp)
+     5c3:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     5c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5ca:	89 d6                	mov    %edx,%esi
+     5cc:	89 c7                	mov    %eax,%edi
+     5ce:	e8 eb 06 00 00       	call   cbe <bputc>
+     5d3:	90                   	nop
+     5d4:	c9                   	leave
+     5d5:	c3                   	ret
+
+00000000000005d6 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     5d6:	55                   	push   %rbp
+     5d7:	48 89 e5             	mov    %rsp,%rbp
+     5da:	48 83 ec 50          	sub    $0x50,%rsp
+     5de:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     5e1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     5e5:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     5e8:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     5eb:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     5ef:	74 21                	je     612 <printint64+0x3c>
+     5f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     5f5:	48 c1 e8 3f          	shr    $0x3f,%rax
+     5f9:	0f b6 c0             	movzbl %al,%eax
+     5fc:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     5ff:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     603:	74 0d                	je     612 <printint64+0x3c>
+    x = -xx;
+     605:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     609:	48 f7 d8             	neg    %rax
+     60c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     610:	eb 08                	jmp    61a <printint64+0x44>
+  else
+    x = xx;
+     612:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     616:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     61a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     621:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     624:	48 63 c8             	movslq %eax,%rcx
+     627:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     62b:	ba 00 00 00 00       	mov    $0x0,%edx
+     630:	48 f7 f1             	div    %rcx
+     633:	48 89 d1             	mov    %rdx,%rcx
+     636:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     639:	8d 50 01             	lea    0x1(%rax),%edx
+     63c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     63f:	48 8d 15 ba 29 00 00 	lea    0x29ba(%rip),%rdx        # 3000 <digits.1>
+     646:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     64a:	48 98                	cltq
+     64c:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     650:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     653:	48 63 f0             	movslq %eax,%rsi
+     656:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     65a:	ba 00 00 00 00       	mov    $0x0,%edx
+     65f:	48 f7 f6             	div    %rsi
+     662:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     666:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     66b:	75 b4                	jne    621 <printint64+0x4b>
+
+  if (sgn)
+     66d:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     671:	74 2b                	je     69e <printint64+0xc8>
+    buf[i++] = '-';
+     673:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     676:	8d 50 01             	lea    0x1(%rax),%edx
+     679:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     67c:	48 98                	cltq
+     67e:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     683:	eb 19                	jmp    69e <printint64+0xc8>
+    putc(fd, buf[i]);
+     685:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     688:	48 98                	cltq
+     68a:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     68f:	0f be d0             	movsbl %al,%edx
+     692:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     695:	89 d6                	mov    %edx,%esi
+     697:	89 c7                	mov    %eax,%edi
+     699:	e8 15 ff ff ff       	call   5b3 <putc>
+  while (--i >= 0)
+     69e:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     6a2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     6a6:	79 dd                	jns    685 <printint64+0xaf>
+}
+     6a8:	90                   	nop
+     6a9:	90                   	nop
+     6aa:	c9                   	leave
+     6ab:	c3                   	ret
+
+00000000000006ac <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     6ac:	55                   	push   %rbp
+     6ad:	48 89 e5             	mov    %rsp,%rbp
+     6b0:	48 83 ec 30          	sub    $0x30,%rsp
+     6b4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     6b7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     6ba:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     6bd:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     6c0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     6c7:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     6cb:	74 17                	je     6e4 <printint+0x38>
+     6cd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     6d1:	79 11                	jns    6e4 <printint+0x38>
+    neg = 1;
+     6d3:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     6da:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6dd:	f7 d8                	neg    %eax
+     6df:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6e2:	eb 06                	jmp    6ea <printint+0x3e>
+  } else {
+    x = xx;
+     6e4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6e7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     6ea:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     6f1:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     6f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     6f7:	ba 00 00 00 00       	mov    $0x0,%edx
+     6fc:	f7 f1                	div    %ecx
+     6fe:	89 d1                	mov    %edx,%ecx
+     700:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     703:	8d 50 01             	lea    0x1(%rax),%edx
+     706:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     709:	89 c9                	mov    %ecx,%ecx
+     70b:	48 8d 15 0e 29 00 00 	lea    0x290e(%rip),%rdx        # 3020 <digits.0>
+     712:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     716:	48 98                	cltq
+     718:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     71c:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     71f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     722:	ba 00 00 00 00       	mov    $0x0,%edx
+     727:	f7 f6                	div    %esi
+     729:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     72c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     730:	75 bf                	jne    6f1 <printint+0x45>
+  if (neg)
+     732:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     736:	74 2b                	je     763 <printint+0xb7>
+    buf[i++] = '-';
+     738:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     73b:	8d 50 01             	lea    0x1(%rax),%edx
+     73e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     741:	48 98                	cltq
+     743:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     748:	eb 19                	jmp    763 <printint+0xb7>
+    putc(fd, buf[i]);
+     74a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     74d:	48 98                	cltq
+     74f:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     754:	0f be d0             	movsbl %al,%edx
+     757:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     75a:	89 d6                	mov    %edx,%esi
+     75c:	89 c7                	mov    %eax,%edi
+     75e:	e8 50 fe ff ff       	call   5b3 <putc>
+  while (--i >= 0)
+     763:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     767:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     76b:	79 dd                	jns    74a <printint+0x9e>
+}
+     76d:	90                   	nop
+     76e:	90                   	nop
+     76f:	c9                   	leave
+     770:	c3                   	ret
+
+0000000000000771 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     771:	55                   	push   %rbp
+     772:	48 89 e5             	mov    %rsp,%rbp
+     775:	48 83 ec 70          	sub    $0x70,%rsp
+     779:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     77c:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     780:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     784:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     788:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     78c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     790:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     797:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     79b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     79f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     7a3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     7a7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     7ae:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     7b5:	e9 67 02 00 00       	jmp    a21 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     7ba:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     7bd:	48 63 d0             	movslq %eax,%rdx
+     7c0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     7c4:	48 01 d0             	add    %rdx,%rax
+     7c7:	0f b6 00             	movzbl (%rax),%eax
+     7ca:	0f be c0             	movsbl %al,%eax
+     7cd:	25 ff 00 00 00       	and    $0xff,%eax
+     7d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     7d5:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     7d9:	75 30                	jne    80b <printf+0x9a>
+      if (c == '%') {
+     7db:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     7df:	75 13                	jne    7f4 <printf+0x83>
+        state = '%';
+     7e1:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     7e8:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     7ef:	e9 29 02 00 00       	jmp    a1d <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     7f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     7f7:	0f be d0             	movsbl %al,%edx
+     7fa:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7fd:	89 d6                	mov    %edx,%esi
+     7ff:	89 c7                	mov    %eax,%edi
+     801:	e8 ad fd ff ff       	call   5b3 <putc>
+     806:	e9 12 02 00 00       	jmp    a1d <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     80b:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     80f:	0f 85 08 02 00 00    	jne    a1d <printf+0x2ac>
+      if (c == 'l') {
+     815:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     819:	75 0c                	jne    827 <printf+0xb6>
+        lflag = 1;
+     81b:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     822:	e9 f6 01 00 00       	jmp    a1d <printf+0x2ac>
+      } else if (c == 'd') {
+     827:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     82b:	0f 85 93 00 00 00    	jne    8c4 <printf+0x153>
+        if (lflag == 1)
+     831:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     835:	75 47                	jne    87e <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     837:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     83a:	83 f8 2f             	cmp    $0x2f,%eax
+     83d:	77 17                	ja     856 <printf+0xe5>
+     83f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     843:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     846:	89 d2                	mov    %edx,%edx
+     848:	48 01 d0             	add    %rdx,%rax
+     84b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     84e:	83 c2 08             	add    $0x8,%edx
+     851:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     854:	eb 0c                	jmp    862 <printf+0xf1>
+     856:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     85a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     85e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     862:	48 8b 30             	mov    (%rax),%rsi
+     865:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     868:	b9 01 00 00 00       	mov    $0x1,%ecx
+     86d:	ba 0a 00 00 00       	mov    $0xa,%edx
+     872:	89 c7                	mov    %eax,%edi
+     874:	e8 5d fd ff ff       	call   5d6 <printint64>
+     879:	e9 98 01 00 00       	jmp    a16 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     87e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     881:	83 f8 2f             	cmp    $0x2f,%eax
+     884:	77 17                	ja     89d <printf+0x12c>
+     886:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     88a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     88d:	89 d2                	mov    %edx,%edx
+     88f:	48 01 d0             	add    %rdx,%rax
+     892:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     895:	83 c2 08             	add    $0x8,%edx
+     898:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     89b:	eb 0c                	jmp    8a9 <printf+0x138>
+     89d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8a1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8a5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     8a9:	8b 30                	mov    (%rax),%esi
+     8ab:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+     8b3:	ba 0a 00 00 00       	mov    $0xa,%edx
+     8b8:	89 c7                	mov    %eax,%edi
+     8ba:	e8 ed fd ff ff       	call   6ac <printint>
+     8bf:	e9 52 01 00 00       	jmp    a16 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     8c4:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     8c8:	74 0a                	je     8d4 <printf+0x163>
+     8ca:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     8ce:	0f 85 93 00 00 00    	jne    967 <printf+0x1f6>
+        if (lflag == 1)
+     8d4:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     8d8:	75 47                	jne    921 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     8da:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8dd:	83 f8 2f             	cmp    $0x2f,%eax
+     8e0:	77 17                	ja     8f9 <printf+0x188>
+     8e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8e6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8e9:	89 d2                	mov    %edx,%edx
+     8eb:	48 01 d0             	add    %rdx,%rax
+     8ee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8f1:	83 c2 08             	add    $0x8,%edx
+     8f4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     8f7:	eb 0c                	jmp    905 <printf+0x194>
+     8f9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8fd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     901:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     905:	48 8b 30             	mov    (%rax),%rsi
+     908:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     90b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     910:	ba 10 00 00 00       	mov    $0x10,%edx
+     915:	89 c7                	mov    %eax,%edi
+     917:	e8 ba fc ff ff       	call   5d6 <printint64>
+        if (lflag == 1)
+     91c:	e9 f5 00 00 00       	jmp    a16 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     921:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     924:	83 f8 2f             	cmp    $0x2f,%eax
+     927:	77 17                	ja     940 <printf+0x1cf>
+     929:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     92d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     930:	89 d2                	mov    %edx,%edx
+     932:	48 01 d0             	add    %rdx,%rax
+     935:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     938:	83 c2 08             	add    $0x8,%edx
+     93b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     93e:	eb 0c                	jmp    94c <printf+0x1db>
+     940:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     944:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     948:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     94c:	8b 30                	mov    (%rax),%esi
+     94e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     951:	b9 00 00 00 00       	mov    $0x0,%ecx
+     956:	ba 10 00 00 00       	mov    $0x10,%edx
+     95b:	89 c7                	mov    %eax,%edi
+     95d:	e8 4a fd ff ff       	call   6ac <printint>
+        if (lflag == 1)
+     962:	e9 af 00 00 00       	jmp    a16 <printf+0x2a5>
+      } else if (c == 's') {
+     967:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     96b:	75 6e                	jne    9db <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     96d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     970:	83 f8 2f             	cmp    $0x2f,%eax
+     973:	77 17                	ja     98c <printf+0x21b>
+     975:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     979:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     97c:	89 d2                	mov    %edx,%edx
+     97e:	48 01 d0             	add    %rdx,%rax
+     981:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     984:	83 c2 08             	add    $0x8,%edx
+     987:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     98a:	eb 0c                	jmp    998 <printf+0x227>
+     98c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     990:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     994:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     998:	48 8b 00             	mov    (%rax),%rax
+     99b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     99f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     9a4:	75 28                	jne    9ce <printf+0x25d>
+          s = "(null)";
+     9a6:	48 8d 05 af 1a 00 00 	lea    0x1aaf(%rip),%rax        # 245c <benchreport+0x21e>
+     9ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     9b1:	eb 1b                	jmp    9ce <printf+0x25d>
+          putc(fd, *s);
+     9b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     9b7:	0f b6 00             	movzbl (%rax),%eax
+     9ba:	0f be d0             	movsbl %al,%edx
+     9bd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9c0:	89 d6                	mov    %edx,%esi
+     9c2:	89 c7                	mov    %eax,%edi
+     9c4:	e8 ea fb ff ff       	call   5b3 <putc>
+        for (; *s; s++)
+     9c9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     9ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     9d2:	0f b6 00             	movzbl (%rax),%eax
+     9d5:	84 c0                	test   %al,%al
+     9d7:	75 da                	jne    9b3 <printf+0x242>
+     9d9:	eb 3b                	jmp    a16 <printf+0x2a5>
+      } else if (c == '%') {
+     9db:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     9df:	75 14                	jne    9f5 <printf+0x284>
+        putc(fd, c);
+     9e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     9e4:	0f be d0             	movsbl %al,%edx
+     9e7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9ea:	89 d6                	mov    %edx,%esi
+     9ec:	89 c7                	mov    %eax,%edi
+     9ee:	e8 c0 fb ff ff       	call   5b3 <putc>
+     9f3:	eb 21                	jmp    a16 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     9f5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9f8:	be 25 00 00 00       	mov    $0x25,%esi
+     9fd:	89 c7                	mov    %eax,%edi
+     9ff:	e8 af fb ff ff       	call   5b3 <putc>
+        putc(fd, c);
+     a04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     a07:	0f be d0             	movsbl %al,%edx
+     a0a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a0d:	89 d6                	mov    %edx,%esi
+     a0f:	89 c7                	mov    %eax,%edi
+     a11:	e8 9d fb ff ff       	call   5b3 <putc>
+      }
+      state = 0;
+     a16:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     a1d:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     a21:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     a24:	48 63 d0             	movslq %eax,%rdx
+     a27:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     a2b:	48 01 d0             	add    %rdx,%rax
+     a2e:	0f b6 00             	movzbl (%rax),%eax
+     a31:	84 c0                	test   %al,%al
+     a33:	0f 85 81 fd ff ff    	jne    7ba <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     a39:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a3c:	89 c7                	mov    %eax,%edi
+     a3e:	e8 ee 02 00 00       	call   d31 <bflushtty>
+}
+     a43:	90                   	nop
+     a44:	c9                   	leave
+     a45:	c3                   	ret
+
+0000000000000a46 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     a46:	55                   	push   %rbp
+     a47:	48 89 e5             	mov    %rsp,%rbp
+     a4a:	48 83 ec 30          	sub    $0x30,%rsp
+     a4e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     a51:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     a55:	78 06                	js     a5d <getbuf+0x17>
+     a57:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     a5b:	7e 0a                	jle    a67 <getbuf+0x21>
+    return 0;
+     a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a62:	e9 94 00 00 00       	jmp    afb <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     a67:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a6a:	48 98                	cltq
+     a6c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a73:	00 
+     a74:	48 8d 05 05 36 00 00 	lea    0x3605(%rip),%rax        # 4080 <obufs>
+     a7b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a83:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a88:	75 6d                	jne    af7 <getbuf+0xb1>
+     a8a:	bf 08 02 00 00       	mov    $0x208,%edi
+     a8f:	e8 bd 13 00 00       	call   1e51 <malloc>
+     a94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a98:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a9d:	74 58                	je     af7 <getbuf+0xb1>
+    b->n = 0;
+     a9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aa3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     aa9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     aad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ab0:	48 89 d6             	mov    %rdx,%rsi
+     ab3:	89 c7                	mov    %eax,%edi
+     ab5:	e8 e4 0d 00 00       	call   189e <fstat>
+     aba:	85 c0                	test   %eax,%eax
+     abc:	75 11                	jne    acf <getbuf+0x89>
+     abe:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     ac2:	66 83 f8 03          	cmp    $0x3,%ax
+     ac6:	75 07                	jne    acf <getbuf+0x89>
+     ac8:	ba 01 00 00 00       	mov    $0x1,%edx
+     acd:	eb 05                	jmp    ad4 <getbuf+0x8e>
+     acf:	ba 00 00 00 00       	mov    $0x0,%edx
+     ad4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ad8:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     adb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ade:	48 98                	cltq
+     ae0:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     ae7:	00 
+     ae8:	48 8d 15 91 35 00 00 	lea    0x3591(%rip),%rdx        # 4080 <obufs>
+     aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     af3:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     afb:	c9                   	leave
+     afc:	c3                   	ret
+
+0000000000000afd <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     afd:	55                   	push   %rbp
+     afe:	48 89 e5             	mov    %rsp,%rbp
+     b01:	48 83 ec 20          	sub    $0x20,%rsp
+     b05:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     b08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     b0c:	78 33                	js     b41 <bflush+0x44>
+     b0e:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     b12:	7f 2d                	jg     b41 <bflush+0x44>
+     b14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b17:	48 98                	cltq
+     b19:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     b20:	00 
+     b21:	48 8d 05 58 35 00 00 	lea    0x3558(%rip),%rax        # 4080 <obufs>
+     b28:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     b2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     b30:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     b35:	74 0a                	je     b41 <bflush+0x44>
+     b37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b3b:	8b 00                	mov    (%rax),%eax
+     b3d:	85 c0                	test   %eax,%eax
+     b3f:	75 07                	jne    b48 <bflush+0x4b>
+    return 0;
+     b41:	b8 00 00 00 00       	mov    $0x0,%eax
+     b46:	eb 3c                	jmp    b84 <bflush+0x87>
+  n = b->n;
+     b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b4c:	8b 00                	mov    (%rax),%eax
+     b4e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     b51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b55:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b5f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     b63:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b69:	48 89 ce             	mov    %rcx,%rsi
+     b6c:	89 c7                	mov    %eax,%edi
+     b6e:	e8 de 0c 00 00       	call   1851 <write>
+     b73:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     b76:	75 07                	jne    b7f <bflush+0x82>
+     b78:	b8 00 00 00 00       	mov    $0x0,%eax
+     b7d:	eb 05                	jmp    b84 <bflush+0x87>
+     b7f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     b84:	c9                   	leave
+     b85:	c3                   	ret
+
+0000000000000b86 <bflushall>:
+
+void bflushall(void) {
+     b86:	55                   	push   %rbp
+     b87:	48 89 e5             	mov    %rsp,%rbp
+     b8a:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     b8e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b95:	eb 0e                	jmp    ba5 <bflushall+0x1f>
+    bflush(fd);
+     b97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b9a:	89 c7                	mov    %eax,%edi
+     b9c:	e8 5c ff ff ff       	call   afd <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     ba1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ba5:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     ba9:	7e ec                	jle    b97 <bflushall+0x11>
+}
+     bab:	90                   	nop
+     bac:	90                   	nop
+     bad:	c9                   	leave
+     bae:	c3                   	ret
+
+0000000000000baf <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     baf:	55                   	push   %rbp
+     bb0:	48 89 e5             	mov    %rsp,%rbp
+     bb3:	48 83 ec 30          	sub    $0x30,%rsp
+     bb7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     bba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     bbe:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     bc1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     bc4:	89 c7                	mov    %eax,%edi
+     bc6:	e8 7b fe ff ff       	call   a46 <getbuf>
+     bcb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     bcf:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     bd4:	75 19                	jne    bef <bwrite+0x40>
+    return write(fd, s, n);
+     bd6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     bd9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     bdd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     be0:	48 89 ce             	mov    %rcx,%rsi
+     be3:	89 c7                	mov    %eax,%edi
+     be5:	e8 67 0c 00 00       	call   1851 <write>
+     bea:	e9 cd 00 00 00       	jmp    cbc <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     bef:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bf6:	e9 92 00 00 00       	jmp    c8d <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     bfb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bff:	8b 00                	mov    (%rax),%eax
+     c01:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c06:	75 18                	jne    c20 <bwrite+0x71>
+     c08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     c0b:	89 c7                	mov    %eax,%edi
+     c0d:	e8 eb fe ff ff       	call   afd <bflush>
+     c12:	85 c0                	test   %eax,%eax
+     c14:	79 0a                	jns    c20 <bwrite+0x71>
+      return -1;
+     c16:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c1b:	e9 9c 00 00 00       	jmp    cbc <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     c20:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     c23:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     c26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     c29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c2d:	8b 00                	mov    (%rax),%eax
+     c2f:	ba 00 02 00 00       	mov    $0x200,%edx
+     c34:	29 c2                	sub    %eax,%edx
+     c36:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     c39:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     c3f:	39 c2                	cmp    %eax,%edx
+     c41:	0f 4e c2             	cmovle %edx,%eax
+     c44:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     c47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c4a:	48 63 d0             	movslq %eax,%rdx
+     c4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c51:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     c55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c59:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c61:	8b 00                	mov    (%rax),%eax
+     c63:	48 98                	cltq
+     c65:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     c69:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c6c:	89 c2                	mov    %eax,%edx
+     c6e:	48 89 cf             	mov    %rcx,%rdi
+     c71:	e8 e9 06 00 00       	call   135f <memmove>
+    b->n += m;
+     c76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c7a:	8b 10                	mov    (%rax),%edx
+     c7c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c7f:	01 c2                	add    %eax,%edx
+     c81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c85:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     c87:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c8a:	01 45 fc             	add    %eax,-0x4(%rbp)
+     c8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c90:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     c93:	0f 8c 62 ff ff ff    	jl     bfb <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     c99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c9d:	8b 40 04             	mov    0x4(%rax),%eax
+     ca0:	85 c0                	test   %eax,%eax
+     ca2:	74 15                	je     cb9 <bwrite+0x10a>
+     ca4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ca7:	89 c7                	mov    %eax,%edi
+     ca9:	e8 4f fe ff ff       	call   afd <bflush>
+     cae:	85 c0                	test   %eax,%eax
+     cb0:	79 07                	jns    cb9 <bwrite+0x10a>
+    return -1;
+     cb2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     cb7:	eb 03                	jmp    cbc <bwrite+0x10d>
+  return n;
+     cb9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     cbc:	c9                   	leave
+     cbd:	c3                   	ret
+
+0000000000000cbe <bputc>:
+
+void bputc(int fd, char c) {
+     cbe:	55                   	push   %rbp
+     cbf:	48 89 e5             	mov    %rsp,%rbp
+     cc2:	48 83 ec 20          	sub    $0x20,%rsp
+     cc6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     cc9:	89 f0                	mov    %esi,%eax
+     ccb:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     cce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     cd1:	89 c7                	mov    %eax,%edi
+     cd3:	e8 6e fd ff ff       	call   a46 <getbuf>
+     cd8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     cdc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     ce1:	75 18                	jne    cfb <bputc+0x3d>
+    write(fd, &c, 1);
+     ce3:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     ce7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     cea:	ba 01 00 00 00       	mov    $0x1,%edx
+     cef:	48 89 ce             	mov    %rcx,%rsi
+     cf2:	89 c7                	mov    %eax,%edi
+     cf4:	e8 58 0b 00 00       	call   1851 <write>
+    return;
+     cf9:	eb 34                	jmp    d2f <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     cfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cff:	8b 00                	mov    (%rax),%eax
+     d01:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d06:	75 0a                	jne    d12 <bputc+0x54>
+    bflush(fd);
+     d08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d0b:	89 c7                	mov    %eax,%edi
+     d0d:	e8 eb fd ff ff       	call   afd <bflush>
+  b->data[b->n++] = c;
+     d12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d16:	8b 00                	mov    (%rax),%eax
+     d18:	8d 48 01             	lea    0x1(%rax),%ecx
+     d1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     d1f:	89 0a                	mov    %ecx,(%rdx)
+     d21:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     d25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     d29:	48 98                	cltq
+     d2b:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     d2f:	c9                   	leave
+     d30:	c3                   	ret
+
+0000000000000d31 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     d31:	55                   	push   %rbp
+     d32:	48 89 e5             	mov    %rsp,%rbp
+     d35:	48 83 ec 10          	sub    $0x10,%rsp
+     d39:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     d3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d40:	78 4c                	js     d8e <bflushtty+0x5d>
+     d42:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     d46:	7f 46                	jg     d8e <bflushtty+0x5d>
+     d48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d4b:	48 98                	cltq
+     d4d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d54:	00 
+     d55:	48 8d 05 24 33 00 00 	lea    0x3324(%rip),%rax        # 4080 <obufs>
+     d5c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d60:	48 85 c0             	test   %rax,%rax
+     d63:	74 29                	je     d8e <bflushtty+0x5d>
+     d65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d68:	48 98                	cltq
+     d6a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d71:	00 
+     d72:	48 8d 05 07 33 00 00 	lea    0x3307(%rip),%rax        # 4080 <obufs>
+     d79:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d7d:	8b 40 04             	mov    0x4(%rax),%eax
+     d80:	85 c0                	test   %eax,%eax
+     d82:	74 0a                	je     d8e <bflushtty+0x5d>
+    bflush(fd);
+     d84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d87:	89 c7                	mov    %eax,%edi
+     d89:	e8 6f fd ff ff       	call   afd <bflush>
+}
+     d8e:	90                   	nop
+     d8f:	c9                   	leave
+     d90:	c3                   	ret
+
+0000000000000d91 <fork>:
+
+int fork(void) {
+     d91:	55                   	push   %rbp
+     d92:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     d95:	e8 ec fd ff ff       	call   b86 <bflushall>
+  return _fork();
+     d9a:	e8 7b 0a 00 00       	call   181a <_fork>
+}
+     d9f:	5d                   	pop    %rbp
+     da0:	c3                   	ret
+
+0000000000000da1 <exit>:
+
+noreturn void exit(void) {
+     da1:	55                   	push   %rbp
+     da2:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     da5:	e8 dc fd ff ff       	call   b86 <bflushall>
+  _exit();
+     daa:	e8 76 0a 00 00       	call   1825 <_exit>
+
+0000000000000daf <exec>:
+}
+
+int exec(char *path, char **argv) {
+     daf:	55                   	push   %rbp
+     db0:	48 89 e5             	mov    %rsp,%rbp
+     db3:	48 83 ec 10          	sub    $0x10,%rsp
+     db7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dbb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     dbf:	e8 c2 fd ff ff       	call   b86 <bflushall>
+  return _exec(path, argv);
+     dc4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dcc:	48 89 d6             	mov    %rdx,%rsi
+     dcf:	48 89 c7             	mov    %rax,%rdi
+     dd2:	e8 9b 0a 00 00       	call   1872 <_exec>
+}
+     dd7:	c9                   	leave
+     dd8:	c3                   	ret
+
+0000000000000dd9 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     dd9:	55                   	push   %rbp
+     dda:	48 89 e5             	mov    %rsp,%rbp
+     ddd:	48 83 ec 20          	sub    $0x20,%rsp
+     de1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     de5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     de9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     ded:	e8 94 fd ff ff       	call   b86 <bflushall>
+  return _spawn(path, argv, fds);
+     df2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     df6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     dfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dfe:	48 89 ce             	mov    %rcx,%rsi
+     e01:	48 89 c7             	mov    %rax,%rdi
+     e04:	e8 2f 0b 00 00       	call   1938 <_spawn>
+}
+     e09:	c9                   	leave
+     e0a:	c3                   	ret
+
+0000000000000e0b <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     e0b:	55                   	push   %rbp
+     e0c:	48 89 e5             	mov    %rsp,%rbp
+     e0f:	48 83 ec 10          	sub    $0x10,%rsp
+     e13:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     e16:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     e1a:	78 69                	js     e85 <close+0x7a>
+     e1c:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     e20:	7f 63                	jg     e85 <close+0x7a>
+     e22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e25:	48 98                	cltq
+     e27:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e2e:	00 
+     e2f:	48 8d 05 4a 32 00 00 	lea    0x324a(%rip),%rax        # 4080 <obufs>
+     e36:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     e3a:	48 85 c0             	test   %rax,%rax
+     e3d:	74 46                	je     e85 <close+0x7a>
+    bflush(fd);
+     e3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e42:	89 c7                	mov    %eax,%edi
+     e44:	e8 b4 fc ff ff       	call   afd <bflush>
+    free(obufs[fd]);
+     e49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e4c:	48 98                	cltq
+     e4e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e55:	00 
+     e56:	48 8d 05 23 32 00 00 	lea    0x3223(%rip),%rax        # 4080 <obufs>
+     e5d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     e61:	48 89 c7             	mov    %rax,%rdi
+     e64:	e8 90 11 00 00       	call   1ff9 <free>
+    obufs[fd] = 0;
+     e69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e6c:	48 98                	cltq
+     e6e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e75:	00 
+     e76:	48 8d 05 03 32 00 00 	lea    0x3203(%rip),%rax        # 4080 <obufs>
+     e7d:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     e84:	00 
+  }
+  return _close(fd);
+     e85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e88:	89 c7                	mov    %eax,%edi
+     e8a:	e8 cd 09 00 00       	call   185c <_close>
+}
+     e8f:	c9                   	leave
+     e90:	c3                   	ret
+
+0000000000000e91 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     e91:	55                   	push   %rbp
+     e92:	48 89 e5             	mov    %rsp,%rbp
+     e95:	53                   	push   %rbx
+     e96:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e9a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     e9e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     ea2:	48 8b 36             	mov    (%rsi),%rsi
+     ea5:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     ea9:	48 29 f7             	sub    %rsi,%rdi
+     eac:	48 89 f9             	mov    %rdi,%rcx
+     eaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+     eb4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     eb8:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     ebc:	48 89 f0             	mov    %rsi,%rax
+     ebf:	ba 00 00 00 00       	mov    $0x0,%edx
+     ec4:	48 89 df             	mov    %rbx,%rdi
+     ec7:	48 0f af f8          	imul   %rax,%rdi
+     ecb:	48 89 d6             	mov    %rdx,%rsi
+     ece:	48 0f af f1          	imul   %rcx,%rsi
+     ed2:	48 01 fe             	add    %rdi,%rsi
+     ed5:	48 f7 e1             	mul    %rcx
+     ed8:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     edc:	48 89 ca             	mov    %rcx,%rdx
+     edf:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     ee4:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     ee8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     eec:	c9                   	leave
+     eed:	c3                   	ret
+
+0000000000000eee <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     eee:	55                   	push   %rbp
+     eef:	48 89 e5             	mov    %rsp,%rbp
+     ef2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ef6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ef9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     efc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f00:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f03:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f06:	48 89 ce             	mov    %rcx,%rsi
+     f09:	48 89 f7             	mov    %rsi,%rdi
+     f0c:	89 d1                	mov    %edx,%ecx
+     f0e:	fc                   	cld
+     f0f:	f3 aa                	rep stos %al,%es:(%rdi)
+     f11:	89 ca                	mov    %ecx,%edx
+     f13:	48 89 fe             	mov    %rdi,%rsi
+     f16:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     f1a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     f1d:	90                   	nop
+     f1e:	5d                   	pop    %rbp
+     f1f:	c3                   	ret
+
+0000000000000f20 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     f20:	55                   	push   %rbp
+     f21:	48 89 e5             	mov    %rsp,%rbp
+     f24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f28:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     f2c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     f30:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     f38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f3c:	48 89 ce             	mov    %rcx,%rsi
+     f3f:	48 89 f7             	mov    %rsi,%rdi
+     f42:	48 89 d1             	mov    %rdx,%rcx
+     f45:	fc                   	cld
+     f46:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     f49:	48 89 ca             	mov    %rcx,%rdx
+     f4c:	48 89 fe             	mov    %rdi,%rsi
+     f4f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     f53:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     f57:	90                   	nop
+     f58:	5d                   	pop    %rbp
+     f59:	c3                   	ret
+
+0000000000000f5a <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     f5a:	55                   	push   %rbp
+     f5b:	48 89 e5             	mov    %rsp,%rbp
+     f5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     f66:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     f6a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f6e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f76:	48 89 cf             	mov    %rcx,%rdi
+     f79:	48 89 d6             	mov    %rdx,%rsi
+     f7c:	48 89 c1             	mov    %rax,%rcx
+     f7f:	fc                   	cld
+     f80:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     f82:	48 89 c8             	mov    %rcx,%rax
+     f85:	48 89 f2             	mov    %rsi,%rdx
+     f88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f8c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     f90:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     f94:	90                   	nop
+     f95:	5d                   	pop    %rbp
+     f96:	c3                   	ret
+
+0000000000000f97 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     f97:	55                   	push   %rbp
+     f98:	48 89 e5             	mov    %rsp,%rbp
+     f9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f9f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     fa3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     fa7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     fab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     faf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fb3:	48 89 cf             	mov    %rcx,%rdi
+     fb6:	48 89 d6             	mov    %rdx,%rsi
+     fb9:	48 89 c1             	mov    %rax,%rcx
+     fbc:	fc                   	cld
+     fbd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     fc0:	48 89 c8             	mov    %rcx,%rax
+     fc3:	48 89 f2             	mov    %rsi,%rdx
+     fc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fca:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     fce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     fd2:	90                   	nop
+     fd3:	5d                   	pop    %rbp
+     fd4:	c3                   	ret
+
+0000000000000fd5 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     fd5:	55                   	push   %rbp
+     fd6:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     fd9:	0f 31                	rdtsc
+     fdb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     fde:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     fe1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     fe4:	48 c1 e0 20          	shl    $0x20,%rax
+     fe8:	48 89 c2             	mov    %rax,%rdx
+     feb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fee:	48 09 d0             	or     %rdx,%rax
+}
+     ff1:	5d                   	pop    %rbp
+     ff2:	c3                   	ret
+
+0000000000000ff3 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     ff3:	55                   	push   %rbp
+     ff4:	48 89 e5             	mov    %rsp,%rbp
+     ff7:	53                   	push   %rbx
+     ff8:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     ffb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     fff:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    1003:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    1007:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    100b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    100e:	0f a2                	cpuid
+    1010:	89 de                	mov    %ebx,%esi
+    1012:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1015:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    1018:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    101b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    101e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1023:	74 09                	je     102e <cpuid+0x3b>
+    *eaxp = eax;
+    1025:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1029:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    102c:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    102e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1033:	74 09                	je     103e <cpuid+0x4b>
+    *ebxp = ebx;
+    1035:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1039:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    103c:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    103e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1043:	74 09                	je     104e <cpuid+0x5b>
+    *ecxp = ecx;
+    1045:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1049:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    104c:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    104e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    1053:	74 09                	je     105e <cpuid+0x6b>
+    *edxp = edx;
+    1055:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1059:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    105c:	89 10                	mov    %edx,(%rax)
+}
+    105e:	90                   	nop
+    105f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1063:	c9                   	leave
+    1064:	c3                   	ret
+
+0000000000001065 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1065:	55                   	push   %rbp
+    1066:	48 89 e5             	mov    %rsp,%rbp
+    1069:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    106d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1071:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1075:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1079:	90                   	nop
+    107a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    107e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1082:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1086:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    108a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    108e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1092:	0f b6 12             	movzbl (%rdx),%edx
+    1095:	88 10                	mov    %dl,(%rax)
+    1097:	0f b6 00             	movzbl (%rax),%eax
+    109a:	84 c0                	test   %al,%al
+    109c:	75 dc                	jne    107a <strcpy+0x15>
+  return os;
+    109e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    10a2:	5d                   	pop    %rbp
+    10a3:	c3                   	ret
+
+00000000000010a4 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    10a4:	55                   	push   %rbp
+    10a5:	48 89 e5             	mov    %rsp,%rbp
+    10a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    10ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    10b0:	eb 0a                	jmp    10bc <strcmp+0x18>
+    p++, q++;
+    10b2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    10b7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    10bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10c0:	0f b6 00             	movzbl (%rax),%eax
+    10c3:	84 c0                	test   %al,%al
+    10c5:	74 12                	je     10d9 <strcmp+0x35>
+    10c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10cb:	0f b6 10             	movzbl (%rax),%edx
+    10ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10d2:	0f b6 00             	movzbl (%rax),%eax
+    10d5:	38 c2                	cmp    %al,%dl
+    10d7:	74 d9                	je     10b2 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    10d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10dd:	0f b6 00             	movzbl (%rax),%eax
+    10e0:	0f b6 d0             	movzbl %al,%edx
+    10e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10e7:	0f b6 00             	movzbl (%rax),%eax
+    10ea:	0f b6 c0             	movzbl %al,%eax
+    10ed:	29 c2                	sub    %eax,%edx
+    10ef:	89 d0                	mov    %edx,%eax
+}
+    10f1:	5d                   	pop    %rbp
+    10f2:	c3                   	ret
+
+00000000000010f3 <strlen>:
+uint strlen(char *s) {
+    10f3:	55                   	push   %rbp
+    10f4:	48 89 e5             	mov    %rsp,%rbp
+    10f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    10fb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1102:	eb 04                	jmp    1108 <strlen+0x15>
+    1104:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1108:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    110b:	48 63 d0             	movslq %eax,%rdx
+    110e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1112:	48 01 d0             	add    %rdx,%rax
+    1115:	0f b6 00             	movzbl (%rax),%eax
+    1118:	84 c0                	test   %al,%al
+    111a:	75 e8                	jne    1104 <strlen+0x11>
+    ;
+  return n;
+    111c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    111f:	5d                   	pop    %rbp
+    1120:	c3                   	ret
+
+0000000000001121 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    1121:	55                   	push   %rbp
+    1122:	48 89 e5             	mov    %rsp,%rbp
+    1125:	53                   	push   %rbx
+    1126:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    112a:	8b 05 04 1f 00 00    	mov    0x1f04(%rip),%eax        # 3034 <erms>
+    1130:	85 c0                	test   %eax,%eax
+    1132:	79 53                	jns    1187 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    1134:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1143:	ba 00 00 00 00       	mov    $0x0,%edx
+    1148:	48 89 c6             	mov    %rax,%rsi
+    114b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1150:	e8 9e fe ff ff       	call   ff3 <cpuid>
+    ebx = 0;
+    1155:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    115c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    115f:	83 f8 06             	cmp    $0x6,%eax
+    1162:	76 14                	jbe    1178 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    1164:	b8 07 00 00 00       	mov    $0x7,%eax
+    1169:	b9 00 00 00 00       	mov    $0x0,%ecx
+    116e:	0f a2                	cpuid
+    1170:	89 d9                	mov    %ebx,%ecx
+    1172:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    1175:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    1178:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    117b:	c1 e8 09             	shr    $0x9,%eax
+    117e:	83 e0 01             	and    $0x1,%eax
+    1181:	89 05 ad 1e 00 00    	mov    %eax,0x1ead(%rip)        # 3034 <erms>
+  }
+  return erms;
+    1187:	8b 05 a7 1e 00 00    	mov    0x1ea7(%rip),%eax        # 3034 <erms>
+}
+    118d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1191:	c9                   	leave
+    1192:	c3                   	ret
+
+0000000000001193 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    1193:	55                   	push   %rbp
+    1194:	48 89 e5             	mov    %rsp,%rbp
+    1197:	48 83 ec 10          	sub    $0x10,%rsp
+    119b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    119f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    11a2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    11a5:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    11a9:	76 09                	jbe    11b4 <memset+0x21>
+    11ab:	e8 71 ff ff ff       	call   1121 <haserms>
+    11b0:	85 c0                	test   %eax,%eax
+    11b2:	74 16                	je     11ca <memset+0x37>
+    stosb(dst, c, n);
+    11b4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    11b7:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    11ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11be:	89 ce                	mov    %ecx,%esi
+    11c0:	48 89 c7             	mov    %rax,%rdi
+    11c3:	e8 26 fd ff ff       	call   eee <stosb>
+    11c8:	eb 58                	jmp    1222 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    11ca:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    11cd:	c1 e8 03             	shr    $0x3,%eax
+    11d0:	89 c6                	mov    %eax,%esi
+    11d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11d5:	48 98                	cltq
+    11d7:	0f b6 c0             	movzbl %al,%eax
+    11da:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    11e1:	01 01 01 
+    11e4:	48 0f af c2          	imul   %rdx,%rax
+    11e8:	48 89 c1             	mov    %rax,%rcx
+    11eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ef:	48 89 f2             	mov    %rsi,%rdx
+    11f2:	48 89 ce             	mov    %rcx,%rsi
+    11f5:	48 89 c7             	mov    %rax,%rdi
+    11f8:	e8 23 fd ff ff       	call   f20 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    11fd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1200:	83 e0 07             	and    $0x7,%eax
+    1203:	89 c2                	mov    %eax,%edx
+    1205:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1208:	83 e0 f8             	and    $0xfffffff8,%eax
+    120b:	48 89 c1             	mov    %rax,%rcx
+    120e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1212:	48 01 c1             	add    %rax,%rcx
+    1215:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1218:	89 c6                	mov    %eax,%esi
+    121a:	48 89 cf             	mov    %rcx,%rdi
+    121d:	e8 cc fc ff ff       	call   eee <stosb>
+  }
+  return dst;
+    1222:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1226:	c9                   	leave
+    1227:	c3                   	ret
+
+0000000000001228 <strchr>:
+
+char *strchr(const char *s, char c) {
+    1228:	55                   	push   %rbp
+    1229:	48 89 e5             	mov    %rsp,%rbp
+    122c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1230:	89 f0                	mov    %esi,%eax
+    1232:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1235:	eb 17                	jmp    124e <strchr+0x26>
+    if (*s == c)
+    1237:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    123b:	0f b6 00             	movzbl (%rax),%eax
+    123e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1241:	75 06                	jne    1249 <strchr+0x21>
+      return (char *)s;
+    1243:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1247:	eb 15                	jmp    125e <strchr+0x36>
+  for (; *s; s++)
+    1249:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    124e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1252:	0f b6 00             	movzbl (%rax),%eax
+    1255:	84 c0                	test   %al,%al
+    1257:	75 de                	jne    1237 <strchr+0xf>
+  return 0;
+    1259:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    125e:	5d                   	pop    %rbp
+    125f:	c3                   	ret
+
+0000000000001260 <gets>:
+
+char *gets(char *buf, int max) {
+    1260:	55                   	push   %rbp
+    1261:	48 89 e5             	mov    %rsp,%rbp
+    1264:	48 83 ec 20          	sub    $0x20,%rsp
+    1268:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    126c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    126f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1276:	eb 48                	jmp    12c0 <gets+0x60>
+    cc = read(0, &c, 1);
+    1278:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    127c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1281:	48 89 c6             	mov    %rax,%rsi
+    1284:	bf 00 00 00 00       	mov    $0x0,%edi
+    1289:	e8 b8 05 00 00       	call   1846 <read>
+    128e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1291:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1295:	7e 36                	jle    12cd <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1297:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    129a:	8d 50 01             	lea    0x1(%rax),%edx
+    129d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12a0:	48 63 d0             	movslq %eax,%rdx
+    12a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12a7:	48 01 c2             	add    %rax,%rdx
+    12aa:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12ae:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    12b0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12b4:	3c 0a                	cmp    $0xa,%al
+    12b6:	74 16                	je     12ce <gets+0x6e>
+    12b8:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12bc:	3c 0d                	cmp    $0xd,%al
+    12be:	74 0e                	je     12ce <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    12c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12c3:	83 c0 01             	add    $0x1,%eax
+    12c6:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    12c9:	7f ad                	jg     1278 <gets+0x18>
+    12cb:	eb 01                	jmp    12ce <gets+0x6e>
+      break;
+    12cd:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    12ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12d1:	48 63 d0             	movslq %eax,%rdx
+    12d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12d8:	48 01 d0             	add    %rdx,%rax
+    12db:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    12de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    12e2:	c9                   	leave
+    12e3:	c3                   	ret
+
+00000000000012e4 <stat>:
+
+int stat(char *n, struct stat *st) {
+    12e4:	55                   	push   %rbp
+    12e5:	48 89 e5             	mov    %rsp,%rbp
+    12e8:	48 83 ec 10          	sub    $0x10,%rsp
+    12ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    12f4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    12f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12fc:	48 89 c6             	mov    %rax,%rsi
+    12ff:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1304:	e8 58 07 00 00       	call   1a61 <fstatat>
+}
+    1309:	c9                   	leave
+    130a:	c3                   	ret
+
+000000000000130b <atoi>:
+
+int atoi(const char *s) {
+    130b:	55                   	push   %rbp
+    130c:	48 89 e5             	mov    %rsp,%rbp
+    130f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1313:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    131a:	eb 28                	jmp    1344 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    131c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    131f:	89 d0                	mov    %edx,%eax
+    1321:	c1 e0 02             	shl    $0x2,%eax
+    1324:	01 d0                	add    %edx,%eax
+    1326:	01 c0                	add    %eax,%eax
+    1328:	89 c1                	mov    %eax,%ecx
+    132a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    132e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1332:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1336:	0f b6 00             	movzbl (%rax),%eax
+    1339:	0f be c0             	movsbl %al,%eax
+    133c:	01 c8                	add    %ecx,%eax
+    133e:	83 e8 30             	sub    $0x30,%eax
+    1341:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1344:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1348:	0f b6 00             	movzbl (%rax),%eax
+    134b:	3c 2f                	cmp    $0x2f,%al
+    134d:	7e 0b                	jle    135a <atoi+0x4f>
+    134f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1353:	0f b6 00             	movzbl (%rax),%eax
+    1356:	3c 39                	cmp    $0x39,%al
+    1358:	7e c2                	jle    131c <atoi+0x11>
+  return n;
+    135a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    135d:	5d                   	pop    %rbp
+    135e:	c3                   	ret
+
+000000000000135f <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    135f:	55                   	push   %rbp
+    1360:	48 89 e5             	mov    %rsp,%rbp
+    1363:	48 83 ec 28          	sub    $0x28,%rsp
+    1367:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    136b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    136f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1372:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1376:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    137a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    137e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1382:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1386:	7f 09                	jg     1391 <memmove+0x32>
+    return vdst;
+    1388:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    138c:	e9 29 01 00 00       	jmp    14ba <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1395:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1399:	0f 83 87 00 00 00    	jae    1426 <memmove+0xc7>
+    139f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13a2:	48 63 d0             	movslq %eax,%rdx
+    13a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13a9:	48 01 d0             	add    %rdx,%rax
+    13ac:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    13b0:	73 74                	jae    1426 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    13b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13b5:	48 98                	cltq
+    13b7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    13bb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13be:	48 98                	cltq
+    13c0:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    13c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    13c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13cc:	48 09 d0             	or     %rdx,%rax
+    13cf:	83 e0 07             	and    $0x7,%eax
+    13d2:	48 85 c0             	test   %rax,%rax
+    13d5:	75 3d                	jne    1414 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    13d7:	eb 1c                	jmp    13f5 <memmove+0x96>
+        src -= 8;
+    13d9:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    13de:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    13e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13e7:	48 8b 10             	mov    (%rax),%rdx
+    13ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13ee:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    13f1:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    13f5:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    13f9:	7f de                	jg     13d9 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    13fb:	eb 17                	jmp    1414 <memmove+0xb5>
+      *--dst = *--src;
+    13fd:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1402:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1407:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    140b:	0f b6 10             	movzbl (%rax),%edx
+    140e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1412:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1414:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1417:	8d 50 ff             	lea    -0x1(%rax),%edx
+    141a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    141d:	85 c0                	test   %eax,%eax
+    141f:	7f dc                	jg     13fd <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1421:	e9 90 00 00 00       	jmp    14b6 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1426:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    142a:	7e 09                	jle    1435 <memmove+0xd6>
+    142c:	e8 f0 fc ff ff       	call   1121 <haserms>
+    1431:	85 c0                	test   %eax,%eax
+    1433:	74 1b                	je     1450 <memmove+0xf1>
+    movsb(dst, src, n);
+    1435:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1438:	48 63 d0             	movslq %eax,%rdx
+    143b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    143f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1443:	48 89 ce             	mov    %rcx,%rsi
+    1446:	48 89 c7             	mov    %rax,%rdi
+    1449:	e8 0c fb ff ff       	call   f5a <movsb>
+    144e:	eb 66                	jmp    14b6 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1450:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1453:	8d 50 07             	lea    0x7(%rax),%edx
+    1456:	85 c0                	test   %eax,%eax
+    1458:	0f 48 c2             	cmovs  %edx,%eax
+    145b:	c1 f8 03             	sar    $0x3,%eax
+    145e:	48 63 d0             	movslq %eax,%rdx
+    1461:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1465:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1469:	48 89 ce             	mov    %rcx,%rsi
+    146c:	48 89 c7             	mov    %rax,%rdi
+    146f:	e8 23 fb ff ff       	call   f97 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1474:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1477:	89 d0                	mov    %edx,%eax
+    1479:	c1 f8 1f             	sar    $0x1f,%eax
+    147c:	c1 e8 1d             	shr    $0x1d,%eax
+    147f:	01 c2                	add    %eax,%edx
+    1481:	83 e2 07             	and    $0x7,%edx
+    1484:	29 c2                	sub    %eax,%edx
+    1486:	89 d0                	mov    %edx,%eax
+    1488:	48 98                	cltq
+    148a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    148d:	83 e2 f8             	and    $0xfffffff8,%edx
+    1490:	48 63 ca             	movslq %edx,%rcx
+    1493:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1497:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    149b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    149e:	83 e2 f8             	and    $0xfffffff8,%edx
+    14a1:	48 63 ca             	movslq %edx,%rcx
+    14a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    14a8:	48 01 d1             	add    %rdx,%rcx
+    14ab:	48 89 c2             	mov    %rax,%rdx
+    14ae:	48 89 cf             	mov    %rcx,%rdi
+    14b1:	e8 a4 fa ff ff       	call   f5a <movsb>
+  }
+  return vdst;
+    14b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    14ba:	c9                   	leave
+    14bb:	c3                   	ret
+
+00000000000014bc <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    14bc:	55                   	push   %rbp
+    14bd:	48 89 e5             	mov    %rsp,%rbp
+    14c0:	48 83 ec 20          	sub    $0x20,%rsp
+    14c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    14c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    14cb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    14d2:	00 00 00 
+    14d5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    14d9:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    14dd:	75 0d                	jne    14ec <clock_gettime+0x30>
+    14df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14e3:	48 8b 40 08          	mov    0x8(%rax),%rax
+    14e7:	48 85 c0             	test   %rax,%rax
+    14ea:	75 13                	jne    14ff <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    14ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    14f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    14f3:	48 89 d6             	mov    %rdx,%rsi
+    14f6:	89 c7                	mov    %eax,%edi
+    14f8:	e8 e0 04 00 00       	call   19dd <_clock_gettime>
+    14fd:	eb 7d                	jmp    157c <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    14ff:	e8 d1 fa ff ff       	call   fd5 <rdtsc>
+    1504:	48 89 c2             	mov    %rax,%rdx
+    1507:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    150b:	48 89 d6             	mov    %rdx,%rsi
+    150e:	48 89 c7             	mov    %rax,%rdi
+    1511:	e8 7b f9 ff ff       	call   e91 <clockns>
+    1516:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    151a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    151e:	48 c1 e8 09          	shr    $0x9,%rax
+    1522:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1529:	b8 44 00 
+    152c:	48 f7 e2             	mul    %rdx
+    152f:	48 89 d0             	mov    %rdx,%rax
+    1532:	48 c1 e8 0b          	shr    $0xb,%rax
+    1536:	48 89 c2             	mov    %rax,%rdx
+    1539:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    153d:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1540:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1544:	48 89 c8             	mov    %rcx,%rax
+    1547:	48 c1 e8 09          	shr    $0x9,%rax
+    154b:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1552:	b8 44 00 
+    1555:	48 f7 e2             	mul    %rdx
+    1558:	48 89 d0             	mov    %rdx,%rax
+    155b:	48 c1 e8 0b          	shr    $0xb,%rax
+    155f:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1566:	48 89 c8             	mov    %rcx,%rax
+    1569:	48 29 d0             	sub    %rdx,%rax
+    156c:	48 89 c2             	mov    %rax,%rdx
+    156f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1573:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1577:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    157c:	c9                   	leave
+    157d:	c3                   	ret
+
+000000000000157e <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    157e:	55                   	push   %rbp
+    157f:	48 89 e5             	mov    %rsp,%rbp
+    1582:	48 83 ec 10          	sub    $0x10,%rsp
+    1586:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    158a:	eb 11                	jmp    159d <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    158c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1590:	be 02 00 00 00       	mov    $0x2,%esi
+    1595:	48 89 c7             	mov    %rax,%rdi
+    1598:	e8 6c 04 00 00       	call   1a09 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    159d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    15a1:	b8 02 00 00 00       	mov    $0x2,%eax
+    15a6:	87 02                	xchg   %eax,(%rdx)
+    15a8:	85 c0                	test   %eax,%eax
+    15aa:	75 e0                	jne    158c <mutex_wait+0xe>
+}
+    15ac:	90                   	nop
+    15ad:	90                   	nop
+    15ae:	c9                   	leave
+    15af:	c3                   	ret
+
+00000000000015b0 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    15b0:	55                   	push   %rbp
+    15b1:	48 89 e5             	mov    %rsp,%rbp
+    15b4:	48 83 ec 20          	sub    $0x20,%rsp
+    15b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    15bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    15c3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    15c7:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    15cb:	8b 02                	mov    (%rdx),%eax
+    15cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+    15d2:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    15d6:	89 c1                	mov    %eax,%ecx
+    15d8:	0f 94 c0             	sete   %al
+    15db:	84 c0                	test   %al,%al
+    15dd:	75 02                	jne    15e1 <mutex_lock+0x31>
+    15df:	89 0a                	mov    %ecx,(%rdx)
+    15e1:	83 f0 01             	xor    $0x1,%eax
+    15e4:	84 c0                	test   %al,%al
+    15e6:	74 0c                	je     15f4 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    15e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ec:	48 89 c7             	mov    %rax,%rdi
+    15ef:	e8 8a ff ff ff       	call   157e <mutex_wait>
+}
+    15f4:	90                   	nop
+    15f5:	c9                   	leave
+    15f6:	c3                   	ret
+
+00000000000015f7 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    15f7:	55                   	push   %rbp
+    15f8:	48 89 e5             	mov    %rsp,%rbp
+    15fb:	48 83 ec 10          	sub    $0x10,%rsp
+    15ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1607:	ba 00 00 00 00       	mov    $0x0,%edx
+    160c:	87 10                	xchg   %edx,(%rax)
+    160e:	83 fa 02             	cmp    $0x2,%edx
+    1611:	75 11                	jne    1624 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1617:	be 01 00 00 00       	mov    $0x1,%esi
+    161c:	48 89 c7             	mov    %rax,%rdi
+    161f:	e8 f0 03 00 00       	call   1a14 <futex_wake>
+}
+    1624:	90                   	nop
+    1625:	c9                   	leave
+    1626:	c3                   	ret
+
+0000000000001627 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1627:	55                   	push   %rbp
+    1628:	48 89 e5             	mov    %rsp,%rbp
+    162b:	48 83 ec 20          	sub    $0x20,%rsp
+    162f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1633:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1637:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    163b:	48 83 c0 04          	add    $0x4,%rax
+    163f:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1647:	8b 00                	mov    (%rax),%eax
+    1649:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    164c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1650:	48 89 c7             	mov    %rax,%rdi
+    1653:	e8 9f ff ff ff       	call   15f7 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1658:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    165c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    165f:	89 d6                	mov    %edx,%esi
+    1661:	48 89 c7             	mov    %rax,%rdi
+    1664:	e8 a0 03 00 00       	call   1a09 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1669:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    166d:	48 83 c0 04          	add    $0x4,%rax
+    1671:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1675:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1679:	48 89 c7             	mov    %rax,%rdi
+    167c:	e8 fd fe ff ff       	call   157e <mutex_wait>
+}
+    1681:	90                   	nop
+    1682:	c9                   	leave
+    1683:	c3                   	ret
+
+0000000000001684 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1684:	55                   	push   %rbp
+    1685:	48 89 e5             	mov    %rsp,%rbp
+    1688:	48 83 ec 10          	sub    $0x10,%rsp
+    168c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1694:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1698:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    169c:	48 83 c0 04          	add    $0x4,%rax
+    16a0:	8b 00                	mov    (%rax),%eax
+    16a2:	85 c0                	test   %eax,%eax
+    16a4:	7e 11                	jle    16b7 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    16a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16aa:	be 01 00 00 00       	mov    $0x1,%esi
+    16af:	48 89 c7             	mov    %rax,%rdi
+    16b2:	e8 5d 03 00 00       	call   1a14 <futex_wake>
+}
+    16b7:	90                   	nop
+    16b8:	c9                   	leave
+    16b9:	c3                   	ret
+
+00000000000016ba <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    16ba:	55                   	push   %rbp
+    16bb:	48 89 e5             	mov    %rsp,%rbp
+    16be:	48 83 ec 10          	sub    $0x10,%rsp
+    16c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    16c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ca:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    16ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16d2:	48 83 c0 04          	add    $0x4,%rax
+    16d6:	8b 00                	mov    (%rax),%eax
+    16d8:	85 c0                	test   %eax,%eax
+    16da:	7e 11                	jle    16ed <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    16dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e0:	be 00 00 00 40       	mov    $0x40000000,%esi
+    16e5:	48 89 c7             	mov    %rax,%rdi
+    16e8:	e8 27 03 00 00       	call   1a14 <futex_wake>
+}
+    16ed:	90                   	nop
+    16ee:	c9                   	leave
+    16ef:	c3                   	ret
+
+00000000000016f0 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    16f0:	55                   	push   %rbp
+    16f1:	48 89 e5             	mov    %rsp,%rbp
+    16f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16f8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    16fb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    16ff:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1703:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1707:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    170b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    170f:	8b 40 04             	mov    0x4(%rax),%eax
+    1712:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1719:	8b 00                	mov    (%rax),%eax
+    171b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    171e:	29 c2                	sub    %eax,%edx
+    1720:	83 fa 1f             	cmp    $0x1f,%edx
+    1723:	76 07                	jbe    172c <ring_push+0x3c>
+    return -1;
+    1725:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    172a:	eb 7e                	jmp    17aa <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    172c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    172f:	83 e0 1f             	and    $0x1f,%eax
+    1732:	89 c2                	mov    %eax,%edx
+    1734:	48 89 d0             	mov    %rdx,%rax
+    1737:	48 01 c0             	add    %rax,%rax
+    173a:	48 01 d0             	add    %rdx,%rax
+    173d:	48 c1 e0 04          	shl    $0x4,%rax
+    1741:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1745:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1749:	48 01 d0             	add    %rdx,%rax
+    174c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1750:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1754:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1757:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    175d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1761:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1769:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    176d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1771:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1775:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1779:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    177d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1781:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1785:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1789:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    178d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1791:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1795:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1798:	8d 50 01             	lea    0x1(%rax),%edx
+    179b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    179f:	48 83 c0 04          	add    $0x4,%rax
+    17a3:	89 10                	mov    %edx,(%rax)
+  return 0;
+    17a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17aa:	5d                   	pop    %rbp
+    17ab:	c3                   	ret
+
+00000000000017ac <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    17ac:	55                   	push   %rbp
+    17ad:	48 89 e5             	mov    %rsp,%rbp
+    17b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17b4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    17b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17bc:	8b 40 08             	mov    0x8(%rax),%eax
+    17bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    17c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17c6:	48 83 c0 0c          	add    $0xc,%rax
+    17ca:	8b 00                	mov    (%rax),%eax
+    17cc:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    17cf:	75 07                	jne    17d8 <ring_pop+0x2c>
+    return -1;
+    17d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    17d6:	eb 40                	jmp    1818 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    17d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17db:	83 e0 1f             	and    $0x1f,%eax
+    17de:	89 c2                	mov    %eax,%edx
+    17e0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    17e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17e8:	89 d2                	mov    %edx,%edx
+    17ea:	48 83 c2 61          	add    $0x61,%rdx
+    17ee:	48 c1 e2 04          	shl    $0x4,%rdx
+    17f2:	48 01 d0             	add    %rdx,%rax
+    17f5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17f9:	48 8b 00             	mov    (%rax),%rax
+    17fc:	48 89 01             	mov    %rax,(%rcx)
+    17ff:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1803:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1806:	8d 50 01             	lea    0x1(%rax),%edx
+    1809:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    180d:	48 83 c0 08          	add    $0x8,%rax
+    1811:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1813:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1818:	5d                   	pop    %rbp
+    1819:	c3                   	ret
+
+000000000000181a <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    181a:	b8 01 00 00 00       	mov    $0x1,%eax
+    181f:	49 89 ca             	mov    %rcx,%r10
+    1822:	0f 05                	syscall
+    1824:	c3                   	ret
+
+0000000000001825 <_exit>:
+SYSCALL_(exit)
+    1825:	b8 02 00 00 00       	mov    $0x2,%eax
+    182a:	49 89 ca             	mov    %rcx,%r10
+    182d:	0f 05                	syscall
+    182f:	c3                   	ret
+
+0000000000001830 <wait>:
+SYSCALL(wait)
+    1830:	b8 03 00 00 00       	mov    $0x3,%eax
+    1835:	49 89 ca             	mov    %rcx,%r10
+    1838:	0f 05                	syscall
+    183a:	c3                   	ret
+
+000000000000183b <pipe>:
+SYSCALL(pipe)
+    183b:	b8 04 00 00 00       	mov    $0x4,%eax
+    1840:	49 89 ca             	mov    %rcx,%r10
+    1843:	0f 05                	syscall
+    1845:	c3                   	ret
+
+0000000000001846 <read>:
+SYSCALL(read)
+    1846:	b8 05 00 00 00       	mov    $0x5,%eax
+    184b:	49 89 ca             	mov    %rcx,%r10
+    184e:	0f 05                	syscall
+    1850:	c3                   	ret
+
+0000000000001851 <write>:
+SYSCALL(write)
+    1851:	b8 10 00 00 00       	mov    $0x10,%eax
+    1856:	49 89 ca             	mov    %rcx,%r10
+    1859:	0f 05                	syscall
+    185b:	c3                   	ret
+
+000000000000185c <_close>:
+SYSCALL_(close)
+    185c:	b8 15 00 00 00       	mov    $0x15,%eax
+    1861:	49 89 ca             	mov    %rcx,%r10
+    1864:	0f 05                	syscall
+    1866:	c3                   	ret
+
+0000000000001867 <kill>:
+SYSCALL(kill)
+    1867:	b8 06 00 00 00       	mov    $0x6,%eax
+    186c:	49 89 ca             	mov    %rcx,%r10
+    186f:	0f 05                	syscall
+    1871:	c3                   	ret
+
+0000000000001872 <_exec>:
+SYSCALL_(exec)
+    1872:	b8 07 00 00 00       	mov    $0x7,%eax
+    1877:	49 89 ca             	mov    %rcx,%r10
+    187a:	0f 05                	syscall
+    187c:	c3                   	ret
+
+000000000000187d <open>:
+SYSCALL(open)
+    187d:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1882:	49 89 ca             	mov    %rcx,%r10
+    1885:	0f 05                	syscall
+    1887:	c3                   	ret
+
+0000000000001888 <mknod>:
+SYSCALL(mknod)
+    1888:	b8 11 00 00 00       	mov    $0x11,%eax
+    188d:	49 89 ca             	mov    %rcx,%r10
+    1890:	0f 05                	syscall
+    1892:	c3                   	ret
+
+0000000000001893 <unlink>:
+SYSCALL(unlink)
+    1893:	b8 12 00 00 00       	mov    $0x12,%eax
+    1898:	49 89 ca             	mov    %rcx,%r10
+    189b:	0f 05                	syscall
+    189d:	c3                   	ret
+
+000000000000189e <fstat>:
+SYSCALL(fstat)
+    189e:	b8 08 00 00 00       	mov    $0x8,%eax
+    18a3:	49 89 ca             	mov    %rcx,%r10
+    18a6:	0f 05                	syscall
+    18a8:	c3                   	ret
+
+00000000000018a9 <link>:
+SYSCALL(link)
+    18a9:	b8 13 00 00 00       	mov    $0x13,%eax
+    18ae:	49 89 ca             	mov    %rcx,%r10
+    18b1:	0f 05                	syscall
+    18b3:	c3                   	ret
+
+00000000000018b4 <mkdir>:
+SYSCALL(mkdir)
+    18b4:	b8 14 00 00 00       	mov    $0x14,%eax
+    18b9:	49 89 ca             	mov    %rcx,%r10
+    18bc:	0f 05                	syscall
+    18be:	c3                   	ret
+
+00000000000018bf <chdir>:
+SYSCALL(chdir)
+    18bf:	b8 09 00 00 00       	mov    $0x9,%eax
+    18c4:	49 89 ca             	mov    %rcx,%r10
+    18c7:	0f 05                	syscall
+    18c9:	c3                   	ret
+
+00000000000018ca <dup>:
+SYSCALL(dup)
+    18ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+    18cf:	49 89 ca             	mov    %rcx,%r10
+    18d2:	0f 05                	syscall
+    18d4:	c3                   	ret
+
+00000000000018d5 <getpid>:
+SYSCALL(getpid)
+    18d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+    18da:	49 89 ca             	mov    %rcx,%r10
+    18dd:	0f 05                	syscall
+    18df:	c3                   	ret
+
+00000000000018e0 <sbrk>:
+SYSCALL(sbrk)
+    18e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+    18e5:	49 89 ca             	mov    %rcx,%r10
+    18e8:	0f 05                	syscall
+    18ea:	c3                   	ret
+
+00000000000018eb <sleep>:
+SYSCALL(sleep)
+    18eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+    18f0:	49 89 ca             	mov    %rcx,%r10
+    18f3:	0f 05                	syscall
+    18f5:	c3                   	ret
+
+00000000000018f6 <uptime>:
+SYSCALL(uptime)
+    18f6:	b8 0e 00 00 00       	mov    $0xe,%eax
+    18fb:	49 89 ca             	mov    %rcx,%r10
+    18fe:	0f 05                	syscall
+    1900:	c3                   	ret
+
+0000000000001901 <sysinfo>:
+SYSCALL(sysinfo)
+    1901:	b8 16 00 00 00       	mov    $0x16,%eax
+    1906:	49 89 ca             	mov    %rcx,%r10
+    1909:	0f 05                	syscall
+    190b:	c3                   	ret
+
+000000000000190c <crashn>:
+SYSCALL(crashn)
+    190c:	b8 17 00 00 00       	mov    $0x17,%eax
+    1911:	49 89 ca             	mov    %rcx,%r10
+    1914:	0f 05                	syscall
+    1916:	c3                   	ret
+
+0000000000001917 <mmap>:
+SYSCALL(mmap)
+    1917:	b8 18 00 00 00       	mov    $0x18,%eax
+    191c:	49 89 ca             	mov    %rcx,%r10
+    191f:	0f 05                	syscall
+    1921:	c3                   	ret
+
+0000000000001922 <munmap>:
+SYSCALL(munmap)
+    1922:	b8 19 00 00 00       	mov    $0x19,%eax
+    1927:	49 89 ca             	mov    %rcx,%r10
+    192a:	0f 05                	syscall
+    192c:	c3                   	ret
+
+000000000000192d <nice>:
+SYSCALL(nice)
+    192d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1932:	49 89 ca             	mov    %rcx,%r10
+    1935:	0f 05                	syscall
+    1937:	c3                   	ret
+
+0000000000001938 <_spawn>:
+SYSCALL_(spawn)
+    1938:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    193d:	49 89 ca             	mov    %rcx,%r10
+    1940:	0f 05                	syscall
+    1942:	c3                   	ret
+
+0000000000001943 <pread>:
+SYSCALL(pread)
+    1943:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1948:	49 89 ca             	mov    %rcx,%r10
+    194b:	0f 05                	syscall
+    194d:	c3                   	ret
+
+000000000000194e <pwrite>:
+SYSCALL(pwrite)
+    194e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1953:	49 89 ca             	mov    %rcx,%r10
+    1956:	0f 05                	syscall
+    1958:	c3                   	ret
+
+0000000000001959 <readv>:
+SYSCALL(readv)
+    1959:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    195e:	49 89 ca             	mov    %rcx,%r10
+    1961:	0f 05                	syscall
+    1963:	c3                   	ret
+
+0000000000001964 <writev>:
+SYSCALL(writev)
+    1964:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1969:	49 89 ca             	mov    %rcx,%r10
+    196c:	0f 05                	syscall
+    196e:	c3                   	ret
+
+000000000000196f <sendfile>:
+SYSCALL(sendfile)
+    196f:	b8 20 00 00 00       	mov    $0x20,%eax
+    1974:	49 89 ca             	mov    %rcx,%r10
+    1977:	0f 05                	syscall
+    1979:	c3                   	ret
+
+000000000000197a <splice>:
+SYSCALL(splice)
+    197a:	b8 21 00 00 00       	mov    $0x21,%eax
+    197f:	49 89 ca             	mov    %rcx,%r10
+    1982:	0f 05                	syscall
+    1984:	c3                   	ret
+
+0000000000001985 <poll>:
+SYSCALL(poll)
+    1985:	b8 22 00 00 00       	mov    $0x22,%eax
+    198a:	49 89 ca             	mov    %rcx,%r10
+    198d:	0f 05                	syscall
+    198f:	c3                   	ret
+
+0000000000001990 <fsync>:
+SYSCALL(fsync)
+    1990:	b8 23 00 00 00       	mov    $0x23,%eax
+    1995:	49 89 ca             	mov    %rcx,%r10
+    1998:	0f 05                	syscall
+    199a:	c3                   	ret
+
+000000000000199b <fdatasync>:
+SYSCALL(fdatasync)
+    199b:	b8 24 00 00 00       	mov    $0x24,%eax
+    19a0:	49 89 ca             	mov    %rcx,%r10
+    19a3:	0f 05                	syscall
+    19a5:	c3                   	ret
+
+00000000000019a6 <lockstat>:
+SYSCALL(lockstat)
+    19a6:	b8 25 00 00 00       	mov    $0x25,%eax
+    19ab:	49 89 ca             	mov    %rcx,%r10
+    19ae:	0f 05                	syscall
+    19b0:	c3                   	ret
+
+00000000000019b1 <syscallstat>:
+SYSCALL(syscallstat)
+    19b1:	b8 26 00 00 00       	mov    $0x26,%eax
+    19b6:	49 89 ca             	mov    %rcx,%r10
+    19b9:	0f 05                	syscall
+    19bb:	c3                   	ret
+
+00000000000019bc <trace>:
+SYSCALL(trace)
+    19bc:	b8 27 00 00 00       	mov    $0x27,%eax
+    19c1:	49 89 ca             	mov    %rcx,%r10
+    19c4:	0f 05                	syscall
+    19c6:	c3                   	ret
+
+00000000000019c7 <profile>:
+SYSCALL(profile)
+    19c7:	b8 28 00 00 00       	mov    $0x28,%eax
+    19cc:	49 89 ca             	mov    %rcx,%r10
+    19cf:	0f 05                	syscall
+    19d1:	c3                   	ret
+
+00000000000019d2 <cycles>:
+SYSCALL(cycles)
+    19d2:	b8 29 00 00 00       	mov    $0x29,%eax
+    19d7:	49 89 ca             	mov    %rcx,%r10
+    19da:	0f 05                	syscall
+    19dc:	c3                   	ret
+
+00000000000019dd <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    19dd:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    19e2:	49 89 ca             	mov    %rcx,%r10
+    19e5:	0f 05                	syscall
+    19e7:	c3                   	ret
+
+00000000000019e8 <consmode>:
+SYSCALL(consmode)
+    19e8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    19ed:	49 89 ca             	mov    %rcx,%r10
+    19f0:	0f 05                	syscall
+    19f2:	c3                   	ret
+
+00000000000019f3 <clone>:
+SYSCALL(clone)
+    19f3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    19f8:	49 89 ca             	mov    %rcx,%r10
+    19fb:	0f 05                	syscall
+    19fd:	c3                   	ret
+
+00000000000019fe <join>:
+SYSCALL(join)
+    19fe:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1a03:	49 89 ca             	mov    %rcx,%r10
+    1a06:	0f 05                	syscall
+    1a08:	c3                   	ret
+
+0000000000001a09 <futex_wait>:
+SYSCALL(futex_wait)
+    1a09:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1a0e:	49 89 ca             	mov    %rcx,%r10
+    1a11:	0f 05                	syscall
+    1a13:	c3                   	ret
+
+0000000000001a14 <futex_wake>:
+SYSCALL(futex_wake)
+    1a14:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1a19:	49 89 ca             	mov    %rcx,%r10
+    1a1c:	0f 05                	syscall
+    1a1e:	c3                   	ret
+
+0000000000001a1f <shmget>:
+SYSCALL(shmget)
+    1a1f:	b8 30 00 00 00       	mov    $0x30,%eax
+    1a24:	49 89 ca             	mov    %rcx,%r10
+    1a27:	0f 05                	syscall
+    1a29:	c3                   	ret
+
+0000000000001a2a <shmat>:
+SYSCALL(shmat)
+    1a2a:	b8 31 00 00 00       	mov    $0x31,%eax
+    1a2f:	49 89 ca             	mov    %rcx,%r10
+    1a32:	0f 05                	syscall
+    1a34:	c3                   	ret
+
+0000000000001a35 <shmdt>:
+SYSCALL(shmdt)
+    1a35:	b8 32 00 00 00       	mov    $0x32,%eax
+    1a3a:	49 89 ca             	mov    %rcx,%r10
+    1a3d:	0f 05                	syscall
+    1a3f:	c3                   	ret
+
+0000000000001a40 <ring_setup>:
+SYSCALL(ring_setup)
+    1a40:	b8 33 00 00 00       	mov    $0x33,%eax
+    1a45:	49 89 ca             	mov    %rcx,%r10
+    1a48:	0f 05                	syscall
+    1a4a:	c3                   	ret
+
+0000000000001a4b <ring_enter>:
+SYSCALL(ring_enter)
+    1a4b:	b8 34 00 00 00       	mov    $0x34,%eax
+    1a50:	49 89 ca             	mov    %rcx,%r10
+    1a53:	0f 05                	syscall
+    1a55:	c3                   	ret
+
+0000000000001a56 <getdents>:
+SYSCALL(getdents)
+    1a56:	b8 35 00 00 00       	mov    $0x35,%eax
+    1a5b:	49 89 ca             	mov    %rcx,%r10
+    1a5e:	0f 05                	syscall
+    1a60:	c3                   	ret
+
+0000000000001a61 <fstatat>:
+SYSCALL(fstatat)
+    1a61:	b8 36 00 00 00       	mov    $0x36,%eax
+    1a66:	49 89 ca             	mov    %rcx,%r10
+    1a69:	0f 05                	syscall
+    1a6b:	c3                   	ret
+
+0000000000001a6c <clone_file>:
+SYSCALL(clone_file)
+    1a6c:	b8 37 00 00 00       	mov    $0x37,%eax
+    1a71:	49 89 ca             	mov    %rcx,%r10
+    1a74:	0f 05                	syscall
+    1a76:	c3                   	ret
+
+0000000000001a77 <fpunch>:
+SYSCALL(fpunch)
+    1a77:	b8 38 00 00 00       	mov    $0x38,%eax
+    1a7c:	49 89 ca             	mov    %rcx,%r10
+    1a7f:	0f 05                	syscall
+    1a81:	c3                   	ret
+
+0000000000001a82 <defrag>:
+SYSCALL(defrag)
+    1a82:	b8 39 00 00 00       	mov    $0x39,%eax
+    1a87:	49 89 ca             	mov    %rcx,%r10
+    1a8a:	0f 05                	syscall
+    1a8c:	c3                   	ret
+
+0000000000001a8d <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1a8d:	55                   	push   %rbp
+    1a8e:	48 89 e5             	mov    %rsp,%rbp
+    1a91:	48 83 ec 20          	sub    $0x20,%rsp
+    1a95:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1a99:	bf 00 00 00 00       	mov    $0x0,%edi
+    1a9e:	e8 3d fe ff ff       	call   18e0 <sbrk>
+    1aa3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1aa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aab:	48 f7 d8             	neg    %rax
+    1aae:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1ab3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1ab7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1abb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1abf:	48 01 c2             	add    %rax,%rdx
+    1ac2:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1ac7:	48 39 c2             	cmp    %rax,%rdx
+    1aca:	73 1e                	jae    1aea <morecore+0x5d>
+    1acc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ad0:	89 c2                	mov    %eax,%edx
+    1ad2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad6:	01 d0                	add    %edx,%eax
+    1ad8:	89 c7                	mov    %eax,%edi
+    1ada:	e8 01 fe ff ff       	call   18e0 <sbrk>
+    1adf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ae3:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1ae8:	75 07                	jne    1af1 <morecore+0x64>
+    return 0;
+    1aea:	b8 00 00 00 00       	mov    $0x0,%eax
+    1aef:	eb 27                	jmp    1b18 <morecore+0x8b>
+  stats.heap += n + pad;
+    1af1:	48 8b 05 b8 26 00 00 	mov    0x26b8(%rip),%rax        # 41b0 <stats+0x50>
+    1af8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1afc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b00:	48 01 ca             	add    %rcx,%rdx
+    1b03:	48 01 d0             	add    %rdx,%rax
+    1b06:	48 89 05 a3 26 00 00 	mov    %rax,0x26a3(%rip)        # 41b0 <stats+0x50>
+  return p + pad;
+    1b0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1b11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b15:	48 01 d0             	add    %rdx,%rax
+}
+    1b18:	c9                   	leave
+    1b19:	c3                   	ret
+
+0000000000001b1a <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1b1a:	55                   	push   %rbp
+    1b1b:	48 89 e5             	mov    %rsp,%rbp
+    1b1e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1b22:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1b26:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1b2d:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1b2e:	48 8d 05 0b 26 00 00 	lea    0x260b(%rip),%rax        # 4140 <runs>
+    1b35:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b39:	eb 1a                	jmp    1b55 <pagefree+0x3b>
+    prev = *rp;
+    1b3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b3f:	48 8b 00             	mov    (%rax),%rax
+    1b42:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b4a:	48 8b 00             	mov    (%rax),%rax
+    1b4d:	48 83 c0 08          	add    $0x8,%rax
+    1b51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b59:	48 8b 00             	mov    (%rax),%rax
+    1b5c:	48 85 c0             	test   %rax,%rax
+    1b5f:	74 0d                	je     1b6e <pagefree+0x54>
+    1b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b65:	48 8b 00             	mov    (%rax),%rax
+    1b68:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1b6c:	72 cd                	jb     1b3b <pagefree+0x21>
+  r = (struct run *)p;
+    1b6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1b76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b7a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1b7e:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b85:	48 8b 10             	mov    (%rax),%rdx
+    1b88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b8c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1b90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b94:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b98:	48 85 c0             	test   %rax,%rax
+    1b9b:	74 48                	je     1be5 <pagefree+0xcb>
+    1b9d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1ba1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1ba5:	48 01 c2             	add    %rax,%rdx
+    1ba8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bac:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bb0:	48 39 c2             	cmp    %rax,%rdx
+    1bb3:	75 30                	jne    1be5 <pagefree+0xcb>
+    r->size += r->next->size;
+    1bb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bb9:	48 8b 10             	mov    (%rax),%rdx
+    1bbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bc0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bc4:	48 8b 00             	mov    (%rax),%rax
+    1bc7:	48 01 c2             	add    %rax,%rdx
+    1bca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bce:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1bd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bd5:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bd9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1bdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1be1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1be5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1bea:	74 46                	je     1c32 <pagefree+0x118>
+    1bec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf0:	48 8b 10             	mov    (%rax),%rdx
+    1bf3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf7:	48 01 d0             	add    %rdx,%rax
+    1bfa:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1bfe:	75 32                	jne    1c32 <pagefree+0x118>
+    prev->size += r->size;
+    1c00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c04:	48 8b 10             	mov    (%rax),%rdx
+    1c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c0b:	48 8b 00             	mov    (%rax),%rax
+    1c0e:	48 01 c2             	add    %rax,%rdx
+    1c11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c15:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1c18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c1c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1c20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c24:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1c28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1c30:	eb 0c                	jmp    1c3e <pagefree+0x124>
+  } else {
+    *rp = r;
+    1c32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c36:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c3a:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1c3d:	90                   	nop
+    1c3e:	90                   	nop
+    1c3f:	5d                   	pop    %rbp
+    1c40:	c3                   	ret
+
+0000000000001c41 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1c41:	55                   	push   %rbp
+    1c42:	48 89 e5             	mov    %rsp,%rbp
+    1c45:	48 83 ec 40          	sub    $0x40,%rsp
+    1c49:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1c4d:	48 8d 05 ec 24 00 00 	lea    0x24ec(%rip),%rax        # 4140 <runs>
+    1c54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c58:	eb 66                	jmp    1cc0 <pagealloc+0x7f>
+    if (r->size == n) {
+    1c5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c5e:	48 8b 00             	mov    (%rax),%rax
+    1c61:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1c65:	75 18                	jne    1c7f <pagealloc+0x3e>
+      *rp = r->next;
+    1c67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c6b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c73:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1c76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c7a:	e9 ca 00 00 00       	jmp    1d49 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1c7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c83:	48 8b 00             	mov    (%rax),%rax
+    1c86:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1c8a:	73 28                	jae    1cb4 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1c8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c90:	48 8b 00             	mov    (%rax),%rax
+    1c93:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1c97:	48 89 c2             	mov    %rax,%rdx
+    1c9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c9e:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1ca1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca5:	48 8b 10             	mov    (%rax),%rdx
+    1ca8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cac:	48 01 d0             	add    %rdx,%rax
+    1caf:	e9 95 00 00 00       	jmp    1d49 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1cb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cb8:	48 83 c0 08          	add    $0x8,%rax
+    1cbc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc4:	48 8b 00             	mov    (%rax),%rax
+    1cc7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ccb:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1cd0:	75 88                	jne    1c5a <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1cd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1cd6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1cda:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1ce1:	00 
+    1ce2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1ce6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1cea:	48 39 c2             	cmp    %rax,%rdx
+    1ced:	48 0f 43 c2          	cmovae %rdx,%rax
+    1cf1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1cf5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cf9:	48 89 c7             	mov    %rax,%rdi
+    1cfc:	e8 8c fd ff ff       	call   1a8d <morecore>
+    1d01:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1d05:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1d0a:	75 07                	jne    1d13 <pagealloc+0xd2>
+    return 0;
+    1d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d11:	eb 36                	jmp    1d49 <pagealloc+0x108>
+  if (m > n)
+    1d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d17:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1d1b:	73 1a                	jae    1d37 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1d1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d21:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1d25:	48 89 c2             	mov    %rax,%rdx
+    1d28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d2c:	48 89 d6             	mov    %rdx,%rsi
+    1d2f:	48 89 c7             	mov    %rax,%rdi
+    1d32:	e8 e3 fd ff ff       	call   1b1a <pagefree>
+  return p + m - n;
+    1d37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1d3b:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1d3f:	48 89 c2             	mov    %rax,%rdx
+    1d42:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d46:	48 01 d0             	add    %rdx,%rax
+}
+    1d49:	c9                   	leave
+    1d4a:	c3                   	ret
+
+0000000000001d4b <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1d4b:	55                   	push   %rbp
+    1d4c:	48 89 e5             	mov    %rsp,%rbp
+    1d4f:	48 83 ec 30          	sub    $0x30,%rsp
+    1d53:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1d56:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1d5b:	e8 e1 fe ff ff       	call   1c41 <pagealloc>
+    1d60:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d64:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1d69:	75 0a                	jne    1d75 <refill+0x2a>
+    return -1;
+    1d6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d70:	e9 da 00 00 00       	jmp    1e4f <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1d75:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1d7c:	00 
+    1d7d:	e9 ba 00 00 00       	jmp    1e3c <refill+0xf1>
+    b = (struct block *)(p + off);
+    1d82:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d8a:	48 01 d0             	add    %rdx,%rax
+    1d8d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1d91:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d94:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d99:	89 c1                	mov    %eax,%ecx
+    1d9b:	48 d3 e2             	shl    %cl,%rdx
+    1d9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1da2:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1da5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1da8:	48 63 d0             	movslq %eax,%rdx
+    1dab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1daf:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1db3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1db6:	48 98                	cltq
+    1db8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1dbf:	00 
+    1dc0:	48 8d 05 39 23 00 00 	lea    0x2339(%rip),%rax        # 4100 <freelist>
+    1dc7:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1dcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1dcf:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1dd3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dd6:	48 98                	cltq
+    1dd8:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1ddf:	00 
+    1de0:	48 8d 15 19 23 00 00 	lea    0x2319(%rip),%rdx        # 4100 <freelist>
+    1de7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1deb:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1def:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1df2:	48 98                	cltq
+    1df4:	48 83 c0 08          	add    $0x8,%rax
+    1df8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1dff:	00 
+    1e00:	48 8d 05 5d 23 00 00 	lea    0x235d(%rip),%rax        # 4164 <stats+0x4>
+    1e07:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1e0a:	8d 48 01             	lea    0x1(%rax),%ecx
+    1e0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e10:	48 98                	cltq
+    1e12:	48 83 c0 08          	add    $0x8,%rax
+    1e16:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1e1d:	00 
+    1e1e:	48 8d 05 3f 23 00 00 	lea    0x233f(%rip),%rax        # 4164 <stats+0x4>
+    1e25:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1e28:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e2b:	ba 20 00 00 00       	mov    $0x20,%edx
+    1e30:	89 c1                	mov    %eax,%ecx
+    1e32:	48 d3 e2             	shl    %cl,%rdx
+    1e35:	48 89 d0             	mov    %rdx,%rax
+    1e38:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1e3c:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1e43:	00 
+    1e44:	0f 86 38 ff ff ff    	jbe    1d82 <refill+0x37>
+  }
+  return 0;
+    1e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1e4f:	c9                   	leave
+    1e50:	c3                   	ret
+
+0000000000001e51 <malloc>:
+
+void *malloc(uint nbytes) {
+    1e51:	55                   	push   %rbp
+    1e52:	48 89 e5             	mov    %rsp,%rbp
+    1e55:	48 83 ec 30          	sub    $0x30,%rsp
+    1e59:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1e5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e5f:	48 83 c0 10          	add    $0x10,%rax
+    1e63:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1e67:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1e6e:	eb 04                	jmp    1e74 <malloc+0x23>
+    1e70:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1e74:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1e78:	7f 16                	jg     1e90 <malloc+0x3f>
+    1e7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e7d:	ba 20 00 00 00       	mov    $0x20,%edx
+    1e82:	89 c1                	mov    %eax,%ecx
+    1e84:	48 d3 e2             	shl    %cl,%rdx
+    1e87:	48 89 d0             	mov    %rdx,%rax
+    1e8a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1e8e:	72 e0                	jb     1e70 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1e90:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1e94:	75 7d                	jne    1f13 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1e96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e9a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1ea0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1ea6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1eaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eae:	48 89 c7             	mov    %rax,%rdi
+    1eb1:	e8 8b fd ff ff       	call   1c41 <pagealloc>
+    1eb6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1eba:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1ebf:	75 0a                	jne    1ecb <malloc+0x7a>
+      return 0;
+    1ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ec6:	e9 2c 01 00 00       	jmp    1ff7 <malloc+0x1a6>
+    h->size = n;
+    1ecb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ecf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ed3:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1ed6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1eda:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1ee1:	00 
+    stats.inuse[LARGE]++;
+    1ee2:	8b 05 98 22 00 00    	mov    0x2298(%rip),%eax        # 4180 <stats+0x20>
+    1ee8:	83 c0 01             	add    $0x1,%eax
+    1eeb:	89 05 8f 22 00 00    	mov    %eax,0x228f(%rip)        # 4180 <stats+0x20>
+    stats.large += n;
+    1ef1:	48 8b 15 b0 22 00 00 	mov    0x22b0(%rip),%rdx        # 41a8 <stats+0x48>
+    1ef8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1efc:	48 01 d0             	add    %rdx,%rax
+    1eff:	48 89 05 a2 22 00 00 	mov    %rax,0x22a2(%rip)        # 41a8 <stats+0x48>
+    return h + 1;
+    1f06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f0a:	48 83 c0 10          	add    $0x10,%rax
+    1f0e:	e9 e4 00 00 00       	jmp    1ff7 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1f13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f16:	48 98                	cltq
+    1f18:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f1f:	00 
+    1f20:	48 8d 05 d9 21 00 00 	lea    0x21d9(%rip),%rax        # 4100 <freelist>
+    1f27:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f2b:	48 85 c0             	test   %rax,%rax
+    1f2e:	75 18                	jne    1f48 <malloc+0xf7>
+    1f30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f33:	89 c7                	mov    %eax,%edi
+    1f35:	e8 11 fe ff ff       	call   1d4b <refill>
+    1f3a:	85 c0                	test   %eax,%eax
+    1f3c:	79 0a                	jns    1f48 <malloc+0xf7>
+    return 0;
+    1f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f43:	e9 af 00 00 00       	jmp    1ff7 <malloc+0x1a6>
+  b = freelist[c];
+    1f48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f4b:	48 98                	cltq
+    1f4d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f54:	00 
+    1f55:	48 8d 05 a4 21 00 00 	lea    0x21a4(%rip),%rax        # 4100 <freelist>
+    1f5c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1f64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f68:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1f6c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1f6f:	48 63 d2             	movslq %edx,%rdx
+    1f72:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1f79:	00 
+    1f7a:	48 8d 15 7f 21 00 00 	lea    0x217f(%rip),%rdx        # 4100 <freelist>
+    1f81:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1f85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f88:	48 98                	cltq
+    1f8a:	48 83 c0 08          	add    $0x8,%rax
+    1f8e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f95:	00 
+    1f96:	48 8d 05 c7 21 00 00 	lea    0x21c7(%rip),%rax        # 4164 <stats+0x4>
+    1f9d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1fa0:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1fa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fa6:	48 98                	cltq
+    1fa8:	48 83 c0 08          	add    $0x8,%rax
+    1fac:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fb3:	00 
+    1fb4:	48 8d 05 a9 21 00 00 	lea    0x21a9(%rip),%rax        # 4164 <stats+0x4>
+    1fbb:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1fbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fc1:	48 98                	cltq
+    1fc3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fca:	00 
+    1fcb:	48 8d 05 8e 21 00 00 	lea    0x218e(%rip),%rax        # 4160 <stats>
+    1fd2:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1fd5:	8d 48 01             	lea    0x1(%rax),%ecx
+    1fd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1fdb:	48 98                	cltq
+    1fdd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fe4:	00 
+    1fe5:	48 8d 05 74 21 00 00 	lea    0x2174(%rip),%rax        # 4160 <stats>
+    1fec:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1fef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ff3:	48 83 c0 10          	add    $0x10,%rax
+}
+    1ff7:	c9                   	leave
+    1ff8:	c3                   	ret
+
+0000000000001ff9 <free>:
+
+void free(void *ap) {
+    1ff9:	55                   	push   %rbp
+    1ffa:	48 89 e5             	mov    %rsp,%rbp
+    1ffd:	48 83 ec 18          	sub    $0x18,%rsp
+    2001:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    2005:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    200a:	0f 84 03 01 00 00    	je     2113 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    2010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2014:	48 83 e8 10          	sub    $0x10,%rax
+    2018:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    201c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2020:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2024:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    2028:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    202d:	75 42                	jne    2071 <free+0x78>
+    stats.inuse[LARGE]--;
+    202f:	8b 05 4b 21 00 00    	mov    0x214b(%rip),%eax        # 4180 <stats+0x20>
+    2035:	83 e8 01             	sub    $0x1,%eax
+    2038:	89 05 42 21 00 00    	mov    %eax,0x2142(%rip)        # 4180 <stats+0x20>
+    stats.large -= b->h.size;
+    203e:	48 8b 15 63 21 00 00 	mov    0x2163(%rip),%rdx        # 41a8 <stats+0x48>
+    2045:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2049:	48 8b 00             	mov    (%rax),%rax
+    204c:	48 29 c2             	sub    %rax,%rdx
+    204f:	48 89 15 52 21 00 00 	mov    %rdx,0x2152(%rip)        # 41a8 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    2056:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    205a:	48 8b 10             	mov    (%rax),%rdx
+    205d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2061:	48 89 d6             	mov    %rdx,%rsi
+    2064:	48 89 c7             	mov    %rax,%rdi
+    2067:	e8 ae fa ff ff       	call   1b1a <pagefree>
+    return;
+    206c:	e9 a3 00 00 00       	jmp    2114 <free+0x11b>
+  }
+  b->next = freelist[c];
+    2071:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2075:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    207c:	00 
+    207d:	48 8d 05 7c 20 00 00 	lea    0x207c(%rip),%rax        # 4100 <freelist>
+    2084:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2088:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    208c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    2090:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2094:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    209b:	00 
+    209c:	48 8d 15 5d 20 00 00 	lea    0x205d(%rip),%rdx        # 4100 <freelist>
+    20a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20a7:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    20ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20af:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20b6:	00 
+    20b7:	48 8d 05 a2 20 00 00 	lea    0x20a2(%rip),%rax        # 4160 <stats>
+    20be:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    20c1:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    20c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20c8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20cf:	00 
+    20d0:	48 8d 05 89 20 00 00 	lea    0x2089(%rip),%rax        # 4160 <stats>
+    20d7:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    20da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20de:	48 83 c0 08          	add    $0x8,%rax
+    20e2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20e9:	00 
+    20ea:	48 8d 05 73 20 00 00 	lea    0x2073(%rip),%rax        # 4164 <stats+0x4>
+    20f1:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    20f4:	8d 48 01             	lea    0x1(%rax),%ecx
+    20f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20fb:	48 83 c0 08          	add    $0x8,%rax
+    20ff:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2106:	00 
+    2107:	48 8d 05 56 20 00 00 	lea    0x2056(%rip),%rax        # 4164 <stats+0x4>
+    210e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    2111:	eb 01                	jmp    2114 <free+0x11b>
+    return;
+    2113:	90                   	nop
+}
+    2114:	c9                   	leave
+    2115:	c3                   	ret
+
+0000000000002116 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    2116:	55                   	push   %rbp
+    2117:	48 89 e5             	mov    %rsp,%rbp
+    211a:	48 83 ec 30          	sub    $0x30,%rsp
+    211e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    2121:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2124:	48 8d 15 3d 03 00 00 	lea    0x33d(%rip),%rdx        # 2468 <benchreport+0x22a>
+    212b:	48 89 d6             	mov    %rdx,%rsi
+    212e:	89 c7                	mov    %eax,%edi
+    2130:	b8 00 00 00 00       	mov    $0x0,%eax
+    2135:	e8 37 e6 ff ff       	call   771 <printf>
+  for (c = 0; c < NCLASS; c++)
+    213a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2141:	eb 67                	jmp    21aa <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2143:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2146:	48 98                	cltq
+    2148:	48 83 c0 08          	add    $0x8,%rax
+    214c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2153:	00 
+    2154:	48 8d 05 09 20 00 00 	lea    0x2009(%rip),%rax        # 4164 <stats+0x4>
+    215b:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    215e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2161:	48 98                	cltq
+    2163:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    216a:	00 
+    216b:	48 8d 05 ee 1f 00 00 	lea    0x1fee(%rip),%rax        # 4160 <stats>
+    2172:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    2175:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2178:	ba 20 00 00 00       	mov    $0x20,%edx
+    217d:	89 c1                	mov    %eax,%ecx
+    217f:	48 d3 e2             	shl    %cl,%rdx
+    2182:	48 89 d0             	mov    %rdx,%rax
+    2185:	89 c1                	mov    %eax,%ecx
+    2187:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    218a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    218d:	41 89 f9             	mov    %edi,%r9d
+    2190:	41 89 f0             	mov    %esi,%r8d
+    2193:	48 8d 35 e5 02 00 00 	lea    0x2e5(%rip),%rsi        # 247f <benchreport+0x241>
+    219a:	89 c7                	mov    %eax,%edi
+    219c:	b8 00 00 00 00       	mov    $0x0,%eax
+    21a1:	e8 cb e5 ff ff       	call   771 <printf>
+  for (c = 0; c < NCLASS; c++)
+    21a6:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    21aa:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    21ae:	7e 93                	jle    2143 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    21b0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    21b7:	00 
+  for (r = runs; r; r = r->next)
+    21b8:	48 8b 05 81 1f 00 00 	mov    0x1f81(%rip),%rax        # 4140 <runs>
+    21bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21c3:	eb 17                	jmp    21dc <mallocstats+0xc6>
+    nfree += r->size;
+    21c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21c9:	48 8b 00             	mov    (%rax),%rax
+    21cc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    21d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21d4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    21d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    21e1:	75 e2                	jne    21c5 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    21e3:	48 8b 05 c6 1f 00 00 	mov    0x1fc6(%rip),%rax        # 41b0 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    21ea:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    21ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21f0:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    21f4:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    21f6:	48 8b 05 ab 1f 00 00 	mov    0x1fab(%rip),%rax        # 41a8 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    21fd:	89 c1                	mov    %eax,%ecx
+    21ff:	8b 15 7b 1f 00 00    	mov    0x1f7b(%rip),%edx        # 4180 <stats+0x20>
+    2205:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2208:	41 89 f9             	mov    %edi,%r9d
+    220b:	41 89 f0             	mov    %esi,%r8d
+    220e:	48 8d 35 7b 02 00 00 	lea    0x27b(%rip),%rsi        # 2490 <benchreport+0x252>
+    2215:	89 c7                	mov    %eax,%edi
+    2217:	b8 00 00 00 00       	mov    $0x0,%eax
+    221c:	e8 50 e5 ff ff       	call   771 <printf>
+}
+    2221:	90                   	nop
+    2222:	c9                   	leave
+    2223:	c3                   	ret
+
+0000000000002224 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    2224:	55                   	push   %rbp
+    2225:	48 89 e5             	mov    %rsp,%rbp
+    2228:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    222c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    2230:	48 89 c7             	mov    %rax,%rdi
+    2233:	e8 9a f7 ff ff       	call   19d2 <cycles>
+  return t;
+    2238:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    223c:	c9                   	leave
+    223d:	c3                   	ret
+
+000000000000223e <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    223e:	55                   	push   %rbp
+    223f:	48 89 e5             	mov    %rsp,%rbp
+    2242:	48 83 ec 30          	sub    $0x30,%rsp
+    2246:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    224a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    224e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    2251:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2255:	0f 8e 24 01 00 00    	jle    237f <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    225b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2262:	e9 98 00 00 00       	jmp    22ff <benchreport+0xc1>
+    x = t[i];
+    2267:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    226a:	48 98                	cltq
+    226c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2273:	00 
+    2274:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2278:	48 01 d0             	add    %rdx,%rax
+    227b:	48 8b 00             	mov    (%rax),%rax
+    227e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2282:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2285:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2288:	eb 33                	jmp    22bd <benchreport+0x7f>
+      t[j] = t[j - 1];
+    228a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    228d:	48 98                	cltq
+    228f:	48 c1 e0 03          	shl    $0x3,%rax
+    2293:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2297:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    229b:	48 01 d0             	add    %rdx,%rax
+    229e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    22a1:	48 63 d2             	movslq %edx,%rdx
+    22a4:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    22ab:	00 
+    22ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    22b0:	48 01 ca             	add    %rcx,%rdx
+    22b3:	48 8b 00             	mov    (%rax),%rax
+    22b6:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    22b9:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    22bd:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    22c1:	7e 1d                	jle    22e0 <benchreport+0xa2>
+    22c3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    22c6:	48 98                	cltq
+    22c8:	48 c1 e0 03          	shl    $0x3,%rax
+    22cc:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    22d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22d4:	48 01 d0             	add    %rdx,%rax
+    22d7:	48 8b 00             	mov    (%rax),%rax
+    22da:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    22de:	72 aa                	jb     228a <benchreport+0x4c>
+    t[j] = x;
+    22e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    22e3:	48 98                	cltq
+    22e5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22ec:	00 
+    22ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22f1:	48 01 c2             	add    %rax,%rdx
+    22f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22f8:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    22fb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    22ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2302:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2305:	0f 8c 5c ff ff ff    	jl     2267 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    230b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    230e:	48 98                	cltq
+    2310:	48 c1 e0 03          	shl    $0x3,%rax
+    2314:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2318:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    231c:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    231f:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    2322:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2325:	89 c2                	mov    %eax,%edx
+    2327:	c1 ea 1f             	shr    $0x1f,%edx
+    232a:	01 d0                	add    %edx,%eax
+    232c:	d1 f8                	sar    %eax
+    232e:	48 98                	cltq
+    2330:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2337:	00 
+    2338:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    233c:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    233f:	48 8b 38             	mov    (%rax),%rdi
+    2342:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2346:	48 8b 30             	mov    (%rax),%rsi
+    2349:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    234c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2350:	48 83 ec 08          	sub    $0x8,%rsp
+    2354:	51                   	push   %rcx
+    2355:	49 89 f9             	mov    %rdi,%r9
+    2358:	49 89 f0             	mov    %rsi,%r8
+    235b:	89 d1                	mov    %edx,%ecx
+    235d:	48 89 c2             	mov    %rax,%rdx
+    2360:	48 8d 05 69 01 00 00 	lea    0x169(%rip),%rax        # 24d0 <benchreport+0x292>
+    2367:	48 89 c6             	mov    %rax,%rsi
+    236a:	bf 01 00 00 00       	mov    $0x1,%edi
+    236f:	b8 00 00 00 00       	mov    $0x0,%eax
+    2374:	e8 f8 e3 ff ff       	call   771 <printf>
+    2379:	48 83 c4 10          	add    $0x10,%rsp
+    237d:	eb 01                	jmp    2380 <benchreport+0x142>
+    return;
+    237f:	90                   	nop
+}
+    2380:	c9                   	leave
+    2381:	c3                   	ret
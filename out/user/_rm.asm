@@ -0,0 +1,3388 @@
+
+out/user/_rm:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+       b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if (argc < 2) {
+       f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+      13:	7f 1e                	jg     33 <main+0x33>
+    printf(2, "Usage: rm files...\n");
+      15:	48 8d 05 5c 1e 00 00 	lea    0x1e5c(%rip),%rax        # 1e78 <benchreport+0x148>
+      1c:	48 89 c6             	mov    %rax,%rsi
+      1f:	bf 02 00 00 00       	mov    $0x2,%edi
+      24:	b8 00 00 00 00       	mov    $0x0,%eax
+      29:	e8 35 02 00 00       	call   263 <printf>
+    exit();
+      2e:	e8 60 08 00 00       	call   893 <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+      33:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+      3a:	eb 5c                	jmp    98 <main+0x98>
+    if (unlink(argv[i]) < 0) {
+      3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      3f:	48 98                	cltq
+      41:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      48:	00 
+      49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      4d:	48 01 d0             	add    %rdx,%rax
+      50:	48 8b 00             	mov    (%rax),%rax
+      53:	48 89 c7             	mov    %rax,%rdi
+      56:	e8 2a 13 00 00       	call   1385 <unlink>
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 35                	jns    94 <main+0x94>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+      5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      62:	48 98                	cltq
+      64:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+      6b:	00 
+      6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      70:	48 01 d0             	add    %rdx,%rax
+      73:	48 8b 00             	mov    (%rax),%rax
+      76:	48 89 c2             	mov    %rax,%rdx
+      79:	48 8d 05 0c 1e 00 00 	lea    0x1e0c(%rip),%rax        # 1e8c <benchreport+0x15c>
+      80:	48 89 c6             	mov    %rax,%rsi
+      83:	bf 02 00 00 00       	mov    $0x2,%edi
+      88:	b8 00 00 00 00       	mov    $0x0,%eax
+      8d:	e8 d1 01 00 00       	call   263 <printf>
+      break;
+      92:	eb 0c                	jmp    a0 <main+0xa0>
+  for (i = 1; i < argc; i++) {
+      94:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      9b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+      9e:	7c 9c                	jl     3c <main+0x3c>
+    }
+  }
+
+  exit();
+      a0:	e8 ee 07 00 00       	call   893 <exit>
+
+00000000000000a5 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      a5:	55                   	push   %rbp
+      a6:	48 89 e5             	mov    %rsp,%rbp
+      a9:	48 83 ec 10          	sub    $0x10,%rsp
+      ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+      b0:	89 f0                	mov    %esi,%eax
+      b2:	88 45 f8             	mov    %al,-0x8(%rbp)
+      b5:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+      b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      bc:	89 d6                	mov    %edx,%esi
+      be:	89 c7                	mov    %eax,%edi
+      c0:	e8 eb 06 00 00       	call   7b0 <bputc>
+      c5:	90                   	nop
+      c6:	c9                   	leave
+      c7:	c3                   	ret
+
+00000000000000c8 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+      c8:	55                   	push   %rbp
+      c9:	48 89 e5             	mov    %rsp,%rbp
+      cc:	48 83 ec 50          	sub    $0x50,%rsp
+      d0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+      d3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+      d7:	89 55 c8             	mov    %edx,-0x38(%rbp)
+      da:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+      dd:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      e1:	74 21                	je     104 <printint64+0x3c>
+      e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      e7:	48 c1 e8 3f          	shr    $0x3f,%rax
+      eb:	0f b6 c0             	movzbl %al,%eax
+      ee:	89 45 bc             	mov    %eax,-0x44(%rbp)
+      f1:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      f5:	74 0d                	je     104 <printint64+0x3c>
+    x = -xx;
+      f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      fb:	48 f7 d8             	neg    %rax
+      fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     102:	eb 08                	jmp    10c <printint64+0x44>
+  else
+    x = xx;
+     104:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     108:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     10c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     113:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     116:	48 63 c8             	movslq %eax,%rcx
+     119:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     11d:	ba 00 00 00 00       	mov    $0x0,%edx
+     122:	48 f7 f1             	div    %rcx
+     125:	48 89 d1             	mov    %rdx,%rcx
+     128:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     12b:	8d 50 01             	lea    0x1(%rax),%edx
+     12e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     131:	48 8d 15 c8 2e 00 00 	lea    0x2ec8(%rip),%rdx        # 3000 <digits.1>
+     138:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     13c:	48 98                	cltq
+     13e:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     142:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     145:	48 63 f0             	movslq %eax,%rsi
+     148:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     14c:	ba 00 00 00 00       	mov    $0x0,%edx
+     151:	48 f7 f6             	div    %rsi
+     154:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     158:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     15d:	75 b4                	jne    113 <printint64+0x4b>
+
+  if (sgn)
+     15f:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     163:	74 2b                	je     190 <printint64+0xc8>
+    buf[i++] = '-';
+     165:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     168:	8d 50 01             	lea    0x1(%rax),%edx
+     16b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     16e:	48 98                	cltq
+     170:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     175:	eb 19                	jmp    190 <printint64+0xc8>
+    putc(fd, buf[i]);
+     177:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     17a:	48 98                	cltq
+     17c:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     181:	0f be d0             	movsbl %al,%edx
+     184:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     187:	89 d6                	mov    %edx,%esi
+     189:	89 c7                	mov    %eax,%edi
+     18b:	e8 15 ff ff ff       	call   a5 <putc>
+  while (--i >= 0)
+     190:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     194:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     198:	79 dd                	jns    177 <printint64+0xaf>
+}
+     19a:	90                   	nop
+     19b:	90                   	nop
+     19c:	c9                   	leave
+     19d:	c3                   	ret
+
+000000000000019e <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     19e:	55                   	push   %rbp
+     19f:	48 89 e5             	mov    %rsp,%rbp
+     1a2:	48 83 ec 30          	sub    $0x30,%rsp
+     1a6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     1a9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     1ac:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     1af:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     1b2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     1b9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     1bd:	74 17                	je     1d6 <printint+0x38>
+     1bf:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     1c3:	79 11                	jns    1d6 <printint+0x38>
+    neg = 1;
+     1c5:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     1cc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1cf:	f7 d8                	neg    %eax
+     1d1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1d4:	eb 06                	jmp    1dc <printint+0x3e>
+  } else {
+    x = xx;
+     1d6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     1d9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     1dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1e3:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     1e6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1e9:	ba 00 00 00 00       	mov    $0x0,%edx
+     1ee:	f7 f1                	div    %ecx
+     1f0:	89 d1                	mov    %edx,%ecx
+     1f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1f5:	8d 50 01             	lea    0x1(%rax),%edx
+     1f8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1fb:	89 c9                	mov    %ecx,%ecx
+     1fd:	48 8d 15 1c 2e 00 00 	lea    0x2e1c(%rip),%rdx        # 3020 <digits.0>
+     204:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     208:	48 98                	cltq
+     20a:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     20e:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     211:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     214:	ba 00 00 00 00       	mov    $0x0,%edx
+     219:	f7 f6                	div    %esi
+     21b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     21e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     222:	75 bf                	jne    1e3 <printint+0x45>
+  if (neg)
+     224:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     228:	74 2b                	je     255 <printint+0xb7>
+    buf[i++] = '-';
+     22a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     22d:	8d 50 01             	lea    0x1(%rax),%edx
+     230:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     233:	48 98                	cltq
+     235:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     23a:	eb 19                	jmp    255 <printint+0xb7>
+    putc(fd, buf[i]);
+     23c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     23f:	48 98                	cltq
+     241:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     246:	0f be d0             	movsbl %al,%edx
+     249:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     24c:	89 d6                	mov    %edx,%esi
+     24e:	89 c7                	mov    %eax,%edi
+     250:	e8 50 fe ff ff       	call   a5 <putc>
+  while (--i >= 0)
+     255:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     259:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     25d:	79 dd                	jns    23c <printint+0x9e>
+}
+     25f:	90                   	nop
+     260:	90                   	nop
+     261:	c9                   	leave
+     262:	c3                   	ret
+
+0000000000000263 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     263:	55                   	push   %rbp
+     264:	48 89 e5             	mov    %rsp,%rbp
+     267:	48 83 ec 70          	sub    $0x70,%rsp
+     26b:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     26e:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     272:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     276:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     27a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     27e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     282:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     289:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     28d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     291:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     295:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     299:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     2a0:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     2a7:	e9 67 02 00 00       	jmp    513 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     2ac:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     2af:	48 63 d0             	movslq %eax,%rdx
+     2b2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     2b6:	48 01 d0             	add    %rdx,%rax
+     2b9:	0f b6 00             	movzbl (%rax),%eax
+     2bc:	0f be c0             	movsbl %al,%eax
+     2bf:	25 ff 00 00 00       	and    $0xff,%eax
+     2c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     2c7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     2cb:	75 30                	jne    2fd <printf+0x9a>
+      if (c == '%') {
+     2cd:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     2d1:	75 13                	jne    2e6 <printf+0x83>
+        state = '%';
+     2d3:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     2da:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     2e1:	e9 29 02 00 00       	jmp    50f <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     2e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     2e9:	0f be d0             	movsbl %al,%edx
+     2ec:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     2ef:	89 d6                	mov    %edx,%esi
+     2f1:	89 c7                	mov    %eax,%edi
+     2f3:	e8 ad fd ff ff       	call   a5 <putc>
+     2f8:	e9 12 02 00 00       	jmp    50f <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     2fd:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     301:	0f 85 08 02 00 00    	jne    50f <printf+0x2ac>
+      if (c == 'l') {
+     307:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     30b:	75 0c                	jne    319 <printf+0xb6>
+        lflag = 1;
+     30d:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     314:	e9 f6 01 00 00       	jmp    50f <printf+0x2ac>
+      } else if (c == 'd') {
+     319:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     31d:	0f 85 93 00 00 00    	jne    3b6 <printf+0x153>
+        if (lflag == 1)
+     323:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     327:	75 47                	jne    370 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     329:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     32c:	83 f8 2f             	cmp    $0x2f,%eax
+     32f:	77 17                	ja     348 <printf+0xe5>
+     331:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     335:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     338:	89 d2                	mov    %edx,%edx
+     33a:	48 01 d0             	add    %rdx,%rax
+     33d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     340:	83 c2 08             	add    $0x8,%edx
+     343:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     346:	eb 0c                	jmp    354 <printf+0xf1>
+     348:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     34c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     350:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     354:	48 8b 30             	mov    (%rax),%rsi
+     357:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     35a:	b9 01 00 00 00       	mov    $0x1,%ecx
+     35f:	ba 0a 00 00 00       	mov    $0xa,%edx
+     364:	89 c7                	mov    %eax,%edi
+     366:	e8 5d fd ff ff       	call   c8 <printint64>
+     36b:	e9 98 01 00 00       	jmp    508 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     370:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     373:	83 f8 2f             	cmp    $0x2f,%eax
+     376:	77 17                	ja     38f <printf+0x12c>
+     378:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     37c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     37f:	89 d2                	mov    %edx,%edx
+     381:	48 01 d0             	add    %rdx,%rax
+     384:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     387:	83 c2 08             	add    $0x8,%edx
+     38a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     38d:	eb 0c                	jmp    39b <printf+0x138>
+     38f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     393:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     397:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     39b:	8b 30                	mov    (%rax),%esi
+     39d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+     3a5:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3aa:	89 c7                	mov    %eax,%edi
+     3ac:	e8 ed fd ff ff       	call   19e <printint>
+     3b1:	e9 52 01 00 00       	jmp    508 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     3b6:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     3ba:	74 0a                	je     3c6 <printf+0x163>
+     3bc:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     3c0:	0f 85 93 00 00 00    	jne    459 <printf+0x1f6>
+        if (lflag == 1)
+     3c6:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     3ca:	75 47                	jne    413 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     3cc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3cf:	83 f8 2f             	cmp    $0x2f,%eax
+     3d2:	77 17                	ja     3eb <printf+0x188>
+     3d4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3d8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3db:	89 d2                	mov    %edx,%edx
+     3dd:	48 01 d0             	add    %rdx,%rax
+     3e0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3e3:	83 c2 08             	add    $0x8,%edx
+     3e6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3e9:	eb 0c                	jmp    3f7 <printf+0x194>
+     3eb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3ef:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3f3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3f7:	48 8b 30             	mov    (%rax),%rsi
+     3fa:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+     402:	ba 10 00 00 00       	mov    $0x10,%edx
+     407:	89 c7                	mov    %eax,%edi
+     409:	e8 ba fc ff ff       	call   c8 <printint64>
+        if (lflag == 1)
+     40e:	e9 f5 00 00 00       	jmp    508 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     413:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     416:	83 f8 2f             	cmp    $0x2f,%eax
+     419:	77 17                	ja     432 <printf+0x1cf>
+     41b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     41f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     422:	89 d2                	mov    %edx,%edx
+     424:	48 01 d0             	add    %rdx,%rax
+     427:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     42a:	83 c2 08             	add    $0x8,%edx
+     42d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     430:	eb 0c                	jmp    43e <printf+0x1db>
+     432:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     436:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     43a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     43e:	8b 30                	mov    (%rax),%esi
+     440:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     443:	b9 00 00 00 00       	mov    $0x0,%ecx
+     448:	ba 10 00 00 00       	mov    $0x10,%edx
+     44d:	89 c7                	mov    %eax,%edi
+     44f:	e8 4a fd ff ff       	call   19e <printint>
+        if (lflag == 1)
+     454:	e9 af 00 00 00       	jmp    508 <printf+0x2a5>
+      } else if (c == 's') {
+     459:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     45d:	75 6e                	jne    4cd <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     45f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     462:	83 f8 2f             	cmp    $0x2f,%eax
+     465:	77 17                	ja     47e <printf+0x21b>
+     467:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     46b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     46e:	89 d2                	mov    %edx,%edx
+     470:	48 01 d0             	add    %rdx,%rax
+     473:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     476:	83 c2 08             	add    $0x8,%edx
+     479:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     47c:	eb 0c                	jmp    48a <printf+0x227>
+     47e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     482:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     486:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     48a:	48 8b 00             	mov    (%rax),%rax
+     48d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     491:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     496:	75 28                	jne    4c0 <printf+0x25d>
+          s = "(null)";
+     498:	48 8d 05 06 1a 00 00 	lea    0x1a06(%rip),%rax        # 1ea5 <benchreport+0x175>
+     49f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     4a3:	eb 1b                	jmp    4c0 <printf+0x25d>
+          putc(fd, *s);
+     4a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     4a9:	0f b6 00             	movzbl (%rax),%eax
+     4ac:	0f be d0             	movsbl %al,%edx
+     4af:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4b2:	89 d6                	mov    %edx,%esi
+     4b4:	89 c7                	mov    %eax,%edi
+     4b6:	e8 ea fb ff ff       	call   a5 <putc>
+        for (; *s; s++)
+     4bb:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     4c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     4c4:	0f b6 00             	movzbl (%rax),%eax
+     4c7:	84 c0                	test   %al,%al
+     4c9:	75 da                	jne    4a5 <printf+0x242>
+     4cb:	eb 3b                	jmp    508 <printf+0x2a5>
+      } else if (c == '%') {
+     4cd:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     4d1:	75 14                	jne    4e7 <printf+0x284>
+        putc(fd, c);
+     4d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4d6:	0f be d0             	movsbl %al,%edx
+     4d9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4dc:	89 d6                	mov    %edx,%esi
+     4de:	89 c7                	mov    %eax,%edi
+     4e0:	e8 c0 fb ff ff       	call   a5 <putc>
+     4e5:	eb 21                	jmp    508 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     4e7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4ea:	be 25 00 00 00       	mov    $0x25,%esi
+     4ef:	89 c7                	mov    %eax,%edi
+     4f1:	e8 af fb ff ff       	call   a5 <putc>
+        putc(fd, c);
+     4f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     4f9:	0f be d0             	movsbl %al,%edx
+     4fc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4ff:	89 d6                	mov    %edx,%esi
+     501:	89 c7                	mov    %eax,%edi
+     503:	e8 9d fb ff ff       	call   a5 <putc>
+      }
+      state = 0;
+     508:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     50f:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     513:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     516:	48 63 d0             	movslq %eax,%rdx
+     519:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     51d:	48 01 d0             	add    %rdx,%rax
+     520:	0f b6 00             	movzbl (%rax),%eax
+     523:	84 c0                	test   %al,%al
+     525:	0f 85 81 fd ff ff    	jne    2ac <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     52b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     52e:	89 c7                	mov    %eax,%edi
+     530:	e8 ee 02 00 00       	call   823 <bflushtty>
+}
+     535:	90                   	nop
+     536:	c9                   	leave
+     537:	c3                   	ret
+
+0000000000000538 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     538:	55                   	push   %rbp
+     539:	48 89 e5             	mov    %rsp,%rbp
+     53c:	48 83 ec 30          	sub    $0x30,%rsp
+     540:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     543:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     547:	78 06                	js     54f <getbuf+0x17>
+     549:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     54d:	7e 0a                	jle    559 <getbuf+0x21>
+    return 0;
+     54f:	b8 00 00 00 00       	mov    $0x0,%eax
+     554:	e9 94 00 00 00       	jmp    5ed <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     559:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     55c:	48 98                	cltq
+     55e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     565:	00 
+     566:	48 8d 05 d3 2a 00 00 	lea    0x2ad3(%rip),%rax        # 3040 <obufs>
+     56d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     571:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     575:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     57a:	75 6d                	jne    5e9 <getbuf+0xb1>
+     57c:	bf 08 02 00 00       	mov    $0x208,%edi
+     581:	e8 bd 13 00 00       	call   1943 <malloc>
+     586:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     58a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     58f:	74 58                	je     5e9 <getbuf+0xb1>
+    b->n = 0;
+     591:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     595:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     59b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     59f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5a2:	48 89 d6             	mov    %rdx,%rsi
+     5a5:	89 c7                	mov    %eax,%edi
+     5a7:	e8 e4 0d 00 00       	call   1390 <fstat>
+     5ac:	85 c0                	test   %eax,%eax
+     5ae:	75 11                	jne    5c1 <getbuf+0x89>
+     5b0:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     5b4:	66 83 f8 03          	cmp    $0x3,%ax
+     5b8:	75 07                	jne    5c1 <getbuf+0x89>
+     5ba:	ba 01 00 00 00       	mov    $0x1,%edx
+     5bf:	eb 05                	jmp    5c6 <getbuf+0x8e>
+     5c1:	ba 00 00 00 00       	mov    $0x0,%edx
+     5c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5ca:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     5cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     5d0:	48 98                	cltq
+     5d2:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     5d9:	00 
+     5da:	48 8d 15 5f 2a 00 00 	lea    0x2a5f(%rip),%rdx        # 3040 <obufs>
+     5e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5e5:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     5e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5ed:	c9                   	leave
+     5ee:	c3                   	ret
+
+00000000000005ef <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     5ef:	55                   	push   %rbp
+     5f0:	48 89 e5             	mov    %rsp,%rbp
+     5f3:	48 83 ec 20          	sub    $0x20,%rsp
+     5f7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     5fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     5fe:	78 33                	js     633 <bflush+0x44>
+     600:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     604:	7f 2d                	jg     633 <bflush+0x44>
+     606:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     609:	48 98                	cltq
+     60b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     612:	00 
+     613:	48 8d 05 26 2a 00 00 	lea    0x2a26(%rip),%rax        # 3040 <obufs>
+     61a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     61e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     622:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     627:	74 0a                	je     633 <bflush+0x44>
+     629:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     62d:	8b 00                	mov    (%rax),%eax
+     62f:	85 c0                	test   %eax,%eax
+     631:	75 07                	jne    63a <bflush+0x4b>
+    return 0;
+     633:	b8 00 00 00 00       	mov    $0x0,%eax
+     638:	eb 3c                	jmp    676 <bflush+0x87>
+  n = b->n;
+     63a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     63e:	8b 00                	mov    (%rax),%eax
+     640:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     643:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     647:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     64d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     651:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     655:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     658:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     65b:	48 89 ce             	mov    %rcx,%rsi
+     65e:	89 c7                	mov    %eax,%edi
+     660:	e8 de 0c 00 00       	call   1343 <write>
+     665:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     668:	75 07                	jne    671 <bflush+0x82>
+     66a:	b8 00 00 00 00       	mov    $0x0,%eax
+     66f:	eb 05                	jmp    676 <bflush+0x87>
+     671:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     676:	c9                   	leave
+     677:	c3                   	ret
+
+0000000000000678 <bflushall>:
+
+void bflushall(void) {
+     678:	55                   	push   %rbp
+     679:	48 89 e5             	mov    %rsp,%rbp
+     67c:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     680:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     687:	eb 0e                	jmp    697 <bflushall+0x1f>
+    bflush(fd);
+     689:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     68c:	89 c7                	mov    %eax,%edi
+     68e:	e8 5c ff ff ff       	call   5ef <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     693:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     697:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     69b:	7e ec                	jle    689 <bflushall+0x11>
+}
+     69d:	90                   	nop
+     69e:	90                   	nop
+     69f:	c9                   	leave
+     6a0:	c3                   	ret
+
+00000000000006a1 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     6a1:	55                   	push   %rbp
+     6a2:	48 89 e5             	mov    %rsp,%rbp
+     6a5:	48 83 ec 30          	sub    $0x30,%rsp
+     6a9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     6ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     6b0:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     6b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6b6:	89 c7                	mov    %eax,%edi
+     6b8:	e8 7b fe ff ff       	call   538 <getbuf>
+     6bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     6c1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     6c6:	75 19                	jne    6e1 <bwrite+0x40>
+    return write(fd, s, n);
+     6c8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     6cb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     6cf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6d2:	48 89 ce             	mov    %rcx,%rsi
+     6d5:	89 c7                	mov    %eax,%edi
+     6d7:	e8 67 0c 00 00       	call   1343 <write>
+     6dc:	e9 cd 00 00 00       	jmp    7ae <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     6e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     6e8:	e9 92 00 00 00       	jmp    77f <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     6ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6f1:	8b 00                	mov    (%rax),%eax
+     6f3:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6f8:	75 18                	jne    712 <bwrite+0x71>
+     6fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6fd:	89 c7                	mov    %eax,%edi
+     6ff:	e8 eb fe ff ff       	call   5ef <bflush>
+     704:	85 c0                	test   %eax,%eax
+     706:	79 0a                	jns    712 <bwrite+0x71>
+      return -1;
+     708:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     70d:	e9 9c 00 00 00       	jmp    7ae <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     712:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     715:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     718:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     71b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     71f:	8b 00                	mov    (%rax),%eax
+     721:	ba 00 02 00 00       	mov    $0x200,%edx
+     726:	29 c2                	sub    %eax,%edx
+     728:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     72b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     72e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     731:	39 c2                	cmp    %eax,%edx
+     733:	0f 4e c2             	cmovle %edx,%eax
+     736:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     739:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     73c:	48 63 d0             	movslq %eax,%rdx
+     73f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     743:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     747:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     74b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     74f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     753:	8b 00                	mov    (%rax),%eax
+     755:	48 98                	cltq
+     757:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     75b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     75e:	89 c2                	mov    %eax,%edx
+     760:	48 89 cf             	mov    %rcx,%rdi
+     763:	e8 e9 06 00 00       	call   e51 <memmove>
+    b->n += m;
+     768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     76c:	8b 10                	mov    (%rax),%edx
+     76e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     771:	01 c2                	add    %eax,%edx
+     773:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     777:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     779:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     77c:	01 45 fc             	add    %eax,-0x4(%rbp)
+     77f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     782:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     785:	0f 8c 62 ff ff ff    	jl     6ed <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     78b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     78f:	8b 40 04             	mov    0x4(%rax),%eax
+     792:	85 c0                	test   %eax,%eax
+     794:	74 15                	je     7ab <bwrite+0x10a>
+     796:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     799:	89 c7                	mov    %eax,%edi
+     79b:	e8 4f fe ff ff       	call   5ef <bflush>
+     7a0:	85 c0                	test   %eax,%eax
+     7a2:	79 07                	jns    7ab <bwrite+0x10a>
+    return -1;
+     7a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7a9:	eb 03                	jmp    7ae <bwrite+0x10d>
+  return n;
+     7ab:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     7ae:	c9                   	leave
+     7af:	c3                   	ret
+
+00000000000007b0 <bputc>:
+
+void bputc(int fd, char c) {
+     7b0:	55                   	push   %rbp
+     7b1:	48 89 e5             	mov    %rsp,%rbp
+     7b4:	48 83 ec 20          	sub    $0x20,%rsp
+     7b8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     7bb:	89 f0                	mov    %esi,%eax
+     7bd:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     7c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7c3:	89 c7                	mov    %eax,%edi
+     7c5:	e8 6e fd ff ff       	call   538 <getbuf>
+     7ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     7ce:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     7d3:	75 18                	jne    7ed <bputc+0x3d>
+    write(fd, &c, 1);
+     7d5:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     7d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7dc:	ba 01 00 00 00       	mov    $0x1,%edx
+     7e1:	48 89 ce             	mov    %rcx,%rsi
+     7e4:	89 c7                	mov    %eax,%edi
+     7e6:	e8 58 0b 00 00       	call   1343 <write>
+    return;
+     7eb:	eb 34                	jmp    821 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     7ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7f1:	8b 00                	mov    (%rax),%eax
+     7f3:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7f8:	75 0a                	jne    804 <bputc+0x54>
+    bflush(fd);
+     7fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7fd:	89 c7                	mov    %eax,%edi
+     7ff:	e8 eb fd ff ff       	call   5ef <bflush>
+  b->data[b->n++] = c;
+     804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     808:	8b 00                	mov    (%rax),%eax
+     80a:	8d 48 01             	lea    0x1(%rax),%ecx
+     80d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     811:	89 0a                	mov    %ecx,(%rdx)
+     813:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     817:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     81b:	48 98                	cltq
+     81d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     821:	c9                   	leave
+     822:	c3                   	ret
+
+0000000000000823 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     823:	55                   	push   %rbp
+     824:	48 89 e5             	mov    %rsp,%rbp
+     827:	48 83 ec 10          	sub    $0x10,%rsp
+     82b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     82e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     832:	78 4c                	js     880 <bflushtty+0x5d>
+     834:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     838:	7f 46                	jg     880 <bflushtty+0x5d>
+     83a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     83d:	48 98                	cltq
+     83f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     846:	00 
+     847:	48 8d 05 f2 27 00 00 	lea    0x27f2(%rip),%rax        # 3040 <obufs>
+     84e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     852:	48 85 c0             	test   %rax,%rax
+     855:	74 29                	je     880 <bflushtty+0x5d>
+     857:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     85a:	48 98                	cltq
+     85c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     863:	00 
+     864:	48 8d 05 d5 27 00 00 	lea    0x27d5(%rip),%rax        # 3040 <obufs>
+     86b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     86f:	8b 40 04             	mov    0x4(%rax),%eax
+     872:	85 c0                	test   %eax,%eax
+     874:	74 0a                	je     880 <bflushtty+0x5d>
+    bflush(fd);
+     876:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     879:	89 c7                	mov    %eax,%edi
+     87b:	e8 6f fd ff ff       	call   5ef <bflush>
+}
+     880:	90                   	nop
+     881:	c9                   	leave
+     882:	c3                   	ret
+
+0000000000000883 <fork>:
+
+int fork(void) {
+     883:	55                   	push   %rbp
+     884:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     887:	e8 ec fd ff ff       	call   678 <bflushall>
+  return _fork();
+     88c:	e8 7b 0a 00 00       	call   130c <_fork>
+}
+     891:	5d                   	pop    %rbp
+     892:	c3                   	ret
+
+0000000000000893 <exit>:
+
+noreturn void exit(void) {
+     893:	55                   	push   %rbp
+     894:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     897:	e8 dc fd ff ff       	call   678 <bflushall>
+  _exit();
+     89c:	e8 76 0a 00 00       	call   1317 <_exit>
+
+00000000000008a1 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     8a1:	55                   	push   %rbp
+     8a2:	48 89 e5             	mov    %rsp,%rbp
+     8a5:	48 83 ec 10          	sub    $0x10,%rsp
+     8a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     8b1:	e8 c2 fd ff ff       	call   678 <bflushall>
+  return _exec(path, argv);
+     8b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     8ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8be:	48 89 d6             	mov    %rdx,%rsi
+     8c1:	48 89 c7             	mov    %rax,%rdi
+     8c4:	e8 9b 0a 00 00       	call   1364 <_exec>
+}
+     8c9:	c9                   	leave
+     8ca:	c3                   	ret
+
+00000000000008cb <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     8cb:	55                   	push   %rbp
+     8cc:	48 89 e5             	mov    %rsp,%rbp
+     8cf:	48 83 ec 20          	sub    $0x20,%rsp
+     8d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     8d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     8db:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     8df:	e8 94 fd ff ff       	call   678 <bflushall>
+  return _spawn(path, argv, fds);
+     8e4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     8e8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     8ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8f0:	48 89 ce             	mov    %rcx,%rsi
+     8f3:	48 89 c7             	mov    %rax,%rdi
+     8f6:	e8 2f 0b 00 00       	call   142a <_spawn>
+}
+     8fb:	c9                   	leave
+     8fc:	c3                   	ret
+
+00000000000008fd <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     8fd:	55                   	push   %rbp
+     8fe:	48 89 e5             	mov    %rsp,%rbp
+     901:	48 83 ec 10          	sub    $0x10,%rsp
+     905:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     908:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     90c:	78 69                	js     977 <close+0x7a>
+     90e:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     912:	7f 63                	jg     977 <close+0x7a>
+     914:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     917:	48 98                	cltq
+     919:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     920:	00 
+     921:	48 8d 05 18 27 00 00 	lea    0x2718(%rip),%rax        # 3040 <obufs>
+     928:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     92c:	48 85 c0             	test   %rax,%rax
+     92f:	74 46                	je     977 <close+0x7a>
+    bflush(fd);
+     931:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     934:	89 c7                	mov    %eax,%edi
+     936:	e8 b4 fc ff ff       	call   5ef <bflush>
+    free(obufs[fd]);
+     93b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     93e:	48 98                	cltq
+     940:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     947:	00 
+     948:	48 8d 05 f1 26 00 00 	lea    0x26f1(%rip),%rax        # 3040 <obufs>
+     94f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     953:	48 89 c7             	mov    %rax,%rdi
+     956:	e8 90 11 00 00       	call   1aeb <free>
+    obufs[fd] = 0;
+     95b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     95e:	48 98                	cltq
+     960:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     967:	00 
+     968:	48 8d 05 d1 26 00 00 	lea    0x26d1(%rip),%rax        # 3040 <obufs>
+     96f:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     976:	00 
+  }
+  return _close(fd);
+     977:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     97a:	89 c7                	mov    %eax,%edi
+     97c:	e8 cd 09 00 00       	call   134e <_close>
+}
+     981:	c9                   	leave
+     982:	c3                   	ret
+
+0000000000000983 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     983:	55                   	push   %rbp
+     984:	48 89 e5             	mov    %rsp,%rbp
+     987:	53                   	push   %rbx
+     988:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     98c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     990:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     994:	48 8b 36             	mov    (%rsi),%rsi
+     997:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     99b:	48 29 f7             	sub    %rsi,%rdi
+     99e:	48 89 f9             	mov    %rdi,%rcx
+     9a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     9a6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     9aa:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     9ae:	48 89 f0             	mov    %rsi,%rax
+     9b1:	ba 00 00 00 00       	mov    $0x0,%edx
+     9b6:	48 89 df             	mov    %rbx,%rdi
+     9b9:	48 0f af f8          	imul   %rax,%rdi
+     9bd:	48 89 d6             	mov    %rdx,%rsi
+     9c0:	48 0f af f1          	imul   %rcx,%rsi
+     9c4:	48 01 fe             	add    %rdi,%rsi
+     9c7:	48 f7 e1             	mul    %rcx
+     9ca:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     9ce:	48 89 ca             	mov    %rcx,%rdx
+     9d1:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     9d6:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     9da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     9de:	c9                   	leave
+     9df:	c3                   	ret
+
+00000000000009e0 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     9e0:	55                   	push   %rbp
+     9e1:	48 89 e5             	mov    %rsp,%rbp
+     9e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9e8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     9eb:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     9ee:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9f2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     9f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     9f8:	48 89 ce             	mov    %rcx,%rsi
+     9fb:	48 89 f7             	mov    %rsi,%rdi
+     9fe:	89 d1                	mov    %edx,%ecx
+     a00:	fc                   	cld
+     a01:	f3 aa                	rep stos %al,%es:(%rdi)
+     a03:	89 ca                	mov    %ecx,%edx
+     a05:	48 89 fe             	mov    %rdi,%rsi
+     a08:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a0c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a0f:	90                   	nop
+     a10:	5d                   	pop    %rbp
+     a11:	c3                   	ret
+
+0000000000000a12 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     a12:	55                   	push   %rbp
+     a13:	48 89 e5             	mov    %rsp,%rbp
+     a16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a1a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a1e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     a22:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a2e:	48 89 ce             	mov    %rcx,%rsi
+     a31:	48 89 f7             	mov    %rsi,%rdi
+     a34:	48 89 d1             	mov    %rdx,%rcx
+     a37:	fc                   	cld
+     a38:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     a3b:	48 89 ca             	mov    %rcx,%rdx
+     a3e:	48 89 fe             	mov    %rdi,%rsi
+     a41:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a45:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     a49:	90                   	nop
+     a4a:	5d                   	pop    %rbp
+     a4b:	c3                   	ret
+
+0000000000000a4c <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     a4c:	55                   	push   %rbp
+     a4d:	48 89 e5             	mov    %rsp,%rbp
+     a50:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a54:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a58:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     a5c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a68:	48 89 cf             	mov    %rcx,%rdi
+     a6b:	48 89 d6             	mov    %rdx,%rsi
+     a6e:	48 89 c1             	mov    %rax,%rcx
+     a71:	fc                   	cld
+     a72:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     a74:	48 89 c8             	mov    %rcx,%rax
+     a77:	48 89 f2             	mov    %rsi,%rdx
+     a7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a7e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a82:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a86:	90                   	nop
+     a87:	5d                   	pop    %rbp
+     a88:	c3                   	ret
+
+0000000000000a89 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     a89:	55                   	push   %rbp
+     a8a:	48 89 e5             	mov    %rsp,%rbp
+     a8d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a91:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a95:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     a99:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a9d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     aa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     aa5:	48 89 cf             	mov    %rcx,%rdi
+     aa8:	48 89 d6             	mov    %rdx,%rsi
+     aab:	48 89 c1             	mov    %rax,%rcx
+     aae:	fc                   	cld
+     aaf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     ab2:	48 89 c8             	mov    %rcx,%rax
+     ab5:	48 89 f2             	mov    %rsi,%rdx
+     ab8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     abc:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     ac0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     ac4:	90                   	nop
+     ac5:	5d                   	pop    %rbp
+     ac6:	c3                   	ret
+
+0000000000000ac7 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     ac7:	55                   	push   %rbp
+     ac8:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     acb:	0f 31                	rdtsc
+     acd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     ad0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     ad3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     ad6:	48 c1 e0 20          	shl    $0x20,%rax
+     ada:	48 89 c2             	mov    %rax,%rdx
+     add:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ae0:	48 09 d0             	or     %rdx,%rax
+}
+     ae3:	5d                   	pop    %rbp
+     ae4:	c3                   	ret
+
+0000000000000ae5 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     ae5:	55                   	push   %rbp
+     ae6:	48 89 e5             	mov    %rsp,%rbp
+     ae9:	53                   	push   %rbx
+     aea:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     aed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     af1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     af5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     af9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     afd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     b00:	0f a2                	cpuid
+     b02:	89 de                	mov    %ebx,%esi
+     b04:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     b07:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     b0a:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     b0d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     b10:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     b15:	74 09                	je     b20 <cpuid+0x3b>
+    *eaxp = eax;
+     b17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     b1b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b1e:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     b20:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     b25:	74 09                	je     b30 <cpuid+0x4b>
+    *ebxp = ebx;
+     b27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     b2b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b2e:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     b30:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b35:	74 09                	je     b40 <cpuid+0x5b>
+    *ecxp = ecx;
+     b37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b3b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b3e:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     b40:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     b45:	74 09                	je     b50 <cpuid+0x6b>
+    *edxp = edx;
+     b47:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     b4b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     b4e:	89 10                	mov    %edx,(%rax)
+}
+     b50:	90                   	nop
+     b51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b55:	c9                   	leave
+     b56:	c3                   	ret
+
+0000000000000b57 <strcpy>:
+char *strcpy(char *s, char *t) {
+     b57:	55                   	push   %rbp
+     b58:	48 89 e5             	mov    %rsp,%rbp
+     b5b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b5f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     b63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b67:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     b6b:	90                   	nop
+     b6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b70:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     b74:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     b78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b7c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     b80:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     b84:	0f b6 12             	movzbl (%rdx),%edx
+     b87:	88 10                	mov    %dl,(%rax)
+     b89:	0f b6 00             	movzbl (%rax),%eax
+     b8c:	84 c0                	test   %al,%al
+     b8e:	75 dc                	jne    b6c <strcpy+0x15>
+  return os;
+     b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b94:	5d                   	pop    %rbp
+     b95:	c3                   	ret
+
+0000000000000b96 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     b96:	55                   	push   %rbp
+     b97:	48 89 e5             	mov    %rsp,%rbp
+     b9a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b9e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     ba2:	eb 0a                	jmp    bae <strcmp+0x18>
+    p++, q++;
+     ba4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     ba9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     bae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bb2:	0f b6 00             	movzbl (%rax),%eax
+     bb5:	84 c0                	test   %al,%al
+     bb7:	74 12                	je     bcb <strcmp+0x35>
+     bb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bbd:	0f b6 10             	movzbl (%rax),%edx
+     bc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bc4:	0f b6 00             	movzbl (%rax),%eax
+     bc7:	38 c2                	cmp    %al,%dl
+     bc9:	74 d9                	je     ba4 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     bcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bcf:	0f b6 00             	movzbl (%rax),%eax
+     bd2:	0f b6 d0             	movzbl %al,%edx
+     bd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bd9:	0f b6 00             	movzbl (%rax),%eax
+     bdc:	0f b6 c0             	movzbl %al,%eax
+     bdf:	29 c2                	sub    %eax,%edx
+     be1:	89 d0                	mov    %edx,%eax
+}
+     be3:	5d                   	pop    %rbp
+     be4:	c3                   	ret
+
+0000000000000be5 <strlen>:
+uint strlen(char *s) {
+     be5:	55                   	push   %rbp
+     be6:	48 89 e5             	mov    %rsp,%rbp
+     be9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     bed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bf4:	eb 04                	jmp    bfa <strlen+0x15>
+     bf6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     bfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bfd:	48 63 d0             	movslq %eax,%rdx
+     c00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c04:	48 01 d0             	add    %rdx,%rax
+     c07:	0f b6 00             	movzbl (%rax),%eax
+     c0a:	84 c0                	test   %al,%al
+     c0c:	75 e8                	jne    bf6 <strlen+0x11>
+    ;
+  return n;
+     c0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c11:	5d                   	pop    %rbp
+     c12:	c3                   	ret
+
+0000000000000c13 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     c13:	55                   	push   %rbp
+     c14:	48 89 e5             	mov    %rsp,%rbp
+     c17:	53                   	push   %rbx
+     c18:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     c1c:	8b 05 12 24 00 00    	mov    0x2412(%rip),%eax        # 3034 <erms>
+     c22:	85 c0                	test   %eax,%eax
+     c24:	79 53                	jns    c79 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     c26:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     c2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     c30:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c35:	ba 00 00 00 00       	mov    $0x0,%edx
+     c3a:	48 89 c6             	mov    %rax,%rsi
+     c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+     c42:	e8 9e fe ff ff       	call   ae5 <cpuid>
+    ebx = 0;
+     c47:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     c4e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c51:	83 f8 06             	cmp    $0x6,%eax
+     c54:	76 14                	jbe    c6a <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     c56:	b8 07 00 00 00       	mov    $0x7,%eax
+     c5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c60:	0f a2                	cpuid
+     c62:	89 d9                	mov    %ebx,%ecx
+     c64:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     c67:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     c6a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c6d:	c1 e8 09             	shr    $0x9,%eax
+     c70:	83 e0 01             	and    $0x1,%eax
+     c73:	89 05 bb 23 00 00    	mov    %eax,0x23bb(%rip)        # 3034 <erms>
+  }
+  return erms;
+     c79:	8b 05 b5 23 00 00    	mov    0x23b5(%rip),%eax        # 3034 <erms>
+}
+     c7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c83:	c9                   	leave
+     c84:	c3                   	ret
+
+0000000000000c85 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     c85:	55                   	push   %rbp
+     c86:	48 89 e5             	mov    %rsp,%rbp
+     c89:	48 83 ec 10          	sub    $0x10,%rsp
+     c8d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c91:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c94:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     c97:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     c9b:	76 09                	jbe    ca6 <memset+0x21>
+     c9d:	e8 71 ff ff ff       	call   c13 <haserms>
+     ca2:	85 c0                	test   %eax,%eax
+     ca4:	74 16                	je     cbc <memset+0x37>
+    stosb(dst, c, n);
+     ca6:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     ca9:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     cac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb0:	89 ce                	mov    %ecx,%esi
+     cb2:	48 89 c7             	mov    %rax,%rdi
+     cb5:	e8 26 fd ff ff       	call   9e0 <stosb>
+     cba:	eb 58                	jmp    d14 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     cbc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cbf:	c1 e8 03             	shr    $0x3,%eax
+     cc2:	89 c6                	mov    %eax,%esi
+     cc4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cc7:	48 98                	cltq
+     cc9:	0f b6 c0             	movzbl %al,%eax
+     ccc:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     cd3:	01 01 01 
+     cd6:	48 0f af c2          	imul   %rdx,%rax
+     cda:	48 89 c1             	mov    %rax,%rcx
+     cdd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ce1:	48 89 f2             	mov    %rsi,%rdx
+     ce4:	48 89 ce             	mov    %rcx,%rsi
+     ce7:	48 89 c7             	mov    %rax,%rdi
+     cea:	e8 23 fd ff ff       	call   a12 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     cef:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cf2:	83 e0 07             	and    $0x7,%eax
+     cf5:	89 c2                	mov    %eax,%edx
+     cf7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     cfa:	83 e0 f8             	and    $0xfffffff8,%eax
+     cfd:	48 89 c1             	mov    %rax,%rcx
+     d00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d04:	48 01 c1             	add    %rax,%rcx
+     d07:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d0a:	89 c6                	mov    %eax,%esi
+     d0c:	48 89 cf             	mov    %rcx,%rdi
+     d0f:	e8 cc fc ff ff       	call   9e0 <stosb>
+  }
+  return dst;
+     d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     d18:	c9                   	leave
+     d19:	c3                   	ret
+
+0000000000000d1a <strchr>:
+
+char *strchr(const char *s, char c) {
+     d1a:	55                   	push   %rbp
+     d1b:	48 89 e5             	mov    %rsp,%rbp
+     d1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d22:	89 f0                	mov    %esi,%eax
+     d24:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     d27:	eb 17                	jmp    d40 <strchr+0x26>
+    if (*s == c)
+     d29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d2d:	0f b6 00             	movzbl (%rax),%eax
+     d30:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     d33:	75 06                	jne    d3b <strchr+0x21>
+      return (char *)s;
+     d35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d39:	eb 15                	jmp    d50 <strchr+0x36>
+  for (; *s; s++)
+     d3b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d44:	0f b6 00             	movzbl (%rax),%eax
+     d47:	84 c0                	test   %al,%al
+     d49:	75 de                	jne    d29 <strchr+0xf>
+  return 0;
+     d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     d50:	5d                   	pop    %rbp
+     d51:	c3                   	ret
+
+0000000000000d52 <gets>:
+
+char *gets(char *buf, int max) {
+     d52:	55                   	push   %rbp
+     d53:	48 89 e5             	mov    %rsp,%rbp
+     d56:	48 83 ec 20          	sub    $0x20,%rsp
+     d5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d5e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     d61:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d68:	eb 48                	jmp    db2 <gets+0x60>
+    cc = read(0, &c, 1);
+     d6a:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d6e:	ba 01 00 00 00       	mov    $0x1,%edx
+     d73:	48 89 c6             	mov    %rax,%rsi
+     d76:	bf 00 00 00 00       	mov    $0x0,%edi
+     d7b:	e8 b8 05 00 00       	call   1338 <read>
+     d80:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     d83:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d87:	7e 36                	jle    dbf <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d8c:	8d 50 01             	lea    0x1(%rax),%edx
+     d8f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d92:	48 63 d0             	movslq %eax,%rdx
+     d95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d99:	48 01 c2             	add    %rax,%rdx
+     d9c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     da0:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     da2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     da6:	3c 0a                	cmp    $0xa,%al
+     da8:	74 16                	je     dc0 <gets+0x6e>
+     daa:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     dae:	3c 0d                	cmp    $0xd,%al
+     db0:	74 0e                	je     dc0 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     db2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     db5:	83 c0 01             	add    $0x1,%eax
+     db8:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     dbb:	7f ad                	jg     d6a <gets+0x18>
+     dbd:	eb 01                	jmp    dc0 <gets+0x6e>
+      break;
+     dbf:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     dc0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dc3:	48 63 d0             	movslq %eax,%rdx
+     dc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dca:	48 01 d0             	add    %rdx,%rax
+     dcd:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     dd4:	c9                   	leave
+     dd5:	c3                   	ret
+
+0000000000000dd6 <stat>:
+
+int stat(char *n, struct stat *st) {
+     dd6:	55                   	push   %rbp
+     dd7:	48 89 e5             	mov    %rsp,%rbp
+     dda:	48 83 ec 10          	sub    $0x10,%rsp
+     dde:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     de2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     de6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     dea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dee:	48 89 c6             	mov    %rax,%rsi
+     df1:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     df6:	e8 58 07 00 00       	call   1553 <fstatat>
+}
+     dfb:	c9                   	leave
+     dfc:	c3                   	ret
+
+0000000000000dfd <atoi>:
+
+int atoi(const char *s) {
+     dfd:	55                   	push   %rbp
+     dfe:	48 89 e5             	mov    %rsp,%rbp
+     e01:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     e05:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e0c:	eb 28                	jmp    e36 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     e0e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e11:	89 d0                	mov    %edx,%eax
+     e13:	c1 e0 02             	shl    $0x2,%eax
+     e16:	01 d0                	add    %edx,%eax
+     e18:	01 c0                	add    %eax,%eax
+     e1a:	89 c1                	mov    %eax,%ecx
+     e1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e20:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     e24:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     e28:	0f b6 00             	movzbl (%rax),%eax
+     e2b:	0f be c0             	movsbl %al,%eax
+     e2e:	01 c8                	add    %ecx,%eax
+     e30:	83 e8 30             	sub    $0x30,%eax
+     e33:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     e36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e3a:	0f b6 00             	movzbl (%rax),%eax
+     e3d:	3c 2f                	cmp    $0x2f,%al
+     e3f:	7e 0b                	jle    e4c <atoi+0x4f>
+     e41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e45:	0f b6 00             	movzbl (%rax),%eax
+     e48:	3c 39                	cmp    $0x39,%al
+     e4a:	7e c2                	jle    e0e <atoi+0x11>
+  return n;
+     e4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e4f:	5d                   	pop    %rbp
+     e50:	c3                   	ret
+
+0000000000000e51 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     e51:	55                   	push   %rbp
+     e52:	48 89 e5             	mov    %rsp,%rbp
+     e55:	48 83 ec 28          	sub    $0x28,%rsp
+     e59:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e5d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e61:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     e64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     e74:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     e78:	7f 09                	jg     e83 <memmove+0x32>
+    return vdst;
+     e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e7e:	e9 29 01 00 00       	jmp    fac <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     e83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e87:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     e8b:	0f 83 87 00 00 00    	jae    f18 <memmove+0xc7>
+     e91:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e94:	48 63 d0             	movslq %eax,%rdx
+     e97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e9b:	48 01 d0             	add    %rdx,%rax
+     e9e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ea2:	73 74                	jae    f18 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     ea4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ea7:	48 98                	cltq
+     ea9:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     ead:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     eb0:	48 98                	cltq
+     eb2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     eb6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     eba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ebe:	48 09 d0             	or     %rdx,%rax
+     ec1:	83 e0 07             	and    $0x7,%eax
+     ec4:	48 85 c0             	test   %rax,%rax
+     ec7:	75 3d                	jne    f06 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     ec9:	eb 1c                	jmp    ee7 <memmove+0x96>
+        src -= 8;
+     ecb:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     ed0:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ed9:	48 8b 10             	mov    (%rax),%rdx
+     edc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ee0:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     ee3:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     ee7:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     eeb:	7f de                	jg     ecb <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     eed:	eb 17                	jmp    f06 <memmove+0xb5>
+      *--dst = *--src;
+     eef:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     ef4:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     ef9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     efd:	0f b6 10             	movzbl (%rax),%edx
+     f00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f04:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     f06:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f09:	8d 50 ff             	lea    -0x1(%rax),%edx
+     f0c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     f0f:	85 c0                	test   %eax,%eax
+     f11:	7f dc                	jg     eef <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     f13:	e9 90 00 00 00       	jmp    fa8 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     f18:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     f1c:	7e 09                	jle    f27 <memmove+0xd6>
+     f1e:	e8 f0 fc ff ff       	call   c13 <haserms>
+     f23:	85 c0                	test   %eax,%eax
+     f25:	74 1b                	je     f42 <memmove+0xf1>
+    movsb(dst, src, n);
+     f27:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f2a:	48 63 d0             	movslq %eax,%rdx
+     f2d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f35:	48 89 ce             	mov    %rcx,%rsi
+     f38:	48 89 c7             	mov    %rax,%rdi
+     f3b:	e8 0c fb ff ff       	call   a4c <movsb>
+     f40:	eb 66                	jmp    fa8 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     f42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f45:	8d 50 07             	lea    0x7(%rax),%edx
+     f48:	85 c0                	test   %eax,%eax
+     f4a:	0f 48 c2             	cmovs  %edx,%eax
+     f4d:	c1 f8 03             	sar    $0x3,%eax
+     f50:	48 63 d0             	movslq %eax,%rdx
+     f53:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     f57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f5b:	48 89 ce             	mov    %rcx,%rsi
+     f5e:	48 89 c7             	mov    %rax,%rdi
+     f61:	e8 23 fb ff ff       	call   a89 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     f66:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f69:	89 d0                	mov    %edx,%eax
+     f6b:	c1 f8 1f             	sar    $0x1f,%eax
+     f6e:	c1 e8 1d             	shr    $0x1d,%eax
+     f71:	01 c2                	add    %eax,%edx
+     f73:	83 e2 07             	and    $0x7,%edx
+     f76:	29 c2                	sub    %eax,%edx
+     f78:	89 d0                	mov    %edx,%eax
+     f7a:	48 98                	cltq
+     f7c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f7f:	83 e2 f8             	and    $0xfffffff8,%edx
+     f82:	48 63 ca             	movslq %edx,%rcx
+     f85:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f89:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     f8d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f90:	83 e2 f8             	and    $0xfffffff8,%edx
+     f93:	48 63 ca             	movslq %edx,%rcx
+     f96:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     f9a:	48 01 d1             	add    %rdx,%rcx
+     f9d:	48 89 c2             	mov    %rax,%rdx
+     fa0:	48 89 cf             	mov    %rcx,%rdi
+     fa3:	e8 a4 fa ff ff       	call   a4c <movsb>
+  }
+  return vdst;
+     fa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     fac:	c9                   	leave
+     fad:	c3                   	ret
+
+0000000000000fae <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+     fae:	55                   	push   %rbp
+     faf:	48 89 e5             	mov    %rsp,%rbp
+     fb2:	48 83 ec 20          	sub    $0x20,%rsp
+     fb6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     fb9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+     fbd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+     fc4:	00 00 00 
+     fc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+     fcb:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     fcf:	75 0d                	jne    fde <clock_gettime+0x30>
+     fd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd5:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fd9:	48 85 c0             	test   %rax,%rax
+     fdc:	75 13                	jne    ff1 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+     fde:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     fe2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fe5:	48 89 d6             	mov    %rdx,%rsi
+     fe8:	89 c7                	mov    %eax,%edi
+     fea:	e8 e0 04 00 00       	call   14cf <_clock_gettime>
+     fef:	eb 7d                	jmp    106e <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+     ff1:	e8 d1 fa ff ff       	call   ac7 <rdtsc>
+     ff6:	48 89 c2             	mov    %rax,%rdx
+     ff9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ffd:	48 89 d6             	mov    %rdx,%rsi
+    1000:	48 89 c7             	mov    %rax,%rdi
+    1003:	e8 7b f9 ff ff       	call   983 <clockns>
+    1008:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    100c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1010:	48 c1 e8 09          	shr    $0x9,%rax
+    1014:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    101b:	b8 44 00 
+    101e:	48 f7 e2             	mul    %rdx
+    1021:	48 89 d0             	mov    %rdx,%rax
+    1024:	48 c1 e8 0b          	shr    $0xb,%rax
+    1028:	48 89 c2             	mov    %rax,%rdx
+    102b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    102f:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1032:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1036:	48 89 c8             	mov    %rcx,%rax
+    1039:	48 c1 e8 09          	shr    $0x9,%rax
+    103d:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1044:	b8 44 00 
+    1047:	48 f7 e2             	mul    %rdx
+    104a:	48 89 d0             	mov    %rdx,%rax
+    104d:	48 c1 e8 0b          	shr    $0xb,%rax
+    1051:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1058:	48 89 c8             	mov    %rcx,%rax
+    105b:	48 29 d0             	sub    %rdx,%rax
+    105e:	48 89 c2             	mov    %rax,%rdx
+    1061:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1065:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1069:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    106e:	c9                   	leave
+    106f:	c3                   	ret
+
+0000000000001070 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1070:	55                   	push   %rbp
+    1071:	48 89 e5             	mov    %rsp,%rbp
+    1074:	48 83 ec 10          	sub    $0x10,%rsp
+    1078:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    107c:	eb 11                	jmp    108f <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    107e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1082:	be 02 00 00 00       	mov    $0x2,%esi
+    1087:	48 89 c7             	mov    %rax,%rdi
+    108a:	e8 6c 04 00 00       	call   14fb <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    108f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1093:	b8 02 00 00 00       	mov    $0x2,%eax
+    1098:	87 02                	xchg   %eax,(%rdx)
+    109a:	85 c0                	test   %eax,%eax
+    109c:	75 e0                	jne    107e <mutex_wait+0xe>
+}
+    109e:	90                   	nop
+    109f:	90                   	nop
+    10a0:	c9                   	leave
+    10a1:	c3                   	ret
+
+00000000000010a2 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    10a2:	55                   	push   %rbp
+    10a3:	48 89 e5             	mov    %rsp,%rbp
+    10a6:	48 83 ec 20          	sub    $0x20,%rsp
+    10aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    10ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    10b5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    10b9:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    10bd:	8b 02                	mov    (%rdx),%eax
+    10bf:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10c4:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    10c8:	89 c1                	mov    %eax,%ecx
+    10ca:	0f 94 c0             	sete   %al
+    10cd:	84 c0                	test   %al,%al
+    10cf:	75 02                	jne    10d3 <mutex_lock+0x31>
+    10d1:	89 0a                	mov    %ecx,(%rdx)
+    10d3:	83 f0 01             	xor    $0x1,%eax
+    10d6:	84 c0                	test   %al,%al
+    10d8:	74 0c                	je     10e6 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    10da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10de:	48 89 c7             	mov    %rax,%rdi
+    10e1:	e8 8a ff ff ff       	call   1070 <mutex_wait>
+}
+    10e6:	90                   	nop
+    10e7:	c9                   	leave
+    10e8:	c3                   	ret
+
+00000000000010e9 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    10e9:	55                   	push   %rbp
+    10ea:	48 89 e5             	mov    %rsp,%rbp
+    10ed:	48 83 ec 10          	sub    $0x10,%rsp
+    10f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    10f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10f9:	ba 00 00 00 00       	mov    $0x0,%edx
+    10fe:	87 10                	xchg   %edx,(%rax)
+    1100:	83 fa 02             	cmp    $0x2,%edx
+    1103:	75 11                	jne    1116 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1105:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1109:	be 01 00 00 00       	mov    $0x1,%esi
+    110e:	48 89 c7             	mov    %rax,%rdi
+    1111:	e8 f0 03 00 00       	call   1506 <futex_wake>
+}
+    1116:	90                   	nop
+    1117:	c9                   	leave
+    1118:	c3                   	ret
+
+0000000000001119 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1119:	55                   	push   %rbp
+    111a:	48 89 e5             	mov    %rsp,%rbp
+    111d:	48 83 ec 20          	sub    $0x20,%rsp
+    1121:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1125:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1129:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    112d:	48 83 c0 04          	add    $0x4,%rax
+    1131:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1135:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1139:	8b 00                	mov    (%rax),%eax
+    113b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    113e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1142:	48 89 c7             	mov    %rax,%rdi
+    1145:	e8 9f ff ff ff       	call   10e9 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    114a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    114e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1151:	89 d6                	mov    %edx,%esi
+    1153:	48 89 c7             	mov    %rax,%rdi
+    1156:	e8 a0 03 00 00       	call   14fb <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    115b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    115f:	48 83 c0 04          	add    $0x4,%rax
+    1163:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1167:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    116b:	48 89 c7             	mov    %rax,%rdi
+    116e:	e8 fd fe ff ff       	call   1070 <mutex_wait>
+}
+    1173:	90                   	nop
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+
+0000000000001176 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1176:	55                   	push   %rbp
+    1177:	48 89 e5             	mov    %rsp,%rbp
+    117a:	48 83 ec 10          	sub    $0x10,%rsp
+    117e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1182:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1186:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    118a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    118e:	48 83 c0 04          	add    $0x4,%rax
+    1192:	8b 00                	mov    (%rax),%eax
+    1194:	85 c0                	test   %eax,%eax
+    1196:	7e 11                	jle    11a9 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1198:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    119c:	be 01 00 00 00       	mov    $0x1,%esi
+    11a1:	48 89 c7             	mov    %rax,%rdi
+    11a4:	e8 5d 03 00 00       	call   1506 <futex_wake>
+}
+    11a9:	90                   	nop
+    11aa:	c9                   	leave
+    11ab:	c3                   	ret
+
+00000000000011ac <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    11ac:	55                   	push   %rbp
+    11ad:	48 89 e5             	mov    %rsp,%rbp
+    11b0:	48 83 ec 10          	sub    $0x10,%rsp
+    11b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    11b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11bc:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    11c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11c4:	48 83 c0 04          	add    $0x4,%rax
+    11c8:	8b 00                	mov    (%rax),%eax
+    11ca:	85 c0                	test   %eax,%eax
+    11cc:	7e 11                	jle    11df <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    11ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11d2:	be 00 00 00 40       	mov    $0x40000000,%esi
+    11d7:	48 89 c7             	mov    %rax,%rdi
+    11da:	e8 27 03 00 00       	call   1506 <futex_wake>
+}
+    11df:	90                   	nop
+    11e0:	c9                   	leave
+    11e1:	c3                   	ret
+
+00000000000011e2 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    11e2:	55                   	push   %rbp
+    11e3:	48 89 e5             	mov    %rsp,%rbp
+    11e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11ea:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    11ed:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    11f1:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    11f5:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    11f9:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    11fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1201:	8b 40 04             	mov    0x4(%rax),%eax
+    1204:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1207:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    120b:	8b 00                	mov    (%rax),%eax
+    120d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1210:	29 c2                	sub    %eax,%edx
+    1212:	83 fa 1f             	cmp    $0x1f,%edx
+    1215:	76 07                	jbe    121e <ring_push+0x3c>
+    return -1;
+    1217:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    121c:	eb 7e                	jmp    129c <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    121e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1221:	83 e0 1f             	and    $0x1f,%eax
+    1224:	89 c2                	mov    %eax,%edx
+    1226:	48 89 d0             	mov    %rdx,%rax
+    1229:	48 01 c0             	add    %rax,%rax
+    122c:	48 01 d0             	add    %rdx,%rax
+    122f:	48 c1 e0 04          	shl    $0x4,%rax
+    1233:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    123b:	48 01 d0             	add    %rdx,%rax
+    123e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1242:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1246:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1249:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    124b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    124f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1253:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1257:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    125b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    125f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1263:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1267:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    126b:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    126f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1273:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1277:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    127b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    127f:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1283:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    128a:	8d 50 01             	lea    0x1(%rax),%edx
+    128d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1291:	48 83 c0 04          	add    $0x4,%rax
+    1295:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1297:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    129c:	5d                   	pop    %rbp
+    129d:	c3                   	ret
+
+000000000000129e <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    129e:	55                   	push   %rbp
+    129f:	48 89 e5             	mov    %rsp,%rbp
+    12a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    12aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ae:	8b 40 08             	mov    0x8(%rax),%eax
+    12b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    12b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12b8:	48 83 c0 0c          	add    $0xc,%rax
+    12bc:	8b 00                	mov    (%rax),%eax
+    12be:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    12c1:	75 07                	jne    12ca <ring_pop+0x2c>
+    return -1;
+    12c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12c8:	eb 40                	jmp    130a <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    12ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12cd:	83 e0 1f             	and    $0x1f,%eax
+    12d0:	89 c2                	mov    %eax,%edx
+    12d2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    12d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12da:	89 d2                	mov    %edx,%edx
+    12dc:	48 83 c2 61          	add    $0x61,%rdx
+    12e0:	48 c1 e2 04          	shl    $0x4,%rdx
+    12e4:	48 01 d0             	add    %rdx,%rax
+    12e7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    12eb:	48 8b 00             	mov    (%rax),%rax
+    12ee:	48 89 01             	mov    %rax,(%rcx)
+    12f1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    12f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12f8:	8d 50 01             	lea    0x1(%rax),%edx
+    12fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ff:	48 83 c0 08          	add    $0x8,%rax
+    1303:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1305:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    130a:	5d                   	pop    %rbp
+    130b:	c3                   	ret
+
+000000000000130c <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    130c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1311:	49 89 ca             	mov    %rcx,%r10
+    1314:	0f 05                	syscall
+    1316:	c3                   	ret
+
+0000000000001317 <_exit>:
+SYSCALL_(exit)
+    1317:	b8 02 00 00 00       	mov    $0x2,%eax
+    131c:	49 89 ca             	mov    %rcx,%r10
+    131f:	0f 05                	syscall
+    1321:	c3                   	ret
+
+0000000000001322 <wait>:
+SYSCALL(wait)
+    1322:	b8 03 00 00 00       	mov    $0x3,%eax
+    1327:	49 89 ca             	mov    %rcx,%r10
+    132a:	0f 05                	syscall
+    132c:	c3                   	ret
+
+000000000000132d <pipe>:
+SYSCALL(pipe)
+    132d:	b8 04 00 00 00       	mov    $0x4,%eax
+    1332:	49 89 ca             	mov    %rcx,%r10
+    1335:	0f 05                	syscall
+    1337:	c3                   	ret
+
+0000000000001338 <read>:
+SYSCALL(read)
+    1338:	b8 05 00 00 00       	mov    $0x5,%eax
+    133d:	49 89 ca             	mov    %rcx,%r10
+    1340:	0f 05                	syscall
+    1342:	c3                   	ret
+
+0000000000001343 <write>:
+SYSCALL(write)
+    1343:	b8 10 00 00 00       	mov    $0x10,%eax
+    1348:	49 89 ca             	mov    %rcx,%r10
+    134b:	0f 05                	syscall
+    134d:	c3                   	ret
+
+000000000000134e <_close>:
+SYSCALL_(close)
+    134e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1353:	49 89 ca             	mov    %rcx,%r10
+    1356:	0f 05                	syscall
+    1358:	c3                   	ret
+
+0000000000001359 <kill>:
+SYSCALL(kill)
+    1359:	b8 06 00 00 00       	mov    $0x6,%eax
+    135e:	49 89 ca             	mov    %rcx,%r10
+    1361:	0f 05                	syscall
+    1363:	c3                   	ret
+
+0000000000001364 <_exec>:
+SYSCALL_(exec)
+    1364:	b8 07 00 00 00       	mov    $0x7,%eax
+    1369:	49 89 ca             	mov    %rcx,%r10
+    136c:	0f 05                	syscall
+    136e:	c3                   	ret
+
+000000000000136f <open>:
+SYSCALL(open)
+    136f:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1374:	49 89 ca             	mov    %rcx,%r10
+    1377:	0f 05                	syscall
+    1379:	c3                   	ret
+
+000000000000137a <mknod>:
+SYSCALL(mknod)
+    137a:	b8 11 00 00 00       	mov    $0x11,%eax
+    137f:	49 89 ca             	mov    %rcx,%r10
+    1382:	0f 05                	syscall
+    1384:	c3                   	ret
+
+0000000000001385 <unlink>:
+SYSCALL(unlink)
+    1385:	b8 12 00 00 00       	mov    $0x12,%eax
+    138a:	49 89 ca             	mov    %rcx,%r10
+    138d:	0f 05                	syscall
+    138f:	c3                   	ret
+
+0000000000001390 <fstat>:
+SYSCALL(fstat)
+    1390:	b8 08 00 00 00       	mov    $0x8,%eax
+    1395:	49 89 ca             	mov    %rcx,%r10
+    1398:	0f 05                	syscall
+    139a:	c3                   	ret
+
+000000000000139b <link>:
+SYSCALL(link)
+    139b:	b8 13 00 00 00       	mov    $0x13,%eax
+    13a0:	49 89 ca             	mov    %rcx,%r10
+    13a3:	0f 05                	syscall
+    13a5:	c3                   	ret
+
+00000000000013a6 <mkdir>:
+SYSCALL(mkdir)
+    13a6:	b8 14 00 00 00       	mov    $0x14,%eax
+    13ab:	49 89 ca             	mov    %rcx,%r10
+    13ae:	0f 05                	syscall
+    13b0:	c3                   	ret
+
+00000000000013b1 <chdir>:
+SYSCALL(chdir)
+    13b1:	b8 09 00 00 00       	mov    $0x9,%eax
+    13b6:	49 89 ca             	mov    %rcx,%r10
+    13b9:	0f 05                	syscall
+    13bb:	c3                   	ret
+
+00000000000013bc <dup>:
+SYSCALL(dup)
+    13bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13c1:	49 89 ca             	mov    %rcx,%r10
+    13c4:	0f 05                	syscall
+    13c6:	c3                   	ret
+
+00000000000013c7 <getpid>:
+SYSCALL(getpid)
+    13c7:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13cc:	49 89 ca             	mov    %rcx,%r10
+    13cf:	0f 05                	syscall
+    13d1:	c3                   	ret
+
+00000000000013d2 <sbrk>:
+SYSCALL(sbrk)
+    13d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13d7:	49 89 ca             	mov    %rcx,%r10
+    13da:	0f 05                	syscall
+    13dc:	c3                   	ret
+
+00000000000013dd <sleep>:
+SYSCALL(sleep)
+    13dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+    13e2:	49 89 ca             	mov    %rcx,%r10
+    13e5:	0f 05                	syscall
+    13e7:	c3                   	ret
+
+00000000000013e8 <uptime>:
+SYSCALL(uptime)
+    13e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+    13ed:	49 89 ca             	mov    %rcx,%r10
+    13f0:	0f 05                	syscall
+    13f2:	c3                   	ret
+
+00000000000013f3 <sysinfo>:
+SYSCALL(sysinfo)
+    13f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    13f8:	49 89 ca             	mov    %rcx,%r10
+    13fb:	0f 05                	syscall
+    13fd:	c3                   	ret
+
+00000000000013fe <crashn>:
+SYSCALL(crashn)
+    13fe:	b8 17 00 00 00       	mov    $0x17,%eax
+    1403:	49 89 ca             	mov    %rcx,%r10
+    1406:	0f 05                	syscall
+    1408:	c3                   	ret
+
+0000000000001409 <mmap>:
+SYSCALL(mmap)
+    1409:	b8 18 00 00 00       	mov    $0x18,%eax
+    140e:	49 89 ca             	mov    %rcx,%r10
+    1411:	0f 05                	syscall
+    1413:	c3                   	ret
+
+0000000000001414 <munmap>:
+SYSCALL(munmap)
+    1414:	b8 19 00 00 00       	mov    $0x19,%eax
+    1419:	49 89 ca             	mov    %rcx,%r10
+    141c:	0f 05                	syscall
+    141e:	c3                   	ret
+
+000000000000141f <nice>:
+SYSCALL(nice)
+    141f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1424:	49 89 ca             	mov    %rcx,%r10
+    1427:	0f 05                	syscall
+    1429:	c3                   	ret
+
+000000000000142a <_spawn>:
+SYSCALL_(spawn)
+    142a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    142f:	49 89 ca             	mov    %rcx,%r10
+    1432:	0f 05                	syscall
+    1434:	c3                   	ret
+
+0000000000001435 <pread>:
+SYSCALL(pread)
+    1435:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    143a:	49 89 ca             	mov    %rcx,%r10
+    143d:	0f 05                	syscall
+    143f:	c3                   	ret
+
+0000000000001440 <pwrite>:
+SYSCALL(pwrite)
+    1440:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1445:	49 89 ca             	mov    %rcx,%r10
+    1448:	0f 05                	syscall
+    144a:	c3                   	ret
+
+000000000000144b <readv>:
+SYSCALL(readv)
+    144b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1450:	49 89 ca             	mov    %rcx,%r10
+    1453:	0f 05                	syscall
+    1455:	c3                   	ret
+
+0000000000001456 <writev>:
+SYSCALL(writev)
+    1456:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    145b:	49 89 ca             	mov    %rcx,%r10
+    145e:	0f 05                	syscall
+    1460:	c3                   	ret
+
+0000000000001461 <sendfile>:
+SYSCALL(sendfile)
+    1461:	b8 20 00 00 00       	mov    $0x20,%eax
+    1466:	49 89 ca             	mov    %rcx,%r10
+    1469:	0f 05                	syscall
+    146b:	c3                   	ret
+
+000000000000146c <splice>:
+SYSCALL(splice)
+    146c:	b8 21 00 00 00       	mov    $0x21,%eax
+    1471:	49 89 ca             	mov    %rcx,%r10
+    1474:	0f 05                	syscall
+    1476:	c3                   	ret
+
+0000000000001477 <poll>:
+SYSCALL(poll)
+    1477:	b8 22 00 00 00       	mov    $0x22,%eax
+    147c:	49 89 ca             	mov    %rcx,%r10
+    147f:	0f 05                	syscall
+    1481:	c3                   	ret
+
+0000000000001482 <fsync>:
+SYSCALL(fsync)
+    1482:	b8 23 00 00 00       	mov    $0x23,%eax
+    1487:	49 89 ca             	mov    %rcx,%r10
+    148a:	0f 05                	syscall
+    148c:	c3                   	ret
+
+000000000000148d <fdatasync>:
+SYSCALL(fdatasync)
+    148d:	b8 24 00 00 00       	mov    $0x24,%eax
+    1492:	49 89 ca             	mov    %rcx,%r10
+    1495:	0f 05                	syscall
+    1497:	c3                   	ret
+
+0000000000001498 <lockstat>:
+SYSCALL(lockstat)
+    1498:	b8 25 00 00 00       	mov    $0x25,%eax
+    149d:	49 89 ca             	mov    %rcx,%r10
+    14a0:	0f 05                	syscall
+    14a2:	c3                   	ret
+
+00000000000014a3 <syscallstat>:
+SYSCALL(syscallstat)
+    14a3:	b8 26 00 00 00       	mov    $0x26,%eax
+    14a8:	49 89 ca             	mov    %rcx,%r10
+    14ab:	0f 05                	syscall
+    14ad:	c3                   	ret
+
+00000000000014ae <trace>:
+SYSCALL(trace)
+    14ae:	b8 27 00 00 00       	mov    $0x27,%eax
+    14b3:	49 89 ca             	mov    %rcx,%r10
+    14b6:	0f 05                	syscall
+    14b8:	c3                   	ret
+
+00000000000014b9 <profile>:
+SYSCALL(profile)
+    14b9:	b8 28 00 00 00       	mov    $0x28,%eax
+    14be:	49 89 ca             	mov    %rcx,%r10
+    14c1:	0f 05                	syscall
+    14c3:	c3                   	ret
+
+00000000000014c4 <cycles>:
+SYSCALL(cycles)
+    14c4:	b8 29 00 00 00       	mov    $0x29,%eax
+    14c9:	49 89 ca             	mov    %rcx,%r10
+    14cc:	0f 05                	syscall
+    14ce:	c3                   	ret
+
+00000000000014cf <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    14cf:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    14d4:	49 89 ca             	mov    %rcx,%r10
+    14d7:	0f 05                	syscall
+    14d9:	c3                   	ret
+
+00000000000014da <consmode>:
+SYSCALL(consmode)
+    14da:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    14df:	49 89 ca             	mov    %rcx,%r10
+    14e2:	0f 05                	syscall
+    14e4:	c3                   	ret
+
+00000000000014e5 <clone>:
+SYSCALL(clone)
+    14e5:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    14ea:	49 89 ca             	mov    %rcx,%r10
+    14ed:	0f 05                	syscall
+    14ef:	c3                   	ret
+
+00000000000014f0 <join>:
+SYSCALL(join)
+    14f0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    14f5:	49 89 ca             	mov    %rcx,%r10
+    14f8:	0f 05                	syscall
+    14fa:	c3                   	ret
+
+00000000000014fb <futex_wait>:
+SYSCALL(futex_wait)
+    14fb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1500:	49 89 ca             	mov    %rcx,%r10
+    1503:	0f 05                	syscall
+    1505:	c3                   	ret
+
+0000000000001506 <futex_wake>:
+SYSCALL(futex_wake)
+    1506:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    150b:	49 89 ca             	mov    %rcx,%r10
+    150e:	0f 05                	syscall
+    1510:	c3                   	ret
+
+0000000000001511 <shmget>:
+SYSCALL(shmget)
+    1511:	b8 30 00 00 00       	mov    $0x30,%eax
+    1516:	49 89 ca             	mov    %rcx,%r10
+    1519:	0f 05                	syscall
+    151b:	c3                   	ret
+
+000000000000151c <shmat>:
+SYSCALL(shmat)
+    151c:	b8 31 00 00 00       	mov    $0x31,%eax
+    1521:	49 89 ca             	mov    %rcx,%r10
+    1524:	0f 05                	syscall
+    1526:	c3                   	ret
+
+0000000000001527 <shmdt>:
+SYSCALL(shmdt)
+    1527:	b8 32 00 00 00       	mov    $0x32,%eax
+    152c:	49 89 ca             	mov    %rcx,%r10
+    152f:	0f 05                	syscall
+    1531:	c3                   	ret
+
+0000000000001532 <ring_setup>:
+SYSCALL(ring_setup)
+    1532:	b8 33 00 00 00       	mov    $0x33,%eax
+    1537:	49 89 ca             	mov    %rcx,%r10
+    153a:	0f 05                	syscall
+    153c:	c3                   	ret
+
+000000000000153d <ring_enter>:
+SYSCALL(ring_enter)
+    153d:	b8 34 00 00 00       	mov    $0x34,%eax
+    1542:	49 89 ca             	mov    %rcx,%r10
+    1545:	0f 05                	syscall
+    1547:	c3                   	ret
+
+0000000000001548 <getdents>:
+SYSCALL(getdents)
+    1548:	b8 35 00 00 00       	mov    $0x35,%eax
+    154d:	49 89 ca             	mov    %rcx,%r10
+    1550:	0f 05                	syscall
+    1552:	c3                   	ret
+
+0000000000001553 <fstatat>:
+SYSCALL(fstatat)
+    1553:	b8 36 00 00 00       	mov    $0x36,%eax
+    1558:	49 89 ca             	mov    %rcx,%r10
+    155b:	0f 05                	syscall
+    155d:	c3                   	ret
+
+000000000000155e <clone_file>:
+SYSCALL(clone_file)
+    155e:	b8 37 00 00 00       	mov    $0x37,%eax
+    1563:	49 89 ca             	mov    %rcx,%r10
+    1566:	0f 05                	syscall
+    1568:	c3                   	ret
+
+0000000000001569 <fpunch>:
+SYSCALL(fpunch)
+    1569:	b8 38 00 00 00       	mov    $0x38,%eax
+    156e:	49 89 ca             	mov    %rcx,%r10
+    1571:	0f 05                	syscall
+    1573:	c3                   	ret
+
+0000000000001574 <defrag>:
+SYSCALL(defrag)
+    1574:	b8 39 00 00 00       	mov    $0x39,%eax
+    1579:	49 89 ca             	mov    %rcx,%r10
+    157c:	0f 05                	syscall
+    157e:	c3                   	ret
+
+000000000000157f <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    157f:	55                   	push   %rbp
+    1580:	48 89 e5             	mov    %rsp,%rbp
+    1583:	48 83 ec 20          	sub    $0x20,%rsp
+    1587:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    158b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1590:	e8 3d fe ff ff       	call   13d2 <sbrk>
+    1595:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1599:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    159d:	48 f7 d8             	neg    %rax
+    15a0:	25 ff 0f 00 00       	and    $0xfff,%eax
+    15a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    15a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    15ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15b1:	48 01 c2             	add    %rax,%rdx
+    15b4:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    15b9:	48 39 c2             	cmp    %rax,%rdx
+    15bc:	73 1e                	jae    15dc <morecore+0x5d>
+    15be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15c2:	89 c2                	mov    %eax,%edx
+    15c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15c8:	01 d0                	add    %edx,%eax
+    15ca:	89 c7                	mov    %eax,%edi
+    15cc:	e8 01 fe ff ff       	call   13d2 <sbrk>
+    15d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15d5:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15da:	75 07                	jne    15e3 <morecore+0x64>
+    return 0;
+    15dc:	b8 00 00 00 00       	mov    $0x0,%eax
+    15e1:	eb 27                	jmp    160a <morecore+0x8b>
+  stats.heap += n + pad;
+    15e3:	48 8b 05 86 1b 00 00 	mov    0x1b86(%rip),%rax        # 3170 <stats+0x50>
+    15ea:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    15ee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    15f2:	48 01 ca             	add    %rcx,%rdx
+    15f5:	48 01 d0             	add    %rdx,%rax
+    15f8:	48 89 05 71 1b 00 00 	mov    %rax,0x1b71(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    15ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1603:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1607:	48 01 d0             	add    %rdx,%rax
+}
+    160a:	c9                   	leave
+    160b:	c3                   	ret
+
+000000000000160c <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    160c:	55                   	push   %rbp
+    160d:	48 89 e5             	mov    %rsp,%rbp
+    1610:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1614:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1618:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    161f:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1620:	48 8d 05 d9 1a 00 00 	lea    0x1ad9(%rip),%rax        # 3100 <runs>
+    1627:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    162b:	eb 1a                	jmp    1647 <pagefree+0x3b>
+    prev = *rp;
+    162d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1631:	48 8b 00             	mov    (%rax),%rax
+    1634:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    163c:	48 8b 00             	mov    (%rax),%rax
+    163f:	48 83 c0 08          	add    $0x8,%rax
+    1643:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1647:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    164b:	48 8b 00             	mov    (%rax),%rax
+    164e:	48 85 c0             	test   %rax,%rax
+    1651:	74 0d                	je     1660 <pagefree+0x54>
+    1653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1657:	48 8b 00             	mov    (%rax),%rax
+    165a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    165e:	72 cd                	jb     162d <pagefree+0x21>
+  r = (struct run *)p;
+    1660:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1664:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1668:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    166c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1670:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1677:	48 8b 10             	mov    (%rax),%rdx
+    167a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    167e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1682:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1686:	48 8b 40 08          	mov    0x8(%rax),%rax
+    168a:	48 85 c0             	test   %rax,%rax
+    168d:	74 48                	je     16d7 <pagefree+0xcb>
+    168f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1693:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1697:	48 01 c2             	add    %rax,%rdx
+    169a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    169e:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16a2:	48 39 c2             	cmp    %rax,%rdx
+    16a5:	75 30                	jne    16d7 <pagefree+0xcb>
+    r->size += r->next->size;
+    16a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ab:	48 8b 10             	mov    (%rax),%rdx
+    16ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16b2:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16b6:	48 8b 00             	mov    (%rax),%rax
+    16b9:	48 01 c2             	add    %rax,%rdx
+    16bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c0:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    16c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    16cb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    16d7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16dc:	74 46                	je     1724 <pagefree+0x118>
+    16de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e2:	48 8b 10             	mov    (%rax),%rdx
+    16e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e9:	48 01 d0             	add    %rdx,%rax
+    16ec:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    16f0:	75 32                	jne    1724 <pagefree+0x118>
+    prev->size += r->size;
+    16f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f6:	48 8b 10             	mov    (%rax),%rdx
+    16f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16fd:	48 8b 00             	mov    (%rax),%rax
+    1700:	48 01 c2             	add    %rax,%rdx
+    1703:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1707:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    170a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    170e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1712:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1716:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    171a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    171e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1722:	eb 0c                	jmp    1730 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1724:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1728:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    172c:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    172f:	90                   	nop
+    1730:	90                   	nop
+    1731:	5d                   	pop    %rbp
+    1732:	c3                   	ret
+
+0000000000001733 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1733:	55                   	push   %rbp
+    1734:	48 89 e5             	mov    %rsp,%rbp
+    1737:	48 83 ec 40          	sub    $0x40,%rsp
+    173b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    173f:	48 8d 05 ba 19 00 00 	lea    0x19ba(%rip),%rax        # 3100 <runs>
+    1746:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    174a:	eb 66                	jmp    17b2 <pagealloc+0x7f>
+    if (r->size == n) {
+    174c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1750:	48 8b 00             	mov    (%rax),%rax
+    1753:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1757:	75 18                	jne    1771 <pagealloc+0x3e>
+      *rp = r->next;
+    1759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    175d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1761:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1765:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    176c:	e9 ca 00 00 00       	jmp    183b <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1771:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1775:	48 8b 00             	mov    (%rax),%rax
+    1778:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    177c:	73 28                	jae    17a6 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    177e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1782:	48 8b 00             	mov    (%rax),%rax
+    1785:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1789:	48 89 c2             	mov    %rax,%rdx
+    178c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1790:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1793:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1797:	48 8b 10             	mov    (%rax),%rdx
+    179a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    179e:	48 01 d0             	add    %rdx,%rax
+    17a1:	e9 95 00 00 00       	jmp    183b <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    17a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17aa:	48 83 c0 08          	add    $0x8,%rax
+    17ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b6:	48 8b 00             	mov    (%rax),%rax
+    17b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17bd:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17c2:	75 88                	jne    174c <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    17c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    17c8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    17cc:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    17d3:	00 
+    17d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    17dc:	48 39 c2             	cmp    %rax,%rdx
+    17df:	48 0f 43 c2          	cmovae %rdx,%rax
+    17e3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    17e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17eb:	48 89 c7             	mov    %rax,%rdi
+    17ee:	e8 8c fd ff ff       	call   157f <morecore>
+    17f3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    17f7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    17fc:	75 07                	jne    1805 <pagealloc+0xd2>
+    return 0;
+    17fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1803:	eb 36                	jmp    183b <pagealloc+0x108>
+  if (m > n)
+    1805:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1809:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    180d:	73 1a                	jae    1829 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    180f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1813:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1817:	48 89 c2             	mov    %rax,%rdx
+    181a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    181e:	48 89 d6             	mov    %rdx,%rsi
+    1821:	48 89 c7             	mov    %rax,%rdi
+    1824:	e8 e3 fd ff ff       	call   160c <pagefree>
+  return p + m - n;
+    1829:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    182d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1831:	48 89 c2             	mov    %rax,%rdx
+    1834:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1838:	48 01 d0             	add    %rdx,%rax
+}
+    183b:	c9                   	leave
+    183c:	c3                   	ret
+
+000000000000183d <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    183d:	55                   	push   %rbp
+    183e:	48 89 e5             	mov    %rsp,%rbp
+    1841:	48 83 ec 30          	sub    $0x30,%rsp
+    1845:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1848:	bf 00 10 00 00       	mov    $0x1000,%edi
+    184d:	e8 e1 fe ff ff       	call   1733 <pagealloc>
+    1852:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1856:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    185b:	75 0a                	jne    1867 <refill+0x2a>
+    return -1;
+    185d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1862:	e9 da 00 00 00       	jmp    1941 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1867:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    186e:	00 
+    186f:	e9 ba 00 00 00       	jmp    192e <refill+0xf1>
+    b = (struct block *)(p + off);
+    1874:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    187c:	48 01 d0             	add    %rdx,%rax
+    187f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1883:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1886:	ba 20 00 00 00       	mov    $0x20,%edx
+    188b:	89 c1                	mov    %eax,%ecx
+    188d:	48 d3 e2             	shl    %cl,%rdx
+    1890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1894:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1897:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    189a:	48 63 d0             	movslq %eax,%rdx
+    189d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18a1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    18a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18a8:	48 98                	cltq
+    18aa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    18b1:	00 
+    18b2:	48 8d 05 07 18 00 00 	lea    0x1807(%rip),%rax        # 30c0 <freelist>
+    18b9:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    18bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18c1:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    18c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18c8:	48 98                	cltq
+    18ca:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    18d1:	00 
+    18d2:	48 8d 15 e7 17 00 00 	lea    0x17e7(%rip),%rdx        # 30c0 <freelist>
+    18d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18dd:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    18e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18e4:	48 98                	cltq
+    18e6:	48 83 c0 08          	add    $0x8,%rax
+    18ea:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    18f1:	00 
+    18f2:	48 8d 05 2b 18 00 00 	lea    0x182b(%rip),%rax        # 3124 <stats+0x4>
+    18f9:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    18fc:	8d 48 01             	lea    0x1(%rax),%ecx
+    18ff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1902:	48 98                	cltq
+    1904:	48 83 c0 08          	add    $0x8,%rax
+    1908:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    190f:	00 
+    1910:	48 8d 05 0d 18 00 00 	lea    0x180d(%rip),%rax        # 3124 <stats+0x4>
+    1917:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    191a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    191d:	ba 20 00 00 00       	mov    $0x20,%edx
+    1922:	89 c1                	mov    %eax,%ecx
+    1924:	48 d3 e2             	shl    %cl,%rdx
+    1927:	48 89 d0             	mov    %rdx,%rax
+    192a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    192e:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1935:	00 
+    1936:	0f 86 38 ff ff ff    	jbe    1874 <refill+0x37>
+  }
+  return 0;
+    193c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1941:	c9                   	leave
+    1942:	c3                   	ret
+
+0000000000001943 <malloc>:
+
+void *malloc(uint nbytes) {
+    1943:	55                   	push   %rbp
+    1944:	48 89 e5             	mov    %rsp,%rbp
+    1947:	48 83 ec 30          	sub    $0x30,%rsp
+    194b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    194e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1951:	48 83 c0 10          	add    $0x10,%rax
+    1955:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1959:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1960:	eb 04                	jmp    1966 <malloc+0x23>
+    1962:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1966:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    196a:	7f 16                	jg     1982 <malloc+0x3f>
+    196c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    196f:	ba 20 00 00 00       	mov    $0x20,%edx
+    1974:	89 c1                	mov    %eax,%ecx
+    1976:	48 d3 e2             	shl    %cl,%rdx
+    1979:	48 89 d0             	mov    %rdx,%rax
+    197c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1980:	72 e0                	jb     1962 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1982:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1986:	75 7d                	jne    1a05 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1988:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    198c:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1992:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1998:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    199c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19a0:	48 89 c7             	mov    %rax,%rdi
+    19a3:	e8 8b fd ff ff       	call   1733 <pagealloc>
+    19a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    19ac:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    19b1:	75 0a                	jne    19bd <malloc+0x7a>
+      return 0;
+    19b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    19b8:	e9 2c 01 00 00       	jmp    1ae9 <malloc+0x1a6>
+    h->size = n;
+    19bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19c1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19c5:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    19c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19cc:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    19d3:	00 
+    stats.inuse[LARGE]++;
+    19d4:	8b 05 66 17 00 00    	mov    0x1766(%rip),%eax        # 3140 <stats+0x20>
+    19da:	83 c0 01             	add    $0x1,%eax
+    19dd:	89 05 5d 17 00 00    	mov    %eax,0x175d(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    19e3:	48 8b 15 7e 17 00 00 	mov    0x177e(%rip),%rdx        # 3168 <stats+0x48>
+    19ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19ee:	48 01 d0             	add    %rdx,%rax
+    19f1:	48 89 05 70 17 00 00 	mov    %rax,0x1770(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    19f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19fc:	48 83 c0 10          	add    $0x10,%rax
+    1a00:	e9 e4 00 00 00       	jmp    1ae9 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1a05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a08:	48 98                	cltq
+    1a0a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a11:	00 
+    1a12:	48 8d 05 a7 16 00 00 	lea    0x16a7(%rip),%rax        # 30c0 <freelist>
+    1a19:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a1d:	48 85 c0             	test   %rax,%rax
+    1a20:	75 18                	jne    1a3a <malloc+0xf7>
+    1a22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a25:	89 c7                	mov    %eax,%edi
+    1a27:	e8 11 fe ff ff       	call   183d <refill>
+    1a2c:	85 c0                	test   %eax,%eax
+    1a2e:	79 0a                	jns    1a3a <malloc+0xf7>
+    return 0;
+    1a30:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a35:	e9 af 00 00 00       	jmp    1ae9 <malloc+0x1a6>
+  b = freelist[c];
+    1a3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a3d:	48 98                	cltq
+    1a3f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a46:	00 
+    1a47:	48 8d 05 72 16 00 00 	lea    0x1672(%rip),%rax        # 30c0 <freelist>
+    1a4e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1a52:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1a56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a5a:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1a5e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1a61:	48 63 d2             	movslq %edx,%rdx
+    1a64:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1a6b:	00 
+    1a6c:	48 8d 15 4d 16 00 00 	lea    0x164d(%rip),%rdx        # 30c0 <freelist>
+    1a73:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1a77:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a7a:	48 98                	cltq
+    1a7c:	48 83 c0 08          	add    $0x8,%rax
+    1a80:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a87:	00 
+    1a88:	48 8d 05 95 16 00 00 	lea    0x1695(%rip),%rax        # 3124 <stats+0x4>
+    1a8f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a92:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1a95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a98:	48 98                	cltq
+    1a9a:	48 83 c0 08          	add    $0x8,%rax
+    1a9e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1aa5:	00 
+    1aa6:	48 8d 05 77 16 00 00 	lea    0x1677(%rip),%rax        # 3124 <stats+0x4>
+    1aad:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1ab0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ab3:	48 98                	cltq
+    1ab5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1abc:	00 
+    1abd:	48 8d 05 5c 16 00 00 	lea    0x165c(%rip),%rax        # 3120 <stats>
+    1ac4:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ac7:	8d 48 01             	lea    0x1(%rax),%ecx
+    1aca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1acd:	48 98                	cltq
+    1acf:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ad6:	00 
+    1ad7:	48 8d 05 42 16 00 00 	lea    0x1642(%rip),%rax        # 3120 <stats>
+    1ade:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1ae1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ae5:	48 83 c0 10          	add    $0x10,%rax
+}
+    1ae9:	c9                   	leave
+    1aea:	c3                   	ret
+
+0000000000001aeb <free>:
+
+void free(void *ap) {
+    1aeb:	55                   	push   %rbp
+    1aec:	48 89 e5             	mov    %rsp,%rbp
+    1aef:	48 83 ec 18          	sub    $0x18,%rsp
+    1af3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1af7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1afc:	0f 84 03 01 00 00    	je     1c05 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1b02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b06:	48 83 e8 10          	sub    $0x10,%rax
+    1b0a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1b0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b12:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b16:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1b1a:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1b1f:	75 42                	jne    1b63 <free+0x78>
+    stats.inuse[LARGE]--;
+    1b21:	8b 05 19 16 00 00    	mov    0x1619(%rip),%eax        # 3140 <stats+0x20>
+    1b27:	83 e8 01             	sub    $0x1,%eax
+    1b2a:	89 05 10 16 00 00    	mov    %eax,0x1610(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1b30:	48 8b 15 31 16 00 00 	mov    0x1631(%rip),%rdx        # 3168 <stats+0x48>
+    1b37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b3b:	48 8b 00             	mov    (%rax),%rax
+    1b3e:	48 29 c2             	sub    %rax,%rdx
+    1b41:	48 89 15 20 16 00 00 	mov    %rdx,0x1620(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b4c:	48 8b 10             	mov    (%rax),%rdx
+    1b4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b53:	48 89 d6             	mov    %rdx,%rsi
+    1b56:	48 89 c7             	mov    %rax,%rdi
+    1b59:	e8 ae fa ff ff       	call   160c <pagefree>
+    return;
+    1b5e:	e9 a3 00 00 00       	jmp    1c06 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1b63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b67:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b6e:	00 
+    1b6f:	48 8d 05 4a 15 00 00 	lea    0x154a(%rip),%rax        # 30c0 <freelist>
+    1b76:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1b7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b7e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1b82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b86:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b8d:	00 
+    1b8e:	48 8d 15 2b 15 00 00 	lea    0x152b(%rip),%rdx        # 30c0 <freelist>
+    1b95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b99:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1b9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ba1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ba8:	00 
+    1ba9:	48 8d 05 70 15 00 00 	lea    0x1570(%rip),%rax        # 3120 <stats>
+    1bb0:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1bb3:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1bb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bba:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bc1:	00 
+    1bc2:	48 8d 05 57 15 00 00 	lea    0x1557(%rip),%rax        # 3120 <stats>
+    1bc9:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1bcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bd0:	48 83 c0 08          	add    $0x8,%rax
+    1bd4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bdb:	00 
+    1bdc:	48 8d 05 41 15 00 00 	lea    0x1541(%rip),%rax        # 3124 <stats+0x4>
+    1be3:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1be6:	8d 48 01             	lea    0x1(%rax),%ecx
+    1be9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bed:	48 83 c0 08          	add    $0x8,%rax
+    1bf1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bf8:	00 
+    1bf9:	48 8d 05 24 15 00 00 	lea    0x1524(%rip),%rax        # 3124 <stats+0x4>
+    1c00:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1c03:	eb 01                	jmp    1c06 <free+0x11b>
+    return;
+    1c05:	90                   	nop
+}
+    1c06:	c9                   	leave
+    1c07:	c3                   	ret
+
+0000000000001c08 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1c08:	55                   	push   %rbp
+    1c09:	48 89 e5             	mov    %rsp,%rbp
+    1c0c:	48 83 ec 30          	sub    $0x30,%rsp
+    1c10:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1c13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c16:	48 8d 15 93 02 00 00 	lea    0x293(%rip),%rdx        # 1eb0 <benchreport+0x180>
+    1c1d:	48 89 d6             	mov    %rdx,%rsi
+    1c20:	89 c7                	mov    %eax,%edi
+    1c22:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c27:	e8 37 e6 ff ff       	call   263 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c2c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1c33:	eb 67                	jmp    1c9c <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1c35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c38:	48 98                	cltq
+    1c3a:	48 83 c0 08          	add    $0x8,%rax
+    1c3e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c45:	00 
+    1c46:	48 8d 05 d7 14 00 00 	lea    0x14d7(%rip),%rax        # 3124 <stats+0x4>
+    1c4d:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1c50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c53:	48 98                	cltq
+    1c55:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c5c:	00 
+    1c5d:	48 8d 05 bc 14 00 00 	lea    0x14bc(%rip),%rax        # 3120 <stats>
+    1c64:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1c67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c6a:	ba 20 00 00 00       	mov    $0x20,%edx
+    1c6f:	89 c1                	mov    %eax,%ecx
+    1c71:	48 d3 e2             	shl    %cl,%rdx
+    1c74:	48 89 d0             	mov    %rdx,%rax
+    1c77:	89 c1                	mov    %eax,%ecx
+    1c79:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c7c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c7f:	41 89 f9             	mov    %edi,%r9d
+    1c82:	41 89 f0             	mov    %esi,%r8d
+    1c85:	48 8d 35 3b 02 00 00 	lea    0x23b(%rip),%rsi        # 1ec7 <benchreport+0x197>
+    1c8c:	89 c7                	mov    %eax,%edi
+    1c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c93:	e8 cb e5 ff ff       	call   263 <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c98:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1c9c:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1ca0:	7e 93                	jle    1c35 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1ca2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1ca9:	00 
+  for (r = runs; r; r = r->next)
+    1caa:	48 8b 05 4f 14 00 00 	mov    0x144f(%rip),%rax        # 3100 <runs>
+    1cb1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cb5:	eb 17                	jmp    1cce <mallocstats+0xc6>
+    nfree += r->size;
+    1cb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cbb:	48 8b 00             	mov    (%rax),%rax
+    1cbe:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1cc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc6:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1cca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cce:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1cd3:	75 e2                	jne    1cb7 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1cd5:	48 8b 05 94 14 00 00 	mov    0x1494(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cdc:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1cde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ce2:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1ce6:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1ce8:	48 8b 05 79 14 00 00 	mov    0x1479(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1cef:	89 c1                	mov    %eax,%ecx
+    1cf1:	8b 15 49 14 00 00    	mov    0x1449(%rip),%edx        # 3140 <stats+0x20>
+    1cf7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cfa:	41 89 f9             	mov    %edi,%r9d
+    1cfd:	41 89 f0             	mov    %esi,%r8d
+    1d00:	48 8d 35 d1 01 00 00 	lea    0x1d1(%rip),%rsi        # 1ed8 <benchreport+0x1a8>
+    1d07:	89 c7                	mov    %eax,%edi
+    1d09:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d0e:	e8 50 e5 ff ff       	call   263 <printf>
+}
+    1d13:	90                   	nop
+    1d14:	c9                   	leave
+    1d15:	c3                   	ret
+
+0000000000001d16 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1d16:	55                   	push   %rbp
+    1d17:	48 89 e5             	mov    %rsp,%rbp
+    1d1a:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1d1e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1d22:	48 89 c7             	mov    %rax,%rdi
+    1d25:	e8 9a f7 ff ff       	call   14c4 <cycles>
+  return t;
+    1d2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d2e:	c9                   	leave
+    1d2f:	c3                   	ret
+
+0000000000001d30 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1d30:	55                   	push   %rbp
+    1d31:	48 89 e5             	mov    %rsp,%rbp
+    1d34:	48 83 ec 30          	sub    $0x30,%rsp
+    1d38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d40:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1d43:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1d47:	0f 8e 24 01 00 00    	jle    1e71 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1d4d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1d54:	e9 98 00 00 00       	jmp    1df1 <benchreport+0xc1>
+    x = t[i];
+    1d59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d5c:	48 98                	cltq
+    1d5e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d65:	00 
+    1d66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d6a:	48 01 d0             	add    %rdx,%rax
+    1d6d:	48 8b 00             	mov    (%rax),%rax
+    1d70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d77:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1d7a:	eb 33                	jmp    1daf <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1d7c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d7f:	48 98                	cltq
+    1d81:	48 c1 e0 03          	shl    $0x3,%rax
+    1d85:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d8d:	48 01 d0             	add    %rdx,%rax
+    1d90:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1d93:	48 63 d2             	movslq %edx,%rdx
+    1d96:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d9d:	00 
+    1d9e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1da2:	48 01 ca             	add    %rcx,%rdx
+    1da5:	48 8b 00             	mov    (%rax),%rax
+    1da8:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1dab:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1daf:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1db3:	7e 1d                	jle    1dd2 <benchreport+0xa2>
+    1db5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1db8:	48 98                	cltq
+    1dba:	48 c1 e0 03          	shl    $0x3,%rax
+    1dbe:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1dc2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1dc6:	48 01 d0             	add    %rdx,%rax
+    1dc9:	48 8b 00             	mov    (%rax),%rax
+    1dcc:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1dd0:	72 aa                	jb     1d7c <benchreport+0x4c>
+    t[j] = x;
+    1dd2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1dd5:	48 98                	cltq
+    1dd7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1dde:	00 
+    1ddf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1de3:	48 01 c2             	add    %rax,%rdx
+    1de6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dea:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1ded:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1df1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1df4:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1df7:	0f 8c 5c ff ff ff    	jl     1d59 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1dfd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e00:	48 98                	cltq
+    1e02:	48 c1 e0 03          	shl    $0x3,%rax
+    1e06:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e0e:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e11:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1e14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e17:	89 c2                	mov    %eax,%edx
+    1e19:	c1 ea 1f             	shr    $0x1f,%edx
+    1e1c:	01 d0                	add    %edx,%eax
+    1e1e:	d1 f8                	sar    %eax
+    1e20:	48 98                	cltq
+    1e22:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e29:	00 
+    1e2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e2e:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1e31:	48 8b 38             	mov    (%rax),%rdi
+    1e34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e38:	48 8b 30             	mov    (%rax),%rsi
+    1e3b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1e3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e42:	48 83 ec 08          	sub    $0x8,%rsp
+    1e46:	51                   	push   %rcx
+    1e47:	49 89 f9             	mov    %rdi,%r9
+    1e4a:	49 89 f0             	mov    %rsi,%r8
+    1e4d:	89 d1                	mov    %edx,%ecx
+    1e4f:	48 89 c2             	mov    %rax,%rdx
+    1e52:	48 8d 05 bf 00 00 00 	lea    0xbf(%rip),%rax        # 1f18 <benchreport+0x1e8>
+    1e59:	48 89 c6             	mov    %rax,%rsi
+    1e5c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e61:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e66:	e8 f8 e3 ff ff       	call   263 <printf>
+    1e6b:	48 83 c4 10          	add    $0x10,%rsp
+    1e6f:	eb 01                	jmp    1e72 <benchreport+0x142>
+    return;
+    1e71:	90                   	nop
+}
+    1e72:	c9                   	leave
+    1e73:	c3                   	ret
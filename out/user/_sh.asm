@@ -0,0 +1,4982 @@
+
+out/user/_sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <spawncmd>:
+
+// Start cmd with fds[0], fds[1] and fds[2] as its standard input,
+// output and error.  Commands are started with spawn(), so the shell
+// itself is not copied for each of them.  Returns the number of child
+// processes started, which the caller must wait() for.
+int spawncmd(struct cmd *cmd, int *fds) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 60          	sub    $0x60,%rsp
+       8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+       c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if (cmd == 0)
+      10:	48 83 7d a8 00       	cmpq   $0x0,-0x58(%rbp)
+      15:	75 0a                	jne    21 <spawncmd+0x21>
+    return 0;
+      17:	b8 00 00 00 00       	mov    $0x0,%eax
+      1c:	e9 a7 02 00 00       	jmp    2c8 <spawncmd+0x2c8>
+
+  switch (cmd->type) {
+      21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+      25:	8b 00                	mov    (%rax),%eax
+      27:	83 f8 05             	cmp    $0x5,%eax
+      2a:	77 22                	ja     4e <spawncmd+0x4e>
+      2c:	89 c0                	mov    %eax,%eax
+      2e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      35:	00 
+      36:	48 8d 05 5b 2e 00 00 	lea    0x2e5b(%rip),%rax        # 2e98 <benchreport+0x17e>
+      3d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+      40:	48 98                	cltq
+      42:	48 8d 15 4f 2e 00 00 	lea    0x2e4f(%rip),%rdx        # 2e98 <benchreport+0x17e>
+      49:	48 01 d0             	add    %rdx,%rax
+      4c:	ff e0                	jmp    *%rax
+  default:
+    panic("spawncmd");
+      4e:	48 8d 05 0b 2e 00 00 	lea    0x2e0b(%rip),%rax        # 2e60 <benchreport+0x146>
+      55:	48 89 c7             	mov    %rax,%rdi
+      58:	e8 38 04 00 00       	call   495 <panic>
+
+  case EXEC:
+    ecmd = (struct execcmd *)cmd;
+      5d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+      61:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (ecmd->argv[0] == 0)
+      65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      69:	48 8b 40 08          	mov    0x8(%rax),%rax
+      6d:	48 85 c0             	test   %rax,%rax
+      70:	75 0a                	jne    7c <spawncmd+0x7c>
+      return 0;
+      72:	b8 00 00 00 00       	mov    $0x0,%eax
+      77:	e9 4c 02 00 00       	jmp    2c8 <spawncmd+0x2c8>
+    if (spawn(ecmd->argv[0], ecmd->argv, fds) < 0) {
+      7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      80:	48 8d 48 08          	lea    0x8(%rax),%rcx
+      84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      88:	48 8b 40 08          	mov    0x8(%rax),%rax
+      8c:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+      90:	48 89 ce             	mov    %rcx,%rsi
+      93:	48 89 c7             	mov    %rax,%rdi
+      96:	e8 1a 18 00 00       	call   18b5 <spawn>
+      9b:	85 c0                	test   %eax,%eax
+      9d:	79 2e                	jns    cd <spawncmd+0xcd>
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+      9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+      a7:	48 89 c2             	mov    %rax,%rdx
+      aa:	48 8d 05 b8 2d 00 00 	lea    0x2db8(%rip),%rax        # 2e69 <benchreport+0x14f>
+      b1:	48 89 c6             	mov    %rax,%rsi
+      b4:	bf 02 00 00 00       	mov    $0x2,%edi
+      b9:	b8 00 00 00 00       	mov    $0x0,%eax
+      be:	e8 8a 11 00 00       	call   124d <printf>
+      return 0;
+      c3:	b8 00 00 00 00       	mov    $0x0,%eax
+      c8:	e9 fb 01 00 00       	jmp    2c8 <spawncmd+0x2c8>
+    }
+    return 1;
+      cd:	b8 01 00 00 00       	mov    $0x1,%eax
+      d2:	e9 f1 01 00 00       	jmp    2c8 <spawncmd+0x2c8>
+
+  case REDIR:
+    rcmd = (struct redircmd *)cmd;
+      d7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+      db:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if ((fd = open(rcmd->file, rcmd->mode)) < 0) {
+      df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      e3:	8b 50 20             	mov    0x20(%rax),%edx
+      e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+      ee:	89 d6                	mov    %edx,%esi
+      f0:	48 89 c7             	mov    %rax,%rdi
+      f3:	e8 61 22 00 00       	call   2359 <open>
+      f8:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+      fb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+      ff:	79 2e                	jns    12f <spawncmd+0x12f>
+      printf(2, "open %s failed\n", rcmd->file);
+     101:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     105:	48 8b 40 10          	mov    0x10(%rax),%rax
+     109:	48 89 c2             	mov    %rax,%rdx
+     10c:	48 8d 05 66 2d 00 00 	lea    0x2d66(%rip),%rax        # 2e79 <benchreport+0x15f>
+     113:	48 89 c6             	mov    %rax,%rsi
+     116:	bf 02 00 00 00       	mov    $0x2,%edi
+     11b:	b8 00 00 00 00       	mov    $0x0,%eax
+     120:	e8 28 11 00 00       	call   124d <printf>
+      return 0;
+     125:	b8 00 00 00 00       	mov    $0x0,%eax
+     12a:	e9 99 01 00 00       	jmp    2c8 <spawncmd+0x2c8>
+    }
+    memmove(f, fds, sizeof(f));
+     12f:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+     133:	48 8d 45 b4          	lea    -0x4c(%rbp),%rax
+     137:	ba 0c 00 00 00       	mov    $0xc,%edx
+     13c:	48 89 ce             	mov    %rcx,%rsi
+     13f:	48 89 c7             	mov    %rax,%rdi
+     142:	e8 f4 1c 00 00       	call   1e3b <memmove>
+    f[rcmd->fd] = fd;
+     147:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     14b:	8b 40 24             	mov    0x24(%rax),%eax
+     14e:	48 98                	cltq
+     150:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+     153:	89 54 85 b4          	mov    %edx,-0x4c(%rbp,%rax,4)
+    n = spawncmd(rcmd->cmd, f);
+     157:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     15b:	48 8b 40 08          	mov    0x8(%rax),%rax
+     15f:	48 8d 55 b4          	lea    -0x4c(%rbp),%rdx
+     163:	48 89 d6             	mov    %rdx,%rsi
+     166:	48 89 c7             	mov    %rax,%rdi
+     169:	e8 92 fe ff ff       	call   0 <spawncmd>
+     16e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    close(fd);
+     171:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     174:	89 c7                	mov    %eax,%edi
+     176:	e8 6c 17 00 00       	call   18e7 <close>
+    return n;
+     17b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     17e:	e9 45 01 00 00       	jmp    2c8 <spawncmd+0x2c8>
+
+  case LIST:
+    lcmd = (struct listcmd *)cmd;
+     183:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     187:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (n = spawncmd(lcmd->left, fds); n > 0; n--)
+     18b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     18f:	48 8b 40 08          	mov    0x8(%rax),%rax
+     193:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+     197:	48 89 d6             	mov    %rdx,%rsi
+     19a:	48 89 c7             	mov    %rax,%rdi
+     19d:	e8 5e fe ff ff       	call   0 <spawncmd>
+     1a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     1a5:	eb 09                	jmp    1b0 <spawncmd+0x1b0>
+      wait();
+     1a7:	e8 60 21 00 00       	call   230c <wait>
+    for (n = spawncmd(lcmd->left, fds); n > 0; n--)
+     1ac:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     1b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1b4:	7f f1                	jg     1a7 <spawncmd+0x1a7>
+    return spawncmd(lcmd->right, fds);
+     1b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1ba:	48 8b 40 10          	mov    0x10(%rax),%rax
+     1be:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+     1c2:	48 89 d6             	mov    %rdx,%rsi
+     1c5:	48 89 c7             	mov    %rax,%rdi
+     1c8:	e8 33 fe ff ff       	call   0 <spawncmd>
+     1cd:	e9 f6 00 00 00       	jmp    2c8 <spawncmd+0x2c8>
+
+  case PIPE:
+    pcmd = (struct pipecmd *)cmd;
+     1d2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     1d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (pipe(p) < 0) {
+     1da:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+     1de:	48 89 c7             	mov    %rax,%rdi
+     1e1:	e8 31 21 00 00       	call   2317 <pipe>
+     1e6:	85 c0                	test   %eax,%eax
+     1e8:	79 23                	jns    20d <spawncmd+0x20d>
+      printf(2, "pipe failed\n");
+     1ea:	48 8d 05 98 2c 00 00 	lea    0x2c98(%rip),%rax        # 2e89 <benchreport+0x16f>
+     1f1:	48 89 c6             	mov    %rax,%rsi
+     1f4:	bf 02 00 00 00       	mov    $0x2,%edi
+     1f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     1fe:	e8 4a 10 00 00       	call   124d <printf>
+      return 0;
+     203:	b8 00 00 00 00       	mov    $0x0,%eax
+     208:	e9 bb 00 00 00       	jmp    2c8 <spawncmd+0x2c8>
+    }
+    memmove(f, fds, sizeof(f));
+     20d:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+     211:	48 8d 45 b4          	lea    -0x4c(%rbp),%rax
+     215:	ba 0c 00 00 00       	mov    $0xc,%edx
+     21a:	48 89 ce             	mov    %rcx,%rsi
+     21d:	48 89 c7             	mov    %rax,%rdi
+     220:	e8 16 1c 00 00       	call   1e3b <memmove>
+    f[1] = p[1];
+     225:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     228:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    n = spawncmd(pcmd->left, f);
+     22b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     22f:	48 8b 40 08          	mov    0x8(%rax),%rax
+     233:	48 8d 55 b4          	lea    -0x4c(%rbp),%rdx
+     237:	48 89 d6             	mov    %rdx,%rsi
+     23a:	48 89 c7             	mov    %rax,%rdi
+     23d:	e8 be fd ff ff       	call   0 <spawncmd>
+     242:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    memmove(f, fds, sizeof(f));
+     245:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+     249:	48 8d 45 b4          	lea    -0x4c(%rbp),%rax
+     24d:	ba 0c 00 00 00       	mov    $0xc,%edx
+     252:	48 89 ce             	mov    %rcx,%rsi
+     255:	48 89 c7             	mov    %rax,%rdi
+     258:	e8 de 1b 00 00       	call   1e3b <memmove>
+    f[0] = p[0];
+     25d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+     260:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    n += spawncmd(pcmd->right, f);
+     263:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     267:	48 8b 40 10          	mov    0x10(%rax),%rax
+     26b:	48 8d 55 b4          	lea    -0x4c(%rbp),%rdx
+     26f:	48 89 d6             	mov    %rdx,%rsi
+     272:	48 89 c7             	mov    %rax,%rdi
+     275:	e8 86 fd ff ff       	call   0 <spawncmd>
+     27a:	01 45 fc             	add    %eax,-0x4(%rbp)
+    close(p[0]);
+     27d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+     280:	89 c7                	mov    %eax,%edi
+     282:	e8 60 16 00 00       	call   18e7 <close>
+    close(p[1]);
+     287:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     28a:	89 c7                	mov    %eax,%edi
+     28c:	e8 56 16 00 00       	call   18e7 <close>
+    return n;
+     291:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     294:	eb 32                	jmp    2c8 <spawncmd+0x2c8>
+
+  case BACK:
+    // The child leaves what it starts to init, so we don't wait for it
+    bcmd = (struct backcmd *)cmd;
+     296:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     29a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (fork1() == 0) {
+     29e:	e8 66 02 00 00       	call   509 <fork1>
+     2a3:	85 c0                	test   %eax,%eax
+     2a5:	75 1c                	jne    2c3 <spawncmd+0x2c3>
+      spawncmd(bcmd->cmd, fds);
+     2a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+     2af:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+     2b3:	48 89 d6             	mov    %rdx,%rsi
+     2b6:	48 89 c7             	mov    %rax,%rdi
+     2b9:	e8 42 fd ff ff       	call   0 <spawncmd>
+      exit();
+     2be:	e8 ba 15 00 00       	call   187d <exit>
+    }
+    return 1;
+     2c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  }
+  return 0;
+}
+     2c8:	c9                   	leave
+     2c9:	c3                   	ret
+
+00000000000002ca <getcmd>:
+
+int getcmd(char *buf, int nbuf) {
+     2ca:	55                   	push   %rbp
+     2cb:	48 89 e5             	mov    %rsp,%rbp
+     2ce:	48 83 ec 20          	sub    $0x20,%rsp
+     2d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     2d6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  struct stat st;
+
+  printf(2, "$ ");
+     2d9:	48 8d 05 d0 2b 00 00 	lea    0x2bd0(%rip),%rax        # 2eb0 <benchreport+0x196>
+     2e0:	48 89 c6             	mov    %rax,%rsi
+     2e3:	bf 02 00 00 00       	mov    $0x2,%edi
+     2e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ed:	e8 5b 0f 00 00       	call   124d <printf>
+  memset(buf, 0, nbuf);
+     2f2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     2f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2f9:	be 00 00 00 00       	mov    $0x0,%esi
+     2fe:	48 89 c7             	mov    %rax,%rdi
+     301:	e8 69 19 00 00       	call   1c6f <memset>
+  // The console reads a line at a time, so take it in one read
+  // rather than gets()'s one a byte
+  if (fstat(0, &st) == 0 && st.type == T_DEV)
+     306:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     30a:	48 89 c6             	mov    %rax,%rsi
+     30d:	bf 00 00 00 00       	mov    $0x0,%edi
+     312:	e8 63 20 00 00       	call   237a <fstat>
+     317:	85 c0                	test   %eax,%eax
+     319:	75 23                	jne    33e <getcmd+0x74>
+     31b:	0f b7 45 f0          	movzwl -0x10(%rbp),%eax
+     31f:	66 83 f8 03          	cmp    $0x3,%ax
+     323:	75 19                	jne    33e <getcmd+0x74>
+    read(0, buf, nbuf - 1);
+     325:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     328:	8d 50 ff             	lea    -0x1(%rax),%edx
+     32b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     32f:	48 89 c6             	mov    %rax,%rsi
+     332:	bf 00 00 00 00       	mov    $0x0,%edi
+     337:	e8 e6 1f 00 00       	call   2322 <read>
+     33c:	eb 11                	jmp    34f <getcmd+0x85>
+  else
+    gets(buf, nbuf);
+     33e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     341:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     345:	89 d6                	mov    %edx,%esi
+     347:	48 89 c7             	mov    %rax,%rdi
+     34a:	e8 ed 19 00 00       	call   1d3c <gets>
+  if (buf[0] == 0) // EOF
+     34f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     353:	0f b6 00             	movzbl (%rax),%eax
+     356:	84 c0                	test   %al,%al
+     358:	75 07                	jne    361 <getcmd+0x97>
+    return -1;
+     35a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     35f:	eb 05                	jmp    366 <getcmd+0x9c>
+  return 0;
+     361:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     366:	c9                   	leave
+     367:	c3                   	ret
+
+0000000000000368 <main>:
+
+int main(void) {
+     368:	55                   	push   %rbp
+     369:	48 89 e5             	mov    %rsp,%rbp
+     36c:	48 83 ec 10          	sub    $0x10,%rsp
+  static int stdfds[3] = {0, 1, 2};
+  struct cmd *cmd;
+  int fd, n;
+
+  // Ensure that three file descriptors are open.
+  while ((fd = open("console", O_RDWR)) >= 0) {
+     370:	eb 12                	jmp    384 <main+0x1c>
+    if (fd >= 3) {
+     372:	83 7d f8 02          	cmpl   $0x2,-0x8(%rbp)
+     376:	7e 0c                	jle    384 <main+0x1c>
+      close(fd);
+     378:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     37b:	89 c7                	mov    %eax,%edi
+     37d:	e8 65 15 00 00       	call   18e7 <close>
+      break;
+     382:	eb 1d                	jmp    3a1 <main+0x39>
+  while ((fd = open("console", O_RDWR)) >= 0) {
+     384:	be 02 00 00 00       	mov    $0x2,%esi
+     389:	48 8d 05 23 2b 00 00 	lea    0x2b23(%rip),%rax        # 2eb3 <benchreport+0x199>
+     390:	48 89 c7             	mov    %rax,%rdi
+     393:	e8 c1 1f 00 00       	call   2359 <open>
+     398:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     39b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     39f:	79 d1                	jns    372 <main+0xa>
+    }
+  }
+
+  // Read and run input commands.
+  while (getcmd(buf, sizeof(buf)) >= 0) {
+     3a1:	e9 ce 00 00 00       	jmp    474 <main+0x10c>
+    if (buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' ') {
+     3a6:	0f b6 05 d3 3c 00 00 	movzbl 0x3cd3(%rip),%eax        # 4080 <buf.1>
+     3ad:	3c 63                	cmp    $0x63,%al
+     3af:	75 6d                	jne    41e <main+0xb6>
+     3b1:	0f b6 05 c9 3c 00 00 	movzbl 0x3cc9(%rip),%eax        # 4081 <buf.1+0x1>
+     3b8:	3c 64                	cmp    $0x64,%al
+     3ba:	75 62                	jne    41e <main+0xb6>
+     3bc:	0f b6 05 bf 3c 00 00 	movzbl 0x3cbf(%rip),%eax        # 4082 <buf.1+0x2>
+     3c3:	3c 20                	cmp    $0x20,%al
+     3c5:	75 57                	jne    41e <main+0xb6>
+      // Chdir must be called by the parent, not the child.
+      buf[strlen(buf) - 1] = 0; // chop \n
+     3c7:	48 8d 05 b2 3c 00 00 	lea    0x3cb2(%rip),%rax        # 4080 <buf.1>
+     3ce:	48 89 c7             	mov    %rax,%rdi
+     3d1:	e8 f9 17 00 00       	call   1bcf <strlen>
+     3d6:	83 e8 01             	sub    $0x1,%eax
+     3d9:	89 c2                	mov    %eax,%edx
+     3db:	48 8d 05 9e 3c 00 00 	lea    0x3c9e(%rip),%rax        # 4080 <buf.1>
+     3e2:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+      if (chdir(buf + 3) < 0)
+     3e6:	48 8d 05 96 3c 00 00 	lea    0x3c96(%rip),%rax        # 4083 <buf.1+0x3>
+     3ed:	48 89 c7             	mov    %rax,%rdi
+     3f0:	e8 a6 1f 00 00       	call   239b <chdir>
+     3f5:	85 c0                	test   %eax,%eax
+     3f7:	79 77                	jns    470 <main+0x108>
+        printf(2, "cannot cd %s\n", buf + 3);
+     3f9:	48 8d 05 83 3c 00 00 	lea    0x3c83(%rip),%rax        # 4083 <buf.1+0x3>
+     400:	48 89 c2             	mov    %rax,%rdx
+     403:	48 8d 05 b1 2a 00 00 	lea    0x2ab1(%rip),%rax        # 2ebb <benchreport+0x1a1>
+     40a:	48 89 c6             	mov    %rax,%rsi
+     40d:	bf 02 00 00 00       	mov    $0x2,%edi
+     412:	b8 00 00 00 00       	mov    $0x0,%eax
+     417:	e8 31 0e 00 00       	call   124d <printf>
+      continue;
+     41c:	eb 52                	jmp    470 <main+0x108>
+    }
+    if ((cmd = parsecmd(buf)) == 0)
+     41e:	48 8d 05 5b 3c 00 00 	lea    0x3c5b(%rip),%rax        # 4080 <buf.1>
+     425:	48 89 c7             	mov    %rax,%rdi
+     428:	e8 e9 04 00 00       	call   916 <parsecmd>
+     42d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     431:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     436:	74 3b                	je     473 <main+0x10b>
+      continue;
+    for (n = spawncmd(cmd, stdfds); n > 0; n--)
+     438:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     43c:	48 8d 15 cd 3b 00 00 	lea    0x3bcd(%rip),%rdx        # 4010 <stdfds.0>
+     443:	48 89 d6             	mov    %rdx,%rsi
+     446:	48 89 c7             	mov    %rax,%rdi
+     449:	e8 b2 fb ff ff       	call   0 <spawncmd>
+     44e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     451:	eb 09                	jmp    45c <main+0xf4>
+      wait();
+     453:	e8 b4 1e 00 00       	call   230c <wait>
+    for (n = spawncmd(cmd, stdfds); n > 0; n--)
+     458:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     45c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     460:	7f f1                	jg     453 <main+0xeb>
+    freecmd(cmd);
+     462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     466:	48 89 c7             	mov    %rax,%rdi
+     469:	e8 6c 0b 00 00       	call   fda <freecmd>
+     46e:	eb 04                	jmp    474 <main+0x10c>
+      continue;
+     470:	90                   	nop
+     471:	eb 01                	jmp    474 <main+0x10c>
+      continue;
+     473:	90                   	nop
+  while (getcmd(buf, sizeof(buf)) >= 0) {
+     474:	be 64 00 00 00       	mov    $0x64,%esi
+     479:	48 8d 05 00 3c 00 00 	lea    0x3c00(%rip),%rax        # 4080 <buf.1>
+     480:	48 89 c7             	mov    %rax,%rdi
+     483:	e8 42 fe ff ff       	call   2ca <getcmd>
+     488:	85 c0                	test   %eax,%eax
+     48a:	0f 89 16 ff ff ff    	jns    3a6 <main+0x3e>
+  }
+  exit();
+     490:	e8 e8 13 00 00       	call   187d <exit>
+
+0000000000000495 <panic>:
+}
+
+void panic(char *s) {
+     495:	55                   	push   %rbp
+     496:	48 89 e5             	mov    %rsp,%rbp
+     499:	48 83 ec 10          	sub    $0x10,%rsp
+     49d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  printf(2, "%s\n", s);
+     4a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4a5:	48 89 c2             	mov    %rax,%rdx
+     4a8:	48 8d 05 1a 2a 00 00 	lea    0x2a1a(%rip),%rax        # 2ec9 <benchreport+0x1af>
+     4af:	48 89 c6             	mov    %rax,%rsi
+     4b2:	bf 02 00 00 00       	mov    $0x2,%edi
+     4b7:	b8 00 00 00 00       	mov    $0x0,%eax
+     4bc:	e8 8c 0d 00 00       	call   124d <printf>
+  exit();
+     4c1:	e8 b7 13 00 00       	call   187d <exit>
+
+00000000000004c6 <syntax>:
+}
+
+// Report a malformed command line, which parsecmd() then throws away.
+void syntax(char *s) {
+     4c6:	55                   	push   %rbp
+     4c7:	48 89 e5             	mov    %rsp,%rbp
+     4ca:	48 83 ec 10          	sub    $0x10,%rsp
+     4ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (!syntaxerr)
+     4d2:	8b 05 88 3b 00 00    	mov    0x3b88(%rip),%eax        # 4060 <syntaxerr>
+     4d8:	85 c0                	test   %eax,%eax
+     4da:	75 20                	jne    4fc <syntax+0x36>
+    printf(2, "%s\n", s);
+     4dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4e0:	48 89 c2             	mov    %rax,%rdx
+     4e3:	48 8d 05 df 29 00 00 	lea    0x29df(%rip),%rax        # 2ec9 <benchreport+0x1af>
+     4ea:	48 89 c6             	mov    %rax,%rsi
+     4ed:	bf 02 00 00 00       	mov    $0x2,%edi
+     4f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f7:	e8 51 0d 00 00       	call   124d <printf>
+  syntaxerr = 1;
+     4fc:	c7 05 5a 3b 00 00 01 	movl   $0x1,0x3b5a(%rip)        # 4060 <syntaxerr>
+     503:	00 00 00 
+}
+     506:	90                   	nop
+     507:	c9                   	leave
+     508:	c3                   	ret
+
+0000000000000509 <fork1>:
+
+int fork1(void) {
+     509:	55                   	push   %rbp
+     50a:	48 89 e5             	mov    %rsp,%rbp
+     50d:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid;
+
+  pid = fork();
+     511:	e8 57 13 00 00       	call   186d <fork>
+     516:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (pid == -1)
+     519:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     51d:	75 0f                	jne    52e <fork1+0x25>
+    panic("fork");
+     51f:	48 8d 05 a7 29 00 00 	lea    0x29a7(%rip),%rax        # 2ecd <benchreport+0x1b3>
+     526:	48 89 c7             	mov    %rax,%rdi
+     529:	e8 67 ff ff ff       	call   495 <panic>
+  return pid;
+     52e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     531:	c9                   	leave
+     532:	c3                   	ret
+
+0000000000000533 <execcmd>:
+
+// Constructors
+
+struct cmd *execcmd(void) {
+     533:	55                   	push   %rbp
+     534:	48 89 e5             	mov    %rsp,%rbp
+     537:	48 83 ec 10          	sub    $0x10,%rsp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     53b:	bf a8 00 00 00       	mov    $0xa8,%edi
+     540:	e8 e8 23 00 00       	call   292d <malloc>
+     545:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     549:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     54d:	ba a8 00 00 00       	mov    $0xa8,%edx
+     552:	be 00 00 00 00       	mov    $0x0,%esi
+     557:	48 89 c7             	mov    %rax,%rdi
+     55a:	e8 10 17 00 00       	call   1c6f <memset>
+  cmd->type = EXEC;
+     55f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     563:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  return (struct cmd *)cmd;
+     569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     56d:	c9                   	leave
+     56e:	c3                   	ret
+
+000000000000056f <redircmd>:
+
+struct cmd *redircmd(struct cmd *subcmd, char *file, char *efile, int mode,
+                     int fd) {
+     56f:	55                   	push   %rbp
+     570:	48 89 e5             	mov    %rsp,%rbp
+     573:	48 83 ec 30          	sub    $0x30,%rsp
+     577:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     57b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     57f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+     583:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+     586:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     58a:	bf 28 00 00 00       	mov    $0x28,%edi
+     58f:	e8 99 23 00 00       	call   292d <malloc>
+     594:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     598:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     59c:	ba 28 00 00 00       	mov    $0x28,%edx
+     5a1:	be 00 00 00 00       	mov    $0x0,%esi
+     5a6:	48 89 c7             	mov    %rax,%rdi
+     5a9:	e8 c1 16 00 00       	call   1c6f <memset>
+  cmd->type = REDIR;
+     5ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5b2:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+  cmd->cmd = subcmd;
+     5b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     5c0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->file = file;
+     5c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5c8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     5cc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  cmd->efile = efile;
+     5d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5d4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     5d8:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  cmd->mode = mode;
+     5dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5e0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+     5e3:	89 50 20             	mov    %edx,0x20(%rax)
+  cmd->fd = fd;
+     5e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5ea:	8b 55 d0             	mov    -0x30(%rbp),%edx
+     5ed:	89 50 24             	mov    %edx,0x24(%rax)
+  return (struct cmd *)cmd;
+     5f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5f4:	c9                   	leave
+     5f5:	c3                   	ret
+
+00000000000005f6 <pipecmd>:
+
+struct cmd *pipecmd(struct cmd *left, struct cmd *right) {
+     5f6:	55                   	push   %rbp
+     5f7:	48 89 e5             	mov    %rsp,%rbp
+     5fa:	48 83 ec 20          	sub    $0x20,%rsp
+     5fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     602:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     606:	bf 18 00 00 00       	mov    $0x18,%edi
+     60b:	e8 1d 23 00 00       	call   292d <malloc>
+     610:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     614:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     618:	ba 18 00 00 00       	mov    $0x18,%edx
+     61d:	be 00 00 00 00       	mov    $0x0,%esi
+     622:	48 89 c7             	mov    %rax,%rdi
+     625:	e8 45 16 00 00       	call   1c6f <memset>
+  cmd->type = PIPE;
+     62a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     62e:	c7 00 03 00 00 00    	movl   $0x3,(%rax)
+  cmd->left = left;
+     634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     638:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     63c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->right = right;
+     640:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     644:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     648:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return (struct cmd *)cmd;
+     64c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     650:	c9                   	leave
+     651:	c3                   	ret
+
+0000000000000652 <listcmd>:
+
+struct cmd *listcmd(struct cmd *left, struct cmd *right) {
+     652:	55                   	push   %rbp
+     653:	48 89 e5             	mov    %rsp,%rbp
+     656:	48 83 ec 20          	sub    $0x20,%rsp
+     65a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     65e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     662:	bf 18 00 00 00       	mov    $0x18,%edi
+     667:	e8 c1 22 00 00       	call   292d <malloc>
+     66c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     670:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     674:	ba 18 00 00 00       	mov    $0x18,%edx
+     679:	be 00 00 00 00       	mov    $0x0,%esi
+     67e:	48 89 c7             	mov    %rax,%rdi
+     681:	e8 e9 15 00 00       	call   1c6f <memset>
+  cmd->type = LIST;
+     686:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     68a:	c7 00 04 00 00 00    	movl   $0x4,(%rax)
+  cmd->left = left;
+     690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     694:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     698:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->right = right;
+     69c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6a0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     6a4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return (struct cmd *)cmd;
+     6a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     6ac:	c9                   	leave
+     6ad:	c3                   	ret
+
+00000000000006ae <backcmd>:
+
+struct cmd *backcmd(struct cmd *subcmd) {
+     6ae:	55                   	push   %rbp
+     6af:	48 89 e5             	mov    %rsp,%rbp
+     6b2:	48 83 ec 20          	sub    $0x20,%rsp
+     6b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     6ba:	bf 10 00 00 00       	mov    $0x10,%edi
+     6bf:	e8 69 22 00 00       	call   292d <malloc>
+     6c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     6c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6cc:	ba 10 00 00 00       	mov    $0x10,%edx
+     6d1:	be 00 00 00 00       	mov    $0x0,%esi
+     6d6:	48 89 c7             	mov    %rax,%rdi
+     6d9:	e8 91 15 00 00       	call   1c6f <memset>
+  cmd->type = BACK;
+     6de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6e2:	c7 00 05 00 00 00    	movl   $0x5,(%rax)
+  cmd->cmd = subcmd;
+     6e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     6f0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return (struct cmd *)cmd;
+     6f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     6f8:	c9                   	leave
+     6f9:	c3                   	ret
+
+00000000000006fa <gettoken>:
+// Parsing
+
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int gettoken(char **ps, char *es, char **q, char **eq) {
+     6fa:	55                   	push   %rbp
+     6fb:	48 89 e5             	mov    %rsp,%rbp
+     6fe:	48 83 ec 30          	sub    $0x30,%rsp
+     702:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     706:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     70a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+     70e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  char *s;
+  int ret;
+
+  s = *ps;
+     712:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     716:	48 8b 00             	mov    (%rax),%rax
+     719:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (s < es && strchr(whitespace, *s))
+     71d:	eb 05                	jmp    724 <gettoken+0x2a>
+    s++;
+     71f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while (s < es && strchr(whitespace, *s))
+     724:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     728:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     72c:	73 20                	jae    74e <gettoken+0x54>
+     72e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     732:	0f b6 00             	movzbl (%rax),%eax
+     735:	0f be c0             	movsbl %al,%eax
+     738:	89 c6                	mov    %eax,%esi
+     73a:	48 8d 05 bf 38 00 00 	lea    0x38bf(%rip),%rax        # 4000 <whitespace>
+     741:	48 89 c7             	mov    %rax,%rdi
+     744:	e8 bb 15 00 00       	call   1d04 <strchr>
+     749:	48 85 c0             	test   %rax,%rax
+     74c:	75 d1                	jne    71f <gettoken+0x25>
+  if (q)
+     74e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     753:	74 0b                	je     760 <gettoken+0x66>
+    *q = s;
+     755:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     759:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     75d:	48 89 10             	mov    %rdx,(%rax)
+  ret = *s;
+     760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     764:	0f b6 00             	movzbl (%rax),%eax
+     767:	0f be c0             	movsbl %al,%eax
+     76a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  switch (*s) {
+     76d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     771:	0f b6 00             	movzbl (%rax),%eax
+     774:	0f be c0             	movsbl %al,%eax
+     777:	83 f8 7c             	cmp    $0x7c,%eax
+     77a:	74 30                	je     7ac <gettoken+0xb2>
+     77c:	83 f8 7c             	cmp    $0x7c,%eax
+     77f:	7f 50                	jg     7d1 <gettoken+0xd7>
+     781:	83 f8 3e             	cmp    $0x3e,%eax
+     784:	74 2d                	je     7b3 <gettoken+0xb9>
+     786:	83 f8 3e             	cmp    $0x3e,%eax
+     789:	7f 46                	jg     7d1 <gettoken+0xd7>
+     78b:	83 f8 3c             	cmp    $0x3c,%eax
+     78e:	7f 41                	jg     7d1 <gettoken+0xd7>
+     790:	83 f8 3b             	cmp    $0x3b,%eax
+     793:	7d 17                	jge    7ac <gettoken+0xb2>
+     795:	83 f8 29             	cmp    $0x29,%eax
+     798:	7f 37                	jg     7d1 <gettoken+0xd7>
+     79a:	83 f8 28             	cmp    $0x28,%eax
+     79d:	7d 0d                	jge    7ac <gettoken+0xb2>
+     79f:	85 c0                	test   %eax,%eax
+     7a1:	0f 84 84 00 00 00    	je     82b <gettoken+0x131>
+     7a7:	83 f8 26             	cmp    $0x26,%eax
+     7aa:	75 25                	jne    7d1 <gettoken+0xd7>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     7ac:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    break;
+     7b1:	eb 7f                	jmp    832 <gettoken+0x138>
+  case '>':
+    s++;
+     7b3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    if (*s == '>') {
+     7b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7bc:	0f b6 00             	movzbl (%rax),%eax
+     7bf:	3c 3e                	cmp    $0x3e,%al
+     7c1:	75 6b                	jne    82e <gettoken+0x134>
+      ret = '+';
+     7c3:	c7 45 f4 2b 00 00 00 	movl   $0x2b,-0xc(%rbp)
+      s++;
+     7ca:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    }
+    break;
+     7cf:	eb 5d                	jmp    82e <gettoken+0x134>
+  default:
+    ret = 'a';
+     7d1:	c7 45 f4 61 00 00 00 	movl   $0x61,-0xc(%rbp)
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     7d8:	eb 05                	jmp    7df <gettoken+0xe5>
+      s++;
+     7da:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     7df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7e3:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     7e7:	73 48                	jae    831 <gettoken+0x137>
+     7e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7ed:	0f b6 00             	movzbl (%rax),%eax
+     7f0:	0f be c0             	movsbl %al,%eax
+     7f3:	89 c6                	mov    %eax,%esi
+     7f5:	48 8d 05 04 38 00 00 	lea    0x3804(%rip),%rax        # 4000 <whitespace>
+     7fc:	48 89 c7             	mov    %rax,%rdi
+     7ff:	e8 00 15 00 00       	call   1d04 <strchr>
+     804:	48 85 c0             	test   %rax,%rax
+     807:	75 28                	jne    831 <gettoken+0x137>
+     809:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     80d:	0f b6 00             	movzbl (%rax),%eax
+     810:	0f be c0             	movsbl %al,%eax
+     813:	89 c6                	mov    %eax,%esi
+     815:	48 8d 05 ec 37 00 00 	lea    0x37ec(%rip),%rax        # 4008 <symbols>
+     81c:	48 89 c7             	mov    %rax,%rdi
+     81f:	e8 e0 14 00 00       	call   1d04 <strchr>
+     824:	48 85 c0             	test   %rax,%rax
+     827:	74 b1                	je     7da <gettoken+0xe0>
+    break;
+     829:	eb 06                	jmp    831 <gettoken+0x137>
+    break;
+     82b:	90                   	nop
+     82c:	eb 04                	jmp    832 <gettoken+0x138>
+    break;
+     82e:	90                   	nop
+     82f:	eb 01                	jmp    832 <gettoken+0x138>
+    break;
+     831:	90                   	nop
+  }
+  if (eq)
+     832:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     837:	74 12                	je     84b <gettoken+0x151>
+    *eq = s;
+     839:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     83d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     841:	48 89 10             	mov    %rdx,(%rax)
+
+  while (s < es && strchr(whitespace, *s))
+     844:	eb 05                	jmp    84b <gettoken+0x151>
+    s++;
+     846:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while (s < es && strchr(whitespace, *s))
+     84b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     84f:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     853:	73 20                	jae    875 <gettoken+0x17b>
+     855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     859:	0f b6 00             	movzbl (%rax),%eax
+     85c:	0f be c0             	movsbl %al,%eax
+     85f:	89 c6                	mov    %eax,%esi
+     861:	48 8d 05 98 37 00 00 	lea    0x3798(%rip),%rax        # 4000 <whitespace>
+     868:	48 89 c7             	mov    %rax,%rdi
+     86b:	e8 94 14 00 00       	call   1d04 <strchr>
+     870:	48 85 c0             	test   %rax,%rax
+     873:	75 d1                	jne    846 <gettoken+0x14c>
+  *ps = s;
+     875:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     879:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     87d:	48 89 10             	mov    %rdx,(%rax)
+  return ret;
+     880:	8b 45 f4             	mov    -0xc(%rbp),%eax
+}
+     883:	c9                   	leave
+     884:	c3                   	ret
+
+0000000000000885 <peek>:
+
+int peek(char **ps, char *es, char *toks) {
+     885:	55                   	push   %rbp
+     886:	48 89 e5             	mov    %rsp,%rbp
+     889:	48 83 ec 30          	sub    $0x30,%rsp
+     88d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     891:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     895:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  char *s;
+
+  s = *ps;
+     899:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     89d:	48 8b 00             	mov    (%rax),%rax
+     8a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (s < es && strchr(whitespace, *s))
+     8a4:	eb 05                	jmp    8ab <peek+0x26>
+    s++;
+     8a6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while (s < es && strchr(whitespace, *s))
+     8ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8af:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     8b3:	73 20                	jae    8d5 <peek+0x50>
+     8b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8b9:	0f b6 00             	movzbl (%rax),%eax
+     8bc:	0f be c0             	movsbl %al,%eax
+     8bf:	89 c6                	mov    %eax,%esi
+     8c1:	48 8d 05 38 37 00 00 	lea    0x3738(%rip),%rax        # 4000 <whitespace>
+     8c8:	48 89 c7             	mov    %rax,%rdi
+     8cb:	e8 34 14 00 00       	call   1d04 <strchr>
+     8d0:	48 85 c0             	test   %rax,%rax
+     8d3:	75 d1                	jne    8a6 <peek+0x21>
+  *ps = s;
+     8d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8dd:	48 89 10             	mov    %rdx,(%rax)
+  return *s && strchr(toks, *s);
+     8e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8e4:	0f b6 00             	movzbl (%rax),%eax
+     8e7:	84 c0                	test   %al,%al
+     8e9:	74 24                	je     90f <peek+0x8a>
+     8eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8ef:	0f b6 00             	movzbl (%rax),%eax
+     8f2:	0f be d0             	movsbl %al,%edx
+     8f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     8f9:	89 d6                	mov    %edx,%esi
+     8fb:	48 89 c7             	mov    %rax,%rdi
+     8fe:	e8 01 14 00 00       	call   1d04 <strchr>
+     903:	48 85 c0             	test   %rax,%rax
+     906:	74 07                	je     90f <peek+0x8a>
+     908:	b8 01 00 00 00       	mov    $0x1,%eax
+     90d:	eb 05                	jmp    914 <peek+0x8f>
+     90f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     914:	c9                   	leave
+     915:	c3                   	ret
+
+0000000000000916 <parsecmd>:
+struct cmd *parseline(char **, char *);
+struct cmd *parsepipe(char **, char *);
+struct cmd *parseexec(char **, char *);
+struct cmd *nulterminate(struct cmd *);
+
+struct cmd *parsecmd(char *s) {
+     916:	55                   	push   %rbp
+     917:	48 89 e5             	mov    %rsp,%rbp
+     91a:	53                   	push   %rbx
+     91b:	48 83 ec 28          	sub    $0x28,%rsp
+     91f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  char *es;
+  struct cmd *cmd;
+
+  syntaxerr = 0;
+     923:	c7 05 33 37 00 00 00 	movl   $0x0,0x3733(%rip)        # 4060 <syntaxerr>
+     92a:	00 00 00 
+  es = s + strlen(s);
+     92d:	48 8b 5d d8          	mov    -0x28(%rbp),%rbx
+     931:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     935:	48 89 c7             	mov    %rax,%rdi
+     938:	e8 92 12 00 00       	call   1bcf <strlen>
+     93d:	89 c0                	mov    %eax,%eax
+     93f:	48 01 d8             	add    %rbx,%rax
+     942:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  cmd = parseline(&s, es);
+     946:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     94a:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     94e:	48 89 d6             	mov    %rdx,%rsi
+     951:	48 89 c7             	mov    %rax,%rdi
+     954:	e8 94 00 00 00       	call   9ed <parseline>
+     959:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  peek(&s, es, "");
+     95d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     961:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     965:	48 8d 15 66 25 00 00 	lea    0x2566(%rip),%rdx        # 2ed2 <benchreport+0x1b8>
+     96c:	48 89 ce             	mov    %rcx,%rsi
+     96f:	48 89 c7             	mov    %rax,%rdi
+     972:	e8 0e ff ff ff       	call   885 <peek>
+  if (s != es && !syntaxerr) {
+     977:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     97b:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     97f:	74 39                	je     9ba <parsecmd+0xa4>
+     981:	8b 05 d9 36 00 00    	mov    0x36d9(%rip),%eax        # 4060 <syntaxerr>
+     987:	85 c0                	test   %eax,%eax
+     989:	75 2f                	jne    9ba <parsecmd+0xa4>
+    printf(2, "leftovers: %s\n", s);
+     98b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     98f:	48 89 c2             	mov    %rax,%rdx
+     992:	48 8d 05 3a 25 00 00 	lea    0x253a(%rip),%rax        # 2ed3 <benchreport+0x1b9>
+     999:	48 89 c6             	mov    %rax,%rsi
+     99c:	bf 02 00 00 00       	mov    $0x2,%edi
+     9a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a6:	e8 a2 08 00 00       	call   124d <printf>
+    syntax("syntax");
+     9ab:	48 8d 05 30 25 00 00 	lea    0x2530(%rip),%rax        # 2ee2 <benchreport+0x1c8>
+     9b2:	48 89 c7             	mov    %rax,%rdi
+     9b5:	e8 0c fb ff ff       	call   4c6 <syntax>
+  }
+  if (syntaxerr) {
+     9ba:	8b 05 a0 36 00 00    	mov    0x36a0(%rip),%eax        # 4060 <syntaxerr>
+     9c0:	85 c0                	test   %eax,%eax
+     9c2:	74 13                	je     9d7 <parsecmd+0xc1>
+    freecmd(cmd);
+     9c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     9c8:	48 89 c7             	mov    %rax,%rdi
+     9cb:	e8 0a 06 00 00       	call   fda <freecmd>
+    return 0;
+     9d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d5:	eb 10                	jmp    9e7 <parsecmd+0xd1>
+  }
+  nulterminate(cmd);
+     9d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     9db:	48 89 c7             	mov    %rax,%rdi
+     9de:	e8 cd 04 00 00       	call   eb0 <nulterminate>
+  return cmd;
+     9e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+     9e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     9eb:	c9                   	leave
+     9ec:	c3                   	ret
+
+00000000000009ed <parseline>:
+
+struct cmd *parseline(char **ps, char *es) {
+     9ed:	55                   	push   %rbp
+     9ee:	48 89 e5             	mov    %rsp,%rbp
+     9f1:	48 83 ec 20          	sub    $0x20,%rsp
+     9f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     9f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     9fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     a01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a05:	48 89 d6             	mov    %rdx,%rsi
+     a08:	48 89 c7             	mov    %rax,%rdi
+     a0b:	e8 b5 00 00 00       	call   ac5 <parsepipe>
+     a10:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (peek(ps, es, "&")) {
+     a14:	eb 2a                	jmp    a40 <parseline+0x53>
+    gettoken(ps, es, 0, 0);
+     a16:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     a1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a23:	ba 00 00 00 00       	mov    $0x0,%edx
+     a28:	48 89 c7             	mov    %rax,%rdi
+     a2b:	e8 ca fc ff ff       	call   6fa <gettoken>
+    cmd = backcmd(cmd);
+     a30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a34:	48 89 c7             	mov    %rax,%rdi
+     a37:	e8 72 fc ff ff       	call   6ae <backcmd>
+     a3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (peek(ps, es, "&")) {
+     a40:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     a44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a48:	48 8d 15 9a 24 00 00 	lea    0x249a(%rip),%rdx        # 2ee9 <benchreport+0x1cf>
+     a4f:	48 89 ce             	mov    %rcx,%rsi
+     a52:	48 89 c7             	mov    %rax,%rdi
+     a55:	e8 2b fe ff ff       	call   885 <peek>
+     a5a:	85 c0                	test   %eax,%eax
+     a5c:	75 b8                	jne    a16 <parseline+0x29>
+  }
+  if (peek(ps, es, ";")) {
+     a5e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a66:	48 8d 15 7e 24 00 00 	lea    0x247e(%rip),%rdx        # 2eeb <benchreport+0x1d1>
+     a6d:	48 89 ce             	mov    %rcx,%rsi
+     a70:	48 89 c7             	mov    %rax,%rdi
+     a73:	e8 0d fe ff ff       	call   885 <peek>
+     a78:	85 c0                	test   %eax,%eax
+     a7a:	74 43                	je     abf <parseline+0xd2>
+    gettoken(ps, es, 0, 0);
+     a7c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     a80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a84:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a89:	ba 00 00 00 00       	mov    $0x0,%edx
+     a8e:	48 89 c7             	mov    %rax,%rdi
+     a91:	e8 64 fc ff ff       	call   6fa <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     a96:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     a9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a9e:	48 89 d6             	mov    %rdx,%rsi
+     aa1:	48 89 c7             	mov    %rax,%rdi
+     aa4:	e8 44 ff ff ff       	call   9ed <parseline>
+     aa9:	48 89 c2             	mov    %rax,%rdx
+     aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ab0:	48 89 d6             	mov    %rdx,%rsi
+     ab3:	48 89 c7             	mov    %rax,%rdi
+     ab6:	e8 97 fb ff ff       	call   652 <listcmd>
+     abb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+  return cmd;
+     abf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     ac3:	c9                   	leave
+     ac4:	c3                   	ret
+
+0000000000000ac5 <parsepipe>:
+
+struct cmd *parsepipe(char **ps, char *es) {
+     ac5:	55                   	push   %rbp
+     ac6:	48 89 e5             	mov    %rsp,%rbp
+     ac9:	48 83 ec 20          	sub    $0x20,%rsp
+     acd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ad1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     ad5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     ad9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     add:	48 89 d6             	mov    %rdx,%rsi
+     ae0:	48 89 c7             	mov    %rax,%rdi
+     ae3:	e8 56 02 00 00       	call   d3e <parseexec>
+     ae8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (peek(ps, es, "|")) {
+     aec:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     af0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     af4:	48 8d 15 f2 23 00 00 	lea    0x23f2(%rip),%rdx        # 2eed <benchreport+0x1d3>
+     afb:	48 89 ce             	mov    %rcx,%rsi
+     afe:	48 89 c7             	mov    %rax,%rdi
+     b01:	e8 7f fd ff ff       	call   885 <peek>
+     b06:	85 c0                	test   %eax,%eax
+     b08:	74 43                	je     b4d <parsepipe+0x88>
+    gettoken(ps, es, 0, 0);
+     b0a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b12:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b17:	ba 00 00 00 00       	mov    $0x0,%edx
+     b1c:	48 89 c7             	mov    %rax,%rdi
+     b1f:	e8 d6 fb ff ff       	call   6fa <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     b24:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b2c:	48 89 d6             	mov    %rdx,%rsi
+     b2f:	48 89 c7             	mov    %rax,%rdi
+     b32:	e8 8e ff ff ff       	call   ac5 <parsepipe>
+     b37:	48 89 c2             	mov    %rax,%rdx
+     b3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b3e:	48 89 d6             	mov    %rdx,%rsi
+     b41:	48 89 c7             	mov    %rax,%rdi
+     b44:	e8 ad fa ff ff       	call   5f6 <pipecmd>
+     b49:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+  return cmd;
+     b4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b51:	c9                   	leave
+     b52:	c3                   	ret
+
+0000000000000b53 <parseredirs>:
+
+struct cmd *parseredirs(struct cmd *cmd, char **ps, char *es) {
+     b53:	55                   	push   %rbp
+     b54:	48 89 e5             	mov    %rsp,%rbp
+     b57:	48 83 ec 40          	sub    $0x40,%rsp
+     b5b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+     b5f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     b63:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int tok;
+  char *q, *eq;
+
+  while (peek(ps, es, "<>")) {
+     b67:	e9 d4 00 00 00       	jmp    c40 <parseredirs+0xed>
+    tok = gettoken(ps, es, 0, 0);
+     b6c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+     b70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     b74:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b79:	ba 00 00 00 00       	mov    $0x0,%edx
+     b7e:	48 89 c7             	mov    %rax,%rdi
+     b81:	e8 74 fb ff ff       	call   6fa <gettoken>
+     b86:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (gettoken(ps, es, &q, &eq) != 'a') {
+     b89:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     b8d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+     b91:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+     b95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     b99:	48 89 c7             	mov    %rax,%rdi
+     b9c:	e8 59 fb ff ff       	call   6fa <gettoken>
+     ba1:	83 f8 61             	cmp    $0x61,%eax
+     ba4:	74 14                	je     bba <parseredirs+0x67>
+      syntax("missing file for redirection");
+     ba6:	48 8d 05 42 23 00 00 	lea    0x2342(%rip),%rax        # 2eef <benchreport+0x1d5>
+     bad:	48 89 c7             	mov    %rax,%rdi
+     bb0:	e8 11 f9 ff ff       	call   4c6 <syntax>
+      break;
+     bb5:	e9 a8 00 00 00       	jmp    c62 <parseredirs+0x10f>
+    }
+    switch (tok) {
+     bba:	83 7d fc 3e          	cmpl   $0x3e,-0x4(%rbp)
+     bbe:	74 37                	je     bf7 <parseredirs+0xa4>
+     bc0:	83 7d fc 3e          	cmpl   $0x3e,-0x4(%rbp)
+     bc4:	7f 7a                	jg     c40 <parseredirs+0xed>
+     bc6:	83 7d fc 2b          	cmpl   $0x2b,-0x4(%rbp)
+     bca:	74 50                	je     c1c <parseredirs+0xc9>
+     bcc:	83 7d fc 3c          	cmpl   $0x3c,-0x4(%rbp)
+     bd0:	75 6e                	jne    c40 <parseredirs+0xed>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     bd2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     bd6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     bda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     bde:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+     be9:	48 89 c7             	mov    %rax,%rdi
+     bec:	e8 7e f9 ff ff       	call   56f <redircmd>
+     bf1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     bf5:	eb 49                	jmp    c40 <parseredirs+0xed>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     bf7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     bfb:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     bff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     c03:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+     c09:	b9 01 02 00 00       	mov    $0x201,%ecx
+     c0e:	48 89 c7             	mov    %rax,%rdi
+     c11:	e8 59 f9 ff ff       	call   56f <redircmd>
+     c16:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     c1a:	eb 24                	jmp    c40 <parseredirs+0xed>
+    case '+': // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     c1c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     c20:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     c24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     c28:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+     c2e:	b9 01 02 00 00       	mov    $0x201,%ecx
+     c33:	48 89 c7             	mov    %rax,%rdi
+     c36:	e8 34 f9 ff ff       	call   56f <redircmd>
+     c3b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     c3f:	90                   	nop
+  while (peek(ps, es, "<>")) {
+     c40:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     c44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c48:	48 8d 15 bd 22 00 00 	lea    0x22bd(%rip),%rdx        # 2f0c <benchreport+0x1f2>
+     c4f:	48 89 ce             	mov    %rcx,%rsi
+     c52:	48 89 c7             	mov    %rax,%rdi
+     c55:	e8 2b fc ff ff       	call   885 <peek>
+     c5a:	85 c0                	test   %eax,%eax
+     c5c:	0f 85 0a ff ff ff    	jne    b6c <parseredirs+0x19>
+    }
+  }
+  return cmd;
+     c62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+     c66:	c9                   	leave
+     c67:	c3                   	ret
+
+0000000000000c68 <parseblock>:
+
+struct cmd *parseblock(char **ps, char *es) {
+     c68:	55                   	push   %rbp
+     c69:	48 89 e5             	mov    %rsp,%rbp
+     c6c:	48 83 ec 20          	sub    $0x20,%rsp
+     c70:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c74:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  if (!peek(ps, es, "("))
+     c78:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     c7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c80:	48 8d 15 88 22 00 00 	lea    0x2288(%rip),%rdx        # 2f0f <benchreport+0x1f5>
+     c87:	48 89 ce             	mov    %rcx,%rsi
+     c8a:	48 89 c7             	mov    %rax,%rdi
+     c8d:	e8 f3 fb ff ff       	call   885 <peek>
+     c92:	85 c0                	test   %eax,%eax
+     c94:	75 0f                	jne    ca5 <parseblock+0x3d>
+    panic("parseblock");
+     c96:	48 8d 05 74 22 00 00 	lea    0x2274(%rip),%rax        # 2f11 <benchreport+0x1f7>
+     c9d:	48 89 c7             	mov    %rax,%rdi
+     ca0:	e8 f0 f7 ff ff       	call   495 <panic>
+  gettoken(ps, es, 0, 0);
+     ca5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     ca9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cad:	b9 00 00 00 00       	mov    $0x0,%ecx
+     cb2:	ba 00 00 00 00       	mov    $0x0,%edx
+     cb7:	48 89 c7             	mov    %rax,%rdi
+     cba:	e8 3b fa ff ff       	call   6fa <gettoken>
+  cmd = parseline(ps, es);
+     cbf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     cc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cc7:	48 89 d6             	mov    %rdx,%rsi
+     cca:	48 89 c7             	mov    %rax,%rdi
+     ccd:	e8 1b fd ff ff       	call   9ed <parseline>
+     cd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!peek(ps, es, ")"))
+     cd6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     cda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cde:	48 8d 15 37 22 00 00 	lea    0x2237(%rip),%rdx        # 2f1c <benchreport+0x202>
+     ce5:	48 89 ce             	mov    %rcx,%rsi
+     ce8:	48 89 c7             	mov    %rax,%rdi
+     ceb:	e8 95 fb ff ff       	call   885 <peek>
+     cf0:	85 c0                	test   %eax,%eax
+     cf2:	75 0f                	jne    d03 <parseblock+0x9b>
+    syntax("syntax - missing )");
+     cf4:	48 8d 05 23 22 00 00 	lea    0x2223(%rip),%rax        # 2f1e <benchreport+0x204>
+     cfb:	48 89 c7             	mov    %rax,%rdi
+     cfe:	e8 c3 f7 ff ff       	call   4c6 <syntax>
+  gettoken(ps, es, 0, 0);
+     d03:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     d07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d10:	ba 00 00 00 00       	mov    $0x0,%edx
+     d15:	48 89 c7             	mov    %rax,%rdi
+     d18:	e8 dd f9 ff ff       	call   6fa <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     d1d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     d21:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     d25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d29:	48 89 ce             	mov    %rcx,%rsi
+     d2c:	48 89 c7             	mov    %rax,%rdi
+     d2f:	e8 1f fe ff ff       	call   b53 <parseredirs>
+     d34:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return cmd;
+     d38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     d3c:	c9                   	leave
+     d3d:	c3                   	ret
+
+0000000000000d3e <parseexec>:
+
+struct cmd *parseexec(char **ps, char *es) {
+     d3e:	55                   	push   %rbp
+     d3f:	48 89 e5             	mov    %rsp,%rbp
+     d42:	48 83 ec 40          	sub    $0x40,%rsp
+     d46:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+     d4a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if (peek(ps, es, "("))
+     d4e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     d52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d56:	48 8d 15 b2 21 00 00 	lea    0x21b2(%rip),%rdx        # 2f0f <benchreport+0x1f5>
+     d5d:	48 89 ce             	mov    %rcx,%rsi
+     d60:	48 89 c7             	mov    %rax,%rdi
+     d63:	e8 1d fb ff ff       	call   885 <peek>
+     d68:	85 c0                	test   %eax,%eax
+     d6a:	74 18                	je     d84 <parseexec+0x46>
+    return parseblock(ps, es);
+     d6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     d70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d74:	48 89 d6             	mov    %rdx,%rsi
+     d77:	48 89 c7             	mov    %rax,%rdi
+     d7a:	e8 e9 fe ff ff       	call   c68 <parseblock>
+     d7f:	e9 2a 01 00 00       	jmp    eae <parseexec+0x170>
+
+  ret = execcmd();
+     d84:	e8 aa f7 ff ff       	call   533 <execcmd>
+     d89:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  cmd = (struct execcmd *)ret;
+     d8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d91:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  argc = 0;
+     d95:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  ret = parseredirs(ret, ps, es);
+     d9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     da0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     da4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     da8:	48 89 ce             	mov    %rcx,%rsi
+     dab:	48 89 c7             	mov    %rax,%rdi
+     dae:	e8 a0 fd ff ff       	call   b53 <parseredirs>
+     db3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (!peek(ps, es, "|)&;")) {
+     db7:	e9 9f 00 00 00       	jmp    e5b <parseexec+0x11d>
+    if ((tok = gettoken(ps, es, &q, &eq)) == 0)
+     dbc:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+     dc0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+     dc4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+     dc8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     dcc:	48 89 c7             	mov    %rax,%rdi
+     dcf:	e8 26 f9 ff ff       	call   6fa <gettoken>
+     dd4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+     dd7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     ddb:	0f 84 9e 00 00 00    	je     e7f <parseexec+0x141>
+      break;
+    if (tok != 'a') {
+     de1:	83 7d e4 61          	cmpl   $0x61,-0x1c(%rbp)
+     de5:	74 14                	je     dfb <parseexec+0xbd>
+      syntax("syntax");
+     de7:	48 8d 05 f4 20 00 00 	lea    0x20f4(%rip),%rax        # 2ee2 <benchreport+0x1c8>
+     dee:	48 89 c7             	mov    %rax,%rdi
+     df1:	e8 d0 f6 ff ff       	call   4c6 <syntax>
+      break;
+     df6:	e9 85 00 00 00       	jmp    e80 <parseexec+0x142>
+    }
+    if (argc == MAXARGS - 1) {
+     dfb:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     dff:	75 11                	jne    e12 <parseexec+0xd4>
+      syntax("too many args");
+     e01:	48 8d 05 29 21 00 00 	lea    0x2129(%rip),%rax        # 2f31 <benchreport+0x217>
+     e08:	48 89 c7             	mov    %rax,%rdi
+     e0b:	e8 b6 f6 ff ff       	call   4c6 <syntax>
+      break;
+     e10:	eb 6e                	jmp    e80 <parseexec+0x142>
+    }
+    cmd->argv[argc] = q;
+     e12:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     e16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e1a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e1d:	48 63 d2             	movslq %edx,%rdx
+     e20:	48 89 4c d0 08       	mov    %rcx,0x8(%rax,%rdx,8)
+    cmd->eargv[argc] = eq;
+     e25:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     e29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e2d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     e30:	48 63 c9             	movslq %ecx,%rcx
+     e33:	48 83 c1 0a          	add    $0xa,%rcx
+     e37:	48 89 54 c8 08       	mov    %rdx,0x8(%rax,%rcx,8)
+    argc++;
+     e3c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    ret = parseredirs(ret, ps, es);
+     e40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     e44:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     e48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e4c:	48 89 ce             	mov    %rcx,%rsi
+     e4f:	48 89 c7             	mov    %rax,%rdi
+     e52:	e8 fc fc ff ff       	call   b53 <parseredirs>
+     e57:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (!peek(ps, es, "|)&;")) {
+     e5b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     e5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     e63:	48 8d 15 d5 20 00 00 	lea    0x20d5(%rip),%rdx        # 2f3f <benchreport+0x225>
+     e6a:	48 89 ce             	mov    %rcx,%rsi
+     e6d:	48 89 c7             	mov    %rax,%rdi
+     e70:	e8 10 fa ff ff       	call   885 <peek>
+     e75:	85 c0                	test   %eax,%eax
+     e77:	0f 84 3f ff ff ff    	je     dbc <parseexec+0x7e>
+     e7d:	eb 01                	jmp    e80 <parseexec+0x142>
+      break;
+     e7f:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     e80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e84:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e87:	48 63 d2             	movslq %edx,%rdx
+     e8a:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+     e91:	00 00 
+  cmd->eargv[argc] = 0;
+     e93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e97:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e9a:	48 63 d2             	movslq %edx,%rdx
+     e9d:	48 83 c2 0a          	add    $0xa,%rdx
+     ea1:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+     ea8:	00 00 
+  return ret;
+     eaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+     eae:	c9                   	leave
+     eaf:	c3                   	ret
+
+0000000000000eb0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd *nulterminate(struct cmd *cmd) {
+     eb0:	55                   	push   %rbp
+     eb1:	48 89 e5             	mov    %rsp,%rbp
+     eb4:	48 83 ec 40          	sub    $0x40,%rsp
+     eb8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if (cmd == 0)
+     ebc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     ec1:	75 0a                	jne    ecd <nulterminate+0x1d>
+    return 0;
+     ec3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ec8:	e9 0b 01 00 00       	jmp    fd8 <nulterminate+0x128>
+
+  switch (cmd->type) {
+     ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     ed1:	8b 00                	mov    (%rax),%eax
+     ed3:	83 f8 05             	cmp    $0x5,%eax
+     ed6:	0f 87 f8 00 00 00    	ja     fd4 <nulterminate+0x124>
+     edc:	89 c0                	mov    %eax,%eax
+     ede:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     ee5:	00 
+     ee6:	48 8d 05 57 20 00 00 	lea    0x2057(%rip),%rax        # 2f44 <benchreport+0x22a>
+     eed:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     ef0:	48 98                	cltq
+     ef2:	48 8d 15 4b 20 00 00 	lea    0x204b(%rip),%rdx        # 2f44 <benchreport+0x22a>
+     ef9:	48 01 d0             	add    %rdx,%rax
+     efc:	ff e0                	jmp    *%rax
+  case EXEC:
+    ecmd = (struct execcmd *)cmd;
+     efe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f02:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    for (i = 0; ecmd->argv[i]; i++)
+     f06:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     f0d:	eb 1a                	jmp    f29 <nulterminate+0x79>
+      *ecmd->eargv[i] = 0;
+     f0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f13:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f16:	48 63 d2             	movslq %edx,%rdx
+     f19:	48 83 c2 0a          	add    $0xa,%rdx
+     f1d:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     f22:	c6 00 00             	movb   $0x0,(%rax)
+    for (i = 0; ecmd->argv[i]; i++)
+     f25:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     f29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f2d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f30:	48 63 d2             	movslq %edx,%rdx
+     f33:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     f38:	48 85 c0             	test   %rax,%rax
+     f3b:	75 d2                	jne    f0f <nulterminate+0x5f>
+    break;
+     f3d:	e9 92 00 00 00       	jmp    fd4 <nulterminate+0x124>
+
+  case REDIR:
+    rcmd = (struct redircmd *)cmd;
+     f42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f46:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    nulterminate(rcmd->cmd);
+     f4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     f4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+     f52:	48 89 c7             	mov    %rax,%rdi
+     f55:	e8 56 ff ff ff       	call   eb0 <nulterminate>
+    *rcmd->efile = 0;
+     f5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     f5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+     f62:	c6 00 00             	movb   $0x0,(%rax)
+    break;
+     f65:	eb 6d                	jmp    fd4 <nulterminate+0x124>
+
+  case PIPE:
+    pcmd = (struct pipecmd *)cmd;
+     f67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f6b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    nulterminate(pcmd->left);
+     f6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f73:	48 8b 40 08          	mov    0x8(%rax),%rax
+     f77:	48 89 c7             	mov    %rax,%rdi
+     f7a:	e8 31 ff ff ff       	call   eb0 <nulterminate>
+    nulterminate(pcmd->right);
+     f7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f83:	48 8b 40 10          	mov    0x10(%rax),%rax
+     f87:	48 89 c7             	mov    %rax,%rdi
+     f8a:	e8 21 ff ff ff       	call   eb0 <nulterminate>
+    break;
+     f8f:	eb 43                	jmp    fd4 <nulterminate+0x124>
+
+  case LIST:
+    lcmd = (struct listcmd *)cmd;
+     f91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    nulterminate(lcmd->left);
+     f99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f9d:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fa1:	48 89 c7             	mov    %rax,%rdi
+     fa4:	e8 07 ff ff ff       	call   eb0 <nulterminate>
+    nulterminate(lcmd->right);
+     fa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fad:	48 8b 40 10          	mov    0x10(%rax),%rax
+     fb1:	48 89 c7             	mov    %rax,%rdi
+     fb4:	e8 f7 fe ff ff       	call   eb0 <nulterminate>
+    break;
+     fb9:	eb 19                	jmp    fd4 <nulterminate+0x124>
+
+  case BACK:
+    bcmd = (struct backcmd *)cmd;
+     fbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     fbf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nulterminate(bcmd->cmd);
+     fc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fc7:	48 8b 40 08          	mov    0x8(%rax),%rax
+     fcb:	48 89 c7             	mov    %rax,%rdi
+     fce:	e8 dd fe ff ff       	call   eb0 <nulterminate>
+    break;
+     fd3:	90                   	nop
+  }
+  return cmd;
+     fd4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+     fd8:	c9                   	leave
+     fd9:	c3                   	ret
+
+0000000000000fda <freecmd>:
+
+// Free a command parsecmd() returned.
+void freecmd(struct cmd *cmd) {
+     fda:	55                   	push   %rbp
+     fdb:	48 89 e5             	mov    %rsp,%rbp
+     fde:	48 83 ec 10          	sub    $0x10,%rsp
+     fe2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (cmd == 0)
+     fe6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     feb:	0f 84 9b 00 00 00    	je     108c <freecmd+0xb2>
+    return;
+
+  switch (cmd->type) {
+     ff1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff5:	8b 00                	mov    (%rax),%eax
+     ff7:	83 f8 05             	cmp    $0x5,%eax
+     ffa:	74 71                	je     106d <freecmd+0x93>
+     ffc:	83 f8 05             	cmp    $0x5,%eax
+     fff:	7f 7d                	jg     107e <freecmd+0xa4>
+    1001:	83 f8 04             	cmp    $0x4,%eax
+    1004:	74 45                	je     104b <freecmd+0x71>
+    1006:	83 f8 04             	cmp    $0x4,%eax
+    1009:	7f 73                	jg     107e <freecmd+0xa4>
+    100b:	83 f8 02             	cmp    $0x2,%eax
+    100e:	74 07                	je     1017 <freecmd+0x3d>
+    1010:	83 f8 03             	cmp    $0x3,%eax
+    1013:	74 14                	je     1029 <freecmd+0x4f>
+    1015:	eb 67                	jmp    107e <freecmd+0xa4>
+  case REDIR:
+    freecmd(((struct redircmd *)cmd)->cmd);
+    1017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    101b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    101f:	48 89 c7             	mov    %rax,%rdi
+    1022:	e8 b3 ff ff ff       	call   fda <freecmd>
+    break;
+    1027:	eb 55                	jmp    107e <freecmd+0xa4>
+
+  case PIPE:
+    freecmd(((struct pipecmd *)cmd)->left);
+    1029:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    102d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1031:	48 89 c7             	mov    %rax,%rdi
+    1034:	e8 a1 ff ff ff       	call   fda <freecmd>
+    freecmd(((struct pipecmd *)cmd)->right);
+    1039:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    103d:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1041:	48 89 c7             	mov    %rax,%rdi
+    1044:	e8 91 ff ff ff       	call   fda <freecmd>
+    break;
+    1049:	eb 33                	jmp    107e <freecmd+0xa4>
+
+  case LIST:
+    freecmd(((struct listcmd *)cmd)->left);
+    104b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    104f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1053:	48 89 c7             	mov    %rax,%rdi
+    1056:	e8 7f ff ff ff       	call   fda <freecmd>
+    freecmd(((struct listcmd *)cmd)->right);
+    105b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105f:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1063:	48 89 c7             	mov    %rax,%rdi
+    1066:	e8 6f ff ff ff       	call   fda <freecmd>
+    break;
+    106b:	eb 11                	jmp    107e <freecmd+0xa4>
+
+  case BACK:
+    freecmd(((struct backcmd *)cmd)->cmd);
+    106d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1071:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1075:	48 89 c7             	mov    %rax,%rdi
+    1078:	e8 5d ff ff ff       	call   fda <freecmd>
+    break;
+    107d:	90                   	nop
+  }
+  free(cmd);
+    107e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1082:	48 89 c7             	mov    %rax,%rdi
+    1085:	e8 4b 1a 00 00       	call   2ad5 <free>
+    108a:	eb 01                	jmp    108d <freecmd+0xb3>
+    return;
+    108c:	90                   	nop
+}
+    108d:	c9                   	leave
+    108e:	c3                   	ret
+
+000000000000108f <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+    108f:	55                   	push   %rbp
+    1090:	48 89 e5             	mov    %rsp,%rbp
+    1093:	48 83 ec 10          	sub    $0x10,%rsp
+    1097:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    109a:	89 f0                	mov    %esi,%eax
+    109c:	88 45 f8             	mov    %al,-0x8(%rbp)
+    109f:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+    10a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10a6:	89 d6                	mov    %edx,%esi
+    10a8:	89 c7                	mov    %eax,%edi
+    10aa:	e8 eb 06 00 00       	call   179a <bputc>
+    10af:	90                   	nop
+    10b0:	c9                   	leave
+    10b1:	c3                   	ret
+
+00000000000010b2 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+    10b2:	55                   	push   %rbp
+    10b3:	48 89 e5             	mov    %rsp,%rbp
+    10b6:	48 83 ec 50          	sub    $0x50,%rsp
+    10ba:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    10bd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    10c1:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    10c4:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+    10c7:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    10cb:	74 21                	je     10ee <printint64+0x3c>
+    10cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    10d1:	48 c1 e8 3f          	shr    $0x3f,%rax
+    10d5:	0f b6 c0             	movzbl %al,%eax
+    10d8:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    10db:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    10df:	74 0d                	je     10ee <printint64+0x3c>
+    x = -xx;
+    10e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    10e5:	48 f7 d8             	neg    %rax
+    10e8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    10ec:	eb 08                	jmp    10f6 <printint64+0x44>
+  else
+    x = xx;
+    10ee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    10f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    10f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    10fd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1100:	48 63 c8             	movslq %eax,%rcx
+    1103:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1107:	ba 00 00 00 00       	mov    $0x0,%edx
+    110c:	48 f7 f1             	div    %rcx
+    110f:	48 89 d1             	mov    %rdx,%rcx
+    1112:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1115:	8d 50 01             	lea    0x1(%rax),%edx
+    1118:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    111b:	48 8d 15 fe 2e 00 00 	lea    0x2efe(%rip),%rdx        # 4020 <digits.1>
+    1122:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1126:	48 98                	cltq
+    1128:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    112c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    112f:	48 63 f0             	movslq %eax,%rsi
+    1132:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1136:	ba 00 00 00 00       	mov    $0x0,%edx
+    113b:	48 f7 f6             	div    %rsi
+    113e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1142:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1147:	75 b4                	jne    10fd <printint64+0x4b>
+
+  if (sgn)
+    1149:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+    114d:	74 2b                	je     117a <printint64+0xc8>
+    buf[i++] = '-';
+    114f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1152:	8d 50 01             	lea    0x1(%rax),%edx
+    1155:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1158:	48 98                	cltq
+    115a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+    115f:	eb 19                	jmp    117a <printint64+0xc8>
+    putc(fd, buf[i]);
+    1161:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1164:	48 98                	cltq
+    1166:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    116b:	0f be d0             	movsbl %al,%edx
+    116e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1171:	89 d6                	mov    %edx,%esi
+    1173:	89 c7                	mov    %eax,%edi
+    1175:	e8 15 ff ff ff       	call   108f <putc>
+  while (--i >= 0)
+    117a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    117e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1182:	79 dd                	jns    1161 <printint64+0xaf>
+}
+    1184:	90                   	nop
+    1185:	90                   	nop
+    1186:	c9                   	leave
+    1187:	c3                   	ret
+
+0000000000001188 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+    1188:	55                   	push   %rbp
+    1189:	48 89 e5             	mov    %rsp,%rbp
+    118c:	48 83 ec 30          	sub    $0x30,%rsp
+    1190:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1193:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1196:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1199:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    119c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+    11a3:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    11a7:	74 17                	je     11c0 <printint+0x38>
+    11a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    11ad:	79 11                	jns    11c0 <printint+0x38>
+    neg = 1;
+    11af:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    11b6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    11b9:	f7 d8                	neg    %eax
+    11bb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    11be:	eb 06                	jmp    11c6 <printint+0x3e>
+  } else {
+    x = xx;
+    11c0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    11c3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    11c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+    11cd:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    11d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11d3:	ba 00 00 00 00       	mov    $0x0,%edx
+    11d8:	f7 f1                	div    %ecx
+    11da:	89 d1                	mov    %edx,%ecx
+    11dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11df:	8d 50 01             	lea    0x1(%rax),%edx
+    11e2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    11e5:	89 c9                	mov    %ecx,%ecx
+    11e7:	48 8d 15 52 2e 00 00 	lea    0x2e52(%rip),%rdx        # 4040 <digits.0>
+    11ee:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    11f2:	48 98                	cltq
+    11f4:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+    11f8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    11fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11fe:	ba 00 00 00 00       	mov    $0x0,%edx
+    1203:	f7 f6                	div    %esi
+    1205:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1208:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    120c:	75 bf                	jne    11cd <printint+0x45>
+  if (neg)
+    120e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1212:	74 2b                	je     123f <printint+0xb7>
+    buf[i++] = '-';
+    1214:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1217:	8d 50 01             	lea    0x1(%rax),%edx
+    121a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    121d:	48 98                	cltq
+    121f:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+    1224:	eb 19                	jmp    123f <printint+0xb7>
+    putc(fd, buf[i]);
+    1226:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1229:	48 98                	cltq
+    122b:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1230:	0f be d0             	movsbl %al,%edx
+    1233:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1236:	89 d6                	mov    %edx,%esi
+    1238:	89 c7                	mov    %eax,%edi
+    123a:	e8 50 fe ff ff       	call   108f <putc>
+  while (--i >= 0)
+    123f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1243:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1247:	79 dd                	jns    1226 <printint+0x9e>
+}
+    1249:	90                   	nop
+    124a:	90                   	nop
+    124b:	c9                   	leave
+    124c:	c3                   	ret
+
+000000000000124d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+    124d:	55                   	push   %rbp
+    124e:	48 89 e5             	mov    %rsp,%rbp
+    1251:	48 83 ec 70          	sub    $0x70,%rsp
+    1255:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1258:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    125c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1260:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1264:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1268:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+    126c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1273:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1277:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    127b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    127f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1283:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    128a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1291:	e9 67 02 00 00       	jmp    14fd <printf+0x2b0>
+    c = fmt[i] & 0xff;
+    1296:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1299:	48 63 d0             	movslq %eax,%rdx
+    129c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    12a0:	48 01 d0             	add    %rdx,%rax
+    12a3:	0f b6 00             	movzbl (%rax),%eax
+    12a6:	0f be c0             	movsbl %al,%eax
+    12a9:	25 ff 00 00 00       	and    $0xff,%eax
+    12ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+    12b1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    12b5:	75 30                	jne    12e7 <printf+0x9a>
+      if (c == '%') {
+    12b7:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    12bb:	75 13                	jne    12d0 <printf+0x83>
+        state = '%';
+    12bd:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    12c4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    12cb:	e9 29 02 00 00       	jmp    14f9 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+    12d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    12d3:	0f be d0             	movsbl %al,%edx
+    12d6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    12d9:	89 d6                	mov    %edx,%esi
+    12db:	89 c7                	mov    %eax,%edi
+    12dd:	e8 ad fd ff ff       	call   108f <putc>
+    12e2:	e9 12 02 00 00       	jmp    14f9 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+    12e7:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    12eb:	0f 85 08 02 00 00    	jne    14f9 <printf+0x2ac>
+      if (c == 'l') {
+    12f1:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    12f5:	75 0c                	jne    1303 <printf+0xb6>
+        lflag = 1;
+    12f7:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    12fe:	e9 f6 01 00 00       	jmp    14f9 <printf+0x2ac>
+      } else if (c == 'd') {
+    1303:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1307:	0f 85 93 00 00 00    	jne    13a0 <printf+0x153>
+        if (lflag == 1)
+    130d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1311:	75 47                	jne    135a <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1313:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1316:	83 f8 2f             	cmp    $0x2f,%eax
+    1319:	77 17                	ja     1332 <printf+0xe5>
+    131b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    131f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1322:	89 d2                	mov    %edx,%edx
+    1324:	48 01 d0             	add    %rdx,%rax
+    1327:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    132a:	83 c2 08             	add    $0x8,%edx
+    132d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1330:	eb 0c                	jmp    133e <printf+0xf1>
+    1332:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1336:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    133a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    133e:	48 8b 30             	mov    (%rax),%rsi
+    1341:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1344:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1349:	ba 0a 00 00 00       	mov    $0xa,%edx
+    134e:	89 c7                	mov    %eax,%edi
+    1350:	e8 5d fd ff ff       	call   10b2 <printint64>
+    1355:	e9 98 01 00 00       	jmp    14f2 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+    135a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    135d:	83 f8 2f             	cmp    $0x2f,%eax
+    1360:	77 17                	ja     1379 <printf+0x12c>
+    1362:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1366:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1369:	89 d2                	mov    %edx,%edx
+    136b:	48 01 d0             	add    %rdx,%rax
+    136e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1371:	83 c2 08             	add    $0x8,%edx
+    1374:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1377:	eb 0c                	jmp    1385 <printf+0x138>
+    1379:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    137d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1381:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1385:	8b 30                	mov    (%rax),%esi
+    1387:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    138a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    138f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1394:	89 c7                	mov    %eax,%edi
+    1396:	e8 ed fd ff ff       	call   1188 <printint>
+    139b:	e9 52 01 00 00       	jmp    14f2 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+    13a0:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    13a4:	74 0a                	je     13b0 <printf+0x163>
+    13a6:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    13aa:	0f 85 93 00 00 00    	jne    1443 <printf+0x1f6>
+        if (lflag == 1)
+    13b0:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    13b4:	75 47                	jne    13fd <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    13b6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    13b9:	83 f8 2f             	cmp    $0x2f,%eax
+    13bc:	77 17                	ja     13d5 <printf+0x188>
+    13be:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13c5:	89 d2                	mov    %edx,%edx
+    13c7:	48 01 d0             	add    %rdx,%rax
+    13ca:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13cd:	83 c2 08             	add    $0x8,%edx
+    13d0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    13d3:	eb 0c                	jmp    13e1 <printf+0x194>
+    13d5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    13d9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    13dd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    13e1:	48 8b 30             	mov    (%rax),%rsi
+    13e4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    13e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    13ec:	ba 10 00 00 00       	mov    $0x10,%edx
+    13f1:	89 c7                	mov    %eax,%edi
+    13f3:	e8 ba fc ff ff       	call   10b2 <printint64>
+        if (lflag == 1)
+    13f8:	e9 f5 00 00 00       	jmp    14f2 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    13fd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1400:	83 f8 2f             	cmp    $0x2f,%eax
+    1403:	77 17                	ja     141c <printf+0x1cf>
+    1405:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1409:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    140c:	89 d2                	mov    %edx,%edx
+    140e:	48 01 d0             	add    %rdx,%rax
+    1411:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1414:	83 c2 08             	add    $0x8,%edx
+    1417:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    141a:	eb 0c                	jmp    1428 <printf+0x1db>
+    141c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1420:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1424:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1428:	8b 30                	mov    (%rax),%esi
+    142a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    142d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1432:	ba 10 00 00 00       	mov    $0x10,%edx
+    1437:	89 c7                	mov    %eax,%edi
+    1439:	e8 4a fd ff ff       	call   1188 <printint>
+        if (lflag == 1)
+    143e:	e9 af 00 00 00       	jmp    14f2 <printf+0x2a5>
+      } else if (c == 's') {
+    1443:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1447:	75 6e                	jne    14b7 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+    1449:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    144c:	83 f8 2f             	cmp    $0x2f,%eax
+    144f:	77 17                	ja     1468 <printf+0x21b>
+    1451:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1455:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1458:	89 d2                	mov    %edx,%edx
+    145a:	48 01 d0             	add    %rdx,%rax
+    145d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1460:	83 c2 08             	add    $0x8,%edx
+    1463:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1466:	eb 0c                	jmp    1474 <printf+0x227>
+    1468:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    146c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1470:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1474:	48 8b 00             	mov    (%rax),%rax
+    1477:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    147b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1480:	75 28                	jne    14aa <printf+0x25d>
+          s = "(null)";
+    1482:	48 8d 05 d3 1a 00 00 	lea    0x1ad3(%rip),%rax        # 2f5c <benchreport+0x242>
+    1489:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+    148d:	eb 1b                	jmp    14aa <printf+0x25d>
+          putc(fd, *s);
+    148f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1493:	0f b6 00             	movzbl (%rax),%eax
+    1496:	0f be d0             	movsbl %al,%edx
+    1499:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    149c:	89 d6                	mov    %edx,%esi
+    149e:	89 c7                	mov    %eax,%edi
+    14a0:	e8 ea fb ff ff       	call   108f <putc>
+        for (; *s; s++)
+    14a5:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    14aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    14ae:	0f b6 00             	movzbl (%rax),%eax
+    14b1:	84 c0                	test   %al,%al
+    14b3:	75 da                	jne    148f <printf+0x242>
+    14b5:	eb 3b                	jmp    14f2 <printf+0x2a5>
+      } else if (c == '%') {
+    14b7:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    14bb:	75 14                	jne    14d1 <printf+0x284>
+        putc(fd, c);
+    14bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    14c0:	0f be d0             	movsbl %al,%edx
+    14c3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14c6:	89 d6                	mov    %edx,%esi
+    14c8:	89 c7                	mov    %eax,%edi
+    14ca:	e8 c0 fb ff ff       	call   108f <putc>
+    14cf:	eb 21                	jmp    14f2 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    14d1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14d4:	be 25 00 00 00       	mov    $0x25,%esi
+    14d9:	89 c7                	mov    %eax,%edi
+    14db:	e8 af fb ff ff       	call   108f <putc>
+        putc(fd, c);
+    14e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    14e3:	0f be d0             	movsbl %al,%edx
+    14e6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14e9:	89 d6                	mov    %edx,%esi
+    14eb:	89 c7                	mov    %eax,%edi
+    14ed:	e8 9d fb ff ff       	call   108f <putc>
+      }
+      state = 0;
+    14f2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+    14f9:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    14fd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1500:	48 63 d0             	movslq %eax,%rdx
+    1503:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1507:	48 01 d0             	add    %rdx,%rax
+    150a:	0f b6 00             	movzbl (%rax),%eax
+    150d:	84 c0                	test   %al,%al
+    150f:	0f 85 81 fd ff ff    	jne    1296 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+    1515:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1518:	89 c7                	mov    %eax,%edi
+    151a:	e8 ee 02 00 00       	call   180d <bflushtty>
+}
+    151f:	90                   	nop
+    1520:	c9                   	leave
+    1521:	c3                   	ret
+
+0000000000001522 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+    1522:	55                   	push   %rbp
+    1523:	48 89 e5             	mov    %rsp,%rbp
+    1526:	48 83 ec 30          	sub    $0x30,%rsp
+    152a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    152d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1531:	78 06                	js     1539 <getbuf+0x17>
+    1533:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+    1537:	7e 0a                	jle    1543 <getbuf+0x21>
+    return 0;
+    1539:	b8 00 00 00 00       	mov    $0x0,%eax
+    153e:	e9 94 00 00 00       	jmp    15d7 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    1543:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1546:	48 98                	cltq
+    1548:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    154f:	00 
+    1550:	48 8d 05 a9 2b 00 00 	lea    0x2ba9(%rip),%rax        # 4100 <obufs>
+    1557:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    155b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    155f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1564:	75 6d                	jne    15d3 <getbuf+0xb1>
+    1566:	bf 08 02 00 00       	mov    $0x208,%edi
+    156b:	e8 bd 13 00 00       	call   292d <malloc>
+    1570:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1574:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1579:	74 58                	je     15d3 <getbuf+0xb1>
+    b->n = 0;
+    157b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    157f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    1585:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+    1589:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    158c:	48 89 d6             	mov    %rdx,%rsi
+    158f:	89 c7                	mov    %eax,%edi
+    1591:	e8 e4 0d 00 00       	call   237a <fstat>
+    1596:	85 c0                	test   %eax,%eax
+    1598:	75 11                	jne    15ab <getbuf+0x89>
+    159a:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+    159e:	66 83 f8 03          	cmp    $0x3,%ax
+    15a2:	75 07                	jne    15ab <getbuf+0x89>
+    15a4:	ba 01 00 00 00       	mov    $0x1,%edx
+    15a9:	eb 05                	jmp    15b0 <getbuf+0x8e>
+    15ab:	ba 00 00 00 00       	mov    $0x0,%edx
+    15b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15b4:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+    15b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    15ba:	48 98                	cltq
+    15bc:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    15c3:	00 
+    15c4:	48 8d 15 35 2b 00 00 	lea    0x2b35(%rip),%rdx        # 4100 <obufs>
+    15cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15cf:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+    15d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    15d7:	c9                   	leave
+    15d8:	c3                   	ret
+
+00000000000015d9 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+    15d9:	55                   	push   %rbp
+    15da:	48 89 e5             	mov    %rsp,%rbp
+    15dd:	48 83 ec 20          	sub    $0x20,%rsp
+    15e1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    15e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+    15e8:	78 33                	js     161d <bflush+0x44>
+    15ea:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+    15ee:	7f 2d                	jg     161d <bflush+0x44>
+    15f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    15f3:	48 98                	cltq
+    15f5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    15fc:	00 
+    15fd:	48 8d 05 fc 2a 00 00 	lea    0x2afc(%rip),%rax        # 4100 <obufs>
+    1604:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1608:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    160c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1611:	74 0a                	je     161d <bflush+0x44>
+    1613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1617:	8b 00                	mov    (%rax),%eax
+    1619:	85 c0                	test   %eax,%eax
+    161b:	75 07                	jne    1624 <bflush+0x4b>
+    return 0;
+    161d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1622:	eb 3c                	jmp    1660 <bflush+0x87>
+  n = b->n;
+    1624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1628:	8b 00                	mov    (%rax),%eax
+    162a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+    162d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1631:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+    1637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    163b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+    163f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1642:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1645:	48 89 ce             	mov    %rcx,%rsi
+    1648:	89 c7                	mov    %eax,%edi
+    164a:	e8 de 0c 00 00       	call   232d <write>
+    164f:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+    1652:	75 07                	jne    165b <bflush+0x82>
+    1654:	b8 00 00 00 00       	mov    $0x0,%eax
+    1659:	eb 05                	jmp    1660 <bflush+0x87>
+    165b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    1660:	c9                   	leave
+    1661:	c3                   	ret
+
+0000000000001662 <bflushall>:
+
+void bflushall(void) {
+    1662:	55                   	push   %rbp
+    1663:	48 89 e5             	mov    %rsp,%rbp
+    1666:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    166a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1671:	eb 0e                	jmp    1681 <bflushall+0x1f>
+    bflush(fd);
+    1673:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1676:	89 c7                	mov    %eax,%edi
+    1678:	e8 5c ff ff ff       	call   15d9 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+    167d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1681:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1685:	7e ec                	jle    1673 <bflushall+0x11>
+}
+    1687:	90                   	nop
+    1688:	90                   	nop
+    1689:	c9                   	leave
+    168a:	c3                   	ret
+
+000000000000168b <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+    168b:	55                   	push   %rbp
+    168c:	48 89 e5             	mov    %rsp,%rbp
+    168f:	48 83 ec 30          	sub    $0x30,%rsp
+    1693:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1696:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    169a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    169d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16a0:	89 c7                	mov    %eax,%edi
+    16a2:	e8 7b fe ff ff       	call   1522 <getbuf>
+    16a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    16ab:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    16b0:	75 19                	jne    16cb <bwrite+0x40>
+    return write(fd, s, n);
+    16b2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+    16b5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+    16b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16bc:	48 89 ce             	mov    %rcx,%rsi
+    16bf:	89 c7                	mov    %eax,%edi
+    16c1:	e8 67 0c 00 00       	call   232d <write>
+    16c6:	e9 cd 00 00 00       	jmp    1798 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+    16cb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    16d2:	e9 92 00 00 00       	jmp    1769 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+    16d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16db:	8b 00                	mov    (%rax),%eax
+    16dd:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16e2:	75 18                	jne    16fc <bwrite+0x71>
+    16e4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    16e7:	89 c7                	mov    %eax,%edi
+    16e9:	e8 eb fe ff ff       	call   15d9 <bflush>
+    16ee:	85 c0                	test   %eax,%eax
+    16f0:	79 0a                	jns    16fc <bwrite+0x71>
+      return -1;
+    16f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    16f7:	e9 9c 00 00 00       	jmp    1798 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+    16fc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    16ff:	2b 45 fc             	sub    -0x4(%rbp),%eax
+    1702:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    1705:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1709:	8b 00                	mov    (%rax),%eax
+    170b:	ba 00 02 00 00       	mov    $0x200,%edx
+    1710:	29 c2                	sub    %eax,%edx
+    1712:	89 55 e8             	mov    %edx,-0x18(%rbp)
+    1715:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1718:	8b 45 e8             	mov    -0x18(%rbp),%eax
+    171b:	39 c2                	cmp    %eax,%edx
+    171d:	0f 4e c2             	cmovle %edx,%eax
+    1720:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+    1723:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1726:	48 63 d0             	movslq %eax,%rdx
+    1729:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    172d:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+    1731:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1735:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1739:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173d:	8b 00                	mov    (%rax),%eax
+    173f:	48 98                	cltq
+    1741:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+    1745:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1748:	89 c2                	mov    %eax,%edx
+    174a:	48 89 cf             	mov    %rcx,%rdi
+    174d:	e8 e9 06 00 00       	call   1e3b <memmove>
+    b->n += m;
+    1752:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1756:	8b 10                	mov    (%rax),%edx
+    1758:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    175b:	01 c2                	add    %eax,%edx
+    175d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1761:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    1763:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1766:	01 45 fc             	add    %eax,-0x4(%rbp)
+    1769:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    176c:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    176f:	0f 8c 62 ff ff ff    	jl     16d7 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    1775:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1779:	8b 40 04             	mov    0x4(%rax),%eax
+    177c:	85 c0                	test   %eax,%eax
+    177e:	74 15                	je     1795 <bwrite+0x10a>
+    1780:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1783:	89 c7                	mov    %eax,%edi
+    1785:	e8 4f fe ff ff       	call   15d9 <bflush>
+    178a:	85 c0                	test   %eax,%eax
+    178c:	79 07                	jns    1795 <bwrite+0x10a>
+    return -1;
+    178e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1793:	eb 03                	jmp    1798 <bwrite+0x10d>
+  return n;
+    1795:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    1798:	c9                   	leave
+    1799:	c3                   	ret
+
+000000000000179a <bputc>:
+
+void bputc(int fd, char c) {
+    179a:	55                   	push   %rbp
+    179b:	48 89 e5             	mov    %rsp,%rbp
+    179e:	48 83 ec 20          	sub    $0x20,%rsp
+    17a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    17a5:	89 f0                	mov    %esi,%eax
+    17a7:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    17aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    17ad:	89 c7                	mov    %eax,%edi
+    17af:	e8 6e fd ff ff       	call   1522 <getbuf>
+    17b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17b8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    17bd:	75 18                	jne    17d7 <bputc+0x3d>
+    write(fd, &c, 1);
+    17bf:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    17c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    17c6:	ba 01 00 00 00       	mov    $0x1,%edx
+    17cb:	48 89 ce             	mov    %rcx,%rsi
+    17ce:	89 c7                	mov    %eax,%edi
+    17d0:	e8 58 0b 00 00       	call   232d <write>
+    return;
+    17d5:	eb 34                	jmp    180b <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    17d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17db:	8b 00                	mov    (%rax),%eax
+    17dd:	3d 00 02 00 00       	cmp    $0x200,%eax
+    17e2:	75 0a                	jne    17ee <bputc+0x54>
+    bflush(fd);
+    17e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    17e7:	89 c7                	mov    %eax,%edi
+    17e9:	e8 eb fd ff ff       	call   15d9 <bflush>
+  b->data[b->n++] = c;
+    17ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17f2:	8b 00                	mov    (%rax),%eax
+    17f4:	8d 48 01             	lea    0x1(%rax),%ecx
+    17f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    17fb:	89 0a                	mov    %ecx,(%rdx)
+    17fd:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    1801:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1805:	48 98                	cltq
+    1807:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    180b:	c9                   	leave
+    180c:	c3                   	ret
+
+000000000000180d <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    180d:	55                   	push   %rbp
+    180e:	48 89 e5             	mov    %rsp,%rbp
+    1811:	48 83 ec 10          	sub    $0x10,%rsp
+    1815:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    1818:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    181c:	78 4c                	js     186a <bflushtty+0x5d>
+    181e:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    1822:	7f 46                	jg     186a <bflushtty+0x5d>
+    1824:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1827:	48 98                	cltq
+    1829:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1830:	00 
+    1831:	48 8d 05 c8 28 00 00 	lea    0x28c8(%rip),%rax        # 4100 <obufs>
+    1838:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    183c:	48 85 c0             	test   %rax,%rax
+    183f:	74 29                	je     186a <bflushtty+0x5d>
+    1841:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1844:	48 98                	cltq
+    1846:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    184d:	00 
+    184e:	48 8d 05 ab 28 00 00 	lea    0x28ab(%rip),%rax        # 4100 <obufs>
+    1855:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1859:	8b 40 04             	mov    0x4(%rax),%eax
+    185c:	85 c0                	test   %eax,%eax
+    185e:	74 0a                	je     186a <bflushtty+0x5d>
+    bflush(fd);
+    1860:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1863:	89 c7                	mov    %eax,%edi
+    1865:	e8 6f fd ff ff       	call   15d9 <bflush>
+}
+    186a:	90                   	nop
+    186b:	c9                   	leave
+    186c:	c3                   	ret
+
+000000000000186d <fork>:
+
+int fork(void) {
+    186d:	55                   	push   %rbp
+    186e:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1871:	e8 ec fd ff ff       	call   1662 <bflushall>
+  return _fork();
+    1876:	e8 7b 0a 00 00       	call   22f6 <_fork>
+}
+    187b:	5d                   	pop    %rbp
+    187c:	c3                   	ret
+
+000000000000187d <exit>:
+
+noreturn void exit(void) {
+    187d:	55                   	push   %rbp
+    187e:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1881:	e8 dc fd ff ff       	call   1662 <bflushall>
+  _exit();
+    1886:	e8 76 0a 00 00       	call   2301 <_exit>
+
+000000000000188b <exec>:
+}
+
+int exec(char *path, char **argv) {
+    188b:	55                   	push   %rbp
+    188c:	48 89 e5             	mov    %rsp,%rbp
+    188f:	48 83 ec 10          	sub    $0x10,%rsp
+    1893:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1897:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    189b:	e8 c2 fd ff ff       	call   1662 <bflushall>
+  return _exec(path, argv);
+    18a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    18a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18a8:	48 89 d6             	mov    %rdx,%rsi
+    18ab:	48 89 c7             	mov    %rax,%rdi
+    18ae:	e8 9b 0a 00 00       	call   234e <_exec>
+}
+    18b3:	c9                   	leave
+    18b4:	c3                   	ret
+
+00000000000018b5 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    18b5:	55                   	push   %rbp
+    18b6:	48 89 e5             	mov    %rsp,%rbp
+    18b9:	48 83 ec 20          	sub    $0x20,%rsp
+    18bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    18c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    18c9:	e8 94 fd ff ff       	call   1662 <bflushall>
+  return _spawn(path, argv, fds);
+    18ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    18d2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    18d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18da:	48 89 ce             	mov    %rcx,%rsi
+    18dd:	48 89 c7             	mov    %rax,%rdi
+    18e0:	e8 2f 0b 00 00       	call   2414 <_spawn>
+}
+    18e5:	c9                   	leave
+    18e6:	c3                   	ret
+
+00000000000018e7 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    18e7:	55                   	push   %rbp
+    18e8:	48 89 e5             	mov    %rsp,%rbp
+    18eb:	48 83 ec 10          	sub    $0x10,%rsp
+    18ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    18f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    18f6:	78 69                	js     1961 <close+0x7a>
+    18f8:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    18fc:	7f 63                	jg     1961 <close+0x7a>
+    18fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1901:	48 98                	cltq
+    1903:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    190a:	00 
+    190b:	48 8d 05 ee 27 00 00 	lea    0x27ee(%rip),%rax        # 4100 <obufs>
+    1912:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1916:	48 85 c0             	test   %rax,%rax
+    1919:	74 46                	je     1961 <close+0x7a>
+    bflush(fd);
+    191b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    191e:	89 c7                	mov    %eax,%edi
+    1920:	e8 b4 fc ff ff       	call   15d9 <bflush>
+    free(obufs[fd]);
+    1925:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1928:	48 98                	cltq
+    192a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1931:	00 
+    1932:	48 8d 05 c7 27 00 00 	lea    0x27c7(%rip),%rax        # 4100 <obufs>
+    1939:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    193d:	48 89 c7             	mov    %rax,%rdi
+    1940:	e8 90 11 00 00       	call   2ad5 <free>
+    obufs[fd] = 0;
+    1945:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1948:	48 98                	cltq
+    194a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1951:	00 
+    1952:	48 8d 05 a7 27 00 00 	lea    0x27a7(%rip),%rax        # 4100 <obufs>
+    1959:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    1960:	00 
+  }
+  return _close(fd);
+    1961:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1964:	89 c7                	mov    %eax,%edi
+    1966:	e8 cd 09 00 00       	call   2338 <_close>
+}
+    196b:	c9                   	leave
+    196c:	c3                   	ret
+
+000000000000196d <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    196d:	55                   	push   %rbp
+    196e:	48 89 e5             	mov    %rsp,%rbp
+    1971:	53                   	push   %rbx
+    1972:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1976:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    197a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    197e:	48 8b 36             	mov    (%rsi),%rsi
+    1981:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    1985:	48 29 f7             	sub    %rsi,%rdi
+    1988:	48 89 f9             	mov    %rdi,%rcx
+    198b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1990:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1994:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    1998:	48 89 f0             	mov    %rsi,%rax
+    199b:	ba 00 00 00 00       	mov    $0x0,%edx
+    19a0:	48 89 df             	mov    %rbx,%rdi
+    19a3:	48 0f af f8          	imul   %rax,%rdi
+    19a7:	48 89 d6             	mov    %rdx,%rsi
+    19aa:	48 0f af f1          	imul   %rcx,%rsi
+    19ae:	48 01 fe             	add    %rdi,%rsi
+    19b1:	48 f7 e1             	mul    %rcx
+    19b4:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    19b8:	48 89 ca             	mov    %rcx,%rdx
+    19bb:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    19c0:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    19c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    19c8:	c9                   	leave
+    19c9:	c3                   	ret
+
+00000000000019ca <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    19ca:	55                   	push   %rbp
+    19cb:	48 89 e5             	mov    %rsp,%rbp
+    19ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    19d5:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    19d8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    19dc:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    19df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    19e2:	48 89 ce             	mov    %rcx,%rsi
+    19e5:	48 89 f7             	mov    %rsi,%rdi
+    19e8:	89 d1                	mov    %edx,%ecx
+    19ea:	fc                   	cld
+    19eb:	f3 aa                	rep stos %al,%es:(%rdi)
+    19ed:	89 ca                	mov    %ecx,%edx
+    19ef:	48 89 fe             	mov    %rdi,%rsi
+    19f2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    19f6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    19f9:	90                   	nop
+    19fa:	5d                   	pop    %rbp
+    19fb:	c3                   	ret
+
+00000000000019fc <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    19fc:	55                   	push   %rbp
+    19fd:	48 89 e5             	mov    %rsp,%rbp
+    1a00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a04:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a08:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    1a0c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a10:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a18:	48 89 ce             	mov    %rcx,%rsi
+    1a1b:	48 89 f7             	mov    %rsi,%rdi
+    1a1e:	48 89 d1             	mov    %rdx,%rcx
+    1a21:	fc                   	cld
+    1a22:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    1a25:	48 89 ca             	mov    %rcx,%rdx
+    1a28:	48 89 fe             	mov    %rdi,%rsi
+    1a2b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1a2f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    1a33:	90                   	nop
+    1a34:	5d                   	pop    %rbp
+    1a35:	c3                   	ret
+
+0000000000001a36 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    1a36:	55                   	push   %rbp
+    1a37:	48 89 e5             	mov    %rsp,%rbp
+    1a3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a3e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a42:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    1a46:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a4a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a52:	48 89 cf             	mov    %rcx,%rdi
+    1a55:	48 89 d6             	mov    %rdx,%rsi
+    1a58:	48 89 c1             	mov    %rax,%rcx
+    1a5b:	fc                   	cld
+    1a5c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1a5e:	48 89 c8             	mov    %rcx,%rax
+    1a61:	48 89 f2             	mov    %rsi,%rdx
+    1a64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a68:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1a6c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1a70:	90                   	nop
+    1a71:	5d                   	pop    %rbp
+    1a72:	c3                   	ret
+
+0000000000001a73 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    1a73:	55                   	push   %rbp
+    1a74:	48 89 e5             	mov    %rsp,%rbp
+    1a77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a7b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1a7f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    1a83:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a87:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a8f:	48 89 cf             	mov    %rcx,%rdi
+    1a92:	48 89 d6             	mov    %rdx,%rsi
+    1a95:	48 89 c1             	mov    %rax,%rcx
+    1a98:	fc                   	cld
+    1a99:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    1a9c:	48 89 c8             	mov    %rcx,%rax
+    1a9f:	48 89 f2             	mov    %rsi,%rdx
+    1aa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1aa6:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1aaa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1aae:	90                   	nop
+    1aaf:	5d                   	pop    %rbp
+    1ab0:	c3                   	ret
+
+0000000000001ab1 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    1ab1:	55                   	push   %rbp
+    1ab2:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    1ab5:	0f 31                	rdtsc
+    1ab7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1aba:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    1abd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ac0:	48 c1 e0 20          	shl    $0x20,%rax
+    1ac4:	48 89 c2             	mov    %rax,%rdx
+    1ac7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aca:	48 09 d0             	or     %rdx,%rax
+}
+    1acd:	5d                   	pop    %rbp
+    1ace:	c3                   	ret
+
+0000000000001acf <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    1acf:	55                   	push   %rbp
+    1ad0:	48 89 e5             	mov    %rsp,%rbp
+    1ad3:	53                   	push   %rbx
+    1ad4:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    1ad7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    1adb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    1adf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    1ae3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    1ae7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1aea:	0f a2                	cpuid
+    1aec:	89 de                	mov    %ebx,%esi
+    1aee:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1af1:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    1af4:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    1af7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    1afa:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    1aff:	74 09                	je     1b0a <cpuid+0x3b>
+    *eaxp = eax;
+    1b01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b05:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    1b08:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    1b0a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1b0f:	74 09                	je     1b1a <cpuid+0x4b>
+    *ebxp = ebx;
+    1b11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b15:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1b18:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    1b1a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1b1f:	74 09                	je     1b2a <cpuid+0x5b>
+    *ecxp = ecx;
+    1b21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1b25:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b28:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    1b2a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    1b2f:	74 09                	je     1b3a <cpuid+0x6b>
+    *edxp = edx;
+    1b31:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    1b35:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    1b38:	89 10                	mov    %edx,(%rax)
+}
+    1b3a:	90                   	nop
+    1b3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1b3f:	c9                   	leave
+    1b40:	c3                   	ret
+
+0000000000001b41 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1b41:	55                   	push   %rbp
+    1b42:	48 89 e5             	mov    %rsp,%rbp
+    1b45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b49:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1b4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    1b55:	90                   	nop
+    1b56:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1b5a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1b5e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1b62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b66:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1b6a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1b6e:	0f b6 12             	movzbl (%rdx),%edx
+    1b71:	88 10                	mov    %dl,(%rax)
+    1b73:	0f b6 00             	movzbl (%rax),%eax
+    1b76:	84 c0                	test   %al,%al
+    1b78:	75 dc                	jne    1b56 <strcpy+0x15>
+  return os;
+    1b7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1b7e:	5d                   	pop    %rbp
+    1b7f:	c3                   	ret
+
+0000000000001b80 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1b80:	55                   	push   %rbp
+    1b81:	48 89 e5             	mov    %rsp,%rbp
+    1b84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b88:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1b8c:	eb 0a                	jmp    1b98 <strcmp+0x18>
+    p++, q++;
+    1b8e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1b93:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b9c:	0f b6 00             	movzbl (%rax),%eax
+    1b9f:	84 c0                	test   %al,%al
+    1ba1:	74 12                	je     1bb5 <strcmp+0x35>
+    1ba3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba7:	0f b6 10             	movzbl (%rax),%edx
+    1baa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bae:	0f b6 00             	movzbl (%rax),%eax
+    1bb1:	38 c2                	cmp    %al,%dl
+    1bb3:	74 d9                	je     1b8e <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1bb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bb9:	0f b6 00             	movzbl (%rax),%eax
+    1bbc:	0f b6 d0             	movzbl %al,%edx
+    1bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc3:	0f b6 00             	movzbl (%rax),%eax
+    1bc6:	0f b6 c0             	movzbl %al,%eax
+    1bc9:	29 c2                	sub    %eax,%edx
+    1bcb:	89 d0                	mov    %edx,%eax
+}
+    1bcd:	5d                   	pop    %rbp
+    1bce:	c3                   	ret
+
+0000000000001bcf <strlen>:
+uint strlen(char *s) {
+    1bcf:	55                   	push   %rbp
+    1bd0:	48 89 e5             	mov    %rsp,%rbp
+    1bd3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    1bd7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1bde:	eb 04                	jmp    1be4 <strlen+0x15>
+    1be0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1be4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1be7:	48 63 d0             	movslq %eax,%rdx
+    1bea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bee:	48 01 d0             	add    %rdx,%rax
+    1bf1:	0f b6 00             	movzbl (%rax),%eax
+    1bf4:	84 c0                	test   %al,%al
+    1bf6:	75 e8                	jne    1be0 <strlen+0x11>
+    ;
+  return n;
+    1bf8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1bfb:	5d                   	pop    %rbp
+    1bfc:	c3                   	ret
+
+0000000000001bfd <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    1bfd:	55                   	push   %rbp
+    1bfe:	48 89 e5             	mov    %rsp,%rbp
+    1c01:	53                   	push   %rbx
+    1c02:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    1c06:	8b 05 48 24 00 00    	mov    0x2448(%rip),%eax        # 4054 <erms>
+    1c0c:	85 c0                	test   %eax,%eax
+    1c0e:	79 53                	jns    1c63 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    1c10:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1c14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    1c1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1c24:	48 89 c6             	mov    %rax,%rsi
+    1c27:	bf 00 00 00 00       	mov    $0x0,%edi
+    1c2c:	e8 9e fe ff ff       	call   1acf <cpuid>
+    ebx = 0;
+    1c31:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    1c38:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1c3b:	83 f8 06             	cmp    $0x6,%eax
+    1c3e:	76 14                	jbe    1c54 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    1c40:	b8 07 00 00 00       	mov    $0x7,%eax
+    1c45:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1c4a:	0f a2                	cpuid
+    1c4c:	89 d9                	mov    %ebx,%ecx
+    1c4e:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    1c51:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    1c54:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1c57:	c1 e8 09             	shr    $0x9,%eax
+    1c5a:	83 e0 01             	and    $0x1,%eax
+    1c5d:	89 05 f1 23 00 00    	mov    %eax,0x23f1(%rip)        # 4054 <erms>
+  }
+  return erms;
+    1c63:	8b 05 eb 23 00 00    	mov    0x23eb(%rip),%eax        # 4054 <erms>
+}
+    1c69:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1c6d:	c9                   	leave
+    1c6e:	c3                   	ret
+
+0000000000001c6f <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    1c6f:	55                   	push   %rbp
+    1c70:	48 89 e5             	mov    %rsp,%rbp
+    1c73:	48 83 ec 10          	sub    $0x10,%rsp
+    1c77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c7b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1c7e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    1c81:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    1c85:	76 09                	jbe    1c90 <memset+0x21>
+    1c87:	e8 71 ff ff ff       	call   1bfd <haserms>
+    1c8c:	85 c0                	test   %eax,%eax
+    1c8e:	74 16                	je     1ca6 <memset+0x37>
+    stosb(dst, c, n);
+    1c90:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1c93:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1c96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c9a:	89 ce                	mov    %ecx,%esi
+    1c9c:	48 89 c7             	mov    %rax,%rdi
+    1c9f:	e8 26 fd ff ff       	call   19ca <stosb>
+    1ca4:	eb 58                	jmp    1cfe <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    1ca6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1ca9:	c1 e8 03             	shr    $0x3,%eax
+    1cac:	89 c6                	mov    %eax,%esi
+    1cae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1cb1:	48 98                	cltq
+    1cb3:	0f b6 c0             	movzbl %al,%eax
+    1cb6:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    1cbd:	01 01 01 
+    1cc0:	48 0f af c2          	imul   %rdx,%rax
+    1cc4:	48 89 c1             	mov    %rax,%rcx
+    1cc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ccb:	48 89 f2             	mov    %rsi,%rdx
+    1cce:	48 89 ce             	mov    %rcx,%rsi
+    1cd1:	48 89 c7             	mov    %rax,%rdi
+    1cd4:	e8 23 fd ff ff       	call   19fc <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    1cd9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1cdc:	83 e0 07             	and    $0x7,%eax
+    1cdf:	89 c2                	mov    %eax,%edx
+    1ce1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1ce4:	83 e0 f8             	and    $0xfffffff8,%eax
+    1ce7:	48 89 c1             	mov    %rax,%rcx
+    1cea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cee:	48 01 c1             	add    %rax,%rcx
+    1cf1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1cf4:	89 c6                	mov    %eax,%esi
+    1cf6:	48 89 cf             	mov    %rcx,%rdi
+    1cf9:	e8 cc fc ff ff       	call   19ca <stosb>
+  }
+  return dst;
+    1cfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1d02:	c9                   	leave
+    1d03:	c3                   	ret
+
+0000000000001d04 <strchr>:
+
+char *strchr(const char *s, char c) {
+    1d04:	55                   	push   %rbp
+    1d05:	48 89 e5             	mov    %rsp,%rbp
+    1d08:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1d0c:	89 f0                	mov    %esi,%eax
+    1d0e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1d11:	eb 17                	jmp    1d2a <strchr+0x26>
+    if (*s == c)
+    1d13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d17:	0f b6 00             	movzbl (%rax),%eax
+    1d1a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1d1d:	75 06                	jne    1d25 <strchr+0x21>
+      return (char *)s;
+    1d1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d23:	eb 15                	jmp    1d3a <strchr+0x36>
+  for (; *s; s++)
+    1d25:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1d2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d2e:	0f b6 00             	movzbl (%rax),%eax
+    1d31:	84 c0                	test   %al,%al
+    1d33:	75 de                	jne    1d13 <strchr+0xf>
+  return 0;
+    1d35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1d3a:	5d                   	pop    %rbp
+    1d3b:	c3                   	ret
+
+0000000000001d3c <gets>:
+
+char *gets(char *buf, int max) {
+    1d3c:	55                   	push   %rbp
+    1d3d:	48 89 e5             	mov    %rsp,%rbp
+    1d40:	48 83 ec 20          	sub    $0x20,%rsp
+    1d44:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d48:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    1d4b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1d52:	eb 48                	jmp    1d9c <gets+0x60>
+    cc = read(0, &c, 1);
+    1d54:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1d58:	ba 01 00 00 00       	mov    $0x1,%edx
+    1d5d:	48 89 c6             	mov    %rax,%rsi
+    1d60:	bf 00 00 00 00       	mov    $0x0,%edi
+    1d65:	e8 b8 05 00 00       	call   2322 <read>
+    1d6a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1d6d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1d71:	7e 36                	jle    1da9 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1d73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d76:	8d 50 01             	lea    0x1(%rax),%edx
+    1d79:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1d7c:	48 63 d0             	movslq %eax,%rdx
+    1d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d83:	48 01 c2             	add    %rax,%rdx
+    1d86:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d8a:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1d8c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d90:	3c 0a                	cmp    $0xa,%al
+    1d92:	74 16                	je     1daa <gets+0x6e>
+    1d94:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1d98:	3c 0d                	cmp    $0xd,%al
+    1d9a:	74 0e                	je     1daa <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1d9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d9f:	83 c0 01             	add    $0x1,%eax
+    1da2:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1da5:	7f ad                	jg     1d54 <gets+0x18>
+    1da7:	eb 01                	jmp    1daa <gets+0x6e>
+      break;
+    1da9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1daa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dad:	48 63 d0             	movslq %eax,%rdx
+    1db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1db4:	48 01 d0             	add    %rdx,%rax
+    1db7:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1dba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1dbe:	c9                   	leave
+    1dbf:	c3                   	ret
+
+0000000000001dc0 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1dc0:	55                   	push   %rbp
+    1dc1:	48 89 e5             	mov    %rsp,%rbp
+    1dc4:	48 83 ec 10          	sub    $0x10,%rsp
+    1dc8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1dcc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    1dd0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1dd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd8:	48 89 c6             	mov    %rax,%rsi
+    1ddb:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1de0:	e8 58 07 00 00       	call   253d <fstatat>
+}
+    1de5:	c9                   	leave
+    1de6:	c3                   	ret
+
+0000000000001de7 <atoi>:
+
+int atoi(const char *s) {
+    1de7:	55                   	push   %rbp
+    1de8:	48 89 e5             	mov    %rsp,%rbp
+    1deb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1def:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1df6:	eb 28                	jmp    1e20 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    1df8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1dfb:	89 d0                	mov    %edx,%eax
+    1dfd:	c1 e0 02             	shl    $0x2,%eax
+    1e00:	01 d0                	add    %edx,%eax
+    1e02:	01 c0                	add    %eax,%eax
+    1e04:	89 c1                	mov    %eax,%ecx
+    1e06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e0a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1e0e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1e12:	0f b6 00             	movzbl (%rax),%eax
+    1e15:	0f be c0             	movsbl %al,%eax
+    1e18:	01 c8                	add    %ecx,%eax
+    1e1a:	83 e8 30             	sub    $0x30,%eax
+    1e1d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1e20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e24:	0f b6 00             	movzbl (%rax),%eax
+    1e27:	3c 2f                	cmp    $0x2f,%al
+    1e29:	7e 0b                	jle    1e36 <atoi+0x4f>
+    1e2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e2f:	0f b6 00             	movzbl (%rax),%eax
+    1e32:	3c 39                	cmp    $0x39,%al
+    1e34:	7e c2                	jle    1df8 <atoi+0x11>
+  return n;
+    1e36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1e39:	5d                   	pop    %rbp
+    1e3a:	c3                   	ret
+
+0000000000001e3b <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1e3b:	55                   	push   %rbp
+    1e3c:	48 89 e5             	mov    %rsp,%rbp
+    1e3f:	48 83 ec 28          	sub    $0x28,%rsp
+    1e43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e47:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e4b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1e4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e52:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1e56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e5a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1e5e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1e62:	7f 09                	jg     1e6d <memmove+0x32>
+    return vdst;
+    1e64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e68:	e9 29 01 00 00       	jmp    1f96 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1e6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e71:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    1e75:	0f 83 87 00 00 00    	jae    1f02 <memmove+0xc7>
+    1e7b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e7e:	48 63 d0             	movslq %eax,%rdx
+    1e81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e85:	48 01 d0             	add    %rdx,%rax
+    1e88:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1e8c:	73 74                	jae    1f02 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1e8e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e91:	48 98                	cltq
+    1e93:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1e97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e9a:	48 98                	cltq
+    1e9c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1ea0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ea4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ea8:	48 09 d0             	or     %rdx,%rax
+    1eab:	83 e0 07             	and    $0x7,%eax
+    1eae:	48 85 c0             	test   %rax,%rax
+    1eb1:	75 3d                	jne    1ef0 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1eb3:	eb 1c                	jmp    1ed1 <memmove+0x96>
+        src -= 8;
+    1eb5:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1eba:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1ebf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ec3:	48 8b 10             	mov    (%rax),%rdx
+    1ec6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eca:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1ecd:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1ed1:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1ed5:	7f de                	jg     1eb5 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1ed7:	eb 17                	jmp    1ef0 <memmove+0xb5>
+      *--dst = *--src;
+    1ed9:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1ede:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1ee3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ee7:	0f b6 10             	movzbl (%rax),%edx
+    1eea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eee:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1ef0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ef3:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1ef6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1ef9:	85 c0                	test   %eax,%eax
+    1efb:	7f dc                	jg     1ed9 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1efd:	e9 90 00 00 00       	jmp    1f92 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1f02:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1f06:	7e 09                	jle    1f11 <memmove+0xd6>
+    1f08:	e8 f0 fc ff ff       	call   1bfd <haserms>
+    1f0d:	85 c0                	test   %eax,%eax
+    1f0f:	74 1b                	je     1f2c <memmove+0xf1>
+    movsb(dst, src, n);
+    1f11:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f14:	48 63 d0             	movslq %eax,%rdx
+    1f17:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1f1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f1f:	48 89 ce             	mov    %rcx,%rsi
+    1f22:	48 89 c7             	mov    %rax,%rdi
+    1f25:	e8 0c fb ff ff       	call   1a36 <movsb>
+    1f2a:	eb 66                	jmp    1f92 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1f2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f2f:	8d 50 07             	lea    0x7(%rax),%edx
+    1f32:	85 c0                	test   %eax,%eax
+    1f34:	0f 48 c2             	cmovs  %edx,%eax
+    1f37:	c1 f8 03             	sar    $0x3,%eax
+    1f3a:	48 63 d0             	movslq %eax,%rdx
+    1f3d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1f41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f45:	48 89 ce             	mov    %rcx,%rsi
+    1f48:	48 89 c7             	mov    %rax,%rdi
+    1f4b:	e8 23 fb ff ff       	call   1a73 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1f50:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f53:	89 d0                	mov    %edx,%eax
+    1f55:	c1 f8 1f             	sar    $0x1f,%eax
+    1f58:	c1 e8 1d             	shr    $0x1d,%eax
+    1f5b:	01 c2                	add    %eax,%edx
+    1f5d:	83 e2 07             	and    $0x7,%edx
+    1f60:	29 c2                	sub    %eax,%edx
+    1f62:	89 d0                	mov    %edx,%eax
+    1f64:	48 98                	cltq
+    1f66:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f69:	83 e2 f8             	and    $0xfffffff8,%edx
+    1f6c:	48 63 ca             	movslq %edx,%rcx
+    1f6f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1f73:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1f77:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f7a:	83 e2 f8             	and    $0xfffffff8,%edx
+    1f7d:	48 63 ca             	movslq %edx,%rcx
+    1f80:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1f84:	48 01 d1             	add    %rdx,%rcx
+    1f87:	48 89 c2             	mov    %rax,%rdx
+    1f8a:	48 89 cf             	mov    %rcx,%rdi
+    1f8d:	e8 a4 fa ff ff       	call   1a36 <movsb>
+  }
+  return vdst;
+    1f92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1f96:	c9                   	leave
+    1f97:	c3                   	ret
+
+0000000000001f98 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1f98:	55                   	push   %rbp
+    1f99:	48 89 e5             	mov    %rsp,%rbp
+    1f9c:	48 83 ec 20          	sub    $0x20,%rsp
+    1fa0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1fa3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1fa7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1fae:	00 00 00 
+    1fb1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1fb5:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1fb9:	75 0d                	jne    1fc8 <clock_gettime+0x30>
+    1fbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fbf:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1fc3:	48 85 c0             	test   %rax,%rax
+    1fc6:	75 13                	jne    1fdb <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1fc8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1fcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1fcf:	48 89 d6             	mov    %rdx,%rsi
+    1fd2:	89 c7                	mov    %eax,%edi
+    1fd4:	e8 e0 04 00 00       	call   24b9 <_clock_gettime>
+    1fd9:	eb 7d                	jmp    2058 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1fdb:	e8 d1 fa ff ff       	call   1ab1 <rdtsc>
+    1fe0:	48 89 c2             	mov    %rax,%rdx
+    1fe3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fe7:	48 89 d6             	mov    %rdx,%rsi
+    1fea:	48 89 c7             	mov    %rax,%rdi
+    1fed:	e8 7b f9 ff ff       	call   196d <clockns>
+    1ff2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1ff6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ffa:	48 c1 e8 09          	shr    $0x9,%rax
+    1ffe:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    2005:	b8 44 00 
+    2008:	48 f7 e2             	mul    %rdx
+    200b:	48 89 d0             	mov    %rdx,%rax
+    200e:	48 c1 e8 0b          	shr    $0xb,%rax
+    2012:	48 89 c2             	mov    %rax,%rdx
+    2015:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2019:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    201c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    2020:	48 89 c8             	mov    %rcx,%rax
+    2023:	48 c1 e8 09          	shr    $0x9,%rax
+    2027:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    202e:	b8 44 00 
+    2031:	48 f7 e2             	mul    %rdx
+    2034:	48 89 d0             	mov    %rdx,%rax
+    2037:	48 c1 e8 0b          	shr    $0xb,%rax
+    203b:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    2042:	48 89 c8             	mov    %rcx,%rax
+    2045:	48 29 d0             	sub    %rdx,%rax
+    2048:	48 89 c2             	mov    %rax,%rdx
+    204b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    204f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    2053:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2058:	c9                   	leave
+    2059:	c3                   	ret
+
+000000000000205a <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    205a:	55                   	push   %rbp
+    205b:	48 89 e5             	mov    %rsp,%rbp
+    205e:	48 83 ec 10          	sub    $0x10,%rsp
+    2062:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    2066:	eb 11                	jmp    2079 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    2068:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    206c:	be 02 00 00 00       	mov    $0x2,%esi
+    2071:	48 89 c7             	mov    %rax,%rdi
+    2074:	e8 6c 04 00 00       	call   24e5 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    2079:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    207d:	b8 02 00 00 00       	mov    $0x2,%eax
+    2082:	87 02                	xchg   %eax,(%rdx)
+    2084:	85 c0                	test   %eax,%eax
+    2086:	75 e0                	jne    2068 <mutex_wait+0xe>
+}
+    2088:	90                   	nop
+    2089:	90                   	nop
+    208a:	c9                   	leave
+    208b:	c3                   	ret
+
+000000000000208c <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    208c:	55                   	push   %rbp
+    208d:	48 89 e5             	mov    %rsp,%rbp
+    2090:	48 83 ec 20          	sub    $0x20,%rsp
+    2094:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    2098:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    209f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    20a3:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    20a7:	8b 02                	mov    (%rdx),%eax
+    20a9:	b9 01 00 00 00       	mov    $0x1,%ecx
+    20ae:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    20b2:	89 c1                	mov    %eax,%ecx
+    20b4:	0f 94 c0             	sete   %al
+    20b7:	84 c0                	test   %al,%al
+    20b9:	75 02                	jne    20bd <mutex_lock+0x31>
+    20bb:	89 0a                	mov    %ecx,(%rdx)
+    20bd:	83 f0 01             	xor    $0x1,%eax
+    20c0:	84 c0                	test   %al,%al
+    20c2:	74 0c                	je     20d0 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    20c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    20c8:	48 89 c7             	mov    %rax,%rdi
+    20cb:	e8 8a ff ff ff       	call   205a <mutex_wait>
+}
+    20d0:	90                   	nop
+    20d1:	c9                   	leave
+    20d2:	c3                   	ret
+
+00000000000020d3 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    20d3:	55                   	push   %rbp
+    20d4:	48 89 e5             	mov    %rsp,%rbp
+    20d7:	48 83 ec 10          	sub    $0x10,%rsp
+    20db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    20df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20e3:	ba 00 00 00 00       	mov    $0x0,%edx
+    20e8:	87 10                	xchg   %edx,(%rax)
+    20ea:	83 fa 02             	cmp    $0x2,%edx
+    20ed:	75 11                	jne    2100 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    20ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20f3:	be 01 00 00 00       	mov    $0x1,%esi
+    20f8:	48 89 c7             	mov    %rax,%rdi
+    20fb:	e8 f0 03 00 00       	call   24f0 <futex_wake>
+}
+    2100:	90                   	nop
+    2101:	c9                   	leave
+    2102:	c3                   	ret
+
+0000000000002103 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    2103:	55                   	push   %rbp
+    2104:	48 89 e5             	mov    %rsp,%rbp
+    2107:	48 83 ec 20          	sub    $0x20,%rsp
+    210b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    210f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    2113:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2117:	48 83 c0 04          	add    $0x4,%rax
+    211b:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    211f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2123:	8b 00                	mov    (%rax),%eax
+    2125:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    2128:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    212c:	48 89 c7             	mov    %rax,%rdi
+    212f:	e8 9f ff ff ff       	call   20d3 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    2134:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2138:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    213b:	89 d6                	mov    %edx,%esi
+    213d:	48 89 c7             	mov    %rax,%rdi
+    2140:	e8 a0 03 00 00       	call   24e5 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    2145:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2149:	48 83 c0 04          	add    $0x4,%rax
+    214d:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    2151:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2155:	48 89 c7             	mov    %rax,%rdi
+    2158:	e8 fd fe ff ff       	call   205a <mutex_wait>
+}
+    215d:	90                   	nop
+    215e:	c9                   	leave
+    215f:	c3                   	ret
+
+0000000000002160 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    2160:	55                   	push   %rbp
+    2161:	48 89 e5             	mov    %rsp,%rbp
+    2164:	48 83 ec 10          	sub    $0x10,%rsp
+    2168:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    216c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2170:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    2174:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2178:	48 83 c0 04          	add    $0x4,%rax
+    217c:	8b 00                	mov    (%rax),%eax
+    217e:	85 c0                	test   %eax,%eax
+    2180:	7e 11                	jle    2193 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    2182:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2186:	be 01 00 00 00       	mov    $0x1,%esi
+    218b:	48 89 c7             	mov    %rax,%rdi
+    218e:	e8 5d 03 00 00       	call   24f0 <futex_wake>
+}
+    2193:	90                   	nop
+    2194:	c9                   	leave
+    2195:	c3                   	ret
+
+0000000000002196 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    2196:	55                   	push   %rbp
+    2197:	48 89 e5             	mov    %rsp,%rbp
+    219a:	48 83 ec 10          	sub    $0x10,%rsp
+    219e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    21a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21a6:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    21aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21ae:	48 83 c0 04          	add    $0x4,%rax
+    21b2:	8b 00                	mov    (%rax),%eax
+    21b4:	85 c0                	test   %eax,%eax
+    21b6:	7e 11                	jle    21c9 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    21b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21bc:	be 00 00 00 40       	mov    $0x40000000,%esi
+    21c1:	48 89 c7             	mov    %rax,%rdi
+    21c4:	e8 27 03 00 00       	call   24f0 <futex_wake>
+}
+    21c9:	90                   	nop
+    21ca:	c9                   	leave
+    21cb:	c3                   	ret
+
+00000000000021cc <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    21cc:	55                   	push   %rbp
+    21cd:	48 89 e5             	mov    %rsp,%rbp
+    21d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    21d4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    21d7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    21db:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    21df:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    21e3:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    21e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21eb:	8b 40 04             	mov    0x4(%rax),%eax
+    21ee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    21f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    21f5:	8b 00                	mov    (%rax),%eax
+    21f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    21fa:	29 c2                	sub    %eax,%edx
+    21fc:	83 fa 1f             	cmp    $0x1f,%edx
+    21ff:	76 07                	jbe    2208 <ring_push+0x3c>
+    return -1;
+    2201:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2206:	eb 7e                	jmp    2286 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    2208:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    220b:	83 e0 1f             	and    $0x1f,%eax
+    220e:	89 c2                	mov    %eax,%edx
+    2210:	48 89 d0             	mov    %rdx,%rax
+    2213:	48 01 c0             	add    %rax,%rax
+    2216:	48 01 d0             	add    %rdx,%rax
+    2219:	48 c1 e0 04          	shl    $0x4,%rax
+    221d:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    2221:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2225:	48 01 d0             	add    %rdx,%rax
+    2228:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    222c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2230:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    2233:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    2235:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2239:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    223d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    2241:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2245:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    2249:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    224d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2251:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    2255:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    2259:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    225d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    2261:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    2265:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2269:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    226d:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    2271:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2274:	8d 50 01             	lea    0x1(%rax),%edx
+    2277:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    227b:	48 83 c0 04          	add    $0x4,%rax
+    227f:	89 10                	mov    %edx,(%rax)
+  return 0;
+    2281:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2286:	5d                   	pop    %rbp
+    2287:	c3                   	ret
+
+0000000000002288 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    2288:	55                   	push   %rbp
+    2289:	48 89 e5             	mov    %rsp,%rbp
+    228c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2290:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    2294:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2298:	8b 40 08             	mov    0x8(%rax),%eax
+    229b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    229e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22a2:	48 83 c0 0c          	add    $0xc,%rax
+    22a6:	8b 00                	mov    (%rax),%eax
+    22a8:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    22ab:	75 07                	jne    22b4 <ring_pop+0x2c>
+    return -1;
+    22ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    22b2:	eb 40                	jmp    22f4 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    22b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22b7:	83 e0 1f             	and    $0x1f,%eax
+    22ba:	89 c2                	mov    %eax,%edx
+    22bc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    22c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22c4:	89 d2                	mov    %edx,%edx
+    22c6:	48 83 c2 61          	add    $0x61,%rdx
+    22ca:	48 c1 e2 04          	shl    $0x4,%rdx
+    22ce:	48 01 d0             	add    %rdx,%rax
+    22d1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    22d5:	48 8b 00             	mov    (%rax),%rax
+    22d8:	48 89 01             	mov    %rax,(%rcx)
+    22db:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    22df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22e2:	8d 50 01             	lea    0x1(%rax),%edx
+    22e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22e9:	48 83 c0 08          	add    $0x8,%rax
+    22ed:	89 10                	mov    %edx,(%rax)
+  return 0;
+    22ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    22f4:	5d                   	pop    %rbp
+    22f5:	c3                   	ret
+
+00000000000022f6 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    22f6:	b8 01 00 00 00       	mov    $0x1,%eax
+    22fb:	49 89 ca             	mov    %rcx,%r10
+    22fe:	0f 05                	syscall
+    2300:	c3                   	ret
+
+0000000000002301 <_exit>:
+SYSCALL_(exit)
+    2301:	b8 02 00 00 00       	mov    $0x2,%eax
+    2306:	49 89 ca             	mov    %rcx,%r10
+    2309:	0f 05                	syscall
+    230b:	c3                   	ret
+
+000000000000230c <wait>:
+SYSCALL(wait)
+    230c:	b8 03 00 00 00       	mov    $0x3,%eax
+    2311:	49 89 ca             	mov    %rcx,%r10
+    2314:	0f 05                	syscall
+    2316:	c3                   	ret
+
+0000000000002317 <pipe>:
+SYSCALL(pipe)
+    2317:	b8 04 00 00 00       	mov    $0x4,%eax
+    231c:	49 89 ca             	mov    %rcx,%r10
+    231f:	0f 05                	syscall
+    2321:	c3                   	ret
+
+0000000000002322 <read>:
+SYSCALL(read)
+    2322:	b8 05 00 00 00       	mov    $0x5,%eax
+    2327:	49 89 ca             	mov    %rcx,%r10
+    232a:	0f 05                	syscall
+    232c:	c3                   	ret
+
+000000000000232d <write>:
+SYSCALL(write)
+    232d:	b8 10 00 00 00       	mov    $0x10,%eax
+    2332:	49 89 ca             	mov    %rcx,%r10
+    2335:	0f 05                	syscall
+    2337:	c3                   	ret
+
+0000000000002338 <_close>:
+SYSCALL_(close)
+    2338:	b8 15 00 00 00       	mov    $0x15,%eax
+    233d:	49 89 ca             	mov    %rcx,%r10
+    2340:	0f 05                	syscall
+    2342:	c3                   	ret
+
+0000000000002343 <kill>:
+SYSCALL(kill)
+    2343:	b8 06 00 00 00       	mov    $0x6,%eax
+    2348:	49 89 ca             	mov    %rcx,%r10
+    234b:	0f 05                	syscall
+    234d:	c3                   	ret
+
+000000000000234e <_exec>:
+SYSCALL_(exec)
+    234e:	b8 07 00 00 00       	mov    $0x7,%eax
+    2353:	49 89 ca             	mov    %rcx,%r10
+    2356:	0f 05                	syscall
+    2358:	c3                   	ret
+
+0000000000002359 <open>:
+SYSCALL(open)
+    2359:	b8 0f 00 00 00       	mov    $0xf,%eax
+    235e:	49 89 ca             	mov    %rcx,%r10
+    2361:	0f 05                	syscall
+    2363:	c3                   	ret
+
+0000000000002364 <mknod>:
+SYSCALL(mknod)
+    2364:	b8 11 00 00 00       	mov    $0x11,%eax
+    2369:	49 89 ca             	mov    %rcx,%r10
+    236c:	0f 05                	syscall
+    236e:	c3                   	ret
+
+000000000000236f <unlink>:
+SYSCALL(unlink)
+    236f:	b8 12 00 00 00       	mov    $0x12,%eax
+    2374:	49 89 ca             	mov    %rcx,%r10
+    2377:	0f 05                	syscall
+    2379:	c3                   	ret
+
+000000000000237a <fstat>:
+SYSCALL(fstat)
+    237a:	b8 08 00 00 00       	mov    $0x8,%eax
+    237f:	49 89 ca             	mov    %rcx,%r10
+    2382:	0f 05                	syscall
+    2384:	c3                   	ret
+
+0000000000002385 <link>:
+SYSCALL(link)
+    2385:	b8 13 00 00 00       	mov    $0x13,%eax
+    238a:	49 89 ca             	mov    %rcx,%r10
+    238d:	0f 05                	syscall
+    238f:	c3                   	ret
+
+0000000000002390 <mkdir>:
+SYSCALL(mkdir)
+    2390:	b8 14 00 00 00       	mov    $0x14,%eax
+    2395:	49 89 ca             	mov    %rcx,%r10
+    2398:	0f 05                	syscall
+    239a:	c3                   	ret
+
+000000000000239b <chdir>:
+SYSCALL(chdir)
+    239b:	b8 09 00 00 00       	mov    $0x9,%eax
+    23a0:	49 89 ca             	mov    %rcx,%r10
+    23a3:	0f 05                	syscall
+    23a5:	c3                   	ret
+
+00000000000023a6 <dup>:
+SYSCALL(dup)
+    23a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+    23ab:	49 89 ca             	mov    %rcx,%r10
+    23ae:	0f 05                	syscall
+    23b0:	c3                   	ret
+
+00000000000023b1 <getpid>:
+SYSCALL(getpid)
+    23b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+    23b6:	49 89 ca             	mov    %rcx,%r10
+    23b9:	0f 05                	syscall
+    23bb:	c3                   	ret
+
+00000000000023bc <sbrk>:
+SYSCALL(sbrk)
+    23bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+    23c1:	49 89 ca             	mov    %rcx,%r10
+    23c4:	0f 05                	syscall
+    23c6:	c3                   	ret
+
+00000000000023c7 <sleep>:
+SYSCALL(sleep)
+    23c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+    23cc:	49 89 ca             	mov    %rcx,%r10
+    23cf:	0f 05                	syscall
+    23d1:	c3                   	ret
+
+00000000000023d2 <uptime>:
+SYSCALL(uptime)
+    23d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+    23d7:	49 89 ca             	mov    %rcx,%r10
+    23da:	0f 05                	syscall
+    23dc:	c3                   	ret
+
+00000000000023dd <sysinfo>:
+SYSCALL(sysinfo)
+    23dd:	b8 16 00 00 00       	mov    $0x16,%eax
+    23e2:	49 89 ca             	mov    %rcx,%r10
+    23e5:	0f 05                	syscall
+    23e7:	c3                   	ret
+
+00000000000023e8 <crashn>:
+SYSCALL(crashn)
+    23e8:	b8 17 00 00 00       	mov    $0x17,%eax
+    23ed:	49 89 ca             	mov    %rcx,%r10
+    23f0:	0f 05                	syscall
+    23f2:	c3                   	ret
+
+00000000000023f3 <mmap>:
+SYSCALL(mmap)
+    23f3:	b8 18 00 00 00       	mov    $0x18,%eax
+    23f8:	49 89 ca             	mov    %rcx,%r10
+    23fb:	0f 05                	syscall
+    23fd:	c3                   	ret
+
+00000000000023fe <munmap>:
+SYSCALL(munmap)
+    23fe:	b8 19 00 00 00       	mov    $0x19,%eax
+    2403:	49 89 ca             	mov    %rcx,%r10
+    2406:	0f 05                	syscall
+    2408:	c3                   	ret
+
+0000000000002409 <nice>:
+SYSCALL(nice)
+    2409:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    240e:	49 89 ca             	mov    %rcx,%r10
+    2411:	0f 05                	syscall
+    2413:	c3                   	ret
+
+0000000000002414 <_spawn>:
+SYSCALL_(spawn)
+    2414:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    2419:	49 89 ca             	mov    %rcx,%r10
+    241c:	0f 05                	syscall
+    241e:	c3                   	ret
+
+000000000000241f <pread>:
+SYSCALL(pread)
+    241f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2424:	49 89 ca             	mov    %rcx,%r10
+    2427:	0f 05                	syscall
+    2429:	c3                   	ret
+
+000000000000242a <pwrite>:
+SYSCALL(pwrite)
+    242a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    242f:	49 89 ca             	mov    %rcx,%r10
+    2432:	0f 05                	syscall
+    2434:	c3                   	ret
+
+0000000000002435 <readv>:
+SYSCALL(readv)
+    2435:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    243a:	49 89 ca             	mov    %rcx,%r10
+    243d:	0f 05                	syscall
+    243f:	c3                   	ret
+
+0000000000002440 <writev>:
+SYSCALL(writev)
+    2440:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2445:	49 89 ca             	mov    %rcx,%r10
+    2448:	0f 05                	syscall
+    244a:	c3                   	ret
+
+000000000000244b <sendfile>:
+SYSCALL(sendfile)
+    244b:	b8 20 00 00 00       	mov    $0x20,%eax
+    2450:	49 89 ca             	mov    %rcx,%r10
+    2453:	0f 05                	syscall
+    2455:	c3                   	ret
+
+0000000000002456 <splice>:
+SYSCALL(splice)
+    2456:	b8 21 00 00 00       	mov    $0x21,%eax
+    245b:	49 89 ca             	mov    %rcx,%r10
+    245e:	0f 05                	syscall
+    2460:	c3                   	ret
+
+0000000000002461 <poll>:
+SYSCALL(poll)
+    2461:	b8 22 00 00 00       	mov    $0x22,%eax
+    2466:	49 89 ca             	mov    %rcx,%r10
+    2469:	0f 05                	syscall
+    246b:	c3                   	ret
+
+000000000000246c <fsync>:
+SYSCALL(fsync)
+    246c:	b8 23 00 00 00       	mov    $0x23,%eax
+    2471:	49 89 ca             	mov    %rcx,%r10
+    2474:	0f 05                	syscall
+    2476:	c3                   	ret
+
+0000000000002477 <fdatasync>:
+SYSCALL(fdatasync)
+    2477:	b8 24 00 00 00       	mov    $0x24,%eax
+    247c:	49 89 ca             	mov    %rcx,%r10
+    247f:	0f 05                	syscall
+    2481:	c3                   	ret
+
+0000000000002482 <lockstat>:
+SYSCALL(lockstat)
+    2482:	b8 25 00 00 00       	mov    $0x25,%eax
+    2487:	49 89 ca             	mov    %rcx,%r10
+    248a:	0f 05                	syscall
+    248c:	c3                   	ret
+
+000000000000248d <syscallstat>:
+SYSCALL(syscallstat)
+    248d:	b8 26 00 00 00       	mov    $0x26,%eax
+    2492:	49 89 ca             	mov    %rcx,%r10
+    2495:	0f 05                	syscall
+    2497:	c3                   	ret
+
+0000000000002498 <trace>:
+SYSCALL(trace)
+    2498:	b8 27 00 00 00       	mov    $0x27,%eax
+    249d:	49 89 ca             	mov    %rcx,%r10
+    24a0:	0f 05                	syscall
+    24a2:	c3                   	ret
+
+00000000000024a3 <profile>:
+SYSCALL(profile)
+    24a3:	b8 28 00 00 00       	mov    $0x28,%eax
+    24a8:	49 89 ca             	mov    %rcx,%r10
+    24ab:	0f 05                	syscall
+    24ad:	c3                   	ret
+
+00000000000024ae <cycles>:
+SYSCALL(cycles)
+    24ae:	b8 29 00 00 00       	mov    $0x29,%eax
+    24b3:	49 89 ca             	mov    %rcx,%r10
+    24b6:	0f 05                	syscall
+    24b8:	c3                   	ret
+
+00000000000024b9 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    24b9:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    24be:	49 89 ca             	mov    %rcx,%r10
+    24c1:	0f 05                	syscall
+    24c3:	c3                   	ret
+
+00000000000024c4 <consmode>:
+SYSCALL(consmode)
+    24c4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    24c9:	49 89 ca             	mov    %rcx,%r10
+    24cc:	0f 05                	syscall
+    24ce:	c3                   	ret
+
+00000000000024cf <clone>:
+SYSCALL(clone)
+    24cf:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    24d4:	49 89 ca             	mov    %rcx,%r10
+    24d7:	0f 05                	syscall
+    24d9:	c3                   	ret
+
+00000000000024da <join>:
+SYSCALL(join)
+    24da:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    24df:	49 89 ca             	mov    %rcx,%r10
+    24e2:	0f 05                	syscall
+    24e4:	c3                   	ret
+
+00000000000024e5 <futex_wait>:
+SYSCALL(futex_wait)
+    24e5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    24ea:	49 89 ca             	mov    %rcx,%r10
+    24ed:	0f 05                	syscall
+    24ef:	c3                   	ret
+
+00000000000024f0 <futex_wake>:
+SYSCALL(futex_wake)
+    24f0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    24f5:	49 89 ca             	mov    %rcx,%r10
+    24f8:	0f 05                	syscall
+    24fa:	c3                   	ret
+
+00000000000024fb <shmget>:
+SYSCALL(shmget)
+    24fb:	b8 30 00 00 00       	mov    $0x30,%eax
+    2500:	49 89 ca             	mov    %rcx,%r10
+    2503:	0f 05                	syscall
+    2505:	c3                   	ret
+
+0000000000002506 <shmat>:
+SYSCALL(shmat)
+    2506:	b8 31 00 00 00       	mov    $0x31,%eax
+    250b:	49 89 ca             	mov    %rcx,%r10
+    250e:	0f 05                	syscall
+    2510:	c3                   	ret
+
+0000000000002511 <shmdt>:
+SYSCALL(shmdt)
+    2511:	b8 32 00 00 00       	mov    $0x32,%eax
+    2516:	49 89 ca             	mov    %rcx,%r10
+    2519:	0f 05                	syscall
+    251b:	c3                   	ret
+
+000000000000251c <ring_setup>:
+SYSCALL(ring_setup)
+    251c:	b8 33 00 00 00       	mov    $0x33,%eax
+    2521:	49 89 ca             	mov    %rcx,%r10
+    2524:	0f 05                	syscall
+    2526:	c3                   	ret
+
+0000000000002527 <ring_enter>:
+SYSCALL(ring_enter)
+    2527:	b8 34 00 00 00       	mov    $0x34,%eax
+    252c:	49 89 ca             	mov    %rcx,%r10
+    252f:	0f 05                	syscall
+    2531:	c3                   	ret
+
+0000000000002532 <getdents>:
+SYSCALL(getdents)
+    2532:	b8 35 00 00 00       	mov    $0x35,%eax
+    2537:	49 89 ca             	mov    %rcx,%r10
+    253a:	0f 05                	syscall
+    253c:	c3                   	ret
+
+000000000000253d <fstatat>:
+SYSCALL(fstatat)
+    253d:	b8 36 00 00 00       	mov    $0x36,%eax
+    2542:	49 89 ca             	mov    %rcx,%r10
+    2545:	0f 05                	syscall
+    2547:	c3                   	ret
+
+0000000000002548 <clone_file>:
+SYSCALL(clone_file)
+    2548:	b8 37 00 00 00       	mov    $0x37,%eax
+    254d:	49 89 ca             	mov    %rcx,%r10
+    2550:	0f 05                	syscall
+    2552:	c3                   	ret
+
+0000000000002553 <fpunch>:
+SYSCALL(fpunch)
+    2553:	b8 38 00 00 00       	mov    $0x38,%eax
+    2558:	49 89 ca             	mov    %rcx,%r10
+    255b:	0f 05                	syscall
+    255d:	c3                   	ret
+
+000000000000255e <defrag>:
+SYSCALL(defrag)
+    255e:	b8 39 00 00 00       	mov    $0x39,%eax
+    2563:	49 89 ca             	mov    %rcx,%r10
+    2566:	0f 05                	syscall
+    2568:	c3                   	ret
+
+0000000000002569 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    2569:	55                   	push   %rbp
+    256a:	48 89 e5             	mov    %rsp,%rbp
+    256d:	48 83 ec 20          	sub    $0x20,%rsp
+    2571:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    2575:	bf 00 00 00 00       	mov    $0x0,%edi
+    257a:	e8 3d fe ff ff       	call   23bc <sbrk>
+    257f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    2583:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2587:	48 f7 d8             	neg    %rax
+    258a:	25 ff 0f 00 00       	and    $0xfff,%eax
+    258f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    2593:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2597:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    259b:	48 01 c2             	add    %rax,%rdx
+    259e:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    25a3:	48 39 c2             	cmp    %rax,%rdx
+    25a6:	73 1e                	jae    25c6 <morecore+0x5d>
+    25a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    25ac:	89 c2                	mov    %eax,%edx
+    25ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25b2:	01 d0                	add    %edx,%eax
+    25b4:	89 c7                	mov    %eax,%edi
+    25b6:	e8 01 fe ff ff       	call   23bc <sbrk>
+    25bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    25bf:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    25c4:	75 07                	jne    25cd <morecore+0x64>
+    return 0;
+    25c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    25cb:	eb 27                	jmp    25f4 <morecore+0x8b>
+  stats.heap += n + pad;
+    25cd:	48 8b 05 5c 1c 00 00 	mov    0x1c5c(%rip),%rax        # 4230 <stats+0x50>
+    25d4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    25d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    25dc:	48 01 ca             	add    %rcx,%rdx
+    25df:	48 01 d0             	add    %rdx,%rax
+    25e2:	48 89 05 47 1c 00 00 	mov    %rax,0x1c47(%rip)        # 4230 <stats+0x50>
+  return p + pad;
+    25e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    25ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    25f1:	48 01 d0             	add    %rdx,%rax
+}
+    25f4:	c9                   	leave
+    25f5:	c3                   	ret
+
+00000000000025f6 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    25f6:	55                   	push   %rbp
+    25f7:	48 89 e5             	mov    %rsp,%rbp
+    25fa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    25fe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    2602:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2609:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    260a:	48 8d 05 af 1b 00 00 	lea    0x1baf(%rip),%rax        # 41c0 <runs>
+    2611:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2615:	eb 1a                	jmp    2631 <pagefree+0x3b>
+    prev = *rp;
+    2617:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    261b:	48 8b 00             	mov    (%rax),%rax
+    261e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    2622:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2626:	48 8b 00             	mov    (%rax),%rax
+    2629:	48 83 c0 08          	add    $0x8,%rax
+    262d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2631:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2635:	48 8b 00             	mov    (%rax),%rax
+    2638:	48 85 c0             	test   %rax,%rax
+    263b:	74 0d                	je     264a <pagefree+0x54>
+    263d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2641:	48 8b 00             	mov    (%rax),%rax
+    2644:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    2648:	72 cd                	jb     2617 <pagefree+0x21>
+  r = (struct run *)p;
+    264a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    264e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    2652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2656:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    265a:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    265d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2661:	48 8b 10             	mov    (%rax),%rdx
+    2664:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2668:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    266c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2670:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2674:	48 85 c0             	test   %rax,%rax
+    2677:	74 48                	je     26c1 <pagefree+0xcb>
+    2679:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    267d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2681:	48 01 c2             	add    %rax,%rdx
+    2684:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2688:	48 8b 40 08          	mov    0x8(%rax),%rax
+    268c:	48 39 c2             	cmp    %rax,%rdx
+    268f:	75 30                	jne    26c1 <pagefree+0xcb>
+    r->size += r->next->size;
+    2691:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2695:	48 8b 10             	mov    (%rax),%rdx
+    2698:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    269c:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26a0:	48 8b 00             	mov    (%rax),%rax
+    26a3:	48 01 c2             	add    %rax,%rdx
+    26a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26aa:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    26ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26b1:	48 8b 40 08          	mov    0x8(%rax),%rax
+    26b5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    26b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26bd:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    26c1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    26c6:	74 46                	je     270e <pagefree+0x118>
+    26c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26cc:	48 8b 10             	mov    (%rax),%rdx
+    26cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26d3:	48 01 d0             	add    %rdx,%rax
+    26d6:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    26da:	75 32                	jne    270e <pagefree+0x118>
+    prev->size += r->size;
+    26dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26e0:	48 8b 10             	mov    (%rax),%rdx
+    26e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e7:	48 8b 00             	mov    (%rax),%rax
+    26ea:	48 01 c2             	add    %rax,%rdx
+    26ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    26f1:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    26f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26f8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    26fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2700:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    2704:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2708:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    270c:	eb 0c                	jmp    271a <pagefree+0x124>
+  } else {
+    *rp = r;
+    270e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2712:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2716:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    2719:	90                   	nop
+    271a:	90                   	nop
+    271b:	5d                   	pop    %rbp
+    271c:	c3                   	ret
+
+000000000000271d <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    271d:	55                   	push   %rbp
+    271e:	48 89 e5             	mov    %rsp,%rbp
+    2721:	48 83 ec 40          	sub    $0x40,%rsp
+    2725:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2729:	48 8d 05 90 1a 00 00 	lea    0x1a90(%rip),%rax        # 41c0 <runs>
+    2730:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2734:	eb 66                	jmp    279c <pagealloc+0x7f>
+    if (r->size == n) {
+    2736:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    273a:	48 8b 00             	mov    (%rax),%rax
+    273d:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2741:	75 18                	jne    275b <pagealloc+0x3e>
+      *rp = r->next;
+    2743:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2747:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    274b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    274f:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    2752:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2756:	e9 ca 00 00 00       	jmp    2825 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    275b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    275f:	48 8b 00             	mov    (%rax),%rax
+    2762:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    2766:	73 28                	jae    2790 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    2768:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    276c:	48 8b 00             	mov    (%rax),%rax
+    276f:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2773:	48 89 c2             	mov    %rax,%rdx
+    2776:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    277a:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    277d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2781:	48 8b 10             	mov    (%rax),%rdx
+    2784:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2788:	48 01 d0             	add    %rdx,%rax
+    278b:	e9 95 00 00 00       	jmp    2825 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2794:	48 83 c0 08          	add    $0x8,%rax
+    2798:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    279c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    27a0:	48 8b 00             	mov    (%rax),%rax
+    27a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    27a7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    27ac:	75 88                	jne    2736 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    27ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    27b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    27b6:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    27bd:	00 
+    27be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    27c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    27c6:	48 39 c2             	cmp    %rax,%rdx
+    27c9:	48 0f 43 c2          	cmovae %rdx,%rax
+    27cd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    27d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27d5:	48 89 c7             	mov    %rax,%rdi
+    27d8:	e8 8c fd ff ff       	call   2569 <morecore>
+    27dd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    27e1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    27e6:	75 07                	jne    27ef <pagealloc+0xd2>
+    return 0;
+    27e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    27ed:	eb 36                	jmp    2825 <pagealloc+0x108>
+  if (m > n)
+    27ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27f3:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    27f7:	73 1a                	jae    2813 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    27f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    27fd:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2801:	48 89 c2             	mov    %rax,%rdx
+    2804:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2808:	48 89 d6             	mov    %rdx,%rsi
+    280b:	48 89 c7             	mov    %rax,%rdi
+    280e:	e8 e3 fd ff ff       	call   25f6 <pagefree>
+  return p + m - n;
+    2813:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    2817:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    281b:	48 89 c2             	mov    %rax,%rdx
+    281e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    2822:	48 01 d0             	add    %rdx,%rax
+}
+    2825:	c9                   	leave
+    2826:	c3                   	ret
+
+0000000000002827 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    2827:	55                   	push   %rbp
+    2828:	48 89 e5             	mov    %rsp,%rbp
+    282b:	48 83 ec 30          	sub    $0x30,%rsp
+    282f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    2832:	bf 00 10 00 00       	mov    $0x1000,%edi
+    2837:	e8 e1 fe ff ff       	call   271d <pagealloc>
+    283c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2840:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2845:	75 0a                	jne    2851 <refill+0x2a>
+    return -1;
+    2847:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    284c:	e9 da 00 00 00       	jmp    292b <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2851:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    2858:	00 
+    2859:	e9 ba 00 00 00       	jmp    2918 <refill+0xf1>
+    b = (struct block *)(p + off);
+    285e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2862:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2866:	48 01 d0             	add    %rdx,%rax
+    2869:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    286d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2870:	ba 20 00 00 00       	mov    $0x20,%edx
+    2875:	89 c1                	mov    %eax,%ecx
+    2877:	48 d3 e2             	shl    %cl,%rdx
+    287a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    287e:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    2881:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2884:	48 63 d0             	movslq %eax,%rdx
+    2887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    288b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    288f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2892:	48 98                	cltq
+    2894:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    289b:	00 
+    289c:	48 8d 05 dd 18 00 00 	lea    0x18dd(%rip),%rax        # 4180 <freelist>
+    28a3:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    28a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28ab:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    28af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28b2:	48 98                	cltq
+    28b4:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    28bb:	00 
+    28bc:	48 8d 15 bd 18 00 00 	lea    0x18bd(%rip),%rdx        # 4180 <freelist>
+    28c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    28c7:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    28cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28ce:	48 98                	cltq
+    28d0:	48 83 c0 08          	add    $0x8,%rax
+    28d4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    28db:	00 
+    28dc:	48 8d 05 01 19 00 00 	lea    0x1901(%rip),%rax        # 41e4 <stats+0x4>
+    28e3:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    28e6:	8d 48 01             	lea    0x1(%rax),%ecx
+    28e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    28ec:	48 98                	cltq
+    28ee:	48 83 c0 08          	add    $0x8,%rax
+    28f2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    28f9:	00 
+    28fa:	48 8d 05 e3 18 00 00 	lea    0x18e3(%rip),%rax        # 41e4 <stats+0x4>
+    2901:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2904:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2907:	ba 20 00 00 00       	mov    $0x20,%edx
+    290c:	89 c1                	mov    %eax,%ecx
+    290e:	48 d3 e2             	shl    %cl,%rdx
+    2911:	48 89 d0             	mov    %rdx,%rax
+    2914:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    2918:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    291f:	00 
+    2920:	0f 86 38 ff ff ff    	jbe    285e <refill+0x37>
+  }
+  return 0;
+    2926:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    292b:	c9                   	leave
+    292c:	c3                   	ret
+
+000000000000292d <malloc>:
+
+void *malloc(uint nbytes) {
+    292d:	55                   	push   %rbp
+    292e:	48 89 e5             	mov    %rsp,%rbp
+    2931:	48 83 ec 30          	sub    $0x30,%rsp
+    2935:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    2938:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    293b:	48 83 c0 10          	add    $0x10,%rax
+    293f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    2943:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    294a:	eb 04                	jmp    2950 <malloc+0x23>
+    294c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2950:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    2954:	7f 16                	jg     296c <malloc+0x3f>
+    2956:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2959:	ba 20 00 00 00       	mov    $0x20,%edx
+    295e:	89 c1                	mov    %eax,%ecx
+    2960:	48 d3 e2             	shl    %cl,%rdx
+    2963:	48 89 d0             	mov    %rdx,%rax
+    2966:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    296a:	72 e0                	jb     294c <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    296c:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    2970:	75 7d                	jne    29ef <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    2972:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2976:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    297c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    2982:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    2986:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    298a:	48 89 c7             	mov    %rax,%rdi
+    298d:	e8 8b fd ff ff       	call   271d <pagealloc>
+    2992:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    2996:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    299b:	75 0a                	jne    29a7 <malloc+0x7a>
+      return 0;
+    299d:	b8 00 00 00 00       	mov    $0x0,%eax
+    29a2:	e9 2c 01 00 00       	jmp    2ad3 <malloc+0x1a6>
+    h->size = n;
+    29a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    29af:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    29b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29b6:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    29bd:	00 
+    stats.inuse[LARGE]++;
+    29be:	8b 05 3c 18 00 00    	mov    0x183c(%rip),%eax        # 4200 <stats+0x20>
+    29c4:	83 c0 01             	add    $0x1,%eax
+    29c7:	89 05 33 18 00 00    	mov    %eax,0x1833(%rip)        # 4200 <stats+0x20>
+    stats.large += n;
+    29cd:	48 8b 15 54 18 00 00 	mov    0x1854(%rip),%rdx        # 4228 <stats+0x48>
+    29d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    29d8:	48 01 d0             	add    %rdx,%rax
+    29db:	48 89 05 46 18 00 00 	mov    %rax,0x1846(%rip)        # 4228 <stats+0x48>
+    return h + 1;
+    29e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    29e6:	48 83 c0 10          	add    $0x10,%rax
+    29ea:	e9 e4 00 00 00       	jmp    2ad3 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    29ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    29f2:	48 98                	cltq
+    29f4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    29fb:	00 
+    29fc:	48 8d 05 7d 17 00 00 	lea    0x177d(%rip),%rax        # 4180 <freelist>
+    2a03:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2a07:	48 85 c0             	test   %rax,%rax
+    2a0a:	75 18                	jne    2a24 <malloc+0xf7>
+    2a0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a0f:	89 c7                	mov    %eax,%edi
+    2a11:	e8 11 fe ff ff       	call   2827 <refill>
+    2a16:	85 c0                	test   %eax,%eax
+    2a18:	79 0a                	jns    2a24 <malloc+0xf7>
+    return 0;
+    2a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    2a1f:	e9 af 00 00 00       	jmp    2ad3 <malloc+0x1a6>
+  b = freelist[c];
+    2a24:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a27:	48 98                	cltq
+    2a29:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2a30:	00 
+    2a31:	48 8d 05 48 17 00 00 	lea    0x1748(%rip),%rax        # 4180 <freelist>
+    2a38:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    2a3c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    2a40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2a44:	48 8b 40 10          	mov    0x10(%rax),%rax
+    2a48:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2a4b:	48 63 d2             	movslq %edx,%rdx
+    2a4e:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2a55:	00 
+    2a56:	48 8d 15 23 17 00 00 	lea    0x1723(%rip),%rdx        # 4180 <freelist>
+    2a5d:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    2a61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a64:	48 98                	cltq
+    2a66:	48 83 c0 08          	add    $0x8,%rax
+    2a6a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2a71:	00 
+    2a72:	48 8d 05 6b 17 00 00 	lea    0x176b(%rip),%rax        # 41e4 <stats+0x4>
+    2a79:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2a7c:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2a7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a82:	48 98                	cltq
+    2a84:	48 83 c0 08          	add    $0x8,%rax
+    2a88:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2a8f:	00 
+    2a90:	48 8d 05 4d 17 00 00 	lea    0x174d(%rip),%rax        # 41e4 <stats+0x4>
+    2a97:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    2a9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2a9d:	48 98                	cltq
+    2a9f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2aa6:	00 
+    2aa7:	48 8d 05 32 17 00 00 	lea    0x1732(%rip),%rax        # 41e0 <stats>
+    2aae:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2ab1:	8d 48 01             	lea    0x1(%rax),%ecx
+    2ab4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2ab7:	48 98                	cltq
+    2ab9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2ac0:	00 
+    2ac1:	48 8d 05 18 17 00 00 	lea    0x1718(%rip),%rax        # 41e0 <stats>
+    2ac8:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    2acb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2acf:	48 83 c0 10          	add    $0x10,%rax
+}
+    2ad3:	c9                   	leave
+    2ad4:	c3                   	ret
+
+0000000000002ad5 <free>:
+
+void free(void *ap) {
+    2ad5:	55                   	push   %rbp
+    2ad6:	48 89 e5             	mov    %rsp,%rbp
+    2ad9:	48 83 ec 18          	sub    $0x18,%rsp
+    2add:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    2ae1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    2ae6:	0f 84 03 01 00 00    	je     2bef <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    2aec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2af0:	48 83 e8 10          	sub    $0x10,%rax
+    2af4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    2af8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2afc:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2b00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    2b04:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    2b09:	75 42                	jne    2b4d <free+0x78>
+    stats.inuse[LARGE]--;
+    2b0b:	8b 05 ef 16 00 00    	mov    0x16ef(%rip),%eax        # 4200 <stats+0x20>
+    2b11:	83 e8 01             	sub    $0x1,%eax
+    2b14:	89 05 e6 16 00 00    	mov    %eax,0x16e6(%rip)        # 4200 <stats+0x20>
+    stats.large -= b->h.size;
+    2b1a:	48 8b 15 07 17 00 00 	mov    0x1707(%rip),%rdx        # 4228 <stats+0x48>
+    2b21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b25:	48 8b 00             	mov    (%rax),%rax
+    2b28:	48 29 c2             	sub    %rax,%rdx
+    2b2b:	48 89 15 f6 16 00 00 	mov    %rdx,0x16f6(%rip)        # 4228 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    2b32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b36:	48 8b 10             	mov    (%rax),%rdx
+    2b39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b3d:	48 89 d6             	mov    %rdx,%rsi
+    2b40:	48 89 c7             	mov    %rax,%rdi
+    2b43:	e8 ae fa ff ff       	call   25f6 <pagefree>
+    return;
+    2b48:	e9 a3 00 00 00       	jmp    2bf0 <free+0x11b>
+  }
+  b->next = freelist[c];
+    2b4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b51:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2b58:	00 
+    2b59:	48 8d 05 20 16 00 00 	lea    0x1620(%rip),%rax        # 4180 <freelist>
+    2b60:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2b64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b68:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    2b6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b70:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2b77:	00 
+    2b78:	48 8d 15 01 16 00 00 	lea    0x1601(%rip),%rdx        # 4180 <freelist>
+    2b7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2b83:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    2b87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2b8b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2b92:	00 
+    2b93:	48 8d 05 46 16 00 00 	lea    0x1646(%rip),%rax        # 41e0 <stats>
+    2b9a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2b9d:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2ba0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ba4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2bab:	00 
+    2bac:	48 8d 05 2d 16 00 00 	lea    0x162d(%rip),%rax        # 41e0 <stats>
+    2bb3:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    2bb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bba:	48 83 c0 08          	add    $0x8,%rax
+    2bbe:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2bc5:	00 
+    2bc6:	48 8d 05 17 16 00 00 	lea    0x1617(%rip),%rax        # 41e4 <stats+0x4>
+    2bcd:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2bd0:	8d 48 01             	lea    0x1(%rax),%ecx
+    2bd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2bd7:	48 83 c0 08          	add    $0x8,%rax
+    2bdb:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2be2:	00 
+    2be3:	48 8d 05 fa 15 00 00 	lea    0x15fa(%rip),%rax        # 41e4 <stats+0x4>
+    2bea:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    2bed:	eb 01                	jmp    2bf0 <free+0x11b>
+    return;
+    2bef:	90                   	nop
+}
+    2bf0:	c9                   	leave
+    2bf1:	c3                   	ret
+
+0000000000002bf2 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    2bf2:	55                   	push   %rbp
+    2bf3:	48 89 e5             	mov    %rsp,%rbp
+    2bf6:	48 83 ec 30          	sub    $0x30,%rsp
+    2bfa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    2bfd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2c00:	48 8d 15 61 03 00 00 	lea    0x361(%rip),%rdx        # 2f68 <benchreport+0x24e>
+    2c07:	48 89 d6             	mov    %rdx,%rsi
+    2c0a:	89 c7                	mov    %eax,%edi
+    2c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+    2c11:	e8 37 e6 ff ff       	call   124d <printf>
+  for (c = 0; c < NCLASS; c++)
+    2c16:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2c1d:	eb 67                	jmp    2c86 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2c1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c22:	48 98                	cltq
+    2c24:	48 83 c0 08          	add    $0x8,%rax
+    2c28:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2c2f:	00 
+    2c30:	48 8d 05 ad 15 00 00 	lea    0x15ad(%rip),%rax        # 41e4 <stats+0x4>
+    2c37:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    2c3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c3d:	48 98                	cltq
+    2c3f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2c46:	00 
+    2c47:	48 8d 05 92 15 00 00 	lea    0x1592(%rip),%rax        # 41e0 <stats>
+    2c4e:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    2c51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2c54:	ba 20 00 00 00       	mov    $0x20,%edx
+    2c59:	89 c1                	mov    %eax,%ecx
+    2c5b:	48 d3 e2             	shl    %cl,%rdx
+    2c5e:	48 89 d0             	mov    %rdx,%rax
+    2c61:	89 c1                	mov    %eax,%ecx
+    2c63:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2c66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2c69:	41 89 f9             	mov    %edi,%r9d
+    2c6c:	41 89 f0             	mov    %esi,%r8d
+    2c6f:	48 8d 35 09 03 00 00 	lea    0x309(%rip),%rsi        # 2f7f <benchreport+0x265>
+    2c76:	89 c7                	mov    %eax,%edi
+    2c78:	b8 00 00 00 00       	mov    $0x0,%eax
+    2c7d:	e8 cb e5 ff ff       	call   124d <printf>
+  for (c = 0; c < NCLASS; c++)
+    2c82:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    2c86:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    2c8a:	7e 93                	jle    2c1f <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    2c8c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2c93:	00 
+  for (r = runs; r; r = r->next)
+    2c94:	48 8b 05 25 15 00 00 	mov    0x1525(%rip),%rax        # 41c0 <runs>
+    2c9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2c9f:	eb 17                	jmp    2cb8 <mallocstats+0xc6>
+    nfree += r->size;
+    2ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2ca5:	48 8b 00             	mov    (%rax),%rax
+    2ca8:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    2cac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2cb0:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2cb4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2cb8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2cbd:	75 e2                	jne    2ca1 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    2cbf:	48 8b 05 6a 15 00 00 	mov    0x156a(%rip),%rax        # 4230 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2cc6:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2cc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2ccc:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2cd0:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2cd2:	48 8b 05 4f 15 00 00 	mov    0x154f(%rip),%rax        # 4228 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2cd9:	89 c1                	mov    %eax,%ecx
+    2cdb:	8b 15 1f 15 00 00    	mov    0x151f(%rip),%edx        # 4200 <stats+0x20>
+    2ce1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2ce4:	41 89 f9             	mov    %edi,%r9d
+    2ce7:	41 89 f0             	mov    %esi,%r8d
+    2cea:	48 8d 35 9f 02 00 00 	lea    0x29f(%rip),%rsi        # 2f90 <benchreport+0x276>
+    2cf1:	89 c7                	mov    %eax,%edi
+    2cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+    2cf8:	e8 50 e5 ff ff       	call   124d <printf>
+}
+    2cfd:	90                   	nop
+    2cfe:	c9                   	leave
+    2cff:	c3                   	ret
+
+0000000000002d00 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    2d00:	55                   	push   %rbp
+    2d01:	48 89 e5             	mov    %rsp,%rbp
+    2d04:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    2d08:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    2d0c:	48 89 c7             	mov    %rax,%rdi
+    2d0f:	e8 9a f7 ff ff       	call   24ae <cycles>
+  return t;
+    2d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2d18:	c9                   	leave
+    2d19:	c3                   	ret
+
+0000000000002d1a <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    2d1a:	55                   	push   %rbp
+    2d1b:	48 89 e5             	mov    %rsp,%rbp
+    2d1e:	48 83 ec 30          	sub    $0x30,%rsp
+    2d22:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    2d26:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2d2a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    2d2d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2d31:	0f 8e 24 01 00 00    	jle    2e5b <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    2d37:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2d3e:	e9 98 00 00 00       	jmp    2ddb <benchreport+0xc1>
+    x = t[i];
+    2d43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2d46:	48 98                	cltq
+    2d48:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2d4f:	00 
+    2d50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d54:	48 01 d0             	add    %rdx,%rax
+    2d57:	48 8b 00             	mov    (%rax),%rax
+    2d5a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2d5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2d61:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2d64:	eb 33                	jmp    2d99 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    2d66:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2d69:	48 98                	cltq
+    2d6b:	48 c1 e0 03          	shl    $0x3,%rax
+    2d6f:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2d73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2d77:	48 01 d0             	add    %rdx,%rax
+    2d7a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2d7d:	48 63 d2             	movslq %edx,%rdx
+    2d80:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    2d87:	00 
+    2d88:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2d8c:	48 01 ca             	add    %rcx,%rdx
+    2d8f:	48 8b 00             	mov    (%rax),%rax
+    2d92:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2d95:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    2d99:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2d9d:	7e 1d                	jle    2dbc <benchreport+0xa2>
+    2d9f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2da2:	48 98                	cltq
+    2da4:	48 c1 e0 03          	shl    $0x3,%rax
+    2da8:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2dac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2db0:	48 01 d0             	add    %rdx,%rax
+    2db3:	48 8b 00             	mov    (%rax),%rax
+    2db6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2dba:	72 aa                	jb     2d66 <benchreport+0x4c>
+    t[j] = x;
+    2dbc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2dbf:	48 98                	cltq
+    2dc1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2dc8:	00 
+    2dc9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2dcd:	48 01 c2             	add    %rax,%rdx
+    2dd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2dd4:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    2dd7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2ddb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2dde:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2de1:	0f 8c 5c ff ff ff    	jl     2d43 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    2de7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2dea:	48 98                	cltq
+    2dec:	48 c1 e0 03          	shl    $0x3,%rax
+    2df0:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2df4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2df8:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2dfb:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    2dfe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2e01:	89 c2                	mov    %eax,%edx
+    2e03:	c1 ea 1f             	shr    $0x1f,%edx
+    2e06:	01 d0                	add    %edx,%eax
+    2e08:	d1 f8                	sar    %eax
+    2e0a:	48 98                	cltq
+    2e0c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2e13:	00 
+    2e14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e18:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2e1b:	48 8b 38             	mov    (%rax),%rdi
+    2e1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2e22:	48 8b 30             	mov    (%rax),%rsi
+    2e25:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2e28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2e2c:	48 83 ec 08          	sub    $0x8,%rsp
+    2e30:	51                   	push   %rcx
+    2e31:	49 89 f9             	mov    %rdi,%r9
+    2e34:	49 89 f0             	mov    %rsi,%r8
+    2e37:	89 d1                	mov    %edx,%ecx
+    2e39:	48 89 c2             	mov    %rax,%rdx
+    2e3c:	48 8d 05 8d 01 00 00 	lea    0x18d(%rip),%rax        # 2fd0 <benchreport+0x2b6>
+    2e43:	48 89 c6             	mov    %rax,%rsi
+    2e46:	bf 01 00 00 00       	mov    $0x1,%edi
+    2e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+    2e50:	e8 f8 e3 ff ff       	call   124d <printf>
+    2e55:	48 83 c4 10          	add    $0x10,%rsp
+    2e59:	eb 01                	jmp    2e5c <benchreport+0x142>
+    return;
+    2e5b:	90                   	nop
+}
+    2e5c:	c9                   	leave
+    2e5d:	c3                   	ret
@@ -0,0 +1,3447 @@
+
+out/user/_stressfs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <fcntl.h>
+#include <fs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 81 ec 30 02 00 00 	sub    $0x230,%rsp
+       b:	89 bd dc fd ff ff    	mov    %edi,-0x224(%rbp)
+      11:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+  int fd, i;
+  char path[] = "stressfs0";
+      18:	48 b8 73 74 72 65 73 	movabs $0x7366737365727473,%rax
+      1f:	73 66 73 
+      22:	48 89 45 ee          	mov    %rax,-0x12(%rbp)
+      26:	66 c7 45 f6 30 00    	movw   $0x30,-0xa(%rbp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+      2c:	48 8d 05 fd 1e 00 00 	lea    0x1efd(%rip),%rax        # 1f30 <benchreport+0x145>
+      33:	48 89 c6             	mov    %rax,%rsi
+      36:	bf 01 00 00 00       	mov    $0x1,%edi
+      3b:	b8 00 00 00 00       	mov    $0x0,%eax
+      40:	e8 d9 02 00 00       	call   31e <printf>
+  memset(data, 'a', sizeof(data));
+      45:	48 8d 85 ee fd ff ff 	lea    -0x212(%rbp),%rax
+      4c:	ba 00 02 00 00       	mov    $0x200,%edx
+      51:	be 61 00 00 00       	mov    $0x61,%esi
+      56:	48 89 c7             	mov    %rax,%rdi
+      59:	e8 e2 0c 00 00       	call   d40 <memset>
+
+  for (i = 0; i < 4; i++)
+      5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      65:	eb 0d                	jmp    74 <main+0x74>
+    if (fork() > 0)
+      67:	e8 d2 08 00 00       	call   93e <fork>
+      6c:	85 c0                	test   %eax,%eax
+      6e:	7f 0c                	jg     7c <main+0x7c>
+  for (i = 0; i < 4; i++)
+      70:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      74:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+      78:	7e ed                	jle    67 <main+0x67>
+      7a:	eb 01                	jmp    7d <main+0x7d>
+      break;
+      7c:	90                   	nop
+
+  printf(1, "write %d\n", i);
+      7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      80:	89 c2                	mov    %eax,%edx
+      82:	48 8d 05 ba 1e 00 00 	lea    0x1eba(%rip),%rax        # 1f43 <benchreport+0x158>
+      89:	48 89 c6             	mov    %rax,%rsi
+      8c:	bf 01 00 00 00       	mov    $0x1,%edi
+      91:	b8 00 00 00 00       	mov    $0x0,%eax
+      96:	e8 83 02 00 00       	call   31e <printf>
+
+  path[8] += i;
+      9b:	0f b6 45 f6          	movzbl -0xa(%rbp),%eax
+      9f:	89 c2                	mov    %eax,%edx
+      a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      a4:	01 d0                	add    %edx,%eax
+      a6:	88 45 f6             	mov    %al,-0xa(%rbp)
+  fd = open(path, O_CREATE | O_RDWR);
+      a9:	48 8d 45 ee          	lea    -0x12(%rbp),%rax
+      ad:	be 02 02 00 00       	mov    $0x202,%esi
+      b2:	48 89 c7             	mov    %rax,%rdi
+      b5:	e8 70 13 00 00       	call   142a <open>
+      ba:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (i = 0; i < 20; i++)
+      bd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      c4:	eb 1d                	jmp    e3 <main+0xe3>
+    //    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+      c6:	48 8d 8d ee fd ff ff 	lea    -0x212(%rbp),%rcx
+      cd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      d0:	ba 00 02 00 00       	mov    $0x200,%edx
+      d5:	48 89 ce             	mov    %rcx,%rsi
+      d8:	89 c7                	mov    %eax,%edi
+      da:	e8 1f 13 00 00       	call   13fe <write>
+  for (i = 0; i < 20; i++)
+      df:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      e3:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+      e7:	7e dd                	jle    c6 <main+0xc6>
+  close(fd);
+      e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ec:	89 c7                	mov    %eax,%edi
+      ee:	e8 c5 08 00 00       	call   9b8 <close>
+
+  printf(1, "read\n");
+      f3:	48 8d 05 53 1e 00 00 	lea    0x1e53(%rip),%rax        # 1f4d <benchreport+0x162>
+      fa:	48 89 c6             	mov    %rax,%rsi
+      fd:	bf 01 00 00 00       	mov    $0x1,%edi
+     102:	b8 00 00 00 00       	mov    $0x0,%eax
+     107:	e8 12 02 00 00       	call   31e <printf>
+
+  fd = open(path, O_RDONLY);
+     10c:	48 8d 45 ee          	lea    -0x12(%rbp),%rax
+     110:	be 00 00 00 00       	mov    $0x0,%esi
+     115:	48 89 c7             	mov    %rax,%rdi
+     118:	e8 0d 13 00 00       	call   142a <open>
+     11d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (i = 0; i < 20; i++)
+     120:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     127:	eb 1d                	jmp    146 <main+0x146>
+    read(fd, data, sizeof(data));
+     129:	48 8d 8d ee fd ff ff 	lea    -0x212(%rbp),%rcx
+     130:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     133:	ba 00 02 00 00       	mov    $0x200,%edx
+     138:	48 89 ce             	mov    %rcx,%rsi
+     13b:	89 c7                	mov    %eax,%edi
+     13d:	e8 b1 12 00 00       	call   13f3 <read>
+  for (i = 0; i < 20; i++)
+     142:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     146:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+     14a:	7e dd                	jle    129 <main+0x129>
+  close(fd);
+     14c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     14f:	89 c7                	mov    %eax,%edi
+     151:	e8 62 08 00 00       	call   9b8 <close>
+
+  wait();
+     156:	e8 82 12 00 00       	call   13dd <wait>
+
+  exit();
+     15b:	e8 ee 07 00 00       	call   94e <exit>
+
+0000000000000160 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     160:	55                   	push   %rbp
+     161:	48 89 e5             	mov    %rsp,%rbp
+     164:	48 83 ec 10          	sub    $0x10,%rsp
+     168:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     16b:	89 f0                	mov    %esi,%eax
+     16d:	88 45 f8             	mov    %al,-0x8(%rbp)
+     170:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     174:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     177:	89 d6                	mov    %edx,%esi
+     179:	89 c7                	mov    %eax,%edi
+     17b:	e8 eb 06 00 00       	call   86b <bputc>
+     180:	90                   	nop
+     181:	c9                   	leave
+     182:	c3                   	ret
+
+0000000000000183 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     183:	55                   	push   %rbp
+     184:	48 89 e5             	mov    %rsp,%rbp
+     187:	48 83 ec 50          	sub    $0x50,%rsp
+     18b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     18e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     192:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     195:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     198:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     19c:	74 21                	je     1bf <printint64+0x3c>
+     19e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1a2:	48 c1 e8 3f          	shr    $0x3f,%rax
+     1a6:	0f b6 c0             	movzbl %al,%eax
+     1a9:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     1ac:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     1b0:	74 0d                	je     1bf <printint64+0x3c>
+    x = -xx;
+     1b2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1b6:	48 f7 d8             	neg    %rax
+     1b9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     1bd:	eb 08                	jmp    1c7 <printint64+0x44>
+  else
+    x = xx;
+     1bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     1c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     1c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     1ce:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     1d1:	48 63 c8             	movslq %eax,%rcx
+     1d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     1d8:	ba 00 00 00 00       	mov    $0x0,%edx
+     1dd:	48 f7 f1             	div    %rcx
+     1e0:	48 89 d1             	mov    %rdx,%rcx
+     1e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e6:	8d 50 01             	lea    0x1(%rax),%edx
+     1e9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1ec:	48 8d 15 0d 2e 00 00 	lea    0x2e0d(%rip),%rdx        # 3000 <digits.1>
+     1f3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     1f7:	48 98                	cltq
+     1f9:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     1fd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     200:	48 63 f0             	movslq %eax,%rsi
+     203:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     207:	ba 00 00 00 00       	mov    $0x0,%edx
+     20c:	48 f7 f6             	div    %rsi
+     20f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     213:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     218:	75 b4                	jne    1ce <printint64+0x4b>
+
+  if (sgn)
+     21a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     21e:	74 2b                	je     24b <printint64+0xc8>
+    buf[i++] = '-';
+     220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     223:	8d 50 01             	lea    0x1(%rax),%edx
+     226:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     229:	48 98                	cltq
+     22b:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     230:	eb 19                	jmp    24b <printint64+0xc8>
+    putc(fd, buf[i]);
+     232:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     235:	48 98                	cltq
+     237:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     23c:	0f be d0             	movsbl %al,%edx
+     23f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     242:	89 d6                	mov    %edx,%esi
+     244:	89 c7                	mov    %eax,%edi
+     246:	e8 15 ff ff ff       	call   160 <putc>
+  while (--i >= 0)
+     24b:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     24f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     253:	79 dd                	jns    232 <printint64+0xaf>
+}
+     255:	90                   	nop
+     256:	90                   	nop
+     257:	c9                   	leave
+     258:	c3                   	ret
+
+0000000000000259 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     259:	55                   	push   %rbp
+     25a:	48 89 e5             	mov    %rsp,%rbp
+     25d:	48 83 ec 30          	sub    $0x30,%rsp
+     261:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     264:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     267:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     26a:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     26d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     274:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     278:	74 17                	je     291 <printint+0x38>
+     27a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     27e:	79 11                	jns    291 <printint+0x38>
+    neg = 1;
+     280:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     287:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     28a:	f7 d8                	neg    %eax
+     28c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     28f:	eb 06                	jmp    297 <printint+0x3e>
+  } else {
+    x = xx;
+     291:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     294:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     297:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     29e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     2a1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2a4:	ba 00 00 00 00       	mov    $0x0,%edx
+     2a9:	f7 f1                	div    %ecx
+     2ab:	89 d1                	mov    %edx,%ecx
+     2ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2b0:	8d 50 01             	lea    0x1(%rax),%edx
+     2b3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2b6:	89 c9                	mov    %ecx,%ecx
+     2b8:	48 8d 15 61 2d 00 00 	lea    0x2d61(%rip),%rdx        # 3020 <digits.0>
+     2bf:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     2c3:	48 98                	cltq
+     2c5:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     2c9:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     2cc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2cf:	ba 00 00 00 00       	mov    $0x0,%edx
+     2d4:	f7 f6                	div    %esi
+     2d6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     2d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     2dd:	75 bf                	jne    29e <printint+0x45>
+  if (neg)
+     2df:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     2e3:	74 2b                	je     310 <printint+0xb7>
+    buf[i++] = '-';
+     2e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2e8:	8d 50 01             	lea    0x1(%rax),%edx
+     2eb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2ee:	48 98                	cltq
+     2f0:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     2f5:	eb 19                	jmp    310 <printint+0xb7>
+    putc(fd, buf[i]);
+     2f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2fa:	48 98                	cltq
+     2fc:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     301:	0f be d0             	movsbl %al,%edx
+     304:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     307:	89 d6                	mov    %edx,%esi
+     309:	89 c7                	mov    %eax,%edi
+     30b:	e8 50 fe ff ff       	call   160 <putc>
+  while (--i >= 0)
+     310:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     314:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     318:	79 dd                	jns    2f7 <printint+0x9e>
+}
+     31a:	90                   	nop
+     31b:	90                   	nop
+     31c:	c9                   	leave
+     31d:	c3                   	ret
+
+000000000000031e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     31e:	55                   	push   %rbp
+     31f:	48 89 e5             	mov    %rsp,%rbp
+     322:	48 83 ec 70          	sub    $0x70,%rsp
+     326:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     329:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     32d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     331:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     335:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     339:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     33d:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     344:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     348:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     34c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     350:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     354:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     35b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     362:	e9 67 02 00 00       	jmp    5ce <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     367:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     36a:	48 63 d0             	movslq %eax,%rdx
+     36d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     371:	48 01 d0             	add    %rdx,%rax
+     374:	0f b6 00             	movzbl (%rax),%eax
+     377:	0f be c0             	movsbl %al,%eax
+     37a:	25 ff 00 00 00       	and    $0xff,%eax
+     37f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     382:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     386:	75 30                	jne    3b8 <printf+0x9a>
+      if (c == '%') {
+     388:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     38c:	75 13                	jne    3a1 <printf+0x83>
+        state = '%';
+     38e:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     395:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     39c:	e9 29 02 00 00       	jmp    5ca <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     3a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     3a4:	0f be d0             	movsbl %al,%edx
+     3a7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3aa:	89 d6                	mov    %edx,%esi
+     3ac:	89 c7                	mov    %eax,%edi
+     3ae:	e8 ad fd ff ff       	call   160 <putc>
+     3b3:	e9 12 02 00 00       	jmp    5ca <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     3b8:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     3bc:	0f 85 08 02 00 00    	jne    5ca <printf+0x2ac>
+      if (c == 'l') {
+     3c2:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     3c6:	75 0c                	jne    3d4 <printf+0xb6>
+        lflag = 1;
+     3c8:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     3cf:	e9 f6 01 00 00       	jmp    5ca <printf+0x2ac>
+      } else if (c == 'd') {
+     3d4:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     3d8:	0f 85 93 00 00 00    	jne    471 <printf+0x153>
+        if (lflag == 1)
+     3de:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     3e2:	75 47                	jne    42b <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     3e4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3e7:	83 f8 2f             	cmp    $0x2f,%eax
+     3ea:	77 17                	ja     403 <printf+0xe5>
+     3ec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3f0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3f3:	89 d2                	mov    %edx,%edx
+     3f5:	48 01 d0             	add    %rdx,%rax
+     3f8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3fb:	83 c2 08             	add    $0x8,%edx
+     3fe:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     401:	eb 0c                	jmp    40f <printf+0xf1>
+     403:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     407:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     40b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     40f:	48 8b 30             	mov    (%rax),%rsi
+     412:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     415:	b9 01 00 00 00       	mov    $0x1,%ecx
+     41a:	ba 0a 00 00 00       	mov    $0xa,%edx
+     41f:	89 c7                	mov    %eax,%edi
+     421:	e8 5d fd ff ff       	call   183 <printint64>
+     426:	e9 98 01 00 00       	jmp    5c3 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     42b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     42e:	83 f8 2f             	cmp    $0x2f,%eax
+     431:	77 17                	ja     44a <printf+0x12c>
+     433:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     437:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     43a:	89 d2                	mov    %edx,%edx
+     43c:	48 01 d0             	add    %rdx,%rax
+     43f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     442:	83 c2 08             	add    $0x8,%edx
+     445:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     448:	eb 0c                	jmp    456 <printf+0x138>
+     44a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     44e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     452:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     456:	8b 30                	mov    (%rax),%esi
+     458:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     45b:	b9 01 00 00 00       	mov    $0x1,%ecx
+     460:	ba 0a 00 00 00       	mov    $0xa,%edx
+     465:	89 c7                	mov    %eax,%edi
+     467:	e8 ed fd ff ff       	call   259 <printint>
+     46c:	e9 52 01 00 00       	jmp    5c3 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     471:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     475:	74 0a                	je     481 <printf+0x163>
+     477:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     47b:	0f 85 93 00 00 00    	jne    514 <printf+0x1f6>
+        if (lflag == 1)
+     481:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     485:	75 47                	jne    4ce <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     487:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     48a:	83 f8 2f             	cmp    $0x2f,%eax
+     48d:	77 17                	ja     4a6 <printf+0x188>
+     48f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     493:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     496:	89 d2                	mov    %edx,%edx
+     498:	48 01 d0             	add    %rdx,%rax
+     49b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     49e:	83 c2 08             	add    $0x8,%edx
+     4a1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4a4:	eb 0c                	jmp    4b2 <printf+0x194>
+     4a6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4aa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4ae:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4b2:	48 8b 30             	mov    (%rax),%rsi
+     4b5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+     4bd:	ba 10 00 00 00       	mov    $0x10,%edx
+     4c2:	89 c7                	mov    %eax,%edi
+     4c4:	e8 ba fc ff ff       	call   183 <printint64>
+        if (lflag == 1)
+     4c9:	e9 f5 00 00 00       	jmp    5c3 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     4ce:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4d1:	83 f8 2f             	cmp    $0x2f,%eax
+     4d4:	77 17                	ja     4ed <printf+0x1cf>
+     4d6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4da:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4dd:	89 d2                	mov    %edx,%edx
+     4df:	48 01 d0             	add    %rdx,%rax
+     4e2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4e5:	83 c2 08             	add    $0x8,%edx
+     4e8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4eb:	eb 0c                	jmp    4f9 <printf+0x1db>
+     4ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4f1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4f5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4f9:	8b 30                	mov    (%rax),%esi
+     4fb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+     503:	ba 10 00 00 00       	mov    $0x10,%edx
+     508:	89 c7                	mov    %eax,%edi
+     50a:	e8 4a fd ff ff       	call   259 <printint>
+        if (lflag == 1)
+     50f:	e9 af 00 00 00       	jmp    5c3 <printf+0x2a5>
+      } else if (c == 's') {
+     514:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     518:	75 6e                	jne    588 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     51a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     51d:	83 f8 2f             	cmp    $0x2f,%eax
+     520:	77 17                	ja     539 <printf+0x21b>
+     522:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     526:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     529:	89 d2                	mov    %edx,%edx
+     52b:	48 01 d0             	add    %rdx,%rax
+     52e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     531:	83 c2 08             	add    $0x8,%edx
+     534:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     537:	eb 0c                	jmp    545 <printf+0x227>
+     539:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     53d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     541:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     545:	48 8b 00             	mov    (%rax),%rax
+     548:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     54c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     551:	75 28                	jne    57b <printf+0x25d>
+          s = "(null)";
+     553:	48 8d 05 f9 19 00 00 	lea    0x19f9(%rip),%rax        # 1f53 <benchreport+0x168>
+     55a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     55e:	eb 1b                	jmp    57b <printf+0x25d>
+          putc(fd, *s);
+     560:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     564:	0f b6 00             	movzbl (%rax),%eax
+     567:	0f be d0             	movsbl %al,%edx
+     56a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     56d:	89 d6                	mov    %edx,%esi
+     56f:	89 c7                	mov    %eax,%edi
+     571:	e8 ea fb ff ff       	call   160 <putc>
+        for (; *s; s++)
+     576:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     57b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     57f:	0f b6 00             	movzbl (%rax),%eax
+     582:	84 c0                	test   %al,%al
+     584:	75 da                	jne    560 <printf+0x242>
+     586:	eb 3b                	jmp    5c3 <printf+0x2a5>
+      } else if (c == '%') {
+     588:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     58c:	75 14                	jne    5a2 <printf+0x284>
+        putc(fd, c);
+     58e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     591:	0f be d0             	movsbl %al,%edx
+     594:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     597:	89 d6                	mov    %edx,%esi
+     599:	89 c7                	mov    %eax,%edi
+     59b:	e8 c0 fb ff ff       	call   160 <putc>
+     5a0:	eb 21                	jmp    5c3 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     5a2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5a5:	be 25 00 00 00       	mov    $0x25,%esi
+     5aa:	89 c7                	mov    %eax,%edi
+     5ac:	e8 af fb ff ff       	call   160 <putc>
+        putc(fd, c);
+     5b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     5b4:	0f be d0             	movsbl %al,%edx
+     5b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5ba:	89 d6                	mov    %edx,%esi
+     5bc:	89 c7                	mov    %eax,%edi
+     5be:	e8 9d fb ff ff       	call   160 <putc>
+      }
+      state = 0;
+     5c3:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     5ca:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     5ce:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     5d1:	48 63 d0             	movslq %eax,%rdx
+     5d4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     5d8:	48 01 d0             	add    %rdx,%rax
+     5db:	0f b6 00             	movzbl (%rax),%eax
+     5de:	84 c0                	test   %al,%al
+     5e0:	0f 85 81 fd ff ff    	jne    367 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     5e6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     5e9:	89 c7                	mov    %eax,%edi
+     5eb:	e8 ee 02 00 00       	call   8de <bflushtty>
+}
+     5f0:	90                   	nop
+     5f1:	c9                   	leave
+     5f2:	c3                   	ret
+
+00000000000005f3 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     5f3:	55                   	push   %rbp
+     5f4:	48 89 e5             	mov    %rsp,%rbp
+     5f7:	48 83 ec 30          	sub    $0x30,%rsp
+     5fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     5fe:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     602:	78 06                	js     60a <getbuf+0x17>
+     604:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     608:	7e 0a                	jle    614 <getbuf+0x21>
+    return 0;
+     60a:	b8 00 00 00 00       	mov    $0x0,%eax
+     60f:	e9 94 00 00 00       	jmp    6a8 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     614:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     617:	48 98                	cltq
+     619:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     620:	00 
+     621:	48 8d 05 18 2a 00 00 	lea    0x2a18(%rip),%rax        # 3040 <obufs>
+     628:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     62c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     630:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     635:	75 6d                	jne    6a4 <getbuf+0xb1>
+     637:	bf 08 02 00 00       	mov    $0x208,%edi
+     63c:	e8 bd 13 00 00       	call   19fe <malloc>
+     641:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     645:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     64a:	74 58                	je     6a4 <getbuf+0xb1>
+    b->n = 0;
+     64c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     650:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     656:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     65a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     65d:	48 89 d6             	mov    %rdx,%rsi
+     660:	89 c7                	mov    %eax,%edi
+     662:	e8 e4 0d 00 00       	call   144b <fstat>
+     667:	85 c0                	test   %eax,%eax
+     669:	75 11                	jne    67c <getbuf+0x89>
+     66b:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     66f:	66 83 f8 03          	cmp    $0x3,%ax
+     673:	75 07                	jne    67c <getbuf+0x89>
+     675:	ba 01 00 00 00       	mov    $0x1,%edx
+     67a:	eb 05                	jmp    681 <getbuf+0x8e>
+     67c:	ba 00 00 00 00       	mov    $0x0,%edx
+     681:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     685:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     688:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     68b:	48 98                	cltq
+     68d:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     694:	00 
+     695:	48 8d 15 a4 29 00 00 	lea    0x29a4(%rip),%rdx        # 3040 <obufs>
+     69c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6a0:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     6a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     6a8:	c9                   	leave
+     6a9:	c3                   	ret
+
+00000000000006aa <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     6aa:	55                   	push   %rbp
+     6ab:	48 89 e5             	mov    %rsp,%rbp
+     6ae:	48 83 ec 20          	sub    $0x20,%rsp
+     6b2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     6b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     6b9:	78 33                	js     6ee <bflush+0x44>
+     6bb:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     6bf:	7f 2d                	jg     6ee <bflush+0x44>
+     6c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6c4:	48 98                	cltq
+     6c6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     6cd:	00 
+     6ce:	48 8d 05 6b 29 00 00 	lea    0x296b(%rip),%rax        # 3040 <obufs>
+     6d5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     6d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6dd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6e2:	74 0a                	je     6ee <bflush+0x44>
+     6e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6e8:	8b 00                	mov    (%rax),%eax
+     6ea:	85 c0                	test   %eax,%eax
+     6ec:	75 07                	jne    6f5 <bflush+0x4b>
+    return 0;
+     6ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f3:	eb 3c                	jmp    731 <bflush+0x87>
+  n = b->n;
+     6f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6f9:	8b 00                	mov    (%rax),%eax
+     6fb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     6fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     702:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     70c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     710:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     713:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     716:	48 89 ce             	mov    %rcx,%rsi
+     719:	89 c7                	mov    %eax,%edi
+     71b:	e8 de 0c 00 00       	call   13fe <write>
+     720:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     723:	75 07                	jne    72c <bflush+0x82>
+     725:	b8 00 00 00 00       	mov    $0x0,%eax
+     72a:	eb 05                	jmp    731 <bflush+0x87>
+     72c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     731:	c9                   	leave
+     732:	c3                   	ret
+
+0000000000000733 <bflushall>:
+
+void bflushall(void) {
+     733:	55                   	push   %rbp
+     734:	48 89 e5             	mov    %rsp,%rbp
+     737:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     73b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     742:	eb 0e                	jmp    752 <bflushall+0x1f>
+    bflush(fd);
+     744:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     747:	89 c7                	mov    %eax,%edi
+     749:	e8 5c ff ff ff       	call   6aa <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     74e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     752:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     756:	7e ec                	jle    744 <bflushall+0x11>
+}
+     758:	90                   	nop
+     759:	90                   	nop
+     75a:	c9                   	leave
+     75b:	c3                   	ret
+
+000000000000075c <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     75c:	55                   	push   %rbp
+     75d:	48 89 e5             	mov    %rsp,%rbp
+     760:	48 83 ec 30          	sub    $0x30,%rsp
+     764:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     767:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     76b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     76e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     771:	89 c7                	mov    %eax,%edi
+     773:	e8 7b fe ff ff       	call   5f3 <getbuf>
+     778:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     77c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     781:	75 19                	jne    79c <bwrite+0x40>
+    return write(fd, s, n);
+     783:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     786:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     78a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     78d:	48 89 ce             	mov    %rcx,%rsi
+     790:	89 c7                	mov    %eax,%edi
+     792:	e8 67 0c 00 00       	call   13fe <write>
+     797:	e9 cd 00 00 00       	jmp    869 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     79c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7a3:	e9 92 00 00 00       	jmp    83a <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     7a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7ac:	8b 00                	mov    (%rax),%eax
+     7ae:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7b3:	75 18                	jne    7cd <bwrite+0x71>
+     7b5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     7b8:	89 c7                	mov    %eax,%edi
+     7ba:	e8 eb fe ff ff       	call   6aa <bflush>
+     7bf:	85 c0                	test   %eax,%eax
+     7c1:	79 0a                	jns    7cd <bwrite+0x71>
+      return -1;
+     7c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7c8:	e9 9c 00 00 00       	jmp    869 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     7cd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7d0:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     7d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     7d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7da:	8b 00                	mov    (%rax),%eax
+     7dc:	ba 00 02 00 00       	mov    $0x200,%edx
+     7e1:	29 c2                	sub    %eax,%edx
+     7e3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     7e6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     7e9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     7ec:	39 c2                	cmp    %eax,%edx
+     7ee:	0f 4e c2             	cmovle %edx,%eax
+     7f1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     7f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7f7:	48 63 d0             	movslq %eax,%rdx
+     7fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     7fe:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     802:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     806:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     80a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     80e:	8b 00                	mov    (%rax),%eax
+     810:	48 98                	cltq
+     812:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     816:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     819:	89 c2                	mov    %eax,%edx
+     81b:	48 89 cf             	mov    %rcx,%rdi
+     81e:	e8 e9 06 00 00       	call   f0c <memmove>
+    b->n += m;
+     823:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     827:	8b 10                	mov    (%rax),%edx
+     829:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     82c:	01 c2                	add    %eax,%edx
+     82e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     832:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     834:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     837:	01 45 fc             	add    %eax,-0x4(%rbp)
+     83a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     83d:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     840:	0f 8c 62 ff ff ff    	jl     7a8 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     846:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     84a:	8b 40 04             	mov    0x4(%rax),%eax
+     84d:	85 c0                	test   %eax,%eax
+     84f:	74 15                	je     866 <bwrite+0x10a>
+     851:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     854:	89 c7                	mov    %eax,%edi
+     856:	e8 4f fe ff ff       	call   6aa <bflush>
+     85b:	85 c0                	test   %eax,%eax
+     85d:	79 07                	jns    866 <bwrite+0x10a>
+    return -1;
+     85f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     864:	eb 03                	jmp    869 <bwrite+0x10d>
+  return n;
+     866:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     869:	c9                   	leave
+     86a:	c3                   	ret
+
+000000000000086b <bputc>:
+
+void bputc(int fd, char c) {
+     86b:	55                   	push   %rbp
+     86c:	48 89 e5             	mov    %rsp,%rbp
+     86f:	48 83 ec 20          	sub    $0x20,%rsp
+     873:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     876:	89 f0                	mov    %esi,%eax
+     878:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     87b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     87e:	89 c7                	mov    %eax,%edi
+     880:	e8 6e fd ff ff       	call   5f3 <getbuf>
+     885:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     889:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     88e:	75 18                	jne    8a8 <bputc+0x3d>
+    write(fd, &c, 1);
+     890:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     894:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     897:	ba 01 00 00 00       	mov    $0x1,%edx
+     89c:	48 89 ce             	mov    %rcx,%rsi
+     89f:	89 c7                	mov    %eax,%edi
+     8a1:	e8 58 0b 00 00       	call   13fe <write>
+    return;
+     8a6:	eb 34                	jmp    8dc <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     8a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8ac:	8b 00                	mov    (%rax),%eax
+     8ae:	3d 00 02 00 00       	cmp    $0x200,%eax
+     8b3:	75 0a                	jne    8bf <bputc+0x54>
+    bflush(fd);
+     8b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     8b8:	89 c7                	mov    %eax,%edi
+     8ba:	e8 eb fd ff ff       	call   6aa <bflush>
+  b->data[b->n++] = c;
+     8bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8c3:	8b 00                	mov    (%rax),%eax
+     8c5:	8d 48 01             	lea    0x1(%rax),%ecx
+     8c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8cc:	89 0a                	mov    %ecx,(%rdx)
+     8ce:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     8d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     8d6:	48 98                	cltq
+     8d8:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     8dc:	c9                   	leave
+     8dd:	c3                   	ret
+
+00000000000008de <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     8de:	55                   	push   %rbp
+     8df:	48 89 e5             	mov    %rsp,%rbp
+     8e2:	48 83 ec 10          	sub    $0x10,%rsp
+     8e6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     8e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8ed:	78 4c                	js     93b <bflushtty+0x5d>
+     8ef:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     8f3:	7f 46                	jg     93b <bflushtty+0x5d>
+     8f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8f8:	48 98                	cltq
+     8fa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     901:	00 
+     902:	48 8d 05 37 27 00 00 	lea    0x2737(%rip),%rax        # 3040 <obufs>
+     909:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     90d:	48 85 c0             	test   %rax,%rax
+     910:	74 29                	je     93b <bflushtty+0x5d>
+     912:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     915:	48 98                	cltq
+     917:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     91e:	00 
+     91f:	48 8d 05 1a 27 00 00 	lea    0x271a(%rip),%rax        # 3040 <obufs>
+     926:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     92a:	8b 40 04             	mov    0x4(%rax),%eax
+     92d:	85 c0                	test   %eax,%eax
+     92f:	74 0a                	je     93b <bflushtty+0x5d>
+    bflush(fd);
+     931:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     934:	89 c7                	mov    %eax,%edi
+     936:	e8 6f fd ff ff       	call   6aa <bflush>
+}
+     93b:	90                   	nop
+     93c:	c9                   	leave
+     93d:	c3                   	ret
+
+000000000000093e <fork>:
+
+int fork(void) {
+     93e:	55                   	push   %rbp
+     93f:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     942:	e8 ec fd ff ff       	call   733 <bflushall>
+  return _fork();
+     947:	e8 7b 0a 00 00       	call   13c7 <_fork>
+}
+     94c:	5d                   	pop    %rbp
+     94d:	c3                   	ret
+
+000000000000094e <exit>:
+
+noreturn void exit(void) {
+     94e:	55                   	push   %rbp
+     94f:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     952:	e8 dc fd ff ff       	call   733 <bflushall>
+  _exit();
+     957:	e8 76 0a 00 00       	call   13d2 <_exit>
+
+000000000000095c <exec>:
+}
+
+int exec(char *path, char **argv) {
+     95c:	55                   	push   %rbp
+     95d:	48 89 e5             	mov    %rsp,%rbp
+     960:	48 83 ec 10          	sub    $0x10,%rsp
+     964:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     968:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     96c:	e8 c2 fd ff ff       	call   733 <bflushall>
+  return _exec(path, argv);
+     971:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     975:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     979:	48 89 d6             	mov    %rdx,%rsi
+     97c:	48 89 c7             	mov    %rax,%rdi
+     97f:	e8 9b 0a 00 00       	call   141f <_exec>
+}
+     984:	c9                   	leave
+     985:	c3                   	ret
+
+0000000000000986 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     986:	55                   	push   %rbp
+     987:	48 89 e5             	mov    %rsp,%rbp
+     98a:	48 83 ec 20          	sub    $0x20,%rsp
+     98e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     992:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     996:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     99a:	e8 94 fd ff ff       	call   733 <bflushall>
+  return _spawn(path, argv, fds);
+     99f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     9a3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     9a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9ab:	48 89 ce             	mov    %rcx,%rsi
+     9ae:	48 89 c7             	mov    %rax,%rdi
+     9b1:	e8 2f 0b 00 00       	call   14e5 <_spawn>
+}
+     9b6:	c9                   	leave
+     9b7:	c3                   	ret
+
+00000000000009b8 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     9b8:	55                   	push   %rbp
+     9b9:	48 89 e5             	mov    %rsp,%rbp
+     9bc:	48 83 ec 10          	sub    $0x10,%rsp
+     9c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     9c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     9c7:	78 69                	js     a32 <close+0x7a>
+     9c9:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     9cd:	7f 63                	jg     a32 <close+0x7a>
+     9cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d2:	48 98                	cltq
+     9d4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     9db:	00 
+     9dc:	48 8d 05 5d 26 00 00 	lea    0x265d(%rip),%rax        # 3040 <obufs>
+     9e3:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9e7:	48 85 c0             	test   %rax,%rax
+     9ea:	74 46                	je     a32 <close+0x7a>
+    bflush(fd);
+     9ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9ef:	89 c7                	mov    %eax,%edi
+     9f1:	e8 b4 fc ff ff       	call   6aa <bflush>
+    free(obufs[fd]);
+     9f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9f9:	48 98                	cltq
+     9fb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a02:	00 
+     a03:	48 8d 05 36 26 00 00 	lea    0x2636(%rip),%rax        # 3040 <obufs>
+     a0a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a0e:	48 89 c7             	mov    %rax,%rdi
+     a11:	e8 90 11 00 00       	call   1ba6 <free>
+    obufs[fd] = 0;
+     a16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a19:	48 98                	cltq
+     a1b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a22:	00 
+     a23:	48 8d 05 16 26 00 00 	lea    0x2616(%rip),%rax        # 3040 <obufs>
+     a2a:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     a31:	00 
+  }
+  return _close(fd);
+     a32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a35:	89 c7                	mov    %eax,%edi
+     a37:	e8 cd 09 00 00       	call   1409 <_close>
+}
+     a3c:	c9                   	leave
+     a3d:	c3                   	ret
+
+0000000000000a3e <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     a3e:	55                   	push   %rbp
+     a3f:	48 89 e5             	mov    %rsp,%rbp
+     a42:	53                   	push   %rbx
+     a43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     a47:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     a4b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     a4f:	48 8b 36             	mov    (%rsi),%rsi
+     a52:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     a56:	48 29 f7             	sub    %rsi,%rdi
+     a59:	48 89 f9             	mov    %rdi,%rcx
+     a5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+     a61:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     a65:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     a69:	48 89 f0             	mov    %rsi,%rax
+     a6c:	ba 00 00 00 00       	mov    $0x0,%edx
+     a71:	48 89 df             	mov    %rbx,%rdi
+     a74:	48 0f af f8          	imul   %rax,%rdi
+     a78:	48 89 d6             	mov    %rdx,%rsi
+     a7b:	48 0f af f1          	imul   %rcx,%rsi
+     a7f:	48 01 fe             	add    %rdi,%rsi
+     a82:	48 f7 e1             	mul    %rcx
+     a85:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     a89:	48 89 ca             	mov    %rcx,%rdx
+     a8c:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     a91:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     a95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     a99:	c9                   	leave
+     a9a:	c3                   	ret
+
+0000000000000a9b <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     a9b:	55                   	push   %rbp
+     a9c:	48 89 e5             	mov    %rsp,%rbp
+     a9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     aa3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     aa6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     aa9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     aad:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     ab0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ab3:	48 89 ce             	mov    %rcx,%rsi
+     ab6:	48 89 f7             	mov    %rsi,%rdi
+     ab9:	89 d1                	mov    %edx,%ecx
+     abb:	fc                   	cld
+     abc:	f3 aa                	rep stos %al,%es:(%rdi)
+     abe:	89 ca                	mov    %ecx,%edx
+     ac0:	48 89 fe             	mov    %rdi,%rsi
+     ac3:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     ac7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     aca:	90                   	nop
+     acb:	5d                   	pop    %rbp
+     acc:	c3                   	ret
+
+0000000000000acd <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     acd:	55                   	push   %rbp
+     ace:	48 89 e5             	mov    %rsp,%rbp
+     ad1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ad5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     ad9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     add:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ae1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     ae5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ae9:	48 89 ce             	mov    %rcx,%rsi
+     aec:	48 89 f7             	mov    %rsi,%rdi
+     aef:	48 89 d1             	mov    %rdx,%rcx
+     af2:	fc                   	cld
+     af3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     af6:	48 89 ca             	mov    %rcx,%rdx
+     af9:	48 89 fe             	mov    %rdi,%rsi
+     afc:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b00:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b04:	90                   	nop
+     b05:	5d                   	pop    %rbp
+     b06:	c3                   	ret
+
+0000000000000b07 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     b07:	55                   	push   %rbp
+     b08:	48 89 e5             	mov    %rsp,%rbp
+     b0b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b0f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b13:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     b17:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b1b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b23:	48 89 cf             	mov    %rcx,%rdi
+     b26:	48 89 d6             	mov    %rdx,%rsi
+     b29:	48 89 c1             	mov    %rax,%rcx
+     b2c:	fc                   	cld
+     b2d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     b2f:	48 89 c8             	mov    %rcx,%rax
+     b32:	48 89 f2             	mov    %rsi,%rdx
+     b35:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b39:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     b3d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     b41:	90                   	nop
+     b42:	5d                   	pop    %rbp
+     b43:	c3                   	ret
+
+0000000000000b44 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     b44:	55                   	push   %rbp
+     b45:	48 89 e5             	mov    %rsp,%rbp
+     b48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b4c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b50:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     b54:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b58:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     b5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b60:	48 89 cf             	mov    %rcx,%rdi
+     b63:	48 89 d6             	mov    %rdx,%rsi
+     b66:	48 89 c1             	mov    %rax,%rcx
+     b69:	fc                   	cld
+     b6a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     b6d:	48 89 c8             	mov    %rcx,%rax
+     b70:	48 89 f2             	mov    %rsi,%rdx
+     b73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b77:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     b7b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     b7f:	90                   	nop
+     b80:	5d                   	pop    %rbp
+     b81:	c3                   	ret
+
+0000000000000b82 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     b82:	55                   	push   %rbp
+     b83:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     b86:	0f 31                	rdtsc
+     b88:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     b8b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     b8e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b91:	48 c1 e0 20          	shl    $0x20,%rax
+     b95:	48 89 c2             	mov    %rax,%rdx
+     b98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b9b:	48 09 d0             	or     %rdx,%rax
+}
+     b9e:	5d                   	pop    %rbp
+     b9f:	c3                   	ret
+
+0000000000000ba0 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     ba0:	55                   	push   %rbp
+     ba1:	48 89 e5             	mov    %rsp,%rbp
+     ba4:	53                   	push   %rbx
+     ba5:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     ba8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     bac:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     bb0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     bb4:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     bb8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     bbb:	0f a2                	cpuid
+     bbd:	89 de                	mov    %ebx,%esi
+     bbf:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     bc2:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     bc5:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     bc8:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     bcb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     bd0:	74 09                	je     bdb <cpuid+0x3b>
+    *eaxp = eax;
+     bd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     bd6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     bd9:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     bdb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     be0:	74 09                	je     beb <cpuid+0x4b>
+    *ebxp = ebx;
+     be2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     be6:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     be9:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     beb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     bf0:	74 09                	je     bfb <cpuid+0x5b>
+    *ecxp = ecx;
+     bf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     bf6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     bf9:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     bfb:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     c00:	74 09                	je     c0b <cpuid+0x6b>
+    *edxp = edx;
+     c02:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     c06:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     c09:	89 10                	mov    %edx,(%rax)
+}
+     c0b:	90                   	nop
+     c0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     c10:	c9                   	leave
+     c11:	c3                   	ret
+
+0000000000000c12 <strcpy>:
+char *strcpy(char *s, char *t) {
+     c12:	55                   	push   %rbp
+     c13:	48 89 e5             	mov    %rsp,%rbp
+     c16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c1a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     c1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c22:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     c26:	90                   	nop
+     c27:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c2b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     c2f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     c33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c37:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     c3b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     c3f:	0f b6 12             	movzbl (%rdx),%edx
+     c42:	88 10                	mov    %dl,(%rax)
+     c44:	0f b6 00             	movzbl (%rax),%eax
+     c47:	84 c0                	test   %al,%al
+     c49:	75 dc                	jne    c27 <strcpy+0x15>
+  return os;
+     c4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c4f:	5d                   	pop    %rbp
+     c50:	c3                   	ret
+
+0000000000000c51 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     c51:	55                   	push   %rbp
+     c52:	48 89 e5             	mov    %rsp,%rbp
+     c55:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c59:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     c5d:	eb 0a                	jmp    c69 <strcmp+0x18>
+    p++, q++;
+     c5f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     c64:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     c69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c6d:	0f b6 00             	movzbl (%rax),%eax
+     c70:	84 c0                	test   %al,%al
+     c72:	74 12                	je     c86 <strcmp+0x35>
+     c74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c78:	0f b6 10             	movzbl (%rax),%edx
+     c7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c7f:	0f b6 00             	movzbl (%rax),%eax
+     c82:	38 c2                	cmp    %al,%dl
+     c84:	74 d9                	je     c5f <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     c86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c8a:	0f b6 00             	movzbl (%rax),%eax
+     c8d:	0f b6 d0             	movzbl %al,%edx
+     c90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c94:	0f b6 00             	movzbl (%rax),%eax
+     c97:	0f b6 c0             	movzbl %al,%eax
+     c9a:	29 c2                	sub    %eax,%edx
+     c9c:	89 d0                	mov    %edx,%eax
+}
+     c9e:	5d                   	pop    %rbp
+     c9f:	c3                   	ret
+
+0000000000000ca0 <strlen>:
+uint strlen(char *s) {
+     ca0:	55                   	push   %rbp
+     ca1:	48 89 e5             	mov    %rsp,%rbp
+     ca4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     ca8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     caf:	eb 04                	jmp    cb5 <strlen+0x15>
+     cb1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     cb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cb8:	48 63 d0             	movslq %eax,%rdx
+     cbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cbf:	48 01 d0             	add    %rdx,%rax
+     cc2:	0f b6 00             	movzbl (%rax),%eax
+     cc5:	84 c0                	test   %al,%al
+     cc7:	75 e8                	jne    cb1 <strlen+0x11>
+    ;
+  return n;
+     cc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     ccc:	5d                   	pop    %rbp
+     ccd:	c3                   	ret
+
+0000000000000cce <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     cce:	55                   	push   %rbp
+     ccf:	48 89 e5             	mov    %rsp,%rbp
+     cd2:	53                   	push   %rbx
+     cd3:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     cd7:	8b 05 57 23 00 00    	mov    0x2357(%rip),%eax        # 3034 <erms>
+     cdd:	85 c0                	test   %eax,%eax
+     cdf:	79 53                	jns    d34 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     ce1:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     ce5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     ceb:	b9 00 00 00 00       	mov    $0x0,%ecx
+     cf0:	ba 00 00 00 00       	mov    $0x0,%edx
+     cf5:	48 89 c6             	mov    %rax,%rsi
+     cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+     cfd:	e8 9e fe ff ff       	call   ba0 <cpuid>
+    ebx = 0;
+     d02:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     d09:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d0c:	83 f8 06             	cmp    $0x6,%eax
+     d0f:	76 14                	jbe    d25 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     d11:	b8 07 00 00 00       	mov    $0x7,%eax
+     d16:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d1b:	0f a2                	cpuid
+     d1d:	89 d9                	mov    %ebx,%ecx
+     d1f:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     d22:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     d25:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d28:	c1 e8 09             	shr    $0x9,%eax
+     d2b:	83 e0 01             	and    $0x1,%eax
+     d2e:	89 05 00 23 00 00    	mov    %eax,0x2300(%rip)        # 3034 <erms>
+  }
+  return erms;
+     d34:	8b 05 fa 22 00 00    	mov    0x22fa(%rip),%eax        # 3034 <erms>
+}
+     d3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     d3e:	c9                   	leave
+     d3f:	c3                   	ret
+
+0000000000000d40 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     d40:	55                   	push   %rbp
+     d41:	48 89 e5             	mov    %rsp,%rbp
+     d44:	48 83 ec 10          	sub    $0x10,%rsp
+     d48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d4c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     d4f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     d52:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     d56:	76 09                	jbe    d61 <memset+0x21>
+     d58:	e8 71 ff ff ff       	call   cce <haserms>
+     d5d:	85 c0                	test   %eax,%eax
+     d5f:	74 16                	je     d77 <memset+0x37>
+    stosb(dst, c, n);
+     d61:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     d64:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     d67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d6b:	89 ce                	mov    %ecx,%esi
+     d6d:	48 89 c7             	mov    %rax,%rdi
+     d70:	e8 26 fd ff ff       	call   a9b <stosb>
+     d75:	eb 58                	jmp    dcf <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     d77:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d7a:	c1 e8 03             	shr    $0x3,%eax
+     d7d:	89 c6                	mov    %eax,%esi
+     d7f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d82:	48 98                	cltq
+     d84:	0f b6 c0             	movzbl %al,%eax
+     d87:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     d8e:	01 01 01 
+     d91:	48 0f af c2          	imul   %rdx,%rax
+     d95:	48 89 c1             	mov    %rax,%rcx
+     d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d9c:	48 89 f2             	mov    %rsi,%rdx
+     d9f:	48 89 ce             	mov    %rcx,%rsi
+     da2:	48 89 c7             	mov    %rax,%rdi
+     da5:	e8 23 fd ff ff       	call   acd <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     daa:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     dad:	83 e0 07             	and    $0x7,%eax
+     db0:	89 c2                	mov    %eax,%edx
+     db2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     db5:	83 e0 f8             	and    $0xfffffff8,%eax
+     db8:	48 89 c1             	mov    %rax,%rcx
+     dbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dbf:	48 01 c1             	add    %rax,%rcx
+     dc2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     dc5:	89 c6                	mov    %eax,%esi
+     dc7:	48 89 cf             	mov    %rcx,%rdi
+     dca:	e8 cc fc ff ff       	call   a9b <stosb>
+  }
+  return dst;
+     dcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     dd3:	c9                   	leave
+     dd4:	c3                   	ret
+
+0000000000000dd5 <strchr>:
+
+char *strchr(const char *s, char c) {
+     dd5:	55                   	push   %rbp
+     dd6:	48 89 e5             	mov    %rsp,%rbp
+     dd9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ddd:	89 f0                	mov    %esi,%eax
+     ddf:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     de2:	eb 17                	jmp    dfb <strchr+0x26>
+    if (*s == c)
+     de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de8:	0f b6 00             	movzbl (%rax),%eax
+     deb:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     dee:	75 06                	jne    df6 <strchr+0x21>
+      return (char *)s;
+     df0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     df4:	eb 15                	jmp    e0b <strchr+0x36>
+  for (; *s; s++)
+     df6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     dfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dff:	0f b6 00             	movzbl (%rax),%eax
+     e02:	84 c0                	test   %al,%al
+     e04:	75 de                	jne    de4 <strchr+0xf>
+  return 0;
+     e06:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e0b:	5d                   	pop    %rbp
+     e0c:	c3                   	ret
+
+0000000000000e0d <gets>:
+
+char *gets(char *buf, int max) {
+     e0d:	55                   	push   %rbp
+     e0e:	48 89 e5             	mov    %rsp,%rbp
+     e11:	48 83 ec 20          	sub    $0x20,%rsp
+     e15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e19:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     e1c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     e23:	eb 48                	jmp    e6d <gets+0x60>
+    cc = read(0, &c, 1);
+     e25:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     e29:	ba 01 00 00 00       	mov    $0x1,%edx
+     e2e:	48 89 c6             	mov    %rax,%rsi
+     e31:	bf 00 00 00 00       	mov    $0x0,%edi
+     e36:	e8 b8 05 00 00       	call   13f3 <read>
+     e3b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     e3e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e42:	7e 36                	jle    e7a <gets+0x6d>
+      break;
+    buf[i++] = c;
+     e44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e47:	8d 50 01             	lea    0x1(%rax),%edx
+     e4a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e4d:	48 63 d0             	movslq %eax,%rdx
+     e50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e54:	48 01 c2             	add    %rax,%rdx
+     e57:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e5b:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     e5d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e61:	3c 0a                	cmp    $0xa,%al
+     e63:	74 16                	je     e7b <gets+0x6e>
+     e65:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     e69:	3c 0d                	cmp    $0xd,%al
+     e6b:	74 0e                	je     e7b <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     e6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e70:	83 c0 01             	add    $0x1,%eax
+     e73:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     e76:	7f ad                	jg     e25 <gets+0x18>
+     e78:	eb 01                	jmp    e7b <gets+0x6e>
+      break;
+     e7a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     e7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e7e:	48 63 d0             	movslq %eax,%rdx
+     e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e85:	48 01 d0             	add    %rdx,%rax
+     e88:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     e8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     e8f:	c9                   	leave
+     e90:	c3                   	ret
+
+0000000000000e91 <stat>:
+
+int stat(char *n, struct stat *st) {
+     e91:	55                   	push   %rbp
+     e92:	48 89 e5             	mov    %rsp,%rbp
+     e95:	48 83 ec 10          	sub    $0x10,%rsp
+     e99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e9d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     ea1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ea5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ea9:	48 89 c6             	mov    %rax,%rsi
+     eac:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     eb1:	e8 58 07 00 00       	call   160e <fstatat>
+}
+     eb6:	c9                   	leave
+     eb7:	c3                   	ret
+
+0000000000000eb8 <atoi>:
+
+int atoi(const char *s) {
+     eb8:	55                   	push   %rbp
+     eb9:	48 89 e5             	mov    %rsp,%rbp
+     ebc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     ec0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     ec7:	eb 28                	jmp    ef1 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     ec9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     ecc:	89 d0                	mov    %edx,%eax
+     ece:	c1 e0 02             	shl    $0x2,%eax
+     ed1:	01 d0                	add    %edx,%eax
+     ed3:	01 c0                	add    %eax,%eax
+     ed5:	89 c1                	mov    %eax,%ecx
+     ed7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     edb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     edf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     ee3:	0f b6 00             	movzbl (%rax),%eax
+     ee6:	0f be c0             	movsbl %al,%eax
+     ee9:	01 c8                	add    %ecx,%eax
+     eeb:	83 e8 30             	sub    $0x30,%eax
+     eee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     ef1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ef5:	0f b6 00             	movzbl (%rax),%eax
+     ef8:	3c 2f                	cmp    $0x2f,%al
+     efa:	7e 0b                	jle    f07 <atoi+0x4f>
+     efc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f00:	0f b6 00             	movzbl (%rax),%eax
+     f03:	3c 39                	cmp    $0x39,%al
+     f05:	7e c2                	jle    ec9 <atoi+0x11>
+  return n;
+     f07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     f0a:	5d                   	pop    %rbp
+     f0b:	c3                   	ret
+
+0000000000000f0c <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     f0c:	55                   	push   %rbp
+     f0d:	48 89 e5             	mov    %rsp,%rbp
+     f10:	48 83 ec 28          	sub    $0x28,%rsp
+     f14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     f18:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     f1c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     f1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     f27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     f2b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     f2f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     f33:	7f 09                	jg     f3e <memmove+0x32>
+    return vdst;
+     f35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f39:	e9 29 01 00 00       	jmp    1067 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     f3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f42:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     f46:	0f 83 87 00 00 00    	jae    fd3 <memmove+0xc7>
+     f4c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f4f:	48 63 d0             	movslq %eax,%rdx
+     f52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f56:	48 01 d0             	add    %rdx,%rax
+     f59:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     f5d:	73 74                	jae    fd3 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     f5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f62:	48 98                	cltq
+     f64:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     f68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f6b:	48 98                	cltq
+     f6d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     f71:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f79:	48 09 d0             	or     %rdx,%rax
+     f7c:	83 e0 07             	and    $0x7,%eax
+     f7f:	48 85 c0             	test   %rax,%rax
+     f82:	75 3d                	jne    fc1 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     f84:	eb 1c                	jmp    fa2 <memmove+0x96>
+        src -= 8;
+     f86:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     f8b:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     f90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f94:	48 8b 10             	mov    (%rax),%rdx
+     f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f9b:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     f9e:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     fa2:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     fa6:	7f de                	jg     f86 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     fa8:	eb 17                	jmp    fc1 <memmove+0xb5>
+      *--dst = *--src;
+     faa:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     faf:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     fb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fb8:	0f b6 10             	movzbl (%rax),%edx
+     fbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fbf:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     fc1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fc4:	8d 50 ff             	lea    -0x1(%rax),%edx
+     fc7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     fca:	85 c0                	test   %eax,%eax
+     fcc:	7f dc                	jg     faa <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     fce:	e9 90 00 00 00       	jmp    1063 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     fd3:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     fd7:	7e 09                	jle    fe2 <memmove+0xd6>
+     fd9:	e8 f0 fc ff ff       	call   cce <haserms>
+     fde:	85 c0                	test   %eax,%eax
+     fe0:	74 1b                	je     ffd <memmove+0xf1>
+    movsb(dst, src, n);
+     fe2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fe5:	48 63 d0             	movslq %eax,%rdx
+     fe8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     fec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff0:	48 89 ce             	mov    %rcx,%rsi
+     ff3:	48 89 c7             	mov    %rax,%rdi
+     ff6:	e8 0c fb ff ff       	call   b07 <movsb>
+     ffb:	eb 66                	jmp    1063 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     ffd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1000:	8d 50 07             	lea    0x7(%rax),%edx
+    1003:	85 c0                	test   %eax,%eax
+    1005:	0f 48 c2             	cmovs  %edx,%eax
+    1008:	c1 f8 03             	sar    $0x3,%eax
+    100b:	48 63 d0             	movslq %eax,%rdx
+    100e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1012:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1016:	48 89 ce             	mov    %rcx,%rsi
+    1019:	48 89 c7             	mov    %rax,%rdi
+    101c:	e8 23 fb ff ff       	call   b44 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1021:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1024:	89 d0                	mov    %edx,%eax
+    1026:	c1 f8 1f             	sar    $0x1f,%eax
+    1029:	c1 e8 1d             	shr    $0x1d,%eax
+    102c:	01 c2                	add    %eax,%edx
+    102e:	83 e2 07             	and    $0x7,%edx
+    1031:	29 c2                	sub    %eax,%edx
+    1033:	89 d0                	mov    %edx,%eax
+    1035:	48 98                	cltq
+    1037:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    103a:	83 e2 f8             	and    $0xfffffff8,%edx
+    103d:	48 63 ca             	movslq %edx,%rcx
+    1040:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1044:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    1048:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    104b:	83 e2 f8             	and    $0xfffffff8,%edx
+    104e:	48 63 ca             	movslq %edx,%rcx
+    1051:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1055:	48 01 d1             	add    %rdx,%rcx
+    1058:	48 89 c2             	mov    %rax,%rdx
+    105b:	48 89 cf             	mov    %rcx,%rdi
+    105e:	e8 a4 fa ff ff       	call   b07 <movsb>
+  }
+  return vdst;
+    1063:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1067:	c9                   	leave
+    1068:	c3                   	ret
+
+0000000000001069 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1069:	55                   	push   %rbp
+    106a:	48 89 e5             	mov    %rsp,%rbp
+    106d:	48 83 ec 20          	sub    $0x20,%rsp
+    1071:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1074:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1078:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    107f:	00 00 00 
+    1082:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1086:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    108a:	75 0d                	jne    1099 <clock_gettime+0x30>
+    108c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1090:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1094:	48 85 c0             	test   %rax,%rax
+    1097:	75 13                	jne    10ac <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1099:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    109d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10a0:	48 89 d6             	mov    %rdx,%rsi
+    10a3:	89 c7                	mov    %eax,%edi
+    10a5:	e8 e0 04 00 00       	call   158a <_clock_gettime>
+    10aa:	eb 7d                	jmp    1129 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    10ac:	e8 d1 fa ff ff       	call   b82 <rdtsc>
+    10b1:	48 89 c2             	mov    %rax,%rdx
+    10b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10b8:	48 89 d6             	mov    %rdx,%rsi
+    10bb:	48 89 c7             	mov    %rax,%rdi
+    10be:	e8 7b f9 ff ff       	call   a3e <clockns>
+    10c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    10c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10cb:	48 c1 e8 09          	shr    $0x9,%rax
+    10cf:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    10d6:	b8 44 00 
+    10d9:	48 f7 e2             	mul    %rdx
+    10dc:	48 89 d0             	mov    %rdx,%rax
+    10df:	48 c1 e8 0b          	shr    $0xb,%rax
+    10e3:	48 89 c2             	mov    %rax,%rdx
+    10e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10ea:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    10ed:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    10f1:	48 89 c8             	mov    %rcx,%rax
+    10f4:	48 c1 e8 09          	shr    $0x9,%rax
+    10f8:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    10ff:	b8 44 00 
+    1102:	48 f7 e2             	mul    %rdx
+    1105:	48 89 d0             	mov    %rdx,%rax
+    1108:	48 c1 e8 0b          	shr    $0xb,%rax
+    110c:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    1113:	48 89 c8             	mov    %rcx,%rax
+    1116:	48 29 d0             	sub    %rdx,%rax
+    1119:	48 89 c2             	mov    %rax,%rdx
+    111c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1120:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1124:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1129:	c9                   	leave
+    112a:	c3                   	ret
+
+000000000000112b <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    112b:	55                   	push   %rbp
+    112c:	48 89 e5             	mov    %rsp,%rbp
+    112f:	48 83 ec 10          	sub    $0x10,%rsp
+    1133:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1137:	eb 11                	jmp    114a <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1139:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    113d:	be 02 00 00 00       	mov    $0x2,%esi
+    1142:	48 89 c7             	mov    %rax,%rdi
+    1145:	e8 6c 04 00 00       	call   15b6 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    114a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    114e:	b8 02 00 00 00       	mov    $0x2,%eax
+    1153:	87 02                	xchg   %eax,(%rdx)
+    1155:	85 c0                	test   %eax,%eax
+    1157:	75 e0                	jne    1139 <mutex_wait+0xe>
+}
+    1159:	90                   	nop
+    115a:	90                   	nop
+    115b:	c9                   	leave
+    115c:	c3                   	ret
+
+000000000000115d <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    115d:	55                   	push   %rbp
+    115e:	48 89 e5             	mov    %rsp,%rbp
+    1161:	48 83 ec 20          	sub    $0x20,%rsp
+    1165:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1169:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1170:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1174:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1178:	8b 02                	mov    (%rdx),%eax
+    117a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    117f:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1183:	89 c1                	mov    %eax,%ecx
+    1185:	0f 94 c0             	sete   %al
+    1188:	84 c0                	test   %al,%al
+    118a:	75 02                	jne    118e <mutex_lock+0x31>
+    118c:	89 0a                	mov    %ecx,(%rdx)
+    118e:	83 f0 01             	xor    $0x1,%eax
+    1191:	84 c0                	test   %al,%al
+    1193:	74 0c                	je     11a1 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1199:	48 89 c7             	mov    %rax,%rdi
+    119c:	e8 8a ff ff ff       	call   112b <mutex_wait>
+}
+    11a1:	90                   	nop
+    11a2:	c9                   	leave
+    11a3:	c3                   	ret
+
+00000000000011a4 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    11a4:	55                   	push   %rbp
+    11a5:	48 89 e5             	mov    %rsp,%rbp
+    11a8:	48 83 ec 10          	sub    $0x10,%rsp
+    11ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    11b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b4:	ba 00 00 00 00       	mov    $0x0,%edx
+    11b9:	87 10                	xchg   %edx,(%rax)
+    11bb:	83 fa 02             	cmp    $0x2,%edx
+    11be:	75 11                	jne    11d1 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    11c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11c4:	be 01 00 00 00       	mov    $0x1,%esi
+    11c9:	48 89 c7             	mov    %rax,%rdi
+    11cc:	e8 f0 03 00 00       	call   15c1 <futex_wake>
+}
+    11d1:	90                   	nop
+    11d2:	c9                   	leave
+    11d3:	c3                   	ret
+
+00000000000011d4 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    11d4:	55                   	push   %rbp
+    11d5:	48 89 e5             	mov    %rsp,%rbp
+    11d8:	48 83 ec 20          	sub    $0x20,%rsp
+    11dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    11e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11e8:	48 83 c0 04          	add    $0x4,%rax
+    11ec:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    11f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11f4:	8b 00                	mov    (%rax),%eax
+    11f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    11f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    11fd:	48 89 c7             	mov    %rax,%rdi
+    1200:	e8 9f ff ff ff       	call   11a4 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    1205:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1209:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    120c:	89 d6                	mov    %edx,%esi
+    120e:	48 89 c7             	mov    %rax,%rdi
+    1211:	e8 a0 03 00 00       	call   15b6 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    1216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    121a:	48 83 c0 04          	add    $0x4,%rax
+    121e:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1222:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1226:	48 89 c7             	mov    %rax,%rdi
+    1229:	e8 fd fe ff ff       	call   112b <mutex_wait>
+}
+    122e:	90                   	nop
+    122f:	c9                   	leave
+    1230:	c3                   	ret
+
+0000000000001231 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1231:	55                   	push   %rbp
+    1232:	48 89 e5             	mov    %rsp,%rbp
+    1235:	48 83 ec 10          	sub    $0x10,%rsp
+    1239:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    123d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1241:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1245:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1249:	48 83 c0 04          	add    $0x4,%rax
+    124d:	8b 00                	mov    (%rax),%eax
+    124f:	85 c0                	test   %eax,%eax
+    1251:	7e 11                	jle    1264 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1253:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1257:	be 01 00 00 00       	mov    $0x1,%esi
+    125c:	48 89 c7             	mov    %rax,%rdi
+    125f:	e8 5d 03 00 00       	call   15c1 <futex_wake>
+}
+    1264:	90                   	nop
+    1265:	c9                   	leave
+    1266:	c3                   	ret
+
+0000000000001267 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1267:	55                   	push   %rbp
+    1268:	48 89 e5             	mov    %rsp,%rbp
+    126b:	48 83 ec 10          	sub    $0x10,%rsp
+    126f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1273:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1277:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    127b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127f:	48 83 c0 04          	add    $0x4,%rax
+    1283:	8b 00                	mov    (%rax),%eax
+    1285:	85 c0                	test   %eax,%eax
+    1287:	7e 11                	jle    129a <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1289:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    128d:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1292:	48 89 c7             	mov    %rax,%rdi
+    1295:	e8 27 03 00 00       	call   15c1 <futex_wake>
+}
+    129a:	90                   	nop
+    129b:	c9                   	leave
+    129c:	c3                   	ret
+
+000000000000129d <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    129d:	55                   	push   %rbp
+    129e:	48 89 e5             	mov    %rsp,%rbp
+    12a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12a5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    12a8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    12ac:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    12b0:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    12b4:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    12b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12bc:	8b 40 04             	mov    0x4(%rax),%eax
+    12bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    12c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12c6:	8b 00                	mov    (%rax),%eax
+    12c8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    12cb:	29 c2                	sub    %eax,%edx
+    12cd:	83 fa 1f             	cmp    $0x1f,%edx
+    12d0:	76 07                	jbe    12d9 <ring_push+0x3c>
+    return -1;
+    12d2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12d7:	eb 7e                	jmp    1357 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    12d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12dc:	83 e0 1f             	and    $0x1f,%eax
+    12df:	89 c2                	mov    %eax,%edx
+    12e1:	48 89 d0             	mov    %rdx,%rax
+    12e4:	48 01 c0             	add    %rax,%rax
+    12e7:	48 01 d0             	add    %rdx,%rax
+    12ea:	48 c1 e0 04          	shl    $0x4,%rax
+    12ee:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    12f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12f6:	48 01 d0             	add    %rdx,%rax
+    12f9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    12fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1301:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1304:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1306:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    130a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    130e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1312:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1316:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    131a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    131e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1322:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1326:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    132a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    132e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1332:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1336:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    133a:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    133e:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1342:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1345:	8d 50 01             	lea    0x1(%rax),%edx
+    1348:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    134c:	48 83 c0 04          	add    $0x4,%rax
+    1350:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1357:	5d                   	pop    %rbp
+    1358:	c3                   	ret
+
+0000000000001359 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1359:	55                   	push   %rbp
+    135a:	48 89 e5             	mov    %rsp,%rbp
+    135d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1361:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1365:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1369:	8b 40 08             	mov    0x8(%rax),%eax
+    136c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    136f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1373:	48 83 c0 0c          	add    $0xc,%rax
+    1377:	8b 00                	mov    (%rax),%eax
+    1379:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    137c:	75 07                	jne    1385 <ring_pop+0x2c>
+    return -1;
+    137e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1383:	eb 40                	jmp    13c5 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1385:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1388:	83 e0 1f             	and    $0x1f,%eax
+    138b:	89 c2                	mov    %eax,%edx
+    138d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1391:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1395:	89 d2                	mov    %edx,%edx
+    1397:	48 83 c2 61          	add    $0x61,%rdx
+    139b:	48 c1 e2 04          	shl    $0x4,%rdx
+    139f:	48 01 d0             	add    %rdx,%rax
+    13a2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    13a6:	48 8b 00             	mov    (%rax),%rax
+    13a9:	48 89 01             	mov    %rax,(%rcx)
+    13ac:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    13b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13b3:	8d 50 01             	lea    0x1(%rax),%edx
+    13b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13ba:	48 83 c0 08          	add    $0x8,%rax
+    13be:	89 10                	mov    %edx,(%rax)
+  return 0;
+    13c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13c5:	5d                   	pop    %rbp
+    13c6:	c3                   	ret
+
+00000000000013c7 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    13c7:	b8 01 00 00 00       	mov    $0x1,%eax
+    13cc:	49 89 ca             	mov    %rcx,%r10
+    13cf:	0f 05                	syscall
+    13d1:	c3                   	ret
+
+00000000000013d2 <_exit>:
+SYSCALL_(exit)
+    13d2:	b8 02 00 00 00       	mov    $0x2,%eax
+    13d7:	49 89 ca             	mov    %rcx,%r10
+    13da:	0f 05                	syscall
+    13dc:	c3                   	ret
+
+00000000000013dd <wait>:
+SYSCALL(wait)
+    13dd:	b8 03 00 00 00       	mov    $0x3,%eax
+    13e2:	49 89 ca             	mov    %rcx,%r10
+    13e5:	0f 05                	syscall
+    13e7:	c3                   	ret
+
+00000000000013e8 <pipe>:
+SYSCALL(pipe)
+    13e8:	b8 04 00 00 00       	mov    $0x4,%eax
+    13ed:	49 89 ca             	mov    %rcx,%r10
+    13f0:	0f 05                	syscall
+    13f2:	c3                   	ret
+
+00000000000013f3 <read>:
+SYSCALL(read)
+    13f3:	b8 05 00 00 00       	mov    $0x5,%eax
+    13f8:	49 89 ca             	mov    %rcx,%r10
+    13fb:	0f 05                	syscall
+    13fd:	c3                   	ret
+
+00000000000013fe <write>:
+SYSCALL(write)
+    13fe:	b8 10 00 00 00       	mov    $0x10,%eax
+    1403:	49 89 ca             	mov    %rcx,%r10
+    1406:	0f 05                	syscall
+    1408:	c3                   	ret
+
+0000000000001409 <_close>:
+SYSCALL_(close)
+    1409:	b8 15 00 00 00       	mov    $0x15,%eax
+    140e:	49 89 ca             	mov    %rcx,%r10
+    1411:	0f 05                	syscall
+    1413:	c3                   	ret
+
+0000000000001414 <kill>:
+SYSCALL(kill)
+    1414:	b8 06 00 00 00       	mov    $0x6,%eax
+    1419:	49 89 ca             	mov    %rcx,%r10
+    141c:	0f 05                	syscall
+    141e:	c3                   	ret
+
+000000000000141f <_exec>:
+SYSCALL_(exec)
+    141f:	b8 07 00 00 00       	mov    $0x7,%eax
+    1424:	49 89 ca             	mov    %rcx,%r10
+    1427:	0f 05                	syscall
+    1429:	c3                   	ret
+
+000000000000142a <open>:
+SYSCALL(open)
+    142a:	b8 0f 00 00 00       	mov    $0xf,%eax
+    142f:	49 89 ca             	mov    %rcx,%r10
+    1432:	0f 05                	syscall
+    1434:	c3                   	ret
+
+0000000000001435 <mknod>:
+SYSCALL(mknod)
+    1435:	b8 11 00 00 00       	mov    $0x11,%eax
+    143a:	49 89 ca             	mov    %rcx,%r10
+    143d:	0f 05                	syscall
+    143f:	c3                   	ret
+
+0000000000001440 <unlink>:
+SYSCALL(unlink)
+    1440:	b8 12 00 00 00       	mov    $0x12,%eax
+    1445:	49 89 ca             	mov    %rcx,%r10
+    1448:	0f 05                	syscall
+    144a:	c3                   	ret
+
+000000000000144b <fstat>:
+SYSCALL(fstat)
+    144b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1450:	49 89 ca             	mov    %rcx,%r10
+    1453:	0f 05                	syscall
+    1455:	c3                   	ret
+
+0000000000001456 <link>:
+SYSCALL(link)
+    1456:	b8 13 00 00 00       	mov    $0x13,%eax
+    145b:	49 89 ca             	mov    %rcx,%r10
+    145e:	0f 05                	syscall
+    1460:	c3                   	ret
+
+0000000000001461 <mkdir>:
+SYSCALL(mkdir)
+    1461:	b8 14 00 00 00       	mov    $0x14,%eax
+    1466:	49 89 ca             	mov    %rcx,%r10
+    1469:	0f 05                	syscall
+    146b:	c3                   	ret
+
+000000000000146c <chdir>:
+SYSCALL(chdir)
+    146c:	b8 09 00 00 00       	mov    $0x9,%eax
+    1471:	49 89 ca             	mov    %rcx,%r10
+    1474:	0f 05                	syscall
+    1476:	c3                   	ret
+
+0000000000001477 <dup>:
+SYSCALL(dup)
+    1477:	b8 0a 00 00 00       	mov    $0xa,%eax
+    147c:	49 89 ca             	mov    %rcx,%r10
+    147f:	0f 05                	syscall
+    1481:	c3                   	ret
+
+0000000000001482 <getpid>:
+SYSCALL(getpid)
+    1482:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1487:	49 89 ca             	mov    %rcx,%r10
+    148a:	0f 05                	syscall
+    148c:	c3                   	ret
+
+000000000000148d <sbrk>:
+SYSCALL(sbrk)
+    148d:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1492:	49 89 ca             	mov    %rcx,%r10
+    1495:	0f 05                	syscall
+    1497:	c3                   	ret
+
+0000000000001498 <sleep>:
+SYSCALL(sleep)
+    1498:	b8 0d 00 00 00       	mov    $0xd,%eax
+    149d:	49 89 ca             	mov    %rcx,%r10
+    14a0:	0f 05                	syscall
+    14a2:	c3                   	ret
+
+00000000000014a3 <uptime>:
+SYSCALL(uptime)
+    14a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14a8:	49 89 ca             	mov    %rcx,%r10
+    14ab:	0f 05                	syscall
+    14ad:	c3                   	ret
+
+00000000000014ae <sysinfo>:
+SYSCALL(sysinfo)
+    14ae:	b8 16 00 00 00       	mov    $0x16,%eax
+    14b3:	49 89 ca             	mov    %rcx,%r10
+    14b6:	0f 05                	syscall
+    14b8:	c3                   	ret
+
+00000000000014b9 <crashn>:
+SYSCALL(crashn)
+    14b9:	b8 17 00 00 00       	mov    $0x17,%eax
+    14be:	49 89 ca             	mov    %rcx,%r10
+    14c1:	0f 05                	syscall
+    14c3:	c3                   	ret
+
+00000000000014c4 <mmap>:
+SYSCALL(mmap)
+    14c4:	b8 18 00 00 00       	mov    $0x18,%eax
+    14c9:	49 89 ca             	mov    %rcx,%r10
+    14cc:	0f 05                	syscall
+    14ce:	c3                   	ret
+
+00000000000014cf <munmap>:
+SYSCALL(munmap)
+    14cf:	b8 19 00 00 00       	mov    $0x19,%eax
+    14d4:	49 89 ca             	mov    %rcx,%r10
+    14d7:	0f 05                	syscall
+    14d9:	c3                   	ret
+
+00000000000014da <nice>:
+SYSCALL(nice)
+    14da:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14df:	49 89 ca             	mov    %rcx,%r10
+    14e2:	0f 05                	syscall
+    14e4:	c3                   	ret
+
+00000000000014e5 <_spawn>:
+SYSCALL_(spawn)
+    14e5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    14ea:	49 89 ca             	mov    %rcx,%r10
+    14ed:	0f 05                	syscall
+    14ef:	c3                   	ret
+
+00000000000014f0 <pread>:
+SYSCALL(pread)
+    14f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    14f5:	49 89 ca             	mov    %rcx,%r10
+    14f8:	0f 05                	syscall
+    14fa:	c3                   	ret
+
+00000000000014fb <pwrite>:
+SYSCALL(pwrite)
+    14fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1500:	49 89 ca             	mov    %rcx,%r10
+    1503:	0f 05                	syscall
+    1505:	c3                   	ret
+
+0000000000001506 <readv>:
+SYSCALL(readv)
+    1506:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    150b:	49 89 ca             	mov    %rcx,%r10
+    150e:	0f 05                	syscall
+    1510:	c3                   	ret
+
+0000000000001511 <writev>:
+SYSCALL(writev)
+    1511:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1516:	49 89 ca             	mov    %rcx,%r10
+    1519:	0f 05                	syscall
+    151b:	c3                   	ret
+
+000000000000151c <sendfile>:
+SYSCALL(sendfile)
+    151c:	b8 20 00 00 00       	mov    $0x20,%eax
+    1521:	49 89 ca             	mov    %rcx,%r10
+    1524:	0f 05                	syscall
+    1526:	c3                   	ret
+
+0000000000001527 <splice>:
+SYSCALL(splice)
+    1527:	b8 21 00 00 00       	mov    $0x21,%eax
+    152c:	49 89 ca             	mov    %rcx,%r10
+    152f:	0f 05                	syscall
+    1531:	c3                   	ret
+
+0000000000001532 <poll>:
+SYSCALL(poll)
+    1532:	b8 22 00 00 00       	mov    $0x22,%eax
+    1537:	49 89 ca             	mov    %rcx,%r10
+    153a:	0f 05                	syscall
+    153c:	c3                   	ret
+
+000000000000153d <fsync>:
+SYSCALL(fsync)
+    153d:	b8 23 00 00 00       	mov    $0x23,%eax
+    1542:	49 89 ca             	mov    %rcx,%r10
+    1545:	0f 05                	syscall
+    1547:	c3                   	ret
+
+0000000000001548 <fdatasync>:
+SYSCALL(fdatasync)
+    1548:	b8 24 00 00 00       	mov    $0x24,%eax
+    154d:	49 89 ca             	mov    %rcx,%r10
+    1550:	0f 05                	syscall
+    1552:	c3                   	ret
+
+0000000000001553 <lockstat>:
+SYSCALL(lockstat)
+    1553:	b8 25 00 00 00       	mov    $0x25,%eax
+    1558:	49 89 ca             	mov    %rcx,%r10
+    155b:	0f 05                	syscall
+    155d:	c3                   	ret
+
+000000000000155e <syscallstat>:
+SYSCALL(syscallstat)
+    155e:	b8 26 00 00 00       	mov    $0x26,%eax
+    1563:	49 89 ca             	mov    %rcx,%r10
+    1566:	0f 05                	syscall
+    1568:	c3                   	ret
+
+0000000000001569 <trace>:
+SYSCALL(trace)
+    1569:	b8 27 00 00 00       	mov    $0x27,%eax
+    156e:	49 89 ca             	mov    %rcx,%r10
+    1571:	0f 05                	syscall
+    1573:	c3                   	ret
+
+0000000000001574 <profile>:
+SYSCALL(profile)
+    1574:	b8 28 00 00 00       	mov    $0x28,%eax
+    1579:	49 89 ca             	mov    %rcx,%r10
+    157c:	0f 05                	syscall
+    157e:	c3                   	ret
+
+000000000000157f <cycles>:
+SYSCALL(cycles)
+    157f:	b8 29 00 00 00       	mov    $0x29,%eax
+    1584:	49 89 ca             	mov    %rcx,%r10
+    1587:	0f 05                	syscall
+    1589:	c3                   	ret
+
+000000000000158a <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    158a:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    158f:	49 89 ca             	mov    %rcx,%r10
+    1592:	0f 05                	syscall
+    1594:	c3                   	ret
+
+0000000000001595 <consmode>:
+SYSCALL(consmode)
+    1595:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    159a:	49 89 ca             	mov    %rcx,%r10
+    159d:	0f 05                	syscall
+    159f:	c3                   	ret
+
+00000000000015a0 <clone>:
+SYSCALL(clone)
+    15a0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    15a5:	49 89 ca             	mov    %rcx,%r10
+    15a8:	0f 05                	syscall
+    15aa:	c3                   	ret
+
+00000000000015ab <join>:
+SYSCALL(join)
+    15ab:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    15b0:	49 89 ca             	mov    %rcx,%r10
+    15b3:	0f 05                	syscall
+    15b5:	c3                   	ret
+
+00000000000015b6 <futex_wait>:
+SYSCALL(futex_wait)
+    15b6:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    15bb:	49 89 ca             	mov    %rcx,%r10
+    15be:	0f 05                	syscall
+    15c0:	c3                   	ret
+
+00000000000015c1 <futex_wake>:
+SYSCALL(futex_wake)
+    15c1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    15c6:	49 89 ca             	mov    %rcx,%r10
+    15c9:	0f 05                	syscall
+    15cb:	c3                   	ret
+
+00000000000015cc <shmget>:
+SYSCALL(shmget)
+    15cc:	b8 30 00 00 00       	mov    $0x30,%eax
+    15d1:	49 89 ca             	mov    %rcx,%r10
+    15d4:	0f 05                	syscall
+    15d6:	c3                   	ret
+
+00000000000015d7 <shmat>:
+SYSCALL(shmat)
+    15d7:	b8 31 00 00 00       	mov    $0x31,%eax
+    15dc:	49 89 ca             	mov    %rcx,%r10
+    15df:	0f 05                	syscall
+    15e1:	c3                   	ret
+
+00000000000015e2 <shmdt>:
+SYSCALL(shmdt)
+    15e2:	b8 32 00 00 00       	mov    $0x32,%eax
+    15e7:	49 89 ca             	mov    %rcx,%r10
+    15ea:	0f 05                	syscall
+    15ec:	c3                   	ret
+
+00000000000015ed <ring_setup>:
+SYSCALL(ring_setup)
+    15ed:	b8 33 00 00 00       	mov    $0x33,%eax
+    15f2:	49 89 ca             	mov    %rcx,%r10
+    15f5:	0f 05                	syscall
+    15f7:	c3                   	ret
+
+00000000000015f8 <ring_enter>:
+SYSCALL(ring_enter)
+    15f8:	b8 34 00 00 00       	mov    $0x34,%eax
+    15fd:	49 89 ca             	mov    %rcx,%r10
+    1600:	0f 05                	syscall
+    1602:	c3                   	ret
+
+0000000000001603 <getdents>:
+SYSCALL(getdents)
+    1603:	b8 35 00 00 00       	mov    $0x35,%eax
+    1608:	49 89 ca             	mov    %rcx,%r10
+    160b:	0f 05                	syscall
+    160d:	c3                   	ret
+
+000000000000160e <fstatat>:
+SYSCALL(fstatat)
+    160e:	b8 36 00 00 00       	mov    $0x36,%eax
+    1613:	49 89 ca             	mov    %rcx,%r10
+    1616:	0f 05                	syscall
+    1618:	c3                   	ret
+
+0000000000001619 <clone_file>:
+SYSCALL(clone_file)
+    1619:	b8 37 00 00 00       	mov    $0x37,%eax
+    161e:	49 89 ca             	mov    %rcx,%r10
+    1621:	0f 05                	syscall
+    1623:	c3                   	ret
+
+0000000000001624 <fpunch>:
+SYSCALL(fpunch)
+    1624:	b8 38 00 00 00       	mov    $0x38,%eax
+    1629:	49 89 ca             	mov    %rcx,%r10
+    162c:	0f 05                	syscall
+    162e:	c3                   	ret
+
+000000000000162f <defrag>:
+SYSCALL(defrag)
+    162f:	b8 39 00 00 00       	mov    $0x39,%eax
+    1634:	49 89 ca             	mov    %rcx,%r10
+    1637:	0f 05                	syscall
+    1639:	c3                   	ret
+
+000000000000163a <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    163a:	55                   	push   %rbp
+    163b:	48 89 e5             	mov    %rsp,%rbp
+    163e:	48 83 ec 20          	sub    $0x20,%rsp
+    1642:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1646:	bf 00 00 00 00       	mov    $0x0,%edi
+    164b:	e8 3d fe ff ff       	call   148d <sbrk>
+    1650:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1658:	48 f7 d8             	neg    %rax
+    165b:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1660:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1664:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1668:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    166c:	48 01 c2             	add    %rax,%rdx
+    166f:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1674:	48 39 c2             	cmp    %rax,%rdx
+    1677:	73 1e                	jae    1697 <morecore+0x5d>
+    1679:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    167d:	89 c2                	mov    %eax,%edx
+    167f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1683:	01 d0                	add    %edx,%eax
+    1685:	89 c7                	mov    %eax,%edi
+    1687:	e8 01 fe ff ff       	call   148d <sbrk>
+    168c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1690:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1695:	75 07                	jne    169e <morecore+0x64>
+    return 0;
+    1697:	b8 00 00 00 00       	mov    $0x0,%eax
+    169c:	eb 27                	jmp    16c5 <morecore+0x8b>
+  stats.heap += n + pad;
+    169e:	48 8b 05 cb 1a 00 00 	mov    0x1acb(%rip),%rax        # 3170 <stats+0x50>
+    16a5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    16a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    16ad:	48 01 ca             	add    %rcx,%rdx
+    16b0:	48 01 d0             	add    %rdx,%rax
+    16b3:	48 89 05 b6 1a 00 00 	mov    %rax,0x1ab6(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    16ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    16be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c2:	48 01 d0             	add    %rdx,%rax
+}
+    16c5:	c9                   	leave
+    16c6:	c3                   	ret
+
+00000000000016c7 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    16c7:	55                   	push   %rbp
+    16c8:	48 89 e5             	mov    %rsp,%rbp
+    16cb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    16cf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    16d3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    16da:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    16db:	48 8d 05 1e 1a 00 00 	lea    0x1a1e(%rip),%rax        # 3100 <runs>
+    16e2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16e6:	eb 1a                	jmp    1702 <pagefree+0x3b>
+    prev = *rp;
+    16e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ec:	48 8b 00             	mov    (%rax),%rax
+    16ef:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    16f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f7:	48 8b 00             	mov    (%rax),%rax
+    16fa:	48 83 c0 08          	add    $0x8,%rax
+    16fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1702:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1706:	48 8b 00             	mov    (%rax),%rax
+    1709:	48 85 c0             	test   %rax,%rax
+    170c:	74 0d                	je     171b <pagefree+0x54>
+    170e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1712:	48 8b 00             	mov    (%rax),%rax
+    1715:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1719:	72 cd                	jb     16e8 <pagefree+0x21>
+  r = (struct run *)p;
+    171b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    171f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1723:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1727:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    172b:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    172e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1732:	48 8b 10             	mov    (%rax),%rdx
+    1735:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1739:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    173d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1741:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1745:	48 85 c0             	test   %rax,%rax
+    1748:	74 48                	je     1792 <pagefree+0xcb>
+    174a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    174e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1752:	48 01 c2             	add    %rax,%rdx
+    1755:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1759:	48 8b 40 08          	mov    0x8(%rax),%rax
+    175d:	48 39 c2             	cmp    %rax,%rdx
+    1760:	75 30                	jne    1792 <pagefree+0xcb>
+    r->size += r->next->size;
+    1762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1766:	48 8b 10             	mov    (%rax),%rdx
+    1769:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    176d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1771:	48 8b 00             	mov    (%rax),%rax
+    1774:	48 01 c2             	add    %rax,%rdx
+    1777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    177b:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    177e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1782:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1786:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    178a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    178e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1792:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1797:	74 46                	je     17df <pagefree+0x118>
+    1799:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    179d:	48 8b 10             	mov    (%rax),%rdx
+    17a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a4:	48 01 d0             	add    %rdx,%rax
+    17a7:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    17ab:	75 32                	jne    17df <pagefree+0x118>
+    prev->size += r->size;
+    17ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17b1:	48 8b 10             	mov    (%rax),%rdx
+    17b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17b8:	48 8b 00             	mov    (%rax),%rax
+    17bb:	48 01 c2             	add    %rax,%rdx
+    17be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17c2:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    17c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17c9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17d1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    17d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17d9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    17dd:	eb 0c                	jmp    17eb <pagefree+0x124>
+  } else {
+    *rp = r;
+    17df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17e3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    17e7:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    17ea:	90                   	nop
+    17eb:	90                   	nop
+    17ec:	5d                   	pop    %rbp
+    17ed:	c3                   	ret
+
+00000000000017ee <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    17ee:	55                   	push   %rbp
+    17ef:	48 89 e5             	mov    %rsp,%rbp
+    17f2:	48 83 ec 40          	sub    $0x40,%rsp
+    17f6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    17fa:	48 8d 05 ff 18 00 00 	lea    0x18ff(%rip),%rax        # 3100 <runs>
+    1801:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1805:	eb 66                	jmp    186d <pagealloc+0x7f>
+    if (r->size == n) {
+    1807:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    180b:	48 8b 00             	mov    (%rax),%rax
+    180e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1812:	75 18                	jne    182c <pagealloc+0x3e>
+      *rp = r->next;
+    1814:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1818:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    181c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1820:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1823:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1827:	e9 ca 00 00 00       	jmp    18f6 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    182c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1830:	48 8b 00             	mov    (%rax),%rax
+    1833:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1837:	73 28                	jae    1861 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    183d:	48 8b 00             	mov    (%rax),%rax
+    1840:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1844:	48 89 c2             	mov    %rax,%rdx
+    1847:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    184b:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    184e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1852:	48 8b 10             	mov    (%rax),%rdx
+    1855:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1859:	48 01 d0             	add    %rdx,%rax
+    185c:	e9 95 00 00 00       	jmp    18f6 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1861:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1865:	48 83 c0 08          	add    $0x8,%rax
+    1869:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    186d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1871:	48 8b 00             	mov    (%rax),%rax
+    1874:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1878:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    187d:	75 88                	jne    1807 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    187f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1883:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1887:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    188e:	00 
+    188f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1893:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1897:	48 39 c2             	cmp    %rax,%rdx
+    189a:	48 0f 43 c2          	cmovae %rdx,%rax
+    189e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    18a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18a6:	48 89 c7             	mov    %rax,%rdi
+    18a9:	e8 8c fd ff ff       	call   163a <morecore>
+    18ae:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    18b2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    18b7:	75 07                	jne    18c0 <pagealloc+0xd2>
+    return 0;
+    18b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    18be:	eb 36                	jmp    18f6 <pagealloc+0x108>
+  if (m > n)
+    18c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18c4:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    18c8:	73 1a                	jae    18e4 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    18ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18ce:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18d2:	48 89 c2             	mov    %rax,%rdx
+    18d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    18d9:	48 89 d6             	mov    %rdx,%rsi
+    18dc:	48 89 c7             	mov    %rax,%rdi
+    18df:	e8 e3 fd ff ff       	call   16c7 <pagefree>
+  return p + m - n;
+    18e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    18e8:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18ec:	48 89 c2             	mov    %rax,%rdx
+    18ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    18f3:	48 01 d0             	add    %rdx,%rax
+}
+    18f6:	c9                   	leave
+    18f7:	c3                   	ret
+
+00000000000018f8 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    18f8:	55                   	push   %rbp
+    18f9:	48 89 e5             	mov    %rsp,%rbp
+    18fc:	48 83 ec 30          	sub    $0x30,%rsp
+    1900:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1903:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1908:	e8 e1 fe ff ff       	call   17ee <pagealloc>
+    190d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1911:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1916:	75 0a                	jne    1922 <refill+0x2a>
+    return -1;
+    1918:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    191d:	e9 da 00 00 00       	jmp    19fc <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1922:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1929:	00 
+    192a:	e9 ba 00 00 00       	jmp    19e9 <refill+0xf1>
+    b = (struct block *)(p + off);
+    192f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1933:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1937:	48 01 d0             	add    %rdx,%rax
+    193a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    193e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1941:	ba 20 00 00 00       	mov    $0x20,%edx
+    1946:	89 c1                	mov    %eax,%ecx
+    1948:	48 d3 e2             	shl    %cl,%rdx
+    194b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    194f:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1952:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1955:	48 63 d0             	movslq %eax,%rdx
+    1958:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    195c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1960:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1963:	48 98                	cltq
+    1965:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    196c:	00 
+    196d:	48 8d 05 4c 17 00 00 	lea    0x174c(%rip),%rax        # 30c0 <freelist>
+    1974:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1978:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1980:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1983:	48 98                	cltq
+    1985:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    198c:	00 
+    198d:	48 8d 15 2c 17 00 00 	lea    0x172c(%rip),%rdx        # 30c0 <freelist>
+    1994:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1998:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    199c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    199f:	48 98                	cltq
+    19a1:	48 83 c0 08          	add    $0x8,%rax
+    19a5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    19ac:	00 
+    19ad:	48 8d 05 70 17 00 00 	lea    0x1770(%rip),%rax        # 3124 <stats+0x4>
+    19b4:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    19b7:	8d 48 01             	lea    0x1(%rax),%ecx
+    19ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19bd:	48 98                	cltq
+    19bf:	48 83 c0 08          	add    $0x8,%rax
+    19c3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    19ca:	00 
+    19cb:	48 8d 05 52 17 00 00 	lea    0x1752(%rip),%rax        # 3124 <stats+0x4>
+    19d2:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    19d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19d8:	ba 20 00 00 00       	mov    $0x20,%edx
+    19dd:	89 c1                	mov    %eax,%ecx
+    19df:	48 d3 e2             	shl    %cl,%rdx
+    19e2:	48 89 d0             	mov    %rdx,%rax
+    19e5:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    19e9:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    19f0:	00 
+    19f1:	0f 86 38 ff ff ff    	jbe    192f <refill+0x37>
+  }
+  return 0;
+    19f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    19fc:	c9                   	leave
+    19fd:	c3                   	ret
+
+00000000000019fe <malloc>:
+
+void *malloc(uint nbytes) {
+    19fe:	55                   	push   %rbp
+    19ff:	48 89 e5             	mov    %rsp,%rbp
+    1a02:	48 83 ec 30          	sub    $0x30,%rsp
+    1a06:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1a09:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a0c:	48 83 c0 10          	add    $0x10,%rax
+    1a10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1a14:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1a1b:	eb 04                	jmp    1a21 <malloc+0x23>
+    1a1d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1a21:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1a25:	7f 16                	jg     1a3d <malloc+0x3f>
+    1a27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a2a:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a2f:	89 c1                	mov    %eax,%ecx
+    1a31:	48 d3 e2             	shl    %cl,%rdx
+    1a34:	48 89 d0             	mov    %rdx,%rax
+    1a37:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1a3b:	72 e0                	jb     1a1d <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1a3d:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1a41:	75 7d                	jne    1ac0 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1a43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a47:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1a4d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1a53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1a57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a5b:	48 89 c7             	mov    %rax,%rdi
+    1a5e:	e8 8b fd ff ff       	call   17ee <pagealloc>
+    1a63:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1a67:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1a6c:	75 0a                	jne    1a78 <malloc+0x7a>
+      return 0;
+    1a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a73:	e9 2c 01 00 00       	jmp    1ba4 <malloc+0x1a6>
+    h->size = n;
+    1a78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a7c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a80:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1a83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a87:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1a8e:	00 
+    stats.inuse[LARGE]++;
+    1a8f:	8b 05 ab 16 00 00    	mov    0x16ab(%rip),%eax        # 3140 <stats+0x20>
+    1a95:	83 c0 01             	add    $0x1,%eax
+    1a98:	89 05 a2 16 00 00    	mov    %eax,0x16a2(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    1a9e:	48 8b 15 c3 16 00 00 	mov    0x16c3(%rip),%rdx        # 3168 <stats+0x48>
+    1aa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aa9:	48 01 d0             	add    %rdx,%rax
+    1aac:	48 89 05 b5 16 00 00 	mov    %rax,0x16b5(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    1ab3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ab7:	48 83 c0 10          	add    $0x10,%rax
+    1abb:	e9 e4 00 00 00       	jmp    1ba4 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1ac0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ac3:	48 98                	cltq
+    1ac5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1acc:	00 
+    1acd:	48 8d 05 ec 15 00 00 	lea    0x15ec(%rip),%rax        # 30c0 <freelist>
+    1ad4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1ad8:	48 85 c0             	test   %rax,%rax
+    1adb:	75 18                	jne    1af5 <malloc+0xf7>
+    1add:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ae0:	89 c7                	mov    %eax,%edi
+    1ae2:	e8 11 fe ff ff       	call   18f8 <refill>
+    1ae7:	85 c0                	test   %eax,%eax
+    1ae9:	79 0a                	jns    1af5 <malloc+0xf7>
+    return 0;
+    1aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1af0:	e9 af 00 00 00       	jmp    1ba4 <malloc+0x1a6>
+  b = freelist[c];
+    1af5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1af8:	48 98                	cltq
+    1afa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b01:	00 
+    1b02:	48 8d 05 b7 15 00 00 	lea    0x15b7(%rip),%rax        # 30c0 <freelist>
+    1b09:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b0d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1b11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b15:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1b19:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1b1c:	48 63 d2             	movslq %edx,%rdx
+    1b1f:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1b26:	00 
+    1b27:	48 8d 15 92 15 00 00 	lea    0x1592(%rip),%rdx        # 30c0 <freelist>
+    1b2e:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1b32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b35:	48 98                	cltq
+    1b37:	48 83 c0 08          	add    $0x8,%rax
+    1b3b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b42:	00 
+    1b43:	48 8d 05 da 15 00 00 	lea    0x15da(%rip),%rax        # 3124 <stats+0x4>
+    1b4a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b4d:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1b50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b53:	48 98                	cltq
+    1b55:	48 83 c0 08          	add    $0x8,%rax
+    1b59:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b60:	00 
+    1b61:	48 8d 05 bc 15 00 00 	lea    0x15bc(%rip),%rax        # 3124 <stats+0x4>
+    1b68:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1b6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b6e:	48 98                	cltq
+    1b70:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b77:	00 
+    1b78:	48 8d 05 a1 15 00 00 	lea    0x15a1(%rip),%rax        # 3120 <stats>
+    1b7f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b82:	8d 48 01             	lea    0x1(%rax),%ecx
+    1b85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b88:	48 98                	cltq
+    1b8a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b91:	00 
+    1b92:	48 8d 05 87 15 00 00 	lea    0x1587(%rip),%rax        # 3120 <stats>
+    1b99:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ba0:	48 83 c0 10          	add    $0x10,%rax
+}
+    1ba4:	c9                   	leave
+    1ba5:	c3                   	ret
+
+0000000000001ba6 <free>:
+
+void free(void *ap) {
+    1ba6:	55                   	push   %rbp
+    1ba7:	48 89 e5             	mov    %rsp,%rbp
+    1baa:	48 83 ec 18          	sub    $0x18,%rsp
+    1bae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1bb2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1bb7:	0f 84 03 01 00 00    	je     1cc0 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1bbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bc1:	48 83 e8 10          	sub    $0x10,%rax
+    1bc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1bc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bcd:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1bd1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1bd5:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1bda:	75 42                	jne    1c1e <free+0x78>
+    stats.inuse[LARGE]--;
+    1bdc:	8b 05 5e 15 00 00    	mov    0x155e(%rip),%eax        # 3140 <stats+0x20>
+    1be2:	83 e8 01             	sub    $0x1,%eax
+    1be5:	89 05 55 15 00 00    	mov    %eax,0x1555(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1beb:	48 8b 15 76 15 00 00 	mov    0x1576(%rip),%rdx        # 3168 <stats+0x48>
+    1bf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf6:	48 8b 00             	mov    (%rax),%rax
+    1bf9:	48 29 c2             	sub    %rax,%rdx
+    1bfc:	48 89 15 65 15 00 00 	mov    %rdx,0x1565(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1c03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c07:	48 8b 10             	mov    (%rax),%rdx
+    1c0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c0e:	48 89 d6             	mov    %rdx,%rsi
+    1c11:	48 89 c7             	mov    %rax,%rdi
+    1c14:	e8 ae fa ff ff       	call   16c7 <pagefree>
+    return;
+    1c19:	e9 a3 00 00 00       	jmp    1cc1 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c22:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1c29:	00 
+    1c2a:	48 8d 05 8f 14 00 00 	lea    0x148f(%rip),%rax        # 30c0 <freelist>
+    1c31:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1c35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c39:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1c3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c41:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1c48:	00 
+    1c49:	48 8d 15 70 14 00 00 	lea    0x1470(%rip),%rdx        # 30c0 <freelist>
+    1c50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c54:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1c58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c5c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c63:	00 
+    1c64:	48 8d 05 b5 14 00 00 	lea    0x14b5(%rip),%rax        # 3120 <stats>
+    1c6b:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c6e:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1c71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c75:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c7c:	00 
+    1c7d:	48 8d 05 9c 14 00 00 	lea    0x149c(%rip),%rax        # 3120 <stats>
+    1c84:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1c87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c8b:	48 83 c0 08          	add    $0x8,%rax
+    1c8f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c96:	00 
+    1c97:	48 8d 05 86 14 00 00 	lea    0x1486(%rip),%rax        # 3124 <stats+0x4>
+    1c9e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ca1:	8d 48 01             	lea    0x1(%rax),%ecx
+    1ca4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca8:	48 83 c0 08          	add    $0x8,%rax
+    1cac:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1cb3:	00 
+    1cb4:	48 8d 05 69 14 00 00 	lea    0x1469(%rip),%rax        # 3124 <stats+0x4>
+    1cbb:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1cbe:	eb 01                	jmp    1cc1 <free+0x11b>
+    return;
+    1cc0:	90                   	nop
+}
+    1cc1:	c9                   	leave
+    1cc2:	c3                   	ret
+
+0000000000001cc3 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1cc3:	55                   	push   %rbp
+    1cc4:	48 89 e5             	mov    %rsp,%rbp
+    1cc7:	48 83 ec 30          	sub    $0x30,%rsp
+    1ccb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1cce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cd1:	48 8d 15 88 02 00 00 	lea    0x288(%rip),%rdx        # 1f60 <benchreport+0x175>
+    1cd8:	48 89 d6             	mov    %rdx,%rsi
+    1cdb:	89 c7                	mov    %eax,%edi
+    1cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ce2:	e8 37 e6 ff ff       	call   31e <printf>
+  for (c = 0; c < NCLASS; c++)
+    1ce7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1cee:	eb 67                	jmp    1d57 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1cf0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1cf3:	48 98                	cltq
+    1cf5:	48 83 c0 08          	add    $0x8,%rax
+    1cf9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d00:	00 
+    1d01:	48 8d 05 1c 14 00 00 	lea    0x141c(%rip),%rax        # 3124 <stats+0x4>
+    1d08:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1d0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d0e:	48 98                	cltq
+    1d10:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d17:	00 
+    1d18:	48 8d 05 01 14 00 00 	lea    0x1401(%rip),%rax        # 3120 <stats>
+    1d1f:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1d22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d25:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d2a:	89 c1                	mov    %eax,%ecx
+    1d2c:	48 d3 e2             	shl    %cl,%rdx
+    1d2f:	48 89 d0             	mov    %rdx,%rax
+    1d32:	89 c1                	mov    %eax,%ecx
+    1d34:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1d37:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d3a:	41 89 f9             	mov    %edi,%r9d
+    1d3d:	41 89 f0             	mov    %esi,%r8d
+    1d40:	48 8d 35 30 02 00 00 	lea    0x230(%rip),%rsi        # 1f77 <benchreport+0x18c>
+    1d47:	89 c7                	mov    %eax,%edi
+    1d49:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d4e:	e8 cb e5 ff ff       	call   31e <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d53:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1d57:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1d5b:	7e 93                	jle    1cf0 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1d5d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1d64:	00 
+  for (r = runs; r; r = r->next)
+    1d65:	48 8b 05 94 13 00 00 	mov    0x1394(%rip),%rax        # 3100 <runs>
+    1d6c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d70:	eb 17                	jmp    1d89 <mallocstats+0xc6>
+    nfree += r->size;
+    1d72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d76:	48 8b 00             	mov    (%rax),%rax
+    1d79:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1d7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d81:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1d85:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d89:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1d8e:	75 e2                	jne    1d72 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1d90:	48 8b 05 d9 13 00 00 	mov    0x13d9(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1d97:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1d99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d9d:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1da1:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1da3:	48 8b 05 be 13 00 00 	mov    0x13be(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1daa:	89 c1                	mov    %eax,%ecx
+    1dac:	8b 15 8e 13 00 00    	mov    0x138e(%rip),%edx        # 3140 <stats+0x20>
+    1db2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1db5:	41 89 f9             	mov    %edi,%r9d
+    1db8:	41 89 f0             	mov    %esi,%r8d
+    1dbb:	48 8d 35 c6 01 00 00 	lea    0x1c6(%rip),%rsi        # 1f88 <benchreport+0x19d>
+    1dc2:	89 c7                	mov    %eax,%edi
+    1dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dc9:	e8 50 e5 ff ff       	call   31e <printf>
+}
+    1dce:	90                   	nop
+    1dcf:	c9                   	leave
+    1dd0:	c3                   	ret
+
+0000000000001dd1 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1dd1:	55                   	push   %rbp
+    1dd2:	48 89 e5             	mov    %rsp,%rbp
+    1dd5:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1dd9:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1ddd:	48 89 c7             	mov    %rax,%rdi
+    1de0:	e8 9a f7 ff ff       	call   157f <cycles>
+  return t;
+    1de5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1de9:	c9                   	leave
+    1dea:	c3                   	ret
+
+0000000000001deb <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1deb:	55                   	push   %rbp
+    1dec:	48 89 e5             	mov    %rsp,%rbp
+    1def:	48 83 ec 30          	sub    $0x30,%rsp
+    1df3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1df7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1dfb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1dfe:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1e02:	0f 8e 24 01 00 00    	jle    1f2c <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1e08:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1e0f:	e9 98 00 00 00       	jmp    1eac <benchreport+0xc1>
+    x = t[i];
+    1e14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e17:	48 98                	cltq
+    1e19:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e20:	00 
+    1e21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e25:	48 01 d0             	add    %rdx,%rax
+    1e28:	48 8b 00             	mov    (%rax),%rax
+    1e2b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e32:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1e35:	eb 33                	jmp    1e6a <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1e37:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e3a:	48 98                	cltq
+    1e3c:	48 c1 e0 03          	shl    $0x3,%rax
+    1e40:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e48:	48 01 d0             	add    %rdx,%rax
+    1e4b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1e4e:	48 63 d2             	movslq %edx,%rdx
+    1e51:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1e58:	00 
+    1e59:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1e5d:	48 01 ca             	add    %rcx,%rdx
+    1e60:	48 8b 00             	mov    (%rax),%rax
+    1e63:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1e66:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1e6a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1e6e:	7e 1d                	jle    1e8d <benchreport+0xa2>
+    1e70:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e73:	48 98                	cltq
+    1e75:	48 c1 e0 03          	shl    $0x3,%rax
+    1e79:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1e7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e81:	48 01 d0             	add    %rdx,%rax
+    1e84:	48 8b 00             	mov    (%rax),%rax
+    1e87:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1e8b:	72 aa                	jb     1e37 <benchreport+0x4c>
+    t[j] = x;
+    1e8d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1e90:	48 98                	cltq
+    1e92:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e99:	00 
+    1e9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e9e:	48 01 c2             	add    %rax,%rdx
+    1ea1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ea5:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1ea8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1eac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1eaf:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1eb2:	0f 8c 5c ff ff ff    	jl     1e14 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1eb8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ebb:	48 98                	cltq
+    1ebd:	48 c1 e0 03          	shl    $0x3,%rax
+    1ec1:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ec5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ec9:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1ecc:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1ecf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ed2:	89 c2                	mov    %eax,%edx
+    1ed4:	c1 ea 1f             	shr    $0x1f,%edx
+    1ed7:	01 d0                	add    %edx,%eax
+    1ed9:	d1 f8                	sar    %eax
+    1edb:	48 98                	cltq
+    1edd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ee4:	00 
+    1ee5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ee9:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1eec:	48 8b 38             	mov    (%rax),%rdi
+    1eef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ef3:	48 8b 30             	mov    (%rax),%rsi
+    1ef6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1ef9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1efd:	48 83 ec 08          	sub    $0x8,%rsp
+    1f01:	51                   	push   %rcx
+    1f02:	49 89 f9             	mov    %rdi,%r9
+    1f05:	49 89 f0             	mov    %rsi,%r8
+    1f08:	89 d1                	mov    %edx,%ecx
+    1f0a:	48 89 c2             	mov    %rax,%rdx
+    1f0d:	48 8d 05 b4 00 00 00 	lea    0xb4(%rip),%rax        # 1fc8 <benchreport+0x1dd>
+    1f14:	48 89 c6             	mov    %rax,%rsi
+    1f17:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f21:	e8 f8 e3 ff ff       	call   31e <printf>
+    1f26:	48 83 c4 10          	add    $0x10,%rsp
+    1f2a:	eb 01                	jmp    1f2d <benchreport+0x142>
+    return;
+    1f2c:	90                   	nop
+}
+    1f2d:	c9                   	leave
+    1f2e:	c3                   	ret
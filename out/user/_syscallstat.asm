@@ -0,0 +1,3747 @@
+
+out/user/_syscallstat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <percentile>:
+
+static struct scstat st;
+static struct scproc procs[64];
+
+// Upper bound of the bucket holding the call at fraction num/den.
+static uint64_t percentile(uint *hist, uint64_t calls, int num, int den) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+       8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+       c:	89 55 cc             	mov    %edx,-0x34(%rbp)
+       f:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  uint64_t want, seen;
+  int b;
+
+  want = (calls * num + den - 1) / den;
+      12:	8b 45 cc             	mov    -0x34(%rbp),%eax
+      15:	48 98                	cltq
+      17:	48 0f af 45 d0       	imul   -0x30(%rbp),%rax
+      1c:	48 89 c2             	mov    %rax,%rdx
+      1f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+      22:	48 98                	cltq
+      24:	48 01 d0             	add    %rdx,%rax
+      27:	48 83 e8 01          	sub    $0x1,%rax
+      2b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+      2e:	48 63 f2             	movslq %edx,%rsi
+      31:	ba 00 00 00 00       	mov    $0x0,%edx
+      36:	48 f7 f6             	div    %rsi
+      39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  seen = 0;
+      3d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+      44:	00 
+  for (b = 0; b < NLATBUCKET - 1; b++)
+      45:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      4c:	eb 2a                	jmp    78 <percentile+0x78>
+    if ((seen += hist[b]) >= want)
+      4e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      51:	48 98                	cltq
+      53:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      5a:	00 
+      5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      5f:	48 01 d0             	add    %rdx,%rax
+      62:	8b 00                	mov    (%rax),%eax
+      64:	89 c0                	mov    %eax,%eax
+      66:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+      6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      6e:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+      72:	73 0c                	jae    80 <percentile+0x80>
+  for (b = 0; b < NLATBUCKET - 1; b++)
+      74:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+      78:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%rbp)
+      7c:	7e d0                	jle    4e <percentile+0x4e>
+      7e:	eb 01                	jmp    81 <percentile+0x81>
+      break;
+      80:	90                   	nop
+  return (2UL << b) - 1;
+      81:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      84:	ba 02 00 00 00       	mov    $0x2,%edx
+      89:	89 c1                	mov    %eax,%ecx
+      8b:	48 d3 e2             	shl    %cl,%rdx
+      8e:	48 89 d0             	mov    %rdx,%rax
+      91:	48 83 e8 01          	sub    $0x1,%rax
+}
+      95:	5d                   	pop    %rbp
+      96:	c3                   	ret
+
+0000000000000097 <main>:
+
+int main(int argc, char *argv[]) {
+      97:	55                   	push   %rbp
+      98:	48 89 e5             	mov    %rsp,%rbp
+      9b:	41 54                	push   %r12
+      9d:	53                   	push   %rbx
+      9e:	48 83 ec 20          	sub    $0x20,%rsp
+      a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+      a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int i, b, n;
+
+  if (argc > 1) {
+      a9:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+      ad:	0f 8e ec 01 00 00    	jle    29f <main+0x208>
+    if (strcmp(argv[1], "-r") == 0) {
+      b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+      b7:	48 83 c0 08          	add    $0x8,%rax
+      bb:	48 8b 00             	mov    (%rax),%rax
+      be:	48 8d 15 12 24 00 00 	lea    0x2412(%rip),%rdx        # 24d7 <benchreport+0x2d5>
+      c5:	48 89 d6             	mov    %rdx,%rsi
+      c8:	48 89 c7             	mov    %rax,%rdi
+      cb:	e8 98 0f 00 00       	call   1068 <strcmp>
+      d0:	85 c0                	test   %eax,%eax
+      d2:	75 19                	jne    ed <main+0x56>
+      syscallstat(SCS_RESET, 0, 0);
+      d4:	ba 00 00 00 00       	mov    $0x0,%edx
+      d9:	be 00 00 00 00       	mov    $0x0,%esi
+      de:	bf 02 00 00 00       	mov    $0x2,%edi
+      e3:	e8 8d 18 00 00       	call   1975 <syscallstat>
+      e8:	e9 ad 01 00 00       	jmp    29a <main+0x203>
+    } else if (strcmp(argv[1], "on") == 0) {
+      ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+      f1:	48 83 c0 08          	add    $0x8,%rax
+      f5:	48 8b 00             	mov    (%rax),%rax
+      f8:	48 8d 15 db 23 00 00 	lea    0x23db(%rip),%rdx        # 24da <benchreport+0x2d8>
+      ff:	48 89 d6             	mov    %rdx,%rsi
+     102:	48 89 c7             	mov    %rax,%rdi
+     105:	e8 5e 0f 00 00       	call   1068 <strcmp>
+     10a:	85 c0                	test   %eax,%eax
+     10c:	75 19                	jne    127 <main+0x90>
+      syscallstat(SCS_ON, 0, 0);
+     10e:	ba 00 00 00 00       	mov    $0x0,%edx
+     113:	be 00 00 00 00       	mov    $0x0,%esi
+     118:	bf 03 00 00 00       	mov    $0x3,%edi
+     11d:	e8 53 18 00 00       	call   1975 <syscallstat>
+     122:	e9 73 01 00 00       	jmp    29a <main+0x203>
+    } else if (strcmp(argv[1], "off") == 0) {
+     127:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     12b:	48 83 c0 08          	add    $0x8,%rax
+     12f:	48 8b 00             	mov    (%rax),%rax
+     132:	48 8d 15 a4 23 00 00 	lea    0x23a4(%rip),%rdx        # 24dd <benchreport+0x2db>
+     139:	48 89 d6             	mov    %rdx,%rsi
+     13c:	48 89 c7             	mov    %rax,%rdi
+     13f:	e8 24 0f 00 00       	call   1068 <strcmp>
+     144:	85 c0                	test   %eax,%eax
+     146:	75 19                	jne    161 <main+0xca>
+      syscallstat(SCS_OFF, 0, 0);
+     148:	ba 00 00 00 00       	mov    $0x0,%edx
+     14d:	be 00 00 00 00       	mov    $0x0,%esi
+     152:	bf 04 00 00 00       	mov    $0x4,%edi
+     157:	e8 19 18 00 00       	call   1975 <syscallstat>
+     15c:	e9 39 01 00 00       	jmp    29a <main+0x203>
+    } else if (strcmp(argv[1], "-p") == 0) {
+     161:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     165:	48 83 c0 08          	add    $0x8,%rax
+     169:	48 8b 00             	mov    (%rax),%rax
+     16c:	48 8d 15 6e 23 00 00 	lea    0x236e(%rip),%rdx        # 24e1 <benchreport+0x2df>
+     173:	48 89 d6             	mov    %rdx,%rsi
+     176:	48 89 c7             	mov    %rax,%rdi
+     179:	e8 ea 0e 00 00       	call   1068 <strcmp>
+     17e:	85 c0                	test   %eax,%eax
+     180:	0f 85 fb 00 00 00    	jne    281 <main+0x1ea>
+      n = syscallstat(SCS_PROCS, procs, sizeof(procs) / sizeof(procs[0]));
+     186:	ba 40 00 00 00       	mov    $0x40,%edx
+     18b:	48 8d 05 ce 56 00 00 	lea    0x56ce(%rip),%rax        # 5860 <procs>
+     192:	48 89 c6             	mov    %rax,%rsi
+     195:	bf 01 00 00 00       	mov    $0x1,%edi
+     19a:	e8 d6 17 00 00       	call   1975 <syscallstat>
+     19f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+      printf(1, "pid name calls cycles\n");
+     1a2:	48 8d 05 3b 23 00 00 	lea    0x233b(%rip),%rax        # 24e4 <benchreport+0x2e2>
+     1a9:	48 89 c6             	mov    %rax,%rsi
+     1ac:	bf 01 00 00 00       	mov    $0x1,%edi
+     1b1:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b6:	e8 7a 05 00 00       	call   735 <printf>
+      for (i = 0; i < n; i++)
+     1bb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     1c2:	e9 ac 00 00 00       	jmp    273 <main+0x1dc>
+        printf(1, "%d %s %ld %ld\n", procs[i].pid, procs[i].name,
+     1c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1ca:	48 63 d0             	movslq %eax,%rdx
+     1cd:	48 89 d0             	mov    %rdx,%rax
+     1d0:	48 c1 e0 02          	shl    $0x2,%rax
+     1d4:	48 01 d0             	add    %rdx,%rax
+     1d7:	48 c1 e0 03          	shl    $0x3,%rax
+     1db:	48 89 c2             	mov    %rax,%rdx
+     1de:	48 8d 05 9b 56 00 00 	lea    0x569b(%rip),%rax        # 5880 <procs+0x20>
+     1e5:	48 8b 3c 02          	mov    (%rdx,%rax,1),%rdi
+     1e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1ec:	48 63 d0             	movslq %eax,%rdx
+     1ef:	48 89 d0             	mov    %rdx,%rax
+     1f2:	48 c1 e0 02          	shl    $0x2,%rax
+     1f6:	48 01 d0             	add    %rdx,%rax
+     1f9:	48 c1 e0 03          	shl    $0x3,%rax
+     1fd:	48 89 c2             	mov    %rax,%rdx
+     200:	48 8d 05 71 56 00 00 	lea    0x5671(%rip),%rax        # 5878 <procs+0x18>
+     207:	48 8b 34 02          	mov    (%rdx,%rax,1),%rsi
+     20b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     20e:	48 63 d0             	movslq %eax,%rdx
+     211:	48 89 d0             	mov    %rdx,%rax
+     214:	48 c1 e0 02          	shl    $0x2,%rax
+     218:	48 01 d0             	add    %rdx,%rax
+     21b:	48 c1 e0 03          	shl    $0x3,%rax
+     21f:	48 8d 15 3a 56 00 00 	lea    0x563a(%rip),%rdx        # 5860 <procs>
+     226:	48 01 d0             	add    %rdx,%rax
+     229:	48 8d 48 04          	lea    0x4(%rax),%rcx
+     22d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     230:	48 63 d0             	movslq %eax,%rdx
+     233:	48 89 d0             	mov    %rdx,%rax
+     236:	48 c1 e0 02          	shl    $0x2,%rax
+     23a:	48 01 d0             	add    %rdx,%rax
+     23d:	48 c1 e0 03          	shl    $0x3,%rax
+     241:	48 89 c2             	mov    %rax,%rdx
+     244:	48 8d 05 15 56 00 00 	lea    0x5615(%rip),%rax        # 5860 <procs>
+     24b:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     24e:	49 89 f9             	mov    %rdi,%r9
+     251:	49 89 f0             	mov    %rsi,%r8
+     254:	89 c2                	mov    %eax,%edx
+     256:	48 8d 05 9e 22 00 00 	lea    0x229e(%rip),%rax        # 24fb <benchreport+0x2f9>
+     25d:	48 89 c6             	mov    %rax,%rsi
+     260:	bf 01 00 00 00       	mov    $0x1,%edi
+     265:	b8 00 00 00 00       	mov    $0x0,%eax
+     26a:	e8 c6 04 00 00       	call   735 <printf>
+      for (i = 0; i < n; i++)
+     26f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     273:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     276:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+     279:	0f 8c 48 ff ff ff    	jl     1c7 <main+0x130>
+     27f:	eb 19                	jmp    29a <main+0x203>
+               procs[i].calls, procs[i].cycles);
+    } else {
+      printf(2, "usage: syscallstat [-p | -r | on | off]\n");
+     281:	48 8d 05 88 22 00 00 	lea    0x2288(%rip),%rax        # 2510 <benchreport+0x30e>
+     288:	48 89 c6             	mov    %rax,%rsi
+     28b:	bf 02 00 00 00       	mov    $0x2,%edi
+     290:	b8 00 00 00 00       	mov    $0x0,%eax
+     295:	e8 9b 04 00 00       	call   735 <printf>
+    }
+    exit();
+     29a:	e8 c6 0a 00 00       	call   d65 <exit>
+  }
+
+  if (syscallstat(SCS_GET, &st, 0) < 0) {
+     29f:	ba 00 00 00 00       	mov    $0x0,%edx
+     2a4:	48 8d 05 95 2f 00 00 	lea    0x2f95(%rip),%rax        # 3240 <st>
+     2ab:	48 89 c6             	mov    %rax,%rsi
+     2ae:	bf 00 00 00 00       	mov    $0x0,%edi
+     2b3:	e8 bd 16 00 00       	call   1975 <syscallstat>
+     2b8:	85 c0                	test   %eax,%eax
+     2ba:	79 1e                	jns    2da <main+0x243>
+    printf(2, "syscallstat: failed\n");
+     2bc:	48 8d 05 76 22 00 00 	lea    0x2276(%rip),%rax        # 2539 <benchreport+0x337>
+     2c3:	48 89 c6             	mov    %rax,%rsi
+     2c6:	bf 02 00 00 00       	mov    $0x2,%edi
+     2cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d0:	e8 60 04 00 00       	call   735 <printf>
+    exit();
+     2d5:	e8 8b 0a 00 00       	call   d65 <exit>
+  }
+  if (!st.on)
+     2da:	8b 05 60 2f 00 00    	mov    0x2f60(%rip),%eax        # 3240 <st>
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	75 19                	jne    2fd <main+0x266>
+    printf(1, "(timing is off)\n");
+     2e4:	48 8d 05 63 22 00 00 	lea    0x2263(%rip),%rax        # 254e <benchreport+0x34c>
+     2eb:	48 89 c6             	mov    %rax,%rsi
+     2ee:	bf 01 00 00 00       	mov    $0x1,%edi
+     2f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f8:	e8 38 04 00 00       	call   735 <printf>
+  printf(1, "call calls mean p50 p99 max histogram\n");
+     2fd:	48 8d 05 5c 22 00 00 	lea    0x225c(%rip),%rax        # 2560 <benchreport+0x35e>
+     304:	48 89 c6             	mov    %rax,%rsi
+     307:	bf 01 00 00 00       	mov    $0x1,%edi
+     30c:	b8 00 00 00 00       	mov    $0x0,%eax
+     311:	e8 1f 04 00 00       	call   735 <printf>
+  for (i = 0; i < NSYSCALL; i++) {
+     316:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+     31d:	e9 46 02 00 00       	jmp    568 <main+0x4d1>
+    if (st.calls[i] == 0)
+     322:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     325:	48 98                	cltq
+     327:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     32e:	00 
+     32f:	48 8d 05 12 2f 00 00 	lea    0x2f12(%rip),%rax        # 3248 <st+0x8>
+     336:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     33a:	48 85 c0             	test   %rax,%rax
+     33d:	0f 84 20 02 00 00    	je     563 <main+0x4cc>
+      continue;
+    printf(1, "%s %ld %ld %ld %ld %ld", names[i] ? names[i] : "?", st.calls[i],
+     343:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     346:	48 98                	cltq
+     348:	48 83 e8 80          	sub    $0xffffffffffffff80,%rax
+     34c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     353:	00 
+     354:	48 8d 05 ed 2e 00 00 	lea    0x2eed(%rip),%rax        # 3248 <st+0x8>
+     35b:	4c 8b 24 02          	mov    (%rdx,%rax,1),%r12
+     35f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     362:	48 98                	cltq
+     364:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     36b:	00 
+     36c:	48 8d 05 d5 2e 00 00 	lea    0x2ed5(%rip),%rax        # 3248 <st+0x8>
+     373:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+           st.cycles[i] / st.calls[i], percentile(st.hist[i], st.calls[i], 1, 2),
+           percentile(st.hist[i], st.calls[i], 99, 100), st.max[i]);
+     377:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     37a:	48 63 d2             	movslq %edx,%rdx
+     37d:	48 83 c2 0c          	add    $0xc,%rdx
+     381:	48 89 d1             	mov    %rdx,%rcx
+     384:	48 c1 e1 07          	shl    $0x7,%rcx
+     388:	48 8d 15 b1 2e 00 00 	lea    0x2eb1(%rip),%rdx        # 3240 <st>
+     38f:	48 01 ca             	add    %rcx,%rdx
+     392:	48 8d 7a 08          	lea    0x8(%rdx),%rdi
+    printf(1, "%s %ld %ld %ld %ld %ld", names[i] ? names[i] : "?", st.calls[i],
+     396:	b9 64 00 00 00       	mov    $0x64,%ecx
+     39b:	ba 63 00 00 00       	mov    $0x63,%edx
+     3a0:	48 89 c6             	mov    %rax,%rsi
+     3a3:	e8 58 fc ff ff       	call   0 <percentile>
+     3a8:	48 89 c3             	mov    %rax,%rbx
+     3ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     3ae:	48 98                	cltq
+     3b0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     3b7:	00 
+     3b8:	48 8d 05 89 2e 00 00 	lea    0x2e89(%rip),%rax        # 3248 <st+0x8>
+     3bf:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+           st.cycles[i] / st.calls[i], percentile(st.hist[i], st.calls[i], 1, 2),
+     3c3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     3c6:	48 63 d2             	movslq %edx,%rdx
+     3c9:	48 83 c2 0c          	add    $0xc,%rdx
+     3cd:	48 89 d1             	mov    %rdx,%rcx
+     3d0:	48 c1 e1 07          	shl    $0x7,%rcx
+     3d4:	48 8d 15 65 2e 00 00 	lea    0x2e65(%rip),%rdx        # 3240 <st>
+     3db:	48 01 ca             	add    %rcx,%rdx
+     3de:	48 8d 7a 08          	lea    0x8(%rdx),%rdi
+    printf(1, "%s %ld %ld %ld %ld %ld", names[i] ? names[i] : "?", st.calls[i],
+     3e2:	b9 02 00 00 00       	mov    $0x2,%ecx
+     3e7:	ba 01 00 00 00       	mov    $0x1,%edx
+     3ec:	48 89 c6             	mov    %rax,%rsi
+     3ef:	e8 0c fc ff ff       	call   0 <percentile>
+     3f4:	48 89 c1             	mov    %rax,%rcx
+           st.cycles[i] / st.calls[i], percentile(st.hist[i], st.calls[i], 1, 2),
+     3f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     3fa:	48 98                	cltq
+     3fc:	48 83 c0 40          	add    $0x40,%rax
+     400:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     407:	00 
+     408:	48 8d 05 39 2e 00 00 	lea    0x2e39(%rip),%rax        # 3248 <st+0x8>
+     40f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     413:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     416:	48 63 d2             	movslq %edx,%rdx
+     419:	48 8d 34 d5 00 00 00 	lea    0x0(,%rdx,8),%rsi
+     420:	00 
+     421:	48 8d 15 20 2e 00 00 	lea    0x2e20(%rip),%rdx        # 3248 <st+0x8>
+     428:	48 8b 34 16          	mov    (%rsi,%rdx,1),%rsi
+    printf(1, "%s %ld %ld %ld %ld %ld", names[i] ? names[i] : "?", st.calls[i],
+     42c:	ba 00 00 00 00       	mov    $0x0,%edx
+     431:	48 f7 f6             	div    %rsi
+     434:	48 89 c7             	mov    %rax,%rdi
+     437:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     43a:	48 98                	cltq
+     43c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     443:	00 
+     444:	48 8d 05 fd 2d 00 00 	lea    0x2dfd(%rip),%rax        # 3248 <st+0x8>
+     44b:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+     44f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     452:	48 98                	cltq
+     454:	48 8d 34 c5 00 00 00 	lea    0x0(,%rax,8),%rsi
+     45b:	00 
+     45c:	48 8d 05 9d 2b 00 00 	lea    0x2b9d(%rip),%rax        # 3000 <names>
+     463:	48 8b 04 06          	mov    (%rsi,%rax,1),%rax
+     467:	48 85 c0             	test   %rax,%rax
+     46a:	74 1a                	je     486 <main+0x3ef>
+     46c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     46f:	48 98                	cltq
+     471:	48 8d 34 c5 00 00 00 	lea    0x0(,%rax,8),%rsi
+     478:	00 
+     479:	48 8d 05 80 2b 00 00 	lea    0x2b80(%rip),%rax        # 3000 <names>
+     480:	48 8b 04 06          	mov    (%rsi,%rax,1),%rax
+     484:	eb 07                	jmp    48d <main+0x3f6>
+     486:	48 8d 05 fa 20 00 00 	lea    0x20fa(%rip),%rax        # 2587 <benchreport+0x385>
+     48d:	41 54                	push   %r12
+     48f:	53                   	push   %rbx
+     490:	49 89 c9             	mov    %rcx,%r9
+     493:	49 89 f8             	mov    %rdi,%r8
+     496:	48 89 d1             	mov    %rdx,%rcx
+     499:	48 89 c2             	mov    %rax,%rdx
+     49c:	48 8d 05 e6 20 00 00 	lea    0x20e6(%rip),%rax        # 2589 <benchreport+0x387>
+     4a3:	48 89 c6             	mov    %rax,%rsi
+     4a6:	bf 01 00 00 00       	mov    $0x1,%edi
+     4ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b0:	e8 80 02 00 00       	call   735 <printf>
+     4b5:	48 83 c4 10          	add    $0x10,%rsp
+    for (b = 0; b < NLATBUCKET; b++)
+     4b9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+     4c0:	eb 7c                	jmp    53e <main+0x4a7>
+      if (st.hist[i][b])
+     4c2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     4c5:	48 98                	cltq
+     4c7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     4ca:	48 63 d2             	movslq %edx,%rdx
+     4cd:	48 c1 e2 05          	shl    $0x5,%rdx
+     4d1:	48 01 d0             	add    %rdx,%rax
+     4d4:	48 05 80 01 00 00    	add    $0x180,%rax
+     4da:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     4e1:	00 
+     4e2:	48 8d 05 5f 2d 00 00 	lea    0x2d5f(%rip),%rax        # 3248 <st+0x8>
+     4e9:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     4ec:	85 c0                	test   %eax,%eax
+     4ee:	74 4a                	je     53a <main+0x4a3>
+        printf(1, " %d:%d", b, st.hist[i][b]);
+     4f0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     4f3:	48 98                	cltq
+     4f5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     4f8:	48 63 d2             	movslq %edx,%rdx
+     4fb:	48 c1 e2 05          	shl    $0x5,%rdx
+     4ff:	48 01 d0             	add    %rdx,%rax
+     502:	48 05 80 01 00 00    	add    $0x180,%rax
+     508:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     50f:	00 
+     510:	48 8d 05 31 2d 00 00 	lea    0x2d31(%rip),%rax        # 3248 <st+0x8>
+     517:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     51a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     51d:	89 d1                	mov    %edx,%ecx
+     51f:	89 c2                	mov    %eax,%edx
+     521:	48 8d 05 78 20 00 00 	lea    0x2078(%rip),%rax        # 25a0 <benchreport+0x39e>
+     528:	48 89 c6             	mov    %rax,%rsi
+     52b:	bf 01 00 00 00       	mov    $0x1,%edi
+     530:	b8 00 00 00 00       	mov    $0x0,%eax
+     535:	e8 fb 01 00 00       	call   735 <printf>
+    for (b = 0; b < NLATBUCKET; b++)
+     53a:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+     53e:	83 7d e8 1f          	cmpl   $0x1f,-0x18(%rbp)
+     542:	0f 8e 7a ff ff ff    	jle    4c2 <main+0x42b>
+    printf(1, "\n");
+     548:	48 8d 05 58 20 00 00 	lea    0x2058(%rip),%rax        # 25a7 <benchreport+0x3a5>
+     54f:	48 89 c6             	mov    %rax,%rsi
+     552:	bf 01 00 00 00       	mov    $0x1,%edi
+     557:	b8 00 00 00 00       	mov    $0x0,%eax
+     55c:	e8 d4 01 00 00       	call   735 <printf>
+     561:	eb 01                	jmp    564 <main+0x4cd>
+      continue;
+     563:	90                   	nop
+  for (i = 0; i < NSYSCALL; i++) {
+     564:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+     568:	83 7d ec 3f          	cmpl   $0x3f,-0x14(%rbp)
+     56c:	0f 8e b0 fd ff ff    	jle    322 <main+0x28b>
+  }
+  exit();
+     572:	e8 ee 07 00 00       	call   d65 <exit>
+
+0000000000000577 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     577:	55                   	push   %rbp
+     578:	48 89 e5             	mov    %rsp,%rbp
+     57b:	48 83 ec 10          	sub    $0x10,%rsp
+     57f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     582:	89 f0                	mov    %esi,%eax
+     584:	88 45 f8             	mov    %al,-0x8(%rbp)
+     587:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     58b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     58e:	89 d6                	mov    %edx,%esi
+     590:	89 c7                	mov    %eax,%edi
+     592:	e8 eb 06 00 00       	call   c82 <bputc>
+     597:	90                   	nop
+     598:	c9                   	leave
+     599:	c3                   	ret
+
+000000000000059a <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     59a:	55                   	push   %rbp
+     59b:	48 89 e5             	mov    %rsp,%rbp
+     59e:	48 83 ec 50          	sub    $0x50,%rsp
+     5a2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     5a5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     5a9:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     5ac:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     5af:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     5b3:	74 21                	je     5d6 <printint64+0x3c>
+     5b5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     5b9:	48 c1 e8 3f          	shr    $0x3f,%rax
+     5bd:	0f b6 c0             	movzbl %al,%eax
+     5c0:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     5c3:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     5c7:	74 0d                	je     5d6 <printint64+0x3c>
+    x = -xx;
+     5c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     5cd:	48 f7 d8             	neg    %rax
+     5d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     5d4:	eb 08                	jmp    5de <printint64+0x44>
+  else
+    x = xx;
+     5d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     5da:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     5de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     5e5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     5e8:	48 63 c8             	movslq %eax,%rcx
+     5eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5ef:	ba 00 00 00 00       	mov    $0x0,%edx
+     5f4:	48 f7 f1             	div    %rcx
+     5f7:	48 89 d1             	mov    %rdx,%rcx
+     5fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5fd:	8d 50 01             	lea    0x1(%rax),%edx
+     600:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     603:	48 8d 15 f6 2b 00 00 	lea    0x2bf6(%rip),%rdx        # 3200 <digits.1>
+     60a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     60e:	48 98                	cltq
+     610:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     614:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     617:	48 63 f0             	movslq %eax,%rsi
+     61a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     61e:	ba 00 00 00 00       	mov    $0x0,%edx
+     623:	48 f7 f6             	div    %rsi
+     626:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     62a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     62f:	75 b4                	jne    5e5 <printint64+0x4b>
+
+  if (sgn)
+     631:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     635:	74 2b                	je     662 <printint64+0xc8>
+    buf[i++] = '-';
+     637:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     63a:	8d 50 01             	lea    0x1(%rax),%edx
+     63d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     640:	48 98                	cltq
+     642:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     647:	eb 19                	jmp    662 <printint64+0xc8>
+    putc(fd, buf[i]);
+     649:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     64c:	48 98                	cltq
+     64e:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     653:	0f be d0             	movsbl %al,%edx
+     656:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     659:	89 d6                	mov    %edx,%esi
+     65b:	89 c7                	mov    %eax,%edi
+     65d:	e8 15 ff ff ff       	call   577 <putc>
+  while (--i >= 0)
+     662:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     666:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     66a:	79 dd                	jns    649 <printint64+0xaf>
+}
+     66c:	90                   	nop
+     66d:	90                   	nop
+     66e:	c9                   	leave
+     66f:	c3                   	ret
+
+0000000000000670 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     670:	55                   	push   %rbp
+     671:	48 89 e5             	mov    %rsp,%rbp
+     674:	48 83 ec 30          	sub    $0x30,%rsp
+     678:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     67b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     67e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     681:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     684:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     68b:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     68f:	74 17                	je     6a8 <printint+0x38>
+     691:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     695:	79 11                	jns    6a8 <printint+0x38>
+    neg = 1;
+     697:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     69e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6a1:	f7 d8                	neg    %eax
+     6a3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6a6:	eb 06                	jmp    6ae <printint+0x3e>
+  } else {
+    x = xx;
+     6a8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6ab:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     6ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     6b5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     6b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     6bb:	ba 00 00 00 00       	mov    $0x0,%edx
+     6c0:	f7 f1                	div    %ecx
+     6c2:	89 d1                	mov    %edx,%ecx
+     6c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6c7:	8d 50 01             	lea    0x1(%rax),%edx
+     6ca:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     6cd:	89 c9                	mov    %ecx,%ecx
+     6cf:	48 8d 15 4a 2b 00 00 	lea    0x2b4a(%rip),%rdx        # 3220 <digits.0>
+     6d6:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     6da:	48 98                	cltq
+     6dc:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     6e0:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     6e3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     6e6:	ba 00 00 00 00       	mov    $0x0,%edx
+     6eb:	f7 f6                	div    %esi
+     6ed:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     6f4:	75 bf                	jne    6b5 <printint+0x45>
+  if (neg)
+     6f6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     6fa:	74 2b                	je     727 <printint+0xb7>
+    buf[i++] = '-';
+     6fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6ff:	8d 50 01             	lea    0x1(%rax),%edx
+     702:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     705:	48 98                	cltq
+     707:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     70c:	eb 19                	jmp    727 <printint+0xb7>
+    putc(fd, buf[i]);
+     70e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     711:	48 98                	cltq
+     713:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     718:	0f be d0             	movsbl %al,%edx
+     71b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     71e:	89 d6                	mov    %edx,%esi
+     720:	89 c7                	mov    %eax,%edi
+     722:	e8 50 fe ff ff       	call   577 <putc>
+  while (--i >= 0)
+     727:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     72b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     72f:	79 dd                	jns    70e <printint+0x9e>
+}
+     731:	90                   	nop
+     732:	90                   	nop
+     733:	c9                   	leave
+     734:	c3                   	ret
+
+0000000000000735 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     735:	55                   	push   %rbp
+     736:	48 89 e5             	mov    %rsp,%rbp
+     739:	48 83 ec 70          	sub    $0x70,%rsp
+     73d:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     740:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     744:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     748:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     74c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     750:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     754:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     75b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     75f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     763:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     767:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     76b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     772:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     779:	e9 67 02 00 00       	jmp    9e5 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     77e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     781:	48 63 d0             	movslq %eax,%rdx
+     784:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     788:	48 01 d0             	add    %rdx,%rax
+     78b:	0f b6 00             	movzbl (%rax),%eax
+     78e:	0f be c0             	movsbl %al,%eax
+     791:	25 ff 00 00 00       	and    $0xff,%eax
+     796:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     799:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     79d:	75 30                	jne    7cf <printf+0x9a>
+      if (c == '%') {
+     79f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     7a3:	75 13                	jne    7b8 <printf+0x83>
+        state = '%';
+     7a5:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     7ac:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     7b3:	e9 29 02 00 00       	jmp    9e1 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     7b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     7bb:	0f be d0             	movsbl %al,%edx
+     7be:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7c1:	89 d6                	mov    %edx,%esi
+     7c3:	89 c7                	mov    %eax,%edi
+     7c5:	e8 ad fd ff ff       	call   577 <putc>
+     7ca:	e9 12 02 00 00       	jmp    9e1 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     7cf:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     7d3:	0f 85 08 02 00 00    	jne    9e1 <printf+0x2ac>
+      if (c == 'l') {
+     7d9:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     7dd:	75 0c                	jne    7eb <printf+0xb6>
+        lflag = 1;
+     7df:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     7e6:	e9 f6 01 00 00       	jmp    9e1 <printf+0x2ac>
+      } else if (c == 'd') {
+     7eb:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     7ef:	0f 85 93 00 00 00    	jne    888 <printf+0x153>
+        if (lflag == 1)
+     7f5:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     7f9:	75 47                	jne    842 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     7fb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     7fe:	83 f8 2f             	cmp    $0x2f,%eax
+     801:	77 17                	ja     81a <printf+0xe5>
+     803:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     807:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     80a:	89 d2                	mov    %edx,%edx
+     80c:	48 01 d0             	add    %rdx,%rax
+     80f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     812:	83 c2 08             	add    $0x8,%edx
+     815:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     818:	eb 0c                	jmp    826 <printf+0xf1>
+     81a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     81e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     822:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     826:	48 8b 30             	mov    (%rax),%rsi
+     829:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     82c:	b9 01 00 00 00       	mov    $0x1,%ecx
+     831:	ba 0a 00 00 00       	mov    $0xa,%edx
+     836:	89 c7                	mov    %eax,%edi
+     838:	e8 5d fd ff ff       	call   59a <printint64>
+     83d:	e9 98 01 00 00       	jmp    9da <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     842:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     845:	83 f8 2f             	cmp    $0x2f,%eax
+     848:	77 17                	ja     861 <printf+0x12c>
+     84a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     84e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     851:	89 d2                	mov    %edx,%edx
+     853:	48 01 d0             	add    %rdx,%rax
+     856:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     859:	83 c2 08             	add    $0x8,%edx
+     85c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     85f:	eb 0c                	jmp    86d <printf+0x138>
+     861:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     865:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     869:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     86d:	8b 30                	mov    (%rax),%esi
+     86f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     872:	b9 01 00 00 00       	mov    $0x1,%ecx
+     877:	ba 0a 00 00 00       	mov    $0xa,%edx
+     87c:	89 c7                	mov    %eax,%edi
+     87e:	e8 ed fd ff ff       	call   670 <printint>
+     883:	e9 52 01 00 00       	jmp    9da <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     888:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     88c:	74 0a                	je     898 <printf+0x163>
+     88e:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     892:	0f 85 93 00 00 00    	jne    92b <printf+0x1f6>
+        if (lflag == 1)
+     898:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     89c:	75 47                	jne    8e5 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     89e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8a1:	83 f8 2f             	cmp    $0x2f,%eax
+     8a4:	77 17                	ja     8bd <printf+0x188>
+     8a6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8aa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8ad:	89 d2                	mov    %edx,%edx
+     8af:	48 01 d0             	add    %rdx,%rax
+     8b2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8b5:	83 c2 08             	add    $0x8,%edx
+     8b8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     8bb:	eb 0c                	jmp    8c9 <printf+0x194>
+     8bd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8c1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8c5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     8c9:	48 8b 30             	mov    (%rax),%rsi
+     8cc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+     8d4:	ba 10 00 00 00       	mov    $0x10,%edx
+     8d9:	89 c7                	mov    %eax,%edi
+     8db:	e8 ba fc ff ff       	call   59a <printint64>
+        if (lflag == 1)
+     8e0:	e9 f5 00 00 00       	jmp    9da <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     8e5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8e8:	83 f8 2f             	cmp    $0x2f,%eax
+     8eb:	77 17                	ja     904 <printf+0x1cf>
+     8ed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8f1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8f4:	89 d2                	mov    %edx,%edx
+     8f6:	48 01 d0             	add    %rdx,%rax
+     8f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8fc:	83 c2 08             	add    $0x8,%edx
+     8ff:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     902:	eb 0c                	jmp    910 <printf+0x1db>
+     904:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     908:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     90c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     910:	8b 30                	mov    (%rax),%esi
+     912:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     915:	b9 00 00 00 00       	mov    $0x0,%ecx
+     91a:	ba 10 00 00 00       	mov    $0x10,%edx
+     91f:	89 c7                	mov    %eax,%edi
+     921:	e8 4a fd ff ff       	call   670 <printint>
+        if (lflag == 1)
+     926:	e9 af 00 00 00       	jmp    9da <printf+0x2a5>
+      } else if (c == 's') {
+     92b:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     92f:	75 6e                	jne    99f <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     931:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     934:	83 f8 2f             	cmp    $0x2f,%eax
+     937:	77 17                	ja     950 <printf+0x21b>
+     939:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     93d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     940:	89 d2                	mov    %edx,%edx
+     942:	48 01 d0             	add    %rdx,%rax
+     945:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     948:	83 c2 08             	add    $0x8,%edx
+     94b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     94e:	eb 0c                	jmp    95c <printf+0x227>
+     950:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     954:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     958:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     95c:	48 8b 00             	mov    (%rax),%rax
+     95f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     963:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     968:	75 28                	jne    992 <printf+0x25d>
+          s = "(null)";
+     96a:	48 8d 05 38 1c 00 00 	lea    0x1c38(%rip),%rax        # 25a9 <benchreport+0x3a7>
+     971:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     975:	eb 1b                	jmp    992 <printf+0x25d>
+          putc(fd, *s);
+     977:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     97b:	0f b6 00             	movzbl (%rax),%eax
+     97e:	0f be d0             	movsbl %al,%edx
+     981:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     984:	89 d6                	mov    %edx,%esi
+     986:	89 c7                	mov    %eax,%edi
+     988:	e8 ea fb ff ff       	call   577 <putc>
+        for (; *s; s++)
+     98d:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     992:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     996:	0f b6 00             	movzbl (%rax),%eax
+     999:	84 c0                	test   %al,%al
+     99b:	75 da                	jne    977 <printf+0x242>
+     99d:	eb 3b                	jmp    9da <printf+0x2a5>
+      } else if (c == '%') {
+     99f:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     9a3:	75 14                	jne    9b9 <printf+0x284>
+        putc(fd, c);
+     9a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     9a8:	0f be d0             	movsbl %al,%edx
+     9ab:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9ae:	89 d6                	mov    %edx,%esi
+     9b0:	89 c7                	mov    %eax,%edi
+     9b2:	e8 c0 fb ff ff       	call   577 <putc>
+     9b7:	eb 21                	jmp    9da <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     9b9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9bc:	be 25 00 00 00       	mov    $0x25,%esi
+     9c1:	89 c7                	mov    %eax,%edi
+     9c3:	e8 af fb ff ff       	call   577 <putc>
+        putc(fd, c);
+     9c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     9cb:	0f be d0             	movsbl %al,%edx
+     9ce:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9d1:	89 d6                	mov    %edx,%esi
+     9d3:	89 c7                	mov    %eax,%edi
+     9d5:	e8 9d fb ff ff       	call   577 <putc>
+      }
+      state = 0;
+     9da:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     9e1:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     9e5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     9e8:	48 63 d0             	movslq %eax,%rdx
+     9eb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     9ef:	48 01 d0             	add    %rdx,%rax
+     9f2:	0f b6 00             	movzbl (%rax),%eax
+     9f5:	84 c0                	test   %al,%al
+     9f7:	0f 85 81 fd ff ff    	jne    77e <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     9fd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a00:	89 c7                	mov    %eax,%edi
+     a02:	e8 ee 02 00 00       	call   cf5 <bflushtty>
+}
+     a07:	90                   	nop
+     a08:	c9                   	leave
+     a09:	c3                   	ret
+
+0000000000000a0a <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     a0a:	55                   	push   %rbp
+     a0b:	48 89 e5             	mov    %rsp,%rbp
+     a0e:	48 83 ec 30          	sub    $0x30,%rsp
+     a12:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     a15:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     a19:	78 06                	js     a21 <getbuf+0x17>
+     a1b:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     a1f:	7e 0a                	jle    a2b <getbuf+0x21>
+    return 0;
+     a21:	b8 00 00 00 00       	mov    $0x0,%eax
+     a26:	e9 94 00 00 00       	jmp    abf <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     a2b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a2e:	48 98                	cltq
+     a30:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a37:	00 
+     a38:	48 8d 05 21 58 00 00 	lea    0x5821(%rip),%rax        # 6260 <obufs>
+     a3f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a43:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a47:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a4c:	75 6d                	jne    abb <getbuf+0xb1>
+     a4e:	bf 08 02 00 00       	mov    $0x208,%edi
+     a53:	e8 bd 13 00 00       	call   1e15 <malloc>
+     a58:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a5c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a61:	74 58                	je     abb <getbuf+0xb1>
+    b->n = 0;
+     a63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a67:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     a6d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     a71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a74:	48 89 d6             	mov    %rdx,%rsi
+     a77:	89 c7                	mov    %eax,%edi
+     a79:	e8 e4 0d 00 00       	call   1862 <fstat>
+     a7e:	85 c0                	test   %eax,%eax
+     a80:	75 11                	jne    a93 <getbuf+0x89>
+     a82:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     a86:	66 83 f8 03          	cmp    $0x3,%ax
+     a8a:	75 07                	jne    a93 <getbuf+0x89>
+     a8c:	ba 01 00 00 00       	mov    $0x1,%edx
+     a91:	eb 05                	jmp    a98 <getbuf+0x8e>
+     a93:	ba 00 00 00 00       	mov    $0x0,%edx
+     a98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a9c:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     a9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     aa2:	48 98                	cltq
+     aa4:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     aab:	00 
+     aac:	48 8d 15 ad 57 00 00 	lea    0x57ad(%rip),%rdx        # 6260 <obufs>
+     ab3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ab7:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     abb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     abf:	c9                   	leave
+     ac0:	c3                   	ret
+
+0000000000000ac1 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     ac1:	55                   	push   %rbp
+     ac2:	48 89 e5             	mov    %rsp,%rbp
+     ac5:	48 83 ec 20          	sub    $0x20,%rsp
+     ac9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     acc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     ad0:	78 33                	js     b05 <bflush+0x44>
+     ad2:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     ad6:	7f 2d                	jg     b05 <bflush+0x44>
+     ad8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     adb:	48 98                	cltq
+     add:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ae4:	00 
+     ae5:	48 8d 05 74 57 00 00 	lea    0x5774(%rip),%rax        # 6260 <obufs>
+     aec:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     af0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     af4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     af9:	74 0a                	je     b05 <bflush+0x44>
+     afb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aff:	8b 00                	mov    (%rax),%eax
+     b01:	85 c0                	test   %eax,%eax
+     b03:	75 07                	jne    b0c <bflush+0x4b>
+    return 0;
+     b05:	b8 00 00 00 00       	mov    $0x0,%eax
+     b0a:	eb 3c                	jmp    b48 <bflush+0x87>
+  n = b->n;
+     b0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b10:	8b 00                	mov    (%rax),%eax
+     b12:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     b15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b19:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     b1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b23:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     b27:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     b2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     b2d:	48 89 ce             	mov    %rcx,%rsi
+     b30:	89 c7                	mov    %eax,%edi
+     b32:	e8 de 0c 00 00       	call   1815 <write>
+     b37:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     b3a:	75 07                	jne    b43 <bflush+0x82>
+     b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b41:	eb 05                	jmp    b48 <bflush+0x87>
+     b43:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     b48:	c9                   	leave
+     b49:	c3                   	ret
+
+0000000000000b4a <bflushall>:
+
+void bflushall(void) {
+     b4a:	55                   	push   %rbp
+     b4b:	48 89 e5             	mov    %rsp,%rbp
+     b4e:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     b52:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b59:	eb 0e                	jmp    b69 <bflushall+0x1f>
+    bflush(fd);
+     b5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b5e:	89 c7                	mov    %eax,%edi
+     b60:	e8 5c ff ff ff       	call   ac1 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     b65:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b69:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     b6d:	7e ec                	jle    b5b <bflushall+0x11>
+}
+     b6f:	90                   	nop
+     b70:	90                   	nop
+     b71:	c9                   	leave
+     b72:	c3                   	ret
+
+0000000000000b73 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     b73:	55                   	push   %rbp
+     b74:	48 89 e5             	mov    %rsp,%rbp
+     b77:	48 83 ec 30          	sub    $0x30,%rsp
+     b7b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     b7e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     b82:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     b85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     b88:	89 c7                	mov    %eax,%edi
+     b8a:	e8 7b fe ff ff       	call   a0a <getbuf>
+     b8f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     b93:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     b98:	75 19                	jne    bb3 <bwrite+0x40>
+    return write(fd, s, n);
+     b9a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     b9d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     ba1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ba4:	48 89 ce             	mov    %rcx,%rsi
+     ba7:	89 c7                	mov    %eax,%edi
+     ba9:	e8 67 0c 00 00       	call   1815 <write>
+     bae:	e9 cd 00 00 00       	jmp    c80 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     bb3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     bba:	e9 92 00 00 00       	jmp    c51 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bc3:	8b 00                	mov    (%rax),%eax
+     bc5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     bca:	75 18                	jne    be4 <bwrite+0x71>
+     bcc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     bcf:	89 c7                	mov    %eax,%edi
+     bd1:	e8 eb fe ff ff       	call   ac1 <bflush>
+     bd6:	85 c0                	test   %eax,%eax
+     bd8:	79 0a                	jns    be4 <bwrite+0x71>
+      return -1;
+     bda:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bdf:	e9 9c 00 00 00       	jmp    c80 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     be4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     be7:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     bea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     bed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bf1:	8b 00                	mov    (%rax),%eax
+     bf3:	ba 00 02 00 00       	mov    $0x200,%edx
+     bf8:	29 c2                	sub    %eax,%edx
+     bfa:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     bfd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c00:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     c03:	39 c2                	cmp    %eax,%edx
+     c05:	0f 4e c2             	cmovle %edx,%eax
+     c08:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     c0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c0e:	48 63 d0             	movslq %eax,%rdx
+     c11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c15:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     c19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c1d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c25:	8b 00                	mov    (%rax),%eax
+     c27:	48 98                	cltq
+     c29:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     c2d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c30:	89 c2                	mov    %eax,%edx
+     c32:	48 89 cf             	mov    %rcx,%rdi
+     c35:	e8 e9 06 00 00       	call   1323 <memmove>
+    b->n += m;
+     c3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c3e:	8b 10                	mov    (%rax),%edx
+     c40:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c43:	01 c2                	add    %eax,%edx
+     c45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c49:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     c4b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c4e:	01 45 fc             	add    %eax,-0x4(%rbp)
+     c51:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c54:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     c57:	0f 8c 62 ff ff ff    	jl     bbf <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     c5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c61:	8b 40 04             	mov    0x4(%rax),%eax
+     c64:	85 c0                	test   %eax,%eax
+     c66:	74 15                	je     c7d <bwrite+0x10a>
+     c68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     c6b:	89 c7                	mov    %eax,%edi
+     c6d:	e8 4f fe ff ff       	call   ac1 <bflush>
+     c72:	85 c0                	test   %eax,%eax
+     c74:	79 07                	jns    c7d <bwrite+0x10a>
+    return -1;
+     c76:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c7b:	eb 03                	jmp    c80 <bwrite+0x10d>
+  return n;
+     c7d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     c80:	c9                   	leave
+     c81:	c3                   	ret
+
+0000000000000c82 <bputc>:
+
+void bputc(int fd, char c) {
+     c82:	55                   	push   %rbp
+     c83:	48 89 e5             	mov    %rsp,%rbp
+     c86:	48 83 ec 20          	sub    $0x20,%rsp
+     c8a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     c8d:	89 f0                	mov    %esi,%eax
+     c8f:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     c92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c95:	89 c7                	mov    %eax,%edi
+     c97:	e8 6e fd ff ff       	call   a0a <getbuf>
+     c9c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     ca0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     ca5:	75 18                	jne    cbf <bputc+0x3d>
+    write(fd, &c, 1);
+     ca7:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     cab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     cae:	ba 01 00 00 00       	mov    $0x1,%edx
+     cb3:	48 89 ce             	mov    %rcx,%rsi
+     cb6:	89 c7                	mov    %eax,%edi
+     cb8:	e8 58 0b 00 00       	call   1815 <write>
+    return;
+     cbd:	eb 34                	jmp    cf3 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     cbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cc3:	8b 00                	mov    (%rax),%eax
+     cc5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     cca:	75 0a                	jne    cd6 <bputc+0x54>
+    bflush(fd);
+     ccc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ccf:	89 c7                	mov    %eax,%edi
+     cd1:	e8 eb fd ff ff       	call   ac1 <bflush>
+  b->data[b->n++] = c;
+     cd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cda:	8b 00                	mov    (%rax),%eax
+     cdc:	8d 48 01             	lea    0x1(%rax),%ecx
+     cdf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     ce3:	89 0a                	mov    %ecx,(%rdx)
+     ce5:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     ce9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     ced:	48 98                	cltq
+     cef:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     cf3:	c9                   	leave
+     cf4:	c3                   	ret
+
+0000000000000cf5 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     cf5:	55                   	push   %rbp
+     cf6:	48 89 e5             	mov    %rsp,%rbp
+     cf9:	48 83 ec 10          	sub    $0x10,%rsp
+     cfd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     d00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d04:	78 4c                	js     d52 <bflushtty+0x5d>
+     d06:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     d0a:	7f 46                	jg     d52 <bflushtty+0x5d>
+     d0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d0f:	48 98                	cltq
+     d11:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d18:	00 
+     d19:	48 8d 05 40 55 00 00 	lea    0x5540(%rip),%rax        # 6260 <obufs>
+     d20:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d24:	48 85 c0             	test   %rax,%rax
+     d27:	74 29                	je     d52 <bflushtty+0x5d>
+     d29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d2c:	48 98                	cltq
+     d2e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d35:	00 
+     d36:	48 8d 05 23 55 00 00 	lea    0x5523(%rip),%rax        # 6260 <obufs>
+     d3d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d41:	8b 40 04             	mov    0x4(%rax),%eax
+     d44:	85 c0                	test   %eax,%eax
+     d46:	74 0a                	je     d52 <bflushtty+0x5d>
+    bflush(fd);
+     d48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d4b:	89 c7                	mov    %eax,%edi
+     d4d:	e8 6f fd ff ff       	call   ac1 <bflush>
+}
+     d52:	90                   	nop
+     d53:	c9                   	leave
+     d54:	c3                   	ret
+
+0000000000000d55 <fork>:
+
+int fork(void) {
+     d55:	55                   	push   %rbp
+     d56:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     d59:	e8 ec fd ff ff       	call   b4a <bflushall>
+  return _fork();
+     d5e:	e8 7b 0a 00 00       	call   17de <_fork>
+}
+     d63:	5d                   	pop    %rbp
+     d64:	c3                   	ret
+
+0000000000000d65 <exit>:
+
+noreturn void exit(void) {
+     d65:	55                   	push   %rbp
+     d66:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     d69:	e8 dc fd ff ff       	call   b4a <bflushall>
+  _exit();
+     d6e:	e8 76 0a 00 00       	call   17e9 <_exit>
+
+0000000000000d73 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     d73:	55                   	push   %rbp
+     d74:	48 89 e5             	mov    %rsp,%rbp
+     d77:	48 83 ec 10          	sub    $0x10,%rsp
+     d7b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d7f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     d83:	e8 c2 fd ff ff       	call   b4a <bflushall>
+  return _exec(path, argv);
+     d88:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d90:	48 89 d6             	mov    %rdx,%rsi
+     d93:	48 89 c7             	mov    %rax,%rdi
+     d96:	e8 9b 0a 00 00       	call   1836 <_exec>
+}
+     d9b:	c9                   	leave
+     d9c:	c3                   	ret
+
+0000000000000d9d <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     d9d:	55                   	push   %rbp
+     d9e:	48 89 e5             	mov    %rsp,%rbp
+     da1:	48 83 ec 20          	sub    $0x20,%rsp
+     da5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     da9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     dad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     db1:	e8 94 fd ff ff       	call   b4a <bflushall>
+  return _spawn(path, argv, fds);
+     db6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     dba:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     dbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc2:	48 89 ce             	mov    %rcx,%rsi
+     dc5:	48 89 c7             	mov    %rax,%rdi
+     dc8:	e8 2f 0b 00 00       	call   18fc <_spawn>
+}
+     dcd:	c9                   	leave
+     dce:	c3                   	ret
+
+0000000000000dcf <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     dcf:	55                   	push   %rbp
+     dd0:	48 89 e5             	mov    %rsp,%rbp
+     dd3:	48 83 ec 10          	sub    $0x10,%rsp
+     dd7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     dda:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     dde:	78 69                	js     e49 <close+0x7a>
+     de0:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     de4:	7f 63                	jg     e49 <close+0x7a>
+     de6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     de9:	48 98                	cltq
+     deb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     df2:	00 
+     df3:	48 8d 05 66 54 00 00 	lea    0x5466(%rip),%rax        # 6260 <obufs>
+     dfa:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     dfe:	48 85 c0             	test   %rax,%rax
+     e01:	74 46                	je     e49 <close+0x7a>
+    bflush(fd);
+     e03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e06:	89 c7                	mov    %eax,%edi
+     e08:	e8 b4 fc ff ff       	call   ac1 <bflush>
+    free(obufs[fd]);
+     e0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e10:	48 98                	cltq
+     e12:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e19:	00 
+     e1a:	48 8d 05 3f 54 00 00 	lea    0x543f(%rip),%rax        # 6260 <obufs>
+     e21:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     e25:	48 89 c7             	mov    %rax,%rdi
+     e28:	e8 90 11 00 00       	call   1fbd <free>
+    obufs[fd] = 0;
+     e2d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e30:	48 98                	cltq
+     e32:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e39:	00 
+     e3a:	48 8d 05 1f 54 00 00 	lea    0x541f(%rip),%rax        # 6260 <obufs>
+     e41:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     e48:	00 
+  }
+  return _close(fd);
+     e49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e4c:	89 c7                	mov    %eax,%edi
+     e4e:	e8 cd 09 00 00       	call   1820 <_close>
+}
+     e53:	c9                   	leave
+     e54:	c3                   	ret
+
+0000000000000e55 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     e55:	55                   	push   %rbp
+     e56:	48 89 e5             	mov    %rsp,%rbp
+     e59:	53                   	push   %rbx
+     e5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     e62:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     e66:	48 8b 36             	mov    (%rsi),%rsi
+     e69:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     e6d:	48 29 f7             	sub    %rsi,%rdi
+     e70:	48 89 f9             	mov    %rdi,%rcx
+     e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e78:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     e7c:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     e80:	48 89 f0             	mov    %rsi,%rax
+     e83:	ba 00 00 00 00       	mov    $0x0,%edx
+     e88:	48 89 df             	mov    %rbx,%rdi
+     e8b:	48 0f af f8          	imul   %rax,%rdi
+     e8f:	48 89 d6             	mov    %rdx,%rsi
+     e92:	48 0f af f1          	imul   %rcx,%rsi
+     e96:	48 01 fe             	add    %rdi,%rsi
+     e99:	48 f7 e1             	mul    %rcx
+     e9c:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     ea0:	48 89 ca             	mov    %rcx,%rdx
+     ea3:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     ea8:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     eac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     eb0:	c9                   	leave
+     eb1:	c3                   	ret
+
+0000000000000eb2 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     eb2:	55                   	push   %rbp
+     eb3:	48 89 e5             	mov    %rsp,%rbp
+     eb6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     eba:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ebd:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     ec0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ec4:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     ec7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     eca:	48 89 ce             	mov    %rcx,%rsi
+     ecd:	48 89 f7             	mov    %rsi,%rdi
+     ed0:	89 d1                	mov    %edx,%ecx
+     ed2:	fc                   	cld
+     ed3:	f3 aa                	rep stos %al,%es:(%rdi)
+     ed5:	89 ca                	mov    %ecx,%edx
+     ed7:	48 89 fe             	mov    %rdi,%rsi
+     eda:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     ede:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     ee1:	90                   	nop
+     ee2:	5d                   	pop    %rbp
+     ee3:	c3                   	ret
+
+0000000000000ee4 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     ee4:	55                   	push   %rbp
+     ee5:	48 89 e5             	mov    %rsp,%rbp
+     ee8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     eec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     ef0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     ef4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ef8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     efc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f00:	48 89 ce             	mov    %rcx,%rsi
+     f03:	48 89 f7             	mov    %rsi,%rdi
+     f06:	48 89 d1             	mov    %rdx,%rcx
+     f09:	fc                   	cld
+     f0a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     f0d:	48 89 ca             	mov    %rcx,%rdx
+     f10:	48 89 fe             	mov    %rdi,%rsi
+     f13:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     f17:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     f1b:	90                   	nop
+     f1c:	5d                   	pop    %rbp
+     f1d:	c3                   	ret
+
+0000000000000f1e <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     f1e:	55                   	push   %rbp
+     f1f:	48 89 e5             	mov    %rsp,%rbp
+     f22:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f26:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     f2a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     f2e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f3a:	48 89 cf             	mov    %rcx,%rdi
+     f3d:	48 89 d6             	mov    %rdx,%rsi
+     f40:	48 89 c1             	mov    %rax,%rcx
+     f43:	fc                   	cld
+     f44:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     f46:	48 89 c8             	mov    %rcx,%rax
+     f49:	48 89 f2             	mov    %rsi,%rdx
+     f4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f50:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     f54:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     f58:	90                   	nop
+     f59:	5d                   	pop    %rbp
+     f5a:	c3                   	ret
+
+0000000000000f5b <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     f5b:	55                   	push   %rbp
+     f5c:	48 89 e5             	mov    %rsp,%rbp
+     f5f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     f67:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     f6b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     f6f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f77:	48 89 cf             	mov    %rcx,%rdi
+     f7a:	48 89 d6             	mov    %rdx,%rsi
+     f7d:	48 89 c1             	mov    %rax,%rcx
+     f80:	fc                   	cld
+     f81:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     f84:	48 89 c8             	mov    %rcx,%rax
+     f87:	48 89 f2             	mov    %rsi,%rdx
+     f8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f8e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     f92:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     f96:	90                   	nop
+     f97:	5d                   	pop    %rbp
+     f98:	c3                   	ret
+
+0000000000000f99 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     f99:	55                   	push   %rbp
+     f9a:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     f9d:	0f 31                	rdtsc
+     f9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     fa2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     fa5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     fa8:	48 c1 e0 20          	shl    $0x20,%rax
+     fac:	48 89 c2             	mov    %rax,%rdx
+     faf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fb2:	48 09 d0             	or     %rdx,%rax
+}
+     fb5:	5d                   	pop    %rbp
+     fb6:	c3                   	ret
+
+0000000000000fb7 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     fb7:	55                   	push   %rbp
+     fb8:	48 89 e5             	mov    %rsp,%rbp
+     fbb:	53                   	push   %rbx
+     fbc:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     fbf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     fc3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     fc7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     fcb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     fcf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     fd2:	0f a2                	cpuid
+     fd4:	89 de                	mov    %ebx,%esi
+     fd6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     fd9:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     fdc:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     fdf:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     fe2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     fe7:	74 09                	je     ff2 <cpuid+0x3b>
+    *eaxp = eax;
+     fe9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     fed:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     ff0:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     ff2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     ff7:	74 09                	je     1002 <cpuid+0x4b>
+    *ebxp = ebx;
+     ff9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ffd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1000:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    1002:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1007:	74 09                	je     1012 <cpuid+0x5b>
+    *ecxp = ecx;
+    1009:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    100d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1010:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    1012:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    1017:	74 09                	je     1022 <cpuid+0x6b>
+    *edxp = edx;
+    1019:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    101d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    1020:	89 10                	mov    %edx,(%rax)
+}
+    1022:	90                   	nop
+    1023:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1027:	c9                   	leave
+    1028:	c3                   	ret
+
+0000000000001029 <strcpy>:
+char *strcpy(char *s, char *t) {
+    1029:	55                   	push   %rbp
+    102a:	48 89 e5             	mov    %rsp,%rbp
+    102d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1031:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1035:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1039:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    103d:	90                   	nop
+    103e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1042:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1046:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    104a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    104e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1052:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1056:	0f b6 12             	movzbl (%rdx),%edx
+    1059:	88 10                	mov    %dl,(%rax)
+    105b:	0f b6 00             	movzbl (%rax),%eax
+    105e:	84 c0                	test   %al,%al
+    1060:	75 dc                	jne    103e <strcpy+0x15>
+  return os;
+    1062:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1066:	5d                   	pop    %rbp
+    1067:	c3                   	ret
+
+0000000000001068 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1068:	55                   	push   %rbp
+    1069:	48 89 e5             	mov    %rsp,%rbp
+    106c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1070:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1074:	eb 0a                	jmp    1080 <strcmp+0x18>
+    p++, q++;
+    1076:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    107b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    1080:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1084:	0f b6 00             	movzbl (%rax),%eax
+    1087:	84 c0                	test   %al,%al
+    1089:	74 12                	je     109d <strcmp+0x35>
+    108b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    108f:	0f b6 10             	movzbl (%rax),%edx
+    1092:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1096:	0f b6 00             	movzbl (%rax),%eax
+    1099:	38 c2                	cmp    %al,%dl
+    109b:	74 d9                	je     1076 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    109d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a1:	0f b6 00             	movzbl (%rax),%eax
+    10a4:	0f b6 d0             	movzbl %al,%edx
+    10a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10ab:	0f b6 00             	movzbl (%rax),%eax
+    10ae:	0f b6 c0             	movzbl %al,%eax
+    10b1:	29 c2                	sub    %eax,%edx
+    10b3:	89 d0                	mov    %edx,%eax
+}
+    10b5:	5d                   	pop    %rbp
+    10b6:	c3                   	ret
+
+00000000000010b7 <strlen>:
+uint strlen(char *s) {
+    10b7:	55                   	push   %rbp
+    10b8:	48 89 e5             	mov    %rsp,%rbp
+    10bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    10bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10c6:	eb 04                	jmp    10cc <strlen+0x15>
+    10c8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10cf:	48 63 d0             	movslq %eax,%rdx
+    10d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10d6:	48 01 d0             	add    %rdx,%rax
+    10d9:	0f b6 00             	movzbl (%rax),%eax
+    10dc:	84 c0                	test   %al,%al
+    10de:	75 e8                	jne    10c8 <strlen+0x11>
+    ;
+  return n;
+    10e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    10e3:	5d                   	pop    %rbp
+    10e4:	c3                   	ret
+
+00000000000010e5 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    10e5:	55                   	push   %rbp
+    10e6:	48 89 e5             	mov    %rsp,%rbp
+    10e9:	53                   	push   %rbx
+    10ea:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    10ee:	8b 05 40 21 00 00    	mov    0x2140(%rip),%eax        # 3234 <erms>
+    10f4:	85 c0                	test   %eax,%eax
+    10f6:	79 53                	jns    114b <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    10f8:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    10fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    1102:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1107:	ba 00 00 00 00       	mov    $0x0,%edx
+    110c:	48 89 c6             	mov    %rax,%rsi
+    110f:	bf 00 00 00 00       	mov    $0x0,%edi
+    1114:	e8 9e fe ff ff       	call   fb7 <cpuid>
+    ebx = 0;
+    1119:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    1120:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1123:	83 f8 06             	cmp    $0x6,%eax
+    1126:	76 14                	jbe    113c <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    1128:	b8 07 00 00 00       	mov    $0x7,%eax
+    112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1132:	0f a2                	cpuid
+    1134:	89 d9                	mov    %ebx,%ecx
+    1136:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    1139:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    113c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    113f:	c1 e8 09             	shr    $0x9,%eax
+    1142:	83 e0 01             	and    $0x1,%eax
+    1145:	89 05 e9 20 00 00    	mov    %eax,0x20e9(%rip)        # 3234 <erms>
+  }
+  return erms;
+    114b:	8b 05 e3 20 00 00    	mov    0x20e3(%rip),%eax        # 3234 <erms>
+}
+    1151:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1155:	c9                   	leave
+    1156:	c3                   	ret
+
+0000000000001157 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    1157:	55                   	push   %rbp
+    1158:	48 89 e5             	mov    %rsp,%rbp
+    115b:	48 83 ec 10          	sub    $0x10,%rsp
+    115f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1163:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1166:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    1169:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    116d:	76 09                	jbe    1178 <memset+0x21>
+    116f:	e8 71 ff ff ff       	call   10e5 <haserms>
+    1174:	85 c0                	test   %eax,%eax
+    1176:	74 16                	je     118e <memset+0x37>
+    stosb(dst, c, n);
+    1178:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    117b:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    117e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1182:	89 ce                	mov    %ecx,%esi
+    1184:	48 89 c7             	mov    %rax,%rdi
+    1187:	e8 26 fd ff ff       	call   eb2 <stosb>
+    118c:	eb 58                	jmp    11e6 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    118e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1191:	c1 e8 03             	shr    $0x3,%eax
+    1194:	89 c6                	mov    %eax,%esi
+    1196:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1199:	48 98                	cltq
+    119b:	0f b6 c0             	movzbl %al,%eax
+    119e:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    11a5:	01 01 01 
+    11a8:	48 0f af c2          	imul   %rdx,%rax
+    11ac:	48 89 c1             	mov    %rax,%rcx
+    11af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b3:	48 89 f2             	mov    %rsi,%rdx
+    11b6:	48 89 ce             	mov    %rcx,%rsi
+    11b9:	48 89 c7             	mov    %rax,%rdi
+    11bc:	e8 23 fd ff ff       	call   ee4 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    11c1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    11c4:	83 e0 07             	and    $0x7,%eax
+    11c7:	89 c2                	mov    %eax,%edx
+    11c9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    11cc:	83 e0 f8             	and    $0xfffffff8,%eax
+    11cf:	48 89 c1             	mov    %rax,%rcx
+    11d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11d6:	48 01 c1             	add    %rax,%rcx
+    11d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11dc:	89 c6                	mov    %eax,%esi
+    11de:	48 89 cf             	mov    %rcx,%rdi
+    11e1:	e8 cc fc ff ff       	call   eb2 <stosb>
+  }
+  return dst;
+    11e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    11ea:	c9                   	leave
+    11eb:	c3                   	ret
+
+00000000000011ec <strchr>:
+
+char *strchr(const char *s, char c) {
+    11ec:	55                   	push   %rbp
+    11ed:	48 89 e5             	mov    %rsp,%rbp
+    11f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11f4:	89 f0                	mov    %esi,%eax
+    11f6:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    11f9:	eb 17                	jmp    1212 <strchr+0x26>
+    if (*s == c)
+    11fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ff:	0f b6 00             	movzbl (%rax),%eax
+    1202:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1205:	75 06                	jne    120d <strchr+0x21>
+      return (char *)s;
+    1207:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    120b:	eb 15                	jmp    1222 <strchr+0x36>
+  for (; *s; s++)
+    120d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1212:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1216:	0f b6 00             	movzbl (%rax),%eax
+    1219:	84 c0                	test   %al,%al
+    121b:	75 de                	jne    11fb <strchr+0xf>
+  return 0;
+    121d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1222:	5d                   	pop    %rbp
+    1223:	c3                   	ret
+
+0000000000001224 <gets>:
+
+char *gets(char *buf, int max) {
+    1224:	55                   	push   %rbp
+    1225:	48 89 e5             	mov    %rsp,%rbp
+    1228:	48 83 ec 20          	sub    $0x20,%rsp
+    122c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1230:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    1233:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    123a:	eb 48                	jmp    1284 <gets+0x60>
+    cc = read(0, &c, 1);
+    123c:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1240:	ba 01 00 00 00       	mov    $0x1,%edx
+    1245:	48 89 c6             	mov    %rax,%rsi
+    1248:	bf 00 00 00 00       	mov    $0x0,%edi
+    124d:	e8 b8 05 00 00       	call   180a <read>
+    1252:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1255:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1259:	7e 36                	jle    1291 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    125b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    125e:	8d 50 01             	lea    0x1(%rax),%edx
+    1261:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1264:	48 63 d0             	movslq %eax,%rdx
+    1267:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    126b:	48 01 c2             	add    %rax,%rdx
+    126e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1272:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1274:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1278:	3c 0a                	cmp    $0xa,%al
+    127a:	74 16                	je     1292 <gets+0x6e>
+    127c:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1280:	3c 0d                	cmp    $0xd,%al
+    1282:	74 0e                	je     1292 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1284:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1287:	83 c0 01             	add    $0x1,%eax
+    128a:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    128d:	7f ad                	jg     123c <gets+0x18>
+    128f:	eb 01                	jmp    1292 <gets+0x6e>
+      break;
+    1291:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1292:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1295:	48 63 d0             	movslq %eax,%rdx
+    1298:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    129c:	48 01 d0             	add    %rdx,%rax
+    129f:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    12a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    12a6:	c9                   	leave
+    12a7:	c3                   	ret
+
+00000000000012a8 <stat>:
+
+int stat(char *n, struct stat *st) {
+    12a8:	55                   	push   %rbp
+    12a9:	48 89 e5             	mov    %rsp,%rbp
+    12ac:	48 83 ec 10          	sub    $0x10,%rsp
+    12b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    12b8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    12bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12c0:	48 89 c6             	mov    %rax,%rsi
+    12c3:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    12c8:	e8 58 07 00 00       	call   1a25 <fstatat>
+}
+    12cd:	c9                   	leave
+    12ce:	c3                   	ret
+
+00000000000012cf <atoi>:
+
+int atoi(const char *s) {
+    12cf:	55                   	push   %rbp
+    12d0:	48 89 e5             	mov    %rsp,%rbp
+    12d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    12d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    12de:	eb 28                	jmp    1308 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    12e0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    12e3:	89 d0                	mov    %edx,%eax
+    12e5:	c1 e0 02             	shl    $0x2,%eax
+    12e8:	01 d0                	add    %edx,%eax
+    12ea:	01 c0                	add    %eax,%eax
+    12ec:	89 c1                	mov    %eax,%ecx
+    12ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    12f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    12fa:	0f b6 00             	movzbl (%rax),%eax
+    12fd:	0f be c0             	movsbl %al,%eax
+    1300:	01 c8                	add    %ecx,%eax
+    1302:	83 e8 30             	sub    $0x30,%eax
+    1305:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    130c:	0f b6 00             	movzbl (%rax),%eax
+    130f:	3c 2f                	cmp    $0x2f,%al
+    1311:	7e 0b                	jle    131e <atoi+0x4f>
+    1313:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1317:	0f b6 00             	movzbl (%rax),%eax
+    131a:	3c 39                	cmp    $0x39,%al
+    131c:	7e c2                	jle    12e0 <atoi+0x11>
+  return n;
+    131e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1321:	5d                   	pop    %rbp
+    1322:	c3                   	ret
+
+0000000000001323 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    1323:	55                   	push   %rbp
+    1324:	48 89 e5             	mov    %rsp,%rbp
+    1327:	48 83 ec 28          	sub    $0x28,%rsp
+    132b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    132f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1333:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1336:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    133a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    133e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1342:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1346:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    134a:	7f 09                	jg     1355 <memmove+0x32>
+    return vdst;
+    134c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1350:	e9 29 01 00 00       	jmp    147e <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1355:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1359:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    135d:	0f 83 87 00 00 00    	jae    13ea <memmove+0xc7>
+    1363:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1366:	48 63 d0             	movslq %eax,%rdx
+    1369:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    136d:	48 01 d0             	add    %rdx,%rax
+    1370:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1374:	73 74                	jae    13ea <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1376:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1379:	48 98                	cltq
+    137b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    137f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1382:	48 98                	cltq
+    1384:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1388:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    138c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1390:	48 09 d0             	or     %rdx,%rax
+    1393:	83 e0 07             	and    $0x7,%eax
+    1396:	48 85 c0             	test   %rax,%rax
+    1399:	75 3d                	jne    13d8 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    139b:	eb 1c                	jmp    13b9 <memmove+0x96>
+        src -= 8;
+    139d:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    13a2:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    13a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13ab:	48 8b 10             	mov    (%rax),%rdx
+    13ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13b2:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    13b5:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    13b9:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    13bd:	7f de                	jg     139d <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    13bf:	eb 17                	jmp    13d8 <memmove+0xb5>
+      *--dst = *--src;
+    13c1:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    13c6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    13cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13cf:	0f b6 10             	movzbl (%rax),%edx
+    13d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13d6:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    13d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13db:	8d 50 ff             	lea    -0x1(%rax),%edx
+    13de:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    13e1:	85 c0                	test   %eax,%eax
+    13e3:	7f dc                	jg     13c1 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    13e5:	e9 90 00 00 00       	jmp    147a <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    13ea:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    13ee:	7e 09                	jle    13f9 <memmove+0xd6>
+    13f0:	e8 f0 fc ff ff       	call   10e5 <haserms>
+    13f5:	85 c0                	test   %eax,%eax
+    13f7:	74 1b                	je     1414 <memmove+0xf1>
+    movsb(dst, src, n);
+    13f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13fc:	48 63 d0             	movslq %eax,%rdx
+    13ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1403:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1407:	48 89 ce             	mov    %rcx,%rsi
+    140a:	48 89 c7             	mov    %rax,%rdi
+    140d:	e8 0c fb ff ff       	call   f1e <movsb>
+    1412:	eb 66                	jmp    147a <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    1414:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1417:	8d 50 07             	lea    0x7(%rax),%edx
+    141a:	85 c0                	test   %eax,%eax
+    141c:	0f 48 c2             	cmovs  %edx,%eax
+    141f:	c1 f8 03             	sar    $0x3,%eax
+    1422:	48 63 d0             	movslq %eax,%rdx
+    1425:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1429:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    142d:	48 89 ce             	mov    %rcx,%rsi
+    1430:	48 89 c7             	mov    %rax,%rdi
+    1433:	e8 23 fb ff ff       	call   f5b <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1438:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    143b:	89 d0                	mov    %edx,%eax
+    143d:	c1 f8 1f             	sar    $0x1f,%eax
+    1440:	c1 e8 1d             	shr    $0x1d,%eax
+    1443:	01 c2                	add    %eax,%edx
+    1445:	83 e2 07             	and    $0x7,%edx
+    1448:	29 c2                	sub    %eax,%edx
+    144a:	89 d0                	mov    %edx,%eax
+    144c:	48 98                	cltq
+    144e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1451:	83 e2 f8             	and    $0xfffffff8,%edx
+    1454:	48 63 ca             	movslq %edx,%rcx
+    1457:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    145b:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    145f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1462:	83 e2 f8             	and    $0xfffffff8,%edx
+    1465:	48 63 ca             	movslq %edx,%rcx
+    1468:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    146c:	48 01 d1             	add    %rdx,%rcx
+    146f:	48 89 c2             	mov    %rax,%rdx
+    1472:	48 89 cf             	mov    %rcx,%rdi
+    1475:	e8 a4 fa ff ff       	call   f1e <movsb>
+  }
+  return vdst;
+    147a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    147e:	c9                   	leave
+    147f:	c3                   	ret
+
+0000000000001480 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1480:	55                   	push   %rbp
+    1481:	48 89 e5             	mov    %rsp,%rbp
+    1484:	48 83 ec 20          	sub    $0x20,%rsp
+    1488:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    148b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    148f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1496:	00 00 00 
+    1499:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    149d:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    14a1:	75 0d                	jne    14b0 <clock_gettime+0x30>
+    14a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    14ab:	48 85 c0             	test   %rax,%rax
+    14ae:	75 13                	jne    14c3 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    14b0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    14b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    14b7:	48 89 d6             	mov    %rdx,%rsi
+    14ba:	89 c7                	mov    %eax,%edi
+    14bc:	e8 e0 04 00 00       	call   19a1 <_clock_gettime>
+    14c1:	eb 7d                	jmp    1540 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    14c3:	e8 d1 fa ff ff       	call   f99 <rdtsc>
+    14c8:	48 89 c2             	mov    %rax,%rdx
+    14cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14cf:	48 89 d6             	mov    %rdx,%rsi
+    14d2:	48 89 c7             	mov    %rax,%rdi
+    14d5:	e8 7b f9 ff ff       	call   e55 <clockns>
+    14da:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    14de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14e2:	48 c1 e8 09          	shr    $0x9,%rax
+    14e6:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    14ed:	b8 44 00 
+    14f0:	48 f7 e2             	mul    %rdx
+    14f3:	48 89 d0             	mov    %rdx,%rax
+    14f6:	48 c1 e8 0b          	shr    $0xb,%rax
+    14fa:	48 89 c2             	mov    %rax,%rdx
+    14fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1501:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1504:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1508:	48 89 c8             	mov    %rcx,%rax
+    150b:	48 c1 e8 09          	shr    $0x9,%rax
+    150f:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1516:	b8 44 00 
+    1519:	48 f7 e2             	mul    %rdx
+    151c:	48 89 d0             	mov    %rdx,%rax
+    151f:	48 c1 e8 0b          	shr    $0xb,%rax
+    1523:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    152a:	48 89 c8             	mov    %rcx,%rax
+    152d:	48 29 d0             	sub    %rdx,%rax
+    1530:	48 89 c2             	mov    %rax,%rdx
+    1533:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1537:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    153b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1540:	c9                   	leave
+    1541:	c3                   	ret
+
+0000000000001542 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    1542:	55                   	push   %rbp
+    1543:	48 89 e5             	mov    %rsp,%rbp
+    1546:	48 83 ec 10          	sub    $0x10,%rsp
+    154a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    154e:	eb 11                	jmp    1561 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    1550:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1554:	be 02 00 00 00       	mov    $0x2,%esi
+    1559:	48 89 c7             	mov    %rax,%rdi
+    155c:	e8 6c 04 00 00       	call   19cd <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1561:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1565:	b8 02 00 00 00       	mov    $0x2,%eax
+    156a:	87 02                	xchg   %eax,(%rdx)
+    156c:	85 c0                	test   %eax,%eax
+    156e:	75 e0                	jne    1550 <mutex_wait+0xe>
+}
+    1570:	90                   	nop
+    1571:	90                   	nop
+    1572:	c9                   	leave
+    1573:	c3                   	ret
+
+0000000000001574 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1574:	55                   	push   %rbp
+    1575:	48 89 e5             	mov    %rsp,%rbp
+    1578:	48 83 ec 20          	sub    $0x20,%rsp
+    157c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1580:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1587:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    158b:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    158f:	8b 02                	mov    (%rdx),%eax
+    1591:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1596:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    159a:	89 c1                	mov    %eax,%ecx
+    159c:	0f 94 c0             	sete   %al
+    159f:	84 c0                	test   %al,%al
+    15a1:	75 02                	jne    15a5 <mutex_lock+0x31>
+    15a3:	89 0a                	mov    %ecx,(%rdx)
+    15a5:	83 f0 01             	xor    $0x1,%eax
+    15a8:	84 c0                	test   %al,%al
+    15aa:	74 0c                	je     15b8 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    15ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15b0:	48 89 c7             	mov    %rax,%rdi
+    15b3:	e8 8a ff ff ff       	call   1542 <mutex_wait>
+}
+    15b8:	90                   	nop
+    15b9:	c9                   	leave
+    15ba:	c3                   	ret
+
+00000000000015bb <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    15bb:	55                   	push   %rbp
+    15bc:	48 89 e5             	mov    %rsp,%rbp
+    15bf:	48 83 ec 10          	sub    $0x10,%rsp
+    15c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    15c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15cb:	ba 00 00 00 00       	mov    $0x0,%edx
+    15d0:	87 10                	xchg   %edx,(%rax)
+    15d2:	83 fa 02             	cmp    $0x2,%edx
+    15d5:	75 11                	jne    15e8 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    15d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15db:	be 01 00 00 00       	mov    $0x1,%esi
+    15e0:	48 89 c7             	mov    %rax,%rdi
+    15e3:	e8 f0 03 00 00       	call   19d8 <futex_wake>
+}
+    15e8:	90                   	nop
+    15e9:	c9                   	leave
+    15ea:	c3                   	ret
+
+00000000000015eb <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    15eb:	55                   	push   %rbp
+    15ec:	48 89 e5             	mov    %rsp,%rbp
+    15ef:	48 83 ec 20          	sub    $0x20,%rsp
+    15f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    15fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ff:	48 83 c0 04          	add    $0x4,%rax
+    1603:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    160b:	8b 00                	mov    (%rax),%eax
+    160d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1610:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1614:	48 89 c7             	mov    %rax,%rdi
+    1617:	e8 9f ff ff ff       	call   15bb <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    161c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1620:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1623:	89 d6                	mov    %edx,%esi
+    1625:	48 89 c7             	mov    %rax,%rdi
+    1628:	e8 a0 03 00 00       	call   19cd <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    162d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1631:	48 83 c0 04          	add    $0x4,%rax
+    1635:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1639:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    163d:	48 89 c7             	mov    %rax,%rdi
+    1640:	e8 fd fe ff ff       	call   1542 <mutex_wait>
+}
+    1645:	90                   	nop
+    1646:	c9                   	leave
+    1647:	c3                   	ret
+
+0000000000001648 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1648:	55                   	push   %rbp
+    1649:	48 89 e5             	mov    %rsp,%rbp
+    164c:	48 83 ec 10          	sub    $0x10,%rsp
+    1650:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1654:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1658:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    165c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1660:	48 83 c0 04          	add    $0x4,%rax
+    1664:	8b 00                	mov    (%rax),%eax
+    1666:	85 c0                	test   %eax,%eax
+    1668:	7e 11                	jle    167b <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    166a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166e:	be 01 00 00 00       	mov    $0x1,%esi
+    1673:	48 89 c7             	mov    %rax,%rdi
+    1676:	e8 5d 03 00 00       	call   19d8 <futex_wake>
+}
+    167b:	90                   	nop
+    167c:	c9                   	leave
+    167d:	c3                   	ret
+
+000000000000167e <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    167e:	55                   	push   %rbp
+    167f:	48 89 e5             	mov    %rsp,%rbp
+    1682:	48 83 ec 10          	sub    $0x10,%rsp
+    1686:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    168a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168e:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1692:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1696:	48 83 c0 04          	add    $0x4,%rax
+    169a:	8b 00                	mov    (%rax),%eax
+    169c:	85 c0                	test   %eax,%eax
+    169e:	7e 11                	jle    16b1 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    16a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a4:	be 00 00 00 40       	mov    $0x40000000,%esi
+    16a9:	48 89 c7             	mov    %rax,%rdi
+    16ac:	e8 27 03 00 00       	call   19d8 <futex_wake>
+}
+    16b1:	90                   	nop
+    16b2:	c9                   	leave
+    16b3:	c3                   	ret
+
+00000000000016b4 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    16b4:	55                   	push   %rbp
+    16b5:	48 89 e5             	mov    %rsp,%rbp
+    16b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16bc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    16bf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    16c3:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    16c7:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    16cb:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    16cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d3:	8b 40 04             	mov    0x4(%rax),%eax
+    16d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    16d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16dd:	8b 00                	mov    (%rax),%eax
+    16df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    16e2:	29 c2                	sub    %eax,%edx
+    16e4:	83 fa 1f             	cmp    $0x1f,%edx
+    16e7:	76 07                	jbe    16f0 <ring_push+0x3c>
+    return -1;
+    16e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    16ee:	eb 7e                	jmp    176e <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    16f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16f3:	83 e0 1f             	and    $0x1f,%eax
+    16f6:	89 c2                	mov    %eax,%edx
+    16f8:	48 89 d0             	mov    %rdx,%rax
+    16fb:	48 01 c0             	add    %rax,%rax
+    16fe:	48 01 d0             	add    %rdx,%rax
+    1701:	48 c1 e0 04          	shl    $0x4,%rax
+    1705:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1709:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    170d:	48 01 d0             	add    %rdx,%rax
+    1710:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1714:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1718:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    171b:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    171d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1721:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1725:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1729:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    172d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1731:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1735:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1739:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    173d:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1745:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1749:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    174d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1751:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1755:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1759:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    175c:	8d 50 01             	lea    0x1(%rax),%edx
+    175f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1763:	48 83 c0 04          	add    $0x4,%rax
+    1767:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1769:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    176e:	5d                   	pop    %rbp
+    176f:	c3                   	ret
+
+0000000000001770 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1770:	55                   	push   %rbp
+    1771:	48 89 e5             	mov    %rsp,%rbp
+    1774:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1778:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    177c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1780:	8b 40 08             	mov    0x8(%rax),%eax
+    1783:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1786:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    178a:	48 83 c0 0c          	add    $0xc,%rax
+    178e:	8b 00                	mov    (%rax),%eax
+    1790:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1793:	75 07                	jne    179c <ring_pop+0x2c>
+    return -1;
+    1795:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    179a:	eb 40                	jmp    17dc <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    179c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    179f:	83 e0 1f             	and    $0x1f,%eax
+    17a2:	89 c2                	mov    %eax,%edx
+    17a4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    17a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17ac:	89 d2                	mov    %edx,%edx
+    17ae:	48 83 c2 61          	add    $0x61,%rdx
+    17b2:	48 c1 e2 04          	shl    $0x4,%rdx
+    17b6:	48 01 d0             	add    %rdx,%rax
+    17b9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    17bd:	48 8b 00             	mov    (%rax),%rax
+    17c0:	48 89 01             	mov    %rax,(%rcx)
+    17c3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    17c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17ca:	8d 50 01             	lea    0x1(%rax),%edx
+    17cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d1:	48 83 c0 08          	add    $0x8,%rax
+    17d5:	89 10                	mov    %edx,(%rax)
+  return 0;
+    17d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17dc:	5d                   	pop    %rbp
+    17dd:	c3                   	ret
+
+00000000000017de <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    17de:	b8 01 00 00 00       	mov    $0x1,%eax
+    17e3:	49 89 ca             	mov    %rcx,%r10
+    17e6:	0f 05                	syscall
+    17e8:	c3                   	ret
+
+00000000000017e9 <_exit>:
+SYSCALL_(exit)
+    17e9:	b8 02 00 00 00       	mov    $0x2,%eax
+    17ee:	49 89 ca             	mov    %rcx,%r10
+    17f1:	0f 05                	syscall
+    17f3:	c3                   	ret
+
+00000000000017f4 <wait>:
+SYSCALL(wait)
+    17f4:	b8 03 00 00 00       	mov    $0x3,%eax
+    17f9:	49 89 ca             	mov    %rcx,%r10
+    17fc:	0f 05                	syscall
+    17fe:	c3                   	ret
+
+00000000000017ff <pipe>:
+SYSCALL(pipe)
+    17ff:	b8 04 00 00 00       	mov    $0x4,%eax
+    1804:	49 89 ca             	mov    %rcx,%r10
+    1807:	0f 05                	syscall
+    1809:	c3                   	ret
+
+000000000000180a <read>:
+SYSCALL(read)
+    180a:	b8 05 00 00 00       	mov    $0x5,%eax
+    180f:	49 89 ca             	mov    %rcx,%r10
+    1812:	0f 05                	syscall
+    1814:	c3                   	ret
+
+0000000000001815 <write>:
+SYSCALL(write)
+    1815:	b8 10 00 00 00       	mov    $0x10,%eax
+    181a:	49 89 ca             	mov    %rcx,%r10
+    181d:	0f 05                	syscall
+    181f:	c3                   	ret
+
+0000000000001820 <_close>:
+SYSCALL_(close)
+    1820:	b8 15 00 00 00       	mov    $0x15,%eax
+    1825:	49 89 ca             	mov    %rcx,%r10
+    1828:	0f 05                	syscall
+    182a:	c3                   	ret
+
+000000000000182b <kill>:
+SYSCALL(kill)
+    182b:	b8 06 00 00 00       	mov    $0x6,%eax
+    1830:	49 89 ca             	mov    %rcx,%r10
+    1833:	0f 05                	syscall
+    1835:	c3                   	ret
+
+0000000000001836 <_exec>:
+SYSCALL_(exec)
+    1836:	b8 07 00 00 00       	mov    $0x7,%eax
+    183b:	49 89 ca             	mov    %rcx,%r10
+    183e:	0f 05                	syscall
+    1840:	c3                   	ret
+
+0000000000001841 <open>:
+SYSCALL(open)
+    1841:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1846:	49 89 ca             	mov    %rcx,%r10
+    1849:	0f 05                	syscall
+    184b:	c3                   	ret
+
+000000000000184c <mknod>:
+SYSCALL(mknod)
+    184c:	b8 11 00 00 00       	mov    $0x11,%eax
+    1851:	49 89 ca             	mov    %rcx,%r10
+    1854:	0f 05                	syscall
+    1856:	c3                   	ret
+
+0000000000001857 <unlink>:
+SYSCALL(unlink)
+    1857:	b8 12 00 00 00       	mov    $0x12,%eax
+    185c:	49 89 ca             	mov    %rcx,%r10
+    185f:	0f 05                	syscall
+    1861:	c3                   	ret
+
+0000000000001862 <fstat>:
+SYSCALL(fstat)
+    1862:	b8 08 00 00 00       	mov    $0x8,%eax
+    1867:	49 89 ca             	mov    %rcx,%r10
+    186a:	0f 05                	syscall
+    186c:	c3                   	ret
+
+000000000000186d <link>:
+SYSCALL(link)
+    186d:	b8 13 00 00 00       	mov    $0x13,%eax
+    1872:	49 89 ca             	mov    %rcx,%r10
+    1875:	0f 05                	syscall
+    1877:	c3                   	ret
+
+0000000000001878 <mkdir>:
+SYSCALL(mkdir)
+    1878:	b8 14 00 00 00       	mov    $0x14,%eax
+    187d:	49 89 ca             	mov    %rcx,%r10
+    1880:	0f 05                	syscall
+    1882:	c3                   	ret
+
+0000000000001883 <chdir>:
+SYSCALL(chdir)
+    1883:	b8 09 00 00 00       	mov    $0x9,%eax
+    1888:	49 89 ca             	mov    %rcx,%r10
+    188b:	0f 05                	syscall
+    188d:	c3                   	ret
+
+000000000000188e <dup>:
+SYSCALL(dup)
+    188e:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1893:	49 89 ca             	mov    %rcx,%r10
+    1896:	0f 05                	syscall
+    1898:	c3                   	ret
+
+0000000000001899 <getpid>:
+SYSCALL(getpid)
+    1899:	b8 0b 00 00 00       	mov    $0xb,%eax
+    189e:	49 89 ca             	mov    %rcx,%r10
+    18a1:	0f 05                	syscall
+    18a3:	c3                   	ret
+
+00000000000018a4 <sbrk>:
+SYSCALL(sbrk)
+    18a4:	b8 0c 00 00 00       	mov    $0xc,%eax
+    18a9:	49 89 ca             	mov    %rcx,%r10
+    18ac:	0f 05                	syscall
+    18ae:	c3                   	ret
+
+00000000000018af <sleep>:
+SYSCALL(sleep)
+    18af:	b8 0d 00 00 00       	mov    $0xd,%eax
+    18b4:	49 89 ca             	mov    %rcx,%r10
+    18b7:	0f 05                	syscall
+    18b9:	c3                   	ret
+
+00000000000018ba <uptime>:
+SYSCALL(uptime)
+    18ba:	b8 0e 00 00 00       	mov    $0xe,%eax
+    18bf:	49 89 ca             	mov    %rcx,%r10
+    18c2:	0f 05                	syscall
+    18c4:	c3                   	ret
+
+00000000000018c5 <sysinfo>:
+SYSCALL(sysinfo)
+    18c5:	b8 16 00 00 00       	mov    $0x16,%eax
+    18ca:	49 89 ca             	mov    %rcx,%r10
+    18cd:	0f 05                	syscall
+    18cf:	c3                   	ret
+
+00000000000018d0 <crashn>:
+SYSCALL(crashn)
+    18d0:	b8 17 00 00 00       	mov    $0x17,%eax
+    18d5:	49 89 ca             	mov    %rcx,%r10
+    18d8:	0f 05                	syscall
+    18da:	c3                   	ret
+
+00000000000018db <mmap>:
+SYSCALL(mmap)
+    18db:	b8 18 00 00 00       	mov    $0x18,%eax
+    18e0:	49 89 ca             	mov    %rcx,%r10
+    18e3:	0f 05                	syscall
+    18e5:	c3                   	ret
+
+00000000000018e6 <munmap>:
+SYSCALL(munmap)
+    18e6:	b8 19 00 00 00       	mov    $0x19,%eax
+    18eb:	49 89 ca             	mov    %rcx,%r10
+    18ee:	0f 05                	syscall
+    18f0:	c3                   	ret
+
+00000000000018f1 <nice>:
+SYSCALL(nice)
+    18f1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    18f6:	49 89 ca             	mov    %rcx,%r10
+    18f9:	0f 05                	syscall
+    18fb:	c3                   	ret
+
+00000000000018fc <_spawn>:
+SYSCALL_(spawn)
+    18fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1901:	49 89 ca             	mov    %rcx,%r10
+    1904:	0f 05                	syscall
+    1906:	c3                   	ret
+
+0000000000001907 <pread>:
+SYSCALL(pread)
+    1907:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    190c:	49 89 ca             	mov    %rcx,%r10
+    190f:	0f 05                	syscall
+    1911:	c3                   	ret
+
+0000000000001912 <pwrite>:
+SYSCALL(pwrite)
+    1912:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1917:	49 89 ca             	mov    %rcx,%r10
+    191a:	0f 05                	syscall
+    191c:	c3                   	ret
+
+000000000000191d <readv>:
+SYSCALL(readv)
+    191d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1922:	49 89 ca             	mov    %rcx,%r10
+    1925:	0f 05                	syscall
+    1927:	c3                   	ret
+
+0000000000001928 <writev>:
+SYSCALL(writev)
+    1928:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    192d:	49 89 ca             	mov    %rcx,%r10
+    1930:	0f 05                	syscall
+    1932:	c3                   	ret
+
+0000000000001933 <sendfile>:
+SYSCALL(sendfile)
+    1933:	b8 20 00 00 00       	mov    $0x20,%eax
+    1938:	49 89 ca             	mov    %rcx,%r10
+    193b:	0f 05                	syscall
+    193d:	c3                   	ret
+
+000000000000193e <splice>:
+SYSCALL(splice)
+    193e:	b8 21 00 00 00       	mov    $0x21,%eax
+    1943:	49 89 ca             	mov    %rcx,%r10
+    1946:	0f 05                	syscall
+    1948:	c3                   	ret
+
+0000000000001949 <poll>:
+SYSCALL(poll)
+    1949:	b8 22 00 00 00       	mov    $0x22,%eax
+    194e:	49 89 ca             	mov    %rcx,%r10
+    1951:	0f 05                	syscall
+    1953:	c3                   	ret
+
+0000000000001954 <fsync>:
+SYSCALL(fsync)
+    1954:	b8 23 00 00 00       	mov    $0x23,%eax
+    1959:	49 89 ca             	mov    %rcx,%r10
+    195c:	0f 05                	syscall
+    195e:	c3                   	ret
+
+000000000000195f <fdatasync>:
+SYSCALL(fdatasync)
+    195f:	b8 24 00 00 00       	mov    $0x24,%eax
+    1964:	49 89 ca             	mov    %rcx,%r10
+    1967:	0f 05                	syscall
+    1969:	c3                   	ret
+
+000000000000196a <lockstat>:
+SYSCALL(lockstat)
+    196a:	b8 25 00 00 00       	mov    $0x25,%eax
+    196f:	49 89 ca             	mov    %rcx,%r10
+    1972:	0f 05                	syscall
+    1974:	c3                   	ret
+
+0000000000001975 <syscallstat>:
+SYSCALL(syscallstat)
+    1975:	b8 26 00 00 00       	mov    $0x26,%eax
+    197a:	49 89 ca             	mov    %rcx,%r10
+    197d:	0f 05                	syscall
+    197f:	c3                   	ret
+
+0000000000001980 <trace>:
+SYSCALL(trace)
+    1980:	b8 27 00 00 00       	mov    $0x27,%eax
+    1985:	49 89 ca             	mov    %rcx,%r10
+    1988:	0f 05                	syscall
+    198a:	c3                   	ret
+
+000000000000198b <profile>:
+SYSCALL(profile)
+    198b:	b8 28 00 00 00       	mov    $0x28,%eax
+    1990:	49 89 ca             	mov    %rcx,%r10
+    1993:	0f 05                	syscall
+    1995:	c3                   	ret
+
+0000000000001996 <cycles>:
+SYSCALL(cycles)
+    1996:	b8 29 00 00 00       	mov    $0x29,%eax
+    199b:	49 89 ca             	mov    %rcx,%r10
+    199e:	0f 05                	syscall
+    19a0:	c3                   	ret
+
+00000000000019a1 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    19a1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    19a6:	49 89 ca             	mov    %rcx,%r10
+    19a9:	0f 05                	syscall
+    19ab:	c3                   	ret
+
+00000000000019ac <consmode>:
+SYSCALL(consmode)
+    19ac:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    19b1:	49 89 ca             	mov    %rcx,%r10
+    19b4:	0f 05                	syscall
+    19b6:	c3                   	ret
+
+00000000000019b7 <clone>:
+SYSCALL(clone)
+    19b7:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    19bc:	49 89 ca             	mov    %rcx,%r10
+    19bf:	0f 05                	syscall
+    19c1:	c3                   	ret
+
+00000000000019c2 <join>:
+SYSCALL(join)
+    19c2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    19c7:	49 89 ca             	mov    %rcx,%r10
+    19ca:	0f 05                	syscall
+    19cc:	c3                   	ret
+
+00000000000019cd <futex_wait>:
+SYSCALL(futex_wait)
+    19cd:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    19d2:	49 89 ca             	mov    %rcx,%r10
+    19d5:	0f 05                	syscall
+    19d7:	c3                   	ret
+
+00000000000019d8 <futex_wake>:
+SYSCALL(futex_wake)
+    19d8:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    19dd:	49 89 ca             	mov    %rcx,%r10
+    19e0:	0f 05                	syscall
+    19e2:	c3                   	ret
+
+00000000000019e3 <shmget>:
+SYSCALL(shmget)
+    19e3:	b8 30 00 00 00       	mov    $0x30,%eax
+    19e8:	49 89 ca             	mov    %rcx,%r10
+    19eb:	0f 05                	syscall
+    19ed:	c3                   	ret
+
+00000000000019ee <shmat>:
+SYSCALL(shmat)
+    19ee:	b8 31 00 00 00       	mov    $0x31,%eax
+    19f3:	49 89 ca             	mov    %rcx,%r10
+    19f6:	0f 05                	syscall
+    19f8:	c3                   	ret
+
+00000000000019f9 <shmdt>:
+SYSCALL(shmdt)
+    19f9:	b8 32 00 00 00       	mov    $0x32,%eax
+    19fe:	49 89 ca             	mov    %rcx,%r10
+    1a01:	0f 05                	syscall
+    1a03:	c3                   	ret
+
+0000000000001a04 <ring_setup>:
+SYSCALL(ring_setup)
+    1a04:	b8 33 00 00 00       	mov    $0x33,%eax
+    1a09:	49 89 ca             	mov    %rcx,%r10
+    1a0c:	0f 05                	syscall
+    1a0e:	c3                   	ret
+
+0000000000001a0f <ring_enter>:
+SYSCALL(ring_enter)
+    1a0f:	b8 34 00 00 00       	mov    $0x34,%eax
+    1a14:	49 89 ca             	mov    %rcx,%r10
+    1a17:	0f 05                	syscall
+    1a19:	c3                   	ret
+
+0000000000001a1a <getdents>:
+SYSCALL(getdents)
+    1a1a:	b8 35 00 00 00       	mov    $0x35,%eax
+    1a1f:	49 89 ca             	mov    %rcx,%r10
+    1a22:	0f 05                	syscall
+    1a24:	c3                   	ret
+
+0000000000001a25 <fstatat>:
+SYSCALL(fstatat)
+    1a25:	b8 36 00 00 00       	mov    $0x36,%eax
+    1a2a:	49 89 ca             	mov    %rcx,%r10
+    1a2d:	0f 05                	syscall
+    1a2f:	c3                   	ret
+
+0000000000001a30 <clone_file>:
+SYSCALL(clone_file)
+    1a30:	b8 37 00 00 00       	mov    $0x37,%eax
+    1a35:	49 89 ca             	mov    %rcx,%r10
+    1a38:	0f 05                	syscall
+    1a3a:	c3                   	ret
+
+0000000000001a3b <fpunch>:
+SYSCALL(fpunch)
+    1a3b:	b8 38 00 00 00       	mov    $0x38,%eax
+    1a40:	49 89 ca             	mov    %rcx,%r10
+    1a43:	0f 05                	syscall
+    1a45:	c3                   	ret
+
+0000000000001a46 <defrag>:
+SYSCALL(defrag)
+    1a46:	b8 39 00 00 00       	mov    $0x39,%eax
+    1a4b:	49 89 ca             	mov    %rcx,%r10
+    1a4e:	0f 05                	syscall
+    1a50:	c3                   	ret
+
+0000000000001a51 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1a51:	55                   	push   %rbp
+    1a52:	48 89 e5             	mov    %rsp,%rbp
+    1a55:	48 83 ec 20          	sub    $0x20,%rsp
+    1a59:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1a5d:	bf 00 00 00 00       	mov    $0x0,%edi
+    1a62:	e8 3d fe ff ff       	call   18a4 <sbrk>
+    1a67:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1a6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a6f:	48 f7 d8             	neg    %rax
+    1a72:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1a77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1a7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a83:	48 01 c2             	add    %rax,%rdx
+    1a86:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1a8b:	48 39 c2             	cmp    %rax,%rdx
+    1a8e:	73 1e                	jae    1aae <morecore+0x5d>
+    1a90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a94:	89 c2                	mov    %eax,%edx
+    1a96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a9a:	01 d0                	add    %edx,%eax
+    1a9c:	89 c7                	mov    %eax,%edi
+    1a9e:	e8 01 fe ff ff       	call   18a4 <sbrk>
+    1aa3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1aa7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1aac:	75 07                	jne    1ab5 <morecore+0x64>
+    return 0;
+    1aae:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ab3:	eb 27                	jmp    1adc <morecore+0x8b>
+  stats.heap += n + pad;
+    1ab5:	48 8b 05 d4 48 00 00 	mov    0x48d4(%rip),%rax        # 6390 <stats+0x50>
+    1abc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1ac0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ac4:	48 01 ca             	add    %rcx,%rdx
+    1ac7:	48 01 d0             	add    %rdx,%rax
+    1aca:	48 89 05 bf 48 00 00 	mov    %rax,0x48bf(%rip)        # 6390 <stats+0x50>
+  return p + pad;
+    1ad1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1ad5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad9:	48 01 d0             	add    %rdx,%rax
+}
+    1adc:	c9                   	leave
+    1add:	c3                   	ret
+
+0000000000001ade <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1ade:	55                   	push   %rbp
+    1adf:	48 89 e5             	mov    %rsp,%rbp
+    1ae2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1ae6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1aea:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1af1:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1af2:	48 8d 05 27 48 00 00 	lea    0x4827(%rip),%rax        # 6320 <runs>
+    1af9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1afd:	eb 1a                	jmp    1b19 <pagefree+0x3b>
+    prev = *rp;
+    1aff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b03:	48 8b 00             	mov    (%rax),%rax
+    1b06:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1b0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b0e:	48 8b 00             	mov    (%rax),%rax
+    1b11:	48 83 c0 08          	add    $0x8,%rax
+    1b15:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1d:	48 8b 00             	mov    (%rax),%rax
+    1b20:	48 85 c0             	test   %rax,%rax
+    1b23:	74 0d                	je     1b32 <pagefree+0x54>
+    1b25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b29:	48 8b 00             	mov    (%rax),%rax
+    1b2c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1b30:	72 cd                	jb     1aff <pagefree+0x21>
+  r = (struct run *)p;
+    1b32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1b36:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1b3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b3e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1b42:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1b45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b49:	48 8b 10             	mov    (%rax),%rdx
+    1b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b50:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1b54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b58:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b5c:	48 85 c0             	test   %rax,%rax
+    1b5f:	74 48                	je     1ba9 <pagefree+0xcb>
+    1b61:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1b65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1b69:	48 01 c2             	add    %rax,%rdx
+    1b6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b70:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b74:	48 39 c2             	cmp    %rax,%rdx
+    1b77:	75 30                	jne    1ba9 <pagefree+0xcb>
+    r->size += r->next->size;
+    1b79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b7d:	48 8b 10             	mov    (%rax),%rdx
+    1b80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b84:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b88:	48 8b 00             	mov    (%rax),%rax
+    1b8b:	48 01 c2             	add    %rax,%rdx
+    1b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b92:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1b95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b99:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b9d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ba5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1ba9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1bae:	74 46                	je     1bf6 <pagefree+0x118>
+    1bb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bb4:	48 8b 10             	mov    (%rax),%rdx
+    1bb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bbb:	48 01 d0             	add    %rdx,%rax
+    1bbe:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1bc2:	75 32                	jne    1bf6 <pagefree+0x118>
+    prev->size += r->size;
+    1bc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc8:	48 8b 10             	mov    (%rax),%rdx
+    1bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bcf:	48 8b 00             	mov    (%rax),%rax
+    1bd2:	48 01 c2             	add    %rax,%rdx
+    1bd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bd9:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1bdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1be0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1be4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1be8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1bec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1bf4:	eb 0c                	jmp    1c02 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1bf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bfa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1bfe:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1c01:	90                   	nop
+    1c02:	90                   	nop
+    1c03:	5d                   	pop    %rbp
+    1c04:	c3                   	ret
+
+0000000000001c05 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1c05:	55                   	push   %rbp
+    1c06:	48 89 e5             	mov    %rsp,%rbp
+    1c09:	48 83 ec 40          	sub    $0x40,%rsp
+    1c0d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1c11:	48 8d 05 08 47 00 00 	lea    0x4708(%rip),%rax        # 6320 <runs>
+    1c18:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c1c:	eb 66                	jmp    1c84 <pagealloc+0x7f>
+    if (r->size == n) {
+    1c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c22:	48 8b 00             	mov    (%rax),%rax
+    1c25:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1c29:	75 18                	jne    1c43 <pagealloc+0x3e>
+      *rp = r->next;
+    1c2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c2f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1c33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c37:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1c3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c3e:	e9 ca 00 00 00       	jmp    1d0d <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1c43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c47:	48 8b 00             	mov    (%rax),%rax
+    1c4a:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1c4e:	73 28                	jae    1c78 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1c50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c54:	48 8b 00             	mov    (%rax),%rax
+    1c57:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1c5b:	48 89 c2             	mov    %rax,%rdx
+    1c5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c62:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1c65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c69:	48 8b 10             	mov    (%rax),%rdx
+    1c6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c70:	48 01 d0             	add    %rdx,%rax
+    1c73:	e9 95 00 00 00       	jmp    1d0d <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1c78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c7c:	48 83 c0 08          	add    $0x8,%rax
+    1c80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c88:	48 8b 00             	mov    (%rax),%rax
+    1c8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1c8f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1c94:	75 88                	jne    1c1e <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1c96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1c9a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1c9e:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1ca5:	00 
+    1ca6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1caa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1cae:	48 39 c2             	cmp    %rax,%rdx
+    1cb1:	48 0f 43 c2          	cmovae %rdx,%rax
+    1cb5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1cb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cbd:	48 89 c7             	mov    %rax,%rdi
+    1cc0:	e8 8c fd ff ff       	call   1a51 <morecore>
+    1cc5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1cc9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1cce:	75 07                	jne    1cd7 <pagealloc+0xd2>
+    return 0;
+    1cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cd5:	eb 36                	jmp    1d0d <pagealloc+0x108>
+  if (m > n)
+    1cd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cdb:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1cdf:	73 1a                	jae    1cfb <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1ce1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ce5:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1ce9:	48 89 c2             	mov    %rax,%rdx
+    1cec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1cf0:	48 89 d6             	mov    %rdx,%rsi
+    1cf3:	48 89 c7             	mov    %rax,%rdi
+    1cf6:	e8 e3 fd ff ff       	call   1ade <pagefree>
+  return p + m - n;
+    1cfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1cff:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1d03:	48 89 c2             	mov    %rax,%rdx
+    1d06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1d0a:	48 01 d0             	add    %rdx,%rax
+}
+    1d0d:	c9                   	leave
+    1d0e:	c3                   	ret
+
+0000000000001d0f <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1d0f:	55                   	push   %rbp
+    1d10:	48 89 e5             	mov    %rsp,%rbp
+    1d13:	48 83 ec 30          	sub    $0x30,%rsp
+    1d17:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1d1a:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1d1f:	e8 e1 fe ff ff       	call   1c05 <pagealloc>
+    1d24:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d28:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1d2d:	75 0a                	jne    1d39 <refill+0x2a>
+    return -1;
+    1d2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d34:	e9 da 00 00 00       	jmp    1e13 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1d39:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1d40:	00 
+    1d41:	e9 ba 00 00 00       	jmp    1e00 <refill+0xf1>
+    b = (struct block *)(p + off);
+    1d46:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1d4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d4e:	48 01 d0             	add    %rdx,%rax
+    1d51:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1d55:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d58:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d5d:	89 c1                	mov    %eax,%ecx
+    1d5f:	48 d3 e2             	shl    %cl,%rdx
+    1d62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d66:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1d69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d6c:	48 63 d0             	movslq %eax,%rdx
+    1d6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d73:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1d77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d7a:	48 98                	cltq
+    1d7c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d83:	00 
+    1d84:	48 8d 05 55 45 00 00 	lea    0x4555(%rip),%rax        # 62e0 <freelist>
+    1d8b:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1d8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d93:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1d97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d9a:	48 98                	cltq
+    1d9c:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1da3:	00 
+    1da4:	48 8d 15 35 45 00 00 	lea    0x4535(%rip),%rdx        # 62e0 <freelist>
+    1dab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1daf:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1db3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1db6:	48 98                	cltq
+    1db8:	48 83 c0 08          	add    $0x8,%rax
+    1dbc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1dc3:	00 
+    1dc4:	48 8d 05 79 45 00 00 	lea    0x4579(%rip),%rax        # 6344 <stats+0x4>
+    1dcb:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1dce:	8d 48 01             	lea    0x1(%rax),%ecx
+    1dd1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dd4:	48 98                	cltq
+    1dd6:	48 83 c0 08          	add    $0x8,%rax
+    1dda:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1de1:	00 
+    1de2:	48 8d 05 5b 45 00 00 	lea    0x455b(%rip),%rax        # 6344 <stats+0x4>
+    1de9:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1dec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1def:	ba 20 00 00 00       	mov    $0x20,%edx
+    1df4:	89 c1                	mov    %eax,%ecx
+    1df6:	48 d3 e2             	shl    %cl,%rdx
+    1df9:	48 89 d0             	mov    %rdx,%rax
+    1dfc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1e00:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1e07:	00 
+    1e08:	0f 86 38 ff ff ff    	jbe    1d46 <refill+0x37>
+  }
+  return 0;
+    1e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1e13:	c9                   	leave
+    1e14:	c3                   	ret
+
+0000000000001e15 <malloc>:
+
+void *malloc(uint nbytes) {
+    1e15:	55                   	push   %rbp
+    1e16:	48 89 e5             	mov    %rsp,%rbp
+    1e19:	48 83 ec 30          	sub    $0x30,%rsp
+    1e1d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1e20:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e23:	48 83 c0 10          	add    $0x10,%rax
+    1e27:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1e2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1e32:	eb 04                	jmp    1e38 <malloc+0x23>
+    1e34:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1e38:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1e3c:	7f 16                	jg     1e54 <malloc+0x3f>
+    1e3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e41:	ba 20 00 00 00       	mov    $0x20,%edx
+    1e46:	89 c1                	mov    %eax,%ecx
+    1e48:	48 d3 e2             	shl    %cl,%rdx
+    1e4b:	48 89 d0             	mov    %rdx,%rax
+    1e4e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1e52:	72 e0                	jb     1e34 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1e54:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1e58:	75 7d                	jne    1ed7 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1e5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e5e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1e64:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1e6a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1e6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e72:	48 89 c7             	mov    %rax,%rdi
+    1e75:	e8 8b fd ff ff       	call   1c05 <pagealloc>
+    1e7a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1e7e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1e83:	75 0a                	jne    1e8f <malloc+0x7a>
+      return 0;
+    1e85:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e8a:	e9 2c 01 00 00       	jmp    1fbb <malloc+0x1a6>
+    h->size = n;
+    1e8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e93:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e97:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1e9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e9e:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1ea5:	00 
+    stats.inuse[LARGE]++;
+    1ea6:	8b 05 b4 44 00 00    	mov    0x44b4(%rip),%eax        # 6360 <stats+0x20>
+    1eac:	83 c0 01             	add    $0x1,%eax
+    1eaf:	89 05 ab 44 00 00    	mov    %eax,0x44ab(%rip)        # 6360 <stats+0x20>
+    stats.large += n;
+    1eb5:	48 8b 15 cc 44 00 00 	mov    0x44cc(%rip),%rdx        # 6388 <stats+0x48>
+    1ebc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ec0:	48 01 d0             	add    %rdx,%rax
+    1ec3:	48 89 05 be 44 00 00 	mov    %rax,0x44be(%rip)        # 6388 <stats+0x48>
+    return h + 1;
+    1eca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ece:	48 83 c0 10          	add    $0x10,%rax
+    1ed2:	e9 e4 00 00 00       	jmp    1fbb <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1eda:	48 98                	cltq
+    1edc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ee3:	00 
+    1ee4:	48 8d 05 f5 43 00 00 	lea    0x43f5(%rip),%rax        # 62e0 <freelist>
+    1eeb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1eef:	48 85 c0             	test   %rax,%rax
+    1ef2:	75 18                	jne    1f0c <malloc+0xf7>
+    1ef4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ef7:	89 c7                	mov    %eax,%edi
+    1ef9:	e8 11 fe ff ff       	call   1d0f <refill>
+    1efe:	85 c0                	test   %eax,%eax
+    1f00:	79 0a                	jns    1f0c <malloc+0xf7>
+    return 0;
+    1f02:	b8 00 00 00 00       	mov    $0x0,%eax
+    1f07:	e9 af 00 00 00       	jmp    1fbb <malloc+0x1a6>
+  b = freelist[c];
+    1f0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f0f:	48 98                	cltq
+    1f11:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f18:	00 
+    1f19:	48 8d 05 c0 43 00 00 	lea    0x43c0(%rip),%rax        # 62e0 <freelist>
+    1f20:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1f24:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1f28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f2c:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1f30:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1f33:	48 63 d2             	movslq %edx,%rdx
+    1f36:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1f3d:	00 
+    1f3e:	48 8d 15 9b 43 00 00 	lea    0x439b(%rip),%rdx        # 62e0 <freelist>
+    1f45:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1f49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f4c:	48 98                	cltq
+    1f4e:	48 83 c0 08          	add    $0x8,%rax
+    1f52:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f59:	00 
+    1f5a:	48 8d 05 e3 43 00 00 	lea    0x43e3(%rip),%rax        # 6344 <stats+0x4>
+    1f61:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1f64:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1f67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f6a:	48 98                	cltq
+    1f6c:	48 83 c0 08          	add    $0x8,%rax
+    1f70:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f77:	00 
+    1f78:	48 8d 05 c5 43 00 00 	lea    0x43c5(%rip),%rax        # 6344 <stats+0x4>
+    1f7f:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1f82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f85:	48 98                	cltq
+    1f87:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f8e:	00 
+    1f8f:	48 8d 05 aa 43 00 00 	lea    0x43aa(%rip),%rax        # 6340 <stats>
+    1f96:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1f99:	8d 48 01             	lea    0x1(%rax),%ecx
+    1f9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f9f:	48 98                	cltq
+    1fa1:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1fa8:	00 
+    1fa9:	48 8d 05 90 43 00 00 	lea    0x4390(%rip),%rax        # 6340 <stats>
+    1fb0:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1fb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fb7:	48 83 c0 10          	add    $0x10,%rax
+}
+    1fbb:	c9                   	leave
+    1fbc:	c3                   	ret
+
+0000000000001fbd <free>:
+
+void free(void *ap) {
+    1fbd:	55                   	push   %rbp
+    1fbe:	48 89 e5             	mov    %rsp,%rbp
+    1fc1:	48 83 ec 18          	sub    $0x18,%rsp
+    1fc5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1fc9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1fce:	0f 84 03 01 00 00    	je     20d7 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1fd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fd8:	48 83 e8 10          	sub    $0x10,%rax
+    1fdc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1fe0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fe4:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1fe8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1fec:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1ff1:	75 42                	jne    2035 <free+0x78>
+    stats.inuse[LARGE]--;
+    1ff3:	8b 05 67 43 00 00    	mov    0x4367(%rip),%eax        # 6360 <stats+0x20>
+    1ff9:	83 e8 01             	sub    $0x1,%eax
+    1ffc:	89 05 5e 43 00 00    	mov    %eax,0x435e(%rip)        # 6360 <stats+0x20>
+    stats.large -= b->h.size;
+    2002:	48 8b 15 7f 43 00 00 	mov    0x437f(%rip),%rdx        # 6388 <stats+0x48>
+    2009:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    200d:	48 8b 00             	mov    (%rax),%rax
+    2010:	48 29 c2             	sub    %rax,%rdx
+    2013:	48 89 15 6e 43 00 00 	mov    %rdx,0x436e(%rip)        # 6388 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    201a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    201e:	48 8b 10             	mov    (%rax),%rdx
+    2021:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2025:	48 89 d6             	mov    %rdx,%rsi
+    2028:	48 89 c7             	mov    %rax,%rdi
+    202b:	e8 ae fa ff ff       	call   1ade <pagefree>
+    return;
+    2030:	e9 a3 00 00 00       	jmp    20d8 <free+0x11b>
+  }
+  b->next = freelist[c];
+    2035:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2039:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2040:	00 
+    2041:	48 8d 05 98 42 00 00 	lea    0x4298(%rip),%rax        # 62e0 <freelist>
+    2048:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    204c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2050:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    2054:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2058:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    205f:	00 
+    2060:	48 8d 15 79 42 00 00 	lea    0x4279(%rip),%rdx        # 62e0 <freelist>
+    2067:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    206b:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    206f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2073:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    207a:	00 
+    207b:	48 8d 05 be 42 00 00 	lea    0x42be(%rip),%rax        # 6340 <stats>
+    2082:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2085:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2088:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    208c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2093:	00 
+    2094:	48 8d 05 a5 42 00 00 	lea    0x42a5(%rip),%rax        # 6340 <stats>
+    209b:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    209e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20a2:	48 83 c0 08          	add    $0x8,%rax
+    20a6:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20ad:	00 
+    20ae:	48 8d 05 8f 42 00 00 	lea    0x428f(%rip),%rax        # 6344 <stats+0x4>
+    20b5:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    20b8:	8d 48 01             	lea    0x1(%rax),%ecx
+    20bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20bf:	48 83 c0 08          	add    $0x8,%rax
+    20c3:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20ca:	00 
+    20cb:	48 8d 05 72 42 00 00 	lea    0x4272(%rip),%rax        # 6344 <stats+0x4>
+    20d2:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    20d5:	eb 01                	jmp    20d8 <free+0x11b>
+    return;
+    20d7:	90                   	nop
+}
+    20d8:	c9                   	leave
+    20d9:	c3                   	ret
+
+00000000000020da <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    20da:	55                   	push   %rbp
+    20db:	48 89 e5             	mov    %rsp,%rbp
+    20de:	48 83 ec 30          	sub    $0x30,%rsp
+    20e2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    20e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20e8:	48 8d 15 c1 04 00 00 	lea    0x4c1(%rip),%rdx        # 25b0 <benchreport+0x3ae>
+    20ef:	48 89 d6             	mov    %rdx,%rsi
+    20f2:	89 c7                	mov    %eax,%edi
+    20f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    20f9:	e8 37 e6 ff ff       	call   735 <printf>
+  for (c = 0; c < NCLASS; c++)
+    20fe:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2105:	eb 67                	jmp    216e <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2107:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    210a:	48 98                	cltq
+    210c:	48 83 c0 08          	add    $0x8,%rax
+    2110:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2117:	00 
+    2118:	48 8d 05 25 42 00 00 	lea    0x4225(%rip),%rax        # 6344 <stats+0x4>
+    211f:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    2122:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2125:	48 98                	cltq
+    2127:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    212e:	00 
+    212f:	48 8d 05 0a 42 00 00 	lea    0x420a(%rip),%rax        # 6340 <stats>
+    2136:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    2139:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    213c:	ba 20 00 00 00       	mov    $0x20,%edx
+    2141:	89 c1                	mov    %eax,%ecx
+    2143:	48 d3 e2             	shl    %cl,%rdx
+    2146:	48 89 d0             	mov    %rdx,%rax
+    2149:	89 c1                	mov    %eax,%ecx
+    214b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    214e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2151:	41 89 f9             	mov    %edi,%r9d
+    2154:	41 89 f0             	mov    %esi,%r8d
+    2157:	48 8d 35 69 04 00 00 	lea    0x469(%rip),%rsi        # 25c7 <benchreport+0x3c5>
+    215e:	89 c7                	mov    %eax,%edi
+    2160:	b8 00 00 00 00       	mov    $0x0,%eax
+    2165:	e8 cb e5 ff ff       	call   735 <printf>
+  for (c = 0; c < NCLASS; c++)
+    216a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    216e:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    2172:	7e 93                	jle    2107 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    2174:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    217b:	00 
+  for (r = runs; r; r = r->next)
+    217c:	48 8b 05 9d 41 00 00 	mov    0x419d(%rip),%rax        # 6320 <runs>
+    2183:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2187:	eb 17                	jmp    21a0 <mallocstats+0xc6>
+    nfree += r->size;
+    2189:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    218d:	48 8b 00             	mov    (%rax),%rax
+    2190:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    2194:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2198:	48 8b 40 08          	mov    0x8(%rax),%rax
+    219c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    21a0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    21a5:	75 e2                	jne    2189 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    21a7:	48 8b 05 e2 41 00 00 	mov    0x41e2(%rip),%rax        # 6390 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    21ae:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    21b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21b4:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    21b8:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    21ba:	48 8b 05 c7 41 00 00 	mov    0x41c7(%rip),%rax        # 6388 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    21c1:	89 c1                	mov    %eax,%ecx
+    21c3:	8b 15 97 41 00 00    	mov    0x4197(%rip),%edx        # 6360 <stats+0x20>
+    21c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    21cc:	41 89 f9             	mov    %edi,%r9d
+    21cf:	41 89 f0             	mov    %esi,%r8d
+    21d2:	48 8d 35 ff 03 00 00 	lea    0x3ff(%rip),%rsi        # 25d8 <benchreport+0x3d6>
+    21d9:	89 c7                	mov    %eax,%edi
+    21db:	b8 00 00 00 00       	mov    $0x0,%eax
+    21e0:	e8 50 e5 ff ff       	call   735 <printf>
+}
+    21e5:	90                   	nop
+    21e6:	c9                   	leave
+    21e7:	c3                   	ret
+
+00000000000021e8 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    21e8:	55                   	push   %rbp
+    21e9:	48 89 e5             	mov    %rsp,%rbp
+    21ec:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    21f0:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    21f4:	48 89 c7             	mov    %rax,%rdi
+    21f7:	e8 9a f7 ff ff       	call   1996 <cycles>
+  return t;
+    21fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    2200:	c9                   	leave
+    2201:	c3                   	ret
+
+0000000000002202 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    2202:	55                   	push   %rbp
+    2203:	48 89 e5             	mov    %rsp,%rbp
+    2206:	48 83 ec 30          	sub    $0x30,%rsp
+    220a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    220e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    2212:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    2215:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    2219:	0f 8e 24 01 00 00    	jle    2343 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    221f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    2226:	e9 98 00 00 00       	jmp    22c3 <benchreport+0xc1>
+    x = t[i];
+    222b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    222e:	48 98                	cltq
+    2230:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2237:	00 
+    2238:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    223c:	48 01 d0             	add    %rdx,%rax
+    223f:	48 8b 00             	mov    (%rax),%rax
+    2242:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2246:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2249:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    224c:	eb 33                	jmp    2281 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    224e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2251:	48 98                	cltq
+    2253:	48 c1 e0 03          	shl    $0x3,%rax
+    2257:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    225b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    225f:	48 01 d0             	add    %rdx,%rax
+    2262:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2265:	48 63 d2             	movslq %edx,%rdx
+    2268:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    226f:	00 
+    2270:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2274:	48 01 ca             	add    %rcx,%rdx
+    2277:	48 8b 00             	mov    (%rax),%rax
+    227a:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    227d:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    2281:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2285:	7e 1d                	jle    22a4 <benchreport+0xa2>
+    2287:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    228a:	48 98                	cltq
+    228c:	48 c1 e0 03          	shl    $0x3,%rax
+    2290:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2298:	48 01 d0             	add    %rdx,%rax
+    229b:	48 8b 00             	mov    (%rax),%rax
+    229e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    22a2:	72 aa                	jb     224e <benchreport+0x4c>
+    t[j] = x;
+    22a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    22a7:	48 98                	cltq
+    22a9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22b0:	00 
+    22b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22b5:	48 01 c2             	add    %rax,%rdx
+    22b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    22bc:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    22bf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    22c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22c6:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    22c9:	0f 8c 5c ff ff ff    	jl     222b <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    22cf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    22d2:	48 98                	cltq
+    22d4:	48 c1 e0 03          	shl    $0x3,%rax
+    22d8:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    22dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    22e0:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    22e3:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    22e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    22e9:	89 c2                	mov    %eax,%edx
+    22eb:	c1 ea 1f             	shr    $0x1f,%edx
+    22ee:	01 d0                	add    %edx,%eax
+    22f0:	d1 f8                	sar    %eax
+    22f2:	48 98                	cltq
+    22f4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22fb:	00 
+    22fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2300:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2303:	48 8b 38             	mov    (%rax),%rdi
+    2306:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    230a:	48 8b 30             	mov    (%rax),%rsi
+    230d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    2310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2314:	48 83 ec 08          	sub    $0x8,%rsp
+    2318:	51                   	push   %rcx
+    2319:	49 89 f9             	mov    %rdi,%r9
+    231c:	49 89 f0             	mov    %rsi,%r8
+    231f:	89 d1                	mov    %edx,%ecx
+    2321:	48 89 c2             	mov    %rax,%rdx
+    2324:	48 8d 05 ed 02 00 00 	lea    0x2ed(%rip),%rax        # 2618 <benchreport+0x416>
+    232b:	48 89 c6             	mov    %rax,%rsi
+    232e:	bf 01 00 00 00       	mov    $0x1,%edi
+    2333:	b8 00 00 00 00       	mov    $0x0,%eax
+    2338:	e8 f8 e3 ff ff       	call   735 <printf>
+    233d:	48 83 c4 10          	add    $0x10,%rsp
+    2341:	eb 01                	jmp    2344 <benchreport+0x142>
+    return;
+    2343:	90                   	nop
+}
+    2344:	c9                   	leave
+    2345:	c3                   	ret
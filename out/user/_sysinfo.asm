@@ -0,0 +1,4039 @@
+
+out/user/_sysinfo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <printall>:
+// sysinfo prints every counter the kernel keeps.
+// sysinfo interval [count] instead prints, every interval ticks, how
+// much the main ones moved since the last report, count times or for
+// ever.
+
+static void printall(struct sys_info *info) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 30          	sub    $0x30,%rsp
+       8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  uint64_t n;
+
+  printf(1, "version = %d\n", info->version);
+       c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      10:	8b 00                	mov    (%rax),%eax
+      12:	89 c2                	mov    %eax,%edx
+      14:	48 8d 05 fd 26 00 00 	lea    0x26fd(%rip),%rax        # 2718 <benchreport+0x149>
+      1b:	48 89 c6             	mov    %rax,%rsi
+      1e:	bf 01 00 00 00       	mov    $0x1,%edi
+      23:	b8 00 00 00 00       	mov    $0x0,%eax
+      28:	e8 d5 0a 00 00       	call   b02 <printf>
+  printf(1, "pages_in_use = %d\n", info->pages_in_use);
+      2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      31:	8b 40 08             	mov    0x8(%rax),%eax
+      34:	89 c2                	mov    %eax,%edx
+      36:	48 8d 05 e9 26 00 00 	lea    0x26e9(%rip),%rax        # 2726 <benchreport+0x157>
+      3d:	48 89 c6             	mov    %rax,%rsi
+      40:	bf 01 00 00 00       	mov    $0x1,%edi
+      45:	b8 00 00 00 00       	mov    $0x0,%eax
+      4a:	e8 b3 0a 00 00       	call   b02 <printf>
+  printf(1, "pages_in_swap = %d\n", info->pages_in_swap);
+      4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      53:	8b 40 0c             	mov    0xc(%rax),%eax
+      56:	89 c2                	mov    %eax,%edx
+      58:	48 8d 05 da 26 00 00 	lea    0x26da(%rip),%rax        # 2739 <benchreport+0x16a>
+      5f:	48 89 c6             	mov    %rax,%rsi
+      62:	bf 01 00 00 00       	mov    $0x1,%edi
+      67:	b8 00 00 00 00       	mov    $0x0,%eax
+      6c:	e8 91 0a 00 00       	call   b02 <printf>
+  printf(1, "free_pages = %d\n", info->free_pages);
+      71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      75:	8b 40 10             	mov    0x10(%rax),%eax
+      78:	89 c2                	mov    %eax,%edx
+      7a:	48 8d 05 cc 26 00 00 	lea    0x26cc(%rip),%rax        # 274d <benchreport+0x17e>
+      81:	48 89 c6             	mov    %rax,%rsi
+      84:	bf 01 00 00 00       	mov    $0x1,%edi
+      89:	b8 00 00 00 00       	mov    $0x0,%eax
+      8e:	e8 6f 0a 00 00       	call   b02 <printf>
+  printf(1, "num_page_faults = %d\n", info->num_page_faults);
+      93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      97:	8b 40 14             	mov    0x14(%rax),%eax
+      9a:	89 c2                	mov    %eax,%edx
+      9c:	48 8d 05 bb 26 00 00 	lea    0x26bb(%rip),%rax        # 275e <benchreport+0x18f>
+      a3:	48 89 c6             	mov    %rax,%rsi
+      a6:	bf 01 00 00 00       	mov    $0x1,%edi
+      ab:	b8 00 00 00 00       	mov    $0x0,%eax
+      b0:	e8 4d 0a 00 00       	call   b02 <printf>
+  printf(1, "cow_reuses = %d\n", info->cow_reuses);
+      b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      b9:	8b 40 18             	mov    0x18(%rax),%eax
+      bc:	89 c2                	mov    %eax,%edx
+      be:	48 8d 05 af 26 00 00 	lea    0x26af(%rip),%rax        # 2774 <benchreport+0x1a5>
+      c5:	48 89 c6             	mov    %rax,%rsi
+      c8:	bf 01 00 00 00       	mov    $0x1,%edi
+      cd:	b8 00 00 00 00       	mov    $0x0,%eax
+      d2:	e8 2b 0a 00 00       	call   b02 <printf>
+  printf(1, "cow_copies = %d\n", info->cow_copies);
+      d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      db:	8b 40 1c             	mov    0x1c(%rax),%eax
+      de:	89 c2                	mov    %eax,%edx
+      e0:	48 8d 05 9e 26 00 00 	lea    0x269e(%rip),%rax        # 2785 <benchreport+0x1b6>
+      e7:	48 89 c6             	mov    %rax,%rsi
+      ea:	bf 01 00 00 00       	mov    $0x1,%edi
+      ef:	b8 00 00 00 00       	mov    $0x0,%eax
+      f4:	e8 09 0a 00 00       	call   b02 <printf>
+  printf(1, "swap_outs = %d\n", info->swap_outs);
+      f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      fd:	8b 40 20             	mov    0x20(%rax),%eax
+     100:	89 c2                	mov    %eax,%edx
+     102:	48 8d 05 8d 26 00 00 	lea    0x268d(%rip),%rax        # 2796 <benchreport+0x1c7>
+     109:	48 89 c6             	mov    %rax,%rsi
+     10c:	bf 01 00 00 00       	mov    $0x1,%edi
+     111:	b8 00 00 00 00       	mov    $0x0,%eax
+     116:	e8 e7 09 00 00       	call   b02 <printf>
+  printf(1, "swap_ins = %d\n", info->swap_ins);
+     11b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     11f:	8b 40 24             	mov    0x24(%rax),%eax
+     122:	89 c2                	mov    %eax,%edx
+     124:	48 8d 05 7b 26 00 00 	lea    0x267b(%rip),%rax        # 27a6 <benchreport+0x1d7>
+     12b:	48 89 c6             	mov    %rax,%rsi
+     12e:	bf 01 00 00 00       	mov    $0x1,%edi
+     133:	b8 00 00 00 00       	mov    $0x0,%eax
+     138:	e8 c5 09 00 00       	call   b02 <printf>
+  printf(1, "clock_scans = %d\n", info->clock_scans);
+     13d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     141:	8b 40 28             	mov    0x28(%rax),%eax
+     144:	89 c2                	mov    %eax,%edx
+     146:	48 8d 05 68 26 00 00 	lea    0x2668(%rip),%rax        # 27b5 <benchreport+0x1e6>
+     14d:	48 89 c6             	mov    %rax,%rsi
+     150:	bf 01 00 00 00       	mov    $0x1,%edi
+     155:	b8 00 00 00 00       	mov    $0x0,%eax
+     15a:	e8 a3 09 00 00       	call   b02 <printf>
+  printf(1, "clock_referenced = %d\n", info->clock_referenced);
+     15f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     163:	8b 40 2c             	mov    0x2c(%rax),%eax
+     166:	89 c2                	mov    %eax,%edx
+     168:	48 8d 05 58 26 00 00 	lea    0x2658(%rip),%rax        # 27c7 <benchreport+0x1f8>
+     16f:	48 89 c6             	mov    %rax,%rsi
+     172:	bf 01 00 00 00       	mov    $0x1,%edi
+     177:	b8 00 00 00 00       	mov    $0x0,%eax
+     17c:	e8 81 09 00 00       	call   b02 <printf>
+  printf(1, "num_disk_reads = %d\n", info->num_disk_reads);
+     181:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     185:	8b 40 30             	mov    0x30(%rax),%eax
+     188:	89 c2                	mov    %eax,%edx
+     18a:	48 8d 05 4d 26 00 00 	lea    0x264d(%rip),%rax        # 27de <benchreport+0x20f>
+     191:	48 89 c6             	mov    %rax,%rsi
+     194:	bf 01 00 00 00       	mov    $0x1,%edi
+     199:	b8 00 00 00 00       	mov    $0x0,%eax
+     19e:	e8 5f 09 00 00       	call   b02 <printf>
+  printf(1, "bcache_size = %d\n", info->bcache_size);
+     1a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     1a7:	8b 40 34             	mov    0x34(%rax),%eax
+     1aa:	89 c2                	mov    %eax,%edx
+     1ac:	48 8d 05 40 26 00 00 	lea    0x2640(%rip),%rax        # 27f3 <benchreport+0x224>
+     1b3:	48 89 c6             	mov    %rax,%rsi
+     1b6:	bf 01 00 00 00       	mov    $0x1,%edi
+     1bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c0:	e8 3d 09 00 00       	call   b02 <printf>
+  printf(1, "bcache_hits = %d\n", info->bcache_hits);
+     1c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     1c9:	8b 40 38             	mov    0x38(%rax),%eax
+     1cc:	89 c2                	mov    %eax,%edx
+     1ce:	48 8d 05 30 26 00 00 	lea    0x2630(%rip),%rax        # 2805 <benchreport+0x236>
+     1d5:	48 89 c6             	mov    %rax,%rsi
+     1d8:	bf 01 00 00 00       	mov    $0x1,%edi
+     1dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e2:	e8 1b 09 00 00       	call   b02 <printf>
+  printf(1, "bcache_misses = %d\n", info->bcache_misses);
+     1e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     1eb:	8b 40 3c             	mov    0x3c(%rax),%eax
+     1ee:	89 c2                	mov    %eax,%edx
+     1f0:	48 8d 05 20 26 00 00 	lea    0x2620(%rip),%rax        # 2817 <benchreport+0x248>
+     1f7:	48 89 c6             	mov    %rax,%rsi
+     1fa:	bf 01 00 00 00       	mov    $0x1,%edi
+     1ff:	b8 00 00 00 00       	mov    $0x0,%eax
+     204:	e8 f9 08 00 00       	call   b02 <printf>
+  printf(1, "icache_size = %d\n", info->icache_size);
+     209:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     20d:	8b 40 40             	mov    0x40(%rax),%eax
+     210:	89 c2                	mov    %eax,%edx
+     212:	48 8d 05 12 26 00 00 	lea    0x2612(%rip),%rax        # 282b <benchreport+0x25c>
+     219:	48 89 c6             	mov    %rax,%rsi
+     21c:	bf 01 00 00 00       	mov    $0x1,%edi
+     221:	b8 00 00 00 00       	mov    $0x0,%eax
+     226:	e8 d7 08 00 00       	call   b02 <printf>
+  printf(1, "icache_hits = %d\n", info->icache_hits);
+     22b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     22f:	8b 40 44             	mov    0x44(%rax),%eax
+     232:	89 c2                	mov    %eax,%edx
+     234:	48 8d 05 02 26 00 00 	lea    0x2602(%rip),%rax        # 283d <benchreport+0x26e>
+     23b:	48 89 c6             	mov    %rax,%rsi
+     23e:	bf 01 00 00 00       	mov    $0x1,%edi
+     243:	b8 00 00 00 00       	mov    $0x0,%eax
+     248:	e8 b5 08 00 00       	call   b02 <printf>
+  printf(1, "icache_misses = %d\n", info->icache_misses);
+     24d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     251:	8b 40 48             	mov    0x48(%rax),%eax
+     254:	89 c2                	mov    %eax,%edx
+     256:	48 8d 05 f2 25 00 00 	lea    0x25f2(%rip),%rax        # 284f <benchreport+0x280>
+     25d:	48 89 c6             	mov    %rax,%rsi
+     260:	bf 01 00 00 00       	mov    $0x1,%edi
+     265:	b8 00 00 00 00       	mov    $0x0,%eax
+     26a:	e8 93 08 00 00       	call   b02 <printf>
+  printf(1, "dcache_hits = %d\n", info->dcache_hits);
+     26f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     273:	8b 40 4c             	mov    0x4c(%rax),%eax
+     276:	89 c2                	mov    %eax,%edx
+     278:	48 8d 05 e4 25 00 00 	lea    0x25e4(%rip),%rax        # 2863 <benchreport+0x294>
+     27f:	48 89 c6             	mov    %rax,%rsi
+     282:	bf 01 00 00 00       	mov    $0x1,%edi
+     287:	b8 00 00 00 00       	mov    $0x0,%eax
+     28c:	e8 71 08 00 00       	call   b02 <printf>
+  printf(1, "dcache_misses = %d\n", info->dcache_misses);
+     291:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     295:	8b 40 50             	mov    0x50(%rax),%eax
+     298:	89 c2                	mov    %eax,%edx
+     29a:	48 8d 05 d4 25 00 00 	lea    0x25d4(%rip),%rax        # 2875 <benchreport+0x2a6>
+     2a1:	48 89 c6             	mov    %rax,%rsi
+     2a4:	bf 01 00 00 00       	mov    $0x1,%edi
+     2a9:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ae:	e8 4f 08 00 00       	call   b02 <printf>
+  printf(1, "pcache_size = %d\n", info->pcache_size);
+     2b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     2b7:	8b 40 54             	mov    0x54(%rax),%eax
+     2ba:	89 c2                	mov    %eax,%edx
+     2bc:	48 8d 05 c6 25 00 00 	lea    0x25c6(%rip),%rax        # 2889 <benchreport+0x2ba>
+     2c3:	48 89 c6             	mov    %rax,%rsi
+     2c6:	bf 01 00 00 00       	mov    $0x1,%edi
+     2cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d0:	e8 2d 08 00 00       	call   b02 <printf>
+  printf(1, "pcache_hits = %d\n", info->pcache_hits);
+     2d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     2d9:	8b 40 58             	mov    0x58(%rax),%eax
+     2dc:	89 c2                	mov    %eax,%edx
+     2de:	48 8d 05 b6 25 00 00 	lea    0x25b6(%rip),%rax        # 289b <benchreport+0x2cc>
+     2e5:	48 89 c6             	mov    %rax,%rsi
+     2e8:	bf 01 00 00 00       	mov    $0x1,%edi
+     2ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f2:	e8 0b 08 00 00       	call   b02 <printf>
+  printf(1, "pcache_misses = %d\n", info->pcache_misses);
+     2f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     2fb:	8b 40 5c             	mov    0x5c(%rax),%eax
+     2fe:	89 c2                	mov    %eax,%edx
+     300:	48 8d 05 a6 25 00 00 	lea    0x25a6(%rip),%rax        # 28ad <benchreport+0x2de>
+     307:	48 89 c6             	mov    %rax,%rsi
+     30a:	bf 01 00 00 00       	mov    $0x1,%edi
+     30f:	b8 00 00 00 00       	mov    $0x0,%eax
+     314:	e8 e9 07 00 00       	call   b02 <printf>
+  for (int i = 0; i <= MAXORDER; i++)
+     319:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     320:	eb 35                	jmp    357 <printall+0x357>
+    printf(1, "free_blocks[%d] = %d\n", i, info->free_blocks[i]);
+     322:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     326:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     329:	48 63 d2             	movslq %edx,%rdx
+     32c:	48 83 c2 18          	add    $0x18,%rdx
+     330:	8b 14 90             	mov    (%rax,%rdx,4),%edx
+     333:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     336:	89 d1                	mov    %edx,%ecx
+     338:	89 c2                	mov    %eax,%edx
+     33a:	48 8d 05 80 25 00 00 	lea    0x2580(%rip),%rax        # 28c1 <benchreport+0x2f2>
+     341:	48 89 c6             	mov    %rax,%rsi
+     344:	bf 01 00 00 00       	mov    $0x1,%edi
+     349:	b8 00 00 00 00       	mov    $0x0,%eax
+     34e:	e8 af 07 00 00       	call   b02 <printf>
+  for (int i = 0; i <= MAXORDER; i++)
+     353:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     357:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     35b:	7e c5                	jle    322 <printall+0x322>
+  if (info->version < 2)
+     35d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     361:	8b 00                	mov    (%rax),%eax
+     363:	83 f8 01             	cmp    $0x1,%eax
+     366:	0f 8e e0 01 00 00    	jle    54c <printall+0x54c>
+    return;
+
+  printf(1, "disk_reads = %ld\n", info->disk_reads);
+     36c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     370:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+     377:	48 89 c2             	mov    %rax,%rdx
+     37a:	48 8d 05 56 25 00 00 	lea    0x2556(%rip),%rax        # 28d7 <benchreport+0x308>
+     381:	48 89 c6             	mov    %rax,%rsi
+     384:	bf 01 00 00 00       	mov    $0x1,%edi
+     389:	b8 00 00 00 00       	mov    $0x0,%eax
+     38e:	e8 6f 07 00 00       	call   b02 <printf>
+  printf(1, "disk_writes = %ld\n", info->disk_writes);
+     393:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     397:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+     39e:	48 89 c2             	mov    %rax,%rdx
+     3a1:	48 8d 05 41 25 00 00 	lea    0x2541(%rip),%rax        # 28e9 <benchreport+0x31a>
+     3a8:	48 89 c6             	mov    %rax,%rsi
+     3ab:	bf 01 00 00 00       	mov    $0x1,%edi
+     3b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b5:	e8 48 07 00 00       	call   b02 <printf>
+  printf(1, "disk_requests = %ld\n", info->disk_requests);
+     3ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     3be:	48 8b 80 98 00 00 00 	mov    0x98(%rax),%rax
+     3c5:	48 89 c2             	mov    %rax,%rdx
+     3c8:	48 8d 05 2d 25 00 00 	lea    0x252d(%rip),%rax        # 28fc <benchreport+0x32d>
+     3cf:	48 89 c6             	mov    %rax,%rsi
+     3d2:	bf 01 00 00 00       	mov    $0x1,%edi
+     3d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3dc:	e8 21 07 00 00       	call   b02 <printf>
+  printf(1, "log_commits = %ld\n", info->log_commits);
+     3e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     3e5:	48 8b 80 a0 00 00 00 	mov    0xa0(%rax),%rax
+     3ec:	48 89 c2             	mov    %rax,%rdx
+     3ef:	48 8d 05 1b 25 00 00 	lea    0x251b(%rip),%rax        # 2911 <benchreport+0x342>
+     3f6:	48 89 c6             	mov    %rax,%rsi
+     3f9:	bf 01 00 00 00       	mov    $0x1,%edi
+     3fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     403:	e8 fa 06 00 00       	call   b02 <printf>
+  printf(1, "log_blocks = %ld\n", info->log_blocks);
+     408:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     40c:	48 8b 80 a8 00 00 00 	mov    0xa8(%rax),%rax
+     413:	48 89 c2             	mov    %rax,%rdx
+     416:	48 8d 05 07 25 00 00 	lea    0x2507(%rip),%rax        # 2924 <benchreport+0x355>
+     41d:	48 89 c6             	mov    %rax,%rsi
+     420:	bf 01 00 00 00       	mov    $0x1,%edi
+     425:	b8 00 00 00 00       	mov    $0x0,%eax
+     42a:	e8 d3 06 00 00       	call   b02 <printf>
+  printf(1, "log_checkpoints = %ld\n", info->log_checkpoints);
+     42f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     433:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+     43a:	48 89 c2             	mov    %rax,%rdx
+     43d:	48 8d 05 f2 24 00 00 	lea    0x24f2(%rip),%rax        # 2936 <benchreport+0x367>
+     444:	48 89 c6             	mov    %rax,%rsi
+     447:	bf 01 00 00 00       	mov    $0x1,%edi
+     44c:	b8 00 00 00 00       	mov    $0x0,%eax
+     451:	e8 ac 06 00 00       	call   b02 <printf>
+  printf(1, "ctxswitches = %ld\n", info->ctxswitches);
+     456:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     45a:	48 8b 80 b8 00 00 00 	mov    0xb8(%rax),%rax
+     461:	48 89 c2             	mov    %rax,%rdx
+     464:	48 8d 05 e2 24 00 00 	lea    0x24e2(%rip),%rax        # 294d <benchreport+0x37e>
+     46b:	48 89 c6             	mov    %rax,%rsi
+     46e:	bf 01 00 00 00       	mov    $0x1,%edi
+     473:	b8 00 00 00 00       	mov    $0x0,%eax
+     478:	e8 85 06 00 00       	call   b02 <printf>
+  printf(1, "ticks = %ld\n", info->ticks);
+     47d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     481:	48 8b 80 c0 00 00 00 	mov    0xc0(%rax),%rax
+     488:	48 89 c2             	mov    %rax,%rdx
+     48b:	48 8d 05 ce 24 00 00 	lea    0x24ce(%rip),%rax        # 2960 <benchreport+0x391>
+     492:	48 89 c6             	mov    %rax,%rsi
+     495:	bf 01 00 00 00       	mov    $0x1,%edi
+     49a:	b8 00 00 00 00       	mov    $0x0,%eax
+     49f:	e8 5e 06 00 00       	call   b02 <printf>
+  for (int i = 0; i < info->ncpu; i++)
+     4a4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     4ab:	eb 38                	jmp    4e5 <printall+0x4e5>
+    printf(1, "cpu_idle[%d] = %ld\n", i, info->cpu_idle[i]);
+     4ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     4b1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     4b4:	48 63 d2             	movslq %edx,%rdx
+     4b7:	48 83 c2 1a          	add    $0x1a,%rdx
+     4bb:	48 8b 54 d0 08       	mov    0x8(%rax,%rdx,8),%rdx
+     4c0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4c3:	48 89 d1             	mov    %rdx,%rcx
+     4c6:	89 c2                	mov    %eax,%edx
+     4c8:	48 8d 05 9e 24 00 00 	lea    0x249e(%rip),%rax        # 296d <benchreport+0x39e>
+     4cf:	48 89 c6             	mov    %rax,%rsi
+     4d2:	bf 01 00 00 00       	mov    $0x1,%edi
+     4d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     4dc:	e8 21 06 00 00       	call   b02 <printf>
+  for (int i = 0; i < info->ncpu; i++)
+     4e1:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     4e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     4e9:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+     4ef:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     4f2:	7c b9                	jl     4ad <printall+0x4ad>
+  for (int i = 0; i < NSYSCALL; i++)
+     4f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     4fb:	eb 47                	jmp    544 <printall+0x544>
+    if ((n = info->syscalls[i]) != 0)
+     4fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     501:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     504:	48 63 d2             	movslq %edx,%rdx
+     507:	48 83 c2 22          	add    $0x22,%rdx
+     50b:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     510:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+     514:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+     519:	74 25                	je     540 <printall+0x540>
+      printf(1, "syscalls[%d] = %ld\n", i, n);
+     51b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     51f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     522:	48 89 d1             	mov    %rdx,%rcx
+     525:	89 c2                	mov    %eax,%edx
+     527:	48 8d 05 53 24 00 00 	lea    0x2453(%rip),%rax        # 2981 <benchreport+0x3b2>
+     52e:	48 89 c6             	mov    %rax,%rsi
+     531:	bf 01 00 00 00       	mov    $0x1,%edi
+     536:	b8 00 00 00 00       	mov    $0x0,%eax
+     53b:	e8 c2 05 00 00       	call   b02 <printf>
+  for (int i = 0; i < NSYSCALL; i++)
+     540:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     544:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+     548:	7e b3                	jle    4fd <printall+0x4fd>
+     54a:	eb 01                	jmp    54d <printall+0x54d>
+    return;
+     54c:	90                   	nop
+}
+     54d:	c9                   	leave
+     54e:	c3                   	ret
+
+000000000000054f <pct>:
+
+// Percent of b that a is, for hit rates and idle time
+static int pct(uint64_t a, uint64_t b) {
+     54f:	55                   	push   %rbp
+     550:	48 89 e5             	mov    %rsp,%rbp
+     553:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     557:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return b ? (int)(a * 100 / b) : 0;
+     55b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     560:	74 28                	je     58a <pct+0x3b>
+     562:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     566:	48 89 d0             	mov    %rdx,%rax
+     569:	48 c1 e0 02          	shl    $0x2,%rax
+     56d:	48 01 d0             	add    %rdx,%rax
+     570:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     577:	00 
+     578:	48 01 d0             	add    %rdx,%rax
+     57b:	48 c1 e0 02          	shl    $0x2,%rax
+     57f:	ba 00 00 00 00       	mov    $0x0,%edx
+     584:	48 f7 75 f0          	divq   -0x10(%rbp)
+     588:	eb 05                	jmp    58f <pct+0x40>
+     58a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     58f:	5d                   	pop    %rbp
+     590:	c3                   	ret
+
+0000000000000591 <printdelta>:
+
+static void printdelta(struct sys_info *a, struct sys_info *b) {
+     591:	55                   	push   %rbp
+     592:	48 89 e5             	mov    %rsp,%rbp
+     595:	41 57                	push   %r15
+     597:	41 56                	push   %r14
+     599:	41 55                	push   %r13
+     59b:	41 54                	push   %r12
+     59d:	53                   	push   %rbx
+     59e:	48 83 ec 48          	sub    $0x48,%rsp
+     5a2:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+     5a6:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  uint64_t calls, hits, lookups, cycles;
+
+  calls = 0;
+     5aa:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+     5b1:	00 
+  for (int i = 0; i < NSYSCALL; i++)
+     5b2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     5b9:	eb 31                	jmp    5ec <printdelta+0x5b>
+    calls += b->syscalls[i] - a->syscalls[i];
+     5bb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     5bf:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+     5c2:	48 63 d2             	movslq %edx,%rdx
+     5c5:	48 83 c2 22          	add    $0x22,%rdx
+     5c9:	48 8b 54 d0 08       	mov    0x8(%rax,%rdx,8),%rdx
+     5ce:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     5d2:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+     5d5:	48 63 c9             	movslq %ecx,%rcx
+     5d8:	48 83 c1 22          	add    $0x22,%rcx
+     5dc:	48 8b 44 c8 08       	mov    0x8(%rax,%rcx,8),%rax
+     5e1:	48 29 c2             	sub    %rax,%rdx
+     5e4:	48 01 55 c8          	add    %rdx,-0x38(%rbp)
+  for (int i = 0; i < NSYSCALL; i++)
+     5e8:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     5ec:	83 7d c4 3f          	cmpl   $0x3f,-0x3c(%rbp)
+     5f0:	7e c9                	jle    5bb <printdelta+0x2a>
+  hits = b->bcache_hits - a->bcache_hits;
+     5f2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     5f6:	8b 50 38             	mov    0x38(%rax),%edx
+     5f9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     5fd:	8b 40 38             	mov    0x38(%rax),%eax
+     600:	29 c2                	sub    %eax,%edx
+     602:	48 63 c2             	movslq %edx,%rax
+     605:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  lookups = hits + b->bcache_misses - a->bcache_misses;
+     609:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     60d:	8b 40 3c             	mov    0x3c(%rax),%eax
+     610:	48 63 d0             	movslq %eax,%rdx
+     613:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     617:	48 01 c2             	add    %rax,%rdx
+     61a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     61e:	8b 40 3c             	mov    0x3c(%rax),%eax
+     621:	48 98                	cltq
+     623:	48 29 c2             	sub    %rax,%rdx
+     626:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+         calls, b->ctxswitches - a->ctxswitches,
+         b->num_page_faults - a->num_page_faults,
+         b->cow_reuses + b->cow_copies - a->cow_reuses - a->cow_copies,
+         (uint64_t)pct(hits, lookups), lookups, b->disk_reads - a->disk_reads,
+         b->disk_writes - a->disk_writes, b->disk_requests - a->disk_requests,
+         b->log_commits - a->log_commits, b->log_blocks - a->log_blocks);
+     62a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     62e:	48 8b 90 a8 00 00 00 	mov    0xa8(%rax),%rdx
+     635:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     639:	48 8b 80 a8 00 00 00 	mov    0xa8(%rax),%rax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     640:	48 29 c2             	sub    %rax,%rdx
+     643:	49 89 d7             	mov    %rdx,%r15
+         b->log_commits - a->log_commits, b->log_blocks - a->log_blocks);
+     646:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     64a:	48 8b 90 a0 00 00 00 	mov    0xa0(%rax),%rdx
+     651:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     655:	48 8b 80 a0 00 00 00 	mov    0xa0(%rax),%rax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     65c:	48 29 c2             	sub    %rax,%rdx
+     65f:	49 89 d6             	mov    %rdx,%r14
+         b->disk_writes - a->disk_writes, b->disk_requests - a->disk_requests,
+     662:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     666:	48 8b 90 98 00 00 00 	mov    0x98(%rax),%rdx
+     66d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     671:	48 8b 80 98 00 00 00 	mov    0x98(%rax),%rax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     678:	48 29 c2             	sub    %rax,%rdx
+     67b:	49 89 d5             	mov    %rdx,%r13
+         b->disk_writes - a->disk_writes, b->disk_requests - a->disk_requests,
+     67e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     682:	48 8b 90 90 00 00 00 	mov    0x90(%rax),%rdx
+     689:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     68d:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     694:	48 29 c2             	sub    %rax,%rdx
+     697:	49 89 d4             	mov    %rdx,%r12
+         (uint64_t)pct(hits, lookups), lookups, b->disk_reads - a->disk_reads,
+     69a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     69e:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+     6a5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     6a9:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     6b0:	48 89 d3             	mov    %rdx,%rbx
+     6b3:	48 29 c3             	sub    %rax,%rbx
+         (uint64_t)pct(hits, lookups), lookups, b->disk_reads - a->disk_reads,
+     6b6:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+     6ba:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     6be:	48 89 d6             	mov    %rdx,%rsi
+     6c1:	48 89 c7             	mov    %rax,%rdi
+     6c4:	e8 86 fe ff ff       	call   54f <pct>
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     6c9:	48 63 c8             	movslq %eax,%rcx
+         b->cow_reuses + b->cow_copies - a->cow_reuses - a->cow_copies,
+     6cc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     6d0:	8b 50 18             	mov    0x18(%rax),%edx
+     6d3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     6d7:	8b 40 1c             	mov    0x1c(%rax),%eax
+     6da:	01 c2                	add    %eax,%edx
+     6dc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     6e0:	8b 40 18             	mov    0x18(%rax),%eax
+     6e3:	29 c2                	sub    %eax,%edx
+     6e5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     6e9:	8b 40 1c             	mov    0x1c(%rax),%eax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     6ec:	89 d7                	mov    %edx,%edi
+     6ee:	29 c7                	sub    %eax,%edi
+         b->num_page_faults - a->num_page_faults,
+     6f0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     6f4:	8b 50 14             	mov    0x14(%rax),%edx
+     6f7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     6fb:	8b 40 14             	mov    0x14(%rax),%eax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     6fe:	89 d6                	mov    %edx,%esi
+     700:	29 c6                	sub    %eax,%esi
+         calls, b->ctxswitches - a->ctxswitches,
+     702:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     706:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+     70d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     711:	48 8b 80 b8 00 00 00 	mov    0xb8(%rax),%rax
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+     718:	48 29 c2             	sub    %rax,%rdx
+     71b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     71f:	48 83 ec 08          	sub    $0x8,%rsp
+     723:	41 57                	push   %r15
+     725:	41 56                	push   %r14
+     727:	41 55                	push   %r13
+     729:	41 54                	push   %r12
+     72b:	53                   	push   %rbx
+     72c:	ff 75 b0             	push   -0x50(%rbp)
+     72f:	51                   	push   %rcx
+     730:	41 89 f9             	mov    %edi,%r9d
+     733:	41 89 f0             	mov    %esi,%r8d
+     736:	48 89 d1             	mov    %rdx,%rcx
+     739:	48 89 c2             	mov    %rax,%rdx
+     73c:	48 8d 05 55 22 00 00 	lea    0x2255(%rip),%rax        # 2998 <benchreport+0x3c9>
+     743:	48 89 c6             	mov    %rax,%rsi
+     746:	bf 01 00 00 00       	mov    $0x1,%edi
+     74b:	b8 00 00 00 00       	mov    $0x0,%eax
+     750:	e8 ad 03 00 00       	call   b02 <printf>
+     755:	48 83 c4 40          	add    $0x40,%rsp
+  cycles = b->tsc - a->tsc;
+     759:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     75d:	48 8b 90 c8 00 00 00 	mov    0xc8(%rax),%rdx
+     764:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     768:	48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+     76f:	48 29 c2             	sub    %rax,%rdx
+     772:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  for (int i = 0; i < b->ncpu; i++)
+     776:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+     77d:	eb 57                	jmp    7d6 <printdelta+0x245>
+    printf(1, " %d%%", pct(b->cpu_idle[i] - a->cpu_idle[i], cycles));
+     77f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     783:	8b 55 c0             	mov    -0x40(%rbp),%edx
+     786:	48 63 d2             	movslq %edx,%rdx
+     789:	48 83 c2 1a          	add    $0x1a,%rdx
+     78d:	48 8b 54 d0 08       	mov    0x8(%rax,%rdx,8),%rdx
+     792:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+     796:	8b 4d c0             	mov    -0x40(%rbp),%ecx
+     799:	48 63 c9             	movslq %ecx,%rcx
+     79c:	48 83 c1 1a          	add    $0x1a,%rcx
+     7a0:	48 8b 44 c8 08       	mov    0x8(%rax,%rcx,8),%rax
+     7a5:	48 29 c2             	sub    %rax,%rdx
+     7a8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     7ac:	48 89 c6             	mov    %rax,%rsi
+     7af:	48 89 d7             	mov    %rdx,%rdi
+     7b2:	e8 98 fd ff ff       	call   54f <pct>
+     7b7:	89 c2                	mov    %eax,%edx
+     7b9:	48 8d 05 50 22 00 00 	lea    0x2250(%rip),%rax        # 2a10 <benchreport+0x441>
+     7c0:	48 89 c6             	mov    %rax,%rsi
+     7c3:	bf 01 00 00 00       	mov    $0x1,%edi
+     7c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7cd:	e8 30 03 00 00       	call   b02 <printf>
+  for (int i = 0; i < b->ncpu; i++)
+     7d2:	83 45 c0 01          	addl   $0x1,-0x40(%rbp)
+     7d6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     7da:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+     7e0:	39 45 c0             	cmp    %eax,-0x40(%rbp)
+     7e3:	7c 9a                	jl     77f <printdelta+0x1ee>
+  printf(1, "\n");
+     7e5:	48 8d 05 2a 22 00 00 	lea    0x222a(%rip),%rax        # 2a16 <benchreport+0x447>
+     7ec:	48 89 c6             	mov    %rax,%rsi
+     7ef:	bf 01 00 00 00       	mov    $0x1,%edi
+     7f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f9:	e8 04 03 00 00       	call   b02 <printf>
+}
+     7fe:	90                   	nop
+     7ff:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+     803:	5b                   	pop    %rbx
+     804:	41 5c                	pop    %r12
+     806:	41 5d                	pop    %r13
+     808:	41 5e                	pop    %r14
+     80a:	41 5f                	pop    %r15
+     80c:	5d                   	pop    %rbp
+     80d:	c3                   	ret
+
+000000000000080e <main>:
+
+int main(int argc, char *argv[]) {
+     80e:	55                   	push   %rbp
+     80f:	48 89 e5             	mov    %rsp,%rbp
+     812:	48 81 ec 50 06 00 00 	sub    $0x650,%rsp
+     819:	89 bd bc f9 ff ff    	mov    %edi,-0x644(%rbp)
+     81f:	48 89 b5 b0 f9 ff ff 	mov    %rsi,-0x650(%rbp)
+  struct sys_info a, b;
+  int interval, count;
+
+  if (sysinfo(&a) < 0) {
+     826:	48 8d 85 e0 fc ff ff 	lea    -0x320(%rbp),%rax
+     82d:	48 89 c7             	mov    %rax,%rdi
+     830:	e8 5d 14 00 00       	call   1c92 <sysinfo>
+     835:	85 c0                	test   %eax,%eax
+     837:	79 1e                	jns    857 <main+0x49>
+    printf(2, "sysinfo: failed\n");
+     839:	48 8d 05 d8 21 00 00 	lea    0x21d8(%rip),%rax        # 2a18 <benchreport+0x449>
+     840:	48 89 c6             	mov    %rax,%rsi
+     843:	bf 02 00 00 00       	mov    $0x2,%edi
+     848:	b8 00 00 00 00       	mov    $0x0,%eax
+     84d:	e8 b0 02 00 00       	call   b02 <printf>
+    exit();
+     852:	e8 db 08 00 00       	call   1132 <exit>
+  }
+  if (argc < 2) {
+     857:	83 bd bc f9 ff ff 01 	cmpl   $0x1,-0x644(%rbp)
+     85e:	7f 14                	jg     874 <main+0x66>
+    printall(&a);
+     860:	48 8d 85 e0 fc ff ff 	lea    -0x320(%rbp),%rax
+     867:	48 89 c7             	mov    %rax,%rdi
+     86a:	e8 91 f7 ff ff       	call   0 <printall>
+    exit();
+     86f:	e8 be 08 00 00       	call   1132 <exit>
+  }
+  if (a.version < 2) {
+     874:	8b 85 e0 fc ff ff    	mov    -0x320(%rbp),%eax
+     87a:	83 f8 01             	cmp    $0x1,%eax
+     87d:	7f 1e                	jg     89d <main+0x8f>
+    printf(2, "sysinfo: kernel too old for deltas\n");
+     87f:	48 8d 05 aa 21 00 00 	lea    0x21aa(%rip),%rax        # 2a30 <benchreport+0x461>
+     886:	48 89 c6             	mov    %rax,%rsi
+     889:	bf 02 00 00 00       	mov    $0x2,%edi
+     88e:	b8 00 00 00 00       	mov    $0x0,%eax
+     893:	e8 6a 02 00 00       	call   b02 <printf>
+    exit();
+     898:	e8 95 08 00 00       	call   1132 <exit>
+  }
+
+  interval = atoi(argv[1]);
+     89d:	48 8b 85 b0 f9 ff ff 	mov    -0x650(%rbp),%rax
+     8a4:	48 83 c0 08          	add    $0x8,%rax
+     8a8:	48 8b 00             	mov    (%rax),%rax
+     8ab:	48 89 c7             	mov    %rax,%rdi
+     8ae:	e8 e9 0d 00 00       	call   169c <atoi>
+     8b3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  count = argc > 2 ? atoi(argv[2]) : -1;
+     8b6:	83 bd bc f9 ff ff 02 	cmpl   $0x2,-0x644(%rbp)
+     8bd:	7e 18                	jle    8d7 <main+0xc9>
+     8bf:	48 8b 85 b0 f9 ff ff 	mov    -0x650(%rbp),%rax
+     8c6:	48 83 c0 10          	add    $0x10,%rax
+     8ca:	48 8b 00             	mov    (%rax),%rax
+     8cd:	48 89 c7             	mov    %rax,%rdi
+     8d0:	e8 c7 0d 00 00       	call   169c <atoi>
+     8d5:	eb 05                	jmp    8dc <main+0xce>
+     8d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     8dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (count != 0) {
+     8df:	eb 58                	jmp    939 <main+0x12b>
+    sleep(interval);
+     8e1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8e4:	89 c7                	mov    %eax,%edi
+     8e6:	e8 91 13 00 00       	call   1c7c <sleep>
+    sysinfo(&b);
+     8eb:	48 8d 85 c8 f9 ff ff 	lea    -0x638(%rbp),%rax
+     8f2:	48 89 c7             	mov    %rax,%rdi
+     8f5:	e8 98 13 00 00       	call   1c92 <sysinfo>
+    printdelta(&a, &b);
+     8fa:	48 8d 95 c8 f9 ff ff 	lea    -0x638(%rbp),%rdx
+     901:	48 8d 85 e0 fc ff ff 	lea    -0x320(%rbp),%rax
+     908:	48 89 d6             	mov    %rdx,%rsi
+     90b:	48 89 c7             	mov    %rax,%rdi
+     90e:	e8 7e fc ff ff       	call   591 <printdelta>
+    a = b;
+     913:	48 8d 85 e0 fc ff ff 	lea    -0x320(%rbp),%rax
+     91a:	48 8d 95 c8 f9 ff ff 	lea    -0x638(%rbp),%rdx
+     921:	b9 63 00 00 00       	mov    $0x63,%ecx
+     926:	48 89 c7             	mov    %rax,%rdi
+     929:	48 89 d6             	mov    %rdx,%rsi
+     92c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    if (count > 0)
+     92f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     933:	7e 04                	jle    939 <main+0x12b>
+      count--;
+     935:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+  while (count != 0) {
+     939:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     93d:	75 a2                	jne    8e1 <main+0xd3>
+  }
+  exit();
+     93f:	e8 ee 07 00 00       	call   1132 <exit>
+
+0000000000000944 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     944:	55                   	push   %rbp
+     945:	48 89 e5             	mov    %rsp,%rbp
+     948:	48 83 ec 10          	sub    $0x10,%rsp
+     94c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     94f:	89 f0                	mov    %esi,%eax
+     951:	88 45 f8             	mov    %al,-0x8(%rbp)
+     954:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     958:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     95b:	89 d6                	mov    %edx,%esi
+     95d:	89 c7                	mov    %eax,%edi
+     95f:	e8 eb 06 00 00       	call   104f <bputc>
+     964:	90                   	nop
+     965:	c9                   	leave
+     966:	c3                   	ret
+
+0000000000000967 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     967:	55                   	push   %rbp
+     968:	48 89 e5             	mov    %rsp,%rbp
+     96b:	48 83 ec 50          	sub    $0x50,%rsp
+     96f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     972:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     976:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     979:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     97c:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     980:	74 21                	je     9a3 <printint64+0x3c>
+     982:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     986:	48 c1 e8 3f          	shr    $0x3f,%rax
+     98a:	0f b6 c0             	movzbl %al,%eax
+     98d:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     990:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     994:	74 0d                	je     9a3 <printint64+0x3c>
+    x = -xx;
+     996:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     99a:	48 f7 d8             	neg    %rax
+     99d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     9a1:	eb 08                	jmp    9ab <printint64+0x44>
+  else
+    x = xx;
+     9a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     9a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     9ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     9b2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     9b5:	48 63 c8             	movslq %eax,%rcx
+     9b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9bc:	ba 00 00 00 00       	mov    $0x0,%edx
+     9c1:	48 f7 f1             	div    %rcx
+     9c4:	48 89 d1             	mov    %rdx,%rcx
+     9c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9ca:	8d 50 01             	lea    0x1(%rax),%edx
+     9cd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     9d0:	48 8d 15 29 36 00 00 	lea    0x3629(%rip),%rdx        # 4000 <digits.1>
+     9d7:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     9db:	48 98                	cltq
+     9dd:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     9e1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     9e4:	48 63 f0             	movslq %eax,%rsi
+     9e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9eb:	ba 00 00 00 00       	mov    $0x0,%edx
+     9f0:	48 f7 f6             	div    %rsi
+     9f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     9f7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     9fc:	75 b4                	jne    9b2 <printint64+0x4b>
+
+  if (sgn)
+     9fe:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     a02:	74 2b                	je     a2f <printint64+0xc8>
+    buf[i++] = '-';
+     a04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a07:	8d 50 01             	lea    0x1(%rax),%edx
+     a0a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     a0d:	48 98                	cltq
+     a0f:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     a14:	eb 19                	jmp    a2f <printint64+0xc8>
+    putc(fd, buf[i]);
+     a16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a19:	48 98                	cltq
+     a1b:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     a20:	0f be d0             	movsbl %al,%edx
+     a23:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     a26:	89 d6                	mov    %edx,%esi
+     a28:	89 c7                	mov    %eax,%edi
+     a2a:	e8 15 ff ff ff       	call   944 <putc>
+  while (--i >= 0)
+     a2f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     a33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     a37:	79 dd                	jns    a16 <printint64+0xaf>
+}
+     a39:	90                   	nop
+     a3a:	90                   	nop
+     a3b:	c9                   	leave
+     a3c:	c3                   	ret
+
+0000000000000a3d <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     a3d:	55                   	push   %rbp
+     a3e:	48 89 e5             	mov    %rsp,%rbp
+     a41:	48 83 ec 30          	sub    $0x30,%rsp
+     a45:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     a48:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     a4b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     a4e:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     a51:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     a58:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     a5c:	74 17                	je     a75 <printint+0x38>
+     a5e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     a62:	79 11                	jns    a75 <printint+0x38>
+    neg = 1;
+     a64:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     a6b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a6e:	f7 d8                	neg    %eax
+     a70:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a73:	eb 06                	jmp    a7b <printint+0x3e>
+  } else {
+    x = xx;
+     a75:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     a78:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     a7b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     a82:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     a85:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a88:	ba 00 00 00 00       	mov    $0x0,%edx
+     a8d:	f7 f1                	div    %ecx
+     a8f:	89 d1                	mov    %edx,%ecx
+     a91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a94:	8d 50 01             	lea    0x1(%rax),%edx
+     a97:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     a9a:	89 c9                	mov    %ecx,%ecx
+     a9c:	48 8d 15 7d 35 00 00 	lea    0x357d(%rip),%rdx        # 4020 <digits.0>
+     aa3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     aa7:	48 98                	cltq
+     aa9:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     aad:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     ab0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ab3:	ba 00 00 00 00       	mov    $0x0,%edx
+     ab8:	f7 f6                	div    %esi
+     aba:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     abd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     ac1:	75 bf                	jne    a82 <printint+0x45>
+  if (neg)
+     ac3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ac7:	74 2b                	je     af4 <printint+0xb7>
+    buf[i++] = '-';
+     ac9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     acc:	8d 50 01             	lea    0x1(%rax),%edx
+     acf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ad2:	48 98                	cltq
+     ad4:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     ad9:	eb 19                	jmp    af4 <printint+0xb7>
+    putc(fd, buf[i]);
+     adb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ade:	48 98                	cltq
+     ae0:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     ae5:	0f be d0             	movsbl %al,%edx
+     ae8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     aeb:	89 d6                	mov    %edx,%esi
+     aed:	89 c7                	mov    %eax,%edi
+     aef:	e8 50 fe ff ff       	call   944 <putc>
+  while (--i >= 0)
+     af4:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     af8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     afc:	79 dd                	jns    adb <printint+0x9e>
+}
+     afe:	90                   	nop
+     aff:	90                   	nop
+     b00:	c9                   	leave
+     b01:	c3                   	ret
+
+0000000000000b02 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     b02:	55                   	push   %rbp
+     b03:	48 89 e5             	mov    %rsp,%rbp
+     b06:	48 83 ec 70          	sub    $0x70,%rsp
+     b0a:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     b0d:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     b11:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     b15:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     b19:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     b1d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     b21:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     b28:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     b2c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     b30:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     b34:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     b38:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     b3f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     b46:	e9 67 02 00 00       	jmp    db2 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     b4b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     b4e:	48 63 d0             	movslq %eax,%rdx
+     b51:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     b55:	48 01 d0             	add    %rdx,%rax
+     b58:	0f b6 00             	movzbl (%rax),%eax
+     b5b:	0f be c0             	movsbl %al,%eax
+     b5e:	25 ff 00 00 00       	and    $0xff,%eax
+     b63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     b66:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     b6a:	75 30                	jne    b9c <printf+0x9a>
+      if (c == '%') {
+     b6c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     b70:	75 13                	jne    b85 <printf+0x83>
+        state = '%';
+     b72:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     b79:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     b80:	e9 29 02 00 00       	jmp    dae <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     b85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     b88:	0f be d0             	movsbl %al,%edx
+     b8b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b8e:	89 d6                	mov    %edx,%esi
+     b90:	89 c7                	mov    %eax,%edi
+     b92:	e8 ad fd ff ff       	call   944 <putc>
+     b97:	e9 12 02 00 00       	jmp    dae <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     b9c:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     ba0:	0f 85 08 02 00 00    	jne    dae <printf+0x2ac>
+      if (c == 'l') {
+     ba6:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     baa:	75 0c                	jne    bb8 <printf+0xb6>
+        lflag = 1;
+     bac:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     bb3:	e9 f6 01 00 00       	jmp    dae <printf+0x2ac>
+      } else if (c == 'd') {
+     bb8:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     bbc:	0f 85 93 00 00 00    	jne    c55 <printf+0x153>
+        if (lflag == 1)
+     bc2:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     bc6:	75 47                	jne    c0f <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     bc8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     bcb:	83 f8 2f             	cmp    $0x2f,%eax
+     bce:	77 17                	ja     be7 <printf+0xe5>
+     bd0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     bd4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     bd7:	89 d2                	mov    %edx,%edx
+     bd9:	48 01 d0             	add    %rdx,%rax
+     bdc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     bdf:	83 c2 08             	add    $0x8,%edx
+     be2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     be5:	eb 0c                	jmp    bf3 <printf+0xf1>
+     be7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     beb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     bef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     bf3:	48 8b 30             	mov    (%rax),%rsi
+     bf6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     bf9:	b9 01 00 00 00       	mov    $0x1,%ecx
+     bfe:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c03:	89 c7                	mov    %eax,%edi
+     c05:	e8 5d fd ff ff       	call   967 <printint64>
+     c0a:	e9 98 01 00 00       	jmp    da7 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     c0f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     c12:	83 f8 2f             	cmp    $0x2f,%eax
+     c15:	77 17                	ja     c2e <printf+0x12c>
+     c17:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     c1b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     c1e:	89 d2                	mov    %edx,%edx
+     c20:	48 01 d0             	add    %rdx,%rax
+     c23:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     c26:	83 c2 08             	add    $0x8,%edx
+     c29:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     c2c:	eb 0c                	jmp    c3a <printf+0x138>
+     c2e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     c32:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c36:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     c3a:	8b 30                	mov    (%rax),%esi
+     c3c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     c3f:	b9 01 00 00 00       	mov    $0x1,%ecx
+     c44:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c49:	89 c7                	mov    %eax,%edi
+     c4b:	e8 ed fd ff ff       	call   a3d <printint>
+     c50:	e9 52 01 00 00       	jmp    da7 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     c55:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     c59:	74 0a                	je     c65 <printf+0x163>
+     c5b:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     c5f:	0f 85 93 00 00 00    	jne    cf8 <printf+0x1f6>
+        if (lflag == 1)
+     c65:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     c69:	75 47                	jne    cb2 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     c6b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     c6e:	83 f8 2f             	cmp    $0x2f,%eax
+     c71:	77 17                	ja     c8a <printf+0x188>
+     c73:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     c77:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     c7a:	89 d2                	mov    %edx,%edx
+     c7c:	48 01 d0             	add    %rdx,%rax
+     c7f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     c82:	83 c2 08             	add    $0x8,%edx
+     c85:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     c88:	eb 0c                	jmp    c96 <printf+0x194>
+     c8a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     c8e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     c92:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     c96:	48 8b 30             	mov    (%rax),%rsi
+     c99:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     c9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ca1:	ba 10 00 00 00       	mov    $0x10,%edx
+     ca6:	89 c7                	mov    %eax,%edi
+     ca8:	e8 ba fc ff ff       	call   967 <printint64>
+        if (lflag == 1)
+     cad:	e9 f5 00 00 00       	jmp    da7 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     cb2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     cb5:	83 f8 2f             	cmp    $0x2f,%eax
+     cb8:	77 17                	ja     cd1 <printf+0x1cf>
+     cba:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     cbe:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     cc1:	89 d2                	mov    %edx,%edx
+     cc3:	48 01 d0             	add    %rdx,%rax
+     cc6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     cc9:	83 c2 08             	add    $0x8,%edx
+     ccc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     ccf:	eb 0c                	jmp    cdd <printf+0x1db>
+     cd1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     cd5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     cd9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     cdd:	8b 30                	mov    (%rax),%esi
+     cdf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     ce2:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ce7:	ba 10 00 00 00       	mov    $0x10,%edx
+     cec:	89 c7                	mov    %eax,%edi
+     cee:	e8 4a fd ff ff       	call   a3d <printint>
+        if (lflag == 1)
+     cf3:	e9 af 00 00 00       	jmp    da7 <printf+0x2a5>
+      } else if (c == 's') {
+     cf8:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     cfc:	75 6e                	jne    d6c <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     cfe:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     d01:	83 f8 2f             	cmp    $0x2f,%eax
+     d04:	77 17                	ja     d1d <printf+0x21b>
+     d06:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     d0a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     d0d:	89 d2                	mov    %edx,%edx
+     d0f:	48 01 d0             	add    %rdx,%rax
+     d12:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     d15:	83 c2 08             	add    $0x8,%edx
+     d18:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     d1b:	eb 0c                	jmp    d29 <printf+0x227>
+     d1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     d21:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     d25:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     d29:	48 8b 00             	mov    (%rax),%rax
+     d2c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     d30:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     d35:	75 28                	jne    d5f <printf+0x25d>
+          s = "(null)";
+     d37:	48 8d 05 16 1d 00 00 	lea    0x1d16(%rip),%rax        # 2a54 <benchreport+0x485>
+     d3e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     d42:	eb 1b                	jmp    d5f <printf+0x25d>
+          putc(fd, *s);
+     d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d48:	0f b6 00             	movzbl (%rax),%eax
+     d4b:	0f be d0             	movsbl %al,%edx
+     d4e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     d51:	89 d6                	mov    %edx,%esi
+     d53:	89 c7                	mov    %eax,%edi
+     d55:	e8 ea fb ff ff       	call   944 <putc>
+        for (; *s; s++)
+     d5a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     d5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d63:	0f b6 00             	movzbl (%rax),%eax
+     d66:	84 c0                	test   %al,%al
+     d68:	75 da                	jne    d44 <printf+0x242>
+     d6a:	eb 3b                	jmp    da7 <printf+0x2a5>
+      } else if (c == '%') {
+     d6c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     d70:	75 14                	jne    d86 <printf+0x284>
+        putc(fd, c);
+     d72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     d75:	0f be d0             	movsbl %al,%edx
+     d78:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     d7b:	89 d6                	mov    %edx,%esi
+     d7d:	89 c7                	mov    %eax,%edi
+     d7f:	e8 c0 fb ff ff       	call   944 <putc>
+     d84:	eb 21                	jmp    da7 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     d86:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     d89:	be 25 00 00 00       	mov    $0x25,%esi
+     d8e:	89 c7                	mov    %eax,%edi
+     d90:	e8 af fb ff ff       	call   944 <putc>
+        putc(fd, c);
+     d95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     d98:	0f be d0             	movsbl %al,%edx
+     d9b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     d9e:	89 d6                	mov    %edx,%esi
+     da0:	89 c7                	mov    %eax,%edi
+     da2:	e8 9d fb ff ff       	call   944 <putc>
+      }
+      state = 0;
+     da7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     dae:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     db2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     db5:	48 63 d0             	movslq %eax,%rdx
+     db8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     dbc:	48 01 d0             	add    %rdx,%rax
+     dbf:	0f b6 00             	movzbl (%rax),%eax
+     dc2:	84 c0                	test   %al,%al
+     dc4:	0f 85 81 fd ff ff    	jne    b4b <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     dca:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     dcd:	89 c7                	mov    %eax,%edi
+     dcf:	e8 ee 02 00 00       	call   10c2 <bflushtty>
+}
+     dd4:	90                   	nop
+     dd5:	c9                   	leave
+     dd6:	c3                   	ret
+
+0000000000000dd7 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     dd7:	55                   	push   %rbp
+     dd8:	48 89 e5             	mov    %rsp,%rbp
+     ddb:	48 83 ec 30          	sub    $0x30,%rsp
+     ddf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     de2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     de6:	78 06                	js     dee <getbuf+0x17>
+     de8:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     dec:	7e 0a                	jle    df8 <getbuf+0x21>
+    return 0;
+     dee:	b8 00 00 00 00       	mov    $0x0,%eax
+     df3:	e9 94 00 00 00       	jmp    e8c <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     df8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     dfb:	48 98                	cltq
+     dfd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     e04:	00 
+     e05:	48 8d 05 34 32 00 00 	lea    0x3234(%rip),%rax        # 4040 <obufs>
+     e0c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     e10:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e14:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     e19:	75 6d                	jne    e88 <getbuf+0xb1>
+     e1b:	bf 08 02 00 00       	mov    $0x208,%edi
+     e20:	e8 bd 13 00 00       	call   21e2 <malloc>
+     e25:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e29:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     e2e:	74 58                	je     e88 <getbuf+0xb1>
+    b->n = 0;
+     e30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e34:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     e3a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     e3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e41:	48 89 d6             	mov    %rdx,%rsi
+     e44:	89 c7                	mov    %eax,%edi
+     e46:	e8 e4 0d 00 00       	call   1c2f <fstat>
+     e4b:	85 c0                	test   %eax,%eax
+     e4d:	75 11                	jne    e60 <getbuf+0x89>
+     e4f:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     e53:	66 83 f8 03          	cmp    $0x3,%ax
+     e57:	75 07                	jne    e60 <getbuf+0x89>
+     e59:	ba 01 00 00 00       	mov    $0x1,%edx
+     e5e:	eb 05                	jmp    e65 <getbuf+0x8e>
+     e60:	ba 00 00 00 00       	mov    $0x0,%edx
+     e65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e69:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     e6c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e6f:	48 98                	cltq
+     e71:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     e78:	00 
+     e79:	48 8d 15 c0 31 00 00 	lea    0x31c0(%rip),%rdx        # 4040 <obufs>
+     e80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e84:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     e88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e8c:	c9                   	leave
+     e8d:	c3                   	ret
+
+0000000000000e8e <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     e8e:	55                   	push   %rbp
+     e8f:	48 89 e5             	mov    %rsp,%rbp
+     e92:	48 83 ec 20          	sub    $0x20,%rsp
+     e96:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     e99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     e9d:	78 33                	js     ed2 <bflush+0x44>
+     e9f:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     ea3:	7f 2d                	jg     ed2 <bflush+0x44>
+     ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ea8:	48 98                	cltq
+     eaa:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     eb1:	00 
+     eb2:	48 8d 05 87 31 00 00 	lea    0x3187(%rip),%rax        # 4040 <obufs>
+     eb9:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     ebd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     ec1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     ec6:	74 0a                	je     ed2 <bflush+0x44>
+     ec8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ecc:	8b 00                	mov    (%rax),%eax
+     ece:	85 c0                	test   %eax,%eax
+     ed0:	75 07                	jne    ed9 <bflush+0x4b>
+    return 0;
+     ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed7:	eb 3c                	jmp    f15 <bflush+0x87>
+  n = b->n;
+     ed9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     edd:	8b 00                	mov    (%rax),%eax
+     edf:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     ee2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ee6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     eec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     ef4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     ef7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     efa:	48 89 ce             	mov    %rcx,%rsi
+     efd:	89 c7                	mov    %eax,%edi
+     eff:	e8 de 0c 00 00       	call   1be2 <write>
+     f04:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     f07:	75 07                	jne    f10 <bflush+0x82>
+     f09:	b8 00 00 00 00       	mov    $0x0,%eax
+     f0e:	eb 05                	jmp    f15 <bflush+0x87>
+     f10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     f15:	c9                   	leave
+     f16:	c3                   	ret
+
+0000000000000f17 <bflushall>:
+
+void bflushall(void) {
+     f17:	55                   	push   %rbp
+     f18:	48 89 e5             	mov    %rsp,%rbp
+     f1b:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     f1f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     f26:	eb 0e                	jmp    f36 <bflushall+0x1f>
+    bflush(fd);
+     f28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f2b:	89 c7                	mov    %eax,%edi
+     f2d:	e8 5c ff ff ff       	call   e8e <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     f32:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     f36:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     f3a:	7e ec                	jle    f28 <bflushall+0x11>
+}
+     f3c:	90                   	nop
+     f3d:	90                   	nop
+     f3e:	c9                   	leave
+     f3f:	c3                   	ret
+
+0000000000000f40 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     f40:	55                   	push   %rbp
+     f41:	48 89 e5             	mov    %rsp,%rbp
+     f44:	48 83 ec 30          	sub    $0x30,%rsp
+     f48:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     f4b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     f4f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     f52:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f55:	89 c7                	mov    %eax,%edi
+     f57:	e8 7b fe ff ff       	call   dd7 <getbuf>
+     f5c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     f60:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     f65:	75 19                	jne    f80 <bwrite+0x40>
+    return write(fd, s, n);
+     f67:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     f6a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     f6e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f71:	48 89 ce             	mov    %rcx,%rsi
+     f74:	89 c7                	mov    %eax,%edi
+     f76:	e8 67 0c 00 00       	call   1be2 <write>
+     f7b:	e9 cd 00 00 00       	jmp    104d <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     f80:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     f87:	e9 92 00 00 00       	jmp    101e <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     f8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f90:	8b 00                	mov    (%rax),%eax
+     f92:	3d 00 02 00 00       	cmp    $0x200,%eax
+     f97:	75 18                	jne    fb1 <bwrite+0x71>
+     f99:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f9c:	89 c7                	mov    %eax,%edi
+     f9e:	e8 eb fe ff ff       	call   e8e <bflush>
+     fa3:	85 c0                	test   %eax,%eax
+     fa5:	79 0a                	jns    fb1 <bwrite+0x71>
+      return -1;
+     fa7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     fac:	e9 9c 00 00 00       	jmp    104d <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     fb1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     fb4:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     fb7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     fba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fbe:	8b 00                	mov    (%rax),%eax
+     fc0:	ba 00 02 00 00       	mov    $0x200,%edx
+     fc5:	29 c2                	sub    %eax,%edx
+     fc7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     fca:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     fcd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     fd0:	39 c2                	cmp    %eax,%edx
+     fd2:	0f 4e c2             	cmovle %edx,%eax
+     fd5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     fd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fdb:	48 63 d0             	movslq %eax,%rdx
+     fde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     fe2:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     fe6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fea:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     fee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ff2:	8b 00                	mov    (%rax),%eax
+     ff4:	48 98                	cltq
+     ff6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     ffa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     ffd:	89 c2                	mov    %eax,%edx
+     fff:	48 89 cf             	mov    %rcx,%rdi
+    1002:	e8 e9 06 00 00       	call   16f0 <memmove>
+    b->n += m;
+    1007:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    100b:	8b 10                	mov    (%rax),%edx
+    100d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    1010:	01 c2                	add    %eax,%edx
+    1012:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1016:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+    1018:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    101b:	01 45 fc             	add    %eax,-0x4(%rbp)
+    101e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1021:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+    1024:	0f 8c 62 ff ff ff    	jl     f8c <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+    102a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    102e:	8b 40 04             	mov    0x4(%rax),%eax
+    1031:	85 c0                	test   %eax,%eax
+    1033:	74 15                	je     104a <bwrite+0x10a>
+    1035:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1038:	89 c7                	mov    %eax,%edi
+    103a:	e8 4f fe ff ff       	call   e8e <bflush>
+    103f:	85 c0                	test   %eax,%eax
+    1041:	79 07                	jns    104a <bwrite+0x10a>
+    return -1;
+    1043:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1048:	eb 03                	jmp    104d <bwrite+0x10d>
+  return n;
+    104a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+    104d:	c9                   	leave
+    104e:	c3                   	ret
+
+000000000000104f <bputc>:
+
+void bputc(int fd, char c) {
+    104f:	55                   	push   %rbp
+    1050:	48 89 e5             	mov    %rsp,%rbp
+    1053:	48 83 ec 20          	sub    $0x20,%rsp
+    1057:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    105a:	89 f0                	mov    %esi,%eax
+    105c:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    105f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1062:	89 c7                	mov    %eax,%edi
+    1064:	e8 6e fd ff ff       	call   dd7 <getbuf>
+    1069:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    106d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1072:	75 18                	jne    108c <bputc+0x3d>
+    write(fd, &c, 1);
+    1074:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+    1078:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    107b:	ba 01 00 00 00       	mov    $0x1,%edx
+    1080:	48 89 ce             	mov    %rcx,%rsi
+    1083:	89 c7                	mov    %eax,%edi
+    1085:	e8 58 0b 00 00       	call   1be2 <write>
+    return;
+    108a:	eb 34                	jmp    10c0 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+    108c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1090:	8b 00                	mov    (%rax),%eax
+    1092:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1097:	75 0a                	jne    10a3 <bputc+0x54>
+    bflush(fd);
+    1099:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    109c:	89 c7                	mov    %eax,%edi
+    109e:	e8 eb fd ff ff       	call   e8e <bflush>
+  b->data[b->n++] = c;
+    10a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a7:	8b 00                	mov    (%rax),%eax
+    10a9:	8d 48 01             	lea    0x1(%rax),%ecx
+    10ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    10b0:	89 0a                	mov    %ecx,(%rdx)
+    10b2:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+    10b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    10ba:	48 98                	cltq
+    10bc:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+    10c0:	c9                   	leave
+    10c1:	c3                   	ret
+
+00000000000010c2 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+    10c2:	55                   	push   %rbp
+    10c3:	48 89 e5             	mov    %rsp,%rbp
+    10c6:	48 83 ec 10          	sub    $0x10,%rsp
+    10ca:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    10cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    10d1:	78 4c                	js     111f <bflushtty+0x5d>
+    10d3:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    10d7:	7f 46                	jg     111f <bflushtty+0x5d>
+    10d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10dc:	48 98                	cltq
+    10de:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    10e5:	00 
+    10e6:	48 8d 05 53 2f 00 00 	lea    0x2f53(%rip),%rax        # 4040 <obufs>
+    10ed:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    10f1:	48 85 c0             	test   %rax,%rax
+    10f4:	74 29                	je     111f <bflushtty+0x5d>
+    10f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10f9:	48 98                	cltq
+    10fb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1102:	00 
+    1103:	48 8d 05 36 2f 00 00 	lea    0x2f36(%rip),%rax        # 4040 <obufs>
+    110a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    110e:	8b 40 04             	mov    0x4(%rax),%eax
+    1111:	85 c0                	test   %eax,%eax
+    1113:	74 0a                	je     111f <bflushtty+0x5d>
+    bflush(fd);
+    1115:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1118:	89 c7                	mov    %eax,%edi
+    111a:	e8 6f fd ff ff       	call   e8e <bflush>
+}
+    111f:	90                   	nop
+    1120:	c9                   	leave
+    1121:	c3                   	ret
+
+0000000000001122 <fork>:
+
+int fork(void) {
+    1122:	55                   	push   %rbp
+    1123:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1126:	e8 ec fd ff ff       	call   f17 <bflushall>
+  return _fork();
+    112b:	e8 7b 0a 00 00       	call   1bab <_fork>
+}
+    1130:	5d                   	pop    %rbp
+    1131:	c3                   	ret
+
+0000000000001132 <exit>:
+
+noreturn void exit(void) {
+    1132:	55                   	push   %rbp
+    1133:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+    1136:	e8 dc fd ff ff       	call   f17 <bflushall>
+  _exit();
+    113b:	e8 76 0a 00 00       	call   1bb6 <_exit>
+
+0000000000001140 <exec>:
+}
+
+int exec(char *path, char **argv) {
+    1140:	55                   	push   %rbp
+    1141:	48 89 e5             	mov    %rsp,%rbp
+    1144:	48 83 ec 10          	sub    $0x10,%rsp
+    1148:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    114c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+    1150:	e8 c2 fd ff ff       	call   f17 <bflushall>
+  return _exec(path, argv);
+    1155:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    115d:	48 89 d6             	mov    %rdx,%rsi
+    1160:	48 89 c7             	mov    %rax,%rdi
+    1163:	e8 9b 0a 00 00       	call   1c03 <_exec>
+}
+    1168:	c9                   	leave
+    1169:	c3                   	ret
+
+000000000000116a <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+    116a:	55                   	push   %rbp
+    116b:	48 89 e5             	mov    %rsp,%rbp
+    116e:	48 83 ec 20          	sub    $0x20,%rsp
+    1172:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1176:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    117a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+    117e:	e8 94 fd ff ff       	call   f17 <bflushall>
+  return _spawn(path, argv, fds);
+    1183:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1187:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    118b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    118f:	48 89 ce             	mov    %rcx,%rsi
+    1192:	48 89 c7             	mov    %rax,%rdi
+    1195:	e8 2f 0b 00 00       	call   1cc9 <_spawn>
+}
+    119a:	c9                   	leave
+    119b:	c3                   	ret
+
+000000000000119c <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+    119c:	55                   	push   %rbp
+    119d:	48 89 e5             	mov    %rsp,%rbp
+    11a0:	48 83 ec 10          	sub    $0x10,%rsp
+    11a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    11a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    11ab:	78 69                	js     1216 <close+0x7a>
+    11ad:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+    11b1:	7f 63                	jg     1216 <close+0x7a>
+    11b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11b6:	48 98                	cltq
+    11b8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    11bf:	00 
+    11c0:	48 8d 05 79 2e 00 00 	lea    0x2e79(%rip),%rax        # 4040 <obufs>
+    11c7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    11cb:	48 85 c0             	test   %rax,%rax
+    11ce:	74 46                	je     1216 <close+0x7a>
+    bflush(fd);
+    11d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11d3:	89 c7                	mov    %eax,%edi
+    11d5:	e8 b4 fc ff ff       	call   e8e <bflush>
+    free(obufs[fd]);
+    11da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11dd:	48 98                	cltq
+    11df:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    11e6:	00 
+    11e7:	48 8d 05 52 2e 00 00 	lea    0x2e52(%rip),%rax        # 4040 <obufs>
+    11ee:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    11f2:	48 89 c7             	mov    %rax,%rdi
+    11f5:	e8 90 11 00 00       	call   238a <free>
+    obufs[fd] = 0;
+    11fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11fd:	48 98                	cltq
+    11ff:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1206:	00 
+    1207:	48 8d 05 32 2e 00 00 	lea    0x2e32(%rip),%rax        # 4040 <obufs>
+    120e:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+    1215:	00 
+  }
+  return _close(fd);
+    1216:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1219:	89 c7                	mov    %eax,%edi
+    121b:	e8 cd 09 00 00       	call   1bed <_close>
+}
+    1220:	c9                   	leave
+    1221:	c3                   	ret
+
+0000000000001222 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+    1222:	55                   	push   %rbp
+    1223:	48 89 e5             	mov    %rsp,%rbp
+    1226:	53                   	push   %rbx
+    1227:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    122b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+    122f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1233:	48 8b 36             	mov    (%rsi),%rsi
+    1236:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+    123a:	48 29 f7             	sub    %rsi,%rdi
+    123d:	48 89 f9             	mov    %rdi,%rcx
+    1240:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1245:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1249:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+    124d:	48 89 f0             	mov    %rsi,%rax
+    1250:	ba 00 00 00 00       	mov    $0x0,%edx
+    1255:	48 89 df             	mov    %rbx,%rdi
+    1258:	48 0f af f8          	imul   %rax,%rdi
+    125c:	48 89 d6             	mov    %rdx,%rsi
+    125f:	48 0f af f1          	imul   %rcx,%rsi
+    1263:	48 01 fe             	add    %rdi,%rsi
+    1266:	48 f7 e1             	mul    %rcx
+    1269:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+    126d:	48 89 ca             	mov    %rcx,%rdx
+    1270:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+    1275:	48 c1 ea 20          	shr    $0x20,%rdx
+
+    1279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    127d:	c9                   	leave
+    127e:	c3                   	ret
+
+000000000000127f <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+    127f:	55                   	push   %rbp
+    1280:	48 89 e5             	mov    %rsp,%rbp
+    1283:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1287:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    128a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+    128d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1291:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1294:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1297:	48 89 ce             	mov    %rcx,%rsi
+    129a:	48 89 f7             	mov    %rsi,%rdi
+    129d:	89 d1                	mov    %edx,%ecx
+    129f:	fc                   	cld
+    12a0:	f3 aa                	rep stos %al,%es:(%rdi)
+    12a2:	89 ca                	mov    %ecx,%edx
+    12a4:	48 89 fe             	mov    %rdi,%rsi
+    12a7:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    12ab:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    12ae:	90                   	nop
+    12af:	5d                   	pop    %rbp
+    12b0:	c3                   	ret
+
+00000000000012b1 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+    12b1:	55                   	push   %rbp
+    12b2:	48 89 e5             	mov    %rsp,%rbp
+    12b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    12bd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+    12c1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    12c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    12c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12cd:	48 89 ce             	mov    %rcx,%rsi
+    12d0:	48 89 f7             	mov    %rsi,%rdi
+    12d3:	48 89 d1             	mov    %rdx,%rcx
+    12d6:	fc                   	cld
+    12d7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+    12da:	48 89 ca             	mov    %rcx,%rdx
+    12dd:	48 89 fe             	mov    %rdi,%rsi
+    12e0:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    12e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+    12e8:	90                   	nop
+    12e9:	5d                   	pop    %rbp
+    12ea:	c3                   	ret
+
+00000000000012eb <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+    12eb:	55                   	push   %rbp
+    12ec:	48 89 e5             	mov    %rsp,%rbp
+    12ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    12f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+    12fb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    12ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1307:	48 89 cf             	mov    %rcx,%rdi
+    130a:	48 89 d6             	mov    %rdx,%rsi
+    130d:	48 89 c1             	mov    %rax,%rcx
+    1310:	fc                   	cld
+    1311:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+    1313:	48 89 c8             	mov    %rcx,%rax
+    1316:	48 89 f2             	mov    %rsi,%rdx
+    1319:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    131d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    1321:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1325:	90                   	nop
+    1326:	5d                   	pop    %rbp
+    1327:	c3                   	ret
+
+0000000000001328 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+    1328:	55                   	push   %rbp
+    1329:	48 89 e5             	mov    %rsp,%rbp
+    132c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1330:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+    1334:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+    1338:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    133c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1340:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1344:	48 89 cf             	mov    %rcx,%rdi
+    1347:	48 89 d6             	mov    %rdx,%rsi
+    134a:	48 89 c1             	mov    %rax,%rcx
+    134d:	fc                   	cld
+    134e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    1351:	48 89 c8             	mov    %rcx,%rax
+    1354:	48 89 f2             	mov    %rsi,%rdx
+    1357:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    135b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+    135f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+    1363:	90                   	nop
+    1364:	5d                   	pop    %rbp
+    1365:	c3                   	ret
+
+0000000000001366 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+    1366:	55                   	push   %rbp
+    1367:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    136a:	0f 31                	rdtsc
+    136c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    136f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+    1372:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1375:	48 c1 e0 20          	shl    $0x20,%rax
+    1379:	48 89 c2             	mov    %rax,%rdx
+    137c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    137f:	48 09 d0             	or     %rdx,%rax
+}
+    1382:	5d                   	pop    %rbp
+    1383:	c3                   	ret
+
+0000000000001384 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+    1384:	55                   	push   %rbp
+    1385:	48 89 e5             	mov    %rsp,%rbp
+    1388:	53                   	push   %rbx
+    1389:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+    138c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+    1390:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+    1394:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    1398:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+    139c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+    139f:	0f a2                	cpuid
+    13a1:	89 de                	mov    %ebx,%esi
+    13a3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    13a6:	89 75 f0             	mov    %esi,-0x10(%rbp)
+    13a9:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+    13ac:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+    13af:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+    13b4:	74 09                	je     13bf <cpuid+0x3b>
+    *eaxp = eax;
+    13b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    13ba:	8b 55 f4             	mov    -0xc(%rbp),%edx
+    13bd:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+    13bf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    13c4:	74 09                	je     13cf <cpuid+0x4b>
+    *ebxp = ebx;
+    13c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    13ca:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    13cd:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+    13cf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    13d4:	74 09                	je     13df <cpuid+0x5b>
+    *ecxp = ecx;
+    13d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    13da:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    13dd:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+    13df:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+    13e4:	74 09                	je     13ef <cpuid+0x6b>
+    *edxp = edx;
+    13e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+    13ea:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    13ed:	89 10                	mov    %edx,(%rax)
+}
+    13ef:	90                   	nop
+    13f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    13f4:	c9                   	leave
+    13f5:	c3                   	ret
+
+00000000000013f6 <strcpy>:
+char *strcpy(char *s, char *t) {
+    13f6:	55                   	push   %rbp
+    13f7:	48 89 e5             	mov    %rsp,%rbp
+    13fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1402:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1406:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+    140a:	90                   	nop
+    140b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    140f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1413:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1417:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    141b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    141f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1423:	0f b6 12             	movzbl (%rdx),%edx
+    1426:	88 10                	mov    %dl,(%rax)
+    1428:	0f b6 00             	movzbl (%rax),%eax
+    142b:	84 c0                	test   %al,%al
+    142d:	75 dc                	jne    140b <strcpy+0x15>
+  return os;
+    142f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1433:	5d                   	pop    %rbp
+    1434:	c3                   	ret
+
+0000000000001435 <strcmp>:
+int strcmp(const char *p, const char *q) {
+    1435:	55                   	push   %rbp
+    1436:	48 89 e5             	mov    %rsp,%rbp
+    1439:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    143d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1441:	eb 0a                	jmp    144d <strcmp+0x18>
+    p++, q++;
+    1443:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1448:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    144d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1451:	0f b6 00             	movzbl (%rax),%eax
+    1454:	84 c0                	test   %al,%al
+    1456:	74 12                	je     146a <strcmp+0x35>
+    1458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    145c:	0f b6 10             	movzbl (%rax),%edx
+    145f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1463:	0f b6 00             	movzbl (%rax),%eax
+    1466:	38 c2                	cmp    %al,%dl
+    1468:	74 d9                	je     1443 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    146a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    146e:	0f b6 00             	movzbl (%rax),%eax
+    1471:	0f b6 d0             	movzbl %al,%edx
+    1474:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1478:	0f b6 00             	movzbl (%rax),%eax
+    147b:	0f b6 c0             	movzbl %al,%eax
+    147e:	29 c2                	sub    %eax,%edx
+    1480:	89 d0                	mov    %edx,%eax
+}
+    1482:	5d                   	pop    %rbp
+    1483:	c3                   	ret
+
+0000000000001484 <strlen>:
+uint strlen(char *s) {
+    1484:	55                   	push   %rbp
+    1485:	48 89 e5             	mov    %rsp,%rbp
+    1488:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    148c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1493:	eb 04                	jmp    1499 <strlen+0x15>
+    1495:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1499:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    149c:	48 63 d0             	movslq %eax,%rdx
+    149f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14a3:	48 01 d0             	add    %rdx,%rax
+    14a6:	0f b6 00             	movzbl (%rax),%eax
+    14a9:	84 c0                	test   %al,%al
+    14ab:	75 e8                	jne    1495 <strlen+0x11>
+    ;
+  return n;
+    14ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    14b0:	5d                   	pop    %rbp
+    14b1:	c3                   	ret
+
+00000000000014b2 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    14b2:	55                   	push   %rbp
+    14b3:	48 89 e5             	mov    %rsp,%rbp
+    14b6:	53                   	push   %rbx
+    14b7:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    14bb:	8b 05 73 2b 00 00    	mov    0x2b73(%rip),%eax        # 4034 <erms>
+    14c1:	85 c0                	test   %eax,%eax
+    14c3:	79 53                	jns    1518 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    14c5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    14c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    14cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+    14d4:	ba 00 00 00 00       	mov    $0x0,%edx
+    14d9:	48 89 c6             	mov    %rax,%rsi
+    14dc:	bf 00 00 00 00       	mov    $0x0,%edi
+    14e1:	e8 9e fe ff ff       	call   1384 <cpuid>
+    ebx = 0;
+    14e6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    14ed:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    14f0:	83 f8 06             	cmp    $0x6,%eax
+    14f3:	76 14                	jbe    1509 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    14f5:	b8 07 00 00 00       	mov    $0x7,%eax
+    14fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+    14ff:	0f a2                	cpuid
+    1501:	89 d9                	mov    %ebx,%ecx
+    1503:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    1506:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    1509:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    150c:	c1 e8 09             	shr    $0x9,%eax
+    150f:	83 e0 01             	and    $0x1,%eax
+    1512:	89 05 1c 2b 00 00    	mov    %eax,0x2b1c(%rip)        # 4034 <erms>
+  }
+  return erms;
+    1518:	8b 05 16 2b 00 00    	mov    0x2b16(%rip),%eax        # 4034 <erms>
+}
+    151e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    1522:	c9                   	leave
+    1523:	c3                   	ret
+
+0000000000001524 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    1524:	55                   	push   %rbp
+    1525:	48 89 e5             	mov    %rsp,%rbp
+    1528:	48 83 ec 10          	sub    $0x10,%rsp
+    152c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1530:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1533:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    1536:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    153a:	76 09                	jbe    1545 <memset+0x21>
+    153c:	e8 71 ff ff ff       	call   14b2 <haserms>
+    1541:	85 c0                	test   %eax,%eax
+    1543:	74 16                	je     155b <memset+0x37>
+    stosb(dst, c, n);
+    1545:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1548:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    154b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    154f:	89 ce                	mov    %ecx,%esi
+    1551:	48 89 c7             	mov    %rax,%rdi
+    1554:	e8 26 fd ff ff       	call   127f <stosb>
+    1559:	eb 58                	jmp    15b3 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    155b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    155e:	c1 e8 03             	shr    $0x3,%eax
+    1561:	89 c6                	mov    %eax,%esi
+    1563:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1566:	48 98                	cltq
+    1568:	0f b6 c0             	movzbl %al,%eax
+    156b:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    1572:	01 01 01 
+    1575:	48 0f af c2          	imul   %rdx,%rax
+    1579:	48 89 c1             	mov    %rax,%rcx
+    157c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1580:	48 89 f2             	mov    %rsi,%rdx
+    1583:	48 89 ce             	mov    %rcx,%rsi
+    1586:	48 89 c7             	mov    %rax,%rdi
+    1589:	e8 23 fd ff ff       	call   12b1 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    158e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1591:	83 e0 07             	and    $0x7,%eax
+    1594:	89 c2                	mov    %eax,%edx
+    1596:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1599:	83 e0 f8             	and    $0xfffffff8,%eax
+    159c:	48 89 c1             	mov    %rax,%rcx
+    159f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15a3:	48 01 c1             	add    %rax,%rcx
+    15a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    15a9:	89 c6                	mov    %eax,%esi
+    15ab:	48 89 cf             	mov    %rcx,%rdi
+    15ae:	e8 cc fc ff ff       	call   127f <stosb>
+  }
+  return dst;
+    15b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    15b7:	c9                   	leave
+    15b8:	c3                   	ret
+
+00000000000015b9 <strchr>:
+
+char *strchr(const char *s, char c) {
+    15b9:	55                   	push   %rbp
+    15ba:	48 89 e5             	mov    %rsp,%rbp
+    15bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15c1:	89 f0                	mov    %esi,%eax
+    15c3:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    15c6:	eb 17                	jmp    15df <strchr+0x26>
+    if (*s == c)
+    15c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15cc:	0f b6 00             	movzbl (%rax),%eax
+    15cf:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    15d2:	75 06                	jne    15da <strchr+0x21>
+      return (char *)s;
+    15d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15d8:	eb 15                	jmp    15ef <strchr+0x36>
+  for (; *s; s++)
+    15da:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    15df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e3:	0f b6 00             	movzbl (%rax),%eax
+    15e6:	84 c0                	test   %al,%al
+    15e8:	75 de                	jne    15c8 <strchr+0xf>
+  return 0;
+    15ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    15ef:	5d                   	pop    %rbp
+    15f0:	c3                   	ret
+
+00000000000015f1 <gets>:
+
+char *gets(char *buf, int max) {
+    15f1:	55                   	push   %rbp
+    15f2:	48 89 e5             	mov    %rsp,%rbp
+    15f5:	48 83 ec 20          	sub    $0x20,%rsp
+    15f9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15fd:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    1600:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1607:	eb 48                	jmp    1651 <gets+0x60>
+    cc = read(0, &c, 1);
+    1609:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    160d:	ba 01 00 00 00       	mov    $0x1,%edx
+    1612:	48 89 c6             	mov    %rax,%rsi
+    1615:	bf 00 00 00 00       	mov    $0x0,%edi
+    161a:	e8 b8 05 00 00       	call   1bd7 <read>
+    161f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    1622:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1626:	7e 36                	jle    165e <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1628:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    162b:	8d 50 01             	lea    0x1(%rax),%edx
+    162e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1631:	48 63 d0             	movslq %eax,%rdx
+    1634:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1638:	48 01 c2             	add    %rax,%rdx
+    163b:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    163f:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1641:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1645:	3c 0a                	cmp    $0xa,%al
+    1647:	74 16                	je     165f <gets+0x6e>
+    1649:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    164d:	3c 0d                	cmp    $0xd,%al
+    164f:	74 0e                	je     165f <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1651:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1654:	83 c0 01             	add    $0x1,%eax
+    1657:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    165a:	7f ad                	jg     1609 <gets+0x18>
+    165c:	eb 01                	jmp    165f <gets+0x6e>
+      break;
+    165e:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    165f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1662:	48 63 d0             	movslq %eax,%rdx
+    1665:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1669:	48 01 d0             	add    %rdx,%rax
+    166c:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    166f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1673:	c9                   	leave
+    1674:	c3                   	ret
+
+0000000000001675 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1675:	55                   	push   %rbp
+    1676:	48 89 e5             	mov    %rsp,%rbp
+    1679:	48 83 ec 10          	sub    $0x10,%rsp
+    167d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1681:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    1685:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1689:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168d:	48 89 c6             	mov    %rax,%rsi
+    1690:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1695:	e8 58 07 00 00       	call   1df2 <fstatat>
+}
+    169a:	c9                   	leave
+    169b:	c3                   	ret
+
+000000000000169c <atoi>:
+
+int atoi(const char *s) {
+    169c:	55                   	push   %rbp
+    169d:	48 89 e5             	mov    %rsp,%rbp
+    16a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    16a4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    16ab:	eb 28                	jmp    16d5 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    16ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    16b0:	89 d0                	mov    %edx,%eax
+    16b2:	c1 e0 02             	shl    $0x2,%eax
+    16b5:	01 d0                	add    %edx,%eax
+    16b7:	01 c0                	add    %eax,%eax
+    16b9:	89 c1                	mov    %eax,%ecx
+    16bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16bf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    16c3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    16c7:	0f b6 00             	movzbl (%rax),%eax
+    16ca:	0f be c0             	movsbl %al,%eax
+    16cd:	01 c8                	add    %ecx,%eax
+    16cf:	83 e8 30             	sub    $0x30,%eax
+    16d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    16d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16d9:	0f b6 00             	movzbl (%rax),%eax
+    16dc:	3c 2f                	cmp    $0x2f,%al
+    16de:	7e 0b                	jle    16eb <atoi+0x4f>
+    16e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16e4:	0f b6 00             	movzbl (%rax),%eax
+    16e7:	3c 39                	cmp    $0x39,%al
+    16e9:	7e c2                	jle    16ad <atoi+0x11>
+  return n;
+    16eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    16ee:	5d                   	pop    %rbp
+    16ef:	c3                   	ret
+
+00000000000016f0 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    16f0:	55                   	push   %rbp
+    16f1:	48 89 e5             	mov    %rsp,%rbp
+    16f4:	48 83 ec 28          	sub    $0x28,%rsp
+    16f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1700:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1703:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1707:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    170b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    170f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    1713:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1717:	7f 09                	jg     1722 <memmove+0x32>
+    return vdst;
+    1719:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    171d:	e9 29 01 00 00       	jmp    184b <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    1722:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1726:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    172a:	0f 83 87 00 00 00    	jae    17b7 <memmove+0xc7>
+    1730:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1733:	48 63 d0             	movslq %eax,%rdx
+    1736:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173a:	48 01 d0             	add    %rdx,%rax
+    173d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1741:	73 74                	jae    17b7 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1743:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1746:	48 98                	cltq
+    1748:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    174c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    174f:	48 98                	cltq
+    1751:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1755:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    175d:	48 09 d0             	or     %rdx,%rax
+    1760:	83 e0 07             	and    $0x7,%eax
+    1763:	48 85 c0             	test   %rax,%rax
+    1766:	75 3d                	jne    17a5 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1768:	eb 1c                	jmp    1786 <memmove+0x96>
+        src -= 8;
+    176a:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    176f:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1774:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1778:	48 8b 10             	mov    (%rax),%rdx
+    177b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177f:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1782:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1786:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    178a:	7f de                	jg     176a <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    178c:	eb 17                	jmp    17a5 <memmove+0xb5>
+      *--dst = *--src;
+    178e:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1793:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1798:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    179c:	0f b6 10             	movzbl (%rax),%edx
+    179f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17a3:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    17a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    17a8:	8d 50 ff             	lea    -0x1(%rax),%edx
+    17ab:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    17ae:	85 c0                	test   %eax,%eax
+    17b0:	7f dc                	jg     178e <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    17b2:	e9 90 00 00 00       	jmp    1847 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    17b7:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    17bb:	7e 09                	jle    17c6 <memmove+0xd6>
+    17bd:	e8 f0 fc ff ff       	call   14b2 <haserms>
+    17c2:	85 c0                	test   %eax,%eax
+    17c4:	74 1b                	je     17e1 <memmove+0xf1>
+    movsb(dst, src, n);
+    17c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    17c9:	48 63 d0             	movslq %eax,%rdx
+    17cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    17d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17d4:	48 89 ce             	mov    %rcx,%rsi
+    17d7:	48 89 c7             	mov    %rax,%rdi
+    17da:	e8 0c fb ff ff       	call   12eb <movsb>
+    17df:	eb 66                	jmp    1847 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    17e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    17e4:	8d 50 07             	lea    0x7(%rax),%edx
+    17e7:	85 c0                	test   %eax,%eax
+    17e9:	0f 48 c2             	cmovs  %edx,%eax
+    17ec:	c1 f8 03             	sar    $0x3,%eax
+    17ef:	48 63 d0             	movslq %eax,%rdx
+    17f2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    17f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17fa:	48 89 ce             	mov    %rcx,%rsi
+    17fd:	48 89 c7             	mov    %rax,%rdi
+    1800:	e8 23 fb ff ff       	call   1328 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    1805:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1808:	89 d0                	mov    %edx,%eax
+    180a:	c1 f8 1f             	sar    $0x1f,%eax
+    180d:	c1 e8 1d             	shr    $0x1d,%eax
+    1810:	01 c2                	add    %eax,%edx
+    1812:	83 e2 07             	and    $0x7,%edx
+    1815:	29 c2                	sub    %eax,%edx
+    1817:	89 d0                	mov    %edx,%eax
+    1819:	48 98                	cltq
+    181b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    181e:	83 e2 f8             	and    $0xfffffff8,%edx
+    1821:	48 63 ca             	movslq %edx,%rcx
+    1824:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1828:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    182c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    182f:	83 e2 f8             	and    $0xfffffff8,%edx
+    1832:	48 63 ca             	movslq %edx,%rcx
+    1835:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1839:	48 01 d1             	add    %rdx,%rcx
+    183c:	48 89 c2             	mov    %rax,%rdx
+    183f:	48 89 cf             	mov    %rcx,%rdi
+    1842:	e8 a4 fa ff ff       	call   12eb <movsb>
+  }
+  return vdst;
+    1847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    184b:	c9                   	leave
+    184c:	c3                   	ret
+
+000000000000184d <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    184d:	55                   	push   %rbp
+    184e:	48 89 e5             	mov    %rsp,%rbp
+    1851:	48 83 ec 20          	sub    $0x20,%rsp
+    1855:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1858:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    185c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1863:	00 00 00 
+    1866:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    186a:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    186e:	75 0d                	jne    187d <clock_gettime+0x30>
+    1870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1874:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1878:	48 85 c0             	test   %rax,%rax
+    187b:	75 13                	jne    1890 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    187d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1881:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1884:	48 89 d6             	mov    %rdx,%rsi
+    1887:	89 c7                	mov    %eax,%edi
+    1889:	e8 e0 04 00 00       	call   1d6e <_clock_gettime>
+    188e:	eb 7d                	jmp    190d <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1890:	e8 d1 fa ff ff       	call   1366 <rdtsc>
+    1895:	48 89 c2             	mov    %rax,%rdx
+    1898:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    189c:	48 89 d6             	mov    %rdx,%rsi
+    189f:	48 89 c7             	mov    %rax,%rdi
+    18a2:	e8 7b f9 ff ff       	call   1222 <clockns>
+    18a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    18ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18af:	48 c1 e8 09          	shr    $0x9,%rax
+    18b3:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    18ba:	b8 44 00 
+    18bd:	48 f7 e2             	mul    %rdx
+    18c0:	48 89 d0             	mov    %rdx,%rax
+    18c3:	48 c1 e8 0b          	shr    $0xb,%rax
+    18c7:	48 89 c2             	mov    %rax,%rdx
+    18ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18ce:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    18d1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    18d5:	48 89 c8             	mov    %rcx,%rax
+    18d8:	48 c1 e8 09          	shr    $0x9,%rax
+    18dc:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    18e3:	b8 44 00 
+    18e6:	48 f7 e2             	mul    %rdx
+    18e9:	48 89 d0             	mov    %rdx,%rax
+    18ec:	48 c1 e8 0b          	shr    $0xb,%rax
+    18f0:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    18f7:	48 89 c8             	mov    %rcx,%rax
+    18fa:	48 29 d0             	sub    %rdx,%rax
+    18fd:	48 89 c2             	mov    %rax,%rdx
+    1900:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1904:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    1908:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    190d:	c9                   	leave
+    190e:	c3                   	ret
+
+000000000000190f <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    190f:	55                   	push   %rbp
+    1910:	48 89 e5             	mov    %rsp,%rbp
+    1913:	48 83 ec 10          	sub    $0x10,%rsp
+    1917:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    191b:	eb 11                	jmp    192e <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    191d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1921:	be 02 00 00 00       	mov    $0x2,%esi
+    1926:	48 89 c7             	mov    %rax,%rdi
+    1929:	e8 6c 04 00 00       	call   1d9a <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    192e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1932:	b8 02 00 00 00       	mov    $0x2,%eax
+    1937:	87 02                	xchg   %eax,(%rdx)
+    1939:	85 c0                	test   %eax,%eax
+    193b:	75 e0                	jne    191d <mutex_wait+0xe>
+}
+    193d:	90                   	nop
+    193e:	90                   	nop
+    193f:	c9                   	leave
+    1940:	c3                   	ret
+
+0000000000001941 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1941:	55                   	push   %rbp
+    1942:	48 89 e5             	mov    %rsp,%rbp
+    1945:	48 83 ec 20          	sub    $0x20,%rsp
+    1949:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    194d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1954:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1958:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    195c:	8b 02                	mov    (%rdx),%eax
+    195e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1963:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1967:	89 c1                	mov    %eax,%ecx
+    1969:	0f 94 c0             	sete   %al
+    196c:	84 c0                	test   %al,%al
+    196e:	75 02                	jne    1972 <mutex_lock+0x31>
+    1970:	89 0a                	mov    %ecx,(%rdx)
+    1972:	83 f0 01             	xor    $0x1,%eax
+    1975:	84 c0                	test   %al,%al
+    1977:	74 0c                	je     1985 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197d:	48 89 c7             	mov    %rax,%rdi
+    1980:	e8 8a ff ff ff       	call   190f <mutex_wait>
+}
+    1985:	90                   	nop
+    1986:	c9                   	leave
+    1987:	c3                   	ret
+
+0000000000001988 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1988:	55                   	push   %rbp
+    1989:	48 89 e5             	mov    %rsp,%rbp
+    198c:	48 83 ec 10          	sub    $0x10,%rsp
+    1990:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1994:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1998:	ba 00 00 00 00       	mov    $0x0,%edx
+    199d:	87 10                	xchg   %edx,(%rax)
+    199f:	83 fa 02             	cmp    $0x2,%edx
+    19a2:	75 11                	jne    19b5 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    19a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a8:	be 01 00 00 00       	mov    $0x1,%esi
+    19ad:	48 89 c7             	mov    %rax,%rdi
+    19b0:	e8 f0 03 00 00       	call   1da5 <futex_wake>
+}
+    19b5:	90                   	nop
+    19b6:	c9                   	leave
+    19b7:	c3                   	ret
+
+00000000000019b8 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    19b8:	55                   	push   %rbp
+    19b9:	48 89 e5             	mov    %rsp,%rbp
+    19bc:	48 83 ec 20          	sub    $0x20,%rsp
+    19c0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19c4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    19c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19cc:	48 83 c0 04          	add    $0x4,%rax
+    19d0:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    19d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19d8:	8b 00                	mov    (%rax),%eax
+    19da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    19dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    19e1:	48 89 c7             	mov    %rax,%rdi
+    19e4:	e8 9f ff ff ff       	call   1988 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    19e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    19f0:	89 d6                	mov    %edx,%esi
+    19f2:	48 89 c7             	mov    %rax,%rdi
+    19f5:	e8 a0 03 00 00       	call   1d9a <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    19fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19fe:	48 83 c0 04          	add    $0x4,%rax
+    1a02:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    1a06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1a0a:	48 89 c7             	mov    %rax,%rdi
+    1a0d:	e8 fd fe ff ff       	call   190f <mutex_wait>
+}
+    1a12:	90                   	nop
+    1a13:	c9                   	leave
+    1a14:	c3                   	ret
+
+0000000000001a15 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    1a15:	55                   	push   %rbp
+    1a16:	48 89 e5             	mov    %rsp,%rbp
+    1a19:	48 83 ec 10          	sub    $0x10,%rsp
+    1a1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1a21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a25:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1a29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a2d:	48 83 c0 04          	add    $0x4,%rax
+    1a31:	8b 00                	mov    (%rax),%eax
+    1a33:	85 c0                	test   %eax,%eax
+    1a35:	7e 11                	jle    1a48 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    1a37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a3b:	be 01 00 00 00       	mov    $0x1,%esi
+    1a40:	48 89 c7             	mov    %rax,%rdi
+    1a43:	e8 5d 03 00 00       	call   1da5 <futex_wake>
+}
+    1a48:	90                   	nop
+    1a49:	c9                   	leave
+    1a4a:	c3                   	ret
+
+0000000000001a4b <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1a4b:	55                   	push   %rbp
+    1a4c:	48 89 e5             	mov    %rsp,%rbp
+    1a4f:	48 83 ec 10          	sub    $0x10,%rsp
+    1a53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1a57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a5b:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1a5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a63:	48 83 c0 04          	add    $0x4,%rax
+    1a67:	8b 00                	mov    (%rax),%eax
+    1a69:	85 c0                	test   %eax,%eax
+    1a6b:	7e 11                	jle    1a7e <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1a6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a71:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1a76:	48 89 c7             	mov    %rax,%rdi
+    1a79:	e8 27 03 00 00       	call   1da5 <futex_wake>
+}
+    1a7e:	90                   	nop
+    1a7f:	c9                   	leave
+    1a80:	c3                   	ret
+
+0000000000001a81 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1a81:	55                   	push   %rbp
+    1a82:	48 89 e5             	mov    %rsp,%rbp
+    1a85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a89:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1a8c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1a90:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1a94:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1a98:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1a9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aa0:	8b 40 04             	mov    0x4(%rax),%eax
+    1aa3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1aaa:	8b 00                	mov    (%rax),%eax
+    1aac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1aaf:	29 c2                	sub    %eax,%edx
+    1ab1:	83 fa 1f             	cmp    $0x1f,%edx
+    1ab4:	76 07                	jbe    1abd <ring_push+0x3c>
+    return -1;
+    1ab6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1abb:	eb 7e                	jmp    1b3b <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1abd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ac0:	83 e0 1f             	and    $0x1f,%eax
+    1ac3:	89 c2                	mov    %eax,%edx
+    1ac5:	48 89 d0             	mov    %rdx,%rax
+    1ac8:	48 01 c0             	add    %rax,%rax
+    1acb:	48 01 d0             	add    %rdx,%rax
+    1ace:	48 c1 e0 04          	shl    $0x4,%rax
+    1ad2:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1ad6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ada:	48 01 d0             	add    %rdx,%rax
+    1add:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    1ae1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    1ae8:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    1aea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1aee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1af2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    1af6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1afa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1afe:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    1b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b06:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    1b0a:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    1b0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    1b16:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    1b1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b1e:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    1b22:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    1b26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b29:	8d 50 01             	lea    0x1(%rax),%edx
+    1b2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b30:	48 83 c0 04          	add    $0x4,%rax
+    1b34:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1b36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1b3b:	5d                   	pop    %rbp
+    1b3c:	c3                   	ret
+
+0000000000001b3d <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1b3d:	55                   	push   %rbp
+    1b3e:	48 89 e5             	mov    %rsp,%rbp
+    1b41:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b45:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1b49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b4d:	8b 40 08             	mov    0x8(%rax),%eax
+    1b50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1b53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b57:	48 83 c0 0c          	add    $0xc,%rax
+    1b5b:	8b 00                	mov    (%rax),%eax
+    1b5d:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1b60:	75 07                	jne    1b69 <ring_pop+0x2c>
+    return -1;
+    1b62:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1b67:	eb 40                	jmp    1ba9 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1b69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b6c:	83 e0 1f             	and    $0x1f,%eax
+    1b6f:	89 c2                	mov    %eax,%edx
+    1b71:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1b75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b79:	89 d2                	mov    %edx,%edx
+    1b7b:	48 83 c2 61          	add    $0x61,%rdx
+    1b7f:	48 c1 e2 04          	shl    $0x4,%rdx
+    1b83:	48 01 d0             	add    %rdx,%rax
+    1b86:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1b8a:	48 8b 00             	mov    (%rax),%rax
+    1b8d:	48 89 01             	mov    %rax,(%rcx)
+    1b90:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1b94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b97:	8d 50 01             	lea    0x1(%rax),%edx
+    1b9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b9e:	48 83 c0 08          	add    $0x8,%rax
+    1ba2:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1ba9:	5d                   	pop    %rbp
+    1baa:	c3                   	ret
+
+0000000000001bab <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1bab:	b8 01 00 00 00       	mov    $0x1,%eax
+    1bb0:	49 89 ca             	mov    %rcx,%r10
+    1bb3:	0f 05                	syscall
+    1bb5:	c3                   	ret
+
+0000000000001bb6 <_exit>:
+SYSCALL_(exit)
+    1bb6:	b8 02 00 00 00       	mov    $0x2,%eax
+    1bbb:	49 89 ca             	mov    %rcx,%r10
+    1bbe:	0f 05                	syscall
+    1bc0:	c3                   	ret
+
+0000000000001bc1 <wait>:
+SYSCALL(wait)
+    1bc1:	b8 03 00 00 00       	mov    $0x3,%eax
+    1bc6:	49 89 ca             	mov    %rcx,%r10
+    1bc9:	0f 05                	syscall
+    1bcb:	c3                   	ret
+
+0000000000001bcc <pipe>:
+SYSCALL(pipe)
+    1bcc:	b8 04 00 00 00       	mov    $0x4,%eax
+    1bd1:	49 89 ca             	mov    %rcx,%r10
+    1bd4:	0f 05                	syscall
+    1bd6:	c3                   	ret
+
+0000000000001bd7 <read>:
+SYSCALL(read)
+    1bd7:	b8 05 00 00 00       	mov    $0x5,%eax
+    1bdc:	49 89 ca             	mov    %rcx,%r10
+    1bdf:	0f 05                	syscall
+    1be1:	c3                   	ret
+
+0000000000001be2 <write>:
+SYSCALL(write)
+    1be2:	b8 10 00 00 00       	mov    $0x10,%eax
+    1be7:	49 89 ca             	mov    %rcx,%r10
+    1bea:	0f 05                	syscall
+    1bec:	c3                   	ret
+
+0000000000001bed <_close>:
+SYSCALL_(close)
+    1bed:	b8 15 00 00 00       	mov    $0x15,%eax
+    1bf2:	49 89 ca             	mov    %rcx,%r10
+    1bf5:	0f 05                	syscall
+    1bf7:	c3                   	ret
+
+0000000000001bf8 <kill>:
+SYSCALL(kill)
+    1bf8:	b8 06 00 00 00       	mov    $0x6,%eax
+    1bfd:	49 89 ca             	mov    %rcx,%r10
+    1c00:	0f 05                	syscall
+    1c02:	c3                   	ret
+
+0000000000001c03 <_exec>:
+SYSCALL_(exec)
+    1c03:	b8 07 00 00 00       	mov    $0x7,%eax
+    1c08:	49 89 ca             	mov    %rcx,%r10
+    1c0b:	0f 05                	syscall
+    1c0d:	c3                   	ret
+
+0000000000001c0e <open>:
+SYSCALL(open)
+    1c0e:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1c13:	49 89 ca             	mov    %rcx,%r10
+    1c16:	0f 05                	syscall
+    1c18:	c3                   	ret
+
+0000000000001c19 <mknod>:
+SYSCALL(mknod)
+    1c19:	b8 11 00 00 00       	mov    $0x11,%eax
+    1c1e:	49 89 ca             	mov    %rcx,%r10
+    1c21:	0f 05                	syscall
+    1c23:	c3                   	ret
+
+0000000000001c24 <unlink>:
+SYSCALL(unlink)
+    1c24:	b8 12 00 00 00       	mov    $0x12,%eax
+    1c29:	49 89 ca             	mov    %rcx,%r10
+    1c2c:	0f 05                	syscall
+    1c2e:	c3                   	ret
+
+0000000000001c2f <fstat>:
+SYSCALL(fstat)
+    1c2f:	b8 08 00 00 00       	mov    $0x8,%eax
+    1c34:	49 89 ca             	mov    %rcx,%r10
+    1c37:	0f 05                	syscall
+    1c39:	c3                   	ret
+
+0000000000001c3a <link>:
+SYSCALL(link)
+    1c3a:	b8 13 00 00 00       	mov    $0x13,%eax
+    1c3f:	49 89 ca             	mov    %rcx,%r10
+    1c42:	0f 05                	syscall
+    1c44:	c3                   	ret
+
+0000000000001c45 <mkdir>:
+SYSCALL(mkdir)
+    1c45:	b8 14 00 00 00       	mov    $0x14,%eax
+    1c4a:	49 89 ca             	mov    %rcx,%r10
+    1c4d:	0f 05                	syscall
+    1c4f:	c3                   	ret
+
+0000000000001c50 <chdir>:
+SYSCALL(chdir)
+    1c50:	b8 09 00 00 00       	mov    $0x9,%eax
+    1c55:	49 89 ca             	mov    %rcx,%r10
+    1c58:	0f 05                	syscall
+    1c5a:	c3                   	ret
+
+0000000000001c5b <dup>:
+SYSCALL(dup)
+    1c5b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1c60:	49 89 ca             	mov    %rcx,%r10
+    1c63:	0f 05                	syscall
+    1c65:	c3                   	ret
+
+0000000000001c66 <getpid>:
+SYSCALL(getpid)
+    1c66:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1c6b:	49 89 ca             	mov    %rcx,%r10
+    1c6e:	0f 05                	syscall
+    1c70:	c3                   	ret
+
+0000000000001c71 <sbrk>:
+SYSCALL(sbrk)
+    1c71:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1c76:	49 89 ca             	mov    %rcx,%r10
+    1c79:	0f 05                	syscall
+    1c7b:	c3                   	ret
+
+0000000000001c7c <sleep>:
+SYSCALL(sleep)
+    1c7c:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1c81:	49 89 ca             	mov    %rcx,%r10
+    1c84:	0f 05                	syscall
+    1c86:	c3                   	ret
+
+0000000000001c87 <uptime>:
+SYSCALL(uptime)
+    1c87:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1c8c:	49 89 ca             	mov    %rcx,%r10
+    1c8f:	0f 05                	syscall
+    1c91:	c3                   	ret
+
+0000000000001c92 <sysinfo>:
+SYSCALL(sysinfo)
+    1c92:	b8 16 00 00 00       	mov    $0x16,%eax
+    1c97:	49 89 ca             	mov    %rcx,%r10
+    1c9a:	0f 05                	syscall
+    1c9c:	c3                   	ret
+
+0000000000001c9d <crashn>:
+SYSCALL(crashn)
+    1c9d:	b8 17 00 00 00       	mov    $0x17,%eax
+    1ca2:	49 89 ca             	mov    %rcx,%r10
+    1ca5:	0f 05                	syscall
+    1ca7:	c3                   	ret
+
+0000000000001ca8 <mmap>:
+SYSCALL(mmap)
+    1ca8:	b8 18 00 00 00       	mov    $0x18,%eax
+    1cad:	49 89 ca             	mov    %rcx,%r10
+    1cb0:	0f 05                	syscall
+    1cb2:	c3                   	ret
+
+0000000000001cb3 <munmap>:
+SYSCALL(munmap)
+    1cb3:	b8 19 00 00 00       	mov    $0x19,%eax
+    1cb8:	49 89 ca             	mov    %rcx,%r10
+    1cbb:	0f 05                	syscall
+    1cbd:	c3                   	ret
+
+0000000000001cbe <nice>:
+SYSCALL(nice)
+    1cbe:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1cc3:	49 89 ca             	mov    %rcx,%r10
+    1cc6:	0f 05                	syscall
+    1cc8:	c3                   	ret
+
+0000000000001cc9 <_spawn>:
+SYSCALL_(spawn)
+    1cc9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1cce:	49 89 ca             	mov    %rcx,%r10
+    1cd1:	0f 05                	syscall
+    1cd3:	c3                   	ret
+
+0000000000001cd4 <pread>:
+SYSCALL(pread)
+    1cd4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1cd9:	49 89 ca             	mov    %rcx,%r10
+    1cdc:	0f 05                	syscall
+    1cde:	c3                   	ret
+
+0000000000001cdf <pwrite>:
+SYSCALL(pwrite)
+    1cdf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1ce4:	49 89 ca             	mov    %rcx,%r10
+    1ce7:	0f 05                	syscall
+    1ce9:	c3                   	ret
+
+0000000000001cea <readv>:
+SYSCALL(readv)
+    1cea:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1cef:	49 89 ca             	mov    %rcx,%r10
+    1cf2:	0f 05                	syscall
+    1cf4:	c3                   	ret
+
+0000000000001cf5 <writev>:
+SYSCALL(writev)
+    1cf5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1cfa:	49 89 ca             	mov    %rcx,%r10
+    1cfd:	0f 05                	syscall
+    1cff:	c3                   	ret
+
+0000000000001d00 <sendfile>:
+SYSCALL(sendfile)
+    1d00:	b8 20 00 00 00       	mov    $0x20,%eax
+    1d05:	49 89 ca             	mov    %rcx,%r10
+    1d08:	0f 05                	syscall
+    1d0a:	c3                   	ret
+
+0000000000001d0b <splice>:
+SYSCALL(splice)
+    1d0b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1d10:	49 89 ca             	mov    %rcx,%r10
+    1d13:	0f 05                	syscall
+    1d15:	c3                   	ret
+
+0000000000001d16 <poll>:
+SYSCALL(poll)
+    1d16:	b8 22 00 00 00       	mov    $0x22,%eax
+    1d1b:	49 89 ca             	mov    %rcx,%r10
+    1d1e:	0f 05                	syscall
+    1d20:	c3                   	ret
+
+0000000000001d21 <fsync>:
+SYSCALL(fsync)
+    1d21:	b8 23 00 00 00       	mov    $0x23,%eax
+    1d26:	49 89 ca             	mov    %rcx,%r10
+    1d29:	0f 05                	syscall
+    1d2b:	c3                   	ret
+
+0000000000001d2c <fdatasync>:
+SYSCALL(fdatasync)
+    1d2c:	b8 24 00 00 00       	mov    $0x24,%eax
+    1d31:	49 89 ca             	mov    %rcx,%r10
+    1d34:	0f 05                	syscall
+    1d36:	c3                   	ret
+
+0000000000001d37 <lockstat>:
+SYSCALL(lockstat)
+    1d37:	b8 25 00 00 00       	mov    $0x25,%eax
+    1d3c:	49 89 ca             	mov    %rcx,%r10
+    1d3f:	0f 05                	syscall
+    1d41:	c3                   	ret
+
+0000000000001d42 <syscallstat>:
+SYSCALL(syscallstat)
+    1d42:	b8 26 00 00 00       	mov    $0x26,%eax
+    1d47:	49 89 ca             	mov    %rcx,%r10
+    1d4a:	0f 05                	syscall
+    1d4c:	c3                   	ret
+
+0000000000001d4d <trace>:
+SYSCALL(trace)
+    1d4d:	b8 27 00 00 00       	mov    $0x27,%eax
+    1d52:	49 89 ca             	mov    %rcx,%r10
+    1d55:	0f 05                	syscall
+    1d57:	c3                   	ret
+
+0000000000001d58 <profile>:
+SYSCALL(profile)
+    1d58:	b8 28 00 00 00       	mov    $0x28,%eax
+    1d5d:	49 89 ca             	mov    %rcx,%r10
+    1d60:	0f 05                	syscall
+    1d62:	c3                   	ret
+
+0000000000001d63 <cycles>:
+SYSCALL(cycles)
+    1d63:	b8 29 00 00 00       	mov    $0x29,%eax
+    1d68:	49 89 ca             	mov    %rcx,%r10
+    1d6b:	0f 05                	syscall
+    1d6d:	c3                   	ret
+
+0000000000001d6e <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1d6e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1d73:	49 89 ca             	mov    %rcx,%r10
+    1d76:	0f 05                	syscall
+    1d78:	c3                   	ret
+
+0000000000001d79 <consmode>:
+SYSCALL(consmode)
+    1d79:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1d7e:	49 89 ca             	mov    %rcx,%r10
+    1d81:	0f 05                	syscall
+    1d83:	c3                   	ret
+
+0000000000001d84 <clone>:
+SYSCALL(clone)
+    1d84:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1d89:	49 89 ca             	mov    %rcx,%r10
+    1d8c:	0f 05                	syscall
+    1d8e:	c3                   	ret
+
+0000000000001d8f <join>:
+SYSCALL(join)
+    1d8f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1d94:	49 89 ca             	mov    %rcx,%r10
+    1d97:	0f 05                	syscall
+    1d99:	c3                   	ret
+
+0000000000001d9a <futex_wait>:
+SYSCALL(futex_wait)
+    1d9a:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1d9f:	49 89 ca             	mov    %rcx,%r10
+    1da2:	0f 05                	syscall
+    1da4:	c3                   	ret
+
+0000000000001da5 <futex_wake>:
+SYSCALL(futex_wake)
+    1da5:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1daa:	49 89 ca             	mov    %rcx,%r10
+    1dad:	0f 05                	syscall
+    1daf:	c3                   	ret
+
+0000000000001db0 <shmget>:
+SYSCALL(shmget)
+    1db0:	b8 30 00 00 00       	mov    $0x30,%eax
+    1db5:	49 89 ca             	mov    %rcx,%r10
+    1db8:	0f 05                	syscall
+    1dba:	c3                   	ret
+
+0000000000001dbb <shmat>:
+SYSCALL(shmat)
+    1dbb:	b8 31 00 00 00       	mov    $0x31,%eax
+    1dc0:	49 89 ca             	mov    %rcx,%r10
+    1dc3:	0f 05                	syscall
+    1dc5:	c3                   	ret
+
+0000000000001dc6 <shmdt>:
+SYSCALL(shmdt)
+    1dc6:	b8 32 00 00 00       	mov    $0x32,%eax
+    1dcb:	49 89 ca             	mov    %rcx,%r10
+    1dce:	0f 05                	syscall
+    1dd0:	c3                   	ret
+
+0000000000001dd1 <ring_setup>:
+SYSCALL(ring_setup)
+    1dd1:	b8 33 00 00 00       	mov    $0x33,%eax
+    1dd6:	49 89 ca             	mov    %rcx,%r10
+    1dd9:	0f 05                	syscall
+    1ddb:	c3                   	ret
+
+0000000000001ddc <ring_enter>:
+SYSCALL(ring_enter)
+    1ddc:	b8 34 00 00 00       	mov    $0x34,%eax
+    1de1:	49 89 ca             	mov    %rcx,%r10
+    1de4:	0f 05                	syscall
+    1de6:	c3                   	ret
+
+0000000000001de7 <getdents>:
+SYSCALL(getdents)
+    1de7:	b8 35 00 00 00       	mov    $0x35,%eax
+    1dec:	49 89 ca             	mov    %rcx,%r10
+    1def:	0f 05                	syscall
+    1df1:	c3                   	ret
+
+0000000000001df2 <fstatat>:
+SYSCALL(fstatat)
+    1df2:	b8 36 00 00 00       	mov    $0x36,%eax
+    1df7:	49 89 ca             	mov    %rcx,%r10
+    1dfa:	0f 05                	syscall
+    1dfc:	c3                   	ret
+
+0000000000001dfd <clone_file>:
+SYSCALL(clone_file)
+    1dfd:	b8 37 00 00 00       	mov    $0x37,%eax
+    1e02:	49 89 ca             	mov    %rcx,%r10
+    1e05:	0f 05                	syscall
+    1e07:	c3                   	ret
+
+0000000000001e08 <fpunch>:
+SYSCALL(fpunch)
+    1e08:	b8 38 00 00 00       	mov    $0x38,%eax
+    1e0d:	49 89 ca             	mov    %rcx,%r10
+    1e10:	0f 05                	syscall
+    1e12:	c3                   	ret
+
+0000000000001e13 <defrag>:
+SYSCALL(defrag)
+    1e13:	b8 39 00 00 00       	mov    $0x39,%eax
+    1e18:	49 89 ca             	mov    %rcx,%r10
+    1e1b:	0f 05                	syscall
+    1e1d:	c3                   	ret
+
+0000000000001e1e <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    1e1e:	55                   	push   %rbp
+    1e1f:	48 89 e5             	mov    %rsp,%rbp
+    1e22:	48 83 ec 20          	sub    $0x20,%rsp
+    1e26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1e2a:	bf 00 00 00 00       	mov    $0x0,%edi
+    1e2f:	e8 3d fe ff ff       	call   1c71 <sbrk>
+    1e34:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1e38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e3c:	48 f7 d8             	neg    %rax
+    1e3f:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1e44:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1e48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1e4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e50:	48 01 c2             	add    %rax,%rdx
+    1e53:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1e58:	48 39 c2             	cmp    %rax,%rdx
+    1e5b:	73 1e                	jae    1e7b <morecore+0x5d>
+    1e5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e61:	89 c2                	mov    %eax,%edx
+    1e63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e67:	01 d0                	add    %edx,%eax
+    1e69:	89 c7                	mov    %eax,%edi
+    1e6b:	e8 01 fe ff ff       	call   1c71 <sbrk>
+    1e70:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1e74:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1e79:	75 07                	jne    1e82 <morecore+0x64>
+    return 0;
+    1e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e80:	eb 27                	jmp    1ea9 <morecore+0x8b>
+  stats.heap += n + pad;
+    1e82:	48 8b 05 e7 22 00 00 	mov    0x22e7(%rip),%rax        # 4170 <stats+0x50>
+    1e89:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1e8d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e91:	48 01 ca             	add    %rcx,%rdx
+    1e94:	48 01 d0             	add    %rdx,%rax
+    1e97:	48 89 05 d2 22 00 00 	mov    %rax,0x22d2(%rip)        # 4170 <stats+0x50>
+  return p + pad;
+    1e9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1ea2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ea6:	48 01 d0             	add    %rdx,%rax
+}
+    1ea9:	c9                   	leave
+    1eaa:	c3                   	ret
+
+0000000000001eab <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1eab:	55                   	push   %rbp
+    1eac:	48 89 e5             	mov    %rsp,%rbp
+    1eaf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1eb3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1eb7:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1ebe:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1ebf:	48 8d 05 3a 22 00 00 	lea    0x223a(%rip),%rax        # 4100 <runs>
+    1ec6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1eca:	eb 1a                	jmp    1ee6 <pagefree+0x3b>
+    prev = *rp;
+    1ecc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ed0:	48 8b 00             	mov    (%rax),%rax
+    1ed3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1ed7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1edb:	48 8b 00             	mov    (%rax),%rax
+    1ede:	48 83 c0 08          	add    $0x8,%rax
+    1ee2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ee6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eea:	48 8b 00             	mov    (%rax),%rax
+    1eed:	48 85 c0             	test   %rax,%rax
+    1ef0:	74 0d                	je     1eff <pagefree+0x54>
+    1ef2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ef6:	48 8b 00             	mov    (%rax),%rax
+    1ef9:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1efd:	72 cd                	jb     1ecc <pagefree+0x21>
+  r = (struct run *)p;
+    1eff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1f03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1f07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f0b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1f0f:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1f12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f16:	48 8b 10             	mov    (%rax),%rdx
+    1f19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f1d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1f21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f25:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f29:	48 85 c0             	test   %rax,%rax
+    1f2c:	74 48                	je     1f76 <pagefree+0xcb>
+    1f2e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1f32:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1f36:	48 01 c2             	add    %rax,%rdx
+    1f39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f41:	48 39 c2             	cmp    %rax,%rdx
+    1f44:	75 30                	jne    1f76 <pagefree+0xcb>
+    r->size += r->next->size;
+    1f46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f4a:	48 8b 10             	mov    (%rax),%rdx
+    1f4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f51:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f55:	48 8b 00             	mov    (%rax),%rax
+    1f58:	48 01 c2             	add    %rax,%rdx
+    1f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f5f:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1f62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f66:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f6a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1f6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f72:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1f76:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1f7b:	74 46                	je     1fc3 <pagefree+0x118>
+    1f7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f81:	48 8b 10             	mov    (%rax),%rdx
+    1f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f88:	48 01 d0             	add    %rdx,%rax
+    1f8b:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1f8f:	75 32                	jne    1fc3 <pagefree+0x118>
+    prev->size += r->size;
+    1f91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f95:	48 8b 10             	mov    (%rax),%rdx
+    1f98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f9c:	48 8b 00             	mov    (%rax),%rax
+    1f9f:	48 01 c2             	add    %rax,%rdx
+    1fa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fa6:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1fa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1fad:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1fb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fb5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1fb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fbd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1fc1:	eb 0c                	jmp    1fcf <pagefree+0x124>
+  } else {
+    *rp = r;
+    1fc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fc7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1fcb:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1fce:	90                   	nop
+    1fcf:	90                   	nop
+    1fd0:	5d                   	pop    %rbp
+    1fd1:	c3                   	ret
+
+0000000000001fd2 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1fd2:	55                   	push   %rbp
+    1fd3:	48 89 e5             	mov    %rsp,%rbp
+    1fd6:	48 83 ec 40          	sub    $0x40,%rsp
+    1fda:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1fde:	48 8d 05 1b 21 00 00 	lea    0x211b(%rip),%rax        # 4100 <runs>
+    1fe5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1fe9:	eb 66                	jmp    2051 <pagealloc+0x7f>
+    if (r->size == n) {
+    1feb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fef:	48 8b 00             	mov    (%rax),%rax
+    1ff2:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1ff6:	75 18                	jne    2010 <pagealloc+0x3e>
+      *rp = r->next;
+    1ff8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ffc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    2000:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2004:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    2007:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    200b:	e9 ca 00 00 00       	jmp    20da <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    2010:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2014:	48 8b 00             	mov    (%rax),%rax
+    2017:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    201b:	73 28                	jae    2045 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    201d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2021:	48 8b 00             	mov    (%rax),%rax
+    2024:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    2028:	48 89 c2             	mov    %rax,%rdx
+    202b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    202f:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    2032:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2036:	48 8b 10             	mov    (%rax),%rdx
+    2039:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    203d:	48 01 d0             	add    %rdx,%rax
+    2040:	e9 95 00 00 00       	jmp    20da <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    2045:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2049:	48 83 c0 08          	add    $0x8,%rax
+    204d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2051:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2055:	48 8b 00             	mov    (%rax),%rax
+    2058:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    205c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2061:	75 88                	jne    1feb <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    2063:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    2067:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    206b:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    2072:	00 
+    2073:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    2077:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    207b:	48 39 c2             	cmp    %rax,%rdx
+    207e:	48 0f 43 c2          	cmovae %rdx,%rax
+    2082:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    2086:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    208a:	48 89 c7             	mov    %rax,%rdi
+    208d:	e8 8c fd ff ff       	call   1e1e <morecore>
+    2092:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    2096:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    209b:	75 07                	jne    20a4 <pagealloc+0xd2>
+    return 0;
+    209d:	b8 00 00 00 00       	mov    $0x0,%eax
+    20a2:	eb 36                	jmp    20da <pagealloc+0x108>
+  if (m > n)
+    20a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20a8:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    20ac:	73 1a                	jae    20c8 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    20ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20b2:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    20b6:	48 89 c2             	mov    %rax,%rdx
+    20b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20bd:	48 89 d6             	mov    %rdx,%rsi
+    20c0:	48 89 c7             	mov    %rax,%rdi
+    20c3:	e8 e3 fd ff ff       	call   1eab <pagefree>
+  return p + m - n;
+    20c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    20cc:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    20d0:	48 89 c2             	mov    %rax,%rdx
+    20d3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    20d7:	48 01 d0             	add    %rdx,%rax
+}
+    20da:	c9                   	leave
+    20db:	c3                   	ret
+
+00000000000020dc <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    20dc:	55                   	push   %rbp
+    20dd:	48 89 e5             	mov    %rsp,%rbp
+    20e0:	48 83 ec 30          	sub    $0x30,%rsp
+    20e4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    20e7:	bf 00 10 00 00       	mov    $0x1000,%edi
+    20ec:	e8 e1 fe ff ff       	call   1fd2 <pagealloc>
+    20f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    20f5:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    20fa:	75 0a                	jne    2106 <refill+0x2a>
+    return -1;
+    20fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2101:	e9 da 00 00 00       	jmp    21e0 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    2106:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    210d:	00 
+    210e:	e9 ba 00 00 00       	jmp    21cd <refill+0xf1>
+    b = (struct block *)(p + off);
+    2113:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2117:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    211b:	48 01 d0             	add    %rdx,%rax
+    211e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    2122:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2125:	ba 20 00 00 00       	mov    $0x20,%edx
+    212a:	89 c1                	mov    %eax,%ecx
+    212c:	48 d3 e2             	shl    %cl,%rdx
+    212f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2133:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    2136:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2139:	48 63 d0             	movslq %eax,%rdx
+    213c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2140:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    2144:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2147:	48 98                	cltq
+    2149:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2150:	00 
+    2151:	48 8d 05 68 1f 00 00 	lea    0x1f68(%rip),%rax        # 40c0 <freelist>
+    2158:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    215c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2160:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    2164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2167:	48 98                	cltq
+    2169:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    2170:	00 
+    2171:	48 8d 15 48 1f 00 00 	lea    0x1f48(%rip),%rdx        # 40c0 <freelist>
+    2178:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    217c:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    2180:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2183:	48 98                	cltq
+    2185:	48 83 c0 08          	add    $0x8,%rax
+    2189:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2190:	00 
+    2191:	48 8d 05 8c 1f 00 00 	lea    0x1f8c(%rip),%rax        # 4124 <stats+0x4>
+    2198:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    219b:	8d 48 01             	lea    0x1(%rax),%ecx
+    219e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    21a1:	48 98                	cltq
+    21a3:	48 83 c0 08          	add    $0x8,%rax
+    21a7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    21ae:	00 
+    21af:	48 8d 05 6e 1f 00 00 	lea    0x1f6e(%rip),%rax        # 4124 <stats+0x4>
+    21b6:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    21b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    21bc:	ba 20 00 00 00       	mov    $0x20,%edx
+    21c1:	89 c1                	mov    %eax,%ecx
+    21c3:	48 d3 e2             	shl    %cl,%rdx
+    21c6:	48 89 d0             	mov    %rdx,%rax
+    21c9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    21cd:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    21d4:	00 
+    21d5:	0f 86 38 ff ff ff    	jbe    2113 <refill+0x37>
+  }
+  return 0;
+    21db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    21e0:	c9                   	leave
+    21e1:	c3                   	ret
+
+00000000000021e2 <malloc>:
+
+void *malloc(uint nbytes) {
+    21e2:	55                   	push   %rbp
+    21e3:	48 89 e5             	mov    %rsp,%rbp
+    21e6:	48 83 ec 30          	sub    $0x30,%rsp
+    21ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    21ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    21f0:	48 83 c0 10          	add    $0x10,%rax
+    21f4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    21f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    21ff:	eb 04                	jmp    2205 <malloc+0x23>
+    2201:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2205:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    2209:	7f 16                	jg     2221 <malloc+0x3f>
+    220b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    220e:	ba 20 00 00 00       	mov    $0x20,%edx
+    2213:	89 c1                	mov    %eax,%ecx
+    2215:	48 d3 e2             	shl    %cl,%rdx
+    2218:	48 89 d0             	mov    %rdx,%rax
+    221b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    221f:	72 e0                	jb     2201 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    2221:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    2225:	75 7d                	jne    22a4 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    2227:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    222b:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    2231:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    2237:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    223b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    223f:	48 89 c7             	mov    %rax,%rdi
+    2242:	e8 8b fd ff ff       	call   1fd2 <pagealloc>
+    2247:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    224b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    2250:	75 0a                	jne    225c <malloc+0x7a>
+      return 0;
+    2252:	b8 00 00 00 00       	mov    $0x0,%eax
+    2257:	e9 2c 01 00 00       	jmp    2388 <malloc+0x1a6>
+    h->size = n;
+    225c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2260:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    2264:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    2267:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    226b:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    2272:	00 
+    stats.inuse[LARGE]++;
+    2273:	8b 05 c7 1e 00 00    	mov    0x1ec7(%rip),%eax        # 4140 <stats+0x20>
+    2279:	83 c0 01             	add    $0x1,%eax
+    227c:	89 05 be 1e 00 00    	mov    %eax,0x1ebe(%rip)        # 4140 <stats+0x20>
+    stats.large += n;
+    2282:	48 8b 15 df 1e 00 00 	mov    0x1edf(%rip),%rdx        # 4168 <stats+0x48>
+    2289:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    228d:	48 01 d0             	add    %rdx,%rax
+    2290:	48 89 05 d1 1e 00 00 	mov    %rax,0x1ed1(%rip)        # 4168 <stats+0x48>
+    return h + 1;
+    2297:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    229b:	48 83 c0 10          	add    $0x10,%rax
+    229f:	e9 e4 00 00 00       	jmp    2388 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    22a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22a7:	48 98                	cltq
+    22a9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22b0:	00 
+    22b1:	48 8d 05 08 1e 00 00 	lea    0x1e08(%rip),%rax        # 40c0 <freelist>
+    22b8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    22bc:	48 85 c0             	test   %rax,%rax
+    22bf:	75 18                	jne    22d9 <malloc+0xf7>
+    22c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22c4:	89 c7                	mov    %eax,%edi
+    22c6:	e8 11 fe ff ff       	call   20dc <refill>
+    22cb:	85 c0                	test   %eax,%eax
+    22cd:	79 0a                	jns    22d9 <malloc+0xf7>
+    return 0;
+    22cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    22d4:	e9 af 00 00 00       	jmp    2388 <malloc+0x1a6>
+  b = freelist[c];
+    22d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    22dc:	48 98                	cltq
+    22de:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    22e5:	00 
+    22e6:	48 8d 05 d3 1d 00 00 	lea    0x1dd3(%rip),%rax        # 40c0 <freelist>
+    22ed:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    22f1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    22f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22f9:	48 8b 40 10          	mov    0x10(%rax),%rax
+    22fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    2300:	48 63 d2             	movslq %edx,%rdx
+    2303:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    230a:	00 
+    230b:	48 8d 15 ae 1d 00 00 	lea    0x1dae(%rip),%rdx        # 40c0 <freelist>
+    2312:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    2316:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2319:	48 98                	cltq
+    231b:	48 83 c0 08          	add    $0x8,%rax
+    231f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2326:	00 
+    2327:	48 8d 05 f6 1d 00 00 	lea    0x1df6(%rip),%rax        # 4124 <stats+0x4>
+    232e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2331:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2334:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2337:	48 98                	cltq
+    2339:	48 83 c0 08          	add    $0x8,%rax
+    233d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2344:	00 
+    2345:	48 8d 05 d8 1d 00 00 	lea    0x1dd8(%rip),%rax        # 4124 <stats+0x4>
+    234c:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    234f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2352:	48 98                	cltq
+    2354:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    235b:	00 
+    235c:	48 8d 05 bd 1d 00 00 	lea    0x1dbd(%rip),%rax        # 4120 <stats>
+    2363:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2366:	8d 48 01             	lea    0x1(%rax),%ecx
+    2369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    236c:	48 98                	cltq
+    236e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2375:	00 
+    2376:	48 8d 05 a3 1d 00 00 	lea    0x1da3(%rip),%rax        # 4120 <stats>
+    237d:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    2380:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    2384:	48 83 c0 10          	add    $0x10,%rax
+}
+    2388:	c9                   	leave
+    2389:	c3                   	ret
+
+000000000000238a <free>:
+
+void free(void *ap) {
+    238a:	55                   	push   %rbp
+    238b:	48 89 e5             	mov    %rsp,%rbp
+    238e:	48 83 ec 18          	sub    $0x18,%rsp
+    2392:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    2396:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    239b:	0f 84 03 01 00 00    	je     24a4 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    23a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    23a5:	48 83 e8 10          	sub    $0x10,%rax
+    23a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    23ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23b1:	48 8b 40 08          	mov    0x8(%rax),%rax
+    23b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    23b9:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    23be:	75 42                	jne    2402 <free+0x78>
+    stats.inuse[LARGE]--;
+    23c0:	8b 05 7a 1d 00 00    	mov    0x1d7a(%rip),%eax        # 4140 <stats+0x20>
+    23c6:	83 e8 01             	sub    $0x1,%eax
+    23c9:	89 05 71 1d 00 00    	mov    %eax,0x1d71(%rip)        # 4140 <stats+0x20>
+    stats.large -= b->h.size;
+    23cf:	48 8b 15 92 1d 00 00 	mov    0x1d92(%rip),%rdx        # 4168 <stats+0x48>
+    23d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23da:	48 8b 00             	mov    (%rax),%rax
+    23dd:	48 29 c2             	sub    %rax,%rdx
+    23e0:	48 89 15 81 1d 00 00 	mov    %rdx,0x1d81(%rip)        # 4168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    23e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23eb:	48 8b 10             	mov    (%rax),%rdx
+    23ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    23f2:	48 89 d6             	mov    %rdx,%rsi
+    23f5:	48 89 c7             	mov    %rax,%rdi
+    23f8:	e8 ae fa ff ff       	call   1eab <pagefree>
+    return;
+    23fd:	e9 a3 00 00 00       	jmp    24a5 <free+0x11b>
+  }
+  b->next = freelist[c];
+    2402:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2406:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    240d:	00 
+    240e:	48 8d 05 ab 1c 00 00 	lea    0x1cab(%rip),%rax        # 40c0 <freelist>
+    2415:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    2419:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    241d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    2421:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2425:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    242c:	00 
+    242d:	48 8d 15 8c 1c 00 00 	lea    0x1c8c(%rip),%rdx        # 40c0 <freelist>
+    2434:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2438:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    243c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2440:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2447:	00 
+    2448:	48 8d 05 d1 1c 00 00 	lea    0x1cd1(%rip),%rax        # 4120 <stats>
+    244f:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2452:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2455:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2459:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2460:	00 
+    2461:	48 8d 05 b8 1c 00 00 	lea    0x1cb8(%rip),%rax        # 4120 <stats>
+    2468:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    246b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    246f:	48 83 c0 08          	add    $0x8,%rax
+    2473:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    247a:	00 
+    247b:	48 8d 05 a2 1c 00 00 	lea    0x1ca2(%rip),%rax        # 4124 <stats+0x4>
+    2482:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2485:	8d 48 01             	lea    0x1(%rax),%ecx
+    2488:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    248c:	48 83 c0 08          	add    $0x8,%rax
+    2490:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2497:	00 
+    2498:	48 8d 05 85 1c 00 00 	lea    0x1c85(%rip),%rax        # 4124 <stats+0x4>
+    249f:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    24a2:	eb 01                	jmp    24a5 <free+0x11b>
+    return;
+    24a4:	90                   	nop
+}
+    24a5:	c9                   	leave
+    24a6:	c3                   	ret
+
+00000000000024a7 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    24a7:	55                   	push   %rbp
+    24a8:	48 89 e5             	mov    %rsp,%rbp
+    24ab:	48 83 ec 30          	sub    $0x30,%rsp
+    24af:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    24b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    24b5:	48 8d 15 a4 05 00 00 	lea    0x5a4(%rip),%rdx        # 2a60 <benchreport+0x491>
+    24bc:	48 89 d6             	mov    %rdx,%rsi
+    24bf:	89 c7                	mov    %eax,%edi
+    24c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    24c6:	e8 37 e6 ff ff       	call   b02 <printf>
+  for (c = 0; c < NCLASS; c++)
+    24cb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    24d2:	eb 67                	jmp    253b <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    24d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    24d7:	48 98                	cltq
+    24d9:	48 83 c0 08          	add    $0x8,%rax
+    24dd:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    24e4:	00 
+    24e5:	48 8d 05 38 1c 00 00 	lea    0x1c38(%rip),%rax        # 4124 <stats+0x4>
+    24ec:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    24ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    24f2:	48 98                	cltq
+    24f4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    24fb:	00 
+    24fc:	48 8d 05 1d 1c 00 00 	lea    0x1c1d(%rip),%rax        # 4120 <stats>
+    2503:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    2506:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2509:	ba 20 00 00 00       	mov    $0x20,%edx
+    250e:	89 c1                	mov    %eax,%ecx
+    2510:	48 d3 e2             	shl    %cl,%rdx
+    2513:	48 89 d0             	mov    %rdx,%rax
+    2516:	89 c1                	mov    %eax,%ecx
+    2518:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    251b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    251e:	41 89 f9             	mov    %edi,%r9d
+    2521:	41 89 f0             	mov    %esi,%r8d
+    2524:	48 8d 35 4c 05 00 00 	lea    0x54c(%rip),%rsi        # 2a77 <benchreport+0x4a8>
+    252b:	89 c7                	mov    %eax,%edi
+    252d:	b8 00 00 00 00       	mov    $0x0,%eax
+    2532:	e8 cb e5 ff ff       	call   b02 <printf>
+  for (c = 0; c < NCLASS; c++)
+    2537:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    253b:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    253f:	7e 93                	jle    24d4 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    2541:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2548:	00 
+  for (r = runs; r; r = r->next)
+    2549:	48 8b 05 b0 1b 00 00 	mov    0x1bb0(%rip),%rax        # 4100 <runs>
+    2550:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2554:	eb 17                	jmp    256d <mallocstats+0xc6>
+    nfree += r->size;
+    2556:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    255a:	48 8b 00             	mov    (%rax),%rax
+    255d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    2561:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2565:	48 8b 40 08          	mov    0x8(%rax),%rax
+    2569:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    256d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2572:	75 e2                	jne    2556 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    2574:	48 8b 05 f5 1b 00 00 	mov    0x1bf5(%rip),%rax        # 4170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    257b:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    257d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2581:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2585:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2587:	48 8b 05 da 1b 00 00 	mov    0x1bda(%rip),%rax        # 4168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    258e:	89 c1                	mov    %eax,%ecx
+    2590:	8b 15 aa 1b 00 00    	mov    0x1baa(%rip),%edx        # 4140 <stats+0x20>
+    2596:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2599:	41 89 f9             	mov    %edi,%r9d
+    259c:	41 89 f0             	mov    %esi,%r8d
+    259f:	48 8d 35 e2 04 00 00 	lea    0x4e2(%rip),%rsi        # 2a88 <benchreport+0x4b9>
+    25a6:	89 c7                	mov    %eax,%edi
+    25a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    25ad:	e8 50 e5 ff ff       	call   b02 <printf>
+}
+    25b2:	90                   	nop
+    25b3:	c9                   	leave
+    25b4:	c3                   	ret
+
+00000000000025b5 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    25b5:	55                   	push   %rbp
+    25b6:	48 89 e5             	mov    %rsp,%rbp
+    25b9:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    25bd:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    25c1:	48 89 c7             	mov    %rax,%rdi
+    25c4:	e8 9a f7 ff ff       	call   1d63 <cycles>
+  return t;
+    25c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    25cd:	c9                   	leave
+    25ce:	c3                   	ret
+
+00000000000025cf <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    25cf:	55                   	push   %rbp
+    25d0:	48 89 e5             	mov    %rsp,%rbp
+    25d3:	48 83 ec 30          	sub    $0x30,%rsp
+    25d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    25db:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    25df:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    25e2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    25e6:	0f 8e 24 01 00 00    	jle    2710 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    25ec:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    25f3:	e9 98 00 00 00       	jmp    2690 <benchreport+0xc1>
+    x = t[i];
+    25f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    25fb:	48 98                	cltq
+    25fd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2604:	00 
+    2605:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2609:	48 01 d0             	add    %rdx,%rax
+    260c:	48 8b 00             	mov    (%rax),%rax
+    260f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    2613:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2616:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    2619:	eb 33                	jmp    264e <benchreport+0x7f>
+      t[j] = t[j - 1];
+    261b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    261e:	48 98                	cltq
+    2620:	48 c1 e0 03          	shl    $0x3,%rax
+    2624:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2628:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    262c:	48 01 d0             	add    %rdx,%rax
+    262f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    2632:	48 63 d2             	movslq %edx,%rdx
+    2635:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    263c:	00 
+    263d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2641:	48 01 ca             	add    %rcx,%rdx
+    2644:	48 8b 00             	mov    (%rax),%rax
+    2647:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    264a:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    264e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2652:	7e 1d                	jle    2671 <benchreport+0xa2>
+    2654:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2657:	48 98                	cltq
+    2659:	48 c1 e0 03          	shl    $0x3,%rax
+    265d:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2661:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2665:	48 01 d0             	add    %rdx,%rax
+    2668:	48 8b 00             	mov    (%rax),%rax
+    266b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    266f:	72 aa                	jb     261b <benchreport+0x4c>
+    t[j] = x;
+    2671:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2674:	48 98                	cltq
+    2676:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    267d:	00 
+    267e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2682:	48 01 c2             	add    %rax,%rdx
+    2685:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2689:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    268c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2690:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2693:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2696:	0f 8c 5c ff ff ff    	jl     25f8 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    269c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    269f:	48 98                	cltq
+    26a1:	48 c1 e0 03          	shl    $0x3,%rax
+    26a5:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    26a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26ad:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    26b0:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    26b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    26b6:	89 c2                	mov    %eax,%edx
+    26b8:	c1 ea 1f             	shr    $0x1f,%edx
+    26bb:	01 d0                	add    %edx,%eax
+    26bd:	d1 f8                	sar    %eax
+    26bf:	48 98                	cltq
+    26c1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    26c8:	00 
+    26c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26cd:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    26d0:	48 8b 38             	mov    (%rax),%rdi
+    26d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    26d7:	48 8b 30             	mov    (%rax),%rsi
+    26da:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    26dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    26e1:	48 83 ec 08          	sub    $0x8,%rsp
+    26e5:	51                   	push   %rcx
+    26e6:	49 89 f9             	mov    %rdi,%r9
+    26e9:	49 89 f0             	mov    %rsi,%r8
+    26ec:	89 d1                	mov    %edx,%ecx
+    26ee:	48 89 c2             	mov    %rax,%rdx
+    26f1:	48 8d 05 d0 03 00 00 	lea    0x3d0(%rip),%rax        # 2ac8 <benchreport+0x4f9>
+    26f8:	48 89 c6             	mov    %rax,%rsi
+    26fb:	bf 01 00 00 00       	mov    $0x1,%edi
+    2700:	b8 00 00 00 00       	mov    $0x0,%eax
+    2705:	e8 f8 e3 ff ff       	call   b02 <printf>
+    270a:	48 83 c4 10          	add    $0x10,%rsp
+    270e:	eb 01                	jmp    2711 <benchreport+0x142>
+    return;
+    2710:	90                   	nop
+}
+    2711:	c9                   	leave
+    2712:	c3                   	ret
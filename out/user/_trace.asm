@@ -0,0 +1,3742 @@
+
+out/user/_trace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <dump>:
+};
+
+static struct tracerec recs[NREC];
+
+// Drain the rings into path.  Returns the number of records saved.
+static int dump(char *path) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int fd, n, total;
+
+  // open() cannot truncate, so a shorter dump would keep an old tail
+  unlink(path);
+       c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      10:	48 89 c7             	mov    %rax,%rdi
+      13:	e8 cd 17 00 00       	call   17e5 <unlink>
+  if ((fd = open(path, O_CREATE | O_RDWR)) < 0) {
+      18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      1c:	be 02 02 00 00       	mov    $0x202,%esi
+      21:	48 89 c7             	mov    %rax,%rdi
+      24:	e8 a6 17 00 00       	call   17cf <open>
+      29:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      2c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      30:	79 2a                	jns    5c <dump+0x5c>
+    printf(2, "trace: cannot create %s\n", path);
+      32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      36:	48 89 c2             	mov    %rax,%rdx
+      39:	48 8d 05 da 22 00 00 	lea    0x22da(%rip),%rax        # 231a <benchreport+0x18a>
+      40:	48 89 c6             	mov    %rax,%rsi
+      43:	bf 02 00 00 00       	mov    $0x2,%edi
+      48:	b8 00 00 00 00       	mov    $0x0,%eax
+      4d:	e8 71 06 00 00       	call   6c3 <printf>
+    return -1;
+      52:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      57:	e9 8f 00 00 00       	jmp    eb <dump+0xeb>
+  }
+  total = 0;
+      5c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ((n = trace(TRACE_READ, recs, NREC)) > 0) {
+      63:	eb 57                	jmp    bc <dump+0xbc>
+    if (write(fd, recs, n * sizeof(recs[0])) != n * sizeof(recs[0])) {
+      65:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      68:	48 98                	cltq
+      6a:	c1 e0 05             	shl    $0x5,%eax
+      6d:	89 c2                	mov    %eax,%edx
+      6f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      72:	48 8d 0d 27 30 00 00 	lea    0x3027(%rip),%rcx        # 30a0 <recs>
+      79:	48 89 ce             	mov    %rcx,%rsi
+      7c:	89 c7                	mov    %eax,%edi
+      7e:	e8 20 17 00 00       	call   17a3 <write>
+      83:	48 63 d0             	movslq %eax,%rdx
+      86:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      89:	48 98                	cltq
+      8b:	48 c1 e0 05          	shl    $0x5,%rax
+      8f:	48 39 c2             	cmp    %rax,%rdx
+      92:	74 22                	je     b6 <dump+0xb6>
+      printf(2, "trace: write %s failed\n", path);
+      94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      98:	48 89 c2             	mov    %rax,%rdx
+      9b:	48 8d 05 91 22 00 00 	lea    0x2291(%rip),%rax        # 2333 <benchreport+0x1a3>
+      a2:	48 89 c6             	mov    %rax,%rsi
+      a5:	bf 02 00 00 00       	mov    $0x2,%edi
+      aa:	b8 00 00 00 00       	mov    $0x0,%eax
+      af:	e8 0f 06 00 00       	call   6c3 <printf>
+      break;
+      b4:	eb 28                	jmp    de <dump+0xde>
+    }
+    total += n;
+      b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      b9:	01 45 fc             	add    %eax,-0x4(%rbp)
+  while ((n = trace(TRACE_READ, recs, NREC)) > 0) {
+      bc:	ba 80 00 00 00       	mov    $0x80,%edx
+      c1:	48 8d 05 d8 2f 00 00 	lea    0x2fd8(%rip),%rax        # 30a0 <recs>
+      c8:	48 89 c6             	mov    %rax,%rsi
+      cb:	bf 02 00 00 00       	mov    $0x2,%edi
+      d0:	e8 39 18 00 00       	call   190e <trace>
+      d5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+      dc:	7f 87                	jg     65 <dump+0x65>
+  }
+  close(fd);
+      de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      e1:	89 c7                	mov    %eax,%edi
+      e3:	e8 75 0c 00 00       	call   d5d <close>
+  return total;
+      e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+      eb:	c9                   	leave
+      ec:	c3                   	ret
+
+00000000000000ed <show>:
+
+static void show(char *path) {
+      ed:	55                   	push   %rbp
+      ee:	48 89 e5             	mov    %rsp,%rbp
+      f1:	48 83 ec 30          	sub    $0x30,%rsp
+      f5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  uint64_t first;
+  struct tracerec *r;
+  int fd, n, i, started;
+
+  if ((fd = open(path, O_RDONLY)) < 0) {
+      f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      fd:	be 00 00 00 00       	mov    $0x0,%esi
+     102:	48 89 c7             	mov    %rax,%rdi
+     105:	e8 c5 16 00 00       	call   17cf <open>
+     10a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     10d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     111:	79 25                	jns    138 <show+0x4b>
+    printf(2, "trace: cannot open %s\n", path);
+     113:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     117:	48 89 c2             	mov    %rax,%rdx
+     11a:	48 8d 05 2a 22 00 00 	lea    0x222a(%rip),%rax        # 234b <benchreport+0x1bb>
+     121:	48 89 c6             	mov    %rax,%rsi
+     124:	bf 02 00 00 00       	mov    $0x2,%edi
+     129:	b8 00 00 00 00       	mov    $0x0,%eax
+     12e:	e8 90 05 00 00       	call   6c3 <printf>
+    exit();
+     133:	e8 bb 0b 00 00       	call   cf3 <exit>
+  }
+  first = 0;
+     138:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+     13f:	00 
+  started = 0;
+     140:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  while ((n = read(fd, recs, sizeof(recs))) > 0) {
+     147:	e9 5d 01 00 00       	jmp    2a9 <show+0x1bc>
+    for (i = 0; i < n / (int)sizeof(recs[0]); i++) {
+     14c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     153:	e9 3a 01 00 00       	jmp    292 <show+0x1a5>
+      r = &recs[i];
+     158:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     15b:	48 98                	cltq
+     15d:	48 c1 e0 05          	shl    $0x5,%rax
+     161:	48 89 c2             	mov    %rax,%rdx
+     164:	48 8d 05 35 2f 00 00 	lea    0x2f35(%rip),%rax        # 30a0 <recs>
+     16b:	48 01 d0             	add    %rdx,%rax
+     16e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      if (!started) {
+     172:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     176:	75 12                	jne    18a <show+0x9d>
+        first = r->tsc;
+     178:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     17c:	48 8b 00             	mov    (%rax),%rax
+     17f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+        started = 1;
+     183:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%rbp)
+      }
+      printf(1, "%ld %d %d ", r->tsc - first, r->cpu, r->pid);
+     18a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     18e:	8b 48 0c             	mov    0xc(%rax),%ecx
+     191:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     195:	0f b7 40 0a          	movzwl 0xa(%rax),%eax
+     199:	0f b7 d0             	movzwl %ax,%edx
+     19c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1a0:	48 8b 00             	mov    (%rax),%rax
+     1a3:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+     1a7:	41 89 c8             	mov    %ecx,%r8d
+     1aa:	89 d1                	mov    %edx,%ecx
+     1ac:	48 89 c2             	mov    %rax,%rdx
+     1af:	48 8d 05 ac 21 00 00 	lea    0x21ac(%rip),%rax        # 2362 <benchreport+0x1d2>
+     1b6:	48 89 c6             	mov    %rax,%rsi
+     1b9:	bf 01 00 00 00       	mov    $0x1,%edi
+     1be:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c3:	e8 fb 04 00 00       	call   6c3 <printf>
+      if (r->type < sizeof(names) / sizeof(names[0]) && names[r->type])
+     1c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1cc:	0f b7 40 08          	movzwl 0x8(%rax),%eax
+     1d0:	66 83 f8 09          	cmp    $0x9,%ax
+     1d4:	77 63                	ja     239 <show+0x14c>
+     1d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1da:	0f b7 40 08          	movzwl 0x8(%rax),%eax
+     1de:	0f b7 c0             	movzwl %ax,%eax
+     1e1:	48 98                	cltq
+     1e3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     1ea:	00 
+     1eb:	48 8d 05 0e 2e 00 00 	lea    0x2e0e(%rip),%rax        # 3000 <names>
+     1f2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     1f6:	48 85 c0             	test   %rax,%rax
+     1f9:	74 3e                	je     239 <show+0x14c>
+        printf(1, "%s", names[r->type]);
+     1fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1ff:	0f b7 40 08          	movzwl 0x8(%rax),%eax
+     203:	0f b7 c0             	movzwl %ax,%eax
+     206:	48 98                	cltq
+     208:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     20f:	00 
+     210:	48 8d 05 e9 2d 00 00 	lea    0x2de9(%rip),%rax        # 3000 <names>
+     217:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     21b:	48 89 c2             	mov    %rax,%rdx
+     21e:	48 8d 05 48 21 00 00 	lea    0x2148(%rip),%rax        # 236d <benchreport+0x1dd>
+     225:	48 89 c6             	mov    %rax,%rsi
+     228:	bf 01 00 00 00       	mov    $0x1,%edi
+     22d:	b8 00 00 00 00       	mov    $0x0,%eax
+     232:	e8 8c 04 00 00       	call   6c3 <printf>
+     237:	eb 26                	jmp    25f <show+0x172>
+      else
+        printf(1, "%d", r->type);
+     239:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     23d:	0f b7 40 08          	movzwl 0x8(%rax),%eax
+     241:	0f b7 c0             	movzwl %ax,%eax
+     244:	89 c2                	mov    %eax,%edx
+     246:	48 8d 05 23 21 00 00 	lea    0x2123(%rip),%rax        # 2370 <benchreport+0x1e0>
+     24d:	48 89 c6             	mov    %rax,%rsi
+     250:	bf 01 00 00 00       	mov    $0x1,%edi
+     255:	b8 00 00 00 00       	mov    $0x0,%eax
+     25a:	e8 64 04 00 00       	call   6c3 <printf>
+      printf(1, " %lx %lx\n", r->a, r->b);
+     25f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     263:	48 8b 50 18          	mov    0x18(%rax),%rdx
+     267:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     26b:	48 8b 40 10          	mov    0x10(%rax),%rax
+     26f:	48 89 d1             	mov    %rdx,%rcx
+     272:	48 89 c2             	mov    %rax,%rdx
+     275:	48 8d 05 f7 20 00 00 	lea    0x20f7(%rip),%rax        # 2373 <benchreport+0x1e3>
+     27c:	48 89 c6             	mov    %rax,%rsi
+     27f:	bf 01 00 00 00       	mov    $0x1,%edi
+     284:	b8 00 00 00 00       	mov    $0x0,%eax
+     289:	e8 35 04 00 00       	call   6c3 <printf>
+    for (i = 0; i < n / (int)sizeof(recs[0]); i++) {
+     28e:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     292:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     295:	8d 50 1f             	lea    0x1f(%rax),%edx
+     298:	85 c0                	test   %eax,%eax
+     29a:	0f 48 c2             	cmovs  %edx,%eax
+     29d:	c1 f8 05             	sar    $0x5,%eax
+     2a0:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     2a3:	0f 8c af fe ff ff    	jl     158 <show+0x6b>
+  while ((n = read(fd, recs, sizeof(recs))) > 0) {
+     2a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     2ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+     2b1:	48 8d 0d e8 2d 00 00 	lea    0x2de8(%rip),%rcx        # 30a0 <recs>
+     2b8:	48 89 ce             	mov    %rcx,%rsi
+     2bb:	89 c7                	mov    %eax,%edi
+     2bd:	e8 d6 14 00 00       	call   1798 <read>
+     2c2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+     2c5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     2c9:	0f 8f 7d fe ff ff    	jg     14c <show+0x5f>
+    }
+  }
+  close(fd);
+     2cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     2d2:	89 c7                	mov    %eax,%edi
+     2d4:	e8 84 0a 00 00       	call   d5d <close>
+}
+     2d9:	90                   	nop
+     2da:	c9                   	leave
+     2db:	c3                   	ret
+
+00000000000002dc <main>:
+
+int main(int argc, char *argv[]) {
+     2dc:	55                   	push   %rbp
+     2dd:	48 89 e5             	mov    %rsp,%rbp
+     2e0:	48 83 ec 20          	sub    $0x20,%rsp
+     2e4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     2e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int pid;
+
+  if (argc == 2 && strcmp(argv[1], "on") == 0) {
+     2eb:	83 7d ec 02          	cmpl   $0x2,-0x14(%rbp)
+     2ef:	75 3a                	jne    32b <main+0x4f>
+     2f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     2f5:	48 83 c0 08          	add    $0x8,%rax
+     2f9:	48 8b 00             	mov    (%rax),%rax
+     2fc:	48 8d 15 7a 20 00 00 	lea    0x207a(%rip),%rdx        # 237d <benchreport+0x1ed>
+     303:	48 89 d6             	mov    %rdx,%rsi
+     306:	48 89 c7             	mov    %rax,%rdi
+     309:	e8 e8 0c 00 00       	call   ff6 <strcmp>
+     30e:	85 c0                	test   %eax,%eax
+     310:	75 19                	jne    32b <main+0x4f>
+    trace(TRACE_ON, 0, 0);
+     312:	ba 00 00 00 00       	mov    $0x0,%edx
+     317:	be 00 00 00 00       	mov    $0x0,%esi
+     31c:	bf 00 00 00 00       	mov    $0x0,%edi
+     321:	e8 e8 15 00 00       	call   190e <trace>
+     326:	e9 d5 01 00 00       	jmp    500 <main+0x224>
+  } else if (argc == 2 && strcmp(argv[1], "off") == 0) {
+     32b:	83 7d ec 02          	cmpl   $0x2,-0x14(%rbp)
+     32f:	75 3a                	jne    36b <main+0x8f>
+     331:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     335:	48 83 c0 08          	add    $0x8,%rax
+     339:	48 8b 00             	mov    (%rax),%rax
+     33c:	48 8d 15 3d 20 00 00 	lea    0x203d(%rip),%rdx        # 2380 <benchreport+0x1f0>
+     343:	48 89 d6             	mov    %rdx,%rsi
+     346:	48 89 c7             	mov    %rax,%rdi
+     349:	e8 a8 0c 00 00       	call   ff6 <strcmp>
+     34e:	85 c0                	test   %eax,%eax
+     350:	75 19                	jne    36b <main+0x8f>
+    trace(TRACE_OFF, 0, 0);
+     352:	ba 00 00 00 00       	mov    $0x0,%edx
+     357:	be 00 00 00 00       	mov    $0x0,%esi
+     35c:	bf 01 00 00 00       	mov    $0x1,%edi
+     361:	e8 a8 15 00 00       	call   190e <trace>
+     366:	e9 95 01 00 00       	jmp    500 <main+0x224>
+  } else if (argc == 3 && strcmp(argv[1], "dump") == 0) {
+     36b:	83 7d ec 03          	cmpl   $0x3,-0x14(%rbp)
+     36f:	75 54                	jne    3c5 <main+0xe9>
+     371:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     375:	48 83 c0 08          	add    $0x8,%rax
+     379:	48 8b 00             	mov    (%rax),%rax
+     37c:	48 8d 15 01 20 00 00 	lea    0x2001(%rip),%rdx        # 2384 <benchreport+0x1f4>
+     383:	48 89 d6             	mov    %rdx,%rsi
+     386:	48 89 c7             	mov    %rax,%rdi
+     389:	e8 68 0c 00 00       	call   ff6 <strcmp>
+     38e:	85 c0                	test   %eax,%eax
+     390:	75 33                	jne    3c5 <main+0xe9>
+    printf(1, "%d records\n", dump(argv[2]));
+     392:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     396:	48 83 c0 10          	add    $0x10,%rax
+     39a:	48 8b 00             	mov    (%rax),%rax
+     39d:	48 89 c7             	mov    %rax,%rdi
+     3a0:	e8 5b fc ff ff       	call   0 <dump>
+     3a5:	89 c2                	mov    %eax,%edx
+     3a7:	48 8d 05 db 1f 00 00 	lea    0x1fdb(%rip),%rax        # 2389 <benchreport+0x1f9>
+     3ae:	48 89 c6             	mov    %rax,%rsi
+     3b1:	bf 01 00 00 00       	mov    $0x1,%edi
+     3b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     3bb:	e8 03 03 00 00       	call   6c3 <printf>
+     3c0:	e9 3b 01 00 00       	jmp    500 <main+0x224>
+  } else if (argc == 3 && strcmp(argv[1], "show") == 0) {
+     3c5:	83 7d ec 03          	cmpl   $0x3,-0x14(%rbp)
+     3c9:	75 39                	jne    404 <main+0x128>
+     3cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     3cf:	48 83 c0 08          	add    $0x8,%rax
+     3d3:	48 8b 00             	mov    (%rax),%rax
+     3d6:	48 8d 15 b8 1f 00 00 	lea    0x1fb8(%rip),%rdx        # 2395 <benchreport+0x205>
+     3dd:	48 89 d6             	mov    %rdx,%rsi
+     3e0:	48 89 c7             	mov    %rax,%rdi
+     3e3:	e8 0e 0c 00 00       	call   ff6 <strcmp>
+     3e8:	85 c0                	test   %eax,%eax
+     3ea:	75 18                	jne    404 <main+0x128>
+    show(argv[2]);
+     3ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     3f0:	48 83 c0 10          	add    $0x10,%rax
+     3f4:	48 8b 00             	mov    (%rax),%rax
+     3f7:	48 89 c7             	mov    %rax,%rdi
+     3fa:	e8 ee fc ff ff       	call   ed <show>
+     3ff:	e9 fc 00 00 00       	jmp    500 <main+0x224>
+  } else if (argc >= 3) {
+     404:	83 7d ec 02          	cmpl   $0x2,-0x14(%rbp)
+     408:	0f 8e d9 00 00 00    	jle    4e7 <main+0x20b>
+    // Throw away what was recorded before cmd starts
+    while (trace(TRACE_READ, recs, NREC) > 0)
+     40e:	90                   	nop
+     40f:	ba 80 00 00 00       	mov    $0x80,%edx
+     414:	48 8d 05 85 2c 00 00 	lea    0x2c85(%rip),%rax        # 30a0 <recs>
+     41b:	48 89 c6             	mov    %rax,%rsi
+     41e:	bf 02 00 00 00       	mov    $0x2,%edi
+     423:	e8 e6 14 00 00       	call   190e <trace>
+     428:	85 c0                	test   %eax,%eax
+     42a:	7f e3                	jg     40f <main+0x133>
+      ;
+    trace(TRACE_ON, 0, 0);
+     42c:	ba 00 00 00 00       	mov    $0x0,%edx
+     431:	be 00 00 00 00       	mov    $0x0,%esi
+     436:	bf 00 00 00 00       	mov    $0x0,%edi
+     43b:	e8 ce 14 00 00       	call   190e <trace>
+    if ((pid = fork()) == 0) {
+     440:	e8 9e 08 00 00       	call   ce3 <fork>
+     445:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     448:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     44c:	75 4a                	jne    498 <main+0x1bc>
+      exec(argv[2], argv + 2);
+     44e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     452:	48 8d 50 10          	lea    0x10(%rax),%rdx
+     456:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     45a:	48 83 c0 10          	add    $0x10,%rax
+     45e:	48 8b 00             	mov    (%rax),%rax
+     461:	48 89 d6             	mov    %rdx,%rsi
+     464:	48 89 c7             	mov    %rax,%rdi
+     467:	e8 95 08 00 00       	call   d01 <exec>
+      printf(2, "trace: exec %s failed\n", argv[2]);
+     46c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     470:	48 83 c0 10          	add    $0x10,%rax
+     474:	48 8b 00             	mov    (%rax),%rax
+     477:	48 89 c2             	mov    %rax,%rdx
+     47a:	48 8d 05 19 1f 00 00 	lea    0x1f19(%rip),%rax        # 239a <benchreport+0x20a>
+     481:	48 89 c6             	mov    %rax,%rsi
+     484:	bf 02 00 00 00       	mov    $0x2,%edi
+     489:	b8 00 00 00 00       	mov    $0x0,%eax
+     48e:	e8 30 02 00 00       	call   6c3 <printf>
+      exit();
+     493:	e8 5b 08 00 00       	call   cf3 <exit>
+    }
+    if (pid > 0)
+     498:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     49c:	7e 05                	jle    4a3 <main+0x1c7>
+      wait();
+     49e:	e8 df 12 00 00       	call   1782 <wait>
+    trace(TRACE_OFF, 0, 0);
+     4a3:	ba 00 00 00 00       	mov    $0x0,%edx
+     4a8:	be 00 00 00 00       	mov    $0x0,%esi
+     4ad:	bf 01 00 00 00       	mov    $0x1,%edi
+     4b2:	e8 57 14 00 00       	call   190e <trace>
+    printf(1, "%d records\n", dump(argv[1]));
+     4b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     4bb:	48 83 c0 08          	add    $0x8,%rax
+     4bf:	48 8b 00             	mov    (%rax),%rax
+     4c2:	48 89 c7             	mov    %rax,%rdi
+     4c5:	e8 36 fb ff ff       	call   0 <dump>
+     4ca:	89 c2                	mov    %eax,%edx
+     4cc:	48 8d 05 b6 1e 00 00 	lea    0x1eb6(%rip),%rax        # 2389 <benchreport+0x1f9>
+     4d3:	48 89 c6             	mov    %rax,%rsi
+     4d6:	bf 01 00 00 00       	mov    $0x1,%edi
+     4db:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e0:	e8 de 01 00 00       	call   6c3 <printf>
+     4e5:	eb 19                	jmp    500 <main+0x224>
+  } else {
+    printf(2, "usage: trace on|off | dump file | show file | "
+     4e7:	48 8d 05 ca 1e 00 00 	lea    0x1eca(%rip),%rax        # 23b8 <benchreport+0x228>
+     4ee:	48 89 c6             	mov    %rax,%rsi
+     4f1:	bf 02 00 00 00       	mov    $0x2,%edi
+     4f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     4fb:	e8 c3 01 00 00       	call   6c3 <printf>
+              "file cmd [args...]\n");
+  }
+  exit();
+     500:	e8 ee 07 00 00       	call   cf3 <exit>
+
+0000000000000505 <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     505:	55                   	push   %rbp
+     506:	48 89 e5             	mov    %rsp,%rbp
+     509:	48 83 ec 10          	sub    $0x10,%rsp
+     50d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     510:	89 f0                	mov    %esi,%eax
+     512:	88 45 f8             	mov    %al,-0x8(%rbp)
+     515:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     519:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     51c:	89 d6                	mov    %edx,%esi
+     51e:	89 c7                	mov    %eax,%edi
+     520:	e8 eb 06 00 00       	call   c10 <bputc>
+     525:	90                   	nop
+     526:	c9                   	leave
+     527:	c3                   	ret
+
+0000000000000528 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     528:	55                   	push   %rbp
+     529:	48 89 e5             	mov    %rsp,%rbp
+     52c:	48 83 ec 50          	sub    $0x50,%rsp
+     530:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     533:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     537:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     53a:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     53d:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     541:	74 21                	je     564 <printint64+0x3c>
+     543:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     547:	48 c1 e8 3f          	shr    $0x3f,%rax
+     54b:	0f b6 c0             	movzbl %al,%eax
+     54e:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     551:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     555:	74 0d                	je     564 <printint64+0x3c>
+    x = -xx;
+     557:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     55b:	48 f7 d8             	neg    %rax
+     55e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     562:	eb 08                	jmp    56c <printint64+0x44>
+  else
+    x = xx;
+     564:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     568:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     56c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     573:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     576:	48 63 c8             	movslq %eax,%rcx
+     579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     57d:	ba 00 00 00 00       	mov    $0x0,%edx
+     582:	48 f7 f1             	div    %rcx
+     585:	48 89 d1             	mov    %rdx,%rcx
+     588:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     58b:	8d 50 01             	lea    0x1(%rax),%edx
+     58e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     591:	48 8d 15 b8 2a 00 00 	lea    0x2ab8(%rip),%rdx        # 3050 <digits.1>
+     598:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     59c:	48 98                	cltq
+     59e:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     5a2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     5a5:	48 63 f0             	movslq %eax,%rsi
+     5a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5ac:	ba 00 00 00 00       	mov    $0x0,%edx
+     5b1:	48 f7 f6             	div    %rsi
+     5b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     5b8:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     5bd:	75 b4                	jne    573 <printint64+0x4b>
+
+  if (sgn)
+     5bf:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     5c3:	74 2b                	je     5f0 <printint64+0xc8>
+    buf[i++] = '-';
+     5c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5c8:	8d 50 01             	lea    0x1(%rax),%edx
+     5cb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     5ce:	48 98                	cltq
+     5d0:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     5d5:	eb 19                	jmp    5f0 <printint64+0xc8>
+    putc(fd, buf[i]);
+     5d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5da:	48 98                	cltq
+     5dc:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     5e1:	0f be d0             	movsbl %al,%edx
+     5e4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     5e7:	89 d6                	mov    %edx,%esi
+     5e9:	89 c7                	mov    %eax,%edi
+     5eb:	e8 15 ff ff ff       	call   505 <putc>
+  while (--i >= 0)
+     5f0:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     5f4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     5f8:	79 dd                	jns    5d7 <printint64+0xaf>
+}
+     5fa:	90                   	nop
+     5fb:	90                   	nop
+     5fc:	c9                   	leave
+     5fd:	c3                   	ret
+
+00000000000005fe <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     5fe:	55                   	push   %rbp
+     5ff:	48 89 e5             	mov    %rsp,%rbp
+     602:	48 83 ec 30          	sub    $0x30,%rsp
+     606:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     609:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     60c:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     60f:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     612:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     619:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     61d:	74 17                	je     636 <printint+0x38>
+     61f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     623:	79 11                	jns    636 <printint+0x38>
+    neg = 1;
+     625:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     62c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     62f:	f7 d8                	neg    %eax
+     631:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     634:	eb 06                	jmp    63c <printint+0x3e>
+  } else {
+    x = xx;
+     636:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     639:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     63c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     643:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     646:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     649:	ba 00 00 00 00       	mov    $0x0,%edx
+     64e:	f7 f1                	div    %ecx
+     650:	89 d1                	mov    %edx,%ecx
+     652:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     655:	8d 50 01             	lea    0x1(%rax),%edx
+     658:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     65b:	89 c9                	mov    %ecx,%ecx
+     65d:	48 8d 15 0c 2a 00 00 	lea    0x2a0c(%rip),%rdx        # 3070 <digits.0>
+     664:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     668:	48 98                	cltq
+     66a:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     66e:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     671:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     674:	ba 00 00 00 00       	mov    $0x0,%edx
+     679:	f7 f6                	div    %esi
+     67b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     67e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     682:	75 bf                	jne    643 <printint+0x45>
+  if (neg)
+     684:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     688:	74 2b                	je     6b5 <printint+0xb7>
+    buf[i++] = '-';
+     68a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     68d:	8d 50 01             	lea    0x1(%rax),%edx
+     690:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     693:	48 98                	cltq
+     695:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     69a:	eb 19                	jmp    6b5 <printint+0xb7>
+    putc(fd, buf[i]);
+     69c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     69f:	48 98                	cltq
+     6a1:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     6a6:	0f be d0             	movsbl %al,%edx
+     6a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6ac:	89 d6                	mov    %edx,%esi
+     6ae:	89 c7                	mov    %eax,%edi
+     6b0:	e8 50 fe ff ff       	call   505 <putc>
+  while (--i >= 0)
+     6b5:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     6b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     6bd:	79 dd                	jns    69c <printint+0x9e>
+}
+     6bf:	90                   	nop
+     6c0:	90                   	nop
+     6c1:	c9                   	leave
+     6c2:	c3                   	ret
+
+00000000000006c3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     6c3:	55                   	push   %rbp
+     6c4:	48 89 e5             	mov    %rsp,%rbp
+     6c7:	48 83 ec 70          	sub    $0x70,%rsp
+     6cb:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     6ce:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     6d2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     6d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     6da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     6de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     6e2:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     6e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     6ed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     6f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     6f5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     6f9:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     700:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     707:	e9 67 02 00 00       	jmp    973 <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     70c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     70f:	48 63 d0             	movslq %eax,%rdx
+     712:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     716:	48 01 d0             	add    %rdx,%rax
+     719:	0f b6 00             	movzbl (%rax),%eax
+     71c:	0f be c0             	movsbl %al,%eax
+     71f:	25 ff 00 00 00       	and    $0xff,%eax
+     724:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     727:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     72b:	75 30                	jne    75d <printf+0x9a>
+      if (c == '%') {
+     72d:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     731:	75 13                	jne    746 <printf+0x83>
+        state = '%';
+     733:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     73a:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     741:	e9 29 02 00 00       	jmp    96f <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     746:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     749:	0f be d0             	movsbl %al,%edx
+     74c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     74f:	89 d6                	mov    %edx,%esi
+     751:	89 c7                	mov    %eax,%edi
+     753:	e8 ad fd ff ff       	call   505 <putc>
+     758:	e9 12 02 00 00       	jmp    96f <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     75d:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     761:	0f 85 08 02 00 00    	jne    96f <printf+0x2ac>
+      if (c == 'l') {
+     767:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     76b:	75 0c                	jne    779 <printf+0xb6>
+        lflag = 1;
+     76d:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     774:	e9 f6 01 00 00       	jmp    96f <printf+0x2ac>
+      } else if (c == 'd') {
+     779:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     77d:	0f 85 93 00 00 00    	jne    816 <printf+0x153>
+        if (lflag == 1)
+     783:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     787:	75 47                	jne    7d0 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     789:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     78c:	83 f8 2f             	cmp    $0x2f,%eax
+     78f:	77 17                	ja     7a8 <printf+0xe5>
+     791:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     795:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     798:	89 d2                	mov    %edx,%edx
+     79a:	48 01 d0             	add    %rdx,%rax
+     79d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7a0:	83 c2 08             	add    $0x8,%edx
+     7a3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     7a6:	eb 0c                	jmp    7b4 <printf+0xf1>
+     7a8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     7ac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     7b0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     7b4:	48 8b 30             	mov    (%rax),%rsi
+     7b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+     7bf:	ba 0a 00 00 00       	mov    $0xa,%edx
+     7c4:	89 c7                	mov    %eax,%edi
+     7c6:	e8 5d fd ff ff       	call   528 <printint64>
+     7cb:	e9 98 01 00 00       	jmp    968 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     7d0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     7d3:	83 f8 2f             	cmp    $0x2f,%eax
+     7d6:	77 17                	ja     7ef <printf+0x12c>
+     7d8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     7dc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7df:	89 d2                	mov    %edx,%edx
+     7e1:	48 01 d0             	add    %rdx,%rax
+     7e4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7e7:	83 c2 08             	add    $0x8,%edx
+     7ea:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     7ed:	eb 0c                	jmp    7fb <printf+0x138>
+     7ef:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     7f3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     7f7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     7fb:	8b 30                	mov    (%rax),%esi
+     7fd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     800:	b9 01 00 00 00       	mov    $0x1,%ecx
+     805:	ba 0a 00 00 00       	mov    $0xa,%edx
+     80a:	89 c7                	mov    %eax,%edi
+     80c:	e8 ed fd ff ff       	call   5fe <printint>
+     811:	e9 52 01 00 00       	jmp    968 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     816:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     81a:	74 0a                	je     826 <printf+0x163>
+     81c:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     820:	0f 85 93 00 00 00    	jne    8b9 <printf+0x1f6>
+        if (lflag == 1)
+     826:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     82a:	75 47                	jne    873 <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     82c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     82f:	83 f8 2f             	cmp    $0x2f,%eax
+     832:	77 17                	ja     84b <printf+0x188>
+     834:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     838:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     83b:	89 d2                	mov    %edx,%edx
+     83d:	48 01 d0             	add    %rdx,%rax
+     840:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     843:	83 c2 08             	add    $0x8,%edx
+     846:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     849:	eb 0c                	jmp    857 <printf+0x194>
+     84b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     84f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     853:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     857:	48 8b 30             	mov    (%rax),%rsi
+     85a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     85d:	b9 00 00 00 00       	mov    $0x0,%ecx
+     862:	ba 10 00 00 00       	mov    $0x10,%edx
+     867:	89 c7                	mov    %eax,%edi
+     869:	e8 ba fc ff ff       	call   528 <printint64>
+        if (lflag == 1)
+     86e:	e9 f5 00 00 00       	jmp    968 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     873:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     876:	83 f8 2f             	cmp    $0x2f,%eax
+     879:	77 17                	ja     892 <printf+0x1cf>
+     87b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     87f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     882:	89 d2                	mov    %edx,%edx
+     884:	48 01 d0             	add    %rdx,%rax
+     887:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     88a:	83 c2 08             	add    $0x8,%edx
+     88d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     890:	eb 0c                	jmp    89e <printf+0x1db>
+     892:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     896:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     89a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     89e:	8b 30                	mov    (%rax),%esi
+     8a0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+     8a8:	ba 10 00 00 00       	mov    $0x10,%edx
+     8ad:	89 c7                	mov    %eax,%edi
+     8af:	e8 4a fd ff ff       	call   5fe <printint>
+        if (lflag == 1)
+     8b4:	e9 af 00 00 00       	jmp    968 <printf+0x2a5>
+      } else if (c == 's') {
+     8b9:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     8bd:	75 6e                	jne    92d <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     8bf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8c2:	83 f8 2f             	cmp    $0x2f,%eax
+     8c5:	77 17                	ja     8de <printf+0x21b>
+     8c7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8cb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8ce:	89 d2                	mov    %edx,%edx
+     8d0:	48 01 d0             	add    %rdx,%rax
+     8d3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8d6:	83 c2 08             	add    $0x8,%edx
+     8d9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     8dc:	eb 0c                	jmp    8ea <printf+0x227>
+     8de:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8e2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8e6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     8ea:	48 8b 00             	mov    (%rax),%rax
+     8ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     8f1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     8f6:	75 28                	jne    920 <printf+0x25d>
+          s = "(null)";
+     8f8:	48 8d 05 fb 1a 00 00 	lea    0x1afb(%rip),%rax        # 23fa <benchreport+0x26a>
+     8ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     903:	eb 1b                	jmp    920 <printf+0x25d>
+          putc(fd, *s);
+     905:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     909:	0f b6 00             	movzbl (%rax),%eax
+     90c:	0f be d0             	movsbl %al,%edx
+     90f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     912:	89 d6                	mov    %edx,%esi
+     914:	89 c7                	mov    %eax,%edi
+     916:	e8 ea fb ff ff       	call   505 <putc>
+        for (; *s; s++)
+     91b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     920:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     924:	0f b6 00             	movzbl (%rax),%eax
+     927:	84 c0                	test   %al,%al
+     929:	75 da                	jne    905 <printf+0x242>
+     92b:	eb 3b                	jmp    968 <printf+0x2a5>
+      } else if (c == '%') {
+     92d:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     931:	75 14                	jne    947 <printf+0x284>
+        putc(fd, c);
+     933:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     936:	0f be d0             	movsbl %al,%edx
+     939:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     93c:	89 d6                	mov    %edx,%esi
+     93e:	89 c7                	mov    %eax,%edi
+     940:	e8 c0 fb ff ff       	call   505 <putc>
+     945:	eb 21                	jmp    968 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     947:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     94a:	be 25 00 00 00       	mov    $0x25,%esi
+     94f:	89 c7                	mov    %eax,%edi
+     951:	e8 af fb ff ff       	call   505 <putc>
+        putc(fd, c);
+     956:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     959:	0f be d0             	movsbl %al,%edx
+     95c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     95f:	89 d6                	mov    %edx,%esi
+     961:	89 c7                	mov    %eax,%edi
+     963:	e8 9d fb ff ff       	call   505 <putc>
+      }
+      state = 0;
+     968:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     96f:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     973:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     976:	48 63 d0             	movslq %eax,%rdx
+     979:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     97d:	48 01 d0             	add    %rdx,%rax
+     980:	0f b6 00             	movzbl (%rax),%eax
+     983:	84 c0                	test   %al,%al
+     985:	0f 85 81 fd ff ff    	jne    70c <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     98b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     98e:	89 c7                	mov    %eax,%edi
+     990:	e8 ee 02 00 00       	call   c83 <bflushtty>
+}
+     995:	90                   	nop
+     996:	c9                   	leave
+     997:	c3                   	ret
+
+0000000000000998 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     998:	55                   	push   %rbp
+     999:	48 89 e5             	mov    %rsp,%rbp
+     99c:	48 83 ec 30          	sub    $0x30,%rsp
+     9a0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     9a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     9a7:	78 06                	js     9af <getbuf+0x17>
+     9a9:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     9ad:	7e 0a                	jle    9b9 <getbuf+0x21>
+    return 0;
+     9af:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b4:	e9 94 00 00 00       	jmp    a4d <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     9b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     9bc:	48 98                	cltq
+     9be:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     9c5:	00 
+     9c6:	48 8d 05 d3 36 00 00 	lea    0x36d3(%rip),%rax        # 40a0 <obufs>
+     9cd:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     9d5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     9da:	75 6d                	jne    a49 <getbuf+0xb1>
+     9dc:	bf 08 02 00 00       	mov    $0x208,%edi
+     9e1:	e8 bd 13 00 00       	call   1da3 <malloc>
+     9e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     9ea:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     9ef:	74 58                	je     a49 <getbuf+0xb1>
+    b->n = 0;
+     9f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9f5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     9fb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     9ff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a02:	48 89 d6             	mov    %rdx,%rsi
+     a05:	89 c7                	mov    %eax,%edi
+     a07:	e8 e4 0d 00 00       	call   17f0 <fstat>
+     a0c:	85 c0                	test   %eax,%eax
+     a0e:	75 11                	jne    a21 <getbuf+0x89>
+     a10:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     a14:	66 83 f8 03          	cmp    $0x3,%ax
+     a18:	75 07                	jne    a21 <getbuf+0x89>
+     a1a:	ba 01 00 00 00       	mov    $0x1,%edx
+     a1f:	eb 05                	jmp    a26 <getbuf+0x8e>
+     a21:	ba 00 00 00 00       	mov    $0x0,%edx
+     a26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a2a:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     a2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     a30:	48 98                	cltq
+     a32:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     a39:	00 
+     a3a:	48 8d 15 5f 36 00 00 	lea    0x365f(%rip),%rdx        # 40a0 <obufs>
+     a41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a45:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     a49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     a4d:	c9                   	leave
+     a4e:	c3                   	ret
+
+0000000000000a4f <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     a4f:	55                   	push   %rbp
+     a50:	48 89 e5             	mov    %rsp,%rbp
+     a53:	48 83 ec 20          	sub    $0x20,%rsp
+     a57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     a5a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     a5e:	78 33                	js     a93 <bflush+0x44>
+     a60:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     a64:	7f 2d                	jg     a93 <bflush+0x44>
+     a66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a69:	48 98                	cltq
+     a6b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a72:	00 
+     a73:	48 8d 05 26 36 00 00 	lea    0x3626(%rip),%rax        # 40a0 <obufs>
+     a7a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a7e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     a82:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     a87:	74 0a                	je     a93 <bflush+0x44>
+     a89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a8d:	8b 00                	mov    (%rax),%eax
+     a8f:	85 c0                	test   %eax,%eax
+     a91:	75 07                	jne    a9a <bflush+0x4b>
+    return 0;
+     a93:	b8 00 00 00 00       	mov    $0x0,%eax
+     a98:	eb 3c                	jmp    ad6 <bflush+0x87>
+  n = b->n;
+     a9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a9e:	8b 00                	mov    (%rax),%eax
+     aa0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     aa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aa7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     aad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ab1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     ab5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     ab8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     abb:	48 89 ce             	mov    %rcx,%rsi
+     abe:	89 c7                	mov    %eax,%edi
+     ac0:	e8 de 0c 00 00       	call   17a3 <write>
+     ac5:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     ac8:	75 07                	jne    ad1 <bflush+0x82>
+     aca:	b8 00 00 00 00       	mov    $0x0,%eax
+     acf:	eb 05                	jmp    ad6 <bflush+0x87>
+     ad1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     ad6:	c9                   	leave
+     ad7:	c3                   	ret
+
+0000000000000ad8 <bflushall>:
+
+void bflushall(void) {
+     ad8:	55                   	push   %rbp
+     ad9:	48 89 e5             	mov    %rsp,%rbp
+     adc:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     ae0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ae7:	eb 0e                	jmp    af7 <bflushall+0x1f>
+    bflush(fd);
+     ae9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aec:	89 c7                	mov    %eax,%edi
+     aee:	e8 5c ff ff ff       	call   a4f <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     af3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     af7:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     afb:	7e ec                	jle    ae9 <bflushall+0x11>
+}
+     afd:	90                   	nop
+     afe:	90                   	nop
+     aff:	c9                   	leave
+     b00:	c3                   	ret
+
+0000000000000b01 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     b01:	55                   	push   %rbp
+     b02:	48 89 e5             	mov    %rsp,%rbp
+     b05:	48 83 ec 30          	sub    $0x30,%rsp
+     b09:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     b0c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     b10:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     b13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     b16:	89 c7                	mov    %eax,%edi
+     b18:	e8 7b fe ff ff       	call   998 <getbuf>
+     b1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     b21:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     b26:	75 19                	jne    b41 <bwrite+0x40>
+    return write(fd, s, n);
+     b28:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     b2b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     b2f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     b32:	48 89 ce             	mov    %rcx,%rsi
+     b35:	89 c7                	mov    %eax,%edi
+     b37:	e8 67 0c 00 00       	call   17a3 <write>
+     b3c:	e9 cd 00 00 00       	jmp    c0e <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     b41:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b48:	e9 92 00 00 00       	jmp    bdf <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     b4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b51:	8b 00                	mov    (%rax),%eax
+     b53:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b58:	75 18                	jne    b72 <bwrite+0x71>
+     b5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     b5d:	89 c7                	mov    %eax,%edi
+     b5f:	e8 eb fe ff ff       	call   a4f <bflush>
+     b64:	85 c0                	test   %eax,%eax
+     b66:	79 0a                	jns    b72 <bwrite+0x71>
+      return -1;
+     b68:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b6d:	e9 9c 00 00 00       	jmp    c0e <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     b72:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     b75:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     b78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     b7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b7f:	8b 00                	mov    (%rax),%eax
+     b81:	ba 00 02 00 00       	mov    $0x200,%edx
+     b86:	29 c2                	sub    %eax,%edx
+     b88:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     b8b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     b8e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     b91:	39 c2                	cmp    %eax,%edx
+     b93:	0f 4e c2             	cmovle %edx,%eax
+     b96:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     b99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b9c:	48 63 d0             	movslq %eax,%rdx
+     b9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     ba3:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     ba7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     baf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bb3:	8b 00                	mov    (%rax),%eax
+     bb5:	48 98                	cltq
+     bb7:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     bbb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     bbe:	89 c2                	mov    %eax,%edx
+     bc0:	48 89 cf             	mov    %rcx,%rdi
+     bc3:	e8 e9 06 00 00       	call   12b1 <memmove>
+    b->n += m;
+     bc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bcc:	8b 10                	mov    (%rax),%edx
+     bce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     bd1:	01 c2                	add    %eax,%edx
+     bd3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bd7:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     bd9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     bdc:	01 45 fc             	add    %eax,-0x4(%rbp)
+     bdf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     be2:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     be5:	0f 8c 62 ff ff ff    	jl     b4d <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     beb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bef:	8b 40 04             	mov    0x4(%rax),%eax
+     bf2:	85 c0                	test   %eax,%eax
+     bf4:	74 15                	je     c0b <bwrite+0x10a>
+     bf6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     bf9:	89 c7                	mov    %eax,%edi
+     bfb:	e8 4f fe ff ff       	call   a4f <bflush>
+     c00:	85 c0                	test   %eax,%eax
+     c02:	79 07                	jns    c0b <bwrite+0x10a>
+    return -1;
+     c04:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c09:	eb 03                	jmp    c0e <bwrite+0x10d>
+  return n;
+     c0b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     c0e:	c9                   	leave
+     c0f:	c3                   	ret
+
+0000000000000c10 <bputc>:
+
+void bputc(int fd, char c) {
+     c10:	55                   	push   %rbp
+     c11:	48 89 e5             	mov    %rsp,%rbp
+     c14:	48 83 ec 20          	sub    $0x20,%rsp
+     c18:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     c1b:	89 f0                	mov    %esi,%eax
+     c1d:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     c20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c23:	89 c7                	mov    %eax,%edi
+     c25:	e8 6e fd ff ff       	call   998 <getbuf>
+     c2a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     c2e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     c33:	75 18                	jne    c4d <bputc+0x3d>
+    write(fd, &c, 1);
+     c35:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     c39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c3c:	ba 01 00 00 00       	mov    $0x1,%edx
+     c41:	48 89 ce             	mov    %rcx,%rsi
+     c44:	89 c7                	mov    %eax,%edi
+     c46:	e8 58 0b 00 00       	call   17a3 <write>
+    return;
+     c4b:	eb 34                	jmp    c81 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     c4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c51:	8b 00                	mov    (%rax),%eax
+     c53:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c58:	75 0a                	jne    c64 <bputc+0x54>
+    bflush(fd);
+     c5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     c5d:	89 c7                	mov    %eax,%edi
+     c5f:	e8 eb fd ff ff       	call   a4f <bflush>
+  b->data[b->n++] = c;
+     c64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c68:	8b 00                	mov    (%rax),%eax
+     c6a:	8d 48 01             	lea    0x1(%rax),%ecx
+     c6d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     c71:	89 0a                	mov    %ecx,(%rdx)
+     c73:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     c77:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     c7b:	48 98                	cltq
+     c7d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     c81:	c9                   	leave
+     c82:	c3                   	ret
+
+0000000000000c83 <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     c83:	55                   	push   %rbp
+     c84:	48 89 e5             	mov    %rsp,%rbp
+     c87:	48 83 ec 10          	sub    $0x10,%rsp
+     c8b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     c8e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c92:	78 4c                	js     ce0 <bflushtty+0x5d>
+     c94:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     c98:	7f 46                	jg     ce0 <bflushtty+0x5d>
+     c9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c9d:	48 98                	cltq
+     c9f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ca6:	00 
+     ca7:	48 8d 05 f2 33 00 00 	lea    0x33f2(%rip),%rax        # 40a0 <obufs>
+     cae:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     cb2:	48 85 c0             	test   %rax,%rax
+     cb5:	74 29                	je     ce0 <bflushtty+0x5d>
+     cb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cba:	48 98                	cltq
+     cbc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     cc3:	00 
+     cc4:	48 8d 05 d5 33 00 00 	lea    0x33d5(%rip),%rax        # 40a0 <obufs>
+     ccb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     ccf:	8b 40 04             	mov    0x4(%rax),%eax
+     cd2:	85 c0                	test   %eax,%eax
+     cd4:	74 0a                	je     ce0 <bflushtty+0x5d>
+    bflush(fd);
+     cd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cd9:	89 c7                	mov    %eax,%edi
+     cdb:	e8 6f fd ff ff       	call   a4f <bflush>
+}
+     ce0:	90                   	nop
+     ce1:	c9                   	leave
+     ce2:	c3                   	ret
+
+0000000000000ce3 <fork>:
+
+int fork(void) {
+     ce3:	55                   	push   %rbp
+     ce4:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     ce7:	e8 ec fd ff ff       	call   ad8 <bflushall>
+  return _fork();
+     cec:	e8 7b 0a 00 00       	call   176c <_fork>
+}
+     cf1:	5d                   	pop    %rbp
+     cf2:	c3                   	ret
+
+0000000000000cf3 <exit>:
+
+noreturn void exit(void) {
+     cf3:	55                   	push   %rbp
+     cf4:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     cf7:	e8 dc fd ff ff       	call   ad8 <bflushall>
+  _exit();
+     cfc:	e8 76 0a 00 00       	call   1777 <_exit>
+
+0000000000000d01 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     d01:	55                   	push   %rbp
+     d02:	48 89 e5             	mov    %rsp,%rbp
+     d05:	48 83 ec 10          	sub    $0x10,%rsp
+     d09:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d0d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     d11:	e8 c2 fd ff ff       	call   ad8 <bflushall>
+  return _exec(path, argv);
+     d16:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d1e:	48 89 d6             	mov    %rdx,%rsi
+     d21:	48 89 c7             	mov    %rax,%rdi
+     d24:	e8 9b 0a 00 00       	call   17c4 <_exec>
+}
+     d29:	c9                   	leave
+     d2a:	c3                   	ret
+
+0000000000000d2b <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     d2b:	55                   	push   %rbp
+     d2c:	48 89 e5             	mov    %rsp,%rbp
+     d2f:	48 83 ec 20          	sub    $0x20,%rsp
+     d33:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d37:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     d3b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     d3f:	e8 94 fd ff ff       	call   ad8 <bflushall>
+  return _spawn(path, argv, fds);
+     d44:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     d48:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     d4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d50:	48 89 ce             	mov    %rcx,%rsi
+     d53:	48 89 c7             	mov    %rax,%rdi
+     d56:	e8 2f 0b 00 00       	call   188a <_spawn>
+}
+     d5b:	c9                   	leave
+     d5c:	c3                   	ret
+
+0000000000000d5d <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     d5d:	55                   	push   %rbp
+     d5e:	48 89 e5             	mov    %rsp,%rbp
+     d61:	48 83 ec 10          	sub    $0x10,%rsp
+     d65:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     d68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d6c:	78 69                	js     dd7 <close+0x7a>
+     d6e:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     d72:	7f 63                	jg     dd7 <close+0x7a>
+     d74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d77:	48 98                	cltq
+     d79:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     d80:	00 
+     d81:	48 8d 05 18 33 00 00 	lea    0x3318(%rip),%rax        # 40a0 <obufs>
+     d88:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     d8c:	48 85 c0             	test   %rax,%rax
+     d8f:	74 46                	je     dd7 <close+0x7a>
+    bflush(fd);
+     d91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d94:	89 c7                	mov    %eax,%edi
+     d96:	e8 b4 fc ff ff       	call   a4f <bflush>
+    free(obufs[fd]);
+     d9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d9e:	48 98                	cltq
+     da0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     da7:	00 
+     da8:	48 8d 05 f1 32 00 00 	lea    0x32f1(%rip),%rax        # 40a0 <obufs>
+     daf:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     db3:	48 89 c7             	mov    %rax,%rdi
+     db6:	e8 90 11 00 00       	call   1f4b <free>
+    obufs[fd] = 0;
+     dbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dbe:	48 98                	cltq
+     dc0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     dc7:	00 
+     dc8:	48 8d 05 d1 32 00 00 	lea    0x32d1(%rip),%rax        # 40a0 <obufs>
+     dcf:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     dd6:	00 
+  }
+  return _close(fd);
+     dd7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dda:	89 c7                	mov    %eax,%edi
+     ddc:	e8 cd 09 00 00       	call   17ae <_close>
+}
+     de1:	c9                   	leave
+     de2:	c3                   	ret
+
+0000000000000de3 <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     de3:	55                   	push   %rbp
+     de4:	48 89 e5             	mov    %rsp,%rbp
+     de7:	53                   	push   %rbx
+     de8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     dec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     df0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     df4:	48 8b 36             	mov    (%rsi),%rsi
+     df7:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     dfb:	48 29 f7             	sub    %rsi,%rdi
+     dfe:	48 89 f9             	mov    %rdi,%rcx
+     e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e06:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     e0a:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     e0e:	48 89 f0             	mov    %rsi,%rax
+     e11:	ba 00 00 00 00       	mov    $0x0,%edx
+     e16:	48 89 df             	mov    %rbx,%rdi
+     e19:	48 0f af f8          	imul   %rax,%rdi
+     e1d:	48 89 d6             	mov    %rdx,%rsi
+     e20:	48 0f af f1          	imul   %rcx,%rsi
+     e24:	48 01 fe             	add    %rdi,%rsi
+     e27:	48 f7 e1             	mul    %rcx
+     e2a:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     e2e:	48 89 ca             	mov    %rcx,%rdx
+     e31:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     e36:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     e3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     e3e:	c9                   	leave
+     e3f:	c3                   	ret
+
+0000000000000e40 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     e40:	55                   	push   %rbp
+     e41:	48 89 e5             	mov    %rsp,%rbp
+     e44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e48:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     e4b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     e4e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     e52:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     e55:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e58:	48 89 ce             	mov    %rcx,%rsi
+     e5b:	48 89 f7             	mov    %rsi,%rdi
+     e5e:	89 d1                	mov    %edx,%ecx
+     e60:	fc                   	cld
+     e61:	f3 aa                	rep stos %al,%es:(%rdi)
+     e63:	89 ca                	mov    %ecx,%edx
+     e65:	48 89 fe             	mov    %rdi,%rsi
+     e68:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     e6c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     e6f:	90                   	nop
+     e70:	5d                   	pop    %rbp
+     e71:	c3                   	ret
+
+0000000000000e72 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     e72:	55                   	push   %rbp
+     e73:	48 89 e5             	mov    %rsp,%rbp
+     e76:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e7a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     e7e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     e82:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     e86:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     e8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e8e:	48 89 ce             	mov    %rcx,%rsi
+     e91:	48 89 f7             	mov    %rsi,%rdi
+     e94:	48 89 d1             	mov    %rdx,%rcx
+     e97:	fc                   	cld
+     e98:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     e9b:	48 89 ca             	mov    %rcx,%rdx
+     e9e:	48 89 fe             	mov    %rdi,%rsi
+     ea1:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     ea5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     ea9:	90                   	nop
+     eaa:	5d                   	pop    %rbp
+     eab:	c3                   	ret
+
+0000000000000eac <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     eac:	55                   	push   %rbp
+     ead:	48 89 e5             	mov    %rsp,%rbp
+     eb0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     eb4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     eb8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     ebc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ec0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ec4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ec8:	48 89 cf             	mov    %rcx,%rdi
+     ecb:	48 89 d6             	mov    %rdx,%rsi
+     ece:	48 89 c1             	mov    %rax,%rcx
+     ed1:	fc                   	cld
+     ed2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     ed4:	48 89 c8             	mov    %rcx,%rax
+     ed7:	48 89 f2             	mov    %rsi,%rdx
+     eda:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ede:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     ee2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     ee6:	90                   	nop
+     ee7:	5d                   	pop    %rbp
+     ee8:	c3                   	ret
+
+0000000000000ee9 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     ee9:	55                   	push   %rbp
+     eea:	48 89 e5             	mov    %rsp,%rbp
+     eed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ef1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     ef5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     ef9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     efd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f05:	48 89 cf             	mov    %rcx,%rdi
+     f08:	48 89 d6             	mov    %rdx,%rsi
+     f0b:	48 89 c1             	mov    %rax,%rcx
+     f0e:	fc                   	cld
+     f0f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     f12:	48 89 c8             	mov    %rcx,%rax
+     f15:	48 89 f2             	mov    %rsi,%rdx
+     f18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f1c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     f20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     f24:	90                   	nop
+     f25:	5d                   	pop    %rbp
+     f26:	c3                   	ret
+
+0000000000000f27 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     f27:	55                   	push   %rbp
+     f28:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     f2b:	0f 31                	rdtsc
+     f2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     f30:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     f33:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f36:	48 c1 e0 20          	shl    $0x20,%rax
+     f3a:	48 89 c2             	mov    %rax,%rdx
+     f3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f40:	48 09 d0             	or     %rdx,%rax
+}
+     f43:	5d                   	pop    %rbp
+     f44:	c3                   	ret
+
+0000000000000f45 <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     f45:	55                   	push   %rbp
+     f46:	48 89 e5             	mov    %rsp,%rbp
+     f49:	53                   	push   %rbx
+     f4a:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     f4d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     f51:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     f55:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     f59:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     f5d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     f60:	0f a2                	cpuid
+     f62:	89 de                	mov    %ebx,%esi
+     f64:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     f67:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     f6a:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     f6d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     f70:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     f75:	74 09                	je     f80 <cpuid+0x3b>
+    *eaxp = eax;
+     f77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     f7b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     f7e:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     f80:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     f85:	74 09                	je     f90 <cpuid+0x4b>
+    *ebxp = ebx;
+     f87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     f8b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     f8e:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     f90:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     f95:	74 09                	je     fa0 <cpuid+0x5b>
+    *ecxp = ecx;
+     f97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f9b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f9e:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     fa0:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     fa5:	74 09                	je     fb0 <cpuid+0x6b>
+    *edxp = edx;
+     fa7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     fab:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     fae:	89 10                	mov    %edx,(%rax)
+}
+     fb0:	90                   	nop
+     fb1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     fb5:	c9                   	leave
+     fb6:	c3                   	ret
+
+0000000000000fb7 <strcpy>:
+char *strcpy(char *s, char *t) {
+     fb7:	55                   	push   %rbp
+     fb8:	48 89 e5             	mov    %rsp,%rbp
+     fbb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     fbf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     fc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     fcb:	90                   	nop
+     fcc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     fd0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     fd4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     fd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fdc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     fe0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     fe4:	0f b6 12             	movzbl (%rdx),%edx
+     fe7:	88 10                	mov    %dl,(%rax)
+     fe9:	0f b6 00             	movzbl (%rax),%eax
+     fec:	84 c0                	test   %al,%al
+     fee:	75 dc                	jne    fcc <strcpy+0x15>
+  return os;
+     ff0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     ff4:	5d                   	pop    %rbp
+     ff5:	c3                   	ret
+
+0000000000000ff6 <strcmp>:
+int strcmp(const char *p, const char *q) {
+     ff6:	55                   	push   %rbp
+     ff7:	48 89 e5             	mov    %rsp,%rbp
+     ffa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ffe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+    1002:	eb 0a                	jmp    100e <strcmp+0x18>
+    p++, q++;
+    1004:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1009:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+    100e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1012:	0f b6 00             	movzbl (%rax),%eax
+    1015:	84 c0                	test   %al,%al
+    1017:	74 12                	je     102b <strcmp+0x35>
+    1019:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    101d:	0f b6 10             	movzbl (%rax),%edx
+    1020:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1024:	0f b6 00             	movzbl (%rax),%eax
+    1027:	38 c2                	cmp    %al,%dl
+    1029:	74 d9                	je     1004 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    102b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    102f:	0f b6 00             	movzbl (%rax),%eax
+    1032:	0f b6 d0             	movzbl %al,%edx
+    1035:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1039:	0f b6 00             	movzbl (%rax),%eax
+    103c:	0f b6 c0             	movzbl %al,%eax
+    103f:	29 c2                	sub    %eax,%edx
+    1041:	89 d0                	mov    %edx,%eax
+}
+    1043:	5d                   	pop    %rbp
+    1044:	c3                   	ret
+
+0000000000001045 <strlen>:
+uint strlen(char *s) {
+    1045:	55                   	push   %rbp
+    1046:	48 89 e5             	mov    %rsp,%rbp
+    1049:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+    104d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1054:	eb 04                	jmp    105a <strlen+0x15>
+    1056:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    105a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    105d:	48 63 d0             	movslq %eax,%rdx
+    1060:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1064:	48 01 d0             	add    %rdx,%rax
+    1067:	0f b6 00             	movzbl (%rax),%eax
+    106a:	84 c0                	test   %al,%al
+    106c:	75 e8                	jne    1056 <strlen+0x11>
+    ;
+  return n;
+    106e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1071:	5d                   	pop    %rbp
+    1072:	c3                   	ret
+
+0000000000001073 <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+    1073:	55                   	push   %rbp
+    1074:	48 89 e5             	mov    %rsp,%rbp
+    1077:	53                   	push   %rbx
+    1078:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    107c:	8b 05 02 20 00 00    	mov    0x2002(%rip),%eax        # 3084 <erms>
+    1082:	85 c0                	test   %eax,%eax
+    1084:	79 53                	jns    10d9 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+    1086:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    108a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    1090:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1095:	ba 00 00 00 00       	mov    $0x0,%edx
+    109a:	48 89 c6             	mov    %rax,%rsi
+    109d:	bf 00 00 00 00       	mov    $0x0,%edi
+    10a2:	e8 9e fe ff ff       	call   f45 <cpuid>
+    ebx = 0;
+    10a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+    10ae:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    10b1:	83 f8 06             	cmp    $0x6,%eax
+    10b4:	76 14                	jbe    10ca <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    10b6:	b8 07 00 00 00       	mov    $0x7,%eax
+    10bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    10c0:	0f a2                	cpuid
+    10c2:	89 d9                	mov    %ebx,%ecx
+    10c4:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+    10c7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+    10ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    10cd:	c1 e8 09             	shr    $0x9,%eax
+    10d0:	83 e0 01             	and    $0x1,%eax
+    10d3:	89 05 ab 1f 00 00    	mov    %eax,0x1fab(%rip)        # 3084 <erms>
+  }
+  return erms;
+    10d9:	8b 05 a5 1f 00 00    	mov    0x1fa5(%rip),%eax        # 3084 <erms>
+}
+    10df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+    10e3:	c9                   	leave
+    10e4:	c3                   	ret
+
+00000000000010e5 <memset>:
+
+void *memset(void *dst, int c, uint n) {
+    10e5:	55                   	push   %rbp
+    10e6:	48 89 e5             	mov    %rsp,%rbp
+    10e9:	48 83 ec 10          	sub    $0x10,%rsp
+    10ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    10f1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    10f4:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+    10f7:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+    10fb:	76 09                	jbe    1106 <memset+0x21>
+    10fd:	e8 71 ff ff ff       	call   1073 <haserms>
+    1102:	85 c0                	test   %eax,%eax
+    1104:	74 16                	je     111c <memset+0x37>
+    stosb(dst, c, n);
+    1106:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1109:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    110c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1110:	89 ce                	mov    %ecx,%esi
+    1112:	48 89 c7             	mov    %rax,%rdi
+    1115:	e8 26 fd ff ff       	call   e40 <stosb>
+    111a:	eb 58                	jmp    1174 <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    111c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    111f:	c1 e8 03             	shr    $0x3,%eax
+    1122:	89 c6                	mov    %eax,%esi
+    1124:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1127:	48 98                	cltq
+    1129:	0f b6 c0             	movzbl %al,%eax
+    112c:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+    1133:	01 01 01 
+    1136:	48 0f af c2          	imul   %rdx,%rax
+    113a:	48 89 c1             	mov    %rax,%rcx
+    113d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1141:	48 89 f2             	mov    %rsi,%rdx
+    1144:	48 89 ce             	mov    %rcx,%rsi
+    1147:	48 89 c7             	mov    %rax,%rdi
+    114a:	e8 23 fd ff ff       	call   e72 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+    114f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1152:	83 e0 07             	and    $0x7,%eax
+    1155:	89 c2                	mov    %eax,%edx
+    1157:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    115a:	83 e0 f8             	and    $0xfffffff8,%eax
+    115d:	48 89 c1             	mov    %rax,%rcx
+    1160:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1164:	48 01 c1             	add    %rax,%rcx
+    1167:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    116a:	89 c6                	mov    %eax,%esi
+    116c:	48 89 cf             	mov    %rcx,%rdi
+    116f:	e8 cc fc ff ff       	call   e40 <stosb>
+  }
+  return dst;
+    1174:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1178:	c9                   	leave
+    1179:	c3                   	ret
+
+000000000000117a <strchr>:
+
+char *strchr(const char *s, char c) {
+    117a:	55                   	push   %rbp
+    117b:	48 89 e5             	mov    %rsp,%rbp
+    117e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1182:	89 f0                	mov    %esi,%eax
+    1184:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+    1187:	eb 17                	jmp    11a0 <strchr+0x26>
+    if (*s == c)
+    1189:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    118d:	0f b6 00             	movzbl (%rax),%eax
+    1190:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1193:	75 06                	jne    119b <strchr+0x21>
+      return (char *)s;
+    1195:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1199:	eb 15                	jmp    11b0 <strchr+0x36>
+  for (; *s; s++)
+    119b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    11a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11a4:	0f b6 00             	movzbl (%rax),%eax
+    11a7:	84 c0                	test   %al,%al
+    11a9:	75 de                	jne    1189 <strchr+0xf>
+  return 0;
+    11ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11b0:	5d                   	pop    %rbp
+    11b1:	c3                   	ret
+
+00000000000011b2 <gets>:
+
+char *gets(char *buf, int max) {
+    11b2:	55                   	push   %rbp
+    11b3:	48 89 e5             	mov    %rsp,%rbp
+    11b6:	48 83 ec 20          	sub    $0x20,%rsp
+    11ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11be:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+    11c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    11c8:	eb 48                	jmp    1212 <gets+0x60>
+    cc = read(0, &c, 1);
+    11ca:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    11ce:	ba 01 00 00 00       	mov    $0x1,%edx
+    11d3:	48 89 c6             	mov    %rax,%rsi
+    11d6:	bf 00 00 00 00       	mov    $0x0,%edi
+    11db:	e8 b8 05 00 00       	call   1798 <read>
+    11e0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+    11e3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    11e7:	7e 36                	jle    121f <gets+0x6d>
+      break;
+    buf[i++] = c;
+    11e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11ec:	8d 50 01             	lea    0x1(%rax),%edx
+    11ef:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    11f2:	48 63 d0             	movslq %eax,%rdx
+    11f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11f9:	48 01 c2             	add    %rax,%rdx
+    11fc:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1200:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+    1202:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1206:	3c 0a                	cmp    $0xa,%al
+    1208:	74 16                	je     1220 <gets+0x6e>
+    120a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    120e:	3c 0d                	cmp    $0xd,%al
+    1210:	74 0e                	je     1220 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+    1212:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1215:	83 c0 01             	add    $0x1,%eax
+    1218:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    121b:	7f ad                	jg     11ca <gets+0x18>
+    121d:	eb 01                	jmp    1220 <gets+0x6e>
+      break;
+    121f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1223:	48 63 d0             	movslq %eax,%rdx
+    1226:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    122a:	48 01 d0             	add    %rdx,%rax
+    122d:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1230:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1234:	c9                   	leave
+    1235:	c3                   	ret
+
+0000000000001236 <stat>:
+
+int stat(char *n, struct stat *st) {
+    1236:	55                   	push   %rbp
+    1237:	48 89 e5             	mov    %rsp,%rbp
+    123a:	48 83 ec 10          	sub    $0x10,%rsp
+    123e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1242:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+    1246:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    124a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    124e:	48 89 c6             	mov    %rax,%rsi
+    1251:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+    1256:	e8 58 07 00 00       	call   19b3 <fstatat>
+}
+    125b:	c9                   	leave
+    125c:	c3                   	ret
+
+000000000000125d <atoi>:
+
+int atoi(const char *s) {
+    125d:	55                   	push   %rbp
+    125e:	48 89 e5             	mov    %rsp,%rbp
+    1261:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1265:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    126c:	eb 28                	jmp    1296 <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+    126e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1271:	89 d0                	mov    %edx,%eax
+    1273:	c1 e0 02             	shl    $0x2,%eax
+    1276:	01 d0                	add    %edx,%eax
+    1278:	01 c0                	add    %eax,%eax
+    127a:	89 c1                	mov    %eax,%ecx
+    127c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1280:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1284:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1288:	0f b6 00             	movzbl (%rax),%eax
+    128b:	0f be c0             	movsbl %al,%eax
+    128e:	01 c8                	add    %ecx,%eax
+    1290:	83 e8 30             	sub    $0x30,%eax
+    1293:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+    1296:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    129a:	0f b6 00             	movzbl (%rax),%eax
+    129d:	3c 2f                	cmp    $0x2f,%al
+    129f:	7e 0b                	jle    12ac <atoi+0x4f>
+    12a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12a5:	0f b6 00             	movzbl (%rax),%eax
+    12a8:	3c 39                	cmp    $0x39,%al
+    12aa:	7e c2                	jle    126e <atoi+0x11>
+  return n;
+    12ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    12af:	5d                   	pop    %rbp
+    12b0:	c3                   	ret
+
+00000000000012b1 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+    12b1:	55                   	push   %rbp
+    12b2:	48 89 e5             	mov    %rsp,%rbp
+    12b5:	48 83 ec 28          	sub    $0x28,%rsp
+    12b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    12c1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    12c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    12cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+    12d4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    12d8:	7f 09                	jg     12e3 <memmove+0x32>
+    return vdst;
+    12da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12de:	e9 29 01 00 00       	jmp    140c <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+    12e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12e7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+    12eb:	0f 83 87 00 00 00    	jae    1378 <memmove+0xc7>
+    12f1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    12f4:	48 63 d0             	movslq %eax,%rdx
+    12f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12fb:	48 01 d0             	add    %rdx,%rax
+    12fe:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1302:	73 74                	jae    1378 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    1304:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1307:	48 98                	cltq
+    1309:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    130d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1310:	48 98                	cltq
+    1312:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    1316:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    131a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    131e:	48 09 d0             	or     %rdx,%rax
+    1321:	83 e0 07             	and    $0x7,%eax
+    1324:	48 85 c0             	test   %rax,%rax
+    1327:	75 3d                	jne    1366 <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1329:	eb 1c                	jmp    1347 <memmove+0x96>
+        src -= 8;
+    132b:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1330:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    1335:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1339:	48 8b 10             	mov    (%rax),%rdx
+    133c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1340:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    1343:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1347:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    134b:	7f de                	jg     132b <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    134d:	eb 17                	jmp    1366 <memmove+0xb5>
+      *--dst = *--src;
+    134f:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    1354:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    135d:	0f b6 10             	movzbl (%rax),%edx
+    1360:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1364:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    1366:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1369:	8d 50 ff             	lea    -0x1(%rax),%edx
+    136c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    136f:	85 c0                	test   %eax,%eax
+    1371:	7f dc                	jg     134f <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    1373:	e9 90 00 00 00       	jmp    1408 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1378:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    137c:	7e 09                	jle    1387 <memmove+0xd6>
+    137e:	e8 f0 fc ff ff       	call   1073 <haserms>
+    1383:	85 c0                	test   %eax,%eax
+    1385:	74 1b                	je     13a2 <memmove+0xf1>
+    movsb(dst, src, n);
+    1387:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    138a:	48 63 d0             	movslq %eax,%rdx
+    138d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1395:	48 89 ce             	mov    %rcx,%rsi
+    1398:	48 89 c7             	mov    %rax,%rdi
+    139b:	e8 0c fb ff ff       	call   eac <movsb>
+    13a0:	eb 66                	jmp    1408 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    13a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    13a5:	8d 50 07             	lea    0x7(%rax),%edx
+    13a8:	85 c0                	test   %eax,%eax
+    13aa:	0f 48 c2             	cmovs  %edx,%eax
+    13ad:	c1 f8 03             	sar    $0x3,%eax
+    13b0:	48 63 d0             	movslq %eax,%rdx
+    13b3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    13b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13bb:	48 89 ce             	mov    %rcx,%rsi
+    13be:	48 89 c7             	mov    %rax,%rdi
+    13c1:	e8 23 fb ff ff       	call   ee9 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    13c6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    13c9:	89 d0                	mov    %edx,%eax
+    13cb:	c1 f8 1f             	sar    $0x1f,%eax
+    13ce:	c1 e8 1d             	shr    $0x1d,%eax
+    13d1:	01 c2                	add    %eax,%edx
+    13d3:	83 e2 07             	and    $0x7,%edx
+    13d6:	29 c2                	sub    %eax,%edx
+    13d8:	89 d0                	mov    %edx,%eax
+    13da:	48 98                	cltq
+    13dc:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    13df:	83 e2 f8             	and    $0xfffffff8,%edx
+    13e2:	48 63 ca             	movslq %edx,%rcx
+    13e5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    13e9:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    13ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    13f0:	83 e2 f8             	and    $0xfffffff8,%edx
+    13f3:	48 63 ca             	movslq %edx,%rcx
+    13f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    13fa:	48 01 d1             	add    %rdx,%rcx
+    13fd:	48 89 c2             	mov    %rax,%rdx
+    1400:	48 89 cf             	mov    %rcx,%rdi
+    1403:	e8 a4 fa ff ff       	call   eac <movsb>
+  }
+  return vdst;
+    1408:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    140c:	c9                   	leave
+    140d:	c3                   	ret
+
+000000000000140e <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    140e:	55                   	push   %rbp
+    140f:	48 89 e5             	mov    %rsp,%rbp
+    1412:	48 83 ec 20          	sub    $0x20,%rsp
+    1416:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1419:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    141d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    1424:	00 00 00 
+    1427:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    142b:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    142f:	75 0d                	jne    143e <clock_gettime+0x30>
+    1431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1435:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1439:	48 85 c0             	test   %rax,%rax
+    143c:	75 13                	jne    1451 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    143e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1442:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1445:	48 89 d6             	mov    %rdx,%rsi
+    1448:	89 c7                	mov    %eax,%edi
+    144a:	e8 e0 04 00 00       	call   192f <_clock_gettime>
+    144f:	eb 7d                	jmp    14ce <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    1451:	e8 d1 fa ff ff       	call   f27 <rdtsc>
+    1456:	48 89 c2             	mov    %rax,%rdx
+    1459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    145d:	48 89 d6             	mov    %rdx,%rsi
+    1460:	48 89 c7             	mov    %rax,%rdi
+    1463:	e8 7b f9 ff ff       	call   de3 <clockns>
+    1468:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    146c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1470:	48 c1 e8 09          	shr    $0x9,%rax
+    1474:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    147b:	b8 44 00 
+    147e:	48 f7 e2             	mul    %rdx
+    1481:	48 89 d0             	mov    %rdx,%rax
+    1484:	48 c1 e8 0b          	shr    $0xb,%rax
+    1488:	48 89 c2             	mov    %rax,%rdx
+    148b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    148f:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    1492:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    1496:	48 89 c8             	mov    %rcx,%rax
+    1499:	48 c1 e8 09          	shr    $0x9,%rax
+    149d:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    14a4:	b8 44 00 
+    14a7:	48 f7 e2             	mul    %rdx
+    14aa:	48 89 d0             	mov    %rdx,%rax
+    14ad:	48 c1 e8 0b          	shr    $0xb,%rax
+    14b1:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    14b8:	48 89 c8             	mov    %rcx,%rax
+    14bb:	48 29 d0             	sub    %rdx,%rax
+    14be:	48 89 c2             	mov    %rax,%rdx
+    14c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14c5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    14c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    14ce:	c9                   	leave
+    14cf:	c3                   	ret
+
+00000000000014d0 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    14d0:	55                   	push   %rbp
+    14d1:	48 89 e5             	mov    %rsp,%rbp
+    14d4:	48 83 ec 10          	sub    $0x10,%rsp
+    14d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    14dc:	eb 11                	jmp    14ef <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    14de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14e2:	be 02 00 00 00       	mov    $0x2,%esi
+    14e7:	48 89 c7             	mov    %rax,%rdi
+    14ea:	e8 6c 04 00 00       	call   195b <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    14ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    14f3:	b8 02 00 00 00       	mov    $0x2,%eax
+    14f8:	87 02                	xchg   %eax,(%rdx)
+    14fa:	85 c0                	test   %eax,%eax
+    14fc:	75 e0                	jne    14de <mutex_wait+0xe>
+}
+    14fe:	90                   	nop
+    14ff:	90                   	nop
+    1500:	c9                   	leave
+    1501:	c3                   	ret
+
+0000000000001502 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1502:	55                   	push   %rbp
+    1503:	48 89 e5             	mov    %rsp,%rbp
+    1506:	48 83 ec 20          	sub    $0x20,%rsp
+    150a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    150e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    1515:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1519:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    151d:	8b 02                	mov    (%rdx),%eax
+    151f:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1524:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1528:	89 c1                	mov    %eax,%ecx
+    152a:	0f 94 c0             	sete   %al
+    152d:	84 c0                	test   %al,%al
+    152f:	75 02                	jne    1533 <mutex_lock+0x31>
+    1531:	89 0a                	mov    %ecx,(%rdx)
+    1533:	83 f0 01             	xor    $0x1,%eax
+    1536:	84 c0                	test   %al,%al
+    1538:	74 0c                	je     1546 <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    153a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    153e:	48 89 c7             	mov    %rax,%rdi
+    1541:	e8 8a ff ff ff       	call   14d0 <mutex_wait>
+}
+    1546:	90                   	nop
+    1547:	c9                   	leave
+    1548:	c3                   	ret
+
+0000000000001549 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1549:	55                   	push   %rbp
+    154a:	48 89 e5             	mov    %rsp,%rbp
+    154d:	48 83 ec 10          	sub    $0x10,%rsp
+    1551:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    1555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1559:	ba 00 00 00 00       	mov    $0x0,%edx
+    155e:	87 10                	xchg   %edx,(%rax)
+    1560:	83 fa 02             	cmp    $0x2,%edx
+    1563:	75 11                	jne    1576 <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    1565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1569:	be 01 00 00 00       	mov    $0x1,%esi
+    156e:	48 89 c7             	mov    %rax,%rdi
+    1571:	e8 f0 03 00 00       	call   1966 <futex_wake>
+}
+    1576:	90                   	nop
+    1577:	c9                   	leave
+    1578:	c3                   	ret
+
+0000000000001579 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1579:	55                   	push   %rbp
+    157a:	48 89 e5             	mov    %rsp,%rbp
+    157d:	48 83 ec 20          	sub    $0x20,%rsp
+    1581:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1585:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    158d:	48 83 c0 04          	add    $0x4,%rax
+    1591:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    1595:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1599:	8b 00                	mov    (%rax),%eax
+    159b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    159e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15a2:	48 89 c7             	mov    %rax,%rdi
+    15a5:	e8 9f ff ff ff       	call   1549 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    15aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    15b1:	89 d6                	mov    %edx,%esi
+    15b3:	48 89 c7             	mov    %rax,%rdi
+    15b6:	e8 a0 03 00 00       	call   195b <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    15bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15bf:	48 83 c0 04          	add    $0x4,%rax
+    15c3:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    15c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15cb:	48 89 c7             	mov    %rax,%rdi
+    15ce:	e8 fd fe ff ff       	call   14d0 <mutex_wait>
+}
+    15d3:	90                   	nop
+    15d4:	c9                   	leave
+    15d5:	c3                   	ret
+
+00000000000015d6 <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    15d6:	55                   	push   %rbp
+    15d7:	48 89 e5             	mov    %rsp,%rbp
+    15da:	48 83 ec 10          	sub    $0x10,%rsp
+    15de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    15e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e6:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    15ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ee:	48 83 c0 04          	add    $0x4,%rax
+    15f2:	8b 00                	mov    (%rax),%eax
+    15f4:	85 c0                	test   %eax,%eax
+    15f6:	7e 11                	jle    1609 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    15f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15fc:	be 01 00 00 00       	mov    $0x1,%esi
+    1601:	48 89 c7             	mov    %rax,%rdi
+    1604:	e8 5d 03 00 00       	call   1966 <futex_wake>
+}
+    1609:	90                   	nop
+    160a:	c9                   	leave
+    160b:	c3                   	ret
+
+000000000000160c <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    160c:	55                   	push   %rbp
+    160d:	48 89 e5             	mov    %rsp,%rbp
+    1610:	48 83 ec 10          	sub    $0x10,%rsp
+    1614:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1618:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    161c:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1620:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1624:	48 83 c0 04          	add    $0x4,%rax
+    1628:	8b 00                	mov    (%rax),%eax
+    162a:	85 c0                	test   %eax,%eax
+    162c:	7e 11                	jle    163f <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    162e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1632:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1637:	48 89 c7             	mov    %rax,%rdi
+    163a:	e8 27 03 00 00       	call   1966 <futex_wake>
+}
+    163f:	90                   	nop
+    1640:	c9                   	leave
+    1641:	c3                   	ret
+
+0000000000001642 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1642:	55                   	push   %rbp
+    1643:	48 89 e5             	mov    %rsp,%rbp
+    1646:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    164a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    164d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1651:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    1655:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1659:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    165d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1661:	8b 40 04             	mov    0x4(%rax),%eax
+    1664:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1667:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    166b:	8b 00                	mov    (%rax),%eax
+    166d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1670:	29 c2                	sub    %eax,%edx
+    1672:	83 fa 1f             	cmp    $0x1f,%edx
+    1675:	76 07                	jbe    167e <ring_push+0x3c>
+    return -1;
+    1677:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    167c:	eb 7e                	jmp    16fc <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    167e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1681:	83 e0 1f             	and    $0x1f,%eax
+    1684:	89 c2                	mov    %eax,%edx
+    1686:	48 89 d0             	mov    %rdx,%rax
+    1689:	48 01 c0             	add    %rax,%rax
+    168c:	48 01 d0             	add    %rdx,%rax
+    168f:	48 c1 e0 04          	shl    $0x4,%rax
+    1693:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1697:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    169b:	48 01 d0             	add    %rdx,%rax
+    169e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    16a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16a6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    16a9:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    16ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    16b3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    16b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16bb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    16bf:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    16c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    16cb:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    16cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    16d7:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    16db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16df:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    16e3:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    16e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16ea:	8d 50 01             	lea    0x1(%rax),%edx
+    16ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16f1:	48 83 c0 04          	add    $0x4,%rax
+    16f5:	89 10                	mov    %edx,(%rax)
+  return 0;
+    16f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    16fc:	5d                   	pop    %rbp
+    16fd:	c3                   	ret
+
+00000000000016fe <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    16fe:	55                   	push   %rbp
+    16ff:	48 89 e5             	mov    %rsp,%rbp
+    1702:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1706:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    170a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    170e:	8b 40 08             	mov    0x8(%rax),%eax
+    1711:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    1714:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1718:	48 83 c0 0c          	add    $0xc,%rax
+    171c:	8b 00                	mov    (%rax),%eax
+    171e:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1721:	75 07                	jne    172a <ring_pop+0x2c>
+    return -1;
+    1723:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1728:	eb 40                	jmp    176a <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    172a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    172d:	83 e0 1f             	and    $0x1f,%eax
+    1730:	89 c2                	mov    %eax,%edx
+    1732:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    1736:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    173a:	89 d2                	mov    %edx,%edx
+    173c:	48 83 c2 61          	add    $0x61,%rdx
+    1740:	48 c1 e2 04          	shl    $0x4,%rdx
+    1744:	48 01 d0             	add    %rdx,%rax
+    1747:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    174b:	48 8b 00             	mov    (%rax),%rax
+    174e:	48 89 01             	mov    %rax,(%rcx)
+    1751:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    1755:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1758:	8d 50 01             	lea    0x1(%rax),%edx
+    175b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    175f:	48 83 c0 08          	add    $0x8,%rax
+    1763:	89 10                	mov    %edx,(%rax)
+  return 0;
+    1765:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    176a:	5d                   	pop    %rbp
+    176b:	c3                   	ret
+
+000000000000176c <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    176c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1771:	49 89 ca             	mov    %rcx,%r10
+    1774:	0f 05                	syscall
+    1776:	c3                   	ret
+
+0000000000001777 <_exit>:
+SYSCALL_(exit)
+    1777:	b8 02 00 00 00       	mov    $0x2,%eax
+    177c:	49 89 ca             	mov    %rcx,%r10
+    177f:	0f 05                	syscall
+    1781:	c3                   	ret
+
+0000000000001782 <wait>:
+SYSCALL(wait)
+    1782:	b8 03 00 00 00       	mov    $0x3,%eax
+    1787:	49 89 ca             	mov    %rcx,%r10
+    178a:	0f 05                	syscall
+    178c:	c3                   	ret
+
+000000000000178d <pipe>:
+SYSCALL(pipe)
+    178d:	b8 04 00 00 00       	mov    $0x4,%eax
+    1792:	49 89 ca             	mov    %rcx,%r10
+    1795:	0f 05                	syscall
+    1797:	c3                   	ret
+
+0000000000001798 <read>:
+SYSCALL(read)
+    1798:	b8 05 00 00 00       	mov    $0x5,%eax
+    179d:	49 89 ca             	mov    %rcx,%r10
+    17a0:	0f 05                	syscall
+    17a2:	c3                   	ret
+
+00000000000017a3 <write>:
+SYSCALL(write)
+    17a3:	b8 10 00 00 00       	mov    $0x10,%eax
+    17a8:	49 89 ca             	mov    %rcx,%r10
+    17ab:	0f 05                	syscall
+    17ad:	c3                   	ret
+
+00000000000017ae <_close>:
+SYSCALL_(close)
+    17ae:	b8 15 00 00 00       	mov    $0x15,%eax
+    17b3:	49 89 ca             	mov    %rcx,%r10
+    17b6:	0f 05                	syscall
+    17b8:	c3                   	ret
+
+00000000000017b9 <kill>:
+SYSCALL(kill)
+    17b9:	b8 06 00 00 00       	mov    $0x6,%eax
+    17be:	49 89 ca             	mov    %rcx,%r10
+    17c1:	0f 05                	syscall
+    17c3:	c3                   	ret
+
+00000000000017c4 <_exec>:
+SYSCALL_(exec)
+    17c4:	b8 07 00 00 00       	mov    $0x7,%eax
+    17c9:	49 89 ca             	mov    %rcx,%r10
+    17cc:	0f 05                	syscall
+    17ce:	c3                   	ret
+
+00000000000017cf <open>:
+SYSCALL(open)
+    17cf:	b8 0f 00 00 00       	mov    $0xf,%eax
+    17d4:	49 89 ca             	mov    %rcx,%r10
+    17d7:	0f 05                	syscall
+    17d9:	c3                   	ret
+
+00000000000017da <mknod>:
+SYSCALL(mknod)
+    17da:	b8 11 00 00 00       	mov    $0x11,%eax
+    17df:	49 89 ca             	mov    %rcx,%r10
+    17e2:	0f 05                	syscall
+    17e4:	c3                   	ret
+
+00000000000017e5 <unlink>:
+SYSCALL(unlink)
+    17e5:	b8 12 00 00 00       	mov    $0x12,%eax
+    17ea:	49 89 ca             	mov    %rcx,%r10
+    17ed:	0f 05                	syscall
+    17ef:	c3                   	ret
+
+00000000000017f0 <fstat>:
+SYSCALL(fstat)
+    17f0:	b8 08 00 00 00       	mov    $0x8,%eax
+    17f5:	49 89 ca             	mov    %rcx,%r10
+    17f8:	0f 05                	syscall
+    17fa:	c3                   	ret
+
+00000000000017fb <link>:
+SYSCALL(link)
+    17fb:	b8 13 00 00 00       	mov    $0x13,%eax
+    1800:	49 89 ca             	mov    %rcx,%r10
+    1803:	0f 05                	syscall
+    1805:	c3                   	ret
+
+0000000000001806 <mkdir>:
+SYSCALL(mkdir)
+    1806:	b8 14 00 00 00       	mov    $0x14,%eax
+    180b:	49 89 ca             	mov    %rcx,%r10
+    180e:	0f 05                	syscall
+    1810:	c3                   	ret
+
+0000000000001811 <chdir>:
+SYSCALL(chdir)
+    1811:	b8 09 00 00 00       	mov    $0x9,%eax
+    1816:	49 89 ca             	mov    %rcx,%r10
+    1819:	0f 05                	syscall
+    181b:	c3                   	ret
+
+000000000000181c <dup>:
+SYSCALL(dup)
+    181c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1821:	49 89 ca             	mov    %rcx,%r10
+    1824:	0f 05                	syscall
+    1826:	c3                   	ret
+
+0000000000001827 <getpid>:
+SYSCALL(getpid)
+    1827:	b8 0b 00 00 00       	mov    $0xb,%eax
+    182c:	49 89 ca             	mov    %rcx,%r10
+    182f:	0f 05                	syscall
+    1831:	c3                   	ret
+
+0000000000001832 <sbrk>:
+SYSCALL(sbrk)
+    1832:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1837:	49 89 ca             	mov    %rcx,%r10
+    183a:	0f 05                	syscall
+    183c:	c3                   	ret
+
+000000000000183d <sleep>:
+SYSCALL(sleep)
+    183d:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1842:	49 89 ca             	mov    %rcx,%r10
+    1845:	0f 05                	syscall
+    1847:	c3                   	ret
+
+0000000000001848 <uptime>:
+SYSCALL(uptime)
+    1848:	b8 0e 00 00 00       	mov    $0xe,%eax
+    184d:	49 89 ca             	mov    %rcx,%r10
+    1850:	0f 05                	syscall
+    1852:	c3                   	ret
+
+0000000000001853 <sysinfo>:
+SYSCALL(sysinfo)
+    1853:	b8 16 00 00 00       	mov    $0x16,%eax
+    1858:	49 89 ca             	mov    %rcx,%r10
+    185b:	0f 05                	syscall
+    185d:	c3                   	ret
+
+000000000000185e <crashn>:
+SYSCALL(crashn)
+    185e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1863:	49 89 ca             	mov    %rcx,%r10
+    1866:	0f 05                	syscall
+    1868:	c3                   	ret
+
+0000000000001869 <mmap>:
+SYSCALL(mmap)
+    1869:	b8 18 00 00 00       	mov    $0x18,%eax
+    186e:	49 89 ca             	mov    %rcx,%r10
+    1871:	0f 05                	syscall
+    1873:	c3                   	ret
+
+0000000000001874 <munmap>:
+SYSCALL(munmap)
+    1874:	b8 19 00 00 00       	mov    $0x19,%eax
+    1879:	49 89 ca             	mov    %rcx,%r10
+    187c:	0f 05                	syscall
+    187e:	c3                   	ret
+
+000000000000187f <nice>:
+SYSCALL(nice)
+    187f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1884:	49 89 ca             	mov    %rcx,%r10
+    1887:	0f 05                	syscall
+    1889:	c3                   	ret
+
+000000000000188a <_spawn>:
+SYSCALL_(spawn)
+    188a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    188f:	49 89 ca             	mov    %rcx,%r10
+    1892:	0f 05                	syscall
+    1894:	c3                   	ret
+
+0000000000001895 <pread>:
+SYSCALL(pread)
+    1895:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    189a:	49 89 ca             	mov    %rcx,%r10
+    189d:	0f 05                	syscall
+    189f:	c3                   	ret
+
+00000000000018a0 <pwrite>:
+SYSCALL(pwrite)
+    18a0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    18a5:	49 89 ca             	mov    %rcx,%r10
+    18a8:	0f 05                	syscall
+    18aa:	c3                   	ret
+
+00000000000018ab <readv>:
+SYSCALL(readv)
+    18ab:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    18b0:	49 89 ca             	mov    %rcx,%r10
+    18b3:	0f 05                	syscall
+    18b5:	c3                   	ret
+
+00000000000018b6 <writev>:
+SYSCALL(writev)
+    18b6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    18bb:	49 89 ca             	mov    %rcx,%r10
+    18be:	0f 05                	syscall
+    18c0:	c3                   	ret
+
+00000000000018c1 <sendfile>:
+SYSCALL(sendfile)
+    18c1:	b8 20 00 00 00       	mov    $0x20,%eax
+    18c6:	49 89 ca             	mov    %rcx,%r10
+    18c9:	0f 05                	syscall
+    18cb:	c3                   	ret
+
+00000000000018cc <splice>:
+SYSCALL(splice)
+    18cc:	b8 21 00 00 00       	mov    $0x21,%eax
+    18d1:	49 89 ca             	mov    %rcx,%r10
+    18d4:	0f 05                	syscall
+    18d6:	c3                   	ret
+
+00000000000018d7 <poll>:
+SYSCALL(poll)
+    18d7:	b8 22 00 00 00       	mov    $0x22,%eax
+    18dc:	49 89 ca             	mov    %rcx,%r10
+    18df:	0f 05                	syscall
+    18e1:	c3                   	ret
+
+00000000000018e2 <fsync>:
+SYSCALL(fsync)
+    18e2:	b8 23 00 00 00       	mov    $0x23,%eax
+    18e7:	49 89 ca             	mov    %rcx,%r10
+    18ea:	0f 05                	syscall
+    18ec:	c3                   	ret
+
+00000000000018ed <fdatasync>:
+SYSCALL(fdatasync)
+    18ed:	b8 24 00 00 00       	mov    $0x24,%eax
+    18f2:	49 89 ca             	mov    %rcx,%r10
+    18f5:	0f 05                	syscall
+    18f7:	c3                   	ret
+
+00000000000018f8 <lockstat>:
+SYSCALL(lockstat)
+    18f8:	b8 25 00 00 00       	mov    $0x25,%eax
+    18fd:	49 89 ca             	mov    %rcx,%r10
+    1900:	0f 05                	syscall
+    1902:	c3                   	ret
+
+0000000000001903 <syscallstat>:
+SYSCALL(syscallstat)
+    1903:	b8 26 00 00 00       	mov    $0x26,%eax
+    1908:	49 89 ca             	mov    %rcx,%r10
+    190b:	0f 05                	syscall
+    190d:	c3                   	ret
+
+000000000000190e <trace>:
+SYSCALL(trace)
+    190e:	b8 27 00 00 00       	mov    $0x27,%eax
+    1913:	49 89 ca             	mov    %rcx,%r10
+    1916:	0f 05                	syscall
+    1918:	c3                   	ret
+
+0000000000001919 <profile>:
+SYSCALL(profile)
+    1919:	b8 28 00 00 00       	mov    $0x28,%eax
+    191e:	49 89 ca             	mov    %rcx,%r10
+    1921:	0f 05                	syscall
+    1923:	c3                   	ret
+
+0000000000001924 <cycles>:
+SYSCALL(cycles)
+    1924:	b8 29 00 00 00       	mov    $0x29,%eax
+    1929:	49 89 ca             	mov    %rcx,%r10
+    192c:	0f 05                	syscall
+    192e:	c3                   	ret
+
+000000000000192f <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    192f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1934:	49 89 ca             	mov    %rcx,%r10
+    1937:	0f 05                	syscall
+    1939:	c3                   	ret
+
+000000000000193a <consmode>:
+SYSCALL(consmode)
+    193a:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    193f:	49 89 ca             	mov    %rcx,%r10
+    1942:	0f 05                	syscall
+    1944:	c3                   	ret
+
+0000000000001945 <clone>:
+SYSCALL(clone)
+    1945:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    194a:	49 89 ca             	mov    %rcx,%r10
+    194d:	0f 05                	syscall
+    194f:	c3                   	ret
+
+0000000000001950 <join>:
+SYSCALL(join)
+    1950:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1955:	49 89 ca             	mov    %rcx,%r10
+    1958:	0f 05                	syscall
+    195a:	c3                   	ret
+
+000000000000195b <futex_wait>:
+SYSCALL(futex_wait)
+    195b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1960:	49 89 ca             	mov    %rcx,%r10
+    1963:	0f 05                	syscall
+    1965:	c3                   	ret
+
+0000000000001966 <futex_wake>:
+SYSCALL(futex_wake)
+    1966:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    196b:	49 89 ca             	mov    %rcx,%r10
+    196e:	0f 05                	syscall
+    1970:	c3                   	ret
+
+0000000000001971 <shmget>:
+SYSCALL(shmget)
+    1971:	b8 30 00 00 00       	mov    $0x30,%eax
+    1976:	49 89 ca             	mov    %rcx,%r10
+    1979:	0f 05                	syscall
+    197b:	c3                   	ret
+
+000000000000197c <shmat>:
+SYSCALL(shmat)
+    197c:	b8 31 00 00 00       	mov    $0x31,%eax
+    1981:	49 89 ca             	mov    %rcx,%r10
+    1984:	0f 05                	syscall
+    1986:	c3                   	ret
+
+0000000000001987 <shmdt>:
+SYSCALL(shmdt)
+    1987:	b8 32 00 00 00       	mov    $0x32,%eax
+    198c:	49 89 ca             	mov    %rcx,%r10
+    198f:	0f 05                	syscall
+    1991:	c3                   	ret
+
+0000000000001992 <ring_setup>:
+SYSCALL(ring_setup)
+    1992:	b8 33 00 00 00       	mov    $0x33,%eax
+    1997:	49 89 ca             	mov    %rcx,%r10
+    199a:	0f 05                	syscall
+    199c:	c3                   	ret
+
+000000000000199d <ring_enter>:
+SYSCALL(ring_enter)
+    199d:	b8 34 00 00 00       	mov    $0x34,%eax
+    19a2:	49 89 ca             	mov    %rcx,%r10
+    19a5:	0f 05                	syscall
+    19a7:	c3                   	ret
+
+00000000000019a8 <getdents>:
+SYSCALL(getdents)
+    19a8:	b8 35 00 00 00       	mov    $0x35,%eax
+    19ad:	49 89 ca             	mov    %rcx,%r10
+    19b0:	0f 05                	syscall
+    19b2:	c3                   	ret
+
+00000000000019b3 <fstatat>:
+SYSCALL(fstatat)
+    19b3:	b8 36 00 00 00       	mov    $0x36,%eax
+    19b8:	49 89 ca             	mov    %rcx,%r10
+    19bb:	0f 05                	syscall
+    19bd:	c3                   	ret
+
+00000000000019be <clone_file>:
+SYSCALL(clone_file)
+    19be:	b8 37 00 00 00       	mov    $0x37,%eax
+    19c3:	49 89 ca             	mov    %rcx,%r10
+    19c6:	0f 05                	syscall
+    19c8:	c3                   	ret
+
+00000000000019c9 <fpunch>:
+SYSCALL(fpunch)
+    19c9:	b8 38 00 00 00       	mov    $0x38,%eax
+    19ce:	49 89 ca             	mov    %rcx,%r10
+    19d1:	0f 05                	syscall
+    19d3:	c3                   	ret
+
+00000000000019d4 <defrag>:
+SYSCALL(defrag)
+    19d4:	b8 39 00 00 00       	mov    $0x39,%eax
+    19d9:	49 89 ca             	mov    %rcx,%r10
+    19dc:	0f 05                	syscall
+    19de:	c3                   	ret
+
+00000000000019df <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    19df:	55                   	push   %rbp
+    19e0:	48 89 e5             	mov    %rsp,%rbp
+    19e3:	48 83 ec 20          	sub    $0x20,%rsp
+    19e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    19eb:	bf 00 00 00 00       	mov    $0x0,%edi
+    19f0:	e8 3d fe ff ff       	call   1832 <sbrk>
+    19f5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    19f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19fd:	48 f7 d8             	neg    %rax
+    1a00:	25 ff 0f 00 00       	and    $0xfff,%eax
+    1a05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1a09:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1a0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a11:	48 01 c2             	add    %rax,%rdx
+    1a14:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1a19:	48 39 c2             	cmp    %rax,%rdx
+    1a1c:	73 1e                	jae    1a3c <morecore+0x5d>
+    1a1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a22:	89 c2                	mov    %eax,%edx
+    1a24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a28:	01 d0                	add    %edx,%eax
+    1a2a:	89 c7                	mov    %eax,%edi
+    1a2c:	e8 01 fe ff ff       	call   1832 <sbrk>
+    1a31:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a35:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1a3a:	75 07                	jne    1a43 <morecore+0x64>
+    return 0;
+    1a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a41:	eb 27                	jmp    1a6a <morecore+0x8b>
+  stats.heap += n + pad;
+    1a43:	48 8b 05 86 27 00 00 	mov    0x2786(%rip),%rax        # 41d0 <stats+0x50>
+    1a4a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1a4e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a52:	48 01 ca             	add    %rcx,%rdx
+    1a55:	48 01 d0             	add    %rdx,%rax
+    1a58:	48 89 05 71 27 00 00 	mov    %rax,0x2771(%rip)        # 41d0 <stats+0x50>
+  return p + pad;
+    1a5f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    1a63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a67:	48 01 d0             	add    %rdx,%rax
+}
+    1a6a:	c9                   	leave
+    1a6b:	c3                   	ret
+
+0000000000001a6c <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1a6c:	55                   	push   %rbp
+    1a6d:	48 89 e5             	mov    %rsp,%rbp
+    1a70:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    1a74:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1a78:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1a7f:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1a80:	48 8d 05 d9 26 00 00 	lea    0x26d9(%rip),%rax        # 4160 <runs>
+    1a87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a8b:	eb 1a                	jmp    1aa7 <pagefree+0x3b>
+    prev = *rp;
+    1a8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a91:	48 8b 00             	mov    (%rax),%rax
+    1a94:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1a98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a9c:	48 8b 00             	mov    (%rax),%rax
+    1a9f:	48 83 c0 08          	add    $0x8,%rax
+    1aa3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1aa7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aab:	48 8b 00             	mov    (%rax),%rax
+    1aae:	48 85 c0             	test   %rax,%rax
+    1ab1:	74 0d                	je     1ac0 <pagefree+0x54>
+    1ab3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ab7:	48 8b 00             	mov    (%rax),%rax
+    1aba:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    1abe:	72 cd                	jb     1a8d <pagefree+0x21>
+  r = (struct run *)p;
+    1ac0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1ac4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    1ac8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1acc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    1ad0:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    1ad3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad7:	48 8b 10             	mov    (%rax),%rdx
+    1ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ade:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    1ae2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ae6:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1aea:	48 85 c0             	test   %rax,%rax
+    1aed:	74 48                	je     1b37 <pagefree+0xcb>
+    1aef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    1af3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1af7:	48 01 c2             	add    %rax,%rdx
+    1afa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1afe:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b02:	48 39 c2             	cmp    %rax,%rdx
+    1b05:	75 30                	jne    1b37 <pagefree+0xcb>
+    r->size += r->next->size;
+    1b07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b0b:	48 8b 10             	mov    (%rax),%rdx
+    1b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b12:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b16:	48 8b 00             	mov    (%rax),%rax
+    1b19:	48 01 c2             	add    %rax,%rdx
+    1b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b20:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    1b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b27:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1b2b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1b2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b33:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1b37:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1b3c:	74 46                	je     1b84 <pagefree+0x118>
+    1b3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b42:	48 8b 10             	mov    (%rax),%rdx
+    1b45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b49:	48 01 d0             	add    %rdx,%rax
+    1b4c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1b50:	75 32                	jne    1b84 <pagefree+0x118>
+    prev->size += r->size;
+    1b52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b56:	48 8b 10             	mov    (%rax),%rdx
+    1b59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b5d:	48 8b 00             	mov    (%rax),%rax
+    1b60:	48 01 c2             	add    %rax,%rdx
+    1b63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b67:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1b6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b6e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1b72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b76:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1b7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b7e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1b82:	eb 0c                	jmp    1b90 <pagefree+0x124>
+  } else {
+    *rp = r;
+    1b84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b88:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1b8c:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1b8f:	90                   	nop
+    1b90:	90                   	nop
+    1b91:	5d                   	pop    %rbp
+    1b92:	c3                   	ret
+
+0000000000001b93 <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    1b93:	55                   	push   %rbp
+    1b94:	48 89 e5             	mov    %rsp,%rbp
+    1b97:	48 83 ec 40          	sub    $0x40,%rsp
+    1b9b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1b9f:	48 8d 05 ba 25 00 00 	lea    0x25ba(%rip),%rax        # 4160 <runs>
+    1ba6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1baa:	eb 66                	jmp    1c12 <pagealloc+0x7f>
+    if (r->size == n) {
+    1bac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bb0:	48 8b 00             	mov    (%rax),%rax
+    1bb3:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1bb7:	75 18                	jne    1bd1 <pagealloc+0x3e>
+      *rp = r->next;
+    1bb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bbd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1bc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bc5:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    1bc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bcc:	e9 ca 00 00 00       	jmp    1c9b <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    1bd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bd5:	48 8b 00             	mov    (%rax),%rax
+    1bd8:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1bdc:	73 28                	jae    1c06 <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    1bde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1be2:	48 8b 00             	mov    (%rax),%rax
+    1be5:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1be9:	48 89 c2             	mov    %rax,%rdx
+    1bec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf0:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    1bf3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf7:	48 8b 10             	mov    (%rax),%rdx
+    1bfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bfe:	48 01 d0             	add    %rdx,%rax
+    1c01:	e9 95 00 00 00       	jmp    1c9b <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1c06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c0a:	48 83 c0 08          	add    $0x8,%rax
+    1c0e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c16:	48 8b 00             	mov    (%rax),%rax
+    1c19:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1c1d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1c22:	75 88                	jne    1bac <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    1c24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1c28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1c2c:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    1c33:	00 
+    1c34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1c38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1c3c:	48 39 c2             	cmp    %rax,%rdx
+    1c3f:	48 0f 43 c2          	cmovae %rdx,%rax
+    1c43:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1c47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1c4b:	48 89 c7             	mov    %rax,%rdi
+    1c4e:	e8 8c fd ff ff       	call   19df <morecore>
+    1c53:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1c57:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1c5c:	75 07                	jne    1c65 <pagealloc+0xd2>
+    return 0;
+    1c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c63:	eb 36                	jmp    1c9b <pagealloc+0x108>
+  if (m > n)
+    1c65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1c69:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1c6d:	73 1a                	jae    1c89 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1c6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1c73:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1c77:	48 89 c2             	mov    %rax,%rdx
+    1c7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c7e:	48 89 d6             	mov    %rdx,%rsi
+    1c81:	48 89 c7             	mov    %rax,%rdi
+    1c84:	e8 e3 fd ff ff       	call   1a6c <pagefree>
+  return p + m - n;
+    1c89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1c8d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1c91:	48 89 c2             	mov    %rax,%rdx
+    1c94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1c98:	48 01 d0             	add    %rdx,%rax
+}
+    1c9b:	c9                   	leave
+    1c9c:	c3                   	ret
+
+0000000000001c9d <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1c9d:	55                   	push   %rbp
+    1c9e:	48 89 e5             	mov    %rsp,%rbp
+    1ca1:	48 83 ec 30          	sub    $0x30,%rsp
+    1ca5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    1ca8:	bf 00 10 00 00       	mov    $0x1000,%edi
+    1cad:	e8 e1 fe ff ff       	call   1b93 <pagealloc>
+    1cb2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1cb6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1cbb:	75 0a                	jne    1cc7 <refill+0x2a>
+    return -1;
+    1cbd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1cc2:	e9 da 00 00 00       	jmp    1da1 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1cc7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    1cce:	00 
+    1ccf:	e9 ba 00 00 00       	jmp    1d8e <refill+0xf1>
+    b = (struct block *)(p + off);
+    1cd4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1cd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cdc:	48 01 d0             	add    %rdx,%rax
+    1cdf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    1ce3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ce6:	ba 20 00 00 00       	mov    $0x20,%edx
+    1ceb:	89 c1                	mov    %eax,%ecx
+    1ced:	48 d3 e2             	shl    %cl,%rdx
+    1cf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cf4:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    1cf7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1cfa:	48 63 d0             	movslq %eax,%rdx
+    1cfd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d01:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    1d05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d08:	48 98                	cltq
+    1d0a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d11:	00 
+    1d12:	48 8d 05 07 24 00 00 	lea    0x2407(%rip),%rax        # 4120 <freelist>
+    1d19:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1d1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d21:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1d25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d28:	48 98                	cltq
+    1d2a:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1d31:	00 
+    1d32:	48 8d 15 e7 23 00 00 	lea    0x23e7(%rip),%rdx        # 4120 <freelist>
+    1d39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d3d:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1d41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d44:	48 98                	cltq
+    1d46:	48 83 c0 08          	add    $0x8,%rax
+    1d4a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d51:	00 
+    1d52:	48 8d 05 2b 24 00 00 	lea    0x242b(%rip),%rax        # 4184 <stats+0x4>
+    1d59:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d5c:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d62:	48 98                	cltq
+    1d64:	48 83 c0 08          	add    $0x8,%rax
+    1d68:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d6f:	00 
+    1d70:	48 8d 05 0d 24 00 00 	lea    0x240d(%rip),%rax        # 4184 <stats+0x4>
+    1d77:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1d7a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d7d:	ba 20 00 00 00       	mov    $0x20,%edx
+    1d82:	89 c1                	mov    %eax,%ecx
+    1d84:	48 d3 e2             	shl    %cl,%rdx
+    1d87:	48 89 d0             	mov    %rdx,%rax
+    1d8a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1d8e:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1d95:	00 
+    1d96:	0f 86 38 ff ff ff    	jbe    1cd4 <refill+0x37>
+  }
+  return 0;
+    1d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1da1:	c9                   	leave
+    1da2:	c3                   	ret
+
+0000000000001da3 <malloc>:
+
+void *malloc(uint nbytes) {
+    1da3:	55                   	push   %rbp
+    1da4:	48 89 e5             	mov    %rsp,%rbp
+    1da7:	48 83 ec 30          	sub    $0x30,%rsp
+    1dab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1dae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1db1:	48 83 c0 10          	add    $0x10,%rax
+    1db5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1db9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1dc0:	eb 04                	jmp    1dc6 <malloc+0x23>
+    1dc2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1dc6:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1dca:	7f 16                	jg     1de2 <malloc+0x3f>
+    1dcc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1dcf:	ba 20 00 00 00       	mov    $0x20,%edx
+    1dd4:	89 c1                	mov    %eax,%ecx
+    1dd6:	48 d3 e2             	shl    %cl,%rdx
+    1dd9:	48 89 d0             	mov    %rdx,%rax
+    1ddc:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1de0:	72 e0                	jb     1dc2 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1de2:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1de6:	75 7d                	jne    1e65 <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1de8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dec:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1df2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1df8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1dfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e00:	48 89 c7             	mov    %rax,%rdi
+    1e03:	e8 8b fd ff ff       	call   1b93 <pagealloc>
+    1e08:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1e0c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1e11:	75 0a                	jne    1e1d <malloc+0x7a>
+      return 0;
+    1e13:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e18:	e9 2c 01 00 00       	jmp    1f49 <malloc+0x1a6>
+    h->size = n;
+    1e1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e21:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1e25:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1e28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e2c:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1e33:	00 
+    stats.inuse[LARGE]++;
+    1e34:	8b 05 66 23 00 00    	mov    0x2366(%rip),%eax        # 41a0 <stats+0x20>
+    1e3a:	83 c0 01             	add    $0x1,%eax
+    1e3d:	89 05 5d 23 00 00    	mov    %eax,0x235d(%rip)        # 41a0 <stats+0x20>
+    stats.large += n;
+    1e43:	48 8b 15 7e 23 00 00 	mov    0x237e(%rip),%rdx        # 41c8 <stats+0x48>
+    1e4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e4e:	48 01 d0             	add    %rdx,%rax
+    1e51:	48 89 05 70 23 00 00 	mov    %rax,0x2370(%rip)        # 41c8 <stats+0x48>
+    return h + 1;
+    1e58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1e5c:	48 83 c0 10          	add    $0x10,%rax
+    1e60:	e9 e4 00 00 00       	jmp    1f49 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1e65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e68:	48 98                	cltq
+    1e6a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1e71:	00 
+    1e72:	48 8d 05 a7 22 00 00 	lea    0x22a7(%rip),%rax        # 4120 <freelist>
+    1e79:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1e7d:	48 85 c0             	test   %rax,%rax
+    1e80:	75 18                	jne    1e9a <malloc+0xf7>
+    1e82:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e85:	89 c7                	mov    %eax,%edi
+    1e87:	e8 11 fe ff ff       	call   1c9d <refill>
+    1e8c:	85 c0                	test   %eax,%eax
+    1e8e:	79 0a                	jns    1e9a <malloc+0xf7>
+    return 0;
+    1e90:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e95:	e9 af 00 00 00       	jmp    1f49 <malloc+0x1a6>
+  b = freelist[c];
+    1e9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1e9d:	48 98                	cltq
+    1e9f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ea6:	00 
+    1ea7:	48 8d 05 72 22 00 00 	lea    0x2272(%rip),%rax        # 4120 <freelist>
+    1eae:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1eb2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1eb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1eba:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1ebe:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ec1:	48 63 d2             	movslq %edx,%rdx
+    1ec4:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1ecb:	00 
+    1ecc:	48 8d 15 4d 22 00 00 	lea    0x224d(%rip),%rdx        # 4120 <freelist>
+    1ed3:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1eda:	48 98                	cltq
+    1edc:	48 83 c0 08          	add    $0x8,%rax
+    1ee0:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1ee7:	00 
+    1ee8:	48 8d 05 95 22 00 00 	lea    0x2295(%rip),%rax        # 4184 <stats+0x4>
+    1eef:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1ef2:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1ef5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ef8:	48 98                	cltq
+    1efa:	48 83 c0 08          	add    $0x8,%rax
+    1efe:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f05:	00 
+    1f06:	48 8d 05 77 22 00 00 	lea    0x2277(%rip),%rax        # 4184 <stats+0x4>
+    1f0d:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1f10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f13:	48 98                	cltq
+    1f15:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f1c:	00 
+    1f1d:	48 8d 05 5c 22 00 00 	lea    0x225c(%rip),%rax        # 4180 <stats>
+    1f24:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1f27:	8d 48 01             	lea    0x1(%rax),%ecx
+    1f2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f2d:	48 98                	cltq
+    1f2f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1f36:	00 
+    1f37:	48 8d 05 42 22 00 00 	lea    0x2242(%rip),%rax        # 4180 <stats>
+    1f3e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1f41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f45:	48 83 c0 10          	add    $0x10,%rax
+}
+    1f49:	c9                   	leave
+    1f4a:	c3                   	ret
+
+0000000000001f4b <free>:
+
+void free(void *ap) {
+    1f4b:	55                   	push   %rbp
+    1f4c:	48 89 e5             	mov    %rsp,%rbp
+    1f4f:	48 83 ec 18          	sub    $0x18,%rsp
+    1f53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1f57:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1f5c:	0f 84 03 01 00 00    	je     2065 <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1f62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f66:	48 83 e8 10          	sub    $0x10,%rax
+    1f6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1f6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f72:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1f76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1f7a:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1f7f:	75 42                	jne    1fc3 <free+0x78>
+    stats.inuse[LARGE]--;
+    1f81:	8b 05 19 22 00 00    	mov    0x2219(%rip),%eax        # 41a0 <stats+0x20>
+    1f87:	83 e8 01             	sub    $0x1,%eax
+    1f8a:	89 05 10 22 00 00    	mov    %eax,0x2210(%rip)        # 41a0 <stats+0x20>
+    stats.large -= b->h.size;
+    1f90:	48 8b 15 31 22 00 00 	mov    0x2231(%rip),%rdx        # 41c8 <stats+0x48>
+    1f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f9b:	48 8b 00             	mov    (%rax),%rax
+    1f9e:	48 29 c2             	sub    %rax,%rdx
+    1fa1:	48 89 15 20 22 00 00 	mov    %rdx,0x2220(%rip)        # 41c8 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1fa8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fac:	48 8b 10             	mov    (%rax),%rdx
+    1faf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb3:	48 89 d6             	mov    %rdx,%rsi
+    1fb6:	48 89 c7             	mov    %rax,%rdi
+    1fb9:	e8 ae fa ff ff       	call   1a6c <pagefree>
+    return;
+    1fbe:	e9 a3 00 00 00       	jmp    2066 <free+0x11b>
+  }
+  b->next = freelist[c];
+    1fc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fc7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1fce:	00 
+    1fcf:	48 8d 05 4a 21 00 00 	lea    0x214a(%rip),%rax        # 4120 <freelist>
+    1fd6:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1fda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fde:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1fe2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fe6:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1fed:	00 
+    1fee:	48 8d 15 2b 21 00 00 	lea    0x212b(%rip),%rdx        # 4120 <freelist>
+    1ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ff9:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1ffd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2001:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2008:	00 
+    2009:	48 8d 05 70 21 00 00 	lea    0x2170(%rip),%rax        # 4180 <stats>
+    2010:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2013:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    2016:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    201a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2021:	00 
+    2022:	48 8d 05 57 21 00 00 	lea    0x2157(%rip),%rax        # 4180 <stats>
+    2029:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    202c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2030:	48 83 c0 08          	add    $0x8,%rax
+    2034:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    203b:	00 
+    203c:	48 8d 05 41 21 00 00 	lea    0x2141(%rip),%rax        # 4184 <stats+0x4>
+    2043:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    2046:	8d 48 01             	lea    0x1(%rax),%ecx
+    2049:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    204d:	48 83 c0 08          	add    $0x8,%rax
+    2051:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    2058:	00 
+    2059:	48 8d 05 24 21 00 00 	lea    0x2124(%rip),%rax        # 4184 <stats+0x4>
+    2060:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    2063:	eb 01                	jmp    2066 <free+0x11b>
+    return;
+    2065:	90                   	nop
+}
+    2066:	c9                   	leave
+    2067:	c3                   	ret
+
+0000000000002068 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    2068:	55                   	push   %rbp
+    2069:	48 89 e5             	mov    %rsp,%rbp
+    206c:	48 83 ec 30          	sub    $0x30,%rsp
+    2070:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    2073:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2076:	48 8d 15 8b 03 00 00 	lea    0x38b(%rip),%rdx        # 2408 <benchreport+0x278>
+    207d:	48 89 d6             	mov    %rdx,%rsi
+    2080:	89 c7                	mov    %eax,%edi
+    2082:	b8 00 00 00 00       	mov    $0x0,%eax
+    2087:	e8 37 e6 ff ff       	call   6c3 <printf>
+  for (c = 0; c < NCLASS; c++)
+    208c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    2093:	eb 67                	jmp    20fc <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    2095:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2098:	48 98                	cltq
+    209a:	48 83 c0 08          	add    $0x8,%rax
+    209e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20a5:	00 
+    20a6:	48 8d 05 d7 20 00 00 	lea    0x20d7(%rip),%rax        # 4184 <stats+0x4>
+    20ad:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    20b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    20b3:	48 98                	cltq
+    20b5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    20bc:	00 
+    20bd:	48 8d 05 bc 20 00 00 	lea    0x20bc(%rip),%rax        # 4180 <stats>
+    20c4:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    20c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    20ca:	ba 20 00 00 00       	mov    $0x20,%edx
+    20cf:	89 c1                	mov    %eax,%ecx
+    20d1:	48 d3 e2             	shl    %cl,%rdx
+    20d4:	48 89 d0             	mov    %rdx,%rax
+    20d7:	89 c1                	mov    %eax,%ecx
+    20d9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    20dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20df:	41 89 f9             	mov    %edi,%r9d
+    20e2:	41 89 f0             	mov    %esi,%r8d
+    20e5:	48 8d 35 33 03 00 00 	lea    0x333(%rip),%rsi        # 241f <benchreport+0x28f>
+    20ec:	89 c7                	mov    %eax,%edi
+    20ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    20f3:	e8 cb e5 ff ff       	call   6c3 <printf>
+  for (c = 0; c < NCLASS; c++)
+    20f8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    20fc:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    2100:	7e 93                	jle    2095 <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    2102:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    2109:	00 
+  for (r = runs; r; r = r->next)
+    210a:	48 8b 05 4f 20 00 00 	mov    0x204f(%rip),%rax        # 4160 <runs>
+    2111:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2115:	eb 17                	jmp    212e <mallocstats+0xc6>
+    nfree += r->size;
+    2117:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    211b:	48 8b 00             	mov    (%rax),%rax
+    211e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    2122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2126:	48 8b 40 08          	mov    0x8(%rax),%rax
+    212a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    212e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    2133:	75 e2                	jne    2117 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    2135:	48 8b 05 94 20 00 00 	mov    0x2094(%rip),%rax        # 41d0 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    213c:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    213e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2142:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    2146:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    2148:	48 8b 05 79 20 00 00 	mov    0x2079(%rip),%rax        # 41c8 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    214f:	89 c1                	mov    %eax,%ecx
+    2151:	8b 15 49 20 00 00    	mov    0x2049(%rip),%edx        # 41a0 <stats+0x20>
+    2157:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    215a:	41 89 f9             	mov    %edi,%r9d
+    215d:	41 89 f0             	mov    %esi,%r8d
+    2160:	48 8d 35 c9 02 00 00 	lea    0x2c9(%rip),%rsi        # 2430 <benchreport+0x2a0>
+    2167:	89 c7                	mov    %eax,%edi
+    2169:	b8 00 00 00 00       	mov    $0x0,%eax
+    216e:	e8 50 e5 ff ff       	call   6c3 <printf>
+}
+    2173:	90                   	nop
+    2174:	c9                   	leave
+    2175:	c3                   	ret
+
+0000000000002176 <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    2176:	55                   	push   %rbp
+    2177:	48 89 e5             	mov    %rsp,%rbp
+    217a:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    217e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    2182:	48 89 c7             	mov    %rax,%rdi
+    2185:	e8 9a f7 ff ff       	call   1924 <cycles>
+  return t;
+    218a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    218e:	c9                   	leave
+    218f:	c3                   	ret
+
+0000000000002190 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    2190:	55                   	push   %rbp
+    2191:	48 89 e5             	mov    %rsp,%rbp
+    2194:	48 83 ec 30          	sub    $0x30,%rsp
+    2198:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    219c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    21a0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    21a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    21a7:	0f 8e 24 01 00 00    	jle    22d1 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    21ad:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    21b4:	e9 98 00 00 00       	jmp    2251 <benchreport+0xc1>
+    x = t[i];
+    21b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21bc:	48 98                	cltq
+    21be:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    21c5:	00 
+    21c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21ca:	48 01 d0             	add    %rdx,%rax
+    21cd:	48 8b 00             	mov    (%rax),%rax
+    21d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    21d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    21d7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    21da:	eb 33                	jmp    220f <benchreport+0x7f>
+      t[j] = t[j - 1];
+    21dc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    21df:	48 98                	cltq
+    21e1:	48 c1 e0 03          	shl    $0x3,%rax
+    21e5:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    21e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    21ed:	48 01 d0             	add    %rdx,%rax
+    21f0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    21f3:	48 63 d2             	movslq %edx,%rdx
+    21f6:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    21fd:	00 
+    21fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    2202:	48 01 ca             	add    %rcx,%rdx
+    2205:	48 8b 00             	mov    (%rax),%rax
+    2208:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    220b:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    220f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    2213:	7e 1d                	jle    2232 <benchreport+0xa2>
+    2215:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2218:	48 98                	cltq
+    221a:	48 c1 e0 03          	shl    $0x3,%rax
+    221e:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    2222:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2226:	48 01 d0             	add    %rdx,%rax
+    2229:	48 8b 00             	mov    (%rax),%rax
+    222c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    2230:	72 aa                	jb     21dc <benchreport+0x4c>
+    t[j] = x;
+    2232:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    2235:	48 98                	cltq
+    2237:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    223e:	00 
+    223f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2243:	48 01 c2             	add    %rax,%rdx
+    2246:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    224a:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    224d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    2251:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    2254:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    2257:	0f 8c 5c ff ff ff    	jl     21b9 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    225d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2260:	48 98                	cltq
+    2262:	48 c1 e0 03          	shl    $0x3,%rax
+    2266:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    226a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    226e:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2271:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    2274:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    2277:	89 c2                	mov    %eax,%edx
+    2279:	c1 ea 1f             	shr    $0x1f,%edx
+    227c:	01 d0                	add    %edx,%eax
+    227e:	d1 f8                	sar    %eax
+    2280:	48 98                	cltq
+    2282:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    2289:	00 
+    228a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    228e:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    2291:	48 8b 38             	mov    (%rax),%rdi
+    2294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    2298:	48 8b 30             	mov    (%rax),%rsi
+    229b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    229e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    22a2:	48 83 ec 08          	sub    $0x8,%rsp
+    22a6:	51                   	push   %rcx
+    22a7:	49 89 f9             	mov    %rdi,%r9
+    22aa:	49 89 f0             	mov    %rsi,%r8
+    22ad:	89 d1                	mov    %edx,%ecx
+    22af:	48 89 c2             	mov    %rax,%rdx
+    22b2:	48 8d 05 b7 01 00 00 	lea    0x1b7(%rip),%rax        # 2470 <benchreport+0x2e0>
+    22b9:	48 89 c6             	mov    %rax,%rsi
+    22bc:	bf 01 00 00 00       	mov    $0x1,%edi
+    22c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    22c6:	e8 f8 e3 ff ff       	call   6c3 <printf>
+    22cb:	48 83 c4 10          	add    $0x10,%rsp
+    22cf:	eb 01                	jmp    22d2 <benchreport+0x142>
+    return;
+    22d1:	90                   	nop
+}
+    22d2:	c9                   	leave
+    22d3:	c3                   	ret
@@ -0,0 +1,3511 @@
+
+out/user/_wc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <wc>:
+#include <stat.h>
+#include <user.h>
+
+char buf[512];
+
+void wc(int fd, char *name) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 30          	sub    $0x30,%rsp
+       8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+       b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+       f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+      16:	8b 45 f0             	mov    -0x10(%rbp),%eax
+      19:	89 45 f4             	mov    %eax,-0xc(%rbp)
+      1c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      1f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  inword = 0;
+      22:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+      29:	eb 74                	jmp    9f <wc+0x9f>
+    for (i = 0; i < n; i++) {
+      2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      32:	eb 63                	jmp    97 <wc+0x97>
+      c++;
+      34:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+      if (buf[i] == '\n')
+      38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      3b:	48 98                	cltq
+      3d:	48 8d 15 fc 2f 00 00 	lea    0x2ffc(%rip),%rdx        # 3040 <buf>
+      44:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+      48:	3c 0a                	cmp    $0xa,%al
+      4a:	75 04                	jne    50 <wc+0x50>
+        l++;
+      4c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+      if (strchr(" \r\t\n\v", buf[i]))
+      50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      53:	48 98                	cltq
+      55:	48 8d 15 e4 2f 00 00 	lea    0x2fe4(%rip),%rdx        # 3040 <buf>
+      5c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+      60:	0f be c0             	movsbl %al,%eax
+      63:	89 c6                	mov    %eax,%esi
+      65:	48 8d 05 64 1f 00 00 	lea    0x1f64(%rip),%rax        # 1fd0 <benchreport+0x147>
+      6c:	48 89 c7             	mov    %rax,%rdi
+      6f:	e8 ff 0d 00 00       	call   e73 <strchr>
+      74:	48 85 c0             	test   %rax,%rax
+      77:	74 09                	je     82 <wc+0x82>
+        inword = 0;
+      79:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+      80:	eb 11                	jmp    93 <wc+0x93>
+      else if (!inword) {
+      82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+      86:	75 0b                	jne    93 <wc+0x93>
+        w++;
+      88:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+        inword = 1;
+      8c:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+    for (i = 0; i < n; i++) {
+      93:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      9a:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+      9d:	7c 95                	jl     34 <wc+0x34>
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+      9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+      a2:	ba 00 02 00 00       	mov    $0x200,%edx
+      a7:	48 8d 0d 92 2f 00 00 	lea    0x2f92(%rip),%rcx        # 3040 <buf>
+      ae:	48 89 ce             	mov    %rcx,%rsi
+      b1:	89 c7                	mov    %eax,%edi
+      b3:	e8 d9 13 00 00       	call   1491 <read>
+      b8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      bb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      bf:	0f 8f 66 ff ff ff    	jg     2b <wc+0x2b>
+      }
+    }
+  }
+  if (n < 0) {
+      c5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+      c9:	79 1e                	jns    e9 <wc+0xe9>
+    printf(1, "wc: read error\n");
+      cb:	48 8d 05 04 1f 00 00 	lea    0x1f04(%rip),%rax        # 1fd6 <benchreport+0x14d>
+      d2:	48 89 c6             	mov    %rax,%rsi
+      d5:	bf 01 00 00 00       	mov    $0x1,%edi
+      da:	b8 00 00 00 00       	mov    $0x0,%eax
+      df:	e8 d8 02 00 00       	call   3bc <printf>
+    exit();
+      e4:	e8 03 09 00 00       	call   9ec <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+      e9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+      ed:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+      f0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      f3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      f6:	49 89 f1             	mov    %rsi,%r9
+      f9:	41 89 c8             	mov    %ecx,%r8d
+      fc:	89 d1                	mov    %edx,%ecx
+      fe:	89 c2                	mov    %eax,%edx
+     100:	48 8d 05 df 1e 00 00 	lea    0x1edf(%rip),%rax        # 1fe6 <benchreport+0x15d>
+     107:	48 89 c6             	mov    %rax,%rsi
+     10a:	bf 01 00 00 00       	mov    $0x1,%edi
+     10f:	b8 00 00 00 00       	mov    $0x0,%eax
+     114:	e8 a3 02 00 00       	call   3bc <printf>
+}
+     119:	90                   	nop
+     11a:	c9                   	leave
+     11b:	c3                   	ret
+
+000000000000011c <main>:
+
+int main(int argc, char *argv[]) {
+     11c:	55                   	push   %rbp
+     11d:	48 89 e5             	mov    %rsp,%rbp
+     120:	48 83 ec 20          	sub    $0x20,%rsp
+     124:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     127:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if (argc <= 1) {
+     12b:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     12f:	7f 19                	jg     14a <main+0x2e>
+    wc(0, "");
+     131:	48 8d 05 bb 1e 00 00 	lea    0x1ebb(%rip),%rax        # 1ff3 <benchreport+0x16a>
+     138:	48 89 c6             	mov    %rax,%rsi
+     13b:	bf 00 00 00 00       	mov    $0x0,%edi
+     140:	e8 bb fe ff ff       	call   0 <wc>
+    exit();
+     145:	e8 a2 08 00 00       	call   9ec <exit>
+  }
+
+  for (i = 1; i < argc; i++) {
+     14a:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+     151:	e9 97 00 00 00       	jmp    1ed <main+0xd1>
+    if ((fd = open(argv[i], 0)) < 0) {
+     156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     159:	48 98                	cltq
+     15b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     162:	00 
+     163:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     167:	48 01 d0             	add    %rdx,%rax
+     16a:	48 8b 00             	mov    (%rax),%rax
+     16d:	be 00 00 00 00       	mov    $0x0,%esi
+     172:	48 89 c7             	mov    %rax,%rdi
+     175:	e8 4e 13 00 00       	call   14c8 <open>
+     17a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     17d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     181:	79 38                	jns    1bb <main+0x9f>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+     183:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     186:	48 98                	cltq
+     188:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     18f:	00 
+     190:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     194:	48 01 d0             	add    %rdx,%rax
+     197:	48 8b 00             	mov    (%rax),%rax
+     19a:	48 89 c2             	mov    %rax,%rdx
+     19d:	48 8d 05 50 1e 00 00 	lea    0x1e50(%rip),%rax        # 1ff4 <benchreport+0x16b>
+     1a4:	48 89 c6             	mov    %rax,%rsi
+     1a7:	bf 01 00 00 00       	mov    $0x1,%edi
+     1ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b1:	e8 06 02 00 00       	call   3bc <printf>
+      exit();
+     1b6:	e8 31 08 00 00       	call   9ec <exit>
+    }
+    wc(fd, argv[i]);
+     1bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1be:	48 98                	cltq
+     1c0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     1c7:	00 
+     1c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     1cc:	48 01 d0             	add    %rdx,%rax
+     1cf:	48 8b 10             	mov    (%rax),%rdx
+     1d2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1d5:	48 89 d6             	mov    %rdx,%rsi
+     1d8:	89 c7                	mov    %eax,%edi
+     1da:	e8 21 fe ff ff       	call   0 <wc>
+    close(fd);
+     1df:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1e2:	89 c7                	mov    %eax,%edi
+     1e4:	e8 6d 08 00 00       	call   a56 <close>
+  for (i = 1; i < argc; i++) {
+     1e9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1f0:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     1f3:	0f 8c 5d ff ff ff    	jl     156 <main+0x3a>
+  }
+  exit();
+     1f9:	e8 ee 07 00 00       	call   9ec <exit>
+
+00000000000001fe <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+     1fe:	55                   	push   %rbp
+     1ff:	48 89 e5             	mov    %rsp,%rbp
+     202:	48 83 ec 10          	sub    $0x10,%rsp
+     206:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     209:	89 f0                	mov    %esi,%eax
+     20b:	88 45 f8             	mov    %al,-0x8(%rbp)
+     20e:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+     212:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     215:	89 d6                	mov    %edx,%esi
+     217:	89 c7                	mov    %eax,%edi
+     219:	e8 eb 06 00 00       	call   909 <bputc>
+     21e:	90                   	nop
+     21f:	c9                   	leave
+     220:	c3                   	ret
+
+0000000000000221 <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+     221:	55                   	push   %rbp
+     222:	48 89 e5             	mov    %rsp,%rbp
+     225:	48 83 ec 50          	sub    $0x50,%rsp
+     229:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     22c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+     230:	89 55 c8             	mov    %edx,-0x38(%rbp)
+     233:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+     236:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     23a:	74 21                	je     25d <printint64+0x3c>
+     23c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     240:	48 c1 e8 3f          	shr    $0x3f,%rax
+     244:	0f b6 c0             	movzbl %al,%eax
+     247:	89 45 bc             	mov    %eax,-0x44(%rbp)
+     24a:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     24e:	74 0d                	je     25d <printint64+0x3c>
+    x = -xx;
+     250:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     254:	48 f7 d8             	neg    %rax
+     257:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     25b:	eb 08                	jmp    265 <printint64+0x44>
+  else
+    x = xx;
+     25d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     261:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     265:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     26c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     26f:	48 63 c8             	movslq %eax,%rcx
+     272:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     276:	ba 00 00 00 00       	mov    $0x0,%edx
+     27b:	48 f7 f1             	div    %rcx
+     27e:	48 89 d1             	mov    %rdx,%rcx
+     281:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     284:	8d 50 01             	lea    0x1(%rax),%edx
+     287:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     28a:	48 8d 15 6f 2d 00 00 	lea    0x2d6f(%rip),%rdx        # 3000 <digits.1>
+     291:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     295:	48 98                	cltq
+     297:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     29b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     29e:	48 63 f0             	movslq %eax,%rsi
+     2a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     2a5:	ba 00 00 00 00       	mov    $0x0,%edx
+     2aa:	48 f7 f6             	div    %rsi
+     2ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     2b1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     2b6:	75 b4                	jne    26c <printint64+0x4b>
+
+  if (sgn)
+     2b8:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+     2bc:	74 2b                	je     2e9 <printint64+0xc8>
+    buf[i++] = '-';
+     2be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2c1:	8d 50 01             	lea    0x1(%rax),%edx
+     2c4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     2c7:	48 98                	cltq
+     2c9:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+     2ce:	eb 19                	jmp    2e9 <printint64+0xc8>
+    putc(fd, buf[i]);
+     2d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2d3:	48 98                	cltq
+     2d5:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     2da:	0f be d0             	movsbl %al,%edx
+     2dd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     2e0:	89 d6                	mov    %edx,%esi
+     2e2:	89 c7                	mov    %eax,%edi
+     2e4:	e8 15 ff ff ff       	call   1fe <putc>
+  while (--i >= 0)
+     2e9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     2ed:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2f1:	79 dd                	jns    2d0 <printint64+0xaf>
+}
+     2f3:	90                   	nop
+     2f4:	90                   	nop
+     2f5:	c9                   	leave
+     2f6:	c3                   	ret
+
+00000000000002f7 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     2f7:	55                   	push   %rbp
+     2f8:	48 89 e5             	mov    %rsp,%rbp
+     2fb:	48 83 ec 30          	sub    $0x30,%rsp
+     2ff:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     302:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     305:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     308:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     30b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     312:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     316:	74 17                	je     32f <printint+0x38>
+     318:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     31c:	79 11                	jns    32f <printint+0x38>
+    neg = 1;
+     31e:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     325:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     328:	f7 d8                	neg    %eax
+     32a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     32d:	eb 06                	jmp    335 <printint+0x3e>
+  } else {
+    x = xx;
+     32f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     332:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     335:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     33c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     33f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     342:	ba 00 00 00 00       	mov    $0x0,%edx
+     347:	f7 f1                	div    %ecx
+     349:	89 d1                	mov    %edx,%ecx
+     34b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     34e:	8d 50 01             	lea    0x1(%rax),%edx
+     351:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     354:	89 c9                	mov    %ecx,%ecx
+     356:	48 8d 15 c3 2c 00 00 	lea    0x2cc3(%rip),%rdx        # 3020 <digits.0>
+     35d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     361:	48 98                	cltq
+     363:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     367:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     36a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     36d:	ba 00 00 00 00       	mov    $0x0,%edx
+     372:	f7 f6                	div    %esi
+     374:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     377:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     37b:	75 bf                	jne    33c <printint+0x45>
+  if (neg)
+     37d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     381:	74 2b                	je     3ae <printint+0xb7>
+    buf[i++] = '-';
+     383:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     386:	8d 50 01             	lea    0x1(%rax),%edx
+     389:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     38c:	48 98                	cltq
+     38e:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     393:	eb 19                	jmp    3ae <printint+0xb7>
+    putc(fd, buf[i]);
+     395:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     398:	48 98                	cltq
+     39a:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     39f:	0f be d0             	movsbl %al,%edx
+     3a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     3a5:	89 d6                	mov    %edx,%esi
+     3a7:	89 c7                	mov    %eax,%edi
+     3a9:	e8 50 fe ff ff       	call   1fe <putc>
+  while (--i >= 0)
+     3ae:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     3b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     3b6:	79 dd                	jns    395 <printint+0x9e>
+}
+     3b8:	90                   	nop
+     3b9:	90                   	nop
+     3ba:	c9                   	leave
+     3bb:	c3                   	ret
+
+00000000000003bc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     3bc:	55                   	push   %rbp
+     3bd:	48 89 e5             	mov    %rsp,%rbp
+     3c0:	48 83 ec 70          	sub    $0x70,%rsp
+     3c4:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     3c7:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     3cb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     3cf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     3d3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     3d7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     3db:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     3e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     3e6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     3ea:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     3ee:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     3f2:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     3f9:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     400:	e9 67 02 00 00       	jmp    66c <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     405:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     408:	48 63 d0             	movslq %eax,%rdx
+     40b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     40f:	48 01 d0             	add    %rdx,%rax
+     412:	0f b6 00             	movzbl (%rax),%eax
+     415:	0f be c0             	movsbl %al,%eax
+     418:	25 ff 00 00 00       	and    $0xff,%eax
+     41d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     420:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     424:	75 30                	jne    456 <printf+0x9a>
+      if (c == '%') {
+     426:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     42a:	75 13                	jne    43f <printf+0x83>
+        state = '%';
+     42c:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     433:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     43a:	e9 29 02 00 00       	jmp    668 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     43f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     442:	0f be d0             	movsbl %al,%edx
+     445:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     448:	89 d6                	mov    %edx,%esi
+     44a:	89 c7                	mov    %eax,%edi
+     44c:	e8 ad fd ff ff       	call   1fe <putc>
+     451:	e9 12 02 00 00       	jmp    668 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     456:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     45a:	0f 85 08 02 00 00    	jne    668 <printf+0x2ac>
+      if (c == 'l') {
+     460:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     464:	75 0c                	jne    472 <printf+0xb6>
+        lflag = 1;
+     466:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     46d:	e9 f6 01 00 00       	jmp    668 <printf+0x2ac>
+      } else if (c == 'd') {
+     472:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     476:	0f 85 93 00 00 00    	jne    50f <printf+0x153>
+        if (lflag == 1)
+     47c:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     480:	75 47                	jne    4c9 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     482:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     485:	83 f8 2f             	cmp    $0x2f,%eax
+     488:	77 17                	ja     4a1 <printf+0xe5>
+     48a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     48e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     491:	89 d2                	mov    %edx,%edx
+     493:	48 01 d0             	add    %rdx,%rax
+     496:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     499:	83 c2 08             	add    $0x8,%edx
+     49c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     49f:	eb 0c                	jmp    4ad <printf+0xf1>
+     4a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4a5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4a9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4ad:	48 8b 30             	mov    (%rax),%rsi
+     4b0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4b3:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4b8:	ba 0a 00 00 00       	mov    $0xa,%edx
+     4bd:	89 c7                	mov    %eax,%edi
+     4bf:	e8 5d fd ff ff       	call   221 <printint64>
+     4c4:	e9 98 01 00 00       	jmp    661 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     4c9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     4cc:	83 f8 2f             	cmp    $0x2f,%eax
+     4cf:	77 17                	ja     4e8 <printf+0x12c>
+     4d1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     4d5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4d8:	89 d2                	mov    %edx,%edx
+     4da:	48 01 d0             	add    %rdx,%rax
+     4dd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     4e0:	83 c2 08             	add    $0x8,%edx
+     4e3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     4e6:	eb 0c                	jmp    4f4 <printf+0x138>
+     4e8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     4ec:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     4f0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     4f4:	8b 30                	mov    (%rax),%esi
+     4f6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4fe:	ba 0a 00 00 00       	mov    $0xa,%edx
+     503:	89 c7                	mov    %eax,%edi
+     505:	e8 ed fd ff ff       	call   2f7 <printint>
+     50a:	e9 52 01 00 00       	jmp    661 <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     50f:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     513:	74 0a                	je     51f <printf+0x163>
+     515:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     519:	0f 85 93 00 00 00    	jne    5b2 <printf+0x1f6>
+        if (lflag == 1)
+     51f:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     523:	75 47                	jne    56c <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     525:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     528:	83 f8 2f             	cmp    $0x2f,%eax
+     52b:	77 17                	ja     544 <printf+0x188>
+     52d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     531:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     534:	89 d2                	mov    %edx,%edx
+     536:	48 01 d0             	add    %rdx,%rax
+     539:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     53c:	83 c2 08             	add    $0x8,%edx
+     53f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     542:	eb 0c                	jmp    550 <printf+0x194>
+     544:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     548:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     54c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     550:	48 8b 30             	mov    (%rax),%rsi
+     553:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     556:	b9 00 00 00 00       	mov    $0x0,%ecx
+     55b:	ba 10 00 00 00       	mov    $0x10,%edx
+     560:	89 c7                	mov    %eax,%edi
+     562:	e8 ba fc ff ff       	call   221 <printint64>
+        if (lflag == 1)
+     567:	e9 f5 00 00 00       	jmp    661 <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     56c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     56f:	83 f8 2f             	cmp    $0x2f,%eax
+     572:	77 17                	ja     58b <printf+0x1cf>
+     574:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     578:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     57b:	89 d2                	mov    %edx,%edx
+     57d:	48 01 d0             	add    %rdx,%rax
+     580:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     583:	83 c2 08             	add    $0x8,%edx
+     586:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     589:	eb 0c                	jmp    597 <printf+0x1db>
+     58b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     58f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     593:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     597:	8b 30                	mov    (%rax),%esi
+     599:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     59c:	b9 00 00 00 00       	mov    $0x0,%ecx
+     5a1:	ba 10 00 00 00       	mov    $0x10,%edx
+     5a6:	89 c7                	mov    %eax,%edi
+     5a8:	e8 4a fd ff ff       	call   2f7 <printint>
+        if (lflag == 1)
+     5ad:	e9 af 00 00 00       	jmp    661 <printf+0x2a5>
+      } else if (c == 's') {
+     5b2:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     5b6:	75 6e                	jne    626 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     5b8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     5bb:	83 f8 2f             	cmp    $0x2f,%eax
+     5be:	77 17                	ja     5d7 <printf+0x21b>
+     5c0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     5c4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5c7:	89 d2                	mov    %edx,%edx
+     5c9:	48 01 d0             	add    %rdx,%rax
+     5cc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     5cf:	83 c2 08             	add    $0x8,%edx
+     5d2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     5d5:	eb 0c                	jmp    5e3 <printf+0x227>
+     5d7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     5db:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     5df:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     5e3:	48 8b 00             	mov    (%rax),%rax
+     5e6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     5ea:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     5ef:	75 28                	jne    619 <printf+0x25d>
+          s = "(null)";
+     5f1:	48 8d 05 10 1a 00 00 	lea    0x1a10(%rip),%rax        # 2008 <benchreport+0x17f>
+     5f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     5fc:	eb 1b                	jmp    619 <printf+0x25d>
+          putc(fd, *s);
+     5fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     602:	0f b6 00             	movzbl (%rax),%eax
+     605:	0f be d0             	movsbl %al,%edx
+     608:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     60b:	89 d6                	mov    %edx,%esi
+     60d:	89 c7                	mov    %eax,%edi
+     60f:	e8 ea fb ff ff       	call   1fe <putc>
+        for (; *s; s++)
+     614:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     619:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     61d:	0f b6 00             	movzbl (%rax),%eax
+     620:	84 c0                	test   %al,%al
+     622:	75 da                	jne    5fe <printf+0x242>
+     624:	eb 3b                	jmp    661 <printf+0x2a5>
+      } else if (c == '%') {
+     626:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     62a:	75 14                	jne    640 <printf+0x284>
+        putc(fd, c);
+     62c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     62f:	0f be d0             	movsbl %al,%edx
+     632:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     635:	89 d6                	mov    %edx,%esi
+     637:	89 c7                	mov    %eax,%edi
+     639:	e8 c0 fb ff ff       	call   1fe <putc>
+     63e:	eb 21                	jmp    661 <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     640:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     643:	be 25 00 00 00       	mov    $0x25,%esi
+     648:	89 c7                	mov    %eax,%edi
+     64a:	e8 af fb ff ff       	call   1fe <putc>
+        putc(fd, c);
+     64f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     652:	0f be d0             	movsbl %al,%edx
+     655:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     658:	89 d6                	mov    %edx,%esi
+     65a:	89 c7                	mov    %eax,%edi
+     65c:	e8 9d fb ff ff       	call   1fe <putc>
+      }
+      state = 0;
+     661:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     668:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     66c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     66f:	48 63 d0             	movslq %eax,%rdx
+     672:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     676:	48 01 d0             	add    %rdx,%rax
+     679:	0f b6 00             	movzbl (%rax),%eax
+     67c:	84 c0                	test   %al,%al
+     67e:	0f 85 81 fd ff ff    	jne    405 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     684:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     687:	89 c7                	mov    %eax,%edi
+     689:	e8 ee 02 00 00       	call   97c <bflushtty>
+}
+     68e:	90                   	nop
+     68f:	c9                   	leave
+     690:	c3                   	ret
+
+0000000000000691 <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     691:	55                   	push   %rbp
+     692:	48 89 e5             	mov    %rsp,%rbp
+     695:	48 83 ec 30          	sub    $0x30,%rsp
+     699:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     69c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     6a0:	78 06                	js     6a8 <getbuf+0x17>
+     6a2:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     6a6:	7e 0a                	jle    6b2 <getbuf+0x21>
+    return 0;
+     6a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ad:	e9 94 00 00 00       	jmp    746 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     6b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6b5:	48 98                	cltq
+     6b7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     6be:	00 
+     6bf:	48 8d 05 7a 2b 00 00 	lea    0x2b7a(%rip),%rax        # 3240 <obufs>
+     6c6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     6ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6ce:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6d3:	75 6d                	jne    742 <getbuf+0xb1>
+     6d5:	bf 08 02 00 00       	mov    $0x208,%edi
+     6da:	e8 bd 13 00 00       	call   1a9c <malloc>
+     6df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     6e3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     6e8:	74 58                	je     742 <getbuf+0xb1>
+    b->n = 0;
+     6ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6ee:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     6f4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     6f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     6fb:	48 89 d6             	mov    %rdx,%rsi
+     6fe:	89 c7                	mov    %eax,%edi
+     700:	e8 e4 0d 00 00       	call   14e9 <fstat>
+     705:	85 c0                	test   %eax,%eax
+     707:	75 11                	jne    71a <getbuf+0x89>
+     709:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     70d:	66 83 f8 03          	cmp    $0x3,%ax
+     711:	75 07                	jne    71a <getbuf+0x89>
+     713:	ba 01 00 00 00       	mov    $0x1,%edx
+     718:	eb 05                	jmp    71f <getbuf+0x8e>
+     71a:	ba 00 00 00 00       	mov    $0x0,%edx
+     71f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     723:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     726:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     729:	48 98                	cltq
+     72b:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     732:	00 
+     733:	48 8d 15 06 2b 00 00 	lea    0x2b06(%rip),%rdx        # 3240 <obufs>
+     73a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     73e:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     746:	c9                   	leave
+     747:	c3                   	ret
+
+0000000000000748 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     748:	55                   	push   %rbp
+     749:	48 89 e5             	mov    %rsp,%rbp
+     74c:	48 83 ec 20          	sub    $0x20,%rsp
+     750:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     753:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     757:	78 33                	js     78c <bflush+0x44>
+     759:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     75d:	7f 2d                	jg     78c <bflush+0x44>
+     75f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     762:	48 98                	cltq
+     764:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     76b:	00 
+     76c:	48 8d 05 cd 2a 00 00 	lea    0x2acd(%rip),%rax        # 3240 <obufs>
+     773:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     777:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     77b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     780:	74 0a                	je     78c <bflush+0x44>
+     782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     786:	8b 00                	mov    (%rax),%eax
+     788:	85 c0                	test   %eax,%eax
+     78a:	75 07                	jne    793 <bflush+0x4b>
+    return 0;
+     78c:	b8 00 00 00 00       	mov    $0x0,%eax
+     791:	eb 3c                	jmp    7cf <bflush+0x87>
+  n = b->n;
+     793:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     797:	8b 00                	mov    (%rax),%eax
+     799:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     79c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7a0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     7a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7aa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     7ae:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     7b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7b4:	48 89 ce             	mov    %rcx,%rsi
+     7b7:	89 c7                	mov    %eax,%edi
+     7b9:	e8 de 0c 00 00       	call   149c <write>
+     7be:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     7c1:	75 07                	jne    7ca <bflush+0x82>
+     7c3:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c8:	eb 05                	jmp    7cf <bflush+0x87>
+     7ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     7cf:	c9                   	leave
+     7d0:	c3                   	ret
+
+00000000000007d1 <bflushall>:
+
+void bflushall(void) {
+     7d1:	55                   	push   %rbp
+     7d2:	48 89 e5             	mov    %rsp,%rbp
+     7d5:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     7d9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7e0:	eb 0e                	jmp    7f0 <bflushall+0x1f>
+    bflush(fd);
+     7e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7e5:	89 c7                	mov    %eax,%edi
+     7e7:	e8 5c ff ff ff       	call   748 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     7ec:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     7f0:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     7f4:	7e ec                	jle    7e2 <bflushall+0x11>
+}
+     7f6:	90                   	nop
+     7f7:	90                   	nop
+     7f8:	c9                   	leave
+     7f9:	c3                   	ret
+
+00000000000007fa <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     7fa:	55                   	push   %rbp
+     7fb:	48 89 e5             	mov    %rsp,%rbp
+     7fe:	48 83 ec 30          	sub    $0x30,%rsp
+     802:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     805:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     809:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     80c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     80f:	89 c7                	mov    %eax,%edi
+     811:	e8 7b fe ff ff       	call   691 <getbuf>
+     816:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     81a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     81f:	75 19                	jne    83a <bwrite+0x40>
+    return write(fd, s, n);
+     821:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     824:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     828:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     82b:	48 89 ce             	mov    %rcx,%rsi
+     82e:	89 c7                	mov    %eax,%edi
+     830:	e8 67 0c 00 00       	call   149c <write>
+     835:	e9 cd 00 00 00       	jmp    907 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     83a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     841:	e9 92 00 00 00       	jmp    8d8 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     846:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     84a:	8b 00                	mov    (%rax),%eax
+     84c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     851:	75 18                	jne    86b <bwrite+0x71>
+     853:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     856:	89 c7                	mov    %eax,%edi
+     858:	e8 eb fe ff ff       	call   748 <bflush>
+     85d:	85 c0                	test   %eax,%eax
+     85f:	79 0a                	jns    86b <bwrite+0x71>
+      return -1;
+     861:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     866:	e9 9c 00 00 00       	jmp    907 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     86b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     86e:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     871:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     874:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     878:	8b 00                	mov    (%rax),%eax
+     87a:	ba 00 02 00 00       	mov    $0x200,%edx
+     87f:	29 c2                	sub    %eax,%edx
+     881:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     884:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     887:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     88a:	39 c2                	cmp    %eax,%edx
+     88c:	0f 4e c2             	cmovle %edx,%eax
+     88f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     892:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     895:	48 63 d0             	movslq %eax,%rdx
+     898:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     89c:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     8a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8ac:	8b 00                	mov    (%rax),%eax
+     8ae:	48 98                	cltq
+     8b0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     8b4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     8b7:	89 c2                	mov    %eax,%edx
+     8b9:	48 89 cf             	mov    %rcx,%rdi
+     8bc:	e8 e9 06 00 00       	call   faa <memmove>
+    b->n += m;
+     8c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8c5:	8b 10                	mov    (%rax),%edx
+     8c7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     8ca:	01 c2                	add    %eax,%edx
+     8cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8d0:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     8d2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     8d5:	01 45 fc             	add    %eax,-0x4(%rbp)
+     8d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8db:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     8de:	0f 8c 62 ff ff ff    	jl     846 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     8e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8e8:	8b 40 04             	mov    0x4(%rax),%eax
+     8eb:	85 c0                	test   %eax,%eax
+     8ed:	74 15                	je     904 <bwrite+0x10a>
+     8ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8f2:	89 c7                	mov    %eax,%edi
+     8f4:	e8 4f fe ff ff       	call   748 <bflush>
+     8f9:	85 c0                	test   %eax,%eax
+     8fb:	79 07                	jns    904 <bwrite+0x10a>
+    return -1;
+     8fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     902:	eb 03                	jmp    907 <bwrite+0x10d>
+  return n;
+     904:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     907:	c9                   	leave
+     908:	c3                   	ret
+
+0000000000000909 <bputc>:
+
+void bputc(int fd, char c) {
+     909:	55                   	push   %rbp
+     90a:	48 89 e5             	mov    %rsp,%rbp
+     90d:	48 83 ec 20          	sub    $0x20,%rsp
+     911:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     914:	89 f0                	mov    %esi,%eax
+     916:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     919:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     91c:	89 c7                	mov    %eax,%edi
+     91e:	e8 6e fd ff ff       	call   691 <getbuf>
+     923:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     927:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     92c:	75 18                	jne    946 <bputc+0x3d>
+    write(fd, &c, 1);
+     92e:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     932:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     935:	ba 01 00 00 00       	mov    $0x1,%edx
+     93a:	48 89 ce             	mov    %rcx,%rsi
+     93d:	89 c7                	mov    %eax,%edi
+     93f:	e8 58 0b 00 00       	call   149c <write>
+    return;
+     944:	eb 34                	jmp    97a <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     946:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     94a:	8b 00                	mov    (%rax),%eax
+     94c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     951:	75 0a                	jne    95d <bputc+0x54>
+    bflush(fd);
+     953:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     956:	89 c7                	mov    %eax,%edi
+     958:	e8 eb fd ff ff       	call   748 <bflush>
+  b->data[b->n++] = c;
+     95d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     961:	8b 00                	mov    (%rax),%eax
+     963:	8d 48 01             	lea    0x1(%rax),%ecx
+     966:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     96a:	89 0a                	mov    %ecx,(%rdx)
+     96c:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     970:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     974:	48 98                	cltq
+     976:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     97a:	c9                   	leave
+     97b:	c3                   	ret
+
+000000000000097c <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     97c:	55                   	push   %rbp
+     97d:	48 89 e5             	mov    %rsp,%rbp
+     980:	48 83 ec 10          	sub    $0x10,%rsp
+     984:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     987:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     98b:	78 4c                	js     9d9 <bflushtty+0x5d>
+     98d:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     991:	7f 46                	jg     9d9 <bflushtty+0x5d>
+     993:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     996:	48 98                	cltq
+     998:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     99f:	00 
+     9a0:	48 8d 05 99 28 00 00 	lea    0x2899(%rip),%rax        # 3240 <obufs>
+     9a7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9ab:	48 85 c0             	test   %rax,%rax
+     9ae:	74 29                	je     9d9 <bflushtty+0x5d>
+     9b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9b3:	48 98                	cltq
+     9b5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     9bc:	00 
+     9bd:	48 8d 05 7c 28 00 00 	lea    0x287c(%rip),%rax        # 3240 <obufs>
+     9c4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     9c8:	8b 40 04             	mov    0x4(%rax),%eax
+     9cb:	85 c0                	test   %eax,%eax
+     9cd:	74 0a                	je     9d9 <bflushtty+0x5d>
+    bflush(fd);
+     9cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     9d2:	89 c7                	mov    %eax,%edi
+     9d4:	e8 6f fd ff ff       	call   748 <bflush>
+}
+     9d9:	90                   	nop
+     9da:	c9                   	leave
+     9db:	c3                   	ret
+
+00000000000009dc <fork>:
+
+int fork(void) {
+     9dc:	55                   	push   %rbp
+     9dd:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     9e0:	e8 ec fd ff ff       	call   7d1 <bflushall>
+  return _fork();
+     9e5:	e8 7b 0a 00 00       	call   1465 <_fork>
+}
+     9ea:	5d                   	pop    %rbp
+     9eb:	c3                   	ret
+
+00000000000009ec <exit>:
+
+noreturn void exit(void) {
+     9ec:	55                   	push   %rbp
+     9ed:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     9f0:	e8 dc fd ff ff       	call   7d1 <bflushall>
+  _exit();
+     9f5:	e8 76 0a 00 00       	call   1470 <_exit>
+
+00000000000009fa <exec>:
+}
+
+int exec(char *path, char **argv) {
+     9fa:	55                   	push   %rbp
+     9fb:	48 89 e5             	mov    %rsp,%rbp
+     9fe:	48 83 ec 10          	sub    $0x10,%rsp
+     a02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     a0a:	e8 c2 fd ff ff       	call   7d1 <bflushall>
+  return _exec(path, argv);
+     a0f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a17:	48 89 d6             	mov    %rdx,%rsi
+     a1a:	48 89 c7             	mov    %rax,%rdi
+     a1d:	e8 9b 0a 00 00       	call   14bd <_exec>
+}
+     a22:	c9                   	leave
+     a23:	c3                   	ret
+
+0000000000000a24 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     a24:	55                   	push   %rbp
+     a25:	48 89 e5             	mov    %rsp,%rbp
+     a28:	48 83 ec 20          	sub    $0x20,%rsp
+     a2c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a30:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a34:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     a38:	e8 94 fd ff ff       	call   7d1 <bflushall>
+  return _spawn(path, argv, fds);
+     a3d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a41:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     a45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a49:	48 89 ce             	mov    %rcx,%rsi
+     a4c:	48 89 c7             	mov    %rax,%rdi
+     a4f:	e8 2f 0b 00 00       	call   1583 <_spawn>
+}
+     a54:	c9                   	leave
+     a55:	c3                   	ret
+
+0000000000000a56 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     a56:	55                   	push   %rbp
+     a57:	48 89 e5             	mov    %rsp,%rbp
+     a5a:	48 83 ec 10          	sub    $0x10,%rsp
+     a5e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     a61:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     a65:	78 69                	js     ad0 <close+0x7a>
+     a67:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     a6b:	7f 63                	jg     ad0 <close+0x7a>
+     a6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a70:	48 98                	cltq
+     a72:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     a79:	00 
+     a7a:	48 8d 05 bf 27 00 00 	lea    0x27bf(%rip),%rax        # 3240 <obufs>
+     a81:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     a85:	48 85 c0             	test   %rax,%rax
+     a88:	74 46                	je     ad0 <close+0x7a>
+    bflush(fd);
+     a8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a8d:	89 c7                	mov    %eax,%edi
+     a8f:	e8 b4 fc ff ff       	call   748 <bflush>
+    free(obufs[fd]);
+     a94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a97:	48 98                	cltq
+     a99:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     aa0:	00 
+     aa1:	48 8d 05 98 27 00 00 	lea    0x2798(%rip),%rax        # 3240 <obufs>
+     aa8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     aac:	48 89 c7             	mov    %rax,%rdi
+     aaf:	e8 90 11 00 00       	call   1c44 <free>
+    obufs[fd] = 0;
+     ab4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ab7:	48 98                	cltq
+     ab9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     ac0:	00 
+     ac1:	48 8d 05 78 27 00 00 	lea    0x2778(%rip),%rax        # 3240 <obufs>
+     ac8:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     acf:	00 
+  }
+  return _close(fd);
+     ad0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ad3:	89 c7                	mov    %eax,%edi
+     ad5:	e8 cd 09 00 00       	call   14a7 <_close>
+}
+     ada:	c9                   	leave
+     adb:	c3                   	ret
+
+0000000000000adc <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     adc:	55                   	push   %rbp
+     add:	48 89 e5             	mov    %rsp,%rbp
+     ae0:	53                   	push   %rbx
+     ae1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ae5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     ae9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     aed:	48 8b 36             	mov    (%rsi),%rsi
+     af0:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     af4:	48 29 f7             	sub    %rsi,%rdi
+     af7:	48 89 f9             	mov    %rdi,%rcx
+     afa:	bb 00 00 00 00       	mov    $0x0,%ebx
+     aff:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     b03:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     b07:	48 89 f0             	mov    %rsi,%rax
+     b0a:	ba 00 00 00 00       	mov    $0x0,%edx
+     b0f:	48 89 df             	mov    %rbx,%rdi
+     b12:	48 0f af f8          	imul   %rax,%rdi
+     b16:	48 89 d6             	mov    %rdx,%rsi
+     b19:	48 0f af f1          	imul   %rcx,%rsi
+     b1d:	48 01 fe             	add    %rdi,%rsi
+     b20:	48 f7 e1             	mul    %rcx
+     b23:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     b27:	48 89 ca             	mov    %rcx,%rdx
+     b2a:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     b2f:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     b33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     b37:	c9                   	leave
+     b38:	c3                   	ret
+
+0000000000000b39 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     b39:	55                   	push   %rbp
+     b3a:	48 89 e5             	mov    %rsp,%rbp
+     b3d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b41:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     b44:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     b47:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b4b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b4e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b51:	48 89 ce             	mov    %rcx,%rsi
+     b54:	48 89 f7             	mov    %rsi,%rdi
+     b57:	89 d1                	mov    %edx,%ecx
+     b59:	fc                   	cld
+     b5a:	f3 aa                	rep stos %al,%es:(%rdi)
+     b5c:	89 ca                	mov    %ecx,%edx
+     b5e:	48 89 fe             	mov    %rdi,%rsi
+     b61:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b65:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     b68:	90                   	nop
+     b69:	5d                   	pop    %rbp
+     b6a:	c3                   	ret
+
+0000000000000b6b <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     b6b:	55                   	push   %rbp
+     b6c:	48 89 e5             	mov    %rsp,%rbp
+     b6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b73:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     b77:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     b7b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b7f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     b83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b87:	48 89 ce             	mov    %rcx,%rsi
+     b8a:	48 89 f7             	mov    %rsi,%rdi
+     b8d:	48 89 d1             	mov    %rdx,%rcx
+     b90:	fc                   	cld
+     b91:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     b94:	48 89 ca             	mov    %rcx,%rdx
+     b97:	48 89 fe             	mov    %rdi,%rsi
+     b9a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     ba2:	90                   	nop
+     ba3:	5d                   	pop    %rbp
+     ba4:	c3                   	ret
+
+0000000000000ba5 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     ba5:	55                   	push   %rbp
+     ba6:	48 89 e5             	mov    %rsp,%rbp
+     ba9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     bb1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     bb5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     bb9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     bbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bc1:	48 89 cf             	mov    %rcx,%rdi
+     bc4:	48 89 d6             	mov    %rdx,%rsi
+     bc7:	48 89 c1             	mov    %rax,%rcx
+     bca:	fc                   	cld
+     bcb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     bcd:	48 89 c8             	mov    %rcx,%rax
+     bd0:	48 89 f2             	mov    %rsi,%rdx
+     bd3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bd7:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     bdb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     bdf:	90                   	nop
+     be0:	5d                   	pop    %rbp
+     be1:	c3                   	ret
+
+0000000000000be2 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     be2:	55                   	push   %rbp
+     be3:	48 89 e5             	mov    %rsp,%rbp
+     be6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     bee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     bf2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     bf6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bfe:	48 89 cf             	mov    %rcx,%rdi
+     c01:	48 89 d6             	mov    %rdx,%rsi
+     c04:	48 89 c1             	mov    %rax,%rcx
+     c07:	fc                   	cld
+     c08:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     c0b:	48 89 c8             	mov    %rcx,%rax
+     c0e:	48 89 f2             	mov    %rsi,%rdx
+     c11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c15:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     c19:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     c1d:	90                   	nop
+     c1e:	5d                   	pop    %rbp
+     c1f:	c3                   	ret
+
+0000000000000c20 <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     c20:	55                   	push   %rbp
+     c21:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     c24:	0f 31                	rdtsc
+     c26:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     c29:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     c2c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c2f:	48 c1 e0 20          	shl    $0x20,%rax
+     c33:	48 89 c2             	mov    %rax,%rdx
+     c36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c39:	48 09 d0             	or     %rdx,%rax
+}
+     c3c:	5d                   	pop    %rbp
+     c3d:	c3                   	ret
+
+0000000000000c3e <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     c3e:	55                   	push   %rbp
+     c3f:	48 89 e5             	mov    %rsp,%rbp
+     c42:	53                   	push   %rbx
+     c43:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     c46:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     c4a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     c4e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     c52:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     c56:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c59:	0f a2                	cpuid
+     c5b:	89 de                	mov    %ebx,%esi
+     c5d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     c60:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     c63:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     c66:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     c69:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     c6e:	74 09                	je     c79 <cpuid+0x3b>
+    *eaxp = eax;
+     c70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     c74:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     c77:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     c79:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     c7e:	74 09                	je     c89 <cpuid+0x4b>
+    *ebxp = ebx;
+     c80:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     c84:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c87:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     c89:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     c8e:	74 09                	je     c99 <cpuid+0x5b>
+    *ecxp = ecx;
+     c90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c94:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     c97:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     c99:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     c9e:	74 09                	je     ca9 <cpuid+0x6b>
+    *edxp = edx;
+     ca0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     ca4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     ca7:	89 10                	mov    %edx,(%rax)
+}
+     ca9:	90                   	nop
+     caa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     cae:	c9                   	leave
+     caf:	c3                   	ret
+
+0000000000000cb0 <strcpy>:
+char *strcpy(char *s, char *t) {
+     cb0:	55                   	push   %rbp
+     cb1:	48 89 e5             	mov    %rsp,%rbp
+     cb4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     cb8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     cbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cc0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     cc4:	90                   	nop
+     cc5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     cc9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     ccd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     cd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cd5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     cd9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     cdd:	0f b6 12             	movzbl (%rdx),%edx
+     ce0:	88 10                	mov    %dl,(%rax)
+     ce2:	0f b6 00             	movzbl (%rax),%eax
+     ce5:	84 c0                	test   %al,%al
+     ce7:	75 dc                	jne    cc5 <strcpy+0x15>
+  return os;
+     ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     ced:	5d                   	pop    %rbp
+     cee:	c3                   	ret
+
+0000000000000cef <strcmp>:
+int strcmp(const char *p, const char *q) {
+     cef:	55                   	push   %rbp
+     cf0:	48 89 e5             	mov    %rsp,%rbp
+     cf3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cf7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     cfb:	eb 0a                	jmp    d07 <strcmp+0x18>
+    p++, q++;
+     cfd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     d02:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     d07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d0b:	0f b6 00             	movzbl (%rax),%eax
+     d0e:	84 c0                	test   %al,%al
+     d10:	74 12                	je     d24 <strcmp+0x35>
+     d12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d16:	0f b6 10             	movzbl (%rax),%edx
+     d19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d1d:	0f b6 00             	movzbl (%rax),%eax
+     d20:	38 c2                	cmp    %al,%dl
+     d22:	74 d9                	je     cfd <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     d24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d28:	0f b6 00             	movzbl (%rax),%eax
+     d2b:	0f b6 d0             	movzbl %al,%edx
+     d2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d32:	0f b6 00             	movzbl (%rax),%eax
+     d35:	0f b6 c0             	movzbl %al,%eax
+     d38:	29 c2                	sub    %eax,%edx
+     d3a:	89 d0                	mov    %edx,%eax
+}
+     d3c:	5d                   	pop    %rbp
+     d3d:	c3                   	ret
+
+0000000000000d3e <strlen>:
+uint strlen(char *s) {
+     d3e:	55                   	push   %rbp
+     d3f:	48 89 e5             	mov    %rsp,%rbp
+     d42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     d46:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d4d:	eb 04                	jmp    d53 <strlen+0x15>
+     d4f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d56:	48 63 d0             	movslq %eax,%rdx
+     d59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d5d:	48 01 d0             	add    %rdx,%rax
+     d60:	0f b6 00             	movzbl (%rax),%eax
+     d63:	84 c0                	test   %al,%al
+     d65:	75 e8                	jne    d4f <strlen+0x11>
+    ;
+  return n;
+     d67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     d6a:	5d                   	pop    %rbp
+     d6b:	c3                   	ret
+
+0000000000000d6c <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     d6c:	55                   	push   %rbp
+     d6d:	48 89 e5             	mov    %rsp,%rbp
+     d70:	53                   	push   %rbx
+     d71:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     d75:	8b 05 b9 22 00 00    	mov    0x22b9(%rip),%eax        # 3034 <erms>
+     d7b:	85 c0                	test   %eax,%eax
+     d7d:	79 53                	jns    dd2 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     d7f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     d83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     d89:	b9 00 00 00 00       	mov    $0x0,%ecx
+     d8e:	ba 00 00 00 00       	mov    $0x0,%edx
+     d93:	48 89 c6             	mov    %rax,%rsi
+     d96:	bf 00 00 00 00       	mov    $0x0,%edi
+     d9b:	e8 9e fe ff ff       	call   c3e <cpuid>
+    ebx = 0;
+     da0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     da7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     daa:	83 f8 06             	cmp    $0x6,%eax
+     dad:	76 14                	jbe    dc3 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     daf:	b8 07 00 00 00       	mov    $0x7,%eax
+     db4:	b9 00 00 00 00       	mov    $0x0,%ecx
+     db9:	0f a2                	cpuid
+     dbb:	89 d9                	mov    %ebx,%ecx
+     dbd:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     dc0:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     dc3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     dc6:	c1 e8 09             	shr    $0x9,%eax
+     dc9:	83 e0 01             	and    $0x1,%eax
+     dcc:	89 05 62 22 00 00    	mov    %eax,0x2262(%rip)        # 3034 <erms>
+  }
+  return erms;
+     dd2:	8b 05 5c 22 00 00    	mov    0x225c(%rip),%eax        # 3034 <erms>
+}
+     dd8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     ddc:	c9                   	leave
+     ddd:	c3                   	ret
+
+0000000000000dde <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     dde:	55                   	push   %rbp
+     ddf:	48 89 e5             	mov    %rsp,%rbp
+     de2:	48 83 ec 10          	sub    $0x10,%rsp
+     de6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     dea:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ded:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     df0:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     df4:	76 09                	jbe    dff <memset+0x21>
+     df6:	e8 71 ff ff ff       	call   d6c <haserms>
+     dfb:	85 c0                	test   %eax,%eax
+     dfd:	74 16                	je     e15 <memset+0x37>
+    stosb(dst, c, n);
+     dff:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     e02:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     e05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e09:	89 ce                	mov    %ecx,%esi
+     e0b:	48 89 c7             	mov    %rax,%rdi
+     e0e:	e8 26 fd ff ff       	call   b39 <stosb>
+     e13:	eb 58                	jmp    e6d <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     e15:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e18:	c1 e8 03             	shr    $0x3,%eax
+     e1b:	89 c6                	mov    %eax,%esi
+     e1d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e20:	48 98                	cltq
+     e22:	0f b6 c0             	movzbl %al,%eax
+     e25:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     e2c:	01 01 01 
+     e2f:	48 0f af c2          	imul   %rdx,%rax
+     e33:	48 89 c1             	mov    %rax,%rcx
+     e36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e3a:	48 89 f2             	mov    %rsi,%rdx
+     e3d:	48 89 ce             	mov    %rcx,%rsi
+     e40:	48 89 c7             	mov    %rax,%rdi
+     e43:	e8 23 fd ff ff       	call   b6b <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     e48:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e4b:	83 e0 07             	and    $0x7,%eax
+     e4e:	89 c2                	mov    %eax,%edx
+     e50:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     e53:	83 e0 f8             	and    $0xfffffff8,%eax
+     e56:	48 89 c1             	mov    %rax,%rcx
+     e59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e5d:	48 01 c1             	add    %rax,%rcx
+     e60:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e63:	89 c6                	mov    %eax,%esi
+     e65:	48 89 cf             	mov    %rcx,%rdi
+     e68:	e8 cc fc ff ff       	call   b39 <stosb>
+  }
+  return dst;
+     e6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     e71:	c9                   	leave
+     e72:	c3                   	ret
+
+0000000000000e73 <strchr>:
+
+char *strchr(const char *s, char c) {
+     e73:	55                   	push   %rbp
+     e74:	48 89 e5             	mov    %rsp,%rbp
+     e77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     e7b:	89 f0                	mov    %esi,%eax
+     e7d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     e80:	eb 17                	jmp    e99 <strchr+0x26>
+    if (*s == c)
+     e82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e86:	0f b6 00             	movzbl (%rax),%eax
+     e89:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     e8c:	75 06                	jne    e94 <strchr+0x21>
+      return (char *)s;
+     e8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e92:	eb 15                	jmp    ea9 <strchr+0x36>
+  for (; *s; s++)
+     e94:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e9d:	0f b6 00             	movzbl (%rax),%eax
+     ea0:	84 c0                	test   %al,%al
+     ea2:	75 de                	jne    e82 <strchr+0xf>
+  return 0;
+     ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ea9:	5d                   	pop    %rbp
+     eaa:	c3                   	ret
+
+0000000000000eab <gets>:
+
+char *gets(char *buf, int max) {
+     eab:	55                   	push   %rbp
+     eac:	48 89 e5             	mov    %rsp,%rbp
+     eaf:	48 83 ec 20          	sub    $0x20,%rsp
+     eb3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     eb7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     eba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ec1:	eb 48                	jmp    f0b <gets+0x60>
+    cc = read(0, &c, 1);
+     ec3:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     ec7:	ba 01 00 00 00       	mov    $0x1,%edx
+     ecc:	48 89 c6             	mov    %rax,%rsi
+     ecf:	bf 00 00 00 00       	mov    $0x0,%edi
+     ed4:	e8 b8 05 00 00       	call   1491 <read>
+     ed9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     edc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ee0:	7e 36                	jle    f18 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     ee2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ee5:	8d 50 01             	lea    0x1(%rax),%edx
+     ee8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     eeb:	48 63 d0             	movslq %eax,%rdx
+     eee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ef2:	48 01 c2             	add    %rax,%rdx
+     ef5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ef9:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     efb:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     eff:	3c 0a                	cmp    $0xa,%al
+     f01:	74 16                	je     f19 <gets+0x6e>
+     f03:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     f07:	3c 0d                	cmp    $0xd,%al
+     f09:	74 0e                	je     f19 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     f0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f0e:	83 c0 01             	add    $0x1,%eax
+     f11:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     f14:	7f ad                	jg     ec3 <gets+0x18>
+     f16:	eb 01                	jmp    f19 <gets+0x6e>
+      break;
+     f18:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     f19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f1c:	48 63 d0             	movslq %eax,%rdx
+     f1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f23:	48 01 d0             	add    %rdx,%rax
+     f26:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     f29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     f2d:	c9                   	leave
+     f2e:	c3                   	ret
+
+0000000000000f2f <stat>:
+
+int stat(char *n, struct stat *st) {
+     f2f:	55                   	push   %rbp
+     f30:	48 89 e5             	mov    %rsp,%rbp
+     f33:	48 83 ec 10          	sub    $0x10,%rsp
+     f37:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     f3b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     f3f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f47:	48 89 c6             	mov    %rax,%rsi
+     f4a:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     f4f:	e8 58 07 00 00       	call   16ac <fstatat>
+}
+     f54:	c9                   	leave
+     f55:	c3                   	ret
+
+0000000000000f56 <atoi>:
+
+int atoi(const char *s) {
+     f56:	55                   	push   %rbp
+     f57:	48 89 e5             	mov    %rsp,%rbp
+     f5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     f5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f65:	eb 28                	jmp    f8f <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     f67:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f6a:	89 d0                	mov    %edx,%eax
+     f6c:	c1 e0 02             	shl    $0x2,%eax
+     f6f:	01 d0                	add    %edx,%eax
+     f71:	01 c0                	add    %eax,%eax
+     f73:	89 c1                	mov    %eax,%ecx
+     f75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f79:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     f7d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     f81:	0f b6 00             	movzbl (%rax),%eax
+     f84:	0f be c0             	movsbl %al,%eax
+     f87:	01 c8                	add    %ecx,%eax
+     f89:	83 e8 30             	sub    $0x30,%eax
+     f8c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     f8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f93:	0f b6 00             	movzbl (%rax),%eax
+     f96:	3c 2f                	cmp    $0x2f,%al
+     f98:	7e 0b                	jle    fa5 <atoi+0x4f>
+     f9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f9e:	0f b6 00             	movzbl (%rax),%eax
+     fa1:	3c 39                	cmp    $0x39,%al
+     fa3:	7e c2                	jle    f67 <atoi+0x11>
+  return n;
+     fa5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     fa8:	5d                   	pop    %rbp
+     fa9:	c3                   	ret
+
+0000000000000faa <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     faa:	55                   	push   %rbp
+     fab:	48 89 e5             	mov    %rsp,%rbp
+     fae:	48 83 ec 28          	sub    $0x28,%rsp
+     fb2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     fb6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     fba:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     fbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fc1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     fc5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     fc9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     fcd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     fd1:	7f 09                	jg     fdc <memmove+0x32>
+    return vdst;
+     fd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fd7:	e9 29 01 00 00       	jmp    1105 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fe0:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     fe4:	0f 83 87 00 00 00    	jae    1071 <memmove+0xc7>
+     fea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fed:	48 63 d0             	movslq %eax,%rdx
+     ff0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ff4:	48 01 d0             	add    %rdx,%rax
+     ff7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ffb:	73 74                	jae    1071 <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     ffd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1000:	48 98                	cltq
+    1002:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+    1006:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1009:	48 98                	cltq
+    100b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+    100f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1013:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1017:	48 09 d0             	or     %rdx,%rax
+    101a:	83 e0 07             	and    $0x7,%eax
+    101d:	48 85 c0             	test   %rax,%rax
+    1020:	75 3d                	jne    105f <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+    1022:	eb 1c                	jmp    1040 <memmove+0x96>
+        src -= 8;
+    1024:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+    1029:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+    102e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1032:	48 8b 10             	mov    (%rax),%rdx
+    1035:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1039:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+    103c:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+    1040:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1044:	7f de                	jg     1024 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+    1046:	eb 17                	jmp    105f <memmove+0xb5>
+      *--dst = *--src;
+    1048:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+    104d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+    1052:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1056:	0f b6 10             	movzbl (%rax),%edx
+    1059:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105d:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+    105f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1062:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1065:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1068:	85 c0                	test   %eax,%eax
+    106a:	7f dc                	jg     1048 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+    106c:	e9 90 00 00 00       	jmp    1101 <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+    1071:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+    1075:	7e 09                	jle    1080 <memmove+0xd6>
+    1077:	e8 f0 fc ff ff       	call   d6c <haserms>
+    107c:	85 c0                	test   %eax,%eax
+    107e:	74 1b                	je     109b <memmove+0xf1>
+    movsb(dst, src, n);
+    1080:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1083:	48 63 d0             	movslq %eax,%rdx
+    1086:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    108a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    108e:	48 89 ce             	mov    %rcx,%rsi
+    1091:	48 89 c7             	mov    %rax,%rdi
+    1094:	e8 0c fb ff ff       	call   ba5 <movsb>
+    1099:	eb 66                	jmp    1101 <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+    109b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    109e:	8d 50 07             	lea    0x7(%rax),%edx
+    10a1:	85 c0                	test   %eax,%eax
+    10a3:	0f 48 c2             	cmovs  %edx,%eax
+    10a6:	c1 f8 03             	sar    $0x3,%eax
+    10a9:	48 63 d0             	movslq %eax,%rdx
+    10ac:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    10b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10b4:	48 89 ce             	mov    %rcx,%rsi
+    10b7:	48 89 c7             	mov    %rax,%rdi
+    10ba:	e8 23 fb ff ff       	call   be2 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+    10bf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10c2:	89 d0                	mov    %edx,%eax
+    10c4:	c1 f8 1f             	sar    $0x1f,%eax
+    10c7:	c1 e8 1d             	shr    $0x1d,%eax
+    10ca:	01 c2                	add    %eax,%edx
+    10cc:	83 e2 07             	and    $0x7,%edx
+    10cf:	29 c2                	sub    %eax,%edx
+    10d1:	89 d0                	mov    %edx,%eax
+    10d3:	48 98                	cltq
+    10d5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10d8:	83 e2 f8             	and    $0xfffffff8,%edx
+    10db:	48 63 ca             	movslq %edx,%rcx
+    10de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    10e2:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+    10e6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    10e9:	83 e2 f8             	and    $0xfffffff8,%edx
+    10ec:	48 63 ca             	movslq %edx,%rcx
+    10ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    10f3:	48 01 d1             	add    %rdx,%rcx
+    10f6:	48 89 c2             	mov    %rax,%rdx
+    10f9:	48 89 cf             	mov    %rcx,%rdi
+    10fc:	e8 a4 fa ff ff       	call   ba5 <movsb>
+  }
+  return vdst;
+    1101:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1105:	c9                   	leave
+    1106:	c3                   	ret
+
+0000000000001107 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+    1107:	55                   	push   %rbp
+    1108:	48 89 e5             	mov    %rsp,%rbp
+    110b:	48 83 ec 20          	sub    $0x20,%rsp
+    110f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+    1112:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+    1116:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+    111d:	00 00 00 
+    1120:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    1124:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+    1128:	75 0d                	jne    1137 <clock_gettime+0x30>
+    112a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    112e:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1132:	48 85 c0             	test   %rax,%rax
+    1135:	75 13                	jne    114a <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+    1137:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    113b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    113e:	48 89 d6             	mov    %rdx,%rsi
+    1141:	89 c7                	mov    %eax,%edi
+    1143:	e8 e0 04 00 00       	call   1628 <_clock_gettime>
+    1148:	eb 7d                	jmp    11c7 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+    114a:	e8 d1 fa ff ff       	call   c20 <rdtsc>
+    114f:	48 89 c2             	mov    %rax,%rdx
+    1152:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1156:	48 89 d6             	mov    %rdx,%rsi
+    1159:	48 89 c7             	mov    %rax,%rdi
+    115c:	e8 7b f9 ff ff       	call   adc <clockns>
+    1161:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+    1165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1169:	48 c1 e8 09          	shr    $0x9,%rax
+    116d:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    1174:	b8 44 00 
+    1177:	48 f7 e2             	mul    %rdx
+    117a:	48 89 d0             	mov    %rdx,%rax
+    117d:	48 c1 e8 0b          	shr    $0xb,%rax
+    1181:	48 89 c2             	mov    %rax,%rdx
+    1184:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1188:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+    118b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+    118f:	48 89 c8             	mov    %rcx,%rax
+    1192:	48 c1 e8 09          	shr    $0x9,%rax
+    1196:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+    119d:	b8 44 00 
+    11a0:	48 f7 e2             	mul    %rdx
+    11a3:	48 89 d0             	mov    %rdx,%rax
+    11a6:	48 c1 e8 0b          	shr    $0xb,%rax
+    11aa:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+    11b1:	48 89 c8             	mov    %rcx,%rax
+    11b4:	48 29 d0             	sub    %rdx,%rax
+    11b7:	48 89 c2             	mov    %rax,%rdx
+    11ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    11be:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+    11c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11c7:	c9                   	leave
+    11c8:	c3                   	ret
+
+00000000000011c9 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+    11c9:	55                   	push   %rbp
+    11ca:	48 89 e5             	mov    %rsp,%rbp
+    11cd:	48 83 ec 10          	sub    $0x10,%rsp
+    11d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    11d5:	eb 11                	jmp    11e8 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+    11d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11db:	be 02 00 00 00       	mov    $0x2,%esi
+    11e0:	48 89 c7             	mov    %rax,%rdi
+    11e3:	e8 6c 04 00 00       	call   1654 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    11e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    11ec:	b8 02 00 00 00       	mov    $0x2,%eax
+    11f1:	87 02                	xchg   %eax,(%rdx)
+    11f3:	85 c0                	test   %eax,%eax
+    11f5:	75 e0                	jne    11d7 <mutex_wait+0xe>
+}
+    11f7:	90                   	nop
+    11f8:	90                   	nop
+    11f9:	c9                   	leave
+    11fa:	c3                   	ret
+
+00000000000011fb <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    11fb:	55                   	push   %rbp
+    11fc:	48 89 e5             	mov    %rsp,%rbp
+    11ff:	48 83 ec 20          	sub    $0x20,%rsp
+    1203:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1207:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    120e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1212:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1216:	8b 02                	mov    (%rdx),%eax
+    1218:	b9 01 00 00 00       	mov    $0x1,%ecx
+    121d:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    1221:	89 c1                	mov    %eax,%ecx
+    1223:	0f 94 c0             	sete   %al
+    1226:	84 c0                	test   %al,%al
+    1228:	75 02                	jne    122c <mutex_lock+0x31>
+    122a:	89 0a                	mov    %ecx,(%rdx)
+    122c:	83 f0 01             	xor    $0x1,%eax
+    122f:	84 c0                	test   %al,%al
+    1231:	74 0c                	je     123f <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1233:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1237:	48 89 c7             	mov    %rax,%rdi
+    123a:	e8 8a ff ff ff       	call   11c9 <mutex_wait>
+}
+    123f:	90                   	nop
+    1240:	c9                   	leave
+    1241:	c3                   	ret
+
+0000000000001242 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1242:	55                   	push   %rbp
+    1243:	48 89 e5             	mov    %rsp,%rbp
+    1246:	48 83 ec 10          	sub    $0x10,%rsp
+    124a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    124e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1252:	ba 00 00 00 00       	mov    $0x0,%edx
+    1257:	87 10                	xchg   %edx,(%rax)
+    1259:	83 fa 02             	cmp    $0x2,%edx
+    125c:	75 11                	jne    126f <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    125e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1262:	be 01 00 00 00       	mov    $0x1,%esi
+    1267:	48 89 c7             	mov    %rax,%rdi
+    126a:	e8 f0 03 00 00       	call   165f <futex_wake>
+}
+    126f:	90                   	nop
+    1270:	c9                   	leave
+    1271:	c3                   	ret
+
+0000000000001272 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1272:	55                   	push   %rbp
+    1273:	48 89 e5             	mov    %rsp,%rbp
+    1276:	48 83 ec 20          	sub    $0x20,%rsp
+    127a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    127e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    1282:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1286:	48 83 c0 04          	add    $0x4,%rax
+    128a:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    128e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1292:	8b 00                	mov    (%rax),%eax
+    1294:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    1297:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    129b:	48 89 c7             	mov    %rax,%rdi
+    129e:	e8 9f ff ff ff       	call   1242 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    12a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12a7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    12aa:	89 d6                	mov    %edx,%esi
+    12ac:	48 89 c7             	mov    %rax,%rdi
+    12af:	e8 a0 03 00 00       	call   1654 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    12b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12b8:	48 83 c0 04          	add    $0x4,%rax
+    12bc:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    12c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    12c4:	48 89 c7             	mov    %rax,%rdi
+    12c7:	e8 fd fe ff ff       	call   11c9 <mutex_wait>
+}
+    12cc:	90                   	nop
+    12cd:	c9                   	leave
+    12ce:	c3                   	ret
+
+00000000000012cf <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    12cf:	55                   	push   %rbp
+    12d0:	48 89 e5             	mov    %rsp,%rbp
+    12d3:	48 83 ec 10          	sub    $0x10,%rsp
+    12d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    12db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12df:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    12e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12e7:	48 83 c0 04          	add    $0x4,%rax
+    12eb:	8b 00                	mov    (%rax),%eax
+    12ed:	85 c0                	test   %eax,%eax
+    12ef:	7e 11                	jle    1302 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    12f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12f5:	be 01 00 00 00       	mov    $0x1,%esi
+    12fa:	48 89 c7             	mov    %rax,%rdi
+    12fd:	e8 5d 03 00 00       	call   165f <futex_wake>
+}
+    1302:	90                   	nop
+    1303:	c9                   	leave
+    1304:	c3                   	ret
+
+0000000000001305 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1305:	55                   	push   %rbp
+    1306:	48 89 e5             	mov    %rsp,%rbp
+    1309:	48 83 ec 10          	sub    $0x10,%rsp
+    130d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    1311:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1315:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1319:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    131d:	48 83 c0 04          	add    $0x4,%rax
+    1321:	8b 00                	mov    (%rax),%eax
+    1323:	85 c0                	test   %eax,%eax
+    1325:	7e 11                	jle    1338 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1327:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    132b:	be 00 00 00 40       	mov    $0x40000000,%esi
+    1330:	48 89 c7             	mov    %rax,%rdi
+    1333:	e8 27 03 00 00       	call   165f <futex_wake>
+}
+    1338:	90                   	nop
+    1339:	c9                   	leave
+    133a:	c3                   	ret
+
+000000000000133b <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    133b:	55                   	push   %rbp
+    133c:	48 89 e5             	mov    %rsp,%rbp
+    133f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1343:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1346:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    134a:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    134e:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1352:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1356:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    135a:	8b 40 04             	mov    0x4(%rax),%eax
+    135d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    1360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1364:	8b 00                	mov    (%rax),%eax
+    1366:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1369:	29 c2                	sub    %eax,%edx
+    136b:	83 fa 1f             	cmp    $0x1f,%edx
+    136e:	76 07                	jbe    1377 <ring_push+0x3c>
+    return -1;
+    1370:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1375:	eb 7e                	jmp    13f5 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1377:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    137a:	83 e0 1f             	and    $0x1f,%eax
+    137d:	89 c2                	mov    %eax,%edx
+    137f:	48 89 d0             	mov    %rdx,%rax
+    1382:	48 01 c0             	add    %rax,%rax
+    1385:	48 01 d0             	add    %rdx,%rax
+    1388:	48 c1 e0 04          	shl    $0x4,%rax
+    138c:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    1390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1394:	48 01 d0             	add    %rdx,%rax
+    1397:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    139b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    139f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    13a2:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    13a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13a8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    13ac:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    13b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13b4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    13b8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    13bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13c0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    13c4:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    13c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    13d0:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    13d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13d8:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    13dc:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    13e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13e3:	8d 50 01             	lea    0x1(%rax),%edx
+    13e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13ea:	48 83 c0 04          	add    $0x4,%rax
+    13ee:	89 10                	mov    %edx,(%rax)
+  return 0;
+    13f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    13f5:	5d                   	pop    %rbp
+    13f6:	c3                   	ret
+
+00000000000013f7 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    13f7:	55                   	push   %rbp
+    13f8:	48 89 e5             	mov    %rsp,%rbp
+    13fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1403:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1407:	8b 40 08             	mov    0x8(%rax),%eax
+    140a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    140d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1411:	48 83 c0 0c          	add    $0xc,%rax
+    1415:	8b 00                	mov    (%rax),%eax
+    1417:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    141a:	75 07                	jne    1423 <ring_pop+0x2c>
+    return -1;
+    141c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1421:	eb 40                	jmp    1463 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1423:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1426:	83 e0 1f             	and    $0x1f,%eax
+    1429:	89 c2                	mov    %eax,%edx
+    142b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    142f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1433:	89 d2                	mov    %edx,%edx
+    1435:	48 83 c2 61          	add    $0x61,%rdx
+    1439:	48 c1 e2 04          	shl    $0x4,%rdx
+    143d:	48 01 d0             	add    %rdx,%rax
+    1440:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1444:	48 8b 00             	mov    (%rax),%rax
+    1447:	48 89 01             	mov    %rax,(%rcx)
+    144a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    144e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1451:	8d 50 01             	lea    0x1(%rax),%edx
+    1454:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1458:	48 83 c0 08          	add    $0x8,%rax
+    145c:	89 10                	mov    %edx,(%rax)
+  return 0;
+    145e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1463:	5d                   	pop    %rbp
+    1464:	c3                   	ret
+
+0000000000001465 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1465:	b8 01 00 00 00       	mov    $0x1,%eax
+    146a:	49 89 ca             	mov    %rcx,%r10
+    146d:	0f 05                	syscall
+    146f:	c3                   	ret
+
+0000000000001470 <_exit>:
+SYSCALL_(exit)
+    1470:	b8 02 00 00 00       	mov    $0x2,%eax
+    1475:	49 89 ca             	mov    %rcx,%r10
+    1478:	0f 05                	syscall
+    147a:	c3                   	ret
+
+000000000000147b <wait>:
+SYSCALL(wait)
+    147b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1480:	49 89 ca             	mov    %rcx,%r10
+    1483:	0f 05                	syscall
+    1485:	c3                   	ret
+
+0000000000001486 <pipe>:
+SYSCALL(pipe)
+    1486:	b8 04 00 00 00       	mov    $0x4,%eax
+    148b:	49 89 ca             	mov    %rcx,%r10
+    148e:	0f 05                	syscall
+    1490:	c3                   	ret
+
+0000000000001491 <read>:
+SYSCALL(read)
+    1491:	b8 05 00 00 00       	mov    $0x5,%eax
+    1496:	49 89 ca             	mov    %rcx,%r10
+    1499:	0f 05                	syscall
+    149b:	c3                   	ret
+
+000000000000149c <write>:
+SYSCALL(write)
+    149c:	b8 10 00 00 00       	mov    $0x10,%eax
+    14a1:	49 89 ca             	mov    %rcx,%r10
+    14a4:	0f 05                	syscall
+    14a6:	c3                   	ret
+
+00000000000014a7 <_close>:
+SYSCALL_(close)
+    14a7:	b8 15 00 00 00       	mov    $0x15,%eax
+    14ac:	49 89 ca             	mov    %rcx,%r10
+    14af:	0f 05                	syscall
+    14b1:	c3                   	ret
+
+00000000000014b2 <kill>:
+SYSCALL(kill)
+    14b2:	b8 06 00 00 00       	mov    $0x6,%eax
+    14b7:	49 89 ca             	mov    %rcx,%r10
+    14ba:	0f 05                	syscall
+    14bc:	c3                   	ret
+
+00000000000014bd <_exec>:
+SYSCALL_(exec)
+    14bd:	b8 07 00 00 00       	mov    $0x7,%eax
+    14c2:	49 89 ca             	mov    %rcx,%r10
+    14c5:	0f 05                	syscall
+    14c7:	c3                   	ret
+
+00000000000014c8 <open>:
+SYSCALL(open)
+    14c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14cd:	49 89 ca             	mov    %rcx,%r10
+    14d0:	0f 05                	syscall
+    14d2:	c3                   	ret
+
+00000000000014d3 <mknod>:
+SYSCALL(mknod)
+    14d3:	b8 11 00 00 00       	mov    $0x11,%eax
+    14d8:	49 89 ca             	mov    %rcx,%r10
+    14db:	0f 05                	syscall
+    14dd:	c3                   	ret
+
+00000000000014de <unlink>:
+SYSCALL(unlink)
+    14de:	b8 12 00 00 00       	mov    $0x12,%eax
+    14e3:	49 89 ca             	mov    %rcx,%r10
+    14e6:	0f 05                	syscall
+    14e8:	c3                   	ret
+
+00000000000014e9 <fstat>:
+SYSCALL(fstat)
+    14e9:	b8 08 00 00 00       	mov    $0x8,%eax
+    14ee:	49 89 ca             	mov    %rcx,%r10
+    14f1:	0f 05                	syscall
+    14f3:	c3                   	ret
+
+00000000000014f4 <link>:
+SYSCALL(link)
+    14f4:	b8 13 00 00 00       	mov    $0x13,%eax
+    14f9:	49 89 ca             	mov    %rcx,%r10
+    14fc:	0f 05                	syscall
+    14fe:	c3                   	ret
+
+00000000000014ff <mkdir>:
+SYSCALL(mkdir)
+    14ff:	b8 14 00 00 00       	mov    $0x14,%eax
+    1504:	49 89 ca             	mov    %rcx,%r10
+    1507:	0f 05                	syscall
+    1509:	c3                   	ret
+
+000000000000150a <chdir>:
+SYSCALL(chdir)
+    150a:	b8 09 00 00 00       	mov    $0x9,%eax
+    150f:	49 89 ca             	mov    %rcx,%r10
+    1512:	0f 05                	syscall
+    1514:	c3                   	ret
+
+0000000000001515 <dup>:
+SYSCALL(dup)
+    1515:	b8 0a 00 00 00       	mov    $0xa,%eax
+    151a:	49 89 ca             	mov    %rcx,%r10
+    151d:	0f 05                	syscall
+    151f:	c3                   	ret
+
+0000000000001520 <getpid>:
+SYSCALL(getpid)
+    1520:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1525:	49 89 ca             	mov    %rcx,%r10
+    1528:	0f 05                	syscall
+    152a:	c3                   	ret
+
+000000000000152b <sbrk>:
+SYSCALL(sbrk)
+    152b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1530:	49 89 ca             	mov    %rcx,%r10
+    1533:	0f 05                	syscall
+    1535:	c3                   	ret
+
+0000000000001536 <sleep>:
+SYSCALL(sleep)
+    1536:	b8 0d 00 00 00       	mov    $0xd,%eax
+    153b:	49 89 ca             	mov    %rcx,%r10
+    153e:	0f 05                	syscall
+    1540:	c3                   	ret
+
+0000000000001541 <uptime>:
+SYSCALL(uptime)
+    1541:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1546:	49 89 ca             	mov    %rcx,%r10
+    1549:	0f 05                	syscall
+    154b:	c3                   	ret
+
+000000000000154c <sysinfo>:
+SYSCALL(sysinfo)
+    154c:	b8 16 00 00 00       	mov    $0x16,%eax
+    1551:	49 89 ca             	mov    %rcx,%r10
+    1554:	0f 05                	syscall
+    1556:	c3                   	ret
+
+0000000000001557 <crashn>:
+SYSCALL(crashn)
+    1557:	b8 17 00 00 00       	mov    $0x17,%eax
+    155c:	49 89 ca             	mov    %rcx,%r10
+    155f:	0f 05                	syscall
+    1561:	c3                   	ret
+
+0000000000001562 <mmap>:
+SYSCALL(mmap)
+    1562:	b8 18 00 00 00       	mov    $0x18,%eax
+    1567:	49 89 ca             	mov    %rcx,%r10
+    156a:	0f 05                	syscall
+    156c:	c3                   	ret
+
+000000000000156d <munmap>:
+SYSCALL(munmap)
+    156d:	b8 19 00 00 00       	mov    $0x19,%eax
+    1572:	49 89 ca             	mov    %rcx,%r10
+    1575:	0f 05                	syscall
+    1577:	c3                   	ret
+
+0000000000001578 <nice>:
+SYSCALL(nice)
+    1578:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    157d:	49 89 ca             	mov    %rcx,%r10
+    1580:	0f 05                	syscall
+    1582:	c3                   	ret
+
+0000000000001583 <_spawn>:
+SYSCALL_(spawn)
+    1583:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1588:	49 89 ca             	mov    %rcx,%r10
+    158b:	0f 05                	syscall
+    158d:	c3                   	ret
+
+000000000000158e <pread>:
+SYSCALL(pread)
+    158e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1593:	49 89 ca             	mov    %rcx,%r10
+    1596:	0f 05                	syscall
+    1598:	c3                   	ret
+
+0000000000001599 <pwrite>:
+SYSCALL(pwrite)
+    1599:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    159e:	49 89 ca             	mov    %rcx,%r10
+    15a1:	0f 05                	syscall
+    15a3:	c3                   	ret
+
+00000000000015a4 <readv>:
+SYSCALL(readv)
+    15a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15a9:	49 89 ca             	mov    %rcx,%r10
+    15ac:	0f 05                	syscall
+    15ae:	c3                   	ret
+
+00000000000015af <writev>:
+SYSCALL(writev)
+    15af:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15b4:	49 89 ca             	mov    %rcx,%r10
+    15b7:	0f 05                	syscall
+    15b9:	c3                   	ret
+
+00000000000015ba <sendfile>:
+SYSCALL(sendfile)
+    15ba:	b8 20 00 00 00       	mov    $0x20,%eax
+    15bf:	49 89 ca             	mov    %rcx,%r10
+    15c2:	0f 05                	syscall
+    15c4:	c3                   	ret
+
+00000000000015c5 <splice>:
+SYSCALL(splice)
+    15c5:	b8 21 00 00 00       	mov    $0x21,%eax
+    15ca:	49 89 ca             	mov    %rcx,%r10
+    15cd:	0f 05                	syscall
+    15cf:	c3                   	ret
+
+00000000000015d0 <poll>:
+SYSCALL(poll)
+    15d0:	b8 22 00 00 00       	mov    $0x22,%eax
+    15d5:	49 89 ca             	mov    %rcx,%r10
+    15d8:	0f 05                	syscall
+    15da:	c3                   	ret
+
+00000000000015db <fsync>:
+SYSCALL(fsync)
+    15db:	b8 23 00 00 00       	mov    $0x23,%eax
+    15e0:	49 89 ca             	mov    %rcx,%r10
+    15e3:	0f 05                	syscall
+    15e5:	c3                   	ret
+
+00000000000015e6 <fdatasync>:
+SYSCALL(fdatasync)
+    15e6:	b8 24 00 00 00       	mov    $0x24,%eax
+    15eb:	49 89 ca             	mov    %rcx,%r10
+    15ee:	0f 05                	syscall
+    15f0:	c3                   	ret
+
+00000000000015f1 <lockstat>:
+SYSCALL(lockstat)
+    15f1:	b8 25 00 00 00       	mov    $0x25,%eax
+    15f6:	49 89 ca             	mov    %rcx,%r10
+    15f9:	0f 05                	syscall
+    15fb:	c3                   	ret
+
+00000000000015fc <syscallstat>:
+SYSCALL(syscallstat)
+    15fc:	b8 26 00 00 00       	mov    $0x26,%eax
+    1601:	49 89 ca             	mov    %rcx,%r10
+    1604:	0f 05                	syscall
+    1606:	c3                   	ret
+
+0000000000001607 <trace>:
+SYSCALL(trace)
+    1607:	b8 27 00 00 00       	mov    $0x27,%eax
+    160c:	49 89 ca             	mov    %rcx,%r10
+    160f:	0f 05                	syscall
+    1611:	c3                   	ret
+
+0000000000001612 <profile>:
+SYSCALL(profile)
+    1612:	b8 28 00 00 00       	mov    $0x28,%eax
+    1617:	49 89 ca             	mov    %rcx,%r10
+    161a:	0f 05                	syscall
+    161c:	c3                   	ret
+
+000000000000161d <cycles>:
+SYSCALL(cycles)
+    161d:	b8 29 00 00 00       	mov    $0x29,%eax
+    1622:	49 89 ca             	mov    %rcx,%r10
+    1625:	0f 05                	syscall
+    1627:	c3                   	ret
+
+0000000000001628 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1628:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    162d:	49 89 ca             	mov    %rcx,%r10
+    1630:	0f 05                	syscall
+    1632:	c3                   	ret
+
+0000000000001633 <consmode>:
+SYSCALL(consmode)
+    1633:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1638:	49 89 ca             	mov    %rcx,%r10
+    163b:	0f 05                	syscall
+    163d:	c3                   	ret
+
+000000000000163e <clone>:
+SYSCALL(clone)
+    163e:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1643:	49 89 ca             	mov    %rcx,%r10
+    1646:	0f 05                	syscall
+    1648:	c3                   	ret
+
+0000000000001649 <join>:
+SYSCALL(join)
+    1649:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    164e:	49 89 ca             	mov    %rcx,%r10
+    1651:	0f 05                	syscall
+    1653:	c3                   	ret
+
+0000000000001654 <futex_wait>:
+SYSCALL(futex_wait)
+    1654:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1659:	49 89 ca             	mov    %rcx,%r10
+    165c:	0f 05                	syscall
+    165e:	c3                   	ret
+
+000000000000165f <futex_wake>:
+SYSCALL(futex_wake)
+    165f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1664:	49 89 ca             	mov    %rcx,%r10
+    1667:	0f 05                	syscall
+    1669:	c3                   	ret
+
+000000000000166a <shmget>:
+SYSCALL(shmget)
+    166a:	b8 30 00 00 00       	mov    $0x30,%eax
+    166f:	49 89 ca             	mov    %rcx,%r10
+    1672:	0f 05                	syscall
+    1674:	c3                   	ret
+
+0000000000001675 <shmat>:
+SYSCALL(shmat)
+    1675:	b8 31 00 00 00       	mov    $0x31,%eax
+    167a:	49 89 ca             	mov    %rcx,%r10
+    167d:	0f 05                	syscall
+    167f:	c3                   	ret
+
+0000000000001680 <shmdt>:
+SYSCALL(shmdt)
+    1680:	b8 32 00 00 00       	mov    $0x32,%eax
+    1685:	49 89 ca             	mov    %rcx,%r10
+    1688:	0f 05                	syscall
+    168a:	c3                   	ret
+
+000000000000168b <ring_setup>:
+SYSCALL(ring_setup)
+    168b:	b8 33 00 00 00       	mov    $0x33,%eax
+    1690:	49 89 ca             	mov    %rcx,%r10
+    1693:	0f 05                	syscall
+    1695:	c3                   	ret
+
+0000000000001696 <ring_enter>:
+SYSCALL(ring_enter)
+    1696:	b8 34 00 00 00       	mov    $0x34,%eax
+    169b:	49 89 ca             	mov    %rcx,%r10
+    169e:	0f 05                	syscall
+    16a0:	c3                   	ret
+
+00000000000016a1 <getdents>:
+SYSCALL(getdents)
+    16a1:	b8 35 00 00 00       	mov    $0x35,%eax
+    16a6:	49 89 ca             	mov    %rcx,%r10
+    16a9:	0f 05                	syscall
+    16ab:	c3                   	ret
+
+00000000000016ac <fstatat>:
+SYSCALL(fstatat)
+    16ac:	b8 36 00 00 00       	mov    $0x36,%eax
+    16b1:	49 89 ca             	mov    %rcx,%r10
+    16b4:	0f 05                	syscall
+    16b6:	c3                   	ret
+
+00000000000016b7 <clone_file>:
+SYSCALL(clone_file)
+    16b7:	b8 37 00 00 00       	mov    $0x37,%eax
+    16bc:	49 89 ca             	mov    %rcx,%r10
+    16bf:	0f 05                	syscall
+    16c1:	c3                   	ret
+
+00000000000016c2 <fpunch>:
+SYSCALL(fpunch)
+    16c2:	b8 38 00 00 00       	mov    $0x38,%eax
+    16c7:	49 89 ca             	mov    %rcx,%r10
+    16ca:	0f 05                	syscall
+    16cc:	c3                   	ret
+
+00000000000016cd <defrag>:
+SYSCALL(defrag)
+    16cd:	b8 39 00 00 00       	mov    $0x39,%eax
+    16d2:	49 89 ca             	mov    %rcx,%r10
+    16d5:	0f 05                	syscall
+    16d7:	c3                   	ret
+
+00000000000016d8 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    16d8:	55                   	push   %rbp
+    16d9:	48 89 e5             	mov    %rsp,%rbp
+    16dc:	48 83 ec 20          	sub    $0x20,%rsp
+    16e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    16e4:	bf 00 00 00 00       	mov    $0x0,%edi
+    16e9:	e8 3d fe ff ff       	call   152b <sbrk>
+    16ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    16f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f6:	48 f7 d8             	neg    %rax
+    16f9:	25 ff 0f 00 00       	and    $0xfff,%eax
+    16fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1702:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1706:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170a:	48 01 c2             	add    %rax,%rdx
+    170d:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1712:	48 39 c2             	cmp    %rax,%rdx
+    1715:	73 1e                	jae    1735 <morecore+0x5d>
+    1717:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    171b:	89 c2                	mov    %eax,%edx
+    171d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1721:	01 d0                	add    %edx,%eax
+    1723:	89 c7                	mov    %eax,%edi
+    1725:	e8 01 fe ff ff       	call   152b <sbrk>
+    172a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    172e:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1733:	75 07                	jne    173c <morecore+0x64>
+    return 0;
+    1735:	b8 00 00 00 00       	mov    $0x0,%eax
+    173a:	eb 27                	jmp    1763 <morecore+0x8b>
+  stats.heap += n + pad;
+    173c:	48 8b 05 2d 1c 00 00 	mov    0x1c2d(%rip),%rax        # 3370 <stats+0x50>
+    1743:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1747:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    174b:	48 01 ca             	add    %rcx,%rdx
+    174e:	48 01 d0             	add    %rdx,%rax
+    1751:	48 89 05 18 1c 00 00 	mov    %rax,0x1c18(%rip)        # 3370 <stats+0x50>
+  return p + pad;
+    1758:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    175c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1760:	48 01 d0             	add    %rdx,%rax
+}
+    1763:	c9                   	leave
+    1764:	c3                   	ret
+
+0000000000001765 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1765:	55                   	push   %rbp
+    1766:	48 89 e5             	mov    %rsp,%rbp
+    1769:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    176d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    1771:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1778:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1779:	48 8d 05 80 1b 00 00 	lea    0x1b80(%rip),%rax        # 3300 <runs>
+    1780:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1784:	eb 1a                	jmp    17a0 <pagefree+0x3b>
+    prev = *rp;
+    1786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178a:	48 8b 00             	mov    (%rax),%rax
+    178d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1791:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1795:	48 8b 00             	mov    (%rax),%rax
+    1798:	48 83 c0 08          	add    $0x8,%rax
+    179c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    17a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17a4:	48 8b 00             	mov    (%rax),%rax
+    17a7:	48 85 c0             	test   %rax,%rax
+    17aa:	74 0d                	je     17b9 <pagefree+0x54>
+    17ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b0:	48 8b 00             	mov    (%rax),%rax
+    17b3:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    17b7:	72 cd                	jb     1786 <pagefree+0x21>
+  r = (struct run *)p;
+    17b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    17c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17c5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    17c9:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    17cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17d0:	48 8b 10             	mov    (%rax),%rdx
+    17d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17d7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    17db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17df:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17e3:	48 85 c0             	test   %rax,%rax
+    17e6:	74 48                	je     1830 <pagefree+0xcb>
+    17e8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    17ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17f0:	48 01 c2             	add    %rax,%rdx
+    17f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+    17fb:	48 39 c2             	cmp    %rax,%rdx
+    17fe:	75 30                	jne    1830 <pagefree+0xcb>
+    r->size += r->next->size;
+    1800:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1804:	48 8b 10             	mov    (%rax),%rdx
+    1807:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    180b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    180f:	48 8b 00             	mov    (%rax),%rax
+    1812:	48 01 c2             	add    %rax,%rdx
+    1815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1819:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    181c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1820:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1824:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    182c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    1830:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1835:	74 46                	je     187d <pagefree+0x118>
+    1837:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    183b:	48 8b 10             	mov    (%rax),%rdx
+    183e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1842:	48 01 d0             	add    %rdx,%rax
+    1845:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1849:	75 32                	jne    187d <pagefree+0x118>
+    prev->size += r->size;
+    184b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    184f:	48 8b 10             	mov    (%rax),%rdx
+    1852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1856:	48 8b 00             	mov    (%rax),%rax
+    1859:	48 01 c2             	add    %rax,%rdx
+    185c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1860:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1867:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    186b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    186f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1873:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1877:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    187b:	eb 0c                	jmp    1889 <pagefree+0x124>
+  } else {
+    *rp = r;
+    187d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1881:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1885:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    1888:	90                   	nop
+    1889:	90                   	nop
+    188a:	5d                   	pop    %rbp
+    188b:	c3                   	ret
+
+000000000000188c <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    188c:	55                   	push   %rbp
+    188d:	48 89 e5             	mov    %rsp,%rbp
+    1890:	48 83 ec 40          	sub    $0x40,%rsp
+    1894:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    1898:	48 8d 05 61 1a 00 00 	lea    0x1a61(%rip),%rax        # 3300 <runs>
+    189f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18a3:	eb 66                	jmp    190b <pagealloc+0x7f>
+    if (r->size == n) {
+    18a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a9:	48 8b 00             	mov    (%rax),%rax
+    18ac:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    18b0:	75 18                	jne    18ca <pagealloc+0x3e>
+      *rp = r->next;
+    18b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18b6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    18ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18be:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    18c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18c5:	e9 ca 00 00 00       	jmp    1994 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    18ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18ce:	48 8b 00             	mov    (%rax),%rax
+    18d1:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    18d5:	73 28                	jae    18ff <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    18d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18db:	48 8b 00             	mov    (%rax),%rax
+    18de:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    18e2:	48 89 c2             	mov    %rax,%rdx
+    18e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18e9:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    18ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18f0:	48 8b 10             	mov    (%rax),%rdx
+    18f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18f7:	48 01 d0             	add    %rdx,%rax
+    18fa:	e9 95 00 00 00       	jmp    1994 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    18ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1903:	48 83 c0 08          	add    $0x8,%rax
+    1907:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    190b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    190f:	48 8b 00             	mov    (%rax),%rax
+    1912:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1916:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    191b:	75 88                	jne    18a5 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    191d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1921:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1925:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    192c:	00 
+    192d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1931:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1935:	48 39 c2             	cmp    %rax,%rdx
+    1938:	48 0f 43 c2          	cmovae %rdx,%rax
+    193c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    1940:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1944:	48 89 c7             	mov    %rax,%rdi
+    1947:	e8 8c fd ff ff       	call   16d8 <morecore>
+    194c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    1950:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1955:	75 07                	jne    195e <pagealloc+0xd2>
+    return 0;
+    1957:	b8 00 00 00 00       	mov    $0x0,%eax
+    195c:	eb 36                	jmp    1994 <pagealloc+0x108>
+  if (m > n)
+    195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1962:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1966:	73 1a                	jae    1982 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1968:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    196c:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1970:	48 89 c2             	mov    %rax,%rdx
+    1973:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1977:	48 89 d6             	mov    %rdx,%rsi
+    197a:	48 89 c7             	mov    %rax,%rdi
+    197d:	e8 e3 fd ff ff       	call   1765 <pagefree>
+  return p + m - n;
+    1982:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1986:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    198a:	48 89 c2             	mov    %rax,%rdx
+    198d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1991:	48 01 d0             	add    %rdx,%rax
+}
+    1994:	c9                   	leave
+    1995:	c3                   	ret
+
+0000000000001996 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    1996:	55                   	push   %rbp
+    1997:	48 89 e5             	mov    %rsp,%rbp
+    199a:	48 83 ec 30          	sub    $0x30,%rsp
+    199e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    19a1:	bf 00 10 00 00       	mov    $0x1000,%edi
+    19a6:	e8 e1 fe ff ff       	call   188c <pagealloc>
+    19ab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    19af:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    19b4:	75 0a                	jne    19c0 <refill+0x2a>
+    return -1;
+    19b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    19bb:	e9 da 00 00 00       	jmp    1a9a <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    19c0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    19c7:	00 
+    19c8:	e9 ba 00 00 00       	jmp    1a87 <refill+0xf1>
+    b = (struct block *)(p + off);
+    19cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d5:	48 01 d0             	add    %rdx,%rax
+    19d8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    19dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19df:	ba 20 00 00 00       	mov    $0x20,%edx
+    19e4:	89 c1                	mov    %eax,%ecx
+    19e6:	48 d3 e2             	shl    %cl,%rdx
+    19e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19ed:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    19f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    19f3:	48 63 d0             	movslq %eax,%rdx
+    19f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19fa:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    19fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a01:	48 98                	cltq
+    1a03:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1a0a:	00 
+    1a0b:	48 8d 05 ae 18 00 00 	lea    0x18ae(%rip),%rax        # 32c0 <freelist>
+    1a12:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1a16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a1a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    1a1e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a21:	48 98                	cltq
+    1a23:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1a2a:	00 
+    1a2b:	48 8d 15 8e 18 00 00 	lea    0x188e(%rip),%rdx        # 32c0 <freelist>
+    1a32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a36:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1a3a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a3d:	48 98                	cltq
+    1a3f:	48 83 c0 08          	add    $0x8,%rax
+    1a43:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a4a:	00 
+    1a4b:	48 8d 05 d2 18 00 00 	lea    0x18d2(%rip),%rax        # 3324 <stats+0x4>
+    1a52:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a55:	8d 48 01             	lea    0x1(%rax),%ecx
+    1a58:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a5b:	48 98                	cltq
+    1a5d:	48 83 c0 08          	add    $0x8,%rax
+    1a61:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a68:	00 
+    1a69:	48 8d 05 b4 18 00 00 	lea    0x18b4(%rip),%rax        # 3324 <stats+0x4>
+    1a70:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1a73:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a76:	ba 20 00 00 00       	mov    $0x20,%edx
+    1a7b:	89 c1                	mov    %eax,%ecx
+    1a7d:	48 d3 e2             	shl    %cl,%rdx
+    1a80:	48 89 d0             	mov    %rdx,%rax
+    1a83:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    1a87:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    1a8e:	00 
+    1a8f:	0f 86 38 ff ff ff    	jbe    19cd <refill+0x37>
+  }
+  return 0;
+    1a95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1a9a:	c9                   	leave
+    1a9b:	c3                   	ret
+
+0000000000001a9c <malloc>:
+
+void *malloc(uint nbytes) {
+    1a9c:	55                   	push   %rbp
+    1a9d:	48 89 e5             	mov    %rsp,%rbp
+    1aa0:	48 83 ec 30          	sub    $0x30,%rsp
+    1aa4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    1aa7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1aaa:	48 83 c0 10          	add    $0x10,%rax
+    1aae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    1ab2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1ab9:	eb 04                	jmp    1abf <malloc+0x23>
+    1abb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1abf:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    1ac3:	7f 16                	jg     1adb <malloc+0x3f>
+    1ac5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ac8:	ba 20 00 00 00       	mov    $0x20,%edx
+    1acd:	89 c1                	mov    %eax,%ecx
+    1acf:	48 d3 e2             	shl    %cl,%rdx
+    1ad2:	48 89 d0             	mov    %rdx,%rax
+    1ad5:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    1ad9:	72 e0                	jb     1abb <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    1adb:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    1adf:	75 7d                	jne    1b5e <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    1ae1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1aeb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    1af1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1af5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1af9:	48 89 c7             	mov    %rax,%rdi
+    1afc:	e8 8b fd ff ff       	call   188c <pagealloc>
+    1b01:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1b05:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1b0a:	75 0a                	jne    1b16 <malloc+0x7a>
+      return 0;
+    1b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b11:	e9 2c 01 00 00       	jmp    1c42 <malloc+0x1a6>
+    h->size = n;
+    1b16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b1a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b1e:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    1b21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b25:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    1b2c:	00 
+    stats.inuse[LARGE]++;
+    1b2d:	8b 05 0d 18 00 00    	mov    0x180d(%rip),%eax        # 3340 <stats+0x20>
+    1b33:	83 c0 01             	add    $0x1,%eax
+    1b36:	89 05 04 18 00 00    	mov    %eax,0x1804(%rip)        # 3340 <stats+0x20>
+    stats.large += n;
+    1b3c:	48 8b 15 25 18 00 00 	mov    0x1825(%rip),%rdx        # 3368 <stats+0x48>
+    1b43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b47:	48 01 d0             	add    %rdx,%rax
+    1b4a:	48 89 05 17 18 00 00 	mov    %rax,0x1817(%rip)        # 3368 <stats+0x48>
+    return h + 1;
+    1b51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b55:	48 83 c0 10          	add    $0x10,%rax
+    1b59:	e9 e4 00 00 00       	jmp    1c42 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    1b5e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b61:	48 98                	cltq
+    1b63:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b6a:	00 
+    1b6b:	48 8d 05 4e 17 00 00 	lea    0x174e(%rip),%rax        # 32c0 <freelist>
+    1b72:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1b76:	48 85 c0             	test   %rax,%rax
+    1b79:	75 18                	jne    1b93 <malloc+0xf7>
+    1b7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b7e:	89 c7                	mov    %eax,%edi
+    1b80:	e8 11 fe ff ff       	call   1996 <refill>
+    1b85:	85 c0                	test   %eax,%eax
+    1b87:	79 0a                	jns    1b93 <malloc+0xf7>
+    return 0;
+    1b89:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b8e:	e9 af 00 00 00       	jmp    1c42 <malloc+0x1a6>
+  b = freelist[c];
+    1b93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b96:	48 98                	cltq
+    1b98:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1b9f:	00 
+    1ba0:	48 8d 05 19 17 00 00 	lea    0x1719(%rip),%rax        # 32c0 <freelist>
+    1ba7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1bab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    1baf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bb3:	48 8b 40 10          	mov    0x10(%rax),%rax
+    1bb7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1bba:	48 63 d2             	movslq %edx,%rdx
+    1bbd:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1bc4:	00 
+    1bc5:	48 8d 15 f4 16 00 00 	lea    0x16f4(%rip),%rdx        # 32c0 <freelist>
+    1bcc:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    1bd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bd3:	48 98                	cltq
+    1bd5:	48 83 c0 08          	add    $0x8,%rax
+    1bd9:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1be0:	00 
+    1be1:	48 8d 05 3c 17 00 00 	lea    0x173c(%rip),%rax        # 3324 <stats+0x4>
+    1be8:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1beb:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1bee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bf1:	48 98                	cltq
+    1bf3:	48 83 c0 08          	add    $0x8,%rax
+    1bf7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bfe:	00 
+    1bff:	48 8d 05 1e 17 00 00 	lea    0x171e(%rip),%rax        # 3324 <stats+0x4>
+    1c06:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1c09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c0c:	48 98                	cltq
+    1c0e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c15:	00 
+    1c16:	48 8d 05 03 17 00 00 	lea    0x1703(%rip),%rax        # 3320 <stats>
+    1c1d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1c20:	8d 48 01             	lea    0x1(%rax),%ecx
+    1c23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c26:	48 98                	cltq
+    1c28:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1c2f:	00 
+    1c30:	48 8d 05 e9 16 00 00 	lea    0x16e9(%rip),%rax        # 3320 <stats>
+    1c37:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1c3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c3e:	48 83 c0 10          	add    $0x10,%rax
+}
+    1c42:	c9                   	leave
+    1c43:	c3                   	ret
+
+0000000000001c44 <free>:
+
+void free(void *ap) {
+    1c44:	55                   	push   %rbp
+    1c45:	48 89 e5             	mov    %rsp,%rbp
+    1c48:	48 83 ec 18          	sub    $0x18,%rsp
+    1c4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1c50:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1c55:	0f 84 03 01 00 00    	je     1d5e <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1c5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c5f:	48 83 e8 10          	sub    $0x10,%rax
+    1c63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1c67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c6b:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1c6f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1c73:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1c78:	75 42                	jne    1cbc <free+0x78>
+    stats.inuse[LARGE]--;
+    1c7a:	8b 05 c0 16 00 00    	mov    0x16c0(%rip),%eax        # 3340 <stats+0x20>
+    1c80:	83 e8 01             	sub    $0x1,%eax
+    1c83:	89 05 b7 16 00 00    	mov    %eax,0x16b7(%rip)        # 3340 <stats+0x20>
+    stats.large -= b->h.size;
+    1c89:	48 8b 15 d8 16 00 00 	mov    0x16d8(%rip),%rdx        # 3368 <stats+0x48>
+    1c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c94:	48 8b 00             	mov    (%rax),%rax
+    1c97:	48 29 c2             	sub    %rax,%rdx
+    1c9a:	48 89 15 c7 16 00 00 	mov    %rdx,0x16c7(%rip)        # 3368 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ca5:	48 8b 10             	mov    (%rax),%rdx
+    1ca8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cac:	48 89 d6             	mov    %rdx,%rsi
+    1caf:	48 89 c7             	mov    %rax,%rdi
+    1cb2:	e8 ae fa ff ff       	call   1765 <pagefree>
+    return;
+    1cb7:	e9 a3 00 00 00       	jmp    1d5f <free+0x11b>
+  }
+  b->next = freelist[c];
+    1cbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cc0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cc7:	00 
+    1cc8:	48 8d 05 f1 15 00 00 	lea    0x15f1(%rip),%rax        # 32c0 <freelist>
+    1ccf:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1cd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cd7:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1cdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cdf:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1ce6:	00 
+    1ce7:	48 8d 15 d2 15 00 00 	lea    0x15d2(%rip),%rdx        # 32c0 <freelist>
+    1cee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cf2:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1cf6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cfa:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d01:	00 
+    1d02:	48 8d 05 17 16 00 00 	lea    0x1617(%rip),%rax        # 3320 <stats>
+    1d09:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d0c:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1d0f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d13:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d1a:	00 
+    1d1b:	48 8d 05 fe 15 00 00 	lea    0x15fe(%rip),%rax        # 3320 <stats>
+    1d22:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1d25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d29:	48 83 c0 08          	add    $0x8,%rax
+    1d2d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d34:	00 
+    1d35:	48 8d 05 e8 15 00 00 	lea    0x15e8(%rip),%rax        # 3324 <stats+0x4>
+    1d3c:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1d3f:	8d 48 01             	lea    0x1(%rax),%ecx
+    1d42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d46:	48 83 c0 08          	add    $0x8,%rax
+    1d4a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d51:	00 
+    1d52:	48 8d 05 cb 15 00 00 	lea    0x15cb(%rip),%rax        # 3324 <stats+0x4>
+    1d59:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1d5c:	eb 01                	jmp    1d5f <free+0x11b>
+    return;
+    1d5e:	90                   	nop
+}
+    1d5f:	c9                   	leave
+    1d60:	c3                   	ret
+
+0000000000001d61 <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1d61:	55                   	push   %rbp
+    1d62:	48 89 e5             	mov    %rsp,%rbp
+    1d65:	48 83 ec 30          	sub    $0x30,%rsp
+    1d69:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1d6c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d6f:	48 8d 15 9a 02 00 00 	lea    0x29a(%rip),%rdx        # 2010 <benchreport+0x187>
+    1d76:	48 89 d6             	mov    %rdx,%rsi
+    1d79:	89 c7                	mov    %eax,%edi
+    1d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d80:	e8 37 e6 ff ff       	call   3bc <printf>
+  for (c = 0; c < NCLASS; c++)
+    1d85:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1d8c:	eb 67                	jmp    1df5 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1d8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d91:	48 98                	cltq
+    1d93:	48 83 c0 08          	add    $0x8,%rax
+    1d97:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1d9e:	00 
+    1d9f:	48 8d 05 7e 15 00 00 	lea    0x157e(%rip),%rax        # 3324 <stats+0x4>
+    1da6:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1da9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1dac:	48 98                	cltq
+    1dae:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1db5:	00 
+    1db6:	48 8d 05 63 15 00 00 	lea    0x1563(%rip),%rax        # 3320 <stats>
+    1dbd:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1dc3:	ba 20 00 00 00       	mov    $0x20,%edx
+    1dc8:	89 c1                	mov    %eax,%ecx
+    1dca:	48 d3 e2             	shl    %cl,%rdx
+    1dcd:	48 89 d0             	mov    %rdx,%rax
+    1dd0:	89 c1                	mov    %eax,%ecx
+    1dd2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1dd5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dd8:	41 89 f9             	mov    %edi,%r9d
+    1ddb:	41 89 f0             	mov    %esi,%r8d
+    1dde:	48 8d 35 42 02 00 00 	lea    0x242(%rip),%rsi        # 2027 <benchreport+0x19e>
+    1de5:	89 c7                	mov    %eax,%edi
+    1de7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1dec:	e8 cb e5 ff ff       	call   3bc <printf>
+  for (c = 0; c < NCLASS; c++)
+    1df1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1df5:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1df9:	7e 93                	jle    1d8e <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1dfb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1e02:	00 
+  for (r = runs; r; r = r->next)
+    1e03:	48 8b 05 f6 14 00 00 	mov    0x14f6(%rip),%rax        # 3300 <runs>
+    1e0a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1e0e:	eb 17                	jmp    1e27 <mallocstats+0xc6>
+    nfree += r->size;
+    1e10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e14:	48 8b 00             	mov    (%rax),%rax
+    1e17:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1e1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e1f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1e23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1e27:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1e2c:	75 e2                	jne    1e10 <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1e2e:	48 8b 05 3b 15 00 00 	mov    0x153b(%rip),%rax        # 3370 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e35:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1e37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e3b:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e3f:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1e41:	48 8b 05 20 15 00 00 	mov    0x1520(%rip),%rax        # 3368 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1e48:	89 c1                	mov    %eax,%ecx
+    1e4a:	8b 15 f0 14 00 00    	mov    0x14f0(%rip),%edx        # 3340 <stats+0x20>
+    1e50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e53:	41 89 f9             	mov    %edi,%r9d
+    1e56:	41 89 f0             	mov    %esi,%r8d
+    1e59:	48 8d 35 d8 01 00 00 	lea    0x1d8(%rip),%rsi        # 2038 <benchreport+0x1af>
+    1e60:	89 c7                	mov    %eax,%edi
+    1e62:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e67:	e8 50 e5 ff ff       	call   3bc <printf>
+}
+    1e6c:	90                   	nop
+    1e6d:	c9                   	leave
+    1e6e:	c3                   	ret
+
+0000000000001e6f <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1e6f:	55                   	push   %rbp
+    1e70:	48 89 e5             	mov    %rsp,%rbp
+    1e73:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1e77:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1e7b:	48 89 c7             	mov    %rax,%rdi
+    1e7e:	e8 9a f7 ff ff       	call   161d <cycles>
+  return t;
+    1e83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1e87:	c9                   	leave
+    1e88:	c3                   	ret
+
+0000000000001e89 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1e89:	55                   	push   %rbp
+    1e8a:	48 89 e5             	mov    %rsp,%rbp
+    1e8d:	48 83 ec 30          	sub    $0x30,%rsp
+    1e91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1e95:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1e99:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1e9c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1ea0:	0f 8e 24 01 00 00    	jle    1fca <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1ea6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1ead:	e9 98 00 00 00       	jmp    1f4a <benchreport+0xc1>
+    x = t[i];
+    1eb2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1eb5:	48 98                	cltq
+    1eb7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ebe:	00 
+    1ebf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ec3:	48 01 d0             	add    %rdx,%rax
+    1ec6:	48 8b 00             	mov    (%rax),%rax
+    1ec9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1ecd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ed0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1ed3:	eb 33                	jmp    1f08 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1ed5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1ed8:	48 98                	cltq
+    1eda:	48 c1 e0 03          	shl    $0x3,%rax
+    1ede:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1ee2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ee6:	48 01 d0             	add    %rdx,%rax
+    1ee9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1eec:	48 63 d2             	movslq %edx,%rdx
+    1eef:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1ef6:	00 
+    1ef7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1efb:	48 01 ca             	add    %rcx,%rdx
+    1efe:	48 8b 00             	mov    (%rax),%rax
+    1f01:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1f04:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1f08:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1f0c:	7e 1d                	jle    1f2b <benchreport+0xa2>
+    1f0e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1f11:	48 98                	cltq
+    1f13:	48 c1 e0 03          	shl    $0x3,%rax
+    1f17:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1f1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f1f:	48 01 d0             	add    %rdx,%rax
+    1f22:	48 8b 00             	mov    (%rax),%rax
+    1f25:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1f29:	72 aa                	jb     1ed5 <benchreport+0x4c>
+    t[j] = x;
+    1f2b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1f2e:	48 98                	cltq
+    1f30:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f37:	00 
+    1f38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f3c:	48 01 c2             	add    %rax,%rdx
+    1f3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f43:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1f46:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1f4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1f4d:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1f50:	0f 8c 5c ff ff ff    	jl     1eb2 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1f56:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f59:	48 98                	cltq
+    1f5b:	48 c1 e0 03          	shl    $0x3,%rax
+    1f5f:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1f63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f67:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f6a:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1f6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1f70:	89 c2                	mov    %eax,%edx
+    1f72:	c1 ea 1f             	shr    $0x1f,%edx
+    1f75:	01 d0                	add    %edx,%eax
+    1f77:	d1 f8                	sar    %eax
+    1f79:	48 98                	cltq
+    1f7b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1f82:	00 
+    1f83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f87:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1f8a:	48 8b 38             	mov    (%rax),%rdi
+    1f8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1f91:	48 8b 30             	mov    (%rax),%rsi
+    1f94:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1f97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f9b:	48 83 ec 08          	sub    $0x8,%rsp
+    1f9f:	51                   	push   %rcx
+    1fa0:	49 89 f9             	mov    %rdi,%r9
+    1fa3:	49 89 f0             	mov    %rsi,%r8
+    1fa6:	89 d1                	mov    %edx,%ecx
+    1fa8:	48 89 c2             	mov    %rax,%rdx
+    1fab:	48 8d 05 c6 00 00 00 	lea    0xc6(%rip),%rax        # 2078 <benchreport+0x1ef>
+    1fb2:	48 89 c6             	mov    %rax,%rsi
+    1fb5:	bf 01 00 00 00       	mov    $0x1,%edi
+    1fba:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fbf:	e8 f8 e3 ff ff       	call   3bc <printf>
+    1fc4:	48 83 c4 10          	add    $0x10,%rsp
+    1fc8:	eb 01                	jmp    1fcb <benchreport+0x142>
+    return;
+    1fca:	90                   	nop
+}
+    1fcb:	c9                   	leave
+    1fcc:	c3                   	ret
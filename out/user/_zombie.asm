@@ -0,0 +1,3339 @@
+
+out/user/_zombie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+int main(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+  if (fork() > 0)
+       4:	e8 f1 07 00 00       	call   7fa <fork>
+       9:	85 c0                	test   %eax,%eax
+       b:	7e 0a                	jle    17 <main+0x17>
+    sleep(5); // Let child exit before parent.
+       d:	bf 05 00 00 00       	mov    $0x5,%edi
+      12:	e8 3d 13 00 00       	call   1354 <sleep>
+  exit();
+      17:	e8 ee 07 00 00       	call   80a <exit>
+
+000000000000001c <putc>:
+#include <cdefs.h>
+#include <stat.h>
+#include <stdarg.h>
+#include <user.h>
+
+static void putc(int fd, char c) { bputc(fd, c); }
+      1c:	55                   	push   %rbp
+      1d:	48 89 e5             	mov    %rsp,%rbp
+      20:	48 83 ec 10          	sub    $0x10,%rsp
+      24:	89 7d fc             	mov    %edi,-0x4(%rbp)
+      27:	89 f0                	mov    %esi,%eax
+      29:	88 45 f8             	mov    %al,-0x8(%rbp)
+      2c:	0f be 55 f8          	movsbl -0x8(%rbp),%edx
+      30:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      33:	89 d6                	mov    %edx,%esi
+      35:	89 c7                	mov    %eax,%edi
+      37:	e8 eb 06 00 00       	call   727 <bputc>
+      3c:	90                   	nop
+      3d:	c9                   	leave
+      3e:	c3                   	ret
+
+000000000000003f <printint64>:
+
+static void printint64(int fd, int64_t xx, int base, int sgn) {
+      3f:	55                   	push   %rbp
+      40:	48 89 e5             	mov    %rsp,%rbp
+      43:	48 83 ec 50          	sub    $0x50,%rsp
+      47:	89 7d cc             	mov    %edi,-0x34(%rbp)
+      4a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+      4e:	89 55 c8             	mov    %edx,-0x38(%rbp)
+      51:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if (sgn && (sgn = xx < 0))
+      54:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      58:	74 21                	je     7b <printint64+0x3c>
+      5a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      5e:	48 c1 e8 3f          	shr    $0x3f,%rax
+      62:	0f b6 c0             	movzbl %al,%eax
+      65:	89 45 bc             	mov    %eax,-0x44(%rbp)
+      68:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      6c:	74 0d                	je     7b <printint64+0x3c>
+    x = -xx;
+      6e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      72:	48 f7 d8             	neg    %rax
+      75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      79:	eb 08                	jmp    83 <printint64+0x44>
+  else
+    x = xx;
+      7b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+      7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+      83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+      8a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+      8d:	48 63 c8             	movslq %eax,%rcx
+      90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      94:	ba 00 00 00 00       	mov    $0x0,%edx
+      99:	48 f7 f1             	div    %rcx
+      9c:	48 89 d1             	mov    %rdx,%rcx
+      9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      a2:	8d 50 01             	lea    0x1(%rax),%edx
+      a5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+      a8:	48 8d 15 51 2f 00 00 	lea    0x2f51(%rip),%rdx        # 3000 <digits.1>
+      af:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+      b3:	48 98                	cltq
+      b5:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+      b9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+      bc:	48 63 f0             	movslq %eax,%rsi
+      bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      c3:	ba 00 00 00 00       	mov    $0x0,%edx
+      c8:	48 f7 f6             	div    %rsi
+      cb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      cf:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+      d4:	75 b4                	jne    8a <printint64+0x4b>
+
+  if (sgn)
+      d6:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+      da:	74 2b                	je     107 <printint64+0xc8>
+    buf[i++] = '-';
+      dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      df:	8d 50 01             	lea    0x1(%rax),%edx
+      e2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+      e5:	48 98                	cltq
+      e7:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while (--i >= 0)
+      ec:	eb 19                	jmp    107 <printint64+0xc8>
+    putc(fd, buf[i]);
+      ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      f1:	48 98                	cltq
+      f3:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+      f8:	0f be d0             	movsbl %al,%edx
+      fb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+      fe:	89 d6                	mov    %edx,%esi
+     100:	89 c7                	mov    %eax,%edi
+     102:	e8 15 ff ff ff       	call   1c <putc>
+  while (--i >= 0)
+     107:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     10b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     10f:	79 dd                	jns    ee <printint64+0xaf>
+}
+     111:	90                   	nop
+     112:	90                   	nop
+     113:	c9                   	leave
+     114:	c3                   	ret
+
+0000000000000115 <printint>:
+
+static void printint(int fd, int xx, int base, int sgn) {
+     115:	55                   	push   %rbp
+     116:	48 89 e5             	mov    %rsp,%rbp
+     119:	48 83 ec 30          	sub    $0x30,%rsp
+     11d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     120:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     123:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     126:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     129:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if (sgn && xx < 0) {
+     130:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     134:	74 17                	je     14d <printint+0x38>
+     136:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     13a:	79 11                	jns    14d <printint+0x38>
+    neg = 1;
+     13c:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     143:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     146:	f7 d8                	neg    %eax
+     148:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     14b:	eb 06                	jmp    153 <printint+0x3e>
+  } else {
+    x = xx;
+     14d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     150:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     153:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do {
+    buf[i++] = digits[x % base];
+     15a:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     15d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     160:	ba 00 00 00 00       	mov    $0x0,%edx
+     165:	f7 f1                	div    %ecx
+     167:	89 d1                	mov    %edx,%ecx
+     169:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     16c:	8d 50 01             	lea    0x1(%rax),%edx
+     16f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     172:	89 c9                	mov    %ecx,%ecx
+     174:	48 8d 15 a5 2e 00 00 	lea    0x2ea5(%rip),%rdx        # 3020 <digits.0>
+     17b:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     17f:	48 98                	cltq
+     181:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  } while ((x /= base) != 0);
+     185:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     188:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     18b:	ba 00 00 00 00       	mov    $0x0,%edx
+     190:	f7 f6                	div    %esi
+     192:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     195:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     199:	75 bf                	jne    15a <printint+0x45>
+  if (neg)
+     19b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     19f:	74 2b                	je     1cc <printint+0xb7>
+    buf[i++] = '-';
+     1a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1a4:	8d 50 01             	lea    0x1(%rax),%edx
+     1a7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     1aa:	48 98                	cltq
+     1ac:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while (--i >= 0)
+     1b1:	eb 19                	jmp    1cc <printint+0xb7>
+    putc(fd, buf[i]);
+     1b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1b6:	48 98                	cltq
+     1b8:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     1bd:	0f be d0             	movsbl %al,%edx
+     1c0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     1c3:	89 d6                	mov    %edx,%esi
+     1c5:	89 c7                	mov    %eax,%edi
+     1c7:	e8 50 fe ff ff       	call   1c <putc>
+  while (--i >= 0)
+     1cc:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     1d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1d4:	79 dd                	jns    1b3 <printint+0x9e>
+}
+     1d6:	90                   	nop
+     1d7:	90                   	nop
+     1d8:	c9                   	leave
+     1d9:	c3                   	ret
+
+00000000000001da <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void printf(int fd, char *fmt, ...) {
+     1da:	55                   	push   %rbp
+     1db:	48 89 e5             	mov    %rsp,%rbp
+     1de:	48 83 ec 70          	sub    $0x70,%rsp
+     1e2:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     1e5:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     1e9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     1ed:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     1f1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     1f5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;
+  va_list valist;
+  va_start(valist, fmt);
+     1f9:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     200:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     204:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     208:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     20c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     210:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     217:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     21e:	e9 67 02 00 00       	jmp    48a <printf+0x2b0>
+    c = fmt[i] & 0xff;
+     223:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     226:	48 63 d0             	movslq %eax,%rdx
+     229:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     22d:	48 01 d0             	add    %rdx,%rax
+     230:	0f b6 00             	movzbl (%rax),%eax
+     233:	0f be c0             	movsbl %al,%eax
+     236:	25 ff 00 00 00       	and    $0xff,%eax
+     23b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (state == 0) {
+     23e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     242:	75 30                	jne    274 <printf+0x9a>
+      if (c == '%') {
+     244:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     248:	75 13                	jne    25d <printf+0x83>
+        state = '%';
+     24a:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     251:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     258:	e9 29 02 00 00       	jmp    486 <printf+0x2ac>
+      } else {
+        putc(fd, c);
+     25d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     260:	0f be d0             	movsbl %al,%edx
+     263:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     266:	89 d6                	mov    %edx,%esi
+     268:	89 c7                	mov    %eax,%edi
+     26a:	e8 ad fd ff ff       	call   1c <putc>
+     26f:	e9 12 02 00 00       	jmp    486 <printf+0x2ac>
+      }
+    } else if (state == '%') {
+     274:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     278:	0f 85 08 02 00 00    	jne    486 <printf+0x2ac>
+      if (c == 'l') {
+     27e:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     282:	75 0c                	jne    290 <printf+0xb6>
+        lflag = 1;
+     284:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     28b:	e9 f6 01 00 00       	jmp    486 <printf+0x2ac>
+      } else if (c == 'd') {
+     290:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     294:	0f 85 93 00 00 00    	jne    32d <printf+0x153>
+        if (lflag == 1)
+     29a:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     29e:	75 47                	jne    2e7 <printf+0x10d>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     2a0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     2a3:	83 f8 2f             	cmp    $0x2f,%eax
+     2a6:	77 17                	ja     2bf <printf+0xe5>
+     2a8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     2ac:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     2af:	89 d2                	mov    %edx,%edx
+     2b1:	48 01 d0             	add    %rdx,%rax
+     2b4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     2b7:	83 c2 08             	add    $0x8,%edx
+     2ba:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     2bd:	eb 0c                	jmp    2cb <printf+0xf1>
+     2bf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     2c3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     2c7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     2cb:	48 8b 30             	mov    (%rax),%rsi
+     2ce:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     2d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+     2d6:	ba 0a 00 00 00       	mov    $0xa,%edx
+     2db:	89 c7                	mov    %eax,%edi
+     2dd:	e8 5d fd ff ff       	call   3f <printint64>
+     2e2:	e9 98 01 00 00       	jmp    47f <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);
+     2e7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     2ea:	83 f8 2f             	cmp    $0x2f,%eax
+     2ed:	77 17                	ja     306 <printf+0x12c>
+     2ef:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     2f3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     2f6:	89 d2                	mov    %edx,%edx
+     2f8:	48 01 d0             	add    %rdx,%rax
+     2fb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     2fe:	83 c2 08             	add    $0x8,%edx
+     301:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     304:	eb 0c                	jmp    312 <printf+0x138>
+     306:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     30a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     30e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     312:	8b 30                	mov    (%rax),%esi
+     314:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     317:	b9 01 00 00 00       	mov    $0x1,%ecx
+     31c:	ba 0a 00 00 00       	mov    $0xa,%edx
+     321:	89 c7                	mov    %eax,%edi
+     323:	e8 ed fd ff ff       	call   115 <printint>
+     328:	e9 52 01 00 00       	jmp    47f <printf+0x2a5>
+      } else if (c == 'x' || c == 'p') {
+     32d:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     331:	74 0a                	je     33d <printf+0x163>
+     333:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     337:	0f 85 93 00 00 00    	jne    3d0 <printf+0x1f6>
+        if (lflag == 1)
+     33d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     341:	75 47                	jne    38a <printf+0x1b0>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     343:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     346:	83 f8 2f             	cmp    $0x2f,%eax
+     349:	77 17                	ja     362 <printf+0x188>
+     34b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     34f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     352:	89 d2                	mov    %edx,%edx
+     354:	48 01 d0             	add    %rdx,%rax
+     357:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     35a:	83 c2 08             	add    $0x8,%edx
+     35d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     360:	eb 0c                	jmp    36e <printf+0x194>
+     362:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     366:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     36a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     36e:	48 8b 30             	mov    (%rax),%rsi
+     371:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     374:	b9 00 00 00 00       	mov    $0x0,%ecx
+     379:	ba 10 00 00 00       	mov    $0x10,%edx
+     37e:	89 c7                	mov    %eax,%edi
+     380:	e8 ba fc ff ff       	call   3f <printint64>
+        if (lflag == 1)
+     385:	e9 f5 00 00 00       	jmp    47f <printf+0x2a5>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     38a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     38d:	83 f8 2f             	cmp    $0x2f,%eax
+     390:	77 17                	ja     3a9 <printf+0x1cf>
+     392:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     396:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     399:	89 d2                	mov    %edx,%edx
+     39b:	48 01 d0             	add    %rdx,%rax
+     39e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3a1:	83 c2 08             	add    $0x8,%edx
+     3a4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3a7:	eb 0c                	jmp    3b5 <printf+0x1db>
+     3a9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3ad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3b1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     3b5:	8b 30                	mov    (%rax),%esi
+     3b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     3ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+     3bf:	ba 10 00 00 00       	mov    $0x10,%edx
+     3c4:	89 c7                	mov    %eax,%edi
+     3c6:	e8 4a fd ff ff       	call   115 <printint>
+        if (lflag == 1)
+     3cb:	e9 af 00 00 00       	jmp    47f <printf+0x2a5>
+      } else if (c == 's') {
+     3d0:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     3d4:	75 6e                	jne    444 <printf+0x26a>
+        if ((s = (char *)va_arg(valist, char *)) == 0)
+     3d6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     3d9:	83 f8 2f             	cmp    $0x2f,%eax
+     3dc:	77 17                	ja     3f5 <printf+0x21b>
+     3de:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     3e2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3e5:	89 d2                	mov    %edx,%edx
+     3e7:	48 01 d0             	add    %rdx,%rax
+     3ea:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     3ed:	83 c2 08             	add    $0x8,%edx
+     3f0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     3f3:	eb 0c                	jmp    401 <printf+0x227>
+     3f5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     3f9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     3fd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     401:	48 8b 00             	mov    (%rax),%rax
+     404:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     408:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     40d:	75 28                	jne    437 <printf+0x25d>
+          s = "(null)";
+     40f:	48 8d 05 da 19 00 00 	lea    0x19da(%rip),%rax        # 1df0 <benchreport+0x149>
+     416:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for (; *s; s++)
+     41a:	eb 1b                	jmp    437 <printf+0x25d>
+          putc(fd, *s);
+     41c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     420:	0f b6 00             	movzbl (%rax),%eax
+     423:	0f be d0             	movsbl %al,%edx
+     426:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     429:	89 d6                	mov    %edx,%esi
+     42b:	89 c7                	mov    %eax,%edi
+     42d:	e8 ea fb ff ff       	call   1c <putc>
+        for (; *s; s++)
+     432:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     437:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     43b:	0f b6 00             	movzbl (%rax),%eax
+     43e:	84 c0                	test   %al,%al
+     440:	75 da                	jne    41c <printf+0x242>
+     442:	eb 3b                	jmp    47f <printf+0x2a5>
+      } else if (c == '%') {
+     444:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     448:	75 14                	jne    45e <printf+0x284>
+        putc(fd, c);
+     44a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     44d:	0f be d0             	movsbl %al,%edx
+     450:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     453:	89 d6                	mov    %edx,%esi
+     455:	89 c7                	mov    %eax,%edi
+     457:	e8 c0 fb ff ff       	call   1c <putc>
+     45c:	eb 21                	jmp    47f <printf+0x2a5>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     45e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     461:	be 25 00 00 00       	mov    $0x25,%esi
+     466:	89 c7                	mov    %eax,%edi
+     468:	e8 af fb ff ff       	call   1c <putc>
+        putc(fd, c);
+     46d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     470:	0f be d0             	movsbl %al,%edx
+     473:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     476:	89 d6                	mov    %edx,%esi
+     478:	89 c7                	mov    %eax,%edi
+     47a:	e8 9d fb ff ff       	call   1c <putc>
+      }
+      state = 0;
+     47f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for (i = 0; fmt[i]; i++) {
+     486:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     48a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     48d:	48 63 d0             	movslq %eax,%rdx
+     490:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     494:	48 01 d0             	add    %rdx,%rax
+     497:	0f b6 00             	movzbl (%rax),%eax
+     49a:	84 c0                	test   %al,%al
+     49c:	0f 85 81 fd ff ff    	jne    223 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+  bflushtty(fd);
+     4a2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     4a5:	89 c7                	mov    %eax,%edi
+     4a7:	e8 ee 02 00 00       	call   79a <bflushtty>
+}
+     4ac:	90                   	nop
+     4ad:	c9                   	leave
+     4ae:	c3                   	ret
+
+00000000000004af <getbuf>:
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+     4af:	55                   	push   %rbp
+     4b0:	48 89 e5             	mov    %rsp,%rbp
+     4b3:	48 83 ec 30          	sub    $0x30,%rsp
+     4b7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+     4ba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     4be:	78 06                	js     4c6 <getbuf+0x17>
+     4c0:	83 7d dc 0f          	cmpl   $0xf,-0x24(%rbp)
+     4c4:	7e 0a                	jle    4d0 <getbuf+0x21>
+    return 0;
+     4c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     4cb:	e9 94 00 00 00       	jmp    564 <getbuf+0xb5>
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+     4d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     4d3:	48 98                	cltq
+     4d5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     4dc:	00 
+     4dd:	48 8d 05 5c 2b 00 00 	lea    0x2b5c(%rip),%rax        # 3040 <obufs>
+     4e4:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     4e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     4ec:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     4f1:	75 6d                	jne    560 <getbuf+0xb1>
+     4f3:	bf 08 02 00 00       	mov    $0x208,%edi
+     4f8:	e8 bd 13 00 00       	call   18ba <malloc>
+     4fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     501:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     506:	74 58                	je     560 <getbuf+0xb1>
+    b->n = 0;
+     508:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     50c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+     512:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     516:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     519:	48 89 d6             	mov    %rdx,%rsi
+     51c:	89 c7                	mov    %eax,%edi
+     51e:	e8 e4 0d 00 00       	call   1307 <fstat>
+     523:	85 c0                	test   %eax,%eax
+     525:	75 11                	jne    538 <getbuf+0x89>
+     527:	0f b7 45 e8          	movzwl -0x18(%rbp),%eax
+     52b:	66 83 f8 03          	cmp    $0x3,%ax
+     52f:	75 07                	jne    538 <getbuf+0x89>
+     531:	ba 01 00 00 00       	mov    $0x1,%edx
+     536:	eb 05                	jmp    53d <getbuf+0x8e>
+     538:	ba 00 00 00 00       	mov    $0x0,%edx
+     53d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     541:	89 50 04             	mov    %edx,0x4(%rax)
+    obufs[fd] = b;
+     544:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     547:	48 98                	cltq
+     549:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     550:	00 
+     551:	48 8d 15 e8 2a 00 00 	lea    0x2ae8(%rip),%rdx        # 3040 <obufs>
+     558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     55c:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  }
+  return b;
+     560:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     564:	c9                   	leave
+     565:	c3                   	ret
+
+0000000000000566 <bflush>:
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+     566:	55                   	push   %rbp
+     567:	48 89 e5             	mov    %rsp,%rbp
+     56a:	48 83 ec 20          	sub    $0x20,%rsp
+     56e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+     571:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     575:	78 33                	js     5aa <bflush+0x44>
+     577:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+     57b:	7f 2d                	jg     5aa <bflush+0x44>
+     57d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     580:	48 98                	cltq
+     582:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     589:	00 
+     58a:	48 8d 05 af 2a 00 00 	lea    0x2aaf(%rip),%rax        # 3040 <obufs>
+     591:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     595:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     599:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     59e:	74 0a                	je     5aa <bflush+0x44>
+     5a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5a4:	8b 00                	mov    (%rax),%eax
+     5a6:	85 c0                	test   %eax,%eax
+     5a8:	75 07                	jne    5b1 <bflush+0x4b>
+    return 0;
+     5aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     5af:	eb 3c                	jmp    5ed <bflush+0x87>
+  n = b->n;
+     5b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5b5:	8b 00                	mov    (%rax),%eax
+     5b7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  b->n = 0;
+     5ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5be:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return write(fd, b->data, n) == n ? 0 : -1;
+     5c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5c8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+     5cc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     5cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     5d2:	48 89 ce             	mov    %rcx,%rsi
+     5d5:	89 c7                	mov    %eax,%edi
+     5d7:	e8 de 0c 00 00       	call   12ba <write>
+     5dc:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+     5df:	75 07                	jne    5e8 <bflush+0x82>
+     5e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e6:	eb 05                	jmp    5ed <bflush+0x87>
+     5e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     5ed:	c9                   	leave
+     5ee:	c3                   	ret
+
+00000000000005ef <bflushall>:
+
+void bflushall(void) {
+     5ef:	55                   	push   %rbp
+     5f0:	48 89 e5             	mov    %rsp,%rbp
+     5f3:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+     5f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     5fe:	eb 0e                	jmp    60e <bflushall+0x1f>
+    bflush(fd);
+     600:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     603:	89 c7                	mov    %eax,%edi
+     605:	e8 5c ff ff ff       	call   566 <bflush>
+  for (fd = 0; fd < NOFILE; fd++)
+     60a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     60e:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     612:	7e ec                	jle    600 <bflushall+0x11>
+}
+     614:	90                   	nop
+     615:	90                   	nop
+     616:	c9                   	leave
+     617:	c3                   	ret
+
+0000000000000618 <bwrite>:
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+     618:	55                   	push   %rbp
+     619:	48 89 e5             	mov    %rsp,%rbp
+     61c:	48 83 ec 30          	sub    $0x30,%rsp
+     620:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     623:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     627:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+     62a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     62d:	89 c7                	mov    %eax,%edi
+     62f:	e8 7b fe ff ff       	call   4af <getbuf>
+     634:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     638:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     63d:	75 19                	jne    658 <bwrite+0x40>
+    return write(fd, s, n);
+     63f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+     642:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+     646:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     649:	48 89 ce             	mov    %rcx,%rsi
+     64c:	89 c7                	mov    %eax,%edi
+     64e:	e8 67 0c 00 00       	call   12ba <write>
+     653:	e9 cd 00 00 00       	jmp    725 <bwrite+0x10d>
+  for (i = 0; i < n; i += m) {
+     658:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     65f:	e9 92 00 00 00       	jmp    6f6 <bwrite+0xde>
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+     664:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     668:	8b 00                	mov    (%rax),%eax
+     66a:	3d 00 02 00 00       	cmp    $0x200,%eax
+     66f:	75 18                	jne    689 <bwrite+0x71>
+     671:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     674:	89 c7                	mov    %eax,%edi
+     676:	e8 eb fe ff ff       	call   566 <bflush>
+     67b:	85 c0                	test   %eax,%eax
+     67d:	79 0a                	jns    689 <bwrite+0x71>
+      return -1;
+     67f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     684:	e9 9c 00 00 00       	jmp    725 <bwrite+0x10d>
+    m = min(n - i, STDIOBUF - b->n);
+     689:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     68c:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     68f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     692:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     696:	8b 00                	mov    (%rax),%eax
+     698:	ba 00 02 00 00       	mov    $0x200,%edx
+     69d:	29 c2                	sub    %eax,%edx
+     69f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     6a2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     6a5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     6a8:	39 c2                	cmp    %eax,%edx
+     6aa:	0f 4e c2             	cmovle %edx,%eax
+     6ad:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    memmove(b->data + b->n, s + i, m);
+     6b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6b3:	48 63 d0             	movslq %eax,%rdx
+     6b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     6ba:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+     6be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6c2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     6c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6ca:	8b 00                	mov    (%rax),%eax
+     6cc:	48 98                	cltq
+     6ce:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     6d2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6d5:	89 c2                	mov    %eax,%edx
+     6d7:	48 89 cf             	mov    %rcx,%rdi
+     6da:	e8 e9 06 00 00       	call   dc8 <memmove>
+    b->n += m;
+     6df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6e3:	8b 10                	mov    (%rax),%edx
+     6e5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6e8:	01 c2                	add    %eax,%edx
+     6ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6ee:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < n; i += m) {
+     6f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6f3:	01 45 fc             	add    %eax,-0x4(%rbp)
+     6f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6f9:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+     6fc:	0f 8c 62 ff ff ff    	jl     664 <bwrite+0x4c>
+  }
+  if (b->tty && bflush(fd) < 0)
+     702:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     706:	8b 40 04             	mov    0x4(%rax),%eax
+     709:	85 c0                	test   %eax,%eax
+     70b:	74 15                	je     722 <bwrite+0x10a>
+     70d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     710:	89 c7                	mov    %eax,%edi
+     712:	e8 4f fe ff ff       	call   566 <bflush>
+     717:	85 c0                	test   %eax,%eax
+     719:	79 07                	jns    722 <bwrite+0x10a>
+    return -1;
+     71b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     720:	eb 03                	jmp    725 <bwrite+0x10d>
+  return n;
+     722:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+     725:	c9                   	leave
+     726:	c3                   	ret
+
+0000000000000727 <bputc>:
+
+void bputc(int fd, char c) {
+     727:	55                   	push   %rbp
+     728:	48 89 e5             	mov    %rsp,%rbp
+     72b:	48 83 ec 20          	sub    $0x20,%rsp
+     72f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     732:	89 f0                	mov    %esi,%eax
+     734:	88 45 e8             	mov    %al,-0x18(%rbp)
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+     737:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     73a:	89 c7                	mov    %eax,%edi
+     73c:	e8 6e fd ff ff       	call   4af <getbuf>
+     741:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     745:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+     74a:	75 18                	jne    764 <bputc+0x3d>
+    write(fd, &c, 1);
+     74c:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     750:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     753:	ba 01 00 00 00       	mov    $0x1,%edx
+     758:	48 89 ce             	mov    %rcx,%rsi
+     75b:	89 c7                	mov    %eax,%edi
+     75d:	e8 58 0b 00 00       	call   12ba <write>
+    return;
+     762:	eb 34                	jmp    798 <bputc+0x71>
+  }
+  if (b->n == STDIOBUF)
+     764:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     768:	8b 00                	mov    (%rax),%eax
+     76a:	3d 00 02 00 00       	cmp    $0x200,%eax
+     76f:	75 0a                	jne    77b <bputc+0x54>
+    bflush(fd);
+     771:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     774:	89 c7                	mov    %eax,%edi
+     776:	e8 eb fd ff ff       	call   566 <bflush>
+  b->data[b->n++] = c;
+     77b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     77f:	8b 00                	mov    (%rax),%eax
+     781:	8d 48 01             	lea    0x1(%rax),%ecx
+     784:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     788:	89 0a                	mov    %ecx,(%rdx)
+     78a:	0f b6 4d e8          	movzbl -0x18(%rbp),%ecx
+     78e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     792:	48 98                	cltq
+     794:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+}
+     798:	c9                   	leave
+     799:	c3                   	ret
+
+000000000000079a <bflushtty>:
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+     79a:	55                   	push   %rbp
+     79b:	48 89 e5             	mov    %rsp,%rbp
+     79e:	48 83 ec 10          	sub    $0x10,%rsp
+     7a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+     7a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     7a9:	78 4c                	js     7f7 <bflushtty+0x5d>
+     7ab:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     7af:	7f 46                	jg     7f7 <bflushtty+0x5d>
+     7b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7b4:	48 98                	cltq
+     7b6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     7bd:	00 
+     7be:	48 8d 05 7b 28 00 00 	lea    0x287b(%rip),%rax        # 3040 <obufs>
+     7c5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     7c9:	48 85 c0             	test   %rax,%rax
+     7cc:	74 29                	je     7f7 <bflushtty+0x5d>
+     7ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7d1:	48 98                	cltq
+     7d3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     7da:	00 
+     7db:	48 8d 05 5e 28 00 00 	lea    0x285e(%rip),%rax        # 3040 <obufs>
+     7e2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     7e6:	8b 40 04             	mov    0x4(%rax),%eax
+     7e9:	85 c0                	test   %eax,%eax
+     7eb:	74 0a                	je     7f7 <bflushtty+0x5d>
+    bflush(fd);
+     7ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7f0:	89 c7                	mov    %eax,%edi
+     7f2:	e8 6f fd ff ff       	call   566 <bflush>
+}
+     7f7:	90                   	nop
+     7f8:	c9                   	leave
+     7f9:	c3                   	ret
+
+00000000000007fa <fork>:
+
+int fork(void) {
+     7fa:	55                   	push   %rbp
+     7fb:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     7fe:	e8 ec fd ff ff       	call   5ef <bflushall>
+  return _fork();
+     803:	e8 7b 0a 00 00       	call   1283 <_fork>
+}
+     808:	5d                   	pop    %rbp
+     809:	c3                   	ret
+
+000000000000080a <exit>:
+
+noreturn void exit(void) {
+     80a:	55                   	push   %rbp
+     80b:	48 89 e5             	mov    %rsp,%rbp
+  bflushall();
+     80e:	e8 dc fd ff ff       	call   5ef <bflushall>
+  _exit();
+     813:	e8 76 0a 00 00       	call   128e <_exit>
+
+0000000000000818 <exec>:
+}
+
+int exec(char *path, char **argv) {
+     818:	55                   	push   %rbp
+     819:	48 89 e5             	mov    %rsp,%rbp
+     81c:	48 83 ec 10          	sub    $0x10,%rsp
+     820:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     824:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  bflushall();
+     828:	e8 c2 fd ff ff       	call   5ef <bflushall>
+  return _exec(path, argv);
+     82d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     835:	48 89 d6             	mov    %rdx,%rsi
+     838:	48 89 c7             	mov    %rax,%rdi
+     83b:	e8 9b 0a 00 00       	call   12db <_exec>
+}
+     840:	c9                   	leave
+     841:	c3                   	ret
+
+0000000000000842 <spawn>:
+
+int spawn(char *path, char **argv, int *fds) {
+     842:	55                   	push   %rbp
+     843:	48 89 e5             	mov    %rsp,%rbp
+     846:	48 83 ec 20          	sub    $0x20,%rsp
+     84a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     84e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     852:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  bflushall();
+     856:	e8 94 fd ff ff       	call   5ef <bflushall>
+  return _spawn(path, argv, fds);
+     85b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     85f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     867:	48 89 ce             	mov    %rcx,%rsi
+     86a:	48 89 c7             	mov    %rax,%rdi
+     86d:	e8 2f 0b 00 00       	call   13a1 <_spawn>
+}
+     872:	c9                   	leave
+     873:	c3                   	ret
+
+0000000000000874 <close>:
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+     874:	55                   	push   %rbp
+     875:	48 89 e5             	mov    %rsp,%rbp
+     878:	48 83 ec 10          	sub    $0x10,%rsp
+     87c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+     87f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     883:	78 69                	js     8ee <close+0x7a>
+     885:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+     889:	7f 63                	jg     8ee <close+0x7a>
+     88b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     88e:	48 98                	cltq
+     890:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     897:	00 
+     898:	48 8d 05 a1 27 00 00 	lea    0x27a1(%rip),%rax        # 3040 <obufs>
+     89f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8a3:	48 85 c0             	test   %rax,%rax
+     8a6:	74 46                	je     8ee <close+0x7a>
+    bflush(fd);
+     8a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8ab:	89 c7                	mov    %eax,%edi
+     8ad:	e8 b4 fc ff ff       	call   566 <bflush>
+    free(obufs[fd]);
+     8b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8b5:	48 98                	cltq
+     8b7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8be:	00 
+     8bf:	48 8d 05 7a 27 00 00 	lea    0x277a(%rip),%rax        # 3040 <obufs>
+     8c6:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+     8ca:	48 89 c7             	mov    %rax,%rdi
+     8cd:	e8 90 11 00 00       	call   1a62 <free>
+    obufs[fd] = 0;
+     8d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8d5:	48 98                	cltq
+     8d7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8de:	00 
+     8df:	48 8d 05 5a 27 00 00 	lea    0x275a(%rip),%rax        # 3040 <obufs>
+     8e6:	48 c7 04 02 00 00 00 	movq   $0x0,(%rdx,%rax,1)
+     8ed:	00 
+  }
+  return _close(fd);
+     8ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8f1:	89 c7                	mov    %eax,%edi
+     8f3:	e8 cd 09 00 00       	call   12c5 <_close>
+}
+     8f8:	c9                   	leave
+     8f9:	c3                   	ret
+
+00000000000008fa <clockns>:
+  while (*p && *p == *q)
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+}
+
+uint strlen(char *s) {
+     8fa:	55                   	push   %rbp
+     8fb:	48 89 e5             	mov    %rsp,%rbp
+     8fe:	53                   	push   %rbx
+     8ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     903:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int n;
+     907:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     90b:	48 8b 36             	mov    (%rsi),%rsi
+     90e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+     912:	48 29 f7             	sub    %rsi,%rdi
+     915:	48 89 f9             	mov    %rdi,%rcx
+     918:	bb 00 00 00 00       	mov    $0x0,%ebx
+     91d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+     921:	48 8b 76 08          	mov    0x8(%rsi),%rsi
+     925:	48 89 f0             	mov    %rsi,%rax
+     928:	ba 00 00 00 00       	mov    $0x0,%edx
+     92d:	48 89 df             	mov    %rbx,%rdi
+     930:	48 0f af f8          	imul   %rax,%rdi
+     934:	48 89 d6             	mov    %rdx,%rsi
+     937:	48 0f af f1          	imul   %rcx,%rsi
+     93b:	48 01 fe             	add    %rdi,%rsi
+     93e:	48 f7 e1             	mul    %rcx
+     941:	48 8d 0c 16          	lea    (%rsi,%rdx,1),%rcx
+     945:	48 89 ca             	mov    %rcx,%rdx
+     948:	48 0f ac d0 20       	shrd   $0x20,%rdx,%rax
+     94d:	48 c1 ea 20          	shr    $0x20,%rdx
+
+     951:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     955:	c9                   	leave
+     956:	c3                   	ret
+
+0000000000000957 <stosb>:
+               : "=S"(addr), "=c"(cnt)
+               : "d"(port), "0"(addr), "1"(cnt)
+               : "cc");
+}
+
+static inline void stosb(void *addr, int data, int cnt) {
+     957:	55                   	push   %rbp
+     958:	48 89 e5             	mov    %rsp,%rbp
+     95b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     95f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     962:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb"
+     965:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     969:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     96c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     96f:	48 89 ce             	mov    %rcx,%rsi
+     972:	48 89 f7             	mov    %rsi,%rdi
+     975:	89 d1                	mov    %edx,%ecx
+     977:	fc                   	cld
+     978:	f3 aa                	rep stos %al,%es:(%rdi)
+     97a:	89 ca                	mov    %ecx,%edx
+     97c:	48 89 fe             	mov    %rdi,%rsi
+     97f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     983:	89 55 f0             	mov    %edx,-0x10(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     986:	90                   	nop
+     987:	5d                   	pop    %rbp
+     988:	c3                   	ret
+
+0000000000000989 <stosq>:
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+
+static inline void stosq(void *addr, uint64_t data, uint64_t cnt) {
+     989:	55                   	push   %rbp
+     98a:	48 89 e5             	mov    %rsp,%rbp
+     98d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     991:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     995:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep stosq"
+     999:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     99d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     9a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9a5:	48 89 ce             	mov    %rcx,%rsi
+     9a8:	48 89 f7             	mov    %rsi,%rdi
+     9ab:	48 89 d1             	mov    %rdx,%rcx
+     9ae:	fc                   	cld
+     9af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+     9b2:	48 89 ca             	mov    %rcx,%rdx
+     9b5:	48 89 fe             	mov    %rdi,%rsi
+     9b8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     9bc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+               : "=D"(addr), "=c"(cnt)
+               : "0"(addr), "1"(cnt), "a"(data)
+               : "memory", "cc");
+}
+     9c0:	90                   	nop
+     9c1:	5d                   	pop    %rbp
+     9c2:	c3                   	ret
+
+00000000000009c3 <movsb>:
+
+static inline void movsb(void *dst, const void *src, uint64_t cnt) {
+     9c3:	55                   	push   %rbp
+     9c4:	48 89 e5             	mov    %rsp,%rbp
+     9c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     9cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsb"
+     9d3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     9d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     9db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     9df:	48 89 cf             	mov    %rcx,%rdi
+     9e2:	48 89 d6             	mov    %rdx,%rsi
+     9e5:	48 89 c1             	mov    %rax,%rcx
+     9e8:	fc                   	cld
+     9e9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+     9eb:	48 89 c8             	mov    %rcx,%rax
+     9ee:	48 89 f2             	mov    %rsi,%rdx
+     9f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9f5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     9f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     9fd:	90                   	nop
+     9fe:	5d                   	pop    %rbp
+     9ff:	c3                   	ret
+
+0000000000000a00 <movsq>:
+
+static inline void movsq(void *dst, const void *src, uint64_t cnt) {
+     a00:	55                   	push   %rbp
+     a01:	48 89 e5             	mov    %rsp,%rbp
+     a04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a08:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+     a0c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  asm volatile("cld; rep movsq"
+     a10:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a14:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a1c:	48 89 cf             	mov    %rcx,%rdi
+     a1f:	48 89 d6             	mov    %rdx,%rsi
+     a22:	48 89 c1             	mov    %rax,%rcx
+     a25:	fc                   	cld
+     a26:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+     a29:	48 89 c8             	mov    %rcx,%rax
+     a2c:	48 89 f2             	mov    %rsi,%rdx
+     a2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a33:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+     a37:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+               : "=D"(dst), "=S"(src), "=c"(cnt)
+               : "0"(dst), "1"(src), "2"(cnt)
+               : "memory", "cc");
+}
+     a3b:	90                   	nop
+     a3c:	5d                   	pop    %rbp
+     a3d:	c3                   	ret
+
+0000000000000a3e <rdtsc>:
+               : "r"(newval)
+               : "memory", "cc");
+  return ok;
+}
+
+static inline uint64_t rdtsc(void) {
+     a3e:	55                   	push   %rbp
+     a3f:	48 89 e5             	mov    %rsp,%rbp
+  uint32_t lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+     a42:	0f 31                	rdtsc
+     a44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     a47:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return ((uint64_t)hi << 32) | lo;
+     a4a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a4d:	48 c1 e0 20          	shl    $0x20,%rax
+     a51:	48 89 c2             	mov    %rax,%rdx
+     a54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a57:	48 09 d0             	or     %rdx,%rax
+}
+     a5a:	5d                   	pop    %rbp
+     a5b:	c3                   	ret
+
+0000000000000a5c <cpuid>:
+
+  asm volatile("wrmsr" : : "c"(msr), "a"(lo), "d"(hi) : "memory");
+}
+
+static inline void cpuid(uint32_t info, uint32_t *eaxp, uint32_t *ebxp,
+                         uint32_t *ecxp, uint32_t *edxp) {
+     a5c:	55                   	push   %rbp
+     a5d:	48 89 e5             	mov    %rsp,%rbp
+     a60:	53                   	push   %rbx
+     a61:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+     a64:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+     a68:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+     a6c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+     a70:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  uint32_t eax, ebx, ecx, edx;
+  asm volatile("cpuid"
+     a74:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a77:	0f a2                	cpuid
+     a79:	89 de                	mov    %ebx,%esi
+     a7b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     a7e:	89 75 f0             	mov    %esi,-0x10(%rbp)
+     a81:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+     a84:	89 55 e8             	mov    %edx,-0x18(%rbp)
+               : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+               : "a"(info));
+  if (eaxp)
+     a87:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     a8c:	74 09                	je     a97 <cpuid+0x3b>
+    *eaxp = eax;
+     a8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     a92:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     a95:	89 10                	mov    %edx,(%rax)
+  if (ebxp)
+     a97:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     a9c:	74 09                	je     aa7 <cpuid+0x4b>
+    *ebxp = ebx;
+     a9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     aa2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     aa5:	89 10                	mov    %edx,(%rax)
+  if (ecxp)
+     aa7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     aac:	74 09                	je     ab7 <cpuid+0x5b>
+    *ecxp = ecx;
+     aae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     ab2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     ab5:	89 10                	mov    %edx,(%rax)
+  if (edxp)
+     ab7:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+     abc:	74 09                	je     ac7 <cpuid+0x6b>
+    *edxp = edx;
+     abe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     ac2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     ac5:	89 10                	mov    %edx,(%rax)
+}
+     ac7:	90                   	nop
+     ac8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     acc:	c9                   	leave
+     acd:	c3                   	ret
+
+0000000000000ace <strcpy>:
+char *strcpy(char *s, char *t) {
+     ace:	55                   	push   %rbp
+     acf:	48 89 e5             	mov    %rsp,%rbp
+     ad2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     ad6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ade:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*s++ = *t++) != 0)
+     ae2:	90                   	nop
+     ae3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     ae7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     aeb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     af3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     af7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     afb:	0f b6 12             	movzbl (%rdx),%edx
+     afe:	88 10                	mov    %dl,(%rax)
+     b00:	0f b6 00             	movzbl (%rax),%eax
+     b03:	84 c0                	test   %al,%al
+     b05:	75 dc                	jne    ae3 <strcpy+0x15>
+  return os;
+     b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b0b:	5d                   	pop    %rbp
+     b0c:	c3                   	ret
+
+0000000000000b0d <strcmp>:
+int strcmp(const char *p, const char *q) {
+     b0d:	55                   	push   %rbp
+     b0e:	48 89 e5             	mov    %rsp,%rbp
+     b11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b15:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+     b19:	eb 0a                	jmp    b25 <strcmp+0x18>
+    p++, q++;
+     b1b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     b20:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+     b25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b29:	0f b6 00             	movzbl (%rax),%eax
+     b2c:	84 c0                	test   %al,%al
+     b2e:	74 12                	je     b42 <strcmp+0x35>
+     b30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b34:	0f b6 10             	movzbl (%rax),%edx
+     b37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b3b:	0f b6 00             	movzbl (%rax),%eax
+     b3e:	38 c2                	cmp    %al,%dl
+     b40:	74 d9                	je     b1b <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b46:	0f b6 00             	movzbl (%rax),%eax
+     b49:	0f b6 d0             	movzbl %al,%edx
+     b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b50:	0f b6 00             	movzbl (%rax),%eax
+     b53:	0f b6 c0             	movzbl %al,%eax
+     b56:	29 c2                	sub    %eax,%edx
+     b58:	89 d0                	mov    %edx,%eax
+}
+     b5a:	5d                   	pop    %rbp
+     b5b:	c3                   	ret
+
+0000000000000b5c <strlen>:
+uint strlen(char *s) {
+     b5c:	55                   	push   %rbp
+     b5d:	48 89 e5             	mov    %rsp,%rbp
+     b60:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for (n = 0; s[n]; n++)
+     b64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b6b:	eb 04                	jmp    b71 <strlen+0x15>
+     b6d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b74:	48 63 d0             	movslq %eax,%rdx
+     b77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b7b:	48 01 d0             	add    %rdx,%rax
+     b7e:	0f b6 00             	movzbl (%rax),%eax
+     b81:	84 c0                	test   %al,%al
+     b83:	75 e8                	jne    b6d <strlen+0x11>
+    ;
+  return n;
+     b85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     b88:	5d                   	pop    %rbp
+     b89:	c3                   	ret
+
+0000000000000b8a <haserms>:
+
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+     b8a:	55                   	push   %rbp
+     b8b:	48 89 e5             	mov    %rsp,%rbp
+     b8e:	53                   	push   %rbx
+     b8f:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+     b93:	8b 05 9b 24 00 00    	mov    0x249b(%rip),%eax        # 3034 <erms>
+     b99:	85 c0                	test   %eax,%eax
+     b9b:	79 53                	jns    bf0 <haserms+0x66>
+    cpuid(0, &eax, 0, 0, 0);
+     b9d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     ba1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     ba7:	b9 00 00 00 00       	mov    $0x0,%ecx
+     bac:	ba 00 00 00 00       	mov    $0x0,%edx
+     bb1:	48 89 c6             	mov    %rax,%rsi
+     bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+     bb9:	e8 9e fe ff ff       	call   a5c <cpuid>
+    ebx = 0;
+     bbe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    if (eax >= 7)
+     bc5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     bc8:	83 f8 06             	cmp    $0x6,%eax
+     bcb:	76 14                	jbe    be1 <haserms+0x57>
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+     bcd:	b8 07 00 00 00       	mov    $0x7,%eax
+     bd2:	b9 00 00 00 00       	mov    $0x0,%ecx
+     bd7:	0f a2                	cpuid
+     bd9:	89 d9                	mov    %ebx,%ecx
+     bdb:	89 4d f4             	mov    %ecx,-0xc(%rbp)
+     bde:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    erms = (ebx >> 9) & 1;
+     be1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     be4:	c1 e8 09             	shr    $0x9,%eax
+     be7:	83 e0 01             	and    $0x1,%eax
+     bea:	89 05 44 24 00 00    	mov    %eax,0x2444(%rip)        # 3034 <erms>
+  }
+  return erms;
+     bf0:	8b 05 3e 24 00 00    	mov    0x243e(%rip),%eax        # 3034 <erms>
+}
+     bf6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     bfa:	c9                   	leave
+     bfb:	c3                   	ret
+
+0000000000000bfc <memset>:
+
+void *memset(void *dst, int c, uint n) {
+     bfc:	55                   	push   %rbp
+     bfd:	48 89 e5             	mov    %rsp,%rbp
+     c00:	48 83 ec 10          	sub    $0x10,%rsp
+     c04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c08:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c0b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if (n < 8 || haserms()) {
+     c0e:	83 7d f0 07          	cmpl   $0x7,-0x10(%rbp)
+     c12:	76 09                	jbe    c1d <memset+0x21>
+     c14:	e8 71 ff ff ff       	call   b8a <haserms>
+     c19:	85 c0                	test   %eax,%eax
+     c1b:	74 16                	je     c33 <memset+0x37>
+    stosb(dst, c, n);
+     c1d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c20:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     c23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c27:	89 ce                	mov    %ecx,%esi
+     c29:	48 89 c7             	mov    %rax,%rdi
+     c2c:	e8 26 fd ff ff       	call   957 <stosb>
+     c31:	eb 58                	jmp    c8b <memset+0x8f>
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+     c33:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c36:	c1 e8 03             	shr    $0x3,%eax
+     c39:	89 c6                	mov    %eax,%esi
+     c3b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c3e:	48 98                	cltq
+     c40:	0f b6 c0             	movzbl %al,%eax
+     c43:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+     c4a:	01 01 01 
+     c4d:	48 0f af c2          	imul   %rdx,%rax
+     c51:	48 89 c1             	mov    %rax,%rcx
+     c54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c58:	48 89 f2             	mov    %rsi,%rdx
+     c5b:	48 89 ce             	mov    %rcx,%rsi
+     c5e:	48 89 c7             	mov    %rax,%rdi
+     c61:	e8 23 fd ff ff       	call   989 <stosq>
+    stosb((char *)dst + (n & ~7), c, n % 8);
+     c66:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c69:	83 e0 07             	and    $0x7,%eax
+     c6c:	89 c2                	mov    %eax,%edx
+     c6e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     c71:	83 e0 f8             	and    $0xfffffff8,%eax
+     c74:	48 89 c1             	mov    %rax,%rcx
+     c77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c7b:	48 01 c1             	add    %rax,%rcx
+     c7e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c81:	89 c6                	mov    %eax,%esi
+     c83:	48 89 cf             	mov    %rcx,%rdi
+     c86:	e8 cc fc ff ff       	call   957 <stosb>
+  }
+  return dst;
+     c8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c8f:	c9                   	leave
+     c90:	c3                   	ret
+
+0000000000000c91 <strchr>:
+
+char *strchr(const char *s, char c) {
+     c91:	55                   	push   %rbp
+     c92:	48 89 e5             	mov    %rsp,%rbp
+     c95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c99:	89 f0                	mov    %esi,%eax
+     c9b:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+     c9e:	eb 17                	jmp    cb7 <strchr+0x26>
+    if (*s == c)
+     ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ca4:	0f b6 00             	movzbl (%rax),%eax
+     ca7:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     caa:	75 06                	jne    cb2 <strchr+0x21>
+      return (char *)s;
+     cac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb0:	eb 15                	jmp    cc7 <strchr+0x36>
+  for (; *s; s++)
+     cb2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     cb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cbb:	0f b6 00             	movzbl (%rax),%eax
+     cbe:	84 c0                	test   %al,%al
+     cc0:	75 de                	jne    ca0 <strchr+0xf>
+  return 0;
+     cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     cc7:	5d                   	pop    %rbp
+     cc8:	c3                   	ret
+
+0000000000000cc9 <gets>:
+
+char *gets(char *buf, int max) {
+     cc9:	55                   	push   %rbp
+     cca:	48 89 e5             	mov    %rsp,%rbp
+     ccd:	48 83 ec 20          	sub    $0x20,%rsp
+     cd1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     cd5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for (i = 0; i + 1 < max;) {
+     cd8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     cdf:	eb 48                	jmp    d29 <gets+0x60>
+    cc = read(0, &c, 1);
+     ce1:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     ce5:	ba 01 00 00 00       	mov    $0x1,%edx
+     cea:	48 89 c6             	mov    %rax,%rsi
+     ced:	bf 00 00 00 00       	mov    $0x0,%edi
+     cf2:	e8 b8 05 00 00       	call   12af <read>
+     cf7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (cc < 1)
+     cfa:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     cfe:	7e 36                	jle    d36 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d03:	8d 50 01             	lea    0x1(%rax),%edx
+     d06:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d09:	48 63 d0             	movslq %eax,%rdx
+     d0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d10:	48 01 c2             	add    %rax,%rdx
+     d13:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d17:	88 02                	mov    %al,(%rdx)
+    if (c == '\n' || c == '\r')
+     d19:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d1d:	3c 0a                	cmp    $0xa,%al
+     d1f:	74 16                	je     d37 <gets+0x6e>
+     d21:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d25:	3c 0d                	cmp    $0xd,%al
+     d27:	74 0e                	je     d37 <gets+0x6e>
+  for (i = 0; i + 1 < max;) {
+     d29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d2c:	83 c0 01             	add    $0x1,%eax
+     d2f:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     d32:	7f ad                	jg     ce1 <gets+0x18>
+     d34:	eb 01                	jmp    d37 <gets+0x6e>
+      break;
+     d36:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     d37:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d3a:	48 63 d0             	movslq %eax,%rdx
+     d3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d41:	48 01 d0             	add    %rdx,%rax
+     d44:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     d47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     d4b:	c9                   	leave
+     d4c:	c3                   	ret
+
+0000000000000d4d <stat>:
+
+int stat(char *n, struct stat *st) {
+     d4d:	55                   	push   %rbp
+     d4e:	48 89 e5             	mov    %rsp,%rbp
+     d51:	48 83 ec 10          	sub    $0x10,%rsp
+     d55:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     d59:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return fstatat(AT_FDCWD, n, st);
+     d5d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     d61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d65:	48 89 c6             	mov    %rax,%rsi
+     d68:	bf 9c ff ff ff       	mov    $0xffffff9c,%edi
+     d6d:	e8 58 07 00 00       	call   14ca <fstatat>
+}
+     d72:	c9                   	leave
+     d73:	c3                   	ret
+
+0000000000000d74 <atoi>:
+
+int atoi(const char *s) {
+     d74:	55                   	push   %rbp
+     d75:	48 89 e5             	mov    %rsp,%rbp
+     d78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     d7c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     d83:	eb 28                	jmp    dad <atoi+0x39>
+    n = n * 10 + *s++ - '0';
+     d85:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d88:	89 d0                	mov    %edx,%eax
+     d8a:	c1 e0 02             	shl    $0x2,%eax
+     d8d:	01 d0                	add    %edx,%eax
+     d8f:	01 c0                	add    %eax,%eax
+     d91:	89 c1                	mov    %eax,%ecx
+     d93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d97:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     d9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     d9f:	0f b6 00             	movzbl (%rax),%eax
+     da2:	0f be c0             	movsbl %al,%eax
+     da5:	01 c8                	add    %ecx,%eax
+     da7:	83 e8 30             	sub    $0x30,%eax
+     daa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while ('0' <= *s && *s <= '9')
+     dad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     db1:	0f b6 00             	movzbl (%rax),%eax
+     db4:	3c 2f                	cmp    $0x2f,%al
+     db6:	7e 0b                	jle    dc3 <atoi+0x4f>
+     db8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dbc:	0f b6 00             	movzbl (%rax),%eax
+     dbf:	3c 39                	cmp    $0x39,%al
+     dc1:	7e c2                	jle    d85 <atoi+0x11>
+  return n;
+     dc3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     dc6:	5d                   	pop    %rbp
+     dc7:	c3                   	ret
+
+0000000000000dc8 <memmove>:
+
+void *memmove(void *vdst, void *vsrc, int n) {
+     dc8:	55                   	push   %rbp
+     dc9:	48 89 e5             	mov    %rsp,%rbp
+     dcc:	48 83 ec 28          	sub    $0x28,%rsp
+     dd0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     dd4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     dd8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     ddb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ddf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     de3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     de7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n <= 0)
+     deb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     def:	7f 09                	jg     dfa <memmove+0x32>
+    return vdst;
+     df1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     df5:	e9 29 01 00 00       	jmp    f23 <memmove+0x15b>
+  if (src < dst && src + n > dst) {
+     dfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     dfe:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     e02:	0f 83 87 00 00 00    	jae    e8f <memmove+0xc7>
+     e08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e0b:	48 63 d0             	movslq %eax,%rdx
+     e0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e12:	48 01 d0             	add    %rdx,%rax
+     e15:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e19:	73 74                	jae    e8f <memmove+0xc7>
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+     e1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e1e:	48 98                	cltq
+     e20:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    dst += n;
+     e24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e27:	48 98                	cltq
+     e29:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+     e2d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e35:	48 09 d0             	or     %rdx,%rax
+     e38:	83 e0 07             	and    $0x7,%eax
+     e3b:	48 85 c0             	test   %rax,%rax
+     e3e:	75 3d                	jne    e7d <memmove+0xb5>
+      for (; n >= 8; n -= 8) {
+     e40:	eb 1c                	jmp    e5e <memmove+0x96>
+        src -= 8;
+     e42:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+        dst -= 8;
+     e47:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+        *(uint64_t *)dst = *(uint64_t *)src;
+     e4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e50:	48 8b 10             	mov    (%rax),%rdx
+     e53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e57:	48 89 10             	mov    %rdx,(%rax)
+      for (; n >= 8; n -= 8) {
+     e5a:	83 6d dc 08          	subl   $0x8,-0x24(%rbp)
+     e5e:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     e62:	7f de                	jg     e42 <memmove+0x7a>
+      }
+    }
+    while (n-- > 0)
+     e64:	eb 17                	jmp    e7d <memmove+0xb5>
+      *--dst = *--src;
+     e66:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+     e6b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+     e70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e74:	0f b6 10             	movzbl (%rax),%edx
+     e77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e7b:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+     e7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e80:	8d 50 ff             	lea    -0x1(%rax),%edx
+     e83:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     e86:	85 c0                	test   %eax,%eax
+     e88:	7f dc                	jg     e66 <memmove+0x9e>
+  if (src < dst && src + n > dst) {
+     e8a:	e9 90 00 00 00       	jmp    f1f <memmove+0x157>
+  } else if (n < 8 || haserms()) {
+     e8f:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+     e93:	7e 09                	jle    e9e <memmove+0xd6>
+     e95:	e8 f0 fc ff ff       	call   b8a <haserms>
+     e9a:	85 c0                	test   %eax,%eax
+     e9c:	74 1b                	je     eb9 <memmove+0xf1>
+    movsb(dst, src, n);
+     e9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ea1:	48 63 d0             	movslq %eax,%rdx
+     ea4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     ea8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eac:	48 89 ce             	mov    %rcx,%rsi
+     eaf:	48 89 c7             	mov    %rax,%rdi
+     eb2:	e8 0c fb ff ff       	call   9c3 <movsb>
+     eb7:	eb 66                	jmp    f1f <memmove+0x157>
+  } else {
+    movsq(dst, src, n / 8);
+     eb9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ebc:	8d 50 07             	lea    0x7(%rax),%edx
+     ebf:	85 c0                	test   %eax,%eax
+     ec1:	0f 48 c2             	cmovs  %edx,%eax
+     ec4:	c1 f8 03             	sar    $0x3,%eax
+     ec7:	48 63 d0             	movslq %eax,%rdx
+     eca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     ece:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed2:	48 89 ce             	mov    %rcx,%rsi
+     ed5:	48 89 c7             	mov    %rax,%rdi
+     ed8:	e8 23 fb ff ff       	call   a00 <movsq>
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+     edd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     ee0:	89 d0                	mov    %edx,%eax
+     ee2:	c1 f8 1f             	sar    $0x1f,%eax
+     ee5:	c1 e8 1d             	shr    $0x1d,%eax
+     ee8:	01 c2                	add    %eax,%edx
+     eea:	83 e2 07             	and    $0x7,%edx
+     eed:	29 c2                	sub    %eax,%edx
+     eef:	89 d0                	mov    %edx,%eax
+     ef1:	48 98                	cltq
+     ef3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     ef6:	83 e2 f8             	and    $0xfffffff8,%edx
+     ef9:	48 63 ca             	movslq %edx,%rcx
+     efc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f00:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+     f04:	8b 55 dc             	mov    -0x24(%rbp),%edx
+     f07:	83 e2 f8             	and    $0xfffffff8,%edx
+     f0a:	48 63 ca             	movslq %edx,%rcx
+     f0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     f11:	48 01 d1             	add    %rdx,%rcx
+     f14:	48 89 c2             	mov    %rax,%rdx
+     f17:	48 89 cf             	mov    %rcx,%rdi
+     f1a:	e8 a4 fa ff ff       	call   9c3 <movsb>
+  }
+  return vdst;
+     f1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     f23:	c9                   	leave
+     f24:	c3                   	ret
+
+0000000000000f25 <clock_gettime>:
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+     f25:	55                   	push   %rbp
+     f26:	48 89 e5             	mov    %rsp,%rbp
+     f29:	48 83 ec 20          	sub    $0x20,%rsp
+     f2d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     f30:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+     f34:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+     f3b:	00 00 00 
+     f3e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+     f42:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+     f46:	75 0d                	jne    f55 <clock_gettime+0x30>
+     f48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+     f50:	48 85 c0             	test   %rax,%rax
+     f53:	75 13                	jne    f68 <clock_gettime+0x43>
+    return _clock_gettime(clk, ts);
+     f55:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     f59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f5c:	48 89 d6             	mov    %rdx,%rsi
+     f5f:	89 c7                	mov    %eax,%edi
+     f61:	e8 e0 04 00 00       	call   1446 <_clock_gettime>
+     f66:	eb 7d                	jmp    fe5 <clock_gettime+0xc0>
+  ns = clockns(c, rdtsc());
+     f68:	e8 d1 fa ff ff       	call   a3e <rdtsc>
+     f6d:	48 89 c2             	mov    %rax,%rdx
+     f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f74:	48 89 d6             	mov    %rdx,%rsi
+     f77:	48 89 c7             	mov    %rax,%rdi
+     f7a:	e8 7b f9 ff ff       	call   8fa <clockns>
+     f7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  ts->tv_sec = ns / 1000000000;
+     f83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f87:	48 c1 e8 09          	shr    $0x9,%rax
+     f8b:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+     f92:	b8 44 00 
+     f95:	48 f7 e2             	mul    %rdx
+     f98:	48 89 d0             	mov    %rdx,%rax
+     f9b:	48 c1 e8 0b          	shr    $0xb,%rax
+     f9f:	48 89 c2             	mov    %rax,%rdx
+     fa2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     fa6:	48 89 10             	mov    %rdx,(%rax)
+  ts->tv_nsec = ns % 1000000000;
+     fa9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     fad:	48 89 c8             	mov    %rcx,%rax
+     fb0:	48 c1 e8 09          	shr    $0x9,%rax
+     fb4:	48 ba 53 5a 9b a0 2f 	movabs $0x44b82fa09b5a53,%rdx
+     fbb:	b8 44 00 
+     fbe:	48 f7 e2             	mul    %rdx
+     fc1:	48 89 d0             	mov    %rdx,%rax
+     fc4:	48 c1 e8 0b          	shr    $0xb,%rax
+     fc8:	48 69 d0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%rdx
+     fcf:	48 89 c8             	mov    %rcx,%rax
+     fd2:	48 29 d0             	sub    %rdx,%rax
+     fd5:	48 89 c2             	mov    %rax,%rdx
+     fd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     fdc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return 0;
+     fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     fe5:	c9                   	leave
+     fe6:	c3                   	ret
+
+0000000000000fe7 <mutex_wait>:
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+     fe7:	55                   	push   %rbp
+     fe8:	48 89 e5             	mov    %rsp,%rbp
+     feb:	48 83 ec 10          	sub    $0x10,%rsp
+     fef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+     ff3:	eb 11                	jmp    1006 <mutex_wait+0x1f>
+    futex_wait(&m->state, 2);
+     ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff9:	be 02 00 00 00       	mov    $0x2,%esi
+     ffe:	48 89 c7             	mov    %rax,%rdi
+    1001:	e8 6c 04 00 00       	call   1472 <futex_wait>
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    1006:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    100a:	b8 02 00 00 00       	mov    $0x2,%eax
+    100f:	87 02                	xchg   %eax,(%rdx)
+    1011:	85 c0                	test   %eax,%eax
+    1013:	75 e0                	jne    ff5 <mutex_wait+0xe>
+}
+    1015:	90                   	nop
+    1016:	90                   	nop
+    1017:	c9                   	leave
+    1018:	c3                   	ret
+
+0000000000001019 <mutex_lock>:
+
+void mutex_lock(struct mutex *m) {
+    1019:	55                   	push   %rbp
+    101a:	48 89 e5             	mov    %rsp,%rbp
+    101d:	48 83 ec 20          	sub    $0x20,%rsp
+    1021:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c = 0;
+    1025:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+    102c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+    1030:	48 8d 55 fc          	lea    -0x4(%rbp),%rdx
+    1034:	8b 02                	mov    (%rdx),%eax
+    1036:	b9 01 00 00 00       	mov    $0x1,%ecx
+    103b:	f0 0f b1 0e          	lock cmpxchg %ecx,(%rsi)
+    103f:	89 c1                	mov    %eax,%ecx
+    1041:	0f 94 c0             	sete   %al
+    1044:	84 c0                	test   %al,%al
+    1046:	75 02                	jne    104a <mutex_lock+0x31>
+    1048:	89 0a                	mov    %ecx,(%rdx)
+    104a:	83 f0 01             	xor    $0x1,%eax
+    104d:	84 c0                	test   %al,%al
+    104f:	74 0c                	je     105d <mutex_lock+0x44>
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+    1051:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1055:	48 89 c7             	mov    %rax,%rdi
+    1058:	e8 8a ff ff ff       	call   fe7 <mutex_wait>
+}
+    105d:	90                   	nop
+    105e:	c9                   	leave
+    105f:	c3                   	ret
+
+0000000000001060 <mutex_unlock>:
+
+void mutex_unlock(struct mutex *m) {
+    1060:	55                   	push   %rbp
+    1061:	48 89 e5             	mov    %rsp,%rbp
+    1064:	48 83 ec 10          	sub    $0x10,%rsp
+    1068:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    106c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1070:	ba 00 00 00 00       	mov    $0x0,%edx
+    1075:	87 10                	xchg   %edx,(%rax)
+    1077:	83 fa 02             	cmp    $0x2,%edx
+    107a:	75 11                	jne    108d <mutex_unlock+0x2d>
+    futex_wake(&m->state, 1);
+    107c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1080:	be 01 00 00 00       	mov    $0x1,%esi
+    1085:	48 89 c7             	mov    %rax,%rdi
+    1088:	e8 f0 03 00 00       	call   147d <futex_wake>
+}
+    108d:	90                   	nop
+    108e:	c9                   	leave
+    108f:	c3                   	ret
+
+0000000000001090 <cond_wait>:
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+    1090:	55                   	push   %rbp
+    1091:	48 89 e5             	mov    %rsp,%rbp
+    1094:	48 83 ec 20          	sub    $0x20,%rsp
+    1098:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    109c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+    10a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10a4:	48 83 c0 04          	add    $0x4,%rax
+    10a8:	f0 83 00 01          	lock addl $0x1,(%rax)
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+    10ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10b0:	8b 00                	mov    (%rax),%eax
+    10b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+    10b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10b9:	48 89 c7             	mov    %rax,%rdi
+    10bc:	e8 9f ff ff ff       	call   1060 <mutex_unlock>
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+    10c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10c5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    10c8:	89 d6                	mov    %edx,%esi
+    10ca:	48 89 c7             	mov    %rax,%rdi
+    10cd:	e8 a0 03 00 00       	call   1472 <futex_wait>
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+    10d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10d6:	48 83 c0 04          	add    $0x4,%rax
+    10da:	f0 83 28 01          	lock subl $0x1,(%rax)
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+    10de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    10e2:	48 89 c7             	mov    %rax,%rdi
+    10e5:	e8 fd fe ff ff       	call   fe7 <mutex_wait>
+}
+    10ea:	90                   	nop
+    10eb:	c9                   	leave
+    10ec:	c3                   	ret
+
+00000000000010ed <cond_signal>:
+
+void cond_signal(struct cond *c) {
+    10ed:	55                   	push   %rbp
+    10ee:	48 89 e5             	mov    %rsp,%rbp
+    10f1:	48 83 ec 10          	sub    $0x10,%rsp
+    10f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    10f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10fd:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1101:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1105:	48 83 c0 04          	add    $0x4,%rax
+    1109:	8b 00                	mov    (%rax),%eax
+    110b:	85 c0                	test   %eax,%eax
+    110d:	7e 11                	jle    1120 <cond_signal+0x33>
+    futex_wake(&c->seq, 1);
+    110f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1113:	be 01 00 00 00       	mov    $0x1,%esi
+    1118:	48 89 c7             	mov    %rax,%rdi
+    111b:	e8 5d 03 00 00       	call   147d <futex_wake>
+}
+    1120:	90                   	nop
+    1121:	c9                   	leave
+    1122:	c3                   	ret
+
+0000000000001123 <cond_broadcast>:
+
+void cond_broadcast(struct cond *c) {
+    1123:	55                   	push   %rbp
+    1124:	48 89 e5             	mov    %rsp,%rbp
+    1127:	48 83 ec 10          	sub    $0x10,%rsp
+    112b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+    112f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1133:	f0 83 00 01          	lock addl $0x1,(%rax)
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    1137:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    113b:	48 83 c0 04          	add    $0x4,%rax
+    113f:	8b 00                	mov    (%rax),%eax
+    1141:	85 c0                	test   %eax,%eax
+    1143:	7e 11                	jle    1156 <cond_broadcast+0x33>
+    futex_wake(&c->seq, 1 << 30);
+    1145:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1149:	be 00 00 00 40       	mov    $0x40000000,%esi
+    114e:	48 89 c7             	mov    %rax,%rdi
+    1151:	e8 27 03 00 00       	call   147d <futex_wake>
+}
+    1156:	90                   	nop
+    1157:	c9                   	leave
+    1158:	c3                   	ret
+
+0000000000001159 <ring_push>:
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+    1159:	55                   	push   %rbp
+    115a:	48 89 e5             	mov    %rsp,%rbp
+    115d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1161:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+    1164:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    1168:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+    116c:	4c 89 45 c8          	mov    %r8,-0x38(%rbp)
+    1170:	4c 89 4d c0          	mov    %r9,-0x40(%rbp)
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+    1174:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1178:	8b 40 04             	mov    0x4(%rax),%eax
+    117b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    117e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1182:	8b 00                	mov    (%rax),%eax
+    1184:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1187:	29 c2                	sub    %eax,%edx
+    1189:	83 fa 1f             	cmp    $0x1f,%edx
+    118c:	76 07                	jbe    1195 <ring_push+0x3c>
+    return -1;
+    118e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1193:	eb 7e                	jmp    1213 <ring_push+0xba>
+  e = &r->sq[tail % RINGN];
+    1195:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1198:	83 e0 1f             	and    $0x1f,%eax
+    119b:	89 c2                	mov    %eax,%edx
+    119d:	48 89 d0             	mov    %rdx,%rax
+    11a0:	48 01 c0             	add    %rax,%rax
+    11a3:	48 01 d0             	add    %rdx,%rax
+    11a6:	48 c1 e0 04          	shl    $0x4,%rax
+    11aa:	48 8d 50 10          	lea    0x10(%rax),%rdx
+    11ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11b2:	48 01 d0             	add    %rdx,%rax
+    11b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e->op = op;
+    11b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11bd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+    11c0:	89 10                	mov    %edx,(%rax)
+  e->args[0] = a0;
+    11c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11c6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    11ca:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  e->args[1] = a1;
+    11ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11d2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    11d6:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  e->args[2] = a2;
+    11da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11de:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    11e2:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  e->args[3] = a3;
+    11e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+    11ee:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  e->data = data;
+    11f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11f6:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+    11fa:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+    11fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1201:	8d 50 01             	lea    0x1(%rax),%edx
+    1204:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1208:	48 83 c0 04          	add    $0x4,%rax
+    120c:	89 10                	mov    %edx,(%rax)
+  return 0;
+    120e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1213:	5d                   	pop    %rbp
+    1214:	c3                   	ret
+
+0000000000001215 <ring_pop>:
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+    1215:	55                   	push   %rbp
+    1216:	48 89 e5             	mov    %rsp,%rbp
+    1219:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    121d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint head = r->cqhead;
+    1221:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1225:	8b 40 08             	mov    0x8(%rax),%eax
+    1228:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    122b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    122f:	48 83 c0 0c          	add    $0xc,%rax
+    1233:	8b 00                	mov    (%rax),%eax
+    1235:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+    1238:	75 07                	jne    1241 <ring_pop+0x2c>
+    return -1;
+    123a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    123f:	eb 40                	jmp    1281 <ring_pop+0x6c>
+  *c = r->cq[head % RINGN];
+    1241:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1244:	83 e0 1f             	and    $0x1f,%eax
+    1247:	89 c2                	mov    %eax,%edx
+    1249:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+    124d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1251:	89 d2                	mov    %edx,%edx
+    1253:	48 83 c2 61          	add    $0x61,%rdx
+    1257:	48 c1 e2 04          	shl    $0x4,%rdx
+    125b:	48 01 d0             	add    %rdx,%rax
+    125e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1262:	48 8b 00             	mov    (%rax),%rax
+    1265:	48 89 01             	mov    %rax,(%rcx)
+    1268:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+    126c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    126f:	8d 50 01             	lea    0x1(%rax),%edx
+    1272:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1276:	48 83 c0 08          	add    $0x8,%rax
+    127a:	89 10                	mov    %edx,(%rax)
+  return 0;
+    127c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1281:	5d                   	pop    %rbp
+    1282:	c3                   	ret
+
+0000000000001283 <_fork>:
+  movl $SYS_##name, % eax;                                                     \
+  movq % rcx, % r10;                                                           \
+  syscall;                                                                     \
+  ret
+
+SYSCALL_(fork)
+    1283:	b8 01 00 00 00       	mov    $0x1,%eax
+    1288:	49 89 ca             	mov    %rcx,%r10
+    128b:	0f 05                	syscall
+    128d:	c3                   	ret
+
+000000000000128e <_exit>:
+SYSCALL_(exit)
+    128e:	b8 02 00 00 00       	mov    $0x2,%eax
+    1293:	49 89 ca             	mov    %rcx,%r10
+    1296:	0f 05                	syscall
+    1298:	c3                   	ret
+
+0000000000001299 <wait>:
+SYSCALL(wait)
+    1299:	b8 03 00 00 00       	mov    $0x3,%eax
+    129e:	49 89 ca             	mov    %rcx,%r10
+    12a1:	0f 05                	syscall
+    12a3:	c3                   	ret
+
+00000000000012a4 <pipe>:
+SYSCALL(pipe)
+    12a4:	b8 04 00 00 00       	mov    $0x4,%eax
+    12a9:	49 89 ca             	mov    %rcx,%r10
+    12ac:	0f 05                	syscall
+    12ae:	c3                   	ret
+
+00000000000012af <read>:
+SYSCALL(read)
+    12af:	b8 05 00 00 00       	mov    $0x5,%eax
+    12b4:	49 89 ca             	mov    %rcx,%r10
+    12b7:	0f 05                	syscall
+    12b9:	c3                   	ret
+
+00000000000012ba <write>:
+SYSCALL(write)
+    12ba:	b8 10 00 00 00       	mov    $0x10,%eax
+    12bf:	49 89 ca             	mov    %rcx,%r10
+    12c2:	0f 05                	syscall
+    12c4:	c3                   	ret
+
+00000000000012c5 <_close>:
+SYSCALL_(close)
+    12c5:	b8 15 00 00 00       	mov    $0x15,%eax
+    12ca:	49 89 ca             	mov    %rcx,%r10
+    12cd:	0f 05                	syscall
+    12cf:	c3                   	ret
+
+00000000000012d0 <kill>:
+SYSCALL(kill)
+    12d0:	b8 06 00 00 00       	mov    $0x6,%eax
+    12d5:	49 89 ca             	mov    %rcx,%r10
+    12d8:	0f 05                	syscall
+    12da:	c3                   	ret
+
+00000000000012db <_exec>:
+SYSCALL_(exec)
+    12db:	b8 07 00 00 00       	mov    $0x7,%eax
+    12e0:	49 89 ca             	mov    %rcx,%r10
+    12e3:	0f 05                	syscall
+    12e5:	c3                   	ret
+
+00000000000012e6 <open>:
+SYSCALL(open)
+    12e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12eb:	49 89 ca             	mov    %rcx,%r10
+    12ee:	0f 05                	syscall
+    12f0:	c3                   	ret
+
+00000000000012f1 <mknod>:
+SYSCALL(mknod)
+    12f1:	b8 11 00 00 00       	mov    $0x11,%eax
+    12f6:	49 89 ca             	mov    %rcx,%r10
+    12f9:	0f 05                	syscall
+    12fb:	c3                   	ret
+
+00000000000012fc <unlink>:
+SYSCALL(unlink)
+    12fc:	b8 12 00 00 00       	mov    $0x12,%eax
+    1301:	49 89 ca             	mov    %rcx,%r10
+    1304:	0f 05                	syscall
+    1306:	c3                   	ret
+
+0000000000001307 <fstat>:
+SYSCALL(fstat)
+    1307:	b8 08 00 00 00       	mov    $0x8,%eax
+    130c:	49 89 ca             	mov    %rcx,%r10
+    130f:	0f 05                	syscall
+    1311:	c3                   	ret
+
+0000000000001312 <link>:
+SYSCALL(link)
+    1312:	b8 13 00 00 00       	mov    $0x13,%eax
+    1317:	49 89 ca             	mov    %rcx,%r10
+    131a:	0f 05                	syscall
+    131c:	c3                   	ret
+
+000000000000131d <mkdir>:
+SYSCALL(mkdir)
+    131d:	b8 14 00 00 00       	mov    $0x14,%eax
+    1322:	49 89 ca             	mov    %rcx,%r10
+    1325:	0f 05                	syscall
+    1327:	c3                   	ret
+
+0000000000001328 <chdir>:
+SYSCALL(chdir)
+    1328:	b8 09 00 00 00       	mov    $0x9,%eax
+    132d:	49 89 ca             	mov    %rcx,%r10
+    1330:	0f 05                	syscall
+    1332:	c3                   	ret
+
+0000000000001333 <dup>:
+SYSCALL(dup)
+    1333:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1338:	49 89 ca             	mov    %rcx,%r10
+    133b:	0f 05                	syscall
+    133d:	c3                   	ret
+
+000000000000133e <getpid>:
+SYSCALL(getpid)
+    133e:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1343:	49 89 ca             	mov    %rcx,%r10
+    1346:	0f 05                	syscall
+    1348:	c3                   	ret
+
+0000000000001349 <sbrk>:
+SYSCALL(sbrk)
+    1349:	b8 0c 00 00 00       	mov    $0xc,%eax
+    134e:	49 89 ca             	mov    %rcx,%r10
+    1351:	0f 05                	syscall
+    1353:	c3                   	ret
+
+0000000000001354 <sleep>:
+SYSCALL(sleep)
+    1354:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1359:	49 89 ca             	mov    %rcx,%r10
+    135c:	0f 05                	syscall
+    135e:	c3                   	ret
+
+000000000000135f <uptime>:
+SYSCALL(uptime)
+    135f:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1364:	49 89 ca             	mov    %rcx,%r10
+    1367:	0f 05                	syscall
+    1369:	c3                   	ret
+
+000000000000136a <sysinfo>:
+SYSCALL(sysinfo)
+    136a:	b8 16 00 00 00       	mov    $0x16,%eax
+    136f:	49 89 ca             	mov    %rcx,%r10
+    1372:	0f 05                	syscall
+    1374:	c3                   	ret
+
+0000000000001375 <crashn>:
+SYSCALL(crashn)
+    1375:	b8 17 00 00 00       	mov    $0x17,%eax
+    137a:	49 89 ca             	mov    %rcx,%r10
+    137d:	0f 05                	syscall
+    137f:	c3                   	ret
+
+0000000000001380 <mmap>:
+SYSCALL(mmap)
+    1380:	b8 18 00 00 00       	mov    $0x18,%eax
+    1385:	49 89 ca             	mov    %rcx,%r10
+    1388:	0f 05                	syscall
+    138a:	c3                   	ret
+
+000000000000138b <munmap>:
+SYSCALL(munmap)
+    138b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1390:	49 89 ca             	mov    %rcx,%r10
+    1393:	0f 05                	syscall
+    1395:	c3                   	ret
+
+0000000000001396 <nice>:
+SYSCALL(nice)
+    1396:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    139b:	49 89 ca             	mov    %rcx,%r10
+    139e:	0f 05                	syscall
+    13a0:	c3                   	ret
+
+00000000000013a1 <_spawn>:
+SYSCALL_(spawn)
+    13a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13a6:	49 89 ca             	mov    %rcx,%r10
+    13a9:	0f 05                	syscall
+    13ab:	c3                   	ret
+
+00000000000013ac <pread>:
+SYSCALL(pread)
+    13ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    13b1:	49 89 ca             	mov    %rcx,%r10
+    13b4:	0f 05                	syscall
+    13b6:	c3                   	ret
+
+00000000000013b7 <pwrite>:
+SYSCALL(pwrite)
+    13b7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13bc:	49 89 ca             	mov    %rcx,%r10
+    13bf:	0f 05                	syscall
+    13c1:	c3                   	ret
+
+00000000000013c2 <readv>:
+SYSCALL(readv)
+    13c2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13c7:	49 89 ca             	mov    %rcx,%r10
+    13ca:	0f 05                	syscall
+    13cc:	c3                   	ret
+
+00000000000013cd <writev>:
+SYSCALL(writev)
+    13cd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13d2:	49 89 ca             	mov    %rcx,%r10
+    13d5:	0f 05                	syscall
+    13d7:	c3                   	ret
+
+00000000000013d8 <sendfile>:
+SYSCALL(sendfile)
+    13d8:	b8 20 00 00 00       	mov    $0x20,%eax
+    13dd:	49 89 ca             	mov    %rcx,%r10
+    13e0:	0f 05                	syscall
+    13e2:	c3                   	ret
+
+00000000000013e3 <splice>:
+SYSCALL(splice)
+    13e3:	b8 21 00 00 00       	mov    $0x21,%eax
+    13e8:	49 89 ca             	mov    %rcx,%r10
+    13eb:	0f 05                	syscall
+    13ed:	c3                   	ret
+
+00000000000013ee <poll>:
+SYSCALL(poll)
+    13ee:	b8 22 00 00 00       	mov    $0x22,%eax
+    13f3:	49 89 ca             	mov    %rcx,%r10
+    13f6:	0f 05                	syscall
+    13f8:	c3                   	ret
+
+00000000000013f9 <fsync>:
+SYSCALL(fsync)
+    13f9:	b8 23 00 00 00       	mov    $0x23,%eax
+    13fe:	49 89 ca             	mov    %rcx,%r10
+    1401:	0f 05                	syscall
+    1403:	c3                   	ret
+
+0000000000001404 <fdatasync>:
+SYSCALL(fdatasync)
+    1404:	b8 24 00 00 00       	mov    $0x24,%eax
+    1409:	49 89 ca             	mov    %rcx,%r10
+    140c:	0f 05                	syscall
+    140e:	c3                   	ret
+
+000000000000140f <lockstat>:
+SYSCALL(lockstat)
+    140f:	b8 25 00 00 00       	mov    $0x25,%eax
+    1414:	49 89 ca             	mov    %rcx,%r10
+    1417:	0f 05                	syscall
+    1419:	c3                   	ret
+
+000000000000141a <syscallstat>:
+SYSCALL(syscallstat)
+    141a:	b8 26 00 00 00       	mov    $0x26,%eax
+    141f:	49 89 ca             	mov    %rcx,%r10
+    1422:	0f 05                	syscall
+    1424:	c3                   	ret
+
+0000000000001425 <trace>:
+SYSCALL(trace)
+    1425:	b8 27 00 00 00       	mov    $0x27,%eax
+    142a:	49 89 ca             	mov    %rcx,%r10
+    142d:	0f 05                	syscall
+    142f:	c3                   	ret
+
+0000000000001430 <profile>:
+SYSCALL(profile)
+    1430:	b8 28 00 00 00       	mov    $0x28,%eax
+    1435:	49 89 ca             	mov    %rcx,%r10
+    1438:	0f 05                	syscall
+    143a:	c3                   	ret
+
+000000000000143b <cycles>:
+SYSCALL(cycles)
+    143b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1440:	49 89 ca             	mov    %rcx,%r10
+    1443:	0f 05                	syscall
+    1445:	c3                   	ret
+
+0000000000001446 <_clock_gettime>:
+SYSCALL_(clock_gettime)
+    1446:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    144b:	49 89 ca             	mov    %rcx,%r10
+    144e:	0f 05                	syscall
+    1450:	c3                   	ret
+
+0000000000001451 <consmode>:
+SYSCALL(consmode)
+    1451:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1456:	49 89 ca             	mov    %rcx,%r10
+    1459:	0f 05                	syscall
+    145b:	c3                   	ret
+
+000000000000145c <clone>:
+SYSCALL(clone)
+    145c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1461:	49 89 ca             	mov    %rcx,%r10
+    1464:	0f 05                	syscall
+    1466:	c3                   	ret
+
+0000000000001467 <join>:
+SYSCALL(join)
+    1467:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    146c:	49 89 ca             	mov    %rcx,%r10
+    146f:	0f 05                	syscall
+    1471:	c3                   	ret
+
+0000000000001472 <futex_wait>:
+SYSCALL(futex_wait)
+    1472:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1477:	49 89 ca             	mov    %rcx,%r10
+    147a:	0f 05                	syscall
+    147c:	c3                   	ret
+
+000000000000147d <futex_wake>:
+SYSCALL(futex_wake)
+    147d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1482:	49 89 ca             	mov    %rcx,%r10
+    1485:	0f 05                	syscall
+    1487:	c3                   	ret
+
+0000000000001488 <shmget>:
+SYSCALL(shmget)
+    1488:	b8 30 00 00 00       	mov    $0x30,%eax
+    148d:	49 89 ca             	mov    %rcx,%r10
+    1490:	0f 05                	syscall
+    1492:	c3                   	ret
+
+0000000000001493 <shmat>:
+SYSCALL(shmat)
+    1493:	b8 31 00 00 00       	mov    $0x31,%eax
+    1498:	49 89 ca             	mov    %rcx,%r10
+    149b:	0f 05                	syscall
+    149d:	c3                   	ret
+
+000000000000149e <shmdt>:
+SYSCALL(shmdt)
+    149e:	b8 32 00 00 00       	mov    $0x32,%eax
+    14a3:	49 89 ca             	mov    %rcx,%r10
+    14a6:	0f 05                	syscall
+    14a8:	c3                   	ret
+
+00000000000014a9 <ring_setup>:
+SYSCALL(ring_setup)
+    14a9:	b8 33 00 00 00       	mov    $0x33,%eax
+    14ae:	49 89 ca             	mov    %rcx,%r10
+    14b1:	0f 05                	syscall
+    14b3:	c3                   	ret
+
+00000000000014b4 <ring_enter>:
+SYSCALL(ring_enter)
+    14b4:	b8 34 00 00 00       	mov    $0x34,%eax
+    14b9:	49 89 ca             	mov    %rcx,%r10
+    14bc:	0f 05                	syscall
+    14be:	c3                   	ret
+
+00000000000014bf <getdents>:
+SYSCALL(getdents)
+    14bf:	b8 35 00 00 00       	mov    $0x35,%eax
+    14c4:	49 89 ca             	mov    %rcx,%r10
+    14c7:	0f 05                	syscall
+    14c9:	c3                   	ret
+
+00000000000014ca <fstatat>:
+SYSCALL(fstatat)
+    14ca:	b8 36 00 00 00       	mov    $0x36,%eax
+    14cf:	49 89 ca             	mov    %rcx,%r10
+    14d2:	0f 05                	syscall
+    14d4:	c3                   	ret
+
+00000000000014d5 <clone_file>:
+SYSCALL(clone_file)
+    14d5:	b8 37 00 00 00       	mov    $0x37,%eax
+    14da:	49 89 ca             	mov    %rcx,%r10
+    14dd:	0f 05                	syscall
+    14df:	c3                   	ret
+
+00000000000014e0 <fpunch>:
+SYSCALL(fpunch)
+    14e0:	b8 38 00 00 00       	mov    $0x38,%eax
+    14e5:	49 89 ca             	mov    %rcx,%r10
+    14e8:	0f 05                	syscall
+    14ea:	c3                   	ret
+
+00000000000014eb <defrag>:
+SYSCALL(defrag)
+    14eb:	b8 39 00 00 00       	mov    $0x39,%eax
+    14f0:	49 89 ca             	mov    %rcx,%r10
+    14f3:	0f 05                	syscall
+    14f5:	c3                   	ret
+
+00000000000014f6 <morecore>:
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+    14f6:	55                   	push   %rbp
+    14f7:	48 89 e5             	mov    %rsp,%rbp
+    14fa:	48 83 ec 20          	sub    $0x20,%rsp
+    14fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+    1502:	bf 00 00 00 00       	mov    $0x0,%edi
+    1507:	e8 3d fe ff ff       	call   1349 <sbrk>
+    150c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+    1510:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1514:	48 f7 d8             	neg    %rax
+    1517:	25 ff 0f 00 00       	and    $0xfff,%eax
+    151c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    1520:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    1524:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1528:	48 01 c2             	add    %rax,%rdx
+    152b:	b8 00 00 00 80       	mov    $0x80000000,%eax
+    1530:	48 39 c2             	cmp    %rax,%rdx
+    1533:	73 1e                	jae    1553 <morecore+0x5d>
+    1535:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1539:	89 c2                	mov    %eax,%edx
+    153b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    153f:	01 d0                	add    %edx,%eax
+    1541:	89 c7                	mov    %eax,%edi
+    1543:	e8 01 fe ff ff       	call   1349 <sbrk>
+    1548:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    154c:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1551:	75 07                	jne    155a <morecore+0x64>
+    return 0;
+    1553:	b8 00 00 00 00       	mov    $0x0,%eax
+    1558:	eb 27                	jmp    1581 <morecore+0x8b>
+  stats.heap += n + pad;
+    155a:	48 8b 05 0f 1c 00 00 	mov    0x1c0f(%rip),%rax        # 3170 <stats+0x50>
+    1561:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+    1565:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1569:	48 01 ca             	add    %rcx,%rdx
+    156c:	48 01 d0             	add    %rdx,%rax
+    156f:	48 89 05 fa 1b 00 00 	mov    %rax,0x1bfa(%rip)        # 3170 <stats+0x50>
+  return p + pad;
+    1576:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+    157a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    157e:	48 01 d0             	add    %rdx,%rax
+}
+    1581:	c9                   	leave
+    1582:	c3                   	ret
+
+0000000000001583 <pagefree>:
+
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+    1583:	55                   	push   %rbp
+    1584:	48 89 e5             	mov    %rsp,%rbp
+    1587:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    158b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+    158f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1596:	00 
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    1597:	48 8d 05 62 1b 00 00 	lea    0x1b62(%rip),%rax        # 3100 <runs>
+    159e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15a2:	eb 1a                	jmp    15be <pagefree+0x3b>
+    prev = *rp;
+    15a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15a8:	48 8b 00             	mov    (%rax),%rax
+    15ab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    15af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15b3:	48 8b 00             	mov    (%rax),%rax
+    15b6:	48 83 c0 08          	add    $0x8,%rax
+    15ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15c2:	48 8b 00             	mov    (%rax),%rax
+    15c5:	48 85 c0             	test   %rax,%rax
+    15c8:	74 0d                	je     15d7 <pagefree+0x54>
+    15ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ce:	48 8b 00             	mov    (%rax),%rax
+    15d1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+    15d5:	72 cd                	jb     15a4 <pagefree+0x21>
+  r = (struct run *)p;
+    15d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    15db:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  r->size = n;
+    15df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15e3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+    15e7:	48 89 10             	mov    %rdx,(%rax)
+  r->next = *rp;
+    15ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ee:	48 8b 10             	mov    (%rax),%rdx
+    15f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15f5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  if (r->next && p + n == (char *)r->next) {
+    15f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15fd:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1601:	48 85 c0             	test   %rax,%rax
+    1604:	74 48                	je     164e <pagefree+0xcb>
+    1606:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+    160a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    160e:	48 01 c2             	add    %rax,%rdx
+    1611:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1615:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1619:	48 39 c2             	cmp    %rax,%rdx
+    161c:	75 30                	jne    164e <pagefree+0xcb>
+    r->size += r->next->size;
+    161e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1622:	48 8b 10             	mov    (%rax),%rdx
+    1625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1629:	48 8b 40 08          	mov    0x8(%rax),%rax
+    162d:	48 8b 00             	mov    (%rax),%rax
+    1630:	48 01 c2             	add    %rax,%rdx
+    1633:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1637:	48 89 10             	mov    %rdx,(%rax)
+    r->next = r->next->next;
+    163a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    163e:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1642:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1646:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    164a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    164e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1653:	74 46                	je     169b <pagefree+0x118>
+    1655:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1659:	48 8b 10             	mov    (%rax),%rdx
+    165c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1660:	48 01 d0             	add    %rdx,%rax
+    1663:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+    1667:	75 32                	jne    169b <pagefree+0x118>
+    prev->size += r->size;
+    1669:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    166d:	48 8b 10             	mov    (%rax),%rdx
+    1670:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1674:	48 8b 00             	mov    (%rax),%rax
+    1677:	48 01 c2             	add    %rax,%rdx
+    167a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    167e:	48 89 10             	mov    %rdx,(%rax)
+    prev->next = r->next;
+    1681:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1685:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    1689:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    168d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    r = prev;
+    1691:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1695:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1699:	eb 0c                	jmp    16a7 <pagefree+0x124>
+  } else {
+    *rp = r;
+    169b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    169f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    16a3:	48 89 10             	mov    %rdx,(%rax)
+  }
+}
+    16a6:	90                   	nop
+    16a7:	90                   	nop
+    16a8:	5d                   	pop    %rbp
+    16a9:	c3                   	ret
+
+00000000000016aa <pagealloc>:
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+    16aa:	55                   	push   %rbp
+    16ab:	48 89 e5             	mov    %rsp,%rbp
+    16ae:	48 83 ec 40          	sub    $0x40,%rsp
+    16b2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct run *r, **rp;
+  uint64_t m;
+  char *p;
+
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    16b6:	48 8d 05 43 1a 00 00 	lea    0x1a43(%rip),%rax        # 3100 <runs>
+    16bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16c1:	eb 66                	jmp    1729 <pagealloc+0x7f>
+    if (r->size == n) {
+    16c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c7:	48 8b 00             	mov    (%rax),%rax
+    16ca:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    16ce:	75 18                	jne    16e8 <pagealloc+0x3e>
+      *rp = r->next;
+    16d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+    16d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16dc:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r;
+    16df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e3:	e9 ca 00 00 00       	jmp    17b2 <pagealloc+0x108>
+    }
+    if (r->size > n) {
+    16e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ec:	48 8b 00             	mov    (%rax),%rax
+    16ef:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    16f3:	73 28                	jae    171d <pagealloc+0x73>
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+    16f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f9:	48 8b 00             	mov    (%rax),%rax
+    16fc:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    1700:	48 89 c2             	mov    %rax,%rdx
+    1703:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1707:	48 89 10             	mov    %rdx,(%rax)
+      return (char *)r + r->size;
+    170a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    170e:	48 8b 10             	mov    (%rax),%rdx
+    1711:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1715:	48 01 d0             	add    %rdx,%rax
+    1718:	e9 95 00 00 00       	jmp    17b2 <pagealloc+0x108>
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    171d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1721:	48 83 c0 08          	add    $0x8,%rax
+    1725:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    172d:	48 8b 00             	mov    (%rax),%rax
+    1730:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1734:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1739:	75 88                	jne    16c3 <pagealloc+0x19>
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+    173b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    173f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    1743:	48 c7 45 e0 00 00 01 	movq   $0x10000,-0x20(%rbp)
+    174a:	00 
+    174b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+    174f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1753:	48 39 c2             	cmp    %rax,%rdx
+    1756:	48 0f 43 c2          	cmovae %rdx,%rax
+    175a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if ((p = morecore(m)) == 0)
+    175e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1762:	48 89 c7             	mov    %rax,%rdi
+    1765:	e8 8c fd ff ff       	call   14f6 <morecore>
+    176a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    176e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+    1773:	75 07                	jne    177c <pagealloc+0xd2>
+    return 0;
+    1775:	b8 00 00 00 00       	mov    $0x0,%eax
+    177a:	eb 36                	jmp    17b2 <pagealloc+0x108>
+  if (m > n)
+    177c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    1780:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+    1784:	73 1a                	jae    17a0 <pagealloc+0xf6>
+    pagefree(p, m - n);
+    1786:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    178a:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    178e:	48 89 c2             	mov    %rax,%rdx
+    1791:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    1795:	48 89 d6             	mov    %rdx,%rsi
+    1798:	48 89 c7             	mov    %rax,%rdi
+    179b:	e8 e3 fd ff ff       	call   1583 <pagefree>
+  return p + m - n;
+    17a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+    17a4:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+    17a8:	48 89 c2             	mov    %rax,%rdx
+    17ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+    17af:	48 01 d0             	add    %rdx,%rax
+}
+    17b2:	c9                   	leave
+    17b3:	c3                   	ret
+
+00000000000017b4 <refill>:
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+    17b4:	55                   	push   %rbp
+    17b5:	48 89 e5             	mov    %rsp,%rbp
+    17b8:	48 83 ec 30          	sub    $0x30,%rsp
+    17bc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    17bf:	bf 00 10 00 00       	mov    $0x1000,%edi
+    17c4:	e8 e1 fe ff ff       	call   16aa <pagealloc>
+    17c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17cd:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17d2:	75 0a                	jne    17de <refill+0x2a>
+    return -1;
+    17d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    17d9:	e9 da 00 00 00       	jmp    18b8 <refill+0x104>
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    17de:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+    17e5:	00 
+    17e6:	e9 ba 00 00 00       	jmp    18a5 <refill+0xf1>
+    b = (struct block *)(p + off);
+    17eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    17ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17f3:	48 01 d0             	add    %rdx,%rax
+    17f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    b->h.size = CLASSSIZE(c);
+    17fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    17fd:	ba 20 00 00 00       	mov    $0x20,%edx
+    1802:	89 c1                	mov    %eax,%ecx
+    1804:	48 d3 e2             	shl    %cl,%rdx
+    1807:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    180b:	48 89 10             	mov    %rdx,(%rax)
+    b->h.class = c;
+    180e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1811:	48 63 d0             	movslq %eax,%rdx
+    1814:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1818:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    b->next = freelist[c];
+    181c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    181f:	48 98                	cltq
+    1821:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1828:	00 
+    1829:	48 8d 05 90 18 00 00 	lea    0x1890(%rip),%rax        # 30c0 <freelist>
+    1830:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1834:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1838:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    freelist[c] = b;
+    183c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    183f:	48 98                	cltq
+    1841:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1848:	00 
+    1849:	48 8d 15 70 18 00 00 	lea    0x1870(%rip),%rdx        # 30c0 <freelist>
+    1850:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1854:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+    stats.nfree[c]++;
+    1858:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    185b:	48 98                	cltq
+    185d:	48 83 c0 08          	add    $0x8,%rax
+    1861:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1868:	00 
+    1869:	48 8d 05 b4 18 00 00 	lea    0x18b4(%rip),%rax        # 3124 <stats+0x4>
+    1870:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1873:	8d 48 01             	lea    0x1(%rax),%ecx
+    1876:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1879:	48 98                	cltq
+    187b:	48 83 c0 08          	add    $0x8,%rax
+    187f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1886:	00 
+    1887:	48 8d 05 96 18 00 00 	lea    0x1896(%rip),%rax        # 3124 <stats+0x4>
+    188e:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    1891:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1894:	ba 20 00 00 00       	mov    $0x20,%edx
+    1899:	89 c1                	mov    %eax,%ecx
+    189b:	48 d3 e2             	shl    %cl,%rdx
+    189e:	48 89 d0             	mov    %rdx,%rax
+    18a1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    18a5:	48 81 7d f8 ff 0f 00 	cmpq   $0xfff,-0x8(%rbp)
+    18ac:	00 
+    18ad:	0f 86 38 ff ff ff    	jbe    17eb <refill+0x37>
+  }
+  return 0;
+    18b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    18b8:	c9                   	leave
+    18b9:	c3                   	ret
+
+00000000000018ba <malloc>:
+
+void *malloc(uint nbytes) {
+    18ba:	55                   	push   %rbp
+    18bb:	48 89 e5             	mov    %rsp,%rbp
+    18be:	48 83 ec 30          	sub    $0x30,%rsp
+    18c2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
+
+  n = (uint64_t)nbytes + sizeof(struct header);
+    18c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18c8:	48 83 c0 10          	add    $0x10,%rax
+    18cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    18d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    18d7:	eb 04                	jmp    18dd <malloc+0x23>
+    18d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    18dd:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+    18e1:	7f 16                	jg     18f9 <malloc+0x3f>
+    18e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    18e6:	ba 20 00 00 00       	mov    $0x20,%edx
+    18eb:	89 c1                	mov    %eax,%ecx
+    18ed:	48 d3 e2             	shl    %cl,%rdx
+    18f0:	48 89 d0             	mov    %rdx,%rax
+    18f3:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+    18f7:	72 e0                	jb     18d9 <malloc+0x1f>
+    ;
+
+  if (c == NCLASS) {
+    18f9:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+    18fd:	75 7d                	jne    197c <malloc+0xc2>
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    18ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1903:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+    1909:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+    190f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((h = (struct header *)pagealloc(n)) == 0)
+    1913:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1917:	48 89 c7             	mov    %rax,%rdi
+    191a:	e8 8b fd ff ff       	call   16aa <pagealloc>
+    191f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1923:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+    1928:	75 0a                	jne    1934 <malloc+0x7a>
+      return 0;
+    192a:	b8 00 00 00 00       	mov    $0x0,%eax
+    192f:	e9 2c 01 00 00       	jmp    1a60 <malloc+0x1a6>
+    h->size = n;
+    1934:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1938:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    193c:	48 89 10             	mov    %rdx,(%rax)
+    h->class = LARGE;
+    193f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1943:	48 c7 40 08 08 00 00 	movq   $0x8,0x8(%rax)
+    194a:	00 
+    stats.inuse[LARGE]++;
+    194b:	8b 05 ef 17 00 00    	mov    0x17ef(%rip),%eax        # 3140 <stats+0x20>
+    1951:	83 c0 01             	add    $0x1,%eax
+    1954:	89 05 e6 17 00 00    	mov    %eax,0x17e6(%rip)        # 3140 <stats+0x20>
+    stats.large += n;
+    195a:	48 8b 15 07 18 00 00 	mov    0x1807(%rip),%rdx        # 3168 <stats+0x48>
+    1961:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1965:	48 01 d0             	add    %rdx,%rax
+    1968:	48 89 05 f9 17 00 00 	mov    %rax,0x17f9(%rip)        # 3168 <stats+0x48>
+    return h + 1;
+    196f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1973:	48 83 c0 10          	add    $0x10,%rax
+    1977:	e9 e4 00 00 00       	jmp    1a60 <malloc+0x1a6>
+  }
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    197c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    197f:	48 98                	cltq
+    1981:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1988:	00 
+    1989:	48 8d 05 30 17 00 00 	lea    0x1730(%rip),%rax        # 30c0 <freelist>
+    1990:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    1994:	48 85 c0             	test   %rax,%rax
+    1997:	75 18                	jne    19b1 <malloc+0xf7>
+    1999:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    199c:	89 c7                	mov    %eax,%edi
+    199e:	e8 11 fe ff ff       	call   17b4 <refill>
+    19a3:	85 c0                	test   %eax,%eax
+    19a5:	79 0a                	jns    19b1 <malloc+0xf7>
+    return 0;
+    19a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    19ac:	e9 af 00 00 00       	jmp    1a60 <malloc+0x1a6>
+  b = freelist[c];
+    19b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19b4:	48 98                	cltq
+    19b6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    19bd:	00 
+    19be:	48 8d 05 fb 16 00 00 	lea    0x16fb(%rip),%rax        # 30c0 <freelist>
+    19c5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+    19c9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  freelist[c] = b->next;
+    19cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19d1:	48 8b 40 10          	mov    0x10(%rax),%rax
+    19d5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    19d8:	48 63 d2             	movslq %edx,%rdx
+    19db:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    19e2:	00 
+    19e3:	48 8d 15 d6 16 00 00 	lea    0x16d6(%rip),%rdx        # 30c0 <freelist>
+    19ea:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.nfree[c]--;
+    19ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    19f1:	48 98                	cltq
+    19f3:	48 83 c0 08          	add    $0x8,%rax
+    19f7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    19fe:	00 
+    19ff:	48 8d 05 1e 17 00 00 	lea    0x171e(%rip),%rax        # 3124 <stats+0x4>
+    1a06:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a09:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1a0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a0f:	48 98                	cltq
+    1a11:	48 83 c0 08          	add    $0x8,%rax
+    1a15:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a1c:	00 
+    1a1d:	48 8d 05 00 17 00 00 	lea    0x1700(%rip),%rax        # 3124 <stats+0x4>
+    1a24:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.inuse[c]++;
+    1a27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a2a:	48 98                	cltq
+    1a2c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a33:	00 
+    1a34:	48 8d 05 e5 16 00 00 	lea    0x16e5(%rip),%rax        # 3120 <stats>
+    1a3b:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1a3e:	8d 48 01             	lea    0x1(%rax),%ecx
+    1a41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a44:	48 98                	cltq
+    1a46:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1a4d:	00 
+    1a4e:	48 8d 05 cb 16 00 00 	lea    0x16cb(%rip),%rax        # 3120 <stats>
+    1a55:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  return &b->h + 1;
+    1a58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a5c:	48 83 c0 10          	add    $0x10,%rax
+}
+    1a60:	c9                   	leave
+    1a61:	c3                   	ret
+
+0000000000001a62 <free>:
+
+void free(void *ap) {
+    1a62:	55                   	push   %rbp
+    1a63:	48 89 e5             	mov    %rsp,%rbp
+    1a66:	48 83 ec 18          	sub    $0x18,%rsp
+    1a6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    1a6e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+    1a73:	0f 84 03 01 00 00    	je     1b7c <free+0x11a>
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+    1a79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a7d:	48 83 e8 10          	sub    $0x10,%rax
+    1a81:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = b->h.class;
+    1a85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a89:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1a8d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (c == LARGE) {
+    1a91:	48 83 7d f0 08       	cmpq   $0x8,-0x10(%rbp)
+    1a96:	75 42                	jne    1ada <free+0x78>
+    stats.inuse[LARGE]--;
+    1a98:	8b 05 a2 16 00 00    	mov    0x16a2(%rip),%eax        # 3140 <stats+0x20>
+    1a9e:	83 e8 01             	sub    $0x1,%eax
+    1aa1:	89 05 99 16 00 00    	mov    %eax,0x1699(%rip)        # 3140 <stats+0x20>
+    stats.large -= b->h.size;
+    1aa7:	48 8b 15 ba 16 00 00 	mov    0x16ba(%rip),%rdx        # 3168 <stats+0x48>
+    1aae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ab2:	48 8b 00             	mov    (%rax),%rax
+    1ab5:	48 29 c2             	sub    %rax,%rdx
+    1ab8:	48 89 15 a9 16 00 00 	mov    %rdx,0x16a9(%rip)        # 3168 <stats+0x48>
+    pagefree((char *)b, b->h.size);
+    1abf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ac3:	48 8b 10             	mov    (%rax),%rdx
+    1ac6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aca:	48 89 d6             	mov    %rdx,%rsi
+    1acd:	48 89 c7             	mov    %rax,%rdi
+    1ad0:	e8 ae fa ff ff       	call   1583 <pagefree>
+    return;
+    1ad5:	e9 a3 00 00 00       	jmp    1b7d <free+0x11b>
+  }
+  b->next = freelist[c];
+    1ada:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ade:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1ae5:	00 
+    1ae6:	48 8d 05 d3 15 00 00 	lea    0x15d3(%rip),%rax        # 30c0 <freelist>
+    1aed:	48 8b 14 02          	mov    (%rdx,%rax,1),%rdx
+    1af1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1af5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  freelist[c] = b;
+    1af9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1afd:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+    1b04:	00 
+    1b05:	48 8d 15 b4 15 00 00 	lea    0x15b4(%rip),%rdx        # 30c0 <freelist>
+    1b0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b10:	48 89 04 11          	mov    %rax,(%rcx,%rdx,1)
+  stats.inuse[c]--;
+    1b14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b18:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b1f:	00 
+    1b20:	48 8d 05 f9 15 00 00 	lea    0x15f9(%rip),%rax        # 3120 <stats>
+    1b27:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b2a:	8d 48 ff             	lea    -0x1(%rax),%ecx
+    1b2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b31:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b38:	00 
+    1b39:	48 8d 05 e0 15 00 00 	lea    0x15e0(%rip),%rax        # 3120 <stats>
+    1b40:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+  stats.nfree[c]++;
+    1b43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b47:	48 83 c0 08          	add    $0x8,%rax
+    1b4b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b52:	00 
+    1b53:	48 8d 05 ca 15 00 00 	lea    0x15ca(%rip),%rax        # 3124 <stats+0x4>
+    1b5a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+    1b5d:	8d 48 01             	lea    0x1(%rax),%ecx
+    1b60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b64:	48 83 c0 08          	add    $0x8,%rax
+    1b68:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1b6f:	00 
+    1b70:	48 8d 05 ad 15 00 00 	lea    0x15ad(%rip),%rax        # 3124 <stats+0x4>
+    1b77:	89 0c 02             	mov    %ecx,(%rdx,%rax,1)
+    1b7a:	eb 01                	jmp    1b7d <free+0x11b>
+    return;
+    1b7c:	90                   	nop
+}
+    1b7d:	c9                   	leave
+    1b7e:	c3                   	ret
+
+0000000000001b7f <mallocstats>:
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+    1b7f:	55                   	push   %rbp
+    1b80:	48 89 e5             	mov    %rsp,%rbp
+    1b83:	48 83 ec 30          	sub    $0x30,%rsp
+    1b87:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+    1b8a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b8d:	48 8d 15 64 02 00 00 	lea    0x264(%rip),%rdx        # 1df8 <benchreport+0x151>
+    1b94:	48 89 d6             	mov    %rdx,%rsi
+    1b97:	89 c7                	mov    %eax,%edi
+    1b99:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b9e:	e8 37 e6 ff ff       	call   1da <printf>
+  for (c = 0; c < NCLASS; c++)
+    1ba3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    1baa:	eb 67                	jmp    1c13 <mallocstats+0x94>
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+    1bac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1baf:	48 98                	cltq
+    1bb1:	48 83 c0 08          	add    $0x8,%rax
+    1bb5:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bbc:	00 
+    1bbd:	48 8d 05 60 15 00 00 	lea    0x1560(%rip),%rax        # 3124 <stats+0x4>
+    1bc4:	8b 3c 02             	mov    (%rdx,%rax,1),%edi
+    1bc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1bca:	48 98                	cltq
+    1bcc:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+    1bd3:	00 
+    1bd4:	48 8d 05 45 15 00 00 	lea    0x1545(%rip),%rax        # 3120 <stats>
+    1bdb:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+    1bde:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1be1:	ba 20 00 00 00       	mov    $0x20,%edx
+    1be6:	89 c1                	mov    %eax,%ecx
+    1be8:	48 d3 e2             	shl    %cl,%rdx
+    1beb:	48 89 d0             	mov    %rdx,%rax
+    1bee:	89 c1                	mov    %eax,%ecx
+    1bf0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1bf3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1bf6:	41 89 f9             	mov    %edi,%r9d
+    1bf9:	41 89 f0             	mov    %esi,%r8d
+    1bfc:	48 8d 35 0c 02 00 00 	lea    0x20c(%rip),%rsi        # 1e0f <benchreport+0x168>
+    1c03:	89 c7                	mov    %eax,%edi
+    1c05:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c0a:	e8 cb e5 ff ff       	call   1da <printf>
+  for (c = 0; c < NCLASS; c++)
+    1c0f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+    1c13:	83 7d ec 07          	cmpl   $0x7,-0x14(%rbp)
+    1c17:	7e 93                	jle    1bac <mallocstats+0x2d>
+           stats.nfree[c]);
+  nfree = 0;
+    1c19:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+    1c20:	00 
+  for (r = runs; r; r = r->next)
+    1c21:	48 8b 05 d8 14 00 00 	mov    0x14d8(%rip),%rax        # 3100 <runs>
+    1c28:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c2c:	eb 17                	jmp    1c45 <mallocstats+0xc6>
+    nfree += r->size;
+    1c2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c32:	48 8b 00             	mov    (%rax),%rax
+    1c35:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  for (r = runs; r; r = r->next)
+    1c39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+    1c41:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1c45:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1c4a:	75 e2                	jne    1c2e <mallocstats+0xaf>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+    1c4c:	48 8b 05 1d 15 00 00 	mov    0x151d(%rip),%rax        # 3170 <stats+0x50>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1c53:	89 c7                	mov    %eax,%edi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1c55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c59:	48 c1 e8 0c          	shr    $0xc,%rax
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1c5d:	89 c6                	mov    %eax,%esi
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+    1c5f:	48 8b 05 02 15 00 00 	mov    0x1502(%rip),%rax        # 3168 <stats+0x48>
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+    1c66:	89 c1                	mov    %eax,%ecx
+    1c68:	8b 15 d2 14 00 00    	mov    0x14d2(%rip),%edx        # 3140 <stats+0x20>
+    1c6e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c71:	41 89 f9             	mov    %edi,%r9d
+    1c74:	41 89 f0             	mov    %esi,%r8d
+    1c77:	48 8d 35 a2 01 00 00 	lea    0x1a2(%rip),%rsi        # 1e20 <benchreport+0x179>
+    1c7e:	89 c7                	mov    %eax,%edi
+    1c80:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c85:	e8 50 e5 ff ff       	call   1da <printf>
+}
+    1c8a:	90                   	nop
+    1c8b:	c9                   	leave
+    1c8c:	c3                   	ret
+
+0000000000001c8d <now>:
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+    1c8d:	55                   	push   %rbp
+    1c8e:	48 89 e5             	mov    %rsp,%rbp
+    1c91:	48 83 ec 10          	sub    $0x10,%rsp
+  uint64_t t;
+
+  cycles(&t);
+    1c95:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+    1c99:	48 89 c7             	mov    %rax,%rdi
+    1c9c:	e8 9a f7 ff ff       	call   143b <cycles>
+  return t;
+    1ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1ca5:	c9                   	leave
+    1ca6:	c3                   	ret
+
+0000000000001ca7 <benchreport>:
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+    1ca7:	55                   	push   %rbp
+    1ca8:	48 89 e5             	mov    %rsp,%rbp
+    1cab:	48 83 ec 30          	sub    $0x30,%rsp
+    1caf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cb3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1cb7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    1cba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+    1cbe:	0f 8e 24 01 00 00    	jle    1de8 <benchreport+0x141>
+    return;
+  for (i = 1; i < n; i++) {
+    1cc4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    1ccb:	e9 98 00 00 00       	jmp    1d68 <benchreport+0xc1>
+    x = t[i];
+    1cd0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cd3:	48 98                	cltq
+    1cd5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1cdc:	00 
+    1cdd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1ce1:	48 01 d0             	add    %rdx,%rax
+    1ce4:	48 8b 00             	mov    (%rax),%rax
+    1ce7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1ceb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cee:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1cf1:	eb 33                	jmp    1d26 <benchreport+0x7f>
+      t[j] = t[j - 1];
+    1cf3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1cf6:	48 98                	cltq
+    1cf8:	48 c1 e0 03          	shl    $0x3,%rax
+    1cfc:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d04:	48 01 d0             	add    %rdx,%rax
+    1d07:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    1d0a:	48 63 d2             	movslq %edx,%rdx
+    1d0d:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+    1d14:	00 
+    1d15:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d19:	48 01 ca             	add    %rcx,%rdx
+    1d1c:	48 8b 00             	mov    (%rax),%rax
+    1d1f:	48 89 02             	mov    %rax,(%rdx)
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+    1d22:	83 6d f8 01          	subl   $0x1,-0x8(%rbp)
+    1d26:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1d2a:	7e 1d                	jle    1d49 <benchreport+0xa2>
+    1d2c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d2f:	48 98                	cltq
+    1d31:	48 c1 e0 03          	shl    $0x3,%rax
+    1d35:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d3d:	48 01 d0             	add    %rdx,%rax
+    1d40:	48 8b 00             	mov    (%rax),%rax
+    1d43:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d47:	72 aa                	jb     1cf3 <benchreport+0x4c>
+    t[j] = x;
+    1d49:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1d4c:	48 98                	cltq
+    1d4e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1d55:	00 
+    1d56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d5a:	48 01 c2             	add    %rax,%rdx
+    1d5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d61:	48 89 02             	mov    %rax,(%rdx)
+  for (i = 1; i < n; i++) {
+    1d64:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1d68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d6b:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+    1d6e:	0f 8c 5c ff ff ff    	jl     1cd0 <benchreport+0x29>
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+    1d74:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d77:	48 98                	cltq
+    1d79:	48 c1 e0 03          	shl    $0x3,%rax
+    1d7d:	48 8d 50 f8          	lea    -0x8(%rax),%rdx
+    1d81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1d85:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1d88:	48 8b 08             	mov    (%rax),%rcx
+         t[0], t[n / 2], t[n - 1]);
+    1d8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1d8e:	89 c2                	mov    %eax,%edx
+    1d90:	c1 ea 1f             	shr    $0x1f,%edx
+    1d93:	01 d0                	add    %edx,%eax
+    1d95:	d1 f8                	sar    %eax
+    1d97:	48 98                	cltq
+    1d99:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+    1da0:	00 
+    1da1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1da5:	48 01 d0             	add    %rdx,%rax
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+    1da8:	48 8b 38             	mov    (%rax),%rdi
+    1dab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1daf:	48 8b 30             	mov    (%rax),%rsi
+    1db2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+    1db5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1db9:	48 83 ec 08          	sub    $0x8,%rsp
+    1dbd:	51                   	push   %rcx
+    1dbe:	49 89 f9             	mov    %rdi,%r9
+    1dc1:	49 89 f0             	mov    %rsi,%r8
+    1dc4:	89 d1                	mov    %edx,%ecx
+    1dc6:	48 89 c2             	mov    %rax,%rdx
+    1dc9:	48 8d 05 90 00 00 00 	lea    0x90(%rip),%rax        # 1e60 <benchreport+0x1b9>
+    1dd0:	48 89 c6             	mov    %rax,%rsi
+    1dd3:	bf 01 00 00 00       	mov    $0x1,%edi
+    1dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ddd:	e8 f8 e3 ff ff       	call   1da <printf>
+    1de2:	48 83 c4 10          	add    $0x10,%rsp
+    1de6:	eb 01                	jmp    1de9 <benchreport+0x142>
+    return;
+    1de8:	90                   	nop
+}
+    1de9:	c9                   	leave
+    1dea:	c3                   	ret
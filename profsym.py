@@ -0,0 +1,81 @@
+# Symbolize the output of user/prof, captured from the console, e.g.
+#   make xk-qemu | tee console.log     (then run "prof cmd" in xk)
+#   python3 profsym.py console.log
+# Prints a flat profile by function and the most frequent kernel call
+# chains, looking up kernel addresses in out/xk.asm and user addresses
+# in out/user/_<name>.asm.
+
+import bisect
+import os
+import re
+import sys
+from collections import Counter
+
+O = "out"
+sample_re = re.compile(r"^(\d+) (\S+) ([ku]) ([0-9a-f]+)((?: [0-9a-f]+)*)\s*$")
+symbol_re = re.compile(r"^([0-9a-f]+) <([^>]+)>:")
+
+tables = {}
+
+def symbols(path):
+    if path not in tables:
+        addrs, names = [], []
+        if os.path.exists(path):
+            for line in open(path, errors="replace"):
+                m = symbol_re.match(line)
+                if m:
+                    addrs.append(int(m.group(1), 16))
+                    names.append(m.group(2))
+        pairs = sorted(zip(addrs, names))
+        tables[path] = ([a for a, _ in pairs], [n for _, n in pairs])
+    return tables[path]
+
+def lookup(path, addr):
+    addrs, names = symbols(path)
+    i = bisect.bisect_right(addrs, addr) - 1
+    if i < 0:
+        return "0x%x" % addr
+    return names[i]
+
+def main():
+    if len(sys.argv) != 2:
+        print("usage: profsym.py console.log")
+        sys.exit(1)
+
+    kernel = os.path.join(O, "xk.asm")
+    flat = Counter()
+    chains = Counter()
+    total = 0
+    for line in open(sys.argv[1], errors="replace"):
+        m = sample_re.match(line.strip())
+        if not m:
+            continue
+        n = int(m.group(1))
+        name, where, rip = m.group(2), m.group(3), int(m.group(4), 16)
+        pcs = [int(x, 16) for x in m.group(5).split()]
+        if where == "k":
+            path = kernel
+        else:
+            path = os.path.join(O, "user", "_" + name + ".asm")
+        fn = lookup(path, rip)
+        flat[(name, where, fn)] += n
+        if where == "k":
+            chain = [fn] + [lookup(kernel, pc) for pc in pcs]
+            chains[" <- ".join(chain)] += n
+        total += n
+
+    if total == 0:
+        print("no samples found")
+        return
+    print("%8s %6s  %s" % ("samples", "%", "function"))
+    for (name, where, fn), n in flat.most_common():
+        print("%8d %6.2f  %s %s [%s]" % (n, 100.0 * n / total, fn,
+                                        "kernel" if where == "k" else "user",
+                                        name))
+    print()
+    print("kernel call chains")
+    for chain, n in chains.most_common(20):
+        print("%8d  %s" % (n, chain))
+
+if __name__ == "__main__":
+    main()
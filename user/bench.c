@@ -0,0 +1,32 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+// Helpers for the benchmark programs.
+
+// The time stamp counter, from cycles().
+uint64_t now(void) {
+  uint64_t t;
+
+  cycles(&t);
+  return t;
+}
+
+// Print the minimum, median and maximum of n timings in cycles, as
+//   name: n runs, cycles min x median y max z
+// Sorts t.
+void benchreport(char *name, uint64_t *t, int n) {
+  uint64_t x;
+  int i, j;
+
+  if (n <= 0)
+    return;
+  for (i = 1; i < n; i++) {
+    x = t[i];
+    for (j = i; j > 0 && t[j - 1] > x; j--)
+      t[j] = t[j - 1];
+    t[j] = x;
+  }
+  printf(1, "%s: %d runs, cycles min %ld median %ld max %ld\n", name, n,
+         t[0], t[n / 2], t[n - 1]);
+}
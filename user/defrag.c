@@ -0,0 +1,27 @@
+#include <cdefs.h>
+#include <fcntl.h>
+#include <stat.h>
+#include <user.h>
+
+int main(int argc, char *argv[]) {
+  int i, fd, n;
+
+  if (argc < 2) {
+    printf(2, "Usage: defrag files...\n");
+    exit();
+  }
+
+  for (i = 1; i < argc; i++) {
+    if ((fd = open(argv[i], O_RDWR)) < 0) {
+      printf(2, "defrag: cannot open %s\n", argv[i]);
+      continue;
+    }
+    if ((n = defrag(fd)) < 0)
+      printf(2, "defrag: %s failed\n", argv[i]);
+    else
+      printf(1, "%s: %d extents\n", argv[i], n);
+    close(fd);
+  }
+
+  exit();
+}
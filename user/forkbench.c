@@ -0,0 +1,48 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+// forkbench [n] times, n times each (100 if not given), fork() and
+// wait() for a child that exits at once: with a small process, and
+// again with BIGHEAP bytes of heap touched, whose pages fork() shares
+// copy-on-write.
+
+#define BIGHEAP (1024 * 1024)
+
+static void forkwait(char *name, uint64_t *t, int n) {
+  int i, pid;
+
+  for (i = 0; i < n; i++) {
+    t[i] = now();
+    if ((pid = fork()) == 0)
+      exit();
+    if (pid < 0) {
+      printf(2, "forkbench: fork failed\n");
+      exit();
+    }
+    wait();
+    t[i] = now() - t[i];
+  }
+  benchreport(name, t, n);
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t *t;
+  char *heap;
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 100;
+  if (n <= 0 || (t = malloc(n * sizeof(*t))) == 0) {
+    printf(2, "usage: forkbench [n]\n");
+    exit();
+  }
+  forkwait("fork+wait", t, n);
+
+  if ((heap = sbrk(BIGHEAP)) == (char *)-1) {
+    printf(2, "forkbench: sbrk failed\n");
+    exit();
+  }
+  memset(heap, 1, BIGHEAP);
+  forkwait("fork+wait 1M heap", t, n);
+  exit();
+}
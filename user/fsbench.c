@@ -0,0 +1,279 @@
+#include <cdefs.h>
+#include <fcntl.h>
+#include <fs.h>
+#include <stat.h>
+#include <sysinfo.h>
+#include <user.h>
+
+// fsbench measures file system speed.
+//   fsbench [-s kb] [test...]
+// runs the given tests, or all of them, on files of kb kilobytes
+// (1024 if not given):
+//   seqwrite, seqread    whole file, in 512 byte, 4K and 32K I/Os
+//   randwrite, randread  4K I/Os at random 4K-aligned offsets
+//   create, unlink       NFILES empty files
+//   append, syncappend   64 byte appends, the second fsync()ing each
+//   concurrent           NCHILD children, half writing, half reading
+// Each test prints its ops, ticks, ops/s and KB/s, then how much the
+// disk, log and buffer cache counters moved.  seqwrite's file is
+// left for the tests after it unless all of them ran.
+
+#define HZ 100          // ticks a second: TICKCOUNT at QEMU's 1 GHz bus
+#define MAXIO 32768
+#define NFILES 200
+#define NAPPEND 500
+#define APPENDSIZE 64
+#define NCHILD 4
+
+static char *buf;
+static int filesize;
+static struct sys_info before, after;
+static int t0;
+
+static uint64_t rdtsc(void) {
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+static uint rnd = 1;
+
+static uint random(void) {
+  rnd = rnd * 1103515245 + 12345;
+  return rnd >> 8;
+}
+
+static void start(void) {
+  sysinfo(&before);
+  t0 = uptime();
+}
+
+// Report n operations moving bytes bytes since start().
+static void stop(char *name, int iosize, int n, uint64_t bytes) {
+  int ticks;
+
+  ticks = uptime() - t0;
+  sysinfo(&after);
+  printf(1, "%s", name);
+  if (iosize > 0)
+    printf(1, " %d", iosize);
+  printf(1, ": %d ops %d ticks", n, ticks);
+  if (ticks > 0) {
+    printf(1, " %d ops/s", (int)((uint64_t)n * HZ / ticks));
+    if (bytes > 0)
+      printf(1, " %d KB/s", (int)(bytes * HZ / ticks / 1024));
+  }
+  printf(1, "\n  disk r %ld w %ld req %ld log commits %ld blocks %ld "
+            "bcache hits %d misses %d\n",
+         after.disk_reads - before.disk_reads,
+         after.disk_writes - before.disk_writes,
+         after.disk_requests - before.disk_requests,
+         after.log_commits - before.log_commits,
+         after.log_blocks - before.log_blocks,
+         after.bcache_hits - before.bcache_hits,
+         after.bcache_misses - before.bcache_misses);
+}
+
+static int create(char *path) {
+  int fd;
+
+  unlink(path);
+  if ((fd = open(path, O_CREATE | O_RDWR)) < 0) {
+    printf(2, "fsbench: cannot create %s\n", path);
+    exit();
+  }
+  return fd;
+}
+
+static void seqwrite(void) {
+  int fd, n, sizes[] = {512, 4096, MAXIO};
+
+  for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    fd = create("fsb.seq");
+    start();
+    for (n = 0; n * sizes[i] < filesize; n++)
+      if (write(fd, buf, sizes[i]) != sizes[i]) {
+        printf(2, "fsbench: write failed\n");
+        break;
+      }
+    close(fd);
+    stop("seqwrite", sizes[i], n, (uint64_t)n * sizes[i]);
+  }
+}
+
+static void seqread(void) {
+  int fd, n, r, sizes[] = {512, 4096, MAXIO};
+
+  for (int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    if ((fd = open("fsb.seq", O_RDONLY)) < 0) {
+      printf(2, "fsbench: seqread needs seqwrite's file\n");
+      return;
+    }
+    start();
+    for (n = 0; (r = read(fd, buf, sizes[i])) > 0; n++)
+      ;
+    close(fd);
+    stop("seqread", sizes[i], n, (uint64_t)n * sizes[i]);
+  }
+}
+
+static void randio(int writing) {
+  int fd, n, nblocks;
+
+  if ((fd = open("fsb.seq", O_RDWR)) < 0) {
+    printf(2, "fsbench: random I/O needs seqwrite's file\n");
+    return;
+  }
+  nblocks = filesize / 4096;
+  start();
+  for (n = 0; n < nblocks; n++) {
+    if (writing)
+      pwrite(fd, buf, 4096, random() % nblocks * 4096);
+    else
+      pread(fd, buf, 4096, random() % nblocks * 4096);
+  }
+  close(fd);
+  stop(writing ? "randwrite" : "randread", 4096, n, (uint64_t)n * 4096);
+}
+
+static void randwrite(void) { randio(1); }
+static void randread(void) { randio(0); }
+
+static void name(char *path, int i) {
+  strcpy(path, "fsb.f000");
+  path[5] += i / 100 % 10;
+  path[6] += i / 10 % 10;
+  path[7] += i % 10;
+}
+
+static void creates(void) {
+  char path[16];
+  int i;
+
+  start();
+  for (i = 0; i < NFILES; i++) {
+    name(path, i);
+    close(create(path));
+  }
+  stop("create", 0, NFILES, 0);
+}
+
+static void unlinks(void) {
+  char path[16];
+  int i;
+
+  start();
+  for (i = 0; i < NFILES; i++) {
+    name(path, i);
+    if (unlink(path) < 0) {
+      printf(2, "fsbench: unlink needs create's files\n");
+      return;
+    }
+  }
+  stop("unlink", 0, NFILES, 0);
+}
+
+static void appends(int sync) {
+  uint64_t t, total, worst;
+  int fd, i;
+
+  fd = create("fsb.app");
+  total = worst = 0;
+  start();
+  for (i = 0; i < NAPPEND; i++) {
+    t = rdtsc();
+    write(fd, buf, APPENDSIZE);
+    if (sync)
+      fsync(fd);
+    t = rdtsc() - t;
+    total += t;
+    worst = max(worst, t);
+  }
+  close(fd);
+  stop(sync ? "syncappend" : "append", APPENDSIZE, NAPPEND,
+       NAPPEND * APPENDSIZE);
+  printf(1, "  cycles per append: mean %ld max %ld\n", total / NAPPEND, worst);
+  unlink("fsb.app");
+}
+
+static void append(void) { appends(0); }
+static void syncappend(void) { appends(1); }
+
+// Half the children each write a file of their own, the other half
+// all read seqwrite's file.
+static void concurrent(void) {
+  char path[] = "fsb.c0";
+  int i, fd, n;
+
+  start();
+  for (i = 0; i < NCHILD; i++) {
+    if (fork() != 0)
+      continue;
+    if (i % 2 == 0) {
+      path[5] += i;
+      fd = create(path);
+      for (n = 0; n * MAXIO < filesize; n++)
+        write(fd, buf, MAXIO);
+    } else if ((fd = open("fsb.seq", O_RDONLY)) >= 0) {
+      while (read(fd, buf, MAXIO) > 0)
+        ;
+    }
+    close(fd);
+    exit();
+  }
+  for (i = 0; i < NCHILD; i++)
+    wait();
+  stop("concurrent", MAXIO, NCHILD, (uint64_t)NCHILD * filesize);
+  for (i = 0; i < NCHILD; i += 2) {
+    path[5] = '0' + i;
+    unlink(path);
+  }
+}
+
+static struct {
+  char *name;
+  void (*fn)(void);
+} tests[] = {
+    {"seqwrite", seqwrite},     {"seqread", seqread},
+    {"randwrite", randwrite},   {"randread", randread},
+    {"create", creates},        {"unlink", unlinks},
+    {"append", append},         {"syncappend", syncappend},
+    {"concurrent", concurrent},
+};
+
+#define NTESTS (sizeof(tests) / sizeof(tests[0]))
+
+int main(int argc, char *argv[]) {
+  int i, j;
+
+  filesize = 1024 * 1024;
+  argv++;
+  argc--;
+  if (argc >= 2 && strcmp(argv[0], "-s") == 0) {
+    filesize = atoi(argv[1]) * 1024;
+    argv += 2;
+    argc -= 2;
+  }
+  if ((buf = malloc(MAXIO)) == 0) {
+    printf(2, "fsbench: out of memory\n");
+    exit();
+  }
+  memset(buf, 'f', MAXIO);
+
+  if (argc == 0) {
+    for (i = 0; i < NTESTS; i++)
+      tests[i].fn();
+    unlink("fsb.seq");
+  }
+  for (j = 0; j < argc; j++) {
+    for (i = 0; i < NTESTS && strcmp(argv[j], tests[i].name); i++)
+      ;
+    if (i == NTESTS) {
+      printf(2, "fsbench: no test %s\n", argv[j]);
+      exit();
+    }
+    tests[i].fn();
+  }
+  exit();
+}
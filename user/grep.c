@@ -1,50 +1,134 @@
 // Simple grep.  Only supports ^ . * $ operators.
+// A pattern with none of them is searched for as a string with
+// Boyer-Moore-Horspool, over a whole buffer of lines at once.
+// With -c, only the number of matching lines is printed.
 
 #include <cdefs.h>
 #include <stat.h>
 #include <user.h>
 
-char buf[1024];
+char buf[65536];
 int match(char *, char *);
 
-void grep(char *pattern, int fd) {
-  int n, m;
-  char *p, *q;
+static int countonly;  // -c
+static int literal;    // the pattern has no operators
+static int patlen;
+static int shift[256]; // Horspool's skip for each byte
 
+// Get ready to search for pattern as a string, if it is one.
+static void compile(char *pattern) {
+  int i;
+
+  literal = strchr(pattern, '^') == 0 && strchr(pattern, '.') == 0 &&
+            strchr(pattern, '*') == 0 && strchr(pattern, '$') == 0;
+  patlen = strlen(pattern);
+  for (i = 0; i < 256; i++)
+    shift[i] = patlen;
+  for (i = 0; i + 1 < patlen; i++)
+    shift[(uchar)pattern[i]] = patlen - 1 - i;
+}
+
+// The first occurrence of the literal pattern in the n bytes at s,
+// or 0.
+static char *search(char *pattern, char *s, int n) {
+  char last;
+  int i, j;
+
+  if (patlen == 0)
+    return s;
+  last = pattern[patlen - 1];
+  for (i = 0; i + patlen <= n; i += shift[(uchar)s[i + patlen - 1]]) {
+    if (s[i + patlen - 1] != last)
+      continue;
+    for (j = 0; j < patlen - 1 && s[i + j] == pattern[j]; j++)
+      ;
+    if (j == patlen - 1)
+      return s + i;
+  }
+  return 0;
+}
+
+// Print, or count, the lines of [p, end) that match pattern.  Each
+// line ends in a newline.  Returns the number that matched.
+static int greplines(char *pattern, char *p, char *end) {
+  char *q, *line;
+  int count = 0;
+
+  if (literal) {
+    while (p < end && (q = search(pattern, p, end - p)) != 0) {
+      for (line = q; line > p && line[-1] != '\n'; line--)
+        ;
+      while (*q != '\n')
+        q++;
+      if (!countonly)
+        bwrite(1, line, q + 1 - line);
+      count++;
+      p = q + 1;
+    }
+    return count;
+  }
+
+  for (; p < end; p = q + 1) {
+    // A nul byte hides the rest of the line from strchr()
+    if ((q = strchr(p, '\n')) == 0)
+      break;
+    *q = 0;
+    if (match(pattern, p)) {
+      if (!countonly) {
+        *q = '\n';
+        bwrite(1, p, q + 1 - p);
+      }
+      count++;
+    }
+    *q = '\n';
+  }
+  return count;
+}
+
+// Returns the number of lines of fd that match pattern.
+int grep(char *pattern, int fd) {
+  int n, m, count;
+  char *end;
+
+  count = 0;
   m = 0;
   while ((n = read(fd, buf + m, sizeof(buf) - m - 1)) > 0) {
     m += n;
     buf[m] = '\0';
-    p = buf;
-    while ((q = strchr(p, '\n')) != 0) {
-      *q = 0;
-      if (match(pattern, p)) {
-        *q = '\n';
-        write(1, p, q + 1 - p);
-      }
-      p = q + 1;
-    }
-    if (p == buf)
-      m = 0;
-    if (m > 0) {
-      m -= p - buf;
-      memmove(buf, p, m);
+    // Take the whole lines; the rest waits for the next read
+    for (end = buf + m; end > buf && end[-1] != '\n'; end--)
+      ;
+    count += greplines(pattern, buf, end);
+    if (end == buf && m == sizeof(buf) - 1)
+      m = 0; // a line longer than the buffer is dropped
+    if (end > buf) {
+      m -= end - buf;
+      memmove(buf, end, m);
     }
   }
+  return count;
 }
 
 int main(int argc, char *argv[]) {
-  int fd, i;
+  int fd, i, count;
   char *pattern;
 
+  if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+    countonly = 1;
+    argc--;
+    argv++;
+  }
   if (argc <= 1) {
-    printf(2, "usage: grep pattern [file ...]\n");
+    printf(2, "usage: grep [-c] pattern [file ...]\n");
     exit();
   }
   pattern = argv[1];
+  compile(pattern);
 
   if (argc <= 2) {
-    grep(pattern, 0);
+    count = grep(pattern, 0);
+    if (countonly)
+      printf(1, "%d\n", count);
     exit();
   }
 
@@ -53,7 +137,11 @@ int main(int argc, char *argv[]) {
       printf(1, "grep: cannot open %s\n", argv[i]);
       exit();
     }
-    grep(pattern, fd);
+    count = grep(pattern, fd);
+    if (countonly && argc > 3)
+      printf(1, "%s:%d\n", argv[i], count);
+    else if (countonly)
+      printf(1, "%d\n", count);
     close(fd);
   }
   exit();
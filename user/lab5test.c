@@ -0,0 +1,374 @@
+#include <cdefs.h>
+#include <fcntl.h>
+#include <mman.h>
+#include <mmu.h>
+#include <stat.h>
+#include <user.h>
+
+char buf[8192];
+char buf2[8192];
+int stdout = 1;
+
+#define error(msg, ...)                                                        \
+  do {                                                                         \
+    printf(stdout, "ERROR (line %d): ", __LINE__);                             \
+    printf(stdout, msg, ##__VA_ARGS__);                                        \
+    printf(stdout, "\n");                                                      \
+    exit();                                                                    \
+    while (1) {                                                                \
+    };                                                                         \
+  } while (0)
+
+void mmaptest(void);
+void threadtest(void);
+void mutextest(void);
+void condtest(void);
+void shmtest(void);
+void clonefiletest(void);
+void punchtest(void);
+void gaptest(void);
+
+int main(int argc, char *argv[]) {
+  mmaptest();
+  threadtest();
+  mutextest();
+  condtest();
+  shmtest();
+  clonefiletest();
+  punchtest();
+  gaptest();
+  printf(stdout, "lab5 tests passed!!\n");
+
+  exit();
+  return 0;
+}
+
+// Writes a file and maps it: the mapping holds what was written, and
+// sees later writes both to a page it has touched and to one it has
+// not.
+void mmaptest(void) {
+  int fd, i;
+  char *p;
+
+  printf(stdout, "mmaptest\n");
+  if ((fd = open("mmap.txt", O_CREATE | O_RDWR)) < 0)
+    error("create 'mmap.txt' failed");
+  for (i = 0; i < 2 * PGSIZE; i++)
+    buf[i] = 'a' + i % 26;
+  if (write(fd, buf, 2 * PGSIZE) != 2 * PGSIZE)
+    error("write to 'mmap.txt' failed");
+
+  if ((p = mmap(fd, 0, 2 * PGSIZE, PROT_READ)) == (char *)-1)
+    error("mmap of 'mmap.txt' failed");
+  for (i = 0; i < PGSIZE; i++)
+    if (p[i] != buf[i])
+      error("mapped byte %d was %d, wanted %d", i, p[i], buf[i]);
+
+  if (pwrite(fd, "XYZ", 3, 10) != 3 || pwrite(fd, "XYZ", 3, PGSIZE) != 3)
+    error("pwrite to 'mmap.txt' failed");
+  if (p[10] != 'X' || p[12] != 'Z' || p[13] != buf[13])
+    error("mapping did not see a write to a page it had touched");
+  if (p[PGSIZE] != 'X' || p[PGSIZE + 2] != 'Z' || p[PGSIZE + 3] != buf[PGSIZE + 3])
+    error("mapping did not see a write to a page it had not touched");
+
+  if (munmap(p, 2 * PGSIZE) < 0)
+    error("munmap failed");
+  close(fd);
+  unlink("mmap.txt");
+  printf(stdout, "mmaptest ok\n");
+}
+
+#define NTHREAD 4
+
+char stacks[NTHREAD][PGSIZE] __attribute__((aligned(16)));
+int slots[NTHREAD];
+int threadpipe[2];
+
+// Marks its slot in memory shared with the main thread and writes
+// its number to a pipe the main thread opened.
+static void markslot(void *arg) {
+  int i = (int)(uint64_t)arg;
+  char c = '0' + i;
+
+  slots[i] = i + 1;
+  if (write(threadpipe[1], &c, 1) != 1)
+    error("thread %d could not write to the shared pipe", i);
+  exit();
+}
+
+// Starts threads with clone(), which share memory and open files, and
+// waits for each with join().
+void threadtest(void) {
+  int pids[NTHREAD];
+  int i, j, pid;
+  char c;
+
+  printf(stdout, "threadtest\n");
+  if (pipe(threadpipe) < 0)
+    error("pipe failed");
+  for (i = 0; i < NTHREAD; i++) {
+    slots[i] = 0;
+    if ((pids[i] = clone(markslot, stacks[i] + PGSIZE, (void *)(uint64_t)i)) < 0)
+      error("clone %d failed", i);
+  }
+  for (i = 0; i < NTHREAD; i++) {
+    if ((pid = join()) < 0)
+      error("join %d failed", i);
+    for (j = 0; j < NTHREAD && pids[j] != pid; j++)
+      ;
+    if (j == NTHREAD)
+      error("join returned pid %d, which clone did not", pid);
+    pids[j] = -1;
+  }
+  if (join() != -1)
+    error("join with no threads left did not fail");
+
+  for (i = 0; i < NTHREAD; i++) {
+    if (slots[i] != i + 1)
+      error("thread %d's write to shared memory was not seen", i);
+    if (read(threadpipe[0], &c, 1) != 1 || c < '0' || c >= '0' + NTHREAD)
+      error("threads' writes to the shared pipe were not seen");
+  }
+  close(threadpipe[0]);
+  close(threadpipe[1]);
+  printf(stdout, "threadtest ok\n");
+}
+
+#define NINCR 1000
+#define NITEMS 100
+
+struct mutex countlock;
+int count;
+
+static void addcount(void *arg) {
+  int i;
+
+  for (i = 0; i < NINCR; i++) {
+    mutex_lock(&countlock);
+    count++;
+    mutex_unlock(&countlock);
+  }
+  exit();
+}
+
+// Threads add to a counter under a mutex; none of the increments may
+// be lost.  futex_wait() only sleeps if the word holds the value.
+void mutextest(void) {
+  int i, word;
+
+  printf(stdout, "mutextest\n");
+  word = 1;
+  if (futex_wait(&word, 0) != -1)
+    error("futex_wait on a changed word did not return -1");
+  if (futex_wake(&word, 1) != 0)
+    error("futex_wake with no waiters woke someone");
+
+  count = 0;
+  for (i = 0; i < NTHREAD; i++)
+    if (clone(addcount, stacks[i] + PGSIZE, 0) < 0)
+      error("clone %d failed", i);
+  for (i = 0; i < NTHREAD; i++)
+    if (join() < 0)
+      error("join %d failed", i);
+  if (count != NTHREAD * NINCR)
+    error("count was %d, wanted %d", count, NTHREAD * NINCR);
+  printf(stdout, "mutextest ok\n");
+}
+
+// A one-item mailbox, passed from a producer thread to the main
+// thread
+struct mutex boxlock;
+struct cond boxfull, boxempty;
+int boxhas, boxitem;
+
+static void produce(void *arg) {
+  int i;
+
+  for (i = 1; i <= NITEMS; i++) {
+    mutex_lock(&boxlock);
+    while (boxhas)
+      cond_wait(&boxempty, &boxlock);
+    boxitem = i;
+    boxhas = 1;
+    cond_signal(&boxfull);
+    mutex_unlock(&boxlock);
+  }
+  exit();
+}
+
+// Items pass through the mailbox one at a time, each waiting on a
+// condition variable for the other side, and arrive in order.
+void condtest(void) {
+  int i;
+
+  printf(stdout, "condtest\n");
+  boxhas = 0;
+  if (clone(produce, stacks[0] + PGSIZE, 0) < 0)
+    error("clone failed");
+  for (i = 1; i <= NITEMS; i++) {
+    mutex_lock(&boxlock);
+    while (!boxhas)
+      cond_wait(&boxfull, &boxlock);
+    if (boxitem != i)
+      error("got item %d, wanted %d", boxitem, i);
+    boxhas = 0;
+    cond_signal(&boxempty);
+    mutex_unlock(&boxlock);
+  }
+  if (join() < 0)
+    error("join failed");
+  printf(stdout, "condtest ok\n");
+}
+
+// A segment attached before fork() is shared with the child both
+// ways, and shmget() of a key finds the segment it made before.
+void shmtest(void) {
+  int id, pid;
+  char *p;
+
+  printf(stdout, "shmtest\n");
+  if ((id = shmget(451, PGSIZE)) < 0)
+    error("shmget failed");
+  if (shmget(451, PGSIZE) != id)
+    error("shmget of the same key gave another segment");
+  if ((p = shmat(id)) == (char *)-1)
+    error("shmat failed");
+  strcpy(p, "parent");
+
+  if ((pid = fork()) < 0)
+    error("fork failed");
+  if (pid == 0) {
+    if (strcmp(p, "parent") != 0)
+      error("child saw '%s' in the segment, wanted 'parent'", p);
+    strcpy(p, "child");
+    exit();
+  }
+  wait();
+  if (strcmp(p, "child") != 0)
+    error("parent saw '%s' in the segment, wanted 'child'", p);
+  if (shmdt(p) < 0)
+    error("shmdt failed");
+  printf(stdout, "shmtest ok\n");
+}
+
+// 0 if the n bytes at a and b are the same
+static int bufcmp(char *a, char *b, int n) {
+  while (n-- > 0)
+    if (*a++ != *b++)
+      return 1;
+  return 0;
+}
+
+// A clone reads as its source did, and writing it afterwards leaves
+// the source as it was.
+void clonefiletest(void) {
+  int src, dst, i;
+  struct stat st;
+
+  printf(stdout, "clonefiletest\n");
+  if ((src = open("clonesrc.txt", O_CREATE | O_RDWR)) < 0 ||
+      (dst = open("clonedst.txt", O_CREATE | O_RDWR)) < 0)
+    error("create 'clonesrc.txt' or 'clonedst.txt' failed");
+  for (i = 0; i < sizeof(buf); i++)
+    buf[i] = 'A' + i % 26;
+  if (write(src, buf, sizeof(buf)) != sizeof(buf))
+    error("write to 'clonesrc.txt' failed");
+  if (clone_file(src, dst) < 0)
+    error("clone_file failed");
+
+  if (fstat(dst, &st) < 0 || st.size != sizeof(buf))
+    error("clone's size was not %d", sizeof(buf));
+  if (pread(dst, buf2, sizeof(buf2), 0) != sizeof(buf2) ||
+      bufcmp(buf, buf2, sizeof(buf)) != 0)
+    error("clone did not read as its source");
+
+  if (pwrite(dst, "clone", 5, 100) != 5)
+    error("write to the clone failed");
+  if (pread(src, buf2, sizeof(buf2), 0) != sizeof(buf2) ||
+      bufcmp(buf, buf2, sizeof(buf)) != 0)
+    error("writing the clone changed its source");
+  if (pread(dst, buf2, 5, 100) != 5 || bufcmp(buf2, "clone", 5) != 0)
+    error("clone did not read back its own write");
+
+  close(src);
+  close(dst);
+  unlink("clonesrc.txt");
+  unlink("clonedst.txt");
+  printf(stdout, "clonefiletest ok\n");
+}
+
+// A punched range reads back as zeros, the rest of the file and its
+// size are untouched, and a write into the hole lands.
+void punchtest(void) {
+  int fd, i;
+  struct stat st;
+
+  printf(stdout, "punchtest\n");
+  if ((fd = open("punch.txt", O_CREATE | O_RDWR)) < 0)
+    error("create 'punch.txt' failed");
+  memset(buf, 'p', sizeof(buf));
+  if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+    error("write to 'punch.txt' failed");
+  if (fpunch(fd, 1000, 5000) < 0)
+    error("fpunch failed");
+  if (pwrite(fd, "h", 1, 3000) != 1)
+    error("write into the hole failed");
+
+  if (pread(fd, buf, sizeof(buf), 0) != sizeof(buf))
+    error("read of 'punch.txt' was short");
+  for (i = 0; i < sizeof(buf); i++) {
+    char want = i == 3000 ? 'h' : i >= 1000 && i < 6000 ? 0 : 'p';
+    if (buf[i] != want)
+      error("byte %d was %d, wanted %d", i, buf[i], want);
+  }
+  if (fstat(fd, &st) < 0 || st.size != sizeof(buf))
+    error("fpunch changed the size to %d", st.size);
+
+  close(fd);
+  unlink("punch.txt");
+  printf(stdout, "punchtest ok\n");
+}
+
+// A file that grows by appends is given blocks ahead of its writes,
+// which hold whatever they last held.  A write past the end that
+// leaves a gap over them must still read back zeros in the gap, even
+// when the blocks were just freed by a file full of other data.
+void gaptest(void) {
+  int fd, i, end;
+  struct stat st;
+
+  printf(stdout, "gaptest\n");
+  if ((fd = open("junk.txt", O_CREATE | O_RDWR)) < 0)
+    error("create 'junk.txt' failed");
+  memset(buf, 'j', sizeof(buf));
+  for (i = 0; i < 8; i++)
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf))
+      error("write to 'junk.txt' failed");
+  close(fd);
+  if (unlink("junk.txt") < 0)
+    error("unlink 'junk.txt' failed");
+
+  // The second write appends, and gets blocks past it preallocated
+  if ((fd = open("gap.txt", O_CREATE | O_RDWR)) < 0)
+    error("create 'gap.txt' failed");
+  memset(buf, 'g', sizeof(buf));
+  if (write(fd, buf, 4096) != 4096 || write(fd, buf, 100) != 100)
+    error("write to 'gap.txt' failed");
+  end = 4196 + 3000;
+  if (pwrite(fd, "end", 3, end) != 3)
+    error("write past the end of 'gap.txt' failed");
+
+  if (fstat(fd, &st) < 0 || st.size != end + 3)
+    error("size was %d, wanted %d", st.size, end + 3);
+  if (pread(fd, buf, end + 3, 0) != end + 3)
+    error("read of 'gap.txt' was short");
+  for (i = 0; i < end + 3; i++) {
+    char want = i < 4196 ? 'g' : i < end ? 0 : "end"[i - end];
+    if (buf[i] != want)
+      error("byte %d was %d, wanted %d", i, buf[i], want);
+  }
+
+  close(fd);
+  unlink("gap.txt");
+  printf(stdout, "gaptest ok\n");
+}
@@ -0,0 +1,40 @@
+#include <cdefs.h>
+#include <lockstat.h>
+#include <stat.h>
+#include <user.h>
+
+// Print the kernel's lock counters, most waited-for first.
+// lockstat -r zeroes them after printing.
+
+static char *kinds[] = {[LS_SPIN] = "spin", [LS_SLEEP] = "sleep",
+                        [LS_RWSLEEP] = "rw"};
+
+struct lockstat st[NLOCKCLASS];
+
+int main(int argc, char *argv[]) {
+  struct lockstat t;
+  int n, i, j, reset;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if ((n = lockstat(st, NLOCKCLASS, reset)) < 0) {
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+
+  for (i = 1; i < n; i++) {
+    t = st[i];
+    for (j = i; j > 0 && st[j - 1].wait < t.wait; j--)
+      st[j] = st[j - 1];
+    st[j] = t;
+  }
+
+  printf(1, "name kind acquires contended wait hold maxhold (cycles)\n");
+  for (i = 0; i < n; i++) {
+    if (st[i].acquires == 0)
+      continue;
+    printf(1, "%s %s %ld %ld %ld %ld %ld\n", st[i].name, kinds[st[i].kind],
+           st[i].acquires, st[i].contended, st[i].wait, st[i].hold,
+           st[i].maxhold);
+  }
+  exit();
+}
@@ -0,0 +1,38 @@
+#include <cdefs.h>
+#include <fcntl.h>
+#include <fs.h>
+#include <stat.h>
+#include <user.h>
+
+// logfill n writes n blocks to a file and commits them with fsync(),
+// which leaves them in the log until it next checkpoints, then makes
+// the very next disk write crash the machine.  The next boot has to
+// recover them; crash_safety_test.py --recovery times it.
+
+int main(int argc, char *argv[]) {
+  char buf[BSIZE];
+  int fd, n, i;
+
+  if (argc != 2 || (n = atoi(argv[1])) < 0) {
+    printf(2, "usage: logfill nblocks\n");
+    exit();
+  }
+  unlink("logfill.dat");
+  if ((fd = open("logfill.dat", O_CREATE | O_RDWR)) < 0) {
+    printf(2, "logfill: cannot create logfill.dat\n");
+    exit();
+  }
+  memset(buf, 'l', sizeof(buf));
+  for (i = 0; i < n; i++)
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf)) {
+      printf(2, "logfill: write failed\n");
+      exit();
+    }
+  fsync(fd);
+  printf(1, "logfill: %d blocks committed, crashing\n", n);
+  crashn(0);
+  write(fd, buf, 1);
+  fsync(fd);
+  printf(2, "logfill: did not crash\n");
+  exit();
+}
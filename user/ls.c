@@ -21,9 +21,9 @@ char *fmtname(char *path) {
 }
 
 void ls(char *path) {
-  char buf[512], *p;
-  int fd;
-  struct dirent de;
+  char name[DIRSIZ + 1];
+  int fd, n, i;
+  struct dirent des[64];
   struct stat st;
 
   if ((fd = open(path, 0)) < 0) {
@@ -43,23 +43,18 @@ void ls(char *path) {
     break;
 
   case T_DIR:
-    if (strlen(path) + 1 + DIRSIZ + 1 > sizeof buf) {
-      printf(1, "ls: path too long\n");
-      break;
-    }
-    strcpy(buf, path);
-    p = buf + strlen(buf);
-    *p++ = '/';
-    while (read(fd, &de, sizeof(de)) == sizeof(de)) {
-      if (de.inum == 0)
-        continue;
-      memmove(p, de.name, DIRSIZ);
-      p[DIRSIZ] = 0;
-      if (stat(buf, &st) < 0) {
-        printf(1, "ls: cannot stat %s\n", buf);
-        continue;
+    // A batch of entries per call, each looked up in the directory
+    // without opening it
+    while ((n = getdents(fd, des, sizeof(des))) > 0) {
+      for (i = 0; i < n / sizeof(des[0]); i++) {
+        memmove(name, des[i].name, DIRSIZ);
+        name[DIRSIZ] = 0;
+        if (fstatat(fd, name, &st) < 0) {
+          printf(1, "ls: cannot stat %s\n", name);
+          continue;
+        }
+        printf(1, "%s %d %d %d\n", fmtname(name), st.type, st.ino, st.size);
       }
-      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
     }
     break;
   }
@@ -0,0 +1,61 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+// membench [n] times, for n pages (100 if not given):
+//   sbrk        growing the heap by a page
+//   first touch the first write to each new page
+//   cow fault   a child's first write to each page it shares with
+//               its parent after fork()
+//   write       a write to a page that is already the process's own
+
+#define PGSIZE 4096
+
+int main(int argc, char *argv[]) {
+  uint64_t *t;
+  char *p, *heap;
+  int n, i;
+
+  n = argc > 1 ? atoi(argv[1]) : 100;
+  if (n <= 0 || (t = malloc(n * sizeof(*t))) == 0) {
+    printf(2, "usage: membench [n]\n");
+    exit();
+  }
+
+  heap = sbrk(0);
+  for (i = 0; i < n; i++) {
+    t[i] = now();
+    p = sbrk(PGSIZE);
+    t[i] = now() - t[i];
+    if (p == (char *)-1) {
+      printf(2, "membench: sbrk failed\n");
+      exit();
+    }
+  }
+  benchreport("sbrk", t, n);
+
+  for (i = 0; i < n; i++) {
+    t[i] = now();
+    heap[i * PGSIZE] = 1;
+    t[i] = now() - t[i];
+  }
+  benchreport("first touch", t, n);
+
+  if (fork() == 0) {
+    for (i = 0; i < n; i++) {
+      t[i] = now();
+      heap[i * PGSIZE] = 2;
+      t[i] = now() - t[i];
+    }
+    benchreport("cow fault", t, n);
+    for (i = 0; i < n; i++) {
+      t[i] = now();
+      heap[i * PGSIZE] = 3;
+      t[i] = now() - t[i];
+    }
+    benchreport("write", t, n);
+    exit();
+  }
+  wait();
+  exit();
+}
@@ -0,0 +1,87 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+
+// pipebench [n] times, n times each (100 if not given):
+//   pingpong     a byte sent to a child over one pipe and back over
+//                another, two context switches
+//   pipe size    moving XFER bytes through a pipe in writes of size
+//                bytes, for several sizes
+
+#define XFER (64 * 1024)
+#define MAXWRITE 4096
+
+static char buf[MAXWRITE];
+
+static void pingpong(uint64_t *t, int n) {
+  int to[2], from[2], i;
+  char c;
+
+  if (pipe(to) < 0 || pipe(from) < 0) {
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  if (fork() == 0) {
+    close(to[1]);
+    close(from[0]);
+    while (read(to[0], &c, 1) == 1)
+      write(from[1], &c, 1);
+    exit();
+  }
+  close(to[0]);
+  close(from[1]);
+  for (i = 0; i < n; i++) {
+    t[i] = now();
+    write(to[1], "x", 1);
+    read(from[0], &c, 1);
+    t[i] = now() - t[i];
+  }
+  close(to[1]);
+  close(from[0]);
+  wait();
+  benchreport("pingpong", t, n);
+}
+
+static void throughput(char *name, uint64_t *t, int n, int size) {
+  int fds[2], i, left, r;
+
+  for (i = 0; i < n; i++) {
+    if (pipe(fds) < 0) {
+      printf(2, "pipebench: pipe failed\n");
+      exit();
+    }
+    t[i] = now();
+    if (fork() == 0) {
+      close(fds[0]);
+      for (left = XFER; left > 0; left -= size)
+        write(fds[1], buf, size);
+      exit();
+    }
+    close(fds[1]);
+    for (left = XFER; left > 0 && (r = read(fds[0], buf, MAXWRITE)) > 0;
+         left -= r)
+      ;
+    t[i] = now() - t[i];
+    close(fds[0]);
+    wait();
+  }
+  benchreport(name, t, n);
+}
+
+int main(int argc, char *argv[]) {
+  int sizes[] = {64, 512, 4096};
+  char *names[] = {"pipe 64K, 64 byte writes", "pipe 64K, 512 byte writes",
+                   "pipe 64K, 4K writes"};
+  uint64_t *t;
+  int n, i;
+
+  n = argc > 1 ? atoi(argv[1]) : 100;
+  if (n <= 0 || (t = malloc(n * sizeof(*t))) == 0) {
+    printf(2, "usage: pipebench [n]\n");
+    exit();
+  }
+  pingpong(t, n);
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    throughput(names[i], t, n, sizes[i]);
+  exit();
+}
@@ -3,9 +3,9 @@
 #include <stdarg.h>
 #include <user.h>
 
-static void putc(int fd, char c) { write(fd, &c, 1); }
+static void putc(int fd, char c) { bputc(fd, c); }
 
-static void printint64(int fd, int xx, int base, int sgn) {
+static void printint64(int fd, int64_t xx, int base, int sgn) {
   static char digits[] = "0123456789abcdef";
   char buf[32];
   int i;
@@ -102,4 +102,5 @@ void printf(int fd, char *fmt, ...) {
   }
 
   va_end(valist);
+  bflushtty(fd);
 }
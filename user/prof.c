@@ -0,0 +1,137 @@
+#include <cdefs.h>
+#include <poll.h>
+#include <prof.h>
+#include <stat.h>
+#include <user.h>
+
+// prof [-r rate] cmd [args...] runs cmd with the sampling profiler on,
+// rate samples a tick (10 if not given), and prints each distinct
+// sample once, most frequent first:
+//   count name k|u rip caller...
+// name is the process's, k or u says whether the kernel or user code
+// was running, and the callers, kernel samples only, are return
+// addresses.  profsym.py on the host turns a console log of this into
+// function names, using out/xk.asm and out/user/_name.asm.
+
+#define NBUCKET 1024 // distinct samples kept
+#define NREAD 64
+
+struct entry {
+  struct profsample s;
+  int count;
+};
+
+static struct entry *table;
+static struct profsample buf[NREAD];
+static int nsamples, nlost;
+
+static int same(struct profsample *a, struct profsample *b) {
+  int i;
+
+  if (a->rip != b->rip || a->user != b->user || strcmp(a->name, b->name))
+    return 0;
+  for (i = 0; i < PROFDEPTH; i++)
+    if (a->pcs[i] != b->pcs[i])
+      return 0;
+  return 1;
+}
+
+static void count(struct profsample *s) {
+  struct entry *e;
+  uint64_t h;
+  int i;
+
+  nsamples++;
+  h = s->rip;
+  for (i = 0; i < PROFDEPTH; i++)
+    h = h * 31 + s->pcs[i];
+  for (i = 0; i < NBUCKET; i++) {
+    e = &table[(h + i) % NBUCKET];
+    if (e->count == 0) {
+      e->s = *s;
+      e->count = 1;
+      return;
+    }
+    if (same(&e->s, s)) {
+      e->count++;
+      return;
+    }
+  }
+  nlost++;
+}
+
+static void drain(void) {
+  int n, i;
+
+  while ((n = profile(PROF_READ, buf, NREAD)) > 0)
+    for (i = 0; i < n; i++)
+      count(&buf[i]);
+}
+
+int main(int argc, char *argv[]) {
+  struct pollfd pfd;
+  struct entry *e, *best;
+  int rate, pid, fds[2], dropped, i;
+  char c;
+
+  rate = 10;
+  argv++;
+  argc--;
+  if (argc >= 2 && strcmp(argv[0], "-r") == 0) {
+    rate = atoi(argv[1]);
+    argv += 2;
+    argc -= 2;
+  }
+  if (argc < 1) {
+    printf(2, "usage: prof [-r rate] cmd [args...]\n");
+    exit();
+  }
+  if ((table = malloc(NBUCKET * sizeof(*table))) == 0) {
+    printf(2, "prof: out of memory\n");
+    exit();
+  }
+  memset(table, 0, NBUCKET * sizeof(*table));
+
+  // cmd holds the write end of the pipe, so the read end hangs up
+  // when it exits; until then keep the sample buffers drained
+  if (pipe(fds) < 0 || profile(PROF_ON, 0, rate) < 0) {
+    printf(2, "prof: cannot start profiling at rate %d\n", rate);
+    exit();
+  }
+  if ((pid = fork()) == 0) {
+    close(fds[0]);
+    exec(argv[0], argv);
+    printf(2, "prof: exec %s failed\n", argv[0]);
+    exit();
+  }
+  close(fds[1]);
+  pfd.fd = fds[0];
+  pfd.events = POLLIN;
+  while (pid > 0) {
+    drain();
+    if (poll(&pfd, 1, 10) > 0 && read(fds[0], &c, 1) <= 0)
+      break;
+  }
+  dropped = profile(PROF_OFF, 0, 0);
+  drain();
+  if (pid > 0)
+    wait();
+
+  printf(1, "prof: %d samples, %d dropped, %d not kept, rate %d\n", nsamples,
+         dropped, nlost, rate);
+  for (;;) {
+    best = 0;
+    for (e = table; e < table + NBUCKET; e++)
+      if (e->count > 0 && (best == 0 || e->count > best->count))
+        best = e;
+    if (best == 0)
+      break;
+    printf(1, "%d %s %s %lx", best->count, best->s.name,
+           best->s.user ? "u" : "k", best->s.rip);
+    for (i = 0; i < PROFDEPTH && best->s.pcs[i]; i++)
+      printf(1, " %lx", best->s.pcs[i]);
+    printf(1, "\n");
+    best->count = 0;
+  }
+  exit();
+}
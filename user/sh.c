@@ -2,6 +2,7 @@
 
 #include <cdefs.h>
 #include <fcntl.h>
+#include <stat.h>
 #include <user.h>
 
 // Parsed command representation
@@ -51,11 +52,18 @@ struct backcmd {
 
 int fork1(void); // Fork but panics on failure.
 void panic(char *);
+void syntax(char *);
 struct cmd *parsecmd(char *);
+void freecmd(struct cmd *);
 
-// Execute cmd.  Never returns.
-void runcmd(struct cmd *cmd) {
-  int p[2];
+int syntaxerr; // set by the parser on a malformed line
+
+// Start cmd with fds[0], fds[1] and fds[2] as its standard input,
+// output and error.  Commands are started with spawn(), so the shell
+// itself is not copied for each of them.  Returns the number of child
+// processes started, which the caller must wait() for.
+int spawncmd(struct cmd *cmd, int *fds) {
+  int p[2], f[3], fd, n;
   struct backcmd *bcmd;
   struct execcmd *ecmd;
   struct listcmd *lcmd;
@@ -63,75 +71,79 @@ void runcmd(struct cmd *cmd) {
   struct redircmd *rcmd;
 
   if (cmd == 0)
-    exit();
+    return 0;
 
   switch (cmd->type) {
   default:
-    panic("runcmd");
+    panic("spawncmd");
 
   case EXEC:
     ecmd = (struct execcmd *)cmd;
     if (ecmd->argv[0] == 0)
-      exit();
-    exec(ecmd->argv[0], ecmd->argv);
-    printf(2, "exec %s failed\n", ecmd->argv[0]);
-    break;
+      return 0;
+    if (spawn(ecmd->argv[0], ecmd->argv, fds) < 0) {
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+      return 0;
+    }
+    return 1;
 
   case REDIR:
     rcmd = (struct redircmd *)cmd;
-    close(rcmd->fd);
-    if (open(rcmd->file, rcmd->mode) < 0) {
+    if ((fd = open(rcmd->file, rcmd->mode)) < 0) {
       printf(2, "open %s failed\n", rcmd->file);
-      exit();
+      return 0;
     }
-    runcmd(rcmd->cmd);
-    break;
+    memmove(f, fds, sizeof(f));
+    f[rcmd->fd] = fd;
+    n = spawncmd(rcmd->cmd, f);
+    close(fd);
+    return n;
 
   case LIST:
     lcmd = (struct listcmd *)cmd;
-    if (fork1() == 0)
-      runcmd(lcmd->left);
-    wait();
-    runcmd(lcmd->right);
-    break;
+    for (n = spawncmd(lcmd->left, fds); n > 0; n--)
+      wait();
+    return spawncmd(lcmd->right, fds);
 
   case PIPE:
     pcmd = (struct pipecmd *)cmd;
-    if (pipe(p) < 0)
-      panic("pipe");
-    if (fork1() == 0) {
-      close(1);
-      dup(p[1]);
-      close(p[0]);
-      close(p[1]);
-      runcmd(pcmd->left);
-    }
-    if (fork1() == 0) {
-      close(0);
-      dup(p[0]);
-      close(p[0]);
-      close(p[1]);
-      runcmd(pcmd->right);
+    if (pipe(p) < 0) {
+      printf(2, "pipe failed\n");
+      return 0;
     }
+    memmove(f, fds, sizeof(f));
+    f[1] = p[1];
+    n = spawncmd(pcmd->left, f);
+    memmove(f, fds, sizeof(f));
+    f[0] = p[0];
+    n += spawncmd(pcmd->right, f);
     close(p[0]);
     close(p[1]);
-    wait();
-    wait();
-    break;
+    return n;
 
   case BACK:
+    // The child leaves what it starts to init, so we don't wait for it
     bcmd = (struct backcmd *)cmd;
-    if (fork1() == 0)
-      runcmd(bcmd->cmd);
-    break;
+    if (fork1() == 0) {
+      spawncmd(bcmd->cmd, fds);
+      exit();
+    }
+    return 1;
   }
-  exit();
+  return 0;
 }
 
 int getcmd(char *buf, int nbuf) {
+  struct stat st;
+
   printf(2, "$ ");
   memset(buf, 0, nbuf);
-  gets(buf, nbuf);
+  // The console reads a line at a time, so take it in one read
+  // rather than gets()'s one a byte
+  if (fstat(0, &st) == 0 && st.type == T_DEV)
+    read(0, buf, nbuf - 1);
+  else
+    gets(buf, nbuf);
   if (buf[0] == 0) // EOF
     return -1;
   return 0;
@@ -139,7 +151,9 @@ int getcmd(char *buf, int nbuf) {
 
 int main(void) {
   static char buf[100];
-  int fd;
+  static int stdfds[3] = {0, 1, 2};
+  struct cmd *cmd;
+  int fd, n;
 
   // Ensure that three file descriptors are open.
   while ((fd = open("console", O_RDWR)) >= 0) {
@@ -158,9 +172,11 @@ int main(void) {
         printf(2, "cannot cd %s\n", buf + 3);
       continue;
     }
-    if (fork1() == 0)
-      runcmd(parsecmd(buf));
-    wait();
+    if ((cmd = parsecmd(buf)) == 0)
+      continue;
+    for (n = spawncmd(cmd, stdfds); n > 0; n--)
+      wait();
+    freecmd(cmd);
   }
   exit();
 }
@@ -170,6 +186,13 @@ void panic(char *s) {
   exit();
 }
 
+// Report a malformed command line, which parsecmd() then throws away.
+void syntax(char *s) {
+  if (!syntaxerr)
+    printf(2, "%s\n", s);
+  syntaxerr = 1;
+}
+
 int fork1(void) {
   int pid;
 
@@ -303,12 +326,17 @@ struct cmd *parsecmd(char *s) {
   char *es;
   struct cmd *cmd;
 
+  syntaxerr = 0;
   es = s + strlen(s);
   cmd = parseline(&s, es);
   peek(&s, es, "");
-  if (s != es) {
+  if (s != es && !syntaxerr) {
     printf(2, "leftovers: %s\n", s);
-    panic("syntax");
+    syntax("syntax");
+  }
+  if (syntaxerr) {
+    freecmd(cmd);
+    return 0;
   }
   nulterminate(cmd);
   return cmd;
@@ -346,8 +374,10 @@ struct cmd *parseredirs(struct cmd *cmd, char **ps, char *es) {
 
   while (peek(ps, es, "<>")) {
     tok = gettoken(ps, es, 0, 0);
-    if (gettoken(ps, es, &q, &eq) != 'a')
-      panic("missing file for redirection");
+    if (gettoken(ps, es, &q, &eq) != 'a') {
+      syntax("missing file for redirection");
+      break;
+    }
     switch (tok) {
     case '<':
       cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
@@ -371,7 +401,7 @@ struct cmd *parseblock(char **ps, char *es) {
   gettoken(ps, es, 0, 0);
   cmd = parseline(ps, es);
   if (!peek(ps, es, ")"))
-    panic("syntax - missing )");
+    syntax("syntax - missing )");
   gettoken(ps, es, 0, 0);
   cmd = parseredirs(cmd, ps, es);
   return cmd;
@@ -394,13 +424,17 @@ struct cmd *parseexec(char **ps, char *es) {
   while (!peek(ps, es, "|)&;")) {
     if ((tok = gettoken(ps, es, &q, &eq)) == 0)
       break;
-    if (tok != 'a')
-      panic("syntax");
+    if (tok != 'a') {
+      syntax("syntax");
+      break;
+    }
+    if (argc == MAXARGS - 1) {
+      syntax("too many args");
+      break;
+    }
     cmd->argv[argc] = q;
     cmd->eargv[argc] = eq;
     argc++;
-    if (argc >= MAXARGS)
-      panic("too many args");
     ret = parseredirs(ret, ps, es);
   }
   cmd->argv[argc] = 0;
@@ -452,3 +486,30 @@ struct cmd *nulterminate(struct cmd *cmd) {
   }
   return cmd;
 }
+
+// Free a command parsecmd() returned.
+void freecmd(struct cmd *cmd) {
+  if (cmd == 0)
+    return;
+
+  switch (cmd->type) {
+  case REDIR:
+    freecmd(((struct redircmd *)cmd)->cmd);
+    break;
+
+  case PIPE:
+    freecmd(((struct pipecmd *)cmd)->left);
+    freecmd(((struct pipecmd *)cmd)->right);
+    break;
+
+  case LIST:
+    freecmd(((struct listcmd *)cmd)->left);
+    freecmd(((struct listcmd *)cmd)->right);
+    break;
+
+  case BACK:
+    freecmd(((struct backcmd *)cmd)->cmd);
+    break;
+  }
+  free(cmd);
+}
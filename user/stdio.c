@@ -0,0 +1,132 @@
+// Buffered output for user programs.
+//
+// printf() and bputc()/bwrite() collect output for each fd in a
+// buffer, allocated the first time the fd is written to, and write()
+// it out in one go.  Output to a device, the console, goes out at the
+// end of each call, so it shows up at once and prompts need no
+// flushing; output to files and pipes waits until the buffer fills.
+// fork(), exec(), spawn(), close() and exit() flush first, so output
+// is neither lost nor written twice.
+
+#include <cdefs.h>
+#include <param.h>
+#include <stat.h>
+#include <user.h>
+
+#define STDIOBUF 512
+
+struct obuf {
+  int n;     // bytes buffered
+  int tty;   // a device: flush at the end of each call?
+  char data[STDIOBUF];
+};
+
+static struct obuf *obufs[NOFILE];
+
+// the system calls the wrappers below make, in usys.S
+int _fork(void);
+noreturn void _exit(void);
+int _exec(char *, char **);
+int _spawn(char *, char **, int *);
+int _close(int);
+
+static struct obuf *getbuf(int fd) {
+  struct obuf *b;
+  struct stat st;
+
+  if (fd < 0 || fd >= NOFILE)
+    return 0;
+  if ((b = obufs[fd]) == 0 && (b = malloc(sizeof(*b))) != 0) {
+    b->n = 0;
+    b->tty = fstat(fd, &st) == 0 && st.type == T_DEV;
+    obufs[fd] = b;
+  }
+  return b;
+}
+
+// Write out what is buffered for fd.  Returns -1 if the write failed.
+int bflush(int fd) {
+  struct obuf *b;
+  int n;
+
+  if (fd < 0 || fd >= NOFILE || (b = obufs[fd]) == 0 || b->n == 0)
+    return 0;
+  n = b->n;
+  b->n = 0;
+  return write(fd, b->data, n) == n ? 0 : -1;
+}
+
+void bflushall(void) {
+  int fd;
+
+  for (fd = 0; fd < NOFILE; fd++)
+    bflush(fd);
+}
+
+// Buffer n bytes for fd.  Returns n, or -1 on a write error.
+int bwrite(int fd, char *s, int n) {
+  struct obuf *b;
+  int m, i;
+
+  if ((b = getbuf(fd)) == 0)
+    return write(fd, s, n);
+  for (i = 0; i < n; i += m) {
+    if (b->n == STDIOBUF && bflush(fd) < 0)
+      return -1;
+    m = min(n - i, STDIOBUF - b->n);
+    memmove(b->data + b->n, s + i, m);
+    b->n += m;
+  }
+  if (b->tty && bflush(fd) < 0)
+    return -1;
+  return n;
+}
+
+void bputc(int fd, char c) {
+  struct obuf *b;
+
+  if ((b = getbuf(fd)) == 0) {
+    write(fd, &c, 1);
+    return;
+  }
+  if (b->n == STDIOBUF)
+    bflush(fd);
+  b->data[b->n++] = c;
+}
+
+// Write out what is buffered for fd if it is a device; printf()
+// calls this once it has passed all its characters to bputc().
+void bflushtty(int fd) {
+  if (fd >= 0 && fd < NOFILE && obufs[fd] && obufs[fd]->tty)
+    bflush(fd);
+}
+
+int fork(void) {
+  bflushall();
+  return _fork();
+}
+
+noreturn void exit(void) {
+  bflushall();
+  _exit();
+}
+
+int exec(char *path, char **argv) {
+  bflushall();
+  return _exec(path, argv);
+}
+
+int spawn(char *path, char **argv, int *fds) {
+  bflushall();
+  return _spawn(path, argv, fds);
+}
+
+// The fd may next name another kind of file, so its buffer goes
+int close(int fd) {
+  if (fd >= 0 && fd < NOFILE && obufs[fd]) {
+    bflush(fd);
+    free(obufs[fd]);
+    obufs[fd] = 0;
+  }
+  return _close(fd);
+}
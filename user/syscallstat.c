@@ -0,0 +1,97 @@
+#include <cdefs.h>
+#include <scstat.h>
+#include <stat.h>
+#include <user.h>
+
+// syscallstat prints, for each system call made, how many calls were
+// timed, their mean, 50th and 99th percentile and slowest times in
+// cycles (percentiles to the top of their log2 bucket), and the
+// histogram's non-empty buckets as log2:count.
+//   syscallstat -p  prints each process's call count and time instead
+//   syscallstat -r  zeroes the histograms
+//   syscallstat on|off  turns timing on or off
+
+static char *names[NSYSCALL] = {
+    [SYS_fork] = "fork", [SYS_exit] = "exit", [SYS_wait] = "wait",
+    [SYS_pipe] = "pipe", [SYS_read] = "read", [SYS_kill] = "kill",
+    [SYS_exec] = "exec", [SYS_fstat] = "fstat", [SYS_chdir] = "chdir",
+    [SYS_dup] = "dup", [SYS_getpid] = "getpid", [SYS_sbrk] = "sbrk",
+    [SYS_sleep] = "sleep", [SYS_uptime] = "uptime", [SYS_open] = "open",
+    [SYS_write] = "write", [SYS_mknod] = "mknod", [SYS_unlink] = "unlink",
+    [SYS_link] = "link", [SYS_mkdir] = "mkdir", [SYS_close] = "close",
+    [SYS_sysinfo] = "sysinfo", [SYS_crashn] = "crashn", [SYS_mmap] = "mmap",
+    [SYS_munmap] = "munmap", [SYS_nice] = "nice", [SYS_spawn] = "spawn",
+    [SYS_pread] = "pread", [SYS_pwrite] = "pwrite", [SYS_readv] = "readv",
+    [SYS_writev] = "writev", [SYS_sendfile] = "sendfile",
+    [SYS_splice] = "splice", [SYS_poll] = "poll", [SYS_fsync] = "fsync",
+    [SYS_fdatasync] = "fdatasync", [SYS_lockstat] = "lockstat",
+    [SYS_syscallstat] = "syscallstat", [SYS_trace] = "trace",
+    [SYS_profile] = "profile", [SYS_cycles] = "cycles",
+    [SYS_clock_gettime] = "clock_gettime",
+    [SYS_consmode] = "consmode", [SYS_clone] = "clone", [SYS_join] = "join",
+    [SYS_futex_wait] = "futex_wait", [SYS_futex_wake] = "futex_wake",
+    [SYS_shmget] = "shmget", [SYS_shmat] = "shmat", [SYS_shmdt] = "shmdt",
+    [SYS_ring_setup] = "ring_setup", [SYS_ring_enter] = "ring_enter",
+    [SYS_getdents] = "getdents", [SYS_fstatat] = "fstatat",
+    [SYS_clone_file] = "clone_file", [SYS_fpunch] = "fpunch",
+    [SYS_defrag] = "defrag",
+};
+
+static struct scstat st;
+static struct scproc procs[64];
+
+// Upper bound of the bucket holding the call at fraction num/den.
+static uint64_t percentile(uint *hist, uint64_t calls, int num, int den) {
+  uint64_t want, seen;
+  int b;
+
+  want = (calls * num + den - 1) / den;
+  seen = 0;
+  for (b = 0; b < NLATBUCKET - 1; b++)
+    if ((seen += hist[b]) >= want)
+      break;
+  return (2UL << b) - 1;
+}
+
+int main(int argc, char *argv[]) {
+  int i, b, n;
+
+  if (argc > 1) {
+    if (strcmp(argv[1], "-r") == 0) {
+      syscallstat(SCS_RESET, 0, 0);
+    } else if (strcmp(argv[1], "on") == 0) {
+      syscallstat(SCS_ON, 0, 0);
+    } else if (strcmp(argv[1], "off") == 0) {
+      syscallstat(SCS_OFF, 0, 0);
+    } else if (strcmp(argv[1], "-p") == 0) {
+      n = syscallstat(SCS_PROCS, procs, sizeof(procs) / sizeof(procs[0]));
+      printf(1, "pid name calls cycles\n");
+      for (i = 0; i < n; i++)
+        printf(1, "%d %s %ld %ld\n", procs[i].pid, procs[i].name,
+               procs[i].calls, procs[i].cycles);
+    } else {
+      printf(2, "usage: syscallstat [-p | -r | on | off]\n");
+    }
+    exit();
+  }
+
+  if (syscallstat(SCS_GET, &st, 0) < 0) {
+    printf(2, "syscallstat: failed\n");
+    exit();
+  }
+  if (!st.on)
+    printf(1, "(timing is off)\n");
+  printf(1, "call calls mean p50 p99 max histogram\n");
+  for (i = 0; i < NSYSCALL; i++) {
+    if (st.calls[i] == 0)
+      continue;
+    printf(1, "%s %ld %ld %ld %ld %ld", names[i] ? names[i] : "?", st.calls[i],
+           st.cycles[i] / st.calls[i], percentile(st.hist[i], st.calls[i], 1, 2),
+           percentile(st.hist[i], st.calls[i], 99, 100), st.max[i]);
+    for (b = 0; b < NLATBUCKET; b++)
+      if (st.hist[i][b])
+        printf(1, " %d:%d", b, st.hist[i][b]);
+    printf(1, "\n");
+  }
+  exit();
+}
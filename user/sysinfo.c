@@ -4,15 +4,111 @@
 #include <sysinfo.h>
 #include <user.h>
 
+// sysinfo prints every counter the kernel keeps.
+// sysinfo interval [count] instead prints, every interval ticks, how
+// much the main ones moved since the last report, count times or for
+// ever.
+
+static void printall(struct sys_info *info) {
+  uint64_t n;
+
+  printf(1, "version = %d\n", info->version);
+  printf(1, "pages_in_use = %d\n", info->pages_in_use);
+  printf(1, "pages_in_swap = %d\n", info->pages_in_swap);
+  printf(1, "free_pages = %d\n", info->free_pages);
+  printf(1, "num_page_faults = %d\n", info->num_page_faults);
+  printf(1, "cow_reuses = %d\n", info->cow_reuses);
+  printf(1, "cow_copies = %d\n", info->cow_copies);
+  printf(1, "swap_outs = %d\n", info->swap_outs);
+  printf(1, "swap_ins = %d\n", info->swap_ins);
+  printf(1, "clock_scans = %d\n", info->clock_scans);
+  printf(1, "clock_referenced = %d\n", info->clock_referenced);
+  printf(1, "num_disk_reads = %d\n", info->num_disk_reads);
+  printf(1, "bcache_size = %d\n", info->bcache_size);
+  printf(1, "bcache_hits = %d\n", info->bcache_hits);
+  printf(1, "bcache_misses = %d\n", info->bcache_misses);
+  printf(1, "icache_size = %d\n", info->icache_size);
+  printf(1, "icache_hits = %d\n", info->icache_hits);
+  printf(1, "icache_misses = %d\n", info->icache_misses);
+  printf(1, "dcache_hits = %d\n", info->dcache_hits);
+  printf(1, "dcache_misses = %d\n", info->dcache_misses);
+  printf(1, "pcache_size = %d\n", info->pcache_size);
+  printf(1, "pcache_hits = %d\n", info->pcache_hits);
+  printf(1, "pcache_misses = %d\n", info->pcache_misses);
+  for (int i = 0; i <= MAXORDER; i++)
+    printf(1, "free_blocks[%d] = %d\n", i, info->free_blocks[i]);
+  if (info->version < 2)
+    return;
+
+  printf(1, "disk_reads = %ld\n", info->disk_reads);
+  printf(1, "disk_writes = %ld\n", info->disk_writes);
+  printf(1, "disk_requests = %ld\n", info->disk_requests);
+  printf(1, "log_commits = %ld\n", info->log_commits);
+  printf(1, "log_blocks = %ld\n", info->log_blocks);
+  printf(1, "log_checkpoints = %ld\n", info->log_checkpoints);
+  printf(1, "ctxswitches = %ld\n", info->ctxswitches);
+  printf(1, "ticks = %ld\n", info->ticks);
+  for (int i = 0; i < info->ncpu; i++)
+    printf(1, "cpu_idle[%d] = %ld\n", i, info->cpu_idle[i]);
+  for (int i = 0; i < NSYSCALL; i++)
+    if ((n = info->syscalls[i]) != 0)
+      printf(1, "syscalls[%d] = %ld\n", i, n);
+}
+
+// Percent of b that a is, for hit rates and idle time
+static int pct(uint64_t a, uint64_t b) {
+  return b ? (int)(a * 100 / b) : 0;
+}
+
+static void printdelta(struct sys_info *a, struct sys_info *b) {
+  uint64_t calls, hits, lookups, cycles;
+
+  calls = 0;
+  for (int i = 0; i < NSYSCALL; i++)
+    calls += b->syscalls[i] - a->syscalls[i];
+  hits = b->bcache_hits - a->bcache_hits;
+  lookups = hits + b->bcache_misses - a->bcache_misses;
+
+  printf(1, "syscalls %ld switches %ld faults %d cow %d bcache %ld%% of %ld "
+            "disk r %ld w %ld req %ld log commits %ld blocks %ld idle",
+         calls, b->ctxswitches - a->ctxswitches,
+         b->num_page_faults - a->num_page_faults,
+         b->cow_reuses + b->cow_copies - a->cow_reuses - a->cow_copies,
+         (uint64_t)pct(hits, lookups), lookups, b->disk_reads - a->disk_reads,
+         b->disk_writes - a->disk_writes, b->disk_requests - a->disk_requests,
+         b->log_commits - a->log_commits, b->log_blocks - a->log_blocks);
+  cycles = b->tsc - a->tsc;
+  for (int i = 0; i < b->ncpu; i++)
+    printf(1, " %d%%", pct(b->cpu_idle[i] - a->cpu_idle[i], cycles));
+  printf(1, "\n");
+}
+
 int main(int argc, char *argv[]) {
-  struct sys_info info;
-  sysinfo(&info);
+  struct sys_info a, b;
+  int interval, count;
 
-  printf(1, "pages_in_use = %d\n", info.pages_in_use);
-  printf(1, "pages_in_swap = %d\n", info.pages_in_swap);
-  printf(1, "free_pages = %d\n", info.free_pages);
-  printf(1, "num_page_faults = %d\n", info.num_page_faults);
-  printf(1, "num_disk_reads = %d\n", info.num_disk_reads);
+  if (sysinfo(&a) < 0) {
+    printf(2, "sysinfo: failed\n");
+    exit();
+  }
+  if (argc < 2) {
+    printall(&a);
+    exit();
+  }
+  if (a.version < 2) {
+    printf(2, "sysinfo: kernel too old for deltas\n");
+    exit();
+  }
 
+  interval = atoi(argv[1]);
+  count = argc > 2 ? atoi(argv[2]) : -1;
+  while (count != 0) {
+    sleep(interval);
+    sysinfo(&b);
+    printdelta(&a, &b);
+    a = b;
+    if (count > 0)
+      count--;
+  }
   exit();
 }
@@ -0,0 +1,109 @@
+#include <cdefs.h>
+#include <fcntl.h>
+#include <stat.h>
+#include <trace.h>
+#include <user.h>
+
+// trace records kernel events into per-CPU rings and saves them.
+//   trace on|off  turns tracing on or off
+//   trace dump file  drains the rings into file
+//   trace file cmd [args...]  traces cmd until it exits, then dumps
+//   trace show file  prints a dump as a timeline, one event a line:
+//     cycles since the first event, cpu, pid, event, a, b
+// There is no way to copy files out of the image, so the host decodes
+// a trace by capturing what "trace show" prints on the serial port.
+
+#define NREC 128
+
+static char *names[] = {
+    [TR_SWITCH] = "switch",   [TR_SLEEP] = "sleep",
+    [TR_WAKEUP] = "wakeup",   [TR_DISKSUBMIT] = "disksubmit",
+    [TR_DISKDONE] = "diskdone", [TR_COMMIT] = "commit",
+    [TR_BMISS] = "bmiss",     [TR_PGFAULT] = "pgfault",
+    [TR_LOST] = "lost",
+};
+
+static struct tracerec recs[NREC];
+
+// Drain the rings into path.  Returns the number of records saved.
+static int dump(char *path) {
+  int fd, n, total;
+
+  // open() cannot truncate, so a shorter dump would keep an old tail
+  unlink(path);
+  if ((fd = open(path, O_CREATE | O_RDWR)) < 0) {
+    printf(2, "trace: cannot create %s\n", path);
+    return -1;
+  }
+  total = 0;
+  while ((n = trace(TRACE_READ, recs, NREC)) > 0) {
+    if (write(fd, recs, n * sizeof(recs[0])) != n * sizeof(recs[0])) {
+      printf(2, "trace: write %s failed\n", path);
+      break;
+    }
+    total += n;
+  }
+  close(fd);
+  return total;
+}
+
+static void show(char *path) {
+  uint64_t first;
+  struct tracerec *r;
+  int fd, n, i, started;
+
+  if ((fd = open(path, O_RDONLY)) < 0) {
+    printf(2, "trace: cannot open %s\n", path);
+    exit();
+  }
+  first = 0;
+  started = 0;
+  while ((n = read(fd, recs, sizeof(recs))) > 0) {
+    for (i = 0; i < n / (int)sizeof(recs[0]); i++) {
+      r = &recs[i];
+      if (!started) {
+        first = r->tsc;
+        started = 1;
+      }
+      printf(1, "%ld %d %d ", r->tsc - first, r->cpu, r->pid);
+      if (r->type < sizeof(names) / sizeof(names[0]) && names[r->type])
+        printf(1, "%s", names[r->type]);
+      else
+        printf(1, "%d", r->type);
+      printf(1, " %lx %lx\n", r->a, r->b);
+    }
+  }
+  close(fd);
+}
+
+int main(int argc, char *argv[]) {
+  int pid;
+
+  if (argc == 2 && strcmp(argv[1], "on") == 0) {
+    trace(TRACE_ON, 0, 0);
+  } else if (argc == 2 && strcmp(argv[1], "off") == 0) {
+    trace(TRACE_OFF, 0, 0);
+  } else if (argc == 3 && strcmp(argv[1], "dump") == 0) {
+    printf(1, "%d records\n", dump(argv[2]));
+  } else if (argc == 3 && strcmp(argv[1], "show") == 0) {
+    show(argv[2]);
+  } else if (argc >= 3) {
+    // Throw away what was recorded before cmd starts
+    while (trace(TRACE_READ, recs, NREC) > 0)
+      ;
+    trace(TRACE_ON, 0, 0);
+    if ((pid = fork()) == 0) {
+      exec(argv[2], argv + 2);
+      printf(2, "trace: exec %s failed\n", argv[2]);
+      exit();
+    }
+    if (pid > 0)
+      wait();
+    trace(TRACE_OFF, 0, 0);
+    printf(1, "%d records\n", dump(argv[1]));
+  } else {
+    printf(2, "usage: trace on|off | dump file | show file | "
+              "file cmd [args...]\n");
+  }
+  exit();
+}
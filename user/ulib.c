@@ -1,6 +1,8 @@
 #include <cdefs.h>
+#include <clock.h>
 #include <fcntl.h>
 #include <stat.h>
+#include <uring.h>
 #include <user.h>
 #include <x86_64.h>
 
@@ -27,8 +29,30 @@ uint strlen(char *s) {
   return n;
 }
 
+// Does the CPU have enhanced "rep movsb/stosb" (ERMS), which does at
+// least as well as moving a word at a time?  -1 until we look.
+static int erms = -1;
+
+static int haserms(void) {
+  uint32_t eax, ebx;
+
+  if (erms < 0) {
+    cpuid(0, &eax, 0, 0, 0);
+    ebx = 0;
+    if (eax >= 7)
+      asm volatile("cpuid" : "=b"(ebx), "=a"(eax) : "a"(7), "c"(0) : "edx");
+    erms = (ebx >> 9) & 1;
+  }
+  return erms;
+}
+
 void *memset(void *dst, int c, uint n) {
-  stosb(dst, c, n);
+  if (n < 8 || haserms()) {
+    stosb(dst, c, n);
+  } else {
+    stosq(dst, (c & 0xFF) * 0x0101010101010101ULL, n / 8);
+    stosb((char *)dst + (n & ~7), c, n % 8);
+  }
   return dst;
 }
 
@@ -56,15 +80,7 @@ char *gets(char *buf, int max) {
 }
 
 int stat(char *n, struct stat *st) {
-  int fd;
-  int r;
-
-  fd = open(n, O_RDONLY);
-  if (fd < 0)
-    return -1;
-  r = fstat(fd, st);
-  close(fd);
-  return r;
+  return fstatat(AT_FDCWD, n, st);
 }
 
 int atoi(const char *s) {
@@ -81,7 +97,124 @@ void *memmove(void *vdst, void *vsrc, int n) {
 
   dst = vdst;
   src = vsrc;
-  while (n-- > 0)
-    *dst++ = *src++;
+  if (n <= 0)
+    return vdst;
+  if (src < dst && src + n > dst) {
+    // Overlapping: copy from the end down, a word at a time if the
+    // ends are aligned, as the kernel's memmove() does
+    src += n;
+    dst += n;
+    if (((uint64_t)src | (uint64_t)dst) % 8 == 0) {
+      for (; n >= 8; n -= 8) {
+        src -= 8;
+        dst -= 8;
+        *(uint64_t *)dst = *(uint64_t *)src;
+      }
+    }
+    while (n-- > 0)
+      *--dst = *--src;
+  } else if (n < 8 || haserms()) {
+    movsb(dst, src, n);
+  } else {
+    movsq(dst, src, n / 8);
+    movsb(dst + (n & ~7), src + (n & ~7), n % 8);
+  }
   return vdst;
-}
\ No newline at end of file
+}
+
+int _clock_gettime(int, struct timespec *); // in usys.S
+
+// Read the clock from the clock page the kernel maps into every
+// process, without a system call.
+int clock_gettime(int clk, struct timespec *ts) {
+  struct clockpage *c = (struct clockpage *)CLOCKPAGE;
+  uint64_t ns;
+
+  if (clk != CLOCK_MONOTONIC || c->mult == 0)
+    return _clock_gettime(clk, ts);
+  ns = clockns(c, rdtsc());
+  ts->tv_sec = ns / 1000000000;
+  ts->tv_nsec = ns % 1000000000;
+  return 0;
+}
+
+// Take m, which is held by someone else, marking it as waited for so
+// that mutex_unlock() wakes us.
+static void mutex_wait(struct mutex *m) {
+  while (__atomic_exchange_n(&m->state, 2, __ATOMIC_ACQUIRE) != 0)
+    futex_wait(&m->state, 2);
+}
+
+void mutex_lock(struct mutex *m) {
+  int c = 0;
+
+  if (!__atomic_compare_exchange_n(&m->state, &c, 1, 0, __ATOMIC_ACQUIRE,
+                                   __ATOMIC_RELAXED))
+    mutex_wait(m);
+}
+
+void mutex_unlock(struct mutex *m) {
+  // Only a lock someone may be waiting for needs a system call
+  if (__atomic_exchange_n(&m->state, 0, __ATOMIC_RELEASE) == 2)
+    futex_wake(&m->state, 1);
+}
+
+// Release m, wait for a cond_signal() or cond_broadcast() on c and
+// take m again.  Callers check their condition again, since a
+// wakeup may be spurious.
+void cond_wait(struct cond *c, struct mutex *m) {
+  int seq;
+
+  __atomic_fetch_add(&c->waiters, 1, __ATOMIC_SEQ_CST);
+  seq = __atomic_load_n(&c->seq, __ATOMIC_SEQ_CST);
+  mutex_unlock(m);
+  // A signal since we read seq changes it, and the wait returns
+  futex_wait(&c->seq, seq);
+  __atomic_fetch_sub(&c->waiters, 1, __ATOMIC_RELAXED);
+  // Others woken with us may be waiting for m
+  mutex_wait(m);
+}
+
+void cond_signal(struct cond *c) {
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    futex_wake(&c->seq, 1);
+}
+
+void cond_broadcast(struct cond *c) {
+  __atomic_fetch_add(&c->seq, 1, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&c->waiters, __ATOMIC_SEQ_CST) > 0)
+    futex_wake(&c->seq, 1 << 30);
+}
+
+// Queue the system call op(a0, a1, a2, a3) on r for the next
+// ring_enter().  Returns 0, or -1 if the queue is full.
+int ring_push(struct ring *r, int op, uint64_t a0, uint64_t a1, uint64_t a2,
+              uint64_t a3, uint64_t data) {
+  struct ringsqe *e;
+  uint tail = r->sqtail;
+
+  if (tail - __atomic_load_n(&r->sqhead, __ATOMIC_ACQUIRE) >= RINGN)
+    return -1;
+  e = &r->sq[tail % RINGN];
+  e->op = op;
+  e->args[0] = a0;
+  e->args[1] = a1;
+  e->args[2] = a2;
+  e->args[3] = a3;
+  e->data = data;
+  __atomic_store_n(&r->sqtail, tail + 1, __ATOMIC_RELEASE);
+  return 0;
+}
+
+// Take the oldest completion on r into *c.  Returns 0, or -1 if there
+// is none.
+int ring_pop(struct ring *r, struct ringcqe *c) {
+  uint head = r->cqhead;
+
+  if (head == __atomic_load_n(&r->cqtail, __ATOMIC_ACQUIRE))
+    return -1;
+  *c = r->cq[head % RINGN];
+  __atomic_store_n(&r->cqhead, head + 1, __ATOMIC_RELEASE);
+  return 0;
+}
@@ -3,82 +3,200 @@
 #include <stat.h>
 #include <user.h>
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator with segregated size classes.
+//
+// A request small enough for one of the NCLASS size classes gets a
+// block of CLASSSIZE(c) bytes, header included, off class c's free
+// list, and free() puts it back on the front, so both take constant
+// time.  A class with no free blocks cuts a fresh page into them.
+//
+// Larger requests get whole pages.  Free pages are kept in runs on a
+// list in address order, where free() merges neighbours, and more
+// come from sbrk().  The kernel does not shrink heaps, so pages once
+// got stay on the run list for reuse.
 
-typedef long Align;
+#define PAGE 4096
+#define NCLASS 8                 // 32, 64, ... 4096 bytes
+#define CLASSSIZE(c) (32UL << (c))
+#define LARGE NCLASS             // class of a block of whole pages
+#define MINGROW (16 * PAGE)      // least to ask sbrk() for at a time
 
-union header {
-  struct {
-    union header *ptr;
-    uint size;
-  } s;
-  Align x;
+// Precedes every block; keeps what follows 16-byte aligned
+struct header {
+  uint64_t size;   // bytes in the block, header included
+  uint64_t class;
 };
 
-typedef union header Header;
+struct block {
+  struct header h;
+  struct block *next;  // next free block of its class
+};
 
-static Header base;
-static Header *freep;
+// A run of free pages
+struct run {
+  uint64_t size;
+  struct run *next;
+};
 
-void free(void *ap) {
-  Header *bp, *p;
-
-  bp = (Header *)ap - 1;
-  for (p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if (p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if (bp + bp->s.size == p->s.ptr) {
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if (p + p->s.size == bp) {
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+static struct block *freelist[NCLASS];
+static struct run *runs;
+
+static struct {
+  int inuse[NCLASS + 1];  // blocks handed out, by class
+  int nfree[NCLASS];      // blocks on the free lists
+  uint64_t large;         // bytes in large blocks handed out
+  uint64_t heap;          // bytes sbrk() gave us
+} stats;
+
+// Get n bytes, a multiple of PAGE, from the top of the heap,
+// page aligned.
+static char *morecore(uint64_t n) {
+  char *p;
+  uint64_t pad;
+
+  p = sbrk(0);
+  pad = (PAGE - (uint64_t)p % PAGE) % PAGE;
+  if (n + pad > 0x7fffffff || (p = sbrk(n + pad)) == (char *)-1)
+    return 0;
+  stats.heap += n + pad;
+  return p + pad;
 }
 
-static Header *morecore(uint nu) {
+// Put n bytes of pages starting at p on the run list, merging them
+// with the runs on either side.
+static void pagefree(char *p, uint64_t n) {
+  struct run *r, **rp, *prev;
+
+  prev = 0;
+  for (rp = &runs; *rp && (char *)*rp < p; rp = &(*rp)->next)
+    prev = *rp;
+  r = (struct run *)p;
+  r->size = n;
+  r->next = *rp;
+  if (r->next && p + n == (char *)r->next) {
+    r->size += r->next->size;
+    r->next = r->next->next;
+  }
+  if (prev && (char *)prev + prev->size == p) {
+    prev->size += r->size;
+    prev->next = r->next;
+    r = prev;
+  } else {
+    *rp = r;
+  }
+}
+
+// Get n bytes of pages, n a multiple of PAGE, first fit from the run
+// list, growing the heap if no run is big enough.
+static char *pagealloc(uint64_t n) {
+  struct run *r, **rp;
+  uint64_t m;
   char *p;
-  Header *hp;
 
-  if (nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if (p == (char *)-1)
+  for (rp = &runs; (r = *rp) != 0; rp = &r->next) {
+    if (r->size == n) {
+      *rp = r->next;
+      return (char *)r;
+    }
+    if (r->size > n) {
+      // take the end, which leaves the run where it is on the list
+      r->size -= n;
+      return (char *)r + r->size;
+    }
+  }
+
+  // Grow by at least MINGROW and keep the rest as a free run
+  m = max(n, (uint64_t)MINGROW);
+  if ((p = morecore(m)) == 0)
     return 0;
-  hp = (Header *)p;
-  hp->s.size = nu;
-  free((void *)(hp + 1));
-  return freep;
+  if (m > n)
+    pagefree(p, m - n);
+  return p + m - n;
+}
+
+// Cut a fresh page into free blocks of class c.
+static int refill(int c) {
+  struct block *b;
+  char *p;
+  uint64_t off;
+
+  if ((p = pagealloc(PAGE)) == 0)
+    return -1;
+  for (off = 0; off < PAGE; off += CLASSSIZE(c)) {
+    b = (struct block *)(p + off);
+    b->h.size = CLASSSIZE(c);
+    b->h.class = c;
+    b->next = freelist[c];
+    freelist[c] = b;
+    stats.nfree[c]++;
+  }
+  return 0;
 }
 
 void *malloc(uint nbytes) {
-  Header *p, *prevp;
-  uint nunits;
+  struct header *h;
+  struct block *b;
+  uint64_t n;
+  int c;
 
-  nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
-  if ((prevp = freep) == 0) {
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
+  n = (uint64_t)nbytes + sizeof(struct header);
+  for (c = 0; c < NCLASS && CLASSSIZE(c) < n; c++)
+    ;
+
+  if (c == NCLASS) {
+    n = (n + PAGE - 1) / PAGE * PAGE;
+    if ((h = (struct header *)pagealloc(n)) == 0)
+      return 0;
+    h->size = n;
+    h->class = LARGE;
+    stats.inuse[LARGE]++;
+    stats.large += n;
+    return h + 1;
   }
-  for (p = prevp->s.ptr;; prevp = p, p = p->s.ptr) {
-    if (p->s.size >= nunits) {
-      if (p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void *)(p + 1);
-    }
-    if (p == freep)
-      if ((p = morecore(nunits)) == 0)
-        return 0;
+
+  if (freelist[c] == 0 && refill(c) < 0)
+    return 0;
+  b = freelist[c];
+  freelist[c] = b->next;
+  stats.nfree[c]--;
+  stats.inuse[c]++;
+  return &b->h + 1;
+}
+
+void free(void *ap) {
+  struct block *b;
+  uint64_t c;
+
+  if (ap == 0)
+    return;
+  b = (struct block *)((struct header *)ap - 1);
+  c = b->h.class;
+  if (c == LARGE) {
+    stats.inuse[LARGE]--;
+    stats.large -= b->h.size;
+    pagefree((char *)b, b->h.size);
+    return;
   }
-}
\ No newline at end of file
+  b->next = freelist[c];
+  freelist[c] = b;
+  stats.inuse[c]--;
+  stats.nfree[c]++;
+}
+
+// Print how the heap is being used to fd.
+void mallocstats(int fd) {
+  struct run *r;
+  uint64_t nfree;
+  int c;
+
+  printf(fd, "class size inuse free\n");
+  for (c = 0; c < NCLASS; c++)
+    printf(fd, "%d %d %d %d\n", c, (int)CLASSSIZE(c), stats.inuse[c],
+           stats.nfree[c]);
+  nfree = 0;
+  for (r = runs; r; r = r->next)
+    nfree += r->size;
+  printf(fd, "large blocks %d, %d bytes; free pages %d; heap %d bytes\n",
+         stats.inuse[LARGE], (int)stats.large, (int)(nfree / PAGE),
+         (int)stats.heap);
+}